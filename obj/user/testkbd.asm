@@ -0,0 +1,8666 @@
+
+obj/user/testkbd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 12 05 00 00       	call   80053e <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i, r;
+
+  // Spin for a bit to let the console quiet
+  for (i = 0; i < 10; ++i)
+  800041:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800048:	eb 10                	jmp    80005a <umain+0x28>
+    sys_yield();
+  80004a:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  800051:	00 00 00 
+  800054:	ff d0                	call   *%rax
+  for (i = 0; i < 10; ++i)
+  800056:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80005a:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+  80005e:	7e ea                	jle    80004a <umain+0x18>
+
+  close(0);
+  800060:	bf 00 00 00 00       	mov    $0x0,%edi
+  800065:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  80006c:	00 00 00 
+  80006f:	ff d0                	call   *%rax
+  if ((r = opencons()) < 0)
+  800071:	48 b8 84 02 80 00 00 	movabs $0x800284,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  800080:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800084:	79 36                	jns    8000bc <umain+0x8a>
+    panic("opencons: %i", r);
+  800086:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800089:	89 c1                	mov    %eax,%ecx
+  80008b:	48 b8 c0 56 80 00 00 	movabs $0x8056c0,%rax
+  800092:	00 00 00 
+  800095:	48 89 c2             	mov    %rax,%rdx
+  800098:	be 0e 00 00 00       	mov    $0xe,%esi
+  80009d:	48 b8 cd 56 80 00 00 	movabs $0x8056cd,%rax
+  8000a4:	00 00 00 
+  8000a7:	48 89 c7             	mov    %rax,%rdi
+  8000aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000af:	49 b8 e5 05 80 00 00 	movabs $0x8005e5,%r8
+  8000b6:	00 00 00 
+  8000b9:	41 ff d0             	call   *%r8
+  if (r != 0)
+  8000bc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000c0:	74 36                	je     8000f8 <umain+0xc6>
+    panic("first opencons used fd %d", r);
+  8000c2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000c5:	89 c1                	mov    %eax,%ecx
+  8000c7:	48 b8 dc 56 80 00 00 	movabs $0x8056dc,%rax
+  8000ce:	00 00 00 
+  8000d1:	48 89 c2             	mov    %rax,%rdx
+  8000d4:	be 10 00 00 00       	mov    $0x10,%esi
+  8000d9:	48 b8 cd 56 80 00 00 	movabs $0x8056cd,%rax
+  8000e0:	00 00 00 
+  8000e3:	48 89 c7             	mov    %rax,%rdi
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	49 b8 e5 05 80 00 00 	movabs $0x8005e5,%r8
+  8000f2:	00 00 00 
+  8000f5:	41 ff d0             	call   *%r8
+  if ((r = dup(0, 1)) < 0)
+  8000f8:	be 01 00 00 00       	mov    $0x1,%esi
+  8000fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800102:	48 b8 09 33 80 00 00 	movabs $0x803309,%rax
+  800109:	00 00 00 
+  80010c:	ff d0                	call   *%rax
+  80010e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  800111:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800115:	79 36                	jns    80014d <umain+0x11b>
+    panic("dup: %i", r);
+  800117:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80011a:	89 c1                	mov    %eax,%ecx
+  80011c:	48 b8 f6 56 80 00 00 	movabs $0x8056f6,%rax
+  800123:	00 00 00 
+  800126:	48 89 c2             	mov    %rax,%rdx
+  800129:	be 12 00 00 00       	mov    $0x12,%esi
+  80012e:	48 b8 cd 56 80 00 00 	movabs $0x8056cd,%rax
+  800135:	00 00 00 
+  800138:	48 89 c7             	mov    %rax,%rdi
+  80013b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800140:	49 b8 e5 05 80 00 00 	movabs $0x8005e5,%r8
+  800147:	00 00 00 
+  80014a:	41 ff d0             	call   *%r8
+
+  for (;;) {
+    char *buf;
+
+    buf = readline("Type a line: ");
+  80014d:	48 b8 fe 56 80 00 00 	movabs $0x8056fe,%rax
+  800154:	00 00 00 
+  800157:	48 89 c7             	mov    %rax,%rdi
+  80015a:	48 b8 93 23 80 00 00 	movabs $0x802393,%rax
+  800161:	00 00 00 
+  800164:	ff d0                	call   *%rax
+  800166:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if (buf != NULL)
+  80016a:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80016f:	74 2c                	je     80019d <umain+0x16b>
+      fprintf(1, "%s\n", buf);
+  800171:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800175:	48 89 c2             	mov    %rax,%rdx
+  800178:	48 b8 0c 57 80 00 00 	movabs $0x80570c,%rax
+  80017f:	00 00 00 
+  800182:	48 89 c6             	mov    %rax,%rsi
+  800185:	bf 01 00 00 00       	mov    $0x1,%edi
+  80018a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018f:	48 b9 c0 45 80 00 00 	movabs $0x8045c0,%rcx
+  800196:	00 00 00 
+  800199:	ff d1                	call   *%rcx
+  80019b:	eb b0                	jmp    80014d <umain+0x11b>
+    else
+      fprintf(1, "(end of file received)\n");
+  80019d:	48 b8 10 57 80 00 00 	movabs $0x805710,%rax
+  8001a4:	00 00 00 
+  8001a7:	48 89 c6             	mov    %rax,%rsi
+  8001aa:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b4:	48 ba c0 45 80 00 00 	movabs $0x8045c0,%rdx
+  8001bb:	00 00 00 
+  8001be:	ff d2                	call   *%rdx
+  for (;;) {
+  8001c0:	eb 8b                	jmp    80014d <umain+0x11b>
+
+00000000008001c2 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8001c2:	55                   	push   %rbp
+  8001c3:	48 89 e5             	mov    %rsp,%rbp
+  8001c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8001ca:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8001cd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001d0:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8001d3:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8001d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8001dc:	48 89 c7             	mov    %rax,%rdi
+  8001df:	48 b8 eb 25 80 00 00 	movabs $0x8025eb,%rax
+  8001e6:	00 00 00 
+  8001e9:	ff d0                	call   *%rax
+}
+  8001eb:	90                   	nop
+  8001ec:	c9                   	leave
+  8001ed:	c3                   	ret
+
+00000000008001ee <getchar>:
+
+int
+getchar(void) {
+  8001ee:	55                   	push   %rbp
+  8001ef:	48 89 e5             	mov    %rsp,%rbp
+  8001f2:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8001f6:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8001fa:	ba 01 00 00 00       	mov    $0x1,%edx
+  8001ff:	48 89 c6             	mov    %rax,%rsi
+  800202:	bf 00 00 00 00       	mov    $0x0,%edi
+  800207:	48 b8 75 35 80 00 00 	movabs $0x803575,%rax
+  80020e:	00 00 00 
+  800211:	ff d0                	call   *%rax
+  800213:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  800216:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80021a:	79 05                	jns    800221 <getchar+0x33>
+    return r;
+  80021c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80021f:	eb 14                	jmp    800235 <getchar+0x47>
+  if (r < 1)
+  800221:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800225:	7f 07                	jg     80022e <getchar+0x40>
+    return -E_EOF;
+  800227:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80022c:	eb 07                	jmp    800235 <getchar+0x47>
+  return c;
+  80022e:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  800232:	0f b6 c0             	movzbl %al,%eax
+}
+  800235:	c9                   	leave
+  800236:	c3                   	ret
+
+0000000000800237 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  800237:	55                   	push   %rbp
+  800238:	48 89 e5             	mov    %rsp,%rbp
+  80023b:	48 83 ec 20          	sub    $0x20,%rsp
+  80023f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800242:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800246:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800249:	48 89 d6             	mov    %rdx,%rsi
+  80024c:	89 c7                	mov    %eax,%edi
+  80024e:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  800255:	00 00 00 
+  800258:	ff d0                	call   *%rax
+  80025a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80025d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800261:	79 05                	jns    800268 <iscons+0x31>
+    return r;
+  800263:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800266:	eb 1a                	jmp    800282 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  800268:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80026c:	8b 10                	mov    (%rax),%edx
+  80026e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800275:	00 00 00 
+  800278:	8b 00                	mov    (%rax),%eax
+  80027a:	39 c2                	cmp    %eax,%edx
+  80027c:	0f 94 c0             	sete   %al
+  80027f:	0f b6 c0             	movzbl %al,%eax
+}
+  800282:	c9                   	leave
+  800283:	c3                   	ret
+
+0000000000800284 <opencons>:
+
+int
+opencons(void) {
+  800284:	55                   	push   %rbp
+  800285:	48 89 e5             	mov    %rsp,%rbp
+  800288:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80028c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800290:	48 89 c7             	mov    %rax,%rdi
+  800293:	48 b8 37 2f 80 00 00 	movabs $0x802f37,%rax
+  80029a:	00 00 00 
+  80029d:	ff d0                	call   *%rax
+  80029f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8002a2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8002a6:	79 05                	jns    8002ad <opencons+0x29>
+    return r;
+  8002a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002ab:	eb 66                	jmp    800313 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8002ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002b1:	ba 07 04 00 00       	mov    $0x407,%edx
+  8002b6:	48 89 c6             	mov    %rax,%rsi
+  8002b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002be:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8002c5:	00 00 00 
+  8002c8:	ff d0                	call   *%rax
+  8002ca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8002cd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8002d1:	79 05                	jns    8002d8 <opencons+0x54>
+    return r;
+  8002d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002d6:	eb 3b                	jmp    800313 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8002d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002dc:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8002e3:	00 00 00 
+  8002e6:	8b 12                	mov    (%rdx),%edx
+  8002e8:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8002ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002ee:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8002f5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002f9:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  800300:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800304:	48 89 c7             	mov    %rax,%rdi
+  800307:	48 b8 e9 2e 80 00 00 	movabs $0x802ee9,%rax
+  80030e:	00 00 00 
+  800311:	ff d0                	call   *%rax
+}
+  800313:	c9                   	leave
+  800314:	c3                   	ret
+
+0000000000800315 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  800315:	55                   	push   %rbp
+  800316:	48 89 e5             	mov    %rsp,%rbp
+  800319:	48 83 ec 20          	sub    $0x20,%rsp
+  80031d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800320:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800323:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800327:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80032a:	48 89 d6             	mov    %rdx,%rsi
+  80032d:	89 c7                	mov    %eax,%edi
+  80032f:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  800336:	00 00 00 
+  800339:	ff d0                	call   *%rax
+  80033b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80033e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800342:	79 05                	jns    800349 <consmode+0x34>
+    return r;
+  800344:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800347:	eb 34                	jmp    80037d <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  800349:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80034d:	8b 10                	mov    (%rax),%edx
+  80034f:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800356:	00 00 00 
+  800359:	8b 00                	mov    (%rax),%eax
+  80035b:	39 c2                	cmp    %eax,%edx
+  80035d:	74 07                	je     800366 <consmode+0x51>
+    return -E_INVAL;
+  80035f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800364:	eb 17                	jmp    80037d <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  800366:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80036a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80036d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  800370:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800374:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800377:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  80037a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80037d:	c9                   	leave
+  80037e:	c3                   	ret
+
+000000000080037f <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80037f:	55                   	push   %rbp
+  800380:	48 89 e5             	mov    %rsp,%rbp
+  800383:	48 83 ec 20          	sub    $0x20,%rsp
+  800387:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80038b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80038f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  800393:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800397:	8b 50 0c             	mov    0xc(%rax),%edx
+  80039a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80039e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003a2:	48 89 ce             	mov    %rcx,%rsi
+  8003a5:	48 89 c7             	mov    %rax,%rdi
+  8003a8:	48 b8 5c 2b 80 00 00 	movabs $0x802b5c,%rax
+  8003af:	00 00 00 
+  8003b2:	ff d0                	call   *%rax
+  8003b4:	48 98                	cltq
+}
+  8003b6:	c9                   	leave
+  8003b7:	c3                   	ret
+
+00000000008003b8 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8003b8:	55                   	push   %rbp
+  8003b9:	48 89 e5             	mov    %rsp,%rbp
+  8003bc:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8003c3:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8003ca:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8003d1:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8003d8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8003df:	eb 74                	jmp    800455 <devcons_write+0x9d>
+    m = n - tot;
+  8003e1:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8003e8:	89 c2                	mov    %eax,%edx
+  8003ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8003ed:	29 c2                	sub    %eax,%edx
+  8003ef:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8003f2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8003f5:	83 f8 7f             	cmp    $0x7f,%eax
+  8003f8:	76 07                	jbe    800401 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8003fa:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  800401:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800404:	48 63 d0             	movslq %eax,%rdx
+  800407:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80040a:	48 63 c8             	movslq %eax,%rcx
+  80040d:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  800414:	48 01 c1             	add    %rax,%rcx
+  800417:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80041e:	48 89 ce             	mov    %rcx,%rsi
+  800421:	48 89 c7             	mov    %rax,%rdi
+  800424:	48 b8 f7 1c 80 00 00 	movabs $0x801cf7,%rax
+  80042b:	00 00 00 
+  80042e:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  800430:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800433:	48 63 d0             	movslq %eax,%rdx
+  800436:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80043d:	48 89 d6             	mov    %rdx,%rsi
+  800440:	48 89 c7             	mov    %rax,%rdi
+  800443:	48 b8 eb 25 80 00 00 	movabs $0x8025eb,%rax
+  80044a:	00 00 00 
+  80044d:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  80044f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800452:	01 45 fc             	add    %eax,-0x4(%rbp)
+  800455:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800458:	48 98                	cltq
+  80045a:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  800461:	0f 82 7a ff ff ff    	jb     8003e1 <devcons_write+0x29>
+  }
+  return tot;
+  800467:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80046a:	48 98                	cltq
+}
+  80046c:	c9                   	leave
+  80046d:	c3                   	ret
+
+000000000080046e <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  80046e:	55                   	push   %rbp
+  80046f:	48 89 e5             	mov    %rsp,%rbp
+  800472:	48 83 ec 08          	sub    $0x8,%rsp
+  800476:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  80047a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80047f:	c9                   	leave
+  800480:	c3                   	ret
+
+0000000000800481 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  800481:	55                   	push   %rbp
+  800482:	48 89 e5             	mov    %rsp,%rbp
+  800485:	48 83 ec 10          	sub    $0x10,%rsp
+  800489:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80048d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  800491:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800495:	48 ba 2d 57 80 00 00 	movabs $0x80572d,%rdx
+  80049c:	00 00 00 
+  80049f:	48 89 d6             	mov    %rdx,%rsi
+  8004a2:	48 89 c7             	mov    %rax,%rdi
+  8004a5:	48 b8 b4 17 80 00 00 	movabs $0x8017b4,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+  return 0;
+  8004b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004b6:	c9                   	leave
+  8004b7:	c3                   	ret
+
+00000000008004b8 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8004b8:	55                   	push   %rbp
+  8004b9:	48 89 e5             	mov    %rsp,%rbp
+  8004bc:	48 83 ec 30          	sub    $0x30,%rsp
+  8004c0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8004c4:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8004c7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8004cb:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8004d2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8004d5:	83 e0 02             	and    $0x2,%eax
+  8004d8:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8004db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004df:	8b 40 0c             	mov    0xc(%rax),%eax
+  8004e2:	83 f8 01             	cmp    $0x1,%eax
+  8004e5:	75 04                	jne    8004eb <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8004e7:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8004eb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8004ee:	83 e0 01             	and    $0x1,%eax
+  8004f1:	85 c0                	test   %eax,%eax
+  8004f3:	74 44                	je     800539 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8004f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004fd:	89 c2                	mov    %eax,%edx
+  8004ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800504:	bf 00 00 00 00       	mov    $0x0,%edi
+  800509:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  800510:	00 00 00 
+  800513:	ff d0                	call   *%rax
+  800515:	83 f8 01             	cmp    $0x1,%eax
+  800518:	75 06                	jne    800520 <devcons_poll+0x68>
+      revents |= POLLIN;
+  80051a:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  80051e:	eb 19                	jmp    800539 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  800520:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800524:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  80052a:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80052d:	89 c2                	mov    %eax,%edx
+  80052f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800533:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  800539:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80053c:	c9                   	leave
+  80053d:	c3                   	ret
+
+000000000080053e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80053e:	55                   	push   %rbp
+  80053f:	48 89 e5             	mov    %rsp,%rbp
+  800542:	48 83 ec 20          	sub    $0x20,%rsp
+  800546:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800549:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80054d:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800554:	00 00 00 
+  800557:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80055b:	eb 13                	jmp    800570 <libmain+0x32>
+    (*ctor)();
+  80055d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800561:	48 8b 10             	mov    (%rax),%rdx
+  800564:	b8 00 00 00 00       	mov    $0x0,%eax
+  800569:	ff d2                	call   *%rdx
+    ctor++;
+  80056b:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800570:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  800577:	00 00 00 
+  80057a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80057e:	72 dd                	jb     80055d <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800580:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800584:	7e 14                	jle    80059a <libmain+0x5c>
+    binaryname = argv[0];
+  800586:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80058a:	48 8b 00             	mov    (%rax),%rax
+  80058d:	48 ba 40 60 80 00 00 	movabs $0x806040,%rdx
+  800594:	00 00 00 
+  800597:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80059a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80059e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005a1:	48 89 d6             	mov    %rdx,%rsi
+  8005a4:	89 c7                	mov    %eax,%edi
+  8005a6:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8005b2:	48 b8 c1 05 80 00 00 	movabs $0x8005c1,%rax
+  8005b9:	00 00 00 
+  8005bc:	ff d0                	call   *%rax
+#endif
+}
+  8005be:	90                   	nop
+  8005bf:	c9                   	leave
+  8005c0:	c3                   	ret
+
+00000000008005c1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8005c1:	55                   	push   %rbp
+  8005c2:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8005c5:	48 b8 d9 32 80 00 00 	movabs $0x8032d9,%rax
+  8005cc:	00 00 00 
+  8005cf:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8005d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005d6:	48 b8 ba 26 80 00 00 	movabs $0x8026ba,%rax
+  8005dd:	00 00 00 
+  8005e0:	ff d0                	call   *%rax
+}
+  8005e2:	90                   	nop
+  8005e3:	5d                   	pop    %rbp
+  8005e4:	c3                   	ret
+
+00000000008005e5 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8005e5:	55                   	push   %rbp
+  8005e6:	48 89 e5             	mov    %rsp,%rbp
+  8005e9:	53                   	push   %rbx
+  8005ea:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8005f1:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8005f8:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8005fe:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800605:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80060c:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800613:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80061a:	84 c0                	test   %al,%al
+  80061c:	74 23                	je     800641 <_panic+0x5c>
+  80061e:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800625:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800629:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80062d:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800631:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800635:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800639:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80063d:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800641:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800648:	00 00 00 
+  80064b:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800652:	00 00 00 
+  800655:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800659:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800660:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800667:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80066e:	48 b8 40 60 80 00 00 	movabs $0x806040,%rax
+  800675:	00 00 00 
+  800678:	48 8b 18             	mov    (%rax),%rbx
+  80067b:	48 b8 89 27 80 00 00 	movabs $0x802789,%rax
+  800682:	00 00 00 
+  800685:	ff d0                	call   *%rax
+  800687:	89 c6                	mov    %eax,%esi
+  800689:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80068f:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800696:	41 89 d0             	mov    %edx,%r8d
+  800699:	48 89 c1             	mov    %rax,%rcx
+  80069c:	48 89 da             	mov    %rbx,%rdx
+  80069f:	48 b8 40 57 80 00 00 	movabs $0x805740,%rax
+  8006a6:	00 00 00 
+  8006a9:	48 89 c7             	mov    %rax,%rdi
+  8006ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006b1:	49 b9 04 08 80 00 00 	movabs $0x800804,%r9
+  8006b8:	00 00 00 
+  8006bb:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8006be:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8006c5:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8006cc:	48 89 d6             	mov    %rdx,%rsi
+  8006cf:	48 89 c7             	mov    %rax,%rdi
+  8006d2:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  8006d9:	00 00 00 
+  8006dc:	ff d0                	call   *%rax
+  cprintf("\n");
+  8006de:	48 b8 63 57 80 00 00 	movabs $0x805763,%rax
+  8006e5:	00 00 00 
+  8006e8:	48 89 c7             	mov    %rax,%rdi
+  8006eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f0:	48 ba 04 08 80 00 00 	movabs $0x800804,%rdx
+  8006f7:	00 00 00 
+  8006fa:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8006fc:	cc                   	int3
+  8006fd:	eb fd                	jmp    8006fc <_panic+0x117>
+
+00000000008006ff <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8006ff:	55                   	push   %rbp
+  800700:	48 89 e5             	mov    %rsp,%rbp
+  800703:	48 83 ec 10          	sub    $0x10,%rsp
+  800707:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80070a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80070e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800712:	8b 00                	mov    (%rax),%eax
+  800714:	8d 48 01             	lea    0x1(%rax),%ecx
+  800717:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80071b:	89 0a                	mov    %ecx,(%rdx)
+  80071d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800720:	89 d1                	mov    %edx,%ecx
+  800722:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800726:	48 98                	cltq
+  800728:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80072c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800730:	8b 00                	mov    (%rax),%eax
+  800732:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800737:	75 2c                	jne    800765 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800739:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80073d:	8b 00                	mov    (%rax),%eax
+  80073f:	48 98                	cltq
+  800741:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800745:	48 83 c2 08          	add    $0x8,%rdx
+  800749:	48 89 c6             	mov    %rax,%rsi
+  80074c:	48 89 d7             	mov    %rdx,%rdi
+  80074f:	48 b8 eb 25 80 00 00 	movabs $0x8025eb,%rax
+  800756:	00 00 00 
+  800759:	ff d0                	call   *%rax
+    b->idx = 0;
+  80075b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80075f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800769:	8b 40 04             	mov    0x4(%rax),%eax
+  80076c:	8d 50 01             	lea    0x1(%rax),%edx
+  80076f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800773:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800776:	90                   	nop
+  800777:	c9                   	leave
+  800778:	c3                   	ret
+
+0000000000800779 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800779:	55                   	push   %rbp
+  80077a:	48 89 e5             	mov    %rsp,%rbp
+  80077d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800784:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  80078b:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800792:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800799:	00 00 00 
+  b.cnt = 0;
+  80079c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8007a3:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8007a6:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8007ad:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8007b4:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8007bb:	48 89 c6             	mov    %rax,%rsi
+  8007be:	48 b8 ff 06 80 00 00 	movabs $0x8006ff,%rax
+  8007c5:	00 00 00 
+  8007c8:	48 89 c7             	mov    %rax,%rdi
+  8007cb:	48 b8 5e 0b 80 00 00 	movabs $0x800b5e,%rax
+  8007d2:	00 00 00 
+  8007d5:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8007d7:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8007dd:	48 98                	cltq
+  8007df:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8007e6:	48 83 c2 08          	add    $0x8,%rdx
+  8007ea:	48 89 c6             	mov    %rax,%rsi
+  8007ed:	48 89 d7             	mov    %rdx,%rdi
+  8007f0:	48 b8 eb 25 80 00 00 	movabs $0x8025eb,%rax
+  8007f7:	00 00 00 
+  8007fa:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8007fc:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800802:	c9                   	leave
+  800803:	c3                   	ret
+
+0000000000800804 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800804:	55                   	push   %rbp
+  800805:	48 89 e5             	mov    %rsp,%rbp
+  800808:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80080f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800816:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80081d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800824:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80082b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800832:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800839:	84 c0                	test   %al,%al
+  80083b:	74 20                	je     80085d <cprintf+0x59>
+  80083d:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800841:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800845:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800849:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80084d:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800851:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800855:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800859:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80085d:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800864:	00 00 00 
+  800867:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80086e:	00 00 00 
+  800871:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800875:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80087c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800883:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80088a:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800891:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800898:	48 89 d6             	mov    %rdx,%rsi
+  80089b:	48 89 c7             	mov    %rax,%rdi
+  80089e:	48 b8 79 07 80 00 00 	movabs $0x800779,%rax
+  8008a5:	00 00 00 
+  8008a8:	ff d0                	call   *%rax
+  8008aa:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8008b0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8008b6:	c9                   	leave
+  8008b7:	c3                   	ret
+
+00000000008008b8 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8008b8:	55                   	push   %rbp
+  8008b9:	48 89 e5             	mov    %rsp,%rbp
+  8008bc:	48 83 ec 30          	sub    $0x30,%rsp
+  8008c0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008c4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8008c8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8008cc:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8008cf:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8008d3:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8008d7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008da:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8008de:	72 54                	jb     800934 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8008e0:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8008e3:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8008e6:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8008e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008f2:	48 f7 f6             	div    %rsi
+  8008f5:	49 89 c2             	mov    %rax,%r10
+  8008f8:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8008fb:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8008fe:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800902:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800906:	41 89 c9             	mov    %ecx,%r9d
+  800909:	41 89 f8             	mov    %edi,%r8d
+  80090c:	89 d1                	mov    %edx,%ecx
+  80090e:	4c 89 d2             	mov    %r10,%rdx
+  800911:	48 89 c7             	mov    %rax,%rdi
+  800914:	48 b8 b8 08 80 00 00 	movabs $0x8008b8,%rax
+  80091b:	00 00 00 
+  80091e:	ff d0                	call   *%rax
+  800920:	eb 1c                	jmp    80093e <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800922:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800926:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800929:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80092d:	48 89 d6             	mov    %rdx,%rsi
+  800930:	89 c7                	mov    %eax,%edi
+  800932:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800934:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800938:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80093c:	7f e4                	jg     800922 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80093e:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800941:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80094a:	48 f7 f1             	div    %rcx
+  80094d:	48 b8 b0 59 80 00 00 	movabs $0x8059b0,%rax
+  800954:	00 00 00 
+  800957:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80095b:	0f be c0             	movsbl %al,%eax
+  80095e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800962:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800966:	48 89 d6             	mov    %rdx,%rsi
+  800969:	89 c7                	mov    %eax,%edi
+  80096b:	ff d1                	call   *%rcx
+}
+  80096d:	90                   	nop
+  80096e:	c9                   	leave
+  80096f:	c3                   	ret
+
+0000000000800970 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800970:	55                   	push   %rbp
+  800971:	48 89 e5             	mov    %rsp,%rbp
+  800974:	48 83 ec 10          	sub    $0x10,%rsp
+  800978:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80097c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80097f:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800983:	7e 4b                	jle    8009d0 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800985:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800989:	8b 00                	mov    (%rax),%eax
+  80098b:	83 f8 2f             	cmp    $0x2f,%eax
+  80098e:	77 24                	ja     8009b4 <getuint+0x44>
+  800990:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800994:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800998:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80099c:	8b 00                	mov    (%rax),%eax
+  80099e:	89 c0                	mov    %eax,%eax
+  8009a0:	48 01 d0             	add    %rdx,%rax
+  8009a3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009a7:	8b 12                	mov    (%rdx),%edx
+  8009a9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009ac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009b0:	89 0a                	mov    %ecx,(%rdx)
+  8009b2:	eb 14                	jmp    8009c8 <getuint+0x58>
+  8009b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009bc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009c4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009c8:	48 8b 00             	mov    (%rax),%rax
+  8009cb:	e9 95 00 00 00       	jmp    800a65 <getuint+0xf5>
+  else if (lflag)
+  8009d0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009d4:	74 48                	je     800a1e <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8009d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009da:	8b 00                	mov    (%rax),%eax
+  8009dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009df:	77 24                	ja     800a05 <getuint+0x95>
+  8009e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009e5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009ed:	8b 00                	mov    (%rax),%eax
+  8009ef:	89 c0                	mov    %eax,%eax
+  8009f1:	48 01 d0             	add    %rdx,%rax
+  8009f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009f8:	8b 12                	mov    (%rdx),%edx
+  8009fa:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009fd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a01:	89 0a                	mov    %ecx,(%rdx)
+  800a03:	eb 14                	jmp    800a19 <getuint+0xa9>
+  800a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a09:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a0d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a11:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a15:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a19:	48 8b 00             	mov    (%rax),%rax
+  800a1c:	eb 47                	jmp    800a65 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800a1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a22:	8b 00                	mov    (%rax),%eax
+  800a24:	83 f8 2f             	cmp    $0x2f,%eax
+  800a27:	77 24                	ja     800a4d <getuint+0xdd>
+  800a29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a2d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a35:	8b 00                	mov    (%rax),%eax
+  800a37:	89 c0                	mov    %eax,%eax
+  800a39:	48 01 d0             	add    %rdx,%rax
+  800a3c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a40:	8b 12                	mov    (%rdx),%edx
+  800a42:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a45:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a49:	89 0a                	mov    %ecx,(%rdx)
+  800a4b:	eb 14                	jmp    800a61 <getuint+0xf1>
+  800a4d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a55:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a59:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a5d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a61:	8b 00                	mov    (%rax),%eax
+  800a63:	89 c0                	mov    %eax,%eax
+}
+  800a65:	c9                   	leave
+  800a66:	c3                   	ret
+
+0000000000800a67 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800a67:	55                   	push   %rbp
+  800a68:	48 89 e5             	mov    %rsp,%rbp
+  800a6b:	48 83 ec 10          	sub    $0x10,%rsp
+  800a6f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800a73:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800a76:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800a7a:	7e 4b                	jle    800ac7 <getint+0x60>
+    return va_arg(*ap, long long);
+  800a7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a80:	8b 00                	mov    (%rax),%eax
+  800a82:	83 f8 2f             	cmp    $0x2f,%eax
+  800a85:	77 24                	ja     800aab <getint+0x44>
+  800a87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a8b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a93:	8b 00                	mov    (%rax),%eax
+  800a95:	89 c0                	mov    %eax,%eax
+  800a97:	48 01 d0             	add    %rdx,%rax
+  800a9a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a9e:	8b 12                	mov    (%rdx),%edx
+  800aa0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aa3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800aa7:	89 0a                	mov    %ecx,(%rdx)
+  800aa9:	eb 14                	jmp    800abf <getint+0x58>
+  800aab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aaf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ab3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ab7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800abb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800abf:	48 8b 00             	mov    (%rax),%rax
+  800ac2:	e9 95 00 00 00       	jmp    800b5c <getint+0xf5>
+  else if (lflag)
+  800ac7:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800acb:	74 48                	je     800b15 <getint+0xae>
+    return va_arg(*ap, long);
+  800acd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ad1:	8b 00                	mov    (%rax),%eax
+  800ad3:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad6:	77 24                	ja     800afc <getint+0x95>
+  800ad8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800adc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800ae0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ae4:	8b 00                	mov    (%rax),%eax
+  800ae6:	89 c0                	mov    %eax,%eax
+  800ae8:	48 01 d0             	add    %rdx,%rax
+  800aeb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800aef:	8b 12                	mov    (%rdx),%edx
+  800af1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800af4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800af8:	89 0a                	mov    %ecx,(%rdx)
+  800afa:	eb 14                	jmp    800b10 <getint+0xa9>
+  800afc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b00:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b04:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b08:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b0c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b10:	48 8b 00             	mov    (%rax),%rax
+  800b13:	eb 47                	jmp    800b5c <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800b15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b19:	8b 00                	mov    (%rax),%eax
+  800b1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b1e:	77 24                	ja     800b44 <getint+0xdd>
+  800b20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b24:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b2c:	8b 00                	mov    (%rax),%eax
+  800b2e:	89 c0                	mov    %eax,%eax
+  800b30:	48 01 d0             	add    %rdx,%rax
+  800b33:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b37:	8b 12                	mov    (%rdx),%edx
+  800b39:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b3c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b40:	89 0a                	mov    %ecx,(%rdx)
+  800b42:	eb 14                	jmp    800b58 <getint+0xf1>
+  800b44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b48:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b4c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b50:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b54:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b58:	8b 00                	mov    (%rax),%eax
+  800b5a:	48 98                	cltq
+}
+  800b5c:	c9                   	leave
+  800b5d:	c3                   	ret
+
+0000000000800b5e <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800b5e:	55                   	push   %rbp
+  800b5f:	48 89 e5             	mov    %rsp,%rbp
+  800b62:	41 54                	push   %r12
+  800b64:	53                   	push   %rbx
+  800b65:	48 83 ec 60          	sub    $0x60,%rsp
+  800b69:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800b6d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800b71:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800b75:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800b79:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b7d:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800b81:	48 8b 06             	mov    (%rsi),%rax
+  800b84:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800b88:	48 89 01             	mov    %rax,(%rcx)
+  800b8b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800b8f:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800b93:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800b97:	eb 17                	jmp    800bb0 <vprintfmt+0x52>
+      if (ch == '\0')
+  800b99:	85 db                	test   %ebx,%ebx
+  800b9b:	0f 84 bf 04 00 00    	je     801060 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800ba1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ba5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ba9:	48 89 c6             	mov    %rax,%rsi
+  800bac:	89 df                	mov    %ebx,%edi
+  800bae:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800bb0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bb4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bb8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800bbc:	0f b6 00             	movzbl (%rax),%eax
+  800bbf:	0f b6 d8             	movzbl %al,%ebx
+  800bc2:	83 fb 25             	cmp    $0x25,%ebx
+  800bc5:	75 d2                	jne    800b99 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800bc7:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800bcb:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800bd2:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800bd9:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800be0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800be7:	eb 04                	jmp    800bed <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800be9:	90                   	nop
+  800bea:	eb 01                	jmp    800bed <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800bec:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800bed:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800bf1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800bf5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800bf9:	0f b6 00             	movzbl (%rax),%eax
+  800bfc:	0f b6 d8             	movzbl %al,%ebx
+  800bff:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c02:	83 f8 55             	cmp    $0x55,%eax
+  800c05:	0f 87 22 04 00 00    	ja     80102d <vprintfmt+0x4cf>
+  800c0b:	89 c0                	mov    %eax,%eax
+  800c0d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c14:	00 
+  800c15:	48 b8 d8 59 80 00 00 	movabs $0x8059d8,%rax
+  800c1c:	00 00 00 
+  800c1f:	48 01 d0             	add    %rdx,%rax
+  800c22:	48 8b 00             	mov    (%rax),%rax
+  800c25:	ff e0                	jmp    *%rax
+        padc = '-';
+  800c27:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800c2b:	eb c0                	jmp    800bed <vprintfmt+0x8f>
+        padc = '0';
+  800c2d:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800c31:	eb ba                	jmp    800bed <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800c33:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800c3a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800c3d:	89 d0                	mov    %edx,%eax
+  800c3f:	c1 e0 02             	shl    $0x2,%eax
+  800c42:	01 d0                	add    %edx,%eax
+  800c44:	01 c0                	add    %eax,%eax
+  800c46:	01 d8                	add    %ebx,%eax
+  800c48:	83 e8 30             	sub    $0x30,%eax
+  800c4b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800c4e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c52:	0f b6 00             	movzbl (%rax),%eax
+  800c55:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800c58:	83 fb 2f             	cmp    $0x2f,%ebx
+  800c5b:	7e 60                	jle    800cbd <vprintfmt+0x15f>
+  800c5d:	83 fb 39             	cmp    $0x39,%ebx
+  800c60:	7f 5b                	jg     800cbd <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800c62:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800c67:	eb d1                	jmp    800c3a <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800c69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6f:	77 17                	ja     800c88 <vprintfmt+0x12a>
+  800c71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c75:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c78:	89 d2                	mov    %edx,%edx
+  800c7a:	48 01 d0             	add    %rdx,%rax
+  800c7d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c80:	83 c2 08             	add    $0x8,%edx
+  800c83:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c86:	eb 0c                	jmp    800c94 <vprintfmt+0x136>
+  800c88:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c8c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c90:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c94:	8b 00                	mov    (%rax),%eax
+  800c96:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800c99:	eb 23                	jmp    800cbe <vprintfmt+0x160>
+        if (width < 0)
+  800c9b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c9f:	0f 89 44 ff ff ff    	jns    800be9 <vprintfmt+0x8b>
+          width = 0;
+  800ca5:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800cac:	e9 38 ff ff ff       	jmp    800be9 <vprintfmt+0x8b>
+        altflag = 1;
+  800cb1:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800cb8:	e9 30 ff ff ff       	jmp    800bed <vprintfmt+0x8f>
+        goto process_precision;
+  800cbd:	90                   	nop
+        if (width < 0)
+  800cbe:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cc2:	0f 89 24 ff ff ff    	jns    800bec <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800cc8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ccb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800cce:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800cd5:	e9 12 ff ff ff       	jmp    800bec <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800cda:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800cde:	e9 0a ff ff ff       	jmp    800bed <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800ce3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce9:	77 17                	ja     800d02 <vprintfmt+0x1a4>
+  800ceb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cef:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cf2:	89 d2                	mov    %edx,%edx
+  800cf4:	48 01 d0             	add    %rdx,%rax
+  800cf7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cfa:	83 c2 08             	add    $0x8,%edx
+  800cfd:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d00:	eb 0c                	jmp    800d0e <vprintfmt+0x1b0>
+  800d02:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d06:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d0a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d0e:	8b 00                	mov    (%rax),%eax
+  800d10:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800d14:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d18:	48 89 d6             	mov    %rdx,%rsi
+  800d1b:	89 c7                	mov    %eax,%edi
+  800d1d:	ff d1                	call   *%rcx
+        break;
+  800d1f:	e9 37 03 00 00       	jmp    80105b <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800d24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d27:	83 f8 2f             	cmp    $0x2f,%eax
+  800d2a:	77 17                	ja     800d43 <vprintfmt+0x1e5>
+  800d2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d30:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d33:	89 d2                	mov    %edx,%edx
+  800d35:	48 01 d0             	add    %rdx,%rax
+  800d38:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d3b:	83 c2 08             	add    $0x8,%edx
+  800d3e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d41:	eb 0c                	jmp    800d4f <vprintfmt+0x1f1>
+  800d43:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d47:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d4b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d4f:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800d51:	85 db                	test   %ebx,%ebx
+  800d53:	79 02                	jns    800d57 <vprintfmt+0x1f9>
+          err = -err;
+  800d55:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d57:	83 fb 15             	cmp    $0x15,%ebx
+  800d5a:	7f 16                	jg     800d72 <vprintfmt+0x214>
+  800d5c:	48 ba 00 59 80 00 00 	movabs $0x805900,%rdx
+  800d63:	00 00 00 
+  800d66:	48 63 c3             	movslq %ebx,%rax
+  800d69:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800d6d:	4d 85 e4             	test   %r12,%r12
+  800d70:	75 2e                	jne    800da0 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800d72:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d76:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d7a:	89 d9                	mov    %ebx,%ecx
+  800d7c:	48 ba c1 59 80 00 00 	movabs $0x8059c1,%rdx
+  800d83:	00 00 00 
+  800d86:	48 89 c7             	mov    %rax,%rdi
+  800d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8e:	49 b8 6a 10 80 00 00 	movabs $0x80106a,%r8
+  800d95:	00 00 00 
+  800d98:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800d9b:	e9 bb 02 00 00       	jmp    80105b <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800da0:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800da4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800da8:	4c 89 e1             	mov    %r12,%rcx
+  800dab:	48 ba ca 59 80 00 00 	movabs $0x8059ca,%rdx
+  800db2:	00 00 00 
+  800db5:	48 89 c7             	mov    %rax,%rdi
+  800db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbd:	49 b8 6a 10 80 00 00 	movabs $0x80106a,%r8
+  800dc4:	00 00 00 
+  800dc7:	41 ff d0             	call   *%r8
+        break;
+  800dca:	e9 8c 02 00 00       	jmp    80105b <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800dcf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd2:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd5:	77 17                	ja     800dee <vprintfmt+0x290>
+  800dd7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ddb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800dde:	89 d2                	mov    %edx,%edx
+  800de0:	48 01 d0             	add    %rdx,%rax
+  800de3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800de6:	83 c2 08             	add    $0x8,%edx
+  800de9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800dec:	eb 0c                	jmp    800dfa <vprintfmt+0x29c>
+  800dee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800df2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800df6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800dfa:	4c 8b 20             	mov    (%rax),%r12
+  800dfd:	4d 85 e4             	test   %r12,%r12
+  800e00:	75 0a                	jne    800e0c <vprintfmt+0x2ae>
+          p = "(null)";
+  800e02:	49 bc cd 59 80 00 00 	movabs $0x8059cd,%r12
+  800e09:	00 00 00 
+        if (width > 0 && padc != '-')
+  800e0c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e10:	7e 78                	jle    800e8a <vprintfmt+0x32c>
+  800e12:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800e16:	74 72                	je     800e8a <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e18:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800e1b:	48 98                	cltq
+  800e1d:	48 89 c6             	mov    %rax,%rsi
+  800e20:	4c 89 e7             	mov    %r12,%rdi
+  800e23:	48 b8 76 17 80 00 00 	movabs $0x801776,%rax
+  800e2a:	00 00 00 
+  800e2d:	ff d0                	call   *%rax
+  800e2f:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800e32:	eb 17                	jmp    800e4b <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800e34:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800e38:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800e3c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800e40:	48 89 d6             	mov    %rdx,%rsi
+  800e43:	89 c7                	mov    %eax,%edi
+  800e45:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e47:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800e4b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e4f:	7f e3                	jg     800e34 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e51:	eb 37                	jmp    800e8a <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800e53:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800e57:	74 1e                	je     800e77 <vprintfmt+0x319>
+  800e59:	83 fb 1f             	cmp    $0x1f,%ebx
+  800e5c:	7e 05                	jle    800e63 <vprintfmt+0x305>
+  800e5e:	83 fb 7e             	cmp    $0x7e,%ebx
+  800e61:	7e 14                	jle    800e77 <vprintfmt+0x319>
+            putch('?', putdat);
+  800e63:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e67:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e6b:	48 89 c6             	mov    %rax,%rsi
+  800e6e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800e73:	ff d2                	call   *%rdx
+  800e75:	eb 0f                	jmp    800e86 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800e77:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e7b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e7f:	48 89 c6             	mov    %rax,%rsi
+  800e82:	89 df                	mov    %ebx,%edi
+  800e84:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e86:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800e8a:	4c 89 e0             	mov    %r12,%rax
+  800e8d:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800e91:	0f b6 00             	movzbl (%rax),%eax
+  800e94:	0f be d8             	movsbl %al,%ebx
+  800e97:	85 db                	test   %ebx,%ebx
+  800e99:	74 28                	je     800ec3 <vprintfmt+0x365>
+  800e9b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800e9f:	78 b2                	js     800e53 <vprintfmt+0x2f5>
+  800ea1:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800ea5:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ea9:	79 a8                	jns    800e53 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800eab:	eb 16                	jmp    800ec3 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800ead:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800eb1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800eb5:	48 89 c6             	mov    %rax,%rsi
+  800eb8:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ebd:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800ebf:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ec3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ec7:	7f e4                	jg     800ead <vprintfmt+0x34f>
+        break;
+  800ec9:	e9 8d 01 00 00       	jmp    80105b <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800ece:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ed1:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ed5:	89 d6                	mov    %edx,%esi
+  800ed7:	48 89 c7             	mov    %rax,%rdi
+  800eda:	48 b8 67 0a 80 00 00 	movabs $0x800a67,%rax
+  800ee1:	00 00 00 
+  800ee4:	ff d0                	call   *%rax
+  800ee6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800eea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800eee:	48 85 c0             	test   %rax,%rax
+  800ef1:	79 1d                	jns    800f10 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800ef3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ef7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800efb:	48 89 c6             	mov    %rax,%rsi
+  800efe:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f03:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800f05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f09:	48 f7 d8             	neg    %rax
+  800f0c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800f10:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f17:	e9 d2 00 00 00       	jmp    800fee <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800f1c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f1f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f23:	89 d6                	mov    %edx,%esi
+  800f25:	48 89 c7             	mov    %rax,%rdi
+  800f28:	48 b8 70 09 80 00 00 	movabs $0x800970,%rax
+  800f2f:	00 00 00 
+  800f32:	ff d0                	call   *%rax
+  800f34:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800f38:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f3f:	e9 aa 00 00 00       	jmp    800fee <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800f44:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f47:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f4b:	89 d6                	mov    %edx,%esi
+  800f4d:	48 89 c7             	mov    %rax,%rdi
+  800f50:	48 b8 70 09 80 00 00 	movabs $0x800970,%rax
+  800f57:	00 00 00 
+  800f5a:	ff d0                	call   *%rax
+  800f5c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800f60:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800f67:	e9 82 00 00 00       	jmp    800fee <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800f6c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f70:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f74:	48 89 c6             	mov    %rax,%rsi
+  800f77:	bf 30 00 00 00       	mov    $0x30,%edi
+  800f7c:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800f7e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f82:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f86:	48 89 c6             	mov    %rax,%rsi
+  800f89:	bf 78 00 00 00       	mov    $0x78,%edi
+  800f8e:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800f90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f93:	83 f8 2f             	cmp    $0x2f,%eax
+  800f96:	77 17                	ja     800faf <vprintfmt+0x451>
+  800f98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800f9c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800f9f:	89 d2                	mov    %edx,%edx
+  800fa1:	48 01 d0             	add    %rdx,%rax
+  800fa4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800fa7:	83 c2 08             	add    $0x8,%edx
+  800faa:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800fad:	eb 0c                	jmp    800fbb <vprintfmt+0x45d>
+  800faf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800fb3:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800fb7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800fbb:	48 8b 00             	mov    (%rax),%rax
+  800fbe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800fc2:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800fc9:	eb 23                	jmp    800fee <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800fcb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800fce:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800fd2:	89 d6                	mov    %edx,%esi
+  800fd4:	48 89 c7             	mov    %rax,%rdi
+  800fd7:	48 b8 70 09 80 00 00 	movabs $0x800970,%rax
+  800fde:	00 00 00 
+  800fe1:	ff d0                	call   *%rax
+  800fe3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800fe7:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800fee:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800ff3:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800ff6:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800ff9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ffd:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801001:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801005:	45 89 c1             	mov    %r8d,%r9d
+  801008:	41 89 f8             	mov    %edi,%r8d
+  80100b:	48 89 c7             	mov    %rax,%rdi
+  80100e:	48 b8 b8 08 80 00 00 	movabs $0x8008b8,%rax
+  801015:	00 00 00 
+  801018:	ff d0                	call   *%rax
+        break;
+  80101a:	eb 3f                	jmp    80105b <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  80101c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801020:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801024:	48 89 c6             	mov    %rax,%rsi
+  801027:	89 df                	mov    %ebx,%edi
+  801029:	ff d2                	call   *%rdx
+        break;
+  80102b:	eb 2e                	jmp    80105b <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  80102d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801031:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801035:	48 89 c6             	mov    %rax,%rsi
+  801038:	bf 25 00 00 00       	mov    $0x25,%edi
+  80103d:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  80103f:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801044:	eb 05                	jmp    80104b <vprintfmt+0x4ed>
+  801046:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80104b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80104f:	48 83 e8 01          	sub    $0x1,%rax
+  801053:	0f b6 00             	movzbl (%rax),%eax
+  801056:	3c 25                	cmp    $0x25,%al
+  801058:	75 ec                	jne    801046 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  80105a:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80105b:	e9 50 fb ff ff       	jmp    800bb0 <vprintfmt+0x52>
+        return;
+  801060:	90                   	nop
+    }
+  }
+}
+  801061:	48 83 c4 60          	add    $0x60,%rsp
+  801065:	5b                   	pop    %rbx
+  801066:	41 5c                	pop    %r12
+  801068:	5d                   	pop    %rbp
+  801069:	c3                   	ret
+
+000000000080106a <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80106a:	55                   	push   %rbp
+  80106b:	48 89 e5             	mov    %rsp,%rbp
+  80106e:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801075:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80107c:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801083:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80108a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801091:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801098:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80109f:	84 c0                	test   %al,%al
+  8010a1:	74 20                	je     8010c3 <printfmt+0x59>
+  8010a3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010a7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010ab:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010af:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010b3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010b7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010bb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010bf:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8010c3:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8010ca:	00 00 00 
+  8010cd:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8010d4:	00 00 00 
+  8010d7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010db:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8010e2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010e9:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  8010f0:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8010f7:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8010fe:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801105:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80110c:	48 89 c7             	mov    %rax,%rdi
+  80110f:	48 b8 5e 0b 80 00 00 	movabs $0x800b5e,%rax
+  801116:	00 00 00 
+  801119:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  80111b:	90                   	nop
+  80111c:	c9                   	leave
+  80111d:	c3                   	ret
+
+000000000080111e <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  80111e:	55                   	push   %rbp
+  80111f:	48 89 e5             	mov    %rsp,%rbp
+  801122:	48 83 ec 10          	sub    $0x10,%rsp
+  801126:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801129:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  80112d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801131:	8b 40 10             	mov    0x10(%rax),%eax
+  801134:	8d 50 01             	lea    0x1(%rax),%edx
+  801137:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80113b:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  80113e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801142:	48 8b 10             	mov    (%rax),%rdx
+  801145:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801149:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80114d:	48 39 c2             	cmp    %rax,%rdx
+  801150:	73 17                	jae    801169 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801152:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801156:	48 8b 00             	mov    (%rax),%rax
+  801159:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80115d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801161:	48 89 0a             	mov    %rcx,(%rdx)
+  801164:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801167:	88 10                	mov    %dl,(%rax)
+}
+  801169:	90                   	nop
+  80116a:	c9                   	leave
+  80116b:	c3                   	ret
+
+000000000080116c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  80116c:	55                   	push   %rbp
+  80116d:	48 89 e5             	mov    %rsp,%rbp
+  801170:	48 83 ec 40          	sub    $0x40,%rsp
+  801174:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801178:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80117b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80117f:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801183:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801187:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80118b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80118e:	48 98                	cltq
+  801190:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801194:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801198:	48 01 d0             	add    %rdx,%rax
+  80119b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  80119f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  8011a6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8011ab:	74 06                	je     8011b3 <vsnprintf+0x47>
+  8011ad:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8011b1:	7f 07                	jg     8011ba <vsnprintf+0x4e>
+    return -E_INVAL;
+  8011b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b8:	eb 32                	jmp    8011ec <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8011ba:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8011be:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8011c2:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8011c6:	48 89 c6             	mov    %rax,%rsi
+  8011c9:	48 b8 1e 11 80 00 00 	movabs $0x80111e,%rax
+  8011d0:	00 00 00 
+  8011d3:	48 89 c7             	mov    %rax,%rdi
+  8011d6:	48 b8 5e 0b 80 00 00 	movabs $0x800b5e,%rax
+  8011dd:	00 00 00 
+  8011e0:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8011e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8011e6:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  8011e9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8011ec:	c9                   	leave
+  8011ed:	c3                   	ret
+
+00000000008011ee <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  8011ee:	55                   	push   %rbp
+  8011ef:	48 89 e5             	mov    %rsp,%rbp
+  8011f2:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8011f9:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801200:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801206:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80120d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801214:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80121b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801222:	84 c0                	test   %al,%al
+  801224:	74 20                	je     801246 <snprintf+0x58>
+  801226:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80122a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80122e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801232:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801236:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80123a:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80123e:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801242:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801246:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80124d:	00 00 00 
+  801250:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801257:	00 00 00 
+  80125a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80125e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801265:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80126c:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801273:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  80127a:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801281:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801287:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80128e:	48 89 c7             	mov    %rax,%rdi
+  801291:	48 b8 6c 11 80 00 00 	movabs $0x80116c,%rax
+  801298:	00 00 00 
+  80129b:	ff d0                	call   *%rax
+  80129d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8012a3:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8012a9:	c9                   	leave
+  8012aa:	c3                   	ret
+
+00000000008012ab <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8012ab:	55                   	push   %rbp
+  8012ac:	48 89 e5             	mov    %rsp,%rbp
+  8012af:	53                   	push   %rbx
+  8012b0:	48 83 ec 38          	sub    $0x38,%rsp
+  8012b4:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8012b7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8012bb:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8012bf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8012c3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8012c7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8012ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012cf:	89 d1                	mov    %edx,%ecx
+  8012d1:	0f a2                	cpuid
+  8012d3:	89 de                	mov    %ebx,%esi
+  8012d5:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8012d8:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8012db:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8012de:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8012e1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8012e6:	74 09                	je     8012f1 <cpuid+0x46>
+}
+  8012e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012ec:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8012ef:	89 10                	mov    %edx,(%rax)
+
+  8012f1:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8012f6:	74 09                	je     801301 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8012f8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8012fc:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8012ff:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801301:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801306:	74 09                	je     801311 <cpuid+0x66>
+char *
+  801308:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80130c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80130f:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801311:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801316:	74 09                	je     801321 <cpuid+0x76>
+  for (; *s; s++)
+  801318:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80131c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80131f:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801321:	90                   	nop
+  801322:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801326:	c9                   	leave
+  801327:	c3                   	ret
+
+0000000000801328 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801328:	55                   	push   %rbp
+  801329:	48 89 e5             	mov    %rsp,%rbp
+  80132c:	48 83 ec 18          	sub    $0x18,%rsp
+  801330:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801333:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801336:	89 c1                	mov    %eax,%ecx
+  801338:	0f 01 d0             	xgetbv
+  80133b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80133e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801341:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801344:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801347:	48 c1 e2 20          	shl    $0x20,%rdx
+  80134b:	48 09 d0             	or     %rdx,%rax
+#else
+  80134e:	c9                   	leave
+  80134f:	c3                   	ret
+
+0000000000801350 <string_cpu>:
+string_cpu(void) {
+  801350:	55                   	push   %rbp
+  801351:	48 89 e5             	mov    %rsp,%rbp
+  801354:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801358:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  80135f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801366:	48 b8 48 60 80 00 00 	movabs $0x806048,%rax
+  80136d:	00 00 00 
+  801370:	8b 00                	mov    (%rax),%eax
+  801372:	85 c0                	test   %eax,%eax
+  801374:	78 11                	js     801387 <string_cpu+0x37>
+    return string_features;
+  801376:	48 b8 48 60 80 00 00 	movabs $0x806048,%rax
+  80137d:	00 00 00 
+  801380:	8b 00                	mov    (%rax),%eax
+  801382:	e9 df 00 00 00       	jmp    801466 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801387:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  80138b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801391:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801396:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139b:	48 89 c6             	mov    %rax,%rsi
+  80139e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a3:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  8013aa:	00 00 00 
+  8013ad:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8013af:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8013b2:	83 f8 06             	cmp    $0x6,%eax
+  8013b5:	76 28                	jbe    8013df <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8013b7:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8013bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013c6:	48 89 c2             	mov    %rax,%rdx
+  8013c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8013ce:	bf 07 00 00 00       	mov    $0x7,%edi
+  8013d3:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  8013da:	00 00 00 
+  8013dd:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8013df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8013e2:	25 00 02 00 00       	and    $0x200,%eax
+  8013e7:	85 c0                	test   %eax,%eax
+  8013e9:	74 04                	je     8013ef <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8013eb:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8013ef:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8013f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013f9:	48 89 c1             	mov    %rax,%rcx
+  8013fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801401:	be 00 00 00 00       	mov    $0x0,%esi
+  801406:	bf 01 00 00 00       	mov    $0x1,%edi
+  80140b:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  801412:	00 00 00 
+  801415:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801417:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80141a:	83 e0 20             	and    $0x20,%eax
+  80141d:	85 c0                	test   %eax,%eax
+  80141f:	74 2a                	je     80144b <string_cpu+0xfb>
+  801421:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801424:	25 00 00 00 08       	and    $0x8000000,%eax
+  801429:	85 c0                	test   %eax,%eax
+  80142b:	74 1e                	je     80144b <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80142d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801432:	48 b8 28 13 80 00 00 	movabs $0x801328,%rax
+  801439:	00 00 00 
+  80143c:	ff d0                	call   *%rax
+  80143e:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801441:	48 83 f8 06          	cmp    $0x6,%rax
+  801445:	75 04                	jne    80144b <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801447:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  80144b:	48 ba 48 60 80 00 00 	movabs $0x806048,%rdx
+  801452:	00 00 00 
+  801455:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801458:	89 02                	mov    %eax,(%rdx)
+  80145a:	48 b8 48 60 80 00 00 	movabs $0x806048,%rax
+  801461:	00 00 00 
+  801464:	8b 00                	mov    (%rax),%eax
+}
+  801466:	c9                   	leave
+  801467:	c3                   	ret
+
+0000000000801468 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801468:	55                   	push   %rbp
+  801469:	48 89 e5             	mov    %rsp,%rbp
+  80146c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801470:	48 83 ec 60          	sub    $0x60,%rsp
+  801474:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801479:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80147e:	83 e0 1f             	and    $0x1f,%eax
+  801481:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801485:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801489:	48 f7 d8             	neg    %rax
+  80148c:	48 89 c2             	mov    %rax,%rdx
+  80148f:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801494:	48 01 d0             	add    %rdx,%rax
+  801497:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  80149c:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8014a0:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8014a6:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8014ab:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8014af:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8014b5:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8014b9:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014bd:	89 c2                	mov    %eax,%edx
+  8014bf:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8014c3:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8014c8:	89 c1                	mov    %eax,%ecx
+  8014ca:	d3 e6                	shl    %cl,%esi
+  8014cc:	89 f0                	mov    %esi,%eax
+  8014ce:	21 d0                	and    %edx,%eax
+  8014d0:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8014d4:	eb 21                	jmp    8014f7 <strlen_avx2+0x8f>
+    p += 32;
+  8014d6:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8014dc:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8014e1:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8014e5:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8014eb:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8014ef:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014f3:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8014f7:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8014fc:	74 d8                	je     8014d6 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8014fe:	31 c0                	xor    %eax,%eax
+  801500:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801506:	48 63 d0             	movslq %eax,%rdx
+  801509:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80150e:	48 01 d0             	add    %rdx,%rax
+  801511:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801516:	c9                   	leave
+  801517:	c3                   	ret
+
+0000000000801518 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801518:	55                   	push   %rbp
+  801519:	48 89 e5             	mov    %rsp,%rbp
+  80151c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801520:	48 83 ec 40          	sub    $0x40,%rsp
+  801524:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801529:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80152e:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801533:	eb 77                	jmp    8015ac <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801535:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80153a:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80153e:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801542:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801547:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80154b:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80154f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801553:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801557:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  80155c:	74 3c                	je     80159a <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80155e:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801562:	f7 d0                	not    %eax
+  801564:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801568:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  80156c:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801570:	48 63 d0             	movslq %eax,%rdx
+  801573:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801578:	48 01 d0             	add    %rdx,%rax
+  80157b:	0f b6 00             	movzbl (%rax),%eax
+  80157e:	0f b6 c0             	movzbl %al,%eax
+  801581:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801585:	48 63 ca             	movslq %edx,%rcx
+  801588:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80158d:	48 01 ca             	add    %rcx,%rdx
+  801590:	0f b6 12             	movzbl (%rdx),%edx
+  801593:	0f b6 d2             	movzbl %dl,%edx
+  801596:	29 d0                	sub    %edx,%eax
+  801598:	eb 6b                	jmp    801605 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80159a:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8015a0:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8015a6:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8015ac:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8015b2:	77 81                	ja     801535 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8015b4:	eb 42                	jmp    8015f8 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8015b6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015bb:	0f b6 10             	movzbl (%rax),%edx
+  8015be:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015c3:	0f b6 00             	movzbl (%rax),%eax
+  8015c6:	38 c2                	cmp    %al,%dl
+  8015c8:	74 1c                	je     8015e6 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8015ca:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015cf:	0f b6 00             	movzbl (%rax),%eax
+  8015d2:	0f b6 c8             	movzbl %al,%ecx
+  8015d5:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015da:	0f b6 00             	movzbl (%rax),%eax
+  8015dd:	0f b6 d0             	movzbl %al,%edx
+  8015e0:	89 c8                	mov    %ecx,%eax
+  8015e2:	29 d0                	sub    %edx,%eax
+  8015e4:	eb 1f                	jmp    801605 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8015e6:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8015ec:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8015f2:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8015f8:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8015fe:	75 b6                	jne    8015b6 <memcmp_avx2+0x9e>
+  return 0;
+  801600:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801605:	c9                   	leave
+  801606:	c3                   	ret
+
+0000000000801607 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801607:	55                   	push   %rbp
+  801608:	48 89 e5             	mov    %rsp,%rbp
+  80160b:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80160f:	48 83 ec 60          	sub    $0x60,%rsp
+  801613:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801618:	89 f0                	mov    %esi,%eax
+  80161a:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80161f:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801623:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801628:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80162c:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801631:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801637:	eb 47                	jmp    801680 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801639:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80163e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801642:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801646:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80164c:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801650:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801654:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801658:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80165d:	74 15                	je     801674 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80165f:	31 c0                	xor    %eax,%eax
+  801661:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801667:	48 63 d0             	movslq %eax,%rdx
+  80166a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80166f:	48 01 d0             	add    %rdx,%rax
+  801672:	eb 3d                	jmp    8016b1 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801674:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80167a:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801680:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801686:	77 b1                	ja     801639 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801688:	eb 0c                	jmp    801696 <memfind_avx2+0x8f>
+  80168a:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801690:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801696:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80169c:	74 0e                	je     8016ac <memfind_avx2+0xa5>
+  80169e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8016a3:	0f b6 00             	movzbl (%rax),%eax
+  8016a6:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8016aa:	75 de                	jne    80168a <memfind_avx2+0x83>
+  return s;
+  8016ac:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8016b1:	c9                   	leave
+  8016b2:	c3                   	ret
+
+00000000008016b3 <strlen>:
+strlen(const char *s) {
+  8016b3:	55                   	push   %rbp
+  8016b4:	48 89 e5             	mov    %rsp,%rbp
+  8016b7:	48 83 ec 40          	sub    $0x40,%rsp
+  8016bb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8016bf:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8016c3:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8016c7:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  8016ce:	00 00 00 
+  8016d1:	ff d0                	call   *%rax
+  8016d3:	83 e0 02             	and    $0x2,%eax
+  8016d6:	85 c0                	test   %eax,%eax
+  8016d8:	74 18                	je     8016f2 <strlen+0x3f>
+    return strlen_avx2(s);
+  8016da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016de:	48 89 c7             	mov    %rax,%rdi
+  8016e1:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  8016e8:	00 00 00 
+  8016eb:	ff d0                	call   *%rax
+  8016ed:	e9 82 00 00 00       	jmp    801774 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8016f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016f6:	83 e0 0f             	and    $0xf,%eax
+  8016f9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8016fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8016ff:	48 f7 d8             	neg    %rax
+  801702:	48 89 c2             	mov    %rax,%rdx
+  801705:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801709:	48 01 d0             	add    %rdx,%rax
+  80170c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801710:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801714:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801718:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80171d:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801721:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801725:	89 c2                	mov    %eax,%edx
+  801727:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80172a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80172f:	89 c1                	mov    %eax,%ecx
+  801731:	d3 e6                	shl    %cl,%esi
+  801733:	89 f0                	mov    %esi,%eax
+  801735:	21 d0                	and    %edx,%eax
+  801737:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80173a:	eb 1d                	jmp    801759 <strlen+0xa6>
+    p += 16;
+  80173c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801741:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801745:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801749:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80174e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801752:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801756:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801759:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80175d:	74 dd                	je     80173c <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80175f:	31 c0                	xor    %eax,%eax
+  801761:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801766:	48 63 d0             	movslq %eax,%rdx
+  801769:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80176d:	48 01 d0             	add    %rdx,%rax
+  801770:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801774:	c9                   	leave
+  801775:	c3                   	ret
+
+0000000000801776 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801776:	55                   	push   %rbp
+  801777:	48 89 e5             	mov    %rsp,%rbp
+  80177a:	48 83 ec 20          	sub    $0x20,%rsp
+  80177e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801782:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801786:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80178d:	eb 0e                	jmp    80179d <strnlen+0x27>
+    n++;
+  80178f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801793:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801798:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80179d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8017a2:	74 0b                	je     8017af <strnlen+0x39>
+  8017a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a8:	0f b6 00             	movzbl (%rax),%eax
+  8017ab:	84 c0                	test   %al,%al
+  8017ad:	75 e0                	jne    80178f <strnlen+0x19>
+  return n;
+  8017af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8017b2:	c9                   	leave
+  8017b3:	c3                   	ret
+
+00000000008017b4 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8017b4:	55                   	push   %rbp
+  8017b5:	48 89 e5             	mov    %rsp,%rbp
+  8017b8:	48 83 ec 20          	sub    $0x20,%rsp
+  8017bc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017c0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8017c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8017cc:	90                   	nop
+  8017cd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017d1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017d5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017dd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017e1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017e5:	0f b6 12             	movzbl (%rdx),%edx
+  8017e8:	88 10                	mov    %dl,(%rax)
+  8017ea:	0f b6 00             	movzbl (%rax),%eax
+  8017ed:	84 c0                	test   %al,%al
+  8017ef:	75 dc                	jne    8017cd <strcpy+0x19>
+  return ret;
+  8017f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8017f5:	c9                   	leave
+  8017f6:	c3                   	ret
+
+00000000008017f7 <strcat>:
+strcat(char *dst, const char *src) {
+  8017f7:	55                   	push   %rbp
+  8017f8:	48 89 e5             	mov    %rsp,%rbp
+  8017fb:	48 83 ec 20          	sub    $0x20,%rsp
+  8017ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801803:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801807:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80180b:	48 89 c7             	mov    %rax,%rdi
+  80180e:	48 b8 b3 16 80 00 00 	movabs $0x8016b3,%rax
+  801815:	00 00 00 
+  801818:	ff d0                	call   *%rax
+  80181a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80181d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801820:	48 63 d0             	movslq %eax,%rdx
+  801823:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801827:	48 01 c2             	add    %rax,%rdx
+  80182a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80182e:	48 89 c6             	mov    %rax,%rsi
+  801831:	48 89 d7             	mov    %rdx,%rdi
+  801834:	48 b8 b4 17 80 00 00 	movabs $0x8017b4,%rax
+  80183b:	00 00 00 
+  80183e:	ff d0                	call   *%rax
+  return dst;
+  801840:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801844:	c9                   	leave
+  801845:	c3                   	ret
+
+0000000000801846 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801846:	55                   	push   %rbp
+  801847:	48 89 e5             	mov    %rsp,%rbp
+  80184a:	48 83 ec 28          	sub    $0x28,%rsp
+  80184e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801852:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801856:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80185a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80185e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801862:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801869:	00 
+  80186a:	eb 2a                	jmp    801896 <strncpy+0x50>
+    *dst++ = *src;
+  80186c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801870:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801874:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801878:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80187c:	0f b6 12             	movzbl (%rdx),%edx
+  80187f:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801881:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801885:	0f b6 00             	movzbl (%rax),%eax
+  801888:	84 c0                	test   %al,%al
+  80188a:	74 05                	je     801891 <strncpy+0x4b>
+      src++;
+  80188c:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801891:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801896:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80189a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80189e:	72 cc                	jb     80186c <strncpy+0x26>
+  return ret;
+  8018a0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8018a4:	c9                   	leave
+  8018a5:	c3                   	ret
+
+00000000008018a6 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8018a6:	55                   	push   %rbp
+  8018a7:	48 89 e5             	mov    %rsp,%rbp
+  8018aa:	48 83 ec 28          	sub    $0x28,%rsp
+  8018ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018b2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018b6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8018ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8018c2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8018c7:	74 3d                	je     801906 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8018c9:	eb 1d                	jmp    8018e8 <strlcpy+0x42>
+      *dst++ = *src++;
+  8018cb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018cf:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8018d3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8018d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018db:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8018df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8018e3:	0f b6 12             	movzbl (%rdx),%edx
+  8018e6:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8018e8:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8018ed:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8018f2:	74 0b                	je     8018ff <strlcpy+0x59>
+  8018f4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018f8:	0f b6 00             	movzbl (%rax),%eax
+  8018fb:	84 c0                	test   %al,%al
+  8018fd:	75 cc                	jne    8018cb <strlcpy+0x25>
+    *dst = '\0';
+  8018ff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801903:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801906:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80190a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80190e:	c9                   	leave
+  80190f:	c3                   	ret
+
+0000000000801910 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801910:	55                   	push   %rbp
+  801911:	48 89 e5             	mov    %rsp,%rbp
+  801914:	48 83 ec 30          	sub    $0x30,%rsp
+  801918:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80191c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801920:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801924:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801928:	48 89 c7             	mov    %rax,%rdi
+  80192b:	48 b8 b3 16 80 00 00 	movabs $0x8016b3,%rax
+  801932:	00 00 00 
+  801935:	ff d0                	call   *%rax
+  801937:	48 98                	cltq
+  801939:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80193d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801941:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801945:	48 89 d6             	mov    %rdx,%rsi
+  801948:	48 89 c7             	mov    %rax,%rdi
+  80194b:	48 b8 76 17 80 00 00 	movabs $0x801776,%rax
+  801952:	00 00 00 
+  801955:	ff d0                	call   *%rax
+  801957:	48 98                	cltq
+  801959:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80195d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801961:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801965:	75 10                	jne    801977 <strlcat+0x67>
+    return maxlen + srclen;
+  801967:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80196b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80196f:	48 01 d0             	add    %rdx,%rax
+  801972:	e9 86 00 00 00       	jmp    8019fd <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801977:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80197b:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80197f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801983:	73 2b                	jae    8019b0 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801985:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801989:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80198d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801991:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801995:	48 01 c1             	add    %rax,%rcx
+  801998:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80199c:	48 89 c6             	mov    %rax,%rsi
+  80199f:	48 89 cf             	mov    %rcx,%rdi
+  8019a2:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  8019a9:	00 00 00 
+  8019ac:	ff d0                	call   *%rax
+  8019ae:	eb 42                	jmp    8019f2 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8019b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019b4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019b8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c0:	48 01 c1             	add    %rax,%rcx
+  8019c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8019c7:	48 89 c6             	mov    %rax,%rsi
+  8019ca:	48 89 cf             	mov    %rcx,%rdi
+  8019cd:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  8019d4:	00 00 00 
+  8019d7:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8019d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e1:	48 01 d0             	add    %rdx,%rax
+  8019e4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ec:	48 01 d0             	add    %rdx,%rax
+  8019ef:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8019f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8019f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019fa:	48 01 d0             	add    %rdx,%rax
+}
+  8019fd:	c9                   	leave
+  8019fe:	c3                   	ret
+
+00000000008019ff <strcmp>:
+strcmp(const char *p, const char *q) {
+  8019ff:	55                   	push   %rbp
+  801a00:	48 89 e5             	mov    %rsp,%rbp
+  801a03:	48 83 ec 10          	sub    $0x10,%rsp
+  801a07:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a0b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a0f:	eb 0a                	jmp    801a1b <strcmp+0x1c>
+    p++, q++;
+  801a11:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a16:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a1f:	0f b6 00             	movzbl (%rax),%eax
+  801a22:	84 c0                	test   %al,%al
+  801a24:	74 12                	je     801a38 <strcmp+0x39>
+  801a26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2a:	0f b6 10             	movzbl (%rax),%edx
+  801a2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a31:	0f b6 00             	movzbl (%rax),%eax
+  801a34:	38 c2                	cmp    %al,%dl
+  801a36:	74 d9                	je     801a11 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801a38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a3c:	0f b6 00             	movzbl (%rax),%eax
+  801a3f:	0f b6 d0             	movzbl %al,%edx
+  801a42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a46:	0f b6 00             	movzbl (%rax),%eax
+  801a49:	0f b6 c0             	movzbl %al,%eax
+  801a4c:	29 c2                	sub    %eax,%edx
+  801a4e:	89 d0                	mov    %edx,%eax
+}
+  801a50:	c9                   	leave
+  801a51:	c3                   	ret
+
+0000000000801a52 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801a52:	55                   	push   %rbp
+  801a53:	48 89 e5             	mov    %rsp,%rbp
+  801a56:	48 83 ec 18          	sub    $0x18,%rsp
+  801a5a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a5e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a62:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801a66:	eb 0f                	jmp    801a77 <strncmp+0x25>
+    n--, p++, q++;
+  801a68:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801a6d:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a72:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801a77:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801a7c:	74 1d                	je     801a9b <strncmp+0x49>
+  801a7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a82:	0f b6 00             	movzbl (%rax),%eax
+  801a85:	84 c0                	test   %al,%al
+  801a87:	74 12                	je     801a9b <strncmp+0x49>
+  801a89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a8d:	0f b6 10             	movzbl (%rax),%edx
+  801a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a94:	0f b6 00             	movzbl (%rax),%eax
+  801a97:	38 c2                	cmp    %al,%dl
+  801a99:	74 cd                	je     801a68 <strncmp+0x16>
+  if (n == 0)
+  801a9b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801aa0:	75 07                	jne    801aa9 <strncmp+0x57>
+    return 0;
+  801aa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa7:	eb 16                	jmp    801abf <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801aa9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aad:	0f b6 00             	movzbl (%rax),%eax
+  801ab0:	0f b6 d0             	movzbl %al,%edx
+  801ab3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab7:	0f b6 00             	movzbl (%rax),%eax
+  801aba:	0f b6 c0             	movzbl %al,%eax
+  801abd:	29 c2                	sub    %eax,%edx
+}
+  801abf:	89 d0                	mov    %edx,%eax
+  801ac1:	c9                   	leave
+  801ac2:	c3                   	ret
+
+0000000000801ac3 <strchr>:
+strchr(const char *s, char c) {
+  801ac3:	55                   	push   %rbp
+  801ac4:	48 89 e5             	mov    %rsp,%rbp
+  801ac7:	48 83 ec 60          	sub    $0x60,%rsp
+  801acb:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801acf:	89 f0                	mov    %esi,%eax
+  801ad1:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801ad4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801ad8:	83 e0 0f             	and    $0xf,%eax
+  801adb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801ade:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ae1:	48 f7 d8             	neg    %rax
+  801ae4:	48 89 c2             	mov    %rax,%rdx
+  801ae7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801aeb:	48 01 d0             	add    %rdx,%rax
+  801aee:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801af2:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801af6:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801afa:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801afe:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b02:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b06:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b0a:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b0f:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801b13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b17:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b1b:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801b1f:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b24:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b29:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b2d:	89 c2                	mov    %eax,%edx
+  801b2f:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b34:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b39:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b3d:	09 c2                	or     %eax,%edx
+  801b3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b42:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801b47:	89 c1                	mov    %eax,%ecx
+  801b49:	d3 e6                	shl    %cl,%esi
+  801b4b:	89 f0                	mov    %esi,%eax
+  801b4d:	21 d0                	and    %edx,%eax
+  801b4f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b52:	eb 34                	jmp    801b88 <strchr+0xc5>
+    p += 16;
+  801b54:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801b59:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b5d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b61:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801b65:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b6a:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b6f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b73:	89 c2                	mov    %eax,%edx
+  801b75:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b7a:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b7f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b83:	09 d0                	or     %edx,%eax
+  801b85:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b88:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b8c:	74 c6                	je     801b54 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801b8e:	31 c0                	xor    %eax,%eax
+  801b90:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801b95:	48 98                	cltq
+  801b97:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801b9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b9f:	0f b6 00             	movzbl (%rax),%eax
+  801ba2:	84 c0                	test   %al,%al
+  801ba4:	74 06                	je     801bac <strchr+0xe9>
+  801ba6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801baa:	eb 05                	jmp    801bb1 <strchr+0xee>
+  801bac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bb1:	c9                   	leave
+  801bb2:	c3                   	ret
+
+0000000000801bb3 <strfind>:
+strfind(const char *s, char c) {
+  801bb3:	55                   	push   %rbp
+  801bb4:	48 89 e5             	mov    %rsp,%rbp
+  801bb7:	48 83 ec 10          	sub    $0x10,%rsp
+  801bbb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801bbf:	89 f0                	mov    %esi,%eax
+  801bc1:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801bc4:	eb 11                	jmp    801bd7 <strfind+0x24>
+    if (*s == c)
+  801bc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bca:	0f b6 00             	movzbl (%rax),%eax
+  801bcd:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801bd0:	74 12                	je     801be4 <strfind+0x31>
+  for (; *s; s++)
+  801bd2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801bd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bdb:	0f b6 00             	movzbl (%rax),%eax
+  801bde:	84 c0                	test   %al,%al
+  801be0:	75 e4                	jne    801bc6 <strfind+0x13>
+  801be2:	eb 01                	jmp    801be5 <strfind+0x32>
+      break;
+  801be4:	90                   	nop
+  return (char *)s;
+  801be5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801be9:	c9                   	leave
+  801bea:	c3                   	ret
+
+0000000000801beb <memset>:
+memset(void *v, int c, size_t n) {
+  801beb:	55                   	push   %rbp
+  801bec:	48 89 e5             	mov    %rsp,%rbp
+  801bef:	48 83 ec 38          	sub    $0x38,%rsp
+  801bf3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bf7:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801bfa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801bfe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c02:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c06:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c0b:	76 41                	jbe    801c4e <memset+0x63>
+  801c0d:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  801c14:	00 00 00 
+  801c17:	ff d0                	call   *%rax
+  801c19:	83 e0 01             	and    $0x1,%eax
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	74 2e                	je     801c4e <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801c20:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c23:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c27:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c2b:	48 89 ce             	mov    %rcx,%rsi
+  801c2e:	48 89 f7             	mov    %rsi,%rdi
+  801c31:	48 89 d1             	mov    %rdx,%rcx
+  801c34:	fc                   	cld
+  801c35:	f3 aa                	rep stos %al,%es:(%rdi)
+  801c37:	48 89 ca             	mov    %rcx,%rdx
+  801c3a:	48 89 fe             	mov    %rdi,%rsi
+  801c3d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801c41:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801c45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c49:	e9 a7 00 00 00       	jmp    801cf5 <memset+0x10a>
+  if (n >= 8) {
+  801c4e:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c53:	0f 86 87 00 00 00    	jbe    801ce0 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801c59:	eb 16                	jmp    801c71 <memset+0x86>
+      *p++ = c;
+  801c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c5f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c63:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c67:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801c6a:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801c6c:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c75:	83 e0 07             	and    $0x7,%eax
+  801c78:	48 85 c0             	test   %rax,%rax
+  801c7b:	75 de                	jne    801c5b <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801c7d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c80:	0f b6 c0             	movzbl %al,%eax
+  801c83:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801c8a:	01 01 01 
+  801c8d:	48 0f af c2          	imul   %rdx,%rax
+  801c91:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801c95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c99:	48 c1 e8 03          	shr    $0x3,%rax
+  801c9d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801ca1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ca5:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801ca9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801cad:	48 89 ce             	mov    %rcx,%rsi
+  801cb0:	48 89 f7             	mov    %rsi,%rdi
+  801cb3:	48 89 d1             	mov    %rdx,%rcx
+  801cb6:	fc                   	cld
+  801cb7:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801cba:	48 89 ca             	mov    %rcx,%rdx
+  801cbd:	48 89 fe             	mov    %rdi,%rsi
+  801cc0:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801cc4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801cc8:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801ccd:	eb 11                	jmp    801ce0 <memset+0xf5>
+    *p++ = c;
+  801ccf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cd3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cd7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cdb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801cde:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801ce0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ce4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ce8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cec:	48 85 c0             	test   %rax,%rax
+  801cef:	75 de                	jne    801ccf <memset+0xe4>
+  return v;
+  801cf1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801cf5:	c9                   	leave
+  801cf6:	c3                   	ret
+
+0000000000801cf7 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801cf7:	55                   	push   %rbp
+  801cf8:	48 89 e5             	mov    %rsp,%rbp
+  801cfb:	48 83 ec 38          	sub    $0x38,%rsp
+  801cff:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d03:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d07:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801d0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d0f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801d13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d17:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801d1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d1f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801d23:	0f 83 da 00 00 00    	jae    801e03 <memmove+0x10c>
+  801d29:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d31:	48 01 d0             	add    %rdx,%rax
+  801d34:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801d38:	0f 83 c5 00 00 00    	jae    801e03 <memmove+0x10c>
+    s += n;
+  801d3e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d42:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801d46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d4a:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801d4e:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801d53:	0f 86 94 00 00 00    	jbe    801ded <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801d59:	eb 1c                	jmp    801d77 <memmove+0x80>
+        *--d = *--s;
+  801d5b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801d60:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801d65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d69:	0f b6 10             	movzbl (%rax),%edx
+  801d6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d70:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801d72:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801d77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d7b:	83 e0 07             	and    $0x7,%eax
+  801d7e:	48 85 c0             	test   %rax,%rax
+  801d81:	75 d8                	jne    801d5b <memmove+0x64>
+      nq = n / 8;
+  801d83:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d87:	48 c1 e8 03          	shr    $0x3,%rax
+  801d8b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801d8f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801d94:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801d99:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801d9e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801da2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801da6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801daa:	48 89 cf             	mov    %rcx,%rdi
+  801dad:	48 89 d6             	mov    %rdx,%rsi
+  801db0:	48 89 c1             	mov    %rax,%rcx
+  801db3:	fd                   	std
+  801db4:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801db7:	fc                   	cld
+  801db8:	48 89 c8             	mov    %rcx,%rax
+  801dbb:	48 89 f2             	mov    %rsi,%rdx
+  801dbe:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801dc2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801dc6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801dca:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801dcf:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801dd4:	eb 17                	jmp    801ded <memmove+0xf6>
+      *--d = *--s;
+  801dd6:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801ddb:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801de0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801de4:	0f b6 10             	movzbl (%rax),%edx
+  801de7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801deb:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801ded:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801df1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801df5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801df9:	48 85 c0             	test   %rax,%rax
+  801dfc:	75 d8                	jne    801dd6 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801dfe:	e9 f4 00 00 00       	jmp    801ef7 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801e03:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801e08:	76 46                	jbe    801e50 <memmove+0x159>
+  801e0a:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  801e11:	00 00 00 
+  801e14:	ff d0                	call   *%rax
+  801e16:	83 e0 01             	and    $0x1,%eax
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	74 33                	je     801e50 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801e1d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e21:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e29:	48 89 cf             	mov    %rcx,%rdi
+  801e2c:	48 89 d6             	mov    %rdx,%rsi
+  801e2f:	48 89 c1             	mov    %rax,%rcx
+  801e32:	fc                   	cld
+  801e33:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801e35:	48 89 c8             	mov    %rcx,%rax
+  801e38:	48 89 f2             	mov    %rsi,%rdx
+  801e3b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801e3f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801e43:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801e47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e4b:	e9 ab 00 00 00       	jmp    801efb <memmove+0x204>
+    if (n >= 8) {
+  801e50:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801e55:	0f 86 8b 00 00 00    	jbe    801ee6 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801e5b:	eb 22                	jmp    801e7f <memmove+0x188>
+        *d++ = *s++;
+  801e5d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e61:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801e65:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801e69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e6d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801e71:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801e75:	0f b6 12             	movzbl (%rdx),%edx
+  801e78:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801e7a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801e7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e83:	83 e0 07             	and    $0x7,%eax
+  801e86:	48 85 c0             	test   %rax,%rax
+  801e89:	75 d2                	jne    801e5d <memmove+0x166>
+      nq = n / 8;
+  801e8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e8f:	48 c1 e8 03          	shr    $0x3,%rax
+  801e93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801e97:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e9b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ea3:	48 89 cf             	mov    %rcx,%rdi
+  801ea6:	48 89 d6             	mov    %rdx,%rsi
+  801ea9:	48 89 c1             	mov    %rax,%rcx
+  801eac:	fc                   	cld
+  801ead:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801eb0:	48 89 c8             	mov    %rcx,%rax
+  801eb3:	48 89 f2             	mov    %rsi,%rdx
+  801eb6:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801eba:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ebe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801ec2:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801ec7:	eb 1d                	jmp    801ee6 <memmove+0x1ef>
+      *d++ = *s++;
+  801ec9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ecd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801ed1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ed5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ed9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801edd:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801ee1:	0f b6 12             	movzbl (%rdx),%edx
+  801ee4:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801ee6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eea:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801eee:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ef2:	48 85 c0             	test   %rax,%rax
+  801ef5:	75 d2                	jne    801ec9 <memmove+0x1d2>
+  return dst;
+  801ef7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801efb:	c9                   	leave
+  801efc:	c3                   	ret
+
+0000000000801efd <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801efd:	55                   	push   %rbp
+  801efe:	48 89 e5             	mov    %rsp,%rbp
+  801f01:	48 83 ec 18          	sub    $0x18,%rsp
+  801f05:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f09:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f0d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801f11:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f15:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f1d:	48 89 ce             	mov    %rcx,%rsi
+  801f20:	48 89 c7             	mov    %rax,%rdi
+  801f23:	48 b8 f7 1c 80 00 00 	movabs $0x801cf7,%rax
+  801f2a:	00 00 00 
+  801f2d:	ff d0                	call   *%rax
+}
+  801f2f:	c9                   	leave
+  801f30:	c3                   	ret
+
+0000000000801f31 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801f31:	55                   	push   %rbp
+  801f32:	48 89 e5             	mov    %rsp,%rbp
+  801f35:	48 83 ec 40          	sub    $0x40,%rsp
+  801f39:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f3d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f41:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801f45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f49:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801f4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f51:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801f55:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801f5a:	0f 86 a7 00 00 00    	jbe    802007 <memcmp+0xd6>
+  801f60:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  801f67:	00 00 00 
+  801f6a:	ff d0                	call   *%rax
+  801f6c:	83 e0 02             	and    $0x2,%eax
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	0f 84 90 00 00 00    	je     802007 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801f77:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f7b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f83:	48 89 ce             	mov    %rcx,%rsi
+  801f86:	48 89 c7             	mov    %rax,%rdi
+  801f89:	48 b8 18 15 80 00 00 	movabs $0x801518,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+  801f95:	e9 c2 00 00 00       	jmp    80205c <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801f9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f9e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801fa2:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801fa6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801faa:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801fae:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801fb2:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801fb6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801fb9:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801fc0:	74 36                	je     801ff8 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801fc2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fc5:	f7 d0                	not    %eax
+  801fc7:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801fcb:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801fce:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801fd1:	48 63 d0             	movslq %eax,%rdx
+  801fd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fd8:	48 01 d0             	add    %rdx,%rax
+  801fdb:	0f b6 00             	movzbl (%rax),%eax
+  801fde:	0f b6 c0             	movzbl %al,%eax
+  801fe1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801fe4:	48 63 ca             	movslq %edx,%rcx
+  801fe7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801feb:	48 01 ca             	add    %rcx,%rdx
+  801fee:	0f b6 12             	movzbl (%rdx),%edx
+  801ff1:	0f b6 d2             	movzbl %dl,%edx
+  801ff4:	29 d0                	sub    %edx,%eax
+  801ff6:	eb 64                	jmp    80205c <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801ff8:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801ffd:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  802002:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  802007:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  80200c:	77 8c                	ja     801f9a <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80200e:	eb 36                	jmp    802046 <memcmp+0x115>
+    if (*s1 != *s2)
+  802010:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802014:	0f b6 10             	movzbl (%rax),%edx
+  802017:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80201b:	0f b6 00             	movzbl (%rax),%eax
+  80201e:	38 c2                	cmp    %al,%dl
+  802020:	74 1a                	je     80203c <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802022:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802026:	0f b6 00             	movzbl (%rax),%eax
+  802029:	0f b6 c8             	movzbl %al,%ecx
+  80202c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802030:	0f b6 00             	movzbl (%rax),%eax
+  802033:	0f b6 d0             	movzbl %al,%edx
+  802036:	89 c8                	mov    %ecx,%eax
+  802038:	29 d0                	sub    %edx,%eax
+  80203a:	eb 20                	jmp    80205c <memcmp+0x12b>
+    s1++, s2++;
+  80203c:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802041:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  802046:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80204a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80204e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802052:	48 85 c0             	test   %rax,%rax
+  802055:	75 b9                	jne    802010 <memcmp+0xdf>
+  }
+
+  return 0;
+  802057:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80205c:	c9                   	leave
+  80205d:	c3                   	ret
+
+000000000080205e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  80205e:	55                   	push   %rbp
+  80205f:	48 89 e5             	mov    %rsp,%rbp
+  802062:	48 83 ec 50          	sub    $0x50,%rsp
+  802066:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80206a:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  80206d:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  802071:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802075:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802079:	48 01 d0             	add    %rdx,%rax
+  80207c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  802080:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802083:	66 0f 6e c0          	movd   %eax,%xmm0
+  802087:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80208b:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80208f:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  802094:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  802098:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  80209d:	76 73                	jbe    802112 <memfind+0xb4>
+  80209f:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  8020a6:	00 00 00 
+  8020a9:	ff d0                	call   *%rax
+  8020ab:	83 e0 02             	and    $0x2,%eax
+  8020ae:	85 c0                	test   %eax,%eax
+  8020b0:	74 60                	je     802112 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8020b2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8020b5:	0f b6 c8             	movzbl %al,%ecx
+  8020b8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8020bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020c0:	89 ce                	mov    %ecx,%esi
+  8020c2:	48 89 c7             	mov    %rax,%rdi
+  8020c5:	48 b8 07 16 80 00 00 	movabs $0x801607,%rax
+  8020cc:	00 00 00 
+  8020cf:	ff d0                	call   *%rax
+  8020d1:	eb 6c                	jmp    80213f <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  8020d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020d7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8020db:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8020df:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  8020e4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8020e8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8020ec:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8020ef:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8020f3:	74 13                	je     802108 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  8020f5:	31 c0                	xor    %eax,%eax
+  8020f7:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  8020fc:	48 63 d0             	movslq %eax,%rdx
+  8020ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802103:	48 01 d0             	add    %rdx,%rax
+  802106:	eb 37                	jmp    80213f <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  802108:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  80210d:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802112:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  802117:	77 ba                	ja     8020d3 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  802119:	eb 13                	jmp    80212e <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  80211b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80211f:	0f b6 00             	movzbl (%rax),%eax
+  802122:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802125:	38 d0                	cmp    %dl,%al
+  802127:	74 11                	je     80213a <memfind+0xdc>
+  for (; s < ends; s++)
+  802129:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80212e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802132:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802136:	72 e3                	jb     80211b <memfind+0xbd>
+  802138:	eb 01                	jmp    80213b <memfind+0xdd>
+      break;
+  80213a:	90                   	nop
+  return (void *)s;
+  80213b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80213f:	c9                   	leave
+  802140:	c3                   	ret
+
+0000000000802141 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802141:	55                   	push   %rbp
+  802142:	48 89 e5             	mov    %rsp,%rbp
+  802145:	48 83 ec 38          	sub    $0x38,%rsp
+  802149:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80214d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802151:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802154:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  80215b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802162:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802163:	eb 05                	jmp    80216a <strtol+0x29>
+    s++;
+  802165:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  80216a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80216e:	0f b6 00             	movzbl (%rax),%eax
+  802171:	3c 20                	cmp    $0x20,%al
+  802173:	74 f0                	je     802165 <strtol+0x24>
+  802175:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802179:	0f b6 00             	movzbl (%rax),%eax
+  80217c:	3c 09                	cmp    $0x9,%al
+  80217e:	74 e5                	je     802165 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802180:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802184:	0f b6 00             	movzbl (%rax),%eax
+  802187:	3c 2b                	cmp    $0x2b,%al
+  802189:	75 07                	jne    802192 <strtol+0x51>
+    s++;
+  80218b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802190:	eb 17                	jmp    8021a9 <strtol+0x68>
+  else if (*s == '-')
+  802192:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802196:	0f b6 00             	movzbl (%rax),%eax
+  802199:	3c 2d                	cmp    $0x2d,%al
+  80219b:	75 0c                	jne    8021a9 <strtol+0x68>
+    s++, neg = 1;
+  80219d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021a2:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8021a9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021ad:	74 06                	je     8021b5 <strtol+0x74>
+  8021af:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8021b3:	75 28                	jne    8021dd <strtol+0x9c>
+  8021b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021b9:	0f b6 00             	movzbl (%rax),%eax
+  8021bc:	3c 30                	cmp    $0x30,%al
+  8021be:	75 1d                	jne    8021dd <strtol+0x9c>
+  8021c0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021c4:	48 83 c0 01          	add    $0x1,%rax
+  8021c8:	0f b6 00             	movzbl (%rax),%eax
+  8021cb:	3c 78                	cmp    $0x78,%al
+  8021cd:	75 0e                	jne    8021dd <strtol+0x9c>
+    s += 2, base = 16;
+  8021cf:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8021d4:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8021db:	eb 2c                	jmp    802209 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8021dd:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8021e1:	75 19                	jne    8021fc <strtol+0xbb>
+  8021e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021e7:	0f b6 00             	movzbl (%rax),%eax
+  8021ea:	3c 30                	cmp    $0x30,%al
+  8021ec:	75 0e                	jne    8021fc <strtol+0xbb>
+    s++, base = 8;
+  8021ee:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021f3:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8021fa:	eb 0d                	jmp    802209 <strtol+0xc8>
+  else if (base == 0)
+  8021fc:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802200:	75 07                	jne    802209 <strtol+0xc8>
+    base = 10;
+  802202:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802209:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80220d:	0f b6 00             	movzbl (%rax),%eax
+  802210:	3c 2f                	cmp    $0x2f,%al
+  802212:	7e 1d                	jle    802231 <strtol+0xf0>
+  802214:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802218:	0f b6 00             	movzbl (%rax),%eax
+  80221b:	3c 39                	cmp    $0x39,%al
+  80221d:	7f 12                	jg     802231 <strtol+0xf0>
+      dig = *s - '0';
+  80221f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802223:	0f b6 00             	movzbl (%rax),%eax
+  802226:	0f be c0             	movsbl %al,%eax
+  802229:	83 e8 30             	sub    $0x30,%eax
+  80222c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80222f:	eb 4e                	jmp    80227f <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802231:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802235:	0f b6 00             	movzbl (%rax),%eax
+  802238:	3c 60                	cmp    $0x60,%al
+  80223a:	7e 1d                	jle    802259 <strtol+0x118>
+  80223c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802240:	0f b6 00             	movzbl (%rax),%eax
+  802243:	3c 7a                	cmp    $0x7a,%al
+  802245:	7f 12                	jg     802259 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802247:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80224b:	0f b6 00             	movzbl (%rax),%eax
+  80224e:	0f be c0             	movsbl %al,%eax
+  802251:	83 e8 57             	sub    $0x57,%eax
+  802254:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802257:	eb 26                	jmp    80227f <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802259:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80225d:	0f b6 00             	movzbl (%rax),%eax
+  802260:	3c 40                	cmp    $0x40,%al
+  802262:	7e 47                	jle    8022ab <strtol+0x16a>
+  802264:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802268:	0f b6 00             	movzbl (%rax),%eax
+  80226b:	3c 5a                	cmp    $0x5a,%al
+  80226d:	7f 3c                	jg     8022ab <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  80226f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802273:	0f b6 00             	movzbl (%rax),%eax
+  802276:	0f be c0             	movsbl %al,%eax
+  802279:	83 e8 37             	sub    $0x37,%eax
+  80227c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  80227f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802282:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802285:	7d 23                	jge    8022aa <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802287:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80228c:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80228f:	48 98                	cltq
+  802291:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802296:	48 89 c2             	mov    %rax,%rdx
+  802299:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80229c:	48 98                	cltq
+  80229e:	48 01 d0             	add    %rdx,%rax
+  8022a1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8022a5:	e9 5f ff ff ff       	jmp    802209 <strtol+0xc8>
+      break;
+  8022aa:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8022ab:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8022b0:	74 0b                	je     8022bd <strtol+0x17c>
+    *endptr = (char *)s;
+  8022b2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022b6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8022ba:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8022bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8022c1:	74 09                	je     8022cc <strtol+0x18b>
+  8022c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022c7:	48 f7 d8             	neg    %rax
+  8022ca:	eb 04                	jmp    8022d0 <strtol+0x18f>
+  8022cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8022d0:	c9                   	leave
+  8022d1:	c3                   	ret
+
+00000000008022d2 <readline_cooked>:
+
+#if !JOS_KERNEL
+// Read a line from a console in cooked mode: the kernel does the
+// echoing and editing and returns the whole line in one read.
+static char *
+readline_cooked(int mode) {
+  8022d2:	55                   	push   %rbp
+  8022d3:	48 89 e5             	mov    %rsp,%rbp
+  8022d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8022da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+
+  r = read(0, buf, BUFLEN - 1);
+  8022dd:	ba ff 03 00 00       	mov    $0x3ff,%edx
+  8022e2:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8022e9:	00 00 00 
+  8022ec:	48 89 c6             	mov    %rax,%rsi
+  8022ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f4:	48 b8 75 35 80 00 00 	movabs $0x803575,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+  802300:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  consmode(0, mode);
+  802303:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802306:	89 c6                	mov    %eax,%esi
+  802308:	bf 00 00 00 00       	mov    $0x0,%edi
+  80230d:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  802314:	00 00 00 
+  802317:	ff d0                	call   *%rax
+  if (r < 0) {
+  802319:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80231d:	79 2a                	jns    802349 <readline_cooked+0x77>
+    cprintf("read error: %i\n", r);
+  80231f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802322:	89 c6                	mov    %eax,%esi
+  802324:	48 b8 88 5c 80 00 00 	movabs $0x805c88,%rax
+  80232b:	00 00 00 
+  80232e:	48 89 c7             	mov    %rax,%rdi
+  802331:	b8 00 00 00 00       	mov    $0x0,%eax
+  802336:	48 ba 04 08 80 00 00 	movabs $0x800804,%rdx
+  80233d:	00 00 00 
+  802340:	ff d2                	call   *%rdx
+    return NULL;
+  802342:	b8 00 00 00 00       	mov    $0x0,%eax
+  802347:	eb 48                	jmp    802391 <readline_cooked+0xbf>
+  }
+  if (r == 0)
+  802349:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80234d:	75 07                	jne    802356 <readline_cooked+0x84>
+    return NULL;
+  80234f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802354:	eb 3b                	jmp    802391 <readline_cooked+0xbf>
+  if (buf[r - 1] == '\n')
+  802356:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802359:	83 e8 01             	sub    $0x1,%eax
+  80235c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802363:	00 00 00 
+  802366:	48 98                	cltq
+  802368:	0f b6 04 02          	movzbl (%rdx,%rax,1),%eax
+  80236c:	3c 0a                	cmp    $0xa,%al
+  80236e:	75 04                	jne    802374 <readline_cooked+0xa2>
+    r--;
+  802370:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+  buf[r] = 0;
+  802374:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80237b:	00 00 00 
+  80237e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802381:	48 98                	cltq
+  802383:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+  return buf;
+  802387:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80238e:	00 00 00 
+}
+  802391:	c9                   	leave
+  802392:	c3                   	ret
+
+0000000000802393 <readline>:
+#endif
+
+char *
+readline(const char *prompt) {
+  802393:	55                   	push   %rbp
+  802394:	48 89 e5             	mov    %rsp,%rbp
+  802397:	48 83 ec 20          	sub    $0x20,%rsp
+  80239b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i, c, echoing;
+
+  if (prompt != NULL) {
+  80239f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8023a4:	74 2a                	je     8023d0 <readline+0x3d>
+#if JOS_KERNEL
+    cprintf("%s", prompt);
+#else
+    fprintf(1, "%s", prompt);
+  8023a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8023aa:	48 89 c2             	mov    %rax,%rdx
+  8023ad:	48 b8 98 5c 80 00 00 	movabs $0x805c98,%rax
+  8023b4:	00 00 00 
+  8023b7:	48 89 c6             	mov    %rax,%rsi
+  8023ba:	bf 01 00 00 00       	mov    $0x1,%edi
+  8023bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c4:	48 b9 c0 45 80 00 00 	movabs $0x8045c0,%rcx
+  8023cb:	00 00 00 
+  8023ce:	ff d1                	call   *%rcx
+#endif
+  }
+
+#if !JOS_KERNEL
+  if ((c = consmode(0, CONS_COOKED)) >= 0)
+  8023d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8023d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023da:	48 b8 15 03 80 00 00 	movabs $0x800315,%rax
+  8023e1:	00 00 00 
+  8023e4:	ff d0                	call   *%rax
+  8023e6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8023e9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8023ed:	78 16                	js     802405 <readline+0x72>
+    return readline_cooked(c);
+  8023ef:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8023f2:	89 c7                	mov    %eax,%edi
+  8023f4:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8023fb:	00 00 00 
+  8023fe:	ff d0                	call   *%rax
+  802400:	e9 4b 01 00 00       	jmp    802550 <readline+0x1bd>
+#endif
+
+  i       = 0;
+  802405:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  echoing = iscons(0);
+  80240c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802411:	48 b8 37 02 80 00 00 	movabs $0x800237,%rax
+  802418:	00 00 00 
+  80241b:	ff d0                	call   *%rax
+  80241d:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  while (1) {
+    c = getchar();
+  802420:	48 b8 ee 01 80 00 00 	movabs $0x8001ee,%rax
+  802427:	00 00 00 
+  80242a:	ff d0                	call   *%rax
+  80242c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (c < 0) {
+  80242f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802433:	79 33                	jns    802468 <readline+0xd5>
+      if (c != -E_EOF)
+  802435:	83 7d f8 f5          	cmpl   $0xfffffff5,-0x8(%rbp)
+  802439:	74 23                	je     80245e <readline+0xcb>
+        cprintf("read error: %i\n", c);
+  80243b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80243e:	89 c6                	mov    %eax,%esi
+  802440:	48 b8 88 5c 80 00 00 	movabs $0x805c88,%rax
+  802447:	00 00 00 
+  80244a:	48 89 c7             	mov    %rax,%rdi
+  80244d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802452:	48 ba 04 08 80 00 00 	movabs $0x800804,%rdx
+  802459:	00 00 00 
+  80245c:	ff d2                	call   *%rdx
+      return NULL;
+  80245e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802463:	e9 e8 00 00 00       	jmp    802550 <readline+0x1bd>
+    } else if ((c == '\b' || c == '\x7f')) {
+  802468:	83 7d f8 08          	cmpl   $0x8,-0x8(%rbp)
+  80246c:	74 06                	je     802474 <readline+0xe1>
+  80246e:	83 7d f8 7f          	cmpl   $0x7f,-0x8(%rbp)
+  802472:	75 4c                	jne    8024c0 <readline+0x12d>
+      if (i > 0) {
+  802474:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802478:	0f 8e cd 00 00 00    	jle    80254b <readline+0x1b8>
+        if (echoing) {
+  80247e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  802482:	74 33                	je     8024b7 <readline+0x124>
+          cputchar('\b');
+  802484:	bf 08 00 00 00       	mov    $0x8,%edi
+  802489:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  802490:	00 00 00 
+  802493:	ff d0                	call   *%rax
+          cputchar(' ');
+  802495:	bf 20 00 00 00       	mov    $0x20,%edi
+  80249a:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+          cputchar('\b');
+  8024a6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024ab:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+        }
+        i--;
+  8024b7:	83 6d fc 01          	subl   $0x1,-0x4(%rbp)
+      if (i > 0) {
+  8024bb:	e9 8b 00 00 00       	jmp    80254b <readline+0x1b8>
+      }
+    } else if (c >= ' ' && i < BUFLEN - 1) {
+  8024c0:	83 7d f8 1f          	cmpl   $0x1f,-0x8(%rbp)
+  8024c4:	7e 3f                	jle    802505 <readline+0x172>
+  8024c6:	81 7d fc fe 03 00 00 	cmpl   $0x3fe,-0x4(%rbp)
+  8024cd:	7f 36                	jg     802505 <readline+0x172>
+      if (echoing)
+  8024cf:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8024d3:	74 11                	je     8024e6 <readline+0x153>
+        cputchar(c);
+  8024d5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8024d8:	89 c7                	mov    %eax,%edi
+  8024da:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  8024e1:	00 00 00 
+  8024e4:	ff d0                	call   *%rax
+      buf[i++] = c;
+  8024e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024e9:	8d 50 01             	lea    0x1(%rax),%edx
+  8024ec:	89 55 fc             	mov    %edx,-0x4(%rbp)
+  8024ef:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8024f2:	89 d1                	mov    %edx,%ecx
+  8024f4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8024fb:	00 00 00 
+  8024fe:	48 98                	cltq
+  802500:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+  802503:	eb 46                	jmp    80254b <readline+0x1b8>
+    } else if (c == '\n' || c == '\r') {
+  802505:	83 7d f8 0a          	cmpl   $0xa,-0x8(%rbp)
+  802509:	74 0a                	je     802515 <readline+0x182>
+  80250b:	83 7d f8 0d          	cmpl   $0xd,-0x8(%rbp)
+  80250f:	0f 85 0b ff ff ff    	jne    802420 <readline+0x8d>
+      if (echoing)
+  802515:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  802519:	74 11                	je     80252c <readline+0x199>
+        cputchar('\n');
+  80251b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802520:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  802527:	00 00 00 
+  80252a:	ff d0                	call   *%rax
+      buf[i] = 0;
+  80252c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  802533:	00 00 00 
+  802536:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802539:	48 98                	cltq
+  80253b:	c6 04 02 00          	movb   $0x0,(%rdx,%rax,1)
+      return buf;
+  80253f:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  802546:	00 00 00 
+  802549:	eb 05                	jmp    802550 <readline+0x1bd>
+    c = getchar();
+  80254b:	e9 d0 fe ff ff       	jmp    802420 <readline+0x8d>
+    }
+  }
+}
+  802550:	c9                   	leave
+  802551:	c3                   	ret
+
+0000000000802552 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802552:	55                   	push   %rbp
+  802553:	48 89 e5             	mov    %rsp,%rbp
+  802556:	53                   	push   %rbx
+  802557:	48 83 ec 48          	sub    $0x48,%rsp
+  80255b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80255f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802563:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802567:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80256b:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80256f:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802573:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802577:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80257b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80257f:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802583:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802587:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80258b:	4c 89 c3             	mov    %r8,%rbx
+  80258e:	cd 30                	int    $0x30
+  802590:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802594:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802599:	74 46                	je     8025e1 <syscall+0x8f>
+  80259b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8025a0:	7e 3f                	jle    8025e1 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  8025a2:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8025a6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025aa:	49 89 d0             	mov    %rdx,%r8
+  8025ad:	48 89 c1             	mov    %rax,%rcx
+  8025b0:	48 b8 a0 5c 80 00 00 	movabs $0x805ca0,%rax
+  8025b7:	00 00 00 
+  8025ba:	48 89 c2             	mov    %rax,%rdx
+  8025bd:	be 22 00 00 00       	mov    $0x22,%esi
+  8025c2:	48 b8 bf 5c 80 00 00 	movabs $0x805cbf,%rax
+  8025c9:	00 00 00 
+  8025cc:	48 89 c7             	mov    %rax,%rdi
+  8025cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d4:	49 b9 e5 05 80 00 00 	movabs $0x8005e5,%r9
+  8025db:	00 00 00 
+  8025de:	41 ff d1             	call   *%r9
+
+  return ret;
+  8025e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8025e5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025e9:	c9                   	leave
+  8025ea:	c3                   	ret
+
+00000000008025eb <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8025eb:	55                   	push   %rbp
+  8025ec:	48 89 e5             	mov    %rsp,%rbp
+  8025ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8025f3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8025f7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8025fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802603:	48 83 ec 08          	sub    $0x8,%rsp
+  802607:	6a 00                	push   $0x0
+  802609:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80260f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802615:	48 89 d1             	mov    %rdx,%rcx
+  802618:	48 89 c2             	mov    %rax,%rdx
+  80261b:	be 00 00 00 00       	mov    $0x0,%esi
+  802620:	bf 00 00 00 00       	mov    $0x0,%edi
+  802625:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+  802631:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802635:	90                   	nop
+  802636:	c9                   	leave
+  802637:	c3                   	ret
+
+0000000000802638 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802638:	55                   	push   %rbp
+  802639:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80263c:	48 83 ec 08          	sub    $0x8,%rsp
+  802640:	6a 00                	push   $0x0
+  802642:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802648:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80264e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802653:	ba 00 00 00 00       	mov    $0x0,%edx
+  802658:	be 00 00 00 00       	mov    $0x0,%esi
+  80265d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802662:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802669:	00 00 00 
+  80266c:	ff d0                	call   *%rax
+  80266e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802672:	c9                   	leave
+  802673:	c3                   	ret
+
+0000000000802674 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802674:	55                   	push   %rbp
+  802675:	48 89 e5             	mov    %rsp,%rbp
+  802678:	48 83 ec 10          	sub    $0x10,%rsp
+  80267c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80267f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802682:	48 98                	cltq
+  802684:	48 83 ec 08          	sub    $0x8,%rsp
+  802688:	6a 00                	push   $0x0
+  80268a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802690:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802696:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80269b:	48 89 c2             	mov    %rax,%rdx
+  80269e:	be 01 00 00 00       	mov    $0x1,%esi
+  8026a3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8026a8:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  8026af:	00 00 00 
+  8026b2:	ff d0                	call   *%rax
+  8026b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b8:	c9                   	leave
+  8026b9:	c3                   	ret
+
+00000000008026ba <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8026ba:	55                   	push   %rbp
+  8026bb:	48 89 e5             	mov    %rsp,%rbp
+  8026be:	48 83 ec 10          	sub    $0x10,%rsp
+  8026c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8026c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026c8:	48 98                	cltq
+  8026ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ce:	6a 00                	push   $0x0
+  8026d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026e1:	48 89 c2             	mov    %rax,%rdx
+  8026e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026ee:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  8026f5:	00 00 00 
+  8026f8:	ff d0                	call   *%rax
+  8026fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026fe:	90                   	nop
+  8026ff:	c9                   	leave
+  802700:	c3                   	ret
+
+0000000000802701 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802701:	55                   	push   %rbp
+  802702:	48 89 e5             	mov    %rsp,%rbp
+  802705:	48 83 ec 20          	sub    $0x20,%rsp
+  802709:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80270c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802710:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802713:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802716:	b8 05 00 00 00       	mov    $0x5,%eax
+  80271b:	cd 30                	int    $0x30
+  80271d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802721:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802725:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80272a:	7e 3d                	jle    802769 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  80272c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802730:	49 89 c0             	mov    %rax,%r8
+  802733:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802738:	48 b8 a0 5c 80 00 00 	movabs $0x805ca0,%rax
+  80273f:	00 00 00 
+  802742:	48 89 c2             	mov    %rax,%rdx
+  802745:	be 49 00 00 00       	mov    $0x49,%esi
+  80274a:	48 b8 bf 5c 80 00 00 	movabs $0x805cbf,%rax
+  802751:	00 00 00 
+  802754:	48 89 c7             	mov    %rax,%rdi
+  802757:	b8 00 00 00 00       	mov    $0x0,%eax
+  80275c:	49 b9 e5 05 80 00 00 	movabs $0x8005e5,%r9
+  802763:	00 00 00 
+  802766:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802769:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80276e:	75 13                	jne    802783 <sys_env_wait+0x82>
+  802770:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802775:	74 0c                	je     802783 <sys_env_wait+0x82>
+    *status = st;
+  802777:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80277b:	89 c2                	mov    %eax,%edx
+  80277d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802781:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802783:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802787:	c9                   	leave
+  802788:	c3                   	ret
+
+0000000000802789 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802789:	55                   	push   %rbp
+  80278a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80278d:	48 83 ec 08          	sub    $0x8,%rsp
+  802791:	6a 00                	push   $0x0
+  802793:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802799:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80279f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ae:	bf 02 00 00 00       	mov    $0x2,%edi
+  8027b3:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  8027ba:	00 00 00 
+  8027bd:	ff d0                	call   *%rax
+  8027bf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027c3:	c9                   	leave
+  8027c4:	c3                   	ret
+
+00000000008027c5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8027c5:	55                   	push   %rbp
+  8027c6:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8027c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027cd:	6a 00                	push   $0x0
+  8027cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ea:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8027ef:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  8027f6:	00 00 00 
+  8027f9:	ff d0                	call   *%rax
+  8027fb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027ff:	90                   	nop
+  802800:	c9                   	leave
+  802801:	c3                   	ret
+
+0000000000802802 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+  802806:	48 83 ec 20          	sub    $0x20,%rsp
+  80280a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80280d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802811:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802814:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802817:	48 63 c8             	movslq %eax,%rcx
+  80281a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80281e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802821:	48 98                	cltq
+  802823:	48 83 ec 08          	sub    $0x8,%rsp
+  802827:	6a 00                	push   $0x0
+  802829:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80282f:	49 89 c8             	mov    %rcx,%r8
+  802832:	48 89 d1             	mov    %rdx,%rcx
+  802835:	48 89 c2             	mov    %rax,%rdx
+  802838:	be 01 00 00 00       	mov    $0x1,%esi
+  80283d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802842:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802849:	00 00 00 
+  80284c:	ff d0                	call   *%rax
+  80284e:	48 83 c4 10          	add    $0x10,%rsp
+  802852:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802855:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802858:	c9                   	leave
+  802859:	c3                   	ret
+
+000000000080285a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80285a:	55                   	push   %rbp
+  80285b:	48 89 e5             	mov    %rsp,%rbp
+  80285e:	48 83 ec 20          	sub    $0x20,%rsp
+  802862:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802865:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802869:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80286c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802870:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802874:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802877:	48 63 c8             	movslq %eax,%rcx
+  80287a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80287e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802881:	48 63 f0             	movslq %eax,%rsi
+  802884:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802888:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80288b:	48 98                	cltq
+  80288d:	48 83 ec 08          	sub    $0x8,%rsp
+  802891:	51                   	push   %rcx
+  802892:	49 89 f9             	mov    %rdi,%r9
+  802895:	49 89 f0             	mov    %rsi,%r8
+  802898:	48 89 d1             	mov    %rdx,%rcx
+  80289b:	48 89 c2             	mov    %rax,%rdx
+  80289e:	be 01 00 00 00       	mov    $0x1,%esi
+  8028a3:	bf 07 00 00 00       	mov    $0x7,%edi
+  8028a8:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  8028af:	00 00 00 
+  8028b2:	ff d0                	call   *%rax
+  8028b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+
+00000000008028ba <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8028ba:	55                   	push   %rbp
+  8028bb:	48 89 e5             	mov    %rsp,%rbp
+  8028be:	48 83 ec 10          	sub    $0x10,%rsp
+  8028c2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8028c5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8028c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028d0:	48 98                	cltq
+  8028d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8028d6:	6a 00                	push   $0x0
+  8028d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028e4:	48 89 d1             	mov    %rdx,%rcx
+  8028e7:	48 89 c2             	mov    %rax,%rdx
+  8028ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ef:	bf 08 00 00 00       	mov    $0x8,%edi
+  8028f4:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  8028fb:	00 00 00 
+  8028fe:	ff d0                	call   *%rax
+  802900:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802904:	c9                   	leave
+  802905:	c3                   	ret
+
+0000000000802906 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802906:	55                   	push   %rbp
+  802907:	48 89 e5             	mov    %rsp,%rbp
+  80290a:	48 83 ec 10          	sub    $0x10,%rsp
+  80290e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802911:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802914:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802917:	48 63 d0             	movslq %eax,%rdx
+  80291a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80291d:	48 98                	cltq
+  80291f:	48 83 ec 08          	sub    $0x8,%rsp
+  802923:	6a 00                	push   $0x0
+  802925:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80292b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802931:	48 89 d1             	mov    %rdx,%rcx
+  802934:	48 89 c2             	mov    %rax,%rdx
+  802937:	be 01 00 00 00       	mov    $0x1,%esi
+  80293c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802941:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802948:	00 00 00 
+  80294b:	ff d0                	call   *%rax
+  80294d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802951:	c9                   	leave
+  802952:	c3                   	ret
+
+0000000000802953 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802953:	55                   	push   %rbp
+  802954:	48 89 e5             	mov    %rsp,%rbp
+  802957:	48 83 ec 10          	sub    $0x10,%rsp
+  80295b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80295e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802962:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802966:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802969:	48 98                	cltq
+  80296b:	48 83 ec 08          	sub    $0x8,%rsp
+  80296f:	6a 00                	push   $0x0
+  802971:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802977:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80297d:	48 89 d1             	mov    %rdx,%rcx
+  802980:	48 89 c2             	mov    %rax,%rdx
+  802983:	be 01 00 00 00       	mov    $0x1,%esi
+  802988:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80298d:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802994:	00 00 00 
+  802997:	ff d0                	call   *%rax
+  802999:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80299d:	c9                   	leave
+  80299e:	c3                   	ret
+
+000000000080299f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80299f:	55                   	push   %rbp
+  8029a0:	48 89 e5             	mov    %rsp,%rbp
+  8029a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8029a7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029aa:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8029ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029b5:	48 98                	cltq
+  8029b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029bb:	6a 00                	push   $0x0
+  8029bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029c9:	48 89 d1             	mov    %rdx,%rcx
+  8029cc:	48 89 c2             	mov    %rax,%rdx
+  8029cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8029d4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8029d9:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  8029e0:	00 00 00 
+  8029e3:	ff d0                	call   *%rax
+  8029e5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e9:	c9                   	leave
+  8029ea:	c3                   	ret
+
+00000000008029eb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8029eb:	55                   	push   %rbp
+  8029ec:	48 89 e5             	mov    %rsp,%rbp
+  8029ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8029f3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029fa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8029fe:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802a01:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802a04:	48 63 f0             	movslq %eax,%rsi
+  802a07:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802a0b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a12:	48 98                	cltq
+  802a14:	48 83 ec 08          	sub    $0x8,%rsp
+  802a18:	6a 00                	push   $0x0
+  802a1a:	49 89 f1             	mov    %rsi,%r9
+  802a1d:	49 89 c8             	mov    %rcx,%r8
+  802a20:	48 89 d1             	mov    %rdx,%rcx
+  802a23:	48 89 c2             	mov    %rax,%rdx
+  802a26:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802a30:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802a37:	00 00 00 
+  802a3a:	ff d0                	call   *%rax
+  802a3c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a40:	c9                   	leave
+  802a41:	c3                   	ret
+
+0000000000802a42 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802a42:	55                   	push   %rbp
+  802a43:	48 89 e5             	mov    %rsp,%rbp
+  802a46:	48 83 ec 10          	sub    $0x10,%rsp
+  802a4a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802a4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a52:	48 83 ec 08          	sub    $0x8,%rsp
+  802a56:	6a 00                	push   $0x0
+  802a58:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a69:	48 89 c2             	mov    %rax,%rdx
+  802a6c:	be 01 00 00 00       	mov    $0x1,%esi
+  802a71:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802a76:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802a7d:	00 00 00 
+  802a80:	ff d0                	call   *%rax
+  802a82:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a86:	c9                   	leave
+  802a87:	c3                   	ret
+
+0000000000802a88 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802a88:	55                   	push   %rbp
+  802a89:	48 89 e5             	mov    %rsp,%rbp
+  802a8c:	48 83 ec 10          	sub    $0x10,%rsp
+  802a90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a94:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802a98:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802aa0:	48 83 ec 08          	sub    $0x8,%rsp
+  802aa4:	6a 00                	push   $0x0
+  802aa6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802aac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ab2:	48 89 d1             	mov    %rdx,%rcx
+  802ab5:	48 89 c2             	mov    %rax,%rdx
+  802ab8:	be 01 00 00 00       	mov    $0x1,%esi
+  802abd:	bf 10 00 00 00       	mov    $0x10,%edi
+  802ac2:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802ac9:	00 00 00 
+  802acc:	ff d0                	call   *%rax
+  802ace:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ad2:	c9                   	leave
+  802ad3:	c3                   	ret
+
+0000000000802ad4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802ad4:	55                   	push   %rbp
+  802ad5:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802ad8:	48 83 ec 08          	sub    $0x8,%rsp
+  802adc:	6a 00                	push   $0x0
+  802ade:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ae4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aef:	ba 00 00 00 00       	mov    $0x0,%edx
+  802af4:	be 00 00 00 00       	mov    $0x0,%esi
+  802af9:	bf 11 00 00 00       	mov    $0x11,%edi
+  802afe:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+  802b0a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b0e:	c9                   	leave
+  802b0f:	c3                   	ret
+
+0000000000802b10 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802b10:	55                   	push   %rbp
+  802b11:	48 89 e5             	mov    %rsp,%rbp
+  802b14:	48 83 ec 10          	sub    $0x10,%rsp
+  802b18:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b1c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802b20:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b28:	48 83 ec 08          	sub    $0x8,%rsp
+  802b2c:	6a 00                	push   $0x0
+  802b2e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b34:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b3a:	48 89 d1             	mov    %rdx,%rcx
+  802b3d:	48 89 c2             	mov    %rax,%rdx
+  802b40:	be 00 00 00 00       	mov    $0x0,%esi
+  802b45:	bf 12 00 00 00       	mov    $0x12,%edi
+  802b4a:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802b51:	00 00 00 
+  802b54:	ff d0                	call   *%rax
+  802b56:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b5a:	c9                   	leave
+  802b5b:	c3                   	ret
+
+0000000000802b5c <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802b5c:	55                   	push   %rbp
+  802b5d:	48 89 e5             	mov    %rsp,%rbp
+  802b60:	48 83 ec 20          	sub    $0x20,%rsp
+  802b64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b68:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b6c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802b6f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b72:	48 63 c8             	movslq %eax,%rcx
+  802b75:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b7d:	48 83 ec 08          	sub    $0x8,%rsp
+  802b81:	6a 00                	push   $0x0
+  802b83:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b89:	49 89 c8             	mov    %rcx,%r8
+  802b8c:	48 89 d1             	mov    %rdx,%rcx
+  802b8f:	48 89 c2             	mov    %rax,%rdx
+  802b92:	be 00 00 00 00       	mov    $0x0,%esi
+  802b97:	bf 13 00 00 00       	mov    $0x13,%edi
+  802b9c:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802ba3:	00 00 00 
+  802ba6:	ff d0                	call   *%rax
+  802ba8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bac:	c9                   	leave
+  802bad:	c3                   	ret
+
+0000000000802bae <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802bae:	55                   	push   %rbp
+  802baf:	48 89 e5             	mov    %rsp,%rbp
+  802bb2:	48 83 ec 20          	sub    $0x20,%rsp
+  802bb6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802bba:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802bbd:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802bc1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802bc5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802bc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bcc:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd0:	6a 00                	push   $0x0
+  802bd2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bd8:	49 89 c8             	mov    %rcx,%r8
+  802bdb:	48 89 d1             	mov    %rdx,%rcx
+  802bde:	48 89 c2             	mov    %rax,%rdx
+  802be1:	be 00 00 00 00       	mov    $0x0,%esi
+  802be6:	bf 14 00 00 00       	mov    $0x14,%edi
+  802beb:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802bf2:	00 00 00 
+  802bf5:	ff d0                	call   *%rax
+  802bf7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bfb:	c9                   	leave
+  802bfc:	c3                   	ret
+
+0000000000802bfd <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+  802c01:	48 83 ec 10          	sub    $0x10,%rsp
+  802c05:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c09:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802c0c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802c0f:	48 63 d0             	movslq %eax,%rdx
+  802c12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c16:	48 83 ec 08          	sub    $0x8,%rsp
+  802c1a:	6a 00                	push   $0x0
+  802c1c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c22:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c28:	48 89 d1             	mov    %rdx,%rcx
+  802c2b:	48 89 c2             	mov    %rax,%rdx
+  802c2e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c33:	bf 15 00 00 00       	mov    $0x15,%edi
+  802c38:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802c3f:	00 00 00 
+  802c42:	ff d0                	call   *%rax
+  802c44:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c48:	c9                   	leave
+  802c49:	c3                   	ret
+
+0000000000802c4a <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802c4a:	55                   	push   %rbp
+  802c4b:	48 89 e5             	mov    %rsp,%rbp
+  802c4e:	48 83 ec 20          	sub    $0x20,%rsp
+  802c52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c56:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802c59:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802c5c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802c60:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802c64:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802c67:	48 63 c8             	movslq %eax,%rcx
+  802c6a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802c6d:	48 63 d0             	movslq %eax,%rdx
+  802c70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c74:	48 83 ec 08          	sub    $0x8,%rsp
+  802c78:	6a 00                	push   $0x0
+  802c7a:	49 89 f1             	mov    %rsi,%r9
+  802c7d:	49 89 c8             	mov    %rcx,%r8
+  802c80:	48 89 d1             	mov    %rdx,%rcx
+  802c83:	48 89 c2             	mov    %rax,%rdx
+  802c86:	be 00 00 00 00       	mov    $0x0,%esi
+  802c8b:	bf 16 00 00 00       	mov    $0x16,%edi
+  802c90:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802c97:	00 00 00 
+  802c9a:	ff d0                	call   *%rax
+  802c9c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ca0:	c9                   	leave
+  802ca1:	c3                   	ret
+
+0000000000802ca2 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802ca2:	55                   	push   %rbp
+  802ca3:	48 89 e5             	mov    %rsp,%rbp
+  802ca6:	48 83 ec 30          	sub    $0x30,%rsp
+  802caa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802cae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802cb2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802cb6:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802cba:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802cbe:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802cc2:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802cc6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802cca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802cce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cd2:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd6:	51                   	push   %rcx
+  802cd7:	49 89 f9             	mov    %rdi,%r9
+  802cda:	49 89 f0             	mov    %rsi,%r8
+  802cdd:	48 89 d1             	mov    %rdx,%rcx
+  802ce0:	48 89 c2             	mov    %rax,%rdx
+  802ce3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ce8:	bf 17 00 00 00       	mov    $0x17,%edi
+  802ced:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802cf4:	00 00 00 
+  802cf7:	ff d0                	call   *%rax
+  802cf9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cfd:	c9                   	leave
+  802cfe:	c3                   	ret
+
+0000000000802cff <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802cff:	55                   	push   %rbp
+  802d00:	48 89 e5             	mov    %rsp,%rbp
+  802d03:	48 83 ec 10          	sub    $0x10,%rsp
+  802d07:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802d0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d0d:	48 98                	cltq
+  802d0f:	48 83 ec 08          	sub    $0x8,%rsp
+  802d13:	6a 00                	push   $0x0
+  802d15:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d1b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d21:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d26:	48 89 c2             	mov    %rax,%rdx
+  802d29:	be 00 00 00 00       	mov    $0x0,%esi
+  802d2e:	bf 18 00 00 00       	mov    $0x18,%edi
+  802d33:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802d3a:	00 00 00 
+  802d3d:	ff d0                	call   *%rax
+  802d3f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d43:	90                   	nop
+  802d44:	c9                   	leave
+  802d45:	c3                   	ret
+
+0000000000802d46 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802d46:	55                   	push   %rbp
+  802d47:	48 89 e5             	mov    %rsp,%rbp
+  802d4a:	48 83 ec 30          	sub    $0x30,%rsp
+  802d4e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d51:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802d55:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802d59:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802d5c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802d5f:	48 63 f0             	movslq %eax,%rsi
+  802d62:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802d66:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802d6a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d6d:	48 98                	cltq
+  802d6f:	48 83 ec 08          	sub    $0x8,%rsp
+  802d73:	6a 00                	push   $0x0
+  802d75:	49 89 f1             	mov    %rsi,%r9
+  802d78:	49 89 c8             	mov    %rcx,%r8
+  802d7b:	48 89 d1             	mov    %rdx,%rcx
+  802d7e:	48 89 c2             	mov    %rax,%rdx
+  802d81:	be 01 00 00 00       	mov    $0x1,%esi
+  802d86:	bf 19 00 00 00       	mov    $0x19,%edi
+  802d8b:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802d92:	00 00 00 
+  802d95:	ff d0                	call   *%rax
+  802d97:	48 83 c4 10          	add    $0x10,%rsp
+  802d9b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802d9e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802da1:	c9                   	leave
+  802da2:	c3                   	ret
+
+0000000000802da3 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802da3:	55                   	push   %rbp
+  802da4:	48 89 e5             	mov    %rsp,%rbp
+  802da7:	48 83 ec 20          	sub    $0x20,%rsp
+  802dab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802daf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802db3:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802db6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802db9:	48 63 c8             	movslq %eax,%rcx
+  802dbc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802dc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802dc4:	48 83 ec 08          	sub    $0x8,%rsp
+  802dc8:	6a 00                	push   $0x0
+  802dca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802dd0:	49 89 c8             	mov    %rcx,%r8
+  802dd3:	48 89 d1             	mov    %rdx,%rcx
+  802dd6:	48 89 c2             	mov    %rax,%rdx
+  802dd9:	be 01 00 00 00       	mov    $0x1,%esi
+  802dde:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802de3:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802dea:	00 00 00 
+  802ded:	ff d0                	call   *%rax
+  802def:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802df3:	c9                   	leave
+  802df4:	c3                   	ret
+
+0000000000802df5 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802df5:	55                   	push   %rbp
+  802df6:	48 89 e5             	mov    %rsp,%rbp
+  802df9:	48 83 ec 20          	sub    $0x20,%rsp
+  802dfd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e01:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802e05:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802e09:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802e0d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802e11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e15:	48 83 ec 08          	sub    $0x8,%rsp
+  802e19:	6a 00                	push   $0x0
+  802e1b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e21:	49 89 c8             	mov    %rcx,%r8
+  802e24:	48 89 d1             	mov    %rdx,%rcx
+  802e27:	48 89 c2             	mov    %rax,%rdx
+  802e2a:	be 01 00 00 00       	mov    $0x1,%esi
+  802e2f:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802e34:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+  802e40:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e44:	c9                   	leave
+  802e45:	c3                   	ret
+
+0000000000802e46 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802e46:	55                   	push   %rbp
+  802e47:	48 89 e5             	mov    %rsp,%rbp
+  802e4a:	48 83 ec 30          	sub    $0x30,%rsp
+  802e4e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802e52:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e56:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802e59:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802e5d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802e61:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e64:	48 63 c8             	movslq %eax,%rcx
+  802e67:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e6f:	48 83 ec 08          	sub    $0x8,%rsp
+  802e73:	6a 00                	push   $0x0
+  802e75:	49 89 f1             	mov    %rsi,%r9
+  802e78:	49 89 c8             	mov    %rcx,%r8
+  802e7b:	48 89 d1             	mov    %rdx,%rcx
+  802e7e:	48 89 c2             	mov    %rax,%rdx
+  802e81:	be 01 00 00 00       	mov    $0x1,%esi
+  802e86:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802e8b:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802e92:	00 00 00 
+  802e95:	ff d0                	call   *%rax
+  802e97:	48 83 c4 10          	add    $0x10,%rsp
+  802e9b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802e9e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ea1:	c9                   	leave
+  802ea2:	c3                   	ret
+
+0000000000802ea3 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802ea3:	55                   	push   %rbp
+  802ea4:	48 89 e5             	mov    %rsp,%rbp
+  802ea7:	48 83 ec 10          	sub    $0x10,%rsp
+  802eab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802eae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802eb1:	48 98                	cltq
+  802eb3:	48 83 ec 08          	sub    $0x8,%rsp
+  802eb7:	6a 00                	push   $0x0
+  802eb9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ebf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802ec5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eca:	48 89 c2             	mov    %rax,%rdx
+  802ecd:	be 01 00 00 00       	mov    $0x1,%esi
+  802ed2:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802ed7:	48 b8 52 25 80 00 00 	movabs $0x802552,%rax
+  802ede:	00 00 00 
+  802ee1:	ff d0                	call   *%rax
+  802ee3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ee7:	c9                   	leave
+  802ee8:	c3                   	ret
+
+0000000000802ee9 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802ee9:	55                   	push   %rbp
+  802eea:	48 89 e5             	mov    %rsp,%rbp
+  802eed:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802ef5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ef9:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802f00:	ff ff ff 
+  802f03:	48 01 d0             	add    %rdx,%rax
+  802f06:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802f0a:	c9                   	leave
+  802f0b:	c3                   	ret
+
+0000000000802f0c <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802f0c:	55                   	push   %rbp
+  802f0d:	48 89 e5             	mov    %rsp,%rbp
+  802f10:	48 83 ec 08          	sub    $0x8,%rsp
+  802f14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802f18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f1c:	48 89 c7             	mov    %rax,%rdi
+  802f1f:	48 b8 e9 2e 80 00 00 	movabs $0x802ee9,%rax
+  802f26:	00 00 00 
+  802f29:	ff d0                	call   *%rax
+  802f2b:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802f31:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802f35:	c9                   	leave
+  802f36:	c3                   	ret
+
+0000000000802f37 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802f37:	55                   	push   %rbp
+  802f38:	48 89 e5             	mov    %rsp,%rbp
+  802f3b:	48 83 ec 18          	sub    $0x18,%rsp
+  802f3f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802f43:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802f4a:	e9 ae 00 00 00       	jmp    802ffd <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802f4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f52:	c1 e0 0c             	shl    $0xc,%eax
+  802f55:	48 98                	cltq
+  802f57:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802f5c:	48 01 d0             	add    %rdx,%rax
+  802f5f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802f63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f67:	48 c1 e8 27          	shr    $0x27,%rax
+  802f6b:	48 89 c2             	mov    %rax,%rdx
+  802f6e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f75:	01 00 00 
+  802f78:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f7c:	83 e0 01             	and    $0x1,%eax
+  802f7f:	48 85 c0             	test   %rax,%rax
+  802f82:	74 63                	je     802fe7 <fd_alloc+0xb0>
+  802f84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f88:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f8c:	48 89 c2             	mov    %rax,%rdx
+  802f8f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f96:	01 00 00 
+  802f99:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f9d:	83 e0 01             	and    $0x1,%eax
+  802fa0:	48 85 c0             	test   %rax,%rax
+  802fa3:	74 42                	je     802fe7 <fd_alloc+0xb0>
+  802fa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fa9:	48 c1 e8 15          	shr    $0x15,%rax
+  802fad:	48 89 c2             	mov    %rax,%rdx
+  802fb0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802fb7:	01 00 00 
+  802fba:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fbe:	83 e0 01             	and    $0x1,%eax
+  802fc1:	48 85 c0             	test   %rax,%rax
+  802fc4:	74 21                	je     802fe7 <fd_alloc+0xb0>
+  802fc6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fca:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fce:	48 89 c2             	mov    %rax,%rdx
+  802fd1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802fd8:	01 00 00 
+  802fdb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fdf:	83 e0 01             	and    $0x1,%eax
+  802fe2:	48 85 c0             	test   %rax,%rax
+  802fe5:	75 12                	jne    802ff9 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802fe7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802feb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802fef:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802ff2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff7:	eb 1e                	jmp    803017 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802ff9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802ffd:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803001:	0f 8e 48 ff ff ff    	jle    802f4f <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803007:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80300b:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  803012:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803017:	c9                   	leave
+  803018:	c3                   	ret
+
+0000000000803019 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803019:	55                   	push   %rbp
+  80301a:	48 89 e5             	mov    %rsp,%rbp
+  80301d:	48 83 ec 20          	sub    $0x20,%rsp
+  803021:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803024:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803028:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80302c:	78 06                	js     803034 <fd_lookup+0x1b>
+  80302e:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803032:	7e 0a                	jle    80303e <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803034:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803039:	e9 af 00 00 00       	jmp    8030ed <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80303e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803041:	c1 e0 0c             	shl    $0xc,%eax
+  803044:	48 98                	cltq
+  803046:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80304b:	48 01 d0             	add    %rdx,%rax
+  80304e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803052:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803056:	48 c1 e8 27          	shr    $0x27,%rax
+  80305a:	48 89 c2             	mov    %rax,%rdx
+  80305d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803064:	01 00 00 
+  803067:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80306b:	83 e0 01             	and    $0x1,%eax
+  80306e:	48 85 c0             	test   %rax,%rax
+  803071:	74 63                	je     8030d6 <fd_lookup+0xbd>
+  803073:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803077:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80307b:	48 89 c2             	mov    %rax,%rdx
+  80307e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803085:	01 00 00 
+  803088:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80308c:	83 e0 01             	and    $0x1,%eax
+  80308f:	48 85 c0             	test   %rax,%rax
+  803092:	74 42                	je     8030d6 <fd_lookup+0xbd>
+  803094:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803098:	48 c1 e8 15          	shr    $0x15,%rax
+  80309c:	48 89 c2             	mov    %rax,%rdx
+  80309f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8030a6:	01 00 00 
+  8030a9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030ad:	83 e0 01             	and    $0x1,%eax
+  8030b0:	48 85 c0             	test   %rax,%rax
+  8030b3:	74 21                	je     8030d6 <fd_lookup+0xbd>
+  8030b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030b9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030bd:	48 89 c2             	mov    %rax,%rdx
+  8030c0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8030c7:	01 00 00 
+  8030ca:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030ce:	83 e0 01             	and    $0x1,%eax
+  8030d1:	48 85 c0             	test   %rax,%rax
+  8030d4:	75 07                	jne    8030dd <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8030d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030db:	eb 10                	jmp    8030ed <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8030dd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8030e5:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8030e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ed:	c9                   	leave
+  8030ee:	c3                   	ret
+
+00000000008030ef <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8030ef:	55                   	push   %rbp
+  8030f0:	48 89 e5             	mov    %rsp,%rbp
+  8030f3:	48 83 ec 30          	sub    $0x30,%rsp
+  8030f7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8030fb:	89 f0                	mov    %esi,%eax
+  8030fd:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803100:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803104:	48 89 c7             	mov    %rax,%rdi
+  803107:	48 b8 e9 2e 80 00 00 	movabs $0x802ee9,%rax
+  80310e:	00 00 00 
+  803111:	ff d0                	call   *%rax
+  803113:	89 c2                	mov    %eax,%edx
+  803115:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803119:	48 89 c6             	mov    %rax,%rsi
+  80311c:	89 d7                	mov    %edx,%edi
+  80311e:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  803125:	00 00 00 
+  803128:	ff d0                	call   *%rax
+  80312a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80312d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803131:	78 0a                	js     80313d <fd_close+0x4e>
+  803133:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803137:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80313b:	74 12                	je     80314f <fd_close+0x60>
+    return (must_exist ? r : 0);
+  80313d:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803141:	74 05                	je     803148 <fd_close+0x59>
+  803143:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803146:	eb 70                	jmp    8031b8 <fd_close+0xc9>
+  803148:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314d:	eb 69                	jmp    8031b8 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80314f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803153:	8b 00                	mov    (%rax),%eax
+  803155:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803159:	48 89 d6             	mov    %rdx,%rsi
+  80315c:	89 c7                	mov    %eax,%edi
+  80315e:	48 b8 ba 31 80 00 00 	movabs $0x8031ba,%rax
+  803165:	00 00 00 
+  803168:	ff d0                	call   *%rax
+  80316a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80316d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803171:	78 2a                	js     80319d <fd_close+0xae>
+    if (dev->dev_close)
+  803173:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803177:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80317b:	48 85 c0             	test   %rax,%rax
+  80317e:	74 16                	je     803196 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803180:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803184:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803188:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80318c:	48 89 c7             	mov    %rax,%rdi
+  80318f:	ff d2                	call   *%rdx
+  803191:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803194:	eb 07                	jmp    80319d <fd_close+0xae>
+    else
+      r = 0;
+  803196:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80319d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031a1:	48 89 c6             	mov    %rax,%rsi
+  8031a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a9:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  8031b0:	00 00 00 
+  8031b3:	ff d0                	call   *%rax
+  return r;
+  8031b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8031b8:	c9                   	leave
+  8031b9:	c3                   	ret
+
+00000000008031ba <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8031ba:	55                   	push   %rbp
+  8031bb:	48 89 e5             	mov    %rsp,%rbp
+  8031be:	48 83 ec 20          	sub    $0x20,%rsp
+  8031c2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8031c5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8031c9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8031d0:	eb 3f                	jmp    803211 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8031d2:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  8031d9:	00 00 00 
+  8031dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031df:	48 98                	cltq
+  8031e1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8031e5:	8b 00                	mov    (%rax),%eax
+  8031e7:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8031ea:	75 21                	jne    80320d <dev_lookup+0x53>
+      *dev = devtab[i];
+  8031ec:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  8031f3:	00 00 00 
+  8031f6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031f9:	48 98                	cltq
+  8031fb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8031ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803203:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803206:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320b:	eb 7f                	jmp    80328c <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  80320d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803211:	48 ba 60 60 80 00 00 	movabs $0x806060,%rdx
+  803218:	00 00 00 
+  80321b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80321e:	48 98                	cltq
+  803220:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803224:	48 85 c0             	test   %rax,%rax
+  803227:	75 a9                	jne    8031d2 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803229:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803230:	00 00 00 
+  803233:	8b 40 04             	mov    0x4(%rax),%eax
+  803236:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80323b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803242:	00 00 00 
+  803245:	48 98                	cltq
+  803247:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80324e:	48 01 d0             	add    %rdx,%rax
+  803251:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803257:	8b 00                	mov    (%rax),%eax
+  803259:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80325c:	89 c6                	mov    %eax,%esi
+  80325e:	48 b8 d0 5c 80 00 00 	movabs $0x805cd0,%rax
+  803265:	00 00 00 
+  803268:	48 89 c7             	mov    %rax,%rdi
+  80326b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803270:	48 b9 04 08 80 00 00 	movabs $0x800804,%rcx
+  803277:	00 00 00 
+  80327a:	ff d1                	call   *%rcx
+  *dev = 0;
+  80327c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803280:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803287:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80328c:	c9                   	leave
+  80328d:	c3                   	ret
+
+000000000080328e <close>:
+
+int
+close(int fdnum) {
+  80328e:	55                   	push   %rbp
+  80328f:	48 89 e5             	mov    %rsp,%rbp
+  803292:	48 83 ec 20          	sub    $0x20,%rsp
+  803296:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803299:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80329d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032a0:	48 89 d6             	mov    %rdx,%rsi
+  8032a3:	89 c7                	mov    %eax,%edi
+  8032a5:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  8032ac:	00 00 00 
+  8032af:	ff d0                	call   *%rax
+  8032b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032b8:	79 05                	jns    8032bf <close+0x31>
+    return r;
+  8032ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032bd:	eb 18                	jmp    8032d7 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  8032bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032c3:	be 01 00 00 00       	mov    $0x1,%esi
+  8032c8:	48 89 c7             	mov    %rax,%rdi
+  8032cb:	48 b8 ef 30 80 00 00 	movabs $0x8030ef,%rax
+  8032d2:	00 00 00 
+  8032d5:	ff d0                	call   *%rax
+}
+  8032d7:	c9                   	leave
+  8032d8:	c3                   	ret
+
+00000000008032d9 <close_all>:
+
+void
+close_all(void) {
+  8032d9:	55                   	push   %rbp
+  8032da:	48 89 e5             	mov    %rsp,%rbp
+  8032dd:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8032e1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032e8:	eb 15                	jmp    8032ff <close_all+0x26>
+    close(i);
+  8032ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032ed:	89 c7                	mov    %eax,%edi
+  8032ef:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  8032f6:	00 00 00 
+  8032f9:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  8032fb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8032ff:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803303:	7e e5                	jle    8032ea <close_all+0x11>
+}
+  803305:	90                   	nop
+  803306:	90                   	nop
+  803307:	c9                   	leave
+  803308:	c3                   	ret
+
+0000000000803309 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803309:	55                   	push   %rbp
+  80330a:	48 89 e5             	mov    %rsp,%rbp
+  80330d:	48 83 ec 40          	sub    $0x40,%rsp
+  803311:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803314:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803317:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  80331b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80331e:	48 89 d6             	mov    %rdx,%rsi
+  803321:	89 c7                	mov    %eax,%edi
+  803323:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  80332a:	00 00 00 
+  80332d:	ff d0                	call   *%rax
+  80332f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803332:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803336:	79 08                	jns    803340 <dup+0x37>
+    return r;
+  803338:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80333b:	e9 33 02 00 00       	jmp    803573 <dup+0x26a>
+  close(newfdnum);
+  803340:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803343:	89 c7                	mov    %eax,%edi
+  803345:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  80334c:	00 00 00 
+  80334f:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803351:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803354:	c1 e0 0c             	shl    $0xc,%eax
+  803357:	48 98                	cltq
+  803359:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80335e:	48 01 d0             	add    %rdx,%rax
+  803361:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803365:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803369:	48 89 c7             	mov    %rax,%rdi
+  80336c:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  803373:	00 00 00 
+  803376:	ff d0                	call   *%rax
+  803378:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  80337c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803380:	48 89 c7             	mov    %rax,%rdi
+  803383:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  80338a:	00 00 00 
+  80338d:	ff d0                	call   *%rax
+  80338f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803393:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  80339a:	00 
+  80339b:	e9 19 01 00 00       	jmp    8034b9 <dup+0x1b0>
+    off -= PGSIZE;
+  8033a0:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8033a7:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8033a8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033b0:	48 01 d0             	add    %rdx,%rax
+  8033b3:	48 c1 e8 27          	shr    $0x27,%rax
+  8033b7:	48 89 c2             	mov    %rax,%rdx
+  8033ba:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8033c1:	01 00 00 
+  8033c4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033c8:	83 e0 01             	and    $0x1,%eax
+  8033cb:	48 85 c0             	test   %rax,%rax
+  8033ce:	0f 84 e5 00 00 00    	je     8034b9 <dup+0x1b0>
+  8033d4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033dc:	48 01 d0             	add    %rdx,%rax
+  8033df:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033e3:	48 89 c2             	mov    %rax,%rdx
+  8033e6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8033ed:	01 00 00 
+  8033f0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f4:	83 e0 01             	and    $0x1,%eax
+  8033f7:	48 85 c0             	test   %rax,%rax
+  8033fa:	0f 84 b9 00 00 00    	je     8034b9 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803400:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803404:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803408:	48 01 d0             	add    %rdx,%rax
+  80340b:	48 c1 e8 15          	shr    $0x15,%rax
+  80340f:	48 89 c2             	mov    %rax,%rdx
+  803412:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803419:	01 00 00 
+  80341c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803420:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803423:	48 85 c0             	test   %rax,%rax
+  803426:	0f 84 8d 00 00 00    	je     8034b9 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80342c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803430:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803434:	48 01 d0             	add    %rdx,%rax
+  803437:	48 c1 e8 0c          	shr    $0xc,%rax
+  80343b:	48 89 c2             	mov    %rax,%rdx
+  80343e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803445:	01 00 00 
+  803448:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80344c:	83 e0 01             	and    $0x1,%eax
+  80344f:	48 85 c0             	test   %rax,%rax
+  803452:	74 65                	je     8034b9 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803454:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803458:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80345c:	48 01 d0             	add    %rdx,%rax
+  80345f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803463:	48 89 c2             	mov    %rax,%rdx
+  803466:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80346d:	01 00 00 
+  803470:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803474:	25 07 0e 00 00       	and    $0xe07,%eax
+  803479:	89 c6                	mov    %eax,%esi
+  80347b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80347f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803483:	48 01 c2             	add    %rax,%rdx
+  803486:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80348a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80348e:	48 01 c8             	add    %rcx,%rax
+  803491:	41 89 f0             	mov    %esi,%r8d
+  803494:	48 89 d1             	mov    %rdx,%rcx
+  803497:	ba 00 00 00 00       	mov    $0x0,%edx
+  80349c:	48 89 c6             	mov    %rax,%rsi
+  80349f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034a4:	48 b8 5a 28 80 00 00 	movabs $0x80285a,%rax
+  8034ab:	00 00 00 
+  8034ae:	ff d0                	call   *%rax
+  8034b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034b7:	78 60                	js     803519 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  8034b9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8034be:	0f 85 dc fe ff ff    	jne    8033a0 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8034c4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034c8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034cc:	48 89 c2             	mov    %rax,%rdx
+  8034cf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034d6:	01 00 00 
+  8034d9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8034e2:	89 c1                	mov    %eax,%ecx
+  8034e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8034e8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8034ec:	41 89 c8             	mov    %ecx,%r8d
+  8034ef:	48 89 d1             	mov    %rdx,%rcx
+  8034f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034f7:	48 89 c6             	mov    %rax,%rsi
+  8034fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ff:	48 b8 5a 28 80 00 00 	movabs $0x80285a,%rax
+  803506:	00 00 00 
+  803509:	ff d0                	call   *%rax
+  80350b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80350e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803512:	78 08                	js     80351c <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803514:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803517:	eb 5a                	jmp    803573 <dup+0x26a>
+        goto err;
+  803519:	90                   	nop
+  80351a:	eb 01                	jmp    80351d <dup+0x214>
+    goto err;
+  80351c:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  80351d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803521:	48 89 c6             	mov    %rax,%rsi
+  803524:	bf 00 00 00 00       	mov    $0x0,%edi
+  803529:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  803530:	00 00 00 
+  803533:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803535:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80353c:	00 
+  80353d:	eb 27                	jmp    803566 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80353f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803543:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803547:	48 01 d0             	add    %rdx,%rax
+  80354a:	48 89 c6             	mov    %rax,%rsi
+  80354d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803552:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  803559:	00 00 00 
+  80355c:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80355e:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803565:	00 
+  803566:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80356d:	00 
+  80356e:	76 cf                	jbe    80353f <dup+0x236>
+  return r;
+  803570:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803573:	c9                   	leave
+  803574:	c3                   	ret
+
+0000000000803575 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803575:	55                   	push   %rbp
+  803576:	48 89 e5             	mov    %rsp,%rbp
+  803579:	48 83 ec 40          	sub    $0x40,%rsp
+  80357d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803580:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803584:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803588:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80358c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80358f:	48 89 d6             	mov    %rdx,%rsi
+  803592:	89 c7                	mov    %eax,%edi
+  803594:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  80359b:	00 00 00 
+  80359e:	ff d0                	call   *%rax
+  8035a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035a3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035a7:	78 24                	js     8035cd <read+0x58>
+  8035a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035ad:	8b 00                	mov    (%rax),%eax
+  8035af:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8035b3:	48 89 d6             	mov    %rdx,%rsi
+  8035b6:	89 c7                	mov    %eax,%edi
+  8035b8:	48 b8 ba 31 80 00 00 	movabs $0x8031ba,%rax
+  8035bf:	00 00 00 
+  8035c2:	ff d0                	call   *%rax
+  8035c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035cb:	79 0a                	jns    8035d7 <read+0x62>
+    return r;
+  8035cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035d0:	48 98                	cltq
+  8035d2:	e9 9e 00 00 00       	jmp    803675 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8035d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035db:	8b 40 08             	mov    0x8(%rax),%eax
+  8035de:	83 e0 03             	and    $0x3,%eax
+  8035e1:	83 f8 01             	cmp    $0x1,%eax
+  8035e4:	75 5c                	jne    803642 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8035e6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8035ed:	00 00 00 
+  8035f0:	8b 40 04             	mov    0x4(%rax),%eax
+  8035f3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8035f8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8035ff:	00 00 00 
+  803602:	48 98                	cltq
+  803604:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80360b:	48 01 d0             	add    %rdx,%rax
+  80360e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803614:	8b 00                	mov    (%rax),%eax
+  803616:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803619:	89 c6                	mov    %eax,%esi
+  80361b:	48 b8 ef 5c 80 00 00 	movabs $0x805cef,%rax
+  803622:	00 00 00 
+  803625:	48 89 c7             	mov    %rax,%rdi
+  803628:	b8 00 00 00 00       	mov    $0x0,%eax
+  80362d:	48 b9 04 08 80 00 00 	movabs $0x800804,%rcx
+  803634:	00 00 00 
+  803637:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803639:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803640:	eb 33                	jmp    803675 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803642:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803646:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80364a:	48 85 c0             	test   %rax,%rax
+  80364d:	75 09                	jne    803658 <read+0xe3>
+    return -E_NOT_SUPP;
+  80364f:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803656:	eb 1d                	jmp    803675 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803658:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80365c:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803660:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803664:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803668:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80366c:	48 89 ce             	mov    %rcx,%rsi
+  80366f:	48 89 c7             	mov    %rax,%rdi
+  803672:	41 ff d0             	call   *%r8
+}
+  803675:	c9                   	leave
+  803676:	c3                   	ret
+
+0000000000803677 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803677:	55                   	push   %rbp
+  803678:	48 89 e5             	mov    %rsp,%rbp
+  80367b:	48 83 ec 30          	sub    $0x30,%rsp
+  80367f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803682:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803686:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80368a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803691:	eb 49                	jmp    8036dc <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803693:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803696:	48 98                	cltq
+  803698:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80369c:	48 29 c2             	sub    %rax,%rdx
+  80369f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036a2:	48 63 c8             	movslq %eax,%rcx
+  8036a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036a9:	48 01 c1             	add    %rax,%rcx
+  8036ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036af:	48 89 ce             	mov    %rcx,%rsi
+  8036b2:	89 c7                	mov    %eax,%edi
+  8036b4:	48 b8 75 35 80 00 00 	movabs $0x803575,%rax
+  8036bb:	00 00 00 
+  8036be:	ff d0                	call   *%rax
+  8036c0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8036c3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8036c7:	79 07                	jns    8036d0 <readn+0x59>
+      return m;
+  8036c9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8036cc:	48 98                	cltq
+  8036ce:	eb 1f                	jmp    8036ef <readn+0x78>
+    if (m == 0)
+  8036d0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8036d4:	74 13                	je     8036e9 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8036d6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8036d9:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8036dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036df:	48 98                	cltq
+  8036e1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8036e5:	72 ac                	jb     803693 <readn+0x1c>
+  8036e7:	eb 01                	jmp    8036ea <readn+0x73>
+      break;
+  8036e9:	90                   	nop
+  }
+  return tot;
+  8036ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036ed:	48 98                	cltq
+}
+  8036ef:	c9                   	leave
+  8036f0:	c3                   	ret
+
+00000000008036f1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8036f1:	55                   	push   %rbp
+  8036f2:	48 89 e5             	mov    %rsp,%rbp
+  8036f5:	48 83 ec 40          	sub    $0x40,%rsp
+  8036f9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8036fc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803700:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803704:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803708:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80370b:	48 89 d6             	mov    %rdx,%rsi
+  80370e:	89 c7                	mov    %eax,%edi
+  803710:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  803717:	00 00 00 
+  80371a:	ff d0                	call   *%rax
+  80371c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80371f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803723:	78 24                	js     803749 <write+0x58>
+  803725:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803729:	8b 00                	mov    (%rax),%eax
+  80372b:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80372f:	48 89 d6             	mov    %rdx,%rsi
+  803732:	89 c7                	mov    %eax,%edi
+  803734:	48 b8 ba 31 80 00 00 	movabs $0x8031ba,%rax
+  80373b:	00 00 00 
+  80373e:	ff d0                	call   *%rax
+  803740:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803743:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803747:	79 0a                	jns    803753 <write+0x62>
+    return r;
+  803749:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80374c:	48 98                	cltq
+  80374e:	e9 9d 00 00 00       	jmp    8037f0 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803753:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803757:	8b 40 08             	mov    0x8(%rax),%eax
+  80375a:	83 e0 03             	and    $0x3,%eax
+  80375d:	85 c0                	test   %eax,%eax
+  80375f:	75 5c                	jne    8037bd <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803761:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803768:	00 00 00 
+  80376b:	8b 40 04             	mov    0x4(%rax),%eax
+  80376e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803773:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80377a:	00 00 00 
+  80377d:	48 98                	cltq
+  80377f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803786:	48 01 d0             	add    %rdx,%rax
+  803789:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80378f:	8b 00                	mov    (%rax),%eax
+  803791:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803794:	89 c6                	mov    %eax,%esi
+  803796:	48 b8 0b 5d 80 00 00 	movabs $0x805d0b,%rax
+  80379d:	00 00 00 
+  8037a0:	48 89 c7             	mov    %rax,%rdi
+  8037a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037a8:	48 b9 04 08 80 00 00 	movabs $0x800804,%rcx
+  8037af:	00 00 00 
+  8037b2:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8037b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8037bb:	eb 33                	jmp    8037f0 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8037bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037c1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8037c5:	48 85 c0             	test   %rax,%rax
+  8037c8:	75 09                	jne    8037d3 <write+0xe2>
+    return -E_NOT_SUPP;
+  8037ca:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8037d1:	eb 1d                	jmp    8037f0 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8037d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037d7:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8037db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037df:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8037e3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8037e7:	48 89 ce             	mov    %rcx,%rsi
+  8037ea:	48 89 c7             	mov    %rax,%rdi
+  8037ed:	41 ff d0             	call   *%r8
+}
+  8037f0:	c9                   	leave
+  8037f1:	c3                   	ret
+
+00000000008037f2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8037f2:	55                   	push   %rbp
+  8037f3:	48 89 e5             	mov    %rsp,%rbp
+  8037f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8037fa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8037fd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803800:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803804:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803807:	48 89 d6             	mov    %rdx,%rsi
+  80380a:	89 c7                	mov    %eax,%edi
+  80380c:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  803813:	00 00 00 
+  803816:	ff d0                	call   *%rax
+  803818:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80381b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80381f:	79 05                	jns    803826 <seek+0x34>
+    return r;
+  803821:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803824:	eb 0f                	jmp    803835 <seek+0x43>
+  fd->fd_offset = offset;
+  803826:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80382a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80382d:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803830:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803835:	c9                   	leave
+  803836:	c3                   	ret
+
+0000000000803837 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803837:	55                   	push   %rbp
+  803838:	48 89 e5             	mov    %rsp,%rbp
+  80383b:	48 83 ec 30          	sub    $0x30,%rsp
+  80383f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803842:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803845:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803849:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80384c:	48 89 d6             	mov    %rdx,%rsi
+  80384f:	89 c7                	mov    %eax,%edi
+  803851:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  803858:	00 00 00 
+  80385b:	ff d0                	call   *%rax
+  80385d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803860:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803864:	78 24                	js     80388a <ftruncate+0x53>
+  803866:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80386a:	8b 00                	mov    (%rax),%eax
+  80386c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803870:	48 89 d6             	mov    %rdx,%rsi
+  803873:	89 c7                	mov    %eax,%edi
+  803875:	48 b8 ba 31 80 00 00 	movabs $0x8031ba,%rax
+  80387c:	00 00 00 
+  80387f:	ff d0                	call   *%rax
+  803881:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803884:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803888:	79 08                	jns    803892 <ftruncate+0x5b>
+    return r;
+  80388a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80388d:	e9 92 00 00 00       	jmp    803924 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803892:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803896:	8b 40 08             	mov    0x8(%rax),%eax
+  803899:	83 e0 03             	and    $0x3,%eax
+  80389c:	85 c0                	test   %eax,%eax
+  80389e:	75 5a                	jne    8038fa <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8038a0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8038a7:	00 00 00 
+  8038aa:	8b 40 04             	mov    0x4(%rax),%eax
+  8038ad:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8038b2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8038b9:	00 00 00 
+  8038bc:	48 98                	cltq
+  8038be:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8038c5:	48 01 d0             	add    %rdx,%rax
+  8038c8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8038ce:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8038d0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8038d3:	89 c6                	mov    %eax,%esi
+  8038d5:	48 b8 28 5d 80 00 00 	movabs $0x805d28,%rax
+  8038dc:	00 00 00 
+  8038df:	48 89 c7             	mov    %rax,%rdi
+  8038e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038e7:	48 b9 04 08 80 00 00 	movabs $0x800804,%rcx
+  8038ee:	00 00 00 
+  8038f1:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8038f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038f8:	eb 2a                	jmp    803924 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8038fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038fe:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803902:	48 85 c0             	test   %rax,%rax
+  803905:	75 07                	jne    80390e <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803907:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80390c:	eb 16                	jmp    803924 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80390e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803912:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803916:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80391a:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80391d:	89 d6                	mov    %edx,%esi
+  80391f:	48 89 c7             	mov    %rax,%rdi
+  803922:	ff d1                	call   *%rcx
+}
+  803924:	c9                   	leave
+  803925:	c3                   	ret
+
+0000000000803926 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803926:	55                   	push   %rbp
+  803927:	48 89 e5             	mov    %rsp,%rbp
+  80392a:	48 83 ec 30          	sub    $0x30,%rsp
+  80392e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803931:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803935:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803939:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80393c:	48 89 d6             	mov    %rdx,%rsi
+  80393f:	89 c7                	mov    %eax,%edi
+  803941:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  803948:	00 00 00 
+  80394b:	ff d0                	call   *%rax
+  80394d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803950:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803954:	78 24                	js     80397a <fstat+0x54>
+  803956:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80395a:	8b 00                	mov    (%rax),%eax
+  80395c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803960:	48 89 d6             	mov    %rdx,%rsi
+  803963:	89 c7                	mov    %eax,%edi
+  803965:	48 b8 ba 31 80 00 00 	movabs $0x8031ba,%rax
+  80396c:	00 00 00 
+  80396f:	ff d0                	call   *%rax
+  803971:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803974:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803978:	79 05                	jns    80397f <fstat+0x59>
+    return r;
+  80397a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80397d:	eb 5e                	jmp    8039dd <fstat+0xb7>
+  if (!dev->dev_stat)
+  80397f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803983:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803987:	48 85 c0             	test   %rax,%rax
+  80398a:	75 07                	jne    803993 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80398c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803991:	eb 4a                	jmp    8039dd <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803993:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803997:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  80399a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80399e:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8039a5:	00 00 00 
+  stat->st_isdir   = 0;
+  8039a8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039ac:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8039b3:	00 00 00 
+  stat->st_dev     = dev;
+  8039b6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8039ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039be:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8039c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039c9:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8039cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039d1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8039d5:	48 89 d6             	mov    %rdx,%rsi
+  8039d8:	48 89 c7             	mov    %rax,%rdi
+  8039db:	ff d1                	call   *%rcx
+}
+  8039dd:	c9                   	leave
+  8039de:	c3                   	ret
+
+00000000008039df <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8039df:	55                   	push   %rbp
+  8039e0:	48 89 e5             	mov    %rsp,%rbp
+  8039e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8039e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8039eb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8039ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039f3:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8039f9:	83 f8 20             	cmp    $0x20,%eax
+  8039fc:	75 07                	jne    803a05 <pollwait_key+0x26>
+    return -E_INVAL;
+  8039fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a03:	eb 5f                	jmp    803a64 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a09:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803a0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a13:	48 63 d2             	movslq %edx,%rdx
+  803a16:	48 c1 e2 04          	shl    $0x4,%rdx
+  803a1a:	48 01 c2             	add    %rax,%rdx
+  803a1d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a21:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803a24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a28:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803a2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a32:	8b 00                	mov    (%rax),%eax
+  803a34:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a38:	48 63 c9             	movslq %ecx,%rcx
+  803a3b:	48 c1 e1 04          	shl    $0x4,%rcx
+  803a3f:	48 01 ca             	add    %rcx,%rdx
+  803a42:	48 83 c2 08          	add    $0x8,%rdx
+  803a46:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803a48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a4c:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803a52:	8d 50 01             	lea    0x1(%rax),%edx
+  803a55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a59:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a64:	c9                   	leave
+  803a65:	c3                   	ret
+
+0000000000803a66 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803a66:	55                   	push   %rbp
+  803a67:	48 89 e5             	mov    %rsp,%rbp
+  803a6a:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803a71:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803a78:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803a7e:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803a85:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803a8c:	00 
+  int i, r, ready, ipc = 0;
+  803a8d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803a94:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803a9b:	00 
+  803a9c:	74 45                	je     803ae3 <poll+0x7d>
+  803a9e:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803aa5:	ff 
+  803aa6:	74 3b                	je     803ae3 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803aa8:	48 b8 ba 52 80 00 00 	movabs $0x8052ba,%rax
+  803aaf:	00 00 00 
+  803ab2:	ff d0                	call   *%rax
+  803ab4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803ab8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803abc:	48 f7 d0             	not    %rax
+  803abf:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803ac6:	73 10                	jae    803ad8 <poll+0x72>
+  803ac8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803acc:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803ad3:	48 01 d0             	add    %rdx,%rax
+  803ad6:	eb 07                	jmp    803adf <poll+0x79>
+  803ad8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803adf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803ae3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803aea:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803af1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803af8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803aff:	e9 46 02 00 00       	jmp    803d4a <poll+0x2e4>
+      fds[i].revents = 0;
+  803b04:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b07:	48 63 d0             	movslq %eax,%rdx
+  803b0a:	48 89 d0             	mov    %rdx,%rax
+  803b0d:	48 01 c0             	add    %rax,%rax
+  803b10:	48 01 d0             	add    %rdx,%rax
+  803b13:	48 c1 e0 02          	shl    $0x2,%rax
+  803b17:	48 89 c2             	mov    %rax,%rdx
+  803b1a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b21:	48 01 d0             	add    %rdx,%rax
+  803b24:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803b2b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b2e:	48 63 d0             	movslq %eax,%rdx
+  803b31:	48 89 d0             	mov    %rdx,%rax
+  803b34:	48 01 c0             	add    %rax,%rax
+  803b37:	48 01 d0             	add    %rdx,%rax
+  803b3a:	48 c1 e0 02          	shl    $0x2,%rax
+  803b3e:	48 89 c2             	mov    %rax,%rdx
+  803b41:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b48:	48 01 d0             	add    %rdx,%rax
+  803b4b:	8b 00                	mov    (%rax),%eax
+  803b4d:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803b50:	75 62                	jne    803bb4 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803b52:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b55:	48 63 d0             	movslq %eax,%rdx
+  803b58:	48 89 d0             	mov    %rdx,%rax
+  803b5b:	48 01 c0             	add    %rax,%rax
+  803b5e:	48 01 d0             	add    %rdx,%rax
+  803b61:	48 c1 e0 02          	shl    $0x2,%rax
+  803b65:	48 89 c2             	mov    %rax,%rdx
+  803b68:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b6f:	48 01 d0             	add    %rdx,%rax
+  803b72:	8b 40 04             	mov    0x4(%rax),%eax
+  803b75:	83 e0 01             	and    $0x1,%eax
+  803b78:	85 c0                	test   %eax,%eax
+  803b7a:	0f 84 9b 01 00 00    	je     803d1b <poll+0x2b5>
+          fds[i].revents = ipc;
+  803b80:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b83:	48 63 d0             	movslq %eax,%rdx
+  803b86:	48 89 d0             	mov    %rdx,%rax
+  803b89:	48 01 c0             	add    %rax,%rax
+  803b8c:	48 01 d0             	add    %rdx,%rax
+  803b8f:	48 c1 e0 02          	shl    $0x2,%rax
+  803b93:	48 89 c2             	mov    %rax,%rdx
+  803b96:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b9d:	48 01 c2             	add    %rax,%rdx
+  803ba0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ba3:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803ba6:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803ba9:	83 c8 04             	or     $0x4,%eax
+  803bac:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803baf:	e9 67 01 00 00       	jmp    803d1b <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803bb4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803bb7:	48 63 d0             	movslq %eax,%rdx
+  803bba:	48 89 d0             	mov    %rdx,%rax
+  803bbd:	48 01 c0             	add    %rax,%rax
+  803bc0:	48 01 d0             	add    %rdx,%rax
+  803bc3:	48 c1 e0 02          	shl    $0x2,%rax
+  803bc7:	48 89 c2             	mov    %rax,%rdx
+  803bca:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803bd1:	48 01 d0             	add    %rdx,%rax
+  803bd4:	8b 00                	mov    (%rax),%eax
+  803bd6:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803bdd:	48 89 d6             	mov    %rdx,%rsi
+  803be0:	89 c7                	mov    %eax,%edi
+  803be2:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  803be9:	00 00 00 
+  803bec:	ff d0                	call   *%rax
+  803bee:	85 c0                	test   %eax,%eax
+  803bf0:	78 25                	js     803c17 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803bf2:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803bf9:	8b 00                	mov    (%rax),%eax
+  803bfb:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803c02:	48 89 d6             	mov    %rdx,%rsi
+  803c05:	89 c7                	mov    %eax,%edi
+  803c07:	48 b8 ba 31 80 00 00 	movabs $0x8031ba,%rax
+  803c0e:	00 00 00 
+  803c11:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803c13:	85 c0                	test   %eax,%eax
+  803c15:	79 2c                	jns    803c43 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803c17:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c1a:	48 63 d0             	movslq %eax,%rdx
+  803c1d:	48 89 d0             	mov    %rdx,%rax
+  803c20:	48 01 c0             	add    %rax,%rax
+  803c23:	48 01 d0             	add    %rdx,%rax
+  803c26:	48 c1 e0 02          	shl    $0x2,%rax
+  803c2a:	48 89 c2             	mov    %rax,%rdx
+  803c2d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c34:	48 01 d0             	add    %rdx,%rax
+  803c37:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803c3e:	e9 d8 00 00 00       	jmp    803d1b <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803c43:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803c4a:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803c4e:	48 85 c0             	test   %rax,%rax
+  803c51:	74 7d                	je     803cd0 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803c53:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803c5a:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803c5e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803c61:	48 63 d0             	movslq %eax,%rdx
+  803c64:	48 89 d0             	mov    %rdx,%rax
+  803c67:	48 01 c0             	add    %rax,%rax
+  803c6a:	48 01 d0             	add    %rdx,%rax
+  803c6d:	48 c1 e0 02          	shl    $0x2,%rax
+  803c71:	48 89 c2             	mov    %rax,%rdx
+  803c74:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803c7b:	48 01 d0             	add    %rdx,%rax
+  803c7e:	8b 48 04             	mov    0x4(%rax),%ecx
+  803c81:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803c88:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803c8f:	89 ce                	mov    %ecx,%esi
+  803c91:	48 89 c7             	mov    %rax,%rdi
+  803c94:	41 ff d0             	call   *%r8
+  803c97:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803c9a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803c9e:	79 08                	jns    803ca8 <poll+0x242>
+          return r;
+  803ca0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ca3:	e9 45 01 00 00       	jmp    803ded <poll+0x387>
+        fds[i].revents = r;
+  803ca8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cab:	48 63 d0             	movslq %eax,%rdx
+  803cae:	48 89 d0             	mov    %rdx,%rax
+  803cb1:	48 01 c0             	add    %rax,%rax
+  803cb4:	48 01 d0             	add    %rdx,%rax
+  803cb7:	48 c1 e0 02          	shl    $0x2,%rax
+  803cbb:	48 89 c2             	mov    %rax,%rdx
+  803cbe:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803cc5:	48 01 c2             	add    %rax,%rdx
+  803cc8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ccb:	89 42 08             	mov    %eax,0x8(%rdx)
+  803cce:	eb 4b                	jmp    803d1b <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803cd0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cd3:	48 63 d0             	movslq %eax,%rdx
+  803cd6:	48 89 d0             	mov    %rdx,%rax
+  803cd9:	48 01 c0             	add    %rax,%rax
+  803cdc:	48 01 d0             	add    %rdx,%rax
+  803cdf:	48 c1 e0 02          	shl    $0x2,%rax
+  803ce3:	48 89 c2             	mov    %rax,%rdx
+  803ce6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ced:	48 01 d0             	add    %rdx,%rax
+  803cf0:	8b 48 04             	mov    0x4(%rax),%ecx
+  803cf3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cf6:	48 63 d0             	movslq %eax,%rdx
+  803cf9:	48 89 d0             	mov    %rdx,%rax
+  803cfc:	48 01 c0             	add    %rax,%rax
+  803cff:	48 01 d0             	add    %rdx,%rax
+  803d02:	48 c1 e0 02          	shl    $0x2,%rax
+  803d06:	48 89 c2             	mov    %rax,%rdx
+  803d09:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d10:	48 01 d0             	add    %rdx,%rax
+  803d13:	83 e1 03             	and    $0x3,%ecx
+  803d16:	89 ca                	mov    %ecx,%edx
+  803d18:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803d1b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d1e:	48 63 d0             	movslq %eax,%rdx
+  803d21:	48 89 d0             	mov    %rdx,%rax
+  803d24:	48 01 c0             	add    %rax,%rax
+  803d27:	48 01 d0             	add    %rdx,%rax
+  803d2a:	48 c1 e0 02          	shl    $0x2,%rax
+  803d2e:	48 89 c2             	mov    %rax,%rdx
+  803d31:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803d38:	48 01 d0             	add    %rdx,%rax
+  803d3b:	8b 40 08             	mov    0x8(%rax),%eax
+  803d3e:	85 c0                	test   %eax,%eax
+  803d40:	74 04                	je     803d46 <poll+0x2e0>
+        ready++;
+  803d42:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803d46:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803d4a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d4d:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803d53:	0f 8c ab fd ff ff    	jl     803b04 <poll+0x9e>
+    }
+    if (ready)
+  803d59:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803d5d:	74 08                	je     803d67 <poll+0x301>
+      return ready;
+  803d5f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803d62:	e9 86 00 00 00       	jmp    803ded <poll+0x387>
+
+    if (deadline) {
+  803d67:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803d6c:	74 30                	je     803d9e <poll+0x338>
+      now     = vsys_clock_ns();
+  803d6e:	48 b8 ba 52 80 00 00 	movabs $0x8052ba,%rax
+  803d75:	00 00 00 
+  803d78:	ff d0                	call   *%rax
+  803d7a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803d7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d82:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803d86:	73 0a                	jae    803d92 <poll+0x32c>
+  803d88:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d8c:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803d90:	eb 05                	jmp    803d97 <poll+0x331>
+  803d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d97:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803d9e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803da1:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803da4:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803dab:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803db2:	48 89 c7             	mov    %rax,%rdi
+  803db5:	48 b8 4a 2c 80 00 00 	movabs $0x802c4a,%rax
+  803dbc:	00 00 00 
+  803dbf:	ff d0                	call   *%rax
+  803dc1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803dc4:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803dc8:	75 07                	jne    803dd1 <poll+0x36b>
+      return 0;
+  803dca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dcf:	eb 1c                	jmp    803ded <poll+0x387>
+    if (r < 0)
+  803dd1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803dd5:	79 05                	jns    803ddc <poll+0x376>
+      return r;
+  803dd7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803dda:	eb 11                	jmp    803ded <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803ddc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ddf:	c1 f8 02             	sar    $0x2,%eax
+  803de2:	83 e0 01             	and    $0x1,%eax
+  803de5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803de8:	e9 f6 fc ff ff       	jmp    803ae3 <poll+0x7d>
+  }
+}
+  803ded:	c9                   	leave
+  803dee:	c3                   	ret
+
+0000000000803def <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803def:	55                   	push   %rbp
+  803df0:	48 89 e5             	mov    %rsp,%rbp
+  803df3:	48 83 ec 20          	sub    $0x20,%rsp
+  803df7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803dfb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803dff:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e03:	be 00 00 00 00       	mov    $0x0,%esi
+  803e08:	48 89 c7             	mov    %rax,%rdi
+  803e0b:	48 b8 dd 3e 80 00 00 	movabs $0x803edd,%rax
+  803e12:	00 00 00 
+  803e15:	ff d0                	call   *%rax
+  803e17:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e1a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e1e:	79 05                	jns    803e25 <stat+0x36>
+    return fd;
+  803e20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e23:	eb 2f                	jmp    803e54 <stat+0x65>
+  r = fstat(fd, stat);
+  803e25:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e2c:	48 89 d6             	mov    %rdx,%rsi
+  803e2f:	89 c7                	mov    %eax,%edi
+  803e31:	48 b8 26 39 80 00 00 	movabs $0x803926,%rax
+  803e38:	00 00 00 
+  803e3b:	ff d0                	call   *%rax
+  803e3d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803e40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e43:	89 c7                	mov    %eax,%edi
+  803e45:	48 b8 8e 32 80 00 00 	movabs $0x80328e,%rax
+  803e4c:	00 00 00 
+  803e4f:	ff d0                	call   *%rax
+  return r;
+  803e51:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803e54:	c9                   	leave
+  803e55:	c3                   	ret
+
+0000000000803e56 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803e56:	55                   	push   %rbp
+  803e57:	48 89 e5             	mov    %rsp,%rbp
+  803e5a:	48 83 ec 10          	sub    $0x10,%rsp
+  803e5e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803e61:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803e65:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803e6c:	00 00 00 
+  803e6f:	8b 00                	mov    (%rax),%eax
+  803e71:	85 c0                	test   %eax,%eax
+  803e73:	75 1d                	jne    803e92 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803e75:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e7a:	48 b8 59 55 80 00 00 	movabs $0x805559,%rax
+  803e81:	00 00 00 
+  803e84:	ff d0                	call   *%rax
+  803e86:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803e8d:	00 00 00 
+  803e90:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803e92:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803e99:	00 00 00 
+  803e9c:	8b 00                	mov    (%rax),%eax
+  803e9e:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803ea1:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803ea6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803ead:	00 00 00 
+  803eb0:	89 c7                	mov    %eax,%edi
+  803eb2:	48 b8 ac 54 80 00 00 	movabs $0x8054ac,%rax
+  803eb9:	00 00 00 
+  803ebc:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803ebe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ec2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ec7:	48 89 c6             	mov    %rax,%rsi
+  803eca:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ecf:	48 b8 2f 53 80 00 00 	movabs $0x80532f,%rax
+  803ed6:	00 00 00 
+  803ed9:	ff d0                	call   *%rax
+}
+  803edb:	c9                   	leave
+  803edc:	c3                   	ret
+
+0000000000803edd <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803edd:	55                   	push   %rbp
+  803ede:	48 89 e5             	mov    %rsp,%rbp
+  803ee1:	48 83 ec 20          	sub    $0x20,%rsp
+  803ee5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ee9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803eec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ef0:	48 89 c7             	mov    %rax,%rdi
+  803ef3:	48 b8 b3 16 80 00 00 	movabs $0x8016b3,%rax
+  803efa:	00 00 00 
+  803efd:	ff d0                	call   *%rax
+  803eff:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803f04:	7e 0a                	jle    803f10 <open+0x33>
+    return -E_BAD_PATH;
+  803f06:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803f0b:	e9 a8 00 00 00       	jmp    803fb8 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803f10:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803f14:	48 89 c7             	mov    %rax,%rdi
+  803f17:	48 b8 37 2f 80 00 00 	movabs $0x802f37,%rax
+  803f1e:	00 00 00 
+  803f21:	ff d0                	call   *%rax
+  803f23:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f26:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f2a:	79 08                	jns    803f34 <open+0x57>
+    return r;
+  803f2c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f2f:	e9 84 00 00 00       	jmp    803fb8 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803f34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f38:	48 89 c6             	mov    %rax,%rsi
+  803f3b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803f42:	00 00 00 
+  803f45:	48 89 c7             	mov    %rax,%rdi
+  803f48:	48 b8 b4 17 80 00 00 	movabs $0x8017b4,%rax
+  803f4f:	00 00 00 
+  803f52:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803f54:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803f5b:	00 00 00 
+  803f5e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803f61:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803f67:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f6b:	48 89 c6             	mov    %rax,%rsi
+  803f6e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f73:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  803f7a:	00 00 00 
+  803f7d:	ff d0                	call   *%rax
+  803f7f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f82:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f86:	79 1d                	jns    803fa5 <open+0xc8>
+    fd_close(fd, 0);
+  803f88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f8c:	be 00 00 00 00       	mov    $0x0,%esi
+  803f91:	48 89 c7             	mov    %rax,%rdi
+  803f94:	48 b8 ef 30 80 00 00 	movabs $0x8030ef,%rax
+  803f9b:	00 00 00 
+  803f9e:	ff d0                	call   *%rax
+    return r;
+  803fa0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fa3:	eb 13                	jmp    803fb8 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803fa5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fa9:	48 89 c7             	mov    %rax,%rdi
+  803fac:	48 b8 e9 2e 80 00 00 	movabs $0x802ee9,%rax
+  803fb3:	00 00 00 
+  803fb6:	ff d0                	call   *%rax
+}
+  803fb8:	c9                   	leave
+  803fb9:	c3                   	ret
+
+0000000000803fba <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803fba:	55                   	push   %rbp
+  803fbb:	48 89 e5             	mov    %rsp,%rbp
+  803fbe:	48 83 ec 10          	sub    $0x10,%rsp
+  803fc2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803fc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fca:	8b 40 0c             	mov    0xc(%rax),%eax
+  803fcd:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803fd4:	00 00 00 
+  803fd7:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803fd9:	be 00 00 00 00       	mov    $0x0,%esi
+  803fde:	bf 06 00 00 00       	mov    $0x6,%edi
+  803fe3:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  803fea:	00 00 00 
+  803fed:	ff d0                	call   *%rax
+}
+  803fef:	c9                   	leave
+  803ff0:	c3                   	ret
+
+0000000000803ff1 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803ff1:	55                   	push   %rbp
+  803ff2:	48 89 e5             	mov    %rsp,%rbp
+  803ff5:	48 83 ec 30          	sub    $0x30,%rsp
+  803ff9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ffd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804001:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804005:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80400a:	74 07                	je     804013 <devfile_read+0x22>
+  80400c:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804011:	75 0a                	jne    80401d <devfile_read+0x2c>
+  return E_INVAL;
+  804013:	b8 03 00 00 00       	mov    $0x3,%eax
+  804018:	e9 b4 00 00 00       	jmp    8040d1 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  80401d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804024:	00 
+  while (n) {
+  804025:	e9 98 00 00 00       	jmp    8040c2 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80402a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80402e:	8b 40 0c             	mov    0xc(%rax),%eax
+  804031:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804038:	00 00 00 
+  80403b:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80403d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804044:	00 00 00 
+  804047:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80404b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80404f:	be 00 00 00 00       	mov    $0x0,%esi
+  804054:	bf 03 00 00 00       	mov    $0x3,%edi
+  804059:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  804060:	00 00 00 
+  804063:	ff d0                	call   *%rax
+  804065:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  804068:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80406c:	7f 13                	jg     804081 <devfile_read+0x90>
+      return res ? res : res0;
+  80406e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804072:	74 07                	je     80407b <devfile_read+0x8a>
+  804074:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804077:	48 98                	cltq
+  804079:	eb 56                	jmp    8040d1 <devfile_read+0xe0>
+  80407b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80407f:	eb 50                	jmp    8040d1 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804081:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804084:	48 63 d0             	movslq %eax,%rdx
+  804087:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80408b:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804092:	00 00 00 
+  804095:	48 89 ce             	mov    %rcx,%rsi
+  804098:	48 89 c7             	mov    %rax,%rdi
+  80409b:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  8040a2:	00 00 00 
+  8040a5:	ff d0                	call   *%rax
+
+    buf += res;
+  8040a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040aa:	48 98                	cltq
+  8040ac:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8040b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040b3:	48 98                	cltq
+  8040b5:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  8040b9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040bc:	48 98                	cltq
+  8040be:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8040c2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8040c7:	0f 85 5d ff ff ff    	jne    80402a <devfile_read+0x39>
+  }
+
+  return res0;
+  8040cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8040d1:	c9                   	leave
+  8040d2:	c3                   	ret
+
+00000000008040d3 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8040d3:	55                   	push   %rbp
+  8040d4:	48 89 e5             	mov    %rsp,%rbp
+  8040d7:	48 83 ec 50          	sub    $0x50,%rsp
+  8040db:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8040df:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8040e3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8040e7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8040ec:	74 07                	je     8040f5 <devfile_write+0x22>
+  8040ee:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8040f3:	75 0a                	jne    8040ff <devfile_write+0x2c>
+  return E_INVAL;
+  8040f5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8040fa:	e9 c9 00 00 00       	jmp    8041c8 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8040ff:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804106:	00 
+
+  while (n) {
+  804107:	e9 ad 00 00 00       	jmp    8041b9 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80410c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804110:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804114:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  80411b:	00 
+  80411c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804120:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804124:	48 39 c2             	cmp    %rax,%rdx
+  804127:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80412b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  80412f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804133:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804137:	48 89 c6             	mov    %rax,%rsi
+  80413a:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  804141:	00 00 00 
+  804144:	48 89 c7             	mov    %rax,%rdi
+  804147:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  80414e:	00 00 00 
+  804151:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804153:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804157:	8b 40 0c             	mov    0xc(%rax),%eax
+  80415a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804161:	00 00 00 
+  804164:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804166:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80416d:	00 00 00 
+  804170:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804174:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804178:	be 00 00 00 00       	mov    $0x0,%esi
+  80417d:	bf 04 00 00 00       	mov    $0x4,%edi
+  804182:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  804189:	00 00 00 
+  80418c:	ff d0                	call   *%rax
+  80418e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804191:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804195:	79 07                	jns    80419e <devfile_write+0xcb>
+      return res;
+  804197:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80419a:	48 98                	cltq
+  80419c:	eb 2a                	jmp    8041c8 <devfile_write+0xf5>
+
+    buf += res;
+  80419e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041a1:	48 98                	cltq
+  8041a3:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8041a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041aa:	48 98                	cltq
+  8041ac:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8041b0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041b3:	48 98                	cltq
+  8041b5:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8041b9:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8041be:	0f 85 48 ff ff ff    	jne    80410c <devfile_write+0x39>
+  }
+
+  return res0;
+  8041c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8041c8:	c9                   	leave
+  8041c9:	c3                   	ret
+
+00000000008041ca <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8041ca:	55                   	push   %rbp
+  8041cb:	48 89 e5             	mov    %rsp,%rbp
+  8041ce:	48 83 ec 20          	sub    $0x20,%rsp
+  8041d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041d6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8041da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041de:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041e1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8041e8:	00 00 00 
+  8041eb:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8041ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8041f2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8041f7:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  8041fe:	00 00 00 
+  804201:	ff d0                	call   *%rax
+  804203:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804206:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80420a:	79 05                	jns    804211 <devfile_stat+0x47>
+    return r;
+  80420c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80420f:	eb 59                	jmp    80426a <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804211:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804215:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80421c:	00 00 00 
+  80421f:	48 89 d6             	mov    %rdx,%rsi
+  804222:	48 89 c7             	mov    %rax,%rdi
+  804225:	48 b8 b4 17 80 00 00 	movabs $0x8017b4,%rax
+  80422c:	00 00 00 
+  80422f:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804231:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804238:	00 00 00 
+  80423b:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804241:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804245:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80424b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804252:	00 00 00 
+  804255:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  80425b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80425f:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804265:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80426a:	c9                   	leave
+  80426b:	c3                   	ret
+
+000000000080426c <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80426c:	55                   	push   %rbp
+  80426d:	48 89 e5             	mov    %rsp,%rbp
+  804270:	48 83 ec 10          	sub    $0x10,%rsp
+  804274:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804278:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80427b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80427f:	8b 40 0c             	mov    0xc(%rax),%eax
+  804282:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804289:	00 00 00 
+  80428c:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  80428e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804295:	00 00 00 
+  804298:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80429b:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80429e:	be 00 00 00 00       	mov    $0x0,%esi
+  8042a3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8042a8:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  8042af:	00 00 00 
+  8042b2:	ff d0                	call   *%rax
+}
+  8042b4:	c9                   	leave
+  8042b5:	c3                   	ret
+
+00000000008042b6 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8042b6:	55                   	push   %rbp
+  8042b7:	48 89 e5             	mov    %rsp,%rbp
+  8042ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8042be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8042c2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8042c5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8042c9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042cc:	83 e0 03             	and    $0x3,%eax
+}
+  8042cf:	c9                   	leave
+  8042d0:	c3                   	ret
+
+00000000008042d1 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8042d1:	55                   	push   %rbp
+  8042d2:	48 89 e5             	mov    %rsp,%rbp
+  8042d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8042d9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8042dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042e1:	48 89 c7             	mov    %rax,%rdi
+  8042e4:	48 b8 b3 16 80 00 00 	movabs $0x8016b3,%rax
+  8042eb:	00 00 00 
+  8042ee:	ff d0                	call   *%rax
+  8042f0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8042f5:	7e 07                	jle    8042fe <remove+0x2d>
+    return -E_BAD_PATH;
+  8042f7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8042fc:	eb 36                	jmp    804334 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8042fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804302:	48 89 c6             	mov    %rax,%rsi
+  804305:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80430c:	00 00 00 
+  80430f:	48 89 c7             	mov    %rax,%rdi
+  804312:	48 b8 b4 17 80 00 00 	movabs $0x8017b4,%rax
+  804319:	00 00 00 
+  80431c:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  80431e:	be 00 00 00 00       	mov    $0x0,%esi
+  804323:	bf 07 00 00 00       	mov    $0x7,%edi
+  804328:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  80432f:	00 00 00 
+  804332:	ff d0                	call   *%rax
+}
+  804334:	c9                   	leave
+  804335:	c3                   	ret
+
+0000000000804336 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804336:	55                   	push   %rbp
+  804337:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80433a:	be 00 00 00 00       	mov    $0x0,%esi
+  80433f:	bf 08 00 00 00       	mov    $0x8,%edi
+  804344:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  80434b:	00 00 00 
+  80434e:	ff d0                	call   *%rax
+}
+  804350:	5d                   	pop    %rbp
+  804351:	c3                   	ret
+
+0000000000804352 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804352:	55                   	push   %rbp
+  804353:	48 89 e5             	mov    %rsp,%rbp
+  804356:	48 83 ec 20          	sub    $0x20,%rsp
+  80435a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80435e:	be 00 00 00 00       	mov    $0x0,%esi
+  804363:	bf 09 00 00 00       	mov    $0x9,%edi
+  804368:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  80436f:	00 00 00 
+  804372:	ff d0                	call   *%rax
+  804374:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804377:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80437b:	79 05                	jns    804382 <fs_stats+0x30>
+    return r;
+  80437d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804380:	eb 2a                	jmp    8043ac <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804382:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804386:	ba 68 00 00 00       	mov    $0x68,%edx
+  80438b:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804392:	00 00 00 
+  804395:	48 89 ce             	mov    %rcx,%rsi
+  804398:	48 89 c7             	mov    %rax,%rdi
+  80439b:	48 b8 f7 1c 80 00 00 	movabs $0x801cf7,%rax
+  8043a2:	00 00 00 
+  8043a5:	ff d0                	call   *%rax
+  return 0;
+  8043a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043ac:	c9                   	leave
+  8043ad:	c3                   	ret
+
+00000000008043ae <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  8043ae:	55                   	push   %rbp
+  8043af:	48 89 e5             	mov    %rsp,%rbp
+  8043b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8043b6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  8043b9:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8043c0:	00 00 00 
+  8043c3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043c6:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  8043c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8043cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8043d2:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  8043d9:	00 00 00 
+  8043dc:	ff d0                	call   *%rax
+}
+  8043de:	c9                   	leave
+  8043df:	c3                   	ret
+
+00000000008043e0 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8043e0:	55                   	push   %rbp
+  8043e1:	48 89 e5             	mov    %rsp,%rbp
+  8043e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8043e8:	89 f8                	mov    %edi,%eax
+  8043ea:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8043ed:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8043f1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8043f8:	00 00 00 
+  8043fb:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8043fd:	be 00 00 00 00       	mov    $0x0,%esi
+  804402:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804407:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  80440e:	00 00 00 
+  804411:	ff d0                	call   *%rax
+}
+  804413:	c9                   	leave
+  804414:	c3                   	ret
+
+0000000000804415 <writebuf>:
+  int error;      // first error that occurred
+  char buf[256];
+};
+
+static void
+writebuf(struct printbuf *b) {
+  804415:	55                   	push   %rbp
+  804416:	48 89 e5             	mov    %rsp,%rbp
+  804419:	48 83 ec 20          	sub    $0x20,%rsp
+  80441d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if (b->error > 0) {
+  804421:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804425:	8b 40 10             	mov    0x10(%rax),%eax
+  804428:	85 c0                	test   %eax,%eax
+  80442a:	7e 73                	jle    80449f <writebuf+0x8a>
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  80442c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804430:	8b 40 04             	mov    0x4(%rax),%eax
+  804433:	48 63 d0             	movslq %eax,%rdx
+  804436:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80443a:	48 8d 48 14          	lea    0x14(%rax),%rcx
+  80443e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804442:	8b 00                	mov    (%rax),%eax
+  804444:	48 89 ce             	mov    %rcx,%rsi
+  804447:	89 c7                	mov    %eax,%edi
+  804449:	48 b8 f1 36 80 00 00 	movabs $0x8036f1,%rax
+  804450:	00 00 00 
+  804453:	ff d0                	call   *%rax
+  804455:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+    if (result > 0)
+  804459:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80445e:	7e 17                	jle    804477 <writebuf+0x62>
+      b->result += result;
+  804460:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804464:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804468:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80446c:	48 01 c2             	add    %rax,%rdx
+  80446f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804473:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    if (result != b->idx) // error, or wrote less than supplied
+  804477:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80447b:	8b 40 04             	mov    0x4(%rax),%eax
+  80447e:	48 98                	cltq
+  804480:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  804484:	74 19                	je     80449f <writebuf+0x8a>
+      b->error = (result < 0 ? result : 0);
+  804486:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80448a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80448f:	48 85 c0             	test   %rax,%rax
+  804492:	48 0f 4f c2          	cmovg  %rdx,%rax
+  804496:	89 c2                	mov    %eax,%edx
+  804498:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80449c:	89 50 10             	mov    %edx,0x10(%rax)
+  }
+}
+  80449f:	90                   	nop
+  8044a0:	c9                   	leave
+  8044a1:	c3                   	ret
+
+00000000008044a2 <putch>:
+
+static void
+putch(int ch, void *thunk) {
+  8044a2:	55                   	push   %rbp
+  8044a3:	48 89 e5             	mov    %rsp,%rbp
+  8044a6:	48 83 ec 20          	sub    $0x20,%rsp
+  8044aa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8044ad:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct printbuf *b = (struct printbuf *)thunk;
+  8044b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044b5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  b->buf[b->idx++]   = ch;
+  8044b9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044bd:	8b 40 04             	mov    0x4(%rax),%eax
+  8044c0:	8d 48 01             	lea    0x1(%rax),%ecx
+  8044c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044c7:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  8044ca:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8044cd:	89 d1                	mov    %edx,%ecx
+  8044cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044d3:	48 98                	cltq
+  8044d5:	88 4c 02 14          	mov    %cl,0x14(%rdx,%rax,1)
+  if (b->idx == 256) {
+  8044d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044dd:	8b 40 04             	mov    0x4(%rax),%eax
+  8044e0:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8044e5:	75 1e                	jne    804505 <putch+0x63>
+    writebuf(b);
+  8044e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044eb:	48 89 c7             	mov    %rax,%rdi
+  8044ee:	48 b8 15 44 80 00 00 	movabs $0x804415,%rax
+  8044f5:	00 00 00 
+  8044f8:	ff d0                	call   *%rax
+    b->idx = 0;
+  8044fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044fe:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+  }
+}
+  804505:	90                   	nop
+  804506:	c9                   	leave
+  804507:	c3                   	ret
+
+0000000000804508 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804508:	55                   	push   %rbp
+  804509:	48 89 e5             	mov    %rsp,%rbp
+  80450c:	48 81 ec 40 01 00 00 	sub    $0x140,%rsp
+  804513:	89 bd dc fe ff ff    	mov    %edi,-0x124(%rbp)
+  804519:	48 89 b5 d0 fe ff ff 	mov    %rsi,-0x130(%rbp)
+  804520:	48 89 95 c8 fe ff ff 	mov    %rdx,-0x138(%rbp)
+  struct printbuf b;
+
+  b.fd     = fd;
+  804527:	8b 85 dc fe ff ff    	mov    -0x124(%rbp),%eax
+  80452d:	89 85 e0 fe ff ff    	mov    %eax,-0x120(%rbp)
+  b.idx    = 0;
+  804533:	c7 85 e4 fe ff ff 00 	movl   $0x0,-0x11c(%rbp)
+  80453a:	00 00 00 
+  b.result = 0;
+  80453d:	48 c7 85 e8 fe ff ff 	movq   $0x0,-0x118(%rbp)
+  804544:	00 00 00 00 
+  b.error  = 1;
+  804548:	c7 85 f0 fe ff ff 01 	movl   $0x1,-0x110(%rbp)
+  80454f:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  804552:	48 8b 8d c8 fe ff ff 	mov    -0x138(%rbp),%rcx
+  804559:	48 8b 95 d0 fe ff ff 	mov    -0x130(%rbp),%rdx
+  804560:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804567:	48 89 c6             	mov    %rax,%rsi
+  80456a:	48 b8 a2 44 80 00 00 	movabs $0x8044a2,%rax
+  804571:	00 00 00 
+  804574:	48 89 c7             	mov    %rax,%rdi
+  804577:	48 b8 5e 0b 80 00 00 	movabs $0x800b5e,%rax
+  80457e:	00 00 00 
+  804581:	ff d0                	call   *%rax
+  if (b.idx > 0)
+  804583:	8b 85 e4 fe ff ff    	mov    -0x11c(%rbp),%eax
+  804589:	85 c0                	test   %eax,%eax
+  80458b:	7e 16                	jle    8045a3 <vfprintf+0x9b>
+    writebuf(&b);
+  80458d:	48 8d 85 e0 fe ff ff 	lea    -0x120(%rbp),%rax
+  804594:	48 89 c7             	mov    %rax,%rdi
+  804597:	48 b8 15 44 80 00 00 	movabs $0x804415,%rax
+  80459e:	00 00 00 
+  8045a1:	ff d0                	call   *%rax
+
+  return (b.result ? b.result : b.error);
+  8045a3:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8045aa:	48 85 c0             	test   %rax,%rax
+  8045ad:	74 09                	je     8045b8 <vfprintf+0xb0>
+  8045af:	48 8b 85 e8 fe ff ff 	mov    -0x118(%rbp),%rax
+  8045b6:	eb 06                	jmp    8045be <vfprintf+0xb6>
+  8045b8:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+}
+  8045be:	c9                   	leave
+  8045bf:	c3                   	ret
+
+00000000008045c0 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8045c0:	55                   	push   %rbp
+  8045c1:	48 89 e5             	mov    %rsp,%rbp
+  8045c4:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8045cb:	89 bd 2c ff ff ff    	mov    %edi,-0xd4(%rbp)
+  8045d1:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8045d8:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8045df:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8045e6:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8045ed:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8045f4:	84 c0                	test   %al,%al
+  8045f6:	74 20                	je     804618 <fprintf+0x58>
+  8045f8:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8045fc:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  804600:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  804604:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  804608:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80460c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  804610:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  804614:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  804618:	c7 85 30 ff ff ff 10 	movl   $0x10,-0xd0(%rbp)
+  80461f:	00 00 00 
+  804622:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  804629:	00 00 00 
+  80462c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804630:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  804637:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80463e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(fd, fmt, ap);
+  804645:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80464c:	48 8b 8d 20 ff ff ff 	mov    -0xe0(%rbp),%rcx
+  804653:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804659:	48 89 ce             	mov    %rcx,%rsi
+  80465c:	89 c7                	mov    %eax,%edi
+  80465e:	48 b8 08 45 80 00 00 	movabs $0x804508,%rax
+  804665:	00 00 00 
+  804668:	ff d0                	call   *%rax
+  80466a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  804670:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  804676:	c9                   	leave
+  804677:	c3                   	ret
+
+0000000000804678 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  804678:	55                   	push   %rbp
+  804679:	48 89 e5             	mov    %rsp,%rbp
+  80467c:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  804683:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80468a:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  804691:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  804698:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80469f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8046a6:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8046ad:	84 c0                	test   %al,%al
+  8046af:	74 20                	je     8046d1 <printf+0x59>
+  8046b1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8046b5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8046b9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8046bd:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8046c1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8046c5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8046c9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8046cd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8046d1:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8046d8:	00 00 00 
+  8046db:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8046e2:	00 00 00 
+  8046e5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8046e9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8046f0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8046f7:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vfprintf(1, fmt, ap);
+  8046fe:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  804705:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80470c:	48 89 c6             	mov    %rax,%rsi
+  80470f:	bf 01 00 00 00       	mov    $0x1,%edi
+  804714:	48 b8 08 45 80 00 00 	movabs $0x804508,%rax
+  80471b:	00 00 00 
+  80471e:	ff d0                	call   *%rax
+  804720:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  804726:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80472c:	c9                   	leave
+  80472d:	c3                   	ret
+
+000000000080472e <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80472e:	55                   	push   %rbp
+  80472f:	48 89 e5             	mov    %rsp,%rbp
+  804732:	48 83 ec 10          	sub    $0x10,%rsp
+  804736:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  80473a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80473e:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804743:	48 89 c7             	mov    %rax,%rdi
+  804746:	48 b8 54 47 80 00 00 	movabs $0x804754,%rax
+  80474d:	00 00 00 
+  804750:	ff d0                	call   *%rax
+}
+  804752:	c9                   	leave
+  804753:	c3                   	ret
+
+0000000000804754 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804754:	55                   	push   %rbp
+  804755:	48 89 e5             	mov    %rsp,%rbp
+  804758:	48 83 ec 50          	sub    $0x50,%rsp
+  80475c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804760:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804764:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80476b:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80476c:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804771:	74 0a                	je     80477d <pipe_size+0x29>
+  804773:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  80477a:	00 
+  80477b:	76 0a                	jbe    804787 <pipe_size+0x33>
+    return -E_INVAL;
+  80477d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804782:	e9 cc 02 00 00       	jmp    804a53 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804787:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80478b:	48 89 c7             	mov    %rax,%rdi
+  80478e:	48 b8 37 2f 80 00 00 	movabs $0x802f37,%rax
+  804795:	00 00 00 
+  804798:	ff d0                	call   *%rax
+  80479a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80479d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047a1:	0f 88 a8 02 00 00    	js     804a4f <pipe_size+0x2fb>
+  8047a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047ab:	ba 07 04 00 00       	mov    $0x407,%edx
+  8047b0:	48 89 c6             	mov    %rax,%rsi
+  8047b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047b8:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8047bf:	00 00 00 
+  8047c2:	ff d0                	call   *%rax
+  8047c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047cb:	0f 88 7e 02 00 00    	js     804a4f <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8047d1:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8047d5:	48 89 c7             	mov    %rax,%rdi
+  8047d8:	48 b8 37 2f 80 00 00 	movabs $0x802f37,%rax
+  8047df:	00 00 00 
+  8047e2:	ff d0                	call   *%rax
+  8047e4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047e7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047eb:	0f 88 43 02 00 00    	js     804a34 <pipe_size+0x2e0>
+  8047f1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047f5:	ba 07 04 00 00       	mov    $0x407,%edx
+  8047fa:	48 89 c6             	mov    %rax,%rsi
+  8047fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804802:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  804809:	00 00 00 
+  80480c:	ff d0                	call   *%rax
+  80480e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804811:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804815:	0f 88 19 02 00 00    	js     804a34 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80481b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80481f:	48 89 c7             	mov    %rax,%rdi
+  804822:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  804829:	00 00 00 
+  80482c:	ff d0                	call   *%rax
+  80482e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804832:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804839:	00 
+  80483a:	e9 a2 00 00 00       	jmp    8048e1 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80483f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804843:	48 c1 e0 0c          	shl    $0xc,%rax
+  804847:	48 89 c2             	mov    %rax,%rdx
+  80484a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80484e:	48 01 d0             	add    %rdx,%rax
+  804851:	ba 07 04 00 00       	mov    $0x407,%edx
+  804856:	48 89 c6             	mov    %rax,%rsi
+  804859:	bf 00 00 00 00       	mov    $0x0,%edi
+  80485e:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  804865:	00 00 00 
+  804868:	ff d0                	call   *%rax
+  80486a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80486d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804871:	0f 88 37 01 00 00    	js     8049ae <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804877:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80487b:	48 89 c7             	mov    %rax,%rdi
+  80487e:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  804885:	00 00 00 
+  804888:	ff d0                	call   *%rax
+  80488a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80488e:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804892:	48 01 c2             	add    %rax,%rdx
+  804895:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804899:	48 c1 e0 0c          	shl    $0xc,%rax
+  80489d:	48 89 c1             	mov    %rax,%rcx
+  8048a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048a4:	48 01 c8             	add    %rcx,%rax
+  8048a7:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8048ad:	48 89 d1             	mov    %rdx,%rcx
+  8048b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048b5:	48 89 c6             	mov    %rax,%rsi
+  8048b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048bd:	48 b8 5a 28 80 00 00 	movabs $0x80285a,%rax
+  8048c4:	00 00 00 
+  8048c7:	ff d0                	call   *%rax
+  8048c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048cc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048d0:	79 0a                	jns    8048dc <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8048d2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8048d7:	e9 d3 00 00 00       	jmp    8049af <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8048dc:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8048e1:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8048e8:	00 
+  8048e9:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8048ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048f1:	48 01 d0             	add    %rdx,%rax
+  8048f4:	48 83 c0 1f          	add    $0x1f,%rax
+  8048f8:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8048fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804900:	ba 00 00 00 00       	mov    $0x0,%edx
+  804905:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804909:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80490d:	48 29 d0             	sub    %rdx,%rax
+  804910:	48 c1 e8 0c          	shr    $0xc,%rax
+  804914:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804918:	0f 82 21 ff ff ff    	jb     80483f <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80491e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804922:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804926:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80492a:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80492e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804932:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804936:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  80493d:	00 00 00 
+  804940:	8b 12                	mov    (%rdx),%edx
+  804942:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804944:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804948:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80494f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804953:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  80495a:	00 00 00 
+  80495d:	8b 12                	mov    (%rdx),%edx
+  80495f:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804961:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804965:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80496c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804970:	48 89 c7             	mov    %rax,%rdi
+  804973:	48 b8 e9 2e 80 00 00 	movabs $0x802ee9,%rax
+  80497a:	00 00 00 
+  80497d:	ff d0                	call   *%rax
+  80497f:	89 c2                	mov    %eax,%edx
+  804981:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804985:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804987:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80498b:	48 89 c7             	mov    %rax,%rdi
+  80498e:	48 b8 e9 2e 80 00 00 	movabs $0x802ee9,%rax
+  804995:	00 00 00 
+  804998:	ff d0                	call   *%rax
+  80499a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80499e:	48 83 c2 04          	add    $0x4,%rdx
+  8049a2:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8049a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049a9:	e9 a5 00 00 00       	jmp    804a53 <pipe_size+0x2ff>
+      goto err2;
+  8049ae:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8049af:	eb 58                	jmp    804a09 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8049b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049b5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8049b9:	48 89 c2             	mov    %rax,%rdx
+  8049bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049c0:	48 01 d0             	add    %rdx,%rax
+  8049c3:	48 89 c6             	mov    %rax,%rsi
+  8049c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049cb:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  8049d2:	00 00 00 
+  8049d5:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8049d7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049db:	48 89 c7             	mov    %rax,%rdi
+  8049de:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  8049e5:	00 00 00 
+  8049e8:	ff d0                	call   *%rax
+  8049ea:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8049ee:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8049f2:	48 01 d0             	add    %rdx,%rax
+  8049f5:	48 89 c6             	mov    %rax,%rsi
+  8049f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049fd:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  804a04:	00 00 00 
+  804a07:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804a09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a0d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a11:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804a15:	48 85 c0             	test   %rax,%rax
+  804a18:	75 97                	jne    8049b1 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804a1a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a1e:	48 89 c6             	mov    %rax,%rsi
+  804a21:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a26:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  804a2d:	00 00 00 
+  804a30:	ff d0                	call   *%rax
+  804a32:	eb 01                	jmp    804a35 <pipe_size+0x2e1>
+    goto err1;
+  804a34:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804a35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a39:	48 89 c6             	mov    %rax,%rsi
+  804a3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a41:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  804a48:	00 00 00 
+  804a4b:	ff d0                	call   *%rax
+  804a4d:	eb 01                	jmp    804a50 <pipe_size+0x2fc>
+    goto err;
+  804a4f:	90                   	nop
+err:
+  return r;
+  804a50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804a53:	c9                   	leave
+  804a54:	c3                   	ret
+
+0000000000804a55 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804a55:	55                   	push   %rbp
+  804a56:	48 89 e5             	mov    %rsp,%rbp
+  804a59:	53                   	push   %rbx
+  804a5a:	48 83 ec 28          	sub    $0x28,%rsp
+  804a5e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804a62:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804a66:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804a6d:	00 00 00 
+  804a70:	8b 40 04             	mov    0x4(%rax),%eax
+  804a73:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804a78:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804a7f:	00 00 00 
+  804a82:	48 98                	cltq
+  804a84:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804a8b:	48 01 d0             	add    %rdx,%rax
+  804a8e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804a94:	8b 00                	mov    (%rax),%eax
+  804a96:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804a99:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a9d:	48 89 c7             	mov    %rax,%rdi
+  804aa0:	48 b8 ca 55 80 00 00 	movabs $0x8055ca,%rax
+  804aa7:	00 00 00 
+  804aaa:	ff d0                	call   *%rax
+  804aac:	89 c3                	mov    %eax,%ebx
+  804aae:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ab2:	48 89 c7             	mov    %rax,%rdi
+  804ab5:	48 b8 ca 55 80 00 00 	movabs $0x8055ca,%rax
+  804abc:	00 00 00 
+  804abf:	ff d0                	call   *%rax
+  804ac1:	39 c3                	cmp    %eax,%ebx
+  804ac3:	0f 94 c0             	sete   %al
+  804ac6:	0f b6 c0             	movzbl %al,%eax
+  804ac9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804acc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ad3:	00 00 00 
+  804ad6:	8b 40 04             	mov    0x4(%rax),%eax
+  804ad9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ade:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ae5:	00 00 00 
+  804ae8:	48 98                	cltq
+  804aea:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804af1:	48 01 d0             	add    %rdx,%rax
+  804af4:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804afa:	8b 00                	mov    (%rax),%eax
+  804afc:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804aff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b02:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b05:	75 05                	jne    804b0c <_pipeisclosed+0xb7>
+      return ret;
+  804b07:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b0a:	eb 68                	jmp    804b74 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804b0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b0f:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b12:	0f 84 4e ff ff ff    	je     804a66 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804b18:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b1f:	00 00 00 
+  804b22:	8b 40 04             	mov    0x4(%rax),%eax
+  804b25:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b2a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b31:	00 00 00 
+  804b34:	48 98                	cltq
+  804b36:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b3d:	48 01 d0             	add    %rdx,%rax
+  804b40:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b46:	8b 10                	mov    (%rax),%edx
+  804b48:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804b4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b4e:	89 c6                	mov    %eax,%esi
+  804b50:	48 b8 58 5d 80 00 00 	movabs $0x805d58,%rax
+  804b57:	00 00 00 
+  804b5a:	48 89 c7             	mov    %rax,%rdi
+  804b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b62:	49 b8 04 08 80 00 00 	movabs $0x800804,%r8
+  804b69:	00 00 00 
+  804b6c:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804b6f:	e9 f2 fe ff ff       	jmp    804a66 <_pipeisclosed+0x11>
+  }
+}
+  804b74:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804b78:	c9                   	leave
+  804b79:	c3                   	ret
+
+0000000000804b7a <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804b7a:	55                   	push   %rbp
+  804b7b:	48 89 e5             	mov    %rsp,%rbp
+  804b7e:	48 83 ec 30          	sub    $0x30,%rsp
+  804b82:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804b85:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804b89:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b8c:	48 89 d6             	mov    %rdx,%rsi
+  804b8f:	89 c7                	mov    %eax,%edi
+  804b91:	48 b8 19 30 80 00 00 	movabs $0x803019,%rax
+  804b98:	00 00 00 
+  804b9b:	ff d0                	call   *%rax
+  804b9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ba0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ba4:	79 05                	jns    804bab <pipeisclosed+0x31>
+    return r;
+  804ba6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ba9:	eb 31                	jmp    804bdc <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804bab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804baf:	48 89 c7             	mov    %rax,%rdi
+  804bb2:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  804bb9:	00 00 00 
+  804bbc:	ff d0                	call   *%rax
+  804bbe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804bc2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bc6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bca:	48 89 d6             	mov    %rdx,%rsi
+  804bcd:	48 89 c7             	mov    %rax,%rdi
+  804bd0:	48 b8 55 4a 80 00 00 	movabs $0x804a55,%rax
+  804bd7:	00 00 00 
+  804bda:	ff d0                	call   *%rax
+}
+  804bdc:	c9                   	leave
+  804bdd:	c3                   	ret
+
+0000000000804bde <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804bde:	55                   	push   %rbp
+  804bdf:	48 89 e5             	mov    %rsp,%rbp
+  804be2:	48 83 ec 10          	sub    $0x10,%rsp
+  804be6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804bea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bee:	8b 40 18             	mov    0x18(%rax),%eax
+  804bf1:	8d 50 01             	lea    0x1(%rax),%edx
+  804bf4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bf8:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804bfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bff:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804c02:	85 c0                	test   %eax,%eax
+  804c04:	74 27                	je     804c2d <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804c06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c0a:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804c11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c15:	48 83 c0 18          	add    $0x18,%rax
+  804c19:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804c1e:	48 89 c7             	mov    %rax,%rdi
+  804c21:	48 b8 fd 2b 80 00 00 	movabs $0x802bfd,%rax
+  804c28:	00 00 00 
+  804c2b:	ff d0                	call   *%rax
+  }
+}
+  804c2d:	90                   	nop
+  804c2e:	c9                   	leave
+  804c2f:	c3                   	ret
+
+0000000000804c30 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804c30:	55                   	push   %rbp
+  804c31:	48 89 e5             	mov    %rsp,%rbp
+  804c34:	48 83 ec 10          	sub    $0x10,%rsp
+  804c38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c3c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804c3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c43:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804c4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c4e:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804c52:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804c55:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804c5c:	89 c6                	mov    %eax,%esi
+  804c5e:	48 89 cf             	mov    %rcx,%rdi
+  804c61:	48 b8 ae 2b 80 00 00 	movabs $0x802bae,%rax
+  804c68:	00 00 00 
+  804c6b:	ff d0                	call   *%rax
+}
+  804c6d:	90                   	nop
+  804c6e:	c9                   	leave
+  804c6f:	c3                   	ret
+
+0000000000804c70 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804c70:	55                   	push   %rbp
+  804c71:	48 89 e5             	mov    %rsp,%rbp
+  804c74:	48 83 ec 70          	sub    $0x70,%rsp
+  804c78:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804c7c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804c80:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804c84:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804c88:	48 89 c7             	mov    %rax,%rdi
+  804c8b:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  804c92:	00 00 00 
+  804c95:	ff d0                	call   *%rax
+  804c97:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804c9b:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804ca0:	75 0a                	jne    804cac <devpipe_read+0x3c>
+    return 0;
+  804ca2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ca7:	e9 63 01 00 00       	jmp    804e0f <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804cac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cb0:	8b 40 18             	mov    0x18(%rax),%eax
+  804cb3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804cb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cba:	48 8b 10             	mov    (%rax),%rdx
+  804cbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cc1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804cc5:	48 39 c2             	cmp    %rax,%rdx
+  804cc8:	75 42                	jne    804d0c <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804cca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804cce:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804cd2:	48 89 d6             	mov    %rdx,%rsi
+  804cd5:	48 89 c7             	mov    %rax,%rdi
+  804cd8:	48 b8 55 4a 80 00 00 	movabs $0x804a55,%rax
+  804cdf:	00 00 00 
+  804ce2:	ff d0                	call   *%rax
+  804ce4:	85 c0                	test   %eax,%eax
+  804ce6:	74 0a                	je     804cf2 <devpipe_read+0x82>
+      return 0;
+  804ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ced:	e9 1d 01 00 00       	jmp    804e0f <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804cf2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804cf5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cf9:	89 d6                	mov    %edx,%esi
+  804cfb:	48 89 c7             	mov    %rax,%rdi
+  804cfe:	48 b8 30 4c 80 00 00 	movabs $0x804c30,%rax
+  804d05:	00 00 00 
+  804d08:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804d0a:	eb a0                	jmp    804cac <devpipe_read+0x3c>
+      break;
+  804d0c:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804d0d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804d11:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804d15:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d19:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804d1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d21:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804d25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d29:	48 8b 00             	mov    (%rax),%rax
+  804d2c:	48 29 c2             	sub    %rax,%rdx
+  804d2f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804d33:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804d37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d3b:	48 39 c2             	cmp    %rax,%rdx
+  804d3e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d42:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804d46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d4a:	48 8b 00             	mov    (%rax),%rax
+  804d4d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d51:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804d55:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d5a:	48 f7 f1             	div    %rcx
+  804d5d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804d61:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d65:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804d69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d6d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804d71:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804d75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d79:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804d7d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d81:	48 39 c2             	cmp    %rax,%rdx
+  804d84:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d88:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d90:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804d94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d98:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804d9c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804da0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804da4:	48 89 ce             	mov    %rcx,%rsi
+  804da7:	48 89 c7             	mov    %rax,%rdi
+  804daa:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  804db1:	00 00 00 
+  804db4:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804db6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804dba:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804dbe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804dc2:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804dc6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804dca:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804dce:	48 01 d1             	add    %rdx,%rcx
+  804dd1:	48 89 c2             	mov    %rax,%rdx
+  804dd4:	48 89 cf             	mov    %rcx,%rdi
+  804dd7:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  804dde:	00 00 00 
+  804de1:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804de3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804de7:	48 8b 10             	mov    (%rax),%rdx
+  804dea:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804dee:	48 01 c2             	add    %rax,%rdx
+  804df1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804df5:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804df8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dfc:	48 89 c7             	mov    %rax,%rdi
+  804dff:	48 b8 de 4b 80 00 00 	movabs $0x804bde,%rax
+  804e06:	00 00 00 
+  804e09:	ff d0                	call   *%rax
+  return n;
+  804e0b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804e0f:	c9                   	leave
+  804e10:	c3                   	ret
+
+0000000000804e11 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e11:	55                   	push   %rbp
+  804e12:	48 89 e5             	mov    %rsp,%rbp
+  804e15:	48 83 ec 70          	sub    $0x70,%rsp
+  804e19:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804e1d:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804e21:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804e25:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e29:	48 89 c7             	mov    %rax,%rdi
+  804e2c:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  804e33:	00 00 00 
+  804e36:	ff d0                	call   *%rax
+  804e38:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804e3c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e40:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804e44:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804e4b:	00 
+  804e4c:	e9 b8 01 00 00       	jmp    805009 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804e51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e55:	8b 40 18             	mov    0x18(%rax),%eax
+  804e58:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804e5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e5f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e67:	48 8b 00             	mov    (%rax),%rax
+  804e6a:	48 29 c2             	sub    %rax,%rdx
+  804e6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e71:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e75:	48 39 c2             	cmp    %rax,%rdx
+  804e78:	75 4d                	jne    804ec7 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804e7a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804e7e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e82:	48 89 d6             	mov    %rdx,%rsi
+  804e85:	48 89 c7             	mov    %rax,%rdi
+  804e88:	48 b8 55 4a 80 00 00 	movabs $0x804a55,%rax
+  804e8f:	00 00 00 
+  804e92:	ff d0                	call   *%rax
+  804e94:	85 c0                	test   %eax,%eax
+  804e96:	74 0a                	je     804ea2 <devpipe_write+0x91>
+        return 0;
+  804e98:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e9d:	e9 79 01 00 00       	jmp    80501b <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804ea2:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804ea5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ea9:	89 d6                	mov    %edx,%esi
+  804eab:	48 89 c7             	mov    %rax,%rdi
+  804eae:	48 b8 30 4c 80 00 00 	movabs $0x804c30,%rax
+  804eb5:	00 00 00 
+  804eb8:	ff d0                	call   *%rax
+      m = 0;
+  804eba:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ec1:	00 
+      continue;
+  804ec2:	e9 3a 01 00 00       	jmp    805001 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804ec7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ecb:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804ecf:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804ed3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ed7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804edb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804edf:	48 8b 08             	mov    (%rax),%rcx
+  804ee2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ee6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804eea:	48 29 c1             	sub    %rax,%rcx
+  804eed:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804ef1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804ef5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804ef9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804efd:	48 39 c2             	cmp    %rax,%rdx
+  804f00:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f04:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804f08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f0c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f10:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f14:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f1d:	48 f7 f1             	div    %rcx
+  804f20:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804f24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f28:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804f2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f30:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f34:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804f38:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804f3c:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804f40:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f44:	48 39 c2             	cmp    %rax,%rdx
+  804f47:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f4b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804f4f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f53:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804f57:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f5b:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804f5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804f63:	48 01 d1             	add    %rdx,%rcx
+  804f66:	48 89 c2             	mov    %rax,%rdx
+  804f69:	48 89 cf             	mov    %rcx,%rdi
+  804f6c:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  804f73:	00 00 00 
+  804f76:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804f78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f7c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f80:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804f84:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804f88:	73 4d                	jae    804fd7 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804f8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f8e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804f96:	48 29 c2             	sub    %rax,%rdx
+  804f99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f9d:	48 01 c2             	add    %rax,%rdx
+  804fa0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fa8:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804fac:	48 89 c1             	mov    %rax,%rcx
+  804faf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb3:	48 01 c1             	add    %rax,%rcx
+  804fb6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804fba:	48 01 c1             	add    %rax,%rcx
+  804fbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fc1:	48 83 c0 20          	add    $0x20,%rax
+  804fc5:	48 89 ce             	mov    %rcx,%rsi
+  804fc8:	48 89 c7             	mov    %rax,%rdi
+  804fcb:	48 b8 fd 1e 80 00 00 	movabs $0x801efd,%rax
+  804fd2:	00 00 00 
+  804fd5:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804fd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fdb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804fdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fe3:	48 01 c2             	add    %rax,%rdx
+  804fe6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fea:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804fee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff2:	48 89 c7             	mov    %rax,%rdi
+  804ff5:	48 b8 de 4b 80 00 00 	movabs $0x804bde,%rax
+  804ffc:	00 00 00 
+  804fff:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805001:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805005:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805009:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80500d:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805011:	0f 82 3a fe ff ff    	jb     804e51 <devpipe_write+0x40>
+  }
+
+  return i;
+  805017:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80501b:	c9                   	leave
+  80501c:	c3                   	ret
+
+000000000080501d <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80501d:	55                   	push   %rbp
+  80501e:	48 89 e5             	mov    %rsp,%rbp
+  805021:	48 83 ec 40          	sub    $0x40,%rsp
+  805025:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805029:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80502c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805030:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805034:	48 89 c7             	mov    %rax,%rdi
+  805037:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  80503e:	00 00 00 
+  805041:	ff d0                	call   *%rax
+  805043:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805047:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80504e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805052:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805056:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80505a:	48 89 d6             	mov    %rdx,%rsi
+  80505d:	48 89 c7             	mov    %rax,%rdi
+  805060:	48 b8 df 39 80 00 00 	movabs $0x8039df,%rax
+  805067:	00 00 00 
+  80506a:	ff d0                	call   *%rax
+  80506c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80506f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805073:	79 08                	jns    80507d <devpipe_poll+0x60>
+    return r;
+  805075:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805078:	e9 85 00 00 00       	jmp    805102 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80507d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805080:	83 e0 01             	and    $0x1,%eax
+  805083:	85 c0                	test   %eax,%eax
+  805085:	74 18                	je     80509f <devpipe_poll+0x82>
+  805087:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80508b:	48 8b 10             	mov    (%rax),%rdx
+  80508e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805092:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805096:	48 39 c2             	cmp    %rax,%rdx
+  805099:	74 04                	je     80509f <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80509b:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80509f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050a2:	83 e0 02             	and    $0x2,%eax
+  8050a5:	85 c0                	test   %eax,%eax
+  8050a7:	74 23                	je     8050cc <devpipe_poll+0xaf>
+  8050a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050ad:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8050b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050b5:	48 8b 00             	mov    (%rax),%rax
+  8050b8:	48 29 c2             	sub    %rax,%rdx
+  8050bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050bf:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8050c3:	48 39 c2             	cmp    %rax,%rdx
+  8050c6:	73 04                	jae    8050cc <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8050c8:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8050cc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8050d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8050d4:	48 89 d6             	mov    %rdx,%rsi
+  8050d7:	48 89 c7             	mov    %rax,%rdi
+  8050da:	48 b8 55 4a 80 00 00 	movabs $0x804a55,%rax
+  8050e1:	00 00 00 
+  8050e4:	ff d0                	call   *%rax
+  8050e6:	85 c0                	test   %eax,%eax
+  8050e8:	74 04                	je     8050ee <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8050ea:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8050ee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8050f2:	75 0b                	jne    8050ff <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8050f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050f8:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8050ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805102:	c9                   	leave
+  805103:	c3                   	ret
+
+0000000000805104 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805104:	55                   	push   %rbp
+  805105:	48 89 e5             	mov    %rsp,%rbp
+  805108:	48 83 ec 20          	sub    $0x20,%rsp
+  80510c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805110:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805114:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805118:	48 89 c7             	mov    %rax,%rdi
+  80511b:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  805122:	00 00 00 
+  805125:	ff d0                	call   *%rax
+  805127:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  80512b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80512f:	48 ba 89 5d 80 00 00 	movabs $0x805d89,%rdx
+  805136:	00 00 00 
+  805139:	48 89 d6             	mov    %rdx,%rsi
+  80513c:	48 89 c7             	mov    %rax,%rdi
+  80513f:	48 b8 b4 17 80 00 00 	movabs $0x8017b4,%rax
+  805146:	00 00 00 
+  805149:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  80514b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80514f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805153:	89 c1                	mov    %eax,%ecx
+  805155:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805159:	48 8b 00             	mov    (%rax),%rax
+  80515c:	89 c2                	mov    %eax,%edx
+  80515e:	89 c8                	mov    %ecx,%eax
+  805160:	29 d0                	sub    %edx,%eax
+  805162:	89 c2                	mov    %eax,%edx
+  805164:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805168:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80516e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805172:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805179:	00 00 00 
+  stat->st_dev   = &devpipe;
+  80517c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805180:	48 b9 c0 60 80 00 00 	movabs $0x8060c0,%rcx
+  805187:	00 00 00 
+  80518a:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805191:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805196:	c9                   	leave
+  805197:	c3                   	ret
+
+0000000000805198 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805198:	55                   	push   %rbp
+  805199:	48 89 e5             	mov    %rsp,%rbp
+  80519c:	48 83 ec 40          	sub    $0x40,%rsp
+  8051a0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8051a4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051a8:	48 89 c7             	mov    %rax,%rdi
+  8051ab:	48 b8 0c 2f 80 00 00 	movabs $0x802f0c,%rax
+  8051b2:	00 00 00 
+  8051b5:	ff d0                	call   *%rax
+  8051b7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8051bb:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8051c2:	00 
+  8051c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051c7:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8051cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051cf:	48 01 d0             	add    %rdx,%rax
+  8051d2:	48 83 c0 1f          	add    $0x1f,%rax
+  8051d6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8051da:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051e3:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8051e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051eb:	48 29 d0             	sub    %rdx,%rax
+  8051ee:	48 c1 e8 0c          	shr    $0xc,%rax
+  8051f2:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8051f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051fa:	48 89 c6             	mov    %rax,%rsi
+  8051fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  805202:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  805209:	00 00 00 
+  80520c:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80520e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805212:	48 89 c7             	mov    %rax,%rdi
+  805215:	48 b8 de 4b 80 00 00 	movabs $0x804bde,%rax
+  80521c:	00 00 00 
+  80521f:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805221:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805225:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805229:	eb 2f                	jmp    80525a <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  80522b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80522f:	48 83 e8 01          	sub    $0x1,%rax
+  805233:	48 c1 e0 0c          	shl    $0xc,%rax
+  805237:	48 89 c2             	mov    %rax,%rdx
+  80523a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80523e:	48 01 d0             	add    %rdx,%rax
+  805241:	48 89 c6             	mov    %rax,%rsi
+  805244:	bf 00 00 00 00       	mov    $0x0,%edi
+  805249:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  805250:	00 00 00 
+  805253:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805255:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80525a:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80525f:	77 ca                	ja     80522b <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805261:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805265:	48 89 c6             	mov    %rax,%rsi
+  805268:	bf 00 00 00 00       	mov    $0x0,%edi
+  80526d:	48 b8 ba 28 80 00 00 	movabs $0x8028ba,%rax
+  805274:	00 00 00 
+  805277:	ff d0                	call   *%rax
+}
+  805279:	c9                   	leave
+  80527a:	c3                   	ret
+
+000000000080527b <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  80527b:	55                   	push   %rbp
+  80527c:	48 89 e5             	mov    %rsp,%rbp
+  80527f:	48 83 ec 08          	sub    $0x8,%rsp
+  805283:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805286:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80528a:	75 10                	jne    80529c <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80528c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805293:	00 00 00 
+  805296:	8b 00                	mov    (%rax),%eax
+  805298:	48 98                	cltq
+  80529a:	eb 05                	jmp    8052a1 <vsyscall+0x26>
+  }
+  return 0;
+  80529c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052a1:	c9                   	leave
+  8052a2:	c3                   	ret
+
+00000000008052a3 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8052a3:	55                   	push   %rbp
+  8052a4:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8052a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ac:	48 b8 7b 52 80 00 00 	movabs $0x80527b,%rax
+  8052b3:	00 00 00 
+  8052b6:	ff d0                	call   *%rax
+}
+  8052b8:	5d                   	pop    %rbp
+  8052b9:	c3                   	ret
+
+00000000008052ba <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  8052ba:	55                   	push   %rbp
+  8052bb:	48 89 e5             	mov    %rsp,%rbp
+  8052be:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  8052c2:	0f 31                	rdtsc
+  8052c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8052c7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  8052ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8052cd:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8052d0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8052d4:	48 09 d0             	or     %rdx,%rax
+  8052d7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8052db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  8052df:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8052e3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8052ea:	00 00 00 
+  8052ed:	8b 40 08             	mov    0x8(%rax),%eax
+  8052f0:	48 98                	cltq
+  8052f2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  8052f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052ff:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805303:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80530a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80530e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805313:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805317:	48 89 d0             	mov    %rdx,%rax
+  80531a:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805321:	ba 00 00 00 00       	mov    $0x0,%edx
+  805326:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80532a:	48 01 c8             	add    %rcx,%rax
+}
+  80532d:	c9                   	leave
+  80532e:	c3                   	ret
+
+000000000080532f <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80532f:	55                   	push   %rbp
+  805330:	48 89 e5             	mov    %rsp,%rbp
+  805333:	48 83 ec 20          	sub    $0x20,%rsp
+  805337:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80533b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80533f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805343:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805347:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80534b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80534f:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805356:	48 89 c7             	mov    %rax,%rdi
+  805359:	48 b8 67 53 80 00 00 	movabs $0x805367,%rax
+  805360:	00 00 00 
+  805363:	ff d0                	call   *%rax
+}
+  805365:	c9                   	leave
+  805366:	c3                   	ret
+
+0000000000805367 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805367:	55                   	push   %rbp
+  805368:	48 89 e5             	mov    %rsp,%rbp
+  80536b:	48 83 ec 30          	sub    $0x30,%rsp
+  80536f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805373:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805377:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80537b:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80537f:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805384:	75 0e                	jne    805394 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805386:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80538d:	00 00 00 
+  805390:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805394:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805399:	75 18                	jne    8053b3 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  80539b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80539f:	48 89 c7             	mov    %rax,%rdi
+  8053a2:	48 b8 42 2a 80 00 00 	movabs $0x802a42,%rax
+  8053a9:	00 00 00 
+  8053ac:	ff d0                	call   *%rax
+  8053ae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8053b1:	eb 1d                	jmp    8053d0 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8053b3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8053b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053bb:	48 89 d6             	mov    %rdx,%rsi
+  8053be:	48 89 c7             	mov    %rax,%rdi
+  8053c1:	48 b8 88 2a 80 00 00 	movabs $0x802a88,%rax
+  8053c8:	00 00 00 
+  8053cb:	ff d0                	call   *%rax
+  8053cd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  8053d0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8053d4:	79 2a                	jns    805400 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  8053d6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8053db:	74 0a                	je     8053e7 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  8053dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053e1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  8053e7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8053ec:	74 0a                	je     8053f8 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  8053ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8053f2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  8053f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053fb:	e9 aa 00 00 00       	jmp    8054aa <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805400:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805405:	74 36                	je     80543d <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805407:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80540e:	00 00 00 
+  805411:	8b 40 04             	mov    0x4(%rax),%eax
+  805414:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805419:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805420:	00 00 00 
+  805423:	48 98                	cltq
+  805425:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80542c:	48 01 d0             	add    %rdx,%rax
+  80542f:	48 05 24 01 00 00    	add    $0x124,%rax
+  805435:	8b 10                	mov    (%rax),%edx
+  805437:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80543b:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  80543d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805442:	74 36                	je     80547a <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805444:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80544b:	00 00 00 
+  80544e:	8b 40 04             	mov    0x4(%rax),%eax
+  805451:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805456:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80545d:	00 00 00 
+  805460:	48 98                	cltq
+  805462:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805469:	48 01 d0             	add    %rdx,%rax
+  80546c:	48 05 28 01 00 00    	add    $0x128,%rax
+  805472:	8b 10                	mov    (%rax),%edx
+  805474:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805478:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  80547a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805481:	00 00 00 
+  805484:	8b 40 04             	mov    0x4(%rax),%eax
+  805487:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80548c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805493:	00 00 00 
+  805496:	48 98                	cltq
+  805498:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80549f:	48 01 d0             	add    %rdx,%rax
+  8054a2:	48 05 20 01 00 00    	add    $0x120,%rax
+  8054a8:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8054aa:	c9                   	leave
+  8054ab:	c3                   	ret
+
+00000000008054ac <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8054ac:	55                   	push   %rbp
+  8054ad:	48 89 e5             	mov    %rsp,%rbp
+  8054b0:	48 83 ec 30          	sub    $0x30,%rsp
+  8054b4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8054b7:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8054ba:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8054be:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8054c1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8054c6:	75 5e                	jne    805526 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  8054c8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8054cf:	00 00 00 
+  8054d2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8054d6:	eb 4e                	jmp    805526 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8054d8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054dc:	79 3c                	jns    80551a <ipc_send+0x6e>
+  8054de:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8054e2:	74 36                	je     80551a <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8054e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8054e7:	89 c1                	mov    %eax,%ecx
+  8054e9:	48 b8 90 5d 80 00 00 	movabs $0x805d90,%rax
+  8054f0:	00 00 00 
+  8054f3:	48 89 c2             	mov    %rax,%rdx
+  8054f6:	be 54 00 00 00       	mov    $0x54,%esi
+  8054fb:	48 b8 b6 5d 80 00 00 	movabs $0x805db6,%rax
+  805502:	00 00 00 
+  805505:	48 89 c7             	mov    %rax,%rdi
+  805508:	b8 00 00 00 00       	mov    $0x0,%eax
+  80550d:	49 b8 e5 05 80 00 00 	movabs $0x8005e5,%r8
+  805514:	00 00 00 
+  805517:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  80551a:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  805521:	00 00 00 
+  805524:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805526:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805529:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80552c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805530:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805533:	89 c7                	mov    %eax,%edi
+  805535:	48 b8 eb 29 80 00 00 	movabs $0x8029eb,%rax
+  80553c:	00 00 00 
+  80553f:	ff d0                	call   *%rax
+  805541:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805544:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805548:	75 8e                	jne    8054d8 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  80554a:	48 b8 c5 27 80 00 00 	movabs $0x8027c5,%rax
+  805551:	00 00 00 
+  805554:	ff d0                	call   *%rax
+}
+  805556:	90                   	nop
+  805557:	c9                   	leave
+  805558:	c3                   	ret
+
+0000000000805559 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805559:	55                   	push   %rbp
+  80555a:	48 89 e5             	mov    %rsp,%rbp
+  80555d:	48 83 ec 18          	sub    $0x18,%rsp
+  805561:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805564:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80556b:	eb 4d                	jmp    8055ba <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  80556d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805574:	00 00 00 
+  805577:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80557a:	48 98                	cltq
+  80557c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805583:	48 01 d0             	add    %rdx,%rax
+  805586:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  80558c:	8b 00                	mov    (%rax),%eax
+  80558e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805591:	75 23                	jne    8055b6 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805593:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80559a:	00 00 00 
+  80559d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055a0:	48 98                	cltq
+  8055a2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8055a9:	48 01 d0             	add    %rdx,%rax
+  8055ac:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8055b2:	8b 00                	mov    (%rax),%eax
+  8055b4:	eb 12                	jmp    8055c8 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8055b6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8055ba:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8055c1:	7e aa                	jle    80556d <ipc_find_env+0x14>
+  return 0;
+  8055c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055c8:	c9                   	leave
+  8055c9:	c3                   	ret
+
+00000000008055ca <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  8055ca:	55                   	push   %rbp
+  8055cb:	48 89 e5             	mov    %rsp,%rbp
+  8055ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8055d2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  8055d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055da:	48 c1 e8 27          	shr    $0x27,%rax
+  8055de:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8055e3:	48 89 c2             	mov    %rax,%rdx
+  8055e6:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8055ed:	01 00 00 
+  8055f0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8055f4:	83 e0 01             	and    $0x1,%eax
+  8055f7:	48 85 c0             	test   %rax,%rax
+  8055fa:	74 63                	je     80565f <pageref+0x95>
+  8055fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805600:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805604:	48 89 c2             	mov    %rax,%rdx
+  805607:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80560e:	01 00 00 
+  805611:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805615:	83 e0 01             	and    $0x1,%eax
+  805618:	48 85 c0             	test   %rax,%rax
+  80561b:	74 42                	je     80565f <pageref+0x95>
+  80561d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805621:	48 c1 e8 15          	shr    $0x15,%rax
+  805625:	48 89 c2             	mov    %rax,%rdx
+  805628:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80562f:	01 00 00 
+  805632:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805636:	83 e0 01             	and    $0x1,%eax
+  805639:	48 85 c0             	test   %rax,%rax
+  80563c:	74 21                	je     80565f <pageref+0x95>
+  80563e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805642:	48 c1 e8 0c          	shr    $0xc,%rax
+  805646:	48 89 c2             	mov    %rax,%rdx
+  805649:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805650:	01 00 00 
+  805653:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805657:	83 e0 01             	and    $0x1,%eax
+  80565a:	48 85 c0             	test   %rax,%rax
+  80565d:	75 07                	jne    805666 <pageref+0x9c>
+    return 0;
+  80565f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805664:	eb 53                	jmp    8056b9 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805666:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80566a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80566e:	48 89 c2             	mov    %rax,%rdx
+  805671:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805678:	01 00 00 
+  80567b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80567f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805683:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805687:	83 e0 01             	and    $0x1,%eax
+  80568a:	48 85 c0             	test   %rax,%rax
+  80568d:	75 07                	jne    805696 <pageref+0xcc>
+    return 0;
+  80568f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805694:	eb 23                	jmp    8056b9 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805696:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80569a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80569e:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8056a5:	00 00 00 
+  8056a8:	48 c1 e0 04          	shl    $0x4,%rax
+  8056ac:	48 01 d0             	add    %rdx,%rax
+  8056af:	48 83 c0 08          	add    $0x8,%rax
+  8056b3:	0f b7 00             	movzwl (%rax),%eax
+  8056b6:	0f b7 c0             	movzwl %ax,%eax
+}
+  8056b9:	c9                   	leave
+  8056ba:	c3                   	ret
+  8056bb:	90                   	nop
@@ -0,0 +1,10410 @@
+
+obj/user/testpipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 82 05 00 00       	call   8005ae <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80003d:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  800043:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  char buf[100];
+  int i, pid, p[2];
+
+  binaryname = "pipereadeof";
+  80004a:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  800051:	00 00 00 
+  800054:	48 be c4 68 80 00 00 	movabs $0x8068c4,%rsi
+  80005b:	00 00 00 
+  80005e:	48 89 30             	mov    %rsi,(%rax)
+
+  if ((i = pipe(p)) < 0)
+  800061:	48 8d 45 88          	lea    -0x78(%rbp),%rax
+  800065:	48 89 c7             	mov    %rax,%rdi
+  800068:	48 b8 e5 49 80 00 00 	movabs $0x8049e5,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800077:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80007b:	79 36                	jns    8000b3 <umain+0x81>
+    panic("pipe: %i", i);
+  80007d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800080:	89 c1                	mov    %eax,%ecx
+  800082:	48 b8 d0 68 80 00 00 	movabs $0x8068d0,%rax
+  800089:	00 00 00 
+  80008c:	48 89 c2             	mov    %rax,%rdx
+  80008f:	be 0d 00 00 00       	mov    $0xd,%esi
+  800094:	48 b8 d9 68 80 00 00 	movabs $0x8068d9,%rax
+  80009b:	00 00 00 
+  80009e:	48 89 c7             	mov    %rax,%rdi
+  8000a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a6:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  8000ad:	00 00 00 
+  8000b0:	41 ff d0             	call   *%r8
+
+  if ((pid = fork()) < 0)
+  8000b3:	48 b8 8b 34 80 00 00 	movabs $0x80348b,%rax
+  8000ba:	00 00 00 
+  8000bd:	ff d0                	call   *%rax
+  8000bf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8000c2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000c6:	79 36                	jns    8000fe <umain+0xcc>
+    panic("fork: %i", i);
+  8000c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000cb:	89 c1                	mov    %eax,%ecx
+  8000cd:	48 b8 e9 68 80 00 00 	movabs $0x8068e9,%rax
+  8000d4:	00 00 00 
+  8000d7:	48 89 c2             	mov    %rax,%rdx
+  8000da:	be 10 00 00 00       	mov    $0x10,%esi
+  8000df:	48 b8 d9 68 80 00 00 	movabs $0x8068d9,%rax
+  8000e6:	00 00 00 
+  8000e9:	48 89 c7             	mov    %rax,%rdi
+  8000ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f1:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  8000f8:	00 00 00 
+  8000fb:	41 ff d0             	call   *%r8
+
+  if (pid == 0) {
+  8000fe:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800102:	0f 85 9c 01 00 00    	jne    8002a4 <umain+0x272>
+    cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800108:	8b 55 8c             	mov    -0x74(%rbp),%edx
+  80010b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800112:	00 00 00 
+  800115:	8b 40 04             	mov    0x4(%rax),%eax
+  800118:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80011d:	48 b9 00 e0 22 3c 80 	movabs $0x803c22e000,%rcx
+  800124:	00 00 00 
+  800127:	48 98                	cltq
+  800129:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800130:	48 01 c8             	add    %rcx,%rax
+  800133:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800139:	8b 00                	mov    (%rax),%eax
+  80013b:	89 c6                	mov    %eax,%esi
+  80013d:	48 b8 f2 68 80 00 00 	movabs $0x8068f2,%rax
+  800144:	00 00 00 
+  800147:	48 89 c7             	mov    %rax,%rdi
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  800156:	00 00 00 
+  800159:	ff d1                	call   *%rcx
+    close(p[1]);
+  80015b:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  80015e:	89 c7                	mov    %eax,%edi
+  800160:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  800167:	00 00 00 
+  80016a:	ff d0                	call   *%rax
+    cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  80016c:	8b 55 88             	mov    -0x78(%rbp),%edx
+  80016f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800176:	00 00 00 
+  800179:	8b 40 04             	mov    0x4(%rax),%eax
+  80017c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800181:	48 b9 00 e0 22 3c 80 	movabs $0x803c22e000,%rcx
+  800188:	00 00 00 
+  80018b:	48 98                	cltq
+  80018d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800194:	48 01 c8             	add    %rcx,%rax
+  800197:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80019d:	8b 00                	mov    (%rax),%eax
+  80019f:	89 c6                	mov    %eax,%esi
+  8001a1:	48 b8 0f 69 80 00 00 	movabs $0x80690f,%rax
+  8001a8:	00 00 00 
+  8001ab:	48 89 c7             	mov    %rax,%rdi
+  8001ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b3:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  8001ba:	00 00 00 
+  8001bd:	ff d1                	call   *%rcx
+    i = readn(p[0], buf, sizeof buf - 1);
+  8001bf:	8b 45 88             	mov    -0x78(%rbp),%eax
+  8001c2:	48 8d 4d 90          	lea    -0x70(%rbp),%rcx
+  8001c6:	ba 63 00 00 00       	mov    $0x63,%edx
+  8001cb:	48 89 ce             	mov    %rcx,%rsi
+  8001ce:	89 c7                	mov    %eax,%edi
+  8001d0:	48 b8 47 3c 80 00 00 	movabs $0x803c47,%rax
+  8001d7:	00 00 00 
+  8001da:	ff d0                	call   *%rax
+  8001dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+    if (i < 0)
+  8001df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8001e3:	79 36                	jns    80021b <umain+0x1e9>
+      panic("read: %i", i);
+  8001e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001e8:	89 c1                	mov    %eax,%ecx
+  8001ea:	48 b8 2c 69 80 00 00 	movabs $0x80692c,%rax
+  8001f1:	00 00 00 
+  8001f4:	48 89 c2             	mov    %rax,%rdx
+  8001f7:	be 18 00 00 00       	mov    $0x18,%esi
+  8001fc:	48 b8 d9 68 80 00 00 	movabs $0x8068d9,%rax
+  800203:	00 00 00 
+  800206:	48 89 c7             	mov    %rax,%rdi
+  800209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020e:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  800215:	00 00 00 
+  800218:	41 ff d0             	call   *%r8
+    buf[i] = 0;
+  80021b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80021e:	48 98                	cltq
+  800220:	c6 44 05 90 00       	movb   $0x0,-0x70(%rbp,%rax,1)
+    if (strcmp(buf, msg) == 0)
+  800225:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80022c:	00 00 00 
+  80022f:	48 8b 10             	mov    (%rax),%rdx
+  800232:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  800236:	48 89 d6             	mov    %rdx,%rsi
+  800239:	48 89 c7             	mov    %rax,%rdi
+  80023c:	48 b8 6f 1a 80 00 00 	movabs $0x801a6f,%rax
+  800243:	00 00 00 
+  800246:	ff d0                	call   *%rax
+  800248:	85 c0                	test   %eax,%eax
+  80024a:	75 20                	jne    80026c <umain+0x23a>
+      cprintf("\npipe read closed properly\n");
+  80024c:	48 b8 35 69 80 00 00 	movabs $0x806935,%rax
+  800253:	00 00 00 
+  800256:	48 89 c7             	mov    %rax,%rdi
+  800259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025e:	48 ba 74 08 80 00 00 	movabs $0x800874,%rdx
+  800265:	00 00 00 
+  800268:	ff d2                	call   *%rdx
+  80026a:	eb 27                	jmp    800293 <umain+0x261>
+    else
+      cprintf("\ngot %d bytes: %s\n", i, buf);
+  80026c:	48 8d 55 90          	lea    -0x70(%rbp),%rdx
+  800270:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800273:	89 c6                	mov    %eax,%esi
+  800275:	48 b8 51 69 80 00 00 	movabs $0x806951,%rax
+  80027c:	00 00 00 
+  80027f:	48 89 c7             	mov    %rax,%rdi
+  800282:	b8 00 00 00 00       	mov    $0x0,%eax
+  800287:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  80028e:	00 00 00 
+  800291:	ff d1                	call   *%rcx
+    exit();
+  800293:	48 b8 31 06 80 00 00 	movabs $0x800631,%rax
+  80029a:	00 00 00 
+  80029d:	ff d0                	call   *%rax
+  80029f:	e9 62 01 00 00       	jmp    800406 <umain+0x3d4>
+  } else {
+    cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8002a4:	8b 55 88             	mov    -0x78(%rbp),%edx
+  8002a7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8002ae:	00 00 00 
+  8002b1:	8b 40 04             	mov    0x4(%rax),%eax
+  8002b4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002b9:	48 b9 00 e0 22 3c 80 	movabs $0x803c22e000,%rcx
+  8002c0:	00 00 00 
+  8002c3:	48 98                	cltq
+  8002c5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8002cc:	48 01 c8             	add    %rcx,%rax
+  8002cf:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8002d5:	8b 00                	mov    (%rax),%eax
+  8002d7:	89 c6                	mov    %eax,%esi
+  8002d9:	48 b8 f2 68 80 00 00 	movabs $0x8068f2,%rax
+  8002e0:	00 00 00 
+  8002e3:	48 89 c7             	mov    %rax,%rdi
+  8002e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002eb:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  8002f2:	00 00 00 
+  8002f5:	ff d1                	call   *%rcx
+    close(p[0]);
+  8002f7:	8b 45 88             	mov    -0x78(%rbp),%eax
+  8002fa:	89 c7                	mov    %eax,%edi
+  8002fc:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  800303:	00 00 00 
+  800306:	ff d0                	call   *%rax
+    cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  800308:	8b 55 8c             	mov    -0x74(%rbp),%edx
+  80030b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800312:	00 00 00 
+  800315:	8b 40 04             	mov    0x4(%rax),%eax
+  800318:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80031d:	48 b9 00 e0 22 3c 80 	movabs $0x803c22e000,%rcx
+  800324:	00 00 00 
+  800327:	48 98                	cltq
+  800329:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800330:	48 01 c8             	add    %rcx,%rax
+  800333:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800339:	8b 00                	mov    (%rax),%eax
+  80033b:	89 c6                	mov    %eax,%esi
+  80033d:	48 b8 64 69 80 00 00 	movabs $0x806964,%rax
+  800344:	00 00 00 
+  800347:	48 89 c7             	mov    %rax,%rdi
+  80034a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034f:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  800356:	00 00 00 
+  800359:	ff d1                	call   *%rcx
+    if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  80035b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800362:	00 00 00 
+  800365:	48 8b 00             	mov    (%rax),%rax
+  800368:	48 89 c7             	mov    %rax,%rdi
+  80036b:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  800372:	00 00 00 
+  800375:	ff d0                	call   *%rax
+  800377:	48 63 d0             	movslq %eax,%rdx
+  80037a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800381:	00 00 00 
+  800384:	48 8b 08             	mov    (%rax),%rcx
+  800387:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  80038a:	48 89 ce             	mov    %rcx,%rsi
+  80038d:	89 c7                	mov    %eax,%edi
+  80038f:	48 b8 c1 3c 80 00 00 	movabs $0x803cc1,%rax
+  800396:	00 00 00 
+  800399:	ff d0                	call   *%rax
+  80039b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80039e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8003a5:	00 00 00 
+  8003a8:	48 8b 00             	mov    (%rax),%rax
+  8003ab:	48 89 c7             	mov    %rax,%rdi
+  8003ae:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+  8003ba:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  8003bd:	74 36                	je     8003f5 <umain+0x3c3>
+      panic("write: %i", i);
+  8003bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8003c2:	89 c1                	mov    %eax,%ecx
+  8003c4:	48 b8 81 69 80 00 00 	movabs $0x806981,%rax
+  8003cb:	00 00 00 
+  8003ce:	48 89 c2             	mov    %rax,%rdx
+  8003d1:	be 24 00 00 00       	mov    $0x24,%esi
+  8003d6:	48 b8 d9 68 80 00 00 	movabs $0x8068d9,%rax
+  8003dd:	00 00 00 
+  8003e0:	48 89 c7             	mov    %rax,%rdi
+  8003e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e8:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  8003ef:	00 00 00 
+  8003f2:	41 ff d0             	call   *%r8
+    close(p[1]);
+  8003f5:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  8003f8:	89 c7                	mov    %eax,%edi
+  8003fa:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  800401:	00 00 00 
+  800404:	ff d0                	call   *%rax
+  }
+  wait(pid);
+  800406:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800409:	89 c7                	mov    %eax,%edi
+  80040b:	48 b8 32 55 80 00 00 	movabs $0x805532,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+
+  binaryname = "pipewriteeof";
+  800417:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80041e:	00 00 00 
+  800421:	48 be 8b 69 80 00 00 	movabs $0x80698b,%rsi
+  800428:	00 00 00 
+  80042b:	48 89 30             	mov    %rsi,(%rax)
+  if ((i = pipe(p)) < 0)
+  80042e:	48 8d 45 88          	lea    -0x78(%rbp),%rax
+  800432:	48 89 c7             	mov    %rax,%rdi
+  800435:	48 b8 e5 49 80 00 00 	movabs $0x8049e5,%rax
+  80043c:	00 00 00 
+  80043f:	ff d0                	call   *%rax
+  800441:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800444:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800448:	79 36                	jns    800480 <umain+0x44e>
+    panic("pipe: %i", i);
+  80044a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80044d:	89 c1                	mov    %eax,%ecx
+  80044f:	48 b8 d0 68 80 00 00 	movabs $0x8068d0,%rax
+  800456:	00 00 00 
+  800459:	48 89 c2             	mov    %rax,%rdx
+  80045c:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800461:	48 b8 d9 68 80 00 00 	movabs $0x8068d9,%rax
+  800468:	00 00 00 
+  80046b:	48 89 c7             	mov    %rax,%rdi
+  80046e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800473:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  80047a:	00 00 00 
+  80047d:	41 ff d0             	call   *%r8
+
+  if ((pid = fork()) < 0)
+  800480:	48 b8 8b 34 80 00 00 	movabs $0x80348b,%rax
+  800487:	00 00 00 
+  80048a:	ff d0                	call   *%rax
+  80048c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80048f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800493:	79 36                	jns    8004cb <umain+0x499>
+    panic("fork: %i", i);
+  800495:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800498:	89 c1                	mov    %eax,%ecx
+  80049a:	48 b8 e9 68 80 00 00 	movabs $0x8068e9,%rax
+  8004a1:	00 00 00 
+  8004a4:	48 89 c2             	mov    %rax,%rdx
+  8004a7:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8004ac:	48 b8 d9 68 80 00 00 	movabs $0x8068d9,%rax
+  8004b3:	00 00 00 
+  8004b6:	48 89 c7             	mov    %rax,%rdi
+  8004b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004be:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  8004c5:	00 00 00 
+  8004c8:	41 ff d0             	call   *%r8
+
+  if (pid == 0) {
+  8004cb:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8004cf:	0f 85 85 00 00 00    	jne    80055a <umain+0x528>
+    close(p[0]);
+  8004d5:	8b 45 88             	mov    -0x78(%rbp),%eax
+  8004d8:	89 c7                	mov    %eax,%edi
+  8004da:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  8004e1:	00 00 00 
+  8004e4:	ff d0                	call   *%rax
+    while (1) {
+      cprintf(".");
+  8004e6:	48 b8 98 69 80 00 00 	movabs $0x806998,%rax
+  8004ed:	00 00 00 
+  8004f0:	48 89 c7             	mov    %rax,%rdi
+  8004f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f8:	48 ba 74 08 80 00 00 	movabs $0x800874,%rdx
+  8004ff:	00 00 00 
+  800502:	ff d2                	call   *%rdx
+      if (write(p[1], "x", 1) != 1)
+  800504:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  800507:	ba 01 00 00 00       	mov    $0x1,%edx
+  80050c:	48 b9 9a 69 80 00 00 	movabs $0x80699a,%rcx
+  800513:	00 00 00 
+  800516:	48 89 ce             	mov    %rcx,%rsi
+  800519:	89 c7                	mov    %eax,%edi
+  80051b:	48 b8 c1 3c 80 00 00 	movabs $0x803cc1,%rax
+  800522:	00 00 00 
+  800525:	ff d0                	call   *%rax
+  800527:	48 83 f8 01          	cmp    $0x1,%rax
+  80052b:	75 02                	jne    80052f <umain+0x4fd>
+      cprintf(".");
+  80052d:	eb b7                	jmp    8004e6 <umain+0x4b4>
+        break;
+  80052f:	90                   	nop
+    }
+    cprintf("\npipe write closed properly\n");
+  800530:	48 b8 9c 69 80 00 00 	movabs $0x80699c,%rax
+  800537:	00 00 00 
+  80053a:	48 89 c7             	mov    %rax,%rdi
+  80053d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800542:	48 ba 74 08 80 00 00 	movabs $0x800874,%rdx
+  800549:	00 00 00 
+  80054c:	ff d2                	call   *%rdx
+    exit();
+  80054e:	48 b8 31 06 80 00 00 	movabs $0x800631,%rax
+  800555:	00 00 00 
+  800558:	ff d0                	call   *%rax
+  }
+  close(p[0]);
+  80055a:	8b 45 88             	mov    -0x78(%rbp),%eax
+  80055d:	89 c7                	mov    %eax,%edi
+  80055f:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+  close(p[1]);
+  80056b:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  80056e:	89 c7                	mov    %eax,%edi
+  800570:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  800577:	00 00 00 
+  80057a:	ff d0                	call   *%rax
+  wait(pid);
+  80057c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80057f:	89 c7                	mov    %eax,%edi
+  800581:	48 b8 32 55 80 00 00 	movabs $0x805532,%rax
+  800588:	00 00 00 
+  80058b:	ff d0                	call   *%rax
+
+  cprintf("pipe tests passed\n");
+  80058d:	48 b8 b9 69 80 00 00 	movabs $0x8069b9,%rax
+  800594:	00 00 00 
+  800597:	48 89 c7             	mov    %rax,%rdi
+  80059a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059f:	48 ba 74 08 80 00 00 	movabs $0x800874,%rdx
+  8005a6:	00 00 00 
+  8005a9:	ff d2                	call   *%rdx
+}
+  8005ab:	90                   	nop
+  8005ac:	c9                   	leave
+  8005ad:	c3                   	ret
+
+00000000008005ae <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8005ae:	55                   	push   %rbp
+  8005af:	48 89 e5             	mov    %rsp,%rbp
+  8005b2:	48 83 ec 20          	sub    $0x20,%rsp
+  8005b6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8005b9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8005bd:	48 b8 00 81 80 00 00 	movabs $0x808100,%rax
+  8005c4:	00 00 00 
+  8005c7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8005cb:	eb 13                	jmp    8005e0 <libmain+0x32>
+    (*ctor)();
+  8005cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005d1:	48 8b 10             	mov    (%rax),%rdx
+  8005d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d9:	ff d2                	call   *%rdx
+    ctor++;
+  8005db:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8005e0:	48 b8 00 81 80 00 00 	movabs $0x808100,%rax
+  8005e7:	00 00 00 
+  8005ea:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8005ee:	72 dd                	jb     8005cd <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8005f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8005f4:	7e 14                	jle    80060a <libmain+0x5c>
+    binaryname = argv[0];
+  8005f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005fa:	48 8b 00             	mov    (%rax),%rax
+  8005fd:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  800604:	00 00 00 
+  800607:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80060a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80060e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800611:	48 89 d6             	mov    %rdx,%rsi
+  800614:	89 c7                	mov    %eax,%edi
+  800616:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80061d:	00 00 00 
+  800620:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800622:	48 b8 31 06 80 00 00 	movabs $0x800631,%rax
+  800629:	00 00 00 
+  80062c:	ff d0                	call   *%rax
+#endif
+}
+  80062e:	90                   	nop
+  80062f:	c9                   	leave
+  800630:	c3                   	ret
+
+0000000000800631 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800631:	55                   	push   %rbp
+  800632:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800635:	48 b8 a9 38 80 00 00 	movabs $0x8038a9,%rax
+  80063c:	00 00 00 
+  80063f:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800641:	bf 00 00 00 00       	mov    $0x0,%edi
+  800646:	48 b8 aa 24 80 00 00 	movabs $0x8024aa,%rax
+  80064d:	00 00 00 
+  800650:	ff d0                	call   *%rax
+}
+  800652:	90                   	nop
+  800653:	5d                   	pop    %rbp
+  800654:	c3                   	ret
+
+0000000000800655 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800655:	55                   	push   %rbp
+  800656:	48 89 e5             	mov    %rsp,%rbp
+  800659:	53                   	push   %rbx
+  80065a:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800661:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800668:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80066e:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800675:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80067c:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800683:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80068a:	84 c0                	test   %al,%al
+  80068c:	74 23                	je     8006b1 <_panic+0x5c>
+  80068e:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800695:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800699:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80069d:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8006a1:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8006a5:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8006a9:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8006ad:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8006b1:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8006b8:	00 00 00 
+  8006bb:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8006c2:	00 00 00 
+  8006c5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c9:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8006d0:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8006d7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006de:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  8006e5:	00 00 00 
+  8006e8:	48 8b 18             	mov    (%rax),%rbx
+  8006eb:	48 b8 79 25 80 00 00 	movabs $0x802579,%rax
+  8006f2:	00 00 00 
+  8006f5:	ff d0                	call   *%rax
+  8006f7:	89 c6                	mov    %eax,%esi
+  8006f9:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8006ff:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800706:	41 89 d0             	mov    %edx,%r8d
+  800709:	48 89 c1             	mov    %rax,%rcx
+  80070c:	48 89 da             	mov    %rbx,%rdx
+  80070f:	48 b8 d8 69 80 00 00 	movabs $0x8069d8,%rax
+  800716:	00 00 00 
+  800719:	48 89 c7             	mov    %rax,%rdi
+  80071c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800721:	49 b9 74 08 80 00 00 	movabs $0x800874,%r9
+  800728:	00 00 00 
+  80072b:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80072e:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800735:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80073c:	48 89 d6             	mov    %rdx,%rsi
+  80073f:	48 89 c7             	mov    %rax,%rdi
+  800742:	48 b8 e9 07 80 00 00 	movabs $0x8007e9,%rax
+  800749:	00 00 00 
+  80074c:	ff d0                	call   *%rax
+  cprintf("\n");
+  80074e:	48 b8 fb 69 80 00 00 	movabs $0x8069fb,%rax
+  800755:	00 00 00 
+  800758:	48 89 c7             	mov    %rax,%rdi
+  80075b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800760:	48 ba 74 08 80 00 00 	movabs $0x800874,%rdx
+  800767:	00 00 00 
+  80076a:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  80076c:	cc                   	int3
+  80076d:	eb fd                	jmp    80076c <_panic+0x117>
+
+000000000080076f <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80076f:	55                   	push   %rbp
+  800770:	48 89 e5             	mov    %rsp,%rbp
+  800773:	48 83 ec 10          	sub    $0x10,%rsp
+  800777:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80077a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80077e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800782:	8b 00                	mov    (%rax),%eax
+  800784:	8d 48 01             	lea    0x1(%rax),%ecx
+  800787:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80078b:	89 0a                	mov    %ecx,(%rdx)
+  80078d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800790:	89 d1                	mov    %edx,%ecx
+  800792:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800796:	48 98                	cltq
+  800798:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80079c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007a0:	8b 00                	mov    (%rax),%eax
+  8007a2:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8007a7:	75 2c                	jne    8007d5 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8007a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007ad:	8b 00                	mov    (%rax),%eax
+  8007af:	48 98                	cltq
+  8007b1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007b5:	48 83 c2 08          	add    $0x8,%rdx
+  8007b9:	48 89 c6             	mov    %rax,%rsi
+  8007bc:	48 89 d7             	mov    %rdx,%rdi
+  8007bf:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  8007c6:	00 00 00 
+  8007c9:	ff d0                	call   *%rax
+    b->idx = 0;
+  8007cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007cf:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8007d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007d9:	8b 40 04             	mov    0x4(%rax),%eax
+  8007dc:	8d 50 01             	lea    0x1(%rax),%edx
+  8007df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007e3:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8007e6:	90                   	nop
+  8007e7:	c9                   	leave
+  8007e8:	c3                   	ret
+
+00000000008007e9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8007e9:	55                   	push   %rbp
+  8007ea:	48 89 e5             	mov    %rsp,%rbp
+  8007ed:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8007f4:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8007fb:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800802:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800809:	00 00 00 
+  b.cnt = 0;
+  80080c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800813:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800816:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80081d:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800824:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80082b:	48 89 c6             	mov    %rax,%rsi
+  80082e:	48 b8 6f 07 80 00 00 	movabs $0x80076f,%rax
+  800835:	00 00 00 
+  800838:	48 89 c7             	mov    %rax,%rdi
+  80083b:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  800842:	00 00 00 
+  800845:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800847:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80084d:	48 98                	cltq
+  80084f:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800856:	48 83 c2 08          	add    $0x8,%rdx
+  80085a:	48 89 c6             	mov    %rax,%rsi
+  80085d:	48 89 d7             	mov    %rdx,%rdi
+  800860:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  800867:	00 00 00 
+  80086a:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80086c:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800872:	c9                   	leave
+  800873:	c3                   	ret
+
+0000000000800874 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800874:	55                   	push   %rbp
+  800875:	48 89 e5             	mov    %rsp,%rbp
+  800878:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80087f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800886:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80088d:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800894:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80089b:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8008a2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8008a9:	84 c0                	test   %al,%al
+  8008ab:	74 20                	je     8008cd <cprintf+0x59>
+  8008ad:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8008b1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008b5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008b9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008bd:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008c1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008c5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008c9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8008cd:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8008d4:	00 00 00 
+  8008d7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8008de:	00 00 00 
+  8008e1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008e5:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8008ec:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8008f3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8008fa:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800901:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800908:	48 89 d6             	mov    %rdx,%rsi
+  80090b:	48 89 c7             	mov    %rax,%rdi
+  80090e:	48 b8 e9 07 80 00 00 	movabs $0x8007e9,%rax
+  800915:	00 00 00 
+  800918:	ff d0                	call   *%rax
+  80091a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800920:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+
+0000000000800928 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800928:	55                   	push   %rbp
+  800929:	48 89 e5             	mov    %rsp,%rbp
+  80092c:	48 83 ec 30          	sub    $0x30,%rsp
+  800930:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800934:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800938:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80093c:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80093f:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800943:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800947:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80094a:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80094e:	72 54                	jb     8009a4 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800950:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800953:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800956:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800959:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80095d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800962:	48 f7 f6             	div    %rsi
+  800965:	49 89 c2             	mov    %rax,%r10
+  800968:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80096b:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80096e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800972:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800976:	41 89 c9             	mov    %ecx,%r9d
+  800979:	41 89 f8             	mov    %edi,%r8d
+  80097c:	89 d1                	mov    %edx,%ecx
+  80097e:	4c 89 d2             	mov    %r10,%rdx
+  800981:	48 89 c7             	mov    %rax,%rdi
+  800984:	48 b8 28 09 80 00 00 	movabs $0x800928,%rax
+  80098b:	00 00 00 
+  80098e:	ff d0                	call   *%rax
+  800990:	eb 1c                	jmp    8009ae <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800992:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800996:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800999:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80099d:	48 89 d6             	mov    %rdx,%rsi
+  8009a0:	89 c7                	mov    %eax,%edi
+  8009a2:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8009a4:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8009a8:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8009ac:	7f e4                	jg     800992 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8009ae:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8009b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ba:	48 f7 f1             	div    %rcx
+  8009bd:	48 b8 30 6c 80 00 00 	movabs $0x806c30,%rax
+  8009c4:	00 00 00 
+  8009c7:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8009cb:	0f be c0             	movsbl %al,%eax
+  8009ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009d2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8009d6:	48 89 d6             	mov    %rdx,%rsi
+  8009d9:	89 c7                	mov    %eax,%edi
+  8009db:	ff d1                	call   *%rcx
+}
+  8009dd:	90                   	nop
+  8009de:	c9                   	leave
+  8009df:	c3                   	ret
+
+00000000008009e0 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8009e0:	55                   	push   %rbp
+  8009e1:	48 89 e5             	mov    %rsp,%rbp
+  8009e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8009e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009ec:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8009ef:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8009f3:	7e 4b                	jle    800a40 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8009f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f9:	8b 00                	mov    (%rax),%eax
+  8009fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fe:	77 24                	ja     800a24 <getuint+0x44>
+  800a00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a04:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a0c:	8b 00                	mov    (%rax),%eax
+  800a0e:	89 c0                	mov    %eax,%eax
+  800a10:	48 01 d0             	add    %rdx,%rax
+  800a13:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a17:	8b 12                	mov    (%rdx),%edx
+  800a19:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a1c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a20:	89 0a                	mov    %ecx,(%rdx)
+  800a22:	eb 14                	jmp    800a38 <getuint+0x58>
+  800a24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a28:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a2c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a30:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a34:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a38:	48 8b 00             	mov    (%rax),%rax
+  800a3b:	e9 95 00 00 00       	jmp    800ad5 <getuint+0xf5>
+  else if (lflag)
+  800a40:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800a44:	74 48                	je     800a8e <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800a46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a4a:	8b 00                	mov    (%rax),%eax
+  800a4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4f:	77 24                	ja     800a75 <getuint+0x95>
+  800a51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a55:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a5d:	8b 00                	mov    (%rax),%eax
+  800a5f:	89 c0                	mov    %eax,%eax
+  800a61:	48 01 d0             	add    %rdx,%rax
+  800a64:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a68:	8b 12                	mov    (%rdx),%edx
+  800a6a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a6d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a71:	89 0a                	mov    %ecx,(%rdx)
+  800a73:	eb 14                	jmp    800a89 <getuint+0xa9>
+  800a75:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a79:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a7d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a85:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a89:	48 8b 00             	mov    (%rax),%rax
+  800a8c:	eb 47                	jmp    800ad5 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a92:	8b 00                	mov    (%rax),%eax
+  800a94:	83 f8 2f             	cmp    $0x2f,%eax
+  800a97:	77 24                	ja     800abd <getuint+0xdd>
+  800a99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a9d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800aa1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800aa5:	8b 00                	mov    (%rax),%eax
+  800aa7:	89 c0                	mov    %eax,%eax
+  800aa9:	48 01 d0             	add    %rdx,%rax
+  800aac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ab0:	8b 12                	mov    (%rdx),%edx
+  800ab2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ab5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ab9:	89 0a                	mov    %ecx,(%rdx)
+  800abb:	eb 14                	jmp    800ad1 <getuint+0xf1>
+  800abd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ac1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ac5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800ac9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800acd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ad1:	8b 00                	mov    (%rax),%eax
+  800ad3:	89 c0                	mov    %eax,%eax
+}
+  800ad5:	c9                   	leave
+  800ad6:	c3                   	ret
+
+0000000000800ad7 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800ad7:	55                   	push   %rbp
+  800ad8:	48 89 e5             	mov    %rsp,%rbp
+  800adb:	48 83 ec 10          	sub    $0x10,%rsp
+  800adf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800ae3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800ae6:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800aea:	7e 4b                	jle    800b37 <getint+0x60>
+    return va_arg(*ap, long long);
+  800aec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800af0:	8b 00                	mov    (%rax),%eax
+  800af2:	83 f8 2f             	cmp    $0x2f,%eax
+  800af5:	77 24                	ja     800b1b <getint+0x44>
+  800af7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800afb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800aff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b03:	8b 00                	mov    (%rax),%eax
+  800b05:	89 c0                	mov    %eax,%eax
+  800b07:	48 01 d0             	add    %rdx,%rax
+  800b0a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b0e:	8b 12                	mov    (%rdx),%edx
+  800b10:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b13:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b17:	89 0a                	mov    %ecx,(%rdx)
+  800b19:	eb 14                	jmp    800b2f <getint+0x58>
+  800b1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b1f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b23:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b27:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b2b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b2f:	48 8b 00             	mov    (%rax),%rax
+  800b32:	e9 95 00 00 00       	jmp    800bcc <getint+0xf5>
+  else if (lflag)
+  800b37:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800b3b:	74 48                	je     800b85 <getint+0xae>
+    return va_arg(*ap, long);
+  800b3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b41:	8b 00                	mov    (%rax),%eax
+  800b43:	83 f8 2f             	cmp    $0x2f,%eax
+  800b46:	77 24                	ja     800b6c <getint+0x95>
+  800b48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b4c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b54:	8b 00                	mov    (%rax),%eax
+  800b56:	89 c0                	mov    %eax,%eax
+  800b58:	48 01 d0             	add    %rdx,%rax
+  800b5b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b5f:	8b 12                	mov    (%rdx),%edx
+  800b61:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b64:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b68:	89 0a                	mov    %ecx,(%rdx)
+  800b6a:	eb 14                	jmp    800b80 <getint+0xa9>
+  800b6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b70:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b74:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b78:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b7c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b80:	48 8b 00             	mov    (%rax),%rax
+  800b83:	eb 47                	jmp    800bcc <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800b85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b89:	8b 00                	mov    (%rax),%eax
+  800b8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8e:	77 24                	ja     800bb4 <getint+0xdd>
+  800b90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b94:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b9c:	8b 00                	mov    (%rax),%eax
+  800b9e:	89 c0                	mov    %eax,%eax
+  800ba0:	48 01 d0             	add    %rdx,%rax
+  800ba3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ba7:	8b 12                	mov    (%rdx),%edx
+  800ba9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800bac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800bb0:	89 0a                	mov    %ecx,(%rdx)
+  800bb2:	eb 14                	jmp    800bc8 <getint+0xf1>
+  800bb4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bb8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bbc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bc0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800bc4:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bc8:	8b 00                	mov    (%rax),%eax
+  800bca:	48 98                	cltq
+}
+  800bcc:	c9                   	leave
+  800bcd:	c3                   	ret
+
+0000000000800bce <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800bce:	55                   	push   %rbp
+  800bcf:	48 89 e5             	mov    %rsp,%rbp
+  800bd2:	41 54                	push   %r12
+  800bd4:	53                   	push   %rbx
+  800bd5:	48 83 ec 60          	sub    $0x60,%rsp
+  800bd9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800bdd:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800be1:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800be5:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800be9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bed:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800bf1:	48 8b 06             	mov    (%rsi),%rax
+  800bf4:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800bf8:	48 89 01             	mov    %rax,(%rcx)
+  800bfb:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800bff:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800c03:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800c07:	eb 17                	jmp    800c20 <vprintfmt+0x52>
+      if (ch == '\0')
+  800c09:	85 db                	test   %ebx,%ebx
+  800c0b:	0f 84 bf 04 00 00    	je     8010d0 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800c11:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c15:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c19:	48 89 c6             	mov    %rax,%rsi
+  800c1c:	89 df                	mov    %ebx,%edi
+  800c1e:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800c20:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c24:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c28:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800c2c:	0f b6 00             	movzbl (%rax),%eax
+  800c2f:	0f b6 d8             	movzbl %al,%ebx
+  800c32:	83 fb 25             	cmp    $0x25,%ebx
+  800c35:	75 d2                	jne    800c09 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800c37:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800c3b:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800c42:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800c49:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800c50:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800c57:	eb 04                	jmp    800c5d <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800c59:	90                   	nop
+  800c5a:	eb 01                	jmp    800c5d <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800c5c:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800c5d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c61:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c65:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800c69:	0f b6 00             	movzbl (%rax),%eax
+  800c6c:	0f b6 d8             	movzbl %al,%ebx
+  800c6f:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c72:	83 f8 55             	cmp    $0x55,%eax
+  800c75:	0f 87 22 04 00 00    	ja     80109d <vprintfmt+0x4cf>
+  800c7b:	89 c0                	mov    %eax,%eax
+  800c7d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c84:	00 
+  800c85:	48 b8 58 6c 80 00 00 	movabs $0x806c58,%rax
+  800c8c:	00 00 00 
+  800c8f:	48 01 d0             	add    %rdx,%rax
+  800c92:	48 8b 00             	mov    (%rax),%rax
+  800c95:	ff e0                	jmp    *%rax
+        padc = '-';
+  800c97:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800c9b:	eb c0                	jmp    800c5d <vprintfmt+0x8f>
+        padc = '0';
+  800c9d:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800ca1:	eb ba                	jmp    800c5d <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800ca3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800caa:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800cad:	89 d0                	mov    %edx,%eax
+  800caf:	c1 e0 02             	shl    $0x2,%eax
+  800cb2:	01 d0                	add    %edx,%eax
+  800cb4:	01 c0                	add    %eax,%eax
+  800cb6:	01 d8                	add    %ebx,%eax
+  800cb8:	83 e8 30             	sub    $0x30,%eax
+  800cbb:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800cbe:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cc2:	0f b6 00             	movzbl (%rax),%eax
+  800cc5:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800cc8:	83 fb 2f             	cmp    $0x2f,%ebx
+  800ccb:	7e 60                	jle    800d2d <vprintfmt+0x15f>
+  800ccd:	83 fb 39             	cmp    $0x39,%ebx
+  800cd0:	7f 5b                	jg     800d2d <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800cd2:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800cd7:	eb d1                	jmp    800caa <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800cd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800cdf:	77 17                	ja     800cf8 <vprintfmt+0x12a>
+  800ce1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ce5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ce8:	89 d2                	mov    %edx,%edx
+  800cea:	48 01 d0             	add    %rdx,%rax
+  800ced:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cf0:	83 c2 08             	add    $0x8,%edx
+  800cf3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800cf6:	eb 0c                	jmp    800d04 <vprintfmt+0x136>
+  800cf8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800cfc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d00:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d04:	8b 00                	mov    (%rax),%eax
+  800d06:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800d09:	eb 23                	jmp    800d2e <vprintfmt+0x160>
+        if (width < 0)
+  800d0b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d0f:	0f 89 44 ff ff ff    	jns    800c59 <vprintfmt+0x8b>
+          width = 0;
+  800d15:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800d1c:	e9 38 ff ff ff       	jmp    800c59 <vprintfmt+0x8b>
+        altflag = 1;
+  800d21:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800d28:	e9 30 ff ff ff       	jmp    800c5d <vprintfmt+0x8f>
+        goto process_precision;
+  800d2d:	90                   	nop
+        if (width < 0)
+  800d2e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d32:	0f 89 24 ff ff ff    	jns    800c5c <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800d38:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800d3b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800d3e:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800d45:	e9 12 ff ff ff       	jmp    800c5c <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800d4a:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800d4e:	e9 0a ff ff ff       	jmp    800c5d <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800d53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d56:	83 f8 2f             	cmp    $0x2f,%eax
+  800d59:	77 17                	ja     800d72 <vprintfmt+0x1a4>
+  800d5b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d5f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d62:	89 d2                	mov    %edx,%edx
+  800d64:	48 01 d0             	add    %rdx,%rax
+  800d67:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d6a:	83 c2 08             	add    $0x8,%edx
+  800d6d:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d70:	eb 0c                	jmp    800d7e <vprintfmt+0x1b0>
+  800d72:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d76:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d7a:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d7e:	8b 00                	mov    (%rax),%eax
+  800d80:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800d84:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d88:	48 89 d6             	mov    %rdx,%rsi
+  800d8b:	89 c7                	mov    %eax,%edi
+  800d8d:	ff d1                	call   *%rcx
+        break;
+  800d8f:	e9 37 03 00 00       	jmp    8010cb <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800d94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d97:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9a:	77 17                	ja     800db3 <vprintfmt+0x1e5>
+  800d9c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800da0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800da3:	89 d2                	mov    %edx,%edx
+  800da5:	48 01 d0             	add    %rdx,%rax
+  800da8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800dab:	83 c2 08             	add    $0x8,%edx
+  800dae:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800db1:	eb 0c                	jmp    800dbf <vprintfmt+0x1f1>
+  800db3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800db7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dbb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800dbf:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800dc1:	85 db                	test   %ebx,%ebx
+  800dc3:	79 02                	jns    800dc7 <vprintfmt+0x1f9>
+          err = -err;
+  800dc5:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800dc7:	83 fb 15             	cmp    $0x15,%ebx
+  800dca:	7f 16                	jg     800de2 <vprintfmt+0x214>
+  800dcc:	48 ba 80 6b 80 00 00 	movabs $0x806b80,%rdx
+  800dd3:	00 00 00 
+  800dd6:	48 63 c3             	movslq %ebx,%rax
+  800dd9:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800ddd:	4d 85 e4             	test   %r12,%r12
+  800de0:	75 2e                	jne    800e10 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800de2:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800de6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800dea:	89 d9                	mov    %ebx,%ecx
+  800dec:	48 ba 41 6c 80 00 00 	movabs $0x806c41,%rdx
+  800df3:	00 00 00 
+  800df6:	48 89 c7             	mov    %rax,%rdi
+  800df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfe:	49 b8 da 10 80 00 00 	movabs $0x8010da,%r8
+  800e05:	00 00 00 
+  800e08:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800e0b:	e9 bb 02 00 00       	jmp    8010cb <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800e10:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800e14:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e18:	4c 89 e1             	mov    %r12,%rcx
+  800e1b:	48 ba 4a 6c 80 00 00 	movabs $0x806c4a,%rdx
+  800e22:	00 00 00 
+  800e25:	48 89 c7             	mov    %rax,%rdi
+  800e28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e2d:	49 b8 da 10 80 00 00 	movabs $0x8010da,%r8
+  800e34:	00 00 00 
+  800e37:	41 ff d0             	call   *%r8
+        break;
+  800e3a:	e9 8c 02 00 00       	jmp    8010cb <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800e3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e42:	83 f8 2f             	cmp    $0x2f,%eax
+  800e45:	77 17                	ja     800e5e <vprintfmt+0x290>
+  800e47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e4b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e4e:	89 d2                	mov    %edx,%edx
+  800e50:	48 01 d0             	add    %rdx,%rax
+  800e53:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e56:	83 c2 08             	add    $0x8,%edx
+  800e59:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e5c:	eb 0c                	jmp    800e6a <vprintfmt+0x29c>
+  800e5e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e62:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e66:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e6a:	4c 8b 20             	mov    (%rax),%r12
+  800e6d:	4d 85 e4             	test   %r12,%r12
+  800e70:	75 0a                	jne    800e7c <vprintfmt+0x2ae>
+          p = "(null)";
+  800e72:	49 bc 4d 6c 80 00 00 	movabs $0x806c4d,%r12
+  800e79:	00 00 00 
+        if (width > 0 && padc != '-')
+  800e7c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e80:	7e 78                	jle    800efa <vprintfmt+0x32c>
+  800e82:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800e86:	74 72                	je     800efa <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e88:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800e8b:	48 98                	cltq
+  800e8d:	48 89 c6             	mov    %rax,%rsi
+  800e90:	4c 89 e7             	mov    %r12,%rdi
+  800e93:	48 b8 e6 17 80 00 00 	movabs $0x8017e6,%rax
+  800e9a:	00 00 00 
+  800e9d:	ff d0                	call   *%rax
+  800e9f:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800ea2:	eb 17                	jmp    800ebb <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800ea4:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800ea8:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800eac:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800eb0:	48 89 d6             	mov    %rdx,%rsi
+  800eb3:	89 c7                	mov    %eax,%edi
+  800eb5:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800eb7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ebb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ebf:	7f e3                	jg     800ea4 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ec1:	eb 37                	jmp    800efa <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800ec3:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800ec7:	74 1e                	je     800ee7 <vprintfmt+0x319>
+  800ec9:	83 fb 1f             	cmp    $0x1f,%ebx
+  800ecc:	7e 05                	jle    800ed3 <vprintfmt+0x305>
+  800ece:	83 fb 7e             	cmp    $0x7e,%ebx
+  800ed1:	7e 14                	jle    800ee7 <vprintfmt+0x319>
+            putch('?', putdat);
+  800ed3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ed7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800edb:	48 89 c6             	mov    %rax,%rsi
+  800ede:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ee3:	ff d2                	call   *%rdx
+  800ee5:	eb 0f                	jmp    800ef6 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800ee7:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800eeb:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800eef:	48 89 c6             	mov    %rax,%rsi
+  800ef2:	89 df                	mov    %ebx,%edi
+  800ef4:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ef6:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800efa:	4c 89 e0             	mov    %r12,%rax
+  800efd:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800f01:	0f b6 00             	movzbl (%rax),%eax
+  800f04:	0f be d8             	movsbl %al,%ebx
+  800f07:	85 db                	test   %ebx,%ebx
+  800f09:	74 28                	je     800f33 <vprintfmt+0x365>
+  800f0b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800f0f:	78 b2                	js     800ec3 <vprintfmt+0x2f5>
+  800f11:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800f15:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800f19:	79 a8                	jns    800ec3 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800f1b:	eb 16                	jmp    800f33 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800f1d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f21:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f25:	48 89 c6             	mov    %rax,%rsi
+  800f28:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f2d:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800f2f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800f33:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800f37:	7f e4                	jg     800f1d <vprintfmt+0x34f>
+        break;
+  800f39:	e9 8d 01 00 00       	jmp    8010cb <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800f3e:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f41:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f45:	89 d6                	mov    %edx,%esi
+  800f47:	48 89 c7             	mov    %rax,%rdi
+  800f4a:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  800f51:	00 00 00 
+  800f54:	ff d0                	call   *%rax
+  800f56:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800f5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f5e:	48 85 c0             	test   %rax,%rax
+  800f61:	79 1d                	jns    800f80 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800f63:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f67:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f6b:	48 89 c6             	mov    %rax,%rsi
+  800f6e:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f73:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800f75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f79:	48 f7 d8             	neg    %rax
+  800f7c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800f80:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f87:	e9 d2 00 00 00       	jmp    80105e <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800f8c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f8f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f93:	89 d6                	mov    %edx,%esi
+  800f95:	48 89 c7             	mov    %rax,%rdi
+  800f98:	48 b8 e0 09 80 00 00 	movabs $0x8009e0,%rax
+  800f9f:	00 00 00 
+  800fa2:	ff d0                	call   *%rax
+  800fa4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800fa8:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800faf:	e9 aa 00 00 00       	jmp    80105e <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800fb4:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800fb7:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800fbb:	89 d6                	mov    %edx,%esi
+  800fbd:	48 89 c7             	mov    %rax,%rdi
+  800fc0:	48 b8 e0 09 80 00 00 	movabs $0x8009e0,%rax
+  800fc7:	00 00 00 
+  800fca:	ff d0                	call   *%rax
+  800fcc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800fd0:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800fd7:	e9 82 00 00 00       	jmp    80105e <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800fdc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800fe0:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800fe4:	48 89 c6             	mov    %rax,%rsi
+  800fe7:	bf 30 00 00 00       	mov    $0x30,%edi
+  800fec:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800fee:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ff2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ff6:	48 89 c6             	mov    %rax,%rsi
+  800ff9:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ffe:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  801000:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801003:	83 f8 2f             	cmp    $0x2f,%eax
+  801006:	77 17                	ja     80101f <vprintfmt+0x451>
+  801008:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80100c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80100f:	89 d2                	mov    %edx,%edx
+  801011:	48 01 d0             	add    %rdx,%rax
+  801014:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801017:	83 c2 08             	add    $0x8,%edx
+  80101a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80101d:	eb 0c                	jmp    80102b <vprintfmt+0x45d>
+  80101f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801023:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801027:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80102b:	48 8b 00             	mov    (%rax),%rax
+  80102e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  801032:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  801039:	eb 23                	jmp    80105e <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  80103b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80103e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801042:	89 d6                	mov    %edx,%esi
+  801044:	48 89 c7             	mov    %rax,%rdi
+  801047:	48 b8 e0 09 80 00 00 	movabs $0x8009e0,%rax
+  80104e:	00 00 00 
+  801051:	ff d0                	call   *%rax
+  801053:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  801057:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  80105e:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801063:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801066:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  801069:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80106d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801071:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801075:	45 89 c1             	mov    %r8d,%r9d
+  801078:	41 89 f8             	mov    %edi,%r8d
+  80107b:	48 89 c7             	mov    %rax,%rdi
+  80107e:	48 b8 28 09 80 00 00 	movabs $0x800928,%rax
+  801085:	00 00 00 
+  801088:	ff d0                	call   *%rax
+        break;
+  80108a:	eb 3f                	jmp    8010cb <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  80108c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801090:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801094:	48 89 c6             	mov    %rax,%rsi
+  801097:	89 df                	mov    %ebx,%edi
+  801099:	ff d2                	call   *%rdx
+        break;
+  80109b:	eb 2e                	jmp    8010cb <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  80109d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8010a1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8010a5:	48 89 c6             	mov    %rax,%rsi
+  8010a8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8010ad:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  8010af:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8010b4:	eb 05                	jmp    8010bb <vprintfmt+0x4ed>
+  8010b6:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8010bb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010bf:	48 83 e8 01          	sub    $0x1,%rax
+  8010c3:	0f b6 00             	movzbl (%rax),%eax
+  8010c6:	3c 25                	cmp    $0x25,%al
+  8010c8:	75 ec                	jne    8010b6 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8010ca:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8010cb:	e9 50 fb ff ff       	jmp    800c20 <vprintfmt+0x52>
+        return;
+  8010d0:	90                   	nop
+    }
+  }
+}
+  8010d1:	48 83 c4 60          	add    $0x60,%rsp
+  8010d5:	5b                   	pop    %rbx
+  8010d6:	41 5c                	pop    %r12
+  8010d8:	5d                   	pop    %rbp
+  8010d9:	c3                   	ret
+
+00000000008010da <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8010da:	55                   	push   %rbp
+  8010db:	48 89 e5             	mov    %rsp,%rbp
+  8010de:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8010e5:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010ec:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8010f3:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8010fa:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801101:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801108:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80110f:	84 c0                	test   %al,%al
+  801111:	74 20                	je     801133 <printfmt+0x59>
+  801113:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801117:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80111b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80111f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801123:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801127:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80112b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80112f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  801133:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  80113a:	00 00 00 
+  80113d:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  801144:	00 00 00 
+  801147:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80114b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801152:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801159:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801160:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801167:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80116e:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801175:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80117c:	48 89 c7             	mov    %rax,%rdi
+  80117f:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  801186:	00 00 00 
+  801189:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  80118b:	90                   	nop
+  80118c:	c9                   	leave
+  80118d:	c3                   	ret
+
+000000000080118e <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  80118e:	55                   	push   %rbp
+  80118f:	48 89 e5             	mov    %rsp,%rbp
+  801192:	48 83 ec 10          	sub    $0x10,%rsp
+  801196:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801199:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  80119d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011a1:	8b 40 10             	mov    0x10(%rax),%eax
+  8011a4:	8d 50 01             	lea    0x1(%rax),%edx
+  8011a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011ab:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  8011ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011b2:	48 8b 10             	mov    (%rax),%rdx
+  8011b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011b9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8011bd:	48 39 c2             	cmp    %rax,%rdx
+  8011c0:	73 17                	jae    8011d9 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  8011c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011c6:	48 8b 00             	mov    (%rax),%rax
+  8011c9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011cd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011d1:	48 89 0a             	mov    %rcx,(%rdx)
+  8011d4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8011d7:	88 10                	mov    %dl,(%rax)
+}
+  8011d9:	90                   	nop
+  8011da:	c9                   	leave
+  8011db:	c3                   	ret
+
+00000000008011dc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  8011dc:	55                   	push   %rbp
+  8011dd:	48 89 e5             	mov    %rsp,%rbp
+  8011e0:	48 83 ec 40          	sub    $0x40,%rsp
+  8011e4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8011e8:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8011eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8011ef:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  8011f3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011f7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011fb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8011fe:	48 98                	cltq
+  801200:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801204:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801208:	48 01 d0             	add    %rdx,%rax
+  80120b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  80120f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  801216:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80121b:	74 06                	je     801223 <vsnprintf+0x47>
+  80121d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801221:	7f 07                	jg     80122a <vsnprintf+0x4e>
+    return -E_INVAL;
+  801223:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801228:	eb 32                	jmp    80125c <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  80122a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80122e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801232:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801236:	48 89 c6             	mov    %rax,%rsi
+  801239:	48 b8 8e 11 80 00 00 	movabs $0x80118e,%rax
+  801240:	00 00 00 
+  801243:	48 89 c7             	mov    %rax,%rdi
+  801246:	48 b8 ce 0b 80 00 00 	movabs $0x800bce,%rax
+  80124d:	00 00 00 
+  801250:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801252:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801256:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801259:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  80125c:	c9                   	leave
+  80125d:	c3                   	ret
+
+000000000080125e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  80125e:	55                   	push   %rbp
+  80125f:	48 89 e5             	mov    %rsp,%rbp
+  801262:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801269:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801270:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801276:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80127d:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801284:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80128b:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801292:	84 c0                	test   %al,%al
+  801294:	74 20                	je     8012b6 <snprintf+0x58>
+  801296:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80129a:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80129e:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8012a2:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8012a6:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012aa:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8012ae:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8012b2:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8012b6:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8012bd:	00 00 00 
+  8012c0:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8012c7:	00 00 00 
+  8012ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8012ce:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8012d5:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8012dc:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  8012e3:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  8012ea:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8012f1:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8012f7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8012fe:	48 89 c7             	mov    %rax,%rdi
+  801301:	48 b8 dc 11 80 00 00 	movabs $0x8011dc,%rax
+  801308:	00 00 00 
+  80130b:	ff d0                	call   *%rax
+  80130d:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801313:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801319:	c9                   	leave
+  80131a:	c3                   	ret
+
+000000000080131b <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  80131b:	55                   	push   %rbp
+  80131c:	48 89 e5             	mov    %rsp,%rbp
+  80131f:	53                   	push   %rbx
+  801320:	48 83 ec 38          	sub    $0x38,%rsp
+  801324:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801327:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80132b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80132f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801333:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801337:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80133a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133f:	89 d1                	mov    %edx,%ecx
+  801341:	0f a2                	cpuid
+  801343:	89 de                	mov    %ebx,%esi
+  801345:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801348:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  80134b:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80134e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801351:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801356:	74 09                	je     801361 <cpuid+0x46>
+}
+  801358:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80135c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80135f:	89 10                	mov    %edx,(%rax)
+
+  801361:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801366:	74 09                	je     801371 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801368:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80136c:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80136f:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801371:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801376:	74 09                	je     801381 <cpuid+0x66>
+char *
+  801378:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80137c:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80137f:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801381:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801386:	74 09                	je     801391 <cpuid+0x76>
+  for (; *s; s++)
+  801388:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80138c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80138f:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801391:	90                   	nop
+  801392:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801396:	c9                   	leave
+  801397:	c3                   	ret
+
+0000000000801398 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801398:	55                   	push   %rbp
+  801399:	48 89 e5             	mov    %rsp,%rbp
+  80139c:	48 83 ec 18          	sub    $0x18,%rsp
+  8013a0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  8013a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8013a6:	89 c1                	mov    %eax,%ecx
+  8013a8:	0f 01 d0             	xgetbv
+  8013ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013ae:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  8013b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013b4:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8013b7:	48 c1 e2 20          	shl    $0x20,%rdx
+  8013bb:	48 09 d0             	or     %rdx,%rax
+#else
+  8013be:	c9                   	leave
+  8013bf:	c3                   	ret
+
+00000000008013c0 <string_cpu>:
+string_cpu(void) {
+  8013c0:	55                   	push   %rbp
+  8013c1:	48 89 e5             	mov    %rsp,%rbp
+  8013c4:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8013c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  8013cf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  8013d6:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8013dd:	00 00 00 
+  8013e0:	8b 00                	mov    (%rax),%eax
+  8013e2:	85 c0                	test   %eax,%eax
+  8013e4:	78 11                	js     8013f7 <string_cpu+0x37>
+    return string_features;
+  8013e6:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8013ed:	00 00 00 
+  8013f0:	8b 00                	mov    (%rax),%eax
+  8013f2:	e9 df 00 00 00       	jmp    8014d6 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8013f7:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8013fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801401:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801406:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140b:	48 89 c6             	mov    %rax,%rsi
+  80140e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801413:	48 b8 1b 13 80 00 00 	movabs $0x80131b,%rax
+  80141a:	00 00 00 
+  80141d:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  80141f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801422:	83 f8 06             	cmp    $0x6,%eax
+  801425:	76 28                	jbe    80144f <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801427:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80142b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801431:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801436:	48 89 c2             	mov    %rax,%rdx
+  801439:	be 00 00 00 00       	mov    $0x0,%esi
+  80143e:	bf 07 00 00 00       	mov    $0x7,%edi
+  801443:	48 b8 1b 13 80 00 00 	movabs $0x80131b,%rax
+  80144a:	00 00 00 
+  80144d:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  80144f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801452:	25 00 02 00 00       	and    $0x200,%eax
+  801457:	85 c0                	test   %eax,%eax
+  801459:	74 04                	je     80145f <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  80145b:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  80145f:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801463:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801469:	48 89 c1             	mov    %rax,%rcx
+  80146c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801471:	be 00 00 00 00       	mov    $0x0,%esi
+  801476:	bf 01 00 00 00       	mov    $0x1,%edi
+  80147b:	48 b8 1b 13 80 00 00 	movabs $0x80131b,%rax
+  801482:	00 00 00 
+  801485:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801487:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80148a:	83 e0 20             	and    $0x20,%eax
+  80148d:	85 c0                	test   %eax,%eax
+  80148f:	74 2a                	je     8014bb <string_cpu+0xfb>
+  801491:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801494:	25 00 00 00 08       	and    $0x8000000,%eax
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	74 1e                	je     8014bb <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80149d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a2:	48 b8 98 13 80 00 00 	movabs $0x801398,%rax
+  8014a9:	00 00 00 
+  8014ac:	ff d0                	call   *%rax
+  8014ae:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8014b1:	48 83 f8 06          	cmp    $0x6,%rax
+  8014b5:	75 04                	jne    8014bb <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8014b7:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8014bb:	48 ba 10 80 80 00 00 	movabs $0x808010,%rdx
+  8014c2:	00 00 00 
+  8014c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8014c8:	89 02                	mov    %eax,(%rdx)
+  8014ca:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8014d1:	00 00 00 
+  8014d4:	8b 00                	mov    (%rax),%eax
+}
+  8014d6:	c9                   	leave
+  8014d7:	c3                   	ret
+
+00000000008014d8 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8014d8:	55                   	push   %rbp
+  8014d9:	48 89 e5             	mov    %rsp,%rbp
+  8014dc:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8014e0:	48 83 ec 60          	sub    $0x60,%rsp
+  8014e4:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8014e9:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8014ee:	83 e0 1f             	and    $0x1f,%eax
+  8014f1:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8014f5:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8014f9:	48 f7 d8             	neg    %rax
+  8014fc:	48 89 c2             	mov    %rax,%rdx
+  8014ff:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801504:	48 01 d0             	add    %rdx,%rax
+  801507:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  80150c:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801510:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801516:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80151b:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80151f:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801525:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801529:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80152d:	89 c2                	mov    %eax,%edx
+  80152f:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801533:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801538:	89 c1                	mov    %eax,%ecx
+  80153a:	d3 e6                	shl    %cl,%esi
+  80153c:	89 f0                	mov    %esi,%eax
+  80153e:	21 d0                	and    %edx,%eax
+  801540:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801544:	eb 21                	jmp    801567 <strlen_avx2+0x8f>
+    p += 32;
+  801546:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  80154c:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801551:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801555:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80155b:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80155f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801563:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801567:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  80156c:	74 d8                	je     801546 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80156e:	31 c0                	xor    %eax,%eax
+  801570:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801576:	48 63 d0             	movslq %eax,%rdx
+  801579:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80157e:	48 01 d0             	add    %rdx,%rax
+  801581:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801586:	c9                   	leave
+  801587:	c3                   	ret
+
+0000000000801588 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801590:	48 83 ec 40          	sub    $0x40,%rsp
+  801594:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801599:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80159e:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8015a3:	eb 77                	jmp    80161c <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  8015a5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015aa:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8015ae:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8015b2:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015b7:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8015bb:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8015bf:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8015c3:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8015c7:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8015cc:	74 3c                	je     80160a <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8015ce:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8015d2:	f7 d0                	not    %eax
+  8015d4:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8015d8:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8015dc:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8015e0:	48 63 d0             	movslq %eax,%rdx
+  8015e3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015e8:	48 01 d0             	add    %rdx,%rax
+  8015eb:	0f b6 00             	movzbl (%rax),%eax
+  8015ee:	0f b6 c0             	movzbl %al,%eax
+  8015f1:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8015f5:	48 63 ca             	movslq %edx,%rcx
+  8015f8:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8015fd:	48 01 ca             	add    %rcx,%rdx
+  801600:	0f b6 12             	movzbl (%rdx),%edx
+  801603:	0f b6 d2             	movzbl %dl,%edx
+  801606:	29 d0                	sub    %edx,%eax
+  801608:	eb 6b                	jmp    801675 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80160a:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801610:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801616:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80161c:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801622:	77 81                	ja     8015a5 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801624:	eb 42                	jmp    801668 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801626:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80162b:	0f b6 10             	movzbl (%rax),%edx
+  80162e:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801633:	0f b6 00             	movzbl (%rax),%eax
+  801636:	38 c2                	cmp    %al,%dl
+  801638:	74 1c                	je     801656 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  80163a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80163f:	0f b6 00             	movzbl (%rax),%eax
+  801642:	0f b6 c8             	movzbl %al,%ecx
+  801645:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80164a:	0f b6 00             	movzbl (%rax),%eax
+  80164d:	0f b6 d0             	movzbl %al,%edx
+  801650:	89 c8                	mov    %ecx,%eax
+  801652:	29 d0                	sub    %edx,%eax
+  801654:	eb 1f                	jmp    801675 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801656:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80165c:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801662:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801668:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80166e:	75 b6                	jne    801626 <memcmp_avx2+0x9e>
+  return 0;
+  801670:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801675:	c9                   	leave
+  801676:	c3                   	ret
+
+0000000000801677 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801677:	55                   	push   %rbp
+  801678:	48 89 e5             	mov    %rsp,%rbp
+  80167b:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80167f:	48 83 ec 60          	sub    $0x60,%rsp
+  801683:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801688:	89 f0                	mov    %esi,%eax
+  80168a:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80168f:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801693:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801698:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80169c:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8016a1:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8016a7:	eb 47                	jmp    8016f0 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8016a9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8016ae:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8016b2:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8016b6:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8016bc:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8016c0:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8016c4:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8016c8:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8016cd:	74 15                	je     8016e4 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8016cf:	31 c0                	xor    %eax,%eax
+  8016d1:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8016d7:	48 63 d0             	movslq %eax,%rdx
+  8016da:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8016df:	48 01 d0             	add    %rdx,%rax
+  8016e2:	eb 3d                	jmp    801721 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8016e4:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8016ea:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8016f0:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8016f6:	77 b1                	ja     8016a9 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8016f8:	eb 0c                	jmp    801706 <memfind_avx2+0x8f>
+  8016fa:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801700:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801706:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80170c:	74 0e                	je     80171c <memfind_avx2+0xa5>
+  80170e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801713:	0f b6 00             	movzbl (%rax),%eax
+  801716:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80171a:	75 de                	jne    8016fa <memfind_avx2+0x83>
+  return s;
+  80171c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801721:	c9                   	leave
+  801722:	c3                   	ret
+
+0000000000801723 <strlen>:
+strlen(const char *s) {
+  801723:	55                   	push   %rbp
+  801724:	48 89 e5             	mov    %rsp,%rbp
+  801727:	48 83 ec 40          	sub    $0x40,%rsp
+  80172b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80172f:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801733:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801737:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  80173e:	00 00 00 
+  801741:	ff d0                	call   *%rax
+  801743:	83 e0 02             	and    $0x2,%eax
+  801746:	85 c0                	test   %eax,%eax
+  801748:	74 18                	je     801762 <strlen+0x3f>
+    return strlen_avx2(s);
+  80174a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80174e:	48 89 c7             	mov    %rax,%rdi
+  801751:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  801758:	00 00 00 
+  80175b:	ff d0                	call   *%rax
+  80175d:	e9 82 00 00 00       	jmp    8017e4 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801762:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801766:	83 e0 0f             	and    $0xf,%eax
+  801769:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80176c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80176f:	48 f7 d8             	neg    %rax
+  801772:	48 89 c2             	mov    %rax,%rdx
+  801775:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801779:	48 01 d0             	add    %rdx,%rax
+  80177c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801780:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801784:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801788:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80178d:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801791:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801795:	89 c2                	mov    %eax,%edx
+  801797:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80179a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80179f:	89 c1                	mov    %eax,%ecx
+  8017a1:	d3 e6                	shl    %cl,%esi
+  8017a3:	89 f0                	mov    %esi,%eax
+  8017a5:	21 d0                	and    %edx,%eax
+  8017a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017aa:	eb 1d                	jmp    8017c9 <strlen+0xa6>
+    p += 16;
+  8017ac:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8017b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017b5:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8017b9:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8017be:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8017c2:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8017cd:	74 dd                	je     8017ac <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8017cf:	31 c0                	xor    %eax,%eax
+  8017d1:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8017d6:	48 63 d0             	movslq %eax,%rdx
+  8017d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017dd:	48 01 d0             	add    %rdx,%rax
+  8017e0:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8017e4:	c9                   	leave
+  8017e5:	c3                   	ret
+
+00000000008017e6 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8017e6:	55                   	push   %rbp
+  8017e7:	48 89 e5             	mov    %rsp,%rbp
+  8017ea:	48 83 ec 20          	sub    $0x20,%rsp
+  8017ee:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017f2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8017f6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8017fd:	eb 0e                	jmp    80180d <strnlen+0x27>
+    n++;
+  8017ff:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801803:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801808:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80180d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801812:	74 0b                	je     80181f <strnlen+0x39>
+  801814:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801818:	0f b6 00             	movzbl (%rax),%eax
+  80181b:	84 c0                	test   %al,%al
+  80181d:	75 e0                	jne    8017ff <strnlen+0x19>
+  return n;
+  80181f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801822:	c9                   	leave
+  801823:	c3                   	ret
+
+0000000000801824 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801824:	55                   	push   %rbp
+  801825:	48 89 e5             	mov    %rsp,%rbp
+  801828:	48 83 ec 20          	sub    $0x20,%rsp
+  80182c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801830:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801834:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801838:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  80183c:	90                   	nop
+  80183d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801841:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801845:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80184d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801851:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801855:	0f b6 12             	movzbl (%rdx),%edx
+  801858:	88 10                	mov    %dl,(%rax)
+  80185a:	0f b6 00             	movzbl (%rax),%eax
+  80185d:	84 c0                	test   %al,%al
+  80185f:	75 dc                	jne    80183d <strcpy+0x19>
+  return ret;
+  801861:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801865:	c9                   	leave
+  801866:	c3                   	ret
+
+0000000000801867 <strcat>:
+strcat(char *dst, const char *src) {
+  801867:	55                   	push   %rbp
+  801868:	48 89 e5             	mov    %rsp,%rbp
+  80186b:	48 83 ec 20          	sub    $0x20,%rsp
+  80186f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801873:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801877:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80187b:	48 89 c7             	mov    %rax,%rdi
+  80187e:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  801885:	00 00 00 
+  801888:	ff d0                	call   *%rax
+  80188a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80188d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801890:	48 63 d0             	movslq %eax,%rdx
+  801893:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801897:	48 01 c2             	add    %rax,%rdx
+  80189a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80189e:	48 89 c6             	mov    %rax,%rsi
+  8018a1:	48 89 d7             	mov    %rdx,%rdi
+  8018a4:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8018ab:	00 00 00 
+  8018ae:	ff d0                	call   *%rax
+  return dst;
+  8018b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018b4:	c9                   	leave
+  8018b5:	c3                   	ret
+
+00000000008018b6 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8018b6:	55                   	push   %rbp
+  8018b7:	48 89 e5             	mov    %rsp,%rbp
+  8018ba:	48 83 ec 28          	sub    $0x28,%rsp
+  8018be:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018c2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018c6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8018ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018ce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8018d2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8018d9:	00 
+  8018da:	eb 2a                	jmp    801906 <strncpy+0x50>
+    *dst++ = *src;
+  8018dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018e0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018e4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8018e8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018ec:	0f b6 12             	movzbl (%rdx),%edx
+  8018ef:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8018f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018f5:	0f b6 00             	movzbl (%rax),%eax
+  8018f8:	84 c0                	test   %al,%al
+  8018fa:	74 05                	je     801901 <strncpy+0x4b>
+      src++;
+  8018fc:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801901:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801906:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80190a:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80190e:	72 cc                	jb     8018dc <strncpy+0x26>
+  return ret;
+  801910:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801914:	c9                   	leave
+  801915:	c3                   	ret
+
+0000000000801916 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801916:	55                   	push   %rbp
+  801917:	48 89 e5             	mov    %rsp,%rbp
+  80191a:	48 83 ec 28          	sub    $0x28,%rsp
+  80191e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801922:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801926:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80192a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80192e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801932:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801937:	74 3d                	je     801976 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801939:	eb 1d                	jmp    801958 <strlcpy+0x42>
+      *dst++ = *src++;
+  80193b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80193f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801943:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801947:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80194b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80194f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801953:	0f b6 12             	movzbl (%rdx),%edx
+  801956:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801958:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80195d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801962:	74 0b                	je     80196f <strlcpy+0x59>
+  801964:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801968:	0f b6 00             	movzbl (%rax),%eax
+  80196b:	84 c0                	test   %al,%al
+  80196d:	75 cc                	jne    80193b <strlcpy+0x25>
+    *dst = '\0';
+  80196f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801973:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801976:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80197a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80197e:	c9                   	leave
+  80197f:	c3                   	ret
+
+0000000000801980 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801980:	55                   	push   %rbp
+  801981:	48 89 e5             	mov    %rsp,%rbp
+  801984:	48 83 ec 30          	sub    $0x30,%rsp
+  801988:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80198c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801990:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801994:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801998:	48 89 c7             	mov    %rax,%rdi
+  80199b:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  8019a2:	00 00 00 
+  8019a5:	ff d0                	call   *%rax
+  8019a7:	48 98                	cltq
+  8019a9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8019ad:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8019b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019b5:	48 89 d6             	mov    %rdx,%rsi
+  8019b8:	48 89 c7             	mov    %rax,%rdi
+  8019bb:	48 b8 e6 17 80 00 00 	movabs $0x8017e6,%rax
+  8019c2:	00 00 00 
+  8019c5:	ff d0                	call   *%rax
+  8019c7:	48 98                	cltq
+  8019c9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8019cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8019d5:	75 10                	jne    8019e7 <strlcat+0x67>
+    return maxlen + srclen;
+  8019d7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8019db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019df:	48 01 d0             	add    %rdx,%rax
+  8019e2:	e9 86 00 00 00       	jmp    801a6d <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8019e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019eb:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8019ef:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8019f3:	73 2b                	jae    801a20 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8019f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019fd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801a01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a05:	48 01 c1             	add    %rax,%rcx
+  801a08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a0c:	48 89 c6             	mov    %rax,%rsi
+  801a0f:	48 89 cf             	mov    %rcx,%rdi
+  801a12:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  801a19:	00 00 00 
+  801a1c:	ff d0                	call   *%rax
+  801a1e:	eb 42                	jmp    801a62 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801a20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a24:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a28:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801a2c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a30:	48 01 c1             	add    %rax,%rcx
+  801a33:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a37:	48 89 c6             	mov    %rax,%rsi
+  801a3a:	48 89 cf             	mov    %rcx,%rdi
+  801a3d:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  801a44:	00 00 00 
+  801a47:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801a49:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a51:	48 01 d0             	add    %rdx,%rax
+  801a54:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a5c:	48 01 d0             	add    %rdx,%rax
+  801a5f:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801a62:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a6a:	48 01 d0             	add    %rdx,%rax
+}
+  801a6d:	c9                   	leave
+  801a6e:	c3                   	ret
+
+0000000000801a6f <strcmp>:
+strcmp(const char *p, const char *q) {
+  801a6f:	55                   	push   %rbp
+  801a70:	48 89 e5             	mov    %rsp,%rbp
+  801a73:	48 83 ec 10          	sub    $0x10,%rsp
+  801a77:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a7b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a7f:	eb 0a                	jmp    801a8b <strcmp+0x1c>
+    p++, q++;
+  801a81:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a86:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a8f:	0f b6 00             	movzbl (%rax),%eax
+  801a92:	84 c0                	test   %al,%al
+  801a94:	74 12                	je     801aa8 <strcmp+0x39>
+  801a96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a9a:	0f b6 10             	movzbl (%rax),%edx
+  801a9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa1:	0f b6 00             	movzbl (%rax),%eax
+  801aa4:	38 c2                	cmp    %al,%dl
+  801aa6:	74 d9                	je     801a81 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801aa8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aac:	0f b6 00             	movzbl (%rax),%eax
+  801aaf:	0f b6 d0             	movzbl %al,%edx
+  801ab2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ab6:	0f b6 00             	movzbl (%rax),%eax
+  801ab9:	0f b6 c0             	movzbl %al,%eax
+  801abc:	29 c2                	sub    %eax,%edx
+  801abe:	89 d0                	mov    %edx,%eax
+}
+  801ac0:	c9                   	leave
+  801ac1:	c3                   	ret
+
+0000000000801ac2 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801ac2:	55                   	push   %rbp
+  801ac3:	48 89 e5             	mov    %rsp,%rbp
+  801ac6:	48 83 ec 18          	sub    $0x18,%rsp
+  801aca:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ace:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ad2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801ad6:	eb 0f                	jmp    801ae7 <strncmp+0x25>
+    n--, p++, q++;
+  801ad8:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801add:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ae2:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801ae7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801aec:	74 1d                	je     801b0b <strncmp+0x49>
+  801aee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801af2:	0f b6 00             	movzbl (%rax),%eax
+  801af5:	84 c0                	test   %al,%al
+  801af7:	74 12                	je     801b0b <strncmp+0x49>
+  801af9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801afd:	0f b6 10             	movzbl (%rax),%edx
+  801b00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b04:	0f b6 00             	movzbl (%rax),%eax
+  801b07:	38 c2                	cmp    %al,%dl
+  801b09:	74 cd                	je     801ad8 <strncmp+0x16>
+  if (n == 0)
+  801b0b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b10:	75 07                	jne    801b19 <strncmp+0x57>
+    return 0;
+  801b12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b17:	eb 16                	jmp    801b2f <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801b19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b1d:	0f b6 00             	movzbl (%rax),%eax
+  801b20:	0f b6 d0             	movzbl %al,%edx
+  801b23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b27:	0f b6 00             	movzbl (%rax),%eax
+  801b2a:	0f b6 c0             	movzbl %al,%eax
+  801b2d:	29 c2                	sub    %eax,%edx
+}
+  801b2f:	89 d0                	mov    %edx,%eax
+  801b31:	c9                   	leave
+  801b32:	c3                   	ret
+
+0000000000801b33 <strchr>:
+strchr(const char *s, char c) {
+  801b33:	55                   	push   %rbp
+  801b34:	48 89 e5             	mov    %rsp,%rbp
+  801b37:	48 83 ec 60          	sub    $0x60,%rsp
+  801b3b:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801b3f:	89 f0                	mov    %esi,%eax
+  801b41:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801b44:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801b48:	83 e0 0f             	and    $0xf,%eax
+  801b4b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801b4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b51:	48 f7 d8             	neg    %rax
+  801b54:	48 89 c2             	mov    %rax,%rdx
+  801b57:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801b5b:	48 01 d0             	add    %rdx,%rax
+  801b5e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801b62:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801b66:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801b6a:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801b6e:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b72:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b76:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b7a:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b7f:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801b83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b87:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b8b:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801b8f:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b94:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b99:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b9d:	89 c2                	mov    %eax,%edx
+  801b9f:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801ba4:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801ba9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bad:	09 c2                	or     %eax,%edx
+  801baf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801bb2:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801bb7:	89 c1                	mov    %eax,%ecx
+  801bb9:	d3 e6                	shl    %cl,%esi
+  801bbb:	89 f0                	mov    %esi,%eax
+  801bbd:	21 d0                	and    %edx,%eax
+  801bbf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801bc2:	eb 34                	jmp    801bf8 <strchr+0xc5>
+    p += 16;
+  801bc4:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801bc9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bcd:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801bd1:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801bd5:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801bda:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801bdf:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801be3:	89 c2                	mov    %eax,%edx
+  801be5:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801bea:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801bef:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bf3:	09 d0                	or     %edx,%eax
+  801bf5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801bf8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801bfc:	74 c6                	je     801bc4 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801bfe:	31 c0                	xor    %eax,%eax
+  801c00:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801c05:	48 98                	cltq
+  801c07:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801c0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c0f:	0f b6 00             	movzbl (%rax),%eax
+  801c12:	84 c0                	test   %al,%al
+  801c14:	74 06                	je     801c1c <strchr+0xe9>
+  801c16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c1a:	eb 05                	jmp    801c21 <strchr+0xee>
+  801c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c21:	c9                   	leave
+  801c22:	c3                   	ret
+
+0000000000801c23 <strfind>:
+strfind(const char *s, char c) {
+  801c23:	55                   	push   %rbp
+  801c24:	48 89 e5             	mov    %rsp,%rbp
+  801c27:	48 83 ec 10          	sub    $0x10,%rsp
+  801c2b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c2f:	89 f0                	mov    %esi,%eax
+  801c31:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801c34:	eb 11                	jmp    801c47 <strfind+0x24>
+    if (*s == c)
+  801c36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c3a:	0f b6 00             	movzbl (%rax),%eax
+  801c3d:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801c40:	74 12                	je     801c54 <strfind+0x31>
+  for (; *s; s++)
+  801c42:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c4b:	0f b6 00             	movzbl (%rax),%eax
+  801c4e:	84 c0                	test   %al,%al
+  801c50:	75 e4                	jne    801c36 <strfind+0x13>
+  801c52:	eb 01                	jmp    801c55 <strfind+0x32>
+      break;
+  801c54:	90                   	nop
+  return (char *)s;
+  801c55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801c59:	c9                   	leave
+  801c5a:	c3                   	ret
+
+0000000000801c5b <memset>:
+memset(void *v, int c, size_t n) {
+  801c5b:	55                   	push   %rbp
+  801c5c:	48 89 e5             	mov    %rsp,%rbp
+  801c5f:	48 83 ec 38          	sub    $0x38,%rsp
+  801c63:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c67:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801c6a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801c6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c72:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c76:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c7b:	76 41                	jbe    801cbe <memset+0x63>
+  801c7d:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+  801c89:	83 e0 01             	and    $0x1,%eax
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	74 2e                	je     801cbe <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801c90:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c93:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c97:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c9b:	48 89 ce             	mov    %rcx,%rsi
+  801c9e:	48 89 f7             	mov    %rsi,%rdi
+  801ca1:	48 89 d1             	mov    %rdx,%rcx
+  801ca4:	fc                   	cld
+  801ca5:	f3 aa                	rep stos %al,%es:(%rdi)
+  801ca7:	48 89 ca             	mov    %rcx,%rdx
+  801caa:	48 89 fe             	mov    %rdi,%rsi
+  801cad:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801cb1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801cb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb9:	e9 a7 00 00 00       	jmp    801d65 <memset+0x10a>
+  if (n >= 8) {
+  801cbe:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801cc3:	0f 86 87 00 00 00    	jbe    801d50 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801cc9:	eb 16                	jmp    801ce1 <memset+0x86>
+      *p++ = c;
+  801ccb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ccf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cd3:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cd7:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801cda:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801cdc:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801ce1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ce5:	83 e0 07             	and    $0x7,%eax
+  801ce8:	48 85 c0             	test   %rax,%rax
+  801ceb:	75 de                	jne    801ccb <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801ced:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801cf0:	0f b6 c0             	movzbl %al,%eax
+  801cf3:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801cfa:	01 01 01 
+  801cfd:	48 0f af c2          	imul   %rdx,%rax
+  801d01:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801d05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d09:	48 c1 e8 03          	shr    $0x3,%rax
+  801d0d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801d11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d15:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801d19:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d1d:	48 89 ce             	mov    %rcx,%rsi
+  801d20:	48 89 f7             	mov    %rsi,%rdi
+  801d23:	48 89 d1             	mov    %rdx,%rcx
+  801d26:	fc                   	cld
+  801d27:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801d2a:	48 89 ca             	mov    %rcx,%rdx
+  801d2d:	48 89 fe             	mov    %rdi,%rsi
+  801d30:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801d34:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801d38:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801d3d:	eb 11                	jmp    801d50 <memset+0xf5>
+    *p++ = c;
+  801d3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d43:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d47:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d4b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801d4e:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801d50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d54:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d58:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d5c:	48 85 c0             	test   %rax,%rax
+  801d5f:	75 de                	jne    801d3f <memset+0xe4>
+  return v;
+  801d61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801d65:	c9                   	leave
+  801d66:	c3                   	ret
+
+0000000000801d67 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801d67:	55                   	push   %rbp
+  801d68:	48 89 e5             	mov    %rsp,%rbp
+  801d6b:	48 83 ec 38          	sub    $0x38,%rsp
+  801d6f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d73:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d77:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801d7b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d7f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801d83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d87:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801d8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d8f:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801d93:	0f 83 da 00 00 00    	jae    801e73 <memmove+0x10c>
+  801d99:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801da1:	48 01 d0             	add    %rdx,%rax
+  801da4:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801da8:	0f 83 c5 00 00 00    	jae    801e73 <memmove+0x10c>
+    s += n;
+  801dae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801db2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801db6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dba:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801dbe:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801dc3:	0f 86 94 00 00 00    	jbe    801e5d <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801dc9:	eb 1c                	jmp    801de7 <memmove+0x80>
+        *--d = *--s;
+  801dcb:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801dd0:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801dd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dd9:	0f b6 10             	movzbl (%rax),%edx
+  801ddc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801de0:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801de2:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801de7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801deb:	83 e0 07             	and    $0x7,%eax
+  801dee:	48 85 c0             	test   %rax,%rax
+  801df1:	75 d8                	jne    801dcb <memmove+0x64>
+      nq = n / 8;
+  801df3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801df7:	48 c1 e8 03          	shr    $0x3,%rax
+  801dfb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801dff:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801e04:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801e09:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801e0e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e1a:	48 89 cf             	mov    %rcx,%rdi
+  801e1d:	48 89 d6             	mov    %rdx,%rsi
+  801e20:	48 89 c1             	mov    %rax,%rcx
+  801e23:	fd                   	std
+  801e24:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801e27:	fc                   	cld
+  801e28:	48 89 c8             	mov    %rcx,%rax
+  801e2b:	48 89 f2             	mov    %rsi,%rdx
+  801e2e:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801e32:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801e36:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801e3a:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801e3f:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801e44:	eb 17                	jmp    801e5d <memmove+0xf6>
+      *--d = *--s;
+  801e46:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801e4b:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801e50:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e54:	0f b6 10             	movzbl (%rax),%edx
+  801e57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e5b:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801e5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e61:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e65:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e69:	48 85 c0             	test   %rax,%rax
+  801e6c:	75 d8                	jne    801e46 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801e6e:	e9 f4 00 00 00       	jmp    801f67 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801e73:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801e78:	76 46                	jbe    801ec0 <memmove+0x159>
+  801e7a:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  801e81:	00 00 00 
+  801e84:	ff d0                	call   *%rax
+  801e86:	83 e0 01             	and    $0x1,%eax
+  801e89:	85 c0                	test   %eax,%eax
+  801e8b:	74 33                	je     801ec0 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801e8d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e91:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e95:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e99:	48 89 cf             	mov    %rcx,%rdi
+  801e9c:	48 89 d6             	mov    %rdx,%rsi
+  801e9f:	48 89 c1             	mov    %rax,%rcx
+  801ea2:	fc                   	cld
+  801ea3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801ea5:	48 89 c8             	mov    %rcx,%rax
+  801ea8:	48 89 f2             	mov    %rsi,%rdx
+  801eab:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801eaf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801eb3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801eb7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ebb:	e9 ab 00 00 00       	jmp    801f6b <memmove+0x204>
+    if (n >= 8) {
+  801ec0:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801ec5:	0f 86 8b 00 00 00    	jbe    801f56 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801ecb:	eb 22                	jmp    801eef <memmove+0x188>
+        *d++ = *s++;
+  801ecd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ed1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801ed5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ed9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801edd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ee1:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801ee5:	0f b6 12             	movzbl (%rdx),%edx
+  801ee8:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801eea:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801eef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ef3:	83 e0 07             	and    $0x7,%eax
+  801ef6:	48 85 c0             	test   %rax,%rax
+  801ef9:	75 d2                	jne    801ecd <memmove+0x166>
+      nq = n / 8;
+  801efb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eff:	48 c1 e8 03          	shr    $0x3,%rax
+  801f03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801f07:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f0b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f0f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f13:	48 89 cf             	mov    %rcx,%rdi
+  801f16:	48 89 d6             	mov    %rdx,%rsi
+  801f19:	48 89 c1             	mov    %rax,%rcx
+  801f1c:	fc                   	cld
+  801f1d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801f20:	48 89 c8             	mov    %rcx,%rax
+  801f23:	48 89 f2             	mov    %rsi,%rdx
+  801f26:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801f2a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801f2e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801f32:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801f37:	eb 1d                	jmp    801f56 <memmove+0x1ef>
+      *d++ = *s++;
+  801f39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f3d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801f41:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801f45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f49:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801f4d:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801f51:	0f b6 12             	movzbl (%rdx),%edx
+  801f54:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801f56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f5a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f5e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f62:	48 85 c0             	test   %rax,%rax
+  801f65:	75 d2                	jne    801f39 <memmove+0x1d2>
+  return dst;
+  801f67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801f6b:	c9                   	leave
+  801f6c:	c3                   	ret
+
+0000000000801f6d <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801f6d:	55                   	push   %rbp
+  801f6e:	48 89 e5             	mov    %rsp,%rbp
+  801f71:	48 83 ec 18          	sub    $0x18,%rsp
+  801f75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f79:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f7d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801f81:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f85:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f8d:	48 89 ce             	mov    %rcx,%rsi
+  801f90:	48 89 c7             	mov    %rax,%rdi
+  801f93:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  801f9a:	00 00 00 
+  801f9d:	ff d0                	call   *%rax
+}
+  801f9f:	c9                   	leave
+  801fa0:	c3                   	ret
+
+0000000000801fa1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801fa1:	55                   	push   %rbp
+  801fa2:	48 89 e5             	mov    %rsp,%rbp
+  801fa5:	48 83 ec 40          	sub    $0x40,%rsp
+  801fa9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801fad:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801fb1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801fb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fb9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801fbd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fc1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801fc5:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801fca:	0f 86 a7 00 00 00    	jbe    802077 <memcmp+0xd6>
+  801fd0:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  801fd7:	00 00 00 
+  801fda:	ff d0                	call   *%rax
+  801fdc:	83 e0 02             	and    $0x2,%eax
+  801fdf:	85 c0                	test   %eax,%eax
+  801fe1:	0f 84 90 00 00 00    	je     802077 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801fe7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801feb:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ff3:	48 89 ce             	mov    %rcx,%rsi
+  801ff6:	48 89 c7             	mov    %rax,%rdi
+  801ff9:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  802000:	00 00 00 
+  802003:	ff d0                	call   *%rax
+  802005:	e9 c2 00 00 00       	jmp    8020cc <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  80200a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80200e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802012:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  802016:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80201a:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80201e:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802022:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802026:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  802029:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  802030:	74 36                	je     802068 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  802032:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802035:	f7 d0                	not    %eax
+  802037:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80203b:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  80203e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802041:	48 63 d0             	movslq %eax,%rdx
+  802044:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802048:	48 01 d0             	add    %rdx,%rax
+  80204b:	0f b6 00             	movzbl (%rax),%eax
+  80204e:	0f b6 c0             	movzbl %al,%eax
+  802051:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  802054:	48 63 ca             	movslq %edx,%rcx
+  802057:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80205b:	48 01 ca             	add    %rcx,%rdx
+  80205e:	0f b6 12             	movzbl (%rdx),%edx
+  802061:	0f b6 d2             	movzbl %dl,%edx
+  802064:	29 d0                	sub    %edx,%eax
+  802066:	eb 64                	jmp    8020cc <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  802068:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  80206d:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  802072:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  802077:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  80207c:	77 8c                	ja     80200a <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80207e:	eb 36                	jmp    8020b6 <memcmp+0x115>
+    if (*s1 != *s2)
+  802080:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802084:	0f b6 10             	movzbl (%rax),%edx
+  802087:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80208b:	0f b6 00             	movzbl (%rax),%eax
+  80208e:	38 c2                	cmp    %al,%dl
+  802090:	74 1a                	je     8020ac <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802092:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802096:	0f b6 00             	movzbl (%rax),%eax
+  802099:	0f b6 c8             	movzbl %al,%ecx
+  80209c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020a0:	0f b6 00             	movzbl (%rax),%eax
+  8020a3:	0f b6 d0             	movzbl %al,%edx
+  8020a6:	89 c8                	mov    %ecx,%eax
+  8020a8:	29 d0                	sub    %edx,%eax
+  8020aa:	eb 20                	jmp    8020cc <memcmp+0x12b>
+    s1++, s2++;
+  8020ac:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8020b1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  8020b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020ba:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8020be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8020c2:	48 85 c0             	test   %rax,%rax
+  8020c5:	75 b9                	jne    802080 <memcmp+0xdf>
+  }
+
+  return 0;
+  8020c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020cc:	c9                   	leave
+  8020cd:	c3                   	ret
+
+00000000008020ce <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8020ce:	55                   	push   %rbp
+  8020cf:	48 89 e5             	mov    %rsp,%rbp
+  8020d2:	48 83 ec 50          	sub    $0x50,%rsp
+  8020d6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8020da:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8020dd:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8020e1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020e5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8020e9:	48 01 d0             	add    %rdx,%rax
+  8020ec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8020f0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8020f3:	66 0f 6e c0          	movd   %eax,%xmm0
+  8020f7:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8020fb:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8020ff:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  802104:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  802108:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  80210d:	76 73                	jbe    802182 <memfind+0xb4>
+  80210f:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  802116:	00 00 00 
+  802119:	ff d0                	call   *%rax
+  80211b:	83 e0 02             	and    $0x2,%eax
+  80211e:	85 c0                	test   %eax,%eax
+  802120:	74 60                	je     802182 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  802122:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802125:	0f b6 c8             	movzbl %al,%ecx
+  802128:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80212c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802130:	89 ce                	mov    %ecx,%esi
+  802132:	48 89 c7             	mov    %rax,%rdi
+  802135:	48 b8 77 16 80 00 00 	movabs $0x801677,%rax
+  80213c:	00 00 00 
+  80213f:	ff d0                	call   *%rax
+  802141:	eb 6c                	jmp    8021af <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  802143:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802147:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80214b:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80214f:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  802154:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802158:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80215c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80215f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802163:	74 13                	je     802178 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  802165:	31 c0                	xor    %eax,%eax
+  802167:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  80216c:	48 63 d0             	movslq %eax,%rdx
+  80216f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802173:	48 01 d0             	add    %rdx,%rax
+  802176:	eb 37                	jmp    8021af <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  802178:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  80217d:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802182:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  802187:	77 ba                	ja     802143 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  802189:	eb 13                	jmp    80219e <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  80218b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80218f:	0f b6 00             	movzbl (%rax),%eax
+  802192:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802195:	38 d0                	cmp    %dl,%al
+  802197:	74 11                	je     8021aa <memfind+0xdc>
+  for (; s < ends; s++)
+  802199:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80219e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021a2:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8021a6:	72 e3                	jb     80218b <memfind+0xbd>
+  8021a8:	eb 01                	jmp    8021ab <memfind+0xdd>
+      break;
+  8021aa:	90                   	nop
+  return (void *)s;
+  8021ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8021af:	c9                   	leave
+  8021b0:	c3                   	ret
+
+00000000008021b1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8021b1:	55                   	push   %rbp
+  8021b2:	48 89 e5             	mov    %rsp,%rbp
+  8021b5:	48 83 ec 38          	sub    $0x38,%rsp
+  8021b9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8021bd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8021c1:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  8021c4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  8021cb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8021d2:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8021d3:	eb 05                	jmp    8021da <strtol+0x29>
+    s++;
+  8021d5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  8021da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021de:	0f b6 00             	movzbl (%rax),%eax
+  8021e1:	3c 20                	cmp    $0x20,%al
+  8021e3:	74 f0                	je     8021d5 <strtol+0x24>
+  8021e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021e9:	0f b6 00             	movzbl (%rax),%eax
+  8021ec:	3c 09                	cmp    $0x9,%al
+  8021ee:	74 e5                	je     8021d5 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  8021f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021f4:	0f b6 00             	movzbl (%rax),%eax
+  8021f7:	3c 2b                	cmp    $0x2b,%al
+  8021f9:	75 07                	jne    802202 <strtol+0x51>
+    s++;
+  8021fb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802200:	eb 17                	jmp    802219 <strtol+0x68>
+  else if (*s == '-')
+  802202:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802206:	0f b6 00             	movzbl (%rax),%eax
+  802209:	3c 2d                	cmp    $0x2d,%al
+  80220b:	75 0c                	jne    802219 <strtol+0x68>
+    s++, neg = 1;
+  80220d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802212:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802219:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80221d:	74 06                	je     802225 <strtol+0x74>
+  80221f:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802223:	75 28                	jne    80224d <strtol+0x9c>
+  802225:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802229:	0f b6 00             	movzbl (%rax),%eax
+  80222c:	3c 30                	cmp    $0x30,%al
+  80222e:	75 1d                	jne    80224d <strtol+0x9c>
+  802230:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802234:	48 83 c0 01          	add    $0x1,%rax
+  802238:	0f b6 00             	movzbl (%rax),%eax
+  80223b:	3c 78                	cmp    $0x78,%al
+  80223d:	75 0e                	jne    80224d <strtol+0x9c>
+    s += 2, base = 16;
+  80223f:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802244:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80224b:	eb 2c                	jmp    802279 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  80224d:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802251:	75 19                	jne    80226c <strtol+0xbb>
+  802253:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802257:	0f b6 00             	movzbl (%rax),%eax
+  80225a:	3c 30                	cmp    $0x30,%al
+  80225c:	75 0e                	jne    80226c <strtol+0xbb>
+    s++, base = 8;
+  80225e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802263:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80226a:	eb 0d                	jmp    802279 <strtol+0xc8>
+  else if (base == 0)
+  80226c:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802270:	75 07                	jne    802279 <strtol+0xc8>
+    base = 10;
+  802272:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802279:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80227d:	0f b6 00             	movzbl (%rax),%eax
+  802280:	3c 2f                	cmp    $0x2f,%al
+  802282:	7e 1d                	jle    8022a1 <strtol+0xf0>
+  802284:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802288:	0f b6 00             	movzbl (%rax),%eax
+  80228b:	3c 39                	cmp    $0x39,%al
+  80228d:	7f 12                	jg     8022a1 <strtol+0xf0>
+      dig = *s - '0';
+  80228f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802293:	0f b6 00             	movzbl (%rax),%eax
+  802296:	0f be c0             	movsbl %al,%eax
+  802299:	83 e8 30             	sub    $0x30,%eax
+  80229c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80229f:	eb 4e                	jmp    8022ef <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  8022a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022a5:	0f b6 00             	movzbl (%rax),%eax
+  8022a8:	3c 60                	cmp    $0x60,%al
+  8022aa:	7e 1d                	jle    8022c9 <strtol+0x118>
+  8022ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022b0:	0f b6 00             	movzbl (%rax),%eax
+  8022b3:	3c 7a                	cmp    $0x7a,%al
+  8022b5:	7f 12                	jg     8022c9 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  8022b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022bb:	0f b6 00             	movzbl (%rax),%eax
+  8022be:	0f be c0             	movsbl %al,%eax
+  8022c1:	83 e8 57             	sub    $0x57,%eax
+  8022c4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8022c7:	eb 26                	jmp    8022ef <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  8022c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022cd:	0f b6 00             	movzbl (%rax),%eax
+  8022d0:	3c 40                	cmp    $0x40,%al
+  8022d2:	7e 47                	jle    80231b <strtol+0x16a>
+  8022d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022d8:	0f b6 00             	movzbl (%rax),%eax
+  8022db:	3c 5a                	cmp    $0x5a,%al
+  8022dd:	7f 3c                	jg     80231b <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  8022df:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022e3:	0f b6 00             	movzbl (%rax),%eax
+  8022e6:	0f be c0             	movsbl %al,%eax
+  8022e9:	83 e8 37             	sub    $0x37,%eax
+  8022ec:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  8022ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022f2:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8022f5:	7d 23                	jge    80231a <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8022f7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8022fc:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022ff:	48 98                	cltq
+  802301:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802306:	48 89 c2             	mov    %rax,%rdx
+  802309:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80230c:	48 98                	cltq
+  80230e:	48 01 d0             	add    %rdx,%rax
+  802311:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  802315:	e9 5f ff ff ff       	jmp    802279 <strtol+0xc8>
+      break;
+  80231a:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  80231b:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802320:	74 0b                	je     80232d <strtol+0x17c>
+    *endptr = (char *)s;
+  802322:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802326:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80232a:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  80232d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802331:	74 09                	je     80233c <strtol+0x18b>
+  802333:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802337:	48 f7 d8             	neg    %rax
+  80233a:	eb 04                	jmp    802340 <strtol+0x18f>
+  80233c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802340:	c9                   	leave
+  802341:	c3                   	ret
+
+0000000000802342 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802342:	55                   	push   %rbp
+  802343:	48 89 e5             	mov    %rsp,%rbp
+  802346:	53                   	push   %rbx
+  802347:	48 83 ec 48          	sub    $0x48,%rsp
+  80234b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80234f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802353:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802357:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80235b:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80235f:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802363:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802367:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80236b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80236f:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802373:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802377:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80237b:	4c 89 c3             	mov    %r8,%rbx
+  80237e:	cd 30                	int    $0x30
+  802380:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802384:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802389:	74 46                	je     8023d1 <syscall+0x8f>
+  80238b:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802390:	7e 3f                	jle    8023d1 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802392:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802396:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80239a:	49 89 d0             	mov    %rdx,%r8
+  80239d:	48 89 c1             	mov    %rax,%rcx
+  8023a0:	48 b8 08 6f 80 00 00 	movabs $0x806f08,%rax
+  8023a7:	00 00 00 
+  8023aa:	48 89 c2             	mov    %rax,%rdx
+  8023ad:	be 22 00 00 00       	mov    $0x22,%esi
+  8023b2:	48 b8 27 6f 80 00 00 	movabs $0x806f27,%rax
+  8023b9:	00 00 00 
+  8023bc:	48 89 c7             	mov    %rax,%rdi
+  8023bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c4:	49 b9 55 06 80 00 00 	movabs $0x800655,%r9
+  8023cb:	00 00 00 
+  8023ce:	41 ff d1             	call   *%r9
+
+  return ret;
+  8023d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8023d5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+
+00000000008023db <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8023db:	55                   	push   %rbp
+  8023dc:	48 89 e5             	mov    %rsp,%rbp
+  8023df:	48 83 ec 10          	sub    $0x10,%rsp
+  8023e3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023e7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8023eb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f7:	6a 00                	push   $0x0
+  8023f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802405:	48 89 d1             	mov    %rdx,%rcx
+  802408:	48 89 c2             	mov    %rax,%rdx
+  80240b:	be 00 00 00 00       	mov    $0x0,%esi
+  802410:	bf 00 00 00 00       	mov    $0x0,%edi
+  802415:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+  802421:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802425:	90                   	nop
+  802426:	c9                   	leave
+  802427:	c3                   	ret
+
+0000000000802428 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802428:	55                   	push   %rbp
+  802429:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80242c:	48 83 ec 08          	sub    $0x8,%rsp
+  802430:	6a 00                	push   $0x0
+  802432:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802438:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80243e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802443:	ba 00 00 00 00       	mov    $0x0,%edx
+  802448:	be 00 00 00 00       	mov    $0x0,%esi
+  80244d:	bf 01 00 00 00       	mov    $0x1,%edi
+  802452:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802459:	00 00 00 
+  80245c:	ff d0                	call   *%rax
+  80245e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802462:	c9                   	leave
+  802463:	c3                   	ret
+
+0000000000802464 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802464:	55                   	push   %rbp
+  802465:	48 89 e5             	mov    %rsp,%rbp
+  802468:	48 83 ec 10          	sub    $0x10,%rsp
+  80246c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80246f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802472:	48 98                	cltq
+  802474:	48 83 ec 08          	sub    $0x8,%rsp
+  802478:	6a 00                	push   $0x0
+  80247a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802480:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802486:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80248b:	48 89 c2             	mov    %rax,%rdx
+  80248e:	be 01 00 00 00       	mov    $0x1,%esi
+  802493:	bf 03 00 00 00       	mov    $0x3,%edi
+  802498:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  80249f:	00 00 00 
+  8024a2:	ff d0                	call   *%rax
+  8024a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024a8:	c9                   	leave
+  8024a9:	c3                   	ret
+
+00000000008024aa <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8024aa:	55                   	push   %rbp
+  8024ab:	48 89 e5             	mov    %rsp,%rbp
+  8024ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8024b2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8024b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024b8:	48 98                	cltq
+  8024ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8024be:	6a 00                	push   $0x0
+  8024c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024d1:	48 89 c2             	mov    %rax,%rdx
+  8024d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024d9:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024de:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  8024e5:	00 00 00 
+  8024e8:	ff d0                	call   *%rax
+  8024ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024ee:	90                   	nop
+  8024ef:	c9                   	leave
+  8024f0:	c3                   	ret
+
+00000000008024f1 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8024f1:	55                   	push   %rbp
+  8024f2:	48 89 e5             	mov    %rsp,%rbp
+  8024f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8024f9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024fc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802500:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802503:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802506:	b8 05 00 00 00       	mov    $0x5,%eax
+  80250b:	cd 30                	int    $0x30
+  80250d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802511:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802515:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80251a:	7e 3d                	jle    802559 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  80251c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802520:	49 89 c0             	mov    %rax,%r8
+  802523:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802528:	48 b8 08 6f 80 00 00 	movabs $0x806f08,%rax
+  80252f:	00 00 00 
+  802532:	48 89 c2             	mov    %rax,%rdx
+  802535:	be 49 00 00 00       	mov    $0x49,%esi
+  80253a:	48 b8 27 6f 80 00 00 	movabs $0x806f27,%rax
+  802541:	00 00 00 
+  802544:	48 89 c7             	mov    %rax,%rdi
+  802547:	b8 00 00 00 00       	mov    $0x0,%eax
+  80254c:	49 b9 55 06 80 00 00 	movabs $0x800655,%r9
+  802553:	00 00 00 
+  802556:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802559:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80255e:	75 13                	jne    802573 <sys_env_wait+0x82>
+  802560:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802565:	74 0c                	je     802573 <sys_env_wait+0x82>
+    *status = st;
+  802567:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80256b:	89 c2                	mov    %eax,%edx
+  80256d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802571:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802573:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802577:	c9                   	leave
+  802578:	c3                   	ret
+
+0000000000802579 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802579:	55                   	push   %rbp
+  80257a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80257d:	48 83 ec 08          	sub    $0x8,%rsp
+  802581:	6a 00                	push   $0x0
+  802583:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802589:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80258f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802594:	ba 00 00 00 00       	mov    $0x0,%edx
+  802599:	be 00 00 00 00       	mov    $0x0,%esi
+  80259e:	bf 02 00 00 00       	mov    $0x2,%edi
+  8025a3:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  8025aa:	00 00 00 
+  8025ad:	ff d0                	call   *%rax
+  8025af:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025b3:	c9                   	leave
+  8025b4:	c3                   	ret
+
+00000000008025b5 <sys_yield>:
+
+void
+sys_yield(void) {
+  8025b5:	55                   	push   %rbp
+  8025b6:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8025b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8025bd:	6a 00                	push   $0x0
+  8025bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8025da:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8025df:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  8025e6:	00 00 00 
+  8025e9:	ff d0                	call   *%rax
+  8025eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ef:	90                   	nop
+  8025f0:	c9                   	leave
+  8025f1:	c3                   	ret
+
+00000000008025f2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8025f2:	55                   	push   %rbp
+  8025f3:	48 89 e5             	mov    %rsp,%rbp
+  8025f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8025fa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025fd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802601:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802604:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802607:	48 63 c8             	movslq %eax,%rcx
+  80260a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80260e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802611:	48 98                	cltq
+  802613:	48 83 ec 08          	sub    $0x8,%rsp
+  802617:	6a 00                	push   $0x0
+  802619:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80261f:	49 89 c8             	mov    %rcx,%r8
+  802622:	48 89 d1             	mov    %rdx,%rcx
+  802625:	48 89 c2             	mov    %rax,%rdx
+  802628:	be 01 00 00 00       	mov    $0x1,%esi
+  80262d:	bf 06 00 00 00       	mov    $0x6,%edi
+  802632:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802639:	00 00 00 
+  80263c:	ff d0                	call   *%rax
+  80263e:	48 83 c4 10          	add    $0x10,%rsp
+  802642:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802645:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802648:	c9                   	leave
+  802649:	c3                   	ret
+
+000000000080264a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80264a:	55                   	push   %rbp
+  80264b:	48 89 e5             	mov    %rsp,%rbp
+  80264e:	48 83 ec 20          	sub    $0x20,%rsp
+  802652:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802655:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802659:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80265c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802660:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802664:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802667:	48 63 c8             	movslq %eax,%rcx
+  80266a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80266e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802671:	48 63 f0             	movslq %eax,%rsi
+  802674:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802678:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80267b:	48 98                	cltq
+  80267d:	48 83 ec 08          	sub    $0x8,%rsp
+  802681:	51                   	push   %rcx
+  802682:	49 89 f9             	mov    %rdi,%r9
+  802685:	49 89 f0             	mov    %rsi,%r8
+  802688:	48 89 d1             	mov    %rdx,%rcx
+  80268b:	48 89 c2             	mov    %rax,%rdx
+  80268e:	be 01 00 00 00       	mov    $0x1,%esi
+  802693:	bf 07 00 00 00       	mov    $0x7,%edi
+  802698:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  80269f:	00 00 00 
+  8026a2:	ff d0                	call   *%rax
+  8026a4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026a8:	c9                   	leave
+  8026a9:	c3                   	ret
+
+00000000008026aa <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8026aa:	55                   	push   %rbp
+  8026ab:	48 89 e5             	mov    %rsp,%rbp
+  8026ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8026b2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026b5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8026b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026c0:	48 98                	cltq
+  8026c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8026c6:	6a 00                	push   $0x0
+  8026c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026d4:	48 89 d1             	mov    %rdx,%rcx
+  8026d7:	48 89 c2             	mov    %rax,%rdx
+  8026da:	be 01 00 00 00       	mov    $0x1,%esi
+  8026df:	bf 08 00 00 00       	mov    $0x8,%edi
+  8026e4:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  8026eb:	00 00 00 
+  8026ee:	ff d0                	call   *%rax
+  8026f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f4:	c9                   	leave
+  8026f5:	c3                   	ret
+
+00000000008026f6 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8026f6:	55                   	push   %rbp
+  8026f7:	48 89 e5             	mov    %rsp,%rbp
+  8026fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8026fe:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802701:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802704:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802707:	48 63 d0             	movslq %eax,%rdx
+  80270a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80270d:	48 98                	cltq
+  80270f:	48 83 ec 08          	sub    $0x8,%rsp
+  802713:	6a 00                	push   $0x0
+  802715:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80271b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802721:	48 89 d1             	mov    %rdx,%rcx
+  802724:	48 89 c2             	mov    %rax,%rdx
+  802727:	be 01 00 00 00       	mov    $0x1,%esi
+  80272c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802731:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802738:	00 00 00 
+  80273b:	ff d0                	call   *%rax
+  80273d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802741:	c9                   	leave
+  802742:	c3                   	ret
+
+0000000000802743 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802743:	55                   	push   %rbp
+  802744:	48 89 e5             	mov    %rsp,%rbp
+  802747:	48 83 ec 10          	sub    $0x10,%rsp
+  80274b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80274e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802752:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802756:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802759:	48 98                	cltq
+  80275b:	48 83 ec 08          	sub    $0x8,%rsp
+  80275f:	6a 00                	push   $0x0
+  802761:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802767:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80276d:	48 89 d1             	mov    %rdx,%rcx
+  802770:	48 89 c2             	mov    %rax,%rdx
+  802773:	be 01 00 00 00       	mov    $0x1,%esi
+  802778:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80277d:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802784:	00 00 00 
+  802787:	ff d0                	call   *%rax
+  802789:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278d:	c9                   	leave
+  80278e:	c3                   	ret
+
+000000000080278f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80278f:	55                   	push   %rbp
+  802790:	48 89 e5             	mov    %rsp,%rbp
+  802793:	48 83 ec 10          	sub    $0x10,%rsp
+  802797:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80279a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80279e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027a5:	48 98                	cltq
+  8027a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ab:	6a 00                	push   $0x0
+  8027ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027b9:	48 89 d1             	mov    %rdx,%rcx
+  8027bc:	48 89 c2             	mov    %rax,%rdx
+  8027bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8027c4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027c9:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+  8027d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027d9:	c9                   	leave
+  8027da:	c3                   	ret
+
+00000000008027db <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8027db:	55                   	push   %rbp
+  8027dc:	48 89 e5             	mov    %rsp,%rbp
+  8027df:	48 83 ec 20          	sub    $0x20,%rsp
+  8027e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027ea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8027ee:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8027f1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8027f4:	48 63 f0             	movslq %eax,%rsi
+  8027f7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027ff:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802802:	48 98                	cltq
+  802804:	48 83 ec 08          	sub    $0x8,%rsp
+  802808:	6a 00                	push   $0x0
+  80280a:	49 89 f1             	mov    %rsi,%r9
+  80280d:	49 89 c8             	mov    %rcx,%r8
+  802810:	48 89 d1             	mov    %rdx,%rcx
+  802813:	48 89 c2             	mov    %rax,%rdx
+  802816:	be 00 00 00 00       	mov    $0x0,%esi
+  80281b:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802820:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802827:	00 00 00 
+  80282a:	ff d0                	call   *%rax
+  80282c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802830:	c9                   	leave
+  802831:	c3                   	ret
+
+0000000000802832 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802832:	55                   	push   %rbp
+  802833:	48 89 e5             	mov    %rsp,%rbp
+  802836:	48 83 ec 10          	sub    $0x10,%rsp
+  80283a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  80283e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802842:	48 83 ec 08          	sub    $0x8,%rsp
+  802846:	6a 00                	push   $0x0
+  802848:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80284e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802854:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802859:	48 89 c2             	mov    %rax,%rdx
+  80285c:	be 01 00 00 00       	mov    $0x1,%esi
+  802861:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802866:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  80286d:	00 00 00 
+  802870:	ff d0                	call   *%rax
+  802872:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802876:	c9                   	leave
+  802877:	c3                   	ret
+
+0000000000802878 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802878:	55                   	push   %rbp
+  802879:	48 89 e5             	mov    %rsp,%rbp
+  80287c:	48 83 ec 10          	sub    $0x10,%rsp
+  802880:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802884:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802888:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80288c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802890:	48 83 ec 08          	sub    $0x8,%rsp
+  802894:	6a 00                	push   $0x0
+  802896:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80289c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028a2:	48 89 d1             	mov    %rdx,%rcx
+  8028a5:	48 89 c2             	mov    %rax,%rdx
+  8028a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8028ad:	bf 10 00 00 00       	mov    $0x10,%edi
+  8028b2:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  8028b9:	00 00 00 
+  8028bc:	ff d0                	call   *%rax
+  8028be:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028c2:	c9                   	leave
+  8028c3:	c3                   	ret
+
+00000000008028c4 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8028c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028cc:	6a 00                	push   $0x0
+  8028ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e9:	bf 11 00 00 00       	mov    $0x11,%edi
+  8028ee:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  8028f5:	00 00 00 
+  8028f8:	ff d0                	call   *%rax
+  8028fa:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028fe:	c9                   	leave
+  8028ff:	c3                   	ret
+
+0000000000802900 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802900:	55                   	push   %rbp
+  802901:	48 89 e5             	mov    %rsp,%rbp
+  802904:	48 83 ec 10          	sub    $0x10,%rsp
+  802908:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80290c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802910:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802914:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802918:	48 83 ec 08          	sub    $0x8,%rsp
+  80291c:	6a 00                	push   $0x0
+  80291e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802924:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80292a:	48 89 d1             	mov    %rdx,%rcx
+  80292d:	48 89 c2             	mov    %rax,%rdx
+  802930:	be 00 00 00 00       	mov    $0x0,%esi
+  802935:	bf 12 00 00 00       	mov    $0x12,%edi
+  80293a:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80294a:	c9                   	leave
+  80294b:	c3                   	ret
+
+000000000080294c <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  80294c:	55                   	push   %rbp
+  80294d:	48 89 e5             	mov    %rsp,%rbp
+  802950:	48 83 ec 20          	sub    $0x20,%rsp
+  802954:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802958:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80295c:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80295f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802962:	48 63 c8             	movslq %eax,%rcx
+  802965:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802969:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80296d:	48 83 ec 08          	sub    $0x8,%rsp
+  802971:	6a 00                	push   $0x0
+  802973:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802979:	49 89 c8             	mov    %rcx,%r8
+  80297c:	48 89 d1             	mov    %rdx,%rcx
+  80297f:	48 89 c2             	mov    %rax,%rdx
+  802982:	be 00 00 00 00       	mov    $0x0,%esi
+  802987:	bf 13 00 00 00       	mov    $0x13,%edi
+  80298c:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802993:	00 00 00 
+  802996:	ff d0                	call   *%rax
+  802998:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80299c:	c9                   	leave
+  80299d:	c3                   	ret
+
+000000000080299e <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80299e:	55                   	push   %rbp
+  80299f:	48 89 e5             	mov    %rsp,%rbp
+  8029a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8029a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029aa:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8029ad:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8029b1:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029b5:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8029b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c0:	6a 00                	push   $0x0
+  8029c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029c8:	49 89 c8             	mov    %rcx,%r8
+  8029cb:	48 89 d1             	mov    %rdx,%rcx
+  8029ce:	48 89 c2             	mov    %rax,%rdx
+  8029d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d6:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029db:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  8029e2:	00 00 00 
+  8029e5:	ff d0                	call   *%rax
+  8029e7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029eb:	c9                   	leave
+  8029ec:	c3                   	ret
+
+00000000008029ed <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8029ed:	55                   	push   %rbp
+  8029ee:	48 89 e5             	mov    %rsp,%rbp
+  8029f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8029f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029f9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8029fc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8029ff:	48 63 d0             	movslq %eax,%rdx
+  802a02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a06:	48 83 ec 08          	sub    $0x8,%rsp
+  802a0a:	6a 00                	push   $0x0
+  802a0c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a12:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a18:	48 89 d1             	mov    %rdx,%rcx
+  802a1b:	48 89 c2             	mov    %rax,%rdx
+  802a1e:	be 00 00 00 00       	mov    $0x0,%esi
+  802a23:	bf 15 00 00 00       	mov    $0x15,%edi
+  802a28:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802a2f:	00 00 00 
+  802a32:	ff d0                	call   *%rax
+  802a34:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a38:	c9                   	leave
+  802a39:	c3                   	ret
+
+0000000000802a3a <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802a3a:	55                   	push   %rbp
+  802a3b:	48 89 e5             	mov    %rsp,%rbp
+  802a3e:	48 83 ec 20          	sub    $0x20,%rsp
+  802a42:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a46:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802a49:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802a4c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802a50:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802a54:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802a57:	48 63 c8             	movslq %eax,%rcx
+  802a5a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802a5d:	48 63 d0             	movslq %eax,%rdx
+  802a60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a64:	48 83 ec 08          	sub    $0x8,%rsp
+  802a68:	6a 00                	push   $0x0
+  802a6a:	49 89 f1             	mov    %rsi,%r9
+  802a6d:	49 89 c8             	mov    %rcx,%r8
+  802a70:	48 89 d1             	mov    %rdx,%rcx
+  802a73:	48 89 c2             	mov    %rax,%rdx
+  802a76:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7b:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a80:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802a87:	00 00 00 
+  802a8a:	ff d0                	call   *%rax
+  802a8c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a90:	c9                   	leave
+  802a91:	c3                   	ret
+
+0000000000802a92 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802a92:	55                   	push   %rbp
+  802a93:	48 89 e5             	mov    %rsp,%rbp
+  802a96:	48 83 ec 30          	sub    $0x30,%rsp
+  802a9a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a9e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802aa2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802aa6:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802aaa:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802aae:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802ab2:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802ab6:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802aba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802abe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ac2:	48 83 ec 08          	sub    $0x8,%rsp
+  802ac6:	51                   	push   %rcx
+  802ac7:	49 89 f9             	mov    %rdi,%r9
+  802aca:	49 89 f0             	mov    %rsi,%r8
+  802acd:	48 89 d1             	mov    %rdx,%rcx
+  802ad0:	48 89 c2             	mov    %rax,%rdx
+  802ad3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ad8:	bf 17 00 00 00       	mov    $0x17,%edi
+  802add:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802ae4:	00 00 00 
+  802ae7:	ff d0                	call   *%rax
+  802ae9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aed:	c9                   	leave
+  802aee:	c3                   	ret
+
+0000000000802aef <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802aef:	55                   	push   %rbp
+  802af0:	48 89 e5             	mov    %rsp,%rbp
+  802af3:	48 83 ec 10          	sub    $0x10,%rsp
+  802af7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802afa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802afd:	48 98                	cltq
+  802aff:	48 83 ec 08          	sub    $0x8,%rsp
+  802b03:	6a 00                	push   $0x0
+  802b05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b0b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b16:	48 89 c2             	mov    %rax,%rdx
+  802b19:	be 00 00 00 00       	mov    $0x0,%esi
+  802b1e:	bf 18 00 00 00       	mov    $0x18,%edi
+  802b23:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802b2a:	00 00 00 
+  802b2d:	ff d0                	call   *%rax
+  802b2f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b33:	90                   	nop
+  802b34:	c9                   	leave
+  802b35:	c3                   	ret
+
+0000000000802b36 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802b36:	55                   	push   %rbp
+  802b37:	48 89 e5             	mov    %rsp,%rbp
+  802b3a:	48 83 ec 30          	sub    $0x30,%rsp
+  802b3e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b41:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802b45:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802b49:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802b4c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802b4f:	48 63 f0             	movslq %eax,%rsi
+  802b52:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802b56:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b5a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b5d:	48 98                	cltq
+  802b5f:	48 83 ec 08          	sub    $0x8,%rsp
+  802b63:	6a 00                	push   $0x0
+  802b65:	49 89 f1             	mov    %rsi,%r9
+  802b68:	49 89 c8             	mov    %rcx,%r8
+  802b6b:	48 89 d1             	mov    %rdx,%rcx
+  802b6e:	48 89 c2             	mov    %rax,%rdx
+  802b71:	be 01 00 00 00       	mov    $0x1,%esi
+  802b76:	bf 19 00 00 00       	mov    $0x19,%edi
+  802b7b:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802b82:	00 00 00 
+  802b85:	ff d0                	call   *%rax
+  802b87:	48 83 c4 10          	add    $0x10,%rsp
+  802b8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802b8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b91:	c9                   	leave
+  802b92:	c3                   	ret
+
+0000000000802b93 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802b93:	55                   	push   %rbp
+  802b94:	48 89 e5             	mov    %rsp,%rbp
+  802b97:	48 83 ec 20          	sub    $0x20,%rsp
+  802b9b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b9f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802ba3:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802ba6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ba9:	48 63 c8             	movslq %eax,%rcx
+  802bac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802bb0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bb4:	48 83 ec 08          	sub    $0x8,%rsp
+  802bb8:	6a 00                	push   $0x0
+  802bba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bc0:	49 89 c8             	mov    %rcx,%r8
+  802bc3:	48 89 d1             	mov    %rdx,%rcx
+  802bc6:	48 89 c2             	mov    %rax,%rdx
+  802bc9:	be 01 00 00 00       	mov    $0x1,%esi
+  802bce:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802bd3:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802bda:	00 00 00 
+  802bdd:	ff d0                	call   *%rax
+  802bdf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802be3:	c9                   	leave
+  802be4:	c3                   	ret
+
+0000000000802be5 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802be5:	55                   	push   %rbp
+  802be6:	48 89 e5             	mov    %rsp,%rbp
+  802be9:	48 83 ec 20          	sub    $0x20,%rsp
+  802bed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802bf1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802bf5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802bf9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802bfd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802c01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c05:	48 83 ec 08          	sub    $0x8,%rsp
+  802c09:	6a 00                	push   $0x0
+  802c0b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c11:	49 89 c8             	mov    %rcx,%r8
+  802c14:	48 89 d1             	mov    %rdx,%rcx
+  802c17:	48 89 c2             	mov    %rax,%rdx
+  802c1a:	be 01 00 00 00       	mov    $0x1,%esi
+  802c1f:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802c24:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c34:	c9                   	leave
+  802c35:	c3                   	ret
+
+0000000000802c36 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802c36:	55                   	push   %rbp
+  802c37:	48 89 e5             	mov    %rsp,%rbp
+  802c3a:	48 83 ec 30          	sub    $0x30,%rsp
+  802c3e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802c42:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802c46:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802c49:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802c4d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802c51:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802c54:	48 63 c8             	movslq %eax,%rcx
+  802c57:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c5f:	48 83 ec 08          	sub    $0x8,%rsp
+  802c63:	6a 00                	push   $0x0
+  802c65:	49 89 f1             	mov    %rsi,%r9
+  802c68:	49 89 c8             	mov    %rcx,%r8
+  802c6b:	48 89 d1             	mov    %rdx,%rcx
+  802c6e:	48 89 c2             	mov    %rax,%rdx
+  802c71:	be 01 00 00 00       	mov    $0x1,%esi
+  802c76:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802c7b:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+  802c87:	48 83 c4 10          	add    $0x10,%rsp
+  802c8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802c8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c91:	c9                   	leave
+  802c92:	c3                   	ret
+
+0000000000802c93 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802c93:	55                   	push   %rbp
+  802c94:	48 89 e5             	mov    %rsp,%rbp
+  802c97:	48 83 ec 10          	sub    $0x10,%rsp
+  802c9b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802c9e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ca1:	48 98                	cltq
+  802ca3:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca7:	6a 00                	push   $0x0
+  802ca9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802caf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cb5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cba:	48 89 c2             	mov    %rax,%rdx
+  802cbd:	be 01 00 00 00       	mov    $0x1,%esi
+  802cc2:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802cc7:	48 b8 42 23 80 00 00 	movabs $0x802342,%rax
+  802cce:	00 00 00 
+  802cd1:	ff d0                	call   *%rax
+  802cd3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cd7:	c9                   	leave
+  802cd8:	c3                   	ret
+
+0000000000802cd9 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802cd9:	55                   	push   %rbp
+  802cda:	48 89 e5             	mov    %rsp,%rbp
+  802cdd:	48 83 ec 40          	sub    $0x40,%rsp
+  802ce1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802ce5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ce9:	48 8b 00             	mov    (%rax),%rax
+  802cec:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802cf0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cf4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802cf8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802cfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d00:	83 e0 02             	and    $0x2,%eax
+  802d03:	48 85 c0             	test   %rax,%rax
+  802d06:	74 25                	je     802d2d <pgfault+0x54>
+  802d08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d0c:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d10:	48 89 c2             	mov    %rax,%rdx
+  802d13:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d1a:	01 00 00 
+  802d1d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d21:	83 e0 02             	and    $0x2,%eax
+  802d24:	48 85 c0             	test   %rax,%rax
+  802d27:	0f 85 fe 01 00 00    	jne    802f2b <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802d2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d31:	83 e0 02             	and    $0x2,%eax
+  802d34:	48 85 c0             	test   %rax,%rax
+  802d37:	74 23                	je     802d5c <pgfault+0x83>
+  802d39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d3d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d41:	48 89 c2             	mov    %rax,%rdx
+  802d44:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d4b:	01 00 00 
+  802d4e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d52:	25 00 08 00 00       	and    $0x800,%eax
+  802d57:	48 85 c0             	test   %rax,%rax
+  802d5a:	75 3f                	jne    802d9b <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802d5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d60:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802d64:	49 89 d0             	mov    %rdx,%r8
+  802d67:	48 89 c1             	mov    %rax,%rcx
+  802d6a:	48 b8 38 6f 80 00 00 	movabs $0x806f38,%rax
+  802d71:	00 00 00 
+  802d74:	48 89 c2             	mov    %rax,%rdx
+  802d77:	be 26 00 00 00       	mov    $0x26,%esi
+  802d7c:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  802d83:	00 00 00 
+  802d86:	48 89 c7             	mov    %rax,%rdi
+  802d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8e:	49 b9 55 06 80 00 00 	movabs $0x800655,%r9
+  802d95:	00 00 00 
+  802d98:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802d9b:	48 b8 91 59 80 00 00 	movabs $0x805991,%rax
+  802da2:	00 00 00 
+  802da5:	ff d0                	call   *%rax
+  802da7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802dab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802daf:	ba 07 00 00 00       	mov    $0x7,%edx
+  802db4:	48 89 c6             	mov    %rax,%rsi
+  802db7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dbc:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  802dc3:	00 00 00 
+  802dc6:	ff d0                	call   *%rax
+  802dc8:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802dcb:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802dcf:	79 36                	jns    802e07 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802dd1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802dd4:	89 c1                	mov    %eax,%ecx
+  802dd6:	48 b8 78 6f 80 00 00 	movabs $0x806f78,%rax
+  802ddd:	00 00 00 
+  802de0:	48 89 c2             	mov    %rax,%rdx
+  802de3:	be 35 00 00 00       	mov    $0x35,%esi
+  802de8:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  802def:	00 00 00 
+  802df2:	48 89 c7             	mov    %rax,%rdi
+  802df5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfa:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  802e01:	00 00 00 
+  802e04:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802e07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e0b:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802e0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802e13:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e19:	48 89 c1             	mov    %rax,%rcx
+  802e1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e20:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802e25:	48 89 ce             	mov    %rcx,%rsi
+  802e28:	48 89 c7             	mov    %rax,%rdi
+  802e2b:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802e37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e3b:	48 c1 e8 0c          	shr    $0xc,%rax
+  802e3f:	48 89 c2             	mov    %rax,%rdx
+  802e42:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e49:	01 00 00 
+  802e4c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e50:	25 00 08 00 00       	and    $0x800,%eax
+  802e55:	48 85 c0             	test   %rax,%rax
+  802e58:	74 7a                	je     802ed4 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802e5a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e5e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802e62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e66:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e6c:	48 89 c2             	mov    %rax,%rdx
+  802e6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e73:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802e79:	48 89 d1             	mov    %rdx,%rcx
+  802e7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e81:	48 89 c6             	mov    %rax,%rsi
+  802e84:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e89:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+  802e95:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802e98:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802e9c:	79 36                	jns    802ed4 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802e9e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ea1:	89 c1                	mov    %eax,%ecx
+  802ea3:	48 b8 a0 6f 80 00 00 	movabs $0x806fa0,%rax
+  802eaa:	00 00 00 
+  802ead:	48 89 c2             	mov    %rax,%rdx
+  802eb0:	be 42 00 00 00       	mov    $0x42,%esi
+  802eb5:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  802ebc:	00 00 00 
+  802ebf:	48 89 c7             	mov    %rax,%rdi
+  802ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec7:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  802ece:	00 00 00 
+  802ed1:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802ed4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ed8:	48 89 c6             	mov    %rax,%rsi
+  802edb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee0:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  802ee7:	00 00 00 
+  802eea:	ff d0                	call   *%rax
+  802eec:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802eef:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802ef3:	79 37                	jns    802f2c <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802ef5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ef8:	89 c1                	mov    %eax,%ecx
+  802efa:	48 b8 c8 6f 80 00 00 	movabs $0x806fc8,%rax
+  802f01:	00 00 00 
+  802f04:	48 89 c2             	mov    %rax,%rdx
+  802f07:	be 46 00 00 00       	mov    $0x46,%esi
+  802f0c:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  802f13:	00 00 00 
+  802f16:	48 89 c7             	mov    %rax,%rdi
+  802f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f1e:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  802f25:	00 00 00 
+  802f28:	41 ff d0             	call   *%r8
+    return;
+  802f2b:	90                   	nop
+  }
+}
+  802f2c:	c9                   	leave
+  802f2d:	c3                   	ret
+
+0000000000802f2e <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802f2e:	55                   	push   %rbp
+  802f2f:	48 89 e5             	mov    %rsp,%rbp
+  802f32:	48 83 ec 30          	sub    $0x30,%rsp
+  802f36:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f39:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802f3d:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802f44:	01 00 00 
+  802f47:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f4b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f4f:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f54:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802f58:	48 b8 79 25 80 00 00 	movabs $0x802579,%rax
+  802f5f:	00 00 00 
+  802f62:	ff d0                	call   *%rax
+  802f64:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802f67:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f6b:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f6f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802f73:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802f7a:	01 00 00 
+  802f7d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f81:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f85:	25 00 04 00 00       	and    $0x400,%eax
+  802f8a:	48 85 c0             	test   %rax,%rax
+  802f8d:	74 7b                	je     80300a <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802f8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f93:	89 c1                	mov    %eax,%ecx
+  802f95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802f99:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f9d:	48 89 c2             	mov    %rax,%rdx
+  802fa0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fa4:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fa8:	48 89 c6             	mov    %rax,%rsi
+  802fab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fae:	41 89 c8             	mov    %ecx,%r8d
+  802fb1:	48 89 d1             	mov    %rdx,%rcx
+  802fb4:	89 c2                	mov    %eax,%edx
+  802fb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fbb:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  802fc2:	00 00 00 
+  802fc5:	ff d0                	call   *%rax
+  802fc7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fce:	0f 89 da 00 00 00    	jns    8030ae <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802fd4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fd7:	89 c1                	mov    %eax,%ecx
+  802fd9:	48 b8 f0 6f 80 00 00 	movabs $0x806ff0,%rax
+  802fe0:	00 00 00 
+  802fe3:	48 89 c2             	mov    %rax,%rdx
+  802fe6:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802feb:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  802ff2:	00 00 00 
+  802ff5:	48 89 c7             	mov    %rax,%rdi
+  802ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffd:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  803004:	00 00 00 
+  803007:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  80300a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80300e:	25 02 08 00 00       	and    $0x802,%eax
+  803013:	48 85 c0             	test   %rax,%rax
+  803016:	74 6e                	je     803086 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  803018:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80301c:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  803022:	80 cc 08             	or     $0x8,%ah
+  803025:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  803029:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80302d:	89 c7                	mov    %eax,%edi
+  80302f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803033:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803036:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80303a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80303d:	41 89 f8             	mov    %edi,%r8d
+  803040:	89 c7                	mov    %eax,%edi
+  803042:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  803049:	00 00 00 
+  80304c:	ff d0                	call   *%rax
+  80304e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  803051:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803055:	79 05                	jns    80305c <duppage+0x12e>
+      return r;
+  803057:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80305a:	eb 55                	jmp    8030b1 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  80305c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803060:	89 c7                	mov    %eax,%edi
+  803062:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803066:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803069:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  80306d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803070:	41 89 f8             	mov    %edi,%r8d
+  803073:	89 c7                	mov    %eax,%edi
+  803075:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  80307c:	00 00 00 
+  80307f:	ff d0                	call   *%rax
+  803081:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803084:	eb 28                	jmp    8030ae <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  803086:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80308a:	89 c7                	mov    %eax,%edi
+  80308c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803090:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803093:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  803097:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80309a:	41 89 f8             	mov    %edi,%r8d
+  80309d:	89 c7                	mov    %eax,%edi
+  80309f:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  8030a6:	00 00 00 
+  8030a9:	ff d0                	call   *%rax
+  8030ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  8030ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8030b1:	c9                   	leave
+  8030b2:	c3                   	ret
+
+00000000008030b3 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  8030b3:	55                   	push   %rbp
+  8030b4:	48 89 e5             	mov    %rsp,%rbp
+  8030b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8030bb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8030be:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  8030c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030c6:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  8030ce:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8030d5:	01 00 00 
+  8030d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030dc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8030e0:	25 00 08 00 00       	and    $0x800,%eax
+  8030e5:	48 85 c0             	test   %rax,%rax
+  8030e8:	74 0d                	je     8030f7 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  8030ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030ee:	0f b6 10             	movzbl (%rax),%edx
+  8030f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030f5:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  8030f7:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8030fe:	01 00 00 
+  803101:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803105:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803109:	25 07 0e 00 00       	and    $0xe07,%eax
+  80310e:	89 c6                	mov    %eax,%esi
+  803110:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  803114:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803117:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80311b:	41 89 f0             	mov    %esi,%r8d
+  80311e:	48 89 c6             	mov    %rax,%rsi
+  803121:	bf 00 00 00 00       	mov    $0x0,%edi
+  803126:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  80312d:	00 00 00 
+  803130:	ff d0                	call   *%rax
+}
+  803132:	c9                   	leave
+  803133:	c3                   	ret
+
+0000000000803134 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  803134:	55                   	push   %rbp
+  803135:	48 89 e5             	mov    %rsp,%rbp
+  803138:	48 83 ec 40          	sub    $0x40,%rsp
+  80313c:	89 f8                	mov    %edi,%eax
+  80313e:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  803141:	48 b8 d9 2c 80 00 00 	movabs $0x802cd9,%rax
+  803148:	00 00 00 
+  80314b:	48 89 c7             	mov    %rax,%rdi
+  80314e:	48 b8 43 5e 80 00 00 	movabs $0x805e43,%rax
+  803155:	00 00 00 
+  803158:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  80315a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80315f:	cd 30                	int    $0x30
+  803161:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  803164:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  803167:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80316a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80316e:	79 36                	jns    8031a6 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  803170:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803173:	89 c1                	mov    %eax,%ecx
+  803175:	48 b8 1b 70 80 00 00 	movabs $0x80701b,%rax
+  80317c:	00 00 00 
+  80317f:	48 89 c2             	mov    %rax,%rdx
+  803182:	be 8f 00 00 00       	mov    $0x8f,%esi
+  803187:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  80318e:	00 00 00 
+  803191:	48 89 c7             	mov    %rax,%rdi
+  803194:	b8 00 00 00 00       	mov    $0x0,%eax
+  803199:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  8031a0:	00 00 00 
+  8031a3:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  8031a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8031aa:	75 0a                	jne    8031b6 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  8031ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b1:	e9 d3 02 00 00       	jmp    803489 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  8031b6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8031bd:	00 
+  8031be:	e9 7a 01 00 00       	jmp    80333d <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  8031c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031c7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031cb:	48 c1 e8 27          	shr    $0x27,%rax
+  8031cf:	48 89 c2             	mov    %rax,%rdx
+  8031d2:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8031d9:	01 00 00 
+  8031dc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031e0:	83 e0 01             	and    $0x1,%eax
+  8031e3:	48 85 c0             	test   %rax,%rax
+  8031e6:	0f 84 4c 01 00 00    	je     803338 <fork_common+0x204>
+  8031ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031f0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8031f4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031f8:	48 89 c2             	mov    %rax,%rdx
+  8031fb:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803202:	01 00 00 
+  803205:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803209:	83 e0 01             	and    $0x1,%eax
+  80320c:	48 85 c0             	test   %rax,%rax
+  80320f:	0f 84 23 01 00 00    	je     803338 <fork_common+0x204>
+  803215:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803219:	48 c1 e0 0c          	shl    $0xc,%rax
+  80321d:	48 c1 e8 15          	shr    $0x15,%rax
+  803221:	48 89 c2             	mov    %rax,%rdx
+  803224:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80322b:	01 00 00 
+  80322e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803232:	83 e0 01             	and    $0x1,%eax
+  803235:	48 85 c0             	test   %rax,%rax
+  803238:	0f 84 fa 00 00 00    	je     803338 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  80323e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803242:	48 c1 e0 0c          	shl    $0xc,%rax
+  803246:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  80324a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80324e:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  803255:	00 00 00 
+  803258:	48 39 c2             	cmp    %rax,%rdx
+  80325b:	0f 82 d7 00 00 00    	jb     803338 <fork_common+0x204>
+  803261:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  803268:	00 00 00 
+  80326b:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  80326f:	0f 84 c3 00 00 00    	je     803338 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803275:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803279:	48 89 c7             	mov    %rax,%rdi
+  80327c:	48 b8 4d 59 80 00 00 	movabs $0x80594d,%rax
+  803283:	00 00 00 
+  803286:	ff d0                	call   *%rax
+  803288:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  80328b:	84 c0                	test   %al,%al
+  80328d:	0f 84 a5 00 00 00    	je     803338 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803293:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803297:	48 c1 e8 0c          	shr    $0xc,%rax
+  80329b:	48 89 c2             	mov    %rax,%rdx
+  80329e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8032a5:	01 00 00 
+  8032a8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032ac:	83 e0 01             	and    $0x1,%eax
+  8032af:	48 85 c0             	test   %rax,%rax
+  8032b2:	0f 84 80 00 00 00    	je     803338 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  8032b8:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  8032bc:	74 4a                	je     803308 <fork_common+0x1d4>
+  8032be:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032c2:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  8032c9:	00 00 00 
+  8032cc:	48 39 c2             	cmp    %rax,%rdx
+  8032cf:	73 13                	jae    8032e4 <fork_common+0x1b0>
+  8032d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032d5:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  8032dc:	00 00 00 
+  8032df:	48 39 c2             	cmp    %rax,%rdx
+  8032e2:	73 24                	jae    803308 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  8032e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032e8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8032ec:	48 89 c2             	mov    %rax,%rdx
+  8032ef:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032f2:	48 89 d6             	mov    %rdx,%rsi
+  8032f5:	89 c7                	mov    %eax,%edi
+  8032f7:	48 b8 b3 30 80 00 00 	movabs $0x8030b3,%rax
+  8032fe:	00 00 00 
+  803301:	ff d0                	call   *%rax
+  803303:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803306:	eb 22                	jmp    80332a <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  803308:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80330c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803310:	48 89 c2             	mov    %rax,%rdx
+  803313:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803316:	48 89 d6             	mov    %rdx,%rsi
+  803319:	89 c7                	mov    %eax,%edi
+  80331b:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  803322:	00 00 00 
+  803325:	ff d0                	call   *%rax
+  803327:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  80332a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80332e:	79 08                	jns    803338 <fork_common+0x204>
+            return r;
+  803330:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803333:	e9 51 01 00 00       	jmp    803489 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  803338:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80333d:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  803344:	07 
+  803345:	0f 86 78 fe ff ff    	jbe    8031c3 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  80334b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803352:	00 00 00 
+  803355:	8b 40 04             	mov    0x4(%rax),%eax
+  803358:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80335d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803364:	00 00 00 
+  803367:	48 98                	cltq
+  803369:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803370:	48 01 d0             	add    %rdx,%rax
+  803373:	48 05 00 01 00 00    	add    $0x100,%rax
+  803379:	48 8b 10             	mov    (%rax),%rdx
+  80337c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80337f:	48 89 d6             	mov    %rdx,%rsi
+  803382:	89 c7                	mov    %eax,%edi
+  803384:	48 b8 8f 27 80 00 00 	movabs $0x80278f,%rax
+  80338b:	00 00 00 
+  80338e:	ff d0                	call   *%rax
+  803390:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803393:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803397:	79 36                	jns    8033cf <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  803399:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80339c:	89 c1                	mov    %eax,%ecx
+  80339e:	48 b8 30 70 80 00 00 	movabs $0x807030,%rax
+  8033a5:	00 00 00 
+  8033a8:	48 89 c2             	mov    %rax,%rdx
+  8033ab:	be be 00 00 00       	mov    $0xbe,%esi
+  8033b0:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  8033b7:	00 00 00 
+  8033ba:	48 89 c7             	mov    %rax,%rdi
+  8033bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c2:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  8033c9:	00 00 00 
+  8033cc:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  8033cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033d2:	ba 02 00 00 00       	mov    $0x2,%edx
+  8033d7:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8033de:	00 00 00 
+  8033e1:	48 89 ce             	mov    %rcx,%rsi
+  8033e4:	89 c7                	mov    %eax,%edi
+  8033e6:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  8033ed:	00 00 00 
+  8033f0:	ff d0                	call   *%rax
+  8033f2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033f5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033f9:	79 36                	jns    803431 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  8033fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033fe:	89 c1                	mov    %eax,%ecx
+  803400:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  803407:	00 00 00 
+  80340a:	48 89 c2             	mov    %rax,%rdx
+  80340d:	be c1 00 00 00       	mov    $0xc1,%esi
+  803412:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  803419:	00 00 00 
+  80341c:	48 89 c7             	mov    %rax,%rdi
+  80341f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803424:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  80342b:	00 00 00 
+  80342e:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  803431:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803434:	be 02 00 00 00       	mov    $0x2,%esi
+  803439:	89 c7                	mov    %eax,%edi
+  80343b:	48 b8 f6 26 80 00 00 	movabs $0x8026f6,%rax
+  803442:	00 00 00 
+  803445:	ff d0                	call   *%rax
+  803447:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80344a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80344e:	79 36                	jns    803486 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  803450:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803453:	89 c1                	mov    %eax,%ecx
+  803455:	48 b8 80 70 80 00 00 	movabs $0x807080,%rax
+  80345c:	00 00 00 
+  80345f:	48 89 c2             	mov    %rax,%rdx
+  803462:	be d4 00 00 00       	mov    $0xd4,%esi
+  803467:	48 b8 66 6f 80 00 00 	movabs $0x806f66,%rax
+  80346e:	00 00 00 
+  803471:	48 89 c7             	mov    %rax,%rdi
+  803474:	b8 00 00 00 00       	mov    $0x0,%eax
+  803479:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  803480:	00 00 00 
+  803483:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803486:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803489:	c9                   	leave
+  80348a:	c3                   	ret
+
+000000000080348b <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  80348b:	55                   	push   %rbp
+  80348c:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  80348f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803494:	48 b8 34 31 80 00 00 	movabs $0x803134,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+}
+  8034a0:	5d                   	pop    %rbp
+  8034a1:	c3                   	ret
+
+00000000008034a2 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  8034a2:	55                   	push   %rbp
+  8034a3:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  8034a6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8034ab:	48 b8 34 31 80 00 00 	movabs $0x803134,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+}
+  8034b7:	5d                   	pop    %rbp
+  8034b8:	c3                   	ret
+
+00000000008034b9 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8034b9:	55                   	push   %rbp
+  8034ba:	48 89 e5             	mov    %rsp,%rbp
+  8034bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8034c1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8034c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034c9:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8034d0:	ff ff ff 
+  8034d3:	48 01 d0             	add    %rdx,%rax
+  8034d6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8034da:	c9                   	leave
+  8034db:	c3                   	ret
+
+00000000008034dc <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8034dc:	55                   	push   %rbp
+  8034dd:	48 89 e5             	mov    %rsp,%rbp
+  8034e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8034e4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8034e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034ec:	48 89 c7             	mov    %rax,%rdi
+  8034ef:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  8034f6:	00 00 00 
+  8034f9:	ff d0                	call   *%rax
+  8034fb:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803501:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  803505:	c9                   	leave
+  803506:	c3                   	ret
+
+0000000000803507 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803507:	55                   	push   %rbp
+  803508:	48 89 e5             	mov    %rsp,%rbp
+  80350b:	48 83 ec 18          	sub    $0x18,%rsp
+  80350f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  803513:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80351a:	e9 ae 00 00 00       	jmp    8035cd <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  80351f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803522:	c1 e0 0c             	shl    $0xc,%eax
+  803525:	48 98                	cltq
+  803527:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80352c:	48 01 d0             	add    %rdx,%rax
+  80352f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803533:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803537:	48 c1 e8 27          	shr    $0x27,%rax
+  80353b:	48 89 c2             	mov    %rax,%rdx
+  80353e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803545:	01 00 00 
+  803548:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80354c:	83 e0 01             	and    $0x1,%eax
+  80354f:	48 85 c0             	test   %rax,%rax
+  803552:	74 63                	je     8035b7 <fd_alloc+0xb0>
+  803554:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803558:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80355c:	48 89 c2             	mov    %rax,%rdx
+  80355f:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803566:	01 00 00 
+  803569:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80356d:	83 e0 01             	and    $0x1,%eax
+  803570:	48 85 c0             	test   %rax,%rax
+  803573:	74 42                	je     8035b7 <fd_alloc+0xb0>
+  803575:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803579:	48 c1 e8 15          	shr    $0x15,%rax
+  80357d:	48 89 c2             	mov    %rax,%rdx
+  803580:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803587:	01 00 00 
+  80358a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80358e:	83 e0 01             	and    $0x1,%eax
+  803591:	48 85 c0             	test   %rax,%rax
+  803594:	74 21                	je     8035b7 <fd_alloc+0xb0>
+  803596:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80359a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80359e:	48 89 c2             	mov    %rax,%rdx
+  8035a1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8035a8:	01 00 00 
+  8035ab:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035af:	83 e0 01             	and    $0x1,%eax
+  8035b2:	48 85 c0             	test   %rax,%rax
+  8035b5:	75 12                	jne    8035c9 <fd_alloc+0xc2>
+      *fd_store = fd;
+  8035b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035bb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8035bf:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8035c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c7:	eb 1e                	jmp    8035e7 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  8035c9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8035cd:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8035d1:	0f 8e 48 ff ff ff    	jle    80351f <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8035d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035db:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8035e2:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8035e7:	c9                   	leave
+  8035e8:	c3                   	ret
+
+00000000008035e9 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8035e9:	55                   	push   %rbp
+  8035ea:	48 89 e5             	mov    %rsp,%rbp
+  8035ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8035f1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035f4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8035f8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8035fc:	78 06                	js     803604 <fd_lookup+0x1b>
+  8035fe:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803602:	7e 0a                	jle    80360e <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803604:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803609:	e9 af 00 00 00       	jmp    8036bd <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80360e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803611:	c1 e0 0c             	shl    $0xc,%eax
+  803614:	48 98                	cltq
+  803616:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80361b:	48 01 d0             	add    %rdx,%rax
+  80361e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803622:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803626:	48 c1 e8 27          	shr    $0x27,%rax
+  80362a:	48 89 c2             	mov    %rax,%rdx
+  80362d:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803634:	01 00 00 
+  803637:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80363b:	83 e0 01             	and    $0x1,%eax
+  80363e:	48 85 c0             	test   %rax,%rax
+  803641:	74 63                	je     8036a6 <fd_lookup+0xbd>
+  803643:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803647:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80364b:	48 89 c2             	mov    %rax,%rdx
+  80364e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803655:	01 00 00 
+  803658:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80365c:	83 e0 01             	and    $0x1,%eax
+  80365f:	48 85 c0             	test   %rax,%rax
+  803662:	74 42                	je     8036a6 <fd_lookup+0xbd>
+  803664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803668:	48 c1 e8 15          	shr    $0x15,%rax
+  80366c:	48 89 c2             	mov    %rax,%rdx
+  80366f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803676:	01 00 00 
+  803679:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80367d:	83 e0 01             	and    $0x1,%eax
+  803680:	48 85 c0             	test   %rax,%rax
+  803683:	74 21                	je     8036a6 <fd_lookup+0xbd>
+  803685:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803689:	48 c1 e8 0c          	shr    $0xc,%rax
+  80368d:	48 89 c2             	mov    %rax,%rdx
+  803690:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803697:	01 00 00 
+  80369a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80369e:	83 e0 01             	and    $0x1,%eax
+  8036a1:	48 85 c0             	test   %rax,%rax
+  8036a4:	75 07                	jne    8036ad <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8036a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036ab:	eb 10                	jmp    8036bd <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8036ad:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8036b1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036b5:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8036b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036bd:	c9                   	leave
+  8036be:	c3                   	ret
+
+00000000008036bf <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8036bf:	55                   	push   %rbp
+  8036c0:	48 89 e5             	mov    %rsp,%rbp
+  8036c3:	48 83 ec 30          	sub    $0x30,%rsp
+  8036c7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8036cb:	89 f0                	mov    %esi,%eax
+  8036cd:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8036d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8036d4:	48 89 c7             	mov    %rax,%rdi
+  8036d7:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  8036de:	00 00 00 
+  8036e1:	ff d0                	call   *%rax
+  8036e3:	89 c2                	mov    %eax,%edx
+  8036e5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8036e9:	48 89 c6             	mov    %rax,%rsi
+  8036ec:	89 d7                	mov    %edx,%edi
+  8036ee:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  8036f5:	00 00 00 
+  8036f8:	ff d0                	call   *%rax
+  8036fa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036fd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803701:	78 0a                	js     80370d <fd_close+0x4e>
+  803703:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803707:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  80370b:	74 12                	je     80371f <fd_close+0x60>
+    return (must_exist ? r : 0);
+  80370d:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803711:	74 05                	je     803718 <fd_close+0x59>
+  803713:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803716:	eb 70                	jmp    803788 <fd_close+0xc9>
+  803718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80371d:	eb 69                	jmp    803788 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80371f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803723:	8b 00                	mov    (%rax),%eax
+  803725:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803729:	48 89 d6             	mov    %rdx,%rsi
+  80372c:	89 c7                	mov    %eax,%edi
+  80372e:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  803735:	00 00 00 
+  803738:	ff d0                	call   *%rax
+  80373a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80373d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803741:	78 2a                	js     80376d <fd_close+0xae>
+    if (dev->dev_close)
+  803743:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803747:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80374b:	48 85 c0             	test   %rax,%rax
+  80374e:	74 16                	je     803766 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803750:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803754:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803758:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80375c:	48 89 c7             	mov    %rax,%rdi
+  80375f:	ff d2                	call   *%rdx
+  803761:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803764:	eb 07                	jmp    80376d <fd_close+0xae>
+    else
+      r = 0;
+  803766:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80376d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803771:	48 89 c6             	mov    %rax,%rsi
+  803774:	bf 00 00 00 00       	mov    $0x0,%edi
+  803779:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  803780:	00 00 00 
+  803783:	ff d0                	call   *%rax
+  return r;
+  803785:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803788:	c9                   	leave
+  803789:	c3                   	ret
+
+000000000080378a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80378a:	55                   	push   %rbp
+  80378b:	48 89 e5             	mov    %rsp,%rbp
+  80378e:	48 83 ec 20          	sub    $0x20,%rsp
+  803792:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803795:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803799:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8037a0:	eb 3f                	jmp    8037e1 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8037a2:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8037a9:	00 00 00 
+  8037ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037af:	48 98                	cltq
+  8037b1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037b5:	8b 00                	mov    (%rax),%eax
+  8037b7:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8037ba:	75 21                	jne    8037dd <dev_lookup+0x53>
+      *dev = devtab[i];
+  8037bc:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8037c3:	00 00 00 
+  8037c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037c9:	48 98                	cltq
+  8037cb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8037cf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037d3:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8037d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037db:	eb 7f                	jmp    80385c <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8037dd:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8037e1:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8037e8:	00 00 00 
+  8037eb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037ee:	48 98                	cltq
+  8037f0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037f4:	48 85 c0             	test   %rax,%rax
+  8037f7:	75 a9                	jne    8037a2 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8037f9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803800:	00 00 00 
+  803803:	8b 40 04             	mov    0x4(%rax),%eax
+  803806:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80380b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803812:	00 00 00 
+  803815:	48 98                	cltq
+  803817:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80381e:	48 01 d0             	add    %rdx,%rax
+  803821:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803827:	8b 00                	mov    (%rax),%eax
+  803829:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80382c:	89 c6                	mov    %eax,%esi
+  80382e:	48 b8 a8 70 80 00 00 	movabs $0x8070a8,%rax
+  803835:	00 00 00 
+  803838:	48 89 c7             	mov    %rax,%rdi
+  80383b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803840:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  803847:	00 00 00 
+  80384a:	ff d1                	call   *%rcx
+  *dev = 0;
+  80384c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803850:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803857:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80385c:	c9                   	leave
+  80385d:	c3                   	ret
+
+000000000080385e <close>:
+
+int
+close(int fdnum) {
+  80385e:	55                   	push   %rbp
+  80385f:	48 89 e5             	mov    %rsp,%rbp
+  803862:	48 83 ec 20          	sub    $0x20,%rsp
+  803866:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803869:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80386d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803870:	48 89 d6             	mov    %rdx,%rsi
+  803873:	89 c7                	mov    %eax,%edi
+  803875:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  80387c:	00 00 00 
+  80387f:	ff d0                	call   *%rax
+  803881:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803884:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803888:	79 05                	jns    80388f <close+0x31>
+    return r;
+  80388a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80388d:	eb 18                	jmp    8038a7 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80388f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803893:	be 01 00 00 00       	mov    $0x1,%esi
+  803898:	48 89 c7             	mov    %rax,%rdi
+  80389b:	48 b8 bf 36 80 00 00 	movabs $0x8036bf,%rax
+  8038a2:	00 00 00 
+  8038a5:	ff d0                	call   *%rax
+}
+  8038a7:	c9                   	leave
+  8038a8:	c3                   	ret
+
+00000000008038a9 <close_all>:
+
+void
+close_all(void) {
+  8038a9:	55                   	push   %rbp
+  8038aa:	48 89 e5             	mov    %rsp,%rbp
+  8038ad:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8038b1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8038b8:	eb 15                	jmp    8038cf <close_all+0x26>
+    close(i);
+  8038ba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038bd:	89 c7                	mov    %eax,%edi
+  8038bf:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  8038c6:	00 00 00 
+  8038c9:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  8038cb:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8038cf:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8038d3:	7e e5                	jle    8038ba <close_all+0x11>
+}
+  8038d5:	90                   	nop
+  8038d6:	90                   	nop
+  8038d7:	c9                   	leave
+  8038d8:	c3                   	ret
+
+00000000008038d9 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  8038d9:	55                   	push   %rbp
+  8038da:	48 89 e5             	mov    %rsp,%rbp
+  8038dd:	48 83 ec 40          	sub    $0x40,%rsp
+  8038e1:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8038e4:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8038e7:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8038eb:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8038ee:	48 89 d6             	mov    %rdx,%rsi
+  8038f1:	89 c7                	mov    %eax,%edi
+  8038f3:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  8038fa:	00 00 00 
+  8038fd:	ff d0                	call   *%rax
+  8038ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803902:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803906:	79 08                	jns    803910 <dup+0x37>
+    return r;
+  803908:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80390b:	e9 33 02 00 00       	jmp    803b43 <dup+0x26a>
+  close(newfdnum);
+  803910:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803913:	89 c7                	mov    %eax,%edi
+  803915:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  80391c:	00 00 00 
+  80391f:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803921:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803924:	c1 e0 0c             	shl    $0xc,%eax
+  803927:	48 98                	cltq
+  803929:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80392e:	48 01 d0             	add    %rdx,%rax
+  803931:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803935:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803939:	48 89 c7             	mov    %rax,%rdi
+  80393c:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  803943:	00 00 00 
+  803946:	ff d0                	call   *%rax
+  803948:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  80394c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803950:	48 89 c7             	mov    %rax,%rdi
+  803953:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  80395a:	00 00 00 
+  80395d:	ff d0                	call   *%rax
+  80395f:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803963:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  80396a:	00 
+  80396b:	e9 19 01 00 00       	jmp    803a89 <dup+0x1b0>
+    off -= PGSIZE;
+  803970:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803977:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803978:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80397c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803980:	48 01 d0             	add    %rdx,%rax
+  803983:	48 c1 e8 27          	shr    $0x27,%rax
+  803987:	48 89 c2             	mov    %rax,%rdx
+  80398a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803991:	01 00 00 
+  803994:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803998:	83 e0 01             	and    $0x1,%eax
+  80399b:	48 85 c0             	test   %rax,%rax
+  80399e:	0f 84 e5 00 00 00    	je     803a89 <dup+0x1b0>
+  8039a4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8039a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039ac:	48 01 d0             	add    %rdx,%rax
+  8039af:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039b3:	48 89 c2             	mov    %rax,%rdx
+  8039b6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8039bd:	01 00 00 
+  8039c0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039c4:	83 e0 01             	and    $0x1,%eax
+  8039c7:	48 85 c0             	test   %rax,%rax
+  8039ca:	0f 84 b9 00 00 00    	je     803a89 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8039d0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8039d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039d8:	48 01 d0             	add    %rdx,%rax
+  8039db:	48 c1 e8 15          	shr    $0x15,%rax
+  8039df:	48 89 c2             	mov    %rax,%rdx
+  8039e2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8039e9:	01 00 00 
+  8039ec:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039f0:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8039f3:	48 85 c0             	test   %rax,%rax
+  8039f6:	0f 84 8d 00 00 00    	je     803a89 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8039fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a04:	48 01 d0             	add    %rdx,%rax
+  803a07:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a0b:	48 89 c2             	mov    %rax,%rdx
+  803a0e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803a15:	01 00 00 
+  803a18:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a1c:	83 e0 01             	and    $0x1,%eax
+  803a1f:	48 85 c0             	test   %rax,%rax
+  803a22:	74 65                	je     803a89 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803a24:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a2c:	48 01 d0             	add    %rdx,%rax
+  803a2f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a33:	48 89 c2             	mov    %rax,%rdx
+  803a36:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803a3d:	01 00 00 
+  803a40:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a44:	25 07 0e 00 00       	and    $0xe07,%eax
+  803a49:	89 c6                	mov    %eax,%esi
+  803a4b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a53:	48 01 c2             	add    %rax,%rdx
+  803a56:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803a5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a5e:	48 01 c8             	add    %rcx,%rax
+  803a61:	41 89 f0             	mov    %esi,%r8d
+  803a64:	48 89 d1             	mov    %rdx,%rcx
+  803a67:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a6c:	48 89 c6             	mov    %rax,%rsi
+  803a6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a74:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  803a7b:	00 00 00 
+  803a7e:	ff d0                	call   *%rax
+  803a80:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a83:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a87:	78 60                	js     803ae9 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803a89:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803a8e:	0f 85 dc fe ff ff    	jne    803970 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803a94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a98:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a9c:	48 89 c2             	mov    %rax,%rdx
+  803a9f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803aa6:	01 00 00 
+  803aa9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803aad:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ab2:	89 c1                	mov    %eax,%ecx
+  803ab4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ab8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803abc:	41 89 c8             	mov    %ecx,%r8d
+  803abf:	48 89 d1             	mov    %rdx,%rcx
+  803ac2:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ac7:	48 89 c6             	mov    %rax,%rsi
+  803aca:	bf 00 00 00 00       	mov    $0x0,%edi
+  803acf:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  803ad6:	00 00 00 
+  803ad9:	ff d0                	call   *%rax
+  803adb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ade:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ae2:	78 08                	js     803aec <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803ae4:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803ae7:	eb 5a                	jmp    803b43 <dup+0x26a>
+        goto err;
+  803ae9:	90                   	nop
+  803aea:	eb 01                	jmp    803aed <dup+0x214>
+    goto err;
+  803aec:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803aed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803af1:	48 89 c6             	mov    %rax,%rsi
+  803af4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af9:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  803b00:	00 00 00 
+  803b03:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803b05:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803b0c:	00 
+  803b0d:	eb 27                	jmp    803b36 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803b0f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b17:	48 01 d0             	add    %rdx,%rax
+  803b1a:	48 89 c6             	mov    %rax,%rsi
+  803b1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b22:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803b2e:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803b35:	00 
+  803b36:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803b3d:	00 
+  803b3e:	76 cf                	jbe    803b0f <dup+0x236>
+  return r;
+  803b40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803b43:	c9                   	leave
+  803b44:	c3                   	ret
+
+0000000000803b45 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803b45:	55                   	push   %rbp
+  803b46:	48 89 e5             	mov    %rsp,%rbp
+  803b49:	48 83 ec 40          	sub    $0x40,%rsp
+  803b4d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803b50:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803b54:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b58:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803b5c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b5f:	48 89 d6             	mov    %rdx,%rsi
+  803b62:	89 c7                	mov    %eax,%edi
+  803b64:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803b6b:	00 00 00 
+  803b6e:	ff d0                	call   *%rax
+  803b70:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b73:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b77:	78 24                	js     803b9d <read+0x58>
+  803b79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b7d:	8b 00                	mov    (%rax),%eax
+  803b7f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b83:	48 89 d6             	mov    %rdx,%rsi
+  803b86:	89 c7                	mov    %eax,%edi
+  803b88:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  803b8f:	00 00 00 
+  803b92:	ff d0                	call   *%rax
+  803b94:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b97:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b9b:	79 0a                	jns    803ba7 <read+0x62>
+    return r;
+  803b9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ba0:	48 98                	cltq
+  803ba2:	e9 9e 00 00 00       	jmp    803c45 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803ba7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bab:	8b 40 08             	mov    0x8(%rax),%eax
+  803bae:	83 e0 03             	and    $0x3,%eax
+  803bb1:	83 f8 01             	cmp    $0x1,%eax
+  803bb4:	75 5c                	jne    803c12 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803bb6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803bbd:	00 00 00 
+  803bc0:	8b 40 04             	mov    0x4(%rax),%eax
+  803bc3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803bc8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803bcf:	00 00 00 
+  803bd2:	48 98                	cltq
+  803bd4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803bdb:	48 01 d0             	add    %rdx,%rax
+  803bde:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803be4:	8b 00                	mov    (%rax),%eax
+  803be6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803be9:	89 c6                	mov    %eax,%esi
+  803beb:	48 b8 c7 70 80 00 00 	movabs $0x8070c7,%rax
+  803bf2:	00 00 00 
+  803bf5:	48 89 c7             	mov    %rax,%rdi
+  803bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bfd:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  803c04:	00 00 00 
+  803c07:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803c09:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803c10:	eb 33                	jmp    803c45 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803c12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c16:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803c1a:	48 85 c0             	test   %rax,%rax
+  803c1d:	75 09                	jne    803c28 <read+0xe3>
+    return -E_NOT_SUPP;
+  803c1f:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803c26:	eb 1d                	jmp    803c45 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803c28:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c2c:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803c30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c34:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803c38:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803c3c:	48 89 ce             	mov    %rcx,%rsi
+  803c3f:	48 89 c7             	mov    %rax,%rdi
+  803c42:	41 ff d0             	call   *%r8
+}
+  803c45:	c9                   	leave
+  803c46:	c3                   	ret
+
+0000000000803c47 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803c47:	55                   	push   %rbp
+  803c48:	48 89 e5             	mov    %rsp,%rbp
+  803c4b:	48 83 ec 30          	sub    $0x30,%rsp
+  803c4f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803c52:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803c56:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803c5a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803c61:	eb 49                	jmp    803cac <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803c63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c66:	48 98                	cltq
+  803c68:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c6c:	48 29 c2             	sub    %rax,%rdx
+  803c6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c72:	48 63 c8             	movslq %eax,%rcx
+  803c75:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803c79:	48 01 c1             	add    %rax,%rcx
+  803c7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c7f:	48 89 ce             	mov    %rcx,%rsi
+  803c82:	89 c7                	mov    %eax,%edi
+  803c84:	48 b8 45 3b 80 00 00 	movabs $0x803b45,%rax
+  803c8b:	00 00 00 
+  803c8e:	ff d0                	call   *%rax
+  803c90:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803c93:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803c97:	79 07                	jns    803ca0 <readn+0x59>
+      return m;
+  803c99:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803c9c:	48 98                	cltq
+  803c9e:	eb 1f                	jmp    803cbf <readn+0x78>
+    if (m == 0)
+  803ca0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803ca4:	74 13                	je     803cb9 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803ca6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803ca9:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803cac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803caf:	48 98                	cltq
+  803cb1:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803cb5:	72 ac                	jb     803c63 <readn+0x1c>
+  803cb7:	eb 01                	jmp    803cba <readn+0x73>
+      break;
+  803cb9:	90                   	nop
+  }
+  return tot;
+  803cba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cbd:	48 98                	cltq
+}
+  803cbf:	c9                   	leave
+  803cc0:	c3                   	ret
+
+0000000000803cc1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803cc1:	55                   	push   %rbp
+  803cc2:	48 89 e5             	mov    %rsp,%rbp
+  803cc5:	48 83 ec 40          	sub    $0x40,%rsp
+  803cc9:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ccc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803cd0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803cd4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803cd8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cdb:	48 89 d6             	mov    %rdx,%rsi
+  803cde:	89 c7                	mov    %eax,%edi
+  803ce0:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803ce7:	00 00 00 
+  803cea:	ff d0                	call   *%rax
+  803cec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cf3:	78 24                	js     803d19 <write+0x58>
+  803cf5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cf9:	8b 00                	mov    (%rax),%eax
+  803cfb:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803cff:	48 89 d6             	mov    %rdx,%rsi
+  803d02:	89 c7                	mov    %eax,%edi
+  803d04:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  803d0b:	00 00 00 
+  803d0e:	ff d0                	call   *%rax
+  803d10:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d13:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d17:	79 0a                	jns    803d23 <write+0x62>
+    return r;
+  803d19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d1c:	48 98                	cltq
+  803d1e:	e9 9d 00 00 00       	jmp    803dc0 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803d23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d27:	8b 40 08             	mov    0x8(%rax),%eax
+  803d2a:	83 e0 03             	and    $0x3,%eax
+  803d2d:	85 c0                	test   %eax,%eax
+  803d2f:	75 5c                	jne    803d8d <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803d31:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803d38:	00 00 00 
+  803d3b:	8b 40 04             	mov    0x4(%rax),%eax
+  803d3e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803d43:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803d4a:	00 00 00 
+  803d4d:	48 98                	cltq
+  803d4f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803d56:	48 01 d0             	add    %rdx,%rax
+  803d59:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803d5f:	8b 00                	mov    (%rax),%eax
+  803d61:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803d64:	89 c6                	mov    %eax,%esi
+  803d66:	48 b8 e3 70 80 00 00 	movabs $0x8070e3,%rax
+  803d6d:	00 00 00 
+  803d70:	48 89 c7             	mov    %rax,%rdi
+  803d73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d78:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  803d7f:	00 00 00 
+  803d82:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803d84:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803d8b:	eb 33                	jmp    803dc0 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803d8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d91:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803d95:	48 85 c0             	test   %rax,%rax
+  803d98:	75 09                	jne    803da3 <write+0xe2>
+    return -E_NOT_SUPP;
+  803d9a:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803da1:	eb 1d                	jmp    803dc0 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803da3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803da7:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803dab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803daf:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803db3:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803db7:	48 89 ce             	mov    %rcx,%rsi
+  803dba:	48 89 c7             	mov    %rax,%rdi
+  803dbd:	41 ff d0             	call   *%r8
+}
+  803dc0:	c9                   	leave
+  803dc1:	c3                   	ret
+
+0000000000803dc2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803dc2:	55                   	push   %rbp
+  803dc3:	48 89 e5             	mov    %rsp,%rbp
+  803dc6:	48 83 ec 18          	sub    $0x18,%rsp
+  803dca:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803dcd:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803dd0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803dd4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dd7:	48 89 d6             	mov    %rdx,%rsi
+  803dda:	89 c7                	mov    %eax,%edi
+  803ddc:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803de3:	00 00 00 
+  803de6:	ff d0                	call   *%rax
+  803de8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803deb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803def:	79 05                	jns    803df6 <seek+0x34>
+    return r;
+  803df1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803df4:	eb 0f                	jmp    803e05 <seek+0x43>
+  fd->fd_offset = offset;
+  803df6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dfa:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803dfd:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803e00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e05:	c9                   	leave
+  803e06:	c3                   	ret
+
+0000000000803e07 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803e07:	55                   	push   %rbp
+  803e08:	48 89 e5             	mov    %rsp,%rbp
+  803e0b:	48 83 ec 30          	sub    $0x30,%rsp
+  803e0f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e12:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803e15:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803e19:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e1c:	48 89 d6             	mov    %rdx,%rsi
+  803e1f:	89 c7                	mov    %eax,%edi
+  803e21:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803e28:	00 00 00 
+  803e2b:	ff d0                	call   *%rax
+  803e2d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e30:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e34:	78 24                	js     803e5a <ftruncate+0x53>
+  803e36:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e3a:	8b 00                	mov    (%rax),%eax
+  803e3c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803e40:	48 89 d6             	mov    %rdx,%rsi
+  803e43:	89 c7                	mov    %eax,%edi
+  803e45:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  803e4c:	00 00 00 
+  803e4f:	ff d0                	call   *%rax
+  803e51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e58:	79 08                	jns    803e62 <ftruncate+0x5b>
+    return r;
+  803e5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e5d:	e9 92 00 00 00       	jmp    803ef4 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803e62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e66:	8b 40 08             	mov    0x8(%rax),%eax
+  803e69:	83 e0 03             	and    $0x3,%eax
+  803e6c:	85 c0                	test   %eax,%eax
+  803e6e:	75 5a                	jne    803eca <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803e70:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803e77:	00 00 00 
+  803e7a:	8b 40 04             	mov    0x4(%rax),%eax
+  803e7d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e82:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803e89:	00 00 00 
+  803e8c:	48 98                	cltq
+  803e8e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803e95:	48 01 d0             	add    %rdx,%rax
+  803e98:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803e9e:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803ea0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803ea3:	89 c6                	mov    %eax,%esi
+  803ea5:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  803eac:	00 00 00 
+  803eaf:	48 89 c7             	mov    %rax,%rdi
+  803eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb7:	48 b9 74 08 80 00 00 	movabs $0x800874,%rcx
+  803ebe:	00 00 00 
+  803ec1:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803ec3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ec8:	eb 2a                	jmp    803ef4 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803eca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ece:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803ed2:	48 85 c0             	test   %rax,%rax
+  803ed5:	75 07                	jne    803ede <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803ed7:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803edc:	eb 16                	jmp    803ef4 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803ede:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ee2:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803ee6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eea:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803eed:	89 d6                	mov    %edx,%esi
+  803eef:	48 89 c7             	mov    %rax,%rdi
+  803ef2:	ff d1                	call   *%rcx
+}
+  803ef4:	c9                   	leave
+  803ef5:	c3                   	ret
+
+0000000000803ef6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803ef6:	55                   	push   %rbp
+  803ef7:	48 89 e5             	mov    %rsp,%rbp
+  803efa:	48 83 ec 30          	sub    $0x30,%rsp
+  803efe:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803f01:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f05:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803f09:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f0c:	48 89 d6             	mov    %rdx,%rsi
+  803f0f:	89 c7                	mov    %eax,%edi
+  803f11:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  803f18:	00 00 00 
+  803f1b:	ff d0                	call   *%rax
+  803f1d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f20:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f24:	78 24                	js     803f4a <fstat+0x54>
+  803f26:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f2a:	8b 00                	mov    (%rax),%eax
+  803f2c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803f30:	48 89 d6             	mov    %rdx,%rsi
+  803f33:	89 c7                	mov    %eax,%edi
+  803f35:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  803f3c:	00 00 00 
+  803f3f:	ff d0                	call   *%rax
+  803f41:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f44:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f48:	79 05                	jns    803f4f <fstat+0x59>
+    return r;
+  803f4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f4d:	eb 5e                	jmp    803fad <fstat+0xb7>
+  if (!dev->dev_stat)
+  803f4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f53:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803f57:	48 85 c0             	test   %rax,%rax
+  803f5a:	75 07                	jne    803f63 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803f5c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803f61:	eb 4a                	jmp    803fad <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803f63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f67:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803f6a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f6e:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803f75:	00 00 00 
+  stat->st_isdir   = 0;
+  803f78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f7c:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803f83:	00 00 00 
+  stat->st_dev     = dev;
+  803f86:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f8a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f8e:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803f95:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f99:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803f9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fa1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803fa5:	48 89 d6             	mov    %rdx,%rsi
+  803fa8:	48 89 c7             	mov    %rax,%rdi
+  803fab:	ff d1                	call   *%rcx
+}
+  803fad:	c9                   	leave
+  803fae:	c3                   	ret
+
+0000000000803faf <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803faf:	55                   	push   %rbp
+  803fb0:	48 89 e5             	mov    %rsp,%rbp
+  803fb3:	48 83 ec 10          	sub    $0x10,%rsp
+  803fb7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803fbb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803fbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fc3:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803fc9:	83 f8 20             	cmp    $0x20,%eax
+  803fcc:	75 07                	jne    803fd5 <pollwait_key+0x26>
+    return -E_INVAL;
+  803fce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fd3:	eb 5f                	jmp    804034 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803fd5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fd9:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803fdf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fe3:	48 63 d2             	movslq %edx,%rdx
+  803fe6:	48 c1 e2 04          	shl    $0x4,%rdx
+  803fea:	48 01 c2             	add    %rax,%rdx
+  803fed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ff1:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803ff4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ff8:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803ffe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804002:	8b 00                	mov    (%rax),%eax
+  804004:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804008:	48 63 c9             	movslq %ecx,%rcx
+  80400b:	48 c1 e1 04          	shl    $0x4,%rcx
+  80400f:	48 01 ca             	add    %rcx,%rdx
+  804012:	48 83 c2 08          	add    $0x8,%rdx
+  804016:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  804018:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80401c:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804022:	8d 50 01             	lea    0x1(%rax),%edx
+  804025:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804029:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80402f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804034:	c9                   	leave
+  804035:	c3                   	ret
+
+0000000000804036 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  804036:	55                   	push   %rbp
+  804037:	48 89 e5             	mov    %rsp,%rbp
+  80403a:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  804041:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  804048:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80404e:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  804055:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80405c:	00 
+  int i, r, ready, ipc = 0;
+  80405d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  804064:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  80406b:	00 
+  80406c:	74 45                	je     8040b3 <poll+0x7d>
+  80406e:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  804075:	ff 
+  804076:	74 3b                	je     8040b3 <poll+0x7d>
+    now      = vsys_clock_ns();
+  804078:	48 b8 52 5a 80 00 00 	movabs $0x805a52,%rax
+  80407f:	00 00 00 
+  804082:	ff d0                	call   *%rax
+  804084:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  804088:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80408c:	48 f7 d0             	not    %rax
+  80408f:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  804096:	73 10                	jae    8040a8 <poll+0x72>
+  804098:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80409c:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8040a3:	48 01 d0             	add    %rdx,%rax
+  8040a6:	eb 07                	jmp    8040af <poll+0x79>
+  8040a8:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8040af:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8040b3:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8040ba:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8040c1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8040c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8040cf:	e9 46 02 00 00       	jmp    80431a <poll+0x2e4>
+      fds[i].revents = 0;
+  8040d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040d7:	48 63 d0             	movslq %eax,%rdx
+  8040da:	48 89 d0             	mov    %rdx,%rax
+  8040dd:	48 01 c0             	add    %rax,%rax
+  8040e0:	48 01 d0             	add    %rdx,%rax
+  8040e3:	48 c1 e0 02          	shl    $0x2,%rax
+  8040e7:	48 89 c2             	mov    %rax,%rdx
+  8040ea:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040f1:	48 01 d0             	add    %rdx,%rax
+  8040f4:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8040fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040fe:	48 63 d0             	movslq %eax,%rdx
+  804101:	48 89 d0             	mov    %rdx,%rax
+  804104:	48 01 c0             	add    %rax,%rax
+  804107:	48 01 d0             	add    %rdx,%rax
+  80410a:	48 c1 e0 02          	shl    $0x2,%rax
+  80410e:	48 89 c2             	mov    %rax,%rdx
+  804111:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804118:	48 01 d0             	add    %rdx,%rax
+  80411b:	8b 00                	mov    (%rax),%eax
+  80411d:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  804120:	75 62                	jne    804184 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  804122:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804125:	48 63 d0             	movslq %eax,%rdx
+  804128:	48 89 d0             	mov    %rdx,%rax
+  80412b:	48 01 c0             	add    %rax,%rax
+  80412e:	48 01 d0             	add    %rdx,%rax
+  804131:	48 c1 e0 02          	shl    $0x2,%rax
+  804135:	48 89 c2             	mov    %rax,%rdx
+  804138:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80413f:	48 01 d0             	add    %rdx,%rax
+  804142:	8b 40 04             	mov    0x4(%rax),%eax
+  804145:	83 e0 01             	and    $0x1,%eax
+  804148:	85 c0                	test   %eax,%eax
+  80414a:	0f 84 9b 01 00 00    	je     8042eb <poll+0x2b5>
+          fds[i].revents = ipc;
+  804150:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804153:	48 63 d0             	movslq %eax,%rdx
+  804156:	48 89 d0             	mov    %rdx,%rax
+  804159:	48 01 c0             	add    %rax,%rax
+  80415c:	48 01 d0             	add    %rdx,%rax
+  80415f:	48 c1 e0 02          	shl    $0x2,%rax
+  804163:	48 89 c2             	mov    %rax,%rdx
+  804166:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80416d:	48 01 c2             	add    %rax,%rdx
+  804170:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804173:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  804176:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804179:	83 c8 04             	or     $0x4,%eax
+  80417c:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80417f:	e9 67 01 00 00       	jmp    8042eb <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804184:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804187:	48 63 d0             	movslq %eax,%rdx
+  80418a:	48 89 d0             	mov    %rdx,%rax
+  80418d:	48 01 c0             	add    %rax,%rax
+  804190:	48 01 d0             	add    %rdx,%rax
+  804193:	48 c1 e0 02          	shl    $0x2,%rax
+  804197:	48 89 c2             	mov    %rax,%rdx
+  80419a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8041a1:	48 01 d0             	add    %rdx,%rax
+  8041a4:	8b 00                	mov    (%rax),%eax
+  8041a6:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8041ad:	48 89 d6             	mov    %rdx,%rsi
+  8041b0:	89 c7                	mov    %eax,%edi
+  8041b2:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  8041b9:	00 00 00 
+  8041bc:	ff d0                	call   *%rax
+  8041be:	85 c0                	test   %eax,%eax
+  8041c0:	78 25                	js     8041e7 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8041c2:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8041c9:	8b 00                	mov    (%rax),%eax
+  8041cb:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8041d2:	48 89 d6             	mov    %rdx,%rsi
+  8041d5:	89 c7                	mov    %eax,%edi
+  8041d7:	48 b8 8a 37 80 00 00 	movabs $0x80378a,%rax
+  8041de:	00 00 00 
+  8041e1:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8041e3:	85 c0                	test   %eax,%eax
+  8041e5:	79 2c                	jns    804213 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8041e7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041ea:	48 63 d0             	movslq %eax,%rdx
+  8041ed:	48 89 d0             	mov    %rdx,%rax
+  8041f0:	48 01 c0             	add    %rax,%rax
+  8041f3:	48 01 d0             	add    %rdx,%rax
+  8041f6:	48 c1 e0 02          	shl    $0x2,%rax
+  8041fa:	48 89 c2             	mov    %rax,%rdx
+  8041fd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804204:	48 01 d0             	add    %rdx,%rax
+  804207:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80420e:	e9 d8 00 00 00       	jmp    8042eb <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  804213:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80421a:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80421e:	48 85 c0             	test   %rax,%rax
+  804221:	74 7d                	je     8042a0 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  804223:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80422a:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80422e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804231:	48 63 d0             	movslq %eax,%rdx
+  804234:	48 89 d0             	mov    %rdx,%rax
+  804237:	48 01 c0             	add    %rax,%rax
+  80423a:	48 01 d0             	add    %rdx,%rax
+  80423d:	48 c1 e0 02          	shl    $0x2,%rax
+  804241:	48 89 c2             	mov    %rax,%rdx
+  804244:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80424b:	48 01 d0             	add    %rdx,%rax
+  80424e:	8b 48 04             	mov    0x4(%rax),%ecx
+  804251:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804258:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80425f:	89 ce                	mov    %ecx,%esi
+  804261:	48 89 c7             	mov    %rax,%rdi
+  804264:	41 ff d0             	call   *%r8
+  804267:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80426a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80426e:	79 08                	jns    804278 <poll+0x242>
+          return r;
+  804270:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804273:	e9 45 01 00 00       	jmp    8043bd <poll+0x387>
+        fds[i].revents = r;
+  804278:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80427b:	48 63 d0             	movslq %eax,%rdx
+  80427e:	48 89 d0             	mov    %rdx,%rax
+  804281:	48 01 c0             	add    %rax,%rax
+  804284:	48 01 d0             	add    %rdx,%rax
+  804287:	48 c1 e0 02          	shl    $0x2,%rax
+  80428b:	48 89 c2             	mov    %rax,%rdx
+  80428e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804295:	48 01 c2             	add    %rax,%rdx
+  804298:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80429b:	89 42 08             	mov    %eax,0x8(%rdx)
+  80429e:	eb 4b                	jmp    8042eb <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8042a0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042a3:	48 63 d0             	movslq %eax,%rdx
+  8042a6:	48 89 d0             	mov    %rdx,%rax
+  8042a9:	48 01 c0             	add    %rax,%rax
+  8042ac:	48 01 d0             	add    %rdx,%rax
+  8042af:	48 c1 e0 02          	shl    $0x2,%rax
+  8042b3:	48 89 c2             	mov    %rax,%rdx
+  8042b6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8042bd:	48 01 d0             	add    %rdx,%rax
+  8042c0:	8b 48 04             	mov    0x4(%rax),%ecx
+  8042c3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042c6:	48 63 d0             	movslq %eax,%rdx
+  8042c9:	48 89 d0             	mov    %rdx,%rax
+  8042cc:	48 01 c0             	add    %rax,%rax
+  8042cf:	48 01 d0             	add    %rdx,%rax
+  8042d2:	48 c1 e0 02          	shl    $0x2,%rax
+  8042d6:	48 89 c2             	mov    %rax,%rdx
+  8042d9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8042e0:	48 01 d0             	add    %rdx,%rax
+  8042e3:	83 e1 03             	and    $0x3,%ecx
+  8042e6:	89 ca                	mov    %ecx,%edx
+  8042e8:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  8042eb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042ee:	48 63 d0             	movslq %eax,%rdx
+  8042f1:	48 89 d0             	mov    %rdx,%rax
+  8042f4:	48 01 c0             	add    %rax,%rax
+  8042f7:	48 01 d0             	add    %rdx,%rax
+  8042fa:	48 c1 e0 02          	shl    $0x2,%rax
+  8042fe:	48 89 c2             	mov    %rax,%rdx
+  804301:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804308:	48 01 d0             	add    %rdx,%rax
+  80430b:	8b 40 08             	mov    0x8(%rax),%eax
+  80430e:	85 c0                	test   %eax,%eax
+  804310:	74 04                	je     804316 <poll+0x2e0>
+        ready++;
+  804312:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804316:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80431a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80431d:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  804323:	0f 8c ab fd ff ff    	jl     8040d4 <poll+0x9e>
+    }
+    if (ready)
+  804329:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80432d:	74 08                	je     804337 <poll+0x301>
+      return ready;
+  80432f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804332:	e9 86 00 00 00       	jmp    8043bd <poll+0x387>
+
+    if (deadline) {
+  804337:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80433c:	74 30                	je     80436e <poll+0x338>
+      now     = vsys_clock_ns();
+  80433e:	48 b8 52 5a 80 00 00 	movabs $0x805a52,%rax
+  804345:	00 00 00 
+  804348:	ff d0                	call   *%rax
+  80434a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80434e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804352:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804356:	73 0a                	jae    804362 <poll+0x32c>
+  804358:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80435c:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  804360:	eb 05                	jmp    804367 <poll+0x331>
+  804362:	b8 00 00 00 00       	mov    $0x0,%eax
+  804367:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80436e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804371:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804374:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  80437b:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804382:	48 89 c7             	mov    %rax,%rdi
+  804385:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  80438c:	00 00 00 
+  80438f:	ff d0                	call   *%rax
+  804391:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  804394:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  804398:	75 07                	jne    8043a1 <poll+0x36b>
+      return 0;
+  80439a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439f:	eb 1c                	jmp    8043bd <poll+0x387>
+    if (r < 0)
+  8043a1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8043a5:	79 05                	jns    8043ac <poll+0x376>
+      return r;
+  8043a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043aa:	eb 11                	jmp    8043bd <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8043ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043af:	c1 f8 02             	sar    $0x2,%eax
+  8043b2:	83 e0 01             	and    $0x1,%eax
+  8043b5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8043b8:	e9 f6 fc ff ff       	jmp    8040b3 <poll+0x7d>
+  }
+}
+  8043bd:	c9                   	leave
+  8043be:	c3                   	ret
+
+00000000008043bf <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8043bf:	55                   	push   %rbp
+  8043c0:	48 89 e5             	mov    %rsp,%rbp
+  8043c3:	48 83 ec 20          	sub    $0x20,%rsp
+  8043c7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8043cb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8043cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8043d8:	48 89 c7             	mov    %rax,%rdi
+  8043db:	48 b8 ad 44 80 00 00 	movabs $0x8044ad,%rax
+  8043e2:	00 00 00 
+  8043e5:	ff d0                	call   *%rax
+  8043e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8043ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8043ee:	79 05                	jns    8043f5 <stat+0x36>
+    return fd;
+  8043f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043f3:	eb 2f                	jmp    804424 <stat+0x65>
+  r = fstat(fd, stat);
+  8043f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8043f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043fc:	48 89 d6             	mov    %rdx,%rsi
+  8043ff:	89 c7                	mov    %eax,%edi
+  804401:	48 b8 f6 3e 80 00 00 	movabs $0x803ef6,%rax
+  804408:	00 00 00 
+  80440b:	ff d0                	call   *%rax
+  80440d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804410:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804413:	89 c7                	mov    %eax,%edi
+  804415:	48 b8 5e 38 80 00 00 	movabs $0x80385e,%rax
+  80441c:	00 00 00 
+  80441f:	ff d0                	call   *%rax
+  return r;
+  804421:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804424:	c9                   	leave
+  804425:	c3                   	ret
+
+0000000000804426 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  804426:	55                   	push   %rbp
+  804427:	48 89 e5             	mov    %rsp,%rbp
+  80442a:	48 83 ec 10          	sub    $0x10,%rsp
+  80442e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804431:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  804435:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  80443c:	00 00 00 
+  80443f:	8b 00                	mov    (%rax),%eax
+  804441:	85 c0                	test   %eax,%eax
+  804443:	75 1d                	jne    804462 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  804445:	bf 03 00 00 00       	mov    $0x3,%edi
+  80444a:	48 b8 d3 61 80 00 00 	movabs $0x8061d3,%rax
+  804451:	00 00 00 
+  804454:	ff d0                	call   *%rax
+  804456:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  80445d:	00 00 00 
+  804460:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804462:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804469:	00 00 00 
+  80446c:	8b 00                	mov    (%rax),%eax
+  80446e:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  804471:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804476:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80447d:	00 00 00 
+  804480:	89 c7                	mov    %eax,%edi
+  804482:	48 b8 26 61 80 00 00 	movabs $0x806126,%rax
+  804489:	00 00 00 
+  80448c:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80448e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804492:	ba 00 00 00 00       	mov    $0x0,%edx
+  804497:	48 89 c6             	mov    %rax,%rsi
+  80449a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80449f:	48 b8 a9 5f 80 00 00 	movabs $0x805fa9,%rax
+  8044a6:	00 00 00 
+  8044a9:	ff d0                	call   *%rax
+}
+  8044ab:	c9                   	leave
+  8044ac:	c3                   	ret
+
+00000000008044ad <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8044ad:	55                   	push   %rbp
+  8044ae:	48 89 e5             	mov    %rsp,%rbp
+  8044b1:	48 83 ec 20          	sub    $0x20,%rsp
+  8044b5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044b9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8044bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044c0:	48 89 c7             	mov    %rax,%rdi
+  8044c3:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  8044ca:	00 00 00 
+  8044cd:	ff d0                	call   *%rax
+  8044cf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8044d4:	7e 0a                	jle    8044e0 <open+0x33>
+    return -E_BAD_PATH;
+  8044d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8044db:	e9 a8 00 00 00       	jmp    804588 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8044e0:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8044e4:	48 89 c7             	mov    %rax,%rdi
+  8044e7:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  8044ee:	00 00 00 
+  8044f1:	ff d0                	call   *%rax
+  8044f3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044f6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044fa:	79 08                	jns    804504 <open+0x57>
+    return r;
+  8044fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044ff:	e9 84 00 00 00       	jmp    804588 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804504:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804508:	48 89 c6             	mov    %rax,%rsi
+  80450b:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804512:	00 00 00 
+  804515:	48 89 c7             	mov    %rax,%rdi
+  804518:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  80451f:	00 00 00 
+  804522:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  804524:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80452b:	00 00 00 
+  80452e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804531:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804537:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80453b:	48 89 c6             	mov    %rax,%rsi
+  80453e:	bf 01 00 00 00       	mov    $0x1,%edi
+  804543:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  80454a:	00 00 00 
+  80454d:	ff d0                	call   *%rax
+  80454f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804552:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804556:	79 1d                	jns    804575 <open+0xc8>
+    fd_close(fd, 0);
+  804558:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80455c:	be 00 00 00 00       	mov    $0x0,%esi
+  804561:	48 89 c7             	mov    %rax,%rdi
+  804564:	48 b8 bf 36 80 00 00 	movabs $0x8036bf,%rax
+  80456b:	00 00 00 
+  80456e:	ff d0                	call   *%rax
+    return r;
+  804570:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804573:	eb 13                	jmp    804588 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804575:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804579:	48 89 c7             	mov    %rax,%rdi
+  80457c:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  804583:	00 00 00 
+  804586:	ff d0                	call   *%rax
+}
+  804588:	c9                   	leave
+  804589:	c3                   	ret
+
+000000000080458a <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  80458a:	55                   	push   %rbp
+  80458b:	48 89 e5             	mov    %rsp,%rbp
+  80458e:	48 83 ec 10          	sub    $0x10,%rsp
+  804592:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804596:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80459a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80459d:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8045a4:	00 00 00 
+  8045a7:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8045a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8045ae:	bf 06 00 00 00       	mov    $0x6,%edi
+  8045b3:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  8045ba:	00 00 00 
+  8045bd:	ff d0                	call   *%rax
+}
+  8045bf:	c9                   	leave
+  8045c0:	c3                   	ret
+
+00000000008045c1 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8045c1:	55                   	push   %rbp
+  8045c2:	48 89 e5             	mov    %rsp,%rbp
+  8045c5:	48 83 ec 30          	sub    $0x30,%rsp
+  8045c9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8045cd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8045d1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8045d5:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8045da:	74 07                	je     8045e3 <devfile_read+0x22>
+  8045dc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8045e1:	75 0a                	jne    8045ed <devfile_read+0x2c>
+  return E_INVAL;
+  8045e3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8045e8:	e9 b4 00 00 00       	jmp    8046a1 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8045ed:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8045f4:	00 
+  while (n) {
+  8045f5:	e9 98 00 00 00       	jmp    804692 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8045fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045fe:	8b 40 0c             	mov    0xc(%rax),%eax
+  804601:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804608:	00 00 00 
+  80460b:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80460d:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804614:	00 00 00 
+  804617:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80461b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80461f:	be 00 00 00 00       	mov    $0x0,%esi
+  804624:	bf 03 00 00 00       	mov    $0x3,%edi
+  804629:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  804630:	00 00 00 
+  804633:	ff d0                	call   *%rax
+  804635:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  804638:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80463c:	7f 13                	jg     804651 <devfile_read+0x90>
+      return res ? res : res0;
+  80463e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804642:	74 07                	je     80464b <devfile_read+0x8a>
+  804644:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804647:	48 98                	cltq
+  804649:	eb 56                	jmp    8046a1 <devfile_read+0xe0>
+  80464b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80464f:	eb 50                	jmp    8046a1 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804651:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804654:	48 63 d0             	movslq %eax,%rdx
+  804657:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80465b:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804662:	00 00 00 
+  804665:	48 89 ce             	mov    %rcx,%rsi
+  804668:	48 89 c7             	mov    %rax,%rdi
+  80466b:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  804672:	00 00 00 
+  804675:	ff d0                	call   *%rax
+
+    buf += res;
+  804677:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80467a:	48 98                	cltq
+  80467c:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804680:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804683:	48 98                	cltq
+  804685:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804689:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80468c:	48 98                	cltq
+  80468e:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804692:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804697:	0f 85 5d ff ff ff    	jne    8045fa <devfile_read+0x39>
+  }
+
+  return res0;
+  80469d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8046a1:	c9                   	leave
+  8046a2:	c3                   	ret
+
+00000000008046a3 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8046a3:	55                   	push   %rbp
+  8046a4:	48 89 e5             	mov    %rsp,%rbp
+  8046a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8046ab:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8046af:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8046b3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8046b7:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8046bc:	74 07                	je     8046c5 <devfile_write+0x22>
+  8046be:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8046c3:	75 0a                	jne    8046cf <devfile_write+0x2c>
+  return E_INVAL;
+  8046c5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8046ca:	e9 c9 00 00 00       	jmp    804798 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8046cf:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8046d6:	00 
+
+  while (n) {
+  8046d7:	e9 ad 00 00 00       	jmp    804789 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8046dc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8046e0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8046e4:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8046eb:	00 
+  8046ec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8046f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046f4:	48 39 c2             	cmp    %rax,%rdx
+  8046f7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8046fb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8046ff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804703:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804707:	48 89 c6             	mov    %rax,%rsi
+  80470a:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  804711:	00 00 00 
+  804714:	48 89 c7             	mov    %rax,%rdi
+  804717:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  80471e:	00 00 00 
+  804721:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804723:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804727:	8b 40 0c             	mov    0xc(%rax),%eax
+  80472a:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804731:	00 00 00 
+  804734:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804736:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80473d:	00 00 00 
+  804740:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804744:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804748:	be 00 00 00 00       	mov    $0x0,%esi
+  80474d:	bf 04 00 00 00       	mov    $0x4,%edi
+  804752:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  804759:	00 00 00 
+  80475c:	ff d0                	call   *%rax
+  80475e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804761:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804765:	79 07                	jns    80476e <devfile_write+0xcb>
+      return res;
+  804767:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80476a:	48 98                	cltq
+  80476c:	eb 2a                	jmp    804798 <devfile_write+0xf5>
+
+    buf += res;
+  80476e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804771:	48 98                	cltq
+  804773:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804777:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80477a:	48 98                	cltq
+  80477c:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804780:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804783:	48 98                	cltq
+  804785:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804789:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80478e:	0f 85 48 ff ff ff    	jne    8046dc <devfile_write+0x39>
+  }
+
+  return res0;
+  804794:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804798:	c9                   	leave
+  804799:	c3                   	ret
+
+000000000080479a <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80479a:	55                   	push   %rbp
+  80479b:	48 89 e5             	mov    %rsp,%rbp
+  80479e:	48 83 ec 20          	sub    $0x20,%rsp
+  8047a2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8047a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8047aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ae:	8b 40 0c             	mov    0xc(%rax),%eax
+  8047b1:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047b8:	00 00 00 
+  8047bb:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8047bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8047c2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8047c7:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  8047ce:	00 00 00 
+  8047d1:	ff d0                	call   *%rax
+  8047d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047da:	79 05                	jns    8047e1 <devfile_stat+0x47>
+    return r;
+  8047dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047df:	eb 59                	jmp    80483a <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8047e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047e5:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047ec:	00 00 00 
+  8047ef:	48 89 d6             	mov    %rdx,%rsi
+  8047f2:	48 89 c7             	mov    %rax,%rdi
+  8047f5:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8047fc:	00 00 00 
+  8047ff:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804801:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804808:	00 00 00 
+  80480b:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804811:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804815:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80481b:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804822:	00 00 00 
+  804825:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  80482b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80482f:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804835:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80483a:	c9                   	leave
+  80483b:	c3                   	ret
+
+000000000080483c <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80483c:	55                   	push   %rbp
+  80483d:	48 89 e5             	mov    %rsp,%rbp
+  804840:	48 83 ec 10          	sub    $0x10,%rsp
+  804844:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804848:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80484b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80484f:	8b 40 0c             	mov    0xc(%rax),%eax
+  804852:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804859:	00 00 00 
+  80485c:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  80485e:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804865:	00 00 00 
+  804868:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80486b:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80486e:	be 00 00 00 00       	mov    $0x0,%esi
+  804873:	bf 02 00 00 00       	mov    $0x2,%edi
+  804878:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  80487f:	00 00 00 
+  804882:	ff d0                	call   *%rax
+}
+  804884:	c9                   	leave
+  804885:	c3                   	ret
+
+0000000000804886 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804886:	55                   	push   %rbp
+  804887:	48 89 e5             	mov    %rsp,%rbp
+  80488a:	48 83 ec 18          	sub    $0x18,%rsp
+  80488e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804892:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804895:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804899:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80489c:	83 e0 03             	and    $0x3,%eax
+}
+  80489f:	c9                   	leave
+  8048a0:	c3                   	ret
+
+00000000008048a1 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8048a1:	55                   	push   %rbp
+  8048a2:	48 89 e5             	mov    %rsp,%rbp
+  8048a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8048a9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8048ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048b1:	48 89 c7             	mov    %rax,%rdi
+  8048b4:	48 b8 23 17 80 00 00 	movabs $0x801723,%rax
+  8048bb:	00 00 00 
+  8048be:	ff d0                	call   *%rax
+  8048c0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8048c5:	7e 07                	jle    8048ce <remove+0x2d>
+    return -E_BAD_PATH;
+  8048c7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8048cc:	eb 36                	jmp    804904 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8048ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048d2:	48 89 c6             	mov    %rax,%rsi
+  8048d5:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8048dc:	00 00 00 
+  8048df:	48 89 c7             	mov    %rax,%rdi
+  8048e2:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8048e9:	00 00 00 
+  8048ec:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  8048ee:	be 00 00 00 00       	mov    $0x0,%esi
+  8048f3:	bf 07 00 00 00       	mov    $0x7,%edi
+  8048f8:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  8048ff:	00 00 00 
+  804902:	ff d0                	call   *%rax
+}
+  804904:	c9                   	leave
+  804905:	c3                   	ret
+
+0000000000804906 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804906:	55                   	push   %rbp
+  804907:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80490a:	be 00 00 00 00       	mov    $0x0,%esi
+  80490f:	bf 08 00 00 00       	mov    $0x8,%edi
+  804914:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  80491b:	00 00 00 
+  80491e:	ff d0                	call   *%rax
+}
+  804920:	5d                   	pop    %rbp
+  804921:	c3                   	ret
+
+0000000000804922 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804922:	55                   	push   %rbp
+  804923:	48 89 e5             	mov    %rsp,%rbp
+  804926:	48 83 ec 20          	sub    $0x20,%rsp
+  80492a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80492e:	be 00 00 00 00       	mov    $0x0,%esi
+  804933:	bf 09 00 00 00       	mov    $0x9,%edi
+  804938:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  80493f:	00 00 00 
+  804942:	ff d0                	call   *%rax
+  804944:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804947:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80494b:	79 05                	jns    804952 <fs_stats+0x30>
+    return r;
+  80494d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804950:	eb 2a                	jmp    80497c <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804952:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804956:	ba 68 00 00 00       	mov    $0x68,%edx
+  80495b:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804962:	00 00 00 
+  804965:	48 89 ce             	mov    %rcx,%rsi
+  804968:	48 89 c7             	mov    %rax,%rdi
+  80496b:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  804972:	00 00 00 
+  804975:	ff d0                	call   *%rax
+  return 0;
+  804977:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80497c:	c9                   	leave
+  80497d:	c3                   	ret
+
+000000000080497e <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  80497e:	55                   	push   %rbp
+  80497f:	48 89 e5             	mov    %rsp,%rbp
+  804982:	48 83 ec 10          	sub    $0x10,%rsp
+  804986:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804989:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804990:	00 00 00 
+  804993:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804996:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804998:	be 00 00 00 00       	mov    $0x0,%esi
+  80499d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8049a2:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  8049a9:	00 00 00 
+  8049ac:	ff d0                	call   *%rax
+}
+  8049ae:	c9                   	leave
+  8049af:	c3                   	ret
+
+00000000008049b0 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8049b0:	55                   	push   %rbp
+  8049b1:	48 89 e5             	mov    %rsp,%rbp
+  8049b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8049b8:	89 f8                	mov    %edi,%eax
+  8049ba:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8049bd:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8049c1:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8049c8:	00 00 00 
+  8049cb:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8049cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8049d2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8049d7:	48 b8 26 44 80 00 00 	movabs $0x804426,%rax
+  8049de:	00 00 00 
+  8049e1:	ff d0                	call   *%rax
+}
+  8049e3:	c9                   	leave
+  8049e4:	c3                   	ret
+
+00000000008049e5 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8049e5:	55                   	push   %rbp
+  8049e6:	48 89 e5             	mov    %rsp,%rbp
+  8049e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8049ed:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  8049f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049f5:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  8049fa:	48 89 c7             	mov    %rax,%rdi
+  8049fd:	48 b8 0b 4a 80 00 00 	movabs $0x804a0b,%rax
+  804a04:	00 00 00 
+  804a07:	ff d0                	call   *%rax
+}
+  804a09:	c9                   	leave
+  804a0a:	c3                   	ret
+
+0000000000804a0b <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804a0b:	55                   	push   %rbp
+  804a0c:	48 89 e5             	mov    %rsp,%rbp
+  804a0f:	48 83 ec 50          	sub    $0x50,%rsp
+  804a13:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804a17:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804a1b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804a22:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804a23:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804a28:	74 0a                	je     804a34 <pipe_size+0x29>
+  804a2a:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804a31:	00 
+  804a32:	76 0a                	jbe    804a3e <pipe_size+0x33>
+    return -E_INVAL;
+  804a34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804a39:	e9 cc 02 00 00       	jmp    804d0a <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804a3e:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804a42:	48 89 c7             	mov    %rax,%rdi
+  804a45:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  804a4c:	00 00 00 
+  804a4f:	ff d0                	call   *%rax
+  804a51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a54:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a58:	0f 88 a8 02 00 00    	js     804d06 <pipe_size+0x2fb>
+  804a5e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a62:	ba 07 04 00 00       	mov    $0x407,%edx
+  804a67:	48 89 c6             	mov    %rax,%rsi
+  804a6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a6f:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  804a76:	00 00 00 
+  804a79:	ff d0                	call   *%rax
+  804a7b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a7e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a82:	0f 88 7e 02 00 00    	js     804d06 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804a88:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804a8c:	48 89 c7             	mov    %rax,%rdi
+  804a8f:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  804a96:	00 00 00 
+  804a99:	ff d0                	call   *%rax
+  804a9b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a9e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804aa2:	0f 88 43 02 00 00    	js     804ceb <pipe_size+0x2e0>
+  804aa8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aac:	ba 07 04 00 00       	mov    $0x407,%edx
+  804ab1:	48 89 c6             	mov    %rax,%rsi
+  804ab4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ab9:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  804ac0:	00 00 00 
+  804ac3:	ff d0                	call   *%rax
+  804ac5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ac8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804acc:	0f 88 19 02 00 00    	js     804ceb <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804ad2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ad6:	48 89 c7             	mov    %rax,%rdi
+  804ad9:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  804ae0:	00 00 00 
+  804ae3:	ff d0                	call   *%rax
+  804ae5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804ae9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804af0:	00 
+  804af1:	e9 a2 00 00 00       	jmp    804b98 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804af6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804afa:	48 c1 e0 0c          	shl    $0xc,%rax
+  804afe:	48 89 c2             	mov    %rax,%rdx
+  804b01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b05:	48 01 d0             	add    %rdx,%rax
+  804b08:	ba 07 04 00 00       	mov    $0x407,%edx
+  804b0d:	48 89 c6             	mov    %rax,%rsi
+  804b10:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b15:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+  804b21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b28:	0f 88 37 01 00 00    	js     804c65 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804b2e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b32:	48 89 c7             	mov    %rax,%rdi
+  804b35:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  804b3c:	00 00 00 
+  804b3f:	ff d0                	call   *%rax
+  804b41:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b45:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804b49:	48 01 c2             	add    %rax,%rdx
+  804b4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b50:	48 c1 e0 0c          	shl    $0xc,%rax
+  804b54:	48 89 c1             	mov    %rax,%rcx
+  804b57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b5b:	48 01 c8             	add    %rcx,%rax
+  804b5e:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804b64:	48 89 d1             	mov    %rdx,%rcx
+  804b67:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b6c:	48 89 c6             	mov    %rax,%rsi
+  804b6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b74:	48 b8 4a 26 80 00 00 	movabs $0x80264a,%rax
+  804b7b:	00 00 00 
+  804b7e:	ff d0                	call   *%rax
+  804b80:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b83:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b87:	79 0a                	jns    804b93 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804b89:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804b8e:	e9 d3 00 00 00       	jmp    804c66 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804b93:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804b98:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804b9f:	00 
+  804ba0:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804ba4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ba8:	48 01 d0             	add    %rdx,%rax
+  804bab:	48 83 c0 1f          	add    $0x1f,%rax
+  804baf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804bb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804bbc:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804bc0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bc4:	48 29 d0             	sub    %rdx,%rax
+  804bc7:	48 c1 e8 0c          	shr    $0xc,%rax
+  804bcb:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804bcf:	0f 82 21 ff ff ff    	jb     804af6 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804bd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bd9:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804bdd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804be1:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804be5:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804be9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bed:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  804bf4:	00 00 00 
+  804bf7:	8b 12                	mov    (%rdx),%edx
+  804bf9:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804bfb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804bff:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804c06:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c0a:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  804c11:	00 00 00 
+  804c14:	8b 12                	mov    (%rdx),%edx
+  804c16:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804c18:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c1c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804c23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c27:	48 89 c7             	mov    %rax,%rdi
+  804c2a:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  804c31:	00 00 00 
+  804c34:	ff d0                	call   *%rax
+  804c36:	89 c2                	mov    %eax,%edx
+  804c38:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804c3c:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804c3e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c42:	48 89 c7             	mov    %rax,%rdi
+  804c45:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  804c4c:	00 00 00 
+  804c4f:	ff d0                	call   *%rax
+  804c51:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804c55:	48 83 c2 04          	add    $0x4,%rdx
+  804c59:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c60:	e9 a5 00 00 00       	jmp    804d0a <pipe_size+0x2ff>
+      goto err2;
+  804c65:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804c66:	eb 58                	jmp    804cc0 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804c68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c6c:	48 c1 e0 0c          	shl    $0xc,%rax
+  804c70:	48 89 c2             	mov    %rax,%rdx
+  804c73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c77:	48 01 d0             	add    %rdx,%rax
+  804c7a:	48 89 c6             	mov    %rax,%rsi
+  804c7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c82:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  804c89:	00 00 00 
+  804c8c:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804c8e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c92:	48 89 c7             	mov    %rax,%rdi
+  804c95:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  804c9c:	00 00 00 
+  804c9f:	ff d0                	call   *%rax
+  804ca1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804ca5:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804ca9:	48 01 d0             	add    %rdx,%rax
+  804cac:	48 89 c6             	mov    %rax,%rsi
+  804caf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cb4:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  804cbb:	00 00 00 
+  804cbe:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804cc0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cc4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804cc8:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804ccc:	48 85 c0             	test   %rax,%rax
+  804ccf:	75 97                	jne    804c68 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804cd1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cd5:	48 89 c6             	mov    %rax,%rsi
+  804cd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cdd:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  804ce4:	00 00 00 
+  804ce7:	ff d0                	call   *%rax
+  804ce9:	eb 01                	jmp    804cec <pipe_size+0x2e1>
+    goto err1;
+  804ceb:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804cec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cf0:	48 89 c6             	mov    %rax,%rsi
+  804cf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cf8:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  804cff:	00 00 00 
+  804d02:	ff d0                	call   *%rax
+  804d04:	eb 01                	jmp    804d07 <pipe_size+0x2fc>
+    goto err;
+  804d06:	90                   	nop
+err:
+  return r;
+  804d07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d0a:	c9                   	leave
+  804d0b:	c3                   	ret
+
+0000000000804d0c <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804d0c:	55                   	push   %rbp
+  804d0d:	48 89 e5             	mov    %rsp,%rbp
+  804d10:	53                   	push   %rbx
+  804d11:	48 83 ec 28          	sub    $0x28,%rsp
+  804d15:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804d19:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804d1d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d24:	00 00 00 
+  804d27:	8b 40 04             	mov    0x4(%rax),%eax
+  804d2a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d2f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d36:	00 00 00 
+  804d39:	48 98                	cltq
+  804d3b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804d42:	48 01 d0             	add    %rdx,%rax
+  804d45:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804d4b:	8b 00                	mov    (%rax),%eax
+  804d4d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804d50:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d54:	48 89 c7             	mov    %rax,%rdi
+  804d57:	48 b8 44 62 80 00 00 	movabs $0x806244,%rax
+  804d5e:	00 00 00 
+  804d61:	ff d0                	call   *%rax
+  804d63:	89 c3                	mov    %eax,%ebx
+  804d65:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d69:	48 89 c7             	mov    %rax,%rdi
+  804d6c:	48 b8 44 62 80 00 00 	movabs $0x806244,%rax
+  804d73:	00 00 00 
+  804d76:	ff d0                	call   *%rax
+  804d78:	39 c3                	cmp    %eax,%ebx
+  804d7a:	0f 94 c0             	sete   %al
+  804d7d:	0f b6 c0             	movzbl %al,%eax
+  804d80:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804d83:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d8a:	00 00 00 
+  804d8d:	8b 40 04             	mov    0x4(%rax),%eax
+  804d90:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804d95:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804d9c:	00 00 00 
+  804d9f:	48 98                	cltq
+  804da1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804da8:	48 01 d0             	add    %rdx,%rax
+  804dab:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804db1:	8b 00                	mov    (%rax),%eax
+  804db3:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804db6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804db9:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804dbc:	75 05                	jne    804dc3 <_pipeisclosed+0xb7>
+      return ret;
+  804dbe:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804dc1:	eb 68                	jmp    804e2b <_pipeisclosed+0x11f>
+    if (n != nn)
+  804dc3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804dc6:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804dc9:	0f 84 4e ff ff ff    	je     804d1d <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804dcf:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804dd6:	00 00 00 
+  804dd9:	8b 40 04             	mov    0x4(%rax),%eax
+  804ddc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804de1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804de8:	00 00 00 
+  804deb:	48 98                	cltq
+  804ded:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804df4:	48 01 d0             	add    %rdx,%rax
+  804df7:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804dfd:	8b 10                	mov    (%rax),%edx
+  804dff:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804e02:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e05:	89 c6                	mov    %eax,%esi
+  804e07:	48 b8 30 71 80 00 00 	movabs $0x807130,%rax
+  804e0e:	00 00 00 
+  804e11:	48 89 c7             	mov    %rax,%rdi
+  804e14:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e19:	49 b8 74 08 80 00 00 	movabs $0x800874,%r8
+  804e20:	00 00 00 
+  804e23:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804e26:	e9 f2 fe ff ff       	jmp    804d1d <_pipeisclosed+0x11>
+  }
+}
+  804e2b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804e2f:	c9                   	leave
+  804e30:	c3                   	ret
+
+0000000000804e31 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804e31:	55                   	push   %rbp
+  804e32:	48 89 e5             	mov    %rsp,%rbp
+  804e35:	48 83 ec 30          	sub    $0x30,%rsp
+  804e39:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804e3c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804e40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804e43:	48 89 d6             	mov    %rdx,%rsi
+  804e46:	89 c7                	mov    %eax,%edi
+  804e48:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  804e4f:	00 00 00 
+  804e52:	ff d0                	call   *%rax
+  804e54:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e57:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e5b:	79 05                	jns    804e62 <pipeisclosed+0x31>
+    return r;
+  804e5d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e60:	eb 31                	jmp    804e93 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804e62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e66:	48 89 c7             	mov    %rax,%rdi
+  804e69:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  804e70:	00 00 00 
+  804e73:	ff d0                	call   *%rax
+  804e75:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804e79:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e7d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804e81:	48 89 d6             	mov    %rdx,%rsi
+  804e84:	48 89 c7             	mov    %rax,%rdi
+  804e87:	48 b8 0c 4d 80 00 00 	movabs $0x804d0c,%rax
+  804e8e:	00 00 00 
+  804e91:	ff d0                	call   *%rax
+}
+  804e93:	c9                   	leave
+  804e94:	c3                   	ret
+
+0000000000804e95 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804e95:	55                   	push   %rbp
+  804e96:	48 89 e5             	mov    %rsp,%rbp
+  804e99:	48 83 ec 10          	sub    $0x10,%rsp
+  804e9d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804ea1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ea5:	8b 40 18             	mov    0x18(%rax),%eax
+  804ea8:	8d 50 01             	lea    0x1(%rax),%edx
+  804eab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eaf:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804eb2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eb6:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804eb9:	85 c0                	test   %eax,%eax
+  804ebb:	74 27                	je     804ee4 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804ebd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ec1:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804ec8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ecc:	48 83 c0 18          	add    $0x18,%rax
+  804ed0:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804ed5:	48 89 c7             	mov    %rax,%rdi
+  804ed8:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  804edf:	00 00 00 
+  804ee2:	ff d0                	call   *%rax
+  }
+}
+  804ee4:	90                   	nop
+  804ee5:	c9                   	leave
+  804ee6:	c3                   	ret
+
+0000000000804ee7 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804ee7:	55                   	push   %rbp
+  804ee8:	48 89 e5             	mov    %rsp,%rbp
+  804eeb:	48 83 ec 10          	sub    $0x10,%rsp
+  804eef:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804ef3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804ef6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804efa:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804f01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f05:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804f09:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804f0c:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804f13:	89 c6                	mov    %eax,%esi
+  804f15:	48 89 cf             	mov    %rcx,%rdi
+  804f18:	48 b8 9e 29 80 00 00 	movabs $0x80299e,%rax
+  804f1f:	00 00 00 
+  804f22:	ff d0                	call   *%rax
+}
+  804f24:	90                   	nop
+  804f25:	c9                   	leave
+  804f26:	c3                   	ret
+
+0000000000804f27 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f27:	55                   	push   %rbp
+  804f28:	48 89 e5             	mov    %rsp,%rbp
+  804f2b:	48 83 ec 70          	sub    $0x70,%rsp
+  804f2f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804f33:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804f37:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804f3b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f3f:	48 89 c7             	mov    %rax,%rdi
+  804f42:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  804f49:	00 00 00 
+  804f4c:	ff d0                	call   *%rax
+  804f4e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804f52:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804f57:	75 0a                	jne    804f63 <devpipe_read+0x3c>
+    return 0;
+  804f59:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f5e:	e9 63 01 00 00       	jmp    8050c6 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804f63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f67:	8b 40 18             	mov    0x18(%rax),%eax
+  804f6a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804f6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f71:	48 8b 10             	mov    (%rax),%rdx
+  804f74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f78:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f7c:	48 39 c2             	cmp    %rax,%rdx
+  804f7f:	75 42                	jne    804fc3 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804f81:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804f85:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f89:	48 89 d6             	mov    %rdx,%rsi
+  804f8c:	48 89 c7             	mov    %rax,%rdi
+  804f8f:	48 b8 0c 4d 80 00 00 	movabs $0x804d0c,%rax
+  804f96:	00 00 00 
+  804f99:	ff d0                	call   *%rax
+  804f9b:	85 c0                	test   %eax,%eax
+  804f9d:	74 0a                	je     804fa9 <devpipe_read+0x82>
+      return 0;
+  804f9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fa4:	e9 1d 01 00 00       	jmp    8050c6 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804fa9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804fac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fb0:	89 d6                	mov    %edx,%esi
+  804fb2:	48 89 c7             	mov    %rax,%rdi
+  804fb5:	48 b8 e7 4e 80 00 00 	movabs $0x804ee7,%rax
+  804fbc:	00 00 00 
+  804fbf:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804fc1:	eb a0                	jmp    804f63 <devpipe_read+0x3c>
+      break;
+  804fc3:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804fc4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804fc8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804fcc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804fd0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804fd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fd8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804fdc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fe0:	48 8b 00             	mov    (%rax),%rax
+  804fe3:	48 29 c2             	sub    %rax,%rdx
+  804fe6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804fea:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804fee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ff2:	48 39 c2             	cmp    %rax,%rdx
+  804ff5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ff9:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804ffd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805001:	48 8b 00             	mov    (%rax),%rax
+  805004:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805008:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80500c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805011:	48 f7 f1             	div    %rcx
+  805014:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  805018:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80501c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805020:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805024:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805028:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  80502c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805030:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805034:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805038:	48 39 c2             	cmp    %rax,%rdx
+  80503b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80503f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  805043:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805047:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  80504b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80504f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805053:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805057:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80505b:	48 89 ce             	mov    %rcx,%rsi
+  80505e:	48 89 c7             	mov    %rax,%rdi
+  805061:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  805068:	00 00 00 
+  80506b:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80506d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805071:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  805075:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805079:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80507d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805081:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805085:	48 01 d1             	add    %rdx,%rcx
+  805088:	48 89 c2             	mov    %rax,%rdx
+  80508b:	48 89 cf             	mov    %rcx,%rdi
+  80508e:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  805095:	00 00 00 
+  805098:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  80509a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80509e:	48 8b 10             	mov    (%rax),%rdx
+  8050a1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8050a5:	48 01 c2             	add    %rax,%rdx
+  8050a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050ac:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8050af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050b3:	48 89 c7             	mov    %rax,%rdi
+  8050b6:	48 b8 95 4e 80 00 00 	movabs $0x804e95,%rax
+  8050bd:	00 00 00 
+  8050c0:	ff d0                	call   *%rax
+  return n;
+  8050c2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8050c6:	c9                   	leave
+  8050c7:	c3                   	ret
+
+00000000008050c8 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8050c8:	55                   	push   %rbp
+  8050c9:	48 89 e5             	mov    %rsp,%rbp
+  8050cc:	48 83 ec 70          	sub    $0x70,%rsp
+  8050d0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8050d4:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8050d8:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8050dc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8050e0:	48 89 c7             	mov    %rax,%rdi
+  8050e3:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  8050ea:	00 00 00 
+  8050ed:	ff d0                	call   *%rax
+  8050ef:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8050f3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8050f7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8050fb:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805102:	00 
+  805103:	e9 b8 01 00 00       	jmp    8052c0 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  805108:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80510c:	8b 40 18             	mov    0x18(%rax),%eax
+  80510f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  805112:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805116:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80511a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80511e:	48 8b 00             	mov    (%rax),%rax
+  805121:	48 29 c2             	sub    %rax,%rdx
+  805124:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805128:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80512c:	48 39 c2             	cmp    %rax,%rdx
+  80512f:	75 4d                	jne    80517e <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  805131:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805135:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805139:	48 89 d6             	mov    %rdx,%rsi
+  80513c:	48 89 c7             	mov    %rax,%rdi
+  80513f:	48 b8 0c 4d 80 00 00 	movabs $0x804d0c,%rax
+  805146:	00 00 00 
+  805149:	ff d0                	call   *%rax
+  80514b:	85 c0                	test   %eax,%eax
+  80514d:	74 0a                	je     805159 <devpipe_write+0x91>
+        return 0;
+  80514f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805154:	e9 79 01 00 00       	jmp    8052d2 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  805159:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80515c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805160:	89 d6                	mov    %edx,%esi
+  805162:	48 89 c7             	mov    %rax,%rdi
+  805165:	48 b8 e7 4e 80 00 00 	movabs $0x804ee7,%rax
+  80516c:	00 00 00 
+  80516f:	ff d0                	call   *%rax
+      m = 0;
+  805171:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805178:	00 
+      continue;
+  805179:	e9 3a 01 00 00       	jmp    8052b8 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80517e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805182:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  805186:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80518a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80518e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805192:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805196:	48 8b 08             	mov    (%rax),%rcx
+  805199:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80519d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8051a1:	48 29 c1             	sub    %rax,%rcx
+  8051a4:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8051a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8051ac:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8051b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051b4:	48 39 c2             	cmp    %rax,%rdx
+  8051b7:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8051bb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8051bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051c3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8051c7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8051cb:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8051cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051d4:	48 f7 f1             	div    %rcx
+  8051d7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8051db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051df:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8051e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051e7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051eb:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8051ef:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8051f3:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8051f7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8051fb:	48 39 c2             	cmp    %rax,%rdx
+  8051fe:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805202:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805206:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80520a:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80520e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805212:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  805216:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80521a:	48 01 d1             	add    %rdx,%rcx
+  80521d:	48 89 c2             	mov    %rax,%rdx
+  805220:	48 89 cf             	mov    %rcx,%rdi
+  805223:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  80522a:	00 00 00 
+  80522d:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80522f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805233:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805237:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80523b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80523f:	73 4d                	jae    80528e <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  805241:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805245:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805249:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80524d:	48 29 c2             	sub    %rax,%rdx
+  805250:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805254:	48 01 c2             	add    %rax,%rdx
+  805257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80525b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80525f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805263:	48 89 c1             	mov    %rax,%rcx
+  805266:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80526a:	48 01 c1             	add    %rax,%rcx
+  80526d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805271:	48 01 c1             	add    %rax,%rcx
+  805274:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805278:	48 83 c0 20          	add    $0x20,%rax
+  80527c:	48 89 ce             	mov    %rcx,%rsi
+  80527f:	48 89 c7             	mov    %rax,%rdi
+  805282:	48 b8 6d 1f 80 00 00 	movabs $0x801f6d,%rax
+  805289:	00 00 00 
+  80528c:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80528e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805292:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805296:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80529a:	48 01 c2             	add    %rax,%rdx
+  80529d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052a1:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8052a5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052a9:	48 89 c7             	mov    %rax,%rdi
+  8052ac:	48 b8 95 4e 80 00 00 	movabs $0x804e95,%rax
+  8052b3:	00 00 00 
+  8052b6:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8052b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052bc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8052c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052c4:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8052c8:	0f 82 3a fe ff ff    	jb     805108 <devpipe_write+0x40>
+  }
+
+  return i;
+  8052ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8052d2:	c9                   	leave
+  8052d3:	c3                   	ret
+
+00000000008052d4 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8052d4:	55                   	push   %rbp
+  8052d5:	48 89 e5             	mov    %rsp,%rbp
+  8052d8:	48 83 ec 40          	sub    $0x40,%rsp
+  8052dc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8052e0:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8052e3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8052e7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052eb:	48 89 c7             	mov    %rax,%rdi
+  8052ee:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  8052f5:	00 00 00 
+  8052f8:	ff d0                	call   *%rax
+  8052fa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8052fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  805305:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805309:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80530d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805311:	48 89 d6             	mov    %rdx,%rsi
+  805314:	48 89 c7             	mov    %rax,%rdi
+  805317:	48 b8 af 3f 80 00 00 	movabs $0x803faf,%rax
+  80531e:	00 00 00 
+  805321:	ff d0                	call   *%rax
+  805323:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805326:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80532a:	79 08                	jns    805334 <devpipe_poll+0x60>
+    return r;
+  80532c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80532f:	e9 85 00 00 00       	jmp    8053b9 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  805334:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805337:	83 e0 01             	and    $0x1,%eax
+  80533a:	85 c0                	test   %eax,%eax
+  80533c:	74 18                	je     805356 <devpipe_poll+0x82>
+  80533e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805342:	48 8b 10             	mov    (%rax),%rdx
+  805345:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805349:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80534d:	48 39 c2             	cmp    %rax,%rdx
+  805350:	74 04                	je     805356 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805352:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  805356:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805359:	83 e0 02             	and    $0x2,%eax
+  80535c:	85 c0                	test   %eax,%eax
+  80535e:	74 23                	je     805383 <devpipe_poll+0xaf>
+  805360:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805364:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805368:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80536c:	48 8b 00             	mov    (%rax),%rax
+  80536f:	48 29 c2             	sub    %rax,%rdx
+  805372:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805376:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80537a:	48 39 c2             	cmp    %rax,%rdx
+  80537d:	73 04                	jae    805383 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80537f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805383:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805387:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80538b:	48 89 d6             	mov    %rdx,%rsi
+  80538e:	48 89 c7             	mov    %rax,%rdi
+  805391:	48 b8 0c 4d 80 00 00 	movabs $0x804d0c,%rax
+  805398:	00 00 00 
+  80539b:	ff d0                	call   *%rax
+  80539d:	85 c0                	test   %eax,%eax
+  80539f:	74 04                	je     8053a5 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8053a1:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8053a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8053a9:	75 0b                	jne    8053b6 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8053ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053af:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8053b6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8053b9:	c9                   	leave
+  8053ba:	c3                   	ret
+
+00000000008053bb <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8053bb:	55                   	push   %rbp
+  8053bc:	48 89 e5             	mov    %rsp,%rbp
+  8053bf:	48 83 ec 20          	sub    $0x20,%rsp
+  8053c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8053c7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8053cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053cf:	48 89 c7             	mov    %rax,%rdi
+  8053d2:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  8053d9:	00 00 00 
+  8053dc:	ff d0                	call   *%rax
+  8053de:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8053e2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053e6:	48 ba 61 71 80 00 00 	movabs $0x807161,%rdx
+  8053ed:	00 00 00 
+  8053f0:	48 89 d6             	mov    %rdx,%rsi
+  8053f3:	48 89 c7             	mov    %rax,%rdi
+  8053f6:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  8053fd:	00 00 00 
+  805400:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805402:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805406:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80540a:	89 c1                	mov    %eax,%ecx
+  80540c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805410:	48 8b 00             	mov    (%rax),%rax
+  805413:	89 c2                	mov    %eax,%edx
+  805415:	89 c8                	mov    %ecx,%eax
+  805417:	29 d0                	sub    %edx,%eax
+  805419:	89 c2                	mov    %eax,%edx
+  80541b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80541f:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  805425:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805429:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805430:	00 00 00 
+  stat->st_dev   = &devpipe;
+  805433:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805437:	48 b9 80 80 80 00 00 	movabs $0x808080,%rcx
+  80543e:	00 00 00 
+  805441:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805448:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80544d:	c9                   	leave
+  80544e:	c3                   	ret
+
+000000000080544f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80544f:	55                   	push   %rbp
+  805450:	48 89 e5             	mov    %rsp,%rbp
+  805453:	48 83 ec 40          	sub    $0x40,%rsp
+  805457:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80545b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80545f:	48 89 c7             	mov    %rax,%rdi
+  805462:	48 b8 dc 34 80 00 00 	movabs $0x8034dc,%rax
+  805469:	00 00 00 
+  80546c:	ff d0                	call   *%rax
+  80546e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805472:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805479:	00 
+  80547a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80547e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805482:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805486:	48 01 d0             	add    %rdx,%rax
+  805489:	48 83 c0 1f          	add    $0x1f,%rax
+  80548d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805491:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80549a:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80549e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054a2:	48 29 d0             	sub    %rdx,%rax
+  8054a5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8054a9:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8054ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8054b1:	48 89 c6             	mov    %rax,%rsi
+  8054b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054b9:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  8054c0:	00 00 00 
+  8054c3:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8054c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054c9:	48 89 c7             	mov    %rax,%rdi
+  8054cc:	48 b8 95 4e 80 00 00 	movabs $0x804e95,%rax
+  8054d3:	00 00 00 
+  8054d6:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8054d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054dc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8054e0:	eb 2f                	jmp    805511 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8054e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054e6:	48 83 e8 01          	sub    $0x1,%rax
+  8054ea:	48 c1 e0 0c          	shl    $0xc,%rax
+  8054ee:	48 89 c2             	mov    %rax,%rdx
+  8054f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054f5:	48 01 d0             	add    %rdx,%rax
+  8054f8:	48 89 c6             	mov    %rax,%rsi
+  8054fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  805500:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  805507:	00 00 00 
+  80550a:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80550c:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805511:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805516:	77 ca                	ja     8054e2 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805518:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80551c:	48 89 c6             	mov    %rax,%rsi
+  80551f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805524:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  80552b:	00 00 00 
+  80552e:	ff d0                	call   *%rax
+}
+  805530:	c9                   	leave
+  805531:	c3                   	ret
+
+0000000000805532 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805532:	55                   	push   %rbp
+  805533:	48 89 e5             	mov    %rsp,%rbp
+  805536:	48 83 ec 10          	sub    $0x10,%rsp
+  80553a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  80553d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805540:	be 00 00 00 00       	mov    $0x0,%esi
+  805545:	89 c7                	mov    %eax,%edi
+  805547:	48 b8 56 55 80 00 00 	movabs $0x805556,%rax
+  80554e:	00 00 00 
+  805551:	ff d0                	call   *%rax
+}
+  805553:	90                   	nop
+  805554:	c9                   	leave
+  805555:	c3                   	ret
+
+0000000000805556 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805556:	55                   	push   %rbp
+  805557:	48 89 e5             	mov    %rsp,%rbp
+  80555a:	48 83 ec 10          	sub    $0x10,%rsp
+  80555e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805561:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805565:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805569:	75 3e                	jne    8055a9 <waitpid+0x53>
+  80556b:	48 b8 68 71 80 00 00 	movabs $0x807168,%rax
+  805572:	00 00 00 
+  805575:	48 89 c1             	mov    %rax,%rcx
+  805578:	48 b8 73 71 80 00 00 	movabs $0x807173,%rax
+  80557f:	00 00 00 
+  805582:	48 89 c2             	mov    %rax,%rdx
+  805585:	be 0e 00 00 00       	mov    $0xe,%esi
+  80558a:	48 b8 88 71 80 00 00 	movabs $0x807188,%rax
+  805591:	00 00 00 
+  805594:	48 89 c7             	mov    %rax,%rdi
+  805597:	b8 00 00 00 00       	mov    $0x0,%eax
+  80559c:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  8055a3:	00 00 00 
+  8055a6:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  8055a9:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8055ae:	74 0a                	je     8055ba <waitpid+0x64>
+    *status = 0;
+  8055b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055b4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  8055ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8055be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055c1:	48 89 d6             	mov    %rdx,%rsi
+  8055c4:	89 c7                	mov    %eax,%edi
+  8055c6:	48 b8 f1 24 80 00 00 	movabs $0x8024f1,%rax
+  8055cd:	00 00 00 
+  8055d0:	ff d0                	call   *%rax
+}
+  8055d2:	c9                   	leave
+  8055d3:	c3                   	ret
+
+00000000008055d4 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  8055d4:	55                   	push   %rbp
+  8055d5:	48 89 e5             	mov    %rsp,%rbp
+  8055d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8055dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8055e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8055e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8055ec:	48 89 c7             	mov    %rax,%rdi
+  8055ef:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8055f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055f6:	48 b8 38 58 80 00 00 	movabs $0x805838,%rax
+  8055fd:	00 00 00 
+  805600:	ff d0                	call   *%rax
+}
+  805602:	90                   	nop
+  805603:	c9                   	leave
+  805604:	c3                   	ret
+
+0000000000805605 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  805605:	55                   	push   %rbp
+  805606:	48 89 e5             	mov    %rsp,%rbp
+  805609:	48 83 ec 20          	sub    $0x20,%rsp
+  80560d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  805610:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805613:	c1 e0 10             	shl    $0x10,%eax
+  805616:	48 98                	cltq
+  805618:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  80561d:	48 01 d0             	add    %rdx,%rax
+  805620:	48 89 c6             	mov    %rax,%rsi
+  805623:	bf 00 00 00 00       	mov    $0x0,%edi
+  805628:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  80562f:	00 00 00 
+  805632:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805634:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805637:	83 c0 01             	add    $0x1,%eax
+  80563a:	c1 e0 10             	shl    $0x10,%eax
+  80563d:	48 98                	cltq
+  80563f:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805644:	48 01 d0             	add    %rdx,%rax
+  805647:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80564b:	eb 20                	jmp    80566d <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  80564d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805651:	48 89 c6             	mov    %rax,%rsi
+  805654:	bf 00 00 00 00       	mov    $0x0,%edi
+  805659:	48 b8 aa 26 80 00 00 	movabs $0x8026aa,%rax
+  805660:	00 00 00 
+  805663:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805665:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80566c:	00 
+  80566d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805670:	83 c0 01             	add    $0x1,%eax
+  805673:	c1 e0 10             	shl    $0x10,%eax
+  805676:	48 98                	cltq
+  805678:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80567d:	48 01 d0             	add    %rdx,%rax
+  805680:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805684:	72 c7                	jb     80564d <slot_unmap+0x48>
+}
+  805686:	90                   	nop
+  805687:	90                   	nop
+  805688:	c9                   	leave
+  805689:	c3                   	ret
+
+000000000080568a <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  80568a:	55                   	push   %rbp
+  80568b:	48 89 e5             	mov    %rsp,%rbp
+  80568e:	48 83 ec 30          	sub    $0x30,%rsp
+  805692:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805696:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  80569a:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8056a1:	00 00 00 
+  8056a4:	48 89 c7             	mov    %rax,%rdi
+  8056a7:	48 b8 c5 63 80 00 00 	movabs $0x8063c5,%rax
+  8056ae:	00 00 00 
+  8056b1:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  8056b3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8056ba:	eb 04                	jmp    8056c0 <thread_create+0x36>
+  8056bc:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8056c0:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  8056c4:	7f 16                	jg     8056dc <thread_create+0x52>
+  8056c6:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  8056cd:	00 00 00 
+  8056d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8056d3:	48 98                	cltq
+  8056d5:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8056d8:	85 c0                	test   %eax,%eax
+  8056da:	75 e0                	jne    8056bc <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8056dc:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8056e0:	75 0c                	jne    8056ee <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8056e2:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8056e9:	e9 2c 01 00 00       	jmp    80581a <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8056ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8056f1:	c1 e0 10             	shl    $0x10,%eax
+  8056f4:	48 98                	cltq
+  8056f6:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8056fb:	48 01 d0             	add    %rdx,%rax
+  8056fe:	ba 07 00 00 00       	mov    $0x7,%edx
+  805703:	48 89 c6             	mov    %rax,%rsi
+  805706:	bf 00 00 00 00       	mov    $0x0,%edi
+  80570b:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  805712:	00 00 00 
+  805715:	ff d0                	call   *%rax
+  805717:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80571a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80571e:	0f 88 f5 00 00 00    	js     805819 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805724:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805727:	83 c0 01             	add    $0x1,%eax
+  80572a:	c1 e0 10             	shl    $0x10,%eax
+  80572d:	48 98                	cltq
+  80572f:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805734:	48 01 d0             	add    %rdx,%rax
+  805737:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80573b:	eb 32                	jmp    80576f <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  80573d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805741:	ba 07 00 00 00       	mov    $0x7,%edx
+  805746:	48 89 c6             	mov    %rax,%rsi
+  805749:	bf 00 00 00 00       	mov    $0x0,%edi
+  80574e:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  805755:	00 00 00 
+  805758:	ff d0                	call   *%rax
+  80575a:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80575d:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805761:	0f 88 9e 00 00 00    	js     805805 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805767:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80576e:	00 
+  80576f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805772:	83 c0 01             	add    $0x1,%eax
+  805775:	c1 e0 10             	shl    $0x10,%eax
+  805778:	48 98                	cltq
+  80577a:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80577f:	48 01 d0             	add    %rdx,%rax
+  805782:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805786:	72 b5                	jb     80573d <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805788:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80578c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805790:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805793:	c1 e2 10             	shl    $0x10,%edx
+  805796:	48 63 d2             	movslq %edx,%rdx
+  805799:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  80579e:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  8057a1:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  8057a4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8057a7:	83 c2 01             	add    $0x1,%edx
+  8057aa:	c1 e2 10             	shl    $0x10,%edx
+  8057ad:	48 63 d2             	movslq %edx,%rdx
+  8057b0:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  8057b5:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  8057b8:	48 bf d4 55 80 00 00 	movabs $0x8055d4,%rdi
+  8057bf:	00 00 00 
+  8057c2:	49 89 c8             	mov    %rcx,%r8
+  8057c5:	48 89 c1             	mov    %rax,%rcx
+  8057c8:	4c 89 ca             	mov    %r9,%rdx
+  8057cb:	48 b8 92 2a 80 00 00 	movabs $0x802a92,%rax
+  8057d2:	00 00 00 
+  8057d5:	ff d0                	call   *%rax
+  8057d7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8057da:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8057de:	79 08                	jns    8057e8 <thread_create+0x15e>
+    r = id;
+  8057e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057e3:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8057e6:	eb 1e                	jmp    805806 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8057e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057eb:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8057ee:	48 b9 40 a0 80 00 00 	movabs $0x80a040,%rcx
+  8057f5:	00 00 00 
+  8057f8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8057fb:	48 98                	cltq
+  8057fd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  805800:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  805803:	eb 15                	jmp    80581a <thread_create+0x190>
+      goto fail;
+  805805:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  805806:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805809:	89 c7                	mov    %eax,%edi
+  80580b:	48 b8 05 56 80 00 00 	movabs $0x805605,%rax
+  805812:	00 00 00 
+  805815:	ff d0                	call   *%rax
+  805817:	eb 01                	jmp    80581a <thread_create+0x190>
+    goto out;
+  805819:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  80581a:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805821:	00 00 00 
+  805824:	48 89 c7             	mov    %rax,%rdi
+  805827:	48 b8 9a 64 80 00 00 	movabs $0x80649a,%rax
+  80582e:	00 00 00 
+  805831:	ff d0                	call   *%rax
+  return r;
+  805833:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805836:	c9                   	leave
+  805837:	c3                   	ret
+
+0000000000805838 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  805838:	55                   	push   %rbp
+  805839:	48 89 e5             	mov    %rsp,%rbp
+  80583c:	48 83 ec 10          	sub    $0x10,%rsp
+  805840:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805843:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805846:	89 c7                	mov    %eax,%edi
+  805848:	48 b8 ef 2a 80 00 00 	movabs $0x802aef,%rax
+  80584f:	00 00 00 
+  805852:	ff d0                	call   *%rax
+}
+  805854:	90                   	nop
+  805855:	c9                   	leave
+  805856:	c3                   	ret
+
+0000000000805857 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  805857:	55                   	push   %rbp
+  805858:	48 89 e5             	mov    %rsp,%rbp
+  80585b:	48 83 ec 20          	sub    $0x20,%rsp
+  80585f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805862:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805866:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80586d:	00 00 00 
+  805870:	48 89 c7             	mov    %rax,%rdi
+  805873:	48 b8 c5 63 80 00 00 	movabs $0x8063c5,%rax
+  80587a:	00 00 00 
+  80587d:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  80587f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805886:	eb 04                	jmp    80588c <thread_join+0x35>
+  805888:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80588c:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805890:	7f 17                	jg     8058a9 <thread_join+0x52>
+  805892:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  805899:	00 00 00 
+  80589c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80589f:	48 98                	cltq
+  8058a1:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8058a4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8058a7:	75 df                	jne    805888 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  8058a9:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8058b0:	00 00 00 
+  8058b3:	48 89 c7             	mov    %rax,%rdi
+  8058b6:	48 b8 9a 64 80 00 00 	movabs $0x80649a,%rax
+  8058bd:	00 00 00 
+  8058c0:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  8058c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058c6:	74 06                	je     8058ce <thread_join+0x77>
+  8058c8:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8058cc:	75 07                	jne    8058d5 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8058ce:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8058d3:	eb 76                	jmp    80594b <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8058d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8058d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058dc:	48 89 d6             	mov    %rdx,%rsi
+  8058df:	89 c7                	mov    %eax,%edi
+  8058e1:	48 b8 56 55 80 00 00 	movabs $0x805556,%rax
+  8058e8:	00 00 00 
+  8058eb:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8058ed:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8058f4:	00 00 00 
+  8058f7:	48 89 c7             	mov    %rax,%rdi
+  8058fa:	48 b8 c5 63 80 00 00 	movabs $0x8063c5,%rax
+  805901:	00 00 00 
+  805904:	ff d0                	call   *%rax
+  slot_unmap(i);
+  805906:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805909:	89 c7                	mov    %eax,%edi
+  80590b:	48 b8 05 56 80 00 00 	movabs $0x805605,%rax
+  805912:	00 00 00 
+  805915:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  805917:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  80591e:	00 00 00 
+  805921:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805924:	48 98                	cltq
+  805926:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  80592d:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805934:	00 00 00 
+  805937:	48 89 c7             	mov    %rax,%rdi
+  80593a:	48 b8 9a 64 80 00 00 	movabs $0x80649a,%rax
+  805941:	00 00 00 
+  805944:	ff d0                	call   *%rax
+  return 0;
+  805946:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80594b:	c9                   	leave
+  80594c:	c3                   	ret
+
+000000000080594d <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  80594d:	55                   	push   %rbp
+  80594e:	48 89 e5             	mov    %rsp,%rbp
+  805951:	48 83 ec 08          	sub    $0x8,%rsp
+  805955:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805959:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  80595e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805962:	73 23                	jae    805987 <thread_is_uxstack+0x3a>
+  805964:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805969:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80596d:	72 18                	jb     805987 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  80596f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805973:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805978:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  80597e:	75 07                	jne    805987 <thread_is_uxstack+0x3a>
+  805980:	b8 01 00 00 00       	mov    $0x1,%eax
+  805985:	eb 05                	jmp    80598c <thread_is_uxstack+0x3f>
+  805987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80598c:	83 e0 01             	and    $0x1,%eax
+}
+  80598f:	c9                   	leave
+  805990:	c3                   	ret
+
+0000000000805991 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805991:	55                   	push   %rbp
+  805992:	48 89 e5             	mov    %rsp,%rbp
+  805995:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805999:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8059a0:	00 00 00 
+  8059a3:	8b 40 04             	mov    0x4(%rax),%eax
+  8059a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8059ab:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8059b2:	00 00 00 
+  8059b5:	48 98                	cltq
+  8059b7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8059be:	48 01 d0             	add    %rdx,%rax
+  8059c1:	48 05 08 01 00 00    	add    $0x108,%rax
+  8059c7:	48 8b 00             	mov    (%rax),%rax
+  8059ca:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  8059ce:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8059d3:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8059d7:	73 0b                	jae    8059e4 <thread_pftemp+0x53>
+  8059d9:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8059de:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8059e2:	73 07                	jae    8059eb <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8059e4:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8059e9:	eb 26                	jmp    805a11 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8059eb:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8059f2:	ff ff ff 
+  8059f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059f9:	48 01 d0             	add    %rdx,%rax
+  8059fc:	48 c1 e8 10          	shr    $0x10,%rax
+  805a00:	48 83 c0 01          	add    $0x1,%rax
+  805a04:	48 c1 e0 0c          	shl    $0xc,%rax
+  805a08:	48 f7 d8             	neg    %rax
+  805a0b:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  805a11:	c9                   	leave
+  805a12:	c3                   	ret
+
+0000000000805a13 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805a13:	55                   	push   %rbp
+  805a14:	48 89 e5             	mov    %rsp,%rbp
+  805a17:	48 83 ec 08          	sub    $0x8,%rsp
+  805a1b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805a1e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a22:	75 10                	jne    805a34 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805a24:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805a2b:	00 00 00 
+  805a2e:	8b 00                	mov    (%rax),%eax
+  805a30:	48 98                	cltq
+  805a32:	eb 05                	jmp    805a39 <vsyscall+0x26>
+  }
+  return 0;
+  805a34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a39:	c9                   	leave
+  805a3a:	c3                   	ret
+
+0000000000805a3b <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805a3b:	55                   	push   %rbp
+  805a3c:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805a3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a44:	48 b8 13 5a 80 00 00 	movabs $0x805a13,%rax
+  805a4b:	00 00 00 
+  805a4e:	ff d0                	call   *%rax
+}
+  805a50:	5d                   	pop    %rbp
+  805a51:	c3                   	ret
+
+0000000000805a52 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805a52:	55                   	push   %rbp
+  805a53:	48 89 e5             	mov    %rsp,%rbp
+  805a56:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805a5a:	0f 31                	rdtsc
+  805a5c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805a5f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805a62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a65:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805a68:	48 c1 e2 20          	shl    $0x20,%rdx
+  805a6c:	48 09 d0             	or     %rdx,%rax
+  805a6f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805a73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805a77:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805a7b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805a82:	00 00 00 
+  805a85:	8b 40 08             	mov    0x8(%rax),%eax
+  805a88:	48 98                	cltq
+  805a8a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805a8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a92:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a97:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805a9b:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805aa2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  805aab:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805aaf:	48 89 d0             	mov    %rdx,%rax
+  805ab2:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805ab9:	ba 00 00 00 00       	mov    $0x0,%edx
+  805abe:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805ac2:	48 01 c8             	add    %rcx,%rax
+}
+  805ac5:	c9                   	leave
+  805ac6:	c3                   	ret
+
+0000000000805ac7 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805ac7:	55                   	push   %rbp
+  805ac8:	48 89 e5             	mov    %rsp,%rbp
+  805acb:	48 83 ec 20          	sub    $0x20,%rsp
+  805acf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805ad2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ad5:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805ad8:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805adc:	be 01 00 00 00       	mov    $0x1,%esi
+  805ae1:	48 89 c7             	mov    %rax,%rdi
+  805ae4:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  805aeb:	00 00 00 
+  805aee:	ff d0                	call   *%rax
+}
+  805af0:	90                   	nop
+  805af1:	c9                   	leave
+  805af2:	c3                   	ret
+
+0000000000805af3 <getchar>:
+
+int
+getchar(void) {
+  805af3:	55                   	push   %rbp
+  805af4:	48 89 e5             	mov    %rsp,%rbp
+  805af7:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805afb:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805aff:	ba 01 00 00 00       	mov    $0x1,%edx
+  805b04:	48 89 c6             	mov    %rax,%rsi
+  805b07:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b0c:	48 b8 45 3b 80 00 00 	movabs $0x803b45,%rax
+  805b13:	00 00 00 
+  805b16:	ff d0                	call   *%rax
+  805b18:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805b1b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b1f:	79 05                	jns    805b26 <getchar+0x33>
+    return r;
+  805b21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b24:	eb 14                	jmp    805b3a <getchar+0x47>
+  if (r < 1)
+  805b26:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b2a:	7f 07                	jg     805b33 <getchar+0x40>
+    return -E_EOF;
+  805b2c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805b31:	eb 07                	jmp    805b3a <getchar+0x47>
+  return c;
+  805b33:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805b37:	0f b6 c0             	movzbl %al,%eax
+}
+  805b3a:	c9                   	leave
+  805b3b:	c3                   	ret
+
+0000000000805b3c <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805b3c:	55                   	push   %rbp
+  805b3d:	48 89 e5             	mov    %rsp,%rbp
+  805b40:	48 83 ec 20          	sub    $0x20,%rsp
+  805b44:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805b47:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805b4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b4e:	48 89 d6             	mov    %rdx,%rsi
+  805b51:	89 c7                	mov    %eax,%edi
+  805b53:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  805b5a:	00 00 00 
+  805b5d:	ff d0                	call   *%rax
+  805b5f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b62:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b66:	79 05                	jns    805b6d <iscons+0x31>
+    return r;
+  805b68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b6b:	eb 1a                	jmp    805b87 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805b6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805b71:	8b 10                	mov    (%rax),%edx
+  805b73:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  805b7a:	00 00 00 
+  805b7d:	8b 00                	mov    (%rax),%eax
+  805b7f:	39 c2                	cmp    %eax,%edx
+  805b81:	0f 94 c0             	sete   %al
+  805b84:	0f b6 c0             	movzbl %al,%eax
+}
+  805b87:	c9                   	leave
+  805b88:	c3                   	ret
+
+0000000000805b89 <opencons>:
+
+int
+opencons(void) {
+  805b89:	55                   	push   %rbp
+  805b8a:	48 89 e5             	mov    %rsp,%rbp
+  805b8d:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805b91:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805b95:	48 89 c7             	mov    %rax,%rdi
+  805b98:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  805b9f:	00 00 00 
+  805ba2:	ff d0                	call   *%rax
+  805ba4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ba7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805bab:	79 05                	jns    805bb2 <opencons+0x29>
+    return r;
+  805bad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bb0:	eb 66                	jmp    805c18 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805bb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805bb6:	ba 07 04 00 00       	mov    $0x407,%edx
+  805bbb:	48 89 c6             	mov    %rax,%rsi
+  805bbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bc3:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  805bca:	00 00 00 
+  805bcd:	ff d0                	call   *%rax
+  805bcf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805bd2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805bd6:	79 05                	jns    805bdd <opencons+0x54>
+    return r;
+  805bd8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bdb:	eb 3b                	jmp    805c18 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805bdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805be1:	48 ba c0 80 80 00 00 	movabs $0x8080c0,%rdx
+  805be8:	00 00 00 
+  805beb:	8b 12                	mov    (%rdx),%edx
+  805bed:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805bef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805bf3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805bfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805bfe:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805c05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c09:	48 89 c7             	mov    %rax,%rdi
+  805c0c:	48 b8 b9 34 80 00 00 	movabs $0x8034b9,%rax
+  805c13:	00 00 00 
+  805c16:	ff d0                	call   *%rax
+}
+  805c18:	c9                   	leave
+  805c19:	c3                   	ret
+
+0000000000805c1a <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805c1a:	55                   	push   %rbp
+  805c1b:	48 89 e5             	mov    %rsp,%rbp
+  805c1e:	48 83 ec 20          	sub    $0x20,%rsp
+  805c22:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c25:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805c28:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805c2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c2f:	48 89 d6             	mov    %rdx,%rsi
+  805c32:	89 c7                	mov    %eax,%edi
+  805c34:	48 b8 e9 35 80 00 00 	movabs $0x8035e9,%rax
+  805c3b:	00 00 00 
+  805c3e:	ff d0                	call   *%rax
+  805c40:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805c43:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c47:	79 05                	jns    805c4e <consmode+0x34>
+    return r;
+  805c49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c4c:	eb 34                	jmp    805c82 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805c4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c52:	8b 10                	mov    (%rax),%edx
+  805c54:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  805c5b:	00 00 00 
+  805c5e:	8b 00                	mov    (%rax),%eax
+  805c60:	39 c2                	cmp    %eax,%edx
+  805c62:	74 07                	je     805c6b <consmode+0x51>
+    return -E_INVAL;
+  805c64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805c69:	eb 17                	jmp    805c82 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805c6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c6f:	8b 40 0c             	mov    0xc(%rax),%eax
+  805c72:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805c75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c79:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805c7c:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805c7f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805c82:	c9                   	leave
+  805c83:	c3                   	ret
+
+0000000000805c84 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805c84:	55                   	push   %rbp
+  805c85:	48 89 e5             	mov    %rsp,%rbp
+  805c88:	48 83 ec 20          	sub    $0x20,%rsp
+  805c8c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805c90:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805c94:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805c98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805c9c:	8b 50 0c             	mov    0xc(%rax),%edx
+  805c9f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805ca3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ca7:	48 89 ce             	mov    %rcx,%rsi
+  805caa:	48 89 c7             	mov    %rax,%rdi
+  805cad:	48 b8 4c 29 80 00 00 	movabs $0x80294c,%rax
+  805cb4:	00 00 00 
+  805cb7:	ff d0                	call   *%rax
+  805cb9:	48 98                	cltq
+}
+  805cbb:	c9                   	leave
+  805cbc:	c3                   	ret
+
+0000000000805cbd <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805cbd:	55                   	push   %rbp
+  805cbe:	48 89 e5             	mov    %rsp,%rbp
+  805cc1:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805cc8:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805ccf:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805cd6:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805cdd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805ce4:	eb 74                	jmp    805d5a <devcons_write+0x9d>
+    m = n - tot;
+  805ce6:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805ced:	89 c2                	mov    %eax,%edx
+  805cef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805cf2:	29 c2                	sub    %eax,%edx
+  805cf4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805cf7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805cfa:	83 f8 7f             	cmp    $0x7f,%eax
+  805cfd:	76 07                	jbe    805d06 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805cff:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805d06:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805d09:	48 63 d0             	movslq %eax,%rdx
+  805d0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d0f:	48 63 c8             	movslq %eax,%rcx
+  805d12:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805d19:	48 01 c1             	add    %rax,%rcx
+  805d1c:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805d23:	48 89 ce             	mov    %rcx,%rsi
+  805d26:	48 89 c7             	mov    %rax,%rdi
+  805d29:	48 b8 67 1d 80 00 00 	movabs $0x801d67,%rax
+  805d30:	00 00 00 
+  805d33:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805d35:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805d38:	48 63 d0             	movslq %eax,%rdx
+  805d3b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805d42:	48 89 d6             	mov    %rdx,%rsi
+  805d45:	48 89 c7             	mov    %rax,%rdi
+  805d48:	48 b8 db 23 80 00 00 	movabs $0x8023db,%rax
+  805d4f:	00 00 00 
+  805d52:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805d54:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805d57:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805d5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d5d:	48 98                	cltq
+  805d5f:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805d66:	0f 82 7a ff ff ff    	jb     805ce6 <devcons_write+0x29>
+  }
+  return tot;
+  805d6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d6f:	48 98                	cltq
+}
+  805d71:	c9                   	leave
+  805d72:	c3                   	ret
+
+0000000000805d73 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805d73:	55                   	push   %rbp
+  805d74:	48 89 e5             	mov    %rsp,%rbp
+  805d77:	48 83 ec 08          	sub    $0x8,%rsp
+  805d7b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805d7f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d84:	c9                   	leave
+  805d85:	c3                   	ret
+
+0000000000805d86 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805d86:	55                   	push   %rbp
+  805d87:	48 89 e5             	mov    %rsp,%rbp
+  805d8a:	48 83 ec 10          	sub    $0x10,%rsp
+  805d8e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d92:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805d96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d9a:	48 ba 98 71 80 00 00 	movabs $0x807198,%rdx
+  805da1:	00 00 00 
+  805da4:	48 89 d6             	mov    %rdx,%rsi
+  805da7:	48 89 c7             	mov    %rax,%rdi
+  805daa:	48 b8 24 18 80 00 00 	movabs $0x801824,%rax
+  805db1:	00 00 00 
+  805db4:	ff d0                	call   *%rax
+  return 0;
+  805db6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805dbb:	c9                   	leave
+  805dbc:	c3                   	ret
+
+0000000000805dbd <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805dbd:	55                   	push   %rbp
+  805dbe:	48 89 e5             	mov    %rsp,%rbp
+  805dc1:	48 83 ec 30          	sub    $0x30,%rsp
+  805dc5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805dc9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805dcc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805dd0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805dd7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805dda:	83 e0 02             	and    $0x2,%eax
+  805ddd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805de0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805de4:	8b 40 0c             	mov    0xc(%rax),%eax
+  805de7:	83 f8 01             	cmp    $0x1,%eax
+  805dea:	75 04                	jne    805df0 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805dec:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805df0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805df3:	83 e0 01             	and    $0x1,%eax
+  805df6:	85 c0                	test   %eax,%eax
+  805df8:	74 44                	je     805e3e <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805dfa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805dfd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805e02:	89 c2                	mov    %eax,%edx
+  805e04:	be 00 00 00 00       	mov    $0x0,%esi
+  805e09:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e0e:	48 b8 3a 2a 80 00 00 	movabs $0x802a3a,%rax
+  805e15:	00 00 00 
+  805e18:	ff d0                	call   *%rax
+  805e1a:	83 f8 01             	cmp    $0x1,%eax
+  805e1d:	75 06                	jne    805e25 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805e1f:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805e23:	eb 19                	jmp    805e3e <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805e25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e29:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805e2f:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805e32:	89 c2                	mov    %eax,%edx
+  805e34:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e38:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805e3e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805e41:	c9                   	leave
+  805e42:	c3                   	ret
+
+0000000000805e43 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805e43:	55                   	push   %rbp
+  805e44:	48 89 e5             	mov    %rsp,%rbp
+  805e47:	48 83 ec 20          	sub    $0x20,%rsp
+  805e4b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805e4f:	48 b8 79 25 80 00 00 	movabs $0x802579,%rax
+  805e56:	00 00 00 
+  805e59:	ff d0                	call   *%rax
+  805e5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805e5e:	48 b8 40 a1 80 00 00 	movabs $0x80a140,%rax
+  805e65:	00 00 00 
+  805e68:	48 8b 00             	mov    (%rax),%rax
+  805e6b:	48 85 c0             	test   %rax,%rax
+  805e6e:	75 62                	jne    805ed2 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805e70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e73:	ba 07 00 00 00       	mov    $0x7,%edx
+  805e78:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805e7f:	00 00 00 
+  805e82:	48 89 ce             	mov    %rcx,%rsi
+  805e85:	89 c7                	mov    %eax,%edi
+  805e87:	48 b8 f2 25 80 00 00 	movabs $0x8025f2,%rax
+  805e8e:	00 00 00 
+  805e91:	ff d0                	call   *%rax
+  805e93:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805e96:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805e9a:	79 36                	jns    805ed2 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805e9c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805e9f:	89 c1                	mov    %eax,%ecx
+  805ea1:	48 b8 9f 71 80 00 00 	movabs $0x80719f,%rax
+  805ea8:	00 00 00 
+  805eab:	48 89 c2             	mov    %rax,%rdx
+  805eae:	be 23 00 00 00       	mov    $0x23,%esi
+  805eb3:	48 b8 b7 71 80 00 00 	movabs $0x8071b7,%rax
+  805eba:	00 00 00 
+  805ebd:	48 89 c7             	mov    %rax,%rdi
+  805ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ec5:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  805ecc:	00 00 00 
+  805ecf:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805ed2:	48 ba 40 a1 80 00 00 	movabs $0x80a140,%rdx
+  805ed9:	00 00 00 
+  805edc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ee0:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805ee3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ee6:	48 ba 43 5f 80 00 00 	movabs $0x805f43,%rdx
+  805eed:	00 00 00 
+  805ef0:	48 89 d6             	mov    %rdx,%rsi
+  805ef3:	89 c7                	mov    %eax,%edi
+  805ef5:	48 b8 8f 27 80 00 00 	movabs $0x80278f,%rax
+  805efc:	00 00 00 
+  805eff:	ff d0                	call   *%rax
+  805f01:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805f04:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805f08:	79 36                	jns    805f40 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805f0a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805f0d:	89 c1                	mov    %eax,%ecx
+  805f0f:	48 b8 9f 71 80 00 00 	movabs $0x80719f,%rax
+  805f16:	00 00 00 
+  805f19:	48 89 c2             	mov    %rax,%rdx
+  805f1c:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805f21:	48 b8 b7 71 80 00 00 	movabs $0x8071b7,%rax
+  805f28:	00 00 00 
+  805f2b:	48 89 c7             	mov    %rax,%rdi
+  805f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  805f33:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  805f3a:	00 00 00 
+  805f3d:	41 ff d0             	call   *%r8
+}
+  805f40:	90                   	nop
+  805f41:	c9                   	leave
+  805f42:	c3                   	ret
+
+0000000000805f43 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805f43:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805f46:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805f49:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805f50:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805f54:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805f59:	48 a1 40 a1 80 00 00 	movabs 0x80a140,%rax
+  805f60:	00 00 00 
+	call *%rax
+  805f63:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805f65:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805f6a:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805f6d:	41 5f                	pop    %r15
+	popq %r15
+  805f6f:	41 5f                	pop    %r15
+	popq %r15
+  805f71:	41 5f                	pop    %r15
+	popq %r14
+  805f73:	41 5e                	pop    %r14
+	popq %r13
+  805f75:	41 5d                	pop    %r13
+	popq %r12
+  805f77:	41 5c                	pop    %r12
+	popq %r11
+  805f79:	41 5b                	pop    %r11
+	popq %r10
+  805f7b:	41 5a                	pop    %r10
+	popq %r9
+  805f7d:	41 59                	pop    %r9
+	popq %r8
+  805f7f:	41 58                	pop    %r8
+	popq %rsi
+  805f81:	5e                   	pop    %rsi
+	popq %rdi
+  805f82:	5f                   	pop    %rdi
+	popq %rbp
+  805f83:	5d                   	pop    %rbp
+	popq %rdx
+  805f84:	5a                   	pop    %rdx
+	popq %rcx
+  805f85:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805f86:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805f8b:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805f90:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805f94:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805f97:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805f9c:	5b                   	pop    %rbx
+	popq %rax
+  805f9d:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805f9e:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805fa2:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805fa3:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805fa8:	c3                   	ret
+
+0000000000805fa9 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805fa9:	55                   	push   %rbp
+  805faa:	48 89 e5             	mov    %rsp,%rbp
+  805fad:	48 83 ec 20          	sub    $0x20,%rsp
+  805fb1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805fb5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805fb9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805fbd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805fc1:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805fc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805fc9:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805fd0:	48 89 c7             	mov    %rax,%rdi
+  805fd3:	48 b8 e1 5f 80 00 00 	movabs $0x805fe1,%rax
+  805fda:	00 00 00 
+  805fdd:	ff d0                	call   *%rax
+}
+  805fdf:	c9                   	leave
+  805fe0:	c3                   	ret
+
+0000000000805fe1 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805fe1:	55                   	push   %rbp
+  805fe2:	48 89 e5             	mov    %rsp,%rbp
+  805fe5:	48 83 ec 30          	sub    $0x30,%rsp
+  805fe9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805fed:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805ff1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805ff5:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805ff9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805ffe:	75 0e                	jne    80600e <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  806000:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806007:	00 00 00 
+  80600a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  80600e:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  806013:	75 18                	jne    80602d <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  806015:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806019:	48 89 c7             	mov    %rax,%rdi
+  80601c:	48 b8 32 28 80 00 00 	movabs $0x802832,%rax
+  806023:	00 00 00 
+  806026:	ff d0                	call   *%rax
+  806028:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80602b:	eb 1d                	jmp    80604a <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  80602d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806031:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806035:	48 89 d6             	mov    %rdx,%rsi
+  806038:	48 89 c7             	mov    %rax,%rdi
+  80603b:	48 b8 78 28 80 00 00 	movabs $0x802878,%rax
+  806042:	00 00 00 
+  806045:	ff d0                	call   *%rax
+  806047:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  80604a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80604e:	79 2a                	jns    80607a <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  806050:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806055:	74 0a                	je     806061 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  806057:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80605b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  806061:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806066:	74 0a                	je     806072 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  806068:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80606c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  806072:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806075:	e9 aa 00 00 00       	jmp    806124 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  80607a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80607f:	74 36                	je     8060b7 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  806081:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806088:	00 00 00 
+  80608b:	8b 40 04             	mov    0x4(%rax),%eax
+  80608e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806093:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80609a:	00 00 00 
+  80609d:	48 98                	cltq
+  80609f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8060a6:	48 01 d0             	add    %rdx,%rax
+  8060a9:	48 05 24 01 00 00    	add    $0x124,%rax
+  8060af:	8b 10                	mov    (%rax),%edx
+  8060b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060b5:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  8060b7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8060bc:	74 36                	je     8060f4 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  8060be:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8060c5:	00 00 00 
+  8060c8:	8b 40 04             	mov    0x4(%rax),%eax
+  8060cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8060d0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8060d7:	00 00 00 
+  8060da:	48 98                	cltq
+  8060dc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8060e3:	48 01 d0             	add    %rdx,%rax
+  8060e6:	48 05 28 01 00 00    	add    $0x128,%rax
+  8060ec:	8b 10                	mov    (%rax),%edx
+  8060ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060f2:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8060f4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8060fb:	00 00 00 
+  8060fe:	8b 40 04             	mov    0x4(%rax),%eax
+  806101:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806106:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80610d:	00 00 00 
+  806110:	48 98                	cltq
+  806112:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806119:	48 01 d0             	add    %rdx,%rax
+  80611c:	48 05 20 01 00 00    	add    $0x120,%rax
+  806122:	8b 00                	mov    (%rax),%eax
+  }
+}
+  806124:	c9                   	leave
+  806125:	c3                   	ret
+
+0000000000806126 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  806126:	55                   	push   %rbp
+  806127:	48 89 e5             	mov    %rsp,%rbp
+  80612a:	48 83 ec 30          	sub    $0x30,%rsp
+  80612e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806131:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806134:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806138:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80613b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806140:	75 5e                	jne    8061a0 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  806142:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806149:	00 00 00 
+  80614c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806150:	eb 4e                	jmp    8061a0 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  806152:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806156:	79 3c                	jns    806194 <ipc_send+0x6e>
+  806158:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80615c:	74 36                	je     806194 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  80615e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806161:	89 c1                	mov    %eax,%ecx
+  806163:	48 b8 c8 71 80 00 00 	movabs $0x8071c8,%rax
+  80616a:	00 00 00 
+  80616d:	48 89 c2             	mov    %rax,%rdx
+  806170:	be 54 00 00 00       	mov    $0x54,%esi
+  806175:	48 b8 ee 71 80 00 00 	movabs $0x8071ee,%rax
+  80617c:	00 00 00 
+  80617f:	48 89 c7             	mov    %rax,%rdi
+  806182:	b8 00 00 00 00       	mov    $0x0,%eax
+  806187:	49 b8 55 06 80 00 00 	movabs $0x800655,%r8
+  80618e:	00 00 00 
+  806191:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  806194:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  80619b:	00 00 00 
+  80619e:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8061a0:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8061a3:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8061a6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8061aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8061ad:	89 c7                	mov    %eax,%edi
+  8061af:	48 b8 db 27 80 00 00 	movabs $0x8027db,%rax
+  8061b6:	00 00 00 
+  8061b9:	ff d0                	call   *%rax
+  8061bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8061be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8061c2:	75 8e                	jne    806152 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8061c4:	48 b8 b5 25 80 00 00 	movabs $0x8025b5,%rax
+  8061cb:	00 00 00 
+  8061ce:	ff d0                	call   *%rax
+}
+  8061d0:	90                   	nop
+  8061d1:	c9                   	leave
+  8061d2:	c3                   	ret
+
+00000000008061d3 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8061d3:	55                   	push   %rbp
+  8061d4:	48 89 e5             	mov    %rsp,%rbp
+  8061d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8061db:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8061de:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8061e5:	eb 4d                	jmp    806234 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8061e7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8061ee:	00 00 00 
+  8061f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8061f4:	48 98                	cltq
+  8061f6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8061fd:	48 01 d0             	add    %rdx,%rax
+  806200:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  806206:	8b 00                	mov    (%rax),%eax
+  806208:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80620b:	75 23                	jne    806230 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  80620d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806214:	00 00 00 
+  806217:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80621a:	48 98                	cltq
+  80621c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806223:	48 01 d0             	add    %rdx,%rax
+  806226:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80622c:	8b 00                	mov    (%rax),%eax
+  80622e:	eb 12                	jmp    806242 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  806230:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806234:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80623b:	7e aa                	jle    8061e7 <ipc_find_env+0x14>
+  return 0;
+  80623d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806242:	c9                   	leave
+  806243:	c3                   	ret
+
+0000000000806244 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  806244:	55                   	push   %rbp
+  806245:	48 89 e5             	mov    %rsp,%rbp
+  806248:	48 83 ec 18          	sub    $0x18,%rsp
+  80624c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806250:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806254:	48 c1 e8 27          	shr    $0x27,%rax
+  806258:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80625d:	48 89 c2             	mov    %rax,%rdx
+  806260:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  806267:	01 00 00 
+  80626a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80626e:	83 e0 01             	and    $0x1,%eax
+  806271:	48 85 c0             	test   %rax,%rax
+  806274:	74 63                	je     8062d9 <pageref+0x95>
+  806276:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80627a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80627e:	48 89 c2             	mov    %rax,%rdx
+  806281:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  806288:	01 00 00 
+  80628b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80628f:	83 e0 01             	and    $0x1,%eax
+  806292:	48 85 c0             	test   %rax,%rax
+  806295:	74 42                	je     8062d9 <pageref+0x95>
+  806297:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80629b:	48 c1 e8 15          	shr    $0x15,%rax
+  80629f:	48 89 c2             	mov    %rax,%rdx
+  8062a2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8062a9:	01 00 00 
+  8062ac:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8062b0:	83 e0 01             	and    $0x1,%eax
+  8062b3:	48 85 c0             	test   %rax,%rax
+  8062b6:	74 21                	je     8062d9 <pageref+0x95>
+  8062b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062bc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8062c0:	48 89 c2             	mov    %rax,%rdx
+  8062c3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8062ca:	01 00 00 
+  8062cd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8062d1:	83 e0 01             	and    $0x1,%eax
+  8062d4:	48 85 c0             	test   %rax,%rax
+  8062d7:	75 07                	jne    8062e0 <pageref+0x9c>
+    return 0;
+  8062d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8062de:	eb 53                	jmp    806333 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8062e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062e4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8062e8:	48 89 c2             	mov    %rax,%rdx
+  8062eb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8062f2:	01 00 00 
+  8062f5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8062f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8062fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806301:	83 e0 01             	and    $0x1,%eax
+  806304:	48 85 c0             	test   %rax,%rax
+  806307:	75 07                	jne    806310 <pageref+0xcc>
+    return 0;
+  806309:	b8 00 00 00 00       	mov    $0x0,%eax
+  80630e:	eb 23                	jmp    806333 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  806310:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806314:	48 c1 e8 0c          	shr    $0xc,%rax
+  806318:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  80631f:	00 00 00 
+  806322:	48 c1 e0 04          	shl    $0x4,%rax
+  806326:	48 01 d0             	add    %rdx,%rax
+  806329:	48 83 c0 08          	add    $0x8,%rax
+  80632d:	0f b7 00             	movzwl (%rax),%eax
+  806330:	0f b7 c0             	movzwl %ax,%eax
+}
+  806333:	c9                   	leave
+  806334:	c3                   	ret
+
+0000000000806335 <xchg>:
+  806335:	55                   	push   %rbp
+  806336:	48 89 e5             	mov    %rsp,%rbp
+  806339:	48 83 ec 20          	sub    $0x20,%rsp
+  80633d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806341:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806344:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806348:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80634b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80634f:	f0 87 02             	lock xchg %eax,(%rdx)
+  806352:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806355:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806358:	c9                   	leave
+  806359:	c3                   	ret
+
+000000000080635a <cmpxchg>:
+  80635a:	55                   	push   %rbp
+  80635b:	48 89 e5             	mov    %rsp,%rbp
+  80635e:	48 83 ec 20          	sub    $0x20,%rsp
+  806362:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806366:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806369:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  80636c:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  806370:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  806373:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806376:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80637a:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  80637e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806381:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806384:	c9                   	leave
+  806385:	c3                   	ret
+
+0000000000806386 <xadd>:
+  806386:	55                   	push   %rbp
+  806387:	48 89 e5             	mov    %rsp,%rbp
+  80638a:	48 83 ec 10          	sub    $0x10,%rsp
+  80638e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806392:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  806395:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  806399:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80639c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8063a0:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  8063a4:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8063a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8063aa:	c9                   	leave
+  8063ab:	c3                   	ret
+
+00000000008063ac <mutex_init>:
+mutex_init(struct Mutex *m) {
+  8063ac:	55                   	push   %rbp
+  8063ad:	48 89 e5             	mov    %rsp,%rbp
+  8063b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8063b4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  8063b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063bc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8063c2:	90                   	nop
+  8063c3:	c9                   	leave
+  8063c4:	c3                   	ret
+
+00000000008063c5 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  8063c5:	55                   	push   %rbp
+  8063c6:	48 89 e5             	mov    %rsp,%rbp
+  8063c9:	48 83 ec 20          	sub    $0x20,%rsp
+  8063cd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8063d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063d5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8063da:	be 00 00 00 00       	mov    $0x0,%esi
+  8063df:	48 89 c7             	mov    %rax,%rdi
+  8063e2:	48 b8 5a 63 80 00 00 	movabs $0x80635a,%rax
+  8063e9:	00 00 00 
+  8063ec:	ff d0                	call   *%rax
+  8063ee:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8063f1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8063f5:	74 65                	je     80645c <mutex_lock+0x97>
+  if (c != 2)
+  8063f7:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  8063fb:	74 57                	je     806454 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  8063fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806401:	be 02 00 00 00       	mov    $0x2,%esi
+  806406:	48 89 c7             	mov    %rax,%rdi
+  806409:	48 b8 35 63 80 00 00 	movabs $0x806335,%rax
+  806410:	00 00 00 
+  806413:	ff d0                	call   *%rax
+  806415:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806418:	eb 3a                	jmp    806454 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  80641a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80641e:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806425:	be 02 00 00 00       	mov    $0x2,%esi
+  80642a:	48 89 c7             	mov    %rax,%rdi
+  80642d:	48 b8 9e 29 80 00 00 	movabs $0x80299e,%rax
+  806434:	00 00 00 
+  806437:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  806439:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80643d:	be 02 00 00 00       	mov    $0x2,%esi
+  806442:	48 89 c7             	mov    %rax,%rdi
+  806445:	48 b8 35 63 80 00 00 	movabs $0x806335,%rax
+  80644c:	00 00 00 
+  80644f:	ff d0                	call   *%rax
+  806451:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806454:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806458:	75 c0                	jne    80641a <mutex_lock+0x55>
+  80645a:	eb 01                	jmp    80645d <mutex_lock+0x98>
+    return;
+  80645c:	90                   	nop
+}
+  80645d:	c9                   	leave
+  80645e:	c3                   	ret
+
+000000000080645f <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  80645f:	55                   	push   %rbp
+  806460:	48 89 e5             	mov    %rsp,%rbp
+  806463:	48 83 ec 08          	sub    $0x8,%rsp
+  806467:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  80646b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80646f:	ba 01 00 00 00       	mov    $0x1,%edx
+  806474:	be 00 00 00 00       	mov    $0x0,%esi
+  806479:	48 89 c7             	mov    %rax,%rdi
+  80647c:	48 b8 5a 63 80 00 00 	movabs $0x80635a,%rax
+  806483:	00 00 00 
+  806486:	ff d0                	call   *%rax
+  806488:	85 c0                	test   %eax,%eax
+  80648a:	75 07                	jne    806493 <mutex_trylock+0x34>
+  80648c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806491:	eb 05                	jmp    806498 <mutex_trylock+0x39>
+  806493:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806498:	c9                   	leave
+  806499:	c3                   	ret
+
+000000000080649a <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  80649a:	55                   	push   %rbp
+  80649b:	48 89 e5             	mov    %rsp,%rbp
+  80649e:	48 83 ec 10          	sub    $0x10,%rsp
+  8064a2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  8064a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8064af:	48 89 c7             	mov    %rax,%rdi
+  8064b2:	48 b8 35 63 80 00 00 	movabs $0x806335,%rax
+  8064b9:	00 00 00 
+  8064bc:	ff d0                	call   *%rax
+  8064be:	83 f8 02             	cmp    $0x2,%eax
+  8064c1:	75 18                	jne    8064db <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  8064c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064c7:	be 01 00 00 00       	mov    $0x1,%esi
+  8064cc:	48 89 c7             	mov    %rax,%rdi
+  8064cf:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  8064d6:	00 00 00 
+  8064d9:	ff d0                	call   *%rax
+}
+  8064db:	90                   	nop
+  8064dc:	c9                   	leave
+  8064dd:	c3                   	ret
+
+00000000008064de <cond_init>:
+cond_init(struct Cond *c) {
+  8064de:	55                   	push   %rbp
+  8064df:	48 89 e5             	mov    %rsp,%rbp
+  8064e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8064e6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  8064ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064ee:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8064f4:	90                   	nop
+  8064f5:	c9                   	leave
+  8064f6:	c3                   	ret
+
+00000000008064f7 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  8064f7:	55                   	push   %rbp
+  8064f8:	48 89 e5             	mov    %rsp,%rbp
+  8064fb:	48 83 ec 30          	sub    $0x30,%rsp
+  8064ff:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806503:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806507:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  80650b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80650f:	8b 00                	mov    (%rax),%eax
+  806511:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  806514:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806518:	48 89 c7             	mov    %rax,%rdi
+  80651b:	48 b8 9a 64 80 00 00 	movabs $0x80649a,%rax
+  806522:	00 00 00 
+  806525:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  806527:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80652b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80652f:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806532:	89 ce                	mov    %ecx,%esi
+  806534:	48 89 c7             	mov    %rax,%rdi
+  806537:	48 b8 9e 29 80 00 00 	movabs $0x80299e,%rax
+  80653e:	00 00 00 
+  806541:	ff d0                	call   *%rax
+  806543:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  806546:	eb 1f                	jmp    806567 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  806548:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80654c:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806553:	be 02 00 00 00       	mov    $0x2,%esi
+  806558:	48 89 c7             	mov    %rax,%rdi
+  80655b:	48 b8 9e 29 80 00 00 	movabs $0x80299e,%rax
+  806562:	00 00 00 
+  806565:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  806567:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80656b:	be 02 00 00 00       	mov    $0x2,%esi
+  806570:	48 89 c7             	mov    %rax,%rdi
+  806573:	48 b8 35 63 80 00 00 	movabs $0x806335,%rax
+  80657a:	00 00 00 
+  80657d:	ff d0                	call   *%rax
+  80657f:	85 c0                	test   %eax,%eax
+  806581:	75 c5                	jne    806548 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806583:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806587:	75 07                	jne    806590 <cond_timedwait+0x99>
+  806589:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80658e:	eb 05                	jmp    806595 <cond_timedwait+0x9e>
+  806590:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806595:	c9                   	leave
+  806596:	c3                   	ret
+
+0000000000806597 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  806597:	55                   	push   %rbp
+  806598:	48 89 e5             	mov    %rsp,%rbp
+  80659b:	48 83 ec 10          	sub    $0x10,%rsp
+  80659f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8065a3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  8065a7:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8065ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065af:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8065b6:	48 89 ce             	mov    %rcx,%rsi
+  8065b9:	48 89 c7             	mov    %rax,%rdi
+  8065bc:	48 b8 f7 64 80 00 00 	movabs $0x8064f7,%rax
+  8065c3:	00 00 00 
+  8065c6:	ff d0                	call   *%rax
+}
+  8065c8:	90                   	nop
+  8065c9:	c9                   	leave
+  8065ca:	c3                   	ret
+
+00000000008065cb <cond_signal>:
+cond_signal(struct Cond *c) {
+  8065cb:	55                   	push   %rbp
+  8065cc:	48 89 e5             	mov    %rsp,%rbp
+  8065cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8065d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8065d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065db:	be 01 00 00 00       	mov    $0x1,%esi
+  8065e0:	48 89 c7             	mov    %rax,%rdi
+  8065e3:	48 b8 86 63 80 00 00 	movabs $0x806386,%rax
+  8065ea:	00 00 00 
+  8065ed:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  8065ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8065f8:	48 89 c7             	mov    %rax,%rdi
+  8065fb:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  806602:	00 00 00 
+  806605:	ff d0                	call   *%rax
+}
+  806607:	90                   	nop
+  806608:	c9                   	leave
+  806609:	c3                   	ret
+
+000000000080660a <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  80660a:	55                   	push   %rbp
+  80660b:	48 89 e5             	mov    %rsp,%rbp
+  80660e:	48 83 ec 10          	sub    $0x10,%rsp
+  806612:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  806616:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80661a:	be 01 00 00 00       	mov    $0x1,%esi
+  80661f:	48 89 c7             	mov    %rax,%rdi
+  806622:	48 b8 86 63 80 00 00 	movabs $0x806386,%rax
+  806629:	00 00 00 
+  80662c:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  80662e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806632:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  806637:	48 89 c7             	mov    %rax,%rdi
+  80663a:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  806641:	00 00 00 
+  806644:	ff d0                	call   *%rax
+}
+  806646:	90                   	nop
+  806647:	c9                   	leave
+  806648:	c3                   	ret
+
+0000000000806649 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  806649:	55                   	push   %rbp
+  80664a:	48 89 e5             	mov    %rsp,%rbp
+  80664d:	48 83 ec 10          	sub    $0x10,%rsp
+  806651:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806655:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  806658:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80665c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80665f:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  806661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806665:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  80666c:	90                   	nop
+  80666d:	c9                   	leave
+  80666e:	c3                   	ret
+
+000000000080666f <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  80666f:	55                   	push   %rbp
+  806670:	48 89 e5             	mov    %rsp,%rbp
+  806673:	48 83 ec 18          	sub    $0x18,%rsp
+  806677:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  80667b:	eb 2a                	jmp    8066a7 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  80667d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806680:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806683:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806687:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  80668a:	89 ce                	mov    %ecx,%esi
+  80668c:	48 89 c7             	mov    %rax,%rdi
+  80668f:	48 b8 5a 63 80 00 00 	movabs $0x80635a,%rax
+  806696:	00 00 00 
+  806699:	ff d0                	call   *%rax
+  80669b:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  80669e:	75 07                	jne    8066a7 <sem_trywait+0x38>
+      return 0;
+  8066a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066a5:	eb 14                	jmp    8066bb <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  8066a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8066ab:	8b 00                	mov    (%rax),%eax
+  8066ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8066b0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8066b4:	75 c7                	jne    80667d <sem_trywait+0xe>
+  return -E_BUSY;
+  8066b6:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  8066bb:	c9                   	leave
+  8066bc:	c3                   	ret
+
+00000000008066bd <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  8066bd:	55                   	push   %rbp
+  8066be:	48 89 e5             	mov    %rsp,%rbp
+  8066c1:	48 83 ec 30          	sub    $0x30,%rsp
+  8066c5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8066c9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  8066cd:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8066d4:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  8066d5:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8066da:	0f 84 fb 00 00 00    	je     8067db <sem_timedwait+0x11e>
+  8066e0:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8066e5:	0f 84 f0 00 00 00    	je     8067db <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  8066eb:	48 b8 52 5a 80 00 00 	movabs $0x805a52,%rax
+  8066f2:	00 00 00 
+  8066f5:	ff d0                	call   *%rax
+  8066f7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8066fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066ff:	48 f7 d0             	not    %rax
+  806702:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  806706:	73 0d                	jae    806715 <sem_timedwait+0x58>
+  806708:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80670c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806710:	48 01 d0             	add    %rdx,%rax
+  806713:	eb 07                	jmp    80671c <sem_timedwait+0x5f>
+  806715:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80671c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  806720:	e9 b6 00 00 00       	jmp    8067db <sem_timedwait+0x11e>
+    if (deadline) {
+  806725:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80672a:	74 2d                	je     806759 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  80672c:	48 b8 52 5a 80 00 00 	movabs $0x805a52,%rax
+  806733:	00 00 00 
+  806736:	ff d0                	call   *%rax
+  806738:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80673c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806740:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  806744:	73 0a                	jae    806750 <sem_timedwait+0x93>
+  806746:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80674a:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80674e:	eb 05                	jmp    806755 <sem_timedwait+0x98>
+  806750:	b8 00 00 00 00       	mov    $0x0,%eax
+  806755:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  806759:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80675d:	48 83 c0 04          	add    $0x4,%rax
+  806761:	be 01 00 00 00       	mov    $0x1,%esi
+  806766:	48 89 c7             	mov    %rax,%rdi
+  806769:	48 b8 86 63 80 00 00 	movabs $0x806386,%rax
+  806770:	00 00 00 
+  806773:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  806775:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806779:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80677d:	be 00 00 00 00       	mov    $0x0,%esi
+  806782:	48 89 c7             	mov    %rax,%rdi
+  806785:	48 b8 9e 29 80 00 00 	movabs $0x80299e,%rax
+  80678c:	00 00 00 
+  80678f:	ff d0                	call   *%rax
+  806791:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  806794:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806798:	48 83 c0 04          	add    $0x4,%rax
+  80679c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8067a1:	48 89 c7             	mov    %rax,%rdi
+  8067a4:	48 b8 86 63 80 00 00 	movabs $0x806386,%rax
+  8067ab:	00 00 00 
+  8067ae:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  8067b0:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  8067b4:	75 25                	jne    8067db <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  8067b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8067ba:	48 89 c7             	mov    %rax,%rdi
+  8067bd:	48 b8 6f 66 80 00 00 	movabs $0x80666f,%rax
+  8067c4:	00 00 00 
+  8067c7:	ff d0                	call   *%rax
+  8067c9:	85 c0                	test   %eax,%eax
+  8067cb:	79 07                	jns    8067d4 <sem_timedwait+0x117>
+  8067cd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8067d2:	eb 27                	jmp    8067fb <sem_timedwait+0x13e>
+  8067d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067d9:	eb 20                	jmp    8067fb <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  8067db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8067df:	48 89 c7             	mov    %rax,%rdi
+  8067e2:	48 b8 6f 66 80 00 00 	movabs $0x80666f,%rax
+  8067e9:	00 00 00 
+  8067ec:	ff d0                	call   *%rax
+  8067ee:	85 c0                	test   %eax,%eax
+  8067f0:	0f 88 2f ff ff ff    	js     806725 <sem_timedwait+0x68>
+  return 0;
+  8067f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8067fb:	c9                   	leave
+  8067fc:	c3                   	ret
+
+00000000008067fd <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  8067fd:	55                   	push   %rbp
+  8067fe:	48 89 e5             	mov    %rsp,%rbp
+  806801:	48 83 ec 10          	sub    $0x10,%rsp
+  806805:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  806809:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80680d:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  806814:	48 89 c7             	mov    %rax,%rdi
+  806817:	48 b8 bd 66 80 00 00 	movabs $0x8066bd,%rax
+  80681e:	00 00 00 
+  806821:	ff d0                	call   *%rax
+}
+  806823:	90                   	nop
+  806824:	c9                   	leave
+  806825:	c3                   	ret
+
+0000000000806826 <sem_post>:
+sem_post(struct Semaphore *s) {
+  806826:	55                   	push   %rbp
+  806827:	48 89 e5             	mov    %rsp,%rbp
+  80682a:	48 83 ec 10          	sub    $0x10,%rsp
+  80682e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  806832:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806836:	be 01 00 00 00       	mov    $0x1,%esi
+  80683b:	48 89 c7             	mov    %rax,%rdi
+  80683e:	48 b8 86 63 80 00 00 	movabs $0x806386,%rax
+  806845:	00 00 00 
+  806848:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  80684a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80684e:	8b 40 04             	mov    0x4(%rax),%eax
+  806851:	85 c0                	test   %eax,%eax
+  806853:	74 18                	je     80686d <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  806855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806859:	be 01 00 00 00       	mov    $0x1,%esi
+  80685e:	48 89 c7             	mov    %rax,%rdi
+  806861:	48 b8 ed 29 80 00 00 	movabs $0x8029ed,%rax
+  806868:	00 00 00 
+  80686b:	ff d0                	call   *%rax
+}
+  80686d:	90                   	nop
+  80686e:	c9                   	leave
+  80686f:	c3                   	ret
@@ -0,0 +1,10272 @@
+
+obj/user/testpiperace:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 74 03 00 00       	call   8003a0 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 40          	sub    $0x40,%rsp
+  80003a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80003d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  int p[2], r, pid, i, max;
+  void *va;
+  struct Fd *fd;
+  const volatile struct Env *kid;
+
+  cprintf("testing for dup race...\n");
+  800041:	48 b8 80 66 80 00 00 	movabs $0x806680,%rax
+  800048:	00 00 00 
+  80004b:	48 89 c7             	mov    %rax,%rdi
+  80004e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800053:	48 ba 66 06 80 00 00 	movabs $0x800666,%rdx
+  80005a:	00 00 00 
+  80005d:	ff d2                	call   *%rdx
+  if ((r = pipe_size(p, PIPE_SMALL_BUFSIZ)) < 0)
+  80005f:	48 8d 45 d8          	lea    -0x28(%rbp),%rax
+  800063:	be 20 00 00 00       	mov    $0x20,%esi
+  800068:	48 89 c7             	mov    %rax,%rdi
+  80006b:	48 b8 89 4b 80 00 00 	movabs $0x804b89,%rax
+  800072:	00 00 00 
+  800075:	ff d0                	call   *%rax
+  800077:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80007a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80007e:	79 36                	jns    8000b6 <umain+0x84>
+    panic("pipe: %i", r);
+  800080:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800083:	89 c1                	mov    %eax,%ecx
+  800085:	48 b8 99 66 80 00 00 	movabs $0x806699,%rax
+  80008c:	00 00 00 
+  80008f:	48 89 c2             	mov    %rax,%rdx
+  800092:	be 0c 00 00 00       	mov    $0xc,%esi
+  800097:	48 b8 a2 66 80 00 00 	movabs $0x8066a2,%rax
+  80009e:	00 00 00 
+  8000a1:	48 89 c7             	mov    %rax,%rdi
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  8000b0:	00 00 00 
+  8000b3:	41 ff d0             	call   *%r8
+  max = 200;
+  8000b6:	c7 45 f4 c8 00 00 00 	movl   $0xc8,-0xc(%rbp)
+  if ((r = fork()) < 0)
+  8000bd:	48 b8 7d 32 80 00 00 	movabs $0x80327d,%rax
+  8000c4:	00 00 00 
+  8000c7:	ff d0                	call   *%rax
+  8000c9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8000cc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000d0:	79 36                	jns    800108 <umain+0xd6>
+    panic("fork: %i", r);
+  8000d2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000d5:	89 c1                	mov    %eax,%ecx
+  8000d7:	48 b8 b6 66 80 00 00 	movabs $0x8066b6,%rax
+  8000de:	00 00 00 
+  8000e1:	48 89 c2             	mov    %rax,%rdx
+  8000e4:	be 0f 00 00 00       	mov    $0xf,%esi
+  8000e9:	48 b8 a2 66 80 00 00 	movabs $0x8066a2,%rax
+  8000f0:	00 00 00 
+  8000f3:	48 89 c7             	mov    %rax,%rdi
+  8000f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fb:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  800102:	00 00 00 
+  800105:	41 ff d0             	call   *%r8
+  if (r == 0) {
+  800108:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80010c:	0f 85 8c 00 00 00    	jne    80019e <umain+0x16c>
+    close(p[1]);
+  800112:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800115:	89 c7                	mov    %eax,%edi
+  800117:	48 b8 eb 38 80 00 00 	movabs $0x8038eb,%rax
+  80011e:	00 00 00 
+  800121:	ff d0                	call   *%rax
+    //
+    // If a clock interrupt catches dup between mapping the
+    // fd and mapping the pipe structure, we'll have the same
+    // ref counts, still a no-no.
+    //
+    for (i = 0; i < max; i++) {
+  800123:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80012a:	eb 4f                	jmp    80017b <umain+0x149>
+      if (pipeisclosed(p[0])) {
+  80012c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80012f:	89 c7                	mov    %eax,%edi
+  800131:	48 b8 af 4f 80 00 00 	movabs $0x804faf,%rax
+  800138:	00 00 00 
+  80013b:	ff d0                	call   *%rax
+  80013d:	85 c0                	test   %eax,%eax
+  80013f:	74 2a                	je     80016b <umain+0x139>
+        cprintf("RACE: pipe appears closed\n");
+  800141:	48 b8 bf 66 80 00 00 	movabs $0x8066bf,%rax
+  800148:	00 00 00 
+  80014b:	48 89 c7             	mov    %rax,%rdi
+  80014e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800153:	48 ba 66 06 80 00 00 	movabs $0x800666,%rdx
+  80015a:	00 00 00 
+  80015d:	ff d2                	call   *%rdx
+        exit();
+  80015f:	48 b8 23 04 80 00 00 	movabs $0x800423,%rax
+  800166:	00 00 00 
+  800169:	ff d0                	call   *%rax
+      }
+      sys_yield();
+  80016b:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+    for (i = 0; i < max; i++) {
+  800177:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80017b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80017e:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  800181:	7c a9                	jl     80012c <umain+0xfa>
+    }
+    // do something to be not runnable besides exiting
+    ipc_recv(0, 0, 0);
+  800183:	ba 00 00 00 00       	mov    $0x0,%edx
+  800188:	be 00 00 00 00       	mov    $0x0,%esi
+  80018d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800192:	48 b8 ab 32 80 00 00 	movabs $0x8032ab,%rax
+  800199:	00 00 00 
+  80019c:	ff d0                	call   *%rax
+  }
+  pid = r;
+  80019e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8001a1:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  cprintf("pid is %d\n", pid);
+  8001a4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8001a7:	89 c6                	mov    %eax,%esi
+  8001a9:	48 b8 da 66 80 00 00 	movabs $0x8066da,%rax
+  8001b0:	00 00 00 
+  8001b3:	48 89 c7             	mov    %rax,%rdi
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	48 ba 66 06 80 00 00 	movabs $0x800666,%rdx
+  8001c2:	00 00 00 
+  8001c5:	ff d2                	call   *%rdx
+  va  = 0;
+  8001c7:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  8001ce:	00 
+  kid = &envs[ENVX(pid)];
+  8001cf:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8001d2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d7:	48 98                	cltq
+  8001d9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8001e0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8001e7:	00 00 00 
+  8001ea:	48 01 d0             	add    %rdx,%rax
+  8001ed:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  cprintf("kid is %d\n", (int32_t)(kid - envs));
+  8001f1:	48 b8 00 e0 22 3c 80 	movabs $0x803c22e000,%rax
+  8001f8:	00 00 00 
+  8001fb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001ff:	48 29 c2             	sub    %rax,%rdx
+  800202:	48 c1 fa 03          	sar    $0x3,%rdx
+  800206:	48 b8 85 38 2b 3f 21 	movabs $0x4fcace213f2b3885,%rax
+  80020d:	ce ca 4f 
+  800210:	48 0f af c2          	imul   %rdx,%rax
+  800214:	89 c6                	mov    %eax,%esi
+  800216:	48 b8 e5 66 80 00 00 	movabs $0x8066e5,%rax
+  80021d:	00 00 00 
+  800220:	48 89 c7             	mov    %rax,%rdi
+  800223:	b8 00 00 00 00       	mov    $0x0,%eax
+  800228:	48 ba 66 06 80 00 00 	movabs $0x800666,%rdx
+  80022f:	00 00 00 
+  800232:	ff d2                	call   *%rdx
+  dup(p[0], 10);
+  800234:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800237:	be 0a 00 00 00       	mov    $0xa,%esi
+  80023c:	89 c7                	mov    %eax,%edi
+  80023e:	48 b8 66 39 80 00 00 	movabs $0x803966,%rax
+  800245:	00 00 00 
+  800248:	ff d0                	call   *%rax
+  while (kid->env_status == ENV_RUNNABLE)
+  80024a:	eb 16                	jmp    800262 <umain+0x230>
+    dup(p[0], 10);
+  80024c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80024f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800254:	89 c7                	mov    %eax,%edi
+  800256:	48 b8 66 39 80 00 00 	movabs $0x803966,%rax
+  80025d:	00 00 00 
+  800260:	ff d0                	call   *%rax
+  while (kid->env_status == ENV_RUNNABLE)
+  800262:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800266:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  80026c:	83 f8 02             	cmp    $0x2,%eax
+  80026f:	74 db                	je     80024c <umain+0x21a>
+
+  cprintf("child done with loop\n");
+  800271:	48 b8 f0 66 80 00 00 	movabs $0x8066f0,%rax
+  800278:	00 00 00 
+  80027b:	48 89 c7             	mov    %rax,%rdi
+  80027e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800283:	48 ba 66 06 80 00 00 	movabs $0x800666,%rdx
+  80028a:	00 00 00 
+  80028d:	ff d2                	call   *%rdx
+  if (pipeisclosed(p[0]))
+  80028f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800292:	89 c7                	mov    %eax,%edi
+  800294:	48 b8 af 4f 80 00 00 	movabs $0x804faf,%rax
+  80029b:	00 00 00 
+  80029e:	ff d0                	call   *%rax
+  8002a0:	85 c0                	test   %eax,%eax
+  8002a2:	74 30                	je     8002d4 <umain+0x2a2>
+    panic("somehow the other end of p[0] got closed!");
+  8002a4:	48 b8 08 67 80 00 00 	movabs $0x806708,%rax
+  8002ab:	00 00 00 
+  8002ae:	48 89 c2             	mov    %rax,%rdx
+  8002b1:	be 39 00 00 00       	mov    $0x39,%esi
+  8002b6:	48 b8 a2 66 80 00 00 	movabs $0x8066a2,%rax
+  8002bd:	00 00 00 
+  8002c0:	48 89 c7             	mov    %rax,%rdi
+  8002c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c8:	48 b9 47 04 80 00 00 	movabs $0x800447,%rcx
+  8002cf:	00 00 00 
+  8002d2:	ff d1                	call   *%rcx
+  if ((r = fd_lookup(p[0], &fd)) < 0)
+  8002d4:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8002d7:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8002db:	48 89 d6             	mov    %rdx,%rsi
+  8002de:	89 c7                	mov    %eax,%edi
+  8002e0:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  8002e7:	00 00 00 
+  8002ea:	ff d0                	call   *%rax
+  8002ec:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8002ef:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8002f3:	79 36                	jns    80032b <umain+0x2f9>
+    panic("cannot look up p[0]: %i", r);
+  8002f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8002f8:	89 c1                	mov    %eax,%ecx
+  8002fa:	48 b8 32 67 80 00 00 	movabs $0x806732,%rax
+  800301:	00 00 00 
+  800304:	48 89 c2             	mov    %rax,%rdx
+  800307:	be 3b 00 00 00       	mov    $0x3b,%esi
+  80030c:	48 b8 a2 66 80 00 00 	movabs $0x8066a2,%rax
+  800313:	00 00 00 
+  800316:	48 89 c7             	mov    %rax,%rdi
+  800319:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031e:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  800325:	00 00 00 
+  800328:	41 ff d0             	call   *%r8
+  va = fd2data(fd);
+  80032b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80032f:	48 89 c7             	mov    %rax,%rdi
+  800332:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  800339:	00 00 00 
+  80033c:	ff d0                	call   *%rax
+  80033e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (pageref(va) != 3 + 1)
+  800342:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800346:	48 89 c7             	mov    %rax,%rdi
+  800349:	48 b8 72 4a 80 00 00 	movabs $0x804a72,%rax
+  800350:	00 00 00 
+  800353:	ff d0                	call   *%rax
+  800355:	83 f8 04             	cmp    $0x4,%eax
+  800358:	74 20                	je     80037a <umain+0x348>
+    cprintf("\nchild detected race\n");
+  80035a:	48 b8 4a 67 80 00 00 	movabs $0x80674a,%rax
+  800361:	00 00 00 
+  800364:	48 89 c7             	mov    %rax,%rdi
+  800367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036c:	48 ba 66 06 80 00 00 	movabs $0x800666,%rdx
+  800373:	00 00 00 
+  800376:	ff d2                	call   *%rdx
+  else
+    cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+}
+  800378:	eb 23                	jmp    80039d <umain+0x36b>
+    cprintf("\nrace didn't happen (number of tests: %d)\n", max);
+  80037a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80037d:	89 c6                	mov    %eax,%esi
+  80037f:	48 b8 60 67 80 00 00 	movabs $0x806760,%rax
+  800386:	00 00 00 
+  800389:	48 89 c7             	mov    %rax,%rdi
+  80038c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800391:	48 ba 66 06 80 00 00 	movabs $0x800666,%rdx
+  800398:	00 00 00 
+  80039b:	ff d2                	call   *%rdx
+}
+  80039d:	90                   	nop
+  80039e:	c9                   	leave
+  80039f:	c3                   	ret
+
+00000000008003a0 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8003a0:	55                   	push   %rbp
+  8003a1:	48 89 e5             	mov    %rsp,%rbp
+  8003a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8003a8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003ab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8003af:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8003b6:	00 00 00 
+  8003b9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8003bd:	eb 13                	jmp    8003d2 <libmain+0x32>
+    (*ctor)();
+  8003bf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003c3:	48 8b 10             	mov    (%rax),%rdx
+  8003c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cb:	ff d2                	call   *%rdx
+    ctor++;
+  8003cd:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8003d2:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8003d9:	00 00 00 
+  8003dc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8003e0:	72 dd                	jb     8003bf <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8003e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8003e6:	7e 14                	jle    8003fc <libmain+0x5c>
+    binaryname = argv[0];
+  8003e8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8003ec:	48 8b 00             	mov    (%rax),%rax
+  8003ef:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8003f6:	00 00 00 
+  8003f9:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8003fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800400:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800403:	48 89 d6             	mov    %rdx,%rsi
+  800406:	89 c7                	mov    %eax,%edi
+  800408:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80040f:	00 00 00 
+  800412:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800414:	48 b8 23 04 80 00 00 	movabs $0x800423,%rax
+  80041b:	00 00 00 
+  80041e:	ff d0                	call   *%rax
+#endif
+}
+  800420:	90                   	nop
+  800421:	c9                   	leave
+  800422:	c3                   	ret
+
+0000000000800423 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800423:	55                   	push   %rbp
+  800424:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800427:	48 b8 36 39 80 00 00 	movabs $0x803936,%rax
+  80042e:	00 00 00 
+  800431:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800433:	bf 00 00 00 00       	mov    $0x0,%edi
+  800438:	48 b8 9c 22 80 00 00 	movabs $0x80229c,%rax
+  80043f:	00 00 00 
+  800442:	ff d0                	call   *%rax
+}
+  800444:	90                   	nop
+  800445:	5d                   	pop    %rbp
+  800446:	c3                   	ret
+
+0000000000800447 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800447:	55                   	push   %rbp
+  800448:	48 89 e5             	mov    %rsp,%rbp
+  80044b:	53                   	push   %rbx
+  80044c:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800453:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80045a:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800460:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800467:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80046e:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800475:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80047c:	84 c0                	test   %al,%al
+  80047e:	74 23                	je     8004a3 <_panic+0x5c>
+  800480:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800487:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80048b:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80048f:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800493:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800497:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80049b:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80049f:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8004a3:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8004aa:	00 00 00 
+  8004ad:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8004b4:	00 00 00 
+  8004b7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004bb:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8004c2:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8004c9:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004d0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8004d7:	00 00 00 
+  8004da:	48 8b 18             	mov    (%rax),%rbx
+  8004dd:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  8004e4:	00 00 00 
+  8004e7:	ff d0                	call   *%rax
+  8004e9:	89 c6                	mov    %eax,%esi
+  8004eb:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8004f1:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8004f8:	41 89 d0             	mov    %edx,%r8d
+  8004fb:	48 89 c1             	mov    %rax,%rcx
+  8004fe:	48 89 da             	mov    %rbx,%rdx
+  800501:	48 b8 98 67 80 00 00 	movabs $0x806798,%rax
+  800508:	00 00 00 
+  80050b:	48 89 c7             	mov    %rax,%rdi
+  80050e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800513:	49 b9 66 06 80 00 00 	movabs $0x800666,%r9
+  80051a:	00 00 00 
+  80051d:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800520:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800527:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  80052e:	48 89 d6             	mov    %rdx,%rsi
+  800531:	48 89 c7             	mov    %rax,%rdi
+  800534:	48 b8 db 05 80 00 00 	movabs $0x8005db,%rax
+  80053b:	00 00 00 
+  80053e:	ff d0                	call   *%rax
+  cprintf("\n");
+  800540:	48 b8 bb 67 80 00 00 	movabs $0x8067bb,%rax
+  800547:	00 00 00 
+  80054a:	48 89 c7             	mov    %rax,%rdi
+  80054d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800552:	48 ba 66 06 80 00 00 	movabs $0x800666,%rdx
+  800559:	00 00 00 
+  80055c:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  80055e:	cc                   	int3
+  80055f:	eb fd                	jmp    80055e <_panic+0x117>
+
+0000000000800561 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800561:	55                   	push   %rbp
+  800562:	48 89 e5             	mov    %rsp,%rbp
+  800565:	48 83 ec 10          	sub    $0x10,%rsp
+  800569:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80056c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800570:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800574:	8b 00                	mov    (%rax),%eax
+  800576:	8d 48 01             	lea    0x1(%rax),%ecx
+  800579:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80057d:	89 0a                	mov    %ecx,(%rdx)
+  80057f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800582:	89 d1                	mov    %edx,%ecx
+  800584:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800588:	48 98                	cltq
+  80058a:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80058e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800592:	8b 00                	mov    (%rax),%eax
+  800594:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800599:	75 2c                	jne    8005c7 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80059b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80059f:	8b 00                	mov    (%rax),%eax
+  8005a1:	48 98                	cltq
+  8005a3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005a7:	48 83 c2 08          	add    $0x8,%rdx
+  8005ab:	48 89 c6             	mov    %rax,%rsi
+  8005ae:	48 89 d7             	mov    %rdx,%rdi
+  8005b1:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  8005b8:	00 00 00 
+  8005bb:	ff d0                	call   *%rax
+    b->idx = 0;
+  8005bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005c1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8005c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005cb:	8b 40 04             	mov    0x4(%rax),%eax
+  8005ce:	8d 50 01             	lea    0x1(%rax),%edx
+  8005d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005d5:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8005d8:	90                   	nop
+  8005d9:	c9                   	leave
+  8005da:	c3                   	ret
+
+00000000008005db <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005db:	55                   	push   %rbp
+  8005dc:	48 89 e5             	mov    %rsp,%rbp
+  8005df:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8005e6:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8005ed:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8005f4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8005fb:	00 00 00 
+  b.cnt = 0;
+  8005fe:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800605:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800608:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80060f:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800616:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  80061d:	48 89 c6             	mov    %rax,%rsi
+  800620:	48 b8 61 05 80 00 00 	movabs $0x800561,%rax
+  800627:	00 00 00 
+  80062a:	48 89 c7             	mov    %rax,%rdi
+  80062d:	48 b8 c0 09 80 00 00 	movabs $0x8009c0,%rax
+  800634:	00 00 00 
+  800637:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800639:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80063f:	48 98                	cltq
+  800641:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800648:	48 83 c2 08          	add    $0x8,%rdx
+  80064c:	48 89 c6             	mov    %rax,%rsi
+  80064f:	48 89 d7             	mov    %rdx,%rdi
+  800652:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  800659:	00 00 00 
+  80065c:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80065e:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800664:	c9                   	leave
+  800665:	c3                   	ret
+
+0000000000800666 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800666:	55                   	push   %rbp
+  800667:	48 89 e5             	mov    %rsp,%rbp
+  80066a:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800671:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800678:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80067f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800686:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80068d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800694:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80069b:	84 c0                	test   %al,%al
+  80069d:	74 20                	je     8006bf <cprintf+0x59>
+  80069f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8006a3:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8006a7:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8006ab:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8006af:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8006b3:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8006b7:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8006bb:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8006bf:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8006c6:	00 00 00 
+  8006c9:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8006d0:	00 00 00 
+  8006d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006d7:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8006de:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8006e5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8006ec:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8006f3:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8006fa:	48 89 d6             	mov    %rdx,%rsi
+  8006fd:	48 89 c7             	mov    %rax,%rdi
+  800700:	48 b8 db 05 80 00 00 	movabs $0x8005db,%rax
+  800707:	00 00 00 
+  80070a:	ff d0                	call   *%rax
+  80070c:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800712:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800718:	c9                   	leave
+  800719:	c3                   	ret
+
+000000000080071a <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80071a:	55                   	push   %rbp
+  80071b:	48 89 e5             	mov    %rsp,%rbp
+  80071e:	48 83 ec 30          	sub    $0x30,%rsp
+  800722:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800726:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80072a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80072e:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800731:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800735:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800739:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80073c:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800740:	72 54                	jb     800796 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800742:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800745:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800748:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80074b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80074f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800754:	48 f7 f6             	div    %rsi
+  800757:	49 89 c2             	mov    %rax,%r10
+  80075a:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80075d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800760:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800764:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800768:	41 89 c9             	mov    %ecx,%r9d
+  80076b:	41 89 f8             	mov    %edi,%r8d
+  80076e:	89 d1                	mov    %edx,%ecx
+  800770:	4c 89 d2             	mov    %r10,%rdx
+  800773:	48 89 c7             	mov    %rax,%rdi
+  800776:	48 b8 1a 07 80 00 00 	movabs $0x80071a,%rax
+  80077d:	00 00 00 
+  800780:	ff d0                	call   *%rax
+  800782:	eb 1c                	jmp    8007a0 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800784:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800788:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80078b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80078f:	48 89 d6             	mov    %rdx,%rsi
+  800792:	89 c7                	mov    %eax,%edi
+  800794:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800796:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80079a:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80079e:	7f e4                	jg     800784 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8007a0:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8007a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007ac:	48 f7 f1             	div    %rcx
+  8007af:	48 b8 f0 69 80 00 00 	movabs $0x8069f0,%rax
+  8007b6:	00 00 00 
+  8007b9:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8007bd:	0f be c0             	movsbl %al,%eax
+  8007c0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007c4:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8007c8:	48 89 d6             	mov    %rdx,%rsi
+  8007cb:	89 c7                	mov    %eax,%edi
+  8007cd:	ff d1                	call   *%rcx
+}
+  8007cf:	90                   	nop
+  8007d0:	c9                   	leave
+  8007d1:	c3                   	ret
+
+00000000008007d2 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8007d2:	55                   	push   %rbp
+  8007d3:	48 89 e5             	mov    %rsp,%rbp
+  8007d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8007da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007de:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8007e1:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8007e5:	7e 4b                	jle    800832 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8007e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007eb:	8b 00                	mov    (%rax),%eax
+  8007ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f0:	77 24                	ja     800816 <getuint+0x44>
+  8007f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007f6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007fe:	8b 00                	mov    (%rax),%eax
+  800800:	89 c0                	mov    %eax,%eax
+  800802:	48 01 d0             	add    %rdx,%rax
+  800805:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800809:	8b 12                	mov    (%rdx),%edx
+  80080b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80080e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800812:	89 0a                	mov    %ecx,(%rdx)
+  800814:	eb 14                	jmp    80082a <getuint+0x58>
+  800816:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80081a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80081e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800822:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800826:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80082a:	48 8b 00             	mov    (%rax),%rax
+  80082d:	e9 95 00 00 00       	jmp    8008c7 <getuint+0xf5>
+  else if (lflag)
+  800832:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800836:	74 48                	je     800880 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800838:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80083c:	8b 00                	mov    (%rax),%eax
+  80083e:	83 f8 2f             	cmp    $0x2f,%eax
+  800841:	77 24                	ja     800867 <getuint+0x95>
+  800843:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800847:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80084b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80084f:	8b 00                	mov    (%rax),%eax
+  800851:	89 c0                	mov    %eax,%eax
+  800853:	48 01 d0             	add    %rdx,%rax
+  800856:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80085a:	8b 12                	mov    (%rdx),%edx
+  80085c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80085f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800863:	89 0a                	mov    %ecx,(%rdx)
+  800865:	eb 14                	jmp    80087b <getuint+0xa9>
+  800867:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80086b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80086f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800873:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800877:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80087b:	48 8b 00             	mov    (%rax),%rax
+  80087e:	eb 47                	jmp    8008c7 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800880:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800884:	8b 00                	mov    (%rax),%eax
+  800886:	83 f8 2f             	cmp    $0x2f,%eax
+  800889:	77 24                	ja     8008af <getuint+0xdd>
+  80088b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80088f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800893:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800897:	8b 00                	mov    (%rax),%eax
+  800899:	89 c0                	mov    %eax,%eax
+  80089b:	48 01 d0             	add    %rdx,%rax
+  80089e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008a2:	8b 12                	mov    (%rdx),%edx
+  8008a4:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008ab:	89 0a                	mov    %ecx,(%rdx)
+  8008ad:	eb 14                	jmp    8008c3 <getuint+0xf1>
+  8008af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008b7:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008bf:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008c3:	8b 00                	mov    (%rax),%eax
+  8008c5:	89 c0                	mov    %eax,%eax
+}
+  8008c7:	c9                   	leave
+  8008c8:	c3                   	ret
+
+00000000008008c9 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8008c9:	55                   	push   %rbp
+  8008ca:	48 89 e5             	mov    %rsp,%rbp
+  8008cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8008d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008d5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8008d8:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8008dc:	7e 4b                	jle    800929 <getint+0x60>
+    return va_arg(*ap, long long);
+  8008de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008e2:	8b 00                	mov    (%rax),%eax
+  8008e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e7:	77 24                	ja     80090d <getint+0x44>
+  8008e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ed:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008f5:	8b 00                	mov    (%rax),%eax
+  8008f7:	89 c0                	mov    %eax,%eax
+  8008f9:	48 01 d0             	add    %rdx,%rax
+  8008fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800900:	8b 12                	mov    (%rdx),%edx
+  800902:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800905:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800909:	89 0a                	mov    %ecx,(%rdx)
+  80090b:	eb 14                	jmp    800921 <getint+0x58>
+  80090d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800911:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800915:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800919:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80091d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800921:	48 8b 00             	mov    (%rax),%rax
+  800924:	e9 95 00 00 00       	jmp    8009be <getint+0xf5>
+  else if (lflag)
+  800929:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80092d:	74 48                	je     800977 <getint+0xae>
+    return va_arg(*ap, long);
+  80092f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800933:	8b 00                	mov    (%rax),%eax
+  800935:	83 f8 2f             	cmp    $0x2f,%eax
+  800938:	77 24                	ja     80095e <getint+0x95>
+  80093a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80093e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800942:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800946:	8b 00                	mov    (%rax),%eax
+  800948:	89 c0                	mov    %eax,%eax
+  80094a:	48 01 d0             	add    %rdx,%rax
+  80094d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800951:	8b 12                	mov    (%rdx),%edx
+  800953:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800956:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80095a:	89 0a                	mov    %ecx,(%rdx)
+  80095c:	eb 14                	jmp    800972 <getint+0xa9>
+  80095e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800962:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800966:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80096a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80096e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800972:	48 8b 00             	mov    (%rax),%rax
+  800975:	eb 47                	jmp    8009be <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800977:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80097b:	8b 00                	mov    (%rax),%eax
+  80097d:	83 f8 2f             	cmp    $0x2f,%eax
+  800980:	77 24                	ja     8009a6 <getint+0xdd>
+  800982:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800986:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80098a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80098e:	8b 00                	mov    (%rax),%eax
+  800990:	89 c0                	mov    %eax,%eax
+  800992:	48 01 d0             	add    %rdx,%rax
+  800995:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800999:	8b 12                	mov    (%rdx),%edx
+  80099b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80099e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009a2:	89 0a                	mov    %ecx,(%rdx)
+  8009a4:	eb 14                	jmp    8009ba <getint+0xf1>
+  8009a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009aa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009ae:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009b6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009ba:	8b 00                	mov    (%rax),%eax
+  8009bc:	48 98                	cltq
+}
+  8009be:	c9                   	leave
+  8009bf:	c3                   	ret
+
+00000000008009c0 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8009c0:	55                   	push   %rbp
+  8009c1:	48 89 e5             	mov    %rsp,%rbp
+  8009c4:	41 54                	push   %r12
+  8009c6:	53                   	push   %rbx
+  8009c7:	48 83 ec 60          	sub    $0x60,%rsp
+  8009cb:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8009cf:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8009d3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009d7:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8009db:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8009df:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8009e3:	48 8b 06             	mov    (%rsi),%rax
+  8009e6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  8009ea:	48 89 01             	mov    %rax,(%rcx)
+  8009ed:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  8009f1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  8009f5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8009f9:	eb 17                	jmp    800a12 <vprintfmt+0x52>
+      if (ch == '\0')
+  8009fb:	85 db                	test   %ebx,%ebx
+  8009fd:	0f 84 bf 04 00 00    	je     800ec2 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800a03:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a07:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a0b:	48 89 c6             	mov    %rax,%rsi
+  800a0e:	89 df                	mov    %ebx,%edi
+  800a10:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a12:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a16:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a1a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a1e:	0f b6 00             	movzbl (%rax),%eax
+  800a21:	0f b6 d8             	movzbl %al,%ebx
+  800a24:	83 fb 25             	cmp    $0x25,%ebx
+  800a27:	75 d2                	jne    8009fb <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800a29:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800a2d:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800a34:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800a3b:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800a42:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800a49:	eb 04                	jmp    800a4f <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800a4b:	90                   	nop
+  800a4c:	eb 01                	jmp    800a4f <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800a4e:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800a4f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a53:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a57:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a5b:	0f b6 00             	movzbl (%rax),%eax
+  800a5e:	0f b6 d8             	movzbl %al,%ebx
+  800a61:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800a64:	83 f8 55             	cmp    $0x55,%eax
+  800a67:	0f 87 22 04 00 00    	ja     800e8f <vprintfmt+0x4cf>
+  800a6d:	89 c0                	mov    %eax,%eax
+  800a6f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800a76:	00 
+  800a77:	48 b8 18 6a 80 00 00 	movabs $0x806a18,%rax
+  800a7e:	00 00 00 
+  800a81:	48 01 d0             	add    %rdx,%rax
+  800a84:	48 8b 00             	mov    (%rax),%rax
+  800a87:	ff e0                	jmp    *%rax
+        padc = '-';
+  800a89:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800a8d:	eb c0                	jmp    800a4f <vprintfmt+0x8f>
+        padc = '0';
+  800a8f:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800a93:	eb ba                	jmp    800a4f <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800a95:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a9c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800a9f:	89 d0                	mov    %edx,%eax
+  800aa1:	c1 e0 02             	shl    $0x2,%eax
+  800aa4:	01 d0                	add    %edx,%eax
+  800aa6:	01 c0                	add    %eax,%eax
+  800aa8:	01 d8                	add    %ebx,%eax
+  800aaa:	83 e8 30             	sub    $0x30,%eax
+  800aad:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800ab0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ab4:	0f b6 00             	movzbl (%rax),%eax
+  800ab7:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800aba:	83 fb 2f             	cmp    $0x2f,%ebx
+  800abd:	7e 60                	jle    800b1f <vprintfmt+0x15f>
+  800abf:	83 fb 39             	cmp    $0x39,%ebx
+  800ac2:	7f 5b                	jg     800b1f <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800ac4:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800ac9:	eb d1                	jmp    800a9c <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800acb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ace:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad1:	77 17                	ja     800aea <vprintfmt+0x12a>
+  800ad3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ad7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ada:	89 d2                	mov    %edx,%edx
+  800adc:	48 01 d0             	add    %rdx,%rax
+  800adf:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ae2:	83 c2 08             	add    $0x8,%edx
+  800ae5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ae8:	eb 0c                	jmp    800af6 <vprintfmt+0x136>
+  800aea:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800aee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800af2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800af6:	8b 00                	mov    (%rax),%eax
+  800af8:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800afb:	eb 23                	jmp    800b20 <vprintfmt+0x160>
+        if (width < 0)
+  800afd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b01:	0f 89 44 ff ff ff    	jns    800a4b <vprintfmt+0x8b>
+          width = 0;
+  800b07:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800b0e:	e9 38 ff ff ff       	jmp    800a4b <vprintfmt+0x8b>
+        altflag = 1;
+  800b13:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800b1a:	e9 30 ff ff ff       	jmp    800a4f <vprintfmt+0x8f>
+        goto process_precision;
+  800b1f:	90                   	nop
+        if (width < 0)
+  800b20:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b24:	0f 89 24 ff ff ff    	jns    800a4e <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800b2a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b2d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800b30:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800b37:	e9 12 ff ff ff       	jmp    800a4e <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800b3c:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800b40:	e9 0a ff ff ff       	jmp    800a4f <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800b45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b48:	83 f8 2f             	cmp    $0x2f,%eax
+  800b4b:	77 17                	ja     800b64 <vprintfmt+0x1a4>
+  800b4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b51:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b54:	89 d2                	mov    %edx,%edx
+  800b56:	48 01 d0             	add    %rdx,%rax
+  800b59:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b5c:	83 c2 08             	add    $0x8,%edx
+  800b5f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b62:	eb 0c                	jmp    800b70 <vprintfmt+0x1b0>
+  800b64:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b68:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b6c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b70:	8b 00                	mov    (%rax),%eax
+  800b72:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b76:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b7a:	48 89 d6             	mov    %rdx,%rsi
+  800b7d:	89 c7                	mov    %eax,%edi
+  800b7f:	ff d1                	call   *%rcx
+        break;
+  800b81:	e9 37 03 00 00       	jmp    800ebd <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800b86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b89:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8c:	77 17                	ja     800ba5 <vprintfmt+0x1e5>
+  800b8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b92:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b95:	89 d2                	mov    %edx,%edx
+  800b97:	48 01 d0             	add    %rdx,%rax
+  800b9a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b9d:	83 c2 08             	add    $0x8,%edx
+  800ba0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ba3:	eb 0c                	jmp    800bb1 <vprintfmt+0x1f1>
+  800ba5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ba9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bad:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bb1:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800bb3:	85 db                	test   %ebx,%ebx
+  800bb5:	79 02                	jns    800bb9 <vprintfmt+0x1f9>
+          err = -err;
+  800bb7:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800bb9:	83 fb 15             	cmp    $0x15,%ebx
+  800bbc:	7f 16                	jg     800bd4 <vprintfmt+0x214>
+  800bbe:	48 ba 40 69 80 00 00 	movabs $0x806940,%rdx
+  800bc5:	00 00 00 
+  800bc8:	48 63 c3             	movslq %ebx,%rax
+  800bcb:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800bcf:	4d 85 e4             	test   %r12,%r12
+  800bd2:	75 2e                	jne    800c02 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800bd4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800bd8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bdc:	89 d9                	mov    %ebx,%ecx
+  800bde:	48 ba 01 6a 80 00 00 	movabs $0x806a01,%rdx
+  800be5:	00 00 00 
+  800be8:	48 89 c7             	mov    %rax,%rdi
+  800beb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf0:	49 b8 cc 0e 80 00 00 	movabs $0x800ecc,%r8
+  800bf7:	00 00 00 
+  800bfa:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800bfd:	e9 bb 02 00 00       	jmp    800ebd <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800c02:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c06:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c0a:	4c 89 e1             	mov    %r12,%rcx
+  800c0d:	48 ba 0a 6a 80 00 00 	movabs $0x806a0a,%rdx
+  800c14:	00 00 00 
+  800c17:	48 89 c7             	mov    %rax,%rdi
+  800c1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1f:	49 b8 cc 0e 80 00 00 	movabs $0x800ecc,%r8
+  800c26:	00 00 00 
+  800c29:	41 ff d0             	call   *%r8
+        break;
+  800c2c:	e9 8c 02 00 00       	jmp    800ebd <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800c31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c34:	83 f8 2f             	cmp    $0x2f,%eax
+  800c37:	77 17                	ja     800c50 <vprintfmt+0x290>
+  800c39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c3d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c40:	89 d2                	mov    %edx,%edx
+  800c42:	48 01 d0             	add    %rdx,%rax
+  800c45:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c48:	83 c2 08             	add    $0x8,%edx
+  800c4b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c4e:	eb 0c                	jmp    800c5c <vprintfmt+0x29c>
+  800c50:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c54:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c58:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c5c:	4c 8b 20             	mov    (%rax),%r12
+  800c5f:	4d 85 e4             	test   %r12,%r12
+  800c62:	75 0a                	jne    800c6e <vprintfmt+0x2ae>
+          p = "(null)";
+  800c64:	49 bc 0d 6a 80 00 00 	movabs $0x806a0d,%r12
+  800c6b:	00 00 00 
+        if (width > 0 && padc != '-')
+  800c6e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c72:	7e 78                	jle    800cec <vprintfmt+0x32c>
+  800c74:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800c78:	74 72                	je     800cec <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c7a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800c7d:	48 98                	cltq
+  800c7f:	48 89 c6             	mov    %rax,%rsi
+  800c82:	4c 89 e7             	mov    %r12,%rdi
+  800c85:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  800c8c:	00 00 00 
+  800c8f:	ff d0                	call   *%rax
+  800c91:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800c94:	eb 17                	jmp    800cad <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800c96:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800c9a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800c9e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800ca2:	48 89 d6             	mov    %rdx,%rsi
+  800ca5:	89 c7                	mov    %eax,%edi
+  800ca7:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800ca9:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cad:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cb1:	7f e3                	jg     800c96 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cb3:	eb 37                	jmp    800cec <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800cb5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800cb9:	74 1e                	je     800cd9 <vprintfmt+0x319>
+  800cbb:	83 fb 1f             	cmp    $0x1f,%ebx
+  800cbe:	7e 05                	jle    800cc5 <vprintfmt+0x305>
+  800cc0:	83 fb 7e             	cmp    $0x7e,%ebx
+  800cc3:	7e 14                	jle    800cd9 <vprintfmt+0x319>
+            putch('?', putdat);
+  800cc5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cc9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ccd:	48 89 c6             	mov    %rax,%rsi
+  800cd0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800cd5:	ff d2                	call   *%rdx
+  800cd7:	eb 0f                	jmp    800ce8 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800cd9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cdd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ce1:	48 89 c6             	mov    %rax,%rsi
+  800ce4:	89 df                	mov    %ebx,%edi
+  800ce6:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800ce8:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cec:	4c 89 e0             	mov    %r12,%rax
+  800cef:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800cf3:	0f b6 00             	movzbl (%rax),%eax
+  800cf6:	0f be d8             	movsbl %al,%ebx
+  800cf9:	85 db                	test   %ebx,%ebx
+  800cfb:	74 28                	je     800d25 <vprintfmt+0x365>
+  800cfd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d01:	78 b2                	js     800cb5 <vprintfmt+0x2f5>
+  800d03:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800d07:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d0b:	79 a8                	jns    800cb5 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800d0d:	eb 16                	jmp    800d25 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800d0f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d13:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d17:	48 89 c6             	mov    %rax,%rsi
+  800d1a:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d1f:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800d21:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d25:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d29:	7f e4                	jg     800d0f <vprintfmt+0x34f>
+        break;
+  800d2b:	e9 8d 01 00 00       	jmp    800ebd <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800d30:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d33:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d37:	89 d6                	mov    %edx,%esi
+  800d39:	48 89 c7             	mov    %rax,%rdi
+  800d3c:	48 b8 c9 08 80 00 00 	movabs $0x8008c9,%rax
+  800d43:	00 00 00 
+  800d46:	ff d0                	call   *%rax
+  800d48:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800d4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d50:	48 85 c0             	test   %rax,%rax
+  800d53:	79 1d                	jns    800d72 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800d55:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d59:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d5d:	48 89 c6             	mov    %rax,%rsi
+  800d60:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d65:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800d67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d6b:	48 f7 d8             	neg    %rax
+  800d6e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800d72:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d79:	e9 d2 00 00 00       	jmp    800e50 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800d7e:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d81:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d85:	89 d6                	mov    %edx,%esi
+  800d87:	48 89 c7             	mov    %rax,%rdi
+  800d8a:	48 b8 d2 07 80 00 00 	movabs $0x8007d2,%rax
+  800d91:	00 00 00 
+  800d94:	ff d0                	call   *%rax
+  800d96:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800d9a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800da1:	e9 aa 00 00 00       	jmp    800e50 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800da6:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800da9:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dad:	89 d6                	mov    %edx,%esi
+  800daf:	48 89 c7             	mov    %rax,%rdi
+  800db2:	48 b8 d2 07 80 00 00 	movabs $0x8007d2,%rax
+  800db9:	00 00 00 
+  800dbc:	ff d0                	call   *%rax
+  800dbe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800dc2:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800dc9:	e9 82 00 00 00       	jmp    800e50 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800dce:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800dd2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dd6:	48 89 c6             	mov    %rax,%rsi
+  800dd9:	bf 30 00 00 00       	mov    $0x30,%edi
+  800dde:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800de0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800de4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800de8:	48 89 c6             	mov    %rax,%rsi
+  800deb:	bf 78 00 00 00       	mov    $0x78,%edi
+  800df0:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800df2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df5:	83 f8 2f             	cmp    $0x2f,%eax
+  800df8:	77 17                	ja     800e11 <vprintfmt+0x451>
+  800dfa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800dfe:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e01:	89 d2                	mov    %edx,%edx
+  800e03:	48 01 d0             	add    %rdx,%rax
+  800e06:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e09:	83 c2 08             	add    $0x8,%edx
+  800e0c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e0f:	eb 0c                	jmp    800e1d <vprintfmt+0x45d>
+  800e11:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e15:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e19:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e1d:	48 8b 00             	mov    (%rax),%rax
+  800e20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800e24:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800e2b:	eb 23                	jmp    800e50 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800e2d:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e30:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e34:	89 d6                	mov    %edx,%esi
+  800e36:	48 89 c7             	mov    %rax,%rdi
+  800e39:	48 b8 d2 07 80 00 00 	movabs $0x8007d2,%rax
+  800e40:	00 00 00 
+  800e43:	ff d0                	call   *%rax
+  800e45:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800e49:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800e50:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800e55:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800e58:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800e5b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e5f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800e63:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e67:	45 89 c1             	mov    %r8d,%r9d
+  800e6a:	41 89 f8             	mov    %edi,%r8d
+  800e6d:	48 89 c7             	mov    %rax,%rdi
+  800e70:	48 b8 1a 07 80 00 00 	movabs $0x80071a,%rax
+  800e77:	00 00 00 
+  800e7a:	ff d0                	call   *%rax
+        break;
+  800e7c:	eb 3f                	jmp    800ebd <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800e7e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e82:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e86:	48 89 c6             	mov    %rax,%rsi
+  800e89:	89 df                	mov    %ebx,%edi
+  800e8b:	ff d2                	call   *%rdx
+        break;
+  800e8d:	eb 2e                	jmp    800ebd <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800e8f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e93:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e97:	48 89 c6             	mov    %rax,%rsi
+  800e9a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e9f:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800ea1:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ea6:	eb 05                	jmp    800ead <vprintfmt+0x4ed>
+  800ea8:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ead:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800eb1:	48 83 e8 01          	sub    $0x1,%rax
+  800eb5:	0f b6 00             	movzbl (%rax),%eax
+  800eb8:	3c 25                	cmp    $0x25,%al
+  800eba:	75 ec                	jne    800ea8 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800ebc:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800ebd:	e9 50 fb ff ff       	jmp    800a12 <vprintfmt+0x52>
+        return;
+  800ec2:	90                   	nop
+    }
+  }
+}
+  800ec3:	48 83 c4 60          	add    $0x60,%rsp
+  800ec7:	5b                   	pop    %rbx
+  800ec8:	41 5c                	pop    %r12
+  800eca:	5d                   	pop    %rbp
+  800ecb:	c3                   	ret
+
+0000000000800ecc <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800ecc:	55                   	push   %rbp
+  800ecd:	48 89 e5             	mov    %rsp,%rbp
+  800ed0:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800ed7:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800ede:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800ee5:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800eec:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800ef3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800efa:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f01:	84 c0                	test   %al,%al
+  800f03:	74 20                	je     800f25 <printfmt+0x59>
+  800f05:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f09:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f0d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f11:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f15:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f19:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f1d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f21:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800f25:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f2c:	00 00 00 
+  800f2f:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f36:	00 00 00 
+  800f39:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f3d:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f44:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f4b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800f52:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f59:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f60:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800f67:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f6e:	48 89 c7             	mov    %rax,%rdi
+  800f71:	48 b8 c0 09 80 00 00 	movabs $0x8009c0,%rax
+  800f78:	00 00 00 
+  800f7b:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800f7d:	90                   	nop
+  800f7e:	c9                   	leave
+  800f7f:	c3                   	ret
+
+0000000000800f80 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800f80:	55                   	push   %rbp
+  800f81:	48 89 e5             	mov    %rsp,%rbp
+  800f84:	48 83 ec 10          	sub    $0x10,%rsp
+  800f88:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f8b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800f8f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f93:	8b 40 10             	mov    0x10(%rax),%eax
+  800f96:	8d 50 01             	lea    0x1(%rax),%edx
+  800f99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f9d:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800fa0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fa4:	48 8b 10             	mov    (%rax),%rdx
+  800fa7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fab:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800faf:	48 39 c2             	cmp    %rax,%rdx
+  800fb2:	73 17                	jae    800fcb <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800fb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fb8:	48 8b 00             	mov    (%rax),%rax
+  800fbb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800fbf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800fc3:	48 89 0a             	mov    %rcx,(%rdx)
+  800fc6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800fc9:	88 10                	mov    %dl,(%rax)
+}
+  800fcb:	90                   	nop
+  800fcc:	c9                   	leave
+  800fcd:	c3                   	ret
+
+0000000000800fce <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800fce:	55                   	push   %rbp
+  800fcf:	48 89 e5             	mov    %rsp,%rbp
+  800fd2:	48 83 ec 40          	sub    $0x40,%rsp
+  800fd6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800fda:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800fdd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800fe1:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800fe5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fe9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800fed:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800ff0:	48 98                	cltq
+  800ff2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800ff6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800ffa:	48 01 d0             	add    %rdx,%rax
+  800ffd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801001:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  801008:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80100d:	74 06                	je     801015 <vsnprintf+0x47>
+  80100f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801013:	7f 07                	jg     80101c <vsnprintf+0x4e>
+    return -E_INVAL;
+  801015:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80101a:	eb 32                	jmp    80104e <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  80101c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801020:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801024:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801028:	48 89 c6             	mov    %rax,%rsi
+  80102b:	48 b8 80 0f 80 00 00 	movabs $0x800f80,%rax
+  801032:	00 00 00 
+  801035:	48 89 c7             	mov    %rax,%rdi
+  801038:	48 b8 c0 09 80 00 00 	movabs $0x8009c0,%rax
+  80103f:	00 00 00 
+  801042:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801044:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801048:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  80104b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  80104e:	c9                   	leave
+  80104f:	c3                   	ret
+
+0000000000801050 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801050:	55                   	push   %rbp
+  801051:	48 89 e5             	mov    %rsp,%rbp
+  801054:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80105b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801062:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801068:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80106f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801076:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80107d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801084:	84 c0                	test   %al,%al
+  801086:	74 20                	je     8010a8 <snprintf+0x58>
+  801088:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80108c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801090:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801094:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801098:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80109c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010a0:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010a4:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8010a8:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8010af:	00 00 00 
+  8010b2:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8010b9:	00 00 00 
+  8010bc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010c0:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8010c7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010ce:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  8010d5:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  8010dc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8010e3:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8010e9:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8010f0:	48 89 c7             	mov    %rax,%rdi
+  8010f3:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  8010fa:	00 00 00 
+  8010fd:	ff d0                	call   *%rax
+  8010ff:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801105:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80110b:	c9                   	leave
+  80110c:	c3                   	ret
+
+000000000080110d <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  80110d:	55                   	push   %rbp
+  80110e:	48 89 e5             	mov    %rsp,%rbp
+  801111:	53                   	push   %rbx
+  801112:	48 83 ec 38          	sub    $0x38,%rsp
+  801116:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801119:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80111d:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801121:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801125:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801129:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80112c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801131:	89 d1                	mov    %edx,%ecx
+  801133:	0f a2                	cpuid
+  801135:	89 de                	mov    %ebx,%esi
+  801137:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80113a:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  80113d:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801140:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801143:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801148:	74 09                	je     801153 <cpuid+0x46>
+}
+  80114a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80114e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801151:	89 10                	mov    %edx,(%rax)
+
+  801153:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801158:	74 09                	je     801163 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  80115a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80115e:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801161:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801163:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801168:	74 09                	je     801173 <cpuid+0x66>
+char *
+  80116a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80116e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801171:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801173:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801178:	74 09                	je     801183 <cpuid+0x76>
+  for (; *s; s++)
+  80117a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80117e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801181:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801183:	90                   	nop
+  801184:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801188:	c9                   	leave
+  801189:	c3                   	ret
+
+000000000080118a <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80118a:	55                   	push   %rbp
+  80118b:	48 89 e5             	mov    %rsp,%rbp
+  80118e:	48 83 ec 18          	sub    $0x18,%rsp
+  801192:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801195:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801198:	89 c1                	mov    %eax,%ecx
+  80119a:	0f 01 d0             	xgetbv
+  80119d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011a0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  8011a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011a6:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8011a9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8011ad:	48 09 d0             	or     %rdx,%rax
+#else
+  8011b0:	c9                   	leave
+  8011b1:	c3                   	ret
+
+00000000008011b2 <string_cpu>:
+string_cpu(void) {
+  8011b2:	55                   	push   %rbp
+  8011b3:	48 89 e5             	mov    %rsp,%rbp
+  8011b6:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8011ba:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  8011c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  8011c8:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8011cf:	00 00 00 
+  8011d2:	8b 00                	mov    (%rax),%eax
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	78 11                	js     8011e9 <string_cpu+0x37>
+    return string_features;
+  8011d8:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8011df:	00 00 00 
+  8011e2:	8b 00                	mov    (%rax),%eax
+  8011e4:	e9 df 00 00 00       	jmp    8012c8 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8011e9:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8011ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fd:	48 89 c6             	mov    %rax,%rsi
+  801200:	bf 00 00 00 00       	mov    $0x0,%edi
+  801205:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  80120c:	00 00 00 
+  80120f:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801211:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801214:	83 f8 06             	cmp    $0x6,%eax
+  801217:	76 28                	jbe    801241 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801219:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  80121d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801223:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801228:	48 89 c2             	mov    %rax,%rdx
+  80122b:	be 00 00 00 00       	mov    $0x0,%esi
+  801230:	bf 07 00 00 00       	mov    $0x7,%edi
+  801235:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  80123c:	00 00 00 
+  80123f:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801241:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801244:	25 00 02 00 00       	and    $0x200,%eax
+  801249:	85 c0                	test   %eax,%eax
+  80124b:	74 04                	je     801251 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  80124d:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801251:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801255:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80125b:	48 89 c1             	mov    %rax,%rcx
+  80125e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801263:	be 00 00 00 00       	mov    $0x0,%esi
+  801268:	bf 01 00 00 00       	mov    $0x1,%edi
+  80126d:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  801274:	00 00 00 
+  801277:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801279:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80127c:	83 e0 20             	and    $0x20,%eax
+  80127f:	85 c0                	test   %eax,%eax
+  801281:	74 2a                	je     8012ad <string_cpu+0xfb>
+  801283:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801286:	25 00 00 00 08       	and    $0x8000000,%eax
+  80128b:	85 c0                	test   %eax,%eax
+  80128d:	74 1e                	je     8012ad <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80128f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801294:	48 b8 8a 11 80 00 00 	movabs $0x80118a,%rax
+  80129b:	00 00 00 
+  80129e:	ff d0                	call   *%rax
+  8012a0:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8012a3:	48 83 f8 06          	cmp    $0x6,%rax
+  8012a7:	75 04                	jne    8012ad <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8012a9:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8012ad:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  8012b4:	00 00 00 
+  8012b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012ba:	89 02                	mov    %eax,(%rdx)
+  8012bc:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8012c3:	00 00 00 
+  8012c6:	8b 00                	mov    (%rax),%eax
+}
+  8012c8:	c9                   	leave
+  8012c9:	c3                   	ret
+
+00000000008012ca <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8012ca:	55                   	push   %rbp
+  8012cb:	48 89 e5             	mov    %rsp,%rbp
+  8012ce:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8012d2:	48 83 ec 60          	sub    $0x60,%rsp
+  8012d6:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8012db:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8012e0:	83 e0 1f             	and    $0x1f,%eax
+  8012e3:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8012e7:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8012eb:	48 f7 d8             	neg    %rax
+  8012ee:	48 89 c2             	mov    %rax,%rdx
+  8012f1:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8012f6:	48 01 d0             	add    %rdx,%rax
+  8012f9:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8012fe:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801302:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801308:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80130d:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801311:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801317:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80131b:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80131f:	89 c2                	mov    %eax,%edx
+  801321:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801325:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80132a:	89 c1                	mov    %eax,%ecx
+  80132c:	d3 e6                	shl    %cl,%esi
+  80132e:	89 f0                	mov    %esi,%eax
+  801330:	21 d0                	and    %edx,%eax
+  801332:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801336:	eb 21                	jmp    801359 <strlen_avx2+0x8f>
+    p += 32;
+  801338:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  80133e:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801343:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801347:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80134d:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801351:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801355:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801359:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  80135e:	74 d8                	je     801338 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801360:	31 c0                	xor    %eax,%eax
+  801362:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801368:	48 63 d0             	movslq %eax,%rdx
+  80136b:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801370:	48 01 d0             	add    %rdx,%rax
+  801373:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801378:	c9                   	leave
+  801379:	c3                   	ret
+
+000000000080137a <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80137a:	55                   	push   %rbp
+  80137b:	48 89 e5             	mov    %rsp,%rbp
+  80137e:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801382:	48 83 ec 40          	sub    $0x40,%rsp
+  801386:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80138b:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801390:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801395:	eb 77                	jmp    80140e <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801397:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80139c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8013a0:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8013a4:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013a9:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8013ad:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8013b1:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013b5:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8013b9:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8013be:	74 3c                	je     8013fc <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8013c0:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8013c4:	f7 d0                	not    %eax
+  8013c6:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8013ca:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8013ce:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8013d2:	48 63 d0             	movslq %eax,%rdx
+  8013d5:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013da:	48 01 d0             	add    %rdx,%rax
+  8013dd:	0f b6 00             	movzbl (%rax),%eax
+  8013e0:	0f b6 c0             	movzbl %al,%eax
+  8013e3:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8013e7:	48 63 ca             	movslq %edx,%rcx
+  8013ea:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8013ef:	48 01 ca             	add    %rcx,%rdx
+  8013f2:	0f b6 12             	movzbl (%rdx),%edx
+  8013f5:	0f b6 d2             	movzbl %dl,%edx
+  8013f8:	29 d0                	sub    %edx,%eax
+  8013fa:	eb 6b                	jmp    801467 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8013fc:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801402:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801408:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80140e:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801414:	77 81                	ja     801397 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801416:	eb 42                	jmp    80145a <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801418:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80141d:	0f b6 10             	movzbl (%rax),%edx
+  801420:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801425:	0f b6 00             	movzbl (%rax),%eax
+  801428:	38 c2                	cmp    %al,%dl
+  80142a:	74 1c                	je     801448 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  80142c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801431:	0f b6 00             	movzbl (%rax),%eax
+  801434:	0f b6 c8             	movzbl %al,%ecx
+  801437:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80143c:	0f b6 00             	movzbl (%rax),%eax
+  80143f:	0f b6 d0             	movzbl %al,%edx
+  801442:	89 c8                	mov    %ecx,%eax
+  801444:	29 d0                	sub    %edx,%eax
+  801446:	eb 1f                	jmp    801467 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801448:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80144e:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801454:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80145a:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801460:	75 b6                	jne    801418 <memcmp_avx2+0x9e>
+  return 0;
+  801462:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801467:	c9                   	leave
+  801468:	c3                   	ret
+
+0000000000801469 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801469:	55                   	push   %rbp
+  80146a:	48 89 e5             	mov    %rsp,%rbp
+  80146d:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801471:	48 83 ec 60          	sub    $0x60,%rsp
+  801475:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80147a:	89 f0                	mov    %esi,%eax
+  80147c:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801481:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801485:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80148a:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80148e:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801493:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801499:	eb 47                	jmp    8014e2 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80149b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014a0:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8014a4:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8014a8:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8014ae:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8014b2:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014b6:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8014ba:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8014bf:	74 15                	je     8014d6 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8014c1:	31 c0                	xor    %eax,%eax
+  8014c3:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8014c9:	48 63 d0             	movslq %eax,%rdx
+  8014cc:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014d1:	48 01 d0             	add    %rdx,%rax
+  8014d4:	eb 3d                	jmp    801513 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8014d6:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8014dc:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8014e2:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8014e8:	77 b1                	ja     80149b <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8014ea:	eb 0c                	jmp    8014f8 <memfind_avx2+0x8f>
+  8014ec:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8014f2:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8014f8:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8014fe:	74 0e                	je     80150e <memfind_avx2+0xa5>
+  801500:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801505:	0f b6 00             	movzbl (%rax),%eax
+  801508:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80150c:	75 de                	jne    8014ec <memfind_avx2+0x83>
+  return s;
+  80150e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801513:	c9                   	leave
+  801514:	c3                   	ret
+
+0000000000801515 <strlen>:
+strlen(const char *s) {
+  801515:	55                   	push   %rbp
+  801516:	48 89 e5             	mov    %rsp,%rbp
+  801519:	48 83 ec 40          	sub    $0x40,%rsp
+  80151d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801521:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801525:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801529:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  801530:	00 00 00 
+  801533:	ff d0                	call   *%rax
+  801535:	83 e0 02             	and    $0x2,%eax
+  801538:	85 c0                	test   %eax,%eax
+  80153a:	74 18                	je     801554 <strlen+0x3f>
+    return strlen_avx2(s);
+  80153c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801540:	48 89 c7             	mov    %rax,%rdi
+  801543:	48 b8 ca 12 80 00 00 	movabs $0x8012ca,%rax
+  80154a:	00 00 00 
+  80154d:	ff d0                	call   *%rax
+  80154f:	e9 82 00 00 00       	jmp    8015d6 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801554:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801558:	83 e0 0f             	and    $0xf,%eax
+  80155b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80155e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801561:	48 f7 d8             	neg    %rax
+  801564:	48 89 c2             	mov    %rax,%rdx
+  801567:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80156b:	48 01 d0             	add    %rdx,%rax
+  80156e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801572:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801576:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80157a:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80157f:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801583:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801587:	89 c2                	mov    %eax,%edx
+  801589:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80158c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801591:	89 c1                	mov    %eax,%ecx
+  801593:	d3 e6                	shl    %cl,%esi
+  801595:	89 f0                	mov    %esi,%eax
+  801597:	21 d0                	and    %edx,%eax
+  801599:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80159c:	eb 1d                	jmp    8015bb <strlen+0xa6>
+    p += 16;
+  80159e:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8015a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015a7:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8015ab:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8015b0:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8015b4:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015bb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015bf:	74 dd                	je     80159e <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8015c1:	31 c0                	xor    %eax,%eax
+  8015c3:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8015c8:	48 63 d0             	movslq %eax,%rdx
+  8015cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015cf:	48 01 d0             	add    %rdx,%rax
+  8015d2:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8015d6:	c9                   	leave
+  8015d7:	c3                   	ret
+
+00000000008015d8 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8015d8:	55                   	push   %rbp
+  8015d9:	48 89 e5             	mov    %rsp,%rbp
+  8015dc:	48 83 ec 20          	sub    $0x20,%rsp
+  8015e0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015e4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8015ef:	eb 0e                	jmp    8015ff <strnlen+0x27>
+    n++;
+  8015f1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8015f5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015fa:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8015ff:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801604:	74 0b                	je     801611 <strnlen+0x39>
+  801606:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80160a:	0f b6 00             	movzbl (%rax),%eax
+  80160d:	84 c0                	test   %al,%al
+  80160f:	75 e0                	jne    8015f1 <strnlen+0x19>
+  return n;
+  801611:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801614:	c9                   	leave
+  801615:	c3                   	ret
+
+0000000000801616 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801616:	55                   	push   %rbp
+  801617:	48 89 e5             	mov    %rsp,%rbp
+  80161a:	48 83 ec 20          	sub    $0x20,%rsp
+  80161e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801622:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801626:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80162a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  80162e:	90                   	nop
+  80162f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801633:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801637:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80163b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801643:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801647:	0f b6 12             	movzbl (%rdx),%edx
+  80164a:	88 10                	mov    %dl,(%rax)
+  80164c:	0f b6 00             	movzbl (%rax),%eax
+  80164f:	84 c0                	test   %al,%al
+  801651:	75 dc                	jne    80162f <strcpy+0x19>
+  return ret;
+  801653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801657:	c9                   	leave
+  801658:	c3                   	ret
+
+0000000000801659 <strcat>:
+strcat(char *dst, const char *src) {
+  801659:	55                   	push   %rbp
+  80165a:	48 89 e5             	mov    %rsp,%rbp
+  80165d:	48 83 ec 20          	sub    $0x20,%rsp
+  801661:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801665:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801669:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80166d:	48 89 c7             	mov    %rax,%rdi
+  801670:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  801677:	00 00 00 
+  80167a:	ff d0                	call   *%rax
+  80167c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80167f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801682:	48 63 d0             	movslq %eax,%rdx
+  801685:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801689:	48 01 c2             	add    %rax,%rdx
+  80168c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801690:	48 89 c6             	mov    %rax,%rsi
+  801693:	48 89 d7             	mov    %rdx,%rdi
+  801696:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  80169d:	00 00 00 
+  8016a0:	ff d0                	call   *%rax
+  return dst;
+  8016a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016a6:	c9                   	leave
+  8016a7:	c3                   	ret
+
+00000000008016a8 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8016a8:	55                   	push   %rbp
+  8016a9:	48 89 e5             	mov    %rsp,%rbp
+  8016ac:	48 83 ec 28          	sub    $0x28,%rsp
+  8016b0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016b4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016b8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8016bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8016c4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8016cb:	00 
+  8016cc:	eb 2a                	jmp    8016f8 <strncpy+0x50>
+    *dst++ = *src;
+  8016ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016d2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016d6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8016da:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016de:	0f b6 12             	movzbl (%rdx),%edx
+  8016e1:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8016e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016e7:	0f b6 00             	movzbl (%rax),%eax
+  8016ea:	84 c0                	test   %al,%al
+  8016ec:	74 05                	je     8016f3 <strncpy+0x4b>
+      src++;
+  8016ee:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8016f3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016fc:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801700:	72 cc                	jb     8016ce <strncpy+0x26>
+  return ret;
+  801702:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801706:	c9                   	leave
+  801707:	c3                   	ret
+
+0000000000801708 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801708:	55                   	push   %rbp
+  801709:	48 89 e5             	mov    %rsp,%rbp
+  80170c:	48 83 ec 28          	sub    $0x28,%rsp
+  801710:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801714:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801718:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80171c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801720:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801724:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801729:	74 3d                	je     801768 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80172b:	eb 1d                	jmp    80174a <strlcpy+0x42>
+      *dst++ = *src++;
+  80172d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801731:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801735:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801739:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80173d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801741:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801745:	0f b6 12             	movzbl (%rdx),%edx
+  801748:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80174a:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80174f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801754:	74 0b                	je     801761 <strlcpy+0x59>
+  801756:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80175a:	0f b6 00             	movzbl (%rax),%eax
+  80175d:	84 c0                	test   %al,%al
+  80175f:	75 cc                	jne    80172d <strlcpy+0x25>
+    *dst = '\0';
+  801761:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801765:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801768:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80176c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801770:	c9                   	leave
+  801771:	c3                   	ret
+
+0000000000801772 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801772:	55                   	push   %rbp
+  801773:	48 89 e5             	mov    %rsp,%rbp
+  801776:	48 83 ec 30          	sub    $0x30,%rsp
+  80177a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80177e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801782:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801786:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80178a:	48 89 c7             	mov    %rax,%rdi
+  80178d:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  801794:	00 00 00 
+  801797:	ff d0                	call   *%rax
+  801799:	48 98                	cltq
+  80179b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80179f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8017a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017a7:	48 89 d6             	mov    %rdx,%rsi
+  8017aa:	48 89 c7             	mov    %rax,%rdi
+  8017ad:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  8017b4:	00 00 00 
+  8017b7:	ff d0                	call   *%rax
+  8017b9:	48 98                	cltq
+  8017bb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8017bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c3:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8017c7:	75 10                	jne    8017d9 <strlcat+0x67>
+    return maxlen + srclen;
+  8017c9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8017cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017d1:	48 01 d0             	add    %rdx,%rax
+  8017d4:	e9 86 00 00 00       	jmp    80185f <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8017d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017dd:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8017e1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8017e5:	73 2b                	jae    801812 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8017e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017eb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017ef:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017f7:	48 01 c1             	add    %rax,%rcx
+  8017fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017fe:	48 89 c6             	mov    %rax,%rsi
+  801801:	48 89 cf             	mov    %rcx,%rdi
+  801804:	48 b8 5f 1d 80 00 00 	movabs $0x801d5f,%rax
+  80180b:	00 00 00 
+  80180e:	ff d0                	call   *%rax
+  801810:	eb 42                	jmp    801854 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801812:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801816:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80181a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80181e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801822:	48 01 c1             	add    %rax,%rcx
+  801825:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801829:	48 89 c6             	mov    %rax,%rsi
+  80182c:	48 89 cf             	mov    %rcx,%rdi
+  80182f:	48 b8 5f 1d 80 00 00 	movabs $0x801d5f,%rax
+  801836:	00 00 00 
+  801839:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80183b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80183f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801843:	48 01 d0             	add    %rdx,%rax
+  801846:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80184a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80184e:	48 01 d0             	add    %rdx,%rax
+  801851:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801854:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801858:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80185c:	48 01 d0             	add    %rdx,%rax
+}
+  80185f:	c9                   	leave
+  801860:	c3                   	ret
+
+0000000000801861 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801861:	55                   	push   %rbp
+  801862:	48 89 e5             	mov    %rsp,%rbp
+  801865:	48 83 ec 10          	sub    $0x10,%rsp
+  801869:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80186d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801871:	eb 0a                	jmp    80187d <strcmp+0x1c>
+    p++, q++;
+  801873:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801878:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80187d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801881:	0f b6 00             	movzbl (%rax),%eax
+  801884:	84 c0                	test   %al,%al
+  801886:	74 12                	je     80189a <strcmp+0x39>
+  801888:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80188c:	0f b6 10             	movzbl (%rax),%edx
+  80188f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801893:	0f b6 00             	movzbl (%rax),%eax
+  801896:	38 c2                	cmp    %al,%dl
+  801898:	74 d9                	je     801873 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80189a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80189e:	0f b6 00             	movzbl (%rax),%eax
+  8018a1:	0f b6 d0             	movzbl %al,%edx
+  8018a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018a8:	0f b6 00             	movzbl (%rax),%eax
+  8018ab:	0f b6 c0             	movzbl %al,%eax
+  8018ae:	29 c2                	sub    %eax,%edx
+  8018b0:	89 d0                	mov    %edx,%eax
+}
+  8018b2:	c9                   	leave
+  8018b3:	c3                   	ret
+
+00000000008018b4 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8018b4:	55                   	push   %rbp
+  8018b5:	48 89 e5             	mov    %rsp,%rbp
+  8018b8:	48 83 ec 18          	sub    $0x18,%rsp
+  8018bc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018c0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018c4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8018c8:	eb 0f                	jmp    8018d9 <strncmp+0x25>
+    n--, p++, q++;
+  8018ca:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8018cf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018d4:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8018d9:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018de:	74 1d                	je     8018fd <strncmp+0x49>
+  8018e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e4:	0f b6 00             	movzbl (%rax),%eax
+  8018e7:	84 c0                	test   %al,%al
+  8018e9:	74 12                	je     8018fd <strncmp+0x49>
+  8018eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ef:	0f b6 10             	movzbl (%rax),%edx
+  8018f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018f6:	0f b6 00             	movzbl (%rax),%eax
+  8018f9:	38 c2                	cmp    %al,%dl
+  8018fb:	74 cd                	je     8018ca <strncmp+0x16>
+  if (n == 0)
+  8018fd:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801902:	75 07                	jne    80190b <strncmp+0x57>
+    return 0;
+  801904:	ba 00 00 00 00       	mov    $0x0,%edx
+  801909:	eb 16                	jmp    801921 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80190b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80190f:	0f b6 00             	movzbl (%rax),%eax
+  801912:	0f b6 d0             	movzbl %al,%edx
+  801915:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801919:	0f b6 00             	movzbl (%rax),%eax
+  80191c:	0f b6 c0             	movzbl %al,%eax
+  80191f:	29 c2                	sub    %eax,%edx
+}
+  801921:	89 d0                	mov    %edx,%eax
+  801923:	c9                   	leave
+  801924:	c3                   	ret
+
+0000000000801925 <strchr>:
+strchr(const char *s, char c) {
+  801925:	55                   	push   %rbp
+  801926:	48 89 e5             	mov    %rsp,%rbp
+  801929:	48 83 ec 60          	sub    $0x60,%rsp
+  80192d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801931:	89 f0                	mov    %esi,%eax
+  801933:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801936:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80193a:	83 e0 0f             	and    $0xf,%eax
+  80193d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801940:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801943:	48 f7 d8             	neg    %rax
+  801946:	48 89 c2             	mov    %rax,%rdx
+  801949:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80194d:	48 01 d0             	add    %rdx,%rax
+  801950:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801954:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801958:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80195c:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801960:	66 0f 6e c0          	movd   %eax,%xmm0
+  801964:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801968:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80196c:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801971:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801975:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801979:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80197d:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801981:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801986:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80198b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80198f:	89 c2                	mov    %eax,%edx
+  801991:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801996:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80199b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80199f:	09 c2                	or     %eax,%edx
+  8019a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019a4:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8019a9:	89 c1                	mov    %eax,%ecx
+  8019ab:	d3 e6                	shl    %cl,%esi
+  8019ad:	89 f0                	mov    %esi,%eax
+  8019af:	21 d0                	and    %edx,%eax
+  8019b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8019b4:	eb 34                	jmp    8019ea <strchr+0xc5>
+    p += 16;
+  8019b6:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8019bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019bf:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8019c3:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8019c7:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019cc:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8019d1:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019d5:	89 c2                	mov    %eax,%edx
+  8019d7:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019dc:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8019e1:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019e5:	09 d0                	or     %edx,%eax
+  8019e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8019ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8019ee:	74 c6                	je     8019b6 <strchr+0x91>
+  p += __builtin_ctz(m);
+  8019f0:	31 c0                	xor    %eax,%eax
+  8019f2:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8019f7:	48 98                	cltq
+  8019f9:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8019fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a01:	0f b6 00             	movzbl (%rax),%eax
+  801a04:	84 c0                	test   %al,%al
+  801a06:	74 06                	je     801a0e <strchr+0xe9>
+  801a08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a0c:	eb 05                	jmp    801a13 <strchr+0xee>
+  801a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a13:	c9                   	leave
+  801a14:	c3                   	ret
+
+0000000000801a15 <strfind>:
+strfind(const char *s, char c) {
+  801a15:	55                   	push   %rbp
+  801a16:	48 89 e5             	mov    %rsp,%rbp
+  801a19:	48 83 ec 10          	sub    $0x10,%rsp
+  801a1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a21:	89 f0                	mov    %esi,%eax
+  801a23:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801a26:	eb 11                	jmp    801a39 <strfind+0x24>
+    if (*s == c)
+  801a28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a2c:	0f b6 00             	movzbl (%rax),%eax
+  801a2f:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801a32:	74 12                	je     801a46 <strfind+0x31>
+  for (; *s; s++)
+  801a34:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a3d:	0f b6 00             	movzbl (%rax),%eax
+  801a40:	84 c0                	test   %al,%al
+  801a42:	75 e4                	jne    801a28 <strfind+0x13>
+  801a44:	eb 01                	jmp    801a47 <strfind+0x32>
+      break;
+  801a46:	90                   	nop
+  return (char *)s;
+  801a47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a4b:	c9                   	leave
+  801a4c:	c3                   	ret
+
+0000000000801a4d <memset>:
+memset(void *v, int c, size_t n) {
+  801a4d:	55                   	push   %rbp
+  801a4e:	48 89 e5             	mov    %rsp,%rbp
+  801a51:	48 83 ec 38          	sub    $0x38,%rsp
+  801a55:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a59:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801a5c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801a60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a64:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a68:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a6d:	76 41                	jbe    801ab0 <memset+0x63>
+  801a6f:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  801a76:	00 00 00 
+  801a79:	ff d0                	call   *%rax
+  801a7b:	83 e0 01             	and    $0x1,%eax
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	74 2e                	je     801ab0 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801a82:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a85:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a89:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a8d:	48 89 ce             	mov    %rcx,%rsi
+  801a90:	48 89 f7             	mov    %rsi,%rdi
+  801a93:	48 89 d1             	mov    %rdx,%rcx
+  801a96:	fc                   	cld
+  801a97:	f3 aa                	rep stos %al,%es:(%rdi)
+  801a99:	48 89 ca             	mov    %rcx,%rdx
+  801a9c:	48 89 fe             	mov    %rdi,%rsi
+  801a9f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801aa3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801aa7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aab:	e9 a7 00 00 00       	jmp    801b57 <memset+0x10a>
+  if (n >= 8) {
+  801ab0:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801ab5:	0f 86 87 00 00 00    	jbe    801b42 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801abb:	eb 16                	jmp    801ad3 <memset+0x86>
+      *p++ = c;
+  801abd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ac1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ac5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ac9:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801acc:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801ace:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801ad3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ad7:	83 e0 07             	and    $0x7,%eax
+  801ada:	48 85 c0             	test   %rax,%rax
+  801add:	75 de                	jne    801abd <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801adf:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801ae2:	0f b6 c0             	movzbl %al,%eax
+  801ae5:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801aec:	01 01 01 
+  801aef:	48 0f af c2          	imul   %rdx,%rax
+  801af3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801af7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801afb:	48 c1 e8 03          	shr    $0x3,%rax
+  801aff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801b03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b07:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b0b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b0f:	48 89 ce             	mov    %rcx,%rsi
+  801b12:	48 89 f7             	mov    %rsi,%rdi
+  801b15:	48 89 d1             	mov    %rdx,%rcx
+  801b18:	fc                   	cld
+  801b19:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801b1c:	48 89 ca             	mov    %rcx,%rdx
+  801b1f:	48 89 fe             	mov    %rdi,%rsi
+  801b22:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801b26:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801b2a:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801b2f:	eb 11                	jmp    801b42 <memset+0xf5>
+    *p++ = c;
+  801b31:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b35:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b39:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b3d:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801b40:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801b42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b46:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b4a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b4e:	48 85 c0             	test   %rax,%rax
+  801b51:	75 de                	jne    801b31 <memset+0xe4>
+  return v;
+  801b53:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b57:	c9                   	leave
+  801b58:	c3                   	ret
+
+0000000000801b59 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801b59:	55                   	push   %rbp
+  801b5a:	48 89 e5             	mov    %rsp,%rbp
+  801b5d:	48 83 ec 38          	sub    $0x38,%rsp
+  801b61:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b65:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b69:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801b6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b71:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801b75:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b79:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801b7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b81:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801b85:	0f 83 da 00 00 00    	jae    801c65 <memmove+0x10c>
+  801b8b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b8f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b93:	48 01 d0             	add    %rdx,%rax
+  801b96:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801b9a:	0f 83 c5 00 00 00    	jae    801c65 <memmove+0x10c>
+    s += n;
+  801ba0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ba4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801ba8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bac:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801bb0:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801bb5:	0f 86 94 00 00 00    	jbe    801c4f <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801bbb:	eb 1c                	jmp    801bd9 <memmove+0x80>
+        *--d = *--s;
+  801bbd:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801bc2:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801bc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bcb:	0f b6 10             	movzbl (%rax),%edx
+  801bce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bd2:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801bd4:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801bd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bdd:	83 e0 07             	and    $0x7,%eax
+  801be0:	48 85 c0             	test   %rax,%rax
+  801be3:	75 d8                	jne    801bbd <memmove+0x64>
+      nq = n / 8;
+  801be5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801be9:	48 c1 e8 03          	shr    $0x3,%rax
+  801bed:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801bf1:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801bf6:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801bfb:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801c00:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c08:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c0c:	48 89 cf             	mov    %rcx,%rdi
+  801c0f:	48 89 d6             	mov    %rdx,%rsi
+  801c12:	48 89 c1             	mov    %rax,%rcx
+  801c15:	fd                   	std
+  801c16:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c19:	fc                   	cld
+  801c1a:	48 89 c8             	mov    %rcx,%rax
+  801c1d:	48 89 f2             	mov    %rsi,%rdx
+  801c20:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c24:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c28:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801c2c:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801c31:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801c36:	eb 17                	jmp    801c4f <memmove+0xf6>
+      *--d = *--s;
+  801c38:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801c3d:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801c42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c46:	0f b6 10             	movzbl (%rax),%edx
+  801c49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c4d:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801c4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c53:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c57:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c5b:	48 85 c0             	test   %rax,%rax
+  801c5e:	75 d8                	jne    801c38 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801c60:	e9 f4 00 00 00       	jmp    801d59 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c65:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c6a:	76 46                	jbe    801cb2 <memmove+0x159>
+  801c6c:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  801c73:	00 00 00 
+  801c76:	ff d0                	call   *%rax
+  801c78:	83 e0 01             	and    $0x1,%eax
+  801c7b:	85 c0                	test   %eax,%eax
+  801c7d:	74 33                	je     801cb2 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801c7f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c83:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c8b:	48 89 cf             	mov    %rcx,%rdi
+  801c8e:	48 89 d6             	mov    %rdx,%rsi
+  801c91:	48 89 c1             	mov    %rax,%rcx
+  801c94:	fc                   	cld
+  801c95:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c97:	48 89 c8             	mov    %rcx,%rax
+  801c9a:	48 89 f2             	mov    %rsi,%rdx
+  801c9d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ca1:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ca5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801ca9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cad:	e9 ab 00 00 00       	jmp    801d5d <memmove+0x204>
+    if (n >= 8) {
+  801cb2:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801cb7:	0f 86 8b 00 00 00    	jbe    801d48 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801cbd:	eb 22                	jmp    801ce1 <memmove+0x188>
+        *d++ = *s++;
+  801cbf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cc3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801cc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ccb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ccf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801cd3:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801cd7:	0f b6 12             	movzbl (%rdx),%edx
+  801cda:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801cdc:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801ce1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce5:	83 e0 07             	and    $0x7,%eax
+  801ce8:	48 85 c0             	test   %rax,%rax
+  801ceb:	75 d2                	jne    801cbf <memmove+0x166>
+      nq = n / 8;
+  801ced:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf1:	48 c1 e8 03          	shr    $0x3,%rax
+  801cf5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801cf9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cfd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d01:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d05:	48 89 cf             	mov    %rcx,%rdi
+  801d08:	48 89 d6             	mov    %rdx,%rsi
+  801d0b:	48 89 c1             	mov    %rax,%rcx
+  801d0e:	fc                   	cld
+  801d0f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801d12:	48 89 c8             	mov    %rcx,%rax
+  801d15:	48 89 f2             	mov    %rsi,%rdx
+  801d18:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801d1c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d20:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801d24:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801d29:	eb 1d                	jmp    801d48 <memmove+0x1ef>
+      *d++ = *s++;
+  801d2b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d2f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801d33:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d3b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d3f:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801d43:	0f b6 12             	movzbl (%rdx),%edx
+  801d46:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801d48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d4c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d50:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d54:	48 85 c0             	test   %rax,%rax
+  801d57:	75 d2                	jne    801d2b <memmove+0x1d2>
+  return dst;
+  801d59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801d5d:	c9                   	leave
+  801d5e:	c3                   	ret
+
+0000000000801d5f <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801d5f:	55                   	push   %rbp
+  801d60:	48 89 e5             	mov    %rsp,%rbp
+  801d63:	48 83 ec 18          	sub    $0x18,%rsp
+  801d67:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d6b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d6f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801d73:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d77:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d7f:	48 89 ce             	mov    %rcx,%rsi
+  801d82:	48 89 c7             	mov    %rax,%rdi
+  801d85:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  801d8c:	00 00 00 
+  801d8f:	ff d0                	call   *%rax
+}
+  801d91:	c9                   	leave
+  801d92:	c3                   	ret
+
+0000000000801d93 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801d93:	55                   	push   %rbp
+  801d94:	48 89 e5             	mov    %rsp,%rbp
+  801d97:	48 83 ec 40          	sub    $0x40,%rsp
+  801d9b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d9f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801da3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801da7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801daf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801db3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801db7:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801dbc:	0f 86 a7 00 00 00    	jbe    801e69 <memcmp+0xd6>
+  801dc2:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+  801dce:	83 e0 02             	and    $0x2,%eax
+  801dd1:	85 c0                	test   %eax,%eax
+  801dd3:	0f 84 90 00 00 00    	je     801e69 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801dd9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ddd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801de1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801de5:	48 89 ce             	mov    %rcx,%rsi
+  801de8:	48 89 c7             	mov    %rax,%rdi
+  801deb:	48 b8 7a 13 80 00 00 	movabs $0x80137a,%rax
+  801df2:	00 00 00 
+  801df5:	ff d0                	call   *%rax
+  801df7:	e9 c2 00 00 00       	jmp    801ebe <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801dfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e00:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e04:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801e08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e0c:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e10:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801e14:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801e18:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801e1b:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801e22:	74 36                	je     801e5a <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801e24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e27:	f7 d0                	not    %eax
+  801e29:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801e2d:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801e30:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801e33:	48 63 d0             	movslq %eax,%rdx
+  801e36:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e3a:	48 01 d0             	add    %rdx,%rax
+  801e3d:	0f b6 00             	movzbl (%rax),%eax
+  801e40:	0f b6 c0             	movzbl %al,%eax
+  801e43:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801e46:	48 63 ca             	movslq %edx,%rcx
+  801e49:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e4d:	48 01 ca             	add    %rcx,%rdx
+  801e50:	0f b6 12             	movzbl (%rdx),%edx
+  801e53:	0f b6 d2             	movzbl %dl,%edx
+  801e56:	29 d0                	sub    %edx,%eax
+  801e58:	eb 64                	jmp    801ebe <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801e5a:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801e5f:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801e64:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801e69:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801e6e:	77 8c                	ja     801dfc <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801e70:	eb 36                	jmp    801ea8 <memcmp+0x115>
+    if (*s1 != *s2)
+  801e72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e76:	0f b6 10             	movzbl (%rax),%edx
+  801e79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e7d:	0f b6 00             	movzbl (%rax),%eax
+  801e80:	38 c2                	cmp    %al,%dl
+  801e82:	74 1a                	je     801e9e <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801e84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e88:	0f b6 00             	movzbl (%rax),%eax
+  801e8b:	0f b6 c8             	movzbl %al,%ecx
+  801e8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e92:	0f b6 00             	movzbl (%rax),%eax
+  801e95:	0f b6 d0             	movzbl %al,%edx
+  801e98:	89 c8                	mov    %ecx,%eax
+  801e9a:	29 d0                	sub    %edx,%eax
+  801e9c:	eb 20                	jmp    801ebe <memcmp+0x12b>
+    s1++, s2++;
+  801e9e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ea3:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801ea8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eac:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801eb0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801eb4:	48 85 c0             	test   %rax,%rax
+  801eb7:	75 b9                	jne    801e72 <memcmp+0xdf>
+  }
+
+  return 0;
+  801eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ebe:	c9                   	leave
+  801ebf:	c3                   	ret
+
+0000000000801ec0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801ec0:	55                   	push   %rbp
+  801ec1:	48 89 e5             	mov    %rsp,%rbp
+  801ec4:	48 83 ec 50          	sub    $0x50,%rsp
+  801ec8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801ecc:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801ecf:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801ed3:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ed7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801edb:	48 01 d0             	add    %rdx,%rax
+  801ede:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801ee2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ee5:	66 0f 6e c0          	movd   %eax,%xmm0
+  801ee9:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801eed:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801ef1:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801ef6:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801efa:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801eff:	76 73                	jbe    801f74 <memfind+0xb4>
+  801f01:	48 b8 b2 11 80 00 00 	movabs $0x8011b2,%rax
+  801f08:	00 00 00 
+  801f0b:	ff d0                	call   *%rax
+  801f0d:	83 e0 02             	and    $0x2,%eax
+  801f10:	85 c0                	test   %eax,%eax
+  801f12:	74 60                	je     801f74 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801f14:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f17:	0f b6 c8             	movzbl %al,%ecx
+  801f1a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801f1e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f22:	89 ce                	mov    %ecx,%esi
+  801f24:	48 89 c7             	mov    %rax,%rdi
+  801f27:	48 b8 69 14 80 00 00 	movabs $0x801469,%rax
+  801f2e:	00 00 00 
+  801f31:	ff d0                	call   *%rax
+  801f33:	eb 6c                	jmp    801fa1 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801f35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f39:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801f3d:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801f41:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801f46:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801f4a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f4e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801f51:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801f55:	74 13                	je     801f6a <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801f57:	31 c0                	xor    %eax,%eax
+  801f59:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801f5e:	48 63 d0             	movslq %eax,%rdx
+  801f61:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f65:	48 01 d0             	add    %rdx,%rax
+  801f68:	eb 37                	jmp    801fa1 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801f6a:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801f6f:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801f74:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801f79:	77 ba                	ja     801f35 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801f7b:	eb 13                	jmp    801f90 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801f7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f81:	0f b6 00             	movzbl (%rax),%eax
+  801f84:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801f87:	38 d0                	cmp    %dl,%al
+  801f89:	74 11                	je     801f9c <memfind+0xdc>
+  for (; s < ends; s++)
+  801f8b:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801f90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f94:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801f98:	72 e3                	jb     801f7d <memfind+0xbd>
+  801f9a:	eb 01                	jmp    801f9d <memfind+0xdd>
+      break;
+  801f9c:	90                   	nop
+  return (void *)s;
+  801f9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801fa1:	c9                   	leave
+  801fa2:	c3                   	ret
+
+0000000000801fa3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801fa3:	55                   	push   %rbp
+  801fa4:	48 89 e5             	mov    %rsp,%rbp
+  801fa7:	48 83 ec 38          	sub    $0x38,%rsp
+  801fab:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801faf:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801fb3:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801fb6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801fbd:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801fc4:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801fc5:	eb 05                	jmp    801fcc <strtol+0x29>
+    s++;
+  801fc7:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801fcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fd0:	0f b6 00             	movzbl (%rax),%eax
+  801fd3:	3c 20                	cmp    $0x20,%al
+  801fd5:	74 f0                	je     801fc7 <strtol+0x24>
+  801fd7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fdb:	0f b6 00             	movzbl (%rax),%eax
+  801fde:	3c 09                	cmp    $0x9,%al
+  801fe0:	74 e5                	je     801fc7 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801fe2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fe6:	0f b6 00             	movzbl (%rax),%eax
+  801fe9:	3c 2b                	cmp    $0x2b,%al
+  801feb:	75 07                	jne    801ff4 <strtol+0x51>
+    s++;
+  801fed:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ff2:	eb 17                	jmp    80200b <strtol+0x68>
+  else if (*s == '-')
+  801ff4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ff8:	0f b6 00             	movzbl (%rax),%eax
+  801ffb:	3c 2d                	cmp    $0x2d,%al
+  801ffd:	75 0c                	jne    80200b <strtol+0x68>
+    s++, neg = 1;
+  801fff:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802004:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80200b:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  80200f:	74 06                	je     802017 <strtol+0x74>
+  802011:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802015:	75 28                	jne    80203f <strtol+0x9c>
+  802017:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80201b:	0f b6 00             	movzbl (%rax),%eax
+  80201e:	3c 30                	cmp    $0x30,%al
+  802020:	75 1d                	jne    80203f <strtol+0x9c>
+  802022:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802026:	48 83 c0 01          	add    $0x1,%rax
+  80202a:	0f b6 00             	movzbl (%rax),%eax
+  80202d:	3c 78                	cmp    $0x78,%al
+  80202f:	75 0e                	jne    80203f <strtol+0x9c>
+    s += 2, base = 16;
+  802031:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802036:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  80203d:	eb 2c                	jmp    80206b <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  80203f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802043:	75 19                	jne    80205e <strtol+0xbb>
+  802045:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802049:	0f b6 00             	movzbl (%rax),%eax
+  80204c:	3c 30                	cmp    $0x30,%al
+  80204e:	75 0e                	jne    80205e <strtol+0xbb>
+    s++, base = 8;
+  802050:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802055:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80205c:	eb 0d                	jmp    80206b <strtol+0xc8>
+  else if (base == 0)
+  80205e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802062:	75 07                	jne    80206b <strtol+0xc8>
+    base = 10;
+  802064:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  80206b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80206f:	0f b6 00             	movzbl (%rax),%eax
+  802072:	3c 2f                	cmp    $0x2f,%al
+  802074:	7e 1d                	jle    802093 <strtol+0xf0>
+  802076:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80207a:	0f b6 00             	movzbl (%rax),%eax
+  80207d:	3c 39                	cmp    $0x39,%al
+  80207f:	7f 12                	jg     802093 <strtol+0xf0>
+      dig = *s - '0';
+  802081:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802085:	0f b6 00             	movzbl (%rax),%eax
+  802088:	0f be c0             	movsbl %al,%eax
+  80208b:	83 e8 30             	sub    $0x30,%eax
+  80208e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802091:	eb 4e                	jmp    8020e1 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802093:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802097:	0f b6 00             	movzbl (%rax),%eax
+  80209a:	3c 60                	cmp    $0x60,%al
+  80209c:	7e 1d                	jle    8020bb <strtol+0x118>
+  80209e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020a2:	0f b6 00             	movzbl (%rax),%eax
+  8020a5:	3c 7a                	cmp    $0x7a,%al
+  8020a7:	7f 12                	jg     8020bb <strtol+0x118>
+      dig = *s - 'a' + 10;
+  8020a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ad:	0f b6 00             	movzbl (%rax),%eax
+  8020b0:	0f be c0             	movsbl %al,%eax
+  8020b3:	83 e8 57             	sub    $0x57,%eax
+  8020b6:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8020b9:	eb 26                	jmp    8020e1 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  8020bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020bf:	0f b6 00             	movzbl (%rax),%eax
+  8020c2:	3c 40                	cmp    $0x40,%al
+  8020c4:	7e 47                	jle    80210d <strtol+0x16a>
+  8020c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ca:	0f b6 00             	movzbl (%rax),%eax
+  8020cd:	3c 5a                	cmp    $0x5a,%al
+  8020cf:	7f 3c                	jg     80210d <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  8020d1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020d5:	0f b6 00             	movzbl (%rax),%eax
+  8020d8:	0f be c0             	movsbl %al,%eax
+  8020db:	83 e8 37             	sub    $0x37,%eax
+  8020de:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  8020e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020e4:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8020e7:	7d 23                	jge    80210c <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8020e9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8020ee:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8020f1:	48 98                	cltq
+  8020f3:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8020f8:	48 89 c2             	mov    %rax,%rdx
+  8020fb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020fe:	48 98                	cltq
+  802100:	48 01 d0             	add    %rdx,%rax
+  802103:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  802107:	e9 5f ff ff ff       	jmp    80206b <strtol+0xc8>
+      break;
+  80210c:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  80210d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802112:	74 0b                	je     80211f <strtol+0x17c>
+    *endptr = (char *)s;
+  802114:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802118:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80211c:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  80211f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802123:	74 09                	je     80212e <strtol+0x18b>
+  802125:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802129:	48 f7 d8             	neg    %rax
+  80212c:	eb 04                	jmp    802132 <strtol+0x18f>
+  80212e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802132:	c9                   	leave
+  802133:	c3                   	ret
+
+0000000000802134 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802134:	55                   	push   %rbp
+  802135:	48 89 e5             	mov    %rsp,%rbp
+  802138:	53                   	push   %rbx
+  802139:	48 83 ec 48          	sub    $0x48,%rsp
+  80213d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802141:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802145:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802149:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80214d:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802151:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802155:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802159:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80215d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802161:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802165:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802169:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80216d:	4c 89 c3             	mov    %r8,%rbx
+  802170:	cd 30                	int    $0x30
+  802172:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802176:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80217b:	74 46                	je     8021c3 <syscall+0x8f>
+  80217d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802182:	7e 3f                	jle    8021c3 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802184:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802188:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80218c:	49 89 d0             	mov    %rdx,%r8
+  80218f:	48 89 c1             	mov    %rax,%rcx
+  802192:	48 b8 c8 6c 80 00 00 	movabs $0x806cc8,%rax
+  802199:	00 00 00 
+  80219c:	48 89 c2             	mov    %rax,%rdx
+  80219f:	be 22 00 00 00       	mov    $0x22,%esi
+  8021a4:	48 b8 e7 6c 80 00 00 	movabs $0x806ce7,%rax
+  8021ab:	00 00 00 
+  8021ae:	48 89 c7             	mov    %rax,%rdi
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b6:	49 b9 47 04 80 00 00 	movabs $0x800447,%r9
+  8021bd:	00 00 00 
+  8021c0:	41 ff d1             	call   *%r9
+
+  return ret;
+  8021c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8021c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021cb:	c9                   	leave
+  8021cc:	c3                   	ret
+
+00000000008021cd <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8021cd:	55                   	push   %rbp
+  8021ce:	48 89 e5             	mov    %rsp,%rbp
+  8021d1:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8021d9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8021dd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e9:	6a 00                	push   $0x0
+  8021eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021f7:	48 89 d1             	mov    %rdx,%rcx
+  8021fa:	48 89 c2             	mov    %rax,%rdx
+  8021fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802202:	bf 00 00 00 00       	mov    $0x0,%edi
+  802207:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80220e:	00 00 00 
+  802211:	ff d0                	call   *%rax
+  802213:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802217:	90                   	nop
+  802218:	c9                   	leave
+  802219:	c3                   	ret
+
+000000000080221a <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80221a:	55                   	push   %rbp
+  80221b:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  80221e:	48 83 ec 08          	sub    $0x8,%rsp
+  802222:	6a 00                	push   $0x0
+  802224:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80222a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802230:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802235:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223a:	be 00 00 00 00       	mov    $0x0,%esi
+  80223f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802244:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80224b:	00 00 00 
+  80224e:	ff d0                	call   *%rax
+  802250:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802254:	c9                   	leave
+  802255:	c3                   	ret
+
+0000000000802256 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802256:	55                   	push   %rbp
+  802257:	48 89 e5             	mov    %rsp,%rbp
+  80225a:	48 83 ec 10          	sub    $0x10,%rsp
+  80225e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802261:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802264:	48 98                	cltq
+  802266:	48 83 ec 08          	sub    $0x8,%rsp
+  80226a:	6a 00                	push   $0x0
+  80226c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802272:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802278:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80227d:	48 89 c2             	mov    %rax,%rdx
+  802280:	be 01 00 00 00       	mov    $0x1,%esi
+  802285:	bf 03 00 00 00       	mov    $0x3,%edi
+  80228a:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802291:	00 00 00 
+  802294:	ff d0                	call   *%rax
+  802296:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80229a:	c9                   	leave
+  80229b:	c3                   	ret
+
+000000000080229c <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80229c:	55                   	push   %rbp
+  80229d:	48 89 e5             	mov    %rsp,%rbp
+  8022a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8022a4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8022a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022aa:	48 98                	cltq
+  8022ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8022b0:	6a 00                	push   $0x0
+  8022b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c3:	48 89 c2             	mov    %rax,%rdx
+  8022c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cb:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022d0:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8022d7:	00 00 00 
+  8022da:	ff d0                	call   *%rax
+  8022dc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022e0:	90                   	nop
+  8022e1:	c9                   	leave
+  8022e2:	c3                   	ret
+
+00000000008022e3 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8022e3:	55                   	push   %rbp
+  8022e4:	48 89 e5             	mov    %rsp,%rbp
+  8022e7:	48 83 ec 20          	sub    $0x20,%rsp
+  8022eb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8022ee:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8022f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022f5:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8022f8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022fd:	cd 30                	int    $0x30
+  8022ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802303:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802307:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80230c:	7e 3d                	jle    80234b <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  80230e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802312:	49 89 c0             	mov    %rax,%r8
+  802315:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80231a:	48 b8 c8 6c 80 00 00 	movabs $0x806cc8,%rax
+  802321:	00 00 00 
+  802324:	48 89 c2             	mov    %rax,%rdx
+  802327:	be 49 00 00 00       	mov    $0x49,%esi
+  80232c:	48 b8 e7 6c 80 00 00 	movabs $0x806ce7,%rax
+  802333:	00 00 00 
+  802336:	48 89 c7             	mov    %rax,%rdi
+  802339:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233e:	49 b9 47 04 80 00 00 	movabs $0x800447,%r9
+  802345:	00 00 00 
+  802348:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80234b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802350:	75 13                	jne    802365 <sys_env_wait+0x82>
+  802352:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802357:	74 0c                	je     802365 <sys_env_wait+0x82>
+    *status = st;
+  802359:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80235d:	89 c2                	mov    %eax,%edx
+  80235f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802363:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802365:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802369:	c9                   	leave
+  80236a:	c3                   	ret
+
+000000000080236b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80236b:	55                   	push   %rbp
+  80236c:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80236f:	48 83 ec 08          	sub    $0x8,%rsp
+  802373:	6a 00                	push   $0x0
+  802375:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80237b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802381:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802386:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238b:	be 00 00 00 00       	mov    $0x0,%esi
+  802390:	bf 02 00 00 00       	mov    $0x2,%edi
+  802395:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80239c:	00 00 00 
+  80239f:	ff d0                	call   *%rax
+  8023a1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a5:	c9                   	leave
+  8023a6:	c3                   	ret
+
+00000000008023a7 <sys_yield>:
+
+void
+sys_yield(void) {
+  8023a7:	55                   	push   %rbp
+  8023a8:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8023ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8023af:	6a 00                	push   $0x0
+  8023b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cc:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8023d1:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8023d8:	00 00 00 
+  8023db:	ff d0                	call   *%rax
+  8023dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023e1:	90                   	nop
+  8023e2:	c9                   	leave
+  8023e3:	c3                   	ret
+
+00000000008023e4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8023e4:	55                   	push   %rbp
+  8023e5:	48 89 e5             	mov    %rsp,%rbp
+  8023e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8023ec:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8023ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8023f3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8023f6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023f9:	48 63 c8             	movslq %eax,%rcx
+  8023fc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802400:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802403:	48 98                	cltq
+  802405:	48 83 ec 08          	sub    $0x8,%rsp
+  802409:	6a 00                	push   $0x0
+  80240b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802411:	49 89 c8             	mov    %rcx,%r8
+  802414:	48 89 d1             	mov    %rdx,%rcx
+  802417:	48 89 c2             	mov    %rax,%rdx
+  80241a:	be 01 00 00 00       	mov    $0x1,%esi
+  80241f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802424:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80242b:	00 00 00 
+  80242e:	ff d0                	call   *%rax
+  802430:	48 83 c4 10          	add    $0x10,%rsp
+  802434:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802437:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80243a:	c9                   	leave
+  80243b:	c3                   	ret
+
+000000000080243c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80243c:	55                   	push   %rbp
+  80243d:	48 89 e5             	mov    %rsp,%rbp
+  802440:	48 83 ec 20          	sub    $0x20,%rsp
+  802444:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802447:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80244b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80244e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802452:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802456:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802459:	48 63 c8             	movslq %eax,%rcx
+  80245c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802460:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802463:	48 63 f0             	movslq %eax,%rsi
+  802466:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80246a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80246d:	48 98                	cltq
+  80246f:	48 83 ec 08          	sub    $0x8,%rsp
+  802473:	51                   	push   %rcx
+  802474:	49 89 f9             	mov    %rdi,%r9
+  802477:	49 89 f0             	mov    %rsi,%r8
+  80247a:	48 89 d1             	mov    %rdx,%rcx
+  80247d:	48 89 c2             	mov    %rax,%rdx
+  802480:	be 01 00 00 00       	mov    $0x1,%esi
+  802485:	bf 07 00 00 00       	mov    $0x7,%edi
+  80248a:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802491:	00 00 00 
+  802494:	ff d0                	call   *%rax
+  802496:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249a:	c9                   	leave
+  80249b:	c3                   	ret
+
+000000000080249c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80249c:	55                   	push   %rbp
+  80249d:	48 89 e5             	mov    %rsp,%rbp
+  8024a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024a7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8024ab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024b2:	48 98                	cltq
+  8024b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b8:	6a 00                	push   $0x0
+  8024ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c6:	48 89 d1             	mov    %rdx,%rcx
+  8024c9:	48 89 c2             	mov    %rax,%rdx
+  8024cc:	be 01 00 00 00       	mov    $0x1,%esi
+  8024d1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024d6:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e6:	c9                   	leave
+  8024e7:	c3                   	ret
+
+00000000008024e8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8024e8:	55                   	push   %rbp
+  8024e9:	48 89 e5             	mov    %rsp,%rbp
+  8024ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8024f0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024f3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8024f6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8024f9:	48 63 d0             	movslq %eax,%rdx
+  8024fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024ff:	48 98                	cltq
+  802501:	48 83 ec 08          	sub    $0x8,%rsp
+  802505:	6a 00                	push   $0x0
+  802507:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80250d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802513:	48 89 d1             	mov    %rdx,%rcx
+  802516:	48 89 c2             	mov    %rax,%rdx
+  802519:	be 01 00 00 00       	mov    $0x1,%esi
+  80251e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802523:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80252a:	00 00 00 
+  80252d:	ff d0                	call   *%rax
+  80252f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802533:	c9                   	leave
+  802534:	c3                   	ret
+
+0000000000802535 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802535:	55                   	push   %rbp
+  802536:	48 89 e5             	mov    %rsp,%rbp
+  802539:	48 83 ec 10          	sub    $0x10,%rsp
+  80253d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802540:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802544:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802548:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80254b:	48 98                	cltq
+  80254d:	48 83 ec 08          	sub    $0x8,%rsp
+  802551:	6a 00                	push   $0x0
+  802553:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802559:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80255f:	48 89 d1             	mov    %rdx,%rcx
+  802562:	48 89 c2             	mov    %rax,%rdx
+  802565:	be 01 00 00 00       	mov    $0x1,%esi
+  80256a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80256f:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802576:	00 00 00 
+  802579:	ff d0                	call   *%rax
+  80257b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80257f:	c9                   	leave
+  802580:	c3                   	ret
+
+0000000000802581 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802581:	55                   	push   %rbp
+  802582:	48 89 e5             	mov    %rsp,%rbp
+  802585:	48 83 ec 10          	sub    $0x10,%rsp
+  802589:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80258c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802590:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802594:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802597:	48 98                	cltq
+  802599:	48 83 ec 08          	sub    $0x8,%rsp
+  80259d:	6a 00                	push   $0x0
+  80259f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025ab:	48 89 d1             	mov    %rdx,%rcx
+  8025ae:	48 89 c2             	mov    %rax,%rdx
+  8025b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8025b6:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8025bb:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8025c2:	00 00 00 
+  8025c5:	ff d0                	call   *%rax
+  8025c7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025cb:	c9                   	leave
+  8025cc:	c3                   	ret
+
+00000000008025cd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8025cd:	55                   	push   %rbp
+  8025ce:	48 89 e5             	mov    %rsp,%rbp
+  8025d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8025d5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8025e0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8025e3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8025e6:	48 63 f0             	movslq %eax,%rsi
+  8025e9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8025ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025f4:	48 98                	cltq
+  8025f6:	48 83 ec 08          	sub    $0x8,%rsp
+  8025fa:	6a 00                	push   $0x0
+  8025fc:	49 89 f1             	mov    %rsi,%r9
+  8025ff:	49 89 c8             	mov    %rcx,%r8
+  802602:	48 89 d1             	mov    %rdx,%rcx
+  802605:	48 89 c2             	mov    %rax,%rdx
+  802608:	be 00 00 00 00       	mov    $0x0,%esi
+  80260d:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802612:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802619:	00 00 00 
+  80261c:	ff d0                	call   *%rax
+  80261e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+
+0000000000802624 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802624:	55                   	push   %rbp
+  802625:	48 89 e5             	mov    %rsp,%rbp
+  802628:	48 83 ec 10          	sub    $0x10,%rsp
+  80262c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802630:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802634:	48 83 ec 08          	sub    $0x8,%rsp
+  802638:	6a 00                	push   $0x0
+  80263a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802646:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80264b:	48 89 c2             	mov    %rax,%rdx
+  80264e:	be 01 00 00 00       	mov    $0x1,%esi
+  802653:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802658:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80265f:	00 00 00 
+  802662:	ff d0                	call   *%rax
+  802664:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802668:	c9                   	leave
+  802669:	c3                   	ret
+
+000000000080266a <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80266a:	55                   	push   %rbp
+  80266b:	48 89 e5             	mov    %rsp,%rbp
+  80266e:	48 83 ec 10          	sub    $0x10,%rsp
+  802672:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802676:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80267a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80267e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802682:	48 83 ec 08          	sub    $0x8,%rsp
+  802686:	6a 00                	push   $0x0
+  802688:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80268e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802694:	48 89 d1             	mov    %rdx,%rcx
+  802697:	48 89 c2             	mov    %rax,%rdx
+  80269a:	be 01 00 00 00       	mov    $0x1,%esi
+  80269f:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026a4:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8026ab:	00 00 00 
+  8026ae:	ff d0                	call   *%rax
+  8026b0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026b4:	c9                   	leave
+  8026b5:	c3                   	ret
+
+00000000008026b6 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8026b6:	55                   	push   %rbp
+  8026b7:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8026ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8026be:	6a 00                	push   $0x0
+  8026c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026db:	bf 11 00 00 00       	mov    $0x11,%edi
+  8026e0:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8026e7:	00 00 00 
+  8026ea:	ff d0                	call   *%rax
+  8026ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f0:	c9                   	leave
+  8026f1:	c3                   	ret
+
+00000000008026f2 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8026f2:	55                   	push   %rbp
+  8026f3:	48 89 e5             	mov    %rsp,%rbp
+  8026f6:	48 83 ec 10          	sub    $0x10,%rsp
+  8026fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802702:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802706:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80270a:	48 83 ec 08          	sub    $0x8,%rsp
+  80270e:	6a 00                	push   $0x0
+  802710:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802716:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80271c:	48 89 d1             	mov    %rdx,%rcx
+  80271f:	48 89 c2             	mov    %rax,%rdx
+  802722:	be 00 00 00 00       	mov    $0x0,%esi
+  802727:	bf 12 00 00 00       	mov    $0x12,%edi
+  80272c:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802733:	00 00 00 
+  802736:	ff d0                	call   *%rax
+  802738:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80273c:	c9                   	leave
+  80273d:	c3                   	ret
+
+000000000080273e <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  80273e:	55                   	push   %rbp
+  80273f:	48 89 e5             	mov    %rsp,%rbp
+  802742:	48 83 ec 20          	sub    $0x20,%rsp
+  802746:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80274a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80274e:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802751:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802754:	48 63 c8             	movslq %eax,%rcx
+  802757:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80275b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80275f:	48 83 ec 08          	sub    $0x8,%rsp
+  802763:	6a 00                	push   $0x0
+  802765:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80276b:	49 89 c8             	mov    %rcx,%r8
+  80276e:	48 89 d1             	mov    %rdx,%rcx
+  802771:	48 89 c2             	mov    %rax,%rdx
+  802774:	be 00 00 00 00       	mov    $0x0,%esi
+  802779:	bf 13 00 00 00       	mov    $0x13,%edi
+  80277e:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802785:	00 00 00 
+  802788:	ff d0                	call   *%rax
+  80278a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80278e:	c9                   	leave
+  80278f:	c3                   	ret
+
+0000000000802790 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802790:	55                   	push   %rbp
+  802791:	48 89 e5             	mov    %rsp,%rbp
+  802794:	48 83 ec 20          	sub    $0x20,%rsp
+  802798:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80279c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80279f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8027a3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027a7:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8027aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b2:	6a 00                	push   $0x0
+  8027b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ba:	49 89 c8             	mov    %rcx,%r8
+  8027bd:	48 89 d1             	mov    %rdx,%rcx
+  8027c0:	48 89 c2             	mov    %rax,%rdx
+  8027c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c8:	bf 14 00 00 00       	mov    $0x14,%edi
+  8027cd:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+  8027d9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027dd:	c9                   	leave
+  8027de:	c3                   	ret
+
+00000000008027df <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8027df:	55                   	push   %rbp
+  8027e0:	48 89 e5             	mov    %rsp,%rbp
+  8027e3:	48 83 ec 10          	sub    $0x10,%rsp
+  8027e7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027eb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8027ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8027f1:	48 63 d0             	movslq %eax,%rdx
+  8027f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fc:	6a 00                	push   $0x0
+  8027fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802804:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80280a:	48 89 d1             	mov    %rdx,%rcx
+  80280d:	48 89 c2             	mov    %rax,%rdx
+  802810:	be 00 00 00 00       	mov    $0x0,%esi
+  802815:	bf 15 00 00 00       	mov    $0x15,%edi
+  80281a:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802821:	00 00 00 
+  802824:	ff d0                	call   *%rax
+  802826:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80282a:	c9                   	leave
+  80282b:	c3                   	ret
+
+000000000080282c <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  80282c:	55                   	push   %rbp
+  80282d:	48 89 e5             	mov    %rsp,%rbp
+  802830:	48 83 ec 20          	sub    $0x20,%rsp
+  802834:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802838:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80283b:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  80283e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802842:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802846:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802849:	48 63 c8             	movslq %eax,%rcx
+  80284c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80284f:	48 63 d0             	movslq %eax,%rdx
+  802852:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802856:	48 83 ec 08          	sub    $0x8,%rsp
+  80285a:	6a 00                	push   $0x0
+  80285c:	49 89 f1             	mov    %rsi,%r9
+  80285f:	49 89 c8             	mov    %rcx,%r8
+  802862:	48 89 d1             	mov    %rdx,%rcx
+  802865:	48 89 c2             	mov    %rax,%rdx
+  802868:	be 00 00 00 00       	mov    $0x0,%esi
+  80286d:	bf 16 00 00 00       	mov    $0x16,%edi
+  802872:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802879:	00 00 00 
+  80287c:	ff d0                	call   *%rax
+  80287e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802882:	c9                   	leave
+  802883:	c3                   	ret
+
+0000000000802884 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802884:	55                   	push   %rbp
+  802885:	48 89 e5             	mov    %rsp,%rbp
+  802888:	48 83 ec 30          	sub    $0x30,%rsp
+  80288c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802890:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802894:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802898:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80289c:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8028a0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8028a4:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8028a8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8028ac:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8028b8:	51                   	push   %rcx
+  8028b9:	49 89 f9             	mov    %rdi,%r9
+  8028bc:	49 89 f0             	mov    %rsi,%r8
+  8028bf:	48 89 d1             	mov    %rdx,%rcx
+  8028c2:	48 89 c2             	mov    %rax,%rdx
+  8028c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ca:	bf 17 00 00 00       	mov    $0x17,%edi
+  8028cf:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8028d6:	00 00 00 
+  8028d9:	ff d0                	call   *%rax
+  8028db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028df:	c9                   	leave
+  8028e0:	c3                   	ret
+
+00000000008028e1 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8028e1:	55                   	push   %rbp
+  8028e2:	48 89 e5             	mov    %rsp,%rbp
+  8028e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8028e9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8028ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8028ef:	48 98                	cltq
+  8028f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028f5:	6a 00                	push   $0x0
+  8028f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802903:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802908:	48 89 c2             	mov    %rax,%rdx
+  80290b:	be 00 00 00 00       	mov    $0x0,%esi
+  802910:	bf 18 00 00 00       	mov    $0x18,%edi
+  802915:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80291c:	00 00 00 
+  80291f:	ff d0                	call   *%rax
+  802921:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802925:	90                   	nop
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+
+0000000000802928 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802928:	55                   	push   %rbp
+  802929:	48 89 e5             	mov    %rsp,%rbp
+  80292c:	48 83 ec 30          	sub    $0x30,%rsp
+  802930:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802933:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802937:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80293b:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  80293e:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802941:	48 63 f0             	movslq %eax,%rsi
+  802944:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802948:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80294c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80294f:	48 98                	cltq
+  802951:	48 83 ec 08          	sub    $0x8,%rsp
+  802955:	6a 00                	push   $0x0
+  802957:	49 89 f1             	mov    %rsi,%r9
+  80295a:	49 89 c8             	mov    %rcx,%r8
+  80295d:	48 89 d1             	mov    %rdx,%rcx
+  802960:	48 89 c2             	mov    %rax,%rdx
+  802963:	be 01 00 00 00       	mov    $0x1,%esi
+  802968:	bf 19 00 00 00       	mov    $0x19,%edi
+  80296d:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802974:	00 00 00 
+  802977:	ff d0                	call   *%rax
+  802979:	48 83 c4 10          	add    $0x10,%rsp
+  80297d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802980:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802983:	c9                   	leave
+  802984:	c3                   	ret
+
+0000000000802985 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802985:	55                   	push   %rbp
+  802986:	48 89 e5             	mov    %rsp,%rbp
+  802989:	48 83 ec 20          	sub    $0x20,%rsp
+  80298d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802991:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802995:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802998:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80299b:	48 63 c8             	movslq %eax,%rcx
+  80299e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8029aa:	6a 00                	push   $0x0
+  8029ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029b2:	49 89 c8             	mov    %rcx,%r8
+  8029b5:	48 89 d1             	mov    %rdx,%rcx
+  8029b8:	48 89 c2             	mov    %rax,%rdx
+  8029bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8029c0:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8029c5:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  8029cc:	00 00 00 
+  8029cf:	ff d0                	call   *%rax
+  8029d1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029d5:	c9                   	leave
+  8029d6:	c3                   	ret
+
+00000000008029d7 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8029d7:	55                   	push   %rbp
+  8029d8:	48 89 e5             	mov    %rsp,%rbp
+  8029db:	48 83 ec 20          	sub    $0x20,%rsp
+  8029df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029e7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  8029eb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029ef:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029fb:	6a 00                	push   $0x0
+  8029fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a03:	49 89 c8             	mov    %rcx,%r8
+  802a06:	48 89 d1             	mov    %rdx,%rcx
+  802a09:	48 89 c2             	mov    %rax,%rdx
+  802a0c:	be 01 00 00 00       	mov    $0x1,%esi
+  802a11:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802a16:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802a1d:	00 00 00 
+  802a20:	ff d0                	call   *%rax
+  802a22:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a26:	c9                   	leave
+  802a27:	c3                   	ret
+
+0000000000802a28 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802a28:	55                   	push   %rbp
+  802a29:	48 89 e5             	mov    %rsp,%rbp
+  802a2c:	48 83 ec 30          	sub    $0x30,%rsp
+  802a30:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802a34:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802a38:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802a3b:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802a3f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802a43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a46:	48 63 c8             	movslq %eax,%rcx
+  802a49:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802a4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a51:	48 83 ec 08          	sub    $0x8,%rsp
+  802a55:	6a 00                	push   $0x0
+  802a57:	49 89 f1             	mov    %rsi,%r9
+  802a5a:	49 89 c8             	mov    %rcx,%r8
+  802a5d:	48 89 d1             	mov    %rdx,%rcx
+  802a60:	48 89 c2             	mov    %rax,%rdx
+  802a63:	be 01 00 00 00       	mov    $0x1,%esi
+  802a68:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802a6d:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802a74:	00 00 00 
+  802a77:	ff d0                	call   *%rax
+  802a79:	48 83 c4 10          	add    $0x10,%rsp
+  802a7d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802a80:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a83:	c9                   	leave
+  802a84:	c3                   	ret
+
+0000000000802a85 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802a85:	55                   	push   %rbp
+  802a86:	48 89 e5             	mov    %rsp,%rbp
+  802a89:	48 83 ec 10          	sub    $0x10,%rsp
+  802a8d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802a90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a93:	48 98                	cltq
+  802a95:	48 83 ec 08          	sub    $0x8,%rsp
+  802a99:	6a 00                	push   $0x0
+  802a9b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802aa1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aa7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aac:	48 89 c2             	mov    %rax,%rdx
+  802aaf:	be 01 00 00 00       	mov    $0x1,%esi
+  802ab4:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802ab9:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802ac0:	00 00 00 
+  802ac3:	ff d0                	call   *%rax
+  802ac5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ac9:	c9                   	leave
+  802aca:	c3                   	ret
+
+0000000000802acb <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802acb:	55                   	push   %rbp
+  802acc:	48 89 e5             	mov    %rsp,%rbp
+  802acf:	48 83 ec 40          	sub    $0x40,%rsp
+  802ad3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802ad7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802adb:	48 8b 00             	mov    (%rax),%rax
+  802ade:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802ae2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ae6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802aea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802aee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802af2:	83 e0 02             	and    $0x2,%eax
+  802af5:	48 85 c0             	test   %rax,%rax
+  802af8:	74 25                	je     802b1f <pgfault+0x54>
+  802afa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802afe:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b02:	48 89 c2             	mov    %rax,%rdx
+  802b05:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b0c:	01 00 00 
+  802b0f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b13:	83 e0 02             	and    $0x2,%eax
+  802b16:	48 85 c0             	test   %rax,%rax
+  802b19:	0f 85 fe 01 00 00    	jne    802d1d <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802b1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b23:	83 e0 02             	and    $0x2,%eax
+  802b26:	48 85 c0             	test   %rax,%rax
+  802b29:	74 23                	je     802b4e <pgfault+0x83>
+  802b2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b2f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b33:	48 89 c2             	mov    %rax,%rdx
+  802b36:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b3d:	01 00 00 
+  802b40:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b44:	25 00 08 00 00       	and    $0x800,%eax
+  802b49:	48 85 c0             	test   %rax,%rax
+  802b4c:	75 3f                	jne    802b8d <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802b4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b52:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b56:	49 89 d0             	mov    %rdx,%r8
+  802b59:	48 89 c1             	mov    %rax,%rcx
+  802b5c:	48 b8 f8 6c 80 00 00 	movabs $0x806cf8,%rax
+  802b63:	00 00 00 
+  802b66:	48 89 c2             	mov    %rax,%rdx
+  802b69:	be 26 00 00 00       	mov    $0x26,%esi
+  802b6e:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802b75:	00 00 00 
+  802b78:	48 89 c7             	mov    %rax,%rdi
+  802b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b80:	49 b9 47 04 80 00 00 	movabs $0x800447,%r9
+  802b87:	00 00 00 
+  802b8a:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802b8d:	48 b8 6d 5a 80 00 00 	movabs $0x805a6d,%rax
+  802b94:	00 00 00 
+  802b97:	ff d0                	call   *%rax
+  802b99:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802b9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ba1:	ba 07 00 00 00       	mov    $0x7,%edx
+  802ba6:	48 89 c6             	mov    %rax,%rsi
+  802ba9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bae:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  802bb5:	00 00 00 
+  802bb8:	ff d0                	call   *%rax
+  802bba:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802bbd:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802bc1:	79 36                	jns    802bf9 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802bc3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802bc6:	89 c1                	mov    %eax,%ecx
+  802bc8:	48 b8 38 6d 80 00 00 	movabs $0x806d38,%rax
+  802bcf:	00 00 00 
+  802bd2:	48 89 c2             	mov    %rax,%rdx
+  802bd5:	be 35 00 00 00       	mov    $0x35,%esi
+  802bda:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802be1:	00 00 00 
+  802be4:	48 89 c7             	mov    %rax,%rdi
+  802be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bec:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  802bf3:	00 00 00 
+  802bf6:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802bf9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bfd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c05:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c0b:	48 89 c1             	mov    %rax,%rcx
+  802c0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c17:	48 89 ce             	mov    %rcx,%rsi
+  802c1a:	48 89 c7             	mov    %rax,%rdi
+  802c1d:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  802c24:	00 00 00 
+  802c27:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802c29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c2d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c31:	48 89 c2             	mov    %rax,%rdx
+  802c34:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c3b:	01 00 00 
+  802c3e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c42:	25 00 08 00 00       	and    $0x800,%eax
+  802c47:	48 85 c0             	test   %rax,%rax
+  802c4a:	74 7a                	je     802cc6 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802c4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c50:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802c54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c58:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c5e:	48 89 c2             	mov    %rax,%rdx
+  802c61:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c65:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c6b:	48 89 d1             	mov    %rdx,%rcx
+  802c6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c73:	48 89 c6             	mov    %rax,%rsi
+  802c76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c7b:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+  802c87:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802c8a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c8e:	79 36                	jns    802cc6 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802c90:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c93:	89 c1                	mov    %eax,%ecx
+  802c95:	48 b8 60 6d 80 00 00 	movabs $0x806d60,%rax
+  802c9c:	00 00 00 
+  802c9f:	48 89 c2             	mov    %rax,%rdx
+  802ca2:	be 42 00 00 00       	mov    $0x42,%esi
+  802ca7:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802cae:	00 00 00 
+  802cb1:	48 89 c7             	mov    %rax,%rdi
+  802cb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb9:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  802cc0:	00 00 00 
+  802cc3:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802cc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cca:	48 89 c6             	mov    %rax,%rsi
+  802ccd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd2:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  802cd9:	00 00 00 
+  802cdc:	ff d0                	call   *%rax
+  802cde:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802ce1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802ce5:	79 37                	jns    802d1e <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802ce7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802cea:	89 c1                	mov    %eax,%ecx
+  802cec:	48 b8 88 6d 80 00 00 	movabs $0x806d88,%rax
+  802cf3:	00 00 00 
+  802cf6:	48 89 c2             	mov    %rax,%rdx
+  802cf9:	be 46 00 00 00       	mov    $0x46,%esi
+  802cfe:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802d05:	00 00 00 
+  802d08:	48 89 c7             	mov    %rax,%rdi
+  802d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d10:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  802d17:	00 00 00 
+  802d1a:	41 ff d0             	call   *%r8
+    return;
+  802d1d:	90                   	nop
+  }
+}
+  802d1e:	c9                   	leave
+  802d1f:	c3                   	ret
+
+0000000000802d20 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802d20:	55                   	push   %rbp
+  802d21:	48 89 e5             	mov    %rsp,%rbp
+  802d24:	48 83 ec 30          	sub    $0x30,%rsp
+  802d28:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d2b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802d2f:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d36:	01 00 00 
+  802d39:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d3d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d41:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d46:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802d4a:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  802d51:	00 00 00 
+  802d54:	ff d0                	call   *%rax
+  802d56:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802d59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d5d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d61:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802d65:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d6c:	01 00 00 
+  802d6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d73:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d77:	25 00 04 00 00       	and    $0x400,%eax
+  802d7c:	48 85 c0             	test   %rax,%rax
+  802d7f:	74 7b                	je     802dfc <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802d81:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d85:	89 c1                	mov    %eax,%ecx
+  802d87:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d8b:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d8f:	48 89 c2             	mov    %rax,%rdx
+  802d92:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d96:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d9a:	48 89 c6             	mov    %rax,%rsi
+  802d9d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802da0:	41 89 c8             	mov    %ecx,%r8d
+  802da3:	48 89 d1             	mov    %rdx,%rcx
+  802da6:	89 c2                	mov    %eax,%edx
+  802da8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dad:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  802db4:	00 00 00 
+  802db7:	ff d0                	call   *%rax
+  802db9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802dbc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dc0:	0f 89 da 00 00 00    	jns    802ea0 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802dc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dc9:	89 c1                	mov    %eax,%ecx
+  802dcb:	48 b8 b0 6d 80 00 00 	movabs $0x806db0,%rax
+  802dd2:	00 00 00 
+  802dd5:	48 89 c2             	mov    %rax,%rdx
+  802dd8:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802ddd:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802de4:	00 00 00 
+  802de7:	48 89 c7             	mov    %rax,%rdi
+  802dea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802def:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  802df6:	00 00 00 
+  802df9:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802dfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e00:	25 02 08 00 00       	and    $0x802,%eax
+  802e05:	48 85 c0             	test   %rax,%rax
+  802e08:	74 6e                	je     802e78 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802e0a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e0e:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802e14:	80 cc 08             	or     $0x8,%ah
+  802e17:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802e1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e1f:	89 c7                	mov    %eax,%edi
+  802e21:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e25:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e28:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e2c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e2f:	41 89 f8             	mov    %edi,%r8d
+  802e32:	89 c7                	mov    %eax,%edi
+  802e34:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+  802e40:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802e43:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e47:	79 05                	jns    802e4e <duppage+0x12e>
+      return r;
+  802e49:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e4c:	eb 55                	jmp    802ea3 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802e4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e52:	89 c7                	mov    %eax,%edi
+  802e54:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e58:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e5b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e5f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e62:	41 89 f8             	mov    %edi,%r8d
+  802e65:	89 c7                	mov    %eax,%edi
+  802e67:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  802e6e:	00 00 00 
+  802e71:	ff d0                	call   *%rax
+  802e73:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e76:	eb 28                	jmp    802ea0 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802e78:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e7c:	89 c7                	mov    %eax,%edi
+  802e7e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e82:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e85:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e89:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e8c:	41 89 f8             	mov    %edi,%r8d
+  802e8f:	89 c7                	mov    %eax,%edi
+  802e91:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  802e98:	00 00 00 
+  802e9b:	ff d0                	call   *%rax
+  802e9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802ea0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ea3:	c9                   	leave
+  802ea4:	c3                   	ret
+
+0000000000802ea5 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802ea5:	55                   	push   %rbp
+  802ea6:	48 89 e5             	mov    %rsp,%rbp
+  802ea9:	48 83 ec 20          	sub    $0x20,%rsp
+  802ead:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802eb0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802eb4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802eb8:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ebc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802ec0:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802ec7:	01 00 00 
+  802eca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ece:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ed2:	25 00 08 00 00       	and    $0x800,%eax
+  802ed7:	48 85 c0             	test   %rax,%rax
+  802eda:	74 0d                	je     802ee9 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802edc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ee0:	0f b6 10             	movzbl (%rax),%edx
+  802ee3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ee7:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802ee9:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802ef0:	01 00 00 
+  802ef3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ef7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802efb:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f00:	89 c6                	mov    %eax,%esi
+  802f02:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802f06:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802f09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f0d:	41 89 f0             	mov    %esi,%r8d
+  802f10:	48 89 c6             	mov    %rax,%rsi
+  802f13:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f18:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  802f1f:	00 00 00 
+  802f22:	ff d0                	call   *%rax
+}
+  802f24:	c9                   	leave
+  802f25:	c3                   	ret
+
+0000000000802f26 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802f26:	55                   	push   %rbp
+  802f27:	48 89 e5             	mov    %rsp,%rbp
+  802f2a:	48 83 ec 40          	sub    $0x40,%rsp
+  802f2e:	89 f8                	mov    %edi,%eax
+  802f30:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802f33:	48 b8 cb 2a 80 00 00 	movabs $0x802acb,%rax
+  802f3a:	00 00 00 
+  802f3d:	48 89 c7             	mov    %rax,%rdi
+  802f40:	48 b8 1f 5f 80 00 00 	movabs $0x805f1f,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802f4c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f51:	cd 30                	int    $0x30
+  802f53:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802f56:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802f59:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f5c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f60:	79 36                	jns    802f98 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802f62:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f65:	89 c1                	mov    %eax,%ecx
+  802f67:	48 b8 db 6d 80 00 00 	movabs $0x806ddb,%rax
+  802f6e:	00 00 00 
+  802f71:	48 89 c2             	mov    %rax,%rdx
+  802f74:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802f79:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802f80:	00 00 00 
+  802f83:	48 89 c7             	mov    %rax,%rdi
+  802f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f8b:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  802f92:	00 00 00 
+  802f95:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802f98:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f9c:	75 0a                	jne    802fa8 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa3:	e9 d3 02 00 00       	jmp    80327b <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802fa8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802faf:	00 
+  802fb0:	e9 7a 01 00 00       	jmp    80312f <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802fb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fb9:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fbd:	48 c1 e8 27          	shr    $0x27,%rax
+  802fc1:	48 89 c2             	mov    %rax,%rdx
+  802fc4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802fcb:	01 00 00 
+  802fce:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fd2:	83 e0 01             	and    $0x1,%eax
+  802fd5:	48 85 c0             	test   %rax,%rax
+  802fd8:	0f 84 4c 01 00 00    	je     80312a <fork_common+0x204>
+  802fde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fe2:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fe6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fea:	48 89 c2             	mov    %rax,%rdx
+  802fed:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802ff4:	01 00 00 
+  802ff7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ffb:	83 e0 01             	and    $0x1,%eax
+  802ffe:	48 85 c0             	test   %rax,%rax
+  803001:	0f 84 23 01 00 00    	je     80312a <fork_common+0x204>
+  803007:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80300b:	48 c1 e0 0c          	shl    $0xc,%rax
+  80300f:	48 c1 e8 15          	shr    $0x15,%rax
+  803013:	48 89 c2             	mov    %rax,%rdx
+  803016:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80301d:	01 00 00 
+  803020:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803024:	83 e0 01             	and    $0x1,%eax
+  803027:	48 85 c0             	test   %rax,%rax
+  80302a:	0f 84 fa 00 00 00    	je     80312a <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  803030:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803034:	48 c1 e0 0c          	shl    $0xc,%rax
+  803038:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  80303c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803040:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  803047:	00 00 00 
+  80304a:	48 39 c2             	cmp    %rax,%rdx
+  80304d:	0f 82 d7 00 00 00    	jb     80312a <fork_common+0x204>
+  803053:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  80305a:	00 00 00 
+  80305d:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  803061:	0f 84 c3 00 00 00    	je     80312a <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803067:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80306b:	48 89 c7             	mov    %rax,%rdi
+  80306e:	48 b8 29 5a 80 00 00 	movabs $0x805a29,%rax
+  803075:	00 00 00 
+  803078:	ff d0                	call   *%rax
+  80307a:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  80307d:	84 c0                	test   %al,%al
+  80307f:	0f 84 a5 00 00 00    	je     80312a <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803085:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803089:	48 c1 e8 0c          	shr    $0xc,%rax
+  80308d:	48 89 c2             	mov    %rax,%rdx
+  803090:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803097:	01 00 00 
+  80309a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80309e:	83 e0 01             	and    $0x1,%eax
+  8030a1:	48 85 c0             	test   %rax,%rax
+  8030a4:	0f 84 80 00 00 00    	je     80312a <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  8030aa:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  8030ae:	74 4a                	je     8030fa <fork_common+0x1d4>
+  8030b0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030b4:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  8030bb:	00 00 00 
+  8030be:	48 39 c2             	cmp    %rax,%rdx
+  8030c1:	73 13                	jae    8030d6 <fork_common+0x1b0>
+  8030c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030c7:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  8030ce:	00 00 00 
+  8030d1:	48 39 c2             	cmp    %rax,%rdx
+  8030d4:	73 24                	jae    8030fa <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  8030d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030da:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030de:	48 89 c2             	mov    %rax,%rdx
+  8030e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030e4:	48 89 d6             	mov    %rdx,%rsi
+  8030e7:	89 c7                	mov    %eax,%edi
+  8030e9:	48 b8 a5 2e 80 00 00 	movabs $0x802ea5,%rax
+  8030f0:	00 00 00 
+  8030f3:	ff d0                	call   *%rax
+  8030f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030f8:	eb 22                	jmp    80311c <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  8030fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030fe:	48 c1 e8 0c          	shr    $0xc,%rax
+  803102:	48 89 c2             	mov    %rax,%rdx
+  803105:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803108:	48 89 d6             	mov    %rdx,%rsi
+  80310b:	89 c7                	mov    %eax,%edi
+  80310d:	48 b8 20 2d 80 00 00 	movabs $0x802d20,%rax
+  803114:	00 00 00 
+  803117:	ff d0                	call   *%rax
+  803119:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  80311c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803120:	79 08                	jns    80312a <fork_common+0x204>
+            return r;
+  803122:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803125:	e9 51 01 00 00       	jmp    80327b <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  80312a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80312f:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  803136:	07 
+  803137:	0f 86 78 fe ff ff    	jbe    802fb5 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  80313d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803144:	00 00 00 
+  803147:	8b 40 04             	mov    0x4(%rax),%eax
+  80314a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80314f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803156:	00 00 00 
+  803159:	48 98                	cltq
+  80315b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803162:	48 01 d0             	add    %rdx,%rax
+  803165:	48 05 00 01 00 00    	add    $0x100,%rax
+  80316b:	48 8b 10             	mov    (%rax),%rdx
+  80316e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803171:	48 89 d6             	mov    %rdx,%rsi
+  803174:	89 c7                	mov    %eax,%edi
+  803176:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  80317d:	00 00 00 
+  803180:	ff d0                	call   *%rax
+  803182:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803185:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803189:	79 36                	jns    8031c1 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  80318b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80318e:	89 c1                	mov    %eax,%ecx
+  803190:	48 b8 f0 6d 80 00 00 	movabs $0x806df0,%rax
+  803197:	00 00 00 
+  80319a:	48 89 c2             	mov    %rax,%rdx
+  80319d:	be be 00 00 00       	mov    $0xbe,%esi
+  8031a2:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  8031a9:	00 00 00 
+  8031ac:	48 89 c7             	mov    %rax,%rdi
+  8031af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031b4:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  8031bb:	00 00 00 
+  8031be:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  8031c1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031c4:	ba 02 00 00 00       	mov    $0x2,%edx
+  8031c9:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8031d0:	00 00 00 
+  8031d3:	48 89 ce             	mov    %rcx,%rsi
+  8031d6:	89 c7                	mov    %eax,%edi
+  8031d8:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+  8031e4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031e7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031eb:	79 36                	jns    803223 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  8031ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031f0:	89 c1                	mov    %eax,%ecx
+  8031f2:	48 b8 20 6e 80 00 00 	movabs $0x806e20,%rax
+  8031f9:	00 00 00 
+  8031fc:	48 89 c2             	mov    %rax,%rdx
+  8031ff:	be c1 00 00 00       	mov    $0xc1,%esi
+  803204:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  80320b:	00 00 00 
+  80320e:	48 89 c7             	mov    %rax,%rdi
+  803211:	b8 00 00 00 00       	mov    $0x0,%eax
+  803216:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  80321d:	00 00 00 
+  803220:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  803223:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803226:	be 02 00 00 00       	mov    $0x2,%esi
+  80322b:	89 c7                	mov    %eax,%edi
+  80322d:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  803234:	00 00 00 
+  803237:	ff d0                	call   *%rax
+  803239:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80323c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803240:	79 36                	jns    803278 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  803242:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803245:	89 c1                	mov    %eax,%ecx
+  803247:	48 b8 40 6e 80 00 00 	movabs $0x806e40,%rax
+  80324e:	00 00 00 
+  803251:	48 89 c2             	mov    %rax,%rdx
+  803254:	be d4 00 00 00       	mov    $0xd4,%esi
+  803259:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  803260:	00 00 00 
+  803263:	48 89 c7             	mov    %rax,%rdi
+  803266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80326b:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  803272:	00 00 00 
+  803275:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803278:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  80327b:	c9                   	leave
+  80327c:	c3                   	ret
+
+000000000080327d <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  80327d:	55                   	push   %rbp
+  80327e:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  803281:	bf 00 00 00 00       	mov    $0x0,%edi
+  803286:	48 b8 26 2f 80 00 00 	movabs $0x802f26,%rax
+  80328d:	00 00 00 
+  803290:	ff d0                	call   *%rax
+}
+  803292:	5d                   	pop    %rbp
+  803293:	c3                   	ret
+
+0000000000803294 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  803294:	55                   	push   %rbp
+  803295:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  803298:	bf 01 00 00 00       	mov    $0x1,%edi
+  80329d:	48 b8 26 2f 80 00 00 	movabs $0x802f26,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+}
+  8032a9:	5d                   	pop    %rbp
+  8032aa:	c3                   	ret
+
+00000000008032ab <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8032ab:	55                   	push   %rbp
+  8032ac:	48 89 e5             	mov    %rsp,%rbp
+  8032af:	48 83 ec 20          	sub    $0x20,%rsp
+  8032b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032b7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8032bb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  8032bf:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032c3:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8032c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032cb:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  8032d2:	48 89 c7             	mov    %rax,%rdi
+  8032d5:	48 b8 e3 32 80 00 00 	movabs $0x8032e3,%rax
+  8032dc:	00 00 00 
+  8032df:	ff d0                	call   *%rax
+}
+  8032e1:	c9                   	leave
+  8032e2:	c3                   	ret
+
+00000000008032e3 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  8032e3:	55                   	push   %rbp
+  8032e4:	48 89 e5             	mov    %rsp,%rbp
+  8032e7:	48 83 ec 30          	sub    $0x30,%rsp
+  8032eb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8032ef:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8032f3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8032f7:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8032fb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803300:	75 0e                	jne    803310 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  803302:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803309:	00 00 00 
+  80330c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  803310:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  803315:	75 18                	jne    80332f <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  803317:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80331b:	48 89 c7             	mov    %rax,%rdi
+  80331e:	48 b8 24 26 80 00 00 	movabs $0x802624,%rax
+  803325:	00 00 00 
+  803328:	ff d0                	call   *%rax
+  80332a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80332d:	eb 1d                	jmp    80334c <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  80332f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803333:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803337:	48 89 d6             	mov    %rdx,%rsi
+  80333a:	48 89 c7             	mov    %rax,%rdi
+  80333d:	48 b8 6a 26 80 00 00 	movabs $0x80266a,%rax
+  803344:	00 00 00 
+  803347:	ff d0                	call   *%rax
+  803349:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  80334c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803350:	79 2a                	jns    80337c <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  803352:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803357:	74 0a                	je     803363 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  803359:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80335d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  803363:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803368:	74 0a                	je     803374 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  80336a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80336e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  803374:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803377:	e9 aa 00 00 00       	jmp    803426 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  80337c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803381:	74 36                	je     8033b9 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  803383:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80338a:	00 00 00 
+  80338d:	8b 40 04             	mov    0x4(%rax),%eax
+  803390:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803395:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80339c:	00 00 00 
+  80339f:	48 98                	cltq
+  8033a1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033a8:	48 01 d0             	add    %rdx,%rax
+  8033ab:	48 05 24 01 00 00    	add    $0x124,%rax
+  8033b1:	8b 10                	mov    (%rax),%edx
+  8033b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033b7:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  8033b9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8033be:	74 36                	je     8033f6 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  8033c0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033c7:	00 00 00 
+  8033ca:	8b 40 04             	mov    0x4(%rax),%eax
+  8033cd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033d2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8033d9:	00 00 00 
+  8033dc:	48 98                	cltq
+  8033de:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033e5:	48 01 d0             	add    %rdx,%rax
+  8033e8:	48 05 28 01 00 00    	add    $0x128,%rax
+  8033ee:	8b 10                	mov    (%rax),%edx
+  8033f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033f4:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8033f6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033fd:	00 00 00 
+  803400:	8b 40 04             	mov    0x4(%rax),%eax
+  803403:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803408:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80340f:	00 00 00 
+  803412:	48 98                	cltq
+  803414:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80341b:	48 01 d0             	add    %rdx,%rax
+  80341e:	48 05 20 01 00 00    	add    $0x120,%rax
+  803424:	8b 00                	mov    (%rax),%eax
+  }
+}
+  803426:	c9                   	leave
+  803427:	c3                   	ret
+
+0000000000803428 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  803428:	55                   	push   %rbp
+  803429:	48 89 e5             	mov    %rsp,%rbp
+  80342c:	48 83 ec 30          	sub    $0x30,%rsp
+  803430:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803433:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  803436:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80343a:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80343d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803442:	75 5e                	jne    8034a2 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  803444:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80344b:	00 00 00 
+  80344e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803452:	eb 4e                	jmp    8034a2 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  803454:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803458:	79 3c                	jns    803496 <ipc_send+0x6e>
+  80345a:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80345e:	74 36                	je     803496 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  803460:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803463:	89 c1                	mov    %eax,%ecx
+  803465:	48 b8 68 6e 80 00 00 	movabs $0x806e68,%rax
+  80346c:	00 00 00 
+  80346f:	48 89 c2             	mov    %rax,%rdx
+  803472:	be 54 00 00 00       	mov    $0x54,%esi
+  803477:	48 b8 8e 6e 80 00 00 	movabs $0x806e8e,%rax
+  80347e:	00 00 00 
+  803481:	48 89 c7             	mov    %rax,%rdi
+  803484:	b8 00 00 00 00       	mov    $0x0,%eax
+  803489:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  803490:	00 00 00 
+  803493:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  803496:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  80349d:	00 00 00 
+  8034a0:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8034a2:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8034a5:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8034a8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034ac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8034af:	89 c7                	mov    %eax,%edi
+  8034b1:	48 b8 cd 25 80 00 00 	movabs $0x8025cd,%rax
+  8034b8:	00 00 00 
+  8034bb:	ff d0                	call   *%rax
+  8034bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034c4:	75 8e                	jne    803454 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  8034c6:	48 b8 a7 23 80 00 00 	movabs $0x8023a7,%rax
+  8034cd:	00 00 00 
+  8034d0:	ff d0                	call   *%rax
+}
+  8034d2:	90                   	nop
+  8034d3:	c9                   	leave
+  8034d4:	c3                   	ret
+
+00000000008034d5 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8034d5:	55                   	push   %rbp
+  8034d6:	48 89 e5             	mov    %rsp,%rbp
+  8034d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8034dd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8034e0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8034e7:	eb 4d                	jmp    803536 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8034e9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8034f0:	00 00 00 
+  8034f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034f6:	48 98                	cltq
+  8034f8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8034ff:	48 01 d0             	add    %rdx,%rax
+  803502:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  803508:	8b 00                	mov    (%rax),%eax
+  80350a:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80350d:	75 23                	jne    803532 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  80350f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803516:	00 00 00 
+  803519:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80351c:	48 98                	cltq
+  80351e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803525:	48 01 d0             	add    %rdx,%rax
+  803528:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80352e:	8b 00                	mov    (%rax),%eax
+  803530:	eb 12                	jmp    803544 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  803532:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803536:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80353d:	7e aa                	jle    8034e9 <ipc_find_env+0x14>
+  return 0;
+  80353f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803544:	c9                   	leave
+  803545:	c3                   	ret
+
+0000000000803546 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803546:	55                   	push   %rbp
+  803547:	48 89 e5             	mov    %rsp,%rbp
+  80354a:	48 83 ec 08          	sub    $0x8,%rsp
+  80354e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  803552:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803556:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80355d:	ff ff ff 
+  803560:	48 01 d0             	add    %rdx,%rax
+  803563:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803567:	c9                   	leave
+  803568:	c3                   	ret
+
+0000000000803569 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803569:	55                   	push   %rbp
+  80356a:	48 89 e5             	mov    %rsp,%rbp
+  80356d:	48 83 ec 08          	sub    $0x8,%rsp
+  803571:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  803575:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803579:	48 89 c7             	mov    %rax,%rdi
+  80357c:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  803583:	00 00 00 
+  803586:	ff d0                	call   *%rax
+  803588:	48 05 01 68 00 00    	add    $0x6801,%rax
+  80358e:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  803592:	c9                   	leave
+  803593:	c3                   	ret
+
+0000000000803594 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803594:	55                   	push   %rbp
+  803595:	48 89 e5             	mov    %rsp,%rbp
+  803598:	48 83 ec 18          	sub    $0x18,%rsp
+  80359c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8035a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035a7:	e9 ae 00 00 00       	jmp    80365a <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8035ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035af:	c1 e0 0c             	shl    $0xc,%eax
+  8035b2:	48 98                	cltq
+  8035b4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8035b9:	48 01 d0             	add    %rdx,%rax
+  8035bc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8035c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035c4:	48 c1 e8 27          	shr    $0x27,%rax
+  8035c8:	48 89 c2             	mov    %rax,%rdx
+  8035cb:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8035d2:	01 00 00 
+  8035d5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035d9:	83 e0 01             	and    $0x1,%eax
+  8035dc:	48 85 c0             	test   %rax,%rax
+  8035df:	74 63                	je     803644 <fd_alloc+0xb0>
+  8035e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035e5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035e9:	48 89 c2             	mov    %rax,%rdx
+  8035ec:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8035f3:	01 00 00 
+  8035f6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035fa:	83 e0 01             	and    $0x1,%eax
+  8035fd:	48 85 c0             	test   %rax,%rax
+  803600:	74 42                	je     803644 <fd_alloc+0xb0>
+  803602:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803606:	48 c1 e8 15          	shr    $0x15,%rax
+  80360a:	48 89 c2             	mov    %rax,%rdx
+  80360d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803614:	01 00 00 
+  803617:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80361b:	83 e0 01             	and    $0x1,%eax
+  80361e:	48 85 c0             	test   %rax,%rax
+  803621:	74 21                	je     803644 <fd_alloc+0xb0>
+  803623:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803627:	48 c1 e8 0c          	shr    $0xc,%rax
+  80362b:	48 89 c2             	mov    %rax,%rdx
+  80362e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803635:	01 00 00 
+  803638:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80363c:	83 e0 01             	and    $0x1,%eax
+  80363f:	48 85 c0             	test   %rax,%rax
+  803642:	75 12                	jne    803656 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803644:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803648:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80364c:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80364f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803654:	eb 1e                	jmp    803674 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803656:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80365a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80365e:	0f 8e 48 ff ff ff    	jle    8035ac <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803664:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803668:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80366f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803674:	c9                   	leave
+  803675:	c3                   	ret
+
+0000000000803676 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803676:	55                   	push   %rbp
+  803677:	48 89 e5             	mov    %rsp,%rbp
+  80367a:	48 83 ec 20          	sub    $0x20,%rsp
+  80367e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803681:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803685:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803689:	78 06                	js     803691 <fd_lookup+0x1b>
+  80368b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80368f:	7e 0a                	jle    80369b <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803691:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803696:	e9 af 00 00 00       	jmp    80374a <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80369b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80369e:	c1 e0 0c             	shl    $0xc,%eax
+  8036a1:	48 98                	cltq
+  8036a3:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8036a8:	48 01 d0             	add    %rdx,%rax
+  8036ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8036af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036b3:	48 c1 e8 27          	shr    $0x27,%rax
+  8036b7:	48 89 c2             	mov    %rax,%rdx
+  8036ba:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8036c1:	01 00 00 
+  8036c4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036c8:	83 e0 01             	and    $0x1,%eax
+  8036cb:	48 85 c0             	test   %rax,%rax
+  8036ce:	74 63                	je     803733 <fd_lookup+0xbd>
+  8036d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036d4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036d8:	48 89 c2             	mov    %rax,%rdx
+  8036db:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8036e2:	01 00 00 
+  8036e5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036e9:	83 e0 01             	and    $0x1,%eax
+  8036ec:	48 85 c0             	test   %rax,%rax
+  8036ef:	74 42                	je     803733 <fd_lookup+0xbd>
+  8036f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036f5:	48 c1 e8 15          	shr    $0x15,%rax
+  8036f9:	48 89 c2             	mov    %rax,%rdx
+  8036fc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803703:	01 00 00 
+  803706:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80370a:	83 e0 01             	and    $0x1,%eax
+  80370d:	48 85 c0             	test   %rax,%rax
+  803710:	74 21                	je     803733 <fd_lookup+0xbd>
+  803712:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803716:	48 c1 e8 0c          	shr    $0xc,%rax
+  80371a:	48 89 c2             	mov    %rax,%rdx
+  80371d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803724:	01 00 00 
+  803727:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80372b:	83 e0 01             	and    $0x1,%eax
+  80372e:	48 85 c0             	test   %rax,%rax
+  803731:	75 07                	jne    80373a <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803733:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803738:	eb 10                	jmp    80374a <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  80373a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80373e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803742:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803745:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80374a:	c9                   	leave
+  80374b:	c3                   	ret
+
+000000000080374c <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80374c:	55                   	push   %rbp
+  80374d:	48 89 e5             	mov    %rsp,%rbp
+  803750:	48 83 ec 30          	sub    $0x30,%rsp
+  803754:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803758:	89 f0                	mov    %esi,%eax
+  80375a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80375d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803761:	48 89 c7             	mov    %rax,%rdi
+  803764:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  80376b:	00 00 00 
+  80376e:	ff d0                	call   *%rax
+  803770:	89 c2                	mov    %eax,%edx
+  803772:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803776:	48 89 c6             	mov    %rax,%rsi
+  803779:	89 d7                	mov    %edx,%edi
+  80377b:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803782:	00 00 00 
+  803785:	ff d0                	call   *%rax
+  803787:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80378a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80378e:	78 0a                	js     80379a <fd_close+0x4e>
+  803790:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803794:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803798:	74 12                	je     8037ac <fd_close+0x60>
+    return (must_exist ? r : 0);
+  80379a:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  80379e:	74 05                	je     8037a5 <fd_close+0x59>
+  8037a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037a3:	eb 70                	jmp    803815 <fd_close+0xc9>
+  8037a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037aa:	eb 69                	jmp    803815 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8037ac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037b0:	8b 00                	mov    (%rax),%eax
+  8037b2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8037b6:	48 89 d6             	mov    %rdx,%rsi
+  8037b9:	89 c7                	mov    %eax,%edi
+  8037bb:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  8037c2:	00 00 00 
+  8037c5:	ff d0                	call   *%rax
+  8037c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037ca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037ce:	78 2a                	js     8037fa <fd_close+0xae>
+    if (dev->dev_close)
+  8037d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037d4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8037d8:	48 85 c0             	test   %rax,%rax
+  8037db:	74 16                	je     8037f3 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8037dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037e1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8037e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037e9:	48 89 c7             	mov    %rax,%rdi
+  8037ec:	ff d2                	call   *%rdx
+  8037ee:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037f1:	eb 07                	jmp    8037fa <fd_close+0xae>
+    else
+      r = 0;
+  8037f3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8037fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037fe:	48 89 c6             	mov    %rax,%rsi
+  803801:	bf 00 00 00 00       	mov    $0x0,%edi
+  803806:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  80380d:	00 00 00 
+  803810:	ff d0                	call   *%rax
+  return r;
+  803812:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803815:	c9                   	leave
+  803816:	c3                   	ret
+
+0000000000803817 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803817:	55                   	push   %rbp
+  803818:	48 89 e5             	mov    %rsp,%rbp
+  80381b:	48 83 ec 20          	sub    $0x20,%rsp
+  80381f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803822:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803826:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80382d:	eb 3f                	jmp    80386e <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80382f:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803836:	00 00 00 
+  803839:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80383c:	48 98                	cltq
+  80383e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803842:	8b 00                	mov    (%rax),%eax
+  803844:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803847:	75 21                	jne    80386a <dev_lookup+0x53>
+      *dev = devtab[i];
+  803849:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803850:	00 00 00 
+  803853:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803856:	48 98                	cltq
+  803858:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80385c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803860:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803863:	b8 00 00 00 00       	mov    $0x0,%eax
+  803868:	eb 7f                	jmp    8038e9 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  80386a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80386e:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803875:	00 00 00 
+  803878:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80387b:	48 98                	cltq
+  80387d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803881:	48 85 c0             	test   %rax,%rax
+  803884:	75 a9                	jne    80382f <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803886:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80388d:	00 00 00 
+  803890:	8b 40 04             	mov    0x4(%rax),%eax
+  803893:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803898:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80389f:	00 00 00 
+  8038a2:	48 98                	cltq
+  8038a4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8038ab:	48 01 d0             	add    %rdx,%rax
+  8038ae:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8038b4:	8b 00                	mov    (%rax),%eax
+  8038b6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8038b9:	89 c6                	mov    %eax,%esi
+  8038bb:	48 b8 98 6e 80 00 00 	movabs $0x806e98,%rax
+  8038c2:	00 00 00 
+  8038c5:	48 89 c7             	mov    %rax,%rdi
+  8038c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038cd:	48 b9 66 06 80 00 00 	movabs $0x800666,%rcx
+  8038d4:	00 00 00 
+  8038d7:	ff d1                	call   *%rcx
+  *dev = 0;
+  8038d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038dd:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8038e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8038e9:	c9                   	leave
+  8038ea:	c3                   	ret
+
+00000000008038eb <close>:
+
+int
+close(int fdnum) {
+  8038eb:	55                   	push   %rbp
+  8038ec:	48 89 e5             	mov    %rsp,%rbp
+  8038ef:	48 83 ec 20          	sub    $0x20,%rsp
+  8038f3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8038f6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8038fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038fd:	48 89 d6             	mov    %rdx,%rsi
+  803900:	89 c7                	mov    %eax,%edi
+  803902:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803909:	00 00 00 
+  80390c:	ff d0                	call   *%rax
+  80390e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803911:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803915:	79 05                	jns    80391c <close+0x31>
+    return r;
+  803917:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80391a:	eb 18                	jmp    803934 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80391c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803920:	be 01 00 00 00       	mov    $0x1,%esi
+  803925:	48 89 c7             	mov    %rax,%rdi
+  803928:	48 b8 4c 37 80 00 00 	movabs $0x80374c,%rax
+  80392f:	00 00 00 
+  803932:	ff d0                	call   *%rax
+}
+  803934:	c9                   	leave
+  803935:	c3                   	ret
+
+0000000000803936 <close_all>:
+
+void
+close_all(void) {
+  803936:	55                   	push   %rbp
+  803937:	48 89 e5             	mov    %rsp,%rbp
+  80393a:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  80393e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803945:	eb 15                	jmp    80395c <close_all+0x26>
+    close(i);
+  803947:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80394a:	89 c7                	mov    %eax,%edi
+  80394c:	48 b8 eb 38 80 00 00 	movabs $0x8038eb,%rax
+  803953:	00 00 00 
+  803956:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803958:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80395c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803960:	7e e5                	jle    803947 <close_all+0x11>
+}
+  803962:	90                   	nop
+  803963:	90                   	nop
+  803964:	c9                   	leave
+  803965:	c3                   	ret
+
+0000000000803966 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803966:	55                   	push   %rbp
+  803967:	48 89 e5             	mov    %rsp,%rbp
+  80396a:	48 83 ec 40          	sub    $0x40,%rsp
+  80396e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803971:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803974:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803978:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80397b:	48 89 d6             	mov    %rdx,%rsi
+  80397e:	89 c7                	mov    %eax,%edi
+  803980:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803987:	00 00 00 
+  80398a:	ff d0                	call   *%rax
+  80398c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80398f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803993:	79 08                	jns    80399d <dup+0x37>
+    return r;
+  803995:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803998:	e9 33 02 00 00       	jmp    803bd0 <dup+0x26a>
+  close(newfdnum);
+  80399d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8039a0:	89 c7                	mov    %eax,%edi
+  8039a2:	48 b8 eb 38 80 00 00 	movabs $0x8038eb,%rax
+  8039a9:	00 00 00 
+  8039ac:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8039ae:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8039b1:	c1 e0 0c             	shl    $0xc,%eax
+  8039b4:	48 98                	cltq
+  8039b6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8039bb:	48 01 d0             	add    %rdx,%rax
+  8039be:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8039c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039c6:	48 89 c7             	mov    %rax,%rdi
+  8039c9:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  8039d0:	00 00 00 
+  8039d3:	ff d0                	call   *%rax
+  8039d5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8039d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039dd:	48 89 c7             	mov    %rax,%rdi
+  8039e0:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  8039e7:	00 00 00 
+  8039ea:	ff d0                	call   *%rax
+  8039ec:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8039f0:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8039f7:	00 
+  8039f8:	e9 19 01 00 00       	jmp    803b16 <dup+0x1b0>
+    off -= PGSIZE;
+  8039fd:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803a04:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803a05:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a0d:	48 01 d0             	add    %rdx,%rax
+  803a10:	48 c1 e8 27          	shr    $0x27,%rax
+  803a14:	48 89 c2             	mov    %rax,%rdx
+  803a17:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803a1e:	01 00 00 
+  803a21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a25:	83 e0 01             	and    $0x1,%eax
+  803a28:	48 85 c0             	test   %rax,%rax
+  803a2b:	0f 84 e5 00 00 00    	je     803b16 <dup+0x1b0>
+  803a31:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a39:	48 01 d0             	add    %rdx,%rax
+  803a3c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a40:	48 89 c2             	mov    %rax,%rdx
+  803a43:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803a4a:	01 00 00 
+  803a4d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a51:	83 e0 01             	and    $0x1,%eax
+  803a54:	48 85 c0             	test   %rax,%rax
+  803a57:	0f 84 b9 00 00 00    	je     803b16 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803a5d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a65:	48 01 d0             	add    %rdx,%rax
+  803a68:	48 c1 e8 15          	shr    $0x15,%rax
+  803a6c:	48 89 c2             	mov    %rax,%rdx
+  803a6f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803a76:	01 00 00 
+  803a79:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a7d:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803a80:	48 85 c0             	test   %rax,%rax
+  803a83:	0f 84 8d 00 00 00    	je     803b16 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803a89:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a91:	48 01 d0             	add    %rdx,%rax
+  803a94:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a98:	48 89 c2             	mov    %rax,%rdx
+  803a9b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803aa2:	01 00 00 
+  803aa5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803aa9:	83 e0 01             	and    $0x1,%eax
+  803aac:	48 85 c0             	test   %rax,%rax
+  803aaf:	74 65                	je     803b16 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803ab1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ab5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ab9:	48 01 d0             	add    %rdx,%rax
+  803abc:	48 c1 e8 0c          	shr    $0xc,%rax
+  803ac0:	48 89 c2             	mov    %rax,%rdx
+  803ac3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803aca:	01 00 00 
+  803acd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ad1:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ad6:	89 c6                	mov    %eax,%esi
+  803ad8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803adc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ae0:	48 01 c2             	add    %rax,%rdx
+  803ae3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803ae7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aeb:	48 01 c8             	add    %rcx,%rax
+  803aee:	41 89 f0             	mov    %esi,%r8d
+  803af1:	48 89 d1             	mov    %rdx,%rcx
+  803af4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803af9:	48 89 c6             	mov    %rax,%rsi
+  803afc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b01:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  803b08:	00 00 00 
+  803b0b:	ff d0                	call   *%rax
+  803b0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b14:	78 60                	js     803b76 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803b16:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803b1b:	0f 85 dc fe ff ff    	jne    8039fd <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803b21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b25:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b29:	48 89 c2             	mov    %rax,%rdx
+  803b2c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803b33:	01 00 00 
+  803b36:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b3a:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b3f:	89 c1                	mov    %eax,%ecx
+  803b41:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b45:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803b49:	41 89 c8             	mov    %ecx,%r8d
+  803b4c:	48 89 d1             	mov    %rdx,%rcx
+  803b4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b54:	48 89 c6             	mov    %rax,%rsi
+  803b57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b5c:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  803b63:	00 00 00 
+  803b66:	ff d0                	call   *%rax
+  803b68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b6f:	78 08                	js     803b79 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803b71:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803b74:	eb 5a                	jmp    803bd0 <dup+0x26a>
+        goto err;
+  803b76:	90                   	nop
+  803b77:	eb 01                	jmp    803b7a <dup+0x214>
+    goto err;
+  803b79:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803b7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b7e:	48 89 c6             	mov    %rax,%rsi
+  803b81:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b86:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  803b8d:	00 00 00 
+  803b90:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803b92:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803b99:	00 
+  803b9a:	eb 27                	jmp    803bc3 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803b9c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ba0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ba4:	48 01 d0             	add    %rdx,%rax
+  803ba7:	48 89 c6             	mov    %rax,%rsi
+  803baa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803baf:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  803bb6:	00 00 00 
+  803bb9:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803bbb:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803bc2:	00 
+  803bc3:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803bca:	00 
+  803bcb:	76 cf                	jbe    803b9c <dup+0x236>
+  return r;
+  803bcd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803bd0:	c9                   	leave
+  803bd1:	c3                   	ret
+
+0000000000803bd2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803bd2:	55                   	push   %rbp
+  803bd3:	48 89 e5             	mov    %rsp,%rbp
+  803bd6:	48 83 ec 40          	sub    $0x40,%rsp
+  803bda:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803bdd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803be1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803be5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803be9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803bec:	48 89 d6             	mov    %rdx,%rsi
+  803bef:	89 c7                	mov    %eax,%edi
+  803bf1:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803bf8:	00 00 00 
+  803bfb:	ff d0                	call   *%rax
+  803bfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c04:	78 24                	js     803c2a <read+0x58>
+  803c06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c0a:	8b 00                	mov    (%rax),%eax
+  803c0c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c10:	48 89 d6             	mov    %rdx,%rsi
+  803c13:	89 c7                	mov    %eax,%edi
+  803c15:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803c1c:	00 00 00 
+  803c1f:	ff d0                	call   *%rax
+  803c21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c28:	79 0a                	jns    803c34 <read+0x62>
+    return r;
+  803c2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c2d:	48 98                	cltq
+  803c2f:	e9 9e 00 00 00       	jmp    803cd2 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803c34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c38:	8b 40 08             	mov    0x8(%rax),%eax
+  803c3b:	83 e0 03             	and    $0x3,%eax
+  803c3e:	83 f8 01             	cmp    $0x1,%eax
+  803c41:	75 5c                	jne    803c9f <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803c43:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803c4a:	00 00 00 
+  803c4d:	8b 40 04             	mov    0x4(%rax),%eax
+  803c50:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c55:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803c5c:	00 00 00 
+  803c5f:	48 98                	cltq
+  803c61:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803c68:	48 01 d0             	add    %rdx,%rax
+  803c6b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803c71:	8b 00                	mov    (%rax),%eax
+  803c73:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803c76:	89 c6                	mov    %eax,%esi
+  803c78:	48 b8 b7 6e 80 00 00 	movabs $0x806eb7,%rax
+  803c7f:	00 00 00 
+  803c82:	48 89 c7             	mov    %rax,%rdi
+  803c85:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c8a:	48 b9 66 06 80 00 00 	movabs $0x800666,%rcx
+  803c91:	00 00 00 
+  803c94:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803c96:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803c9d:	eb 33                	jmp    803cd2 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803c9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ca3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803ca7:	48 85 c0             	test   %rax,%rax
+  803caa:	75 09                	jne    803cb5 <read+0xe3>
+    return -E_NOT_SUPP;
+  803cac:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803cb3:	eb 1d                	jmp    803cd2 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803cb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cb9:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803cbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cc1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803cc5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803cc9:	48 89 ce             	mov    %rcx,%rsi
+  803ccc:	48 89 c7             	mov    %rax,%rdi
+  803ccf:	41 ff d0             	call   *%r8
+}
+  803cd2:	c9                   	leave
+  803cd3:	c3                   	ret
+
+0000000000803cd4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803cd4:	55                   	push   %rbp
+  803cd5:	48 89 e5             	mov    %rsp,%rbp
+  803cd8:	48 83 ec 30          	sub    $0x30,%rsp
+  803cdc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803cdf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803ce3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803ce7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803cee:	eb 49                	jmp    803d39 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803cf0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cf3:	48 98                	cltq
+  803cf5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cf9:	48 29 c2             	sub    %rax,%rdx
+  803cfc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cff:	48 63 c8             	movslq %eax,%rcx
+  803d02:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d06:	48 01 c1             	add    %rax,%rcx
+  803d09:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803d0c:	48 89 ce             	mov    %rcx,%rsi
+  803d0f:	89 c7                	mov    %eax,%edi
+  803d11:	48 b8 d2 3b 80 00 00 	movabs $0x803bd2,%rax
+  803d18:	00 00 00 
+  803d1b:	ff d0                	call   *%rax
+  803d1d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803d20:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803d24:	79 07                	jns    803d2d <readn+0x59>
+      return m;
+  803d26:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d29:	48 98                	cltq
+  803d2b:	eb 1f                	jmp    803d4c <readn+0x78>
+    if (m == 0)
+  803d2d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803d31:	74 13                	je     803d46 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803d33:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d36:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803d39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d3c:	48 98                	cltq
+  803d3e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803d42:	72 ac                	jb     803cf0 <readn+0x1c>
+  803d44:	eb 01                	jmp    803d47 <readn+0x73>
+      break;
+  803d46:	90                   	nop
+  }
+  return tot;
+  803d47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d4a:	48 98                	cltq
+}
+  803d4c:	c9                   	leave
+  803d4d:	c3                   	ret
+
+0000000000803d4e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803d4e:	55                   	push   %rbp
+  803d4f:	48 89 e5             	mov    %rsp,%rbp
+  803d52:	48 83 ec 40          	sub    $0x40,%rsp
+  803d56:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d59:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803d5d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d61:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803d65:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d68:	48 89 d6             	mov    %rdx,%rsi
+  803d6b:	89 c7                	mov    %eax,%edi
+  803d6d:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803d74:	00 00 00 
+  803d77:	ff d0                	call   *%rax
+  803d79:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d7c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d80:	78 24                	js     803da6 <write+0x58>
+  803d82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d86:	8b 00                	mov    (%rax),%eax
+  803d88:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803d8c:	48 89 d6             	mov    %rdx,%rsi
+  803d8f:	89 c7                	mov    %eax,%edi
+  803d91:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803d98:	00 00 00 
+  803d9b:	ff d0                	call   *%rax
+  803d9d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803da0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803da4:	79 0a                	jns    803db0 <write+0x62>
+    return r;
+  803da6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803da9:	48 98                	cltq
+  803dab:	e9 9d 00 00 00       	jmp    803e4d <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803db0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803db4:	8b 40 08             	mov    0x8(%rax),%eax
+  803db7:	83 e0 03             	and    $0x3,%eax
+  803dba:	85 c0                	test   %eax,%eax
+  803dbc:	75 5c                	jne    803e1a <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803dbe:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803dc5:	00 00 00 
+  803dc8:	8b 40 04             	mov    0x4(%rax),%eax
+  803dcb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803dd0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803dd7:	00 00 00 
+  803dda:	48 98                	cltq
+  803ddc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803de3:	48 01 d0             	add    %rdx,%rax
+  803de6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803dec:	8b 00                	mov    (%rax),%eax
+  803dee:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803df1:	89 c6                	mov    %eax,%esi
+  803df3:	48 b8 d3 6e 80 00 00 	movabs $0x806ed3,%rax
+  803dfa:	00 00 00 
+  803dfd:	48 89 c7             	mov    %rax,%rdi
+  803e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e05:	48 b9 66 06 80 00 00 	movabs $0x800666,%rcx
+  803e0c:	00 00 00 
+  803e0f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803e11:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803e18:	eb 33                	jmp    803e4d <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803e1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e1e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803e22:	48 85 c0             	test   %rax,%rax
+  803e25:	75 09                	jne    803e30 <write+0xe2>
+    return -E_NOT_SUPP;
+  803e27:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803e2e:	eb 1d                	jmp    803e4d <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803e30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e34:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803e38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e3c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803e40:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803e44:	48 89 ce             	mov    %rcx,%rsi
+  803e47:	48 89 c7             	mov    %rax,%rdi
+  803e4a:	41 ff d0             	call   *%r8
+}
+  803e4d:	c9                   	leave
+  803e4e:	c3                   	ret
+
+0000000000803e4f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803e4f:	55                   	push   %rbp
+  803e50:	48 89 e5             	mov    %rsp,%rbp
+  803e53:	48 83 ec 18          	sub    $0x18,%rsp
+  803e57:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e5a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e5d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803e61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e64:	48 89 d6             	mov    %rdx,%rsi
+  803e67:	89 c7                	mov    %eax,%edi
+  803e69:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803e70:	00 00 00 
+  803e73:	ff d0                	call   *%rax
+  803e75:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e78:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e7c:	79 05                	jns    803e83 <seek+0x34>
+    return r;
+  803e7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e81:	eb 0f                	jmp    803e92 <seek+0x43>
+  fd->fd_offset = offset;
+  803e83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e87:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803e8a:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e92:	c9                   	leave
+  803e93:	c3                   	ret
+
+0000000000803e94 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803e94:	55                   	push   %rbp
+  803e95:	48 89 e5             	mov    %rsp,%rbp
+  803e98:	48 83 ec 30          	sub    $0x30,%rsp
+  803e9c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e9f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ea2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ea6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ea9:	48 89 d6             	mov    %rdx,%rsi
+  803eac:	89 c7                	mov    %eax,%edi
+  803eae:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803eb5:	00 00 00 
+  803eb8:	ff d0                	call   *%rax
+  803eba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ebd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ec1:	78 24                	js     803ee7 <ftruncate+0x53>
+  803ec3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ec7:	8b 00                	mov    (%rax),%eax
+  803ec9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803ecd:	48 89 d6             	mov    %rdx,%rsi
+  803ed0:	89 c7                	mov    %eax,%edi
+  803ed2:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803ed9:	00 00 00 
+  803edc:	ff d0                	call   *%rax
+  803ede:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ee1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ee5:	79 08                	jns    803eef <ftruncate+0x5b>
+    return r;
+  803ee7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803eea:	e9 92 00 00 00       	jmp    803f81 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803eef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ef3:	8b 40 08             	mov    0x8(%rax),%eax
+  803ef6:	83 e0 03             	and    $0x3,%eax
+  803ef9:	85 c0                	test   %eax,%eax
+  803efb:	75 5a                	jne    803f57 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803efd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f04:	00 00 00 
+  803f07:	8b 40 04             	mov    0x4(%rax),%eax
+  803f0a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f0f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f16:	00 00 00 
+  803f19:	48 98                	cltq
+  803f1b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f22:	48 01 d0             	add    %rdx,%rax
+  803f25:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803f2b:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803f2d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803f30:	89 c6                	mov    %eax,%esi
+  803f32:	48 b8 f0 6e 80 00 00 	movabs $0x806ef0,%rax
+  803f39:	00 00 00 
+  803f3c:	48 89 c7             	mov    %rax,%rdi
+  803f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f44:	48 b9 66 06 80 00 00 	movabs $0x800666,%rcx
+  803f4b:	00 00 00 
+  803f4e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803f50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f55:	eb 2a                	jmp    803f81 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803f57:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f5b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803f5f:	48 85 c0             	test   %rax,%rax
+  803f62:	75 07                	jne    803f6b <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803f64:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803f69:	eb 16                	jmp    803f81 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803f6b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f6f:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803f73:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f77:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803f7a:	89 d6                	mov    %edx,%esi
+  803f7c:	48 89 c7             	mov    %rax,%rdi
+  803f7f:	ff d1                	call   *%rcx
+}
+  803f81:	c9                   	leave
+  803f82:	c3                   	ret
+
+0000000000803f83 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803f83:	55                   	push   %rbp
+  803f84:	48 89 e5             	mov    %rsp,%rbp
+  803f87:	48 83 ec 30          	sub    $0x30,%rsp
+  803f8b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803f8e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f92:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803f96:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f99:	48 89 d6             	mov    %rdx,%rsi
+  803f9c:	89 c7                	mov    %eax,%edi
+  803f9e:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  803fa5:	00 00 00 
+  803fa8:	ff d0                	call   *%rax
+  803faa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fb1:	78 24                	js     803fd7 <fstat+0x54>
+  803fb3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fb7:	8b 00                	mov    (%rax),%eax
+  803fb9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803fbd:	48 89 d6             	mov    %rdx,%rsi
+  803fc0:	89 c7                	mov    %eax,%edi
+  803fc2:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  803fc9:	00 00 00 
+  803fcc:	ff d0                	call   *%rax
+  803fce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fd1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fd5:	79 05                	jns    803fdc <fstat+0x59>
+    return r;
+  803fd7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fda:	eb 5e                	jmp    80403a <fstat+0xb7>
+  if (!dev->dev_stat)
+  803fdc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fe0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803fe4:	48 85 c0             	test   %rax,%rax
+  803fe7:	75 07                	jne    803ff0 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803fe9:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803fee:	eb 4a                	jmp    80403a <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803ff0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ff4:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803ff7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ffb:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804002:	00 00 00 
+  stat->st_isdir   = 0;
+  804005:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804009:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804010:	00 00 00 
+  stat->st_dev     = dev;
+  804013:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804017:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80401b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  804022:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804026:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80402a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80402e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804032:	48 89 d6             	mov    %rdx,%rsi
+  804035:	48 89 c7             	mov    %rax,%rdi
+  804038:	ff d1                	call   *%rcx
+}
+  80403a:	c9                   	leave
+  80403b:	c3                   	ret
+
+000000000080403c <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80403c:	55                   	push   %rbp
+  80403d:	48 89 e5             	mov    %rsp,%rbp
+  804040:	48 83 ec 10          	sub    $0x10,%rsp
+  804044:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804048:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80404c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804050:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804056:	83 f8 20             	cmp    $0x20,%eax
+  804059:	75 07                	jne    804062 <pollwait_key+0x26>
+    return -E_INVAL;
+  80405b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804060:	eb 5f                	jmp    8040c1 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  804062:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804066:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80406c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804070:	48 63 d2             	movslq %edx,%rdx
+  804073:	48 c1 e2 04          	shl    $0x4,%rdx
+  804077:	48 01 c2             	add    %rax,%rdx
+  80407a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80407e:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  804081:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804085:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80408b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80408f:	8b 00                	mov    (%rax),%eax
+  804091:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804095:	48 63 c9             	movslq %ecx,%rcx
+  804098:	48 c1 e1 04          	shl    $0x4,%rcx
+  80409c:	48 01 ca             	add    %rcx,%rdx
+  80409f:	48 83 c2 08          	add    $0x8,%rdx
+  8040a3:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8040a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040a9:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8040af:	8d 50 01             	lea    0x1(%rax),%edx
+  8040b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040b6:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8040bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040c1:	c9                   	leave
+  8040c2:	c3                   	ret
+
+00000000008040c3 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8040c3:	55                   	push   %rbp
+  8040c4:	48 89 e5             	mov    %rsp,%rbp
+  8040c7:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8040ce:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8040d5:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8040db:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8040e2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8040e9:	00 
+  int i, r, ready, ipc = 0;
+  8040ea:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8040f1:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8040f8:	00 
+  8040f9:	74 45                	je     804140 <poll+0x7d>
+  8040fb:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  804102:	ff 
+  804103:	74 3b                	je     804140 <poll+0x7d>
+    now      = vsys_clock_ns();
+  804105:	48 b8 2e 5b 80 00 00 	movabs $0x805b2e,%rax
+  80410c:	00 00 00 
+  80410f:	ff d0                	call   *%rax
+  804111:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  804115:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804119:	48 f7 d0             	not    %rax
+  80411c:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  804123:	73 10                	jae    804135 <poll+0x72>
+  804125:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804129:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  804130:	48 01 d0             	add    %rdx,%rax
+  804133:	eb 07                	jmp    80413c <poll+0x79>
+  804135:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80413c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  804140:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  804147:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80414e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804155:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80415c:	e9 46 02 00 00       	jmp    8043a7 <poll+0x2e4>
+      fds[i].revents = 0;
+  804161:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804164:	48 63 d0             	movslq %eax,%rdx
+  804167:	48 89 d0             	mov    %rdx,%rax
+  80416a:	48 01 c0             	add    %rax,%rax
+  80416d:	48 01 d0             	add    %rdx,%rax
+  804170:	48 c1 e0 02          	shl    $0x2,%rax
+  804174:	48 89 c2             	mov    %rax,%rdx
+  804177:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80417e:	48 01 d0             	add    %rdx,%rax
+  804181:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  804188:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80418b:	48 63 d0             	movslq %eax,%rdx
+  80418e:	48 89 d0             	mov    %rdx,%rax
+  804191:	48 01 c0             	add    %rax,%rax
+  804194:	48 01 d0             	add    %rdx,%rax
+  804197:	48 c1 e0 02          	shl    $0x2,%rax
+  80419b:	48 89 c2             	mov    %rax,%rdx
+  80419e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8041a5:	48 01 d0             	add    %rdx,%rax
+  8041a8:	8b 00                	mov    (%rax),%eax
+  8041aa:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8041ad:	75 62                	jne    804211 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8041af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041b2:	48 63 d0             	movslq %eax,%rdx
+  8041b5:	48 89 d0             	mov    %rdx,%rax
+  8041b8:	48 01 c0             	add    %rax,%rax
+  8041bb:	48 01 d0             	add    %rdx,%rax
+  8041be:	48 c1 e0 02          	shl    $0x2,%rax
+  8041c2:	48 89 c2             	mov    %rax,%rdx
+  8041c5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8041cc:	48 01 d0             	add    %rdx,%rax
+  8041cf:	8b 40 04             	mov    0x4(%rax),%eax
+  8041d2:	83 e0 01             	and    $0x1,%eax
+  8041d5:	85 c0                	test   %eax,%eax
+  8041d7:	0f 84 9b 01 00 00    	je     804378 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8041dd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041e0:	48 63 d0             	movslq %eax,%rdx
+  8041e3:	48 89 d0             	mov    %rdx,%rax
+  8041e6:	48 01 c0             	add    %rax,%rax
+  8041e9:	48 01 d0             	add    %rdx,%rax
+  8041ec:	48 c1 e0 02          	shl    $0x2,%rax
+  8041f0:	48 89 c2             	mov    %rax,%rdx
+  8041f3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8041fa:	48 01 c2             	add    %rax,%rdx
+  8041fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804200:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  804203:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804206:	83 c8 04             	or     $0x4,%eax
+  804209:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80420c:	e9 67 01 00 00       	jmp    804378 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804211:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804214:	48 63 d0             	movslq %eax,%rdx
+  804217:	48 89 d0             	mov    %rdx,%rax
+  80421a:	48 01 c0             	add    %rax,%rax
+  80421d:	48 01 d0             	add    %rdx,%rax
+  804220:	48 c1 e0 02          	shl    $0x2,%rax
+  804224:	48 89 c2             	mov    %rax,%rdx
+  804227:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80422e:	48 01 d0             	add    %rdx,%rax
+  804231:	8b 00                	mov    (%rax),%eax
+  804233:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80423a:	48 89 d6             	mov    %rdx,%rsi
+  80423d:	89 c7                	mov    %eax,%edi
+  80423f:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  804246:	00 00 00 
+  804249:	ff d0                	call   *%rax
+  80424b:	85 c0                	test   %eax,%eax
+  80424d:	78 25                	js     804274 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80424f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804256:	8b 00                	mov    (%rax),%eax
+  804258:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80425f:	48 89 d6             	mov    %rdx,%rsi
+  804262:	89 c7                	mov    %eax,%edi
+  804264:	48 b8 17 38 80 00 00 	movabs $0x803817,%rax
+  80426b:	00 00 00 
+  80426e:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804270:	85 c0                	test   %eax,%eax
+  804272:	79 2c                	jns    8042a0 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  804274:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804277:	48 63 d0             	movslq %eax,%rdx
+  80427a:	48 89 d0             	mov    %rdx,%rax
+  80427d:	48 01 c0             	add    %rax,%rax
+  804280:	48 01 d0             	add    %rdx,%rax
+  804283:	48 c1 e0 02          	shl    $0x2,%rax
+  804287:	48 89 c2             	mov    %rax,%rdx
+  80428a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804291:	48 01 d0             	add    %rdx,%rax
+  804294:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80429b:	e9 d8 00 00 00       	jmp    804378 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8042a0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8042a7:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8042ab:	48 85 c0             	test   %rax,%rax
+  8042ae:	74 7d                	je     80432d <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8042b0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8042b7:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8042bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042be:	48 63 d0             	movslq %eax,%rdx
+  8042c1:	48 89 d0             	mov    %rdx,%rax
+  8042c4:	48 01 c0             	add    %rax,%rax
+  8042c7:	48 01 d0             	add    %rdx,%rax
+  8042ca:	48 c1 e0 02          	shl    $0x2,%rax
+  8042ce:	48 89 c2             	mov    %rax,%rdx
+  8042d1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8042d8:	48 01 d0             	add    %rdx,%rax
+  8042db:	8b 48 04             	mov    0x4(%rax),%ecx
+  8042de:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8042e5:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8042ec:	89 ce                	mov    %ecx,%esi
+  8042ee:	48 89 c7             	mov    %rax,%rdi
+  8042f1:	41 ff d0             	call   *%r8
+  8042f4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8042f7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8042fb:	79 08                	jns    804305 <poll+0x242>
+          return r;
+  8042fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804300:	e9 45 01 00 00       	jmp    80444a <poll+0x387>
+        fds[i].revents = r;
+  804305:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804308:	48 63 d0             	movslq %eax,%rdx
+  80430b:	48 89 d0             	mov    %rdx,%rax
+  80430e:	48 01 c0             	add    %rax,%rax
+  804311:	48 01 d0             	add    %rdx,%rax
+  804314:	48 c1 e0 02          	shl    $0x2,%rax
+  804318:	48 89 c2             	mov    %rax,%rdx
+  80431b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804322:	48 01 c2             	add    %rax,%rdx
+  804325:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804328:	89 42 08             	mov    %eax,0x8(%rdx)
+  80432b:	eb 4b                	jmp    804378 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80432d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804330:	48 63 d0             	movslq %eax,%rdx
+  804333:	48 89 d0             	mov    %rdx,%rax
+  804336:	48 01 c0             	add    %rax,%rax
+  804339:	48 01 d0             	add    %rdx,%rax
+  80433c:	48 c1 e0 02          	shl    $0x2,%rax
+  804340:	48 89 c2             	mov    %rax,%rdx
+  804343:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80434a:	48 01 d0             	add    %rdx,%rax
+  80434d:	8b 48 04             	mov    0x4(%rax),%ecx
+  804350:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804353:	48 63 d0             	movslq %eax,%rdx
+  804356:	48 89 d0             	mov    %rdx,%rax
+  804359:	48 01 c0             	add    %rax,%rax
+  80435c:	48 01 d0             	add    %rdx,%rax
+  80435f:	48 c1 e0 02          	shl    $0x2,%rax
+  804363:	48 89 c2             	mov    %rax,%rdx
+  804366:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80436d:	48 01 d0             	add    %rdx,%rax
+  804370:	83 e1 03             	and    $0x3,%ecx
+  804373:	89 ca                	mov    %ecx,%edx
+  804375:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804378:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80437b:	48 63 d0             	movslq %eax,%rdx
+  80437e:	48 89 d0             	mov    %rdx,%rax
+  804381:	48 01 c0             	add    %rax,%rax
+  804384:	48 01 d0             	add    %rdx,%rax
+  804387:	48 c1 e0 02          	shl    $0x2,%rax
+  80438b:	48 89 c2             	mov    %rax,%rdx
+  80438e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804395:	48 01 d0             	add    %rdx,%rax
+  804398:	8b 40 08             	mov    0x8(%rax),%eax
+  80439b:	85 c0                	test   %eax,%eax
+  80439d:	74 04                	je     8043a3 <poll+0x2e0>
+        ready++;
+  80439f:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8043a3:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8043a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043aa:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8043b0:	0f 8c ab fd ff ff    	jl     804161 <poll+0x9e>
+    }
+    if (ready)
+  8043b6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8043ba:	74 08                	je     8043c4 <poll+0x301>
+      return ready;
+  8043bc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8043bf:	e9 86 00 00 00       	jmp    80444a <poll+0x387>
+
+    if (deadline) {
+  8043c4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8043c9:	74 30                	je     8043fb <poll+0x338>
+      now     = vsys_clock_ns();
+  8043cb:	48 b8 2e 5b 80 00 00 	movabs $0x805b2e,%rax
+  8043d2:	00 00 00 
+  8043d5:	ff d0                	call   *%rax
+  8043d7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8043db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043df:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8043e3:	73 0a                	jae    8043ef <poll+0x32c>
+  8043e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e9:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8043ed:	eb 05                	jmp    8043f4 <poll+0x331>
+  8043ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f4:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8043fb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8043fe:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804401:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804408:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80440f:	48 89 c7             	mov    %rax,%rdi
+  804412:	48 b8 2c 28 80 00 00 	movabs $0x80282c,%rax
+  804419:	00 00 00 
+  80441c:	ff d0                	call   *%rax
+  80441e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  804421:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  804425:	75 07                	jne    80442e <poll+0x36b>
+      return 0;
+  804427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80442c:	eb 1c                	jmp    80444a <poll+0x387>
+    if (r < 0)
+  80442e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804432:	79 05                	jns    804439 <poll+0x376>
+      return r;
+  804434:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804437:	eb 11                	jmp    80444a <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804439:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80443c:	c1 f8 02             	sar    $0x2,%eax
+  80443f:	83 e0 01             	and    $0x1,%eax
+  804442:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  804445:	e9 f6 fc ff ff       	jmp    804140 <poll+0x7d>
+  }
+}
+  80444a:	c9                   	leave
+  80444b:	c3                   	ret
+
+000000000080444c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80444c:	55                   	push   %rbp
+  80444d:	48 89 e5             	mov    %rsp,%rbp
+  804450:	48 83 ec 20          	sub    $0x20,%rsp
+  804454:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804458:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80445c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804460:	be 00 00 00 00       	mov    $0x0,%esi
+  804465:	48 89 c7             	mov    %rax,%rdi
+  804468:	48 b8 3a 45 80 00 00 	movabs $0x80453a,%rax
+  80446f:	00 00 00 
+  804472:	ff d0                	call   *%rax
+  804474:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804477:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80447b:	79 05                	jns    804482 <stat+0x36>
+    return fd;
+  80447d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804480:	eb 2f                	jmp    8044b1 <stat+0x65>
+  r = fstat(fd, stat);
+  804482:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804486:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804489:	48 89 d6             	mov    %rdx,%rsi
+  80448c:	89 c7                	mov    %eax,%edi
+  80448e:	48 b8 83 3f 80 00 00 	movabs $0x803f83,%rax
+  804495:	00 00 00 
+  804498:	ff d0                	call   *%rax
+  80449a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80449d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044a0:	89 c7                	mov    %eax,%edi
+  8044a2:	48 b8 eb 38 80 00 00 	movabs $0x8038eb,%rax
+  8044a9:	00 00 00 
+  8044ac:	ff d0                	call   *%rax
+  return r;
+  8044ae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8044b1:	c9                   	leave
+  8044b2:	c3                   	ret
+
+00000000008044b3 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8044b3:	55                   	push   %rbp
+  8044b4:	48 89 e5             	mov    %rsp,%rbp
+  8044b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8044bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8044be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8044c2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8044c9:	00 00 00 
+  8044cc:	8b 00                	mov    (%rax),%eax
+  8044ce:	85 c0                	test   %eax,%eax
+  8044d0:	75 1d                	jne    8044ef <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8044d2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8044d7:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  8044de:	00 00 00 
+  8044e1:	ff d0                	call   *%rax
+  8044e3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8044ea:	00 00 00 
+  8044ed:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8044ef:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8044f6:	00 00 00 
+  8044f9:	8b 00                	mov    (%rax),%eax
+  8044fb:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8044fe:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804503:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80450a:	00 00 00 
+  80450d:	89 c7                	mov    %eax,%edi
+  80450f:	48 b8 28 34 80 00 00 	movabs $0x803428,%rax
+  804516:	00 00 00 
+  804519:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80451b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80451f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804524:	48 89 c6             	mov    %rax,%rsi
+  804527:	bf 00 00 00 00       	mov    $0x0,%edi
+  80452c:	48 b8 ab 32 80 00 00 	movabs $0x8032ab,%rax
+  804533:	00 00 00 
+  804536:	ff d0                	call   *%rax
+}
+  804538:	c9                   	leave
+  804539:	c3                   	ret
+
+000000000080453a <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80453a:	55                   	push   %rbp
+  80453b:	48 89 e5             	mov    %rsp,%rbp
+  80453e:	48 83 ec 20          	sub    $0x20,%rsp
+  804542:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804546:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804549:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80454d:	48 89 c7             	mov    %rax,%rdi
+  804550:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  804557:	00 00 00 
+  80455a:	ff d0                	call   *%rax
+  80455c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804561:	7e 0a                	jle    80456d <open+0x33>
+    return -E_BAD_PATH;
+  804563:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804568:	e9 a8 00 00 00       	jmp    804615 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80456d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804571:	48 89 c7             	mov    %rax,%rdi
+  804574:	48 b8 94 35 80 00 00 	movabs $0x803594,%rax
+  80457b:	00 00 00 
+  80457e:	ff d0                	call   *%rax
+  804580:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804583:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804587:	79 08                	jns    804591 <open+0x57>
+    return r;
+  804589:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80458c:	e9 84 00 00 00       	jmp    804615 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804591:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804595:	48 89 c6             	mov    %rax,%rsi
+  804598:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80459f:	00 00 00 
+  8045a2:	48 89 c7             	mov    %rax,%rdi
+  8045a5:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  8045ac:	00 00 00 
+  8045af:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8045b1:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8045b8:	00 00 00 
+  8045bb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045be:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8045c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045c8:	48 89 c6             	mov    %rax,%rsi
+  8045cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8045d0:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  8045d7:	00 00 00 
+  8045da:	ff d0                	call   *%rax
+  8045dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8045df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045e3:	79 1d                	jns    804602 <open+0xc8>
+    fd_close(fd, 0);
+  8045e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8045ee:	48 89 c7             	mov    %rax,%rdi
+  8045f1:	48 b8 4c 37 80 00 00 	movabs $0x80374c,%rax
+  8045f8:	00 00 00 
+  8045fb:	ff d0                	call   *%rax
+    return r;
+  8045fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804600:	eb 13                	jmp    804615 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804602:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804606:	48 89 c7             	mov    %rax,%rdi
+  804609:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+}
+  804615:	c9                   	leave
+  804616:	c3                   	ret
+
+0000000000804617 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804617:	55                   	push   %rbp
+  804618:	48 89 e5             	mov    %rsp,%rbp
+  80461b:	48 83 ec 10          	sub    $0x10,%rsp
+  80461f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804623:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804627:	8b 40 0c             	mov    0xc(%rax),%eax
+  80462a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804631:	00 00 00 
+  804634:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804636:	be 00 00 00 00       	mov    $0x0,%esi
+  80463b:	bf 06 00 00 00       	mov    $0x6,%edi
+  804640:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  804647:	00 00 00 
+  80464a:	ff d0                	call   *%rax
+}
+  80464c:	c9                   	leave
+  80464d:	c3                   	ret
+
+000000000080464e <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80464e:	55                   	push   %rbp
+  80464f:	48 89 e5             	mov    %rsp,%rbp
+  804652:	48 83 ec 30          	sub    $0x30,%rsp
+  804656:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80465a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80465e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804662:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804667:	74 07                	je     804670 <devfile_read+0x22>
+  804669:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80466e:	75 0a                	jne    80467a <devfile_read+0x2c>
+  return E_INVAL;
+  804670:	b8 03 00 00 00       	mov    $0x3,%eax
+  804675:	e9 b4 00 00 00       	jmp    80472e <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  80467a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804681:	00 
+  while (n) {
+  804682:	e9 98 00 00 00       	jmp    80471f <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804687:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80468b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80468e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804695:	00 00 00 
+  804698:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80469a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8046a1:	00 00 00 
+  8046a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8046a8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8046ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8046b1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8046b6:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  8046bd:	00 00 00 
+  8046c0:	ff d0                	call   *%rax
+  8046c2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8046c5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8046c9:	7f 13                	jg     8046de <devfile_read+0x90>
+      return res ? res : res0;
+  8046cb:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8046cf:	74 07                	je     8046d8 <devfile_read+0x8a>
+  8046d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046d4:	48 98                	cltq
+  8046d6:	eb 56                	jmp    80472e <devfile_read+0xe0>
+  8046d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046dc:	eb 50                	jmp    80472e <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8046de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046e1:	48 63 d0             	movslq %eax,%rdx
+  8046e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046e8:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8046ef:	00 00 00 
+  8046f2:	48 89 ce             	mov    %rcx,%rsi
+  8046f5:	48 89 c7             	mov    %rax,%rdi
+  8046f8:	48 b8 5f 1d 80 00 00 	movabs $0x801d5f,%rax
+  8046ff:	00 00 00 
+  804702:	ff d0                	call   *%rax
+
+    buf += res;
+  804704:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804707:	48 98                	cltq
+  804709:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80470d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804710:	48 98                	cltq
+  804712:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804716:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804719:	48 98                	cltq
+  80471b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80471f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804724:	0f 85 5d ff ff ff    	jne    804687 <devfile_read+0x39>
+  }
+
+  return res0;
+  80472a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80472e:	c9                   	leave
+  80472f:	c3                   	ret
+
+0000000000804730 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804730:	55                   	push   %rbp
+  804731:	48 89 e5             	mov    %rsp,%rbp
+  804734:	48 83 ec 50          	sub    $0x50,%rsp
+  804738:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80473c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804740:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804744:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804749:	74 07                	je     804752 <devfile_write+0x22>
+  80474b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804750:	75 0a                	jne    80475c <devfile_write+0x2c>
+  return E_INVAL;
+  804752:	b8 03 00 00 00       	mov    $0x3,%eax
+  804757:	e9 c9 00 00 00       	jmp    804825 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80475c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804763:	00 
+
+  while (n) {
+  804764:	e9 ad 00 00 00       	jmp    804816 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804769:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80476d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804771:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804778:	00 
+  804779:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80477d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804781:	48 39 c2             	cmp    %rax,%rdx
+  804784:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804788:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  80478c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804790:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804794:	48 89 c6             	mov    %rax,%rsi
+  804797:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  80479e:	00 00 00 
+  8047a1:	48 89 c7             	mov    %rax,%rdi
+  8047a4:	48 b8 5f 1d 80 00 00 	movabs $0x801d5f,%rax
+  8047ab:	00 00 00 
+  8047ae:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8047b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047b4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8047b7:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8047be:	00 00 00 
+  8047c1:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8047c3:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8047ca:	00 00 00 
+  8047cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047d1:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8047d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8047da:	bf 04 00 00 00       	mov    $0x4,%edi
+  8047df:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  8047e6:	00 00 00 
+  8047e9:	ff d0                	call   *%rax
+  8047eb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8047ee:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8047f2:	79 07                	jns    8047fb <devfile_write+0xcb>
+      return res;
+  8047f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047f7:	48 98                	cltq
+  8047f9:	eb 2a                	jmp    804825 <devfile_write+0xf5>
+
+    buf += res;
+  8047fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047fe:	48 98                	cltq
+  804800:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804804:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804807:	48 98                	cltq
+  804809:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80480d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804810:	48 98                	cltq
+  804812:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804816:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80481b:	0f 85 48 ff ff ff    	jne    804769 <devfile_write+0x39>
+  }
+
+  return res0;
+  804821:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804825:	c9                   	leave
+  804826:	c3                   	ret
+
+0000000000804827 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804827:	55                   	push   %rbp
+  804828:	48 89 e5             	mov    %rsp,%rbp
+  80482b:	48 83 ec 20          	sub    $0x20,%rsp
+  80482f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804833:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804837:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80483b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80483e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804845:	00 00 00 
+  804848:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80484a:	be 00 00 00 00       	mov    $0x0,%esi
+  80484f:	bf 05 00 00 00       	mov    $0x5,%edi
+  804854:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  80485b:	00 00 00 
+  80485e:	ff d0                	call   *%rax
+  804860:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804863:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804867:	79 05                	jns    80486e <devfile_stat+0x47>
+    return r;
+  804869:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80486c:	eb 59                	jmp    8048c7 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80486e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804872:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804879:	00 00 00 
+  80487c:	48 89 d6             	mov    %rdx,%rsi
+  80487f:	48 89 c7             	mov    %rax,%rdi
+  804882:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  804889:	00 00 00 
+  80488c:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  80488e:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804895:	00 00 00 
+  804898:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  80489e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048a2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8048a8:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8048af:	00 00 00 
+  8048b2:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8048b8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048bc:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8048c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048c7:	c9                   	leave
+  8048c8:	c3                   	ret
+
+00000000008048c9 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8048c9:	55                   	push   %rbp
+  8048ca:	48 89 e5             	mov    %rsp,%rbp
+  8048cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8048d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8048d5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8048d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048dc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8048df:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8048e6:	00 00 00 
+  8048e9:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8048eb:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8048f2:	00 00 00 
+  8048f5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8048f8:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8048fb:	be 00 00 00 00       	mov    $0x0,%esi
+  804900:	bf 02 00 00 00       	mov    $0x2,%edi
+  804905:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  80490c:	00 00 00 
+  80490f:	ff d0                	call   *%rax
+}
+  804911:	c9                   	leave
+  804912:	c3                   	ret
+
+0000000000804913 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804913:	55                   	push   %rbp
+  804914:	48 89 e5             	mov    %rsp,%rbp
+  804917:	48 83 ec 18          	sub    $0x18,%rsp
+  80491b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80491f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804922:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804926:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804929:	83 e0 03             	and    $0x3,%eax
+}
+  80492c:	c9                   	leave
+  80492d:	c3                   	ret
+
+000000000080492e <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  80492e:	55                   	push   %rbp
+  80492f:	48 89 e5             	mov    %rsp,%rbp
+  804932:	48 83 ec 10          	sub    $0x10,%rsp
+  804936:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  80493a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80493e:	48 89 c7             	mov    %rax,%rdi
+  804941:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  804948:	00 00 00 
+  80494b:	ff d0                	call   *%rax
+  80494d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804952:	7e 07                	jle    80495b <remove+0x2d>
+    return -E_BAD_PATH;
+  804954:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804959:	eb 36                	jmp    804991 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  80495b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80495f:	48 89 c6             	mov    %rax,%rsi
+  804962:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804969:	00 00 00 
+  80496c:	48 89 c7             	mov    %rax,%rdi
+  80496f:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  804976:	00 00 00 
+  804979:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  80497b:	be 00 00 00 00       	mov    $0x0,%esi
+  804980:	bf 07 00 00 00       	mov    $0x7,%edi
+  804985:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  80498c:	00 00 00 
+  80498f:	ff d0                	call   *%rax
+}
+  804991:	c9                   	leave
+  804992:	c3                   	ret
+
+0000000000804993 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804993:	55                   	push   %rbp
+  804994:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804997:	be 00 00 00 00       	mov    $0x0,%esi
+  80499c:	bf 08 00 00 00       	mov    $0x8,%edi
+  8049a1:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  8049a8:	00 00 00 
+  8049ab:	ff d0                	call   *%rax
+}
+  8049ad:	5d                   	pop    %rbp
+  8049ae:	c3                   	ret
+
+00000000008049af <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8049af:	55                   	push   %rbp
+  8049b0:	48 89 e5             	mov    %rsp,%rbp
+  8049b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8049b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8049bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8049c0:	bf 09 00 00 00       	mov    $0x9,%edi
+  8049c5:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  8049cc:	00 00 00 
+  8049cf:	ff d0                	call   *%rax
+  8049d1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8049d4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049d8:	79 05                	jns    8049df <fs_stats+0x30>
+    return r;
+  8049da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049dd:	eb 2a                	jmp    804a09 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8049df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049e3:	ba 68 00 00 00       	mov    $0x68,%edx
+  8049e8:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8049ef:	00 00 00 
+  8049f2:	48 89 ce             	mov    %rcx,%rsi
+  8049f5:	48 89 c7             	mov    %rax,%rdi
+  8049f8:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  8049ff:	00 00 00 
+  804a02:	ff d0                	call   *%rax
+  return 0;
+  804a04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a09:	c9                   	leave
+  804a0a:	c3                   	ret
+
+0000000000804a0b <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804a0b:	55                   	push   %rbp
+  804a0c:	48 89 e5             	mov    %rsp,%rbp
+  804a0f:	48 83 ec 10          	sub    $0x10,%rsp
+  804a13:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804a16:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804a1d:	00 00 00 
+  804a20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a23:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804a25:	be 00 00 00 00       	mov    $0x0,%esi
+  804a2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804a2f:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  804a36:	00 00 00 
+  804a39:	ff d0                	call   *%rax
+}
+  804a3b:	c9                   	leave
+  804a3c:	c3                   	ret
+
+0000000000804a3d <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804a3d:	55                   	push   %rbp
+  804a3e:	48 89 e5             	mov    %rsp,%rbp
+  804a41:	48 83 ec 10          	sub    $0x10,%rsp
+  804a45:	89 f8                	mov    %edi,%eax
+  804a47:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804a4a:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804a4e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804a55:	00 00 00 
+  804a58:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804a5a:	be 00 00 00 00       	mov    $0x0,%esi
+  804a5f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804a64:	48 b8 b3 44 80 00 00 	movabs $0x8044b3,%rax
+  804a6b:	00 00 00 
+  804a6e:	ff d0                	call   *%rax
+}
+  804a70:	c9                   	leave
+  804a71:	c3                   	ret
+
+0000000000804a72 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804a72:	55                   	push   %rbp
+  804a73:	48 89 e5             	mov    %rsp,%rbp
+  804a76:	48 83 ec 18          	sub    $0x18,%rsp
+  804a7a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804a7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a82:	48 c1 e8 27          	shr    $0x27,%rax
+  804a86:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804a8b:	48 89 c2             	mov    %rax,%rdx
+  804a8e:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804a95:	01 00 00 
+  804a98:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804a9c:	83 e0 01             	and    $0x1,%eax
+  804a9f:	48 85 c0             	test   %rax,%rax
+  804aa2:	74 63                	je     804b07 <pageref+0x95>
+  804aa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aa8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804aac:	48 89 c2             	mov    %rax,%rdx
+  804aaf:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  804ab6:	01 00 00 
+  804ab9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804abd:	83 e0 01             	and    $0x1,%eax
+  804ac0:	48 85 c0             	test   %rax,%rax
+  804ac3:	74 42                	je     804b07 <pageref+0x95>
+  804ac5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ac9:	48 c1 e8 15          	shr    $0x15,%rax
+  804acd:	48 89 c2             	mov    %rax,%rdx
+  804ad0:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  804ad7:	01 00 00 
+  804ada:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804ade:	83 e0 01             	and    $0x1,%eax
+  804ae1:	48 85 c0             	test   %rax,%rax
+  804ae4:	74 21                	je     804b07 <pageref+0x95>
+  804ae6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aea:	48 c1 e8 0c          	shr    $0xc,%rax
+  804aee:	48 89 c2             	mov    %rax,%rdx
+  804af1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804af8:	01 00 00 
+  804afb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804aff:	83 e0 01             	and    $0x1,%eax
+  804b02:	48 85 c0             	test   %rax,%rax
+  804b05:	75 07                	jne    804b0e <pageref+0x9c>
+    return 0;
+  804b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b0c:	eb 53                	jmp    804b61 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  804b0e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b12:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b16:	48 89 c2             	mov    %rax,%rdx
+  804b19:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804b20:	01 00 00 
+  804b23:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804b27:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  804b2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b2f:	83 e0 01             	and    $0x1,%eax
+  804b32:	48 85 c0             	test   %rax,%rax
+  804b35:	75 07                	jne    804b3e <pageref+0xcc>
+    return 0;
+  804b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b3c:	eb 23                	jmp    804b61 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  804b3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b42:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b46:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  804b4d:	00 00 00 
+  804b50:	48 c1 e0 04          	shl    $0x4,%rax
+  804b54:	48 01 d0             	add    %rdx,%rax
+  804b57:	48 83 c0 08          	add    $0x8,%rax
+  804b5b:	0f b7 00             	movzwl (%rax),%eax
+  804b5e:	0f b7 c0             	movzwl %ax,%eax
+}
+  804b61:	c9                   	leave
+  804b62:	c3                   	ret
+
+0000000000804b63 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804b63:	55                   	push   %rbp
+  804b64:	48 89 e5             	mov    %rsp,%rbp
+  804b67:	48 83 ec 10          	sub    $0x10,%rsp
+  804b6b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804b6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b73:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804b78:	48 89 c7             	mov    %rax,%rdi
+  804b7b:	48 b8 89 4b 80 00 00 	movabs $0x804b89,%rax
+  804b82:	00 00 00 
+  804b85:	ff d0                	call   *%rax
+}
+  804b87:	c9                   	leave
+  804b88:	c3                   	ret
+
+0000000000804b89 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804b89:	55                   	push   %rbp
+  804b8a:	48 89 e5             	mov    %rsp,%rbp
+  804b8d:	48 83 ec 50          	sub    $0x50,%rsp
+  804b91:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804b95:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804b99:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804ba0:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804ba1:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804ba6:	74 0a                	je     804bb2 <pipe_size+0x29>
+  804ba8:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804baf:	00 
+  804bb0:	76 0a                	jbe    804bbc <pipe_size+0x33>
+    return -E_INVAL;
+  804bb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804bb7:	e9 cc 02 00 00       	jmp    804e88 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804bbc:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804bc0:	48 89 c7             	mov    %rax,%rdi
+  804bc3:	48 b8 94 35 80 00 00 	movabs $0x803594,%rax
+  804bca:	00 00 00 
+  804bcd:	ff d0                	call   *%rax
+  804bcf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bd2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bd6:	0f 88 a8 02 00 00    	js     804e84 <pipe_size+0x2fb>
+  804bdc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804be0:	ba 07 04 00 00       	mov    $0x407,%edx
+  804be5:	48 89 c6             	mov    %rax,%rsi
+  804be8:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bed:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  804bf4:	00 00 00 
+  804bf7:	ff d0                	call   *%rax
+  804bf9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bfc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c00:	0f 88 7e 02 00 00    	js     804e84 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804c06:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804c0a:	48 89 c7             	mov    %rax,%rdi
+  804c0d:	48 b8 94 35 80 00 00 	movabs $0x803594,%rax
+  804c14:	00 00 00 
+  804c17:	ff d0                	call   *%rax
+  804c19:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c1c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c20:	0f 88 43 02 00 00    	js     804e69 <pipe_size+0x2e0>
+  804c26:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c2a:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c2f:	48 89 c6             	mov    %rax,%rsi
+  804c32:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c37:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  804c3e:	00 00 00 
+  804c41:	ff d0                	call   *%rax
+  804c43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c4a:	0f 88 19 02 00 00    	js     804e69 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804c50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c54:	48 89 c7             	mov    %rax,%rdi
+  804c57:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  804c5e:	00 00 00 
+  804c61:	ff d0                	call   *%rax
+  804c63:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804c67:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804c6e:	00 
+  804c6f:	e9 a2 00 00 00       	jmp    804d16 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804c74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c78:	48 c1 e0 0c          	shl    $0xc,%rax
+  804c7c:	48 89 c2             	mov    %rax,%rdx
+  804c7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c83:	48 01 d0             	add    %rdx,%rax
+  804c86:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c8b:	48 89 c6             	mov    %rax,%rsi
+  804c8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c93:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  804c9a:	00 00 00 
+  804c9d:	ff d0                	call   *%rax
+  804c9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ca2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ca6:	0f 88 37 01 00 00    	js     804de3 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804cac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cb0:	48 89 c7             	mov    %rax,%rdi
+  804cb3:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  804cba:	00 00 00 
+  804cbd:	ff d0                	call   *%rax
+  804cbf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804cc3:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804cc7:	48 01 c2             	add    %rax,%rdx
+  804cca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cce:	48 c1 e0 0c          	shl    $0xc,%rax
+  804cd2:	48 89 c1             	mov    %rax,%rcx
+  804cd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cd9:	48 01 c8             	add    %rcx,%rax
+  804cdc:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804ce2:	48 89 d1             	mov    %rdx,%rcx
+  804ce5:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cea:	48 89 c6             	mov    %rax,%rsi
+  804ced:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cf2:	48 b8 3c 24 80 00 00 	movabs $0x80243c,%rax
+  804cf9:	00 00 00 
+  804cfc:	ff d0                	call   *%rax
+  804cfe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804d01:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d05:	79 0a                	jns    804d11 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804d07:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804d0c:	e9 d3 00 00 00       	jmp    804de4 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804d11:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804d16:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804d1d:	00 
+  804d1e:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804d22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d26:	48 01 d0             	add    %rdx,%rax
+  804d29:	48 83 c0 1f          	add    $0x1f,%rax
+  804d2d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804d31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d35:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d3a:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804d3e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d42:	48 29 d0             	sub    %rdx,%rax
+  804d45:	48 c1 e8 0c          	shr    $0xc,%rax
+  804d49:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804d4d:	0f 82 21 ff ff ff    	jb     804c74 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804d53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d57:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804d5b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d5f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804d63:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804d67:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d6b:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804d72:	00 00 00 
+  804d75:	8b 12                	mov    (%rdx),%edx
+  804d77:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804d79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d7d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804d84:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d88:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804d8f:	00 00 00 
+  804d92:	8b 12                	mov    (%rdx),%edx
+  804d94:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804d96:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d9a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804da1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804da5:	48 89 c7             	mov    %rax,%rdi
+  804da8:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  804daf:	00 00 00 
+  804db2:	ff d0                	call   *%rax
+  804db4:	89 c2                	mov    %eax,%edx
+  804db6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804dba:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804dbc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804dc0:	48 89 c7             	mov    %rax,%rdi
+  804dc3:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  804dca:	00 00 00 
+  804dcd:	ff d0                	call   *%rax
+  804dcf:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804dd3:	48 83 c2 04          	add    $0x4,%rdx
+  804dd7:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dde:	e9 a5 00 00 00       	jmp    804e88 <pipe_size+0x2ff>
+      goto err2;
+  804de3:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804de4:	eb 58                	jmp    804e3e <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804de6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804dea:	48 c1 e0 0c          	shl    $0xc,%rax
+  804dee:	48 89 c2             	mov    %rax,%rdx
+  804df1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804df5:	48 01 d0             	add    %rdx,%rax
+  804df8:	48 89 c6             	mov    %rax,%rsi
+  804dfb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e00:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  804e07:	00 00 00 
+  804e0a:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804e0c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e10:	48 89 c7             	mov    %rax,%rdi
+  804e13:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  804e1a:	00 00 00 
+  804e1d:	ff d0                	call   *%rax
+  804e1f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804e23:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804e27:	48 01 d0             	add    %rdx,%rax
+  804e2a:	48 89 c6             	mov    %rax,%rsi
+  804e2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e32:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  804e39:	00 00 00 
+  804e3c:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804e3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e42:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804e46:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804e4a:	48 85 c0             	test   %rax,%rax
+  804e4d:	75 97                	jne    804de6 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804e4f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e53:	48 89 c6             	mov    %rax,%rsi
+  804e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e5b:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  804e62:	00 00 00 
+  804e65:	ff d0                	call   *%rax
+  804e67:	eb 01                	jmp    804e6a <pipe_size+0x2e1>
+    goto err1;
+  804e69:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804e6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e6e:	48 89 c6             	mov    %rax,%rsi
+  804e71:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e76:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  804e7d:	00 00 00 
+  804e80:	ff d0                	call   *%rax
+  804e82:	eb 01                	jmp    804e85 <pipe_size+0x2fc>
+    goto err;
+  804e84:	90                   	nop
+err:
+  return r;
+  804e85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804e88:	c9                   	leave
+  804e89:	c3                   	ret
+
+0000000000804e8a <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804e8a:	55                   	push   %rbp
+  804e8b:	48 89 e5             	mov    %rsp,%rbp
+  804e8e:	53                   	push   %rbx
+  804e8f:	48 83 ec 28          	sub    $0x28,%rsp
+  804e93:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804e97:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804e9b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ea2:	00 00 00 
+  804ea5:	8b 40 04             	mov    0x4(%rax),%eax
+  804ea8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ead:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804eb4:	00 00 00 
+  804eb7:	48 98                	cltq
+  804eb9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ec0:	48 01 d0             	add    %rdx,%rax
+  804ec3:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804ec9:	8b 00                	mov    (%rax),%eax
+  804ecb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804ece:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ed2:	48 89 c7             	mov    %rax,%rdi
+  804ed5:	48 b8 72 4a 80 00 00 	movabs $0x804a72,%rax
+  804edc:	00 00 00 
+  804edf:	ff d0                	call   *%rax
+  804ee1:	89 c3                	mov    %eax,%ebx
+  804ee3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ee7:	48 89 c7             	mov    %rax,%rdi
+  804eea:	48 b8 72 4a 80 00 00 	movabs $0x804a72,%rax
+  804ef1:	00 00 00 
+  804ef4:	ff d0                	call   *%rax
+  804ef6:	39 c3                	cmp    %eax,%ebx
+  804ef8:	0f 94 c0             	sete   %al
+  804efb:	0f b6 c0             	movzbl %al,%eax
+  804efe:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804f01:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804f08:	00 00 00 
+  804f0b:	8b 40 04             	mov    0x4(%rax),%eax
+  804f0e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f13:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f1a:	00 00 00 
+  804f1d:	48 98                	cltq
+  804f1f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f26:	48 01 d0             	add    %rdx,%rax
+  804f29:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804f2f:	8b 00                	mov    (%rax),%eax
+  804f31:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804f34:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f37:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804f3a:	75 05                	jne    804f41 <_pipeisclosed+0xb7>
+      return ret;
+  804f3c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804f3f:	eb 68                	jmp    804fa9 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804f41:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f44:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804f47:	0f 84 4e ff ff ff    	je     804e9b <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804f4d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804f54:	00 00 00 
+  804f57:	8b 40 04             	mov    0x4(%rax),%eax
+  804f5a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f5f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f66:	00 00 00 
+  804f69:	48 98                	cltq
+  804f6b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f72:	48 01 d0             	add    %rdx,%rax
+  804f75:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804f7b:	8b 10                	mov    (%rax),%edx
+  804f7d:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804f80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f83:	89 c6                	mov    %eax,%esi
+  804f85:	48 b8 20 6f 80 00 00 	movabs $0x806f20,%rax
+  804f8c:	00 00 00 
+  804f8f:	48 89 c7             	mov    %rax,%rdi
+  804f92:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f97:	49 b8 66 06 80 00 00 	movabs $0x800666,%r8
+  804f9e:	00 00 00 
+  804fa1:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804fa4:	e9 f2 fe ff ff       	jmp    804e9b <_pipeisclosed+0x11>
+  }
+}
+  804fa9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804fad:	c9                   	leave
+  804fae:	c3                   	ret
+
+0000000000804faf <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804faf:	55                   	push   %rbp
+  804fb0:	48 89 e5             	mov    %rsp,%rbp
+  804fb3:	48 83 ec 30          	sub    $0x30,%rsp
+  804fb7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804fba:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804fbe:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804fc1:	48 89 d6             	mov    %rdx,%rsi
+  804fc4:	89 c7                	mov    %eax,%edi
+  804fc6:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  804fcd:	00 00 00 
+  804fd0:	ff d0                	call   *%rax
+  804fd2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804fd5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804fd9:	79 05                	jns    804fe0 <pipeisclosed+0x31>
+    return r;
+  804fdb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fde:	eb 31                	jmp    805011 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804fe0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fe4:	48 89 c7             	mov    %rax,%rdi
+  804fe7:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  804fee:	00 00 00 
+  804ff1:	ff d0                	call   *%rax
+  804ff3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804ff7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ffb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804fff:	48 89 d6             	mov    %rdx,%rsi
+  805002:	48 89 c7             	mov    %rax,%rdi
+  805005:	48 b8 8a 4e 80 00 00 	movabs $0x804e8a,%rax
+  80500c:	00 00 00 
+  80500f:	ff d0                	call   *%rax
+}
+  805011:	c9                   	leave
+  805012:	c3                   	ret
+
+0000000000805013 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  805013:	55                   	push   %rbp
+  805014:	48 89 e5             	mov    %rsp,%rbp
+  805017:	48 83 ec 10          	sub    $0x10,%rsp
+  80501b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80501f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805023:	8b 40 18             	mov    0x18(%rax),%eax
+  805026:	8d 50 01             	lea    0x1(%rax),%edx
+  805029:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80502d:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  805030:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805034:	8b 40 1c             	mov    0x1c(%rax),%eax
+  805037:	85 c0                	test   %eax,%eax
+  805039:	74 27                	je     805062 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80503b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80503f:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  805046:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80504a:	48 83 c0 18          	add    $0x18,%rax
+  80504e:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  805053:	48 89 c7             	mov    %rax,%rdi
+  805056:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  80505d:	00 00 00 
+  805060:	ff d0                	call   *%rax
+  }
+}
+  805062:	90                   	nop
+  805063:	c9                   	leave
+  805064:	c3                   	ret
+
+0000000000805065 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  805065:	55                   	push   %rbp
+  805066:	48 89 e5             	mov    %rsp,%rbp
+  805069:	48 83 ec 10          	sub    $0x10,%rsp
+  80506d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805071:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  805074:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805078:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  80507f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805083:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  805087:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80508a:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805091:	89 c6                	mov    %eax,%esi
+  805093:	48 89 cf             	mov    %rcx,%rdi
+  805096:	48 b8 90 27 80 00 00 	movabs $0x802790,%rax
+  80509d:	00 00 00 
+  8050a0:	ff d0                	call   *%rax
+}
+  8050a2:	90                   	nop
+  8050a3:	c9                   	leave
+  8050a4:	c3                   	ret
+
+00000000008050a5 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8050a5:	55                   	push   %rbp
+  8050a6:	48 89 e5             	mov    %rsp,%rbp
+  8050a9:	48 83 ec 70          	sub    $0x70,%rsp
+  8050ad:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8050b1:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8050b5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8050b9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8050bd:	48 89 c7             	mov    %rax,%rdi
+  8050c0:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  8050c7:	00 00 00 
+  8050ca:	ff d0                	call   *%rax
+  8050cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8050d0:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8050d5:	75 0a                	jne    8050e1 <devpipe_read+0x3c>
+    return 0;
+  8050d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050dc:	e9 63 01 00 00       	jmp    805244 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8050e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050e5:	8b 40 18             	mov    0x18(%rax),%eax
+  8050e8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8050eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050ef:	48 8b 10             	mov    (%rax),%rdx
+  8050f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050f6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8050fa:	48 39 c2             	cmp    %rax,%rdx
+  8050fd:	75 42                	jne    805141 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8050ff:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805103:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805107:	48 89 d6             	mov    %rdx,%rsi
+  80510a:	48 89 c7             	mov    %rax,%rdi
+  80510d:	48 b8 8a 4e 80 00 00 	movabs $0x804e8a,%rax
+  805114:	00 00 00 
+  805117:	ff d0                	call   *%rax
+  805119:	85 c0                	test   %eax,%eax
+  80511b:	74 0a                	je     805127 <devpipe_read+0x82>
+      return 0;
+  80511d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805122:	e9 1d 01 00 00       	jmp    805244 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  805127:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80512a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80512e:	89 d6                	mov    %edx,%esi
+  805130:	48 89 c7             	mov    %rax,%rdi
+  805133:	48 b8 65 50 80 00 00 	movabs $0x805065,%rax
+  80513a:	00 00 00 
+  80513d:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80513f:	eb a0                	jmp    8050e1 <devpipe_read+0x3c>
+      break;
+  805141:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  805142:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805146:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80514a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80514e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805152:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805156:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80515a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80515e:	48 8b 00             	mov    (%rax),%rax
+  805161:	48 29 c2             	sub    %rax,%rdx
+  805164:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805168:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80516c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805170:	48 39 c2             	cmp    %rax,%rdx
+  805173:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805177:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80517b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80517f:	48 8b 00             	mov    (%rax),%rax
+  805182:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805186:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80518a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80518f:	48 f7 f1             	div    %rcx
+  805192:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  805196:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80519a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80519e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051a2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051a6:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8051aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8051ae:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8051b2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8051b6:	48 39 c2             	cmp    %rax,%rdx
+  8051b9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8051bd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8051c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051c5:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8051c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8051cd:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8051d1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8051d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051d9:	48 89 ce             	mov    %rcx,%rsi
+  8051dc:	48 89 c7             	mov    %rax,%rdi
+  8051df:	48 b8 5f 1d 80 00 00 	movabs $0x801d5f,%rax
+  8051e6:	00 00 00 
+  8051e9:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8051eb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8051ef:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8051f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8051f7:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8051fb:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8051ff:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805203:	48 01 d1             	add    %rdx,%rcx
+  805206:	48 89 c2             	mov    %rax,%rdx
+  805209:	48 89 cf             	mov    %rcx,%rdi
+  80520c:	48 b8 5f 1d 80 00 00 	movabs $0x801d5f,%rax
+  805213:	00 00 00 
+  805216:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  805218:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80521c:	48 8b 10             	mov    (%rax),%rdx
+  80521f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805223:	48 01 c2             	add    %rax,%rdx
+  805226:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80522a:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80522d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805231:	48 89 c7             	mov    %rax,%rdi
+  805234:	48 b8 13 50 80 00 00 	movabs $0x805013,%rax
+  80523b:	00 00 00 
+  80523e:	ff d0                	call   *%rax
+  return n;
+  805240:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  805244:	c9                   	leave
+  805245:	c3                   	ret
+
+0000000000805246 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805246:	55                   	push   %rbp
+  805247:	48 89 e5             	mov    %rsp,%rbp
+  80524a:	48 83 ec 70          	sub    $0x70,%rsp
+  80524e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805252:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805256:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80525a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80525e:	48 89 c7             	mov    %rax,%rdi
+  805261:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  805268:	00 00 00 
+  80526b:	ff d0                	call   *%rax
+  80526d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  805271:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805275:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805279:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805280:	00 
+  805281:	e9 b8 01 00 00       	jmp    80543e <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  805286:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80528a:	8b 40 18             	mov    0x18(%rax),%eax
+  80528d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  805290:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805294:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805298:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80529c:	48 8b 00             	mov    (%rax),%rax
+  80529f:	48 29 c2             	sub    %rax,%rdx
+  8052a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052a6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8052aa:	48 39 c2             	cmp    %rax,%rdx
+  8052ad:	75 4d                	jne    8052fc <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8052af:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8052b3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8052b7:	48 89 d6             	mov    %rdx,%rsi
+  8052ba:	48 89 c7             	mov    %rax,%rdi
+  8052bd:	48 b8 8a 4e 80 00 00 	movabs $0x804e8a,%rax
+  8052c4:	00 00 00 
+  8052c7:	ff d0                	call   *%rax
+  8052c9:	85 c0                	test   %eax,%eax
+  8052cb:	74 0a                	je     8052d7 <devpipe_write+0x91>
+        return 0;
+  8052cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052d2:	e9 79 01 00 00       	jmp    805450 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8052d7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8052da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052de:	89 d6                	mov    %edx,%esi
+  8052e0:	48 89 c7             	mov    %rax,%rdi
+  8052e3:	48 b8 65 50 80 00 00 	movabs $0x805065,%rax
+  8052ea:	00 00 00 
+  8052ed:	ff d0                	call   *%rax
+      m = 0;
+  8052ef:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8052f6:	00 
+      continue;
+  8052f7:	e9 3a 01 00 00       	jmp    805436 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8052fc:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805300:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  805304:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805308:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80530c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805310:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805314:	48 8b 08             	mov    (%rax),%rcx
+  805317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80531b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80531f:	48 29 c1             	sub    %rax,%rcx
+  805322:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  805326:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80532a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80532e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805332:	48 39 c2             	cmp    %rax,%rdx
+  805335:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805339:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80533d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805341:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805345:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805349:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80534d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805352:	48 f7 f1             	div    %rcx
+  805355:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805359:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80535d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805361:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805365:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805369:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80536d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  805371:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805375:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805379:	48 39 c2             	cmp    %rax,%rdx
+  80537c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805380:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805384:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805388:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80538c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805390:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  805394:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805398:	48 01 d1             	add    %rdx,%rcx
+  80539b:	48 89 c2             	mov    %rax,%rdx
+  80539e:	48 89 cf             	mov    %rcx,%rdi
+  8053a1:	48 b8 5f 1d 80 00 00 	movabs $0x801d5f,%rax
+  8053a8:	00 00 00 
+  8053ab:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8053ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053b1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8053b5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8053b9:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8053bd:	73 4d                	jae    80540c <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8053bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053c3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8053c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8053cb:	48 29 c2             	sub    %rax,%rdx
+  8053ce:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053d2:	48 01 c2             	add    %rax,%rdx
+  8053d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053d9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8053dd:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8053e1:	48 89 c1             	mov    %rax,%rcx
+  8053e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053e8:	48 01 c1             	add    %rax,%rcx
+  8053eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053ef:	48 01 c1             	add    %rax,%rcx
+  8053f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053f6:	48 83 c0 20          	add    $0x20,%rax
+  8053fa:	48 89 ce             	mov    %rcx,%rsi
+  8053fd:	48 89 c7             	mov    %rax,%rdi
+  805400:	48 b8 5f 1d 80 00 00 	movabs $0x801d5f,%rax
+  805407:	00 00 00 
+  80540a:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80540c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805410:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805414:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805418:	48 01 c2             	add    %rax,%rdx
+  80541b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80541f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  805423:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805427:	48 89 c7             	mov    %rax,%rdi
+  80542a:	48 b8 13 50 80 00 00 	movabs $0x805013,%rax
+  805431:	00 00 00 
+  805434:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805436:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80543a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80543e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805442:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805446:	0f 82 3a fe ff ff    	jb     805286 <devpipe_write+0x40>
+  }
+
+  return i;
+  80544c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805450:	c9                   	leave
+  805451:	c3                   	ret
+
+0000000000805452 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805452:	55                   	push   %rbp
+  805453:	48 89 e5             	mov    %rsp,%rbp
+  805456:	48 83 ec 40          	sub    $0x40,%rsp
+  80545a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80545e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  805461:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805465:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805469:	48 89 c7             	mov    %rax,%rdi
+  80546c:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  805473:	00 00 00 
+  805476:	ff d0                	call   *%rax
+  805478:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80547c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  805483:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805487:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80548b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80548f:	48 89 d6             	mov    %rdx,%rsi
+  805492:	48 89 c7             	mov    %rax,%rdi
+  805495:	48 b8 3c 40 80 00 00 	movabs $0x80403c,%rax
+  80549c:	00 00 00 
+  80549f:	ff d0                	call   *%rax
+  8054a1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8054a4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054a8:	79 08                	jns    8054b2 <devpipe_poll+0x60>
+    return r;
+  8054aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054ad:	e9 85 00 00 00       	jmp    805537 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8054b2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8054b5:	83 e0 01             	and    $0x1,%eax
+  8054b8:	85 c0                	test   %eax,%eax
+  8054ba:	74 18                	je     8054d4 <devpipe_poll+0x82>
+  8054bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054c0:	48 8b 10             	mov    (%rax),%rdx
+  8054c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054c7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8054cb:	48 39 c2             	cmp    %rax,%rdx
+  8054ce:	74 04                	je     8054d4 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8054d0:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8054d4:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8054d7:	83 e0 02             	and    $0x2,%eax
+  8054da:	85 c0                	test   %eax,%eax
+  8054dc:	74 23                	je     805501 <devpipe_poll+0xaf>
+  8054de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054e2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8054e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054ea:	48 8b 00             	mov    (%rax),%rax
+  8054ed:	48 29 c2             	sub    %rax,%rdx
+  8054f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054f4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8054f8:	48 39 c2             	cmp    %rax,%rdx
+  8054fb:	73 04                	jae    805501 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8054fd:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805501:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805505:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805509:	48 89 d6             	mov    %rdx,%rsi
+  80550c:	48 89 c7             	mov    %rax,%rdi
+  80550f:	48 b8 8a 4e 80 00 00 	movabs $0x804e8a,%rax
+  805516:	00 00 00 
+  805519:	ff d0                	call   *%rax
+  80551b:	85 c0                	test   %eax,%eax
+  80551d:	74 04                	je     805523 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80551f:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  805523:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805527:	75 0b                	jne    805534 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805529:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80552d:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  805534:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805537:	c9                   	leave
+  805538:	c3                   	ret
+
+0000000000805539 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805539:	55                   	push   %rbp
+  80553a:	48 89 e5             	mov    %rsp,%rbp
+  80553d:	48 83 ec 20          	sub    $0x20,%rsp
+  805541:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805545:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805549:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80554d:	48 89 c7             	mov    %rax,%rdi
+  805550:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  805557:	00 00 00 
+  80555a:	ff d0                	call   *%rax
+  80555c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805560:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805564:	48 ba 51 6f 80 00 00 	movabs $0x806f51,%rdx
+  80556b:	00 00 00 
+  80556e:	48 89 d6             	mov    %rdx,%rsi
+  805571:	48 89 c7             	mov    %rax,%rdi
+  805574:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  80557b:	00 00 00 
+  80557e:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805580:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805584:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805588:	89 c1                	mov    %eax,%ecx
+  80558a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80558e:	48 8b 00             	mov    (%rax),%rax
+  805591:	89 c2                	mov    %eax,%edx
+  805593:	89 c8                	mov    %ecx,%eax
+  805595:	29 d0                	sub    %edx,%eax
+  805597:	89 c2                	mov    %eax,%edx
+  805599:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80559d:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8055a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055a7:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8055ae:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8055b1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055b5:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8055bc:	00 00 00 
+  8055bf:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8055c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055cb:	c9                   	leave
+  8055cc:	c3                   	ret
+
+00000000008055cd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8055cd:	55                   	push   %rbp
+  8055ce:	48 89 e5             	mov    %rsp,%rbp
+  8055d1:	48 83 ec 40          	sub    $0x40,%rsp
+  8055d5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8055d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055dd:	48 89 c7             	mov    %rax,%rdi
+  8055e0:	48 b8 69 35 80 00 00 	movabs $0x803569,%rax
+  8055e7:	00 00 00 
+  8055ea:	ff d0                	call   *%rax
+  8055ec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8055f0:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8055f7:	00 
+  8055f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055fc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805600:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805604:	48 01 d0             	add    %rdx,%rax
+  805607:	48 83 c0 1f          	add    $0x1f,%rax
+  80560b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80560f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805613:	ba 00 00 00 00       	mov    $0x0,%edx
+  805618:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80561c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805620:	48 29 d0             	sub    %rdx,%rax
+  805623:	48 c1 e8 0c          	shr    $0xc,%rax
+  805627:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80562b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80562f:	48 89 c6             	mov    %rax,%rsi
+  805632:	bf 00 00 00 00       	mov    $0x0,%edi
+  805637:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  80563e:	00 00 00 
+  805641:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805643:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805647:	48 89 c7             	mov    %rax,%rdi
+  80564a:	48 b8 13 50 80 00 00 	movabs $0x805013,%rax
+  805651:	00 00 00 
+  805654:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805656:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80565a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80565e:	eb 2f                	jmp    80568f <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805664:	48 83 e8 01          	sub    $0x1,%rax
+  805668:	48 c1 e0 0c          	shl    $0xc,%rax
+  80566c:	48 89 c2             	mov    %rax,%rdx
+  80566f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805673:	48 01 d0             	add    %rdx,%rax
+  805676:	48 89 c6             	mov    %rax,%rsi
+  805679:	bf 00 00 00 00       	mov    $0x0,%edi
+  80567e:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  805685:	00 00 00 
+  805688:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80568a:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80568f:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805694:	77 ca                	ja     805660 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805696:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80569a:	48 89 c6             	mov    %rax,%rsi
+  80569d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056a2:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  8056a9:	00 00 00 
+  8056ac:	ff d0                	call   *%rax
+}
+  8056ae:	c9                   	leave
+  8056af:	c3                   	ret
+
+00000000008056b0 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  8056b0:	55                   	push   %rbp
+  8056b1:	48 89 e5             	mov    %rsp,%rbp
+  8056b4:	48 83 ec 10          	sub    $0x10,%rsp
+  8056b8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8056bc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8056c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8056c8:	48 89 c7             	mov    %rax,%rdi
+  8056cb:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8056cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056d2:	48 b8 14 59 80 00 00 	movabs $0x805914,%rax
+  8056d9:	00 00 00 
+  8056dc:	ff d0                	call   *%rax
+}
+  8056de:	90                   	nop
+  8056df:	c9                   	leave
+  8056e0:	c3                   	ret
+
+00000000008056e1 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  8056e1:	55                   	push   %rbp
+  8056e2:	48 89 e5             	mov    %rsp,%rbp
+  8056e5:	48 83 ec 20          	sub    $0x20,%rsp
+  8056e9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  8056ec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056ef:	c1 e0 10             	shl    $0x10,%eax
+  8056f2:	48 98                	cltq
+  8056f4:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8056f9:	48 01 d0             	add    %rdx,%rax
+  8056fc:	48 89 c6             	mov    %rax,%rsi
+  8056ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805704:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  80570b:	00 00 00 
+  80570e:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805710:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805713:	83 c0 01             	add    $0x1,%eax
+  805716:	c1 e0 10             	shl    $0x10,%eax
+  805719:	48 98                	cltq
+  80571b:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805720:	48 01 d0             	add    %rdx,%rax
+  805723:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805727:	eb 20                	jmp    805749 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  805729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80572d:	48 89 c6             	mov    %rax,%rsi
+  805730:	bf 00 00 00 00       	mov    $0x0,%edi
+  805735:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  80573c:	00 00 00 
+  80573f:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805741:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805748:	00 
+  805749:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80574c:	83 c0 01             	add    $0x1,%eax
+  80574f:	c1 e0 10             	shl    $0x10,%eax
+  805752:	48 98                	cltq
+  805754:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805759:	48 01 d0             	add    %rdx,%rax
+  80575c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805760:	72 c7                	jb     805729 <slot_unmap+0x48>
+}
+  805762:	90                   	nop
+  805763:	90                   	nop
+  805764:	c9                   	leave
+  805765:	c3                   	ret
+
+0000000000805766 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  805766:	55                   	push   %rbp
+  805767:	48 89 e5             	mov    %rsp,%rbp
+  80576a:	48 83 ec 30          	sub    $0x30,%rsp
+  80576e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805772:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  805776:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80577d:	00 00 00 
+  805780:	48 89 c7             	mov    %rax,%rdi
+  805783:	48 b8 b7 61 80 00 00 	movabs $0x8061b7,%rax
+  80578a:	00 00 00 
+  80578d:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  80578f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805796:	eb 04                	jmp    80579c <thread_create+0x36>
+  805798:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80579c:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  8057a0:	7f 16                	jg     8057b8 <thread_create+0x52>
+  8057a2:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8057a9:	00 00 00 
+  8057ac:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8057af:	48 98                	cltq
+  8057b1:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8057b4:	85 c0                	test   %eax,%eax
+  8057b6:	75 e0                	jne    805798 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8057b8:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8057bc:	75 0c                	jne    8057ca <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8057be:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8057c5:	e9 2c 01 00 00       	jmp    8058f6 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8057ca:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8057cd:	c1 e0 10             	shl    $0x10,%eax
+  8057d0:	48 98                	cltq
+  8057d2:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8057d7:	48 01 d0             	add    %rdx,%rax
+  8057da:	ba 07 00 00 00       	mov    $0x7,%edx
+  8057df:	48 89 c6             	mov    %rax,%rsi
+  8057e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057e7:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  8057ee:	00 00 00 
+  8057f1:	ff d0                	call   *%rax
+  8057f3:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8057f6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8057fa:	0f 88 f5 00 00 00    	js     8058f5 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805800:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805803:	83 c0 01             	add    $0x1,%eax
+  805806:	c1 e0 10             	shl    $0x10,%eax
+  805809:	48 98                	cltq
+  80580b:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805810:	48 01 d0             	add    %rdx,%rax
+  805813:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805817:	eb 32                	jmp    80584b <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805819:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80581d:	ba 07 00 00 00       	mov    $0x7,%edx
+  805822:	48 89 c6             	mov    %rax,%rsi
+  805825:	bf 00 00 00 00       	mov    $0x0,%edi
+  80582a:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  805831:	00 00 00 
+  805834:	ff d0                	call   *%rax
+  805836:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805839:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80583d:	0f 88 9e 00 00 00    	js     8058e1 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805843:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80584a:	00 
+  80584b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80584e:	83 c0 01             	add    $0x1,%eax
+  805851:	c1 e0 10             	shl    $0x10,%eax
+  805854:	48 98                	cltq
+  805856:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80585b:	48 01 d0             	add    %rdx,%rax
+  80585e:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805862:	72 b5                	jb     805819 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805864:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805868:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  80586c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80586f:	c1 e2 10             	shl    $0x10,%edx
+  805872:	48 63 d2             	movslq %edx,%rdx
+  805875:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  80587a:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  80587d:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  805880:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805883:	83 c2 01             	add    $0x1,%edx
+  805886:	c1 e2 10             	shl    $0x10,%edx
+  805889:	48 63 d2             	movslq %edx,%rdx
+  80588c:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  805891:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  805894:	48 bf b0 56 80 00 00 	movabs $0x8056b0,%rdi
+  80589b:	00 00 00 
+  80589e:	49 89 c8             	mov    %rcx,%r8
+  8058a1:	48 89 c1             	mov    %rax,%rcx
+  8058a4:	4c 89 ca             	mov    %r9,%rdx
+  8058a7:	48 b8 84 28 80 00 00 	movabs $0x802884,%rax
+  8058ae:	00 00 00 
+  8058b1:	ff d0                	call   *%rax
+  8058b3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8058b6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8058ba:	79 08                	jns    8058c4 <thread_create+0x15e>
+    r = id;
+  8058bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058bf:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8058c2:	eb 1e                	jmp    8058e2 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8058c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058c7:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8058ca:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  8058d1:	00 00 00 
+  8058d4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8058d7:	48 98                	cltq
+  8058d9:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8058dc:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8058df:	eb 15                	jmp    8058f6 <thread_create+0x190>
+      goto fail;
+  8058e1:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  8058e2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8058e5:	89 c7                	mov    %eax,%edi
+  8058e7:	48 b8 e1 56 80 00 00 	movabs $0x8056e1,%rax
+  8058ee:	00 00 00 
+  8058f1:	ff d0                	call   *%rax
+  8058f3:	eb 01                	jmp    8058f6 <thread_create+0x190>
+    goto out;
+  8058f5:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  8058f6:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8058fd:	00 00 00 
+  805900:	48 89 c7             	mov    %rax,%rdi
+  805903:	48 b8 8c 62 80 00 00 	movabs $0x80628c,%rax
+  80590a:	00 00 00 
+  80590d:	ff d0                	call   *%rax
+  return r;
+  80590f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805912:	c9                   	leave
+  805913:	c3                   	ret
+
+0000000000805914 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  805914:	55                   	push   %rbp
+  805915:	48 89 e5             	mov    %rsp,%rbp
+  805918:	48 83 ec 10          	sub    $0x10,%rsp
+  80591c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  80591f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805922:	89 c7                	mov    %eax,%edi
+  805924:	48 b8 e1 28 80 00 00 	movabs $0x8028e1,%rax
+  80592b:	00 00 00 
+  80592e:	ff d0                	call   *%rax
+}
+  805930:	90                   	nop
+  805931:	c9                   	leave
+  805932:	c3                   	ret
+
+0000000000805933 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  805933:	55                   	push   %rbp
+  805934:	48 89 e5             	mov    %rsp,%rbp
+  805937:	48 83 ec 20          	sub    $0x20,%rsp
+  80593b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80593e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805942:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805949:	00 00 00 
+  80594c:	48 89 c7             	mov    %rax,%rdi
+  80594f:	48 b8 b7 61 80 00 00 	movabs $0x8061b7,%rax
+  805956:	00 00 00 
+  805959:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  80595b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805962:	eb 04                	jmp    805968 <thread_join+0x35>
+  805964:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805968:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  80596c:	7f 17                	jg     805985 <thread_join+0x52>
+  80596e:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805975:	00 00 00 
+  805978:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80597b:	48 98                	cltq
+  80597d:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805980:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805983:	75 df                	jne    805964 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  805985:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80598c:	00 00 00 
+  80598f:	48 89 c7             	mov    %rax,%rdi
+  805992:	48 b8 8c 62 80 00 00 	movabs $0x80628c,%rax
+  805999:	00 00 00 
+  80599c:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  80599e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8059a2:	74 06                	je     8059aa <thread_join+0x77>
+  8059a4:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8059a8:	75 07                	jne    8059b1 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8059aa:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8059af:	eb 76                	jmp    805a27 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8059b1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8059b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059b8:	48 89 d6             	mov    %rdx,%rsi
+  8059bb:	89 c7                	mov    %eax,%edi
+  8059bd:	48 b8 a9 60 80 00 00 	movabs $0x8060a9,%rax
+  8059c4:	00 00 00 
+  8059c7:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8059c9:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8059d0:	00 00 00 
+  8059d3:	48 89 c7             	mov    %rax,%rdi
+  8059d6:	48 b8 b7 61 80 00 00 	movabs $0x8061b7,%rax
+  8059dd:	00 00 00 
+  8059e0:	ff d0                	call   *%rax
+  slot_unmap(i);
+  8059e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059e5:	89 c7                	mov    %eax,%edi
+  8059e7:	48 b8 e1 56 80 00 00 	movabs $0x8056e1,%rax
+  8059ee:	00 00 00 
+  8059f1:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  8059f3:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8059fa:	00 00 00 
+  8059fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a00:	48 98                	cltq
+  805a02:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805a09:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805a10:	00 00 00 
+  805a13:	48 89 c7             	mov    %rax,%rdi
+  805a16:	48 b8 8c 62 80 00 00 	movabs $0x80628c,%rax
+  805a1d:	00 00 00 
+  805a20:	ff d0                	call   *%rax
+  return 0;
+  805a22:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a27:	c9                   	leave
+  805a28:	c3                   	ret
+
+0000000000805a29 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805a29:	55                   	push   %rbp
+  805a2a:	48 89 e5             	mov    %rsp,%rbp
+  805a2d:	48 83 ec 08          	sub    $0x8,%rsp
+  805a31:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805a35:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805a3a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805a3e:	73 23                	jae    805a63 <thread_is_uxstack+0x3a>
+  805a40:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805a45:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805a49:	72 18                	jb     805a63 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805a4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a4f:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805a54:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805a5a:	75 07                	jne    805a63 <thread_is_uxstack+0x3a>
+  805a5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  805a61:	eb 05                	jmp    805a68 <thread_is_uxstack+0x3f>
+  805a63:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a68:	83 e0 01             	and    $0x1,%eax
+}
+  805a6b:	c9                   	leave
+  805a6c:	c3                   	ret
+
+0000000000805a6d <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805a6d:	55                   	push   %rbp
+  805a6e:	48 89 e5             	mov    %rsp,%rbp
+  805a71:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805a75:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805a7c:	00 00 00 
+  805a7f:	8b 40 04             	mov    0x4(%rax),%eax
+  805a82:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805a87:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805a8e:	00 00 00 
+  805a91:	48 98                	cltq
+  805a93:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805a9a:	48 01 d0             	add    %rdx,%rax
+  805a9d:	48 05 08 01 00 00    	add    $0x108,%rax
+  805aa3:	48 8b 00             	mov    (%rax),%rax
+  805aa6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  805aaa:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805aaf:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805ab3:	73 0b                	jae    805ac0 <thread_pftemp+0x53>
+  805ab5:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805aba:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805abe:	73 07                	jae    805ac7 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  805ac0:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  805ac5:	eb 26                	jmp    805aed <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  805ac7:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  805ace:	ff ff ff 
+  805ad1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ad5:	48 01 d0             	add    %rdx,%rax
+  805ad8:	48 c1 e8 10          	shr    $0x10,%rax
+  805adc:	48 83 c0 01          	add    $0x1,%rax
+  805ae0:	48 c1 e0 0c          	shl    $0xc,%rax
+  805ae4:	48 f7 d8             	neg    %rax
+  805ae7:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  805aed:	c9                   	leave
+  805aee:	c3                   	ret
+
+0000000000805aef <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805aef:	55                   	push   %rbp
+  805af0:	48 89 e5             	mov    %rsp,%rbp
+  805af3:	48 83 ec 08          	sub    $0x8,%rsp
+  805af7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805afa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805afe:	75 10                	jne    805b10 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805b00:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b07:	00 00 00 
+  805b0a:	8b 00                	mov    (%rax),%eax
+  805b0c:	48 98                	cltq
+  805b0e:	eb 05                	jmp    805b15 <vsyscall+0x26>
+  }
+  return 0;
+  805b10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b15:	c9                   	leave
+  805b16:	c3                   	ret
+
+0000000000805b17 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805b17:	55                   	push   %rbp
+  805b18:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805b1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b20:	48 b8 ef 5a 80 00 00 	movabs $0x805aef,%rax
+  805b27:	00 00 00 
+  805b2a:	ff d0                	call   *%rax
+}
+  805b2c:	5d                   	pop    %rbp
+  805b2d:	c3                   	ret
+
+0000000000805b2e <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805b2e:	55                   	push   %rbp
+  805b2f:	48 89 e5             	mov    %rsp,%rbp
+  805b32:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805b36:	0f 31                	rdtsc
+  805b38:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805b3b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805b3e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b41:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805b44:	48 c1 e2 20          	shl    $0x20,%rdx
+  805b48:	48 09 d0             	or     %rdx,%rax
+  805b4b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805b4f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805b53:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805b57:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b5e:	00 00 00 
+  805b61:	8b 40 08             	mov    0x8(%rax),%eax
+  805b64:	48 98                	cltq
+  805b66:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805b6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b73:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805b77:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805b7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b82:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b87:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805b8b:	48 89 d0             	mov    %rdx,%rax
+  805b8e:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805b95:	ba 00 00 00 00       	mov    $0x0,%edx
+  805b9a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805b9e:	48 01 c8             	add    %rcx,%rax
+}
+  805ba1:	c9                   	leave
+  805ba2:	c3                   	ret
+
+0000000000805ba3 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805ba3:	55                   	push   %rbp
+  805ba4:	48 89 e5             	mov    %rsp,%rbp
+  805ba7:	48 83 ec 20          	sub    $0x20,%rsp
+  805bab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805bae:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bb1:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805bb4:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805bb8:	be 01 00 00 00       	mov    $0x1,%esi
+  805bbd:	48 89 c7             	mov    %rax,%rdi
+  805bc0:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  805bc7:	00 00 00 
+  805bca:	ff d0                	call   *%rax
+}
+  805bcc:	90                   	nop
+  805bcd:	c9                   	leave
+  805bce:	c3                   	ret
+
+0000000000805bcf <getchar>:
+
+int
+getchar(void) {
+  805bcf:	55                   	push   %rbp
+  805bd0:	48 89 e5             	mov    %rsp,%rbp
+  805bd3:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805bd7:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805bdb:	ba 01 00 00 00       	mov    $0x1,%edx
+  805be0:	48 89 c6             	mov    %rax,%rsi
+  805be3:	bf 00 00 00 00       	mov    $0x0,%edi
+  805be8:	48 b8 d2 3b 80 00 00 	movabs $0x803bd2,%rax
+  805bef:	00 00 00 
+  805bf2:	ff d0                	call   *%rax
+  805bf4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805bf7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805bfb:	79 05                	jns    805c02 <getchar+0x33>
+    return r;
+  805bfd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c00:	eb 14                	jmp    805c16 <getchar+0x47>
+  if (r < 1)
+  805c02:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c06:	7f 07                	jg     805c0f <getchar+0x40>
+    return -E_EOF;
+  805c08:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805c0d:	eb 07                	jmp    805c16 <getchar+0x47>
+  return c;
+  805c0f:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805c13:	0f b6 c0             	movzbl %al,%eax
+}
+  805c16:	c9                   	leave
+  805c17:	c3                   	ret
+
+0000000000805c18 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805c18:	55                   	push   %rbp
+  805c19:	48 89 e5             	mov    %rsp,%rbp
+  805c1c:	48 83 ec 20          	sub    $0x20,%rsp
+  805c20:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805c23:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805c27:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c2a:	48 89 d6             	mov    %rdx,%rsi
+  805c2d:	89 c7                	mov    %eax,%edi
+  805c2f:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  805c36:	00 00 00 
+  805c39:	ff d0                	call   *%rax
+  805c3b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805c3e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c42:	79 05                	jns    805c49 <iscons+0x31>
+    return r;
+  805c44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c47:	eb 1a                	jmp    805c63 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805c49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c4d:	8b 10                	mov    (%rax),%edx
+  805c4f:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805c56:	00 00 00 
+  805c59:	8b 00                	mov    (%rax),%eax
+  805c5b:	39 c2                	cmp    %eax,%edx
+  805c5d:	0f 94 c0             	sete   %al
+  805c60:	0f b6 c0             	movzbl %al,%eax
+}
+  805c63:	c9                   	leave
+  805c64:	c3                   	ret
+
+0000000000805c65 <opencons>:
+
+int
+opencons(void) {
+  805c65:	55                   	push   %rbp
+  805c66:	48 89 e5             	mov    %rsp,%rbp
+  805c69:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805c6d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805c71:	48 89 c7             	mov    %rax,%rdi
+  805c74:	48 b8 94 35 80 00 00 	movabs $0x803594,%rax
+  805c7b:	00 00 00 
+  805c7e:	ff d0                	call   *%rax
+  805c80:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805c83:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c87:	79 05                	jns    805c8e <opencons+0x29>
+    return r;
+  805c89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c8c:	eb 66                	jmp    805cf4 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805c8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c92:	ba 07 04 00 00       	mov    $0x407,%edx
+  805c97:	48 89 c6             	mov    %rax,%rsi
+  805c9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c9f:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  805ca6:	00 00 00 
+  805ca9:	ff d0                	call   *%rax
+  805cab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805cae:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805cb2:	79 05                	jns    805cb9 <opencons+0x54>
+    return r;
+  805cb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805cb7:	eb 3b                	jmp    805cf4 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805cb9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805cbd:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  805cc4:	00 00 00 
+  805cc7:	8b 12                	mov    (%rdx),%edx
+  805cc9:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805ccb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ccf:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805cd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805cda:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805ce1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ce5:	48 89 c7             	mov    %rax,%rdi
+  805ce8:	48 b8 46 35 80 00 00 	movabs $0x803546,%rax
+  805cef:	00 00 00 
+  805cf2:	ff d0                	call   *%rax
+}
+  805cf4:	c9                   	leave
+  805cf5:	c3                   	ret
+
+0000000000805cf6 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805cf6:	55                   	push   %rbp
+  805cf7:	48 89 e5             	mov    %rsp,%rbp
+  805cfa:	48 83 ec 20          	sub    $0x20,%rsp
+  805cfe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805d01:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805d04:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805d08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d0b:	48 89 d6             	mov    %rdx,%rsi
+  805d0e:	89 c7                	mov    %eax,%edi
+  805d10:	48 b8 76 36 80 00 00 	movabs $0x803676,%rax
+  805d17:	00 00 00 
+  805d1a:	ff d0                	call   *%rax
+  805d1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805d1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d23:	79 05                	jns    805d2a <consmode+0x34>
+    return r;
+  805d25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d28:	eb 34                	jmp    805d5e <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805d2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d2e:	8b 10                	mov    (%rax),%edx
+  805d30:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805d37:	00 00 00 
+  805d3a:	8b 00                	mov    (%rax),%eax
+  805d3c:	39 c2                	cmp    %eax,%edx
+  805d3e:	74 07                	je     805d47 <consmode+0x51>
+    return -E_INVAL;
+  805d40:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805d45:	eb 17                	jmp    805d5e <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805d47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d4b:	8b 40 0c             	mov    0xc(%rax),%eax
+  805d4e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805d51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d55:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d58:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805d5b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805d5e:	c9                   	leave
+  805d5f:	c3                   	ret
+
+0000000000805d60 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805d60:	55                   	push   %rbp
+  805d61:	48 89 e5             	mov    %rsp,%rbp
+  805d64:	48 83 ec 20          	sub    $0x20,%rsp
+  805d68:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805d6c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805d70:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805d74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d78:	8b 50 0c             	mov    0xc(%rax),%edx
+  805d7b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805d7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d83:	48 89 ce             	mov    %rcx,%rsi
+  805d86:	48 89 c7             	mov    %rax,%rdi
+  805d89:	48 b8 3e 27 80 00 00 	movabs $0x80273e,%rax
+  805d90:	00 00 00 
+  805d93:	ff d0                	call   *%rax
+  805d95:	48 98                	cltq
+}
+  805d97:	c9                   	leave
+  805d98:	c3                   	ret
+
+0000000000805d99 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805d99:	55                   	push   %rbp
+  805d9a:	48 89 e5             	mov    %rsp,%rbp
+  805d9d:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805da4:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805dab:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805db2:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805db9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805dc0:	eb 74                	jmp    805e36 <devcons_write+0x9d>
+    m = n - tot;
+  805dc2:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805dc9:	89 c2                	mov    %eax,%edx
+  805dcb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805dce:	29 c2                	sub    %eax,%edx
+  805dd0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805dd3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805dd6:	83 f8 7f             	cmp    $0x7f,%eax
+  805dd9:	76 07                	jbe    805de2 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805ddb:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805de2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805de5:	48 63 d0             	movslq %eax,%rdx
+  805de8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805deb:	48 63 c8             	movslq %eax,%rcx
+  805dee:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805df5:	48 01 c1             	add    %rax,%rcx
+  805df8:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805dff:	48 89 ce             	mov    %rcx,%rsi
+  805e02:	48 89 c7             	mov    %rax,%rdi
+  805e05:	48 b8 59 1b 80 00 00 	movabs $0x801b59,%rax
+  805e0c:	00 00 00 
+  805e0f:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805e11:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805e14:	48 63 d0             	movslq %eax,%rdx
+  805e17:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805e1e:	48 89 d6             	mov    %rdx,%rsi
+  805e21:	48 89 c7             	mov    %rax,%rdi
+  805e24:	48 b8 cd 21 80 00 00 	movabs $0x8021cd,%rax
+  805e2b:	00 00 00 
+  805e2e:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805e30:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805e33:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805e36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e39:	48 98                	cltq
+  805e3b:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805e42:	0f 82 7a ff ff ff    	jb     805dc2 <devcons_write+0x29>
+  }
+  return tot;
+  805e48:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e4b:	48 98                	cltq
+}
+  805e4d:	c9                   	leave
+  805e4e:	c3                   	ret
+
+0000000000805e4f <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805e4f:	55                   	push   %rbp
+  805e50:	48 89 e5             	mov    %rsp,%rbp
+  805e53:	48 83 ec 08          	sub    $0x8,%rsp
+  805e57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e60:	c9                   	leave
+  805e61:	c3                   	ret
+
+0000000000805e62 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805e62:	55                   	push   %rbp
+  805e63:	48 89 e5             	mov    %rsp,%rbp
+  805e66:	48 83 ec 10          	sub    $0x10,%rsp
+  805e6a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805e6e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805e72:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805e76:	48 ba 5d 6f 80 00 00 	movabs $0x806f5d,%rdx
+  805e7d:	00 00 00 
+  805e80:	48 89 d6             	mov    %rdx,%rsi
+  805e83:	48 89 c7             	mov    %rax,%rdi
+  805e86:	48 b8 16 16 80 00 00 	movabs $0x801616,%rax
+  805e8d:	00 00 00 
+  805e90:	ff d0                	call   *%rax
+  return 0;
+  805e92:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e97:	c9                   	leave
+  805e98:	c3                   	ret
+
+0000000000805e99 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805e99:	55                   	push   %rbp
+  805e9a:	48 89 e5             	mov    %rsp,%rbp
+  805e9d:	48 83 ec 30          	sub    $0x30,%rsp
+  805ea1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ea5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805ea8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805eac:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805eb3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805eb6:	83 e0 02             	and    $0x2,%eax
+  805eb9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805ebc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ec0:	8b 40 0c             	mov    0xc(%rax),%eax
+  805ec3:	83 f8 01             	cmp    $0x1,%eax
+  805ec6:	75 04                	jne    805ecc <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805ec8:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805ecc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805ecf:	83 e0 01             	and    $0x1,%eax
+  805ed2:	85 c0                	test   %eax,%eax
+  805ed4:	74 44                	je     805f1a <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805ed6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ed9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805ede:	89 c2                	mov    %eax,%edx
+  805ee0:	be 00 00 00 00       	mov    $0x0,%esi
+  805ee5:	bf 00 00 00 00       	mov    $0x0,%edi
+  805eea:	48 b8 2c 28 80 00 00 	movabs $0x80282c,%rax
+  805ef1:	00 00 00 
+  805ef4:	ff d0                	call   *%rax
+  805ef6:	83 f8 01             	cmp    $0x1,%eax
+  805ef9:	75 06                	jne    805f01 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805efb:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805eff:	eb 19                	jmp    805f1a <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805f01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f05:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805f0b:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805f0e:	89 c2                	mov    %eax,%edx
+  805f10:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f14:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805f1a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805f1d:	c9                   	leave
+  805f1e:	c3                   	ret
+
+0000000000805f1f <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805f1f:	55                   	push   %rbp
+  805f20:	48 89 e5             	mov    %rsp,%rbp
+  805f23:	48 83 ec 20          	sub    $0x20,%rsp
+  805f27:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805f2b:	48 b8 6b 23 80 00 00 	movabs $0x80236b,%rax
+  805f32:	00 00 00 
+  805f35:	ff d0                	call   *%rax
+  805f37:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805f3a:	48 b8 40 91 80 00 00 	movabs $0x809140,%rax
+  805f41:	00 00 00 
+  805f44:	48 8b 00             	mov    (%rax),%rax
+  805f47:	48 85 c0             	test   %rax,%rax
+  805f4a:	75 62                	jne    805fae <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805f4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f4f:	ba 07 00 00 00       	mov    $0x7,%edx
+  805f54:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805f5b:	00 00 00 
+  805f5e:	48 89 ce             	mov    %rcx,%rsi
+  805f61:	89 c7                	mov    %eax,%edi
+  805f63:	48 b8 e4 23 80 00 00 	movabs $0x8023e4,%rax
+  805f6a:	00 00 00 
+  805f6d:	ff d0                	call   *%rax
+  805f6f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805f72:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805f76:	79 36                	jns    805fae <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805f78:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805f7b:	89 c1                	mov    %eax,%ecx
+  805f7d:	48 b8 64 6f 80 00 00 	movabs $0x806f64,%rax
+  805f84:	00 00 00 
+  805f87:	48 89 c2             	mov    %rax,%rdx
+  805f8a:	be 23 00 00 00       	mov    $0x23,%esi
+  805f8f:	48 b8 7c 6f 80 00 00 	movabs $0x806f7c,%rax
+  805f96:	00 00 00 
+  805f99:	48 89 c7             	mov    %rax,%rdi
+  805f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fa1:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  805fa8:	00 00 00 
+  805fab:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805fae:	48 ba 40 91 80 00 00 	movabs $0x809140,%rdx
+  805fb5:	00 00 00 
+  805fb8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fbc:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805fbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fc2:	48 ba 1f 60 80 00 00 	movabs $0x80601f,%rdx
+  805fc9:	00 00 00 
+  805fcc:	48 89 d6             	mov    %rdx,%rsi
+  805fcf:	89 c7                	mov    %eax,%edi
+  805fd1:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  805fd8:	00 00 00 
+  805fdb:	ff d0                	call   *%rax
+  805fdd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805fe0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805fe4:	79 36                	jns    80601c <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805fe6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805fe9:	89 c1                	mov    %eax,%ecx
+  805feb:	48 b8 64 6f 80 00 00 	movabs $0x806f64,%rax
+  805ff2:	00 00 00 
+  805ff5:	48 89 c2             	mov    %rax,%rdx
+  805ff8:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805ffd:	48 b8 7c 6f 80 00 00 	movabs $0x806f7c,%rax
+  806004:	00 00 00 
+  806007:	48 89 c7             	mov    %rax,%rdi
+  80600a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80600f:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  806016:	00 00 00 
+  806019:	41 ff d0             	call   *%r8
+}
+  80601c:	90                   	nop
+  80601d:	c9                   	leave
+  80601e:	c3                   	ret
+
+000000000080601f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  80601f:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  806022:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  806025:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  80602c:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  806030:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  806035:	48 a1 40 91 80 00 00 	movabs 0x809140,%rax
+  80603c:	00 00 00 
+	call *%rax
+  80603f:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  806041:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  806046:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  806049:	41 5f                	pop    %r15
+	popq %r15
+  80604b:	41 5f                	pop    %r15
+	popq %r15
+  80604d:	41 5f                	pop    %r15
+	popq %r14
+  80604f:	41 5e                	pop    %r14
+	popq %r13
+  806051:	41 5d                	pop    %r13
+	popq %r12
+  806053:	41 5c                	pop    %r12
+	popq %r11
+  806055:	41 5b                	pop    %r11
+	popq %r10
+  806057:	41 5a                	pop    %r10
+	popq %r9
+  806059:	41 59                	pop    %r9
+	popq %r8
+  80605b:	41 58                	pop    %r8
+	popq %rsi
+  80605d:	5e                   	pop    %rsi
+	popq %rdi
+  80605e:	5f                   	pop    %rdi
+	popq %rbp
+  80605f:	5d                   	pop    %rbp
+	popq %rdx
+  806060:	5a                   	pop    %rdx
+	popq %rcx
+  806061:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  806062:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  806067:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80606c:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  806070:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  806073:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  806078:	5b                   	pop    %rbx
+	popq %rax
+  806079:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  80607a:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80607e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  80607f:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  806084:	c3                   	ret
+
+0000000000806085 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  806085:	55                   	push   %rbp
+  806086:	48 89 e5             	mov    %rsp,%rbp
+  806089:	48 83 ec 10          	sub    $0x10,%rsp
+  80608d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  806090:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806093:	be 00 00 00 00       	mov    $0x0,%esi
+  806098:	89 c7                	mov    %eax,%edi
+  80609a:	48 b8 a9 60 80 00 00 	movabs $0x8060a9,%rax
+  8060a1:	00 00 00 
+  8060a4:	ff d0                	call   *%rax
+}
+  8060a6:	90                   	nop
+  8060a7:	c9                   	leave
+  8060a8:	c3                   	ret
+
+00000000008060a9 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  8060a9:	55                   	push   %rbp
+  8060aa:	48 89 e5             	mov    %rsp,%rbp
+  8060ad:	48 83 ec 10          	sub    $0x10,%rsp
+  8060b1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8060b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  8060b8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8060bc:	75 3e                	jne    8060fc <waitpid+0x53>
+  8060be:	48 b8 8a 6f 80 00 00 	movabs $0x806f8a,%rax
+  8060c5:	00 00 00 
+  8060c8:	48 89 c1             	mov    %rax,%rcx
+  8060cb:	48 b8 95 6f 80 00 00 	movabs $0x806f95,%rax
+  8060d2:	00 00 00 
+  8060d5:	48 89 c2             	mov    %rax,%rdx
+  8060d8:	be 0e 00 00 00       	mov    $0xe,%esi
+  8060dd:	48 b8 aa 6f 80 00 00 	movabs $0x806faa,%rax
+  8060e4:	00 00 00 
+  8060e7:	48 89 c7             	mov    %rax,%rdi
+  8060ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060ef:	49 b8 47 04 80 00 00 	movabs $0x800447,%r8
+  8060f6:	00 00 00 
+  8060f9:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  8060fc:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  806101:	74 0a                	je     80610d <waitpid+0x64>
+    *status = 0;
+  806103:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806107:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  80610d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806111:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806114:	48 89 d6             	mov    %rdx,%rsi
+  806117:	89 c7                	mov    %eax,%edi
+  806119:	48 b8 e3 22 80 00 00 	movabs $0x8022e3,%rax
+  806120:	00 00 00 
+  806123:	ff d0                	call   *%rax
+}
+  806125:	c9                   	leave
+  806126:	c3                   	ret
+
+0000000000806127 <xchg>:
+  806127:	55                   	push   %rbp
+  806128:	48 89 e5             	mov    %rsp,%rbp
+  80612b:	48 83 ec 20          	sub    $0x20,%rsp
+  80612f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806133:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806136:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80613a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80613d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806141:	f0 87 02             	lock xchg %eax,(%rdx)
+  806144:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806147:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80614a:	c9                   	leave
+  80614b:	c3                   	ret
+
+000000000080614c <cmpxchg>:
+  80614c:	55                   	push   %rbp
+  80614d:	48 89 e5             	mov    %rsp,%rbp
+  806150:	48 83 ec 20          	sub    $0x20,%rsp
+  806154:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806158:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80615b:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  80615e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  806162:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  806165:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806168:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80616c:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  806170:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806173:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806176:	c9                   	leave
+  806177:	c3                   	ret
+
+0000000000806178 <xadd>:
+  806178:	55                   	push   %rbp
+  806179:	48 89 e5             	mov    %rsp,%rbp
+  80617c:	48 83 ec 10          	sub    $0x10,%rsp
+  806180:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806184:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  806187:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80618b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80618e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806192:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  806196:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  806199:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80619c:	c9                   	leave
+  80619d:	c3                   	ret
+
+000000000080619e <mutex_init>:
+mutex_init(struct Mutex *m) {
+  80619e:	55                   	push   %rbp
+  80619f:	48 89 e5             	mov    %rsp,%rbp
+  8061a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8061a6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  8061aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061ae:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8061b4:	90                   	nop
+  8061b5:	c9                   	leave
+  8061b6:	c3                   	ret
+
+00000000008061b7 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  8061b7:	55                   	push   %rbp
+  8061b8:	48 89 e5             	mov    %rsp,%rbp
+  8061bb:	48 83 ec 20          	sub    $0x20,%rsp
+  8061bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  8061c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061c7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8061cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8061d1:	48 89 c7             	mov    %rax,%rdi
+  8061d4:	48 b8 4c 61 80 00 00 	movabs $0x80614c,%rax
+  8061db:	00 00 00 
+  8061de:	ff d0                	call   *%rax
+  8061e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8061e3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8061e7:	74 65                	je     80624e <mutex_lock+0x97>
+  if (c != 2)
+  8061e9:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  8061ed:	74 57                	je     806246 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  8061ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061f3:	be 02 00 00 00       	mov    $0x2,%esi
+  8061f8:	48 89 c7             	mov    %rax,%rdi
+  8061fb:	48 b8 27 61 80 00 00 	movabs $0x806127,%rax
+  806202:	00 00 00 
+  806205:	ff d0                	call   *%rax
+  806207:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  80620a:	eb 3a                	jmp    806246 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  80620c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806210:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806217:	be 02 00 00 00       	mov    $0x2,%esi
+  80621c:	48 89 c7             	mov    %rax,%rdi
+  80621f:	48 b8 90 27 80 00 00 	movabs $0x802790,%rax
+  806226:	00 00 00 
+  806229:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  80622b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80622f:	be 02 00 00 00       	mov    $0x2,%esi
+  806234:	48 89 c7             	mov    %rax,%rdi
+  806237:	48 b8 27 61 80 00 00 	movabs $0x806127,%rax
+  80623e:	00 00 00 
+  806241:	ff d0                	call   *%rax
+  806243:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806246:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80624a:	75 c0                	jne    80620c <mutex_lock+0x55>
+  80624c:	eb 01                	jmp    80624f <mutex_lock+0x98>
+    return;
+  80624e:	90                   	nop
+}
+  80624f:	c9                   	leave
+  806250:	c3                   	ret
+
+0000000000806251 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  806251:	55                   	push   %rbp
+  806252:	48 89 e5             	mov    %rsp,%rbp
+  806255:	48 83 ec 08          	sub    $0x8,%rsp
+  806259:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  80625d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806261:	ba 01 00 00 00       	mov    $0x1,%edx
+  806266:	be 00 00 00 00       	mov    $0x0,%esi
+  80626b:	48 89 c7             	mov    %rax,%rdi
+  80626e:	48 b8 4c 61 80 00 00 	movabs $0x80614c,%rax
+  806275:	00 00 00 
+  806278:	ff d0                	call   *%rax
+  80627a:	85 c0                	test   %eax,%eax
+  80627c:	75 07                	jne    806285 <mutex_trylock+0x34>
+  80627e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806283:	eb 05                	jmp    80628a <mutex_trylock+0x39>
+  806285:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80628a:	c9                   	leave
+  80628b:	c3                   	ret
+
+000000000080628c <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  80628c:	55                   	push   %rbp
+  80628d:	48 89 e5             	mov    %rsp,%rbp
+  806290:	48 83 ec 10          	sub    $0x10,%rsp
+  806294:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  806298:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80629c:	be 00 00 00 00       	mov    $0x0,%esi
+  8062a1:	48 89 c7             	mov    %rax,%rdi
+  8062a4:	48 b8 27 61 80 00 00 	movabs $0x806127,%rax
+  8062ab:	00 00 00 
+  8062ae:	ff d0                	call   *%rax
+  8062b0:	83 f8 02             	cmp    $0x2,%eax
+  8062b3:	75 18                	jne    8062cd <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  8062b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8062be:	48 89 c7             	mov    %rax,%rdi
+  8062c1:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  8062c8:	00 00 00 
+  8062cb:	ff d0                	call   *%rax
+}
+  8062cd:	90                   	nop
+  8062ce:	c9                   	leave
+  8062cf:	c3                   	ret
+
+00000000008062d0 <cond_init>:
+cond_init(struct Cond *c) {
+  8062d0:	55                   	push   %rbp
+  8062d1:	48 89 e5             	mov    %rsp,%rbp
+  8062d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8062d8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  8062dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8062e0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8062e6:	90                   	nop
+  8062e7:	c9                   	leave
+  8062e8:	c3                   	ret
+
+00000000008062e9 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  8062e9:	55                   	push   %rbp
+  8062ea:	48 89 e5             	mov    %rsp,%rbp
+  8062ed:	48 83 ec 30          	sub    $0x30,%rsp
+  8062f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8062f5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8062f9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8062fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806301:	8b 00                	mov    (%rax),%eax
+  806303:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  806306:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80630a:	48 89 c7             	mov    %rax,%rdi
+  80630d:	48 b8 8c 62 80 00 00 	movabs $0x80628c,%rax
+  806314:	00 00 00 
+  806317:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  806319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80631d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806321:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806324:	89 ce                	mov    %ecx,%esi
+  806326:	48 89 c7             	mov    %rax,%rdi
+  806329:	48 b8 90 27 80 00 00 	movabs $0x802790,%rax
+  806330:	00 00 00 
+  806333:	ff d0                	call   *%rax
+  806335:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  806338:	eb 1f                	jmp    806359 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  80633a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80633e:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806345:	be 02 00 00 00       	mov    $0x2,%esi
+  80634a:	48 89 c7             	mov    %rax,%rdi
+  80634d:	48 b8 90 27 80 00 00 	movabs $0x802790,%rax
+  806354:	00 00 00 
+  806357:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  806359:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80635d:	be 02 00 00 00       	mov    $0x2,%esi
+  806362:	48 89 c7             	mov    %rax,%rdi
+  806365:	48 b8 27 61 80 00 00 	movabs $0x806127,%rax
+  80636c:	00 00 00 
+  80636f:	ff d0                	call   *%rax
+  806371:	85 c0                	test   %eax,%eax
+  806373:	75 c5                	jne    80633a <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806375:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806379:	75 07                	jne    806382 <cond_timedwait+0x99>
+  80637b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806380:	eb 05                	jmp    806387 <cond_timedwait+0x9e>
+  806382:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806387:	c9                   	leave
+  806388:	c3                   	ret
+
+0000000000806389 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  806389:	55                   	push   %rbp
+  80638a:	48 89 e5             	mov    %rsp,%rbp
+  80638d:	48 83 ec 10          	sub    $0x10,%rsp
+  806391:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806395:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  806399:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80639d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063a1:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8063a8:	48 89 ce             	mov    %rcx,%rsi
+  8063ab:	48 89 c7             	mov    %rax,%rdi
+  8063ae:	48 b8 e9 62 80 00 00 	movabs $0x8062e9,%rax
+  8063b5:	00 00 00 
+  8063b8:	ff d0                	call   *%rax
+}
+  8063ba:	90                   	nop
+  8063bb:	c9                   	leave
+  8063bc:	c3                   	ret
+
+00000000008063bd <cond_signal>:
+cond_signal(struct Cond *c) {
+  8063bd:	55                   	push   %rbp
+  8063be:	48 89 e5             	mov    %rsp,%rbp
+  8063c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8063c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8063c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8063d2:	48 89 c7             	mov    %rax,%rdi
+  8063d5:	48 b8 78 61 80 00 00 	movabs $0x806178,%rax
+  8063dc:	00 00 00 
+  8063df:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  8063e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063e5:	be 01 00 00 00       	mov    $0x1,%esi
+  8063ea:	48 89 c7             	mov    %rax,%rdi
+  8063ed:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  8063f4:	00 00 00 
+  8063f7:	ff d0                	call   *%rax
+}
+  8063f9:	90                   	nop
+  8063fa:	c9                   	leave
+  8063fb:	c3                   	ret
+
+00000000008063fc <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8063fc:	55                   	push   %rbp
+  8063fd:	48 89 e5             	mov    %rsp,%rbp
+  806400:	48 83 ec 10          	sub    $0x10,%rsp
+  806404:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  806408:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80640c:	be 01 00 00 00       	mov    $0x1,%esi
+  806411:	48 89 c7             	mov    %rax,%rdi
+  806414:	48 b8 78 61 80 00 00 	movabs $0x806178,%rax
+  80641b:	00 00 00 
+  80641e:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  806420:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806424:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  806429:	48 89 c7             	mov    %rax,%rdi
+  80642c:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  806433:	00 00 00 
+  806436:	ff d0                	call   *%rax
+}
+  806438:	90                   	nop
+  806439:	c9                   	leave
+  80643a:	c3                   	ret
+
+000000000080643b <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  80643b:	55                   	push   %rbp
+  80643c:	48 89 e5             	mov    %rsp,%rbp
+  80643f:	48 83 ec 10          	sub    $0x10,%rsp
+  806443:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806447:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  80644a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80644e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806451:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  806453:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806457:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  80645e:	90                   	nop
+  80645f:	c9                   	leave
+  806460:	c3                   	ret
+
+0000000000806461 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  806461:	55                   	push   %rbp
+  806462:	48 89 e5             	mov    %rsp,%rbp
+  806465:	48 83 ec 18          	sub    $0x18,%rsp
+  806469:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  80646d:	eb 2a                	jmp    806499 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  80646f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806472:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806475:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806479:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  80647c:	89 ce                	mov    %ecx,%esi
+  80647e:	48 89 c7             	mov    %rax,%rdi
+  806481:	48 b8 4c 61 80 00 00 	movabs $0x80614c,%rax
+  806488:	00 00 00 
+  80648b:	ff d0                	call   *%rax
+  80648d:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806490:	75 07                	jne    806499 <sem_trywait+0x38>
+      return 0;
+  806492:	b8 00 00 00 00       	mov    $0x0,%eax
+  806497:	eb 14                	jmp    8064ad <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  806499:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80649d:	8b 00                	mov    (%rax),%eax
+  80649f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8064a2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8064a6:	75 c7                	jne    80646f <sem_trywait+0xe>
+  return -E_BUSY;
+  8064a8:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  8064ad:	c9                   	leave
+  8064ae:	c3                   	ret
+
+00000000008064af <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  8064af:	55                   	push   %rbp
+  8064b0:	48 89 e5             	mov    %rsp,%rbp
+  8064b3:	48 83 ec 30          	sub    $0x30,%rsp
+  8064b7:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8064bb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  8064bf:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8064c6:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  8064c7:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8064cc:	0f 84 fb 00 00 00    	je     8065cd <sem_timedwait+0x11e>
+  8064d2:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8064d7:	0f 84 f0 00 00 00    	je     8065cd <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  8064dd:	48 b8 2e 5b 80 00 00 	movabs $0x805b2e,%rax
+  8064e4:	00 00 00 
+  8064e7:	ff d0                	call   *%rax
+  8064e9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8064ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8064f1:	48 f7 d0             	not    %rax
+  8064f4:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8064f8:	73 0d                	jae    806507 <sem_timedwait+0x58>
+  8064fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8064fe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806502:	48 01 d0             	add    %rdx,%rax
+  806505:	eb 07                	jmp    80650e <sem_timedwait+0x5f>
+  806507:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80650e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  806512:	e9 b6 00 00 00       	jmp    8065cd <sem_timedwait+0x11e>
+    if (deadline) {
+  806517:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80651c:	74 2d                	je     80654b <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  80651e:	48 b8 2e 5b 80 00 00 	movabs $0x805b2e,%rax
+  806525:	00 00 00 
+  806528:	ff d0                	call   *%rax
+  80652a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80652e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806532:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  806536:	73 0a                	jae    806542 <sem_timedwait+0x93>
+  806538:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80653c:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  806540:	eb 05                	jmp    806547 <sem_timedwait+0x98>
+  806542:	b8 00 00 00 00       	mov    $0x0,%eax
+  806547:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  80654b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80654f:	48 83 c0 04          	add    $0x4,%rax
+  806553:	be 01 00 00 00       	mov    $0x1,%esi
+  806558:	48 89 c7             	mov    %rax,%rdi
+  80655b:	48 b8 78 61 80 00 00 	movabs $0x806178,%rax
+  806562:	00 00 00 
+  806565:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  806567:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80656b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80656f:	be 00 00 00 00       	mov    $0x0,%esi
+  806574:	48 89 c7             	mov    %rax,%rdi
+  806577:	48 b8 90 27 80 00 00 	movabs $0x802790,%rax
+  80657e:	00 00 00 
+  806581:	ff d0                	call   *%rax
+  806583:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  806586:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80658a:	48 83 c0 04          	add    $0x4,%rax
+  80658e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806593:	48 89 c7             	mov    %rax,%rdi
+  806596:	48 b8 78 61 80 00 00 	movabs $0x806178,%rax
+  80659d:	00 00 00 
+  8065a0:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  8065a2:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  8065a6:	75 25                	jne    8065cd <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  8065a8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065ac:	48 89 c7             	mov    %rax,%rdi
+  8065af:	48 b8 61 64 80 00 00 	movabs $0x806461,%rax
+  8065b6:	00 00 00 
+  8065b9:	ff d0                	call   *%rax
+  8065bb:	85 c0                	test   %eax,%eax
+  8065bd:	79 07                	jns    8065c6 <sem_timedwait+0x117>
+  8065bf:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8065c4:	eb 27                	jmp    8065ed <sem_timedwait+0x13e>
+  8065c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065cb:	eb 20                	jmp    8065ed <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  8065cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065d1:	48 89 c7             	mov    %rax,%rdi
+  8065d4:	48 b8 61 64 80 00 00 	movabs $0x806461,%rax
+  8065db:	00 00 00 
+  8065de:	ff d0                	call   *%rax
+  8065e0:	85 c0                	test   %eax,%eax
+  8065e2:	0f 88 2f ff ff ff    	js     806517 <sem_timedwait+0x68>
+  return 0;
+  8065e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8065ed:	c9                   	leave
+  8065ee:	c3                   	ret
+
+00000000008065ef <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  8065ef:	55                   	push   %rbp
+  8065f0:	48 89 e5             	mov    %rsp,%rbp
+  8065f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8065f7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8065fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065ff:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  806606:	48 89 c7             	mov    %rax,%rdi
+  806609:	48 b8 af 64 80 00 00 	movabs $0x8064af,%rax
+  806610:	00 00 00 
+  806613:	ff d0                	call   *%rax
+}
+  806615:	90                   	nop
+  806616:	c9                   	leave
+  806617:	c3                   	ret
+
+0000000000806618 <sem_post>:
+sem_post(struct Semaphore *s) {
+  806618:	55                   	push   %rbp
+  806619:	48 89 e5             	mov    %rsp,%rbp
+  80661c:	48 83 ec 10          	sub    $0x10,%rsp
+  806620:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  806624:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806628:	be 01 00 00 00       	mov    $0x1,%esi
+  80662d:	48 89 c7             	mov    %rax,%rdi
+  806630:	48 b8 78 61 80 00 00 	movabs $0x806178,%rax
+  806637:	00 00 00 
+  80663a:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  80663c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806640:	8b 40 04             	mov    0x4(%rax),%eax
+  806643:	85 c0                	test   %eax,%eax
+  806645:	74 18                	je     80665f <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  806647:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80664b:	be 01 00 00 00       	mov    $0x1,%esi
+  806650:	48 89 c7             	mov    %rax,%rdi
+  806653:	48 b8 df 27 80 00 00 	movabs $0x8027df,%rax
+  80665a:	00 00 00 
+  80665d:	ff d0                	call   *%rax
+}
+  80665f:	90                   	nop
+  806660:	c9                   	leave
+  806661:	c3                   	ret
+  806662:	66 90                	xchg   %ax,%ax
@@ -0,0 +1,10247 @@
+
+obj/user/testpiperace2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 1a 03 00 00       	call   800346 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 30          	sub    $0x30,%rsp
+  80003a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80003d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int p[2], r, i;
+  struct Fd *fd;
+  const volatile struct Env *kid;
+
+  cprintf("testing for pipeisclosed race...\n");
+  800041:	48 b8 20 66 80 00 00 	movabs $0x806620,%rax
+  800048:	00 00 00 
+  80004b:	48 89 c7             	mov    %rax,%rdi
+  80004e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800053:	48 ba 0c 06 80 00 00 	movabs $0x80060c,%rdx
+  80005a:	00 00 00 
+  80005d:	ff d2                	call   *%rdx
+  if ((r = pipe_size(p, PIPE_SMALL_BUFSIZ)) < 0)
+  80005f:	48 8d 45 e8          	lea    -0x18(%rbp),%rax
+  800063:	be 20 00 00 00       	mov    $0x20,%esi
+  800068:	48 89 c7             	mov    %rax,%rdi
+  80006b:	48 b8 a3 47 80 00 00 	movabs $0x8047a3,%rax
+  800072:	00 00 00 
+  800075:	ff d0                	call   *%rax
+  800077:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80007a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80007e:	79 36                	jns    8000b6 <umain+0x84>
+    panic("pipe: %i", r);
+  800080:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800083:	89 c1                	mov    %eax,%ecx
+  800085:	48 b8 42 66 80 00 00 	movabs $0x806642,%rax
+  80008c:	00 00 00 
+  80008f:	48 89 c2             	mov    %rax,%rdx
+  800092:	be 0c 00 00 00       	mov    $0xc,%esi
+  800097:	48 b8 4b 66 80 00 00 	movabs $0x80664b,%rax
+  80009e:	00 00 00 
+  8000a1:	48 89 c7             	mov    %rax,%rdi
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  8000b0:	00 00 00 
+  8000b3:	41 ff d0             	call   *%r8
+  if ((r = fork()) < 0)
+  8000b6:	48 b8 23 32 80 00 00 	movabs $0x803223,%rax
+  8000bd:	00 00 00 
+  8000c0:	ff d0                	call   *%rax
+  8000c2:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8000c5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8000c9:	79 36                	jns    800101 <umain+0xcf>
+    panic("fork: %i", r);
+  8000cb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000ce:	89 c1                	mov    %eax,%ecx
+  8000d0:	48 b8 60 66 80 00 00 	movabs $0x806660,%rax
+  8000d7:	00 00 00 
+  8000da:	48 89 c2             	mov    %rax,%rdx
+  8000dd:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000e2:	48 b8 4b 66 80 00 00 	movabs $0x80664b,%rax
+  8000e9:	00 00 00 
+  8000ec:	48 89 c7             	mov    %rax,%rdi
+  8000ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f4:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  8000fb:	00 00 00 
+  8000fe:	41 ff d0             	call   *%r8
+  if (r == 0) {
+  800101:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800105:	0f 85 ca 00 00 00    	jne    8001d5 <umain+0x1a3>
+    // child just dups and closes repeatedly,
+    // yielding so the parent can see
+    // the fd state between the two.
+    close(p[1]);
+  80010b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80010e:	89 c7                	mov    %eax,%edi
+  800110:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  800117:	00 00 00 
+  80011a:	ff d0                	call   *%rax
+    for (i = 0; i < 200; i++) {
+  80011c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800123:	e9 94 00 00 00       	jmp    8001bc <umain+0x18a>
+      if (i % 10 == 0)
+  800128:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  80012b:	48 63 c1             	movslq %ecx,%rax
+  80012e:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  800135:	48 c1 e8 20          	shr    $0x20,%rax
+  800139:	89 c2                	mov    %eax,%edx
+  80013b:	c1 fa 02             	sar    $0x2,%edx
+  80013e:	89 c8                	mov    %ecx,%eax
+  800140:	c1 f8 1f             	sar    $0x1f,%eax
+  800143:	29 c2                	sub    %eax,%edx
+  800145:	89 d0                	mov    %edx,%eax
+  800147:	c1 e0 02             	shl    $0x2,%eax
+  80014a:	01 d0                	add    %edx,%eax
+  80014c:	01 c0                	add    %eax,%eax
+  80014e:	29 c1                	sub    %eax,%ecx
+  800150:	89 ca                	mov    %ecx,%edx
+  800152:	85 d2                	test   %edx,%edx
+  800154:	75 23                	jne    800179 <umain+0x147>
+        cprintf("%d.", i);
+  800156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800159:	89 c6                	mov    %eax,%esi
+  80015b:	48 b8 69 66 80 00 00 	movabs $0x806669,%rax
+  800162:	00 00 00 
+  800165:	48 89 c7             	mov    %rax,%rdi
+  800168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016d:	48 ba 0c 06 80 00 00 	movabs $0x80060c,%rdx
+  800174:	00 00 00 
+  800177:	ff d2                	call   *%rdx
+      // dup, then close.  yield so that other guy will
+      // see us while we're between them.
+      dup(p[0], 10);
+  800179:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80017c:	be 0a 00 00 00       	mov    $0xa,%esi
+  800181:	89 c7                	mov    %eax,%edi
+  800183:	48 b8 71 36 80 00 00 	movabs $0x803671,%rax
+  80018a:	00 00 00 
+  80018d:	ff d0                	call   *%rax
+      sys_yield();
+  80018f:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  800196:	00 00 00 
+  800199:	ff d0                	call   *%rax
+      close(10);
+  80019b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8001a0:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  8001a7:	00 00 00 
+  8001aa:	ff d0                	call   *%rax
+      sys_yield();
+  8001ac:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  8001b3:	00 00 00 
+  8001b6:	ff d0                	call   *%rax
+    for (i = 0; i < 200; i++) {
+  8001b8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8001bc:	81 7d fc c7 00 00 00 	cmpl   $0xc7,-0x4(%rbp)
+  8001c3:	0f 8e 5f ff ff ff    	jle    800128 <umain+0xf6>
+    }
+    exit();
+  8001c9:	48 b8 c9 03 80 00 00 	movabs $0x8003c9,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+  // pageref(p[0]) and gets 3, then it will return true when
+  // it shouldn't.
+  //
+  // So either way, pipeisclosed is going give a wrong answer.
+  //
+  kid = &envs[ENVX(r)];
+  8001d5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8001d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001dd:	48 98                	cltq
+  8001df:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8001e6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8001ed:	00 00 00 
+  8001f0:	48 01 d0             	add    %rdx,%rax
+  8001f3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (kid->env_status == ENV_RUNNABLE)
+  8001f7:	eb 50                	jmp    800249 <umain+0x217>
+    if (pipeisclosed(p[0]) != 0) {
+  8001f9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8001fc:	89 c7                	mov    %eax,%edi
+  8001fe:	48 b8 c9 4b 80 00 00 	movabs $0x804bc9,%rax
+  800205:	00 00 00 
+  800208:	ff d0                	call   *%rax
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	74 3b                	je     800249 <umain+0x217>
+      cprintf("\nRACE: pipe appears closed\n");
+  80020e:	48 b8 6d 66 80 00 00 	movabs $0x80666d,%rax
+  800215:	00 00 00 
+  800218:	48 89 c7             	mov    %rax,%rdi
+  80021b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800220:	48 ba 0c 06 80 00 00 	movabs $0x80060c,%rdx
+  800227:	00 00 00 
+  80022a:	ff d2                	call   *%rdx
+      sys_env_destroy(r);
+  80022c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80022f:	89 c7                	mov    %eax,%edi
+  800231:	48 b8 fc 21 80 00 00 	movabs $0x8021fc,%rax
+  800238:	00 00 00 
+  80023b:	ff d0                	call   *%rax
+      exit();
+  80023d:	48 b8 c9 03 80 00 00 	movabs $0x8003c9,%rax
+  800244:	00 00 00 
+  800247:	ff d0                	call   *%rax
+  while (kid->env_status == ENV_RUNNABLE)
+  800249:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80024d:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800253:	83 f8 02             	cmp    $0x2,%eax
+  800256:	74 a1                	je     8001f9 <umain+0x1c7>
+    }
+  cprintf("child done with loop\n");
+  800258:	48 b8 89 66 80 00 00 	movabs $0x806689,%rax
+  80025f:	00 00 00 
+  800262:	48 89 c7             	mov    %rax,%rdi
+  800265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80026a:	48 ba 0c 06 80 00 00 	movabs $0x80060c,%rdx
+  800271:	00 00 00 
+  800274:	ff d2                	call   *%rdx
+  if (pipeisclosed(p[0]))
+  800276:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800279:	89 c7                	mov    %eax,%edi
+  80027b:	48 b8 c9 4b 80 00 00 	movabs $0x804bc9,%rax
+  800282:	00 00 00 
+  800285:	ff d0                	call   *%rax
+  800287:	85 c0                	test   %eax,%eax
+  800289:	74 30                	je     8002bb <umain+0x289>
+    panic("somehow the other end of p[0] got closed!");
+  80028b:	48 b8 a0 66 80 00 00 	movabs $0x8066a0,%rax
+  800292:	00 00 00 
+  800295:	48 89 c2             	mov    %rax,%rdx
+  800298:	be 3f 00 00 00       	mov    $0x3f,%esi
+  80029d:	48 b8 4b 66 80 00 00 	movabs $0x80664b,%rax
+  8002a4:	00 00 00 
+  8002a7:	48 89 c7             	mov    %rax,%rdi
+  8002aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002af:	48 b9 ed 03 80 00 00 	movabs $0x8003ed,%rcx
+  8002b6:	00 00 00 
+  8002b9:	ff d1                	call   *%rcx
+  if ((r = fd_lookup(p[0], &fd)) < 0)
+  8002bb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8002be:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  8002c2:	48 89 d6             	mov    %rdx,%rsi
+  8002c5:	89 c7                	mov    %eax,%edi
+  8002c7:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  8002ce:	00 00 00 
+  8002d1:	ff d0                	call   *%rax
+  8002d3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8002d6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8002da:	79 36                	jns    800312 <umain+0x2e0>
+    panic("cannot look up p[0]: %i", r);
+  8002dc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8002df:	89 c1                	mov    %eax,%ecx
+  8002e1:	48 b8 ca 66 80 00 00 	movabs $0x8066ca,%rax
+  8002e8:	00 00 00 
+  8002eb:	48 89 c2             	mov    %rax,%rdx
+  8002ee:	be 41 00 00 00       	mov    $0x41,%esi
+  8002f3:	48 b8 4b 66 80 00 00 	movabs $0x80664b,%rax
+  8002fa:	00 00 00 
+  8002fd:	48 89 c7             	mov    %rax,%rdi
+  800300:	b8 00 00 00 00       	mov    $0x0,%eax
+  800305:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  80030c:	00 00 00 
+  80030f:	41 ff d0             	call   *%r8
+  (void)fd2data(fd);
+  800312:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800316:	48 89 c7             	mov    %rax,%rdi
+  800319:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  800320:	00 00 00 
+  800323:	ff d0                	call   *%rax
+  cprintf("race didn't happen\n");
+  800325:	48 b8 e2 66 80 00 00 	movabs $0x8066e2,%rax
+  80032c:	00 00 00 
+  80032f:	48 89 c7             	mov    %rax,%rdi
+  800332:	b8 00 00 00 00       	mov    $0x0,%eax
+  800337:	48 ba 0c 06 80 00 00 	movabs $0x80060c,%rdx
+  80033e:	00 00 00 
+  800341:	ff d2                	call   *%rdx
+}
+  800343:	90                   	nop
+  800344:	c9                   	leave
+  800345:	c3                   	ret
+
+0000000000800346 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800346:	55                   	push   %rbp
+  800347:	48 89 e5             	mov    %rsp,%rbp
+  80034a:	48 83 ec 20          	sub    $0x20,%rsp
+  80034e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800351:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800355:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80035c:	00 00 00 
+  80035f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800363:	eb 13                	jmp    800378 <libmain+0x32>
+    (*ctor)();
+  800365:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800369:	48 8b 10             	mov    (%rax),%rdx
+  80036c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800371:	ff d2                	call   *%rdx
+    ctor++;
+  800373:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800378:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80037f:	00 00 00 
+  800382:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800386:	72 dd                	jb     800365 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800388:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80038c:	7e 14                	jle    8003a2 <libmain+0x5c>
+    binaryname = argv[0];
+  80038e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800392:	48 8b 00             	mov    (%rax),%rax
+  800395:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80039c:	00 00 00 
+  80039f:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8003a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8003a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8003a9:	48 89 d6             	mov    %rdx,%rsi
+  8003ac:	89 c7                	mov    %eax,%edi
+  8003ae:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8003ba:	48 b8 c9 03 80 00 00 	movabs $0x8003c9,%rax
+  8003c1:	00 00 00 
+  8003c4:	ff d0                	call   *%rax
+#endif
+}
+  8003c6:	90                   	nop
+  8003c7:	c9                   	leave
+  8003c8:	c3                   	ret
+
+00000000008003c9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003c9:	55                   	push   %rbp
+  8003ca:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8003cd:	48 b8 41 36 80 00 00 	movabs $0x803641,%rax
+  8003d4:	00 00 00 
+  8003d7:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8003d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003de:	48 b8 42 22 80 00 00 	movabs $0x802242,%rax
+  8003e5:	00 00 00 
+  8003e8:	ff d0                	call   *%rax
+}
+  8003ea:	90                   	nop
+  8003eb:	5d                   	pop    %rbp
+  8003ec:	c3                   	ret
+
+00000000008003ed <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003ed:	55                   	push   %rbp
+  8003ee:	48 89 e5             	mov    %rsp,%rbp
+  8003f1:	53                   	push   %rbx
+  8003f2:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8003f9:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800400:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800406:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80040d:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800414:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  80041b:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800422:	84 c0                	test   %al,%al
+  800424:	74 23                	je     800449 <_panic+0x5c>
+  800426:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80042d:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800431:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800435:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800439:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80043d:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800441:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800445:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800449:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800450:	00 00 00 
+  800453:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  80045a:	00 00 00 
+  80045d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800461:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800468:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80046f:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800476:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80047d:	00 00 00 
+  800480:	48 8b 18             	mov    (%rax),%rbx
+  800483:	48 b8 11 23 80 00 00 	movabs $0x802311,%rax
+  80048a:	00 00 00 
+  80048d:	ff d0                	call   *%rax
+  80048f:	89 c6                	mov    %eax,%esi
+  800491:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800497:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80049e:	41 89 d0             	mov    %edx,%r8d
+  8004a1:	48 89 c1             	mov    %rax,%rcx
+  8004a4:	48 89 da             	mov    %rbx,%rdx
+  8004a7:	48 b8 00 67 80 00 00 	movabs $0x806700,%rax
+  8004ae:	00 00 00 
+  8004b1:	48 89 c7             	mov    %rax,%rdi
+  8004b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b9:	49 b9 0c 06 80 00 00 	movabs $0x80060c,%r9
+  8004c0:	00 00 00 
+  8004c3:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8004c6:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8004cd:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8004d4:	48 89 d6             	mov    %rdx,%rsi
+  8004d7:	48 89 c7             	mov    %rax,%rdi
+  8004da:	48 b8 81 05 80 00 00 	movabs $0x800581,%rax
+  8004e1:	00 00 00 
+  8004e4:	ff d0                	call   *%rax
+  cprintf("\n");
+  8004e6:	48 b8 23 67 80 00 00 	movabs $0x806723,%rax
+  8004ed:	00 00 00 
+  8004f0:	48 89 c7             	mov    %rax,%rdi
+  8004f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f8:	48 ba 0c 06 80 00 00 	movabs $0x80060c,%rdx
+  8004ff:	00 00 00 
+  800502:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800504:	cc                   	int3
+  800505:	eb fd                	jmp    800504 <_panic+0x117>
+
+0000000000800507 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800507:	55                   	push   %rbp
+  800508:	48 89 e5             	mov    %rsp,%rbp
+  80050b:	48 83 ec 10          	sub    $0x10,%rsp
+  80050f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800512:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800516:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80051a:	8b 00                	mov    (%rax),%eax
+  80051c:	8d 48 01             	lea    0x1(%rax),%ecx
+  80051f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800523:	89 0a                	mov    %ecx,(%rdx)
+  800525:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800528:	89 d1                	mov    %edx,%ecx
+  80052a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80052e:	48 98                	cltq
+  800530:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800534:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800538:	8b 00                	mov    (%rax),%eax
+  80053a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80053f:	75 2c                	jne    80056d <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800541:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800545:	8b 00                	mov    (%rax),%eax
+  800547:	48 98                	cltq
+  800549:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80054d:	48 83 c2 08          	add    $0x8,%rdx
+  800551:	48 89 c6             	mov    %rax,%rsi
+  800554:	48 89 d7             	mov    %rdx,%rdi
+  800557:	48 b8 73 21 80 00 00 	movabs $0x802173,%rax
+  80055e:	00 00 00 
+  800561:	ff d0                	call   *%rax
+    b->idx = 0;
+  800563:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800567:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80056d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800571:	8b 40 04             	mov    0x4(%rax),%eax
+  800574:	8d 50 01             	lea    0x1(%rax),%edx
+  800577:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80057b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80057e:	90                   	nop
+  80057f:	c9                   	leave
+  800580:	c3                   	ret
+
+0000000000800581 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800581:	55                   	push   %rbp
+  800582:	48 89 e5             	mov    %rsp,%rbp
+  800585:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80058c:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800593:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80059a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8005a1:	00 00 00 
+  b.cnt = 0;
+  8005a4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8005ab:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8005ae:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8005b5:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8005bc:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8005c3:	48 89 c6             	mov    %rax,%rsi
+  8005c6:	48 b8 07 05 80 00 00 	movabs $0x800507,%rax
+  8005cd:	00 00 00 
+  8005d0:	48 89 c7             	mov    %rax,%rdi
+  8005d3:	48 b8 66 09 80 00 00 	movabs $0x800966,%rax
+  8005da:	00 00 00 
+  8005dd:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8005df:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8005e5:	48 98                	cltq
+  8005e7:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8005ee:	48 83 c2 08          	add    $0x8,%rdx
+  8005f2:	48 89 c6             	mov    %rax,%rsi
+  8005f5:	48 89 d7             	mov    %rdx,%rdi
+  8005f8:	48 b8 73 21 80 00 00 	movabs $0x802173,%rax
+  8005ff:	00 00 00 
+  800602:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800604:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80060a:	c9                   	leave
+  80060b:	c3                   	ret
+
+000000000080060c <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80060c:	55                   	push   %rbp
+  80060d:	48 89 e5             	mov    %rsp,%rbp
+  800610:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800617:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80061e:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800625:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80062c:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800633:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80063a:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800641:	84 c0                	test   %al,%al
+  800643:	74 20                	je     800665 <cprintf+0x59>
+  800645:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800649:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80064d:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800651:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800655:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800659:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80065d:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800661:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800665:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80066c:	00 00 00 
+  80066f:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800676:	00 00 00 
+  800679:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80067d:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800684:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80068b:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800692:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800699:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8006a0:	48 89 d6             	mov    %rdx,%rsi
+  8006a3:	48 89 c7             	mov    %rax,%rdi
+  8006a6:	48 b8 81 05 80 00 00 	movabs $0x800581,%rax
+  8006ad:	00 00 00 
+  8006b0:	ff d0                	call   *%rax
+  8006b2:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8006b8:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8006be:	c9                   	leave
+  8006bf:	c3                   	ret
+
+00000000008006c0 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8006c0:	55                   	push   %rbp
+  8006c1:	48 89 e5             	mov    %rsp,%rbp
+  8006c4:	48 83 ec 30          	sub    $0x30,%rsp
+  8006c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006cc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8006d0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8006d4:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8006d7:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8006db:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8006df:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8006e2:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8006e6:	72 54                	jb     80073c <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006e8:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8006eb:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8006ee:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8006f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006fa:	48 f7 f6             	div    %rsi
+  8006fd:	49 89 c2             	mov    %rax,%r10
+  800700:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800703:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800706:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80070a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80070e:	41 89 c9             	mov    %ecx,%r9d
+  800711:	41 89 f8             	mov    %edi,%r8d
+  800714:	89 d1                	mov    %edx,%ecx
+  800716:	4c 89 d2             	mov    %r10,%rdx
+  800719:	48 89 c7             	mov    %rax,%rdi
+  80071c:	48 b8 c0 06 80 00 00 	movabs $0x8006c0,%rax
+  800723:	00 00 00 
+  800726:	ff d0                	call   *%rax
+  800728:	eb 1c                	jmp    800746 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80072a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80072e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800731:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800735:	48 89 d6             	mov    %rdx,%rsi
+  800738:	89 c7                	mov    %eax,%edi
+  80073a:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80073c:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800740:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800744:	7f e4                	jg     80072a <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800746:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800749:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80074d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800752:	48 f7 f1             	div    %rcx
+  800755:	48 b8 70 69 80 00 00 	movabs $0x806970,%rax
+  80075c:	00 00 00 
+  80075f:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800763:	0f be c0             	movsbl %al,%eax
+  800766:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80076a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80076e:	48 89 d6             	mov    %rdx,%rsi
+  800771:	89 c7                	mov    %eax,%edi
+  800773:	ff d1                	call   *%rcx
+}
+  800775:	90                   	nop
+  800776:	c9                   	leave
+  800777:	c3                   	ret
+
+0000000000800778 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800778:	55                   	push   %rbp
+  800779:	48 89 e5             	mov    %rsp,%rbp
+  80077c:	48 83 ec 10          	sub    $0x10,%rsp
+  800780:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800784:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800787:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80078b:	7e 4b                	jle    8007d8 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80078d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800791:	8b 00                	mov    (%rax),%eax
+  800793:	83 f8 2f             	cmp    $0x2f,%eax
+  800796:	77 24                	ja     8007bc <getuint+0x44>
+  800798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80079c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007a4:	8b 00                	mov    (%rax),%eax
+  8007a6:	89 c0                	mov    %eax,%eax
+  8007a8:	48 01 d0             	add    %rdx,%rax
+  8007ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007af:	8b 12                	mov    (%rdx),%edx
+  8007b1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007b8:	89 0a                	mov    %ecx,(%rdx)
+  8007ba:	eb 14                	jmp    8007d0 <getuint+0x58>
+  8007bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007c4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007c8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007cc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007d0:	48 8b 00             	mov    (%rax),%rax
+  8007d3:	e9 95 00 00 00       	jmp    80086d <getuint+0xf5>
+  else if (lflag)
+  8007d8:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8007dc:	74 48                	je     800826 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8007de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007e2:	8b 00                	mov    (%rax),%eax
+  8007e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e7:	77 24                	ja     80080d <getuint+0x95>
+  8007e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ed:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007f5:	8b 00                	mov    (%rax),%eax
+  8007f7:	89 c0                	mov    %eax,%eax
+  8007f9:	48 01 d0             	add    %rdx,%rax
+  8007fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800800:	8b 12                	mov    (%rdx),%edx
+  800802:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800805:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800809:	89 0a                	mov    %ecx,(%rdx)
+  80080b:	eb 14                	jmp    800821 <getuint+0xa9>
+  80080d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800811:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800815:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800819:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80081d:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800821:	48 8b 00             	mov    (%rax),%rax
+  800824:	eb 47                	jmp    80086d <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800826:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80082a:	8b 00                	mov    (%rax),%eax
+  80082c:	83 f8 2f             	cmp    $0x2f,%eax
+  80082f:	77 24                	ja     800855 <getuint+0xdd>
+  800831:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800835:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800839:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80083d:	8b 00                	mov    (%rax),%eax
+  80083f:	89 c0                	mov    %eax,%eax
+  800841:	48 01 d0             	add    %rdx,%rax
+  800844:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800848:	8b 12                	mov    (%rdx),%edx
+  80084a:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80084d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800851:	89 0a                	mov    %ecx,(%rdx)
+  800853:	eb 14                	jmp    800869 <getuint+0xf1>
+  800855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800859:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80085d:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800861:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800865:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800869:	8b 00                	mov    (%rax),%eax
+  80086b:	89 c0                	mov    %eax,%eax
+}
+  80086d:	c9                   	leave
+  80086e:	c3                   	ret
+
+000000000080086f <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80086f:	55                   	push   %rbp
+  800870:	48 89 e5             	mov    %rsp,%rbp
+  800873:	48 83 ec 10          	sub    $0x10,%rsp
+  800877:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80087b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80087e:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800882:	7e 4b                	jle    8008cf <getint+0x60>
+    return va_arg(*ap, long long);
+  800884:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800888:	8b 00                	mov    (%rax),%eax
+  80088a:	83 f8 2f             	cmp    $0x2f,%eax
+  80088d:	77 24                	ja     8008b3 <getint+0x44>
+  80088f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800893:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800897:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80089b:	8b 00                	mov    (%rax),%eax
+  80089d:	89 c0                	mov    %eax,%eax
+  80089f:	48 01 d0             	add    %rdx,%rax
+  8008a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008a6:	8b 12                	mov    (%rdx),%edx
+  8008a8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008af:	89 0a                	mov    %ecx,(%rdx)
+  8008b1:	eb 14                	jmp    8008c7 <getint+0x58>
+  8008b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008bb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008bf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008c3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008c7:	48 8b 00             	mov    (%rax),%rax
+  8008ca:	e9 95 00 00 00       	jmp    800964 <getint+0xf5>
+  else if (lflag)
+  8008cf:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008d3:	74 48                	je     80091d <getint+0xae>
+    return va_arg(*ap, long);
+  8008d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d9:	8b 00                	mov    (%rax),%eax
+  8008db:	83 f8 2f             	cmp    $0x2f,%eax
+  8008de:	77 24                	ja     800904 <getint+0x95>
+  8008e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008e4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ec:	8b 00                	mov    (%rax),%eax
+  8008ee:	89 c0                	mov    %eax,%eax
+  8008f0:	48 01 d0             	add    %rdx,%rax
+  8008f3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008f7:	8b 12                	mov    (%rdx),%edx
+  8008f9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800900:	89 0a                	mov    %ecx,(%rdx)
+  800902:	eb 14                	jmp    800918 <getint+0xa9>
+  800904:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800908:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80090c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800910:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800914:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800918:	48 8b 00             	mov    (%rax),%rax
+  80091b:	eb 47                	jmp    800964 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80091d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800921:	8b 00                	mov    (%rax),%eax
+  800923:	83 f8 2f             	cmp    $0x2f,%eax
+  800926:	77 24                	ja     80094c <getint+0xdd>
+  800928:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80092c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800934:	8b 00                	mov    (%rax),%eax
+  800936:	89 c0                	mov    %eax,%eax
+  800938:	48 01 d0             	add    %rdx,%rax
+  80093b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80093f:	8b 12                	mov    (%rdx),%edx
+  800941:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800944:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800948:	89 0a                	mov    %ecx,(%rdx)
+  80094a:	eb 14                	jmp    800960 <getint+0xf1>
+  80094c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800950:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800954:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800958:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80095c:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800960:	8b 00                	mov    (%rax),%eax
+  800962:	48 98                	cltq
+}
+  800964:	c9                   	leave
+  800965:	c3                   	ret
+
+0000000000800966 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800966:	55                   	push   %rbp
+  800967:	48 89 e5             	mov    %rsp,%rbp
+  80096a:	41 54                	push   %r12
+  80096c:	53                   	push   %rbx
+  80096d:	48 83 ec 60          	sub    $0x60,%rsp
+  800971:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800975:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800979:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80097d:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800981:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800985:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800989:	48 8b 06             	mov    (%rsi),%rax
+  80098c:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800990:	48 89 01             	mov    %rax,(%rcx)
+  800993:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800997:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80099b:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80099f:	eb 17                	jmp    8009b8 <vprintfmt+0x52>
+      if (ch == '\0')
+  8009a1:	85 db                	test   %ebx,%ebx
+  8009a3:	0f 84 bf 04 00 00    	je     800e68 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  8009a9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009ad:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009b1:	48 89 c6             	mov    %rax,%rsi
+  8009b4:	89 df                	mov    %ebx,%edi
+  8009b6:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8009b8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009bc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009c0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009c4:	0f b6 00             	movzbl (%rax),%eax
+  8009c7:	0f b6 d8             	movzbl %al,%ebx
+  8009ca:	83 fb 25             	cmp    $0x25,%ebx
+  8009cd:	75 d2                	jne    8009a1 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8009cf:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8009d3:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8009da:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8009e1:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8009e8:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8009ef:	eb 04                	jmp    8009f5 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8009f1:	90                   	nop
+  8009f2:	eb 01                	jmp    8009f5 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8009f4:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8009f5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009f9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009fd:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a01:	0f b6 00             	movzbl (%rax),%eax
+  800a04:	0f b6 d8             	movzbl %al,%ebx
+  800a07:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800a0a:	83 f8 55             	cmp    $0x55,%eax
+  800a0d:	0f 87 22 04 00 00    	ja     800e35 <vprintfmt+0x4cf>
+  800a13:	89 c0                	mov    %eax,%eax
+  800a15:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800a1c:	00 
+  800a1d:	48 b8 98 69 80 00 00 	movabs $0x806998,%rax
+  800a24:	00 00 00 
+  800a27:	48 01 d0             	add    %rdx,%rax
+  800a2a:	48 8b 00             	mov    (%rax),%rax
+  800a2d:	ff e0                	jmp    *%rax
+        padc = '-';
+  800a2f:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800a33:	eb c0                	jmp    8009f5 <vprintfmt+0x8f>
+        padc = '0';
+  800a35:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800a39:	eb ba                	jmp    8009f5 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800a3b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a42:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800a45:	89 d0                	mov    %edx,%eax
+  800a47:	c1 e0 02             	shl    $0x2,%eax
+  800a4a:	01 d0                	add    %edx,%eax
+  800a4c:	01 c0                	add    %eax,%eax
+  800a4e:	01 d8                	add    %ebx,%eax
+  800a50:	83 e8 30             	sub    $0x30,%eax
+  800a53:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800a56:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a5a:	0f b6 00             	movzbl (%rax),%eax
+  800a5d:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800a60:	83 fb 2f             	cmp    $0x2f,%ebx
+  800a63:	7e 60                	jle    800ac5 <vprintfmt+0x15f>
+  800a65:	83 fb 39             	cmp    $0x39,%ebx
+  800a68:	7f 5b                	jg     800ac5 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800a6a:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800a6f:	eb d1                	jmp    800a42 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800a71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a74:	83 f8 2f             	cmp    $0x2f,%eax
+  800a77:	77 17                	ja     800a90 <vprintfmt+0x12a>
+  800a79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a7d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a80:	89 d2                	mov    %edx,%edx
+  800a82:	48 01 d0             	add    %rdx,%rax
+  800a85:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a88:	83 c2 08             	add    $0x8,%edx
+  800a8b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a8e:	eb 0c                	jmp    800a9c <vprintfmt+0x136>
+  800a90:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a94:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a98:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a9c:	8b 00                	mov    (%rax),%eax
+  800a9e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800aa1:	eb 23                	jmp    800ac6 <vprintfmt+0x160>
+        if (width < 0)
+  800aa3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800aa7:	0f 89 44 ff ff ff    	jns    8009f1 <vprintfmt+0x8b>
+          width = 0;
+  800aad:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800ab4:	e9 38 ff ff ff       	jmp    8009f1 <vprintfmt+0x8b>
+        altflag = 1;
+  800ab9:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800ac0:	e9 30 ff ff ff       	jmp    8009f5 <vprintfmt+0x8f>
+        goto process_precision;
+  800ac5:	90                   	nop
+        if (width < 0)
+  800ac6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800aca:	0f 89 24 ff ff ff    	jns    8009f4 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800ad0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ad3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800ad6:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800add:	e9 12 ff ff ff       	jmp    8009f4 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800ae2:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800ae6:	e9 0a ff ff ff       	jmp    8009f5 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800aeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aee:	83 f8 2f             	cmp    $0x2f,%eax
+  800af1:	77 17                	ja     800b0a <vprintfmt+0x1a4>
+  800af3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800af7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800afa:	89 d2                	mov    %edx,%edx
+  800afc:	48 01 d0             	add    %rdx,%rax
+  800aff:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b02:	83 c2 08             	add    $0x8,%edx
+  800b05:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b08:	eb 0c                	jmp    800b16 <vprintfmt+0x1b0>
+  800b0a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b0e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b12:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b16:	8b 00                	mov    (%rax),%eax
+  800b18:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b1c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b20:	48 89 d6             	mov    %rdx,%rsi
+  800b23:	89 c7                	mov    %eax,%edi
+  800b25:	ff d1                	call   *%rcx
+        break;
+  800b27:	e9 37 03 00 00       	jmp    800e63 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800b2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b32:	77 17                	ja     800b4b <vprintfmt+0x1e5>
+  800b34:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b38:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b3b:	89 d2                	mov    %edx,%edx
+  800b3d:	48 01 d0             	add    %rdx,%rax
+  800b40:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b43:	83 c2 08             	add    $0x8,%edx
+  800b46:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b49:	eb 0c                	jmp    800b57 <vprintfmt+0x1f1>
+  800b4b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b4f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b53:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b57:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800b59:	85 db                	test   %ebx,%ebx
+  800b5b:	79 02                	jns    800b5f <vprintfmt+0x1f9>
+          err = -err;
+  800b5d:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800b5f:	83 fb 15             	cmp    $0x15,%ebx
+  800b62:	7f 16                	jg     800b7a <vprintfmt+0x214>
+  800b64:	48 ba c0 68 80 00 00 	movabs $0x8068c0,%rdx
+  800b6b:	00 00 00 
+  800b6e:	48 63 c3             	movslq %ebx,%rax
+  800b71:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800b75:	4d 85 e4             	test   %r12,%r12
+  800b78:	75 2e                	jne    800ba8 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800b7a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b7e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b82:	89 d9                	mov    %ebx,%ecx
+  800b84:	48 ba 81 69 80 00 00 	movabs $0x806981,%rdx
+  800b8b:	00 00 00 
+  800b8e:	48 89 c7             	mov    %rax,%rdi
+  800b91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b96:	49 b8 72 0e 80 00 00 	movabs $0x800e72,%r8
+  800b9d:	00 00 00 
+  800ba0:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800ba3:	e9 bb 02 00 00       	jmp    800e63 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800ba8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800bac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bb0:	4c 89 e1             	mov    %r12,%rcx
+  800bb3:	48 ba 8a 69 80 00 00 	movabs $0x80698a,%rdx
+  800bba:	00 00 00 
+  800bbd:	48 89 c7             	mov    %rax,%rdi
+  800bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc5:	49 b8 72 0e 80 00 00 	movabs $0x800e72,%r8
+  800bcc:	00 00 00 
+  800bcf:	41 ff d0             	call   *%r8
+        break;
+  800bd2:	e9 8c 02 00 00       	jmp    800e63 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800bd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bda:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdd:	77 17                	ja     800bf6 <vprintfmt+0x290>
+  800bdf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800be3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800be6:	89 d2                	mov    %edx,%edx
+  800be8:	48 01 d0             	add    %rdx,%rax
+  800beb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bee:	83 c2 08             	add    $0x8,%edx
+  800bf1:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bf4:	eb 0c                	jmp    800c02 <vprintfmt+0x29c>
+  800bf6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bfa:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bfe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c02:	4c 8b 20             	mov    (%rax),%r12
+  800c05:	4d 85 e4             	test   %r12,%r12
+  800c08:	75 0a                	jne    800c14 <vprintfmt+0x2ae>
+          p = "(null)";
+  800c0a:	49 bc 8d 69 80 00 00 	movabs $0x80698d,%r12
+  800c11:	00 00 00 
+        if (width > 0 && padc != '-')
+  800c14:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c18:	7e 78                	jle    800c92 <vprintfmt+0x32c>
+  800c1a:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800c1e:	74 72                	je     800c92 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c20:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800c23:	48 98                	cltq
+  800c25:	48 89 c6             	mov    %rax,%rsi
+  800c28:	4c 89 e7             	mov    %r12,%rdi
+  800c2b:	48 b8 7e 15 80 00 00 	movabs $0x80157e,%rax
+  800c32:	00 00 00 
+  800c35:	ff d0                	call   *%rax
+  800c37:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800c3a:	eb 17                	jmp    800c53 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800c3c:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800c40:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800c44:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800c48:	48 89 d6             	mov    %rdx,%rsi
+  800c4b:	89 c7                	mov    %eax,%edi
+  800c4d:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c4f:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c53:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c57:	7f e3                	jg     800c3c <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c59:	eb 37                	jmp    800c92 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800c5b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800c5f:	74 1e                	je     800c7f <vprintfmt+0x319>
+  800c61:	83 fb 1f             	cmp    $0x1f,%ebx
+  800c64:	7e 05                	jle    800c6b <vprintfmt+0x305>
+  800c66:	83 fb 7e             	cmp    $0x7e,%ebx
+  800c69:	7e 14                	jle    800c7f <vprintfmt+0x319>
+            putch('?', putdat);
+  800c6b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c6f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c73:	48 89 c6             	mov    %rax,%rsi
+  800c76:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c7b:	ff d2                	call   *%rdx
+  800c7d:	eb 0f                	jmp    800c8e <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800c7f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c83:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c87:	48 89 c6             	mov    %rax,%rsi
+  800c8a:	89 df                	mov    %ebx,%edi
+  800c8c:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c8e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c92:	4c 89 e0             	mov    %r12,%rax
+  800c95:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800c99:	0f b6 00             	movzbl (%rax),%eax
+  800c9c:	0f be d8             	movsbl %al,%ebx
+  800c9f:	85 db                	test   %ebx,%ebx
+  800ca1:	74 28                	je     800ccb <vprintfmt+0x365>
+  800ca3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800ca7:	78 b2                	js     800c5b <vprintfmt+0x2f5>
+  800ca9:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800cad:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800cb1:	79 a8                	jns    800c5b <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800cb3:	eb 16                	jmp    800ccb <vprintfmt+0x365>
+          putch(' ', putdat);
+  800cb5:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cb9:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cbd:	48 89 c6             	mov    %rax,%rsi
+  800cc0:	bf 20 00 00 00       	mov    $0x20,%edi
+  800cc5:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800cc7:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ccb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ccf:	7f e4                	jg     800cb5 <vprintfmt+0x34f>
+        break;
+  800cd1:	e9 8d 01 00 00       	jmp    800e63 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800cd6:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800cd9:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cdd:	89 d6                	mov    %edx,%esi
+  800cdf:	48 89 c7             	mov    %rax,%rdi
+  800ce2:	48 b8 6f 08 80 00 00 	movabs $0x80086f,%rax
+  800ce9:	00 00 00 
+  800cec:	ff d0                	call   *%rax
+  800cee:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800cf2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cf6:	48 85 c0             	test   %rax,%rax
+  800cf9:	79 1d                	jns    800d18 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800cfb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cff:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d03:	48 89 c6             	mov    %rax,%rsi
+  800d06:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d0b:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800d0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d11:	48 f7 d8             	neg    %rax
+  800d14:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800d18:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d1f:	e9 d2 00 00 00       	jmp    800df6 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800d24:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d27:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d2b:	89 d6                	mov    %edx,%esi
+  800d2d:	48 89 c7             	mov    %rax,%rdi
+  800d30:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800d37:	00 00 00 
+  800d3a:	ff d0                	call   *%rax
+  800d3c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800d40:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d47:	e9 aa 00 00 00       	jmp    800df6 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800d4c:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d4f:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d53:	89 d6                	mov    %edx,%esi
+  800d55:	48 89 c7             	mov    %rax,%rdi
+  800d58:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800d5f:	00 00 00 
+  800d62:	ff d0                	call   *%rax
+  800d64:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800d68:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800d6f:	e9 82 00 00 00       	jmp    800df6 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800d74:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d78:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d7c:	48 89 c6             	mov    %rax,%rsi
+  800d7f:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d84:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800d86:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d8a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d8e:	48 89 c6             	mov    %rax,%rsi
+  800d91:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d96:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800d98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d9b:	83 f8 2f             	cmp    $0x2f,%eax
+  800d9e:	77 17                	ja     800db7 <vprintfmt+0x451>
+  800da0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800da4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800da7:	89 d2                	mov    %edx,%edx
+  800da9:	48 01 d0             	add    %rdx,%rax
+  800dac:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800daf:	83 c2 08             	add    $0x8,%edx
+  800db2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800db5:	eb 0c                	jmp    800dc3 <vprintfmt+0x45d>
+  800db7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800dbb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800dbf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800dc3:	48 8b 00             	mov    (%rax),%rax
+  800dc6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800dca:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800dd1:	eb 23                	jmp    800df6 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800dd3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800dd6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dda:	89 d6                	mov    %edx,%esi
+  800ddc:	48 89 c7             	mov    %rax,%rdi
+  800ddf:	48 b8 78 07 80 00 00 	movabs $0x800778,%rax
+  800de6:	00 00 00 
+  800de9:	ff d0                	call   *%rax
+  800deb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800def:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800df6:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800dfb:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800dfe:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800e01:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e05:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800e09:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e0d:	45 89 c1             	mov    %r8d,%r9d
+  800e10:	41 89 f8             	mov    %edi,%r8d
+  800e13:	48 89 c7             	mov    %rax,%rdi
+  800e16:	48 b8 c0 06 80 00 00 	movabs $0x8006c0,%rax
+  800e1d:	00 00 00 
+  800e20:	ff d0                	call   *%rax
+        break;
+  800e22:	eb 3f                	jmp    800e63 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800e24:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e28:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e2c:	48 89 c6             	mov    %rax,%rsi
+  800e2f:	89 df                	mov    %ebx,%edi
+  800e31:	ff d2                	call   *%rdx
+        break;
+  800e33:	eb 2e                	jmp    800e63 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800e35:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e39:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e3d:	48 89 c6             	mov    %rax,%rsi
+  800e40:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e45:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800e47:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e4c:	eb 05                	jmp    800e53 <vprintfmt+0x4ed>
+  800e4e:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800e53:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800e57:	48 83 e8 01          	sub    $0x1,%rax
+  800e5b:	0f b6 00             	movzbl (%rax),%eax
+  800e5e:	3c 25                	cmp    $0x25,%al
+  800e60:	75 ec                	jne    800e4e <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800e62:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800e63:	e9 50 fb ff ff       	jmp    8009b8 <vprintfmt+0x52>
+        return;
+  800e68:	90                   	nop
+    }
+  }
+}
+  800e69:	48 83 c4 60          	add    $0x60,%rsp
+  800e6d:	5b                   	pop    %rbx
+  800e6e:	41 5c                	pop    %r12
+  800e70:	5d                   	pop    %rbp
+  800e71:	c3                   	ret
+
+0000000000800e72 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800e72:	55                   	push   %rbp
+  800e73:	48 89 e5             	mov    %rsp,%rbp
+  800e76:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800e7d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800e84:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800e8b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e92:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e99:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800ea0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800ea7:	84 c0                	test   %al,%al
+  800ea9:	74 20                	je     800ecb <printfmt+0x59>
+  800eab:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800eaf:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800eb3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800eb7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800ebb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800ebf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800ec3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800ec7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800ecb:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800ed2:	00 00 00 
+  800ed5:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800edc:	00 00 00 
+  800edf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ee3:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800eea:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800ef1:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800ef8:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800eff:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f06:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800f0d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f14:	48 89 c7             	mov    %rax,%rdi
+  800f17:	48 b8 66 09 80 00 00 	movabs $0x800966,%rax
+  800f1e:	00 00 00 
+  800f21:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800f23:	90                   	nop
+  800f24:	c9                   	leave
+  800f25:	c3                   	ret
+
+0000000000800f26 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800f26:	55                   	push   %rbp
+  800f27:	48 89 e5             	mov    %rsp,%rbp
+  800f2a:	48 83 ec 10          	sub    $0x10,%rsp
+  800f2e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800f31:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800f35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f39:	8b 40 10             	mov    0x10(%rax),%eax
+  800f3c:	8d 50 01             	lea    0x1(%rax),%edx
+  800f3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f43:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800f46:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f4a:	48 8b 10             	mov    (%rax),%rdx
+  800f4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f51:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f55:	48 39 c2             	cmp    %rax,%rdx
+  800f58:	73 17                	jae    800f71 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800f5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800f5e:	48 8b 00             	mov    (%rax),%rax
+  800f61:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800f65:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800f69:	48 89 0a             	mov    %rcx,(%rdx)
+  800f6c:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800f6f:	88 10                	mov    %dl,(%rax)
+}
+  800f71:	90                   	nop
+  800f72:	c9                   	leave
+  800f73:	c3                   	ret
+
+0000000000800f74 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800f74:	55                   	push   %rbp
+  800f75:	48 89 e5             	mov    %rsp,%rbp
+  800f78:	48 83 ec 40          	sub    $0x40,%rsp
+  800f7c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800f80:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800f83:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f87:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800f8b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f8f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f93:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800f96:	48 98                	cltq
+  800f98:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800f9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800fa0:	48 01 d0             	add    %rdx,%rax
+  800fa3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800fa7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800fae:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800fb3:	74 06                	je     800fbb <vsnprintf+0x47>
+  800fb5:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800fb9:	7f 07                	jg     800fc2 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800fbb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fc0:	eb 32                	jmp    800ff4 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800fc2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800fc6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800fca:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800fce:	48 89 c6             	mov    %rax,%rsi
+  800fd1:	48 b8 26 0f 80 00 00 	movabs $0x800f26,%rax
+  800fd8:	00 00 00 
+  800fdb:	48 89 c7             	mov    %rax,%rdi
+  800fde:	48 b8 66 09 80 00 00 	movabs $0x800966,%rax
+  800fe5:	00 00 00 
+  800fe8:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800fea:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800fee:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800ff1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800ff4:	c9                   	leave
+  800ff5:	c3                   	ret
+
+0000000000800ff6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800ff6:	55                   	push   %rbp
+  800ff7:	48 89 e5             	mov    %rsp,%rbp
+  800ffa:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801001:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801008:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  80100e:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801015:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80101c:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801023:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80102a:	84 c0                	test   %al,%al
+  80102c:	74 20                	je     80104e <snprintf+0x58>
+  80102e:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801032:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801036:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80103a:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80103e:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801042:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801046:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80104a:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80104e:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801055:	00 00 00 
+  801058:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80105f:	00 00 00 
+  801062:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801066:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80106d:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801074:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  80107b:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801082:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801089:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80108f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801096:	48 89 c7             	mov    %rax,%rdi
+  801099:	48 b8 74 0f 80 00 00 	movabs $0x800f74,%rax
+  8010a0:	00 00 00 
+  8010a3:	ff d0                	call   *%rax
+  8010a5:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8010ab:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8010b1:	c9                   	leave
+  8010b2:	c3                   	ret
+
+00000000008010b3 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8010b3:	55                   	push   %rbp
+  8010b4:	48 89 e5             	mov    %rsp,%rbp
+  8010b7:	53                   	push   %rbx
+  8010b8:	48 83 ec 38          	sub    $0x38,%rsp
+  8010bc:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8010bf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8010c3:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8010c7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8010cb:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8010cf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8010d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d7:	89 d1                	mov    %edx,%ecx
+  8010d9:	0f a2                	cpuid
+  8010db:	89 de                	mov    %ebx,%esi
+  8010dd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8010e0:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8010e3:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8010e6:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8010e9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010ee:	74 09                	je     8010f9 <cpuid+0x46>
+}
+  8010f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010f4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8010f7:	89 10                	mov    %edx,(%rax)
+
+  8010f9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8010fe:	74 09                	je     801109 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801100:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801104:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801107:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801109:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80110e:	74 09                	je     801119 <cpuid+0x66>
+char *
+  801110:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801114:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801117:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801119:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80111e:	74 09                	je     801129 <cpuid+0x76>
+  for (; *s; s++)
+  801120:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801124:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801127:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801129:	90                   	nop
+  80112a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80112e:	c9                   	leave
+  80112f:	c3                   	ret
+
+0000000000801130 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801130:	55                   	push   %rbp
+  801131:	48 89 e5             	mov    %rsp,%rbp
+  801134:	48 83 ec 18          	sub    $0x18,%rsp
+  801138:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  80113b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80113e:	89 c1                	mov    %eax,%ecx
+  801140:	0f 01 d0             	xgetbv
+  801143:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801146:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801149:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80114c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80114f:	48 c1 e2 20          	shl    $0x20,%rdx
+  801153:	48 09 d0             	or     %rdx,%rax
+#else
+  801156:	c9                   	leave
+  801157:	c3                   	ret
+
+0000000000801158 <string_cpu>:
+string_cpu(void) {
+  801158:	55                   	push   %rbp
+  801159:	48 89 e5             	mov    %rsp,%rbp
+  80115c:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801160:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801167:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80116e:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801175:	00 00 00 
+  801178:	8b 00                	mov    (%rax),%eax
+  80117a:	85 c0                	test   %eax,%eax
+  80117c:	78 11                	js     80118f <string_cpu+0x37>
+    return string_features;
+  80117e:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801185:	00 00 00 
+  801188:	8b 00                	mov    (%rax),%eax
+  80118a:	e9 df 00 00 00       	jmp    80126e <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80118f:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801193:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801199:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80119e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a3:	48 89 c6             	mov    %rax,%rsi
+  8011a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011ab:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  8011b2:	00 00 00 
+  8011b5:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8011b7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8011ba:	83 f8 06             	cmp    $0x6,%eax
+  8011bd:	76 28                	jbe    8011e7 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8011bf:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8011c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8011ce:	48 89 c2             	mov    %rax,%rdx
+  8011d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d6:	bf 07 00 00 00       	mov    $0x7,%edi
+  8011db:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  8011e2:	00 00 00 
+  8011e5:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8011e7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8011ea:	25 00 02 00 00       	and    $0x200,%eax
+  8011ef:	85 c0                	test   %eax,%eax
+  8011f1:	74 04                	je     8011f7 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8011f3:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8011f7:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8011fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801201:	48 89 c1             	mov    %rax,%rcx
+  801204:	ba 00 00 00 00       	mov    $0x0,%edx
+  801209:	be 00 00 00 00       	mov    $0x0,%esi
+  80120e:	bf 01 00 00 00       	mov    $0x1,%edi
+  801213:	48 b8 b3 10 80 00 00 	movabs $0x8010b3,%rax
+  80121a:	00 00 00 
+  80121d:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80121f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801222:	83 e0 20             	and    $0x20,%eax
+  801225:	85 c0                	test   %eax,%eax
+  801227:	74 2a                	je     801253 <string_cpu+0xfb>
+  801229:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80122c:	25 00 00 00 08       	and    $0x8000000,%eax
+  801231:	85 c0                	test   %eax,%eax
+  801233:	74 1e                	je     801253 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801235:	bf 00 00 00 00       	mov    $0x0,%edi
+  80123a:	48 b8 30 11 80 00 00 	movabs $0x801130,%rax
+  801241:	00 00 00 
+  801244:	ff d0                	call   *%rax
+  801246:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801249:	48 83 f8 06          	cmp    $0x6,%rax
+  80124d:	75 04                	jne    801253 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80124f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801253:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  80125a:	00 00 00 
+  80125d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801260:	89 02                	mov    %eax,(%rdx)
+  801262:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801269:	00 00 00 
+  80126c:	8b 00                	mov    (%rax),%eax
+}
+  80126e:	c9                   	leave
+  80126f:	c3                   	ret
+
+0000000000801270 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801270:	55                   	push   %rbp
+  801271:	48 89 e5             	mov    %rsp,%rbp
+  801274:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801278:	48 83 ec 60          	sub    $0x60,%rsp
+  80127c:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801281:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801286:	83 e0 1f             	and    $0x1f,%eax
+  801289:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80128d:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801291:	48 f7 d8             	neg    %rax
+  801294:	48 89 c2             	mov    %rax,%rdx
+  801297:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80129c:	48 01 d0             	add    %rdx,%rax
+  80129f:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8012a4:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8012a8:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8012ae:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012b3:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8012b7:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8012bd:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012c1:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012c5:	89 c2                	mov    %eax,%edx
+  8012c7:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8012cb:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8012d0:	89 c1                	mov    %eax,%ecx
+  8012d2:	d3 e6                	shl    %cl,%esi
+  8012d4:	89 f0                	mov    %esi,%eax
+  8012d6:	21 d0                	and    %edx,%eax
+  8012d8:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8012dc:	eb 21                	jmp    8012ff <strlen_avx2+0x8f>
+    p += 32;
+  8012de:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8012e4:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8012e9:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8012ed:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8012f3:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012f7:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012fb:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8012ff:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801304:	74 d8                	je     8012de <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801306:	31 c0                	xor    %eax,%eax
+  801308:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  80130e:	48 63 d0             	movslq %eax,%rdx
+  801311:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801316:	48 01 d0             	add    %rdx,%rax
+  801319:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80131e:	c9                   	leave
+  80131f:	c3                   	ret
+
+0000000000801320 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801320:	55                   	push   %rbp
+  801321:	48 89 e5             	mov    %rsp,%rbp
+  801324:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801328:	48 83 ec 40          	sub    $0x40,%rsp
+  80132c:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801331:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801336:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80133b:	eb 77                	jmp    8013b4 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80133d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801342:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801346:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80134a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80134f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801353:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801357:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80135b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80135f:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801364:	74 3c                	je     8013a2 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801366:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80136a:	f7 d0                	not    %eax
+  80136c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801370:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801374:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801378:	48 63 d0             	movslq %eax,%rdx
+  80137b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801380:	48 01 d0             	add    %rdx,%rax
+  801383:	0f b6 00             	movzbl (%rax),%eax
+  801386:	0f b6 c0             	movzbl %al,%eax
+  801389:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80138d:	48 63 ca             	movslq %edx,%rcx
+  801390:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801395:	48 01 ca             	add    %rcx,%rdx
+  801398:	0f b6 12             	movzbl (%rdx),%edx
+  80139b:	0f b6 d2             	movzbl %dl,%edx
+  80139e:	29 d0                	sub    %edx,%eax
+  8013a0:	eb 6b                	jmp    80140d <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8013a2:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8013a8:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8013ae:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8013b4:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8013ba:	77 81                	ja     80133d <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8013bc:	eb 42                	jmp    801400 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8013be:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013c3:	0f b6 10             	movzbl (%rax),%edx
+  8013c6:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013cb:	0f b6 00             	movzbl (%rax),%eax
+  8013ce:	38 c2                	cmp    %al,%dl
+  8013d0:	74 1c                	je     8013ee <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8013d2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013d7:	0f b6 00             	movzbl (%rax),%eax
+  8013da:	0f b6 c8             	movzbl %al,%ecx
+  8013dd:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013e2:	0f b6 00             	movzbl (%rax),%eax
+  8013e5:	0f b6 d0             	movzbl %al,%edx
+  8013e8:	89 c8                	mov    %ecx,%eax
+  8013ea:	29 d0                	sub    %edx,%eax
+  8013ec:	eb 1f                	jmp    80140d <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8013ee:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8013f4:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8013fa:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801400:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801406:	75 b6                	jne    8013be <memcmp_avx2+0x9e>
+  return 0;
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80140d:	c9                   	leave
+  80140e:	c3                   	ret
+
+000000000080140f <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80140f:	55                   	push   %rbp
+  801410:	48 89 e5             	mov    %rsp,%rbp
+  801413:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801417:	48 83 ec 60          	sub    $0x60,%rsp
+  80141b:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801420:	89 f0                	mov    %esi,%eax
+  801422:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801427:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  80142b:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801430:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801434:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801439:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80143f:	eb 47                	jmp    801488 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801441:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801446:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80144a:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80144e:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801454:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801458:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80145c:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801460:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801465:	74 15                	je     80147c <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801467:	31 c0                	xor    %eax,%eax
+  801469:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80146f:	48 63 d0             	movslq %eax,%rdx
+  801472:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801477:	48 01 d0             	add    %rdx,%rax
+  80147a:	eb 3d                	jmp    8014b9 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80147c:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801482:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801488:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80148e:	77 b1                	ja     801441 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801490:	eb 0c                	jmp    80149e <memfind_avx2+0x8f>
+  801492:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801498:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80149e:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8014a4:	74 0e                	je     8014b4 <memfind_avx2+0xa5>
+  8014a6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014ab:	0f b6 00             	movzbl (%rax),%eax
+  8014ae:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8014b2:	75 de                	jne    801492 <memfind_avx2+0x83>
+  return s;
+  8014b4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8014b9:	c9                   	leave
+  8014ba:	c3                   	ret
+
+00000000008014bb <strlen>:
+strlen(const char *s) {
+  8014bb:	55                   	push   %rbp
+  8014bc:	48 89 e5             	mov    %rsp,%rbp
+  8014bf:	48 83 ec 40          	sub    $0x40,%rsp
+  8014c3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8014c7:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8014cb:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8014cf:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  8014d6:	00 00 00 
+  8014d9:	ff d0                	call   *%rax
+  8014db:	83 e0 02             	and    $0x2,%eax
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	74 18                	je     8014fa <strlen+0x3f>
+    return strlen_avx2(s);
+  8014e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014e6:	48 89 c7             	mov    %rax,%rdi
+  8014e9:	48 b8 70 12 80 00 00 	movabs $0x801270,%rax
+  8014f0:	00 00 00 
+  8014f3:	ff d0                	call   *%rax
+  8014f5:	e9 82 00 00 00       	jmp    80157c <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8014fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8014fe:	83 e0 0f             	and    $0xf,%eax
+  801501:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801504:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801507:	48 f7 d8             	neg    %rax
+  80150a:	48 89 c2             	mov    %rax,%rdx
+  80150d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801511:	48 01 d0             	add    %rdx,%rax
+  801514:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801518:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80151c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801520:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801525:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801529:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80152d:	89 c2                	mov    %eax,%edx
+  80152f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801532:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801537:	89 c1                	mov    %eax,%ecx
+  801539:	d3 e6                	shl    %cl,%esi
+  80153b:	89 f0                	mov    %esi,%eax
+  80153d:	21 d0                	and    %edx,%eax
+  80153f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801542:	eb 1d                	jmp    801561 <strlen+0xa6>
+    p += 16;
+  801544:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801549:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80154d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801551:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801556:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80155a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80155e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801561:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801565:	74 dd                	je     801544 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801567:	31 c0                	xor    %eax,%eax
+  801569:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80156e:	48 63 d0             	movslq %eax,%rdx
+  801571:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801575:	48 01 d0             	add    %rdx,%rax
+  801578:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80157c:	c9                   	leave
+  80157d:	c3                   	ret
+
+000000000080157e <strnlen>:
+strnlen(const char *s, size_t size) {
+  80157e:	55                   	push   %rbp
+  80157f:	48 89 e5             	mov    %rsp,%rbp
+  801582:	48 83 ec 20          	sub    $0x20,%rsp
+  801586:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80158a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80158e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801595:	eb 0e                	jmp    8015a5 <strnlen+0x27>
+    n++;
+  801597:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80159b:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8015a0:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8015a5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8015aa:	74 0b                	je     8015b7 <strnlen+0x39>
+  8015ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015b0:	0f b6 00             	movzbl (%rax),%eax
+  8015b3:	84 c0                	test   %al,%al
+  8015b5:	75 e0                	jne    801597 <strnlen+0x19>
+  return n;
+  8015b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8015ba:	c9                   	leave
+  8015bb:	c3                   	ret
+
+00000000008015bc <strcpy>:
+strcpy(char *dst, const char *src) {
+  8015bc:	55                   	push   %rbp
+  8015bd:	48 89 e5             	mov    %rsp,%rbp
+  8015c0:	48 83 ec 20          	sub    $0x20,%rsp
+  8015c4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015c8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8015cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8015d4:	90                   	nop
+  8015d5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015d9:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8015dd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8015e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015e5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8015e9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8015ed:	0f b6 12             	movzbl (%rdx),%edx
+  8015f0:	88 10                	mov    %dl,(%rax)
+  8015f2:	0f b6 00             	movzbl (%rax),%eax
+  8015f5:	84 c0                	test   %al,%al
+  8015f7:	75 dc                	jne    8015d5 <strcpy+0x19>
+  return ret;
+  8015f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8015fd:	c9                   	leave
+  8015fe:	c3                   	ret
+
+00000000008015ff <strcat>:
+strcat(char *dst, const char *src) {
+  8015ff:	55                   	push   %rbp
+  801600:	48 89 e5             	mov    %rsp,%rbp
+  801603:	48 83 ec 20          	sub    $0x20,%rsp
+  801607:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80160b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80160f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801613:	48 89 c7             	mov    %rax,%rdi
+  801616:	48 b8 bb 14 80 00 00 	movabs $0x8014bb,%rax
+  80161d:	00 00 00 
+  801620:	ff d0                	call   *%rax
+  801622:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801625:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801628:	48 63 d0             	movslq %eax,%rdx
+  80162b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80162f:	48 01 c2             	add    %rax,%rdx
+  801632:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801636:	48 89 c6             	mov    %rax,%rsi
+  801639:	48 89 d7             	mov    %rdx,%rdi
+  80163c:	48 b8 bc 15 80 00 00 	movabs $0x8015bc,%rax
+  801643:	00 00 00 
+  801646:	ff d0                	call   *%rax
+  return dst;
+  801648:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80164c:	c9                   	leave
+  80164d:	c3                   	ret
+
+000000000080164e <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80164e:	55                   	push   %rbp
+  80164f:	48 89 e5             	mov    %rsp,%rbp
+  801652:	48 83 ec 28          	sub    $0x28,%rsp
+  801656:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80165a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80165e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801662:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801666:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  80166a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801671:	00 
+  801672:	eb 2a                	jmp    80169e <strncpy+0x50>
+    *dst++ = *src;
+  801674:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801678:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80167c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801680:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801684:	0f b6 12             	movzbl (%rdx),%edx
+  801687:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801689:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80168d:	0f b6 00             	movzbl (%rax),%eax
+  801690:	84 c0                	test   %al,%al
+  801692:	74 05                	je     801699 <strncpy+0x4b>
+      src++;
+  801694:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801699:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80169e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016a2:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8016a6:	72 cc                	jb     801674 <strncpy+0x26>
+  return ret;
+  8016a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8016ac:	c9                   	leave
+  8016ad:	c3                   	ret
+
+00000000008016ae <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8016ae:	55                   	push   %rbp
+  8016af:	48 89 e5             	mov    %rsp,%rbp
+  8016b2:	48 83 ec 28          	sub    $0x28,%rsp
+  8016b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016ba:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016be:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8016c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8016ca:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016cf:	74 3d                	je     80170e <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8016d1:	eb 1d                	jmp    8016f0 <strlcpy+0x42>
+      *dst++ = *src++;
+  8016d3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016d7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016db:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016e7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016eb:	0f b6 12             	movzbl (%rdx),%edx
+  8016ee:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8016f0:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8016f5:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016fa:	74 0b                	je     801707 <strlcpy+0x59>
+  8016fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801700:	0f b6 00             	movzbl (%rax),%eax
+  801703:	84 c0                	test   %al,%al
+  801705:	75 cc                	jne    8016d3 <strlcpy+0x25>
+    *dst = '\0';
+  801707:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80170b:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80170e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801712:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801716:	c9                   	leave
+  801717:	c3                   	ret
+
+0000000000801718 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801718:	55                   	push   %rbp
+  801719:	48 89 e5             	mov    %rsp,%rbp
+  80171c:	48 83 ec 30          	sub    $0x30,%rsp
+  801720:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801724:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801728:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80172c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801730:	48 89 c7             	mov    %rax,%rdi
+  801733:	48 b8 bb 14 80 00 00 	movabs $0x8014bb,%rax
+  80173a:	00 00 00 
+  80173d:	ff d0                	call   *%rax
+  80173f:	48 98                	cltq
+  801741:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801745:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801749:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80174d:	48 89 d6             	mov    %rdx,%rsi
+  801750:	48 89 c7             	mov    %rax,%rdi
+  801753:	48 b8 7e 15 80 00 00 	movabs $0x80157e,%rax
+  80175a:	00 00 00 
+  80175d:	ff d0                	call   *%rax
+  80175f:	48 98                	cltq
+  801761:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801769:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80176d:	75 10                	jne    80177f <strlcat+0x67>
+    return maxlen + srclen;
+  80176f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801777:	48 01 d0             	add    %rdx,%rax
+  80177a:	e9 86 00 00 00       	jmp    801805 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80177f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801783:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801787:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80178b:	73 2b                	jae    8017b8 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80178d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801791:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801795:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801799:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80179d:	48 01 c1             	add    %rax,%rcx
+  8017a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017a4:	48 89 c6             	mov    %rax,%rsi
+  8017a7:	48 89 cf             	mov    %rcx,%rdi
+  8017aa:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  8017b1:	00 00 00 
+  8017b4:	ff d0                	call   *%rax
+  8017b6:	eb 42                	jmp    8017fa <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8017b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017bc:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017c0:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8017c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c8:	48 01 c1             	add    %rax,%rcx
+  8017cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017cf:	48 89 c6             	mov    %rax,%rsi
+  8017d2:	48 89 cf             	mov    %rcx,%rdi
+  8017d5:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  8017dc:	00 00 00 
+  8017df:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8017e1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017e9:	48 01 d0             	add    %rdx,%rax
+  8017ec:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017f0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017f4:	48 01 d0             	add    %rdx,%rax
+  8017f7:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8017fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8017fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801802:	48 01 d0             	add    %rdx,%rax
+}
+  801805:	c9                   	leave
+  801806:	c3                   	ret
+
+0000000000801807 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801807:	55                   	push   %rbp
+  801808:	48 89 e5             	mov    %rsp,%rbp
+  80180b:	48 83 ec 10          	sub    $0x10,%rsp
+  80180f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801813:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801817:	eb 0a                	jmp    801823 <strcmp+0x1c>
+    p++, q++;
+  801819:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80181e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801823:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801827:	0f b6 00             	movzbl (%rax),%eax
+  80182a:	84 c0                	test   %al,%al
+  80182c:	74 12                	je     801840 <strcmp+0x39>
+  80182e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801832:	0f b6 10             	movzbl (%rax),%edx
+  801835:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801839:	0f b6 00             	movzbl (%rax),%eax
+  80183c:	38 c2                	cmp    %al,%dl
+  80183e:	74 d9                	je     801819 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801840:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801844:	0f b6 00             	movzbl (%rax),%eax
+  801847:	0f b6 d0             	movzbl %al,%edx
+  80184a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80184e:	0f b6 00             	movzbl (%rax),%eax
+  801851:	0f b6 c0             	movzbl %al,%eax
+  801854:	29 c2                	sub    %eax,%edx
+  801856:	89 d0                	mov    %edx,%eax
+}
+  801858:	c9                   	leave
+  801859:	c3                   	ret
+
+000000000080185a <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  80185a:	55                   	push   %rbp
+  80185b:	48 89 e5             	mov    %rsp,%rbp
+  80185e:	48 83 ec 18          	sub    $0x18,%rsp
+  801862:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801866:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80186a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80186e:	eb 0f                	jmp    80187f <strncmp+0x25>
+    n--, p++, q++;
+  801870:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801875:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80187a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80187f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801884:	74 1d                	je     8018a3 <strncmp+0x49>
+  801886:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80188a:	0f b6 00             	movzbl (%rax),%eax
+  80188d:	84 c0                	test   %al,%al
+  80188f:	74 12                	je     8018a3 <strncmp+0x49>
+  801891:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801895:	0f b6 10             	movzbl (%rax),%edx
+  801898:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80189c:	0f b6 00             	movzbl (%rax),%eax
+  80189f:	38 c2                	cmp    %al,%dl
+  8018a1:	74 cd                	je     801870 <strncmp+0x16>
+  if (n == 0)
+  8018a3:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8018a8:	75 07                	jne    8018b1 <strncmp+0x57>
+    return 0;
+  8018aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018af:	eb 16                	jmp    8018c7 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8018b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018b5:	0f b6 00             	movzbl (%rax),%eax
+  8018b8:	0f b6 d0             	movzbl %al,%edx
+  8018bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018bf:	0f b6 00             	movzbl (%rax),%eax
+  8018c2:	0f b6 c0             	movzbl %al,%eax
+  8018c5:	29 c2                	sub    %eax,%edx
+}
+  8018c7:	89 d0                	mov    %edx,%eax
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+
+00000000008018cb <strchr>:
+strchr(const char *s, char c) {
+  8018cb:	55                   	push   %rbp
+  8018cc:	48 89 e5             	mov    %rsp,%rbp
+  8018cf:	48 83 ec 60          	sub    $0x60,%rsp
+  8018d3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8018d7:	89 f0                	mov    %esi,%eax
+  8018d9:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8018dc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018e0:	83 e0 0f             	and    $0xf,%eax
+  8018e3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8018e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018e9:	48 f7 d8             	neg    %rax
+  8018ec:	48 89 c2             	mov    %rax,%rdx
+  8018ef:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018f3:	48 01 d0             	add    %rdx,%rax
+  8018f6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8018fa:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8018fe:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801902:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801906:	66 0f 6e c0          	movd   %eax,%xmm0
+  80190a:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80190e:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801912:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801917:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  80191b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80191f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801923:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801927:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80192c:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801931:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801935:	89 c2                	mov    %eax,%edx
+  801937:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  80193c:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801941:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801945:	09 c2                	or     %eax,%edx
+  801947:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80194a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80194f:	89 c1                	mov    %eax,%ecx
+  801951:	d3 e6                	shl    %cl,%esi
+  801953:	89 f0                	mov    %esi,%eax
+  801955:	21 d0                	and    %edx,%eax
+  801957:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80195a:	eb 34                	jmp    801990 <strchr+0xc5>
+    p += 16;
+  80195c:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801961:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801965:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801969:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80196d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801972:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801977:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80197b:	89 c2                	mov    %eax,%edx
+  80197d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801982:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801987:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80198b:	09 d0                	or     %edx,%eax
+  80198d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801990:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801994:	74 c6                	je     80195c <strchr+0x91>
+  p += __builtin_ctz(m);
+  801996:	31 c0                	xor    %eax,%eax
+  801998:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80199d:	48 98                	cltq
+  80199f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  8019a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019a7:	0f b6 00             	movzbl (%rax),%eax
+  8019aa:	84 c0                	test   %al,%al
+  8019ac:	74 06                	je     8019b4 <strchr+0xe9>
+  8019ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b2:	eb 05                	jmp    8019b9 <strchr+0xee>
+  8019b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019b9:	c9                   	leave
+  8019ba:	c3                   	ret
+
+00000000008019bb <strfind>:
+strfind(const char *s, char c) {
+  8019bb:	55                   	push   %rbp
+  8019bc:	48 89 e5             	mov    %rsp,%rbp
+  8019bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8019c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8019c7:	89 f0                	mov    %esi,%eax
+  8019c9:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8019cc:	eb 11                	jmp    8019df <strfind+0x24>
+    if (*s == c)
+  8019ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019d2:	0f b6 00             	movzbl (%rax),%eax
+  8019d5:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8019d8:	74 12                	je     8019ec <strfind+0x31>
+  for (; *s; s++)
+  8019da:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8019df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019e3:	0f b6 00             	movzbl (%rax),%eax
+  8019e6:	84 c0                	test   %al,%al
+  8019e8:	75 e4                	jne    8019ce <strfind+0x13>
+  8019ea:	eb 01                	jmp    8019ed <strfind+0x32>
+      break;
+  8019ec:	90                   	nop
+  return (char *)s;
+  8019ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8019f1:	c9                   	leave
+  8019f2:	c3                   	ret
+
+00000000008019f3 <memset>:
+memset(void *v, int c, size_t n) {
+  8019f3:	55                   	push   %rbp
+  8019f4:	48 89 e5             	mov    %rsp,%rbp
+  8019f7:	48 83 ec 38          	sub    $0x38,%rsp
+  8019fb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8019ff:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801a02:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801a06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a0a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a0e:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a13:	76 41                	jbe    801a56 <memset+0x63>
+  801a15:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  801a1c:	00 00 00 
+  801a1f:	ff d0                	call   *%rax
+  801a21:	83 e0 01             	and    $0x1,%eax
+  801a24:	85 c0                	test   %eax,%eax
+  801a26:	74 2e                	je     801a56 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801a28:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a2b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a2f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a33:	48 89 ce             	mov    %rcx,%rsi
+  801a36:	48 89 f7             	mov    %rsi,%rdi
+  801a39:	48 89 d1             	mov    %rdx,%rcx
+  801a3c:	fc                   	cld
+  801a3d:	f3 aa                	rep stos %al,%es:(%rdi)
+  801a3f:	48 89 ca             	mov    %rcx,%rdx
+  801a42:	48 89 fe             	mov    %rdi,%rsi
+  801a45:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801a49:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801a4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a51:	e9 a7 00 00 00       	jmp    801afd <memset+0x10a>
+  if (n >= 8) {
+  801a56:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801a5b:	0f 86 87 00 00 00    	jbe    801ae8 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801a61:	eb 16                	jmp    801a79 <memset+0x86>
+      *p++ = c;
+  801a63:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a67:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a6b:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a6f:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801a72:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801a74:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801a79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a7d:	83 e0 07             	and    $0x7,%eax
+  801a80:	48 85 c0             	test   %rax,%rax
+  801a83:	75 de                	jne    801a63 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801a85:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a88:	0f b6 c0             	movzbl %al,%eax
+  801a8b:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801a92:	01 01 01 
+  801a95:	48 0f af c2          	imul   %rdx,%rax
+  801a99:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801a9d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aa1:	48 c1 e8 03          	shr    $0x3,%rax
+  801aa5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801aa9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aad:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801ab1:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801ab5:	48 89 ce             	mov    %rcx,%rsi
+  801ab8:	48 89 f7             	mov    %rsi,%rdi
+  801abb:	48 89 d1             	mov    %rdx,%rcx
+  801abe:	fc                   	cld
+  801abf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801ac2:	48 89 ca             	mov    %rcx,%rdx
+  801ac5:	48 89 fe             	mov    %rdi,%rsi
+  801ac8:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801acc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801ad0:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801ad5:	eb 11                	jmp    801ae8 <memset+0xf5>
+    *p++ = c;
+  801ad7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801adb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801adf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ae3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801ae6:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801ae8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aec:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801af0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801af4:	48 85 c0             	test   %rax,%rax
+  801af7:	75 de                	jne    801ad7 <memset+0xe4>
+  return v;
+  801af9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801afd:	c9                   	leave
+  801afe:	c3                   	ret
+
+0000000000801aff <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801aff:	55                   	push   %rbp
+  801b00:	48 89 e5             	mov    %rsp,%rbp
+  801b03:	48 83 ec 38          	sub    $0x38,%rsp
+  801b07:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b0b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b0f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801b13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b17:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801b1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801b23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b27:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801b2b:	0f 83 da 00 00 00    	jae    801c0b <memmove+0x10c>
+  801b31:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b35:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b39:	48 01 d0             	add    %rdx,%rax
+  801b3c:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801b40:	0f 83 c5 00 00 00    	jae    801c0b <memmove+0x10c>
+    s += n;
+  801b46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b4a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801b4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b52:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801b56:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b5b:	0f 86 94 00 00 00    	jbe    801bf5 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801b61:	eb 1c                	jmp    801b7f <memmove+0x80>
+        *--d = *--s;
+  801b63:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801b68:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801b6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b71:	0f b6 10             	movzbl (%rax),%edx
+  801b74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b78:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801b7a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b7f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b83:	83 e0 07             	and    $0x7,%eax
+  801b86:	48 85 c0             	test   %rax,%rax
+  801b89:	75 d8                	jne    801b63 <memmove+0x64>
+      nq = n / 8;
+  801b8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b8f:	48 c1 e8 03          	shr    $0x3,%rax
+  801b93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b97:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801b9c:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801ba1:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801ba6:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801baa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bb2:	48 89 cf             	mov    %rcx,%rdi
+  801bb5:	48 89 d6             	mov    %rdx,%rsi
+  801bb8:	48 89 c1             	mov    %rax,%rcx
+  801bbb:	fd                   	std
+  801bbc:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801bbf:	fc                   	cld
+  801bc0:	48 89 c8             	mov    %rcx,%rax
+  801bc3:	48 89 f2             	mov    %rsi,%rdx
+  801bc6:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801bca:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bce:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801bd2:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801bd7:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801bdc:	eb 17                	jmp    801bf5 <memmove+0xf6>
+      *--d = *--s;
+  801bde:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801be3:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801be8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bec:	0f b6 10             	movzbl (%rax),%edx
+  801bef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bf3:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801bf5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bf9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bfd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c01:	48 85 c0             	test   %rax,%rax
+  801c04:	75 d8                	jne    801bde <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801c06:	e9 f4 00 00 00       	jmp    801cff <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c0b:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c10:	76 46                	jbe    801c58 <memmove+0x159>
+  801c12:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+  801c1e:	83 e0 01             	and    $0x1,%eax
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	74 33                	je     801c58 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801c25:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c29:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c2d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c31:	48 89 cf             	mov    %rcx,%rdi
+  801c34:	48 89 d6             	mov    %rdx,%rsi
+  801c37:	48 89 c1             	mov    %rax,%rcx
+  801c3a:	fc                   	cld
+  801c3b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801c3d:	48 89 c8             	mov    %rcx,%rax
+  801c40:	48 89 f2             	mov    %rsi,%rdx
+  801c43:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c47:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c4b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801c4f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c53:	e9 ab 00 00 00       	jmp    801d03 <memmove+0x204>
+    if (n >= 8) {
+  801c58:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c5d:	0f 86 8b 00 00 00    	jbe    801cee <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801c63:	eb 22                	jmp    801c87 <memmove+0x188>
+        *d++ = *s++;
+  801c65:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c69:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c6d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801c71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c75:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c79:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801c7d:	0f b6 12             	movzbl (%rdx),%edx
+  801c80:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c82:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c87:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c8b:	83 e0 07             	and    $0x7,%eax
+  801c8e:	48 85 c0             	test   %rax,%rax
+  801c91:	75 d2                	jne    801c65 <memmove+0x166>
+      nq = n / 8;
+  801c93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c97:	48 c1 e8 03          	shr    $0x3,%rax
+  801c9b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801c9f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ca3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ca7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cab:	48 89 cf             	mov    %rcx,%rdi
+  801cae:	48 89 d6             	mov    %rdx,%rsi
+  801cb1:	48 89 c1             	mov    %rax,%rcx
+  801cb4:	fc                   	cld
+  801cb5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801cb8:	48 89 c8             	mov    %rcx,%rax
+  801cbb:	48 89 f2             	mov    %rsi,%rdx
+  801cbe:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801cc2:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cc6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801cca:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801ccf:	eb 1d                	jmp    801cee <memmove+0x1ef>
+      *d++ = *s++;
+  801cd1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cd5:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801cd9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801cdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ce1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ce5:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801ce9:	0f b6 12             	movzbl (%rdx),%edx
+  801cec:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801cee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cf2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cf6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cfa:	48 85 c0             	test   %rax,%rax
+  801cfd:	75 d2                	jne    801cd1 <memmove+0x1d2>
+  return dst;
+  801cff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801d03:	c9                   	leave
+  801d04:	c3                   	ret
+
+0000000000801d05 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801d05:	55                   	push   %rbp
+  801d06:	48 89 e5             	mov    %rsp,%rbp
+  801d09:	48 83 ec 18          	sub    $0x18,%rsp
+  801d0d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d11:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d15:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801d19:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d1d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d25:	48 89 ce             	mov    %rcx,%rsi
+  801d28:	48 89 c7             	mov    %rax,%rdi
+  801d2b:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801d32:	00 00 00 
+  801d35:	ff d0                	call   *%rax
+}
+  801d37:	c9                   	leave
+  801d38:	c3                   	ret
+
+0000000000801d39 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801d39:	55                   	push   %rbp
+  801d3a:	48 89 e5             	mov    %rsp,%rbp
+  801d3d:	48 83 ec 40          	sub    $0x40,%rsp
+  801d41:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d45:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d49:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801d4d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d51:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801d55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d59:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801d5d:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801d62:	0f 86 a7 00 00 00    	jbe    801e0f <memcmp+0xd6>
+  801d68:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  801d6f:	00 00 00 
+  801d72:	ff d0                	call   *%rax
+  801d74:	83 e0 02             	and    $0x2,%eax
+  801d77:	85 c0                	test   %eax,%eax
+  801d79:	0f 84 90 00 00 00    	je     801e0f <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801d7f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801d83:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d8b:	48 89 ce             	mov    %rcx,%rsi
+  801d8e:	48 89 c7             	mov    %rax,%rdi
+  801d91:	48 b8 20 13 80 00 00 	movabs $0x801320,%rax
+  801d98:	00 00 00 
+  801d9b:	ff d0                	call   *%rax
+  801d9d:	e9 c2 00 00 00       	jmp    801e64 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801da2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801da6:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801daa:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801dae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801db2:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801db6:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801dba:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801dbe:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801dc1:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801dc8:	74 36                	je     801e00 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801dca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801dcd:	f7 d0                	not    %eax
+  801dcf:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801dd3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801dd6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801dd9:	48 63 d0             	movslq %eax,%rdx
+  801ddc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801de0:	48 01 d0             	add    %rdx,%rax
+  801de3:	0f b6 00             	movzbl (%rax),%eax
+  801de6:	0f b6 c0             	movzbl %al,%eax
+  801de9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801dec:	48 63 ca             	movslq %edx,%rcx
+  801def:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801df3:	48 01 ca             	add    %rcx,%rdx
+  801df6:	0f b6 12             	movzbl (%rdx),%edx
+  801df9:	0f b6 d2             	movzbl %dl,%edx
+  801dfc:	29 d0                	sub    %edx,%eax
+  801dfe:	eb 64                	jmp    801e64 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801e00:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801e05:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801e0a:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801e0f:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801e14:	77 8c                	ja     801da2 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801e16:	eb 36                	jmp    801e4e <memcmp+0x115>
+    if (*s1 != *s2)
+  801e18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e1c:	0f b6 10             	movzbl (%rax),%edx
+  801e1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e23:	0f b6 00             	movzbl (%rax),%eax
+  801e26:	38 c2                	cmp    %al,%dl
+  801e28:	74 1a                	je     801e44 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801e2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e2e:	0f b6 00             	movzbl (%rax),%eax
+  801e31:	0f b6 c8             	movzbl %al,%ecx
+  801e34:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e38:	0f b6 00             	movzbl (%rax),%eax
+  801e3b:	0f b6 d0             	movzbl %al,%edx
+  801e3e:	89 c8                	mov    %ecx,%eax
+  801e40:	29 d0                	sub    %edx,%eax
+  801e42:	eb 20                	jmp    801e64 <memcmp+0x12b>
+    s1++, s2++;
+  801e44:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e49:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801e4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e52:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e56:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e5a:	48 85 c0             	test   %rax,%rax
+  801e5d:	75 b9                	jne    801e18 <memcmp+0xdf>
+  }
+
+  return 0;
+  801e5f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e64:	c9                   	leave
+  801e65:	c3                   	ret
+
+0000000000801e66 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801e66:	55                   	push   %rbp
+  801e67:	48 89 e5             	mov    %rsp,%rbp
+  801e6a:	48 83 ec 50          	sub    $0x50,%rsp
+  801e6e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e72:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801e75:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801e79:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e7d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801e81:	48 01 d0             	add    %rdx,%rax
+  801e84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801e88:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e8b:	66 0f 6e c0          	movd   %eax,%xmm0
+  801e8f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801e93:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801e97:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801e9c:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801ea0:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801ea5:	76 73                	jbe    801f1a <memfind+0xb4>
+  801ea7:	48 b8 58 11 80 00 00 	movabs $0x801158,%rax
+  801eae:	00 00 00 
+  801eb1:	ff d0                	call   *%rax
+  801eb3:	83 e0 02             	and    $0x2,%eax
+  801eb6:	85 c0                	test   %eax,%eax
+  801eb8:	74 60                	je     801f1a <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801eba:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801ebd:	0f b6 c8             	movzbl %al,%ecx
+  801ec0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801ec4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ec8:	89 ce                	mov    %ecx,%esi
+  801eca:	48 89 c7             	mov    %rax,%rdi
+  801ecd:	48 b8 0f 14 80 00 00 	movabs $0x80140f,%rax
+  801ed4:	00 00 00 
+  801ed7:	ff d0                	call   *%rax
+  801ed9:	eb 6c                	jmp    801f47 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801edb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801edf:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ee3:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801ee7:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801eec:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ef0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ef4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801ef7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801efb:	74 13                	je     801f10 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801efd:	31 c0                	xor    %eax,%eax
+  801eff:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801f04:	48 63 d0             	movslq %eax,%rdx
+  801f07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f0b:	48 01 d0             	add    %rdx,%rax
+  801f0e:	eb 37                	jmp    801f47 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801f10:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801f15:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801f1a:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801f1f:	77 ba                	ja     801edb <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801f21:	eb 13                	jmp    801f36 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801f23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f27:	0f b6 00             	movzbl (%rax),%eax
+  801f2a:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801f2d:	38 d0                	cmp    %dl,%al
+  801f2f:	74 11                	je     801f42 <memfind+0xdc>
+  for (; s < ends; s++)
+  801f31:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801f36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f3a:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801f3e:	72 e3                	jb     801f23 <memfind+0xbd>
+  801f40:	eb 01                	jmp    801f43 <memfind+0xdd>
+      break;
+  801f42:	90                   	nop
+  return (void *)s;
+  801f43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801f47:	c9                   	leave
+  801f48:	c3                   	ret
+
+0000000000801f49 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801f49:	55                   	push   %rbp
+  801f4a:	48 89 e5             	mov    %rsp,%rbp
+  801f4d:	48 83 ec 38          	sub    $0x38,%rsp
+  801f51:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801f55:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801f59:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801f5c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801f63:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801f6a:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801f6b:	eb 05                	jmp    801f72 <strtol+0x29>
+    s++;
+  801f6d:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801f72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f76:	0f b6 00             	movzbl (%rax),%eax
+  801f79:	3c 20                	cmp    $0x20,%al
+  801f7b:	74 f0                	je     801f6d <strtol+0x24>
+  801f7d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f81:	0f b6 00             	movzbl (%rax),%eax
+  801f84:	3c 09                	cmp    $0x9,%al
+  801f86:	74 e5                	je     801f6d <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801f88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f8c:	0f b6 00             	movzbl (%rax),%eax
+  801f8f:	3c 2b                	cmp    $0x2b,%al
+  801f91:	75 07                	jne    801f9a <strtol+0x51>
+    s++;
+  801f93:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f98:	eb 17                	jmp    801fb1 <strtol+0x68>
+  else if (*s == '-')
+  801f9a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f9e:	0f b6 00             	movzbl (%rax),%eax
+  801fa1:	3c 2d                	cmp    $0x2d,%al
+  801fa3:	75 0c                	jne    801fb1 <strtol+0x68>
+    s++, neg = 1;
+  801fa5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801faa:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801fb1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fb5:	74 06                	je     801fbd <strtol+0x74>
+  801fb7:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801fbb:	75 28                	jne    801fe5 <strtol+0x9c>
+  801fbd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fc1:	0f b6 00             	movzbl (%rax),%eax
+  801fc4:	3c 30                	cmp    $0x30,%al
+  801fc6:	75 1d                	jne    801fe5 <strtol+0x9c>
+  801fc8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fcc:	48 83 c0 01          	add    $0x1,%rax
+  801fd0:	0f b6 00             	movzbl (%rax),%eax
+  801fd3:	3c 78                	cmp    $0x78,%al
+  801fd5:	75 0e                	jne    801fe5 <strtol+0x9c>
+    s += 2, base = 16;
+  801fd7:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801fdc:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801fe3:	eb 2c                	jmp    802011 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801fe5:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801fe9:	75 19                	jne    802004 <strtol+0xbb>
+  801feb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fef:	0f b6 00             	movzbl (%rax),%eax
+  801ff2:	3c 30                	cmp    $0x30,%al
+  801ff4:	75 0e                	jne    802004 <strtol+0xbb>
+    s++, base = 8;
+  801ff6:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ffb:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802002:	eb 0d                	jmp    802011 <strtol+0xc8>
+  else if (base == 0)
+  802004:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802008:	75 07                	jne    802011 <strtol+0xc8>
+    base = 10;
+  80200a:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802011:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802015:	0f b6 00             	movzbl (%rax),%eax
+  802018:	3c 2f                	cmp    $0x2f,%al
+  80201a:	7e 1d                	jle    802039 <strtol+0xf0>
+  80201c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802020:	0f b6 00             	movzbl (%rax),%eax
+  802023:	3c 39                	cmp    $0x39,%al
+  802025:	7f 12                	jg     802039 <strtol+0xf0>
+      dig = *s - '0';
+  802027:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80202b:	0f b6 00             	movzbl (%rax),%eax
+  80202e:	0f be c0             	movsbl %al,%eax
+  802031:	83 e8 30             	sub    $0x30,%eax
+  802034:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802037:	eb 4e                	jmp    802087 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802039:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80203d:	0f b6 00             	movzbl (%rax),%eax
+  802040:	3c 60                	cmp    $0x60,%al
+  802042:	7e 1d                	jle    802061 <strtol+0x118>
+  802044:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802048:	0f b6 00             	movzbl (%rax),%eax
+  80204b:	3c 7a                	cmp    $0x7a,%al
+  80204d:	7f 12                	jg     802061 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  80204f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802053:	0f b6 00             	movzbl (%rax),%eax
+  802056:	0f be c0             	movsbl %al,%eax
+  802059:	83 e8 57             	sub    $0x57,%eax
+  80205c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80205f:	eb 26                	jmp    802087 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802061:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802065:	0f b6 00             	movzbl (%rax),%eax
+  802068:	3c 40                	cmp    $0x40,%al
+  80206a:	7e 47                	jle    8020b3 <strtol+0x16a>
+  80206c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802070:	0f b6 00             	movzbl (%rax),%eax
+  802073:	3c 5a                	cmp    $0x5a,%al
+  802075:	7f 3c                	jg     8020b3 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802077:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80207b:	0f b6 00             	movzbl (%rax),%eax
+  80207e:	0f be c0             	movsbl %al,%eax
+  802081:	83 e8 37             	sub    $0x37,%eax
+  802084:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802087:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80208a:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80208d:	7d 23                	jge    8020b2 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80208f:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802094:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802097:	48 98                	cltq
+  802099:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80209e:	48 89 c2             	mov    %rax,%rdx
+  8020a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8020a4:	48 98                	cltq
+  8020a6:	48 01 d0             	add    %rdx,%rax
+  8020a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8020ad:	e9 5f ff ff ff       	jmp    802011 <strtol+0xc8>
+      break;
+  8020b2:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8020b3:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8020b8:	74 0b                	je     8020c5 <strtol+0x17c>
+    *endptr = (char *)s;
+  8020ba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8020be:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8020c2:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8020c5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8020c9:	74 09                	je     8020d4 <strtol+0x18b>
+  8020cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020cf:	48 f7 d8             	neg    %rax
+  8020d2:	eb 04                	jmp    8020d8 <strtol+0x18f>
+  8020d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8020d8:	c9                   	leave
+  8020d9:	c3                   	ret
+
+00000000008020da <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8020da:	55                   	push   %rbp
+  8020db:	48 89 e5             	mov    %rsp,%rbp
+  8020de:	53                   	push   %rbx
+  8020df:	48 83 ec 48          	sub    $0x48,%rsp
+  8020e3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8020e7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8020eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8020ef:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8020f3:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8020f7:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8020fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ff:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802103:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802107:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80210b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80210f:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802113:	4c 89 c3             	mov    %r8,%rbx
+  802116:	cd 30                	int    $0x30
+  802118:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80211c:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802121:	74 46                	je     802169 <syscall+0x8f>
+  802123:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802128:	7e 3f                	jle    802169 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80212a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80212e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802132:	49 89 d0             	mov    %rdx,%r8
+  802135:	48 89 c1             	mov    %rax,%rcx
+  802138:	48 b8 48 6c 80 00 00 	movabs $0x806c48,%rax
+  80213f:	00 00 00 
+  802142:	48 89 c2             	mov    %rax,%rdx
+  802145:	be 22 00 00 00       	mov    $0x22,%esi
+  80214a:	48 b8 67 6c 80 00 00 	movabs $0x806c67,%rax
+  802151:	00 00 00 
+  802154:	48 89 c7             	mov    %rax,%rdi
+  802157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215c:	49 b9 ed 03 80 00 00 	movabs $0x8003ed,%r9
+  802163:	00 00 00 
+  802166:	41 ff d1             	call   *%r9
+
+  return ret;
+  802169:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80216d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802171:	c9                   	leave
+  802172:	c3                   	ret
+
+0000000000802173 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802173:	55                   	push   %rbp
+  802174:	48 89 e5             	mov    %rsp,%rbp
+  802177:	48 83 ec 10          	sub    $0x10,%rsp
+  80217b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80217f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802183:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802187:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80218b:	48 83 ec 08          	sub    $0x8,%rsp
+  80218f:	6a 00                	push   $0x0
+  802191:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802197:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80219d:	48 89 d1             	mov    %rdx,%rcx
+  8021a0:	48 89 c2             	mov    %rax,%rdx
+  8021a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021ad:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+  8021b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021bd:	90                   	nop
+  8021be:	c9                   	leave
+  8021bf:	c3                   	ret
+
+00000000008021c0 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8021c0:	55                   	push   %rbp
+  8021c1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8021c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c8:	6a 00                	push   $0x0
+  8021ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8021ea:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8021f1:	00 00 00 
+  8021f4:	ff d0                	call   *%rax
+  8021f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021fa:	c9                   	leave
+  8021fb:	c3                   	ret
+
+00000000008021fc <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8021fc:	55                   	push   %rbp
+  8021fd:	48 89 e5             	mov    %rsp,%rbp
+  802200:	48 83 ec 10          	sub    $0x10,%rsp
+  802204:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802207:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80220a:	48 98                	cltq
+  80220c:	48 83 ec 08          	sub    $0x8,%rsp
+  802210:	6a 00                	push   $0x0
+  802212:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802218:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80221e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802223:	48 89 c2             	mov    %rax,%rdx
+  802226:	be 01 00 00 00       	mov    $0x1,%esi
+  80222b:	bf 03 00 00 00       	mov    $0x3,%edi
+  802230:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802237:	00 00 00 
+  80223a:	ff d0                	call   *%rax
+  80223c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802240:	c9                   	leave
+  802241:	c3                   	ret
+
+0000000000802242 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802242:	55                   	push   %rbp
+  802243:	48 89 e5             	mov    %rsp,%rbp
+  802246:	48 83 ec 10          	sub    $0x10,%rsp
+  80224a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80224d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802250:	48 98                	cltq
+  802252:	48 83 ec 08          	sub    $0x8,%rsp
+  802256:	6a 00                	push   $0x0
+  802258:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80225e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802264:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802269:	48 89 c2             	mov    %rax,%rdx
+  80226c:	be 00 00 00 00       	mov    $0x0,%esi
+  802271:	bf 04 00 00 00       	mov    $0x4,%edi
+  802276:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80227d:	00 00 00 
+  802280:	ff d0                	call   *%rax
+  802282:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802286:	90                   	nop
+  802287:	c9                   	leave
+  802288:	c3                   	ret
+
+0000000000802289 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802289:	55                   	push   %rbp
+  80228a:	48 89 e5             	mov    %rsp,%rbp
+  80228d:	48 83 ec 20          	sub    $0x20,%rsp
+  802291:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802294:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802298:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80229b:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80229e:	b8 05 00 00 00       	mov    $0x5,%eax
+  8022a3:	cd 30                	int    $0x30
+  8022a5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8022a9:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8022ad:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8022b2:	7e 3d                	jle    8022f1 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8022b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022b8:	49 89 c0             	mov    %rax,%r8
+  8022bb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8022c0:	48 b8 48 6c 80 00 00 	movabs $0x806c48,%rax
+  8022c7:	00 00 00 
+  8022ca:	48 89 c2             	mov    %rax,%rdx
+  8022cd:	be 49 00 00 00       	mov    $0x49,%esi
+  8022d2:	48 b8 67 6c 80 00 00 	movabs $0x806c67,%rax
+  8022d9:	00 00 00 
+  8022dc:	48 89 c7             	mov    %rax,%rdi
+  8022df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e4:	49 b9 ed 03 80 00 00 	movabs $0x8003ed,%r9
+  8022eb:	00 00 00 
+  8022ee:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8022f1:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8022f6:	75 13                	jne    80230b <sys_env_wait+0x82>
+  8022f8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8022fd:	74 0c                	je     80230b <sys_env_wait+0x82>
+    *status = st;
+  8022ff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802303:	89 c2                	mov    %eax,%edx
+  802305:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802309:	89 10                	mov    %edx,(%rax)
+  return ret;
+  80230b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80230f:	c9                   	leave
+  802310:	c3                   	ret
+
+0000000000802311 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802311:	55                   	push   %rbp
+  802312:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802315:	48 83 ec 08          	sub    $0x8,%rsp
+  802319:	6a 00                	push   $0x0
+  80231b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802321:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802327:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80232c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802331:	be 00 00 00 00       	mov    $0x0,%esi
+  802336:	bf 02 00 00 00       	mov    $0x2,%edi
+  80233b:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802342:	00 00 00 
+  802345:	ff d0                	call   *%rax
+  802347:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80234b:	c9                   	leave
+  80234c:	c3                   	ret
+
+000000000080234d <sys_yield>:
+
+void
+sys_yield(void) {
+  80234d:	55                   	push   %rbp
+  80234e:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802351:	48 83 ec 08          	sub    $0x8,%rsp
+  802355:	6a 00                	push   $0x0
+  802357:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80235d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802363:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236d:	be 00 00 00 00       	mov    $0x0,%esi
+  802372:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802377:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80237e:	00 00 00 
+  802381:	ff d0                	call   *%rax
+  802383:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802387:	90                   	nop
+  802388:	c9                   	leave
+  802389:	c3                   	ret
+
+000000000080238a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80238a:	55                   	push   %rbp
+  80238b:	48 89 e5             	mov    %rsp,%rbp
+  80238e:	48 83 ec 20          	sub    $0x20,%rsp
+  802392:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802395:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802399:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80239c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80239f:	48 63 c8             	movslq %eax,%rcx
+  8023a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8023a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023a9:	48 98                	cltq
+  8023ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8023af:	6a 00                	push   $0x0
+  8023b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b7:	49 89 c8             	mov    %rcx,%r8
+  8023ba:	48 89 d1             	mov    %rdx,%rcx
+  8023bd:	48 89 c2             	mov    %rax,%rdx
+  8023c0:	be 01 00 00 00       	mov    $0x1,%esi
+  8023c5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8023ca:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8023d1:	00 00 00 
+  8023d4:	ff d0                	call   *%rax
+  8023d6:	48 83 c4 10          	add    $0x10,%rsp
+  8023da:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8023dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8023e0:	c9                   	leave
+  8023e1:	c3                   	ret
+
+00000000008023e2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8023e2:	55                   	push   %rbp
+  8023e3:	48 89 e5             	mov    %rsp,%rbp
+  8023e6:	48 83 ec 20          	sub    $0x20,%rsp
+  8023ea:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023ed:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023f1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8023f4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8023f8:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8023fc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8023ff:	48 63 c8             	movslq %eax,%rcx
+  802402:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802406:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802409:	48 63 f0             	movslq %eax,%rsi
+  80240c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802410:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802413:	48 98                	cltq
+  802415:	48 83 ec 08          	sub    $0x8,%rsp
+  802419:	51                   	push   %rcx
+  80241a:	49 89 f9             	mov    %rdi,%r9
+  80241d:	49 89 f0             	mov    %rsi,%r8
+  802420:	48 89 d1             	mov    %rdx,%rcx
+  802423:	48 89 c2             	mov    %rax,%rdx
+  802426:	be 01 00 00 00       	mov    $0x1,%esi
+  80242b:	bf 07 00 00 00       	mov    $0x7,%edi
+  802430:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+  80243c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802440:	c9                   	leave
+  802441:	c3                   	ret
+
+0000000000802442 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802442:	55                   	push   %rbp
+  802443:	48 89 e5             	mov    %rsp,%rbp
+  802446:	48 83 ec 10          	sub    $0x10,%rsp
+  80244a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80244d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802451:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802455:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802458:	48 98                	cltq
+  80245a:	48 83 ec 08          	sub    $0x8,%rsp
+  80245e:	6a 00                	push   $0x0
+  802460:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802466:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80246c:	48 89 d1             	mov    %rdx,%rcx
+  80246f:	48 89 c2             	mov    %rax,%rdx
+  802472:	be 01 00 00 00       	mov    $0x1,%esi
+  802477:	bf 08 00 00 00       	mov    $0x8,%edi
+  80247c:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+  802488:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80248c:	c9                   	leave
+  80248d:	c3                   	ret
+
+000000000080248e <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80248e:	55                   	push   %rbp
+  80248f:	48 89 e5             	mov    %rsp,%rbp
+  802492:	48 83 ec 10          	sub    $0x10,%rsp
+  802496:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802499:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80249c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80249f:	48 63 d0             	movslq %eax,%rdx
+  8024a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024a5:	48 98                	cltq
+  8024a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024ab:	6a 00                	push   $0x0
+  8024ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024b9:	48 89 d1             	mov    %rdx,%rcx
+  8024bc:	48 89 c2             	mov    %rax,%rdx
+  8024bf:	be 01 00 00 00       	mov    $0x1,%esi
+  8024c4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8024c9:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+  8024d5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024d9:	c9                   	leave
+  8024da:	c3                   	ret
+
+00000000008024db <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8024db:	55                   	push   %rbp
+  8024dc:	48 89 e5             	mov    %rsp,%rbp
+  8024df:	48 83 ec 10          	sub    $0x10,%rsp
+  8024e3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8024ea:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024f1:	48 98                	cltq
+  8024f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f7:	6a 00                	push   $0x0
+  8024f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802505:	48 89 d1             	mov    %rdx,%rcx
+  802508:	48 89 c2             	mov    %rax,%rdx
+  80250b:	be 01 00 00 00       	mov    $0x1,%esi
+  802510:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802515:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80251c:	00 00 00 
+  80251f:	ff d0                	call   *%rax
+  802521:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802525:	c9                   	leave
+  802526:	c3                   	ret
+
+0000000000802527 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802527:	55                   	push   %rbp
+  802528:	48 89 e5             	mov    %rsp,%rbp
+  80252b:	48 83 ec 10          	sub    $0x10,%rsp
+  80252f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802532:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802536:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80253a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80253d:	48 98                	cltq
+  80253f:	48 83 ec 08          	sub    $0x8,%rsp
+  802543:	6a 00                	push   $0x0
+  802545:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80254b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802551:	48 89 d1             	mov    %rdx,%rcx
+  802554:	48 89 c2             	mov    %rax,%rdx
+  802557:	be 01 00 00 00       	mov    $0x1,%esi
+  80255c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802561:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802568:	00 00 00 
+  80256b:	ff d0                	call   *%rax
+  80256d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802571:	c9                   	leave
+  802572:	c3                   	ret
+
+0000000000802573 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802573:	55                   	push   %rbp
+  802574:	48 89 e5             	mov    %rsp,%rbp
+  802577:	48 83 ec 20          	sub    $0x20,%rsp
+  80257b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80257e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802582:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802586:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802589:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80258c:	48 63 f0             	movslq %eax,%rsi
+  80258f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802593:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802597:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80259a:	48 98                	cltq
+  80259c:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a0:	6a 00                	push   $0x0
+  8025a2:	49 89 f1             	mov    %rsi,%r9
+  8025a5:	49 89 c8             	mov    %rcx,%r8
+  8025a8:	48 89 d1             	mov    %rdx,%rcx
+  8025ab:	48 89 c2             	mov    %rax,%rdx
+  8025ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b3:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8025b8:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8025bf:	00 00 00 
+  8025c2:	ff d0                	call   *%rax
+  8025c4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025c8:	c9                   	leave
+  8025c9:	c3                   	ret
+
+00000000008025ca <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8025ca:	55                   	push   %rbp
+  8025cb:	48 89 e5             	mov    %rsp,%rbp
+  8025ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8025d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8025d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025da:	48 83 ec 08          	sub    $0x8,%rsp
+  8025de:	6a 00                	push   $0x0
+  8025e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025f1:	48 89 c2             	mov    %rax,%rdx
+  8025f4:	be 01 00 00 00       	mov    $0x1,%esi
+  8025f9:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8025fe:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802605:	00 00 00 
+  802608:	ff d0                	call   *%rax
+  80260a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80260e:	c9                   	leave
+  80260f:	c3                   	ret
+
+0000000000802610 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802610:	55                   	push   %rbp
+  802611:	48 89 e5             	mov    %rsp,%rbp
+  802614:	48 83 ec 10          	sub    $0x10,%rsp
+  802618:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80261c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802620:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802624:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802628:	48 83 ec 08          	sub    $0x8,%rsp
+  80262c:	6a 00                	push   $0x0
+  80262e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802634:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80263a:	48 89 d1             	mov    %rdx,%rcx
+  80263d:	48 89 c2             	mov    %rax,%rdx
+  802640:	be 01 00 00 00       	mov    $0x1,%esi
+  802645:	bf 10 00 00 00       	mov    $0x10,%edi
+  80264a:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+  802656:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80265a:	c9                   	leave
+  80265b:	c3                   	ret
+
+000000000080265c <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80265c:	55                   	push   %rbp
+  80265d:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802660:	48 83 ec 08          	sub    $0x8,%rsp
+  802664:	6a 00                	push   $0x0
+  802666:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80266c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802672:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802677:	ba 00 00 00 00       	mov    $0x0,%edx
+  80267c:	be 00 00 00 00       	mov    $0x0,%esi
+  802681:	bf 11 00 00 00       	mov    $0x11,%edi
+  802686:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80268d:	00 00 00 
+  802690:	ff d0                	call   *%rax
+  802692:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802696:	c9                   	leave
+  802697:	c3                   	ret
+
+0000000000802698 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802698:	55                   	push   %rbp
+  802699:	48 89 e5             	mov    %rsp,%rbp
+  80269c:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026a4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8026a8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8026b4:	6a 00                	push   $0x0
+  8026b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026c2:	48 89 d1             	mov    %rdx,%rcx
+  8026c5:	48 89 c2             	mov    %rax,%rdx
+  8026c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cd:	bf 12 00 00 00       	mov    $0x12,%edi
+  8026d2:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8026d9:	00 00 00 
+  8026dc:	ff d0                	call   *%rax
+  8026de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026e2:	c9                   	leave
+  8026e3:	c3                   	ret
+
+00000000008026e4 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8026e4:	55                   	push   %rbp
+  8026e5:	48 89 e5             	mov    %rsp,%rbp
+  8026e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8026ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8026f4:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8026f7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8026fa:	48 63 c8             	movslq %eax,%rcx
+  8026fd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802701:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802705:	48 83 ec 08          	sub    $0x8,%rsp
+  802709:	6a 00                	push   $0x0
+  80270b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802711:	49 89 c8             	mov    %rcx,%r8
+  802714:	48 89 d1             	mov    %rdx,%rcx
+  802717:	48 89 c2             	mov    %rax,%rdx
+  80271a:	be 00 00 00 00       	mov    $0x0,%esi
+  80271f:	bf 13 00 00 00       	mov    $0x13,%edi
+  802724:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+  802730:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802734:	c9                   	leave
+  802735:	c3                   	ret
+
+0000000000802736 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802736:	55                   	push   %rbp
+  802737:	48 89 e5             	mov    %rsp,%rbp
+  80273a:	48 83 ec 20          	sub    $0x20,%rsp
+  80273e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802742:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802745:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802749:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80274d:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802750:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802754:	48 83 ec 08          	sub    $0x8,%rsp
+  802758:	6a 00                	push   $0x0
+  80275a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802760:	49 89 c8             	mov    %rcx,%r8
+  802763:	48 89 d1             	mov    %rdx,%rcx
+  802766:	48 89 c2             	mov    %rax,%rdx
+  802769:	be 00 00 00 00       	mov    $0x0,%esi
+  80276e:	bf 14 00 00 00       	mov    $0x14,%edi
+  802773:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80277a:	00 00 00 
+  80277d:	ff d0                	call   *%rax
+  80277f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802783:	c9                   	leave
+  802784:	c3                   	ret
+
+0000000000802785 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802785:	55                   	push   %rbp
+  802786:	48 89 e5             	mov    %rsp,%rbp
+  802789:	48 83 ec 10          	sub    $0x10,%rsp
+  80278d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802791:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802794:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802797:	48 63 d0             	movslq %eax,%rdx
+  80279a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80279e:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a2:	6a 00                	push   $0x0
+  8027a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027b0:	48 89 d1             	mov    %rdx,%rcx
+  8027b3:	48 89 c2             	mov    %rax,%rdx
+  8027b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027bb:	bf 15 00 00 00       	mov    $0x15,%edi
+  8027c0:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+  8027cc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027d0:	c9                   	leave
+  8027d1:	c3                   	ret
+
+00000000008027d2 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8027d2:	55                   	push   %rbp
+  8027d3:	48 89 e5             	mov    %rsp,%rbp
+  8027d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8027da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027de:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8027e1:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8027e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8027e8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8027ec:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8027ef:	48 63 c8             	movslq %eax,%rcx
+  8027f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8027f5:	48 63 d0             	movslq %eax,%rdx
+  8027f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802800:	6a 00                	push   $0x0
+  802802:	49 89 f1             	mov    %rsi,%r9
+  802805:	49 89 c8             	mov    %rcx,%r8
+  802808:	48 89 d1             	mov    %rdx,%rcx
+  80280b:	48 89 c2             	mov    %rax,%rdx
+  80280e:	be 00 00 00 00       	mov    $0x0,%esi
+  802813:	bf 16 00 00 00       	mov    $0x16,%edi
+  802818:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+  802824:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802828:	c9                   	leave
+  802829:	c3                   	ret
+
+000000000080282a <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80282a:	55                   	push   %rbp
+  80282b:	48 89 e5             	mov    %rsp,%rbp
+  80282e:	48 83 ec 30          	sub    $0x30,%rsp
+  802832:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802836:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80283a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80283e:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802842:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802846:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80284a:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80284e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802852:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802856:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80285a:	48 83 ec 08          	sub    $0x8,%rsp
+  80285e:	51                   	push   %rcx
+  80285f:	49 89 f9             	mov    %rdi,%r9
+  802862:	49 89 f0             	mov    %rsi,%r8
+  802865:	48 89 d1             	mov    %rdx,%rcx
+  802868:	48 89 c2             	mov    %rax,%rdx
+  80286b:	be 00 00 00 00       	mov    $0x0,%esi
+  802870:	bf 17 00 00 00       	mov    $0x17,%edi
+  802875:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+  802881:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802885:	c9                   	leave
+  802886:	c3                   	ret
+
+0000000000802887 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802887:	55                   	push   %rbp
+  802888:	48 89 e5             	mov    %rsp,%rbp
+  80288b:	48 83 ec 10          	sub    $0x10,%rsp
+  80288f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802892:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802895:	48 98                	cltq
+  802897:	48 83 ec 08          	sub    $0x8,%rsp
+  80289b:	6a 00                	push   $0x0
+  80289d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028ae:	48 89 c2             	mov    %rax,%rdx
+  8028b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8028b6:	bf 18 00 00 00       	mov    $0x18,%edi
+  8028bb:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8028c2:	00 00 00 
+  8028c5:	ff d0                	call   *%rax
+  8028c7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028cb:	90                   	nop
+  8028cc:	c9                   	leave
+  8028cd:	c3                   	ret
+
+00000000008028ce <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8028ce:	55                   	push   %rbp
+  8028cf:	48 89 e5             	mov    %rsp,%rbp
+  8028d2:	48 83 ec 30          	sub    $0x30,%rsp
+  8028d6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8028d9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8028dd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8028e1:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8028e4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8028e7:	48 63 f0             	movslq %eax,%rsi
+  8028ea:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8028ee:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8028f2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028f5:	48 98                	cltq
+  8028f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8028fb:	6a 00                	push   $0x0
+  8028fd:	49 89 f1             	mov    %rsi,%r9
+  802900:	49 89 c8             	mov    %rcx,%r8
+  802903:	48 89 d1             	mov    %rdx,%rcx
+  802906:	48 89 c2             	mov    %rax,%rdx
+  802909:	be 01 00 00 00       	mov    $0x1,%esi
+  80290e:	bf 19 00 00 00       	mov    $0x19,%edi
+  802913:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  80291a:	00 00 00 
+  80291d:	ff d0                	call   *%rax
+  80291f:	48 83 c4 10          	add    $0x10,%rsp
+  802923:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802926:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802929:	c9                   	leave
+  80292a:	c3                   	ret
+
+000000000080292b <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  80292b:	55                   	push   %rbp
+  80292c:	48 89 e5             	mov    %rsp,%rbp
+  80292f:	48 83 ec 20          	sub    $0x20,%rsp
+  802933:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802937:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80293b:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  80293e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802941:	48 63 c8             	movslq %eax,%rcx
+  802944:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802948:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80294c:	48 83 ec 08          	sub    $0x8,%rsp
+  802950:	6a 00                	push   $0x0
+  802952:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802958:	49 89 c8             	mov    %rcx,%r8
+  80295b:	48 89 d1             	mov    %rdx,%rcx
+  80295e:	48 89 c2             	mov    %rax,%rdx
+  802961:	be 01 00 00 00       	mov    $0x1,%esi
+  802966:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80296b:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802972:	00 00 00 
+  802975:	ff d0                	call   *%rax
+  802977:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80297b:	c9                   	leave
+  80297c:	c3                   	ret
+
+000000000080297d <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80297d:	55                   	push   %rbp
+  80297e:	48 89 e5             	mov    %rsp,%rbp
+  802981:	48 83 ec 20          	sub    $0x20,%rsp
+  802985:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802989:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80298d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802991:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802995:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802999:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80299d:	48 83 ec 08          	sub    $0x8,%rsp
+  8029a1:	6a 00                	push   $0x0
+  8029a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029a9:	49 89 c8             	mov    %rcx,%r8
+  8029ac:	48 89 d1             	mov    %rdx,%rcx
+  8029af:	48 89 c2             	mov    %rax,%rdx
+  8029b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8029b7:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8029bc:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  8029c3:	00 00 00 
+  8029c6:	ff d0                	call   *%rax
+  8029c8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029cc:	c9                   	leave
+  8029cd:	c3                   	ret
+
+00000000008029ce <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8029ce:	55                   	push   %rbp
+  8029cf:	48 89 e5             	mov    %rsp,%rbp
+  8029d2:	48 83 ec 30          	sub    $0x30,%rsp
+  8029d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8029da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029de:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8029e1:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8029e5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8029e9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8029ec:	48 63 c8             	movslq %eax,%rcx
+  8029ef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8029f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8029fb:	6a 00                	push   $0x0
+  8029fd:	49 89 f1             	mov    %rsi,%r9
+  802a00:	49 89 c8             	mov    %rcx,%r8
+  802a03:	48 89 d1             	mov    %rdx,%rcx
+  802a06:	48 89 c2             	mov    %rax,%rdx
+  802a09:	be 01 00 00 00       	mov    $0x1,%esi
+  802a0e:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802a13:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802a1a:	00 00 00 
+  802a1d:	ff d0                	call   *%rax
+  802a1f:	48 83 c4 10          	add    $0x10,%rsp
+  802a23:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802a26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a29:	c9                   	leave
+  802a2a:	c3                   	ret
+
+0000000000802a2b <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802a2b:	55                   	push   %rbp
+  802a2c:	48 89 e5             	mov    %rsp,%rbp
+  802a2f:	48 83 ec 10          	sub    $0x10,%rsp
+  802a33:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802a36:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a39:	48 98                	cltq
+  802a3b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a3f:	6a 00                	push   $0x0
+  802a41:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a4d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a52:	48 89 c2             	mov    %rax,%rdx
+  802a55:	be 01 00 00 00       	mov    $0x1,%esi
+  802a5a:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802a5f:	48 b8 da 20 80 00 00 	movabs $0x8020da,%rax
+  802a66:	00 00 00 
+  802a69:	ff d0                	call   *%rax
+  802a6b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a6f:	c9                   	leave
+  802a70:	c3                   	ret
+
+0000000000802a71 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802a71:	55                   	push   %rbp
+  802a72:	48 89 e5             	mov    %rsp,%rbp
+  802a75:	48 83 ec 40          	sub    $0x40,%rsp
+  802a79:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802a7d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a81:	48 8b 00             	mov    (%rax),%rax
+  802a84:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802a88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a8c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a90:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802a94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a98:	83 e0 02             	and    $0x2,%eax
+  802a9b:	48 85 c0             	test   %rax,%rax
+  802a9e:	74 25                	je     802ac5 <pgfault+0x54>
+  802aa0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802aa4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802aa8:	48 89 c2             	mov    %rax,%rdx
+  802aab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ab2:	01 00 00 
+  802ab5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ab9:	83 e0 02             	and    $0x2,%eax
+  802abc:	48 85 c0             	test   %rax,%rax
+  802abf:	0f 85 fe 01 00 00    	jne    802cc3 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802ac5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ac9:	83 e0 02             	and    $0x2,%eax
+  802acc:	48 85 c0             	test   %rax,%rax
+  802acf:	74 23                	je     802af4 <pgfault+0x83>
+  802ad1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ad5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ad9:	48 89 c2             	mov    %rax,%rdx
+  802adc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ae3:	01 00 00 
+  802ae6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802aea:	25 00 08 00 00       	and    $0x800,%eax
+  802aef:	48 85 c0             	test   %rax,%rax
+  802af2:	75 3f                	jne    802b33 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802af4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802af8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802afc:	49 89 d0             	mov    %rdx,%r8
+  802aff:	48 89 c1             	mov    %rax,%rcx
+  802b02:	48 b8 78 6c 80 00 00 	movabs $0x806c78,%rax
+  802b09:	00 00 00 
+  802b0c:	48 89 c2             	mov    %rax,%rdx
+  802b0f:	be 26 00 00 00       	mov    $0x26,%esi
+  802b14:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  802b1b:	00 00 00 
+  802b1e:	48 89 c7             	mov    %rax,%rdi
+  802b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b26:	49 b9 ed 03 80 00 00 	movabs $0x8003ed,%r9
+  802b2d:	00 00 00 
+  802b30:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802b33:	48 b8 87 56 80 00 00 	movabs $0x805687,%rax
+  802b3a:	00 00 00 
+  802b3d:	ff d0                	call   *%rax
+  802b3f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b47:	ba 07 00 00 00       	mov    $0x7,%edx
+  802b4c:	48 89 c6             	mov    %rax,%rsi
+  802b4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b54:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  802b5b:	00 00 00 
+  802b5e:	ff d0                	call   *%rax
+  802b60:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802b63:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802b67:	79 36                	jns    802b9f <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802b69:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802b6c:	89 c1                	mov    %eax,%ecx
+  802b6e:	48 b8 b8 6c 80 00 00 	movabs $0x806cb8,%rax
+  802b75:	00 00 00 
+  802b78:	48 89 c2             	mov    %rax,%rdx
+  802b7b:	be 35 00 00 00       	mov    $0x35,%esi
+  802b80:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  802b87:	00 00 00 
+  802b8a:	48 89 c7             	mov    %rax,%rdi
+  802b8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b92:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  802b99:	00 00 00 
+  802b9c:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802b9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ba3:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802ba7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bab:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802bb1:	48 89 c1             	mov    %rax,%rcx
+  802bb4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bb8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bbd:	48 89 ce             	mov    %rcx,%rsi
+  802bc0:	48 89 c7             	mov    %rax,%rdi
+  802bc3:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802bcf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bd3:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bd7:	48 89 c2             	mov    %rax,%rdx
+  802bda:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802be1:	01 00 00 
+  802be4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802be8:	25 00 08 00 00       	and    $0x800,%eax
+  802bed:	48 85 c0             	test   %rax,%rax
+  802bf0:	74 7a                	je     802c6c <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802bf2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bf6:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802bfa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802bfe:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c04:	48 89 c2             	mov    %rax,%rdx
+  802c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c0b:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c11:	48 89 d1             	mov    %rdx,%rcx
+  802c14:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c19:	48 89 c6             	mov    %rax,%rsi
+  802c1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c21:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802c30:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c34:	79 36                	jns    802c6c <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802c36:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c39:	89 c1                	mov    %eax,%ecx
+  802c3b:	48 b8 e0 6c 80 00 00 	movabs $0x806ce0,%rax
+  802c42:	00 00 00 
+  802c45:	48 89 c2             	mov    %rax,%rdx
+  802c48:	be 42 00 00 00       	mov    $0x42,%esi
+  802c4d:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  802c54:	00 00 00 
+  802c57:	48 89 c7             	mov    %rax,%rdi
+  802c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5f:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  802c66:	00 00 00 
+  802c69:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802c6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c70:	48 89 c6             	mov    %rax,%rsi
+  802c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c78:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  802c7f:	00 00 00 
+  802c82:	ff d0                	call   *%rax
+  802c84:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802c87:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c8b:	79 37                	jns    802cc4 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802c8d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c90:	89 c1                	mov    %eax,%ecx
+  802c92:	48 b8 08 6d 80 00 00 	movabs $0x806d08,%rax
+  802c99:	00 00 00 
+  802c9c:	48 89 c2             	mov    %rax,%rdx
+  802c9f:	be 46 00 00 00       	mov    $0x46,%esi
+  802ca4:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  802cab:	00 00 00 
+  802cae:	48 89 c7             	mov    %rax,%rdi
+  802cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb6:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  802cbd:	00 00 00 
+  802cc0:	41 ff d0             	call   *%r8
+    return;
+  802cc3:	90                   	nop
+  }
+}
+  802cc4:	c9                   	leave
+  802cc5:	c3                   	ret
+
+0000000000802cc6 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802cc6:	55                   	push   %rbp
+  802cc7:	48 89 e5             	mov    %rsp,%rbp
+  802cca:	48 83 ec 30          	sub    $0x30,%rsp
+  802cce:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802cd1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802cd5:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802cdc:	01 00 00 
+  802cdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ce3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ce7:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802cf0:	48 b8 11 23 80 00 00 	movabs $0x802311,%rax
+  802cf7:	00 00 00 
+  802cfa:	ff d0                	call   *%rax
+  802cfc:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802cff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d03:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d07:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802d0b:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d12:	01 00 00 
+  802d15:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d19:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d1d:	25 00 04 00 00       	and    $0x400,%eax
+  802d22:	48 85 c0             	test   %rax,%rax
+  802d25:	74 7b                	je     802da2 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802d27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d2b:	89 c1                	mov    %eax,%ecx
+  802d2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d31:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d35:	48 89 c2             	mov    %rax,%rdx
+  802d38:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d3c:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d40:	48 89 c6             	mov    %rax,%rsi
+  802d43:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802d46:	41 89 c8             	mov    %ecx,%r8d
+  802d49:	48 89 d1             	mov    %rdx,%rcx
+  802d4c:	89 c2                	mov    %eax,%edx
+  802d4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d53:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  802d5a:	00 00 00 
+  802d5d:	ff d0                	call   *%rax
+  802d5f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d62:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d66:	0f 89 da 00 00 00    	jns    802e46 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802d6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d6f:	89 c1                	mov    %eax,%ecx
+  802d71:	48 b8 30 6d 80 00 00 	movabs $0x806d30,%rax
+  802d78:	00 00 00 
+  802d7b:	48 89 c2             	mov    %rax,%rdx
+  802d7e:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802d83:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  802d8a:	00 00 00 
+  802d8d:	48 89 c7             	mov    %rax,%rdi
+  802d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d95:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  802d9c:	00 00 00 
+  802d9f:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802da2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802da6:	25 02 08 00 00       	and    $0x802,%eax
+  802dab:	48 85 c0             	test   %rax,%rax
+  802dae:	74 6e                	je     802e1e <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802db0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802db4:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802dba:	80 cc 08             	or     $0x8,%ah
+  802dbd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802dc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dc5:	89 c7                	mov    %eax,%edi
+  802dc7:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802dcb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802dce:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802dd2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802dd5:	41 89 f8             	mov    %edi,%r8d
+  802dd8:	89 c7                	mov    %eax,%edi
+  802dda:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  802de1:	00 00 00 
+  802de4:	ff d0                	call   *%rax
+  802de6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802de9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802ded:	79 05                	jns    802df4 <duppage+0x12e>
+      return r;
+  802def:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802df2:	eb 55                	jmp    802e49 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802df4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802df8:	89 c7                	mov    %eax,%edi
+  802dfa:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802dfe:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e01:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e05:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e08:	41 89 f8             	mov    %edi,%r8d
+  802e0b:	89 c7                	mov    %eax,%edi
+  802e0d:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  802e14:	00 00 00 
+  802e17:	ff d0                	call   *%rax
+  802e19:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e1c:	eb 28                	jmp    802e46 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802e1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e22:	89 c7                	mov    %eax,%edi
+  802e24:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e28:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e2b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e2f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e32:	41 89 f8             	mov    %edi,%r8d
+  802e35:	89 c7                	mov    %eax,%edi
+  802e37:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+  802e43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802e46:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802e49:	c9                   	leave
+  802e4a:	c3                   	ret
+
+0000000000802e4b <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802e4b:	55                   	push   %rbp
+  802e4c:	48 89 e5             	mov    %rsp,%rbp
+  802e4f:	48 83 ec 20          	sub    $0x20,%rsp
+  802e53:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e56:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802e5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e5e:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e62:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802e66:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802e6d:	01 00 00 
+  802e70:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e74:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e78:	25 00 08 00 00       	and    $0x800,%eax
+  802e7d:	48 85 c0             	test   %rax,%rax
+  802e80:	74 0d                	je     802e8f <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802e82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e86:	0f b6 10             	movzbl (%rax),%edx
+  802e89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e8d:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802e8f:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802e96:	01 00 00 
+  802e99:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e9d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ea1:	25 07 0e 00 00       	and    $0xe07,%eax
+  802ea6:	89 c6                	mov    %eax,%esi
+  802ea8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802eac:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802eaf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802eb3:	41 89 f0             	mov    %esi,%r8d
+  802eb6:	48 89 c6             	mov    %rax,%rsi
+  802eb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ebe:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  802ec5:	00 00 00 
+  802ec8:	ff d0                	call   *%rax
+}
+  802eca:	c9                   	leave
+  802ecb:	c3                   	ret
+
+0000000000802ecc <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802ecc:	55                   	push   %rbp
+  802ecd:	48 89 e5             	mov    %rsp,%rbp
+  802ed0:	48 83 ec 40          	sub    $0x40,%rsp
+  802ed4:	89 f8                	mov    %edi,%eax
+  802ed6:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802ed9:	48 b8 71 2a 80 00 00 	movabs $0x802a71,%rax
+  802ee0:	00 00 00 
+  802ee3:	48 89 c7             	mov    %rax,%rdi
+  802ee6:	48 b8 39 5b 80 00 00 	movabs $0x805b39,%rax
+  802eed:	00 00 00 
+  802ef0:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802ef2:	b8 09 00 00 00       	mov    $0x9,%eax
+  802ef7:	cd 30                	int    $0x30
+  802ef9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802efc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802eff:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f02:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f06:	79 36                	jns    802f3e <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802f08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f0b:	89 c1                	mov    %eax,%ecx
+  802f0d:	48 b8 5b 6d 80 00 00 	movabs $0x806d5b,%rax
+  802f14:	00 00 00 
+  802f17:	48 89 c2             	mov    %rax,%rdx
+  802f1a:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802f1f:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  802f26:	00 00 00 
+  802f29:	48 89 c7             	mov    %rax,%rdi
+  802f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f31:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  802f38:	00 00 00 
+  802f3b:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802f3e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f42:	75 0a                	jne    802f4e <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802f44:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f49:	e9 d3 02 00 00       	jmp    803221 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802f4e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802f55:	00 
+  802f56:	e9 7a 01 00 00       	jmp    8030d5 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802f5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f5f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f63:	48 c1 e8 27          	shr    $0x27,%rax
+  802f67:	48 89 c2             	mov    %rax,%rdx
+  802f6a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802f71:	01 00 00 
+  802f74:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f78:	83 e0 01             	and    $0x1,%eax
+  802f7b:	48 85 c0             	test   %rax,%rax
+  802f7e:	0f 84 4c 01 00 00    	je     8030d0 <fork_common+0x204>
+  802f84:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f88:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f8c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f90:	48 89 c2             	mov    %rax,%rdx
+  802f93:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f9a:	01 00 00 
+  802f9d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fa1:	83 e0 01             	and    $0x1,%eax
+  802fa4:	48 85 c0             	test   %rax,%rax
+  802fa7:	0f 84 23 01 00 00    	je     8030d0 <fork_common+0x204>
+  802fad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fb1:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fb5:	48 c1 e8 15          	shr    $0x15,%rax
+  802fb9:	48 89 c2             	mov    %rax,%rdx
+  802fbc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802fc3:	01 00 00 
+  802fc6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fca:	83 e0 01             	and    $0x1,%eax
+  802fcd:	48 85 c0             	test   %rax,%rax
+  802fd0:	0f 84 fa 00 00 00    	je     8030d0 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802fd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fda:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fde:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802fe2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fe6:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802fed:	00 00 00 
+  802ff0:	48 39 c2             	cmp    %rax,%rdx
+  802ff3:	0f 82 d7 00 00 00    	jb     8030d0 <fork_common+0x204>
+  802ff9:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  803000:	00 00 00 
+  803003:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  803007:	0f 84 c3 00 00 00    	je     8030d0 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  80300d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803011:	48 89 c7             	mov    %rax,%rdi
+  803014:	48 b8 43 56 80 00 00 	movabs $0x805643,%rax
+  80301b:	00 00 00 
+  80301e:	ff d0                	call   *%rax
+  803020:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803023:	84 c0                	test   %al,%al
+  803025:	0f 84 a5 00 00 00    	je     8030d0 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  80302b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80302f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803033:	48 89 c2             	mov    %rax,%rdx
+  803036:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80303d:	01 00 00 
+  803040:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803044:	83 e0 01             	and    $0x1,%eax
+  803047:	48 85 c0             	test   %rax,%rax
+  80304a:	0f 84 80 00 00 00    	je     8030d0 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  803050:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  803054:	74 4a                	je     8030a0 <fork_common+0x1d4>
+  803056:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80305a:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  803061:	00 00 00 
+  803064:	48 39 c2             	cmp    %rax,%rdx
+  803067:	73 13                	jae    80307c <fork_common+0x1b0>
+  803069:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80306d:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  803074:	00 00 00 
+  803077:	48 39 c2             	cmp    %rax,%rdx
+  80307a:	73 24                	jae    8030a0 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  80307c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803080:	48 c1 e8 0c          	shr    $0xc,%rax
+  803084:	48 89 c2             	mov    %rax,%rdx
+  803087:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80308a:	48 89 d6             	mov    %rdx,%rsi
+  80308d:	89 c7                	mov    %eax,%edi
+  80308f:	48 b8 4b 2e 80 00 00 	movabs $0x802e4b,%rax
+  803096:	00 00 00 
+  803099:	ff d0                	call   *%rax
+  80309b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80309e:	eb 22                	jmp    8030c2 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  8030a0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030a4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030a8:	48 89 c2             	mov    %rax,%rdx
+  8030ab:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030ae:	48 89 d6             	mov    %rdx,%rsi
+  8030b1:	89 c7                	mov    %eax,%edi
+  8030b3:	48 b8 c6 2c 80 00 00 	movabs $0x802cc6,%rax
+  8030ba:	00 00 00 
+  8030bd:	ff d0                	call   *%rax
+  8030bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  8030c2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030c6:	79 08                	jns    8030d0 <fork_common+0x204>
+            return r;
+  8030c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030cb:	e9 51 01 00 00       	jmp    803221 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  8030d0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8030d5:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  8030dc:	07 
+  8030dd:	0f 86 78 fe ff ff    	jbe    802f5b <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  8030e3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8030ea:	00 00 00 
+  8030ed:	8b 40 04             	mov    0x4(%rax),%eax
+  8030f0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8030f5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8030fc:	00 00 00 
+  8030ff:	48 98                	cltq
+  803101:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803108:	48 01 d0             	add    %rdx,%rax
+  80310b:	48 05 00 01 00 00    	add    $0x100,%rax
+  803111:	48 8b 10             	mov    (%rax),%rdx
+  803114:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803117:	48 89 d6             	mov    %rdx,%rsi
+  80311a:	89 c7                	mov    %eax,%edi
+  80311c:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  803123:	00 00 00 
+  803126:	ff d0                	call   *%rax
+  803128:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80312b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80312f:	79 36                	jns    803167 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  803131:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803134:	89 c1                	mov    %eax,%ecx
+  803136:	48 b8 70 6d 80 00 00 	movabs $0x806d70,%rax
+  80313d:	00 00 00 
+  803140:	48 89 c2             	mov    %rax,%rdx
+  803143:	be be 00 00 00       	mov    $0xbe,%esi
+  803148:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  80314f:	00 00 00 
+  803152:	48 89 c7             	mov    %rax,%rdi
+  803155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315a:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  803161:	00 00 00 
+  803164:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  803167:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80316a:	ba 02 00 00 00       	mov    $0x2,%edx
+  80316f:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  803176:	00 00 00 
+  803179:	48 89 ce             	mov    %rcx,%rsi
+  80317c:	89 c7                	mov    %eax,%edi
+  80317e:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  803185:	00 00 00 
+  803188:	ff d0                	call   *%rax
+  80318a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80318d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803191:	79 36                	jns    8031c9 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803193:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803196:	89 c1                	mov    %eax,%ecx
+  803198:	48 b8 a0 6d 80 00 00 	movabs $0x806da0,%rax
+  80319f:	00 00 00 
+  8031a2:	48 89 c2             	mov    %rax,%rdx
+  8031a5:	be c1 00 00 00       	mov    $0xc1,%esi
+  8031aa:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  8031b1:	00 00 00 
+  8031b4:	48 89 c7             	mov    %rax,%rdi
+  8031b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031bc:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  8031c3:	00 00 00 
+  8031c6:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  8031c9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031cc:	be 02 00 00 00       	mov    $0x2,%esi
+  8031d1:	89 c7                	mov    %eax,%edi
+  8031d3:	48 b8 8e 24 80 00 00 	movabs $0x80248e,%rax
+  8031da:	00 00 00 
+  8031dd:	ff d0                	call   *%rax
+  8031df:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031e2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031e6:	79 36                	jns    80321e <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  8031e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031eb:	89 c1                	mov    %eax,%ecx
+  8031ed:	48 b8 c0 6d 80 00 00 	movabs $0x806dc0,%rax
+  8031f4:	00 00 00 
+  8031f7:	48 89 c2             	mov    %rax,%rdx
+  8031fa:	be d4 00 00 00       	mov    $0xd4,%esi
+  8031ff:	48 b8 a6 6c 80 00 00 	movabs $0x806ca6,%rax
+  803206:	00 00 00 
+  803209:	48 89 c7             	mov    %rax,%rdi
+  80320c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803211:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  803218:	00 00 00 
+  80321b:	41 ff d0             	call   *%r8
+    }
+    return e;
+  80321e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803221:	c9                   	leave
+  803222:	c3                   	ret
+
+0000000000803223 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803223:	55                   	push   %rbp
+  803224:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  803227:	bf 00 00 00 00       	mov    $0x0,%edi
+  80322c:	48 b8 cc 2e 80 00 00 	movabs $0x802ecc,%rax
+  803233:	00 00 00 
+  803236:	ff d0                	call   *%rax
+}
+  803238:	5d                   	pop    %rbp
+  803239:	c3                   	ret
+
+000000000080323a <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  80323a:	55                   	push   %rbp
+  80323b:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  80323e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803243:	48 b8 cc 2e 80 00 00 	movabs $0x802ecc,%rax
+  80324a:	00 00 00 
+  80324d:	ff d0                	call   *%rax
+}
+  80324f:	5d                   	pop    %rbp
+  803250:	c3                   	ret
+
+0000000000803251 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803251:	55                   	push   %rbp
+  803252:	48 89 e5             	mov    %rsp,%rbp
+  803255:	48 83 ec 08          	sub    $0x8,%rsp
+  803259:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80325d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803261:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803268:	ff ff ff 
+  80326b:	48 01 d0             	add    %rdx,%rax
+  80326e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803272:	c9                   	leave
+  803273:	c3                   	ret
+
+0000000000803274 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803274:	55                   	push   %rbp
+  803275:	48 89 e5             	mov    %rsp,%rbp
+  803278:	48 83 ec 08          	sub    $0x8,%rsp
+  80327c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  803280:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803284:	48 89 c7             	mov    %rax,%rdi
+  803287:	48 b8 51 32 80 00 00 	movabs $0x803251,%rax
+  80328e:	00 00 00 
+  803291:	ff d0                	call   *%rax
+  803293:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803299:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80329d:	c9                   	leave
+  80329e:	c3                   	ret
+
+000000000080329f <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80329f:	55                   	push   %rbp
+  8032a0:	48 89 e5             	mov    %rsp,%rbp
+  8032a3:	48 83 ec 18          	sub    $0x18,%rsp
+  8032a7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8032ab:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032b2:	e9 ae 00 00 00       	jmp    803365 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8032b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032ba:	c1 e0 0c             	shl    $0xc,%eax
+  8032bd:	48 98                	cltq
+  8032bf:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8032c4:	48 01 d0             	add    %rdx,%rax
+  8032c7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8032cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032cf:	48 c1 e8 27          	shr    $0x27,%rax
+  8032d3:	48 89 c2             	mov    %rax,%rdx
+  8032d6:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8032dd:	01 00 00 
+  8032e0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032e4:	83 e0 01             	and    $0x1,%eax
+  8032e7:	48 85 c0             	test   %rax,%rax
+  8032ea:	74 63                	je     80334f <fd_alloc+0xb0>
+  8032ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032f0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8032f4:	48 89 c2             	mov    %rax,%rdx
+  8032f7:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8032fe:	01 00 00 
+  803301:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803305:	83 e0 01             	and    $0x1,%eax
+  803308:	48 85 c0             	test   %rax,%rax
+  80330b:	74 42                	je     80334f <fd_alloc+0xb0>
+  80330d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803311:	48 c1 e8 15          	shr    $0x15,%rax
+  803315:	48 89 c2             	mov    %rax,%rdx
+  803318:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80331f:	01 00 00 
+  803322:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803326:	83 e0 01             	and    $0x1,%eax
+  803329:	48 85 c0             	test   %rax,%rax
+  80332c:	74 21                	je     80334f <fd_alloc+0xb0>
+  80332e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803332:	48 c1 e8 0c          	shr    $0xc,%rax
+  803336:	48 89 c2             	mov    %rax,%rdx
+  803339:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803340:	01 00 00 
+  803343:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803347:	83 e0 01             	and    $0x1,%eax
+  80334a:	48 85 c0             	test   %rax,%rax
+  80334d:	75 12                	jne    803361 <fd_alloc+0xc2>
+      *fd_store = fd;
+  80334f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803353:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803357:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80335a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80335f:	eb 1e                	jmp    80337f <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803361:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803365:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803369:	0f 8e 48 ff ff ff    	jle    8032b7 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80336f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803373:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80337a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80337f:	c9                   	leave
+  803380:	c3                   	ret
+
+0000000000803381 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803381:	55                   	push   %rbp
+  803382:	48 89 e5             	mov    %rsp,%rbp
+  803385:	48 83 ec 20          	sub    $0x20,%rsp
+  803389:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80338c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803390:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803394:	78 06                	js     80339c <fd_lookup+0x1b>
+  803396:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80339a:	7e 0a                	jle    8033a6 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80339c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033a1:	e9 af 00 00 00       	jmp    803455 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8033a6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033a9:	c1 e0 0c             	shl    $0xc,%eax
+  8033ac:	48 98                	cltq
+  8033ae:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8033b3:	48 01 d0             	add    %rdx,%rax
+  8033b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8033ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033be:	48 c1 e8 27          	shr    $0x27,%rax
+  8033c2:	48 89 c2             	mov    %rax,%rdx
+  8033c5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8033cc:	01 00 00 
+  8033cf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033d3:	83 e0 01             	and    $0x1,%eax
+  8033d6:	48 85 c0             	test   %rax,%rax
+  8033d9:	74 63                	je     80343e <fd_lookup+0xbd>
+  8033db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033df:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8033e3:	48 89 c2             	mov    %rax,%rdx
+  8033e6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8033ed:	01 00 00 
+  8033f0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033f4:	83 e0 01             	and    $0x1,%eax
+  8033f7:	48 85 c0             	test   %rax,%rax
+  8033fa:	74 42                	je     80343e <fd_lookup+0xbd>
+  8033fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803400:	48 c1 e8 15          	shr    $0x15,%rax
+  803404:	48 89 c2             	mov    %rax,%rdx
+  803407:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80340e:	01 00 00 
+  803411:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803415:	83 e0 01             	and    $0x1,%eax
+  803418:	48 85 c0             	test   %rax,%rax
+  80341b:	74 21                	je     80343e <fd_lookup+0xbd>
+  80341d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803421:	48 c1 e8 0c          	shr    $0xc,%rax
+  803425:	48 89 c2             	mov    %rax,%rdx
+  803428:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80342f:	01 00 00 
+  803432:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803436:	83 e0 01             	and    $0x1,%eax
+  803439:	48 85 c0             	test   %rax,%rax
+  80343c:	75 07                	jne    803445 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80343e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803443:	eb 10                	jmp    803455 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803445:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803449:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80344d:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803450:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803455:	c9                   	leave
+  803456:	c3                   	ret
+
+0000000000803457 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803457:	55                   	push   %rbp
+  803458:	48 89 e5             	mov    %rsp,%rbp
+  80345b:	48 83 ec 30          	sub    $0x30,%rsp
+  80345f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803463:	89 f0                	mov    %esi,%eax
+  803465:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803468:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80346c:	48 89 c7             	mov    %rax,%rdi
+  80346f:	48 b8 51 32 80 00 00 	movabs $0x803251,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+  80347b:	89 c2                	mov    %eax,%edx
+  80347d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803481:	48 89 c6             	mov    %rax,%rsi
+  803484:	89 d7                	mov    %edx,%edi
+  803486:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  80348d:	00 00 00 
+  803490:	ff d0                	call   *%rax
+  803492:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803495:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803499:	78 0a                	js     8034a5 <fd_close+0x4e>
+  80349b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80349f:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8034a3:	74 12                	je     8034b7 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8034a5:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8034a9:	74 05                	je     8034b0 <fd_close+0x59>
+  8034ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034ae:	eb 70                	jmp    803520 <fd_close+0xc9>
+  8034b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b5:	eb 69                	jmp    803520 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8034b7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034bb:	8b 00                	mov    (%rax),%eax
+  8034bd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8034c1:	48 89 d6             	mov    %rdx,%rsi
+  8034c4:	89 c7                	mov    %eax,%edi
+  8034c6:	48 b8 22 35 80 00 00 	movabs $0x803522,%rax
+  8034cd:	00 00 00 
+  8034d0:	ff d0                	call   *%rax
+  8034d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034d5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034d9:	78 2a                	js     803505 <fd_close+0xae>
+    if (dev->dev_close)
+  8034db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034df:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8034e3:	48 85 c0             	test   %rax,%rax
+  8034e6:	74 16                	je     8034fe <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8034e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034ec:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034f4:	48 89 c7             	mov    %rax,%rdi
+  8034f7:	ff d2                	call   *%rdx
+  8034f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034fc:	eb 07                	jmp    803505 <fd_close+0xae>
+    else
+      r = 0;
+  8034fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803505:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803509:	48 89 c6             	mov    %rax,%rsi
+  80350c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803511:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  803518:	00 00 00 
+  80351b:	ff d0                	call   *%rax
+  return r;
+  80351d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803520:	c9                   	leave
+  803521:	c3                   	ret
+
+0000000000803522 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803522:	55                   	push   %rbp
+  803523:	48 89 e5             	mov    %rsp,%rbp
+  803526:	48 83 ec 20          	sub    $0x20,%rsp
+  80352a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80352d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803531:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803538:	eb 3f                	jmp    803579 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  80353a:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803541:	00 00 00 
+  803544:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803547:	48 98                	cltq
+  803549:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80354d:	8b 00                	mov    (%rax),%eax
+  80354f:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803552:	75 21                	jne    803575 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803554:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80355b:	00 00 00 
+  80355e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803561:	48 98                	cltq
+  803563:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803567:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80356b:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80356e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803573:	eb 7f                	jmp    8035f4 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803575:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803579:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803580:	00 00 00 
+  803583:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803586:	48 98                	cltq
+  803588:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80358c:	48 85 c0             	test   %rax,%rax
+  80358f:	75 a9                	jne    80353a <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803591:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803598:	00 00 00 
+  80359b:	8b 40 04             	mov    0x4(%rax),%eax
+  80359e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8035a3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8035aa:	00 00 00 
+  8035ad:	48 98                	cltq
+  8035af:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8035b6:	48 01 d0             	add    %rdx,%rax
+  8035b9:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8035bf:	8b 00                	mov    (%rax),%eax
+  8035c1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8035c4:	89 c6                	mov    %eax,%esi
+  8035c6:	48 b8 e8 6d 80 00 00 	movabs $0x806de8,%rax
+  8035cd:	00 00 00 
+  8035d0:	48 89 c7             	mov    %rax,%rdi
+  8035d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d8:	48 b9 0c 06 80 00 00 	movabs $0x80060c,%rcx
+  8035df:	00 00 00 
+  8035e2:	ff d1                	call   *%rcx
+  *dev = 0;
+  8035e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035e8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8035ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8035f4:	c9                   	leave
+  8035f5:	c3                   	ret
+
+00000000008035f6 <close>:
+
+int
+close(int fdnum) {
+  8035f6:	55                   	push   %rbp
+  8035f7:	48 89 e5             	mov    %rsp,%rbp
+  8035fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8035fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803601:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803605:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803608:	48 89 d6             	mov    %rdx,%rsi
+  80360b:	89 c7                	mov    %eax,%edi
+  80360d:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  803614:	00 00 00 
+  803617:	ff d0                	call   *%rax
+  803619:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80361c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803620:	79 05                	jns    803627 <close+0x31>
+    return r;
+  803622:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803625:	eb 18                	jmp    80363f <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803627:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80362b:	be 01 00 00 00       	mov    $0x1,%esi
+  803630:	48 89 c7             	mov    %rax,%rdi
+  803633:	48 b8 57 34 80 00 00 	movabs $0x803457,%rax
+  80363a:	00 00 00 
+  80363d:	ff d0                	call   *%rax
+}
+  80363f:	c9                   	leave
+  803640:	c3                   	ret
+
+0000000000803641 <close_all>:
+
+void
+close_all(void) {
+  803641:	55                   	push   %rbp
+  803642:	48 89 e5             	mov    %rsp,%rbp
+  803645:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803649:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803650:	eb 15                	jmp    803667 <close_all+0x26>
+    close(i);
+  803652:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803655:	89 c7                	mov    %eax,%edi
+  803657:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  80365e:	00 00 00 
+  803661:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803663:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803667:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80366b:	7e e5                	jle    803652 <close_all+0x11>
+}
+  80366d:	90                   	nop
+  80366e:	90                   	nop
+  80366f:	c9                   	leave
+  803670:	c3                   	ret
+
+0000000000803671 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803671:	55                   	push   %rbp
+  803672:	48 89 e5             	mov    %rsp,%rbp
+  803675:	48 83 ec 40          	sub    $0x40,%rsp
+  803679:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80367c:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80367f:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803683:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803686:	48 89 d6             	mov    %rdx,%rsi
+  803689:	89 c7                	mov    %eax,%edi
+  80368b:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  803692:	00 00 00 
+  803695:	ff d0                	call   *%rax
+  803697:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80369a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80369e:	79 08                	jns    8036a8 <dup+0x37>
+    return r;
+  8036a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036a3:	e9 33 02 00 00       	jmp    8038db <dup+0x26a>
+  close(newfdnum);
+  8036a8:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8036ab:	89 c7                	mov    %eax,%edi
+  8036ad:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  8036b4:	00 00 00 
+  8036b7:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  8036b9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8036bc:	c1 e0 0c             	shl    $0xc,%eax
+  8036bf:	48 98                	cltq
+  8036c1:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8036c6:	48 01 d0             	add    %rdx,%rax
+  8036c9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8036cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8036d1:	48 89 c7             	mov    %rax,%rdi
+  8036d4:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  8036db:	00 00 00 
+  8036de:	ff d0                	call   *%rax
+  8036e0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8036e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8036e8:	48 89 c7             	mov    %rax,%rdi
+  8036eb:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  8036f2:	00 00 00 
+  8036f5:	ff d0                	call   *%rax
+  8036f7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8036fb:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803702:	00 
+  803703:	e9 19 01 00 00       	jmp    803821 <dup+0x1b0>
+    off -= PGSIZE;
+  803708:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  80370f:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803710:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803714:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803718:	48 01 d0             	add    %rdx,%rax
+  80371b:	48 c1 e8 27          	shr    $0x27,%rax
+  80371f:	48 89 c2             	mov    %rax,%rdx
+  803722:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803729:	01 00 00 
+  80372c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803730:	83 e0 01             	and    $0x1,%eax
+  803733:	48 85 c0             	test   %rax,%rax
+  803736:	0f 84 e5 00 00 00    	je     803821 <dup+0x1b0>
+  80373c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803740:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803744:	48 01 d0             	add    %rdx,%rax
+  803747:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80374b:	48 89 c2             	mov    %rax,%rdx
+  80374e:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803755:	01 00 00 
+  803758:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80375c:	83 e0 01             	and    $0x1,%eax
+  80375f:	48 85 c0             	test   %rax,%rax
+  803762:	0f 84 b9 00 00 00    	je     803821 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803768:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80376c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803770:	48 01 d0             	add    %rdx,%rax
+  803773:	48 c1 e8 15          	shr    $0x15,%rax
+  803777:	48 89 c2             	mov    %rax,%rdx
+  80377a:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803781:	01 00 00 
+  803784:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803788:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80378b:	48 85 c0             	test   %rax,%rax
+  80378e:	0f 84 8d 00 00 00    	je     803821 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803794:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803798:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80379c:	48 01 d0             	add    %rdx,%rax
+  80379f:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037a3:	48 89 c2             	mov    %rax,%rdx
+  8037a6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037ad:	01 00 00 
+  8037b0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037b4:	83 e0 01             	and    $0x1,%eax
+  8037b7:	48 85 c0             	test   %rax,%rax
+  8037ba:	74 65                	je     803821 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8037bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037c4:	48 01 d0             	add    %rdx,%rax
+  8037c7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037cb:	48 89 c2             	mov    %rax,%rdx
+  8037ce:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037d5:	01 00 00 
+  8037d8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8037e1:	89 c6                	mov    %eax,%esi
+  8037e3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8037e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037eb:	48 01 c2             	add    %rax,%rdx
+  8037ee:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8037f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037f6:	48 01 c8             	add    %rcx,%rax
+  8037f9:	41 89 f0             	mov    %esi,%r8d
+  8037fc:	48 89 d1             	mov    %rdx,%rcx
+  8037ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  803804:	48 89 c6             	mov    %rax,%rsi
+  803807:	bf 00 00 00 00       	mov    $0x0,%edi
+  80380c:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  803813:	00 00 00 
+  803816:	ff d0                	call   *%rax
+  803818:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80381b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80381f:	78 60                	js     803881 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803821:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803826:	0f 85 dc fe ff ff    	jne    803708 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80382c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803830:	48 c1 e8 0c          	shr    $0xc,%rax
+  803834:	48 89 c2             	mov    %rax,%rdx
+  803837:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80383e:	01 00 00 
+  803841:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803845:	25 07 0e 00 00       	and    $0xe07,%eax
+  80384a:	89 c1                	mov    %eax,%ecx
+  80384c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803850:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803854:	41 89 c8             	mov    %ecx,%r8d
+  803857:	48 89 d1             	mov    %rdx,%rcx
+  80385a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80385f:	48 89 c6             	mov    %rax,%rsi
+  803862:	bf 00 00 00 00       	mov    $0x0,%edi
+  803867:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  80386e:	00 00 00 
+  803871:	ff d0                	call   *%rax
+  803873:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803876:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80387a:	78 08                	js     803884 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80387c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80387f:	eb 5a                	jmp    8038db <dup+0x26a>
+        goto err;
+  803881:	90                   	nop
+  803882:	eb 01                	jmp    803885 <dup+0x214>
+    goto err;
+  803884:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803889:	48 89 c6             	mov    %rax,%rsi
+  80388c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803891:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  803898:	00 00 00 
+  80389b:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80389d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8038a4:	00 
+  8038a5:	eb 27                	jmp    8038ce <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  8038a7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8038ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038af:	48 01 d0             	add    %rdx,%rax
+  8038b2:	48 89 c6             	mov    %rax,%rsi
+  8038b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ba:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  8038c1:	00 00 00 
+  8038c4:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8038c6:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8038cd:	00 
+  8038ce:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8038d5:	00 
+  8038d6:	76 cf                	jbe    8038a7 <dup+0x236>
+  return r;
+  8038d8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8038db:	c9                   	leave
+  8038dc:	c3                   	ret
+
+00000000008038dd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8038dd:	55                   	push   %rbp
+  8038de:	48 89 e5             	mov    %rsp,%rbp
+  8038e1:	48 83 ec 40          	sub    $0x40,%rsp
+  8038e5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8038e8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8038ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8038f0:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8038f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038f7:	48 89 d6             	mov    %rdx,%rsi
+  8038fa:	89 c7                	mov    %eax,%edi
+  8038fc:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  803903:	00 00 00 
+  803906:	ff d0                	call   *%rax
+  803908:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80390b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80390f:	78 24                	js     803935 <read+0x58>
+  803911:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803915:	8b 00                	mov    (%rax),%eax
+  803917:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80391b:	48 89 d6             	mov    %rdx,%rsi
+  80391e:	89 c7                	mov    %eax,%edi
+  803920:	48 b8 22 35 80 00 00 	movabs $0x803522,%rax
+  803927:	00 00 00 
+  80392a:	ff d0                	call   *%rax
+  80392c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80392f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803933:	79 0a                	jns    80393f <read+0x62>
+    return r;
+  803935:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803938:	48 98                	cltq
+  80393a:	e9 9e 00 00 00       	jmp    8039dd <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80393f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803943:	8b 40 08             	mov    0x8(%rax),%eax
+  803946:	83 e0 03             	and    $0x3,%eax
+  803949:	83 f8 01             	cmp    $0x1,%eax
+  80394c:	75 5c                	jne    8039aa <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80394e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803955:	00 00 00 
+  803958:	8b 40 04             	mov    0x4(%rax),%eax
+  80395b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803960:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803967:	00 00 00 
+  80396a:	48 98                	cltq
+  80396c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803973:	48 01 d0             	add    %rdx,%rax
+  803976:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80397c:	8b 00                	mov    (%rax),%eax
+  80397e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803981:	89 c6                	mov    %eax,%esi
+  803983:	48 b8 07 6e 80 00 00 	movabs $0x806e07,%rax
+  80398a:	00 00 00 
+  80398d:	48 89 c7             	mov    %rax,%rdi
+  803990:	b8 00 00 00 00       	mov    $0x0,%eax
+  803995:	48 b9 0c 06 80 00 00 	movabs $0x80060c,%rcx
+  80399c:	00 00 00 
+  80399f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8039a1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8039a8:	eb 33                	jmp    8039dd <read+0x100>
+  }
+  if (!dev->dev_read)
+  8039aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039ae:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8039b2:	48 85 c0             	test   %rax,%rax
+  8039b5:	75 09                	jne    8039c0 <read+0xe3>
+    return -E_NOT_SUPP;
+  8039b7:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8039be:	eb 1d                	jmp    8039dd <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8039c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039c4:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8039c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039cc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8039d0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8039d4:	48 89 ce             	mov    %rcx,%rsi
+  8039d7:	48 89 c7             	mov    %rax,%rdi
+  8039da:	41 ff d0             	call   *%r8
+}
+  8039dd:	c9                   	leave
+  8039de:	c3                   	ret
+
+00000000008039df <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8039df:	55                   	push   %rbp
+  8039e0:	48 89 e5             	mov    %rsp,%rbp
+  8039e3:	48 83 ec 30          	sub    $0x30,%rsp
+  8039e7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8039ea:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8039ee:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8039f2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8039f9:	eb 49                	jmp    803a44 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8039fb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039fe:	48 98                	cltq
+  803a00:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a04:	48 29 c2             	sub    %rax,%rdx
+  803a07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a0a:	48 63 c8             	movslq %eax,%rcx
+  803a0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a11:	48 01 c1             	add    %rax,%rcx
+  803a14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a17:	48 89 ce             	mov    %rcx,%rsi
+  803a1a:	89 c7                	mov    %eax,%edi
+  803a1c:	48 b8 dd 38 80 00 00 	movabs $0x8038dd,%rax
+  803a23:	00 00 00 
+  803a26:	ff d0                	call   *%rax
+  803a28:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803a2b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803a2f:	79 07                	jns    803a38 <readn+0x59>
+      return m;
+  803a31:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803a34:	48 98                	cltq
+  803a36:	eb 1f                	jmp    803a57 <readn+0x78>
+    if (m == 0)
+  803a38:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803a3c:	74 13                	je     803a51 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803a3e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803a41:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803a44:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a47:	48 98                	cltq
+  803a49:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803a4d:	72 ac                	jb     8039fb <readn+0x1c>
+  803a4f:	eb 01                	jmp    803a52 <readn+0x73>
+      break;
+  803a51:	90                   	nop
+  }
+  return tot;
+  803a52:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a55:	48 98                	cltq
+}
+  803a57:	c9                   	leave
+  803a58:	c3                   	ret
+
+0000000000803a59 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803a59:	55                   	push   %rbp
+  803a5a:	48 89 e5             	mov    %rsp,%rbp
+  803a5d:	48 83 ec 40          	sub    $0x40,%rsp
+  803a61:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803a64:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803a68:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803a6c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803a70:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a73:	48 89 d6             	mov    %rdx,%rsi
+  803a76:	89 c7                	mov    %eax,%edi
+  803a78:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  803a7f:	00 00 00 
+  803a82:	ff d0                	call   *%rax
+  803a84:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a87:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a8b:	78 24                	js     803ab1 <write+0x58>
+  803a8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a91:	8b 00                	mov    (%rax),%eax
+  803a93:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803a97:	48 89 d6             	mov    %rdx,%rsi
+  803a9a:	89 c7                	mov    %eax,%edi
+  803a9c:	48 b8 22 35 80 00 00 	movabs $0x803522,%rax
+  803aa3:	00 00 00 
+  803aa6:	ff d0                	call   *%rax
+  803aa8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803aab:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803aaf:	79 0a                	jns    803abb <write+0x62>
+    return r;
+  803ab1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ab4:	48 98                	cltq
+  803ab6:	e9 9d 00 00 00       	jmp    803b58 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803abf:	8b 40 08             	mov    0x8(%rax),%eax
+  803ac2:	83 e0 03             	and    $0x3,%eax
+  803ac5:	85 c0                	test   %eax,%eax
+  803ac7:	75 5c                	jne    803b25 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803ac9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803ad0:	00 00 00 
+  803ad3:	8b 40 04             	mov    0x4(%rax),%eax
+  803ad6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803adb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803ae2:	00 00 00 
+  803ae5:	48 98                	cltq
+  803ae7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803aee:	48 01 d0             	add    %rdx,%rax
+  803af1:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803af7:	8b 00                	mov    (%rax),%eax
+  803af9:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803afc:	89 c6                	mov    %eax,%esi
+  803afe:	48 b8 23 6e 80 00 00 	movabs $0x806e23,%rax
+  803b05:	00 00 00 
+  803b08:	48 89 c7             	mov    %rax,%rdi
+  803b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b10:	48 b9 0c 06 80 00 00 	movabs $0x80060c,%rcx
+  803b17:	00 00 00 
+  803b1a:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803b1c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803b23:	eb 33                	jmp    803b58 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803b25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b29:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803b2d:	48 85 c0             	test   %rax,%rax
+  803b30:	75 09                	jne    803b3b <write+0xe2>
+    return -E_NOT_SUPP;
+  803b32:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803b39:	eb 1d                	jmp    803b58 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803b3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b3f:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b47:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803b4b:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803b4f:	48 89 ce             	mov    %rcx,%rsi
+  803b52:	48 89 c7             	mov    %rax,%rdi
+  803b55:	41 ff d0             	call   *%r8
+}
+  803b58:	c9                   	leave
+  803b59:	c3                   	ret
+
+0000000000803b5a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803b5a:	55                   	push   %rbp
+  803b5b:	48 89 e5             	mov    %rsp,%rbp
+  803b5e:	48 83 ec 18          	sub    $0x18,%rsp
+  803b62:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b65:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803b68:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b6c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803b6f:	48 89 d6             	mov    %rdx,%rsi
+  803b72:	89 c7                	mov    %eax,%edi
+  803b74:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  803b7b:	00 00 00 
+  803b7e:	ff d0                	call   *%rax
+  803b80:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b83:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b87:	79 05                	jns    803b8e <seek+0x34>
+    return r;
+  803b89:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b8c:	eb 0f                	jmp    803b9d <seek+0x43>
+  fd->fd_offset = offset;
+  803b8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b92:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803b95:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803b98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b9d:	c9                   	leave
+  803b9e:	c3                   	ret
+
+0000000000803b9f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803b9f:	55                   	push   %rbp
+  803ba0:	48 89 e5             	mov    %rsp,%rbp
+  803ba3:	48 83 ec 30          	sub    $0x30,%rsp
+  803ba7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803baa:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803bad:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803bb1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803bb4:	48 89 d6             	mov    %rdx,%rsi
+  803bb7:	89 c7                	mov    %eax,%edi
+  803bb9:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  803bc0:	00 00 00 
+  803bc3:	ff d0                	call   *%rax
+  803bc5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bc8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bcc:	78 24                	js     803bf2 <ftruncate+0x53>
+  803bce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bd2:	8b 00                	mov    (%rax),%eax
+  803bd4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803bd8:	48 89 d6             	mov    %rdx,%rsi
+  803bdb:	89 c7                	mov    %eax,%edi
+  803bdd:	48 b8 22 35 80 00 00 	movabs $0x803522,%rax
+  803be4:	00 00 00 
+  803be7:	ff d0                	call   *%rax
+  803be9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bf0:	79 08                	jns    803bfa <ftruncate+0x5b>
+    return r;
+  803bf2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bf5:	e9 92 00 00 00       	jmp    803c8c <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bfe:	8b 40 08             	mov    0x8(%rax),%eax
+  803c01:	83 e0 03             	and    $0x3,%eax
+  803c04:	85 c0                	test   %eax,%eax
+  803c06:	75 5a                	jne    803c62 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803c08:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803c0f:	00 00 00 
+  803c12:	8b 40 04             	mov    0x4(%rax),%eax
+  803c15:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c1a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803c21:	00 00 00 
+  803c24:	48 98                	cltq
+  803c26:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803c2d:	48 01 d0             	add    %rdx,%rax
+  803c30:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803c36:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803c38:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803c3b:	89 c6                	mov    %eax,%esi
+  803c3d:	48 b8 40 6e 80 00 00 	movabs $0x806e40,%rax
+  803c44:	00 00 00 
+  803c47:	48 89 c7             	mov    %rax,%rdi
+  803c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c4f:	48 b9 0c 06 80 00 00 	movabs $0x80060c,%rcx
+  803c56:	00 00 00 
+  803c59:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803c5b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803c60:	eb 2a                	jmp    803c8c <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803c62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c66:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803c6a:	48 85 c0             	test   %rax,%rax
+  803c6d:	75 07                	jne    803c76 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803c6f:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803c74:	eb 16                	jmp    803c8c <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803c76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c7a:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803c7e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c82:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803c85:	89 d6                	mov    %edx,%esi
+  803c87:	48 89 c7             	mov    %rax,%rdi
+  803c8a:	ff d1                	call   *%rcx
+}
+  803c8c:	c9                   	leave
+  803c8d:	c3                   	ret
+
+0000000000803c8e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803c8e:	55                   	push   %rbp
+  803c8f:	48 89 e5             	mov    %rsp,%rbp
+  803c92:	48 83 ec 30          	sub    $0x30,%rsp
+  803c96:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c99:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c9d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ca1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ca4:	48 89 d6             	mov    %rdx,%rsi
+  803ca7:	89 c7                	mov    %eax,%edi
+  803ca9:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  803cb0:	00 00 00 
+  803cb3:	ff d0                	call   *%rax
+  803cb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cb8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cbc:	78 24                	js     803ce2 <fstat+0x54>
+  803cbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cc2:	8b 00                	mov    (%rax),%eax
+  803cc4:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803cc8:	48 89 d6             	mov    %rdx,%rsi
+  803ccb:	89 c7                	mov    %eax,%edi
+  803ccd:	48 b8 22 35 80 00 00 	movabs $0x803522,%rax
+  803cd4:	00 00 00 
+  803cd7:	ff d0                	call   *%rax
+  803cd9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cdc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ce0:	79 05                	jns    803ce7 <fstat+0x59>
+    return r;
+  803ce2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ce5:	eb 5e                	jmp    803d45 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803ce7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ceb:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803cef:	48 85 c0             	test   %rax,%rax
+  803cf2:	75 07                	jne    803cfb <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803cf4:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803cf9:	eb 4a                	jmp    803d45 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803cfb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cff:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803d02:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d06:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803d0d:	00 00 00 
+  stat->st_isdir   = 0;
+  803d10:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d14:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803d1b:	00 00 00 
+  stat->st_dev     = dev;
+  803d1e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d26:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803d2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d31:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803d35:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d39:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d3d:	48 89 d6             	mov    %rdx,%rsi
+  803d40:	48 89 c7             	mov    %rax,%rdi
+  803d43:	ff d1                	call   *%rcx
+}
+  803d45:	c9                   	leave
+  803d46:	c3                   	ret
+
+0000000000803d47 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803d47:	55                   	push   %rbp
+  803d48:	48 89 e5             	mov    %rsp,%rbp
+  803d4b:	48 83 ec 10          	sub    $0x10,%rsp
+  803d4f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803d53:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803d57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d5b:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803d61:	83 f8 20             	cmp    $0x20,%eax
+  803d64:	75 07                	jne    803d6d <pollwait_key+0x26>
+    return -E_INVAL;
+  803d66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d6b:	eb 5f                	jmp    803dcc <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803d6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d71:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803d77:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d7b:	48 63 d2             	movslq %edx,%rdx
+  803d7e:	48 c1 e2 04          	shl    $0x4,%rdx
+  803d82:	48 01 c2             	add    %rax,%rdx
+  803d85:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d89:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803d8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d90:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803d96:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d9a:	8b 00                	mov    (%rax),%eax
+  803d9c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803da0:	48 63 c9             	movslq %ecx,%rcx
+  803da3:	48 c1 e1 04          	shl    $0x4,%rcx
+  803da7:	48 01 ca             	add    %rcx,%rdx
+  803daa:	48 83 c2 08          	add    $0x8,%rdx
+  803dae:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803db0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803db4:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803dba:	8d 50 01             	lea    0x1(%rax),%edx
+  803dbd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dc1:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803dc7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803dcc:	c9                   	leave
+  803dcd:	c3                   	ret
+
+0000000000803dce <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803dce:	55                   	push   %rbp
+  803dcf:	48 89 e5             	mov    %rsp,%rbp
+  803dd2:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803dd9:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803de0:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803de6:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803ded:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803df4:	00 
+  int i, r, ready, ipc = 0;
+  803df5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803dfc:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803e03:	00 
+  803e04:	74 45                	je     803e4b <poll+0x7d>
+  803e06:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803e0d:	ff 
+  803e0e:	74 3b                	je     803e4b <poll+0x7d>
+    now      = vsys_clock_ns();
+  803e10:	48 b8 48 57 80 00 00 	movabs $0x805748,%rax
+  803e17:	00 00 00 
+  803e1a:	ff d0                	call   *%rax
+  803e1c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803e20:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e24:	48 f7 d0             	not    %rax
+  803e27:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803e2e:	73 10                	jae    803e40 <poll+0x72>
+  803e30:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803e34:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803e3b:	48 01 d0             	add    %rdx,%rax
+  803e3e:	eb 07                	jmp    803e47 <poll+0x79>
+  803e40:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803e47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803e4b:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803e52:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803e59:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803e60:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803e67:	e9 46 02 00 00       	jmp    8040b2 <poll+0x2e4>
+      fds[i].revents = 0;
+  803e6c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e6f:	48 63 d0             	movslq %eax,%rdx
+  803e72:	48 89 d0             	mov    %rdx,%rax
+  803e75:	48 01 c0             	add    %rax,%rax
+  803e78:	48 01 d0             	add    %rdx,%rax
+  803e7b:	48 c1 e0 02          	shl    $0x2,%rax
+  803e7f:	48 89 c2             	mov    %rax,%rdx
+  803e82:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e89:	48 01 d0             	add    %rdx,%rax
+  803e8c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803e93:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e96:	48 63 d0             	movslq %eax,%rdx
+  803e99:	48 89 d0             	mov    %rdx,%rax
+  803e9c:	48 01 c0             	add    %rax,%rax
+  803e9f:	48 01 d0             	add    %rdx,%rax
+  803ea2:	48 c1 e0 02          	shl    $0x2,%rax
+  803ea6:	48 89 c2             	mov    %rax,%rdx
+  803ea9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803eb0:	48 01 d0             	add    %rdx,%rax
+  803eb3:	8b 00                	mov    (%rax),%eax
+  803eb5:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803eb8:	75 62                	jne    803f1c <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803eba:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ebd:	48 63 d0             	movslq %eax,%rdx
+  803ec0:	48 89 d0             	mov    %rdx,%rax
+  803ec3:	48 01 c0             	add    %rax,%rax
+  803ec6:	48 01 d0             	add    %rdx,%rax
+  803ec9:	48 c1 e0 02          	shl    $0x2,%rax
+  803ecd:	48 89 c2             	mov    %rax,%rdx
+  803ed0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ed7:	48 01 d0             	add    %rdx,%rax
+  803eda:	8b 40 04             	mov    0x4(%rax),%eax
+  803edd:	83 e0 01             	and    $0x1,%eax
+  803ee0:	85 c0                	test   %eax,%eax
+  803ee2:	0f 84 9b 01 00 00    	je     804083 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803ee8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803eeb:	48 63 d0             	movslq %eax,%rdx
+  803eee:	48 89 d0             	mov    %rdx,%rax
+  803ef1:	48 01 c0             	add    %rax,%rax
+  803ef4:	48 01 d0             	add    %rdx,%rax
+  803ef7:	48 c1 e0 02          	shl    $0x2,%rax
+  803efb:	48 89 c2             	mov    %rax,%rdx
+  803efe:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f05:	48 01 c2             	add    %rax,%rdx
+  803f08:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f0b:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803f0e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803f11:	83 c8 04             	or     $0x4,%eax
+  803f14:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803f17:	e9 67 01 00 00       	jmp    804083 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803f1c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f1f:	48 63 d0             	movslq %eax,%rdx
+  803f22:	48 89 d0             	mov    %rdx,%rax
+  803f25:	48 01 c0             	add    %rax,%rax
+  803f28:	48 01 d0             	add    %rdx,%rax
+  803f2b:	48 c1 e0 02          	shl    $0x2,%rax
+  803f2f:	48 89 c2             	mov    %rax,%rdx
+  803f32:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f39:	48 01 d0             	add    %rdx,%rax
+  803f3c:	8b 00                	mov    (%rax),%eax
+  803f3e:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803f45:	48 89 d6             	mov    %rdx,%rsi
+  803f48:	89 c7                	mov    %eax,%edi
+  803f4a:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  803f51:	00 00 00 
+  803f54:	ff d0                	call   *%rax
+  803f56:	85 c0                	test   %eax,%eax
+  803f58:	78 25                	js     803f7f <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803f5a:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803f61:	8b 00                	mov    (%rax),%eax
+  803f63:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803f6a:	48 89 d6             	mov    %rdx,%rsi
+  803f6d:	89 c7                	mov    %eax,%edi
+  803f6f:	48 b8 22 35 80 00 00 	movabs $0x803522,%rax
+  803f76:	00 00 00 
+  803f79:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803f7b:	85 c0                	test   %eax,%eax
+  803f7d:	79 2c                	jns    803fab <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803f7f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f82:	48 63 d0             	movslq %eax,%rdx
+  803f85:	48 89 d0             	mov    %rdx,%rax
+  803f88:	48 01 c0             	add    %rax,%rax
+  803f8b:	48 01 d0             	add    %rdx,%rax
+  803f8e:	48 c1 e0 02          	shl    $0x2,%rax
+  803f92:	48 89 c2             	mov    %rax,%rdx
+  803f95:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f9c:	48 01 d0             	add    %rdx,%rax
+  803f9f:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803fa6:	e9 d8 00 00 00       	jmp    804083 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803fab:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803fb2:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803fb6:	48 85 c0             	test   %rax,%rax
+  803fb9:	74 7d                	je     804038 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803fbb:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803fc2:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803fc6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fc9:	48 63 d0             	movslq %eax,%rdx
+  803fcc:	48 89 d0             	mov    %rdx,%rax
+  803fcf:	48 01 c0             	add    %rax,%rax
+  803fd2:	48 01 d0             	add    %rdx,%rax
+  803fd5:	48 c1 e0 02          	shl    $0x2,%rax
+  803fd9:	48 89 c2             	mov    %rax,%rdx
+  803fdc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fe3:	48 01 d0             	add    %rdx,%rax
+  803fe6:	8b 48 04             	mov    0x4(%rax),%ecx
+  803fe9:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803ff0:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803ff7:	89 ce                	mov    %ecx,%esi
+  803ff9:	48 89 c7             	mov    %rax,%rdi
+  803ffc:	41 ff d0             	call   *%r8
+  803fff:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  804002:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804006:	79 08                	jns    804010 <poll+0x242>
+          return r;
+  804008:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80400b:	e9 45 01 00 00       	jmp    804155 <poll+0x387>
+        fds[i].revents = r;
+  804010:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804013:	48 63 d0             	movslq %eax,%rdx
+  804016:	48 89 d0             	mov    %rdx,%rax
+  804019:	48 01 c0             	add    %rax,%rax
+  80401c:	48 01 d0             	add    %rdx,%rax
+  80401f:	48 c1 e0 02          	shl    $0x2,%rax
+  804023:	48 89 c2             	mov    %rax,%rdx
+  804026:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80402d:	48 01 c2             	add    %rax,%rdx
+  804030:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804033:	89 42 08             	mov    %eax,0x8(%rdx)
+  804036:	eb 4b                	jmp    804083 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  804038:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80403b:	48 63 d0             	movslq %eax,%rdx
+  80403e:	48 89 d0             	mov    %rdx,%rax
+  804041:	48 01 c0             	add    %rax,%rax
+  804044:	48 01 d0             	add    %rdx,%rax
+  804047:	48 c1 e0 02          	shl    $0x2,%rax
+  80404b:	48 89 c2             	mov    %rax,%rdx
+  80404e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804055:	48 01 d0             	add    %rdx,%rax
+  804058:	8b 48 04             	mov    0x4(%rax),%ecx
+  80405b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80405e:	48 63 d0             	movslq %eax,%rdx
+  804061:	48 89 d0             	mov    %rdx,%rax
+  804064:	48 01 c0             	add    %rax,%rax
+  804067:	48 01 d0             	add    %rdx,%rax
+  80406a:	48 c1 e0 02          	shl    $0x2,%rax
+  80406e:	48 89 c2             	mov    %rax,%rdx
+  804071:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804078:	48 01 d0             	add    %rdx,%rax
+  80407b:	83 e1 03             	and    $0x3,%ecx
+  80407e:	89 ca                	mov    %ecx,%edx
+  804080:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804083:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804086:	48 63 d0             	movslq %eax,%rdx
+  804089:	48 89 d0             	mov    %rdx,%rax
+  80408c:	48 01 c0             	add    %rax,%rax
+  80408f:	48 01 d0             	add    %rdx,%rax
+  804092:	48 c1 e0 02          	shl    $0x2,%rax
+  804096:	48 89 c2             	mov    %rax,%rdx
+  804099:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040a0:	48 01 d0             	add    %rdx,%rax
+  8040a3:	8b 40 08             	mov    0x8(%rax),%eax
+  8040a6:	85 c0                	test   %eax,%eax
+  8040a8:	74 04                	je     8040ae <poll+0x2e0>
+        ready++;
+  8040aa:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8040ae:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8040b2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040b5:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8040bb:	0f 8c ab fd ff ff    	jl     803e6c <poll+0x9e>
+    }
+    if (ready)
+  8040c1:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8040c5:	74 08                	je     8040cf <poll+0x301>
+      return ready;
+  8040c7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8040ca:	e9 86 00 00 00       	jmp    804155 <poll+0x387>
+
+    if (deadline) {
+  8040cf:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8040d4:	74 30                	je     804106 <poll+0x338>
+      now     = vsys_clock_ns();
+  8040d6:	48 b8 48 57 80 00 00 	movabs $0x805748,%rax
+  8040dd:	00 00 00 
+  8040e0:	ff d0                	call   *%rax
+  8040e2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8040e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8040ea:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8040ee:	73 0a                	jae    8040fa <poll+0x32c>
+  8040f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040f4:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8040f8:	eb 05                	jmp    8040ff <poll+0x331>
+  8040fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ff:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  804106:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804109:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  80410c:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804113:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80411a:	48 89 c7             	mov    %rax,%rdi
+  80411d:	48 b8 d2 27 80 00 00 	movabs $0x8027d2,%rax
+  804124:	00 00 00 
+  804127:	ff d0                	call   *%rax
+  804129:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80412c:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  804130:	75 07                	jne    804139 <poll+0x36b>
+      return 0;
+  804132:	b8 00 00 00 00       	mov    $0x0,%eax
+  804137:	eb 1c                	jmp    804155 <poll+0x387>
+    if (r < 0)
+  804139:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80413d:	79 05                	jns    804144 <poll+0x376>
+      return r;
+  80413f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804142:	eb 11                	jmp    804155 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804144:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804147:	c1 f8 02             	sar    $0x2,%eax
+  80414a:	83 e0 01             	and    $0x1,%eax
+  80414d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  804150:	e9 f6 fc ff ff       	jmp    803e4b <poll+0x7d>
+  }
+}
+  804155:	c9                   	leave
+  804156:	c3                   	ret
+
+0000000000804157 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804157:	55                   	push   %rbp
+  804158:	48 89 e5             	mov    %rsp,%rbp
+  80415b:	48 83 ec 20          	sub    $0x20,%rsp
+  80415f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804163:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  804167:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80416b:	be 00 00 00 00       	mov    $0x0,%esi
+  804170:	48 89 c7             	mov    %rax,%rdi
+  804173:	48 b8 45 42 80 00 00 	movabs $0x804245,%rax
+  80417a:	00 00 00 
+  80417d:	ff d0                	call   *%rax
+  80417f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804182:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804186:	79 05                	jns    80418d <stat+0x36>
+    return fd;
+  804188:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80418b:	eb 2f                	jmp    8041bc <stat+0x65>
+  r = fstat(fd, stat);
+  80418d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804191:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804194:	48 89 d6             	mov    %rdx,%rsi
+  804197:	89 c7                	mov    %eax,%edi
+  804199:	48 b8 8e 3c 80 00 00 	movabs $0x803c8e,%rax
+  8041a0:	00 00 00 
+  8041a3:	ff d0                	call   *%rax
+  8041a5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8041a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041ab:	89 c7                	mov    %eax,%edi
+  8041ad:	48 b8 f6 35 80 00 00 	movabs $0x8035f6,%rax
+  8041b4:	00 00 00 
+  8041b7:	ff d0                	call   *%rax
+  return r;
+  8041b9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8041bc:	c9                   	leave
+  8041bd:	c3                   	ret
+
+00000000008041be <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8041be:	55                   	push   %rbp
+  8041bf:	48 89 e5             	mov    %rsp,%rbp
+  8041c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8041c6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8041c9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8041cd:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8041d4:	00 00 00 
+  8041d7:	8b 00                	mov    (%rax),%eax
+  8041d9:	85 c0                	test   %eax,%eax
+  8041db:	75 1d                	jne    8041fa <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8041dd:	bf 03 00 00 00       	mov    $0x3,%edi
+  8041e2:	48 b8 c9 5e 80 00 00 	movabs $0x805ec9,%rax
+  8041e9:	00 00 00 
+  8041ec:	ff d0                	call   *%rax
+  8041ee:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8041f5:	00 00 00 
+  8041f8:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8041fa:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804201:	00 00 00 
+  804204:	8b 00                	mov    (%rax),%eax
+  804206:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  804209:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80420e:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804215:	00 00 00 
+  804218:	89 c7                	mov    %eax,%edi
+  80421a:	48 b8 1c 5e 80 00 00 	movabs $0x805e1c,%rax
+  804221:	00 00 00 
+  804224:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  804226:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80422a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80422f:	48 89 c6             	mov    %rax,%rsi
+  804232:	bf 00 00 00 00       	mov    $0x0,%edi
+  804237:	48 b8 9f 5c 80 00 00 	movabs $0x805c9f,%rax
+  80423e:	00 00 00 
+  804241:	ff d0                	call   *%rax
+}
+  804243:	c9                   	leave
+  804244:	c3                   	ret
+
+0000000000804245 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  804245:	55                   	push   %rbp
+  804246:	48 89 e5             	mov    %rsp,%rbp
+  804249:	48 83 ec 20          	sub    $0x20,%rsp
+  80424d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804251:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804254:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804258:	48 89 c7             	mov    %rax,%rdi
+  80425b:	48 b8 bb 14 80 00 00 	movabs $0x8014bb,%rax
+  804262:	00 00 00 
+  804265:	ff d0                	call   *%rax
+  804267:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80426c:	7e 0a                	jle    804278 <open+0x33>
+    return -E_BAD_PATH;
+  80426e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804273:	e9 a8 00 00 00       	jmp    804320 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804278:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80427c:	48 89 c7             	mov    %rax,%rdi
+  80427f:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  804286:	00 00 00 
+  804289:	ff d0                	call   *%rax
+  80428b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80428e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804292:	79 08                	jns    80429c <open+0x57>
+    return r;
+  804294:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804297:	e9 84 00 00 00       	jmp    804320 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80429c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042a0:	48 89 c6             	mov    %rax,%rsi
+  8042a3:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8042aa:	00 00 00 
+  8042ad:	48 89 c7             	mov    %rax,%rdi
+  8042b0:	48 b8 bc 15 80 00 00 	movabs $0x8015bc,%rax
+  8042b7:	00 00 00 
+  8042ba:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8042bc:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8042c3:	00 00 00 
+  8042c6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8042c9:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8042cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042d3:	48 89 c6             	mov    %rax,%rsi
+  8042d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8042db:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  8042e2:	00 00 00 
+  8042e5:	ff d0                	call   *%rax
+  8042e7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042ea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042ee:	79 1d                	jns    80430d <open+0xc8>
+    fd_close(fd, 0);
+  8042f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8042f9:	48 89 c7             	mov    %rax,%rdi
+  8042fc:	48 b8 57 34 80 00 00 	movabs $0x803457,%rax
+  804303:	00 00 00 
+  804306:	ff d0                	call   *%rax
+    return r;
+  804308:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80430b:	eb 13                	jmp    804320 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  80430d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804311:	48 89 c7             	mov    %rax,%rdi
+  804314:	48 b8 51 32 80 00 00 	movabs $0x803251,%rax
+  80431b:	00 00 00 
+  80431e:	ff d0                	call   *%rax
+}
+  804320:	c9                   	leave
+  804321:	c3                   	ret
+
+0000000000804322 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804322:	55                   	push   %rbp
+  804323:	48 89 e5             	mov    %rsp,%rbp
+  804326:	48 83 ec 10          	sub    $0x10,%rsp
+  80432a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80432e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804332:	8b 40 0c             	mov    0xc(%rax),%eax
+  804335:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80433c:	00 00 00 
+  80433f:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804341:	be 00 00 00 00       	mov    $0x0,%esi
+  804346:	bf 06 00 00 00       	mov    $0x6,%edi
+  80434b:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  804352:	00 00 00 
+  804355:	ff d0                	call   *%rax
+}
+  804357:	c9                   	leave
+  804358:	c3                   	ret
+
+0000000000804359 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804359:	55                   	push   %rbp
+  80435a:	48 89 e5             	mov    %rsp,%rbp
+  80435d:	48 83 ec 30          	sub    $0x30,%rsp
+  804361:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804365:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804369:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80436d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804372:	74 07                	je     80437b <devfile_read+0x22>
+  804374:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804379:	75 0a                	jne    804385 <devfile_read+0x2c>
+  return E_INVAL;
+  80437b:	b8 03 00 00 00       	mov    $0x3,%eax
+  804380:	e9 b4 00 00 00       	jmp    804439 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804385:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80438c:	00 
+  while (n) {
+  80438d:	e9 98 00 00 00       	jmp    80442a <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804392:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804396:	8b 40 0c             	mov    0xc(%rax),%eax
+  804399:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8043a0:	00 00 00 
+  8043a3:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8043a5:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8043ac:	00 00 00 
+  8043af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043b3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8043b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8043bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8043c1:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  8043c8:	00 00 00 
+  8043cb:	ff d0                	call   *%rax
+  8043cd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8043d0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8043d4:	7f 13                	jg     8043e9 <devfile_read+0x90>
+      return res ? res : res0;
+  8043d6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8043da:	74 07                	je     8043e3 <devfile_read+0x8a>
+  8043dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043df:	48 98                	cltq
+  8043e1:	eb 56                	jmp    804439 <devfile_read+0xe0>
+  8043e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043e7:	eb 50                	jmp    804439 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8043e9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043ec:	48 63 d0             	movslq %eax,%rdx
+  8043ef:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043f3:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8043fa:	00 00 00 
+  8043fd:	48 89 ce             	mov    %rcx,%rsi
+  804400:	48 89 c7             	mov    %rax,%rdi
+  804403:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  80440a:	00 00 00 
+  80440d:	ff d0                	call   *%rax
+
+    buf += res;
+  80440f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804412:	48 98                	cltq
+  804414:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804418:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80441b:	48 98                	cltq
+  80441d:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804421:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804424:	48 98                	cltq
+  804426:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80442a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80442f:	0f 85 5d ff ff ff    	jne    804392 <devfile_read+0x39>
+  }
+
+  return res0;
+  804435:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804439:	c9                   	leave
+  80443a:	c3                   	ret
+
+000000000080443b <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80443b:	55                   	push   %rbp
+  80443c:	48 89 e5             	mov    %rsp,%rbp
+  80443f:	48 83 ec 50          	sub    $0x50,%rsp
+  804443:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804447:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80444b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80444f:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804454:	74 07                	je     80445d <devfile_write+0x22>
+  804456:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80445b:	75 0a                	jne    804467 <devfile_write+0x2c>
+  return E_INVAL;
+  80445d:	b8 03 00 00 00       	mov    $0x3,%eax
+  804462:	e9 c9 00 00 00       	jmp    804530 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804467:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80446e:	00 
+
+  while (n) {
+  80446f:	e9 ad 00 00 00       	jmp    804521 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804474:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804478:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80447c:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804483:	00 
+  804484:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804488:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80448c:	48 39 c2             	cmp    %rax,%rdx
+  80448f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804493:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804497:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80449b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80449f:	48 89 c6             	mov    %rax,%rsi
+  8044a2:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8044a9:	00 00 00 
+  8044ac:	48 89 c7             	mov    %rax,%rdi
+  8044af:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  8044b6:	00 00 00 
+  8044b9:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8044bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044bf:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044c2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8044c9:	00 00 00 
+  8044cc:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8044ce:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8044d5:	00 00 00 
+  8044d8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044dc:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8044e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8044e5:	bf 04 00 00 00       	mov    $0x4,%edi
+  8044ea:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  8044f1:	00 00 00 
+  8044f4:	ff d0                	call   *%rax
+  8044f6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8044f9:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8044fd:	79 07                	jns    804506 <devfile_write+0xcb>
+      return res;
+  8044ff:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804502:	48 98                	cltq
+  804504:	eb 2a                	jmp    804530 <devfile_write+0xf5>
+
+    buf += res;
+  804506:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804509:	48 98                	cltq
+  80450b:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  80450f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804512:	48 98                	cltq
+  804514:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804518:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80451b:	48 98                	cltq
+  80451d:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804521:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804526:	0f 85 48 ff ff ff    	jne    804474 <devfile_write+0x39>
+  }
+
+  return res0;
+  80452c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804530:	c9                   	leave
+  804531:	c3                   	ret
+
+0000000000804532 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804532:	55                   	push   %rbp
+  804533:	48 89 e5             	mov    %rsp,%rbp
+  804536:	48 83 ec 20          	sub    $0x20,%rsp
+  80453a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80453e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804542:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804546:	8b 40 0c             	mov    0xc(%rax),%eax
+  804549:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804550:	00 00 00 
+  804553:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804555:	be 00 00 00 00       	mov    $0x0,%esi
+  80455a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80455f:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  804566:	00 00 00 
+  804569:	ff d0                	call   *%rax
+  80456b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80456e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804572:	79 05                	jns    804579 <devfile_stat+0x47>
+    return r;
+  804574:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804577:	eb 59                	jmp    8045d2 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804579:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80457d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804584:	00 00 00 
+  804587:	48 89 d6             	mov    %rdx,%rsi
+  80458a:	48 89 c7             	mov    %rax,%rdi
+  80458d:	48 b8 bc 15 80 00 00 	movabs $0x8015bc,%rax
+  804594:	00 00 00 
+  804597:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804599:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8045a0:	00 00 00 
+  8045a3:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  8045a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045ad:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8045b3:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8045ba:	00 00 00 
+  8045bd:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8045c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045c7:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8045cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045d2:	c9                   	leave
+  8045d3:	c3                   	ret
+
+00000000008045d4 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8045d4:	55                   	push   %rbp
+  8045d5:	48 89 e5             	mov    %rsp,%rbp
+  8045d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8045dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8045e0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8045e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045e7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8045ea:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8045f1:	00 00 00 
+  8045f4:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8045f6:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8045fd:	00 00 00 
+  804600:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804603:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804606:	be 00 00 00 00       	mov    $0x0,%esi
+  80460b:	bf 02 00 00 00       	mov    $0x2,%edi
+  804610:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  804617:	00 00 00 
+  80461a:	ff d0                	call   *%rax
+}
+  80461c:	c9                   	leave
+  80461d:	c3                   	ret
+
+000000000080461e <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80461e:	55                   	push   %rbp
+  80461f:	48 89 e5             	mov    %rsp,%rbp
+  804622:	48 83 ec 18          	sub    $0x18,%rsp
+  804626:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80462a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80462d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804631:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804634:	83 e0 03             	and    $0x3,%eax
+}
+  804637:	c9                   	leave
+  804638:	c3                   	ret
+
+0000000000804639 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804639:	55                   	push   %rbp
+  80463a:	48 89 e5             	mov    %rsp,%rbp
+  80463d:	48 83 ec 10          	sub    $0x10,%rsp
+  804641:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804645:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804649:	48 89 c7             	mov    %rax,%rdi
+  80464c:	48 b8 bb 14 80 00 00 	movabs $0x8014bb,%rax
+  804653:	00 00 00 
+  804656:	ff d0                	call   *%rax
+  804658:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80465d:	7e 07                	jle    804666 <remove+0x2d>
+    return -E_BAD_PATH;
+  80465f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804664:	eb 36                	jmp    80469c <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804666:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80466a:	48 89 c6             	mov    %rax,%rsi
+  80466d:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804674:	00 00 00 
+  804677:	48 89 c7             	mov    %rax,%rdi
+  80467a:	48 b8 bc 15 80 00 00 	movabs $0x8015bc,%rax
+  804681:	00 00 00 
+  804684:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804686:	be 00 00 00 00       	mov    $0x0,%esi
+  80468b:	bf 07 00 00 00       	mov    $0x7,%edi
+  804690:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  804697:	00 00 00 
+  80469a:	ff d0                	call   *%rax
+}
+  80469c:	c9                   	leave
+  80469d:	c3                   	ret
+
+000000000080469e <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80469e:	55                   	push   %rbp
+  80469f:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8046a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8046a7:	bf 08 00 00 00       	mov    $0x8,%edi
+  8046ac:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  8046b3:	00 00 00 
+  8046b6:	ff d0                	call   *%rax
+}
+  8046b8:	5d                   	pop    %rbp
+  8046b9:	c3                   	ret
+
+00000000008046ba <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  8046ba:	55                   	push   %rbp
+  8046bb:	48 89 e5             	mov    %rsp,%rbp
+  8046be:	48 83 ec 20          	sub    $0x20,%rsp
+  8046c2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8046c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8046cb:	bf 09 00 00 00       	mov    $0x9,%edi
+  8046d0:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  8046d7:	00 00 00 
+  8046da:	ff d0                	call   *%rax
+  8046dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8046df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046e3:	79 05                	jns    8046ea <fs_stats+0x30>
+    return r;
+  8046e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8046e8:	eb 2a                	jmp    804714 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8046ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046ee:	ba 68 00 00 00       	mov    $0x68,%edx
+  8046f3:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8046fa:	00 00 00 
+  8046fd:	48 89 ce             	mov    %rcx,%rsi
+  804700:	48 89 c7             	mov    %rax,%rdi
+  804703:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  80470a:	00 00 00 
+  80470d:	ff d0                	call   *%rax
+  return 0;
+  80470f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804714:	c9                   	leave
+  804715:	c3                   	ret
+
+0000000000804716 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804716:	55                   	push   %rbp
+  804717:	48 89 e5             	mov    %rsp,%rbp
+  80471a:	48 83 ec 10          	sub    $0x10,%rsp
+  80471e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804721:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804728:	00 00 00 
+  80472b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80472e:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804730:	be 00 00 00 00       	mov    $0x0,%esi
+  804735:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80473a:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  804741:	00 00 00 
+  804744:	ff d0                	call   *%rax
+}
+  804746:	c9                   	leave
+  804747:	c3                   	ret
+
+0000000000804748 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804748:	55                   	push   %rbp
+  804749:	48 89 e5             	mov    %rsp,%rbp
+  80474c:	48 83 ec 10          	sub    $0x10,%rsp
+  804750:	89 f8                	mov    %edi,%eax
+  804752:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804755:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804759:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804760:	00 00 00 
+  804763:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804765:	be 00 00 00 00       	mov    $0x0,%esi
+  80476a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80476f:	48 b8 be 41 80 00 00 	movabs $0x8041be,%rax
+  804776:	00 00 00 
+  804779:	ff d0                	call   *%rax
+}
+  80477b:	c9                   	leave
+  80477c:	c3                   	ret
+
+000000000080477d <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80477d:	55                   	push   %rbp
+  80477e:	48 89 e5             	mov    %rsp,%rbp
+  804781:	48 83 ec 10          	sub    $0x10,%rsp
+  804785:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804789:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80478d:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804792:	48 89 c7             	mov    %rax,%rdi
+  804795:	48 b8 a3 47 80 00 00 	movabs $0x8047a3,%rax
+  80479c:	00 00 00 
+  80479f:	ff d0                	call   *%rax
+}
+  8047a1:	c9                   	leave
+  8047a2:	c3                   	ret
+
+00000000008047a3 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  8047a3:	55                   	push   %rbp
+  8047a4:	48 89 e5             	mov    %rsp,%rbp
+  8047a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8047ab:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8047af:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8047b3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8047ba:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8047bb:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8047c0:	74 0a                	je     8047cc <pipe_size+0x29>
+  8047c2:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8047c9:	00 
+  8047ca:	76 0a                	jbe    8047d6 <pipe_size+0x33>
+    return -E_INVAL;
+  8047cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8047d1:	e9 cc 02 00 00       	jmp    804aa2 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8047d6:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8047da:	48 89 c7             	mov    %rax,%rdi
+  8047dd:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  8047e4:	00 00 00 
+  8047e7:	ff d0                	call   *%rax
+  8047e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8047ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047f0:	0f 88 a8 02 00 00    	js     804a9e <pipe_size+0x2fb>
+  8047f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8047fa:	ba 07 04 00 00       	mov    $0x407,%edx
+  8047ff:	48 89 c6             	mov    %rax,%rsi
+  804802:	bf 00 00 00 00       	mov    $0x0,%edi
+  804807:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  80480e:	00 00 00 
+  804811:	ff d0                	call   *%rax
+  804813:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804816:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80481a:	0f 88 7e 02 00 00    	js     804a9e <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804820:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804824:	48 89 c7             	mov    %rax,%rdi
+  804827:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  80482e:	00 00 00 
+  804831:	ff d0                	call   *%rax
+  804833:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804836:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80483a:	0f 88 43 02 00 00    	js     804a83 <pipe_size+0x2e0>
+  804840:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804844:	ba 07 04 00 00       	mov    $0x407,%edx
+  804849:	48 89 c6             	mov    %rax,%rsi
+  80484c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804851:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  804858:	00 00 00 
+  80485b:	ff d0                	call   *%rax
+  80485d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804860:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804864:	0f 88 19 02 00 00    	js     804a83 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80486a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80486e:	48 89 c7             	mov    %rax,%rdi
+  804871:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  804878:	00 00 00 
+  80487b:	ff d0                	call   *%rax
+  80487d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804881:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804888:	00 
+  804889:	e9 a2 00 00 00       	jmp    804930 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80488e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804892:	48 c1 e0 0c          	shl    $0xc,%rax
+  804896:	48 89 c2             	mov    %rax,%rdx
+  804899:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80489d:	48 01 d0             	add    %rdx,%rax
+  8048a0:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048a5:	48 89 c6             	mov    %rax,%rsi
+  8048a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048ad:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  8048b4:	00 00 00 
+  8048b7:	ff d0                	call   *%rax
+  8048b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048c0:	0f 88 37 01 00 00    	js     8049fd <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8048c6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048ca:	48 89 c7             	mov    %rax,%rdi
+  8048cd:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  8048d4:	00 00 00 
+  8048d7:	ff d0                	call   *%rax
+  8048d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8048dd:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8048e1:	48 01 c2             	add    %rax,%rdx
+  8048e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8048ec:	48 89 c1             	mov    %rax,%rcx
+  8048ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048f3:	48 01 c8             	add    %rcx,%rax
+  8048f6:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8048fc:	48 89 d1             	mov    %rdx,%rcx
+  8048ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  804904:	48 89 c6             	mov    %rax,%rsi
+  804907:	bf 00 00 00 00       	mov    $0x0,%edi
+  80490c:	48 b8 e2 23 80 00 00 	movabs $0x8023e2,%rax
+  804913:	00 00 00 
+  804916:	ff d0                	call   *%rax
+  804918:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80491b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80491f:	79 0a                	jns    80492b <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804921:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804926:	e9 d3 00 00 00       	jmp    8049fe <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80492b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804930:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804937:	00 
+  804938:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80493c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804940:	48 01 d0             	add    %rdx,%rax
+  804943:	48 83 c0 1f          	add    $0x1f,%rax
+  804947:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80494b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80494f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804954:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804958:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80495c:	48 29 d0             	sub    %rdx,%rax
+  80495f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804963:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804967:	0f 82 21 ff ff ff    	jb     80488e <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80496d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804971:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804975:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804979:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80497d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804981:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804985:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  80498c:	00 00 00 
+  80498f:	8b 12                	mov    (%rdx),%edx
+  804991:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804993:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804997:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80499e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049a2:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  8049a9:	00 00 00 
+  8049ac:	8b 12                	mov    (%rdx),%edx
+  8049ae:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  8049b0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049b4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8049bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049bf:	48 89 c7             	mov    %rax,%rdi
+  8049c2:	48 b8 51 32 80 00 00 	movabs $0x803251,%rax
+  8049c9:	00 00 00 
+  8049cc:	ff d0                	call   *%rax
+  8049ce:	89 c2                	mov    %eax,%edx
+  8049d0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8049d4:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8049d6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8049da:	48 89 c7             	mov    %rax,%rdi
+  8049dd:	48 b8 51 32 80 00 00 	movabs $0x803251,%rax
+  8049e4:	00 00 00 
+  8049e7:	ff d0                	call   *%rax
+  8049e9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8049ed:	48 83 c2 04          	add    $0x4,%rdx
+  8049f1:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8049f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f8:	e9 a5 00 00 00       	jmp    804aa2 <pipe_size+0x2ff>
+      goto err2;
+  8049fd:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8049fe:	eb 58                	jmp    804a58 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a04:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a08:	48 89 c2             	mov    %rax,%rdx
+  804a0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a0f:	48 01 d0             	add    %rdx,%rax
+  804a12:	48 89 c6             	mov    %rax,%rsi
+  804a15:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a1a:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  804a21:	00 00 00 
+  804a24:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804a26:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a2a:	48 89 c7             	mov    %rax,%rdi
+  804a2d:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  804a34:	00 00 00 
+  804a37:	ff d0                	call   *%rax
+  804a39:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804a3d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804a41:	48 01 d0             	add    %rdx,%rax
+  804a44:	48 89 c6             	mov    %rax,%rsi
+  804a47:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a4c:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  804a53:	00 00 00 
+  804a56:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804a58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a5c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a60:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804a64:	48 85 c0             	test   %rax,%rax
+  804a67:	75 97                	jne    804a00 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804a69:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a6d:	48 89 c6             	mov    %rax,%rsi
+  804a70:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a75:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  804a7c:	00 00 00 
+  804a7f:	ff d0                	call   *%rax
+  804a81:	eb 01                	jmp    804a84 <pipe_size+0x2e1>
+    goto err1;
+  804a83:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804a84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a88:	48 89 c6             	mov    %rax,%rsi
+  804a8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a90:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  804a97:	00 00 00 
+  804a9a:	ff d0                	call   *%rax
+  804a9c:	eb 01                	jmp    804a9f <pipe_size+0x2fc>
+    goto err;
+  804a9e:	90                   	nop
+err:
+  return r;
+  804a9f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804aa2:	c9                   	leave
+  804aa3:	c3                   	ret
+
+0000000000804aa4 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804aa4:	55                   	push   %rbp
+  804aa5:	48 89 e5             	mov    %rsp,%rbp
+  804aa8:	53                   	push   %rbx
+  804aa9:	48 83 ec 28          	sub    $0x28,%rsp
+  804aad:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804ab1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804ab5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804abc:	00 00 00 
+  804abf:	8b 40 04             	mov    0x4(%rax),%eax
+  804ac2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ac7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ace:	00 00 00 
+  804ad1:	48 98                	cltq
+  804ad3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ada:	48 01 d0             	add    %rdx,%rax
+  804add:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804ae3:	8b 00                	mov    (%rax),%eax
+  804ae5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804ae8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804aec:	48 89 c7             	mov    %rax,%rdi
+  804aef:	48 b8 3a 5f 80 00 00 	movabs $0x805f3a,%rax
+  804af6:	00 00 00 
+  804af9:	ff d0                	call   *%rax
+  804afb:	89 c3                	mov    %eax,%ebx
+  804afd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b01:	48 89 c7             	mov    %rax,%rdi
+  804b04:	48 b8 3a 5f 80 00 00 	movabs $0x805f3a,%rax
+  804b0b:	00 00 00 
+  804b0e:	ff d0                	call   *%rax
+  804b10:	39 c3                	cmp    %eax,%ebx
+  804b12:	0f 94 c0             	sete   %al
+  804b15:	0f b6 c0             	movzbl %al,%eax
+  804b18:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804b1b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b22:	00 00 00 
+  804b25:	8b 40 04             	mov    0x4(%rax),%eax
+  804b28:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b2d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b34:	00 00 00 
+  804b37:	48 98                	cltq
+  804b39:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b40:	48 01 d0             	add    %rdx,%rax
+  804b43:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b49:	8b 00                	mov    (%rax),%eax
+  804b4b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804b4e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b51:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b54:	75 05                	jne    804b5b <_pipeisclosed+0xb7>
+      return ret;
+  804b56:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804b59:	eb 68                	jmp    804bc3 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804b5b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b5e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804b61:	0f 84 4e ff ff ff    	je     804ab5 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804b67:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b6e:	00 00 00 
+  804b71:	8b 40 04             	mov    0x4(%rax),%eax
+  804b74:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b79:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b80:	00 00 00 
+  804b83:	48 98                	cltq
+  804b85:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b8c:	48 01 d0             	add    %rdx,%rax
+  804b8f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b95:	8b 10                	mov    (%rax),%edx
+  804b97:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804b9a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b9d:	89 c6                	mov    %eax,%esi
+  804b9f:	48 b8 70 6e 80 00 00 	movabs $0x806e70,%rax
+  804ba6:	00 00 00 
+  804ba9:	48 89 c7             	mov    %rax,%rdi
+  804bac:	b8 00 00 00 00       	mov    $0x0,%eax
+  804bb1:	49 b8 0c 06 80 00 00 	movabs $0x80060c,%r8
+  804bb8:	00 00 00 
+  804bbb:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804bbe:	e9 f2 fe ff ff       	jmp    804ab5 <_pipeisclosed+0x11>
+  }
+}
+  804bc3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804bc7:	c9                   	leave
+  804bc8:	c3                   	ret
+
+0000000000804bc9 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804bc9:	55                   	push   %rbp
+  804bca:	48 89 e5             	mov    %rsp,%rbp
+  804bcd:	48 83 ec 30          	sub    $0x30,%rsp
+  804bd1:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804bd4:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804bd8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804bdb:	48 89 d6             	mov    %rdx,%rsi
+  804bde:	89 c7                	mov    %eax,%edi
+  804be0:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  804be7:	00 00 00 
+  804bea:	ff d0                	call   *%rax
+  804bec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bf3:	79 05                	jns    804bfa <pipeisclosed+0x31>
+    return r;
+  804bf5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bf8:	eb 31                	jmp    804c2b <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bfe:	48 89 c7             	mov    %rax,%rdi
+  804c01:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  804c08:	00 00 00 
+  804c0b:	ff d0                	call   *%rax
+  804c0d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804c11:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c15:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c19:	48 89 d6             	mov    %rdx,%rsi
+  804c1c:	48 89 c7             	mov    %rax,%rdi
+  804c1f:	48 b8 a4 4a 80 00 00 	movabs $0x804aa4,%rax
+  804c26:	00 00 00 
+  804c29:	ff d0                	call   *%rax
+}
+  804c2b:	c9                   	leave
+  804c2c:	c3                   	ret
+
+0000000000804c2d <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804c2d:	55                   	push   %rbp
+  804c2e:	48 89 e5             	mov    %rsp,%rbp
+  804c31:	48 83 ec 10          	sub    $0x10,%rsp
+  804c35:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804c39:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c3d:	8b 40 18             	mov    0x18(%rax),%eax
+  804c40:	8d 50 01             	lea    0x1(%rax),%edx
+  804c43:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c47:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804c4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c4e:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804c51:	85 c0                	test   %eax,%eax
+  804c53:	74 27                	je     804c7c <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804c55:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c59:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804c60:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c64:	48 83 c0 18          	add    $0x18,%rax
+  804c68:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804c6d:	48 89 c7             	mov    %rax,%rdi
+  804c70:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  804c77:	00 00 00 
+  804c7a:	ff d0                	call   *%rax
+  }
+}
+  804c7c:	90                   	nop
+  804c7d:	c9                   	leave
+  804c7e:	c3                   	ret
+
+0000000000804c7f <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804c7f:	55                   	push   %rbp
+  804c80:	48 89 e5             	mov    %rsp,%rbp
+  804c83:	48 83 ec 10          	sub    $0x10,%rsp
+  804c87:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c8b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804c8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c92:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804c99:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c9d:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804ca1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804ca4:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804cab:	89 c6                	mov    %eax,%esi
+  804cad:	48 89 cf             	mov    %rcx,%rdi
+  804cb0:	48 b8 36 27 80 00 00 	movabs $0x802736,%rax
+  804cb7:	00 00 00 
+  804cba:	ff d0                	call   *%rax
+}
+  804cbc:	90                   	nop
+  804cbd:	c9                   	leave
+  804cbe:	c3                   	ret
+
+0000000000804cbf <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804cbf:	55                   	push   %rbp
+  804cc0:	48 89 e5             	mov    %rsp,%rbp
+  804cc3:	48 83 ec 70          	sub    $0x70,%rsp
+  804cc7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804ccb:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804ccf:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804cd3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804cd7:	48 89 c7             	mov    %rax,%rdi
+  804cda:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  804ce1:	00 00 00 
+  804ce4:	ff d0                	call   *%rax
+  804ce6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804cea:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804cef:	75 0a                	jne    804cfb <devpipe_read+0x3c>
+    return 0;
+  804cf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cf6:	e9 63 01 00 00       	jmp    804e5e <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804cfb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cff:	8b 40 18             	mov    0x18(%rax),%eax
+  804d02:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804d05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d09:	48 8b 10             	mov    (%rax),%rdx
+  804d0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d14:	48 39 c2             	cmp    %rax,%rdx
+  804d17:	75 42                	jne    804d5b <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804d19:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d1d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d21:	48 89 d6             	mov    %rdx,%rsi
+  804d24:	48 89 c7             	mov    %rax,%rdi
+  804d27:	48 b8 a4 4a 80 00 00 	movabs $0x804aa4,%rax
+  804d2e:	00 00 00 
+  804d31:	ff d0                	call   *%rax
+  804d33:	85 c0                	test   %eax,%eax
+  804d35:	74 0a                	je     804d41 <devpipe_read+0x82>
+      return 0;
+  804d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d3c:	e9 1d 01 00 00       	jmp    804e5e <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804d41:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804d44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d48:	89 d6                	mov    %edx,%esi
+  804d4a:	48 89 c7             	mov    %rax,%rdi
+  804d4d:	48 b8 7f 4c 80 00 00 	movabs $0x804c7f,%rax
+  804d54:	00 00 00 
+  804d57:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804d59:	eb a0                	jmp    804cfb <devpipe_read+0x3c>
+      break;
+  804d5b:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804d5c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804d60:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804d64:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804d68:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804d6c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d70:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804d74:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d78:	48 8b 00             	mov    (%rax),%rax
+  804d7b:	48 29 c2             	sub    %rax,%rdx
+  804d7e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804d82:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804d86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d8a:	48 39 c2             	cmp    %rax,%rdx
+  804d8d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804d91:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804d95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d99:	48 8b 00             	mov    (%rax),%rax
+  804d9c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804da0:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804da4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804da9:	48 f7 f1             	div    %rcx
+  804dac:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804db0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804db4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804db8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dbc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804dc0:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804dc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804dc8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804dcc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804dd0:	48 39 c2             	cmp    %rax,%rdx
+  804dd3:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804dd7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804ddb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ddf:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804de3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804de7:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804deb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804def:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804df3:	48 89 ce             	mov    %rcx,%rsi
+  804df6:	48 89 c7             	mov    %rax,%rdi
+  804df9:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  804e00:	00 00 00 
+  804e03:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804e05:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e09:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804e0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e11:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804e15:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804e19:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e1d:	48 01 d1             	add    %rdx,%rcx
+  804e20:	48 89 c2             	mov    %rax,%rdx
+  804e23:	48 89 cf             	mov    %rcx,%rdi
+  804e26:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  804e2d:	00 00 00 
+  804e30:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804e32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e36:	48 8b 10             	mov    (%rax),%rdx
+  804e39:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e3d:	48 01 c2             	add    %rax,%rdx
+  804e40:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e44:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804e47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e4b:	48 89 c7             	mov    %rax,%rdi
+  804e4e:	48 b8 2d 4c 80 00 00 	movabs $0x804c2d,%rax
+  804e55:	00 00 00 
+  804e58:	ff d0                	call   *%rax
+  return n;
+  804e5a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804e5e:	c9                   	leave
+  804e5f:	c3                   	ret
+
+0000000000804e60 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804e60:	55                   	push   %rbp
+  804e61:	48 89 e5             	mov    %rsp,%rbp
+  804e64:	48 83 ec 70          	sub    $0x70,%rsp
+  804e68:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804e6c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804e70:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804e74:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804e78:	48 89 c7             	mov    %rax,%rdi
+  804e7b:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  804e82:	00 00 00 
+  804e85:	ff d0                	call   *%rax
+  804e87:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804e8b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804e8f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804e93:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804e9a:	00 
+  804e9b:	e9 b8 01 00 00       	jmp    805058 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804ea0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ea4:	8b 40 18             	mov    0x18(%rax),%eax
+  804ea7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804eaa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eae:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804eb2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804eb6:	48 8b 00             	mov    (%rax),%rax
+  804eb9:	48 29 c2             	sub    %rax,%rdx
+  804ebc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ec0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ec4:	48 39 c2             	cmp    %rax,%rdx
+  804ec7:	75 4d                	jne    804f16 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804ec9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804ecd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ed1:	48 89 d6             	mov    %rdx,%rsi
+  804ed4:	48 89 c7             	mov    %rax,%rdi
+  804ed7:	48 b8 a4 4a 80 00 00 	movabs $0x804aa4,%rax
+  804ede:	00 00 00 
+  804ee1:	ff d0                	call   *%rax
+  804ee3:	85 c0                	test   %eax,%eax
+  804ee5:	74 0a                	je     804ef1 <devpipe_write+0x91>
+        return 0;
+  804ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804eec:	e9 79 01 00 00       	jmp    80506a <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804ef1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804ef4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef8:	89 d6                	mov    %edx,%esi
+  804efa:	48 89 c7             	mov    %rax,%rdi
+  804efd:	48 b8 7f 4c 80 00 00 	movabs $0x804c7f,%rax
+  804f04:	00 00 00 
+  804f07:	ff d0                	call   *%rax
+      m = 0;
+  804f09:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804f10:	00 
+      continue;
+  804f11:	e9 3a 01 00 00       	jmp    805050 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804f16:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f1a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804f1e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804f22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f26:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804f2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2e:	48 8b 08             	mov    (%rax),%rcx
+  804f31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f35:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f39:	48 29 c1             	sub    %rax,%rcx
+  804f3c:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804f40:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804f44:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804f48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804f4c:	48 39 c2             	cmp    %rax,%rdx
+  804f4f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f53:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804f57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804f5f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f63:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804f67:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f6c:	48 f7 f1             	div    %rcx
+  804f6f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804f73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f77:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804f7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f7f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f83:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804f87:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804f8b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804f8f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804f93:	48 39 c2             	cmp    %rax,%rdx
+  804f96:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804f9a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804f9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804fa2:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804fa6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804faa:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804fae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804fb2:	48 01 d1             	add    %rdx,%rcx
+  804fb5:	48 89 c2             	mov    %rax,%rdx
+  804fb8:	48 89 cf             	mov    %rcx,%rdi
+  804fbb:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  804fc2:	00 00 00 
+  804fc5:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804fc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fcb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fcf:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804fd3:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804fd7:	73 4d                	jae    805026 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804fd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fdd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804fe1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804fe5:	48 29 c2             	sub    %rax,%rdx
+  804fe8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fec:	48 01 c2             	add    %rax,%rdx
+  804fef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ff3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804ff7:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804ffb:	48 89 c1             	mov    %rax,%rcx
+  804ffe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805002:	48 01 c1             	add    %rax,%rcx
+  805005:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805009:	48 01 c1             	add    %rax,%rcx
+  80500c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805010:	48 83 c0 20          	add    $0x20,%rax
+  805014:	48 89 ce             	mov    %rcx,%rsi
+  805017:	48 89 c7             	mov    %rax,%rdi
+  80501a:	48 b8 05 1d 80 00 00 	movabs $0x801d05,%rax
+  805021:	00 00 00 
+  805024:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805026:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80502a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80502e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805032:	48 01 c2             	add    %rax,%rdx
+  805035:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805039:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80503d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805041:	48 89 c7             	mov    %rax,%rdi
+  805044:	48 b8 2d 4c 80 00 00 	movabs $0x804c2d,%rax
+  80504b:	00 00 00 
+  80504e:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805050:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805054:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805058:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80505c:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805060:	0f 82 3a fe ff ff    	jb     804ea0 <devpipe_write+0x40>
+  }
+
+  return i;
+  805066:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80506a:	c9                   	leave
+  80506b:	c3                   	ret
+
+000000000080506c <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80506c:	55                   	push   %rbp
+  80506d:	48 89 e5             	mov    %rsp,%rbp
+  805070:	48 83 ec 40          	sub    $0x40,%rsp
+  805074:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805078:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80507b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80507f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805083:	48 89 c7             	mov    %rax,%rdi
+  805086:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  80508d:	00 00 00 
+  805090:	ff d0                	call   *%rax
+  805092:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805096:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80509d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050a1:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8050a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8050a9:	48 89 d6             	mov    %rdx,%rsi
+  8050ac:	48 89 c7             	mov    %rax,%rdi
+  8050af:	48 b8 47 3d 80 00 00 	movabs $0x803d47,%rax
+  8050b6:	00 00 00 
+  8050b9:	ff d0                	call   *%rax
+  8050bb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050be:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050c2:	79 08                	jns    8050cc <devpipe_poll+0x60>
+    return r;
+  8050c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8050c7:	e9 85 00 00 00       	jmp    805151 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8050cc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050cf:	83 e0 01             	and    $0x1,%eax
+  8050d2:	85 c0                	test   %eax,%eax
+  8050d4:	74 18                	je     8050ee <devpipe_poll+0x82>
+  8050d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050da:	48 8b 10             	mov    (%rax),%rdx
+  8050dd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050e1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8050e5:	48 39 c2             	cmp    %rax,%rdx
+  8050e8:	74 04                	je     8050ee <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8050ea:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8050ee:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050f1:	83 e0 02             	and    $0x2,%eax
+  8050f4:	85 c0                	test   %eax,%eax
+  8050f6:	74 23                	je     80511b <devpipe_poll+0xaf>
+  8050f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050fc:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805100:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805104:	48 8b 00             	mov    (%rax),%rax
+  805107:	48 29 c2             	sub    %rax,%rdx
+  80510a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80510e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805112:	48 39 c2             	cmp    %rax,%rdx
+  805115:	73 04                	jae    80511b <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805117:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80511b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80511f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805123:	48 89 d6             	mov    %rdx,%rsi
+  805126:	48 89 c7             	mov    %rax,%rdi
+  805129:	48 b8 a4 4a 80 00 00 	movabs $0x804aa4,%rax
+  805130:	00 00 00 
+  805133:	ff d0                	call   *%rax
+  805135:	85 c0                	test   %eax,%eax
+  805137:	74 04                	je     80513d <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805139:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80513d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805141:	75 0b                	jne    80514e <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805143:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805147:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80514e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805151:	c9                   	leave
+  805152:	c3                   	ret
+
+0000000000805153 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805153:	55                   	push   %rbp
+  805154:	48 89 e5             	mov    %rsp,%rbp
+  805157:	48 83 ec 20          	sub    $0x20,%rsp
+  80515b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80515f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805163:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805167:	48 89 c7             	mov    %rax,%rdi
+  80516a:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  805171:	00 00 00 
+  805174:	ff d0                	call   *%rax
+  805176:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  80517a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80517e:	48 ba a1 6e 80 00 00 	movabs $0x806ea1,%rdx
+  805185:	00 00 00 
+  805188:	48 89 d6             	mov    %rdx,%rsi
+  80518b:	48 89 c7             	mov    %rax,%rdi
+  80518e:	48 b8 bc 15 80 00 00 	movabs $0x8015bc,%rax
+  805195:	00 00 00 
+  805198:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  80519a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80519e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8051a2:	89 c1                	mov    %eax,%ecx
+  8051a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051a8:	48 8b 00             	mov    (%rax),%rax
+  8051ab:	89 c2                	mov    %eax,%edx
+  8051ad:	89 c8                	mov    %ecx,%eax
+  8051af:	29 d0                	sub    %edx,%eax
+  8051b1:	89 c2                	mov    %eax,%edx
+  8051b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051b7:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8051bd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051c1:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8051c8:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8051cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051cf:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8051d6:	00 00 00 
+  8051d9:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8051e0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051e5:	c9                   	leave
+  8051e6:	c3                   	ret
+
+00000000008051e7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8051e7:	55                   	push   %rbp
+  8051e8:	48 89 e5             	mov    %rsp,%rbp
+  8051eb:	48 83 ec 40          	sub    $0x40,%rsp
+  8051ef:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8051f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8051f7:	48 89 c7             	mov    %rax,%rdi
+  8051fa:	48 b8 74 32 80 00 00 	movabs $0x803274,%rax
+  805201:	00 00 00 
+  805204:	ff d0                	call   *%rax
+  805206:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80520a:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805211:	00 
+  805212:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805216:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80521a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80521e:	48 01 d0             	add    %rdx,%rax
+  805221:	48 83 c0 1f          	add    $0x1f,%rax
+  805225:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805229:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80522d:	ba 00 00 00 00       	mov    $0x0,%edx
+  805232:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805236:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80523a:	48 29 d0             	sub    %rdx,%rax
+  80523d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805241:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805245:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805249:	48 89 c6             	mov    %rax,%rsi
+  80524c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805251:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  805258:	00 00 00 
+  80525b:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80525d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805261:	48 89 c7             	mov    %rax,%rdi
+  805264:	48 b8 2d 4c 80 00 00 	movabs $0x804c2d,%rax
+  80526b:	00 00 00 
+  80526e:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805270:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805274:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805278:	eb 2f                	jmp    8052a9 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  80527a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80527e:	48 83 e8 01          	sub    $0x1,%rax
+  805282:	48 c1 e0 0c          	shl    $0xc,%rax
+  805286:	48 89 c2             	mov    %rax,%rdx
+  805289:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80528d:	48 01 d0             	add    %rdx,%rax
+  805290:	48 89 c6             	mov    %rax,%rsi
+  805293:	bf 00 00 00 00       	mov    $0x0,%edi
+  805298:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  80529f:	00 00 00 
+  8052a2:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8052a4:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8052a9:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8052ae:	77 ca                	ja     80527a <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8052b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052b4:	48 89 c6             	mov    %rax,%rsi
+  8052b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052bc:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  8052c3:	00 00 00 
+  8052c6:	ff d0                	call   *%rax
+}
+  8052c8:	c9                   	leave
+  8052c9:	c3                   	ret
+
+00000000008052ca <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  8052ca:	55                   	push   %rbp
+  8052cb:	48 89 e5             	mov    %rsp,%rbp
+  8052ce:	48 83 ec 10          	sub    $0x10,%rsp
+  8052d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8052d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8052da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8052e2:	48 89 c7             	mov    %rax,%rdi
+  8052e5:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8052e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ec:	48 b8 2e 55 80 00 00 	movabs $0x80552e,%rax
+  8052f3:	00 00 00 
+  8052f6:	ff d0                	call   *%rax
+}
+  8052f8:	90                   	nop
+  8052f9:	c9                   	leave
+  8052fa:	c3                   	ret
+
+00000000008052fb <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  8052fb:	55                   	push   %rbp
+  8052fc:	48 89 e5             	mov    %rsp,%rbp
+  8052ff:	48 83 ec 20          	sub    $0x20,%rsp
+  805303:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  805306:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805309:	c1 e0 10             	shl    $0x10,%eax
+  80530c:	48 98                	cltq
+  80530e:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805313:	48 01 d0             	add    %rdx,%rax
+  805316:	48 89 c6             	mov    %rax,%rsi
+  805319:	bf 00 00 00 00       	mov    $0x0,%edi
+  80531e:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  805325:	00 00 00 
+  805328:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80532a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80532d:	83 c0 01             	add    $0x1,%eax
+  805330:	c1 e0 10             	shl    $0x10,%eax
+  805333:	48 98                	cltq
+  805335:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80533a:	48 01 d0             	add    %rdx,%rax
+  80533d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805341:	eb 20                	jmp    805363 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  805343:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805347:	48 89 c6             	mov    %rax,%rsi
+  80534a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80534f:	48 b8 42 24 80 00 00 	movabs $0x802442,%rax
+  805356:	00 00 00 
+  805359:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80535b:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805362:	00 
+  805363:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805366:	83 c0 01             	add    $0x1,%eax
+  805369:	c1 e0 10             	shl    $0x10,%eax
+  80536c:	48 98                	cltq
+  80536e:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805373:	48 01 d0             	add    %rdx,%rax
+  805376:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80537a:	72 c7                	jb     805343 <slot_unmap+0x48>
+}
+  80537c:	90                   	nop
+  80537d:	90                   	nop
+  80537e:	c9                   	leave
+  80537f:	c3                   	ret
+
+0000000000805380 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  805380:	55                   	push   %rbp
+  805381:	48 89 e5             	mov    %rsp,%rbp
+  805384:	48 83 ec 30          	sub    $0x30,%rsp
+  805388:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80538c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  805390:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805397:	00 00 00 
+  80539a:	48 89 c7             	mov    %rax,%rdi
+  80539d:	48 b8 5d 61 80 00 00 	movabs $0x80615d,%rax
+  8053a4:	00 00 00 
+  8053a7:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  8053a9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8053b0:	eb 04                	jmp    8053b6 <thread_create+0x36>
+  8053b2:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8053b6:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  8053ba:	7f 16                	jg     8053d2 <thread_create+0x52>
+  8053bc:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  8053c3:	00 00 00 
+  8053c6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053c9:	48 98                	cltq
+  8053cb:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8053ce:	85 c0                	test   %eax,%eax
+  8053d0:	75 e0                	jne    8053b2 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8053d2:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8053d6:	75 0c                	jne    8053e4 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8053d8:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8053df:	e9 2c 01 00 00       	jmp    805510 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8053e4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053e7:	c1 e0 10             	shl    $0x10,%eax
+  8053ea:	48 98                	cltq
+  8053ec:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8053f1:	48 01 d0             	add    %rdx,%rax
+  8053f4:	ba 07 00 00 00       	mov    $0x7,%edx
+  8053f9:	48 89 c6             	mov    %rax,%rsi
+  8053fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  805401:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  805408:	00 00 00 
+  80540b:	ff d0                	call   *%rax
+  80540d:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805410:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805414:	0f 88 f5 00 00 00    	js     80550f <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80541a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80541d:	83 c0 01             	add    $0x1,%eax
+  805420:	c1 e0 10             	shl    $0x10,%eax
+  805423:	48 98                	cltq
+  805425:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80542a:	48 01 d0             	add    %rdx,%rax
+  80542d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805431:	eb 32                	jmp    805465 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805433:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805437:	ba 07 00 00 00       	mov    $0x7,%edx
+  80543c:	48 89 c6             	mov    %rax,%rsi
+  80543f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805444:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  80544b:	00 00 00 
+  80544e:	ff d0                	call   *%rax
+  805450:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805453:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805457:	0f 88 9e 00 00 00    	js     8054fb <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80545d:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805464:	00 
+  805465:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805468:	83 c0 01             	add    $0x1,%eax
+  80546b:	c1 e0 10             	shl    $0x10,%eax
+  80546e:	48 98                	cltq
+  805470:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805475:	48 01 d0             	add    %rdx,%rax
+  805478:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80547c:	72 b5                	jb     805433 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  80547e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805482:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805486:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805489:	c1 e2 10             	shl    $0x10,%edx
+  80548c:	48 63 d2             	movslq %edx,%rdx
+  80548f:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805494:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  805497:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  80549a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80549d:	83 c2 01             	add    $0x1,%edx
+  8054a0:	c1 e2 10             	shl    $0x10,%edx
+  8054a3:	48 63 d2             	movslq %edx,%rdx
+  8054a6:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  8054ab:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  8054ae:	48 bf ca 52 80 00 00 	movabs $0x8052ca,%rdi
+  8054b5:	00 00 00 
+  8054b8:	49 89 c8             	mov    %rcx,%r8
+  8054bb:	48 89 c1             	mov    %rax,%rcx
+  8054be:	4c 89 ca             	mov    %r9,%rdx
+  8054c1:	48 b8 2a 28 80 00 00 	movabs $0x80282a,%rax
+  8054c8:	00 00 00 
+  8054cb:	ff d0                	call   *%rax
+  8054cd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8054d0:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8054d4:	79 08                	jns    8054de <thread_create+0x15e>
+    r = id;
+  8054d6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054d9:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8054dc:	eb 1e                	jmp    8054fc <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8054de:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8054e1:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8054e4:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  8054eb:	00 00 00 
+  8054ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054f1:	48 98                	cltq
+  8054f3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8054f6:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8054f9:	eb 15                	jmp    805510 <thread_create+0x190>
+      goto fail;
+  8054fb:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  8054fc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054ff:	89 c7                	mov    %eax,%edi
+  805501:	48 b8 fb 52 80 00 00 	movabs $0x8052fb,%rax
+  805508:	00 00 00 
+  80550b:	ff d0                	call   *%rax
+  80550d:	eb 01                	jmp    805510 <thread_create+0x190>
+    goto out;
+  80550f:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  805510:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805517:	00 00 00 
+  80551a:	48 89 c7             	mov    %rax,%rdi
+  80551d:	48 b8 32 62 80 00 00 	movabs $0x806232,%rax
+  805524:	00 00 00 
+  805527:	ff d0                	call   *%rax
+  return r;
+  805529:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  80552c:	c9                   	leave
+  80552d:	c3                   	ret
+
+000000000080552e <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  80552e:	55                   	push   %rbp
+  80552f:	48 89 e5             	mov    %rsp,%rbp
+  805532:	48 83 ec 10          	sub    $0x10,%rsp
+  805536:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805539:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80553c:	89 c7                	mov    %eax,%edi
+  80553e:	48 b8 87 28 80 00 00 	movabs $0x802887,%rax
+  805545:	00 00 00 
+  805548:	ff d0                	call   *%rax
+}
+  80554a:	90                   	nop
+  80554b:	c9                   	leave
+  80554c:	c3                   	ret
+
+000000000080554d <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  80554d:	55                   	push   %rbp
+  80554e:	48 89 e5             	mov    %rsp,%rbp
+  805551:	48 83 ec 20          	sub    $0x20,%rsp
+  805555:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805558:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  80555c:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805563:	00 00 00 
+  805566:	48 89 c7             	mov    %rax,%rdi
+  805569:	48 b8 5d 61 80 00 00 	movabs $0x80615d,%rax
+  805570:	00 00 00 
+  805573:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  805575:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80557c:	eb 04                	jmp    805582 <thread_join+0x35>
+  80557e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805582:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805586:	7f 17                	jg     80559f <thread_join+0x52>
+  805588:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  80558f:	00 00 00 
+  805592:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805595:	48 98                	cltq
+  805597:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80559a:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80559d:	75 df                	jne    80557e <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  80559f:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8055a6:	00 00 00 
+  8055a9:	48 89 c7             	mov    %rax,%rdi
+  8055ac:	48 b8 32 62 80 00 00 	movabs $0x806232,%rax
+  8055b3:	00 00 00 
+  8055b6:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  8055b8:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8055bc:	74 06                	je     8055c4 <thread_join+0x77>
+  8055be:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  8055c2:	75 07                	jne    8055cb <thread_join+0x7e>
+    return -E_BAD_ENV;
+  8055c4:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  8055c9:	eb 76                	jmp    805641 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  8055cb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8055cf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055d2:	48 89 d6             	mov    %rdx,%rsi
+  8055d5:	89 c7                	mov    %eax,%edi
+  8055d7:	48 b8 4f 60 80 00 00 	movabs $0x80604f,%rax
+  8055de:	00 00 00 
+  8055e1:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8055e3:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  8055ea:	00 00 00 
+  8055ed:	48 89 c7             	mov    %rax,%rdi
+  8055f0:	48 b8 5d 61 80 00 00 	movabs $0x80615d,%rax
+  8055f7:	00 00 00 
+  8055fa:	ff d0                	call   *%rax
+  slot_unmap(i);
+  8055fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055ff:	89 c7                	mov    %eax,%edi
+  805601:	48 b8 fb 52 80 00 00 	movabs $0x8052fb,%rax
+  805608:	00 00 00 
+  80560b:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  80560d:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805614:	00 00 00 
+  805617:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80561a:	48 98                	cltq
+  80561c:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805623:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  80562a:	00 00 00 
+  80562d:	48 89 c7             	mov    %rax,%rdi
+  805630:	48 b8 32 62 80 00 00 	movabs $0x806232,%rax
+  805637:	00 00 00 
+  80563a:	ff d0                	call   *%rax
+  return 0;
+  80563c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805641:	c9                   	leave
+  805642:	c3                   	ret
+
+0000000000805643 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805643:	55                   	push   %rbp
+  805644:	48 89 e5             	mov    %rsp,%rbp
+  805647:	48 83 ec 08          	sub    $0x8,%rsp
+  80564b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  80564f:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805654:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805658:	73 23                	jae    80567d <thread_is_uxstack+0x3a>
+  80565a:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  80565f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805663:	72 18                	jb     80567d <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805665:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805669:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  80566e:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805674:	75 07                	jne    80567d <thread_is_uxstack+0x3a>
+  805676:	b8 01 00 00 00       	mov    $0x1,%eax
+  80567b:	eb 05                	jmp    805682 <thread_is_uxstack+0x3f>
+  80567d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805682:	83 e0 01             	and    $0x1,%eax
+}
+  805685:	c9                   	leave
+  805686:	c3                   	ret
+
+0000000000805687 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805687:	55                   	push   %rbp
+  805688:	48 89 e5             	mov    %rsp,%rbp
+  80568b:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  80568f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805696:	00 00 00 
+  805699:	8b 40 04             	mov    0x4(%rax),%eax
+  80569c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8056a1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8056a8:	00 00 00 
+  8056ab:	48 98                	cltq
+  8056ad:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8056b4:	48 01 d0             	add    %rdx,%rax
+  8056b7:	48 05 08 01 00 00    	add    $0x108,%rax
+  8056bd:	48 8b 00             	mov    (%rax),%rax
+  8056c0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  8056c4:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8056c9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8056cd:	73 0b                	jae    8056da <thread_pftemp+0x53>
+  8056cf:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8056d4:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8056d8:	73 07                	jae    8056e1 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  8056da:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  8056df:	eb 26                	jmp    805707 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  8056e1:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  8056e8:	ff ff ff 
+  8056eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056ef:	48 01 d0             	add    %rdx,%rax
+  8056f2:	48 c1 e8 10          	shr    $0x10,%rax
+  8056f6:	48 83 c0 01          	add    $0x1,%rax
+  8056fa:	48 c1 e0 0c          	shl    $0xc,%rax
+  8056fe:	48 f7 d8             	neg    %rax
+  805701:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  805707:	c9                   	leave
+  805708:	c3                   	ret
+
+0000000000805709 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805709:	55                   	push   %rbp
+  80570a:	48 89 e5             	mov    %rsp,%rbp
+  80570d:	48 83 ec 08          	sub    $0x8,%rsp
+  805711:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805714:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805718:	75 10                	jne    80572a <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80571a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805721:	00 00 00 
+  805724:	8b 00                	mov    (%rax),%eax
+  805726:	48 98                	cltq
+  805728:	eb 05                	jmp    80572f <vsyscall+0x26>
+  }
+  return 0;
+  80572a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80572f:	c9                   	leave
+  805730:	c3                   	ret
+
+0000000000805731 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805731:	55                   	push   %rbp
+  805732:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805735:	bf 00 00 00 00       	mov    $0x0,%edi
+  80573a:	48 b8 09 57 80 00 00 	movabs $0x805709,%rax
+  805741:	00 00 00 
+  805744:	ff d0                	call   *%rax
+}
+  805746:	5d                   	pop    %rbp
+  805747:	c3                   	ret
+
+0000000000805748 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805748:	55                   	push   %rbp
+  805749:	48 89 e5             	mov    %rsp,%rbp
+  80574c:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805750:	0f 31                	rdtsc
+  805752:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805755:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805758:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80575b:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80575e:	48 c1 e2 20          	shl    $0x20,%rdx
+  805762:	48 09 d0             	or     %rdx,%rax
+  805765:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805769:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80576d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805771:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805778:	00 00 00 
+  80577b:	8b 40 08             	mov    0x8(%rax),%eax
+  80577e:	48 98                	cltq
+  805780:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805784:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805788:	ba 00 00 00 00       	mov    $0x0,%edx
+  80578d:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805791:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80579c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057a1:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8057a5:	48 89 d0             	mov    %rdx,%rax
+  8057a8:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  8057af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8057b4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8057b8:	48 01 c8             	add    %rcx,%rax
+}
+  8057bb:	c9                   	leave
+  8057bc:	c3                   	ret
+
+00000000008057bd <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8057bd:	55                   	push   %rbp
+  8057be:	48 89 e5             	mov    %rsp,%rbp
+  8057c1:	48 83 ec 20          	sub    $0x20,%rsp
+  8057c5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8057c8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057cb:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8057ce:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8057d2:	be 01 00 00 00       	mov    $0x1,%esi
+  8057d7:	48 89 c7             	mov    %rax,%rdi
+  8057da:	48 b8 73 21 80 00 00 	movabs $0x802173,%rax
+  8057e1:	00 00 00 
+  8057e4:	ff d0                	call   *%rax
+}
+  8057e6:	90                   	nop
+  8057e7:	c9                   	leave
+  8057e8:	c3                   	ret
+
+00000000008057e9 <getchar>:
+
+int
+getchar(void) {
+  8057e9:	55                   	push   %rbp
+  8057ea:	48 89 e5             	mov    %rsp,%rbp
+  8057ed:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8057f1:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8057f5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8057fa:	48 89 c6             	mov    %rax,%rsi
+  8057fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  805802:	48 b8 dd 38 80 00 00 	movabs $0x8038dd,%rax
+  805809:	00 00 00 
+  80580c:	ff d0                	call   *%rax
+  80580e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805811:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805815:	79 05                	jns    80581c <getchar+0x33>
+    return r;
+  805817:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80581a:	eb 14                	jmp    805830 <getchar+0x47>
+  if (r < 1)
+  80581c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805820:	7f 07                	jg     805829 <getchar+0x40>
+    return -E_EOF;
+  805822:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805827:	eb 07                	jmp    805830 <getchar+0x47>
+  return c;
+  805829:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80582d:	0f b6 c0             	movzbl %al,%eax
+}
+  805830:	c9                   	leave
+  805831:	c3                   	ret
+
+0000000000805832 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805832:	55                   	push   %rbp
+  805833:	48 89 e5             	mov    %rsp,%rbp
+  805836:	48 83 ec 20          	sub    $0x20,%rsp
+  80583a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80583d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805841:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805844:	48 89 d6             	mov    %rdx,%rsi
+  805847:	89 c7                	mov    %eax,%edi
+  805849:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  805850:	00 00 00 
+  805853:	ff d0                	call   *%rax
+  805855:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805858:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80585c:	79 05                	jns    805863 <iscons+0x31>
+    return r;
+  80585e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805861:	eb 1a                	jmp    80587d <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805863:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805867:	8b 10                	mov    (%rax),%edx
+  805869:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805870:	00 00 00 
+  805873:	8b 00                	mov    (%rax),%eax
+  805875:	39 c2                	cmp    %eax,%edx
+  805877:	0f 94 c0             	sete   %al
+  80587a:	0f b6 c0             	movzbl %al,%eax
+}
+  80587d:	c9                   	leave
+  80587e:	c3                   	ret
+
+000000000080587f <opencons>:
+
+int
+opencons(void) {
+  80587f:	55                   	push   %rbp
+  805880:	48 89 e5             	mov    %rsp,%rbp
+  805883:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805887:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80588b:	48 89 c7             	mov    %rax,%rdi
+  80588e:	48 b8 9f 32 80 00 00 	movabs $0x80329f,%rax
+  805895:	00 00 00 
+  805898:	ff d0                	call   *%rax
+  80589a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80589d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058a1:	79 05                	jns    8058a8 <opencons+0x29>
+    return r;
+  8058a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058a6:	eb 66                	jmp    80590e <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8058a8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058ac:	ba 07 04 00 00       	mov    $0x407,%edx
+  8058b1:	48 89 c6             	mov    %rax,%rsi
+  8058b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058b9:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  8058c0:	00 00 00 
+  8058c3:	ff d0                	call   *%rax
+  8058c5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8058c8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058cc:	79 05                	jns    8058d3 <opencons+0x54>
+    return r;
+  8058ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058d1:	eb 3b                	jmp    80590e <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8058d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058d7:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  8058de:	00 00 00 
+  8058e1:	8b 12                	mov    (%rdx),%edx
+  8058e3:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8058e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058e9:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8058f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058f4:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8058fb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058ff:	48 89 c7             	mov    %rax,%rdi
+  805902:	48 b8 51 32 80 00 00 	movabs $0x803251,%rax
+  805909:	00 00 00 
+  80590c:	ff d0                	call   *%rax
+}
+  80590e:	c9                   	leave
+  80590f:	c3                   	ret
+
+0000000000805910 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805910:	55                   	push   %rbp
+  805911:	48 89 e5             	mov    %rsp,%rbp
+  805914:	48 83 ec 20          	sub    $0x20,%rsp
+  805918:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80591b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80591e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805922:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805925:	48 89 d6             	mov    %rdx,%rsi
+  805928:	89 c7                	mov    %eax,%edi
+  80592a:	48 b8 81 33 80 00 00 	movabs $0x803381,%rax
+  805931:	00 00 00 
+  805934:	ff d0                	call   *%rax
+  805936:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805939:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80593d:	79 05                	jns    805944 <consmode+0x34>
+    return r;
+  80593f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805942:	eb 34                	jmp    805978 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805944:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805948:	8b 10                	mov    (%rax),%edx
+  80594a:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805951:	00 00 00 
+  805954:	8b 00                	mov    (%rax),%eax
+  805956:	39 c2                	cmp    %eax,%edx
+  805958:	74 07                	je     805961 <consmode+0x51>
+    return -E_INVAL;
+  80595a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80595f:	eb 17                	jmp    805978 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805961:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805965:	8b 40 0c             	mov    0xc(%rax),%eax
+  805968:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  80596b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80596f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805972:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805975:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805978:	c9                   	leave
+  805979:	c3                   	ret
+
+000000000080597a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80597a:	55                   	push   %rbp
+  80597b:	48 89 e5             	mov    %rsp,%rbp
+  80597e:	48 83 ec 20          	sub    $0x20,%rsp
+  805982:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805986:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80598a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  80598e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805992:	8b 50 0c             	mov    0xc(%rax),%edx
+  805995:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805999:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80599d:	48 89 ce             	mov    %rcx,%rsi
+  8059a0:	48 89 c7             	mov    %rax,%rdi
+  8059a3:	48 b8 e4 26 80 00 00 	movabs $0x8026e4,%rax
+  8059aa:	00 00 00 
+  8059ad:	ff d0                	call   *%rax
+  8059af:	48 98                	cltq
+}
+  8059b1:	c9                   	leave
+  8059b2:	c3                   	ret
+
+00000000008059b3 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8059b3:	55                   	push   %rbp
+  8059b4:	48 89 e5             	mov    %rsp,%rbp
+  8059b7:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8059be:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8059c5:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8059cc:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8059d3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8059da:	eb 74                	jmp    805a50 <devcons_write+0x9d>
+    m = n - tot;
+  8059dc:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8059e3:	89 c2                	mov    %eax,%edx
+  8059e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059e8:	29 c2                	sub    %eax,%edx
+  8059ea:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8059ed:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059f0:	83 f8 7f             	cmp    $0x7f,%eax
+  8059f3:	76 07                	jbe    8059fc <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8059f5:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8059fc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059ff:	48 63 d0             	movslq %eax,%rdx
+  805a02:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a05:	48 63 c8             	movslq %eax,%rcx
+  805a08:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805a0f:	48 01 c1             	add    %rax,%rcx
+  805a12:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805a19:	48 89 ce             	mov    %rcx,%rsi
+  805a1c:	48 89 c7             	mov    %rax,%rdi
+  805a1f:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  805a26:	00 00 00 
+  805a29:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805a2b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a2e:	48 63 d0             	movslq %eax,%rdx
+  805a31:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805a38:	48 89 d6             	mov    %rdx,%rsi
+  805a3b:	48 89 c7             	mov    %rax,%rdi
+  805a3e:	48 b8 73 21 80 00 00 	movabs $0x802173,%rax
+  805a45:	00 00 00 
+  805a48:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805a4a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a4d:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805a50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a53:	48 98                	cltq
+  805a55:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805a5c:	0f 82 7a ff ff ff    	jb     8059dc <devcons_write+0x29>
+  }
+  return tot;
+  805a62:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a65:	48 98                	cltq
+}
+  805a67:	c9                   	leave
+  805a68:	c3                   	ret
+
+0000000000805a69 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805a69:	55                   	push   %rbp
+  805a6a:	48 89 e5             	mov    %rsp,%rbp
+  805a6d:	48 83 ec 08          	sub    $0x8,%rsp
+  805a71:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805a75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a7a:	c9                   	leave
+  805a7b:	c3                   	ret
+
+0000000000805a7c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805a7c:	55                   	push   %rbp
+  805a7d:	48 89 e5             	mov    %rsp,%rbp
+  805a80:	48 83 ec 10          	sub    $0x10,%rsp
+  805a84:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a88:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805a8c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a90:	48 ba ad 6e 80 00 00 	movabs $0x806ead,%rdx
+  805a97:	00 00 00 
+  805a9a:	48 89 d6             	mov    %rdx,%rsi
+  805a9d:	48 89 c7             	mov    %rax,%rdi
+  805aa0:	48 b8 bc 15 80 00 00 	movabs $0x8015bc,%rax
+  805aa7:	00 00 00 
+  805aaa:	ff d0                	call   *%rax
+  return 0;
+  805aac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805ab1:	c9                   	leave
+  805ab2:	c3                   	ret
+
+0000000000805ab3 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805ab3:	55                   	push   %rbp
+  805ab4:	48 89 e5             	mov    %rsp,%rbp
+  805ab7:	48 83 ec 30          	sub    $0x30,%rsp
+  805abb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805abf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805ac2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805ac6:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805acd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805ad0:	83 e0 02             	and    $0x2,%eax
+  805ad3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805ad6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ada:	8b 40 0c             	mov    0xc(%rax),%eax
+  805add:	83 f8 01             	cmp    $0x1,%eax
+  805ae0:	75 04                	jne    805ae6 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805ae2:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805ae6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805ae9:	83 e0 01             	and    $0x1,%eax
+  805aec:	85 c0                	test   %eax,%eax
+  805aee:	74 44                	je     805b34 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805af0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805af3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805af8:	89 c2                	mov    %eax,%edx
+  805afa:	be 00 00 00 00       	mov    $0x0,%esi
+  805aff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b04:	48 b8 d2 27 80 00 00 	movabs $0x8027d2,%rax
+  805b0b:	00 00 00 
+  805b0e:	ff d0                	call   *%rax
+  805b10:	83 f8 01             	cmp    $0x1,%eax
+  805b13:	75 06                	jne    805b1b <devcons_poll+0x68>
+      revents |= POLLIN;
+  805b15:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805b19:	eb 19                	jmp    805b34 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805b1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b1f:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805b25:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805b28:	89 c2                	mov    %eax,%edx
+  805b2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b2e:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805b34:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805b37:	c9                   	leave
+  805b38:	c3                   	ret
+
+0000000000805b39 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805b39:	55                   	push   %rbp
+  805b3a:	48 89 e5             	mov    %rsp,%rbp
+  805b3d:	48 83 ec 20          	sub    $0x20,%rsp
+  805b41:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805b45:	48 b8 11 23 80 00 00 	movabs $0x802311,%rax
+  805b4c:	00 00 00 
+  805b4f:	ff d0                	call   *%rax
+  805b51:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805b54:	48 b8 40 91 80 00 00 	movabs $0x809140,%rax
+  805b5b:	00 00 00 
+  805b5e:	48 8b 00             	mov    (%rax),%rax
+  805b61:	48 85 c0             	test   %rax,%rax
+  805b64:	75 62                	jne    805bc8 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805b66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b69:	ba 07 00 00 00       	mov    $0x7,%edx
+  805b6e:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805b75:	00 00 00 
+  805b78:	48 89 ce             	mov    %rcx,%rsi
+  805b7b:	89 c7                	mov    %eax,%edi
+  805b7d:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  805b84:	00 00 00 
+  805b87:	ff d0                	call   *%rax
+  805b89:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805b8c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805b90:	79 36                	jns    805bc8 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805b92:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805b95:	89 c1                	mov    %eax,%ecx
+  805b97:	48 b8 b4 6e 80 00 00 	movabs $0x806eb4,%rax
+  805b9e:	00 00 00 
+  805ba1:	48 89 c2             	mov    %rax,%rdx
+  805ba4:	be 23 00 00 00       	mov    $0x23,%esi
+  805ba9:	48 b8 cc 6e 80 00 00 	movabs $0x806ecc,%rax
+  805bb0:	00 00 00 
+  805bb3:	48 89 c7             	mov    %rax,%rdi
+  805bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bbb:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  805bc2:	00 00 00 
+  805bc5:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  805bc8:	48 ba 40 91 80 00 00 	movabs $0x809140,%rdx
+  805bcf:	00 00 00 
+  805bd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bd6:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  805bd9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bdc:	48 ba 39 5c 80 00 00 	movabs $0x805c39,%rdx
+  805be3:	00 00 00 
+  805be6:	48 89 d6             	mov    %rdx,%rsi
+  805be9:	89 c7                	mov    %eax,%edi
+  805beb:	48 b8 27 25 80 00 00 	movabs $0x802527,%rax
+  805bf2:	00 00 00 
+  805bf5:	ff d0                	call   *%rax
+  805bf7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  805bfa:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805bfe:	79 36                	jns    805c36 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  805c00:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805c03:	89 c1                	mov    %eax,%ecx
+  805c05:	48 b8 b4 6e 80 00 00 	movabs $0x806eb4,%rax
+  805c0c:	00 00 00 
+  805c0f:	48 89 c2             	mov    %rax,%rdx
+  805c12:	be 2b 00 00 00       	mov    $0x2b,%esi
+  805c17:	48 b8 cc 6e 80 00 00 	movabs $0x806ecc,%rax
+  805c1e:	00 00 00 
+  805c21:	48 89 c7             	mov    %rax,%rdi
+  805c24:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c29:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  805c30:	00 00 00 
+  805c33:	41 ff d0             	call   *%r8
+}
+  805c36:	90                   	nop
+  805c37:	c9                   	leave
+  805c38:	c3                   	ret
+
+0000000000805c39 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  805c39:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  805c3c:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  805c3f:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  805c46:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  805c4a:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  805c4f:	48 a1 40 91 80 00 00 	movabs 0x809140,%rax
+  805c56:	00 00 00 
+	call *%rax
+  805c59:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  805c5b:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  805c60:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  805c63:	41 5f                	pop    %r15
+	popq %r15
+  805c65:	41 5f                	pop    %r15
+	popq %r15
+  805c67:	41 5f                	pop    %r15
+	popq %r14
+  805c69:	41 5e                	pop    %r14
+	popq %r13
+  805c6b:	41 5d                	pop    %r13
+	popq %r12
+  805c6d:	41 5c                	pop    %r12
+	popq %r11
+  805c6f:	41 5b                	pop    %r11
+	popq %r10
+  805c71:	41 5a                	pop    %r10
+	popq %r9
+  805c73:	41 59                	pop    %r9
+	popq %r8
+  805c75:	41 58                	pop    %r8
+	popq %rsi
+  805c77:	5e                   	pop    %rsi
+	popq %rdi
+  805c78:	5f                   	pop    %rdi
+	popq %rbp
+  805c79:	5d                   	pop    %rbp
+	popq %rdx
+  805c7a:	5a                   	pop    %rdx
+	popq %rcx
+  805c7b:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  805c7c:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805c81:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805c86:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805c8a:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805c8d:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  805c92:	5b                   	pop    %rbx
+	popq %rax
+  805c93:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  805c94:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805c98:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  805c99:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  805c9e:	c3                   	ret
+
+0000000000805c9f <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805c9f:	55                   	push   %rbp
+  805ca0:	48 89 e5             	mov    %rsp,%rbp
+  805ca3:	48 83 ec 20          	sub    $0x20,%rsp
+  805ca7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805cab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805caf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805cb3:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805cb7:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805cbb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805cbf:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805cc6:	48 89 c7             	mov    %rax,%rdi
+  805cc9:	48 b8 d7 5c 80 00 00 	movabs $0x805cd7,%rax
+  805cd0:	00 00 00 
+  805cd3:	ff d0                	call   *%rax
+}
+  805cd5:	c9                   	leave
+  805cd6:	c3                   	ret
+
+0000000000805cd7 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805cd7:	55                   	push   %rbp
+  805cd8:	48 89 e5             	mov    %rsp,%rbp
+  805cdb:	48 83 ec 30          	sub    $0x30,%rsp
+  805cdf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805ce3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805ce7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805ceb:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805cef:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805cf4:	75 0e                	jne    805d04 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805cf6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805cfd:	00 00 00 
+  805d00:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805d04:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805d09:	75 18                	jne    805d23 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805d0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d0f:	48 89 c7             	mov    %rax,%rdi
+  805d12:	48 b8 ca 25 80 00 00 	movabs $0x8025ca,%rax
+  805d19:	00 00 00 
+  805d1c:	ff d0                	call   *%rax
+  805d1e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805d21:	eb 1d                	jmp    805d40 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805d23:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805d27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805d2b:	48 89 d6             	mov    %rdx,%rsi
+  805d2e:	48 89 c7             	mov    %rax,%rdi
+  805d31:	48 b8 10 26 80 00 00 	movabs $0x802610,%rax
+  805d38:	00 00 00 
+  805d3b:	ff d0                	call   *%rax
+  805d3d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805d40:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d44:	79 2a                	jns    805d70 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805d46:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805d4b:	74 0a                	je     805d57 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805d4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d51:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805d57:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805d5c:	74 0a                	je     805d68 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805d5e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d62:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805d68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d6b:	e9 aa 00 00 00       	jmp    805e1a <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805d70:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805d75:	74 36                	je     805dad <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805d77:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d7e:	00 00 00 
+  805d81:	8b 40 04             	mov    0x4(%rax),%eax
+  805d84:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805d89:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d90:	00 00 00 
+  805d93:	48 98                	cltq
+  805d95:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d9c:	48 01 d0             	add    %rdx,%rax
+  805d9f:	48 05 24 01 00 00    	add    $0x124,%rax
+  805da5:	8b 10                	mov    (%rax),%edx
+  805da7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dab:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805dad:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805db2:	74 36                	je     805dea <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805db4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805dbb:	00 00 00 
+  805dbe:	8b 40 04             	mov    0x4(%rax),%eax
+  805dc1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805dc6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805dcd:	00 00 00 
+  805dd0:	48 98                	cltq
+  805dd2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805dd9:	48 01 d0             	add    %rdx,%rax
+  805ddc:	48 05 28 01 00 00    	add    $0x128,%rax
+  805de2:	8b 10                	mov    (%rax),%edx
+  805de4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805de8:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805dea:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805df1:	00 00 00 
+  805df4:	8b 40 04             	mov    0x4(%rax),%eax
+  805df7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805dfc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805e03:	00 00 00 
+  805e06:	48 98                	cltq
+  805e08:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805e0f:	48 01 d0             	add    %rdx,%rax
+  805e12:	48 05 20 01 00 00    	add    $0x120,%rax
+  805e18:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805e1a:	c9                   	leave
+  805e1b:	c3                   	ret
+
+0000000000805e1c <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805e1c:	55                   	push   %rbp
+  805e1d:	48 89 e5             	mov    %rsp,%rbp
+  805e20:	48 83 ec 30          	sub    $0x30,%rsp
+  805e24:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805e27:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805e2a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805e2e:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805e31:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805e36:	75 5e                	jne    805e96 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805e38:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805e3f:	00 00 00 
+  805e42:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805e46:	eb 4e                	jmp    805e96 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805e48:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e4c:	79 3c                	jns    805e8a <ipc_send+0x6e>
+  805e4e:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805e52:	74 36                	je     805e8a <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805e54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e57:	89 c1                	mov    %eax,%ecx
+  805e59:	48 b8 e0 6e 80 00 00 	movabs $0x806ee0,%rax
+  805e60:	00 00 00 
+  805e63:	48 89 c2             	mov    %rax,%rdx
+  805e66:	be 54 00 00 00       	mov    $0x54,%esi
+  805e6b:	48 b8 06 6f 80 00 00 	movabs $0x806f06,%rax
+  805e72:	00 00 00 
+  805e75:	48 89 c7             	mov    %rax,%rdi
+  805e78:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e7d:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  805e84:	00 00 00 
+  805e87:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805e8a:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  805e91:	00 00 00 
+  805e94:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805e96:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805e99:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805e9c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ea0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ea3:	89 c7                	mov    %eax,%edi
+  805ea5:	48 b8 73 25 80 00 00 	movabs $0x802573,%rax
+  805eac:	00 00 00 
+  805eaf:	ff d0                	call   *%rax
+  805eb1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805eb4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805eb8:	75 8e                	jne    805e48 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805eba:	48 b8 4d 23 80 00 00 	movabs $0x80234d,%rax
+  805ec1:	00 00 00 
+  805ec4:	ff d0                	call   *%rax
+}
+  805ec6:	90                   	nop
+  805ec7:	c9                   	leave
+  805ec8:	c3                   	ret
+
+0000000000805ec9 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805ec9:	55                   	push   %rbp
+  805eca:	48 89 e5             	mov    %rsp,%rbp
+  805ecd:	48 83 ec 18          	sub    $0x18,%rsp
+  805ed1:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805ed4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805edb:	eb 4d                	jmp    805f2a <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805edd:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805ee4:	00 00 00 
+  805ee7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805eea:	48 98                	cltq
+  805eec:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ef3:	48 01 d0             	add    %rdx,%rax
+  805ef6:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805efc:	8b 00                	mov    (%rax),%eax
+  805efe:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805f01:	75 23                	jne    805f26 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805f03:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805f0a:	00 00 00 
+  805f0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f10:	48 98                	cltq
+  805f12:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805f19:	48 01 d0             	add    %rdx,%rax
+  805f1c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805f22:	8b 00                	mov    (%rax),%eax
+  805f24:	eb 12                	jmp    805f38 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805f26:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805f2a:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805f31:	7e aa                	jle    805edd <ipc_find_env+0x14>
+  return 0;
+  805f33:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f38:	c9                   	leave
+  805f39:	c3                   	ret
+
+0000000000805f3a <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805f3a:	55                   	push   %rbp
+  805f3b:	48 89 e5             	mov    %rsp,%rbp
+  805f3e:	48 83 ec 18          	sub    $0x18,%rsp
+  805f42:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805f46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f4a:	48 c1 e8 27          	shr    $0x27,%rax
+  805f4e:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805f53:	48 89 c2             	mov    %rax,%rdx
+  805f56:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805f5d:	01 00 00 
+  805f60:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f64:	83 e0 01             	and    $0x1,%eax
+  805f67:	48 85 c0             	test   %rax,%rax
+  805f6a:	74 63                	je     805fcf <pageref+0x95>
+  805f6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f70:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805f74:	48 89 c2             	mov    %rax,%rdx
+  805f77:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805f7e:	01 00 00 
+  805f81:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805f85:	83 e0 01             	and    $0x1,%eax
+  805f88:	48 85 c0             	test   %rax,%rax
+  805f8b:	74 42                	je     805fcf <pageref+0x95>
+  805f8d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f91:	48 c1 e8 15          	shr    $0x15,%rax
+  805f95:	48 89 c2             	mov    %rax,%rdx
+  805f98:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805f9f:	01 00 00 
+  805fa2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805fa6:	83 e0 01             	and    $0x1,%eax
+  805fa9:	48 85 c0             	test   %rax,%rax
+  805fac:	74 21                	je     805fcf <pageref+0x95>
+  805fae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fb2:	48 c1 e8 0c          	shr    $0xc,%rax
+  805fb6:	48 89 c2             	mov    %rax,%rdx
+  805fb9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805fc0:	01 00 00 
+  805fc3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805fc7:	83 e0 01             	and    $0x1,%eax
+  805fca:	48 85 c0             	test   %rax,%rax
+  805fcd:	75 07                	jne    805fd6 <pageref+0x9c>
+    return 0;
+  805fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fd4:	eb 53                	jmp    806029 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805fd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805fda:	48 c1 e8 0c          	shr    $0xc,%rax
+  805fde:	48 89 c2             	mov    %rax,%rdx
+  805fe1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805fe8:	01 00 00 
+  805feb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805fef:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805ff3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ff7:	83 e0 01             	and    $0x1,%eax
+  805ffa:	48 85 c0             	test   %rax,%rax
+  805ffd:	75 07                	jne    806006 <pageref+0xcc>
+    return 0;
+  805fff:	b8 00 00 00 00       	mov    $0x0,%eax
+  806004:	eb 23                	jmp    806029 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  806006:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80600a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80600e:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  806015:	00 00 00 
+  806018:	48 c1 e0 04          	shl    $0x4,%rax
+  80601c:	48 01 d0             	add    %rdx,%rax
+  80601f:	48 83 c0 08          	add    $0x8,%rax
+  806023:	0f b7 00             	movzwl (%rax),%eax
+  806026:	0f b7 c0             	movzwl %ax,%eax
+}
+  806029:	c9                   	leave
+  80602a:	c3                   	ret
+
+000000000080602b <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  80602b:	55                   	push   %rbp
+  80602c:	48 89 e5             	mov    %rsp,%rbp
+  80602f:	48 83 ec 10          	sub    $0x10,%rsp
+  806033:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  806036:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806039:	be 00 00 00 00       	mov    $0x0,%esi
+  80603e:	89 c7                	mov    %eax,%edi
+  806040:	48 b8 4f 60 80 00 00 	movabs $0x80604f,%rax
+  806047:	00 00 00 
+  80604a:	ff d0                	call   *%rax
+}
+  80604c:	90                   	nop
+  80604d:	c9                   	leave
+  80604e:	c3                   	ret
+
+000000000080604f <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  80604f:	55                   	push   %rbp
+  806050:	48 89 e5             	mov    %rsp,%rbp
+  806053:	48 83 ec 10          	sub    $0x10,%rsp
+  806057:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80605a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  80605e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806062:	75 3e                	jne    8060a2 <waitpid+0x53>
+  806064:	48 b8 10 6f 80 00 00 	movabs $0x806f10,%rax
+  80606b:	00 00 00 
+  80606e:	48 89 c1             	mov    %rax,%rcx
+  806071:	48 b8 1b 6f 80 00 00 	movabs $0x806f1b,%rax
+  806078:	00 00 00 
+  80607b:	48 89 c2             	mov    %rax,%rdx
+  80607e:	be 0e 00 00 00       	mov    $0xe,%esi
+  806083:	48 b8 30 6f 80 00 00 	movabs $0x806f30,%rax
+  80608a:	00 00 00 
+  80608d:	48 89 c7             	mov    %rax,%rdi
+  806090:	b8 00 00 00 00       	mov    $0x0,%eax
+  806095:	49 b8 ed 03 80 00 00 	movabs $0x8003ed,%r8
+  80609c:	00 00 00 
+  80609f:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  8060a2:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8060a7:	74 0a                	je     8060b3 <waitpid+0x64>
+    *status = 0;
+  8060a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8060ad:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  8060b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8060b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060ba:	48 89 d6             	mov    %rdx,%rsi
+  8060bd:	89 c7                	mov    %eax,%edi
+  8060bf:	48 b8 89 22 80 00 00 	movabs $0x802289,%rax
+  8060c6:	00 00 00 
+  8060c9:	ff d0                	call   *%rax
+}
+  8060cb:	c9                   	leave
+  8060cc:	c3                   	ret
+
+00000000008060cd <xchg>:
+  8060cd:	55                   	push   %rbp
+  8060ce:	48 89 e5             	mov    %rsp,%rbp
+  8060d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8060d5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060d9:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8060dc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8060e0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8060e3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8060e7:	f0 87 02             	lock xchg %eax,(%rdx)
+  8060ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8060ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060f0:	c9                   	leave
+  8060f1:	c3                   	ret
+
+00000000008060f2 <cmpxchg>:
+  8060f2:	55                   	push   %rbp
+  8060f3:	48 89 e5             	mov    %rsp,%rbp
+  8060f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8060fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8060fe:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806101:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  806104:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  806108:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80610b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80610e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806112:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  806116:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806119:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80611c:	c9                   	leave
+  80611d:	c3                   	ret
+
+000000000080611e <xadd>:
+  80611e:	55                   	push   %rbp
+  80611f:	48 89 e5             	mov    %rsp,%rbp
+  806122:	48 83 ec 10          	sub    $0x10,%rsp
+  806126:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80612a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80612d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  806131:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806134:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806138:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  80613c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80613f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806142:	c9                   	leave
+  806143:	c3                   	ret
+
+0000000000806144 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  806144:	55                   	push   %rbp
+  806145:	48 89 e5             	mov    %rsp,%rbp
+  806148:	48 83 ec 08          	sub    $0x8,%rsp
+  80614c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  806150:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806154:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80615a:	90                   	nop
+  80615b:	c9                   	leave
+  80615c:	c3                   	ret
+
+000000000080615d <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  80615d:	55                   	push   %rbp
+  80615e:	48 89 e5             	mov    %rsp,%rbp
+  806161:	48 83 ec 20          	sub    $0x20,%rsp
+  806165:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  806169:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80616d:	ba 01 00 00 00       	mov    $0x1,%edx
+  806172:	be 00 00 00 00       	mov    $0x0,%esi
+  806177:	48 89 c7             	mov    %rax,%rdi
+  80617a:	48 b8 f2 60 80 00 00 	movabs $0x8060f2,%rax
+  806181:	00 00 00 
+  806184:	ff d0                	call   *%rax
+  806186:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806189:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80618d:	74 65                	je     8061f4 <mutex_lock+0x97>
+  if (c != 2)
+  80618f:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  806193:	74 57                	je     8061ec <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  806195:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806199:	be 02 00 00 00       	mov    $0x2,%esi
+  80619e:	48 89 c7             	mov    %rax,%rdi
+  8061a1:	48 b8 cd 60 80 00 00 	movabs $0x8060cd,%rax
+  8061a8:	00 00 00 
+  8061ab:	ff d0                	call   *%rax
+  8061ad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8061b0:	eb 3a                	jmp    8061ec <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8061b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061b6:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8061bd:	be 02 00 00 00       	mov    $0x2,%esi
+  8061c2:	48 89 c7             	mov    %rax,%rdi
+  8061c5:	48 b8 36 27 80 00 00 	movabs $0x802736,%rax
+  8061cc:	00 00 00 
+  8061cf:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8061d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061d5:	be 02 00 00 00       	mov    $0x2,%esi
+  8061da:	48 89 c7             	mov    %rax,%rdi
+  8061dd:	48 b8 cd 60 80 00 00 	movabs $0x8060cd,%rax
+  8061e4:	00 00 00 
+  8061e7:	ff d0                	call   *%rax
+  8061e9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8061ec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8061f0:	75 c0                	jne    8061b2 <mutex_lock+0x55>
+  8061f2:	eb 01                	jmp    8061f5 <mutex_lock+0x98>
+    return;
+  8061f4:	90                   	nop
+}
+  8061f5:	c9                   	leave
+  8061f6:	c3                   	ret
+
+00000000008061f7 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  8061f7:	55                   	push   %rbp
+  8061f8:	48 89 e5             	mov    %rsp,%rbp
+  8061fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8061ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  806203:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806207:	ba 01 00 00 00       	mov    $0x1,%edx
+  80620c:	be 00 00 00 00       	mov    $0x0,%esi
+  806211:	48 89 c7             	mov    %rax,%rdi
+  806214:	48 b8 f2 60 80 00 00 	movabs $0x8060f2,%rax
+  80621b:	00 00 00 
+  80621e:	ff d0                	call   *%rax
+  806220:	85 c0                	test   %eax,%eax
+  806222:	75 07                	jne    80622b <mutex_trylock+0x34>
+  806224:	b8 00 00 00 00       	mov    $0x0,%eax
+  806229:	eb 05                	jmp    806230 <mutex_trylock+0x39>
+  80622b:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806230:	c9                   	leave
+  806231:	c3                   	ret
+
+0000000000806232 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806232:	55                   	push   %rbp
+  806233:	48 89 e5             	mov    %rsp,%rbp
+  806236:	48 83 ec 10          	sub    $0x10,%rsp
+  80623a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  80623e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806242:	be 00 00 00 00       	mov    $0x0,%esi
+  806247:	48 89 c7             	mov    %rax,%rdi
+  80624a:	48 b8 cd 60 80 00 00 	movabs $0x8060cd,%rax
+  806251:	00 00 00 
+  806254:	ff d0                	call   *%rax
+  806256:	83 f8 02             	cmp    $0x2,%eax
+  806259:	75 18                	jne    806273 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  80625b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80625f:	be 01 00 00 00       	mov    $0x1,%esi
+  806264:	48 89 c7             	mov    %rax,%rdi
+  806267:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  80626e:	00 00 00 
+  806271:	ff d0                	call   *%rax
+}
+  806273:	90                   	nop
+  806274:	c9                   	leave
+  806275:	c3                   	ret
+
+0000000000806276 <cond_init>:
+cond_init(struct Cond *c) {
+  806276:	55                   	push   %rbp
+  806277:	48 89 e5             	mov    %rsp,%rbp
+  80627a:	48 83 ec 08          	sub    $0x8,%rsp
+  80627e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806282:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806286:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80628c:	90                   	nop
+  80628d:	c9                   	leave
+  80628e:	c3                   	ret
+
+000000000080628f <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  80628f:	55                   	push   %rbp
+  806290:	48 89 e5             	mov    %rsp,%rbp
+  806293:	48 83 ec 30          	sub    $0x30,%rsp
+  806297:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80629b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80629f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8062a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062a7:	8b 00                	mov    (%rax),%eax
+  8062a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8062ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062b0:	48 89 c7             	mov    %rax,%rdi
+  8062b3:	48 b8 32 62 80 00 00 	movabs $0x806232,%rax
+  8062ba:	00 00 00 
+  8062bd:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8062bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062c3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8062c7:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8062ca:	89 ce                	mov    %ecx,%esi
+  8062cc:	48 89 c7             	mov    %rax,%rdi
+  8062cf:	48 b8 36 27 80 00 00 	movabs $0x802736,%rax
+  8062d6:	00 00 00 
+  8062d9:	ff d0                	call   *%rax
+  8062db:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8062de:	eb 1f                	jmp    8062ff <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8062e0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062e4:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8062eb:	be 02 00 00 00       	mov    $0x2,%esi
+  8062f0:	48 89 c7             	mov    %rax,%rdi
+  8062f3:	48 b8 36 27 80 00 00 	movabs $0x802736,%rax
+  8062fa:	00 00 00 
+  8062fd:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  8062ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806303:	be 02 00 00 00       	mov    $0x2,%esi
+  806308:	48 89 c7             	mov    %rax,%rdi
+  80630b:	48 b8 cd 60 80 00 00 	movabs $0x8060cd,%rax
+  806312:	00 00 00 
+  806315:	ff d0                	call   *%rax
+  806317:	85 c0                	test   %eax,%eax
+  806319:	75 c5                	jne    8062e0 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  80631b:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  80631f:	75 07                	jne    806328 <cond_timedwait+0x99>
+  806321:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806326:	eb 05                	jmp    80632d <cond_timedwait+0x9e>
+  806328:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80632d:	c9                   	leave
+  80632e:	c3                   	ret
+
+000000000080632f <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  80632f:	55                   	push   %rbp
+  806330:	48 89 e5             	mov    %rsp,%rbp
+  806333:	48 83 ec 10          	sub    $0x10,%rsp
+  806337:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80633b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  80633f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806343:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806347:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80634e:	48 89 ce             	mov    %rcx,%rsi
+  806351:	48 89 c7             	mov    %rax,%rdi
+  806354:	48 b8 8f 62 80 00 00 	movabs $0x80628f,%rax
+  80635b:	00 00 00 
+  80635e:	ff d0                	call   *%rax
+}
+  806360:	90                   	nop
+  806361:	c9                   	leave
+  806362:	c3                   	ret
+
+0000000000806363 <cond_signal>:
+cond_signal(struct Cond *c) {
+  806363:	55                   	push   %rbp
+  806364:	48 89 e5             	mov    %rsp,%rbp
+  806367:	48 83 ec 10          	sub    $0x10,%rsp
+  80636b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80636f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806373:	be 01 00 00 00       	mov    $0x1,%esi
+  806378:	48 89 c7             	mov    %rax,%rdi
+  80637b:	48 b8 1e 61 80 00 00 	movabs $0x80611e,%rax
+  806382:	00 00 00 
+  806385:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  806387:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80638b:	be 01 00 00 00       	mov    $0x1,%esi
+  806390:	48 89 c7             	mov    %rax,%rdi
+  806393:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  80639a:	00 00 00 
+  80639d:	ff d0                	call   *%rax
+}
+  80639f:	90                   	nop
+  8063a0:	c9                   	leave
+  8063a1:	c3                   	ret
+
+00000000008063a2 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8063a2:	55                   	push   %rbp
+  8063a3:	48 89 e5             	mov    %rsp,%rbp
+  8063a6:	48 83 ec 10          	sub    $0x10,%rsp
+  8063aa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8063ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8063b7:	48 89 c7             	mov    %rax,%rdi
+  8063ba:	48 b8 1e 61 80 00 00 	movabs $0x80611e,%rax
+  8063c1:	00 00 00 
+  8063c4:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8063c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063ca:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8063cf:	48 89 c7             	mov    %rax,%rdi
+  8063d2:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  8063d9:	00 00 00 
+  8063dc:	ff d0                	call   *%rax
+}
+  8063de:	90                   	nop
+  8063df:	c9                   	leave
+  8063e0:	c3                   	ret
+
+00000000008063e1 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8063e1:	55                   	push   %rbp
+  8063e2:	48 89 e5             	mov    %rsp,%rbp
+  8063e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8063e9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8063ed:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8063f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063f4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8063f7:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8063f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063fd:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  806404:	90                   	nop
+  806405:	c9                   	leave
+  806406:	c3                   	ret
+
+0000000000806407 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  806407:	55                   	push   %rbp
+  806408:	48 89 e5             	mov    %rsp,%rbp
+  80640b:	48 83 ec 18          	sub    $0x18,%rsp
+  80640f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  806413:	eb 2a                	jmp    80643f <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  806415:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806418:	8d 50 ff             	lea    -0x1(%rax),%edx
+  80641b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80641f:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806422:	89 ce                	mov    %ecx,%esi
+  806424:	48 89 c7             	mov    %rax,%rdi
+  806427:	48 b8 f2 60 80 00 00 	movabs $0x8060f2,%rax
+  80642e:	00 00 00 
+  806431:	ff d0                	call   *%rax
+  806433:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806436:	75 07                	jne    80643f <sem_trywait+0x38>
+      return 0;
+  806438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80643d:	eb 14                	jmp    806453 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  80643f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806443:	8b 00                	mov    (%rax),%eax
+  806445:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806448:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80644c:	75 c7                	jne    806415 <sem_trywait+0xe>
+  return -E_BUSY;
+  80644e:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806453:	c9                   	leave
+  806454:	c3                   	ret
+
+0000000000806455 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  806455:	55                   	push   %rbp
+  806456:	48 89 e5             	mov    %rsp,%rbp
+  806459:	48 83 ec 30          	sub    $0x30,%rsp
+  80645d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  806461:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  806465:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80646c:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  80646d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  806472:	0f 84 fb 00 00 00    	je     806573 <sem_timedwait+0x11e>
+  806478:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80647d:	0f 84 f0 00 00 00    	je     806573 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  806483:	48 b8 48 57 80 00 00 	movabs $0x805748,%rax
+  80648a:	00 00 00 
+  80648d:	ff d0                	call   *%rax
+  80648f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  806493:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806497:	48 f7 d0             	not    %rax
+  80649a:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  80649e:	73 0d                	jae    8064ad <sem_timedwait+0x58>
+  8064a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8064a4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8064a8:	48 01 d0             	add    %rdx,%rax
+  8064ab:	eb 07                	jmp    8064b4 <sem_timedwait+0x5f>
+  8064ad:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8064b4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8064b8:	e9 b6 00 00 00       	jmp    806573 <sem_timedwait+0x11e>
+    if (deadline) {
+  8064bd:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8064c2:	74 2d                	je     8064f1 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8064c4:	48 b8 48 57 80 00 00 	movabs $0x805748,%rax
+  8064cb:	00 00 00 
+  8064ce:	ff d0                	call   *%rax
+  8064d0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8064d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8064d8:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8064dc:	73 0a                	jae    8064e8 <sem_timedwait+0x93>
+  8064de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064e2:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8064e6:	eb 05                	jmp    8064ed <sem_timedwait+0x98>
+  8064e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064ed:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8064f1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8064f5:	48 83 c0 04          	add    $0x4,%rax
+  8064f9:	be 01 00 00 00       	mov    $0x1,%esi
+  8064fe:	48 89 c7             	mov    %rax,%rdi
+  806501:	48 b8 1e 61 80 00 00 	movabs $0x80611e,%rax
+  806508:	00 00 00 
+  80650b:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  80650d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806511:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806515:	be 00 00 00 00       	mov    $0x0,%esi
+  80651a:	48 89 c7             	mov    %rax,%rdi
+  80651d:	48 b8 36 27 80 00 00 	movabs $0x802736,%rax
+  806524:	00 00 00 
+  806527:	ff d0                	call   *%rax
+  806529:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  80652c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806530:	48 83 c0 04          	add    $0x4,%rax
+  806534:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806539:	48 89 c7             	mov    %rax,%rdi
+  80653c:	48 b8 1e 61 80 00 00 	movabs $0x80611e,%rax
+  806543:	00 00 00 
+  806546:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806548:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  80654c:	75 25                	jne    806573 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  80654e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806552:	48 89 c7             	mov    %rax,%rdi
+  806555:	48 b8 07 64 80 00 00 	movabs $0x806407,%rax
+  80655c:	00 00 00 
+  80655f:	ff d0                	call   *%rax
+  806561:	85 c0                	test   %eax,%eax
+  806563:	79 07                	jns    80656c <sem_timedwait+0x117>
+  806565:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80656a:	eb 27                	jmp    806593 <sem_timedwait+0x13e>
+  80656c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806571:	eb 20                	jmp    806593 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  806573:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806577:	48 89 c7             	mov    %rax,%rdi
+  80657a:	48 b8 07 64 80 00 00 	movabs $0x806407,%rax
+  806581:	00 00 00 
+  806584:	ff d0                	call   *%rax
+  806586:	85 c0                	test   %eax,%eax
+  806588:	0f 88 2f ff ff ff    	js     8064bd <sem_timedwait+0x68>
+  return 0;
+  80658e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806593:	c9                   	leave
+  806594:	c3                   	ret
+
+0000000000806595 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  806595:	55                   	push   %rbp
+  806596:	48 89 e5             	mov    %rsp,%rbp
+  806599:	48 83 ec 10          	sub    $0x10,%rsp
+  80659d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8065a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065a5:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8065ac:	48 89 c7             	mov    %rax,%rdi
+  8065af:	48 b8 55 64 80 00 00 	movabs $0x806455,%rax
+  8065b6:	00 00 00 
+  8065b9:	ff d0                	call   *%rax
+}
+  8065bb:	90                   	nop
+  8065bc:	c9                   	leave
+  8065bd:	c3                   	ret
+
+00000000008065be <sem_post>:
+sem_post(struct Semaphore *s) {
+  8065be:	55                   	push   %rbp
+  8065bf:	48 89 e5             	mov    %rsp,%rbp
+  8065c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8065c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8065ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8065d3:	48 89 c7             	mov    %rax,%rdi
+  8065d6:	48 b8 1e 61 80 00 00 	movabs $0x80611e,%rax
+  8065dd:	00 00 00 
+  8065e0:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8065e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065e6:	8b 40 04             	mov    0x4(%rax),%eax
+  8065e9:	85 c0                	test   %eax,%eax
+  8065eb:	74 18                	je     806605 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  8065ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065f1:	be 01 00 00 00       	mov    $0x1,%esi
+  8065f6:	48 89 c7             	mov    %rax,%rdi
+  8065f9:	48 b8 85 27 80 00 00 	movabs $0x802785,%rax
+  806600:	00 00 00 
+  806603:	ff d0                	call   *%rax
+}
+  806605:	90                   	nop
+  806606:	c9                   	leave
+  806607:	c3                   	ret
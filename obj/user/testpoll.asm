@@ -0,0 +1,10311 @@
+
+obj/user/testpoll:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 34 04 00 00       	call   800460 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 50          	sub    $0x50,%rsp
+  80003a:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  80003d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  struct pollfd fds[2];
+  char buf[16];
+  int r, pid, p[2];
+
+  if ((r = pipe(p)) < 0)
+  800041:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  800045:	48 89 c7             	mov    %rax,%rdi
+  800048:	48 b8 32 4b 80 00 00 	movabs $0x804b32,%rax
+  80004f:	00 00 00 
+  800052:	ff d0                	call   *%rax
+  800054:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800057:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80005b:	79 36                	jns    800093 <umain+0x61>
+    panic("pipe: %i", r);
+  80005d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800060:	89 c1                	mov    %eax,%ecx
+  800062:	48 b8 40 67 80 00 00 	movabs $0x806740,%rax
+  800069:	00 00 00 
+  80006c:	48 89 c2             	mov    %rax,%rdx
+  80006f:	be 0a 00 00 00       	mov    $0xa,%esi
+  800074:	48 b8 49 67 80 00 00 	movabs $0x806749,%rax
+  80007b:	00 00 00 
+  80007e:	48 89 c7             	mov    %rax,%rdi
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  80008d:	00 00 00 
+  800090:	41 ff d0             	call   *%r8
+
+  fds[0].fd     = p[0];
+  800093:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800096:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  fds[0].events = POLLIN;
+  800099:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%rbp)
+  if ((r = poll(fds, 1, 0)) != 0)
+  8000a0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8000a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8000ae:	48 89 c7             	mov    %rax,%rdi
+  8000b1:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  8000b8:	00 00 00 
+  8000bb:	ff d0                	call   *%rax
+  8000bd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8000c0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000c4:	74 36                	je     8000fc <umain+0xca>
+    panic("poll on empty pipe: %i", r);
+  8000c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000c9:	89 c1                	mov    %eax,%ecx
+  8000cb:	48 b8 59 67 80 00 00 	movabs $0x806759,%rax
+  8000d2:	00 00 00 
+  8000d5:	48 89 c2             	mov    %rax,%rdx
+  8000d8:	be 0f 00 00 00       	mov    $0xf,%esi
+  8000dd:	48 b8 49 67 80 00 00 	movabs $0x806749,%rax
+  8000e4:	00 00 00 
+  8000e7:	48 89 c7             	mov    %rax,%rdi
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  8000f6:	00 00 00 
+  8000f9:	41 ff d0             	call   *%r8
+  cprintf("poll timed out on empty pipe\n");
+  8000fc:	48 b8 70 67 80 00 00 	movabs $0x806770,%rax
+  800103:	00 00 00 
+  800106:	48 89 c7             	mov    %rax,%rdi
+  800109:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010e:	48 ba 26 07 80 00 00 	movabs $0x800726,%rdx
+  800115:	00 00 00 
+  800118:	ff d2                	call   *%rdx
+
+  if ((pid = fork()) < 0)
+  80011a:	48 b8 3d 33 80 00 00 	movabs $0x80333d,%rax
+  800121:	00 00 00 
+  800124:	ff d0                	call   *%rax
+  800126:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  800129:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80012d:	79 36                	jns    800165 <umain+0x133>
+    panic("fork: %i", pid);
+  80012f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800132:	89 c1                	mov    %eax,%ecx
+  800134:	48 b8 8e 67 80 00 00 	movabs $0x80678e,%rax
+  80013b:	00 00 00 
+  80013e:	48 89 c2             	mov    %rax,%rdx
+  800141:	be 13 00 00 00       	mov    $0x13,%esi
+  800146:	48 b8 49 67 80 00 00 	movabs $0x806749,%rax
+  80014d:	00 00 00 
+  800150:	48 89 c7             	mov    %rax,%rdi
+  800153:	b8 00 00 00 00       	mov    $0x0,%eax
+  800158:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  80015f:	00 00 00 
+  800162:	41 ff d0             	call   *%r8
+  if (pid == 0) {
+  800165:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800169:	0f 85 ac 00 00 00    	jne    80021b <umain+0x1e9>
+    close(p[0]);
+  80016f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  800172:	89 c7                	mov    %eax,%edi
+  800174:	48 b8 ab 39 80 00 00 	movabs $0x8039ab,%rax
+  80017b:	00 00 00 
+  80017e:	ff d0                	call   *%rax
+    for (r = 0; r < 10; r++)
+  800180:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800187:	eb 10                	jmp    800199 <umain+0x167>
+      sys_yield();
+  800189:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  800190:	00 00 00 
+  800193:	ff d0                	call   *%rax
+    for (r = 0; r < 10; r++)
+  800195:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800199:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+  80019d:	7e ea                	jle    800189 <umain+0x157>
+    write(p[1], "x", 1);
+  80019f:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8001a2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8001a7:	48 b9 97 67 80 00 00 	movabs $0x806797,%rcx
+  8001ae:	00 00 00 
+  8001b1:	48 89 ce             	mov    %rcx,%rsi
+  8001b4:	89 c7                	mov    %eax,%edi
+  8001b6:	48 b8 0e 3e 80 00 00 	movabs $0x803e0e,%rax
+  8001bd:	00 00 00 
+  8001c0:	ff d0                	call   *%rax
+    ipc_send(thisenv->env_parent_id, 0, NULL, 0);
+  8001c2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8001c9:	00 00 00 
+  8001cc:	8b 40 04             	mov    0x4(%rax),%eax
+  8001cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001d4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8001db:	00 00 00 
+  8001de:	48 98                	cltq
+  8001e0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8001e7:	48 01 d0             	add    %rdx,%rax
+  8001ea:	48 05 cc 00 00 00    	add    $0xcc,%rax
+  8001f0:	8b 00                	mov    (%rax),%eax
+  8001f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800201:	89 c7                	mov    %eax,%edi
+  800203:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  80020a:	00 00 00 
+  80020d:	ff d0                	call   *%rax
+    exit();
+  80020f:	48 b8 e3 04 80 00 00 	movabs $0x8004e3,%rax
+  800216:	00 00 00 
+  800219:	ff d0                	call   *%rax
+  }
+  close(p[1]);
+  80021b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80021e:	89 c7                	mov    %eax,%edi
+  800220:	48 b8 ab 39 80 00 00 	movabs $0x8039ab,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+
+  fds[1].fd     = POLLFD_IPC;
+  80022c:	c7 45 ec fe ff ff ff 	movl   $0xfffffffe,-0x14(%rbp)
+  fds[1].events = POLLIN;
+  800233:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%rbp)
+  if ((r = poll(fds, 2, POLL_NO_TIMEOUT)) < 0)
+  80023a:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80023e:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  800245:	be 02 00 00 00       	mov    $0x2,%esi
+  80024a:	48 89 c7             	mov    %rax,%rdi
+  80024d:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  800254:	00 00 00 
+  800257:	ff d0                	call   *%rax
+  800259:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80025c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800260:	79 36                	jns    800298 <umain+0x266>
+    panic("poll: %i", r);
+  800262:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800265:	89 c1                	mov    %eax,%ecx
+  800267:	48 b8 99 67 80 00 00 	movabs $0x806799,%rax
+  80026e:	00 00 00 
+  800271:	48 89 c2             	mov    %rax,%rdx
+  800274:	be 21 00 00 00       	mov    $0x21,%esi
+  800279:	48 b8 49 67 80 00 00 	movabs $0x806749,%rax
+  800280:	00 00 00 
+  800283:	48 89 c7             	mov    %rax,%rdi
+  800286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028b:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  800292:	00 00 00 
+  800295:	41 ff d0             	call   *%r8
+  if (!(fds[0].revents & POLLIN) || (r = read(p[0], buf, sizeof(buf))) != 1)
+  800298:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80029b:	83 e0 01             	and    $0x1,%eax
+  80029e:	85 c0                	test   %eax,%eax
+  8002a0:	74 26                	je     8002c8 <umain+0x296>
+  8002a2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8002a5:	48 8d 4d d0          	lea    -0x30(%rbp),%rcx
+  8002a9:	ba 10 00 00 00       	mov    $0x10,%edx
+  8002ae:	48 89 ce             	mov    %rcx,%rsi
+  8002b1:	89 c7                	mov    %eax,%edi
+  8002b3:	48 b8 92 3c 80 00 00 	movabs $0x803c92,%rax
+  8002ba:	00 00 00 
+  8002bd:	ff d0                	call   *%rax
+  8002bf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8002c2:	83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+  8002c6:	74 36                	je     8002fe <umain+0x2cc>
+    panic("pipe not readable after poll: %i", r);
+  8002c8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002cb:	89 c1                	mov    %eax,%ecx
+  8002cd:	48 b8 a8 67 80 00 00 	movabs $0x8067a8,%rax
+  8002d4:	00 00 00 
+  8002d7:	48 89 c2             	mov    %rax,%rdx
+  8002da:	be 23 00 00 00       	mov    $0x23,%esi
+  8002df:	48 b8 49 67 80 00 00 	movabs $0x806749,%rax
+  8002e6:	00 00 00 
+  8002e9:	48 89 c7             	mov    %rax,%rdi
+  8002ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f1:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  8002f8:	00 00 00 
+  8002fb:	41 ff d0             	call   *%r8
+  cprintf("poll saw pipe data\n");
+  8002fe:	48 b8 c9 67 80 00 00 	movabs $0x8067c9,%rax
+  800305:	00 00 00 
+  800308:	48 89 c7             	mov    %rax,%rdi
+  80030b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800310:	48 ba 26 07 80 00 00 	movabs $0x800726,%rdx
+  800317:	00 00 00 
+  80031a:	ff d2                	call   *%rdx
+
+  fds[0].events = 0;
+  80031c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%rbp)
+  while (!(fds[1].revents & POLLIN))
+  800323:	eb 5e                	jmp    800383 <umain+0x351>
+    if ((r = poll(fds, 2, POLL_NO_TIMEOUT)) < 0)
+  800325:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800329:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  800330:	be 02 00 00 00       	mov    $0x2,%esi
+  800335:	48 89 c7             	mov    %rax,%rdi
+  800338:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  80033f:	00 00 00 
+  800342:	ff d0                	call   *%rax
+  800344:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800347:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80034b:	79 36                	jns    800383 <umain+0x351>
+      panic("poll: %i", r);
+  80034d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800350:	89 c1                	mov    %eax,%ecx
+  800352:	48 b8 99 67 80 00 00 	movabs $0x806799,%rax
+  800359:	00 00 00 
+  80035c:	48 89 c2             	mov    %rax,%rdx
+  80035f:	be 29 00 00 00       	mov    $0x29,%esi
+  800364:	48 b8 49 67 80 00 00 	movabs $0x806749,%rax
+  80036b:	00 00 00 
+  80036e:	48 89 c7             	mov    %rax,%rdi
+  800371:	b8 00 00 00 00       	mov    $0x0,%eax
+  800376:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  80037d:	00 00 00 
+  800380:	41 ff d0             	call   *%r8
+  while (!(fds[1].revents & POLLIN))
+  800383:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800386:	83 e0 01             	and    $0x1,%eax
+  800389:	85 c0                	test   %eax,%eax
+  80038b:	74 98                	je     800325 <umain+0x2f3>
+  ipc_recv(NULL, NULL, NULL);
+  80038d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800392:	be 00 00 00 00       	mov    $0x0,%esi
+  800397:	bf 00 00 00 00       	mov    $0x0,%edi
+  80039c:	48 b8 6b 33 80 00 00 	movabs $0x80336b,%rax
+  8003a3:	00 00 00 
+  8003a6:	ff d0                	call   *%rax
+  cprintf("poll saw IPC\n");
+  8003a8:	48 b8 dd 67 80 00 00 	movabs $0x8067dd,%rax
+  8003af:	00 00 00 
+  8003b2:	48 89 c7             	mov    %rax,%rdi
+  8003b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ba:	48 ba 26 07 80 00 00 	movabs $0x800726,%rdx
+  8003c1:	00 00 00 
+  8003c4:	ff d2                	call   *%rdx
+
+  if ((r = poll(fds, 1, POLL_NO_TIMEOUT)) != 1 || !(fds[0].revents & POLLHUP))
+  8003c6:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8003ca:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8003d1:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d6:	48 89 c7             	mov    %rax,%rdi
+  8003d9:	48 b8 83 41 80 00 00 	movabs $0x804183,%rax
+  8003e0:	00 00 00 
+  8003e3:	ff d0                	call   *%rax
+  8003e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8003e8:	83 7d fc 01          	cmpl   $0x1,-0x4(%rbp)
+  8003ec:	75 0a                	jne    8003f8 <umain+0x3c6>
+  8003ee:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8003f1:	83 e0 04             	and    $0x4,%eax
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	75 36                	jne    80042e <umain+0x3fc>
+    panic("no hangup after writer exit: %i", r);
+  8003f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8003fb:	89 c1                	mov    %eax,%ecx
+  8003fd:	48 b8 f0 67 80 00 00 	movabs $0x8067f0,%rax
+  800404:	00 00 00 
+  800407:	48 89 c2             	mov    %rax,%rdx
+  80040a:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80040f:	48 b8 49 67 80 00 00 	movabs $0x806749,%rax
+  800416:	00 00 00 
+  800419:	48 89 c7             	mov    %rax,%rdi
+  80041c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800421:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  800428:	00 00 00 
+  80042b:	41 ff d0             	call   *%r8
+  cprintf("poll saw hangup\n");
+  80042e:	48 b8 10 68 80 00 00 	movabs $0x806810,%rax
+  800435:	00 00 00 
+  800438:	48 89 c7             	mov    %rax,%rdi
+  80043b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800440:	48 ba 26 07 80 00 00 	movabs $0x800726,%rdx
+  800447:	00 00 00 
+  80044a:	ff d2                	call   *%rdx
+  wait(pid);
+  80044c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80044f:	89 c7                	mov    %eax,%edi
+  800451:	48 b8 7f 56 80 00 00 	movabs $0x80567f,%rax
+  800458:	00 00 00 
+  80045b:	ff d0                	call   *%rax
+}
+  80045d:	90                   	nop
+  80045e:	c9                   	leave
+  80045f:	c3                   	ret
+
+0000000000800460 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800460:	55                   	push   %rbp
+  800461:	48 89 e5             	mov    %rsp,%rbp
+  800464:	48 83 ec 20          	sub    $0x20,%rsp
+  800468:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80046b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80046f:	48 b8 00 81 80 00 00 	movabs $0x808100,%rax
+  800476:	00 00 00 
+  800479:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80047d:	eb 13                	jmp    800492 <libmain+0x32>
+    (*ctor)();
+  80047f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800483:	48 8b 10             	mov    (%rax),%rdx
+  800486:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048b:	ff d2                	call   *%rdx
+    ctor++;
+  80048d:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800492:	48 b8 00 81 80 00 00 	movabs $0x808100,%rax
+  800499:	00 00 00 
+  80049c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8004a0:	72 dd                	jb     80047f <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8004a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8004a6:	7e 14                	jle    8004bc <libmain+0x5c>
+    binaryname = argv[0];
+  8004a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8004ac:	48 8b 00             	mov    (%rax),%rax
+  8004af:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8004b6:	00 00 00 
+  8004b9:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8004bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8004c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8004c3:	48 89 d6             	mov    %rdx,%rsi
+  8004c6:	89 c7                	mov    %eax,%edi
+  8004c8:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8004cf:	00 00 00 
+  8004d2:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8004d4:	48 b8 e3 04 80 00 00 	movabs $0x8004e3,%rax
+  8004db:	00 00 00 
+  8004de:	ff d0                	call   *%rax
+#endif
+}
+  8004e0:	90                   	nop
+  8004e1:	c9                   	leave
+  8004e2:	c3                   	ret
+
+00000000008004e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004e3:	55                   	push   %rbp
+  8004e4:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8004e7:	48 b8 f6 39 80 00 00 	movabs $0x8039f6,%rax
+  8004ee:	00 00 00 
+  8004f1:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8004f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004f8:	48 b8 5c 23 80 00 00 	movabs $0x80235c,%rax
+  8004ff:	00 00 00 
+  800502:	ff d0                	call   *%rax
+}
+  800504:	90                   	nop
+  800505:	5d                   	pop    %rbp
+  800506:	c3                   	ret
+
+0000000000800507 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800507:	55                   	push   %rbp
+  800508:	48 89 e5             	mov    %rsp,%rbp
+  80050b:	53                   	push   %rbx
+  80050c:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800513:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80051a:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800520:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800527:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  80052e:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800535:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80053c:	84 c0                	test   %al,%al
+  80053e:	74 23                	je     800563 <_panic+0x5c>
+  800540:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800547:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80054b:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  80054f:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800553:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800557:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80055b:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  80055f:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800563:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80056a:	00 00 00 
+  80056d:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800574:	00 00 00 
+  800577:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80057b:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800582:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800589:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800590:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800597:	00 00 00 
+  80059a:	48 8b 18             	mov    (%rax),%rbx
+  80059d:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  8005a4:	00 00 00 
+  8005a7:	ff d0                	call   *%rax
+  8005a9:	89 c6                	mov    %eax,%esi
+  8005ab:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8005b1:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8005b8:	41 89 d0             	mov    %edx,%r8d
+  8005bb:	48 89 c1             	mov    %rax,%rcx
+  8005be:	48 89 da             	mov    %rbx,%rdx
+  8005c1:	48 b8 30 68 80 00 00 	movabs $0x806830,%rax
+  8005c8:	00 00 00 
+  8005cb:	48 89 c7             	mov    %rax,%rdi
+  8005ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d3:	49 b9 26 07 80 00 00 	movabs $0x800726,%r9
+  8005da:	00 00 00 
+  8005dd:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8005e0:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  8005e7:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8005ee:	48 89 d6             	mov    %rdx,%rsi
+  8005f1:	48 89 c7             	mov    %rax,%rdi
+  8005f4:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  8005fb:	00 00 00 
+  8005fe:	ff d0                	call   *%rax
+  cprintf("\n");
+  800600:	48 b8 53 68 80 00 00 	movabs $0x806853,%rax
+  800607:	00 00 00 
+  80060a:	48 89 c7             	mov    %rax,%rdi
+  80060d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800612:	48 ba 26 07 80 00 00 	movabs $0x800726,%rdx
+  800619:	00 00 00 
+  80061c:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  80061e:	cc                   	int3
+  80061f:	eb fd                	jmp    80061e <_panic+0x117>
+
+0000000000800621 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800621:	55                   	push   %rbp
+  800622:	48 89 e5             	mov    %rsp,%rbp
+  800625:	48 83 ec 10          	sub    $0x10,%rsp
+  800629:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80062c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800630:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800634:	8b 00                	mov    (%rax),%eax
+  800636:	8d 48 01             	lea    0x1(%rax),%ecx
+  800639:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80063d:	89 0a                	mov    %ecx,(%rdx)
+  80063f:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800642:	89 d1                	mov    %edx,%ecx
+  800644:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800648:	48 98                	cltq
+  80064a:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80064e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800652:	8b 00                	mov    (%rax),%eax
+  800654:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800659:	75 2c                	jne    800687 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80065b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80065f:	8b 00                	mov    (%rax),%eax
+  800661:	48 98                	cltq
+  800663:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800667:	48 83 c2 08          	add    $0x8,%rdx
+  80066b:	48 89 c6             	mov    %rax,%rsi
+  80066e:	48 89 d7             	mov    %rdx,%rdi
+  800671:	48 b8 8d 22 80 00 00 	movabs $0x80228d,%rax
+  800678:	00 00 00 
+  80067b:	ff d0                	call   *%rax
+    b->idx = 0;
+  80067d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800681:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800687:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80068b:	8b 40 04             	mov    0x4(%rax),%eax
+  80068e:	8d 50 01             	lea    0x1(%rax),%edx
+  800691:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800695:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800698:	90                   	nop
+  800699:	c9                   	leave
+  80069a:	c3                   	ret
+
+000000000080069b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80069b:	55                   	push   %rbp
+  80069c:	48 89 e5             	mov    %rsp,%rbp
+  80069f:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8006a6:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8006ad:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8006b4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8006bb:	00 00 00 
+  b.cnt = 0;
+  8006be:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8006c5:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8006c8:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8006cf:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8006d6:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8006dd:	48 89 c6             	mov    %rax,%rsi
+  8006e0:	48 b8 21 06 80 00 00 	movabs $0x800621,%rax
+  8006e7:	00 00 00 
+  8006ea:	48 89 c7             	mov    %rax,%rdi
+  8006ed:	48 b8 80 0a 80 00 00 	movabs $0x800a80,%rax
+  8006f4:	00 00 00 
+  8006f7:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8006f9:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8006ff:	48 98                	cltq
+  800701:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800708:	48 83 c2 08          	add    $0x8,%rdx
+  80070c:	48 89 c6             	mov    %rax,%rsi
+  80070f:	48 89 d7             	mov    %rdx,%rdi
+  800712:	48 b8 8d 22 80 00 00 	movabs $0x80228d,%rax
+  800719:	00 00 00 
+  80071c:	ff d0                	call   *%rax
+
+  return b.cnt;
+  80071e:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800724:	c9                   	leave
+  800725:	c3                   	ret
+
+0000000000800726 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800726:	55                   	push   %rbp
+  800727:	48 89 e5             	mov    %rsp,%rbp
+  80072a:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800731:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800738:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80073f:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800746:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80074d:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800754:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80075b:	84 c0                	test   %al,%al
+  80075d:	74 20                	je     80077f <cprintf+0x59>
+  80075f:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800763:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800767:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80076b:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80076f:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800773:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800777:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80077b:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80077f:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800786:	00 00 00 
+  800789:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800790:	00 00 00 
+  800793:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800797:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80079e:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8007a5:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8007ac:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8007b3:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8007ba:	48 89 d6             	mov    %rdx,%rsi
+  8007bd:	48 89 c7             	mov    %rax,%rdi
+  8007c0:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  8007c7:	00 00 00 
+  8007ca:	ff d0                	call   *%rax
+  8007cc:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8007d2:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8007d8:	c9                   	leave
+  8007d9:	c3                   	ret
+
+00000000008007da <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8007da:	55                   	push   %rbp
+  8007db:	48 89 e5             	mov    %rsp,%rbp
+  8007de:	48 83 ec 30          	sub    $0x30,%rsp
+  8007e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8007ea:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8007ee:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8007f1:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8007f5:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8007f9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8007fc:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800800:	72 54                	jb     800856 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800802:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800805:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800808:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80080b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80080f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800814:	48 f7 f6             	div    %rsi
+  800817:	49 89 c2             	mov    %rax,%r10
+  80081a:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  80081d:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800820:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800824:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800828:	41 89 c9             	mov    %ecx,%r9d
+  80082b:	41 89 f8             	mov    %edi,%r8d
+  80082e:	89 d1                	mov    %edx,%ecx
+  800830:	4c 89 d2             	mov    %r10,%rdx
+  800833:	48 89 c7             	mov    %rax,%rdi
+  800836:	48 b8 da 07 80 00 00 	movabs $0x8007da,%rax
+  80083d:	00 00 00 
+  800840:	ff d0                	call   *%rax
+  800842:	eb 1c                	jmp    800860 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800844:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800848:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80084b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80084f:	48 89 d6             	mov    %rdx,%rsi
+  800852:	89 c7                	mov    %eax,%edi
+  800854:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800856:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80085a:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80085e:	7f e4                	jg     800844 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800860:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800863:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800867:	ba 00 00 00 00       	mov    $0x0,%edx
+  80086c:	48 f7 f1             	div    %rcx
+  80086f:	48 b8 90 6a 80 00 00 	movabs $0x806a90,%rax
+  800876:	00 00 00 
+  800879:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  80087d:	0f be c0             	movsbl %al,%eax
+  800880:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800884:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800888:	48 89 d6             	mov    %rdx,%rsi
+  80088b:	89 c7                	mov    %eax,%edi
+  80088d:	ff d1                	call   *%rcx
+}
+  80088f:	90                   	nop
+  800890:	c9                   	leave
+  800891:	c3                   	ret
+
+0000000000800892 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800892:	55                   	push   %rbp
+  800893:	48 89 e5             	mov    %rsp,%rbp
+  800896:	48 83 ec 10          	sub    $0x10,%rsp
+  80089a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80089e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8008a1:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8008a5:	7e 4b                	jle    8008f2 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8008a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ab:	8b 00                	mov    (%rax),%eax
+  8008ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b0:	77 24                	ja     8008d6 <getuint+0x44>
+  8008b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008be:	8b 00                	mov    (%rax),%eax
+  8008c0:	89 c0                	mov    %eax,%eax
+  8008c2:	48 01 d0             	add    %rdx,%rax
+  8008c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008c9:	8b 12                	mov    (%rdx),%edx
+  8008cb:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d2:	89 0a                	mov    %ecx,(%rdx)
+  8008d4:	eb 14                	jmp    8008ea <getuint+0x58>
+  8008d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008da:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008de:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008e2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008e6:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008ea:	48 8b 00             	mov    (%rax),%rax
+  8008ed:	e9 95 00 00 00       	jmp    800987 <getuint+0xf5>
+  else if (lflag)
+  8008f2:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008f6:	74 48                	je     800940 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8008f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008fc:	8b 00                	mov    (%rax),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	77 24                	ja     800927 <getuint+0x95>
+  800903:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800907:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80090b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80090f:	8b 00                	mov    (%rax),%eax
+  800911:	89 c0                	mov    %eax,%eax
+  800913:	48 01 d0             	add    %rdx,%rax
+  800916:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80091a:	8b 12                	mov    (%rdx),%edx
+  80091c:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80091f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800923:	89 0a                	mov    %ecx,(%rdx)
+  800925:	eb 14                	jmp    80093b <getuint+0xa9>
+  800927:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80092b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80092f:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800933:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800937:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80093b:	48 8b 00             	mov    (%rax),%rax
+  80093e:	eb 47                	jmp    800987 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800940:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800944:	8b 00                	mov    (%rax),%eax
+  800946:	83 f8 2f             	cmp    $0x2f,%eax
+  800949:	77 24                	ja     80096f <getuint+0xdd>
+  80094b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80094f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800953:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800957:	8b 00                	mov    (%rax),%eax
+  800959:	89 c0                	mov    %eax,%eax
+  80095b:	48 01 d0             	add    %rdx,%rax
+  80095e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800962:	8b 12                	mov    (%rdx),%edx
+  800964:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800967:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80096b:	89 0a                	mov    %ecx,(%rdx)
+  80096d:	eb 14                	jmp    800983 <getuint+0xf1>
+  80096f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800973:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800977:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80097b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80097f:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800983:	8b 00                	mov    (%rax),%eax
+  800985:	89 c0                	mov    %eax,%eax
+}
+  800987:	c9                   	leave
+  800988:	c3                   	ret
+
+0000000000800989 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800989:	55                   	push   %rbp
+  80098a:	48 89 e5             	mov    %rsp,%rbp
+  80098d:	48 83 ec 10          	sub    $0x10,%rsp
+  800991:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800995:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800998:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80099c:	7e 4b                	jle    8009e9 <getint+0x60>
+    return va_arg(*ap, long long);
+  80099e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009a2:	8b 00                	mov    (%rax),%eax
+  8009a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a7:	77 24                	ja     8009cd <getint+0x44>
+  8009a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009ad:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b5:	8b 00                	mov    (%rax),%eax
+  8009b7:	89 c0                	mov    %eax,%eax
+  8009b9:	48 01 d0             	add    %rdx,%rax
+  8009bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009c0:	8b 12                	mov    (%rdx),%edx
+  8009c2:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009c9:	89 0a                	mov    %ecx,(%rdx)
+  8009cb:	eb 14                	jmp    8009e1 <getint+0x58>
+  8009cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d1:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009d5:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009dd:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009e1:	48 8b 00             	mov    (%rax),%rax
+  8009e4:	e9 95 00 00 00       	jmp    800a7e <getint+0xf5>
+  else if (lflag)
+  8009e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009ed:	74 48                	je     800a37 <getint+0xae>
+    return va_arg(*ap, long);
+  8009ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f3:	8b 00                	mov    (%rax),%eax
+  8009f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f8:	77 24                	ja     800a1e <getint+0x95>
+  8009fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009fe:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a06:	8b 00                	mov    (%rax),%eax
+  800a08:	89 c0                	mov    %eax,%eax
+  800a0a:	48 01 d0             	add    %rdx,%rax
+  800a0d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a11:	8b 12                	mov    (%rdx),%edx
+  800a13:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a16:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a1a:	89 0a                	mov    %ecx,(%rdx)
+  800a1c:	eb 14                	jmp    800a32 <getint+0xa9>
+  800a1e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a22:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a26:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a2a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a2e:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a32:	48 8b 00             	mov    (%rax),%rax
+  800a35:	eb 47                	jmp    800a7e <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800a37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a3b:	8b 00                	mov    (%rax),%eax
+  800a3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a40:	77 24                	ja     800a66 <getint+0xdd>
+  800a42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a46:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a4e:	8b 00                	mov    (%rax),%eax
+  800a50:	89 c0                	mov    %eax,%eax
+  800a52:	48 01 d0             	add    %rdx,%rax
+  800a55:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a59:	8b 12                	mov    (%rdx),%edx
+  800a5b:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a5e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a62:	89 0a                	mov    %ecx,(%rdx)
+  800a64:	eb 14                	jmp    800a7a <getint+0xf1>
+  800a66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a6a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a6e:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a72:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a76:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a7a:	8b 00                	mov    (%rax),%eax
+  800a7c:	48 98                	cltq
+}
+  800a7e:	c9                   	leave
+  800a7f:	c3                   	ret
+
+0000000000800a80 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800a80:	55                   	push   %rbp
+  800a81:	48 89 e5             	mov    %rsp,%rbp
+  800a84:	41 54                	push   %r12
+  800a86:	53                   	push   %rbx
+  800a87:	48 83 ec 60          	sub    $0x60,%rsp
+  800a8b:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800a8f:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800a93:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a97:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800a9b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a9f:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800aa3:	48 8b 06             	mov    (%rsi),%rax
+  800aa6:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800aaa:	48 89 01             	mov    %rax,(%rcx)
+  800aad:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800ab1:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800ab5:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800ab9:	eb 17                	jmp    800ad2 <vprintfmt+0x52>
+      if (ch == '\0')
+  800abb:	85 db                	test   %ebx,%ebx
+  800abd:	0f 84 bf 04 00 00    	je     800f82 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800ac3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ac7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800acb:	48 89 c6             	mov    %rax,%rsi
+  800ace:	89 df                	mov    %ebx,%edi
+  800ad0:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800ad2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ad6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ada:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800ade:	0f b6 00             	movzbl (%rax),%eax
+  800ae1:	0f b6 d8             	movzbl %al,%ebx
+  800ae4:	83 fb 25             	cmp    $0x25,%ebx
+  800ae7:	75 d2                	jne    800abb <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800ae9:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800aed:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800af4:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800afb:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800b02:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800b09:	eb 04                	jmp    800b0f <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800b0b:	90                   	nop
+  800b0c:	eb 01                	jmp    800b0f <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800b0e:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800b0f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b13:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800b17:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800b1b:	0f b6 00             	movzbl (%rax),%eax
+  800b1e:	0f b6 d8             	movzbl %al,%ebx
+  800b21:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800b24:	83 f8 55             	cmp    $0x55,%eax
+  800b27:	0f 87 22 04 00 00    	ja     800f4f <vprintfmt+0x4cf>
+  800b2d:	89 c0                	mov    %eax,%eax
+  800b2f:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800b36:	00 
+  800b37:	48 b8 b8 6a 80 00 00 	movabs $0x806ab8,%rax
+  800b3e:	00 00 00 
+  800b41:	48 01 d0             	add    %rdx,%rax
+  800b44:	48 8b 00             	mov    (%rax),%rax
+  800b47:	ff e0                	jmp    *%rax
+        padc = '-';
+  800b49:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800b4d:	eb c0                	jmp    800b0f <vprintfmt+0x8f>
+        padc = '0';
+  800b4f:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800b53:	eb ba                	jmp    800b0f <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800b55:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800b5c:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800b5f:	89 d0                	mov    %edx,%eax
+  800b61:	c1 e0 02             	shl    $0x2,%eax
+  800b64:	01 d0                	add    %edx,%eax
+  800b66:	01 c0                	add    %eax,%eax
+  800b68:	01 d8                	add    %ebx,%eax
+  800b6a:	83 e8 30             	sub    $0x30,%eax
+  800b6d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800b70:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b74:	0f b6 00             	movzbl (%rax),%eax
+  800b77:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800b7a:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b7d:	7e 60                	jle    800bdf <vprintfmt+0x15f>
+  800b7f:	83 fb 39             	cmp    $0x39,%ebx
+  800b82:	7f 5b                	jg     800bdf <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800b84:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800b89:	eb d1                	jmp    800b5c <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800b8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b91:	77 17                	ja     800baa <vprintfmt+0x12a>
+  800b93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b97:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b9a:	89 d2                	mov    %edx,%edx
+  800b9c:	48 01 d0             	add    %rdx,%rax
+  800b9f:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ba2:	83 c2 08             	add    $0x8,%edx
+  800ba5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ba8:	eb 0c                	jmp    800bb6 <vprintfmt+0x136>
+  800baa:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bae:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bb2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bb6:	8b 00                	mov    (%rax),%eax
+  800bb8:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800bbb:	eb 23                	jmp    800be0 <vprintfmt+0x160>
+        if (width < 0)
+  800bbd:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bc1:	0f 89 44 ff ff ff    	jns    800b0b <vprintfmt+0x8b>
+          width = 0;
+  800bc7:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800bce:	e9 38 ff ff ff       	jmp    800b0b <vprintfmt+0x8b>
+        altflag = 1;
+  800bd3:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800bda:	e9 30 ff ff ff       	jmp    800b0f <vprintfmt+0x8f>
+        goto process_precision;
+  800bdf:	90                   	nop
+        if (width < 0)
+  800be0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800be4:	0f 89 24 ff ff ff    	jns    800b0e <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800bea:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800bed:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800bf0:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800bf7:	e9 12 ff ff ff       	jmp    800b0e <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800bfc:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800c00:	e9 0a ff ff ff       	jmp    800b0f <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800c05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c08:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0b:	77 17                	ja     800c24 <vprintfmt+0x1a4>
+  800c0d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c11:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c14:	89 d2                	mov    %edx,%edx
+  800c16:	48 01 d0             	add    %rdx,%rax
+  800c19:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c1c:	83 c2 08             	add    $0x8,%edx
+  800c1f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c22:	eb 0c                	jmp    800c30 <vprintfmt+0x1b0>
+  800c24:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c28:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c2c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c30:	8b 00                	mov    (%rax),%eax
+  800c32:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800c36:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800c3a:	48 89 d6             	mov    %rdx,%rsi
+  800c3d:	89 c7                	mov    %eax,%edi
+  800c3f:	ff d1                	call   *%rcx
+        break;
+  800c41:	e9 37 03 00 00       	jmp    800f7d <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800c46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c49:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4c:	77 17                	ja     800c65 <vprintfmt+0x1e5>
+  800c4e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c52:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c55:	89 d2                	mov    %edx,%edx
+  800c57:	48 01 d0             	add    %rdx,%rax
+  800c5a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c5d:	83 c2 08             	add    $0x8,%edx
+  800c60:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c63:	eb 0c                	jmp    800c71 <vprintfmt+0x1f1>
+  800c65:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c69:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c6d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c71:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800c73:	85 db                	test   %ebx,%ebx
+  800c75:	79 02                	jns    800c79 <vprintfmt+0x1f9>
+          err = -err;
+  800c77:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800c79:	83 fb 15             	cmp    $0x15,%ebx
+  800c7c:	7f 16                	jg     800c94 <vprintfmt+0x214>
+  800c7e:	48 ba e0 69 80 00 00 	movabs $0x8069e0,%rdx
+  800c85:	00 00 00 
+  800c88:	48 63 c3             	movslq %ebx,%rax
+  800c8b:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800c8f:	4d 85 e4             	test   %r12,%r12
+  800c92:	75 2e                	jne    800cc2 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800c94:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c98:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c9c:	89 d9                	mov    %ebx,%ecx
+  800c9e:	48 ba a1 6a 80 00 00 	movabs $0x806aa1,%rdx
+  800ca5:	00 00 00 
+  800ca8:	48 89 c7             	mov    %rax,%rdi
+  800cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb0:	49 b8 8c 0f 80 00 00 	movabs $0x800f8c,%r8
+  800cb7:	00 00 00 
+  800cba:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800cbd:	e9 bb 02 00 00       	jmp    800f7d <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800cc2:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800cc6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800cca:	4c 89 e1             	mov    %r12,%rcx
+  800ccd:	48 ba aa 6a 80 00 00 	movabs $0x806aaa,%rdx
+  800cd4:	00 00 00 
+  800cd7:	48 89 c7             	mov    %rax,%rdi
+  800cda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdf:	49 b8 8c 0f 80 00 00 	movabs $0x800f8c,%r8
+  800ce6:	00 00 00 
+  800ce9:	41 ff d0             	call   *%r8
+        break;
+  800cec:	e9 8c 02 00 00       	jmp    800f7d <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800cf1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf4:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf7:	77 17                	ja     800d10 <vprintfmt+0x290>
+  800cf9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cfd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d00:	89 d2                	mov    %edx,%edx
+  800d02:	48 01 d0             	add    %rdx,%rax
+  800d05:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d08:	83 c2 08             	add    $0x8,%edx
+  800d0b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d0e:	eb 0c                	jmp    800d1c <vprintfmt+0x29c>
+  800d10:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d14:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d18:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d1c:	4c 8b 20             	mov    (%rax),%r12
+  800d1f:	4d 85 e4             	test   %r12,%r12
+  800d22:	75 0a                	jne    800d2e <vprintfmt+0x2ae>
+          p = "(null)";
+  800d24:	49 bc ad 6a 80 00 00 	movabs $0x806aad,%r12
+  800d2b:	00 00 00 
+        if (width > 0 && padc != '-')
+  800d2e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d32:	7e 78                	jle    800dac <vprintfmt+0x32c>
+  800d34:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800d38:	74 72                	je     800dac <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800d3a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800d3d:	48 98                	cltq
+  800d3f:	48 89 c6             	mov    %rax,%rsi
+  800d42:	4c 89 e7             	mov    %r12,%rdi
+  800d45:	48 b8 98 16 80 00 00 	movabs $0x801698,%rax
+  800d4c:	00 00 00 
+  800d4f:	ff d0                	call   *%rax
+  800d51:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800d54:	eb 17                	jmp    800d6d <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800d56:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800d5a:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800d5e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d62:	48 89 d6             	mov    %rdx,%rsi
+  800d65:	89 c7                	mov    %eax,%edi
+  800d67:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800d69:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d6d:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d71:	7f e3                	jg     800d56 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d73:	eb 37                	jmp    800dac <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800d75:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800d79:	74 1e                	je     800d99 <vprintfmt+0x319>
+  800d7b:	83 fb 1f             	cmp    $0x1f,%ebx
+  800d7e:	7e 05                	jle    800d85 <vprintfmt+0x305>
+  800d80:	83 fb 7e             	cmp    $0x7e,%ebx
+  800d83:	7e 14                	jle    800d99 <vprintfmt+0x319>
+            putch('?', putdat);
+  800d85:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d89:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d8d:	48 89 c6             	mov    %rax,%rsi
+  800d90:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d95:	ff d2                	call   *%rdx
+  800d97:	eb 0f                	jmp    800da8 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800d99:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d9d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800da1:	48 89 c6             	mov    %rax,%rsi
+  800da4:	89 df                	mov    %ebx,%edi
+  800da6:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800da8:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800dac:	4c 89 e0             	mov    %r12,%rax
+  800daf:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800db3:	0f b6 00             	movzbl (%rax),%eax
+  800db6:	0f be d8             	movsbl %al,%ebx
+  800db9:	85 db                	test   %ebx,%ebx
+  800dbb:	74 28                	je     800de5 <vprintfmt+0x365>
+  800dbd:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800dc1:	78 b2                	js     800d75 <vprintfmt+0x2f5>
+  800dc3:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800dc7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800dcb:	79 a8                	jns    800d75 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800dcd:	eb 16                	jmp    800de5 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800dcf:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800dd3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dd7:	48 89 c6             	mov    %rax,%rsi
+  800dda:	bf 20 00 00 00       	mov    $0x20,%edi
+  800ddf:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800de1:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800de5:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800de9:	7f e4                	jg     800dcf <vprintfmt+0x34f>
+        break;
+  800deb:	e9 8d 01 00 00       	jmp    800f7d <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800df0:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800df3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800df7:	89 d6                	mov    %edx,%esi
+  800df9:	48 89 c7             	mov    %rax,%rdi
+  800dfc:	48 b8 89 09 80 00 00 	movabs $0x800989,%rax
+  800e03:	00 00 00 
+  800e06:	ff d0                	call   *%rax
+  800e08:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800e0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e10:	48 85 c0             	test   %rax,%rax
+  800e13:	79 1d                	jns    800e32 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800e15:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e19:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e1d:	48 89 c6             	mov    %rax,%rsi
+  800e20:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e25:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800e27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e2b:	48 f7 d8             	neg    %rax
+  800e2e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800e32:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800e39:	e9 d2 00 00 00       	jmp    800f10 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800e3e:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e41:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e45:	89 d6                	mov    %edx,%esi
+  800e47:	48 89 c7             	mov    %rax,%rdi
+  800e4a:	48 b8 92 08 80 00 00 	movabs $0x800892,%rax
+  800e51:	00 00 00 
+  800e54:	ff d0                	call   *%rax
+  800e56:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800e5a:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800e61:	e9 aa 00 00 00       	jmp    800f10 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800e66:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e69:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e6d:	89 d6                	mov    %edx,%esi
+  800e6f:	48 89 c7             	mov    %rax,%rdi
+  800e72:	48 b8 92 08 80 00 00 	movabs $0x800892,%rax
+  800e79:	00 00 00 
+  800e7c:	ff d0                	call   *%rax
+  800e7e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800e82:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800e89:	e9 82 00 00 00       	jmp    800f10 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800e8e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e92:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e96:	48 89 c6             	mov    %rax,%rsi
+  800e99:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e9e:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800ea0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ea4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ea8:	48 89 c6             	mov    %rax,%rsi
+  800eab:	bf 78 00 00 00       	mov    $0x78,%edi
+  800eb0:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800eb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800eb8:	77 17                	ja     800ed1 <vprintfmt+0x451>
+  800eba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800ebe:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ec1:	89 d2                	mov    %edx,%edx
+  800ec3:	48 01 d0             	add    %rdx,%rax
+  800ec6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ec9:	83 c2 08             	add    $0x8,%edx
+  800ecc:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ecf:	eb 0c                	jmp    800edd <vprintfmt+0x45d>
+  800ed1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ed5:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ed9:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800edd:	48 8b 00             	mov    (%rax),%rax
+  800ee0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800ee4:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800eeb:	eb 23                	jmp    800f10 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800eed:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ef0:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ef4:	89 d6                	mov    %edx,%esi
+  800ef6:	48 89 c7             	mov    %rax,%rdi
+  800ef9:	48 b8 92 08 80 00 00 	movabs $0x800892,%rax
+  800f00:	00 00 00 
+  800f03:	ff d0                	call   *%rax
+  800f05:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800f09:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800f10:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800f15:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800f18:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800f1b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800f1f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800f23:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800f27:	45 89 c1             	mov    %r8d,%r9d
+  800f2a:	41 89 f8             	mov    %edi,%r8d
+  800f2d:	48 89 c7             	mov    %rax,%rdi
+  800f30:	48 b8 da 07 80 00 00 	movabs $0x8007da,%rax
+  800f37:	00 00 00 
+  800f3a:	ff d0                	call   *%rax
+        break;
+  800f3c:	eb 3f                	jmp    800f7d <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800f3e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f42:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f46:	48 89 c6             	mov    %rax,%rsi
+  800f49:	89 df                	mov    %ebx,%edi
+  800f4b:	ff d2                	call   *%rdx
+        break;
+  800f4d:	eb 2e                	jmp    800f7d <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800f4f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f53:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f57:	48 89 c6             	mov    %rax,%rsi
+  800f5a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f5f:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800f61:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800f66:	eb 05                	jmp    800f6d <vprintfmt+0x4ed>
+  800f68:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800f6d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f71:	48 83 e8 01          	sub    $0x1,%rax
+  800f75:	0f b6 00             	movzbl (%rax),%eax
+  800f78:	3c 25                	cmp    $0x25,%al
+  800f7a:	75 ec                	jne    800f68 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800f7c:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800f7d:	e9 50 fb ff ff       	jmp    800ad2 <vprintfmt+0x52>
+        return;
+  800f82:	90                   	nop
+    }
+  }
+}
+  800f83:	48 83 c4 60          	add    $0x60,%rsp
+  800f87:	5b                   	pop    %rbx
+  800f88:	41 5c                	pop    %r12
+  800f8a:	5d                   	pop    %rbp
+  800f8b:	c3                   	ret
+
+0000000000800f8c <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800f8c:	55                   	push   %rbp
+  800f8d:	48 89 e5             	mov    %rsp,%rbp
+  800f90:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f97:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f9e:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800fa5:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800fac:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800fb3:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800fba:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800fc1:	84 c0                	test   %al,%al
+  800fc3:	74 20                	je     800fe5 <printfmt+0x59>
+  800fc5:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800fc9:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800fcd:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800fd1:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800fd5:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800fd9:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800fdd:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800fe1:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800fe5:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800fec:	00 00 00 
+  800fef:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800ff6:	00 00 00 
+  800ff9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ffd:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801004:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80100b:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801012:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  801019:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801020:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801027:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80102e:	48 89 c7             	mov    %rax,%rdi
+  801031:	48 b8 80 0a 80 00 00 	movabs $0x800a80,%rax
+  801038:	00 00 00 
+  80103b:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  80103d:	90                   	nop
+  80103e:	c9                   	leave
+  80103f:	c3                   	ret
+
+0000000000801040 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801040:	55                   	push   %rbp
+  801041:	48 89 e5             	mov    %rsp,%rbp
+  801044:	48 83 ec 10          	sub    $0x10,%rsp
+  801048:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80104b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  80104f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801053:	8b 40 10             	mov    0x10(%rax),%eax
+  801056:	8d 50 01             	lea    0x1(%rax),%edx
+  801059:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80105d:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801060:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801064:	48 8b 10             	mov    (%rax),%rdx
+  801067:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80106b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80106f:	48 39 c2             	cmp    %rax,%rdx
+  801072:	73 17                	jae    80108b <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801074:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801078:	48 8b 00             	mov    (%rax),%rax
+  80107b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80107f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801083:	48 89 0a             	mov    %rcx,(%rdx)
+  801086:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801089:	88 10                	mov    %dl,(%rax)
+}
+  80108b:	90                   	nop
+  80108c:	c9                   	leave
+  80108d:	c3                   	ret
+
+000000000080108e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  80108e:	55                   	push   %rbp
+  80108f:	48 89 e5             	mov    %rsp,%rbp
+  801092:	48 83 ec 40          	sub    $0x40,%rsp
+  801096:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80109a:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80109d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8010a1:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  8010a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010a9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8010ad:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8010b0:	48 98                	cltq
+  8010b2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8010b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8010ba:	48 01 d0             	add    %rdx,%rax
+  8010bd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  8010c1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  8010c8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8010cd:	74 06                	je     8010d5 <vsnprintf+0x47>
+  8010cf:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8010d3:	7f 07                	jg     8010dc <vsnprintf+0x4e>
+    return -E_INVAL;
+  8010d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010da:	eb 32                	jmp    80110e <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8010dc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8010e0:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8010e4:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8010e8:	48 89 c6             	mov    %rax,%rsi
+  8010eb:	48 b8 40 10 80 00 00 	movabs $0x801040,%rax
+  8010f2:	00 00 00 
+  8010f5:	48 89 c7             	mov    %rax,%rdi
+  8010f8:	48 b8 80 0a 80 00 00 	movabs $0x800a80,%rax
+  8010ff:	00 00 00 
+  801102:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801104:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801108:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  80110b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  80110e:	c9                   	leave
+  80110f:	c3                   	ret
+
+0000000000801110 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801110:	55                   	push   %rbp
+  801111:	48 89 e5             	mov    %rsp,%rbp
+  801114:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80111b:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801122:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801128:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80112f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801136:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80113d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801144:	84 c0                	test   %al,%al
+  801146:	74 20                	je     801168 <snprintf+0x58>
+  801148:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80114c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801150:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801154:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801158:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80115c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801160:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801164:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801168:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80116f:	00 00 00 
+  801172:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801179:	00 00 00 
+  80117c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801180:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801187:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80118e:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801195:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  80119c:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8011a3:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8011a9:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8011b0:	48 89 c7             	mov    %rax,%rdi
+  8011b3:	48 b8 8e 10 80 00 00 	movabs $0x80108e,%rax
+  8011ba:	00 00 00 
+  8011bd:	ff d0                	call   *%rax
+  8011bf:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8011c5:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8011cb:	c9                   	leave
+  8011cc:	c3                   	ret
+
+00000000008011cd <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8011cd:	55                   	push   %rbp
+  8011ce:	48 89 e5             	mov    %rsp,%rbp
+  8011d1:	53                   	push   %rbx
+  8011d2:	48 83 ec 38          	sub    $0x38,%rsp
+  8011d6:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8011d9:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8011dd:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8011e1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8011e5:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8011e9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8011ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011f1:	89 d1                	mov    %edx,%ecx
+  8011f3:	0f a2                	cpuid
+  8011f5:	89 de                	mov    %ebx,%esi
+  8011f7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8011fa:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8011fd:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801200:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801203:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801208:	74 09                	je     801213 <cpuid+0x46>
+}
+  80120a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80120e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801211:	89 10                	mov    %edx,(%rax)
+
+  801213:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801218:	74 09                	je     801223 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  80121a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80121e:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801221:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801223:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801228:	74 09                	je     801233 <cpuid+0x66>
+char *
+  80122a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80122e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801231:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801233:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801238:	74 09                	je     801243 <cpuid+0x76>
+  for (; *s; s++)
+  80123a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80123e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801241:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801243:	90                   	nop
+  801244:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801248:	c9                   	leave
+  801249:	c3                   	ret
+
+000000000080124a <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80124a:	55                   	push   %rbp
+  80124b:	48 89 e5             	mov    %rsp,%rbp
+  80124e:	48 83 ec 18          	sub    $0x18,%rsp
+  801252:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801255:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801258:	89 c1                	mov    %eax,%ecx
+  80125a:	0f 01 d0             	xgetbv
+  80125d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801260:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801263:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801266:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801269:	48 c1 e2 20          	shl    $0x20,%rdx
+  80126d:	48 09 d0             	or     %rdx,%rax
+#else
+  801270:	c9                   	leave
+  801271:	c3                   	ret
+
+0000000000801272 <string_cpu>:
+string_cpu(void) {
+  801272:	55                   	push   %rbp
+  801273:	48 89 e5             	mov    %rsp,%rbp
+  801276:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80127a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801281:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801288:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80128f:	00 00 00 
+  801292:	8b 00                	mov    (%rax),%eax
+  801294:	85 c0                	test   %eax,%eax
+  801296:	78 11                	js     8012a9 <string_cpu+0x37>
+    return string_features;
+  801298:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80129f:	00 00 00 
+  8012a2:	8b 00                	mov    (%rax),%eax
+  8012a4:	e9 df 00 00 00       	jmp    801388 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8012a9:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8012ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bd:	48 89 c6             	mov    %rax,%rsi
+  8012c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012c5:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  8012cc:	00 00 00 
+  8012cf:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8012d1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8012d4:	83 f8 06             	cmp    $0x6,%eax
+  8012d7:	76 28                	jbe    801301 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8012d9:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8012dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012e8:	48 89 c2             	mov    %rax,%rdx
+  8012eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8012f0:	bf 07 00 00 00       	mov    $0x7,%edi
+  8012f5:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  8012fc:	00 00 00 
+  8012ff:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801301:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801304:	25 00 02 00 00       	and    $0x200,%eax
+  801309:	85 c0                	test   %eax,%eax
+  80130b:	74 04                	je     801311 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  80130d:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801311:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801315:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80131b:	48 89 c1             	mov    %rax,%rcx
+  80131e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801323:	be 00 00 00 00       	mov    $0x0,%esi
+  801328:	bf 01 00 00 00       	mov    $0x1,%edi
+  80132d:	48 b8 cd 11 80 00 00 	movabs $0x8011cd,%rax
+  801334:	00 00 00 
+  801337:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801339:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80133c:	83 e0 20             	and    $0x20,%eax
+  80133f:	85 c0                	test   %eax,%eax
+  801341:	74 2a                	je     80136d <string_cpu+0xfb>
+  801343:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801346:	25 00 00 00 08       	and    $0x8000000,%eax
+  80134b:	85 c0                	test   %eax,%eax
+  80134d:	74 1e                	je     80136d <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80134f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801354:	48 b8 4a 12 80 00 00 	movabs $0x80124a,%rax
+  80135b:	00 00 00 
+  80135e:	ff d0                	call   *%rax
+  801360:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801363:	48 83 f8 06          	cmp    $0x6,%rax
+  801367:	75 04                	jne    80136d <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801369:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  80136d:	48 ba 08 80 80 00 00 	movabs $0x808008,%rdx
+  801374:	00 00 00 
+  801377:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80137a:	89 02                	mov    %eax,(%rdx)
+  80137c:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  801383:	00 00 00 
+  801386:	8b 00                	mov    (%rax),%eax
+}
+  801388:	c9                   	leave
+  801389:	c3                   	ret
+
+000000000080138a <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80138a:	55                   	push   %rbp
+  80138b:	48 89 e5             	mov    %rsp,%rbp
+  80138e:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801392:	48 83 ec 60          	sub    $0x60,%rsp
+  801396:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  80139b:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8013a0:	83 e0 1f             	and    $0x1f,%eax
+  8013a3:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8013a7:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8013ab:	48 f7 d8             	neg    %rax
+  8013ae:	48 89 c2             	mov    %rax,%rdx
+  8013b1:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8013b6:	48 01 d0             	add    %rdx,%rax
+  8013b9:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  8013be:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  8013c2:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8013c8:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8013cd:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8013d1:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8013d7:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8013db:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013df:	89 c2                	mov    %eax,%edx
+  8013e1:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8013e5:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8013ea:	89 c1                	mov    %eax,%ecx
+  8013ec:	d3 e6                	shl    %cl,%esi
+  8013ee:	89 f0                	mov    %esi,%eax
+  8013f0:	21 d0                	and    %edx,%eax
+  8013f2:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8013f6:	eb 21                	jmp    801419 <strlen_avx2+0x8f>
+    p += 32;
+  8013f8:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8013fe:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801403:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801407:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80140d:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801411:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801415:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801419:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  80141e:	74 d8                	je     8013f8 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801420:	31 c0                	xor    %eax,%eax
+  801422:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801428:	48 63 d0             	movslq %eax,%rdx
+  80142b:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801430:	48 01 d0             	add    %rdx,%rax
+  801433:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801438:	c9                   	leave
+  801439:	c3                   	ret
+
+000000000080143a <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80143a:	55                   	push   %rbp
+  80143b:	48 89 e5             	mov    %rsp,%rbp
+  80143e:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801442:	48 83 ec 40          	sub    $0x40,%rsp
+  801446:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80144b:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801450:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801455:	eb 77                	jmp    8014ce <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801457:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80145c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801460:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801464:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801469:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80146d:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801471:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801475:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801479:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  80147e:	74 3c                	je     8014bc <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801480:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801484:	f7 d0                	not    %eax
+  801486:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80148a:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  80148e:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801492:	48 63 d0             	movslq %eax,%rdx
+  801495:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80149a:	48 01 d0             	add    %rdx,%rax
+  80149d:	0f b6 00             	movzbl (%rax),%eax
+  8014a0:	0f b6 c0             	movzbl %al,%eax
+  8014a3:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8014a7:	48 63 ca             	movslq %edx,%rcx
+  8014aa:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8014af:	48 01 ca             	add    %rcx,%rdx
+  8014b2:	0f b6 12             	movzbl (%rdx),%edx
+  8014b5:	0f b6 d2             	movzbl %dl,%edx
+  8014b8:	29 d0                	sub    %edx,%eax
+  8014ba:	eb 6b                	jmp    801527 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8014bc:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8014c2:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8014c8:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8014ce:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8014d4:	77 81                	ja     801457 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8014d6:	eb 42                	jmp    80151a <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8014d8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014dd:	0f b6 10             	movzbl (%rax),%edx
+  8014e0:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8014e5:	0f b6 00             	movzbl (%rax),%eax
+  8014e8:	38 c2                	cmp    %al,%dl
+  8014ea:	74 1c                	je     801508 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8014ec:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014f1:	0f b6 00             	movzbl (%rax),%eax
+  8014f4:	0f b6 c8             	movzbl %al,%ecx
+  8014f7:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8014fc:	0f b6 00             	movzbl (%rax),%eax
+  8014ff:	0f b6 d0             	movzbl %al,%edx
+  801502:	89 c8                	mov    %ecx,%eax
+  801504:	29 d0                	sub    %edx,%eax
+  801506:	eb 1f                	jmp    801527 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801508:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80150e:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801514:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80151a:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801520:	75 b6                	jne    8014d8 <memcmp_avx2+0x9e>
+  return 0;
+  801522:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+
+0000000000801529 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801529:	55                   	push   %rbp
+  80152a:	48 89 e5             	mov    %rsp,%rbp
+  80152d:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801531:	48 83 ec 60          	sub    $0x60,%rsp
+  801535:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80153a:	89 f0                	mov    %esi,%eax
+  80153c:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801541:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801545:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80154a:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80154e:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801553:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801559:	eb 47                	jmp    8015a2 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80155b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801560:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801564:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801568:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80156e:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801572:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801576:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80157a:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80157f:	74 15                	je     801596 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801581:	31 c0                	xor    %eax,%eax
+  801583:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801589:	48 63 d0             	movslq %eax,%rdx
+  80158c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801591:	48 01 d0             	add    %rdx,%rax
+  801594:	eb 3d                	jmp    8015d3 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801596:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80159c:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8015a2:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8015a8:	77 b1                	ja     80155b <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8015aa:	eb 0c                	jmp    8015b8 <memfind_avx2+0x8f>
+  8015ac:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8015b2:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8015b8:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8015be:	74 0e                	je     8015ce <memfind_avx2+0xa5>
+  8015c0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015c5:	0f b6 00             	movzbl (%rax),%eax
+  8015c8:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8015cc:	75 de                	jne    8015ac <memfind_avx2+0x83>
+  return s;
+  8015ce:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8015d3:	c9                   	leave
+  8015d4:	c3                   	ret
+
+00000000008015d5 <strlen>:
+strlen(const char *s) {
+  8015d5:	55                   	push   %rbp
+  8015d6:	48 89 e5             	mov    %rsp,%rbp
+  8015d9:	48 83 ec 40          	sub    $0x40,%rsp
+  8015dd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8015e1:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8015e5:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8015e9:	48 b8 72 12 80 00 00 	movabs $0x801272,%rax
+  8015f0:	00 00 00 
+  8015f3:	ff d0                	call   *%rax
+  8015f5:	83 e0 02             	and    $0x2,%eax
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	74 18                	je     801614 <strlen+0x3f>
+    return strlen_avx2(s);
+  8015fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801600:	48 89 c7             	mov    %rax,%rdi
+  801603:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  80160a:	00 00 00 
+  80160d:	ff d0                	call   *%rax
+  80160f:	e9 82 00 00 00       	jmp    801696 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801614:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801618:	83 e0 0f             	and    $0xf,%eax
+  80161b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  80161e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801621:	48 f7 d8             	neg    %rax
+  801624:	48 89 c2             	mov    %rax,%rdx
+  801627:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80162b:	48 01 d0             	add    %rdx,%rax
+  80162e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801632:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801636:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80163a:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80163f:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801643:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801647:	89 c2                	mov    %eax,%edx
+  801649:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80164c:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801651:	89 c1                	mov    %eax,%ecx
+  801653:	d3 e6                	shl    %cl,%esi
+  801655:	89 f0                	mov    %esi,%eax
+  801657:	21 d0                	and    %edx,%eax
+  801659:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80165c:	eb 1d                	jmp    80167b <strlen+0xa6>
+    p += 16;
+  80165e:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801663:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801667:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80166b:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801670:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801674:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801678:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80167b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80167f:	74 dd                	je     80165e <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801681:	31 c0                	xor    %eax,%eax
+  801683:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801688:	48 63 d0             	movslq %eax,%rdx
+  80168b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80168f:	48 01 d0             	add    %rdx,%rax
+  801692:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801696:	c9                   	leave
+  801697:	c3                   	ret
+
+0000000000801698 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801698:	55                   	push   %rbp
+  801699:	48 89 e5             	mov    %rsp,%rbp
+  80169c:	48 83 ec 20          	sub    $0x20,%rsp
+  8016a0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016a4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8016a8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8016af:	eb 0e                	jmp    8016bf <strnlen+0x27>
+    n++;
+  8016b1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8016b5:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8016ba:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  8016bf:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8016c4:	74 0b                	je     8016d1 <strnlen+0x39>
+  8016c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ca:	0f b6 00             	movzbl (%rax),%eax
+  8016cd:	84 c0                	test   %al,%al
+  8016cf:	75 e0                	jne    8016b1 <strnlen+0x19>
+  return n;
+  8016d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8016d4:	c9                   	leave
+  8016d5:	c3                   	ret
+
+00000000008016d6 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8016d6:	55                   	push   %rbp
+  8016d7:	48 89 e5             	mov    %rsp,%rbp
+  8016da:	48 83 ec 20          	sub    $0x20,%rsp
+  8016de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8016e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8016ee:	90                   	nop
+  8016ef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016f3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016f7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016fb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ff:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801703:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801707:	0f b6 12             	movzbl (%rdx),%edx
+  80170a:	88 10                	mov    %dl,(%rax)
+  80170c:	0f b6 00             	movzbl (%rax),%eax
+  80170f:	84 c0                	test   %al,%al
+  801711:	75 dc                	jne    8016ef <strcpy+0x19>
+  return ret;
+  801713:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801717:	c9                   	leave
+  801718:	c3                   	ret
+
+0000000000801719 <strcat>:
+strcat(char *dst, const char *src) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	48 83 ec 20          	sub    $0x20,%rsp
+  801721:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801725:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801729:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80172d:	48 89 c7             	mov    %rax,%rdi
+  801730:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  801737:	00 00 00 
+  80173a:	ff d0                	call   *%rax
+  80173c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80173f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801742:	48 63 d0             	movslq %eax,%rdx
+  801745:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801749:	48 01 c2             	add    %rax,%rdx
+  80174c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801750:	48 89 c6             	mov    %rax,%rsi
+  801753:	48 89 d7             	mov    %rdx,%rdi
+  801756:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  80175d:	00 00 00 
+  801760:	ff d0                	call   *%rax
+  return dst;
+  801762:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+0000000000801768 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+  80176c:	48 83 ec 28          	sub    $0x28,%rsp
+  801770:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801774:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801778:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80177c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801780:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801784:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80178b:	00 
+  80178c:	eb 2a                	jmp    8017b8 <strncpy+0x50>
+    *dst++ = *src;
+  80178e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801792:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801796:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80179a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80179e:	0f b6 12             	movzbl (%rdx),%edx
+  8017a1:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8017a3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017a7:	0f b6 00             	movzbl (%rax),%eax
+  8017aa:	84 c0                	test   %al,%al
+  8017ac:	74 05                	je     8017b3 <strncpy+0x4b>
+      src++;
+  8017ae:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8017b3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017bc:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8017c0:	72 cc                	jb     80178e <strncpy+0x26>
+  return ret;
+  8017c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8017c6:	c9                   	leave
+  8017c7:	c3                   	ret
+
+00000000008017c8 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8017c8:	55                   	push   %rbp
+  8017c9:	48 89 e5             	mov    %rsp,%rbp
+  8017cc:	48 83 ec 28          	sub    $0x28,%rsp
+  8017d0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017d4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017d8:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8017dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8017e4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017e9:	74 3d                	je     801828 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8017eb:	eb 1d                	jmp    80180a <strlcpy+0x42>
+      *dst++ = *src++;
+  8017ed:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017f1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017f5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017fd:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801801:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801805:	0f b6 12             	movzbl (%rdx),%edx
+  801808:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80180a:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80180f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801814:	74 0b                	je     801821 <strlcpy+0x59>
+  801816:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80181a:	0f b6 00             	movzbl (%rax),%eax
+  80181d:	84 c0                	test   %al,%al
+  80181f:	75 cc                	jne    8017ed <strlcpy+0x25>
+    *dst = '\0';
+  801821:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801825:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80182c:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801830:	c9                   	leave
+  801831:	c3                   	ret
+
+0000000000801832 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801832:	55                   	push   %rbp
+  801833:	48 89 e5             	mov    %rsp,%rbp
+  801836:	48 83 ec 30          	sub    $0x30,%rsp
+  80183a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80183e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801842:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801846:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80184a:	48 89 c7             	mov    %rax,%rdi
+  80184d:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+  801859:	48 98                	cltq
+  80185b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80185f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801863:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801867:	48 89 d6             	mov    %rdx,%rsi
+  80186a:	48 89 c7             	mov    %rax,%rdi
+  80186d:	48 b8 98 16 80 00 00 	movabs $0x801698,%rax
+  801874:	00 00 00 
+  801877:	ff d0                	call   *%rax
+  801879:	48 98                	cltq
+  80187b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80187f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801883:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801887:	75 10                	jne    801899 <strlcat+0x67>
+    return maxlen + srclen;
+  801889:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80188d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801891:	48 01 d0             	add    %rdx,%rax
+  801894:	e9 86 00 00 00       	jmp    80191f <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801899:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80189d:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8018a1:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8018a5:	73 2b                	jae    8018d2 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8018a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ab:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018af:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8018b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018b7:	48 01 c1             	add    %rax,%rcx
+  8018ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018be:	48 89 c6             	mov    %rax,%rsi
+  8018c1:	48 89 cf             	mov    %rcx,%rdi
+  8018c4:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  8018cb:	00 00 00 
+  8018ce:	ff d0                	call   *%rax
+  8018d0:	eb 42                	jmp    801914 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8018d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018d6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018da:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8018de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018e2:	48 01 c1             	add    %rax,%rcx
+  8018e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018e9:	48 89 c6             	mov    %rax,%rsi
+  8018ec:	48 89 cf             	mov    %rcx,%rdi
+  8018ef:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  8018f6:	00 00 00 
+  8018f9:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8018fb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8018ff:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801903:	48 01 d0             	add    %rdx,%rax
+  801906:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80190a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80190e:	48 01 d0             	add    %rdx,%rax
+  801911:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801914:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801918:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80191c:	48 01 d0             	add    %rdx,%rax
+}
+  80191f:	c9                   	leave
+  801920:	c3                   	ret
+
+0000000000801921 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801921:	55                   	push   %rbp
+  801922:	48 89 e5             	mov    %rsp,%rbp
+  801925:	48 83 ec 10          	sub    $0x10,%rsp
+  801929:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80192d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801931:	eb 0a                	jmp    80193d <strcmp+0x1c>
+    p++, q++;
+  801933:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801938:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  80193d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801941:	0f b6 00             	movzbl (%rax),%eax
+  801944:	84 c0                	test   %al,%al
+  801946:	74 12                	je     80195a <strcmp+0x39>
+  801948:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80194c:	0f b6 10             	movzbl (%rax),%edx
+  80194f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801953:	0f b6 00             	movzbl (%rax),%eax
+  801956:	38 c2                	cmp    %al,%dl
+  801958:	74 d9                	je     801933 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80195a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80195e:	0f b6 00             	movzbl (%rax),%eax
+  801961:	0f b6 d0             	movzbl %al,%edx
+  801964:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801968:	0f b6 00             	movzbl (%rax),%eax
+  80196b:	0f b6 c0             	movzbl %al,%eax
+  80196e:	29 c2                	sub    %eax,%edx
+  801970:	89 d0                	mov    %edx,%eax
+}
+  801972:	c9                   	leave
+  801973:	c3                   	ret
+
+0000000000801974 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801974:	55                   	push   %rbp
+  801975:	48 89 e5             	mov    %rsp,%rbp
+  801978:	48 83 ec 18          	sub    $0x18,%rsp
+  80197c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801980:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801984:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801988:	eb 0f                	jmp    801999 <strncmp+0x25>
+    n--, p++, q++;
+  80198a:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80198f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801994:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801999:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80199e:	74 1d                	je     8019bd <strncmp+0x49>
+  8019a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019a4:	0f b6 00             	movzbl (%rax),%eax
+  8019a7:	84 c0                	test   %al,%al
+  8019a9:	74 12                	je     8019bd <strncmp+0x49>
+  8019ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019af:	0f b6 10             	movzbl (%rax),%edx
+  8019b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019b6:	0f b6 00             	movzbl (%rax),%eax
+  8019b9:	38 c2                	cmp    %al,%dl
+  8019bb:	74 cd                	je     80198a <strncmp+0x16>
+  if (n == 0)
+  8019bd:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8019c2:	75 07                	jne    8019cb <strncmp+0x57>
+    return 0;
+  8019c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019c9:	eb 16                	jmp    8019e1 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8019cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019cf:	0f b6 00             	movzbl (%rax),%eax
+  8019d2:	0f b6 d0             	movzbl %al,%edx
+  8019d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d9:	0f b6 00             	movzbl (%rax),%eax
+  8019dc:	0f b6 c0             	movzbl %al,%eax
+  8019df:	29 c2                	sub    %eax,%edx
+}
+  8019e1:	89 d0                	mov    %edx,%eax
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+
+00000000008019e5 <strchr>:
+strchr(const char *s, char c) {
+  8019e5:	55                   	push   %rbp
+  8019e6:	48 89 e5             	mov    %rsp,%rbp
+  8019e9:	48 83 ec 60          	sub    $0x60,%rsp
+  8019ed:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019f1:	89 f0                	mov    %esi,%eax
+  8019f3:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8019f6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8019fa:	83 e0 0f             	and    $0xf,%eax
+  8019fd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801a00:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a03:	48 f7 d8             	neg    %rax
+  801a06:	48 89 c2             	mov    %rax,%rdx
+  801a09:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a0d:	48 01 d0             	add    %rdx,%rax
+  801a10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801a14:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801a18:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801a1c:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801a20:	66 0f 6e c0          	movd   %eax,%xmm0
+  801a24:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801a28:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801a2c:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801a31:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801a35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a39:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801a3d:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801a41:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a46:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801a4b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a4f:	89 c2                	mov    %eax,%edx
+  801a51:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a56:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801a5b:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a5f:	09 c2                	or     %eax,%edx
+  801a61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a64:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801a69:	89 c1                	mov    %eax,%ecx
+  801a6b:	d3 e6                	shl    %cl,%esi
+  801a6d:	89 f0                	mov    %esi,%eax
+  801a6f:	21 d0                	and    %edx,%eax
+  801a71:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801a74:	eb 34                	jmp    801aaa <strchr+0xc5>
+    p += 16;
+  801a76:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801a7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7f:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801a83:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801a87:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a8c:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801a91:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a95:	89 c2                	mov    %eax,%edx
+  801a97:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a9c:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801aa1:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801aa5:	09 d0                	or     %edx,%eax
+  801aa7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801aaa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801aae:	74 c6                	je     801a76 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801ab0:	31 c0                	xor    %eax,%eax
+  801ab2:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801ab7:	48 98                	cltq
+  801ab9:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801abd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ac1:	0f b6 00             	movzbl (%rax),%eax
+  801ac4:	84 c0                	test   %al,%al
+  801ac6:	74 06                	je     801ace <strchr+0xe9>
+  801ac8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801acc:	eb 05                	jmp    801ad3 <strchr+0xee>
+  801ace:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ad3:	c9                   	leave
+  801ad4:	c3                   	ret
+
+0000000000801ad5 <strfind>:
+strfind(const char *s, char c) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	48 83 ec 10          	sub    $0x10,%rsp
+  801add:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ae1:	89 f0                	mov    %esi,%eax
+  801ae3:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801ae6:	eb 11                	jmp    801af9 <strfind+0x24>
+    if (*s == c)
+  801ae8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aec:	0f b6 00             	movzbl (%rax),%eax
+  801aef:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801af2:	74 12                	je     801b06 <strfind+0x31>
+  for (; *s; s++)
+  801af4:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801af9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801afd:	0f b6 00             	movzbl (%rax),%eax
+  801b00:	84 c0                	test   %al,%al
+  801b02:	75 e4                	jne    801ae8 <strfind+0x13>
+  801b04:	eb 01                	jmp    801b07 <strfind+0x32>
+      break;
+  801b06:	90                   	nop
+  return (char *)s;
+  801b07:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801b0b:	c9                   	leave
+  801b0c:	c3                   	ret
+
+0000000000801b0d <memset>:
+memset(void *v, int c, size_t n) {
+  801b0d:	55                   	push   %rbp
+  801b0e:	48 89 e5             	mov    %rsp,%rbp
+  801b11:	48 83 ec 38          	sub    $0x38,%rsp
+  801b15:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b19:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801b1c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801b20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801b28:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801b2d:	76 41                	jbe    801b70 <memset+0x63>
+  801b2f:	48 b8 72 12 80 00 00 	movabs $0x801272,%rax
+  801b36:	00 00 00 
+  801b39:	ff d0                	call   *%rax
+  801b3b:	83 e0 01             	and    $0x1,%eax
+  801b3e:	85 c0                	test   %eax,%eax
+  801b40:	74 2e                	je     801b70 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801b42:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801b45:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b49:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b4d:	48 89 ce             	mov    %rcx,%rsi
+  801b50:	48 89 f7             	mov    %rsi,%rdi
+  801b53:	48 89 d1             	mov    %rdx,%rcx
+  801b56:	fc                   	cld
+  801b57:	f3 aa                	rep stos %al,%es:(%rdi)
+  801b59:	48 89 ca             	mov    %rcx,%rdx
+  801b5c:	48 89 fe             	mov    %rdi,%rsi
+  801b5f:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801b63:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801b67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b6b:	e9 a7 00 00 00       	jmp    801c17 <memset+0x10a>
+  if (n >= 8) {
+  801b70:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b75:	0f 86 87 00 00 00    	jbe    801c02 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801b7b:	eb 16                	jmp    801b93 <memset+0x86>
+      *p++ = c;
+  801b7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b81:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b85:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b89:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801b8c:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801b8e:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b97:	83 e0 07             	and    $0x7,%eax
+  801b9a:	48 85 c0             	test   %rax,%rax
+  801b9d:	75 de                	jne    801b7d <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801b9f:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801ba2:	0f b6 c0             	movzbl %al,%eax
+  801ba5:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801bac:	01 01 01 
+  801baf:	48 0f af c2          	imul   %rdx,%rax
+  801bb3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801bb7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bbb:	48 c1 e8 03          	shr    $0x3,%rax
+  801bbf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801bc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bc7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801bcb:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801bcf:	48 89 ce             	mov    %rcx,%rsi
+  801bd2:	48 89 f7             	mov    %rsi,%rdi
+  801bd5:	48 89 d1             	mov    %rdx,%rcx
+  801bd8:	fc                   	cld
+  801bd9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801bdc:	48 89 ca             	mov    %rcx,%rdx
+  801bdf:	48 89 fe             	mov    %rdi,%rsi
+  801be2:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801be6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801bea:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801bef:	eb 11                	jmp    801c02 <memset+0xf5>
+    *p++ = c;
+  801bf1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bf9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bfd:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801c00:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801c02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c06:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c0a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c0e:	48 85 c0             	test   %rax,%rax
+  801c11:	75 de                	jne    801bf1 <memset+0xe4>
+  return v;
+  801c13:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801c17:	c9                   	leave
+  801c18:	c3                   	ret
+
+0000000000801c19 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801c19:	55                   	push   %rbp
+  801c1a:	48 89 e5             	mov    %rsp,%rbp
+  801c1d:	48 83 ec 38          	sub    $0x38,%rsp
+  801c21:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c25:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c29:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801c2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c31:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801c35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c39:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801c3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c41:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801c45:	0f 83 da 00 00 00    	jae    801d25 <memmove+0x10c>
+  801c4b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c4f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c53:	48 01 d0             	add    %rdx,%rax
+  801c56:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801c5a:	0f 83 c5 00 00 00    	jae    801d25 <memmove+0x10c>
+    s += n;
+  801c60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c64:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801c68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c6c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801c70:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c75:	0f 86 94 00 00 00    	jbe    801d0f <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801c7b:	eb 1c                	jmp    801c99 <memmove+0x80>
+        *--d = *--s;
+  801c7d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801c82:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801c87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c8b:	0f b6 10             	movzbl (%rax),%edx
+  801c8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c92:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c94:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c9d:	83 e0 07             	and    $0x7,%eax
+  801ca0:	48 85 c0             	test   %rax,%rax
+  801ca3:	75 d8                	jne    801c7d <memmove+0x64>
+      nq = n / 8;
+  801ca5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ca9:	48 c1 e8 03          	shr    $0x3,%rax
+  801cad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801cb1:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801cb6:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801cbb:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801cc0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cc4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ccc:	48 89 cf             	mov    %rcx,%rdi
+  801ccf:	48 89 d6             	mov    %rdx,%rsi
+  801cd2:	48 89 c1             	mov    %rax,%rcx
+  801cd5:	fd                   	std
+  801cd6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801cd9:	fc                   	cld
+  801cda:	48 89 c8             	mov    %rcx,%rax
+  801cdd:	48 89 f2             	mov    %rsi,%rdx
+  801ce0:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ce4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ce8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801cec:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801cf1:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801cf6:	eb 17                	jmp    801d0f <memmove+0xf6>
+      *--d = *--s;
+  801cf8:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801cfd:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801d02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d06:	0f b6 10             	movzbl (%rax),%edx
+  801d09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d0d:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801d0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d13:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d17:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d1b:	48 85 c0             	test   %rax,%rax
+  801d1e:	75 d8                	jne    801cf8 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801d20:	e9 f4 00 00 00       	jmp    801e19 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801d25:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801d2a:	76 46                	jbe    801d72 <memmove+0x159>
+  801d2c:	48 b8 72 12 80 00 00 	movabs $0x801272,%rax
+  801d33:	00 00 00 
+  801d36:	ff d0                	call   *%rax
+  801d38:	83 e0 01             	and    $0x1,%eax
+  801d3b:	85 c0                	test   %eax,%eax
+  801d3d:	74 33                	je     801d72 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801d3f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d43:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d4b:	48 89 cf             	mov    %rcx,%rdi
+  801d4e:	48 89 d6             	mov    %rdx,%rsi
+  801d51:	48 89 c1             	mov    %rax,%rcx
+  801d54:	fc                   	cld
+  801d55:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801d57:	48 89 c8             	mov    %rcx,%rax
+  801d5a:	48 89 f2             	mov    %rsi,%rdx
+  801d5d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801d61:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d65:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801d69:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d6d:	e9 ab 00 00 00       	jmp    801e1d <memmove+0x204>
+    if (n >= 8) {
+  801d72:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801d77:	0f 86 8b 00 00 00    	jbe    801e08 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801d7d:	eb 22                	jmp    801da1 <memmove+0x188>
+        *d++ = *s++;
+  801d7f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d83:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801d87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d8f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d93:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801d97:	0f b6 12             	movzbl (%rdx),%edx
+  801d9a:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801d9c:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801da1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801da5:	83 e0 07             	and    $0x7,%eax
+  801da8:	48 85 c0             	test   %rax,%rax
+  801dab:	75 d2                	jne    801d7f <memmove+0x166>
+      nq = n / 8;
+  801dad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801db1:	48 c1 e8 03          	shr    $0x3,%rax
+  801db5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801db9:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801dbd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801dc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801dc5:	48 89 cf             	mov    %rcx,%rdi
+  801dc8:	48 89 d6             	mov    %rdx,%rsi
+  801dcb:	48 89 c1             	mov    %rax,%rcx
+  801dce:	fc                   	cld
+  801dcf:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801dd2:	48 89 c8             	mov    %rcx,%rax
+  801dd5:	48 89 f2             	mov    %rsi,%rdx
+  801dd8:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ddc:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801de0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801de4:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801de9:	eb 1d                	jmp    801e08 <memmove+0x1ef>
+      *d++ = *s++;
+  801deb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801def:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801df3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801df7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dfb:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801dff:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801e03:	0f b6 12             	movzbl (%rdx),%edx
+  801e06:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801e08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e0c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e10:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e14:	48 85 c0             	test   %rax,%rax
+  801e17:	75 d2                	jne    801deb <memmove+0x1d2>
+  return dst;
+  801e19:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801e1d:	c9                   	leave
+  801e1e:	c3                   	ret
+
+0000000000801e1f <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801e1f:	55                   	push   %rbp
+  801e20:	48 89 e5             	mov    %rsp,%rbp
+  801e23:	48 83 ec 18          	sub    $0x18,%rsp
+  801e27:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e2b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e2f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801e33:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e37:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e3b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e3f:	48 89 ce             	mov    %rcx,%rsi
+  801e42:	48 89 c7             	mov    %rax,%rdi
+  801e45:	48 b8 19 1c 80 00 00 	movabs $0x801c19,%rax
+  801e4c:	00 00 00 
+  801e4f:	ff d0                	call   *%rax
+}
+  801e51:	c9                   	leave
+  801e52:	c3                   	ret
+
+0000000000801e53 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801e53:	55                   	push   %rbp
+  801e54:	48 89 e5             	mov    %rsp,%rbp
+  801e57:	48 83 ec 40          	sub    $0x40,%rsp
+  801e5b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e5f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801e63:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801e67:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e6b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801e6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e73:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801e77:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801e7c:	0f 86 a7 00 00 00    	jbe    801f29 <memcmp+0xd6>
+  801e82:	48 b8 72 12 80 00 00 	movabs $0x801272,%rax
+  801e89:	00 00 00 
+  801e8c:	ff d0                	call   *%rax
+  801e8e:	83 e0 02             	and    $0x2,%eax
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	0f 84 90 00 00 00    	je     801f29 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801e99:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e9d:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ea1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ea5:	48 89 ce             	mov    %rcx,%rsi
+  801ea8:	48 89 c7             	mov    %rax,%rdi
+  801eab:	48 b8 3a 14 80 00 00 	movabs $0x80143a,%rax
+  801eb2:	00 00 00 
+  801eb5:	ff d0                	call   *%rax
+  801eb7:	e9 c2 00 00 00       	jmp    801f7e <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801ebc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ec0:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ec4:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801ec8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ecc:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ed0:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ed4:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ed8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801edb:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801ee2:	74 36                	je     801f1a <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801ee4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ee7:	f7 d0                	not    %eax
+  801ee9:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801eed:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801ef0:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801ef3:	48 63 d0             	movslq %eax,%rdx
+  801ef6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801efa:	48 01 d0             	add    %rdx,%rax
+  801efd:	0f b6 00             	movzbl (%rax),%eax
+  801f00:	0f b6 c0             	movzbl %al,%eax
+  801f03:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801f06:	48 63 ca             	movslq %edx,%rcx
+  801f09:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801f0d:	48 01 ca             	add    %rcx,%rdx
+  801f10:	0f b6 12             	movzbl (%rdx),%edx
+  801f13:	0f b6 d2             	movzbl %dl,%edx
+  801f16:	29 d0                	sub    %edx,%eax
+  801f18:	eb 64                	jmp    801f7e <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801f1a:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801f1f:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801f24:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801f29:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801f2e:	77 8c                	ja     801ebc <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801f30:	eb 36                	jmp    801f68 <memcmp+0x115>
+    if (*s1 != *s2)
+  801f32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f36:	0f b6 10             	movzbl (%rax),%edx
+  801f39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f3d:	0f b6 00             	movzbl (%rax),%eax
+  801f40:	38 c2                	cmp    %al,%dl
+  801f42:	74 1a                	je     801f5e <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801f44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f48:	0f b6 00             	movzbl (%rax),%eax
+  801f4b:	0f b6 c8             	movzbl %al,%ecx
+  801f4e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f52:	0f b6 00             	movzbl (%rax),%eax
+  801f55:	0f b6 d0             	movzbl %al,%edx
+  801f58:	89 c8                	mov    %ecx,%eax
+  801f5a:	29 d0                	sub    %edx,%eax
+  801f5c:	eb 20                	jmp    801f7e <memcmp+0x12b>
+    s1++, s2++;
+  801f5e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801f63:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801f68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f6c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f70:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f74:	48 85 c0             	test   %rax,%rax
+  801f77:	75 b9                	jne    801f32 <memcmp+0xdf>
+  }
+
+  return 0;
+  801f79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f7e:	c9                   	leave
+  801f7f:	c3                   	ret
+
+0000000000801f80 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801f80:	55                   	push   %rbp
+  801f81:	48 89 e5             	mov    %rsp,%rbp
+  801f84:	48 83 ec 50          	sub    $0x50,%rsp
+  801f88:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801f8c:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801f8f:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801f93:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f97:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801f9b:	48 01 d0             	add    %rdx,%rax
+  801f9e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801fa2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801fa5:	66 0f 6e c0          	movd   %eax,%xmm0
+  801fa9:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801fad:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801fb1:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801fb6:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801fba:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801fbf:	76 73                	jbe    802034 <memfind+0xb4>
+  801fc1:	48 b8 72 12 80 00 00 	movabs $0x801272,%rax
+  801fc8:	00 00 00 
+  801fcb:	ff d0                	call   *%rax
+  801fcd:	83 e0 02             	and    $0x2,%eax
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	74 60                	je     802034 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801fd4:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801fd7:	0f b6 c8             	movzbl %al,%ecx
+  801fda:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801fde:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fe2:	89 ce                	mov    %ecx,%esi
+  801fe4:	48 89 c7             	mov    %rax,%rdi
+  801fe7:	48 b8 29 15 80 00 00 	movabs $0x801529,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+  801ff3:	eb 6c                	jmp    802061 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801ff5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ff9:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801ffd:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  802001:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  802006:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80200a:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80200e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802011:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802015:	74 13                	je     80202a <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  802017:	31 c0                	xor    %eax,%eax
+  802019:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  80201e:	48 63 d0             	movslq %eax,%rdx
+  802021:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802025:	48 01 d0             	add    %rdx,%rax
+  802028:	eb 37                	jmp    802061 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  80202a:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  80202f:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802034:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  802039:	77 ba                	ja     801ff5 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  80203b:	eb 13                	jmp    802050 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  80203d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802041:	0f b6 00             	movzbl (%rax),%eax
+  802044:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802047:	38 d0                	cmp    %dl,%al
+  802049:	74 11                	je     80205c <memfind+0xdc>
+  for (; s < ends; s++)
+  80204b:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802050:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802054:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802058:	72 e3                	jb     80203d <memfind+0xbd>
+  80205a:	eb 01                	jmp    80205d <memfind+0xdd>
+      break;
+  80205c:	90                   	nop
+  return (void *)s;
+  80205d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802061:	c9                   	leave
+  802062:	c3                   	ret
+
+0000000000802063 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802063:	55                   	push   %rbp
+  802064:	48 89 e5             	mov    %rsp,%rbp
+  802067:	48 83 ec 38          	sub    $0x38,%rsp
+  80206b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80206f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802073:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802076:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  80207d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802084:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802085:	eb 05                	jmp    80208c <strtol+0x29>
+    s++;
+  802087:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  80208c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802090:	0f b6 00             	movzbl (%rax),%eax
+  802093:	3c 20                	cmp    $0x20,%al
+  802095:	74 f0                	je     802087 <strtol+0x24>
+  802097:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80209b:	0f b6 00             	movzbl (%rax),%eax
+  80209e:	3c 09                	cmp    $0x9,%al
+  8020a0:	74 e5                	je     802087 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  8020a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020a6:	0f b6 00             	movzbl (%rax),%eax
+  8020a9:	3c 2b                	cmp    $0x2b,%al
+  8020ab:	75 07                	jne    8020b4 <strtol+0x51>
+    s++;
+  8020ad:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8020b2:	eb 17                	jmp    8020cb <strtol+0x68>
+  else if (*s == '-')
+  8020b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020b8:	0f b6 00             	movzbl (%rax),%eax
+  8020bb:	3c 2d                	cmp    $0x2d,%al
+  8020bd:	75 0c                	jne    8020cb <strtol+0x68>
+    s++, neg = 1;
+  8020bf:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8020c4:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8020cb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020cf:	74 06                	je     8020d7 <strtol+0x74>
+  8020d1:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8020d5:	75 28                	jne    8020ff <strtol+0x9c>
+  8020d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020db:	0f b6 00             	movzbl (%rax),%eax
+  8020de:	3c 30                	cmp    $0x30,%al
+  8020e0:	75 1d                	jne    8020ff <strtol+0x9c>
+  8020e2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020e6:	48 83 c0 01          	add    $0x1,%rax
+  8020ea:	0f b6 00             	movzbl (%rax),%eax
+  8020ed:	3c 78                	cmp    $0x78,%al
+  8020ef:	75 0e                	jne    8020ff <strtol+0x9c>
+    s += 2, base = 16;
+  8020f1:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8020f6:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8020fd:	eb 2c                	jmp    80212b <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8020ff:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802103:	75 19                	jne    80211e <strtol+0xbb>
+  802105:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802109:	0f b6 00             	movzbl (%rax),%eax
+  80210c:	3c 30                	cmp    $0x30,%al
+  80210e:	75 0e                	jne    80211e <strtol+0xbb>
+    s++, base = 8;
+  802110:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802115:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80211c:	eb 0d                	jmp    80212b <strtol+0xc8>
+  else if (base == 0)
+  80211e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802122:	75 07                	jne    80212b <strtol+0xc8>
+    base = 10;
+  802124:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  80212b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80212f:	0f b6 00             	movzbl (%rax),%eax
+  802132:	3c 2f                	cmp    $0x2f,%al
+  802134:	7e 1d                	jle    802153 <strtol+0xf0>
+  802136:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80213a:	0f b6 00             	movzbl (%rax),%eax
+  80213d:	3c 39                	cmp    $0x39,%al
+  80213f:	7f 12                	jg     802153 <strtol+0xf0>
+      dig = *s - '0';
+  802141:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802145:	0f b6 00             	movzbl (%rax),%eax
+  802148:	0f be c0             	movsbl %al,%eax
+  80214b:	83 e8 30             	sub    $0x30,%eax
+  80214e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802151:	eb 4e                	jmp    8021a1 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802153:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802157:	0f b6 00             	movzbl (%rax),%eax
+  80215a:	3c 60                	cmp    $0x60,%al
+  80215c:	7e 1d                	jle    80217b <strtol+0x118>
+  80215e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802162:	0f b6 00             	movzbl (%rax),%eax
+  802165:	3c 7a                	cmp    $0x7a,%al
+  802167:	7f 12                	jg     80217b <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802169:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80216d:	0f b6 00             	movzbl (%rax),%eax
+  802170:	0f be c0             	movsbl %al,%eax
+  802173:	83 e8 57             	sub    $0x57,%eax
+  802176:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802179:	eb 26                	jmp    8021a1 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  80217b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80217f:	0f b6 00             	movzbl (%rax),%eax
+  802182:	3c 40                	cmp    $0x40,%al
+  802184:	7e 47                	jle    8021cd <strtol+0x16a>
+  802186:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80218a:	0f b6 00             	movzbl (%rax),%eax
+  80218d:	3c 5a                	cmp    $0x5a,%al
+  80218f:	7f 3c                	jg     8021cd <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802191:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802195:	0f b6 00             	movzbl (%rax),%eax
+  802198:	0f be c0             	movsbl %al,%eax
+  80219b:	83 e8 37             	sub    $0x37,%eax
+  80219e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  8021a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021a4:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8021a7:	7d 23                	jge    8021cc <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8021a9:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021ae:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8021b1:	48 98                	cltq
+  8021b3:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8021b8:	48 89 c2             	mov    %rax,%rdx
+  8021bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8021be:	48 98                	cltq
+  8021c0:	48 01 d0             	add    %rdx,%rax
+  8021c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8021c7:	e9 5f ff ff ff       	jmp    80212b <strtol+0xc8>
+      break;
+  8021cc:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8021cd:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8021d2:	74 0b                	je     8021df <strtol+0x17c>
+    *endptr = (char *)s;
+  8021d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021d8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8021dc:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8021df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8021e3:	74 09                	je     8021ee <strtol+0x18b>
+  8021e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021e9:	48 f7 d8             	neg    %rax
+  8021ec:	eb 04                	jmp    8021f2 <strtol+0x18f>
+  8021ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8021f2:	c9                   	leave
+  8021f3:	c3                   	ret
+
+00000000008021f4 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8021f4:	55                   	push   %rbp
+  8021f5:	48 89 e5             	mov    %rsp,%rbp
+  8021f8:	53                   	push   %rbx
+  8021f9:	48 83 ec 48          	sub    $0x48,%rsp
+  8021fd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802201:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802205:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802209:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  80220d:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802211:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802215:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802219:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80221d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802221:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802225:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802229:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  80222d:	4c 89 c3             	mov    %r8,%rbx
+  802230:	cd 30                	int    $0x30
+  802232:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802236:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80223b:	74 46                	je     802283 <syscall+0x8f>
+  80223d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802242:	7e 3f                	jle    802283 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802244:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802248:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80224c:	49 89 d0             	mov    %rdx,%r8
+  80224f:	48 89 c1             	mov    %rax,%rcx
+  802252:	48 b8 68 6d 80 00 00 	movabs $0x806d68,%rax
+  802259:	00 00 00 
+  80225c:	48 89 c2             	mov    %rax,%rdx
+  80225f:	be 22 00 00 00       	mov    $0x22,%esi
+  802264:	48 b8 87 6d 80 00 00 	movabs $0x806d87,%rax
+  80226b:	00 00 00 
+  80226e:	48 89 c7             	mov    %rax,%rdi
+  802271:	b8 00 00 00 00       	mov    $0x0,%eax
+  802276:	49 b9 07 05 80 00 00 	movabs $0x800507,%r9
+  80227d:	00 00 00 
+  802280:	41 ff d1             	call   *%r9
+
+  return ret;
+  802283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802287:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80228b:	c9                   	leave
+  80228c:	c3                   	ret
+
+000000000080228d <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  80228d:	55                   	push   %rbp
+  80228e:	48 89 e5             	mov    %rsp,%rbp
+  802291:	48 83 ec 10          	sub    $0x10,%rsp
+  802295:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802299:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  80229d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8022a9:	6a 00                	push   $0x0
+  8022ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022b7:	48 89 d1             	mov    %rdx,%rcx
+  8022ba:	48 89 c2             	mov    %rax,%rdx
+  8022bd:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c7:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  8022ce:	00 00 00 
+  8022d1:	ff d0                	call   *%rax
+  8022d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022d7:	90                   	nop
+  8022d8:	c9                   	leave
+  8022d9:	c3                   	ret
+
+00000000008022da <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8022da:	55                   	push   %rbp
+  8022db:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8022de:	48 83 ec 08          	sub    $0x8,%rsp
+  8022e2:	6a 00                	push   $0x0
+  8022e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ff:	bf 01 00 00 00       	mov    $0x1,%edi
+  802304:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  80230b:	00 00 00 
+  80230e:	ff d0                	call   *%rax
+  802310:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802314:	c9                   	leave
+  802315:	c3                   	ret
+
+0000000000802316 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802316:	55                   	push   %rbp
+  802317:	48 89 e5             	mov    %rsp,%rbp
+  80231a:	48 83 ec 10          	sub    $0x10,%rsp
+  80231e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802321:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802324:	48 98                	cltq
+  802326:	48 83 ec 08          	sub    $0x8,%rsp
+  80232a:	6a 00                	push   $0x0
+  80232c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802332:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802338:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80233d:	48 89 c2             	mov    %rax,%rdx
+  802340:	be 01 00 00 00       	mov    $0x1,%esi
+  802345:	bf 03 00 00 00       	mov    $0x3,%edi
+  80234a:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802351:	00 00 00 
+  802354:	ff d0                	call   *%rax
+  802356:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80235a:	c9                   	leave
+  80235b:	c3                   	ret
+
+000000000080235c <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80235c:	55                   	push   %rbp
+  80235d:	48 89 e5             	mov    %rsp,%rbp
+  802360:	48 83 ec 10          	sub    $0x10,%rsp
+  802364:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802367:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80236a:	48 98                	cltq
+  80236c:	48 83 ec 08          	sub    $0x8,%rsp
+  802370:	6a 00                	push   $0x0
+  802372:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802378:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80237e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802383:	48 89 c2             	mov    %rax,%rdx
+  802386:	be 00 00 00 00       	mov    $0x0,%esi
+  80238b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802390:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802397:	00 00 00 
+  80239a:	ff d0                	call   *%rax
+  80239c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023a0:	90                   	nop
+  8023a1:	c9                   	leave
+  8023a2:	c3                   	ret
+
+00000000008023a3 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8023a3:	55                   	push   %rbp
+  8023a4:	48 89 e5             	mov    %rsp,%rbp
+  8023a7:	48 83 ec 20          	sub    $0x20,%rsp
+  8023ab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8023ae:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8023b2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023b5:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8023b8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8023bd:	cd 30                	int    $0x30
+  8023bf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8023c3:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8023c7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8023cc:	7e 3d                	jle    80240b <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8023ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023d2:	49 89 c0             	mov    %rax,%r8
+  8023d5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8023da:	48 b8 68 6d 80 00 00 	movabs $0x806d68,%rax
+  8023e1:	00 00 00 
+  8023e4:	48 89 c2             	mov    %rax,%rdx
+  8023e7:	be 49 00 00 00       	mov    $0x49,%esi
+  8023ec:	48 b8 87 6d 80 00 00 	movabs $0x806d87,%rax
+  8023f3:	00 00 00 
+  8023f6:	48 89 c7             	mov    %rax,%rdi
+  8023f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023fe:	49 b9 07 05 80 00 00 	movabs $0x800507,%r9
+  802405:	00 00 00 
+  802408:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80240b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802410:	75 13                	jne    802425 <sys_env_wait+0x82>
+  802412:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802417:	74 0c                	je     802425 <sys_env_wait+0x82>
+    *status = st;
+  802419:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80241d:	89 c2                	mov    %eax,%edx
+  80241f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802423:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802425:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802429:	c9                   	leave
+  80242a:	c3                   	ret
+
+000000000080242b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80242b:	55                   	push   %rbp
+  80242c:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80242f:	48 83 ec 08          	sub    $0x8,%rsp
+  802433:	6a 00                	push   $0x0
+  802435:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80243b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802441:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802446:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244b:	be 00 00 00 00       	mov    $0x0,%esi
+  802450:	bf 02 00 00 00       	mov    $0x2,%edi
+  802455:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  80245c:	00 00 00 
+  80245f:	ff d0                	call   *%rax
+  802461:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802465:	c9                   	leave
+  802466:	c3                   	ret
+
+0000000000802467 <sys_yield>:
+
+void
+sys_yield(void) {
+  802467:	55                   	push   %rbp
+  802468:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80246b:	48 83 ec 08          	sub    $0x8,%rsp
+  80246f:	6a 00                	push   $0x0
+  802471:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802477:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80247d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802482:	ba 00 00 00 00       	mov    $0x0,%edx
+  802487:	be 00 00 00 00       	mov    $0x0,%esi
+  80248c:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802491:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802498:	00 00 00 
+  80249b:	ff d0                	call   *%rax
+  80249d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024a1:	90                   	nop
+  8024a2:	c9                   	leave
+  8024a3:	c3                   	ret
+
+00000000008024a4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8024a4:	55                   	push   %rbp
+  8024a5:	48 89 e5             	mov    %rsp,%rbp
+  8024a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8024ac:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8024b3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8024b6:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8024b9:	48 63 c8             	movslq %eax,%rcx
+  8024bc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8024c0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024c3:	48 98                	cltq
+  8024c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c9:	6a 00                	push   $0x0
+  8024cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024d1:	49 89 c8             	mov    %rcx,%r8
+  8024d4:	48 89 d1             	mov    %rdx,%rcx
+  8024d7:	48 89 c2             	mov    %rax,%rdx
+  8024da:	be 01 00 00 00       	mov    $0x1,%esi
+  8024df:	bf 06 00 00 00       	mov    $0x6,%edi
+  8024e4:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  8024eb:	00 00 00 
+  8024ee:	ff d0                	call   *%rax
+  8024f0:	48 83 c4 10          	add    $0x10,%rsp
+  8024f4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8024f7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8024fa:	c9                   	leave
+  8024fb:	c3                   	ret
+
+00000000008024fc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8024fc:	55                   	push   %rbp
+  8024fd:	48 89 e5             	mov    %rsp,%rbp
+  802500:	48 83 ec 20          	sub    $0x20,%rsp
+  802504:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802507:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80250b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  80250e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802512:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802516:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802519:	48 63 c8             	movslq %eax,%rcx
+  80251c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802520:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802523:	48 63 f0             	movslq %eax,%rsi
+  802526:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80252a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80252d:	48 98                	cltq
+  80252f:	48 83 ec 08          	sub    $0x8,%rsp
+  802533:	51                   	push   %rcx
+  802534:	49 89 f9             	mov    %rdi,%r9
+  802537:	49 89 f0             	mov    %rsi,%r8
+  80253a:	48 89 d1             	mov    %rdx,%rcx
+  80253d:	48 89 c2             	mov    %rax,%rdx
+  802540:	be 01 00 00 00       	mov    $0x1,%esi
+  802545:	bf 07 00 00 00       	mov    $0x7,%edi
+  80254a:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80255a:	c9                   	leave
+  80255b:	c3                   	ret
+
+000000000080255c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80255c:	55                   	push   %rbp
+  80255d:	48 89 e5             	mov    %rsp,%rbp
+  802560:	48 83 ec 10          	sub    $0x10,%rsp
+  802564:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802567:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80256b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80256f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802572:	48 98                	cltq
+  802574:	48 83 ec 08          	sub    $0x8,%rsp
+  802578:	6a 00                	push   $0x0
+  80257a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802580:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802586:	48 89 d1             	mov    %rdx,%rcx
+  802589:	48 89 c2             	mov    %rax,%rdx
+  80258c:	be 01 00 00 00       	mov    $0x1,%esi
+  802591:	bf 08 00 00 00       	mov    $0x8,%edi
+  802596:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  80259d:	00 00 00 
+  8025a0:	ff d0                	call   *%rax
+  8025a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a6:	c9                   	leave
+  8025a7:	c3                   	ret
+
+00000000008025a8 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8025a8:	55                   	push   %rbp
+  8025a9:	48 89 e5             	mov    %rsp,%rbp
+  8025ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025b3:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8025b6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8025b9:	48 63 d0             	movslq %eax,%rdx
+  8025bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025bf:	48 98                	cltq
+  8025c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c5:	6a 00                	push   $0x0
+  8025c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025d3:	48 89 d1             	mov    %rdx,%rcx
+  8025d6:	48 89 c2             	mov    %rax,%rdx
+  8025d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8025de:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8025e3:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  8025ea:	00 00 00 
+  8025ed:	ff d0                	call   *%rax
+  8025ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f3:	c9                   	leave
+  8025f4:	c3                   	ret
+
+00000000008025f5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8025f5:	55                   	push   %rbp
+  8025f6:	48 89 e5             	mov    %rsp,%rbp
+  8025f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8025fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802600:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802604:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802608:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80260b:	48 98                	cltq
+  80260d:	48 83 ec 08          	sub    $0x8,%rsp
+  802611:	6a 00                	push   $0x0
+  802613:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802619:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80261f:	48 89 d1             	mov    %rdx,%rcx
+  802622:	48 89 c2             	mov    %rax,%rdx
+  802625:	be 01 00 00 00       	mov    $0x1,%esi
+  80262a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80262f:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802636:	00 00 00 
+  802639:	ff d0                	call   *%rax
+  80263b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80263f:	c9                   	leave
+  802640:	c3                   	ret
+
+0000000000802641 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802641:	55                   	push   %rbp
+  802642:	48 89 e5             	mov    %rsp,%rbp
+  802645:	48 83 ec 10          	sub    $0x10,%rsp
+  802649:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80264c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802650:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802654:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802657:	48 98                	cltq
+  802659:	48 83 ec 08          	sub    $0x8,%rsp
+  80265d:	6a 00                	push   $0x0
+  80265f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802665:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80266b:	48 89 d1             	mov    %rdx,%rcx
+  80266e:	48 89 c2             	mov    %rax,%rdx
+  802671:	be 01 00 00 00       	mov    $0x1,%esi
+  802676:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80267b:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802682:	00 00 00 
+  802685:	ff d0                	call   *%rax
+  802687:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80268b:	c9                   	leave
+  80268c:	c3                   	ret
+
+000000000080268d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  80268d:	55                   	push   %rbp
+  80268e:	48 89 e5             	mov    %rsp,%rbp
+  802691:	48 83 ec 20          	sub    $0x20,%rsp
+  802695:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802698:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80269c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8026a0:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8026a3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8026a6:	48 63 f0             	movslq %eax,%rsi
+  8026a9:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8026ad:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026b4:	48 98                	cltq
+  8026b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ba:	6a 00                	push   $0x0
+  8026bc:	49 89 f1             	mov    %rsi,%r9
+  8026bf:	49 89 c8             	mov    %rcx,%r8
+  8026c2:	48 89 d1             	mov    %rdx,%rcx
+  8026c5:	48 89 c2             	mov    %rax,%rdx
+  8026c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cd:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8026d2:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  8026d9:	00 00 00 
+  8026dc:	ff d0                	call   *%rax
+  8026de:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026e2:	c9                   	leave
+  8026e3:	c3                   	ret
+
+00000000008026e4 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8026e4:	55                   	push   %rbp
+  8026e5:	48 89 e5             	mov    %rsp,%rbp
+  8026e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8026ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8026f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8026f8:	6a 00                	push   $0x0
+  8026fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802700:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802706:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80270b:	48 89 c2             	mov    %rax,%rdx
+  80270e:	be 01 00 00 00       	mov    $0x1,%esi
+  802713:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802718:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  80271f:	00 00 00 
+  802722:	ff d0                	call   *%rax
+  802724:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802728:	c9                   	leave
+  802729:	c3                   	ret
+
+000000000080272a <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80272a:	55                   	push   %rbp
+  80272b:	48 89 e5             	mov    %rsp,%rbp
+  80272e:	48 83 ec 10          	sub    $0x10,%rsp
+  802732:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802736:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80273a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80273e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802742:	48 83 ec 08          	sub    $0x8,%rsp
+  802746:	6a 00                	push   $0x0
+  802748:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80274e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802754:	48 89 d1             	mov    %rdx,%rcx
+  802757:	48 89 c2             	mov    %rax,%rdx
+  80275a:	be 01 00 00 00       	mov    $0x1,%esi
+  80275f:	bf 10 00 00 00       	mov    $0x10,%edi
+  802764:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  80276b:	00 00 00 
+  80276e:	ff d0                	call   *%rax
+  802770:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802774:	c9                   	leave
+  802775:	c3                   	ret
+
+0000000000802776 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802776:	55                   	push   %rbp
+  802777:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80277a:	48 83 ec 08          	sub    $0x8,%rsp
+  80277e:	6a 00                	push   $0x0
+  802780:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802786:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80278c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802791:	ba 00 00 00 00       	mov    $0x0,%edx
+  802796:	be 00 00 00 00       	mov    $0x0,%esi
+  80279b:	bf 11 00 00 00       	mov    $0x11,%edi
+  8027a0:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027b0:	c9                   	leave
+  8027b1:	c3                   	ret
+
+00000000008027b2 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8027b2:	55                   	push   %rbp
+  8027b3:	48 89 e5             	mov    %rsp,%rbp
+  8027b6:	48 83 ec 10          	sub    $0x10,%rsp
+  8027ba:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  8027c2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ce:	6a 00                	push   $0x0
+  8027d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027dc:	48 89 d1             	mov    %rdx,%rcx
+  8027df:	48 89 c2             	mov    %rax,%rdx
+  8027e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e7:	bf 12 00 00 00       	mov    $0x12,%edi
+  8027ec:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  8027f3:	00 00 00 
+  8027f6:	ff d0                	call   *%rax
+  8027f8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027fc:	c9                   	leave
+  8027fd:	c3                   	ret
+
+00000000008027fe <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8027fe:	55                   	push   %rbp
+  8027ff:	48 89 e5             	mov    %rsp,%rbp
+  802802:	48 83 ec 20          	sub    $0x20,%rsp
+  802806:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80280a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80280e:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802811:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802814:	48 63 c8             	movslq %eax,%rcx
+  802817:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80281b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80281f:	48 83 ec 08          	sub    $0x8,%rsp
+  802823:	6a 00                	push   $0x0
+  802825:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80282b:	49 89 c8             	mov    %rcx,%r8
+  80282e:	48 89 d1             	mov    %rdx,%rcx
+  802831:	48 89 c2             	mov    %rax,%rdx
+  802834:	be 00 00 00 00       	mov    $0x0,%esi
+  802839:	bf 13 00 00 00       	mov    $0x13,%edi
+  80283e:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802845:	00 00 00 
+  802848:	ff d0                	call   *%rax
+  80284a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80284e:	c9                   	leave
+  80284f:	c3                   	ret
+
+0000000000802850 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802850:	55                   	push   %rbp
+  802851:	48 89 e5             	mov    %rsp,%rbp
+  802854:	48 83 ec 20          	sub    $0x20,%rsp
+  802858:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80285c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80285f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802863:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802867:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80286a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80286e:	48 83 ec 08          	sub    $0x8,%rsp
+  802872:	6a 00                	push   $0x0
+  802874:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80287a:	49 89 c8             	mov    %rcx,%r8
+  80287d:	48 89 d1             	mov    %rdx,%rcx
+  802880:	48 89 c2             	mov    %rax,%rdx
+  802883:	be 00 00 00 00       	mov    $0x0,%esi
+  802888:	bf 14 00 00 00       	mov    $0x14,%edi
+  80288d:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802894:	00 00 00 
+  802897:	ff d0                	call   *%rax
+  802899:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80289d:	c9                   	leave
+  80289e:	c3                   	ret
+
+000000000080289f <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80289f:	55                   	push   %rbp
+  8028a0:	48 89 e5             	mov    %rsp,%rbp
+  8028a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8028a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028ab:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8028ae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8028b1:	48 63 d0             	movslq %eax,%rdx
+  8028b4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8028bc:	6a 00                	push   $0x0
+  8028be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028ca:	48 89 d1             	mov    %rdx,%rcx
+  8028cd:	48 89 c2             	mov    %rax,%rdx
+  8028d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8028d5:	bf 15 00 00 00       	mov    $0x15,%edi
+  8028da:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  8028e1:	00 00 00 
+  8028e4:	ff d0                	call   *%rax
+  8028e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028ea:	c9                   	leave
+  8028eb:	c3                   	ret
+
+00000000008028ec <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8028ec:	55                   	push   %rbp
+  8028ed:	48 89 e5             	mov    %rsp,%rbp
+  8028f0:	48 83 ec 20          	sub    $0x20,%rsp
+  8028f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028f8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8028fb:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8028fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802902:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802906:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802909:	48 63 c8             	movslq %eax,%rcx
+  80290c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80290f:	48 63 d0             	movslq %eax,%rdx
+  802912:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802916:	48 83 ec 08          	sub    $0x8,%rsp
+  80291a:	6a 00                	push   $0x0
+  80291c:	49 89 f1             	mov    %rsi,%r9
+  80291f:	49 89 c8             	mov    %rcx,%r8
+  802922:	48 89 d1             	mov    %rdx,%rcx
+  802925:	48 89 c2             	mov    %rax,%rdx
+  802928:	be 00 00 00 00       	mov    $0x0,%esi
+  80292d:	bf 16 00 00 00       	mov    $0x16,%edi
+  802932:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802939:	00 00 00 
+  80293c:	ff d0                	call   *%rax
+  80293e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802942:	c9                   	leave
+  802943:	c3                   	ret
+
+0000000000802944 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802944:	55                   	push   %rbp
+  802945:	48 89 e5             	mov    %rsp,%rbp
+  802948:	48 83 ec 30          	sub    $0x30,%rsp
+  80294c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802950:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802954:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802958:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80295c:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802960:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802964:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802968:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80296c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802970:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802974:	48 83 ec 08          	sub    $0x8,%rsp
+  802978:	51                   	push   %rcx
+  802979:	49 89 f9             	mov    %rdi,%r9
+  80297c:	49 89 f0             	mov    %rsi,%r8
+  80297f:	48 89 d1             	mov    %rdx,%rcx
+  802982:	48 89 c2             	mov    %rax,%rdx
+  802985:	be 00 00 00 00       	mov    $0x0,%esi
+  80298a:	bf 17 00 00 00       	mov    $0x17,%edi
+  80298f:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802996:	00 00 00 
+  802999:	ff d0                	call   *%rax
+  80299b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80299f:	c9                   	leave
+  8029a0:	c3                   	ret
+
+00000000008029a1 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8029a1:	55                   	push   %rbp
+  8029a2:	48 89 e5             	mov    %rsp,%rbp
+  8029a5:	48 83 ec 10          	sub    $0x10,%rsp
+  8029a9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  8029ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029af:	48 98                	cltq
+  8029b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b5:	6a 00                	push   $0x0
+  8029b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c8:	48 89 c2             	mov    %rax,%rdx
+  8029cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d0:	bf 18 00 00 00       	mov    $0x18,%edi
+  8029d5:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  8029dc:	00 00 00 
+  8029df:	ff d0                	call   *%rax
+  8029e1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e5:	90                   	nop
+  8029e6:	c9                   	leave
+  8029e7:	c3                   	ret
+
+00000000008029e8 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8029e8:	55                   	push   %rbp
+  8029e9:	48 89 e5             	mov    %rsp,%rbp
+  8029ec:	48 83 ec 30          	sub    $0x30,%rsp
+  8029f0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8029f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029f7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8029fb:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8029fe:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802a01:	48 63 f0             	movslq %eax,%rsi
+  802a04:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802a08:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802a0c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a0f:	48 98                	cltq
+  802a11:	48 83 ec 08          	sub    $0x8,%rsp
+  802a15:	6a 00                	push   $0x0
+  802a17:	49 89 f1             	mov    %rsi,%r9
+  802a1a:	49 89 c8             	mov    %rcx,%r8
+  802a1d:	48 89 d1             	mov    %rdx,%rcx
+  802a20:	48 89 c2             	mov    %rax,%rdx
+  802a23:	be 01 00 00 00       	mov    $0x1,%esi
+  802a28:	bf 19 00 00 00       	mov    $0x19,%edi
+  802a2d:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802a34:	00 00 00 
+  802a37:	ff d0                	call   *%rax
+  802a39:	48 83 c4 10          	add    $0x10,%rsp
+  802a3d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802a40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a43:	c9                   	leave
+  802a44:	c3                   	ret
+
+0000000000802a45 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802a45:	55                   	push   %rbp
+  802a46:	48 89 e5             	mov    %rsp,%rbp
+  802a49:	48 83 ec 20          	sub    $0x20,%rsp
+  802a4d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a51:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a55:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802a58:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a5b:	48 63 c8             	movslq %eax,%rcx
+  802a5e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a66:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6a:	6a 00                	push   $0x0
+  802a6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a72:	49 89 c8             	mov    %rcx,%r8
+  802a75:	48 89 d1             	mov    %rdx,%rcx
+  802a78:	48 89 c2             	mov    %rax,%rdx
+  802a7b:	be 01 00 00 00       	mov    $0x1,%esi
+  802a80:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802a85:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802a8c:	00 00 00 
+  802a8f:	ff d0                	call   *%rax
+  802a91:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a95:	c9                   	leave
+  802a96:	c3                   	ret
+
+0000000000802a97 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802a97:	55                   	push   %rbp
+  802a98:	48 89 e5             	mov    %rsp,%rbp
+  802a9b:	48 83 ec 20          	sub    $0x20,%rsp
+  802a9f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802aa3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802aa7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802aab:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802aaf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ab3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ab7:	48 83 ec 08          	sub    $0x8,%rsp
+  802abb:	6a 00                	push   $0x0
+  802abd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ac3:	49 89 c8             	mov    %rcx,%r8
+  802ac6:	48 89 d1             	mov    %rdx,%rcx
+  802ac9:	48 89 c2             	mov    %rax,%rdx
+  802acc:	be 01 00 00 00       	mov    $0x1,%esi
+  802ad1:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802ad6:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802add:	00 00 00 
+  802ae0:	ff d0                	call   *%rax
+  802ae2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ae6:	c9                   	leave
+  802ae7:	c3                   	ret
+
+0000000000802ae8 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802ae8:	55                   	push   %rbp
+  802ae9:	48 89 e5             	mov    %rsp,%rbp
+  802aec:	48 83 ec 30          	sub    $0x30,%rsp
+  802af0:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802af4:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802af8:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802afb:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802aff:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802b03:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802b06:	48 63 c8             	movslq %eax,%rcx
+  802b09:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b0d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b11:	48 83 ec 08          	sub    $0x8,%rsp
+  802b15:	6a 00                	push   $0x0
+  802b17:	49 89 f1             	mov    %rsi,%r9
+  802b1a:	49 89 c8             	mov    %rcx,%r8
+  802b1d:	48 89 d1             	mov    %rdx,%rcx
+  802b20:	48 89 c2             	mov    %rax,%rdx
+  802b23:	be 01 00 00 00       	mov    $0x1,%esi
+  802b28:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802b2d:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802b34:	00 00 00 
+  802b37:	ff d0                	call   *%rax
+  802b39:	48 83 c4 10          	add    $0x10,%rsp
+  802b3d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802b40:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b43:	c9                   	leave
+  802b44:	c3                   	ret
+
+0000000000802b45 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802b45:	55                   	push   %rbp
+  802b46:	48 89 e5             	mov    %rsp,%rbp
+  802b49:	48 83 ec 10          	sub    $0x10,%rsp
+  802b4d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802b50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b53:	48 98                	cltq
+  802b55:	48 83 ec 08          	sub    $0x8,%rsp
+  802b59:	6a 00                	push   $0x0
+  802b5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b6c:	48 89 c2             	mov    %rax,%rdx
+  802b6f:	be 01 00 00 00       	mov    $0x1,%esi
+  802b74:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802b79:	48 b8 f4 21 80 00 00 	movabs $0x8021f4,%rax
+  802b80:	00 00 00 
+  802b83:	ff d0                	call   *%rax
+  802b85:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b89:	c9                   	leave
+  802b8a:	c3                   	ret
+
+0000000000802b8b <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802b8b:	55                   	push   %rbp
+  802b8c:	48 89 e5             	mov    %rsp,%rbp
+  802b8f:	48 83 ec 40          	sub    $0x40,%rsp
+  802b93:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802b97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b9b:	48 8b 00             	mov    (%rax),%rax
+  802b9e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802ba2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ba6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802baa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802bae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bb2:	83 e0 02             	and    $0x2,%eax
+  802bb5:	48 85 c0             	test   %rax,%rax
+  802bb8:	74 25                	je     802bdf <pgfault+0x54>
+  802bba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bbe:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bc2:	48 89 c2             	mov    %rax,%rdx
+  802bc5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bcc:	01 00 00 
+  802bcf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bd3:	83 e0 02             	and    $0x2,%eax
+  802bd6:	48 85 c0             	test   %rax,%rax
+  802bd9:	0f 85 fe 01 00 00    	jne    802ddd <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802bdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802be3:	83 e0 02             	and    $0x2,%eax
+  802be6:	48 85 c0             	test   %rax,%rax
+  802be9:	74 23                	je     802c0e <pgfault+0x83>
+  802beb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bef:	48 c1 e8 0c          	shr    $0xc,%rax
+  802bf3:	48 89 c2             	mov    %rax,%rdx
+  802bf6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802bfd:	01 00 00 
+  802c00:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c04:	25 00 08 00 00       	and    $0x800,%eax
+  802c09:	48 85 c0             	test   %rax,%rax
+  802c0c:	75 3f                	jne    802c4d <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802c0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c12:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802c16:	49 89 d0             	mov    %rdx,%r8
+  802c19:	48 89 c1             	mov    %rax,%rcx
+  802c1c:	48 b8 98 6d 80 00 00 	movabs $0x806d98,%rax
+  802c23:	00 00 00 
+  802c26:	48 89 c2             	mov    %rax,%rdx
+  802c29:	be 26 00 00 00       	mov    $0x26,%esi
+  802c2e:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  802c35:	00 00 00 
+  802c38:	48 89 c7             	mov    %rax,%rdi
+  802c3b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c40:	49 b9 07 05 80 00 00 	movabs $0x800507,%r9
+  802c47:	00 00 00 
+  802c4a:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802c4d:	48 b8 de 5a 80 00 00 	movabs $0x805ade,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+  802c59:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802c5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c61:	ba 07 00 00 00       	mov    $0x7,%edx
+  802c66:	48 89 c6             	mov    %rax,%rsi
+  802c69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6e:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  802c75:	00 00 00 
+  802c78:	ff d0                	call   *%rax
+  802c7a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802c7d:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c81:	79 36                	jns    802cb9 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802c83:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c86:	89 c1                	mov    %eax,%ecx
+  802c88:	48 b8 d8 6d 80 00 00 	movabs $0x806dd8,%rax
+  802c8f:	00 00 00 
+  802c92:	48 89 c2             	mov    %rax,%rdx
+  802c95:	be 35 00 00 00       	mov    $0x35,%esi
+  802c9a:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  802ca1:	00 00 00 
+  802ca4:	48 89 c7             	mov    %rax,%rdi
+  802ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cac:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  802cb3:	00 00 00 
+  802cb6:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802cb9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cbd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802cc1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802cc5:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ccb:	48 89 c1             	mov    %rax,%rcx
+  802cce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802cd2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cd7:	48 89 ce             	mov    %rcx,%rsi
+  802cda:	48 89 c7             	mov    %rax,%rdi
+  802cdd:	48 b8 19 1c 80 00 00 	movabs $0x801c19,%rax
+  802ce4:	00 00 00 
+  802ce7:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802ce9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ced:	48 c1 e8 0c          	shr    $0xc,%rax
+  802cf1:	48 89 c2             	mov    %rax,%rdx
+  802cf4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802cfb:	01 00 00 
+  802cfe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d02:	25 00 08 00 00       	and    $0x800,%eax
+  802d07:	48 85 c0             	test   %rax,%rax
+  802d0a:	74 7a                	je     802d86 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802d0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d10:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802d14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d18:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d1e:	48 89 c2             	mov    %rax,%rdx
+  802d21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d25:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802d2b:	48 89 d1             	mov    %rdx,%rcx
+  802d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d33:	48 89 c6             	mov    %rax,%rsi
+  802d36:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3b:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+  802d47:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802d4a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802d4e:	79 36                	jns    802d86 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802d50:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802d53:	89 c1                	mov    %eax,%ecx
+  802d55:	48 b8 00 6e 80 00 00 	movabs $0x806e00,%rax
+  802d5c:	00 00 00 
+  802d5f:	48 89 c2             	mov    %rax,%rdx
+  802d62:	be 42 00 00 00       	mov    $0x42,%esi
+  802d67:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  802d6e:	00 00 00 
+  802d71:	48 89 c7             	mov    %rax,%rdi
+  802d74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d79:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  802d80:	00 00 00 
+  802d83:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802d86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d8a:	48 89 c6             	mov    %rax,%rsi
+  802d8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d92:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  802d99:	00 00 00 
+  802d9c:	ff d0                	call   *%rax
+  802d9e:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802da1:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802da5:	79 37                	jns    802dde <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802da7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802daa:	89 c1                	mov    %eax,%ecx
+  802dac:	48 b8 28 6e 80 00 00 	movabs $0x806e28,%rax
+  802db3:	00 00 00 
+  802db6:	48 89 c2             	mov    %rax,%rdx
+  802db9:	be 46 00 00 00       	mov    $0x46,%esi
+  802dbe:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  802dc5:	00 00 00 
+  802dc8:	48 89 c7             	mov    %rax,%rdi
+  802dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd0:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  802dd7:	00 00 00 
+  802dda:	41 ff d0             	call   *%r8
+    return;
+  802ddd:	90                   	nop
+  }
+}
+  802dde:	c9                   	leave
+  802ddf:	c3                   	ret
+
+0000000000802de0 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802de0:	55                   	push   %rbp
+  802de1:	48 89 e5             	mov    %rsp,%rbp
+  802de4:	48 83 ec 30          	sub    $0x30,%rsp
+  802de8:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802deb:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802def:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802df6:	01 00 00 
+  802df9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802dfd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e01:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e06:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802e0a:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  802e11:	00 00 00 
+  802e14:	ff d0                	call   *%rax
+  802e16:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802e19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e1d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e21:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802e25:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802e2c:	01 00 00 
+  802e2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e33:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e37:	25 00 04 00 00       	and    $0x400,%eax
+  802e3c:	48 85 c0             	test   %rax,%rax
+  802e3f:	74 7b                	je     802ebc <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802e41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e45:	89 c1                	mov    %eax,%ecx
+  802e47:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e4b:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e4f:	48 89 c2             	mov    %rax,%rdx
+  802e52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802e56:	48 c1 e0 0c          	shl    $0xc,%rax
+  802e5a:	48 89 c6             	mov    %rax,%rsi
+  802e5d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e60:	41 89 c8             	mov    %ecx,%r8d
+  802e63:	48 89 d1             	mov    %rdx,%rcx
+  802e66:	89 c2                	mov    %eax,%edx
+  802e68:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e6d:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  802e74:	00 00 00 
+  802e77:	ff d0                	call   *%rax
+  802e79:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e7c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e80:	0f 89 da 00 00 00    	jns    802f60 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802e86:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e89:	89 c1                	mov    %eax,%ecx
+  802e8b:	48 b8 50 6e 80 00 00 	movabs $0x806e50,%rax
+  802e92:	00 00 00 
+  802e95:	48 89 c2             	mov    %rax,%rdx
+  802e98:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802e9d:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  802ea4:	00 00 00 
+  802ea7:	48 89 c7             	mov    %rax,%rdi
+  802eaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eaf:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  802eb6:	00 00 00 
+  802eb9:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802ebc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ec0:	25 02 08 00 00       	and    $0x802,%eax
+  802ec5:	48 85 c0             	test   %rax,%rax
+  802ec8:	74 6e                	je     802f38 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802eca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ece:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802ed4:	80 cc 08             	or     $0x8,%ah
+  802ed7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802edb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802edf:	89 c7                	mov    %eax,%edi
+  802ee1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802ee5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ee8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802eec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eef:	41 89 f8             	mov    %edi,%r8d
+  802ef2:	89 c7                	mov    %eax,%edi
+  802ef4:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  802efb:	00 00 00 
+  802efe:	ff d0                	call   *%rax
+  802f00:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802f03:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f07:	79 05                	jns    802f0e <duppage+0x12e>
+      return r;
+  802f09:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f0c:	eb 55                	jmp    802f63 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802f0e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f12:	89 c7                	mov    %eax,%edi
+  802f14:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802f18:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802f1b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802f1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f22:	41 89 f8             	mov    %edi,%r8d
+  802f25:	89 c7                	mov    %eax,%edi
+  802f27:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  802f2e:	00 00 00 
+  802f31:	ff d0                	call   *%rax
+  802f33:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f36:	eb 28                	jmp    802f60 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802f38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f3c:	89 c7                	mov    %eax,%edi
+  802f3e:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802f42:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802f45:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802f49:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f4c:	41 89 f8             	mov    %edi,%r8d
+  802f4f:	89 c7                	mov    %eax,%edi
+  802f51:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  802f58:	00 00 00 
+  802f5b:	ff d0                	call   *%rax
+  802f5d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802f60:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802f63:	c9                   	leave
+  802f64:	c3                   	ret
+
+0000000000802f65 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802f65:	55                   	push   %rbp
+  802f66:	48 89 e5             	mov    %rsp,%rbp
+  802f69:	48 83 ec 20          	sub    $0x20,%rsp
+  802f6d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f70:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802f74:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f78:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f7c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802f80:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802f87:	01 00 00 
+  802f8a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f8e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f92:	25 00 08 00 00       	and    $0x800,%eax
+  802f97:	48 85 c0             	test   %rax,%rax
+  802f9a:	74 0d                	je     802fa9 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802f9c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fa0:	0f b6 10             	movzbl (%rax),%edx
+  802fa3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fa7:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802fa9:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802fb0:	01 00 00 
+  802fb3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fb7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802fbb:	25 07 0e 00 00       	and    $0xe07,%eax
+  802fc0:	89 c6                	mov    %eax,%esi
+  802fc2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802fc6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802fc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fcd:	41 89 f0             	mov    %esi,%r8d
+  802fd0:	48 89 c6             	mov    %rax,%rsi
+  802fd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd8:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+}
+  802fe4:	c9                   	leave
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802fe6:	55                   	push   %rbp
+  802fe7:	48 89 e5             	mov    %rsp,%rbp
+  802fea:	48 83 ec 40          	sub    $0x40,%rsp
+  802fee:	89 f8                	mov    %edi,%eax
+  802ff0:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802ff3:	48 b8 8b 2b 80 00 00 	movabs $0x802b8b,%rax
+  802ffa:	00 00 00 
+  802ffd:	48 89 c7             	mov    %rax,%rdi
+  803000:	48 b8 90 5f 80 00 00 	movabs $0x805f90,%rax
+  803007:	00 00 00 
+  80300a:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  80300c:	b8 09 00 00 00       	mov    $0x9,%eax
+  803011:	cd 30                	int    $0x30
+  803013:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  803016:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  803019:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80301c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803020:	79 36                	jns    803058 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  803022:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803025:	89 c1                	mov    %eax,%ecx
+  803027:	48 b8 7b 6e 80 00 00 	movabs $0x806e7b,%rax
+  80302e:	00 00 00 
+  803031:	48 89 c2             	mov    %rax,%rdx
+  803034:	be 8f 00 00 00       	mov    $0x8f,%esi
+  803039:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  803040:	00 00 00 
+  803043:	48 89 c7             	mov    %rax,%rdi
+  803046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304b:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  803052:	00 00 00 
+  803055:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  803058:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80305c:	75 0a                	jne    803068 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  80305e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803063:	e9 d3 02 00 00       	jmp    80333b <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  803068:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80306f:	00 
+  803070:	e9 7a 01 00 00       	jmp    8031ef <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  803075:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803079:	48 c1 e0 0c          	shl    $0xc,%rax
+  80307d:	48 c1 e8 27          	shr    $0x27,%rax
+  803081:	48 89 c2             	mov    %rax,%rdx
+  803084:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80308b:	01 00 00 
+  80308e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803092:	83 e0 01             	and    $0x1,%eax
+  803095:	48 85 c0             	test   %rax,%rax
+  803098:	0f 84 4c 01 00 00    	je     8031ea <fork_common+0x204>
+  80309e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030a6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8030aa:	48 89 c2             	mov    %rax,%rdx
+  8030ad:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8030b4:	01 00 00 
+  8030b7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030bb:	83 e0 01             	and    $0x1,%eax
+  8030be:	48 85 c0             	test   %rax,%rax
+  8030c1:	0f 84 23 01 00 00    	je     8031ea <fork_common+0x204>
+  8030c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030cb:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030cf:	48 c1 e8 15          	shr    $0x15,%rax
+  8030d3:	48 89 c2             	mov    %rax,%rdx
+  8030d6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8030dd:	01 00 00 
+  8030e0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030e4:	83 e0 01             	and    $0x1,%eax
+  8030e7:	48 85 c0             	test   %rax,%rax
+  8030ea:	0f 84 fa 00 00 00    	je     8031ea <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  8030f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030f4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030f8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  8030fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803100:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  803107:	00 00 00 
+  80310a:	48 39 c2             	cmp    %rax,%rdx
+  80310d:	0f 82 d7 00 00 00    	jb     8031ea <fork_common+0x204>
+  803113:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  80311a:	00 00 00 
+  80311d:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  803121:	0f 84 c3 00 00 00    	je     8031ea <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803127:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80312b:	48 89 c7             	mov    %rax,%rdi
+  80312e:	48 b8 9a 5a 80 00 00 	movabs $0x805a9a,%rax
+  803135:	00 00 00 
+  803138:	ff d0                	call   *%rax
+  80313a:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  80313d:	84 c0                	test   %al,%al
+  80313f:	0f 84 a5 00 00 00    	je     8031ea <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803145:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803149:	48 c1 e8 0c          	shr    $0xc,%rax
+  80314d:	48 89 c2             	mov    %rax,%rdx
+  803150:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803157:	01 00 00 
+  80315a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80315e:	83 e0 01             	and    $0x1,%eax
+  803161:	48 85 c0             	test   %rax,%rax
+  803164:	0f 84 80 00 00 00    	je     8031ea <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  80316a:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  80316e:	74 4a                	je     8031ba <fork_common+0x1d4>
+  803170:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803174:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  80317b:	00 00 00 
+  80317e:	48 39 c2             	cmp    %rax,%rdx
+  803181:	73 13                	jae    803196 <fork_common+0x1b0>
+  803183:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803187:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  80318e:	00 00 00 
+  803191:	48 39 c2             	cmp    %rax,%rdx
+  803194:	73 24                	jae    8031ba <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  803196:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80319a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80319e:	48 89 c2             	mov    %rax,%rdx
+  8031a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031a4:	48 89 d6             	mov    %rdx,%rsi
+  8031a7:	89 c7                	mov    %eax,%edi
+  8031a9:	48 b8 65 2f 80 00 00 	movabs $0x802f65,%rax
+  8031b0:	00 00 00 
+  8031b3:	ff d0                	call   *%rax
+  8031b5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031b8:	eb 22                	jmp    8031dc <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  8031ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8031be:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031c2:	48 89 c2             	mov    %rax,%rdx
+  8031c5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031c8:	48 89 d6             	mov    %rdx,%rsi
+  8031cb:	89 c7                	mov    %eax,%edi
+  8031cd:	48 b8 e0 2d 80 00 00 	movabs $0x802de0,%rax
+  8031d4:	00 00 00 
+  8031d7:	ff d0                	call   *%rax
+  8031d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  8031dc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031e0:	79 08                	jns    8031ea <fork_common+0x204>
+            return r;
+  8031e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031e5:	e9 51 01 00 00       	jmp    80333b <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  8031ea:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8031ef:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  8031f6:	07 
+  8031f7:	0f 86 78 fe ff ff    	jbe    803075 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  8031fd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803204:	00 00 00 
+  803207:	8b 40 04             	mov    0x4(%rax),%eax
+  80320a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80320f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803216:	00 00 00 
+  803219:	48 98                	cltq
+  80321b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803222:	48 01 d0             	add    %rdx,%rax
+  803225:	48 05 00 01 00 00    	add    $0x100,%rax
+  80322b:	48 8b 10             	mov    (%rax),%rdx
+  80322e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803231:	48 89 d6             	mov    %rdx,%rsi
+  803234:	89 c7                	mov    %eax,%edi
+  803236:	48 b8 41 26 80 00 00 	movabs $0x802641,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+  803242:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803245:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803249:	79 36                	jns    803281 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  80324b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80324e:	89 c1                	mov    %eax,%ecx
+  803250:	48 b8 90 6e 80 00 00 	movabs $0x806e90,%rax
+  803257:	00 00 00 
+  80325a:	48 89 c2             	mov    %rax,%rdx
+  80325d:	be be 00 00 00       	mov    $0xbe,%esi
+  803262:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  803269:	00 00 00 
+  80326c:	48 89 c7             	mov    %rax,%rdi
+  80326f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803274:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  80327b:	00 00 00 
+  80327e:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  803281:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803284:	ba 02 00 00 00       	mov    $0x2,%edx
+  803289:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  803290:	00 00 00 
+  803293:	48 89 ce             	mov    %rcx,%rsi
+  803296:	89 c7                	mov    %eax,%edi
+  803298:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+  8032a4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032a7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032ab:	79 36                	jns    8032e3 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  8032ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032b0:	89 c1                	mov    %eax,%ecx
+  8032b2:	48 b8 c0 6e 80 00 00 	movabs $0x806ec0,%rax
+  8032b9:	00 00 00 
+  8032bc:	48 89 c2             	mov    %rax,%rdx
+  8032bf:	be c1 00 00 00       	mov    $0xc1,%esi
+  8032c4:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  8032cb:	00 00 00 
+  8032ce:	48 89 c7             	mov    %rax,%rdi
+  8032d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d6:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  8032dd:	00 00 00 
+  8032e0:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  8032e3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8032e6:	be 02 00 00 00       	mov    $0x2,%esi
+  8032eb:	89 c7                	mov    %eax,%edi
+  8032ed:	48 b8 a8 25 80 00 00 	movabs $0x8025a8,%rax
+  8032f4:	00 00 00 
+  8032f7:	ff d0                	call   *%rax
+  8032f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803300:	79 36                	jns    803338 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  803302:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803305:	89 c1                	mov    %eax,%ecx
+  803307:	48 b8 e0 6e 80 00 00 	movabs $0x806ee0,%rax
+  80330e:	00 00 00 
+  803311:	48 89 c2             	mov    %rax,%rdx
+  803314:	be d4 00 00 00       	mov    $0xd4,%esi
+  803319:	48 b8 c6 6d 80 00 00 	movabs $0x806dc6,%rax
+  803320:	00 00 00 
+  803323:	48 89 c7             	mov    %rax,%rdi
+  803326:	b8 00 00 00 00       	mov    $0x0,%eax
+  80332b:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  803332:	00 00 00 
+  803335:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803338:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  80333b:	c9                   	leave
+  80333c:	c3                   	ret
+
+000000000080333d <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  80333d:	55                   	push   %rbp
+  80333e:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  803341:	bf 00 00 00 00       	mov    $0x0,%edi
+  803346:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  80334d:	00 00 00 
+  803350:	ff d0                	call   *%rax
+}
+  803352:	5d                   	pop    %rbp
+  803353:	c3                   	ret
+
+0000000000803354 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  803354:	55                   	push   %rbp
+  803355:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  803358:	bf 01 00 00 00       	mov    $0x1,%edi
+  80335d:	48 b8 e6 2f 80 00 00 	movabs $0x802fe6,%rax
+  803364:	00 00 00 
+  803367:	ff d0                	call   *%rax
+}
+  803369:	5d                   	pop    %rbp
+  80336a:	c3                   	ret
+
+000000000080336b <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  80336b:	55                   	push   %rbp
+  80336c:	48 89 e5             	mov    %rsp,%rbp
+  80336f:	48 83 ec 20          	sub    $0x20,%rsp
+  803373:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803377:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80337b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  80337f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803383:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  803387:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80338b:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  803392:	48 89 c7             	mov    %rax,%rdi
+  803395:	48 b8 a3 33 80 00 00 	movabs $0x8033a3,%rax
+  80339c:	00 00 00 
+  80339f:	ff d0                	call   *%rax
+}
+  8033a1:	c9                   	leave
+  8033a2:	c3                   	ret
+
+00000000008033a3 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  8033a3:	55                   	push   %rbp
+  8033a4:	48 89 e5             	mov    %rsp,%rbp
+  8033a7:	48 83 ec 30          	sub    $0x30,%rsp
+  8033ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8033af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8033b3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8033b7:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8033bb:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8033c0:	75 0e                	jne    8033d0 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  8033c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8033c9:	00 00 00 
+  8033cc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  8033d0:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8033d5:	75 18                	jne    8033ef <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8033d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033db:	48 89 c7             	mov    %rax,%rdi
+  8033de:	48 b8 e4 26 80 00 00 	movabs $0x8026e4,%rax
+  8033e5:	00 00 00 
+  8033e8:	ff d0                	call   *%rax
+  8033ea:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033ed:	eb 1d                	jmp    80340c <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8033ef:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8033f3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033f7:	48 89 d6             	mov    %rdx,%rsi
+  8033fa:	48 89 c7             	mov    %rax,%rdi
+  8033fd:	48 b8 2a 27 80 00 00 	movabs $0x80272a,%rax
+  803404:	00 00 00 
+  803407:	ff d0                	call   *%rax
+  803409:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  80340c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803410:	79 2a                	jns    80343c <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  803412:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803417:	74 0a                	je     803423 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  803419:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80341d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  803423:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803428:	74 0a                	je     803434 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  80342a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80342e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  803434:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803437:	e9 aa 00 00 00       	jmp    8034e6 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  80343c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803441:	74 36                	je     803479 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  803443:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80344a:	00 00 00 
+  80344d:	8b 40 04             	mov    0x4(%rax),%eax
+  803450:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803455:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80345c:	00 00 00 
+  80345f:	48 98                	cltq
+  803461:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803468:	48 01 d0             	add    %rdx,%rax
+  80346b:	48 05 24 01 00 00    	add    $0x124,%rax
+  803471:	8b 10                	mov    (%rax),%edx
+  803473:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803477:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  803479:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80347e:	74 36                	je     8034b6 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  803480:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803487:	00 00 00 
+  80348a:	8b 40 04             	mov    0x4(%rax),%eax
+  80348d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803492:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803499:	00 00 00 
+  80349c:	48 98                	cltq
+  80349e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8034a5:	48 01 d0             	add    %rdx,%rax
+  8034a8:	48 05 28 01 00 00    	add    $0x128,%rax
+  8034ae:	8b 10                	mov    (%rax),%edx
+  8034b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034b4:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8034b6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8034bd:	00 00 00 
+  8034c0:	8b 40 04             	mov    0x4(%rax),%eax
+  8034c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8034c8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8034cf:	00 00 00 
+  8034d2:	48 98                	cltq
+  8034d4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8034db:	48 01 d0             	add    %rdx,%rax
+  8034de:	48 05 20 01 00 00    	add    $0x120,%rax
+  8034e4:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8034e6:	c9                   	leave
+  8034e7:	c3                   	ret
+
+00000000008034e8 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8034e8:	55                   	push   %rbp
+  8034e9:	48 89 e5             	mov    %rsp,%rbp
+  8034ec:	48 83 ec 30          	sub    $0x30,%rsp
+  8034f0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034f3:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  8034f6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034fa:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8034fd:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803502:	75 5e                	jne    803562 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  803504:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80350b:	00 00 00 
+  80350e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803512:	eb 4e                	jmp    803562 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  803514:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803518:	79 3c                	jns    803556 <ipc_send+0x6e>
+  80351a:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80351e:	74 36                	je     803556 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  803520:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803523:	89 c1                	mov    %eax,%ecx
+  803525:	48 b8 08 6f 80 00 00 	movabs $0x806f08,%rax
+  80352c:	00 00 00 
+  80352f:	48 89 c2             	mov    %rax,%rdx
+  803532:	be 54 00 00 00       	mov    $0x54,%esi
+  803537:	48 b8 2e 6f 80 00 00 	movabs $0x806f2e,%rax
+  80353e:	00 00 00 
+  803541:	48 89 c7             	mov    %rax,%rdi
+  803544:	b8 00 00 00 00       	mov    $0x0,%eax
+  803549:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  803550:	00 00 00 
+  803553:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  803556:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  80355d:	00 00 00 
+  803560:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  803562:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  803565:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  803568:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80356c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80356f:	89 c7                	mov    %eax,%edi
+  803571:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  803578:	00 00 00 
+  80357b:	ff d0                	call   *%rax
+  80357d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803580:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803584:	75 8e                	jne    803514 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  803586:	48 b8 67 24 80 00 00 	movabs $0x802467,%rax
+  80358d:	00 00 00 
+  803590:	ff d0                	call   *%rax
+}
+  803592:	90                   	nop
+  803593:	c9                   	leave
+  803594:	c3                   	ret
+
+0000000000803595 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  803595:	55                   	push   %rbp
+  803596:	48 89 e5             	mov    %rsp,%rbp
+  803599:	48 83 ec 18          	sub    $0x18,%rsp
+  80359d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8035a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035a7:	eb 4d                	jmp    8035f6 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8035a9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8035b0:	00 00 00 
+  8035b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035b6:	48 98                	cltq
+  8035b8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8035bf:	48 01 d0             	add    %rdx,%rax
+  8035c2:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8035c8:	8b 00                	mov    (%rax),%eax
+  8035ca:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8035cd:	75 23                	jne    8035f2 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8035cf:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8035d6:	00 00 00 
+  8035d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035dc:	48 98                	cltq
+  8035de:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8035e5:	48 01 d0             	add    %rdx,%rax
+  8035e8:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8035ee:	8b 00                	mov    (%rax),%eax
+  8035f0:	eb 12                	jmp    803604 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8035f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8035f6:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  8035fd:	7e aa                	jle    8035a9 <ipc_find_env+0x14>
+  return 0;
+  8035ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803604:	c9                   	leave
+  803605:	c3                   	ret
+
+0000000000803606 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803606:	55                   	push   %rbp
+  803607:	48 89 e5             	mov    %rsp,%rbp
+  80360a:	48 83 ec 08          	sub    $0x8,%rsp
+  80360e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  803612:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803616:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80361d:	ff ff ff 
+  803620:	48 01 d0             	add    %rdx,%rax
+  803623:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803627:	c9                   	leave
+  803628:	c3                   	ret
+
+0000000000803629 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803629:	55                   	push   %rbp
+  80362a:	48 89 e5             	mov    %rsp,%rbp
+  80362d:	48 83 ec 08          	sub    $0x8,%rsp
+  803631:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  803635:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803639:	48 89 c7             	mov    %rax,%rdi
+  80363c:	48 b8 06 36 80 00 00 	movabs $0x803606,%rax
+  803643:	00 00 00 
+  803646:	ff d0                	call   *%rax
+  803648:	48 05 01 68 00 00    	add    $0x6801,%rax
+  80364e:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  803652:	c9                   	leave
+  803653:	c3                   	ret
+
+0000000000803654 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803654:	55                   	push   %rbp
+  803655:	48 89 e5             	mov    %rsp,%rbp
+  803658:	48 83 ec 18          	sub    $0x18,%rsp
+  80365c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  803660:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803667:	e9 ae 00 00 00       	jmp    80371a <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  80366c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80366f:	c1 e0 0c             	shl    $0xc,%eax
+  803672:	48 98                	cltq
+  803674:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803679:	48 01 d0             	add    %rdx,%rax
+  80367c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803680:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803684:	48 c1 e8 27          	shr    $0x27,%rax
+  803688:	48 89 c2             	mov    %rax,%rdx
+  80368b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803692:	01 00 00 
+  803695:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803699:	83 e0 01             	and    $0x1,%eax
+  80369c:	48 85 c0             	test   %rax,%rax
+  80369f:	74 63                	je     803704 <fd_alloc+0xb0>
+  8036a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036a5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036a9:	48 89 c2             	mov    %rax,%rdx
+  8036ac:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8036b3:	01 00 00 
+  8036b6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036ba:	83 e0 01             	and    $0x1,%eax
+  8036bd:	48 85 c0             	test   %rax,%rax
+  8036c0:	74 42                	je     803704 <fd_alloc+0xb0>
+  8036c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036c6:	48 c1 e8 15          	shr    $0x15,%rax
+  8036ca:	48 89 c2             	mov    %rax,%rdx
+  8036cd:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8036d4:	01 00 00 
+  8036d7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036db:	83 e0 01             	and    $0x1,%eax
+  8036de:	48 85 c0             	test   %rax,%rax
+  8036e1:	74 21                	je     803704 <fd_alloc+0xb0>
+  8036e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036e7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8036eb:	48 89 c2             	mov    %rax,%rdx
+  8036ee:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8036f5:	01 00 00 
+  8036f8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036fc:	83 e0 01             	and    $0x1,%eax
+  8036ff:	48 85 c0             	test   %rax,%rax
+  803702:	75 12                	jne    803716 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803704:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803708:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80370c:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80370f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803714:	eb 1e                	jmp    803734 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803716:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80371a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80371e:	0f 8e 48 ff ff ff    	jle    80366c <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803724:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803728:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80372f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803734:	c9                   	leave
+  803735:	c3                   	ret
+
+0000000000803736 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803736:	55                   	push   %rbp
+  803737:	48 89 e5             	mov    %rsp,%rbp
+  80373a:	48 83 ec 20          	sub    $0x20,%rsp
+  80373e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803741:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803745:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803749:	78 06                	js     803751 <fd_lookup+0x1b>
+  80374b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80374f:	7e 0a                	jle    80375b <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803751:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803756:	e9 af 00 00 00       	jmp    80380a <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80375b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80375e:	c1 e0 0c             	shl    $0xc,%eax
+  803761:	48 98                	cltq
+  803763:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803768:	48 01 d0             	add    %rdx,%rax
+  80376b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80376f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803773:	48 c1 e8 27          	shr    $0x27,%rax
+  803777:	48 89 c2             	mov    %rax,%rdx
+  80377a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803781:	01 00 00 
+  803784:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803788:	83 e0 01             	and    $0x1,%eax
+  80378b:	48 85 c0             	test   %rax,%rax
+  80378e:	74 63                	je     8037f3 <fd_lookup+0xbd>
+  803790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803794:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803798:	48 89 c2             	mov    %rax,%rdx
+  80379b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8037a2:	01 00 00 
+  8037a5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037a9:	83 e0 01             	and    $0x1,%eax
+  8037ac:	48 85 c0             	test   %rax,%rax
+  8037af:	74 42                	je     8037f3 <fd_lookup+0xbd>
+  8037b1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037b5:	48 c1 e8 15          	shr    $0x15,%rax
+  8037b9:	48 89 c2             	mov    %rax,%rdx
+  8037bc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8037c3:	01 00 00 
+  8037c6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037ca:	83 e0 01             	and    $0x1,%eax
+  8037cd:	48 85 c0             	test   %rax,%rax
+  8037d0:	74 21                	je     8037f3 <fd_lookup+0xbd>
+  8037d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037d6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037da:	48 89 c2             	mov    %rax,%rdx
+  8037dd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037e4:	01 00 00 
+  8037e7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037eb:	83 e0 01             	and    $0x1,%eax
+  8037ee:	48 85 c0             	test   %rax,%rax
+  8037f1:	75 07                	jne    8037fa <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8037f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037f8:	eb 10                	jmp    80380a <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8037fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8037fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803802:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803805:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80380a:	c9                   	leave
+  80380b:	c3                   	ret
+
+000000000080380c <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80380c:	55                   	push   %rbp
+  80380d:	48 89 e5             	mov    %rsp,%rbp
+  803810:	48 83 ec 30          	sub    $0x30,%rsp
+  803814:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803818:	89 f0                	mov    %esi,%eax
+  80381a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80381d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803821:	48 89 c7             	mov    %rax,%rdi
+  803824:	48 b8 06 36 80 00 00 	movabs $0x803606,%rax
+  80382b:	00 00 00 
+  80382e:	ff d0                	call   *%rax
+  803830:	89 c2                	mov    %eax,%edx
+  803832:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803836:	48 89 c6             	mov    %rax,%rsi
+  803839:	89 d7                	mov    %edx,%edi
+  80383b:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  803842:	00 00 00 
+  803845:	ff d0                	call   *%rax
+  803847:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80384a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80384e:	78 0a                	js     80385a <fd_close+0x4e>
+  803850:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803854:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803858:	74 12                	je     80386c <fd_close+0x60>
+    return (must_exist ? r : 0);
+  80385a:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  80385e:	74 05                	je     803865 <fd_close+0x59>
+  803860:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803863:	eb 70                	jmp    8038d5 <fd_close+0xc9>
+  803865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386a:	eb 69                	jmp    8038d5 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80386c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803870:	8b 00                	mov    (%rax),%eax
+  803872:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803876:	48 89 d6             	mov    %rdx,%rsi
+  803879:	89 c7                	mov    %eax,%edi
+  80387b:	48 b8 d7 38 80 00 00 	movabs $0x8038d7,%rax
+  803882:	00 00 00 
+  803885:	ff d0                	call   *%rax
+  803887:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80388a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80388e:	78 2a                	js     8038ba <fd_close+0xae>
+    if (dev->dev_close)
+  803890:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803894:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803898:	48 85 c0             	test   %rax,%rax
+  80389b:	74 16                	je     8038b3 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  80389d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038a1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8038a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8038a9:	48 89 c7             	mov    %rax,%rdi
+  8038ac:	ff d2                	call   *%rdx
+  8038ae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038b1:	eb 07                	jmp    8038ba <fd_close+0xae>
+    else
+      r = 0;
+  8038b3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8038ba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8038be:	48 89 c6             	mov    %rax,%rsi
+  8038c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038c6:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  8038cd:	00 00 00 
+  8038d0:	ff d0                	call   *%rax
+  return r;
+  8038d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8038d5:	c9                   	leave
+  8038d6:	c3                   	ret
+
+00000000008038d7 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8038d7:	55                   	push   %rbp
+  8038d8:	48 89 e5             	mov    %rsp,%rbp
+  8038db:	48 83 ec 20          	sub    $0x20,%rsp
+  8038df:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8038e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8038e6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8038ed:	eb 3f                	jmp    80392e <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8038ef:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8038f6:	00 00 00 
+  8038f9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038fc:	48 98                	cltq
+  8038fe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803902:	8b 00                	mov    (%rax),%eax
+  803904:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803907:	75 21                	jne    80392a <dev_lookup+0x53>
+      *dev = devtab[i];
+  803909:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803910:	00 00 00 
+  803913:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803916:	48 98                	cltq
+  803918:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80391c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803920:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803923:	b8 00 00 00 00       	mov    $0x0,%eax
+  803928:	eb 7f                	jmp    8039a9 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  80392a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80392e:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  803935:	00 00 00 
+  803938:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80393b:	48 98                	cltq
+  80393d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803941:	48 85 c0             	test   %rax,%rax
+  803944:	75 a9                	jne    8038ef <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803946:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80394d:	00 00 00 
+  803950:	8b 40 04             	mov    0x4(%rax),%eax
+  803953:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803958:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80395f:	00 00 00 
+  803962:	48 98                	cltq
+  803964:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80396b:	48 01 d0             	add    %rdx,%rax
+  80396e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803974:	8b 00                	mov    (%rax),%eax
+  803976:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803979:	89 c6                	mov    %eax,%esi
+  80397b:	48 b8 38 6f 80 00 00 	movabs $0x806f38,%rax
+  803982:	00 00 00 
+  803985:	48 89 c7             	mov    %rax,%rdi
+  803988:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398d:	48 b9 26 07 80 00 00 	movabs $0x800726,%rcx
+  803994:	00 00 00 
+  803997:	ff d1                	call   *%rcx
+  *dev = 0;
+  803999:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80399d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8039a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8039a9:	c9                   	leave
+  8039aa:	c3                   	ret
+
+00000000008039ab <close>:
+
+int
+close(int fdnum) {
+  8039ab:	55                   	push   %rbp
+  8039ac:	48 89 e5             	mov    %rsp,%rbp
+  8039af:	48 83 ec 20          	sub    $0x20,%rsp
+  8039b3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8039b6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8039ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8039bd:	48 89 d6             	mov    %rdx,%rsi
+  8039c0:	89 c7                	mov    %eax,%edi
+  8039c2:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  8039c9:	00 00 00 
+  8039cc:	ff d0                	call   *%rax
+  8039ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039d5:	79 05                	jns    8039dc <close+0x31>
+    return r;
+  8039d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039da:	eb 18                	jmp    8039f4 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  8039dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8039e5:	48 89 c7             	mov    %rax,%rdi
+  8039e8:	48 b8 0c 38 80 00 00 	movabs $0x80380c,%rax
+  8039ef:	00 00 00 
+  8039f2:	ff d0                	call   *%rax
+}
+  8039f4:	c9                   	leave
+  8039f5:	c3                   	ret
+
+00000000008039f6 <close_all>:
+
+void
+close_all(void) {
+  8039f6:	55                   	push   %rbp
+  8039f7:	48 89 e5             	mov    %rsp,%rbp
+  8039fa:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8039fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803a05:	eb 15                	jmp    803a1c <close_all+0x26>
+    close(i);
+  803a07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a0a:	89 c7                	mov    %eax,%edi
+  803a0c:	48 b8 ab 39 80 00 00 	movabs $0x8039ab,%rax
+  803a13:	00 00 00 
+  803a16:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803a18:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803a1c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803a20:	7e e5                	jle    803a07 <close_all+0x11>
+}
+  803a22:	90                   	nop
+  803a23:	90                   	nop
+  803a24:	c9                   	leave
+  803a25:	c3                   	ret
+
+0000000000803a26 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803a26:	55                   	push   %rbp
+  803a27:	48 89 e5             	mov    %rsp,%rbp
+  803a2a:	48 83 ec 40          	sub    $0x40,%rsp
+  803a2e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803a31:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803a34:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803a38:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803a3b:	48 89 d6             	mov    %rdx,%rsi
+  803a3e:	89 c7                	mov    %eax,%edi
+  803a40:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  803a47:	00 00 00 
+  803a4a:	ff d0                	call   *%rax
+  803a4c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a4f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a53:	79 08                	jns    803a5d <dup+0x37>
+    return r;
+  803a55:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a58:	e9 33 02 00 00       	jmp    803c90 <dup+0x26a>
+  close(newfdnum);
+  803a5d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803a60:	89 c7                	mov    %eax,%edi
+  803a62:	48 b8 ab 39 80 00 00 	movabs $0x8039ab,%rax
+  803a69:	00 00 00 
+  803a6c:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803a6e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803a71:	c1 e0 0c             	shl    $0xc,%eax
+  803a74:	48 98                	cltq
+  803a76:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803a7b:	48 01 d0             	add    %rdx,%rax
+  803a7e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803a82:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a86:	48 89 c7             	mov    %rax,%rdi
+  803a89:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  803a90:	00 00 00 
+  803a93:	ff d0                	call   *%rax
+  803a95:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803a99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a9d:	48 89 c7             	mov    %rax,%rdi
+  803aa0:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  803aa7:	00 00 00 
+  803aaa:	ff d0                	call   *%rax
+  803aac:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803ab0:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803ab7:	00 
+  803ab8:	e9 19 01 00 00       	jmp    803bd6 <dup+0x1b0>
+    off -= PGSIZE;
+  803abd:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803ac4:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803ac5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ac9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803acd:	48 01 d0             	add    %rdx,%rax
+  803ad0:	48 c1 e8 27          	shr    $0x27,%rax
+  803ad4:	48 89 c2             	mov    %rax,%rdx
+  803ad7:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803ade:	01 00 00 
+  803ae1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803ae5:	83 e0 01             	and    $0x1,%eax
+  803ae8:	48 85 c0             	test   %rax,%rax
+  803aeb:	0f 84 e5 00 00 00    	je     803bd6 <dup+0x1b0>
+  803af1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803af5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803af9:	48 01 d0             	add    %rdx,%rax
+  803afc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803b00:	48 89 c2             	mov    %rax,%rdx
+  803b03:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803b0a:	01 00 00 
+  803b0d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b11:	83 e0 01             	and    $0x1,%eax
+  803b14:	48 85 c0             	test   %rax,%rax
+  803b17:	0f 84 b9 00 00 00    	je     803bd6 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803b1d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b21:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b25:	48 01 d0             	add    %rdx,%rax
+  803b28:	48 c1 e8 15          	shr    $0x15,%rax
+  803b2c:	48 89 c2             	mov    %rax,%rdx
+  803b2f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803b36:	01 00 00 
+  803b39:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b3d:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803b40:	48 85 c0             	test   %rax,%rax
+  803b43:	0f 84 8d 00 00 00    	je     803bd6 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803b49:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b51:	48 01 d0             	add    %rdx,%rax
+  803b54:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b58:	48 89 c2             	mov    %rax,%rdx
+  803b5b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803b62:	01 00 00 
+  803b65:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b69:	83 e0 01             	and    $0x1,%eax
+  803b6c:	48 85 c0             	test   %rax,%rax
+  803b6f:	74 65                	je     803bd6 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803b71:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803b75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b79:	48 01 d0             	add    %rdx,%rax
+  803b7c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b80:	48 89 c2             	mov    %rax,%rdx
+  803b83:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803b8a:	01 00 00 
+  803b8d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b91:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b96:	89 c6                	mov    %eax,%esi
+  803b98:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ba0:	48 01 c2             	add    %rax,%rdx
+  803ba3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803ba7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bab:	48 01 c8             	add    %rcx,%rax
+  803bae:	41 89 f0             	mov    %esi,%r8d
+  803bb1:	48 89 d1             	mov    %rdx,%rcx
+  803bb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bb9:	48 89 c6             	mov    %rax,%rsi
+  803bbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bc1:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  803bc8:	00 00 00 
+  803bcb:	ff d0                	call   *%rax
+  803bcd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bd0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bd4:	78 60                	js     803c36 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803bd6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803bdb:	0f 85 dc fe ff ff    	jne    803abd <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803be1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803be5:	48 c1 e8 0c          	shr    $0xc,%rax
+  803be9:	48 89 c2             	mov    %rax,%rdx
+  803bec:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803bf3:	01 00 00 
+  803bf6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803bfa:	25 07 0e 00 00       	and    $0xe07,%eax
+  803bff:	89 c1                	mov    %eax,%ecx
+  803c01:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803c09:	41 89 c8             	mov    %ecx,%r8d
+  803c0c:	48 89 d1             	mov    %rdx,%rcx
+  803c0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c14:	48 89 c6             	mov    %rax,%rsi
+  803c17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1c:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  803c23:	00 00 00 
+  803c26:	ff d0                	call   *%rax
+  803c28:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c2b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c2f:	78 08                	js     803c39 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803c31:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803c34:	eb 5a                	jmp    803c90 <dup+0x26a>
+        goto err;
+  803c36:	90                   	nop
+  803c37:	eb 01                	jmp    803c3a <dup+0x214>
+    goto err;
+  803c39:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803c3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c3e:	48 89 c6             	mov    %rax,%rsi
+  803c41:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c46:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  803c4d:	00 00 00 
+  803c50:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803c52:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803c59:	00 
+  803c5a:	eb 27                	jmp    803c83 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803c5c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c64:	48 01 d0             	add    %rdx,%rax
+  803c67:	48 89 c6             	mov    %rax,%rsi
+  803c6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c6f:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  803c76:	00 00 00 
+  803c79:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803c7b:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803c82:	00 
+  803c83:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803c8a:	00 
+  803c8b:	76 cf                	jbe    803c5c <dup+0x236>
+  return r;
+  803c8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803c90:	c9                   	leave
+  803c91:	c3                   	ret
+
+0000000000803c92 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803c92:	55                   	push   %rbp
+  803c93:	48 89 e5             	mov    %rsp,%rbp
+  803c96:	48 83 ec 40          	sub    $0x40,%rsp
+  803c9a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c9d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803ca1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ca5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ca9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803cac:	48 89 d6             	mov    %rdx,%rsi
+  803caf:	89 c7                	mov    %eax,%edi
+  803cb1:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  803cb8:	00 00 00 
+  803cbb:	ff d0                	call   *%rax
+  803cbd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803cc0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803cc4:	78 24                	js     803cea <read+0x58>
+  803cc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cca:	8b 00                	mov    (%rax),%eax
+  803ccc:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803cd0:	48 89 d6             	mov    %rdx,%rsi
+  803cd3:	89 c7                	mov    %eax,%edi
+  803cd5:	48 b8 d7 38 80 00 00 	movabs $0x8038d7,%rax
+  803cdc:	00 00 00 
+  803cdf:	ff d0                	call   *%rax
+  803ce1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ce4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ce8:	79 0a                	jns    803cf4 <read+0x62>
+    return r;
+  803cea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ced:	48 98                	cltq
+  803cef:	e9 9e 00 00 00       	jmp    803d92 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803cf4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cf8:	8b 40 08             	mov    0x8(%rax),%eax
+  803cfb:	83 e0 03             	and    $0x3,%eax
+  803cfe:	83 f8 01             	cmp    $0x1,%eax
+  803d01:	75 5c                	jne    803d5f <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803d03:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803d0a:	00 00 00 
+  803d0d:	8b 40 04             	mov    0x4(%rax),%eax
+  803d10:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803d15:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803d1c:	00 00 00 
+  803d1f:	48 98                	cltq
+  803d21:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803d28:	48 01 d0             	add    %rdx,%rax
+  803d2b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803d31:	8b 00                	mov    (%rax),%eax
+  803d33:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803d36:	89 c6                	mov    %eax,%esi
+  803d38:	48 b8 57 6f 80 00 00 	movabs $0x806f57,%rax
+  803d3f:	00 00 00 
+  803d42:	48 89 c7             	mov    %rax,%rdi
+  803d45:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d4a:	48 b9 26 07 80 00 00 	movabs $0x800726,%rcx
+  803d51:	00 00 00 
+  803d54:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803d56:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803d5d:	eb 33                	jmp    803d92 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803d5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d63:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803d67:	48 85 c0             	test   %rax,%rax
+  803d6a:	75 09                	jne    803d75 <read+0xe3>
+    return -E_NOT_SUPP;
+  803d6c:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803d73:	eb 1d                	jmp    803d92 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803d75:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d79:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803d7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d81:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803d85:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803d89:	48 89 ce             	mov    %rcx,%rsi
+  803d8c:	48 89 c7             	mov    %rax,%rdi
+  803d8f:	41 ff d0             	call   *%r8
+}
+  803d92:	c9                   	leave
+  803d93:	c3                   	ret
+
+0000000000803d94 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803d94:	55                   	push   %rbp
+  803d95:	48 89 e5             	mov    %rsp,%rbp
+  803d98:	48 83 ec 30          	sub    $0x30,%rsp
+  803d9c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803d9f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803da3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803da7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803dae:	eb 49                	jmp    803df9 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803db0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803db3:	48 98                	cltq
+  803db5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803db9:	48 29 c2             	sub    %rax,%rdx
+  803dbc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dbf:	48 63 c8             	movslq %eax,%rcx
+  803dc2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dc6:	48 01 c1             	add    %rax,%rcx
+  803dc9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803dcc:	48 89 ce             	mov    %rcx,%rsi
+  803dcf:	89 c7                	mov    %eax,%edi
+  803dd1:	48 b8 92 3c 80 00 00 	movabs $0x803c92,%rax
+  803dd8:	00 00 00 
+  803ddb:	ff d0                	call   *%rax
+  803ddd:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803de0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803de4:	79 07                	jns    803ded <readn+0x59>
+      return m;
+  803de6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803de9:	48 98                	cltq
+  803deb:	eb 1f                	jmp    803e0c <readn+0x78>
+    if (m == 0)
+  803ded:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803df1:	74 13                	je     803e06 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803df3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803df6:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803df9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803dfc:	48 98                	cltq
+  803dfe:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803e02:	72 ac                	jb     803db0 <readn+0x1c>
+  803e04:	eb 01                	jmp    803e07 <readn+0x73>
+      break;
+  803e06:	90                   	nop
+  }
+  return tot;
+  803e07:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e0a:	48 98                	cltq
+}
+  803e0c:	c9                   	leave
+  803e0d:	c3                   	ret
+
+0000000000803e0e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803e0e:	55                   	push   %rbp
+  803e0f:	48 89 e5             	mov    %rsp,%rbp
+  803e12:	48 83 ec 40          	sub    $0x40,%rsp
+  803e16:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e19:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803e1d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803e21:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803e25:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e28:	48 89 d6             	mov    %rdx,%rsi
+  803e2b:	89 c7                	mov    %eax,%edi
+  803e2d:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  803e34:	00 00 00 
+  803e37:	ff d0                	call   *%rax
+  803e39:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e3c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e40:	78 24                	js     803e66 <write+0x58>
+  803e42:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e46:	8b 00                	mov    (%rax),%eax
+  803e48:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803e4c:	48 89 d6             	mov    %rdx,%rsi
+  803e4f:	89 c7                	mov    %eax,%edi
+  803e51:	48 b8 d7 38 80 00 00 	movabs $0x8038d7,%rax
+  803e58:	00 00 00 
+  803e5b:	ff d0                	call   *%rax
+  803e5d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e60:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e64:	79 0a                	jns    803e70 <write+0x62>
+    return r;
+  803e66:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e69:	48 98                	cltq
+  803e6b:	e9 9d 00 00 00       	jmp    803f0d <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803e70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e74:	8b 40 08             	mov    0x8(%rax),%eax
+  803e77:	83 e0 03             	and    $0x3,%eax
+  803e7a:	85 c0                	test   %eax,%eax
+  803e7c:	75 5c                	jne    803eda <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803e7e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803e85:	00 00 00 
+  803e88:	8b 40 04             	mov    0x4(%rax),%eax
+  803e8b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803e90:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803e97:	00 00 00 
+  803e9a:	48 98                	cltq
+  803e9c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803ea3:	48 01 d0             	add    %rdx,%rax
+  803ea6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803eac:	8b 00                	mov    (%rax),%eax
+  803eae:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803eb1:	89 c6                	mov    %eax,%esi
+  803eb3:	48 b8 73 6f 80 00 00 	movabs $0x806f73,%rax
+  803eba:	00 00 00 
+  803ebd:	48 89 c7             	mov    %rax,%rdi
+  803ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec5:	48 b9 26 07 80 00 00 	movabs $0x800726,%rcx
+  803ecc:	00 00 00 
+  803ecf:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803ed1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803ed8:	eb 33                	jmp    803f0d <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803eda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ede:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803ee2:	48 85 c0             	test   %rax,%rax
+  803ee5:	75 09                	jne    803ef0 <write+0xe2>
+    return -E_NOT_SUPP;
+  803ee7:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803eee:	eb 1d                	jmp    803f0d <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803ef0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ef4:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803ef8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803efc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803f00:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803f04:	48 89 ce             	mov    %rcx,%rsi
+  803f07:	48 89 c7             	mov    %rax,%rdi
+  803f0a:	41 ff d0             	call   *%r8
+}
+  803f0d:	c9                   	leave
+  803f0e:	c3                   	ret
+
+0000000000803f0f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803f0f:	55                   	push   %rbp
+  803f10:	48 89 e5             	mov    %rsp,%rbp
+  803f13:	48 83 ec 18          	sub    $0x18,%rsp
+  803f17:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803f1a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803f1d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803f21:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f24:	48 89 d6             	mov    %rdx,%rsi
+  803f27:	89 c7                	mov    %eax,%edi
+  803f29:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  803f30:	00 00 00 
+  803f33:	ff d0                	call   *%rax
+  803f35:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f38:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f3c:	79 05                	jns    803f43 <seek+0x34>
+    return r;
+  803f3e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f41:	eb 0f                	jmp    803f52 <seek+0x43>
+  fd->fd_offset = offset;
+  803f43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f47:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803f4a:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f52:	c9                   	leave
+  803f53:	c3                   	ret
+
+0000000000803f54 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803f54:	55                   	push   %rbp
+  803f55:	48 89 e5             	mov    %rsp,%rbp
+  803f58:	48 83 ec 30          	sub    $0x30,%rsp
+  803f5c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803f5f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f62:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803f66:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f69:	48 89 d6             	mov    %rdx,%rsi
+  803f6c:	89 c7                	mov    %eax,%edi
+  803f6e:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  803f75:	00 00 00 
+  803f78:	ff d0                	call   *%rax
+  803f7a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f7d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f81:	78 24                	js     803fa7 <ftruncate+0x53>
+  803f83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f87:	8b 00                	mov    (%rax),%eax
+  803f89:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803f8d:	48 89 d6             	mov    %rdx,%rsi
+  803f90:	89 c7                	mov    %eax,%edi
+  803f92:	48 b8 d7 38 80 00 00 	movabs $0x8038d7,%rax
+  803f99:	00 00 00 
+  803f9c:	ff d0                	call   *%rax
+  803f9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fa1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fa5:	79 08                	jns    803faf <ftruncate+0x5b>
+    return r;
+  803fa7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803faa:	e9 92 00 00 00       	jmp    804041 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803faf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fb3:	8b 40 08             	mov    0x8(%rax),%eax
+  803fb6:	83 e0 03             	and    $0x3,%eax
+  803fb9:	85 c0                	test   %eax,%eax
+  803fbb:	75 5a                	jne    804017 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803fbd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803fc4:	00 00 00 
+  803fc7:	8b 40 04             	mov    0x4(%rax),%eax
+  803fca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fcf:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fd6:	00 00 00 
+  803fd9:	48 98                	cltq
+  803fdb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803fe2:	48 01 d0             	add    %rdx,%rax
+  803fe5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803feb:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803fed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803ff0:	89 c6                	mov    %eax,%esi
+  803ff2:	48 b8 90 6f 80 00 00 	movabs $0x806f90,%rax
+  803ff9:	00 00 00 
+  803ffc:	48 89 c7             	mov    %rax,%rdi
+  803fff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804004:	48 b9 26 07 80 00 00 	movabs $0x800726,%rcx
+  80400b:	00 00 00 
+  80400e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  804010:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804015:	eb 2a                	jmp    804041 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  804017:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80401b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80401f:	48 85 c0             	test   %rax,%rax
+  804022:	75 07                	jne    80402b <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  804024:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  804029:	eb 16                	jmp    804041 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80402b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80402f:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804033:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804037:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80403a:	89 d6                	mov    %edx,%esi
+  80403c:	48 89 c7             	mov    %rax,%rdi
+  80403f:	ff d1                	call   *%rcx
+}
+  804041:	c9                   	leave
+  804042:	c3                   	ret
+
+0000000000804043 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  804043:	55                   	push   %rbp
+  804044:	48 89 e5             	mov    %rsp,%rbp
+  804047:	48 83 ec 30          	sub    $0x30,%rsp
+  80404b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80404e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804052:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804056:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804059:	48 89 d6             	mov    %rdx,%rsi
+  80405c:	89 c7                	mov    %eax,%edi
+  80405e:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  804065:	00 00 00 
+  804068:	ff d0                	call   *%rax
+  80406a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80406d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804071:	78 24                	js     804097 <fstat+0x54>
+  804073:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804077:	8b 00                	mov    (%rax),%eax
+  804079:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80407d:	48 89 d6             	mov    %rdx,%rsi
+  804080:	89 c7                	mov    %eax,%edi
+  804082:	48 b8 d7 38 80 00 00 	movabs $0x8038d7,%rax
+  804089:	00 00 00 
+  80408c:	ff d0                	call   *%rax
+  80408e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804091:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804095:	79 05                	jns    80409c <fstat+0x59>
+    return r;
+  804097:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80409a:	eb 5e                	jmp    8040fa <fstat+0xb7>
+  if (!dev->dev_stat)
+  80409c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040a0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8040a4:	48 85 c0             	test   %rax,%rax
+  8040a7:	75 07                	jne    8040b0 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8040a9:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8040ae:	eb 4a                	jmp    8040fa <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8040b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040b4:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8040b7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040bb:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8040c2:	00 00 00 
+  stat->st_isdir   = 0;
+  8040c5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040c9:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8040d0:	00 00 00 
+  stat->st_dev     = dev;
+  8040d3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8040d7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8040db:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8040e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8040e6:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8040ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040ee:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8040f2:	48 89 d6             	mov    %rdx,%rsi
+  8040f5:	48 89 c7             	mov    %rax,%rdi
+  8040f8:	ff d1                	call   *%rcx
+}
+  8040fa:	c9                   	leave
+  8040fb:	c3                   	ret
+
+00000000008040fc <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8040fc:	55                   	push   %rbp
+  8040fd:	48 89 e5             	mov    %rsp,%rbp
+  804100:	48 83 ec 10          	sub    $0x10,%rsp
+  804104:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804108:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80410c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804110:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804116:	83 f8 20             	cmp    $0x20,%eax
+  804119:	75 07                	jne    804122 <pollwait_key+0x26>
+    return -E_INVAL;
+  80411b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804120:	eb 5f                	jmp    804181 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  804122:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804126:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80412c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804130:	48 63 d2             	movslq %edx,%rdx
+  804133:	48 c1 e2 04          	shl    $0x4,%rdx
+  804137:	48 01 c2             	add    %rax,%rdx
+  80413a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80413e:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  804141:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804145:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80414b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80414f:	8b 00                	mov    (%rax),%eax
+  804151:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804155:	48 63 c9             	movslq %ecx,%rcx
+  804158:	48 c1 e1 04          	shl    $0x4,%rcx
+  80415c:	48 01 ca             	add    %rcx,%rdx
+  80415f:	48 83 c2 08          	add    $0x8,%rdx
+  804163:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  804165:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804169:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80416f:	8d 50 01             	lea    0x1(%rax),%edx
+  804172:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804176:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  80417c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804181:	c9                   	leave
+  804182:	c3                   	ret
+
+0000000000804183 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  804183:	55                   	push   %rbp
+  804184:	48 89 e5             	mov    %rsp,%rbp
+  804187:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  80418e:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  804195:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  80419b:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8041a2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8041a9:	00 
+  int i, r, ready, ipc = 0;
+  8041aa:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8041b1:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8041b8:	00 
+  8041b9:	74 45                	je     804200 <poll+0x7d>
+  8041bb:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8041c2:	ff 
+  8041c3:	74 3b                	je     804200 <poll+0x7d>
+    now      = vsys_clock_ns();
+  8041c5:	48 b8 9f 5b 80 00 00 	movabs $0x805b9f,%rax
+  8041cc:	00 00 00 
+  8041cf:	ff d0                	call   *%rax
+  8041d1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8041d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8041d9:	48 f7 d0             	not    %rax
+  8041dc:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8041e3:	73 10                	jae    8041f5 <poll+0x72>
+  8041e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8041e9:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8041f0:	48 01 d0             	add    %rdx,%rax
+  8041f3:	eb 07                	jmp    8041fc <poll+0x79>
+  8041f5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8041fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  804200:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  804207:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80420e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804215:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80421c:	e9 46 02 00 00       	jmp    804467 <poll+0x2e4>
+      fds[i].revents = 0;
+  804221:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804224:	48 63 d0             	movslq %eax,%rdx
+  804227:	48 89 d0             	mov    %rdx,%rax
+  80422a:	48 01 c0             	add    %rax,%rax
+  80422d:	48 01 d0             	add    %rdx,%rax
+  804230:	48 c1 e0 02          	shl    $0x2,%rax
+  804234:	48 89 c2             	mov    %rax,%rdx
+  804237:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80423e:	48 01 d0             	add    %rdx,%rax
+  804241:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  804248:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80424b:	48 63 d0             	movslq %eax,%rdx
+  80424e:	48 89 d0             	mov    %rdx,%rax
+  804251:	48 01 c0             	add    %rax,%rax
+  804254:	48 01 d0             	add    %rdx,%rax
+  804257:	48 c1 e0 02          	shl    $0x2,%rax
+  80425b:	48 89 c2             	mov    %rax,%rdx
+  80425e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804265:	48 01 d0             	add    %rdx,%rax
+  804268:	8b 00                	mov    (%rax),%eax
+  80426a:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  80426d:	75 62                	jne    8042d1 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  80426f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804272:	48 63 d0             	movslq %eax,%rdx
+  804275:	48 89 d0             	mov    %rdx,%rax
+  804278:	48 01 c0             	add    %rax,%rax
+  80427b:	48 01 d0             	add    %rdx,%rax
+  80427e:	48 c1 e0 02          	shl    $0x2,%rax
+  804282:	48 89 c2             	mov    %rax,%rdx
+  804285:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80428c:	48 01 d0             	add    %rdx,%rax
+  80428f:	8b 40 04             	mov    0x4(%rax),%eax
+  804292:	83 e0 01             	and    $0x1,%eax
+  804295:	85 c0                	test   %eax,%eax
+  804297:	0f 84 9b 01 00 00    	je     804438 <poll+0x2b5>
+          fds[i].revents = ipc;
+  80429d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042a0:	48 63 d0             	movslq %eax,%rdx
+  8042a3:	48 89 d0             	mov    %rdx,%rax
+  8042a6:	48 01 c0             	add    %rax,%rax
+  8042a9:	48 01 d0             	add    %rdx,%rax
+  8042ac:	48 c1 e0 02          	shl    $0x2,%rax
+  8042b0:	48 89 c2             	mov    %rax,%rdx
+  8042b3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8042ba:	48 01 c2             	add    %rax,%rdx
+  8042bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8042c0:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8042c3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8042c6:	83 c8 04             	or     $0x4,%eax
+  8042c9:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8042cc:	e9 67 01 00 00       	jmp    804438 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8042d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042d4:	48 63 d0             	movslq %eax,%rdx
+  8042d7:	48 89 d0             	mov    %rdx,%rax
+  8042da:	48 01 c0             	add    %rax,%rax
+  8042dd:	48 01 d0             	add    %rdx,%rax
+  8042e0:	48 c1 e0 02          	shl    $0x2,%rax
+  8042e4:	48 89 c2             	mov    %rax,%rdx
+  8042e7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8042ee:	48 01 d0             	add    %rdx,%rax
+  8042f1:	8b 00                	mov    (%rax),%eax
+  8042f3:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8042fa:	48 89 d6             	mov    %rdx,%rsi
+  8042fd:	89 c7                	mov    %eax,%edi
+  8042ff:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  804306:	00 00 00 
+  804309:	ff d0                	call   *%rax
+  80430b:	85 c0                	test   %eax,%eax
+  80430d:	78 25                	js     804334 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80430f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804316:	8b 00                	mov    (%rax),%eax
+  804318:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80431f:	48 89 d6             	mov    %rdx,%rsi
+  804322:	89 c7                	mov    %eax,%edi
+  804324:	48 b8 d7 38 80 00 00 	movabs $0x8038d7,%rax
+  80432b:	00 00 00 
+  80432e:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804330:	85 c0                	test   %eax,%eax
+  804332:	79 2c                	jns    804360 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  804334:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804337:	48 63 d0             	movslq %eax,%rdx
+  80433a:	48 89 d0             	mov    %rdx,%rax
+  80433d:	48 01 c0             	add    %rax,%rax
+  804340:	48 01 d0             	add    %rdx,%rax
+  804343:	48 c1 e0 02          	shl    $0x2,%rax
+  804347:	48 89 c2             	mov    %rax,%rdx
+  80434a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804351:	48 01 d0             	add    %rdx,%rax
+  804354:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80435b:	e9 d8 00 00 00       	jmp    804438 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  804360:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804367:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80436b:	48 85 c0             	test   %rax,%rax
+  80436e:	74 7d                	je     8043ed <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  804370:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804377:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  80437b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80437e:	48 63 d0             	movslq %eax,%rdx
+  804381:	48 89 d0             	mov    %rdx,%rax
+  804384:	48 01 c0             	add    %rax,%rax
+  804387:	48 01 d0             	add    %rdx,%rax
+  80438a:	48 c1 e0 02          	shl    $0x2,%rax
+  80438e:	48 89 c2             	mov    %rax,%rdx
+  804391:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804398:	48 01 d0             	add    %rdx,%rax
+  80439b:	8b 48 04             	mov    0x4(%rax),%ecx
+  80439e:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8043a5:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8043ac:	89 ce                	mov    %ecx,%esi
+  8043ae:	48 89 c7             	mov    %rax,%rdi
+  8043b1:	41 ff d0             	call   *%r8
+  8043b4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8043b7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8043bb:	79 08                	jns    8043c5 <poll+0x242>
+          return r;
+  8043bd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043c0:	e9 45 01 00 00       	jmp    80450a <poll+0x387>
+        fds[i].revents = r;
+  8043c5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043c8:	48 63 d0             	movslq %eax,%rdx
+  8043cb:	48 89 d0             	mov    %rdx,%rax
+  8043ce:	48 01 c0             	add    %rax,%rax
+  8043d1:	48 01 d0             	add    %rdx,%rax
+  8043d4:	48 c1 e0 02          	shl    $0x2,%rax
+  8043d8:	48 89 c2             	mov    %rax,%rdx
+  8043db:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8043e2:	48 01 c2             	add    %rax,%rdx
+  8043e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8043e8:	89 42 08             	mov    %eax,0x8(%rdx)
+  8043eb:	eb 4b                	jmp    804438 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8043ed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8043f0:	48 63 d0             	movslq %eax,%rdx
+  8043f3:	48 89 d0             	mov    %rdx,%rax
+  8043f6:	48 01 c0             	add    %rax,%rax
+  8043f9:	48 01 d0             	add    %rdx,%rax
+  8043fc:	48 c1 e0 02          	shl    $0x2,%rax
+  804400:	48 89 c2             	mov    %rax,%rdx
+  804403:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80440a:	48 01 d0             	add    %rdx,%rax
+  80440d:	8b 48 04             	mov    0x4(%rax),%ecx
+  804410:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804413:	48 63 d0             	movslq %eax,%rdx
+  804416:	48 89 d0             	mov    %rdx,%rax
+  804419:	48 01 c0             	add    %rax,%rax
+  80441c:	48 01 d0             	add    %rdx,%rax
+  80441f:	48 c1 e0 02          	shl    $0x2,%rax
+  804423:	48 89 c2             	mov    %rax,%rdx
+  804426:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80442d:	48 01 d0             	add    %rdx,%rax
+  804430:	83 e1 03             	and    $0x3,%ecx
+  804433:	89 ca                	mov    %ecx,%edx
+  804435:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804438:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80443b:	48 63 d0             	movslq %eax,%rdx
+  80443e:	48 89 d0             	mov    %rdx,%rax
+  804441:	48 01 c0             	add    %rax,%rax
+  804444:	48 01 d0             	add    %rdx,%rax
+  804447:	48 c1 e0 02          	shl    $0x2,%rax
+  80444b:	48 89 c2             	mov    %rax,%rdx
+  80444e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804455:	48 01 d0             	add    %rdx,%rax
+  804458:	8b 40 08             	mov    0x8(%rax),%eax
+  80445b:	85 c0                	test   %eax,%eax
+  80445d:	74 04                	je     804463 <poll+0x2e0>
+        ready++;
+  80445f:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804463:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804467:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80446a:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  804470:	0f 8c ab fd ff ff    	jl     804221 <poll+0x9e>
+    }
+    if (ready)
+  804476:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80447a:	74 08                	je     804484 <poll+0x301>
+      return ready;
+  80447c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80447f:	e9 86 00 00 00       	jmp    80450a <poll+0x387>
+
+    if (deadline) {
+  804484:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804489:	74 30                	je     8044bb <poll+0x338>
+      now     = vsys_clock_ns();
+  80448b:	48 b8 9f 5b 80 00 00 	movabs $0x805b9f,%rax
+  804492:	00 00 00 
+  804495:	ff d0                	call   *%rax
+  804497:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80449b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80449f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8044a3:	73 0a                	jae    8044af <poll+0x32c>
+  8044a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8044a9:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8044ad:	eb 05                	jmp    8044b4 <poll+0x331>
+  8044af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b4:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8044bb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8044be:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8044c1:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8044c8:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8044cf:	48 89 c7             	mov    %rax,%rdi
+  8044d2:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  8044d9:	00 00 00 
+  8044dc:	ff d0                	call   *%rax
+  8044de:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8044e1:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8044e5:	75 07                	jne    8044ee <poll+0x36b>
+      return 0;
+  8044e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044ec:	eb 1c                	jmp    80450a <poll+0x387>
+    if (r < 0)
+  8044ee:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8044f2:	79 05                	jns    8044f9 <poll+0x376>
+      return r;
+  8044f4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044f7:	eb 11                	jmp    80450a <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8044f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044fc:	c1 f8 02             	sar    $0x2,%eax
+  8044ff:	83 e0 01             	and    $0x1,%eax
+  804502:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  804505:	e9 f6 fc ff ff       	jmp    804200 <poll+0x7d>
+  }
+}
+  80450a:	c9                   	leave
+  80450b:	c3                   	ret
+
+000000000080450c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80450c:	55                   	push   %rbp
+  80450d:	48 89 e5             	mov    %rsp,%rbp
+  804510:	48 83 ec 20          	sub    $0x20,%rsp
+  804514:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804518:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80451c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804520:	be 00 00 00 00       	mov    $0x0,%esi
+  804525:	48 89 c7             	mov    %rax,%rdi
+  804528:	48 b8 fa 45 80 00 00 	movabs $0x8045fa,%rax
+  80452f:	00 00 00 
+  804532:	ff d0                	call   *%rax
+  804534:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804537:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80453b:	79 05                	jns    804542 <stat+0x36>
+    return fd;
+  80453d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804540:	eb 2f                	jmp    804571 <stat+0x65>
+  r = fstat(fd, stat);
+  804542:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804546:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804549:	48 89 d6             	mov    %rdx,%rsi
+  80454c:	89 c7                	mov    %eax,%edi
+  80454e:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  804555:	00 00 00 
+  804558:	ff d0                	call   *%rax
+  80455a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80455d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804560:	89 c7                	mov    %eax,%edi
+  804562:	48 b8 ab 39 80 00 00 	movabs $0x8039ab,%rax
+  804569:	00 00 00 
+  80456c:	ff d0                	call   *%rax
+  return r;
+  80456e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804571:	c9                   	leave
+  804572:	c3                   	ret
+
+0000000000804573 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  804573:	55                   	push   %rbp
+  804574:	48 89 e5             	mov    %rsp,%rbp
+  804577:	48 83 ec 10          	sub    $0x10,%rsp
+  80457b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80457e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  804582:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804589:	00 00 00 
+  80458c:	8b 00                	mov    (%rax),%eax
+  80458e:	85 c0                	test   %eax,%eax
+  804590:	75 1d                	jne    8045af <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  804592:	bf 03 00 00 00       	mov    $0x3,%edi
+  804597:	48 b8 95 35 80 00 00 	movabs $0x803595,%rax
+  80459e:	00 00 00 
+  8045a1:	ff d0                	call   *%rax
+  8045a3:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  8045aa:	00 00 00 
+  8045ad:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8045af:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8045b6:	00 00 00 
+  8045b9:	8b 00                	mov    (%rax),%eax
+  8045bb:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8045be:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8045c3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8045ca:	00 00 00 
+  8045cd:	89 c7                	mov    %eax,%edi
+  8045cf:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  8045d6:	00 00 00 
+  8045d9:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8045db:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045e4:	48 89 c6             	mov    %rax,%rsi
+  8045e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045ec:	48 b8 6b 33 80 00 00 	movabs $0x80336b,%rax
+  8045f3:	00 00 00 
+  8045f6:	ff d0                	call   *%rax
+}
+  8045f8:	c9                   	leave
+  8045f9:	c3                   	ret
+
+00000000008045fa <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8045fa:	55                   	push   %rbp
+  8045fb:	48 89 e5             	mov    %rsp,%rbp
+  8045fe:	48 83 ec 20          	sub    $0x20,%rsp
+  804602:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804606:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804609:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80460d:	48 89 c7             	mov    %rax,%rdi
+  804610:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  804617:	00 00 00 
+  80461a:	ff d0                	call   *%rax
+  80461c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804621:	7e 0a                	jle    80462d <open+0x33>
+    return -E_BAD_PATH;
+  804623:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804628:	e9 a8 00 00 00       	jmp    8046d5 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80462d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804631:	48 89 c7             	mov    %rax,%rdi
+  804634:	48 b8 54 36 80 00 00 	movabs $0x803654,%rax
+  80463b:	00 00 00 
+  80463e:	ff d0                	call   *%rax
+  804640:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804643:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804647:	79 08                	jns    804651 <open+0x57>
+    return r;
+  804649:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80464c:	e9 84 00 00 00       	jmp    8046d5 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804651:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804655:	48 89 c6             	mov    %rax,%rsi
+  804658:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80465f:	00 00 00 
+  804662:	48 89 c7             	mov    %rax,%rdi
+  804665:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  80466c:	00 00 00 
+  80466f:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  804671:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804678:	00 00 00 
+  80467b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80467e:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804684:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804688:	48 89 c6             	mov    %rax,%rsi
+  80468b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804690:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  804697:	00 00 00 
+  80469a:	ff d0                	call   *%rax
+  80469c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80469f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8046a3:	79 1d                	jns    8046c2 <open+0xc8>
+    fd_close(fd, 0);
+  8046a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8046ae:	48 89 c7             	mov    %rax,%rdi
+  8046b1:	48 b8 0c 38 80 00 00 	movabs $0x80380c,%rax
+  8046b8:	00 00 00 
+  8046bb:	ff d0                	call   *%rax
+    return r;
+  8046bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8046c0:	eb 13                	jmp    8046d5 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8046c2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8046c6:	48 89 c7             	mov    %rax,%rdi
+  8046c9:	48 b8 06 36 80 00 00 	movabs $0x803606,%rax
+  8046d0:	00 00 00 
+  8046d3:	ff d0                	call   *%rax
+}
+  8046d5:	c9                   	leave
+  8046d6:	c3                   	ret
+
+00000000008046d7 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  8046d7:	55                   	push   %rbp
+  8046d8:	48 89 e5             	mov    %rsp,%rbp
+  8046db:	48 83 ec 10          	sub    $0x10,%rsp
+  8046df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8046e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046e7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8046ea:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8046f1:	00 00 00 
+  8046f4:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8046f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8046fb:	bf 06 00 00 00       	mov    $0x6,%edi
+  804700:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  804707:	00 00 00 
+  80470a:	ff d0                	call   *%rax
+}
+  80470c:	c9                   	leave
+  80470d:	c3                   	ret
+
+000000000080470e <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80470e:	55                   	push   %rbp
+  80470f:	48 89 e5             	mov    %rsp,%rbp
+  804712:	48 83 ec 30          	sub    $0x30,%rsp
+  804716:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80471a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80471e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804722:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804727:	74 07                	je     804730 <devfile_read+0x22>
+  804729:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80472e:	75 0a                	jne    80473a <devfile_read+0x2c>
+  return E_INVAL;
+  804730:	b8 03 00 00 00       	mov    $0x3,%eax
+  804735:	e9 b4 00 00 00       	jmp    8047ee <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  80473a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804741:	00 
+  while (n) {
+  804742:	e9 98 00 00 00       	jmp    8047df <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804747:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80474b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80474e:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804755:	00 00 00 
+  804758:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80475a:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804761:	00 00 00 
+  804764:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804768:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80476c:	be 00 00 00 00       	mov    $0x0,%esi
+  804771:	bf 03 00 00 00       	mov    $0x3,%edi
+  804776:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  80477d:	00 00 00 
+  804780:	ff d0                	call   *%rax
+  804782:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  804785:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804789:	7f 13                	jg     80479e <devfile_read+0x90>
+      return res ? res : res0;
+  80478b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80478f:	74 07                	je     804798 <devfile_read+0x8a>
+  804791:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804794:	48 98                	cltq
+  804796:	eb 56                	jmp    8047ee <devfile_read+0xe0>
+  804798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80479c:	eb 50                	jmp    8047ee <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80479e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8047a1:	48 63 d0             	movslq %eax,%rdx
+  8047a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047a8:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  8047af:	00 00 00 
+  8047b2:	48 89 ce             	mov    %rcx,%rsi
+  8047b5:	48 89 c7             	mov    %rax,%rdi
+  8047b8:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  8047bf:	00 00 00 
+  8047c2:	ff d0                	call   *%rax
+
+    buf += res;
+  8047c4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8047c7:	48 98                	cltq
+  8047c9:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8047cd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8047d0:	48 98                	cltq
+  8047d2:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  8047d6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8047d9:	48 98                	cltq
+  8047db:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8047df:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8047e4:	0f 85 5d ff ff ff    	jne    804747 <devfile_read+0x39>
+  }
+
+  return res0;
+  8047ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8047ee:	c9                   	leave
+  8047ef:	c3                   	ret
+
+00000000008047f0 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8047f0:	55                   	push   %rbp
+  8047f1:	48 89 e5             	mov    %rsp,%rbp
+  8047f4:	48 83 ec 50          	sub    $0x50,%rsp
+  8047f8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8047fc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804800:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804804:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804809:	74 07                	je     804812 <devfile_write+0x22>
+  80480b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804810:	75 0a                	jne    80481c <devfile_write+0x2c>
+  return E_INVAL;
+  804812:	b8 03 00 00 00       	mov    $0x3,%eax
+  804817:	e9 c9 00 00 00       	jmp    8048e5 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80481c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804823:	00 
+
+  while (n) {
+  804824:	e9 ad 00 00 00       	jmp    8048d6 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804829:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80482d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804831:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804838:	00 
+  804839:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80483d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804841:	48 39 c2             	cmp    %rax,%rdx
+  804844:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804848:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  80484c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804850:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804854:	48 89 c6             	mov    %rax,%rsi
+  804857:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  80485e:	00 00 00 
+  804861:	48 89 c7             	mov    %rax,%rdi
+  804864:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  80486b:	00 00 00 
+  80486e:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804870:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804874:	8b 40 0c             	mov    0xc(%rax),%eax
+  804877:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80487e:	00 00 00 
+  804881:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804883:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80488a:	00 00 00 
+  80488d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804891:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804895:	be 00 00 00 00       	mov    $0x0,%esi
+  80489a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80489f:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  8048a6:	00 00 00 
+  8048a9:	ff d0                	call   *%rax
+  8048ab:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8048ae:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8048b2:	79 07                	jns    8048bb <devfile_write+0xcb>
+      return res;
+  8048b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048b7:	48 98                	cltq
+  8048b9:	eb 2a                	jmp    8048e5 <devfile_write+0xf5>
+
+    buf += res;
+  8048bb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048be:	48 98                	cltq
+  8048c0:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8048c4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048c7:	48 98                	cltq
+  8048c9:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8048cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8048d0:	48 98                	cltq
+  8048d2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8048d6:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8048db:	0f 85 48 ff ff ff    	jne    804829 <devfile_write+0x39>
+  }
+
+  return res0;
+  8048e1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8048e5:	c9                   	leave
+  8048e6:	c3                   	ret
+
+00000000008048e7 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8048e7:	55                   	push   %rbp
+  8048e8:	48 89 e5             	mov    %rsp,%rbp
+  8048eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8048ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8048f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8048f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048fb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8048fe:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804905:	00 00 00 
+  804908:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80490a:	be 00 00 00 00       	mov    $0x0,%esi
+  80490f:	bf 05 00 00 00       	mov    $0x5,%edi
+  804914:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  80491b:	00 00 00 
+  80491e:	ff d0                	call   *%rax
+  804920:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804923:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804927:	79 05                	jns    80492e <devfile_stat+0x47>
+    return r;
+  804929:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80492c:	eb 59                	jmp    804987 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80492e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804932:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804939:	00 00 00 
+  80493c:	48 89 d6             	mov    %rdx,%rsi
+  80493f:	48 89 c7             	mov    %rax,%rdi
+  804942:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  804949:	00 00 00 
+  80494c:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  80494e:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804955:	00 00 00 
+  804958:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  80495e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804962:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804968:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80496f:	00 00 00 
+  804972:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804978:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80497c:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804982:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804987:	c9                   	leave
+  804988:	c3                   	ret
+
+0000000000804989 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804989:	55                   	push   %rbp
+  80498a:	48 89 e5             	mov    %rsp,%rbp
+  80498d:	48 83 ec 10          	sub    $0x10,%rsp
+  804991:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804995:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804998:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80499c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80499f:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8049a6:	00 00 00 
+  8049a9:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8049ab:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8049b2:	00 00 00 
+  8049b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049b8:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8049bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8049c0:	bf 02 00 00 00       	mov    $0x2,%edi
+  8049c5:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  8049cc:	00 00 00 
+  8049cf:	ff d0                	call   *%rax
+}
+  8049d1:	c9                   	leave
+  8049d2:	c3                   	ret
+
+00000000008049d3 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8049d3:	55                   	push   %rbp
+  8049d4:	48 89 e5             	mov    %rsp,%rbp
+  8049d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8049db:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8049df:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8049e2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8049e6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049e9:	83 e0 03             	and    $0x3,%eax
+}
+  8049ec:	c9                   	leave
+  8049ed:	c3                   	ret
+
+00000000008049ee <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8049ee:	55                   	push   %rbp
+  8049ef:	48 89 e5             	mov    %rsp,%rbp
+  8049f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8049f6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8049fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049fe:	48 89 c7             	mov    %rax,%rdi
+  804a01:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  804a08:	00 00 00 
+  804a0b:	ff d0                	call   *%rax
+  804a0d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804a12:	7e 07                	jle    804a1b <remove+0x2d>
+    return -E_BAD_PATH;
+  804a14:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804a19:	eb 36                	jmp    804a51 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804a1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a1f:	48 89 c6             	mov    %rax,%rsi
+  804a22:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804a29:	00 00 00 
+  804a2c:	48 89 c7             	mov    %rax,%rdi
+  804a2f:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  804a36:	00 00 00 
+  804a39:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804a3b:	be 00 00 00 00       	mov    $0x0,%esi
+  804a40:	bf 07 00 00 00       	mov    $0x7,%edi
+  804a45:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  804a4c:	00 00 00 
+  804a4f:	ff d0                	call   *%rax
+}
+  804a51:	c9                   	leave
+  804a52:	c3                   	ret
+
+0000000000804a53 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804a53:	55                   	push   %rbp
+  804a54:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804a57:	be 00 00 00 00       	mov    $0x0,%esi
+  804a5c:	bf 08 00 00 00       	mov    $0x8,%edi
+  804a61:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  804a68:	00 00 00 
+  804a6b:	ff d0                	call   *%rax
+}
+  804a6d:	5d                   	pop    %rbp
+  804a6e:	c3                   	ret
+
+0000000000804a6f <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804a6f:	55                   	push   %rbp
+  804a70:	48 89 e5             	mov    %rsp,%rbp
+  804a73:	48 83 ec 20          	sub    $0x20,%rsp
+  804a77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804a7b:	be 00 00 00 00       	mov    $0x0,%esi
+  804a80:	bf 09 00 00 00       	mov    $0x9,%edi
+  804a85:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  804a8c:	00 00 00 
+  804a8f:	ff d0                	call   *%rax
+  804a91:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a94:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a98:	79 05                	jns    804a9f <fs_stats+0x30>
+    return r;
+  804a9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a9d:	eb 2a                	jmp    804ac9 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804a9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aa3:	ba 68 00 00 00       	mov    $0x68,%edx
+  804aa8:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804aaf:	00 00 00 
+  804ab2:	48 89 ce             	mov    %rcx,%rsi
+  804ab5:	48 89 c7             	mov    %rax,%rdi
+  804ab8:	48 b8 19 1c 80 00 00 	movabs $0x801c19,%rax
+  804abf:	00 00 00 
+  804ac2:	ff d0                	call   *%rax
+  return 0;
+  804ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ac9:	c9                   	leave
+  804aca:	c3                   	ret
+
+0000000000804acb <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804acb:	55                   	push   %rbp
+  804acc:	48 89 e5             	mov    %rsp,%rbp
+  804acf:	48 83 ec 10          	sub    $0x10,%rsp
+  804ad3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804ad6:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804add:	00 00 00 
+  804ae0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ae3:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804ae5:	be 00 00 00 00       	mov    $0x0,%esi
+  804aea:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804aef:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  804af6:	00 00 00 
+  804af9:	ff d0                	call   *%rax
+}
+  804afb:	c9                   	leave
+  804afc:	c3                   	ret
+
+0000000000804afd <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804afd:	55                   	push   %rbp
+  804afe:	48 89 e5             	mov    %rsp,%rbp
+  804b01:	48 83 ec 10          	sub    $0x10,%rsp
+  804b05:	89 f8                	mov    %edi,%eax
+  804b07:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804b0a:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804b0e:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804b15:	00 00 00 
+  804b18:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804b1a:	be 00 00 00 00       	mov    $0x0,%esi
+  804b1f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804b24:	48 b8 73 45 80 00 00 	movabs $0x804573,%rax
+  804b2b:	00 00 00 
+  804b2e:	ff d0                	call   *%rax
+}
+  804b30:	c9                   	leave
+  804b31:	c3                   	ret
+
+0000000000804b32 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804b32:	55                   	push   %rbp
+  804b33:	48 89 e5             	mov    %rsp,%rbp
+  804b36:	48 83 ec 10          	sub    $0x10,%rsp
+  804b3a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804b3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b42:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804b47:	48 89 c7             	mov    %rax,%rdi
+  804b4a:	48 b8 58 4b 80 00 00 	movabs $0x804b58,%rax
+  804b51:	00 00 00 
+  804b54:	ff d0                	call   *%rax
+}
+  804b56:	c9                   	leave
+  804b57:	c3                   	ret
+
+0000000000804b58 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804b58:	55                   	push   %rbp
+  804b59:	48 89 e5             	mov    %rsp,%rbp
+  804b5c:	48 83 ec 50          	sub    $0x50,%rsp
+  804b60:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804b64:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804b68:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804b6f:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804b70:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804b75:	74 0a                	je     804b81 <pipe_size+0x29>
+  804b77:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804b7e:	00 
+  804b7f:	76 0a                	jbe    804b8b <pipe_size+0x33>
+    return -E_INVAL;
+  804b81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804b86:	e9 cc 02 00 00       	jmp    804e57 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804b8b:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804b8f:	48 89 c7             	mov    %rax,%rdi
+  804b92:	48 b8 54 36 80 00 00 	movabs $0x803654,%rax
+  804b99:	00 00 00 
+  804b9c:	ff d0                	call   *%rax
+  804b9e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ba1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ba5:	0f 88 a8 02 00 00    	js     804e53 <pipe_size+0x2fb>
+  804bab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804baf:	ba 07 04 00 00       	mov    $0x407,%edx
+  804bb4:	48 89 c6             	mov    %rax,%rsi
+  804bb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bbc:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  804bc3:	00 00 00 
+  804bc6:	ff d0                	call   *%rax
+  804bc8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bcb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bcf:	0f 88 7e 02 00 00    	js     804e53 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804bd5:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804bd9:	48 89 c7             	mov    %rax,%rdi
+  804bdc:	48 b8 54 36 80 00 00 	movabs $0x803654,%rax
+  804be3:	00 00 00 
+  804be6:	ff d0                	call   *%rax
+  804be8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804beb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bef:	0f 88 43 02 00 00    	js     804e38 <pipe_size+0x2e0>
+  804bf5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804bf9:	ba 07 04 00 00       	mov    $0x407,%edx
+  804bfe:	48 89 c6             	mov    %rax,%rsi
+  804c01:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c06:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  804c0d:	00 00 00 
+  804c10:	ff d0                	call   *%rax
+  804c12:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c15:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c19:	0f 88 19 02 00 00    	js     804e38 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804c1f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c23:	48 89 c7             	mov    %rax,%rdi
+  804c26:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  804c2d:	00 00 00 
+  804c30:	ff d0                	call   *%rax
+  804c32:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804c36:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804c3d:	00 
+  804c3e:	e9 a2 00 00 00       	jmp    804ce5 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804c43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c47:	48 c1 e0 0c          	shl    $0xc,%rax
+  804c4b:	48 89 c2             	mov    %rax,%rdx
+  804c4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c52:	48 01 d0             	add    %rdx,%rax
+  804c55:	ba 07 04 00 00       	mov    $0x407,%edx
+  804c5a:	48 89 c6             	mov    %rax,%rsi
+  804c5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c62:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  804c69:	00 00 00 
+  804c6c:	ff d0                	call   *%rax
+  804c6e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c71:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c75:	0f 88 37 01 00 00    	js     804db2 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804c7b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c7f:	48 89 c7             	mov    %rax,%rdi
+  804c82:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  804c89:	00 00 00 
+  804c8c:	ff d0                	call   *%rax
+  804c8e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c92:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804c96:	48 01 c2             	add    %rax,%rdx
+  804c99:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c9d:	48 c1 e0 0c          	shl    $0xc,%rax
+  804ca1:	48 89 c1             	mov    %rax,%rcx
+  804ca4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ca8:	48 01 c8             	add    %rcx,%rax
+  804cab:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804cb1:	48 89 d1             	mov    %rdx,%rcx
+  804cb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cb9:	48 89 c6             	mov    %rax,%rsi
+  804cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cc1:	48 b8 fc 24 80 00 00 	movabs $0x8024fc,%rax
+  804cc8:	00 00 00 
+  804ccb:	ff d0                	call   *%rax
+  804ccd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cd0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cd4:	79 0a                	jns    804ce0 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804cd6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804cdb:	e9 d3 00 00 00       	jmp    804db3 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804ce0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804ce5:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804cec:	00 
+  804ced:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804cf1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cf5:	48 01 d0             	add    %rdx,%rax
+  804cf8:	48 83 c0 1f          	add    $0x1f,%rax
+  804cfc:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804d00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d04:	ba 00 00 00 00       	mov    $0x0,%edx
+  804d09:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804d0d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d11:	48 29 d0             	sub    %rdx,%rax
+  804d14:	48 c1 e8 0c          	shr    $0xc,%rax
+  804d18:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804d1c:	0f 82 21 ff ff ff    	jb     804c43 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804d22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804d26:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804d2a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804d2e:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804d32:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804d36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d3a:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  804d41:	00 00 00 
+  804d44:	8b 12                	mov    (%rdx),%edx
+  804d46:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804d48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d4c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804d53:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d57:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  804d5e:	00 00 00 
+  804d61:	8b 12                	mov    (%rdx),%edx
+  804d63:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804d65:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d69:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804d70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d74:	48 89 c7             	mov    %rax,%rdi
+  804d77:	48 b8 06 36 80 00 00 	movabs $0x803606,%rax
+  804d7e:	00 00 00 
+  804d81:	ff d0                	call   *%rax
+  804d83:	89 c2                	mov    %eax,%edx
+  804d85:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d89:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804d8b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d8f:	48 89 c7             	mov    %rax,%rdi
+  804d92:	48 b8 06 36 80 00 00 	movabs $0x803606,%rax
+  804d99:	00 00 00 
+  804d9c:	ff d0                	call   *%rax
+  804d9e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804da2:	48 83 c2 04          	add    $0x4,%rdx
+  804da6:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804da8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dad:	e9 a5 00 00 00       	jmp    804e57 <pipe_size+0x2ff>
+      goto err2;
+  804db2:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804db3:	eb 58                	jmp    804e0d <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804db5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804db9:	48 c1 e0 0c          	shl    $0xc,%rax
+  804dbd:	48 89 c2             	mov    %rax,%rdx
+  804dc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804dc4:	48 01 d0             	add    %rdx,%rax
+  804dc7:	48 89 c6             	mov    %rax,%rsi
+  804dca:	bf 00 00 00 00       	mov    $0x0,%edi
+  804dcf:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  804dd6:	00 00 00 
+  804dd9:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804ddb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ddf:	48 89 c7             	mov    %rax,%rdi
+  804de2:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  804de9:	00 00 00 
+  804dec:	ff d0                	call   *%rax
+  804dee:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804df2:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804df6:	48 01 d0             	add    %rdx,%rax
+  804df9:	48 89 c6             	mov    %rax,%rsi
+  804dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e01:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  804e08:	00 00 00 
+  804e0b:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804e0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804e11:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804e15:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804e19:	48 85 c0             	test   %rax,%rax
+  804e1c:	75 97                	jne    804db5 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804e1e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e22:	48 89 c6             	mov    %rax,%rsi
+  804e25:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e2a:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  804e31:	00 00 00 
+  804e34:	ff d0                	call   *%rax
+  804e36:	eb 01                	jmp    804e39 <pipe_size+0x2e1>
+    goto err1;
+  804e38:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804e39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e3d:	48 89 c6             	mov    %rax,%rsi
+  804e40:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e45:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  804e4c:	00 00 00 
+  804e4f:	ff d0                	call   *%rax
+  804e51:	eb 01                	jmp    804e54 <pipe_size+0x2fc>
+    goto err;
+  804e53:	90                   	nop
+err:
+  return r;
+  804e54:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804e57:	c9                   	leave
+  804e58:	c3                   	ret
+
+0000000000804e59 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804e59:	55                   	push   %rbp
+  804e5a:	48 89 e5             	mov    %rsp,%rbp
+  804e5d:	53                   	push   %rbx
+  804e5e:	48 83 ec 28          	sub    $0x28,%rsp
+  804e62:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804e66:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804e6a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e71:	00 00 00 
+  804e74:	8b 40 04             	mov    0x4(%rax),%eax
+  804e77:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e7c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e83:	00 00 00 
+  804e86:	48 98                	cltq
+  804e88:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e8f:	48 01 d0             	add    %rdx,%rax
+  804e92:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804e98:	8b 00                	mov    (%rax),%eax
+  804e9a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804e9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ea1:	48 89 c7             	mov    %rax,%rdi
+  804ea4:	48 b8 f6 60 80 00 00 	movabs $0x8060f6,%rax
+  804eab:	00 00 00 
+  804eae:	ff d0                	call   *%rax
+  804eb0:	89 c3                	mov    %eax,%ebx
+  804eb2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804eb6:	48 89 c7             	mov    %rax,%rdi
+  804eb9:	48 b8 f6 60 80 00 00 	movabs $0x8060f6,%rax
+  804ec0:	00 00 00 
+  804ec3:	ff d0                	call   *%rax
+  804ec5:	39 c3                	cmp    %eax,%ebx
+  804ec7:	0f 94 c0             	sete   %al
+  804eca:	0f b6 c0             	movzbl %al,%eax
+  804ecd:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804ed0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804ed7:	00 00 00 
+  804eda:	8b 40 04             	mov    0x4(%rax),%eax
+  804edd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804ee2:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804ee9:	00 00 00 
+  804eec:	48 98                	cltq
+  804eee:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804ef5:	48 01 d0             	add    %rdx,%rax
+  804ef8:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804efe:	8b 00                	mov    (%rax),%eax
+  804f00:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804f03:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f06:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804f09:	75 05                	jne    804f10 <_pipeisclosed+0xb7>
+      return ret;
+  804f0b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804f0e:	eb 68                	jmp    804f78 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804f10:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f13:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804f16:	0f 84 4e ff ff ff    	je     804e6a <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804f1c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804f23:	00 00 00 
+  804f26:	8b 40 04             	mov    0x4(%rax),%eax
+  804f29:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804f2e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f35:	00 00 00 
+  804f38:	48 98                	cltq
+  804f3a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f41:	48 01 d0             	add    %rdx,%rax
+  804f44:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804f4a:	8b 10                	mov    (%rax),%edx
+  804f4c:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804f4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f52:	89 c6                	mov    %eax,%esi
+  804f54:	48 b8 c0 6f 80 00 00 	movabs $0x806fc0,%rax
+  804f5b:	00 00 00 
+  804f5e:	48 89 c7             	mov    %rax,%rdi
+  804f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f66:	49 b8 26 07 80 00 00 	movabs $0x800726,%r8
+  804f6d:	00 00 00 
+  804f70:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804f73:	e9 f2 fe ff ff       	jmp    804e6a <_pipeisclosed+0x11>
+  }
+}
+  804f78:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804f7c:	c9                   	leave
+  804f7d:	c3                   	ret
+
+0000000000804f7e <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804f7e:	55                   	push   %rbp
+  804f7f:	48 89 e5             	mov    %rsp,%rbp
+  804f82:	48 83 ec 30          	sub    $0x30,%rsp
+  804f86:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804f89:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804f8d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804f90:	48 89 d6             	mov    %rdx,%rsi
+  804f93:	89 c7                	mov    %eax,%edi
+  804f95:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  804f9c:	00 00 00 
+  804f9f:	ff d0                	call   *%rax
+  804fa1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804fa4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804fa8:	79 05                	jns    804faf <pipeisclosed+0x31>
+    return r;
+  804faa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804fad:	eb 31                	jmp    804fe0 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804faf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb3:	48 89 c7             	mov    %rax,%rdi
+  804fb6:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  804fbd:	00 00 00 
+  804fc0:	ff d0                	call   *%rax
+  804fc2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804fc6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804fce:	48 89 d6             	mov    %rdx,%rsi
+  804fd1:	48 89 c7             	mov    %rax,%rdi
+  804fd4:	48 b8 59 4e 80 00 00 	movabs $0x804e59,%rax
+  804fdb:	00 00 00 
+  804fde:	ff d0                	call   *%rax
+}
+  804fe0:	c9                   	leave
+  804fe1:	c3                   	ret
+
+0000000000804fe2 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804fe2:	55                   	push   %rbp
+  804fe3:	48 89 e5             	mov    %rsp,%rbp
+  804fe6:	48 83 ec 10          	sub    $0x10,%rsp
+  804fea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804fee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ff2:	8b 40 18             	mov    0x18(%rax),%eax
+  804ff5:	8d 50 01             	lea    0x1(%rax),%edx
+  804ff8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ffc:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804fff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805003:	8b 40 1c             	mov    0x1c(%rax),%eax
+  805006:	85 c0                	test   %eax,%eax
+  805008:	74 27                	je     805031 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80500a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80500e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  805015:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805019:	48 83 c0 18          	add    $0x18,%rax
+  80501d:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  805022:	48 89 c7             	mov    %rax,%rdi
+  805025:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  80502c:	00 00 00 
+  80502f:	ff d0                	call   *%rax
+  }
+}
+  805031:	90                   	nop
+  805032:	c9                   	leave
+  805033:	c3                   	ret
+
+0000000000805034 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  805034:	55                   	push   %rbp
+  805035:	48 89 e5             	mov    %rsp,%rbp
+  805038:	48 83 ec 10          	sub    $0x10,%rsp
+  80503c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805040:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  805043:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805047:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  80504e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805052:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  805056:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805059:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805060:	89 c6                	mov    %eax,%esi
+  805062:	48 89 cf             	mov    %rcx,%rdi
+  805065:	48 b8 50 28 80 00 00 	movabs $0x802850,%rax
+  80506c:	00 00 00 
+  80506f:	ff d0                	call   *%rax
+}
+  805071:	90                   	nop
+  805072:	c9                   	leave
+  805073:	c3                   	ret
+
+0000000000805074 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  805074:	55                   	push   %rbp
+  805075:	48 89 e5             	mov    %rsp,%rbp
+  805078:	48 83 ec 70          	sub    $0x70,%rsp
+  80507c:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805080:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805084:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805088:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80508c:	48 89 c7             	mov    %rax,%rdi
+  80508f:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  805096:	00 00 00 
+  805099:	ff d0                	call   *%rax
+  80509b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80509f:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8050a4:	75 0a                	jne    8050b0 <devpipe_read+0x3c>
+    return 0;
+  8050a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050ab:	e9 63 01 00 00       	jmp    805213 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8050b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050b4:	8b 40 18             	mov    0x18(%rax),%eax
+  8050b7:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8050ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050be:	48 8b 10             	mov    (%rax),%rdx
+  8050c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050c5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8050c9:	48 39 c2             	cmp    %rax,%rdx
+  8050cc:	75 42                	jne    805110 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8050ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050d2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8050d6:	48 89 d6             	mov    %rdx,%rsi
+  8050d9:	48 89 c7             	mov    %rax,%rdi
+  8050dc:	48 b8 59 4e 80 00 00 	movabs $0x804e59,%rax
+  8050e3:	00 00 00 
+  8050e6:	ff d0                	call   *%rax
+  8050e8:	85 c0                	test   %eax,%eax
+  8050ea:	74 0a                	je     8050f6 <devpipe_read+0x82>
+      return 0;
+  8050ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050f1:	e9 1d 01 00 00       	jmp    805213 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8050f6:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8050f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050fd:	89 d6                	mov    %edx,%esi
+  8050ff:	48 89 c7             	mov    %rax,%rdi
+  805102:	48 b8 34 50 80 00 00 	movabs $0x805034,%rax
+  805109:	00 00 00 
+  80510c:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80510e:	eb a0                	jmp    8050b0 <devpipe_read+0x3c>
+      break;
+  805110:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  805111:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805115:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  805119:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80511d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805121:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805125:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805129:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80512d:	48 8b 00             	mov    (%rax),%rax
+  805130:	48 29 c2             	sub    %rax,%rdx
+  805133:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805137:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80513b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80513f:	48 39 c2             	cmp    %rax,%rdx
+  805142:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805146:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  80514a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80514e:	48 8b 00             	mov    (%rax),%rax
+  805151:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805155:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805159:	ba 00 00 00 00       	mov    $0x0,%edx
+  80515e:	48 f7 f1             	div    %rcx
+  805161:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  805165:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805169:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80516d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805171:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805175:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  805179:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80517d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805181:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805185:	48 39 c2             	cmp    %rax,%rdx
+  805188:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80518c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  805190:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805194:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  805198:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80519c:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8051a0:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8051a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051a8:	48 89 ce             	mov    %rcx,%rsi
+  8051ab:	48 89 c7             	mov    %rax,%rdi
+  8051ae:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  8051b5:	00 00 00 
+  8051b8:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8051ba:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8051be:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8051c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8051c6:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8051ca:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8051ce:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8051d2:	48 01 d1             	add    %rdx,%rcx
+  8051d5:	48 89 c2             	mov    %rax,%rdx
+  8051d8:	48 89 cf             	mov    %rcx,%rdi
+  8051db:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  8051e2:	00 00 00 
+  8051e5:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8051e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051eb:	48 8b 10             	mov    (%rax),%rdx
+  8051ee:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8051f2:	48 01 c2             	add    %rax,%rdx
+  8051f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051f9:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8051fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805200:	48 89 c7             	mov    %rax,%rdi
+  805203:	48 b8 e2 4f 80 00 00 	movabs $0x804fe2,%rax
+  80520a:	00 00 00 
+  80520d:	ff d0                	call   *%rax
+  return n;
+  80520f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  805213:	c9                   	leave
+  805214:	c3                   	ret
+
+0000000000805215 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805215:	55                   	push   %rbp
+  805216:	48 89 e5             	mov    %rsp,%rbp
+  805219:	48 83 ec 70          	sub    $0x70,%rsp
+  80521d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805221:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805225:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805229:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80522d:	48 89 c7             	mov    %rax,%rdi
+  805230:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  805237:	00 00 00 
+  80523a:	ff d0                	call   *%rax
+  80523c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  805240:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805244:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805248:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80524f:	00 
+  805250:	e9 b8 01 00 00       	jmp    80540d <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  805255:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805259:	8b 40 18             	mov    0x18(%rax),%eax
+  80525c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  80525f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805263:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805267:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80526b:	48 8b 00             	mov    (%rax),%rax
+  80526e:	48 29 c2             	sub    %rax,%rdx
+  805271:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805275:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805279:	48 39 c2             	cmp    %rax,%rdx
+  80527c:	75 4d                	jne    8052cb <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  80527e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805282:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805286:	48 89 d6             	mov    %rdx,%rsi
+  805289:	48 89 c7             	mov    %rax,%rdi
+  80528c:	48 b8 59 4e 80 00 00 	movabs $0x804e59,%rax
+  805293:	00 00 00 
+  805296:	ff d0                	call   *%rax
+  805298:	85 c0                	test   %eax,%eax
+  80529a:	74 0a                	je     8052a6 <devpipe_write+0x91>
+        return 0;
+  80529c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052a1:	e9 79 01 00 00       	jmp    80541f <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8052a6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8052a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052ad:	89 d6                	mov    %edx,%esi
+  8052af:	48 89 c7             	mov    %rax,%rdi
+  8052b2:	48 b8 34 50 80 00 00 	movabs $0x805034,%rax
+  8052b9:	00 00 00 
+  8052bc:	ff d0                	call   *%rax
+      m = 0;
+  8052be:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8052c5:	00 
+      continue;
+  8052c6:	e9 3a 01 00 00       	jmp    805405 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8052cb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8052cf:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8052d3:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8052d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052db:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8052df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052e3:	48 8b 08             	mov    (%rax),%rcx
+  8052e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052ea:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8052ee:	48 29 c1             	sub    %rax,%rcx
+  8052f1:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8052f5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8052f9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8052fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805301:	48 39 c2             	cmp    %rax,%rdx
+  805304:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805308:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80530c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805310:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805314:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805318:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80531c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805321:	48 f7 f1             	div    %rcx
+  805324:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805328:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80532c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805330:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805334:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805338:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80533c:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  805340:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805344:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805348:	48 39 c2             	cmp    %rax,%rdx
+  80534b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80534f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805353:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805357:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  80535b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80535f:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  805363:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805367:	48 01 d1             	add    %rdx,%rcx
+  80536a:	48 89 c2             	mov    %rax,%rdx
+  80536d:	48 89 cf             	mov    %rcx,%rdi
+  805370:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  805377:	00 00 00 
+  80537a:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  80537c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805380:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805384:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805388:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80538c:	73 4d                	jae    8053db <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  80538e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805392:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805396:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80539a:	48 29 c2             	sub    %rax,%rdx
+  80539d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053a1:	48 01 c2             	add    %rax,%rdx
+  8053a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053a8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8053ac:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8053b0:	48 89 c1             	mov    %rax,%rcx
+  8053b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053b7:	48 01 c1             	add    %rax,%rcx
+  8053ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8053be:	48 01 c1             	add    %rax,%rcx
+  8053c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053c5:	48 83 c0 20          	add    $0x20,%rax
+  8053c9:	48 89 ce             	mov    %rcx,%rsi
+  8053cc:	48 89 c7             	mov    %rax,%rdi
+  8053cf:	48 b8 1f 1e 80 00 00 	movabs $0x801e1f,%rax
+  8053d6:	00 00 00 
+  8053d9:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8053db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053df:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8053e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053e7:	48 01 c2             	add    %rax,%rdx
+  8053ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053ee:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8053f2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8053f6:	48 89 c7             	mov    %rax,%rdi
+  8053f9:	48 b8 e2 4f 80 00 00 	movabs $0x804fe2,%rax
+  805400:	00 00 00 
+  805403:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805405:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805409:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80540d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805411:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805415:	0f 82 3a fe ff ff    	jb     805255 <devpipe_write+0x40>
+  }
+
+  return i;
+  80541b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80541f:	c9                   	leave
+  805420:	c3                   	ret
+
+0000000000805421 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805421:	55                   	push   %rbp
+  805422:	48 89 e5             	mov    %rsp,%rbp
+  805425:	48 83 ec 40          	sub    $0x40,%rsp
+  805429:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80542d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  805430:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805434:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805438:	48 89 c7             	mov    %rax,%rdi
+  80543b:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  805442:	00 00 00 
+  805445:	ff d0                	call   *%rax
+  805447:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  80544b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  805452:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805456:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  80545a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80545e:	48 89 d6             	mov    %rdx,%rsi
+  805461:	48 89 c7             	mov    %rax,%rdi
+  805464:	48 b8 fc 40 80 00 00 	movabs $0x8040fc,%rax
+  80546b:	00 00 00 
+  80546e:	ff d0                	call   *%rax
+  805470:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805473:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805477:	79 08                	jns    805481 <devpipe_poll+0x60>
+    return r;
+  805479:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80547c:	e9 85 00 00 00       	jmp    805506 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  805481:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805484:	83 e0 01             	and    $0x1,%eax
+  805487:	85 c0                	test   %eax,%eax
+  805489:	74 18                	je     8054a3 <devpipe_poll+0x82>
+  80548b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80548f:	48 8b 10             	mov    (%rax),%rdx
+  805492:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805496:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80549a:	48 39 c2             	cmp    %rax,%rdx
+  80549d:	74 04                	je     8054a3 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80549f:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8054a3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8054a6:	83 e0 02             	and    $0x2,%eax
+  8054a9:	85 c0                	test   %eax,%eax
+  8054ab:	74 23                	je     8054d0 <devpipe_poll+0xaf>
+  8054ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054b1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8054b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054b9:	48 8b 00             	mov    (%rax),%rax
+  8054bc:	48 29 c2             	sub    %rax,%rdx
+  8054bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054c3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8054c7:	48 39 c2             	cmp    %rax,%rdx
+  8054ca:	73 04                	jae    8054d0 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8054cc:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8054d0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8054d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054d8:	48 89 d6             	mov    %rdx,%rsi
+  8054db:	48 89 c7             	mov    %rax,%rdi
+  8054de:	48 b8 59 4e 80 00 00 	movabs $0x804e59,%rax
+  8054e5:	00 00 00 
+  8054e8:	ff d0                	call   *%rax
+  8054ea:	85 c0                	test   %eax,%eax
+  8054ec:	74 04                	je     8054f2 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8054ee:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8054f2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054f6:	75 0b                	jne    805503 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8054f8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054fc:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  805503:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805506:	c9                   	leave
+  805507:	c3                   	ret
+
+0000000000805508 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805508:	55                   	push   %rbp
+  805509:	48 89 e5             	mov    %rsp,%rbp
+  80550c:	48 83 ec 20          	sub    $0x20,%rsp
+  805510:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805514:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805518:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80551c:	48 89 c7             	mov    %rax,%rdi
+  80551f:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  805526:	00 00 00 
+  805529:	ff d0                	call   *%rax
+  80552b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  80552f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805533:	48 ba f1 6f 80 00 00 	movabs $0x806ff1,%rdx
+  80553a:	00 00 00 
+  80553d:	48 89 d6             	mov    %rdx,%rsi
+  805540:	48 89 c7             	mov    %rax,%rdi
+  805543:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  80554a:	00 00 00 
+  80554d:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  80554f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805553:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805557:	89 c1                	mov    %eax,%ecx
+  805559:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80555d:	48 8b 00             	mov    (%rax),%rax
+  805560:	89 c2                	mov    %eax,%edx
+  805562:	89 c8                	mov    %ecx,%eax
+  805564:	29 d0                	sub    %edx,%eax
+  805566:	89 c2                	mov    %eax,%edx
+  805568:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80556c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  805572:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805576:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  80557d:	00 00 00 
+  stat->st_dev   = &devpipe;
+  805580:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805584:	48 b9 80 80 80 00 00 	movabs $0x808080,%rcx
+  80558b:	00 00 00 
+  80558e:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805595:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80559a:	c9                   	leave
+  80559b:	c3                   	ret
+
+000000000080559c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80559c:	55                   	push   %rbp
+  80559d:	48 89 e5             	mov    %rsp,%rbp
+  8055a0:	48 83 ec 40          	sub    $0x40,%rsp
+  8055a4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8055a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055ac:	48 89 c7             	mov    %rax,%rdi
+  8055af:	48 b8 29 36 80 00 00 	movabs $0x803629,%rax
+  8055b6:	00 00 00 
+  8055b9:	ff d0                	call   *%rax
+  8055bb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8055bf:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8055c6:	00 
+  8055c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8055cb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8055cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055d3:	48 01 d0             	add    %rdx,%rax
+  8055d6:	48 83 c0 1f          	add    $0x1f,%rax
+  8055da:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8055de:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055e7:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8055eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055ef:	48 29 d0             	sub    %rdx,%rax
+  8055f2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8055f6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8055fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8055fe:	48 89 c6             	mov    %rax,%rsi
+  805601:	bf 00 00 00 00       	mov    $0x0,%edi
+  805606:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  80560d:	00 00 00 
+  805610:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805612:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805616:	48 89 c7             	mov    %rax,%rdi
+  805619:	48 b8 e2 4f 80 00 00 	movabs $0x804fe2,%rax
+  805620:	00 00 00 
+  805623:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805625:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805629:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80562d:	eb 2f                	jmp    80565e <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  80562f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805633:	48 83 e8 01          	sub    $0x1,%rax
+  805637:	48 c1 e0 0c          	shl    $0xc,%rax
+  80563b:	48 89 c2             	mov    %rax,%rdx
+  80563e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805642:	48 01 d0             	add    %rdx,%rax
+  805645:	48 89 c6             	mov    %rax,%rsi
+  805648:	bf 00 00 00 00       	mov    $0x0,%edi
+  80564d:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  805654:	00 00 00 
+  805657:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805659:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80565e:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805663:	77 ca                	ja     80562f <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805665:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805669:	48 89 c6             	mov    %rax,%rsi
+  80566c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805671:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  805678:	00 00 00 
+  80567b:	ff d0                	call   *%rax
+}
+  80567d:	c9                   	leave
+  80567e:	c3                   	ret
+
+000000000080567f <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  80567f:	55                   	push   %rbp
+  805680:	48 89 e5             	mov    %rsp,%rbp
+  805683:	48 83 ec 10          	sub    $0x10,%rsp
+  805687:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  80568a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80568d:	be 00 00 00 00       	mov    $0x0,%esi
+  805692:	89 c7                	mov    %eax,%edi
+  805694:	48 b8 a3 56 80 00 00 	movabs $0x8056a3,%rax
+  80569b:	00 00 00 
+  80569e:	ff d0                	call   *%rax
+}
+  8056a0:	90                   	nop
+  8056a1:	c9                   	leave
+  8056a2:	c3                   	ret
+
+00000000008056a3 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  8056a3:	55                   	push   %rbp
+  8056a4:	48 89 e5             	mov    %rsp,%rbp
+  8056a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8056ab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8056ae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  8056b2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056b6:	75 3e                	jne    8056f6 <waitpid+0x53>
+  8056b8:	48 b8 f8 6f 80 00 00 	movabs $0x806ff8,%rax
+  8056bf:	00 00 00 
+  8056c2:	48 89 c1             	mov    %rax,%rcx
+  8056c5:	48 b8 03 70 80 00 00 	movabs $0x807003,%rax
+  8056cc:	00 00 00 
+  8056cf:	48 89 c2             	mov    %rax,%rdx
+  8056d2:	be 0e 00 00 00       	mov    $0xe,%esi
+  8056d7:	48 b8 18 70 80 00 00 	movabs $0x807018,%rax
+  8056de:	00 00 00 
+  8056e1:	48 89 c7             	mov    %rax,%rdi
+  8056e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056e9:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  8056f0:	00 00 00 
+  8056f3:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  8056f6:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8056fb:	74 0a                	je     805707 <waitpid+0x64>
+    *status = 0;
+  8056fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805701:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  805707:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80570b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80570e:	48 89 d6             	mov    %rdx,%rsi
+  805711:	89 c7                	mov    %eax,%edi
+  805713:	48 b8 a3 23 80 00 00 	movabs $0x8023a3,%rax
+  80571a:	00 00 00 
+  80571d:	ff d0                	call   *%rax
+}
+  80571f:	c9                   	leave
+  805720:	c3                   	ret
+
+0000000000805721 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  805721:	55                   	push   %rbp
+  805722:	48 89 e5             	mov    %rsp,%rbp
+  805725:	48 83 ec 10          	sub    $0x10,%rsp
+  805729:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80572d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  805731:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805735:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805739:	48 89 c7             	mov    %rax,%rdi
+  80573c:	ff d2                	call   *%rdx
+  thread_exit(0);
+  80573e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805743:	48 b8 85 59 80 00 00 	movabs $0x805985,%rax
+  80574a:	00 00 00 
+  80574d:	ff d0                	call   *%rax
+}
+  80574f:	90                   	nop
+  805750:	c9                   	leave
+  805751:	c3                   	ret
+
+0000000000805752 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  805752:	55                   	push   %rbp
+  805753:	48 89 e5             	mov    %rsp,%rbp
+  805756:	48 83 ec 20          	sub    $0x20,%rsp
+  80575a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  80575d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805760:	c1 e0 10             	shl    $0x10,%eax
+  805763:	48 98                	cltq
+  805765:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  80576a:	48 01 d0             	add    %rdx,%rax
+  80576d:	48 89 c6             	mov    %rax,%rsi
+  805770:	bf 00 00 00 00       	mov    $0x0,%edi
+  805775:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  80577c:	00 00 00 
+  80577f:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805781:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805784:	83 c0 01             	add    $0x1,%eax
+  805787:	c1 e0 10             	shl    $0x10,%eax
+  80578a:	48 98                	cltq
+  80578c:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805791:	48 01 d0             	add    %rdx,%rax
+  805794:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805798:	eb 20                	jmp    8057ba <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  80579a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80579e:	48 89 c6             	mov    %rax,%rsi
+  8057a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057a6:	48 b8 5c 25 80 00 00 	movabs $0x80255c,%rax
+  8057ad:	00 00 00 
+  8057b0:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8057b2:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8057b9:	00 
+  8057ba:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057bd:	83 c0 01             	add    $0x1,%eax
+  8057c0:	c1 e0 10             	shl    $0x10,%eax
+  8057c3:	48 98                	cltq
+  8057c5:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8057ca:	48 01 d0             	add    %rdx,%rax
+  8057cd:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8057d1:	72 c7                	jb     80579a <slot_unmap+0x48>
+}
+  8057d3:	90                   	nop
+  8057d4:	90                   	nop
+  8057d5:	c9                   	leave
+  8057d6:	c3                   	ret
+
+00000000008057d7 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  8057d7:	55                   	push   %rbp
+  8057d8:	48 89 e5             	mov    %rsp,%rbp
+  8057db:	48 83 ec 30          	sub    $0x30,%rsp
+  8057df:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8057e3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  8057e7:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8057ee:	00 00 00 
+  8057f1:	48 89 c7             	mov    %rax,%rdi
+  8057f4:	48 b8 77 62 80 00 00 	movabs $0x806277,%rax
+  8057fb:	00 00 00 
+  8057fe:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  805800:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805807:	eb 04                	jmp    80580d <thread_create+0x36>
+  805809:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80580d:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  805811:	7f 16                	jg     805829 <thread_create+0x52>
+  805813:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  80581a:	00 00 00 
+  80581d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805820:	48 98                	cltq
+  805822:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805825:	85 c0                	test   %eax,%eax
+  805827:	75 e0                	jne    805809 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  805829:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  80582d:	75 0c                	jne    80583b <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  80582f:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  805836:	e9 2c 01 00 00       	jmp    805967 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  80583b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80583e:	c1 e0 10             	shl    $0x10,%eax
+  805841:	48 98                	cltq
+  805843:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805848:	48 01 d0             	add    %rdx,%rax
+  80584b:	ba 07 00 00 00       	mov    $0x7,%edx
+  805850:	48 89 c6             	mov    %rax,%rsi
+  805853:	bf 00 00 00 00       	mov    $0x0,%edi
+  805858:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  80585f:	00 00 00 
+  805862:	ff d0                	call   *%rax
+  805864:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805867:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80586b:	0f 88 f5 00 00 00    	js     805966 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805871:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805874:	83 c0 01             	add    $0x1,%eax
+  805877:	c1 e0 10             	shl    $0x10,%eax
+  80587a:	48 98                	cltq
+  80587c:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805881:	48 01 d0             	add    %rdx,%rax
+  805884:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805888:	eb 32                	jmp    8058bc <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  80588a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80588e:	ba 07 00 00 00       	mov    $0x7,%edx
+  805893:	48 89 c6             	mov    %rax,%rsi
+  805896:	bf 00 00 00 00       	mov    $0x0,%edi
+  80589b:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  8058a2:	00 00 00 
+  8058a5:	ff d0                	call   *%rax
+  8058a7:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8058aa:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8058ae:	0f 88 9e 00 00 00    	js     805952 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8058b4:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8058bb:	00 
+  8058bc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8058bf:	83 c0 01             	add    $0x1,%eax
+  8058c2:	c1 e0 10             	shl    $0x10,%eax
+  8058c5:	48 98                	cltq
+  8058c7:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8058cc:	48 01 d0             	add    %rdx,%rax
+  8058cf:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8058d3:	72 b5                	jb     80588a <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  8058d5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8058d9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  8058dd:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8058e0:	c1 e2 10             	shl    $0x10,%edx
+  8058e3:	48 63 d2             	movslq %edx,%rdx
+  8058e6:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  8058eb:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  8058ee:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  8058f1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8058f4:	83 c2 01             	add    $0x1,%edx
+  8058f7:	c1 e2 10             	shl    $0x10,%edx
+  8058fa:	48 63 d2             	movslq %edx,%rdx
+  8058fd:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  805902:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  805905:	48 bf 21 57 80 00 00 	movabs $0x805721,%rdi
+  80590c:	00 00 00 
+  80590f:	49 89 c8             	mov    %rcx,%r8
+  805912:	48 89 c1             	mov    %rax,%rcx
+  805915:	4c 89 ca             	mov    %r9,%rdx
+  805918:	48 b8 44 29 80 00 00 	movabs $0x802944,%rax
+  80591f:	00 00 00 
+  805922:	ff d0                	call   *%rax
+  805924:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  805927:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80592b:	79 08                	jns    805935 <thread_create+0x15e>
+    r = id;
+  80592d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805930:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  805933:	eb 1e                	jmp    805953 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  805935:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805938:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  80593b:	48 b9 40 a0 80 00 00 	movabs $0x80a040,%rcx
+  805942:	00 00 00 
+  805945:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805948:	48 98                	cltq
+  80594a:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80594d:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  805950:	eb 15                	jmp    805967 <thread_create+0x190>
+      goto fail;
+  805952:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  805953:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805956:	89 c7                	mov    %eax,%edi
+  805958:	48 b8 52 57 80 00 00 	movabs $0x805752,%rax
+  80595f:	00 00 00 
+  805962:	ff d0                	call   *%rax
+  805964:	eb 01                	jmp    805967 <thread_create+0x190>
+    goto out;
+  805966:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  805967:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80596e:	00 00 00 
+  805971:	48 89 c7             	mov    %rax,%rdi
+  805974:	48 b8 4c 63 80 00 00 	movabs $0x80634c,%rax
+  80597b:	00 00 00 
+  80597e:	ff d0                	call   *%rax
+  return r;
+  805980:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805983:	c9                   	leave
+  805984:	c3                   	ret
+
+0000000000805985 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  805985:	55                   	push   %rbp
+  805986:	48 89 e5             	mov    %rsp,%rbp
+  805989:	48 83 ec 10          	sub    $0x10,%rsp
+  80598d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805990:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805993:	89 c7                	mov    %eax,%edi
+  805995:	48 b8 a1 29 80 00 00 	movabs $0x8029a1,%rax
+  80599c:	00 00 00 
+  80599f:	ff d0                	call   *%rax
+}
+  8059a1:	90                   	nop
+  8059a2:	c9                   	leave
+  8059a3:	c3                   	ret
+
+00000000008059a4 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  8059a4:	55                   	push   %rbp
+  8059a5:	48 89 e5             	mov    %rsp,%rbp
+  8059a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8059ac:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8059af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  8059b3:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8059ba:	00 00 00 
+  8059bd:	48 89 c7             	mov    %rax,%rdi
+  8059c0:	48 b8 77 62 80 00 00 	movabs $0x806277,%rax
+  8059c7:	00 00 00 
+  8059ca:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  8059cc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8059d3:	eb 04                	jmp    8059d9 <thread_join+0x35>
+  8059d5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8059d9:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  8059dd:	7f 17                	jg     8059f6 <thread_join+0x52>
+  8059df:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  8059e6:	00 00 00 
+  8059e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059ec:	48 98                	cltq
+  8059ee:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8059f1:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8059f4:	75 df                	jne    8059d5 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  8059f6:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8059fd:	00 00 00 
+  805a00:	48 89 c7             	mov    %rax,%rdi
+  805a03:	48 b8 4c 63 80 00 00 	movabs $0x80634c,%rax
+  805a0a:	00 00 00 
+  805a0d:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  805a0f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805a13:	74 06                	je     805a1b <thread_join+0x77>
+  805a15:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  805a19:	75 07                	jne    805a22 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  805a1b:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805a20:	eb 76                	jmp    805a98 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  805a22:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a26:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805a29:	48 89 d6             	mov    %rdx,%rsi
+  805a2c:	89 c7                	mov    %eax,%edi
+  805a2e:	48 b8 a3 56 80 00 00 	movabs $0x8056a3,%rax
+  805a35:	00 00 00 
+  805a38:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  805a3a:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805a41:	00 00 00 
+  805a44:	48 89 c7             	mov    %rax,%rdi
+  805a47:	48 b8 77 62 80 00 00 	movabs $0x806277,%rax
+  805a4e:	00 00 00 
+  805a51:	ff d0                	call   *%rax
+  slot_unmap(i);
+  805a53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a56:	89 c7                	mov    %eax,%edi
+  805a58:	48 b8 52 57 80 00 00 	movabs $0x805752,%rax
+  805a5f:	00 00 00 
+  805a62:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  805a64:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  805a6b:	00 00 00 
+  805a6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a71:	48 98                	cltq
+  805a73:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805a7a:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805a81:	00 00 00 
+  805a84:	48 89 c7             	mov    %rax,%rdi
+  805a87:	48 b8 4c 63 80 00 00 	movabs $0x80634c,%rax
+  805a8e:	00 00 00 
+  805a91:	ff d0                	call   *%rax
+  return 0;
+  805a93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a98:	c9                   	leave
+  805a99:	c3                   	ret
+
+0000000000805a9a <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805a9a:	55                   	push   %rbp
+  805a9b:	48 89 e5             	mov    %rsp,%rbp
+  805a9e:	48 83 ec 08          	sub    $0x8,%rsp
+  805aa2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805aa6:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805aab:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805aaf:	73 23                	jae    805ad4 <thread_is_uxstack+0x3a>
+  805ab1:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805ab6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805aba:	72 18                	jb     805ad4 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805abc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ac0:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805ac5:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805acb:	75 07                	jne    805ad4 <thread_is_uxstack+0x3a>
+  805acd:	b8 01 00 00 00       	mov    $0x1,%eax
+  805ad2:	eb 05                	jmp    805ad9 <thread_is_uxstack+0x3f>
+  805ad4:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ad9:	83 e0 01             	and    $0x1,%eax
+}
+  805adc:	c9                   	leave
+  805add:	c3                   	ret
+
+0000000000805ade <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805ade:	55                   	push   %rbp
+  805adf:	48 89 e5             	mov    %rsp,%rbp
+  805ae2:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805ae6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805aed:	00 00 00 
+  805af0:	8b 40 04             	mov    0x4(%rax),%eax
+  805af3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805af8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805aff:	00 00 00 
+  805b02:	48 98                	cltq
+  805b04:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805b0b:	48 01 d0             	add    %rdx,%rax
+  805b0e:	48 05 08 01 00 00    	add    $0x108,%rax
+  805b14:	48 8b 00             	mov    (%rax),%rax
+  805b17:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  805b1b:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805b20:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805b24:	73 0b                	jae    805b31 <thread_pftemp+0x53>
+  805b26:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805b2b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805b2f:	73 07                	jae    805b38 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  805b31:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  805b36:	eb 26                	jmp    805b5e <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  805b38:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  805b3f:	ff ff ff 
+  805b42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b46:	48 01 d0             	add    %rdx,%rax
+  805b49:	48 c1 e8 10          	shr    $0x10,%rax
+  805b4d:	48 83 c0 01          	add    $0x1,%rax
+  805b51:	48 c1 e0 0c          	shl    $0xc,%rax
+  805b55:	48 f7 d8             	neg    %rax
+  805b58:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  805b5e:	c9                   	leave
+  805b5f:	c3                   	ret
+
+0000000000805b60 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805b60:	55                   	push   %rbp
+  805b61:	48 89 e5             	mov    %rsp,%rbp
+  805b64:	48 83 ec 08          	sub    $0x8,%rsp
+  805b68:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805b6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b6f:	75 10                	jne    805b81 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805b71:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b78:	00 00 00 
+  805b7b:	8b 00                	mov    (%rax),%eax
+  805b7d:	48 98                	cltq
+  805b7f:	eb 05                	jmp    805b86 <vsyscall+0x26>
+  }
+  return 0;
+  805b81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b86:	c9                   	leave
+  805b87:	c3                   	ret
+
+0000000000805b88 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805b88:	55                   	push   %rbp
+  805b89:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805b8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b91:	48 b8 60 5b 80 00 00 	movabs $0x805b60,%rax
+  805b98:	00 00 00 
+  805b9b:	ff d0                	call   *%rax
+}
+  805b9d:	5d                   	pop    %rbp
+  805b9e:	c3                   	ret
+
+0000000000805b9f <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805b9f:	55                   	push   %rbp
+  805ba0:	48 89 e5             	mov    %rsp,%rbp
+  805ba3:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805ba7:	0f 31                	rdtsc
+  805ba9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805bac:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805baf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bb2:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805bb5:	48 c1 e2 20          	shl    $0x20,%rdx
+  805bb9:	48 09 d0             	or     %rdx,%rax
+  805bbc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805bc0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805bc4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805bc8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805bcf:	00 00 00 
+  805bd2:	8b 40 08             	mov    0x8(%rax),%eax
+  805bd5:	48 98                	cltq
+  805bd7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805bdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805bdf:	ba 00 00 00 00       	mov    $0x0,%edx
+  805be4:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805be8:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805bef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805bf3:	ba 00 00 00 00       	mov    $0x0,%edx
+  805bf8:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805bfc:	48 89 d0             	mov    %rdx,%rax
+  805bff:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805c06:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c0b:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805c0f:	48 01 c8             	add    %rcx,%rax
+}
+  805c12:	c9                   	leave
+  805c13:	c3                   	ret
+
+0000000000805c14 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805c14:	55                   	push   %rbp
+  805c15:	48 89 e5             	mov    %rsp,%rbp
+  805c18:	48 83 ec 20          	sub    $0x20,%rsp
+  805c1c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805c1f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c22:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805c25:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805c29:	be 01 00 00 00       	mov    $0x1,%esi
+  805c2e:	48 89 c7             	mov    %rax,%rdi
+  805c31:	48 b8 8d 22 80 00 00 	movabs $0x80228d,%rax
+  805c38:	00 00 00 
+  805c3b:	ff d0                	call   *%rax
+}
+  805c3d:	90                   	nop
+  805c3e:	c9                   	leave
+  805c3f:	c3                   	ret
+
+0000000000805c40 <getchar>:
+
+int
+getchar(void) {
+  805c40:	55                   	push   %rbp
+  805c41:	48 89 e5             	mov    %rsp,%rbp
+  805c44:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805c48:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805c4c:	ba 01 00 00 00       	mov    $0x1,%edx
+  805c51:	48 89 c6             	mov    %rax,%rsi
+  805c54:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c59:	48 b8 92 3c 80 00 00 	movabs $0x803c92,%rax
+  805c60:	00 00 00 
+  805c63:	ff d0                	call   *%rax
+  805c65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805c68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c6c:	79 05                	jns    805c73 <getchar+0x33>
+    return r;
+  805c6e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c71:	eb 14                	jmp    805c87 <getchar+0x47>
+  if (r < 1)
+  805c73:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c77:	7f 07                	jg     805c80 <getchar+0x40>
+    return -E_EOF;
+  805c79:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805c7e:	eb 07                	jmp    805c87 <getchar+0x47>
+  return c;
+  805c80:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805c84:	0f b6 c0             	movzbl %al,%eax
+}
+  805c87:	c9                   	leave
+  805c88:	c3                   	ret
+
+0000000000805c89 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805c89:	55                   	push   %rbp
+  805c8a:	48 89 e5             	mov    %rsp,%rbp
+  805c8d:	48 83 ec 20          	sub    $0x20,%rsp
+  805c91:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805c94:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805c98:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c9b:	48 89 d6             	mov    %rdx,%rsi
+  805c9e:	89 c7                	mov    %eax,%edi
+  805ca0:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  805ca7:	00 00 00 
+  805caa:	ff d0                	call   *%rax
+  805cac:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805caf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805cb3:	79 05                	jns    805cba <iscons+0x31>
+    return r;
+  805cb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805cb8:	eb 1a                	jmp    805cd4 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805cba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805cbe:	8b 10                	mov    (%rax),%edx
+  805cc0:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  805cc7:	00 00 00 
+  805cca:	8b 00                	mov    (%rax),%eax
+  805ccc:	39 c2                	cmp    %eax,%edx
+  805cce:	0f 94 c0             	sete   %al
+  805cd1:	0f b6 c0             	movzbl %al,%eax
+}
+  805cd4:	c9                   	leave
+  805cd5:	c3                   	ret
+
+0000000000805cd6 <opencons>:
+
+int
+opencons(void) {
+  805cd6:	55                   	push   %rbp
+  805cd7:	48 89 e5             	mov    %rsp,%rbp
+  805cda:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805cde:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805ce2:	48 89 c7             	mov    %rax,%rdi
+  805ce5:	48 b8 54 36 80 00 00 	movabs $0x803654,%rax
+  805cec:	00 00 00 
+  805cef:	ff d0                	call   *%rax
+  805cf1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805cf4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805cf8:	79 05                	jns    805cff <opencons+0x29>
+    return r;
+  805cfa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805cfd:	eb 66                	jmp    805d65 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805cff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d03:	ba 07 04 00 00       	mov    $0x407,%edx
+  805d08:	48 89 c6             	mov    %rax,%rsi
+  805d0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d10:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  805d17:	00 00 00 
+  805d1a:	ff d0                	call   *%rax
+  805d1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805d1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d23:	79 05                	jns    805d2a <opencons+0x54>
+    return r;
+  805d25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d28:	eb 3b                	jmp    805d65 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805d2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d2e:	48 ba c0 80 80 00 00 	movabs $0x8080c0,%rdx
+  805d35:	00 00 00 
+  805d38:	8b 12                	mov    (%rdx),%edx
+  805d3a:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805d3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d40:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805d47:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d4b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805d52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d56:	48 89 c7             	mov    %rax,%rdi
+  805d59:	48 b8 06 36 80 00 00 	movabs $0x803606,%rax
+  805d60:	00 00 00 
+  805d63:	ff d0                	call   *%rax
+}
+  805d65:	c9                   	leave
+  805d66:	c3                   	ret
+
+0000000000805d67 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805d67:	55                   	push   %rbp
+  805d68:	48 89 e5             	mov    %rsp,%rbp
+  805d6b:	48 83 ec 20          	sub    $0x20,%rsp
+  805d6f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805d72:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805d75:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805d79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d7c:	48 89 d6             	mov    %rdx,%rsi
+  805d7f:	89 c7                	mov    %eax,%edi
+  805d81:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  805d88:	00 00 00 
+  805d8b:	ff d0                	call   *%rax
+  805d8d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805d90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d94:	79 05                	jns    805d9b <consmode+0x34>
+    return r;
+  805d96:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d99:	eb 34                	jmp    805dcf <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805d9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d9f:	8b 10                	mov    (%rax),%edx
+  805da1:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  805da8:	00 00 00 
+  805dab:	8b 00                	mov    (%rax),%eax
+  805dad:	39 c2                	cmp    %eax,%edx
+  805daf:	74 07                	je     805db8 <consmode+0x51>
+    return -E_INVAL;
+  805db1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805db6:	eb 17                	jmp    805dcf <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805db8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805dbc:	8b 40 0c             	mov    0xc(%rax),%eax
+  805dbf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805dc2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805dc6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805dc9:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805dcc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805dcf:	c9                   	leave
+  805dd0:	c3                   	ret
+
+0000000000805dd1 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805dd1:	55                   	push   %rbp
+  805dd2:	48 89 e5             	mov    %rsp,%rbp
+  805dd5:	48 83 ec 20          	sub    $0x20,%rsp
+  805dd9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805ddd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805de1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805de5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805de9:	8b 50 0c             	mov    0xc(%rax),%edx
+  805dec:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805df0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805df4:	48 89 ce             	mov    %rcx,%rsi
+  805df7:	48 89 c7             	mov    %rax,%rdi
+  805dfa:	48 b8 fe 27 80 00 00 	movabs $0x8027fe,%rax
+  805e01:	00 00 00 
+  805e04:	ff d0                	call   *%rax
+  805e06:	48 98                	cltq
+}
+  805e08:	c9                   	leave
+  805e09:	c3                   	ret
+
+0000000000805e0a <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805e0a:	55                   	push   %rbp
+  805e0b:	48 89 e5             	mov    %rsp,%rbp
+  805e0e:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805e15:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805e1c:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805e23:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805e2a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805e31:	eb 74                	jmp    805ea7 <devcons_write+0x9d>
+    m = n - tot;
+  805e33:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805e3a:	89 c2                	mov    %eax,%edx
+  805e3c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e3f:	29 c2                	sub    %eax,%edx
+  805e41:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805e44:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805e47:	83 f8 7f             	cmp    $0x7f,%eax
+  805e4a:	76 07                	jbe    805e53 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805e4c:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805e53:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805e56:	48 63 d0             	movslq %eax,%rdx
+  805e59:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e5c:	48 63 c8             	movslq %eax,%rcx
+  805e5f:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805e66:	48 01 c1             	add    %rax,%rcx
+  805e69:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805e70:	48 89 ce             	mov    %rcx,%rsi
+  805e73:	48 89 c7             	mov    %rax,%rdi
+  805e76:	48 b8 19 1c 80 00 00 	movabs $0x801c19,%rax
+  805e7d:	00 00 00 
+  805e80:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  805e82:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805e85:	48 63 d0             	movslq %eax,%rdx
+  805e88:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805e8f:	48 89 d6             	mov    %rdx,%rsi
+  805e92:	48 89 c7             	mov    %rax,%rdi
+  805e95:	48 b8 8d 22 80 00 00 	movabs $0x80228d,%rax
+  805e9c:	00 00 00 
+  805e9f:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805ea1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805ea4:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805ea7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805eaa:	48 98                	cltq
+  805eac:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805eb3:	0f 82 7a ff ff ff    	jb     805e33 <devcons_write+0x29>
+  }
+  return tot;
+  805eb9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ebc:	48 98                	cltq
+}
+  805ebe:	c9                   	leave
+  805ebf:	c3                   	ret
+
+0000000000805ec0 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805ec0:	55                   	push   %rbp
+  805ec1:	48 89 e5             	mov    %rsp,%rbp
+  805ec4:	48 83 ec 08          	sub    $0x8,%rsp
+  805ec8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805ed1:	c9                   	leave
+  805ed2:	c3                   	ret
+
+0000000000805ed3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805ed3:	55                   	push   %rbp
+  805ed4:	48 89 e5             	mov    %rsp,%rbp
+  805ed7:	48 83 ec 10          	sub    $0x10,%rsp
+  805edb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805edf:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805ee3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ee7:	48 ba 28 70 80 00 00 	movabs $0x807028,%rdx
+  805eee:	00 00 00 
+  805ef1:	48 89 d6             	mov    %rdx,%rsi
+  805ef4:	48 89 c7             	mov    %rax,%rdi
+  805ef7:	48 b8 d6 16 80 00 00 	movabs $0x8016d6,%rax
+  805efe:	00 00 00 
+  805f01:	ff d0                	call   *%rax
+  return 0;
+  805f03:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f08:	c9                   	leave
+  805f09:	c3                   	ret
+
+0000000000805f0a <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805f0a:	55                   	push   %rbp
+  805f0b:	48 89 e5             	mov    %rsp,%rbp
+  805f0e:	48 83 ec 30          	sub    $0x30,%rsp
+  805f12:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805f16:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805f19:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805f1d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805f24:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f27:	83 e0 02             	and    $0x2,%eax
+  805f2a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805f2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f31:	8b 40 0c             	mov    0xc(%rax),%eax
+  805f34:	83 f8 01             	cmp    $0x1,%eax
+  805f37:	75 04                	jne    805f3d <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805f39:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805f3d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805f40:	83 e0 01             	and    $0x1,%eax
+  805f43:	85 c0                	test   %eax,%eax
+  805f45:	74 44                	je     805f8b <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805f47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805f4f:	89 c2                	mov    %eax,%edx
+  805f51:	be 00 00 00 00       	mov    $0x0,%esi
+  805f56:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f5b:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  805f62:	00 00 00 
+  805f65:	ff d0                	call   *%rax
+  805f67:	83 f8 01             	cmp    $0x1,%eax
+  805f6a:	75 06                	jne    805f72 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805f6c:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805f70:	eb 19                	jmp    805f8b <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805f72:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f76:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805f7c:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805f7f:	89 c2                	mov    %eax,%edx
+  805f81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f85:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805f8b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805f8e:	c9                   	leave
+  805f8f:	c3                   	ret
+
+0000000000805f90 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  805f90:	55                   	push   %rbp
+  805f91:	48 89 e5             	mov    %rsp,%rbp
+  805f94:	48 83 ec 20          	sub    $0x20,%rsp
+  805f98:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  805f9c:	48 b8 2b 24 80 00 00 	movabs $0x80242b,%rax
+  805fa3:	00 00 00 
+  805fa6:	ff d0                	call   *%rax
+  805fa8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  805fab:	48 b8 40 a1 80 00 00 	movabs $0x80a140,%rax
+  805fb2:	00 00 00 
+  805fb5:	48 8b 00             	mov    (%rax),%rax
+  805fb8:	48 85 c0             	test   %rax,%rax
+  805fbb:	75 62                	jne    80601f <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  805fbd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fc0:	ba 07 00 00 00       	mov    $0x7,%edx
+  805fc5:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  805fcc:	00 00 00 
+  805fcf:	48 89 ce             	mov    %rcx,%rsi
+  805fd2:	89 c7                	mov    %eax,%edi
+  805fd4:	48 b8 a4 24 80 00 00 	movabs $0x8024a4,%rax
+  805fdb:	00 00 00 
+  805fde:	ff d0                	call   *%rax
+  805fe0:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  805fe3:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805fe7:	79 36                	jns    80601f <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  805fe9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805fec:	89 c1                	mov    %eax,%ecx
+  805fee:	48 b8 2f 70 80 00 00 	movabs $0x80702f,%rax
+  805ff5:	00 00 00 
+  805ff8:	48 89 c2             	mov    %rax,%rdx
+  805ffb:	be 23 00 00 00       	mov    $0x23,%esi
+  806000:	48 b8 47 70 80 00 00 	movabs $0x807047,%rax
+  806007:	00 00 00 
+  80600a:	48 89 c7             	mov    %rax,%rdi
+  80600d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806012:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  806019:	00 00 00 
+  80601c:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80601f:	48 ba 40 a1 80 00 00 	movabs $0x80a140,%rdx
+  806026:	00 00 00 
+  806029:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80602d:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  806030:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806033:	48 ba 90 60 80 00 00 	movabs $0x806090,%rdx
+  80603a:	00 00 00 
+  80603d:	48 89 d6             	mov    %rdx,%rsi
+  806040:	89 c7                	mov    %eax,%edi
+  806042:	48 b8 41 26 80 00 00 	movabs $0x802641,%rax
+  806049:	00 00 00 
+  80604c:	ff d0                	call   *%rax
+  80604e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  806051:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806055:	79 36                	jns    80608d <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  806057:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80605a:	89 c1                	mov    %eax,%ecx
+  80605c:	48 b8 2f 70 80 00 00 	movabs $0x80702f,%rax
+  806063:	00 00 00 
+  806066:	48 89 c2             	mov    %rax,%rdx
+  806069:	be 2b 00 00 00       	mov    $0x2b,%esi
+  80606e:	48 b8 47 70 80 00 00 	movabs $0x807047,%rax
+  806075:	00 00 00 
+  806078:	48 89 c7             	mov    %rax,%rdi
+  80607b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806080:	49 b8 07 05 80 00 00 	movabs $0x800507,%r8
+  806087:	00 00 00 
+  80608a:	41 ff d0             	call   *%r8
+}
+  80608d:	90                   	nop
+  80608e:	c9                   	leave
+  80608f:	c3                   	ret
+
+0000000000806090 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  806090:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  806093:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  806096:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  80609d:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  8060a1:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  8060a6:	48 a1 40 a1 80 00 00 	movabs 0x80a140,%rax
+  8060ad:	00 00 00 
+	call *%rax
+  8060b0:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  8060b2:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  8060b7:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  8060ba:	41 5f                	pop    %r15
+	popq %r15
+  8060bc:	41 5f                	pop    %r15
+	popq %r15
+  8060be:	41 5f                	pop    %r15
+	popq %r14
+  8060c0:	41 5e                	pop    %r14
+	popq %r13
+  8060c2:	41 5d                	pop    %r13
+	popq %r12
+  8060c4:	41 5c                	pop    %r12
+	popq %r11
+  8060c6:	41 5b                	pop    %r11
+	popq %r10
+  8060c8:	41 5a                	pop    %r10
+	popq %r9
+  8060ca:	41 59                	pop    %r9
+	popq %r8
+  8060cc:	41 58                	pop    %r8
+	popq %rsi
+  8060ce:	5e                   	pop    %rsi
+	popq %rdi
+  8060cf:	5f                   	pop    %rdi
+	popq %rbp
+  8060d0:	5d                   	pop    %rbp
+	popq %rdx
+  8060d1:	5a                   	pop    %rdx
+	popq %rcx
+  8060d2:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  8060d3:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8060d8:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8060dd:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8060e1:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8060e4:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  8060e9:	5b                   	pop    %rbx
+	popq %rax
+  8060ea:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  8060eb:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8060ef:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  8060f0:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  8060f5:	c3                   	ret
+
+00000000008060f6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  8060f6:	55                   	push   %rbp
+  8060f7:	48 89 e5             	mov    %rsp,%rbp
+  8060fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8060fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806102:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806106:	48 c1 e8 27          	shr    $0x27,%rax
+  80610a:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80610f:	48 89 c2             	mov    %rax,%rdx
+  806112:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  806119:	01 00 00 
+  80611c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806120:	83 e0 01             	and    $0x1,%eax
+  806123:	48 85 c0             	test   %rax,%rax
+  806126:	74 63                	je     80618b <pageref+0x95>
+  806128:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80612c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  806130:	48 89 c2             	mov    %rax,%rdx
+  806133:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80613a:	01 00 00 
+  80613d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806141:	83 e0 01             	and    $0x1,%eax
+  806144:	48 85 c0             	test   %rax,%rax
+  806147:	74 42                	je     80618b <pageref+0x95>
+  806149:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80614d:	48 c1 e8 15          	shr    $0x15,%rax
+  806151:	48 89 c2             	mov    %rax,%rdx
+  806154:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80615b:	01 00 00 
+  80615e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806162:	83 e0 01             	and    $0x1,%eax
+  806165:	48 85 c0             	test   %rax,%rax
+  806168:	74 21                	je     80618b <pageref+0x95>
+  80616a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80616e:	48 c1 e8 0c          	shr    $0xc,%rax
+  806172:	48 89 c2             	mov    %rax,%rdx
+  806175:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80617c:	01 00 00 
+  80617f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806183:	83 e0 01             	and    $0x1,%eax
+  806186:	48 85 c0             	test   %rax,%rax
+  806189:	75 07                	jne    806192 <pageref+0x9c>
+    return 0;
+  80618b:	b8 00 00 00 00       	mov    $0x0,%eax
+  806190:	eb 53                	jmp    8061e5 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  806192:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806196:	48 c1 e8 0c          	shr    $0xc,%rax
+  80619a:	48 89 c2             	mov    %rax,%rdx
+  80619d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8061a4:	01 00 00 
+  8061a7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8061ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8061af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061b3:	83 e0 01             	and    $0x1,%eax
+  8061b6:	48 85 c0             	test   %rax,%rax
+  8061b9:	75 07                	jne    8061c2 <pageref+0xcc>
+    return 0;
+  8061bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8061c0:	eb 23                	jmp    8061e5 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8061c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8061c6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8061ca:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8061d1:	00 00 00 
+  8061d4:	48 c1 e0 04          	shl    $0x4,%rax
+  8061d8:	48 01 d0             	add    %rdx,%rax
+  8061db:	48 83 c0 08          	add    $0x8,%rax
+  8061df:	0f b7 00             	movzwl (%rax),%eax
+  8061e2:	0f b7 c0             	movzwl %ax,%eax
+}
+  8061e5:	c9                   	leave
+  8061e6:	c3                   	ret
+
+00000000008061e7 <xchg>:
+  8061e7:	55                   	push   %rbp
+  8061e8:	48 89 e5             	mov    %rsp,%rbp
+  8061eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8061ef:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8061f3:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8061f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8061fa:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8061fd:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806201:	f0 87 02             	lock xchg %eax,(%rdx)
+  806204:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806207:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80620a:	c9                   	leave
+  80620b:	c3                   	ret
+
+000000000080620c <cmpxchg>:
+  80620c:	55                   	push   %rbp
+  80620d:	48 89 e5             	mov    %rsp,%rbp
+  806210:	48 83 ec 20          	sub    $0x20,%rsp
+  806214:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806218:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80621b:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  80621e:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  806222:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  806225:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806228:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80622c:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  806230:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806233:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806236:	c9                   	leave
+  806237:	c3                   	ret
+
+0000000000806238 <xadd>:
+  806238:	55                   	push   %rbp
+  806239:	48 89 e5             	mov    %rsp,%rbp
+  80623c:	48 83 ec 10          	sub    $0x10,%rsp
+  806240:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806244:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  806247:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80624b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80624e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806252:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  806256:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  806259:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80625c:	c9                   	leave
+  80625d:	c3                   	ret
+
+000000000080625e <mutex_init>:
+mutex_init(struct Mutex *m) {
+  80625e:	55                   	push   %rbp
+  80625f:	48 89 e5             	mov    %rsp,%rbp
+  806262:	48 83 ec 08          	sub    $0x8,%rsp
+  806266:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  80626a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80626e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  806274:	90                   	nop
+  806275:	c9                   	leave
+  806276:	c3                   	ret
+
+0000000000806277 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  806277:	55                   	push   %rbp
+  806278:	48 89 e5             	mov    %rsp,%rbp
+  80627b:	48 83 ec 20          	sub    $0x20,%rsp
+  80627f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  806283:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806287:	ba 01 00 00 00       	mov    $0x1,%edx
+  80628c:	be 00 00 00 00       	mov    $0x0,%esi
+  806291:	48 89 c7             	mov    %rax,%rdi
+  806294:	48 b8 0c 62 80 00 00 	movabs $0x80620c,%rax
+  80629b:	00 00 00 
+  80629e:	ff d0                	call   *%rax
+  8062a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8062a3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8062a7:	74 65                	je     80630e <mutex_lock+0x97>
+  if (c != 2)
+  8062a9:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  8062ad:	74 57                	je     806306 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  8062af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062b3:	be 02 00 00 00       	mov    $0x2,%esi
+  8062b8:	48 89 c7             	mov    %rax,%rdi
+  8062bb:	48 b8 e7 61 80 00 00 	movabs $0x8061e7,%rax
+  8062c2:	00 00 00 
+  8062c5:	ff d0                	call   *%rax
+  8062c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8062ca:	eb 3a                	jmp    806306 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8062cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062d0:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8062d7:	be 02 00 00 00       	mov    $0x2,%esi
+  8062dc:	48 89 c7             	mov    %rax,%rdi
+  8062df:	48 b8 50 28 80 00 00 	movabs $0x802850,%rax
+  8062e6:	00 00 00 
+  8062e9:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8062eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062ef:	be 02 00 00 00       	mov    $0x2,%esi
+  8062f4:	48 89 c7             	mov    %rax,%rdi
+  8062f7:	48 b8 e7 61 80 00 00 	movabs $0x8061e7,%rax
+  8062fe:	00 00 00 
+  806301:	ff d0                	call   *%rax
+  806303:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806306:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80630a:	75 c0                	jne    8062cc <mutex_lock+0x55>
+  80630c:	eb 01                	jmp    80630f <mutex_lock+0x98>
+    return;
+  80630e:	90                   	nop
+}
+  80630f:	c9                   	leave
+  806310:	c3                   	ret
+
+0000000000806311 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  806311:	55                   	push   %rbp
+  806312:	48 89 e5             	mov    %rsp,%rbp
+  806315:	48 83 ec 08          	sub    $0x8,%rsp
+  806319:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  80631d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806321:	ba 01 00 00 00       	mov    $0x1,%edx
+  806326:	be 00 00 00 00       	mov    $0x0,%esi
+  80632b:	48 89 c7             	mov    %rax,%rdi
+  80632e:	48 b8 0c 62 80 00 00 	movabs $0x80620c,%rax
+  806335:	00 00 00 
+  806338:	ff d0                	call   *%rax
+  80633a:	85 c0                	test   %eax,%eax
+  80633c:	75 07                	jne    806345 <mutex_trylock+0x34>
+  80633e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806343:	eb 05                	jmp    80634a <mutex_trylock+0x39>
+  806345:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80634a:	c9                   	leave
+  80634b:	c3                   	ret
+
+000000000080634c <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  80634c:	55                   	push   %rbp
+  80634d:	48 89 e5             	mov    %rsp,%rbp
+  806350:	48 83 ec 10          	sub    $0x10,%rsp
+  806354:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  806358:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80635c:	be 00 00 00 00       	mov    $0x0,%esi
+  806361:	48 89 c7             	mov    %rax,%rdi
+  806364:	48 b8 e7 61 80 00 00 	movabs $0x8061e7,%rax
+  80636b:	00 00 00 
+  80636e:	ff d0                	call   *%rax
+  806370:	83 f8 02             	cmp    $0x2,%eax
+  806373:	75 18                	jne    80638d <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806375:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806379:	be 01 00 00 00       	mov    $0x1,%esi
+  80637e:	48 89 c7             	mov    %rax,%rdi
+  806381:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  806388:	00 00 00 
+  80638b:	ff d0                	call   *%rax
+}
+  80638d:	90                   	nop
+  80638e:	c9                   	leave
+  80638f:	c3                   	ret
+
+0000000000806390 <cond_init>:
+cond_init(struct Cond *c) {
+  806390:	55                   	push   %rbp
+  806391:	48 89 e5             	mov    %rsp,%rbp
+  806394:	48 83 ec 08          	sub    $0x8,%rsp
+  806398:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  80639c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063a0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8063a6:	90                   	nop
+  8063a7:	c9                   	leave
+  8063a8:	c3                   	ret
+
+00000000008063a9 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  8063a9:	55                   	push   %rbp
+  8063aa:	48 89 e5             	mov    %rsp,%rbp
+  8063ad:	48 83 ec 30          	sub    $0x30,%rsp
+  8063b1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8063b5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8063b9:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8063bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063c1:	8b 00                	mov    (%rax),%eax
+  8063c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8063c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063ca:	48 89 c7             	mov    %rax,%rdi
+  8063cd:	48 b8 4c 63 80 00 00 	movabs $0x80634c,%rax
+  8063d4:	00 00 00 
+  8063d7:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8063d9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063dd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8063e1:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8063e4:	89 ce                	mov    %ecx,%esi
+  8063e6:	48 89 c7             	mov    %rax,%rdi
+  8063e9:	48 b8 50 28 80 00 00 	movabs $0x802850,%rax
+  8063f0:	00 00 00 
+  8063f3:	ff d0                	call   *%rax
+  8063f5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8063f8:	eb 1f                	jmp    806419 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8063fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8063fe:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806405:	be 02 00 00 00       	mov    $0x2,%esi
+  80640a:	48 89 c7             	mov    %rax,%rdi
+  80640d:	48 b8 50 28 80 00 00 	movabs $0x802850,%rax
+  806414:	00 00 00 
+  806417:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  806419:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80641d:	be 02 00 00 00       	mov    $0x2,%esi
+  806422:	48 89 c7             	mov    %rax,%rdi
+  806425:	48 b8 e7 61 80 00 00 	movabs $0x8061e7,%rax
+  80642c:	00 00 00 
+  80642f:	ff d0                	call   *%rax
+  806431:	85 c0                	test   %eax,%eax
+  806433:	75 c5                	jne    8063fa <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806435:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806439:	75 07                	jne    806442 <cond_timedwait+0x99>
+  80643b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806440:	eb 05                	jmp    806447 <cond_timedwait+0x9e>
+  806442:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806447:	c9                   	leave
+  806448:	c3                   	ret
+
+0000000000806449 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  806449:	55                   	push   %rbp
+  80644a:	48 89 e5             	mov    %rsp,%rbp
+  80644d:	48 83 ec 10          	sub    $0x10,%rsp
+  806451:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806455:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  806459:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80645d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806461:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806468:	48 89 ce             	mov    %rcx,%rsi
+  80646b:	48 89 c7             	mov    %rax,%rdi
+  80646e:	48 b8 a9 63 80 00 00 	movabs $0x8063a9,%rax
+  806475:	00 00 00 
+  806478:	ff d0                	call   *%rax
+}
+  80647a:	90                   	nop
+  80647b:	c9                   	leave
+  80647c:	c3                   	ret
+
+000000000080647d <cond_signal>:
+cond_signal(struct Cond *c) {
+  80647d:	55                   	push   %rbp
+  80647e:	48 89 e5             	mov    %rsp,%rbp
+  806481:	48 83 ec 10          	sub    $0x10,%rsp
+  806485:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  806489:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80648d:	be 01 00 00 00       	mov    $0x1,%esi
+  806492:	48 89 c7             	mov    %rax,%rdi
+  806495:	48 b8 38 62 80 00 00 	movabs $0x806238,%rax
+  80649c:	00 00 00 
+  80649f:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  8064a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8064aa:	48 89 c7             	mov    %rax,%rdi
+  8064ad:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  8064b4:	00 00 00 
+  8064b7:	ff d0                	call   *%rax
+}
+  8064b9:	90                   	nop
+  8064ba:	c9                   	leave
+  8064bb:	c3                   	ret
+
+00000000008064bc <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8064bc:	55                   	push   %rbp
+  8064bd:	48 89 e5             	mov    %rsp,%rbp
+  8064c0:	48 83 ec 10          	sub    $0x10,%rsp
+  8064c4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8064c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064cc:	be 01 00 00 00       	mov    $0x1,%esi
+  8064d1:	48 89 c7             	mov    %rax,%rdi
+  8064d4:	48 b8 38 62 80 00 00 	movabs $0x806238,%rax
+  8064db:	00 00 00 
+  8064de:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8064e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064e4:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8064e9:	48 89 c7             	mov    %rax,%rdi
+  8064ec:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  8064f3:	00 00 00 
+  8064f6:	ff d0                	call   *%rax
+}
+  8064f8:	90                   	nop
+  8064f9:	c9                   	leave
+  8064fa:	c3                   	ret
+
+00000000008064fb <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8064fb:	55                   	push   %rbp
+  8064fc:	48 89 e5             	mov    %rsp,%rbp
+  8064ff:	48 83 ec 10          	sub    $0x10,%rsp
+  806503:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806507:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  80650a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80650e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806511:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  806513:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806517:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  80651e:	90                   	nop
+  80651f:	c9                   	leave
+  806520:	c3                   	ret
+
+0000000000806521 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  806521:	55                   	push   %rbp
+  806522:	48 89 e5             	mov    %rsp,%rbp
+  806525:	48 83 ec 18          	sub    $0x18,%rsp
+  806529:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  80652d:	eb 2a                	jmp    806559 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  80652f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806532:	8d 50 ff             	lea    -0x1(%rax),%edx
+  806535:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806539:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  80653c:	89 ce                	mov    %ecx,%esi
+  80653e:	48 89 c7             	mov    %rax,%rdi
+  806541:	48 b8 0c 62 80 00 00 	movabs $0x80620c,%rax
+  806548:	00 00 00 
+  80654b:	ff d0                	call   *%rax
+  80654d:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  806550:	75 07                	jne    806559 <sem_trywait+0x38>
+      return 0;
+  806552:	b8 00 00 00 00       	mov    $0x0,%eax
+  806557:	eb 14                	jmp    80656d <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  806559:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80655d:	8b 00                	mov    (%rax),%eax
+  80655f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806562:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806566:	75 c7                	jne    80652f <sem_trywait+0xe>
+  return -E_BUSY;
+  806568:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80656d:	c9                   	leave
+  80656e:	c3                   	ret
+
+000000000080656f <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  80656f:	55                   	push   %rbp
+  806570:	48 89 e5             	mov    %rsp,%rbp
+  806573:	48 83 ec 30          	sub    $0x30,%rsp
+  806577:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80657b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  80657f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  806586:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  806587:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80658c:	0f 84 fb 00 00 00    	je     80668d <sem_timedwait+0x11e>
+  806592:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  806597:	0f 84 f0 00 00 00    	je     80668d <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  80659d:	48 b8 9f 5b 80 00 00 	movabs $0x805b9f,%rax
+  8065a4:	00 00 00 
+  8065a7:	ff d0                	call   *%rax
+  8065a9:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8065ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065b1:	48 f7 d0             	not    %rax
+  8065b4:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8065b8:	73 0d                	jae    8065c7 <sem_timedwait+0x58>
+  8065ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8065be:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8065c2:	48 01 d0             	add    %rdx,%rax
+  8065c5:	eb 07                	jmp    8065ce <sem_timedwait+0x5f>
+  8065c7:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8065ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8065d2:	e9 b6 00 00 00       	jmp    80668d <sem_timedwait+0x11e>
+    if (deadline) {
+  8065d7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8065dc:	74 2d                	je     80660b <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8065de:	48 b8 9f 5b 80 00 00 	movabs $0x805b9f,%rax
+  8065e5:	00 00 00 
+  8065e8:	ff d0                	call   *%rax
+  8065ea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8065ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065f2:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8065f6:	73 0a                	jae    806602 <sem_timedwait+0x93>
+  8065f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065fc:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  806600:	eb 05                	jmp    806607 <sem_timedwait+0x98>
+  806602:	b8 00 00 00 00       	mov    $0x0,%eax
+  806607:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  80660b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80660f:	48 83 c0 04          	add    $0x4,%rax
+  806613:	be 01 00 00 00       	mov    $0x1,%esi
+  806618:	48 89 c7             	mov    %rax,%rdi
+  80661b:	48 b8 38 62 80 00 00 	movabs $0x806238,%rax
+  806622:	00 00 00 
+  806625:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  806627:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80662b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80662f:	be 00 00 00 00       	mov    $0x0,%esi
+  806634:	48 89 c7             	mov    %rax,%rdi
+  806637:	48 b8 50 28 80 00 00 	movabs $0x802850,%rax
+  80663e:	00 00 00 
+  806641:	ff d0                	call   *%rax
+  806643:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  806646:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80664a:	48 83 c0 04          	add    $0x4,%rax
+  80664e:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  806653:	48 89 c7             	mov    %rax,%rdi
+  806656:	48 b8 38 62 80 00 00 	movabs $0x806238,%rax
+  80665d:	00 00 00 
+  806660:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  806662:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  806666:	75 25                	jne    80668d <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  806668:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80666c:	48 89 c7             	mov    %rax,%rdi
+  80666f:	48 b8 21 65 80 00 00 	movabs $0x806521,%rax
+  806676:	00 00 00 
+  806679:	ff d0                	call   *%rax
+  80667b:	85 c0                	test   %eax,%eax
+  80667d:	79 07                	jns    806686 <sem_timedwait+0x117>
+  80667f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806684:	eb 27                	jmp    8066ad <sem_timedwait+0x13e>
+  806686:	b8 00 00 00 00       	mov    $0x0,%eax
+  80668b:	eb 20                	jmp    8066ad <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  80668d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806691:	48 89 c7             	mov    %rax,%rdi
+  806694:	48 b8 21 65 80 00 00 	movabs $0x806521,%rax
+  80669b:	00 00 00 
+  80669e:	ff d0                	call   *%rax
+  8066a0:	85 c0                	test   %eax,%eax
+  8066a2:	0f 88 2f ff ff ff    	js     8065d7 <sem_timedwait+0x68>
+  return 0;
+  8066a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8066ad:	c9                   	leave
+  8066ae:	c3                   	ret
+
+00000000008066af <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  8066af:	55                   	push   %rbp
+  8066b0:	48 89 e5             	mov    %rsp,%rbp
+  8066b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8066b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8066bb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8066bf:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8066c6:	48 89 c7             	mov    %rax,%rdi
+  8066c9:	48 b8 6f 65 80 00 00 	movabs $0x80656f,%rax
+  8066d0:	00 00 00 
+  8066d3:	ff d0                	call   *%rax
+}
+  8066d5:	90                   	nop
+  8066d6:	c9                   	leave
+  8066d7:	c3                   	ret
+
+00000000008066d8 <sem_post>:
+sem_post(struct Semaphore *s) {
+  8066d8:	55                   	push   %rbp
+  8066d9:	48 89 e5             	mov    %rsp,%rbp
+  8066dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8066e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8066e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8066e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8066ed:	48 89 c7             	mov    %rax,%rdi
+  8066f0:	48 b8 38 62 80 00 00 	movabs $0x806238,%rax
+  8066f7:	00 00 00 
+  8066fa:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8066fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806700:	8b 40 04             	mov    0x4(%rax),%eax
+  806703:	85 c0                	test   %eax,%eax
+  806705:	74 18                	je     80671f <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  806707:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80670b:	be 01 00 00 00       	mov    $0x1,%esi
+  806710:	48 89 c7             	mov    %rax,%rdi
+  806713:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  80671a:	00 00 00 
+  80671d:	ff d0                	call   *%rax
+}
+  80671f:	90                   	nop
+  806720:	c9                   	leave
+  806721:	c3                   	ret
+  806722:	66 90                	xchg   %ax,%ax
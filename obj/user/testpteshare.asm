@@ -0,0 +1,11306 @@
+
+obj/user/testpteshare:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 8f 02 00 00       	call   8002bb <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+const char *msg2 = "goodbye, world\n";
+
+void childofspawn(void);
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  if (argc != 0)
+  800041:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800045:	74 0c                	je     800053 <umain+0x21>
+    childofspawn();
+  800047:	48 b8 87 02 80 00 00 	movabs $0x800287,%rax
+  80004e:	00 00 00 
+  800051:	ff d0                	call   *%rax
+
+  if ((r = sys_page_alloc(0, VA, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  800053:	ba 07 04 00 00       	mov    $0x407,%edx
+  800058:	be 00 00 00 0a       	mov    $0xa000000,%esi
+  80005d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800062:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  800069:	00 00 00 
+  80006c:	ff d0                	call   *%rax
+  80006e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800071:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800075:	79 36                	jns    8000ad <umain+0x7b>
+    panic("sys_page_alloc: %i", r);
+  800077:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80007a:	89 c1                	mov    %eax,%ecx
+  80007c:	48 b8 de 72 80 00 00 	movabs $0x8072de,%rax
+  800083:	00 00 00 
+  800086:	48 89 c2             	mov    %rax,%rdx
+  800089:	be 12 00 00 00       	mov    $0x12,%esi
+  80008e:	48 b8 f1 72 80 00 00 	movabs $0x8072f1,%rax
+  800095:	00 00 00 
+  800098:	48 89 c7             	mov    %rax,%rdi
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  8000a7:	00 00 00 
+  8000aa:	41 ff d0             	call   *%r8
+
+  // check fork
+  if ((r = fork()) < 0)
+  8000ad:	48 b8 98 31 80 00 00 	movabs $0x803198,%rax
+  8000b4:	00 00 00 
+  8000b7:	ff d0                	call   *%rax
+  8000b9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8000bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000c0:	79 36                	jns    8000f8 <umain+0xc6>
+    panic("fork: %i", r);
+  8000c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000c5:	89 c1                	mov    %eax,%ecx
+  8000c7:	48 b8 05 73 80 00 00 	movabs $0x807305,%rax
+  8000ce:	00 00 00 
+  8000d1:	48 89 c2             	mov    %rax,%rdx
+  8000d4:	be 16 00 00 00       	mov    $0x16,%esi
+  8000d9:	48 b8 f1 72 80 00 00 	movabs $0x8072f1,%rax
+  8000e0:	00 00 00 
+  8000e3:	48 89 c7             	mov    %rax,%rdi
+  8000e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000eb:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  8000f2:	00 00 00 
+  8000f5:	41 ff d0             	call   *%r8
+  if (r == 0) {
+  8000f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8000fc:	75 2d                	jne    80012b <umain+0xf9>
+    strcpy(VA, msg);
+  8000fe:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800105:	00 00 00 
+  800108:	48 8b 00             	mov    (%rax),%rax
+  80010b:	48 89 c6             	mov    %rax,%rsi
+  80010e:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800113:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  80011a:	00 00 00 
+  80011d:	ff d0                	call   *%rax
+    exit();
+  80011f:	48 b8 3e 03 80 00 00 	movabs $0x80033e,%rax
+  800126:	00 00 00 
+  800129:	ff d0                	call   *%rax
+  }
+  wait(r);
+  80012b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80012e:	89 c7                	mov    %eax,%edi
+  800130:	48 b8 7a 5f 80 00 00 	movabs $0x805f7a,%rax
+  800137:	00 00 00 
+  80013a:	ff d0                	call   *%rax
+  cprintf("fork handles PTE_SHARE %s\n", strcmp(VA, msg) == 0 ? "right" : "wrong");
+  80013c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800143:	00 00 00 
+  800146:	48 8b 00             	mov    (%rax),%rax
+  800149:	48 89 c6             	mov    %rax,%rsi
+  80014c:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  800151:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+  80015d:	85 c0                	test   %eax,%eax
+  80015f:	75 0c                	jne    80016d <umain+0x13b>
+  800161:	48 b8 0e 73 80 00 00 	movabs $0x80730e,%rax
+  800168:	00 00 00 
+  80016b:	eb 0a                	jmp    800177 <umain+0x145>
+  80016d:	48 b8 14 73 80 00 00 	movabs $0x807314,%rax
+  800174:	00 00 00 
+  800177:	48 89 c6             	mov    %rax,%rsi
+  80017a:	48 b8 1a 73 80 00 00 	movabs $0x80731a,%rax
+  800181:	00 00 00 
+  800184:	48 89 c7             	mov    %rax,%rdi
+  800187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018c:	48 ba 81 05 80 00 00 	movabs $0x800581,%rdx
+  800193:	00 00 00 
+  800196:	ff d2                	call   *%rdx
+
+  // check spawn
+  if ((r = spawnl("/testpteshare", "testpteshare", "arg", 0)) < 0)
+  800198:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80019d:	48 b8 35 73 80 00 00 	movabs $0x807335,%rax
+  8001a4:	00 00 00 
+  8001a7:	48 89 c2             	mov    %rax,%rdx
+  8001aa:	48 b8 39 73 80 00 00 	movabs $0x807339,%rax
+  8001b1:	00 00 00 
+  8001b4:	48 89 c6             	mov    %rax,%rsi
+  8001b7:	48 b8 46 73 80 00 00 	movabs $0x807346,%rax
+  8001be:	00 00 00 
+  8001c1:	48 89 c7             	mov    %rax,%rdi
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	49 b8 73 4b 80 00 00 	movabs $0x804b73,%r8
+  8001d0:	00 00 00 
+  8001d3:	41 ff d0             	call   *%r8
+  8001d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8001d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8001dd:	79 36                	jns    800215 <umain+0x1e3>
+    panic("spawn: %i", r);
+  8001df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001e2:	89 c1                	mov    %eax,%ecx
+  8001e4:	48 b8 54 73 80 00 00 	movabs $0x807354,%rax
+  8001eb:	00 00 00 
+  8001ee:	48 89 c2             	mov    %rax,%rdx
+  8001f1:	be 20 00 00 00       	mov    $0x20,%esi
+  8001f6:	48 b8 f1 72 80 00 00 	movabs $0x8072f1,%rax
+  8001fd:	00 00 00 
+  800200:	48 89 c7             	mov    %rax,%rdi
+  800203:	b8 00 00 00 00       	mov    $0x0,%eax
+  800208:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  80020f:	00 00 00 
+  800212:	41 ff d0             	call   *%r8
+  wait(r);
+  800215:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800218:	89 c7                	mov    %eax,%edi
+  80021a:	48 b8 7a 5f 80 00 00 	movabs $0x805f7a,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+  cprintf("spawn handles PTE_SHARE %s\n", strcmp(VA, msg2) == 0 ? "right" : "wrong");
+  800226:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80022d:	00 00 00 
+  800230:	48 8b 00             	mov    (%rax),%rax
+  800233:	48 89 c6             	mov    %rax,%rsi
+  800236:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  80023b:	48 b8 7c 17 80 00 00 	movabs $0x80177c,%rax
+  800242:	00 00 00 
+  800245:	ff d0                	call   *%rax
+  800247:	85 c0                	test   %eax,%eax
+  800249:	75 0c                	jne    800257 <umain+0x225>
+  80024b:	48 b8 0e 73 80 00 00 	movabs $0x80730e,%rax
+  800252:	00 00 00 
+  800255:	eb 0a                	jmp    800261 <umain+0x22f>
+  800257:	48 b8 14 73 80 00 00 	movabs $0x807314,%rax
+  80025e:	00 00 00 
+  800261:	48 89 c6             	mov    %rax,%rsi
+  800264:	48 b8 5e 73 80 00 00 	movabs $0x80735e,%rax
+  80026b:	00 00 00 
+  80026e:	48 89 c7             	mov    %rax,%rdi
+  800271:	b8 00 00 00 00       	mov    $0x0,%eax
+  800276:	48 ba 81 05 80 00 00 	movabs $0x800581,%rdx
+  80027d:	00 00 00 
+  800280:	ff d2                	call   *%rdx
+static __inline void wrmsr(uint32_t msr, uint64_t val) __attribute__((always_inline));
+static __inline void wbinvd(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void) {
+  __asm __volatile("int3");
+  800282:	cc                   	int3
+}
+  800283:	90                   	nop
+
+  breakpoint();
+}
+  800284:	90                   	nop
+  800285:	c9                   	leave
+  800286:	c3                   	ret
+
+0000000000800287 <childofspawn>:
+
+void
+childofspawn(void) {
+  800287:	55                   	push   %rbp
+  800288:	48 89 e5             	mov    %rsp,%rbp
+  strcpy(VA, msg2);
+  80028b:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  800292:	00 00 00 
+  800295:	48 8b 00             	mov    (%rax),%rax
+  800298:	48 89 c6             	mov    %rax,%rsi
+  80029b:	bf 00 00 00 0a       	mov    $0xa000000,%edi
+  8002a0:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  8002a7:	00 00 00 
+  8002aa:	ff d0                	call   *%rax
+  exit();
+  8002ac:	48 b8 3e 03 80 00 00 	movabs $0x80033e,%rax
+  8002b3:	00 00 00 
+  8002b6:	ff d0                	call   *%rax
+}
+  8002b8:	90                   	nop
+  8002b9:	5d                   	pop    %rbp
+  8002ba:	c3                   	ret
+
+00000000008002bb <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002bb:	55                   	push   %rbp
+  8002bc:	48 89 e5             	mov    %rsp,%rbp
+  8002bf:	48 83 ec 20          	sub    $0x20,%rsp
+  8002c3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8002c6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8002ca:	48 b8 00 81 80 00 00 	movabs $0x808100,%rax
+  8002d1:	00 00 00 
+  8002d4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8002d8:	eb 13                	jmp    8002ed <libmain+0x32>
+    (*ctor)();
+  8002da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8002de:	48 8b 10             	mov    (%rax),%rdx
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	ff d2                	call   *%rdx
+    ctor++;
+  8002e8:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8002ed:	48 b8 00 81 80 00 00 	movabs $0x808100,%rax
+  8002f4:	00 00 00 
+  8002f7:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8002fb:	72 dd                	jb     8002da <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002fd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800301:	7e 14                	jle    800317 <libmain+0x5c>
+    binaryname = argv[0];
+  800303:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800307:	48 8b 00             	mov    (%rax),%rax
+  80030a:	48 ba 10 80 80 00 00 	movabs $0x808010,%rdx
+  800311:	00 00 00 
+  800314:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800317:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80031b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80031e:	48 89 d6             	mov    %rdx,%rsi
+  800321:	89 c7                	mov    %eax,%edi
+  800323:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80032a:	00 00 00 
+  80032d:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  80032f:	48 b8 3e 03 80 00 00 	movabs $0x80033e,%rax
+  800336:	00 00 00 
+  800339:	ff d0                	call   *%rax
+#endif
+}
+  80033b:	90                   	nop
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+000000000080033e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80033e:	55                   	push   %rbp
+  80033f:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800342:	48 b8 b6 35 80 00 00 	movabs $0x8035b6,%rax
+  800349:	00 00 00 
+  80034c:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  80034e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800353:	48 b8 b7 21 80 00 00 	movabs $0x8021b7,%rax
+  80035a:	00 00 00 
+  80035d:	ff d0                	call   *%rax
+}
+  80035f:	90                   	nop
+  800360:	5d                   	pop    %rbp
+  800361:	c3                   	ret
+
+0000000000800362 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800362:	55                   	push   %rbp
+  800363:	48 89 e5             	mov    %rsp,%rbp
+  800366:	53                   	push   %rbx
+  800367:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  80036e:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800375:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  80037b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800382:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800389:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800390:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800397:	84 c0                	test   %al,%al
+  800399:	74 23                	je     8003be <_panic+0x5c>
+  80039b:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8003a2:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8003a6:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8003aa:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8003ae:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8003b2:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8003b6:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8003ba:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8003be:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8003c5:	00 00 00 
+  8003c8:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8003cf:	00 00 00 
+  8003d2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d6:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8003dd:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8003e4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003eb:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  8003f2:	00 00 00 
+  8003f5:	48 8b 18             	mov    (%rax),%rbx
+  8003f8:	48 b8 86 22 80 00 00 	movabs $0x802286,%rax
+  8003ff:	00 00 00 
+  800402:	ff d0                	call   *%rax
+  800404:	89 c6                	mov    %eax,%esi
+  800406:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  80040c:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800413:	41 89 d0             	mov    %edx,%r8d
+  800416:	48 89 c1             	mov    %rax,%rcx
+  800419:	48 89 da             	mov    %rbx,%rdx
+  80041c:	48 b8 88 73 80 00 00 	movabs $0x807388,%rax
+  800423:	00 00 00 
+  800426:	48 89 c7             	mov    %rax,%rdi
+  800429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042e:	49 b9 81 05 80 00 00 	movabs $0x800581,%r9
+  800435:	00 00 00 
+  800438:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80043b:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800442:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800449:	48 89 d6             	mov    %rdx,%rsi
+  80044c:	48 89 c7             	mov    %rax,%rdi
+  80044f:	48 b8 f6 04 80 00 00 	movabs $0x8004f6,%rax
+  800456:	00 00 00 
+  800459:	ff d0                	call   *%rax
+  cprintf("\n");
+  80045b:	48 b8 ab 73 80 00 00 	movabs $0x8073ab,%rax
+  800462:	00 00 00 
+  800465:	48 89 c7             	mov    %rax,%rdi
+  800468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046d:	48 ba 81 05 80 00 00 	movabs $0x800581,%rdx
+  800474:	00 00 00 
+  800477:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800479:	cc                   	int3
+  80047a:	eb fd                	jmp    800479 <_panic+0x117>
+
+000000000080047c <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  80047c:	55                   	push   %rbp
+  80047d:	48 89 e5             	mov    %rsp,%rbp
+  800480:	48 83 ec 10          	sub    $0x10,%rsp
+  800484:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800487:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80048b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80048f:	8b 00                	mov    (%rax),%eax
+  800491:	8d 48 01             	lea    0x1(%rax),%ecx
+  800494:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800498:	89 0a                	mov    %ecx,(%rdx)
+  80049a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80049d:	89 d1                	mov    %edx,%ecx
+  80049f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004a3:	48 98                	cltq
+  8004a5:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8004a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004ad:	8b 00                	mov    (%rax),%eax
+  8004af:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8004b4:	75 2c                	jne    8004e2 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8004b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004ba:	8b 00                	mov    (%rax),%eax
+  8004bc:	48 98                	cltq
+  8004be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8004c2:	48 83 c2 08          	add    $0x8,%rdx
+  8004c6:	48 89 c6             	mov    %rax,%rsi
+  8004c9:	48 89 d7             	mov    %rdx,%rdi
+  8004cc:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  8004d3:	00 00 00 
+  8004d6:	ff d0                	call   *%rax
+    b->idx = 0;
+  8004d8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004dc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8004e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004e6:	8b 40 04             	mov    0x4(%rax),%eax
+  8004e9:	8d 50 01             	lea    0x1(%rax),%edx
+  8004ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8004f0:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8004f3:	90                   	nop
+  8004f4:	c9                   	leave
+  8004f5:	c3                   	ret
+
+00000000008004f6 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004f6:	55                   	push   %rbp
+  8004f7:	48 89 e5             	mov    %rsp,%rbp
+  8004fa:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800501:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800508:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  80050f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800516:	00 00 00 
+  b.cnt = 0;
+  800519:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800520:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800523:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  80052a:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800531:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800538:	48 89 c6             	mov    %rax,%rsi
+  80053b:	48 b8 7c 04 80 00 00 	movabs $0x80047c,%rax
+  800542:	00 00 00 
+  800545:	48 89 c7             	mov    %rax,%rdi
+  800548:	48 b8 db 08 80 00 00 	movabs $0x8008db,%rax
+  80054f:	00 00 00 
+  800552:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800554:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  80055a:	48 98                	cltq
+  80055c:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800563:	48 83 c2 08          	add    $0x8,%rdx
+  800567:	48 89 c6             	mov    %rax,%rsi
+  80056a:	48 89 d7             	mov    %rdx,%rdi
+  80056d:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  800574:	00 00 00 
+  800577:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800579:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  80057f:	c9                   	leave
+  800580:	c3                   	ret
+
+0000000000800581 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800581:	55                   	push   %rbp
+  800582:	48 89 e5             	mov    %rsp,%rbp
+  800585:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80058c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800593:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80059a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8005a1:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8005a8:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8005af:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8005b6:	84 c0                	test   %al,%al
+  8005b8:	74 20                	je     8005da <cprintf+0x59>
+  8005ba:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8005be:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8005c2:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8005c6:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8005ca:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8005ce:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8005d2:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8005d6:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8005da:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8005e1:	00 00 00 
+  8005e4:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8005eb:	00 00 00 
+  8005ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005f2:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8005f9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800600:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800607:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80060e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800615:	48 89 d6             	mov    %rdx,%rsi
+  800618:	48 89 c7             	mov    %rax,%rdi
+  80061b:	48 b8 f6 04 80 00 00 	movabs $0x8004f6,%rax
+  800622:	00 00 00 
+  800625:	ff d0                	call   *%rax
+  800627:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  80062d:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800633:	c9                   	leave
+  800634:	c3                   	ret
+
+0000000000800635 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800635:	55                   	push   %rbp
+  800636:	48 89 e5             	mov    %rsp,%rbp
+  800639:	48 83 ec 30          	sub    $0x30,%rsp
+  80063d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800641:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800645:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800649:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  80064c:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800650:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800654:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800657:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  80065b:	72 54                	jb     8006b1 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80065d:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800660:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800663:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800666:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80066a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80066f:	48 f7 f6             	div    %rsi
+  800672:	49 89 c2             	mov    %rax,%r10
+  800675:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800678:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  80067b:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  80067f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800683:	41 89 c9             	mov    %ecx,%r9d
+  800686:	41 89 f8             	mov    %edi,%r8d
+  800689:	89 d1                	mov    %edx,%ecx
+  80068b:	4c 89 d2             	mov    %r10,%rdx
+  80068e:	48 89 c7             	mov    %rax,%rdi
+  800691:	48 b8 35 06 80 00 00 	movabs $0x800635,%rax
+  800698:	00 00 00 
+  80069b:	ff d0                	call   *%rax
+  80069d:	eb 1c                	jmp    8006bb <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80069f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8006a6:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8006aa:	48 89 d6             	mov    %rdx,%rsi
+  8006ad:	89 c7                	mov    %eax,%edi
+  8006af:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8006b1:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8006b5:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8006b9:	7f e4                	jg     80069f <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8006bb:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8006be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8006c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006c7:	48 f7 f1             	div    %rcx
+  8006ca:	48 b8 f0 75 80 00 00 	movabs $0x8075f0,%rax
+  8006d1:	00 00 00 
+  8006d4:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8006d8:	0f be c0             	movsbl %al,%eax
+  8006db:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8006df:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8006e3:	48 89 d6             	mov    %rdx,%rsi
+  8006e6:	89 c7                	mov    %eax,%edi
+  8006e8:	ff d1                	call   *%rcx
+}
+  8006ea:	90                   	nop
+  8006eb:	c9                   	leave
+  8006ec:	c3                   	ret
+
+00000000008006ed <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8006ed:	55                   	push   %rbp
+  8006ee:	48 89 e5             	mov    %rsp,%rbp
+  8006f1:	48 83 ec 10          	sub    $0x10,%rsp
+  8006f5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8006f9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8006fc:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800700:	7e 4b                	jle    80074d <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800702:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800706:	8b 00                	mov    (%rax),%eax
+  800708:	83 f8 2f             	cmp    $0x2f,%eax
+  80070b:	77 24                	ja     800731 <getuint+0x44>
+  80070d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800711:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800715:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800719:	8b 00                	mov    (%rax),%eax
+  80071b:	89 c0                	mov    %eax,%eax
+  80071d:	48 01 d0             	add    %rdx,%rax
+  800720:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800724:	8b 12                	mov    (%rdx),%edx
+  800726:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800729:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80072d:	89 0a                	mov    %ecx,(%rdx)
+  80072f:	eb 14                	jmp    800745 <getuint+0x58>
+  800731:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800735:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800739:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80073d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800741:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800745:	48 8b 00             	mov    (%rax),%rax
+  800748:	e9 95 00 00 00       	jmp    8007e2 <getuint+0xf5>
+  else if (lflag)
+  80074d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800751:	74 48                	je     80079b <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800753:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800757:	8b 00                	mov    (%rax),%eax
+  800759:	83 f8 2f             	cmp    $0x2f,%eax
+  80075c:	77 24                	ja     800782 <getuint+0x95>
+  80075e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800762:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800766:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80076a:	8b 00                	mov    (%rax),%eax
+  80076c:	89 c0                	mov    %eax,%eax
+  80076e:	48 01 d0             	add    %rdx,%rax
+  800771:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800775:	8b 12                	mov    (%rdx),%edx
+  800777:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80077a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80077e:	89 0a                	mov    %ecx,(%rdx)
+  800780:	eb 14                	jmp    800796 <getuint+0xa9>
+  800782:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800786:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80078a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80078e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800792:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800796:	48 8b 00             	mov    (%rax),%rax
+  800799:	eb 47                	jmp    8007e2 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80079b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80079f:	8b 00                	mov    (%rax),%eax
+  8007a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a4:	77 24                	ja     8007ca <getuint+0xdd>
+  8007a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007aa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8007ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b2:	8b 00                	mov    (%rax),%eax
+  8007b4:	89 c0                	mov    %eax,%eax
+  8007b6:	48 01 d0             	add    %rdx,%rax
+  8007b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007bd:	8b 12                	mov    (%rdx),%edx
+  8007bf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8007c2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007c6:	89 0a                	mov    %ecx,(%rdx)
+  8007c8:	eb 14                	jmp    8007de <getuint+0xf1>
+  8007ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8007d2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8007d6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8007da:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8007de:	8b 00                	mov    (%rax),%eax
+  8007e0:	89 c0                	mov    %eax,%eax
+}
+  8007e2:	c9                   	leave
+  8007e3:	c3                   	ret
+
+00000000008007e4 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8007e4:	55                   	push   %rbp
+  8007e5:	48 89 e5             	mov    %rsp,%rbp
+  8007e8:	48 83 ec 10          	sub    $0x10,%rsp
+  8007ec:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8007f0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8007f3:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8007f7:	7e 4b                	jle    800844 <getint+0x60>
+    return va_arg(*ap, long long);
+  8007f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007fd:	8b 00                	mov    (%rax),%eax
+  8007ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800802:	77 24                	ja     800828 <getint+0x44>
+  800804:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800808:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80080c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800810:	8b 00                	mov    (%rax),%eax
+  800812:	89 c0                	mov    %eax,%eax
+  800814:	48 01 d0             	add    %rdx,%rax
+  800817:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80081b:	8b 12                	mov    (%rdx),%edx
+  80081d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800820:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800824:	89 0a                	mov    %ecx,(%rdx)
+  800826:	eb 14                	jmp    80083c <getint+0x58>
+  800828:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80082c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800830:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800834:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800838:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80083c:	48 8b 00             	mov    (%rax),%rax
+  80083f:	e9 95 00 00 00       	jmp    8008d9 <getint+0xf5>
+  else if (lflag)
+  800844:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800848:	74 48                	je     800892 <getint+0xae>
+    return va_arg(*ap, long);
+  80084a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80084e:	8b 00                	mov    (%rax),%eax
+  800850:	83 f8 2f             	cmp    $0x2f,%eax
+  800853:	77 24                	ja     800879 <getint+0x95>
+  800855:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800859:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80085d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800861:	8b 00                	mov    (%rax),%eax
+  800863:	89 c0                	mov    %eax,%eax
+  800865:	48 01 d0             	add    %rdx,%rax
+  800868:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80086c:	8b 12                	mov    (%rdx),%edx
+  80086e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800871:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800875:	89 0a                	mov    %ecx,(%rdx)
+  800877:	eb 14                	jmp    80088d <getint+0xa9>
+  800879:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80087d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800881:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800885:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800889:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80088d:	48 8b 00             	mov    (%rax),%rax
+  800890:	eb 47                	jmp    8008d9 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800892:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800896:	8b 00                	mov    (%rax),%eax
+  800898:	83 f8 2f             	cmp    $0x2f,%eax
+  80089b:	77 24                	ja     8008c1 <getint+0xdd>
+  80089d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008a1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008a9:	8b 00                	mov    (%rax),%eax
+  8008ab:	89 c0                	mov    %eax,%eax
+  8008ad:	48 01 d0             	add    %rdx,%rax
+  8008b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008b4:	8b 12                	mov    (%rdx),%edx
+  8008b6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008bd:	89 0a                	mov    %ecx,(%rdx)
+  8008bf:	eb 14                	jmp    8008d5 <getint+0xf1>
+  8008c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008c5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008c9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008d5:	8b 00                	mov    (%rax),%eax
+  8008d7:	48 98                	cltq
+}
+  8008d9:	c9                   	leave
+  8008da:	c3                   	ret
+
+00000000008008db <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8008db:	55                   	push   %rbp
+  8008dc:	48 89 e5             	mov    %rsp,%rbp
+  8008df:	41 54                	push   %r12
+  8008e1:	53                   	push   %rbx
+  8008e2:	48 83 ec 60          	sub    $0x60,%rsp
+  8008e6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8008ea:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8008ee:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8008f2:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8008f6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8008fa:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  8008fe:	48 8b 06             	mov    (%rsi),%rax
+  800901:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800905:	48 89 01             	mov    %rax,(%rcx)
+  800908:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80090c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800910:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800914:	eb 17                	jmp    80092d <vprintfmt+0x52>
+      if (ch == '\0')
+  800916:	85 db                	test   %ebx,%ebx
+  800918:	0f 84 bf 04 00 00    	je     800ddd <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80091e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800922:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800926:	48 89 c6             	mov    %rax,%rsi
+  800929:	89 df                	mov    %ebx,%edi
+  80092b:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80092d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800931:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800935:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800939:	0f b6 00             	movzbl (%rax),%eax
+  80093c:	0f b6 d8             	movzbl %al,%ebx
+  80093f:	83 fb 25             	cmp    $0x25,%ebx
+  800942:	75 d2                	jne    800916 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800944:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800948:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  80094f:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800956:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  80095d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800964:	eb 04                	jmp    80096a <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800966:	90                   	nop
+  800967:	eb 01                	jmp    80096a <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800969:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  80096a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80096e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800972:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800976:	0f b6 00             	movzbl (%rax),%eax
+  800979:	0f b6 d8             	movzbl %al,%ebx
+  80097c:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  80097f:	83 f8 55             	cmp    $0x55,%eax
+  800982:	0f 87 22 04 00 00    	ja     800daa <vprintfmt+0x4cf>
+  800988:	89 c0                	mov    %eax,%eax
+  80098a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800991:	00 
+  800992:	48 b8 18 76 80 00 00 	movabs $0x807618,%rax
+  800999:	00 00 00 
+  80099c:	48 01 d0             	add    %rdx,%rax
+  80099f:	48 8b 00             	mov    (%rax),%rax
+  8009a2:	ff e0                	jmp    *%rax
+        padc = '-';
+  8009a4:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8009a8:	eb c0                	jmp    80096a <vprintfmt+0x8f>
+        padc = '0';
+  8009aa:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8009ae:	eb ba                	jmp    80096a <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8009b0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  8009b7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8009ba:	89 d0                	mov    %edx,%eax
+  8009bc:	c1 e0 02             	shl    $0x2,%eax
+  8009bf:	01 d0                	add    %edx,%eax
+  8009c1:	01 c0                	add    %eax,%eax
+  8009c3:	01 d8                	add    %ebx,%eax
+  8009c5:	83 e8 30             	sub    $0x30,%eax
+  8009c8:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  8009cb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8009cf:	0f b6 00             	movzbl (%rax),%eax
+  8009d2:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  8009d5:	83 fb 2f             	cmp    $0x2f,%ebx
+  8009d8:	7e 60                	jle    800a3a <vprintfmt+0x15f>
+  8009da:	83 fb 39             	cmp    $0x39,%ebx
+  8009dd:	7f 5b                	jg     800a3a <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  8009df:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  8009e4:	eb d1                	jmp    8009b7 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  8009e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ec:	77 17                	ja     800a05 <vprintfmt+0x12a>
+  8009ee:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009f2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009f5:	89 d2                	mov    %edx,%edx
+  8009f7:	48 01 d0             	add    %rdx,%rax
+  8009fa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8009fd:	83 c2 08             	add    $0x8,%edx
+  800a00:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a03:	eb 0c                	jmp    800a11 <vprintfmt+0x136>
+  800a05:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a09:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a0d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a11:	8b 00                	mov    (%rax),%eax
+  800a13:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800a16:	eb 23                	jmp    800a3b <vprintfmt+0x160>
+        if (width < 0)
+  800a18:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a1c:	0f 89 44 ff ff ff    	jns    800966 <vprintfmt+0x8b>
+          width = 0;
+  800a22:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800a29:	e9 38 ff ff ff       	jmp    800966 <vprintfmt+0x8b>
+        altflag = 1;
+  800a2e:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800a35:	e9 30 ff ff ff       	jmp    80096a <vprintfmt+0x8f>
+        goto process_precision;
+  800a3a:	90                   	nop
+        if (width < 0)
+  800a3b:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800a3f:	0f 89 24 ff ff ff    	jns    800969 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800a45:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800a48:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800a4b:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800a52:	e9 12 ff ff ff       	jmp    800969 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800a57:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800a5b:	e9 0a ff ff ff       	jmp    80096a <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800a60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a63:	83 f8 2f             	cmp    $0x2f,%eax
+  800a66:	77 17                	ja     800a7f <vprintfmt+0x1a4>
+  800a68:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a6c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a6f:	89 d2                	mov    %edx,%edx
+  800a71:	48 01 d0             	add    %rdx,%rax
+  800a74:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a77:	83 c2 08             	add    $0x8,%edx
+  800a7a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800a7d:	eb 0c                	jmp    800a8b <vprintfmt+0x1b0>
+  800a7f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800a83:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800a87:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800a8b:	8b 00                	mov    (%rax),%eax
+  800a8d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800a91:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800a95:	48 89 d6             	mov    %rdx,%rsi
+  800a98:	89 c7                	mov    %eax,%edi
+  800a9a:	ff d1                	call   *%rcx
+        break;
+  800a9c:	e9 37 03 00 00       	jmp    800dd8 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800aa1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa4:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa7:	77 17                	ja     800ac0 <vprintfmt+0x1e5>
+  800aa9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800aad:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ab0:	89 d2                	mov    %edx,%edx
+  800ab2:	48 01 d0             	add    %rdx,%rax
+  800ab5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ab8:	83 c2 08             	add    $0x8,%edx
+  800abb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800abe:	eb 0c                	jmp    800acc <vprintfmt+0x1f1>
+  800ac0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ac4:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ac8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800acc:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800ace:	85 db                	test   %ebx,%ebx
+  800ad0:	79 02                	jns    800ad4 <vprintfmt+0x1f9>
+          err = -err;
+  800ad2:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800ad4:	83 fb 15             	cmp    $0x15,%ebx
+  800ad7:	7f 16                	jg     800aef <vprintfmt+0x214>
+  800ad9:	48 ba 40 75 80 00 00 	movabs $0x807540,%rdx
+  800ae0:	00 00 00 
+  800ae3:	48 63 c3             	movslq %ebx,%rax
+  800ae6:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800aea:	4d 85 e4             	test   %r12,%r12
+  800aed:	75 2e                	jne    800b1d <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800aef:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800af3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800af7:	89 d9                	mov    %ebx,%ecx
+  800af9:	48 ba 01 76 80 00 00 	movabs $0x807601,%rdx
+  800b00:	00 00 00 
+  800b03:	48 89 c7             	mov    %rax,%rdi
+  800b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0b:	49 b8 e7 0d 80 00 00 	movabs $0x800de7,%r8
+  800b12:	00 00 00 
+  800b15:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800b18:	e9 bb 02 00 00       	jmp    800dd8 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800b1d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800b21:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b25:	4c 89 e1             	mov    %r12,%rcx
+  800b28:	48 ba 0a 76 80 00 00 	movabs $0x80760a,%rdx
+  800b2f:	00 00 00 
+  800b32:	48 89 c7             	mov    %rax,%rdi
+  800b35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3a:	49 b8 e7 0d 80 00 00 	movabs $0x800de7,%r8
+  800b41:	00 00 00 
+  800b44:	41 ff d0             	call   *%r8
+        break;
+  800b47:	e9 8c 02 00 00       	jmp    800dd8 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800b4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b52:	77 17                	ja     800b6b <vprintfmt+0x290>
+  800b54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b58:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b5b:	89 d2                	mov    %edx,%edx
+  800b5d:	48 01 d0             	add    %rdx,%rax
+  800b60:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b63:	83 c2 08             	add    $0x8,%edx
+  800b66:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b69:	eb 0c                	jmp    800b77 <vprintfmt+0x29c>
+  800b6b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b6f:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b73:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b77:	4c 8b 20             	mov    (%rax),%r12
+  800b7a:	4d 85 e4             	test   %r12,%r12
+  800b7d:	75 0a                	jne    800b89 <vprintfmt+0x2ae>
+          p = "(null)";
+  800b7f:	49 bc 0d 76 80 00 00 	movabs $0x80760d,%r12
+  800b86:	00 00 00 
+        if (width > 0 && padc != '-')
+  800b89:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b8d:	7e 78                	jle    800c07 <vprintfmt+0x32c>
+  800b8f:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800b93:	74 72                	je     800c07 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800b95:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b98:	48 98                	cltq
+  800b9a:	48 89 c6             	mov    %rax,%rsi
+  800b9d:	4c 89 e7             	mov    %r12,%rdi
+  800ba0:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  800ba7:	00 00 00 
+  800baa:	ff d0                	call   *%rax
+  800bac:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800baf:	eb 17                	jmp    800bc8 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800bb1:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800bb5:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800bb9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800bbd:	48 89 d6             	mov    %rdx,%rsi
+  800bc0:	89 c7                	mov    %eax,%edi
+  800bc2:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800bc4:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800bc8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800bcc:	7f e3                	jg     800bb1 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800bce:	eb 37                	jmp    800c07 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800bd0:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800bd4:	74 1e                	je     800bf4 <vprintfmt+0x319>
+  800bd6:	83 fb 1f             	cmp    $0x1f,%ebx
+  800bd9:	7e 05                	jle    800be0 <vprintfmt+0x305>
+  800bdb:	83 fb 7e             	cmp    $0x7e,%ebx
+  800bde:	7e 14                	jle    800bf4 <vprintfmt+0x319>
+            putch('?', putdat);
+  800be0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800be4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800be8:	48 89 c6             	mov    %rax,%rsi
+  800beb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800bf0:	ff d2                	call   *%rdx
+  800bf2:	eb 0f                	jmp    800c03 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800bf4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800bf8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800bfc:	48 89 c6             	mov    %rax,%rsi
+  800bff:	89 df                	mov    %ebx,%edi
+  800c01:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800c03:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c07:	4c 89 e0             	mov    %r12,%rax
+  800c0a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800c0e:	0f b6 00             	movzbl (%rax),%eax
+  800c11:	0f be d8             	movsbl %al,%ebx
+  800c14:	85 db                	test   %ebx,%ebx
+  800c16:	74 28                	je     800c40 <vprintfmt+0x365>
+  800c18:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c1c:	78 b2                	js     800bd0 <vprintfmt+0x2f5>
+  800c1e:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800c22:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800c26:	79 a8                	jns    800bd0 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800c28:	eb 16                	jmp    800c40 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800c2a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c2e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c32:	48 89 c6             	mov    %rax,%rsi
+  800c35:	bf 20 00 00 00       	mov    $0x20,%edi
+  800c3a:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800c3c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800c40:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c44:	7f e4                	jg     800c2a <vprintfmt+0x34f>
+        break;
+  800c46:	e9 8d 01 00 00       	jmp    800dd8 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800c4b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c4e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800c52:	89 d6                	mov    %edx,%esi
+  800c54:	48 89 c7             	mov    %rax,%rdi
+  800c57:	48 b8 e4 07 80 00 00 	movabs $0x8007e4,%rax
+  800c5e:	00 00 00 
+  800c61:	ff d0                	call   *%rax
+  800c63:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800c67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c6b:	48 85 c0             	test   %rax,%rax
+  800c6e:	79 1d                	jns    800c8d <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800c70:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c74:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c78:	48 89 c6             	mov    %rax,%rsi
+  800c7b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800c80:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800c82:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c86:	48 f7 d8             	neg    %rax
+  800c89:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800c8d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800c94:	e9 d2 00 00 00       	jmp    800d6b <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800c99:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800c9c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ca0:	89 d6                	mov    %edx,%esi
+  800ca2:	48 89 c7             	mov    %rax,%rdi
+  800ca5:	48 b8 ed 06 80 00 00 	movabs $0x8006ed,%rax
+  800cac:	00 00 00 
+  800caf:	ff d0                	call   *%rax
+  800cb1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800cb5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800cbc:	e9 aa 00 00 00       	jmp    800d6b <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800cc1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800cc4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800cc8:	89 d6                	mov    %edx,%esi
+  800cca:	48 89 c7             	mov    %rax,%rdi
+  800ccd:	48 b8 ed 06 80 00 00 	movabs $0x8006ed,%rax
+  800cd4:	00 00 00 
+  800cd7:	ff d0                	call   *%rax
+  800cd9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800cdd:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800ce4:	e9 82 00 00 00       	jmp    800d6b <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800ce9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ced:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cf1:	48 89 c6             	mov    %rax,%rsi
+  800cf4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800cf9:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800cfb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cff:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d03:	48 89 c6             	mov    %rax,%rsi
+  800d06:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d0b:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800d0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d10:	83 f8 2f             	cmp    $0x2f,%eax
+  800d13:	77 17                	ja     800d2c <vprintfmt+0x451>
+  800d15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d19:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d1c:	89 d2                	mov    %edx,%edx
+  800d1e:	48 01 d0             	add    %rdx,%rax
+  800d21:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d24:	83 c2 08             	add    $0x8,%edx
+  800d27:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d2a:	eb 0c                	jmp    800d38 <vprintfmt+0x45d>
+  800d2c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d30:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d34:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d38:	48 8b 00             	mov    (%rax),%rax
+  800d3b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800d3f:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800d46:	eb 23                	jmp    800d6b <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800d48:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d4b:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d4f:	89 d6                	mov    %edx,%esi
+  800d51:	48 89 c7             	mov    %rax,%rdi
+  800d54:	48 b8 ed 06 80 00 00 	movabs $0x8006ed,%rax
+  800d5b:	00 00 00 
+  800d5e:	ff d0                	call   *%rax
+  800d60:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800d64:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800d6b:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800d70:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800d73:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800d76:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d7a:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800d7e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800d82:	45 89 c1             	mov    %r8d,%r9d
+  800d85:	41 89 f8             	mov    %edi,%r8d
+  800d88:	48 89 c7             	mov    %rax,%rdi
+  800d8b:	48 b8 35 06 80 00 00 	movabs $0x800635,%rax
+  800d92:	00 00 00 
+  800d95:	ff d0                	call   *%rax
+        break;
+  800d97:	eb 3f                	jmp    800dd8 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800d99:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d9d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800da1:	48 89 c6             	mov    %rax,%rsi
+  800da4:	89 df                	mov    %ebx,%edi
+  800da6:	ff d2                	call   *%rdx
+        break;
+  800da8:	eb 2e                	jmp    800dd8 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800daa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800dae:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800db2:	48 89 c6             	mov    %rax,%rsi
+  800db5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dba:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800dbc:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800dc1:	eb 05                	jmp    800dc8 <vprintfmt+0x4ed>
+  800dc3:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800dc8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800dcc:	48 83 e8 01          	sub    $0x1,%rax
+  800dd0:	0f b6 00             	movzbl (%rax),%eax
+  800dd3:	3c 25                	cmp    $0x25,%al
+  800dd5:	75 ec                	jne    800dc3 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800dd7:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800dd8:	e9 50 fb ff ff       	jmp    80092d <vprintfmt+0x52>
+        return;
+  800ddd:	90                   	nop
+    }
+  }
+}
+  800dde:	48 83 c4 60          	add    $0x60,%rsp
+  800de2:	5b                   	pop    %rbx
+  800de3:	41 5c                	pop    %r12
+  800de5:	5d                   	pop    %rbp
+  800de6:	c3                   	ret
+
+0000000000800de7 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800de7:	55                   	push   %rbp
+  800de8:	48 89 e5             	mov    %rsp,%rbp
+  800deb:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800df2:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800df9:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800e00:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800e07:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800e0e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800e15:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800e1c:	84 c0                	test   %al,%al
+  800e1e:	74 20                	je     800e40 <printfmt+0x59>
+  800e20:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800e24:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800e28:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800e2c:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800e30:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800e34:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800e38:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800e3c:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800e40:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800e47:	00 00 00 
+  800e4a:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800e51:	00 00 00 
+  800e54:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e58:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800e5f:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800e66:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800e6d:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800e74:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800e7b:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800e82:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800e89:	48 89 c7             	mov    %rax,%rdi
+  800e8c:	48 b8 db 08 80 00 00 	movabs $0x8008db,%rax
+  800e93:	00 00 00 
+  800e96:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800e98:	90                   	nop
+  800e99:	c9                   	leave
+  800e9a:	c3                   	ret
+
+0000000000800e9b <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800e9b:	55                   	push   %rbp
+  800e9c:	48 89 e5             	mov    %rsp,%rbp
+  800e9f:	48 83 ec 10          	sub    $0x10,%rsp
+  800ea3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ea6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800eaa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800eae:	8b 40 10             	mov    0x10(%rax),%eax
+  800eb1:	8d 50 01             	lea    0x1(%rax),%edx
+  800eb4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800eb8:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800ebb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ebf:	48 8b 10             	mov    (%rax),%rdx
+  800ec2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ec6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800eca:	48 39 c2             	cmp    %rax,%rdx
+  800ecd:	73 17                	jae    800ee6 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800ecf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ed3:	48 8b 00             	mov    (%rax),%rax
+  800ed6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800eda:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800ede:	48 89 0a             	mov    %rcx,(%rdx)
+  800ee1:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800ee4:	88 10                	mov    %dl,(%rax)
+}
+  800ee6:	90                   	nop
+  800ee7:	c9                   	leave
+  800ee8:	c3                   	ret
+
+0000000000800ee9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800ee9:	55                   	push   %rbp
+  800eea:	48 89 e5             	mov    %rsp,%rbp
+  800eed:	48 83 ec 40          	sub    $0x40,%rsp
+  800ef1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800ef5:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800ef8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800efc:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800f00:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f04:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800f08:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800f0b:	48 98                	cltq
+  800f0d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800f11:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800f15:	48 01 d0             	add    %rdx,%rax
+  800f18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800f1c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800f23:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800f28:	74 06                	je     800f30 <vsnprintf+0x47>
+  800f2a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800f2e:	7f 07                	jg     800f37 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800f30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f35:	eb 32                	jmp    800f69 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800f37:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f3b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800f3f:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800f43:	48 89 c6             	mov    %rax,%rsi
+  800f46:	48 b8 9b 0e 80 00 00 	movabs $0x800e9b,%rax
+  800f4d:	00 00 00 
+  800f50:	48 89 c7             	mov    %rax,%rdi
+  800f53:	48 b8 db 08 80 00 00 	movabs $0x8008db,%rax
+  800f5a:	00 00 00 
+  800f5d:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800f5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800f63:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800f66:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800f69:	c9                   	leave
+  800f6a:	c3                   	ret
+
+0000000000800f6b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800f6b:	55                   	push   %rbp
+  800f6c:	48 89 e5             	mov    %rsp,%rbp
+  800f6f:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f76:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f7d:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800f83:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f8a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f91:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f98:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f9f:	84 c0                	test   %al,%al
+  800fa1:	74 20                	je     800fc3 <snprintf+0x58>
+  800fa3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800fa7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800fab:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800faf:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800fb3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800fb7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800fbb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800fbf:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800fc3:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800fca:	00 00 00 
+  800fcd:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800fd4:	00 00 00 
+  800fd7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fdb:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800fe2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fe9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800ff0:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800ff7:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800ffe:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801004:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80100b:	48 89 c7             	mov    %rax,%rdi
+  80100e:	48 b8 e9 0e 80 00 00 	movabs $0x800ee9,%rax
+  801015:	00 00 00 
+  801018:	ff d0                	call   *%rax
+  80101a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801020:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801026:	c9                   	leave
+  801027:	c3                   	ret
+
+0000000000801028 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801028:	55                   	push   %rbp
+  801029:	48 89 e5             	mov    %rsp,%rbp
+  80102c:	53                   	push   %rbx
+  80102d:	48 83 ec 38          	sub    $0x38,%rsp
+  801031:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801034:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801038:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  80103c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801040:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801044:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104c:	89 d1                	mov    %edx,%ecx
+  80104e:	0f a2                	cpuid
+  801050:	89 de                	mov    %ebx,%esi
+  801052:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801055:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801058:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  80105b:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  80105e:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801063:	74 09                	je     80106e <cpuid+0x46>
+}
+  801065:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801069:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80106c:	89 10                	mov    %edx,(%rax)
+
+  80106e:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801073:	74 09                	je     80107e <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801075:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801079:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  80107c:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  80107e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801083:	74 09                	je     80108e <cpuid+0x66>
+char *
+  801085:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801089:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80108c:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  80108e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801093:	74 09                	je     80109e <cpuid+0x76>
+  for (; *s; s++)
+  801095:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801099:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80109c:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80109e:	90                   	nop
+  80109f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8010a3:	c9                   	leave
+  8010a4:	c3                   	ret
+
+00000000008010a5 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  8010a5:	55                   	push   %rbp
+  8010a6:	48 89 e5             	mov    %rsp,%rbp
+  8010a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8010ad:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  8010b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8010b3:	89 c1                	mov    %eax,%ecx
+  8010b5:	0f 01 d0             	xgetbv
+  8010b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8010bb:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  8010be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8010c1:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8010c4:	48 c1 e2 20          	shl    $0x20,%rdx
+  8010c8:	48 09 d0             	or     %rdx,%rax
+#else
+  8010cb:	c9                   	leave
+  8010cc:	c3                   	ret
+
+00000000008010cd <string_cpu>:
+string_cpu(void) {
+  8010cd:	55                   	push   %rbp
+  8010ce:	48 89 e5             	mov    %rsp,%rbp
+  8010d1:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8010d5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  8010dc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  8010e3:	48 b8 18 80 80 00 00 	movabs $0x808018,%rax
+  8010ea:	00 00 00 
+  8010ed:	8b 00                	mov    (%rax),%eax
+  8010ef:	85 c0                	test   %eax,%eax
+  8010f1:	78 11                	js     801104 <string_cpu+0x37>
+    return string_features;
+  8010f3:	48 b8 18 80 80 00 00 	movabs $0x808018,%rax
+  8010fa:	00 00 00 
+  8010fd:	8b 00                	mov    (%rax),%eax
+  8010ff:	e9 df 00 00 00       	jmp    8011e3 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801104:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801108:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80110e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801113:	ba 00 00 00 00       	mov    $0x0,%edx
+  801118:	48 89 c6             	mov    %rax,%rsi
+  80111b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801120:	48 b8 28 10 80 00 00 	movabs $0x801028,%rax
+  801127:	00 00 00 
+  80112a:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  80112c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80112f:	83 f8 06             	cmp    $0x6,%eax
+  801132:	76 28                	jbe    80115c <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801134:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801138:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80113e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801143:	48 89 c2             	mov    %rax,%rdx
+  801146:	be 00 00 00 00       	mov    $0x0,%esi
+  80114b:	bf 07 00 00 00       	mov    $0x7,%edi
+  801150:	48 b8 28 10 80 00 00 	movabs $0x801028,%rax
+  801157:	00 00 00 
+  80115a:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  80115c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80115f:	25 00 02 00 00       	and    $0x200,%eax
+  801164:	85 c0                	test   %eax,%eax
+  801166:	74 04                	je     80116c <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801168:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  80116c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801170:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801176:	48 89 c1             	mov    %rax,%rcx
+  801179:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117e:	be 00 00 00 00       	mov    $0x0,%esi
+  801183:	bf 01 00 00 00       	mov    $0x1,%edi
+  801188:	48 b8 28 10 80 00 00 	movabs $0x801028,%rax
+  80118f:	00 00 00 
+  801192:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801194:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801197:	83 e0 20             	and    $0x20,%eax
+  80119a:	85 c0                	test   %eax,%eax
+  80119c:	74 2a                	je     8011c8 <string_cpu+0xfb>
+  80119e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8011a1:	25 00 00 00 08       	and    $0x8000000,%eax
+  8011a6:	85 c0                	test   %eax,%eax
+  8011a8:	74 1e                	je     8011c8 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  8011aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011af:	48 b8 a5 10 80 00 00 	movabs $0x8010a5,%rax
+  8011b6:	00 00 00 
+  8011b9:	ff d0                	call   *%rax
+  8011bb:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8011be:	48 83 f8 06          	cmp    $0x6,%rax
+  8011c2:	75 04                	jne    8011c8 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8011c4:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8011c8:	48 ba 18 80 80 00 00 	movabs $0x808018,%rdx
+  8011cf:	00 00 00 
+  8011d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011d5:	89 02                	mov    %eax,(%rdx)
+  8011d7:	48 b8 18 80 80 00 00 	movabs $0x808018,%rax
+  8011de:	00 00 00 
+  8011e1:	8b 00                	mov    (%rax),%eax
+}
+  8011e3:	c9                   	leave
+  8011e4:	c3                   	ret
+
+00000000008011e5 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8011e5:	55                   	push   %rbp
+  8011e6:	48 89 e5             	mov    %rsp,%rbp
+  8011e9:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8011ed:	48 83 ec 60          	sub    $0x60,%rsp
+  8011f1:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8011f6:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8011fb:	83 e0 1f             	and    $0x1f,%eax
+  8011fe:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801202:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801206:	48 f7 d8             	neg    %rax
+  801209:	48 89 c2             	mov    %rax,%rdx
+  80120c:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801211:	48 01 d0             	add    %rdx,%rax
+  801214:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801219:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  80121d:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801223:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801228:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80122c:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801232:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801236:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80123a:	89 c2                	mov    %eax,%edx
+  80123c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801240:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801245:	89 c1                	mov    %eax,%ecx
+  801247:	d3 e6                	shl    %cl,%esi
+  801249:	89 f0                	mov    %esi,%eax
+  80124b:	21 d0                	and    %edx,%eax
+  80124d:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801251:	eb 21                	jmp    801274 <strlen_avx2+0x8f>
+    p += 32;
+  801253:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801259:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80125e:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801262:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801268:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80126c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801270:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801274:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801279:	74 d8                	je     801253 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  80127b:	31 c0                	xor    %eax,%eax
+  80127d:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801283:	48 63 d0             	movslq %eax,%rdx
+  801286:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80128b:	48 01 d0             	add    %rdx,%rax
+  80128e:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801293:	c9                   	leave
+  801294:	c3                   	ret
+
+0000000000801295 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801295:	55                   	push   %rbp
+  801296:	48 89 e5             	mov    %rsp,%rbp
+  801299:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80129d:	48 83 ec 40          	sub    $0x40,%rsp
+  8012a1:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8012a6:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  8012ab:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8012b0:	eb 77                	jmp    801329 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  8012b2:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012b7:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8012bb:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8012bf:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8012c4:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8012c8:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8012cc:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8012d0:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8012d4:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8012d9:	74 3c                	je     801317 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8012db:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8012df:	f7 d0                	not    %eax
+  8012e1:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8012e5:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8012e9:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8012ed:	48 63 d0             	movslq %eax,%rdx
+  8012f0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8012f5:	48 01 d0             	add    %rdx,%rax
+  8012f8:	0f b6 00             	movzbl (%rax),%eax
+  8012fb:	0f b6 c0             	movzbl %al,%eax
+  8012fe:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801302:	48 63 ca             	movslq %edx,%rcx
+  801305:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80130a:	48 01 ca             	add    %rcx,%rdx
+  80130d:	0f b6 12             	movzbl (%rdx),%edx
+  801310:	0f b6 d2             	movzbl %dl,%edx
+  801313:	29 d0                	sub    %edx,%eax
+  801315:	eb 6b                	jmp    801382 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801317:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80131d:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801323:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801329:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80132f:	77 81                	ja     8012b2 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801331:	eb 42                	jmp    801375 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801333:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801338:	0f b6 10             	movzbl (%rax),%edx
+  80133b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801340:	0f b6 00             	movzbl (%rax),%eax
+  801343:	38 c2                	cmp    %al,%dl
+  801345:	74 1c                	je     801363 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801347:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80134c:	0f b6 00             	movzbl (%rax),%eax
+  80134f:	0f b6 c8             	movzbl %al,%ecx
+  801352:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801357:	0f b6 00             	movzbl (%rax),%eax
+  80135a:	0f b6 d0             	movzbl %al,%edx
+  80135d:	89 c8                	mov    %ecx,%eax
+  80135f:	29 d0                	sub    %edx,%eax
+  801361:	eb 1f                	jmp    801382 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801363:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801369:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  80136f:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801375:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80137b:	75 b6                	jne    801333 <memcmp_avx2+0x9e>
+  return 0;
+  80137d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801382:	c9                   	leave
+  801383:	c3                   	ret
+
+0000000000801384 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801384:	55                   	push   %rbp
+  801385:	48 89 e5             	mov    %rsp,%rbp
+  801388:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80138c:	48 83 ec 60          	sub    $0x60,%rsp
+  801390:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801395:	89 f0                	mov    %esi,%eax
+  801397:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80139c:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8013a0:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8013a5:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  8013a9:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8013ae:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8013b4:	eb 47                	jmp    8013fd <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8013b6:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013bb:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8013bf:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8013c3:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8013c9:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8013cd:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013d1:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8013d5:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8013da:	74 15                	je     8013f1 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8013dc:	31 c0                	xor    %eax,%eax
+  8013de:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8013e4:	48 63 d0             	movslq %eax,%rdx
+  8013e7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013ec:	48 01 d0             	add    %rdx,%rax
+  8013ef:	eb 3d                	jmp    80142e <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8013f1:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8013f7:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8013fd:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801403:	77 b1                	ja     8013b6 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801405:	eb 0c                	jmp    801413 <memfind_avx2+0x8f>
+  801407:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80140d:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801413:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801419:	74 0e                	je     801429 <memfind_avx2+0xa5>
+  80141b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801420:	0f b6 00             	movzbl (%rax),%eax
+  801423:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801427:	75 de                	jne    801407 <memfind_avx2+0x83>
+  return s;
+  801429:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  80142e:	c9                   	leave
+  80142f:	c3                   	ret
+
+0000000000801430 <strlen>:
+strlen(const char *s) {
+  801430:	55                   	push   %rbp
+  801431:	48 89 e5             	mov    %rsp,%rbp
+  801434:	48 83 ec 40          	sub    $0x40,%rsp
+  801438:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  80143c:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801440:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801444:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  80144b:	00 00 00 
+  80144e:	ff d0                	call   *%rax
+  801450:	83 e0 02             	and    $0x2,%eax
+  801453:	85 c0                	test   %eax,%eax
+  801455:	74 18                	je     80146f <strlen+0x3f>
+    return strlen_avx2(s);
+  801457:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80145b:	48 89 c7             	mov    %rax,%rdi
+  80145e:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  801465:	00 00 00 
+  801468:	ff d0                	call   *%rax
+  80146a:	e9 82 00 00 00       	jmp    8014f1 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  80146f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801473:	83 e0 0f             	and    $0xf,%eax
+  801476:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801479:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80147c:	48 f7 d8             	neg    %rax
+  80147f:	48 89 c2             	mov    %rax,%rdx
+  801482:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801486:	48 01 d0             	add    %rdx,%rax
+  801489:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80148d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801491:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801495:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80149a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80149e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8014a2:	89 c2                	mov    %eax,%edx
+  8014a4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8014a7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8014ac:	89 c1                	mov    %eax,%ecx
+  8014ae:	d3 e6                	shl    %cl,%esi
+  8014b0:	89 f0                	mov    %esi,%eax
+  8014b2:	21 d0                	and    %edx,%eax
+  8014b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8014b7:	eb 1d                	jmp    8014d6 <strlen+0xa6>
+    p += 16;
+  8014b9:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8014be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014c2:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8014c6:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8014cb:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8014cf:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8014d3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8014d6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8014da:	74 dd                	je     8014b9 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8014dc:	31 c0                	xor    %eax,%eax
+  8014de:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8014e3:	48 63 d0             	movslq %eax,%rdx
+  8014e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014ea:	48 01 d0             	add    %rdx,%rax
+  8014ed:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8014f1:	c9                   	leave
+  8014f2:	c3                   	ret
+
+00000000008014f3 <strnlen>:
+strnlen(const char *s, size_t size) {
+  8014f3:	55                   	push   %rbp
+  8014f4:	48 89 e5             	mov    %rsp,%rbp
+  8014f7:	48 83 ec 20          	sub    $0x20,%rsp
+  8014fb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8014ff:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801503:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80150a:	eb 0e                	jmp    80151a <strnlen+0x27>
+    n++;
+  80150c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801510:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801515:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80151a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80151f:	74 0b                	je     80152c <strnlen+0x39>
+  801521:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801525:	0f b6 00             	movzbl (%rax),%eax
+  801528:	84 c0                	test   %al,%al
+  80152a:	75 e0                	jne    80150c <strnlen+0x19>
+  return n;
+  80152c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80152f:	c9                   	leave
+  801530:	c3                   	ret
+
+0000000000801531 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801531:	55                   	push   %rbp
+  801532:	48 89 e5             	mov    %rsp,%rbp
+  801535:	48 83 ec 20          	sub    $0x20,%rsp
+  801539:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80153d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801541:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801545:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801549:	90                   	nop
+  80154a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80154e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801552:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801556:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80155a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80155e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801562:	0f b6 12             	movzbl (%rdx),%edx
+  801565:	88 10                	mov    %dl,(%rax)
+  801567:	0f b6 00             	movzbl (%rax),%eax
+  80156a:	84 c0                	test   %al,%al
+  80156c:	75 dc                	jne    80154a <strcpy+0x19>
+  return ret;
+  80156e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801572:	c9                   	leave
+  801573:	c3                   	ret
+
+0000000000801574 <strcat>:
+strcat(char *dst, const char *src) {
+  801574:	55                   	push   %rbp
+  801575:	48 89 e5             	mov    %rsp,%rbp
+  801578:	48 83 ec 20          	sub    $0x20,%rsp
+  80157c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801580:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801584:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801588:	48 89 c7             	mov    %rax,%rdi
+  80158b:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  801592:	00 00 00 
+  801595:	ff d0                	call   *%rax
+  801597:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80159a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80159d:	48 63 d0             	movslq %eax,%rdx
+  8015a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015a4:	48 01 c2             	add    %rax,%rdx
+  8015a7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015ab:	48 89 c6             	mov    %rax,%rsi
+  8015ae:	48 89 d7             	mov    %rdx,%rdi
+  8015b1:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  8015b8:	00 00 00 
+  8015bb:	ff d0                	call   *%rax
+  return dst;
+  8015bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+
+00000000008015c3 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	48 83 ec 28          	sub    $0x28,%rsp
+  8015cb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8015cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8015d3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8015d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015db:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8015df:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8015e6:	00 
+  8015e7:	eb 2a                	jmp    801613 <strncpy+0x50>
+    *dst++ = *src;
+  8015e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8015ed:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8015f1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8015f5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8015f9:	0f b6 12             	movzbl (%rdx),%edx
+  8015fc:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8015fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801602:	0f b6 00             	movzbl (%rax),%eax
+  801605:	84 c0                	test   %al,%al
+  801607:	74 05                	je     80160e <strncpy+0x4b>
+      src++;
+  801609:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80160e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801617:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80161b:	72 cc                	jb     8015e9 <strncpy+0x26>
+  return ret;
+  80161d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801621:	c9                   	leave
+  801622:	c3                   	ret
+
+0000000000801623 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801623:	55                   	push   %rbp
+  801624:	48 89 e5             	mov    %rsp,%rbp
+  801627:	48 83 ec 28          	sub    $0x28,%rsp
+  80162b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80162f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801633:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801637:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80163b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  80163f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801644:	74 3d                	je     801683 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801646:	eb 1d                	jmp    801665 <strlcpy+0x42>
+      *dst++ = *src++;
+  801648:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80164c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801650:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801654:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801658:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80165c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801660:	0f b6 12             	movzbl (%rdx),%edx
+  801663:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801665:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  80166a:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80166f:	74 0b                	je     80167c <strlcpy+0x59>
+  801671:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801675:	0f b6 00             	movzbl (%rax),%eax
+  801678:	84 c0                	test   %al,%al
+  80167a:	75 cc                	jne    801648 <strlcpy+0x25>
+    *dst = '\0';
+  80167c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801680:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801683:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801687:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80168b:	c9                   	leave
+  80168c:	c3                   	ret
+
+000000000080168d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80168d:	55                   	push   %rbp
+  80168e:	48 89 e5             	mov    %rsp,%rbp
+  801691:	48 83 ec 30          	sub    $0x30,%rsp
+  801695:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801699:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80169d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8016a1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016a5:	48 89 c7             	mov    %rax,%rdi
+  8016a8:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  8016af:	00 00 00 
+  8016b2:	ff d0                	call   *%rax
+  8016b4:	48 98                	cltq
+  8016b6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8016ba:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016c2:	48 89 d6             	mov    %rdx,%rsi
+  8016c5:	48 89 c7             	mov    %rax,%rdi
+  8016c8:	48 b8 f3 14 80 00 00 	movabs $0x8014f3,%rax
+  8016cf:	00 00 00 
+  8016d2:	ff d0                	call   *%rax
+  8016d4:	48 98                	cltq
+  8016d6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8016da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016de:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8016e2:	75 10                	jne    8016f4 <strlcat+0x67>
+    return maxlen + srclen;
+  8016e4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8016e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016ec:	48 01 d0             	add    %rdx,%rax
+  8016ef:	e9 86 00 00 00       	jmp    80177a <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8016f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016f8:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8016fc:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801700:	73 2b                	jae    80172d <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801702:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801706:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80170a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80170e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801712:	48 01 c1             	add    %rax,%rcx
+  801715:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801719:	48 89 c6             	mov    %rax,%rsi
+  80171c:	48 89 cf             	mov    %rcx,%rdi
+  80171f:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  801726:	00 00 00 
+  801729:	ff d0                	call   *%rax
+  80172b:	eb 42                	jmp    80176f <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  80172d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801731:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801735:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801739:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80173d:	48 01 c1             	add    %rax,%rcx
+  801740:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801744:	48 89 c6             	mov    %rax,%rsi
+  801747:	48 89 cf             	mov    %rcx,%rdi
+  80174a:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  801751:	00 00 00 
+  801754:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801756:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80175a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80175e:	48 01 d0             	add    %rdx,%rax
+  801761:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801765:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801769:	48 01 d0             	add    %rdx,%rax
+  80176c:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  80176f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801777:	48 01 d0             	add    %rdx,%rax
+}
+  80177a:	c9                   	leave
+  80177b:	c3                   	ret
+
+000000000080177c <strcmp>:
+strcmp(const char *p, const char *q) {
+  80177c:	55                   	push   %rbp
+  80177d:	48 89 e5             	mov    %rsp,%rbp
+  801780:	48 83 ec 10          	sub    $0x10,%rsp
+  801784:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801788:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80178c:	eb 0a                	jmp    801798 <strcmp+0x1c>
+    p++, q++;
+  80178e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801793:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801798:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80179c:	0f b6 00             	movzbl (%rax),%eax
+  80179f:	84 c0                	test   %al,%al
+  8017a1:	74 12                	je     8017b5 <strcmp+0x39>
+  8017a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017a7:	0f b6 10             	movzbl (%rax),%edx
+  8017aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ae:	0f b6 00             	movzbl (%rax),%eax
+  8017b1:	38 c2                	cmp    %al,%dl
+  8017b3:	74 d9                	je     80178e <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8017b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017b9:	0f b6 00             	movzbl (%rax),%eax
+  8017bc:	0f b6 d0             	movzbl %al,%edx
+  8017bf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017c3:	0f b6 00             	movzbl (%rax),%eax
+  8017c6:	0f b6 c0             	movzbl %al,%eax
+  8017c9:	29 c2                	sub    %eax,%edx
+  8017cb:	89 d0                	mov    %edx,%eax
+}
+  8017cd:	c9                   	leave
+  8017ce:	c3                   	ret
+
+00000000008017cf <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8017cf:	55                   	push   %rbp
+  8017d0:	48 89 e5             	mov    %rsp,%rbp
+  8017d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8017d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8017db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8017df:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8017e3:	eb 0f                	jmp    8017f4 <strncmp+0x25>
+    n--, p++, q++;
+  8017e5:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8017ea:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8017ef:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8017f4:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8017f9:	74 1d                	je     801818 <strncmp+0x49>
+  8017fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017ff:	0f b6 00             	movzbl (%rax),%eax
+  801802:	84 c0                	test   %al,%al
+  801804:	74 12                	je     801818 <strncmp+0x49>
+  801806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180a:	0f b6 10             	movzbl (%rax),%edx
+  80180d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801811:	0f b6 00             	movzbl (%rax),%eax
+  801814:	38 c2                	cmp    %al,%dl
+  801816:	74 cd                	je     8017e5 <strncmp+0x16>
+  if (n == 0)
+  801818:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80181d:	75 07                	jne    801826 <strncmp+0x57>
+    return 0;
+  80181f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801824:	eb 16                	jmp    80183c <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801826:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80182a:	0f b6 00             	movzbl (%rax),%eax
+  80182d:	0f b6 d0             	movzbl %al,%edx
+  801830:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801834:	0f b6 00             	movzbl (%rax),%eax
+  801837:	0f b6 c0             	movzbl %al,%eax
+  80183a:	29 c2                	sub    %eax,%edx
+}
+  80183c:	89 d0                	mov    %edx,%eax
+  80183e:	c9                   	leave
+  80183f:	c3                   	ret
+
+0000000000801840 <strchr>:
+strchr(const char *s, char c) {
+  801840:	55                   	push   %rbp
+  801841:	48 89 e5             	mov    %rsp,%rbp
+  801844:	48 83 ec 60          	sub    $0x60,%rsp
+  801848:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80184c:	89 f0                	mov    %esi,%eax
+  80184e:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801851:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801855:	83 e0 0f             	and    $0xf,%eax
+  801858:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  80185b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80185e:	48 f7 d8             	neg    %rax
+  801861:	48 89 c2             	mov    %rax,%rdx
+  801864:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801868:	48 01 d0             	add    %rdx,%rax
+  80186b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  80186f:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801873:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801877:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  80187b:	66 0f 6e c0          	movd   %eax,%xmm0
+  80187f:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801883:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801887:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80188c:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801890:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801894:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801898:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80189c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8018a1:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8018a6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8018aa:	89 c2                	mov    %eax,%edx
+  8018ac:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8018b1:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8018b6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8018ba:	09 c2                	or     %eax,%edx
+  8018bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8018bf:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8018c4:	89 c1                	mov    %eax,%ecx
+  8018c6:	d3 e6                	shl    %cl,%esi
+  8018c8:	89 f0                	mov    %esi,%eax
+  8018ca:	21 d0                	and    %edx,%eax
+  8018cc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8018cf:	eb 34                	jmp    801905 <strchr+0xc5>
+    p += 16;
+  8018d1:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8018d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018da:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8018de:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8018e2:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8018e7:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8018ec:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8018f0:	89 c2                	mov    %eax,%edx
+  8018f2:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8018f7:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8018fc:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801900:	09 d0                	or     %edx,%eax
+  801902:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801905:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801909:	74 c6                	je     8018d1 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80190b:	31 c0                	xor    %eax,%eax
+  80190d:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801912:	48 98                	cltq
+  801914:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801918:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80191c:	0f b6 00             	movzbl (%rax),%eax
+  80191f:	84 c0                	test   %al,%al
+  801921:	74 06                	je     801929 <strchr+0xe9>
+  801923:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801927:	eb 05                	jmp    80192e <strchr+0xee>
+  801929:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80192e:	c9                   	leave
+  80192f:	c3                   	ret
+
+0000000000801930 <strfind>:
+strfind(const char *s, char c) {
+  801930:	55                   	push   %rbp
+  801931:	48 89 e5             	mov    %rsp,%rbp
+  801934:	48 83 ec 10          	sub    $0x10,%rsp
+  801938:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80193c:	89 f0                	mov    %esi,%eax
+  80193e:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801941:	eb 11                	jmp    801954 <strfind+0x24>
+    if (*s == c)
+  801943:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801947:	0f b6 00             	movzbl (%rax),%eax
+  80194a:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  80194d:	74 12                	je     801961 <strfind+0x31>
+  for (; *s; s++)
+  80194f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801954:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801958:	0f b6 00             	movzbl (%rax),%eax
+  80195b:	84 c0                	test   %al,%al
+  80195d:	75 e4                	jne    801943 <strfind+0x13>
+  80195f:	eb 01                	jmp    801962 <strfind+0x32>
+      break;
+  801961:	90                   	nop
+  return (char *)s;
+  801962:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+0000000000801968 <memset>:
+memset(void *v, int c, size_t n) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+  80196c:	48 83 ec 38          	sub    $0x38,%rsp
+  801970:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801974:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801977:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  80197b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80197f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801983:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801988:	76 41                	jbe    8019cb <memset+0x63>
+  80198a:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  801991:	00 00 00 
+  801994:	ff d0                	call   *%rax
+  801996:	83 e0 01             	and    $0x1,%eax
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	74 2e                	je     8019cb <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80199d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8019a0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8019a4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8019a8:	48 89 ce             	mov    %rcx,%rsi
+  8019ab:	48 89 f7             	mov    %rsi,%rdi
+  8019ae:	48 89 d1             	mov    %rdx,%rcx
+  8019b1:	fc                   	cld
+  8019b2:	f3 aa                	rep stos %al,%es:(%rdi)
+  8019b4:	48 89 ca             	mov    %rcx,%rdx
+  8019b7:	48 89 fe             	mov    %rdi,%rsi
+  8019ba:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8019be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  8019c2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019c6:	e9 a7 00 00 00       	jmp    801a72 <memset+0x10a>
+  if (n >= 8) {
+  8019cb:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  8019d0:	0f 86 87 00 00 00    	jbe    801a5d <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  8019d6:	eb 16                	jmp    8019ee <memset+0x86>
+      *p++ = c;
+  8019d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019dc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019e0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019e4:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8019e7:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  8019e9:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  8019ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019f2:	83 e0 07             	and    $0x7,%eax
+  8019f5:	48 85 c0             	test   %rax,%rax
+  8019f8:	75 de                	jne    8019d8 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  8019fa:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8019fd:	0f b6 c0             	movzbl %al,%eax
+  801a00:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801a07:	01 01 01 
+  801a0a:	48 0f af c2          	imul   %rdx,%rax
+  801a0e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801a12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a16:	48 c1 e8 03          	shr    $0x3,%rax
+  801a1a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801a1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a22:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801a26:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a2a:	48 89 ce             	mov    %rcx,%rsi
+  801a2d:	48 89 f7             	mov    %rsi,%rdi
+  801a30:	48 89 d1             	mov    %rdx,%rcx
+  801a33:	fc                   	cld
+  801a34:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801a37:	48 89 ca             	mov    %rcx,%rdx
+  801a3a:	48 89 fe             	mov    %rdi,%rsi
+  801a3d:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801a41:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801a45:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801a4a:	eb 11                	jmp    801a5d <memset+0xf5>
+    *p++ = c;
+  801a4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a50:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801a54:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801a58:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801a5b:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801a5d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801a61:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a65:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a69:	48 85 c0             	test   %rax,%rax
+  801a6c:	75 de                	jne    801a4c <memset+0xe4>
+  return v;
+  801a6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801a72:	c9                   	leave
+  801a73:	c3                   	ret
+
+0000000000801a74 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801a74:	55                   	push   %rbp
+  801a75:	48 89 e5             	mov    %rsp,%rbp
+  801a78:	48 83 ec 38          	sub    $0x38,%rsp
+  801a7c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a80:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a84:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801a88:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a8c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801a90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a94:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801a98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a9c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801aa0:	0f 83 da 00 00 00    	jae    801b80 <memmove+0x10c>
+  801aa6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801aaa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801aae:	48 01 d0             	add    %rdx,%rax
+  801ab1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801ab5:	0f 83 c5 00 00 00    	jae    801b80 <memmove+0x10c>
+    s += n;
+  801abb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801abf:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801ac3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ac7:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801acb:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801ad0:	0f 86 94 00 00 00    	jbe    801b6a <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801ad6:	eb 1c                	jmp    801af4 <memmove+0x80>
+        *--d = *--s;
+  801ad8:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801add:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801ae2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae6:	0f b6 10             	movzbl (%rax),%edx
+  801ae9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aed:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801aef:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801af4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801af8:	83 e0 07             	and    $0x7,%eax
+  801afb:	48 85 c0             	test   %rax,%rax
+  801afe:	75 d8                	jne    801ad8 <memmove+0x64>
+      nq = n / 8;
+  801b00:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b04:	48 c1 e8 03          	shr    $0x3,%rax
+  801b08:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801b0c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801b11:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801b16:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801b1b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b1f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801b23:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801b27:	48 89 cf             	mov    %rcx,%rdi
+  801b2a:	48 89 d6             	mov    %rdx,%rsi
+  801b2d:	48 89 c1             	mov    %rax,%rcx
+  801b30:	fd                   	std
+  801b31:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801b34:	fc                   	cld
+  801b35:	48 89 c8             	mov    %rcx,%rax
+  801b38:	48 89 f2             	mov    %rsi,%rdx
+  801b3b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801b3f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b43:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801b47:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801b4c:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801b51:	eb 17                	jmp    801b6a <memmove+0xf6>
+      *--d = *--s;
+  801b53:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801b58:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801b5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b61:	0f b6 10             	movzbl (%rax),%edx
+  801b64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b68:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801b6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b6e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b72:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b76:	48 85 c0             	test   %rax,%rax
+  801b79:	75 d8                	jne    801b53 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801b7b:	e9 f4 00 00 00       	jmp    801c74 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801b80:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801b85:	76 46                	jbe    801bcd <memmove+0x159>
+  801b87:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  801b8e:	00 00 00 
+  801b91:	ff d0                	call   *%rax
+  801b93:	83 e0 01             	and    $0x1,%eax
+  801b96:	85 c0                	test   %eax,%eax
+  801b98:	74 33                	je     801bcd <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801b9a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801b9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ba2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ba6:	48 89 cf             	mov    %rcx,%rdi
+  801ba9:	48 89 d6             	mov    %rdx,%rsi
+  801bac:	48 89 c1             	mov    %rax,%rcx
+  801baf:	fc                   	cld
+  801bb0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801bb2:	48 89 c8             	mov    %rcx,%rax
+  801bb5:	48 89 f2             	mov    %rsi,%rdx
+  801bb8:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801bbc:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bc0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801bc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bc8:	e9 ab 00 00 00       	jmp    801c78 <memmove+0x204>
+    if (n >= 8) {
+  801bcd:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801bd2:	0f 86 8b 00 00 00    	jbe    801c63 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801bd8:	eb 22                	jmp    801bfc <memmove+0x188>
+        *d++ = *s++;
+  801bda:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bde:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801be2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801be6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bea:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801bee:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801bf2:	0f b6 12             	movzbl (%rdx),%edx
+  801bf5:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801bf7:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801bfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c00:	83 e0 07             	and    $0x7,%eax
+  801c03:	48 85 c0             	test   %rax,%rax
+  801c06:	75 d2                	jne    801bda <memmove+0x166>
+      nq = n / 8;
+  801c08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c0c:	48 c1 e8 03          	shr    $0x3,%rax
+  801c10:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801c14:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c18:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c1c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c20:	48 89 cf             	mov    %rcx,%rdi
+  801c23:	48 89 d6             	mov    %rdx,%rsi
+  801c26:	48 89 c1             	mov    %rax,%rcx
+  801c29:	fc                   	cld
+  801c2a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c2d:	48 89 c8             	mov    %rcx,%rax
+  801c30:	48 89 f2             	mov    %rsi,%rdx
+  801c33:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c37:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c3b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801c3f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801c44:	eb 1d                	jmp    801c63 <memmove+0x1ef>
+      *d++ = *s++;
+  801c46:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c4a:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801c4e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801c52:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c56:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801c5a:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801c5e:	0f b6 12             	movzbl (%rdx),%edx
+  801c61:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801c63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c67:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c6b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c6f:	48 85 c0             	test   %rax,%rax
+  801c72:	75 d2                	jne    801c46 <memmove+0x1d2>
+  return dst;
+  801c74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801c78:	c9                   	leave
+  801c79:	c3                   	ret
+
+0000000000801c7a <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801c7a:	55                   	push   %rbp
+  801c7b:	48 89 e5             	mov    %rsp,%rbp
+  801c7e:	48 83 ec 18          	sub    $0x18,%rsp
+  801c82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c86:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801c8a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801c8e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801c92:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c96:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c9a:	48 89 ce             	mov    %rcx,%rsi
+  801c9d:	48 89 c7             	mov    %rax,%rdi
+  801ca0:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  801ca7:	00 00 00 
+  801caa:	ff d0                	call   *%rax
+}
+  801cac:	c9                   	leave
+  801cad:	c3                   	ret
+
+0000000000801cae <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801cae:	55                   	push   %rbp
+  801caf:	48 89 e5             	mov    %rsp,%rbp
+  801cb2:	48 83 ec 40          	sub    $0x40,%rsp
+  801cb6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801cba:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801cbe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801cc2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801cca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cce:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801cd2:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801cd7:	0f 86 a7 00 00 00    	jbe    801d84 <memcmp+0xd6>
+  801cdd:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  801ce4:	00 00 00 
+  801ce7:	ff d0                	call   *%rax
+  801ce9:	83 e0 02             	and    $0x2,%eax
+  801cec:	85 c0                	test   %eax,%eax
+  801cee:	0f 84 90 00 00 00    	je     801d84 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801cf4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801cf8:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cfc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d00:	48 89 ce             	mov    %rcx,%rsi
+  801d03:	48 89 c7             	mov    %rax,%rdi
+  801d06:	48 b8 95 12 80 00 00 	movabs $0x801295,%rax
+  801d0d:	00 00 00 
+  801d10:	ff d0                	call   *%rax
+  801d12:	e9 c2 00 00 00       	jmp    801dd9 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801d17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d1b:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d1f:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801d23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d27:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801d2b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801d2f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801d33:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801d36:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801d3d:	74 36                	je     801d75 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801d3f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d42:	f7 d0                	not    %eax
+  801d44:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801d48:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801d4b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801d4e:	48 63 d0             	movslq %eax,%rdx
+  801d51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d55:	48 01 d0             	add    %rdx,%rax
+  801d58:	0f b6 00             	movzbl (%rax),%eax
+  801d5b:	0f b6 c0             	movzbl %al,%eax
+  801d5e:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801d61:	48 63 ca             	movslq %edx,%rcx
+  801d64:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801d68:	48 01 ca             	add    %rcx,%rdx
+  801d6b:	0f b6 12             	movzbl (%rdx),%edx
+  801d6e:	0f b6 d2             	movzbl %dl,%edx
+  801d71:	29 d0                	sub    %edx,%eax
+  801d73:	eb 64                	jmp    801dd9 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801d75:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801d7a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801d7f:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801d84:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801d89:	77 8c                	ja     801d17 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801d8b:	eb 36                	jmp    801dc3 <memcmp+0x115>
+    if (*s1 != *s2)
+  801d8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d91:	0f b6 10             	movzbl (%rax),%edx
+  801d94:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d98:	0f b6 00             	movzbl (%rax),%eax
+  801d9b:	38 c2                	cmp    %al,%dl
+  801d9d:	74 1a                	je     801db9 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801d9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801da3:	0f b6 00             	movzbl (%rax),%eax
+  801da6:	0f b6 c8             	movzbl %al,%ecx
+  801da9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dad:	0f b6 00             	movzbl (%rax),%eax
+  801db0:	0f b6 d0             	movzbl %al,%edx
+  801db3:	89 c8                	mov    %ecx,%eax
+  801db5:	29 d0                	sub    %edx,%eax
+  801db7:	eb 20                	jmp    801dd9 <memcmp+0x12b>
+    s1++, s2++;
+  801db9:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801dbe:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801dc3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dc7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801dcb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dcf:	48 85 c0             	test   %rax,%rax
+  801dd2:	75 b9                	jne    801d8d <memcmp+0xdf>
+  }
+
+  return 0;
+  801dd4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+
+0000000000801ddb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801ddb:	55                   	push   %rbp
+  801ddc:	48 89 e5             	mov    %rsp,%rbp
+  801ddf:	48 83 ec 50          	sub    $0x50,%rsp
+  801de3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801de7:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801dea:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801dee:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801df2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801df6:	48 01 d0             	add    %rdx,%rax
+  801df9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801dfd:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e00:	66 0f 6e c0          	movd   %eax,%xmm0
+  801e04:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801e08:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801e0c:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801e11:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801e15:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801e1a:	76 73                	jbe    801e8f <memfind+0xb4>
+  801e1c:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  801e23:	00 00 00 
+  801e26:	ff d0                	call   *%rax
+  801e28:	83 e0 02             	and    $0x2,%eax
+  801e2b:	85 c0                	test   %eax,%eax
+  801e2d:	74 60                	je     801e8f <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801e2f:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801e32:	0f b6 c8             	movzbl %al,%ecx
+  801e35:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801e39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e3d:	89 ce                	mov    %ecx,%esi
+  801e3f:	48 89 c7             	mov    %rax,%rdi
+  801e42:	48 b8 84 13 80 00 00 	movabs $0x801384,%rax
+  801e49:	00 00 00 
+  801e4c:	ff d0                	call   *%rax
+  801e4e:	eb 6c                	jmp    801ebc <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801e50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e54:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e58:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801e5c:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801e61:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801e65:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801e69:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801e6c:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801e70:	74 13                	je     801e85 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801e72:	31 c0                	xor    %eax,%eax
+  801e74:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801e79:	48 63 d0             	movslq %eax,%rdx
+  801e7c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e80:	48 01 d0             	add    %rdx,%rax
+  801e83:	eb 37                	jmp    801ebc <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801e85:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801e8a:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801e8f:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801e94:	77 ba                	ja     801e50 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801e96:	eb 13                	jmp    801eab <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801e98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e9c:	0f b6 00             	movzbl (%rax),%eax
+  801e9f:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801ea2:	38 d0                	cmp    %dl,%al
+  801ea4:	74 11                	je     801eb7 <memfind+0xdc>
+  for (; s < ends; s++)
+  801ea6:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801eab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801eaf:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801eb3:	72 e3                	jb     801e98 <memfind+0xbd>
+  801eb5:	eb 01                	jmp    801eb8 <memfind+0xdd>
+      break;
+  801eb7:	90                   	nop
+  return (void *)s;
+  801eb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801ebc:	c9                   	leave
+  801ebd:	c3                   	ret
+
+0000000000801ebe <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801ebe:	55                   	push   %rbp
+  801ebf:	48 89 e5             	mov    %rsp,%rbp
+  801ec2:	48 83 ec 38          	sub    $0x38,%rsp
+  801ec6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801eca:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ece:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801ed1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801ed8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801edf:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801ee0:	eb 05                	jmp    801ee7 <strtol+0x29>
+    s++;
+  801ee2:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801ee7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eeb:	0f b6 00             	movzbl (%rax),%eax
+  801eee:	3c 20                	cmp    $0x20,%al
+  801ef0:	74 f0                	je     801ee2 <strtol+0x24>
+  801ef2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ef6:	0f b6 00             	movzbl (%rax),%eax
+  801ef9:	3c 09                	cmp    $0x9,%al
+  801efb:	74 e5                	je     801ee2 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801efd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f01:	0f b6 00             	movzbl (%rax),%eax
+  801f04:	3c 2b                	cmp    $0x2b,%al
+  801f06:	75 07                	jne    801f0f <strtol+0x51>
+    s++;
+  801f08:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f0d:	eb 17                	jmp    801f26 <strtol+0x68>
+  else if (*s == '-')
+  801f0f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f13:	0f b6 00             	movzbl (%rax),%eax
+  801f16:	3c 2d                	cmp    $0x2d,%al
+  801f18:	75 0c                	jne    801f26 <strtol+0x68>
+    s++, neg = 1;
+  801f1a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f1f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801f26:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f2a:	74 06                	je     801f32 <strtol+0x74>
+  801f2c:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801f30:	75 28                	jne    801f5a <strtol+0x9c>
+  801f32:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f36:	0f b6 00             	movzbl (%rax),%eax
+  801f39:	3c 30                	cmp    $0x30,%al
+  801f3b:	75 1d                	jne    801f5a <strtol+0x9c>
+  801f3d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f41:	48 83 c0 01          	add    $0x1,%rax
+  801f45:	0f b6 00             	movzbl (%rax),%eax
+  801f48:	3c 78                	cmp    $0x78,%al
+  801f4a:	75 0e                	jne    801f5a <strtol+0x9c>
+    s += 2, base = 16;
+  801f4c:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801f51:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801f58:	eb 2c                	jmp    801f86 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801f5a:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f5e:	75 19                	jne    801f79 <strtol+0xbb>
+  801f60:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f64:	0f b6 00             	movzbl (%rax),%eax
+  801f67:	3c 30                	cmp    $0x30,%al
+  801f69:	75 0e                	jne    801f79 <strtol+0xbb>
+    s++, base = 8;
+  801f6b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801f70:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801f77:	eb 0d                	jmp    801f86 <strtol+0xc8>
+  else if (base == 0)
+  801f79:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801f7d:	75 07                	jne    801f86 <strtol+0xc8>
+    base = 10;
+  801f7f:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801f86:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f8a:	0f b6 00             	movzbl (%rax),%eax
+  801f8d:	3c 2f                	cmp    $0x2f,%al
+  801f8f:	7e 1d                	jle    801fae <strtol+0xf0>
+  801f91:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801f95:	0f b6 00             	movzbl (%rax),%eax
+  801f98:	3c 39                	cmp    $0x39,%al
+  801f9a:	7f 12                	jg     801fae <strtol+0xf0>
+      dig = *s - '0';
+  801f9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fa0:	0f b6 00             	movzbl (%rax),%eax
+  801fa3:	0f be c0             	movsbl %al,%eax
+  801fa6:	83 e8 30             	sub    $0x30,%eax
+  801fa9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801fac:	eb 4e                	jmp    801ffc <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801fae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fb2:	0f b6 00             	movzbl (%rax),%eax
+  801fb5:	3c 60                	cmp    $0x60,%al
+  801fb7:	7e 1d                	jle    801fd6 <strtol+0x118>
+  801fb9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fbd:	0f b6 00             	movzbl (%rax),%eax
+  801fc0:	3c 7a                	cmp    $0x7a,%al
+  801fc2:	7f 12                	jg     801fd6 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801fc4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fc8:	0f b6 00             	movzbl (%rax),%eax
+  801fcb:	0f be c0             	movsbl %al,%eax
+  801fce:	83 e8 57             	sub    $0x57,%eax
+  801fd1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801fd4:	eb 26                	jmp    801ffc <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801fd6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fda:	0f b6 00             	movzbl (%rax),%eax
+  801fdd:	3c 40                	cmp    $0x40,%al
+  801fdf:	7e 47                	jle    802028 <strtol+0x16a>
+  801fe1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fe5:	0f b6 00             	movzbl (%rax),%eax
+  801fe8:	3c 5a                	cmp    $0x5a,%al
+  801fea:	7f 3c                	jg     802028 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801fec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ff0:	0f b6 00             	movzbl (%rax),%eax
+  801ff3:	0f be c0             	movsbl %al,%eax
+  801ff6:	83 e8 37             	sub    $0x37,%eax
+  801ff9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801ffc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801fff:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802002:	7d 23                	jge    802027 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802004:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802009:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80200c:	48 98                	cltq
+  80200e:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802013:	48 89 c2             	mov    %rax,%rdx
+  802016:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802019:	48 98                	cltq
+  80201b:	48 01 d0             	add    %rdx,%rax
+  80201e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  802022:	e9 5f ff ff ff       	jmp    801f86 <strtol+0xc8>
+      break;
+  802027:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802028:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80202d:	74 0b                	je     80203a <strtol+0x17c>
+    *endptr = (char *)s;
+  80202f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802033:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802037:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  80203a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80203e:	74 09                	je     802049 <strtol+0x18b>
+  802040:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802044:	48 f7 d8             	neg    %rax
+  802047:	eb 04                	jmp    80204d <strtol+0x18f>
+  802049:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80204d:	c9                   	leave
+  80204e:	c3                   	ret
+
+000000000080204f <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  80204f:	55                   	push   %rbp
+  802050:	48 89 e5             	mov    %rsp,%rbp
+  802053:	53                   	push   %rbx
+  802054:	48 83 ec 48          	sub    $0x48,%rsp
+  802058:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80205c:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802060:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802064:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802068:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80206c:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802070:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802074:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802078:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80207c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802080:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802084:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802088:	4c 89 c3             	mov    %r8,%rbx
+  80208b:	cd 30                	int    $0x30
+  80208d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802091:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802096:	74 46                	je     8020de <syscall+0x8f>
+  802098:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80209d:	7e 3f                	jle    8020de <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80209f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020a7:	49 89 d0             	mov    %rdx,%r8
+  8020aa:	48 89 c1             	mov    %rax,%rcx
+  8020ad:	48 b8 c8 78 80 00 00 	movabs $0x8078c8,%rax
+  8020b4:	00 00 00 
+  8020b7:	48 89 c2             	mov    %rax,%rdx
+  8020ba:	be 22 00 00 00       	mov    $0x22,%esi
+  8020bf:	48 b8 e7 78 80 00 00 	movabs $0x8078e7,%rax
+  8020c6:	00 00 00 
+  8020c9:	48 89 c7             	mov    %rax,%rdi
+  8020cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020d1:	49 b9 62 03 80 00 00 	movabs $0x800362,%r9
+  8020d8:	00 00 00 
+  8020db:	41 ff d1             	call   *%r9
+
+  return ret;
+  8020de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8020e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8020e6:	c9                   	leave
+  8020e7:	c3                   	ret
+
+00000000008020e8 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8020e8:	55                   	push   %rbp
+  8020e9:	48 89 e5             	mov    %rsp,%rbp
+  8020ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8020f4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8020f8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8020fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802100:	48 83 ec 08          	sub    $0x8,%rsp
+  802104:	6a 00                	push   $0x0
+  802106:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80210c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802112:	48 89 d1             	mov    %rdx,%rcx
+  802115:	48 89 c2             	mov    %rax,%rdx
+  802118:	be 00 00 00 00       	mov    $0x0,%esi
+  80211d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802122:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802129:	00 00 00 
+  80212c:	ff d0                	call   *%rax
+  80212e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802132:	90                   	nop
+  802133:	c9                   	leave
+  802134:	c3                   	ret
+
+0000000000802135 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802135:	55                   	push   %rbp
+  802136:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802139:	48 83 ec 08          	sub    $0x8,%rsp
+  80213d:	6a 00                	push   $0x0
+  80213f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802145:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80214b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802150:	ba 00 00 00 00       	mov    $0x0,%edx
+  802155:	be 00 00 00 00       	mov    $0x0,%esi
+  80215a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80215f:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802166:	00 00 00 
+  802169:	ff d0                	call   *%rax
+  80216b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80216f:	c9                   	leave
+  802170:	c3                   	ret
+
+0000000000802171 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802171:	55                   	push   %rbp
+  802172:	48 89 e5             	mov    %rsp,%rbp
+  802175:	48 83 ec 10          	sub    $0x10,%rsp
+  802179:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  80217c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80217f:	48 98                	cltq
+  802181:	48 83 ec 08          	sub    $0x8,%rsp
+  802185:	6a 00                	push   $0x0
+  802187:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80218d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802193:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802198:	48 89 c2             	mov    %rax,%rdx
+  80219b:	be 01 00 00 00       	mov    $0x1,%esi
+  8021a0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021a5:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8021ac:	00 00 00 
+  8021af:	ff d0                	call   *%rax
+  8021b1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021b5:	c9                   	leave
+  8021b6:	c3                   	ret
+
+00000000008021b7 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8021b7:	55                   	push   %rbp
+  8021b8:	48 89 e5             	mov    %rsp,%rbp
+  8021bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8021bf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8021c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021c5:	48 98                	cltq
+  8021c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8021cb:	6a 00                	push   $0x0
+  8021cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021de:	48 89 c2             	mov    %rax,%rdx
+  8021e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e6:	bf 04 00 00 00       	mov    $0x4,%edi
+  8021eb:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8021f2:	00 00 00 
+  8021f5:	ff d0                	call   *%rax
+  8021f7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021fb:	90                   	nop
+  8021fc:	c9                   	leave
+  8021fd:	c3                   	ret
+
+00000000008021fe <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8021fe:	55                   	push   %rbp
+  8021ff:	48 89 e5             	mov    %rsp,%rbp
+  802202:	48 83 ec 20          	sub    $0x20,%rsp
+  802206:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802209:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  80220d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802210:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802213:	b8 05 00 00 00       	mov    $0x5,%eax
+  802218:	cd 30                	int    $0x30
+  80221a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80221e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802222:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802227:	7e 3d                	jle    802266 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802229:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80222d:	49 89 c0             	mov    %rax,%r8
+  802230:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802235:	48 b8 c8 78 80 00 00 	movabs $0x8078c8,%rax
+  80223c:	00 00 00 
+  80223f:	48 89 c2             	mov    %rax,%rdx
+  802242:	be 49 00 00 00       	mov    $0x49,%esi
+  802247:	48 b8 e7 78 80 00 00 	movabs $0x8078e7,%rax
+  80224e:	00 00 00 
+  802251:	48 89 c7             	mov    %rax,%rdi
+  802254:	b8 00 00 00 00       	mov    $0x0,%eax
+  802259:	49 b9 62 03 80 00 00 	movabs $0x800362,%r9
+  802260:	00 00 00 
+  802263:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802266:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80226b:	75 13                	jne    802280 <sys_env_wait+0x82>
+  80226d:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802272:	74 0c                	je     802280 <sys_env_wait+0x82>
+    *status = st;
+  802274:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802278:	89 c2                	mov    %eax,%edx
+  80227a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80227e:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802280:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+
+0000000000802286 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802286:	55                   	push   %rbp
+  802287:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80228a:	48 83 ec 08          	sub    $0x8,%rsp
+  80228e:	6a 00                	push   $0x0
+  802290:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802296:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80229c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ab:	bf 02 00 00 00       	mov    $0x2,%edi
+  8022b0:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8022b7:	00 00 00 
+  8022ba:	ff d0                	call   *%rax
+  8022bc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c0:	c9                   	leave
+  8022c1:	c3                   	ret
+
+00000000008022c2 <sys_yield>:
+
+void
+sys_yield(void) {
+  8022c2:	55                   	push   %rbp
+  8022c3:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8022c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8022ca:	6a 00                	push   $0x0
+  8022cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8022e7:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8022ec:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8022f3:	00 00 00 
+  8022f6:	ff d0                	call   *%rax
+  8022f8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022fc:	90                   	nop
+  8022fd:	c9                   	leave
+  8022fe:	c3                   	ret
+
+00000000008022ff <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8022ff:	55                   	push   %rbp
+  802300:	48 89 e5             	mov    %rsp,%rbp
+  802303:	48 83 ec 20          	sub    $0x20,%rsp
+  802307:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80230a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80230e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802311:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802314:	48 63 c8             	movslq %eax,%rcx
+  802317:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80231b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80231e:	48 98                	cltq
+  802320:	48 83 ec 08          	sub    $0x8,%rsp
+  802324:	6a 00                	push   $0x0
+  802326:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80232c:	49 89 c8             	mov    %rcx,%r8
+  80232f:	48 89 d1             	mov    %rdx,%rcx
+  802332:	48 89 c2             	mov    %rax,%rdx
+  802335:	be 01 00 00 00       	mov    $0x1,%esi
+  80233a:	bf 06 00 00 00       	mov    $0x6,%edi
+  80233f:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+  80234b:	48 83 c4 10          	add    $0x10,%rsp
+  80234f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802352:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802355:	c9                   	leave
+  802356:	c3                   	ret
+
+0000000000802357 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802357:	55                   	push   %rbp
+  802358:	48 89 e5             	mov    %rsp,%rbp
+  80235b:	48 83 ec 20          	sub    $0x20,%rsp
+  80235f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802362:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802366:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802369:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80236d:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802371:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802374:	48 63 c8             	movslq %eax,%rcx
+  802377:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  80237b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80237e:	48 63 f0             	movslq %eax,%rsi
+  802381:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802385:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802388:	48 98                	cltq
+  80238a:	48 83 ec 08          	sub    $0x8,%rsp
+  80238e:	51                   	push   %rcx
+  80238f:	49 89 f9             	mov    %rdi,%r9
+  802392:	49 89 f0             	mov    %rsi,%r8
+  802395:	48 89 d1             	mov    %rdx,%rcx
+  802398:	48 89 c2             	mov    %rax,%rdx
+  80239b:	be 01 00 00 00       	mov    $0x1,%esi
+  8023a0:	bf 07 00 00 00       	mov    $0x7,%edi
+  8023a5:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8023ac:	00 00 00 
+  8023af:	ff d0                	call   *%rax
+  8023b1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023b5:	c9                   	leave
+  8023b6:	c3                   	ret
+
+00000000008023b7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8023b7:	55                   	push   %rbp
+  8023b8:	48 89 e5             	mov    %rsp,%rbp
+  8023bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8023bf:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8023c2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8023c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8023cd:	48 98                	cltq
+  8023cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d3:	6a 00                	push   $0x0
+  8023d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e1:	48 89 d1             	mov    %rdx,%rcx
+  8023e4:	48 89 c2             	mov    %rax,%rdx
+  8023e7:	be 01 00 00 00       	mov    $0x1,%esi
+  8023ec:	bf 08 00 00 00       	mov    $0x8,%edi
+  8023f1:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8023f8:	00 00 00 
+  8023fb:	ff d0                	call   *%rax
+  8023fd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802401:	c9                   	leave
+  802402:	c3                   	ret
+
+0000000000802403 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802403:	55                   	push   %rbp
+  802404:	48 89 e5             	mov    %rsp,%rbp
+  802407:	48 83 ec 10          	sub    $0x10,%rsp
+  80240b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80240e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802411:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802414:	48 63 d0             	movslq %eax,%rdx
+  802417:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80241a:	48 98                	cltq
+  80241c:	48 83 ec 08          	sub    $0x8,%rsp
+  802420:	6a 00                	push   $0x0
+  802422:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802428:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80242e:	48 89 d1             	mov    %rdx,%rcx
+  802431:	48 89 c2             	mov    %rax,%rdx
+  802434:	be 01 00 00 00       	mov    $0x1,%esi
+  802439:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80243e:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802445:	00 00 00 
+  802448:	ff d0                	call   *%rax
+  80244a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80244e:	c9                   	leave
+  80244f:	c3                   	ret
+
+0000000000802450 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802450:	55                   	push   %rbp
+  802451:	48 89 e5             	mov    %rsp,%rbp
+  802454:	48 83 ec 10          	sub    $0x10,%rsp
+  802458:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80245b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  80245f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802463:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802466:	48 98                	cltq
+  802468:	48 83 ec 08          	sub    $0x8,%rsp
+  80246c:	6a 00                	push   $0x0
+  80246e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802474:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80247a:	48 89 d1             	mov    %rdx,%rcx
+  80247d:	48 89 c2             	mov    %rax,%rdx
+  802480:	be 01 00 00 00       	mov    $0x1,%esi
+  802485:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80248a:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802491:	00 00 00 
+  802494:	ff d0                	call   *%rax
+  802496:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249a:	c9                   	leave
+  80249b:	c3                   	ret
+
+000000000080249c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80249c:	55                   	push   %rbp
+  80249d:	48 89 e5             	mov    %rsp,%rbp
+  8024a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024a7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8024ab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024b2:	48 98                	cltq
+  8024b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b8:	6a 00                	push   $0x0
+  8024ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c6:	48 89 d1             	mov    %rdx,%rcx
+  8024c9:	48 89 c2             	mov    %rax,%rdx
+  8024cc:	be 01 00 00 00       	mov    $0x1,%esi
+  8024d1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8024d6:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+  8024e2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e6:	c9                   	leave
+  8024e7:	c3                   	ret
+
+00000000008024e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8024e8:	55                   	push   %rbp
+  8024e9:	48 89 e5             	mov    %rsp,%rbp
+  8024ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8024f0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024f3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024f7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8024fb:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8024fe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802501:	48 63 f0             	movslq %eax,%rsi
+  802504:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802508:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80250c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80250f:	48 98                	cltq
+  802511:	48 83 ec 08          	sub    $0x8,%rsp
+  802515:	6a 00                	push   $0x0
+  802517:	49 89 f1             	mov    %rsi,%r9
+  80251a:	49 89 c8             	mov    %rcx,%r8
+  80251d:	48 89 d1             	mov    %rdx,%rcx
+  802520:	48 89 c2             	mov    %rax,%rdx
+  802523:	be 00 00 00 00       	mov    $0x0,%esi
+  802528:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80252d:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802534:	00 00 00 
+  802537:	ff d0                	call   *%rax
+  802539:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80253d:	c9                   	leave
+  80253e:	c3                   	ret
+
+000000000080253f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  80253f:	55                   	push   %rbp
+  802540:	48 89 e5             	mov    %rsp,%rbp
+  802543:	48 83 ec 10          	sub    $0x10,%rsp
+  802547:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  80254b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80254f:	48 83 ec 08          	sub    $0x8,%rsp
+  802553:	6a 00                	push   $0x0
+  802555:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80255b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802561:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802566:	48 89 c2             	mov    %rax,%rdx
+  802569:	be 01 00 00 00       	mov    $0x1,%esi
+  80256e:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802573:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  80257a:	00 00 00 
+  80257d:	ff d0                	call   *%rax
+  80257f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802583:	c9                   	leave
+  802584:	c3                   	ret
+
+0000000000802585 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802585:	55                   	push   %rbp
+  802586:	48 89 e5             	mov    %rsp,%rbp
+  802589:	48 83 ec 10          	sub    $0x10,%rsp
+  80258d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802591:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802595:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802599:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80259d:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a1:	6a 00                	push   $0x0
+  8025a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025af:	48 89 d1             	mov    %rdx,%rcx
+  8025b2:	48 89 c2             	mov    %rax,%rdx
+  8025b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8025ba:	bf 10 00 00 00       	mov    $0x10,%edi
+  8025bf:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8025c6:	00 00 00 
+  8025c9:	ff d0                	call   *%rax
+  8025cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025cf:	c9                   	leave
+  8025d0:	c3                   	ret
+
+00000000008025d1 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8025d1:	55                   	push   %rbp
+  8025d2:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8025d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8025d9:	6a 00                	push   $0x0
+  8025db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8025f6:	bf 11 00 00 00       	mov    $0x11,%edi
+  8025fb:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802602:	00 00 00 
+  802605:	ff d0                	call   *%rax
+  802607:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80260b:	c9                   	leave
+  80260c:	c3                   	ret
+
+000000000080260d <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80260d:	55                   	push   %rbp
+  80260e:	48 89 e5             	mov    %rsp,%rbp
+  802611:	48 83 ec 10          	sub    $0x10,%rsp
+  802615:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802619:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80261d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802621:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802625:	48 83 ec 08          	sub    $0x8,%rsp
+  802629:	6a 00                	push   $0x0
+  80262b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802631:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802637:	48 89 d1             	mov    %rdx,%rcx
+  80263a:	48 89 c2             	mov    %rax,%rdx
+  80263d:	be 00 00 00 00       	mov    $0x0,%esi
+  802642:	bf 12 00 00 00       	mov    $0x12,%edi
+  802647:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  80264e:	00 00 00 
+  802651:	ff d0                	call   *%rax
+  802653:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802657:	c9                   	leave
+  802658:	c3                   	ret
+
+0000000000802659 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802659:	55                   	push   %rbp
+  80265a:	48 89 e5             	mov    %rsp,%rbp
+  80265d:	48 83 ec 20          	sub    $0x20,%rsp
+  802661:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802665:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802669:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  80266c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80266f:	48 63 c8             	movslq %eax,%rcx
+  802672:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802676:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80267a:	48 83 ec 08          	sub    $0x8,%rsp
+  80267e:	6a 00                	push   $0x0
+  802680:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802686:	49 89 c8             	mov    %rcx,%r8
+  802689:	48 89 d1             	mov    %rdx,%rcx
+  80268c:	48 89 c2             	mov    %rax,%rdx
+  80268f:	be 00 00 00 00       	mov    $0x0,%esi
+  802694:	bf 13 00 00 00       	mov    $0x13,%edi
+  802699:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8026a0:	00 00 00 
+  8026a3:	ff d0                	call   *%rax
+  8026a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026a9:	c9                   	leave
+  8026aa:	c3                   	ret
+
+00000000008026ab <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8026ab:	55                   	push   %rbp
+  8026ac:	48 89 e5             	mov    %rsp,%rbp
+  8026af:	48 83 ec 20          	sub    $0x20,%rsp
+  8026b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026b7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8026ba:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8026be:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8026c2:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8026c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8026cd:	6a 00                	push   $0x0
+  8026cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026d5:	49 89 c8             	mov    %rcx,%r8
+  8026d8:	48 89 d1             	mov    %rdx,%rcx
+  8026db:	48 89 c2             	mov    %rax,%rdx
+  8026de:	be 00 00 00 00       	mov    $0x0,%esi
+  8026e3:	bf 14 00 00 00       	mov    $0x14,%edi
+  8026e8:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8026ef:	00 00 00 
+  8026f2:	ff d0                	call   *%rax
+  8026f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f8:	c9                   	leave
+  8026f9:	c3                   	ret
+
+00000000008026fa <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8026fa:	55                   	push   %rbp
+  8026fb:	48 89 e5             	mov    %rsp,%rbp
+  8026fe:	48 83 ec 10          	sub    $0x10,%rsp
+  802702:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802706:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802709:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80270c:	48 63 d0             	movslq %eax,%rdx
+  80270f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802713:	48 83 ec 08          	sub    $0x8,%rsp
+  802717:	6a 00                	push   $0x0
+  802719:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80271f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802725:	48 89 d1             	mov    %rdx,%rcx
+  802728:	48 89 c2             	mov    %rax,%rdx
+  80272b:	be 00 00 00 00       	mov    $0x0,%esi
+  802730:	bf 15 00 00 00       	mov    $0x15,%edi
+  802735:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  80273c:	00 00 00 
+  80273f:	ff d0                	call   *%rax
+  802741:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802745:	c9                   	leave
+  802746:	c3                   	ret
+
+0000000000802747 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802747:	55                   	push   %rbp
+  802748:	48 89 e5             	mov    %rsp,%rbp
+  80274b:	48 83 ec 20          	sub    $0x20,%rsp
+  80274f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802753:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802756:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802759:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  80275d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802761:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802764:	48 63 c8             	movslq %eax,%rcx
+  802767:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80276a:	48 63 d0             	movslq %eax,%rdx
+  80276d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802771:	48 83 ec 08          	sub    $0x8,%rsp
+  802775:	6a 00                	push   $0x0
+  802777:	49 89 f1             	mov    %rsi,%r9
+  80277a:	49 89 c8             	mov    %rcx,%r8
+  80277d:	48 89 d1             	mov    %rdx,%rcx
+  802780:	48 89 c2             	mov    %rax,%rdx
+  802783:	be 00 00 00 00       	mov    $0x0,%esi
+  802788:	bf 16 00 00 00       	mov    $0x16,%edi
+  80278d:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802794:	00 00 00 
+  802797:	ff d0                	call   *%rax
+  802799:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80279d:	c9                   	leave
+  80279e:	c3                   	ret
+
+000000000080279f <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  80279f:	55                   	push   %rbp
+  8027a0:	48 89 e5             	mov    %rsp,%rbp
+  8027a3:	48 83 ec 30          	sub    $0x30,%rsp
+  8027a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027af:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8027b3:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8027b7:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8027bb:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8027bf:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8027c3:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8027c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d3:	51                   	push   %rcx
+  8027d4:	49 89 f9             	mov    %rdi,%r9
+  8027d7:	49 89 f0             	mov    %rsi,%r8
+  8027da:	48 89 d1             	mov    %rdx,%rcx
+  8027dd:	48 89 c2             	mov    %rax,%rdx
+  8027e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8027e5:	bf 17 00 00 00       	mov    $0x17,%edi
+  8027ea:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+  8027f6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027fa:	c9                   	leave
+  8027fb:	c3                   	ret
+
+00000000008027fc <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  8027fc:	55                   	push   %rbp
+  8027fd:	48 89 e5             	mov    %rsp,%rbp
+  802800:	48 83 ec 10          	sub    $0x10,%rsp
+  802804:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802807:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80280a:	48 98                	cltq
+  80280c:	48 83 ec 08          	sub    $0x8,%rsp
+  802810:	6a 00                	push   $0x0
+  802812:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802818:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80281e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802823:	48 89 c2             	mov    %rax,%rdx
+  802826:	be 00 00 00 00       	mov    $0x0,%esi
+  80282b:	bf 18 00 00 00       	mov    $0x18,%edi
+  802830:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802837:	00 00 00 
+  80283a:	ff d0                	call   *%rax
+  80283c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802840:	90                   	nop
+  802841:	c9                   	leave
+  802842:	c3                   	ret
+
+0000000000802843 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802843:	55                   	push   %rbp
+  802844:	48 89 e5             	mov    %rsp,%rbp
+  802847:	48 83 ec 30          	sub    $0x30,%rsp
+  80284b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80284e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802852:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802856:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802859:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80285c:	48 63 f0             	movslq %eax,%rsi
+  80285f:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802863:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802867:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80286a:	48 98                	cltq
+  80286c:	48 83 ec 08          	sub    $0x8,%rsp
+  802870:	6a 00                	push   $0x0
+  802872:	49 89 f1             	mov    %rsi,%r9
+  802875:	49 89 c8             	mov    %rcx,%r8
+  802878:	48 89 d1             	mov    %rdx,%rcx
+  80287b:	48 89 c2             	mov    %rax,%rdx
+  80287e:	be 01 00 00 00       	mov    $0x1,%esi
+  802883:	bf 19 00 00 00       	mov    $0x19,%edi
+  802888:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  80288f:	00 00 00 
+  802892:	ff d0                	call   *%rax
+  802894:	48 83 c4 10          	add    $0x10,%rsp
+  802898:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80289b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80289e:	c9                   	leave
+  80289f:	c3                   	ret
+
+00000000008028a0 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8028a0:	55                   	push   %rbp
+  8028a1:	48 89 e5             	mov    %rsp,%rbp
+  8028a4:	48 83 ec 20          	sub    $0x20,%rsp
+  8028a8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028ac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028b0:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8028b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028b6:	48 63 c8             	movslq %eax,%rcx
+  8028b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028c1:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c5:	6a 00                	push   $0x0
+  8028c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028cd:	49 89 c8             	mov    %rcx,%r8
+  8028d0:	48 89 d1             	mov    %rdx,%rcx
+  8028d3:	48 89 c2             	mov    %rax,%rdx
+  8028d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8028db:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8028e0:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+  8028ec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028f0:	c9                   	leave
+  8028f1:	c3                   	ret
+
+00000000008028f2 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8028f2:	55                   	push   %rbp
+  8028f3:	48 89 e5             	mov    %rsp,%rbp
+  8028f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8028fa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028fe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802902:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802906:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80290a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80290e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802912:	48 83 ec 08          	sub    $0x8,%rsp
+  802916:	6a 00                	push   $0x0
+  802918:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291e:	49 89 c8             	mov    %rcx,%r8
+  802921:	48 89 d1             	mov    %rdx,%rcx
+  802924:	48 89 c2             	mov    %rax,%rdx
+  802927:	be 01 00 00 00       	mov    $0x1,%esi
+  80292c:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802931:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+  80293d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802941:	c9                   	leave
+  802942:	c3                   	ret
+
+0000000000802943 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802943:	55                   	push   %rbp
+  802944:	48 89 e5             	mov    %rsp,%rbp
+  802947:	48 83 ec 30          	sub    $0x30,%rsp
+  80294b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80294f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802953:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802956:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  80295a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80295e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802961:	48 63 c8             	movslq %eax,%rcx
+  802964:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802968:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80296c:	48 83 ec 08          	sub    $0x8,%rsp
+  802970:	6a 00                	push   $0x0
+  802972:	49 89 f1             	mov    %rsi,%r9
+  802975:	49 89 c8             	mov    %rcx,%r8
+  802978:	48 89 d1             	mov    %rdx,%rcx
+  80297b:	48 89 c2             	mov    %rax,%rdx
+  80297e:	be 01 00 00 00       	mov    $0x1,%esi
+  802983:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802988:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  80298f:	00 00 00 
+  802992:	ff d0                	call   *%rax
+  802994:	48 83 c4 10          	add    $0x10,%rsp
+  802998:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80299b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80299e:	c9                   	leave
+  80299f:	c3                   	ret
+
+00000000008029a0 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  8029a0:	55                   	push   %rbp
+  8029a1:	48 89 e5             	mov    %rsp,%rbp
+  8029a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8029a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  8029ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029ae:	48 98                	cltq
+  8029b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b4:	6a 00                	push   $0x0
+  8029b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8029c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c7:	48 89 c2             	mov    %rax,%rdx
+  8029ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8029cf:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  8029d4:	48 b8 4f 20 80 00 00 	movabs $0x80204f,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+  8029e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e4:	c9                   	leave
+  8029e5:	c3                   	ret
+
+00000000008029e6 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  8029e6:	55                   	push   %rbp
+  8029e7:	48 89 e5             	mov    %rsp,%rbp
+  8029ea:	48 83 ec 40          	sub    $0x40,%rsp
+  8029ee:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  8029f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029f6:	48 8b 00             	mov    (%rax),%rax
+  8029f9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  8029fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a01:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802a05:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802a09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a0d:	83 e0 02             	and    $0x2,%eax
+  802a10:	48 85 c0             	test   %rax,%rax
+  802a13:	74 25                	je     802a3a <pgfault+0x54>
+  802a15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a19:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a1d:	48 89 c2             	mov    %rax,%rdx
+  802a20:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a27:	01 00 00 
+  802a2a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a2e:	83 e0 02             	and    $0x2,%eax
+  802a31:	48 85 c0             	test   %rax,%rax
+  802a34:	0f 85 fe 01 00 00    	jne    802c38 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802a3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802a3e:	83 e0 02             	and    $0x2,%eax
+  802a41:	48 85 c0             	test   %rax,%rax
+  802a44:	74 23                	je     802a69 <pgfault+0x83>
+  802a46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a4a:	48 c1 e8 0c          	shr    $0xc,%rax
+  802a4e:	48 89 c2             	mov    %rax,%rdx
+  802a51:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802a58:	01 00 00 
+  802a5b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802a5f:	25 00 08 00 00       	and    $0x800,%eax
+  802a64:	48 85 c0             	test   %rax,%rax
+  802a67:	75 3f                	jne    802aa8 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802a69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a6d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a71:	49 89 d0             	mov    %rdx,%r8
+  802a74:	48 89 c1             	mov    %rax,%rcx
+  802a77:	48 b8 f8 78 80 00 00 	movabs $0x8078f8,%rax
+  802a7e:	00 00 00 
+  802a81:	48 89 c2             	mov    %rax,%rdx
+  802a84:	be 26 00 00 00       	mov    $0x26,%esi
+  802a89:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  802a90:	00 00 00 
+  802a93:	48 89 c7             	mov    %rax,%rdi
+  802a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9b:	49 b9 62 03 80 00 00 	movabs $0x800362,%r9
+  802aa2:	00 00 00 
+  802aa5:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802aa8:	48 b8 d9 63 80 00 00 	movabs $0x8063d9,%rax
+  802aaf:	00 00 00 
+  802ab2:	ff d0                	call   *%rax
+  802ab4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802ab8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802abc:	ba 07 00 00 00       	mov    $0x7,%edx
+  802ac1:	48 89 c6             	mov    %rax,%rsi
+  802ac4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ac9:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  802ad0:	00 00 00 
+  802ad3:	ff d0                	call   *%rax
+  802ad5:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802ad8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802adc:	79 36                	jns    802b14 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802ade:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ae1:	89 c1                	mov    %eax,%ecx
+  802ae3:	48 b8 38 79 80 00 00 	movabs $0x807938,%rax
+  802aea:	00 00 00 
+  802aed:	48 89 c2             	mov    %rax,%rdx
+  802af0:	be 35 00 00 00       	mov    $0x35,%esi
+  802af5:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  802afc:	00 00 00 
+  802aff:	48 89 c7             	mov    %rax,%rdi
+  802b02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b07:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  802b0e:	00 00 00 
+  802b11:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802b14:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b18:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802b1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b20:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b26:	48 89 c1             	mov    %rax,%rcx
+  802b29:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b2d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b32:	48 89 ce             	mov    %rcx,%rsi
+  802b35:	48 89 c7             	mov    %rax,%rdi
+  802b38:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  802b3f:	00 00 00 
+  802b42:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802b44:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b48:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b4c:	48 89 c2             	mov    %rax,%rdx
+  802b4f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b56:	01 00 00 
+  802b59:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b5d:	25 00 08 00 00       	and    $0x800,%eax
+  802b62:	48 85 c0             	test   %rax,%rax
+  802b65:	74 7a                	je     802be1 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802b67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b6b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802b6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b73:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b79:	48 89 c2             	mov    %rax,%rdx
+  802b7c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802b80:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802b86:	48 89 d1             	mov    %rdx,%rcx
+  802b89:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8e:	48 89 c6             	mov    %rax,%rsi
+  802b91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b96:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802b9d:	00 00 00 
+  802ba0:	ff d0                	call   *%rax
+  802ba2:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802ba5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802ba9:	79 36                	jns    802be1 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802bab:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802bae:	89 c1                	mov    %eax,%ecx
+  802bb0:	48 b8 60 79 80 00 00 	movabs $0x807960,%rax
+  802bb7:	00 00 00 
+  802bba:	48 89 c2             	mov    %rax,%rdx
+  802bbd:	be 42 00 00 00       	mov    $0x42,%esi
+  802bc2:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  802bc9:	00 00 00 
+  802bcc:	48 89 c7             	mov    %rax,%rdi
+  802bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd4:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  802bdb:	00 00 00 
+  802bde:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802be1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802be5:	48 89 c6             	mov    %rax,%rsi
+  802be8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bed:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  802bf4:	00 00 00 
+  802bf7:	ff d0                	call   *%rax
+  802bf9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802bfc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c00:	79 37                	jns    802c39 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802c02:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c05:	89 c1                	mov    %eax,%ecx
+  802c07:	48 b8 88 79 80 00 00 	movabs $0x807988,%rax
+  802c0e:	00 00 00 
+  802c11:	48 89 c2             	mov    %rax,%rdx
+  802c14:	be 46 00 00 00       	mov    $0x46,%esi
+  802c19:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  802c20:	00 00 00 
+  802c23:	48 89 c7             	mov    %rax,%rdi
+  802c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c2b:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  802c32:	00 00 00 
+  802c35:	41 ff d0             	call   *%r8
+    return;
+  802c38:	90                   	nop
+  }
+}
+  802c39:	c9                   	leave
+  802c3a:	c3                   	ret
+
+0000000000802c3b <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802c3b:	55                   	push   %rbp
+  802c3c:	48 89 e5             	mov    %rsp,%rbp
+  802c3f:	48 83 ec 30          	sub    $0x30,%rsp
+  802c43:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802c46:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802c4a:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802c51:	01 00 00 
+  802c54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c58:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c5c:	25 07 0e 00 00       	and    $0xe07,%eax
+  802c61:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802c65:	48 b8 86 22 80 00 00 	movabs $0x802286,%rax
+  802c6c:	00 00 00 
+  802c6f:	ff d0                	call   *%rax
+  802c71:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802c74:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c78:	48 c1 e0 0c          	shl    $0xc,%rax
+  802c7c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802c80:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802c87:	01 00 00 
+  802c8a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c8e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802c92:	25 00 04 00 00       	and    $0x400,%eax
+  802c97:	48 85 c0             	test   %rax,%rax
+  802c9a:	74 7b                	je     802d17 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802c9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ca0:	89 c1                	mov    %eax,%ecx
+  802ca2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ca6:	48 c1 e0 0c          	shl    $0xc,%rax
+  802caa:	48 89 c2             	mov    %rax,%rdx
+  802cad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cb1:	48 c1 e0 0c          	shl    $0xc,%rax
+  802cb5:	48 89 c6             	mov    %rax,%rsi
+  802cb8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802cbb:	41 89 c8             	mov    %ecx,%r8d
+  802cbe:	48 89 d1             	mov    %rdx,%rcx
+  802cc1:	89 c2                	mov    %eax,%edx
+  802cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc8:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+  802cd4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802cd7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802cdb:	0f 89 da 00 00 00    	jns    802dbb <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802ce1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ce4:	89 c1                	mov    %eax,%ecx
+  802ce6:	48 b8 b0 79 80 00 00 	movabs $0x8079b0,%rax
+  802ced:	00 00 00 
+  802cf0:	48 89 c2             	mov    %rax,%rdx
+  802cf3:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802cf8:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  802cff:	00 00 00 
+  802d02:	48 89 c7             	mov    %rax,%rdi
+  802d05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0a:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  802d11:	00 00 00 
+  802d14:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802d17:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d1b:	25 02 08 00 00       	and    $0x802,%eax
+  802d20:	48 85 c0             	test   %rax,%rax
+  802d23:	74 6e                	je     802d93 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802d25:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d29:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802d2f:	80 cc 08             	or     $0x8,%ah
+  802d32:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802d36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d3a:	89 c7                	mov    %eax,%edi
+  802d3c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802d40:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802d43:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802d47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d4a:	41 89 f8             	mov    %edi,%r8d
+  802d4d:	89 c7                	mov    %eax,%edi
+  802d4f:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802d56:	00 00 00 
+  802d59:	ff d0                	call   *%rax
+  802d5b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802d5e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d62:	79 05                	jns    802d69 <duppage+0x12e>
+      return r;
+  802d64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d67:	eb 55                	jmp    802dbe <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802d69:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d6d:	89 c7                	mov    %eax,%edi
+  802d6f:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802d73:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802d76:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802d7a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d7d:	41 89 f8             	mov    %edi,%r8d
+  802d80:	89 c7                	mov    %eax,%edi
+  802d82:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802d89:	00 00 00 
+  802d8c:	ff d0                	call   *%rax
+  802d8e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d91:	eb 28                	jmp    802dbb <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802d93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d97:	89 c7                	mov    %eax,%edi
+  802d99:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802d9d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802da0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802da4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802da7:	41 89 f8             	mov    %edi,%r8d
+  802daa:	89 c7                	mov    %eax,%edi
+  802dac:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+  802db8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802dbb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802dbe:	c9                   	leave
+  802dbf:	c3                   	ret
+
+0000000000802dc0 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802dc0:	55                   	push   %rbp
+  802dc1:	48 89 e5             	mov    %rsp,%rbp
+  802dc4:	48 83 ec 20          	sub    $0x20,%rsp
+  802dc8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802dcb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802dcf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802dd3:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dd7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802ddb:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802de2:	01 00 00 
+  802de5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802de9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ded:	25 00 08 00 00       	and    $0x800,%eax
+  802df2:	48 85 c0             	test   %rax,%rax
+  802df5:	74 0d                	je     802e04 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802df7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802dfb:	0f b6 10             	movzbl (%rax),%edx
+  802dfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e02:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802e04:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802e0b:	01 00 00 
+  802e0e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e12:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e16:	25 07 0e 00 00       	and    $0xe07,%eax
+  802e1b:	89 c6                	mov    %eax,%esi
+  802e1d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802e21:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e28:	41 89 f0             	mov    %esi,%r8d
+  802e2b:	48 89 c6             	mov    %rax,%rsi
+  802e2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e33:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+}
+  802e3f:	c9                   	leave
+  802e40:	c3                   	ret
+
+0000000000802e41 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802e41:	55                   	push   %rbp
+  802e42:	48 89 e5             	mov    %rsp,%rbp
+  802e45:	48 83 ec 40          	sub    $0x40,%rsp
+  802e49:	89 f8                	mov    %edi,%eax
+  802e4b:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802e4e:	48 b8 e6 29 80 00 00 	movabs $0x8029e6,%rax
+  802e55:	00 00 00 
+  802e58:	48 89 c7             	mov    %rax,%rdi
+  802e5b:	48 b8 8b 68 80 00 00 	movabs $0x80688b,%rax
+  802e62:	00 00 00 
+  802e65:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802e67:	b8 09 00 00 00       	mov    $0x9,%eax
+  802e6c:	cd 30                	int    $0x30
+  802e6e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802e71:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802e74:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802e77:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e7b:	79 36                	jns    802eb3 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802e7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e80:	89 c1                	mov    %eax,%ecx
+  802e82:	48 b8 db 79 80 00 00 	movabs $0x8079db,%rax
+  802e89:	00 00 00 
+  802e8c:	48 89 c2             	mov    %rax,%rdx
+  802e8f:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802e94:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  802e9b:	00 00 00 
+  802e9e:	48 89 c7             	mov    %rax,%rdi
+  802ea1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea6:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  802ead:	00 00 00 
+  802eb0:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802eb3:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802eb7:	75 0a                	jne    802ec3 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebe:	e9 d3 02 00 00       	jmp    803196 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802ec3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802eca:	00 
+  802ecb:	e9 7a 01 00 00       	jmp    80304a <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802ed0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ed4:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ed8:	48 c1 e8 27          	shr    $0x27,%rax
+  802edc:	48 89 c2             	mov    %rax,%rdx
+  802edf:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802ee6:	01 00 00 
+  802ee9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eed:	83 e0 01             	and    $0x1,%eax
+  802ef0:	48 85 c0             	test   %rax,%rax
+  802ef3:	0f 84 4c 01 00 00    	je     803045 <fork_common+0x204>
+  802ef9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802efd:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f01:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f05:	48 89 c2             	mov    %rax,%rdx
+  802f08:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802f0f:	01 00 00 
+  802f12:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f16:	83 e0 01             	and    $0x1,%eax
+  802f19:	48 85 c0             	test   %rax,%rax
+  802f1c:	0f 84 23 01 00 00    	je     803045 <fork_common+0x204>
+  802f22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f26:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f2a:	48 c1 e8 15          	shr    $0x15,%rax
+  802f2e:	48 89 c2             	mov    %rax,%rdx
+  802f31:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802f38:	01 00 00 
+  802f3b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802f3f:	83 e0 01             	and    $0x1,%eax
+  802f42:	48 85 c0             	test   %rax,%rax
+  802f45:	0f 84 fa 00 00 00    	je     803045 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  802f4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f4f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f53:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802f57:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f5b:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  802f62:	00 00 00 
+  802f65:	48 39 c2             	cmp    %rax,%rdx
+  802f68:	0f 82 d7 00 00 00    	jb     803045 <fork_common+0x204>
+  802f6e:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  802f75:	00 00 00 
+  802f78:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  802f7c:	0f 84 c3 00 00 00    	je     803045 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802f82:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f86:	48 89 c7             	mov    %rax,%rdi
+  802f89:	48 b8 95 63 80 00 00 	movabs $0x806395,%rax
+  802f90:	00 00 00 
+  802f93:	ff d0                	call   *%rax
+  802f95:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  802f98:	84 c0                	test   %al,%al
+  802f9a:	0f 84 a5 00 00 00    	je     803045 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  802fa0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fa4:	48 c1 e8 0c          	shr    $0xc,%rax
+  802fa8:	48 89 c2             	mov    %rax,%rdx
+  802fab:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802fb2:	01 00 00 
+  802fb5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802fb9:	83 e0 01             	and    $0x1,%eax
+  802fbc:	48 85 c0             	test   %rax,%rax
+  802fbf:	0f 84 80 00 00 00    	je     803045 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  802fc5:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  802fc9:	74 4a                	je     803015 <fork_common+0x1d4>
+  802fcb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fcf:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  802fd6:	00 00 00 
+  802fd9:	48 39 c2             	cmp    %rax,%rdx
+  802fdc:	73 13                	jae    802ff1 <fork_common+0x1b0>
+  802fde:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fe2:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  802fe9:	00 00 00 
+  802fec:	48 39 c2             	cmp    %rax,%rdx
+  802fef:	73 24                	jae    803015 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  802ff1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ff5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ff9:	48 89 c2             	mov    %rax,%rdx
+  802ffc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802fff:	48 89 d6             	mov    %rdx,%rsi
+  803002:	89 c7                	mov    %eax,%edi
+  803004:	48 b8 c0 2d 80 00 00 	movabs $0x802dc0,%rax
+  80300b:	00 00 00 
+  80300e:	ff d0                	call   *%rax
+  803010:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803013:	eb 22                	jmp    803037 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  803015:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803019:	48 c1 e8 0c          	shr    $0xc,%rax
+  80301d:	48 89 c2             	mov    %rax,%rdx
+  803020:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803023:	48 89 d6             	mov    %rdx,%rsi
+  803026:	89 c7                	mov    %eax,%edi
+  803028:	48 b8 3b 2c 80 00 00 	movabs $0x802c3b,%rax
+  80302f:	00 00 00 
+  803032:	ff d0                	call   *%rax
+  803034:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  803037:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80303b:	79 08                	jns    803045 <fork_common+0x204>
+            return r;
+  80303d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803040:	e9 51 01 00 00       	jmp    803196 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  803045:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80304a:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  803051:	07 
+  803052:	0f 86 78 fe ff ff    	jbe    802ed0 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  803058:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80305f:	00 00 00 
+  803062:	8b 40 04             	mov    0x4(%rax),%eax
+  803065:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80306a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803071:	00 00 00 
+  803074:	48 98                	cltq
+  803076:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80307d:	48 01 d0             	add    %rdx,%rax
+  803080:	48 05 00 01 00 00    	add    $0x100,%rax
+  803086:	48 8b 10             	mov    (%rax),%rdx
+  803089:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80308c:	48 89 d6             	mov    %rdx,%rsi
+  80308f:	89 c7                	mov    %eax,%edi
+  803091:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  803098:	00 00 00 
+  80309b:	ff d0                	call   *%rax
+  80309d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030a0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030a4:	79 36                	jns    8030dc <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  8030a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030a9:	89 c1                	mov    %eax,%ecx
+  8030ab:	48 b8 f0 79 80 00 00 	movabs $0x8079f0,%rax
+  8030b2:	00 00 00 
+  8030b5:	48 89 c2             	mov    %rax,%rdx
+  8030b8:	be be 00 00 00       	mov    $0xbe,%esi
+  8030bd:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  8030c4:	00 00 00 
+  8030c7:	48 89 c7             	mov    %rax,%rdi
+  8030ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030cf:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  8030d6:	00 00 00 
+  8030d9:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  8030dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8030df:	ba 02 00 00 00       	mov    $0x2,%edx
+  8030e4:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8030eb:	00 00 00 
+  8030ee:	48 89 ce             	mov    %rcx,%rsi
+  8030f1:	89 c7                	mov    %eax,%edi
+  8030f3:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  8030fa:	00 00 00 
+  8030fd:	ff d0                	call   *%rax
+  8030ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803102:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803106:	79 36                	jns    80313e <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803108:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80310b:	89 c1                	mov    %eax,%ecx
+  80310d:	48 b8 20 7a 80 00 00 	movabs $0x807a20,%rax
+  803114:	00 00 00 
+  803117:	48 89 c2             	mov    %rax,%rdx
+  80311a:	be c1 00 00 00       	mov    $0xc1,%esi
+  80311f:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  803126:	00 00 00 
+  803129:	48 89 c7             	mov    %rax,%rdi
+  80312c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803131:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  803138:	00 00 00 
+  80313b:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  80313e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803141:	be 02 00 00 00       	mov    $0x2,%esi
+  803146:	89 c7                	mov    %eax,%edi
+  803148:	48 b8 03 24 80 00 00 	movabs $0x802403,%rax
+  80314f:	00 00 00 
+  803152:	ff d0                	call   *%rax
+  803154:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803157:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80315b:	79 36                	jns    803193 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  80315d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803160:	89 c1                	mov    %eax,%ecx
+  803162:	48 b8 40 7a 80 00 00 	movabs $0x807a40,%rax
+  803169:	00 00 00 
+  80316c:	48 89 c2             	mov    %rax,%rdx
+  80316f:	be d4 00 00 00       	mov    $0xd4,%esi
+  803174:	48 b8 26 79 80 00 00 	movabs $0x807926,%rax
+  80317b:	00 00 00 
+  80317e:	48 89 c7             	mov    %rax,%rdi
+  803181:	b8 00 00 00 00       	mov    $0x0,%eax
+  803186:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  80318d:	00 00 00 
+  803190:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803193:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803196:	c9                   	leave
+  803197:	c3                   	ret
+
+0000000000803198 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803198:	55                   	push   %rbp
+  803199:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  80319c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a1:	48 b8 41 2e 80 00 00 	movabs $0x802e41,%rax
+  8031a8:	00 00 00 
+  8031ab:	ff d0                	call   *%rax
+}
+  8031ad:	5d                   	pop    %rbp
+  8031ae:	c3                   	ret
+
+00000000008031af <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  8031af:	55                   	push   %rbp
+  8031b0:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  8031b3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8031b8:	48 b8 41 2e 80 00 00 	movabs $0x802e41,%rax
+  8031bf:	00 00 00 
+  8031c2:	ff d0                	call   *%rax
+}
+  8031c4:	5d                   	pop    %rbp
+  8031c5:	c3                   	ret
+
+00000000008031c6 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8031c6:	55                   	push   %rbp
+  8031c7:	48 89 e5             	mov    %rsp,%rbp
+  8031ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8031d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031d6:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8031dd:	ff ff ff 
+  8031e0:	48 01 d0             	add    %rdx,%rax
+  8031e3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8031e7:	c9                   	leave
+  8031e8:	c3                   	ret
+
+00000000008031e9 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8031e9:	55                   	push   %rbp
+  8031ea:	48 89 e5             	mov    %rsp,%rbp
+  8031ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8031f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8031f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031f9:	48 89 c7             	mov    %rax,%rdi
+  8031fc:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  803203:	00 00 00 
+  803206:	ff d0                	call   *%rax
+  803208:	48 05 01 68 00 00    	add    $0x6801,%rax
+  80320e:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  803212:	c9                   	leave
+  803213:	c3                   	ret
+
+0000000000803214 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803214:	55                   	push   %rbp
+  803215:	48 89 e5             	mov    %rsp,%rbp
+  803218:	48 83 ec 18          	sub    $0x18,%rsp
+  80321c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  803220:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803227:	e9 ae 00 00 00       	jmp    8032da <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  80322c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80322f:	c1 e0 0c             	shl    $0xc,%eax
+  803232:	48 98                	cltq
+  803234:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803239:	48 01 d0             	add    %rdx,%rax
+  80323c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803240:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803244:	48 c1 e8 27          	shr    $0x27,%rax
+  803248:	48 89 c2             	mov    %rax,%rdx
+  80324b:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803252:	01 00 00 
+  803255:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803259:	83 e0 01             	and    $0x1,%eax
+  80325c:	48 85 c0             	test   %rax,%rax
+  80325f:	74 63                	je     8032c4 <fd_alloc+0xb0>
+  803261:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803265:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803269:	48 89 c2             	mov    %rax,%rdx
+  80326c:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803273:	01 00 00 
+  803276:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80327a:	83 e0 01             	and    $0x1,%eax
+  80327d:	48 85 c0             	test   %rax,%rax
+  803280:	74 42                	je     8032c4 <fd_alloc+0xb0>
+  803282:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803286:	48 c1 e8 15          	shr    $0x15,%rax
+  80328a:	48 89 c2             	mov    %rax,%rdx
+  80328d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803294:	01 00 00 
+  803297:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80329b:	83 e0 01             	and    $0x1,%eax
+  80329e:	48 85 c0             	test   %rax,%rax
+  8032a1:	74 21                	je     8032c4 <fd_alloc+0xb0>
+  8032a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032a7:	48 c1 e8 0c          	shr    $0xc,%rax
+  8032ab:	48 89 c2             	mov    %rax,%rdx
+  8032ae:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8032b5:	01 00 00 
+  8032b8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032bc:	83 e0 01             	and    $0x1,%eax
+  8032bf:	48 85 c0             	test   %rax,%rax
+  8032c2:	75 12                	jne    8032d6 <fd_alloc+0xc2>
+      *fd_store = fd;
+  8032c4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032c8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8032cc:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8032cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032d4:	eb 1e                	jmp    8032f4 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  8032d6:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8032da:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8032de:	0f 8e 48 ff ff ff    	jle    80322c <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8032e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032e8:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8032ef:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8032f4:	c9                   	leave
+  8032f5:	c3                   	ret
+
+00000000008032f6 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8032f6:	55                   	push   %rbp
+  8032f7:	48 89 e5             	mov    %rsp,%rbp
+  8032fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8032fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803301:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803305:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803309:	78 06                	js     803311 <fd_lookup+0x1b>
+  80330b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80330f:	7e 0a                	jle    80331b <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803311:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803316:	e9 af 00 00 00       	jmp    8033ca <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80331b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80331e:	c1 e0 0c             	shl    $0xc,%eax
+  803321:	48 98                	cltq
+  803323:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803328:	48 01 d0             	add    %rdx,%rax
+  80332b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80332f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803333:	48 c1 e8 27          	shr    $0x27,%rax
+  803337:	48 89 c2             	mov    %rax,%rdx
+  80333a:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803341:	01 00 00 
+  803344:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803348:	83 e0 01             	and    $0x1,%eax
+  80334b:	48 85 c0             	test   %rax,%rax
+  80334e:	74 63                	je     8033b3 <fd_lookup+0xbd>
+  803350:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803354:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803358:	48 89 c2             	mov    %rax,%rdx
+  80335b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803362:	01 00 00 
+  803365:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803369:	83 e0 01             	and    $0x1,%eax
+  80336c:	48 85 c0             	test   %rax,%rax
+  80336f:	74 42                	je     8033b3 <fd_lookup+0xbd>
+  803371:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803375:	48 c1 e8 15          	shr    $0x15,%rax
+  803379:	48 89 c2             	mov    %rax,%rdx
+  80337c:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803383:	01 00 00 
+  803386:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80338a:	83 e0 01             	and    $0x1,%eax
+  80338d:	48 85 c0             	test   %rax,%rax
+  803390:	74 21                	je     8033b3 <fd_lookup+0xbd>
+  803392:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803396:	48 c1 e8 0c          	shr    $0xc,%rax
+  80339a:	48 89 c2             	mov    %rax,%rdx
+  80339d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8033a4:	01 00 00 
+  8033a7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033ab:	83 e0 01             	and    $0x1,%eax
+  8033ae:	48 85 c0             	test   %rax,%rax
+  8033b1:	75 07                	jne    8033ba <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8033b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033b8:	eb 10                	jmp    8033ca <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8033ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8033be:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033c2:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8033c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ca:	c9                   	leave
+  8033cb:	c3                   	ret
+
+00000000008033cc <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8033cc:	55                   	push   %rbp
+  8033cd:	48 89 e5             	mov    %rsp,%rbp
+  8033d0:	48 83 ec 30          	sub    $0x30,%rsp
+  8033d4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8033d8:	89 f0                	mov    %esi,%eax
+  8033da:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8033dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8033e1:	48 89 c7             	mov    %rax,%rdi
+  8033e4:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  8033eb:	00 00 00 
+  8033ee:	ff d0                	call   *%rax
+  8033f0:	89 c2                	mov    %eax,%edx
+  8033f2:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8033f6:	48 89 c6             	mov    %rax,%rsi
+  8033f9:	89 d7                	mov    %edx,%edi
+  8033fb:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  803402:	00 00 00 
+  803405:	ff d0                	call   *%rax
+  803407:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80340a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80340e:	78 0a                	js     80341a <fd_close+0x4e>
+  803410:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803414:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803418:	74 12                	je     80342c <fd_close+0x60>
+    return (must_exist ? r : 0);
+  80341a:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  80341e:	74 05                	je     803425 <fd_close+0x59>
+  803420:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803423:	eb 70                	jmp    803495 <fd_close+0xc9>
+  803425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80342a:	eb 69                	jmp    803495 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80342c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803430:	8b 00                	mov    (%rax),%eax
+  803432:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803436:	48 89 d6             	mov    %rdx,%rsi
+  803439:	89 c7                	mov    %eax,%edi
+  80343b:	48 b8 97 34 80 00 00 	movabs $0x803497,%rax
+  803442:	00 00 00 
+  803445:	ff d0                	call   *%rax
+  803447:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80344a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80344e:	78 2a                	js     80347a <fd_close+0xae>
+    if (dev->dev_close)
+  803450:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803454:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803458:	48 85 c0             	test   %rax,%rax
+  80345b:	74 16                	je     803473 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  80345d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803461:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803465:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803469:	48 89 c7             	mov    %rax,%rdi
+  80346c:	ff d2                	call   *%rdx
+  80346e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803471:	eb 07                	jmp    80347a <fd_close+0xae>
+    else
+      r = 0;
+  803473:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  80347a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80347e:	48 89 c6             	mov    %rax,%rsi
+  803481:	bf 00 00 00 00       	mov    $0x0,%edi
+  803486:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  80348d:	00 00 00 
+  803490:	ff d0                	call   *%rax
+  return r;
+  803492:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803495:	c9                   	leave
+  803496:	c3                   	ret
+
+0000000000803497 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803497:	55                   	push   %rbp
+  803498:	48 89 e5             	mov    %rsp,%rbp
+  80349b:	48 83 ec 20          	sub    $0x20,%rsp
+  80349f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8034a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8034a6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8034ad:	eb 3f                	jmp    8034ee <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8034af:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8034b6:	00 00 00 
+  8034b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034bc:	48 98                	cltq
+  8034be:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8034c2:	8b 00                	mov    (%rax),%eax
+  8034c4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8034c7:	75 21                	jne    8034ea <dev_lookup+0x53>
+      *dev = devtab[i];
+  8034c9:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8034d0:	00 00 00 
+  8034d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034d6:	48 98                	cltq
+  8034d8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8034dc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034e0:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8034e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e8:	eb 7f                	jmp    803569 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8034ea:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8034ee:	48 ba 20 80 80 00 00 	movabs $0x808020,%rdx
+  8034f5:	00 00 00 
+  8034f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034fb:	48 98                	cltq
+  8034fd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803501:	48 85 c0             	test   %rax,%rax
+  803504:	75 a9                	jne    8034af <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803506:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80350d:	00 00 00 
+  803510:	8b 40 04             	mov    0x4(%rax),%eax
+  803513:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803518:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80351f:	00 00 00 
+  803522:	48 98                	cltq
+  803524:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80352b:	48 01 d0             	add    %rdx,%rax
+  80352e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803534:	8b 00                	mov    (%rax),%eax
+  803536:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803539:	89 c6                	mov    %eax,%esi
+  80353b:	48 b8 68 7a 80 00 00 	movabs $0x807a68,%rax
+  803542:	00 00 00 
+  803545:	48 89 c7             	mov    %rax,%rdi
+  803548:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354d:	48 b9 81 05 80 00 00 	movabs $0x800581,%rcx
+  803554:	00 00 00 
+  803557:	ff d1                	call   *%rcx
+  *dev = 0;
+  803559:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80355d:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803564:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803569:	c9                   	leave
+  80356a:	c3                   	ret
+
+000000000080356b <close>:
+
+int
+close(int fdnum) {
+  80356b:	55                   	push   %rbp
+  80356c:	48 89 e5             	mov    %rsp,%rbp
+  80356f:	48 83 ec 20          	sub    $0x20,%rsp
+  803573:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803576:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80357a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80357d:	48 89 d6             	mov    %rdx,%rsi
+  803580:	89 c7                	mov    %eax,%edi
+  803582:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  803589:	00 00 00 
+  80358c:	ff d0                	call   *%rax
+  80358e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803591:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803595:	79 05                	jns    80359c <close+0x31>
+    return r;
+  803597:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80359a:	eb 18                	jmp    8035b4 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  80359c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8035a5:	48 89 c7             	mov    %rax,%rdi
+  8035a8:	48 b8 cc 33 80 00 00 	movabs $0x8033cc,%rax
+  8035af:	00 00 00 
+  8035b2:	ff d0                	call   *%rax
+}
+  8035b4:	c9                   	leave
+  8035b5:	c3                   	ret
+
+00000000008035b6 <close_all>:
+
+void
+close_all(void) {
+  8035b6:	55                   	push   %rbp
+  8035b7:	48 89 e5             	mov    %rsp,%rbp
+  8035ba:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8035be:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035c5:	eb 15                	jmp    8035dc <close_all+0x26>
+    close(i);
+  8035c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035ca:	89 c7                	mov    %eax,%edi
+  8035cc:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  8035d3:	00 00 00 
+  8035d6:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  8035d8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8035dc:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8035e0:	7e e5                	jle    8035c7 <close_all+0x11>
+}
+  8035e2:	90                   	nop
+  8035e3:	90                   	nop
+  8035e4:	c9                   	leave
+  8035e5:	c3                   	ret
+
+00000000008035e6 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  8035e6:	55                   	push   %rbp
+  8035e7:	48 89 e5             	mov    %rsp,%rbp
+  8035ea:	48 83 ec 40          	sub    $0x40,%rsp
+  8035ee:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8035f1:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8035f4:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  8035f8:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8035fb:	48 89 d6             	mov    %rdx,%rsi
+  8035fe:	89 c7                	mov    %eax,%edi
+  803600:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  803607:	00 00 00 
+  80360a:	ff d0                	call   *%rax
+  80360c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80360f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803613:	79 08                	jns    80361d <dup+0x37>
+    return r;
+  803615:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803618:	e9 33 02 00 00       	jmp    803850 <dup+0x26a>
+  close(newfdnum);
+  80361d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803620:	89 c7                	mov    %eax,%edi
+  803622:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  803629:	00 00 00 
+  80362c:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  80362e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803631:	c1 e0 0c             	shl    $0xc,%eax
+  803634:	48 98                	cltq
+  803636:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  80363b:	48 01 d0             	add    %rdx,%rax
+  80363e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803642:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803646:	48 89 c7             	mov    %rax,%rdi
+  803649:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  803650:	00 00 00 
+  803653:	ff d0                	call   *%rax
+  803655:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803659:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80365d:	48 89 c7             	mov    %rax,%rdi
+  803660:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  803667:	00 00 00 
+  80366a:	ff d0                	call   *%rax
+  80366c:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803670:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803677:	00 
+  803678:	e9 19 01 00 00       	jmp    803796 <dup+0x1b0>
+    off -= PGSIZE;
+  80367d:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803684:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803685:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803689:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80368d:	48 01 d0             	add    %rdx,%rax
+  803690:	48 c1 e8 27          	shr    $0x27,%rax
+  803694:	48 89 c2             	mov    %rax,%rdx
+  803697:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80369e:	01 00 00 
+  8036a1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036a5:	83 e0 01             	and    $0x1,%eax
+  8036a8:	48 85 c0             	test   %rax,%rax
+  8036ab:	0f 84 e5 00 00 00    	je     803796 <dup+0x1b0>
+  8036b1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036b9:	48 01 d0             	add    %rdx,%rax
+  8036bc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036c0:	48 89 c2             	mov    %rax,%rdx
+  8036c3:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8036ca:	01 00 00 
+  8036cd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036d1:	83 e0 01             	and    $0x1,%eax
+  8036d4:	48 85 c0             	test   %rax,%rax
+  8036d7:	0f 84 b9 00 00 00    	je     803796 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8036dd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036e5:	48 01 d0             	add    %rdx,%rax
+  8036e8:	48 c1 e8 15          	shr    $0x15,%rax
+  8036ec:	48 89 c2             	mov    %rax,%rdx
+  8036ef:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8036f6:	01 00 00 
+  8036f9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036fd:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803700:	48 85 c0             	test   %rax,%rax
+  803703:	0f 84 8d 00 00 00    	je     803796 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803709:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80370d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803711:	48 01 d0             	add    %rdx,%rax
+  803714:	48 c1 e8 0c          	shr    $0xc,%rax
+  803718:	48 89 c2             	mov    %rax,%rdx
+  80371b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803722:	01 00 00 
+  803725:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803729:	83 e0 01             	and    $0x1,%eax
+  80372c:	48 85 c0             	test   %rax,%rax
+  80372f:	74 65                	je     803796 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803731:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803735:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803739:	48 01 d0             	add    %rdx,%rax
+  80373c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803740:	48 89 c2             	mov    %rax,%rdx
+  803743:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80374a:	01 00 00 
+  80374d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803751:	25 07 0e 00 00       	and    $0xe07,%eax
+  803756:	89 c6                	mov    %eax,%esi
+  803758:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80375c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803760:	48 01 c2             	add    %rax,%rdx
+  803763:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803767:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80376b:	48 01 c8             	add    %rcx,%rax
+  80376e:	41 89 f0             	mov    %esi,%r8d
+  803771:	48 89 d1             	mov    %rdx,%rcx
+  803774:	ba 00 00 00 00       	mov    $0x0,%edx
+  803779:	48 89 c6             	mov    %rax,%rsi
+  80377c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803781:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  803788:	00 00 00 
+  80378b:	ff d0                	call   *%rax
+  80378d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803790:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803794:	78 60                	js     8037f6 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803796:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80379b:	0f 85 dc fe ff ff    	jne    80367d <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8037a1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037a5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8037a9:	48 89 c2             	mov    %rax,%rdx
+  8037ac:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8037b3:	01 00 00 
+  8037b6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037ba:	25 07 0e 00 00       	and    $0xe07,%eax
+  8037bf:	89 c1                	mov    %eax,%ecx
+  8037c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037c5:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8037c9:	41 89 c8             	mov    %ecx,%r8d
+  8037cc:	48 89 d1             	mov    %rdx,%rcx
+  8037cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037d4:	48 89 c6             	mov    %rax,%rsi
+  8037d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037dc:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  8037e3:	00 00 00 
+  8037e6:	ff d0                	call   *%rax
+  8037e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037eb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037ef:	78 08                	js     8037f9 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8037f1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8037f4:	eb 5a                	jmp    803850 <dup+0x26a>
+        goto err;
+  8037f6:	90                   	nop
+  8037f7:	eb 01                	jmp    8037fa <dup+0x214>
+    goto err;
+  8037f9:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  8037fa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037fe:	48 89 c6             	mov    %rax,%rsi
+  803801:	bf 00 00 00 00       	mov    $0x0,%edi
+  803806:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  80380d:	00 00 00 
+  803810:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803812:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803819:	00 
+  80381a:	eb 27                	jmp    803843 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  80381c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803820:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803824:	48 01 d0             	add    %rdx,%rax
+  803827:	48 89 c6             	mov    %rax,%rsi
+  80382a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80382f:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  803836:	00 00 00 
+  803839:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80383b:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803842:	00 
+  803843:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  80384a:	00 
+  80384b:	76 cf                	jbe    80381c <dup+0x236>
+  return r;
+  80384d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803850:	c9                   	leave
+  803851:	c3                   	ret
+
+0000000000803852 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803852:	55                   	push   %rbp
+  803853:	48 89 e5             	mov    %rsp,%rbp
+  803856:	48 83 ec 40          	sub    $0x40,%rsp
+  80385a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80385d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803861:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803865:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803869:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80386c:	48 89 d6             	mov    %rdx,%rsi
+  80386f:	89 c7                	mov    %eax,%edi
+  803871:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  803878:	00 00 00 
+  80387b:	ff d0                	call   *%rax
+  80387d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803880:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803884:	78 24                	js     8038aa <read+0x58>
+  803886:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80388a:	8b 00                	mov    (%rax),%eax
+  80388c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803890:	48 89 d6             	mov    %rdx,%rsi
+  803893:	89 c7                	mov    %eax,%edi
+  803895:	48 b8 97 34 80 00 00 	movabs $0x803497,%rax
+  80389c:	00 00 00 
+  80389f:	ff d0                	call   *%rax
+  8038a1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038a4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038a8:	79 0a                	jns    8038b4 <read+0x62>
+    return r;
+  8038aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038ad:	48 98                	cltq
+  8038af:	e9 9e 00 00 00       	jmp    803952 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8038b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038b8:	8b 40 08             	mov    0x8(%rax),%eax
+  8038bb:	83 e0 03             	and    $0x3,%eax
+  8038be:	83 f8 01             	cmp    $0x1,%eax
+  8038c1:	75 5c                	jne    80391f <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8038c3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8038ca:	00 00 00 
+  8038cd:	8b 40 04             	mov    0x4(%rax),%eax
+  8038d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8038d5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8038dc:	00 00 00 
+  8038df:	48 98                	cltq
+  8038e1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8038e8:	48 01 d0             	add    %rdx,%rax
+  8038eb:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8038f1:	8b 00                	mov    (%rax),%eax
+  8038f3:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8038f6:	89 c6                	mov    %eax,%esi
+  8038f8:	48 b8 87 7a 80 00 00 	movabs $0x807a87,%rax
+  8038ff:	00 00 00 
+  803902:	48 89 c7             	mov    %rax,%rdi
+  803905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80390a:	48 b9 81 05 80 00 00 	movabs $0x800581,%rcx
+  803911:	00 00 00 
+  803914:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803916:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80391d:	eb 33                	jmp    803952 <read+0x100>
+  }
+  if (!dev->dev_read)
+  80391f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803923:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803927:	48 85 c0             	test   %rax,%rax
+  80392a:	75 09                	jne    803935 <read+0xe3>
+    return -E_NOT_SUPP;
+  80392c:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803933:	eb 1d                	jmp    803952 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803935:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803939:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  80393d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803941:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803945:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803949:	48 89 ce             	mov    %rcx,%rsi
+  80394c:	48 89 c7             	mov    %rax,%rdi
+  80394f:	41 ff d0             	call   *%r8
+}
+  803952:	c9                   	leave
+  803953:	c3                   	ret
+
+0000000000803954 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803954:	55                   	push   %rbp
+  803955:	48 89 e5             	mov    %rsp,%rbp
+  803958:	48 83 ec 30          	sub    $0x30,%rsp
+  80395c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80395f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803963:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803967:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80396e:	eb 49                	jmp    8039b9 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803970:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803973:	48 98                	cltq
+  803975:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803979:	48 29 c2             	sub    %rax,%rdx
+  80397c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80397f:	48 63 c8             	movslq %eax,%rcx
+  803982:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803986:	48 01 c1             	add    %rax,%rcx
+  803989:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80398c:	48 89 ce             	mov    %rcx,%rsi
+  80398f:	89 c7                	mov    %eax,%edi
+  803991:	48 b8 52 38 80 00 00 	movabs $0x803852,%rax
+  803998:	00 00 00 
+  80399b:	ff d0                	call   *%rax
+  80399d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8039a0:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8039a4:	79 07                	jns    8039ad <readn+0x59>
+      return m;
+  8039a6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8039a9:	48 98                	cltq
+  8039ab:	eb 1f                	jmp    8039cc <readn+0x78>
+    if (m == 0)
+  8039ad:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8039b1:	74 13                	je     8039c6 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8039b3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8039b6:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8039b9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039bc:	48 98                	cltq
+  8039be:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8039c2:	72 ac                	jb     803970 <readn+0x1c>
+  8039c4:	eb 01                	jmp    8039c7 <readn+0x73>
+      break;
+  8039c6:	90                   	nop
+  }
+  return tot;
+  8039c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039ca:	48 98                	cltq
+}
+  8039cc:	c9                   	leave
+  8039cd:	c3                   	ret
+
+00000000008039ce <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8039ce:	55                   	push   %rbp
+  8039cf:	48 89 e5             	mov    %rsp,%rbp
+  8039d2:	48 83 ec 40          	sub    $0x40,%rsp
+  8039d6:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8039d9:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8039dd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8039e1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8039e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8039e8:	48 89 d6             	mov    %rdx,%rsi
+  8039eb:	89 c7                	mov    %eax,%edi
+  8039ed:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+  8039f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a00:	78 24                	js     803a26 <write+0x58>
+  803a02:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a06:	8b 00                	mov    (%rax),%eax
+  803a08:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803a0c:	48 89 d6             	mov    %rdx,%rsi
+  803a0f:	89 c7                	mov    %eax,%edi
+  803a11:	48 b8 97 34 80 00 00 	movabs $0x803497,%rax
+  803a18:	00 00 00 
+  803a1b:	ff d0                	call   *%rax
+  803a1d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a20:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a24:	79 0a                	jns    803a30 <write+0x62>
+    return r;
+  803a26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a29:	48 98                	cltq
+  803a2b:	e9 9d 00 00 00       	jmp    803acd <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803a30:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a34:	8b 40 08             	mov    0x8(%rax),%eax
+  803a37:	83 e0 03             	and    $0x3,%eax
+  803a3a:	85 c0                	test   %eax,%eax
+  803a3c:	75 5c                	jne    803a9a <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803a3e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803a45:	00 00 00 
+  803a48:	8b 40 04             	mov    0x4(%rax),%eax
+  803a4b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803a50:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803a57:	00 00 00 
+  803a5a:	48 98                	cltq
+  803a5c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803a63:	48 01 d0             	add    %rdx,%rax
+  803a66:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803a6c:	8b 00                	mov    (%rax),%eax
+  803a6e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a71:	89 c6                	mov    %eax,%esi
+  803a73:	48 b8 a3 7a 80 00 00 	movabs $0x807aa3,%rax
+  803a7a:	00 00 00 
+  803a7d:	48 89 c7             	mov    %rax,%rdi
+  803a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a85:	48 b9 81 05 80 00 00 	movabs $0x800581,%rcx
+  803a8c:	00 00 00 
+  803a8f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803a91:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a98:	eb 33                	jmp    803acd <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803a9a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a9e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803aa2:	48 85 c0             	test   %rax,%rax
+  803aa5:	75 09                	jne    803ab0 <write+0xe2>
+    return -E_NOT_SUPP;
+  803aa7:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803aae:	eb 1d                	jmp    803acd <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803ab0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ab4:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803ab8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803abc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803ac0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803ac4:	48 89 ce             	mov    %rcx,%rsi
+  803ac7:	48 89 c7             	mov    %rax,%rdi
+  803aca:	41 ff d0             	call   *%r8
+}
+  803acd:	c9                   	leave
+  803ace:	c3                   	ret
+
+0000000000803acf <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803acf:	55                   	push   %rbp
+  803ad0:	48 89 e5             	mov    %rsp,%rbp
+  803ad3:	48 83 ec 18          	sub    $0x18,%rsp
+  803ad7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803ada:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803add:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803ae1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ae4:	48 89 d6             	mov    %rdx,%rsi
+  803ae7:	89 c7                	mov    %eax,%edi
+  803ae9:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  803af0:	00 00 00 
+  803af3:	ff d0                	call   *%rax
+  803af5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803af8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803afc:	79 05                	jns    803b03 <seek+0x34>
+    return r;
+  803afe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b01:	eb 0f                	jmp    803b12 <seek+0x43>
+  fd->fd_offset = offset;
+  803b03:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b07:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803b0a:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b12:	c9                   	leave
+  803b13:	c3                   	ret
+
+0000000000803b14 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803b14:	55                   	push   %rbp
+  803b15:	48 89 e5             	mov    %rsp,%rbp
+  803b18:	48 83 ec 30          	sub    $0x30,%rsp
+  803b1c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803b1f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b22:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803b26:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b29:	48 89 d6             	mov    %rdx,%rsi
+  803b2c:	89 c7                	mov    %eax,%edi
+  803b2e:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  803b35:	00 00 00 
+  803b38:	ff d0                	call   *%rax
+  803b3a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b3d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b41:	78 24                	js     803b67 <ftruncate+0x53>
+  803b43:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b47:	8b 00                	mov    (%rax),%eax
+  803b49:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b4d:	48 89 d6             	mov    %rdx,%rsi
+  803b50:	89 c7                	mov    %eax,%edi
+  803b52:	48 b8 97 34 80 00 00 	movabs $0x803497,%rax
+  803b59:	00 00 00 
+  803b5c:	ff d0                	call   *%rax
+  803b5e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b61:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b65:	79 08                	jns    803b6f <ftruncate+0x5b>
+    return r;
+  803b67:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b6a:	e9 92 00 00 00       	jmp    803c01 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803b6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b73:	8b 40 08             	mov    0x8(%rax),%eax
+  803b76:	83 e0 03             	and    $0x3,%eax
+  803b79:	85 c0                	test   %eax,%eax
+  803b7b:	75 5a                	jne    803bd7 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803b7d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b84:	00 00 00 
+  803b87:	8b 40 04             	mov    0x4(%rax),%eax
+  803b8a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b8f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b96:	00 00 00 
+  803b99:	48 98                	cltq
+  803b9b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803ba2:	48 01 d0             	add    %rdx,%rax
+  803ba5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803bab:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803bad:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803bb0:	89 c6                	mov    %eax,%esi
+  803bb2:	48 b8 c0 7a 80 00 00 	movabs $0x807ac0,%rax
+  803bb9:	00 00 00 
+  803bbc:	48 89 c7             	mov    %rax,%rdi
+  803bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc4:	48 b9 81 05 80 00 00 	movabs $0x800581,%rcx
+  803bcb:	00 00 00 
+  803bce:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803bd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803bd5:	eb 2a                	jmp    803c01 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803bd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bdb:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803bdf:	48 85 c0             	test   %rax,%rax
+  803be2:	75 07                	jne    803beb <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803be4:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803be9:	eb 16                	jmp    803c01 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803beb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bef:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803bf3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bf7:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803bfa:	89 d6                	mov    %edx,%esi
+  803bfc:	48 89 c7             	mov    %rax,%rdi
+  803bff:	ff d1                	call   *%rcx
+}
+  803c01:	c9                   	leave
+  803c02:	c3                   	ret
+
+0000000000803c03 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803c03:	55                   	push   %rbp
+  803c04:	48 89 e5             	mov    %rsp,%rbp
+  803c07:	48 83 ec 30          	sub    $0x30,%rsp
+  803c0b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c0e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c12:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803c16:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c19:	48 89 d6             	mov    %rdx,%rsi
+  803c1c:	89 c7                	mov    %eax,%edi
+  803c1e:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  803c25:	00 00 00 
+  803c28:	ff d0                	call   *%rax
+  803c2a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c2d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c31:	78 24                	js     803c57 <fstat+0x54>
+  803c33:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c37:	8b 00                	mov    (%rax),%eax
+  803c39:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c3d:	48 89 d6             	mov    %rdx,%rsi
+  803c40:	89 c7                	mov    %eax,%edi
+  803c42:	48 b8 97 34 80 00 00 	movabs $0x803497,%rax
+  803c49:	00 00 00 
+  803c4c:	ff d0                	call   *%rax
+  803c4e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c51:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c55:	79 05                	jns    803c5c <fstat+0x59>
+    return r;
+  803c57:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c5a:	eb 5e                	jmp    803cba <fstat+0xb7>
+  if (!dev->dev_stat)
+  803c5c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c60:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803c64:	48 85 c0             	test   %rax,%rax
+  803c67:	75 07                	jne    803c70 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803c69:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803c6e:	eb 4a                	jmp    803cba <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803c70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c74:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803c77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c7b:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803c82:	00 00 00 
+  stat->st_isdir   = 0;
+  803c85:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c89:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803c90:	00 00 00 
+  stat->st_dev     = dev;
+  803c93:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803c97:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c9b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803ca2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ca6:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803caa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cae:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803cb2:	48 89 d6             	mov    %rdx,%rsi
+  803cb5:	48 89 c7             	mov    %rax,%rdi
+  803cb8:	ff d1                	call   *%rcx
+}
+  803cba:	c9                   	leave
+  803cbb:	c3                   	ret
+
+0000000000803cbc <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803cbc:	55                   	push   %rbp
+  803cbd:	48 89 e5             	mov    %rsp,%rbp
+  803cc0:	48 83 ec 10          	sub    $0x10,%rsp
+  803cc4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803cc8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803ccc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cd0:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803cd6:	83 f8 20             	cmp    $0x20,%eax
+  803cd9:	75 07                	jne    803ce2 <pollwait_key+0x26>
+    return -E_INVAL;
+  803cdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ce0:	eb 5f                	jmp    803d41 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803ce2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ce6:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803cec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cf0:	48 63 d2             	movslq %edx,%rdx
+  803cf3:	48 c1 e2 04          	shl    $0x4,%rdx
+  803cf7:	48 01 c2             	add    %rax,%rdx
+  803cfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cfe:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803d01:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d05:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803d0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d0f:	8b 00                	mov    (%rax),%eax
+  803d11:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803d15:	48 63 c9             	movslq %ecx,%rcx
+  803d18:	48 c1 e1 04          	shl    $0x4,%rcx
+  803d1c:	48 01 ca             	add    %rcx,%rdx
+  803d1f:	48 83 c2 08          	add    $0x8,%rdx
+  803d23:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803d25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d29:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803d2f:	8d 50 01             	lea    0x1(%rax),%edx
+  803d32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803d36:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d41:	c9                   	leave
+  803d42:	c3                   	ret
+
+0000000000803d43 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803d43:	55                   	push   %rbp
+  803d44:	48 89 e5             	mov    %rsp,%rbp
+  803d47:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803d4e:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803d55:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803d5b:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803d62:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803d69:	00 
+  int i, r, ready, ipc = 0;
+  803d6a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803d71:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803d78:	00 
+  803d79:	74 45                	je     803dc0 <poll+0x7d>
+  803d7b:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803d82:	ff 
+  803d83:	74 3b                	je     803dc0 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803d85:	48 b8 9a 64 80 00 00 	movabs $0x80649a,%rax
+  803d8c:	00 00 00 
+  803d8f:	ff d0                	call   *%rax
+  803d91:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803d95:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803d99:	48 f7 d0             	not    %rax
+  803d9c:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803da3:	73 10                	jae    803db5 <poll+0x72>
+  803da5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803da9:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803db0:	48 01 d0             	add    %rdx,%rax
+  803db3:	eb 07                	jmp    803dbc <poll+0x79>
+  803db5:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803dbc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803dc0:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803dc7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803dce:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803dd5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803ddc:	e9 46 02 00 00       	jmp    804027 <poll+0x2e4>
+      fds[i].revents = 0;
+  803de1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803de4:	48 63 d0             	movslq %eax,%rdx
+  803de7:	48 89 d0             	mov    %rdx,%rax
+  803dea:	48 01 c0             	add    %rax,%rax
+  803ded:	48 01 d0             	add    %rdx,%rax
+  803df0:	48 c1 e0 02          	shl    $0x2,%rax
+  803df4:	48 89 c2             	mov    %rax,%rdx
+  803df7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803dfe:	48 01 d0             	add    %rdx,%rax
+  803e01:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803e08:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e0b:	48 63 d0             	movslq %eax,%rdx
+  803e0e:	48 89 d0             	mov    %rdx,%rax
+  803e11:	48 01 c0             	add    %rax,%rax
+  803e14:	48 01 d0             	add    %rdx,%rax
+  803e17:	48 c1 e0 02          	shl    $0x2,%rax
+  803e1b:	48 89 c2             	mov    %rax,%rdx
+  803e1e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e25:	48 01 d0             	add    %rdx,%rax
+  803e28:	8b 00                	mov    (%rax),%eax
+  803e2a:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803e2d:	75 62                	jne    803e91 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803e2f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e32:	48 63 d0             	movslq %eax,%rdx
+  803e35:	48 89 d0             	mov    %rdx,%rax
+  803e38:	48 01 c0             	add    %rax,%rax
+  803e3b:	48 01 d0             	add    %rdx,%rax
+  803e3e:	48 c1 e0 02          	shl    $0x2,%rax
+  803e42:	48 89 c2             	mov    %rax,%rdx
+  803e45:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e4c:	48 01 d0             	add    %rdx,%rax
+  803e4f:	8b 40 04             	mov    0x4(%rax),%eax
+  803e52:	83 e0 01             	and    $0x1,%eax
+  803e55:	85 c0                	test   %eax,%eax
+  803e57:	0f 84 9b 01 00 00    	je     803ff8 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803e5d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e60:	48 63 d0             	movslq %eax,%rdx
+  803e63:	48 89 d0             	mov    %rdx,%rax
+  803e66:	48 01 c0             	add    %rax,%rax
+  803e69:	48 01 d0             	add    %rdx,%rax
+  803e6c:	48 c1 e0 02          	shl    $0x2,%rax
+  803e70:	48 89 c2             	mov    %rax,%rdx
+  803e73:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803e7a:	48 01 c2             	add    %rax,%rdx
+  803e7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e80:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803e83:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803e86:	83 c8 04             	or     $0x4,%eax
+  803e89:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803e8c:	e9 67 01 00 00       	jmp    803ff8 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803e91:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e94:	48 63 d0             	movslq %eax,%rdx
+  803e97:	48 89 d0             	mov    %rdx,%rax
+  803e9a:	48 01 c0             	add    %rax,%rax
+  803e9d:	48 01 d0             	add    %rdx,%rax
+  803ea0:	48 c1 e0 02          	shl    $0x2,%rax
+  803ea4:	48 89 c2             	mov    %rax,%rdx
+  803ea7:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803eae:	48 01 d0             	add    %rdx,%rax
+  803eb1:	8b 00                	mov    (%rax),%eax
+  803eb3:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803eba:	48 89 d6             	mov    %rdx,%rsi
+  803ebd:	89 c7                	mov    %eax,%edi
+  803ebf:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  803ec6:	00 00 00 
+  803ec9:	ff d0                	call   *%rax
+  803ecb:	85 c0                	test   %eax,%eax
+  803ecd:	78 25                	js     803ef4 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803ecf:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803ed6:	8b 00                	mov    (%rax),%eax
+  803ed8:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803edf:	48 89 d6             	mov    %rdx,%rsi
+  803ee2:	89 c7                	mov    %eax,%edi
+  803ee4:	48 b8 97 34 80 00 00 	movabs $0x803497,%rax
+  803eeb:	00 00 00 
+  803eee:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803ef0:	85 c0                	test   %eax,%eax
+  803ef2:	79 2c                	jns    803f20 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803ef4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ef7:	48 63 d0             	movslq %eax,%rdx
+  803efa:	48 89 d0             	mov    %rdx,%rax
+  803efd:	48 01 c0             	add    %rax,%rax
+  803f00:	48 01 d0             	add    %rdx,%rax
+  803f03:	48 c1 e0 02          	shl    $0x2,%rax
+  803f07:	48 89 c2             	mov    %rax,%rdx
+  803f0a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f11:	48 01 d0             	add    %rdx,%rax
+  803f14:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803f1b:	e9 d8 00 00 00       	jmp    803ff8 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803f20:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803f27:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803f2b:	48 85 c0             	test   %rax,%rax
+  803f2e:	74 7d                	je     803fad <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803f30:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803f37:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803f3b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f3e:	48 63 d0             	movslq %eax,%rdx
+  803f41:	48 89 d0             	mov    %rdx,%rax
+  803f44:	48 01 c0             	add    %rax,%rax
+  803f47:	48 01 d0             	add    %rdx,%rax
+  803f4a:	48 c1 e0 02          	shl    $0x2,%rax
+  803f4e:	48 89 c2             	mov    %rax,%rdx
+  803f51:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f58:	48 01 d0             	add    %rdx,%rax
+  803f5b:	8b 48 04             	mov    0x4(%rax),%ecx
+  803f5e:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803f65:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803f6c:	89 ce                	mov    %ecx,%esi
+  803f6e:	48 89 c7             	mov    %rax,%rdi
+  803f71:	41 ff d0             	call   *%r8
+  803f74:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803f77:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803f7b:	79 08                	jns    803f85 <poll+0x242>
+          return r;
+  803f7d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f80:	e9 45 01 00 00       	jmp    8040ca <poll+0x387>
+        fds[i].revents = r;
+  803f85:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f88:	48 63 d0             	movslq %eax,%rdx
+  803f8b:	48 89 d0             	mov    %rdx,%rax
+  803f8e:	48 01 c0             	add    %rax,%rax
+  803f91:	48 01 d0             	add    %rdx,%rax
+  803f94:	48 c1 e0 02          	shl    $0x2,%rax
+  803f98:	48 89 c2             	mov    %rax,%rdx
+  803f9b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fa2:	48 01 c2             	add    %rax,%rdx
+  803fa5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803fa8:	89 42 08             	mov    %eax,0x8(%rdx)
+  803fab:	eb 4b                	jmp    803ff8 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803fad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fb0:	48 63 d0             	movslq %eax,%rdx
+  803fb3:	48 89 d0             	mov    %rdx,%rax
+  803fb6:	48 01 c0             	add    %rax,%rax
+  803fb9:	48 01 d0             	add    %rdx,%rax
+  803fbc:	48 c1 e0 02          	shl    $0x2,%rax
+  803fc0:	48 89 c2             	mov    %rax,%rdx
+  803fc3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fca:	48 01 d0             	add    %rdx,%rax
+  803fcd:	8b 48 04             	mov    0x4(%rax),%ecx
+  803fd0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fd3:	48 63 d0             	movslq %eax,%rdx
+  803fd6:	48 89 d0             	mov    %rdx,%rax
+  803fd9:	48 01 c0             	add    %rax,%rax
+  803fdc:	48 01 d0             	add    %rdx,%rax
+  803fdf:	48 c1 e0 02          	shl    $0x2,%rax
+  803fe3:	48 89 c2             	mov    %rax,%rdx
+  803fe6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fed:	48 01 d0             	add    %rdx,%rax
+  803ff0:	83 e1 03             	and    $0x3,%ecx
+  803ff3:	89 ca                	mov    %ecx,%edx
+  803ff5:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803ff8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ffb:	48 63 d0             	movslq %eax,%rdx
+  803ffe:	48 89 d0             	mov    %rdx,%rax
+  804001:	48 01 c0             	add    %rax,%rax
+  804004:	48 01 d0             	add    %rdx,%rax
+  804007:	48 c1 e0 02          	shl    $0x2,%rax
+  80400b:	48 89 c2             	mov    %rax,%rdx
+  80400e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804015:	48 01 d0             	add    %rdx,%rax
+  804018:	8b 40 08             	mov    0x8(%rax),%eax
+  80401b:	85 c0                	test   %eax,%eax
+  80401d:	74 04                	je     804023 <poll+0x2e0>
+        ready++;
+  80401f:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804023:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804027:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80402a:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  804030:	0f 8c ab fd ff ff    	jl     803de1 <poll+0x9e>
+    }
+    if (ready)
+  804036:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  80403a:	74 08                	je     804044 <poll+0x301>
+      return ready;
+  80403c:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80403f:	e9 86 00 00 00       	jmp    8040ca <poll+0x387>
+
+    if (deadline) {
+  804044:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804049:	74 30                	je     80407b <poll+0x338>
+      now     = vsys_clock_ns();
+  80404b:	48 b8 9a 64 80 00 00 	movabs $0x80649a,%rax
+  804052:	00 00 00 
+  804055:	ff d0                	call   *%rax
+  804057:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  80405b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80405f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  804063:	73 0a                	jae    80406f <poll+0x32c>
+  804065:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804069:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80406d:	eb 05                	jmp    804074 <poll+0x331>
+  80406f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804074:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80407b:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80407e:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804081:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804088:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80408f:	48 89 c7             	mov    %rax,%rdi
+  804092:	48 b8 47 27 80 00 00 	movabs $0x802747,%rax
+  804099:	00 00 00 
+  80409c:	ff d0                	call   *%rax
+  80409e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8040a1:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8040a5:	75 07                	jne    8040ae <poll+0x36b>
+      return 0;
+  8040a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ac:	eb 1c                	jmp    8040ca <poll+0x387>
+    if (r < 0)
+  8040ae:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8040b2:	79 05                	jns    8040b9 <poll+0x376>
+      return r;
+  8040b4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040b7:	eb 11                	jmp    8040ca <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8040b9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040bc:	c1 f8 02             	sar    $0x2,%eax
+  8040bf:	83 e0 01             	and    $0x1,%eax
+  8040c2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8040c5:	e9 f6 fc ff ff       	jmp    803dc0 <poll+0x7d>
+  }
+}
+  8040ca:	c9                   	leave
+  8040cb:	c3                   	ret
+
+00000000008040cc <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8040cc:	55                   	push   %rbp
+  8040cd:	48 89 e5             	mov    %rsp,%rbp
+  8040d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8040d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8040d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8040dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8040e5:	48 89 c7             	mov    %rax,%rdi
+  8040e8:	48 b8 ba 41 80 00 00 	movabs $0x8041ba,%rax
+  8040ef:	00 00 00 
+  8040f2:	ff d0                	call   *%rax
+  8040f4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040f7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040fb:	79 05                	jns    804102 <stat+0x36>
+    return fd;
+  8040fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804100:	eb 2f                	jmp    804131 <stat+0x65>
+  r = fstat(fd, stat);
+  804102:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804106:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804109:	48 89 d6             	mov    %rdx,%rsi
+  80410c:	89 c7                	mov    %eax,%edi
+  80410e:	48 b8 03 3c 80 00 00 	movabs $0x803c03,%rax
+  804115:	00 00 00 
+  804118:	ff d0                	call   *%rax
+  80411a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80411d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804120:	89 c7                	mov    %eax,%edi
+  804122:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  804129:	00 00 00 
+  80412c:	ff d0                	call   *%rax
+  return r;
+  80412e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804131:	c9                   	leave
+  804132:	c3                   	ret
+
+0000000000804133 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  804133:	55                   	push   %rbp
+  804134:	48 89 e5             	mov    %rsp,%rbp
+  804137:	48 83 ec 10          	sub    $0x10,%rsp
+  80413b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80413e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  804142:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804149:	00 00 00 
+  80414c:	8b 00                	mov    (%rax),%eax
+  80414e:	85 c0                	test   %eax,%eax
+  804150:	75 1d                	jne    80416f <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  804152:	bf 03 00 00 00       	mov    $0x3,%edi
+  804157:	48 b8 1b 6c 80 00 00 	movabs $0x806c1b,%rax
+  80415e:	00 00 00 
+  804161:	ff d0                	call   *%rax
+  804163:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  80416a:	00 00 00 
+  80416d:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  80416f:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804176:	00 00 00 
+  804179:	8b 00                	mov    (%rax),%eax
+  80417b:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80417e:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804183:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80418a:	00 00 00 
+  80418d:	89 c7                	mov    %eax,%edi
+  80418f:	48 b8 6e 6b 80 00 00 	movabs $0x806b6e,%rax
+  804196:	00 00 00 
+  804199:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80419b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80419f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041a4:	48 89 c6             	mov    %rax,%rsi
+  8041a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ac:	48 b8 f1 69 80 00 00 	movabs $0x8069f1,%rax
+  8041b3:	00 00 00 
+  8041b6:	ff d0                	call   *%rax
+}
+  8041b8:	c9                   	leave
+  8041b9:	c3                   	ret
+
+00000000008041ba <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8041ba:	55                   	push   %rbp
+  8041bb:	48 89 e5             	mov    %rsp,%rbp
+  8041be:	48 83 ec 20          	sub    $0x20,%rsp
+  8041c2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041c6:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8041c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041cd:	48 89 c7             	mov    %rax,%rdi
+  8041d0:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  8041d7:	00 00 00 
+  8041da:	ff d0                	call   *%rax
+  8041dc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8041e1:	7e 0a                	jle    8041ed <open+0x33>
+    return -E_BAD_PATH;
+  8041e3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8041e8:	e9 a8 00 00 00       	jmp    804295 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8041ed:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8041f1:	48 89 c7             	mov    %rax,%rdi
+  8041f4:	48 b8 14 32 80 00 00 	movabs $0x803214,%rax
+  8041fb:	00 00 00 
+  8041fe:	ff d0                	call   *%rax
+  804200:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804203:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804207:	79 08                	jns    804211 <open+0x57>
+    return r;
+  804209:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80420c:	e9 84 00 00 00       	jmp    804295 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804211:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804215:	48 89 c6             	mov    %rax,%rsi
+  804218:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80421f:	00 00 00 
+  804222:	48 89 c7             	mov    %rax,%rdi
+  804225:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  80422c:	00 00 00 
+  80422f:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  804231:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804238:	00 00 00 
+  80423b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80423e:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  804244:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804248:	48 89 c6             	mov    %rax,%rsi
+  80424b:	bf 01 00 00 00       	mov    $0x1,%edi
+  804250:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  804257:	00 00 00 
+  80425a:	ff d0                	call   *%rax
+  80425c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80425f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804263:	79 1d                	jns    804282 <open+0xc8>
+    fd_close(fd, 0);
+  804265:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804269:	be 00 00 00 00       	mov    $0x0,%esi
+  80426e:	48 89 c7             	mov    %rax,%rdi
+  804271:	48 b8 cc 33 80 00 00 	movabs $0x8033cc,%rax
+  804278:	00 00 00 
+  80427b:	ff d0                	call   *%rax
+    return r;
+  80427d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804280:	eb 13                	jmp    804295 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804282:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804286:	48 89 c7             	mov    %rax,%rdi
+  804289:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  804290:	00 00 00 
+  804293:	ff d0                	call   *%rax
+}
+  804295:	c9                   	leave
+  804296:	c3                   	ret
+
+0000000000804297 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804297:	55                   	push   %rbp
+  804298:	48 89 e5             	mov    %rsp,%rbp
+  80429b:	48 83 ec 10          	sub    $0x10,%rsp
+  80429f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8042a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042a7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8042aa:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8042b1:	00 00 00 
+  8042b4:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8042b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8042bb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8042c0:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  8042c7:	00 00 00 
+  8042ca:	ff d0                	call   *%rax
+}
+  8042cc:	c9                   	leave
+  8042cd:	c3                   	ret
+
+00000000008042ce <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8042ce:	55                   	push   %rbp
+  8042cf:	48 89 e5             	mov    %rsp,%rbp
+  8042d2:	48 83 ec 30          	sub    $0x30,%rsp
+  8042d6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042da:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8042de:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8042e2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8042e7:	74 07                	je     8042f0 <devfile_read+0x22>
+  8042e9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8042ee:	75 0a                	jne    8042fa <devfile_read+0x2c>
+  return E_INVAL;
+  8042f0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8042f5:	e9 b4 00 00 00       	jmp    8043ae <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  8042fa:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804301:	00 
+  while (n) {
+  804302:	e9 98 00 00 00       	jmp    80439f <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804307:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80430b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80430e:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804315:	00 00 00 
+  804318:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80431a:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804321:	00 00 00 
+  804324:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804328:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  80432c:	be 00 00 00 00       	mov    $0x0,%esi
+  804331:	bf 03 00 00 00       	mov    $0x3,%edi
+  804336:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  80433d:	00 00 00 
+  804340:	ff d0                	call   *%rax
+  804342:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  804345:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804349:	7f 13                	jg     80435e <devfile_read+0x90>
+      return res ? res : res0;
+  80434b:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80434f:	74 07                	je     804358 <devfile_read+0x8a>
+  804351:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804354:	48 98                	cltq
+  804356:	eb 56                	jmp    8043ae <devfile_read+0xe0>
+  804358:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80435c:	eb 50                	jmp    8043ae <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  80435e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804361:	48 63 d0             	movslq %eax,%rdx
+  804364:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804368:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  80436f:	00 00 00 
+  804372:	48 89 ce             	mov    %rcx,%rsi
+  804375:	48 89 c7             	mov    %rax,%rdi
+  804378:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  80437f:	00 00 00 
+  804382:	ff d0                	call   *%rax
+
+    buf += res;
+  804384:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804387:	48 98                	cltq
+  804389:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80438d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804390:	48 98                	cltq
+  804392:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804396:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804399:	48 98                	cltq
+  80439b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80439f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8043a4:	0f 85 5d ff ff ff    	jne    804307 <devfile_read+0x39>
+  }
+
+  return res0;
+  8043aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8043ae:	c9                   	leave
+  8043af:	c3                   	ret
+
+00000000008043b0 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8043b0:	55                   	push   %rbp
+  8043b1:	48 89 e5             	mov    %rsp,%rbp
+  8043b4:	48 83 ec 50          	sub    $0x50,%rsp
+  8043b8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8043bc:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8043c0:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8043c4:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8043c9:	74 07                	je     8043d2 <devfile_write+0x22>
+  8043cb:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8043d0:	75 0a                	jne    8043dc <devfile_write+0x2c>
+  return E_INVAL;
+  8043d2:	b8 03 00 00 00       	mov    $0x3,%eax
+  8043d7:	e9 c9 00 00 00       	jmp    8044a5 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8043dc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8043e3:	00 
+
+  while (n) {
+  8043e4:	e9 ad 00 00 00       	jmp    804496 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8043e9:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8043ed:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8043f1:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  8043f8:	00 
+  8043f9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8043fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804401:	48 39 c2             	cmp    %rax,%rdx
+  804404:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804408:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  80440c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804410:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804414:	48 89 c6             	mov    %rax,%rsi
+  804417:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  80441e:	00 00 00 
+  804421:	48 89 c7             	mov    %rax,%rdi
+  804424:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  80442b:	00 00 00 
+  80442e:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804430:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804434:	8b 40 0c             	mov    0xc(%rax),%eax
+  804437:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80443e:	00 00 00 
+  804441:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804443:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80444a:	00 00 00 
+  80444d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804451:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804455:	be 00 00 00 00       	mov    $0x0,%esi
+  80445a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80445f:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  804466:	00 00 00 
+  804469:	ff d0                	call   *%rax
+  80446b:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  80446e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804472:	79 07                	jns    80447b <devfile_write+0xcb>
+      return res;
+  804474:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804477:	48 98                	cltq
+  804479:	eb 2a                	jmp    8044a5 <devfile_write+0xf5>
+
+    buf += res;
+  80447b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80447e:	48 98                	cltq
+  804480:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804484:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804487:	48 98                	cltq
+  804489:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  80448d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804490:	48 98                	cltq
+  804492:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804496:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  80449b:	0f 85 48 ff ff ff    	jne    8043e9 <devfile_write+0x39>
+  }
+
+  return res0;
+  8044a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8044a5:	c9                   	leave
+  8044a6:	c3                   	ret
+
+00000000008044a7 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8044a7:	55                   	push   %rbp
+  8044a8:	48 89 e5             	mov    %rsp,%rbp
+  8044ab:	48 83 ec 20          	sub    $0x20,%rsp
+  8044af:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8044b3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8044b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044bb:	8b 40 0c             	mov    0xc(%rax),%eax
+  8044be:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8044c5:	00 00 00 
+  8044c8:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8044ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8044cf:	bf 05 00 00 00       	mov    $0x5,%edi
+  8044d4:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  8044db:	00 00 00 
+  8044de:	ff d0                	call   *%rax
+  8044e0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044e3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044e7:	79 05                	jns    8044ee <devfile_stat+0x47>
+    return r;
+  8044e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044ec:	eb 59                	jmp    804547 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8044ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8044f2:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8044f9:	00 00 00 
+  8044fc:	48 89 d6             	mov    %rdx,%rsi
+  8044ff:	48 89 c7             	mov    %rax,%rdi
+  804502:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  804509:	00 00 00 
+  80450c:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  80450e:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804515:	00 00 00 
+  804518:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  80451e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804522:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804528:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80452f:	00 00 00 
+  804532:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804538:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80453c:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804542:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804547:	c9                   	leave
+  804548:	c3                   	ret
+
+0000000000804549 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804549:	55                   	push   %rbp
+  80454a:	48 89 e5             	mov    %rsp,%rbp
+  80454d:	48 83 ec 10          	sub    $0x10,%rsp
+  804551:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804555:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804558:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80455c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80455f:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804566:	00 00 00 
+  804569:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  80456b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804572:	00 00 00 
+  804575:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804578:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80457b:	be 00 00 00 00       	mov    $0x0,%esi
+  804580:	bf 02 00 00 00       	mov    $0x2,%edi
+  804585:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  80458c:	00 00 00 
+  80458f:	ff d0                	call   *%rax
+}
+  804591:	c9                   	leave
+  804592:	c3                   	ret
+
+0000000000804593 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804593:	55                   	push   %rbp
+  804594:	48 89 e5             	mov    %rsp,%rbp
+  804597:	48 83 ec 18          	sub    $0x18,%rsp
+  80459b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80459f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8045a2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8045a6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045a9:	83 e0 03             	and    $0x3,%eax
+}
+  8045ac:	c9                   	leave
+  8045ad:	c3                   	ret
+
+00000000008045ae <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8045ae:	55                   	push   %rbp
+  8045af:	48 89 e5             	mov    %rsp,%rbp
+  8045b2:	48 83 ec 10          	sub    $0x10,%rsp
+  8045b6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8045ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045be:	48 89 c7             	mov    %rax,%rdi
+  8045c1:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  8045c8:	00 00 00 
+  8045cb:	ff d0                	call   *%rax
+  8045cd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8045d2:	7e 07                	jle    8045db <remove+0x2d>
+    return -E_BAD_PATH;
+  8045d4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8045d9:	eb 36                	jmp    804611 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8045db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045df:	48 89 c6             	mov    %rax,%rsi
+  8045e2:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8045e9:	00 00 00 
+  8045ec:	48 89 c7             	mov    %rax,%rdi
+  8045ef:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  8045f6:	00 00 00 
+  8045f9:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  8045fb:	be 00 00 00 00       	mov    $0x0,%esi
+  804600:	bf 07 00 00 00       	mov    $0x7,%edi
+  804605:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  80460c:	00 00 00 
+  80460f:	ff d0                	call   *%rax
+}
+  804611:	c9                   	leave
+  804612:	c3                   	ret
+
+0000000000804613 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804613:	55                   	push   %rbp
+  804614:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804617:	be 00 00 00 00       	mov    $0x0,%esi
+  80461c:	bf 08 00 00 00       	mov    $0x8,%edi
+  804621:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  804628:	00 00 00 
+  80462b:	ff d0                	call   *%rax
+}
+  80462d:	5d                   	pop    %rbp
+  80462e:	c3                   	ret
+
+000000000080462f <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  80462f:	55                   	push   %rbp
+  804630:	48 89 e5             	mov    %rsp,%rbp
+  804633:	48 83 ec 20          	sub    $0x20,%rsp
+  804637:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80463b:	be 00 00 00 00       	mov    $0x0,%esi
+  804640:	bf 09 00 00 00       	mov    $0x9,%edi
+  804645:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  80464c:	00 00 00 
+  80464f:	ff d0                	call   *%rax
+  804651:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804654:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804658:	79 05                	jns    80465f <fs_stats+0x30>
+    return r;
+  80465a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80465d:	eb 2a                	jmp    804689 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  80465f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804663:	ba 68 00 00 00       	mov    $0x68,%edx
+  804668:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  80466f:	00 00 00 
+  804672:	48 89 ce             	mov    %rcx,%rsi
+  804675:	48 89 c7             	mov    %rax,%rdi
+  804678:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  80467f:	00 00 00 
+  804682:	ff d0                	call   *%rax
+  return 0;
+  804684:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804689:	c9                   	leave
+  80468a:	c3                   	ret
+
+000000000080468b <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  80468b:	55                   	push   %rbp
+  80468c:	48 89 e5             	mov    %rsp,%rbp
+  80468f:	48 83 ec 10          	sub    $0x10,%rsp
+  804693:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804696:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80469d:	00 00 00 
+  8046a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8046a3:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  8046a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8046aa:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8046af:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  8046b6:	00 00 00 
+  8046b9:	ff d0                	call   *%rax
+}
+  8046bb:	c9                   	leave
+  8046bc:	c3                   	ret
+
+00000000008046bd <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8046bd:	55                   	push   %rbp
+  8046be:	48 89 e5             	mov    %rsp,%rbp
+  8046c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8046c5:	89 f8                	mov    %edi,%eax
+  8046c7:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8046ca:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8046ce:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8046d5:	00 00 00 
+  8046d8:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8046da:	be 00 00 00 00       	mov    $0x0,%esi
+  8046df:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8046e4:	48 b8 33 41 80 00 00 	movabs $0x804133,%rax
+  8046eb:	00 00 00 
+  8046ee:	ff d0                	call   *%rax
+}
+  8046f0:	c9                   	leave
+  8046f1:	c3                   	ret
+
+00000000008046f2 <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  8046f2:	55                   	push   %rbp
+  8046f3:	48 89 e5             	mov    %rsp,%rbp
+  8046f6:	53                   	push   %rbx
+  8046f7:	48 81 ec 18 03 00 00 	sub    $0x318,%rsp
+  8046fe:	48 89 bd e8 fc ff ff 	mov    %rdi,-0x318(%rbp)
+  804705:	48 89 b5 e0 fc ff ff 	mov    %rsi,-0x320(%rbp)
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  80470c:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804713:	be 00 00 00 00       	mov    $0x0,%esi
+  804718:	48 89 c7             	mov    %rax,%rdi
+  80471b:	48 b8 ba 41 80 00 00 	movabs $0x8041ba,%rax
+  804722:	00 00 00 
+  804725:	ff d0                	call   *%rax
+  804727:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  80472a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80472e:	79 08                	jns    804738 <spawn+0x46>
+    return r;
+  804730:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804733:	e9 35 04 00 00       	jmp    804b6d <spawn+0x47b>
+  fd = r;
+  804738:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80473b:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+  // Read elf header
+  elf = (struct Elf *)elf_buf;
+  80473e:	48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+  804745:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  804749:	48 8d 8d b0 fd ff ff 	lea    -0x250(%rbp),%rcx
+  804750:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804753:	ba 00 02 00 00       	mov    $0x200,%edx
+  804758:	48 89 ce             	mov    %rcx,%rsi
+  80475b:	89 c7                	mov    %eax,%edi
+  80475d:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  804764:	00 00 00 
+  804767:	ff d0                	call   *%rax
+  804769:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  80476f:	75 0d                	jne    80477e <spawn+0x8c>
+  804771:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804775:	8b 00                	mov    (%rax),%eax
+  804777:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  80477c:	74 46                	je     8047c4 <spawn+0xd2>
+    close(fd);
+  80477e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804781:	89 c7                	mov    %eax,%edi
+  804783:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  80478a:	00 00 00 
+  80478d:	ff d0                	call   *%rax
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80478f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804793:	8b 00                	mov    (%rax),%eax
+  804795:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  80479a:	89 c6                	mov    %eax,%esi
+  80479c:	48 b8 e8 7a 80 00 00 	movabs $0x807ae8,%rax
+  8047a3:	00 00 00 
+  8047a6:	48 89 c7             	mov    %rax,%rdi
+  8047a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047ae:	48 b9 81 05 80 00 00 	movabs $0x800581,%rcx
+  8047b5:	00 00 00 
+  8047b8:	ff d1                	call   *%rcx
+    return -E_NOT_EXEC;
+  8047ba:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+  8047bf:	e9 a9 03 00 00       	jmp    804b6d <spawn+0x47b>
+  __asm __volatile("int %2"
+  8047c4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8047c9:	cd 30                	int    $0x30
+  8047cb:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  return ret;
+  8047ce:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  8047d1:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8047d4:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8047d8:	79 08                	jns    8047e2 <spawn+0xf0>
+    return r;
+  8047da:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8047dd:	e9 8b 03 00 00       	jmp    804b6d <spawn+0x47b>
+  child = r;
+  8047e2:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8047e5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+  // Set up trap frame, including initial stack.
+  child_tf        = envs[ENVX(child)].env_tf;
+  8047e8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8047eb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8047f0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8047f7:	00 00 00 
+  8047fa:	48 98                	cltq
+  8047fc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804803:	48 01 d0             	add    %rdx,%rax
+  804806:	48 8b 08             	mov    (%rax),%rcx
+  804809:	48 8b 58 08          	mov    0x8(%rax),%rbx
+  80480d:	48 89 8d f0 fc ff ff 	mov    %rcx,-0x310(%rbp)
+  804814:	48 89 9d f8 fc ff ff 	mov    %rbx,-0x308(%rbp)
+  80481b:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  80481f:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  804823:	48 89 8d 00 fd ff ff 	mov    %rcx,-0x300(%rbp)
+  80482a:	48 89 9d 08 fd ff ff 	mov    %rbx,-0x2f8(%rbp)
+  804831:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  804835:	48 8b 58 28          	mov    0x28(%rax),%rbx
+  804839:	48 89 8d 10 fd ff ff 	mov    %rcx,-0x2f0(%rbp)
+  804840:	48 89 9d 18 fd ff ff 	mov    %rbx,-0x2e8(%rbp)
+  804847:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80484b:	48 8b 58 38          	mov    0x38(%rax),%rbx
+  80484f:	48 89 8d 20 fd ff ff 	mov    %rcx,-0x2e0(%rbp)
+  804856:	48 89 9d 28 fd ff ff 	mov    %rbx,-0x2d8(%rbp)
+  80485d:	48 8b 48 40          	mov    0x40(%rax),%rcx
+  804861:	48 8b 58 48          	mov    0x48(%rax),%rbx
+  804865:	48 89 8d 30 fd ff ff 	mov    %rcx,-0x2d0(%rbp)
+  80486c:	48 89 9d 38 fd ff ff 	mov    %rbx,-0x2c8(%rbp)
+  804873:	48 8b 48 50          	mov    0x50(%rax),%rcx
+  804877:	48 8b 58 58          	mov    0x58(%rax),%rbx
+  80487b:	48 89 8d 40 fd ff ff 	mov    %rcx,-0x2c0(%rbp)
+  804882:	48 89 9d 48 fd ff ff 	mov    %rbx,-0x2b8(%rbp)
+  804889:	48 8b 48 60          	mov    0x60(%rax),%rcx
+  80488d:	48 8b 58 68          	mov    0x68(%rax),%rbx
+  804891:	48 89 8d 50 fd ff ff 	mov    %rcx,-0x2b0(%rbp)
+  804898:	48 89 9d 58 fd ff ff 	mov    %rbx,-0x2a8(%rbp)
+  80489f:	48 8b 48 70          	mov    0x70(%rax),%rcx
+  8048a3:	48 8b 58 78          	mov    0x78(%rax),%rbx
+  8048a7:	48 89 8d 60 fd ff ff 	mov    %rcx,-0x2a0(%rbp)
+  8048ae:	48 89 9d 68 fd ff ff 	mov    %rbx,-0x298(%rbp)
+  8048b5:	48 8b 88 80 00 00 00 	mov    0x80(%rax),%rcx
+  8048bc:	48 8b 98 88 00 00 00 	mov    0x88(%rax),%rbx
+  8048c3:	48 89 8d 70 fd ff ff 	mov    %rcx,-0x290(%rbp)
+  8048ca:	48 89 9d 78 fd ff ff 	mov    %rbx,-0x288(%rbp)
+  8048d1:	48 8b 88 90 00 00 00 	mov    0x90(%rax),%rcx
+  8048d8:	48 8b 98 98 00 00 00 	mov    0x98(%rax),%rbx
+  8048df:	48 89 8d 80 fd ff ff 	mov    %rcx,-0x280(%rbp)
+  8048e6:	48 89 9d 88 fd ff ff 	mov    %rbx,-0x278(%rbp)
+  8048ed:	48 8b 88 a0 00 00 00 	mov    0xa0(%rax),%rcx
+  8048f4:	48 8b 98 a8 00 00 00 	mov    0xa8(%rax),%rbx
+  8048fb:	48 89 8d 90 fd ff ff 	mov    %rcx,-0x270(%rbp)
+  804902:	48 89 9d 98 fd ff ff 	mov    %rbx,-0x268(%rbp)
+  804909:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  804910:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  804917:	48 89 85 a0 fd ff ff 	mov    %rax,-0x260(%rbp)
+  80491e:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  child_tf.tf_rip = elf->e_entry;
+  804925:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804929:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80492d:	48 89 85 88 fd ff ff 	mov    %rax,-0x278(%rbp)
+
+  // *p to avoid "error: taking address of packed member of
+  //    ‘struct Trapframe’ may result in an unaligned pointer value"
+  void *p = &child_tf.tf_rsp;
+  804934:	48 8d 85 f0 fc ff ff 	lea    -0x310(%rbp),%rax
+  80493b:	48 05 b0 00 00 00    	add    $0xb0,%rax
+  804941:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if ((r = init_stack(child, argv, p)) < 0)
+  804945:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804949:	48 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%rcx
+  804950:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804953:	48 89 ce             	mov    %rcx,%rsi
+  804956:	89 c7                	mov    %eax,%edi
+  804958:	48 b8 d5 4d 80 00 00 	movabs $0x804dd5,%rax
+  80495f:	00 00 00 
+  804962:	ff d0                	call   *%rax
+  804964:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804967:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80496b:	79 08                	jns    804975 <spawn+0x283>
+    return r;
+  80496d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804970:	e9 f8 01 00 00       	jmp    804b6d <spawn+0x47b>
+
+  // Set up program segments as defined in ELF header.
+  ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804975:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804979:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80497d:	48 8d 95 b0 fd ff ff 	lea    -0x250(%rbp),%rdx
+  804984:	48 01 d0             	add    %rdx,%rax
+  804987:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80498b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  804992:	e9 80 00 00 00       	jmp    804a17 <spawn+0x325>
+    if (ph->p_type != ELF_PROG_LOAD)
+  804997:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80499b:	8b 00                	mov    (%rax),%eax
+  80499d:	83 f8 01             	cmp    $0x1,%eax
+  8049a0:	75 6b                	jne    804a0d <spawn+0x31b>
+      continue;
+    perm = PTE_P | PTE_U;
+  8049a2:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8049a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049ad:	8b 40 04             	mov    0x4(%rax),%eax
+  8049b0:	83 e0 02             	and    $0x2,%eax
+  8049b3:	85 c0                	test   %eax,%eax
+  8049b5:	74 04                	je     8049bb <spawn+0x2c9>
+      perm |= PTE_W;
+  8049b7:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+                         fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  8049bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049bf:	48 8b 40 08          	mov    0x8(%rax),%rax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8049c3:	41 89 c1             	mov    %eax,%r9d
+  8049c6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049ca:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  8049ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049d2:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  8049d6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049da:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  8049de:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  8049e1:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8049e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8049e8:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8049eb:	57                   	push   %rdi
+  8049ec:	89 c7                	mov    %eax,%edi
+  8049ee:	48 b8 1d 51 80 00 00 	movabs $0x80511d,%rax
+  8049f5:	00 00 00 
+  8049f8:	ff d0                	call   *%rax
+  8049fa:	48 83 c4 10          	add    $0x10,%rsp
+  8049fe:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804a01:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804a05:	0f 88 3c 01 00 00    	js     804b47 <spawn+0x455>
+  804a0b:	eb 01                	jmp    804a0e <spawn+0x31c>
+      continue;
+  804a0d:	90                   	nop
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  804a0e:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  804a12:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  804a17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a1b:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  804a1f:	0f b7 c0             	movzwl %ax,%eax
+  804a22:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804a25:	0f 8c 6c ff ff ff    	jl     804997 <spawn+0x2a5>
+        goto error;
+    }
+  }
+#endif
+
+  close(fd);
+  804a2b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804a2e:	89 c7                	mov    %eax,%edi
+  804a30:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  804a37:	00 00 00 
+  804a3a:	ff d0                	call   *%rax
+  fd = -1;
+  804a3c:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+  // Copy shared library state.
+  if ((r = copy_shared_pages(child)) < 0)
+  804a43:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a46:	89 c7                	mov    %eax,%edi
+  804a48:	48 b8 0b 53 80 00 00 	movabs $0x80530b,%rax
+  804a4f:	00 00 00 
+  804a52:	ff d0                	call   *%rax
+  804a54:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804a57:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804a5b:	79 36                	jns    804a93 <spawn+0x3a1>
+    panic("copy_shared_pages: %i", r);
+  804a5d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804a60:	89 c1                	mov    %eax,%ecx
+  804a62:	48 b8 02 7b 80 00 00 	movabs $0x807b02,%rax
+  804a69:	00 00 00 
+  804a6c:	48 89 c2             	mov    %rax,%rdx
+  804a6f:	be 9f 00 00 00       	mov    $0x9f,%esi
+  804a74:	48 b8 18 7b 80 00 00 	movabs $0x807b18,%rax
+  804a7b:	00 00 00 
+  804a7e:	48 89 c7             	mov    %rax,%rdi
+  804a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a86:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  804a8d:	00 00 00 
+  804a90:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  804a93:	48 8d 95 f0 fc ff ff 	lea    -0x310(%rbp),%rdx
+  804a9a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804a9d:	48 89 d6             	mov    %rdx,%rsi
+  804aa0:	89 c7                	mov    %eax,%edi
+  804aa2:	48 b8 50 24 80 00 00 	movabs $0x802450,%rax
+  804aa9:	00 00 00 
+  804aac:	ff d0                	call   *%rax
+  804aae:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804ab1:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804ab5:	79 36                	jns    804aed <spawn+0x3fb>
+    panic("sys_env_set_trapframe: %i", r);
+  804ab7:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804aba:	89 c1                	mov    %eax,%ecx
+  804abc:	48 b8 24 7b 80 00 00 	movabs $0x807b24,%rax
+  804ac3:	00 00 00 
+  804ac6:	48 89 c2             	mov    %rax,%rdx
+  804ac9:	be a2 00 00 00       	mov    $0xa2,%esi
+  804ace:	48 b8 18 7b 80 00 00 	movabs $0x807b18,%rax
+  804ad5:	00 00 00 
+  804ad8:	48 89 c7             	mov    %rax,%rdi
+  804adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae0:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  804ae7:	00 00 00 
+  804aea:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  804aed:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804af0:	be 02 00 00 00       	mov    $0x2,%esi
+  804af5:	89 c7                	mov    %eax,%edi
+  804af7:	48 b8 03 24 80 00 00 	movabs $0x802403,%rax
+  804afe:	00 00 00 
+  804b01:	ff d0                	call   *%rax
+  804b03:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804b06:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804b0a:	79 36                	jns    804b42 <spawn+0x450>
+    panic("sys_env_set_status: %i", r);
+  804b0c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804b0f:	89 c1                	mov    %eax,%ecx
+  804b11:	48 b8 3e 7b 80 00 00 	movabs $0x807b3e,%rax
+  804b18:	00 00 00 
+  804b1b:	48 89 c2             	mov    %rax,%rdx
+  804b1e:	be a5 00 00 00       	mov    $0xa5,%esi
+  804b23:	48 b8 18 7b 80 00 00 	movabs $0x807b18,%rax
+  804b2a:	00 00 00 
+  804b2d:	48 89 c7             	mov    %rax,%rdi
+  804b30:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b35:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  804b3c:	00 00 00 
+  804b3f:	41 ff d0             	call   *%r8
+
+  return child;
+  804b42:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804b45:	eb 26                	jmp    804b6d <spawn+0x47b>
+      goto error;
+  804b47:	90                   	nop
+
+error:
+  sys_env_destroy(child);
+  804b48:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804b4b:	89 c7                	mov    %eax,%edi
+  804b4d:	48 b8 71 21 80 00 00 	movabs $0x802171,%rax
+  804b54:	00 00 00 
+  804b57:	ff d0                	call   *%rax
+  close(fd);
+  804b59:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804b5c:	89 c7                	mov    %eax,%edi
+  804b5e:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  804b65:	00 00 00 
+  804b68:	ff d0                	call   *%rax
+  return r;
+  804b6a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  804b6d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804b71:	c9                   	leave
+  804b72:	c3                   	ret
+
+0000000000804b73 <spawnl>:
+
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...) {
+  804b73:	55                   	push   %rbp
+  804b74:	48 89 e5             	mov    %rsp,%rbp
+  804b77:	41 55                	push   %r13
+  804b79:	41 54                	push   %r12
+  804b7b:	53                   	push   %rbx
+  804b7c:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804b83:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+  804b8a:	48 89 b5 f0 fe ff ff 	mov    %rsi,-0x110(%rbp)
+  804b91:	48 89 95 40 ff ff ff 	mov    %rdx,-0xc0(%rbp)
+  804b98:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  804b9f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  804ba6:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  804bad:	84 c0                	test   %al,%al
+  804baf:	74 26                	je     804bd7 <spawnl+0x64>
+  804bb1:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  804bb8:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  804bbf:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  804bc3:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  804bc7:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  804bcb:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  804bcf:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  804bd3:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+  804bd7:	48 89 e0             	mov    %rsp,%rax
+  804bda:	48 89 c3             	mov    %rax,%rbx
+  // We calculate argc by advancing the args until we hit NULL.
+  // The contract of the function guarantees that the last
+  // argument will always be NULL, and that none of the other
+  // arguments will be NULL.
+  int argc = 0;
+  804bdd:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%rbp)
+  804be4:	00 00 00 
+  va_list vl;
+  va_start(vl, arg0);
+  804be7:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  804bee:	00 00 00 
+  804bf1:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  804bf8:	00 00 00 
+  804bfb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804bff:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  804c06:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  804c0d:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  804c14:	eb 07                	jmp    804c1d <spawnl+0xaa>
+    argc++;
+  804c16:	83 85 2c ff ff ff 01 	addl   $0x1,-0xd4(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  804c1d:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  804c23:	83 f8 2f             	cmp    $0x2f,%eax
+  804c26:	77 23                	ja     804c4b <spawnl+0xd8>
+  804c28:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  804c2f:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804c35:	89 d2                	mov    %edx,%edx
+  804c37:	48 01 d0             	add    %rdx,%rax
+  804c3a:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804c40:	83 c2 08             	add    $0x8,%edx
+  804c43:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  804c49:	eb 12                	jmp    804c5d <spawnl+0xea>
+  804c4b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804c52:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804c56:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804c5d:	48 8b 00             	mov    (%rax),%rax
+  804c60:	48 85 c0             	test   %rax,%rax
+  804c63:	75 b1                	jne    804c16 <spawnl+0xa3>
+  va_end(vl);
+
+  // Now that we have the size of the args, do a second pass
+  // and store the values in a VLA, which has the format of argv
+  const char *argv[argc + 2];
+  804c65:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804c6b:	83 c0 02             	add    $0x2,%eax
+  804c6e:	48 63 d0             	movslq %eax,%rdx
+  804c71:	48 83 ea 01          	sub    $0x1,%rdx
+  804c75:	48 89 95 20 ff ff ff 	mov    %rdx,-0xe0(%rbp)
+  804c7c:	48 63 d0             	movslq %eax,%rdx
+  804c7f:	49 89 d4             	mov    %rdx,%r12
+  804c82:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804c88:	48 63 d0             	movslq %eax,%rdx
+  804c8b:	49 89 d2             	mov    %rdx,%r10
+  804c8e:	41 bb 00 00 00 00    	mov    $0x0,%r11d
+  804c94:	48 98                	cltq
+  804c96:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804c9d:	00 
+  804c9e:	b8 10 00 00 00       	mov    $0x10,%eax
+  804ca3:	48 83 e8 01          	sub    $0x1,%rax
+  804ca7:	48 01 d0             	add    %rdx,%rax
+  804caa:	be 10 00 00 00       	mov    $0x10,%esi
+  804caf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cb4:	48 f7 f6             	div    %rsi
+  804cb7:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  804cbb:	48 29 c4             	sub    %rax,%rsp
+  804cbe:	48 89 e0             	mov    %rsp,%rax
+  804cc1:	48 83 c0 07          	add    $0x7,%rax
+  804cc5:	48 c1 e8 03          	shr    $0x3,%rax
+  804cc9:	48 c1 e0 03          	shl    $0x3,%rax
+  804ccd:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+  argv[0]        = arg0;
+  804cd4:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804cdb:	48 8b 95 f0 fe ff ff 	mov    -0x110(%rbp),%rdx
+  804ce2:	48 89 10             	mov    %rdx,(%rax)
+  argv[argc + 1] = NULL;
+  804ce5:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804ceb:	8d 50 01             	lea    0x1(%rax),%edx
+  804cee:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804cf5:	48 63 d2             	movslq %edx,%rdx
+  804cf8:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  804cff:	00 
+
+  va_start(vl, arg0);
+  804d00:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  804d07:	00 00 00 
+  804d0a:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  804d11:	00 00 00 
+  804d14:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804d18:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  804d1f:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  804d26:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  unsigned i;
+  for (i = 0; i < argc; i++)
+  804d2d:	c7 85 28 ff ff ff 00 	movl   $0x0,-0xd8(%rbp)
+  804d34:	00 00 00 
+  804d37:	eb 60                	jmp    804d99 <spawnl+0x226>
+    argv[i + 1] = va_arg(vl, const char *);
+  804d39:	8b 85 28 ff ff ff    	mov    -0xd8(%rbp),%eax
+  804d3f:	8d 48 01             	lea    0x1(%rax),%ecx
+  804d42:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  804d48:	83 f8 2f             	cmp    $0x2f,%eax
+  804d4b:	77 23                	ja     804d70 <spawnl+0x1fd>
+  804d4d:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  804d54:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804d5a:	89 d2                	mov    %edx,%edx
+  804d5c:	48 01 d0             	add    %rdx,%rax
+  804d5f:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  804d65:	83 c2 08             	add    $0x8,%edx
+  804d68:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  804d6e:	eb 12                	jmp    804d82 <spawnl+0x20f>
+  804d70:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804d77:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  804d7b:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804d82:	48 8b 10             	mov    (%rax),%rdx
+  804d85:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804d8c:	89 c9                	mov    %ecx,%ecx
+  804d8e:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+  for (i = 0; i < argc; i++)
+  804d92:	83 85 28 ff ff ff 01 	addl   $0x1,-0xd8(%rbp)
+  804d99:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  804d9f:	39 85 28 ff ff ff    	cmp    %eax,-0xd8(%rbp)
+  804da5:	72 92                	jb     804d39 <spawnl+0x1c6>
+  va_end(vl);
+  return spawn(prog, argv);
+  804da7:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  804dae:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  804db5:	48 89 d6             	mov    %rdx,%rsi
+  804db8:	48 89 c7             	mov    %rax,%rdi
+  804dbb:	48 b8 f2 46 80 00 00 	movabs $0x8046f2,%rax
+  804dc2:	00 00 00 
+  804dc5:	ff d0                	call   *%rax
+  804dc7:	48 89 dc             	mov    %rbx,%rsp
+}
+  804dca:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  804dce:	5b                   	pop    %rbx
+  804dcf:	41 5c                	pop    %r12
+  804dd1:	41 5d                	pop    %r13
+  804dd3:	5d                   	pop    %rbp
+  804dd4:	c3                   	ret
+
+0000000000804dd5 <init_stack>:
+//
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp) {
+  804dd5:	55                   	push   %rbp
+  804dd6:	48 89 e5             	mov    %rsp,%rbp
+  804dd9:	48 83 ec 50          	sub    $0x50,%rsp
+  804ddd:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804de0:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804de4:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  char *string_store;
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  804de8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804def:	00 
+  for (argc = 0; argv[argc] != 0; argc++)
+  804df0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  804df7:	eb 33                	jmp    804e2c <init_stack+0x57>
+    string_size += strlen(argv[argc]) + 1;
+  804df9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804dfc:	48 98                	cltq
+  804dfe:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804e05:	00 
+  804e06:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e0a:	48 01 d0             	add    %rdx,%rax
+  804e0d:	48 8b 00             	mov    (%rax),%rax
+  804e10:	48 89 c7             	mov    %rax,%rdi
+  804e13:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  804e1a:	00 00 00 
+  804e1d:	ff d0                	call   *%rax
+  804e1f:	83 c0 01             	add    $0x1,%eax
+  804e22:	48 98                	cltq
+  804e24:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  for (argc = 0; argv[argc] != 0; argc++)
+  804e28:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804e2c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804e2f:	48 98                	cltq
+  804e31:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804e38:	00 
+  804e39:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e3d:	48 01 d0             	add    %rdx,%rax
+  804e40:	48 8b 00             	mov    (%rax),%rax
+  804e43:	48 85 c0             	test   %rax,%rax
+  804e46:	75 b1                	jne    804df9 <init_stack+0x24>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - USTACKSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *)UTEMP + USTACKSIZE - string_size;
+  804e48:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e4c:	48 f7 d8             	neg    %rax
+  804e4f:	48 05 00 40 40 00    	add    $0x404000,%rax
+  804e55:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *)(ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  804e59:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804e5d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804e61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e65:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  804e69:	48 89 c2             	mov    %rax,%rdx
+  804e6c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804e6f:	83 c0 01             	add    $0x1,%eax
+  804e72:	c1 e0 03             	shl    $0x3,%eax
+  804e75:	48 98                	cltq
+  804e77:	48 f7 d8             	neg    %rax
+  804e7a:	48 01 d0             	add    %rdx,%rax
+  804e7d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *)(argv_store - 2) < (void *)UTEMP)
+  804e81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e85:	48 83 e8 10          	sub    $0x10,%rax
+  804e89:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  804e8f:	77 0a                	ja     804e9b <init_stack+0xc6>
+    return -E_NO_MEM;
+  804e91:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  804e96:	e9 80 02 00 00       	jmp    80511b <init_stack+0x346>
+
+  // Allocate the stack pages at UTEMP.
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804e9b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  804ea2:	eb 3c                	jmp    804ee0 <init_stack+0x10b>
+    if ((r = sys_page_alloc(0, (void *)UTEMP + i, PTE_P | PTE_U | PTE_W)) < 0)
+  804ea4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804ea7:	48 98                	cltq
+  804ea9:	48 05 00 00 40 00    	add    $0x400000,%rax
+  804eaf:	ba 07 00 00 00       	mov    $0x7,%edx
+  804eb4:	48 89 c6             	mov    %rax,%rsi
+  804eb7:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ebc:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  804ec3:	00 00 00 
+  804ec6:	ff d0                	call   *%rax
+  804ec8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804ecb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804ecf:	79 08                	jns    804ed9 <init_stack+0x104>
+      return r;
+  804ed1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804ed4:	e9 42 02 00 00       	jmp    80511b <init_stack+0x346>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  804ed9:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  804ee0:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  804ee7:	7e bb                	jle    804ea4 <init_stack+0xcf>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  804ee9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  804ef0:	e9 8f 00 00 00       	jmp    804f84 <init_stack+0x1af>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  804ef5:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  804efc:	00 00 00 
+  804eff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f03:	48 01 d0             	add    %rdx,%rax
+  804f06:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  804f0d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804f10:	48 98                	cltq
+  804f12:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  804f19:	00 
+  804f1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804f1e:	48 01 c8             	add    %rcx,%rax
+  804f21:	48 89 10             	mov    %rdx,(%rax)
+    strcpy(string_store, argv[i]);
+  804f24:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804f27:	48 98                	cltq
+  804f29:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804f30:	00 
+  804f31:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f35:	48 01 d0             	add    %rdx,%rax
+  804f38:	48 8b 10             	mov    (%rax),%rdx
+  804f3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804f3f:	48 89 d6             	mov    %rdx,%rsi
+  804f42:	48 89 c7             	mov    %rax,%rdi
+  804f45:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  804f4c:	00 00 00 
+  804f4f:	ff d0                	call   *%rax
+    string_store += strlen(argv[i]) + 1;
+  804f51:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804f54:	48 98                	cltq
+  804f56:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804f5d:	00 
+  804f5e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804f62:	48 01 d0             	add    %rdx,%rax
+  804f65:	48 8b 00             	mov    (%rax),%rax
+  804f68:	48 89 c7             	mov    %rax,%rdi
+  804f6b:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  804f72:	00 00 00 
+  804f75:	ff d0                	call   *%rax
+  804f77:	83 c0 01             	add    $0x1,%eax
+  804f7a:	48 98                	cltq
+  804f7c:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+  for (i = 0; i < argc; i++) {
+  804f80:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+  804f84:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804f87:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  804f8a:	0f 8c 65 ff ff ff    	jl     804ef5 <init_stack+0x120>
+  }
+  argv_store[argc] = 0;
+  804f90:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804f93:	48 98                	cltq
+  804f95:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804f9c:	00 
+  804f9d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804fa1:	48 01 d0             	add    %rdx,%rax
+  804fa4:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  assert(string_store == (char *)UTEMP + USTACKSIZE);
+  804fab:	48 81 7d e0 00 40 40 	cmpq   $0x404000,-0x20(%rbp)
+  804fb2:	00 
+  804fb3:	74 3e                	je     804ff3 <init_stack+0x21e>
+  804fb5:	48 b8 58 7b 80 00 00 	movabs $0x807b58,%rax
+  804fbc:	00 00 00 
+  804fbf:	48 89 c1             	mov    %rax,%rcx
+  804fc2:	48 b8 83 7b 80 00 00 	movabs $0x807b83,%rax
+  804fc9:	00 00 00 
+  804fcc:	48 89 c2             	mov    %rax,%rdx
+  804fcf:	be 0c 01 00 00       	mov    $0x10c,%esi
+  804fd4:	48 b8 18 7b 80 00 00 	movabs $0x807b18,%rax
+  804fdb:	00 00 00 
+  804fde:	48 89 c7             	mov    %rax,%rdi
+  804fe1:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fe6:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  804fed:	00 00 00 
+  804ff0:	41 ff d0             	call   *%r8
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  804ff3:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  804ffa:	00 00 00 
+  804ffd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805001:	48 01 d0             	add    %rdx,%rax
+  805004:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  80500b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80500f:	48 83 e8 08          	sub    $0x8,%rax
+  805013:	48 89 10             	mov    %rdx,(%rax)
+  argv_store[-2] = argc;
+  805016:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80501a:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  80501e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805021:	48 98                	cltq
+  805023:	48 89 02             	mov    %rax,(%rdx)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  805026:	48 ba f0 6f ff ff 7f 	movabs $0x7fffff6ff0,%rdx
+  80502d:	00 00 00 
+  805030:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805034:	48 01 d0             	add    %rdx,%rax
+  805037:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  80503d:	48 89 c2             	mov    %rax,%rdx
+  805040:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805044:	48 89 10             	mov    %rdx,(%rax)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  805047:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  80504e:	eb 78                	jmp    8050c8 <init_stack+0x2f3>
+    if ((r = sys_page_map(0, UTEMP + i, child, (void *)(USTACKTOP - USTACKSIZE + i), PTE_P | PTE_U | PTE_W)) < 0)
+  805050:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  805053:	48 98                	cltq
+  805055:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  80505c:	00 00 00 
+  80505f:	48 01 d0             	add    %rdx,%rax
+  805062:	48 89 c2             	mov    %rax,%rdx
+  805065:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  805068:	48 98                	cltq
+  80506a:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  805071:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  805074:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  80507a:	48 89 d1             	mov    %rdx,%rcx
+  80507d:	89 c2                	mov    %eax,%edx
+  80507f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805084:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  80508b:	00 00 00 
+  80508e:	ff d0                	call   *%rax
+  805090:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805093:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805097:	78 43                	js     8050dc <init_stack+0x307>
+      goto error;
+    if ((r = sys_page_unmap(0, UTEMP + i)) < 0)
+  805099:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80509c:	48 98                	cltq
+  80509e:	48 05 00 00 40 00    	add    $0x400000,%rax
+  8050a4:	48 89 c6             	mov    %rax,%rsi
+  8050a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050ac:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  8050b3:	00 00 00 
+  8050b6:	ff d0                	call   *%rax
+  8050b8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8050bb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8050bf:	78 1e                	js     8050df <init_stack+0x30a>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  8050c1:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  8050c8:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  8050cf:	0f 8e 7b ff ff ff    	jle    805050 <init_stack+0x27b>
+      goto error;
+  }
+
+  return 0;
+  8050d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050da:	eb 3f                	jmp    80511b <init_stack+0x346>
+      goto error;
+  8050dc:	90                   	nop
+  8050dd:	eb 01                	jmp    8050e0 <init_stack+0x30b>
+      goto error;
+  8050df:	90                   	nop
+
+error:
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  8050e0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  8050e7:	eb 26                	jmp    80510f <init_stack+0x33a>
+    sys_page_unmap(0, UTEMP + i);
+  8050e9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8050ec:	48 98                	cltq
+  8050ee:	48 05 00 00 40 00    	add    $0x400000,%rax
+  8050f4:	48 89 c6             	mov    %rax,%rsi
+  8050f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050fc:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  805103:	00 00 00 
+  805106:	ff d0                	call   *%rax
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  805108:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  80510f:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  805116:	7e d1                	jle    8050e9 <init_stack+0x314>
+  return r;
+  805118:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80511b:	c9                   	leave
+  80511c:	c3                   	ret
+
+000000000080511d <map_segment>:
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+            int fd, size_t filesz, off_t fileoffset, int perm) {
+  80511d:	55                   	push   %rbp
+  80511e:	48 89 e5             	mov    %rsp,%rbp
+  805121:	48 83 ec 50          	sub    $0x50,%rsp
+  805125:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  805128:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80512c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  805130:	89 4d d8             	mov    %ecx,-0x28(%rbp)
+  805133:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  805137:	44 89 4d bc          	mov    %r9d,-0x44(%rbp)
+  int i, r;
+
+  //cprintf("map_segment %x+%x\n", va, memsz);
+
+  if ((i = PGOFF(va))) {
+  80513b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80513f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  805144:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805147:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80514b:	74 21                	je     80516e <map_segment+0x51>
+    va -= i;
+  80514d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805150:	48 98                	cltq
+  805152:	48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    memsz += i;
+  805156:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805159:	48 98                	cltq
+  80515b:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    filesz += i;
+  80515f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805162:	48 98                	cltq
+  805164:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    fileoffset -= i;
+  805168:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80516b:	29 45 bc             	sub    %eax,-0x44(%rbp)
+  }
+
+  for (i = 0; i < memsz; i += PGSIZE) {
+  80516e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805175:	e9 7b 01 00 00       	jmp    8052f5 <map_segment+0x1d8>
+    if (i >= filesz) {
+  80517a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80517d:	48 98                	cltq
+  80517f:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  805183:	72 3c                	jb     8051c1 <map_segment+0xa4>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *)(va + i), perm)) < 0)
+  805185:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805188:	48 63 d0             	movslq %eax,%rdx
+  80518b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80518f:	48 01 d0             	add    %rdx,%rax
+  805192:	48 89 c1             	mov    %rax,%rcx
+  805195:	8b 55 10             	mov    0x10(%rbp),%edx
+  805198:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80519b:	48 89 ce             	mov    %rcx,%rsi
+  80519e:	89 c7                	mov    %eax,%edi
+  8051a0:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  8051a7:	00 00 00 
+  8051aa:	ff d0                	call   *%rax
+  8051ac:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8051af:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8051b3:	0f 89 35 01 00 00    	jns    8052ee <map_segment+0x1d1>
+        return r;
+  8051b9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8051bc:	e9 48 01 00 00       	jmp    805309 <map_segment+0x1ec>
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8051c1:	ba 07 00 00 00       	mov    $0x7,%edx
+  8051c6:	be 00 00 40 00       	mov    $0x400000,%esi
+  8051cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8051d0:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  8051d7:	00 00 00 
+  8051da:	ff d0                	call   *%rax
+  8051dc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8051df:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8051e3:	79 08                	jns    8051ed <map_segment+0xd0>
+        return r;
+  8051e5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8051e8:	e9 1c 01 00 00       	jmp    805309 <map_segment+0x1ec>
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  8051ed:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  8051f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8051f3:	01 c2                	add    %eax,%edx
+  8051f5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8051f8:	89 d6                	mov    %edx,%esi
+  8051fa:	89 c7                	mov    %eax,%edi
+  8051fc:	48 b8 cf 3a 80 00 00 	movabs $0x803acf,%rax
+  805203:	00 00 00 
+  805206:	ff d0                	call   *%rax
+  805208:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80520b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80520f:	79 08                	jns    805219 <map_segment+0xfc>
+        return r;
+  805211:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805214:	e9 f0 00 00 00       	jmp    805309 <map_segment+0x1ec>
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  805219:	c7 45 f4 00 10 00 00 	movl   $0x1000,-0xc(%rbp)
+  805220:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805223:	48 98                	cltq
+  805225:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805229:	48 29 c2             	sub    %rax,%rdx
+  80522c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  805230:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805233:	48 63 d0             	movslq %eax,%rdx
+  805236:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80523a:	48 39 c2             	cmp    %rax,%rdx
+  80523d:	48 0f 47 d0          	cmova  %rax,%rdx
+  805241:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805244:	be 00 00 40 00       	mov    $0x400000,%esi
+  805249:	89 c7                	mov    %eax,%edi
+  80524b:	48 b8 54 39 80 00 00 	movabs $0x803954,%rax
+  805252:	00 00 00 
+  805255:	ff d0                	call   *%rax
+  805257:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80525a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80525e:	79 08                	jns    805268 <map_segment+0x14b>
+        return r;
+  805260:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805263:	e9 a1 00 00 00       	jmp    805309 <map_segment+0x1ec>
+      if ((r = sys_page_map(0, UTEMP, child, (void *)(va + i), perm)) < 0)
+  805268:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80526b:	48 63 d0             	movslq %eax,%rdx
+  80526e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805272:	48 01 d0             	add    %rdx,%rax
+  805275:	48 89 c1             	mov    %rax,%rcx
+  805278:	8b 55 10             	mov    0x10(%rbp),%edx
+  80527b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80527e:	41 89 d0             	mov    %edx,%r8d
+  805281:	89 c2                	mov    %eax,%edx
+  805283:	be 00 00 40 00       	mov    $0x400000,%esi
+  805288:	bf 00 00 00 00       	mov    $0x0,%edi
+  80528d:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  805294:	00 00 00 
+  805297:	ff d0                	call   *%rax
+  805299:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80529c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8052a0:	79 36                	jns    8052d8 <map_segment+0x1bb>
+        panic("spawn: sys_page_map data: %i", r);
+  8052a2:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8052a5:	89 c1                	mov    %eax,%ecx
+  8052a7:	48 b8 98 7b 80 00 00 	movabs $0x807b98,%rax
+  8052ae:	00 00 00 
+  8052b1:	48 89 c2             	mov    %rax,%rdx
+  8052b4:	be 40 01 00 00       	mov    $0x140,%esi
+  8052b9:	48 b8 18 7b 80 00 00 	movabs $0x807b18,%rax
+  8052c0:	00 00 00 
+  8052c3:	48 89 c7             	mov    %rax,%rdi
+  8052c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052cb:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  8052d2:	00 00 00 
+  8052d5:	41 ff d0             	call   *%r8
+      sys_page_unmap(0, UTEMP);
+  8052d8:	be 00 00 40 00       	mov    $0x400000,%esi
+  8052dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052e2:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  8052e9:	00 00 00 
+  8052ec:	ff d0                	call   *%rax
+  for (i = 0; i < memsz; i += PGSIZE) {
+  8052ee:	81 45 fc 00 10 00 00 	addl   $0x1000,-0x4(%rbp)
+  8052f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8052f8:	48 98                	cltq
+  8052fa:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  8052fe:	0f 82 76 fe ff ff    	jb     80517a <map_segment+0x5d>
+    }
+  }
+  return 0;
+  805304:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805309:	c9                   	leave
+  80530a:	c3                   	ret
+
+000000000080530b <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child) {
+  80530b:	55                   	push   %rbp
+  80530c:	48 89 e5             	mov    %rsp,%rbp
+  80530f:	48 83 ec 20          	sub    $0x20,%rsp
+  805313:	89 7d ec             	mov    %edi,-0x14(%rbp)
+
+  int err = 0;
+  805316:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  80531d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805324:	00 
+  805325:	e9 e7 00 00 00       	jmp    805411 <copy_shared_pages+0x106>
+    if (!(uvpml4e[VPML4E(i)] & PTE_P) || !(uvpde[VPDPE(i)] & PTE_P) || !(uvpd[VPD(i)] & PTE_P)) {
+  80532a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80532e:	48 c1 e8 27          	shr    $0x27,%rax
+  805332:	48 89 c2             	mov    %rax,%rdx
+  805335:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80533c:	01 00 00 
+  80533f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805343:	83 e0 01             	and    $0x1,%eax
+  805346:	48 85 c0             	test   %rax,%rax
+  805349:	0f 84 b9 00 00 00    	je     805408 <copy_shared_pages+0xfd>
+  80534f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805353:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805357:	48 89 c2             	mov    %rax,%rdx
+  80535a:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805361:	01 00 00 
+  805364:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805368:	83 e0 01             	and    $0x1,%eax
+  80536b:	48 85 c0             	test   %rax,%rax
+  80536e:	0f 84 94 00 00 00    	je     805408 <copy_shared_pages+0xfd>
+  805374:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805378:	48 c1 e8 15          	shr    $0x15,%rax
+  80537c:	48 89 c2             	mov    %rax,%rdx
+  80537f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805386:	01 00 00 
+  805389:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80538d:	83 e0 01             	and    $0x1,%eax
+  805390:	48 85 c0             	test   %rax,%rax
+  805393:	74 73                	je     805408 <copy_shared_pages+0xfd>
+      continue;
+    }
+    if ((uvpt[VPN(i)] & (PTE_P | PTE_SHARE)) == (PTE_P | PTE_SHARE)) {
+  805395:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805399:	48 c1 e8 0c          	shr    $0xc,%rax
+  80539d:	48 89 c2             	mov    %rax,%rdx
+  8053a0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8053a7:	01 00 00 
+  8053aa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8053ae:	25 01 04 00 00       	and    $0x401,%eax
+  8053b3:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  8053b9:	75 4e                	jne    805409 <copy_shared_pages+0xfe>
+      err = sys_page_map(0, (void *)i, child, (void *)i, uvpt[VPN(i)] & PTE_SYSCALL);
+  8053bb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053bf:	48 c1 e8 0c          	shr    $0xc,%rax
+  8053c3:	48 89 c2             	mov    %rax,%rdx
+  8053c6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8053cd:	01 00 00 
+  8053d0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8053d4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8053d9:	89 c6                	mov    %eax,%esi
+  8053db:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8053df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053e3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8053e6:	41 89 f0             	mov    %esi,%r8d
+  8053e9:	48 89 c6             	mov    %rax,%rsi
+  8053ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053f1:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  8053f8:	00 00 00 
+  8053fb:	ff d0                	call   *%rax
+  8053fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      if (err < 0)
+  805400:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805404:	78 21                	js     805427 <copy_shared_pages+0x11c>
+  805406:	eb 01                	jmp    805409 <copy_shared_pages+0xfe>
+      continue;
+  805408:	90                   	nop
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  805409:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  805410:	00 
+  805411:	48 b8 ff ff ff ff 7f 	movabs $0x7fffffffff,%rax
+  805418:	00 00 00 
+  80541b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  80541f:	0f 83 05 ff ff ff    	jae    80532a <copy_shared_pages+0x1f>
+  805425:	eb 01                	jmp    805428 <copy_shared_pages+0x11d>
+        break;
+  805427:	90                   	nop
+    }
+  }
+  return err;
+  805428:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80542b:	c9                   	leave
+  80542c:	c3                   	ret
+
+000000000080542d <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80542d:	55                   	push   %rbp
+  80542e:	48 89 e5             	mov    %rsp,%rbp
+  805431:	48 83 ec 10          	sub    $0x10,%rsp
+  805435:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  805439:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80543d:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  805442:	48 89 c7             	mov    %rax,%rdi
+  805445:	48 b8 53 54 80 00 00 	movabs $0x805453,%rax
+  80544c:	00 00 00 
+  80544f:	ff d0                	call   *%rax
+}
+  805451:	c9                   	leave
+  805452:	c3                   	ret
+
+0000000000805453 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  805453:	55                   	push   %rbp
+  805454:	48 89 e5             	mov    %rsp,%rbp
+  805457:	48 83 ec 50          	sub    $0x50,%rsp
+  80545b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80545f:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  805463:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80546a:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80546b:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  805470:	74 0a                	je     80547c <pipe_size+0x29>
+  805472:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  805479:	00 
+  80547a:	76 0a                	jbe    805486 <pipe_size+0x33>
+    return -E_INVAL;
+  80547c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805481:	e9 cc 02 00 00       	jmp    805752 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  805486:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  80548a:	48 89 c7             	mov    %rax,%rdi
+  80548d:	48 b8 14 32 80 00 00 	movabs $0x803214,%rax
+  805494:	00 00 00 
+  805497:	ff d0                	call   *%rax
+  805499:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80549c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054a0:	0f 88 a8 02 00 00    	js     80574e <pipe_size+0x2fb>
+  8054a6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8054aa:	ba 07 04 00 00       	mov    $0x407,%edx
+  8054af:	48 89 c6             	mov    %rax,%rsi
+  8054b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054b7:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  8054be:	00 00 00 
+  8054c1:	ff d0                	call   *%rax
+  8054c3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8054c6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054ca:	0f 88 7e 02 00 00    	js     80574e <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8054d0:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8054d4:	48 89 c7             	mov    %rax,%rdi
+  8054d7:	48 b8 14 32 80 00 00 	movabs $0x803214,%rax
+  8054de:	00 00 00 
+  8054e1:	ff d0                	call   *%rax
+  8054e3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8054e6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054ea:	0f 88 43 02 00 00    	js     805733 <pipe_size+0x2e0>
+  8054f0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8054f4:	ba 07 04 00 00       	mov    $0x407,%edx
+  8054f9:	48 89 c6             	mov    %rax,%rsi
+  8054fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  805501:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  805508:	00 00 00 
+  80550b:	ff d0                	call   *%rax
+  80550d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805510:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805514:	0f 88 19 02 00 00    	js     805733 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  80551a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80551e:	48 89 c7             	mov    %rax,%rdi
+  805521:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  805528:	00 00 00 
+  80552b:	ff d0                	call   *%rax
+  80552d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  805531:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805538:	00 
+  805539:	e9 a2 00 00 00       	jmp    8055e0 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80553e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805542:	48 c1 e0 0c          	shl    $0xc,%rax
+  805546:	48 89 c2             	mov    %rax,%rdx
+  805549:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80554d:	48 01 d0             	add    %rdx,%rax
+  805550:	ba 07 04 00 00       	mov    $0x407,%edx
+  805555:	48 89 c6             	mov    %rax,%rsi
+  805558:	bf 00 00 00 00       	mov    $0x0,%edi
+  80555d:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  805564:	00 00 00 
+  805567:	ff d0                	call   *%rax
+  805569:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80556c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805570:	0f 88 37 01 00 00    	js     8056ad <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  805576:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80557a:	48 89 c7             	mov    %rax,%rdi
+  80557d:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  805584:	00 00 00 
+  805587:	ff d0                	call   *%rax
+  805589:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80558d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  805591:	48 01 c2             	add    %rax,%rdx
+  805594:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805598:	48 c1 e0 0c          	shl    $0xc,%rax
+  80559c:	48 89 c1             	mov    %rax,%rcx
+  80559f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055a3:	48 01 c8             	add    %rcx,%rax
+  8055a6:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8055ac:	48 89 d1             	mov    %rdx,%rcx
+  8055af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8055b4:	48 89 c6             	mov    %rax,%rsi
+  8055b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055bc:	48 b8 57 23 80 00 00 	movabs $0x802357,%rax
+  8055c3:	00 00 00 
+  8055c6:	ff d0                	call   *%rax
+  8055c8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8055cb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055cf:	79 0a                	jns    8055db <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8055d1:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8055d6:	e9 d3 00 00 00       	jmp    8056ae <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8055db:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8055e0:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8055e7:	00 
+  8055e8:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8055ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055f0:	48 01 d0             	add    %rdx,%rax
+  8055f3:	48 83 c0 1f          	add    $0x1f,%rax
+  8055f7:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8055fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8055ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  805604:	48 f7 75 e0          	divq   -0x20(%rbp)
+  805608:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80560c:	48 29 d0             	sub    %rdx,%rax
+  80560f:	48 c1 e8 0c          	shr    $0xc,%rax
+  805613:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  805617:	0f 82 21 ff ff ff    	jb     80553e <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80561d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805621:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  805625:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805629:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80562d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  805631:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805635:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  80563c:	00 00 00 
+  80563f:	8b 12                	mov    (%rdx),%edx
+  805641:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  805643:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805647:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80564e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805652:	48 ba 80 80 80 00 00 	movabs $0x808080,%rdx
+  805659:	00 00 00 
+  80565c:	8b 12                	mov    (%rdx),%edx
+  80565e:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  805660:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805664:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  80566b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80566f:	48 89 c7             	mov    %rax,%rdi
+  805672:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  805679:	00 00 00 
+  80567c:	ff d0                	call   *%rax
+  80567e:	89 c2                	mov    %eax,%edx
+  805680:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805684:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  805686:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80568a:	48 89 c7             	mov    %rax,%rdi
+  80568d:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  805694:	00 00 00 
+  805697:	ff d0                	call   *%rax
+  805699:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80569d:	48 83 c2 04          	add    $0x4,%rdx
+  8056a1:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8056a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056a8:	e9 a5 00 00 00       	jmp    805752 <pipe_size+0x2ff>
+      goto err2;
+  8056ad:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8056ae:	eb 58                	jmp    805708 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8056b0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8056b4:	48 c1 e0 0c          	shl    $0xc,%rax
+  8056b8:	48 89 c2             	mov    %rax,%rdx
+  8056bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056bf:	48 01 d0             	add    %rdx,%rax
+  8056c2:	48 89 c6             	mov    %rax,%rsi
+  8056c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056ca:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  8056d1:	00 00 00 
+  8056d4:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8056d6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8056da:	48 89 c7             	mov    %rax,%rdi
+  8056dd:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  8056e4:	00 00 00 
+  8056e7:	ff d0                	call   *%rax
+  8056e9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8056ed:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8056f1:	48 01 d0             	add    %rdx,%rax
+  8056f4:	48 89 c6             	mov    %rax,%rsi
+  8056f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056fc:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  805703:	00 00 00 
+  805706:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  805708:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80570c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805710:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  805714:	48 85 c0             	test   %rax,%rax
+  805717:	75 97                	jne    8056b0 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  805719:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80571d:	48 89 c6             	mov    %rax,%rsi
+  805720:	bf 00 00 00 00       	mov    $0x0,%edi
+  805725:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  80572c:	00 00 00 
+  80572f:	ff d0                	call   *%rax
+  805731:	eb 01                	jmp    805734 <pipe_size+0x2e1>
+    goto err1;
+  805733:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  805734:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805738:	48 89 c6             	mov    %rax,%rsi
+  80573b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805740:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  805747:	00 00 00 
+  80574a:	ff d0                	call   *%rax
+  80574c:	eb 01                	jmp    80574f <pipe_size+0x2fc>
+    goto err;
+  80574e:	90                   	nop
+err:
+  return r;
+  80574f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805752:	c9                   	leave
+  805753:	c3                   	ret
+
+0000000000805754 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  805754:	55                   	push   %rbp
+  805755:	48 89 e5             	mov    %rsp,%rbp
+  805758:	53                   	push   %rbx
+  805759:	48 83 ec 28          	sub    $0x28,%rsp
+  80575d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805761:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  805765:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80576c:	00 00 00 
+  80576f:	8b 40 04             	mov    0x4(%rax),%eax
+  805772:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805777:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80577e:	00 00 00 
+  805781:	48 98                	cltq
+  805783:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80578a:	48 01 d0             	add    %rdx,%rax
+  80578d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805793:	8b 00                	mov    (%rax),%eax
+  805795:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  805798:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80579c:	48 89 c7             	mov    %rax,%rdi
+  80579f:	48 b8 8c 6c 80 00 00 	movabs $0x806c8c,%rax
+  8057a6:	00 00 00 
+  8057a9:	ff d0                	call   *%rax
+  8057ab:	89 c3                	mov    %eax,%ebx
+  8057ad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057b1:	48 89 c7             	mov    %rax,%rdi
+  8057b4:	48 b8 8c 6c 80 00 00 	movabs $0x806c8c,%rax
+  8057bb:	00 00 00 
+  8057be:	ff d0                	call   *%rax
+  8057c0:	39 c3                	cmp    %eax,%ebx
+  8057c2:	0f 94 c0             	sete   %al
+  8057c5:	0f b6 c0             	movzbl %al,%eax
+  8057c8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  8057cb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8057d2:	00 00 00 
+  8057d5:	8b 40 04             	mov    0x4(%rax),%eax
+  8057d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8057dd:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8057e4:	00 00 00 
+  8057e7:	48 98                	cltq
+  8057e9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8057f0:	48 01 d0             	add    %rdx,%rax
+  8057f3:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8057f9:	8b 00                	mov    (%rax),%eax
+  8057fb:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8057fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805801:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805804:	75 05                	jne    80580b <_pipeisclosed+0xb7>
+      return ret;
+  805806:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805809:	eb 68                	jmp    805873 <_pipeisclosed+0x11f>
+    if (n != nn)
+  80580b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80580e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805811:	0f 84 4e ff ff ff    	je     805765 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  805817:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80581e:	00 00 00 
+  805821:	8b 40 04             	mov    0x4(%rax),%eax
+  805824:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805829:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805830:	00 00 00 
+  805833:	48 98                	cltq
+  805835:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80583c:	48 01 d0             	add    %rdx,%rax
+  80583f:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805845:	8b 10                	mov    (%rax),%edx
+  805847:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  80584a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80584d:	89 c6                	mov    %eax,%esi
+  80584f:	48 b8 c0 7b 80 00 00 	movabs $0x807bc0,%rax
+  805856:	00 00 00 
+  805859:	48 89 c7             	mov    %rax,%rdi
+  80585c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805861:	49 b8 81 05 80 00 00 	movabs $0x800581,%r8
+  805868:	00 00 00 
+  80586b:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  80586e:	e9 f2 fe ff ff       	jmp    805765 <_pipeisclosed+0x11>
+  }
+}
+  805873:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805877:	c9                   	leave
+  805878:	c3                   	ret
+
+0000000000805879 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  805879:	55                   	push   %rbp
+  80587a:	48 89 e5             	mov    %rsp,%rbp
+  80587d:	48 83 ec 30          	sub    $0x30,%rsp
+  805881:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805884:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805888:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80588b:	48 89 d6             	mov    %rdx,%rsi
+  80588e:	89 c7                	mov    %eax,%edi
+  805890:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  805897:	00 00 00 
+  80589a:	ff d0                	call   *%rax
+  80589c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80589f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058a3:	79 05                	jns    8058aa <pipeisclosed+0x31>
+    return r;
+  8058a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058a8:	eb 31                	jmp    8058db <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8058aa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058ae:	48 89 c7             	mov    %rax,%rdi
+  8058b1:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  8058b8:	00 00 00 
+  8058bb:	ff d0                	call   *%rax
+  8058bd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8058c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058c5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8058c9:	48 89 d6             	mov    %rdx,%rsi
+  8058cc:	48 89 c7             	mov    %rax,%rdi
+  8058cf:	48 b8 54 57 80 00 00 	movabs $0x805754,%rax
+  8058d6:	00 00 00 
+  8058d9:	ff d0                	call   *%rax
+}
+  8058db:	c9                   	leave
+  8058dc:	c3                   	ret
+
+00000000008058dd <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8058dd:	55                   	push   %rbp
+  8058de:	48 89 e5             	mov    %rsp,%rbp
+  8058e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8058e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8058e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058ed:	8b 40 18             	mov    0x18(%rax),%eax
+  8058f0:	8d 50 01             	lea    0x1(%rax),%edx
+  8058f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058f7:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8058fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058fe:	8b 40 1c             	mov    0x1c(%rax),%eax
+  805901:	85 c0                	test   %eax,%eax
+  805903:	74 27                	je     80592c <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  805905:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805909:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  805910:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805914:	48 83 c0 18          	add    $0x18,%rax
+  805918:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80591d:	48 89 c7             	mov    %rax,%rdi
+  805920:	48 b8 fa 26 80 00 00 	movabs $0x8026fa,%rax
+  805927:	00 00 00 
+  80592a:	ff d0                	call   *%rax
+  }
+}
+  80592c:	90                   	nop
+  80592d:	c9                   	leave
+  80592e:	c3                   	ret
+
+000000000080592f <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80592f:	55                   	push   %rbp
+  805930:	48 89 e5             	mov    %rsp,%rbp
+  805933:	48 83 ec 10          	sub    $0x10,%rsp
+  805937:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80593b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80593e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805942:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  805949:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80594d:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  805951:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805954:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80595b:	89 c6                	mov    %eax,%esi
+  80595d:	48 89 cf             	mov    %rcx,%rdi
+  805960:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  805967:	00 00 00 
+  80596a:	ff d0                	call   *%rax
+}
+  80596c:	90                   	nop
+  80596d:	c9                   	leave
+  80596e:	c3                   	ret
+
+000000000080596f <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80596f:	55                   	push   %rbp
+  805970:	48 89 e5             	mov    %rsp,%rbp
+  805973:	48 83 ec 70          	sub    $0x70,%rsp
+  805977:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80597b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80597f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805983:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805987:	48 89 c7             	mov    %rax,%rdi
+  80598a:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  805991:	00 00 00 
+  805994:	ff d0                	call   *%rax
+  805996:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80599a:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80599f:	75 0a                	jne    8059ab <devpipe_read+0x3c>
+    return 0;
+  8059a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059a6:	e9 63 01 00 00       	jmp    805b0e <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8059ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059af:	8b 40 18             	mov    0x18(%rax),%eax
+  8059b2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8059b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059b9:	48 8b 10             	mov    (%rax),%rdx
+  8059bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8059c4:	48 39 c2             	cmp    %rax,%rdx
+  8059c7:	75 42                	jne    805a0b <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  8059c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8059cd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8059d1:	48 89 d6             	mov    %rdx,%rsi
+  8059d4:	48 89 c7             	mov    %rax,%rdi
+  8059d7:	48 b8 54 57 80 00 00 	movabs $0x805754,%rax
+  8059de:	00 00 00 
+  8059e1:	ff d0                	call   *%rax
+  8059e3:	85 c0                	test   %eax,%eax
+  8059e5:	74 0a                	je     8059f1 <devpipe_read+0x82>
+      return 0;
+  8059e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8059ec:	e9 1d 01 00 00       	jmp    805b0e <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8059f1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8059f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059f8:	89 d6                	mov    %edx,%esi
+  8059fa:	48 89 c7             	mov    %rax,%rdi
+  8059fd:	48 b8 2f 59 80 00 00 	movabs $0x80592f,%rax
+  805a04:	00 00 00 
+  805a07:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  805a09:	eb a0                	jmp    8059ab <devpipe_read+0x3c>
+      break;
+  805a0b:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  805a0c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805a10:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  805a14:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805a18:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805a1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a20:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805a24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a28:	48 8b 00             	mov    (%rax),%rax
+  805a2b:	48 29 c2             	sub    %rax,%rdx
+  805a2e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805a32:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805a36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a3a:	48 39 c2             	cmp    %rax,%rdx
+  805a3d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805a41:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  805a45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a49:	48 8b 00             	mov    (%rax),%rax
+  805a4c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805a50:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805a54:	ba 00 00 00 00       	mov    $0x0,%edx
+  805a59:	48 f7 f1             	div    %rcx
+  805a5c:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  805a60:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805a64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805a68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a6c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805a70:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  805a74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805a78:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  805a7c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805a80:	48 39 c2             	cmp    %rax,%rdx
+  805a83:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805a87:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  805a8b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a8f:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  805a93:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805a97:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  805a9b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805a9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805aa3:	48 89 ce             	mov    %rcx,%rsi
+  805aa6:	48 89 c7             	mov    %rax,%rdi
+  805aa9:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  805ab0:	00 00 00 
+  805ab3:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  805ab5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805ab9:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  805abd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805ac1:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  805ac5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805ac9:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805acd:	48 01 d1             	add    %rdx,%rcx
+  805ad0:	48 89 c2             	mov    %rax,%rdx
+  805ad3:	48 89 cf             	mov    %rcx,%rdi
+  805ad6:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  805add:	00 00 00 
+  805ae0:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  805ae2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805ae6:	48 8b 10             	mov    (%rax),%rdx
+  805ae9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805aed:	48 01 c2             	add    %rax,%rdx
+  805af0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805af4:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  805af7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805afb:	48 89 c7             	mov    %rax,%rdi
+  805afe:	48 b8 dd 58 80 00 00 	movabs $0x8058dd,%rax
+  805b05:	00 00 00 
+  805b08:	ff d0                	call   *%rax
+  return n;
+  805b0a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  805b0e:	c9                   	leave
+  805b0f:	c3                   	ret
+
+0000000000805b10 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805b10:	55                   	push   %rbp
+  805b11:	48 89 e5             	mov    %rsp,%rbp
+  805b14:	48 83 ec 70          	sub    $0x70,%rsp
+  805b18:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805b1c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805b20:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805b24:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805b28:	48 89 c7             	mov    %rax,%rdi
+  805b2b:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  805b32:	00 00 00 
+  805b35:	ff d0                	call   *%rax
+  805b37:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  805b3b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805b3f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805b43:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805b4a:	00 
+  805b4b:	e9 b8 01 00 00       	jmp    805d08 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  805b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b54:	8b 40 18             	mov    0x18(%rax),%eax
+  805b57:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  805b5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b5e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805b62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b66:	48 8b 00             	mov    (%rax),%rax
+  805b69:	48 29 c2             	sub    %rax,%rdx
+  805b6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805b70:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805b74:	48 39 c2             	cmp    %rax,%rdx
+  805b77:	75 4d                	jne    805bc6 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  805b79:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805b7d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805b81:	48 89 d6             	mov    %rdx,%rsi
+  805b84:	48 89 c7             	mov    %rax,%rdi
+  805b87:	48 b8 54 57 80 00 00 	movabs $0x805754,%rax
+  805b8e:	00 00 00 
+  805b91:	ff d0                	call   *%rax
+  805b93:	85 c0                	test   %eax,%eax
+  805b95:	74 0a                	je     805ba1 <devpipe_write+0x91>
+        return 0;
+  805b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b9c:	e9 79 01 00 00       	jmp    805d1a <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  805ba1:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  805ba4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ba8:	89 d6                	mov    %edx,%esi
+  805baa:	48 89 c7             	mov    %rax,%rdi
+  805bad:	48 b8 2f 59 80 00 00 	movabs $0x80592f,%rax
+  805bb4:	00 00 00 
+  805bb7:	ff d0                	call   *%rax
+      m = 0;
+  805bb9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805bc0:	00 
+      continue;
+  805bc1:	e9 3a 01 00 00       	jmp    805d00 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  805bc6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805bca:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  805bce:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805bd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bd6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805bda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bde:	48 8b 08             	mov    (%rax),%rcx
+  805be1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805be5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805be9:	48 29 c1             	sub    %rax,%rcx
+  805bec:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  805bf0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805bf4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805bf8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805bfc:	48 39 c2             	cmp    %rax,%rdx
+  805bff:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805c03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  805c07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c0b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805c0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805c13:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c1c:	48 f7 f1             	div    %rcx
+  805c1f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805c23:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c27:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  805c2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c2f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805c33:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805c37:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  805c3b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805c3f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805c43:	48 39 c2             	cmp    %rax,%rdx
+  805c46:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805c4a:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  805c4e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805c52:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805c56:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805c5a:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  805c5e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805c62:	48 01 d1             	add    %rdx,%rcx
+  805c65:	48 89 c2             	mov    %rax,%rdx
+  805c68:	48 89 cf             	mov    %rcx,%rdi
+  805c6b:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  805c72:	00 00 00 
+  805c75:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  805c77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c7b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805c7f:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805c83:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805c87:	73 4d                	jae    805cd6 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  805c89:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c8d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805c91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805c95:	48 29 c2             	sub    %rax,%rdx
+  805c98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c9c:	48 01 c2             	add    %rax,%rdx
+  805c9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ca3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805ca7:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805cab:	48 89 c1             	mov    %rax,%rcx
+  805cae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805cb2:	48 01 c1             	add    %rax,%rcx
+  805cb5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805cb9:	48 01 c1             	add    %rax,%rcx
+  805cbc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cc0:	48 83 c0 20          	add    $0x20,%rax
+  805cc4:	48 89 ce             	mov    %rcx,%rsi
+  805cc7:	48 89 c7             	mov    %rax,%rdi
+  805cca:	48 b8 7a 1c 80 00 00 	movabs $0x801c7a,%rax
+  805cd1:	00 00 00 
+  805cd4:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805cd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cda:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805cde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ce2:	48 01 c2             	add    %rax,%rdx
+  805ce5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ce9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  805ced:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cf1:	48 89 c7             	mov    %rax,%rdi
+  805cf4:	48 b8 dd 58 80 00 00 	movabs $0x8058dd,%rax
+  805cfb:	00 00 00 
+  805cfe:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  805d00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d04:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805d08:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d0c:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  805d10:	0f 82 3a fe ff ff    	jb     805b50 <devpipe_write+0x40>
+  }
+
+  return i;
+  805d16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805d1a:	c9                   	leave
+  805d1b:	c3                   	ret
+
+0000000000805d1c <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805d1c:	55                   	push   %rbp
+  805d1d:	48 89 e5             	mov    %rsp,%rbp
+  805d20:	48 83 ec 40          	sub    $0x40,%rsp
+  805d24:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805d28:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  805d2b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805d2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805d33:	48 89 c7             	mov    %rax,%rdi
+  805d36:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  805d3d:	00 00 00 
+  805d40:	ff d0                	call   *%rax
+  805d42:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805d46:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  805d4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d51:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805d55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805d59:	48 89 d6             	mov    %rdx,%rsi
+  805d5c:	48 89 c7             	mov    %rax,%rdi
+  805d5f:	48 b8 bc 3c 80 00 00 	movabs $0x803cbc,%rax
+  805d66:	00 00 00 
+  805d69:	ff d0                	call   *%rax
+  805d6b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d6e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805d72:	79 08                	jns    805d7c <devpipe_poll+0x60>
+    return r;
+  805d74:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d77:	e9 85 00 00 00       	jmp    805e01 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  805d7c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805d7f:	83 e0 01             	and    $0x1,%eax
+  805d82:	85 c0                	test   %eax,%eax
+  805d84:	74 18                	je     805d9e <devpipe_poll+0x82>
+  805d86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d8a:	48 8b 10             	mov    (%rax),%rdx
+  805d8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d91:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805d95:	48 39 c2             	cmp    %rax,%rdx
+  805d98:	74 04                	je     805d9e <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805d9a:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  805d9e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805da1:	83 e0 02             	and    $0x2,%eax
+  805da4:	85 c0                	test   %eax,%eax
+  805da6:	74 23                	je     805dcb <devpipe_poll+0xaf>
+  805da8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805dac:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805db0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805db4:	48 8b 00             	mov    (%rax),%rax
+  805db7:	48 29 c2             	sub    %rax,%rdx
+  805dba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805dbe:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805dc2:	48 39 c2             	cmp    %rax,%rdx
+  805dc5:	73 04                	jae    805dcb <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805dc7:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805dcb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805dcf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805dd3:	48 89 d6             	mov    %rdx,%rsi
+  805dd6:	48 89 c7             	mov    %rax,%rdi
+  805dd9:	48 b8 54 57 80 00 00 	movabs $0x805754,%rax
+  805de0:	00 00 00 
+  805de3:	ff d0                	call   *%rax
+  805de5:	85 c0                	test   %eax,%eax
+  805de7:	74 04                	je     805ded <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805de9:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  805ded:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805df1:	75 0b                	jne    805dfe <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805df3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805df7:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  805dfe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805e01:	c9                   	leave
+  805e02:	c3                   	ret
+
+0000000000805e03 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805e03:	55                   	push   %rbp
+  805e04:	48 89 e5             	mov    %rsp,%rbp
+  805e07:	48 83 ec 20          	sub    $0x20,%rsp
+  805e0b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805e0f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805e13:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e17:	48 89 c7             	mov    %rax,%rdi
+  805e1a:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  805e21:	00 00 00 
+  805e24:	ff d0                	call   *%rax
+  805e26:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805e2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e2e:	48 ba f1 7b 80 00 00 	movabs $0x807bf1,%rdx
+  805e35:	00 00 00 
+  805e38:	48 89 d6             	mov    %rdx,%rsi
+  805e3b:	48 89 c7             	mov    %rax,%rdi
+  805e3e:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  805e45:	00 00 00 
+  805e48:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805e4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e4e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805e52:	89 c1                	mov    %eax,%ecx
+  805e54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e58:	48 8b 00             	mov    (%rax),%rax
+  805e5b:	89 c2                	mov    %eax,%edx
+  805e5d:	89 c8                	mov    %ecx,%eax
+  805e5f:	29 d0                	sub    %edx,%eax
+  805e61:	89 c2                	mov    %eax,%edx
+  805e63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e67:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  805e6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e71:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805e78:	00 00 00 
+  stat->st_dev   = &devpipe;
+  805e7b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805e7f:	48 b9 80 80 80 00 00 	movabs $0x808080,%rcx
+  805e86:	00 00 00 
+  805e89:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  805e90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e95:	c9                   	leave
+  805e96:	c3                   	ret
+
+0000000000805e97 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805e97:	55                   	push   %rbp
+  805e98:	48 89 e5             	mov    %rsp,%rbp
+  805e9b:	48 83 ec 40          	sub    $0x40,%rsp
+  805e9f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805ea3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ea7:	48 89 c7             	mov    %rax,%rdi
+  805eaa:	48 b8 e9 31 80 00 00 	movabs $0x8031e9,%rax
+  805eb1:	00 00 00 
+  805eb4:	ff d0                	call   *%rax
+  805eb6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805eba:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  805ec1:	00 
+  805ec2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ec6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805eca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ece:	48 01 d0             	add    %rdx,%rax
+  805ed1:	48 83 c0 1f          	add    $0x1f,%rax
+  805ed5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805ed9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805edd:	ba 00 00 00 00       	mov    $0x0,%edx
+  805ee2:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805ee6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805eea:	48 29 d0             	sub    %rdx,%rax
+  805eed:	48 c1 e8 0c          	shr    $0xc,%rax
+  805ef1:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805ef5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805ef9:	48 89 c6             	mov    %rax,%rsi
+  805efc:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f01:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  805f08:	00 00 00 
+  805f0b:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  805f0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f11:	48 89 c7             	mov    %rax,%rdi
+  805f14:	48 b8 dd 58 80 00 00 	movabs $0x8058dd,%rax
+  805f1b:	00 00 00 
+  805f1e:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805f20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805f24:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805f28:	eb 2f                	jmp    805f59 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805f2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f2e:	48 83 e8 01          	sub    $0x1,%rax
+  805f32:	48 c1 e0 0c          	shl    $0xc,%rax
+  805f36:	48 89 c2             	mov    %rax,%rdx
+  805f39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f3d:	48 01 d0             	add    %rdx,%rax
+  805f40:	48 89 c6             	mov    %rax,%rsi
+  805f43:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f48:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  805f4f:	00 00 00 
+  805f52:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805f54:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805f59:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  805f5e:	77 ca                	ja     805f2a <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  805f60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f64:	48 89 c6             	mov    %rax,%rsi
+  805f67:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f6c:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  805f73:	00 00 00 
+  805f76:	ff d0                	call   *%rax
+}
+  805f78:	c9                   	leave
+  805f79:	c3                   	ret
+
+0000000000805f7a <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805f7a:	55                   	push   %rbp
+  805f7b:	48 89 e5             	mov    %rsp,%rbp
+  805f7e:	48 83 ec 10          	sub    $0x10,%rsp
+  805f82:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805f85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f88:	be 00 00 00 00       	mov    $0x0,%esi
+  805f8d:	89 c7                	mov    %eax,%edi
+  805f8f:	48 b8 9e 5f 80 00 00 	movabs $0x805f9e,%rax
+  805f96:	00 00 00 
+  805f99:	ff d0                	call   *%rax
+}
+  805f9b:	90                   	nop
+  805f9c:	c9                   	leave
+  805f9d:	c3                   	ret
+
+0000000000805f9e <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  805f9e:	55                   	push   %rbp
+  805f9f:	48 89 e5             	mov    %rsp,%rbp
+  805fa2:	48 83 ec 10          	sub    $0x10,%rsp
+  805fa6:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805fa9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  805fad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805fb1:	75 3e                	jne    805ff1 <waitpid+0x53>
+  805fb3:	48 b8 f8 7b 80 00 00 	movabs $0x807bf8,%rax
+  805fba:	00 00 00 
+  805fbd:	48 89 c1             	mov    %rax,%rcx
+  805fc0:	48 b8 03 7c 80 00 00 	movabs $0x807c03,%rax
+  805fc7:	00 00 00 
+  805fca:	48 89 c2             	mov    %rax,%rdx
+  805fcd:	be 0e 00 00 00       	mov    $0xe,%esi
+  805fd2:	48 b8 18 7c 80 00 00 	movabs $0x807c18,%rax
+  805fd9:	00 00 00 
+  805fdc:	48 89 c7             	mov    %rax,%rdi
+  805fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fe4:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  805feb:	00 00 00 
+  805fee:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  805ff1:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805ff6:	74 0a                	je     806002 <waitpid+0x64>
+    *status = 0;
+  805ff8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ffc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  806002:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806006:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806009:	48 89 d6             	mov    %rdx,%rsi
+  80600c:	89 c7                	mov    %eax,%edi
+  80600e:	48 b8 fe 21 80 00 00 	movabs $0x8021fe,%rax
+  806015:	00 00 00 
+  806018:	ff d0                	call   *%rax
+}
+  80601a:	c9                   	leave
+  80601b:	c3                   	ret
+
+000000000080601c <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  80601c:	55                   	push   %rbp
+  80601d:	48 89 e5             	mov    %rsp,%rbp
+  806020:	48 83 ec 10          	sub    $0x10,%rsp
+  806024:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806028:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  80602c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806030:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806034:	48 89 c7             	mov    %rax,%rdi
+  806037:	ff d2                	call   *%rdx
+  thread_exit(0);
+  806039:	bf 00 00 00 00       	mov    $0x0,%edi
+  80603e:	48 b8 80 62 80 00 00 	movabs $0x806280,%rax
+  806045:	00 00 00 
+  806048:	ff d0                	call   *%rax
+}
+  80604a:	90                   	nop
+  80604b:	c9                   	leave
+  80604c:	c3                   	ret
+
+000000000080604d <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  80604d:	55                   	push   %rbp
+  80604e:	48 89 e5             	mov    %rsp,%rbp
+  806051:	48 83 ec 20          	sub    $0x20,%rsp
+  806055:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  806058:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80605b:	c1 e0 10             	shl    $0x10,%eax
+  80605e:	48 98                	cltq
+  806060:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  806065:	48 01 d0             	add    %rdx,%rax
+  806068:	48 89 c6             	mov    %rax,%rsi
+  80606b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806070:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  806077:	00 00 00 
+  80607a:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80607c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80607f:	83 c0 01             	add    $0x1,%eax
+  806082:	c1 e0 10             	shl    $0x10,%eax
+  806085:	48 98                	cltq
+  806087:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80608c:	48 01 d0             	add    %rdx,%rax
+  80608f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  806093:	eb 20                	jmp    8060b5 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  806095:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806099:	48 89 c6             	mov    %rax,%rsi
+  80609c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060a1:	48 b8 b7 23 80 00 00 	movabs $0x8023b7,%rax
+  8060a8:	00 00 00 
+  8060ab:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8060ad:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8060b4:	00 
+  8060b5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8060b8:	83 c0 01             	add    $0x1,%eax
+  8060bb:	c1 e0 10             	shl    $0x10,%eax
+  8060be:	48 98                	cltq
+  8060c0:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8060c5:	48 01 d0             	add    %rdx,%rax
+  8060c8:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8060cc:	72 c7                	jb     806095 <slot_unmap+0x48>
+}
+  8060ce:	90                   	nop
+  8060cf:	90                   	nop
+  8060d0:	c9                   	leave
+  8060d1:	c3                   	ret
+
+00000000008060d2 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  8060d2:	55                   	push   %rbp
+  8060d3:	48 89 e5             	mov    %rsp,%rbp
+  8060d6:	48 83 ec 30          	sub    $0x30,%rsp
+  8060da:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8060de:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  8060e2:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8060e9:	00 00 00 
+  8060ec:	48 89 c7             	mov    %rax,%rdi
+  8060ef:	48 b8 0d 6e 80 00 00 	movabs $0x806e0d,%rax
+  8060f6:	00 00 00 
+  8060f9:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  8060fb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  806102:	eb 04                	jmp    806108 <thread_create+0x36>
+  806104:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  806108:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  80610c:	7f 16                	jg     806124 <thread_create+0x52>
+  80610e:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  806115:	00 00 00 
+  806118:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80611b:	48 98                	cltq
+  80611d:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  806120:	85 c0                	test   %eax,%eax
+  806122:	75 e0                	jne    806104 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  806124:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  806128:	75 0c                	jne    806136 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  80612a:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  806131:	e9 2c 01 00 00       	jmp    806262 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  806136:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806139:	c1 e0 10             	shl    $0x10,%eax
+  80613c:	48 98                	cltq
+  80613e:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  806143:	48 01 d0             	add    %rdx,%rax
+  806146:	ba 07 00 00 00       	mov    $0x7,%edx
+  80614b:	48 89 c6             	mov    %rax,%rsi
+  80614e:	bf 00 00 00 00       	mov    $0x0,%edi
+  806153:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  80615a:	00 00 00 
+  80615d:	ff d0                	call   *%rax
+  80615f:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  806162:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  806166:	0f 88 f5 00 00 00    	js     806261 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80616c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80616f:	83 c0 01             	add    $0x1,%eax
+  806172:	c1 e0 10             	shl    $0x10,%eax
+  806175:	48 98                	cltq
+  806177:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80617c:	48 01 d0             	add    %rdx,%rax
+  80617f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  806183:	eb 32                	jmp    8061b7 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  806185:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806189:	ba 07 00 00 00       	mov    $0x7,%edx
+  80618e:	48 89 c6             	mov    %rax,%rsi
+  806191:	bf 00 00 00 00       	mov    $0x0,%edi
+  806196:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  80619d:	00 00 00 
+  8061a0:	ff d0                	call   *%rax
+  8061a2:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8061a5:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8061a9:	0f 88 9e 00 00 00    	js     80624d <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8061af:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8061b6:	00 
+  8061b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8061ba:	83 c0 01             	add    $0x1,%eax
+  8061bd:	c1 e0 10             	shl    $0x10,%eax
+  8061c0:	48 98                	cltq
+  8061c2:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8061c7:	48 01 d0             	add    %rdx,%rax
+  8061ca:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8061ce:	72 b5                	jb     806185 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  8061d0:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8061d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  8061d8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8061db:	c1 e2 10             	shl    $0x10,%edx
+  8061de:	48 63 d2             	movslq %edx,%rdx
+  8061e1:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  8061e6:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  8061e9:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  8061ec:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8061ef:	83 c2 01             	add    $0x1,%edx
+  8061f2:	c1 e2 10             	shl    $0x10,%edx
+  8061f5:	48 63 d2             	movslq %edx,%rdx
+  8061f8:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  8061fd:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  806200:	48 bf 1c 60 80 00 00 	movabs $0x80601c,%rdi
+  806207:	00 00 00 
+  80620a:	49 89 c8             	mov    %rcx,%r8
+  80620d:	48 89 c1             	mov    %rax,%rcx
+  806210:	4c 89 ca             	mov    %r9,%rdx
+  806213:	48 b8 9f 27 80 00 00 	movabs $0x80279f,%rax
+  80621a:	00 00 00 
+  80621d:	ff d0                	call   *%rax
+  80621f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  806222:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  806226:	79 08                	jns    806230 <thread_create+0x15e>
+    r = id;
+  806228:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80622b:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  80622e:	eb 1e                	jmp    80624e <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  806230:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806233:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  806236:	48 b9 40 a0 80 00 00 	movabs $0x80a040,%rcx
+  80623d:	00 00 00 
+  806240:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806243:	48 98                	cltq
+  806245:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  806248:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  80624b:	eb 15                	jmp    806262 <thread_create+0x190>
+      goto fail;
+  80624d:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  80624e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806251:	89 c7                	mov    %eax,%edi
+  806253:	48 b8 4d 60 80 00 00 	movabs $0x80604d,%rax
+  80625a:	00 00 00 
+  80625d:	ff d0                	call   *%rax
+  80625f:	eb 01                	jmp    806262 <thread_create+0x190>
+    goto out;
+  806261:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  806262:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  806269:	00 00 00 
+  80626c:	48 89 c7             	mov    %rax,%rdi
+  80626f:	48 b8 e2 6e 80 00 00 	movabs $0x806ee2,%rax
+  806276:	00 00 00 
+  806279:	ff d0                	call   *%rax
+  return r;
+  80627b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  80627e:	c9                   	leave
+  80627f:	c3                   	ret
+
+0000000000806280 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  806280:	55                   	push   %rbp
+  806281:	48 89 e5             	mov    %rsp,%rbp
+  806284:	48 83 ec 10          	sub    $0x10,%rsp
+  806288:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  80628b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80628e:	89 c7                	mov    %eax,%edi
+  806290:	48 b8 fc 27 80 00 00 	movabs $0x8027fc,%rax
+  806297:	00 00 00 
+  80629a:	ff d0                	call   *%rax
+}
+  80629c:	90                   	nop
+  80629d:	c9                   	leave
+  80629e:	c3                   	ret
+
+000000000080629f <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  80629f:	55                   	push   %rbp
+  8062a0:	48 89 e5             	mov    %rsp,%rbp
+  8062a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8062a7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8062aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  8062ae:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8062b5:	00 00 00 
+  8062b8:	48 89 c7             	mov    %rax,%rdi
+  8062bb:	48 b8 0d 6e 80 00 00 	movabs $0x806e0d,%rax
+  8062c2:	00 00 00 
+  8062c5:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  8062c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8062ce:	eb 04                	jmp    8062d4 <thread_join+0x35>
+  8062d0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8062d4:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  8062d8:	7f 17                	jg     8062f1 <thread_join+0x52>
+  8062da:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  8062e1:	00 00 00 
+  8062e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8062e7:	48 98                	cltq
+  8062e9:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8062ec:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8062ef:	75 df                	jne    8062d0 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  8062f1:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8062f8:	00 00 00 
+  8062fb:	48 89 c7             	mov    %rax,%rdi
+  8062fe:	48 b8 e2 6e 80 00 00 	movabs $0x806ee2,%rax
+  806305:	00 00 00 
+  806308:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  80630a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80630e:	74 06                	je     806316 <thread_join+0x77>
+  806310:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  806314:	75 07                	jne    80631d <thread_join+0x7e>
+    return -E_BAD_ENV;
+  806316:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80631b:	eb 76                	jmp    806393 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  80631d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806321:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806324:	48 89 d6             	mov    %rdx,%rsi
+  806327:	89 c7                	mov    %eax,%edi
+  806329:	48 b8 9e 5f 80 00 00 	movabs $0x805f9e,%rax
+  806330:	00 00 00 
+  806333:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  806335:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80633c:	00 00 00 
+  80633f:	48 89 c7             	mov    %rax,%rdi
+  806342:	48 b8 0d 6e 80 00 00 	movabs $0x806e0d,%rax
+  806349:	00 00 00 
+  80634c:	ff d0                	call   *%rax
+  slot_unmap(i);
+  80634e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806351:	89 c7                	mov    %eax,%edi
+  806353:	48 b8 4d 60 80 00 00 	movabs $0x80604d,%rax
+  80635a:	00 00 00 
+  80635d:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  80635f:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  806366:	00 00 00 
+  806369:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80636c:	48 98                	cltq
+  80636e:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  806375:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80637c:	00 00 00 
+  80637f:	48 89 c7             	mov    %rax,%rdi
+  806382:	48 b8 e2 6e 80 00 00 	movabs $0x806ee2,%rax
+  806389:	00 00 00 
+  80638c:	ff d0                	call   *%rax
+  return 0;
+  80638e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806393:	c9                   	leave
+  806394:	c3                   	ret
+
+0000000000806395 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  806395:	55                   	push   %rbp
+  806396:	48 89 e5             	mov    %rsp,%rbp
+  806399:	48 83 ec 08          	sub    $0x8,%rsp
+  80639d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  8063a1:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  8063a6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8063aa:	73 23                	jae    8063cf <thread_is_uxstack+0x3a>
+  8063ac:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  8063b1:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8063b5:	72 18                	jb     8063cf <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  8063b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8063bb:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  8063c0:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8063c6:	75 07                	jne    8063cf <thread_is_uxstack+0x3a>
+  8063c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8063cd:	eb 05                	jmp    8063d4 <thread_is_uxstack+0x3f>
+  8063cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8063d4:	83 e0 01             	and    $0x1,%eax
+}
+  8063d7:	c9                   	leave
+  8063d8:	c3                   	ret
+
+00000000008063d9 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  8063d9:	55                   	push   %rbp
+  8063da:	48 89 e5             	mov    %rsp,%rbp
+  8063dd:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  8063e1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8063e8:	00 00 00 
+  8063eb:	8b 40 04             	mov    0x4(%rax),%eax
+  8063ee:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8063f3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8063fa:	00 00 00 
+  8063fd:	48 98                	cltq
+  8063ff:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806406:	48 01 d0             	add    %rdx,%rax
+  806409:	48 05 08 01 00 00    	add    $0x108,%rax
+  80640f:	48 8b 00             	mov    (%rax),%rax
+  806412:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  806416:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  80641b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80641f:	73 0b                	jae    80642c <thread_pftemp+0x53>
+  806421:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  806426:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80642a:	73 07                	jae    806433 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  80642c:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  806431:	eb 26                	jmp    806459 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  806433:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  80643a:	ff ff ff 
+  80643d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806441:	48 01 d0             	add    %rdx,%rax
+  806444:	48 c1 e8 10          	shr    $0x10,%rax
+  806448:	48 83 c0 01          	add    $0x1,%rax
+  80644c:	48 c1 e0 0c          	shl    $0xc,%rax
+  806450:	48 f7 d8             	neg    %rax
+  806453:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  806459:	c9                   	leave
+  80645a:	c3                   	ret
+
+000000000080645b <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  80645b:	55                   	push   %rbp
+  80645c:	48 89 e5             	mov    %rsp,%rbp
+  80645f:	48 83 ec 08          	sub    $0x8,%rsp
+  806463:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  806466:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80646a:	75 10                	jne    80647c <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  80646c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806473:	00 00 00 
+  806476:	8b 00                	mov    (%rax),%eax
+  806478:	48 98                	cltq
+  80647a:	eb 05                	jmp    806481 <vsyscall+0x26>
+  }
+  return 0;
+  80647c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806481:	c9                   	leave
+  806482:	c3                   	ret
+
+0000000000806483 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  806483:	55                   	push   %rbp
+  806484:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  806487:	bf 00 00 00 00       	mov    $0x0,%edi
+  80648c:	48 b8 5b 64 80 00 00 	movabs $0x80645b,%rax
+  806493:	00 00 00 
+  806496:	ff d0                	call   *%rax
+}
+  806498:	5d                   	pop    %rbp
+  806499:	c3                   	ret
+
+000000000080649a <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80649a:	55                   	push   %rbp
+  80649b:	48 89 e5             	mov    %rsp,%rbp
+  80649e:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  8064a2:	0f 31                	rdtsc
+  8064a4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8064a7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  8064aa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064ad:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8064b0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8064b4:	48 09 d0             	or     %rdx,%rax
+  8064b7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  8064bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  8064bf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8064c3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8064ca:	00 00 00 
+  8064cd:	8b 40 08             	mov    0x8(%rax),%eax
+  8064d0:	48 98                	cltq
+  8064d2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  8064d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8064df:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8064e3:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  8064ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8064f3:	48 f7 75 f0          	divq   -0x10(%rbp)
+  8064f7:	48 89 d0             	mov    %rdx,%rax
+  8064fa:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  806501:	ba 00 00 00 00       	mov    $0x0,%edx
+  806506:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80650a:	48 01 c8             	add    %rcx,%rax
+}
+  80650d:	c9                   	leave
+  80650e:	c3                   	ret
+
+000000000080650f <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  80650f:	55                   	push   %rbp
+  806510:	48 89 e5             	mov    %rsp,%rbp
+  806513:	48 83 ec 20          	sub    $0x20,%rsp
+  806517:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  80651a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80651d:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  806520:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  806524:	be 01 00 00 00       	mov    $0x1,%esi
+  806529:	48 89 c7             	mov    %rax,%rdi
+  80652c:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  806533:	00 00 00 
+  806536:	ff d0                	call   *%rax
+}
+  806538:	90                   	nop
+  806539:	c9                   	leave
+  80653a:	c3                   	ret
+
+000000000080653b <getchar>:
+
+int
+getchar(void) {
+  80653b:	55                   	push   %rbp
+  80653c:	48 89 e5             	mov    %rsp,%rbp
+  80653f:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  806543:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  806547:	ba 01 00 00 00       	mov    $0x1,%edx
+  80654c:	48 89 c6             	mov    %rax,%rsi
+  80654f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806554:	48 b8 52 38 80 00 00 	movabs $0x803852,%rax
+  80655b:	00 00 00 
+  80655e:	ff d0                	call   *%rax
+  806560:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  806563:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806567:	79 05                	jns    80656e <getchar+0x33>
+    return r;
+  806569:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80656c:	eb 14                	jmp    806582 <getchar+0x47>
+  if (r < 1)
+  80656e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806572:	7f 07                	jg     80657b <getchar+0x40>
+    return -E_EOF;
+  806574:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  806579:	eb 07                	jmp    806582 <getchar+0x47>
+  return c;
+  80657b:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80657f:	0f b6 c0             	movzbl %al,%eax
+}
+  806582:	c9                   	leave
+  806583:	c3                   	ret
+
+0000000000806584 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  806584:	55                   	push   %rbp
+  806585:	48 89 e5             	mov    %rsp,%rbp
+  806588:	48 83 ec 20          	sub    $0x20,%rsp
+  80658c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80658f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  806593:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806596:	48 89 d6             	mov    %rdx,%rsi
+  806599:	89 c7                	mov    %eax,%edi
+  80659b:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  8065a2:	00 00 00 
+  8065a5:	ff d0                	call   *%rax
+  8065a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8065aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8065ae:	79 05                	jns    8065b5 <iscons+0x31>
+    return r;
+  8065b0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8065b3:	eb 1a                	jmp    8065cf <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  8065b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065b9:	8b 10                	mov    (%rax),%edx
+  8065bb:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  8065c2:	00 00 00 
+  8065c5:	8b 00                	mov    (%rax),%eax
+  8065c7:	39 c2                	cmp    %eax,%edx
+  8065c9:	0f 94 c0             	sete   %al
+  8065cc:	0f b6 c0             	movzbl %al,%eax
+}
+  8065cf:	c9                   	leave
+  8065d0:	c3                   	ret
+
+00000000008065d1 <opencons>:
+
+int
+opencons(void) {
+  8065d1:	55                   	push   %rbp
+  8065d2:	48 89 e5             	mov    %rsp,%rbp
+  8065d5:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8065d9:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8065dd:	48 89 c7             	mov    %rax,%rdi
+  8065e0:	48 b8 14 32 80 00 00 	movabs $0x803214,%rax
+  8065e7:	00 00 00 
+  8065ea:	ff d0                	call   *%rax
+  8065ec:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8065ef:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8065f3:	79 05                	jns    8065fa <opencons+0x29>
+    return r;
+  8065f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8065f8:	eb 66                	jmp    806660 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8065fa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065fe:	ba 07 04 00 00       	mov    $0x407,%edx
+  806603:	48 89 c6             	mov    %rax,%rsi
+  806606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80660b:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  806612:	00 00 00 
+  806615:	ff d0                	call   *%rax
+  806617:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80661a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80661e:	79 05                	jns    806625 <opencons+0x54>
+    return r;
+  806620:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806623:	eb 3b                	jmp    806660 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  806625:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806629:	48 ba c0 80 80 00 00 	movabs $0x8080c0,%rdx
+  806630:	00 00 00 
+  806633:	8b 12                	mov    (%rdx),%edx
+  806635:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  806637:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80663b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  806642:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806646:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  80664d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806651:	48 89 c7             	mov    %rax,%rdi
+  806654:	48 b8 c6 31 80 00 00 	movabs $0x8031c6,%rax
+  80665b:	00 00 00 
+  80665e:	ff d0                	call   *%rax
+}
+  806660:	c9                   	leave
+  806661:	c3                   	ret
+
+0000000000806662 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  806662:	55                   	push   %rbp
+  806663:	48 89 e5             	mov    %rsp,%rbp
+  806666:	48 83 ec 20          	sub    $0x20,%rsp
+  80666a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80666d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  806670:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  806674:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806677:	48 89 d6             	mov    %rdx,%rsi
+  80667a:	89 c7                	mov    %eax,%edi
+  80667c:	48 b8 f6 32 80 00 00 	movabs $0x8032f6,%rax
+  806683:	00 00 00 
+  806686:	ff d0                	call   *%rax
+  806688:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80668b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80668f:	79 05                	jns    806696 <consmode+0x34>
+    return r;
+  806691:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806694:	eb 34                	jmp    8066ca <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  806696:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80669a:	8b 10                	mov    (%rax),%edx
+  80669c:	48 b8 c0 80 80 00 00 	movabs $0x8080c0,%rax
+  8066a3:	00 00 00 
+  8066a6:	8b 00                	mov    (%rax),%eax
+  8066a8:	39 c2                	cmp    %eax,%edx
+  8066aa:	74 07                	je     8066b3 <consmode+0x51>
+    return -E_INVAL;
+  8066ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8066b1:	eb 17                	jmp    8066ca <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  8066b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066b7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8066ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  8066bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066c1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8066c4:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  8066c7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8066ca:	c9                   	leave
+  8066cb:	c3                   	ret
+
+00000000008066cc <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8066cc:	55                   	push   %rbp
+  8066cd:	48 89 e5             	mov    %rsp,%rbp
+  8066d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8066d4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8066d8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8066dc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  8066e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8066e4:	8b 50 0c             	mov    0xc(%rax),%edx
+  8066e7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8066eb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066ef:	48 89 ce             	mov    %rcx,%rsi
+  8066f2:	48 89 c7             	mov    %rax,%rdi
+  8066f5:	48 b8 59 26 80 00 00 	movabs $0x802659,%rax
+  8066fc:	00 00 00 
+  8066ff:	ff d0                	call   *%rax
+  806701:	48 98                	cltq
+}
+  806703:	c9                   	leave
+  806704:	c3                   	ret
+
+0000000000806705 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  806705:	55                   	push   %rbp
+  806706:	48 89 e5             	mov    %rsp,%rbp
+  806709:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806710:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  806717:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  80671e:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  806725:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80672c:	eb 74                	jmp    8067a2 <devcons_write+0x9d>
+    m = n - tot;
+  80672e:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  806735:	89 c2                	mov    %eax,%edx
+  806737:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80673a:	29 c2                	sub    %eax,%edx
+  80673c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  80673f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806742:	83 f8 7f             	cmp    $0x7f,%eax
+  806745:	76 07                	jbe    80674e <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  806747:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  80674e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806751:	48 63 d0             	movslq %eax,%rdx
+  806754:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806757:	48 63 c8             	movslq %eax,%rcx
+  80675a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  806761:	48 01 c1             	add    %rax,%rcx
+  806764:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80676b:	48 89 ce             	mov    %rcx,%rsi
+  80676e:	48 89 c7             	mov    %rax,%rdi
+  806771:	48 b8 74 1a 80 00 00 	movabs $0x801a74,%rax
+  806778:	00 00 00 
+  80677b:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  80677d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806780:	48 63 d0             	movslq %eax,%rdx
+  806783:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80678a:	48 89 d6             	mov    %rdx,%rsi
+  80678d:	48 89 c7             	mov    %rax,%rdi
+  806790:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  806797:	00 00 00 
+  80679a:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  80679c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80679f:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8067a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8067a5:	48 98                	cltq
+  8067a7:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  8067ae:	0f 82 7a ff ff ff    	jb     80672e <devcons_write+0x29>
+  }
+  return tot;
+  8067b4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8067b7:	48 98                	cltq
+}
+  8067b9:	c9                   	leave
+  8067ba:	c3                   	ret
+
+00000000008067bb <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  8067bb:	55                   	push   %rbp
+  8067bc:	48 89 e5             	mov    %rsp,%rbp
+  8067bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8067c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  8067c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8067cc:	c9                   	leave
+  8067cd:	c3                   	ret
+
+00000000008067ce <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8067ce:	55                   	push   %rbp
+  8067cf:	48 89 e5             	mov    %rsp,%rbp
+  8067d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8067d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8067da:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  8067de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8067e2:	48 ba 28 7c 80 00 00 	movabs $0x807c28,%rdx
+  8067e9:	00 00 00 
+  8067ec:	48 89 d6             	mov    %rdx,%rsi
+  8067ef:	48 89 c7             	mov    %rax,%rdi
+  8067f2:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  8067f9:	00 00 00 
+  8067fc:	ff d0                	call   *%rax
+  return 0;
+  8067fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806803:	c9                   	leave
+  806804:	c3                   	ret
+
+0000000000806805 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  806805:	55                   	push   %rbp
+  806806:	48 89 e5             	mov    %rsp,%rbp
+  806809:	48 83 ec 30          	sub    $0x30,%rsp
+  80680d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806811:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806814:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  806818:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  80681f:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806822:	83 e0 02             	and    $0x2,%eax
+  806825:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  806828:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80682c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80682f:	83 f8 01             	cmp    $0x1,%eax
+  806832:	75 04                	jne    806838 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  806834:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  806838:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80683b:	83 e0 01             	and    $0x1,%eax
+  80683e:	85 c0                	test   %eax,%eax
+  806840:	74 44                	je     806886 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  806842:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806845:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80684a:	89 c2                	mov    %eax,%edx
+  80684c:	be 00 00 00 00       	mov    $0x0,%esi
+  806851:	bf 00 00 00 00       	mov    $0x0,%edi
+  806856:	48 b8 47 27 80 00 00 	movabs $0x802747,%rax
+  80685d:	00 00 00 
+  806860:	ff d0                	call   *%rax
+  806862:	83 f8 01             	cmp    $0x1,%eax
+  806865:	75 06                	jne    80686d <devcons_poll+0x68>
+      revents |= POLLIN;
+  806867:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  80686b:	eb 19                	jmp    806886 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  80686d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806871:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  806877:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80687a:	89 c2                	mov    %eax,%edx
+  80687c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806880:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  806886:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  806889:	c9                   	leave
+  80688a:	c3                   	ret
+
+000000000080688b <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  80688b:	55                   	push   %rbp
+  80688c:	48 89 e5             	mov    %rsp,%rbp
+  80688f:	48 83 ec 20          	sub    $0x20,%rsp
+  806893:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  806897:	48 b8 86 22 80 00 00 	movabs $0x802286,%rax
+  80689e:	00 00 00 
+  8068a1:	ff d0                	call   *%rax
+  8068a3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  8068a6:	48 b8 40 a1 80 00 00 	movabs $0x80a140,%rax
+  8068ad:	00 00 00 
+  8068b0:	48 8b 00             	mov    (%rax),%rax
+  8068b3:	48 85 c0             	test   %rax,%rax
+  8068b6:	75 62                	jne    80691a <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  8068b8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8068bb:	ba 07 00 00 00       	mov    $0x7,%edx
+  8068c0:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8068c7:	00 00 00 
+  8068ca:	48 89 ce             	mov    %rcx,%rsi
+  8068cd:	89 c7                	mov    %eax,%edi
+  8068cf:	48 b8 ff 22 80 00 00 	movabs $0x8022ff,%rax
+  8068d6:	00 00 00 
+  8068d9:	ff d0                	call   *%rax
+  8068db:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  8068de:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8068e2:	79 36                	jns    80691a <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  8068e4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8068e7:	89 c1                	mov    %eax,%ecx
+  8068e9:	48 b8 2f 7c 80 00 00 	movabs $0x807c2f,%rax
+  8068f0:	00 00 00 
+  8068f3:	48 89 c2             	mov    %rax,%rdx
+  8068f6:	be 23 00 00 00       	mov    $0x23,%esi
+  8068fb:	48 b8 47 7c 80 00 00 	movabs $0x807c47,%rax
+  806902:	00 00 00 
+  806905:	48 89 c7             	mov    %rax,%rdi
+  806908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80690d:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  806914:	00 00 00 
+  806917:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80691a:	48 ba 40 a1 80 00 00 	movabs $0x80a140,%rdx
+  806921:	00 00 00 
+  806924:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806928:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  80692b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80692e:	48 ba 8b 69 80 00 00 	movabs $0x80698b,%rdx
+  806935:	00 00 00 
+  806938:	48 89 d6             	mov    %rdx,%rsi
+  80693b:	89 c7                	mov    %eax,%edi
+  80693d:	48 b8 9c 24 80 00 00 	movabs $0x80249c,%rax
+  806944:	00 00 00 
+  806947:	ff d0                	call   *%rax
+  806949:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  80694c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806950:	79 36                	jns    806988 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  806952:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806955:	89 c1                	mov    %eax,%ecx
+  806957:	48 b8 2f 7c 80 00 00 	movabs $0x807c2f,%rax
+  80695e:	00 00 00 
+  806961:	48 89 c2             	mov    %rax,%rdx
+  806964:	be 2b 00 00 00       	mov    $0x2b,%esi
+  806969:	48 b8 47 7c 80 00 00 	movabs $0x807c47,%rax
+  806970:	00 00 00 
+  806973:	48 89 c7             	mov    %rax,%rdi
+  806976:	b8 00 00 00 00       	mov    $0x0,%eax
+  80697b:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  806982:	00 00 00 
+  806985:	41 ff d0             	call   *%r8
+}
+  806988:	90                   	nop
+  806989:	c9                   	leave
+  80698a:	c3                   	ret
+
+000000000080698b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  80698b:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  80698e:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  806991:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  806998:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  80699c:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  8069a1:	48 a1 40 a1 80 00 00 	movabs 0x80a140,%rax
+  8069a8:	00 00 00 
+	call *%rax
+  8069ab:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  8069ad:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  8069b2:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  8069b5:	41 5f                	pop    %r15
+	popq %r15
+  8069b7:	41 5f                	pop    %r15
+	popq %r15
+  8069b9:	41 5f                	pop    %r15
+	popq %r14
+  8069bb:	41 5e                	pop    %r14
+	popq %r13
+  8069bd:	41 5d                	pop    %r13
+	popq %r12
+  8069bf:	41 5c                	pop    %r12
+	popq %r11
+  8069c1:	41 5b                	pop    %r11
+	popq %r10
+  8069c3:	41 5a                	pop    %r10
+	popq %r9
+  8069c5:	41 59                	pop    %r9
+	popq %r8
+  8069c7:	41 58                	pop    %r8
+	popq %rsi
+  8069c9:	5e                   	pop    %rsi
+	popq %rdi
+  8069ca:	5f                   	pop    %rdi
+	popq %rbp
+  8069cb:	5d                   	pop    %rbp
+	popq %rdx
+  8069cc:	5a                   	pop    %rdx
+	popq %rcx
+  8069cd:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  8069ce:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8069d3:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8069d8:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8069dc:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8069df:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  8069e4:	5b                   	pop    %rbx
+	popq %rax
+  8069e5:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  8069e6:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8069ea:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  8069eb:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  8069f0:	c3                   	ret
+
+00000000008069f1 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8069f1:	55                   	push   %rbp
+  8069f2:	48 89 e5             	mov    %rsp,%rbp
+  8069f5:	48 83 ec 20          	sub    $0x20,%rsp
+  8069f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8069fd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  806a01:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  806a05:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806a09:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  806a0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806a11:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  806a18:	48 89 c7             	mov    %rax,%rdi
+  806a1b:	48 b8 29 6a 80 00 00 	movabs $0x806a29,%rax
+  806a22:	00 00 00 
+  806a25:	ff d0                	call   *%rax
+}
+  806a27:	c9                   	leave
+  806a28:	c3                   	ret
+
+0000000000806a29 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  806a29:	55                   	push   %rbp
+  806a2a:	48 89 e5             	mov    %rsp,%rbp
+  806a2d:	48 83 ec 30          	sub    $0x30,%rsp
+  806a31:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806a35:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806a39:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  806a3d:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  806a41:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806a46:	75 0e                	jne    806a56 <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  806a48:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806a4f:	00 00 00 
+  806a52:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  806a56:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  806a5b:	75 18                	jne    806a75 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  806a5d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a61:	48 89 c7             	mov    %rax,%rdi
+  806a64:	48 b8 3f 25 80 00 00 	movabs $0x80253f,%rax
+  806a6b:	00 00 00 
+  806a6e:	ff d0                	call   *%rax
+  806a70:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806a73:	eb 1d                	jmp    806a92 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  806a75:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806a79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806a7d:	48 89 d6             	mov    %rdx,%rsi
+  806a80:	48 89 c7             	mov    %rax,%rdi
+  806a83:	48 b8 85 25 80 00 00 	movabs $0x802585,%rax
+  806a8a:	00 00 00 
+  806a8d:	ff d0                	call   *%rax
+  806a8f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  806a92:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806a96:	79 2a                	jns    806ac2 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  806a98:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806a9d:	74 0a                	je     806aa9 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  806a9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806aa3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  806aa9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806aae:	74 0a                	je     806aba <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  806ab0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806ab4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  806aba:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806abd:	e9 aa 00 00 00       	jmp    806b6c <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  806ac2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806ac7:	74 36                	je     806aff <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  806ac9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806ad0:	00 00 00 
+  806ad3:	8b 40 04             	mov    0x4(%rax),%eax
+  806ad6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806adb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806ae2:	00 00 00 
+  806ae5:	48 98                	cltq
+  806ae7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806aee:	48 01 d0             	add    %rdx,%rax
+  806af1:	48 05 24 01 00 00    	add    $0x124,%rax
+  806af7:	8b 10                	mov    (%rax),%edx
+  806af9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806afd:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  806aff:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806b04:	74 36                	je     806b3c <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  806b06:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806b0d:	00 00 00 
+  806b10:	8b 40 04             	mov    0x4(%rax),%eax
+  806b13:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806b18:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806b1f:	00 00 00 
+  806b22:	48 98                	cltq
+  806b24:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806b2b:	48 01 d0             	add    %rdx,%rax
+  806b2e:	48 05 28 01 00 00    	add    $0x128,%rax
+  806b34:	8b 10                	mov    (%rax),%edx
+  806b36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806b3a:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  806b3c:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806b43:	00 00 00 
+  806b46:	8b 40 04             	mov    0x4(%rax),%eax
+  806b49:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806b4e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806b55:	00 00 00 
+  806b58:	48 98                	cltq
+  806b5a:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806b61:	48 01 d0             	add    %rdx,%rax
+  806b64:	48 05 20 01 00 00    	add    $0x120,%rax
+  806b6a:	8b 00                	mov    (%rax),%eax
+  }
+}
+  806b6c:	c9                   	leave
+  806b6d:	c3                   	ret
+
+0000000000806b6e <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  806b6e:	55                   	push   %rbp
+  806b6f:	48 89 e5             	mov    %rsp,%rbp
+  806b72:	48 83 ec 30          	sub    $0x30,%rsp
+  806b76:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806b79:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806b7c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806b80:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  806b83:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806b88:	75 5e                	jne    806be8 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  806b8a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806b91:	00 00 00 
+  806b94:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806b98:	eb 4e                	jmp    806be8 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  806b9a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806b9e:	79 3c                	jns    806bdc <ipc_send+0x6e>
+  806ba0:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  806ba4:	74 36                	je     806bdc <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  806ba6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806ba9:	89 c1                	mov    %eax,%ecx
+  806bab:	48 b8 58 7c 80 00 00 	movabs $0x807c58,%rax
+  806bb2:	00 00 00 
+  806bb5:	48 89 c2             	mov    %rax,%rdx
+  806bb8:	be 54 00 00 00       	mov    $0x54,%esi
+  806bbd:	48 b8 7e 7c 80 00 00 	movabs $0x807c7e,%rax
+  806bc4:	00 00 00 
+  806bc7:	48 89 c7             	mov    %rax,%rdi
+  806bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  806bcf:	49 b8 62 03 80 00 00 	movabs $0x800362,%r8
+  806bd6:	00 00 00 
+  806bd9:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  806bdc:	48 b8 c2 22 80 00 00 	movabs $0x8022c2,%rax
+  806be3:	00 00 00 
+  806be6:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806be8:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806beb:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806bee:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806bf2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806bf5:	89 c7                	mov    %eax,%edi
+  806bf7:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  806bfe:	00 00 00 
+  806c01:	ff d0                	call   *%rax
+  806c03:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806c06:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806c0a:	75 8e                	jne    806b9a <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  806c0c:	48 b8 c2 22 80 00 00 	movabs $0x8022c2,%rax
+  806c13:	00 00 00 
+  806c16:	ff d0                	call   *%rax
+}
+  806c18:	90                   	nop
+  806c19:	c9                   	leave
+  806c1a:	c3                   	ret
+
+0000000000806c1b <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  806c1b:	55                   	push   %rbp
+  806c1c:	48 89 e5             	mov    %rsp,%rbp
+  806c1f:	48 83 ec 18          	sub    $0x18,%rsp
+  806c23:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  806c26:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806c2d:	eb 4d                	jmp    806c7c <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  806c2f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806c36:	00 00 00 
+  806c39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806c3c:	48 98                	cltq
+  806c3e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806c45:	48 01 d0             	add    %rdx,%rax
+  806c48:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  806c4e:	8b 00                	mov    (%rax),%eax
+  806c50:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  806c53:	75 23                	jne    806c78 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  806c55:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806c5c:	00 00 00 
+  806c5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806c62:	48 98                	cltq
+  806c64:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806c6b:	48 01 d0             	add    %rdx,%rax
+  806c6e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806c74:	8b 00                	mov    (%rax),%eax
+  806c76:	eb 12                	jmp    806c8a <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  806c78:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806c7c:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806c83:	7e aa                	jle    806c2f <ipc_find_env+0x14>
+  return 0;
+  806c85:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806c8a:	c9                   	leave
+  806c8b:	c3                   	ret
+
+0000000000806c8c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  806c8c:	55                   	push   %rbp
+  806c8d:	48 89 e5             	mov    %rsp,%rbp
+  806c90:	48 83 ec 18          	sub    $0x18,%rsp
+  806c94:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806c98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c9c:	48 c1 e8 27          	shr    $0x27,%rax
+  806ca0:	25 ff 01 00 00       	and    $0x1ff,%eax
+  806ca5:	48 89 c2             	mov    %rax,%rdx
+  806ca8:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  806caf:	01 00 00 
+  806cb2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806cb6:	83 e0 01             	and    $0x1,%eax
+  806cb9:	48 85 c0             	test   %rax,%rax
+  806cbc:	74 63                	je     806d21 <pageref+0x95>
+  806cbe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806cc2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  806cc6:	48 89 c2             	mov    %rax,%rdx
+  806cc9:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  806cd0:	01 00 00 
+  806cd3:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806cd7:	83 e0 01             	and    $0x1,%eax
+  806cda:	48 85 c0             	test   %rax,%rax
+  806cdd:	74 42                	je     806d21 <pageref+0x95>
+  806cdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806ce3:	48 c1 e8 15          	shr    $0x15,%rax
+  806ce7:	48 89 c2             	mov    %rax,%rdx
+  806cea:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  806cf1:	01 00 00 
+  806cf4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806cf8:	83 e0 01             	and    $0x1,%eax
+  806cfb:	48 85 c0             	test   %rax,%rax
+  806cfe:	74 21                	je     806d21 <pageref+0x95>
+  806d00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806d04:	48 c1 e8 0c          	shr    $0xc,%rax
+  806d08:	48 89 c2             	mov    %rax,%rdx
+  806d0b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  806d12:	01 00 00 
+  806d15:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806d19:	83 e0 01             	and    $0x1,%eax
+  806d1c:	48 85 c0             	test   %rax,%rax
+  806d1f:	75 07                	jne    806d28 <pageref+0x9c>
+    return 0;
+  806d21:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d26:	eb 53                	jmp    806d7b <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  806d28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806d2c:	48 c1 e8 0c          	shr    $0xc,%rax
+  806d30:	48 89 c2             	mov    %rax,%rdx
+  806d33:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  806d3a:	01 00 00 
+  806d3d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806d41:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  806d45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d49:	83 e0 01             	and    $0x1,%eax
+  806d4c:	48 85 c0             	test   %rax,%rax
+  806d4f:	75 07                	jne    806d58 <pageref+0xcc>
+    return 0;
+  806d51:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d56:	eb 23                	jmp    806d7b <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  806d58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d5c:	48 c1 e8 0c          	shr    $0xc,%rax
+  806d60:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  806d67:	00 00 00 
+  806d6a:	48 c1 e0 04          	shl    $0x4,%rax
+  806d6e:	48 01 d0             	add    %rdx,%rax
+  806d71:	48 83 c0 08          	add    $0x8,%rax
+  806d75:	0f b7 00             	movzwl (%rax),%eax
+  806d78:	0f b7 c0             	movzwl %ax,%eax
+}
+  806d7b:	c9                   	leave
+  806d7c:	c3                   	ret
+
+0000000000806d7d <xchg>:
+  806d7d:	55                   	push   %rbp
+  806d7e:	48 89 e5             	mov    %rsp,%rbp
+  806d81:	48 83 ec 20          	sub    $0x20,%rsp
+  806d85:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806d89:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806d8c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806d90:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806d93:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806d97:	f0 87 02             	lock xchg %eax,(%rdx)
+  806d9a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806d9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806da0:	c9                   	leave
+  806da1:	c3                   	ret
+
+0000000000806da2 <cmpxchg>:
+  806da2:	55                   	push   %rbp
+  806da3:	48 89 e5             	mov    %rsp,%rbp
+  806da6:	48 83 ec 20          	sub    $0x20,%rsp
+  806daa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806dae:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  806db1:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  806db4:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  806db8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  806dbb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806dbe:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806dc2:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  806dc6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806dc9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806dcc:	c9                   	leave
+  806dcd:	c3                   	ret
+
+0000000000806dce <xadd>:
+  806dce:	55                   	push   %rbp
+  806dcf:	48 89 e5             	mov    %rsp,%rbp
+  806dd2:	48 83 ec 10          	sub    $0x10,%rsp
+  806dd6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806dda:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  806ddd:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  806de1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806de4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806de8:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  806dec:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  806def:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  806df2:	c9                   	leave
+  806df3:	c3                   	ret
+
+0000000000806df4 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  806df4:	55                   	push   %rbp
+  806df5:	48 89 e5             	mov    %rsp,%rbp
+  806df8:	48 83 ec 08          	sub    $0x8,%rsp
+  806dfc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  806e00:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806e04:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  806e0a:	90                   	nop
+  806e0b:	c9                   	leave
+  806e0c:	c3                   	ret
+
+0000000000806e0d <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  806e0d:	55                   	push   %rbp
+  806e0e:	48 89 e5             	mov    %rsp,%rbp
+  806e11:	48 83 ec 20          	sub    $0x20,%rsp
+  806e15:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  806e19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806e1d:	ba 01 00 00 00       	mov    $0x1,%edx
+  806e22:	be 00 00 00 00       	mov    $0x0,%esi
+  806e27:	48 89 c7             	mov    %rax,%rdi
+  806e2a:	48 b8 a2 6d 80 00 00 	movabs $0x806da2,%rax
+  806e31:	00 00 00 
+  806e34:	ff d0                	call   *%rax
+  806e36:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806e39:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806e3d:	74 65                	je     806ea4 <mutex_lock+0x97>
+  if (c != 2)
+  806e3f:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  806e43:	74 57                	je     806e9c <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  806e45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806e49:	be 02 00 00 00       	mov    $0x2,%esi
+  806e4e:	48 89 c7             	mov    %rax,%rdi
+  806e51:	48 b8 7d 6d 80 00 00 	movabs $0x806d7d,%rax
+  806e58:	00 00 00 
+  806e5b:	ff d0                	call   *%rax
+  806e5d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806e60:	eb 3a                	jmp    806e9c <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  806e62:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806e66:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806e6d:	be 02 00 00 00       	mov    $0x2,%esi
+  806e72:	48 89 c7             	mov    %rax,%rdi
+  806e75:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  806e7c:	00 00 00 
+  806e7f:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  806e81:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806e85:	be 02 00 00 00       	mov    $0x2,%esi
+  806e8a:	48 89 c7             	mov    %rax,%rdi
+  806e8d:	48 b8 7d 6d 80 00 00 	movabs $0x806d7d,%rax
+  806e94:	00 00 00 
+  806e97:	ff d0                	call   *%rax
+  806e99:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  806e9c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806ea0:	75 c0                	jne    806e62 <mutex_lock+0x55>
+  806ea2:	eb 01                	jmp    806ea5 <mutex_lock+0x98>
+    return;
+  806ea4:	90                   	nop
+}
+  806ea5:	c9                   	leave
+  806ea6:	c3                   	ret
+
+0000000000806ea7 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  806ea7:	55                   	push   %rbp
+  806ea8:	48 89 e5             	mov    %rsp,%rbp
+  806eab:	48 83 ec 08          	sub    $0x8,%rsp
+  806eaf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  806eb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806eb7:	ba 01 00 00 00       	mov    $0x1,%edx
+  806ebc:	be 00 00 00 00       	mov    $0x0,%esi
+  806ec1:	48 89 c7             	mov    %rax,%rdi
+  806ec4:	48 b8 a2 6d 80 00 00 	movabs $0x806da2,%rax
+  806ecb:	00 00 00 
+  806ece:	ff d0                	call   *%rax
+  806ed0:	85 c0                	test   %eax,%eax
+  806ed2:	75 07                	jne    806edb <mutex_trylock+0x34>
+  806ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ed9:	eb 05                	jmp    806ee0 <mutex_trylock+0x39>
+  806edb:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  806ee0:	c9                   	leave
+  806ee1:	c3                   	ret
+
+0000000000806ee2 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  806ee2:	55                   	push   %rbp
+  806ee3:	48 89 e5             	mov    %rsp,%rbp
+  806ee6:	48 83 ec 10          	sub    $0x10,%rsp
+  806eea:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  806eee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  806ef7:	48 89 c7             	mov    %rax,%rdi
+  806efa:	48 b8 7d 6d 80 00 00 	movabs $0x806d7d,%rax
+  806f01:	00 00 00 
+  806f04:	ff d0                	call   *%rax
+  806f06:	83 f8 02             	cmp    $0x2,%eax
+  806f09:	75 18                	jne    806f23 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  806f0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806f0f:	be 01 00 00 00       	mov    $0x1,%esi
+  806f14:	48 89 c7             	mov    %rax,%rdi
+  806f17:	48 b8 fa 26 80 00 00 	movabs $0x8026fa,%rax
+  806f1e:	00 00 00 
+  806f21:	ff d0                	call   *%rax
+}
+  806f23:	90                   	nop
+  806f24:	c9                   	leave
+  806f25:	c3                   	ret
+
+0000000000806f26 <cond_init>:
+cond_init(struct Cond *c) {
+  806f26:	55                   	push   %rbp
+  806f27:	48 89 e5             	mov    %rsp,%rbp
+  806f2a:	48 83 ec 08          	sub    $0x8,%rsp
+  806f2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  806f32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806f36:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  806f3c:	90                   	nop
+  806f3d:	c9                   	leave
+  806f3e:	c3                   	ret
+
+0000000000806f3f <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  806f3f:	55                   	push   %rbp
+  806f40:	48 89 e5             	mov    %rsp,%rbp
+  806f43:	48 83 ec 30          	sub    $0x30,%rsp
+  806f47:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806f4b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806f4f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  806f53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f57:	8b 00                	mov    (%rax),%eax
+  806f59:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  806f5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806f60:	48 89 c7             	mov    %rax,%rdi
+  806f63:	48 b8 e2 6e 80 00 00 	movabs $0x806ee2,%rax
+  806f6a:	00 00 00 
+  806f6d:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  806f6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806f73:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  806f77:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  806f7a:	89 ce                	mov    %ecx,%esi
+  806f7c:	48 89 c7             	mov    %rax,%rdi
+  806f7f:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  806f86:	00 00 00 
+  806f89:	ff d0                	call   *%rax
+  806f8b:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  806f8e:	eb 1f                	jmp    806faf <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  806f90:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806f94:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806f9b:	be 02 00 00 00       	mov    $0x2,%esi
+  806fa0:	48 89 c7             	mov    %rax,%rdi
+  806fa3:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  806faa:	00 00 00 
+  806fad:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  806faf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806fb3:	be 02 00 00 00       	mov    $0x2,%esi
+  806fb8:	48 89 c7             	mov    %rax,%rdi
+  806fbb:	48 b8 7d 6d 80 00 00 	movabs $0x806d7d,%rax
+  806fc2:	00 00 00 
+  806fc5:	ff d0                	call   *%rax
+  806fc7:	85 c0                	test   %eax,%eax
+  806fc9:	75 c5                	jne    806f90 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  806fcb:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  806fcf:	75 07                	jne    806fd8 <cond_timedwait+0x99>
+  806fd1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  806fd6:	eb 05                	jmp    806fdd <cond_timedwait+0x9e>
+  806fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806fdd:	c9                   	leave
+  806fde:	c3                   	ret
+
+0000000000806fdf <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  806fdf:	55                   	push   %rbp
+  806fe0:	48 89 e5             	mov    %rsp,%rbp
+  806fe3:	48 83 ec 10          	sub    $0x10,%rsp
+  806fe7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806feb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  806fef:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  806ff3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806ff7:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  806ffe:	48 89 ce             	mov    %rcx,%rsi
+  807001:	48 89 c7             	mov    %rax,%rdi
+  807004:	48 b8 3f 6f 80 00 00 	movabs $0x806f3f,%rax
+  80700b:	00 00 00 
+  80700e:	ff d0                	call   *%rax
+}
+  807010:	90                   	nop
+  807011:	c9                   	leave
+  807012:	c3                   	ret
+
+0000000000807013 <cond_signal>:
+cond_signal(struct Cond *c) {
+  807013:	55                   	push   %rbp
+  807014:	48 89 e5             	mov    %rsp,%rbp
+  807017:	48 83 ec 10          	sub    $0x10,%rsp
+  80701b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80701f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807023:	be 01 00 00 00       	mov    $0x1,%esi
+  807028:	48 89 c7             	mov    %rax,%rdi
+  80702b:	48 b8 ce 6d 80 00 00 	movabs $0x806dce,%rax
+  807032:	00 00 00 
+  807035:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  807037:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80703b:	be 01 00 00 00       	mov    $0x1,%esi
+  807040:	48 89 c7             	mov    %rax,%rdi
+  807043:	48 b8 fa 26 80 00 00 	movabs $0x8026fa,%rax
+  80704a:	00 00 00 
+  80704d:	ff d0                	call   *%rax
+}
+  80704f:	90                   	nop
+  807050:	c9                   	leave
+  807051:	c3                   	ret
+
+0000000000807052 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  807052:	55                   	push   %rbp
+  807053:	48 89 e5             	mov    %rsp,%rbp
+  807056:	48 83 ec 10          	sub    $0x10,%rsp
+  80705a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80705e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807062:	be 01 00 00 00       	mov    $0x1,%esi
+  807067:	48 89 c7             	mov    %rax,%rdi
+  80706a:	48 b8 ce 6d 80 00 00 	movabs $0x806dce,%rax
+  807071:	00 00 00 
+  807074:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  807076:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80707a:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80707f:	48 89 c7             	mov    %rax,%rdi
+  807082:	48 b8 fa 26 80 00 00 	movabs $0x8026fa,%rax
+  807089:	00 00 00 
+  80708c:	ff d0                	call   *%rax
+}
+  80708e:	90                   	nop
+  80708f:	c9                   	leave
+  807090:	c3                   	ret
+
+0000000000807091 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  807091:	55                   	push   %rbp
+  807092:	48 89 e5             	mov    %rsp,%rbp
+  807095:	48 83 ec 10          	sub    $0x10,%rsp
+  807099:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80709d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8070a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8070a4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8070a7:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8070a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8070ad:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  8070b4:	90                   	nop
+  8070b5:	c9                   	leave
+  8070b6:	c3                   	ret
+
+00000000008070b7 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  8070b7:	55                   	push   %rbp
+  8070b8:	48 89 e5             	mov    %rsp,%rbp
+  8070bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8070bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  8070c3:	eb 2a                	jmp    8070ef <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  8070c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8070c8:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8070cb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8070cf:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8070d2:	89 ce                	mov    %ecx,%esi
+  8070d4:	48 89 c7             	mov    %rax,%rdi
+  8070d7:	48 b8 a2 6d 80 00 00 	movabs $0x806da2,%rax
+  8070de:	00 00 00 
+  8070e1:	ff d0                	call   *%rax
+  8070e3:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  8070e6:	75 07                	jne    8070ef <sem_trywait+0x38>
+      return 0;
+  8070e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8070ed:	eb 14                	jmp    807103 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  8070ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8070f3:	8b 00                	mov    (%rax),%eax
+  8070f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8070f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8070fc:	75 c7                	jne    8070c5 <sem_trywait+0xe>
+  return -E_BUSY;
+  8070fe:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  807103:	c9                   	leave
+  807104:	c3                   	ret
+
+0000000000807105 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  807105:	55                   	push   %rbp
+  807106:	48 89 e5             	mov    %rsp,%rbp
+  807109:	48 83 ec 30          	sub    $0x30,%rsp
+  80710d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807111:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  807115:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80711c:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  80711d:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  807122:	0f 84 fb 00 00 00    	je     807223 <sem_timedwait+0x11e>
+  807128:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  80712d:	0f 84 f0 00 00 00    	je     807223 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  807133:	48 b8 9a 64 80 00 00 	movabs $0x80649a,%rax
+  80713a:	00 00 00 
+  80713d:	ff d0                	call   *%rax
+  80713f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  807143:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807147:	48 f7 d0             	not    %rax
+  80714a:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  80714e:	73 0d                	jae    80715d <sem_timedwait+0x58>
+  807150:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  807154:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  807158:	48 01 d0             	add    %rdx,%rax
+  80715b:	eb 07                	jmp    807164 <sem_timedwait+0x5f>
+  80715d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  807164:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  807168:	e9 b6 00 00 00       	jmp    807223 <sem_timedwait+0x11e>
+    if (deadline) {
+  80716d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  807172:	74 2d                	je     8071a1 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  807174:	48 b8 9a 64 80 00 00 	movabs $0x80649a,%rax
+  80717b:	00 00 00 
+  80717e:	ff d0                	call   *%rax
+  807180:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  807184:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  807188:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80718c:	73 0a                	jae    807198 <sem_timedwait+0x93>
+  80718e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807192:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  807196:	eb 05                	jmp    80719d <sem_timedwait+0x98>
+  807198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80719d:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8071a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8071a5:	48 83 c0 04          	add    $0x4,%rax
+  8071a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8071ae:	48 89 c7             	mov    %rax,%rdi
+  8071b1:	48 b8 ce 6d 80 00 00 	movabs $0x806dce,%rax
+  8071b8:	00 00 00 
+  8071bb:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  8071bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8071c1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8071c5:	be 00 00 00 00       	mov    $0x0,%esi
+  8071ca:	48 89 c7             	mov    %rax,%rdi
+  8071cd:	48 b8 ab 26 80 00 00 	movabs $0x8026ab,%rax
+  8071d4:	00 00 00 
+  8071d7:	ff d0                	call   *%rax
+  8071d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  8071dc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8071e0:	48 83 c0 04          	add    $0x4,%rax
+  8071e4:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8071e9:	48 89 c7             	mov    %rax,%rdi
+  8071ec:	48 b8 ce 6d 80 00 00 	movabs $0x806dce,%rax
+  8071f3:	00 00 00 
+  8071f6:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  8071f8:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  8071fc:	75 25                	jne    807223 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  8071fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807202:	48 89 c7             	mov    %rax,%rdi
+  807205:	48 b8 b7 70 80 00 00 	movabs $0x8070b7,%rax
+  80720c:	00 00 00 
+  80720f:	ff d0                	call   *%rax
+  807211:	85 c0                	test   %eax,%eax
+  807213:	79 07                	jns    80721c <sem_timedwait+0x117>
+  807215:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80721a:	eb 27                	jmp    807243 <sem_timedwait+0x13e>
+  80721c:	b8 00 00 00 00       	mov    $0x0,%eax
+  807221:	eb 20                	jmp    807243 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  807223:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807227:	48 89 c7             	mov    %rax,%rdi
+  80722a:	48 b8 b7 70 80 00 00 	movabs $0x8070b7,%rax
+  807231:	00 00 00 
+  807234:	ff d0                	call   *%rax
+  807236:	85 c0                	test   %eax,%eax
+  807238:	0f 88 2f ff ff ff    	js     80716d <sem_timedwait+0x68>
+  return 0;
+  80723e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807243:	c9                   	leave
+  807244:	c3                   	ret
+
+0000000000807245 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  807245:	55                   	push   %rbp
+  807246:	48 89 e5             	mov    %rsp,%rbp
+  807249:	48 83 ec 10          	sub    $0x10,%rsp
+  80724d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  807251:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807255:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  80725c:	48 89 c7             	mov    %rax,%rdi
+  80725f:	48 b8 05 71 80 00 00 	movabs $0x807105,%rax
+  807266:	00 00 00 
+  807269:	ff d0                	call   *%rax
+}
+  80726b:	90                   	nop
+  80726c:	c9                   	leave
+  80726d:	c3                   	ret
+
+000000000080726e <sem_post>:
+sem_post(struct Semaphore *s) {
+  80726e:	55                   	push   %rbp
+  80726f:	48 89 e5             	mov    %rsp,%rbp
+  807272:	48 83 ec 10          	sub    $0x10,%rsp
+  807276:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  80727a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80727e:	be 01 00 00 00       	mov    $0x1,%esi
+  807283:	48 89 c7             	mov    %rax,%rdi
+  807286:	48 b8 ce 6d 80 00 00 	movabs $0x806dce,%rax
+  80728d:	00 00 00 
+  807290:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  807292:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807296:	8b 40 04             	mov    0x4(%rax),%eax
+  807299:	85 c0                	test   %eax,%eax
+  80729b:	74 18                	je     8072b5 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  80729d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8072a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8072a6:	48 89 c7             	mov    %rax,%rdi
+  8072a9:	48 b8 fa 26 80 00 00 	movabs $0x8026fa,%rax
+  8072b0:	00 00 00 
+  8072b3:	ff d0                	call   *%rax
+}
+  8072b5:	90                   	nop
+  8072b6:	c9                   	leave
+  8072b7:	c3                   	ret
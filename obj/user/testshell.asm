@@ -0,0 +1,11564 @@
+
+obj/user/testshell:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 0f 09 00 00       	call   80093b <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+#include <inc/lib.h>
+
+void wrong(int, int, int);
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 40          	sub    $0x40,%rsp
+  80003a:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80003d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  char c1, c2;
+  int r, rfd, wfd, kfd, n1, n2, off, nloff;
+  int pfds[2];
+
+  close(0);
+  800041:	bf 00 00 00 00       	mov    $0x0,%edi
+  800046:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  80004d:	00 00 00 
+  800050:	ff d0                	call   *%rax
+  close(1);
+  800052:	bf 01 00 00 00       	mov    $0x1,%edi
+  800057:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  80005e:	00 00 00 
+  800061:	ff d0                	call   *%rax
+  opencons();
+  800063:	48 b8 81 06 80 00 00 	movabs $0x800681,%rax
+  80006a:	00 00 00 
+  80006d:	ff d0                	call   *%rax
+  opencons();
+  80006f:	48 b8 81 06 80 00 00 	movabs $0x800681,%rax
+  800076:	00 00 00 
+  800079:	ff d0                	call   *%rax
+
+  if ((rfd = open("testshell.sh", O_RDONLY)) < 0)
+  80007b:	be 00 00 00 00       	mov    $0x0,%esi
+  800080:	48 b8 c0 75 80 00 00 	movabs $0x8075c0,%rax
+  800087:	00 00 00 
+  80008a:	48 89 c7             	mov    %rax,%rdi
+  80008d:	48 b8 3a 48 80 00 00 	movabs $0x80483a,%rax
+  800094:	00 00 00 
+  800097:	ff d0                	call   *%rax
+  800099:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80009c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8000a0:	79 36                	jns    8000d8 <umain+0xa6>
+    panic("open testshell.sh: %i", rfd);
+  8000a2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8000a5:	89 c1                	mov    %eax,%ecx
+  8000a7:	48 b8 cd 75 80 00 00 	movabs $0x8075cd,%rax
+  8000ae:	00 00 00 
+  8000b1:	48 89 c2             	mov    %rax,%rdx
+  8000b4:	be 12 00 00 00       	mov    $0x12,%esi
+  8000b9:	48 b8 e3 75 80 00 00 	movabs $0x8075e3,%rax
+  8000c0:	00 00 00 
+  8000c3:	48 89 c7             	mov    %rax,%rdi
+  8000c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cb:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  8000d2:	00 00 00 
+  8000d5:	41 ff d0             	call   *%r8
+  if ((wfd = pipe(pfds)) < 0)
+  8000d8:	48 8d 45 d4          	lea    -0x2c(%rbp),%rax
+  8000dc:	48 89 c7             	mov    %rax,%rdi
+  8000df:	48 b8 ad 5a 80 00 00 	movabs $0x805aad,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+  8000eb:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8000ee:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8000f2:	79 36                	jns    80012a <umain+0xf8>
+    panic("pipe: %i", wfd);
+  8000f4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8000f7:	89 c1                	mov    %eax,%ecx
+  8000f9:	48 b8 f4 75 80 00 00 	movabs $0x8075f4,%rax
+  800100:	00 00 00 
+  800103:	48 89 c2             	mov    %rax,%rdx
+  800106:	be 14 00 00 00       	mov    $0x14,%esi
+  80010b:	48 b8 e3 75 80 00 00 	movabs $0x8075e3,%rax
+  800112:	00 00 00 
+  800115:	48 89 c7             	mov    %rax,%rdi
+  800118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011d:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  800124:	00 00 00 
+  800127:	41 ff d0             	call   *%r8
+  wfd = pfds[1];
+  80012a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80012d:	89 45 f0             	mov    %eax,-0x10(%rbp)
+
+  cprintf("running sh -x < testshell.sh | cat\n");
+  800130:	48 b8 00 76 80 00 00 	movabs $0x807600,%rax
+  800137:	00 00 00 
+  80013a:	48 89 c7             	mov    %rax,%rdi
+  80013d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800142:	48 ba 01 0c 80 00 00 	movabs $0x800c01,%rdx
+  800149:	00 00 00 
+  80014c:	ff d2                	call   *%rdx
+  if ((r = fork()) < 0)
+  80014e:	48 b8 18 38 80 00 00 	movabs $0x803818,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+  80015a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80015d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800161:	79 36                	jns    800199 <umain+0x167>
+    panic("fork: %i", r);
+  800163:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800166:	89 c1                	mov    %eax,%ecx
+  800168:	48 b8 24 76 80 00 00 	movabs $0x807624,%rax
+  80016f:	00 00 00 
+  800172:	48 89 c2             	mov    %rax,%rdx
+  800175:	be 19 00 00 00       	mov    $0x19,%esi
+  80017a:	48 b8 e3 75 80 00 00 	movabs $0x8075e3,%rax
+  800181:	00 00 00 
+  800184:	48 89 c7             	mov    %rax,%rdi
+  800187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018c:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  800193:	00 00 00 
+  800196:	41 ff d0             	call   *%r8
+  if (r == 0) {
+  800199:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80019d:	0f 85 0a 01 00 00    	jne    8002ad <umain+0x27b>
+    dup(rfd, 0);
+  8001a3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8001a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ab:	89 c7                	mov    %eax,%edi
+  8001ad:	48 b8 66 3c 80 00 00 	movabs $0x803c66,%rax
+  8001b4:	00 00 00 
+  8001b7:	ff d0                	call   *%rax
+    dup(wfd, 1);
+  8001b9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8001bc:	be 01 00 00 00       	mov    $0x1,%esi
+  8001c1:	89 c7                	mov    %eax,%edi
+  8001c3:	48 b8 66 3c 80 00 00 	movabs $0x803c66,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+    close(rfd);
+  8001cf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8001d2:	89 c7                	mov    %eax,%edi
+  8001d4:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+    close(wfd);
+  8001e0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8001e3:	89 c7                	mov    %eax,%edi
+  8001e5:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8001ec:	00 00 00 
+  8001ef:	ff d0                	call   *%rax
+    if ((r = spawnl("/sh", "sh", "-x", 0)) < 0)
+  8001f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001f6:	48 b8 2d 76 80 00 00 	movabs $0x80762d,%rax
+  8001fd:	00 00 00 
+  800200:	48 89 c2             	mov    %rax,%rdx
+  800203:	48 b8 30 76 80 00 00 	movabs $0x807630,%rax
+  80020a:	00 00 00 
+  80020d:	48 89 c6             	mov    %rax,%rsi
+  800210:	48 b8 33 76 80 00 00 	movabs $0x807633,%rax
+  800217:	00 00 00 
+  80021a:	48 89 c7             	mov    %rax,%rdi
+  80021d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800222:	49 b8 f3 51 80 00 00 	movabs $0x8051f3,%r8
+  800229:	00 00 00 
+  80022c:	41 ff d0             	call   *%r8
+  80022f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800232:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800236:	79 36                	jns    80026e <umain+0x23c>
+      panic("spawn: %i", r);
+  800238:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80023b:	89 c1                	mov    %eax,%ecx
+  80023d:	48 b8 37 76 80 00 00 	movabs $0x807637,%rax
+  800244:	00 00 00 
+  800247:	48 89 c2             	mov    %rax,%rdx
+  80024a:	be 20 00 00 00       	mov    $0x20,%esi
+  80024f:	48 b8 e3 75 80 00 00 	movabs $0x8075e3,%rax
+  800256:	00 00 00 
+  800259:	48 89 c7             	mov    %rax,%rdi
+  80025c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800261:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  800268:	00 00 00 
+  80026b:	41 ff d0             	call   *%r8
+    close(0);
+  80026e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800273:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  80027a:	00 00 00 
+  80027d:	ff d0                	call   *%rax
+    close(1);
+  80027f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800284:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  80028b:	00 00 00 
+  80028e:	ff d0                	call   *%rax
+    wait(r);
+  800290:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800293:	89 c7                	mov    %eax,%edi
+  800295:	48 b8 fa 65 80 00 00 	movabs $0x8065fa,%rax
+  80029c:	00 00 00 
+  80029f:	ff d0                	call   *%rax
+    exit();
+  8002a1:	48 b8 be 09 80 00 00 	movabs $0x8009be,%rax
+  8002a8:	00 00 00 
+  8002ab:	ff d0                	call   *%rax
+  }
+  close(rfd);
+  8002ad:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8002b0:	89 c7                	mov    %eax,%edi
+  8002b2:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8002b9:	00 00 00 
+  8002bc:	ff d0                	call   *%rax
+  close(wfd);
+  8002be:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8002c1:	89 c7                	mov    %eax,%edi
+  8002c3:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8002ca:	00 00 00 
+  8002cd:	ff d0                	call   *%rax
+
+  rfd = pfds[0];
+  8002cf:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8002d2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  if ((kfd = open("testshell.key", O_RDONLY)) < 0)
+  8002d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8002da:	48 b8 41 76 80 00 00 	movabs $0x807641,%rax
+  8002e1:	00 00 00 
+  8002e4:	48 89 c7             	mov    %rax,%rdi
+  8002e7:	48 b8 3a 48 80 00 00 	movabs $0x80483a,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8002f6:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8002fa:	79 36                	jns    800332 <umain+0x300>
+    panic("open testshell.key for reading: %i", kfd);
+  8002fc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8002ff:	89 c1                	mov    %eax,%ecx
+  800301:	48 b8 50 76 80 00 00 	movabs $0x807650,%rax
+  800308:	00 00 00 
+  80030b:	48 89 c2             	mov    %rax,%rdx
+  80030e:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800313:	48 b8 e3 75 80 00 00 	movabs $0x8075e3,%rax
+  80031a:	00 00 00 
+  80031d:	48 89 c7             	mov    %rax,%rdi
+  800320:	b8 00 00 00 00       	mov    $0x0,%eax
+  800325:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  80032c:	00 00 00 
+  80032f:	41 ff d0             	call   *%r8
+
+  nloff = 0;
+  800332:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+  for (off = 0;; off++) {
+  800339:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+    n1 = read(rfd, &c1, 1);
+  800340:	48 8d 4d df          	lea    -0x21(%rbp),%rcx
+  800344:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800347:	ba 01 00 00 00       	mov    $0x1,%edx
+  80034c:	48 89 ce             	mov    %rcx,%rsi
+  80034f:	89 c7                	mov    %eax,%edi
+  800351:	48 b8 d2 3e 80 00 00 	movabs $0x803ed2,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+  80035d:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    n2 = read(kfd, &c2, 1);
+  800360:	48 8d 4d de          	lea    -0x22(%rbp),%rcx
+  800364:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800367:	ba 01 00 00 00       	mov    $0x1,%edx
+  80036c:	48 89 ce             	mov    %rcx,%rsi
+  80036f:	89 c7                	mov    %eax,%edi
+  800371:	48 b8 d2 3e 80 00 00 	movabs $0x803ed2,%rax
+  800378:	00 00 00 
+  80037b:	ff d0                	call   *%rax
+  80037d:	89 45 e0             	mov    %eax,-0x20(%rbp)
+    if (n1 < 0)
+  800380:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  800384:	79 36                	jns    8003bc <umain+0x38a>
+      panic("reading testshell.out: %i", n1);
+  800386:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800389:	89 c1                	mov    %eax,%ecx
+  80038b:	48 b8 73 76 80 00 00 	movabs $0x807673,%rax
+  800392:	00 00 00 
+  800395:	48 89 c2             	mov    %rax,%rdx
+  800398:	be 32 00 00 00       	mov    $0x32,%esi
+  80039d:	48 b8 e3 75 80 00 00 	movabs $0x8075e3,%rax
+  8003a4:	00 00 00 
+  8003a7:	48 89 c7             	mov    %rax,%rdi
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  8003b6:	00 00 00 
+  8003b9:	41 ff d0             	call   *%r8
+    if (n2 < 0)
+  8003bc:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8003c0:	79 36                	jns    8003f8 <umain+0x3c6>
+      panic("reading testshell.key: %i", n2);
+  8003c2:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003c5:	89 c1                	mov    %eax,%ecx
+  8003c7:	48 b8 8d 76 80 00 00 	movabs $0x80768d,%rax
+  8003ce:	00 00 00 
+  8003d1:	48 89 c2             	mov    %rax,%rdx
+  8003d4:	be 34 00 00 00       	mov    $0x34,%esi
+  8003d9:	48 b8 e3 75 80 00 00 	movabs $0x8075e3,%rax
+  8003e0:	00 00 00 
+  8003e3:	48 89 c7             	mov    %rax,%rdi
+  8003e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003eb:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  8003f2:	00 00 00 
+  8003f5:	41 ff d0             	call   *%r8
+    if (n1 == 0 && n2 == 0)
+  8003f8:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  8003fc:	75 06                	jne    800404 <umain+0x3d2>
+  8003fe:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800402:	74 4b                	je     80044f <umain+0x41d>
+      break;
+    if (n1 != 1 || n2 != 1 || c1 != c2)
+  800404:	83 7d e4 01          	cmpl   $0x1,-0x1c(%rbp)
+  800408:	75 12                	jne    80041c <umain+0x3ea>
+  80040a:	83 7d e0 01          	cmpl   $0x1,-0x20(%rbp)
+  80040e:	75 0c                	jne    80041c <umain+0x3ea>
+  800410:	0f b6 55 df          	movzbl -0x21(%rbp),%edx
+  800414:	0f b6 45 de          	movzbl -0x22(%rbp),%eax
+  800418:	38 c2                	cmp    %al,%dl
+  80041a:	74 19                	je     800435 <umain+0x403>
+      wrong(rfd, kfd, nloff);
+  80041c:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80041f:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  800422:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800425:	89 ce                	mov    %ecx,%esi
+  800427:	89 c7                	mov    %eax,%edi
+  800429:	48 b8 73 04 80 00 00 	movabs $0x800473,%rax
+  800430:	00 00 00 
+  800433:	ff d0                	call   *%rax
+    if (c1 == '\n')
+  800435:	0f b6 45 df          	movzbl -0x21(%rbp),%eax
+  800439:	3c 0a                	cmp    $0xa,%al
+  80043b:	75 09                	jne    800446 <umain+0x414>
+      nloff = off + 1;
+  80043d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800440:	83 c0 01             	add    $0x1,%eax
+  800443:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  for (off = 0;; off++) {
+  800446:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+    n1 = read(rfd, &c1, 1);
+  80044a:	e9 f1 fe ff ff       	jmp    800340 <umain+0x30e>
+      break;
+  80044f:	90                   	nop
+  }
+  cprintf("shell ran correctly\n");
+  800450:	48 b8 a7 76 80 00 00 	movabs $0x8076a7,%rax
+  800457:	00 00 00 
+  80045a:	48 89 c7             	mov    %rax,%rdi
+  80045d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800462:	48 ba 01 0c 80 00 00 	movabs $0x800c01,%rdx
+  800469:	00 00 00 
+  80046c:	ff d2                	call   *%rdx
+static __inline void wrmsr(uint32_t msr, uint64_t val) __attribute__((always_inline));
+static __inline void wbinvd(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void) {
+  __asm __volatile("int3");
+  80046e:	cc                   	int3
+}
+  80046f:	90                   	nop
+
+  breakpoint();
+}
+  800470:	90                   	nop
+  800471:	c9                   	leave
+  800472:	c3                   	ret
+
+0000000000800473 <wrong>:
+
+void
+wrong(int rfd, int kfd, int off) {
+  800473:	55                   	push   %rbp
+  800474:	48 89 e5             	mov    %rsp,%rbp
+  800477:	48 83 c4 80          	add    $0xffffffffffffff80,%rsp
+  80047b:	89 7d 8c             	mov    %edi,-0x74(%rbp)
+  80047e:	89 75 88             	mov    %esi,-0x78(%rbp)
+  800481:	89 55 84             	mov    %edx,-0x7c(%rbp)
+  char buf[100];
+  int n;
+
+  seek(rfd, off);
+  800484:	8b 55 84             	mov    -0x7c(%rbp),%edx
+  800487:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  80048a:	89 d6                	mov    %edx,%esi
+  80048c:	89 c7                	mov    %eax,%edi
+  80048e:	48 b8 4f 41 80 00 00 	movabs $0x80414f,%rax
+  800495:	00 00 00 
+  800498:	ff d0                	call   *%rax
+  seek(kfd, off);
+  80049a:	8b 55 84             	mov    -0x7c(%rbp),%edx
+  80049d:	8b 45 88             	mov    -0x78(%rbp),%eax
+  8004a0:	89 d6                	mov    %edx,%esi
+  8004a2:	89 c7                	mov    %eax,%edi
+  8004a4:	48 b8 4f 41 80 00 00 	movabs $0x80414f,%rax
+  8004ab:	00 00 00 
+  8004ae:	ff d0                	call   *%rax
+
+  cprintf("shell produced incorrect output.\n");
+  8004b0:	48 b8 c0 76 80 00 00 	movabs $0x8076c0,%rax
+  8004b7:	00 00 00 
+  8004ba:	48 89 c7             	mov    %rax,%rdi
+  8004bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c2:	48 ba 01 0c 80 00 00 	movabs $0x800c01,%rdx
+  8004c9:	00 00 00 
+  8004cc:	ff d2                	call   *%rdx
+  cprintf("expected:\n===\n");
+  8004ce:	48 b8 e2 76 80 00 00 	movabs $0x8076e2,%rax
+  8004d5:	00 00 00 
+  8004d8:	48 89 c7             	mov    %rax,%rdi
+  8004db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e0:	48 ba 01 0c 80 00 00 	movabs $0x800c01,%rdx
+  8004e7:	00 00 00 
+  8004ea:	ff d2                	call   *%rdx
+  while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  8004ec:	eb 1c                	jmp    80050a <wrong+0x97>
+    sys_cputs(buf, n);
+  8004ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8004f1:	48 63 d0             	movslq %eax,%rdx
+  8004f4:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  8004f8:	48 89 d6             	mov    %rdx,%rsi
+  8004fb:	48 89 c7             	mov    %rax,%rdi
+  8004fe:	48 b8 68 27 80 00 00 	movabs $0x802768,%rax
+  800505:	00 00 00 
+  800508:	ff d0                	call   *%rax
+  while ((n = read(kfd, buf, sizeof buf - 1)) > 0)
+  80050a:	48 8d 4d 90          	lea    -0x70(%rbp),%rcx
+  80050e:	8b 45 88             	mov    -0x78(%rbp),%eax
+  800511:	ba 63 00 00 00       	mov    $0x63,%edx
+  800516:	48 89 ce             	mov    %rcx,%rsi
+  800519:	89 c7                	mov    %eax,%edi
+  80051b:	48 b8 d2 3e 80 00 00 	movabs $0x803ed2,%rax
+  800522:	00 00 00 
+  800525:	ff d0                	call   *%rax
+  800527:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80052a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80052e:	7f be                	jg     8004ee <wrong+0x7b>
+  cprintf("===\ngot:\n===\n");
+  800530:	48 b8 f1 76 80 00 00 	movabs $0x8076f1,%rax
+  800537:	00 00 00 
+  80053a:	48 89 c7             	mov    %rax,%rdi
+  80053d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800542:	48 ba 01 0c 80 00 00 	movabs $0x800c01,%rdx
+  800549:	00 00 00 
+  80054c:	ff d2                	call   *%rdx
+  while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  80054e:	eb 1c                	jmp    80056c <wrong+0xf9>
+    sys_cputs(buf, n);
+  800550:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800553:	48 63 d0             	movslq %eax,%rdx
+  800556:	48 8d 45 90          	lea    -0x70(%rbp),%rax
+  80055a:	48 89 d6             	mov    %rdx,%rsi
+  80055d:	48 89 c7             	mov    %rax,%rdi
+  800560:	48 b8 68 27 80 00 00 	movabs $0x802768,%rax
+  800567:	00 00 00 
+  80056a:	ff d0                	call   *%rax
+  while ((n = read(rfd, buf, sizeof buf - 1)) > 0)
+  80056c:	48 8d 4d 90          	lea    -0x70(%rbp),%rcx
+  800570:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  800573:	ba 63 00 00 00       	mov    $0x63,%edx
+  800578:	48 89 ce             	mov    %rcx,%rsi
+  80057b:	89 c7                	mov    %eax,%edi
+  80057d:	48 b8 d2 3e 80 00 00 	movabs $0x803ed2,%rax
+  800584:	00 00 00 
+  800587:	ff d0                	call   *%rax
+  800589:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80058c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800590:	7f be                	jg     800550 <wrong+0xdd>
+  cprintf("===\n");
+  800592:	48 b8 ff 76 80 00 00 	movabs $0x8076ff,%rax
+  800599:	00 00 00 
+  80059c:	48 89 c7             	mov    %rax,%rdi
+  80059f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a4:	48 ba 01 0c 80 00 00 	movabs $0x800c01,%rdx
+  8005ab:	00 00 00 
+  8005ae:	ff d2                	call   *%rdx
+  exit();
+  8005b0:	48 b8 be 09 80 00 00 	movabs $0x8009be,%rax
+  8005b7:	00 00 00 
+  8005ba:	ff d0                	call   *%rax
+}
+  8005bc:	90                   	nop
+  8005bd:	c9                   	leave
+  8005be:	c3                   	ret
+
+00000000008005bf <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  8005bf:	55                   	push   %rbp
+  8005c0:	48 89 e5             	mov    %rsp,%rbp
+  8005c3:	48 83 ec 20          	sub    $0x20,%rsp
+  8005c7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  8005ca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8005cd:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8005d0:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8005d4:	be 01 00 00 00       	mov    $0x1,%esi
+  8005d9:	48 89 c7             	mov    %rax,%rdi
+  8005dc:	48 b8 68 27 80 00 00 	movabs $0x802768,%rax
+  8005e3:	00 00 00 
+  8005e6:	ff d0                	call   *%rax
+}
+  8005e8:	90                   	nop
+  8005e9:	c9                   	leave
+  8005ea:	c3                   	ret
+
+00000000008005eb <getchar>:
+
+int
+getchar(void) {
+  8005eb:	55                   	push   %rbp
+  8005ec:	48 89 e5             	mov    %rsp,%rbp
+  8005ef:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8005f3:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8005f7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8005fc:	48 89 c6             	mov    %rax,%rsi
+  8005ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800604:	48 b8 d2 3e 80 00 00 	movabs $0x803ed2,%rax
+  80060b:	00 00 00 
+  80060e:	ff d0                	call   *%rax
+  800610:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  800613:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800617:	79 05                	jns    80061e <getchar+0x33>
+    return r;
+  800619:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80061c:	eb 14                	jmp    800632 <getchar+0x47>
+  if (r < 1)
+  80061e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  800622:	7f 07                	jg     80062b <getchar+0x40>
+    return -E_EOF;
+  800624:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  800629:	eb 07                	jmp    800632 <getchar+0x47>
+  return c;
+  80062b:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  80062f:	0f b6 c0             	movzbl %al,%eax
+}
+  800632:	c9                   	leave
+  800633:	c3                   	ret
+
+0000000000800634 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  800634:	55                   	push   %rbp
+  800635:	48 89 e5             	mov    %rsp,%rbp
+  800638:	48 83 ec 20          	sub    $0x20,%rsp
+  80063c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80063f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800643:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800646:	48 89 d6             	mov    %rdx,%rsi
+  800649:	89 c7                	mov    %eax,%edi
+  80064b:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  800652:	00 00 00 
+  800655:	ff d0                	call   *%rax
+  800657:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80065a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80065e:	79 05                	jns    800665 <iscons+0x31>
+    return r;
+  800660:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800663:	eb 1a                	jmp    80067f <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  800665:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800669:	8b 10                	mov    (%rax),%edx
+  80066b:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800672:	00 00 00 
+  800675:	8b 00                	mov    (%rax),%eax
+  800677:	39 c2                	cmp    %eax,%edx
+  800679:	0f 94 c0             	sete   %al
+  80067c:	0f b6 c0             	movzbl %al,%eax
+}
+  80067f:	c9                   	leave
+  800680:	c3                   	ret
+
+0000000000800681 <opencons>:
+
+int
+opencons(void) {
+  800681:	55                   	push   %rbp
+  800682:	48 89 e5             	mov    %rsp,%rbp
+  800685:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  800689:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80068d:	48 89 c7             	mov    %rax,%rdi
+  800690:	48 b8 94 38 80 00 00 	movabs $0x803894,%rax
+  800697:	00 00 00 
+  80069a:	ff d0                	call   *%rax
+  80069c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80069f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8006a3:	79 05                	jns    8006aa <opencons+0x29>
+    return r;
+  8006a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8006a8:	eb 66                	jmp    800710 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  8006aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006ae:	ba 07 04 00 00       	mov    $0x407,%edx
+  8006b3:	48 89 c6             	mov    %rax,%rsi
+  8006b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8006bb:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  8006c2:	00 00 00 
+  8006c5:	ff d0                	call   *%rax
+  8006c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8006ca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8006ce:	79 05                	jns    8006d5 <opencons+0x54>
+    return r;
+  8006d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8006d3:	eb 3b                	jmp    800710 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8006d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006d9:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8006e0:	00 00 00 
+  8006e3:	8b 12                	mov    (%rdx),%edx
+  8006e5:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8006e7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006eb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8006f2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8006f6:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8006fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800701:	48 89 c7             	mov    %rax,%rdi
+  800704:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  80070b:	00 00 00 
+  80070e:	ff d0                	call   *%rax
+}
+  800710:	c9                   	leave
+  800711:	c3                   	ret
+
+0000000000800712 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  800712:	55                   	push   %rbp
+  800713:	48 89 e5             	mov    %rsp,%rbp
+  800716:	48 83 ec 20          	sub    $0x20,%rsp
+  80071a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80071d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800720:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  800724:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800727:	48 89 d6             	mov    %rdx,%rsi
+  80072a:	89 c7                	mov    %eax,%edi
+  80072c:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  800733:	00 00 00 
+  800736:	ff d0                	call   *%rax
+  800738:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80073b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80073f:	79 05                	jns    800746 <consmode+0x34>
+    return r;
+  800741:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800744:	eb 34                	jmp    80077a <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  800746:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80074a:	8b 10                	mov    (%rax),%edx
+  80074c:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  800753:	00 00 00 
+  800756:	8b 00                	mov    (%rax),%eax
+  800758:	39 c2                	cmp    %eax,%edx
+  80075a:	74 07                	je     800763 <consmode+0x51>
+    return -E_INVAL;
+  80075c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800761:	eb 17                	jmp    80077a <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  800763:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800767:	8b 40 0c             	mov    0xc(%rax),%eax
+  80076a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  80076d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800771:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800774:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  800777:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80077a:	c9                   	leave
+  80077b:	c3                   	ret
+
+000000000080077c <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80077c:	55                   	push   %rbp
+  80077d:	48 89 e5             	mov    %rsp,%rbp
+  800780:	48 83 ec 20          	sub    $0x20,%rsp
+  800784:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800788:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80078c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  800790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800794:	8b 50 0c             	mov    0xc(%rax),%edx
+  800797:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80079b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80079f:	48 89 ce             	mov    %rcx,%rsi
+  8007a2:	48 89 c7             	mov    %rax,%rdi
+  8007a5:	48 b8 d9 2c 80 00 00 	movabs $0x802cd9,%rax
+  8007ac:	00 00 00 
+  8007af:	ff d0                	call   *%rax
+  8007b1:	48 98                	cltq
+}
+  8007b3:	c9                   	leave
+  8007b4:	c3                   	ret
+
+00000000008007b5 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8007b5:	55                   	push   %rbp
+  8007b6:	48 89 e5             	mov    %rsp,%rbp
+  8007b9:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  8007c0:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  8007c7:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  8007ce:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  8007d5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8007dc:	eb 74                	jmp    800852 <devcons_write+0x9d>
+    m = n - tot;
+  8007de:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8007e5:	89 c2                	mov    %eax,%edx
+  8007e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8007ea:	29 c2                	sub    %eax,%edx
+  8007ec:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8007ef:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8007f2:	83 f8 7f             	cmp    $0x7f,%eax
+  8007f5:	76 07                	jbe    8007fe <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8007f7:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8007fe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800801:	48 63 d0             	movslq %eax,%rdx
+  800804:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800807:	48 63 c8             	movslq %eax,%rcx
+  80080a:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  800811:	48 01 c1             	add    %rax,%rcx
+  800814:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80081b:	48 89 ce             	mov    %rcx,%rsi
+  80081e:	48 89 c7             	mov    %rax,%rdi
+  800821:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  800828:	00 00 00 
+  80082b:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  80082d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800830:	48 63 d0             	movslq %eax,%rdx
+  800833:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  80083a:	48 89 d6             	mov    %rdx,%rsi
+  80083d:	48 89 c7             	mov    %rax,%rdi
+  800840:	48 b8 68 27 80 00 00 	movabs $0x802768,%rax
+  800847:	00 00 00 
+  80084a:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  80084c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80084f:	01 45 fc             	add    %eax,-0x4(%rbp)
+  800852:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800855:	48 98                	cltq
+  800857:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  80085e:	0f 82 7a ff ff ff    	jb     8007de <devcons_write+0x29>
+  }
+  return tot;
+  800864:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800867:	48 98                	cltq
+}
+  800869:	c9                   	leave
+  80086a:	c3                   	ret
+
+000000000080086b <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  80086b:	55                   	push   %rbp
+  80086c:	48 89 e5             	mov    %rsp,%rbp
+  80086f:	48 83 ec 08          	sub    $0x8,%rsp
+  800873:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  800877:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80087c:	c9                   	leave
+  80087d:	c3                   	ret
+
+000000000080087e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80087e:	55                   	push   %rbp
+  80087f:	48 89 e5             	mov    %rsp,%rbp
+  800882:	48 83 ec 10          	sub    $0x10,%rsp
+  800886:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80088a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  80088e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800892:	48 ba 09 77 80 00 00 	movabs $0x807709,%rdx
+  800899:	00 00 00 
+  80089c:	48 89 d6             	mov    %rdx,%rsi
+  80089f:	48 89 c7             	mov    %rax,%rdi
+  8008a2:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  8008a9:	00 00 00 
+  8008ac:	ff d0                	call   *%rax
+  return 0;
+  8008ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008b3:	c9                   	leave
+  8008b4:	c3                   	ret
+
+00000000008008b5 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8008b5:	55                   	push   %rbp
+  8008b6:	48 89 e5             	mov    %rsp,%rbp
+  8008b9:	48 83 ec 30          	sub    $0x30,%rsp
+  8008bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8008c1:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8008c4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8008c8:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8008cf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008d2:	83 e0 02             	and    $0x2,%eax
+  8008d5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8008d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8008dc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8008df:	83 f8 01             	cmp    $0x1,%eax
+  8008e2:	75 04                	jne    8008e8 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8008e4:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8008e8:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8008eb:	83 e0 01             	and    $0x1,%eax
+  8008ee:	85 c0                	test   %eax,%eax
+  8008f0:	74 44                	je     800936 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8008f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8008f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fa:	89 c2                	mov    %eax,%edx
+  8008fc:	be 00 00 00 00       	mov    $0x0,%esi
+  800901:	bf 00 00 00 00       	mov    $0x0,%edi
+  800906:	48 b8 c7 2d 80 00 00 	movabs $0x802dc7,%rax
+  80090d:	00 00 00 
+  800910:	ff d0                	call   *%rax
+  800912:	83 f8 01             	cmp    $0x1,%eax
+  800915:	75 06                	jne    80091d <devcons_poll+0x68>
+      revents |= POLLIN;
+  800917:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  80091b:	eb 19                	jmp    800936 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  80091d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800921:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  800927:	0b 45 fc             	or     -0x4(%rbp),%eax
+  80092a:	89 c2                	mov    %eax,%edx
+  80092c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800930:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  800936:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800939:	c9                   	leave
+  80093a:	c3                   	ret
+
+000000000080093b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80093b:	55                   	push   %rbp
+  80093c:	48 89 e5             	mov    %rsp,%rbp
+  80093f:	48 83 ec 20          	sub    $0x20,%rsp
+  800943:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800946:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  80094a:	48 b8 00 91 80 00 00 	movabs $0x809100,%rax
+  800951:	00 00 00 
+  800954:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800958:	eb 13                	jmp    80096d <libmain+0x32>
+    (*ctor)();
+  80095a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80095e:	48 8b 10             	mov    (%rax),%rdx
+  800961:	b8 00 00 00 00       	mov    $0x0,%eax
+  800966:	ff d2                	call   *%rdx
+    ctor++;
+  800968:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  80096d:	48 b8 00 91 80 00 00 	movabs $0x809100,%rax
+  800974:	00 00 00 
+  800977:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80097b:	72 dd                	jb     80095a <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80097d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800981:	7e 14                	jle    800997 <libmain+0x5c>
+    binaryname = argv[0];
+  800983:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800987:	48 8b 00             	mov    (%rax),%rax
+  80098a:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  800991:	00 00 00 
+  800994:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800997:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80099b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80099e:	48 89 d6             	mov    %rdx,%rsi
+  8009a1:	89 c7                	mov    %eax,%edi
+  8009a3:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8009aa:	00 00 00 
+  8009ad:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8009af:	48 b8 be 09 80 00 00 	movabs $0x8009be,%rax
+  8009b6:	00 00 00 
+  8009b9:	ff d0                	call   *%rax
+#endif
+}
+  8009bb:	90                   	nop
+  8009bc:	c9                   	leave
+  8009bd:	c3                   	ret
+
+00000000008009be <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8009be:	55                   	push   %rbp
+  8009bf:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8009c2:	48 b8 36 3c 80 00 00 	movabs $0x803c36,%rax
+  8009c9:	00 00 00 
+  8009cc:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8009ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d3:	48 b8 37 28 80 00 00 	movabs $0x802837,%rax
+  8009da:	00 00 00 
+  8009dd:	ff d0                	call   *%rax
+}
+  8009df:	90                   	nop
+  8009e0:	5d                   	pop    %rbp
+  8009e1:	c3                   	ret
+
+00000000008009e2 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8009e2:	55                   	push   %rbp
+  8009e3:	48 89 e5             	mov    %rsp,%rbp
+  8009e6:	53                   	push   %rbx
+  8009e7:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8009ee:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8009f5:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8009fb:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800a02:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800a09:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800a10:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800a17:	84 c0                	test   %al,%al
+  800a19:	74 23                	je     800a3e <_panic+0x5c>
+  800a1b:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800a22:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800a26:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800a2a:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800a2e:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800a32:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800a36:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800a3a:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800a3e:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800a45:	00 00 00 
+  800a48:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800a4f:	00 00 00 
+  800a52:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a56:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800a5d:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800a64:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a6b:	48 b8 40 90 80 00 00 	movabs $0x809040,%rax
+  800a72:	00 00 00 
+  800a75:	48 8b 18             	mov    (%rax),%rbx
+  800a78:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  800a7f:	00 00 00 
+  800a82:	ff d0                	call   *%rax
+  800a84:	89 c6                	mov    %eax,%esi
+  800a86:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800a8c:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800a93:	41 89 d0             	mov    %edx,%r8d
+  800a96:	48 89 c1             	mov    %rax,%rcx
+  800a99:	48 89 da             	mov    %rbx,%rdx
+  800a9c:	48 b8 20 77 80 00 00 	movabs $0x807720,%rax
+  800aa3:	00 00 00 
+  800aa6:	48 89 c7             	mov    %rax,%rdi
+  800aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aae:	49 b9 01 0c 80 00 00 	movabs $0x800c01,%r9
+  800ab5:	00 00 00 
+  800ab8:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800abb:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800ac2:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800ac9:	48 89 d6             	mov    %rdx,%rsi
+  800acc:	48 89 c7             	mov    %rax,%rdi
+  800acf:	48 b8 76 0b 80 00 00 	movabs $0x800b76,%rax
+  800ad6:	00 00 00 
+  800ad9:	ff d0                	call   *%rax
+  cprintf("\n");
+  800adb:	48 b8 43 77 80 00 00 	movabs $0x807743,%rax
+  800ae2:	00 00 00 
+  800ae5:	48 89 c7             	mov    %rax,%rdi
+  800ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aed:	48 ba 01 0c 80 00 00 	movabs $0x800c01,%rdx
+  800af4:	00 00 00 
+  800af7:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800af9:	cc                   	int3
+  800afa:	eb fd                	jmp    800af9 <_panic+0x117>
+
+0000000000800afc <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800afc:	55                   	push   %rbp
+  800afd:	48 89 e5             	mov    %rsp,%rbp
+  800b00:	48 83 ec 10          	sub    $0x10,%rsp
+  800b04:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800b07:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800b0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b0f:	8b 00                	mov    (%rax),%eax
+  800b11:	8d 48 01             	lea    0x1(%rax),%ecx
+  800b14:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b18:	89 0a                	mov    %ecx,(%rdx)
+  800b1a:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800b1d:	89 d1                	mov    %edx,%ecx
+  800b1f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b23:	48 98                	cltq
+  800b25:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800b29:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b2d:	8b 00                	mov    (%rax),%eax
+  800b2f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800b34:	75 2c                	jne    800b62 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800b36:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b3a:	8b 00                	mov    (%rax),%eax
+  800b3c:	48 98                	cltq
+  800b3e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800b42:	48 83 c2 08          	add    $0x8,%rdx
+  800b46:	48 89 c6             	mov    %rax,%rsi
+  800b49:	48 89 d7             	mov    %rdx,%rdi
+  800b4c:	48 b8 68 27 80 00 00 	movabs $0x802768,%rax
+  800b53:	00 00 00 
+  800b56:	ff d0                	call   *%rax
+    b->idx = 0;
+  800b58:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b5c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800b62:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b66:	8b 40 04             	mov    0x4(%rax),%eax
+  800b69:	8d 50 01             	lea    0x1(%rax),%edx
+  800b6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b70:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800b73:	90                   	nop
+  800b74:	c9                   	leave
+  800b75:	c3                   	ret
+
+0000000000800b76 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800b76:	55                   	push   %rbp
+  800b77:	48 89 e5             	mov    %rsp,%rbp
+  800b7a:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800b81:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800b88:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800b8f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800b96:	00 00 00 
+  b.cnt = 0;
+  800b99:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800ba0:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  800ba3:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800baa:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800bb1:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800bb8:	48 89 c6             	mov    %rax,%rsi
+  800bbb:	48 b8 fc 0a 80 00 00 	movabs $0x800afc,%rax
+  800bc2:	00 00 00 
+  800bc5:	48 89 c7             	mov    %rax,%rdi
+  800bc8:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  800bcf:	00 00 00 
+  800bd2:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  800bd4:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800bda:	48 98                	cltq
+  800bdc:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  800be3:	48 83 c2 08          	add    $0x8,%rdx
+  800be7:	48 89 c6             	mov    %rax,%rsi
+  800bea:	48 89 d7             	mov    %rdx,%rdi
+  800bed:	48 b8 68 27 80 00 00 	movabs $0x802768,%rax
+  800bf4:	00 00 00 
+  800bf7:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800bf9:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800bff:	c9                   	leave
+  800c00:	c3                   	ret
+
+0000000000800c01 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800c01:	55                   	push   %rbp
+  800c02:	48 89 e5             	mov    %rsp,%rbp
+  800c05:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800c0c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800c13:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800c1a:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800c21:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800c28:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800c2f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800c36:	84 c0                	test   %al,%al
+  800c38:	74 20                	je     800c5a <cprintf+0x59>
+  800c3a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800c3e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800c42:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800c46:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800c4a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800c4e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800c52:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800c56:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800c5a:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800c61:	00 00 00 
+  800c64:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800c6b:	00 00 00 
+  800c6e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c72:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800c79:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800c80:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800c87:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800c8e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c95:	48 89 d6             	mov    %rdx,%rsi
+  800c98:	48 89 c7             	mov    %rax,%rdi
+  800c9b:	48 b8 76 0b 80 00 00 	movabs $0x800b76,%rax
+  800ca2:	00 00 00 
+  800ca5:	ff d0                	call   *%rax
+  800ca7:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800cad:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800cb3:	c9                   	leave
+  800cb4:	c3                   	ret
+
+0000000000800cb5 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  800cb5:	55                   	push   %rbp
+  800cb6:	48 89 e5             	mov    %rsp,%rbp
+  800cb9:	48 83 ec 30          	sub    $0x30,%rsp
+  800cbd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800cc1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800cc5:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800cc9:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800ccc:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800cd0:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  800cd4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800cd7:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800cdb:	72 54                	jb     800d31 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800cdd:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800ce0:	8d 78 ff             	lea    -0x1(%rax),%edi
+  800ce3:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800ce6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cea:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cef:	48 f7 f6             	div    %rsi
+  800cf2:	49 89 c2             	mov    %rax,%r10
+  800cf5:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800cf8:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800cfb:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800cff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d03:	41 89 c9             	mov    %ecx,%r9d
+  800d06:	41 89 f8             	mov    %edi,%r8d
+  800d09:	89 d1                	mov    %edx,%ecx
+  800d0b:	4c 89 d2             	mov    %r10,%rdx
+  800d0e:	48 89 c7             	mov    %rax,%rdi
+  800d11:	48 b8 b5 0c 80 00 00 	movabs $0x800cb5,%rax
+  800d18:	00 00 00 
+  800d1b:	ff d0                	call   *%rax
+  800d1d:	eb 1c                	jmp    800d3b <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800d1f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d23:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800d26:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800d2a:	48 89 d6             	mov    %rdx,%rsi
+  800d2d:	89 c7                	mov    %eax,%edi
+  800d2f:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800d31:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800d35:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800d39:	7f e4                	jg     800d1f <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800d3b:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800d3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d47:	48 f7 f1             	div    %rcx
+  800d4a:	48 b8 90 79 80 00 00 	movabs $0x807990,%rax
+  800d51:	00 00 00 
+  800d54:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800d58:	0f be c0             	movsbl %al,%eax
+  800d5b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800d5f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800d63:	48 89 d6             	mov    %rdx,%rsi
+  800d66:	89 c7                	mov    %eax,%edi
+  800d68:	ff d1                	call   *%rcx
+}
+  800d6a:	90                   	nop
+  800d6b:	c9                   	leave
+  800d6c:	c3                   	ret
+
+0000000000800d6d <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800d6d:	55                   	push   %rbp
+  800d6e:	48 89 e5             	mov    %rsp,%rbp
+  800d71:	48 83 ec 10          	sub    $0x10,%rsp
+  800d75:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800d79:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800d7c:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800d80:	7e 4b                	jle    800dcd <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800d82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d86:	8b 00                	mov    (%rax),%eax
+  800d88:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8b:	77 24                	ja     800db1 <getuint+0x44>
+  800d8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d91:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800d95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d99:	8b 00                	mov    (%rax),%eax
+  800d9b:	89 c0                	mov    %eax,%eax
+  800d9d:	48 01 d0             	add    %rdx,%rax
+  800da0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800da4:	8b 12                	mov    (%rdx),%edx
+  800da6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800da9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800dad:	89 0a                	mov    %ecx,(%rdx)
+  800daf:	eb 14                	jmp    800dc5 <getuint+0x58>
+  800db1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800db5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800db9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800dbd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800dc1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800dc5:	48 8b 00             	mov    (%rax),%rax
+  800dc8:	e9 95 00 00 00       	jmp    800e62 <getuint+0xf5>
+  else if (lflag)
+  800dcd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800dd1:	74 48                	je     800e1b <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800dd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800dd7:	8b 00                	mov    (%rax),%eax
+  800dd9:	83 f8 2f             	cmp    $0x2f,%eax
+  800ddc:	77 24                	ja     800e02 <getuint+0x95>
+  800dde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800de2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800de6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800dea:	8b 00                	mov    (%rax),%eax
+  800dec:	89 c0                	mov    %eax,%eax
+  800dee:	48 01 d0             	add    %rdx,%rax
+  800df1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800df5:	8b 12                	mov    (%rdx),%edx
+  800df7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800dfa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800dfe:	89 0a                	mov    %ecx,(%rdx)
+  800e00:	eb 14                	jmp    800e16 <getuint+0xa9>
+  800e02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e06:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e0a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800e0e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800e12:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800e16:	48 8b 00             	mov    (%rax),%rax
+  800e19:	eb 47                	jmp    800e62 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800e1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e1f:	8b 00                	mov    (%rax),%eax
+  800e21:	83 f8 2f             	cmp    $0x2f,%eax
+  800e24:	77 24                	ja     800e4a <getuint+0xdd>
+  800e26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e2a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800e2e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e32:	8b 00                	mov    (%rax),%eax
+  800e34:	89 c0                	mov    %eax,%eax
+  800e36:	48 01 d0             	add    %rdx,%rax
+  800e39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800e3d:	8b 12                	mov    (%rdx),%edx
+  800e3f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800e42:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800e46:	89 0a                	mov    %ecx,(%rdx)
+  800e48:	eb 14                	jmp    800e5e <getuint+0xf1>
+  800e4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e4e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800e52:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800e56:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800e5a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800e5e:	8b 00                	mov    (%rax),%eax
+  800e60:	89 c0                	mov    %eax,%eax
+}
+  800e62:	c9                   	leave
+  800e63:	c3                   	ret
+
+0000000000800e64 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800e64:	55                   	push   %rbp
+  800e65:	48 89 e5             	mov    %rsp,%rbp
+  800e68:	48 83 ec 10          	sub    $0x10,%rsp
+  800e6c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800e70:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800e73:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800e77:	7e 4b                	jle    800ec4 <getint+0x60>
+    return va_arg(*ap, long long);
+  800e79:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e7d:	8b 00                	mov    (%rax),%eax
+  800e7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e82:	77 24                	ja     800ea8 <getint+0x44>
+  800e84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e88:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800e8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e90:	8b 00                	mov    (%rax),%eax
+  800e92:	89 c0                	mov    %eax,%eax
+  800e94:	48 01 d0             	add    %rdx,%rax
+  800e97:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800e9b:	8b 12                	mov    (%rdx),%edx
+  800e9d:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ea0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ea4:	89 0a                	mov    %ecx,(%rdx)
+  800ea6:	eb 14                	jmp    800ebc <getint+0x58>
+  800ea8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800eac:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800eb0:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800eb4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800eb8:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ebc:	48 8b 00             	mov    (%rax),%rax
+  800ebf:	e9 95 00 00 00       	jmp    800f59 <getint+0xf5>
+  else if (lflag)
+  800ec4:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800ec8:	74 48                	je     800f12 <getint+0xae>
+    return va_arg(*ap, long);
+  800eca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ece:	8b 00                	mov    (%rax),%eax
+  800ed0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ed3:	77 24                	ja     800ef9 <getint+0x95>
+  800ed5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ed9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800edd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ee1:	8b 00                	mov    (%rax),%eax
+  800ee3:	89 c0                	mov    %eax,%eax
+  800ee5:	48 01 d0             	add    %rdx,%rax
+  800ee8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800eec:	8b 12                	mov    (%rdx),%edx
+  800eee:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ef1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ef5:	89 0a                	mov    %ecx,(%rdx)
+  800ef7:	eb 14                	jmp    800f0d <getint+0xa9>
+  800ef9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800efd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f01:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800f05:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f09:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800f0d:	48 8b 00             	mov    (%rax),%rax
+  800f10:	eb 47                	jmp    800f59 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800f12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f16:	8b 00                	mov    (%rax),%eax
+  800f18:	83 f8 2f             	cmp    $0x2f,%eax
+  800f1b:	77 24                	ja     800f41 <getint+0xdd>
+  800f1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f21:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800f25:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f29:	8b 00                	mov    (%rax),%eax
+  800f2b:	89 c0                	mov    %eax,%eax
+  800f2d:	48 01 d0             	add    %rdx,%rax
+  800f30:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f34:	8b 12                	mov    (%rdx),%edx
+  800f36:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800f39:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f3d:	89 0a                	mov    %ecx,(%rdx)
+  800f3f:	eb 14                	jmp    800f55 <getint+0xf1>
+  800f41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800f45:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800f49:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800f4d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800f51:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800f55:	8b 00                	mov    (%rax),%eax
+  800f57:	48 98                	cltq
+}
+  800f59:	c9                   	leave
+  800f5a:	c3                   	ret
+
+0000000000800f5b <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800f5b:	55                   	push   %rbp
+  800f5c:	48 89 e5             	mov    %rsp,%rbp
+  800f5f:	41 54                	push   %r12
+  800f61:	53                   	push   %rbx
+  800f62:	48 83 ec 60          	sub    $0x60,%rsp
+  800f66:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800f6a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800f6e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800f72:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800f76:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f7a:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800f7e:	48 8b 06             	mov    (%rsi),%rax
+  800f81:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800f85:	48 89 01             	mov    %rax,(%rcx)
+  800f88:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800f8c:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800f90:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800f94:	eb 17                	jmp    800fad <vprintfmt+0x52>
+      if (ch == '\0')
+  800f96:	85 db                	test   %ebx,%ebx
+  800f98:	0f 84 bf 04 00 00    	je     80145d <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800f9e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800fa2:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800fa6:	48 89 c6             	mov    %rax,%rsi
+  800fa9:	89 df                	mov    %ebx,%edi
+  800fab:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800fad:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fb1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800fb5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800fb9:	0f b6 00             	movzbl (%rax),%eax
+  800fbc:	0f b6 d8             	movzbl %al,%ebx
+  800fbf:	83 fb 25             	cmp    $0x25,%ebx
+  800fc2:	75 d2                	jne    800f96 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800fc4:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800fc8:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800fcf:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800fd6:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800fdd:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800fe4:	eb 04                	jmp    800fea <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800fe6:	90                   	nop
+  800fe7:	eb 01                	jmp    800fea <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800fe9:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800fea:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800fee:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800ff2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800ff6:	0f b6 00             	movzbl (%rax),%eax
+  800ff9:	0f b6 d8             	movzbl %al,%ebx
+  800ffc:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800fff:	83 f8 55             	cmp    $0x55,%eax
+  801002:	0f 87 22 04 00 00    	ja     80142a <vprintfmt+0x4cf>
+  801008:	89 c0                	mov    %eax,%eax
+  80100a:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  801011:	00 
+  801012:	48 b8 b8 79 80 00 00 	movabs $0x8079b8,%rax
+  801019:	00 00 00 
+  80101c:	48 01 d0             	add    %rdx,%rax
+  80101f:	48 8b 00             	mov    (%rax),%rax
+  801022:	ff e0                	jmp    *%rax
+        padc = '-';
+  801024:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  801028:	eb c0                	jmp    800fea <vprintfmt+0x8f>
+        padc = '0';
+  80102a:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80102e:	eb ba                	jmp    800fea <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  801030:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  801037:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80103a:	89 d0                	mov    %edx,%eax
+  80103c:	c1 e0 02             	shl    $0x2,%eax
+  80103f:	01 d0                	add    %edx,%eax
+  801041:	01 c0                	add    %eax,%eax
+  801043:	01 d8                	add    %ebx,%eax
+  801045:	83 e8 30             	sub    $0x30,%eax
+  801048:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80104b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80104f:	0f b6 00             	movzbl (%rax),%eax
+  801052:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  801055:	83 fb 2f             	cmp    $0x2f,%ebx
+  801058:	7e 60                	jle    8010ba <vprintfmt+0x15f>
+  80105a:	83 fb 39             	cmp    $0x39,%ebx
+  80105d:	7f 5b                	jg     8010ba <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  80105f:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  801064:	eb d1                	jmp    801037 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  801066:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801069:	83 f8 2f             	cmp    $0x2f,%eax
+  80106c:	77 17                	ja     801085 <vprintfmt+0x12a>
+  80106e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801072:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801075:	89 d2                	mov    %edx,%edx
+  801077:	48 01 d0             	add    %rdx,%rax
+  80107a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80107d:	83 c2 08             	add    $0x8,%edx
+  801080:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801083:	eb 0c                	jmp    801091 <vprintfmt+0x136>
+  801085:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801089:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80108d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801091:	8b 00                	mov    (%rax),%eax
+  801093:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  801096:	eb 23                	jmp    8010bb <vprintfmt+0x160>
+        if (width < 0)
+  801098:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80109c:	0f 89 44 ff ff ff    	jns    800fe6 <vprintfmt+0x8b>
+          width = 0;
+  8010a2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8010a9:	e9 38 ff ff ff       	jmp    800fe6 <vprintfmt+0x8b>
+        altflag = 1;
+  8010ae:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8010b5:	e9 30 ff ff ff       	jmp    800fea <vprintfmt+0x8f>
+        goto process_precision;
+  8010ba:	90                   	nop
+        if (width < 0)
+  8010bb:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8010bf:	0f 89 24 ff ff ff    	jns    800fe9 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8010c5:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8010c8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8010cb:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8010d2:	e9 12 ff ff ff       	jmp    800fe9 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8010d7:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8010db:	e9 0a ff ff ff       	jmp    800fea <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8010e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8010e6:	77 17                	ja     8010ff <vprintfmt+0x1a4>
+  8010e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010ec:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8010ef:	89 d2                	mov    %edx,%edx
+  8010f1:	48 01 d0             	add    %rdx,%rax
+  8010f4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8010f7:	83 c2 08             	add    $0x8,%edx
+  8010fa:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8010fd:	eb 0c                	jmp    80110b <vprintfmt+0x1b0>
+  8010ff:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801103:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801107:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80110b:	8b 00                	mov    (%rax),%eax
+  80110d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801111:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801115:	48 89 d6             	mov    %rdx,%rsi
+  801118:	89 c7                	mov    %eax,%edi
+  80111a:	ff d1                	call   *%rcx
+        break;
+  80111c:	e9 37 03 00 00       	jmp    801458 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  801121:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801124:	83 f8 2f             	cmp    $0x2f,%eax
+  801127:	77 17                	ja     801140 <vprintfmt+0x1e5>
+  801129:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80112d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801130:	89 d2                	mov    %edx,%edx
+  801132:	48 01 d0             	add    %rdx,%rax
+  801135:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801138:	83 c2 08             	add    $0x8,%edx
+  80113b:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80113e:	eb 0c                	jmp    80114c <vprintfmt+0x1f1>
+  801140:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801144:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801148:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80114c:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80114e:	85 db                	test   %ebx,%ebx
+  801150:	79 02                	jns    801154 <vprintfmt+0x1f9>
+          err = -err;
+  801152:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  801154:	83 fb 15             	cmp    $0x15,%ebx
+  801157:	7f 16                	jg     80116f <vprintfmt+0x214>
+  801159:	48 ba e0 78 80 00 00 	movabs $0x8078e0,%rdx
+  801160:	00 00 00 
+  801163:	48 63 c3             	movslq %ebx,%rax
+  801166:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  80116a:	4d 85 e4             	test   %r12,%r12
+  80116d:	75 2e                	jne    80119d <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  80116f:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801173:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801177:	89 d9                	mov    %ebx,%ecx
+  801179:	48 ba a1 79 80 00 00 	movabs $0x8079a1,%rdx
+  801180:	00 00 00 
+  801183:	48 89 c7             	mov    %rax,%rdi
+  801186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118b:	49 b8 67 14 80 00 00 	movabs $0x801467,%r8
+  801192:	00 00 00 
+  801195:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  801198:	e9 bb 02 00 00       	jmp    801458 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  80119d:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8011a1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011a5:	4c 89 e1             	mov    %r12,%rcx
+  8011a8:	48 ba aa 79 80 00 00 	movabs $0x8079aa,%rdx
+  8011af:	00 00 00 
+  8011b2:	48 89 c7             	mov    %rax,%rdi
+  8011b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ba:	49 b8 67 14 80 00 00 	movabs $0x801467,%r8
+  8011c1:	00 00 00 
+  8011c4:	41 ff d0             	call   *%r8
+        break;
+  8011c7:	e9 8c 02 00 00       	jmp    801458 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8011cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8011d2:	77 17                	ja     8011eb <vprintfmt+0x290>
+  8011d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011d8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8011db:	89 d2                	mov    %edx,%edx
+  8011dd:	48 01 d0             	add    %rdx,%rax
+  8011e0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8011e3:	83 c2 08             	add    $0x8,%edx
+  8011e6:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8011e9:	eb 0c                	jmp    8011f7 <vprintfmt+0x29c>
+  8011eb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011ef:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8011f3:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8011f7:	4c 8b 20             	mov    (%rax),%r12
+  8011fa:	4d 85 e4             	test   %r12,%r12
+  8011fd:	75 0a                	jne    801209 <vprintfmt+0x2ae>
+          p = "(null)";
+  8011ff:	49 bc ad 79 80 00 00 	movabs $0x8079ad,%r12
+  801206:	00 00 00 
+        if (width > 0 && padc != '-')
+  801209:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80120d:	7e 78                	jle    801287 <vprintfmt+0x32c>
+  80120f:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  801213:	74 72                	je     801287 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  801215:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801218:	48 98                	cltq
+  80121a:	48 89 c6             	mov    %rax,%rsi
+  80121d:	4c 89 e7             	mov    %r12,%rdi
+  801220:	48 b8 73 1b 80 00 00 	movabs $0x801b73,%rax
+  801227:	00 00 00 
+  80122a:	ff d0                	call   *%rax
+  80122c:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  80122f:	eb 17                	jmp    801248 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  801231:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  801235:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801239:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80123d:	48 89 d6             	mov    %rdx,%rsi
+  801240:	89 c7                	mov    %eax,%edi
+  801242:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  801244:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801248:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80124c:	7f e3                	jg     801231 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80124e:	eb 37                	jmp    801287 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  801250:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801254:	74 1e                	je     801274 <vprintfmt+0x319>
+  801256:	83 fb 1f             	cmp    $0x1f,%ebx
+  801259:	7e 05                	jle    801260 <vprintfmt+0x305>
+  80125b:	83 fb 7e             	cmp    $0x7e,%ebx
+  80125e:	7e 14                	jle    801274 <vprintfmt+0x319>
+            putch('?', putdat);
+  801260:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801264:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801268:	48 89 c6             	mov    %rax,%rsi
+  80126b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801270:	ff d2                	call   *%rdx
+  801272:	eb 0f                	jmp    801283 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  801274:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801278:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80127c:	48 89 c6             	mov    %rax,%rsi
+  80127f:	89 df                	mov    %ebx,%edi
+  801281:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801283:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801287:	4c 89 e0             	mov    %r12,%rax
+  80128a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80128e:	0f b6 00             	movzbl (%rax),%eax
+  801291:	0f be d8             	movsbl %al,%ebx
+  801294:	85 db                	test   %ebx,%ebx
+  801296:	74 28                	je     8012c0 <vprintfmt+0x365>
+  801298:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80129c:	78 b2                	js     801250 <vprintfmt+0x2f5>
+  80129e:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8012a2:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8012a6:	79 a8                	jns    801250 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8012a8:	eb 16                	jmp    8012c0 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8012aa:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8012ae:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8012b2:	48 89 c6             	mov    %rax,%rsi
+  8012b5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8012ba:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8012bc:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8012c0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8012c4:	7f e4                	jg     8012aa <vprintfmt+0x34f>
+        break;
+  8012c6:	e9 8d 01 00 00       	jmp    801458 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8012cb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8012ce:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8012d2:	89 d6                	mov    %edx,%esi
+  8012d4:	48 89 c7             	mov    %rax,%rdi
+  8012d7:	48 b8 64 0e 80 00 00 	movabs $0x800e64,%rax
+  8012de:	00 00 00 
+  8012e1:	ff d0                	call   *%rax
+  8012e3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8012e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012eb:	48 85 c0             	test   %rax,%rax
+  8012ee:	79 1d                	jns    80130d <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8012f0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8012f4:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8012f8:	48 89 c6             	mov    %rax,%rsi
+  8012fb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801300:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  801302:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801306:	48 f7 d8             	neg    %rax
+  801309:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  80130d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  801314:	e9 d2 00 00 00       	jmp    8013eb <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  801319:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80131c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801320:	89 d6                	mov    %edx,%esi
+  801322:	48 89 c7             	mov    %rax,%rdi
+  801325:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  80132c:	00 00 00 
+  80132f:	ff d0                	call   *%rax
+  801331:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  801335:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  80133c:	e9 aa 00 00 00       	jmp    8013eb <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  801341:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801344:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801348:	89 d6                	mov    %edx,%esi
+  80134a:	48 89 c7             	mov    %rax,%rdi
+  80134d:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  801354:	00 00 00 
+  801357:	ff d0                	call   *%rax
+  801359:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  80135d:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  801364:	e9 82 00 00 00       	jmp    8013eb <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  801369:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80136d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801371:	48 89 c6             	mov    %rax,%rsi
+  801374:	bf 30 00 00 00       	mov    $0x30,%edi
+  801379:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  80137b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80137f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801383:	48 89 c6             	mov    %rax,%rsi
+  801386:	bf 78 00 00 00       	mov    $0x78,%edi
+  80138b:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  80138d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801390:	83 f8 2f             	cmp    $0x2f,%eax
+  801393:	77 17                	ja     8013ac <vprintfmt+0x451>
+  801395:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801399:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80139c:	89 d2                	mov    %edx,%edx
+  80139e:	48 01 d0             	add    %rdx,%rax
+  8013a1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8013a4:	83 c2 08             	add    $0x8,%edx
+  8013a7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8013aa:	eb 0c                	jmp    8013b8 <vprintfmt+0x45d>
+  8013ac:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8013b0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8013b4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8013b8:	48 8b 00             	mov    (%rax),%rax
+  8013bb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8013bf:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  8013c6:	eb 23                	jmp    8013eb <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  8013c8:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8013cb:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8013cf:	89 d6                	mov    %edx,%esi
+  8013d1:	48 89 c7             	mov    %rax,%rdi
+  8013d4:	48 b8 6d 0d 80 00 00 	movabs $0x800d6d,%rax
+  8013db:	00 00 00 
+  8013de:	ff d0                	call   *%rax
+  8013e0:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8013e4:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  8013eb:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  8013f0:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8013f3:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8013f6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8013fa:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8013fe:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801402:	45 89 c1             	mov    %r8d,%r9d
+  801405:	41 89 f8             	mov    %edi,%r8d
+  801408:	48 89 c7             	mov    %rax,%rdi
+  80140b:	48 b8 b5 0c 80 00 00 	movabs $0x800cb5,%rax
+  801412:	00 00 00 
+  801415:	ff d0                	call   *%rax
+        break;
+  801417:	eb 3f                	jmp    801458 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801419:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80141d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801421:	48 89 c6             	mov    %rax,%rsi
+  801424:	89 df                	mov    %ebx,%edi
+  801426:	ff d2                	call   *%rdx
+        break;
+  801428:	eb 2e                	jmp    801458 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  80142a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80142e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801432:	48 89 c6             	mov    %rax,%rsi
+  801435:	bf 25 00 00 00       	mov    $0x25,%edi
+  80143a:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  80143c:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801441:	eb 05                	jmp    801448 <vprintfmt+0x4ed>
+  801443:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801448:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80144c:	48 83 e8 01          	sub    $0x1,%rax
+  801450:	0f b6 00             	movzbl (%rax),%eax
+  801453:	3c 25                	cmp    $0x25,%al
+  801455:	75 ec                	jne    801443 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  801457:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  801458:	e9 50 fb ff ff       	jmp    800fad <vprintfmt+0x52>
+        return;
+  80145d:	90                   	nop
+    }
+  }
+}
+  80145e:	48 83 c4 60          	add    $0x60,%rsp
+  801462:	5b                   	pop    %rbx
+  801463:	41 5c                	pop    %r12
+  801465:	5d                   	pop    %rbp
+  801466:	c3                   	ret
+
+0000000000801467 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801467:	55                   	push   %rbp
+  801468:	48 89 e5             	mov    %rsp,%rbp
+  80146b:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801472:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801479:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  801480:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801487:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80148e:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801495:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80149c:	84 c0                	test   %al,%al
+  80149e:	74 20                	je     8014c0 <printfmt+0x59>
+  8014a0:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8014a4:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8014a8:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8014ac:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8014b0:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8014b4:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8014b8:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8014bc:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8014c0:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  8014c7:	00 00 00 
+  8014ca:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  8014d1:	00 00 00 
+  8014d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8014d8:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8014df:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8014e6:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  8014ed:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8014f4:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8014fb:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  801502:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801509:	48 89 c7             	mov    %rax,%rdi
+  80150c:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  801513:	00 00 00 
+  801516:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801518:	90                   	nop
+  801519:	c9                   	leave
+  80151a:	c3                   	ret
+
+000000000080151b <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  80151b:	55                   	push   %rbp
+  80151c:	48 89 e5             	mov    %rsp,%rbp
+  80151f:	48 83 ec 10          	sub    $0x10,%rsp
+  801523:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  801526:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  80152a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80152e:	8b 40 10             	mov    0x10(%rax),%eax
+  801531:	8d 50 01             	lea    0x1(%rax),%edx
+  801534:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801538:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  80153b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80153f:	48 8b 10             	mov    (%rax),%rdx
+  801542:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801546:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80154a:	48 39 c2             	cmp    %rax,%rdx
+  80154d:	73 17                	jae    801566 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  80154f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801553:	48 8b 00             	mov    (%rax),%rax
+  801556:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80155a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80155e:	48 89 0a             	mov    %rcx,(%rdx)
+  801561:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801564:	88 10                	mov    %dl,(%rax)
+}
+  801566:	90                   	nop
+  801567:	c9                   	leave
+  801568:	c3                   	ret
+
+0000000000801569 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801569:	55                   	push   %rbp
+  80156a:	48 89 e5             	mov    %rsp,%rbp
+  80156d:	48 83 ec 40          	sub    $0x40,%rsp
+  801571:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801575:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801578:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80157c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801580:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801584:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801588:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80158b:	48 98                	cltq
+  80158d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801591:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801595:	48 01 d0             	add    %rdx,%rax
+  801598:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  80159c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  8015a3:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8015a8:	74 06                	je     8015b0 <vsnprintf+0x47>
+  8015aa:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  8015ae:	7f 07                	jg     8015b7 <vsnprintf+0x4e>
+    return -E_INVAL;
+  8015b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b5:	eb 32                	jmp    8015e9 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  8015b7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8015bb:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8015bf:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  8015c3:	48 89 c6             	mov    %rax,%rsi
+  8015c6:	48 b8 1b 15 80 00 00 	movabs $0x80151b,%rax
+  8015cd:	00 00 00 
+  8015d0:	48 89 c7             	mov    %rax,%rdi
+  8015d3:	48 b8 5b 0f 80 00 00 	movabs $0x800f5b,%rax
+  8015da:	00 00 00 
+  8015dd:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8015df:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8015e3:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  8015e6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8015e9:	c9                   	leave
+  8015ea:	c3                   	ret
+
+00000000008015eb <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  8015eb:	55                   	push   %rbp
+  8015ec:	48 89 e5             	mov    %rsp,%rbp
+  8015ef:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8015f6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8015fd:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801603:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  80160a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801611:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801618:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80161f:	84 c0                	test   %al,%al
+  801621:	74 20                	je     801643 <snprintf+0x58>
+  801623:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801627:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80162b:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80162f:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801633:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801637:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80163b:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80163f:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801643:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  80164a:	00 00 00 
+  80164d:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801654:	00 00 00 
+  801657:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80165b:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801662:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801669:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801670:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801677:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80167e:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801684:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80168b:	48 89 c7             	mov    %rax,%rdi
+  80168e:	48 b8 69 15 80 00 00 	movabs $0x801569,%rax
+  801695:	00 00 00 
+  801698:	ff d0                	call   *%rax
+  80169a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  8016a0:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8016a6:	c9                   	leave
+  8016a7:	c3                   	ret
+
+00000000008016a8 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  8016a8:	55                   	push   %rbp
+  8016a9:	48 89 e5             	mov    %rsp,%rbp
+  8016ac:	53                   	push   %rbx
+  8016ad:	48 83 ec 38          	sub    $0x38,%rsp
+  8016b1:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  8016b4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8016b8:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  8016bc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8016c0:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  8016c4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8016c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016cc:	89 d1                	mov    %edx,%ecx
+  8016ce:	0f a2                	cpuid
+  8016d0:	89 de                	mov    %ebx,%esi
+  8016d2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8016d5:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8016d8:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8016db:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8016de:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8016e3:	74 09                	je     8016ee <cpuid+0x46>
+}
+  8016e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8016e9:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8016ec:	89 10                	mov    %edx,(%rax)
+
+  8016ee:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8016f3:	74 09                	je     8016fe <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8016f5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8016f9:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8016fc:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8016fe:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801703:	74 09                	je     80170e <cpuid+0x66>
+char *
+  801705:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801709:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  80170c:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  80170e:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801713:	74 09                	je     80171e <cpuid+0x76>
+  for (; *s; s++)
+  801715:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801719:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80171c:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  80171e:	90                   	nop
+  80171f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801723:	c9                   	leave
+  801724:	c3                   	ret
+
+0000000000801725 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801725:	55                   	push   %rbp
+  801726:	48 89 e5             	mov    %rsp,%rbp
+  801729:	48 83 ec 18          	sub    $0x18,%rsp
+  80172d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801730:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801733:	89 c1                	mov    %eax,%ecx
+  801735:	0f 01 d0             	xgetbv
+  801738:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80173b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  80173e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801741:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801744:	48 c1 e2 20          	shl    $0x20,%rdx
+  801748:	48 09 d0             	or     %rdx,%rax
+#else
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+
+000000000080174d <string_cpu>:
+string_cpu(void) {
+  80174d:	55                   	push   %rbp
+  80174e:	48 89 e5             	mov    %rsp,%rbp
+  801751:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801755:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  80175c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801763:	48 b8 48 90 80 00 00 	movabs $0x809048,%rax
+  80176a:	00 00 00 
+  80176d:	8b 00                	mov    (%rax),%eax
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	78 11                	js     801784 <string_cpu+0x37>
+    return string_features;
+  801773:	48 b8 48 90 80 00 00 	movabs $0x809048,%rax
+  80177a:	00 00 00 
+  80177d:	8b 00                	mov    (%rax),%eax
+  80177f:	e9 df 00 00 00       	jmp    801863 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801784:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801788:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80178e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801793:	ba 00 00 00 00       	mov    $0x0,%edx
+  801798:	48 89 c6             	mov    %rax,%rsi
+  80179b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017a0:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  8017a7:	00 00 00 
+  8017aa:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  8017ac:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8017af:	83 f8 06             	cmp    $0x6,%eax
+  8017b2:	76 28                	jbe    8017dc <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  8017b4:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  8017b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8017c3:	48 89 c2             	mov    %rax,%rdx
+  8017c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8017cb:	bf 07 00 00 00       	mov    $0x7,%edi
+  8017d0:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  8017d7:	00 00 00 
+  8017da:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8017dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8017df:	25 00 02 00 00       	and    $0x200,%eax
+  8017e4:	85 c0                	test   %eax,%eax
+  8017e6:	74 04                	je     8017ec <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8017e8:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8017ec:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8017f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017f6:	48 89 c1             	mov    %rax,%rcx
+  8017f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801803:	bf 01 00 00 00       	mov    $0x1,%edi
+  801808:	48 b8 a8 16 80 00 00 	movabs $0x8016a8,%rax
+  80180f:	00 00 00 
+  801812:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801814:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801817:	83 e0 20             	and    $0x20,%eax
+  80181a:	85 c0                	test   %eax,%eax
+  80181c:	74 2a                	je     801848 <string_cpu+0xfb>
+  80181e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801821:	25 00 00 00 08       	and    $0x8000000,%eax
+  801826:	85 c0                	test   %eax,%eax
+  801828:	74 1e                	je     801848 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  80182a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80182f:	48 b8 25 17 80 00 00 	movabs $0x801725,%rax
+  801836:	00 00 00 
+  801839:	ff d0                	call   *%rax
+  80183b:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80183e:	48 83 f8 06          	cmp    $0x6,%rax
+  801842:	75 04                	jne    801848 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801844:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801848:	48 ba 48 90 80 00 00 	movabs $0x809048,%rdx
+  80184f:	00 00 00 
+  801852:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801855:	89 02                	mov    %eax,(%rdx)
+  801857:	48 b8 48 90 80 00 00 	movabs $0x809048,%rax
+  80185e:	00 00 00 
+  801861:	8b 00                	mov    (%rax),%eax
+}
+  801863:	c9                   	leave
+  801864:	c3                   	ret
+
+0000000000801865 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801865:	55                   	push   %rbp
+  801866:	48 89 e5             	mov    %rsp,%rbp
+  801869:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80186d:	48 83 ec 60          	sub    $0x60,%rsp
+  801871:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801876:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80187b:	83 e0 1f             	and    $0x1f,%eax
+  80187e:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801882:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801886:	48 f7 d8             	neg    %rax
+  801889:	48 89 c2             	mov    %rax,%rdx
+  80188c:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801891:	48 01 d0             	add    %rdx,%rax
+  801894:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801899:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  80189d:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  8018a3:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8018a8:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8018ac:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8018b2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8018b6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8018ba:	89 c2                	mov    %eax,%edx
+  8018bc:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8018c0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8018c5:	89 c1                	mov    %eax,%ecx
+  8018c7:	d3 e6                	shl    %cl,%esi
+  8018c9:	89 f0                	mov    %esi,%eax
+  8018cb:	21 d0                	and    %edx,%eax
+  8018cd:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8018d1:	eb 21                	jmp    8018f4 <strlen_avx2+0x8f>
+    p += 32;
+  8018d3:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8018d9:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8018de:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8018e2:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8018e8:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8018ec:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8018f0:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8018f4:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8018f9:	74 d8                	je     8018d3 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8018fb:	31 c0                	xor    %eax,%eax
+  8018fd:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801903:	48 63 d0             	movslq %eax,%rdx
+  801906:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80190b:	48 01 d0             	add    %rdx,%rax
+  80190e:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801913:	c9                   	leave
+  801914:	c3                   	ret
+
+0000000000801915 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801915:	55                   	push   %rbp
+  801916:	48 89 e5             	mov    %rsp,%rbp
+  801919:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80191d:	48 83 ec 40          	sub    $0x40,%rsp
+  801921:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801926:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80192b:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801930:	eb 77                	jmp    8019a9 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801932:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801937:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80193b:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80193f:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801944:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801948:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80194c:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801950:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801954:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801959:	74 3c                	je     801997 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80195b:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  80195f:	f7 d0                	not    %eax
+  801961:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801965:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801969:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80196d:	48 63 d0             	movslq %eax,%rdx
+  801970:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801975:	48 01 d0             	add    %rdx,%rax
+  801978:	0f b6 00             	movzbl (%rax),%eax
+  80197b:	0f b6 c0             	movzbl %al,%eax
+  80197e:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801982:	48 63 ca             	movslq %edx,%rcx
+  801985:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80198a:	48 01 ca             	add    %rcx,%rdx
+  80198d:	0f b6 12             	movzbl (%rdx),%edx
+  801990:	0f b6 d2             	movzbl %dl,%edx
+  801993:	29 d0                	sub    %edx,%eax
+  801995:	eb 6b                	jmp    801a02 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801997:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80199d:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8019a3:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8019a9:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8019af:	77 81                	ja     801932 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8019b1:	eb 42                	jmp    8019f5 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8019b3:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8019b8:	0f b6 10             	movzbl (%rax),%edx
+  8019bb:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8019c0:	0f b6 00             	movzbl (%rax),%eax
+  8019c3:	38 c2                	cmp    %al,%dl
+  8019c5:	74 1c                	je     8019e3 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8019c7:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8019cc:	0f b6 00             	movzbl (%rax),%eax
+  8019cf:	0f b6 c8             	movzbl %al,%ecx
+  8019d2:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8019d7:	0f b6 00             	movzbl (%rax),%eax
+  8019da:	0f b6 d0             	movzbl %al,%edx
+  8019dd:	89 c8                	mov    %ecx,%eax
+  8019df:	29 d0                	sub    %edx,%eax
+  8019e1:	eb 1f                	jmp    801a02 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8019e3:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8019e9:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8019ef:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8019f5:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8019fb:	75 b6                	jne    8019b3 <memcmp_avx2+0x9e>
+  return 0;
+  8019fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a02:	c9                   	leave
+  801a03:	c3                   	ret
+
+0000000000801a04 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801a04:	55                   	push   %rbp
+  801a05:	48 89 e5             	mov    %rsp,%rbp
+  801a08:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801a0c:	48 83 ec 60          	sub    $0x60,%rsp
+  801a10:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801a15:	89 f0                	mov    %esi,%eax
+  801a17:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801a1c:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801a20:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801a25:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801a29:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801a2e:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801a34:	eb 47                	jmp    801a7d <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801a36:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801a3b:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801a3f:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801a43:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801a49:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801a4d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801a51:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801a55:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801a5a:	74 15                	je     801a71 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801a5c:	31 c0                	xor    %eax,%eax
+  801a5e:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801a64:	48 63 d0             	movslq %eax,%rdx
+  801a67:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801a6c:	48 01 d0             	add    %rdx,%rax
+  801a6f:	eb 3d                	jmp    801aae <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801a71:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801a77:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801a7d:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801a83:	77 b1                	ja     801a36 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801a85:	eb 0c                	jmp    801a93 <memfind_avx2+0x8f>
+  801a87:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801a8d:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801a93:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801a99:	74 0e                	je     801aa9 <memfind_avx2+0xa5>
+  801a9b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801aa0:	0f b6 00             	movzbl (%rax),%eax
+  801aa3:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801aa7:	75 de                	jne    801a87 <memfind_avx2+0x83>
+  return s;
+  801aa9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801aae:	c9                   	leave
+  801aaf:	c3                   	ret
+
+0000000000801ab0 <strlen>:
+strlen(const char *s) {
+  801ab0:	55                   	push   %rbp
+  801ab1:	48 89 e5             	mov    %rsp,%rbp
+  801ab4:	48 83 ec 40          	sub    $0x40,%rsp
+  801ab8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801abc:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801ac0:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801ac4:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  801acb:	00 00 00 
+  801ace:	ff d0                	call   *%rax
+  801ad0:	83 e0 02             	and    $0x2,%eax
+  801ad3:	85 c0                	test   %eax,%eax
+  801ad5:	74 18                	je     801aef <strlen+0x3f>
+    return strlen_avx2(s);
+  801ad7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801adb:	48 89 c7             	mov    %rax,%rdi
+  801ade:	48 b8 65 18 80 00 00 	movabs $0x801865,%rax
+  801ae5:	00 00 00 
+  801ae8:	ff d0                	call   *%rax
+  801aea:	e9 82 00 00 00       	jmp    801b71 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801aef:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801af3:	83 e0 0f             	and    $0xf,%eax
+  801af6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801af9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801afc:	48 f7 d8             	neg    %rax
+  801aff:	48 89 c2             	mov    %rax,%rdx
+  801b02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b06:	48 01 d0             	add    %rdx,%rax
+  801b09:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801b0d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b11:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b15:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801b1a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b1e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b22:	89 c2                	mov    %eax,%edx
+  801b24:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801b27:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801b2c:	89 c1                	mov    %eax,%ecx
+  801b2e:	d3 e6                	shl    %cl,%esi
+  801b30:	89 f0                	mov    %esi,%eax
+  801b32:	21 d0                	and    %edx,%eax
+  801b34:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b37:	eb 1d                	jmp    801b56 <strlen+0xa6>
+    p += 16;
+  801b39:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801b3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b42:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b46:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801b4b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801b4f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b53:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801b56:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801b5a:	74 dd                	je     801b39 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801b5c:	31 c0                	xor    %eax,%eax
+  801b5e:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801b63:	48 63 d0             	movslq %eax,%rdx
+  801b66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b6a:	48 01 d0             	add    %rdx,%rax
+  801b6d:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801b71:	c9                   	leave
+  801b72:	c3                   	ret
+
+0000000000801b73 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801b73:	55                   	push   %rbp
+  801b74:	48 89 e5             	mov    %rsp,%rbp
+  801b77:	48 83 ec 20          	sub    $0x20,%rsp
+  801b7b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801b7f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801b83:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801b8a:	eb 0e                	jmp    801b9a <strnlen+0x27>
+    n++;
+  801b8c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801b90:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801b95:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801b9a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801b9f:	74 0b                	je     801bac <strnlen+0x39>
+  801ba1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801ba5:	0f b6 00             	movzbl (%rax),%eax
+  801ba8:	84 c0                	test   %al,%al
+  801baa:	75 e0                	jne    801b8c <strnlen+0x19>
+  return n;
+  801bac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801baf:	c9                   	leave
+  801bb0:	c3                   	ret
+
+0000000000801bb1 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801bb1:	55                   	push   %rbp
+  801bb2:	48 89 e5             	mov    %rsp,%rbp
+  801bb5:	48 83 ec 20          	sub    $0x20,%rsp
+  801bb9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801bbd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801bc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bc5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801bc9:	90                   	nop
+  801bca:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801bce:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801bd2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801bd6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801bda:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801bde:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801be2:	0f b6 12             	movzbl (%rdx),%edx
+  801be5:	88 10                	mov    %dl,(%rax)
+  801be7:	0f b6 00             	movzbl (%rax),%eax
+  801bea:	84 c0                	test   %al,%al
+  801bec:	75 dc                	jne    801bca <strcpy+0x19>
+  return ret;
+  801bee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801bf2:	c9                   	leave
+  801bf3:	c3                   	ret
+
+0000000000801bf4 <strcat>:
+strcat(char *dst, const char *src) {
+  801bf4:	55                   	push   %rbp
+  801bf5:	48 89 e5             	mov    %rsp,%rbp
+  801bf8:	48 83 ec 20          	sub    $0x20,%rsp
+  801bfc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c00:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801c04:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c08:	48 89 c7             	mov    %rax,%rdi
+  801c0b:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+  801c17:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801c1a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c1d:	48 63 d0             	movslq %eax,%rdx
+  801c20:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c24:	48 01 c2             	add    %rax,%rdx
+  801c27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c2b:	48 89 c6             	mov    %rax,%rsi
+  801c2e:	48 89 d7             	mov    %rdx,%rdi
+  801c31:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  801c38:	00 00 00 
+  801c3b:	ff d0                	call   *%rax
+  return dst;
+  801c3d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801c41:	c9                   	leave
+  801c42:	c3                   	ret
+
+0000000000801c43 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	48 83 ec 28          	sub    $0x28,%rsp
+  801c4b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801c4f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801c53:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801c57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c5b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801c5f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801c66:	00 
+  801c67:	eb 2a                	jmp    801c93 <strncpy+0x50>
+    *dst++ = *src;
+  801c69:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c6d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801c71:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801c75:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801c79:	0f b6 12             	movzbl (%rdx),%edx
+  801c7c:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801c7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c82:	0f b6 00             	movzbl (%rax),%eax
+  801c85:	84 c0                	test   %al,%al
+  801c87:	74 05                	je     801c8e <strncpy+0x4b>
+      src++;
+  801c89:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801c8e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c97:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801c9b:	72 cc                	jb     801c69 <strncpy+0x26>
+  return ret;
+  801c9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801ca1:	c9                   	leave
+  801ca2:	c3                   	ret
+
+0000000000801ca3 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+  801ca7:	48 83 ec 28          	sub    $0x28,%rsp
+  801cab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801caf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801cb3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801cb7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cbb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801cbf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801cc4:	74 3d                	je     801d03 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801cc6:	eb 1d                	jmp    801ce5 <strlcpy+0x42>
+      *dst++ = *src++;
+  801cc8:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801ccc:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801cd0:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801cd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801cd8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801cdc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801ce0:	0f b6 12             	movzbl (%rdx),%edx
+  801ce3:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  801ce5:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801cea:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801cef:	74 0b                	je     801cfc <strlcpy+0x59>
+  801cf1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cf5:	0f b6 00             	movzbl (%rax),%eax
+  801cf8:	84 c0                	test   %al,%al
+  801cfa:	75 cc                	jne    801cc8 <strlcpy+0x25>
+    *dst = '\0';
+  801cfc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d00:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801d03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d07:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801d0b:	c9                   	leave
+  801d0c:	c3                   	ret
+
+0000000000801d0d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801d0d:	55                   	push   %rbp
+  801d0e:	48 89 e5             	mov    %rsp,%rbp
+  801d11:	48 83 ec 30          	sub    $0x30,%rsp
+  801d15:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801d19:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801d1d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801d21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d25:	48 89 c7             	mov    %rax,%rdi
+  801d28:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  801d2f:	00 00 00 
+  801d32:	ff d0                	call   *%rax
+  801d34:	48 98                	cltq
+  801d36:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801d3a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d3e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d42:	48 89 d6             	mov    %rdx,%rsi
+  801d45:	48 89 c7             	mov    %rax,%rdi
+  801d48:	48 b8 73 1b 80 00 00 	movabs $0x801b73,%rax
+  801d4f:	00 00 00 
+  801d52:	ff d0                	call   *%rax
+  801d54:	48 98                	cltq
+  801d56:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801d5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d5e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801d62:	75 10                	jne    801d74 <strlcat+0x67>
+    return maxlen + srclen;
+  801d64:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801d68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d6c:	48 01 d0             	add    %rdx,%rax
+  801d6f:	e9 86 00 00 00       	jmp    801dfa <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801d74:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d78:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801d7c:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801d80:	73 2b                	jae    801dad <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801d82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d86:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d8a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801d8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d92:	48 01 c1             	add    %rax,%rcx
+  801d95:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d99:	48 89 c6             	mov    %rax,%rsi
+  801d9c:	48 89 cf             	mov    %rcx,%rdi
+  801d9f:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+  801dab:	eb 42                	jmp    801def <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801dad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801db1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801db5:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801db9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dbd:	48 01 c1             	add    %rax,%rcx
+  801dc0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dc4:	48 89 c6             	mov    %rax,%rsi
+  801dc7:	48 89 cf             	mov    %rcx,%rdi
+  801dca:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  801dd1:	00 00 00 
+  801dd4:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801dd6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801dda:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dde:	48 01 d0             	add    %rdx,%rax
+  801de1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801de5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801de9:	48 01 d0             	add    %rdx,%rax
+  801dec:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801def:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801df3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801df7:	48 01 d0             	add    %rdx,%rax
+}
+  801dfa:	c9                   	leave
+  801dfb:	c3                   	ret
+
+0000000000801dfc <strcmp>:
+strcmp(const char *p, const char *q) {
+  801dfc:	55                   	push   %rbp
+  801dfd:	48 89 e5             	mov    %rsp,%rbp
+  801e00:	48 83 ec 10          	sub    $0x10,%rsp
+  801e04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e08:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801e0c:	eb 0a                	jmp    801e18 <strcmp+0x1c>
+    p++, q++;
+  801e0e:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e13:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801e18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e1c:	0f b6 00             	movzbl (%rax),%eax
+  801e1f:	84 c0                	test   %al,%al
+  801e21:	74 12                	je     801e35 <strcmp+0x39>
+  801e23:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e27:	0f b6 10             	movzbl (%rax),%edx
+  801e2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e2e:	0f b6 00             	movzbl (%rax),%eax
+  801e31:	38 c2                	cmp    %al,%dl
+  801e33:	74 d9                	je     801e0e <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801e35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e39:	0f b6 00             	movzbl (%rax),%eax
+  801e3c:	0f b6 d0             	movzbl %al,%edx
+  801e3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e43:	0f b6 00             	movzbl (%rax),%eax
+  801e46:	0f b6 c0             	movzbl %al,%eax
+  801e49:	29 c2                	sub    %eax,%edx
+  801e4b:	89 d0                	mov    %edx,%eax
+}
+  801e4d:	c9                   	leave
+  801e4e:	c3                   	ret
+
+0000000000801e4f <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801e4f:	55                   	push   %rbp
+  801e50:	48 89 e5             	mov    %rsp,%rbp
+  801e53:	48 83 ec 18          	sub    $0x18,%rsp
+  801e57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e5b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801e5f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801e63:	eb 0f                	jmp    801e74 <strncmp+0x25>
+    n--, p++, q++;
+  801e65:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801e6a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801e6f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801e74:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e79:	74 1d                	je     801e98 <strncmp+0x49>
+  801e7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e7f:	0f b6 00             	movzbl (%rax),%eax
+  801e82:	84 c0                	test   %al,%al
+  801e84:	74 12                	je     801e98 <strncmp+0x49>
+  801e86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e8a:	0f b6 10             	movzbl (%rax),%edx
+  801e8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e91:	0f b6 00             	movzbl (%rax),%eax
+  801e94:	38 c2                	cmp    %al,%dl
+  801e96:	74 cd                	je     801e65 <strncmp+0x16>
+  if (n == 0)
+  801e98:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e9d:	75 07                	jne    801ea6 <strncmp+0x57>
+    return 0;
+  801e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea4:	eb 16                	jmp    801ebc <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801ea6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801eaa:	0f b6 00             	movzbl (%rax),%eax
+  801ead:	0f b6 d0             	movzbl %al,%edx
+  801eb0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801eb4:	0f b6 00             	movzbl (%rax),%eax
+  801eb7:	0f b6 c0             	movzbl %al,%eax
+  801eba:	29 c2                	sub    %eax,%edx
+}
+  801ebc:	89 d0                	mov    %edx,%eax
+  801ebe:	c9                   	leave
+  801ebf:	c3                   	ret
+
+0000000000801ec0 <strchr>:
+strchr(const char *s, char c) {
+  801ec0:	55                   	push   %rbp
+  801ec1:	48 89 e5             	mov    %rsp,%rbp
+  801ec4:	48 83 ec 60          	sub    $0x60,%rsp
+  801ec8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801ecc:	89 f0                	mov    %esi,%eax
+  801ece:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801ed1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801ed5:	83 e0 0f             	and    $0xf,%eax
+  801ed8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801edb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ede:	48 f7 d8             	neg    %rax
+  801ee1:	48 89 c2             	mov    %rax,%rdx
+  801ee4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801ee8:	48 01 d0             	add    %rdx,%rax
+  801eeb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801eef:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801ef3:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801ef7:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801efb:	66 0f 6e c0          	movd   %eax,%xmm0
+  801eff:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801f03:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801f07:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801f0c:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801f10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f14:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801f18:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801f1c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801f21:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801f26:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f2a:	89 c2                	mov    %eax,%edx
+  801f2c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801f31:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801f36:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f3a:	09 c2                	or     %eax,%edx
+  801f3c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f3f:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801f44:	89 c1                	mov    %eax,%ecx
+  801f46:	d3 e6                	shl    %cl,%esi
+  801f48:	89 f0                	mov    %esi,%eax
+  801f4a:	21 d0                	and    %edx,%eax
+  801f4c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801f4f:	eb 34                	jmp    801f85 <strchr+0xc5>
+    p += 16;
+  801f51:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801f56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f5a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801f5e:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801f62:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801f67:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801f6c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f70:	89 c2                	mov    %eax,%edx
+  801f72:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801f77:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801f7c:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f80:	09 d0                	or     %edx,%eax
+  801f82:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801f85:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801f89:	74 c6                	je     801f51 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801f8b:	31 c0                	xor    %eax,%eax
+  801f8d:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801f92:	48 98                	cltq
+  801f94:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801f98:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f9c:	0f b6 00             	movzbl (%rax),%eax
+  801f9f:	84 c0                	test   %al,%al
+  801fa1:	74 06                	je     801fa9 <strchr+0xe9>
+  801fa3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fa7:	eb 05                	jmp    801fae <strchr+0xee>
+  801fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+
+0000000000801fb0 <strfind>:
+strfind(const char *s, char c) {
+  801fb0:	55                   	push   %rbp
+  801fb1:	48 89 e5             	mov    %rsp,%rbp
+  801fb4:	48 83 ec 10          	sub    $0x10,%rsp
+  801fb8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801fbc:	89 f0                	mov    %esi,%eax
+  801fbe:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801fc1:	eb 11                	jmp    801fd4 <strfind+0x24>
+    if (*s == c)
+  801fc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fc7:	0f b6 00             	movzbl (%rax),%eax
+  801fca:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801fcd:	74 12                	je     801fe1 <strfind+0x31>
+  for (; *s; s++)
+  801fcf:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801fd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fd8:	0f b6 00             	movzbl (%rax),%eax
+  801fdb:	84 c0                	test   %al,%al
+  801fdd:	75 e4                	jne    801fc3 <strfind+0x13>
+  801fdf:	eb 01                	jmp    801fe2 <strfind+0x32>
+      break;
+  801fe1:	90                   	nop
+  return (char *)s;
+  801fe2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801fe6:	c9                   	leave
+  801fe7:	c3                   	ret
+
+0000000000801fe8 <memset>:
+memset(void *v, int c, size_t n) {
+  801fe8:	55                   	push   %rbp
+  801fe9:	48 89 e5             	mov    %rsp,%rbp
+  801fec:	48 83 ec 38          	sub    $0x38,%rsp
+  801ff0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ff4:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801ff7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801ffb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801fff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  802003:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  802008:	76 41                	jbe    80204b <memset+0x63>
+  80200a:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  802011:	00 00 00 
+  802014:	ff d0                	call   *%rax
+  802016:	83 e0 01             	and    $0x1,%eax
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	74 2e                	je     80204b <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80201d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802020:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802024:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802028:	48 89 ce             	mov    %rcx,%rsi
+  80202b:	48 89 f7             	mov    %rsi,%rdi
+  80202e:	48 89 d1             	mov    %rdx,%rcx
+  802031:	fc                   	cld
+  802032:	f3 aa                	rep stos %al,%es:(%rdi)
+  802034:	48 89 ca             	mov    %rcx,%rdx
+  802037:	48 89 fe             	mov    %rdi,%rsi
+  80203a:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80203e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  802042:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802046:	e9 a7 00 00 00       	jmp    8020f2 <memset+0x10a>
+  if (n >= 8) {
+  80204b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  802050:	0f 86 87 00 00 00    	jbe    8020dd <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  802056:	eb 16                	jmp    80206e <memset+0x86>
+      *p++ = c;
+  802058:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80205c:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802060:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802064:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  802067:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  802069:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80206e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802072:	83 e0 07             	and    $0x7,%eax
+  802075:	48 85 c0             	test   %rax,%rax
+  802078:	75 de                	jne    802058 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80207a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80207d:	0f b6 c0             	movzbl %al,%eax
+  802080:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  802087:	01 01 01 
+  80208a:	48 0f af c2          	imul   %rdx,%rax
+  80208e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  802092:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802096:	48 c1 e8 03          	shr    $0x3,%rax
+  80209a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  80209e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8020a2:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8020a6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8020aa:	48 89 ce             	mov    %rcx,%rsi
+  8020ad:	48 89 f7             	mov    %rsi,%rdi
+  8020b0:	48 89 d1             	mov    %rdx,%rcx
+  8020b3:	fc                   	cld
+  8020b4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8020b7:	48 89 ca             	mov    %rcx,%rdx
+  8020ba:	48 89 fe             	mov    %rdi,%rsi
+  8020bd:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8020c1:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8020c5:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8020ca:	eb 11                	jmp    8020dd <memset+0xf5>
+    *p++ = c;
+  8020cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8020d0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8020d4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8020d8:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8020db:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8020dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020e1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8020e5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8020e9:	48 85 c0             	test   %rax,%rax
+  8020ec:	75 de                	jne    8020cc <memset+0xe4>
+  return v;
+  8020ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8020f2:	c9                   	leave
+  8020f3:	c3                   	ret
+
+00000000008020f4 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8020f4:	55                   	push   %rbp
+  8020f5:	48 89 e5             	mov    %rsp,%rbp
+  8020f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8020fc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802100:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802104:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  802108:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80210c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  802110:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802114:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  802118:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80211c:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  802120:	0f 83 da 00 00 00    	jae    802200 <memmove+0x10c>
+  802126:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80212a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80212e:	48 01 d0             	add    %rdx,%rax
+  802131:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  802135:	0f 83 c5 00 00 00    	jae    802200 <memmove+0x10c>
+    s += n;
+  80213b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80213f:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  802143:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802147:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80214b:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  802150:	0f 86 94 00 00 00    	jbe    8021ea <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  802156:	eb 1c                	jmp    802174 <memmove+0x80>
+        *--d = *--s;
+  802158:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80215d:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  802162:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802166:	0f b6 10             	movzbl (%rax),%edx
+  802169:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80216d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  80216f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  802174:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802178:	83 e0 07             	and    $0x7,%eax
+  80217b:	48 85 c0             	test   %rax,%rax
+  80217e:	75 d8                	jne    802158 <memmove+0x64>
+      nq = n / 8;
+  802180:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802184:	48 c1 e8 03          	shr    $0x3,%rax
+  802188:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80218c:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  802191:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  802196:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  80219b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80219f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a7:	48 89 cf             	mov    %rcx,%rdi
+  8021aa:	48 89 d6             	mov    %rdx,%rsi
+  8021ad:	48 89 c1             	mov    %rax,%rcx
+  8021b0:	fd                   	std
+  8021b1:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8021b4:	fc                   	cld
+  8021b5:	48 89 c8             	mov    %rcx,%rax
+  8021b8:	48 89 f2             	mov    %rsi,%rdx
+  8021bb:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8021bf:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8021c3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8021c7:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8021cc:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8021d1:	eb 17                	jmp    8021ea <memmove+0xf6>
+      *--d = *--s;
+  8021d3:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8021d8:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8021dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021e1:	0f b6 10             	movzbl (%rax),%edx
+  8021e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8021e8:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8021ea:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021ee:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8021f2:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8021f6:	48 85 c0             	test   %rax,%rax
+  8021f9:	75 d8                	jne    8021d3 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8021fb:	e9 f4 00 00 00       	jmp    8022f4 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  802200:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  802205:	76 46                	jbe    80224d <memmove+0x159>
+  802207:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  80220e:	00 00 00 
+  802211:	ff d0                	call   *%rax
+  802213:	83 e0 01             	and    $0x1,%eax
+  802216:	85 c0                	test   %eax,%eax
+  802218:	74 33                	je     80224d <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80221a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80221e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802222:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802226:	48 89 cf             	mov    %rcx,%rdi
+  802229:	48 89 d6             	mov    %rdx,%rsi
+  80222c:	48 89 c1             	mov    %rax,%rcx
+  80222f:	fc                   	cld
+  802230:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  802232:	48 89 c8             	mov    %rcx,%rax
+  802235:	48 89 f2             	mov    %rsi,%rdx
+  802238:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80223c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802240:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  802244:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802248:	e9 ab 00 00 00       	jmp    8022f8 <memmove+0x204>
+    if (n >= 8) {
+  80224d:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  802252:	0f 86 8b 00 00 00    	jbe    8022e3 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  802258:	eb 22                	jmp    80227c <memmove+0x188>
+        *d++ = *s++;
+  80225a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80225e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802262:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802266:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80226a:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80226e:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  802272:	0f b6 12             	movzbl (%rdx),%edx
+  802275:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  802277:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80227c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802280:	83 e0 07             	and    $0x7,%eax
+  802283:	48 85 c0             	test   %rax,%rax
+  802286:	75 d2                	jne    80225a <memmove+0x166>
+      nq = n / 8;
+  802288:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80228c:	48 c1 e8 03          	shr    $0x3,%rax
+  802290:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  802294:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802298:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80229c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022a0:	48 89 cf             	mov    %rcx,%rdi
+  8022a3:	48 89 d6             	mov    %rdx,%rsi
+  8022a6:	48 89 c1             	mov    %rax,%rcx
+  8022a9:	fc                   	cld
+  8022aa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8022ad:	48 89 c8             	mov    %rcx,%rax
+  8022b0:	48 89 f2             	mov    %rsi,%rdx
+  8022b3:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8022b7:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8022bb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8022bf:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8022c4:	eb 1d                	jmp    8022e3 <memmove+0x1ef>
+      *d++ = *s++;
+  8022c6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8022ca:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8022ce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8022d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022d6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8022da:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8022de:	0f b6 12             	movzbl (%rdx),%edx
+  8022e1:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8022e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022e7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022eb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8022ef:	48 85 c0             	test   %rax,%rax
+  8022f2:	75 d2                	jne    8022c6 <memmove+0x1d2>
+  return dst;
+  8022f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8022f8:	c9                   	leave
+  8022f9:	c3                   	ret
+
+00000000008022fa <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8022fa:	55                   	push   %rbp
+  8022fb:	48 89 e5             	mov    %rsp,%rbp
+  8022fe:	48 83 ec 18          	sub    $0x18,%rsp
+  802302:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802306:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80230a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  80230e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802312:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802316:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80231a:	48 89 ce             	mov    %rcx,%rsi
+  80231d:	48 89 c7             	mov    %rax,%rdi
+  802320:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  802327:	00 00 00 
+  80232a:	ff d0                	call   *%rax
+}
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+
+000000000080232e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  80232e:	55                   	push   %rbp
+  80232f:	48 89 e5             	mov    %rsp,%rbp
+  802332:	48 83 ec 40          	sub    $0x40,%rsp
+  802336:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80233a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80233e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  802342:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802346:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  80234a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80234e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  802352:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  802357:	0f 86 a7 00 00 00    	jbe    802404 <memcmp+0xd6>
+  80235d:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  802364:	00 00 00 
+  802367:	ff d0                	call   *%rax
+  802369:	83 e0 02             	and    $0x2,%eax
+  80236c:	85 c0                	test   %eax,%eax
+  80236e:	0f 84 90 00 00 00    	je     802404 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  802374:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802378:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80237c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802380:	48 89 ce             	mov    %rcx,%rsi
+  802383:	48 89 c7             	mov    %rax,%rdi
+  802386:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  80238d:	00 00 00 
+  802390:	ff d0                	call   *%rax
+  802392:	e9 c2 00 00 00       	jmp    802459 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  802397:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80239b:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  80239f:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8023a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023a7:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8023ab:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8023af:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8023b3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  8023b6:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  8023bd:	74 36                	je     8023f5 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  8023bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023c2:	f7 d0                	not    %eax
+  8023c4:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8023c8:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  8023cb:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8023ce:	48 63 d0             	movslq %eax,%rdx
+  8023d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023d5:	48 01 d0             	add    %rdx,%rax
+  8023d8:	0f b6 00             	movzbl (%rax),%eax
+  8023db:	0f b6 c0             	movzbl %al,%eax
+  8023de:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8023e1:	48 63 ca             	movslq %edx,%rcx
+  8023e4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023e8:	48 01 ca             	add    %rcx,%rdx
+  8023eb:	0f b6 12             	movzbl (%rdx),%edx
+  8023ee:	0f b6 d2             	movzbl %dl,%edx
+  8023f1:	29 d0                	sub    %edx,%eax
+  8023f3:	eb 64                	jmp    802459 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  8023f5:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  8023fa:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  8023ff:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  802404:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  802409:	77 8c                	ja     802397 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  80240b:	eb 36                	jmp    802443 <memcmp+0x115>
+    if (*s1 != *s2)
+  80240d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802411:	0f b6 10             	movzbl (%rax),%edx
+  802414:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802418:	0f b6 00             	movzbl (%rax),%eax
+  80241b:	38 c2                	cmp    %al,%dl
+  80241d:	74 1a                	je     802439 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  80241f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802423:	0f b6 00             	movzbl (%rax),%eax
+  802426:	0f b6 c8             	movzbl %al,%ecx
+  802429:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80242d:	0f b6 00             	movzbl (%rax),%eax
+  802430:	0f b6 d0             	movzbl %al,%edx
+  802433:	89 c8                	mov    %ecx,%eax
+  802435:	29 d0                	sub    %edx,%eax
+  802437:	eb 20                	jmp    802459 <memcmp+0x12b>
+    s1++, s2++;
+  802439:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80243e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  802443:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802447:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80244b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80244f:	48 85 c0             	test   %rax,%rax
+  802452:	75 b9                	jne    80240d <memcmp+0xdf>
+  }
+
+  return 0;
+  802454:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802459:	c9                   	leave
+  80245a:	c3                   	ret
+
+000000000080245b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  80245b:	55                   	push   %rbp
+  80245c:	48 89 e5             	mov    %rsp,%rbp
+  80245f:	48 83 ec 50          	sub    $0x50,%rsp
+  802463:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802467:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  80246a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  80246e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802472:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802476:	48 01 d0             	add    %rdx,%rax
+  802479:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  80247d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  802480:	66 0f 6e c0          	movd   %eax,%xmm0
+  802484:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  802488:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80248c:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  802491:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  802495:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  80249a:	76 73                	jbe    80250f <memfind+0xb4>
+  80249c:	48 b8 4d 17 80 00 00 	movabs $0x80174d,%rax
+  8024a3:	00 00 00 
+  8024a6:	ff d0                	call   *%rax
+  8024a8:	83 e0 02             	and    $0x2,%eax
+  8024ab:	85 c0                	test   %eax,%eax
+  8024ad:	74 60                	je     80250f <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  8024af:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8024b2:	0f b6 c8             	movzbl %al,%ecx
+  8024b5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8024b9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024bd:	89 ce                	mov    %ecx,%esi
+  8024bf:	48 89 c7             	mov    %rax,%rdi
+  8024c2:	48 b8 04 1a 80 00 00 	movabs $0x801a04,%rax
+  8024c9:	00 00 00 
+  8024cc:	ff d0                	call   *%rax
+  8024ce:	eb 6c                	jmp    80253c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  8024d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024d4:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8024d8:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8024dc:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  8024e1:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8024e5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8024e9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8024ec:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8024f0:	74 13                	je     802505 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  8024f2:	31 c0                	xor    %eax,%eax
+  8024f4:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  8024f9:	48 63 d0             	movslq %eax,%rdx
+  8024fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802500:	48 01 d0             	add    %rdx,%rax
+  802503:	eb 37                	jmp    80253c <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  802505:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  80250a:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  80250f:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  802514:	77 ba                	ja     8024d0 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  802516:	eb 13                	jmp    80252b <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802518:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80251c:	0f b6 00             	movzbl (%rax),%eax
+  80251f:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  802522:	38 d0                	cmp    %dl,%al
+  802524:	74 11                	je     802537 <memfind+0xdc>
+  for (; s < ends; s++)
+  802526:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  80252b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80252f:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  802533:	72 e3                	jb     802518 <memfind+0xbd>
+  802535:	eb 01                	jmp    802538 <memfind+0xdd>
+      break;
+  802537:	90                   	nop
+  return (void *)s;
+  802538:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  80253c:	c9                   	leave
+  80253d:	c3                   	ret
+
+000000000080253e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80253e:	55                   	push   %rbp
+  80253f:	48 89 e5             	mov    %rsp,%rbp
+  802542:	48 83 ec 38          	sub    $0x38,%rsp
+  802546:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80254a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80254e:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802551:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802558:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80255f:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802560:	eb 05                	jmp    802567 <strtol+0x29>
+    s++;
+  802562:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  802567:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80256b:	0f b6 00             	movzbl (%rax),%eax
+  80256e:	3c 20                	cmp    $0x20,%al
+  802570:	74 f0                	je     802562 <strtol+0x24>
+  802572:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802576:	0f b6 00             	movzbl (%rax),%eax
+  802579:	3c 09                	cmp    $0x9,%al
+  80257b:	74 e5                	je     802562 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  80257d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802581:	0f b6 00             	movzbl (%rax),%eax
+  802584:	3c 2b                	cmp    $0x2b,%al
+  802586:	75 07                	jne    80258f <strtol+0x51>
+    s++;
+  802588:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80258d:	eb 17                	jmp    8025a6 <strtol+0x68>
+  else if (*s == '-')
+  80258f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802593:	0f b6 00             	movzbl (%rax),%eax
+  802596:	3c 2d                	cmp    $0x2d,%al
+  802598:	75 0c                	jne    8025a6 <strtol+0x68>
+    s++, neg = 1;
+  80259a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80259f:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8025a6:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8025aa:	74 06                	je     8025b2 <strtol+0x74>
+  8025ac:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  8025b0:	75 28                	jne    8025da <strtol+0x9c>
+  8025b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025b6:	0f b6 00             	movzbl (%rax),%eax
+  8025b9:	3c 30                	cmp    $0x30,%al
+  8025bb:	75 1d                	jne    8025da <strtol+0x9c>
+  8025bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025c1:	48 83 c0 01          	add    $0x1,%rax
+  8025c5:	0f b6 00             	movzbl (%rax),%eax
+  8025c8:	3c 78                	cmp    $0x78,%al
+  8025ca:	75 0e                	jne    8025da <strtol+0x9c>
+    s += 2, base = 16;
+  8025cc:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8025d1:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8025d8:	eb 2c                	jmp    802606 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8025da:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8025de:	75 19                	jne    8025f9 <strtol+0xbb>
+  8025e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025e4:	0f b6 00             	movzbl (%rax),%eax
+  8025e7:	3c 30                	cmp    $0x30,%al
+  8025e9:	75 0e                	jne    8025f9 <strtol+0xbb>
+    s++, base = 8;
+  8025eb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8025f0:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8025f7:	eb 0d                	jmp    802606 <strtol+0xc8>
+  else if (base == 0)
+  8025f9:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8025fd:	75 07                	jne    802606 <strtol+0xc8>
+    base = 10;
+  8025ff:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802606:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80260a:	0f b6 00             	movzbl (%rax),%eax
+  80260d:	3c 2f                	cmp    $0x2f,%al
+  80260f:	7e 1d                	jle    80262e <strtol+0xf0>
+  802611:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802615:	0f b6 00             	movzbl (%rax),%eax
+  802618:	3c 39                	cmp    $0x39,%al
+  80261a:	7f 12                	jg     80262e <strtol+0xf0>
+      dig = *s - '0';
+  80261c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802620:	0f b6 00             	movzbl (%rax),%eax
+  802623:	0f be c0             	movsbl %al,%eax
+  802626:	83 e8 30             	sub    $0x30,%eax
+  802629:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80262c:	eb 4e                	jmp    80267c <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  80262e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802632:	0f b6 00             	movzbl (%rax),%eax
+  802635:	3c 60                	cmp    $0x60,%al
+  802637:	7e 1d                	jle    802656 <strtol+0x118>
+  802639:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80263d:	0f b6 00             	movzbl (%rax),%eax
+  802640:	3c 7a                	cmp    $0x7a,%al
+  802642:	7f 12                	jg     802656 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802644:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802648:	0f b6 00             	movzbl (%rax),%eax
+  80264b:	0f be c0             	movsbl %al,%eax
+  80264e:	83 e8 57             	sub    $0x57,%eax
+  802651:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802654:	eb 26                	jmp    80267c <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802656:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80265a:	0f b6 00             	movzbl (%rax),%eax
+  80265d:	3c 40                	cmp    $0x40,%al
+  80265f:	7e 47                	jle    8026a8 <strtol+0x16a>
+  802661:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802665:	0f b6 00             	movzbl (%rax),%eax
+  802668:	3c 5a                	cmp    $0x5a,%al
+  80266a:	7f 3c                	jg     8026a8 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  80266c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802670:	0f b6 00             	movzbl (%rax),%eax
+  802673:	0f be c0             	movsbl %al,%eax
+  802676:	83 e8 37             	sub    $0x37,%eax
+  802679:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  80267c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80267f:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802682:	7d 23                	jge    8026a7 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802684:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802689:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  80268c:	48 98                	cltq
+  80268e:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802693:	48 89 c2             	mov    %rax,%rdx
+  802696:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802699:	48 98                	cltq
+  80269b:	48 01 d0             	add    %rdx,%rax
+  80269e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  8026a2:	e9 5f ff ff ff       	jmp    802606 <strtol+0xc8>
+      break;
+  8026a7:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8026a8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8026ad:	74 0b                	je     8026ba <strtol+0x17c>
+    *endptr = (char *)s;
+  8026af:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8026b3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8026b7:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  8026ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8026be:	74 09                	je     8026c9 <strtol+0x18b>
+  8026c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026c4:	48 f7 d8             	neg    %rax
+  8026c7:	eb 04                	jmp    8026cd <strtol+0x18f>
+  8026c9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+
+00000000008026cf <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8026cf:	55                   	push   %rbp
+  8026d0:	48 89 e5             	mov    %rsp,%rbp
+  8026d3:	53                   	push   %rbx
+  8026d4:	48 83 ec 48          	sub    $0x48,%rsp
+  8026d8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8026dc:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8026e0:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026e4:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8026e8:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8026ec:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8026f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026f4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8026f8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8026fc:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802700:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802704:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802708:	4c 89 c3             	mov    %r8,%rbx
+  80270b:	cd 30                	int    $0x30
+  80270d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802711:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802716:	74 46                	je     80275e <syscall+0x8f>
+  802718:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80271d:	7e 3f                	jle    80275e <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  80271f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802723:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802727:	49 89 d0             	mov    %rdx,%r8
+  80272a:	48 89 c1             	mov    %rax,%rcx
+  80272d:	48 b8 68 7c 80 00 00 	movabs $0x807c68,%rax
+  802734:	00 00 00 
+  802737:	48 89 c2             	mov    %rax,%rdx
+  80273a:	be 22 00 00 00       	mov    $0x22,%esi
+  80273f:	48 b8 87 7c 80 00 00 	movabs $0x807c87,%rax
+  802746:	00 00 00 
+  802749:	48 89 c7             	mov    %rax,%rdi
+  80274c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802751:	49 b9 e2 09 80 00 00 	movabs $0x8009e2,%r9
+  802758:	00 00 00 
+  80275b:	41 ff d1             	call   *%r9
+
+  return ret;
+  80275e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802762:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802766:	c9                   	leave
+  802767:	c3                   	ret
+
+0000000000802768 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802768:	55                   	push   %rbp
+  802769:	48 89 e5             	mov    %rsp,%rbp
+  80276c:	48 83 ec 10          	sub    $0x10,%rsp
+  802770:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802774:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802778:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80277c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802780:	48 83 ec 08          	sub    $0x8,%rsp
+  802784:	6a 00                	push   $0x0
+  802786:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80278c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802792:	48 89 d1             	mov    %rdx,%rcx
+  802795:	48 89 c2             	mov    %rax,%rdx
+  802798:	be 00 00 00 00       	mov    $0x0,%esi
+  80279d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027a2:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  8027a9:	00 00 00 
+  8027ac:	ff d0                	call   *%rax
+  8027ae:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027b2:	90                   	nop
+  8027b3:	c9                   	leave
+  8027b4:	c3                   	ret
+
+00000000008027b5 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  8027b5:	55                   	push   %rbp
+  8027b6:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  8027b9:	48 83 ec 08          	sub    $0x8,%rsp
+  8027bd:	6a 00                	push   $0x0
+  8027bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d5:	be 00 00 00 00       	mov    $0x0,%esi
+  8027da:	bf 01 00 00 00       	mov    $0x1,%edi
+  8027df:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  8027e6:	00 00 00 
+  8027e9:	ff d0                	call   *%rax
+  8027eb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027ef:	c9                   	leave
+  8027f0:	c3                   	ret
+
+00000000008027f1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8027f1:	55                   	push   %rbp
+  8027f2:	48 89 e5             	mov    %rsp,%rbp
+  8027f5:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8027fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027ff:	48 98                	cltq
+  802801:	48 83 ec 08          	sub    $0x8,%rsp
+  802805:	6a 00                	push   $0x0
+  802807:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80280d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802813:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802818:	48 89 c2             	mov    %rax,%rdx
+  80281b:	be 01 00 00 00       	mov    $0x1,%esi
+  802820:	bf 03 00 00 00       	mov    $0x3,%edi
+  802825:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  80282c:	00 00 00 
+  80282f:	ff d0                	call   *%rax
+  802831:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802835:	c9                   	leave
+  802836:	c3                   	ret
+
+0000000000802837 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802837:	55                   	push   %rbp
+  802838:	48 89 e5             	mov    %rsp,%rbp
+  80283b:	48 83 ec 10          	sub    $0x10,%rsp
+  80283f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802842:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802845:	48 98                	cltq
+  802847:	48 83 ec 08          	sub    $0x8,%rsp
+  80284b:	6a 00                	push   $0x0
+  80284d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802853:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802859:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80285e:	48 89 c2             	mov    %rax,%rdx
+  802861:	be 00 00 00 00       	mov    $0x0,%esi
+  802866:	bf 04 00 00 00       	mov    $0x4,%edi
+  80286b:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802872:	00 00 00 
+  802875:	ff d0                	call   *%rax
+  802877:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80287b:	90                   	nop
+  80287c:	c9                   	leave
+  80287d:	c3                   	ret
+
+000000000080287e <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  80287e:	55                   	push   %rbp
+  80287f:	48 89 e5             	mov    %rsp,%rbp
+  802882:	48 83 ec 20          	sub    $0x20,%rsp
+  802886:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802889:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  80288d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802890:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802893:	b8 05 00 00 00       	mov    $0x5,%eax
+  802898:	cd 30                	int    $0x30
+  80289a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80289e:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  8028a2:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8028a7:	7e 3d                	jle    8028e6 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  8028a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ad:	49 89 c0             	mov    %rax,%r8
+  8028b0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8028b5:	48 b8 68 7c 80 00 00 	movabs $0x807c68,%rax
+  8028bc:	00 00 00 
+  8028bf:	48 89 c2             	mov    %rax,%rdx
+  8028c2:	be 49 00 00 00       	mov    $0x49,%esi
+  8028c7:	48 b8 87 7c 80 00 00 	movabs $0x807c87,%rax
+  8028ce:	00 00 00 
+  8028d1:	48 89 c7             	mov    %rax,%rdi
+  8028d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d9:	49 b9 e2 09 80 00 00 	movabs $0x8009e2,%r9
+  8028e0:	00 00 00 
+  8028e3:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8028e6:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8028eb:	75 13                	jne    802900 <sys_env_wait+0x82>
+  8028ed:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8028f2:	74 0c                	je     802900 <sys_env_wait+0x82>
+    *status = st;
+  8028f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028f8:	89 c2                	mov    %eax,%edx
+  8028fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8028fe:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802900:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802904:	c9                   	leave
+  802905:	c3                   	ret
+
+0000000000802906 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802906:	55                   	push   %rbp
+  802907:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80290a:	48 83 ec 08          	sub    $0x8,%rsp
+  80290e:	6a 00                	push   $0x0
+  802910:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802916:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80291c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802921:	ba 00 00 00 00       	mov    $0x0,%edx
+  802926:	be 00 00 00 00       	mov    $0x0,%esi
+  80292b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802930:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+  80293c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802940:	c9                   	leave
+  802941:	c3                   	ret
+
+0000000000802942 <sys_yield>:
+
+void
+sys_yield(void) {
+  802942:	55                   	push   %rbp
+  802943:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802946:	48 83 ec 08          	sub    $0x8,%rsp
+  80294a:	6a 00                	push   $0x0
+  80294c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802952:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802958:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80295d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802962:	be 00 00 00 00       	mov    $0x0,%esi
+  802967:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80296c:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802973:	00 00 00 
+  802976:	ff d0                	call   *%rax
+  802978:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80297c:	90                   	nop
+  80297d:	c9                   	leave
+  80297e:	c3                   	ret
+
+000000000080297f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  80297f:	55                   	push   %rbp
+  802980:	48 89 e5             	mov    %rsp,%rbp
+  802983:	48 83 ec 20          	sub    $0x20,%rsp
+  802987:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80298a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80298e:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802991:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802994:	48 63 c8             	movslq %eax,%rcx
+  802997:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80299b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80299e:	48 98                	cltq
+  8029a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029a4:	6a 00                	push   $0x0
+  8029a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029ac:	49 89 c8             	mov    %rcx,%r8
+  8029af:	48 89 d1             	mov    %rdx,%rcx
+  8029b2:	48 89 c2             	mov    %rax,%rdx
+  8029b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8029ba:	bf 06 00 00 00       	mov    $0x6,%edi
+  8029bf:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  8029c6:	00 00 00 
+  8029c9:	ff d0                	call   *%rax
+  8029cb:	48 83 c4 10          	add    $0x10,%rsp
+  8029cf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8029d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029d5:	c9                   	leave
+  8029d6:	c3                   	ret
+
+00000000008029d7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8029d7:	55                   	push   %rbp
+  8029d8:	48 89 e5             	mov    %rsp,%rbp
+  8029db:	48 83 ec 20          	sub    $0x20,%rsp
+  8029df:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8029e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029e6:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8029e9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8029ed:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8029f1:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8029f4:	48 63 c8             	movslq %eax,%rcx
+  8029f7:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8029fb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8029fe:	48 63 f0             	movslq %eax,%rsi
+  802a01:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a05:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a08:	48 98                	cltq
+  802a0a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a0e:	51                   	push   %rcx
+  802a0f:	49 89 f9             	mov    %rdi,%r9
+  802a12:	49 89 f0             	mov    %rsi,%r8
+  802a15:	48 89 d1             	mov    %rdx,%rcx
+  802a18:	48 89 c2             	mov    %rax,%rdx
+  802a1b:	be 01 00 00 00       	mov    $0x1,%esi
+  802a20:	bf 07 00 00 00       	mov    $0x7,%edi
+  802a25:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802a2c:	00 00 00 
+  802a2f:	ff d0                	call   *%rax
+  802a31:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a35:	c9                   	leave
+  802a36:	c3                   	ret
+
+0000000000802a37 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802a37:	55                   	push   %rbp
+  802a38:	48 89 e5             	mov    %rsp,%rbp
+  802a3b:	48 83 ec 10          	sub    $0x10,%rsp
+  802a3f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a42:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802a46:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a4a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a4d:	48 98                	cltq
+  802a4f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a53:	6a 00                	push   $0x0
+  802a55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a5b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a61:	48 89 d1             	mov    %rdx,%rcx
+  802a64:	48 89 c2             	mov    %rax,%rdx
+  802a67:	be 01 00 00 00       	mov    $0x1,%esi
+  802a6c:	bf 08 00 00 00       	mov    $0x8,%edi
+  802a71:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+  802a7d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a81:	c9                   	leave
+  802a82:	c3                   	ret
+
+0000000000802a83 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802a83:	55                   	push   %rbp
+  802a84:	48 89 e5             	mov    %rsp,%rbp
+  802a87:	48 83 ec 10          	sub    $0x10,%rsp
+  802a8b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802a8e:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802a91:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802a94:	48 63 d0             	movslq %eax,%rdx
+  802a97:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a9a:	48 98                	cltq
+  802a9c:	48 83 ec 08          	sub    $0x8,%rsp
+  802aa0:	6a 00                	push   $0x0
+  802aa2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802aa8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aae:	48 89 d1             	mov    %rdx,%rcx
+  802ab1:	48 89 c2             	mov    %rax,%rdx
+  802ab4:	be 01 00 00 00       	mov    $0x1,%esi
+  802ab9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802abe:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+  802aca:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ace:	c9                   	leave
+  802acf:	c3                   	ret
+
+0000000000802ad0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802ad0:	55                   	push   %rbp
+  802ad1:	48 89 e5             	mov    %rsp,%rbp
+  802ad4:	48 83 ec 10          	sub    $0x10,%rsp
+  802ad8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802adb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802adf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ae3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ae6:	48 98                	cltq
+  802ae8:	48 83 ec 08          	sub    $0x8,%rsp
+  802aec:	6a 00                	push   $0x0
+  802aee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802af4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802afa:	48 89 d1             	mov    %rdx,%rcx
+  802afd:	48 89 c2             	mov    %rax,%rdx
+  802b00:	be 01 00 00 00       	mov    $0x1,%esi
+  802b05:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802b0a:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802b11:	00 00 00 
+  802b14:	ff d0                	call   *%rax
+  802b16:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b1a:	c9                   	leave
+  802b1b:	c3                   	ret
+
+0000000000802b1c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802b1c:	55                   	push   %rbp
+  802b1d:	48 89 e5             	mov    %rsp,%rbp
+  802b20:	48 83 ec 10          	sub    $0x10,%rsp
+  802b24:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b27:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802b2b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b32:	48 98                	cltq
+  802b34:	48 83 ec 08          	sub    $0x8,%rsp
+  802b38:	6a 00                	push   $0x0
+  802b3a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b40:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b46:	48 89 d1             	mov    %rdx,%rcx
+  802b49:	48 89 c2             	mov    %rax,%rdx
+  802b4c:	be 01 00 00 00       	mov    $0x1,%esi
+  802b51:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802b56:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802b5d:	00 00 00 
+  802b60:	ff d0                	call   *%rax
+  802b62:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b66:	c9                   	leave
+  802b67:	c3                   	ret
+
+0000000000802b68 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802b68:	55                   	push   %rbp
+  802b69:	48 89 e5             	mov    %rsp,%rbp
+  802b6c:	48 83 ec 20          	sub    $0x20,%rsp
+  802b70:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802b73:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b77:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802b7b:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802b7e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802b81:	48 63 f0             	movslq %eax,%rsi
+  802b84:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802b88:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b8c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b8f:	48 98                	cltq
+  802b91:	48 83 ec 08          	sub    $0x8,%rsp
+  802b95:	6a 00                	push   $0x0
+  802b97:	49 89 f1             	mov    %rsi,%r9
+  802b9a:	49 89 c8             	mov    %rcx,%r8
+  802b9d:	48 89 d1             	mov    %rdx,%rcx
+  802ba0:	48 89 c2             	mov    %rax,%rdx
+  802ba3:	be 00 00 00 00       	mov    $0x0,%esi
+  802ba8:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802bad:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802bb4:	00 00 00 
+  802bb7:	ff d0                	call   *%rax
+  802bb9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+
+0000000000802bbf <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802bbf:	55                   	push   %rbp
+  802bc0:	48 89 e5             	mov    %rsp,%rbp
+  802bc3:	48 83 ec 10          	sub    $0x10,%rsp
+  802bc7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802bcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bcf:	48 83 ec 08          	sub    $0x8,%rsp
+  802bd3:	6a 00                	push   $0x0
+  802bd5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bdb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802be1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802be6:	48 89 c2             	mov    %rax,%rdx
+  802be9:	be 01 00 00 00       	mov    $0x1,%esi
+  802bee:	bf 0f 00 00 00       	mov    $0xf,%edi
+  802bf3:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802bfa:	00 00 00 
+  802bfd:	ff d0                	call   *%rax
+  802bff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c03:	c9                   	leave
+  802c04:	c3                   	ret
+
+0000000000802c05 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802c05:	55                   	push   %rbp
+  802c06:	48 89 e5             	mov    %rsp,%rbp
+  802c09:	48 83 ec 10          	sub    $0x10,%rsp
+  802c0d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c11:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802c15:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802c19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c1d:	48 83 ec 08          	sub    $0x8,%rsp
+  802c21:	6a 00                	push   $0x0
+  802c23:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c29:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c2f:	48 89 d1             	mov    %rdx,%rcx
+  802c32:	48 89 c2             	mov    %rax,%rdx
+  802c35:	be 01 00 00 00       	mov    $0x1,%esi
+  802c3a:	bf 10 00 00 00       	mov    $0x10,%edi
+  802c3f:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802c46:	00 00 00 
+  802c49:	ff d0                	call   *%rax
+  802c4b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c4f:	c9                   	leave
+  802c50:	c3                   	ret
+
+0000000000802c51 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802c51:	55                   	push   %rbp
+  802c52:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802c55:	48 83 ec 08          	sub    $0x8,%rsp
+  802c59:	6a 00                	push   $0x0
+  802c5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c71:	be 00 00 00 00       	mov    $0x0,%esi
+  802c76:	bf 11 00 00 00       	mov    $0x11,%edi
+  802c7b:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+  802c87:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c8b:	c9                   	leave
+  802c8c:	c3                   	ret
+
+0000000000802c8d <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802c8d:	55                   	push   %rbp
+  802c8e:	48 89 e5             	mov    %rsp,%rbp
+  802c91:	48 83 ec 10          	sub    $0x10,%rsp
+  802c95:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c99:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802c9d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ca1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ca5:	48 83 ec 08          	sub    $0x8,%rsp
+  802ca9:	6a 00                	push   $0x0
+  802cab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cb1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cb7:	48 89 d1             	mov    %rdx,%rcx
+  802cba:	48 89 c2             	mov    %rax,%rdx
+  802cbd:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc2:	bf 12 00 00 00       	mov    $0x12,%edi
+  802cc7:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802cce:	00 00 00 
+  802cd1:	ff d0                	call   *%rax
+  802cd3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cd7:	c9                   	leave
+  802cd8:	c3                   	ret
+
+0000000000802cd9 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802cd9:	55                   	push   %rbp
+  802cda:	48 89 e5             	mov    %rsp,%rbp
+  802cdd:	48 83 ec 20          	sub    $0x20,%rsp
+  802ce1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802ce5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802ce9:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802cec:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802cef:	48 63 c8             	movslq %eax,%rcx
+  802cf2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802cf6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cfa:	48 83 ec 08          	sub    $0x8,%rsp
+  802cfe:	6a 00                	push   $0x0
+  802d00:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d06:	49 89 c8             	mov    %rcx,%r8
+  802d09:	48 89 d1             	mov    %rdx,%rcx
+  802d0c:	48 89 c2             	mov    %rax,%rdx
+  802d0f:	be 00 00 00 00       	mov    $0x0,%esi
+  802d14:	bf 13 00 00 00       	mov    $0x13,%edi
+  802d19:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802d20:	00 00 00 
+  802d23:	ff d0                	call   *%rax
+  802d25:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d29:	c9                   	leave
+  802d2a:	c3                   	ret
+
+0000000000802d2b <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802d2b:	55                   	push   %rbp
+  802d2c:	48 89 e5             	mov    %rsp,%rbp
+  802d2f:	48 83 ec 20          	sub    $0x20,%rsp
+  802d33:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d37:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802d3a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802d3e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802d42:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802d45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d49:	48 83 ec 08          	sub    $0x8,%rsp
+  802d4d:	6a 00                	push   $0x0
+  802d4f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d55:	49 89 c8             	mov    %rcx,%r8
+  802d58:	48 89 d1             	mov    %rdx,%rcx
+  802d5b:	48 89 c2             	mov    %rax,%rdx
+  802d5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d63:	bf 14 00 00 00       	mov    $0x14,%edi
+  802d68:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+  802d74:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d78:	c9                   	leave
+  802d79:	c3                   	ret
+
+0000000000802d7a <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802d7a:	55                   	push   %rbp
+  802d7b:	48 89 e5             	mov    %rsp,%rbp
+  802d7e:	48 83 ec 10          	sub    $0x10,%rsp
+  802d82:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802d86:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802d89:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802d8c:	48 63 d0             	movslq %eax,%rdx
+  802d8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d93:	48 83 ec 08          	sub    $0x8,%rsp
+  802d97:	6a 00                	push   $0x0
+  802d99:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802da5:	48 89 d1             	mov    %rdx,%rcx
+  802da8:	48 89 c2             	mov    %rax,%rdx
+  802dab:	be 00 00 00 00       	mov    $0x0,%esi
+  802db0:	bf 15 00 00 00       	mov    $0x15,%edi
+  802db5:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802dbc:	00 00 00 
+  802dbf:	ff d0                	call   *%rax
+  802dc1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+0000000000802dc7 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802dc7:	55                   	push   %rbp
+  802dc8:	48 89 e5             	mov    %rsp,%rbp
+  802dcb:	48 83 ec 20          	sub    $0x20,%rsp
+  802dcf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802dd3:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802dd6:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802dd9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802ddd:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802de1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802de4:	48 63 c8             	movslq %eax,%rcx
+  802de7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802dea:	48 63 d0             	movslq %eax,%rdx
+  802ded:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802df1:	48 83 ec 08          	sub    $0x8,%rsp
+  802df5:	6a 00                	push   $0x0
+  802df7:	49 89 f1             	mov    %rsi,%r9
+  802dfa:	49 89 c8             	mov    %rcx,%r8
+  802dfd:	48 89 d1             	mov    %rdx,%rcx
+  802e00:	48 89 c2             	mov    %rax,%rdx
+  802e03:	be 00 00 00 00       	mov    $0x0,%esi
+  802e08:	bf 16 00 00 00       	mov    $0x16,%edi
+  802e0d:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802e14:	00 00 00 
+  802e17:	ff d0                	call   *%rax
+  802e19:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e1d:	c9                   	leave
+  802e1e:	c3                   	ret
+
+0000000000802e1f <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802e1f:	55                   	push   %rbp
+  802e20:	48 89 e5             	mov    %rsp,%rbp
+  802e23:	48 83 ec 30          	sub    $0x30,%rsp
+  802e27:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802e2b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802e2f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802e33:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802e37:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802e3b:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802e3f:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802e43:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802e47:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802e4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e4f:	48 83 ec 08          	sub    $0x8,%rsp
+  802e53:	51                   	push   %rcx
+  802e54:	49 89 f9             	mov    %rdi,%r9
+  802e57:	49 89 f0             	mov    %rsi,%r8
+  802e5a:	48 89 d1             	mov    %rdx,%rcx
+  802e5d:	48 89 c2             	mov    %rax,%rdx
+  802e60:	be 00 00 00 00       	mov    $0x0,%esi
+  802e65:	bf 17 00 00 00       	mov    $0x17,%edi
+  802e6a:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+  802e76:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e7a:	c9                   	leave
+  802e7b:	c3                   	ret
+
+0000000000802e7c <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802e7c:	55                   	push   %rbp
+  802e7d:	48 89 e5             	mov    %rsp,%rbp
+  802e80:	48 83 ec 10          	sub    $0x10,%rsp
+  802e84:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802e87:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e8a:	48 98                	cltq
+  802e8c:	48 83 ec 08          	sub    $0x8,%rsp
+  802e90:	6a 00                	push   $0x0
+  802e92:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e98:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e9e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ea3:	48 89 c2             	mov    %rax,%rdx
+  802ea6:	be 00 00 00 00       	mov    $0x0,%esi
+  802eab:	bf 18 00 00 00       	mov    $0x18,%edi
+  802eb0:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+  802ebc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ec0:	90                   	nop
+  802ec1:	c9                   	leave
+  802ec2:	c3                   	ret
+
+0000000000802ec3 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802ec3:	55                   	push   %rbp
+  802ec4:	48 89 e5             	mov    %rsp,%rbp
+  802ec7:	48 83 ec 30          	sub    $0x30,%rsp
+  802ecb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ece:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802ed2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802ed6:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802ed9:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802edc:	48 63 f0             	movslq %eax,%rsi
+  802edf:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802ee3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ee7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eea:	48 98                	cltq
+  802eec:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef0:	6a 00                	push   $0x0
+  802ef2:	49 89 f1             	mov    %rsi,%r9
+  802ef5:	49 89 c8             	mov    %rcx,%r8
+  802ef8:	48 89 d1             	mov    %rdx,%rcx
+  802efb:	48 89 c2             	mov    %rax,%rdx
+  802efe:	be 01 00 00 00       	mov    $0x1,%esi
+  802f03:	bf 19 00 00 00       	mov    $0x19,%edi
+  802f08:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802f0f:	00 00 00 
+  802f12:	ff d0                	call   *%rax
+  802f14:	48 83 c4 10          	add    $0x10,%rsp
+  802f18:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802f1b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802f1e:	c9                   	leave
+  802f1f:	c3                   	ret
+
+0000000000802f20 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802f20:	55                   	push   %rbp
+  802f21:	48 89 e5             	mov    %rsp,%rbp
+  802f24:	48 83 ec 20          	sub    $0x20,%rsp
+  802f28:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802f2c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802f30:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802f33:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f36:	48 63 c8             	movslq %eax,%rcx
+  802f39:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802f3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f41:	48 83 ec 08          	sub    $0x8,%rsp
+  802f45:	6a 00                	push   $0x0
+  802f47:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f4d:	49 89 c8             	mov    %rcx,%r8
+  802f50:	48 89 d1             	mov    %rdx,%rcx
+  802f53:	48 89 c2             	mov    %rax,%rdx
+  802f56:	be 01 00 00 00       	mov    $0x1,%esi
+  802f5b:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802f60:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802f67:	00 00 00 
+  802f6a:	ff d0                	call   *%rax
+  802f6c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f70:	c9                   	leave
+  802f71:	c3                   	ret
+
+0000000000802f72 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802f72:	55                   	push   %rbp
+  802f73:	48 89 e5             	mov    %rsp,%rbp
+  802f76:	48 83 ec 20          	sub    $0x20,%rsp
+  802f7a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802f7e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802f82:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802f86:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802f8a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802f8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f92:	48 83 ec 08          	sub    $0x8,%rsp
+  802f96:	6a 00                	push   $0x0
+  802f98:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f9e:	49 89 c8             	mov    %rcx,%r8
+  802fa1:	48 89 d1             	mov    %rdx,%rcx
+  802fa4:	48 89 c2             	mov    %rax,%rdx
+  802fa7:	be 01 00 00 00       	mov    $0x1,%esi
+  802fac:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802fb1:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  802fb8:	00 00 00 
+  802fbb:	ff d0                	call   *%rax
+  802fbd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802fc1:	c9                   	leave
+  802fc2:	c3                   	ret
+
+0000000000802fc3 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802fc3:	55                   	push   %rbp
+  802fc4:	48 89 e5             	mov    %rsp,%rbp
+  802fc7:	48 83 ec 30          	sub    $0x30,%rsp
+  802fcb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802fcf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802fd3:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802fd6:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802fda:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802fde:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802fe1:	48 63 c8             	movslq %eax,%rcx
+  802fe4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802fe8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fec:	48 83 ec 08          	sub    $0x8,%rsp
+  802ff0:	6a 00                	push   $0x0
+  802ff2:	49 89 f1             	mov    %rsi,%r9
+  802ff5:	49 89 c8             	mov    %rcx,%r8
+  802ff8:	48 89 d1             	mov    %rdx,%rcx
+  802ffb:	48 89 c2             	mov    %rax,%rdx
+  802ffe:	be 01 00 00 00       	mov    $0x1,%esi
+  803003:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  803008:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  80300f:	00 00 00 
+  803012:	ff d0                	call   *%rax
+  803014:	48 83 c4 10          	add    $0x10,%rsp
+  803018:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80301b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80301e:	c9                   	leave
+  80301f:	c3                   	ret
+
+0000000000803020 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  803020:	55                   	push   %rbp
+  803021:	48 89 e5             	mov    %rsp,%rbp
+  803024:	48 83 ec 10          	sub    $0x10,%rsp
+  803028:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80302b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80302e:	48 98                	cltq
+  803030:	48 83 ec 08          	sub    $0x8,%rsp
+  803034:	6a 00                	push   $0x0
+  803036:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80303c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803042:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803047:	48 89 c2             	mov    %rax,%rdx
+  80304a:	be 01 00 00 00       	mov    $0x1,%esi
+  80304f:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  803054:	48 b8 cf 26 80 00 00 	movabs $0x8026cf,%rax
+  80305b:	00 00 00 
+  80305e:	ff d0                	call   *%rax
+  803060:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803064:	c9                   	leave
+  803065:	c3                   	ret
+
+0000000000803066 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  803066:	55                   	push   %rbp
+  803067:	48 89 e5             	mov    %rsp,%rbp
+  80306a:	48 83 ec 40          	sub    $0x40,%rsp
+  80306e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  803072:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803076:	48 8b 00             	mov    (%rax),%rax
+  803079:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  80307d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803081:	48 8b 40 08          	mov    0x8(%rax),%rax
+  803085:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  803089:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80308d:	83 e0 02             	and    $0x2,%eax
+  803090:	48 85 c0             	test   %rax,%rax
+  803093:	74 25                	je     8030ba <pgfault+0x54>
+  803095:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803099:	48 c1 e8 0c          	shr    $0xc,%rax
+  80309d:	48 89 c2             	mov    %rax,%rdx
+  8030a0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8030a7:	01 00 00 
+  8030aa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030ae:	83 e0 02             	and    $0x2,%eax
+  8030b1:	48 85 c0             	test   %rax,%rax
+  8030b4:	0f 85 fe 01 00 00    	jne    8032b8 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  8030ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030be:	83 e0 02             	and    $0x2,%eax
+  8030c1:	48 85 c0             	test   %rax,%rax
+  8030c4:	74 23                	je     8030e9 <pgfault+0x83>
+  8030c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030ca:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030ce:	48 89 c2             	mov    %rax,%rdx
+  8030d1:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8030d8:	01 00 00 
+  8030db:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030df:	25 00 08 00 00       	and    $0x800,%eax
+  8030e4:	48 85 c0             	test   %rax,%rax
+  8030e7:	75 3f                	jne    803128 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  8030e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030f1:	49 89 d0             	mov    %rdx,%r8
+  8030f4:	48 89 c1             	mov    %rax,%rcx
+  8030f7:	48 b8 98 7c 80 00 00 	movabs $0x807c98,%rax
+  8030fe:	00 00 00 
+  803101:	48 89 c2             	mov    %rax,%rdx
+  803104:	be 26 00 00 00       	mov    $0x26,%esi
+  803109:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  803110:	00 00 00 
+  803113:	48 89 c7             	mov    %rax,%rdi
+  803116:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311b:	49 b9 e2 09 80 00 00 	movabs $0x8009e2,%r9
+  803122:	00 00 00 
+  803125:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  803128:	48 b8 59 6a 80 00 00 	movabs $0x806a59,%rax
+  80312f:	00 00 00 
+  803132:	ff d0                	call   *%rax
+  803134:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  803138:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80313c:	ba 07 00 00 00       	mov    $0x7,%edx
+  803141:	48 89 c6             	mov    %rax,%rsi
+  803144:	bf 00 00 00 00       	mov    $0x0,%edi
+  803149:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  803150:	00 00 00 
+  803153:	ff d0                	call   *%rax
+  803155:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  803158:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  80315c:	79 36                	jns    803194 <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  80315e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803161:	89 c1                	mov    %eax,%ecx
+  803163:	48 b8 d8 7c 80 00 00 	movabs $0x807cd8,%rax
+  80316a:	00 00 00 
+  80316d:	48 89 c2             	mov    %rax,%rdx
+  803170:	be 35 00 00 00       	mov    $0x35,%esi
+  803175:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  80317c:	00 00 00 
+  80317f:	48 89 c7             	mov    %rax,%rdi
+  803182:	b8 00 00 00 00       	mov    $0x0,%eax
+  803187:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  80318e:	00 00 00 
+  803191:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  803194:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803198:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  80319c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8031a0:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031a6:	48 89 c1             	mov    %rax,%rcx
+  8031a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031b2:	48 89 ce             	mov    %rcx,%rsi
+  8031b5:	48 89 c7             	mov    %rax,%rdi
+  8031b8:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  8031bf:	00 00 00 
+  8031c2:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  8031c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031c8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031cc:	48 89 c2             	mov    %rax,%rdx
+  8031cf:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8031d6:	01 00 00 
+  8031d9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031dd:	25 00 08 00 00       	and    $0x800,%eax
+  8031e2:	48 85 c0             	test   %rax,%rax
+  8031e5:	74 7a                	je     803261 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  8031e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031eb:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8031ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031f3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  8031f9:	48 89 c2             	mov    %rax,%rdx
+  8031fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803200:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  803206:	48 89 d1             	mov    %rdx,%rcx
+  803209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80320e:	48 89 c6             	mov    %rax,%rsi
+  803211:	bf 00 00 00 00       	mov    $0x0,%edi
+  803216:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  80321d:	00 00 00 
+  803220:	ff d0                	call   *%rax
+  803222:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  803225:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803229:	79 36                	jns    803261 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  80322b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80322e:	89 c1                	mov    %eax,%ecx
+  803230:	48 b8 00 7d 80 00 00 	movabs $0x807d00,%rax
+  803237:	00 00 00 
+  80323a:	48 89 c2             	mov    %rax,%rdx
+  80323d:	be 42 00 00 00       	mov    $0x42,%esi
+  803242:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  803249:	00 00 00 
+  80324c:	48 89 c7             	mov    %rax,%rdi
+  80324f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803254:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  80325b:	00 00 00 
+  80325e:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  803261:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803265:	48 89 c6             	mov    %rax,%rsi
+  803268:	bf 00 00 00 00       	mov    $0x0,%edi
+  80326d:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  803274:	00 00 00 
+  803277:	ff d0                	call   *%rax
+  803279:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  80327c:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  803280:	79 37                	jns    8032b9 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  803282:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803285:	89 c1                	mov    %eax,%ecx
+  803287:	48 b8 28 7d 80 00 00 	movabs $0x807d28,%rax
+  80328e:	00 00 00 
+  803291:	48 89 c2             	mov    %rax,%rdx
+  803294:	be 46 00 00 00       	mov    $0x46,%esi
+  803299:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  8032a0:	00 00 00 
+  8032a3:	48 89 c7             	mov    %rax,%rdi
+  8032a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ab:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  8032b2:	00 00 00 
+  8032b5:	41 ff d0             	call   *%r8
+    return;
+  8032b8:	90                   	nop
+  }
+}
+  8032b9:	c9                   	leave
+  8032ba:	c3                   	ret
+
+00000000008032bb <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  8032bb:	55                   	push   %rbp
+  8032bc:	48 89 e5             	mov    %rsp,%rbp
+  8032bf:	48 83 ec 30          	sub    $0x30,%rsp
+  8032c3:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8032c6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  8032ca:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  8032d1:	01 00 00 
+  8032d4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032d8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8032dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8032e1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  8032e5:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  8032ec:	00 00 00 
+  8032ef:	ff d0                	call   *%rax
+  8032f1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  8032f4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032f8:	48 c1 e0 0c          	shl    $0xc,%rax
+  8032fc:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  803300:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  803307:	01 00 00 
+  80330a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80330e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803312:	25 00 04 00 00       	and    $0x400,%eax
+  803317:	48 85 c0             	test   %rax,%rax
+  80331a:	74 7b                	je     803397 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  80331c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803320:	89 c1                	mov    %eax,%ecx
+  803322:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803326:	48 c1 e0 0c          	shl    $0xc,%rax
+  80332a:	48 89 c2             	mov    %rax,%rdx
+  80332d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803331:	48 c1 e0 0c          	shl    $0xc,%rax
+  803335:	48 89 c6             	mov    %rax,%rsi
+  803338:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80333b:	41 89 c8             	mov    %ecx,%r8d
+  80333e:	48 89 d1             	mov    %rdx,%rcx
+  803341:	89 c2                	mov    %eax,%edx
+  803343:	bf 00 00 00 00       	mov    $0x0,%edi
+  803348:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  80334f:	00 00 00 
+  803352:	ff d0                	call   *%rax
+  803354:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803357:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80335b:	0f 89 da 00 00 00    	jns    80343b <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  803361:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803364:	89 c1                	mov    %eax,%ecx
+  803366:	48 b8 50 7d 80 00 00 	movabs $0x807d50,%rax
+  80336d:	00 00 00 
+  803370:	48 89 c2             	mov    %rax,%rdx
+  803373:	be 5f 00 00 00       	mov    $0x5f,%esi
+  803378:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  80337f:	00 00 00 
+  803382:	48 89 c7             	mov    %rax,%rdi
+  803385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80338a:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  803391:	00 00 00 
+  803394:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  803397:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80339b:	25 02 08 00 00       	and    $0x802,%eax
+  8033a0:	48 85 c0             	test   %rax,%rax
+  8033a3:	74 6e                	je     803413 <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  8033a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033a9:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  8033af:	80 cc 08             	or     $0x8,%ah
+  8033b2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  8033b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033ba:	89 c7                	mov    %eax,%edi
+  8033bc:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8033c0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8033c3:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8033c7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033ca:	41 89 f8             	mov    %edi,%r8d
+  8033cd:	89 c7                	mov    %eax,%edi
+  8033cf:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  8033d6:	00 00 00 
+  8033d9:	ff d0                	call   *%rax
+  8033db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  8033de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033e2:	79 05                	jns    8033e9 <duppage+0x12e>
+      return r;
+  8033e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033e7:	eb 55                	jmp    80343e <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  8033e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033ed:	89 c7                	mov    %eax,%edi
+  8033ef:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8033f3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8033f6:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8033fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033fd:	41 89 f8             	mov    %edi,%r8d
+  803400:	89 c7                	mov    %eax,%edi
+  803402:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  803409:	00 00 00 
+  80340c:	ff d0                	call   *%rax
+  80340e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803411:	eb 28                	jmp    80343b <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  803413:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803417:	89 c7                	mov    %eax,%edi
+  803419:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80341d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803420:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  803424:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803427:	41 89 f8             	mov    %edi,%r8d
+  80342a:	89 c7                	mov    %eax,%edi
+  80342c:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  803433:	00 00 00 
+  803436:	ff d0                	call   *%rax
+  803438:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  80343b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80343e:	c9                   	leave
+  80343f:	c3                   	ret
+
+0000000000803440 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  803440:	55                   	push   %rbp
+  803441:	48 89 e5             	mov    %rsp,%rbp
+  803444:	48 83 ec 20          	sub    $0x20,%rsp
+  803448:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80344b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  80344f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803453:	48 c1 e0 0c          	shl    $0xc,%rax
+  803457:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  80345b:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  803462:	01 00 00 
+  803465:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803469:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80346d:	25 00 08 00 00       	and    $0x800,%eax
+  803472:	48 85 c0             	test   %rax,%rax
+  803475:	74 0d                	je     803484 <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  803477:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80347b:	0f b6 10             	movzbl (%rax),%edx
+  80347e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803482:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  803484:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  80348b:	01 00 00 
+  80348e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803492:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803496:	25 07 0e 00 00       	and    $0xe07,%eax
+  80349b:	89 c6                	mov    %eax,%esi
+  80349d:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8034a1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8034a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034a8:	41 89 f0             	mov    %esi,%r8d
+  8034ab:	48 89 c6             	mov    %rax,%rsi
+  8034ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034b3:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  8034ba:	00 00 00 
+  8034bd:	ff d0                	call   *%rax
+}
+  8034bf:	c9                   	leave
+  8034c0:	c3                   	ret
+
+00000000008034c1 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  8034c1:	55                   	push   %rbp
+  8034c2:	48 89 e5             	mov    %rsp,%rbp
+  8034c5:	48 83 ec 40          	sub    $0x40,%rsp
+  8034c9:	89 f8                	mov    %edi,%eax
+  8034cb:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  8034ce:	48 b8 66 30 80 00 00 	movabs $0x803066,%rax
+  8034d5:	00 00 00 
+  8034d8:	48 89 c7             	mov    %rax,%rdi
+  8034db:	48 b8 8f 6b 80 00 00 	movabs $0x806b8f,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  8034e7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8034ec:	cd 30                	int    $0x30
+  8034ee:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  8034f1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  8034f4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8034f7:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8034fb:	79 36                	jns    803533 <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  8034fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803500:	89 c1                	mov    %eax,%ecx
+  803502:	48 b8 7b 7d 80 00 00 	movabs $0x807d7b,%rax
+  803509:	00 00 00 
+  80350c:	48 89 c2             	mov    %rax,%rdx
+  80350f:	be 8f 00 00 00       	mov    $0x8f,%esi
+  803514:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  80351b:	00 00 00 
+  80351e:	48 89 c7             	mov    %rax,%rdi
+  803521:	b8 00 00 00 00       	mov    $0x0,%eax
+  803526:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  80352d:	00 00 00 
+  803530:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  803533:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803537:	75 0a                	jne    803543 <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  803539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353e:	e9 d3 02 00 00       	jmp    803816 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  803543:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80354a:	00 
+  80354b:	e9 7a 01 00 00       	jmp    8036ca <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  803550:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803554:	48 c1 e0 0c          	shl    $0xc,%rax
+  803558:	48 c1 e8 27          	shr    $0x27,%rax
+  80355c:	48 89 c2             	mov    %rax,%rdx
+  80355f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803566:	01 00 00 
+  803569:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80356d:	83 e0 01             	and    $0x1,%eax
+  803570:	48 85 c0             	test   %rax,%rax
+  803573:	0f 84 4c 01 00 00    	je     8036c5 <fork_common+0x204>
+  803579:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80357d:	48 c1 e0 0c          	shl    $0xc,%rax
+  803581:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803585:	48 89 c2             	mov    %rax,%rdx
+  803588:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80358f:	01 00 00 
+  803592:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803596:	83 e0 01             	and    $0x1,%eax
+  803599:	48 85 c0             	test   %rax,%rax
+  80359c:	0f 84 23 01 00 00    	je     8036c5 <fork_common+0x204>
+  8035a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035a6:	48 c1 e0 0c          	shl    $0xc,%rax
+  8035aa:	48 c1 e8 15          	shr    $0x15,%rax
+  8035ae:	48 89 c2             	mov    %rax,%rdx
+  8035b1:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8035b8:	01 00 00 
+  8035bb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035bf:	83 e0 01             	and    $0x1,%eax
+  8035c2:	48 85 c0             	test   %rax,%rax
+  8035c5:	0f 84 fa 00 00 00    	je     8036c5 <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  8035cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035cf:	48 c1 e0 0c          	shl    $0xc,%rax
+  8035d3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  8035d7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035db:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  8035e2:	00 00 00 
+  8035e5:	48 39 c2             	cmp    %rax,%rdx
+  8035e8:	0f 82 d7 00 00 00    	jb     8036c5 <fork_common+0x204>
+  8035ee:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  8035f5:	00 00 00 
+  8035f8:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8035fc:	0f 84 c3 00 00 00    	je     8036c5 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803602:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803606:	48 89 c7             	mov    %rax,%rdi
+  803609:	48 b8 15 6a 80 00 00 	movabs $0x806a15,%rax
+  803610:	00 00 00 
+  803613:	ff d0                	call   *%rax
+  803615:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803618:	84 c0                	test   %al,%al
+  80361a:	0f 84 a5 00 00 00    	je     8036c5 <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  803620:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803624:	48 c1 e8 0c          	shr    $0xc,%rax
+  803628:	48 89 c2             	mov    %rax,%rdx
+  80362b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803632:	01 00 00 
+  803635:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803639:	83 e0 01             	and    $0x1,%eax
+  80363c:	48 85 c0             	test   %rax,%rax
+  80363f:	0f 84 80 00 00 00    	je     8036c5 <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  803645:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  803649:	74 4a                	je     803695 <fork_common+0x1d4>
+  80364b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80364f:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  803656:	00 00 00 
+  803659:	48 39 c2             	cmp    %rax,%rdx
+  80365c:	73 13                	jae    803671 <fork_common+0x1b0>
+  80365e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803662:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  803669:	00 00 00 
+  80366c:	48 39 c2             	cmp    %rax,%rdx
+  80366f:	73 24                	jae    803695 <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  803671:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803675:	48 c1 e8 0c          	shr    $0xc,%rax
+  803679:	48 89 c2             	mov    %rax,%rdx
+  80367c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80367f:	48 89 d6             	mov    %rdx,%rsi
+  803682:	89 c7                	mov    %eax,%edi
+  803684:	48 b8 40 34 80 00 00 	movabs $0x803440,%rax
+  80368b:	00 00 00 
+  80368e:	ff d0                	call   *%rax
+  803690:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803693:	eb 22                	jmp    8036b7 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  803695:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803699:	48 c1 e8 0c          	shr    $0xc,%rax
+  80369d:	48 89 c2             	mov    %rax,%rdx
+  8036a0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036a3:	48 89 d6             	mov    %rdx,%rsi
+  8036a6:	89 c7                	mov    %eax,%edi
+  8036a8:	48 b8 bb 32 80 00 00 	movabs $0x8032bb,%rax
+  8036af:	00 00 00 
+  8036b2:	ff d0                	call   *%rax
+  8036b4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  8036b7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036bb:	79 08                	jns    8036c5 <fork_common+0x204>
+            return r;
+  8036bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036c0:	e9 51 01 00 00       	jmp    803816 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  8036c5:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8036ca:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  8036d1:	07 
+  8036d2:	0f 86 78 fe ff ff    	jbe    803550 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  8036d8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8036df:	00 00 00 
+  8036e2:	8b 40 04             	mov    0x4(%rax),%eax
+  8036e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8036ea:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8036f1:	00 00 00 
+  8036f4:	48 98                	cltq
+  8036f6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8036fd:	48 01 d0             	add    %rdx,%rax
+  803700:	48 05 00 01 00 00    	add    $0x100,%rax
+  803706:	48 8b 10             	mov    (%rax),%rdx
+  803709:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80370c:	48 89 d6             	mov    %rdx,%rsi
+  80370f:	89 c7                	mov    %eax,%edi
+  803711:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  803718:	00 00 00 
+  80371b:	ff d0                	call   *%rax
+  80371d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803720:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803724:	79 36                	jns    80375c <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  803726:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803729:	89 c1                	mov    %eax,%ecx
+  80372b:	48 b8 90 7d 80 00 00 	movabs $0x807d90,%rax
+  803732:	00 00 00 
+  803735:	48 89 c2             	mov    %rax,%rdx
+  803738:	be be 00 00 00       	mov    $0xbe,%esi
+  80373d:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  803744:	00 00 00 
+  803747:	48 89 c7             	mov    %rax,%rdi
+  80374a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80374f:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  803756:	00 00 00 
+  803759:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  80375c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80375f:	ba 02 00 00 00       	mov    $0x2,%edx
+  803764:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  80376b:	00 00 00 
+  80376e:	48 89 ce             	mov    %rcx,%rsi
+  803771:	89 c7                	mov    %eax,%edi
+  803773:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  80377a:	00 00 00 
+  80377d:	ff d0                	call   *%rax
+  80377f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803782:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803786:	79 36                	jns    8037be <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803788:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80378b:	89 c1                	mov    %eax,%ecx
+  80378d:	48 b8 c0 7d 80 00 00 	movabs $0x807dc0,%rax
+  803794:	00 00 00 
+  803797:	48 89 c2             	mov    %rax,%rdx
+  80379a:	be c1 00 00 00       	mov    $0xc1,%esi
+  80379f:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  8037a6:	00 00 00 
+  8037a9:	48 89 c7             	mov    %rax,%rdi
+  8037ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b1:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  8037b8:	00 00 00 
+  8037bb:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  8037be:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037c1:	be 02 00 00 00       	mov    $0x2,%esi
+  8037c6:	89 c7                	mov    %eax,%edi
+  8037c8:	48 b8 83 2a 80 00 00 	movabs $0x802a83,%rax
+  8037cf:	00 00 00 
+  8037d2:	ff d0                	call   *%rax
+  8037d4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037d7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037db:	79 36                	jns    803813 <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  8037dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037e0:	89 c1                	mov    %eax,%ecx
+  8037e2:	48 b8 e0 7d 80 00 00 	movabs $0x807de0,%rax
+  8037e9:	00 00 00 
+  8037ec:	48 89 c2             	mov    %rax,%rdx
+  8037ef:	be d4 00 00 00       	mov    $0xd4,%esi
+  8037f4:	48 b8 c6 7c 80 00 00 	movabs $0x807cc6,%rax
+  8037fb:	00 00 00 
+  8037fe:	48 89 c7             	mov    %rax,%rdi
+  803801:	b8 00 00 00 00       	mov    $0x0,%eax
+  803806:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  80380d:	00 00 00 
+  803810:	41 ff d0             	call   *%r8
+    }
+    return e;
+  803813:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  803816:	c9                   	leave
+  803817:	c3                   	ret
+
+0000000000803818 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  803818:	55                   	push   %rbp
+  803819:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  80381c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803821:	48 b8 c1 34 80 00 00 	movabs $0x8034c1,%rax
+  803828:	00 00 00 
+  80382b:	ff d0                	call   *%rax
+}
+  80382d:	5d                   	pop    %rbp
+  80382e:	c3                   	ret
+
+000000000080382f <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  80382f:	55                   	push   %rbp
+  803830:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  803833:	bf 01 00 00 00       	mov    $0x1,%edi
+  803838:	48 b8 c1 34 80 00 00 	movabs $0x8034c1,%rax
+  80383f:	00 00 00 
+  803842:	ff d0                	call   *%rax
+}
+  803844:	5d                   	pop    %rbp
+  803845:	c3                   	ret
+
+0000000000803846 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803846:	55                   	push   %rbp
+  803847:	48 89 e5             	mov    %rsp,%rbp
+  80384a:	48 83 ec 08          	sub    $0x8,%rsp
+  80384e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  803852:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803856:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80385d:	ff ff ff 
+  803860:	48 01 d0             	add    %rdx,%rax
+  803863:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803867:	c9                   	leave
+  803868:	c3                   	ret
+
+0000000000803869 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803869:	55                   	push   %rbp
+  80386a:	48 89 e5             	mov    %rsp,%rbp
+  80386d:	48 83 ec 08          	sub    $0x8,%rsp
+  803871:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  803875:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803879:	48 89 c7             	mov    %rax,%rdi
+  80387c:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  803883:	00 00 00 
+  803886:	ff d0                	call   *%rax
+  803888:	48 05 01 68 00 00    	add    $0x6801,%rax
+  80388e:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  803892:	c9                   	leave
+  803893:	c3                   	ret
+
+0000000000803894 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  803894:	55                   	push   %rbp
+  803895:	48 89 e5             	mov    %rsp,%rbp
+  803898:	48 83 ec 18          	sub    $0x18,%rsp
+  80389c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8038a0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8038a7:	e9 ae 00 00 00       	jmp    80395a <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8038ac:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8038af:	c1 e0 0c             	shl    $0xc,%eax
+  8038b2:	48 98                	cltq
+  8038b4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8038b9:	48 01 d0             	add    %rdx,%rax
+  8038bc:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8038c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038c4:	48 c1 e8 27          	shr    $0x27,%rax
+  8038c8:	48 89 c2             	mov    %rax,%rdx
+  8038cb:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8038d2:	01 00 00 
+  8038d5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038d9:	83 e0 01             	and    $0x1,%eax
+  8038dc:	48 85 c0             	test   %rax,%rax
+  8038df:	74 63                	je     803944 <fd_alloc+0xb0>
+  8038e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8038e5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8038e9:	48 89 c2             	mov    %rax,%rdx
+  8038ec:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8038f3:	01 00 00 
+  8038f6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038fa:	83 e0 01             	and    $0x1,%eax
+  8038fd:	48 85 c0             	test   %rax,%rax
+  803900:	74 42                	je     803944 <fd_alloc+0xb0>
+  803902:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803906:	48 c1 e8 15          	shr    $0x15,%rax
+  80390a:	48 89 c2             	mov    %rax,%rdx
+  80390d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803914:	01 00 00 
+  803917:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80391b:	83 e0 01             	and    $0x1,%eax
+  80391e:	48 85 c0             	test   %rax,%rax
+  803921:	74 21                	je     803944 <fd_alloc+0xb0>
+  803923:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803927:	48 c1 e8 0c          	shr    $0xc,%rax
+  80392b:	48 89 c2             	mov    %rax,%rdx
+  80392e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803935:	01 00 00 
+  803938:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80393c:	83 e0 01             	and    $0x1,%eax
+  80393f:	48 85 c0             	test   %rax,%rax
+  803942:	75 12                	jne    803956 <fd_alloc+0xc2>
+      *fd_store = fd;
+  803944:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803948:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80394c:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  80394f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803954:	eb 1e                	jmp    803974 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803956:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80395a:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80395e:	0f 8e 48 ff ff ff    	jle    8038ac <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  803964:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803968:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  80396f:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  803974:	c9                   	leave
+  803975:	c3                   	ret
+
+0000000000803976 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803976:	55                   	push   %rbp
+  803977:	48 89 e5             	mov    %rsp,%rbp
+  80397a:	48 83 ec 20          	sub    $0x20,%rsp
+  80397e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803981:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  803985:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803989:	78 06                	js     803991 <fd_lookup+0x1b>
+  80398b:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  80398f:	7e 0a                	jle    80399b <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803991:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803996:	e9 af 00 00 00       	jmp    803a4a <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  80399b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80399e:	c1 e0 0c             	shl    $0xc,%eax
+  8039a1:	48 98                	cltq
+  8039a3:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8039a8:	48 01 d0             	add    %rdx,%rax
+  8039ab:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8039af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039b3:	48 c1 e8 27          	shr    $0x27,%rax
+  8039b7:	48 89 c2             	mov    %rax,%rdx
+  8039ba:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8039c1:	01 00 00 
+  8039c4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039c8:	83 e0 01             	and    $0x1,%eax
+  8039cb:	48 85 c0             	test   %rax,%rax
+  8039ce:	74 63                	je     803a33 <fd_lookup+0xbd>
+  8039d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039d4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8039d8:	48 89 c2             	mov    %rax,%rdx
+  8039db:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8039e2:	01 00 00 
+  8039e5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8039e9:	83 e0 01             	and    $0x1,%eax
+  8039ec:	48 85 c0             	test   %rax,%rax
+  8039ef:	74 42                	je     803a33 <fd_lookup+0xbd>
+  8039f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039f5:	48 c1 e8 15          	shr    $0x15,%rax
+  8039f9:	48 89 c2             	mov    %rax,%rdx
+  8039fc:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803a03:	01 00 00 
+  803a06:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a0a:	83 e0 01             	and    $0x1,%eax
+  803a0d:	48 85 c0             	test   %rax,%rax
+  803a10:	74 21                	je     803a33 <fd_lookup+0xbd>
+  803a12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803a16:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a1a:	48 89 c2             	mov    %rax,%rdx
+  803a1d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803a24:	01 00 00 
+  803a27:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a2b:	83 e0 01             	and    $0x1,%eax
+  803a2e:	48 85 c0             	test   %rax,%rax
+  803a31:	75 07                	jne    803a3a <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803a33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803a38:	eb 10                	jmp    803a4a <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803a3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a3e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803a42:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  803a45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a4a:	c9                   	leave
+  803a4b:	c3                   	ret
+
+0000000000803a4c <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803a4c:	55                   	push   %rbp
+  803a4d:	48 89 e5             	mov    %rsp,%rbp
+  803a50:	48 83 ec 30          	sub    $0x30,%rsp
+  803a54:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803a58:	89 f0                	mov    %esi,%eax
+  803a5a:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803a5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803a61:	48 89 c7             	mov    %rax,%rdi
+  803a64:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  803a6b:	00 00 00 
+  803a6e:	ff d0                	call   *%rax
+  803a70:	89 c2                	mov    %eax,%edx
+  803a72:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803a76:	48 89 c6             	mov    %rax,%rsi
+  803a79:	89 d7                	mov    %edx,%edi
+  803a7b:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  803a82:	00 00 00 
+  803a85:	ff d0                	call   *%rax
+  803a87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a8a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a8e:	78 0a                	js     803a9a <fd_close+0x4e>
+  803a90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a94:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803a98:	74 12                	je     803aac <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803a9a:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803a9e:	74 05                	je     803aa5 <fd_close+0x59>
+  803aa0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803aa3:	eb 70                	jmp    803b15 <fd_close+0xc9>
+  803aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aaa:	eb 69                	jmp    803b15 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803aac:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ab0:	8b 00                	mov    (%rax),%eax
+  803ab2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ab6:	48 89 d6             	mov    %rdx,%rsi
+  803ab9:	89 c7                	mov    %eax,%edi
+  803abb:	48 b8 17 3b 80 00 00 	movabs $0x803b17,%rax
+  803ac2:	00 00 00 
+  803ac5:	ff d0                	call   *%rax
+  803ac7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803aca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ace:	78 2a                	js     803afa <fd_close+0xae>
+    if (dev->dev_close)
+  803ad0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ad4:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803ad8:	48 85 c0             	test   %rax,%rax
+  803adb:	74 16                	je     803af3 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803add:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803ae1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803ae5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ae9:	48 89 c7             	mov    %rax,%rdi
+  803aec:	ff d2                	call   *%rdx
+  803aee:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803af1:	eb 07                	jmp    803afa <fd_close+0xae>
+    else
+      r = 0;
+  803af3:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803afa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803afe:	48 89 c6             	mov    %rax,%rsi
+  803b01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b06:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  803b0d:	00 00 00 
+  803b10:	ff d0                	call   *%rax
+  return r;
+  803b12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803b15:	c9                   	leave
+  803b16:	c3                   	ret
+
+0000000000803b17 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803b17:	55                   	push   %rbp
+  803b18:	48 89 e5             	mov    %rsp,%rbp
+  803b1b:	48 83 ec 20          	sub    $0x20,%rsp
+  803b1f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803b22:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803b26:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803b2d:	eb 3f                	jmp    803b6e <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803b2f:	48 ba 60 90 80 00 00 	movabs $0x809060,%rdx
+  803b36:	00 00 00 
+  803b39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b3c:	48 98                	cltq
+  803b3e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b42:	8b 00                	mov    (%rax),%eax
+  803b44:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803b47:	75 21                	jne    803b6a <dev_lookup+0x53>
+      *dev = devtab[i];
+  803b49:	48 ba 60 90 80 00 00 	movabs $0x809060,%rdx
+  803b50:	00 00 00 
+  803b53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b56:	48 98                	cltq
+  803b58:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803b5c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b60:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  803b63:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b68:	eb 7f                	jmp    803be9 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803b6a:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803b6e:	48 ba 60 90 80 00 00 	movabs $0x809060,%rdx
+  803b75:	00 00 00 
+  803b78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b7b:	48 98                	cltq
+  803b7d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803b81:	48 85 c0             	test   %rax,%rax
+  803b84:	75 a9                	jne    803b2f <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803b86:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b8d:	00 00 00 
+  803b90:	8b 40 04             	mov    0x4(%rax),%eax
+  803b93:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b98:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b9f:	00 00 00 
+  803ba2:	48 98                	cltq
+  803ba4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803bab:	48 01 d0             	add    %rdx,%rax
+  803bae:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803bb4:	8b 00                	mov    (%rax),%eax
+  803bb6:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803bb9:	89 c6                	mov    %eax,%esi
+  803bbb:	48 b8 08 7e 80 00 00 	movabs $0x807e08,%rax
+  803bc2:	00 00 00 
+  803bc5:	48 89 c7             	mov    %rax,%rdi
+  803bc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bcd:	48 b9 01 0c 80 00 00 	movabs $0x800c01,%rcx
+  803bd4:	00 00 00 
+  803bd7:	ff d1                	call   *%rcx
+  *dev = 0;
+  803bd9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803bdd:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  803be4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803be9:	c9                   	leave
+  803bea:	c3                   	ret
+
+0000000000803beb <close>:
+
+int
+close(int fdnum) {
+  803beb:	55                   	push   %rbp
+  803bec:	48 89 e5             	mov    %rsp,%rbp
+  803bef:	48 83 ec 20          	sub    $0x20,%rsp
+  803bf3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803bf6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803bfa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bfd:	48 89 d6             	mov    %rdx,%rsi
+  803c00:	89 c7                	mov    %eax,%edi
+  803c02:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  803c09:	00 00 00 
+  803c0c:	ff d0                	call   *%rax
+  803c0e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c11:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c15:	79 05                	jns    803c1c <close+0x31>
+    return r;
+  803c17:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c1a:	eb 18                	jmp    803c34 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803c1c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c20:	be 01 00 00 00       	mov    $0x1,%esi
+  803c25:	48 89 c7             	mov    %rax,%rdi
+  803c28:	48 b8 4c 3a 80 00 00 	movabs $0x803a4c,%rax
+  803c2f:	00 00 00 
+  803c32:	ff d0                	call   *%rax
+}
+  803c34:	c9                   	leave
+  803c35:	c3                   	ret
+
+0000000000803c36 <close_all>:
+
+void
+close_all(void) {
+  803c36:	55                   	push   %rbp
+  803c37:	48 89 e5             	mov    %rsp,%rbp
+  803c3a:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803c3e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803c45:	eb 15                	jmp    803c5c <close_all+0x26>
+    close(i);
+  803c47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c4a:	89 c7                	mov    %eax,%edi
+  803c4c:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  803c53:	00 00 00 
+  803c56:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803c58:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803c5c:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803c60:	7e e5                	jle    803c47 <close_all+0x11>
+}
+  803c62:	90                   	nop
+  803c63:	90                   	nop
+  803c64:	c9                   	leave
+  803c65:	c3                   	ret
+
+0000000000803c66 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803c66:	55                   	push   %rbp
+  803c67:	48 89 e5             	mov    %rsp,%rbp
+  803c6a:	48 83 ec 40          	sub    $0x40,%rsp
+  803c6e:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  803c71:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  803c74:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803c78:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803c7b:	48 89 d6             	mov    %rdx,%rsi
+  803c7e:	89 c7                	mov    %eax,%edi
+  803c80:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  803c87:	00 00 00 
+  803c8a:	ff d0                	call   *%rax
+  803c8c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c8f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c93:	79 08                	jns    803c9d <dup+0x37>
+    return r;
+  803c95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c98:	e9 33 02 00 00       	jmp    803ed0 <dup+0x26a>
+  close(newfdnum);
+  803c9d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803ca0:	89 c7                	mov    %eax,%edi
+  803ca2:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  803ca9:	00 00 00 
+  803cac:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803cae:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803cb1:	c1 e0 0c             	shl    $0xc,%eax
+  803cb4:	48 98                	cltq
+  803cb6:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803cbb:	48 01 d0             	add    %rdx,%rax
+  803cbe:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  803cc2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cc6:	48 89 c7             	mov    %rax,%rdi
+  803cc9:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  803cd0:	00 00 00 
+  803cd3:	ff d0                	call   *%rax
+  803cd5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803cd9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cdd:	48 89 c7             	mov    %rax,%rdi
+  803ce0:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  803ce7:	00 00 00 
+  803cea:	ff d0                	call   *%rax
+  803cec:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803cf0:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803cf7:	00 
+  803cf8:	e9 19 01 00 00       	jmp    803e16 <dup+0x1b0>
+    off -= PGSIZE;
+  803cfd:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  803d04:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803d05:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d09:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d0d:	48 01 d0             	add    %rdx,%rax
+  803d10:	48 c1 e8 27          	shr    $0x27,%rax
+  803d14:	48 89 c2             	mov    %rax,%rdx
+  803d17:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803d1e:	01 00 00 
+  803d21:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d25:	83 e0 01             	and    $0x1,%eax
+  803d28:	48 85 c0             	test   %rax,%rax
+  803d2b:	0f 84 e5 00 00 00    	je     803e16 <dup+0x1b0>
+  803d31:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d39:	48 01 d0             	add    %rdx,%rax
+  803d3c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803d40:	48 89 c2             	mov    %rax,%rdx
+  803d43:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803d4a:	01 00 00 
+  803d4d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d51:	83 e0 01             	and    $0x1,%eax
+  803d54:	48 85 c0             	test   %rax,%rax
+  803d57:	0f 84 b9 00 00 00    	je     803e16 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803d5d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d61:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d65:	48 01 d0             	add    %rdx,%rax
+  803d68:	48 c1 e8 15          	shr    $0x15,%rax
+  803d6c:	48 89 c2             	mov    %rax,%rdx
+  803d6f:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803d76:	01 00 00 
+  803d79:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803d7d:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803d80:	48 85 c0             	test   %rax,%rax
+  803d83:	0f 84 8d 00 00 00    	je     803e16 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803d89:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d8d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d91:	48 01 d0             	add    %rdx,%rax
+  803d94:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d98:	48 89 c2             	mov    %rax,%rdx
+  803d9b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803da2:	01 00 00 
+  803da5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803da9:	83 e0 01             	and    $0x1,%eax
+  803dac:	48 85 c0             	test   %rax,%rax
+  803daf:	74 65                	je     803e16 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803db1:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803db5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803db9:	48 01 d0             	add    %rdx,%rax
+  803dbc:	48 c1 e8 0c          	shr    $0xc,%rax
+  803dc0:	48 89 c2             	mov    %rax,%rdx
+  803dc3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803dca:	01 00 00 
+  803dcd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803dd1:	25 07 0e 00 00       	and    $0xe07,%eax
+  803dd6:	89 c6                	mov    %eax,%esi
+  803dd8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ddc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803de0:	48 01 c2             	add    %rax,%rdx
+  803de3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803de7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803deb:	48 01 c8             	add    %rcx,%rax
+  803dee:	41 89 f0             	mov    %esi,%r8d
+  803df1:	48 89 d1             	mov    %rdx,%rcx
+  803df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803df9:	48 89 c6             	mov    %rax,%rsi
+  803dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e01:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  803e08:	00 00 00 
+  803e0b:	ff d0                	call   *%rax
+  803e0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e14:	78 60                	js     803e76 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803e16:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803e1b:	0f 85 dc fe ff ff    	jne    803cfd <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803e21:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e25:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e29:	48 89 c2             	mov    %rax,%rdx
+  803e2c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803e33:	01 00 00 
+  803e36:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803e3a:	25 07 0e 00 00       	and    $0xe07,%eax
+  803e3f:	89 c1                	mov    %eax,%ecx
+  803e41:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e45:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803e49:	41 89 c8             	mov    %ecx,%r8d
+  803e4c:	48 89 d1             	mov    %rdx,%rcx
+  803e4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e54:	48 89 c6             	mov    %rax,%rsi
+  803e57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e5c:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  803e63:	00 00 00 
+  803e66:	ff d0                	call   *%rax
+  803e68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e6f:	78 08                	js     803e79 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803e71:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803e74:	eb 5a                	jmp    803ed0 <dup+0x26a>
+        goto err;
+  803e76:	90                   	nop
+  803e77:	eb 01                	jmp    803e7a <dup+0x214>
+    goto err;
+  803e79:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803e7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e7e:	48 89 c6             	mov    %rax,%rsi
+  803e81:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e86:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  803e8d:	00 00 00 
+  803e90:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803e92:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803e99:	00 
+  803e9a:	eb 27                	jmp    803ec3 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803e9c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ea0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ea4:	48 01 d0             	add    %rdx,%rax
+  803ea7:	48 89 c6             	mov    %rax,%rsi
+  803eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eaf:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  803eb6:	00 00 00 
+  803eb9:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803ebb:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803ec2:	00 
+  803ec3:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803eca:	00 
+  803ecb:	76 cf                	jbe    803e9c <dup+0x236>
+  return r;
+  803ecd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803ed0:	c9                   	leave
+  803ed1:	c3                   	ret
+
+0000000000803ed2 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803ed2:	55                   	push   %rbp
+  803ed3:	48 89 e5             	mov    %rsp,%rbp
+  803ed6:	48 83 ec 40          	sub    $0x40,%rsp
+  803eda:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803edd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803ee1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ee5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803ee9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803eec:	48 89 d6             	mov    %rdx,%rsi
+  803eef:	89 c7                	mov    %eax,%edi
+  803ef1:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  803ef8:	00 00 00 
+  803efb:	ff d0                	call   *%rax
+  803efd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f04:	78 24                	js     803f2a <read+0x58>
+  803f06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f0a:	8b 00                	mov    (%rax),%eax
+  803f0c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803f10:	48 89 d6             	mov    %rdx,%rsi
+  803f13:	89 c7                	mov    %eax,%edi
+  803f15:	48 b8 17 3b 80 00 00 	movabs $0x803b17,%rax
+  803f1c:	00 00 00 
+  803f1f:	ff d0                	call   *%rax
+  803f21:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f24:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f28:	79 0a                	jns    803f34 <read+0x62>
+    return r;
+  803f2a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803f2d:	48 98                	cltq
+  803f2f:	e9 9e 00 00 00       	jmp    803fd2 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803f34:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f38:	8b 40 08             	mov    0x8(%rax),%eax
+  803f3b:	83 e0 03             	and    $0x3,%eax
+  803f3e:	83 f8 01             	cmp    $0x1,%eax
+  803f41:	75 5c                	jne    803f9f <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803f43:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803f4a:	00 00 00 
+  803f4d:	8b 40 04             	mov    0x4(%rax),%eax
+  803f50:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803f55:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f5c:	00 00 00 
+  803f5f:	48 98                	cltq
+  803f61:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f68:	48 01 d0             	add    %rdx,%rax
+  803f6b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803f71:	8b 00                	mov    (%rax),%eax
+  803f73:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803f76:	89 c6                	mov    %eax,%esi
+  803f78:	48 b8 27 7e 80 00 00 	movabs $0x807e27,%rax
+  803f7f:	00 00 00 
+  803f82:	48 89 c7             	mov    %rax,%rdi
+  803f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f8a:	48 b9 01 0c 80 00 00 	movabs $0x800c01,%rcx
+  803f91:	00 00 00 
+  803f94:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803f96:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803f9d:	eb 33                	jmp    803fd2 <read+0x100>
+  }
+  if (!dev->dev_read)
+  803f9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fa3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803fa7:	48 85 c0             	test   %rax,%rax
+  803faa:	75 09                	jne    803fb5 <read+0xe3>
+    return -E_NOT_SUPP;
+  803fac:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803fb3:	eb 1d                	jmp    803fd2 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803fb5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fb9:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803fbd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fc1:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803fc5:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803fc9:	48 89 ce             	mov    %rcx,%rsi
+  803fcc:	48 89 c7             	mov    %rax,%rdi
+  803fcf:	41 ff d0             	call   *%r8
+}
+  803fd2:	c9                   	leave
+  803fd3:	c3                   	ret
+
+0000000000803fd4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803fd4:	55                   	push   %rbp
+  803fd5:	48 89 e5             	mov    %rsp,%rbp
+  803fd8:	48 83 ec 30          	sub    $0x30,%rsp
+  803fdc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803fdf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803fe3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803fe7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803fee:	eb 49                	jmp    804039 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803ff0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ff3:	48 98                	cltq
+  803ff5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ff9:	48 29 c2             	sub    %rax,%rdx
+  803ffc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fff:	48 63 c8             	movslq %eax,%rcx
+  804002:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804006:	48 01 c1             	add    %rax,%rcx
+  804009:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80400c:	48 89 ce             	mov    %rcx,%rsi
+  80400f:	89 c7                	mov    %eax,%edi
+  804011:	48 b8 d2 3e 80 00 00 	movabs $0x803ed2,%rax
+  804018:	00 00 00 
+  80401b:	ff d0                	call   *%rax
+  80401d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  804020:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804024:	79 07                	jns    80402d <readn+0x59>
+      return m;
+  804026:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804029:	48 98                	cltq
+  80402b:	eb 1f                	jmp    80404c <readn+0x78>
+    if (m == 0)
+  80402d:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  804031:	74 13                	je     804046 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  804033:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804036:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804039:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80403c:	48 98                	cltq
+  80403e:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  804042:	72 ac                	jb     803ff0 <readn+0x1c>
+  804044:	eb 01                	jmp    804047 <readn+0x73>
+      break;
+  804046:	90                   	nop
+  }
+  return tot;
+  804047:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80404a:	48 98                	cltq
+}
+  80404c:	c9                   	leave
+  80404d:	c3                   	ret
+
+000000000080404e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80404e:	55                   	push   %rbp
+  80404f:	48 89 e5             	mov    %rsp,%rbp
+  804052:	48 83 ec 40          	sub    $0x40,%rsp
+  804056:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  804059:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80405d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804061:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804065:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804068:	48 89 d6             	mov    %rdx,%rsi
+  80406b:	89 c7                	mov    %eax,%edi
+  80406d:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  804074:	00 00 00 
+  804077:	ff d0                	call   *%rax
+  804079:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80407c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804080:	78 24                	js     8040a6 <write+0x58>
+  804082:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804086:	8b 00                	mov    (%rax),%eax
+  804088:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  80408c:	48 89 d6             	mov    %rdx,%rsi
+  80408f:	89 c7                	mov    %eax,%edi
+  804091:	48 b8 17 3b 80 00 00 	movabs $0x803b17,%rax
+  804098:	00 00 00 
+  80409b:	ff d0                	call   *%rax
+  80409d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040a0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040a4:	79 0a                	jns    8040b0 <write+0x62>
+    return r;
+  8040a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8040a9:	48 98                	cltq
+  8040ab:	e9 9d 00 00 00       	jmp    80414d <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8040b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8040b4:	8b 40 08             	mov    0x8(%rax),%eax
+  8040b7:	83 e0 03             	and    $0x3,%eax
+  8040ba:	85 c0                	test   %eax,%eax
+  8040bc:	75 5c                	jne    80411a <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8040be:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8040c5:	00 00 00 
+  8040c8:	8b 40 04             	mov    0x4(%rax),%eax
+  8040cb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8040d0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8040d7:	00 00 00 
+  8040da:	48 98                	cltq
+  8040dc:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8040e3:	48 01 d0             	add    %rdx,%rax
+  8040e6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8040ec:	8b 00                	mov    (%rax),%eax
+  8040ee:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8040f1:	89 c6                	mov    %eax,%esi
+  8040f3:	48 b8 43 7e 80 00 00 	movabs $0x807e43,%rax
+  8040fa:	00 00 00 
+  8040fd:	48 89 c7             	mov    %rax,%rdi
+  804100:	b8 00 00 00 00       	mov    $0x0,%eax
+  804105:	48 b9 01 0c 80 00 00 	movabs $0x800c01,%rcx
+  80410c:	00 00 00 
+  80410f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  804111:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  804118:	eb 33                	jmp    80414d <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80411a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80411e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804122:	48 85 c0             	test   %rax,%rax
+  804125:	75 09                	jne    804130 <write+0xe2>
+    return -E_NOT_SUPP;
+  804127:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80412e:	eb 1d                	jmp    80414d <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  804130:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804134:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  804138:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80413c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804140:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  804144:	48 89 ce             	mov    %rcx,%rsi
+  804147:	48 89 c7             	mov    %rax,%rdi
+  80414a:	41 ff d0             	call   *%r8
+}
+  80414d:	c9                   	leave
+  80414e:	c3                   	ret
+
+000000000080414f <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80414f:	55                   	push   %rbp
+  804150:	48 89 e5             	mov    %rsp,%rbp
+  804153:	48 83 ec 18          	sub    $0x18,%rsp
+  804157:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80415a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80415d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804161:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804164:	48 89 d6             	mov    %rdx,%rsi
+  804167:	89 c7                	mov    %eax,%edi
+  804169:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  804170:	00 00 00 
+  804173:	ff d0                	call   *%rax
+  804175:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804178:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80417c:	79 05                	jns    804183 <seek+0x34>
+    return r;
+  80417e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804181:	eb 0f                	jmp    804192 <seek+0x43>
+  fd->fd_offset = offset;
+  804183:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804187:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80418a:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  80418d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804192:	c9                   	leave
+  804193:	c3                   	ret
+
+0000000000804194 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  804194:	55                   	push   %rbp
+  804195:	48 89 e5             	mov    %rsp,%rbp
+  804198:	48 83 ec 30          	sub    $0x30,%rsp
+  80419c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80419f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8041a2:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8041a6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041a9:	48 89 d6             	mov    %rdx,%rsi
+  8041ac:	89 c7                	mov    %eax,%edi
+  8041ae:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  8041b5:	00 00 00 
+  8041b8:	ff d0                	call   *%rax
+  8041ba:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041bd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041c1:	78 24                	js     8041e7 <ftruncate+0x53>
+  8041c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041c7:	8b 00                	mov    (%rax),%eax
+  8041c9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8041cd:	48 89 d6             	mov    %rdx,%rsi
+  8041d0:	89 c7                	mov    %eax,%edi
+  8041d2:	48 b8 17 3b 80 00 00 	movabs $0x803b17,%rax
+  8041d9:	00 00 00 
+  8041dc:	ff d0                	call   *%rax
+  8041de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041e1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041e5:	79 08                	jns    8041ef <ftruncate+0x5b>
+    return r;
+  8041e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041ea:	e9 92 00 00 00       	jmp    804281 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8041ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041f3:	8b 40 08             	mov    0x8(%rax),%eax
+  8041f6:	83 e0 03             	and    $0x3,%eax
+  8041f9:	85 c0                	test   %eax,%eax
+  8041fb:	75 5a                	jne    804257 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8041fd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804204:	00 00 00 
+  804207:	8b 40 04             	mov    0x4(%rax),%eax
+  80420a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80420f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804216:	00 00 00 
+  804219:	48 98                	cltq
+  80421b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804222:	48 01 d0             	add    %rdx,%rax
+  804225:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80422b:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80422d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804230:	89 c6                	mov    %eax,%esi
+  804232:	48 b8 60 7e 80 00 00 	movabs $0x807e60,%rax
+  804239:	00 00 00 
+  80423c:	48 89 c7             	mov    %rax,%rdi
+  80423f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804244:	48 b9 01 0c 80 00 00 	movabs $0x800c01,%rcx
+  80424b:	00 00 00 
+  80424e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  804250:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804255:	eb 2a                	jmp    804281 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  804257:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80425b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80425f:	48 85 c0             	test   %rax,%rax
+  804262:	75 07                	jne    80426b <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  804264:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  804269:	eb 16                	jmp    804281 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80426b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80426f:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804273:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804277:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80427a:	89 d6                	mov    %edx,%esi
+  80427c:	48 89 c7             	mov    %rax,%rdi
+  80427f:	ff d1                	call   *%rcx
+}
+  804281:	c9                   	leave
+  804282:	c3                   	ret
+
+0000000000804283 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  804283:	55                   	push   %rbp
+  804284:	48 89 e5             	mov    %rsp,%rbp
+  804287:	48 83 ec 30          	sub    $0x30,%rsp
+  80428b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80428e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  804292:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804296:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804299:	48 89 d6             	mov    %rdx,%rsi
+  80429c:	89 c7                	mov    %eax,%edi
+  80429e:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  8042a5:	00 00 00 
+  8042a8:	ff d0                	call   *%rax
+  8042aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042b1:	78 24                	js     8042d7 <fstat+0x54>
+  8042b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042b7:	8b 00                	mov    (%rax),%eax
+  8042b9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8042bd:	48 89 d6             	mov    %rdx,%rsi
+  8042c0:	89 c7                	mov    %eax,%edi
+  8042c2:	48 b8 17 3b 80 00 00 	movabs $0x803b17,%rax
+  8042c9:	00 00 00 
+  8042cc:	ff d0                	call   *%rax
+  8042ce:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042d5:	79 05                	jns    8042dc <fstat+0x59>
+    return r;
+  8042d7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8042da:	eb 5e                	jmp    80433a <fstat+0xb7>
+  if (!dev->dev_stat)
+  8042dc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042e0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8042e4:	48 85 c0             	test   %rax,%rax
+  8042e7:	75 07                	jne    8042f0 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8042e9:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8042ee:	eb 4a                	jmp    80433a <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8042f0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042f4:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8042f7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042fb:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  804302:	00 00 00 
+  stat->st_isdir   = 0;
+  804305:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804309:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804310:	00 00 00 
+  stat->st_dev     = dev;
+  804313:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804317:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80431b:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  804322:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804326:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80432a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80432e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804332:	48 89 d6             	mov    %rdx,%rsi
+  804335:	48 89 c7             	mov    %rax,%rdi
+  804338:	ff d1                	call   *%rcx
+}
+  80433a:	c9                   	leave
+  80433b:	c3                   	ret
+
+000000000080433c <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80433c:	55                   	push   %rbp
+  80433d:	48 89 e5             	mov    %rsp,%rbp
+  804340:	48 83 ec 10          	sub    $0x10,%rsp
+  804344:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804348:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80434c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804350:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804356:	83 f8 20             	cmp    $0x20,%eax
+  804359:	75 07                	jne    804362 <pollwait_key+0x26>
+    return -E_INVAL;
+  80435b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804360:	eb 5f                	jmp    8043c1 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  804362:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804366:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80436c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804370:	48 63 d2             	movslq %edx,%rdx
+  804373:	48 c1 e2 04          	shl    $0x4,%rdx
+  804377:	48 01 c2             	add    %rax,%rdx
+  80437a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80437e:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  804381:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804385:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  80438b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80438f:	8b 00                	mov    (%rax),%eax
+  804391:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804395:	48 63 c9             	movslq %ecx,%rcx
+  804398:	48 c1 e1 04          	shl    $0x4,%rcx
+  80439c:	48 01 ca             	add    %rcx,%rdx
+  80439f:	48 83 c2 08          	add    $0x8,%rdx
+  8043a3:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8043a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043a9:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8043af:	8d 50 01             	lea    0x1(%rax),%edx
+  8043b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043b6:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8043bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043c1:	c9                   	leave
+  8043c2:	c3                   	ret
+
+00000000008043c3 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8043c3:	55                   	push   %rbp
+  8043c4:	48 89 e5             	mov    %rsp,%rbp
+  8043c7:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8043ce:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8043d5:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8043db:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8043e2:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8043e9:	00 
+  int i, r, ready, ipc = 0;
+  8043ea:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8043f1:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8043f8:	00 
+  8043f9:	74 45                	je     804440 <poll+0x7d>
+  8043fb:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  804402:	ff 
+  804403:	74 3b                	je     804440 <poll+0x7d>
+    now      = vsys_clock_ns();
+  804405:	48 b8 1a 6b 80 00 00 	movabs $0x806b1a,%rax
+  80440c:	00 00 00 
+  80440f:	ff d0                	call   *%rax
+  804411:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  804415:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804419:	48 f7 d0             	not    %rax
+  80441c:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  804423:	73 10                	jae    804435 <poll+0x72>
+  804425:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804429:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  804430:	48 01 d0             	add    %rdx,%rax
+  804433:	eb 07                	jmp    80443c <poll+0x79>
+  804435:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80443c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  804440:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  804447:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80444e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  804455:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80445c:	e9 46 02 00 00       	jmp    8046a7 <poll+0x2e4>
+      fds[i].revents = 0;
+  804461:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804464:	48 63 d0             	movslq %eax,%rdx
+  804467:	48 89 d0             	mov    %rdx,%rax
+  80446a:	48 01 c0             	add    %rax,%rax
+  80446d:	48 01 d0             	add    %rdx,%rax
+  804470:	48 c1 e0 02          	shl    $0x2,%rax
+  804474:	48 89 c2             	mov    %rax,%rdx
+  804477:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80447e:	48 01 d0             	add    %rdx,%rax
+  804481:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  804488:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80448b:	48 63 d0             	movslq %eax,%rdx
+  80448e:	48 89 d0             	mov    %rdx,%rax
+  804491:	48 01 c0             	add    %rax,%rax
+  804494:	48 01 d0             	add    %rdx,%rax
+  804497:	48 c1 e0 02          	shl    $0x2,%rax
+  80449b:	48 89 c2             	mov    %rax,%rdx
+  80449e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8044a5:	48 01 d0             	add    %rdx,%rax
+  8044a8:	8b 00                	mov    (%rax),%eax
+  8044aa:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8044ad:	75 62                	jne    804511 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8044af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044b2:	48 63 d0             	movslq %eax,%rdx
+  8044b5:	48 89 d0             	mov    %rdx,%rax
+  8044b8:	48 01 c0             	add    %rax,%rax
+  8044bb:	48 01 d0             	add    %rdx,%rax
+  8044be:	48 c1 e0 02          	shl    $0x2,%rax
+  8044c2:	48 89 c2             	mov    %rax,%rdx
+  8044c5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8044cc:	48 01 d0             	add    %rdx,%rax
+  8044cf:	8b 40 04             	mov    0x4(%rax),%eax
+  8044d2:	83 e0 01             	and    $0x1,%eax
+  8044d5:	85 c0                	test   %eax,%eax
+  8044d7:	0f 84 9b 01 00 00    	je     804678 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8044dd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044e0:	48 63 d0             	movslq %eax,%rdx
+  8044e3:	48 89 d0             	mov    %rdx,%rax
+  8044e6:	48 01 c0             	add    %rax,%rax
+  8044e9:	48 01 d0             	add    %rdx,%rax
+  8044ec:	48 c1 e0 02          	shl    $0x2,%rax
+  8044f0:	48 89 c2             	mov    %rax,%rdx
+  8044f3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8044fa:	48 01 c2             	add    %rax,%rdx
+  8044fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804500:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  804503:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804506:	83 c8 04             	or     $0x4,%eax
+  804509:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80450c:	e9 67 01 00 00       	jmp    804678 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804511:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804514:	48 63 d0             	movslq %eax,%rdx
+  804517:	48 89 d0             	mov    %rdx,%rax
+  80451a:	48 01 c0             	add    %rax,%rax
+  80451d:	48 01 d0             	add    %rdx,%rax
+  804520:	48 c1 e0 02          	shl    $0x2,%rax
+  804524:	48 89 c2             	mov    %rax,%rdx
+  804527:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80452e:	48 01 d0             	add    %rdx,%rax
+  804531:	8b 00                	mov    (%rax),%eax
+  804533:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80453a:	48 89 d6             	mov    %rdx,%rsi
+  80453d:	89 c7                	mov    %eax,%edi
+  80453f:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  804546:	00 00 00 
+  804549:	ff d0                	call   *%rax
+  80454b:	85 c0                	test   %eax,%eax
+  80454d:	78 25                	js     804574 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  80454f:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804556:	8b 00                	mov    (%rax),%eax
+  804558:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  80455f:	48 89 d6             	mov    %rdx,%rsi
+  804562:	89 c7                	mov    %eax,%edi
+  804564:	48 b8 17 3b 80 00 00 	movabs $0x803b17,%rax
+  80456b:	00 00 00 
+  80456e:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  804570:	85 c0                	test   %eax,%eax
+  804572:	79 2c                	jns    8045a0 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  804574:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804577:	48 63 d0             	movslq %eax,%rdx
+  80457a:	48 89 d0             	mov    %rdx,%rax
+  80457d:	48 01 c0             	add    %rax,%rax
+  804580:	48 01 d0             	add    %rdx,%rax
+  804583:	48 c1 e0 02          	shl    $0x2,%rax
+  804587:	48 89 c2             	mov    %rax,%rdx
+  80458a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804591:	48 01 d0             	add    %rdx,%rax
+  804594:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  80459b:	e9 d8 00 00 00       	jmp    804678 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8045a0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8045a7:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8045ab:	48 85 c0             	test   %rax,%rax
+  8045ae:	74 7d                	je     80462d <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8045b0:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8045b7:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8045bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8045be:	48 63 d0             	movslq %eax,%rdx
+  8045c1:	48 89 d0             	mov    %rdx,%rax
+  8045c4:	48 01 c0             	add    %rax,%rax
+  8045c7:	48 01 d0             	add    %rdx,%rax
+  8045ca:	48 c1 e0 02          	shl    $0x2,%rax
+  8045ce:	48 89 c2             	mov    %rax,%rdx
+  8045d1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8045d8:	48 01 d0             	add    %rdx,%rax
+  8045db:	8b 48 04             	mov    0x4(%rax),%ecx
+  8045de:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8045e5:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8045ec:	89 ce                	mov    %ecx,%esi
+  8045ee:	48 89 c7             	mov    %rax,%rdi
+  8045f1:	41 ff d0             	call   *%r8
+  8045f4:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8045f7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8045fb:	79 08                	jns    804605 <poll+0x242>
+          return r;
+  8045fd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804600:	e9 45 01 00 00       	jmp    80474a <poll+0x387>
+        fds[i].revents = r;
+  804605:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804608:	48 63 d0             	movslq %eax,%rdx
+  80460b:	48 89 d0             	mov    %rdx,%rax
+  80460e:	48 01 c0             	add    %rax,%rax
+  804611:	48 01 d0             	add    %rdx,%rax
+  804614:	48 c1 e0 02          	shl    $0x2,%rax
+  804618:	48 89 c2             	mov    %rax,%rdx
+  80461b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804622:	48 01 c2             	add    %rax,%rdx
+  804625:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804628:	89 42 08             	mov    %eax,0x8(%rdx)
+  80462b:	eb 4b                	jmp    804678 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80462d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804630:	48 63 d0             	movslq %eax,%rdx
+  804633:	48 89 d0             	mov    %rdx,%rax
+  804636:	48 01 c0             	add    %rax,%rax
+  804639:	48 01 d0             	add    %rdx,%rax
+  80463c:	48 c1 e0 02          	shl    $0x2,%rax
+  804640:	48 89 c2             	mov    %rax,%rdx
+  804643:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80464a:	48 01 d0             	add    %rdx,%rax
+  80464d:	8b 48 04             	mov    0x4(%rax),%ecx
+  804650:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804653:	48 63 d0             	movslq %eax,%rdx
+  804656:	48 89 d0             	mov    %rdx,%rax
+  804659:	48 01 c0             	add    %rax,%rax
+  80465c:	48 01 d0             	add    %rdx,%rax
+  80465f:	48 c1 e0 02          	shl    $0x2,%rax
+  804663:	48 89 c2             	mov    %rax,%rdx
+  804666:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80466d:	48 01 d0             	add    %rdx,%rax
+  804670:	83 e1 03             	and    $0x3,%ecx
+  804673:	89 ca                	mov    %ecx,%edx
+  804675:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804678:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80467b:	48 63 d0             	movslq %eax,%rdx
+  80467e:	48 89 d0             	mov    %rdx,%rax
+  804681:	48 01 c0             	add    %rax,%rax
+  804684:	48 01 d0             	add    %rdx,%rax
+  804687:	48 c1 e0 02          	shl    $0x2,%rax
+  80468b:	48 89 c2             	mov    %rax,%rdx
+  80468e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804695:	48 01 d0             	add    %rdx,%rax
+  804698:	8b 40 08             	mov    0x8(%rax),%eax
+  80469b:	85 c0                	test   %eax,%eax
+  80469d:	74 04                	je     8046a3 <poll+0x2e0>
+        ready++;
+  80469f:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8046a3:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8046a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046aa:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8046b0:	0f 8c ab fd ff ff    	jl     804461 <poll+0x9e>
+    }
+    if (ready)
+  8046b6:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8046ba:	74 08                	je     8046c4 <poll+0x301>
+      return ready;
+  8046bc:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8046bf:	e9 86 00 00 00       	jmp    80474a <poll+0x387>
+
+    if (deadline) {
+  8046c4:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8046c9:	74 30                	je     8046fb <poll+0x338>
+      now     = vsys_clock_ns();
+  8046cb:	48 b8 1a 6b 80 00 00 	movabs $0x806b1a,%rax
+  8046d2:	00 00 00 
+  8046d5:	ff d0                	call   *%rax
+  8046d7:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8046db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046df:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8046e3:	73 0a                	jae    8046ef <poll+0x32c>
+  8046e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046e9:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8046ed:	eb 05                	jmp    8046f4 <poll+0x331>
+  8046ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046f4:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8046fb:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8046fe:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804701:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804708:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  80470f:	48 89 c7             	mov    %rax,%rdi
+  804712:	48 b8 c7 2d 80 00 00 	movabs $0x802dc7,%rax
+  804719:	00 00 00 
+  80471c:	ff d0                	call   *%rax
+  80471e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  804721:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  804725:	75 07                	jne    80472e <poll+0x36b>
+      return 0;
+  804727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80472c:	eb 1c                	jmp    80474a <poll+0x387>
+    if (r < 0)
+  80472e:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804732:	79 05                	jns    804739 <poll+0x376>
+      return r;
+  804734:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804737:	eb 11                	jmp    80474a <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804739:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80473c:	c1 f8 02             	sar    $0x2,%eax
+  80473f:	83 e0 01             	and    $0x1,%eax
+  804742:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  804745:	e9 f6 fc ff ff       	jmp    804440 <poll+0x7d>
+  }
+}
+  80474a:	c9                   	leave
+  80474b:	c3                   	ret
+
+000000000080474c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80474c:	55                   	push   %rbp
+  80474d:	48 89 e5             	mov    %rsp,%rbp
+  804750:	48 83 ec 20          	sub    $0x20,%rsp
+  804754:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804758:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80475c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804760:	be 00 00 00 00       	mov    $0x0,%esi
+  804765:	48 89 c7             	mov    %rax,%rdi
+  804768:	48 b8 3a 48 80 00 00 	movabs $0x80483a,%rax
+  80476f:	00 00 00 
+  804772:	ff d0                	call   *%rax
+  804774:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804777:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80477b:	79 05                	jns    804782 <stat+0x36>
+    return fd;
+  80477d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804780:	eb 2f                	jmp    8047b1 <stat+0x65>
+  r = fstat(fd, stat);
+  804782:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804786:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804789:	48 89 d6             	mov    %rdx,%rsi
+  80478c:	89 c7                	mov    %eax,%edi
+  80478e:	48 b8 83 42 80 00 00 	movabs $0x804283,%rax
+  804795:	00 00 00 
+  804798:	ff d0                	call   *%rax
+  80479a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  80479d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047a0:	89 c7                	mov    %eax,%edi
+  8047a2:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8047a9:	00 00 00 
+  8047ac:	ff d0                	call   *%rax
+  return r;
+  8047ae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8047b1:	c9                   	leave
+  8047b2:	c3                   	ret
+
+00000000008047b3 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8047b3:	55                   	push   %rbp
+  8047b4:	48 89 e5             	mov    %rsp,%rbp
+  8047b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8047bb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8047be:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8047c2:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  8047c9:	00 00 00 
+  8047cc:	8b 00                	mov    (%rax),%eax
+  8047ce:	85 c0                	test   %eax,%eax
+  8047d0:	75 1d                	jne    8047ef <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8047d2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8047d7:	48 b8 1f 6f 80 00 00 	movabs $0x806f1f,%rax
+  8047de:	00 00 00 
+  8047e1:	ff d0                	call   *%rax
+  8047e3:	48 ba 00 b0 80 00 00 	movabs $0x80b000,%rdx
+  8047ea:	00 00 00 
+  8047ed:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8047ef:	48 b8 00 b0 80 00 00 	movabs $0x80b000,%rax
+  8047f6:	00 00 00 
+  8047f9:	8b 00                	mov    (%rax),%eax
+  8047fb:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8047fe:	b9 07 00 00 00       	mov    $0x7,%ecx
+  804803:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  80480a:	00 00 00 
+  80480d:	89 c7                	mov    %eax,%edi
+  80480f:	48 b8 72 6e 80 00 00 	movabs $0x806e72,%rax
+  804816:	00 00 00 
+  804819:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80481b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80481f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804824:	48 89 c6             	mov    %rax,%rsi
+  804827:	bf 00 00 00 00       	mov    $0x0,%edi
+  80482c:	48 b8 f5 6c 80 00 00 	movabs $0x806cf5,%rax
+  804833:	00 00 00 
+  804836:	ff d0                	call   *%rax
+}
+  804838:	c9                   	leave
+  804839:	c3                   	ret
+
+000000000080483a <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80483a:	55                   	push   %rbp
+  80483b:	48 89 e5             	mov    %rsp,%rbp
+  80483e:	48 83 ec 20          	sub    $0x20,%rsp
+  804842:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804846:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804849:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80484d:	48 89 c7             	mov    %rax,%rdi
+  804850:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  804857:	00 00 00 
+  80485a:	ff d0                	call   *%rax
+  80485c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804861:	7e 0a                	jle    80486d <open+0x33>
+    return -E_BAD_PATH;
+  804863:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804868:	e9 a8 00 00 00       	jmp    804915 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80486d:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804871:	48 89 c7             	mov    %rax,%rdi
+  804874:	48 b8 94 38 80 00 00 	movabs $0x803894,%rax
+  80487b:	00 00 00 
+  80487e:	ff d0                	call   *%rax
+  804880:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804883:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804887:	79 08                	jns    804891 <open+0x57>
+    return r;
+  804889:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80488c:	e9 84 00 00 00       	jmp    804915 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804891:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804895:	48 89 c6             	mov    %rax,%rsi
+  804898:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  80489f:	00 00 00 
+  8048a2:	48 89 c7             	mov    %rax,%rdi
+  8048a5:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  8048ac:	00 00 00 
+  8048af:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8048b1:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  8048b8:	00 00 00 
+  8048bb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8048be:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8048c4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048c8:	48 89 c6             	mov    %rax,%rsi
+  8048cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8048d0:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  8048d7:	00 00 00 
+  8048da:	ff d0                	call   *%rax
+  8048dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048e3:	79 1d                	jns    804902 <open+0xc8>
+    fd_close(fd, 0);
+  8048e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8048ee:	48 89 c7             	mov    %rax,%rdi
+  8048f1:	48 b8 4c 3a 80 00 00 	movabs $0x803a4c,%rax
+  8048f8:	00 00 00 
+  8048fb:	ff d0                	call   *%rax
+    return r;
+  8048fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804900:	eb 13                	jmp    804915 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  804902:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804906:	48 89 c7             	mov    %rax,%rdi
+  804909:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  804910:	00 00 00 
+  804913:	ff d0                	call   *%rax
+}
+  804915:	c9                   	leave
+  804916:	c3                   	ret
+
+0000000000804917 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804917:	55                   	push   %rbp
+  804918:	48 89 e5             	mov    %rsp,%rbp
+  80491b:	48 83 ec 10          	sub    $0x10,%rsp
+  80491f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  804923:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804927:	8b 40 0c             	mov    0xc(%rax),%eax
+  80492a:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804931:	00 00 00 
+  804934:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804936:	be 00 00 00 00       	mov    $0x0,%esi
+  80493b:	bf 06 00 00 00       	mov    $0x6,%edi
+  804940:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804947:	00 00 00 
+  80494a:	ff d0                	call   *%rax
+}
+  80494c:	c9                   	leave
+  80494d:	c3                   	ret
+
+000000000080494e <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80494e:	55                   	push   %rbp
+  80494f:	48 89 e5             	mov    %rsp,%rbp
+  804952:	48 83 ec 30          	sub    $0x30,%rsp
+  804956:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80495a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80495e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804962:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804967:	74 07                	je     804970 <devfile_read+0x22>
+  804969:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80496e:	75 0a                	jne    80497a <devfile_read+0x2c>
+  return E_INVAL;
+  804970:	b8 03 00 00 00       	mov    $0x3,%eax
+  804975:	e9 b4 00 00 00       	jmp    804a2e <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  80497a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804981:	00 
+  while (n) {
+  804982:	e9 98 00 00 00       	jmp    804a1f <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804987:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80498b:	8b 40 0c             	mov    0xc(%rax),%eax
+  80498e:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804995:	00 00 00 
+  804998:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  80499a:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  8049a1:	00 00 00 
+  8049a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049a8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8049ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8049b1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8049b6:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  8049bd:	00 00 00 
+  8049c0:	ff d0                	call   *%rax
+  8049c2:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8049c5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8049c9:	7f 13                	jg     8049de <devfile_read+0x90>
+      return res ? res : res0;
+  8049cb:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8049cf:	74 07                	je     8049d8 <devfile_read+0x8a>
+  8049d1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049d4:	48 98                	cltq
+  8049d6:	eb 56                	jmp    804a2e <devfile_read+0xe0>
+  8049d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8049dc:	eb 50                	jmp    804a2e <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8049de:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8049e1:	48 63 d0             	movslq %eax,%rdx
+  8049e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049e8:	48 b9 00 a0 80 00 00 	movabs $0x80a000,%rcx
+  8049ef:	00 00 00 
+  8049f2:	48 89 ce             	mov    %rcx,%rsi
+  8049f5:	48 89 c7             	mov    %rax,%rdi
+  8049f8:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  8049ff:	00 00 00 
+  804a02:	ff d0                	call   *%rax
+
+    buf += res;
+  804a04:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804a07:	48 98                	cltq
+  804a09:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804a0d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804a10:	48 98                	cltq
+  804a12:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804a16:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804a19:	48 98                	cltq
+  804a1b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804a1f:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804a24:	0f 85 5d ff ff ff    	jne    804987 <devfile_read+0x39>
+  }
+
+  return res0;
+  804a2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804a2e:	c9                   	leave
+  804a2f:	c3                   	ret
+
+0000000000804a30 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  804a30:	55                   	push   %rbp
+  804a31:	48 89 e5             	mov    %rsp,%rbp
+  804a34:	48 83 ec 50          	sub    $0x50,%rsp
+  804a38:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804a3c:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  804a40:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  804a44:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804a49:	74 07                	je     804a52 <devfile_write+0x22>
+  804a4b:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  804a50:	75 0a                	jne    804a5c <devfile_write+0x2c>
+  return E_INVAL;
+  804a52:	b8 03 00 00 00       	mov    $0x3,%eax
+  804a57:	e9 c9 00 00 00       	jmp    804b25 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804a5c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804a63:	00 
+
+  while (n) {
+  804a64:	e9 ad 00 00 00       	jmp    804b16 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804a69:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a6d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804a71:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804a78:	00 
+  804a79:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804a7d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a81:	48 39 c2             	cmp    %rax,%rdx
+  804a84:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804a88:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804a8c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804a90:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a94:	48 89 c6             	mov    %rax,%rsi
+  804a97:	48 b8 10 a0 80 00 00 	movabs $0x80a010,%rax
+  804a9e:	00 00 00 
+  804aa1:	48 89 c7             	mov    %rax,%rdi
+  804aa4:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  804aab:	00 00 00 
+  804aae:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804ab0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ab4:	8b 40 0c             	mov    0xc(%rax),%eax
+  804ab7:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804abe:	00 00 00 
+  804ac1:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  804ac3:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804aca:	00 00 00 
+  804acd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ad1:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  804ad5:	be 00 00 00 00       	mov    $0x0,%esi
+  804ada:	bf 04 00 00 00       	mov    $0x4,%edi
+  804adf:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804ae6:	00 00 00 
+  804ae9:	ff d0                	call   *%rax
+  804aeb:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804aee:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804af2:	79 07                	jns    804afb <devfile_write+0xcb>
+      return res;
+  804af4:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804af7:	48 98                	cltq
+  804af9:	eb 2a                	jmp    804b25 <devfile_write+0xf5>
+
+    buf += res;
+  804afb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804afe:	48 98                	cltq
+  804b00:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  804b04:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b07:	48 98                	cltq
+  804b09:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804b0d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804b10:	48 98                	cltq
+  804b12:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804b16:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804b1b:	0f 85 48 ff ff ff    	jne    804a69 <devfile_write+0x39>
+  }
+
+  return res0;
+  804b21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  804b25:	c9                   	leave
+  804b26:	c3                   	ret
+
+0000000000804b27 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804b27:	55                   	push   %rbp
+  804b28:	48 89 e5             	mov    %rsp,%rbp
+  804b2b:	48 83 ec 20          	sub    $0x20,%rsp
+  804b2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804b33:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804b37:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b3b:	8b 40 0c             	mov    0xc(%rax),%eax
+  804b3e:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804b45:	00 00 00 
+  804b48:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804b4a:	be 00 00 00 00       	mov    $0x0,%esi
+  804b4f:	bf 05 00 00 00       	mov    $0x5,%edi
+  804b54:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804b5b:	00 00 00 
+  804b5e:	ff d0                	call   *%rax
+  804b60:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b63:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b67:	79 05                	jns    804b6e <devfile_stat+0x47>
+    return r;
+  804b69:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b6c:	eb 59                	jmp    804bc7 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804b6e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b72:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804b79:	00 00 00 
+  804b7c:	48 89 d6             	mov    %rdx,%rsi
+  804b7f:	48 89 c7             	mov    %rax,%rdi
+  804b82:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  804b89:	00 00 00 
+  804b8c:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804b8e:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804b95:	00 00 00 
+  804b98:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804b9e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804ba2:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804ba8:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804baf:	00 00 00 
+  804bb2:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804bb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bbc:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  804bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804bc7:	c9                   	leave
+  804bc8:	c3                   	ret
+
+0000000000804bc9 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804bc9:	55                   	push   %rbp
+  804bca:	48 89 e5             	mov    %rsp,%rbp
+  804bcd:	48 83 ec 10          	sub    $0x10,%rsp
+  804bd1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804bd5:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804bd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bdc:	8b 40 0c             	mov    0xc(%rax),%eax
+  804bdf:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804be6:	00 00 00 
+  804be9:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804beb:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804bf2:	00 00 00 
+  804bf5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804bf8:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804bfb:	be 00 00 00 00       	mov    $0x0,%esi
+  804c00:	bf 02 00 00 00       	mov    $0x2,%edi
+  804c05:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804c0c:	00 00 00 
+  804c0f:	ff d0                	call   *%rax
+}
+  804c11:	c9                   	leave
+  804c12:	c3                   	ret
+
+0000000000804c13 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804c13:	55                   	push   %rbp
+  804c14:	48 89 e5             	mov    %rsp,%rbp
+  804c17:	48 83 ec 18          	sub    $0x18,%rsp
+  804c1b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804c1f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  804c22:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804c26:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804c29:	83 e0 03             	and    $0x3,%eax
+}
+  804c2c:	c9                   	leave
+  804c2d:	c3                   	ret
+
+0000000000804c2e <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804c2e:	55                   	push   %rbp
+  804c2f:	48 89 e5             	mov    %rsp,%rbp
+  804c32:	48 83 ec 10          	sub    $0x10,%rsp
+  804c36:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c3e:	48 89 c7             	mov    %rax,%rdi
+  804c41:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  804c48:	00 00 00 
+  804c4b:	ff d0                	call   *%rax
+  804c4d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  804c52:	7e 07                	jle    804c5b <remove+0x2d>
+    return -E_BAD_PATH;
+  804c54:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804c59:	eb 36                	jmp    804c91 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804c5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c5f:	48 89 c6             	mov    %rax,%rsi
+  804c62:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804c69:	00 00 00 
+  804c6c:	48 89 c7             	mov    %rax,%rdi
+  804c6f:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  804c76:	00 00 00 
+  804c79:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804c7b:	be 00 00 00 00       	mov    $0x0,%esi
+  804c80:	bf 07 00 00 00       	mov    $0x7,%edi
+  804c85:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804c8c:	00 00 00 
+  804c8f:	ff d0                	call   *%rax
+}
+  804c91:	c9                   	leave
+  804c92:	c3                   	ret
+
+0000000000804c93 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  804c93:	55                   	push   %rbp
+  804c94:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804c97:	be 00 00 00 00       	mov    $0x0,%esi
+  804c9c:	bf 08 00 00 00       	mov    $0x8,%edi
+  804ca1:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804ca8:	00 00 00 
+  804cab:	ff d0                	call   *%rax
+}
+  804cad:	5d                   	pop    %rbp
+  804cae:	c3                   	ret
+
+0000000000804caf <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804caf:	55                   	push   %rbp
+  804cb0:	48 89 e5             	mov    %rsp,%rbp
+  804cb3:	48 83 ec 20          	sub    $0x20,%rsp
+  804cb7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804cbb:	be 00 00 00 00       	mov    $0x0,%esi
+  804cc0:	bf 09 00 00 00       	mov    $0x9,%edi
+  804cc5:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804ccc:	00 00 00 
+  804ccf:	ff d0                	call   *%rax
+  804cd1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804cd4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804cd8:	79 05                	jns    804cdf <fs_stats+0x30>
+    return r;
+  804cda:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804cdd:	eb 2a                	jmp    804d09 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804cdf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ce3:	ba 68 00 00 00       	mov    $0x68,%edx
+  804ce8:	48 b9 00 a0 80 00 00 	movabs $0x80a000,%rcx
+  804cef:	00 00 00 
+  804cf2:	48 89 ce             	mov    %rcx,%rsi
+  804cf5:	48 89 c7             	mov    %rax,%rdi
+  804cf8:	48 b8 f4 20 80 00 00 	movabs $0x8020f4,%rax
+  804cff:	00 00 00 
+  804d02:	ff d0                	call   *%rax
+  return 0;
+  804d04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d09:	c9                   	leave
+  804d0a:	c3                   	ret
+
+0000000000804d0b <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804d0b:	55                   	push   %rbp
+  804d0c:	48 89 e5             	mov    %rsp,%rbp
+  804d0f:	48 83 ec 10          	sub    $0x10,%rsp
+  804d13:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804d16:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804d1d:	00 00 00 
+  804d20:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804d23:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804d25:	be 00 00 00 00       	mov    $0x0,%esi
+  804d2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804d2f:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804d36:	00 00 00 
+  804d39:	ff d0                	call   *%rax
+}
+  804d3b:	c9                   	leave
+  804d3c:	c3                   	ret
+
+0000000000804d3d <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804d3d:	55                   	push   %rbp
+  804d3e:	48 89 e5             	mov    %rsp,%rbp
+  804d41:	48 83 ec 10          	sub    $0x10,%rsp
+  804d45:	89 f8                	mov    %edi,%eax
+  804d47:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804d4a:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804d4e:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804d55:	00 00 00 
+  804d58:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804d5a:	be 00 00 00 00       	mov    $0x0,%esi
+  804d5f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804d64:	48 b8 b3 47 80 00 00 	movabs $0x8047b3,%rax
+  804d6b:	00 00 00 
+  804d6e:	ff d0                	call   *%rax
+}
+  804d70:	c9                   	leave
+  804d71:	c3                   	ret
+
+0000000000804d72 <spawn>:
+// prog: the pathname of the program to run.
+// argv: pointer to null-terminated array of pointers to strings,
+// 	 which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv) {
+  804d72:	55                   	push   %rbp
+  804d73:	48 89 e5             	mov    %rsp,%rbp
+  804d76:	53                   	push   %rbx
+  804d77:	48 81 ec 18 03 00 00 	sub    $0x318,%rsp
+  804d7e:	48 89 bd e8 fc ff ff 	mov    %rdi,-0x318(%rbp)
+  804d85:	48 89 b5 e0 fc ff ff 	mov    %rsi,-0x320(%rbp)
+  //   - Call sys_env_set_trapframe(child, &child_tf) to set up the
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  if ((r = open(prog, O_RDONLY)) < 0)
+  804d8c:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804d93:	be 00 00 00 00       	mov    $0x0,%esi
+  804d98:	48 89 c7             	mov    %rax,%rdi
+  804d9b:	48 b8 3a 48 80 00 00 	movabs $0x80483a,%rax
+  804da2:	00 00 00 
+  804da5:	ff d0                	call   *%rax
+  804da7:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804daa:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804dae:	79 08                	jns    804db8 <spawn+0x46>
+    return r;
+  804db0:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804db3:	e9 35 04 00 00       	jmp    8051ed <spawn+0x47b>
+  fd = r;
+  804db8:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804dbb:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+
+  // Read elf header
+  elf = (struct Elf *)elf_buf;
+  804dbe:	48 8d 85 b0 fd ff ff 	lea    -0x250(%rbp),%rax
+  804dc5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  804dc9:	48 8d 8d b0 fd ff ff 	lea    -0x250(%rbp),%rcx
+  804dd0:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804dd3:	ba 00 02 00 00       	mov    $0x200,%edx
+  804dd8:	48 89 ce             	mov    %rcx,%rsi
+  804ddb:	89 c7                	mov    %eax,%edi
+  804ddd:	48 b8 d4 3f 80 00 00 	movabs $0x803fd4,%rax
+  804de4:	00 00 00 
+  804de7:	ff d0                	call   *%rax
+  804de9:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  804def:	75 0d                	jne    804dfe <spawn+0x8c>
+  804df1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804df5:	8b 00                	mov    (%rax),%eax
+  804df7:	3d 7f 45 4c 46       	cmp    $0x464c457f,%eax
+  804dfc:	74 46                	je     804e44 <spawn+0xd2>
+    close(fd);
+  804dfe:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804e01:	89 c7                	mov    %eax,%edi
+  804e03:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  804e0a:	00 00 00 
+  804e0d:	ff d0                	call   *%rax
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  804e0f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e13:	8b 00                	mov    (%rax),%eax
+  804e15:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  804e1a:	89 c6                	mov    %eax,%esi
+  804e1c:	48 b8 88 7e 80 00 00 	movabs $0x807e88,%rax
+  804e23:	00 00 00 
+  804e26:	48 89 c7             	mov    %rax,%rdi
+  804e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e2e:	48 b9 01 0c 80 00 00 	movabs $0x800c01,%rcx
+  804e35:	00 00 00 
+  804e38:	ff d1                	call   *%rcx
+    return -E_NOT_EXEC;
+  804e3a:	b8 ef ff ff ff       	mov    $0xffffffef,%eax
+  804e3f:	e9 a9 03 00 00       	jmp    8051ed <spawn+0x47b>
+  __asm __volatile("int %2"
+  804e44:	b8 09 00 00 00       	mov    $0x9,%eax
+  804e49:	cd 30                	int    $0x30
+  804e4b:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  return ret;
+  804e4e:	8b 45 b4             	mov    -0x4c(%rbp),%eax
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  804e51:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804e54:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804e58:	79 08                	jns    804e62 <spawn+0xf0>
+    return r;
+  804e5a:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804e5d:	e9 8b 03 00 00       	jmp    8051ed <spawn+0x47b>
+  child = r;
+  804e62:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804e65:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+
+  // Set up trap frame, including initial stack.
+  child_tf        = envs[ENVX(child)].env_tf;
+  804e68:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804e6b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e70:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e77:	00 00 00 
+  804e7a:	48 98                	cltq
+  804e7c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e83:	48 01 d0             	add    %rdx,%rax
+  804e86:	48 8b 08             	mov    (%rax),%rcx
+  804e89:	48 8b 58 08          	mov    0x8(%rax),%rbx
+  804e8d:	48 89 8d f0 fc ff ff 	mov    %rcx,-0x310(%rbp)
+  804e94:	48 89 9d f8 fc ff ff 	mov    %rbx,-0x308(%rbp)
+  804e9b:	48 8b 48 10          	mov    0x10(%rax),%rcx
+  804e9f:	48 8b 58 18          	mov    0x18(%rax),%rbx
+  804ea3:	48 89 8d 00 fd ff ff 	mov    %rcx,-0x300(%rbp)
+  804eaa:	48 89 9d 08 fd ff ff 	mov    %rbx,-0x2f8(%rbp)
+  804eb1:	48 8b 48 20          	mov    0x20(%rax),%rcx
+  804eb5:	48 8b 58 28          	mov    0x28(%rax),%rbx
+  804eb9:	48 89 8d 10 fd ff ff 	mov    %rcx,-0x2f0(%rbp)
+  804ec0:	48 89 9d 18 fd ff ff 	mov    %rbx,-0x2e8(%rbp)
+  804ec7:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  804ecb:	48 8b 58 38          	mov    0x38(%rax),%rbx
+  804ecf:	48 89 8d 20 fd ff ff 	mov    %rcx,-0x2e0(%rbp)
+  804ed6:	48 89 9d 28 fd ff ff 	mov    %rbx,-0x2d8(%rbp)
+  804edd:	48 8b 48 40          	mov    0x40(%rax),%rcx
+  804ee1:	48 8b 58 48          	mov    0x48(%rax),%rbx
+  804ee5:	48 89 8d 30 fd ff ff 	mov    %rcx,-0x2d0(%rbp)
+  804eec:	48 89 9d 38 fd ff ff 	mov    %rbx,-0x2c8(%rbp)
+  804ef3:	48 8b 48 50          	mov    0x50(%rax),%rcx
+  804ef7:	48 8b 58 58          	mov    0x58(%rax),%rbx
+  804efb:	48 89 8d 40 fd ff ff 	mov    %rcx,-0x2c0(%rbp)
+  804f02:	48 89 9d 48 fd ff ff 	mov    %rbx,-0x2b8(%rbp)
+  804f09:	48 8b 48 60          	mov    0x60(%rax),%rcx
+  804f0d:	48 8b 58 68          	mov    0x68(%rax),%rbx
+  804f11:	48 89 8d 50 fd ff ff 	mov    %rcx,-0x2b0(%rbp)
+  804f18:	48 89 9d 58 fd ff ff 	mov    %rbx,-0x2a8(%rbp)
+  804f1f:	48 8b 48 70          	mov    0x70(%rax),%rcx
+  804f23:	48 8b 58 78          	mov    0x78(%rax),%rbx
+  804f27:	48 89 8d 60 fd ff ff 	mov    %rcx,-0x2a0(%rbp)
+  804f2e:	48 89 9d 68 fd ff ff 	mov    %rbx,-0x298(%rbp)
+  804f35:	48 8b 88 80 00 00 00 	mov    0x80(%rax),%rcx
+  804f3c:	48 8b 98 88 00 00 00 	mov    0x88(%rax),%rbx
+  804f43:	48 89 8d 70 fd ff ff 	mov    %rcx,-0x290(%rbp)
+  804f4a:	48 89 9d 78 fd ff ff 	mov    %rbx,-0x288(%rbp)
+  804f51:	48 8b 88 90 00 00 00 	mov    0x90(%rax),%rcx
+  804f58:	48 8b 98 98 00 00 00 	mov    0x98(%rax),%rbx
+  804f5f:	48 89 8d 80 fd ff ff 	mov    %rcx,-0x280(%rbp)
+  804f66:	48 89 9d 88 fd ff ff 	mov    %rbx,-0x278(%rbp)
+  804f6d:	48 8b 88 a0 00 00 00 	mov    0xa0(%rax),%rcx
+  804f74:	48 8b 98 a8 00 00 00 	mov    0xa8(%rax),%rbx
+  804f7b:	48 89 8d 90 fd ff ff 	mov    %rcx,-0x270(%rbp)
+  804f82:	48 89 9d 98 fd ff ff 	mov    %rbx,-0x268(%rbp)
+  804f89:	48 8b 90 b8 00 00 00 	mov    0xb8(%rax),%rdx
+  804f90:	48 8b 80 b0 00 00 00 	mov    0xb0(%rax),%rax
+  804f97:	48 89 85 a0 fd ff ff 	mov    %rax,-0x260(%rbp)
+  804f9e:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  child_tf.tf_rip = elf->e_entry;
+  804fa5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fa9:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804fad:	48 89 85 88 fd ff ff 	mov    %rax,-0x278(%rbp)
+
+  // *p to avoid "error: taking address of packed member of
+  //    ‘struct Trapframe’ may result in an unaligned pointer value"
+  void *p = &child_tf.tf_rsp;
+  804fb4:	48 8d 85 f0 fc ff ff 	lea    -0x310(%rbp),%rax
+  804fbb:	48 05 b0 00 00 00    	add    $0xb0,%rax
+  804fc1:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  if ((r = init_stack(child, argv, p)) < 0)
+  804fc5:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804fc9:	48 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%rcx
+  804fd0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804fd3:	48 89 ce             	mov    %rcx,%rsi
+  804fd6:	89 c7                	mov    %eax,%edi
+  804fd8:	48 b8 55 54 80 00 00 	movabs $0x805455,%rax
+  804fdf:	00 00 00 
+  804fe2:	ff d0                	call   *%rax
+  804fe4:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  804fe7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  804feb:	79 08                	jns    804ff5 <spawn+0x283>
+    return r;
+  804fed:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  804ff0:	e9 f8 01 00 00       	jmp    8051ed <spawn+0x47b>
+
+  // Set up program segments as defined in ELF header.
+  ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804ff5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ff9:	48 8b 40 20          	mov    0x20(%rax),%rax
+  804ffd:	48 8d 95 b0 fd ff ff 	lea    -0x250(%rbp),%rdx
+  805004:	48 01 d0             	add    %rdx,%rax
+  805007:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80500b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  805012:	e9 80 00 00 00       	jmp    805097 <spawn+0x325>
+    if (ph->p_type != ELF_PROG_LOAD)
+  805017:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80501b:	8b 00                	mov    (%rax),%eax
+  80501d:	83 f8 01             	cmp    $0x1,%eax
+  805020:	75 6b                	jne    80508d <spawn+0x31b>
+      continue;
+    perm = PTE_P | PTE_U;
+  805022:	c7 45 dc 05 00 00 00 	movl   $0x5,-0x24(%rbp)
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  805029:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80502d:	8b 40 04             	mov    0x4(%rax),%eax
+  805030:	83 e0 02             	and    $0x2,%eax
+  805033:	85 c0                	test   %eax,%eax
+  805035:	74 04                	je     80503b <spawn+0x2c9>
+      perm |= PTE_W;
+  805037:	83 4d dc 02          	orl    $0x2,-0x24(%rbp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+                         fd, ph->p_filesz, ph->p_offset, perm)) < 0)
+  80503b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80503f:	48 8b 40 08          	mov    0x8(%rax),%rax
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  805043:	41 89 c1             	mov    %eax,%r9d
+  805046:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80504a:	4c 8b 40 20          	mov    0x20(%rax),%r8
+  80504e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805052:	48 8b 50 28          	mov    0x28(%rax),%rdx
+  805056:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80505a:	48 8b 70 10          	mov    0x10(%rax),%rsi
+  80505e:	8b 4d d4             	mov    -0x2c(%rbp),%ecx
+  805061:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805064:	48 83 ec 08          	sub    $0x8,%rsp
+  805068:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80506b:	57                   	push   %rdi
+  80506c:	89 c7                	mov    %eax,%edi
+  80506e:	48 b8 9d 57 80 00 00 	movabs $0x80579d,%rax
+  805075:	00 00 00 
+  805078:	ff d0                	call   *%rax
+  80507a:	48 83 c4 10          	add    $0x10,%rsp
+  80507e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805081:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805085:	0f 88 3c 01 00 00    	js     8051c7 <spawn+0x455>
+  80508b:	eb 01                	jmp    80508e <spawn+0x31c>
+      continue;
+  80508d:	90                   	nop
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80508e:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  805092:	48 83 45 e0 38       	addq   $0x38,-0x20(%rbp)
+  805097:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80509b:	0f b7 40 38          	movzwl 0x38(%rax),%eax
+  80509f:	0f b7 c0             	movzwl %ax,%eax
+  8050a2:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8050a5:	0f 8c 6c ff ff ff    	jl     805017 <spawn+0x2a5>
+        goto error;
+    }
+  }
+#endif
+
+  close(fd);
+  8050ab:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8050ae:	89 c7                	mov    %eax,%edi
+  8050b0:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8050b7:	00 00 00 
+  8050ba:	ff d0                	call   *%rax
+  fd = -1;
+  8050bc:	c7 45 d4 ff ff ff ff 	movl   $0xffffffff,-0x2c(%rbp)
+
+  // Copy shared library state.
+  if ((r = copy_shared_pages(child)) < 0)
+  8050c3:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8050c6:	89 c7                	mov    %eax,%edi
+  8050c8:	48 b8 8b 59 80 00 00 	movabs $0x80598b,%rax
+  8050cf:	00 00 00 
+  8050d2:	ff d0                	call   *%rax
+  8050d4:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  8050d7:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8050db:	79 36                	jns    805113 <spawn+0x3a1>
+    panic("copy_shared_pages: %i", r);
+  8050dd:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8050e0:	89 c1                	mov    %eax,%ecx
+  8050e2:	48 b8 a2 7e 80 00 00 	movabs $0x807ea2,%rax
+  8050e9:	00 00 00 
+  8050ec:	48 89 c2             	mov    %rax,%rdx
+  8050ef:	be 9f 00 00 00       	mov    $0x9f,%esi
+  8050f4:	48 b8 b8 7e 80 00 00 	movabs $0x807eb8,%rax
+  8050fb:	00 00 00 
+  8050fe:	48 89 c7             	mov    %rax,%rdi
+  805101:	b8 00 00 00 00       	mov    $0x0,%eax
+  805106:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  80510d:	00 00 00 
+  805110:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
+  805113:	48 8d 95 f0 fc ff ff 	lea    -0x310(%rbp),%rdx
+  80511a:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80511d:	48 89 d6             	mov    %rdx,%rsi
+  805120:	89 c7                	mov    %eax,%edi
+  805122:	48 b8 d0 2a 80 00 00 	movabs $0x802ad0,%rax
+  805129:	00 00 00 
+  80512c:	ff d0                	call   *%rax
+  80512e:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805131:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  805135:	79 36                	jns    80516d <spawn+0x3fb>
+    panic("sys_env_set_trapframe: %i", r);
+  805137:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80513a:	89 c1                	mov    %eax,%ecx
+  80513c:	48 b8 c4 7e 80 00 00 	movabs $0x807ec4,%rax
+  805143:	00 00 00 
+  805146:	48 89 c2             	mov    %rax,%rdx
+  805149:	be a2 00 00 00       	mov    $0xa2,%esi
+  80514e:	48 b8 b8 7e 80 00 00 	movabs $0x807eb8,%rax
+  805155:	00 00 00 
+  805158:	48 89 c7             	mov    %rax,%rdi
+  80515b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805160:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  805167:	00 00 00 
+  80516a:	41 ff d0             	call   *%r8
+
+  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
+  80516d:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  805170:	be 02 00 00 00       	mov    $0x2,%esi
+  805175:	89 c7                	mov    %eax,%edi
+  805177:	48 b8 83 2a 80 00 00 	movabs $0x802a83,%rax
+  80517e:	00 00 00 
+  805181:	ff d0                	call   *%rax
+  805183:	89 45 d8             	mov    %eax,-0x28(%rbp)
+  805186:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80518a:	79 36                	jns    8051c2 <spawn+0x450>
+    panic("sys_env_set_status: %i", r);
+  80518c:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80518f:	89 c1                	mov    %eax,%ecx
+  805191:	48 b8 de 7e 80 00 00 	movabs $0x807ede,%rax
+  805198:	00 00 00 
+  80519b:	48 89 c2             	mov    %rax,%rdx
+  80519e:	be a5 00 00 00       	mov    $0xa5,%esi
+  8051a3:	48 b8 b8 7e 80 00 00 	movabs $0x807eb8,%rax
+  8051aa:	00 00 00 
+  8051ad:	48 89 c7             	mov    %rax,%rdi
+  8051b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051b5:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  8051bc:	00 00 00 
+  8051bf:	41 ff d0             	call   *%r8
+
+  return child;
+  8051c2:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8051c5:	eb 26                	jmp    8051ed <spawn+0x47b>
+      goto error;
+  8051c7:	90                   	nop
+
+error:
+  sys_env_destroy(child);
+  8051c8:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8051cb:	89 c7                	mov    %eax,%edi
+  8051cd:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  8051d4:	00 00 00 
+  8051d7:	ff d0                	call   *%rax
+  close(fd);
+  8051d9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8051dc:	89 c7                	mov    %eax,%edi
+  8051de:	48 b8 eb 3b 80 00 00 	movabs $0x803beb,%rax
+  8051e5:	00 00 00 
+  8051e8:	ff d0                	call   *%rax
+  return r;
+  8051ea:	8b 45 d8             	mov    -0x28(%rbp),%eax
+}
+  8051ed:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8051f1:	c9                   	leave
+  8051f2:	c3                   	ret
+
+00000000008051f3 <spawnl>:
+
+// Spawn, taking command-line arguments array directly on the stack.
+// NOTE: Must have a sentinal of NULL at the end of the args
+// (none of the args may be NULL).
+int
+spawnl(const char *prog, const char *arg0, ...) {
+  8051f3:	55                   	push   %rbp
+  8051f4:	48 89 e5             	mov    %rsp,%rbp
+  8051f7:	41 55                	push   %r13
+  8051f9:	41 54                	push   %r12
+  8051fb:	53                   	push   %rbx
+  8051fc:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  805203:	48 89 bd f8 fe ff ff 	mov    %rdi,-0x108(%rbp)
+  80520a:	48 89 b5 f0 fe ff ff 	mov    %rsi,-0x110(%rbp)
+  805211:	48 89 95 40 ff ff ff 	mov    %rdx,-0xc0(%rbp)
+  805218:	48 89 8d 48 ff ff ff 	mov    %rcx,-0xb8(%rbp)
+  80521f:	4c 89 85 50 ff ff ff 	mov    %r8,-0xb0(%rbp)
+  805226:	4c 89 8d 58 ff ff ff 	mov    %r9,-0xa8(%rbp)
+  80522d:	84 c0                	test   %al,%al
+  80522f:	74 26                	je     805257 <spawnl+0x64>
+  805231:	0f 29 85 60 ff ff ff 	movaps %xmm0,-0xa0(%rbp)
+  805238:	0f 29 8d 70 ff ff ff 	movaps %xmm1,-0x90(%rbp)
+  80523f:	0f 29 55 80          	movaps %xmm2,-0x80(%rbp)
+  805243:	0f 29 5d 90          	movaps %xmm3,-0x70(%rbp)
+  805247:	0f 29 65 a0          	movaps %xmm4,-0x60(%rbp)
+  80524b:	0f 29 6d b0          	movaps %xmm5,-0x50(%rbp)
+  80524f:	0f 29 75 c0          	movaps %xmm6,-0x40(%rbp)
+  805253:	0f 29 7d d0          	movaps %xmm7,-0x30(%rbp)
+  805257:	48 89 e0             	mov    %rsp,%rax
+  80525a:	48 89 c3             	mov    %rax,%rbx
+  // We calculate argc by advancing the args until we hit NULL.
+  // The contract of the function guarantees that the last
+  // argument will always be NULL, and that none of the other
+  // arguments will be NULL.
+  int argc = 0;
+  80525d:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%rbp)
+  805264:	00 00 00 
+  va_list vl;
+  va_start(vl, arg0);
+  805267:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  80526e:	00 00 00 
+  805271:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  805278:	00 00 00 
+  80527b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80527f:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  805286:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  80528d:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  805294:	eb 07                	jmp    80529d <spawnl+0xaa>
+    argc++;
+  805296:	83 85 2c ff ff ff 01 	addl   $0x1,-0xd4(%rbp)
+  while (va_arg(vl, void *) != NULL)
+  80529d:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  8052a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8052a6:	77 23                	ja     8052cb <spawnl+0xd8>
+  8052a8:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  8052af:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8052b5:	89 d2                	mov    %edx,%edx
+  8052b7:	48 01 d0             	add    %rdx,%rax
+  8052ba:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8052c0:	83 c2 08             	add    $0x8,%edx
+  8052c3:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  8052c9:	eb 12                	jmp    8052dd <spawnl+0xea>
+  8052cb:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8052d2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8052d6:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8052dd:	48 8b 00             	mov    (%rax),%rax
+  8052e0:	48 85 c0             	test   %rax,%rax
+  8052e3:	75 b1                	jne    805296 <spawnl+0xa3>
+  va_end(vl);
+
+  // Now that we have the size of the args, do a second pass
+  // and store the values in a VLA, which has the format of argv
+  const char *argv[argc + 2];
+  8052e5:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  8052eb:	83 c0 02             	add    $0x2,%eax
+  8052ee:	48 63 d0             	movslq %eax,%rdx
+  8052f1:	48 83 ea 01          	sub    $0x1,%rdx
+  8052f5:	48 89 95 20 ff ff ff 	mov    %rdx,-0xe0(%rbp)
+  8052fc:	48 63 d0             	movslq %eax,%rdx
+  8052ff:	49 89 d4             	mov    %rdx,%r12
+  805302:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  805308:	48 63 d0             	movslq %eax,%rdx
+  80530b:	49 89 d2             	mov    %rdx,%r10
+  80530e:	41 bb 00 00 00 00    	mov    $0x0,%r11d
+  805314:	48 98                	cltq
+  805316:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80531d:	00 
+  80531e:	b8 10 00 00 00       	mov    $0x10,%eax
+  805323:	48 83 e8 01          	sub    $0x1,%rax
+  805327:	48 01 d0             	add    %rdx,%rax
+  80532a:	be 10 00 00 00       	mov    $0x10,%esi
+  80532f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805334:	48 f7 f6             	div    %rsi
+  805337:	48 6b c0 10          	imul   $0x10,%rax,%rax
+  80533b:	48 29 c4             	sub    %rax,%rsp
+  80533e:	48 89 e0             	mov    %rsp,%rax
+  805341:	48 83 c0 07          	add    $0x7,%rax
+  805345:	48 c1 e8 03          	shr    $0x3,%rax
+  805349:	48 c1 e0 03          	shl    $0x3,%rax
+  80534d:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+  argv[0]        = arg0;
+  805354:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80535b:	48 8b 95 f0 fe ff ff 	mov    -0x110(%rbp),%rdx
+  805362:	48 89 10             	mov    %rdx,(%rax)
+  argv[argc + 1] = NULL;
+  805365:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80536b:	8d 50 01             	lea    0x1(%rax),%edx
+  80536e:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  805375:	48 63 d2             	movslq %edx,%rdx
+  805378:	48 c7 04 d0 00 00 00 	movq   $0x0,(%rax,%rdx,8)
+  80537f:	00 
+
+  va_start(vl, arg0);
+  805380:	c7 85 00 ff ff ff 10 	movl   $0x10,-0x100(%rbp)
+  805387:	00 00 00 
+  80538a:	c7 85 04 ff ff ff 30 	movl   $0x30,-0xfc(%rbp)
+  805391:	00 00 00 
+  805394:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805398:	48 89 85 08 ff ff ff 	mov    %rax,-0xf8(%rbp)
+  80539f:	48 8d 85 30 ff ff ff 	lea    -0xd0(%rbp),%rax
+  8053a6:	48 89 85 10 ff ff ff 	mov    %rax,-0xf0(%rbp)
+  unsigned i;
+  for (i = 0; i < argc; i++)
+  8053ad:	c7 85 28 ff ff ff 00 	movl   $0x0,-0xd8(%rbp)
+  8053b4:	00 00 00 
+  8053b7:	eb 60                	jmp    805419 <spawnl+0x226>
+    argv[i + 1] = va_arg(vl, const char *);
+  8053b9:	8b 85 28 ff ff ff    	mov    -0xd8(%rbp),%eax
+  8053bf:	8d 48 01             	lea    0x1(%rax),%ecx
+  8053c2:	8b 85 00 ff ff ff    	mov    -0x100(%rbp),%eax
+  8053c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8053cb:	77 23                	ja     8053f0 <spawnl+0x1fd>
+  8053cd:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  8053d4:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8053da:	89 d2                	mov    %edx,%edx
+  8053dc:	48 01 d0             	add    %rdx,%rax
+  8053df:	8b 95 00 ff ff ff    	mov    -0x100(%rbp),%edx
+  8053e5:	83 c2 08             	add    $0x8,%edx
+  8053e8:	89 95 00 ff ff ff    	mov    %edx,-0x100(%rbp)
+  8053ee:	eb 12                	jmp    805402 <spawnl+0x20f>
+  8053f0:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8053f7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8053fb:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  805402:	48 8b 10             	mov    (%rax),%rdx
+  805405:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80540c:	89 c9                	mov    %ecx,%ecx
+  80540e:	48 89 14 c8          	mov    %rdx,(%rax,%rcx,8)
+  for (i = 0; i < argc; i++)
+  805412:	83 85 28 ff ff ff 01 	addl   $0x1,-0xd8(%rbp)
+  805419:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80541f:	39 85 28 ff ff ff    	cmp    %eax,-0xd8(%rbp)
+  805425:	72 92                	jb     8053b9 <spawnl+0x1c6>
+  va_end(vl);
+  return spawn(prog, argv);
+  805427:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  80542e:	48 8b 85 f8 fe ff ff 	mov    -0x108(%rbp),%rax
+  805435:	48 89 d6             	mov    %rdx,%rsi
+  805438:	48 89 c7             	mov    %rax,%rdi
+  80543b:	48 b8 72 4d 80 00 00 	movabs $0x804d72,%rax
+  805442:	00 00 00 
+  805445:	ff d0                	call   *%rax
+  805447:	48 89 dc             	mov    %rbx,%rsp
+}
+  80544a:	48 8d 65 e8          	lea    -0x18(%rbp),%rsp
+  80544e:	5b                   	pop    %rbx
+  80544f:	41 5c                	pop    %r12
+  805451:	41 5d                	pop    %r13
+  805453:	5d                   	pop    %rbp
+  805454:	c3                   	ret
+
+0000000000805455 <init_stack>:
+//
+// On success, returns 0 and sets *init_esp
+// to the initial stack pointer with which the child should start.
+// Returns < 0 on failure.
+static int
+init_stack(envid_t child, const char **argv, uintptr_t *init_esp) {
+  805455:	55                   	push   %rbp
+  805456:	48 89 e5             	mov    %rsp,%rbp
+  805459:	48 83 ec 50          	sub    $0x50,%rsp
+  80545d:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  805460:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  805464:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  char *string_store;
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  805468:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80546f:	00 
+  for (argc = 0; argv[argc] != 0; argc++)
+  805470:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805477:	eb 33                	jmp    8054ac <init_stack+0x57>
+    string_size += strlen(argv[argc]) + 1;
+  805479:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80547c:	48 98                	cltq
+  80547e:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  805485:	00 
+  805486:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80548a:	48 01 d0             	add    %rdx,%rax
+  80548d:	48 8b 00             	mov    (%rax),%rax
+  805490:	48 89 c7             	mov    %rax,%rdi
+  805493:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  80549a:	00 00 00 
+  80549d:	ff d0                	call   *%rax
+  80549f:	83 c0 01             	add    $0x1,%eax
+  8054a2:	48 98                	cltq
+  8054a4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  for (argc = 0; argv[argc] != 0; argc++)
+  8054a8:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8054ac:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054af:	48 98                	cltq
+  8054b1:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8054b8:	00 
+  8054b9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8054bd:	48 01 d0             	add    %rdx,%rax
+  8054c0:	48 8b 00             	mov    (%rax),%rax
+  8054c3:	48 85 c0             	test   %rax,%rax
+  8054c6:	75 b1                	jne    805479 <init_stack+0x24>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - USTACKSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char *)UTEMP + USTACKSIZE - string_size;
+  8054c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054cc:	48 f7 d8             	neg    %rax
+  8054cf:	48 05 00 40 40 00    	add    $0x404000,%rax
+  8054d5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t *)(ROUNDDOWN(string_store, 8) - 8 * (argc + 1));
+  8054d9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054dd:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8054e1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8054e5:	48 83 e0 f8          	and    $0xfffffffffffffff8,%rax
+  8054e9:	48 89 c2             	mov    %rax,%rdx
+  8054ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054ef:	83 c0 01             	add    $0x1,%eax
+  8054f2:	c1 e0 03             	shl    $0x3,%eax
+  8054f5:	48 98                	cltq
+  8054f7:	48 f7 d8             	neg    %rax
+  8054fa:	48 01 d0             	add    %rdx,%rax
+  8054fd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void *)(argv_store - 2) < (void *)UTEMP)
+  805501:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805505:	48 83 e8 10          	sub    $0x10,%rax
+  805509:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  80550f:	77 0a                	ja     80551b <init_stack+0xc6>
+    return -E_NO_MEM;
+  805511:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  805516:	e9 80 02 00 00       	jmp    80579b <init_stack+0x346>
+
+  // Allocate the stack pages at UTEMP.
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  80551b:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  805522:	eb 3c                	jmp    805560 <init_stack+0x10b>
+    if ((r = sys_page_alloc(0, (void *)UTEMP + i, PTE_P | PTE_U | PTE_W)) < 0)
+  805524:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  805527:	48 98                	cltq
+  805529:	48 05 00 00 40 00    	add    $0x400000,%rax
+  80552f:	ba 07 00 00 00       	mov    $0x7,%edx
+  805534:	48 89 c6             	mov    %rax,%rsi
+  805537:	bf 00 00 00 00       	mov    $0x0,%edi
+  80553c:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  805543:	00 00 00 
+  805546:	ff d0                	call   *%rax
+  805548:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80554b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80554f:	79 08                	jns    805559 <init_stack+0x104>
+      return r;
+  805551:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805554:	e9 42 02 00 00       	jmp    80579b <init_stack+0x346>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  805559:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  805560:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  805567:	7e bb                	jle    805524 <init_stack+0xcf>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  805569:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  805570:	e9 8f 00 00 00       	jmp    805604 <init_stack+0x1af>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  805575:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  80557c:	00 00 00 
+  80557f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805583:	48 01 d0             	add    %rdx,%rax
+  805586:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  80558d:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  805590:	48 98                	cltq
+  805592:	48 8d 0c c5 00 00 00 	lea    0x0(,%rax,8),%rcx
+  805599:	00 
+  80559a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80559e:	48 01 c8             	add    %rcx,%rax
+  8055a1:	48 89 10             	mov    %rdx,(%rax)
+    strcpy(string_store, argv[i]);
+  8055a4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8055a7:	48 98                	cltq
+  8055a9:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8055b0:	00 
+  8055b1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055b5:	48 01 d0             	add    %rdx,%rax
+  8055b8:	48 8b 10             	mov    (%rax),%rdx
+  8055bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055bf:	48 89 d6             	mov    %rdx,%rsi
+  8055c2:	48 89 c7             	mov    %rax,%rdi
+  8055c5:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  8055cc:	00 00 00 
+  8055cf:	ff d0                	call   *%rax
+    string_store += strlen(argv[i]) + 1;
+  8055d1:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8055d4:	48 98                	cltq
+  8055d6:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8055dd:	00 
+  8055de:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055e2:	48 01 d0             	add    %rdx,%rax
+  8055e5:	48 8b 00             	mov    (%rax),%rax
+  8055e8:	48 89 c7             	mov    %rax,%rdi
+  8055eb:	48 b8 b0 1a 80 00 00 	movabs $0x801ab0,%rax
+  8055f2:	00 00 00 
+  8055f5:	ff d0                	call   *%rax
+  8055f7:	83 c0 01             	add    $0x1,%eax
+  8055fa:	48 98                	cltq
+  8055fc:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+  for (i = 0; i < argc; i++) {
+  805600:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+  805604:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  805607:	3b 45 f4             	cmp    -0xc(%rbp),%eax
+  80560a:	0f 8c 65 ff ff ff    	jl     805575 <init_stack+0x120>
+  }
+  argv_store[argc] = 0;
+  805610:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805613:	48 98                	cltq
+  805615:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  80561c:	00 
+  80561d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805621:	48 01 d0             	add    %rdx,%rax
+  805624:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  assert(string_store == (char *)UTEMP + USTACKSIZE);
+  80562b:	48 81 7d e0 00 40 40 	cmpq   $0x404000,-0x20(%rbp)
+  805632:	00 
+  805633:	74 3e                	je     805673 <init_stack+0x21e>
+  805635:	48 b8 f8 7e 80 00 00 	movabs $0x807ef8,%rax
+  80563c:	00 00 00 
+  80563f:	48 89 c1             	mov    %rax,%rcx
+  805642:	48 b8 23 7f 80 00 00 	movabs $0x807f23,%rax
+  805649:	00 00 00 
+  80564c:	48 89 c2             	mov    %rax,%rdx
+  80564f:	be 0c 01 00 00       	mov    $0x10c,%esi
+  805654:	48 b8 b8 7e 80 00 00 	movabs $0x807eb8,%rax
+  80565b:	00 00 00 
+  80565e:	48 89 c7             	mov    %rax,%rdi
+  805661:	b8 00 00 00 00       	mov    $0x0,%eax
+  805666:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  80566d:	00 00 00 
+  805670:	41 ff d0             	call   *%r8
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  805673:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  80567a:	00 00 00 
+  80567d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805681:	48 01 d0             	add    %rdx,%rax
+  805684:	48 8d 90 00 00 c0 ff 	lea    -0x400000(%rax),%rdx
+  80568b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80568f:	48 83 e8 08          	sub    $0x8,%rax
+  805693:	48 89 10             	mov    %rdx,(%rax)
+  argv_store[-2] = argc;
+  805696:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80569a:	48 8d 50 f0          	lea    -0x10(%rax),%rdx
+  80569e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8056a1:	48 98                	cltq
+  8056a3:	48 89 02             	mov    %rax,(%rdx)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8056a6:	48 ba f0 6f ff ff 7f 	movabs $0x7fffff6ff0,%rdx
+  8056ad:	00 00 00 
+  8056b0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8056b4:	48 01 d0             	add    %rdx,%rax
+  8056b7:	48 2d 00 00 40 00    	sub    $0x400000,%rax
+  8056bd:	48 89 c2             	mov    %rax,%rdx
+  8056c0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8056c4:	48 89 10             	mov    %rdx,(%rax)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  8056c7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  8056ce:	eb 78                	jmp    805748 <init_stack+0x2f3>
+    if ((r = sys_page_map(0, UTEMP + i, child, (void *)(USTACKTOP - USTACKSIZE + i), PTE_P | PTE_U | PTE_W)) < 0)
+  8056d0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8056d3:	48 98                	cltq
+  8056d5:	48 ba 00 70 ff ff 7f 	movabs $0x7fffff7000,%rdx
+  8056dc:	00 00 00 
+  8056df:	48 01 d0             	add    %rdx,%rax
+  8056e2:	48 89 c2             	mov    %rax,%rdx
+  8056e5:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8056e8:	48 98                	cltq
+  8056ea:	48 8d b0 00 00 40 00 	lea    0x400000(%rax),%rsi
+  8056f1:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8056f4:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  8056fa:	48 89 d1             	mov    %rdx,%rcx
+  8056fd:	89 c2                	mov    %eax,%edx
+  8056ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  805704:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  80570b:	00 00 00 
+  80570e:	ff d0                	call   *%rax
+  805710:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805713:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805717:	78 43                	js     80575c <init_stack+0x307>
+      goto error;
+    if ((r = sys_page_unmap(0, UTEMP + i)) < 0)
+  805719:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80571c:	48 98                	cltq
+  80571e:	48 05 00 00 40 00    	add    $0x400000,%rax
+  805724:	48 89 c6             	mov    %rax,%rsi
+  805727:	bf 00 00 00 00       	mov    $0x0,%edi
+  80572c:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  805733:	00 00 00 
+  805736:	ff d0                	call   *%rax
+  805738:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80573b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80573f:	78 1e                	js     80575f <init_stack+0x30a>
+  for (i = 0; i < USTACKSIZE; i += PGSIZE) {
+  805741:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  805748:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  80574f:	0f 8e 7b ff ff ff    	jle    8056d0 <init_stack+0x27b>
+      goto error;
+  }
+
+  return 0;
+  805755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80575a:	eb 3f                	jmp    80579b <init_stack+0x346>
+      goto error;
+  80575c:	90                   	nop
+  80575d:	eb 01                	jmp    805760 <init_stack+0x30b>
+      goto error;
+  80575f:	90                   	nop
+
+error:
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  805760:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+  805767:	eb 26                	jmp    80578f <init_stack+0x33a>
+    sys_page_unmap(0, UTEMP + i);
+  805769:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80576c:	48 98                	cltq
+  80576e:	48 05 00 00 40 00    	add    $0x400000,%rax
+  805774:	48 89 c6             	mov    %rax,%rsi
+  805777:	bf 00 00 00 00       	mov    $0x0,%edi
+  80577c:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  805783:	00 00 00 
+  805786:	ff d0                	call   *%rax
+  for (i = 0; i < USTACKSIZE; i += PGSIZE)
+  805788:	81 45 f0 00 10 00 00 	addl   $0x1000,-0x10(%rbp)
+  80578f:	81 7d f0 ff 3f 00 00 	cmpl   $0x3fff,-0x10(%rbp)
+  805796:	7e d1                	jle    805769 <init_stack+0x314>
+  return r;
+  805798:	8b 45 ec             	mov    -0x14(%rbp),%eax
+}
+  80579b:	c9                   	leave
+  80579c:	c3                   	ret
+
+000000000080579d <map_segment>:
+
+static int
+map_segment(envid_t child, uintptr_t va, size_t memsz,
+            int fd, size_t filesz, off_t fileoffset, int perm) {
+  80579d:	55                   	push   %rbp
+  80579e:	48 89 e5             	mov    %rsp,%rbp
+  8057a1:	48 83 ec 50          	sub    $0x50,%rsp
+  8057a5:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8057a8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8057ac:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8057b0:	89 4d d8             	mov    %ecx,-0x28(%rbp)
+  8057b3:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  8057b7:	44 89 4d bc          	mov    %r9d,-0x44(%rbp)
+  int i, r;
+
+  //cprintf("map_segment %x+%x\n", va, memsz);
+
+  if ((i = PGOFF(va))) {
+  8057bb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057bf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8057c4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8057c7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057cb:	74 21                	je     8057ee <map_segment+0x51>
+    va -= i;
+  8057cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057d0:	48 98                	cltq
+  8057d2:	48 29 45 d0          	sub    %rax,-0x30(%rbp)
+    memsz += i;
+  8057d6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057d9:	48 98                	cltq
+  8057db:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    filesz += i;
+  8057df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057e2:	48 98                	cltq
+  8057e4:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    fileoffset -= i;
+  8057e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057eb:	29 45 bc             	sub    %eax,-0x44(%rbp)
+  }
+
+  for (i = 0; i < memsz; i += PGSIZE) {
+  8057ee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8057f5:	e9 7b 01 00 00       	jmp    805975 <map_segment+0x1d8>
+    if (i >= filesz) {
+  8057fa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057fd:	48 98                	cltq
+  8057ff:	48 3b 45 c0          	cmp    -0x40(%rbp),%rax
+  805803:	72 3c                	jb     805841 <map_segment+0xa4>
+      // allocate a blank page
+      if ((r = sys_page_alloc(child, (void *)(va + i), perm)) < 0)
+  805805:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805808:	48 63 d0             	movslq %eax,%rdx
+  80580b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80580f:	48 01 d0             	add    %rdx,%rax
+  805812:	48 89 c1             	mov    %rax,%rcx
+  805815:	8b 55 10             	mov    0x10(%rbp),%edx
+  805818:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80581b:	48 89 ce             	mov    %rcx,%rsi
+  80581e:	89 c7                	mov    %eax,%edi
+  805820:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  805827:	00 00 00 
+  80582a:	ff d0                	call   *%rax
+  80582c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80582f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805833:	0f 89 35 01 00 00    	jns    80596e <map_segment+0x1d1>
+        return r;
+  805839:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80583c:	e9 48 01 00 00       	jmp    805989 <map_segment+0x1ec>
+    } else {
+      // from file
+      if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  805841:	ba 07 00 00 00       	mov    $0x7,%edx
+  805846:	be 00 00 40 00       	mov    $0x400000,%esi
+  80584b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805850:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  805857:	00 00 00 
+  80585a:	ff d0                	call   *%rax
+  80585c:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80585f:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805863:	79 08                	jns    80586d <map_segment+0xd0>
+        return r;
+  805865:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805868:	e9 1c 01 00 00       	jmp    805989 <map_segment+0x1ec>
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  80586d:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  805870:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805873:	01 c2                	add    %eax,%edx
+  805875:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  805878:	89 d6                	mov    %edx,%esi
+  80587a:	89 c7                	mov    %eax,%edi
+  80587c:	48 b8 4f 41 80 00 00 	movabs $0x80414f,%rax
+  805883:	00 00 00 
+  805886:	ff d0                	call   *%rax
+  805888:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80588b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80588f:	79 08                	jns    805899 <map_segment+0xfc>
+        return r;
+  805891:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805894:	e9 f0 00 00 00       	jmp    805989 <map_segment+0x1ec>
+      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz - i))) < 0)
+  805899:	c7 45 f4 00 10 00 00 	movl   $0x1000,-0xc(%rbp)
+  8058a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058a3:	48 98                	cltq
+  8058a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8058a9:	48 29 c2             	sub    %rax,%rdx
+  8058ac:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8058b0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8058b3:	48 63 d0             	movslq %eax,%rdx
+  8058b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8058ba:	48 39 c2             	cmp    %rax,%rdx
+  8058bd:	48 0f 47 d0          	cmova  %rax,%rdx
+  8058c1:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8058c4:	be 00 00 40 00       	mov    $0x400000,%esi
+  8058c9:	89 c7                	mov    %eax,%edi
+  8058cb:	48 b8 d4 3f 80 00 00 	movabs $0x803fd4,%rax
+  8058d2:	00 00 00 
+  8058d5:	ff d0                	call   *%rax
+  8058d7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8058da:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8058de:	79 08                	jns    8058e8 <map_segment+0x14b>
+        return r;
+  8058e0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8058e3:	e9 a1 00 00 00       	jmp    805989 <map_segment+0x1ec>
+      if ((r = sys_page_map(0, UTEMP, child, (void *)(va + i), perm)) < 0)
+  8058e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058eb:	48 63 d0             	movslq %eax,%rdx
+  8058ee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8058f2:	48 01 d0             	add    %rdx,%rax
+  8058f5:	48 89 c1             	mov    %rax,%rcx
+  8058f8:	8b 55 10             	mov    0x10(%rbp),%edx
+  8058fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8058fe:	41 89 d0             	mov    %edx,%r8d
+  805901:	89 c2                	mov    %eax,%edx
+  805903:	be 00 00 40 00       	mov    $0x400000,%esi
+  805908:	bf 00 00 00 00       	mov    $0x0,%edi
+  80590d:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  805914:	00 00 00 
+  805917:	ff d0                	call   *%rax
+  805919:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80591c:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  805920:	79 36                	jns    805958 <map_segment+0x1bb>
+        panic("spawn: sys_page_map data: %i", r);
+  805922:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805925:	89 c1                	mov    %eax,%ecx
+  805927:	48 b8 38 7f 80 00 00 	movabs $0x807f38,%rax
+  80592e:	00 00 00 
+  805931:	48 89 c2             	mov    %rax,%rdx
+  805934:	be 40 01 00 00       	mov    $0x140,%esi
+  805939:	48 b8 b8 7e 80 00 00 	movabs $0x807eb8,%rax
+  805940:	00 00 00 
+  805943:	48 89 c7             	mov    %rax,%rdi
+  805946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80594b:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  805952:	00 00 00 
+  805955:	41 ff d0             	call   *%r8
+      sys_page_unmap(0, UTEMP);
+  805958:	be 00 00 40 00       	mov    $0x400000,%esi
+  80595d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805962:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  805969:	00 00 00 
+  80596c:	ff d0                	call   *%rax
+  for (i = 0; i < memsz; i += PGSIZE) {
+  80596e:	81 45 fc 00 10 00 00 	addl   $0x1000,-0x4(%rbp)
+  805975:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805978:	48 98                	cltq
+  80597a:	48 3b 45 c8          	cmp    -0x38(%rbp),%rax
+  80597e:	0f 82 76 fe ff ff    	jb     8057fa <map_segment+0x5d>
+    }
+  }
+  return 0;
+  805984:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805989:	c9                   	leave
+  80598a:	c3                   	ret
+
+000000000080598b <copy_shared_pages>:
+
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child) {
+  80598b:	55                   	push   %rbp
+  80598c:	48 89 e5             	mov    %rsp,%rbp
+  80598f:	48 83 ec 20          	sub    $0x20,%rsp
+  805993:	89 7d ec             	mov    %edi,-0x14(%rbp)
+
+  int err = 0;
+  805996:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  80599d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8059a4:	00 
+  8059a5:	e9 e7 00 00 00       	jmp    805a91 <copy_shared_pages+0x106>
+    if (!(uvpml4e[VPML4E(i)] & PTE_P) || !(uvpde[VPDPE(i)] & PTE_P) || !(uvpd[VPD(i)] & PTE_P)) {
+  8059aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059ae:	48 c1 e8 27          	shr    $0x27,%rax
+  8059b2:	48 89 c2             	mov    %rax,%rdx
+  8059b5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8059bc:	01 00 00 
+  8059bf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8059c3:	83 e0 01             	and    $0x1,%eax
+  8059c6:	48 85 c0             	test   %rax,%rax
+  8059c9:	0f 84 b9 00 00 00    	je     805a88 <copy_shared_pages+0xfd>
+  8059cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059d3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8059d7:	48 89 c2             	mov    %rax,%rdx
+  8059da:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8059e1:	01 00 00 
+  8059e4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8059e8:	83 e0 01             	and    $0x1,%eax
+  8059eb:	48 85 c0             	test   %rax,%rax
+  8059ee:	0f 84 94 00 00 00    	je     805a88 <copy_shared_pages+0xfd>
+  8059f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8059f8:	48 c1 e8 15          	shr    $0x15,%rax
+  8059fc:	48 89 c2             	mov    %rax,%rdx
+  8059ff:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805a06:	01 00 00 
+  805a09:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805a0d:	83 e0 01             	and    $0x1,%eax
+  805a10:	48 85 c0             	test   %rax,%rax
+  805a13:	74 73                	je     805a88 <copy_shared_pages+0xfd>
+      continue;
+    }
+    if ((uvpt[VPN(i)] & (PTE_P | PTE_SHARE)) == (PTE_P | PTE_SHARE)) {
+  805a15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a19:	48 c1 e8 0c          	shr    $0xc,%rax
+  805a1d:	48 89 c2             	mov    %rax,%rdx
+  805a20:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805a27:	01 00 00 
+  805a2a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805a2e:	25 01 04 00 00       	and    $0x401,%eax
+  805a33:	48 3d 01 04 00 00    	cmp    $0x401,%rax
+  805a39:	75 4e                	jne    805a89 <copy_shared_pages+0xfe>
+      err = sys_page_map(0, (void *)i, child, (void *)i, uvpt[VPN(i)] & PTE_SYSCALL);
+  805a3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a3f:	48 c1 e8 0c          	shr    $0xc,%rax
+  805a43:	48 89 c2             	mov    %rax,%rdx
+  805a46:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805a4d:	01 00 00 
+  805a50:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805a54:	25 07 0e 00 00       	and    $0xe07,%eax
+  805a59:	89 c6                	mov    %eax,%esi
+  805a5b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  805a5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a63:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  805a66:	41 89 f0             	mov    %esi,%r8d
+  805a69:	48 89 c6             	mov    %rax,%rsi
+  805a6c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a71:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  805a78:	00 00 00 
+  805a7b:	ff d0                	call   *%rax
+  805a7d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+      if (err < 0)
+  805a80:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a84:	78 21                	js     805aa7 <copy_shared_pages+0x11c>
+  805a86:	eb 01                	jmp    805a89 <copy_shared_pages+0xfe>
+      continue;
+  805a88:	90                   	nop
+  for (size_t i = 0; i < UTOP; i += PGSIZE) {
+  805a89:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  805a90:	00 
+  805a91:	48 b8 ff ff ff ff 7f 	movabs $0x7fffffffff,%rax
+  805a98:	00 00 00 
+  805a9b:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805a9f:	0f 83 05 ff ff ff    	jae    8059aa <copy_shared_pages+0x1f>
+  805aa5:	eb 01                	jmp    805aa8 <copy_shared_pages+0x11d>
+        break;
+  805aa7:	90                   	nop
+    }
+  }
+  return err;
+  805aa8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805aab:	c9                   	leave
+  805aac:	c3                   	ret
+
+0000000000805aad <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  805aad:	55                   	push   %rbp
+  805aae:	48 89 e5             	mov    %rsp,%rbp
+  805ab1:	48 83 ec 10          	sub    $0x10,%rsp
+  805ab5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  805ab9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805abd:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  805ac2:	48 89 c7             	mov    %rax,%rdi
+  805ac5:	48 b8 d3 5a 80 00 00 	movabs $0x805ad3,%rax
+  805acc:	00 00 00 
+  805acf:	ff d0                	call   *%rax
+}
+  805ad1:	c9                   	leave
+  805ad2:	c3                   	ret
+
+0000000000805ad3 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  805ad3:	55                   	push   %rbp
+  805ad4:	48 89 e5             	mov    %rsp,%rbp
+  805ad7:	48 83 ec 50          	sub    $0x50,%rsp
+  805adb:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  805adf:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  805ae3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805aea:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  805aeb:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  805af0:	74 0a                	je     805afc <pipe_size+0x29>
+  805af2:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  805af9:	00 
+  805afa:	76 0a                	jbe    805b06 <pipe_size+0x33>
+    return -E_INVAL;
+  805afc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805b01:	e9 cc 02 00 00       	jmp    805dd2 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  805b06:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  805b0a:	48 89 c7             	mov    %rax,%rdi
+  805b0d:	48 b8 94 38 80 00 00 	movabs $0x803894,%rax
+  805b14:	00 00 00 
+  805b17:	ff d0                	call   *%rax
+  805b19:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b1c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b20:	0f 88 a8 02 00 00    	js     805dce <pipe_size+0x2fb>
+  805b26:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b2a:	ba 07 04 00 00       	mov    $0x407,%edx
+  805b2f:	48 89 c6             	mov    %rax,%rsi
+  805b32:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b37:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  805b3e:	00 00 00 
+  805b41:	ff d0                	call   *%rax
+  805b43:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b46:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b4a:	0f 88 7e 02 00 00    	js     805dce <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  805b50:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  805b54:	48 89 c7             	mov    %rax,%rdi
+  805b57:	48 b8 94 38 80 00 00 	movabs $0x803894,%rax
+  805b5e:	00 00 00 
+  805b61:	ff d0                	call   *%rax
+  805b63:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b6a:	0f 88 43 02 00 00    	js     805db3 <pipe_size+0x2e0>
+  805b70:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805b74:	ba 07 04 00 00       	mov    $0x407,%edx
+  805b79:	48 89 c6             	mov    %rax,%rsi
+  805b7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  805b81:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  805b88:	00 00 00 
+  805b8b:	ff d0                	call   *%rax
+  805b8d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b90:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b94:	0f 88 19 02 00 00    	js     805db3 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  805b9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805b9e:	48 89 c7             	mov    %rax,%rdi
+  805ba1:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  805ba8:	00 00 00 
+  805bab:	ff d0                	call   *%rax
+  805bad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  805bb1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  805bb8:	00 
+  805bb9:	e9 a2 00 00 00       	jmp    805c60 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  805bbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805bc2:	48 c1 e0 0c          	shl    $0xc,%rax
+  805bc6:	48 89 c2             	mov    %rax,%rdx
+  805bc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805bcd:	48 01 d0             	add    %rdx,%rax
+  805bd0:	ba 07 04 00 00       	mov    $0x407,%edx
+  805bd5:	48 89 c6             	mov    %rax,%rsi
+  805bd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  805bdd:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  805be4:	00 00 00 
+  805be7:	ff d0                	call   *%rax
+  805be9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805bec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805bf0:	0f 88 37 01 00 00    	js     805d2d <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  805bf6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805bfa:	48 89 c7             	mov    %rax,%rdi
+  805bfd:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  805c04:	00 00 00 
+  805c07:	ff d0                	call   *%rax
+  805c09:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805c0d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  805c11:	48 01 c2             	add    %rax,%rdx
+  805c14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805c18:	48 c1 e0 0c          	shl    $0xc,%rax
+  805c1c:	48 89 c1             	mov    %rax,%rcx
+  805c1f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c23:	48 01 c8             	add    %rcx,%rax
+  805c26:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  805c2c:	48 89 d1             	mov    %rdx,%rcx
+  805c2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c34:	48 89 c6             	mov    %rax,%rsi
+  805c37:	bf 00 00 00 00       	mov    $0x0,%edi
+  805c3c:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  805c43:	00 00 00 
+  805c46:	ff d0                	call   *%rax
+  805c48:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805c4b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805c4f:	79 0a                	jns    805c5b <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  805c51:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  805c56:	e9 d3 00 00 00       	jmp    805d2e <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  805c5b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  805c60:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  805c67:	00 
+  805c68:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  805c6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805c70:	48 01 d0             	add    %rdx,%rax
+  805c73:	48 83 c0 1f          	add    $0x1f,%rax
+  805c77:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  805c7b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805c84:	48 f7 75 e0          	divq   -0x20(%rbp)
+  805c88:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c8c:	48 29 d0             	sub    %rdx,%rax
+  805c8f:	48 c1 e8 0c          	shr    $0xc,%rax
+  805c93:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  805c97:	0f 82 21 ff ff ff    	jb     805bbe <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  805c9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ca1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  805ca5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805ca9:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  805cad:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  805cb1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805cb5:	48 ba c0 90 80 00 00 	movabs $0x8090c0,%rdx
+  805cbc:	00 00 00 
+  805cbf:	8b 12                	mov    (%rdx),%edx
+  805cc1:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  805cc3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805cc7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  805cce:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805cd2:	48 ba c0 90 80 00 00 	movabs $0x8090c0,%rdx
+  805cd9:	00 00 00 
+  805cdc:	8b 12                	mov    (%rdx),%edx
+  805cde:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  805ce0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805ce4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  805ceb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805cef:	48 89 c7             	mov    %rax,%rdi
+  805cf2:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  805cf9:	00 00 00 
+  805cfc:	ff d0                	call   *%rax
+  805cfe:	89 c2                	mov    %eax,%edx
+  805d00:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805d04:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  805d06:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d0a:	48 89 c7             	mov    %rax,%rdi
+  805d0d:	48 b8 46 38 80 00 00 	movabs $0x803846,%rax
+  805d14:	00 00 00 
+  805d17:	ff d0                	call   *%rax
+  805d19:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  805d1d:	48 83 c2 04          	add    $0x4,%rdx
+  805d21:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  805d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d28:	e9 a5 00 00 00       	jmp    805dd2 <pipe_size+0x2ff>
+      goto err2;
+  805d2d:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  805d2e:	eb 58                	jmp    805d88 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  805d30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d34:	48 c1 e0 0c          	shl    $0xc,%rax
+  805d38:	48 89 c2             	mov    %rax,%rdx
+  805d3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d3f:	48 01 d0             	add    %rdx,%rax
+  805d42:	48 89 c6             	mov    %rax,%rsi
+  805d45:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d4a:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  805d51:	00 00 00 
+  805d54:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  805d56:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d5a:	48 89 c7             	mov    %rax,%rdi
+  805d5d:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  805d64:	00 00 00 
+  805d67:	ff d0                	call   *%rax
+  805d69:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805d6d:	48 c1 e2 0c          	shl    $0xc,%rdx
+  805d71:	48 01 d0             	add    %rdx,%rax
+  805d74:	48 89 c6             	mov    %rax,%rsi
+  805d77:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d7c:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  805d83:	00 00 00 
+  805d86:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  805d88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805d8c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805d90:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  805d94:	48 85 c0             	test   %rax,%rax
+  805d97:	75 97                	jne    805d30 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  805d99:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  805d9d:	48 89 c6             	mov    %rax,%rsi
+  805da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  805da5:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  805dac:	00 00 00 
+  805daf:	ff d0                	call   *%rax
+  805db1:	eb 01                	jmp    805db4 <pipe_size+0x2e1>
+    goto err1;
+  805db3:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  805db4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805db8:	48 89 c6             	mov    %rax,%rsi
+  805dbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  805dc0:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  805dc7:	00 00 00 
+  805dca:	ff d0                	call   *%rax
+  805dcc:	eb 01                	jmp    805dcf <pipe_size+0x2fc>
+    goto err;
+  805dce:	90                   	nop
+err:
+  return r;
+  805dcf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805dd2:	c9                   	leave
+  805dd3:	c3                   	ret
+
+0000000000805dd4 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  805dd4:	55                   	push   %rbp
+  805dd5:	48 89 e5             	mov    %rsp,%rbp
+  805dd8:	53                   	push   %rbx
+  805dd9:	48 83 ec 28          	sub    $0x28,%rsp
+  805ddd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805de1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  805de5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805dec:	00 00 00 
+  805def:	8b 40 04             	mov    0x4(%rax),%eax
+  805df2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805df7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805dfe:	00 00 00 
+  805e01:	48 98                	cltq
+  805e03:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805e0a:	48 01 d0             	add    %rdx,%rax
+  805e0d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805e13:	8b 00                	mov    (%rax),%eax
+  805e15:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  805e18:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805e1c:	48 89 c7             	mov    %rax,%rdi
+  805e1f:	48 b8 90 6f 80 00 00 	movabs $0x806f90,%rax
+  805e26:	00 00 00 
+  805e29:	ff d0                	call   *%rax
+  805e2b:	89 c3                	mov    %eax,%ebx
+  805e2d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805e31:	48 89 c7             	mov    %rax,%rdi
+  805e34:	48 b8 90 6f 80 00 00 	movabs $0x806f90,%rax
+  805e3b:	00 00 00 
+  805e3e:	ff d0                	call   *%rax
+  805e40:	39 c3                	cmp    %eax,%ebx
+  805e42:	0f 94 c0             	sete   %al
+  805e45:	0f b6 c0             	movzbl %al,%eax
+  805e48:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  805e4b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e52:	00 00 00 
+  805e55:	8b 40 04             	mov    0x4(%rax),%eax
+  805e58:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805e5d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805e64:	00 00 00 
+  805e67:	48 98                	cltq
+  805e69:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805e70:	48 01 d0             	add    %rdx,%rax
+  805e73:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805e79:	8b 00                	mov    (%rax),%eax
+  805e7b:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  805e7e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e81:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805e84:	75 05                	jne    805e8b <_pipeisclosed+0xb7>
+      return ret;
+  805e86:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  805e89:	eb 68                	jmp    805ef3 <_pipeisclosed+0x11f>
+    if (n != nn)
+  805e8b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e8e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  805e91:	0f 84 4e ff ff ff    	je     805de5 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  805e97:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805e9e:	00 00 00 
+  805ea1:	8b 40 04             	mov    0x4(%rax),%eax
+  805ea4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805ea9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805eb0:	00 00 00 
+  805eb3:	48 98                	cltq
+  805eb5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ebc:	48 01 d0             	add    %rdx,%rax
+  805ebf:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  805ec5:	8b 10                	mov    (%rax),%edx
+  805ec7:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  805eca:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ecd:	89 c6                	mov    %eax,%esi
+  805ecf:	48 b8 60 7f 80 00 00 	movabs $0x807f60,%rax
+  805ed6:	00 00 00 
+  805ed9:	48 89 c7             	mov    %rax,%rdi
+  805edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  805ee1:	49 b8 01 0c 80 00 00 	movabs $0x800c01,%r8
+  805ee8:	00 00 00 
+  805eeb:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  805eee:	e9 f2 fe ff ff       	jmp    805de5 <_pipeisclosed+0x11>
+  }
+}
+  805ef3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805ef7:	c9                   	leave
+  805ef8:	c3                   	ret
+
+0000000000805ef9 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  805ef9:	55                   	push   %rbp
+  805efa:	48 89 e5             	mov    %rsp,%rbp
+  805efd:	48 83 ec 30          	sub    $0x30,%rsp
+  805f01:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805f04:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  805f08:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805f0b:	48 89 d6             	mov    %rdx,%rsi
+  805f0e:	89 c7                	mov    %eax,%edi
+  805f10:	48 b8 76 39 80 00 00 	movabs $0x803976,%rax
+  805f17:	00 00 00 
+  805f1a:	ff d0                	call   *%rax
+  805f1c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f1f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f23:	79 05                	jns    805f2a <pipeisclosed+0x31>
+    return r;
+  805f25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f28:	eb 31                	jmp    805f5b <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  805f2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f2e:	48 89 c7             	mov    %rax,%rdi
+  805f31:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  805f38:	00 00 00 
+  805f3b:	ff d0                	call   *%rax
+  805f3d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  805f41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805f45:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805f49:	48 89 d6             	mov    %rdx,%rsi
+  805f4c:	48 89 c7             	mov    %rax,%rdi
+  805f4f:	48 b8 d4 5d 80 00 00 	movabs $0x805dd4,%rax
+  805f56:	00 00 00 
+  805f59:	ff d0                	call   *%rax
+}
+  805f5b:	c9                   	leave
+  805f5c:	c3                   	ret
+
+0000000000805f5d <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  805f5d:	55                   	push   %rbp
+  805f5e:	48 89 e5             	mov    %rsp,%rbp
+  805f61:	48 83 ec 10          	sub    $0x10,%rsp
+  805f65:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  805f69:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f6d:	8b 40 18             	mov    0x18(%rax),%eax
+  805f70:	8d 50 01             	lea    0x1(%rax),%edx
+  805f73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f77:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  805f7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f7e:	8b 40 1c             	mov    0x1c(%rax),%eax
+  805f81:	85 c0                	test   %eax,%eax
+  805f83:	74 27                	je     805fac <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  805f85:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f89:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  805f90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f94:	48 83 c0 18          	add    $0x18,%rax
+  805f98:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  805f9d:	48 89 c7             	mov    %rax,%rdi
+  805fa0:	48 b8 7a 2d 80 00 00 	movabs $0x802d7a,%rax
+  805fa7:	00 00 00 
+  805faa:	ff d0                	call   *%rax
+  }
+}
+  805fac:	90                   	nop
+  805fad:	c9                   	leave
+  805fae:	c3                   	ret
+
+0000000000805faf <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  805faf:	55                   	push   %rbp
+  805fb0:	48 89 e5             	mov    %rsp,%rbp
+  805fb3:	48 83 ec 10          	sub    $0x10,%rsp
+  805fb7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805fbb:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  805fbe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805fc2:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  805fc9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805fcd:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  805fd1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805fd4:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805fdb:	89 c6                	mov    %eax,%esi
+  805fdd:	48 89 cf             	mov    %rcx,%rdi
+  805fe0:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  805fe7:	00 00 00 
+  805fea:	ff d0                	call   *%rax
+}
+  805fec:	90                   	nop
+  805fed:	c9                   	leave
+  805fee:	c3                   	ret
+
+0000000000805fef <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  805fef:	55                   	push   %rbp
+  805ff0:	48 89 e5             	mov    %rsp,%rbp
+  805ff3:	48 83 ec 70          	sub    $0x70,%rsp
+  805ff7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  805ffb:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  805fff:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  806003:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  806007:	48 89 c7             	mov    %rax,%rdi
+  80600a:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  806011:	00 00 00 
+  806014:	ff d0                	call   *%rax
+  806016:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  80601a:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80601f:	75 0a                	jne    80602b <devpipe_read+0x3c>
+    return 0;
+  806021:	b8 00 00 00 00       	mov    $0x0,%eax
+  806026:	e9 63 01 00 00       	jmp    80618e <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  80602b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80602f:	8b 40 18             	mov    0x18(%rax),%eax
+  806032:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  806035:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806039:	48 8b 10             	mov    (%rax),%rdx
+  80603c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806040:	48 8b 40 08          	mov    0x8(%rax),%rax
+  806044:	48 39 c2             	cmp    %rax,%rdx
+  806047:	75 42                	jne    80608b <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  806049:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80604d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  806051:	48 89 d6             	mov    %rdx,%rsi
+  806054:	48 89 c7             	mov    %rax,%rdi
+  806057:	48 b8 d4 5d 80 00 00 	movabs $0x805dd4,%rax
+  80605e:	00 00 00 
+  806061:	ff d0                	call   *%rax
+  806063:	85 c0                	test   %eax,%eax
+  806065:	74 0a                	je     806071 <devpipe_read+0x82>
+      return 0;
+  806067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80606c:	e9 1d 01 00 00       	jmp    80618e <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  806071:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  806074:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806078:	89 d6                	mov    %edx,%esi
+  80607a:	48 89 c7             	mov    %rax,%rdi
+  80607d:	48 b8 af 5f 80 00 00 	movabs $0x805faf,%rax
+  806084:	00 00 00 
+  806087:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  806089:	eb a0                	jmp    80602b <devpipe_read+0x3c>
+      break;
+  80608b:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80608c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  806090:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  806094:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  806098:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80609c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060a0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8060a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060a8:	48 8b 00             	mov    (%rax),%rax
+  8060ab:	48 29 c2             	sub    %rax,%rdx
+  8060ae:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8060b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8060b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060ba:	48 39 c2             	cmp    %rax,%rdx
+  8060bd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8060c1:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8060c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060c9:	48 8b 00             	mov    (%rax),%rax
+  8060cc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8060d0:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8060d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8060d9:	48 f7 f1             	div    %rcx
+  8060dc:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8060e0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8060e4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8060e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8060ec:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8060f0:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8060f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8060f8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8060fc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  806100:	48 39 c2             	cmp    %rax,%rdx
+  806103:	48 0f 46 c2          	cmovbe %rdx,%rax
+  806107:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  80610b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80610f:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  806113:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  806117:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80611b:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80611f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806123:	48 89 ce             	mov    %rcx,%rsi
+  806126:	48 89 c7             	mov    %rax,%rdi
+  806129:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  806130:	00 00 00 
+  806133:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  806135:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  806139:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80613d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  806141:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  806145:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  806149:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80614d:	48 01 d1             	add    %rdx,%rcx
+  806150:	48 89 c2             	mov    %rax,%rdx
+  806153:	48 89 cf             	mov    %rcx,%rdi
+  806156:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  80615d:	00 00 00 
+  806160:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  806162:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806166:	48 8b 10             	mov    (%rax),%rdx
+  806169:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80616d:	48 01 c2             	add    %rax,%rdx
+  806170:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806174:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  806177:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80617b:	48 89 c7             	mov    %rax,%rdi
+  80617e:	48 b8 5d 5f 80 00 00 	movabs $0x805f5d,%rax
+  806185:	00 00 00 
+  806188:	ff d0                	call   *%rax
+  return n;
+  80618a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80618e:	c9                   	leave
+  80618f:	c3                   	ret
+
+0000000000806190 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  806190:	55                   	push   %rbp
+  806191:	48 89 e5             	mov    %rsp,%rbp
+  806194:	48 83 ec 70          	sub    $0x70,%rsp
+  806198:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80619c:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8061a0:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8061a4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8061a8:	48 89 c7             	mov    %rax,%rdi
+  8061ab:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  8061b2:	00 00 00 
+  8061b5:	ff d0                	call   *%rax
+  8061b7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8061bb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8061bf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8061c3:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8061ca:	00 
+  8061cb:	e9 b8 01 00 00       	jmp    806388 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8061d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061d4:	8b 40 18             	mov    0x18(%rax),%eax
+  8061d7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8061da:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061de:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8061e2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061e6:	48 8b 00             	mov    (%rax),%rax
+  8061e9:	48 29 c2             	sub    %rax,%rdx
+  8061ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061f0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8061f4:	48 39 c2             	cmp    %rax,%rdx
+  8061f7:	75 4d                	jne    806246 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8061f9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8061fd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  806201:	48 89 d6             	mov    %rdx,%rsi
+  806204:	48 89 c7             	mov    %rax,%rdi
+  806207:	48 b8 d4 5d 80 00 00 	movabs $0x805dd4,%rax
+  80620e:	00 00 00 
+  806211:	ff d0                	call   *%rax
+  806213:	85 c0                	test   %eax,%eax
+  806215:	74 0a                	je     806221 <devpipe_write+0x91>
+        return 0;
+  806217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80621c:	e9 79 01 00 00       	jmp    80639a <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  806221:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  806224:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806228:	89 d6                	mov    %edx,%esi
+  80622a:	48 89 c7             	mov    %rax,%rdi
+  80622d:	48 b8 af 5f 80 00 00 	movabs $0x805faf,%rax
+  806234:	00 00 00 
+  806237:	ff d0                	call   *%rax
+      m = 0;
+  806239:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  806240:	00 
+      continue;
+  806241:	e9 3a 01 00 00       	jmp    806380 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  806246:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80624a:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80624e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  806252:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806256:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80625a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80625e:	48 8b 08             	mov    (%rax),%rcx
+  806261:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806265:	48 8b 40 08          	mov    0x8(%rax),%rax
+  806269:	48 29 c1             	sub    %rax,%rcx
+  80626c:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  806270:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  806274:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806278:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80627c:	48 39 c2             	cmp    %rax,%rdx
+  80627f:	48 0f 46 c2          	cmovbe %rdx,%rax
+  806283:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  806287:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80628b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80628f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806293:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  806297:	ba 00 00 00 00       	mov    $0x0,%edx
+  80629c:	48 f7 f1             	div    %rcx
+  80629f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8062a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8062a7:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8062ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062af:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8062b3:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8062b7:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8062bb:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8062bf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8062c3:	48 39 c2             	cmp    %rax,%rdx
+  8062c6:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8062ca:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8062ce:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8062d2:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8062d6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8062da:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8062de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8062e2:	48 01 d1             	add    %rdx,%rcx
+  8062e5:	48 89 c2             	mov    %rax,%rdx
+  8062e8:	48 89 cf             	mov    %rcx,%rdi
+  8062eb:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  8062f2:	00 00 00 
+  8062f5:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8062f7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8062fb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8062ff:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  806303:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  806307:	73 4d                	jae    806356 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  806309:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80630d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  806311:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  806315:	48 29 c2             	sub    %rax,%rdx
+  806318:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80631c:	48 01 c2             	add    %rax,%rdx
+  80631f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806323:	48 8b 40 10          	mov    0x10(%rax),%rax
+  806327:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80632b:	48 89 c1             	mov    %rax,%rcx
+  80632e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806332:	48 01 c1             	add    %rax,%rcx
+  806335:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806339:	48 01 c1             	add    %rax,%rcx
+  80633c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806340:	48 83 c0 20          	add    $0x20,%rax
+  806344:	48 89 ce             	mov    %rcx,%rsi
+  806347:	48 89 c7             	mov    %rax,%rdi
+  80634a:	48 b8 fa 22 80 00 00 	movabs $0x8022fa,%rax
+  806351:	00 00 00 
+  806354:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  806356:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80635a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80635e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806362:	48 01 c2             	add    %rax,%rdx
+  806365:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806369:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80636d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806371:	48 89 c7             	mov    %rax,%rdi
+  806374:	48 b8 5d 5f 80 00 00 	movabs $0x805f5d,%rax
+  80637b:	00 00 00 
+  80637e:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  806380:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806384:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  806388:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80638c:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  806390:	0f 82 3a fe ff ff    	jb     8061d0 <devpipe_write+0x40>
+  }
+
+  return i;
+  806396:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80639a:	c9                   	leave
+  80639b:	c3                   	ret
+
+000000000080639c <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80639c:	55                   	push   %rbp
+  80639d:	48 89 e5             	mov    %rsp,%rbp
+  8063a0:	48 83 ec 40          	sub    $0x40,%rsp
+  8063a4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8063a8:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8063ab:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8063af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063b3:	48 89 c7             	mov    %rax,%rdi
+  8063b6:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  8063bd:	00 00 00 
+  8063c0:	ff d0                	call   *%rax
+  8063c2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8063c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8063cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8063d1:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8063d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8063d9:	48 89 d6             	mov    %rdx,%rsi
+  8063dc:	48 89 c7             	mov    %rax,%rdi
+  8063df:	48 b8 3c 43 80 00 00 	movabs $0x80433c,%rax
+  8063e6:	00 00 00 
+  8063e9:	ff d0                	call   *%rax
+  8063eb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8063ee:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8063f2:	79 08                	jns    8063fc <devpipe_poll+0x60>
+    return r;
+  8063f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8063f7:	e9 85 00 00 00       	jmp    806481 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8063fc:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8063ff:	83 e0 01             	and    $0x1,%eax
+  806402:	85 c0                	test   %eax,%eax
+  806404:	74 18                	je     80641e <devpipe_poll+0x82>
+  806406:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80640a:	48 8b 10             	mov    (%rax),%rdx
+  80640d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806411:	48 8b 40 08          	mov    0x8(%rax),%rax
+  806415:	48 39 c2             	cmp    %rax,%rdx
+  806418:	74 04                	je     80641e <devpipe_poll+0x82>
+    revents |= POLLIN;
+  80641a:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80641e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  806421:	83 e0 02             	and    $0x2,%eax
+  806424:	85 c0                	test   %eax,%eax
+  806426:	74 23                	je     80644b <devpipe_poll+0xaf>
+  806428:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80642c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  806430:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806434:	48 8b 00             	mov    (%rax),%rax
+  806437:	48 29 c2             	sub    %rax,%rdx
+  80643a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80643e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  806442:	48 39 c2             	cmp    %rax,%rdx
+  806445:	73 04                	jae    80644b <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  806447:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  80644b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80644f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806453:	48 89 d6             	mov    %rdx,%rsi
+  806456:	48 89 c7             	mov    %rax,%rdi
+  806459:	48 b8 d4 5d 80 00 00 	movabs $0x805dd4,%rax
+  806460:	00 00 00 
+  806463:	ff d0                	call   *%rax
+  806465:	85 c0                	test   %eax,%eax
+  806467:	74 04                	je     80646d <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  806469:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80646d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806471:	75 0b                	jne    80647e <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  806473:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806477:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80647e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  806481:	c9                   	leave
+  806482:	c3                   	ret
+
+0000000000806483 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  806483:	55                   	push   %rbp
+  806484:	48 89 e5             	mov    %rsp,%rbp
+  806487:	48 83 ec 20          	sub    $0x20,%rsp
+  80648b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80648f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  806493:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806497:	48 89 c7             	mov    %rax,%rdi
+  80649a:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  8064a1:	00 00 00 
+  8064a4:	ff d0                	call   *%rax
+  8064a6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8064aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064ae:	48 ba 91 7f 80 00 00 	movabs $0x807f91,%rdx
+  8064b5:	00 00 00 
+  8064b8:	48 89 d6             	mov    %rdx,%rsi
+  8064bb:	48 89 c7             	mov    %rax,%rdi
+  8064be:	48 b8 b1 1b 80 00 00 	movabs $0x801bb1,%rax
+  8064c5:	00 00 00 
+  8064c8:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8064ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064ce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8064d2:	89 c1                	mov    %eax,%ecx
+  8064d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8064d8:	48 8b 00             	mov    (%rax),%rax
+  8064db:	89 c2                	mov    %eax,%edx
+  8064dd:	89 c8                	mov    %ecx,%eax
+  8064df:	29 d0                	sub    %edx,%eax
+  8064e1:	89 c2                	mov    %eax,%edx
+  8064e3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064e7:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8064ed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064f1:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8064f8:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8064fb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8064ff:	48 b9 c0 90 80 00 00 	movabs $0x8090c0,%rcx
+  806506:	00 00 00 
+  806509:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  806510:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806515:	c9                   	leave
+  806516:	c3                   	ret
+
+0000000000806517 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  806517:	55                   	push   %rbp
+  806518:	48 89 e5             	mov    %rsp,%rbp
+  80651b:	48 83 ec 40          	sub    $0x40,%rsp
+  80651f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  806523:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806527:	48 89 c7             	mov    %rax,%rdi
+  80652a:	48 b8 69 38 80 00 00 	movabs $0x803869,%rax
+  806531:	00 00 00 
+  806534:	ff d0                	call   *%rax
+  806536:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  80653a:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  806541:	00 
+  806542:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806546:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80654a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80654e:	48 01 d0             	add    %rdx,%rax
+  806551:	48 83 c0 1f          	add    $0x1f,%rax
+  806555:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  806559:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80655d:	ba 00 00 00 00       	mov    $0x0,%edx
+  806562:	48 f7 75 e8          	divq   -0x18(%rbp)
+  806566:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80656a:	48 29 d0             	sub    %rdx,%rax
+  80656d:	48 c1 e8 0c          	shr    $0xc,%rax
+  806571:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  806575:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  806579:	48 89 c6             	mov    %rax,%rsi
+  80657c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806581:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  806588:	00 00 00 
+  80658b:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80658d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806591:	48 89 c7             	mov    %rax,%rdi
+  806594:	48 b8 5d 5f 80 00 00 	movabs $0x805f5d,%rax
+  80659b:	00 00 00 
+  80659e:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8065a0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8065a4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8065a8:	eb 2f                	jmp    8065d9 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8065aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065ae:	48 83 e8 01          	sub    $0x1,%rax
+  8065b2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8065b6:	48 89 c2             	mov    %rax,%rdx
+  8065b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065bd:	48 01 d0             	add    %rdx,%rax
+  8065c0:	48 89 c6             	mov    %rax,%rsi
+  8065c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8065c8:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  8065cf:	00 00 00 
+  8065d2:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8065d4:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8065d9:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8065de:	77 ca                	ja     8065aa <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8065e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8065e4:	48 89 c6             	mov    %rax,%rsi
+  8065e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8065ec:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  8065f3:	00 00 00 
+  8065f6:	ff d0                	call   *%rax
+}
+  8065f8:	c9                   	leave
+  8065f9:	c3                   	ret
+
+00000000008065fa <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  8065fa:	55                   	push   %rbp
+  8065fb:	48 89 e5             	mov    %rsp,%rbp
+  8065fe:	48 83 ec 10          	sub    $0x10,%rsp
+  806602:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  806605:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806608:	be 00 00 00 00       	mov    $0x0,%esi
+  80660d:	89 c7                	mov    %eax,%edi
+  80660f:	48 b8 1e 66 80 00 00 	movabs $0x80661e,%rax
+  806616:	00 00 00 
+  806619:	ff d0                	call   *%rax
+}
+  80661b:	90                   	nop
+  80661c:	c9                   	leave
+  80661d:	c3                   	ret
+
+000000000080661e <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  80661e:	55                   	push   %rbp
+  80661f:	48 89 e5             	mov    %rsp,%rbp
+  806622:	48 83 ec 10          	sub    $0x10,%rsp
+  806626:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806629:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  80662d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806631:	75 3e                	jne    806671 <waitpid+0x53>
+  806633:	48 b8 98 7f 80 00 00 	movabs $0x807f98,%rax
+  80663a:	00 00 00 
+  80663d:	48 89 c1             	mov    %rax,%rcx
+  806640:	48 b8 a3 7f 80 00 00 	movabs $0x807fa3,%rax
+  806647:	00 00 00 
+  80664a:	48 89 c2             	mov    %rax,%rdx
+  80664d:	be 0e 00 00 00       	mov    $0xe,%esi
+  806652:	48 b8 b8 7f 80 00 00 	movabs $0x807fb8,%rax
+  806659:	00 00 00 
+  80665c:	48 89 c7             	mov    %rax,%rdi
+  80665f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806664:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  80666b:	00 00 00 
+  80666e:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  806671:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  806676:	74 0a                	je     806682 <waitpid+0x64>
+    *status = 0;
+  806678:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80667c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  806682:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806686:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806689:	48 89 d6             	mov    %rdx,%rsi
+  80668c:	89 c7                	mov    %eax,%edi
+  80668e:	48 b8 7e 28 80 00 00 	movabs $0x80287e,%rax
+  806695:	00 00 00 
+  806698:	ff d0                	call   *%rax
+}
+  80669a:	c9                   	leave
+  80669b:	c3                   	ret
+
+000000000080669c <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  80669c:	55                   	push   %rbp
+  80669d:	48 89 e5             	mov    %rsp,%rbp
+  8066a0:	48 83 ec 10          	sub    $0x10,%rsp
+  8066a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8066a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8066ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8066b0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8066b4:	48 89 c7             	mov    %rax,%rdi
+  8066b7:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8066b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066be:	48 b8 00 69 80 00 00 	movabs $0x806900,%rax
+  8066c5:	00 00 00 
+  8066c8:	ff d0                	call   *%rax
+}
+  8066ca:	90                   	nop
+  8066cb:	c9                   	leave
+  8066cc:	c3                   	ret
+
+00000000008066cd <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  8066cd:	55                   	push   %rbp
+  8066ce:	48 89 e5             	mov    %rsp,%rbp
+  8066d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8066d5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  8066d8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066db:	c1 e0 10             	shl    $0x10,%eax
+  8066de:	48 98                	cltq
+  8066e0:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8066e5:	48 01 d0             	add    %rdx,%rax
+  8066e8:	48 89 c6             	mov    %rax,%rsi
+  8066eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066f0:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  8066f7:	00 00 00 
+  8066fa:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8066fc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8066ff:	83 c0 01             	add    $0x1,%eax
+  806702:	c1 e0 10             	shl    $0x10,%eax
+  806705:	48 98                	cltq
+  806707:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  80670c:	48 01 d0             	add    %rdx,%rax
+  80670f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  806713:	eb 20                	jmp    806735 <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  806715:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806719:	48 89 c6             	mov    %rax,%rsi
+  80671c:	bf 00 00 00 00       	mov    $0x0,%edi
+  806721:	48 b8 37 2a 80 00 00 	movabs $0x802a37,%rax
+  806728:	00 00 00 
+  80672b:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  80672d:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  806734:	00 
+  806735:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806738:	83 c0 01             	add    $0x1,%eax
+  80673b:	c1 e0 10             	shl    $0x10,%eax
+  80673e:	48 98                	cltq
+  806740:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  806745:	48 01 d0             	add    %rdx,%rax
+  806748:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80674c:	72 c7                	jb     806715 <slot_unmap+0x48>
+}
+  80674e:	90                   	nop
+  80674f:	90                   	nop
+  806750:	c9                   	leave
+  806751:	c3                   	ret
+
+0000000000806752 <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  806752:	55                   	push   %rbp
+  806753:	48 89 e5             	mov    %rsp,%rbp
+  806756:	48 83 ec 30          	sub    $0x30,%rsp
+  80675a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80675e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  806762:	48 b8 20 b0 80 00 00 	movabs $0x80b020,%rax
+  806769:	00 00 00 
+  80676c:	48 89 c7             	mov    %rax,%rdi
+  80676f:	48 b8 11 71 80 00 00 	movabs $0x807111,%rax
+  806776:	00 00 00 
+  806779:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  80677b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  806782:	eb 04                	jmp    806788 <thread_create+0x36>
+  806784:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  806788:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  80678c:	7f 16                	jg     8067a4 <thread_create+0x52>
+  80678e:	48 ba 40 b0 80 00 00 	movabs $0x80b040,%rdx
+  806795:	00 00 00 
+  806798:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80679b:	48 98                	cltq
+  80679d:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8067a0:	85 c0                	test   %eax,%eax
+  8067a2:	75 e0                	jne    806784 <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8067a4:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8067a8:	75 0c                	jne    8067b6 <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8067aa:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8067b1:	e9 2c 01 00 00       	jmp    8068e2 <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8067b6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8067b9:	c1 e0 10             	shl    $0x10,%eax
+  8067bc:	48 98                	cltq
+  8067be:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8067c3:	48 01 d0             	add    %rdx,%rax
+  8067c6:	ba 07 00 00 00       	mov    $0x7,%edx
+  8067cb:	48 89 c6             	mov    %rax,%rsi
+  8067ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8067d3:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  8067da:	00 00 00 
+  8067dd:	ff d0                	call   *%rax
+  8067df:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8067e2:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8067e6:	0f 88 f5 00 00 00    	js     8068e1 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8067ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8067ef:	83 c0 01             	add    $0x1,%eax
+  8067f2:	c1 e0 10             	shl    $0x10,%eax
+  8067f5:	48 98                	cltq
+  8067f7:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  8067fc:	48 01 d0             	add    %rdx,%rax
+  8067ff:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  806803:	eb 32                	jmp    806837 <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  806805:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806809:	ba 07 00 00 00       	mov    $0x7,%edx
+  80680e:	48 89 c6             	mov    %rax,%rsi
+  806811:	bf 00 00 00 00       	mov    $0x0,%edi
+  806816:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  80681d:	00 00 00 
+  806820:	ff d0                	call   *%rax
+  806822:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  806825:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  806829:	0f 88 9e 00 00 00    	js     8068cd <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  80682f:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  806836:	00 
+  806837:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80683a:	83 c0 01             	add    $0x1,%eax
+  80683d:	c1 e0 10             	shl    $0x10,%eax
+  806840:	48 98                	cltq
+  806842:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  806847:	48 01 d0             	add    %rdx,%rax
+  80684a:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80684e:	72 b5                	jb     806805 <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  806850:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  806854:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  806858:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80685b:	c1 e2 10             	shl    $0x10,%edx
+  80685e:	48 63 d2             	movslq %edx,%rdx
+  806861:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  806866:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  806869:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  80686c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80686f:	83 c2 01             	add    $0x1,%edx
+  806872:	c1 e2 10             	shl    $0x10,%edx
+  806875:	48 63 d2             	movslq %edx,%rdx
+  806878:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  80687d:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  806880:	48 bf 9c 66 80 00 00 	movabs $0x80669c,%rdi
+  806887:	00 00 00 
+  80688a:	49 89 c8             	mov    %rcx,%r8
+  80688d:	48 89 c1             	mov    %rax,%rcx
+  806890:	4c 89 ca             	mov    %r9,%rdx
+  806893:	48 b8 1f 2e 80 00 00 	movabs $0x802e1f,%rax
+  80689a:	00 00 00 
+  80689d:	ff d0                	call   *%rax
+  80689f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  8068a2:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8068a6:	79 08                	jns    8068b0 <thread_create+0x15e>
+    r = id;
+  8068a8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068ab:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  8068ae:	eb 1e                	jmp    8068ce <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  8068b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8068b3:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8068b6:	48 b9 40 b0 80 00 00 	movabs $0x80b040,%rcx
+  8068bd:	00 00 00 
+  8068c0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8068c3:	48 98                	cltq
+  8068c5:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8068c8:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  8068cb:	eb 15                	jmp    8068e2 <thread_create+0x190>
+      goto fail;
+  8068cd:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  8068ce:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8068d1:	89 c7                	mov    %eax,%edi
+  8068d3:	48 b8 cd 66 80 00 00 	movabs $0x8066cd,%rax
+  8068da:	00 00 00 
+  8068dd:	ff d0                	call   *%rax
+  8068df:	eb 01                	jmp    8068e2 <thread_create+0x190>
+    goto out;
+  8068e1:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  8068e2:	48 b8 20 b0 80 00 00 	movabs $0x80b020,%rax
+  8068e9:	00 00 00 
+  8068ec:	48 89 c7             	mov    %rax,%rdi
+  8068ef:	48 b8 e6 71 80 00 00 	movabs $0x8071e6,%rax
+  8068f6:	00 00 00 
+  8068f9:	ff d0                	call   *%rax
+  return r;
+  8068fb:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8068fe:	c9                   	leave
+  8068ff:	c3                   	ret
+
+0000000000806900 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  806900:	55                   	push   %rbp
+  806901:	48 89 e5             	mov    %rsp,%rbp
+  806904:	48 83 ec 10          	sub    $0x10,%rsp
+  806908:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  80690b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80690e:	89 c7                	mov    %eax,%edi
+  806910:	48 b8 7c 2e 80 00 00 	movabs $0x802e7c,%rax
+  806917:	00 00 00 
+  80691a:	ff d0                	call   *%rax
+}
+  80691c:	90                   	nop
+  80691d:	c9                   	leave
+  80691e:	c3                   	ret
+
+000000000080691f <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  80691f:	55                   	push   %rbp
+  806920:	48 89 e5             	mov    %rsp,%rbp
+  806923:	48 83 ec 20          	sub    $0x20,%rsp
+  806927:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80692a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  80692e:	48 b8 20 b0 80 00 00 	movabs $0x80b020,%rax
+  806935:	00 00 00 
+  806938:	48 89 c7             	mov    %rax,%rdi
+  80693b:	48 b8 11 71 80 00 00 	movabs $0x807111,%rax
+  806942:	00 00 00 
+  806945:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  806947:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80694e:	eb 04                	jmp    806954 <thread_join+0x35>
+  806950:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806954:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  806958:	7f 17                	jg     806971 <thread_join+0x52>
+  80695a:	48 ba 40 b0 80 00 00 	movabs $0x80b040,%rdx
+  806961:	00 00 00 
+  806964:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806967:	48 98                	cltq
+  806969:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80696c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80696f:	75 df                	jne    806950 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  806971:	48 b8 20 b0 80 00 00 	movabs $0x80b020,%rax
+  806978:	00 00 00 
+  80697b:	48 89 c7             	mov    %rax,%rdi
+  80697e:	48 b8 e6 71 80 00 00 	movabs $0x8071e6,%rax
+  806985:	00 00 00 
+  806988:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  80698a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80698e:	74 06                	je     806996 <thread_join+0x77>
+  806990:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  806994:	75 07                	jne    80699d <thread_join+0x7e>
+    return -E_BAD_ENV;
+  806996:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  80699b:	eb 76                	jmp    806a13 <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  80699d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8069a1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8069a4:	48 89 d6             	mov    %rdx,%rsi
+  8069a7:	89 c7                	mov    %eax,%edi
+  8069a9:	48 b8 1e 66 80 00 00 	movabs $0x80661e,%rax
+  8069b0:	00 00 00 
+  8069b3:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  8069b5:	48 b8 20 b0 80 00 00 	movabs $0x80b020,%rax
+  8069bc:	00 00 00 
+  8069bf:	48 89 c7             	mov    %rax,%rdi
+  8069c2:	48 b8 11 71 80 00 00 	movabs $0x807111,%rax
+  8069c9:	00 00 00 
+  8069cc:	ff d0                	call   *%rax
+  slot_unmap(i);
+  8069ce:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8069d1:	89 c7                	mov    %eax,%edi
+  8069d3:	48 b8 cd 66 80 00 00 	movabs $0x8066cd,%rax
+  8069da:	00 00 00 
+  8069dd:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  8069df:	48 ba 40 b0 80 00 00 	movabs $0x80b040,%rdx
+  8069e6:	00 00 00 
+  8069e9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8069ec:	48 98                	cltq
+  8069ee:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  8069f5:	48 b8 20 b0 80 00 00 	movabs $0x80b020,%rax
+  8069fc:	00 00 00 
+  8069ff:	48 89 c7             	mov    %rax,%rdi
+  806a02:	48 b8 e6 71 80 00 00 	movabs $0x8071e6,%rax
+  806a09:	00 00 00 
+  806a0c:	ff d0                	call   *%rax
+  return 0;
+  806a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806a13:	c9                   	leave
+  806a14:	c3                   	ret
+
+0000000000806a15 <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  806a15:	55                   	push   %rbp
+  806a16:	48 89 e5             	mov    %rsp,%rbp
+  806a19:	48 83 ec 08          	sub    $0x8,%rsp
+  806a1d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  806a21:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  806a26:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  806a2a:	73 23                	jae    806a4f <thread_is_uxstack+0x3a>
+  806a2c:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  806a31:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  806a35:	72 18                	jb     806a4f <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  806a37:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806a3b:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  806a40:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  806a46:	75 07                	jne    806a4f <thread_is_uxstack+0x3a>
+  806a48:	b8 01 00 00 00       	mov    $0x1,%eax
+  806a4d:	eb 05                	jmp    806a54 <thread_is_uxstack+0x3f>
+  806a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  806a54:	83 e0 01             	and    $0x1,%eax
+}
+  806a57:	c9                   	leave
+  806a58:	c3                   	ret
+
+0000000000806a59 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  806a59:	55                   	push   %rbp
+  806a5a:	48 89 e5             	mov    %rsp,%rbp
+  806a5d:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  806a61:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806a68:	00 00 00 
+  806a6b:	8b 40 04             	mov    0x4(%rax),%eax
+  806a6e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806a73:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806a7a:	00 00 00 
+  806a7d:	48 98                	cltq
+  806a7f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806a86:	48 01 d0             	add    %rdx,%rax
+  806a89:	48 05 08 01 00 00    	add    $0x108,%rax
+  806a8f:	48 8b 00             	mov    (%rax),%rax
+  806a92:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  806a96:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  806a9b:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  806a9f:	73 0b                	jae    806aac <thread_pftemp+0x53>
+  806aa1:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  806aa6:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  806aaa:	73 07                	jae    806ab3 <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  806aac:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  806ab1:	eb 26                	jmp    806ad9 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  806ab3:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  806aba:	ff ff ff 
+  806abd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806ac1:	48 01 d0             	add    %rdx,%rax
+  806ac4:	48 c1 e8 10          	shr    $0x10,%rax
+  806ac8:	48 83 c0 01          	add    $0x1,%rax
+  806acc:	48 c1 e0 0c          	shl    $0xc,%rax
+  806ad0:	48 f7 d8             	neg    %rax
+  806ad3:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  806ad9:	c9                   	leave
+  806ada:	c3                   	ret
+
+0000000000806adb <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  806adb:	55                   	push   %rbp
+  806adc:	48 89 e5             	mov    %rsp,%rbp
+  806adf:	48 83 ec 08          	sub    $0x8,%rsp
+  806ae3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  806ae6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806aea:	75 10                	jne    806afc <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  806aec:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806af3:	00 00 00 
+  806af6:	8b 00                	mov    (%rax),%eax
+  806af8:	48 98                	cltq
+  806afa:	eb 05                	jmp    806b01 <vsyscall+0x26>
+  }
+  return 0;
+  806afc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806b01:	c9                   	leave
+  806b02:	c3                   	ret
+
+0000000000806b03 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  806b03:	55                   	push   %rbp
+  806b04:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  806b07:	bf 00 00 00 00       	mov    $0x0,%edi
+  806b0c:	48 b8 db 6a 80 00 00 	movabs $0x806adb,%rax
+  806b13:	00 00 00 
+  806b16:	ff d0                	call   *%rax
+}
+  806b18:	5d                   	pop    %rbp
+  806b19:	c3                   	ret
+
+0000000000806b1a <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  806b1a:	55                   	push   %rbp
+  806b1b:	48 89 e5             	mov    %rsp,%rbp
+  806b1e:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  806b22:	0f 31                	rdtsc
+  806b24:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  806b27:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  806b2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806b2d:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  806b30:	48 c1 e2 20          	shl    $0x20,%rdx
+  806b34:	48 09 d0             	or     %rdx,%rax
+  806b37:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  806b3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  806b3f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  806b43:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806b4a:	00 00 00 
+  806b4d:	8b 40 08             	mov    0x8(%rax),%eax
+  806b50:	48 98                	cltq
+  806b52:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  806b56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  806b5f:	48 f7 75 f0          	divq   -0x10(%rbp)
+  806b63:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  806b6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806b6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  806b73:	48 f7 75 f0          	divq   -0x10(%rbp)
+  806b77:	48 89 d0             	mov    %rdx,%rax
+  806b7a:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  806b81:	ba 00 00 00 00       	mov    $0x0,%edx
+  806b86:	48 f7 75 f0          	divq   -0x10(%rbp)
+  806b8a:	48 01 c8             	add    %rcx,%rax
+}
+  806b8d:	c9                   	leave
+  806b8e:	c3                   	ret
+
+0000000000806b8f <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  806b8f:	55                   	push   %rbp
+  806b90:	48 89 e5             	mov    %rsp,%rbp
+  806b93:	48 83 ec 20          	sub    $0x20,%rsp
+  806b97:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  806b9b:	48 b8 06 29 80 00 00 	movabs $0x802906,%rax
+  806ba2:	00 00 00 
+  806ba5:	ff d0                	call   *%rax
+  806ba7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  806baa:	48 b8 40 b1 80 00 00 	movabs $0x80b140,%rax
+  806bb1:	00 00 00 
+  806bb4:	48 8b 00             	mov    (%rax),%rax
+  806bb7:	48 85 c0             	test   %rax,%rax
+  806bba:	75 62                	jne    806c1e <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  806bbc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806bbf:	ba 07 00 00 00       	mov    $0x7,%edx
+  806bc4:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  806bcb:	00 00 00 
+  806bce:	48 89 ce             	mov    %rcx,%rsi
+  806bd1:	89 c7                	mov    %eax,%edi
+  806bd3:	48 b8 7f 29 80 00 00 	movabs $0x80297f,%rax
+  806bda:	00 00 00 
+  806bdd:	ff d0                	call   *%rax
+  806bdf:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  806be2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806be6:	79 36                	jns    806c1e <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  806be8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806beb:	89 c1                	mov    %eax,%ecx
+  806bed:	48 b8 c3 7f 80 00 00 	movabs $0x807fc3,%rax
+  806bf4:	00 00 00 
+  806bf7:	48 89 c2             	mov    %rax,%rdx
+  806bfa:	be 23 00 00 00       	mov    $0x23,%esi
+  806bff:	48 b8 db 7f 80 00 00 	movabs $0x807fdb,%rax
+  806c06:	00 00 00 
+  806c09:	48 89 c7             	mov    %rax,%rdi
+  806c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c11:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  806c18:	00 00 00 
+  806c1b:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  806c1e:	48 ba 40 b1 80 00 00 	movabs $0x80b140,%rdx
+  806c25:	00 00 00 
+  806c28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806c2c:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  806c2f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806c32:	48 ba 8f 6c 80 00 00 	movabs $0x806c8f,%rdx
+  806c39:	00 00 00 
+  806c3c:	48 89 d6             	mov    %rdx,%rsi
+  806c3f:	89 c7                	mov    %eax,%edi
+  806c41:	48 b8 1c 2b 80 00 00 	movabs $0x802b1c,%rax
+  806c48:	00 00 00 
+  806c4b:	ff d0                	call   *%rax
+  806c4d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  806c50:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806c54:	79 36                	jns    806c8c <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  806c56:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806c59:	89 c1                	mov    %eax,%ecx
+  806c5b:	48 b8 c3 7f 80 00 00 	movabs $0x807fc3,%rax
+  806c62:	00 00 00 
+  806c65:	48 89 c2             	mov    %rax,%rdx
+  806c68:	be 2b 00 00 00       	mov    $0x2b,%esi
+  806c6d:	48 b8 db 7f 80 00 00 	movabs $0x807fdb,%rax
+  806c74:	00 00 00 
+  806c77:	48 89 c7             	mov    %rax,%rdi
+  806c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c7f:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  806c86:	00 00 00 
+  806c89:	41 ff d0             	call   *%r8
+}
+  806c8c:	90                   	nop
+  806c8d:	c9                   	leave
+  806c8e:	c3                   	ret
+
+0000000000806c8f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  806c8f:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  806c92:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  806c95:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  806c9c:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  806ca0:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  806ca5:	48 a1 40 b1 80 00 00 	movabs 0x80b140,%rax
+  806cac:	00 00 00 
+	call *%rax
+  806caf:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  806cb1:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  806cb6:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  806cb9:	41 5f                	pop    %r15
+	popq %r15
+  806cbb:	41 5f                	pop    %r15
+	popq %r15
+  806cbd:	41 5f                	pop    %r15
+	popq %r14
+  806cbf:	41 5e                	pop    %r14
+	popq %r13
+  806cc1:	41 5d                	pop    %r13
+	popq %r12
+  806cc3:	41 5c                	pop    %r12
+	popq %r11
+  806cc5:	41 5b                	pop    %r11
+	popq %r10
+  806cc7:	41 5a                	pop    %r10
+	popq %r9
+  806cc9:	41 59                	pop    %r9
+	popq %r8
+  806ccb:	41 58                	pop    %r8
+	popq %rsi
+  806ccd:	5e                   	pop    %rsi
+	popq %rdi
+  806cce:	5f                   	pop    %rdi
+	popq %rbp
+  806ccf:	5d                   	pop    %rbp
+	popq %rdx
+  806cd0:	5a                   	pop    %rdx
+	popq %rcx
+  806cd1:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  806cd2:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  806cd7:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  806cdc:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  806ce0:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  806ce3:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  806ce8:	5b                   	pop    %rbx
+	popq %rax
+  806ce9:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  806cea:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  806cee:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  806cef:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  806cf4:	c3                   	ret
+
+0000000000806cf5 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  806cf5:	55                   	push   %rbp
+  806cf6:	48 89 e5             	mov    %rsp,%rbp
+  806cf9:	48 83 ec 20          	sub    $0x20,%rsp
+  806cfd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806d01:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  806d05:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  806d09:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806d0d:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  806d11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806d15:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  806d1c:	48 89 c7             	mov    %rax,%rdi
+  806d1f:	48 b8 2d 6d 80 00 00 	movabs $0x806d2d,%rax
+  806d26:	00 00 00 
+  806d29:	ff d0                	call   *%rax
+}
+  806d2b:	c9                   	leave
+  806d2c:	c3                   	ret
+
+0000000000806d2d <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  806d2d:	55                   	push   %rbp
+  806d2e:	48 89 e5             	mov    %rsp,%rbp
+  806d31:	48 83 ec 30          	sub    $0x30,%rsp
+  806d35:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806d39:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806d3d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  806d41:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  806d45:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806d4a:	75 0e                	jne    806d5a <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  806d4c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806d53:	00 00 00 
+  806d56:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  806d5a:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  806d5f:	75 18                	jne    806d79 <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  806d61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d65:	48 89 c7             	mov    %rax,%rdi
+  806d68:	48 b8 bf 2b 80 00 00 	movabs $0x802bbf,%rax
+  806d6f:	00 00 00 
+  806d72:	ff d0                	call   *%rax
+  806d74:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806d77:	eb 1d                	jmp    806d96 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  806d79:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806d7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d81:	48 89 d6             	mov    %rdx,%rsi
+  806d84:	48 89 c7             	mov    %rax,%rdi
+  806d87:	48 b8 05 2c 80 00 00 	movabs $0x802c05,%rax
+  806d8e:	00 00 00 
+  806d91:	ff d0                	call   *%rax
+  806d93:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  806d96:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806d9a:	79 2a                	jns    806dc6 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  806d9c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806da1:	74 0a                	je     806dad <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  806da3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806da7:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  806dad:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806db2:	74 0a                	je     806dbe <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  806db4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806db8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  806dbe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806dc1:	e9 aa 00 00 00       	jmp    806e70 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  806dc6:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806dcb:	74 36                	je     806e03 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  806dcd:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806dd4:	00 00 00 
+  806dd7:	8b 40 04             	mov    0x4(%rax),%eax
+  806dda:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806ddf:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806de6:	00 00 00 
+  806de9:	48 98                	cltq
+  806deb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806df2:	48 01 d0             	add    %rdx,%rax
+  806df5:	48 05 24 01 00 00    	add    $0x124,%rax
+  806dfb:	8b 10                	mov    (%rax),%edx
+  806dfd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806e01:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  806e03:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806e08:	74 36                	je     806e40 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  806e0a:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806e11:	00 00 00 
+  806e14:	8b 40 04             	mov    0x4(%rax),%eax
+  806e17:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806e1c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806e23:	00 00 00 
+  806e26:	48 98                	cltq
+  806e28:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806e2f:	48 01 d0             	add    %rdx,%rax
+  806e32:	48 05 28 01 00 00    	add    $0x128,%rax
+  806e38:	8b 10                	mov    (%rax),%edx
+  806e3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806e3e:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  806e40:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806e47:	00 00 00 
+  806e4a:	8b 40 04             	mov    0x4(%rax),%eax
+  806e4d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806e52:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806e59:	00 00 00 
+  806e5c:	48 98                	cltq
+  806e5e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806e65:	48 01 d0             	add    %rdx,%rax
+  806e68:	48 05 20 01 00 00    	add    $0x120,%rax
+  806e6e:	8b 00                	mov    (%rax),%eax
+  }
+}
+  806e70:	c9                   	leave
+  806e71:	c3                   	ret
+
+0000000000806e72 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  806e72:	55                   	push   %rbp
+  806e73:	48 89 e5             	mov    %rsp,%rbp
+  806e76:	48 83 ec 30          	sub    $0x30,%rsp
+  806e7a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806e7d:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806e80:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806e84:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  806e87:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806e8c:	75 5e                	jne    806eec <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  806e8e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806e95:	00 00 00 
+  806e98:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806e9c:	eb 4e                	jmp    806eec <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  806e9e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806ea2:	79 3c                	jns    806ee0 <ipc_send+0x6e>
+  806ea4:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  806ea8:	74 36                	je     806ee0 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  806eaa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806ead:	89 c1                	mov    %eax,%ecx
+  806eaf:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  806eb6:	00 00 00 
+  806eb9:	48 89 c2             	mov    %rax,%rdx
+  806ebc:	be 54 00 00 00       	mov    $0x54,%esi
+  806ec1:	48 b8 16 80 80 00 00 	movabs $0x808016,%rax
+  806ec8:	00 00 00 
+  806ecb:	48 89 c7             	mov    %rax,%rdi
+  806ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ed3:	49 b8 e2 09 80 00 00 	movabs $0x8009e2,%r8
+  806eda:	00 00 00 
+  806edd:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  806ee0:	48 b8 42 29 80 00 00 	movabs $0x802942,%rax
+  806ee7:	00 00 00 
+  806eea:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806eec:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806eef:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806ef2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  806ef6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  806ef9:	89 c7                	mov    %eax,%edi
+  806efb:	48 b8 68 2b 80 00 00 	movabs $0x802b68,%rax
+  806f02:	00 00 00 
+  806f05:	ff d0                	call   *%rax
+  806f07:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  806f0a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806f0e:	75 8e                	jne    806e9e <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  806f10:	48 b8 42 29 80 00 00 	movabs $0x802942,%rax
+  806f17:	00 00 00 
+  806f1a:	ff d0                	call   *%rax
+}
+  806f1c:	90                   	nop
+  806f1d:	c9                   	leave
+  806f1e:	c3                   	ret
+
+0000000000806f1f <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  806f1f:	55                   	push   %rbp
+  806f20:	48 89 e5             	mov    %rsp,%rbp
+  806f23:	48 83 ec 18          	sub    $0x18,%rsp
+  806f27:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  806f2a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806f31:	eb 4d                	jmp    806f80 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  806f33:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806f3a:	00 00 00 
+  806f3d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806f40:	48 98                	cltq
+  806f42:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806f49:	48 01 d0             	add    %rdx,%rax
+  806f4c:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  806f52:	8b 00                	mov    (%rax),%eax
+  806f54:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  806f57:	75 23                	jne    806f7c <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  806f59:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806f60:	00 00 00 
+  806f63:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806f66:	48 98                	cltq
+  806f68:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806f6f:	48 01 d0             	add    %rdx,%rax
+  806f72:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  806f78:	8b 00                	mov    (%rax),%eax
+  806f7a:	eb 12                	jmp    806f8e <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  806f7c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806f80:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  806f87:	7e aa                	jle    806f33 <ipc_find_env+0x14>
+  return 0;
+  806f89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806f8e:	c9                   	leave
+  806f8f:	c3                   	ret
+
+0000000000806f90 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  806f90:	55                   	push   %rbp
+  806f91:	48 89 e5             	mov    %rsp,%rbp
+  806f94:	48 83 ec 18          	sub    $0x18,%rsp
+  806f98:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806f9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806fa0:	48 c1 e8 27          	shr    $0x27,%rax
+  806fa4:	25 ff 01 00 00       	and    $0x1ff,%eax
+  806fa9:	48 89 c2             	mov    %rax,%rdx
+  806fac:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  806fb3:	01 00 00 
+  806fb6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806fba:	83 e0 01             	and    $0x1,%eax
+  806fbd:	48 85 c0             	test   %rax,%rax
+  806fc0:	74 63                	je     807025 <pageref+0x95>
+  806fc2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806fc6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  806fca:	48 89 c2             	mov    %rax,%rdx
+  806fcd:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  806fd4:	01 00 00 
+  806fd7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806fdb:	83 e0 01             	and    $0x1,%eax
+  806fde:	48 85 c0             	test   %rax,%rax
+  806fe1:	74 42                	je     807025 <pageref+0x95>
+  806fe3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806fe7:	48 c1 e8 15          	shr    $0x15,%rax
+  806feb:	48 89 c2             	mov    %rax,%rdx
+  806fee:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  806ff5:	01 00 00 
+  806ff8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806ffc:	83 e0 01             	and    $0x1,%eax
+  806fff:	48 85 c0             	test   %rax,%rax
+  807002:	74 21                	je     807025 <pageref+0x95>
+  807004:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807008:	48 c1 e8 0c          	shr    $0xc,%rax
+  80700c:	48 89 c2             	mov    %rax,%rdx
+  80700f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  807016:	01 00 00 
+  807019:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80701d:	83 e0 01             	and    $0x1,%eax
+  807020:	48 85 c0             	test   %rax,%rax
+  807023:	75 07                	jne    80702c <pageref+0x9c>
+    return 0;
+  807025:	b8 00 00 00 00       	mov    $0x0,%eax
+  80702a:	eb 53                	jmp    80707f <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  80702c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807030:	48 c1 e8 0c          	shr    $0xc,%rax
+  807034:	48 89 c2             	mov    %rax,%rdx
+  807037:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80703e:	01 00 00 
+  807041:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  807045:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  807049:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80704d:	83 e0 01             	and    $0x1,%eax
+  807050:	48 85 c0             	test   %rax,%rax
+  807053:	75 07                	jne    80705c <pageref+0xcc>
+    return 0;
+  807055:	b8 00 00 00 00       	mov    $0x0,%eax
+  80705a:	eb 23                	jmp    80707f <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  80705c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807060:	48 c1 e8 0c          	shr    $0xc,%rax
+  807064:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  80706b:	00 00 00 
+  80706e:	48 c1 e0 04          	shl    $0x4,%rax
+  807072:	48 01 d0             	add    %rdx,%rax
+  807075:	48 83 c0 08          	add    $0x8,%rax
+  807079:	0f b7 00             	movzwl (%rax),%eax
+  80707c:	0f b7 c0             	movzwl %ax,%eax
+}
+  80707f:	c9                   	leave
+  807080:	c3                   	ret
+
+0000000000807081 <xchg>:
+  807081:	55                   	push   %rbp
+  807082:	48 89 e5             	mov    %rsp,%rbp
+  807085:	48 83 ec 20          	sub    $0x20,%rsp
+  807089:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80708d:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  807090:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  807094:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  807097:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80709b:	f0 87 02             	lock xchg %eax,(%rdx)
+  80709e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8070a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8070a4:	c9                   	leave
+  8070a5:	c3                   	ret
+
+00000000008070a6 <cmpxchg>:
+  8070a6:	55                   	push   %rbp
+  8070a7:	48 89 e5             	mov    %rsp,%rbp
+  8070aa:	48 83 ec 20          	sub    $0x20,%rsp
+  8070ae:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8070b2:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8070b5:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  8070b8:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8070bc:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8070bf:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8070c2:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8070c6:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  8070ca:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8070cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8070d0:	c9                   	leave
+  8070d1:	c3                   	ret
+
+00000000008070d2 <xadd>:
+  8070d2:	55                   	push   %rbp
+  8070d3:	48 89 e5             	mov    %rsp,%rbp
+  8070d6:	48 83 ec 10          	sub    $0x10,%rsp
+  8070da:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8070de:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8070e1:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8070e5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8070e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8070ec:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  8070f0:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8070f3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8070f6:	c9                   	leave
+  8070f7:	c3                   	ret
+
+00000000008070f8 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  8070f8:	55                   	push   %rbp
+  8070f9:	48 89 e5             	mov    %rsp,%rbp
+  8070fc:	48 83 ec 08          	sub    $0x8,%rsp
+  807100:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  807104:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807108:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  80710e:	90                   	nop
+  80710f:	c9                   	leave
+  807110:	c3                   	ret
+
+0000000000807111 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  807111:	55                   	push   %rbp
+  807112:	48 89 e5             	mov    %rsp,%rbp
+  807115:	48 83 ec 20          	sub    $0x20,%rsp
+  807119:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  80711d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807121:	ba 01 00 00 00       	mov    $0x1,%edx
+  807126:	be 00 00 00 00       	mov    $0x0,%esi
+  80712b:	48 89 c7             	mov    %rax,%rdi
+  80712e:	48 b8 a6 70 80 00 00 	movabs $0x8070a6,%rax
+  807135:	00 00 00 
+  807138:	ff d0                	call   *%rax
+  80713a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80713d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807141:	74 65                	je     8071a8 <mutex_lock+0x97>
+  if (c != 2)
+  807143:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  807147:	74 57                	je     8071a0 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  807149:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80714d:	be 02 00 00 00       	mov    $0x2,%esi
+  807152:	48 89 c7             	mov    %rax,%rdi
+  807155:	48 b8 81 70 80 00 00 	movabs $0x807081,%rax
+  80715c:	00 00 00 
+  80715f:	ff d0                	call   *%rax
+  807161:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  807164:	eb 3a                	jmp    8071a0 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  807166:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80716a:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  807171:	be 02 00 00 00       	mov    $0x2,%esi
+  807176:	48 89 c7             	mov    %rax,%rdi
+  807179:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  807180:	00 00 00 
+  807183:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  807185:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807189:	be 02 00 00 00       	mov    $0x2,%esi
+  80718e:	48 89 c7             	mov    %rax,%rdi
+  807191:	48 b8 81 70 80 00 00 	movabs $0x807081,%rax
+  807198:	00 00 00 
+  80719b:	ff d0                	call   *%rax
+  80719d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8071a0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8071a4:	75 c0                	jne    807166 <mutex_lock+0x55>
+  8071a6:	eb 01                	jmp    8071a9 <mutex_lock+0x98>
+    return;
+  8071a8:	90                   	nop
+}
+  8071a9:	c9                   	leave
+  8071aa:	c3                   	ret
+
+00000000008071ab <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  8071ab:	55                   	push   %rbp
+  8071ac:	48 89 e5             	mov    %rsp,%rbp
+  8071af:	48 83 ec 08          	sub    $0x8,%rsp
+  8071b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  8071b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8071bb:	ba 01 00 00 00       	mov    $0x1,%edx
+  8071c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8071c5:	48 89 c7             	mov    %rax,%rdi
+  8071c8:	48 b8 a6 70 80 00 00 	movabs $0x8070a6,%rax
+  8071cf:	00 00 00 
+  8071d2:	ff d0                	call   *%rax
+  8071d4:	85 c0                	test   %eax,%eax
+  8071d6:	75 07                	jne    8071df <mutex_trylock+0x34>
+  8071d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8071dd:	eb 05                	jmp    8071e4 <mutex_trylock+0x39>
+  8071df:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  8071e4:	c9                   	leave
+  8071e5:	c3                   	ret
+
+00000000008071e6 <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  8071e6:	55                   	push   %rbp
+  8071e7:	48 89 e5             	mov    %rsp,%rbp
+  8071ea:	48 83 ec 10          	sub    $0x10,%rsp
+  8071ee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  8071f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8071f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8071fb:	48 89 c7             	mov    %rax,%rdi
+  8071fe:	48 b8 81 70 80 00 00 	movabs $0x807081,%rax
+  807205:	00 00 00 
+  807208:	ff d0                	call   *%rax
+  80720a:	83 f8 02             	cmp    $0x2,%eax
+  80720d:	75 18                	jne    807227 <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  80720f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807213:	be 01 00 00 00       	mov    $0x1,%esi
+  807218:	48 89 c7             	mov    %rax,%rdi
+  80721b:	48 b8 7a 2d 80 00 00 	movabs $0x802d7a,%rax
+  807222:	00 00 00 
+  807225:	ff d0                	call   *%rax
+}
+  807227:	90                   	nop
+  807228:	c9                   	leave
+  807229:	c3                   	ret
+
+000000000080722a <cond_init>:
+cond_init(struct Cond *c) {
+  80722a:	55                   	push   %rbp
+  80722b:	48 89 e5             	mov    %rsp,%rbp
+  80722e:	48 83 ec 08          	sub    $0x8,%rsp
+  807232:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  807236:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80723a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  807240:	90                   	nop
+  807241:	c9                   	leave
+  807242:	c3                   	ret
+
+0000000000807243 <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  807243:	55                   	push   %rbp
+  807244:	48 89 e5             	mov    %rsp,%rbp
+  807247:	48 83 ec 30          	sub    $0x30,%rsp
+  80724b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80724f:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  807253:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  807257:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80725b:	8b 00                	mov    (%rax),%eax
+  80725d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  807260:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807264:	48 89 c7             	mov    %rax,%rdi
+  807267:	48 b8 e6 71 80 00 00 	movabs $0x8071e6,%rax
+  80726e:	00 00 00 
+  807271:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  807273:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807277:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80727b:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  80727e:	89 ce                	mov    %ecx,%esi
+  807280:	48 89 c7             	mov    %rax,%rdi
+  807283:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  80728a:	00 00 00 
+  80728d:	ff d0                	call   *%rax
+  80728f:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  807292:	eb 1f                	jmp    8072b3 <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  807294:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  807298:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80729f:	be 02 00 00 00       	mov    $0x2,%esi
+  8072a4:	48 89 c7             	mov    %rax,%rdi
+  8072a7:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  8072ae:	00 00 00 
+  8072b1:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  8072b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8072b7:	be 02 00 00 00       	mov    $0x2,%esi
+  8072bc:	48 89 c7             	mov    %rax,%rdi
+  8072bf:	48 b8 81 70 80 00 00 	movabs $0x807081,%rax
+  8072c6:	00 00 00 
+  8072c9:	ff d0                	call   *%rax
+  8072cb:	85 c0                	test   %eax,%eax
+  8072cd:	75 c5                	jne    807294 <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  8072cf:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  8072d3:	75 07                	jne    8072dc <cond_timedwait+0x99>
+  8072d5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8072da:	eb 05                	jmp    8072e1 <cond_timedwait+0x9e>
+  8072dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8072e1:	c9                   	leave
+  8072e2:	c3                   	ret
+
+00000000008072e3 <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  8072e3:	55                   	push   %rbp
+  8072e4:	48 89 e5             	mov    %rsp,%rbp
+  8072e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8072eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8072ef:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  8072f3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8072f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8072fb:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  807302:	48 89 ce             	mov    %rcx,%rsi
+  807305:	48 89 c7             	mov    %rax,%rdi
+  807308:	48 b8 43 72 80 00 00 	movabs $0x807243,%rax
+  80730f:	00 00 00 
+  807312:	ff d0                	call   *%rax
+}
+  807314:	90                   	nop
+  807315:	c9                   	leave
+  807316:	c3                   	ret
+
+0000000000807317 <cond_signal>:
+cond_signal(struct Cond *c) {
+  807317:	55                   	push   %rbp
+  807318:	48 89 e5             	mov    %rsp,%rbp
+  80731b:	48 83 ec 10          	sub    $0x10,%rsp
+  80731f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  807323:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807327:	be 01 00 00 00       	mov    $0x1,%esi
+  80732c:	48 89 c7             	mov    %rax,%rdi
+  80732f:	48 b8 d2 70 80 00 00 	movabs $0x8070d2,%rax
+  807336:	00 00 00 
+  807339:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  80733b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80733f:	be 01 00 00 00       	mov    $0x1,%esi
+  807344:	48 89 c7             	mov    %rax,%rdi
+  807347:	48 b8 7a 2d 80 00 00 	movabs $0x802d7a,%rax
+  80734e:	00 00 00 
+  807351:	ff d0                	call   *%rax
+}
+  807353:	90                   	nop
+  807354:	c9                   	leave
+  807355:	c3                   	ret
+
+0000000000807356 <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  807356:	55                   	push   %rbp
+  807357:	48 89 e5             	mov    %rsp,%rbp
+  80735a:	48 83 ec 10          	sub    $0x10,%rsp
+  80735e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  807362:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807366:	be 01 00 00 00       	mov    $0x1,%esi
+  80736b:	48 89 c7             	mov    %rax,%rdi
+  80736e:	48 b8 d2 70 80 00 00 	movabs $0x8070d2,%rax
+  807375:	00 00 00 
+  807378:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  80737a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80737e:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  807383:	48 89 c7             	mov    %rax,%rdi
+  807386:	48 b8 7a 2d 80 00 00 	movabs $0x802d7a,%rax
+  80738d:	00 00 00 
+  807390:	ff d0                	call   *%rax
+}
+  807392:	90                   	nop
+  807393:	c9                   	leave
+  807394:	c3                   	ret
+
+0000000000807395 <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  807395:	55                   	push   %rbp
+  807396:	48 89 e5             	mov    %rsp,%rbp
+  807399:	48 83 ec 10          	sub    $0x10,%rsp
+  80739d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8073a1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  8073a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8073a8:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8073ab:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  8073ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8073b1:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  8073b8:	90                   	nop
+  8073b9:	c9                   	leave
+  8073ba:	c3                   	ret
+
+00000000008073bb <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  8073bb:	55                   	push   %rbp
+  8073bc:	48 89 e5             	mov    %rsp,%rbp
+  8073bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8073c3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  8073c7:	eb 2a                	jmp    8073f3 <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  8073c9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8073cc:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8073cf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8073d3:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8073d6:	89 ce                	mov    %ecx,%esi
+  8073d8:	48 89 c7             	mov    %rax,%rdi
+  8073db:	48 b8 a6 70 80 00 00 	movabs $0x8070a6,%rax
+  8073e2:	00 00 00 
+  8073e5:	ff d0                	call   *%rax
+  8073e7:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  8073ea:	75 07                	jne    8073f3 <sem_trywait+0x38>
+      return 0;
+  8073ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8073f1:	eb 14                	jmp    807407 <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  8073f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8073f7:	8b 00                	mov    (%rax),%eax
+  8073f9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8073fc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  807400:	75 c7                	jne    8073c9 <sem_trywait+0xe>
+  return -E_BUSY;
+  807402:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  807407:	c9                   	leave
+  807408:	c3                   	ret
+
+0000000000807409 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  807409:	55                   	push   %rbp
+  80740a:	48 89 e5             	mov    %rsp,%rbp
+  80740d:	48 83 ec 30          	sub    $0x30,%rsp
+  807411:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  807415:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  807419:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  807420:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  807421:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  807426:	0f 84 fb 00 00 00    	je     807527 <sem_timedwait+0x11e>
+  80742c:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  807431:	0f 84 f0 00 00 00    	je     807527 <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  807437:	48 b8 1a 6b 80 00 00 	movabs $0x806b1a,%rax
+  80743e:	00 00 00 
+  807441:	ff d0                	call   *%rax
+  807443:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  807447:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80744b:	48 f7 d0             	not    %rax
+  80744e:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  807452:	73 0d                	jae    807461 <sem_timedwait+0x58>
+  807454:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  807458:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80745c:	48 01 d0             	add    %rdx,%rax
+  80745f:	eb 07                	jmp    807468 <sem_timedwait+0x5f>
+  807461:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  807468:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  80746c:	e9 b6 00 00 00       	jmp    807527 <sem_timedwait+0x11e>
+    if (deadline) {
+  807471:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  807476:	74 2d                	je     8074a5 <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  807478:	48 b8 1a 6b 80 00 00 	movabs $0x806b1a,%rax
+  80747f:	00 00 00 
+  807482:	ff d0                	call   *%rax
+  807484:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  807488:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80748c:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  807490:	73 0a                	jae    80749c <sem_timedwait+0x93>
+  807492:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807496:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80749a:	eb 05                	jmp    8074a1 <sem_timedwait+0x98>
+  80749c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8074a1:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  8074a5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8074a9:	48 83 c0 04          	add    $0x4,%rax
+  8074ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8074b2:	48 89 c7             	mov    %rax,%rdi
+  8074b5:	48 b8 d2 70 80 00 00 	movabs $0x8070d2,%rax
+  8074bc:	00 00 00 
+  8074bf:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  8074c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8074c5:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8074c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8074ce:	48 89 c7             	mov    %rax,%rdi
+  8074d1:	48 b8 2b 2d 80 00 00 	movabs $0x802d2b,%rax
+  8074d8:	00 00 00 
+  8074db:	ff d0                	call   *%rax
+  8074dd:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  8074e0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8074e4:	48 83 c0 04          	add    $0x4,%rax
+  8074e8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8074ed:	48 89 c7             	mov    %rax,%rdi
+  8074f0:	48 b8 d2 70 80 00 00 	movabs $0x8070d2,%rax
+  8074f7:	00 00 00 
+  8074fa:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  8074fc:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  807500:	75 25                	jne    807527 <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  807502:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  807506:	48 89 c7             	mov    %rax,%rdi
+  807509:	48 b8 bb 73 80 00 00 	movabs $0x8073bb,%rax
+  807510:	00 00 00 
+  807513:	ff d0                	call   *%rax
+  807515:	85 c0                	test   %eax,%eax
+  807517:	79 07                	jns    807520 <sem_timedwait+0x117>
+  807519:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80751e:	eb 27                	jmp    807547 <sem_timedwait+0x13e>
+  807520:	b8 00 00 00 00       	mov    $0x0,%eax
+  807525:	eb 20                	jmp    807547 <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  807527:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80752b:	48 89 c7             	mov    %rax,%rdi
+  80752e:	48 b8 bb 73 80 00 00 	movabs $0x8073bb,%rax
+  807535:	00 00 00 
+  807538:	ff d0                	call   *%rax
+  80753a:	85 c0                	test   %eax,%eax
+  80753c:	0f 88 2f ff ff ff    	js     807471 <sem_timedwait+0x68>
+  return 0;
+  807542:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807547:	c9                   	leave
+  807548:	c3                   	ret
+
+0000000000807549 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  807549:	55                   	push   %rbp
+  80754a:	48 89 e5             	mov    %rsp,%rbp
+  80754d:	48 83 ec 10          	sub    $0x10,%rsp
+  807551:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  807555:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807559:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  807560:	48 89 c7             	mov    %rax,%rdi
+  807563:	48 b8 09 74 80 00 00 	movabs $0x807409,%rax
+  80756a:	00 00 00 
+  80756d:	ff d0                	call   *%rax
+}
+  80756f:	90                   	nop
+  807570:	c9                   	leave
+  807571:	c3                   	ret
+
+0000000000807572 <sem_post>:
+sem_post(struct Semaphore *s) {
+  807572:	55                   	push   %rbp
+  807573:	48 89 e5             	mov    %rsp,%rbp
+  807576:	48 83 ec 10          	sub    $0x10,%rsp
+  80757a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  80757e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  807582:	be 01 00 00 00       	mov    $0x1,%esi
+  807587:	48 89 c7             	mov    %rax,%rdi
+  80758a:	48 b8 d2 70 80 00 00 	movabs $0x8070d2,%rax
+  807591:	00 00 00 
+  807594:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  807596:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80759a:	8b 40 04             	mov    0x4(%rax),%eax
+  80759d:	85 c0                	test   %eax,%eax
+  80759f:	74 18                	je     8075b9 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  8075a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8075a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8075aa:	48 89 c7             	mov    %rax,%rdi
+  8075ad:	48 b8 7a 2d 80 00 00 	movabs $0x802d7a,%rax
+  8075b4:	00 00 00 
+  8075b7:	ff d0                	call   *%rax
+}
+  8075b9:	90                   	nop
+  8075ba:	c9                   	leave
+  8075bb:	c3                   	ret
@@ -0,0 +1,9146 @@
+
+obj/user/teststring:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 d9 0d 00 00       	call   800e05 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <fill>:
+static uint8_t buf[BUFSIZE] __attribute__((aligned(64)));
+static uint8_t ref[BUFSIZE] __attribute__((aligned(64)));
+static uint8_t src[BUFSIZE] __attribute__((aligned(64)));
+
+static void
+fill(uint8_t *p, uint8_t seed) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80003e:	89 f0                	mov    %esi,%eax
+  800040:	88 45 e4             	mov    %al,-0x1c(%rbp)
+  int i;
+
+  for (i = 0; i < BUFSIZE; i++)
+  800043:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80004a:	eb 27                	jmp    800073 <fill+0x41>
+    p[i] = seed + i * 7;
+  80004c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80004f:	89 c2                	mov    %eax,%edx
+  800051:	89 d0                	mov    %edx,%eax
+  800053:	c1 e0 03             	shl    $0x3,%eax
+  800056:	29 d0                	sub    %edx,%eax
+  800058:	89 c1                	mov    %eax,%ecx
+  80005a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80005d:	48 63 d0             	movslq %eax,%rdx
+  800060:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800064:	48 01 d0             	add    %rdx,%rax
+  800067:	0f b6 55 e4          	movzbl -0x1c(%rbp),%edx
+  80006b:	01 ca                	add    %ecx,%edx
+  80006d:	88 10                	mov    %dl,(%rax)
+  for (i = 0; i < BUFSIZE; i++)
+  80006f:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800073:	81 7d fc ff 01 00 00 	cmpl   $0x1ff,-0x4(%rbp)
+  80007a:	7e d0                	jle    80004c <fill+0x1a>
+}
+  80007c:	90                   	nop
+  80007d:	90                   	nop
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+0000000000800080 <check>:
+
+static void
+check(const char *what, size_t off, size_t len) {
+  800080:	55                   	push   %rbp
+  800081:	48 89 e5             	mov    %rsp,%rbp
+  800084:	48 83 ec 30          	sub    $0x30,%rsp
+  800088:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80008c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  800090:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int i;
+
+  for (i = 0; i < BUFSIZE; i++) {
+  800094:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80009b:	e9 aa 00 00 00       	jmp    80014a <check+0xca>
+    if (buf[i] != ref[i])
+  8000a0:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8000a7:	00 00 00 
+  8000aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000ad:	48 98                	cltq
+  8000af:	0f b6 14 02          	movzbl (%rdx,%rax,1),%edx
+  8000b3:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  8000ba:	00 00 00 
+  8000bd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000c0:	48 98                	cltq
+  8000c2:	0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+  8000c6:	38 c2                	cmp    %al,%dl
+  8000c8:	74 7c                	je     800146 <check+0xc6>
+      panic("%s off %ld len %ld: byte %d is 0x%x, not 0x%x",
+  8000ca:	48 ba 00 82 80 00 00 	movabs $0x808200,%rdx
+  8000d1:	00 00 00 
+  8000d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000d7:	48 98                	cltq
+  8000d9:	0f b6 04 02          	movzbl (%rdx,%rax,1),%eax
+  8000dd:	0f b6 c8             	movzbl %al,%ecx
+  8000e0:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8000e7:	00 00 00 
+  8000ea:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000ed:	48 98                	cltq
+  8000ef:	0f b6 04 02          	movzbl (%rdx,%rax,1),%eax
+  8000f3:	0f b6 d0             	movzbl %al,%edx
+  8000f6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8000fa:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  8000fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800102:	48 83 ec 08          	sub    $0x8,%rsp
+  800106:	51                   	push   %rcx
+  800107:	52                   	push   %rdx
+  800108:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80010b:	52                   	push   %rdx
+  80010c:	49 89 f9             	mov    %rdi,%r9
+  80010f:	49 89 f0             	mov    %rsi,%r8
+  800112:	48 89 c1             	mov    %rax,%rcx
+  800115:	48 b8 28 5e 80 00 00 	movabs $0x805e28,%rax
+  80011c:	00 00 00 
+  80011f:	48 89 c2             	mov    %rax,%rdx
+  800122:	be 20 00 00 00       	mov    $0x20,%esi
+  800127:	48 b8 56 5e 80 00 00 	movabs $0x805e56,%rax
+  80012e:	00 00 00 
+  800131:	48 89 c7             	mov    %rax,%rdi
+  800134:	b8 00 00 00 00       	mov    $0x0,%eax
+  800139:	49 ba ac 0e 80 00 00 	movabs $0x800eac,%r10
+  800140:	00 00 00 
+  800143:	41 ff d2             	call   *%r10
+  for (i = 0; i < BUFSIZE; i++) {
+  800146:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80014a:	81 7d fc ff 01 00 00 	cmpl   $0x1ff,-0x4(%rbp)
+  800151:	0f 8e 49 ff ff ff    	jle    8000a0 <check+0x20>
+            what, (long)off, (long)len, i, buf[i], ref[i]);
+  }
+}
+  800157:	90                   	nop
+  800158:	90                   	nop
+  800159:	c9                   	leave
+  80015a:	c3                   	ret
+
+000000000080015b <check_memset>:
+
+static void
+check_memset(void) {
+  80015b:	55                   	push   %rbp
+  80015c:	48 89 e5             	mov    %rsp,%rbp
+  80015f:	48 83 ec 20          	sub    $0x20,%rsp
+  size_t off, len, i, k;
+
+  for (off = 0; off < 8; off++) {
+  800163:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80016a:	00 
+  80016b:	e9 f7 00 00 00       	jmp    800267 <check_memset+0x10c>
+    for (k = 0; k < NLENS; k++) {
+  800170:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  800177:	00 
+  800178:	e9 da 00 00 00       	jmp    800257 <check_memset+0xfc>
+      len = lens[k];
+  80017d:	48 ba 80 5d 80 00 00 	movabs $0x805d80,%rdx
+  800184:	00 00 00 
+  800187:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80018b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80018f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      fill(buf, 1);
+  800193:	be 01 00 00 00       	mov    $0x1,%esi
+  800198:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80019f:	00 00 00 
+  8001a2:	48 89 c7             	mov    %rax,%rdi
+  8001a5:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+      fill(ref, 1);
+  8001b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8001b6:	48 b8 00 82 80 00 00 	movabs $0x808200,%rax
+  8001bd:	00 00 00 
+  8001c0:	48 89 c7             	mov    %rax,%rdi
+  8001c3:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001ca:	00 00 00 
+  8001cd:	ff d0                	call   *%rax
+      memset(buf + off, 0xa5, len);
+  8001cf:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8001d6:	00 00 00 
+  8001d9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8001dd:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8001e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001e5:	48 89 c2             	mov    %rax,%rdx
+  8001e8:	be a5 00 00 00       	mov    $0xa5,%esi
+  8001ed:	48 89 cf             	mov    %rcx,%rdi
+  8001f0:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  8001f7:	00 00 00 
+  8001fa:	ff d0                	call   *%rax
+      for (i = 0; i < len; i++)
+  8001fc:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800203:	00 
+  800204:	eb 1e                	jmp    800224 <check_memset+0xc9>
+        ref[off + i] = 0xa5;
+  800206:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80020a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80020e:	48 01 d0             	add    %rdx,%rax
+  800211:	48 ba 00 82 80 00 00 	movabs $0x808200,%rdx
+  800218:	00 00 00 
+  80021b:	c6 04 02 a5          	movb   $0xa5,(%rdx,%rax,1)
+      for (i = 0; i < len; i++)
+  80021f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  800224:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800228:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  80022c:	72 d8                	jb     800206 <check_memset+0xab>
+      check("memset", off, len);
+  80022e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800232:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800236:	48 89 c6             	mov    %rax,%rsi
+  800239:	48 b8 68 5e 80 00 00 	movabs $0x805e68,%rax
+  800240:	00 00 00 
+  800243:	48 89 c7             	mov    %rax,%rdi
+  800246:	48 b8 80 00 80 00 00 	movabs $0x800080,%rax
+  80024d:	00 00 00 
+  800250:	ff d0                	call   *%rax
+    for (k = 0; k < NLENS; k++) {
+  800252:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800257:	48 83 7d e8 14       	cmpq   $0x14,-0x18(%rbp)
+  80025c:	0f 86 1b ff ff ff    	jbe    80017d <check_memset+0x22>
+  for (off = 0; off < 8; off++) {
+  800262:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800267:	48 83 7d f8 07       	cmpq   $0x7,-0x8(%rbp)
+  80026c:	0f 86 fe fe ff ff    	jbe    800170 <check_memset+0x15>
+    }
+  }
+}
+  800272:	90                   	nop
+  800273:	90                   	nop
+  800274:	c9                   	leave
+  800275:	c3                   	ret
+
+0000000000800276 <check_memcpy>:
+
+static void
+check_memcpy(void) {
+  800276:	55                   	push   %rbp
+  800277:	48 89 e5             	mov    %rsp,%rbp
+  80027a:	48 83 ec 30          	sub    $0x30,%rsp
+  size_t soff, doff, len, i, k;
+
+  fill(src, 3);
+  80027e:	be 03 00 00 00       	mov    $0x3,%esi
+  800283:	48 b8 00 84 80 00 00 	movabs $0x808400,%rax
+  80028a:	00 00 00 
+  80028d:	48 89 c7             	mov    %rax,%rdi
+  800290:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800297:	00 00 00 
+  80029a:	ff d0                	call   *%rax
+  for (soff = 0; soff < 8; soff++) {
+  80029c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8002a3:	00 
+  8002a4:	e9 4c 01 00 00       	jmp    8003f5 <check_memcpy+0x17f>
+    for (doff = 0; doff < 8; doff++) {
+  8002a9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8002b0:	00 
+  8002b1:	e9 2f 01 00 00       	jmp    8003e5 <check_memcpy+0x16f>
+      for (k = 0; k < NLENS; k++) {
+  8002b6:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  8002bd:	00 
+  8002be:	e9 12 01 00 00       	jmp    8003d5 <check_memcpy+0x15f>
+        len = lens[k];
+  8002c3:	48 ba 80 5d 80 00 00 	movabs $0x805d80,%rdx
+  8002ca:	00 00 00 
+  8002cd:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8002d1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8002d5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        fill(buf, 1);
+  8002d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8002de:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8002e5:	00 00 00 
+  8002e8:	48 89 c7             	mov    %rax,%rdi
+  8002eb:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+        fill(ref, 1);
+  8002f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8002fc:	48 b8 00 82 80 00 00 	movabs $0x808200,%rax
+  800303:	00 00 00 
+  800306:	48 89 c7             	mov    %rax,%rdi
+  800309:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800310:	00 00 00 
+  800313:	ff d0                	call   *%rax
+        memcpy(buf + doff, src + soff, len);
+  800315:	48 ba 00 84 80 00 00 	movabs $0x808400,%rdx
+  80031c:	00 00 00 
+  80031f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800323:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  800327:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80032e:	00 00 00 
+  800331:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800335:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  800339:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80033d:	48 89 c2             	mov    %rax,%rdx
+  800340:	48 89 cf             	mov    %rcx,%rdi
+  800343:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  80034a:	00 00 00 
+  80034d:	ff d0                	call   *%rax
+        for (i = 0; i < len; i++)
+  80034f:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  800356:	00 
+  800357:	eb 36                	jmp    80038f <check_memcpy+0x119>
+          ref[doff + i] = src[soff + i];
+  800359:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80035d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800361:	48 01 d0             	add    %rdx,%rax
+  800364:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800368:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80036c:	48 01 ca             	add    %rcx,%rdx
+  80036f:	48 b9 00 84 80 00 00 	movabs $0x808400,%rcx
+  800376:	00 00 00 
+  800379:	0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+  80037d:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  800384:	00 00 00 
+  800387:	88 04 11             	mov    %al,(%rcx,%rdx,1)
+        for (i = 0; i < len; i++)
+  80038a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80038f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800393:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  800397:	72 c0                	jb     800359 <check_memcpy+0xe3>
+        check("memcpy", soff * 8 + doff, len);
+  800399:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80039d:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8003a4:	00 
+  8003a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8003a9:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8003ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8003b1:	48 89 c2             	mov    %rax,%rdx
+  8003b4:	48 89 ce             	mov    %rcx,%rsi
+  8003b7:	48 b8 6f 5e 80 00 00 	movabs $0x805e6f,%rax
+  8003be:	00 00 00 
+  8003c1:	48 89 c7             	mov    %rax,%rdi
+  8003c4:	48 b8 80 00 80 00 00 	movabs $0x800080,%rax
+  8003cb:	00 00 00 
+  8003ce:	ff d0                	call   *%rax
+      for (k = 0; k < NLENS; k++) {
+  8003d0:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  8003d5:	48 83 7d e0 14       	cmpq   $0x14,-0x20(%rbp)
+  8003da:	0f 86 e3 fe ff ff    	jbe    8002c3 <check_memcpy+0x4d>
+    for (doff = 0; doff < 8; doff++) {
+  8003e0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8003e5:	48 83 7d f0 07       	cmpq   $0x7,-0x10(%rbp)
+  8003ea:	0f 86 c6 fe ff ff    	jbe    8002b6 <check_memcpy+0x40>
+  for (soff = 0; soff < 8; soff++) {
+  8003f0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8003f5:	48 83 7d f8 07       	cmpq   $0x7,-0x8(%rbp)
+  8003fa:	0f 86 a9 fe ff ff    	jbe    8002a9 <check_memcpy+0x33>
+      }
+    }
+  }
+}
+  800400:	90                   	nop
+  800401:	90                   	nop
+  800402:	c9                   	leave
+  800403:	c3                   	ret
+
+0000000000800404 <check_memmove>:
+
+// Overlapping moves, the destination above the source (copied
+// backwards) and below it (copied forwards).
+static void
+check_memmove(void) {
+  800404:	55                   	push   %rbp
+  800405:	48 89 e5             	mov    %rsp,%rbp
+  800408:	48 83 ec 30          	sub    $0x30,%rsp
+  static const size_t shifts[] = {1, 3, 8, 15, 16, 17, 33, 64};
+  size_t off, len, d, i, j, k;
+
+  for (off = 0; off < 8; off++) {
+  80040c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800413:	00 
+  800414:	e9 c3 02 00 00       	jmp    8006dc <check_memmove+0x2d8>
+    for (j = 0; j < sizeof(shifts) / sizeof(shifts[0]); j++) {
+  800419:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  800420:	00 
+  800421:	e9 a6 02 00 00       	jmp    8006cc <check_memmove+0x2c8>
+      d = shifts[j];
+  800426:	48 ba e0 5f 80 00 00 	movabs $0x805fe0,%rdx
+  80042d:	00 00 00 
+  800430:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800434:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800438:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+      for (k = 0; k < NLENS; k++) {
+  80043c:	48 c7 45 e0 00 00 00 	movq   $0x0,-0x20(%rbp)
+  800443:	00 
+  800444:	e9 73 02 00 00       	jmp    8006bc <check_memmove+0x2b8>
+        len = lens[k];
+  800449:	48 ba 80 5d 80 00 00 	movabs $0x805d80,%rdx
+  800450:	00 00 00 
+  800453:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800457:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80045b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+        if (off + d + len > BUFSIZE)
+  80045f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800463:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800467:	48 01 c2             	add    %rax,%rdx
+  80046a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80046e:	48 01 d0             	add    %rdx,%rax
+  800471:	48 3d 00 02 00 00    	cmp    $0x200,%rax
+  800477:	0f 87 39 02 00 00    	ja     8006b6 <check_memmove+0x2b2>
+          continue;
+
+        fill(buf, 5);
+  80047d:	be 05 00 00 00       	mov    $0x5,%esi
+  800482:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800489:	00 00 00 
+  80048c:	48 89 c7             	mov    %rax,%rdi
+  80048f:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800496:	00 00 00 
+  800499:	ff d0                	call   *%rax
+        fill(ref, 5);
+  80049b:	be 05 00 00 00       	mov    $0x5,%esi
+  8004a0:	48 b8 00 82 80 00 00 	movabs $0x808200,%rax
+  8004a7:	00 00 00 
+  8004aa:	48 89 c7             	mov    %rax,%rdi
+  8004ad:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8004b4:	00 00 00 
+  8004b7:	ff d0                	call   *%rax
+        memmove(buf + off + d, buf + off, len);
+  8004b9:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8004c0:	00 00 00 
+  8004c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004c7:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8004cb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8004d3:	48 01 c2             	add    %rax,%rdx
+  8004d6:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8004dd:	00 00 00 
+  8004e0:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8004e4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004e8:	48 89 c2             	mov    %rax,%rdx
+  8004eb:	48 89 cf             	mov    %rcx,%rdi
+  8004ee:	48 b8 be 25 80 00 00 	movabs $0x8025be,%rax
+  8004f5:	00 00 00 
+  8004f8:	ff d0                	call   *%rax
+        for (i = len; i > 0; i--)
+  8004fa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8004fe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800502:	eb 45                	jmp    800549 <check_memmove+0x145>
+          ref[off + d + i - 1] = ref[off + i - 1];
+  800504:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800508:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80050c:	48 01 d0             	add    %rdx,%rax
+  80050f:	48 83 e8 01          	sub    $0x1,%rax
+  800513:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800517:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80051b:	48 01 d1             	add    %rdx,%rcx
+  80051e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800522:	48 01 ca             	add    %rcx,%rdx
+  800525:	48 83 ea 01          	sub    $0x1,%rdx
+  800529:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  800530:	00 00 00 
+  800533:	0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+  800537:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  80053e:	00 00 00 
+  800541:	88 04 11             	mov    %al,(%rcx,%rdx,1)
+        for (i = len; i > 0; i--)
+  800544:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  800549:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  80054e:	75 b4                	jne    800504 <check_memmove+0x100>
+        check("memmove up", off * 100 + d, len);
+  800550:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800554:	48 89 d0             	mov    %rdx,%rax
+  800557:	48 c1 e0 02          	shl    $0x2,%rax
+  80055b:	48 01 d0             	add    %rdx,%rax
+  80055e:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  800565:	00 
+  800566:	48 01 d0             	add    %rdx,%rax
+  800569:	48 c1 e0 02          	shl    $0x2,%rax
+  80056d:	48 89 c2             	mov    %rax,%rdx
+  800570:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800574:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  800578:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80057c:	48 89 c2             	mov    %rax,%rdx
+  80057f:	48 89 ce             	mov    %rcx,%rsi
+  800582:	48 b8 76 5e 80 00 00 	movabs $0x805e76,%rax
+  800589:	00 00 00 
+  80058c:	48 89 c7             	mov    %rax,%rdi
+  80058f:	48 b8 80 00 80 00 00 	movabs $0x800080,%rax
+  800596:	00 00 00 
+  800599:	ff d0                	call   *%rax
+
+        fill(buf, 5);
+  80059b:	be 05 00 00 00       	mov    $0x5,%esi
+  8005a0:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8005a7:	00 00 00 
+  8005aa:	48 89 c7             	mov    %rax,%rdi
+  8005ad:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8005b4:	00 00 00 
+  8005b7:	ff d0                	call   *%rax
+        fill(ref, 5);
+  8005b9:	be 05 00 00 00       	mov    $0x5,%esi
+  8005be:	48 b8 00 82 80 00 00 	movabs $0x808200,%rax
+  8005c5:	00 00 00 
+  8005c8:	48 89 c7             	mov    %rax,%rdi
+  8005cb:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8005d2:	00 00 00 
+  8005d5:	ff d0                	call   *%rax
+        memmove(buf + off, buf + off + d, len);
+  8005d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8005df:	48 01 c2             	add    %rax,%rdx
+  8005e2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8005e9:	00 00 00 
+  8005ec:	48 8d 34 02          	lea    (%rdx,%rax,1),%rsi
+  8005f0:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8005f7:	00 00 00 
+  8005fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fe:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  800602:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800606:	48 89 c2             	mov    %rax,%rdx
+  800609:	48 89 cf             	mov    %rcx,%rdi
+  80060c:	48 b8 be 25 80 00 00 	movabs $0x8025be,%rax
+  800613:	00 00 00 
+  800616:	ff d0                	call   *%rax
+        for (i = 0; i < len; i++)
+  800618:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80061f:	00 
+  800620:	eb 3d                	jmp    80065f <check_memmove+0x25b>
+          ref[off + i] = ref[off + d + i];
+  800622:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800626:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80062a:	48 01 c2             	add    %rax,%rdx
+  80062d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800631:	48 01 d0             	add    %rdx,%rax
+  800634:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800638:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80063c:	48 01 ca             	add    %rcx,%rdx
+  80063f:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  800646:	00 00 00 
+  800649:	0f b6 04 01          	movzbl (%rcx,%rax,1),%eax
+  80064d:	48 b9 00 82 80 00 00 	movabs $0x808200,%rcx
+  800654:	00 00 00 
+  800657:	88 04 11             	mov    %al,(%rcx,%rdx,1)
+        for (i = 0; i < len; i++)
+  80065a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80065f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800663:	48 3b 45 d0          	cmp    -0x30(%rbp),%rax
+  800667:	72 b9                	jb     800622 <check_memmove+0x21e>
+        check("memmove down", off * 100 + d, len);
+  800669:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80066d:	48 89 d0             	mov    %rdx,%rax
+  800670:	48 c1 e0 02          	shl    $0x2,%rax
+  800674:	48 01 d0             	add    %rdx,%rax
+  800677:	48 8d 14 85 00 00 00 	lea    0x0(,%rax,4),%rdx
+  80067e:	00 
+  80067f:	48 01 d0             	add    %rdx,%rax
+  800682:	48 c1 e0 02          	shl    $0x2,%rax
+  800686:	48 89 c2             	mov    %rax,%rdx
+  800689:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80068d:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  800691:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800695:	48 89 c2             	mov    %rax,%rdx
+  800698:	48 89 ce             	mov    %rcx,%rsi
+  80069b:	48 b8 81 5e 80 00 00 	movabs $0x805e81,%rax
+  8006a2:	00 00 00 
+  8006a5:	48 89 c7             	mov    %rax,%rdi
+  8006a8:	48 b8 80 00 80 00 00 	movabs $0x800080,%rax
+  8006af:	00 00 00 
+  8006b2:	ff d0                	call   *%rax
+  8006b4:	eb 01                	jmp    8006b7 <check_memmove+0x2b3>
+          continue;
+  8006b6:	90                   	nop
+      for (k = 0; k < NLENS; k++) {
+  8006b7:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  8006bc:	48 83 7d e0 14       	cmpq   $0x14,-0x20(%rbp)
+  8006c1:	0f 86 82 fd ff ff    	jbe    800449 <check_memmove+0x45>
+    for (j = 0; j < sizeof(shifts) / sizeof(shifts[0]); j++) {
+  8006c7:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8006cc:	48 83 7d e8 07       	cmpq   $0x7,-0x18(%rbp)
+  8006d1:	0f 86 4f fd ff ff    	jbe    800426 <check_memmove+0x22>
+  for (off = 0; off < 8; off++) {
+  8006d7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8006dc:	48 83 7d f8 07       	cmpq   $0x7,-0x8(%rbp)
+  8006e1:	0f 86 32 fd ff ff    	jbe    800419 <check_memmove+0x15>
+      }
+    }
+  }
+}
+  8006e7:	90                   	nop
+  8006e8:	90                   	nop
+  8006e9:	c9                   	leave
+  8006ea:	c3                   	ret
+
+00000000008006eb <check_memcmp>:
+
+static void
+check_memcmp(void) {
+  8006eb:	55                   	push   %rbp
+  8006ec:	48 89 e5             	mov    %rsp,%rbp
+  8006ef:	48 83 ec 30          	sub    $0x30,%rsp
+  size_t off, len, pos, k;
+  int r;
+
+  fill(src, 9);
+  8006f3:	be 09 00 00 00       	mov    $0x9,%esi
+  8006f8:	48 b8 00 84 80 00 00 	movabs $0x808400,%rax
+  8006ff:	00 00 00 
+  800702:	48 89 c7             	mov    %rax,%rdi
+  800705:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80070c:	00 00 00 
+  80070f:	ff d0                	call   *%rax
+  for (off = 0; off < 8; off++) {
+  800711:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800718:	00 
+  800719:	e9 2a 02 00 00       	jmp    800948 <check_memcmp+0x25d>
+    for (k = 0; k < NLENS; k++) {
+  80071e:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  800725:	00 
+  800726:	e9 0d 02 00 00       	jmp    800938 <check_memcmp+0x24d>
+      len = lens[k];
+  80072b:	48 ba 80 5d 80 00 00 	movabs $0x805d80,%rdx
+  800732:	00 00 00 
+  800735:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800739:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80073d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      memcpy(buf + off, src, len);
+  800741:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800748:	00 00 00 
+  80074b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80074f:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  800753:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800757:	48 89 c2             	mov    %rax,%rdx
+  80075a:	48 b8 00 84 80 00 00 	movabs $0x808400,%rax
+  800761:	00 00 00 
+  800764:	48 89 c6             	mov    %rax,%rsi
+  800767:	48 89 cf             	mov    %rcx,%rdi
+  80076a:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  800771:	00 00 00 
+  800774:	ff d0                	call   *%rax
+      if (memcmp(buf + off, src, len) != 0)
+  800776:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80077d:	00 00 00 
+  800780:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800784:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  800788:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80078c:	48 89 c2             	mov    %rax,%rdx
+  80078f:	48 b8 00 84 80 00 00 	movabs $0x808400,%rax
+  800796:	00 00 00 
+  800799:	48 89 c6             	mov    %rax,%rsi
+  80079c:	48 89 cf             	mov    %rcx,%rdi
+  80079f:	48 b8 f8 27 80 00 00 	movabs $0x8027f8,%rax
+  8007a6:	00 00 00 
+  8007a9:	ff d0                	call   *%rax
+  8007ab:	85 c0                	test   %eax,%eax
+  8007ad:	74 3f                	je     8007ee <check_memcmp+0x103>
+        panic("memcmp off %ld len %ld: equal bytes differ", (long)off, (long)len);
+  8007af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8007b3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007b7:	49 89 d0             	mov    %rdx,%r8
+  8007ba:	48 89 c1             	mov    %rax,%rcx
+  8007bd:	48 b8 90 5e 80 00 00 	movabs $0x805e90,%rax
+  8007c4:	00 00 00 
+  8007c7:	48 89 c2             	mov    %rax,%rdx
+  8007ca:	be 76 00 00 00       	mov    $0x76,%esi
+  8007cf:	48 b8 56 5e 80 00 00 	movabs $0x805e56,%rax
+  8007d6:	00 00 00 
+  8007d9:	48 89 c7             	mov    %rax,%rdi
+  8007dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e1:	49 b9 ac 0e 80 00 00 	movabs $0x800eac,%r9
+  8007e8:	00 00 00 
+  8007eb:	41 ff d1             	call   *%r9
+      // A difference at the head, in the middle, and in the last byte.
+      for (pos = 0; pos < len; pos += (len - pos > 2 ? (len - 1) / 2 : 1)) {
+  8007ee:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8007f5:	00 
+  8007f6:	e9 2a 01 00 00       	jmp    800925 <check_memcmp+0x23a>
+        buf[off + pos] = src[pos] + 1;
+  8007fb:	48 ba 00 84 80 00 00 	movabs $0x808400,%rdx
+  800802:	00 00 00 
+  800805:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800809:	48 01 d0             	add    %rdx,%rax
+  80080c:	0f b6 10             	movzbl (%rax),%edx
+  80080f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800813:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800817:	48 01 c8             	add    %rcx,%rax
+  80081a:	8d 4a 01             	lea    0x1(%rdx),%ecx
+  80081d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800824:	00 00 00 
+  800827:	88 0c 02             	mov    %cl,(%rdx,%rax,1)
+        r = memcmp(buf + off, src, len);
+  80082a:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800831:	00 00 00 
+  800834:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800838:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  80083c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800840:	48 89 c2             	mov    %rax,%rdx
+  800843:	48 b8 00 84 80 00 00 	movabs $0x808400,%rax
+  80084a:	00 00 00 
+  80084d:	48 89 c6             	mov    %rax,%rsi
+  800850:	48 89 cf             	mov    %rcx,%rdi
+  800853:	48 b8 f8 27 80 00 00 	movabs $0x8027f8,%rax
+  80085a:	00 00 00 
+  80085d:	ff d0                	call   *%rax
+  80085f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+        if ((src[pos] == 0xff ? r >= 0 : r <= 0))
+  800862:	48 ba 00 84 80 00 00 	movabs $0x808400,%rdx
+  800869:	00 00 00 
+  80086c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800870:	48 01 d0             	add    %rdx,%rax
+  800873:	0f b6 00             	movzbl (%rax),%eax
+  800876:	3c ff                	cmp    $0xff,%al
+  800878:	75 0a                	jne    800884 <check_memcmp+0x199>
+  80087a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80087d:	f7 d0                	not    %eax
+  80087f:	c1 e8 1f             	shr    $0x1f,%eax
+  800882:	eb 07                	jmp    80088b <check_memcmp+0x1a0>
+  800884:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800888:	0f 9e c0             	setle  %al
+  80088b:	84 c0                	test   %al,%al
+  80088d:	74 46                	je     8008d5 <check_memcmp+0x1ea>
+          panic("memcmp off %ld len %ld: byte %ld compares wrong",
+  80088f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800893:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800897:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80089b:	49 89 c9             	mov    %rcx,%r9
+  80089e:	49 89 d0             	mov    %rdx,%r8
+  8008a1:	48 89 c1             	mov    %rax,%rcx
+  8008a4:	48 b8 c0 5e 80 00 00 	movabs $0x805ec0,%rax
+  8008ab:	00 00 00 
+  8008ae:	48 89 c2             	mov    %rax,%rdx
+  8008b1:	be 7c 00 00 00       	mov    $0x7c,%esi
+  8008b6:	48 b8 56 5e 80 00 00 	movabs $0x805e56,%rax
+  8008bd:	00 00 00 
+  8008c0:	48 89 c7             	mov    %rax,%rdi
+  8008c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c8:	49 ba ac 0e 80 00 00 	movabs $0x800eac,%r10
+  8008cf:	00 00 00 
+  8008d2:	41 ff d2             	call   *%r10
+                (long)off, (long)len, (long)pos);
+        buf[off + pos] = src[pos];
+  8008d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008dd:	48 01 c2             	add    %rax,%rdx
+  8008e0:	48 b9 00 84 80 00 00 	movabs $0x808400,%rcx
+  8008e7:	00 00 00 
+  8008ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8008ee:	48 01 c8             	add    %rcx,%rax
+  8008f1:	0f b6 00             	movzbl (%rax),%eax
+  8008f4:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  8008fb:	00 00 00 
+  8008fe:	88 04 11             	mov    %al,(%rcx,%rdx,1)
+      for (pos = 0; pos < len; pos += (len - pos > 2 ? (len - 1) / 2 : 1)) {
+  800901:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800905:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  800909:	48 83 f8 02          	cmp    $0x2,%rax
+  80090d:	76 0d                	jbe    80091c <check_memcmp+0x231>
+  80090f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800913:	48 83 e8 01          	sub    $0x1,%rax
+  800917:	48 d1 e8             	shr    %rax
+  80091a:	eb 05                	jmp    800921 <check_memcmp+0x236>
+  80091c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800921:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  800925:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800929:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  80092d:	0f 82 c8 fe ff ff    	jb     8007fb <check_memcmp+0x110>
+    for (k = 0; k < NLENS; k++) {
+  800933:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800938:	48 83 7d e8 14       	cmpq   $0x14,-0x18(%rbp)
+  80093d:	0f 86 e8 fd ff ff    	jbe    80072b <check_memcmp+0x40>
+  for (off = 0; off < 8; off++) {
+  800943:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800948:	48 83 7d f8 07       	cmpq   $0x7,-0x8(%rbp)
+  80094d:	0f 86 cb fd ff ff    	jbe    80071e <check_memcmp+0x33>
+      }
+    }
+  }
+}
+  800953:	90                   	nop
+  800954:	90                   	nop
+  800955:	c9                   	leave
+  800956:	c3                   	ret
+
+0000000000800957 <check_memfind>:
+
+static void
+check_memfind(void) {
+  800957:	55                   	push   %rbp
+  800958:	48 89 e5             	mov    %rsp,%rbp
+  80095b:	48 83 ec 30          	sub    $0x30,%rsp
+  size_t off, len, pos, k;
+  uint8_t *p;
+
+  for (off = 0; off < 8; off++) {
+  80095f:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800966:	00 
+  800967:	e9 f0 01 00 00       	jmp    800b5c <check_memfind+0x205>
+    for (k = 0; k < NLENS; k++) {
+  80096c:	48 c7 45 e8 00 00 00 	movq   $0x0,-0x18(%rbp)
+  800973:	00 
+  800974:	e9 d3 01 00 00       	jmp    800b4c <check_memfind+0x1f5>
+      len = lens[k];
+  800979:	48 ba 80 5d 80 00 00 	movabs $0x805d80,%rdx
+  800980:	00 00 00 
+  800983:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800987:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80098b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      memset(buf, 'a', BUFSIZE);
+  80098f:	ba 00 02 00 00       	mov    $0x200,%edx
+  800994:	be 61 00 00 00       	mov    $0x61,%esi
+  800999:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8009a0:	00 00 00 
+  8009a3:	48 89 c7             	mov    %rax,%rdi
+  8009a6:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  8009ad:	00 00 00 
+  8009b0:	ff d0                	call   *%rax
+      if ((p = memfind(buf + off, 'x', len)) != buf + off + len)
+  8009b2:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8009b9:	00 00 00 
+  8009bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009c0:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8009c4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009c8:	48 89 c2             	mov    %rax,%rdx
+  8009cb:	be 78 00 00 00       	mov    $0x78,%esi
+  8009d0:	48 89 cf             	mov    %rcx,%rdi
+  8009d3:	48 b8 25 29 80 00 00 	movabs $0x802925,%rax
+  8009da:	00 00 00 
+  8009dd:	ff d0                	call   *%rax
+  8009df:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8009e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8009eb:	48 01 c2             	add    %rax,%rdx
+  8009ee:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8009f5:	00 00 00 
+  8009f8:	48 01 d0             	add    %rdx,%rax
+  8009fb:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8009ff:	74 3f                	je     800a40 <check_memfind+0xe9>
+        panic("memfind off %ld len %ld: found a missing byte", (long)off, (long)len);
+  800a01:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800a05:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a09:	49 89 d0             	mov    %rdx,%r8
+  800a0c:	48 89 c1             	mov    %rax,%rcx
+  800a0f:	48 b8 f0 5e 80 00 00 	movabs $0x805ef0,%rax
+  800a16:	00 00 00 
+  800a19:	48 89 c2             	mov    %rax,%rdx
+  800a1c:	be 8e 00 00 00       	mov    $0x8e,%esi
+  800a21:	48 b8 56 5e 80 00 00 	movabs $0x805e56,%rax
+  800a28:	00 00 00 
+  800a2b:	48 89 c7             	mov    %rax,%rdi
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a33:	49 b9 ac 0e 80 00 00 	movabs $0x800eac,%r9
+  800a3a:	00 00 00 
+  800a3d:	41 ff d1             	call   *%r9
+      for (pos = 0; pos < len; pos++) {
+  800a40:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800a47:	00 
+  800a48:	e9 ec 00 00 00       	jmp    800b39 <check_memfind+0x1e2>
+        buf[off + pos] = 'x';
+  800a4d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a51:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a55:	48 01 d0             	add    %rdx,%rax
+  800a58:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800a5f:	00 00 00 
+  800a62:	c6 04 02 78          	movb   $0x78,(%rdx,%rax,1)
+        if ((p = memfind(buf + off, 'x', len)) != buf + off + pos)
+  800a66:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800a6d:	00 00 00 
+  800a70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a74:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  800a78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800a7c:	48 89 c2             	mov    %rax,%rdx
+  800a7f:	be 78 00 00 00       	mov    $0x78,%esi
+  800a84:	48 89 cf             	mov    %rcx,%rdi
+  800a87:	48 b8 25 29 80 00 00 	movabs $0x802925,%rax
+  800a8e:	00 00 00 
+  800a91:	ff d0                	call   *%rax
+  800a93:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800a97:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800a9f:	48 01 c2             	add    %rax,%rdx
+  800aa2:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800aa9:	00 00 00 
+  800aac:	48 01 d0             	add    %rdx,%rax
+  800aaf:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800ab3:	74 66                	je     800b1b <check_memfind+0x1c4>
+          panic("memfind off %ld len %ld: byte %ld found at %ld",
+  800ab5:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800abc:	00 00 00 
+  800abf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  800ac3:	48 29 c2             	sub    %rax,%rdx
+  800ac6:	48 89 d0             	mov    %rdx,%rax
+  800ac9:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  800acd:	48 89 c6             	mov    %rax,%rsi
+  800ad0:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  800ad4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800ad8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800adc:	48 83 ec 08          	sub    $0x8,%rsp
+  800ae0:	56                   	push   %rsi
+  800ae1:	49 89 c9             	mov    %rcx,%r9
+  800ae4:	49 89 d0             	mov    %rdx,%r8
+  800ae7:	48 89 c1             	mov    %rax,%rcx
+  800aea:	48 b8 20 5f 80 00 00 	movabs $0x805f20,%rax
+  800af1:	00 00 00 
+  800af4:	48 89 c2             	mov    %rax,%rdx
+  800af7:	be 92 00 00 00       	mov    $0x92,%esi
+  800afc:	48 b8 56 5e 80 00 00 	movabs $0x805e56,%rax
+  800b03:	00 00 00 
+  800b06:	48 89 c7             	mov    %rax,%rdi
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0e:	49 ba ac 0e 80 00 00 	movabs $0x800eac,%r10
+  800b15:	00 00 00 
+  800b18:	41 ff d2             	call   *%r10
+                (long)off, (long)len, (long)pos, (long)(p - buf - off));
+        buf[off + pos] = 'a';
+  800b1b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b23:	48 01 d0             	add    %rdx,%rax
+  800b26:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800b2d:	00 00 00 
+  800b30:	c6 04 02 61          	movb   $0x61,(%rdx,%rax,1)
+      for (pos = 0; pos < len; pos++) {
+  800b34:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  800b39:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b3d:	48 3b 45 e0          	cmp    -0x20(%rbp),%rax
+  800b41:	0f 82 06 ff ff ff    	jb     800a4d <check_memfind+0xf6>
+    for (k = 0; k < NLENS; k++) {
+  800b47:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  800b4c:	48 83 7d e8 14       	cmpq   $0x14,-0x18(%rbp)
+  800b51:	0f 86 22 fe ff ff    	jbe    800979 <check_memfind+0x22>
+  for (off = 0; off < 8; off++) {
+  800b57:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800b5c:	48 83 7d f8 07       	cmpq   $0x7,-0x8(%rbp)
+  800b61:	0f 86 05 fe ff ff    	jbe    80096c <check_memfind+0x15>
+      }
+    }
+  }
+}
+  800b67:	90                   	nop
+  800b68:	90                   	nop
+  800b69:	c9                   	leave
+  800b6a:	c3                   	ret
+
+0000000000800b6b <check_strlen>:
+
+static void
+check_strlen(void) {
+  800b6b:	55                   	push   %rbp
+  800b6c:	48 89 e5             	mov    %rsp,%rbp
+  800b6f:	48 83 ec 30          	sub    $0x30,%rsp
+  size_t off, len, k;
+  char *s, *p;
+
+  for (off = 0; off < 64; off++) {
+  800b73:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  800b7a:	00 
+  800b7b:	e9 fe 01 00 00       	jmp    800d7e <check_strlen+0x213>
+    for (k = 0; k < NLENS; k++) {
+  800b80:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800b87:	00 
+  800b88:	e9 e1 01 00 00       	jmp    800d6e <check_strlen+0x203>
+      len = lens[k];
+  800b8d:	48 ba 80 5d 80 00 00 	movabs $0x805d80,%rdx
+  800b94:	00 00 00 
+  800b97:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800b9b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800b9f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      if (off + len >= BUFSIZE)
+  800ba3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ba7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bab:	48 01 d0             	add    %rdx,%rax
+  800bae:	48 3d ff 01 00 00    	cmp    $0x1ff,%rax
+  800bb4:	0f 87 ae 01 00 00    	ja     800d68 <check_strlen+0x1fd>
+        continue;
+      memset(buf, 'a', BUFSIZE);
+  800bba:	ba 00 02 00 00       	mov    $0x200,%edx
+  800bbf:	be 61 00 00 00       	mov    $0x61,%esi
+  800bc4:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800bcb:	00 00 00 
+  800bce:	48 89 c7             	mov    %rax,%rdi
+  800bd1:	48 b8 b2 24 80 00 00 	movabs $0x8024b2,%rax
+  800bd8:	00 00 00 
+  800bdb:	ff d0                	call   *%rax
+      s = (char *)buf + off;
+  800bdd:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  800be4:	00 00 00 
+  800be7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800beb:	48 01 d0             	add    %rdx,%rax
+  800bee:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      s[len] = '\0';
+  800bf2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800bf6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bfa:	48 01 d0             	add    %rdx,%rax
+  800bfd:	c6 00 00             	movb   $0x0,(%rax)
+      if (strlen(s) != (int)len)
+  800c00:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c04:	48 89 c7             	mov    %rax,%rdi
+  800c07:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  800c0e:	00 00 00 
+  800c11:	ff d0                	call   *%rax
+  800c13:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800c17:	39 d0                	cmp    %edx,%eax
+  800c19:	74 57                	je     800c72 <check_strlen+0x107>
+        panic("strlen off %ld len %ld: got %d", (long)off, (long)len, strlen(s));
+  800c1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c1f:	48 89 c7             	mov    %rax,%rdi
+  800c22:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  800c29:	00 00 00 
+  800c2c:	ff d0                	call   *%rax
+  800c2e:	89 c2                	mov    %eax,%edx
+  800c30:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  800c34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800c38:	41 89 d1             	mov    %edx,%r9d
+  800c3b:	49 89 c8             	mov    %rcx,%r8
+  800c3e:	48 89 c1             	mov    %rax,%rcx
+  800c41:	48 b8 50 5f 80 00 00 	movabs $0x805f50,%rax
+  800c48:	00 00 00 
+  800c4b:	48 89 c2             	mov    %rax,%rdx
+  800c4e:	be a8 00 00 00       	mov    $0xa8,%esi
+  800c53:	48 b8 56 5e 80 00 00 	movabs $0x805e56,%rax
+  800c5a:	00 00 00 
+  800c5d:	48 89 c7             	mov    %rax,%rdi
+  800c60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c65:	49 ba ac 0e 80 00 00 	movabs $0x800eac,%r10
+  800c6c:	00 00 00 
+  800c6f:	41 ff d2             	call   *%r10
+      if (len && (p = strchr(s, 'b')) != NULL)
+  800c72:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800c77:	74 62                	je     800cdb <check_strlen+0x170>
+  800c79:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c7d:	be 62 00 00 00       	mov    $0x62,%esi
+  800c82:	48 89 c7             	mov    %rax,%rdi
+  800c85:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  800c8c:	00 00 00 
+  800c8f:	ff d0                	call   *%rax
+  800c91:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800c95:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800c9a:	74 3f                	je     800cdb <check_strlen+0x170>
+        panic("strchr off %ld len %ld: found a missing char", (long)off, (long)len);
+  800c9c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ca0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ca4:	49 89 d0             	mov    %rdx,%r8
+  800ca7:	48 89 c1             	mov    %rax,%rcx
+  800caa:	48 b8 70 5f 80 00 00 	movabs $0x805f70,%rax
+  800cb1:	00 00 00 
+  800cb4:	48 89 c2             	mov    %rax,%rdx
+  800cb7:	be aa 00 00 00       	mov    $0xaa,%esi
+  800cbc:	48 b8 56 5e 80 00 00 	movabs $0x805e56,%rax
+  800cc3:	00 00 00 
+  800cc6:	48 89 c7             	mov    %rax,%rdi
+  800cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cce:	49 b9 ac 0e 80 00 00 	movabs $0x800eac,%r9
+  800cd5:	00 00 00 
+  800cd8:	41 ff d1             	call   *%r9
+      if (len) {
+  800cdb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  800ce0:	0f 84 83 00 00 00    	je     800d69 <check_strlen+0x1fe>
+        s[len - 1] = 'b';
+  800ce6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cea:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800cee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800cf2:	48 01 d0             	add    %rdx,%rax
+  800cf5:	c6 00 62             	movb   $0x62,(%rax)
+        if ((p = strchr(s, 'b')) != s + len - 1)
+  800cf8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800cfc:	be 62 00 00 00       	mov    $0x62,%esi
+  800d01:	48 89 c7             	mov    %rax,%rdi
+  800d04:	48 b8 8a 23 80 00 00 	movabs $0x80238a,%rax
+  800d0b:	00 00 00 
+  800d0e:	ff d0                	call   *%rax
+  800d10:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  800d14:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d18:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800d1c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d20:	48 01 d0             	add    %rdx,%rax
+  800d23:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  800d27:	74 40                	je     800d69 <check_strlen+0x1fe>
+          panic("strchr off %ld len %ld: wrong match", (long)off, (long)len);
+  800d29:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800d2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800d31:	49 89 d0             	mov    %rdx,%r8
+  800d34:	48 89 c1             	mov    %rax,%rcx
+  800d37:	48 b8 a0 5f 80 00 00 	movabs $0x805fa0,%rax
+  800d3e:	00 00 00 
+  800d41:	48 89 c2             	mov    %rax,%rdx
+  800d44:	be ae 00 00 00       	mov    $0xae,%esi
+  800d49:	48 b8 56 5e 80 00 00 	movabs $0x805e56,%rax
+  800d50:	00 00 00 
+  800d53:	48 89 c7             	mov    %rax,%rdi
+  800d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5b:	49 b9 ac 0e 80 00 00 	movabs $0x800eac,%r9
+  800d62:	00 00 00 
+  800d65:	41 ff d1             	call   *%r9
+        continue;
+  800d68:	90                   	nop
+    for (k = 0; k < NLENS; k++) {
+  800d69:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  800d6e:	48 83 7d f0 14       	cmpq   $0x14,-0x10(%rbp)
+  800d73:	0f 86 14 fe ff ff    	jbe    800b8d <check_strlen+0x22>
+  for (off = 0; off < 64; off++) {
+  800d79:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  800d7e:	48 83 7d f8 3f       	cmpq   $0x3f,-0x8(%rbp)
+  800d83:	0f 86 f7 fd ff ff    	jbe    800b80 <check_strlen+0x15>
+      }
+    }
+  }
+}
+  800d89:	90                   	nop
+  800d8a:	90                   	nop
+  800d8b:	c9                   	leave
+  800d8c:	c3                   	ret
+
+0000000000800d8d <umain>:
+
+void
+umain(int argc, char **argv) {
+  800d8d:	55                   	push   %rbp
+  800d8e:	48 89 e5             	mov    %rsp,%rbp
+  800d91:	48 83 ec 10          	sub    $0x10,%rsp
+  800d95:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800d98:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  check_memset();
+  800d9c:	48 b8 5b 01 80 00 00 	movabs $0x80015b,%rax
+  800da3:	00 00 00 
+  800da6:	ff d0                	call   *%rax
+  check_memcpy();
+  800da8:	48 b8 76 02 80 00 00 	movabs $0x800276,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+  check_memmove();
+  800db4:	48 b8 04 04 80 00 00 	movabs $0x800404,%rax
+  800dbb:	00 00 00 
+  800dbe:	ff d0                	call   *%rax
+  check_memcmp();
+  800dc0:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  800dc7:	00 00 00 
+  800dca:	ff d0                	call   *%rax
+  check_memfind();
+  800dcc:	48 b8 57 09 80 00 00 	movabs $0x800957,%rax
+  800dd3:	00 00 00 
+  800dd6:	ff d0                	call   *%rax
+  check_strlen();
+  800dd8:	48 b8 6b 0b 80 00 00 	movabs $0x800b6b,%rax
+  800ddf:	00 00 00 
+  800de2:	ff d0                	call   *%rax
+  cprintf("string test passed\n");
+  800de4:	48 b8 c4 5f 80 00 00 	movabs $0x805fc4,%rax
+  800deb:	00 00 00 
+  800dee:	48 89 c7             	mov    %rax,%rdi
+  800df1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df6:	48 ba cb 10 80 00 00 	movabs $0x8010cb,%rdx
+  800dfd:	00 00 00 
+  800e00:	ff d2                	call   *%rdx
+}
+  800e02:	90                   	nop
+  800e03:	c9                   	leave
+  800e04:	c3                   	ret
+
+0000000000800e05 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800e05:	55                   	push   %rbp
+  800e06:	48 89 e5             	mov    %rsp,%rbp
+  800e09:	48 83 ec 20          	sub    $0x20,%rsp
+  800e0d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800e10:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800e14:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800e1b:	00 00 00 
+  800e1e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800e22:	eb 13                	jmp    800e37 <libmain+0x32>
+    (*ctor)();
+  800e24:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800e28:	48 8b 10             	mov    (%rax),%rdx
+  800e2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e30:	ff d2                	call   *%rdx
+    ctor++;
+  800e32:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800e37:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  800e3e:	00 00 00 
+  800e41:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800e45:	72 dd                	jb     800e24 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800e47:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800e4b:	7e 14                	jle    800e61 <libmain+0x5c>
+    binaryname = argv[0];
+  800e4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800e51:	48 8b 00             	mov    (%rax),%rax
+  800e54:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800e5b:	00 00 00 
+  800e5e:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800e61:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800e65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e68:	48 89 d6             	mov    %rdx,%rsi
+  800e6b:	89 c7                	mov    %eax,%edi
+  800e6d:	48 b8 8d 0d 80 00 00 	movabs $0x800d8d,%rax
+  800e74:	00 00 00 
+  800e77:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800e79:	48 b8 88 0e 80 00 00 	movabs $0x800e88,%rax
+  800e80:	00 00 00 
+  800e83:	ff d0                	call   *%rax
+#endif
+}
+  800e85:	90                   	nop
+  800e86:	c9                   	leave
+  800e87:	c3                   	ret
+
+0000000000800e88 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800e88:	55                   	push   %rbp
+  800e89:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  800e8c:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  800e93:	00 00 00 
+  800e96:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800e98:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e9d:	48 b8 01 2d 80 00 00 	movabs $0x802d01,%rax
+  800ea4:	00 00 00 
+  800ea7:	ff d0                	call   *%rax
+}
+  800ea9:	90                   	nop
+  800eaa:	5d                   	pop    %rbp
+  800eab:	c3                   	ret
+
+0000000000800eac <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800eac:	55                   	push   %rbp
+  800ead:	48 89 e5             	mov    %rsp,%rbp
+  800eb0:	53                   	push   %rbx
+  800eb1:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800eb8:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  800ebf:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800ec5:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  800ecc:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800ed3:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800eda:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800ee1:	84 c0                	test   %al,%al
+  800ee3:	74 23                	je     800f08 <_panic+0x5c>
+  800ee5:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  800eec:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  800ef0:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800ef4:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800ef8:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  800efc:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  800f00:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800f04:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800f08:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  800f0f:	00 00 00 
+  800f12:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800f19:	00 00 00 
+  800f1c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f20:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800f27:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  800f2e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800f35:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800f3c:	00 00 00 
+  800f3f:	48 8b 18             	mov    (%rax),%rbx
+  800f42:	48 b8 d0 2d 80 00 00 	movabs $0x802dd0,%rax
+  800f49:	00 00 00 
+  800f4c:	ff d0                	call   *%rax
+  800f4e:	89 c6                	mov    %eax,%esi
+  800f50:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800f56:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  800f5d:	41 89 d0             	mov    %edx,%r8d
+  800f60:	48 89 c1             	mov    %rax,%rcx
+  800f63:	48 89 da             	mov    %rbx,%rdx
+  800f66:	48 b8 30 60 80 00 00 	movabs $0x806030,%rax
+  800f6d:	00 00 00 
+  800f70:	48 89 c7             	mov    %rax,%rdi
+  800f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f78:	49 b9 cb 10 80 00 00 	movabs $0x8010cb,%r9
+  800f7f:	00 00 00 
+  800f82:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800f85:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  800f8c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800f93:	48 89 d6             	mov    %rdx,%rsi
+  800f96:	48 89 c7             	mov    %rax,%rdi
+  800f99:	48 b8 40 10 80 00 00 	movabs $0x801040,%rax
+  800fa0:	00 00 00 
+  800fa3:	ff d0                	call   *%rax
+  cprintf("\n");
+  800fa5:	48 b8 53 60 80 00 00 	movabs $0x806053,%rax
+  800fac:	00 00 00 
+  800faf:	48 89 c7             	mov    %rax,%rdi
+  800fb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb7:	48 ba cb 10 80 00 00 	movabs $0x8010cb,%rdx
+  800fbe:	00 00 00 
+  800fc1:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800fc3:	cc                   	int3
+  800fc4:	eb fd                	jmp    800fc3 <_panic+0x117>
+
+0000000000800fc6 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800fc6:	55                   	push   %rbp
+  800fc7:	48 89 e5             	mov    %rsp,%rbp
+  800fca:	48 83 ec 10          	sub    $0x10,%rsp
+  800fce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800fd1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800fd5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fd9:	8b 00                	mov    (%rax),%eax
+  800fdb:	8d 48 01             	lea    0x1(%rax),%ecx
+  800fde:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800fe2:	89 0a                	mov    %ecx,(%rdx)
+  800fe4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800fe7:	89 d1                	mov    %edx,%ecx
+  800fe9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800fed:	48 98                	cltq
+  800fef:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800ff3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ff7:	8b 00                	mov    (%rax),%eax
+  800ff9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800ffe:	75 2c                	jne    80102c <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  801000:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801004:	8b 00                	mov    (%rax),%eax
+  801006:	48 98                	cltq
+  801008:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80100c:	48 83 c2 08          	add    $0x8,%rdx
+  801010:	48 89 c6             	mov    %rax,%rsi
+  801013:	48 89 d7             	mov    %rdx,%rdi
+  801016:	48 b8 32 2c 80 00 00 	movabs $0x802c32,%rax
+  80101d:	00 00 00 
+  801020:	ff d0                	call   *%rax
+    b->idx = 0;
+  801022:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801026:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80102c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801030:	8b 40 04             	mov    0x4(%rax),%eax
+  801033:	8d 50 01             	lea    0x1(%rax),%edx
+  801036:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80103a:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80103d:	90                   	nop
+  80103e:	c9                   	leave
+  80103f:	c3                   	ret
+
+0000000000801040 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  801040:	55                   	push   %rbp
+  801041:	48 89 e5             	mov    %rsp,%rbp
+  801044:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80104b:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  801052:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  801059:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  801060:	00 00 00 
+  b.cnt = 0;
+  801063:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80106a:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80106d:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  801074:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80107b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  801082:	48 89 c6             	mov    %rax,%rsi
+  801085:	48 b8 c6 0f 80 00 00 	movabs $0x800fc6,%rax
+  80108c:	00 00 00 
+  80108f:	48 89 c7             	mov    %rax,%rdi
+  801092:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  801099:	00 00 00 
+  80109c:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80109e:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8010a4:	48 98                	cltq
+  8010a6:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8010ad:	48 83 c2 08          	add    $0x8,%rdx
+  8010b1:	48 89 c6             	mov    %rax,%rsi
+  8010b4:	48 89 d7             	mov    %rdx,%rdi
+  8010b7:	48 b8 32 2c 80 00 00 	movabs $0x802c32,%rax
+  8010be:	00 00 00 
+  8010c1:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8010c3:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8010c9:	c9                   	leave
+  8010ca:	c3                   	ret
+
+00000000008010cb <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8010cb:	55                   	push   %rbp
+  8010cc:	48 89 e5             	mov    %rsp,%rbp
+  8010cf:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8010d6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010dd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8010e4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8010eb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010f2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010f9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801100:	84 c0                	test   %al,%al
+  801102:	74 20                	je     801124 <cprintf+0x59>
+  801104:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801108:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80110c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801110:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801114:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801118:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80111c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801120:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  801124:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80112b:	00 00 00 
+  80112e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801135:	00 00 00 
+  801138:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80113c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801143:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80114a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  801151:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  801158:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80115f:	48 89 d6             	mov    %rdx,%rsi
+  801162:	48 89 c7             	mov    %rax,%rdi
+  801165:	48 b8 40 10 80 00 00 	movabs $0x801040,%rax
+  80116c:	00 00 00 
+  80116f:	ff d0                	call   *%rax
+  801171:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  801177:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80117d:	c9                   	leave
+  80117e:	c3                   	ret
+
+000000000080117f <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80117f:	55                   	push   %rbp
+  801180:	48 89 e5             	mov    %rsp,%rbp
+  801183:	48 83 ec 30          	sub    $0x30,%rsp
+  801187:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80118b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80118f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801193:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  801196:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80119a:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80119e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8011a1:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8011a5:	72 54                	jb     8011fb <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8011a7:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8011aa:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8011ad:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8011b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b9:	48 f7 f6             	div    %rsi
+  8011bc:	49 89 c2             	mov    %rax,%r10
+  8011bf:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8011c2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8011c5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8011c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8011cd:	41 89 c9             	mov    %ecx,%r9d
+  8011d0:	41 89 f8             	mov    %edi,%r8d
+  8011d3:	89 d1                	mov    %edx,%ecx
+  8011d5:	4c 89 d2             	mov    %r10,%rdx
+  8011d8:	48 89 c7             	mov    %rax,%rdi
+  8011db:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  8011e2:	00 00 00 
+  8011e5:	ff d0                	call   *%rax
+  8011e7:	eb 1c                	jmp    801205 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8011e9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011ed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8011f0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8011f4:	48 89 d6             	mov    %rdx,%rsi
+  8011f7:	89 c7                	mov    %eax,%edi
+  8011f9:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8011fb:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8011ff:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  801203:	7f e4                	jg     8011e9 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  801205:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  801208:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80120c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801211:	48 f7 f1             	div    %rcx
+  801214:	48 b8 90 62 80 00 00 	movabs $0x806290,%rax
+  80121b:	00 00 00 
+  80121e:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  801222:	0f be c0             	movsbl %al,%eax
+  801225:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801229:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80122d:	48 89 d6             	mov    %rdx,%rsi
+  801230:	89 c7                	mov    %eax,%edi
+  801232:	ff d1                	call   *%rcx
+}
+  801234:	90                   	nop
+  801235:	c9                   	leave
+  801236:	c3                   	ret
+
+0000000000801237 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  801237:	55                   	push   %rbp
+  801238:	48 89 e5             	mov    %rsp,%rbp
+  80123b:	48 83 ec 10          	sub    $0x10,%rsp
+  80123f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801243:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  801246:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80124a:	7e 4b                	jle    801297 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80124c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801250:	8b 00                	mov    (%rax),%eax
+  801252:	83 f8 2f             	cmp    $0x2f,%eax
+  801255:	77 24                	ja     80127b <getuint+0x44>
+  801257:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80125b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80125f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801263:	8b 00                	mov    (%rax),%eax
+  801265:	89 c0                	mov    %eax,%eax
+  801267:	48 01 d0             	add    %rdx,%rax
+  80126a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80126e:	8b 12                	mov    (%rdx),%edx
+  801270:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801273:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801277:	89 0a                	mov    %ecx,(%rdx)
+  801279:	eb 14                	jmp    80128f <getuint+0x58>
+  80127b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80127f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801283:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801287:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80128b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80128f:	48 8b 00             	mov    (%rax),%rax
+  801292:	e9 95 00 00 00       	jmp    80132c <getuint+0xf5>
+  else if (lflag)
+  801297:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80129b:	74 48                	je     8012e5 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80129d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012a1:	8b 00                	mov    (%rax),%eax
+  8012a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8012a6:	77 24                	ja     8012cc <getuint+0x95>
+  8012a8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012ac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8012b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012b4:	8b 00                	mov    (%rax),%eax
+  8012b6:	89 c0                	mov    %eax,%eax
+  8012b8:	48 01 d0             	add    %rdx,%rax
+  8012bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012bf:	8b 12                	mov    (%rdx),%edx
+  8012c1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8012c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012c8:	89 0a                	mov    %ecx,(%rdx)
+  8012ca:	eb 14                	jmp    8012e0 <getuint+0xa9>
+  8012cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012d0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8012d4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8012d8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8012dc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8012e0:	48 8b 00             	mov    (%rax),%rax
+  8012e3:	eb 47                	jmp    80132c <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8012e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012e9:	8b 00                	mov    (%rax),%eax
+  8012eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8012ee:	77 24                	ja     801314 <getuint+0xdd>
+  8012f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012f4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8012f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8012fc:	8b 00                	mov    (%rax),%eax
+  8012fe:	89 c0                	mov    %eax,%eax
+  801300:	48 01 d0             	add    %rdx,%rax
+  801303:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801307:	8b 12                	mov    (%rdx),%edx
+  801309:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80130c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801310:	89 0a                	mov    %ecx,(%rdx)
+  801312:	eb 14                	jmp    801328 <getuint+0xf1>
+  801314:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801318:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80131c:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801320:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801324:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801328:	8b 00                	mov    (%rax),%eax
+  80132a:	89 c0                	mov    %eax,%eax
+}
+  80132c:	c9                   	leave
+  80132d:	c3                   	ret
+
+000000000080132e <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80132e:	55                   	push   %rbp
+  80132f:	48 89 e5             	mov    %rsp,%rbp
+  801332:	48 83 ec 10          	sub    $0x10,%rsp
+  801336:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80133a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80133d:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  801341:	7e 4b                	jle    80138e <getint+0x60>
+    return va_arg(*ap, long long);
+  801343:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801347:	8b 00                	mov    (%rax),%eax
+  801349:	83 f8 2f             	cmp    $0x2f,%eax
+  80134c:	77 24                	ja     801372 <getint+0x44>
+  80134e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801352:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  801356:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80135a:	8b 00                	mov    (%rax),%eax
+  80135c:	89 c0                	mov    %eax,%eax
+  80135e:	48 01 d0             	add    %rdx,%rax
+  801361:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801365:	8b 12                	mov    (%rdx),%edx
+  801367:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80136a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80136e:	89 0a                	mov    %ecx,(%rdx)
+  801370:	eb 14                	jmp    801386 <getint+0x58>
+  801372:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801376:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80137a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80137e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801382:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  801386:	48 8b 00             	mov    (%rax),%rax
+  801389:	e9 95 00 00 00       	jmp    801423 <getint+0xf5>
+  else if (lflag)
+  80138e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  801392:	74 48                	je     8013dc <getint+0xae>
+    return va_arg(*ap, long);
+  801394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801398:	8b 00                	mov    (%rax),%eax
+  80139a:	83 f8 2f             	cmp    $0x2f,%eax
+  80139d:	77 24                	ja     8013c3 <getint+0x95>
+  80139f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013a3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8013a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013ab:	8b 00                	mov    (%rax),%eax
+  8013ad:	89 c0                	mov    %eax,%eax
+  8013af:	48 01 d0             	add    %rdx,%rax
+  8013b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013b6:	8b 12                	mov    (%rdx),%edx
+  8013b8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8013bb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013bf:	89 0a                	mov    %ecx,(%rdx)
+  8013c1:	eb 14                	jmp    8013d7 <getint+0xa9>
+  8013c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013c7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8013cb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8013cf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013d3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8013d7:	48 8b 00             	mov    (%rax),%rax
+  8013da:	eb 47                	jmp    801423 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8013dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013e0:	8b 00                	mov    (%rax),%eax
+  8013e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8013e5:	77 24                	ja     80140b <getint+0xdd>
+  8013e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013eb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8013ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8013f3:	8b 00                	mov    (%rax),%eax
+  8013f5:	89 c0                	mov    %eax,%eax
+  8013f7:	48 01 d0             	add    %rdx,%rax
+  8013fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8013fe:	8b 12                	mov    (%rdx),%edx
+  801400:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  801403:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801407:	89 0a                	mov    %ecx,(%rdx)
+  801409:	eb 14                	jmp    80141f <getint+0xf1>
+  80140b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80140f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801413:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  801417:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80141b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80141f:	8b 00                	mov    (%rax),%eax
+  801421:	48 98                	cltq
+}
+  801423:	c9                   	leave
+  801424:	c3                   	ret
+
+0000000000801425 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  801425:	55                   	push   %rbp
+  801426:	48 89 e5             	mov    %rsp,%rbp
+  801429:	41 54                	push   %r12
+  80142b:	53                   	push   %rbx
+  80142c:	48 83 ec 60          	sub    $0x60,%rsp
+  801430:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801434:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  801438:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  80143c:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  801440:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801444:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  801448:	48 8b 06             	mov    (%rsi),%rax
+  80144b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  80144f:	48 89 01             	mov    %rax,(%rcx)
+  801452:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  801456:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  80145a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  80145e:	eb 17                	jmp    801477 <vprintfmt+0x52>
+      if (ch == '\0')
+  801460:	85 db                	test   %ebx,%ebx
+  801462:	0f 84 bf 04 00 00    	je     801927 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  801468:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80146c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801470:	48 89 c6             	mov    %rax,%rsi
+  801473:	89 df                	mov    %ebx,%edi
+  801475:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  801477:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80147b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80147f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  801483:	0f b6 00             	movzbl (%rax),%eax
+  801486:	0f b6 d8             	movzbl %al,%ebx
+  801489:	83 fb 25             	cmp    $0x25,%ebx
+  80148c:	75 d2                	jne    801460 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  80148e:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  801492:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  801499:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8014a0:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8014a7:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8014ae:	eb 04                	jmp    8014b4 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8014b0:	90                   	nop
+  8014b1:	eb 01                	jmp    8014b4 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8014b3:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8014b4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8014b8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8014bc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8014c0:	0f b6 00             	movzbl (%rax),%eax
+  8014c3:	0f b6 d8             	movzbl %al,%ebx
+  8014c6:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  8014c9:	83 f8 55             	cmp    $0x55,%eax
+  8014cc:	0f 87 22 04 00 00    	ja     8018f4 <vprintfmt+0x4cf>
+  8014d2:	89 c0                	mov    %eax,%eax
+  8014d4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  8014db:	00 
+  8014dc:	48 b8 b8 62 80 00 00 	movabs $0x8062b8,%rax
+  8014e3:	00 00 00 
+  8014e6:	48 01 d0             	add    %rdx,%rax
+  8014e9:	48 8b 00             	mov    (%rax),%rax
+  8014ec:	ff e0                	jmp    *%rax
+        padc = '-';
+  8014ee:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  8014f2:	eb c0                	jmp    8014b4 <vprintfmt+0x8f>
+        padc = '0';
+  8014f4:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  8014f8:	eb ba                	jmp    8014b4 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  8014fa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  801501:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  801504:	89 d0                	mov    %edx,%eax
+  801506:	c1 e0 02             	shl    $0x2,%eax
+  801509:	01 d0                	add    %edx,%eax
+  80150b:	01 c0                	add    %eax,%eax
+  80150d:	01 d8                	add    %ebx,%eax
+  80150f:	83 e8 30             	sub    $0x30,%eax
+  801512:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  801515:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801519:	0f b6 00             	movzbl (%rax),%eax
+  80151c:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  80151f:	83 fb 2f             	cmp    $0x2f,%ebx
+  801522:	7e 60                	jle    801584 <vprintfmt+0x15f>
+  801524:	83 fb 39             	cmp    $0x39,%ebx
+  801527:	7f 5b                	jg     801584 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  801529:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  80152e:	eb d1                	jmp    801501 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  801530:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801533:	83 f8 2f             	cmp    $0x2f,%eax
+  801536:	77 17                	ja     80154f <vprintfmt+0x12a>
+  801538:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80153c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80153f:	89 d2                	mov    %edx,%edx
+  801541:	48 01 d0             	add    %rdx,%rax
+  801544:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801547:	83 c2 08             	add    $0x8,%edx
+  80154a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80154d:	eb 0c                	jmp    80155b <vprintfmt+0x136>
+  80154f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801553:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801557:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80155b:	8b 00                	mov    (%rax),%eax
+  80155d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  801560:	eb 23                	jmp    801585 <vprintfmt+0x160>
+        if (width < 0)
+  801562:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801566:	0f 89 44 ff ff ff    	jns    8014b0 <vprintfmt+0x8b>
+          width = 0;
+  80156c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  801573:	e9 38 ff ff ff       	jmp    8014b0 <vprintfmt+0x8b>
+        altflag = 1;
+  801578:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  80157f:	e9 30 ff ff ff       	jmp    8014b4 <vprintfmt+0x8f>
+        goto process_precision;
+  801584:	90                   	nop
+        if (width < 0)
+  801585:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801589:	0f 89 24 ff ff ff    	jns    8014b3 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  80158f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  801592:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801595:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  80159c:	e9 12 ff ff ff       	jmp    8014b3 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8015a1:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8015a5:	e9 0a ff ff ff       	jmp    8014b4 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8015aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8015b0:	77 17                	ja     8015c9 <vprintfmt+0x1a4>
+  8015b2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015b6:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8015b9:	89 d2                	mov    %edx,%edx
+  8015bb:	48 01 d0             	add    %rdx,%rax
+  8015be:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8015c1:	83 c2 08             	add    $0x8,%edx
+  8015c4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8015c7:	eb 0c                	jmp    8015d5 <vprintfmt+0x1b0>
+  8015c9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8015cd:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8015d1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8015d5:	8b 00                	mov    (%rax),%eax
+  8015d7:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  8015db:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8015df:	48 89 d6             	mov    %rdx,%rsi
+  8015e2:	89 c7                	mov    %eax,%edi
+  8015e4:	ff d1                	call   *%rcx
+        break;
+  8015e6:	e9 37 03 00 00       	jmp    801922 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  8015eb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015ee:	83 f8 2f             	cmp    $0x2f,%eax
+  8015f1:	77 17                	ja     80160a <vprintfmt+0x1e5>
+  8015f3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015f7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8015fa:	89 d2                	mov    %edx,%edx
+  8015fc:	48 01 d0             	add    %rdx,%rax
+  8015ff:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801602:	83 c2 08             	add    $0x8,%edx
+  801605:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801608:	eb 0c                	jmp    801616 <vprintfmt+0x1f1>
+  80160a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80160e:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  801612:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801616:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  801618:	85 db                	test   %ebx,%ebx
+  80161a:	79 02                	jns    80161e <vprintfmt+0x1f9>
+          err = -err;
+  80161c:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80161e:	83 fb 15             	cmp    $0x15,%ebx
+  801621:	7f 16                	jg     801639 <vprintfmt+0x214>
+  801623:	48 ba e0 61 80 00 00 	movabs $0x8061e0,%rdx
+  80162a:	00 00 00 
+  80162d:	48 63 c3             	movslq %ebx,%rax
+  801630:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  801634:	4d 85 e4             	test   %r12,%r12
+  801637:	75 2e                	jne    801667 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  801639:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80163d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801641:	89 d9                	mov    %ebx,%ecx
+  801643:	48 ba a1 62 80 00 00 	movabs $0x8062a1,%rdx
+  80164a:	00 00 00 
+  80164d:	48 89 c7             	mov    %rax,%rdi
+  801650:	b8 00 00 00 00       	mov    $0x0,%eax
+  801655:	49 b8 31 19 80 00 00 	movabs $0x801931,%r8
+  80165c:	00 00 00 
+  80165f:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  801662:	e9 bb 02 00 00       	jmp    801922 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  801667:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80166b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80166f:	4c 89 e1             	mov    %r12,%rcx
+  801672:	48 ba aa 62 80 00 00 	movabs $0x8062aa,%rdx
+  801679:	00 00 00 
+  80167c:	48 89 c7             	mov    %rax,%rdi
+  80167f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801684:	49 b8 31 19 80 00 00 	movabs $0x801931,%r8
+  80168b:	00 00 00 
+  80168e:	41 ff d0             	call   *%r8
+        break;
+  801691:	e9 8c 02 00 00       	jmp    801922 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  801696:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801699:	83 f8 2f             	cmp    $0x2f,%eax
+  80169c:	77 17                	ja     8016b5 <vprintfmt+0x290>
+  80169e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016a2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8016a5:	89 d2                	mov    %edx,%edx
+  8016a7:	48 01 d0             	add    %rdx,%rax
+  8016aa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8016ad:	83 c2 08             	add    $0x8,%edx
+  8016b0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8016b3:	eb 0c                	jmp    8016c1 <vprintfmt+0x29c>
+  8016b5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8016b9:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8016bd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8016c1:	4c 8b 20             	mov    (%rax),%r12
+  8016c4:	4d 85 e4             	test   %r12,%r12
+  8016c7:	75 0a                	jne    8016d3 <vprintfmt+0x2ae>
+          p = "(null)";
+  8016c9:	49 bc ad 62 80 00 00 	movabs $0x8062ad,%r12
+  8016d0:	00 00 00 
+        if (width > 0 && padc != '-')
+  8016d3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8016d7:	7e 78                	jle    801751 <vprintfmt+0x32c>
+  8016d9:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  8016dd:	74 72                	je     801751 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  8016df:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8016e2:	48 98                	cltq
+  8016e4:	48 89 c6             	mov    %rax,%rsi
+  8016e7:	4c 89 e7             	mov    %r12,%rdi
+  8016ea:	48 b8 3d 20 80 00 00 	movabs $0x80203d,%rax
+  8016f1:	00 00 00 
+  8016f4:	ff d0                	call   *%rax
+  8016f6:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  8016f9:	eb 17                	jmp    801712 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  8016fb:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  8016ff:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  801703:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801707:	48 89 d6             	mov    %rdx,%rsi
+  80170a:	89 c7                	mov    %eax,%edi
+  80170c:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  80170e:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801712:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801716:	7f e3                	jg     8016fb <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  801718:	eb 37                	jmp    801751 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  80171a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  80171e:	74 1e                	je     80173e <vprintfmt+0x319>
+  801720:	83 fb 1f             	cmp    $0x1f,%ebx
+  801723:	7e 05                	jle    80172a <vprintfmt+0x305>
+  801725:	83 fb 7e             	cmp    $0x7e,%ebx
+  801728:	7e 14                	jle    80173e <vprintfmt+0x319>
+            putch('?', putdat);
+  80172a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80172e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801732:	48 89 c6             	mov    %rax,%rsi
+  801735:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80173a:	ff d2                	call   *%rdx
+  80173c:	eb 0f                	jmp    80174d <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  80173e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801742:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  801746:	48 89 c6             	mov    %rax,%rsi
+  801749:	89 df                	mov    %ebx,%edi
+  80174b:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80174d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  801751:	4c 89 e0             	mov    %r12,%rax
+  801754:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  801758:	0f b6 00             	movzbl (%rax),%eax
+  80175b:	0f be d8             	movsbl %al,%ebx
+  80175e:	85 db                	test   %ebx,%ebx
+  801760:	74 28                	je     80178a <vprintfmt+0x365>
+  801762:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801766:	78 b2                	js     80171a <vprintfmt+0x2f5>
+  801768:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  80176c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  801770:	79 a8                	jns    80171a <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  801772:	eb 16                	jmp    80178a <vprintfmt+0x365>
+          putch(' ', putdat);
+  801774:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801778:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80177c:	48 89 c6             	mov    %rax,%rsi
+  80177f:	bf 20 00 00 00       	mov    $0x20,%edi
+  801784:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  801786:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  80178a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80178e:	7f e4                	jg     801774 <vprintfmt+0x34f>
+        break;
+  801790:	e9 8d 01 00 00       	jmp    801922 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  801795:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801798:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  80179c:	89 d6                	mov    %edx,%esi
+  80179e:	48 89 c7             	mov    %rax,%rdi
+  8017a1:	48 b8 2e 13 80 00 00 	movabs $0x80132e,%rax
+  8017a8:	00 00 00 
+  8017ab:	ff d0                	call   *%rax
+  8017ad:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8017b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b5:	48 85 c0             	test   %rax,%rax
+  8017b8:	79 1d                	jns    8017d7 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8017ba:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8017be:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8017c2:	48 89 c6             	mov    %rax,%rsi
+  8017c5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8017ca:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  8017cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d0:	48 f7 d8             	neg    %rax
+  8017d3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  8017d7:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  8017de:	e9 d2 00 00 00       	jmp    8018b5 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  8017e3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8017e6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8017ea:	89 d6                	mov    %edx,%esi
+  8017ec:	48 89 c7             	mov    %rax,%rdi
+  8017ef:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8017f6:	00 00 00 
+  8017f9:	ff d0                	call   *%rax
+  8017fb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  8017ff:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  801806:	e9 aa 00 00 00       	jmp    8018b5 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  80180b:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  80180e:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801812:	89 d6                	mov    %edx,%esi
+  801814:	48 89 c7             	mov    %rax,%rdi
+  801817:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  80181e:	00 00 00 
+  801821:	ff d0                	call   *%rax
+  801823:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  801827:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  80182e:	e9 82 00 00 00       	jmp    8018b5 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  801833:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801837:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80183b:	48 89 c6             	mov    %rax,%rsi
+  80183e:	bf 30 00 00 00       	mov    $0x30,%edi
+  801843:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  801845:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801849:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80184d:	48 89 c6             	mov    %rax,%rsi
+  801850:	bf 78 00 00 00       	mov    $0x78,%edi
+  801855:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  801857:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80185a:	83 f8 2f             	cmp    $0x2f,%eax
+  80185d:	77 17                	ja     801876 <vprintfmt+0x451>
+  80185f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801863:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801866:	89 d2                	mov    %edx,%edx
+  801868:	48 01 d0             	add    %rdx,%rax
+  80186b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80186e:	83 c2 08             	add    $0x8,%edx
+  801871:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801874:	eb 0c                	jmp    801882 <vprintfmt+0x45d>
+  801876:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80187a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80187e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801882:	48 8b 00             	mov    (%rax),%rax
+  801885:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  801889:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  801890:	eb 23                	jmp    8018b5 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  801892:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801895:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801899:	89 d6                	mov    %edx,%esi
+  80189b:	48 89 c7             	mov    %rax,%rdi
+  80189e:	48 b8 37 12 80 00 00 	movabs $0x801237,%rax
+  8018a5:	00 00 00 
+  8018a8:	ff d0                	call   *%rax
+  8018aa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  8018ae:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  8018b5:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  8018ba:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8018bd:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  8018c0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8018c4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8018c8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8018cc:	45 89 c1             	mov    %r8d,%r9d
+  8018cf:	41 89 f8             	mov    %edi,%r8d
+  8018d2:	48 89 c7             	mov    %rax,%rdi
+  8018d5:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  8018dc:	00 00 00 
+  8018df:	ff d0                	call   *%rax
+        break;
+  8018e1:	eb 3f                	jmp    801922 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  8018e3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8018e7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8018eb:	48 89 c6             	mov    %rax,%rsi
+  8018ee:	89 df                	mov    %ebx,%edi
+  8018f0:	ff d2                	call   *%rdx
+        break;
+  8018f2:	eb 2e                	jmp    801922 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  8018f4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8018f8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8018fc:	48 89 c6             	mov    %rax,%rsi
+  8018ff:	bf 25 00 00 00       	mov    $0x25,%edi
+  801904:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  801906:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  80190b:	eb 05                	jmp    801912 <vprintfmt+0x4ed>
+  80190d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  801912:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  801916:	48 83 e8 01          	sub    $0x1,%rax
+  80191a:	0f b6 00             	movzbl (%rax),%eax
+  80191d:	3c 25                	cmp    $0x25,%al
+  80191f:	75 ec                	jne    80190d <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  801921:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  801922:	e9 50 fb ff ff       	jmp    801477 <vprintfmt+0x52>
+        return;
+  801927:	90                   	nop
+    }
+  }
+}
+  801928:	48 83 c4 60          	add    $0x60,%rsp
+  80192c:	5b                   	pop    %rbx
+  80192d:	41 5c                	pop    %r12
+  80192f:	5d                   	pop    %rbp
+  801930:	c3                   	ret
+
+0000000000801931 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801931:	55                   	push   %rbp
+  801932:	48 89 e5             	mov    %rsp,%rbp
+  801935:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80193c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801943:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  80194a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801951:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801958:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  80195f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801966:	84 c0                	test   %al,%al
+  801968:	74 20                	je     80198a <printfmt+0x59>
+  80196a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80196e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801972:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801976:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80197a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80197e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801982:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801986:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  80198a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801991:	00 00 00 
+  801994:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80199b:	00 00 00 
+  80199e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8019a2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  8019a9:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8019b0:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  8019b7:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  8019be:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8019c5:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  8019cc:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8019d3:	48 89 c7             	mov    %rax,%rdi
+  8019d6:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  8019dd:	00 00 00 
+  8019e0:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  8019e2:	90                   	nop
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+
+00000000008019e5 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  8019e5:	55                   	push   %rbp
+  8019e6:	48 89 e5             	mov    %rsp,%rbp
+  8019e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8019ed:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8019f0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  8019f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019f8:	8b 40 10             	mov    0x10(%rax),%eax
+  8019fb:	8d 50 01             	lea    0x1(%rax),%edx
+  8019fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a02:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801a05:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a09:	48 8b 10             	mov    (%rax),%rdx
+  801a0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a10:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801a14:	48 39 c2             	cmp    %rax,%rdx
+  801a17:	73 17                	jae    801a30 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801a19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a1d:	48 8b 00             	mov    (%rax),%rax
+  801a20:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801a24:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a28:	48 89 0a             	mov    %rcx,(%rdx)
+  801a2b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  801a2e:	88 10                	mov    %dl,(%rax)
+}
+  801a30:	90                   	nop
+  801a31:	c9                   	leave
+  801a32:	c3                   	ret
+
+0000000000801a33 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801a33:	55                   	push   %rbp
+  801a34:	48 89 e5             	mov    %rsp,%rbp
+  801a37:	48 83 ec 40          	sub    $0x40,%rsp
+  801a3b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a3f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801a42:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801a46:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801a4a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a4e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801a52:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801a55:	48 98                	cltq
+  801a57:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a5b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a5f:	48 01 d0             	add    %rdx,%rax
+  801a62:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801a66:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  801a6d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801a72:	74 06                	je     801a7a <vsnprintf+0x47>
+  801a74:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801a78:	7f 07                	jg     801a81 <vsnprintf+0x4e>
+    return -E_INVAL;
+  801a7a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7f:	eb 32                	jmp    801ab3 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  801a81:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801a85:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a89:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  801a8d:	48 89 c6             	mov    %rax,%rsi
+  801a90:	48 b8 e5 19 80 00 00 	movabs $0x8019e5,%rax
+  801a97:	00 00 00 
+  801a9a:	48 89 c7             	mov    %rax,%rdi
+  801a9d:	48 b8 25 14 80 00 00 	movabs $0x801425,%rax
+  801aa4:	00 00 00 
+  801aa7:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801aa9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801aad:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801ab0:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801ab3:	c9                   	leave
+  801ab4:	c3                   	ret
+
+0000000000801ab5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801ab5:	55                   	push   %rbp
+  801ab6:	48 89 e5             	mov    %rsp,%rbp
+  801ab9:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  801ac0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801ac7:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  801acd:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801ad4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801adb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801ae2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801ae9:	84 c0                	test   %al,%al
+  801aeb:	74 20                	je     801b0d <snprintf+0x58>
+  801aed:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801af1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801af5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801af9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801afd:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  801b01:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801b05:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801b09:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  801b0d:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801b14:	00 00 00 
+  801b17:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  801b1e:	00 00 00 
+  801b21:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801b25:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  801b2c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801b33:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801b3a:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801b41:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801b48:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  801b4e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801b55:	48 89 c7             	mov    %rax,%rdi
+  801b58:	48 b8 33 1a 80 00 00 	movabs $0x801a33,%rax
+  801b5f:	00 00 00 
+  801b62:	ff d0                	call   *%rax
+  801b64:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801b6a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801b70:	c9                   	leave
+  801b71:	c3                   	ret
+
+0000000000801b72 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801b72:	55                   	push   %rbp
+  801b73:	48 89 e5             	mov    %rsp,%rbp
+  801b76:	53                   	push   %rbx
+  801b77:	48 83 ec 38          	sub    $0x38,%rsp
+  801b7b:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  801b7e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801b82:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801b86:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801b8a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  801b8e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801b91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b96:	89 d1                	mov    %edx,%ecx
+  801b98:	0f a2                	cpuid
+  801b9a:	89 de                	mov    %ebx,%esi
+  801b9c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  801b9f:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801ba2:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801ba5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801ba8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801bad:	74 09                	je     801bb8 <cpuid+0x46>
+}
+  801baf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bb3:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801bb6:	89 10                	mov    %edx,(%rax)
+
+  801bb8:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801bbd:	74 09                	je     801bc8 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  801bbf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801bc6:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801bc8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  801bcd:	74 09                	je     801bd8 <cpuid+0x66>
+char *
+  801bcf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bd3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801bd6:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801bd8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  801bdd:	74 09                	je     801be8 <cpuid+0x76>
+  for (; *s; s++)
+  801bdf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801be3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801be6:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801be8:	90                   	nop
+  801be9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801bed:	c9                   	leave
+  801bee:	c3                   	ret
+
+0000000000801bef <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  801bef:	55                   	push   %rbp
+  801bf0:	48 89 e5             	mov    %rsp,%rbp
+  801bf3:	48 83 ec 18          	sub    $0x18,%rsp
+  801bf7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801bfa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801bfd:	89 c1                	mov    %eax,%ecx
+  801bff:	0f 01 d0             	xgetbv
+  801c02:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801c05:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801c08:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801c0b:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  801c0e:	48 c1 e2 20          	shl    $0x20,%rdx
+  801c12:	48 09 d0             	or     %rdx,%rax
+#else
+  801c15:	c9                   	leave
+  801c16:	c3                   	ret
+
+0000000000801c17 <string_cpu>:
+string_cpu(void) {
+  801c17:	55                   	push   %rbp
+  801c18:	48 89 e5             	mov    %rsp,%rbp
+  801c1b:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  801c1f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801c26:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  801c2d:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801c34:	00 00 00 
+  801c37:	8b 00                	mov    (%rax),%eax
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	78 11                	js     801c4e <string_cpu+0x37>
+    return string_features;
+  801c3d:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801c44:	00 00 00 
+  801c47:	8b 00                	mov    (%rax),%eax
+  801c49:	e9 df 00 00 00       	jmp    801d2d <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  801c4e:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801c52:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c62:	48 89 c6             	mov    %rax,%rsi
+  801c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6a:	48 b8 72 1b 80 00 00 	movabs $0x801b72,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801c76:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801c79:	83 f8 06             	cmp    $0x6,%eax
+  801c7c:	76 28                	jbe    801ca6 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  801c7e:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801c82:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c8d:	48 89 c2             	mov    %rax,%rdx
+  801c90:	be 00 00 00 00       	mov    $0x0,%esi
+  801c95:	bf 07 00 00 00       	mov    $0x7,%edi
+  801c9a:	48 b8 72 1b 80 00 00 	movabs $0x801b72,%rax
+  801ca1:	00 00 00 
+  801ca4:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801ca6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ca9:	25 00 02 00 00       	and    $0x200,%eax
+  801cae:	85 c0                	test   %eax,%eax
+  801cb0:	74 04                	je     801cb6 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801cb2:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801cb6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801cba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cc0:	48 89 c1             	mov    %rax,%rcx
+  801cc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc8:	be 00 00 00 00       	mov    $0x0,%esi
+  801ccd:	bf 01 00 00 00       	mov    $0x1,%edi
+  801cd2:	48 b8 72 1b 80 00 00 	movabs $0x801b72,%rax
+  801cd9:	00 00 00 
+  801cdc:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801cde:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801ce1:	83 e0 20             	and    $0x20,%eax
+  801ce4:	85 c0                	test   %eax,%eax
+  801ce6:	74 2a                	je     801d12 <string_cpu+0xfb>
+  801ce8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  801ceb:	25 00 00 00 08       	and    $0x8000000,%eax
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	74 1e                	je     801d12 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801cf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf9:	48 b8 ef 1b 80 00 00 	movabs $0x801bef,%rax
+  801d00:	00 00 00 
+  801d03:	ff d0                	call   *%rax
+  801d05:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801d08:	48 83 f8 06          	cmp    $0x6,%rax
+  801d0c:	75 04                	jne    801d12 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  801d0e:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801d12:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801d19:	00 00 00 
+  801d1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801d1f:	89 02                	mov    %eax,(%rdx)
+  801d21:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801d28:	00 00 00 
+  801d2b:	8b 00                	mov    (%rax),%eax
+}
+  801d2d:	c9                   	leave
+  801d2e:	c3                   	ret
+
+0000000000801d2f <strlen_avx2>:
+strlen_avx2(const char *s) {
+  801d2f:	55                   	push   %rbp
+  801d30:	48 89 e5             	mov    %rsp,%rbp
+  801d33:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801d37:	48 83 ec 60          	sub    $0x60,%rsp
+  801d3b:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801d40:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801d45:	83 e0 1f             	and    $0x1f,%eax
+  801d48:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  801d4c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801d50:	48 f7 d8             	neg    %rax
+  801d53:	48 89 c2             	mov    %rax,%rdx
+  801d56:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801d5b:	48 01 d0             	add    %rdx,%rax
+  801d5e:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801d63:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801d67:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  801d6d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801d72:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801d76:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801d7c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801d80:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801d84:	89 c2                	mov    %eax,%edx
+  801d86:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801d8a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801d8f:	89 c1                	mov    %eax,%ecx
+  801d91:	d3 e6                	shl    %cl,%esi
+  801d93:	89 f0                	mov    %esi,%eax
+  801d95:	21 d0                	and    %edx,%eax
+  801d97:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801d9b:	eb 21                	jmp    801dbe <strlen_avx2+0x8f>
+    p += 32;
+  801d9d:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801da3:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801da8:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801dac:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801db2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801db6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801dba:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801dbe:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801dc3:	74 d8                	je     801d9d <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801dc5:	31 c0                	xor    %eax,%eax
+  801dc7:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801dcd:	48 63 d0             	movslq %eax,%rdx
+  801dd0:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801dd5:	48 01 d0             	add    %rdx,%rax
+  801dd8:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801ddd:	c9                   	leave
+  801dde:	c3                   	ret
+
+0000000000801ddf <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801ddf:	55                   	push   %rbp
+  801de0:	48 89 e5             	mov    %rsp,%rbp
+  801de3:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801de7:	48 83 ec 40          	sub    $0x40,%rsp
+  801deb:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801df0:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801df5:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801dfa:	eb 77                	jmp    801e73 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801dfc:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801e01:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801e05:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801e09:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801e0e:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801e12:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801e16:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801e1a:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801e1e:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801e23:	74 3c                	je     801e61 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801e25:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801e29:	f7 d0                	not    %eax
+  801e2b:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801e2f:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801e33:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801e37:	48 63 d0             	movslq %eax,%rdx
+  801e3a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801e3f:	48 01 d0             	add    %rdx,%rax
+  801e42:	0f b6 00             	movzbl (%rax),%eax
+  801e45:	0f b6 c0             	movzbl %al,%eax
+  801e48:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801e4c:	48 63 ca             	movslq %edx,%rcx
+  801e4f:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801e54:	48 01 ca             	add    %rcx,%rdx
+  801e57:	0f b6 12             	movzbl (%rdx),%edx
+  801e5a:	0f b6 d2             	movzbl %dl,%edx
+  801e5d:	29 d0                	sub    %edx,%eax
+  801e5f:	eb 6b                	jmp    801ecc <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801e61:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801e67:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  801e6d:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801e73:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801e79:	77 81                	ja     801dfc <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801e7b:	eb 42                	jmp    801ebf <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  801e7d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801e82:	0f b6 10             	movzbl (%rax),%edx
+  801e85:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801e8a:	0f b6 00             	movzbl (%rax),%eax
+  801e8d:	38 c2                	cmp    %al,%dl
+  801e8f:	74 1c                	je     801ead <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801e91:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801e96:	0f b6 00             	movzbl (%rax),%eax
+  801e99:	0f b6 c8             	movzbl %al,%ecx
+  801e9c:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801ea1:	0f b6 00             	movzbl (%rax),%eax
+  801ea4:	0f b6 d0             	movzbl %al,%edx
+  801ea7:	89 c8                	mov    %ecx,%eax
+  801ea9:	29 d0                	sub    %edx,%eax
+  801eab:	eb 1f                	jmp    801ecc <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  801ead:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801eb3:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801eb9:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801ebf:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801ec5:	75 b6                	jne    801e7d <memcmp_avx2+0x9e>
+  return 0;
+  801ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ecc:	c9                   	leave
+  801ecd:	c3                   	ret
+
+0000000000801ece <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801ece:	55                   	push   %rbp
+  801ecf:	48 89 e5             	mov    %rsp,%rbp
+  801ed2:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801ed6:	48 83 ec 60          	sub    $0x60,%rsp
+  801eda:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801edf:	89 f0                	mov    %esi,%eax
+  801ee1:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801ee6:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801eea:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801eef:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801ef3:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801ef8:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801efe:	eb 47                	jmp    801f47 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801f00:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801f05:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801f09:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801f0d:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801f13:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801f17:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801f1b:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801f1f:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801f24:	74 15                	je     801f3b <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801f26:	31 c0                	xor    %eax,%eax
+  801f28:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801f2e:	48 63 d0             	movslq %eax,%rdx
+  801f31:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801f36:	48 01 d0             	add    %rdx,%rax
+  801f39:	eb 3d                	jmp    801f78 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801f3b:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801f41:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801f47:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801f4d:	77 b1                	ja     801f00 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801f4f:	eb 0c                	jmp    801f5d <memfind_avx2+0x8f>
+  801f51:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801f57:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801f5d:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801f63:	74 0e                	je     801f73 <memfind_avx2+0xa5>
+  801f65:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801f6a:	0f b6 00             	movzbl (%rax),%eax
+  801f6d:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801f71:	75 de                	jne    801f51 <memfind_avx2+0x83>
+  return s;
+  801f73:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801f78:	c9                   	leave
+  801f79:	c3                   	ret
+
+0000000000801f7a <strlen>:
+strlen(const char *s) {
+  801f7a:	55                   	push   %rbp
+  801f7b:	48 89 e5             	mov    %rsp,%rbp
+  801f7e:	48 83 ec 40          	sub    $0x40,%rsp
+  801f82:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801f86:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801f8a:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  801f8e:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  801f95:	00 00 00 
+  801f98:	ff d0                	call   *%rax
+  801f9a:	83 e0 02             	and    $0x2,%eax
+  801f9d:	85 c0                	test   %eax,%eax
+  801f9f:	74 18                	je     801fb9 <strlen+0x3f>
+    return strlen_avx2(s);
+  801fa1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fa5:	48 89 c7             	mov    %rax,%rdi
+  801fa8:	48 b8 2f 1d 80 00 00 	movabs $0x801d2f,%rax
+  801faf:	00 00 00 
+  801fb2:	ff d0                	call   *%rax
+  801fb4:	e9 82 00 00 00       	jmp    80203b <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801fb9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fbd:	83 e0 0f             	and    $0xf,%eax
+  801fc0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801fc3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801fc6:	48 f7 d8             	neg    %rax
+  801fc9:	48 89 c2             	mov    %rax,%rdx
+  801fcc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fd0:	48 01 d0             	add    %rdx,%rax
+  801fd3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801fd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801fdb:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801fdf:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801fe4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801fe8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801fec:	89 c2                	mov    %eax,%edx
+  801fee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801ff1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801ff6:	89 c1                	mov    %eax,%ecx
+  801ff8:	d3 e6                	shl    %cl,%esi
+  801ffa:	89 f0                	mov    %esi,%eax
+  801ffc:	21 d0                	and    %edx,%eax
+  801ffe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  802001:	eb 1d                	jmp    802020 <strlen+0xa6>
+    p += 16;
+  802003:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  802008:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80200c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  802010:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  802015:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802019:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80201d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  802020:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802024:	74 dd                	je     802003 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  802026:	31 c0                	xor    %eax,%eax
+  802028:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80202d:	48 63 d0             	movslq %eax,%rdx
+  802030:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802034:	48 01 d0             	add    %rdx,%rax
+  802037:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80203b:	c9                   	leave
+  80203c:	c3                   	ret
+
+000000000080203d <strnlen>:
+strnlen(const char *s, size_t size) {
+  80203d:	55                   	push   %rbp
+  80203e:	48 89 e5             	mov    %rsp,%rbp
+  802041:	48 83 ec 20          	sub    $0x20,%rsp
+  802045:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802049:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80204d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802054:	eb 0e                	jmp    802064 <strnlen+0x27>
+    n++;
+  802056:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80205a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80205f:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  802064:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802069:	74 0b                	je     802076 <strnlen+0x39>
+  80206b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80206f:	0f b6 00             	movzbl (%rax),%eax
+  802072:	84 c0                	test   %al,%al
+  802074:	75 e0                	jne    802056 <strnlen+0x19>
+  return n;
+  802076:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802079:	c9                   	leave
+  80207a:	c3                   	ret
+
+000000000080207b <strcpy>:
+strcpy(char *dst, const char *src) {
+  80207b:	55                   	push   %rbp
+  80207c:	48 89 e5             	mov    %rsp,%rbp
+  80207f:	48 83 ec 20          	sub    $0x20,%rsp
+  802083:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802087:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80208b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80208f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  802093:	90                   	nop
+  802094:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802098:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80209c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8020a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020a4:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8020a8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020ac:	0f b6 12             	movzbl (%rdx),%edx
+  8020af:	88 10                	mov    %dl,(%rax)
+  8020b1:	0f b6 00             	movzbl (%rax),%eax
+  8020b4:	84 c0                	test   %al,%al
+  8020b6:	75 dc                	jne    802094 <strcpy+0x19>
+  return ret;
+  8020b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8020bc:	c9                   	leave
+  8020bd:	c3                   	ret
+
+00000000008020be <strcat>:
+strcat(char *dst, const char *src) {
+  8020be:	55                   	push   %rbp
+  8020bf:	48 89 e5             	mov    %rsp,%rbp
+  8020c2:	48 83 ec 20          	sub    $0x20,%rsp
+  8020c6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8020ca:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8020ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020d2:	48 89 c7             	mov    %rax,%rdi
+  8020d5:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  8020dc:	00 00 00 
+  8020df:	ff d0                	call   *%rax
+  8020e1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8020e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8020e7:	48 63 d0             	movslq %eax,%rdx
+  8020ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8020ee:	48 01 c2             	add    %rax,%rdx
+  8020f1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020f5:	48 89 c6             	mov    %rax,%rsi
+  8020f8:	48 89 d7             	mov    %rdx,%rdi
+  8020fb:	48 b8 7b 20 80 00 00 	movabs $0x80207b,%rax
+  802102:	00 00 00 
+  802105:	ff d0                	call   *%rax
+  return dst;
+  802107:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80210b:	c9                   	leave
+  80210c:	c3                   	ret
+
+000000000080210d <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80210d:	55                   	push   %rbp
+  80210e:	48 89 e5             	mov    %rsp,%rbp
+  802111:	48 83 ec 28          	sub    $0x28,%rsp
+  802115:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802119:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80211d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  802121:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802125:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  802129:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  802130:	00 
+  802131:	eb 2a                	jmp    80215d <strncpy+0x50>
+    *dst++ = *src;
+  802133:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802137:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80213b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80213f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802143:	0f b6 12             	movzbl (%rdx),%edx
+  802146:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  802148:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80214c:	0f b6 00             	movzbl (%rax),%eax
+  80214f:	84 c0                	test   %al,%al
+  802151:	74 05                	je     802158 <strncpy+0x4b>
+      src++;
+  802153:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  802158:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80215d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802161:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802165:	72 cc                	jb     802133 <strncpy+0x26>
+  return ret;
+  802167:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80216b:	c9                   	leave
+  80216c:	c3                   	ret
+
+000000000080216d <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80216d:	55                   	push   %rbp
+  80216e:	48 89 e5             	mov    %rsp,%rbp
+  802171:	48 83 ec 28          	sub    $0x28,%rsp
+  802175:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802179:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80217d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  802181:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802185:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  802189:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80218e:	74 3d                	je     8021cd <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  802190:	eb 1d                	jmp    8021af <strlcpy+0x42>
+      *dst++ = *src++;
+  802192:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802196:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80219a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80219e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021a2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8021a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8021aa:	0f b6 12             	movzbl (%rdx),%edx
+  8021ad:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8021af:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8021b4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8021b9:	74 0b                	je     8021c6 <strlcpy+0x59>
+  8021bb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021bf:	0f b6 00             	movzbl (%rax),%eax
+  8021c2:	84 c0                	test   %al,%al
+  8021c4:	75 cc                	jne    802192 <strlcpy+0x25>
+    *dst = '\0';
+  8021c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021ca:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8021cd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8021d1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8021d5:	c9                   	leave
+  8021d6:	c3                   	ret
+
+00000000008021d7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8021d7:	55                   	push   %rbp
+  8021d8:	48 89 e5             	mov    %rsp,%rbp
+  8021db:	48 83 ec 30          	sub    $0x30,%rsp
+  8021df:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8021e3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8021e7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8021eb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8021ef:	48 89 c7             	mov    %rax,%rdi
+  8021f2:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+  8021fe:	48 98                	cltq
+  802200:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  802204:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802208:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80220c:	48 89 d6             	mov    %rdx,%rsi
+  80220f:	48 89 c7             	mov    %rax,%rdi
+  802212:	48 b8 3d 20 80 00 00 	movabs $0x80203d,%rax
+  802219:	00 00 00 
+  80221c:	ff d0                	call   *%rax
+  80221e:	48 98                	cltq
+  802220:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  802224:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802228:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80222c:	75 10                	jne    80223e <strlcat+0x67>
+    return maxlen + srclen;
+  80222e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802232:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802236:	48 01 d0             	add    %rdx,%rax
+  802239:	e9 86 00 00 00       	jmp    8022c4 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80223e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802242:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  802246:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80224a:	73 2b                	jae    802277 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80224c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802250:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  802254:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802258:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80225c:	48 01 c1             	add    %rax,%rcx
+  80225f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802263:	48 89 c6             	mov    %rax,%rsi
+  802266:	48 89 cf             	mov    %rcx,%rdi
+  802269:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  802270:	00 00 00 
+  802273:	ff d0                	call   *%rax
+  802275:	eb 42                	jmp    8022b9 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  802277:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80227b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80227f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802283:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802287:	48 01 c1             	add    %rax,%rcx
+  80228a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80228e:	48 89 c6             	mov    %rax,%rsi
+  802291:	48 89 cf             	mov    %rcx,%rdi
+  802294:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  80229b:	00 00 00 
+  80229e:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8022a0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022a8:	48 01 d0             	add    %rdx,%rax
+  8022ab:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8022af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8022b3:	48 01 d0             	add    %rdx,%rax
+  8022b6:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8022b9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8022bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022c1:	48 01 d0             	add    %rdx,%rax
+}
+  8022c4:	c9                   	leave
+  8022c5:	c3                   	ret
+
+00000000008022c6 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8022c6:	55                   	push   %rbp
+  8022c7:	48 89 e5             	mov    %rsp,%rbp
+  8022ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8022ce:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8022d2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8022d6:	eb 0a                	jmp    8022e2 <strcmp+0x1c>
+    p++, q++;
+  8022d8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8022dd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8022e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022e6:	0f b6 00             	movzbl (%rax),%eax
+  8022e9:	84 c0                	test   %al,%al
+  8022eb:	74 12                	je     8022ff <strcmp+0x39>
+  8022ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022f1:	0f b6 10             	movzbl (%rax),%edx
+  8022f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8022f8:	0f b6 00             	movzbl (%rax),%eax
+  8022fb:	38 c2                	cmp    %al,%dl
+  8022fd:	74 d9                	je     8022d8 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8022ff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802303:	0f b6 00             	movzbl (%rax),%eax
+  802306:	0f b6 d0             	movzbl %al,%edx
+  802309:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80230d:	0f b6 00             	movzbl (%rax),%eax
+  802310:	0f b6 c0             	movzbl %al,%eax
+  802313:	29 c2                	sub    %eax,%edx
+  802315:	89 d0                	mov    %edx,%eax
+}
+  802317:	c9                   	leave
+  802318:	c3                   	ret
+
+0000000000802319 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  802319:	55                   	push   %rbp
+  80231a:	48 89 e5             	mov    %rsp,%rbp
+  80231d:	48 83 ec 18          	sub    $0x18,%rsp
+  802321:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802325:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802329:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80232d:	eb 0f                	jmp    80233e <strncmp+0x25>
+    n--, p++, q++;
+  80232f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  802334:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802339:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80233e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802343:	74 1d                	je     802362 <strncmp+0x49>
+  802345:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802349:	0f b6 00             	movzbl (%rax),%eax
+  80234c:	84 c0                	test   %al,%al
+  80234e:	74 12                	je     802362 <strncmp+0x49>
+  802350:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802354:	0f b6 10             	movzbl (%rax),%edx
+  802357:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80235b:	0f b6 00             	movzbl (%rax),%eax
+  80235e:	38 c2                	cmp    %al,%dl
+  802360:	74 cd                	je     80232f <strncmp+0x16>
+  if (n == 0)
+  802362:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802367:	75 07                	jne    802370 <strncmp+0x57>
+    return 0;
+  802369:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236e:	eb 16                	jmp    802386 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802370:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802374:	0f b6 00             	movzbl (%rax),%eax
+  802377:	0f b6 d0             	movzbl %al,%edx
+  80237a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80237e:	0f b6 00             	movzbl (%rax),%eax
+  802381:	0f b6 c0             	movzbl %al,%eax
+  802384:	29 c2                	sub    %eax,%edx
+}
+  802386:	89 d0                	mov    %edx,%eax
+  802388:	c9                   	leave
+  802389:	c3                   	ret
+
+000000000080238a <strchr>:
+strchr(const char *s, char c) {
+  80238a:	55                   	push   %rbp
+  80238b:	48 89 e5             	mov    %rsp,%rbp
+  80238e:	48 83 ec 60          	sub    $0x60,%rsp
+  802392:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802396:	89 f0                	mov    %esi,%eax
+  802398:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80239b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80239f:	83 e0 0f             	and    $0xf,%eax
+  8023a2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8023a5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023a8:	48 f7 d8             	neg    %rax
+  8023ab:	48 89 c2             	mov    %rax,%rdx
+  8023ae:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8023b2:	48 01 d0             	add    %rdx,%rax
+  8023b5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8023b9:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8023bd:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8023c1:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8023c5:	66 0f 6e c0          	movd   %eax,%xmm0
+  8023c9:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8023cd:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8023d1:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8023d6:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8023da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023de:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8023e2:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8023e6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8023eb:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8023f0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8023f4:	89 c2                	mov    %eax,%edx
+  8023f6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8023fb:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  802400:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802404:	09 c2                	or     %eax,%edx
+  802406:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802409:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80240e:	89 c1                	mov    %eax,%ecx
+  802410:	d3 e6                	shl    %cl,%esi
+  802412:	89 f0                	mov    %esi,%eax
+  802414:	21 d0                	and    %edx,%eax
+  802416:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  802419:	eb 34                	jmp    80244f <strchr+0xc5>
+    p += 16;
+  80241b:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  802420:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802424:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  802428:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  80242c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  802431:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  802436:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80243a:	89 c2                	mov    %eax,%edx
+  80243c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  802441:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  802446:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80244a:	09 d0                	or     %edx,%eax
+  80244c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80244f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802453:	74 c6                	je     80241b <strchr+0x91>
+  p += __builtin_ctz(m);
+  802455:	31 c0                	xor    %eax,%eax
+  802457:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80245c:	48 98                	cltq
+  80245e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  802462:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802466:	0f b6 00             	movzbl (%rax),%eax
+  802469:	84 c0                	test   %al,%al
+  80246b:	74 06                	je     802473 <strchr+0xe9>
+  80246d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802471:	eb 05                	jmp    802478 <strchr+0xee>
+  802473:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802478:	c9                   	leave
+  802479:	c3                   	ret
+
+000000000080247a <strfind>:
+strfind(const char *s, char c) {
+  80247a:	55                   	push   %rbp
+  80247b:	48 89 e5             	mov    %rsp,%rbp
+  80247e:	48 83 ec 10          	sub    $0x10,%rsp
+  802482:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802486:	89 f0                	mov    %esi,%eax
+  802488:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  80248b:	eb 11                	jmp    80249e <strfind+0x24>
+    if (*s == c)
+  80248d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802491:	0f b6 00             	movzbl (%rax),%eax
+  802494:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  802497:	74 12                	je     8024ab <strfind+0x31>
+  for (; *s; s++)
+  802499:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80249e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024a2:	0f b6 00             	movzbl (%rax),%eax
+  8024a5:	84 c0                	test   %al,%al
+  8024a7:	75 e4                	jne    80248d <strfind+0x13>
+  8024a9:	eb 01                	jmp    8024ac <strfind+0x32>
+      break;
+  8024ab:	90                   	nop
+  return (char *)s;
+  8024ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8024b0:	c9                   	leave
+  8024b1:	c3                   	ret
+
+00000000008024b2 <memset>:
+memset(void *v, int c, size_t n) {
+  8024b2:	55                   	push   %rbp
+  8024b3:	48 89 e5             	mov    %rsp,%rbp
+  8024b6:	48 83 ec 38          	sub    $0x38,%rsp
+  8024ba:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8024be:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8024c1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8024c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8024cd:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8024d2:	76 41                	jbe    802515 <memset+0x63>
+  8024d4:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  8024db:	00 00 00 
+  8024de:	ff d0                	call   *%rax
+  8024e0:	83 e0 01             	and    $0x1,%eax
+  8024e3:	85 c0                	test   %eax,%eax
+  8024e5:	74 2e                	je     802515 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  8024e7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8024ea:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8024ee:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8024f2:	48 89 ce             	mov    %rcx,%rsi
+  8024f5:	48 89 f7             	mov    %rsi,%rdi
+  8024f8:	48 89 d1             	mov    %rdx,%rcx
+  8024fb:	fc                   	cld
+  8024fc:	f3 aa                	rep stos %al,%es:(%rdi)
+  8024fe:	48 89 ca             	mov    %rcx,%rdx
+  802501:	48 89 fe             	mov    %rdi,%rsi
+  802504:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  802508:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  80250c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802510:	e9 a7 00 00 00       	jmp    8025bc <memset+0x10a>
+  if (n >= 8) {
+  802515:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80251a:	0f 86 87 00 00 00    	jbe    8025a7 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  802520:	eb 16                	jmp    802538 <memset+0x86>
+      *p++ = c;
+  802522:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802526:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80252a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80252e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  802531:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  802533:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  802538:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80253c:	83 e0 07             	and    $0x7,%eax
+  80253f:	48 85 c0             	test   %rax,%rax
+  802542:	75 de                	jne    802522 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  802544:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  802547:	0f b6 c0             	movzbl %al,%eax
+  80254a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  802551:	01 01 01 
+  802554:	48 0f af c2          	imul   %rdx,%rax
+  802558:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  80255c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802560:	48 c1 e8 03          	shr    $0x3,%rax
+  802564:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  802568:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80256c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802570:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802574:	48 89 ce             	mov    %rcx,%rsi
+  802577:	48 89 f7             	mov    %rsi,%rdi
+  80257a:	48 89 d1             	mov    %rdx,%rcx
+  80257d:	fc                   	cld
+  80257e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  802581:	48 89 ca             	mov    %rcx,%rdx
+  802584:	48 89 fe             	mov    %rdi,%rsi
+  802587:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80258b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  80258f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  802594:	eb 11                	jmp    8025a7 <memset+0xf5>
+    *p++ = c;
+  802596:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80259a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80259e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8025a2:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8025a5:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8025a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025ab:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8025af:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8025b3:	48 85 c0             	test   %rax,%rax
+  8025b6:	75 de                	jne    802596 <memset+0xe4>
+  return v;
+  8025b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8025bc:	c9                   	leave
+  8025bd:	c3                   	ret
+
+00000000008025be <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8025be:	55                   	push   %rbp
+  8025bf:	48 89 e5             	mov    %rsp,%rbp
+  8025c2:	48 83 ec 38          	sub    $0x38,%rsp
+  8025c6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8025ca:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8025ce:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  8025d2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8025d6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  8025da:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  8025e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8025e6:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8025ea:	0f 83 da 00 00 00    	jae    8026ca <memmove+0x10c>
+  8025f0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8025f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025f8:	48 01 d0             	add    %rdx,%rax
+  8025fb:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8025ff:	0f 83 c5 00 00 00    	jae    8026ca <memmove+0x10c>
+    s += n;
+  802605:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802609:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  80260d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802611:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  802615:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80261a:	0f 86 94 00 00 00    	jbe    8026b4 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  802620:	eb 1c                	jmp    80263e <memmove+0x80>
+        *--d = *--s;
+  802622:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  802627:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  80262c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802630:	0f b6 10             	movzbl (%rax),%edx
+  802633:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802637:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  802639:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80263e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802642:	83 e0 07             	and    $0x7,%eax
+  802645:	48 85 c0             	test   %rax,%rax
+  802648:	75 d8                	jne    802622 <memmove+0x64>
+      nq = n / 8;
+  80264a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80264e:	48 c1 e8 03          	shr    $0x3,%rax
+  802652:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  802656:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  80265b:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  802660:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  802665:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802669:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80266d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802671:	48 89 cf             	mov    %rcx,%rdi
+  802674:	48 89 d6             	mov    %rdx,%rsi
+  802677:	48 89 c1             	mov    %rax,%rcx
+  80267a:	fd                   	std
+  80267b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80267e:	fc                   	cld
+  80267f:	48 89 c8             	mov    %rcx,%rax
+  802682:	48 89 f2             	mov    %rsi,%rdx
+  802685:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  802689:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80268d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  802691:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  802696:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  80269b:	eb 17                	jmp    8026b4 <memmove+0xf6>
+      *--d = *--s;
+  80269d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8026a2:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8026a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026ab:	0f b6 10             	movzbl (%rax),%edx
+  8026ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8026b2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8026b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026b8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8026bc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8026c0:	48 85 c0             	test   %rax,%rax
+  8026c3:	75 d8                	jne    80269d <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8026c5:	e9 f4 00 00 00       	jmp    8027be <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  8026ca:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  8026cf:	76 46                	jbe    802717 <memmove+0x159>
+  8026d1:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  8026d8:	00 00 00 
+  8026db:	ff d0                	call   *%rax
+  8026dd:	83 e0 01             	and    $0x1,%eax
+  8026e0:	85 c0                	test   %eax,%eax
+  8026e2:	74 33                	je     802717 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  8026e4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8026e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026f0:	48 89 cf             	mov    %rcx,%rdi
+  8026f3:	48 89 d6             	mov    %rdx,%rsi
+  8026f6:	48 89 c1             	mov    %rax,%rcx
+  8026f9:	fc                   	cld
+  8026fa:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8026fc:	48 89 c8             	mov    %rcx,%rax
+  8026ff:	48 89 f2             	mov    %rsi,%rdx
+  802702:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  802706:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  80270a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  80270e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802712:	e9 ab 00 00 00       	jmp    8027c2 <memmove+0x204>
+    if (n >= 8) {
+  802717:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  80271c:	0f 86 8b 00 00 00    	jbe    8027ad <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  802722:	eb 22                	jmp    802746 <memmove+0x188>
+        *d++ = *s++;
+  802724:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802728:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80272c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802730:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802734:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802738:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  80273c:	0f b6 12             	movzbl (%rdx),%edx
+  80273f:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  802741:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  802746:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80274a:	83 e0 07             	and    $0x7,%eax
+  80274d:	48 85 c0             	test   %rax,%rax
+  802750:	75 d2                	jne    802724 <memmove+0x166>
+      nq = n / 8;
+  802752:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802756:	48 c1 e8 03          	shr    $0x3,%rax
+  80275a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  80275e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802762:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802766:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80276a:	48 89 cf             	mov    %rcx,%rdi
+  80276d:	48 89 d6             	mov    %rdx,%rsi
+  802770:	48 89 c1             	mov    %rax,%rcx
+  802773:	fc                   	cld
+  802774:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  802777:	48 89 c8             	mov    %rcx,%rax
+  80277a:	48 89 f2             	mov    %rsi,%rdx
+  80277d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  802781:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  802785:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  802789:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  80278e:	eb 1d                	jmp    8027ad <memmove+0x1ef>
+      *d++ = *s++;
+  802790:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802794:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  802798:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80279c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027a0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8027a4:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8027a8:	0f b6 12             	movzbl (%rdx),%edx
+  8027ab:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8027ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027b1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8027b5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8027b9:	48 85 c0             	test   %rax,%rax
+  8027bc:	75 d2                	jne    802790 <memmove+0x1d2>
+  return dst;
+  8027be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8027c2:	c9                   	leave
+  8027c3:	c3                   	ret
+
+00000000008027c4 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8027c4:	55                   	push   %rbp
+  8027c5:	48 89 e5             	mov    %rsp,%rbp
+  8027c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8027cc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027d0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027d4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  8027d8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8027dc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8027e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027e4:	48 89 ce             	mov    %rcx,%rsi
+  8027e7:	48 89 c7             	mov    %rax,%rdi
+  8027ea:	48 b8 be 25 80 00 00 	movabs $0x8025be,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+}
+  8027f6:	c9                   	leave
+  8027f7:	c3                   	ret
+
+00000000008027f8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  8027f8:	55                   	push   %rbp
+  8027f9:	48 89 e5             	mov    %rsp,%rbp
+  8027fc:	48 83 ec 40          	sub    $0x40,%rsp
+  802800:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802804:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802808:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  80280c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802810:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  802814:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802818:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80281c:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  802821:	0f 86 a7 00 00 00    	jbe    8028ce <memcmp+0xd6>
+  802827:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  80282e:	00 00 00 
+  802831:	ff d0                	call   *%rax
+  802833:	83 e0 02             	and    $0x2,%eax
+  802836:	85 c0                	test   %eax,%eax
+  802838:	0f 84 90 00 00 00    	je     8028ce <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  80283e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802842:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  802846:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80284a:	48 89 ce             	mov    %rcx,%rsi
+  80284d:	48 89 c7             	mov    %rax,%rdi
+  802850:	48 b8 df 1d 80 00 00 	movabs $0x801ddf,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+  80285c:	e9 c2 00 00 00       	jmp    802923 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  802861:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802865:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802869:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80286d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802871:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802875:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802879:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80287d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  802880:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  802887:	74 36                	je     8028bf <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  802889:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80288c:	f7 d0                	not    %eax
+  80288e:	f3 0f bc c0          	tzcnt  %eax,%eax
+  802892:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  802895:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802898:	48 63 d0             	movslq %eax,%rdx
+  80289b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80289f:	48 01 d0             	add    %rdx,%rax
+  8028a2:	0f b6 00             	movzbl (%rax),%eax
+  8028a5:	0f b6 c0             	movzbl %al,%eax
+  8028a8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8028ab:	48 63 ca             	movslq %edx,%rcx
+  8028ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028b2:	48 01 ca             	add    %rcx,%rdx
+  8028b5:	0f b6 12             	movzbl (%rdx),%edx
+  8028b8:	0f b6 d2             	movzbl %dl,%edx
+  8028bb:	29 d0                	sub    %edx,%eax
+  8028bd:	eb 64                	jmp    802923 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  8028bf:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  8028c4:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  8028c9:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  8028ce:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  8028d3:	77 8c                	ja     802861 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  8028d5:	eb 36                	jmp    80290d <memcmp+0x115>
+    if (*s1 != *s2)
+  8028d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028db:	0f b6 10             	movzbl (%rax),%edx
+  8028de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028e2:	0f b6 00             	movzbl (%rax),%eax
+  8028e5:	38 c2                	cmp    %al,%dl
+  8028e7:	74 1a                	je     802903 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  8028e9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028ed:	0f b6 00             	movzbl (%rax),%eax
+  8028f0:	0f b6 c8             	movzbl %al,%ecx
+  8028f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8028f7:	0f b6 00             	movzbl (%rax),%eax
+  8028fa:	0f b6 d0             	movzbl %al,%edx
+  8028fd:	89 c8                	mov    %ecx,%eax
+  8028ff:	29 d0                	sub    %edx,%eax
+  802901:	eb 20                	jmp    802923 <memcmp+0x12b>
+    s1++, s2++;
+  802903:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  802908:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  80290d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802911:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802915:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802919:	48 85 c0             	test   %rax,%rax
+  80291c:	75 b9                	jne    8028d7 <memcmp+0xdf>
+  }
+
+  return 0;
+  80291e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802923:	c9                   	leave
+  802924:	c3                   	ret
+
+0000000000802925 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  802925:	55                   	push   %rbp
+  802926:	48 89 e5             	mov    %rsp,%rbp
+  802929:	48 83 ec 50          	sub    $0x50,%rsp
+  80292d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802931:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  802934:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  802938:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80293c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802940:	48 01 d0             	add    %rdx,%rax
+  802943:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  802947:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80294a:	66 0f 6e c0          	movd   %eax,%xmm0
+  80294e:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  802952:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  802956:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80295b:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  80295f:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  802964:	76 73                	jbe    8029d9 <memfind+0xb4>
+  802966:	48 b8 17 1c 80 00 00 	movabs $0x801c17,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	83 e0 02             	and    $0x2,%eax
+  802975:	85 c0                	test   %eax,%eax
+  802977:	74 60                	je     8029d9 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  802979:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80297c:	0f b6 c8             	movzbl %al,%ecx
+  80297f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802983:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802987:	89 ce                	mov    %ecx,%esi
+  802989:	48 89 c7             	mov    %rax,%rdi
+  80298c:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  802993:	00 00 00 
+  802996:	ff d0                	call   *%rax
+  802998:	eb 6c                	jmp    802a06 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  80299a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80299e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  8029a2:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  8029a6:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  8029ab:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8029af:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8029b3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8029b6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8029ba:	74 13                	je     8029cf <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  8029bc:	31 c0                	xor    %eax,%eax
+  8029be:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  8029c3:	48 63 d0             	movslq %eax,%rdx
+  8029c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029ca:	48 01 d0             	add    %rdx,%rax
+  8029cd:	eb 37                	jmp    802a06 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  8029cf:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  8029d4:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  8029d9:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  8029de:	77 ba                	ja     80299a <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  8029e0:	eb 13                	jmp    8029f5 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  8029e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029e6:	0f b6 00             	movzbl (%rax),%eax
+  8029e9:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  8029ec:	38 d0                	cmp    %dl,%al
+  8029ee:	74 11                	je     802a01 <memfind+0xdc>
+  for (; s < ends; s++)
+  8029f0:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  8029f5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029f9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8029fd:	72 e3                	jb     8029e2 <memfind+0xbd>
+  8029ff:	eb 01                	jmp    802a02 <memfind+0xdd>
+      break;
+  802a01:	90                   	nop
+  return (void *)s;
+  802a02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802a06:	c9                   	leave
+  802a07:	c3                   	ret
+
+0000000000802a08 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802a08:	55                   	push   %rbp
+  802a09:	48 89 e5             	mov    %rsp,%rbp
+  802a0c:	48 83 ec 38          	sub    $0x38,%rsp
+  802a10:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802a14:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802a18:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802a1b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802a22:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802a29:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802a2a:	eb 05                	jmp    802a31 <strtol+0x29>
+    s++;
+  802a2c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  802a31:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a35:	0f b6 00             	movzbl (%rax),%eax
+  802a38:	3c 20                	cmp    $0x20,%al
+  802a3a:	74 f0                	je     802a2c <strtol+0x24>
+  802a3c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a40:	0f b6 00             	movzbl (%rax),%eax
+  802a43:	3c 09                	cmp    $0x9,%al
+  802a45:	74 e5                	je     802a2c <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802a47:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a4b:	0f b6 00             	movzbl (%rax),%eax
+  802a4e:	3c 2b                	cmp    $0x2b,%al
+  802a50:	75 07                	jne    802a59 <strtol+0x51>
+    s++;
+  802a52:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802a57:	eb 17                	jmp    802a70 <strtol+0x68>
+  else if (*s == '-')
+  802a59:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a5d:	0f b6 00             	movzbl (%rax),%eax
+  802a60:	3c 2d                	cmp    $0x2d,%al
+  802a62:	75 0c                	jne    802a70 <strtol+0x68>
+    s++, neg = 1;
+  802a64:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802a69:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802a70:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802a74:	74 06                	je     802a7c <strtol+0x74>
+  802a76:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802a7a:	75 28                	jne    802aa4 <strtol+0x9c>
+  802a7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a80:	0f b6 00             	movzbl (%rax),%eax
+  802a83:	3c 30                	cmp    $0x30,%al
+  802a85:	75 1d                	jne    802aa4 <strtol+0x9c>
+  802a87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a8b:	48 83 c0 01          	add    $0x1,%rax
+  802a8f:	0f b6 00             	movzbl (%rax),%eax
+  802a92:	3c 78                	cmp    $0x78,%al
+  802a94:	75 0e                	jne    802aa4 <strtol+0x9c>
+    s += 2, base = 16;
+  802a96:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802a9b:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802aa2:	eb 2c                	jmp    802ad0 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  802aa4:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802aa8:	75 19                	jne    802ac3 <strtol+0xbb>
+  802aaa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802aae:	0f b6 00             	movzbl (%rax),%eax
+  802ab1:	3c 30                	cmp    $0x30,%al
+  802ab3:	75 0e                	jne    802ac3 <strtol+0xbb>
+    s++, base = 8;
+  802ab5:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802aba:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802ac1:	eb 0d                	jmp    802ad0 <strtol+0xc8>
+  else if (base == 0)
+  802ac3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802ac7:	75 07                	jne    802ad0 <strtol+0xc8>
+    base = 10;
+  802ac9:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  802ad0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802ad4:	0f b6 00             	movzbl (%rax),%eax
+  802ad7:	3c 2f                	cmp    $0x2f,%al
+  802ad9:	7e 1d                	jle    802af8 <strtol+0xf0>
+  802adb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802adf:	0f b6 00             	movzbl (%rax),%eax
+  802ae2:	3c 39                	cmp    $0x39,%al
+  802ae4:	7f 12                	jg     802af8 <strtol+0xf0>
+      dig = *s - '0';
+  802ae6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802aea:	0f b6 00             	movzbl (%rax),%eax
+  802aed:	0f be c0             	movsbl %al,%eax
+  802af0:	83 e8 30             	sub    $0x30,%eax
+  802af3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802af6:	eb 4e                	jmp    802b46 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802af8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802afc:	0f b6 00             	movzbl (%rax),%eax
+  802aff:	3c 60                	cmp    $0x60,%al
+  802b01:	7e 1d                	jle    802b20 <strtol+0x118>
+  802b03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b07:	0f b6 00             	movzbl (%rax),%eax
+  802b0a:	3c 7a                	cmp    $0x7a,%al
+  802b0c:	7f 12                	jg     802b20 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  802b0e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b12:	0f b6 00             	movzbl (%rax),%eax
+  802b15:	0f be c0             	movsbl %al,%eax
+  802b18:	83 e8 57             	sub    $0x57,%eax
+  802b1b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802b1e:	eb 26                	jmp    802b46 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802b20:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b24:	0f b6 00             	movzbl (%rax),%eax
+  802b27:	3c 40                	cmp    $0x40,%al
+  802b29:	7e 47                	jle    802b72 <strtol+0x16a>
+  802b2b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b2f:	0f b6 00             	movzbl (%rax),%eax
+  802b32:	3c 5a                	cmp    $0x5a,%al
+  802b34:	7f 3c                	jg     802b72 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802b36:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802b3a:	0f b6 00             	movzbl (%rax),%eax
+  802b3d:	0f be c0             	movsbl %al,%eax
+  802b40:	83 e8 37             	sub    $0x37,%eax
+  802b43:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802b46:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b49:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  802b4c:	7d 23                	jge    802b71 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  802b4e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802b53:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802b56:	48 98                	cltq
+  802b58:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  802b5d:	48 89 c2             	mov    %rax,%rdx
+  802b60:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b63:	48 98                	cltq
+  802b65:	48 01 d0             	add    %rdx,%rax
+  802b68:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  802b6c:	e9 5f ff ff ff       	jmp    802ad0 <strtol+0xc8>
+      break;
+  802b71:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802b72:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802b77:	74 0b                	je     802b84 <strtol+0x17c>
+    *endptr = (char *)s;
+  802b79:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b7d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802b81:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802b84:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b88:	74 09                	je     802b93 <strtol+0x18b>
+  802b8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b8e:	48 f7 d8             	neg    %rax
+  802b91:	eb 04                	jmp    802b97 <strtol+0x18f>
+  802b93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802b97:	c9                   	leave
+  802b98:	c3                   	ret
+
+0000000000802b99 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802b99:	55                   	push   %rbp
+  802b9a:	48 89 e5             	mov    %rsp,%rbp
+  802b9d:	53                   	push   %rbx
+  802b9e:	48 83 ec 48          	sub    $0x48,%rsp
+  802ba2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802ba6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802baa:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  802bae:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802bb2:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802bb6:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802bba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bbe:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802bc2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802bc6:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802bca:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802bce:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802bd2:	4c 89 c3             	mov    %r8,%rbx
+  802bd5:	cd 30                	int    $0x30
+  802bd7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802bdb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802be0:	74 46                	je     802c28 <syscall+0x8f>
+  802be2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802be7:	7e 3f                	jle    802c28 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802be9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802bed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802bf1:	49 89 d0             	mov    %rdx,%r8
+  802bf4:	48 89 c1             	mov    %rax,%rcx
+  802bf7:	48 b8 68 65 80 00 00 	movabs $0x806568,%rax
+  802bfe:	00 00 00 
+  802c01:	48 89 c2             	mov    %rax,%rdx
+  802c04:	be 22 00 00 00       	mov    $0x22,%esi
+  802c09:	48 b8 87 65 80 00 00 	movabs $0x806587,%rax
+  802c10:	00 00 00 
+  802c13:	48 89 c7             	mov    %rax,%rdi
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1b:	49 b9 ac 0e 80 00 00 	movabs $0x800eac,%r9
+  802c22:	00 00 00 
+  802c25:	41 ff d1             	call   *%r9
+
+  return ret;
+  802c28:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  802c2c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802c30:	c9                   	leave
+  802c31:	c3                   	ret
+
+0000000000802c32 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802c32:	55                   	push   %rbp
+  802c33:	48 89 e5             	mov    %rsp,%rbp
+  802c36:	48 83 ec 10          	sub    $0x10,%rsp
+  802c3a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802c3e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802c42:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802c46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c4a:	48 83 ec 08          	sub    $0x8,%rsp
+  802c4e:	6a 00                	push   $0x0
+  802c50:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c56:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c5c:	48 89 d1             	mov    %rdx,%rcx
+  802c5f:	48 89 c2             	mov    %rax,%rdx
+  802c62:	be 00 00 00 00       	mov    $0x0,%esi
+  802c67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6c:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+  802c78:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c7c:	90                   	nop
+  802c7d:	c9                   	leave
+  802c7e:	c3                   	ret
+
+0000000000802c7f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  802c7f:	55                   	push   %rbp
+  802c80:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802c83:	48 83 ec 08          	sub    $0x8,%rsp
+  802c87:	6a 00                	push   $0x0
+  802c89:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802c95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c9f:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca4:	bf 01 00 00 00       	mov    $0x1,%edi
+  802ca9:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802cb0:	00 00 00 
+  802cb3:	ff d0                	call   *%rax
+  802cb5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cb9:	c9                   	leave
+  802cba:	c3                   	ret
+
+0000000000802cbb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802cbb:	55                   	push   %rbp
+  802cbc:	48 89 e5             	mov    %rsp,%rbp
+  802cbf:	48 83 ec 10          	sub    $0x10,%rsp
+  802cc3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802cc6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802cc9:	48 98                	cltq
+  802ccb:	48 83 ec 08          	sub    $0x8,%rsp
+  802ccf:	6a 00                	push   $0x0
+  802cd1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802cd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ce2:	48 89 c2             	mov    %rax,%rdx
+  802ce5:	be 01 00 00 00       	mov    $0x1,%esi
+  802cea:	bf 03 00 00 00       	mov    $0x3,%edi
+  802cef:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802cf6:	00 00 00 
+  802cf9:	ff d0                	call   *%rax
+  802cfb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802cff:	c9                   	leave
+  802d00:	c3                   	ret
+
+0000000000802d01 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  802d01:	55                   	push   %rbp
+  802d02:	48 89 e5             	mov    %rsp,%rbp
+  802d05:	48 83 ec 10          	sub    $0x10,%rsp
+  802d09:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  802d0c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d0f:	48 98                	cltq
+  802d11:	48 83 ec 08          	sub    $0x8,%rsp
+  802d15:	6a 00                	push   $0x0
+  802d17:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802d1d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802d23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d28:	48 89 c2             	mov    %rax,%rdx
+  802d2b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d30:	bf 04 00 00 00       	mov    $0x4,%edi
+  802d35:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802d3c:	00 00 00 
+  802d3f:	ff d0                	call   *%rax
+  802d41:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802d45:	90                   	nop
+  802d46:	c9                   	leave
+  802d47:	c3                   	ret
+
+0000000000802d48 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802d48:	55                   	push   %rbp
+  802d49:	48 89 e5             	mov    %rsp,%rbp
+  802d4c:	48 83 ec 20          	sub    $0x20,%rsp
+  802d50:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802d53:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802d57:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802d5a:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  802d5d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802d62:	cd 30                	int    $0x30
+  802d64:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802d68:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  802d6c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802d71:	7e 3d                	jle    802db0 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802d73:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d77:	49 89 c0             	mov    %rax,%r8
+  802d7a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  802d7f:	48 b8 68 65 80 00 00 	movabs $0x806568,%rax
+  802d86:	00 00 00 
+  802d89:	48 89 c2             	mov    %rax,%rdx
+  802d8c:	be 49 00 00 00       	mov    $0x49,%esi
+  802d91:	48 b8 87 65 80 00 00 	movabs $0x806587,%rax
+  802d98:	00 00 00 
+  802d9b:	48 89 c7             	mov    %rax,%rdi
+  802d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da3:	49 b9 ac 0e 80 00 00 	movabs $0x800eac,%r9
+  802daa:	00 00 00 
+  802dad:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802db0:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802db5:	75 13                	jne    802dca <sys_env_wait+0x82>
+  802db7:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  802dbc:	74 0c                	je     802dca <sys_env_wait+0x82>
+    *status = st;
+  802dbe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dc2:	89 c2                	mov    %eax,%edx
+  802dc4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802dc8:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802dca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802dce:	c9                   	leave
+  802dcf:	c3                   	ret
+
+0000000000802dd0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802dd0:	55                   	push   %rbp
+  802dd1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802dd4:	48 83 ec 08          	sub    $0x8,%rsp
+  802dd8:	6a 00                	push   $0x0
+  802dda:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802de0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802de6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802deb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df0:	be 00 00 00 00       	mov    $0x0,%esi
+  802df5:	bf 02 00 00 00       	mov    $0x2,%edi
+  802dfa:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802e01:	00 00 00 
+  802e04:	ff d0                	call   *%rax
+  802e06:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e0a:	c9                   	leave
+  802e0b:	c3                   	ret
+
+0000000000802e0c <sys_yield>:
+
+void
+sys_yield(void) {
+  802e0c:	55                   	push   %rbp
+  802e0d:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802e10:	48 83 ec 08          	sub    $0x8,%rsp
+  802e14:	6a 00                	push   $0x0
+  802e16:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e1c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802e22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e2c:	be 00 00 00 00       	mov    $0x0,%esi
+  802e31:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802e36:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802e3d:	00 00 00 
+  802e40:	ff d0                	call   *%rax
+  802e42:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802e46:	90                   	nop
+  802e47:	c9                   	leave
+  802e48:	c3                   	ret
+
+0000000000802e49 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802e49:	55                   	push   %rbp
+  802e4a:	48 89 e5             	mov    %rsp,%rbp
+  802e4d:	48 83 ec 20          	sub    $0x20,%rsp
+  802e51:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e54:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802e58:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802e5b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802e5e:	48 63 c8             	movslq %eax,%rcx
+  802e61:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802e65:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e68:	48 98                	cltq
+  802e6a:	48 83 ec 08          	sub    $0x8,%rsp
+  802e6e:	6a 00                	push   $0x0
+  802e70:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802e76:	49 89 c8             	mov    %rcx,%r8
+  802e79:	48 89 d1             	mov    %rdx,%rcx
+  802e7c:	48 89 c2             	mov    %rax,%rdx
+  802e7f:	be 01 00 00 00       	mov    $0x1,%esi
+  802e84:	bf 06 00 00 00       	mov    $0x6,%edi
+  802e89:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+  802e95:	48 83 c4 10          	add    $0x10,%rsp
+  802e99:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  802e9c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802e9f:	c9                   	leave
+  802ea0:	c3                   	ret
+
+0000000000802ea1 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802ea1:	55                   	push   %rbp
+  802ea2:	48 89 e5             	mov    %rsp,%rbp
+  802ea5:	48 83 ec 20          	sub    $0x20,%rsp
+  802ea9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802eac:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802eb0:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802eb3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802eb7:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802ebb:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802ebe:	48 63 c8             	movslq %eax,%rcx
+  802ec1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802ec5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802ec8:	48 63 f0             	movslq %eax,%rsi
+  802ecb:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ecf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ed2:	48 98                	cltq
+  802ed4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ed8:	51                   	push   %rcx
+  802ed9:	49 89 f9             	mov    %rdi,%r9
+  802edc:	49 89 f0             	mov    %rsi,%r8
+  802edf:	48 89 d1             	mov    %rdx,%rcx
+  802ee2:	48 89 c2             	mov    %rax,%rdx
+  802ee5:	be 01 00 00 00       	mov    $0x1,%esi
+  802eea:	bf 07 00 00 00       	mov    $0x7,%edi
+  802eef:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802ef6:	00 00 00 
+  802ef9:	ff d0                	call   *%rax
+  802efb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802eff:	c9                   	leave
+  802f00:	c3                   	ret
+
+0000000000802f01 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802f01:	55                   	push   %rbp
+  802f02:	48 89 e5             	mov    %rsp,%rbp
+  802f05:	48 83 ec 10          	sub    $0x10,%rsp
+  802f09:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f0c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802f10:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802f14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f17:	48 98                	cltq
+  802f19:	48 83 ec 08          	sub    $0x8,%rsp
+  802f1d:	6a 00                	push   $0x0
+  802f1f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f2b:	48 89 d1             	mov    %rdx,%rcx
+  802f2e:	48 89 c2             	mov    %rax,%rdx
+  802f31:	be 01 00 00 00       	mov    $0x1,%esi
+  802f36:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f3b:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802f42:	00 00 00 
+  802f45:	ff d0                	call   *%rax
+  802f47:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f4b:	c9                   	leave
+  802f4c:	c3                   	ret
+
+0000000000802f4d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802f4d:	55                   	push   %rbp
+  802f4e:	48 89 e5             	mov    %rsp,%rbp
+  802f51:	48 83 ec 10          	sub    $0x10,%rsp
+  802f55:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802f58:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802f5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802f5e:	48 63 d0             	movslq %eax,%rdx
+  802f61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f64:	48 98                	cltq
+  802f66:	48 83 ec 08          	sub    $0x8,%rsp
+  802f6a:	6a 00                	push   $0x0
+  802f6c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802f72:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802f78:	48 89 d1             	mov    %rdx,%rcx
+  802f7b:	48 89 c2             	mov    %rax,%rdx
+  802f7e:	be 01 00 00 00       	mov    $0x1,%esi
+  802f83:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802f88:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802f8f:	00 00 00 
+  802f92:	ff d0                	call   *%rax
+  802f94:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802f98:	c9                   	leave
+  802f99:	c3                   	ret
+
+0000000000802f9a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802f9a:	55                   	push   %rbp
+  802f9b:	48 89 e5             	mov    %rsp,%rbp
+  802f9e:	48 83 ec 10          	sub    $0x10,%rsp
+  802fa2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802fa5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802fa9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802fad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fb0:	48 98                	cltq
+  802fb2:	48 83 ec 08          	sub    $0x8,%rsp
+  802fb6:	6a 00                	push   $0x0
+  802fb8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802fbe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fc4:	48 89 d1             	mov    %rdx,%rcx
+  802fc7:	48 89 c2             	mov    %rax,%rdx
+  802fca:	be 01 00 00 00       	mov    $0x1,%esi
+  802fcf:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802fd4:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  802fdb:	00 00 00 
+  802fde:	ff d0                	call   *%rax
+  802fe0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802fe4:	c9                   	leave
+  802fe5:	c3                   	ret
+
+0000000000802fe6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802fe6:	55                   	push   %rbp
+  802fe7:	48 89 e5             	mov    %rsp,%rbp
+  802fea:	48 83 ec 10          	sub    $0x10,%rsp
+  802fee:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802ff1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802ff5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ff9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ffc:	48 98                	cltq
+  802ffe:	48 83 ec 08          	sub    $0x8,%rsp
+  803002:	6a 00                	push   $0x0
+  803004:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80300a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803010:	48 89 d1             	mov    %rdx,%rcx
+  803013:	48 89 c2             	mov    %rax,%rdx
+  803016:	be 01 00 00 00       	mov    $0x1,%esi
+  80301b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803020:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803027:	00 00 00 
+  80302a:	ff d0                	call   *%rax
+  80302c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803030:	c9                   	leave
+  803031:	c3                   	ret
+
+0000000000803032 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  803032:	55                   	push   %rbp
+  803033:	48 89 e5             	mov    %rsp,%rbp
+  803036:	48 83 ec 20          	sub    $0x20,%rsp
+  80303a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80303d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  803041:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  803045:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  803048:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80304b:	48 63 f0             	movslq %eax,%rsi
+  80304e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803052:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803056:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803059:	48 98                	cltq
+  80305b:	48 83 ec 08          	sub    $0x8,%rsp
+  80305f:	6a 00                	push   $0x0
+  803061:	49 89 f1             	mov    %rsi,%r9
+  803064:	49 89 c8             	mov    %rcx,%r8
+  803067:	48 89 d1             	mov    %rdx,%rcx
+  80306a:	48 89 c2             	mov    %rax,%rdx
+  80306d:	be 00 00 00 00       	mov    $0x0,%esi
+  803072:	bf 0e 00 00 00       	mov    $0xe,%edi
+  803077:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  80307e:	00 00 00 
+  803081:	ff d0                	call   *%rax
+  803083:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803087:	c9                   	leave
+  803088:	c3                   	ret
+
+0000000000803089 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  803089:	55                   	push   %rbp
+  80308a:	48 89 e5             	mov    %rsp,%rbp
+  80308d:	48 83 ec 10          	sub    $0x10,%rsp
+  803091:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  803095:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803099:	48 83 ec 08          	sub    $0x8,%rsp
+  80309d:	6a 00                	push   $0x0
+  80309f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030b0:	48 89 c2             	mov    %rax,%rdx
+  8030b3:	be 01 00 00 00       	mov    $0x1,%esi
+  8030b8:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8030bd:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  8030c4:	00 00 00 
+  8030c7:	ff d0                	call   *%rax
+  8030c9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8030cd:	c9                   	leave
+  8030ce:	c3                   	ret
+
+00000000008030cf <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8030cf:	55                   	push   %rbp
+  8030d0:	48 89 e5             	mov    %rsp,%rbp
+  8030d3:	48 83 ec 10          	sub    $0x10,%rsp
+  8030d7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8030db:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8030df:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8030e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8030e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8030eb:	6a 00                	push   $0x0
+  8030ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8030f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8030f9:	48 89 d1             	mov    %rdx,%rcx
+  8030fc:	48 89 c2             	mov    %rax,%rdx
+  8030ff:	be 01 00 00 00       	mov    $0x1,%esi
+  803104:	bf 10 00 00 00       	mov    $0x10,%edi
+  803109:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803110:	00 00 00 
+  803113:	ff d0                	call   *%rax
+  803115:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803119:	c9                   	leave
+  80311a:	c3                   	ret
+
+000000000080311b <sys_gettime>:
+
+int
+sys_gettime(void) {
+  80311b:	55                   	push   %rbp
+  80311c:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80311f:	48 83 ec 08          	sub    $0x8,%rsp
+  803123:	6a 00                	push   $0x0
+  803125:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80312b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803131:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803136:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313b:	be 00 00 00 00       	mov    $0x0,%esi
+  803140:	bf 11 00 00 00       	mov    $0x11,%edi
+  803145:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  80314c:	00 00 00 
+  80314f:	ff d0                	call   *%rax
+  803151:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803155:	c9                   	leave
+  803156:	c3                   	ret
+
+0000000000803157 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  803157:	55                   	push   %rbp
+  803158:	48 89 e5             	mov    %rsp,%rbp
+  80315b:	48 83 ec 10          	sub    $0x10,%rsp
+  80315f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803163:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  803167:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80316b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80316f:	48 83 ec 08          	sub    $0x8,%rsp
+  803173:	6a 00                	push   $0x0
+  803175:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80317b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803181:	48 89 d1             	mov    %rdx,%rcx
+  803184:	48 89 c2             	mov    %rax,%rdx
+  803187:	be 00 00 00 00       	mov    $0x0,%esi
+  80318c:	bf 12 00 00 00       	mov    $0x12,%edi
+  803191:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803198:	00 00 00 
+  80319b:	ff d0                	call   *%rax
+  80319d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031a1:	c9                   	leave
+  8031a2:	c3                   	ret
+
+00000000008031a3 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8031a3:	55                   	push   %rbp
+  8031a4:	48 89 e5             	mov    %rsp,%rbp
+  8031a7:	48 83 ec 20          	sub    $0x20,%rsp
+  8031ab:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8031af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8031b3:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8031b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031b9:	48 63 c8             	movslq %eax,%rcx
+  8031bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8031c0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8031c8:	6a 00                	push   $0x0
+  8031ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8031d0:	49 89 c8             	mov    %rcx,%r8
+  8031d3:	48 89 d1             	mov    %rdx,%rcx
+  8031d6:	48 89 c2             	mov    %rax,%rdx
+  8031d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8031de:	bf 13 00 00 00       	mov    $0x13,%edi
+  8031e3:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  8031ea:	00 00 00 
+  8031ed:	ff d0                	call   *%rax
+  8031ef:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8031f3:	c9                   	leave
+  8031f4:	c3                   	ret
+
+00000000008031f5 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8031f5:	55                   	push   %rbp
+  8031f6:	48 89 e5             	mov    %rsp,%rbp
+  8031f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8031fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803201:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803204:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  803208:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80320c:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80320f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803213:	48 83 ec 08          	sub    $0x8,%rsp
+  803217:	6a 00                	push   $0x0
+  803219:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80321f:	49 89 c8             	mov    %rcx,%r8
+  803222:	48 89 d1             	mov    %rdx,%rcx
+  803225:	48 89 c2             	mov    %rax,%rdx
+  803228:	be 00 00 00 00       	mov    $0x0,%esi
+  80322d:	bf 14 00 00 00       	mov    $0x14,%edi
+  803232:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803239:	00 00 00 
+  80323c:	ff d0                	call   *%rax
+  80323e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803242:	c9                   	leave
+  803243:	c3                   	ret
+
+0000000000803244 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  803244:	55                   	push   %rbp
+  803245:	48 89 e5             	mov    %rsp,%rbp
+  803248:	48 83 ec 10          	sub    $0x10,%rsp
+  80324c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803250:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  803253:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803256:	48 63 d0             	movslq %eax,%rdx
+  803259:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80325d:	48 83 ec 08          	sub    $0x8,%rsp
+  803261:	6a 00                	push   $0x0
+  803263:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80326f:	48 89 d1             	mov    %rdx,%rcx
+  803272:	48 89 c2             	mov    %rax,%rdx
+  803275:	be 00 00 00 00       	mov    $0x0,%esi
+  80327a:	bf 15 00 00 00       	mov    $0x15,%edi
+  80327f:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803286:	00 00 00 
+  803289:	ff d0                	call   *%rax
+  80328b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80328f:	c9                   	leave
+  803290:	c3                   	ret
+
+0000000000803291 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  803291:	55                   	push   %rbp
+  803292:	48 89 e5             	mov    %rsp,%rbp
+  803295:	48 83 ec 20          	sub    $0x20,%rsp
+  803299:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80329d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8032a0:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8032a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8032a7:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8032ab:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8032ae:	48 63 c8             	movslq %eax,%rcx
+  8032b1:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8032b4:	48 63 d0             	movslq %eax,%rdx
+  8032b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8032bf:	6a 00                	push   $0x0
+  8032c1:	49 89 f1             	mov    %rsi,%r9
+  8032c4:	49 89 c8             	mov    %rcx,%r8
+  8032c7:	48 89 d1             	mov    %rdx,%rcx
+  8032ca:	48 89 c2             	mov    %rax,%rdx
+  8032cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d2:	bf 16 00 00 00       	mov    $0x16,%edi
+  8032d7:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+  8032e3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8032e7:	c9                   	leave
+  8032e8:	c3                   	ret
+
+00000000008032e9 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8032e9:	55                   	push   %rbp
+  8032ea:	48 89 e5             	mov    %rsp,%rbp
+  8032ed:	48 83 ec 30          	sub    $0x30,%rsp
+  8032f1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8032f5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8032f9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8032fd:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  803301:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  803305:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  803309:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80330d:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  803311:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803315:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803319:	48 83 ec 08          	sub    $0x8,%rsp
+  80331d:	51                   	push   %rcx
+  80331e:	49 89 f9             	mov    %rdi,%r9
+  803321:	49 89 f0             	mov    %rsi,%r8
+  803324:	48 89 d1             	mov    %rdx,%rcx
+  803327:	48 89 c2             	mov    %rax,%rdx
+  80332a:	be 00 00 00 00       	mov    $0x0,%esi
+  80332f:	bf 17 00 00 00       	mov    $0x17,%edi
+  803334:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  80333b:	00 00 00 
+  80333e:	ff d0                	call   *%rax
+  803340:	48 83 c4 10          	add    $0x10,%rsp
+}
+  803344:	c9                   	leave
+  803345:	c3                   	ret
+
+0000000000803346 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  803346:	55                   	push   %rbp
+  803347:	48 89 e5             	mov    %rsp,%rbp
+  80334a:	48 83 ec 10          	sub    $0x10,%rsp
+  80334e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  803351:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803354:	48 98                	cltq
+  803356:	48 83 ec 08          	sub    $0x8,%rsp
+  80335a:	6a 00                	push   $0x0
+  80335c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803362:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  803368:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80336d:	48 89 c2             	mov    %rax,%rdx
+  803370:	be 00 00 00 00       	mov    $0x0,%esi
+  803375:	bf 18 00 00 00       	mov    $0x18,%edi
+  80337a:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+  803386:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80338a:	90                   	nop
+  80338b:	c9                   	leave
+  80338c:	c3                   	ret
+
+000000000080338d <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  80338d:	55                   	push   %rbp
+  80338e:	48 89 e5             	mov    %rsp,%rbp
+  803391:	48 83 ec 30          	sub    $0x30,%rsp
+  803395:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803398:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80339c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8033a0:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8033a3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8033a6:	48 63 f0             	movslq %eax,%rsi
+  8033a9:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8033ad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8033b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8033b4:	48 98                	cltq
+  8033b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8033ba:	6a 00                	push   $0x0
+  8033bc:	49 89 f1             	mov    %rsi,%r9
+  8033bf:	49 89 c8             	mov    %rcx,%r8
+  8033c2:	48 89 d1             	mov    %rdx,%rcx
+  8033c5:	48 89 c2             	mov    %rax,%rdx
+  8033c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8033cd:	bf 19 00 00 00       	mov    $0x19,%edi
+  8033d2:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  8033d9:	00 00 00 
+  8033dc:	ff d0                	call   *%rax
+  8033de:	48 83 c4 10          	add    $0x10,%rsp
+  8033e2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8033e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8033e8:	c9                   	leave
+  8033e9:	c3                   	ret
+
+00000000008033ea <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8033ea:	55                   	push   %rbp
+  8033eb:	48 89 e5             	mov    %rsp,%rbp
+  8033ee:	48 83 ec 20          	sub    $0x20,%rsp
+  8033f2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8033f6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8033fa:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8033fd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803400:	48 63 c8             	movslq %eax,%rcx
+  803403:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803407:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80340b:	48 83 ec 08          	sub    $0x8,%rsp
+  80340f:	6a 00                	push   $0x0
+  803411:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803417:	49 89 c8             	mov    %rcx,%r8
+  80341a:	48 89 d1             	mov    %rdx,%rcx
+  80341d:	48 89 c2             	mov    %rax,%rdx
+  803420:	be 01 00 00 00       	mov    $0x1,%esi
+  803425:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  80342a:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803431:	00 00 00 
+  803434:	ff d0                	call   *%rax
+  803436:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80343a:	c9                   	leave
+  80343b:	c3                   	ret
+
+000000000080343c <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  80343c:	55                   	push   %rbp
+  80343d:	48 89 e5             	mov    %rsp,%rbp
+  803440:	48 83 ec 20          	sub    $0x20,%rsp
+  803444:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803448:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80344c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  803450:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  803454:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80345c:	48 83 ec 08          	sub    $0x8,%rsp
+  803460:	6a 00                	push   $0x0
+  803462:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803468:	49 89 c8             	mov    %rcx,%r8
+  80346b:	48 89 d1             	mov    %rdx,%rcx
+  80346e:	48 89 c2             	mov    %rax,%rdx
+  803471:	be 01 00 00 00       	mov    $0x1,%esi
+  803476:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  80347b:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803482:	00 00 00 
+  803485:	ff d0                	call   *%rax
+  803487:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80348b:	c9                   	leave
+  80348c:	c3                   	ret
+
+000000000080348d <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  80348d:	55                   	push   %rbp
+  80348e:	48 89 e5             	mov    %rsp,%rbp
+  803491:	48 83 ec 30          	sub    $0x30,%rsp
+  803495:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803499:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80349d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8034a0:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8034a4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8034a8:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034ab:	48 63 c8             	movslq %eax,%rcx
+  8034ae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8034b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8034ba:	6a 00                	push   $0x0
+  8034bc:	49 89 f1             	mov    %rsi,%r9
+  8034bf:	49 89 c8             	mov    %rcx,%r8
+  8034c2:	48 89 d1             	mov    %rdx,%rcx
+  8034c5:	48 89 c2             	mov    %rax,%rdx
+  8034c8:	be 01 00 00 00       	mov    $0x1,%esi
+  8034cd:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  8034d2:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  8034d9:	00 00 00 
+  8034dc:	ff d0                	call   *%rax
+  8034de:	48 83 c4 10          	add    $0x10,%rsp
+  8034e2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8034e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8034e8:	c9                   	leave
+  8034e9:	c3                   	ret
+
+00000000008034ea <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  8034ea:	55                   	push   %rbp
+  8034eb:	48 89 e5             	mov    %rsp,%rbp
+  8034ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8034f2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  8034f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034f8:	48 98                	cltq
+  8034fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8034fe:	6a 00                	push   $0x0
+  803500:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  803506:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80350c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803511:	48 89 c2             	mov    %rax,%rdx
+  803514:	be 01 00 00 00       	mov    $0x1,%esi
+  803519:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  80351e:	48 b8 99 2b 80 00 00 	movabs $0x802b99,%rax
+  803525:	00 00 00 
+  803528:	ff d0                	call   *%rax
+  80352a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80352e:	c9                   	leave
+  80352f:	c3                   	ret
+
+0000000000803530 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  803530:	55                   	push   %rbp
+  803531:	48 89 e5             	mov    %rsp,%rbp
+  803534:	48 83 ec 08          	sub    $0x8,%rsp
+  803538:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80353c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803540:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803547:	ff ff ff 
+  80354a:	48 01 d0             	add    %rdx,%rax
+  80354d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803551:	c9                   	leave
+  803552:	c3                   	ret
+
+0000000000803553 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803553:	55                   	push   %rbp
+  803554:	48 89 e5             	mov    %rsp,%rbp
+  803557:	48 83 ec 08          	sub    $0x8,%rsp
+  80355b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80355f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803563:	48 89 c7             	mov    %rax,%rdi
+  803566:	48 b8 30 35 80 00 00 	movabs $0x803530,%rax
+  80356d:	00 00 00 
+  803570:	ff d0                	call   *%rax
+  803572:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803578:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80357c:	c9                   	leave
+  80357d:	c3                   	ret
+
+000000000080357e <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80357e:	55                   	push   %rbp
+  80357f:	48 89 e5             	mov    %rsp,%rbp
+  803582:	48 83 ec 18          	sub    $0x18,%rsp
+  803586:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80358a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803591:	e9 ae 00 00 00       	jmp    803644 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  803596:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803599:	c1 e0 0c             	shl    $0xc,%eax
+  80359c:	48 98                	cltq
+  80359e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8035a3:	48 01 d0             	add    %rdx,%rax
+  8035a6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8035aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035ae:	48 c1 e8 27          	shr    $0x27,%rax
+  8035b2:	48 89 c2             	mov    %rax,%rdx
+  8035b5:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8035bc:	01 00 00 
+  8035bf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035c3:	83 e0 01             	and    $0x1,%eax
+  8035c6:	48 85 c0             	test   %rax,%rax
+  8035c9:	74 63                	je     80362e <fd_alloc+0xb0>
+  8035cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035cf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8035d3:	48 89 c2             	mov    %rax,%rdx
+  8035d6:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8035dd:	01 00 00 
+  8035e0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8035e4:	83 e0 01             	and    $0x1,%eax
+  8035e7:	48 85 c0             	test   %rax,%rax
+  8035ea:	74 42                	je     80362e <fd_alloc+0xb0>
+  8035ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035f0:	48 c1 e8 15          	shr    $0x15,%rax
+  8035f4:	48 89 c2             	mov    %rax,%rdx
+  8035f7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8035fe:	01 00 00 
+  803601:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803605:	83 e0 01             	and    $0x1,%eax
+  803608:	48 85 c0             	test   %rax,%rax
+  80360b:	74 21                	je     80362e <fd_alloc+0xb0>
+  80360d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803611:	48 c1 e8 0c          	shr    $0xc,%rax
+  803615:	48 89 c2             	mov    %rax,%rdx
+  803618:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80361f:	01 00 00 
+  803622:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803626:	83 e0 01             	and    $0x1,%eax
+  803629:	48 85 c0             	test   %rax,%rax
+  80362c:	75 12                	jne    803640 <fd_alloc+0xc2>
+      *fd_store = fd;
+  80362e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803632:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803636:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  803639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363e:	eb 1e                	jmp    80365e <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803640:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803644:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803648:	0f 8e 48 ff ff ff    	jle    803596 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80364e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803652:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  803659:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80365e:	c9                   	leave
+  80365f:	c3                   	ret
+
+0000000000803660 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803660:	55                   	push   %rbp
+  803661:	48 89 e5             	mov    %rsp,%rbp
+  803664:	48 83 ec 20          	sub    $0x20,%rsp
+  803668:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80366b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80366f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803673:	78 06                	js     80367b <fd_lookup+0x1b>
+  803675:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803679:	7e 0a                	jle    803685 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80367b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803680:	e9 af 00 00 00       	jmp    803734 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  803685:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803688:	c1 e0 0c             	shl    $0xc,%eax
+  80368b:	48 98                	cltq
+  80368d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803692:	48 01 d0             	add    %rdx,%rax
+  803695:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803699:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80369d:	48 c1 e8 27          	shr    $0x27,%rax
+  8036a1:	48 89 c2             	mov    %rax,%rdx
+  8036a4:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8036ab:	01 00 00 
+  8036ae:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036b2:	83 e0 01             	and    $0x1,%eax
+  8036b5:	48 85 c0             	test   %rax,%rax
+  8036b8:	74 63                	je     80371d <fd_lookup+0xbd>
+  8036ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036be:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8036c2:	48 89 c2             	mov    %rax,%rdx
+  8036c5:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8036cc:	01 00 00 
+  8036cf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036d3:	83 e0 01             	and    $0x1,%eax
+  8036d6:	48 85 c0             	test   %rax,%rax
+  8036d9:	74 42                	je     80371d <fd_lookup+0xbd>
+  8036db:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036df:	48 c1 e8 15          	shr    $0x15,%rax
+  8036e3:	48 89 c2             	mov    %rax,%rdx
+  8036e6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8036ed:	01 00 00 
+  8036f0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8036f4:	83 e0 01             	and    $0x1,%eax
+  8036f7:	48 85 c0             	test   %rax,%rax
+  8036fa:	74 21                	je     80371d <fd_lookup+0xbd>
+  8036fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803700:	48 c1 e8 0c          	shr    $0xc,%rax
+  803704:	48 89 c2             	mov    %rax,%rdx
+  803707:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80370e:	01 00 00 
+  803711:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803715:	83 e0 01             	and    $0x1,%eax
+  803718:	48 85 c0             	test   %rax,%rax
+  80371b:	75 07                	jne    803724 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80371d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803722:	eb 10                	jmp    803734 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  803724:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803728:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80372c:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  80372f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803734:	c9                   	leave
+  803735:	c3                   	ret
+
+0000000000803736 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  803736:	55                   	push   %rbp
+  803737:	48 89 e5             	mov    %rsp,%rbp
+  80373a:	48 83 ec 30          	sub    $0x30,%rsp
+  80373e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803742:	89 f0                	mov    %esi,%eax
+  803744:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803747:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80374b:	48 89 c7             	mov    %rax,%rdi
+  80374e:	48 b8 30 35 80 00 00 	movabs $0x803530,%rax
+  803755:	00 00 00 
+  803758:	ff d0                	call   *%rax
+  80375a:	89 c2                	mov    %eax,%edx
+  80375c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803760:	48 89 c6             	mov    %rax,%rsi
+  803763:	89 d7                	mov    %edx,%edi
+  803765:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  80376c:	00 00 00 
+  80376f:	ff d0                	call   *%rax
+  803771:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803774:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803778:	78 0a                	js     803784 <fd_close+0x4e>
+  80377a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80377e:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803782:	74 12                	je     803796 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803784:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803788:	74 05                	je     80378f <fd_close+0x59>
+  80378a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80378d:	eb 70                	jmp    8037ff <fd_close+0xc9>
+  80378f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803794:	eb 69                	jmp    8037ff <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803796:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80379a:	8b 00                	mov    (%rax),%eax
+  80379c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8037a0:	48 89 d6             	mov    %rdx,%rsi
+  8037a3:	89 c7                	mov    %eax,%edi
+  8037a5:	48 b8 01 38 80 00 00 	movabs $0x803801,%rax
+  8037ac:	00 00 00 
+  8037af:	ff d0                	call   *%rax
+  8037b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037b8:	78 2a                	js     8037e4 <fd_close+0xae>
+    if (dev->dev_close)
+  8037ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037be:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8037c2:	48 85 c0             	test   %rax,%rax
+  8037c5:	74 16                	je     8037dd <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8037c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037cb:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8037cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037d3:	48 89 c7             	mov    %rax,%rdi
+  8037d6:	ff d2                	call   *%rdx
+  8037d8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037db:	eb 07                	jmp    8037e4 <fd_close+0xae>
+    else
+      r = 0;
+  8037dd:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8037e4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8037e8:	48 89 c6             	mov    %rax,%rsi
+  8037eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f0:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  8037f7:	00 00 00 
+  8037fa:	ff d0                	call   *%rax
+  return r;
+  8037fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8037ff:	c9                   	leave
+  803800:	c3                   	ret
+
+0000000000803801 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  803801:	55                   	push   %rbp
+  803802:	48 89 e5             	mov    %rsp,%rbp
+  803805:	48 83 ec 20          	sub    $0x20,%rsp
+  803809:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80380c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  803810:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803817:	eb 3f                	jmp    803858 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  803819:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803820:	00 00 00 
+  803823:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803826:	48 98                	cltq
+  803828:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80382c:	8b 00                	mov    (%rax),%eax
+  80382e:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  803831:	75 21                	jne    803854 <dev_lookup+0x53>
+      *dev = devtab[i];
+  803833:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80383a:	00 00 00 
+  80383d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803840:	48 98                	cltq
+  803842:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803846:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80384a:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80384d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803852:	eb 7f                	jmp    8038d3 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803854:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803858:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80385f:	00 00 00 
+  803862:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803865:	48 98                	cltq
+  803867:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80386b:	48 85 c0             	test   %rax,%rax
+  80386e:	75 a9                	jne    803819 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803870:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803877:	00 00 00 
+  80387a:	8b 40 04             	mov    0x4(%rax),%eax
+  80387d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803882:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803889:	00 00 00 
+  80388c:	48 98                	cltq
+  80388e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803895:	48 01 d0             	add    %rdx,%rax
+  803898:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80389e:	8b 00                	mov    (%rax),%eax
+  8038a0:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8038a3:	89 c6                	mov    %eax,%esi
+  8038a5:	48 b8 98 65 80 00 00 	movabs $0x806598,%rax
+  8038ac:	00 00 00 
+  8038af:	48 89 c7             	mov    %rax,%rdi
+  8038b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038b7:	48 b9 cb 10 80 00 00 	movabs $0x8010cb,%rcx
+  8038be:	00 00 00 
+  8038c1:	ff d1                	call   *%rcx
+  *dev = 0;
+  8038c3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038c7:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  8038ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8038d3:	c9                   	leave
+  8038d4:	c3                   	ret
+
+00000000008038d5 <close>:
+
+int
+close(int fdnum) {
+  8038d5:	55                   	push   %rbp
+  8038d6:	48 89 e5             	mov    %rsp,%rbp
+  8038d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8038dd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8038e0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8038e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8038e7:	48 89 d6             	mov    %rdx,%rsi
+  8038ea:	89 c7                	mov    %eax,%edi
+  8038ec:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  8038f3:	00 00 00 
+  8038f6:	ff d0                	call   *%rax
+  8038f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038fb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038ff:	79 05                	jns    803906 <close+0x31>
+    return r;
+  803901:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803904:	eb 18                	jmp    80391e <close+0x49>
+  else
+    return fd_close(fd, 1);
+  803906:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80390a:	be 01 00 00 00       	mov    $0x1,%esi
+  80390f:	48 89 c7             	mov    %rax,%rdi
+  803912:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  803919:	00 00 00 
+  80391c:	ff d0                	call   *%rax
+}
+  80391e:	c9                   	leave
+  80391f:	c3                   	ret
+
+0000000000803920 <close_all>:
+
+void
+close_all(void) {
+  803920:	55                   	push   %rbp
+  803921:	48 89 e5             	mov    %rsp,%rbp
+  803924:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  803928:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80392f:	eb 15                	jmp    803946 <close_all+0x26>
+    close(i);
+  803931:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803934:	89 c7                	mov    %eax,%edi
+  803936:	48 b8 d5 38 80 00 00 	movabs $0x8038d5,%rax
+  80393d:	00 00 00 
+  803940:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803942:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803946:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80394a:	7e e5                	jle    803931 <close_all+0x11>
+}
+  80394c:	90                   	nop
+  80394d:	90                   	nop
+  80394e:	c9                   	leave
+  80394f:	c3                   	ret
+
+0000000000803950 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803950:	55                   	push   %rbp
+  803951:	48 89 e5             	mov    %rsp,%rbp
+  803954:	48 83 ec 40          	sub    $0x40,%rsp
+  803958:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80395b:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80395e:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803962:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803965:	48 89 d6             	mov    %rdx,%rsi
+  803968:	89 c7                	mov    %eax,%edi
+  80396a:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  803971:	00 00 00 
+  803974:	ff d0                	call   *%rax
+  803976:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803979:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80397d:	79 08                	jns    803987 <dup+0x37>
+    return r;
+  80397f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803982:	e9 33 02 00 00       	jmp    803bba <dup+0x26a>
+  close(newfdnum);
+  803987:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80398a:	89 c7                	mov    %eax,%edi
+  80398c:	48 b8 d5 38 80 00 00 	movabs $0x8038d5,%rax
+  803993:	00 00 00 
+  803996:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803998:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80399b:	c1 e0 0c             	shl    $0xc,%eax
+  80399e:	48 98                	cltq
+  8039a0:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8039a5:	48 01 d0             	add    %rdx,%rax
+  8039a8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  8039ac:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8039b0:	48 89 c7             	mov    %rax,%rdi
+  8039b3:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  8039ba:	00 00 00 
+  8039bd:	ff d0                	call   *%rax
+  8039bf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  8039c3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039c7:	48 89 c7             	mov    %rax,%rdi
+  8039ca:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  8039d1:	00 00 00 
+  8039d4:	ff d0                	call   *%rax
+  8039d6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  8039da:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8039e1:	00 
+  8039e2:	e9 19 01 00 00       	jmp    803b00 <dup+0x1b0>
+    off -= PGSIZE;
+  8039e7:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8039ee:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8039ef:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8039f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8039f7:	48 01 d0             	add    %rdx,%rax
+  8039fa:	48 c1 e8 27          	shr    $0x27,%rax
+  8039fe:	48 89 c2             	mov    %rax,%rdx
+  803a01:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803a08:	01 00 00 
+  803a0b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a0f:	83 e0 01             	and    $0x1,%eax
+  803a12:	48 85 c0             	test   %rax,%rax
+  803a15:	0f 84 e5 00 00 00    	je     803b00 <dup+0x1b0>
+  803a1b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a23:	48 01 d0             	add    %rdx,%rax
+  803a26:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803a2a:	48 89 c2             	mov    %rax,%rdx
+  803a2d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803a34:	01 00 00 
+  803a37:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a3b:	83 e0 01             	and    $0x1,%eax
+  803a3e:	48 85 c0             	test   %rax,%rax
+  803a41:	0f 84 b9 00 00 00    	je     803b00 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803a47:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a4b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a4f:	48 01 d0             	add    %rdx,%rax
+  803a52:	48 c1 e8 15          	shr    $0x15,%rax
+  803a56:	48 89 c2             	mov    %rax,%rdx
+  803a59:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803a60:	01 00 00 
+  803a63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a67:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803a6a:	48 85 c0             	test   %rax,%rax
+  803a6d:	0f 84 8d 00 00 00    	je     803b00 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803a73:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a77:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a7b:	48 01 d0             	add    %rdx,%rax
+  803a7e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803a82:	48 89 c2             	mov    %rax,%rdx
+  803a85:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803a8c:	01 00 00 
+  803a8f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803a93:	83 e0 01             	and    $0x1,%eax
+  803a96:	48 85 c0             	test   %rax,%rax
+  803a99:	74 65                	je     803b00 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803a9b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aa3:	48 01 d0             	add    %rdx,%rax
+  803aa6:	48 c1 e8 0c          	shr    $0xc,%rax
+  803aaa:	48 89 c2             	mov    %rax,%rdx
+  803aad:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803ab4:	01 00 00 
+  803ab7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803abb:	25 07 0e 00 00       	and    $0xe07,%eax
+  803ac0:	89 c6                	mov    %eax,%esi
+  803ac2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ac6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803aca:	48 01 c2             	add    %rax,%rdx
+  803acd:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803ad1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ad5:	48 01 c8             	add    %rcx,%rax
+  803ad8:	41 89 f0             	mov    %esi,%r8d
+  803adb:	48 89 d1             	mov    %rdx,%rcx
+  803ade:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ae3:	48 89 c6             	mov    %rax,%rsi
+  803ae6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aeb:	48 b8 a1 2e 80 00 00 	movabs $0x802ea1,%rax
+  803af2:	00 00 00 
+  803af5:	ff d0                	call   *%rax
+  803af7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803afa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803afe:	78 60                	js     803b60 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  803b00:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803b05:	0f 85 dc fe ff ff    	jne    8039e7 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803b0b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b0f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803b13:	48 89 c2             	mov    %rax,%rdx
+  803b16:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803b1d:	01 00 00 
+  803b20:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803b24:	25 07 0e 00 00       	and    $0xe07,%eax
+  803b29:	89 c1                	mov    %eax,%ecx
+  803b2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803b2f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803b33:	41 89 c8             	mov    %ecx,%r8d
+  803b36:	48 89 d1             	mov    %rdx,%rcx
+  803b39:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b3e:	48 89 c6             	mov    %rax,%rsi
+  803b41:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b46:	48 b8 a1 2e 80 00 00 	movabs $0x802ea1,%rax
+  803b4d:	00 00 00 
+  803b50:	ff d0                	call   *%rax
+  803b52:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b55:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b59:	78 08                	js     803b63 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803b5b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803b5e:	eb 5a                	jmp    803bba <dup+0x26a>
+        goto err;
+  803b60:	90                   	nop
+  803b61:	eb 01                	jmp    803b64 <dup+0x214>
+    goto err;
+  803b63:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803b64:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b68:	48 89 c6             	mov    %rax,%rsi
+  803b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b70:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  803b77:	00 00 00 
+  803b7a:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803b7c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803b83:	00 
+  803b84:	eb 27                	jmp    803bad <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803b86:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803b8a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b8e:	48 01 d0             	add    %rdx,%rax
+  803b91:	48 89 c6             	mov    %rax,%rsi
+  803b94:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b99:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  803ba0:	00 00 00 
+  803ba3:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803ba5:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  803bac:	00 
+  803bad:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803bb4:	00 
+  803bb5:	76 cf                	jbe    803b86 <dup+0x236>
+  return r;
+  803bb7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803bba:	c9                   	leave
+  803bbb:	c3                   	ret
+
+0000000000803bbc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  803bbc:	55                   	push   %rbp
+  803bbd:	48 89 e5             	mov    %rsp,%rbp
+  803bc0:	48 83 ec 40          	sub    $0x40,%rsp
+  803bc4:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803bc7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803bcb:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803bcf:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803bd3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803bd6:	48 89 d6             	mov    %rdx,%rsi
+  803bd9:	89 c7                	mov    %eax,%edi
+  803bdb:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  803be2:	00 00 00 
+  803be5:	ff d0                	call   *%rax
+  803be7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bea:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bee:	78 24                	js     803c14 <read+0x58>
+  803bf0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bf4:	8b 00                	mov    (%rax),%eax
+  803bf6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803bfa:	48 89 d6             	mov    %rdx,%rsi
+  803bfd:	89 c7                	mov    %eax,%edi
+  803bff:	48 b8 01 38 80 00 00 	movabs $0x803801,%rax
+  803c06:	00 00 00 
+  803c09:	ff d0                	call   *%rax
+  803c0b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c0e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c12:	79 0a                	jns    803c1e <read+0x62>
+    return r;
+  803c14:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c17:	48 98                	cltq
+  803c19:	e9 9e 00 00 00       	jmp    803cbc <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  803c1e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c22:	8b 40 08             	mov    0x8(%rax),%eax
+  803c25:	83 e0 03             	and    $0x3,%eax
+  803c28:	83 f8 01             	cmp    $0x1,%eax
+  803c2b:	75 5c                	jne    803c89 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  803c2d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803c34:	00 00 00 
+  803c37:	8b 40 04             	mov    0x4(%rax),%eax
+  803c3a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c3f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803c46:	00 00 00 
+  803c49:	48 98                	cltq
+  803c4b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803c52:	48 01 d0             	add    %rdx,%rax
+  803c55:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803c5b:	8b 00                	mov    (%rax),%eax
+  803c5d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803c60:	89 c6                	mov    %eax,%esi
+  803c62:	48 b8 b7 65 80 00 00 	movabs $0x8065b7,%rax
+  803c69:	00 00 00 
+  803c6c:	48 89 c7             	mov    %rax,%rdi
+  803c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c74:	48 b9 cb 10 80 00 00 	movabs $0x8010cb,%rcx
+  803c7b:	00 00 00 
+  803c7e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803c80:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803c87:	eb 33                	jmp    803cbc <read+0x100>
+  }
+  if (!dev->dev_read)
+  803c89:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c8d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803c91:	48 85 c0             	test   %rax,%rax
+  803c94:	75 09                	jne    803c9f <read+0xe3>
+    return -E_NOT_SUPP;
+  803c96:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803c9d:	eb 1d                	jmp    803cbc <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803c9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ca3:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803ca7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cab:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803caf:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803cb3:	48 89 ce             	mov    %rcx,%rsi
+  803cb6:	48 89 c7             	mov    %rax,%rdi
+  803cb9:	41 ff d0             	call   *%r8
+}
+  803cbc:	c9                   	leave
+  803cbd:	c3                   	ret
+
+0000000000803cbe <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803cbe:	55                   	push   %rbp
+  803cbf:	48 89 e5             	mov    %rsp,%rbp
+  803cc2:	48 83 ec 30          	sub    $0x30,%rsp
+  803cc6:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803cc9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803ccd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803cd1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803cd8:	eb 49                	jmp    803d23 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803cda:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803cdd:	48 98                	cltq
+  803cdf:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ce3:	48 29 c2             	sub    %rax,%rdx
+  803ce6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ce9:	48 63 c8             	movslq %eax,%rcx
+  803cec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803cf0:	48 01 c1             	add    %rax,%rcx
+  803cf3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803cf6:	48 89 ce             	mov    %rcx,%rsi
+  803cf9:	89 c7                	mov    %eax,%edi
+  803cfb:	48 b8 bc 3b 80 00 00 	movabs $0x803bbc,%rax
+  803d02:	00 00 00 
+  803d05:	ff d0                	call   *%rax
+  803d07:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803d0a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803d0e:	79 07                	jns    803d17 <readn+0x59>
+      return m;
+  803d10:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d13:	48 98                	cltq
+  803d15:	eb 1f                	jmp    803d36 <readn+0x78>
+    if (m == 0)
+  803d17:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803d1b:	74 13                	je     803d30 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803d1d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803d20:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803d23:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d26:	48 98                	cltq
+  803d28:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803d2c:	72 ac                	jb     803cda <readn+0x1c>
+  803d2e:	eb 01                	jmp    803d31 <readn+0x73>
+      break;
+  803d30:	90                   	nop
+  }
+  return tot;
+  803d31:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d34:	48 98                	cltq
+}
+  803d36:	c9                   	leave
+  803d37:	c3                   	ret
+
+0000000000803d38 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803d38:	55                   	push   %rbp
+  803d39:	48 89 e5             	mov    %rsp,%rbp
+  803d3c:	48 83 ec 40          	sub    $0x40,%rsp
+  803d40:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d43:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803d47:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d4b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803d4f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d52:	48 89 d6             	mov    %rdx,%rsi
+  803d55:	89 c7                	mov    %eax,%edi
+  803d57:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  803d5e:	00 00 00 
+  803d61:	ff d0                	call   *%rax
+  803d63:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d6a:	78 24                	js     803d90 <write+0x58>
+  803d6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d70:	8b 00                	mov    (%rax),%eax
+  803d72:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803d76:	48 89 d6             	mov    %rdx,%rsi
+  803d79:	89 c7                	mov    %eax,%edi
+  803d7b:	48 b8 01 38 80 00 00 	movabs $0x803801,%rax
+  803d82:	00 00 00 
+  803d85:	ff d0                	call   *%rax
+  803d87:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d8a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d8e:	79 0a                	jns    803d9a <write+0x62>
+    return r;
+  803d90:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d93:	48 98                	cltq
+  803d95:	e9 9d 00 00 00       	jmp    803e37 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803d9a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d9e:	8b 40 08             	mov    0x8(%rax),%eax
+  803da1:	83 e0 03             	and    $0x3,%eax
+  803da4:	85 c0                	test   %eax,%eax
+  803da6:	75 5c                	jne    803e04 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803da8:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803daf:	00 00 00 
+  803db2:	8b 40 04             	mov    0x4(%rax),%eax
+  803db5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803dba:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803dc1:	00 00 00 
+  803dc4:	48 98                	cltq
+  803dc6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803dcd:	48 01 d0             	add    %rdx,%rax
+  803dd0:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803dd6:	8b 00                	mov    (%rax),%eax
+  803dd8:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803ddb:	89 c6                	mov    %eax,%esi
+  803ddd:	48 b8 d3 65 80 00 00 	movabs $0x8065d3,%rax
+  803de4:	00 00 00 
+  803de7:	48 89 c7             	mov    %rax,%rdi
+  803dea:	b8 00 00 00 00       	mov    $0x0,%eax
+  803def:	48 b9 cb 10 80 00 00 	movabs $0x8010cb,%rcx
+  803df6:	00 00 00 
+  803df9:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803dfb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803e02:	eb 33                	jmp    803e37 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803e04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e08:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803e0c:	48 85 c0             	test   %rax,%rax
+  803e0f:	75 09                	jne    803e1a <write+0xe2>
+    return -E_NOT_SUPP;
+  803e11:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803e18:	eb 1d                	jmp    803e37 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803e1a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e1e:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803e22:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e26:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803e2a:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803e2e:	48 89 ce             	mov    %rcx,%rsi
+  803e31:	48 89 c7             	mov    %rax,%rdi
+  803e34:	41 ff d0             	call   *%r8
+}
+  803e37:	c9                   	leave
+  803e38:	c3                   	ret
+
+0000000000803e39 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803e39:	55                   	push   %rbp
+  803e3a:	48 89 e5             	mov    %rsp,%rbp
+  803e3d:	48 83 ec 18          	sub    $0x18,%rsp
+  803e41:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803e44:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803e47:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803e4b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803e4e:	48 89 d6             	mov    %rdx,%rsi
+  803e51:	89 c7                	mov    %eax,%edi
+  803e53:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  803e5a:	00 00 00 
+  803e5d:	ff d0                	call   *%rax
+  803e5f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e62:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e66:	79 05                	jns    803e6d <seek+0x34>
+    return r;
+  803e68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e6b:	eb 0f                	jmp    803e7c <seek+0x43>
+  fd->fd_offset = offset;
+  803e6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e71:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803e74:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803e77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e7c:	c9                   	leave
+  803e7d:	c3                   	ret
+
+0000000000803e7e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803e7e:	55                   	push   %rbp
+  803e7f:	48 89 e5             	mov    %rsp,%rbp
+  803e82:	48 83 ec 30          	sub    $0x30,%rsp
+  803e86:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803e89:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803e8c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803e90:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e93:	48 89 d6             	mov    %rdx,%rsi
+  803e96:	89 c7                	mov    %eax,%edi
+  803e98:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  803e9f:	00 00 00 
+  803ea2:	ff d0                	call   *%rax
+  803ea4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ea7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803eab:	78 24                	js     803ed1 <ftruncate+0x53>
+  803ead:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803eb1:	8b 00                	mov    (%rax),%eax
+  803eb3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803eb7:	48 89 d6             	mov    %rdx,%rsi
+  803eba:	89 c7                	mov    %eax,%edi
+  803ebc:	48 b8 01 38 80 00 00 	movabs $0x803801,%rax
+  803ec3:	00 00 00 
+  803ec6:	ff d0                	call   *%rax
+  803ec8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803ecb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ecf:	79 08                	jns    803ed9 <ftruncate+0x5b>
+    return r;
+  803ed1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ed4:	e9 92 00 00 00       	jmp    803f6b <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803ed9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803edd:	8b 40 08             	mov    0x8(%rax),%eax
+  803ee0:	83 e0 03             	and    $0x3,%eax
+  803ee3:	85 c0                	test   %eax,%eax
+  803ee5:	75 5a                	jne    803f41 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803ee7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803eee:	00 00 00 
+  803ef1:	8b 40 04             	mov    0x4(%rax),%eax
+  803ef4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803ef9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803f00:	00 00 00 
+  803f03:	48 98                	cltq
+  803f05:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803f0c:	48 01 d0             	add    %rdx,%rax
+  803f0f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803f15:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803f17:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803f1a:	89 c6                	mov    %eax,%esi
+  803f1c:	48 b8 f0 65 80 00 00 	movabs $0x8065f0,%rax
+  803f23:	00 00 00 
+  803f26:	48 89 c7             	mov    %rax,%rdi
+  803f29:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2e:	48 b9 cb 10 80 00 00 	movabs $0x8010cb,%rcx
+  803f35:	00 00 00 
+  803f38:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803f3a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803f3f:	eb 2a                	jmp    803f6b <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803f41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f45:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803f49:	48 85 c0             	test   %rax,%rax
+  803f4c:	75 07                	jne    803f55 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803f4e:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803f53:	eb 16                	jmp    803f6b <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803f55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f59:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803f5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f61:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803f64:	89 d6                	mov    %edx,%esi
+  803f66:	48 89 c7             	mov    %rax,%rdi
+  803f69:	ff d1                	call   *%rcx
+}
+  803f6b:	c9                   	leave
+  803f6c:	c3                   	ret
+
+0000000000803f6d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803f6d:	55                   	push   %rbp
+  803f6e:	48 89 e5             	mov    %rsp,%rbp
+  803f71:	48 83 ec 30          	sub    $0x30,%rsp
+  803f75:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803f78:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803f7c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803f80:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f83:	48 89 d6             	mov    %rdx,%rsi
+  803f86:	89 c7                	mov    %eax,%edi
+  803f88:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  803f8f:	00 00 00 
+  803f92:	ff d0                	call   *%rax
+  803f94:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803f97:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803f9b:	78 24                	js     803fc1 <fstat+0x54>
+  803f9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fa1:	8b 00                	mov    (%rax),%eax
+  803fa3:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803fa7:	48 89 d6             	mov    %rdx,%rsi
+  803faa:	89 c7                	mov    %eax,%edi
+  803fac:	48 b8 01 38 80 00 00 	movabs $0x803801,%rax
+  803fb3:	00 00 00 
+  803fb6:	ff d0                	call   *%rax
+  803fb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fbf:	79 05                	jns    803fc6 <fstat+0x59>
+    return r;
+  803fc1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fc4:	eb 5e                	jmp    804024 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803fc6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803fca:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803fce:	48 85 c0             	test   %rax,%rax
+  803fd1:	75 07                	jne    803fda <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803fd3:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803fd8:	eb 4a                	jmp    804024 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803fda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803fde:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803fe1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803fe5:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803fec:	00 00 00 
+  stat->st_isdir   = 0;
+  803fef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ff3:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803ffa:	00 00 00 
+  stat->st_dev     = dev;
+  803ffd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804001:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804005:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80400c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804010:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  804014:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804018:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80401c:	48 89 d6             	mov    %rdx,%rsi
+  80401f:	48 89 c7             	mov    %rax,%rdi
+  804022:	ff d1                	call   *%rcx
+}
+  804024:	c9                   	leave
+  804025:	c3                   	ret
+
+0000000000804026 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  804026:	55                   	push   %rbp
+  804027:	48 89 e5             	mov    %rsp,%rbp
+  80402a:	48 83 ec 10          	sub    $0x10,%rsp
+  80402e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804032:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  804036:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80403a:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804040:	83 f8 20             	cmp    $0x20,%eax
+  804043:	75 07                	jne    80404c <pollwait_key+0x26>
+    return -E_INVAL;
+  804045:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80404a:	eb 5f                	jmp    8040ab <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80404c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804050:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  804056:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80405a:	48 63 d2             	movslq %edx,%rdx
+  80405d:	48 c1 e2 04          	shl    $0x4,%rdx
+  804061:	48 01 c2             	add    %rax,%rdx
+  804064:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804068:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  80406b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80406f:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  804075:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804079:	8b 00                	mov    (%rax),%eax
+  80407b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80407f:	48 63 c9             	movslq %ecx,%rcx
+  804082:	48 c1 e1 04          	shl    $0x4,%rcx
+  804086:	48 01 ca             	add    %rcx,%rdx
+  804089:	48 83 c2 08          	add    $0x8,%rdx
+  80408d:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  80408f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804093:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  804099:	8d 50 01             	lea    0x1(%rax),%edx
+  80409c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040a0:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8040a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040ab:	c9                   	leave
+  8040ac:	c3                   	ret
+
+00000000008040ad <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8040ad:	55                   	push   %rbp
+  8040ae:	48 89 e5             	mov    %rsp,%rbp
+  8040b1:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8040b8:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8040bf:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8040c5:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8040cc:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8040d3:	00 
+  int i, r, ready, ipc = 0;
+  8040d4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8040db:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8040e2:	00 
+  8040e3:	74 45                	je     80412a <poll+0x7d>
+  8040e5:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8040ec:	ff 
+  8040ed:	74 3b                	je     80412a <poll+0x7d>
+    now      = vsys_clock_ns();
+  8040ef:	48 b8 e8 55 80 00 00 	movabs $0x8055e8,%rax
+  8040f6:	00 00 00 
+  8040f9:	ff d0                	call   *%rax
+  8040fb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8040ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804103:	48 f7 d0             	not    %rax
+  804106:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80410d:	73 10                	jae    80411f <poll+0x72>
+  80410f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804113:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  80411a:	48 01 d0             	add    %rdx,%rax
+  80411d:	eb 07                	jmp    804126 <poll+0x79>
+  80411f:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  804126:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  80412a:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  804131:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  804138:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80413f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  804146:	e9 46 02 00 00       	jmp    804391 <poll+0x2e4>
+      fds[i].revents = 0;
+  80414b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80414e:	48 63 d0             	movslq %eax,%rdx
+  804151:	48 89 d0             	mov    %rdx,%rax
+  804154:	48 01 c0             	add    %rax,%rax
+  804157:	48 01 d0             	add    %rdx,%rax
+  80415a:	48 c1 e0 02          	shl    $0x2,%rax
+  80415e:	48 89 c2             	mov    %rax,%rdx
+  804161:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804168:	48 01 d0             	add    %rdx,%rax
+  80416b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  804172:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804175:	48 63 d0             	movslq %eax,%rdx
+  804178:	48 89 d0             	mov    %rdx,%rax
+  80417b:	48 01 c0             	add    %rax,%rax
+  80417e:	48 01 d0             	add    %rdx,%rax
+  804181:	48 c1 e0 02          	shl    $0x2,%rax
+  804185:	48 89 c2             	mov    %rax,%rdx
+  804188:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80418f:	48 01 d0             	add    %rdx,%rax
+  804192:	8b 00                	mov    (%rax),%eax
+  804194:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  804197:	75 62                	jne    8041fb <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  804199:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80419c:	48 63 d0             	movslq %eax,%rdx
+  80419f:	48 89 d0             	mov    %rdx,%rax
+  8041a2:	48 01 c0             	add    %rax,%rax
+  8041a5:	48 01 d0             	add    %rdx,%rax
+  8041a8:	48 c1 e0 02          	shl    $0x2,%rax
+  8041ac:	48 89 c2             	mov    %rax,%rdx
+  8041af:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8041b6:	48 01 d0             	add    %rdx,%rax
+  8041b9:	8b 40 04             	mov    0x4(%rax),%eax
+  8041bc:	83 e0 01             	and    $0x1,%eax
+  8041bf:	85 c0                	test   %eax,%eax
+  8041c1:	0f 84 9b 01 00 00    	je     804362 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8041c7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041ca:	48 63 d0             	movslq %eax,%rdx
+  8041cd:	48 89 d0             	mov    %rdx,%rax
+  8041d0:	48 01 c0             	add    %rax,%rax
+  8041d3:	48 01 d0             	add    %rdx,%rax
+  8041d6:	48 c1 e0 02          	shl    $0x2,%rax
+  8041da:	48 89 c2             	mov    %rax,%rdx
+  8041dd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8041e4:	48 01 c2             	add    %rax,%rdx
+  8041e7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8041ea:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8041ed:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8041f0:	83 c8 04             	or     $0x4,%eax
+  8041f3:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  8041f6:	e9 67 01 00 00       	jmp    804362 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8041fb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041fe:	48 63 d0             	movslq %eax,%rdx
+  804201:	48 89 d0             	mov    %rdx,%rax
+  804204:	48 01 c0             	add    %rax,%rax
+  804207:	48 01 d0             	add    %rdx,%rax
+  80420a:	48 c1 e0 02          	shl    $0x2,%rax
+  80420e:	48 89 c2             	mov    %rax,%rdx
+  804211:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804218:	48 01 d0             	add    %rdx,%rax
+  80421b:	8b 00                	mov    (%rax),%eax
+  80421d:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  804224:	48 89 d6             	mov    %rdx,%rsi
+  804227:	89 c7                	mov    %eax,%edi
+  804229:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  804230:	00 00 00 
+  804233:	ff d0                	call   *%rax
+  804235:	85 c0                	test   %eax,%eax
+  804237:	78 25                	js     80425e <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  804239:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804240:	8b 00                	mov    (%rax),%eax
+  804242:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  804249:	48 89 d6             	mov    %rdx,%rsi
+  80424c:	89 c7                	mov    %eax,%edi
+  80424e:	48 b8 01 38 80 00 00 	movabs $0x803801,%rax
+  804255:	00 00 00 
+  804258:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80425a:	85 c0                	test   %eax,%eax
+  80425c:	79 2c                	jns    80428a <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80425e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804261:	48 63 d0             	movslq %eax,%rdx
+  804264:	48 89 d0             	mov    %rdx,%rax
+  804267:	48 01 c0             	add    %rax,%rax
+  80426a:	48 01 d0             	add    %rdx,%rax
+  80426d:	48 c1 e0 02          	shl    $0x2,%rax
+  804271:	48 89 c2             	mov    %rax,%rdx
+  804274:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80427b:	48 01 d0             	add    %rdx,%rax
+  80427e:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  804285:	e9 d8 00 00 00       	jmp    804362 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80428a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804291:	48 8b 40 38          	mov    0x38(%rax),%rax
+  804295:	48 85 c0             	test   %rax,%rax
+  804298:	74 7d                	je     804317 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80429a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8042a1:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8042a5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042a8:	48 63 d0             	movslq %eax,%rdx
+  8042ab:	48 89 d0             	mov    %rdx,%rax
+  8042ae:	48 01 c0             	add    %rax,%rax
+  8042b1:	48 01 d0             	add    %rdx,%rax
+  8042b4:	48 c1 e0 02          	shl    $0x2,%rax
+  8042b8:	48 89 c2             	mov    %rax,%rdx
+  8042bb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8042c2:	48 01 d0             	add    %rdx,%rax
+  8042c5:	8b 48 04             	mov    0x4(%rax),%ecx
+  8042c8:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8042cf:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8042d6:	89 ce                	mov    %ecx,%esi
+  8042d8:	48 89 c7             	mov    %rax,%rdi
+  8042db:	41 ff d0             	call   *%r8
+  8042de:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8042e1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8042e5:	79 08                	jns    8042ef <poll+0x242>
+          return r;
+  8042e7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8042ea:	e9 45 01 00 00       	jmp    804434 <poll+0x387>
+        fds[i].revents = r;
+  8042ef:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8042f2:	48 63 d0             	movslq %eax,%rdx
+  8042f5:	48 89 d0             	mov    %rdx,%rax
+  8042f8:	48 01 c0             	add    %rax,%rax
+  8042fb:	48 01 d0             	add    %rdx,%rax
+  8042fe:	48 c1 e0 02          	shl    $0x2,%rax
+  804302:	48 89 c2             	mov    %rax,%rdx
+  804305:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80430c:	48 01 c2             	add    %rax,%rdx
+  80430f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804312:	89 42 08             	mov    %eax,0x8(%rdx)
+  804315:	eb 4b                	jmp    804362 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  804317:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80431a:	48 63 d0             	movslq %eax,%rdx
+  80431d:	48 89 d0             	mov    %rdx,%rax
+  804320:	48 01 c0             	add    %rax,%rax
+  804323:	48 01 d0             	add    %rdx,%rax
+  804326:	48 c1 e0 02          	shl    $0x2,%rax
+  80432a:	48 89 c2             	mov    %rax,%rdx
+  80432d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804334:	48 01 d0             	add    %rdx,%rax
+  804337:	8b 48 04             	mov    0x4(%rax),%ecx
+  80433a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80433d:	48 63 d0             	movslq %eax,%rdx
+  804340:	48 89 d0             	mov    %rdx,%rax
+  804343:	48 01 c0             	add    %rax,%rax
+  804346:	48 01 d0             	add    %rdx,%rax
+  804349:	48 c1 e0 02          	shl    $0x2,%rax
+  80434d:	48 89 c2             	mov    %rax,%rdx
+  804350:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804357:	48 01 d0             	add    %rdx,%rax
+  80435a:	83 e1 03             	and    $0x3,%ecx
+  80435d:	89 ca                	mov    %ecx,%edx
+  80435f:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804362:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804365:	48 63 d0             	movslq %eax,%rdx
+  804368:	48 89 d0             	mov    %rdx,%rax
+  80436b:	48 01 c0             	add    %rax,%rax
+  80436e:	48 01 d0             	add    %rdx,%rax
+  804371:	48 c1 e0 02          	shl    $0x2,%rax
+  804375:	48 89 c2             	mov    %rax,%rdx
+  804378:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80437f:	48 01 d0             	add    %rdx,%rax
+  804382:	8b 40 08             	mov    0x8(%rax),%eax
+  804385:	85 c0                	test   %eax,%eax
+  804387:	74 04                	je     80438d <poll+0x2e0>
+        ready++;
+  804389:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80438d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804391:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804394:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80439a:	0f 8c ab fd ff ff    	jl     80414b <poll+0x9e>
+    }
+    if (ready)
+  8043a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8043a4:	74 08                	je     8043ae <poll+0x301>
+      return ready;
+  8043a6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8043a9:	e9 86 00 00 00       	jmp    804434 <poll+0x387>
+
+    if (deadline) {
+  8043ae:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8043b3:	74 30                	je     8043e5 <poll+0x338>
+      now     = vsys_clock_ns();
+  8043b5:	48 b8 e8 55 80 00 00 	movabs $0x8055e8,%rax
+  8043bc:	00 00 00 
+  8043bf:	ff d0                	call   *%rax
+  8043c1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8043c5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043c9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8043cd:	73 0a                	jae    8043d9 <poll+0x32c>
+  8043cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d3:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8043d7:	eb 05                	jmp    8043de <poll+0x331>
+  8043d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043de:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8043e5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8043e8:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8043eb:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8043f2:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8043f9:	48 89 c7             	mov    %rax,%rdi
+  8043fc:	48 b8 91 32 80 00 00 	movabs $0x803291,%rax
+  804403:	00 00 00 
+  804406:	ff d0                	call   *%rax
+  804408:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  80440b:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  80440f:	75 07                	jne    804418 <poll+0x36b>
+      return 0;
+  804411:	b8 00 00 00 00       	mov    $0x0,%eax
+  804416:	eb 1c                	jmp    804434 <poll+0x387>
+    if (r < 0)
+  804418:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80441c:	79 05                	jns    804423 <poll+0x376>
+      return r;
+  80441e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804421:	eb 11                	jmp    804434 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  804423:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804426:	c1 f8 02             	sar    $0x2,%eax
+  804429:	83 e0 01             	and    $0x1,%eax
+  80442c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  80442f:	e9 f6 fc ff ff       	jmp    80412a <poll+0x7d>
+  }
+}
+  804434:	c9                   	leave
+  804435:	c3                   	ret
+
+0000000000804436 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  804436:	55                   	push   %rbp
+  804437:	48 89 e5             	mov    %rsp,%rbp
+  80443a:	48 83 ec 20          	sub    $0x20,%rsp
+  80443e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804442:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  804446:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80444a:	be 00 00 00 00       	mov    $0x0,%esi
+  80444f:	48 89 c7             	mov    %rax,%rdi
+  804452:	48 b8 24 45 80 00 00 	movabs $0x804524,%rax
+  804459:	00 00 00 
+  80445c:	ff d0                	call   *%rax
+  80445e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804461:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804465:	79 05                	jns    80446c <stat+0x36>
+    return fd;
+  804467:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80446a:	eb 2f                	jmp    80449b <stat+0x65>
+  r = fstat(fd, stat);
+  80446c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804470:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804473:	48 89 d6             	mov    %rdx,%rsi
+  804476:	89 c7                	mov    %eax,%edi
+  804478:	48 b8 6d 3f 80 00 00 	movabs $0x803f6d,%rax
+  80447f:	00 00 00 
+  804482:	ff d0                	call   *%rax
+  804484:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804487:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80448a:	89 c7                	mov    %eax,%edi
+  80448c:	48 b8 d5 38 80 00 00 	movabs $0x8038d5,%rax
+  804493:	00 00 00 
+  804496:	ff d0                	call   *%rax
+  return r;
+  804498:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80449b:	c9                   	leave
+  80449c:	c3                   	ret
+
+000000000080449d <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80449d:	55                   	push   %rbp
+  80449e:	48 89 e5             	mov    %rsp,%rbp
+  8044a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8044a5:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8044a8:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8044ac:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8044b3:	00 00 00 
+  8044b6:	8b 00                	mov    (%rax),%eax
+  8044b8:	85 c0                	test   %eax,%eax
+  8044ba:	75 1d                	jne    8044d9 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8044bc:	bf 03 00 00 00       	mov    $0x3,%edi
+  8044c1:	48 b8 03 5c 80 00 00 	movabs $0x805c03,%rax
+  8044c8:	00 00 00 
+  8044cb:	ff d0                	call   *%rax
+  8044cd:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  8044d4:	00 00 00 
+  8044d7:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  8044d9:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  8044e0:	00 00 00 
+  8044e3:	8b 00                	mov    (%rax),%eax
+  8044e5:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8044e8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8044ed:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8044f4:	00 00 00 
+  8044f7:	89 c7                	mov    %eax,%edi
+  8044f9:	48 b8 56 5b 80 00 00 	movabs $0x805b56,%rax
+  804500:	00 00 00 
+  804503:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  804505:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804509:	ba 00 00 00 00       	mov    $0x0,%edx
+  80450e:	48 89 c6             	mov    %rax,%rsi
+  804511:	bf 00 00 00 00       	mov    $0x0,%edi
+  804516:	48 b8 d9 59 80 00 00 	movabs $0x8059d9,%rax
+  80451d:	00 00 00 
+  804520:	ff d0                	call   *%rax
+}
+  804522:	c9                   	leave
+  804523:	c3                   	ret
+
+0000000000804524 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  804524:	55                   	push   %rbp
+  804525:	48 89 e5             	mov    %rsp,%rbp
+  804528:	48 83 ec 20          	sub    $0x20,%rsp
+  80452c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804530:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  804533:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804537:	48 89 c7             	mov    %rax,%rdi
+  80453a:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  804541:	00 00 00 
+  804544:	ff d0                	call   *%rax
+  804546:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80454b:	7e 0a                	jle    804557 <open+0x33>
+    return -E_BAD_PATH;
+  80454d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804552:	e9 a8 00 00 00       	jmp    8045ff <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804557:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80455b:	48 89 c7             	mov    %rax,%rdi
+  80455e:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  804565:	00 00 00 
+  804568:	ff d0                	call   *%rax
+  80456a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80456d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804571:	79 08                	jns    80457b <open+0x57>
+    return r;
+  804573:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804576:	e9 84 00 00 00       	jmp    8045ff <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80457b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80457f:	48 89 c6             	mov    %rax,%rsi
+  804582:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804589:	00 00 00 
+  80458c:	48 89 c7             	mov    %rax,%rdi
+  80458f:	48 b8 7b 20 80 00 00 	movabs $0x80207b,%rax
+  804596:	00 00 00 
+  804599:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  80459b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8045a2:	00 00 00 
+  8045a5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8045a8:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8045ae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045b2:	48 89 c6             	mov    %rax,%rsi
+  8045b5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8045ba:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8045c1:	00 00 00 
+  8045c4:	ff d0                	call   *%rax
+  8045c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8045c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045cd:	79 1d                	jns    8045ec <open+0xc8>
+    fd_close(fd, 0);
+  8045cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8045d8:	48 89 c7             	mov    %rax,%rdi
+  8045db:	48 b8 36 37 80 00 00 	movabs $0x803736,%rax
+  8045e2:	00 00 00 
+  8045e5:	ff d0                	call   *%rax
+    return r;
+  8045e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8045ea:	eb 13                	jmp    8045ff <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8045ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045f0:	48 89 c7             	mov    %rax,%rdi
+  8045f3:	48 b8 30 35 80 00 00 	movabs $0x803530,%rax
+  8045fa:	00 00 00 
+  8045fd:	ff d0                	call   *%rax
+}
+  8045ff:	c9                   	leave
+  804600:	c3                   	ret
+
+0000000000804601 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  804601:	55                   	push   %rbp
+  804602:	48 89 e5             	mov    %rsp,%rbp
+  804605:	48 83 ec 10          	sub    $0x10,%rsp
+  804609:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80460d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804611:	8b 40 0c             	mov    0xc(%rax),%eax
+  804614:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80461b:	00 00 00 
+  80461e:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  804620:	be 00 00 00 00       	mov    $0x0,%esi
+  804625:	bf 06 00 00 00       	mov    $0x6,%edi
+  80462a:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  804631:	00 00 00 
+  804634:	ff d0                	call   *%rax
+}
+  804636:	c9                   	leave
+  804637:	c3                   	ret
+
+0000000000804638 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  804638:	55                   	push   %rbp
+  804639:	48 89 e5             	mov    %rsp,%rbp
+  80463c:	48 83 ec 30          	sub    $0x30,%rsp
+  804640:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804644:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804648:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80464c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804651:	74 07                	je     80465a <devfile_read+0x22>
+  804653:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804658:	75 0a                	jne    804664 <devfile_read+0x2c>
+  return E_INVAL;
+  80465a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80465f:	e9 b4 00 00 00       	jmp    804718 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804664:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80466b:	00 
+  while (n) {
+  80466c:	e9 98 00 00 00       	jmp    804709 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804671:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804675:	8b 40 0c             	mov    0xc(%rax),%eax
+  804678:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80467f:	00 00 00 
+  804682:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  804684:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80468b:	00 00 00 
+  80468e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804692:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  804696:	be 00 00 00 00       	mov    $0x0,%esi
+  80469b:	bf 03 00 00 00       	mov    $0x3,%edi
+  8046a0:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8046a7:	00 00 00 
+  8046aa:	ff d0                	call   *%rax
+  8046ac:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8046af:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8046b3:	7f 13                	jg     8046c8 <devfile_read+0x90>
+      return res ? res : res0;
+  8046b5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8046b9:	74 07                	je     8046c2 <devfile_read+0x8a>
+  8046bb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046be:	48 98                	cltq
+  8046c0:	eb 56                	jmp    804718 <devfile_read+0xe0>
+  8046c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046c6:	eb 50                	jmp    804718 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8046c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046cb:	48 63 d0             	movslq %eax,%rdx
+  8046ce:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046d2:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  8046d9:	00 00 00 
+  8046dc:	48 89 ce             	mov    %rcx,%rsi
+  8046df:	48 89 c7             	mov    %rax,%rdi
+  8046e2:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  8046e9:	00 00 00 
+  8046ec:	ff d0                	call   *%rax
+
+    buf += res;
+  8046ee:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046f1:	48 98                	cltq
+  8046f3:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8046f7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046fa:	48 98                	cltq
+  8046fc:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  804700:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804703:	48 98                	cltq
+  804705:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804709:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80470e:	0f 85 5d ff ff ff    	jne    804671 <devfile_read+0x39>
+  }
+
+  return res0;
+  804714:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  804718:	c9                   	leave
+  804719:	c3                   	ret
+
+000000000080471a <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80471a:	55                   	push   %rbp
+  80471b:	48 89 e5             	mov    %rsp,%rbp
+  80471e:	48 83 ec 50          	sub    $0x50,%rsp
+  804722:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804726:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  80472a:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80472e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  804733:	74 07                	je     80473c <devfile_write+0x22>
+  804735:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80473a:	75 0a                	jne    804746 <devfile_write+0x2c>
+  return E_INVAL;
+  80473c:	b8 03 00 00 00       	mov    $0x3,%eax
+  804741:	e9 c9 00 00 00       	jmp    80480f <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804746:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80474d:	00 
+
+  while (n) {
+  80474e:	e9 ad 00 00 00       	jmp    804800 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804753:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804757:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80475b:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804762:	00 
+  804763:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804767:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80476b:	48 39 c2             	cmp    %rax,%rdx
+  80476e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804772:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804776:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80477a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80477e:	48 89 c6             	mov    %rax,%rsi
+  804781:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  804788:	00 00 00 
+  80478b:	48 89 c7             	mov    %rax,%rdi
+  80478e:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  804795:	00 00 00 
+  804798:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80479a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80479e:	8b 40 0c             	mov    0xc(%rax),%eax
+  8047a1:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047a8:	00 00 00 
+  8047ab:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8047ad:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047b4:	00 00 00 
+  8047b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8047bb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8047bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8047c4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8047c9:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8047d0:	00 00 00 
+  8047d3:	ff d0                	call   *%rax
+  8047d5:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  8047d8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8047dc:	79 07                	jns    8047e5 <devfile_write+0xcb>
+      return res;
+  8047de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047e1:	48 98                	cltq
+  8047e3:	eb 2a                	jmp    80480f <devfile_write+0xf5>
+
+    buf += res;
+  8047e5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047e8:	48 98                	cltq
+  8047ea:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8047ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047f1:	48 98                	cltq
+  8047f3:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8047f7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8047fa:	48 98                	cltq
+  8047fc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  804800:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  804805:	0f 85 48 ff ff ff    	jne    804753 <devfile_write+0x39>
+  }
+
+  return res0;
+  80480b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  80480f:	c9                   	leave
+  804810:	c3                   	ret
+
+0000000000804811 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804811:	55                   	push   %rbp
+  804812:	48 89 e5             	mov    %rsp,%rbp
+  804815:	48 83 ec 20          	sub    $0x20,%rsp
+  804819:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80481d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804821:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804825:	8b 40 0c             	mov    0xc(%rax),%eax
+  804828:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80482f:	00 00 00 
+  804832:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  804834:	be 00 00 00 00       	mov    $0x0,%esi
+  804839:	bf 05 00 00 00       	mov    $0x5,%edi
+  80483e:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  804845:	00 00 00 
+  804848:	ff d0                	call   *%rax
+  80484a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80484d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804851:	79 05                	jns    804858 <devfile_stat+0x47>
+    return r;
+  804853:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804856:	eb 59                	jmp    8048b1 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804858:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80485c:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804863:	00 00 00 
+  804866:	48 89 d6             	mov    %rdx,%rsi
+  804869:	48 89 c7             	mov    %rax,%rdi
+  80486c:	48 b8 7b 20 80 00 00 	movabs $0x80207b,%rax
+  804873:	00 00 00 
+  804876:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804878:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80487f:	00 00 00 
+  804882:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804888:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80488c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804892:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804899:	00 00 00 
+  80489c:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  8048a2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048a6:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  8048ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048b1:	c9                   	leave
+  8048b2:	c3                   	ret
+
+00000000008048b3 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8048b3:	55                   	push   %rbp
+  8048b4:	48 89 e5             	mov    %rsp,%rbp
+  8048b7:	48 83 ec 10          	sub    $0x10,%rsp
+  8048bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8048bf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8048c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8048c9:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8048d0:	00 00 00 
+  8048d3:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  8048d5:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8048dc:	00 00 00 
+  8048df:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8048e2:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8048e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8048ea:	bf 02 00 00 00       	mov    $0x2,%edi
+  8048ef:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8048f6:	00 00 00 
+  8048f9:	ff d0                	call   *%rax
+}
+  8048fb:	c9                   	leave
+  8048fc:	c3                   	ret
+
+00000000008048fd <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8048fd:	55                   	push   %rbp
+  8048fe:	48 89 e5             	mov    %rsp,%rbp
+  804901:	48 83 ec 18          	sub    $0x18,%rsp
+  804905:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804909:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80490c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  804910:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804913:	83 e0 03             	and    $0x3,%eax
+}
+  804916:	c9                   	leave
+  804917:	c3                   	ret
+
+0000000000804918 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  804918:	55                   	push   %rbp
+  804919:	48 89 e5             	mov    %rsp,%rbp
+  80491c:	48 83 ec 10          	sub    $0x10,%rsp
+  804920:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  804924:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804928:	48 89 c7             	mov    %rax,%rdi
+  80492b:	48 b8 7a 1f 80 00 00 	movabs $0x801f7a,%rax
+  804932:	00 00 00 
+  804935:	ff d0                	call   *%rax
+  804937:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80493c:	7e 07                	jle    804945 <remove+0x2d>
+    return -E_BAD_PATH;
+  80493e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804943:	eb 36                	jmp    80497b <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804945:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804949:	48 89 c6             	mov    %rax,%rsi
+  80494c:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804953:	00 00 00 
+  804956:	48 89 c7             	mov    %rax,%rdi
+  804959:	48 b8 7b 20 80 00 00 	movabs $0x80207b,%rax
+  804960:	00 00 00 
+  804963:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804965:	be 00 00 00 00       	mov    $0x0,%esi
+  80496a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80496f:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  804976:	00 00 00 
+  804979:	ff d0                	call   *%rax
+}
+  80497b:	c9                   	leave
+  80497c:	c3                   	ret
+
+000000000080497d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80497d:	55                   	push   %rbp
+  80497e:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804981:	be 00 00 00 00       	mov    $0x0,%esi
+  804986:	bf 08 00 00 00       	mov    $0x8,%edi
+  80498b:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  804992:	00 00 00 
+  804995:	ff d0                	call   *%rax
+}
+  804997:	5d                   	pop    %rbp
+  804998:	c3                   	ret
+
+0000000000804999 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804999:	55                   	push   %rbp
+  80499a:	48 89 e5             	mov    %rsp,%rbp
+  80499d:	48 83 ec 20          	sub    $0x20,%rsp
+  8049a1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8049a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8049aa:	bf 09 00 00 00       	mov    $0x9,%edi
+  8049af:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8049b6:	00 00 00 
+  8049b9:	ff d0                	call   *%rax
+  8049bb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8049be:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049c2:	79 05                	jns    8049c9 <fs_stats+0x30>
+    return r;
+  8049c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049c7:	eb 2a                	jmp    8049f3 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  8049c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049cd:	ba 68 00 00 00       	mov    $0x68,%edx
+  8049d2:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  8049d9:	00 00 00 
+  8049dc:	48 89 ce             	mov    %rcx,%rsi
+  8049df:	48 89 c7             	mov    %rax,%rdi
+  8049e2:	48 b8 be 25 80 00 00 	movabs $0x8025be,%rax
+  8049e9:	00 00 00 
+  8049ec:	ff d0                	call   *%rax
+  return 0;
+  8049ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049f3:	c9                   	leave
+  8049f4:	c3                   	ret
+
+00000000008049f5 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  8049f5:	55                   	push   %rbp
+  8049f6:	48 89 e5             	mov    %rsp,%rbp
+  8049f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8049fd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  804a00:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804a07:	00 00 00 
+  804a0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a0d:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  804a0f:	be 00 00 00 00       	mov    $0x0,%esi
+  804a14:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804a19:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  804a20:	00 00 00 
+  804a23:	ff d0                	call   *%rax
+}
+  804a25:	c9                   	leave
+  804a26:	c3                   	ret
+
+0000000000804a27 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804a27:	55                   	push   %rbp
+  804a28:	48 89 e5             	mov    %rsp,%rbp
+  804a2b:	48 83 ec 10          	sub    $0x10,%rsp
+  804a2f:	89 f8                	mov    %edi,%eax
+  804a31:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804a34:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804a38:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804a3f:	00 00 00 
+  804a42:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804a44:	be 00 00 00 00       	mov    $0x0,%esi
+  804a49:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804a4e:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  804a55:	00 00 00 
+  804a58:	ff d0                	call   *%rax
+}
+  804a5a:	c9                   	leave
+  804a5b:	c3                   	ret
+
+0000000000804a5c <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  804a5c:	55                   	push   %rbp
+  804a5d:	48 89 e5             	mov    %rsp,%rbp
+  804a60:	48 83 ec 10          	sub    $0x10,%rsp
+  804a64:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804a68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a6c:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804a71:	48 89 c7             	mov    %rax,%rdi
+  804a74:	48 b8 82 4a 80 00 00 	movabs $0x804a82,%rax
+  804a7b:	00 00 00 
+  804a7e:	ff d0                	call   *%rax
+}
+  804a80:	c9                   	leave
+  804a81:	c3                   	ret
+
+0000000000804a82 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804a82:	55                   	push   %rbp
+  804a83:	48 89 e5             	mov    %rsp,%rbp
+  804a86:	48 83 ec 50          	sub    $0x50,%rsp
+  804a8a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804a8e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804a92:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804a99:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804a9a:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  804a9f:	74 0a                	je     804aab <pipe_size+0x29>
+  804aa1:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804aa8:	00 
+  804aa9:	76 0a                	jbe    804ab5 <pipe_size+0x33>
+    return -E_INVAL;
+  804aab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804ab0:	e9 cc 02 00 00       	jmp    804d81 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804ab5:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804ab9:	48 89 c7             	mov    %rax,%rdi
+  804abc:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  804ac3:	00 00 00 
+  804ac6:	ff d0                	call   *%rax
+  804ac8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804acb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804acf:	0f 88 a8 02 00 00    	js     804d7d <pipe_size+0x2fb>
+  804ad5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ad9:	ba 07 04 00 00       	mov    $0x407,%edx
+  804ade:	48 89 c6             	mov    %rax,%rsi
+  804ae1:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ae6:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  804aed:	00 00 00 
+  804af0:	ff d0                	call   *%rax
+  804af2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804af5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804af9:	0f 88 7e 02 00 00    	js     804d7d <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804aff:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804b03:	48 89 c7             	mov    %rax,%rdi
+  804b06:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  804b0d:	00 00 00 
+  804b10:	ff d0                	call   *%rax
+  804b12:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b15:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b19:	0f 88 43 02 00 00    	js     804d62 <pipe_size+0x2e0>
+  804b1f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b23:	ba 07 04 00 00       	mov    $0x407,%edx
+  804b28:	48 89 c6             	mov    %rax,%rsi
+  804b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b30:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  804b37:	00 00 00 
+  804b3a:	ff d0                	call   *%rax
+  804b3c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b3f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b43:	0f 88 19 02 00 00    	js     804d62 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804b49:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b4d:	48 89 c7             	mov    %rax,%rdi
+  804b50:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  804b57:	00 00 00 
+  804b5a:	ff d0                	call   *%rax
+  804b5c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804b60:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804b67:	00 
+  804b68:	e9 a2 00 00 00       	jmp    804c0f <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804b6d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b71:	48 c1 e0 0c          	shl    $0xc,%rax
+  804b75:	48 89 c2             	mov    %rax,%rdx
+  804b78:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b7c:	48 01 d0             	add    %rdx,%rax
+  804b7f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804b84:	48 89 c6             	mov    %rax,%rsi
+  804b87:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b8c:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  804b93:	00 00 00 
+  804b96:	ff d0                	call   *%rax
+  804b98:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804b9b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804b9f:	0f 88 37 01 00 00    	js     804cdc <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804ba5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ba9:	48 89 c7             	mov    %rax,%rdi
+  804bac:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  804bb3:	00 00 00 
+  804bb6:	ff d0                	call   *%rax
+  804bb8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bbc:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804bc0:	48 01 c2             	add    %rax,%rdx
+  804bc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bc7:	48 c1 e0 0c          	shl    $0xc,%rax
+  804bcb:	48 89 c1             	mov    %rax,%rcx
+  804bce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bd2:	48 01 c8             	add    %rcx,%rax
+  804bd5:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804bdb:	48 89 d1             	mov    %rdx,%rcx
+  804bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  804be3:	48 89 c6             	mov    %rax,%rsi
+  804be6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804beb:	48 b8 a1 2e 80 00 00 	movabs $0x802ea1,%rax
+  804bf2:	00 00 00 
+  804bf5:	ff d0                	call   *%rax
+  804bf7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804bfa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bfe:	79 0a                	jns    804c0a <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  804c00:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804c05:	e9 d3 00 00 00       	jmp    804cdd <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804c0a:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  804c0f:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804c16:	00 
+  804c17:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804c1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c1f:	48 01 d0             	add    %rdx,%rax
+  804c22:	48 83 c0 1f          	add    $0x1f,%rax
+  804c26:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804c2a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c33:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804c37:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c3b:	48 29 d0             	sub    %rdx,%rax
+  804c3e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804c42:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804c46:	0f 82 21 ff ff ff    	jb     804b6d <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804c4c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c50:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804c54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804c58:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804c5c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804c60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c64:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804c6b:	00 00 00 
+  804c6e:	8b 12                	mov    (%rdx),%edx
+  804c70:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804c72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c76:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804c7d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c81:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804c88:	00 00 00 
+  804c8b:	8b 12                	mov    (%rdx),%edx
+  804c8d:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804c8f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804c93:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804c9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c9e:	48 89 c7             	mov    %rax,%rdi
+  804ca1:	48 b8 30 35 80 00 00 	movabs $0x803530,%rax
+  804ca8:	00 00 00 
+  804cab:	ff d0                	call   *%rax
+  804cad:	89 c2                	mov    %eax,%edx
+  804caf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804cb3:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804cb5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804cb9:	48 89 c7             	mov    %rax,%rdi
+  804cbc:	48 b8 30 35 80 00 00 	movabs $0x803530,%rax
+  804cc3:	00 00 00 
+  804cc6:	ff d0                	call   *%rax
+  804cc8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804ccc:	48 83 c2 04          	add    $0x4,%rdx
+  804cd0:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd7:	e9 a5 00 00 00       	jmp    804d81 <pipe_size+0x2ff>
+      goto err2;
+  804cdc:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804cdd:	eb 58                	jmp    804d37 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804cdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ce3:	48 c1 e0 0c          	shl    $0xc,%rax
+  804ce7:	48 89 c2             	mov    %rax,%rdx
+  804cea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cee:	48 01 d0             	add    %rdx,%rax
+  804cf1:	48 89 c6             	mov    %rax,%rsi
+  804cf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804cf9:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  804d00:	00 00 00 
+  804d03:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804d05:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d09:	48 89 c7             	mov    %rax,%rdi
+  804d0c:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  804d13:	00 00 00 
+  804d16:	ff d0                	call   *%rax
+  804d18:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804d1c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804d20:	48 01 d0             	add    %rdx,%rax
+  804d23:	48 89 c6             	mov    %rax,%rsi
+  804d26:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d2b:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  804d32:	00 00 00 
+  804d35:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804d37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d3b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804d3f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804d43:	48 85 c0             	test   %rax,%rax
+  804d46:	75 97                	jne    804cdf <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804d48:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804d4c:	48 89 c6             	mov    %rax,%rsi
+  804d4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d54:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  804d5b:	00 00 00 
+  804d5e:	ff d0                	call   *%rax
+  804d60:	eb 01                	jmp    804d63 <pipe_size+0x2e1>
+    goto err1;
+  804d62:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804d63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d67:	48 89 c6             	mov    %rax,%rsi
+  804d6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d6f:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  804d76:	00 00 00 
+  804d79:	ff d0                	call   *%rax
+  804d7b:	eb 01                	jmp    804d7e <pipe_size+0x2fc>
+    goto err;
+  804d7d:	90                   	nop
+err:
+  return r;
+  804d7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804d81:	c9                   	leave
+  804d82:	c3                   	ret
+
+0000000000804d83 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804d83:	55                   	push   %rbp
+  804d84:	48 89 e5             	mov    %rsp,%rbp
+  804d87:	53                   	push   %rbx
+  804d88:	48 83 ec 28          	sub    $0x28,%rsp
+  804d8c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804d90:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804d94:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d9b:	00 00 00 
+  804d9e:	8b 40 04             	mov    0x4(%rax),%eax
+  804da1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804da6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804dad:	00 00 00 
+  804db0:	48 98                	cltq
+  804db2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804db9:	48 01 d0             	add    %rdx,%rax
+  804dbc:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804dc2:	8b 00                	mov    (%rax),%eax
+  804dc4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804dc7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804dcb:	48 89 c7             	mov    %rax,%rdi
+  804dce:	48 b8 74 5c 80 00 00 	movabs $0x805c74,%rax
+  804dd5:	00 00 00 
+  804dd8:	ff d0                	call   *%rax
+  804dda:	89 c3                	mov    %eax,%ebx
+  804ddc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804de0:	48 89 c7             	mov    %rax,%rdi
+  804de3:	48 b8 74 5c 80 00 00 	movabs $0x805c74,%rax
+  804dea:	00 00 00 
+  804ded:	ff d0                	call   *%rax
+  804def:	39 c3                	cmp    %eax,%ebx
+  804df1:	0f 94 c0             	sete   %al
+  804df4:	0f b6 c0             	movzbl %al,%eax
+  804df7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804dfa:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e01:	00 00 00 
+  804e04:	8b 40 04             	mov    0x4(%rax),%eax
+  804e07:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e0c:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e13:	00 00 00 
+  804e16:	48 98                	cltq
+  804e18:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e1f:	48 01 d0             	add    %rdx,%rax
+  804e22:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804e28:	8b 00                	mov    (%rax),%eax
+  804e2a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804e2d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e30:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804e33:	75 05                	jne    804e3a <_pipeisclosed+0xb7>
+      return ret;
+  804e35:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804e38:	eb 68                	jmp    804ea2 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804e3a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e3d:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804e40:	0f 84 4e ff ff ff    	je     804d94 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804e46:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e4d:	00 00 00 
+  804e50:	8b 40 04             	mov    0x4(%rax),%eax
+  804e53:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e58:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e5f:	00 00 00 
+  804e62:	48 98                	cltq
+  804e64:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e6b:	48 01 d0             	add    %rdx,%rax
+  804e6e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804e74:	8b 10                	mov    (%rax),%edx
+  804e76:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804e79:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e7c:	89 c6                	mov    %eax,%esi
+  804e7e:	48 b8 20 66 80 00 00 	movabs $0x806620,%rax
+  804e85:	00 00 00 
+  804e88:	48 89 c7             	mov    %rax,%rdi
+  804e8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e90:	49 b8 cb 10 80 00 00 	movabs $0x8010cb,%r8
+  804e97:	00 00 00 
+  804e9a:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804e9d:	e9 f2 fe ff ff       	jmp    804d94 <_pipeisclosed+0x11>
+  }
+}
+  804ea2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804ea6:	c9                   	leave
+  804ea7:	c3                   	ret
+
+0000000000804ea8 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804ea8:	55                   	push   %rbp
+  804ea9:	48 89 e5             	mov    %rsp,%rbp
+  804eac:	48 83 ec 30          	sub    $0x30,%rsp
+  804eb0:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804eb3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804eb7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804eba:	48 89 d6             	mov    %rdx,%rsi
+  804ebd:	89 c7                	mov    %eax,%edi
+  804ebf:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  804ec6:	00 00 00 
+  804ec9:	ff d0                	call   *%rax
+  804ecb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804ece:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ed2:	79 05                	jns    804ed9 <pipeisclosed+0x31>
+    return r;
+  804ed4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ed7:	eb 31                	jmp    804f0a <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804ed9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804edd:	48 89 c7             	mov    %rax,%rdi
+  804ee0:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  804ee7:	00 00 00 
+  804eea:	ff d0                	call   *%rax
+  804eec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804ef0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ef4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804ef8:	48 89 d6             	mov    %rdx,%rsi
+  804efb:	48 89 c7             	mov    %rax,%rdi
+  804efe:	48 b8 83 4d 80 00 00 	movabs $0x804d83,%rax
+  804f05:	00 00 00 
+  804f08:	ff d0                	call   *%rax
+}
+  804f0a:	c9                   	leave
+  804f0b:	c3                   	ret
+
+0000000000804f0c <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804f0c:	55                   	push   %rbp
+  804f0d:	48 89 e5             	mov    %rsp,%rbp
+  804f10:	48 83 ec 10          	sub    $0x10,%rsp
+  804f14:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804f18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f1c:	8b 40 18             	mov    0x18(%rax),%eax
+  804f1f:	8d 50 01             	lea    0x1(%rax),%edx
+  804f22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f26:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804f29:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f2d:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804f30:	85 c0                	test   %eax,%eax
+  804f32:	74 27                	je     804f5b <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804f34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f38:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804f3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f43:	48 83 c0 18          	add    $0x18,%rax
+  804f47:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804f4c:	48 89 c7             	mov    %rax,%rdi
+  804f4f:	48 b8 44 32 80 00 00 	movabs $0x803244,%rax
+  804f56:	00 00 00 
+  804f59:	ff d0                	call   *%rax
+  }
+}
+  804f5b:	90                   	nop
+  804f5c:	c9                   	leave
+  804f5d:	c3                   	ret
+
+0000000000804f5e <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804f5e:	55                   	push   %rbp
+  804f5f:	48 89 e5             	mov    %rsp,%rbp
+  804f62:	48 83 ec 10          	sub    $0x10,%rsp
+  804f66:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804f6a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804f6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f71:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804f78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804f7c:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804f80:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804f83:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804f8a:	89 c6                	mov    %eax,%esi
+  804f8c:	48 89 cf             	mov    %rcx,%rdi
+  804f8f:	48 b8 f5 31 80 00 00 	movabs $0x8031f5,%rax
+  804f96:	00 00 00 
+  804f99:	ff d0                	call   *%rax
+}
+  804f9b:	90                   	nop
+  804f9c:	c9                   	leave
+  804f9d:	c3                   	ret
+
+0000000000804f9e <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804f9e:	55                   	push   %rbp
+  804f9f:	48 89 e5             	mov    %rsp,%rbp
+  804fa2:	48 83 ec 70          	sub    $0x70,%rsp
+  804fa6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804faa:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804fae:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804fb2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804fb6:	48 89 c7             	mov    %rax,%rdi
+  804fb9:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  804fc0:	00 00 00 
+  804fc3:	ff d0                	call   *%rax
+  804fc5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804fc9:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804fce:	75 0a                	jne    804fda <devpipe_read+0x3c>
+    return 0;
+  804fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fd5:	e9 63 01 00 00       	jmp    80513d <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804fda:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fde:	8b 40 18             	mov    0x18(%rax),%eax
+  804fe1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804fe4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fe8:	48 8b 10             	mov    (%rax),%rdx
+  804feb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ff3:	48 39 c2             	cmp    %rax,%rdx
+  804ff6:	75 42                	jne    80503a <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804ff8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ffc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805000:	48 89 d6             	mov    %rdx,%rsi
+  805003:	48 89 c7             	mov    %rax,%rdi
+  805006:	48 b8 83 4d 80 00 00 	movabs $0x804d83,%rax
+  80500d:	00 00 00 
+  805010:	ff d0                	call   *%rax
+  805012:	85 c0                	test   %eax,%eax
+  805014:	74 0a                	je     805020 <devpipe_read+0x82>
+      return 0;
+  805016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80501b:	e9 1d 01 00 00       	jmp    80513d <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  805020:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805023:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805027:	89 d6                	mov    %edx,%esi
+  805029:	48 89 c7             	mov    %rax,%rdi
+  80502c:	48 b8 5e 4f 80 00 00 	movabs $0x804f5e,%rax
+  805033:	00 00 00 
+  805036:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  805038:	eb a0                	jmp    804fda <devpipe_read+0x3c>
+      break;
+  80503a:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  80503b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80503f:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  805043:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805047:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80504b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80504f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805053:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805057:	48 8b 00             	mov    (%rax),%rax
+  80505a:	48 29 c2             	sub    %rax,%rdx
+  80505d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805061:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805065:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805069:	48 39 c2             	cmp    %rax,%rdx
+  80506c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805070:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  805074:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805078:	48 8b 00             	mov    (%rax),%rax
+  80507b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80507f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805083:	ba 00 00 00 00       	mov    $0x0,%edx
+  805088:	48 f7 f1             	div    %rcx
+  80508b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  80508f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  805093:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805097:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80509b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80509f:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8050a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8050a7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8050ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8050af:	48 39 c2             	cmp    %rax,%rdx
+  8050b2:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8050b6:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8050ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050be:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8050c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8050c6:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8050ca:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8050ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050d2:	48 89 ce             	mov    %rcx,%rsi
+  8050d5:	48 89 c7             	mov    %rax,%rdi
+  8050d8:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  8050df:	00 00 00 
+  8050e2:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8050e4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8050e8:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8050ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050f0:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  8050f4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8050f8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8050fc:	48 01 d1             	add    %rdx,%rcx
+  8050ff:	48 89 c2             	mov    %rax,%rdx
+  805102:	48 89 cf             	mov    %rcx,%rdi
+  805105:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  80510c:	00 00 00 
+  80510f:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  805111:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805115:	48 8b 10             	mov    (%rax),%rdx
+  805118:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80511c:	48 01 c2             	add    %rax,%rdx
+  80511f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805123:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  805126:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80512a:	48 89 c7             	mov    %rax,%rdi
+  80512d:	48 b8 0c 4f 80 00 00 	movabs $0x804f0c,%rax
+  805134:	00 00 00 
+  805137:	ff d0                	call   *%rax
+  return n;
+  805139:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80513d:	c9                   	leave
+  80513e:	c3                   	ret
+
+000000000080513f <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80513f:	55                   	push   %rbp
+  805140:	48 89 e5             	mov    %rsp,%rbp
+  805143:	48 83 ec 70          	sub    $0x70,%rsp
+  805147:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80514b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80514f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  805153:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805157:	48 89 c7             	mov    %rax,%rdi
+  80515a:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  805161:	00 00 00 
+  805164:	ff d0                	call   *%rax
+  805166:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  80516a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80516e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  805172:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805179:	00 
+  80517a:	e9 b8 01 00 00       	jmp    805337 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  80517f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805183:	8b 40 18             	mov    0x18(%rax),%eax
+  805186:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  805189:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80518d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  805191:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805195:	48 8b 00             	mov    (%rax),%rax
+  805198:	48 29 c2             	sub    %rax,%rdx
+  80519b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80519f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051a3:	48 39 c2             	cmp    %rax,%rdx
+  8051a6:	75 4d                	jne    8051f5 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8051a8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8051ac:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8051b0:	48 89 d6             	mov    %rdx,%rsi
+  8051b3:	48 89 c7             	mov    %rax,%rdi
+  8051b6:	48 b8 83 4d 80 00 00 	movabs $0x804d83,%rax
+  8051bd:	00 00 00 
+  8051c0:	ff d0                	call   *%rax
+  8051c2:	85 c0                	test   %eax,%eax
+  8051c4:	74 0a                	je     8051d0 <devpipe_write+0x91>
+        return 0;
+  8051c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051cb:	e9 79 01 00 00       	jmp    805349 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8051d0:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8051d3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051d7:	89 d6                	mov    %edx,%esi
+  8051d9:	48 89 c7             	mov    %rax,%rdi
+  8051dc:	48 b8 5e 4f 80 00 00 	movabs $0x804f5e,%rax
+  8051e3:	00 00 00 
+  8051e6:	ff d0                	call   *%rax
+      m = 0;
+  8051e8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8051ef:	00 
+      continue;
+  8051f0:	e9 3a 01 00 00       	jmp    80532f <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  8051f5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8051f9:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  8051fd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  805201:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805205:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805209:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80520d:	48 8b 08             	mov    (%rax),%rcx
+  805210:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805214:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805218:	48 29 c1             	sub    %rax,%rcx
+  80521b:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80521f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  805223:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805227:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80522b:	48 39 c2             	cmp    %rax,%rdx
+  80522e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805232:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  805236:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80523a:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80523e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805242:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805246:	ba 00 00 00 00       	mov    $0x0,%edx
+  80524b:	48 f7 f1             	div    %rcx
+  80524e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805252:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805256:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80525a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80525e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805262:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805266:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80526a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80526e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805272:	48 39 c2             	cmp    %rax,%rdx
+  805275:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805279:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80527d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805281:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805285:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805289:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80528d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805291:	48 01 d1             	add    %rdx,%rcx
+  805294:	48 89 c2             	mov    %rax,%rdx
+  805297:	48 89 cf             	mov    %rcx,%rdi
+  80529a:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  8052a1:	00 00 00 
+  8052a4:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8052a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052aa:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8052ae:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8052b2:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8052b6:	73 4d                	jae    805305 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8052b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052bc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8052c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8052c4:	48 29 c2             	sub    %rax,%rdx
+  8052c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052cb:	48 01 c2             	add    %rax,%rdx
+  8052ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052d2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8052d6:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8052da:	48 89 c1             	mov    %rax,%rcx
+  8052dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052e1:	48 01 c1             	add    %rax,%rcx
+  8052e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052e8:	48 01 c1             	add    %rax,%rcx
+  8052eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052ef:	48 83 c0 20          	add    $0x20,%rax
+  8052f3:	48 89 ce             	mov    %rcx,%rsi
+  8052f6:	48 89 c7             	mov    %rax,%rdi
+  8052f9:	48 b8 c4 27 80 00 00 	movabs $0x8027c4,%rax
+  805300:	00 00 00 
+  805303:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  805305:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805309:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80530d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805311:	48 01 c2             	add    %rax,%rdx
+  805314:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805318:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80531c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805320:	48 89 c7             	mov    %rax,%rdi
+  805323:	48 b8 0c 4f 80 00 00 	movabs $0x804f0c,%rax
+  80532a:	00 00 00 
+  80532d:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80532f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805333:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  805337:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80533b:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80533f:	0f 82 3a fe ff ff    	jb     80517f <devpipe_write+0x40>
+  }
+
+  return i;
+  805345:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805349:	c9                   	leave
+  80534a:	c3                   	ret
+
+000000000080534b <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80534b:	55                   	push   %rbp
+  80534c:	48 89 e5             	mov    %rsp,%rbp
+  80534f:	48 83 ec 40          	sub    $0x40,%rsp
+  805353:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805357:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80535a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80535e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805362:	48 89 c7             	mov    %rax,%rdi
+  805365:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  80536c:	00 00 00 
+  80536f:	ff d0                	call   *%rax
+  805371:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805375:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80537c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805380:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805384:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805388:	48 89 d6             	mov    %rdx,%rsi
+  80538b:	48 89 c7             	mov    %rax,%rdi
+  80538e:	48 b8 26 40 80 00 00 	movabs $0x804026,%rax
+  805395:	00 00 00 
+  805398:	ff d0                	call   *%rax
+  80539a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80539d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8053a1:	79 08                	jns    8053ab <devpipe_poll+0x60>
+    return r;
+  8053a3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8053a6:	e9 85 00 00 00       	jmp    805430 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8053ab:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8053ae:	83 e0 01             	and    $0x1,%eax
+  8053b1:	85 c0                	test   %eax,%eax
+  8053b3:	74 18                	je     8053cd <devpipe_poll+0x82>
+  8053b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053b9:	48 8b 10             	mov    (%rax),%rdx
+  8053bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053c0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8053c4:	48 39 c2             	cmp    %rax,%rdx
+  8053c7:	74 04                	je     8053cd <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8053c9:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8053cd:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8053d0:	83 e0 02             	and    $0x2,%eax
+  8053d3:	85 c0                	test   %eax,%eax
+  8053d5:	74 23                	je     8053fa <devpipe_poll+0xaf>
+  8053d7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053db:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8053df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053e3:	48 8b 00             	mov    (%rax),%rax
+  8053e6:	48 29 c2             	sub    %rax,%rdx
+  8053e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053ed:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8053f1:	48 39 c2             	cmp    %rax,%rdx
+  8053f4:	73 04                	jae    8053fa <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8053f6:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8053fa:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8053fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805402:	48 89 d6             	mov    %rdx,%rsi
+  805405:	48 89 c7             	mov    %rax,%rdi
+  805408:	48 b8 83 4d 80 00 00 	movabs $0x804d83,%rax
+  80540f:	00 00 00 
+  805412:	ff d0                	call   *%rax
+  805414:	85 c0                	test   %eax,%eax
+  805416:	74 04                	je     80541c <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  805418:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  80541c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805420:	75 0b                	jne    80542d <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  805422:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805426:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  80542d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805430:	c9                   	leave
+  805431:	c3                   	ret
+
+0000000000805432 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  805432:	55                   	push   %rbp
+  805433:	48 89 e5             	mov    %rsp,%rbp
+  805436:	48 83 ec 20          	sub    $0x20,%rsp
+  80543a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80543e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805442:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805446:	48 89 c7             	mov    %rax,%rdi
+  805449:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  805450:	00 00 00 
+  805453:	ff d0                	call   *%rax
+  805455:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805459:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80545d:	48 ba 51 66 80 00 00 	movabs $0x806651,%rdx
+  805464:	00 00 00 
+  805467:	48 89 d6             	mov    %rdx,%rsi
+  80546a:	48 89 c7             	mov    %rax,%rdi
+  80546d:	48 b8 7b 20 80 00 00 	movabs $0x80207b,%rax
+  805474:	00 00 00 
+  805477:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805479:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80547d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805481:	89 c1                	mov    %eax,%ecx
+  805483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805487:	48 8b 00             	mov    (%rax),%rax
+  80548a:	89 c2                	mov    %eax,%edx
+  80548c:	89 c8                	mov    %ecx,%eax
+  80548e:	29 d0                	sub    %edx,%eax
+  805490:	89 c2                	mov    %eax,%edx
+  805492:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805496:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80549c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054a0:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8054a7:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8054aa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8054ae:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  8054b5:	00 00 00 
+  8054b8:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8054bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8054c4:	c9                   	leave
+  8054c5:	c3                   	ret
+
+00000000008054c6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8054c6:	55                   	push   %rbp
+  8054c7:	48 89 e5             	mov    %rsp,%rbp
+  8054ca:	48 83 ec 40          	sub    $0x40,%rsp
+  8054ce:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8054d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8054d6:	48 89 c7             	mov    %rax,%rdi
+  8054d9:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  8054e0:	00 00 00 
+  8054e3:	ff d0                	call   *%rax
+  8054e5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8054e9:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8054f0:	00 
+  8054f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8054f5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8054f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054fd:	48 01 d0             	add    %rdx,%rax
+  805500:	48 83 c0 1f          	add    $0x1f,%rax
+  805504:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  805508:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80550c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805511:	48 f7 75 e8          	divq   -0x18(%rbp)
+  805515:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805519:	48 29 d0             	sub    %rdx,%rax
+  80551c:	48 c1 e8 0c          	shr    $0xc,%rax
+  805520:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  805524:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805528:	48 89 c6             	mov    %rax,%rsi
+  80552b:	bf 00 00 00 00       	mov    $0x0,%edi
+  805530:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  805537:	00 00 00 
+  80553a:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  80553c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805540:	48 89 c7             	mov    %rax,%rdi
+  805543:	48 b8 0c 4f 80 00 00 	movabs $0x804f0c,%rax
+  80554a:	00 00 00 
+  80554d:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80554f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805553:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805557:	eb 2f                	jmp    805588 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805559:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80555d:	48 83 e8 01          	sub    $0x1,%rax
+  805561:	48 c1 e0 0c          	shl    $0xc,%rax
+  805565:	48 89 c2             	mov    %rax,%rdx
+  805568:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80556c:	48 01 d0             	add    %rdx,%rax
+  80556f:	48 89 c6             	mov    %rax,%rsi
+  805572:	bf 00 00 00 00       	mov    $0x0,%edi
+  805577:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  80557e:	00 00 00 
+  805581:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805583:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805588:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80558d:	77 ca                	ja     805559 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  80558f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805593:	48 89 c6             	mov    %rax,%rsi
+  805596:	bf 00 00 00 00       	mov    $0x0,%edi
+  80559b:	48 b8 01 2f 80 00 00 	movabs $0x802f01,%rax
+  8055a2:	00 00 00 
+  8055a5:	ff d0                	call   *%rax
+}
+  8055a7:	c9                   	leave
+  8055a8:	c3                   	ret
+
+00000000008055a9 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8055a9:	55                   	push   %rbp
+  8055aa:	48 89 e5             	mov    %rsp,%rbp
+  8055ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8055b1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8055b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055b8:	75 10                	jne    8055ca <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8055ba:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8055c1:	00 00 00 
+  8055c4:	8b 00                	mov    (%rax),%eax
+  8055c6:	48 98                	cltq
+  8055c8:	eb 05                	jmp    8055cf <vsyscall+0x26>
+  }
+  return 0;
+  8055ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055cf:	c9                   	leave
+  8055d0:	c3                   	ret
+
+00000000008055d1 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8055d1:	55                   	push   %rbp
+  8055d2:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8055d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055da:	48 b8 a9 55 80 00 00 	movabs $0x8055a9,%rax
+  8055e1:	00 00 00 
+  8055e4:	ff d0                	call   *%rax
+}
+  8055e6:	5d                   	pop    %rbp
+  8055e7:	c3                   	ret
+
+00000000008055e8 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  8055e8:	55                   	push   %rbp
+  8055e9:	48 89 e5             	mov    %rsp,%rbp
+  8055ec:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  8055f0:	0f 31                	rdtsc
+  8055f2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8055f5:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  8055f8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055fb:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8055fe:	48 c1 e2 20          	shl    $0x20,%rdx
+  805602:	48 09 d0             	or     %rdx,%rax
+  805605:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805609:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80560d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805611:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805618:	00 00 00 
+  80561b:	8b 40 08             	mov    0x8(%rax),%eax
+  80561e:	48 98                	cltq
+  805620:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805624:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805628:	ba 00 00 00 00       	mov    $0x0,%edx
+  80562d:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805631:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805638:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80563c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805641:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805645:	48 89 d0             	mov    %rdx,%rax
+  805648:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  80564f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805654:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805658:	48 01 c8             	add    %rcx,%rax
+}
+  80565b:	c9                   	leave
+  80565c:	c3                   	ret
+
+000000000080565d <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  80565d:	55                   	push   %rbp
+  80565e:	48 89 e5             	mov    %rsp,%rbp
+  805661:	48 83 ec 20          	sub    $0x20,%rsp
+  805665:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805668:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80566b:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  80566e:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805672:	be 01 00 00 00       	mov    $0x1,%esi
+  805677:	48 89 c7             	mov    %rax,%rdi
+  80567a:	48 b8 32 2c 80 00 00 	movabs $0x802c32,%rax
+  805681:	00 00 00 
+  805684:	ff d0                	call   *%rax
+}
+  805686:	90                   	nop
+  805687:	c9                   	leave
+  805688:	c3                   	ret
+
+0000000000805689 <getchar>:
+
+int
+getchar(void) {
+  805689:	55                   	push   %rbp
+  80568a:	48 89 e5             	mov    %rsp,%rbp
+  80568d:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805691:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805695:	ba 01 00 00 00       	mov    $0x1,%edx
+  80569a:	48 89 c6             	mov    %rax,%rsi
+  80569d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056a2:	48 b8 bc 3b 80 00 00 	movabs $0x803bbc,%rax
+  8056a9:	00 00 00 
+  8056ac:	ff d0                	call   *%rax
+  8056ae:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8056b1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056b5:	79 05                	jns    8056bc <getchar+0x33>
+    return r;
+  8056b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056ba:	eb 14                	jmp    8056d0 <getchar+0x47>
+  if (r < 1)
+  8056bc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056c0:	7f 07                	jg     8056c9 <getchar+0x40>
+    return -E_EOF;
+  8056c2:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8056c7:	eb 07                	jmp    8056d0 <getchar+0x47>
+  return c;
+  8056c9:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8056cd:	0f b6 c0             	movzbl %al,%eax
+}
+  8056d0:	c9                   	leave
+  8056d1:	c3                   	ret
+
+00000000008056d2 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8056d2:	55                   	push   %rbp
+  8056d3:	48 89 e5             	mov    %rsp,%rbp
+  8056d6:	48 83 ec 20          	sub    $0x20,%rsp
+  8056da:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8056dd:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8056e1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8056e4:	48 89 d6             	mov    %rdx,%rsi
+  8056e7:	89 c7                	mov    %eax,%edi
+  8056e9:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  8056f0:	00 00 00 
+  8056f3:	ff d0                	call   *%rax
+  8056f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8056f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056fc:	79 05                	jns    805703 <iscons+0x31>
+    return r;
+  8056fe:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805701:	eb 1a                	jmp    80571d <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805703:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805707:	8b 10                	mov    (%rax),%edx
+  805709:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805710:	00 00 00 
+  805713:	8b 00                	mov    (%rax),%eax
+  805715:	39 c2                	cmp    %eax,%edx
+  805717:	0f 94 c0             	sete   %al
+  80571a:	0f b6 c0             	movzbl %al,%eax
+}
+  80571d:	c9                   	leave
+  80571e:	c3                   	ret
+
+000000000080571f <opencons>:
+
+int
+opencons(void) {
+  80571f:	55                   	push   %rbp
+  805720:	48 89 e5             	mov    %rsp,%rbp
+  805723:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805727:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80572b:	48 89 c7             	mov    %rax,%rdi
+  80572e:	48 b8 7e 35 80 00 00 	movabs $0x80357e,%rax
+  805735:	00 00 00 
+  805738:	ff d0                	call   *%rax
+  80573a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80573d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805741:	79 05                	jns    805748 <opencons+0x29>
+    return r;
+  805743:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805746:	eb 66                	jmp    8057ae <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805748:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80574c:	ba 07 04 00 00       	mov    $0x407,%edx
+  805751:	48 89 c6             	mov    %rax,%rsi
+  805754:	bf 00 00 00 00       	mov    $0x0,%edi
+  805759:	48 b8 49 2e 80 00 00 	movabs $0x802e49,%rax
+  805760:	00 00 00 
+  805763:	ff d0                	call   *%rax
+  805765:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805768:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80576c:	79 05                	jns    805773 <opencons+0x54>
+    return r;
+  80576e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805771:	eb 3b                	jmp    8057ae <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805773:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805777:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  80577e:	00 00 00 
+  805781:	8b 12                	mov    (%rdx),%edx
+  805783:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805785:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805789:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805790:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805794:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  80579b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80579f:	48 89 c7             	mov    %rax,%rdi
+  8057a2:	48 b8 30 35 80 00 00 	movabs $0x803530,%rax
+  8057a9:	00 00 00 
+  8057ac:	ff d0                	call   *%rax
+}
+  8057ae:	c9                   	leave
+  8057af:	c3                   	ret
+
+00000000008057b0 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8057b0:	55                   	push   %rbp
+  8057b1:	48 89 e5             	mov    %rsp,%rbp
+  8057b4:	48 83 ec 20          	sub    $0x20,%rsp
+  8057b8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8057bb:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8057be:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8057c2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8057c5:	48 89 d6             	mov    %rdx,%rsi
+  8057c8:	89 c7                	mov    %eax,%edi
+  8057ca:	48 b8 60 36 80 00 00 	movabs $0x803660,%rax
+  8057d1:	00 00 00 
+  8057d4:	ff d0                	call   *%rax
+  8057d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8057d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057dd:	79 05                	jns    8057e4 <consmode+0x34>
+    return r;
+  8057df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057e2:	eb 34                	jmp    805818 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  8057e4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057e8:	8b 10                	mov    (%rax),%edx
+  8057ea:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8057f1:	00 00 00 
+  8057f4:	8b 00                	mov    (%rax),%eax
+  8057f6:	39 c2                	cmp    %eax,%edx
+  8057f8:	74 07                	je     805801 <consmode+0x51>
+    return -E_INVAL;
+  8057fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8057ff:	eb 17                	jmp    805818 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805801:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805805:	8b 40 0c             	mov    0xc(%rax),%eax
+  805808:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  80580b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80580f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805812:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805815:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805818:	c9                   	leave
+  805819:	c3                   	ret
+
+000000000080581a <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80581a:	55                   	push   %rbp
+  80581b:	48 89 e5             	mov    %rsp,%rbp
+  80581e:	48 83 ec 20          	sub    $0x20,%rsp
+  805822:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805826:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80582a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  80582e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805832:	8b 50 0c             	mov    0xc(%rax),%edx
+  805835:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805839:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80583d:	48 89 ce             	mov    %rcx,%rsi
+  805840:	48 89 c7             	mov    %rax,%rdi
+  805843:	48 b8 a3 31 80 00 00 	movabs $0x8031a3,%rax
+  80584a:	00 00 00 
+  80584d:	ff d0                	call   *%rax
+  80584f:	48 98                	cltq
+}
+  805851:	c9                   	leave
+  805852:	c3                   	ret
+
+0000000000805853 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805853:	55                   	push   %rbp
+  805854:	48 89 e5             	mov    %rsp,%rbp
+  805857:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80585e:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805865:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  80586c:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805873:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80587a:	eb 74                	jmp    8058f0 <devcons_write+0x9d>
+    m = n - tot;
+  80587c:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805883:	89 c2                	mov    %eax,%edx
+  805885:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805888:	29 c2                	sub    %eax,%edx
+  80588a:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  80588d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805890:	83 f8 7f             	cmp    $0x7f,%eax
+  805893:	76 07                	jbe    80589c <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805895:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  80589c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80589f:	48 63 d0             	movslq %eax,%rdx
+  8058a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058a5:	48 63 c8             	movslq %eax,%rcx
+  8058a8:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8058af:	48 01 c1             	add    %rax,%rcx
+  8058b2:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8058b9:	48 89 ce             	mov    %rcx,%rsi
+  8058bc:	48 89 c7             	mov    %rax,%rdi
+  8058bf:	48 b8 be 25 80 00 00 	movabs $0x8025be,%rax
+  8058c6:	00 00 00 
+  8058c9:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  8058cb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8058ce:	48 63 d0             	movslq %eax,%rdx
+  8058d1:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8058d8:	48 89 d6             	mov    %rdx,%rsi
+  8058db:	48 89 c7             	mov    %rax,%rdi
+  8058de:	48 b8 32 2c 80 00 00 	movabs $0x802c32,%rax
+  8058e5:	00 00 00 
+  8058e8:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  8058ea:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8058ed:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8058f0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058f3:	48 98                	cltq
+  8058f5:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  8058fc:	0f 82 7a ff ff ff    	jb     80587c <devcons_write+0x29>
+  }
+  return tot;
+  805902:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805905:	48 98                	cltq
+}
+  805907:	c9                   	leave
+  805908:	c3                   	ret
+
+0000000000805909 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805909:	55                   	push   %rbp
+  80590a:	48 89 e5             	mov    %rsp,%rbp
+  80590d:	48 83 ec 08          	sub    $0x8,%rsp
+  805911:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805915:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80591a:	c9                   	leave
+  80591b:	c3                   	ret
+
+000000000080591c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80591c:	55                   	push   %rbp
+  80591d:	48 89 e5             	mov    %rsp,%rbp
+  805920:	48 83 ec 10          	sub    $0x10,%rsp
+  805924:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805928:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  80592c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805930:	48 ba 5d 66 80 00 00 	movabs $0x80665d,%rdx
+  805937:	00 00 00 
+  80593a:	48 89 d6             	mov    %rdx,%rsi
+  80593d:	48 89 c7             	mov    %rax,%rdi
+  805940:	48 b8 7b 20 80 00 00 	movabs $0x80207b,%rax
+  805947:	00 00 00 
+  80594a:	ff d0                	call   *%rax
+  return 0;
+  80594c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805951:	c9                   	leave
+  805952:	c3                   	ret
+
+0000000000805953 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805953:	55                   	push   %rbp
+  805954:	48 89 e5             	mov    %rsp,%rbp
+  805957:	48 83 ec 30          	sub    $0x30,%rsp
+  80595b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80595f:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805962:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805966:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  80596d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805970:	83 e0 02             	and    $0x2,%eax
+  805973:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805976:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80597a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80597d:	83 f8 01             	cmp    $0x1,%eax
+  805980:	75 04                	jne    805986 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805982:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805986:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805989:	83 e0 01             	and    $0x1,%eax
+  80598c:	85 c0                	test   %eax,%eax
+  80598e:	74 44                	je     8059d4 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805990:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805993:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805998:	89 c2                	mov    %eax,%edx
+  80599a:	be 00 00 00 00       	mov    $0x0,%esi
+  80599f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059a4:	48 b8 91 32 80 00 00 	movabs $0x803291,%rax
+  8059ab:	00 00 00 
+  8059ae:	ff d0                	call   *%rax
+  8059b0:	83 f8 01             	cmp    $0x1,%eax
+  8059b3:	75 06                	jne    8059bb <devcons_poll+0x68>
+      revents |= POLLIN;
+  8059b5:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  8059b9:	eb 19                	jmp    8059d4 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  8059bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059bf:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  8059c5:	0b 45 fc             	or     -0x4(%rbp),%eax
+  8059c8:	89 c2                	mov    %eax,%edx
+  8059ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8059ce:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  8059d4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8059d7:	c9                   	leave
+  8059d8:	c3                   	ret
+
+00000000008059d9 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8059d9:	55                   	push   %rbp
+  8059da:	48 89 e5             	mov    %rsp,%rbp
+  8059dd:	48 83 ec 20          	sub    $0x20,%rsp
+  8059e1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8059e5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8059e9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  8059ed:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8059f1:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8059f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059f9:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805a00:	48 89 c7             	mov    %rax,%rdi
+  805a03:	48 b8 11 5a 80 00 00 	movabs $0x805a11,%rax
+  805a0a:	00 00 00 
+  805a0d:	ff d0                	call   *%rax
+}
+  805a0f:	c9                   	leave
+  805a10:	c3                   	ret
+
+0000000000805a11 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805a11:	55                   	push   %rbp
+  805a12:	48 89 e5             	mov    %rsp,%rbp
+  805a15:	48 83 ec 30          	sub    $0x30,%rsp
+  805a19:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805a1d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805a21:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805a25:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805a29:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805a2e:	75 0e                	jne    805a3e <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805a30:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805a37:	00 00 00 
+  805a3a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805a3e:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805a43:	75 18                	jne    805a5d <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805a45:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a49:	48 89 c7             	mov    %rax,%rdi
+  805a4c:	48 b8 89 30 80 00 00 	movabs $0x803089,%rax
+  805a53:	00 00 00 
+  805a56:	ff d0                	call   *%rax
+  805a58:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805a5b:	eb 1d                	jmp    805a7a <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805a5d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805a61:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805a65:	48 89 d6             	mov    %rdx,%rsi
+  805a68:	48 89 c7             	mov    %rax,%rdi
+  805a6b:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  805a72:	00 00 00 
+  805a75:	ff d0                	call   *%rax
+  805a77:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805a7a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805a7e:	79 2a                	jns    805aaa <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805a80:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805a85:	74 0a                	je     805a91 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805a87:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a8b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805a91:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805a96:	74 0a                	je     805aa2 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805a98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805a9c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805aa2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805aa5:	e9 aa 00 00 00       	jmp    805b54 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805aaa:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805aaf:	74 36                	je     805ae7 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805ab1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805ab8:	00 00 00 
+  805abb:	8b 40 04             	mov    0x4(%rax),%eax
+  805abe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805ac3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805aca:	00 00 00 
+  805acd:	48 98                	cltq
+  805acf:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805ad6:	48 01 d0             	add    %rdx,%rax
+  805ad9:	48 05 24 01 00 00    	add    $0x124,%rax
+  805adf:	8b 10                	mov    (%rax),%edx
+  805ae1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ae5:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805ae7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805aec:	74 36                	je     805b24 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805aee:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805af5:	00 00 00 
+  805af8:	8b 40 04             	mov    0x4(%rax),%eax
+  805afb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805b00:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805b07:	00 00 00 
+  805b0a:	48 98                	cltq
+  805b0c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805b13:	48 01 d0             	add    %rdx,%rax
+  805b16:	48 05 28 01 00 00    	add    $0x128,%rax
+  805b1c:	8b 10                	mov    (%rax),%edx
+  805b1e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805b22:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805b24:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805b2b:	00 00 00 
+  805b2e:	8b 40 04             	mov    0x4(%rax),%eax
+  805b31:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805b36:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805b3d:	00 00 00 
+  805b40:	48 98                	cltq
+  805b42:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805b49:	48 01 d0             	add    %rdx,%rax
+  805b4c:	48 05 20 01 00 00    	add    $0x120,%rax
+  805b52:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805b54:	c9                   	leave
+  805b55:	c3                   	ret
+
+0000000000805b56 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805b56:	55                   	push   %rbp
+  805b57:	48 89 e5             	mov    %rsp,%rbp
+  805b5a:	48 83 ec 30          	sub    $0x30,%rsp
+  805b5e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b61:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805b64:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805b68:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805b6b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805b70:	75 5e                	jne    805bd0 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805b72:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b79:	00 00 00 
+  805b7c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805b80:	eb 4e                	jmp    805bd0 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805b82:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b86:	79 3c                	jns    805bc4 <ipc_send+0x6e>
+  805b88:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805b8c:	74 36                	je     805bc4 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805b8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b91:	89 c1                	mov    %eax,%ecx
+  805b93:	48 b8 68 66 80 00 00 	movabs $0x806668,%rax
+  805b9a:	00 00 00 
+  805b9d:	48 89 c2             	mov    %rax,%rdx
+  805ba0:	be 54 00 00 00       	mov    $0x54,%esi
+  805ba5:	48 b8 8e 66 80 00 00 	movabs $0x80668e,%rax
+  805bac:	00 00 00 
+  805baf:	48 89 c7             	mov    %rax,%rdi
+  805bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  805bb7:	49 b8 ac 0e 80 00 00 	movabs $0x800eac,%r8
+  805bbe:	00 00 00 
+  805bc1:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805bc4:	48 b8 0c 2e 80 00 00 	movabs $0x802e0c,%rax
+  805bcb:	00 00 00 
+  805bce:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805bd0:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805bd3:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805bd6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805bda:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bdd:	89 c7                	mov    %eax,%edi
+  805bdf:	48 b8 32 30 80 00 00 	movabs $0x803032,%rax
+  805be6:	00 00 00 
+  805be9:	ff d0                	call   *%rax
+  805beb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805bee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805bf2:	75 8e                	jne    805b82 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805bf4:	48 b8 0c 2e 80 00 00 	movabs $0x802e0c,%rax
+  805bfb:	00 00 00 
+  805bfe:	ff d0                	call   *%rax
+}
+  805c00:	90                   	nop
+  805c01:	c9                   	leave
+  805c02:	c3                   	ret
+
+0000000000805c03 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805c03:	55                   	push   %rbp
+  805c04:	48 89 e5             	mov    %rsp,%rbp
+  805c07:	48 83 ec 18          	sub    $0x18,%rsp
+  805c0b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805c0e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805c15:	eb 4d                	jmp    805c64 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805c17:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c1e:	00 00 00 
+  805c21:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c24:	48 98                	cltq
+  805c26:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c2d:	48 01 d0             	add    %rdx,%rax
+  805c30:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805c36:	8b 00                	mov    (%rax),%eax
+  805c38:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805c3b:	75 23                	jne    805c60 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805c3d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c44:	00 00 00 
+  805c47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c4a:	48 98                	cltq
+  805c4c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c53:	48 01 d0             	add    %rdx,%rax
+  805c56:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805c5c:	8b 00                	mov    (%rax),%eax
+  805c5e:	eb 12                	jmp    805c72 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805c60:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805c64:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805c6b:	7e aa                	jle    805c17 <ipc_find_env+0x14>
+  return 0;
+  805c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c72:	c9                   	leave
+  805c73:	c3                   	ret
+
+0000000000805c74 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805c74:	55                   	push   %rbp
+  805c75:	48 89 e5             	mov    %rsp,%rbp
+  805c78:	48 83 ec 18          	sub    $0x18,%rsp
+  805c7c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805c80:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c84:	48 c1 e8 27          	shr    $0x27,%rax
+  805c88:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805c8d:	48 89 c2             	mov    %rax,%rdx
+  805c90:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805c97:	01 00 00 
+  805c9a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805c9e:	83 e0 01             	and    $0x1,%eax
+  805ca1:	48 85 c0             	test   %rax,%rax
+  805ca4:	74 63                	je     805d09 <pageref+0x95>
+  805ca6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805caa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805cae:	48 89 c2             	mov    %rax,%rdx
+  805cb1:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805cb8:	01 00 00 
+  805cbb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805cbf:	83 e0 01             	and    $0x1,%eax
+  805cc2:	48 85 c0             	test   %rax,%rax
+  805cc5:	74 42                	je     805d09 <pageref+0x95>
+  805cc7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ccb:	48 c1 e8 15          	shr    $0x15,%rax
+  805ccf:	48 89 c2             	mov    %rax,%rdx
+  805cd2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805cd9:	01 00 00 
+  805cdc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805ce0:	83 e0 01             	and    $0x1,%eax
+  805ce3:	48 85 c0             	test   %rax,%rax
+  805ce6:	74 21                	je     805d09 <pageref+0x95>
+  805ce8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805cec:	48 c1 e8 0c          	shr    $0xc,%rax
+  805cf0:	48 89 c2             	mov    %rax,%rdx
+  805cf3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805cfa:	01 00 00 
+  805cfd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d01:	83 e0 01             	and    $0x1,%eax
+  805d04:	48 85 c0             	test   %rax,%rax
+  805d07:	75 07                	jne    805d10 <pageref+0x9c>
+    return 0;
+  805d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d0e:	eb 53                	jmp    805d63 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805d10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805d14:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d18:	48 89 c2             	mov    %rax,%rdx
+  805d1b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805d22:	01 00 00 
+  805d25:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805d29:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805d2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d31:	83 e0 01             	and    $0x1,%eax
+  805d34:	48 85 c0             	test   %rax,%rax
+  805d37:	75 07                	jne    805d40 <pageref+0xcc>
+    return 0;
+  805d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  805d3e:	eb 23                	jmp    805d63 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805d40:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d44:	48 c1 e8 0c          	shr    $0xc,%rax
+  805d48:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805d4f:	00 00 00 
+  805d52:	48 c1 e0 04          	shl    $0x4,%rax
+  805d56:	48 01 d0             	add    %rdx,%rax
+  805d59:	48 83 c0 08          	add    $0x8,%rax
+  805d5d:	0f b7 00             	movzwl (%rax),%eax
+  805d60:	0f b7 c0             	movzwl %ax,%eax
+}
+  805d63:	c9                   	leave
+  805d64:	c3                   	ret
+  805d65:	0f 1f 00             	nopl   (%rax)
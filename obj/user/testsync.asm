@@ -0,0 +1,10292 @@
+
+obj/user/testsync:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 b9 03 00 00       	call   8003e5 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+  int counter;
+  int ready;
+};
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 30          	sub    $0x30,%rsp
+  80003a:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80003d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  struct Shared *sh = (struct Shared *)UTEMP;
+  800041:	48 c7 45 f0 00 00 40 	movq   $0x400000,-0x10(%rbp)
+  800048:	00 
+  int i, r, tmp;
+  envid_t pid;
+
+  if ((r = sys_page_alloc(0, sh, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  800049:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80004d:	ba 07 04 00 00       	mov    $0x407,%edx
+  800052:	48 89 c6             	mov    %rax,%rsi
+  800055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005a:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  800061:	00 00 00 
+  800064:	ff d0                	call   *%rax
+  800066:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  800069:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80006d:	79 36                	jns    8000a5 <umain+0x73>
+    panic("sys_page_alloc: %i", r);
+  80006f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800072:	89 c1                	mov    %eax,%ecx
+  800074:	48 b8 c0 66 80 00 00 	movabs $0x8066c0,%rax
+  80007b:	00 00 00 
+  80007e:	48 89 c2             	mov    %rax,%rdx
+  800081:	be 14 00 00 00       	mov    $0x14,%esi
+  800086:	48 b8 d3 66 80 00 00 	movabs $0x8066d3,%rax
+  80008d:	00 00 00 
+  800090:	48 89 c7             	mov    %rax,%rdi
+  800093:	b8 00 00 00 00       	mov    $0x0,%eax
+  800098:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  80009f:	00 00 00 
+  8000a2:	41 ff d0             	call   *%r8
+  mutex_init(&sh->mutex);
+  8000a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8000a9:	48 89 c7             	mov    %rax,%rdi
+  8000ac:	48 b8 e0 53 80 00 00 	movabs $0x8053e0,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+  cond_init(&sh->cond);
+  8000b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8000bc:	48 83 c0 04          	add    $0x4,%rax
+  8000c0:	48 89 c7             	mov    %rax,%rdi
+  8000c3:	48 b8 12 55 80 00 00 	movabs $0x805512,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+  sem_init(&sh->done, 0);
+  8000cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8000d3:	48 83 c0 08          	add    $0x8,%rax
+  8000d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8000dc:	48 89 c7             	mov    %rax,%rdi
+  8000df:	48 b8 7d 56 80 00 00 	movabs $0x80567d,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+
+  if ((pid = fork()) < 0)
+  8000eb:	48 b8 c2 32 80 00 00 	movabs $0x8032c2,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+  8000f7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+  8000fa:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  8000fe:	79 36                	jns    800136 <umain+0x104>
+    panic("fork: %i", pid);
+  800100:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800103:	89 c1                	mov    %eax,%ecx
+  800105:	48 b8 e3 66 80 00 00 	movabs $0x8066e3,%rax
+  80010c:	00 00 00 
+  80010f:	48 89 c2             	mov    %rax,%rdx
+  800112:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800117:	48 b8 d3 66 80 00 00 	movabs $0x8066d3,%rax
+  80011e:	00 00 00 
+  800121:	48 89 c7             	mov    %rax,%rdi
+  800124:	b8 00 00 00 00       	mov    $0x0,%eax
+  800129:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  800130:	00 00 00 
+  800133:	41 ff d0             	call   *%r8
+
+  // Both envs do a non-atomic increment with a yield in the middle;
+  // only the mutex keeps updates from getting lost.
+  for (i = 0; i < N; i++) {
+  800136:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80013d:	eb 4d                	jmp    80018c <umain+0x15a>
+    mutex_lock(&sh->mutex);
+  80013f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800143:	48 89 c7             	mov    %rax,%rdi
+  800146:	48 b8 f9 53 80 00 00 	movabs $0x8053f9,%rax
+  80014d:	00 00 00 
+  800150:	ff d0                	call   *%rax
+    tmp = sh->counter;
+  800152:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800156:	8b 40 10             	mov    0x10(%rax),%eax
+  800159:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    sys_yield();
+  80015c:	48 b8 ec 23 80 00 00 	movabs $0x8023ec,%rax
+  800163:	00 00 00 
+  800166:	ff d0                	call   *%rax
+    sh->counter = tmp + 1;
+  800168:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80016b:	8d 50 01             	lea    0x1(%rax),%edx
+  80016e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800172:	89 50 10             	mov    %edx,0x10(%rax)
+    mutex_unlock(&sh->mutex);
+  800175:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800179:	48 89 c7             	mov    %rax,%rdi
+  80017c:	48 b8 ce 54 80 00 00 	movabs $0x8054ce,%rax
+  800183:	00 00 00 
+  800186:	ff d0                	call   *%rax
+  for (i = 0; i < N; i++) {
+  800188:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80018c:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+  800190:	7e ad                	jle    80013f <umain+0x10d>
+  }
+
+  if (pid == 0) {
+  800192:	83 7d e8 00          	cmpl   $0x0,-0x18(%rbp)
+  800196:	75 6b                	jne    800203 <umain+0x1d1>
+    mutex_lock(&sh->mutex);
+  800198:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80019c:	48 89 c7             	mov    %rax,%rdi
+  80019f:	48 b8 f9 53 80 00 00 	movabs $0x8053f9,%rax
+  8001a6:	00 00 00 
+  8001a9:	ff d0                	call   *%rax
+    sh->ready = 1;
+  8001ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001af:	c7 40 14 01 00 00 00 	movl   $0x1,0x14(%rax)
+    cond_signal(&sh->cond);
+  8001b6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001ba:	48 83 c0 04          	add    $0x4,%rax
+  8001be:	48 89 c7             	mov    %rax,%rdi
+  8001c1:	48 b8 ff 55 80 00 00 	movabs $0x8055ff,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+    mutex_unlock(&sh->mutex);
+  8001cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001d1:	48 89 c7             	mov    %rax,%rdi
+  8001d4:	48 b8 ce 54 80 00 00 	movabs $0x8054ce,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+    sem_post(&sh->done);
+  8001e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8001e4:	48 83 c0 08          	add    $0x8,%rax
+  8001e8:	48 89 c7             	mov    %rax,%rdi
+  8001eb:	48 b8 5a 58 80 00 00 	movabs $0x80585a,%rax
+  8001f2:	00 00 00 
+  8001f5:	ff d0                	call   *%rax
+    exit();
+  8001f7:	48 b8 68 04 80 00 00 	movabs $0x800468,%rax
+  8001fe:	00 00 00 
+  800201:	ff d0                	call   *%rax
+  }
+
+  mutex_lock(&sh->mutex);
+  800203:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800207:	48 89 c7             	mov    %rax,%rdi
+  80020a:	48 b8 f9 53 80 00 00 	movabs $0x8053f9,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+  while (!sh->ready)
+  800216:	eb 1e                	jmp    800236 <umain+0x204>
+    cond_wait(&sh->cond, &sh->mutex);
+  800218:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80021c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800220:	48 83 c2 04          	add    $0x4,%rdx
+  800224:	48 89 c6             	mov    %rax,%rsi
+  800227:	48 89 d7             	mov    %rdx,%rdi
+  80022a:	48 b8 cb 55 80 00 00 	movabs $0x8055cb,%rax
+  800231:	00 00 00 
+  800234:	ff d0                	call   *%rax
+  while (!sh->ready)
+  800236:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80023a:	8b 40 14             	mov    0x14(%rax),%eax
+  80023d:	85 c0                	test   %eax,%eax
+  80023f:	74 d7                	je     800218 <umain+0x1e6>
+  mutex_unlock(&sh->mutex);
+  800241:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800245:	48 89 c7             	mov    %rax,%rdi
+  800248:	48 b8 ce 54 80 00 00 	movabs $0x8054ce,%rax
+  80024f:	00 00 00 
+  800252:	ff d0                	call   *%rax
+  sem_wait(&sh->done);
+  800254:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800258:	48 83 c0 08          	add    $0x8,%rax
+  80025c:	48 89 c7             	mov    %rax,%rdi
+  80025f:	48 b8 31 58 80 00 00 	movabs $0x805831,%rax
+  800266:	00 00 00 
+  800269:	ff d0                	call   *%rax
+  if (sem_timedwait(&sh->done, 1000000) != -E_TIMEOUT)
+  80026b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80026f:	48 83 c0 08          	add    $0x8,%rax
+  800273:	be 40 42 0f 00       	mov    $0xf4240,%esi
+  800278:	48 89 c7             	mov    %rax,%rdi
+  80027b:	48 b8 f1 56 80 00 00 	movabs $0x8056f1,%rax
+  800282:	00 00 00 
+  800285:	ff d0                	call   *%rax
+  800287:	83 f8 ed             	cmp    $0xffffffed,%eax
+  80028a:	74 30                	je     8002bc <umain+0x28a>
+    panic("semaphore posted twice");
+  80028c:	48 b8 ec 66 80 00 00 	movabs $0x8066ec,%rax
+  800293:	00 00 00 
+  800296:	48 89 c2             	mov    %rax,%rdx
+  800299:	be 35 00 00 00       	mov    $0x35,%esi
+  80029e:	48 b8 d3 66 80 00 00 	movabs $0x8066d3,%rax
+  8002a5:	00 00 00 
+  8002a8:	48 89 c7             	mov    %rax,%rdi
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	48 b9 8c 04 80 00 00 	movabs $0x80048c,%rcx
+  8002b7:	00 00 00 
+  8002ba:	ff d1                	call   *%rcx
+  if (sem_trywait(&sh->done) != -E_BUSY)
+  8002bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8002c0:	48 83 c0 08          	add    $0x8,%rax
+  8002c4:	48 89 c7             	mov    %rax,%rdi
+  8002c7:	48 b8 a3 56 80 00 00 	movabs $0x8056a3,%rax
+  8002ce:	00 00 00 
+  8002d1:	ff d0                	call   *%rax
+  8002d3:	83 f8 eb             	cmp    $0xffffffeb,%eax
+  8002d6:	74 30                	je     800308 <umain+0x2d6>
+    panic("sem_trywait on a zero semaphore");
+  8002d8:	48 b8 08 67 80 00 00 	movabs $0x806708,%rax
+  8002df:	00 00 00 
+  8002e2:	48 89 c2             	mov    %rax,%rdx
+  8002e5:	be 37 00 00 00       	mov    $0x37,%esi
+  8002ea:	48 b8 d3 66 80 00 00 	movabs $0x8066d3,%rax
+  8002f1:	00 00 00 
+  8002f4:	48 89 c7             	mov    %rax,%rdi
+  8002f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fc:	48 b9 8c 04 80 00 00 	movabs $0x80048c,%rcx
+  800303:	00 00 00 
+  800306:	ff d1                	call   *%rcx
+  mutex_lock(&sh->mutex);
+  800308:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80030c:	48 89 c7             	mov    %rax,%rdi
+  80030f:	48 b8 f9 53 80 00 00 	movabs $0x8053f9,%rax
+  800316:	00 00 00 
+  800319:	ff d0                	call   *%rax
+  if (mutex_trylock(&sh->mutex) != -E_BUSY)
+  80031b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80031f:	48 89 c7             	mov    %rax,%rdi
+  800322:	48 b8 93 54 80 00 00 	movabs $0x805493,%rax
+  800329:	00 00 00 
+  80032c:	ff d0                	call   *%rax
+  80032e:	83 f8 eb             	cmp    $0xffffffeb,%eax
+  800331:	74 30                	je     800363 <umain+0x331>
+    panic("mutex_trylock on a held mutex");
+  800333:	48 b8 28 67 80 00 00 	movabs $0x806728,%rax
+  80033a:	00 00 00 
+  80033d:	48 89 c2             	mov    %rax,%rdx
+  800340:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800345:	48 b8 d3 66 80 00 00 	movabs $0x8066d3,%rax
+  80034c:	00 00 00 
+  80034f:	48 89 c7             	mov    %rax,%rdi
+  800352:	b8 00 00 00 00       	mov    $0x0,%eax
+  800357:	48 b9 8c 04 80 00 00 	movabs $0x80048c,%rcx
+  80035e:	00 00 00 
+  800361:	ff d1                	call   *%rcx
+  mutex_unlock(&sh->mutex);
+  800363:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800367:	48 89 c7             	mov    %rax,%rdi
+  80036a:	48 b8 ce 54 80 00 00 	movabs $0x8054ce,%rax
+  800371:	00 00 00 
+  800374:	ff d0                	call   *%rax
+
+  if (sh->counter != 2 * N)
+  800376:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80037a:	8b 40 10             	mov    0x10(%rax),%eax
+  80037d:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  800382:	74 40                	je     8003c4 <umain+0x392>
+    panic("counter is %d, expected %d", sh->counter, 2 * N);
+  800384:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800388:	8b 40 10             	mov    0x10(%rax),%eax
+  80038b:	41 b8 c8 00 00 00    	mov    $0xc8,%r8d
+  800391:	89 c1                	mov    %eax,%ecx
+  800393:	48 b8 46 67 80 00 00 	movabs $0x806746,%rax
+  80039a:	00 00 00 
+  80039d:	48 89 c2             	mov    %rax,%rdx
+  8003a0:	be 3e 00 00 00       	mov    $0x3e,%esi
+  8003a5:	48 b8 d3 66 80 00 00 	movabs $0x8066d3,%rax
+  8003ac:	00 00 00 
+  8003af:	48 89 c7             	mov    %rax,%rdi
+  8003b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b7:	49 b9 8c 04 80 00 00 	movabs $0x80048c,%r9
+  8003be:	00 00 00 
+  8003c1:	41 ff d1             	call   *%r9
+  cprintf("sync test passed\n");
+  8003c4:	48 b8 61 67 80 00 00 	movabs $0x806761,%rax
+  8003cb:	00 00 00 
+  8003ce:	48 89 c7             	mov    %rax,%rdi
+  8003d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d6:	48 ba ab 06 80 00 00 	movabs $0x8006ab,%rdx
+  8003dd:	00 00 00 
+  8003e0:	ff d2                	call   *%rdx
+}
+  8003e2:	90                   	nop
+  8003e3:	c9                   	leave
+  8003e4:	c3                   	ret
+
+00000000008003e5 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8003e5:	55                   	push   %rbp
+  8003e6:	48 89 e5             	mov    %rsp,%rbp
+  8003e9:	48 83 ec 20          	sub    $0x20,%rsp
+  8003ed:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003f0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8003f4:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8003fb:	00 00 00 
+  8003fe:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800402:	eb 13                	jmp    800417 <libmain+0x32>
+    (*ctor)();
+  800404:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800408:	48 8b 10             	mov    (%rax),%rdx
+  80040b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800410:	ff d2                	call   *%rdx
+    ctor++;
+  800412:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800417:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  80041e:	00 00 00 
+  800421:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800425:	72 dd                	jb     800404 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800427:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80042b:	7e 14                	jle    800441 <libmain+0x5c>
+    binaryname = argv[0];
+  80042d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800431:	48 8b 00             	mov    (%rax),%rax
+  800434:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80043b:	00 00 00 
+  80043e:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800441:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800445:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800448:	48 89 d6             	mov    %rdx,%rsi
+  80044b:	89 c7                	mov    %eax,%edi
+  80044d:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800454:	00 00 00 
+  800457:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800459:	48 b8 68 04 80 00 00 	movabs $0x800468,%rax
+  800460:	00 00 00 
+  800463:	ff d0                	call   *%rax
+#endif
+}
+  800465:	90                   	nop
+  800466:	c9                   	leave
+  800467:	c3                   	ret
+
+0000000000800468 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800468:	55                   	push   %rbp
+  800469:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80046c:	48 b8 e0 36 80 00 00 	movabs $0x8036e0,%rax
+  800473:	00 00 00 
+  800476:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800478:	bf 00 00 00 00       	mov    $0x0,%edi
+  80047d:	48 b8 e1 22 80 00 00 	movabs $0x8022e1,%rax
+  800484:	00 00 00 
+  800487:	ff d0                	call   *%rax
+}
+  800489:	90                   	nop
+  80048a:	5d                   	pop    %rbp
+  80048b:	c3                   	ret
+
+000000000080048c <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80048c:	55                   	push   %rbp
+  80048d:	48 89 e5             	mov    %rsp,%rbp
+  800490:	53                   	push   %rbx
+  800491:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800498:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80049f:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8004a5:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8004ac:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8004b3:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8004ba:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8004c1:	84 c0                	test   %al,%al
+  8004c3:	74 23                	je     8004e8 <_panic+0x5c>
+  8004c5:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8004cc:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8004d0:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8004d4:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8004d8:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8004dc:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8004e0:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8004e4:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8004e8:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8004ef:	00 00 00 
+  8004f2:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8004f9:	00 00 00 
+  8004fc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800500:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800507:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80050e:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800515:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80051c:	00 00 00 
+  80051f:	48 8b 18             	mov    (%rax),%rbx
+  800522:	48 b8 b0 23 80 00 00 	movabs $0x8023b0,%rax
+  800529:	00 00 00 
+  80052c:	ff d0                	call   *%rax
+  80052e:	89 c6                	mov    %eax,%esi
+  800530:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800536:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80053d:	41 89 d0             	mov    %edx,%r8d
+  800540:	48 89 c1             	mov    %rax,%rcx
+  800543:	48 89 da             	mov    %rbx,%rdx
+  800546:	48 b8 80 67 80 00 00 	movabs $0x806780,%rax
+  80054d:	00 00 00 
+  800550:	48 89 c7             	mov    %rax,%rdi
+  800553:	b8 00 00 00 00       	mov    $0x0,%eax
+  800558:	49 b9 ab 06 80 00 00 	movabs $0x8006ab,%r9
+  80055f:	00 00 00 
+  800562:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800565:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80056c:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800573:	48 89 d6             	mov    %rdx,%rsi
+  800576:	48 89 c7             	mov    %rax,%rdi
+  800579:	48 b8 20 06 80 00 00 	movabs $0x800620,%rax
+  800580:	00 00 00 
+  800583:	ff d0                	call   *%rax
+  cprintf("\n");
+  800585:	48 b8 a3 67 80 00 00 	movabs $0x8067a3,%rax
+  80058c:	00 00 00 
+  80058f:	48 89 c7             	mov    %rax,%rdi
+  800592:	b8 00 00 00 00       	mov    $0x0,%eax
+  800597:	48 ba ab 06 80 00 00 	movabs $0x8006ab,%rdx
+  80059e:	00 00 00 
+  8005a1:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8005a3:	cc                   	int3
+  8005a4:	eb fd                	jmp    8005a3 <_panic+0x117>
+
+00000000008005a6 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8005a6:	55                   	push   %rbp
+  8005a7:	48 89 e5             	mov    %rsp,%rbp
+  8005aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8005ae:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005b1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8005b5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005b9:	8b 00                	mov    (%rax),%eax
+  8005bb:	8d 48 01             	lea    0x1(%rax),%ecx
+  8005be:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005c2:	89 0a                	mov    %ecx,(%rdx)
+  8005c4:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8005c7:	89 d1                	mov    %edx,%ecx
+  8005c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005cd:	48 98                	cltq
+  8005cf:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8005d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005d7:	8b 00                	mov    (%rax),%eax
+  8005d9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005de:	75 2c                	jne    80060c <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8005e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005e4:	8b 00                	mov    (%rax),%eax
+  8005e6:	48 98                	cltq
+  8005e8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005ec:	48 83 c2 08          	add    $0x8,%rdx
+  8005f0:	48 89 c6             	mov    %rax,%rsi
+  8005f3:	48 89 d7             	mov    %rdx,%rdi
+  8005f6:	48 b8 12 22 80 00 00 	movabs $0x802212,%rax
+  8005fd:	00 00 00 
+  800600:	ff d0                	call   *%rax
+    b->idx = 0;
+  800602:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800606:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80060c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800610:	8b 40 04             	mov    0x4(%rax),%eax
+  800613:	8d 50 01             	lea    0x1(%rax),%edx
+  800616:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80061a:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80061d:	90                   	nop
+  80061e:	c9                   	leave
+  80061f:	c3                   	ret
+
+0000000000800620 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800620:	55                   	push   %rbp
+  800621:	48 89 e5             	mov    %rsp,%rbp
+  800624:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80062b:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800632:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800639:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800640:	00 00 00 
+  b.cnt = 0;
+  800643:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  80064a:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80064d:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800654:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80065b:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800662:	48 89 c6             	mov    %rax,%rsi
+  800665:	48 b8 a6 05 80 00 00 	movabs $0x8005a6,%rax
+  80066c:	00 00 00 
+  80066f:	48 89 c7             	mov    %rax,%rdi
+  800672:	48 b8 05 0a 80 00 00 	movabs $0x800a05,%rax
+  800679:	00 00 00 
+  80067c:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80067e:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800684:	48 98                	cltq
+  800686:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80068d:	48 83 c2 08          	add    $0x8,%rdx
+  800691:	48 89 c6             	mov    %rax,%rsi
+  800694:	48 89 d7             	mov    %rdx,%rdi
+  800697:	48 b8 12 22 80 00 00 	movabs $0x802212,%rax
+  80069e:	00 00 00 
+  8006a1:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8006a3:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8006a9:	c9                   	leave
+  8006aa:	c3                   	ret
+
+00000000008006ab <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006ab:	55                   	push   %rbp
+  8006ac:	48 89 e5             	mov    %rsp,%rbp
+  8006af:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8006b6:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8006bd:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8006c4:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8006cb:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8006d2:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8006d9:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8006e0:	84 c0                	test   %al,%al
+  8006e2:	74 20                	je     800704 <cprintf+0x59>
+  8006e4:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8006e8:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8006ec:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8006f0:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8006f4:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8006f8:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8006fc:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800700:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800704:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  80070b:	00 00 00 
+  80070e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800715:	00 00 00 
+  800718:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80071c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800723:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80072a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800731:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800738:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80073f:	48 89 d6             	mov    %rdx,%rsi
+  800742:	48 89 c7             	mov    %rax,%rdi
+  800745:	48 b8 20 06 80 00 00 	movabs $0x800620,%rax
+  80074c:	00 00 00 
+  80074f:	ff d0                	call   *%rax
+  800751:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800757:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80075d:	c9                   	leave
+  80075e:	c3                   	ret
+
+000000000080075f <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80075f:	55                   	push   %rbp
+  800760:	48 89 e5             	mov    %rsp,%rbp
+  800763:	48 83 ec 30          	sub    $0x30,%rsp
+  800767:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80076b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80076f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800773:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800776:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  80077a:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80077e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800781:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800785:	72 54                	jb     8007db <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800787:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  80078a:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80078d:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  800790:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800794:	ba 00 00 00 00       	mov    $0x0,%edx
+  800799:	48 f7 f6             	div    %rsi
+  80079c:	49 89 c2             	mov    %rax,%r10
+  80079f:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8007a2:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8007a5:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8007a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007ad:	41 89 c9             	mov    %ecx,%r9d
+  8007b0:	41 89 f8             	mov    %edi,%r8d
+  8007b3:	89 d1                	mov    %edx,%ecx
+  8007b5:	4c 89 d2             	mov    %r10,%rdx
+  8007b8:	48 89 c7             	mov    %rax,%rdi
+  8007bb:	48 b8 5f 07 80 00 00 	movabs $0x80075f,%rax
+  8007c2:	00 00 00 
+  8007c5:	ff d0                	call   *%rax
+  8007c7:	eb 1c                	jmp    8007e5 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8007c9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007cd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8007d0:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8007d4:	48 89 d6             	mov    %rdx,%rsi
+  8007d7:	89 c7                	mov    %eax,%edi
+  8007d9:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8007db:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8007df:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8007e3:	7f e4                	jg     8007c9 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8007e5:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8007e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007f1:	48 f7 f1             	div    %rcx
+  8007f4:	48 b8 f0 69 80 00 00 	movabs $0x8069f0,%rax
+  8007fb:	00 00 00 
+  8007fe:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800802:	0f be c0             	movsbl %al,%eax
+  800805:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800809:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80080d:	48 89 d6             	mov    %rdx,%rsi
+  800810:	89 c7                	mov    %eax,%edi
+  800812:	ff d1                	call   *%rcx
+}
+  800814:	90                   	nop
+  800815:	c9                   	leave
+  800816:	c3                   	ret
+
+0000000000800817 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800817:	55                   	push   %rbp
+  800818:	48 89 e5             	mov    %rsp,%rbp
+  80081b:	48 83 ec 10          	sub    $0x10,%rsp
+  80081f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800823:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800826:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80082a:	7e 4b                	jle    800877 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80082c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800830:	8b 00                	mov    (%rax),%eax
+  800832:	83 f8 2f             	cmp    $0x2f,%eax
+  800835:	77 24                	ja     80085b <getuint+0x44>
+  800837:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80083b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80083f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800843:	8b 00                	mov    (%rax),%eax
+  800845:	89 c0                	mov    %eax,%eax
+  800847:	48 01 d0             	add    %rdx,%rax
+  80084a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80084e:	8b 12                	mov    (%rdx),%edx
+  800850:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800853:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800857:	89 0a                	mov    %ecx,(%rdx)
+  800859:	eb 14                	jmp    80086f <getuint+0x58>
+  80085b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80085f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800863:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800867:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80086b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80086f:	48 8b 00             	mov    (%rax),%rax
+  800872:	e9 95 00 00 00       	jmp    80090c <getuint+0xf5>
+  else if (lflag)
+  800877:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  80087b:	74 48                	je     8008c5 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80087d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800881:	8b 00                	mov    (%rax),%eax
+  800883:	83 f8 2f             	cmp    $0x2f,%eax
+  800886:	77 24                	ja     8008ac <getuint+0x95>
+  800888:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80088c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800890:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800894:	8b 00                	mov    (%rax),%eax
+  800896:	89 c0                	mov    %eax,%eax
+  800898:	48 01 d0             	add    %rdx,%rax
+  80089b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80089f:	8b 12                	mov    (%rdx),%edx
+  8008a1:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008a4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008a8:	89 0a                	mov    %ecx,(%rdx)
+  8008aa:	eb 14                	jmp    8008c0 <getuint+0xa9>
+  8008ac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008b4:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008bc:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008c0:	48 8b 00             	mov    (%rax),%rax
+  8008c3:	eb 47                	jmp    80090c <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8008c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008c9:	8b 00                	mov    (%rax),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 24                	ja     8008f4 <getuint+0xdd>
+  8008d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008dc:	8b 00                	mov    (%rax),%eax
+  8008de:	89 c0                	mov    %eax,%eax
+  8008e0:	48 01 d0             	add    %rdx,%rax
+  8008e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008e7:	8b 12                	mov    (%rdx),%edx
+  8008e9:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008f0:	89 0a                	mov    %ecx,(%rdx)
+  8008f2:	eb 14                	jmp    800908 <getuint+0xf1>
+  8008f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008f8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008fc:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800900:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800904:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800908:	8b 00                	mov    (%rax),%eax
+  80090a:	89 c0                	mov    %eax,%eax
+}
+  80090c:	c9                   	leave
+  80090d:	c3                   	ret
+
+000000000080090e <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80090e:	55                   	push   %rbp
+  80090f:	48 89 e5             	mov    %rsp,%rbp
+  800912:	48 83 ec 10          	sub    $0x10,%rsp
+  800916:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80091a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80091d:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800921:	7e 4b                	jle    80096e <getint+0x60>
+    return va_arg(*ap, long long);
+  800923:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800927:	8b 00                	mov    (%rax),%eax
+  800929:	83 f8 2f             	cmp    $0x2f,%eax
+  80092c:	77 24                	ja     800952 <getint+0x44>
+  80092e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800932:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800936:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80093a:	8b 00                	mov    (%rax),%eax
+  80093c:	89 c0                	mov    %eax,%eax
+  80093e:	48 01 d0             	add    %rdx,%rax
+  800941:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800945:	8b 12                	mov    (%rdx),%edx
+  800947:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80094a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80094e:	89 0a                	mov    %ecx,(%rdx)
+  800950:	eb 14                	jmp    800966 <getint+0x58>
+  800952:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800956:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80095a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80095e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800962:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800966:	48 8b 00             	mov    (%rax),%rax
+  800969:	e9 95 00 00 00       	jmp    800a03 <getint+0xf5>
+  else if (lflag)
+  80096e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800972:	74 48                	je     8009bc <getint+0xae>
+    return va_arg(*ap, long);
+  800974:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800978:	8b 00                	mov    (%rax),%eax
+  80097a:	83 f8 2f             	cmp    $0x2f,%eax
+  80097d:	77 24                	ja     8009a3 <getint+0x95>
+  80097f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800983:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800987:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80098b:	8b 00                	mov    (%rax),%eax
+  80098d:	89 c0                	mov    %eax,%eax
+  80098f:	48 01 d0             	add    %rdx,%rax
+  800992:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800996:	8b 12                	mov    (%rdx),%edx
+  800998:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80099b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80099f:	89 0a                	mov    %ecx,(%rdx)
+  8009a1:	eb 14                	jmp    8009b7 <getint+0xa9>
+  8009a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009a7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009ab:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009af:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009b3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009b7:	48 8b 00             	mov    (%rax),%rax
+  8009ba:	eb 47                	jmp    800a03 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8009bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009c0:	8b 00                	mov    (%rax),%eax
+  8009c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c5:	77 24                	ja     8009eb <getint+0xdd>
+  8009c7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009cb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009cf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d3:	8b 00                	mov    (%rax),%eax
+  8009d5:	89 c0                	mov    %eax,%eax
+  8009d7:	48 01 d0             	add    %rdx,%rax
+  8009da:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009de:	8b 12                	mov    (%rdx),%edx
+  8009e0:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009e3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009e7:	89 0a                	mov    %ecx,(%rdx)
+  8009e9:	eb 14                	jmp    8009ff <getint+0xf1>
+  8009eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009ef:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009f3:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009f7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009fb:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009ff:	8b 00                	mov    (%rax),%eax
+  800a01:	48 98                	cltq
+}
+  800a03:	c9                   	leave
+  800a04:	c3                   	ret
+
+0000000000800a05 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800a05:	55                   	push   %rbp
+  800a06:	48 89 e5             	mov    %rsp,%rbp
+  800a09:	41 54                	push   %r12
+  800a0b:	53                   	push   %rbx
+  800a0c:	48 83 ec 60          	sub    $0x60,%rsp
+  800a10:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800a14:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800a18:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a1c:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800a20:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a24:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a28:	48 8b 06             	mov    (%rsi),%rax
+  800a2b:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a2f:	48 89 01             	mov    %rax,(%rcx)
+  800a32:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a36:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a3a:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a3e:	eb 17                	jmp    800a57 <vprintfmt+0x52>
+      if (ch == '\0')
+  800a40:	85 db                	test   %ebx,%ebx
+  800a42:	0f 84 bf 04 00 00    	je     800f07 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800a48:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a4c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a50:	48 89 c6             	mov    %rax,%rsi
+  800a53:	89 df                	mov    %ebx,%edi
+  800a55:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a57:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a5b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a5f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a63:	0f b6 00             	movzbl (%rax),%eax
+  800a66:	0f b6 d8             	movzbl %al,%ebx
+  800a69:	83 fb 25             	cmp    $0x25,%ebx
+  800a6c:	75 d2                	jne    800a40 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800a6e:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800a72:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800a79:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800a80:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800a87:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800a8e:	eb 04                	jmp    800a94 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800a90:	90                   	nop
+  800a91:	eb 01                	jmp    800a94 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800a93:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800a94:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a98:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a9c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800aa0:	0f b6 00             	movzbl (%rax),%eax
+  800aa3:	0f b6 d8             	movzbl %al,%ebx
+  800aa6:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800aa9:	83 f8 55             	cmp    $0x55,%eax
+  800aac:	0f 87 22 04 00 00    	ja     800ed4 <vprintfmt+0x4cf>
+  800ab2:	89 c0                	mov    %eax,%eax
+  800ab4:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800abb:	00 
+  800abc:	48 b8 18 6a 80 00 00 	movabs $0x806a18,%rax
+  800ac3:	00 00 00 
+  800ac6:	48 01 d0             	add    %rdx,%rax
+  800ac9:	48 8b 00             	mov    (%rax),%rax
+  800acc:	ff e0                	jmp    *%rax
+        padc = '-';
+  800ace:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800ad2:	eb c0                	jmp    800a94 <vprintfmt+0x8f>
+        padc = '0';
+  800ad4:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800ad8:	eb ba                	jmp    800a94 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800ada:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800ae1:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800ae4:	89 d0                	mov    %edx,%eax
+  800ae6:	c1 e0 02             	shl    $0x2,%eax
+  800ae9:	01 d0                	add    %edx,%eax
+  800aeb:	01 c0                	add    %eax,%eax
+  800aed:	01 d8                	add    %ebx,%eax
+  800aef:	83 e8 30             	sub    $0x30,%eax
+  800af2:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800af5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800af9:	0f b6 00             	movzbl (%rax),%eax
+  800afc:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800aff:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b02:	7e 60                	jle    800b64 <vprintfmt+0x15f>
+  800b04:	83 fb 39             	cmp    $0x39,%ebx
+  800b07:	7f 5b                	jg     800b64 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800b09:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800b0e:	eb d1                	jmp    800ae1 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800b10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b13:	83 f8 2f             	cmp    $0x2f,%eax
+  800b16:	77 17                	ja     800b2f <vprintfmt+0x12a>
+  800b18:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b1c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b1f:	89 d2                	mov    %edx,%edx
+  800b21:	48 01 d0             	add    %rdx,%rax
+  800b24:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b27:	83 c2 08             	add    $0x8,%edx
+  800b2a:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b2d:	eb 0c                	jmp    800b3b <vprintfmt+0x136>
+  800b2f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b33:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b37:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b3b:	8b 00                	mov    (%rax),%eax
+  800b3d:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800b40:	eb 23                	jmp    800b65 <vprintfmt+0x160>
+        if (width < 0)
+  800b42:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b46:	0f 89 44 ff ff ff    	jns    800a90 <vprintfmt+0x8b>
+          width = 0;
+  800b4c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800b53:	e9 38 ff ff ff       	jmp    800a90 <vprintfmt+0x8b>
+        altflag = 1;
+  800b58:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800b5f:	e9 30 ff ff ff       	jmp    800a94 <vprintfmt+0x8f>
+        goto process_precision;
+  800b64:	90                   	nop
+        if (width < 0)
+  800b65:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b69:	0f 89 24 ff ff ff    	jns    800a93 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800b6f:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b72:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800b75:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800b7c:	e9 12 ff ff ff       	jmp    800a93 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800b81:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800b85:	e9 0a ff ff ff       	jmp    800a94 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800b8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b90:	77 17                	ja     800ba9 <vprintfmt+0x1a4>
+  800b92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b96:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b99:	89 d2                	mov    %edx,%edx
+  800b9b:	48 01 d0             	add    %rdx,%rax
+  800b9e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ba1:	83 c2 08             	add    $0x8,%edx
+  800ba4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800ba7:	eb 0c                	jmp    800bb5 <vprintfmt+0x1b0>
+  800ba9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bad:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bb1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bb5:	8b 00                	mov    (%rax),%eax
+  800bb7:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800bbb:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800bbf:	48 89 d6             	mov    %rdx,%rsi
+  800bc2:	89 c7                	mov    %eax,%edi
+  800bc4:	ff d1                	call   *%rcx
+        break;
+  800bc6:	e9 37 03 00 00       	jmp    800f02 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800bcb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bce:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd1:	77 17                	ja     800bea <vprintfmt+0x1e5>
+  800bd3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bd7:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bda:	89 d2                	mov    %edx,%edx
+  800bdc:	48 01 d0             	add    %rdx,%rax
+  800bdf:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800be2:	83 c2 08             	add    $0x8,%edx
+  800be5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800be8:	eb 0c                	jmp    800bf6 <vprintfmt+0x1f1>
+  800bea:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bee:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bf2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bf6:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800bf8:	85 db                	test   %ebx,%ebx
+  800bfa:	79 02                	jns    800bfe <vprintfmt+0x1f9>
+          err = -err;
+  800bfc:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800bfe:	83 fb 15             	cmp    $0x15,%ebx
+  800c01:	7f 16                	jg     800c19 <vprintfmt+0x214>
+  800c03:	48 ba 40 69 80 00 00 	movabs $0x806940,%rdx
+  800c0a:	00 00 00 
+  800c0d:	48 63 c3             	movslq %ebx,%rax
+  800c10:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800c14:	4d 85 e4             	test   %r12,%r12
+  800c17:	75 2e                	jne    800c47 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800c19:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c1d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c21:	89 d9                	mov    %ebx,%ecx
+  800c23:	48 ba 01 6a 80 00 00 	movabs $0x806a01,%rdx
+  800c2a:	00 00 00 
+  800c2d:	48 89 c7             	mov    %rax,%rdi
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c35:	49 b8 11 0f 80 00 00 	movabs $0x800f11,%r8
+  800c3c:	00 00 00 
+  800c3f:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800c42:	e9 bb 02 00 00       	jmp    800f02 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800c47:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c4b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c4f:	4c 89 e1             	mov    %r12,%rcx
+  800c52:	48 ba 0a 6a 80 00 00 	movabs $0x806a0a,%rdx
+  800c59:	00 00 00 
+  800c5c:	48 89 c7             	mov    %rax,%rdi
+  800c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c64:	49 b8 11 0f 80 00 00 	movabs $0x800f11,%r8
+  800c6b:	00 00 00 
+  800c6e:	41 ff d0             	call   *%r8
+        break;
+  800c71:	e9 8c 02 00 00       	jmp    800f02 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800c76:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c79:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7c:	77 17                	ja     800c95 <vprintfmt+0x290>
+  800c7e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c82:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c85:	89 d2                	mov    %edx,%edx
+  800c87:	48 01 d0             	add    %rdx,%rax
+  800c8a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c8d:	83 c2 08             	add    $0x8,%edx
+  800c90:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c93:	eb 0c                	jmp    800ca1 <vprintfmt+0x29c>
+  800c95:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c99:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c9d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ca1:	4c 8b 20             	mov    (%rax),%r12
+  800ca4:	4d 85 e4             	test   %r12,%r12
+  800ca7:	75 0a                	jne    800cb3 <vprintfmt+0x2ae>
+          p = "(null)";
+  800ca9:	49 bc 0d 6a 80 00 00 	movabs $0x806a0d,%r12
+  800cb0:	00 00 00 
+        if (width > 0 && padc != '-')
+  800cb3:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cb7:	7e 78                	jle    800d31 <vprintfmt+0x32c>
+  800cb9:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800cbd:	74 72                	je     800d31 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800cbf:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800cc2:	48 98                	cltq
+  800cc4:	48 89 c6             	mov    %rax,%rsi
+  800cc7:	4c 89 e7             	mov    %r12,%rdi
+  800cca:	48 b8 1d 16 80 00 00 	movabs $0x80161d,%rax
+  800cd1:	00 00 00 
+  800cd4:	ff d0                	call   *%rax
+  800cd6:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800cd9:	eb 17                	jmp    800cf2 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800cdb:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800cdf:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800ce3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800ce7:	48 89 d6             	mov    %rdx,%rsi
+  800cea:	89 c7                	mov    %eax,%edi
+  800cec:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800cee:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cf2:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cf6:	7f e3                	jg     800cdb <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cf8:	eb 37                	jmp    800d31 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800cfa:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800cfe:	74 1e                	je     800d1e <vprintfmt+0x319>
+  800d00:	83 fb 1f             	cmp    $0x1f,%ebx
+  800d03:	7e 05                	jle    800d0a <vprintfmt+0x305>
+  800d05:	83 fb 7e             	cmp    $0x7e,%ebx
+  800d08:	7e 14                	jle    800d1e <vprintfmt+0x319>
+            putch('?', putdat);
+  800d0a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d0e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d12:	48 89 c6             	mov    %rax,%rsi
+  800d15:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d1a:	ff d2                	call   *%rdx
+  800d1c:	eb 0f                	jmp    800d2d <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800d1e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d22:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d26:	48 89 c6             	mov    %rax,%rsi
+  800d29:	89 df                	mov    %ebx,%edi
+  800d2b:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d2d:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d31:	4c 89 e0             	mov    %r12,%rax
+  800d34:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d38:	0f b6 00             	movzbl (%rax),%eax
+  800d3b:	0f be d8             	movsbl %al,%ebx
+  800d3e:	85 db                	test   %ebx,%ebx
+  800d40:	74 28                	je     800d6a <vprintfmt+0x365>
+  800d42:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d46:	78 b2                	js     800cfa <vprintfmt+0x2f5>
+  800d48:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800d4c:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d50:	79 a8                	jns    800cfa <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800d52:	eb 16                	jmp    800d6a <vprintfmt+0x365>
+          putch(' ', putdat);
+  800d54:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d58:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d5c:	48 89 c6             	mov    %rax,%rsi
+  800d5f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d64:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800d66:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d6a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d6e:	7f e4                	jg     800d54 <vprintfmt+0x34f>
+        break;
+  800d70:	e9 8d 01 00 00       	jmp    800f02 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800d75:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d78:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d7c:	89 d6                	mov    %edx,%esi
+  800d7e:	48 89 c7             	mov    %rax,%rdi
+  800d81:	48 b8 0e 09 80 00 00 	movabs $0x80090e,%rax
+  800d88:	00 00 00 
+  800d8b:	ff d0                	call   *%rax
+  800d8d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800d91:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d95:	48 85 c0             	test   %rax,%rax
+  800d98:	79 1d                	jns    800db7 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800d9a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d9e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800da2:	48 89 c6             	mov    %rax,%rsi
+  800da5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800daa:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800dac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800db0:	48 f7 d8             	neg    %rax
+  800db3:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800db7:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800dbe:	e9 d2 00 00 00       	jmp    800e95 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800dc3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800dc6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dca:	89 d6                	mov    %edx,%esi
+  800dcc:	48 89 c7             	mov    %rax,%rdi
+  800dcf:	48 b8 17 08 80 00 00 	movabs $0x800817,%rax
+  800dd6:	00 00 00 
+  800dd9:	ff d0                	call   *%rax
+  800ddb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800ddf:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800de6:	e9 aa 00 00 00       	jmp    800e95 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800deb:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800dee:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800df2:	89 d6                	mov    %edx,%esi
+  800df4:	48 89 c7             	mov    %rax,%rdi
+  800df7:	48 b8 17 08 80 00 00 	movabs $0x800817,%rax
+  800dfe:	00 00 00 
+  800e01:	ff d0                	call   *%rax
+  800e03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800e07:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800e0e:	e9 82 00 00 00       	jmp    800e95 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800e13:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e17:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e1b:	48 89 c6             	mov    %rax,%rsi
+  800e1e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e23:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800e25:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e29:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e2d:	48 89 c6             	mov    %rax,%rsi
+  800e30:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e35:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800e37:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e3a:	83 f8 2f             	cmp    $0x2f,%eax
+  800e3d:	77 17                	ja     800e56 <vprintfmt+0x451>
+  800e3f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e43:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e46:	89 d2                	mov    %edx,%edx
+  800e48:	48 01 d0             	add    %rdx,%rax
+  800e4b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e4e:	83 c2 08             	add    $0x8,%edx
+  800e51:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e54:	eb 0c                	jmp    800e62 <vprintfmt+0x45d>
+  800e56:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e5a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e5e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e62:	48 8b 00             	mov    (%rax),%rax
+  800e65:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800e69:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800e70:	eb 23                	jmp    800e95 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800e72:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e75:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e79:	89 d6                	mov    %edx,%esi
+  800e7b:	48 89 c7             	mov    %rax,%rdi
+  800e7e:	48 b8 17 08 80 00 00 	movabs $0x800817,%rax
+  800e85:	00 00 00 
+  800e88:	ff d0                	call   *%rax
+  800e8a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800e8e:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800e95:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800e9a:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800e9d:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800ea0:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ea4:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ea8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800eac:	45 89 c1             	mov    %r8d,%r9d
+  800eaf:	41 89 f8             	mov    %edi,%r8d
+  800eb2:	48 89 c7             	mov    %rax,%rdi
+  800eb5:	48 b8 5f 07 80 00 00 	movabs $0x80075f,%rax
+  800ebc:	00 00 00 
+  800ebf:	ff d0                	call   *%rax
+        break;
+  800ec1:	eb 3f                	jmp    800f02 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800ec3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ec7:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ecb:	48 89 c6             	mov    %rax,%rsi
+  800ece:	89 df                	mov    %ebx,%edi
+  800ed0:	ff d2                	call   *%rdx
+        break;
+  800ed2:	eb 2e                	jmp    800f02 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800ed4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ed8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800edc:	48 89 c6             	mov    %rax,%rsi
+  800edf:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ee4:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800ee6:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800eeb:	eb 05                	jmp    800ef2 <vprintfmt+0x4ed>
+  800eed:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ef2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ef6:	48 83 e8 01          	sub    $0x1,%rax
+  800efa:	0f b6 00             	movzbl (%rax),%eax
+  800efd:	3c 25                	cmp    $0x25,%al
+  800eff:	75 ec                	jne    800eed <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800f01:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800f02:	e9 50 fb ff ff       	jmp    800a57 <vprintfmt+0x52>
+        return;
+  800f07:	90                   	nop
+    }
+  }
+}
+  800f08:	48 83 c4 60          	add    $0x60,%rsp
+  800f0c:	5b                   	pop    %rbx
+  800f0d:	41 5c                	pop    %r12
+  800f0f:	5d                   	pop    %rbp
+  800f10:	c3                   	ret
+
+0000000000800f11 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800f11:	55                   	push   %rbp
+  800f12:	48 89 e5             	mov    %rsp,%rbp
+  800f15:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f1c:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f23:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f2a:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f31:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f38:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f3f:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f46:	84 c0                	test   %al,%al
+  800f48:	74 20                	je     800f6a <printfmt+0x59>
+  800f4a:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f4e:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f52:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f56:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f5a:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f5e:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f62:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f66:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800f6a:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f71:	00 00 00 
+  800f74:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f7b:	00 00 00 
+  800f7e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f82:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f89:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f90:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800f97:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f9e:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800fa5:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800fac:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800fb3:	48 89 c7             	mov    %rax,%rdi
+  800fb6:	48 b8 05 0a 80 00 00 	movabs $0x800a05,%rax
+  800fbd:	00 00 00 
+  800fc0:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800fc2:	90                   	nop
+  800fc3:	c9                   	leave
+  800fc4:	c3                   	ret
+
+0000000000800fc5 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800fc5:	55                   	push   %rbp
+  800fc6:	48 89 e5             	mov    %rsp,%rbp
+  800fc9:	48 83 ec 10          	sub    $0x10,%rsp
+  800fcd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800fd0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800fd4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fd8:	8b 40 10             	mov    0x10(%rax),%eax
+  800fdb:	8d 50 01             	lea    0x1(%rax),%edx
+  800fde:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe2:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800fe5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fe9:	48 8b 10             	mov    (%rax),%rdx
+  800fec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ff0:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800ff4:	48 39 c2             	cmp    %rax,%rdx
+  800ff7:	73 17                	jae    801010 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800ff9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800ffd:	48 8b 00             	mov    (%rax),%rax
+  801000:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801004:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801008:	48 89 0a             	mov    %rcx,(%rdx)
+  80100b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80100e:	88 10                	mov    %dl,(%rax)
+}
+  801010:	90                   	nop
+  801011:	c9                   	leave
+  801012:	c3                   	ret
+
+0000000000801013 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801013:	55                   	push   %rbp
+  801014:	48 89 e5             	mov    %rsp,%rbp
+  801017:	48 83 ec 40          	sub    $0x40,%rsp
+  80101b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80101f:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801022:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801026:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  80102a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80102e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801032:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801035:	48 98                	cltq
+  801037:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80103b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80103f:	48 01 d0             	add    %rdx,%rax
+  801042:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801046:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  80104d:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801052:	74 06                	je     80105a <vsnprintf+0x47>
+  801054:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801058:	7f 07                	jg     801061 <vsnprintf+0x4e>
+    return -E_INVAL;
+  80105a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80105f:	eb 32                	jmp    801093 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  801061:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801065:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801069:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80106d:	48 89 c6             	mov    %rax,%rsi
+  801070:	48 b8 c5 0f 80 00 00 	movabs $0x800fc5,%rax
+  801077:	00 00 00 
+  80107a:	48 89 c7             	mov    %rax,%rdi
+  80107d:	48 b8 05 0a 80 00 00 	movabs $0x800a05,%rax
+  801084:	00 00 00 
+  801087:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801089:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80108d:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  801090:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801093:	c9                   	leave
+  801094:	c3                   	ret
+
+0000000000801095 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801095:	55                   	push   %rbp
+  801096:	48 89 e5             	mov    %rsp,%rbp
+  801099:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8010a0:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010a7:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  8010ad:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8010b4:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010bb:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010c2:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010c9:	84 c0                	test   %al,%al
+  8010cb:	74 20                	je     8010ed <snprintf+0x58>
+  8010cd:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010d1:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010d5:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010d9:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010dd:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010e1:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010e5:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010e9:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8010ed:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8010f4:	00 00 00 
+  8010f7:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8010fe:	00 00 00 
+  801101:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801105:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80110c:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801113:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  80111a:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  801121:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801128:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80112e:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801135:	48 89 c7             	mov    %rax,%rdi
+  801138:	48 b8 13 10 80 00 00 	movabs $0x801013,%rax
+  80113f:	00 00 00 
+  801142:	ff d0                	call   *%rax
+  801144:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  80114a:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  801150:	c9                   	leave
+  801151:	c3                   	ret
+
+0000000000801152 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801152:	55                   	push   %rbp
+  801153:	48 89 e5             	mov    %rsp,%rbp
+  801156:	53                   	push   %rbx
+  801157:	48 83 ec 38          	sub    $0x38,%rsp
+  80115b:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80115e:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801162:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801166:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80116a:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  80116e:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801171:	ba 00 00 00 00       	mov    $0x0,%edx
+  801176:	89 d1                	mov    %edx,%ecx
+  801178:	0f a2                	cpuid
+  80117a:	89 de                	mov    %ebx,%esi
+  80117c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80117f:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801182:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801185:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801188:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80118d:	74 09                	je     801198 <cpuid+0x46>
+}
+  80118f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801193:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801196:	89 10                	mov    %edx,(%rax)
+
+  801198:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80119d:	74 09                	je     8011a8 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  80119f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011a3:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8011a6:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8011a8:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8011ad:	74 09                	je     8011b8 <cpuid+0x66>
+char *
+  8011af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011b3:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8011b6:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  8011b8:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8011bd:	74 09                	je     8011c8 <cpuid+0x76>
+  for (; *s; s++)
+  8011bf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011c3:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8011c6:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  8011c8:	90                   	nop
+  8011c9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011cd:	c9                   	leave
+  8011ce:	c3                   	ret
+
+00000000008011cf <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  8011cf:	55                   	push   %rbp
+  8011d0:	48 89 e5             	mov    %rsp,%rbp
+  8011d3:	48 83 ec 18          	sub    $0x18,%rsp
+  8011d7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  8011da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8011dd:	89 c1                	mov    %eax,%ecx
+  8011df:	0f 01 d0             	xgetbv
+  8011e2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011e5:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  8011e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011eb:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8011ee:	48 c1 e2 20          	shl    $0x20,%rdx
+  8011f2:	48 09 d0             	or     %rdx,%rax
+#else
+  8011f5:	c9                   	leave
+  8011f6:	c3                   	ret
+
+00000000008011f7 <string_cpu>:
+string_cpu(void) {
+  8011f7:	55                   	push   %rbp
+  8011f8:	48 89 e5             	mov    %rsp,%rbp
+  8011fb:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8011ff:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801206:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80120d:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801214:	00 00 00 
+  801217:	8b 00                	mov    (%rax),%eax
+  801219:	85 c0                	test   %eax,%eax
+  80121b:	78 11                	js     80122e <string_cpu+0x37>
+    return string_features;
+  80121d:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801224:	00 00 00 
+  801227:	8b 00                	mov    (%rax),%eax
+  801229:	e9 df 00 00 00       	jmp    80130d <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80122e:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801232:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801238:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80123d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801242:	48 89 c6             	mov    %rax,%rsi
+  801245:	bf 00 00 00 00       	mov    $0x0,%edi
+  80124a:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  801251:	00 00 00 
+  801254:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801256:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801259:	83 f8 06             	cmp    $0x6,%eax
+  80125c:	76 28                	jbe    801286 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  80125e:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801262:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801268:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126d:	48 89 c2             	mov    %rax,%rdx
+  801270:	be 00 00 00 00       	mov    $0x0,%esi
+  801275:	bf 07 00 00 00       	mov    $0x7,%edi
+  80127a:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  801281:	00 00 00 
+  801284:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801286:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801289:	25 00 02 00 00       	and    $0x200,%eax
+  80128e:	85 c0                	test   %eax,%eax
+  801290:	74 04                	je     801296 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801292:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801296:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80129a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012a0:	48 89 c1             	mov    %rax,%rcx
+  8012a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ad:	bf 01 00 00 00       	mov    $0x1,%edi
+  8012b2:	48 b8 52 11 80 00 00 	movabs $0x801152,%rax
+  8012b9:	00 00 00 
+  8012bc:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8012be:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8012c1:	83 e0 20             	and    $0x20,%eax
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	74 2a                	je     8012f2 <string_cpu+0xfb>
+  8012c8:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8012cb:	25 00 00 00 08       	and    $0x8000000,%eax
+  8012d0:	85 c0                	test   %eax,%eax
+  8012d2:	74 1e                	je     8012f2 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  8012d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012d9:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  8012e0:	00 00 00 
+  8012e3:	ff d0                	call   *%rax
+  8012e5:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8012e8:	48 83 f8 06          	cmp    $0x6,%rax
+  8012ec:	75 04                	jne    8012f2 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8012ee:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8012f2:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  8012f9:	00 00 00 
+  8012fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012ff:	89 02                	mov    %eax,(%rdx)
+  801301:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801308:	00 00 00 
+  80130b:	8b 00                	mov    (%rax),%eax
+}
+  80130d:	c9                   	leave
+  80130e:	c3                   	ret
+
+000000000080130f <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80130f:	55                   	push   %rbp
+  801310:	48 89 e5             	mov    %rsp,%rbp
+  801313:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801317:	48 83 ec 60          	sub    $0x60,%rsp
+  80131b:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  801320:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801325:	83 e0 1f             	and    $0x1f,%eax
+  801328:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80132c:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801330:	48 f7 d8             	neg    %rax
+  801333:	48 89 c2             	mov    %rax,%rdx
+  801336:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  80133b:	48 01 d0             	add    %rdx,%rax
+  80133e:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801343:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801347:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80134d:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801352:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801356:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80135c:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801360:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801364:	89 c2                	mov    %eax,%edx
+  801366:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80136a:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80136f:	89 c1                	mov    %eax,%ecx
+  801371:	d3 e6                	shl    %cl,%esi
+  801373:	89 f0                	mov    %esi,%eax
+  801375:	21 d0                	and    %edx,%eax
+  801377:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80137b:	eb 21                	jmp    80139e <strlen_avx2+0x8f>
+    p += 32;
+  80137d:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801383:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801388:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80138c:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801392:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801396:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  80139a:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80139e:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8013a3:	74 d8                	je     80137d <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8013a5:	31 c0                	xor    %eax,%eax
+  8013a7:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8013ad:	48 63 d0             	movslq %eax,%rdx
+  8013b0:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8013b5:	48 01 d0             	add    %rdx,%rax
+  8013b8:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8013bd:	c9                   	leave
+  8013be:	c3                   	ret
+
+00000000008013bf <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  8013bf:	55                   	push   %rbp
+  8013c0:	48 89 e5             	mov    %rsp,%rbp
+  8013c3:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8013c7:	48 83 ec 40          	sub    $0x40,%rsp
+  8013cb:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8013d0:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  8013d5:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8013da:	eb 77                	jmp    801453 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  8013dc:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013e1:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8013e5:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8013e9:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013ee:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8013f2:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8013f6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013fa:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8013fe:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801403:	74 3c                	je     801441 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801405:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801409:	f7 d0                	not    %eax
+  80140b:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80140f:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801413:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801417:	48 63 d0             	movslq %eax,%rdx
+  80141a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80141f:	48 01 d0             	add    %rdx,%rax
+  801422:	0f b6 00             	movzbl (%rax),%eax
+  801425:	0f b6 c0             	movzbl %al,%eax
+  801428:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80142c:	48 63 ca             	movslq %edx,%rcx
+  80142f:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801434:	48 01 ca             	add    %rcx,%rdx
+  801437:	0f b6 12             	movzbl (%rdx),%edx
+  80143a:	0f b6 d2             	movzbl %dl,%edx
+  80143d:	29 d0                	sub    %edx,%eax
+  80143f:	eb 6b                	jmp    8014ac <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801441:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801447:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80144d:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801453:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801459:	77 81                	ja     8013dc <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  80145b:	eb 42                	jmp    80149f <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80145d:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801462:	0f b6 10             	movzbl (%rax),%edx
+  801465:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80146a:	0f b6 00             	movzbl (%rax),%eax
+  80146d:	38 c2                	cmp    %al,%dl
+  80146f:	74 1c                	je     80148d <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801471:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801476:	0f b6 00             	movzbl (%rax),%eax
+  801479:	0f b6 c8             	movzbl %al,%ecx
+  80147c:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801481:	0f b6 00             	movzbl (%rax),%eax
+  801484:	0f b6 d0             	movzbl %al,%edx
+  801487:	89 c8                	mov    %ecx,%eax
+  801489:	29 d0                	sub    %edx,%eax
+  80148b:	eb 1f                	jmp    8014ac <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  80148d:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801493:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801499:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80149f:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8014a5:	75 b6                	jne    80145d <memcmp_avx2+0x9e>
+  return 0;
+  8014a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ac:	c9                   	leave
+  8014ad:	c3                   	ret
+
+00000000008014ae <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8014ae:	55                   	push   %rbp
+  8014af:	48 89 e5             	mov    %rsp,%rbp
+  8014b2:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8014b6:	48 83 ec 60          	sub    $0x60,%rsp
+  8014ba:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8014bf:	89 f0                	mov    %esi,%eax
+  8014c1:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  8014c6:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8014ca:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8014cf:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  8014d3:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8014d8:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8014de:	eb 47                	jmp    801527 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8014e0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014e5:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8014e9:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8014ed:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8014f3:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8014f7:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014fb:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8014ff:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801504:	74 15                	je     80151b <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801506:	31 c0                	xor    %eax,%eax
+  801508:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80150e:	48 63 d0             	movslq %eax,%rdx
+  801511:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801516:	48 01 d0             	add    %rdx,%rax
+  801519:	eb 3d                	jmp    801558 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  80151b:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801521:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801527:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80152d:	77 b1                	ja     8014e0 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80152f:	eb 0c                	jmp    80153d <memfind_avx2+0x8f>
+  801531:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801537:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80153d:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801543:	74 0e                	je     801553 <memfind_avx2+0xa5>
+  801545:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80154a:	0f b6 00             	movzbl (%rax),%eax
+  80154d:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801551:	75 de                	jne    801531 <memfind_avx2+0x83>
+  return s;
+  801553:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801558:	c9                   	leave
+  801559:	c3                   	ret
+
+000000000080155a <strlen>:
+strlen(const char *s) {
+  80155a:	55                   	push   %rbp
+  80155b:	48 89 e5             	mov    %rsp,%rbp
+  80155e:	48 83 ec 40          	sub    $0x40,%rsp
+  801562:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801566:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80156a:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80156e:	48 b8 f7 11 80 00 00 	movabs $0x8011f7,%rax
+  801575:	00 00 00 
+  801578:	ff d0                	call   *%rax
+  80157a:	83 e0 02             	and    $0x2,%eax
+  80157d:	85 c0                	test   %eax,%eax
+  80157f:	74 18                	je     801599 <strlen+0x3f>
+    return strlen_avx2(s);
+  801581:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801585:	48 89 c7             	mov    %rax,%rdi
+  801588:	48 b8 0f 13 80 00 00 	movabs $0x80130f,%rax
+  80158f:	00 00 00 
+  801592:	ff d0                	call   *%rax
+  801594:	e9 82 00 00 00       	jmp    80161b <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801599:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80159d:	83 e0 0f             	and    $0xf,%eax
+  8015a0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8015a3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8015a6:	48 f7 d8             	neg    %rax
+  8015a9:	48 89 c2             	mov    %rax,%rdx
+  8015ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015b0:	48 01 d0             	add    %rdx,%rax
+  8015b3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8015b7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015bb:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8015bf:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8015c4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8015c8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015cc:	89 c2                	mov    %eax,%edx
+  8015ce:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8015d1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8015d6:	89 c1                	mov    %eax,%ecx
+  8015d8:	d3 e6                	shl    %cl,%esi
+  8015da:	89 f0                	mov    %esi,%eax
+  8015dc:	21 d0                	and    %edx,%eax
+  8015de:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015e1:	eb 1d                	jmp    801600 <strlen+0xa6>
+    p += 16;
+  8015e3:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8015e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ec:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8015f0:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8015f5:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8015f9:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801600:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801604:	74 dd                	je     8015e3 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801606:	31 c0                	xor    %eax,%eax
+  801608:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80160d:	48 63 d0             	movslq %eax,%rdx
+  801610:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801614:	48 01 d0             	add    %rdx,%rax
+  801617:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+
+000000000080161d <strnlen>:
+strnlen(const char *s, size_t size) {
+  80161d:	55                   	push   %rbp
+  80161e:	48 89 e5             	mov    %rsp,%rbp
+  801621:	48 83 ec 20          	sub    $0x20,%rsp
+  801625:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801629:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80162d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801634:	eb 0e                	jmp    801644 <strnlen+0x27>
+    n++;
+  801636:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80163a:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80163f:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801644:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801649:	74 0b                	je     801656 <strnlen+0x39>
+  80164b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164f:	0f b6 00             	movzbl (%rax),%eax
+  801652:	84 c0                	test   %al,%al
+  801654:	75 e0                	jne    801636 <strnlen+0x19>
+  return n;
+  801656:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801659:	c9                   	leave
+  80165a:	c3                   	ret
+
+000000000080165b <strcpy>:
+strcpy(char *dst, const char *src) {
+  80165b:	55                   	push   %rbp
+  80165c:	48 89 e5             	mov    %rsp,%rbp
+  80165f:	48 83 ec 20          	sub    $0x20,%rsp
+  801663:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801667:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80166b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80166f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801673:	90                   	nop
+  801674:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801678:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80167c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801680:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801684:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801688:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80168c:	0f b6 12             	movzbl (%rdx),%edx
+  80168f:	88 10                	mov    %dl,(%rax)
+  801691:	0f b6 00             	movzbl (%rax),%eax
+  801694:	84 c0                	test   %al,%al
+  801696:	75 dc                	jne    801674 <strcpy+0x19>
+  return ret;
+  801698:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80169c:	c9                   	leave
+  80169d:	c3                   	ret
+
+000000000080169e <strcat>:
+strcat(char *dst, const char *src) {
+  80169e:	55                   	push   %rbp
+  80169f:	48 89 e5             	mov    %rsp,%rbp
+  8016a2:	48 83 ec 20          	sub    $0x20,%rsp
+  8016a6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8016ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016b2:	48 89 c7             	mov    %rax,%rdi
+  8016b5:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  8016bc:	00 00 00 
+  8016bf:	ff d0                	call   *%rax
+  8016c1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8016c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8016c7:	48 63 d0             	movslq %eax,%rdx
+  8016ca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ce:	48 01 c2             	add    %rax,%rdx
+  8016d1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016d5:	48 89 c6             	mov    %rax,%rsi
+  8016d8:	48 89 d7             	mov    %rdx,%rdi
+  8016db:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  8016e2:	00 00 00 
+  8016e5:	ff d0                	call   *%rax
+  return dst;
+  8016e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+
+00000000008016ed <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8016ed:	55                   	push   %rbp
+  8016ee:	48 89 e5             	mov    %rsp,%rbp
+  8016f1:	48 83 ec 28          	sub    $0x28,%rsp
+  8016f5:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016f9:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016fd:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801701:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801705:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801709:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801710:	00 
+  801711:	eb 2a                	jmp    80173d <strncpy+0x50>
+    *dst++ = *src;
+  801713:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801717:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80171b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80171f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801723:	0f b6 12             	movzbl (%rdx),%edx
+  801726:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801728:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80172c:	0f b6 00             	movzbl (%rax),%eax
+  80172f:	84 c0                	test   %al,%al
+  801731:	74 05                	je     801738 <strncpy+0x4b>
+      src++;
+  801733:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801738:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80173d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801741:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801745:	72 cc                	jb     801713 <strncpy+0x26>
+  return ret;
+  801747:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80174b:	c9                   	leave
+  80174c:	c3                   	ret
+
+000000000080174d <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80174d:	55                   	push   %rbp
+  80174e:	48 89 e5             	mov    %rsp,%rbp
+  801751:	48 83 ec 28          	sub    $0x28,%rsp
+  801755:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801759:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80175d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801761:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801765:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801769:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80176e:	74 3d                	je     8017ad <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  801770:	eb 1d                	jmp    80178f <strlcpy+0x42>
+      *dst++ = *src++;
+  801772:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801776:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80177a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80177e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801782:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801786:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80178a:	0f b6 12             	movzbl (%rdx),%edx
+  80178d:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80178f:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801794:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801799:	74 0b                	je     8017a6 <strlcpy+0x59>
+  80179b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80179f:	0f b6 00             	movzbl (%rax),%eax
+  8017a2:	84 c0                	test   %al,%al
+  8017a4:	75 cc                	jne    801772 <strlcpy+0x25>
+    *dst = '\0';
+  8017a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017aa:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8017ad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b1:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8017b5:	c9                   	leave
+  8017b6:	c3                   	ret
+
+00000000008017b7 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8017b7:	55                   	push   %rbp
+  8017b8:	48 89 e5             	mov    %rsp,%rbp
+  8017bb:	48 83 ec 30          	sub    $0x30,%rsp
+  8017bf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017c3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017c7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8017cb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017cf:	48 89 c7             	mov    %rax,%rdi
+  8017d2:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  8017d9:	00 00 00 
+  8017dc:	ff d0                	call   *%rax
+  8017de:	48 98                	cltq
+  8017e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8017e4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8017e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017ec:	48 89 d6             	mov    %rdx,%rsi
+  8017ef:	48 89 c7             	mov    %rax,%rdi
+  8017f2:	48 b8 1d 16 80 00 00 	movabs $0x80161d,%rax
+  8017f9:	00 00 00 
+  8017fc:	ff d0                	call   *%rax
+  8017fe:	48 98                	cltq
+  801800:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801804:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801808:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80180c:	75 10                	jne    80181e <strlcat+0x67>
+    return maxlen + srclen;
+  80180e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801812:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801816:	48 01 d0             	add    %rdx,%rax
+  801819:	e9 86 00 00 00       	jmp    8018a4 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80181e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801822:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801826:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  80182a:	73 2b                	jae    801857 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80182c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801830:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801834:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801838:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80183c:	48 01 c1             	add    %rax,%rcx
+  80183f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801843:	48 89 c6             	mov    %rax,%rsi
+  801846:	48 89 cf             	mov    %rcx,%rdi
+  801849:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  801850:	00 00 00 
+  801853:	ff d0                	call   *%rax
+  801855:	eb 42                	jmp    801899 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801857:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80185b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80185f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801863:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801867:	48 01 c1             	add    %rax,%rcx
+  80186a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80186e:	48 89 c6             	mov    %rax,%rsi
+  801871:	48 89 cf             	mov    %rcx,%rdi
+  801874:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  80187b:	00 00 00 
+  80187e:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801880:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801884:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801888:	48 01 d0             	add    %rdx,%rax
+  80188b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80188f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801893:	48 01 d0             	add    %rdx,%rax
+  801896:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801899:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80189d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a1:	48 01 d0             	add    %rdx,%rax
+}
+  8018a4:	c9                   	leave
+  8018a5:	c3                   	ret
+
+00000000008018a6 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8018a6:	55                   	push   %rbp
+  8018a7:	48 89 e5             	mov    %rsp,%rbp
+  8018aa:	48 83 ec 10          	sub    $0x10,%rsp
+  8018ae:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018b2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8018b6:	eb 0a                	jmp    8018c2 <strcmp+0x1c>
+    p++, q++;
+  8018b8:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018bd:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8018c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018c6:	0f b6 00             	movzbl (%rax),%eax
+  8018c9:	84 c0                	test   %al,%al
+  8018cb:	74 12                	je     8018df <strcmp+0x39>
+  8018cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018d1:	0f b6 10             	movzbl (%rax),%edx
+  8018d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018d8:	0f b6 00             	movzbl (%rax),%eax
+  8018db:	38 c2                	cmp    %al,%dl
+  8018dd:	74 d9                	je     8018b8 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8018df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e3:	0f b6 00             	movzbl (%rax),%eax
+  8018e6:	0f b6 d0             	movzbl %al,%edx
+  8018e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018ed:	0f b6 00             	movzbl (%rax),%eax
+  8018f0:	0f b6 c0             	movzbl %al,%eax
+  8018f3:	29 c2                	sub    %eax,%edx
+  8018f5:	89 d0                	mov    %edx,%eax
+}
+  8018f7:	c9                   	leave
+  8018f8:	c3                   	ret
+
+00000000008018f9 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8018f9:	55                   	push   %rbp
+  8018fa:	48 89 e5             	mov    %rsp,%rbp
+  8018fd:	48 83 ec 18          	sub    $0x18,%rsp
+  801901:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801905:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801909:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80190d:	eb 0f                	jmp    80191e <strncmp+0x25>
+    n--, p++, q++;
+  80190f:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801914:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801919:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80191e:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801923:	74 1d                	je     801942 <strncmp+0x49>
+  801925:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801929:	0f b6 00             	movzbl (%rax),%eax
+  80192c:	84 c0                	test   %al,%al
+  80192e:	74 12                	je     801942 <strncmp+0x49>
+  801930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801934:	0f b6 10             	movzbl (%rax),%edx
+  801937:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80193b:	0f b6 00             	movzbl (%rax),%eax
+  80193e:	38 c2                	cmp    %al,%dl
+  801940:	74 cd                	je     80190f <strncmp+0x16>
+  if (n == 0)
+  801942:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801947:	75 07                	jne    801950 <strncmp+0x57>
+    return 0;
+  801949:	ba 00 00 00 00       	mov    $0x0,%edx
+  80194e:	eb 16                	jmp    801966 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801950:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801954:	0f b6 00             	movzbl (%rax),%eax
+  801957:	0f b6 d0             	movzbl %al,%edx
+  80195a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80195e:	0f b6 00             	movzbl (%rax),%eax
+  801961:	0f b6 c0             	movzbl %al,%eax
+  801964:	29 c2                	sub    %eax,%edx
+}
+  801966:	89 d0                	mov    %edx,%eax
+  801968:	c9                   	leave
+  801969:	c3                   	ret
+
+000000000080196a <strchr>:
+strchr(const char *s, char c) {
+  80196a:	55                   	push   %rbp
+  80196b:	48 89 e5             	mov    %rsp,%rbp
+  80196e:	48 83 ec 60          	sub    $0x60,%rsp
+  801972:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801976:	89 f0                	mov    %esi,%eax
+  801978:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  80197b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80197f:	83 e0 0f             	and    $0xf,%eax
+  801982:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801985:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801988:	48 f7 d8             	neg    %rax
+  80198b:	48 89 c2             	mov    %rax,%rdx
+  80198e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801992:	48 01 d0             	add    %rdx,%rax
+  801995:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801999:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80199d:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8019a1:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8019a5:	66 0f 6e c0          	movd   %eax,%xmm0
+  8019a9:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8019ad:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8019b1:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8019b6:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8019ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019be:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8019c2:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8019c6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019cb:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8019d0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019d4:	89 c2                	mov    %eax,%edx
+  8019d6:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019db:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8019e0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019e4:	09 c2                	or     %eax,%edx
+  8019e6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019e9:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8019ee:	89 c1                	mov    %eax,%ecx
+  8019f0:	d3 e6                	shl    %cl,%esi
+  8019f2:	89 f0                	mov    %esi,%eax
+  8019f4:	21 d0                	and    %edx,%eax
+  8019f6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8019f9:	eb 34                	jmp    801a2f <strchr+0xc5>
+    p += 16;
+  8019fb:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801a00:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a04:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801a08:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801a0c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a11:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801a16:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a1a:	89 c2                	mov    %eax,%edx
+  801a1c:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a21:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801a26:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a2a:	09 d0                	or     %edx,%eax
+  801a2c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801a2f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a33:	74 c6                	je     8019fb <strchr+0x91>
+  p += __builtin_ctz(m);
+  801a35:	31 c0                	xor    %eax,%eax
+  801a37:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801a3c:	48 98                	cltq
+  801a3e:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801a42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a46:	0f b6 00             	movzbl (%rax),%eax
+  801a49:	84 c0                	test   %al,%al
+  801a4b:	74 06                	je     801a53 <strchr+0xe9>
+  801a4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a51:	eb 05                	jmp    801a58 <strchr+0xee>
+  801a53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a58:	c9                   	leave
+  801a59:	c3                   	ret
+
+0000000000801a5a <strfind>:
+strfind(const char *s, char c) {
+  801a5a:	55                   	push   %rbp
+  801a5b:	48 89 e5             	mov    %rsp,%rbp
+  801a5e:	48 83 ec 10          	sub    $0x10,%rsp
+  801a62:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a66:	89 f0                	mov    %esi,%eax
+  801a68:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801a6b:	eb 11                	jmp    801a7e <strfind+0x24>
+    if (*s == c)
+  801a6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a71:	0f b6 00             	movzbl (%rax),%eax
+  801a74:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801a77:	74 12                	je     801a8b <strfind+0x31>
+  for (; *s; s++)
+  801a79:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a7e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a82:	0f b6 00             	movzbl (%rax),%eax
+  801a85:	84 c0                	test   %al,%al
+  801a87:	75 e4                	jne    801a6d <strfind+0x13>
+  801a89:	eb 01                	jmp    801a8c <strfind+0x32>
+      break;
+  801a8b:	90                   	nop
+  return (char *)s;
+  801a8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a90:	c9                   	leave
+  801a91:	c3                   	ret
+
+0000000000801a92 <memset>:
+memset(void *v, int c, size_t n) {
+  801a92:	55                   	push   %rbp
+  801a93:	48 89 e5             	mov    %rsp,%rbp
+  801a96:	48 83 ec 38          	sub    $0x38,%rsp
+  801a9a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a9e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801aa1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801aa5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801aa9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801aad:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801ab2:	76 41                	jbe    801af5 <memset+0x63>
+  801ab4:	48 b8 f7 11 80 00 00 	movabs $0x8011f7,%rax
+  801abb:	00 00 00 
+  801abe:	ff d0                	call   *%rax
+  801ac0:	83 e0 01             	and    $0x1,%eax
+  801ac3:	85 c0                	test   %eax,%eax
+  801ac5:	74 2e                	je     801af5 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801ac7:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801aca:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801ace:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ad2:	48 89 ce             	mov    %rcx,%rsi
+  801ad5:	48 89 f7             	mov    %rsi,%rdi
+  801ad8:	48 89 d1             	mov    %rdx,%rcx
+  801adb:	fc                   	cld
+  801adc:	f3 aa                	rep stos %al,%es:(%rdi)
+  801ade:	48 89 ca             	mov    %rcx,%rdx
+  801ae1:	48 89 fe             	mov    %rdi,%rsi
+  801ae4:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801ae8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801aec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801af0:	e9 a7 00 00 00       	jmp    801b9c <memset+0x10a>
+  if (n >= 8) {
+  801af5:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801afa:	0f 86 87 00 00 00    	jbe    801b87 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801b00:	eb 16                	jmp    801b18 <memset+0x86>
+      *p++ = c;
+  801b02:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b06:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b0a:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b0e:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801b11:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801b13:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b1c:	83 e0 07             	and    $0x7,%eax
+  801b1f:	48 85 c0             	test   %rax,%rax
+  801b22:	75 de                	jne    801b02 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801b24:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801b27:	0f b6 c0             	movzbl %al,%eax
+  801b2a:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801b31:	01 01 01 
+  801b34:	48 0f af c2          	imul   %rdx,%rax
+  801b38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801b3c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b40:	48 c1 e8 03          	shr    $0x3,%rax
+  801b44:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801b48:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b4c:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b50:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b54:	48 89 ce             	mov    %rcx,%rsi
+  801b57:	48 89 f7             	mov    %rsi,%rdi
+  801b5a:	48 89 d1             	mov    %rdx,%rcx
+  801b5d:	fc                   	cld
+  801b5e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801b61:	48 89 ca             	mov    %rcx,%rdx
+  801b64:	48 89 fe             	mov    %rdi,%rsi
+  801b67:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801b6b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801b6f:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801b74:	eb 11                	jmp    801b87 <memset+0xf5>
+    *p++ = c;
+  801b76:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b7a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b7e:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b82:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801b85:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801b87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b8b:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b8f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b93:	48 85 c0             	test   %rax,%rax
+  801b96:	75 de                	jne    801b76 <memset+0xe4>
+  return v;
+  801b98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b9c:	c9                   	leave
+  801b9d:	c3                   	ret
+
+0000000000801b9e <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801b9e:	55                   	push   %rbp
+  801b9f:	48 89 e5             	mov    %rsp,%rbp
+  801ba2:	48 83 ec 38          	sub    $0x38,%rsp
+  801ba6:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801baa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801bae:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801bb2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bb6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801bba:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bbe:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801bc2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bc6:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801bca:	0f 83 da 00 00 00    	jae    801caa <memmove+0x10c>
+  801bd0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bd4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bd8:	48 01 d0             	add    %rdx,%rax
+  801bdb:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801bdf:	0f 83 c5 00 00 00    	jae    801caa <memmove+0x10c>
+    s += n;
+  801be5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801be9:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801bed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bf1:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801bf5:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801bfa:	0f 86 94 00 00 00    	jbe    801c94 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801c00:	eb 1c                	jmp    801c1e <memmove+0x80>
+        *--d = *--s;
+  801c02:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801c07:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801c0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c10:	0f b6 10             	movzbl (%rax),%edx
+  801c13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c17:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c19:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c22:	83 e0 07             	and    $0x7,%eax
+  801c25:	48 85 c0             	test   %rax,%rax
+  801c28:	75 d8                	jne    801c02 <memmove+0x64>
+      nq = n / 8;
+  801c2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c2e:	48 c1 e8 03          	shr    $0x3,%rax
+  801c32:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801c36:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801c3b:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801c40:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801c45:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c49:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c4d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c51:	48 89 cf             	mov    %rcx,%rdi
+  801c54:	48 89 d6             	mov    %rdx,%rsi
+  801c57:	48 89 c1             	mov    %rax,%rcx
+  801c5a:	fd                   	std
+  801c5b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c5e:	fc                   	cld
+  801c5f:	48 89 c8             	mov    %rcx,%rax
+  801c62:	48 89 f2             	mov    %rsi,%rdx
+  801c65:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c69:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c6d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801c71:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801c76:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801c7b:	eb 17                	jmp    801c94 <memmove+0xf6>
+      *--d = *--s;
+  801c7d:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801c82:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801c87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c8b:	0f b6 10             	movzbl (%rax),%edx
+  801c8e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c92:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801c94:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c98:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c9c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ca0:	48 85 c0             	test   %rax,%rax
+  801ca3:	75 d8                	jne    801c7d <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801ca5:	e9 f4 00 00 00       	jmp    801d9e <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801caa:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801caf:	76 46                	jbe    801cf7 <memmove+0x159>
+  801cb1:	48 b8 f7 11 80 00 00 	movabs $0x8011f7,%rax
+  801cb8:	00 00 00 
+  801cbb:	ff d0                	call   *%rax
+  801cbd:	83 e0 01             	and    $0x1,%eax
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	74 33                	je     801cf7 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801cc4:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cc8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ccc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cd0:	48 89 cf             	mov    %rcx,%rdi
+  801cd3:	48 89 d6             	mov    %rdx,%rsi
+  801cd6:	48 89 c1             	mov    %rax,%rcx
+  801cd9:	fc                   	cld
+  801cda:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801cdc:	48 89 c8             	mov    %rcx,%rax
+  801cdf:	48 89 f2             	mov    %rsi,%rdx
+  801ce2:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ce6:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801cee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cf2:	e9 ab 00 00 00       	jmp    801da2 <memmove+0x204>
+    if (n >= 8) {
+  801cf7:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801cfc:	0f 86 8b 00 00 00    	jbe    801d8d <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801d02:	eb 22                	jmp    801d26 <memmove+0x188>
+        *d++ = *s++;
+  801d04:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d08:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801d0c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d10:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d14:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d18:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801d1c:	0f b6 12             	movzbl (%rdx),%edx
+  801d1f:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801d21:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801d26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d2a:	83 e0 07             	and    $0x7,%eax
+  801d2d:	48 85 c0             	test   %rax,%rax
+  801d30:	75 d2                	jne    801d04 <memmove+0x166>
+      nq = n / 8;
+  801d32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d36:	48 c1 e8 03          	shr    $0x3,%rax
+  801d3a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801d3e:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d42:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d46:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d4a:	48 89 cf             	mov    %rcx,%rdi
+  801d4d:	48 89 d6             	mov    %rdx,%rsi
+  801d50:	48 89 c1             	mov    %rax,%rcx
+  801d53:	fc                   	cld
+  801d54:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801d57:	48 89 c8             	mov    %rcx,%rax
+  801d5a:	48 89 f2             	mov    %rsi,%rdx
+  801d5d:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801d61:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d65:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801d69:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801d6e:	eb 1d                	jmp    801d8d <memmove+0x1ef>
+      *d++ = *s++;
+  801d70:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d74:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801d78:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d7c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d80:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d84:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801d88:	0f b6 12             	movzbl (%rdx),%edx
+  801d8b:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801d8d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d91:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d95:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d99:	48 85 c0             	test   %rax,%rax
+  801d9c:	75 d2                	jne    801d70 <memmove+0x1d2>
+  return dst;
+  801d9e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801da2:	c9                   	leave
+  801da3:	c3                   	ret
+
+0000000000801da4 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801da4:	55                   	push   %rbp
+  801da5:	48 89 e5             	mov    %rsp,%rbp
+  801da8:	48 83 ec 18          	sub    $0x18,%rsp
+  801dac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801db0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801db4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801db8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dbc:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801dc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dc4:	48 89 ce             	mov    %rcx,%rsi
+  801dc7:	48 89 c7             	mov    %rax,%rdi
+  801dca:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  801dd1:	00 00 00 
+  801dd4:	ff d0                	call   *%rax
+}
+  801dd6:	c9                   	leave
+  801dd7:	c3                   	ret
+
+0000000000801dd8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801dd8:	55                   	push   %rbp
+  801dd9:	48 89 e5             	mov    %rsp,%rbp
+  801ddc:	48 83 ec 40          	sub    $0x40,%rsp
+  801de0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801de4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801de8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801dec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801df0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801df4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801df8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801dfc:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801e01:	0f 86 a7 00 00 00    	jbe    801eae <memcmp+0xd6>
+  801e07:	48 b8 f7 11 80 00 00 	movabs $0x8011f7,%rax
+  801e0e:	00 00 00 
+  801e11:	ff d0                	call   *%rax
+  801e13:	83 e0 02             	and    $0x2,%eax
+  801e16:	85 c0                	test   %eax,%eax
+  801e18:	0f 84 90 00 00 00    	je     801eae <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801e1e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e22:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e26:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e2a:	48 89 ce             	mov    %rcx,%rsi
+  801e2d:	48 89 c7             	mov    %rax,%rdi
+  801e30:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  801e37:	00 00 00 
+  801e3a:	ff d0                	call   *%rax
+  801e3c:	e9 c2 00 00 00       	jmp    801f03 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801e41:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e45:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e49:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801e4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e51:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e55:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801e59:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801e5d:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801e60:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801e67:	74 36                	je     801e9f <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801e69:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e6c:	f7 d0                	not    %eax
+  801e6e:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801e72:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801e75:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801e78:	48 63 d0             	movslq %eax,%rdx
+  801e7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e7f:	48 01 d0             	add    %rdx,%rax
+  801e82:	0f b6 00             	movzbl (%rax),%eax
+  801e85:	0f b6 c0             	movzbl %al,%eax
+  801e88:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801e8b:	48 63 ca             	movslq %edx,%rcx
+  801e8e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e92:	48 01 ca             	add    %rcx,%rdx
+  801e95:	0f b6 12             	movzbl (%rdx),%edx
+  801e98:	0f b6 d2             	movzbl %dl,%edx
+  801e9b:	29 d0                	sub    %edx,%eax
+  801e9d:	eb 64                	jmp    801f03 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801e9f:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801ea4:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801ea9:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801eae:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801eb3:	77 8c                	ja     801e41 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801eb5:	eb 36                	jmp    801eed <memcmp+0x115>
+    if (*s1 != *s2)
+  801eb7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ebb:	0f b6 10             	movzbl (%rax),%edx
+  801ebe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ec2:	0f b6 00             	movzbl (%rax),%eax
+  801ec5:	38 c2                	cmp    %al,%dl
+  801ec7:	74 1a                	je     801ee3 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801ec9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ecd:	0f b6 00             	movzbl (%rax),%eax
+  801ed0:	0f b6 c8             	movzbl %al,%ecx
+  801ed3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ed7:	0f b6 00             	movzbl (%rax),%eax
+  801eda:	0f b6 d0             	movzbl %al,%edx
+  801edd:	89 c8                	mov    %ecx,%eax
+  801edf:	29 d0                	sub    %edx,%eax
+  801ee1:	eb 20                	jmp    801f03 <memcmp+0x12b>
+    s1++, s2++;
+  801ee3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ee8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801eed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ef1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ef5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ef9:	48 85 c0             	test   %rax,%rax
+  801efc:	75 b9                	jne    801eb7 <memcmp+0xdf>
+  }
+
+  return 0;
+  801efe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f03:	c9                   	leave
+  801f04:	c3                   	ret
+
+0000000000801f05 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	48 83 ec 50          	sub    $0x50,%rsp
+  801f0d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801f11:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801f14:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801f18:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f1c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801f20:	48 01 d0             	add    %rdx,%rax
+  801f23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801f27:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f2a:	66 0f 6e c0          	movd   %eax,%xmm0
+  801f2e:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801f32:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801f36:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801f3b:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801f3f:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801f44:	76 73                	jbe    801fb9 <memfind+0xb4>
+  801f46:	48 b8 f7 11 80 00 00 	movabs $0x8011f7,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+  801f52:	83 e0 02             	and    $0x2,%eax
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	74 60                	je     801fb9 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801f59:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f5c:	0f b6 c8             	movzbl %al,%ecx
+  801f5f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801f63:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f67:	89 ce                	mov    %ecx,%esi
+  801f69:	48 89 c7             	mov    %rax,%rdi
+  801f6c:	48 b8 ae 14 80 00 00 	movabs $0x8014ae,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	eb 6c                	jmp    801fe6 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801f7a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f7e:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801f82:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801f86:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801f8b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801f8f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f93:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801f96:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801f9a:	74 13                	je     801faf <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801f9c:	31 c0                	xor    %eax,%eax
+  801f9e:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801fa3:	48 63 d0             	movslq %eax,%rdx
+  801fa6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801faa:	48 01 d0             	add    %rdx,%rax
+  801fad:	eb 37                	jmp    801fe6 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801faf:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801fb4:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801fb9:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801fbe:	77 ba                	ja     801f7a <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801fc0:	eb 13                	jmp    801fd5 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801fc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fc6:	0f b6 00             	movzbl (%rax),%eax
+  801fc9:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801fcc:	38 d0                	cmp    %dl,%al
+  801fce:	74 11                	je     801fe1 <memfind+0xdc>
+  for (; s < ends; s++)
+  801fd0:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801fd5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fd9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801fdd:	72 e3                	jb     801fc2 <memfind+0xbd>
+  801fdf:	eb 01                	jmp    801fe2 <memfind+0xdd>
+      break;
+  801fe1:	90                   	nop
+  return (void *)s;
+  801fe2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801fe6:	c9                   	leave
+  801fe7:	c3                   	ret
+
+0000000000801fe8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801fe8:	55                   	push   %rbp
+  801fe9:	48 89 e5             	mov    %rsp,%rbp
+  801fec:	48 83 ec 38          	sub    $0x38,%rsp
+  801ff0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ff4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801ff8:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801ffb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802002:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802009:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80200a:	eb 05                	jmp    802011 <strtol+0x29>
+    s++;
+  80200c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  802011:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802015:	0f b6 00             	movzbl (%rax),%eax
+  802018:	3c 20                	cmp    $0x20,%al
+  80201a:	74 f0                	je     80200c <strtol+0x24>
+  80201c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802020:	0f b6 00             	movzbl (%rax),%eax
+  802023:	3c 09                	cmp    $0x9,%al
+  802025:	74 e5                	je     80200c <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802027:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80202b:	0f b6 00             	movzbl (%rax),%eax
+  80202e:	3c 2b                	cmp    $0x2b,%al
+  802030:	75 07                	jne    802039 <strtol+0x51>
+    s++;
+  802032:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802037:	eb 17                	jmp    802050 <strtol+0x68>
+  else if (*s == '-')
+  802039:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80203d:	0f b6 00             	movzbl (%rax),%eax
+  802040:	3c 2d                	cmp    $0x2d,%al
+  802042:	75 0c                	jne    802050 <strtol+0x68>
+    s++, neg = 1;
+  802044:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802049:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802050:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802054:	74 06                	je     80205c <strtol+0x74>
+  802056:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  80205a:	75 28                	jne    802084 <strtol+0x9c>
+  80205c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802060:	0f b6 00             	movzbl (%rax),%eax
+  802063:	3c 30                	cmp    $0x30,%al
+  802065:	75 1d                	jne    802084 <strtol+0x9c>
+  802067:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80206b:	48 83 c0 01          	add    $0x1,%rax
+  80206f:	0f b6 00             	movzbl (%rax),%eax
+  802072:	3c 78                	cmp    $0x78,%al
+  802074:	75 0e                	jne    802084 <strtol+0x9c>
+    s += 2, base = 16;
+  802076:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  80207b:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802082:	eb 2c                	jmp    8020b0 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  802084:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802088:	75 19                	jne    8020a3 <strtol+0xbb>
+  80208a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80208e:	0f b6 00             	movzbl (%rax),%eax
+  802091:	3c 30                	cmp    $0x30,%al
+  802093:	75 0e                	jne    8020a3 <strtol+0xbb>
+    s++, base = 8;
+  802095:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  80209a:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8020a1:	eb 0d                	jmp    8020b0 <strtol+0xc8>
+  else if (base == 0)
+  8020a3:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020a7:	75 07                	jne    8020b0 <strtol+0xc8>
+    base = 10;
+  8020a9:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  8020b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020b4:	0f b6 00             	movzbl (%rax),%eax
+  8020b7:	3c 2f                	cmp    $0x2f,%al
+  8020b9:	7e 1d                	jle    8020d8 <strtol+0xf0>
+  8020bb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020bf:	0f b6 00             	movzbl (%rax),%eax
+  8020c2:	3c 39                	cmp    $0x39,%al
+  8020c4:	7f 12                	jg     8020d8 <strtol+0xf0>
+      dig = *s - '0';
+  8020c6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ca:	0f b6 00             	movzbl (%rax),%eax
+  8020cd:	0f be c0             	movsbl %al,%eax
+  8020d0:	83 e8 30             	sub    $0x30,%eax
+  8020d3:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8020d6:	eb 4e                	jmp    802126 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  8020d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020dc:	0f b6 00             	movzbl (%rax),%eax
+  8020df:	3c 60                	cmp    $0x60,%al
+  8020e1:	7e 1d                	jle    802100 <strtol+0x118>
+  8020e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020e7:	0f b6 00             	movzbl (%rax),%eax
+  8020ea:	3c 7a                	cmp    $0x7a,%al
+  8020ec:	7f 12                	jg     802100 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  8020ee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020f2:	0f b6 00             	movzbl (%rax),%eax
+  8020f5:	0f be c0             	movsbl %al,%eax
+  8020f8:	83 e8 57             	sub    $0x57,%eax
+  8020fb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8020fe:	eb 26                	jmp    802126 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  802100:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802104:	0f b6 00             	movzbl (%rax),%eax
+  802107:	3c 40                	cmp    $0x40,%al
+  802109:	7e 47                	jle    802152 <strtol+0x16a>
+  80210b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80210f:	0f b6 00             	movzbl (%rax),%eax
+  802112:	3c 5a                	cmp    $0x5a,%al
+  802114:	7f 3c                	jg     802152 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802116:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80211a:	0f b6 00             	movzbl (%rax),%eax
+  80211d:	0f be c0             	movsbl %al,%eax
+  802120:	83 e8 37             	sub    $0x37,%eax
+  802123:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802126:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802129:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80212c:	7d 23                	jge    802151 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80212e:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802133:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802136:	48 98                	cltq
+  802138:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80213d:	48 89 c2             	mov    %rax,%rdx
+  802140:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802143:	48 98                	cltq
+  802145:	48 01 d0             	add    %rdx,%rax
+  802148:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80214c:	e9 5f ff ff ff       	jmp    8020b0 <strtol+0xc8>
+      break;
+  802151:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802152:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802157:	74 0b                	je     802164 <strtol+0x17c>
+    *endptr = (char *)s;
+  802159:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80215d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802161:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802164:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802168:	74 09                	je     802173 <strtol+0x18b>
+  80216a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80216e:	48 f7 d8             	neg    %rax
+  802171:	eb 04                	jmp    802177 <strtol+0x18f>
+  802173:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+
+0000000000802179 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802179:	55                   	push   %rbp
+  80217a:	48 89 e5             	mov    %rsp,%rbp
+  80217d:	53                   	push   %rbx
+  80217e:	48 83 ec 48          	sub    $0x48,%rsp
+  802182:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802186:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80218a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80218e:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802192:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802196:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  80219a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80219e:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8021a2:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8021a6:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8021aa:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8021ae:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8021b2:	4c 89 c3             	mov    %r8,%rbx
+  8021b5:	cd 30                	int    $0x30
+  8021b7:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  8021bb:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8021c0:	74 46                	je     802208 <syscall+0x8f>
+  8021c2:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8021c7:	7e 3f                	jle    802208 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  8021c9:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8021cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021d1:	49 89 d0             	mov    %rdx,%r8
+  8021d4:	48 89 c1             	mov    %rax,%rcx
+  8021d7:	48 b8 c8 6c 80 00 00 	movabs $0x806cc8,%rax
+  8021de:	00 00 00 
+  8021e1:	48 89 c2             	mov    %rax,%rdx
+  8021e4:	be 22 00 00 00       	mov    $0x22,%esi
+  8021e9:	48 b8 e7 6c 80 00 00 	movabs $0x806ce7,%rax
+  8021f0:	00 00 00 
+  8021f3:	48 89 c7             	mov    %rax,%rdi
+  8021f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fb:	49 b9 8c 04 80 00 00 	movabs $0x80048c,%r9
+  802202:	00 00 00 
+  802205:	41 ff d1             	call   *%r9
+
+  return ret;
+  802208:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80220c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802210:	c9                   	leave
+  802211:	c3                   	ret
+
+0000000000802212 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802212:	55                   	push   %rbp
+  802213:	48 89 e5             	mov    %rsp,%rbp
+  802216:	48 83 ec 10          	sub    $0x10,%rsp
+  80221a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80221e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802222:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802226:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80222a:	48 83 ec 08          	sub    $0x8,%rsp
+  80222e:	6a 00                	push   $0x0
+  802230:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802236:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80223c:	48 89 d1             	mov    %rdx,%rcx
+  80223f:	48 89 c2             	mov    %rax,%rdx
+  802242:	be 00 00 00 00       	mov    $0x0,%esi
+  802247:	bf 00 00 00 00       	mov    $0x0,%edi
+  80224c:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802253:	00 00 00 
+  802256:	ff d0                	call   *%rax
+  802258:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80225c:	90                   	nop
+  80225d:	c9                   	leave
+  80225e:	c3                   	ret
+
+000000000080225f <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80225f:	55                   	push   %rbp
+  802260:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802263:	48 83 ec 08          	sub    $0x8,%rsp
+  802267:	6a 00                	push   $0x0
+  802269:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80226f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802275:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80227a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80227f:	be 00 00 00 00       	mov    $0x0,%esi
+  802284:	bf 01 00 00 00       	mov    $0x1,%edi
+  802289:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802290:	00 00 00 
+  802293:	ff d0                	call   *%rax
+  802295:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802299:	c9                   	leave
+  80229a:	c3                   	ret
+
+000000000080229b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80229b:	55                   	push   %rbp
+  80229c:	48 89 e5             	mov    %rsp,%rbp
+  80229f:	48 83 ec 10          	sub    $0x10,%rsp
+  8022a3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8022a6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022a9:	48 98                	cltq
+  8022ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8022af:	6a 00                	push   $0x0
+  8022b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c2:	48 89 c2             	mov    %rax,%rdx
+  8022c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ca:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022cf:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+  8022db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022df:	c9                   	leave
+  8022e0:	c3                   	ret
+
+00000000008022e1 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8022e1:	55                   	push   %rbp
+  8022e2:	48 89 e5             	mov    %rsp,%rbp
+  8022e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8022e9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8022ec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022ef:	48 98                	cltq
+  8022f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8022f5:	6a 00                	push   $0x0
+  8022f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802303:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802308:	48 89 c2             	mov    %rax,%rdx
+  80230b:	be 00 00 00 00       	mov    $0x0,%esi
+  802310:	bf 04 00 00 00       	mov    $0x4,%edi
+  802315:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+  802321:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802325:	90                   	nop
+  802326:	c9                   	leave
+  802327:	c3                   	ret
+
+0000000000802328 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802328:	55                   	push   %rbp
+  802329:	48 89 e5             	mov    %rsp,%rbp
+  80232c:	48 83 ec 20          	sub    $0x20,%rsp
+  802330:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802333:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802337:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80233a:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80233d:	b8 05 00 00 00       	mov    $0x5,%eax
+  802342:	cd 30                	int    $0x30
+  802344:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802348:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80234c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802351:	7e 3d                	jle    802390 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802353:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802357:	49 89 c0             	mov    %rax,%r8
+  80235a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80235f:	48 b8 c8 6c 80 00 00 	movabs $0x806cc8,%rax
+  802366:	00 00 00 
+  802369:	48 89 c2             	mov    %rax,%rdx
+  80236c:	be 49 00 00 00       	mov    $0x49,%esi
+  802371:	48 b8 e7 6c 80 00 00 	movabs $0x806ce7,%rax
+  802378:	00 00 00 
+  80237b:	48 89 c7             	mov    %rax,%rdi
+  80237e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802383:	49 b9 8c 04 80 00 00 	movabs $0x80048c,%r9
+  80238a:	00 00 00 
+  80238d:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  802390:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802395:	75 13                	jne    8023aa <sys_env_wait+0x82>
+  802397:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80239c:	74 0c                	je     8023aa <sys_env_wait+0x82>
+    *status = st;
+  80239e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023a2:	89 c2                	mov    %eax,%edx
+  8023a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023a8:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8023aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8023ae:	c9                   	leave
+  8023af:	c3                   	ret
+
+00000000008023b0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8023b0:	55                   	push   %rbp
+  8023b1:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8023b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8023b8:	6a 00                	push   $0x0
+  8023ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8023d5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023da:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8023e1:	00 00 00 
+  8023e4:	ff d0                	call   *%rax
+  8023e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023ea:	c9                   	leave
+  8023eb:	c3                   	ret
+
+00000000008023ec <sys_yield>:
+
+void
+sys_yield(void) {
+  8023ec:	55                   	push   %rbp
+  8023ed:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8023f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8023f4:	6a 00                	push   $0x0
+  8023f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802402:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802407:	ba 00 00 00 00       	mov    $0x0,%edx
+  80240c:	be 00 00 00 00       	mov    $0x0,%esi
+  802411:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802416:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  80241d:	00 00 00 
+  802420:	ff d0                	call   *%rax
+  802422:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802426:	90                   	nop
+  802427:	c9                   	leave
+  802428:	c3                   	ret
+
+0000000000802429 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802429:	55                   	push   %rbp
+  80242a:	48 89 e5             	mov    %rsp,%rbp
+  80242d:	48 83 ec 20          	sub    $0x20,%rsp
+  802431:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802434:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802438:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  80243b:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80243e:	48 63 c8             	movslq %eax,%rcx
+  802441:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802445:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802448:	48 98                	cltq
+  80244a:	48 83 ec 08          	sub    $0x8,%rsp
+  80244e:	6a 00                	push   $0x0
+  802450:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802456:	49 89 c8             	mov    %rcx,%r8
+  802459:	48 89 d1             	mov    %rdx,%rcx
+  80245c:	48 89 c2             	mov    %rax,%rdx
+  80245f:	be 01 00 00 00       	mov    $0x1,%esi
+  802464:	bf 06 00 00 00       	mov    $0x6,%edi
+  802469:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802470:	00 00 00 
+  802473:	ff d0                	call   *%rax
+  802475:	48 83 c4 10          	add    $0x10,%rsp
+  802479:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80247c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80247f:	c9                   	leave
+  802480:	c3                   	ret
+
+0000000000802481 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802481:	55                   	push   %rbp
+  802482:	48 89 e5             	mov    %rsp,%rbp
+  802485:	48 83 ec 20          	sub    $0x20,%rsp
+  802489:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80248c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802490:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802493:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802497:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80249b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80249e:	48 63 c8             	movslq %eax,%rcx
+  8024a1:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8024a5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8024a8:	48 63 f0             	movslq %eax,%rsi
+  8024ab:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024af:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024b2:	48 98                	cltq
+  8024b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b8:	51                   	push   %rcx
+  8024b9:	49 89 f9             	mov    %rdi,%r9
+  8024bc:	49 89 f0             	mov    %rsi,%r8
+  8024bf:	48 89 d1             	mov    %rdx,%rcx
+  8024c2:	48 89 c2             	mov    %rax,%rdx
+  8024c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8024ca:	bf 07 00 00 00       	mov    $0x7,%edi
+  8024cf:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8024d6:	00 00 00 
+  8024d9:	ff d0                	call   *%rax
+  8024db:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024df:	c9                   	leave
+  8024e0:	c3                   	ret
+
+00000000008024e1 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8024e1:	55                   	push   %rbp
+  8024e2:	48 89 e5             	mov    %rsp,%rbp
+  8024e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8024e9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ec:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8024f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024f7:	48 98                	cltq
+  8024f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8024fd:	6a 00                	push   $0x0
+  8024ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802505:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80250b:	48 89 d1             	mov    %rdx,%rcx
+  80250e:	48 89 c2             	mov    %rax,%rdx
+  802511:	be 01 00 00 00       	mov    $0x1,%esi
+  802516:	bf 08 00 00 00       	mov    $0x8,%edi
+  80251b:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+  802527:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80252b:	c9                   	leave
+  80252c:	c3                   	ret
+
+000000000080252d <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80252d:	55                   	push   %rbp
+  80252e:	48 89 e5             	mov    %rsp,%rbp
+  802531:	48 83 ec 10          	sub    $0x10,%rsp
+  802535:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802538:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  80253b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80253e:	48 63 d0             	movslq %eax,%rdx
+  802541:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802544:	48 98                	cltq
+  802546:	48 83 ec 08          	sub    $0x8,%rsp
+  80254a:	6a 00                	push   $0x0
+  80254c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802552:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802558:	48 89 d1             	mov    %rdx,%rcx
+  80255b:	48 89 c2             	mov    %rax,%rdx
+  80255e:	be 01 00 00 00       	mov    $0x1,%esi
+  802563:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802568:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  80256f:	00 00 00 
+  802572:	ff d0                	call   *%rax
+  802574:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802578:	c9                   	leave
+  802579:	c3                   	ret
+
+000000000080257a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80257a:	55                   	push   %rbp
+  80257b:	48 89 e5             	mov    %rsp,%rbp
+  80257e:	48 83 ec 10          	sub    $0x10,%rsp
+  802582:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802585:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802589:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80258d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802590:	48 98                	cltq
+  802592:	48 83 ec 08          	sub    $0x8,%rsp
+  802596:	6a 00                	push   $0x0
+  802598:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80259e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025a4:	48 89 d1             	mov    %rdx,%rcx
+  8025a7:	48 89 c2             	mov    %rax,%rdx
+  8025aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8025af:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8025b4:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8025bb:	00 00 00 
+  8025be:	ff d0                	call   *%rax
+  8025c0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025c4:	c9                   	leave
+  8025c5:	c3                   	ret
+
+00000000008025c6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8025c6:	55                   	push   %rbp
+  8025c7:	48 89 e5             	mov    %rsp,%rbp
+  8025ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8025d5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025d9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025dc:	48 98                	cltq
+  8025de:	48 83 ec 08          	sub    $0x8,%rsp
+  8025e2:	6a 00                	push   $0x0
+  8025e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025f0:	48 89 d1             	mov    %rdx,%rcx
+  8025f3:	48 89 c2             	mov    %rax,%rdx
+  8025f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8025fb:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802600:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802607:	00 00 00 
+  80260a:	ff d0                	call   *%rax
+  80260c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802610:	c9                   	leave
+  802611:	c3                   	ret
+
+0000000000802612 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802612:	55                   	push   %rbp
+  802613:	48 89 e5             	mov    %rsp,%rbp
+  802616:	48 83 ec 20          	sub    $0x20,%rsp
+  80261a:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80261d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802621:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802625:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802628:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80262b:	48 63 f0             	movslq %eax,%rsi
+  80262e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802632:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802636:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802639:	48 98                	cltq
+  80263b:	48 83 ec 08          	sub    $0x8,%rsp
+  80263f:	6a 00                	push   $0x0
+  802641:	49 89 f1             	mov    %rsi,%r9
+  802644:	49 89 c8             	mov    %rcx,%r8
+  802647:	48 89 d1             	mov    %rdx,%rcx
+  80264a:	48 89 c2             	mov    %rax,%rdx
+  80264d:	be 00 00 00 00       	mov    $0x0,%esi
+  802652:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802657:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  80265e:	00 00 00 
+  802661:	ff d0                	call   *%rax
+  802663:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802667:	c9                   	leave
+  802668:	c3                   	ret
+
+0000000000802669 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802669:	55                   	push   %rbp
+  80266a:	48 89 e5             	mov    %rsp,%rbp
+  80266d:	48 83 ec 10          	sub    $0x10,%rsp
+  802671:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802675:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802679:	48 83 ec 08          	sub    $0x8,%rsp
+  80267d:	6a 00                	push   $0x0
+  80267f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802685:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80268b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802690:	48 89 c2             	mov    %rax,%rdx
+  802693:	be 01 00 00 00       	mov    $0x1,%esi
+  802698:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80269d:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8026a4:	00 00 00 
+  8026a7:	ff d0                	call   *%rax
+  8026a9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026ad:	c9                   	leave
+  8026ae:	c3                   	ret
+
+00000000008026af <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8026af:	55                   	push   %rbp
+  8026b0:	48 89 e5             	mov    %rsp,%rbp
+  8026b3:	48 83 ec 10          	sub    $0x10,%rsp
+  8026b7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026bb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8026bf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8026cb:	6a 00                	push   $0x0
+  8026cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026d9:	48 89 d1             	mov    %rdx,%rcx
+  8026dc:	48 89 c2             	mov    %rax,%rdx
+  8026df:	be 01 00 00 00       	mov    $0x1,%esi
+  8026e4:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026e9:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8026f0:	00 00 00 
+  8026f3:	ff d0                	call   *%rax
+  8026f5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026f9:	c9                   	leave
+  8026fa:	c3                   	ret
+
+00000000008026fb <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8026fb:	55                   	push   %rbp
+  8026fc:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8026ff:	48 83 ec 08          	sub    $0x8,%rsp
+  802703:	6a 00                	push   $0x0
+  802705:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80270b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802711:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802716:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271b:	be 00 00 00 00       	mov    $0x0,%esi
+  802720:	bf 11 00 00 00       	mov    $0x11,%edi
+  802725:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  80272c:	00 00 00 
+  80272f:	ff d0                	call   *%rax
+  802731:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802735:	c9                   	leave
+  802736:	c3                   	ret
+
+0000000000802737 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802737:	55                   	push   %rbp
+  802738:	48 89 e5             	mov    %rsp,%rbp
+  80273b:	48 83 ec 10          	sub    $0x10,%rsp
+  80273f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802743:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802747:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80274b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80274f:	48 83 ec 08          	sub    $0x8,%rsp
+  802753:	6a 00                	push   $0x0
+  802755:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80275b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802761:	48 89 d1             	mov    %rdx,%rcx
+  802764:	48 89 c2             	mov    %rax,%rdx
+  802767:	be 00 00 00 00       	mov    $0x0,%esi
+  80276c:	bf 12 00 00 00       	mov    $0x12,%edi
+  802771:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802778:	00 00 00 
+  80277b:	ff d0                	call   *%rax
+  80277d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802781:	c9                   	leave
+  802782:	c3                   	ret
+
+0000000000802783 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802783:	55                   	push   %rbp
+  802784:	48 89 e5             	mov    %rsp,%rbp
+  802787:	48 83 ec 20          	sub    $0x20,%rsp
+  80278b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80278f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802793:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802796:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802799:	48 63 c8             	movslq %eax,%rcx
+  80279c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a8:	6a 00                	push   $0x0
+  8027aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027b0:	49 89 c8             	mov    %rcx,%r8
+  8027b3:	48 89 d1             	mov    %rdx,%rcx
+  8027b6:	48 89 c2             	mov    %rax,%rdx
+  8027b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8027be:	bf 13 00 00 00       	mov    $0x13,%edi
+  8027c3:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8027ca:	00 00 00 
+  8027cd:	ff d0                	call   *%rax
+  8027cf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027d3:	c9                   	leave
+  8027d4:	c3                   	ret
+
+00000000008027d5 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8027d5:	55                   	push   %rbp
+  8027d6:	48 89 e5             	mov    %rsp,%rbp
+  8027d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8027dd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027e1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8027e4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8027e8:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027ec:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8027ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8027f7:	6a 00                	push   $0x0
+  8027f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027ff:	49 89 c8             	mov    %rcx,%r8
+  802802:	48 89 d1             	mov    %rdx,%rcx
+  802805:	48 89 c2             	mov    %rax,%rdx
+  802808:	be 00 00 00 00       	mov    $0x0,%esi
+  80280d:	bf 14 00 00 00       	mov    $0x14,%edi
+  802812:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802819:	00 00 00 
+  80281c:	ff d0                	call   *%rax
+  80281e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802822:	c9                   	leave
+  802823:	c3                   	ret
+
+0000000000802824 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802824:	55                   	push   %rbp
+  802825:	48 89 e5             	mov    %rsp,%rbp
+  802828:	48 83 ec 10          	sub    $0x10,%rsp
+  80282c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802830:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802833:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802836:	48 63 d0             	movslq %eax,%rdx
+  802839:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80283d:	48 83 ec 08          	sub    $0x8,%rsp
+  802841:	6a 00                	push   $0x0
+  802843:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802849:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80284f:	48 89 d1             	mov    %rdx,%rcx
+  802852:	48 89 c2             	mov    %rax,%rdx
+  802855:	be 00 00 00 00       	mov    $0x0,%esi
+  80285a:	bf 15 00 00 00       	mov    $0x15,%edi
+  80285f:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802866:	00 00 00 
+  802869:	ff d0                	call   *%rax
+  80286b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80286f:	c9                   	leave
+  802870:	c3                   	ret
+
+0000000000802871 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802871:	55                   	push   %rbp
+  802872:	48 89 e5             	mov    %rsp,%rbp
+  802875:	48 83 ec 20          	sub    $0x20,%rsp
+  802879:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80287d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802880:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802883:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802887:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80288b:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80288e:	48 63 c8             	movslq %eax,%rcx
+  802891:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802894:	48 63 d0             	movslq %eax,%rdx
+  802897:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80289b:	48 83 ec 08          	sub    $0x8,%rsp
+  80289f:	6a 00                	push   $0x0
+  8028a1:	49 89 f1             	mov    %rsi,%r9
+  8028a4:	49 89 c8             	mov    %rcx,%r8
+  8028a7:	48 89 d1             	mov    %rdx,%rcx
+  8028aa:	48 89 c2             	mov    %rax,%rdx
+  8028ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8028b2:	bf 16 00 00 00       	mov    $0x16,%edi
+  8028b7:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8028be:	00 00 00 
+  8028c1:	ff d0                	call   *%rax
+  8028c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028c7:	c9                   	leave
+  8028c8:	c3                   	ret
+
+00000000008028c9 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8028c9:	55                   	push   %rbp
+  8028ca:	48 89 e5             	mov    %rsp,%rbp
+  8028cd:	48 83 ec 30          	sub    $0x30,%rsp
+  8028d1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028d5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028d9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8028dd:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8028e1:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8028e5:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8028e9:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8028ed:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8028f1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028fd:	51                   	push   %rcx
+  8028fe:	49 89 f9             	mov    %rdi,%r9
+  802901:	49 89 f0             	mov    %rsi,%r8
+  802904:	48 89 d1             	mov    %rdx,%rcx
+  802907:	48 89 c2             	mov    %rax,%rdx
+  80290a:	be 00 00 00 00       	mov    $0x0,%esi
+  80290f:	bf 17 00 00 00       	mov    $0x17,%edi
+  802914:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  80291b:	00 00 00 
+  80291e:	ff d0                	call   *%rax
+  802920:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802924:	c9                   	leave
+  802925:	c3                   	ret
+
+0000000000802926 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802926:	55                   	push   %rbp
+  802927:	48 89 e5             	mov    %rsp,%rbp
+  80292a:	48 83 ec 10          	sub    $0x10,%rsp
+  80292e:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802931:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802934:	48 98                	cltq
+  802936:	48 83 ec 08          	sub    $0x8,%rsp
+  80293a:	6a 00                	push   $0x0
+  80293c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802942:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802948:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80294d:	48 89 c2             	mov    %rax,%rdx
+  802950:	be 00 00 00 00       	mov    $0x0,%esi
+  802955:	bf 18 00 00 00       	mov    $0x18,%edi
+  80295a:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802961:	00 00 00 
+  802964:	ff d0                	call   *%rax
+  802966:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80296a:	90                   	nop
+  80296b:	c9                   	leave
+  80296c:	c3                   	ret
+
+000000000080296d <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  80296d:	55                   	push   %rbp
+  80296e:	48 89 e5             	mov    %rsp,%rbp
+  802971:	48 83 ec 30          	sub    $0x30,%rsp
+  802975:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802978:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80297c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802980:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802983:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802986:	48 63 f0             	movslq %eax,%rsi
+  802989:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80298d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802991:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802994:	48 98                	cltq
+  802996:	48 83 ec 08          	sub    $0x8,%rsp
+  80299a:	6a 00                	push   $0x0
+  80299c:	49 89 f1             	mov    %rsi,%r9
+  80299f:	49 89 c8             	mov    %rcx,%r8
+  8029a2:	48 89 d1             	mov    %rdx,%rcx
+  8029a5:	48 89 c2             	mov    %rax,%rdx
+  8029a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8029ad:	bf 19 00 00 00       	mov    $0x19,%edi
+  8029b2:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  8029b9:	00 00 00 
+  8029bc:	ff d0                	call   *%rax
+  8029be:	48 83 c4 10          	add    $0x10,%rsp
+  8029c2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8029c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029c8:	c9                   	leave
+  8029c9:	c3                   	ret
+
+00000000008029ca <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8029ca:	55                   	push   %rbp
+  8029cb:	48 89 e5             	mov    %rsp,%rbp
+  8029ce:	48 83 ec 20          	sub    $0x20,%rsp
+  8029d2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029d6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029da:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8029dd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029e0:	48 63 c8             	movslq %eax,%rcx
+  8029e3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8029ef:	6a 00                	push   $0x0
+  8029f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029f7:	49 89 c8             	mov    %rcx,%r8
+  8029fa:	48 89 d1             	mov    %rdx,%rcx
+  8029fd:	48 89 c2             	mov    %rax,%rdx
+  802a00:	be 01 00 00 00       	mov    $0x1,%esi
+  802a05:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802a0a:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802a11:	00 00 00 
+  802a14:	ff d0                	call   *%rax
+  802a16:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a1a:	c9                   	leave
+  802a1b:	c3                   	ret
+
+0000000000802a1c <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802a1c:	55                   	push   %rbp
+  802a1d:	48 89 e5             	mov    %rsp,%rbp
+  802a20:	48 83 ec 20          	sub    $0x20,%rsp
+  802a24:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a28:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a2c:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802a30:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802a34:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a3c:	48 83 ec 08          	sub    $0x8,%rsp
+  802a40:	6a 00                	push   $0x0
+  802a42:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a48:	49 89 c8             	mov    %rcx,%r8
+  802a4b:	48 89 d1             	mov    %rdx,%rcx
+  802a4e:	48 89 c2             	mov    %rax,%rdx
+  802a51:	be 01 00 00 00       	mov    $0x1,%esi
+  802a56:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802a5b:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802a62:	00 00 00 
+  802a65:	ff d0                	call   *%rax
+  802a67:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a6b:	c9                   	leave
+  802a6c:	c3                   	ret
+
+0000000000802a6d <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802a6d:	55                   	push   %rbp
+  802a6e:	48 89 e5             	mov    %rsp,%rbp
+  802a71:	48 83 ec 30          	sub    $0x30,%rsp
+  802a75:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802a79:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802a7d:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802a80:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802a84:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802a88:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a8b:	48 63 c8             	movslq %eax,%rcx
+  802a8e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802a92:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a96:	48 83 ec 08          	sub    $0x8,%rsp
+  802a9a:	6a 00                	push   $0x0
+  802a9c:	49 89 f1             	mov    %rsi,%r9
+  802a9f:	49 89 c8             	mov    %rcx,%r8
+  802aa2:	48 89 d1             	mov    %rdx,%rcx
+  802aa5:	48 89 c2             	mov    %rax,%rdx
+  802aa8:	be 01 00 00 00       	mov    $0x1,%esi
+  802aad:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802ab2:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802ab9:	00 00 00 
+  802abc:	ff d0                	call   *%rax
+  802abe:	48 83 c4 10          	add    $0x10,%rsp
+  802ac2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802ac5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ac8:	c9                   	leave
+  802ac9:	c3                   	ret
+
+0000000000802aca <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802aca:	55                   	push   %rbp
+  802acb:	48 89 e5             	mov    %rsp,%rbp
+  802ace:	48 83 ec 10          	sub    $0x10,%rsp
+  802ad2:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802ad5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ad8:	48 98                	cltq
+  802ada:	48 83 ec 08          	sub    $0x8,%rsp
+  802ade:	6a 00                	push   $0x0
+  802ae0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ae6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802af1:	48 89 c2             	mov    %rax,%rdx
+  802af4:	be 01 00 00 00       	mov    $0x1,%esi
+  802af9:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802afe:	48 b8 79 21 80 00 00 	movabs $0x802179,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+  802b0a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b0e:	c9                   	leave
+  802b0f:	c3                   	ret
+
+0000000000802b10 <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802b10:	55                   	push   %rbp
+  802b11:	48 89 e5             	mov    %rsp,%rbp
+  802b14:	48 83 ec 40          	sub    $0x40,%rsp
+  802b18:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802b1c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b20:	48 8b 00             	mov    (%rax),%rax
+  802b23:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802b27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b2b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b2f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802b33:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b37:	83 e0 02             	and    $0x2,%eax
+  802b3a:	48 85 c0             	test   %rax,%rax
+  802b3d:	74 25                	je     802b64 <pgfault+0x54>
+  802b3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b43:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b47:	48 89 c2             	mov    %rax,%rdx
+  802b4a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b51:	01 00 00 
+  802b54:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b58:	83 e0 02             	and    $0x2,%eax
+  802b5b:	48 85 c0             	test   %rax,%rax
+  802b5e:	0f 85 fe 01 00 00    	jne    802d62 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802b64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b68:	83 e0 02             	and    $0x2,%eax
+  802b6b:	48 85 c0             	test   %rax,%rax
+  802b6e:	74 23                	je     802b93 <pgfault+0x83>
+  802b70:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b74:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b78:	48 89 c2             	mov    %rax,%rdx
+  802b7b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b82:	01 00 00 
+  802b85:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b89:	25 00 08 00 00       	and    $0x800,%eax
+  802b8e:	48 85 c0             	test   %rax,%rax
+  802b91:	75 3f                	jne    802bd2 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802b93:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b97:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b9b:	49 89 d0             	mov    %rdx,%r8
+  802b9e:	48 89 c1             	mov    %rax,%rcx
+  802ba1:	48 b8 f8 6c 80 00 00 	movabs $0x806cf8,%rax
+  802ba8:	00 00 00 
+  802bab:	48 89 c2             	mov    %rax,%rdx
+  802bae:	be 26 00 00 00       	mov    $0x26,%esi
+  802bb3:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802bba:	00 00 00 
+  802bbd:	48 89 c7             	mov    %rax,%rdi
+  802bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc5:	49 b9 8c 04 80 00 00 	movabs $0x80048c,%r9
+  802bcc:	00 00 00 
+  802bcf:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802bd2:	48 b8 61 5c 80 00 00 	movabs $0x805c61,%rax
+  802bd9:	00 00 00 
+  802bdc:	ff d0                	call   *%rax
+  802bde:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802be2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802be6:	ba 07 00 00 00       	mov    $0x7,%edx
+  802beb:	48 89 c6             	mov    %rax,%rsi
+  802bee:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf3:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  802bfa:	00 00 00 
+  802bfd:	ff d0                	call   *%rax
+  802bff:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802c02:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802c06:	79 36                	jns    802c3e <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802c08:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802c0b:	89 c1                	mov    %eax,%ecx
+  802c0d:	48 b8 38 6d 80 00 00 	movabs $0x806d38,%rax
+  802c14:	00 00 00 
+  802c17:	48 89 c2             	mov    %rax,%rdx
+  802c1a:	be 35 00 00 00       	mov    $0x35,%esi
+  802c1f:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802c26:	00 00 00 
+  802c29:	48 89 c7             	mov    %rax,%rdi
+  802c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c31:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  802c38:	00 00 00 
+  802c3b:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802c3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c42:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802c46:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c4a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c50:	48 89 c1             	mov    %rax,%rcx
+  802c53:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c57:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c5c:	48 89 ce             	mov    %rcx,%rsi
+  802c5f:	48 89 c7             	mov    %rax,%rdi
+  802c62:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  802c69:	00 00 00 
+  802c6c:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802c6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c72:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c76:	48 89 c2             	mov    %rax,%rdx
+  802c79:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c80:	01 00 00 
+  802c83:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c87:	25 00 08 00 00       	and    $0x800,%eax
+  802c8c:	48 85 c0             	test   %rax,%rax
+  802c8f:	74 7a                	je     802d0b <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802c91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c95:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802c99:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c9d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ca3:	48 89 c2             	mov    %rax,%rdx
+  802ca6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802caa:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802cb0:	48 89 d1             	mov    %rdx,%rcx
+  802cb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cb8:	48 89 c6             	mov    %rax,%rsi
+  802cbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc0:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  802cc7:	00 00 00 
+  802cca:	ff d0                	call   *%rax
+  802ccc:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802ccf:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802cd3:	79 36                	jns    802d0b <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802cd5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802cd8:	89 c1                	mov    %eax,%ecx
+  802cda:	48 b8 60 6d 80 00 00 	movabs $0x806d60,%rax
+  802ce1:	00 00 00 
+  802ce4:	48 89 c2             	mov    %rax,%rdx
+  802ce7:	be 42 00 00 00       	mov    $0x42,%esi
+  802cec:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802cf3:	00 00 00 
+  802cf6:	48 89 c7             	mov    %rax,%rdi
+  802cf9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cfe:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  802d05:	00 00 00 
+  802d08:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802d0b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d0f:	48 89 c6             	mov    %rax,%rsi
+  802d12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d17:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  802d1e:	00 00 00 
+  802d21:	ff d0                	call   *%rax
+  802d23:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802d26:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802d2a:	79 37                	jns    802d63 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802d2c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802d2f:	89 c1                	mov    %eax,%ecx
+  802d31:	48 b8 88 6d 80 00 00 	movabs $0x806d88,%rax
+  802d38:	00 00 00 
+  802d3b:	48 89 c2             	mov    %rax,%rdx
+  802d3e:	be 46 00 00 00       	mov    $0x46,%esi
+  802d43:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802d4a:	00 00 00 
+  802d4d:	48 89 c7             	mov    %rax,%rdi
+  802d50:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d55:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  802d5c:	00 00 00 
+  802d5f:	41 ff d0             	call   *%r8
+    return;
+  802d62:	90                   	nop
+  }
+}
+  802d63:	c9                   	leave
+  802d64:	c3                   	ret
+
+0000000000802d65 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802d65:	55                   	push   %rbp
+  802d66:	48 89 e5             	mov    %rsp,%rbp
+  802d69:	48 83 ec 30          	sub    $0x30,%rsp
+  802d6d:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d70:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802d74:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d7b:	01 00 00 
+  802d7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d82:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d86:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d8b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802d8f:	48 b8 b0 23 80 00 00 	movabs $0x8023b0,%rax
+  802d96:	00 00 00 
+  802d99:	ff d0                	call   *%rax
+  802d9b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802d9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802da2:	48 c1 e0 0c          	shl    $0xc,%rax
+  802da6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802daa:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802db1:	01 00 00 
+  802db4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802db8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802dbc:	25 00 04 00 00       	and    $0x400,%eax
+  802dc1:	48 85 c0             	test   %rax,%rax
+  802dc4:	74 7b                	je     802e41 <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802dc6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dca:	89 c1                	mov    %eax,%ecx
+  802dcc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802dd0:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dd4:	48 89 c2             	mov    %rax,%rdx
+  802dd7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ddb:	48 c1 e0 0c          	shl    $0xc,%rax
+  802ddf:	48 89 c6             	mov    %rax,%rsi
+  802de2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802de5:	41 89 c8             	mov    %ecx,%r8d
+  802de8:	48 89 d1             	mov    %rdx,%rcx
+  802deb:	89 c2                	mov    %eax,%edx
+  802ded:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df2:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  802df9:	00 00 00 
+  802dfc:	ff d0                	call   *%rax
+  802dfe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e01:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e05:	0f 89 da 00 00 00    	jns    802ee5 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802e0b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e0e:	89 c1                	mov    %eax,%ecx
+  802e10:	48 b8 b0 6d 80 00 00 	movabs $0x806db0,%rax
+  802e17:	00 00 00 
+  802e1a:	48 89 c2             	mov    %rax,%rdx
+  802e1d:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802e22:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802e29:	00 00 00 
+  802e2c:	48 89 c7             	mov    %rax,%rdi
+  802e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e34:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  802e3b:	00 00 00 
+  802e3e:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802e41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e45:	25 02 08 00 00       	and    $0x802,%eax
+  802e4a:	48 85 c0             	test   %rax,%rax
+  802e4d:	74 6e                	je     802ebd <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802e4f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e53:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802e59:	80 cc 08             	or     $0x8,%ah
+  802e5c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802e60:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e64:	89 c7                	mov    %eax,%edi
+  802e66:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e6a:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e6d:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e71:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e74:	41 89 f8             	mov    %edi,%r8d
+  802e77:	89 c7                	mov    %eax,%edi
+  802e79:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  802e80:	00 00 00 
+  802e83:	ff d0                	call   *%rax
+  802e85:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802e88:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e8c:	79 05                	jns    802e93 <duppage+0x12e>
+      return r;
+  802e8e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e91:	eb 55                	jmp    802ee8 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802e93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e97:	89 c7                	mov    %eax,%edi
+  802e99:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e9d:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ea0:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ea4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ea7:	41 89 f8             	mov    %edi,%r8d
+  802eaa:	89 c7                	mov    %eax,%edi
+  802eac:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+  802eb8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ebb:	eb 28                	jmp    802ee5 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802ebd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ec1:	89 c7                	mov    %eax,%edi
+  802ec3:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802ec7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802eca:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802ece:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ed1:	41 89 f8             	mov    %edi,%r8d
+  802ed4:	89 c7                	mov    %eax,%edi
+  802ed6:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  802edd:	00 00 00 
+  802ee0:	ff d0                	call   *%rax
+  802ee2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802ee5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ee8:	c9                   	leave
+  802ee9:	c3                   	ret
+
+0000000000802eea <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802eea:	55                   	push   %rbp
+  802eeb:	48 89 e5             	mov    %rsp,%rbp
+  802eee:	48 83 ec 20          	sub    $0x20,%rsp
+  802ef2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ef5:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802ef9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802efd:	48 c1 e0 0c          	shl    $0xc,%rax
+  802f01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802f05:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802f0c:	01 00 00 
+  802f0f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f13:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f17:	25 00 08 00 00       	and    $0x800,%eax
+  802f1c:	48 85 c0             	test   %rax,%rax
+  802f1f:	74 0d                	je     802f2e <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802f21:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f25:	0f b6 10             	movzbl (%rax),%edx
+  802f28:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f2c:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802f2e:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802f35:	01 00 00 
+  802f38:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f3c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f40:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f45:	89 c6                	mov    %eax,%esi
+  802f47:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802f4b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802f4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f52:	41 89 f0             	mov    %esi,%r8d
+  802f55:	48 89 c6             	mov    %rax,%rsi
+  802f58:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5d:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  802f64:	00 00 00 
+  802f67:	ff d0                	call   *%rax
+}
+  802f69:	c9                   	leave
+  802f6a:	c3                   	ret
+
+0000000000802f6b <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802f6b:	55                   	push   %rbp
+  802f6c:	48 89 e5             	mov    %rsp,%rbp
+  802f6f:	48 83 ec 40          	sub    $0x40,%rsp
+  802f73:	89 f8                	mov    %edi,%eax
+  802f75:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802f78:	48 b8 10 2b 80 00 00 	movabs $0x802b10,%rax
+  802f7f:	00 00 00 
+  802f82:	48 89 c7             	mov    %rax,%rdi
+  802f85:	48 b8 13 61 80 00 00 	movabs $0x806113,%rax
+  802f8c:	00 00 00 
+  802f8f:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802f91:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f96:	cd 30                	int    $0x30
+  802f98:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802f9b:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802f9e:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802fa1:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fa5:	79 36                	jns    802fdd <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802fa7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802faa:	89 c1                	mov    %eax,%ecx
+  802fac:	48 b8 db 6d 80 00 00 	movabs $0x806ddb,%rax
+  802fb3:	00 00 00 
+  802fb6:	48 89 c2             	mov    %rax,%rdx
+  802fb9:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802fbe:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  802fc5:	00 00 00 
+  802fc8:	48 89 c7             	mov    %rax,%rdi
+  802fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd0:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  802fd7:	00 00 00 
+  802fda:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802fdd:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fe1:	75 0a                	jne    802fed <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe8:	e9 d3 02 00 00       	jmp    8032c0 <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802fed:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802ff4:	00 
+  802ff5:	e9 7a 01 00 00       	jmp    803174 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802ffa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ffe:	48 c1 e0 0c          	shl    $0xc,%rax
+  803002:	48 c1 e8 27          	shr    $0x27,%rax
+  803006:	48 89 c2             	mov    %rax,%rdx
+  803009:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803010:	01 00 00 
+  803013:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803017:	83 e0 01             	and    $0x1,%eax
+  80301a:	48 85 c0             	test   %rax,%rax
+  80301d:	0f 84 4c 01 00 00    	je     80316f <fork_common+0x204>
+  803023:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803027:	48 c1 e0 0c          	shl    $0xc,%rax
+  80302b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80302f:	48 89 c2             	mov    %rax,%rdx
+  803032:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803039:	01 00 00 
+  80303c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803040:	83 e0 01             	and    $0x1,%eax
+  803043:	48 85 c0             	test   %rax,%rax
+  803046:	0f 84 23 01 00 00    	je     80316f <fork_common+0x204>
+  80304c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803050:	48 c1 e0 0c          	shl    $0xc,%rax
+  803054:	48 c1 e8 15          	shr    $0x15,%rax
+  803058:	48 89 c2             	mov    %rax,%rdx
+  80305b:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803062:	01 00 00 
+  803065:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803069:	83 e0 01             	and    $0x1,%eax
+  80306c:	48 85 c0             	test   %rax,%rax
+  80306f:	0f 84 fa 00 00 00    	je     80316f <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  803075:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803079:	48 c1 e0 0c          	shl    $0xc,%rax
+  80307d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  803081:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803085:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  80308c:	00 00 00 
+  80308f:	48 39 c2             	cmp    %rax,%rdx
+  803092:	0f 82 d7 00 00 00    	jb     80316f <fork_common+0x204>
+  803098:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  80309f:	00 00 00 
+  8030a2:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  8030a6:	0f 84 c3 00 00 00    	je     80316f <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  8030ac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030b0:	48 89 c7             	mov    %rax,%rdi
+  8030b3:	48 b8 1d 5c 80 00 00 	movabs $0x805c1d,%rax
+  8030ba:	00 00 00 
+  8030bd:	ff d0                	call   *%rax
+  8030bf:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  8030c2:	84 c0                	test   %al,%al
+  8030c4:	0f 84 a5 00 00 00    	je     80316f <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  8030ca:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030ce:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030d2:	48 89 c2             	mov    %rax,%rdx
+  8030d5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8030dc:	01 00 00 
+  8030df:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030e3:	83 e0 01             	and    $0x1,%eax
+  8030e6:	48 85 c0             	test   %rax,%rax
+  8030e9:	0f 84 80 00 00 00    	je     80316f <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  8030ef:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  8030f3:	74 4a                	je     80313f <fork_common+0x1d4>
+  8030f5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030f9:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  803100:	00 00 00 
+  803103:	48 39 c2             	cmp    %rax,%rdx
+  803106:	73 13                	jae    80311b <fork_common+0x1b0>
+  803108:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80310c:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  803113:	00 00 00 
+  803116:	48 39 c2             	cmp    %rax,%rdx
+  803119:	73 24                	jae    80313f <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  80311b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80311f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803123:	48 89 c2             	mov    %rax,%rdx
+  803126:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803129:	48 89 d6             	mov    %rdx,%rsi
+  80312c:	89 c7                	mov    %eax,%edi
+  80312e:	48 b8 ea 2e 80 00 00 	movabs $0x802eea,%rax
+  803135:	00 00 00 
+  803138:	ff d0                	call   *%rax
+  80313a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80313d:	eb 22                	jmp    803161 <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  80313f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803143:	48 c1 e8 0c          	shr    $0xc,%rax
+  803147:	48 89 c2             	mov    %rax,%rdx
+  80314a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80314d:	48 89 d6             	mov    %rdx,%rsi
+  803150:	89 c7                	mov    %eax,%edi
+  803152:	48 b8 65 2d 80 00 00 	movabs $0x802d65,%rax
+  803159:	00 00 00 
+  80315c:	ff d0                	call   *%rax
+  80315e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  803161:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803165:	79 08                	jns    80316f <fork_common+0x204>
+            return r;
+  803167:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80316a:	e9 51 01 00 00       	jmp    8032c0 <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  80316f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803174:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  80317b:	07 
+  80317c:	0f 86 78 fe ff ff    	jbe    802ffa <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  803182:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803189:	00 00 00 
+  80318c:	8b 40 04             	mov    0x4(%rax),%eax
+  80318f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803194:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80319b:	00 00 00 
+  80319e:	48 98                	cltq
+  8031a0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8031a7:	48 01 d0             	add    %rdx,%rax
+  8031aa:	48 05 00 01 00 00    	add    $0x100,%rax
+  8031b0:	48 8b 10             	mov    (%rax),%rdx
+  8031b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031b6:	48 89 d6             	mov    %rdx,%rsi
+  8031b9:	89 c7                	mov    %eax,%edi
+  8031bb:	48 b8 c6 25 80 00 00 	movabs $0x8025c6,%rax
+  8031c2:	00 00 00 
+  8031c5:	ff d0                	call   *%rax
+  8031c7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031ca:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031ce:	79 36                	jns    803206 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  8031d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031d3:	89 c1                	mov    %eax,%ecx
+  8031d5:	48 b8 f0 6d 80 00 00 	movabs $0x806df0,%rax
+  8031dc:	00 00 00 
+  8031df:	48 89 c2             	mov    %rax,%rdx
+  8031e2:	be be 00 00 00       	mov    $0xbe,%esi
+  8031e7:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  8031ee:	00 00 00 
+  8031f1:	48 89 c7             	mov    %rax,%rdi
+  8031f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031f9:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  803200:	00 00 00 
+  803203:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  803206:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803209:	ba 02 00 00 00       	mov    $0x2,%edx
+  80320e:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  803215:	00 00 00 
+  803218:	48 89 ce             	mov    %rcx,%rsi
+  80321b:	89 c7                	mov    %eax,%edi
+  80321d:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  803224:	00 00 00 
+  803227:	ff d0                	call   *%rax
+  803229:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80322c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803230:	79 36                	jns    803268 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803232:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803235:	89 c1                	mov    %eax,%ecx
+  803237:	48 b8 20 6e 80 00 00 	movabs $0x806e20,%rax
+  80323e:	00 00 00 
+  803241:	48 89 c2             	mov    %rax,%rdx
+  803244:	be c1 00 00 00       	mov    $0xc1,%esi
+  803249:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  803250:	00 00 00 
+  803253:	48 89 c7             	mov    %rax,%rdi
+  803256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325b:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  803262:	00 00 00 
+  803265:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  803268:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80326b:	be 02 00 00 00       	mov    $0x2,%esi
+  803270:	89 c7                	mov    %eax,%edi
+  803272:	48 b8 2d 25 80 00 00 	movabs $0x80252d,%rax
+  803279:	00 00 00 
+  80327c:	ff d0                	call   *%rax
+  80327e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803281:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803285:	79 36                	jns    8032bd <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  803287:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80328a:	89 c1                	mov    %eax,%ecx
+  80328c:	48 b8 40 6e 80 00 00 	movabs $0x806e40,%rax
+  803293:	00 00 00 
+  803296:	48 89 c2             	mov    %rax,%rdx
+  803299:	be d4 00 00 00       	mov    $0xd4,%esi
+  80329e:	48 b8 26 6d 80 00 00 	movabs $0x806d26,%rax
+  8032a5:	00 00 00 
+  8032a8:	48 89 c7             	mov    %rax,%rdi
+  8032ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032b0:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  8032b7:	00 00 00 
+  8032ba:	41 ff d0             	call   *%r8
+    }
+    return e;
+  8032bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  8032c0:	c9                   	leave
+  8032c1:	c3                   	ret
+
+00000000008032c2 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  8032c2:	55                   	push   %rbp
+  8032c3:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  8032c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032cb:	48 b8 6b 2f 80 00 00 	movabs $0x802f6b,%rax
+  8032d2:	00 00 00 
+  8032d5:	ff d0                	call   *%rax
+}
+  8032d7:	5d                   	pop    %rbp
+  8032d8:	c3                   	ret
+
+00000000008032d9 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  8032d9:	55                   	push   %rbp
+  8032da:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  8032dd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032e2:	48 b8 6b 2f 80 00 00 	movabs $0x802f6b,%rax
+  8032e9:	00 00 00 
+  8032ec:	ff d0                	call   *%rax
+}
+  8032ee:	5d                   	pop    %rbp
+  8032ef:	c3                   	ret
+
+00000000008032f0 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8032f0:	55                   	push   %rbp
+  8032f1:	48 89 e5             	mov    %rsp,%rbp
+  8032f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8032f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8032fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803300:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  803307:	ff ff ff 
+  80330a:	48 01 d0             	add    %rdx,%rax
+  80330d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  803311:	c9                   	leave
+  803312:	c3                   	ret
+
+0000000000803313 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  803313:	55                   	push   %rbp
+  803314:	48 89 e5             	mov    %rsp,%rbp
+  803317:	48 83 ec 08          	sub    $0x8,%rsp
+  80331b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  80331f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803323:	48 89 c7             	mov    %rax,%rdi
+  803326:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  80332d:	00 00 00 
+  803330:	ff d0                	call   *%rax
+  803332:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803338:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80333c:	c9                   	leave
+  80333d:	c3                   	ret
+
+000000000080333e <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80333e:	55                   	push   %rbp
+  80333f:	48 89 e5             	mov    %rsp,%rbp
+  803342:	48 83 ec 18          	sub    $0x18,%rsp
+  803346:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80334a:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803351:	e9 ae 00 00 00       	jmp    803404 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  803356:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803359:	c1 e0 0c             	shl    $0xc,%eax
+  80335c:	48 98                	cltq
+  80335e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803363:	48 01 d0             	add    %rdx,%rax
+  803366:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80336a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80336e:	48 c1 e8 27          	shr    $0x27,%rax
+  803372:	48 89 c2             	mov    %rax,%rdx
+  803375:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80337c:	01 00 00 
+  80337f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803383:	83 e0 01             	and    $0x1,%eax
+  803386:	48 85 c0             	test   %rax,%rax
+  803389:	74 63                	je     8033ee <fd_alloc+0xb0>
+  80338b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80338f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803393:	48 89 c2             	mov    %rax,%rdx
+  803396:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80339d:	01 00 00 
+  8033a0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033a4:	83 e0 01             	and    $0x1,%eax
+  8033a7:	48 85 c0             	test   %rax,%rax
+  8033aa:	74 42                	je     8033ee <fd_alloc+0xb0>
+  8033ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033b0:	48 c1 e8 15          	shr    $0x15,%rax
+  8033b4:	48 89 c2             	mov    %rax,%rdx
+  8033b7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8033be:	01 00 00 
+  8033c1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033c5:	83 e0 01             	and    $0x1,%eax
+  8033c8:	48 85 c0             	test   %rax,%rax
+  8033cb:	74 21                	je     8033ee <fd_alloc+0xb0>
+  8033cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033d1:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033d5:	48 89 c2             	mov    %rax,%rdx
+  8033d8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8033df:	01 00 00 
+  8033e2:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033e6:	83 e0 01             	and    $0x1,%eax
+  8033e9:	48 85 c0             	test   %rax,%rax
+  8033ec:	75 12                	jne    803400 <fd_alloc+0xc2>
+      *fd_store = fd;
+  8033ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033f2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8033f6:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8033f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fe:	eb 1e                	jmp    80341e <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  803400:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803404:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  803408:	0f 8e 48 ff ff ff    	jle    803356 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  80340e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803412:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  803419:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  80341e:	c9                   	leave
+  80341f:	c3                   	ret
+
+0000000000803420 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  803420:	55                   	push   %rbp
+  803421:	48 89 e5             	mov    %rsp,%rbp
+  803424:	48 83 ec 20          	sub    $0x20,%rsp
+  803428:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80342b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80342f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803433:	78 06                	js     80343b <fd_lookup+0x1b>
+  803435:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803439:	7e 0a                	jle    803445 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  80343b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803440:	e9 af 00 00 00       	jmp    8034f4 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  803445:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803448:	c1 e0 0c             	shl    $0xc,%eax
+  80344b:	48 98                	cltq
+  80344d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803452:	48 01 d0             	add    %rdx,%rax
+  803455:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803459:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80345d:	48 c1 e8 27          	shr    $0x27,%rax
+  803461:	48 89 c2             	mov    %rax,%rdx
+  803464:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80346b:	01 00 00 
+  80346e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803472:	83 e0 01             	and    $0x1,%eax
+  803475:	48 85 c0             	test   %rax,%rax
+  803478:	74 63                	je     8034dd <fd_lookup+0xbd>
+  80347a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80347e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803482:	48 89 c2             	mov    %rax,%rdx
+  803485:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80348c:	01 00 00 
+  80348f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803493:	83 e0 01             	and    $0x1,%eax
+  803496:	48 85 c0             	test   %rax,%rax
+  803499:	74 42                	je     8034dd <fd_lookup+0xbd>
+  80349b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80349f:	48 c1 e8 15          	shr    $0x15,%rax
+  8034a3:	48 89 c2             	mov    %rax,%rdx
+  8034a6:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8034ad:	01 00 00 
+  8034b0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034b4:	83 e0 01             	and    $0x1,%eax
+  8034b7:	48 85 c0             	test   %rax,%rax
+  8034ba:	74 21                	je     8034dd <fd_lookup+0xbd>
+  8034bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034c0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034c4:	48 89 c2             	mov    %rax,%rdx
+  8034c7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034ce:	01 00 00 
+  8034d1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034d5:	83 e0 01             	and    $0x1,%eax
+  8034d8:	48 85 c0             	test   %rax,%rax
+  8034db:	75 07                	jne    8034e4 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8034dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034e2:	eb 10                	jmp    8034f4 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8034e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034e8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034ec:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8034ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034f4:	c9                   	leave
+  8034f5:	c3                   	ret
+
+00000000008034f6 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8034f6:	55                   	push   %rbp
+  8034f7:	48 89 e5             	mov    %rsp,%rbp
+  8034fa:	48 83 ec 30          	sub    $0x30,%rsp
+  8034fe:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803502:	89 f0                	mov    %esi,%eax
+  803504:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  803507:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80350b:	48 89 c7             	mov    %rax,%rdi
+  80350e:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  803515:	00 00 00 
+  803518:	ff d0                	call   *%rax
+  80351a:	89 c2                	mov    %eax,%edx
+  80351c:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803520:	48 89 c6             	mov    %rax,%rsi
+  803523:	89 d7                	mov    %edx,%edi
+  803525:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  80352c:	00 00 00 
+  80352f:	ff d0                	call   *%rax
+  803531:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803534:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803538:	78 0a                	js     803544 <fd_close+0x4e>
+  80353a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80353e:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803542:	74 12                	je     803556 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803544:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803548:	74 05                	je     80354f <fd_close+0x59>
+  80354a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80354d:	eb 70                	jmp    8035bf <fd_close+0xc9>
+  80354f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803554:	eb 69                	jmp    8035bf <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803556:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80355a:	8b 00                	mov    (%rax),%eax
+  80355c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803560:	48 89 d6             	mov    %rdx,%rsi
+  803563:	89 c7                	mov    %eax,%edi
+  803565:	48 b8 c1 35 80 00 00 	movabs $0x8035c1,%rax
+  80356c:	00 00 00 
+  80356f:	ff d0                	call   *%rax
+  803571:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803574:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803578:	78 2a                	js     8035a4 <fd_close+0xae>
+    if (dev->dev_close)
+  80357a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80357e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803582:	48 85 c0             	test   %rax,%rax
+  803585:	74 16                	je     80359d <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803587:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80358b:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80358f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803593:	48 89 c7             	mov    %rax,%rdi
+  803596:	ff d2                	call   *%rdx
+  803598:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80359b:	eb 07                	jmp    8035a4 <fd_close+0xae>
+    else
+      r = 0;
+  80359d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  8035a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8035a8:	48 89 c6             	mov    %rax,%rsi
+  8035ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035b0:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  8035b7:	00 00 00 
+  8035ba:	ff d0                	call   *%rax
+  return r;
+  8035bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8035bf:	c9                   	leave
+  8035c0:	c3                   	ret
+
+00000000008035c1 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8035c1:	55                   	push   %rbp
+  8035c2:	48 89 e5             	mov    %rsp,%rbp
+  8035c5:	48 83 ec 20          	sub    $0x20,%rsp
+  8035c9:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035cc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8035d0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035d7:	eb 3f                	jmp    803618 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8035d9:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035e0:	00 00 00 
+  8035e3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035e6:	48 98                	cltq
+  8035e8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035ec:	8b 00                	mov    (%rax),%eax
+  8035ee:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8035f1:	75 21                	jne    803614 <dev_lookup+0x53>
+      *dev = devtab[i];
+  8035f3:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035fa:	00 00 00 
+  8035fd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803600:	48 98                	cltq
+  803602:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803606:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80360a:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  80360d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803612:	eb 7f                	jmp    803693 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  803614:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803618:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80361f:	00 00 00 
+  803622:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803625:	48 98                	cltq
+  803627:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80362b:	48 85 c0             	test   %rax,%rax
+  80362e:	75 a9                	jne    8035d9 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  803630:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803637:	00 00 00 
+  80363a:	8b 40 04             	mov    0x4(%rax),%eax
+  80363d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803642:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803649:	00 00 00 
+  80364c:	48 98                	cltq
+  80364e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803655:	48 01 d0             	add    %rdx,%rax
+  803658:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80365e:	8b 00                	mov    (%rax),%eax
+  803660:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803663:	89 c6                	mov    %eax,%esi
+  803665:	48 b8 68 6e 80 00 00 	movabs $0x806e68,%rax
+  80366c:	00 00 00 
+  80366f:	48 89 c7             	mov    %rax,%rdi
+  803672:	b8 00 00 00 00       	mov    $0x0,%eax
+  803677:	48 b9 ab 06 80 00 00 	movabs $0x8006ab,%rcx
+  80367e:	00 00 00 
+  803681:	ff d1                	call   *%rcx
+  *dev = 0;
+  803683:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803687:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  80368e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803693:	c9                   	leave
+  803694:	c3                   	ret
+
+0000000000803695 <close>:
+
+int
+close(int fdnum) {
+  803695:	55                   	push   %rbp
+  803696:	48 89 e5             	mov    %rsp,%rbp
+  803699:	48 83 ec 20          	sub    $0x20,%rsp
+  80369d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8036a0:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8036a4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8036a7:	48 89 d6             	mov    %rdx,%rsi
+  8036aa:	89 c7                	mov    %eax,%edi
+  8036ac:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  8036b3:	00 00 00 
+  8036b6:	ff d0                	call   *%rax
+  8036b8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8036bb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8036bf:	79 05                	jns    8036c6 <close+0x31>
+    return r;
+  8036c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036c4:	eb 18                	jmp    8036de <close+0x49>
+  else
+    return fd_close(fd, 1);
+  8036c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8036cf:	48 89 c7             	mov    %rax,%rdi
+  8036d2:	48 b8 f6 34 80 00 00 	movabs $0x8034f6,%rax
+  8036d9:	00 00 00 
+  8036dc:	ff d0                	call   *%rax
+}
+  8036de:	c9                   	leave
+  8036df:	c3                   	ret
+
+00000000008036e0 <close_all>:
+
+void
+close_all(void) {
+  8036e0:	55                   	push   %rbp
+  8036e1:	48 89 e5             	mov    %rsp,%rbp
+  8036e4:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8036e8:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8036ef:	eb 15                	jmp    803706 <close_all+0x26>
+    close(i);
+  8036f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036f4:	89 c7                	mov    %eax,%edi
+  8036f6:	48 b8 95 36 80 00 00 	movabs $0x803695,%rax
+  8036fd:	00 00 00 
+  803700:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  803702:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  803706:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80370a:	7e e5                	jle    8036f1 <close_all+0x11>
+}
+  80370c:	90                   	nop
+  80370d:	90                   	nop
+  80370e:	c9                   	leave
+  80370f:	c3                   	ret
+
+0000000000803710 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  803710:	55                   	push   %rbp
+  803711:	48 89 e5             	mov    %rsp,%rbp
+  803714:	48 83 ec 40          	sub    $0x40,%rsp
+  803718:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  80371b:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80371e:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803722:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803725:	48 89 d6             	mov    %rdx,%rsi
+  803728:	89 c7                	mov    %eax,%edi
+  80372a:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  803731:	00 00 00 
+  803734:	ff d0                	call   *%rax
+  803736:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803739:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80373d:	79 08                	jns    803747 <dup+0x37>
+    return r;
+  80373f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803742:	e9 33 02 00 00       	jmp    80397a <dup+0x26a>
+  close(newfdnum);
+  803747:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80374a:	89 c7                	mov    %eax,%edi
+  80374c:	48 b8 95 36 80 00 00 	movabs $0x803695,%rax
+  803753:	00 00 00 
+  803756:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803758:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80375b:	c1 e0 0c             	shl    $0xc,%eax
+  80375e:	48 98                	cltq
+  803760:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803765:	48 01 d0             	add    %rdx,%rax
+  803768:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  80376c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803770:	48 89 c7             	mov    %rax,%rdi
+  803773:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  80377a:	00 00 00 
+  80377d:	ff d0                	call   *%rax
+  80377f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803783:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803787:	48 89 c7             	mov    %rax,%rdi
+  80378a:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  803791:	00 00 00 
+  803794:	ff d0                	call   *%rax
+  803796:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  80379a:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  8037a1:	00 
+  8037a2:	e9 19 01 00 00       	jmp    8038c0 <dup+0x1b0>
+    off -= PGSIZE;
+  8037a7:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  8037ae:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  8037af:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037b7:	48 01 d0             	add    %rdx,%rax
+  8037ba:	48 c1 e8 27          	shr    $0x27,%rax
+  8037be:	48 89 c2             	mov    %rax,%rdx
+  8037c1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8037c8:	01 00 00 
+  8037cb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037cf:	83 e0 01             	and    $0x1,%eax
+  8037d2:	48 85 c0             	test   %rax,%rax
+  8037d5:	0f 84 e5 00 00 00    	je     8038c0 <dup+0x1b0>
+  8037db:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037e3:	48 01 d0             	add    %rdx,%rax
+  8037e6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8037ea:	48 89 c2             	mov    %rax,%rdx
+  8037ed:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8037f4:	01 00 00 
+  8037f7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037fb:	83 e0 01             	and    $0x1,%eax
+  8037fe:	48 85 c0             	test   %rax,%rax
+  803801:	0f 84 b9 00 00 00    	je     8038c0 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803807:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80380b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80380f:	48 01 d0             	add    %rdx,%rax
+  803812:	48 c1 e8 15          	shr    $0x15,%rax
+  803816:	48 89 c2             	mov    %rax,%rdx
+  803819:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803820:	01 00 00 
+  803823:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803827:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80382a:	48 85 c0             	test   %rax,%rax
+  80382d:	0f 84 8d 00 00 00    	je     8038c0 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803833:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803837:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80383b:	48 01 d0             	add    %rdx,%rax
+  80383e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803842:	48 89 c2             	mov    %rax,%rdx
+  803845:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80384c:	01 00 00 
+  80384f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803853:	83 e0 01             	and    $0x1,%eax
+  803856:	48 85 c0             	test   %rax,%rax
+  803859:	74 65                	je     8038c0 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80385b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80385f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803863:	48 01 d0             	add    %rdx,%rax
+  803866:	48 c1 e8 0c          	shr    $0xc,%rax
+  80386a:	48 89 c2             	mov    %rax,%rdx
+  80386d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803874:	01 00 00 
+  803877:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80387b:	25 07 0e 00 00       	and    $0xe07,%eax
+  803880:	89 c6                	mov    %eax,%esi
+  803882:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803886:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80388a:	48 01 c2             	add    %rax,%rdx
+  80388d:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803891:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803895:	48 01 c8             	add    %rcx,%rax
+  803898:	41 89 f0             	mov    %esi,%r8d
+  80389b:	48 89 d1             	mov    %rdx,%rcx
+  80389e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038a3:	48 89 c6             	mov    %rax,%rsi
+  8038a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ab:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  8038b2:	00 00 00 
+  8038b5:	ff d0                	call   *%rax
+  8038b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038be:	78 60                	js     803920 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  8038c0:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8038c5:	0f 85 dc fe ff ff    	jne    8037a7 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8038cb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038cf:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038d3:	48 89 c2             	mov    %rax,%rdx
+  8038d6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8038dd:	01 00 00 
+  8038e0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038e4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8038e9:	89 c1                	mov    %eax,%ecx
+  8038eb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ef:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8038f3:	41 89 c8             	mov    %ecx,%r8d
+  8038f6:	48 89 d1             	mov    %rdx,%rcx
+  8038f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038fe:	48 89 c6             	mov    %rax,%rsi
+  803901:	bf 00 00 00 00       	mov    $0x0,%edi
+  803906:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  80390d:	00 00 00 
+  803910:	ff d0                	call   *%rax
+  803912:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803915:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803919:	78 08                	js     803923 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  80391b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80391e:	eb 5a                	jmp    80397a <dup+0x26a>
+        goto err;
+  803920:	90                   	nop
+  803921:	eb 01                	jmp    803924 <dup+0x214>
+    goto err;
+  803923:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803924:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803928:	48 89 c6             	mov    %rax,%rsi
+  80392b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803930:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  803937:	00 00 00 
+  80393a:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80393c:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803943:	00 
+  803944:	eb 27                	jmp    80396d <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803946:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80394a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80394e:	48 01 d0             	add    %rdx,%rax
+  803951:	48 89 c6             	mov    %rax,%rsi
+  803954:	bf 00 00 00 00       	mov    $0x0,%edi
+  803959:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  803960:	00 00 00 
+  803963:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803965:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80396c:	00 
+  80396d:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803974:	00 
+  803975:	76 cf                	jbe    803946 <dup+0x236>
+  return r;
+  803977:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80397a:	c9                   	leave
+  80397b:	c3                   	ret
+
+000000000080397c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80397c:	55                   	push   %rbp
+  80397d:	48 89 e5             	mov    %rsp,%rbp
+  803980:	48 83 ec 40          	sub    $0x40,%rsp
+  803984:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803987:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80398b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80398f:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803993:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803996:	48 89 d6             	mov    %rdx,%rsi
+  803999:	89 c7                	mov    %eax,%edi
+  80399b:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  8039a2:	00 00 00 
+  8039a5:	ff d0                	call   *%rax
+  8039a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039aa:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039ae:	78 24                	js     8039d4 <read+0x58>
+  8039b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039b4:	8b 00                	mov    (%rax),%eax
+  8039b6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8039ba:	48 89 d6             	mov    %rdx,%rsi
+  8039bd:	89 c7                	mov    %eax,%edi
+  8039bf:	48 b8 c1 35 80 00 00 	movabs $0x8035c1,%rax
+  8039c6:	00 00 00 
+  8039c9:	ff d0                	call   *%rax
+  8039cb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039ce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039d2:	79 0a                	jns    8039de <read+0x62>
+    return r;
+  8039d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039d7:	48 98                	cltq
+  8039d9:	e9 9e 00 00 00       	jmp    803a7c <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8039de:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039e2:	8b 40 08             	mov    0x8(%rax),%eax
+  8039e5:	83 e0 03             	and    $0x3,%eax
+  8039e8:	83 f8 01             	cmp    $0x1,%eax
+  8039eb:	75 5c                	jne    803a49 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8039ed:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8039f4:	00 00 00 
+  8039f7:	8b 40 04             	mov    0x4(%rax),%eax
+  8039fa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8039ff:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803a06:	00 00 00 
+  803a09:	48 98                	cltq
+  803a0b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803a12:	48 01 d0             	add    %rdx,%rax
+  803a15:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803a1b:	8b 00                	mov    (%rax),%eax
+  803a1d:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803a20:	89 c6                	mov    %eax,%esi
+  803a22:	48 b8 87 6e 80 00 00 	movabs $0x806e87,%rax
+  803a29:	00 00 00 
+  803a2c:	48 89 c7             	mov    %rax,%rdi
+  803a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a34:	48 b9 ab 06 80 00 00 	movabs $0x8006ab,%rcx
+  803a3b:	00 00 00 
+  803a3e:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803a40:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a47:	eb 33                	jmp    803a7c <read+0x100>
+  }
+  if (!dev->dev_read)
+  803a49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a4d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803a51:	48 85 c0             	test   %rax,%rax
+  803a54:	75 09                	jne    803a5f <read+0xe3>
+    return -E_NOT_SUPP;
+  803a56:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803a5d:	eb 1d                	jmp    803a7c <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803a5f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a63:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803a67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a6b:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a6f:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803a73:	48 89 ce             	mov    %rcx,%rsi
+  803a76:	48 89 c7             	mov    %rax,%rdi
+  803a79:	41 ff d0             	call   *%r8
+}
+  803a7c:	c9                   	leave
+  803a7d:	c3                   	ret
+
+0000000000803a7e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803a7e:	55                   	push   %rbp
+  803a7f:	48 89 e5             	mov    %rsp,%rbp
+  803a82:	48 83 ec 30          	sub    $0x30,%rsp
+  803a86:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803a89:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803a8d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803a91:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803a98:	eb 49                	jmp    803ae3 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803a9a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a9d:	48 98                	cltq
+  803a9f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803aa3:	48 29 c2             	sub    %rax,%rdx
+  803aa6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803aa9:	48 63 c8             	movslq %eax,%rcx
+  803aac:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ab0:	48 01 c1             	add    %rax,%rcx
+  803ab3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803ab6:	48 89 ce             	mov    %rcx,%rsi
+  803ab9:	89 c7                	mov    %eax,%edi
+  803abb:	48 b8 7c 39 80 00 00 	movabs $0x80397c,%rax
+  803ac2:	00 00 00 
+  803ac5:	ff d0                	call   *%rax
+  803ac7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803aca:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803ace:	79 07                	jns    803ad7 <readn+0x59>
+      return m;
+  803ad0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803ad3:	48 98                	cltq
+  803ad5:	eb 1f                	jmp    803af6 <readn+0x78>
+    if (m == 0)
+  803ad7:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803adb:	74 13                	je     803af0 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803add:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803ae0:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803ae3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ae6:	48 98                	cltq
+  803ae8:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803aec:	72 ac                	jb     803a9a <readn+0x1c>
+  803aee:	eb 01                	jmp    803af1 <readn+0x73>
+      break;
+  803af0:	90                   	nop
+  }
+  return tot;
+  803af1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803af4:	48 98                	cltq
+}
+  803af6:	c9                   	leave
+  803af7:	c3                   	ret
+
+0000000000803af8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803af8:	55                   	push   %rbp
+  803af9:	48 89 e5             	mov    %rsp,%rbp
+  803afc:	48 83 ec 40          	sub    $0x40,%rsp
+  803b00:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803b03:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803b07:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803b0b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803b0f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803b12:	48 89 d6             	mov    %rdx,%rsi
+  803b15:	89 c7                	mov    %eax,%edi
+  803b17:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  803b1e:	00 00 00 
+  803b21:	ff d0                	call   *%rax
+  803b23:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b26:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b2a:	78 24                	js     803b50 <write+0x58>
+  803b2c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b30:	8b 00                	mov    (%rax),%eax
+  803b32:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b36:	48 89 d6             	mov    %rdx,%rsi
+  803b39:	89 c7                	mov    %eax,%edi
+  803b3b:	48 b8 c1 35 80 00 00 	movabs $0x8035c1,%rax
+  803b42:	00 00 00 
+  803b45:	ff d0                	call   *%rax
+  803b47:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b4a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b4e:	79 0a                	jns    803b5a <write+0x62>
+    return r;
+  803b50:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b53:	48 98                	cltq
+  803b55:	e9 9d 00 00 00       	jmp    803bf7 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803b5a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b5e:	8b 40 08             	mov    0x8(%rax),%eax
+  803b61:	83 e0 03             	and    $0x3,%eax
+  803b64:	85 c0                	test   %eax,%eax
+  803b66:	75 5c                	jne    803bc4 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803b68:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b6f:	00 00 00 
+  803b72:	8b 40 04             	mov    0x4(%rax),%eax
+  803b75:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b7a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b81:	00 00 00 
+  803b84:	48 98                	cltq
+  803b86:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803b8d:	48 01 d0             	add    %rdx,%rax
+  803b90:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803b96:	8b 00                	mov    (%rax),%eax
+  803b98:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803b9b:	89 c6                	mov    %eax,%esi
+  803b9d:	48 b8 a3 6e 80 00 00 	movabs $0x806ea3,%rax
+  803ba4:	00 00 00 
+  803ba7:	48 89 c7             	mov    %rax,%rdi
+  803baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  803baf:	48 b9 ab 06 80 00 00 	movabs $0x8006ab,%rcx
+  803bb6:	00 00 00 
+  803bb9:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803bbb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803bc2:	eb 33                	jmp    803bf7 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803bc4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bc8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803bcc:	48 85 c0             	test   %rax,%rax
+  803bcf:	75 09                	jne    803bda <write+0xe2>
+    return -E_NOT_SUPP;
+  803bd1:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803bd8:	eb 1d                	jmp    803bf7 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803bda:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bde:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803be2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803be6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803bea:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803bee:	48 89 ce             	mov    %rcx,%rsi
+  803bf1:	48 89 c7             	mov    %rax,%rdi
+  803bf4:	41 ff d0             	call   *%r8
+}
+  803bf7:	c9                   	leave
+  803bf8:	c3                   	ret
+
+0000000000803bf9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803bf9:	55                   	push   %rbp
+  803bfa:	48 89 e5             	mov    %rsp,%rbp
+  803bfd:	48 83 ec 18          	sub    $0x18,%rsp
+  803c01:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803c04:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803c07:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803c0e:	48 89 d6             	mov    %rdx,%rsi
+  803c11:	89 c7                	mov    %eax,%edi
+  803c13:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  803c1a:	00 00 00 
+  803c1d:	ff d0                	call   *%rax
+  803c1f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c22:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c26:	79 05                	jns    803c2d <seek+0x34>
+    return r;
+  803c28:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c2b:	eb 0f                	jmp    803c3c <seek+0x43>
+  fd->fd_offset = offset;
+  803c2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c31:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c34:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803c37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c3c:	c9                   	leave
+  803c3d:	c3                   	ret
+
+0000000000803c3e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803c3e:	55                   	push   %rbp
+  803c3f:	48 89 e5             	mov    %rsp,%rbp
+  803c42:	48 83 ec 30          	sub    $0x30,%rsp
+  803c46:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c49:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c4c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803c50:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c53:	48 89 d6             	mov    %rdx,%rsi
+  803c56:	89 c7                	mov    %eax,%edi
+  803c58:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  803c5f:	00 00 00 
+  803c62:	ff d0                	call   *%rax
+  803c64:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c67:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c6b:	78 24                	js     803c91 <ftruncate+0x53>
+  803c6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c71:	8b 00                	mov    (%rax),%eax
+  803c73:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c77:	48 89 d6             	mov    %rdx,%rsi
+  803c7a:	89 c7                	mov    %eax,%edi
+  803c7c:	48 b8 c1 35 80 00 00 	movabs $0x8035c1,%rax
+  803c83:	00 00 00 
+  803c86:	ff d0                	call   *%rax
+  803c88:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c8b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c8f:	79 08                	jns    803c99 <ftruncate+0x5b>
+    return r;
+  803c91:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c94:	e9 92 00 00 00       	jmp    803d2b <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c9d:	8b 40 08             	mov    0x8(%rax),%eax
+  803ca0:	83 e0 03             	and    $0x3,%eax
+  803ca3:	85 c0                	test   %eax,%eax
+  803ca5:	75 5a                	jne    803d01 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803ca7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803cae:	00 00 00 
+  803cb1:	8b 40 04             	mov    0x4(%rax),%eax
+  803cb4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803cb9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803cc0:	00 00 00 
+  803cc3:	48 98                	cltq
+  803cc5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803ccc:	48 01 d0             	add    %rdx,%rax
+  803ccf:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803cd5:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803cd7:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803cda:	89 c6                	mov    %eax,%esi
+  803cdc:	48 b8 c0 6e 80 00 00 	movabs $0x806ec0,%rax
+  803ce3:	00 00 00 
+  803ce6:	48 89 c7             	mov    %rax,%rdi
+  803ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cee:	48 b9 ab 06 80 00 00 	movabs $0x8006ab,%rcx
+  803cf5:	00 00 00 
+  803cf8:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803cfa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803cff:	eb 2a                	jmp    803d2b <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803d01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d05:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803d09:	48 85 c0             	test   %rax,%rax
+  803d0c:	75 07                	jne    803d15 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803d0e:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803d13:	eb 16                	jmp    803d2b <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803d15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d19:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803d1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d21:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803d24:	89 d6                	mov    %edx,%esi
+  803d26:	48 89 c7             	mov    %rax,%rdi
+  803d29:	ff d1                	call   *%rcx
+}
+  803d2b:	c9                   	leave
+  803d2c:	c3                   	ret
+
+0000000000803d2d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803d2d:	55                   	push   %rbp
+  803d2e:	48 89 e5             	mov    %rsp,%rbp
+  803d31:	48 83 ec 30          	sub    $0x30,%rsp
+  803d35:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d38:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d3c:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803d40:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d43:	48 89 d6             	mov    %rdx,%rsi
+  803d46:	89 c7                	mov    %eax,%edi
+  803d48:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  803d4f:	00 00 00 
+  803d52:	ff d0                	call   *%rax
+  803d54:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d57:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d5b:	78 24                	js     803d81 <fstat+0x54>
+  803d5d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d61:	8b 00                	mov    (%rax),%eax
+  803d63:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803d67:	48 89 d6             	mov    %rdx,%rsi
+  803d6a:	89 c7                	mov    %eax,%edi
+  803d6c:	48 b8 c1 35 80 00 00 	movabs $0x8035c1,%rax
+  803d73:	00 00 00 
+  803d76:	ff d0                	call   *%rax
+  803d78:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d7b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d7f:	79 05                	jns    803d86 <fstat+0x59>
+    return r;
+  803d81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d84:	eb 5e                	jmp    803de4 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803d86:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d8a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803d8e:	48 85 c0             	test   %rax,%rax
+  803d91:	75 07                	jne    803d9a <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803d93:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803d98:	eb 4a                	jmp    803de4 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803d9a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d9e:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803da1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da5:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803dac:	00 00 00 
+  stat->st_isdir   = 0;
+  803daf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803db3:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803dba:	00 00 00 
+  stat->st_dev     = dev;
+  803dbd:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803dc1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803dc5:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803dcc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dd0:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803dd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803dd8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ddc:	48 89 d6             	mov    %rdx,%rsi
+  803ddf:	48 89 c7             	mov    %rax,%rdi
+  803de2:	ff d1                	call   *%rcx
+}
+  803de4:	c9                   	leave
+  803de5:	c3                   	ret
+
+0000000000803de6 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803de6:	55                   	push   %rbp
+  803de7:	48 89 e5             	mov    %rsp,%rbp
+  803dea:	48 83 ec 10          	sub    $0x10,%rsp
+  803dee:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803df2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803df6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dfa:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803e00:	83 f8 20             	cmp    $0x20,%eax
+  803e03:	75 07                	jne    803e0c <pollwait_key+0x26>
+    return -E_INVAL;
+  803e05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803e0a:	eb 5f                	jmp    803e6b <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803e0c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e10:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803e16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e1a:	48 63 d2             	movslq %edx,%rdx
+  803e1d:	48 c1 e2 04          	shl    $0x4,%rdx
+  803e21:	48 01 c2             	add    %rax,%rdx
+  803e24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e28:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803e2b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e2f:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803e35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e39:	8b 00                	mov    (%rax),%eax
+  803e3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e3f:	48 63 c9             	movslq %ecx,%rcx
+  803e42:	48 c1 e1 04          	shl    $0x4,%rcx
+  803e46:	48 01 ca             	add    %rcx,%rdx
+  803e49:	48 83 c2 08          	add    $0x8,%rdx
+  803e4d:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803e4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e53:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803e59:	8d 50 01             	lea    0x1(%rax),%edx
+  803e5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e60:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803e66:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e6b:	c9                   	leave
+  803e6c:	c3                   	ret
+
+0000000000803e6d <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803e6d:	55                   	push   %rbp
+  803e6e:	48 89 e5             	mov    %rsp,%rbp
+  803e71:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803e78:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803e7f:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803e85:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803e8c:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803e93:	00 
+  int i, r, ready, ipc = 0;
+  803e94:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803e9b:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803ea2:	00 
+  803ea3:	74 45                	je     803eea <poll+0x7d>
+  803ea5:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803eac:	ff 
+  803ead:	74 3b                	je     803eea <poll+0x7d>
+    now      = vsys_clock_ns();
+  803eaf:	48 b8 22 5d 80 00 00 	movabs $0x805d22,%rax
+  803eb6:	00 00 00 
+  803eb9:	ff d0                	call   *%rax
+  803ebb:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803ebf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ec3:	48 f7 d0             	not    %rax
+  803ec6:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803ecd:	73 10                	jae    803edf <poll+0x72>
+  803ecf:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803ed3:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803eda:	48 01 d0             	add    %rdx,%rax
+  803edd:	eb 07                	jmp    803ee6 <poll+0x79>
+  803edf:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803ee6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803eea:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803ef1:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803ef8:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803eff:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803f06:	e9 46 02 00 00       	jmp    804151 <poll+0x2e4>
+      fds[i].revents = 0;
+  803f0b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f0e:	48 63 d0             	movslq %eax,%rdx
+  803f11:	48 89 d0             	mov    %rdx,%rax
+  803f14:	48 01 c0             	add    %rax,%rax
+  803f17:	48 01 d0             	add    %rdx,%rax
+  803f1a:	48 c1 e0 02          	shl    $0x2,%rax
+  803f1e:	48 89 c2             	mov    %rax,%rdx
+  803f21:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f28:	48 01 d0             	add    %rdx,%rax
+  803f2b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803f32:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f35:	48 63 d0             	movslq %eax,%rdx
+  803f38:	48 89 d0             	mov    %rdx,%rax
+  803f3b:	48 01 c0             	add    %rax,%rax
+  803f3e:	48 01 d0             	add    %rdx,%rax
+  803f41:	48 c1 e0 02          	shl    $0x2,%rax
+  803f45:	48 89 c2             	mov    %rax,%rdx
+  803f48:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f4f:	48 01 d0             	add    %rdx,%rax
+  803f52:	8b 00                	mov    (%rax),%eax
+  803f54:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803f57:	75 62                	jne    803fbb <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803f59:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f5c:	48 63 d0             	movslq %eax,%rdx
+  803f5f:	48 89 d0             	mov    %rdx,%rax
+  803f62:	48 01 c0             	add    %rax,%rax
+  803f65:	48 01 d0             	add    %rdx,%rax
+  803f68:	48 c1 e0 02          	shl    $0x2,%rax
+  803f6c:	48 89 c2             	mov    %rax,%rdx
+  803f6f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f76:	48 01 d0             	add    %rdx,%rax
+  803f79:	8b 40 04             	mov    0x4(%rax),%eax
+  803f7c:	83 e0 01             	and    $0x1,%eax
+  803f7f:	85 c0                	test   %eax,%eax
+  803f81:	0f 84 9b 01 00 00    	je     804122 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803f87:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f8a:	48 63 d0             	movslq %eax,%rdx
+  803f8d:	48 89 d0             	mov    %rdx,%rax
+  803f90:	48 01 c0             	add    %rax,%rax
+  803f93:	48 01 d0             	add    %rdx,%rax
+  803f96:	48 c1 e0 02          	shl    $0x2,%rax
+  803f9a:	48 89 c2             	mov    %rax,%rdx
+  803f9d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fa4:	48 01 c2             	add    %rax,%rdx
+  803fa7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803faa:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803fad:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803fb0:	83 c8 04             	or     $0x4,%eax
+  803fb3:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803fb6:	e9 67 01 00 00       	jmp    804122 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803fbb:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fbe:	48 63 d0             	movslq %eax,%rdx
+  803fc1:	48 89 d0             	mov    %rdx,%rax
+  803fc4:	48 01 c0             	add    %rax,%rax
+  803fc7:	48 01 d0             	add    %rdx,%rax
+  803fca:	48 c1 e0 02          	shl    $0x2,%rax
+  803fce:	48 89 c2             	mov    %rax,%rdx
+  803fd1:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fd8:	48 01 d0             	add    %rdx,%rax
+  803fdb:	8b 00                	mov    (%rax),%eax
+  803fdd:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803fe4:	48 89 d6             	mov    %rdx,%rsi
+  803fe7:	89 c7                	mov    %eax,%edi
+  803fe9:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  803ff0:	00 00 00 
+  803ff3:	ff d0                	call   *%rax
+  803ff5:	85 c0                	test   %eax,%eax
+  803ff7:	78 25                	js     80401e <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803ff9:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  804000:	8b 00                	mov    (%rax),%eax
+  804002:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  804009:	48 89 d6             	mov    %rdx,%rsi
+  80400c:	89 c7                	mov    %eax,%edi
+  80400e:	48 b8 c1 35 80 00 00 	movabs $0x8035c1,%rax
+  804015:	00 00 00 
+  804018:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80401a:	85 c0                	test   %eax,%eax
+  80401c:	79 2c                	jns    80404a <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80401e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804021:	48 63 d0             	movslq %eax,%rdx
+  804024:	48 89 d0             	mov    %rdx,%rax
+  804027:	48 01 c0             	add    %rax,%rax
+  80402a:	48 01 d0             	add    %rdx,%rax
+  80402d:	48 c1 e0 02          	shl    $0x2,%rax
+  804031:	48 89 c2             	mov    %rax,%rdx
+  804034:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80403b:	48 01 d0             	add    %rdx,%rax
+  80403e:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  804045:	e9 d8 00 00 00       	jmp    804122 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  80404a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804051:	48 8b 40 38          	mov    0x38(%rax),%rax
+  804055:	48 85 c0             	test   %rax,%rax
+  804058:	74 7d                	je     8040d7 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  80405a:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  804061:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  804065:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804068:	48 63 d0             	movslq %eax,%rdx
+  80406b:	48 89 d0             	mov    %rdx,%rax
+  80406e:	48 01 c0             	add    %rax,%rax
+  804071:	48 01 d0             	add    %rdx,%rax
+  804074:	48 c1 e0 02          	shl    $0x2,%rax
+  804078:	48 89 c2             	mov    %rax,%rdx
+  80407b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804082:	48 01 d0             	add    %rdx,%rax
+  804085:	8b 48 04             	mov    0x4(%rax),%ecx
+  804088:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80408f:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  804096:	89 ce                	mov    %ecx,%esi
+  804098:	48 89 c7             	mov    %rax,%rdi
+  80409b:	41 ff d0             	call   *%r8
+  80409e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8040a1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8040a5:	79 08                	jns    8040af <poll+0x242>
+          return r;
+  8040a7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040aa:	e9 45 01 00 00       	jmp    8041f4 <poll+0x387>
+        fds[i].revents = r;
+  8040af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040b2:	48 63 d0             	movslq %eax,%rdx
+  8040b5:	48 89 d0             	mov    %rdx,%rax
+  8040b8:	48 01 c0             	add    %rax,%rax
+  8040bb:	48 01 d0             	add    %rdx,%rax
+  8040be:	48 c1 e0 02          	shl    $0x2,%rax
+  8040c2:	48 89 c2             	mov    %rax,%rdx
+  8040c5:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040cc:	48 01 c2             	add    %rax,%rdx
+  8040cf:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040d2:	89 42 08             	mov    %eax,0x8(%rdx)
+  8040d5:	eb 4b                	jmp    804122 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8040d7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040da:	48 63 d0             	movslq %eax,%rdx
+  8040dd:	48 89 d0             	mov    %rdx,%rax
+  8040e0:	48 01 c0             	add    %rax,%rax
+  8040e3:	48 01 d0             	add    %rdx,%rax
+  8040e6:	48 c1 e0 02          	shl    $0x2,%rax
+  8040ea:	48 89 c2             	mov    %rax,%rdx
+  8040ed:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040f4:	48 01 d0             	add    %rdx,%rax
+  8040f7:	8b 48 04             	mov    0x4(%rax),%ecx
+  8040fa:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040fd:	48 63 d0             	movslq %eax,%rdx
+  804100:	48 89 d0             	mov    %rdx,%rax
+  804103:	48 01 c0             	add    %rax,%rax
+  804106:	48 01 d0             	add    %rdx,%rax
+  804109:	48 c1 e0 02          	shl    $0x2,%rax
+  80410d:	48 89 c2             	mov    %rax,%rdx
+  804110:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804117:	48 01 d0             	add    %rdx,%rax
+  80411a:	83 e1 03             	and    $0x3,%ecx
+  80411d:	89 ca                	mov    %ecx,%edx
+  80411f:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804122:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804125:	48 63 d0             	movslq %eax,%rdx
+  804128:	48 89 d0             	mov    %rdx,%rax
+  80412b:	48 01 c0             	add    %rax,%rax
+  80412e:	48 01 d0             	add    %rdx,%rax
+  804131:	48 c1 e0 02          	shl    $0x2,%rax
+  804135:	48 89 c2             	mov    %rax,%rdx
+  804138:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80413f:	48 01 d0             	add    %rdx,%rax
+  804142:	8b 40 08             	mov    0x8(%rax),%eax
+  804145:	85 c0                	test   %eax,%eax
+  804147:	74 04                	je     80414d <poll+0x2e0>
+        ready++;
+  804149:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80414d:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  804151:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804154:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  80415a:	0f 8c ab fd ff ff    	jl     803f0b <poll+0x9e>
+    }
+    if (ready)
+  804160:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  804164:	74 08                	je     80416e <poll+0x301>
+      return ready;
+  804166:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804169:	e9 86 00 00 00       	jmp    8041f4 <poll+0x387>
+
+    if (deadline) {
+  80416e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804173:	74 30                	je     8041a5 <poll+0x338>
+      now     = vsys_clock_ns();
+  804175:	48 b8 22 5d 80 00 00 	movabs $0x805d22,%rax
+  80417c:	00 00 00 
+  80417f:	ff d0                	call   *%rax
+  804181:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  804185:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804189:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80418d:	73 0a                	jae    804199 <poll+0x32c>
+  80418f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804193:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  804197:	eb 05                	jmp    80419e <poll+0x331>
+  804199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419e:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8041a5:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8041a8:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8041ab:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  8041b2:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  8041b9:	48 89 c7             	mov    %rax,%rdi
+  8041bc:	48 b8 71 28 80 00 00 	movabs $0x802871,%rax
+  8041c3:	00 00 00 
+  8041c6:	ff d0                	call   *%rax
+  8041c8:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8041cb:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8041cf:	75 07                	jne    8041d8 <poll+0x36b>
+      return 0;
+  8041d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d6:	eb 1c                	jmp    8041f4 <poll+0x387>
+    if (r < 0)
+  8041d8:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8041dc:	79 05                	jns    8041e3 <poll+0x376>
+      return r;
+  8041de:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041e1:	eb 11                	jmp    8041f4 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8041e3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041e6:	c1 f8 02             	sar    $0x2,%eax
+  8041e9:	83 e0 01             	and    $0x1,%eax
+  8041ec:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8041ef:	e9 f6 fc ff ff       	jmp    803eea <poll+0x7d>
+  }
+}
+  8041f4:	c9                   	leave
+  8041f5:	c3                   	ret
+
+00000000008041f6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8041f6:	55                   	push   %rbp
+  8041f7:	48 89 e5             	mov    %rsp,%rbp
+  8041fa:	48 83 ec 20          	sub    $0x20,%rsp
+  8041fe:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804202:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  804206:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80420a:	be 00 00 00 00       	mov    $0x0,%esi
+  80420f:	48 89 c7             	mov    %rax,%rdi
+  804212:	48 b8 e4 42 80 00 00 	movabs $0x8042e4,%rax
+  804219:	00 00 00 
+  80421c:	ff d0                	call   *%rax
+  80421e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804221:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804225:	79 05                	jns    80422c <stat+0x36>
+    return fd;
+  804227:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80422a:	eb 2f                	jmp    80425b <stat+0x65>
+  r = fstat(fd, stat);
+  80422c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804230:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804233:	48 89 d6             	mov    %rdx,%rsi
+  804236:	89 c7                	mov    %eax,%edi
+  804238:	48 b8 2d 3d 80 00 00 	movabs $0x803d2d,%rax
+  80423f:	00 00 00 
+  804242:	ff d0                	call   *%rax
+  804244:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804247:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80424a:	89 c7                	mov    %eax,%edi
+  80424c:	48 b8 95 36 80 00 00 	movabs $0x803695,%rax
+  804253:	00 00 00 
+  804256:	ff d0                	call   *%rax
+  return r;
+  804258:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80425b:	c9                   	leave
+  80425c:	c3                   	ret
+
+000000000080425d <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80425d:	55                   	push   %rbp
+  80425e:	48 89 e5             	mov    %rsp,%rbp
+  804261:	48 83 ec 10          	sub    $0x10,%rsp
+  804265:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804268:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80426c:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804273:	00 00 00 
+  804276:	8b 00                	mov    (%rax),%eax
+  804278:	85 c0                	test   %eax,%eax
+  80427a:	75 1d                	jne    804299 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80427c:	bf 03 00 00 00       	mov    $0x3,%edi
+  804281:	48 b8 a3 64 80 00 00 	movabs $0x8064a3,%rax
+  804288:	00 00 00 
+  80428b:	ff d0                	call   *%rax
+  80428d:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804294:	00 00 00 
+  804297:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804299:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8042a0:	00 00 00 
+  8042a3:	8b 00                	mov    (%rax),%eax
+  8042a5:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  8042a8:	b9 07 00 00 00       	mov    $0x7,%ecx
+  8042ad:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8042b4:	00 00 00 
+  8042b7:	89 c7                	mov    %eax,%edi
+  8042b9:	48 b8 f6 63 80 00 00 	movabs $0x8063f6,%rax
+  8042c0:	00 00 00 
+  8042c3:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8042c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ce:	48 89 c6             	mov    %rax,%rsi
+  8042d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042d6:	48 b8 79 62 80 00 00 	movabs $0x806279,%rax
+  8042dd:	00 00 00 
+  8042e0:	ff d0                	call   *%rax
+}
+  8042e2:	c9                   	leave
+  8042e3:	c3                   	ret
+
+00000000008042e4 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8042e4:	55                   	push   %rbp
+  8042e5:	48 89 e5             	mov    %rsp,%rbp
+  8042e8:	48 83 ec 20          	sub    $0x20,%rsp
+  8042ec:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042f0:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8042f3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042f7:	48 89 c7             	mov    %rax,%rdi
+  8042fa:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  804301:	00 00 00 
+  804304:	ff d0                	call   *%rax
+  804306:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80430b:	7e 0a                	jle    804317 <open+0x33>
+    return -E_BAD_PATH;
+  80430d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804312:	e9 a8 00 00 00       	jmp    8043bf <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804317:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  80431b:	48 89 c7             	mov    %rax,%rdi
+  80431e:	48 b8 3e 33 80 00 00 	movabs $0x80333e,%rax
+  804325:	00 00 00 
+  804328:	ff d0                	call   *%rax
+  80432a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80432d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804331:	79 08                	jns    80433b <open+0x57>
+    return r;
+  804333:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804336:	e9 84 00 00 00       	jmp    8043bf <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80433b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80433f:	48 89 c6             	mov    %rax,%rsi
+  804342:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804349:	00 00 00 
+  80434c:	48 89 c7             	mov    %rax,%rdi
+  80434f:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  804356:	00 00 00 
+  804359:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  80435b:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804362:	00 00 00 
+  804365:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804368:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80436e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804372:	48 89 c6             	mov    %rax,%rsi
+  804375:	bf 01 00 00 00       	mov    $0x1,%edi
+  80437a:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  804381:	00 00 00 
+  804384:	ff d0                	call   *%rax
+  804386:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804389:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80438d:	79 1d                	jns    8043ac <open+0xc8>
+    fd_close(fd, 0);
+  80438f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804393:	be 00 00 00 00       	mov    $0x0,%esi
+  804398:	48 89 c7             	mov    %rax,%rdi
+  80439b:	48 b8 f6 34 80 00 00 	movabs $0x8034f6,%rax
+  8043a2:	00 00 00 
+  8043a5:	ff d0                	call   *%rax
+    return r;
+  8043a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8043aa:	eb 13                	jmp    8043bf <open+0xdb>
+  }
+
+  return fd2num(fd);
+  8043ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8043b0:	48 89 c7             	mov    %rax,%rdi
+  8043b3:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  8043ba:	00 00 00 
+  8043bd:	ff d0                	call   *%rax
+}
+  8043bf:	c9                   	leave
+  8043c0:	c3                   	ret
+
+00000000008043c1 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  8043c1:	55                   	push   %rbp
+  8043c2:	48 89 e5             	mov    %rsp,%rbp
+  8043c5:	48 83 ec 10          	sub    $0x10,%rsp
+  8043c9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8043cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043d1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8043d4:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8043db:	00 00 00 
+  8043de:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8043e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8043e5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8043ea:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  8043f1:	00 00 00 
+  8043f4:	ff d0                	call   *%rax
+}
+  8043f6:	c9                   	leave
+  8043f7:	c3                   	ret
+
+00000000008043f8 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8043f8:	55                   	push   %rbp
+  8043f9:	48 89 e5             	mov    %rsp,%rbp
+  8043fc:	48 83 ec 30          	sub    $0x30,%rsp
+  804400:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804404:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804408:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  80440c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804411:	74 07                	je     80441a <devfile_read+0x22>
+  804413:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804418:	75 0a                	jne    804424 <devfile_read+0x2c>
+  return E_INVAL;
+  80441a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80441f:	e9 b4 00 00 00       	jmp    8044d8 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804424:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80442b:	00 
+  while (n) {
+  80442c:	e9 98 00 00 00       	jmp    8044c9 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  804431:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804435:	8b 40 0c             	mov    0xc(%rax),%eax
+  804438:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80443f:	00 00 00 
+  804442:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  804444:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80444b:	00 00 00 
+  80444e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804452:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  804456:	be 00 00 00 00       	mov    $0x0,%esi
+  80445b:	bf 03 00 00 00       	mov    $0x3,%edi
+  804460:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  804467:	00 00 00 
+  80446a:	ff d0                	call   *%rax
+  80446c:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  80446f:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804473:	7f 13                	jg     804488 <devfile_read+0x90>
+      return res ? res : res0;
+  804475:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804479:	74 07                	je     804482 <devfile_read+0x8a>
+  80447b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80447e:	48 98                	cltq
+  804480:	eb 56                	jmp    8044d8 <devfile_read+0xe0>
+  804482:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804486:	eb 50                	jmp    8044d8 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804488:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80448b:	48 63 d0             	movslq %eax,%rdx
+  80448e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804492:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804499:	00 00 00 
+  80449c:	48 89 ce             	mov    %rcx,%rsi
+  80449f:	48 89 c7             	mov    %rax,%rdi
+  8044a2:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  8044a9:	00 00 00 
+  8044ac:	ff d0                	call   *%rax
+
+    buf += res;
+  8044ae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044b1:	48 98                	cltq
+  8044b3:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  8044b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044ba:	48 98                	cltq
+  8044bc:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  8044c0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044c3:	48 98                	cltq
+  8044c5:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8044c9:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8044ce:	0f 85 5d ff ff ff    	jne    804431 <devfile_read+0x39>
+  }
+
+  return res0;
+  8044d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8044d8:	c9                   	leave
+  8044d9:	c3                   	ret
+
+00000000008044da <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8044da:	55                   	push   %rbp
+  8044db:	48 89 e5             	mov    %rsp,%rbp
+  8044de:	48 83 ec 50          	sub    $0x50,%rsp
+  8044e2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8044e6:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044ea:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8044ee:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8044f3:	74 07                	je     8044fc <devfile_write+0x22>
+  8044f5:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8044fa:	75 0a                	jne    804506 <devfile_write+0x2c>
+  return E_INVAL;
+  8044fc:	b8 03 00 00 00       	mov    $0x3,%eax
+  804501:	e9 c9 00 00 00       	jmp    8045cf <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  804506:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80450d:	00 
+
+  while (n) {
+  80450e:	e9 ad 00 00 00       	jmp    8045c0 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  804513:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804517:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80451b:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804522:	00 
+  804523:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804527:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80452b:	48 39 c2             	cmp    %rax,%rdx
+  80452e:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804532:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804536:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80453a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80453e:	48 89 c6             	mov    %rax,%rsi
+  804541:	48 b8 10 80 80 00 00 	movabs $0x808010,%rax
+  804548:	00 00 00 
+  80454b:	48 89 c7             	mov    %rax,%rdi
+  80454e:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  804555:	00 00 00 
+  804558:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80455a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80455e:	8b 40 0c             	mov    0xc(%rax),%eax
+  804561:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804568:	00 00 00 
+  80456b:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  80456d:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804574:	00 00 00 
+  804577:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80457b:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  80457f:	be 00 00 00 00       	mov    $0x0,%esi
+  804584:	bf 04 00 00 00       	mov    $0x4,%edi
+  804589:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  804590:	00 00 00 
+  804593:	ff d0                	call   *%rax
+  804595:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804598:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80459c:	79 07                	jns    8045a5 <devfile_write+0xcb>
+      return res;
+  80459e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045a1:	48 98                	cltq
+  8045a3:	eb 2a                	jmp    8045cf <devfile_write+0xf5>
+
+    buf += res;
+  8045a5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045a8:	48 98                	cltq
+  8045aa:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  8045ae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045b1:	48 98                	cltq
+  8045b3:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  8045b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8045ba:	48 98                	cltq
+  8045bc:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8045c0:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8045c5:	0f 85 48 ff ff ff    	jne    804513 <devfile_write+0x39>
+  }
+
+  return res0;
+  8045cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8045cf:	c9                   	leave
+  8045d0:	c3                   	ret
+
+00000000008045d1 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8045d1:	55                   	push   %rbp
+  8045d2:	48 89 e5             	mov    %rsp,%rbp
+  8045d5:	48 83 ec 20          	sub    $0x20,%rsp
+  8045d9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8045dd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8045e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045e5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8045e8:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8045ef:	00 00 00 
+  8045f2:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8045f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8045f9:	bf 05 00 00 00       	mov    $0x5,%edi
+  8045fe:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  804605:	00 00 00 
+  804608:	ff d0                	call   *%rax
+  80460a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80460d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804611:	79 05                	jns    804618 <devfile_stat+0x47>
+    return r;
+  804613:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804616:	eb 59                	jmp    804671 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  804618:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80461c:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804623:	00 00 00 
+  804626:	48 89 d6             	mov    %rdx,%rsi
+  804629:	48 89 c7             	mov    %rax,%rdi
+  80462c:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  804633:	00 00 00 
+  804636:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804638:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80463f:	00 00 00 
+  804642:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804648:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80464c:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804652:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804659:	00 00 00 
+  80465c:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804662:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804666:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  80466c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804671:	c9                   	leave
+  804672:	c3                   	ret
+
+0000000000804673 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804673:	55                   	push   %rbp
+  804674:	48 89 e5             	mov    %rsp,%rbp
+  804677:	48 83 ec 10          	sub    $0x10,%rsp
+  80467b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80467f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804682:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804686:	8b 40 0c             	mov    0xc(%rax),%eax
+  804689:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  804690:	00 00 00 
+  804693:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804695:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80469c:	00 00 00 
+  80469f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046a2:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8046a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8046aa:	bf 02 00 00 00       	mov    $0x2,%edi
+  8046af:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  8046b6:	00 00 00 
+  8046b9:	ff d0                	call   *%rax
+}
+  8046bb:	c9                   	leave
+  8046bc:	c3                   	ret
+
+00000000008046bd <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8046bd:	55                   	push   %rbp
+  8046be:	48 89 e5             	mov    %rsp,%rbp
+  8046c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8046c5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8046c9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8046cc:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8046d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046d3:	83 e0 03             	and    $0x3,%eax
+}
+  8046d6:	c9                   	leave
+  8046d7:	c3                   	ret
+
+00000000008046d8 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8046d8:	55                   	push   %rbp
+  8046d9:	48 89 e5             	mov    %rsp,%rbp
+  8046dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8046e0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8046e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046e8:	48 89 c7             	mov    %rax,%rdi
+  8046eb:	48 b8 5a 15 80 00 00 	movabs $0x80155a,%rax
+  8046f2:	00 00 00 
+  8046f5:	ff d0                	call   *%rax
+  8046f7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8046fc:	7e 07                	jle    804705 <remove+0x2d>
+    return -E_BAD_PATH;
+  8046fe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  804703:	eb 36                	jmp    80473b <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  804705:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804709:	48 89 c6             	mov    %rax,%rsi
+  80470c:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  804713:	00 00 00 
+  804716:	48 89 c7             	mov    %rax,%rdi
+  804719:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  804720:	00 00 00 
+  804723:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804725:	be 00 00 00 00       	mov    $0x0,%esi
+  80472a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80472f:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  804736:	00 00 00 
+  804739:	ff d0                	call   *%rax
+}
+  80473b:	c9                   	leave
+  80473c:	c3                   	ret
+
+000000000080473d <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80473d:	55                   	push   %rbp
+  80473e:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804741:	be 00 00 00 00       	mov    $0x0,%esi
+  804746:	bf 08 00 00 00       	mov    $0x8,%edi
+  80474b:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  804752:	00 00 00 
+  804755:	ff d0                	call   *%rax
+}
+  804757:	5d                   	pop    %rbp
+  804758:	c3                   	ret
+
+0000000000804759 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804759:	55                   	push   %rbp
+  80475a:	48 89 e5             	mov    %rsp,%rbp
+  80475d:	48 83 ec 20          	sub    $0x20,%rsp
+  804761:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804765:	be 00 00 00 00       	mov    $0x0,%esi
+  80476a:	bf 09 00 00 00       	mov    $0x9,%edi
+  80476f:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  804776:	00 00 00 
+  804779:	ff d0                	call   *%rax
+  80477b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80477e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804782:	79 05                	jns    804789 <fs_stats+0x30>
+    return r;
+  804784:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804787:	eb 2a                	jmp    8047b3 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804789:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80478d:	ba 68 00 00 00       	mov    $0x68,%edx
+  804792:	48 b9 00 80 80 00 00 	movabs $0x808000,%rcx
+  804799:	00 00 00 
+  80479c:	48 89 ce             	mov    %rcx,%rsi
+  80479f:	48 89 c7             	mov    %rax,%rdi
+  8047a2:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  8047a9:	00 00 00 
+  8047ac:	ff d0                	call   *%rax
+  return 0;
+  8047ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047b3:	c9                   	leave
+  8047b4:	c3                   	ret
+
+00000000008047b5 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  8047b5:	55                   	push   %rbp
+  8047b6:	48 89 e5             	mov    %rsp,%rbp
+  8047b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8047bd:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  8047c0:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8047c7:	00 00 00 
+  8047ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047cd:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  8047cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8047d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8047d9:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  8047e0:	00 00 00 
+  8047e3:	ff d0                	call   *%rax
+}
+  8047e5:	c9                   	leave
+  8047e6:	c3                   	ret
+
+00000000008047e7 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8047e7:	55                   	push   %rbp
+  8047e8:	48 89 e5             	mov    %rsp,%rbp
+  8047eb:	48 83 ec 10          	sub    $0x10,%rsp
+  8047ef:	89 f8                	mov    %edi,%eax
+  8047f1:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8047f4:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8047f8:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  8047ff:	00 00 00 
+  804802:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804804:	be 00 00 00 00       	mov    $0x0,%esi
+  804809:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80480e:	48 b8 5d 42 80 00 00 	movabs $0x80425d,%rax
+  804815:	00 00 00 
+  804818:	ff d0                	call   *%rax
+}
+  80481a:	c9                   	leave
+  80481b:	c3                   	ret
+
+000000000080481c <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80481c:	55                   	push   %rbp
+  80481d:	48 89 e5             	mov    %rsp,%rbp
+  804820:	48 83 ec 10          	sub    $0x10,%rsp
+  804824:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804828:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80482c:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804831:	48 89 c7             	mov    %rax,%rdi
+  804834:	48 b8 42 48 80 00 00 	movabs $0x804842,%rax
+  80483b:	00 00 00 
+  80483e:	ff d0                	call   *%rax
+}
+  804840:	c9                   	leave
+  804841:	c3                   	ret
+
+0000000000804842 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804842:	55                   	push   %rbp
+  804843:	48 89 e5             	mov    %rsp,%rbp
+  804846:	48 83 ec 50          	sub    $0x50,%rsp
+  80484a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80484e:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804852:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804859:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  80485a:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  80485f:	74 0a                	je     80486b <pipe_size+0x29>
+  804861:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804868:	00 
+  804869:	76 0a                	jbe    804875 <pipe_size+0x33>
+    return -E_INVAL;
+  80486b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804870:	e9 cc 02 00 00       	jmp    804b41 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804875:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804879:	48 89 c7             	mov    %rax,%rdi
+  80487c:	48 b8 3e 33 80 00 00 	movabs $0x80333e,%rax
+  804883:	00 00 00 
+  804886:	ff d0                	call   *%rax
+  804888:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80488b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80488f:	0f 88 a8 02 00 00    	js     804b3d <pipe_size+0x2fb>
+  804895:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804899:	ba 07 04 00 00       	mov    $0x407,%edx
+  80489e:	48 89 c6             	mov    %rax,%rsi
+  8048a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048a6:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  8048ad:	00 00 00 
+  8048b0:	ff d0                	call   *%rax
+  8048b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048b9:	0f 88 7e 02 00 00    	js     804b3d <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8048bf:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8048c3:	48 89 c7             	mov    %rax,%rdi
+  8048c6:	48 b8 3e 33 80 00 00 	movabs $0x80333e,%rax
+  8048cd:	00 00 00 
+  8048d0:	ff d0                	call   *%rax
+  8048d2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048d5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048d9:	0f 88 43 02 00 00    	js     804b22 <pipe_size+0x2e0>
+  8048df:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048e3:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048e8:	48 89 c6             	mov    %rax,%rsi
+  8048eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048f0:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  8048f7:	00 00 00 
+  8048fa:	ff d0                	call   *%rax
+  8048fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804903:	0f 88 19 02 00 00    	js     804b22 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804909:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80490d:	48 89 c7             	mov    %rax,%rdi
+  804910:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  804917:	00 00 00 
+  80491a:	ff d0                	call   *%rax
+  80491c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804920:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804927:	00 
+  804928:	e9 a2 00 00 00       	jmp    8049cf <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80492d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804931:	48 c1 e0 0c          	shl    $0xc,%rax
+  804935:	48 89 c2             	mov    %rax,%rdx
+  804938:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80493c:	48 01 d0             	add    %rdx,%rax
+  80493f:	ba 07 04 00 00       	mov    $0x407,%edx
+  804944:	48 89 c6             	mov    %rax,%rsi
+  804947:	bf 00 00 00 00       	mov    $0x0,%edi
+  80494c:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  804953:	00 00 00 
+  804956:	ff d0                	call   *%rax
+  804958:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80495b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80495f:	0f 88 37 01 00 00    	js     804a9c <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804965:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804969:	48 89 c7             	mov    %rax,%rdi
+  80496c:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  804973:	00 00 00 
+  804976:	ff d0                	call   *%rax
+  804978:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80497c:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804980:	48 01 c2             	add    %rax,%rdx
+  804983:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804987:	48 c1 e0 0c          	shl    $0xc,%rax
+  80498b:	48 89 c1             	mov    %rax,%rcx
+  80498e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804992:	48 01 c8             	add    %rcx,%rax
+  804995:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80499b:	48 89 d1             	mov    %rdx,%rcx
+  80499e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049a3:	48 89 c6             	mov    %rax,%rsi
+  8049a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049ab:	48 b8 81 24 80 00 00 	movabs $0x802481,%rax
+  8049b2:	00 00 00 
+  8049b5:	ff d0                	call   *%rax
+  8049b7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8049ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049be:	79 0a                	jns    8049ca <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  8049c0:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8049c5:	e9 d3 00 00 00       	jmp    804a9d <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8049ca:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8049cf:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8049d6:	00 
+  8049d7:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8049db:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049df:	48 01 d0             	add    %rdx,%rax
+  8049e2:	48 83 c0 1f          	add    $0x1f,%rax
+  8049e6:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8049ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049f3:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8049f7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049fb:	48 29 d0             	sub    %rdx,%rax
+  8049fe:	48 c1 e8 0c          	shr    $0xc,%rax
+  804a02:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804a06:	0f 82 21 ff ff ff    	jb     80492d <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  804a0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a10:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804a14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a18:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804a1c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  804a20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a24:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a2b:	00 00 00 
+  804a2e:	8b 12                	mov    (%rdx),%edx
+  804a30:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804a32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a36:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804a3d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a41:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a48:	00 00 00 
+  804a4b:	8b 12                	mov    (%rdx),%edx
+  804a4d:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804a4f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a53:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804a5a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a5e:	48 89 c7             	mov    %rax,%rdi
+  804a61:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  804a68:	00 00 00 
+  804a6b:	ff d0                	call   *%rax
+  804a6d:	89 c2                	mov    %eax,%edx
+  804a6f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a73:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804a75:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a79:	48 89 c7             	mov    %rax,%rdi
+  804a7c:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  804a83:	00 00 00 
+  804a86:	ff d0                	call   *%rax
+  804a88:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a8c:	48 83 c2 04          	add    $0x4,%rdx
+  804a90:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804a92:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a97:	e9 a5 00 00 00       	jmp    804b41 <pipe_size+0x2ff>
+      goto err2;
+  804a9c:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804a9d:	eb 58                	jmp    804af7 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804a9f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804aa3:	48 c1 e0 0c          	shl    $0xc,%rax
+  804aa7:	48 89 c2             	mov    %rax,%rdx
+  804aaa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aae:	48 01 d0             	add    %rdx,%rax
+  804ab1:	48 89 c6             	mov    %rax,%rsi
+  804ab4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ab9:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  804ac0:	00 00 00 
+  804ac3:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804ac5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804ac9:	48 89 c7             	mov    %rax,%rdi
+  804acc:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  804ad3:	00 00 00 
+  804ad6:	ff d0                	call   *%rax
+  804ad8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804adc:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804ae0:	48 01 d0             	add    %rdx,%rax
+  804ae3:	48 89 c6             	mov    %rax,%rsi
+  804ae6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aeb:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  804af2:	00 00 00 
+  804af5:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804af7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804afb:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804aff:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804b03:	48 85 c0             	test   %rax,%rax
+  804b06:	75 97                	jne    804a9f <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804b08:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804b0c:	48 89 c6             	mov    %rax,%rsi
+  804b0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b14:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  804b1b:	00 00 00 
+  804b1e:	ff d0                	call   *%rax
+  804b20:	eb 01                	jmp    804b23 <pipe_size+0x2e1>
+    goto err1;
+  804b22:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804b23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b27:	48 89 c6             	mov    %rax,%rsi
+  804b2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b2f:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  804b36:	00 00 00 
+  804b39:	ff d0                	call   *%rax
+  804b3b:	eb 01                	jmp    804b3e <pipe_size+0x2fc>
+    goto err;
+  804b3d:	90                   	nop
+err:
+  return r;
+  804b3e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804b41:	c9                   	leave
+  804b42:	c3                   	ret
+
+0000000000804b43 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804b43:	55                   	push   %rbp
+  804b44:	48 89 e5             	mov    %rsp,%rbp
+  804b47:	53                   	push   %rbx
+  804b48:	48 83 ec 28          	sub    $0x28,%rsp
+  804b4c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b50:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804b54:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b5b:	00 00 00 
+  804b5e:	8b 40 04             	mov    0x4(%rax),%eax
+  804b61:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b66:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b6d:	00 00 00 
+  804b70:	48 98                	cltq
+  804b72:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b79:	48 01 d0             	add    %rdx,%rax
+  804b7c:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b82:	8b 00                	mov    (%rax),%eax
+  804b84:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804b87:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b8b:	48 89 c7             	mov    %rax,%rdi
+  804b8e:	48 b8 14 65 80 00 00 	movabs $0x806514,%rax
+  804b95:	00 00 00 
+  804b98:	ff d0                	call   *%rax
+  804b9a:	89 c3                	mov    %eax,%ebx
+  804b9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804ba0:	48 89 c7             	mov    %rax,%rdi
+  804ba3:	48 b8 14 65 80 00 00 	movabs $0x806514,%rax
+  804baa:	00 00 00 
+  804bad:	ff d0                	call   *%rax
+  804baf:	39 c3                	cmp    %eax,%ebx
+  804bb1:	0f 94 c0             	sete   %al
+  804bb4:	0f b6 c0             	movzbl %al,%eax
+  804bb7:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804bba:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804bc1:	00 00 00 
+  804bc4:	8b 40 04             	mov    0x4(%rax),%eax
+  804bc7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804bcc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bd3:	00 00 00 
+  804bd6:	48 98                	cltq
+  804bd8:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804bdf:	48 01 d0             	add    %rdx,%rax
+  804be2:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804be8:	8b 00                	mov    (%rax),%eax
+  804bea:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804bed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bf0:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804bf3:	75 05                	jne    804bfa <_pipeisclosed+0xb7>
+      return ret;
+  804bf5:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bf8:	eb 68                	jmp    804c62 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804bfa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bfd:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804c00:	0f 84 4e ff ff ff    	je     804b54 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804c06:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804c0d:	00 00 00 
+  804c10:	8b 40 04             	mov    0x4(%rax),%eax
+  804c13:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804c18:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804c1f:	00 00 00 
+  804c22:	48 98                	cltq
+  804c24:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804c2b:	48 01 d0             	add    %rdx,%rax
+  804c2e:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804c34:	8b 10                	mov    (%rax),%edx
+  804c36:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804c39:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c3c:	89 c6                	mov    %eax,%esi
+  804c3e:	48 b8 f0 6e 80 00 00 	movabs $0x806ef0,%rax
+  804c45:	00 00 00 
+  804c48:	48 89 c7             	mov    %rax,%rdi
+  804c4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c50:	49 b8 ab 06 80 00 00 	movabs $0x8006ab,%r8
+  804c57:	00 00 00 
+  804c5a:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804c5d:	e9 f2 fe ff ff       	jmp    804b54 <_pipeisclosed+0x11>
+  }
+}
+  804c62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c66:	c9                   	leave
+  804c67:	c3                   	ret
+
+0000000000804c68 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804c68:	55                   	push   %rbp
+  804c69:	48 89 e5             	mov    %rsp,%rbp
+  804c6c:	48 83 ec 30          	sub    $0x30,%rsp
+  804c70:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c73:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804c77:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c7a:	48 89 d6             	mov    %rdx,%rsi
+  804c7d:	89 c7                	mov    %eax,%edi
+  804c7f:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  804c86:	00 00 00 
+  804c89:	ff d0                	call   *%rax
+  804c8b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c8e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c92:	79 05                	jns    804c99 <pipeisclosed+0x31>
+    return r;
+  804c94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c97:	eb 31                	jmp    804cca <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804c99:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c9d:	48 89 c7             	mov    %rax,%rdi
+  804ca0:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  804ca7:	00 00 00 
+  804caa:	ff d0                	call   *%rax
+  804cac:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804cb0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804cb4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804cb8:	48 89 d6             	mov    %rdx,%rsi
+  804cbb:	48 89 c7             	mov    %rax,%rdi
+  804cbe:	48 b8 43 4b 80 00 00 	movabs $0x804b43,%rax
+  804cc5:	00 00 00 
+  804cc8:	ff d0                	call   *%rax
+}
+  804cca:	c9                   	leave
+  804ccb:	c3                   	ret
+
+0000000000804ccc <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804ccc:	55                   	push   %rbp
+  804ccd:	48 89 e5             	mov    %rsp,%rbp
+  804cd0:	48 83 ec 10          	sub    $0x10,%rsp
+  804cd4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804cd8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cdc:	8b 40 18             	mov    0x18(%rax),%eax
+  804cdf:	8d 50 01             	lea    0x1(%rax),%edx
+  804ce2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ce6:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804ce9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ced:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804cf0:	85 c0                	test   %eax,%eax
+  804cf2:	74 27                	je     804d1b <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804cf4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cf8:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804cff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d03:	48 83 c0 18          	add    $0x18,%rax
+  804d07:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804d0c:	48 89 c7             	mov    %rax,%rdi
+  804d0f:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  804d16:	00 00 00 
+  804d19:	ff d0                	call   *%rax
+  }
+}
+  804d1b:	90                   	nop
+  804d1c:	c9                   	leave
+  804d1d:	c3                   	ret
+
+0000000000804d1e <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804d1e:	55                   	push   %rbp
+  804d1f:	48 89 e5             	mov    %rsp,%rbp
+  804d22:	48 83 ec 10          	sub    $0x10,%rsp
+  804d26:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d2a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804d2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d31:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804d38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d3c:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804d40:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804d43:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804d4a:	89 c6                	mov    %eax,%esi
+  804d4c:	48 89 cf             	mov    %rcx,%rdi
+  804d4f:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  804d56:	00 00 00 
+  804d59:	ff d0                	call   *%rax
+}
+  804d5b:	90                   	nop
+  804d5c:	c9                   	leave
+  804d5d:	c3                   	ret
+
+0000000000804d5e <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d5e:	55                   	push   %rbp
+  804d5f:	48 89 e5             	mov    %rsp,%rbp
+  804d62:	48 83 ec 70          	sub    $0x70,%rsp
+  804d66:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804d6a:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804d6e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804d72:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d76:	48 89 c7             	mov    %rax,%rdi
+  804d79:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  804d80:	00 00 00 
+  804d83:	ff d0                	call   *%rax
+  804d85:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804d89:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804d8e:	75 0a                	jne    804d9a <devpipe_read+0x3c>
+    return 0;
+  804d90:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d95:	e9 63 01 00 00       	jmp    804efd <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804d9a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d9e:	8b 40 18             	mov    0x18(%rax),%eax
+  804da1:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804da4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804da8:	48 8b 10             	mov    (%rax),%rdx
+  804dab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804daf:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804db3:	48 39 c2             	cmp    %rax,%rdx
+  804db6:	75 42                	jne    804dfa <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804db8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804dbc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804dc0:	48 89 d6             	mov    %rdx,%rsi
+  804dc3:	48 89 c7             	mov    %rax,%rdi
+  804dc6:	48 b8 43 4b 80 00 00 	movabs $0x804b43,%rax
+  804dcd:	00 00 00 
+  804dd0:	ff d0                	call   *%rax
+  804dd2:	85 c0                	test   %eax,%eax
+  804dd4:	74 0a                	je     804de0 <devpipe_read+0x82>
+      return 0;
+  804dd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ddb:	e9 1d 01 00 00       	jmp    804efd <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804de0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804de3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804de7:	89 d6                	mov    %edx,%esi
+  804de9:	48 89 c7             	mov    %rax,%rdi
+  804dec:	48 b8 1e 4d 80 00 00 	movabs $0x804d1e,%rax
+  804df3:	00 00 00 
+  804df6:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804df8:	eb a0                	jmp    804d9a <devpipe_read+0x3c>
+      break;
+  804dfa:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804dfb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804dff:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804e03:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e07:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804e0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e0f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804e13:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e17:	48 8b 00             	mov    (%rax),%rax
+  804e1a:	48 29 c2             	sub    %rax,%rdx
+  804e1d:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804e21:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e25:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e29:	48 39 c2             	cmp    %rax,%rdx
+  804e2c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e30:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804e34:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e38:	48 8b 00             	mov    (%rax),%rax
+  804e3b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e3f:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804e43:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e48:	48 f7 f1             	div    %rcx
+  804e4b:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804e4f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e53:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804e57:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e5b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e5f:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804e63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804e67:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e6b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e6f:	48 39 c2             	cmp    %rax,%rdx
+  804e72:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e76:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804e7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e7e:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804e82:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e86:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804e8a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e92:	48 89 ce             	mov    %rcx,%rsi
+  804e95:	48 89 c7             	mov    %rax,%rdi
+  804e98:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  804e9f:	00 00 00 
+  804ea2:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804ea4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804ea8:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804eac:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804eb0:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804eb4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804eb8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804ebc:	48 01 d1             	add    %rdx,%rcx
+  804ebf:	48 89 c2             	mov    %rax,%rdx
+  804ec2:	48 89 cf             	mov    %rcx,%rdi
+  804ec5:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  804ecc:	00 00 00 
+  804ecf:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804ed1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ed5:	48 8b 10             	mov    (%rax),%rdx
+  804ed8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804edc:	48 01 c2             	add    %rax,%rdx
+  804edf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ee3:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804ee6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eea:	48 89 c7             	mov    %rax,%rdi
+  804eed:	48 b8 cc 4c 80 00 00 	movabs $0x804ccc,%rax
+  804ef4:	00 00 00 
+  804ef7:	ff d0                	call   *%rax
+  return n;
+  804ef9:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804efd:	c9                   	leave
+  804efe:	c3                   	ret
+
+0000000000804eff <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804eff:	55                   	push   %rbp
+  804f00:	48 89 e5             	mov    %rsp,%rbp
+  804f03:	48 83 ec 70          	sub    $0x70,%rsp
+  804f07:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804f0b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804f0f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804f13:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f17:	48 89 c7             	mov    %rax,%rdi
+  804f1a:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  804f21:	00 00 00 
+  804f24:	ff d0                	call   *%rax
+  804f26:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804f2a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804f2e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804f32:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804f39:	00 
+  804f3a:	e9 b8 01 00 00       	jmp    8050f7 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804f3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f43:	8b 40 18             	mov    0x18(%rax),%eax
+  804f46:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804f49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f4d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f55:	48 8b 00             	mov    (%rax),%rax
+  804f58:	48 29 c2             	sub    %rax,%rdx
+  804f5b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f5f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f63:	48 39 c2             	cmp    %rax,%rdx
+  804f66:	75 4d                	jne    804fb5 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804f68:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f6c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f70:	48 89 d6             	mov    %rdx,%rsi
+  804f73:	48 89 c7             	mov    %rax,%rdi
+  804f76:	48 b8 43 4b 80 00 00 	movabs $0x804b43,%rax
+  804f7d:	00 00 00 
+  804f80:	ff d0                	call   *%rax
+  804f82:	85 c0                	test   %eax,%eax
+  804f84:	74 0a                	je     804f90 <devpipe_write+0x91>
+        return 0;
+  804f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f8b:	e9 79 01 00 00       	jmp    805109 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804f90:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804f93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f97:	89 d6                	mov    %edx,%esi
+  804f99:	48 89 c7             	mov    %rax,%rdi
+  804f9c:	48 b8 1e 4d 80 00 00 	movabs $0x804d1e,%rax
+  804fa3:	00 00 00 
+  804fa6:	ff d0                	call   *%rax
+      m = 0;
+  804fa8:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804faf:	00 
+      continue;
+  804fb0:	e9 3a 01 00 00       	jmp    8050ef <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804fb5:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804fb9:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804fbd:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804fc1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fc5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804fc9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fcd:	48 8b 08             	mov    (%rax),%rcx
+  804fd0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fd4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804fd8:	48 29 c1             	sub    %rax,%rcx
+  804fdb:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804fdf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804fe3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804fe7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804feb:	48 39 c2             	cmp    %rax,%rdx
+  804fee:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804ff2:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804ff6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ffa:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804ffe:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805002:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  805006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80500b:	48 f7 f1             	div    %rcx
+  80500e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  805012:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805016:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80501a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80501e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805022:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805026:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  80502a:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80502e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805032:	48 39 c2             	cmp    %rax,%rdx
+  805035:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805039:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80503d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805041:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805045:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805049:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80504d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805051:	48 01 d1             	add    %rdx,%rcx
+  805054:	48 89 c2             	mov    %rax,%rdx
+  805057:	48 89 cf             	mov    %rcx,%rdi
+  80505a:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  805061:	00 00 00 
+  805064:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  805066:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80506a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80506e:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805072:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805076:	73 4d                	jae    8050c5 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  805078:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80507c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805080:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805084:	48 29 c2             	sub    %rax,%rdx
+  805087:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80508b:	48 01 c2             	add    %rax,%rdx
+  80508e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805092:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805096:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80509a:	48 89 c1             	mov    %rax,%rcx
+  80509d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050a1:	48 01 c1             	add    %rax,%rcx
+  8050a4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8050a8:	48 01 c1             	add    %rax,%rcx
+  8050ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050af:	48 83 c0 20          	add    $0x20,%rax
+  8050b3:	48 89 ce             	mov    %rcx,%rsi
+  8050b6:	48 89 c7             	mov    %rax,%rdi
+  8050b9:	48 b8 a4 1d 80 00 00 	movabs $0x801da4,%rax
+  8050c0:	00 00 00 
+  8050c3:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8050c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050c9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8050cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050d1:	48 01 c2             	add    %rax,%rdx
+  8050d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050d8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8050dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050e0:	48 89 c7             	mov    %rax,%rdi
+  8050e3:	48 b8 cc 4c 80 00 00 	movabs $0x804ccc,%rax
+  8050ea:	00 00 00 
+  8050ed:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8050ef:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050f3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8050f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050fb:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8050ff:	0f 82 3a fe ff ff    	jb     804f3f <devpipe_write+0x40>
+  }
+
+  return i;
+  805105:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805109:	c9                   	leave
+  80510a:	c3                   	ret
+
+000000000080510b <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80510b:	55                   	push   %rbp
+  80510c:	48 89 e5             	mov    %rsp,%rbp
+  80510f:	48 83 ec 40          	sub    $0x40,%rsp
+  805113:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805117:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  80511a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80511e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805122:	48 89 c7             	mov    %rax,%rdi
+  805125:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  80512c:	00 00 00 
+  80512f:	ff d0                	call   *%rax
+  805131:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805135:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80513c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805140:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805144:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805148:	48 89 d6             	mov    %rdx,%rsi
+  80514b:	48 89 c7             	mov    %rax,%rdi
+  80514e:	48 b8 e6 3d 80 00 00 	movabs $0x803de6,%rax
+  805155:	00 00 00 
+  805158:	ff d0                	call   *%rax
+  80515a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80515d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805161:	79 08                	jns    80516b <devpipe_poll+0x60>
+    return r;
+  805163:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805166:	e9 85 00 00 00       	jmp    8051f0 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  80516b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80516e:	83 e0 01             	and    $0x1,%eax
+  805171:	85 c0                	test   %eax,%eax
+  805173:	74 18                	je     80518d <devpipe_poll+0x82>
+  805175:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805179:	48 8b 10             	mov    (%rax),%rdx
+  80517c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805180:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805184:	48 39 c2             	cmp    %rax,%rdx
+  805187:	74 04                	je     80518d <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805189:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80518d:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  805190:	83 e0 02             	and    $0x2,%eax
+  805193:	85 c0                	test   %eax,%eax
+  805195:	74 23                	je     8051ba <devpipe_poll+0xaf>
+  805197:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80519b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80519f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051a3:	48 8b 00             	mov    (%rax),%rax
+  8051a6:	48 29 c2             	sub    %rax,%rdx
+  8051a9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051ad:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8051b1:	48 39 c2             	cmp    %rax,%rdx
+  8051b4:	73 04                	jae    8051ba <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  8051b6:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  8051ba:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8051be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051c2:	48 89 d6             	mov    %rdx,%rsi
+  8051c5:	48 89 c7             	mov    %rax,%rdi
+  8051c8:	48 b8 43 4b 80 00 00 	movabs $0x804b43,%rax
+  8051cf:	00 00 00 
+  8051d2:	ff d0                	call   *%rax
+  8051d4:	85 c0                	test   %eax,%eax
+  8051d6:	74 04                	je     8051dc <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8051d8:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8051dc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051e0:	75 0b                	jne    8051ed <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8051e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051e6:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8051ed:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8051f0:	c9                   	leave
+  8051f1:	c3                   	ret
+
+00000000008051f2 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8051f2:	55                   	push   %rbp
+  8051f3:	48 89 e5             	mov    %rsp,%rbp
+  8051f6:	48 83 ec 20          	sub    $0x20,%rsp
+  8051fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051fe:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805202:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805206:	48 89 c7             	mov    %rax,%rdi
+  805209:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  805210:	00 00 00 
+  805213:	ff d0                	call   *%rax
+  805215:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  805219:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80521d:	48 ba 21 6f 80 00 00 	movabs $0x806f21,%rdx
+  805224:	00 00 00 
+  805227:	48 89 d6             	mov    %rdx,%rsi
+  80522a:	48 89 c7             	mov    %rax,%rdi
+  80522d:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  805234:	00 00 00 
+  805237:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805239:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80523d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805241:	89 c1                	mov    %eax,%ecx
+  805243:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805247:	48 8b 00             	mov    (%rax),%rax
+  80524a:	89 c2                	mov    %eax,%edx
+  80524c:	89 c8                	mov    %ecx,%eax
+  80524e:	29 d0                	sub    %edx,%eax
+  805250:	89 c2                	mov    %eax,%edx
+  805252:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805256:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80525c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805260:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805267:	00 00 00 
+  stat->st_dev   = &devpipe;
+  80526a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80526e:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  805275:	00 00 00 
+  805278:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  80527f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805284:	c9                   	leave
+  805285:	c3                   	ret
+
+0000000000805286 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805286:	55                   	push   %rbp
+  805287:	48 89 e5             	mov    %rsp,%rbp
+  80528a:	48 83 ec 40          	sub    $0x40,%rsp
+  80528e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805292:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805296:	48 89 c7             	mov    %rax,%rdi
+  805299:	48 b8 13 33 80 00 00 	movabs $0x803313,%rax
+  8052a0:	00 00 00 
+  8052a3:	ff d0                	call   *%rax
+  8052a5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  8052a9:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  8052b0:	00 
+  8052b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052b5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8052b9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8052bd:	48 01 d0             	add    %rdx,%rax
+  8052c0:	48 83 c0 1f          	add    $0x1f,%rax
+  8052c4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8052c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052d1:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8052d5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052d9:	48 29 d0             	sub    %rdx,%rax
+  8052dc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8052e0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8052e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052e8:	48 89 c6             	mov    %rax,%rsi
+  8052eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052f0:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  8052f7:	00 00 00 
+  8052fa:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8052fc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805300:	48 89 c7             	mov    %rax,%rdi
+  805303:	48 b8 cc 4c 80 00 00 	movabs $0x804ccc,%rax
+  80530a:	00 00 00 
+  80530d:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  80530f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805313:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805317:	eb 2f                	jmp    805348 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  805319:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80531d:	48 83 e8 01          	sub    $0x1,%rax
+  805321:	48 c1 e0 0c          	shl    $0xc,%rax
+  805325:	48 89 c2             	mov    %rax,%rdx
+  805328:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80532c:	48 01 d0             	add    %rdx,%rax
+  80532f:	48 89 c6             	mov    %rax,%rsi
+  805332:	bf 00 00 00 00       	mov    $0x0,%edi
+  805337:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  80533e:	00 00 00 
+  805341:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805343:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805348:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80534d:	77 ca                	ja     805319 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  80534f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805353:	48 89 c6             	mov    %rax,%rsi
+  805356:	bf 00 00 00 00       	mov    $0x0,%edi
+  80535b:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  805362:	00 00 00 
+  805365:	ff d0                	call   *%rax
+}
+  805367:	c9                   	leave
+  805368:	c3                   	ret
+
+0000000000805369 <xchg>:
+  805369:	55                   	push   %rbp
+  80536a:	48 89 e5             	mov    %rsp,%rbp
+  80536d:	48 83 ec 20          	sub    $0x20,%rsp
+  805371:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805375:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805378:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80537c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80537f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805383:	f0 87 02             	lock xchg %eax,(%rdx)
+  805386:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805389:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80538c:	c9                   	leave
+  80538d:	c3                   	ret
+
+000000000080538e <cmpxchg>:
+  80538e:	55                   	push   %rbp
+  80538f:	48 89 e5             	mov    %rsp,%rbp
+  805392:	48 83 ec 20          	sub    $0x20,%rsp
+  805396:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80539a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80539d:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  8053a0:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8053a4:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8053a7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8053aa:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8053ae:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  8053b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8053b5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053b8:	c9                   	leave
+  8053b9:	c3                   	ret
+
+00000000008053ba <xadd>:
+  8053ba:	55                   	push   %rbp
+  8053bb:	48 89 e5             	mov    %rsp,%rbp
+  8053be:	48 83 ec 10          	sub    $0x10,%rsp
+  8053c2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8053c6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8053c9:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8053cd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053d0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8053d4:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  8053d8:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8053db:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8053de:	c9                   	leave
+  8053df:	c3                   	ret
+
+00000000008053e0 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  8053e0:	55                   	push   %rbp
+  8053e1:	48 89 e5             	mov    %rsp,%rbp
+  8053e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8053e8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  8053ec:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8053f0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8053f6:	90                   	nop
+  8053f7:	c9                   	leave
+  8053f8:	c3                   	ret
+
+00000000008053f9 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  8053f9:	55                   	push   %rbp
+  8053fa:	48 89 e5             	mov    %rsp,%rbp
+  8053fd:	48 83 ec 20          	sub    $0x20,%rsp
+  805401:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  805405:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805409:	ba 01 00 00 00       	mov    $0x1,%edx
+  80540e:	be 00 00 00 00       	mov    $0x0,%esi
+  805413:	48 89 c7             	mov    %rax,%rdi
+  805416:	48 b8 8e 53 80 00 00 	movabs $0x80538e,%rax
+  80541d:	00 00 00 
+  805420:	ff d0                	call   *%rax
+  805422:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805425:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805429:	74 65                	je     805490 <mutex_lock+0x97>
+  if (c != 2)
+  80542b:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  80542f:	74 57                	je     805488 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  805431:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805435:	be 02 00 00 00       	mov    $0x2,%esi
+  80543a:	48 89 c7             	mov    %rax,%rdi
+  80543d:	48 b8 69 53 80 00 00 	movabs $0x805369,%rax
+  805444:	00 00 00 
+  805447:	ff d0                	call   *%rax
+  805449:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  80544c:	eb 3a                	jmp    805488 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  80544e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805452:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805459:	be 02 00 00 00       	mov    $0x2,%esi
+  80545e:	48 89 c7             	mov    %rax,%rdi
+  805461:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  805468:	00 00 00 
+  80546b:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  80546d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805471:	be 02 00 00 00       	mov    $0x2,%esi
+  805476:	48 89 c7             	mov    %rax,%rdi
+  805479:	48 b8 69 53 80 00 00 	movabs $0x805369,%rax
+  805480:	00 00 00 
+  805483:	ff d0                	call   *%rax
+  805485:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  805488:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80548c:	75 c0                	jne    80544e <mutex_lock+0x55>
+  80548e:	eb 01                	jmp    805491 <mutex_lock+0x98>
+    return;
+  805490:	90                   	nop
+}
+  805491:	c9                   	leave
+  805492:	c3                   	ret
+
+0000000000805493 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  805493:	55                   	push   %rbp
+  805494:	48 89 e5             	mov    %rsp,%rbp
+  805497:	48 83 ec 08          	sub    $0x8,%rsp
+  80549b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  80549f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054a3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8054a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8054ad:	48 89 c7             	mov    %rax,%rdi
+  8054b0:	48 b8 8e 53 80 00 00 	movabs $0x80538e,%rax
+  8054b7:	00 00 00 
+  8054ba:	ff d0                	call   *%rax
+  8054bc:	85 c0                	test   %eax,%eax
+  8054be:	75 07                	jne    8054c7 <mutex_trylock+0x34>
+  8054c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054c5:	eb 05                	jmp    8054cc <mutex_trylock+0x39>
+  8054c7:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  8054cc:	c9                   	leave
+  8054cd:	c3                   	ret
+
+00000000008054ce <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  8054ce:	55                   	push   %rbp
+  8054cf:	48 89 e5             	mov    %rsp,%rbp
+  8054d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8054d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  8054da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054de:	be 00 00 00 00       	mov    $0x0,%esi
+  8054e3:	48 89 c7             	mov    %rax,%rdi
+  8054e6:	48 b8 69 53 80 00 00 	movabs $0x805369,%rax
+  8054ed:	00 00 00 
+  8054f0:	ff d0                	call   *%rax
+  8054f2:	83 f8 02             	cmp    $0x2,%eax
+  8054f5:	75 18                	jne    80550f <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  8054f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054fb:	be 01 00 00 00       	mov    $0x1,%esi
+  805500:	48 89 c7             	mov    %rax,%rdi
+  805503:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  80550a:	00 00 00 
+  80550d:	ff d0                	call   *%rax
+}
+  80550f:	90                   	nop
+  805510:	c9                   	leave
+  805511:	c3                   	ret
+
+0000000000805512 <cond_init>:
+cond_init(struct Cond *c) {
+  805512:	55                   	push   %rbp
+  805513:	48 89 e5             	mov    %rsp,%rbp
+  805516:	48 83 ec 08          	sub    $0x8,%rsp
+  80551a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  80551e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805522:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  805528:	90                   	nop
+  805529:	c9                   	leave
+  80552a:	c3                   	ret
+
+000000000080552b <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  80552b:	55                   	push   %rbp
+  80552c:	48 89 e5             	mov    %rsp,%rbp
+  80552f:	48 83 ec 30          	sub    $0x30,%rsp
+  805533:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805537:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80553b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  80553f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805543:	8b 00                	mov    (%rax),%eax
+  805545:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  805548:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80554c:	48 89 c7             	mov    %rax,%rdi
+  80554f:	48 b8 ce 54 80 00 00 	movabs $0x8054ce,%rax
+  805556:	00 00 00 
+  805559:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  80555b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80555f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805563:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  805566:	89 ce                	mov    %ecx,%esi
+  805568:	48 89 c7             	mov    %rax,%rdi
+  80556b:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  805572:	00 00 00 
+  805575:	ff d0                	call   *%rax
+  805577:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  80557a:	eb 1f                	jmp    80559b <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  80557c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805580:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805587:	be 02 00 00 00       	mov    $0x2,%esi
+  80558c:	48 89 c7             	mov    %rax,%rdi
+  80558f:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  805596:	00 00 00 
+  805599:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  80559b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80559f:	be 02 00 00 00       	mov    $0x2,%esi
+  8055a4:	48 89 c7             	mov    %rax,%rdi
+  8055a7:	48 b8 69 53 80 00 00 	movabs $0x805369,%rax
+  8055ae:	00 00 00 
+  8055b1:	ff d0                	call   *%rax
+  8055b3:	85 c0                	test   %eax,%eax
+  8055b5:	75 c5                	jne    80557c <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  8055b7:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  8055bb:	75 07                	jne    8055c4 <cond_timedwait+0x99>
+  8055bd:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8055c2:	eb 05                	jmp    8055c9 <cond_timedwait+0x9e>
+  8055c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055c9:	c9                   	leave
+  8055ca:	c3                   	ret
+
+00000000008055cb <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  8055cb:	55                   	push   %rbp
+  8055cc:	48 89 e5             	mov    %rsp,%rbp
+  8055cf:	48 83 ec 10          	sub    $0x10,%rsp
+  8055d3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8055d7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  8055db:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8055df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055e3:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8055ea:	48 89 ce             	mov    %rcx,%rsi
+  8055ed:	48 89 c7             	mov    %rax,%rdi
+  8055f0:	48 b8 2b 55 80 00 00 	movabs $0x80552b,%rax
+  8055f7:	00 00 00 
+  8055fa:	ff d0                	call   *%rax
+}
+  8055fc:	90                   	nop
+  8055fd:	c9                   	leave
+  8055fe:	c3                   	ret
+
+00000000008055ff <cond_signal>:
+cond_signal(struct Cond *c) {
+  8055ff:	55                   	push   %rbp
+  805600:	48 89 e5             	mov    %rsp,%rbp
+  805603:	48 83 ec 10          	sub    $0x10,%rsp
+  805607:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80560b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80560f:	be 01 00 00 00       	mov    $0x1,%esi
+  805614:	48 89 c7             	mov    %rax,%rdi
+  805617:	48 b8 ba 53 80 00 00 	movabs $0x8053ba,%rax
+  80561e:	00 00 00 
+  805621:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  805623:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805627:	be 01 00 00 00       	mov    $0x1,%esi
+  80562c:	48 89 c7             	mov    %rax,%rdi
+  80562f:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  805636:	00 00 00 
+  805639:	ff d0                	call   *%rax
+}
+  80563b:	90                   	nop
+  80563c:	c9                   	leave
+  80563d:	c3                   	ret
+
+000000000080563e <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  80563e:	55                   	push   %rbp
+  80563f:	48 89 e5             	mov    %rsp,%rbp
+  805642:	48 83 ec 10          	sub    $0x10,%rsp
+  805646:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80564a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80564e:	be 01 00 00 00       	mov    $0x1,%esi
+  805653:	48 89 c7             	mov    %rax,%rdi
+  805656:	48 b8 ba 53 80 00 00 	movabs $0x8053ba,%rax
+  80565d:	00 00 00 
+  805660:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  805662:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805666:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80566b:	48 89 c7             	mov    %rax,%rdi
+  80566e:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  805675:	00 00 00 
+  805678:	ff d0                	call   *%rax
+}
+  80567a:	90                   	nop
+  80567b:	c9                   	leave
+  80567c:	c3                   	ret
+
+000000000080567d <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  80567d:	55                   	push   %rbp
+  80567e:	48 89 e5             	mov    %rsp,%rbp
+  805681:	48 83 ec 10          	sub    $0x10,%rsp
+  805685:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805689:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  80568c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805690:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805693:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  805695:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805699:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  8056a0:	90                   	nop
+  8056a1:	c9                   	leave
+  8056a2:	c3                   	ret
+
+00000000008056a3 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  8056a3:	55                   	push   %rbp
+  8056a4:	48 89 e5             	mov    %rsp,%rbp
+  8056a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8056ab:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  8056af:	eb 2a                	jmp    8056db <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  8056b1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8056b4:	8d 50 ff             	lea    -0x1(%rax),%edx
+  8056b7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056bb:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8056be:	89 ce                	mov    %ecx,%esi
+  8056c0:	48 89 c7             	mov    %rax,%rdi
+  8056c3:	48 b8 8e 53 80 00 00 	movabs $0x80538e,%rax
+  8056ca:	00 00 00 
+  8056cd:	ff d0                	call   *%rax
+  8056cf:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  8056d2:	75 07                	jne    8056db <sem_trywait+0x38>
+      return 0;
+  8056d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8056d9:	eb 14                	jmp    8056ef <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  8056db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8056df:	8b 00                	mov    (%rax),%eax
+  8056e1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8056e4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056e8:	75 c7                	jne    8056b1 <sem_trywait+0xe>
+  return -E_BUSY;
+  8056ea:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  8056ef:	c9                   	leave
+  8056f0:	c3                   	ret
+
+00000000008056f1 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  8056f1:	55                   	push   %rbp
+  8056f2:	48 89 e5             	mov    %rsp,%rbp
+  8056f5:	48 83 ec 30          	sub    $0x30,%rsp
+  8056f9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8056fd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  805701:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805708:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  805709:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80570e:	0f 84 fb 00 00 00    	je     80580f <sem_timedwait+0x11e>
+  805714:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805719:	0f 84 f0 00 00 00    	je     80580f <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  80571f:	48 b8 22 5d 80 00 00 	movabs $0x805d22,%rax
+  805726:	00 00 00 
+  805729:	ff d0                	call   *%rax
+  80572b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80572f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805733:	48 f7 d0             	not    %rax
+  805736:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  80573a:	73 0d                	jae    805749 <sem_timedwait+0x58>
+  80573c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  805740:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805744:	48 01 d0             	add    %rdx,%rax
+  805747:	eb 07                	jmp    805750 <sem_timedwait+0x5f>
+  805749:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  805750:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  805754:	e9 b6 00 00 00       	jmp    80580f <sem_timedwait+0x11e>
+    if (deadline) {
+  805759:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80575e:	74 2d                	je     80578d <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  805760:	48 b8 22 5d 80 00 00 	movabs $0x805d22,%rax
+  805767:	00 00 00 
+  80576a:	ff d0                	call   *%rax
+  80576c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  805770:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805774:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805778:	73 0a                	jae    805784 <sem_timedwait+0x93>
+  80577a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80577e:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  805782:	eb 05                	jmp    805789 <sem_timedwait+0x98>
+  805784:	b8 00 00 00 00       	mov    $0x0,%eax
+  805789:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  80578d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805791:	48 83 c0 04          	add    $0x4,%rax
+  805795:	be 01 00 00 00       	mov    $0x1,%esi
+  80579a:	48 89 c7             	mov    %rax,%rdi
+  80579d:	48 b8 ba 53 80 00 00 	movabs $0x8053ba,%rax
+  8057a4:	00 00 00 
+  8057a7:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  8057a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057ad:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8057b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8057b6:	48 89 c7             	mov    %rax,%rdi
+  8057b9:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  8057c0:	00 00 00 
+  8057c3:	ff d0                	call   *%rax
+  8057c5:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  8057c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057cc:	48 83 c0 04          	add    $0x4,%rax
+  8057d0:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8057d5:	48 89 c7             	mov    %rax,%rdi
+  8057d8:	48 b8 ba 53 80 00 00 	movabs $0x8053ba,%rax
+  8057df:	00 00 00 
+  8057e2:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  8057e4:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  8057e8:	75 25                	jne    80580f <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  8057ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8057ee:	48 89 c7             	mov    %rax,%rdi
+  8057f1:	48 b8 a3 56 80 00 00 	movabs $0x8056a3,%rax
+  8057f8:	00 00 00 
+  8057fb:	ff d0                	call   *%rax
+  8057fd:	85 c0                	test   %eax,%eax
+  8057ff:	79 07                	jns    805808 <sem_timedwait+0x117>
+  805801:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805806:	eb 27                	jmp    80582f <sem_timedwait+0x13e>
+  805808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80580d:	eb 20                	jmp    80582f <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  80580f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805813:	48 89 c7             	mov    %rax,%rdi
+  805816:	48 b8 a3 56 80 00 00 	movabs $0x8056a3,%rax
+  80581d:	00 00 00 
+  805820:	ff d0                	call   *%rax
+  805822:	85 c0                	test   %eax,%eax
+  805824:	0f 88 2f ff ff ff    	js     805759 <sem_timedwait+0x68>
+  return 0;
+  80582a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80582f:	c9                   	leave
+  805830:	c3                   	ret
+
+0000000000805831 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  805831:	55                   	push   %rbp
+  805832:	48 89 e5             	mov    %rsp,%rbp
+  805835:	48 83 ec 10          	sub    $0x10,%rsp
+  805839:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  80583d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805841:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  805848:	48 89 c7             	mov    %rax,%rdi
+  80584b:	48 b8 f1 56 80 00 00 	movabs $0x8056f1,%rax
+  805852:	00 00 00 
+  805855:	ff d0                	call   *%rax
+}
+  805857:	90                   	nop
+  805858:	c9                   	leave
+  805859:	c3                   	ret
+
+000000000080585a <sem_post>:
+sem_post(struct Semaphore *s) {
+  80585a:	55                   	push   %rbp
+  80585b:	48 89 e5             	mov    %rsp,%rbp
+  80585e:	48 83 ec 10          	sub    $0x10,%rsp
+  805862:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  805866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80586a:	be 01 00 00 00       	mov    $0x1,%esi
+  80586f:	48 89 c7             	mov    %rax,%rdi
+  805872:	48 b8 ba 53 80 00 00 	movabs $0x8053ba,%rax
+  805879:	00 00 00 
+  80587c:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  80587e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805882:	8b 40 04             	mov    0x4(%rax),%eax
+  805885:	85 c0                	test   %eax,%eax
+  805887:	74 18                	je     8058a1 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  805889:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80588d:	be 01 00 00 00       	mov    $0x1,%esi
+  805892:	48 89 c7             	mov    %rax,%rdi
+  805895:	48 b8 24 28 80 00 00 	movabs $0x802824,%rax
+  80589c:	00 00 00 
+  80589f:	ff d0                	call   *%rax
+}
+  8058a1:	90                   	nop
+  8058a2:	c9                   	leave
+  8058a3:	c3                   	ret
+
+00000000008058a4 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  8058a4:	55                   	push   %rbp
+  8058a5:	48 89 e5             	mov    %rsp,%rbp
+  8058a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8058ac:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8058b0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  8058b4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8058bc:	48 89 c7             	mov    %rax,%rdi
+  8058bf:	ff d2                	call   *%rdx
+  thread_exit(0);
+  8058c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058c6:	48 b8 08 5b 80 00 00 	movabs $0x805b08,%rax
+  8058cd:	00 00 00 
+  8058d0:	ff d0                	call   *%rax
+}
+  8058d2:	90                   	nop
+  8058d3:	c9                   	leave
+  8058d4:	c3                   	ret
+
+00000000008058d5 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  8058d5:	55                   	push   %rbp
+  8058d6:	48 89 e5             	mov    %rsp,%rbp
+  8058d9:	48 83 ec 20          	sub    $0x20,%rsp
+  8058dd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  8058e0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058e3:	c1 e0 10             	shl    $0x10,%eax
+  8058e6:	48 98                	cltq
+  8058e8:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8058ed:	48 01 d0             	add    %rdx,%rax
+  8058f0:	48 89 c6             	mov    %rax,%rsi
+  8058f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8058f8:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  8058ff:	00 00 00 
+  805902:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805904:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805907:	83 c0 01             	add    $0x1,%eax
+  80590a:	c1 e0 10             	shl    $0x10,%eax
+  80590d:	48 98                	cltq
+  80590f:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805914:	48 01 d0             	add    %rdx,%rax
+  805917:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80591b:	eb 20                	jmp    80593d <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  80591d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805921:	48 89 c6             	mov    %rax,%rsi
+  805924:	bf 00 00 00 00       	mov    $0x0,%edi
+  805929:	48 b8 e1 24 80 00 00 	movabs $0x8024e1,%rax
+  805930:	00 00 00 
+  805933:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805935:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  80593c:	00 
+  80593d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805940:	83 c0 01             	add    $0x1,%eax
+  805943:	c1 e0 10             	shl    $0x10,%eax
+  805946:	48 98                	cltq
+  805948:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  80594d:	48 01 d0             	add    %rdx,%rax
+  805950:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805954:	72 c7                	jb     80591d <slot_unmap+0x48>
+}
+  805956:	90                   	nop
+  805957:	90                   	nop
+  805958:	c9                   	leave
+  805959:	c3                   	ret
+
+000000000080595a <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  80595a:	55                   	push   %rbp
+  80595b:	48 89 e5             	mov    %rsp,%rbp
+  80595e:	48 83 ec 30          	sub    $0x30,%rsp
+  805962:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  805966:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  80596a:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805971:	00 00 00 
+  805974:	48 89 c7             	mov    %rax,%rdi
+  805977:	48 b8 f9 53 80 00 00 	movabs $0x8053f9,%rax
+  80597e:	00 00 00 
+  805981:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  805983:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80598a:	eb 04                	jmp    805990 <thread_create+0x36>
+  80598c:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  805990:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  805994:	7f 16                	jg     8059ac <thread_create+0x52>
+  805996:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  80599d:	00 00 00 
+  8059a0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8059a3:	48 98                	cltq
+  8059a5:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  8059a8:	85 c0                	test   %eax,%eax
+  8059aa:	75 e0                	jne    80598c <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  8059ac:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  8059b0:	75 0c                	jne    8059be <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  8059b2:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  8059b9:	e9 2c 01 00 00       	jmp    805aea <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  8059be:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8059c1:	c1 e0 10             	shl    $0x10,%eax
+  8059c4:	48 98                	cltq
+  8059c6:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  8059cb:	48 01 d0             	add    %rdx,%rax
+  8059ce:	ba 07 00 00 00       	mov    $0x7,%edx
+  8059d3:	48 89 c6             	mov    %rax,%rsi
+  8059d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059db:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  8059e2:	00 00 00 
+  8059e5:	ff d0                	call   *%rax
+  8059e7:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  8059ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8059ee:	0f 88 f5 00 00 00    	js     805ae9 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  8059f4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8059f7:	83 c0 01             	add    $0x1,%eax
+  8059fa:	c1 e0 10             	shl    $0x10,%eax
+  8059fd:	48 98                	cltq
+  8059ff:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805a04:	48 01 d0             	add    %rdx,%rax
+  805a07:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805a0b:	eb 32                	jmp    805a3f <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805a0d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a11:	ba 07 00 00 00       	mov    $0x7,%edx
+  805a16:	48 89 c6             	mov    %rax,%rsi
+  805a19:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a1e:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  805a25:	00 00 00 
+  805a28:	ff d0                	call   *%rax
+  805a2a:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805a2d:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805a31:	0f 88 9e 00 00 00    	js     805ad5 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805a37:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805a3e:	00 
+  805a3f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805a42:	83 c0 01             	add    $0x1,%eax
+  805a45:	c1 e0 10             	shl    $0x10,%eax
+  805a48:	48 98                	cltq
+  805a4a:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805a4f:	48 01 d0             	add    %rdx,%rax
+  805a52:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805a56:	72 b5                	jb     805a0d <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805a58:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805a5c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805a60:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805a63:	c1 e2 10             	shl    $0x10,%edx
+  805a66:	48 63 d2             	movslq %edx,%rdx
+  805a69:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805a6e:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  805a71:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  805a74:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805a77:	83 c2 01             	add    $0x1,%edx
+  805a7a:	c1 e2 10             	shl    $0x10,%edx
+  805a7d:	48 63 d2             	movslq %edx,%rdx
+  805a80:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  805a85:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  805a88:	48 bf a4 58 80 00 00 	movabs $0x8058a4,%rdi
+  805a8f:	00 00 00 
+  805a92:	49 89 c8             	mov    %rcx,%r8
+  805a95:	48 89 c1             	mov    %rax,%rcx
+  805a98:	4c 89 ca             	mov    %r9,%rdx
+  805a9b:	48 b8 c9 28 80 00 00 	movabs $0x8028c9,%rax
+  805aa2:	00 00 00 
+  805aa5:	ff d0                	call   *%rax
+  805aa7:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  805aaa:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805aae:	79 08                	jns    805ab8 <thread_create+0x15e>
+    r = id;
+  805ab0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805ab3:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  805ab6:	eb 1e                	jmp    805ad6 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  805ab8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805abb:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805abe:	48 b9 40 90 80 00 00 	movabs $0x809040,%rcx
+  805ac5:	00 00 00 
+  805ac8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805acb:	48 98                	cltq
+  805acd:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  805ad0:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  805ad3:	eb 15                	jmp    805aea <thread_create+0x190>
+      goto fail;
+  805ad5:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  805ad6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805ad9:	89 c7                	mov    %eax,%edi
+  805adb:	48 b8 d5 58 80 00 00 	movabs $0x8058d5,%rax
+  805ae2:	00 00 00 
+  805ae5:	ff d0                	call   *%rax
+  805ae7:	eb 01                	jmp    805aea <thread_create+0x190>
+    goto out;
+  805ae9:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  805aea:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805af1:	00 00 00 
+  805af4:	48 89 c7             	mov    %rax,%rdi
+  805af7:	48 b8 ce 54 80 00 00 	movabs $0x8054ce,%rax
+  805afe:	00 00 00 
+  805b01:	ff d0                	call   *%rax
+  return r;
+  805b03:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805b06:	c9                   	leave
+  805b07:	c3                   	ret
+
+0000000000805b08 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  805b08:	55                   	push   %rbp
+  805b09:	48 89 e5             	mov    %rsp,%rbp
+  805b0c:	48 83 ec 10          	sub    $0x10,%rsp
+  805b10:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805b13:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b16:	89 c7                	mov    %eax,%edi
+  805b18:	48 b8 26 29 80 00 00 	movabs $0x802926,%rax
+  805b1f:	00 00 00 
+  805b22:	ff d0                	call   *%rax
+}
+  805b24:	90                   	nop
+  805b25:	c9                   	leave
+  805b26:	c3                   	ret
+
+0000000000805b27 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  805b27:	55                   	push   %rbp
+  805b28:	48 89 e5             	mov    %rsp,%rbp
+  805b2b:	48 83 ec 20          	sub    $0x20,%rsp
+  805b2f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805b32:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805b36:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805b3d:	00 00 00 
+  805b40:	48 89 c7             	mov    %rax,%rdi
+  805b43:	48 b8 f9 53 80 00 00 	movabs $0x8053f9,%rax
+  805b4a:	00 00 00 
+  805b4d:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  805b4f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805b56:	eb 04                	jmp    805b5c <thread_join+0x35>
+  805b58:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805b5c:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805b60:	7f 17                	jg     805b79 <thread_join+0x52>
+  805b62:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805b69:	00 00 00 
+  805b6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b6f:	48 98                	cltq
+  805b71:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805b74:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805b77:	75 df                	jne    805b58 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  805b79:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805b80:	00 00 00 
+  805b83:	48 89 c7             	mov    %rax,%rdi
+  805b86:	48 b8 ce 54 80 00 00 	movabs $0x8054ce,%rax
+  805b8d:	00 00 00 
+  805b90:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  805b92:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b96:	74 06                	je     805b9e <thread_join+0x77>
+  805b98:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  805b9c:	75 07                	jne    805ba5 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  805b9e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805ba3:	eb 76                	jmp    805c1b <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  805ba5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805ba9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805bac:	48 89 d6             	mov    %rdx,%rsi
+  805baf:	89 c7                	mov    %eax,%edi
+  805bb1:	48 b8 29 66 80 00 00 	movabs $0x806629,%rax
+  805bb8:	00 00 00 
+  805bbb:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  805bbd:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805bc4:	00 00 00 
+  805bc7:	48 89 c7             	mov    %rax,%rdi
+  805bca:	48 b8 f9 53 80 00 00 	movabs $0x8053f9,%rax
+  805bd1:	00 00 00 
+  805bd4:	ff d0                	call   *%rax
+  slot_unmap(i);
+  805bd6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bd9:	89 c7                	mov    %eax,%edi
+  805bdb:	48 b8 d5 58 80 00 00 	movabs $0x8058d5,%rax
+  805be2:	00 00 00 
+  805be5:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  805be7:	48 ba 40 90 80 00 00 	movabs $0x809040,%rdx
+  805bee:	00 00 00 
+  805bf1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bf4:	48 98                	cltq
+  805bf6:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805bfd:	48 b8 20 90 80 00 00 	movabs $0x809020,%rax
+  805c04:	00 00 00 
+  805c07:	48 89 c7             	mov    %rax,%rdi
+  805c0a:	48 b8 ce 54 80 00 00 	movabs $0x8054ce,%rax
+  805c11:	00 00 00 
+  805c14:	ff d0                	call   *%rax
+  return 0;
+  805c16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c1b:	c9                   	leave
+  805c1c:	c3                   	ret
+
+0000000000805c1d <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805c1d:	55                   	push   %rbp
+  805c1e:	48 89 e5             	mov    %rsp,%rbp
+  805c21:	48 83 ec 08          	sub    $0x8,%rsp
+  805c25:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805c29:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805c2e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805c32:	73 23                	jae    805c57 <thread_is_uxstack+0x3a>
+  805c34:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805c39:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805c3d:	72 18                	jb     805c57 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805c3f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805c43:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805c48:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805c4e:	75 07                	jne    805c57 <thread_is_uxstack+0x3a>
+  805c50:	b8 01 00 00 00       	mov    $0x1,%eax
+  805c55:	eb 05                	jmp    805c5c <thread_is_uxstack+0x3f>
+  805c57:	b8 00 00 00 00       	mov    $0x0,%eax
+  805c5c:	83 e0 01             	and    $0x1,%eax
+}
+  805c5f:	c9                   	leave
+  805c60:	c3                   	ret
+
+0000000000805c61 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805c61:	55                   	push   %rbp
+  805c62:	48 89 e5             	mov    %rsp,%rbp
+  805c65:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805c69:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805c70:	00 00 00 
+  805c73:	8b 40 04             	mov    0x4(%rax),%eax
+  805c76:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805c7b:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c82:	00 00 00 
+  805c85:	48 98                	cltq
+  805c87:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c8e:	48 01 d0             	add    %rdx,%rax
+  805c91:	48 05 08 01 00 00    	add    $0x108,%rax
+  805c97:	48 8b 00             	mov    (%rax),%rax
+  805c9a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  805c9e:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805ca3:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805ca7:	73 0b                	jae    805cb4 <thread_pftemp+0x53>
+  805ca9:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805cae:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805cb2:	73 07                	jae    805cbb <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  805cb4:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  805cb9:	eb 26                	jmp    805ce1 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  805cbb:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  805cc2:	ff ff ff 
+  805cc5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805cc9:	48 01 d0             	add    %rdx,%rax
+  805ccc:	48 c1 e8 10          	shr    $0x10,%rax
+  805cd0:	48 83 c0 01          	add    $0x1,%rax
+  805cd4:	48 c1 e0 0c          	shl    $0xc,%rax
+  805cd8:	48 f7 d8             	neg    %rax
+  805cdb:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  805ce1:	c9                   	leave
+  805ce2:	c3                   	ret
+
+0000000000805ce3 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805ce3:	55                   	push   %rbp
+  805ce4:	48 89 e5             	mov    %rsp,%rbp
+  805ce7:	48 83 ec 08          	sub    $0x8,%rsp
+  805ceb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805cee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805cf2:	75 10                	jne    805d04 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805cf4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805cfb:	00 00 00 
+  805cfe:	8b 00                	mov    (%rax),%eax
+  805d00:	48 98                	cltq
+  805d02:	eb 05                	jmp    805d09 <vsyscall+0x26>
+  }
+  return 0;
+  805d04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d09:	c9                   	leave
+  805d0a:	c3                   	ret
+
+0000000000805d0b <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805d0b:	55                   	push   %rbp
+  805d0c:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805d0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d14:	48 b8 e3 5c 80 00 00 	movabs $0x805ce3,%rax
+  805d1b:	00 00 00 
+  805d1e:	ff d0                	call   *%rax
+}
+  805d20:	5d                   	pop    %rbp
+  805d21:	c3                   	ret
+
+0000000000805d22 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805d22:	55                   	push   %rbp
+  805d23:	48 89 e5             	mov    %rsp,%rbp
+  805d26:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805d2a:	0f 31                	rdtsc
+  805d2c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805d2f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805d32:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805d35:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805d38:	48 c1 e2 20          	shl    $0x20,%rdx
+  805d3c:	48 09 d0             	or     %rdx,%rax
+  805d3f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805d43:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805d47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805d4b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d52:	00 00 00 
+  805d55:	8b 40 08             	mov    0x8(%rax),%eax
+  805d58:	48 98                	cltq
+  805d5a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805d5e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d62:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d67:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805d6b:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805d72:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d7b:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805d7f:	48 89 d0             	mov    %rdx,%rax
+  805d82:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  805d8e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805d92:	48 01 c8             	add    %rcx,%rax
+}
+  805d95:	c9                   	leave
+  805d96:	c3                   	ret
+
+0000000000805d97 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805d97:	55                   	push   %rbp
+  805d98:	48 89 e5             	mov    %rsp,%rbp
+  805d9b:	48 83 ec 20          	sub    $0x20,%rsp
+  805d9f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805da2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805da5:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805da8:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805dac:	be 01 00 00 00       	mov    $0x1,%esi
+  805db1:	48 89 c7             	mov    %rax,%rdi
+  805db4:	48 b8 12 22 80 00 00 	movabs $0x802212,%rax
+  805dbb:	00 00 00 
+  805dbe:	ff d0                	call   *%rax
+}
+  805dc0:	90                   	nop
+  805dc1:	c9                   	leave
+  805dc2:	c3                   	ret
+
+0000000000805dc3 <getchar>:
+
+int
+getchar(void) {
+  805dc3:	55                   	push   %rbp
+  805dc4:	48 89 e5             	mov    %rsp,%rbp
+  805dc7:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805dcb:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805dcf:	ba 01 00 00 00       	mov    $0x1,%edx
+  805dd4:	48 89 c6             	mov    %rax,%rsi
+  805dd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ddc:	48 b8 7c 39 80 00 00 	movabs $0x80397c,%rax
+  805de3:	00 00 00 
+  805de6:	ff d0                	call   *%rax
+  805de8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805deb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805def:	79 05                	jns    805df6 <getchar+0x33>
+    return r;
+  805df1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805df4:	eb 14                	jmp    805e0a <getchar+0x47>
+  if (r < 1)
+  805df6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805dfa:	7f 07                	jg     805e03 <getchar+0x40>
+    return -E_EOF;
+  805dfc:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805e01:	eb 07                	jmp    805e0a <getchar+0x47>
+  return c;
+  805e03:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805e07:	0f b6 c0             	movzbl %al,%eax
+}
+  805e0a:	c9                   	leave
+  805e0b:	c3                   	ret
+
+0000000000805e0c <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805e0c:	55                   	push   %rbp
+  805e0d:	48 89 e5             	mov    %rsp,%rbp
+  805e10:	48 83 ec 20          	sub    $0x20,%rsp
+  805e14:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805e17:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805e1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e1e:	48 89 d6             	mov    %rdx,%rsi
+  805e21:	89 c7                	mov    %eax,%edi
+  805e23:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  805e2a:	00 00 00 
+  805e2d:	ff d0                	call   *%rax
+  805e2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805e32:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e36:	79 05                	jns    805e3d <iscons+0x31>
+    return r;
+  805e38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e3b:	eb 1a                	jmp    805e57 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805e3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805e41:	8b 10                	mov    (%rax),%edx
+  805e43:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805e4a:	00 00 00 
+  805e4d:	8b 00                	mov    (%rax),%eax
+  805e4f:	39 c2                	cmp    %eax,%edx
+  805e51:	0f 94 c0             	sete   %al
+  805e54:	0f b6 c0             	movzbl %al,%eax
+}
+  805e57:	c9                   	leave
+  805e58:	c3                   	ret
+
+0000000000805e59 <opencons>:
+
+int
+opencons(void) {
+  805e59:	55                   	push   %rbp
+  805e5a:	48 89 e5             	mov    %rsp,%rbp
+  805e5d:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805e61:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805e65:	48 89 c7             	mov    %rax,%rdi
+  805e68:	48 b8 3e 33 80 00 00 	movabs $0x80333e,%rax
+  805e6f:	00 00 00 
+  805e72:	ff d0                	call   *%rax
+  805e74:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805e77:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e7b:	79 05                	jns    805e82 <opencons+0x29>
+    return r;
+  805e7d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e80:	eb 66                	jmp    805ee8 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805e82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805e86:	ba 07 04 00 00       	mov    $0x407,%edx
+  805e8b:	48 89 c6             	mov    %rax,%rsi
+  805e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e93:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  805e9a:	00 00 00 
+  805e9d:	ff d0                	call   *%rax
+  805e9f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ea2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ea6:	79 05                	jns    805ead <opencons+0x54>
+    return r;
+  805ea8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805eab:	eb 3b                	jmp    805ee8 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805ead:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805eb1:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  805eb8:	00 00 00 
+  805ebb:	8b 12                	mov    (%rdx),%edx
+  805ebd:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805ebf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ec3:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805eca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ece:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805ed5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ed9:	48 89 c7             	mov    %rax,%rdi
+  805edc:	48 b8 f0 32 80 00 00 	movabs $0x8032f0,%rax
+  805ee3:	00 00 00 
+  805ee6:	ff d0                	call   *%rax
+}
+  805ee8:	c9                   	leave
+  805ee9:	c3                   	ret
+
+0000000000805eea <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805eea:	55                   	push   %rbp
+  805eeb:	48 89 e5             	mov    %rsp,%rbp
+  805eee:	48 83 ec 20          	sub    $0x20,%rsp
+  805ef2:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805ef5:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805ef8:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805efc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805eff:	48 89 d6             	mov    %rdx,%rsi
+  805f02:	89 c7                	mov    %eax,%edi
+  805f04:	48 b8 20 34 80 00 00 	movabs $0x803420,%rax
+  805f0b:	00 00 00 
+  805f0e:	ff d0                	call   *%rax
+  805f10:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f13:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f17:	79 05                	jns    805f1e <consmode+0x34>
+    return r;
+  805f19:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f1c:	eb 34                	jmp    805f52 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805f1e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f22:	8b 10                	mov    (%rax),%edx
+  805f24:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805f2b:	00 00 00 
+  805f2e:	8b 00                	mov    (%rax),%eax
+  805f30:	39 c2                	cmp    %eax,%edx
+  805f32:	74 07                	je     805f3b <consmode+0x51>
+    return -E_INVAL;
+  805f34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805f39:	eb 17                	jmp    805f52 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805f3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f3f:	8b 40 0c             	mov    0xc(%rax),%eax
+  805f42:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805f45:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f49:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805f4c:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805f4f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805f52:	c9                   	leave
+  805f53:	c3                   	ret
+
+0000000000805f54 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805f54:	55                   	push   %rbp
+  805f55:	48 89 e5             	mov    %rsp,%rbp
+  805f58:	48 83 ec 20          	sub    $0x20,%rsp
+  805f5c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805f60:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805f64:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805f68:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805f6c:	8b 50 0c             	mov    0xc(%rax),%edx
+  805f6f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805f73:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f77:	48 89 ce             	mov    %rcx,%rsi
+  805f7a:	48 89 c7             	mov    %rax,%rdi
+  805f7d:	48 b8 83 27 80 00 00 	movabs $0x802783,%rax
+  805f84:	00 00 00 
+  805f87:	ff d0                	call   *%rax
+  805f89:	48 98                	cltq
+}
+  805f8b:	c9                   	leave
+  805f8c:	c3                   	ret
+
+0000000000805f8d <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805f8d:	55                   	push   %rbp
+  805f8e:	48 89 e5             	mov    %rsp,%rbp
+  805f91:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  805f98:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805f9f:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805fa6:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805fad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805fb4:	eb 74                	jmp    80602a <devcons_write+0x9d>
+    m = n - tot;
+  805fb6:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805fbd:	89 c2                	mov    %eax,%edx
+  805fbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fc2:	29 c2                	sub    %eax,%edx
+  805fc4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  805fc7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805fca:	83 f8 7f             	cmp    $0x7f,%eax
+  805fcd:	76 07                	jbe    805fd6 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805fcf:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  805fd6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805fd9:	48 63 d0             	movslq %eax,%rdx
+  805fdc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805fdf:	48 63 c8             	movslq %eax,%rcx
+  805fe2:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  805fe9:	48 01 c1             	add    %rax,%rcx
+  805fec:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805ff3:	48 89 ce             	mov    %rcx,%rsi
+  805ff6:	48 89 c7             	mov    %rax,%rdi
+  805ff9:	48 b8 9e 1b 80 00 00 	movabs $0x801b9e,%rax
+  806000:	00 00 00 
+  806003:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  806005:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806008:	48 63 d0             	movslq %eax,%rdx
+  80600b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  806012:	48 89 d6             	mov    %rdx,%rsi
+  806015:	48 89 c7             	mov    %rax,%rdi
+  806018:	48 b8 12 22 80 00 00 	movabs $0x802212,%rax
+  80601f:	00 00 00 
+  806022:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  806024:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806027:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80602a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80602d:	48 98                	cltq
+  80602f:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  806036:	0f 82 7a ff ff ff    	jb     805fb6 <devcons_write+0x29>
+  }
+  return tot;
+  80603c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80603f:	48 98                	cltq
+}
+  806041:	c9                   	leave
+  806042:	c3                   	ret
+
+0000000000806043 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  806043:	55                   	push   %rbp
+  806044:	48 89 e5             	mov    %rsp,%rbp
+  806047:	48 83 ec 08          	sub    $0x8,%rsp
+  80604b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  80604f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806054:	c9                   	leave
+  806055:	c3                   	ret
+
+0000000000806056 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  806056:	55                   	push   %rbp
+  806057:	48 89 e5             	mov    %rsp,%rbp
+  80605a:	48 83 ec 10          	sub    $0x10,%rsp
+  80605e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806062:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  806066:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80606a:	48 ba 2d 6f 80 00 00 	movabs $0x806f2d,%rdx
+  806071:	00 00 00 
+  806074:	48 89 d6             	mov    %rdx,%rsi
+  806077:	48 89 c7             	mov    %rax,%rdi
+  80607a:	48 b8 5b 16 80 00 00 	movabs $0x80165b,%rax
+  806081:	00 00 00 
+  806084:	ff d0                	call   *%rax
+  return 0;
+  806086:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80608b:	c9                   	leave
+  80608c:	c3                   	ret
+
+000000000080608d <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80608d:	55                   	push   %rbp
+  80608e:	48 89 e5             	mov    %rsp,%rbp
+  806091:	48 83 ec 30          	sub    $0x30,%rsp
+  806095:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806099:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80609c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  8060a0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  8060a7:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8060aa:	83 e0 02             	and    $0x2,%eax
+  8060ad:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  8060b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8060b4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8060b7:	83 f8 01             	cmp    $0x1,%eax
+  8060ba:	75 04                	jne    8060c0 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  8060bc:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  8060c0:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8060c3:	83 e0 01             	and    $0x1,%eax
+  8060c6:	85 c0                	test   %eax,%eax
+  8060c8:	74 44                	je     80610e <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  8060ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8060d2:	89 c2                	mov    %eax,%edx
+  8060d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8060d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060de:	48 b8 71 28 80 00 00 	movabs $0x802871,%rax
+  8060e5:	00 00 00 
+  8060e8:	ff d0                	call   *%rax
+  8060ea:	83 f8 01             	cmp    $0x1,%eax
+  8060ed:	75 06                	jne    8060f5 <devcons_poll+0x68>
+      revents |= POLLIN;
+  8060ef:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  8060f3:	eb 19                	jmp    80610e <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  8060f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8060f9:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  8060ff:	0b 45 fc             	or     -0x4(%rbp),%eax
+  806102:	89 c2                	mov    %eax,%edx
+  806104:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806108:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  80610e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  806111:	c9                   	leave
+  806112:	c3                   	ret
+
+0000000000806113 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  806113:	55                   	push   %rbp
+  806114:	48 89 e5             	mov    %rsp,%rbp
+  806117:	48 83 ec 20          	sub    $0x20,%rsp
+  80611b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  80611f:	48 b8 b0 23 80 00 00 	movabs $0x8023b0,%rax
+  806126:	00 00 00 
+  806129:	ff d0                	call   *%rax
+  80612b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  80612e:	48 b8 40 91 80 00 00 	movabs $0x809140,%rax
+  806135:	00 00 00 
+  806138:	48 8b 00             	mov    (%rax),%rax
+  80613b:	48 85 c0             	test   %rax,%rax
+  80613e:	75 62                	jne    8061a2 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  806140:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806143:	ba 07 00 00 00       	mov    $0x7,%edx
+  806148:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  80614f:	00 00 00 
+  806152:	48 89 ce             	mov    %rcx,%rsi
+  806155:	89 c7                	mov    %eax,%edi
+  806157:	48 b8 29 24 80 00 00 	movabs $0x802429,%rax
+  80615e:	00 00 00 
+  806161:	ff d0                	call   *%rax
+  806163:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  806166:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80616a:	79 36                	jns    8061a2 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  80616c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80616f:	89 c1                	mov    %eax,%ecx
+  806171:	48 b8 34 6f 80 00 00 	movabs $0x806f34,%rax
+  806178:	00 00 00 
+  80617b:	48 89 c2             	mov    %rax,%rdx
+  80617e:	be 23 00 00 00       	mov    $0x23,%esi
+  806183:	48 b8 4c 6f 80 00 00 	movabs $0x806f4c,%rax
+  80618a:	00 00 00 
+  80618d:	48 89 c7             	mov    %rax,%rdi
+  806190:	b8 00 00 00 00       	mov    $0x0,%eax
+  806195:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  80619c:	00 00 00 
+  80619f:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8061a2:	48 ba 40 91 80 00 00 	movabs $0x809140,%rdx
+  8061a9:	00 00 00 
+  8061ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8061b0:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  8061b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8061b6:	48 ba 13 62 80 00 00 	movabs $0x806213,%rdx
+  8061bd:	00 00 00 
+  8061c0:	48 89 d6             	mov    %rdx,%rsi
+  8061c3:	89 c7                	mov    %eax,%edi
+  8061c5:	48 b8 c6 25 80 00 00 	movabs $0x8025c6,%rax
+  8061cc:	00 00 00 
+  8061cf:	ff d0                	call   *%rax
+  8061d1:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  8061d4:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8061d8:	79 36                	jns    806210 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  8061da:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8061dd:	89 c1                	mov    %eax,%ecx
+  8061df:	48 b8 34 6f 80 00 00 	movabs $0x806f34,%rax
+  8061e6:	00 00 00 
+  8061e9:	48 89 c2             	mov    %rax,%rdx
+  8061ec:	be 2b 00 00 00       	mov    $0x2b,%esi
+  8061f1:	48 b8 4c 6f 80 00 00 	movabs $0x806f4c,%rax
+  8061f8:	00 00 00 
+  8061fb:	48 89 c7             	mov    %rax,%rdi
+  8061fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  806203:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  80620a:	00 00 00 
+  80620d:	41 ff d0             	call   *%r8
+}
+  806210:	90                   	nop
+  806211:	c9                   	leave
+  806212:	c3                   	ret
+
+0000000000806213 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  806213:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  806216:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  806219:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  806220:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  806224:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  806229:	48 a1 40 91 80 00 00 	movabs 0x809140,%rax
+  806230:	00 00 00 
+	call *%rax
+  806233:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  806235:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  80623a:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  80623d:	41 5f                	pop    %r15
+	popq %r15
+  80623f:	41 5f                	pop    %r15
+	popq %r15
+  806241:	41 5f                	pop    %r15
+	popq %r14
+  806243:	41 5e                	pop    %r14
+	popq %r13
+  806245:	41 5d                	pop    %r13
+	popq %r12
+  806247:	41 5c                	pop    %r12
+	popq %r11
+  806249:	41 5b                	pop    %r11
+	popq %r10
+  80624b:	41 5a                	pop    %r10
+	popq %r9
+  80624d:	41 59                	pop    %r9
+	popq %r8
+  80624f:	41 58                	pop    %r8
+	popq %rsi
+  806251:	5e                   	pop    %rsi
+	popq %rdi
+  806252:	5f                   	pop    %rdi
+	popq %rbp
+  806253:	5d                   	pop    %rbp
+	popq %rdx
+  806254:	5a                   	pop    %rdx
+	popq %rcx
+  806255:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  806256:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80625b:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  806260:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  806264:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  806267:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  80626c:	5b                   	pop    %rbx
+	popq %rax
+  80626d:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  80626e:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  806272:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  806273:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  806278:	c3                   	ret
+
+0000000000806279 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  806279:	55                   	push   %rbp
+  80627a:	48 89 e5             	mov    %rsp,%rbp
+  80627d:	48 83 ec 20          	sub    $0x20,%rsp
+  806281:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806285:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  806289:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  80628d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806291:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  806295:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806299:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  8062a0:	48 89 c7             	mov    %rax,%rdi
+  8062a3:	48 b8 b1 62 80 00 00 	movabs $0x8062b1,%rax
+  8062aa:	00 00 00 
+  8062ad:	ff d0                	call   *%rax
+}
+  8062af:	c9                   	leave
+  8062b0:	c3                   	ret
+
+00000000008062b1 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  8062b1:	55                   	push   %rbp
+  8062b2:	48 89 e5             	mov    %rsp,%rbp
+  8062b5:	48 83 ec 30          	sub    $0x30,%rsp
+  8062b9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8062bd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8062c1:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8062c5:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8062c9:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8062ce:	75 0e                	jne    8062de <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  8062d0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8062d7:	00 00 00 
+  8062da:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  8062de:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8062e3:	75 18                	jne    8062fd <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8062e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8062e9:	48 89 c7             	mov    %rax,%rdi
+  8062ec:	48 b8 69 26 80 00 00 	movabs $0x802669,%rax
+  8062f3:	00 00 00 
+  8062f6:	ff d0                	call   *%rax
+  8062f8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8062fb:	eb 1d                	jmp    80631a <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8062fd:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806301:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806305:	48 89 d6             	mov    %rdx,%rsi
+  806308:	48 89 c7             	mov    %rax,%rdi
+  80630b:	48 b8 af 26 80 00 00 	movabs $0x8026af,%rax
+  806312:	00 00 00 
+  806315:	ff d0                	call   *%rax
+  806317:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  80631a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80631e:	79 2a                	jns    80634a <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  806320:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  806325:	74 0a                	je     806331 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  806327:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80632b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  806331:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  806336:	74 0a                	je     806342 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  806338:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80633c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  806342:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806345:	e9 aa 00 00 00       	jmp    8063f4 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  80634a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80634f:	74 36                	je     806387 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  806351:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806358:	00 00 00 
+  80635b:	8b 40 04             	mov    0x4(%rax),%eax
+  80635e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806363:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80636a:	00 00 00 
+  80636d:	48 98                	cltq
+  80636f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806376:	48 01 d0             	add    %rdx,%rax
+  806379:	48 05 24 01 00 00    	add    $0x124,%rax
+  80637f:	8b 10                	mov    (%rax),%edx
+  806381:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806385:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  806387:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80638c:	74 36                	je     8063c4 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  80638e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806395:	00 00 00 
+  806398:	8b 40 04             	mov    0x4(%rax),%eax
+  80639b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8063a0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8063a7:	00 00 00 
+  8063aa:	48 98                	cltq
+  8063ac:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8063b3:	48 01 d0             	add    %rdx,%rax
+  8063b6:	48 05 28 01 00 00    	add    $0x128,%rax
+  8063bc:	8b 10                	mov    (%rax),%edx
+  8063be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063c2:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8063c4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8063cb:	00 00 00 
+  8063ce:	8b 40 04             	mov    0x4(%rax),%eax
+  8063d1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8063d6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8063dd:	00 00 00 
+  8063e0:	48 98                	cltq
+  8063e2:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8063e9:	48 01 d0             	add    %rdx,%rax
+  8063ec:	48 05 20 01 00 00    	add    $0x120,%rax
+  8063f2:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8063f4:	c9                   	leave
+  8063f5:	c3                   	ret
+
+00000000008063f6 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8063f6:	55                   	push   %rbp
+  8063f7:	48 89 e5             	mov    %rsp,%rbp
+  8063fa:	48 83 ec 30          	sub    $0x30,%rsp
+  8063fe:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806401:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806404:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806408:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80640b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806410:	75 5e                	jne    806470 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  806412:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806419:	00 00 00 
+  80641c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806420:	eb 4e                	jmp    806470 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  806422:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806426:	79 3c                	jns    806464 <ipc_send+0x6e>
+  806428:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80642c:	74 36                	je     806464 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  80642e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806431:	89 c1                	mov    %eax,%ecx
+  806433:	48 b8 60 6f 80 00 00 	movabs $0x806f60,%rax
+  80643a:	00 00 00 
+  80643d:	48 89 c2             	mov    %rax,%rdx
+  806440:	be 54 00 00 00       	mov    $0x54,%esi
+  806445:	48 b8 86 6f 80 00 00 	movabs $0x806f86,%rax
+  80644c:	00 00 00 
+  80644f:	48 89 c7             	mov    %rax,%rdi
+  806452:	b8 00 00 00 00       	mov    $0x0,%eax
+  806457:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  80645e:	00 00 00 
+  806461:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  806464:	48 b8 ec 23 80 00 00 	movabs $0x8023ec,%rax
+  80646b:	00 00 00 
+  80646e:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  806470:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  806473:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  806476:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80647a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80647d:	89 c7                	mov    %eax,%edi
+  80647f:	48 b8 12 26 80 00 00 	movabs $0x802612,%rax
+  806486:	00 00 00 
+  806489:	ff d0                	call   *%rax
+  80648b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80648e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806492:	75 8e                	jne    806422 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  806494:	48 b8 ec 23 80 00 00 	movabs $0x8023ec,%rax
+  80649b:	00 00 00 
+  80649e:	ff d0                	call   *%rax
+}
+  8064a0:	90                   	nop
+  8064a1:	c9                   	leave
+  8064a2:	c3                   	ret
+
+00000000008064a3 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8064a3:	55                   	push   %rbp
+  8064a4:	48 89 e5             	mov    %rsp,%rbp
+  8064a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8064ab:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8064ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8064b5:	eb 4d                	jmp    806504 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8064b7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8064be:	00 00 00 
+  8064c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064c4:	48 98                	cltq
+  8064c6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8064cd:	48 01 d0             	add    %rdx,%rax
+  8064d0:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8064d6:	8b 00                	mov    (%rax),%eax
+  8064d8:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8064db:	75 23                	jne    806500 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8064dd:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8064e4:	00 00 00 
+  8064e7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064ea:	48 98                	cltq
+  8064ec:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8064f3:	48 01 d0             	add    %rdx,%rax
+  8064f6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8064fc:	8b 00                	mov    (%rax),%eax
+  8064fe:	eb 12                	jmp    806512 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  806500:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806504:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80650b:	7e aa                	jle    8064b7 <ipc_find_env+0x14>
+  return 0;
+  80650d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806512:	c9                   	leave
+  806513:	c3                   	ret
+
+0000000000806514 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  806514:	55                   	push   %rbp
+  806515:	48 89 e5             	mov    %rsp,%rbp
+  806518:	48 83 ec 18          	sub    $0x18,%rsp
+  80651c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  806520:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806524:	48 c1 e8 27          	shr    $0x27,%rax
+  806528:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80652d:	48 89 c2             	mov    %rax,%rdx
+  806530:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  806537:	01 00 00 
+  80653a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80653e:	83 e0 01             	and    $0x1,%eax
+  806541:	48 85 c0             	test   %rax,%rax
+  806544:	74 63                	je     8065a9 <pageref+0x95>
+  806546:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80654a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80654e:	48 89 c2             	mov    %rax,%rdx
+  806551:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  806558:	01 00 00 
+  80655b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80655f:	83 e0 01             	and    $0x1,%eax
+  806562:	48 85 c0             	test   %rax,%rax
+  806565:	74 42                	je     8065a9 <pageref+0x95>
+  806567:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80656b:	48 c1 e8 15          	shr    $0x15,%rax
+  80656f:	48 89 c2             	mov    %rax,%rdx
+  806572:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  806579:	01 00 00 
+  80657c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806580:	83 e0 01             	and    $0x1,%eax
+  806583:	48 85 c0             	test   %rax,%rax
+  806586:	74 21                	je     8065a9 <pageref+0x95>
+  806588:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80658c:	48 c1 e8 0c          	shr    $0xc,%rax
+  806590:	48 89 c2             	mov    %rax,%rdx
+  806593:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80659a:	01 00 00 
+  80659d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8065a1:	83 e0 01             	and    $0x1,%eax
+  8065a4:	48 85 c0             	test   %rax,%rax
+  8065a7:	75 07                	jne    8065b0 <pageref+0x9c>
+    return 0;
+  8065a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065ae:	eb 53                	jmp    806603 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8065b0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065b4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8065b8:	48 89 c2             	mov    %rax,%rdx
+  8065bb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8065c2:	01 00 00 
+  8065c5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8065c9:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8065cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065d1:	83 e0 01             	and    $0x1,%eax
+  8065d4:	48 85 c0             	test   %rax,%rax
+  8065d7:	75 07                	jne    8065e0 <pageref+0xcc>
+    return 0;
+  8065d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065de:	eb 23                	jmp    806603 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8065e0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8065e4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8065e8:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8065ef:	00 00 00 
+  8065f2:	48 c1 e0 04          	shl    $0x4,%rax
+  8065f6:	48 01 d0             	add    %rdx,%rax
+  8065f9:	48 83 c0 08          	add    $0x8,%rax
+  8065fd:	0f b7 00             	movzwl (%rax),%eax
+  806600:	0f b7 c0             	movzwl %ax,%eax
+}
+  806603:	c9                   	leave
+  806604:	c3                   	ret
+
+0000000000806605 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  806605:	55                   	push   %rbp
+  806606:	48 89 e5             	mov    %rsp,%rbp
+  806609:	48 83 ec 10          	sub    $0x10,%rsp
+  80660d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  806610:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806613:	be 00 00 00 00       	mov    $0x0,%esi
+  806618:	89 c7                	mov    %eax,%edi
+  80661a:	48 b8 29 66 80 00 00 	movabs $0x806629,%rax
+  806621:	00 00 00 
+  806624:	ff d0                	call   *%rax
+}
+  806626:	90                   	nop
+  806627:	c9                   	leave
+  806628:	c3                   	ret
+
+0000000000806629 <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  806629:	55                   	push   %rbp
+  80662a:	48 89 e5             	mov    %rsp,%rbp
+  80662d:	48 83 ec 10          	sub    $0x10,%rsp
+  806631:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  806634:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  806638:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80663c:	75 3e                	jne    80667c <waitpid+0x53>
+  80663e:	48 b8 90 6f 80 00 00 	movabs $0x806f90,%rax
+  806645:	00 00 00 
+  806648:	48 89 c1             	mov    %rax,%rcx
+  80664b:	48 b8 9b 6f 80 00 00 	movabs $0x806f9b,%rax
+  806652:	00 00 00 
+  806655:	48 89 c2             	mov    %rax,%rdx
+  806658:	be 0e 00 00 00       	mov    $0xe,%esi
+  80665d:	48 b8 b0 6f 80 00 00 	movabs $0x806fb0,%rax
+  806664:	00 00 00 
+  806667:	48 89 c7             	mov    %rax,%rdi
+  80666a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80666f:	49 b8 8c 04 80 00 00 	movabs $0x80048c,%r8
+  806676:	00 00 00 
+  806679:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  80667c:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  806681:	74 0a                	je     80668d <waitpid+0x64>
+    *status = 0;
+  806683:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  806687:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  80668d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  806691:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806694:	48 89 d6             	mov    %rdx,%rsi
+  806697:	89 c7                	mov    %eax,%edi
+  806699:	48 b8 28 23 80 00 00 	movabs $0x802328,%rax
+  8066a0:	00 00 00 
+  8066a3:	ff d0                	call   *%rax
+}
+  8066a5:	c9                   	leave
+  8066a6:	c3                   	ret
+  8066a7:	90                   	nop
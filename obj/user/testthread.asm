@@ -0,0 +1,10285 @@
+
+obj/user/testthread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 97 03 00 00       	call   8003c3 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <worker>:
+
+struct Mutex mutex = MUTEX_INITIALIZER;
+int counter;
+
+static void
+worker(void *arg) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	53                   	push   %rbx
+  800037:	48 83 ec 28          	sub    $0x28,%rsp
+  80003b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  int i, tmp;
+
+  // A thread sees its own Env, not its creator's.
+  if (thisenv->env_id != sys_getenvid())
+  80003f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800046:	00 00 00 
+  800049:	8b 40 04             	mov    0x4(%rax),%eax
+  80004c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800051:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  800058:	00 00 00 
+  80005b:	48 98                	cltq
+  80005d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800064:	48 01 d0             	add    %rdx,%rax
+  800067:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80006d:	8b 18                	mov    (%rax),%ebx
+  80006f:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  800076:	00 00 00 
+  800079:	ff d0                	call   *%rax
+  80007b:	39 c3                	cmp    %eax,%ebx
+  80007d:	74 74                	je     8000f3 <worker+0xc1>
+    panic("thisenv is %08x in thread %08x", thisenv->env_id, sys_getenvid());
+  80007f:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  800086:	00 00 00 
+  800089:	ff d0                	call   *%rax
+  80008b:	89 c2                	mov    %eax,%edx
+  80008d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800094:	00 00 00 
+  800097:	8b 40 04             	mov    0x4(%rax),%eax
+  80009a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009f:	48 b9 00 e0 22 3c 80 	movabs $0x803c22e000,%rcx
+  8000a6:	00 00 00 
+  8000a9:	48 98                	cltq
+  8000ab:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8000b2:	48 01 c8             	add    %rcx,%rax
+  8000b5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8000bb:	8b 00                	mov    (%rax),%eax
+  8000bd:	41 89 d0             	mov    %edx,%r8d
+  8000c0:	89 c1                	mov    %eax,%ecx
+  8000c2:	48 b8 a0 66 80 00 00 	movabs $0x8066a0,%rax
+  8000c9:	00 00 00 
+  8000cc:	48 89 c2             	mov    %rax,%rdx
+  8000cf:	be 0f 00 00 00       	mov    $0xf,%esi
+  8000d4:	48 b8 bf 66 80 00 00 	movabs $0x8066bf,%rax
+  8000db:	00 00 00 
+  8000de:	48 89 c7             	mov    %rax,%rdi
+  8000e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e6:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  8000ed:	00 00 00 
+  8000f0:	41 ff d1             	call   *%r9
+
+  // Globals are shared: without the mutex, increments would be lost.
+  for (i = 0; i < N; i++) {
+  8000f3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+  8000fa:	eb 63                	jmp    80015f <worker+0x12d>
+    mutex_lock(&mutex);
+  8000fc:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800103:	00 00 00 
+  800106:	48 89 c7             	mov    %rax,%rdi
+  800109:	48 b8 79 54 80 00 00 	movabs $0x805479,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+    tmp = counter;
+  800115:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80011c:	00 00 00 
+  80011f:	8b 00                	mov    (%rax),%eax
+  800121:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    sys_yield();
+  800124:	48 b8 ca 23 80 00 00 	movabs $0x8023ca,%rax
+  80012b:	00 00 00 
+  80012e:	ff d0                	call   *%rax
+    counter = tmp + 1;
+  800130:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  800133:	8d 50 01             	lea    0x1(%rax),%edx
+  800136:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  80013d:	00 00 00 
+  800140:	89 10                	mov    %edx,(%rax)
+    mutex_unlock(&mutex);
+  800142:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  800149:	00 00 00 
+  80014c:	48 89 c7             	mov    %rax,%rdi
+  80014f:	48 b8 4e 55 80 00 00 	movabs $0x80554e,%rax
+  800156:	00 00 00 
+  800159:	ff d0                	call   *%rax
+  for (i = 0; i < N; i++) {
+  80015b:	83 45 ec 01          	addl   $0x1,-0x14(%rbp)
+  80015f:	83 7d ec 31          	cmpl   $0x31,-0x14(%rbp)
+  800163:	7e 97                	jle    8000fc <worker+0xca>
+  }
+  thread_exit((int)(uintptr_t)arg);
+  800165:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800169:	89 c7                	mov    %eax,%edi
+  80016b:	48 b8 88 5b 80 00 00 	movabs $0x805b88,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+}
+  800177:	90                   	nop
+  800178:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80017c:	c9                   	leave
+  80017d:	c3                   	ret
+
+000000000080017e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80017e:	55                   	push   %rbp
+  80017f:	48 89 e5             	mov    %rsp,%rbp
+  800182:	48 83 ec 40          	sub    $0x40,%rsp
+  800186:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  800189:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  envid_t ids[NTHREADS], child;
+  int i, status;
+
+  for (i = 0; i < NTHREADS; i++) {
+  80018d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800194:	eb 7b                	jmp    800211 <umain+0x93>
+    if ((ids[i] = thread_create(worker, (void *)(uintptr_t)(i + 1))) < 0)
+  800196:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800199:	83 c0 01             	add    $0x1,%eax
+  80019c:	48 98                	cltq
+  80019e:	48 89 c6             	mov    %rax,%rsi
+  8001a1:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001a8:	00 00 00 
+  8001ab:	48 89 c7             	mov    %rax,%rdi
+  8001ae:	48 b8 da 59 80 00 00 	movabs $0x8059da,%rax
+  8001b5:	00 00 00 
+  8001b8:	ff d0                	call   *%rax
+  8001ba:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8001bd:	48 63 d2             	movslq %edx,%rdx
+  8001c0:	89 44 95 e0          	mov    %eax,-0x20(%rbp,%rdx,4)
+  8001c4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001c7:	48 98                	cltq
+  8001c9:	8b 44 85 e0          	mov    -0x20(%rbp,%rax,4),%eax
+  8001cd:	85 c0                	test   %eax,%eax
+  8001cf:	79 3c                	jns    80020d <umain+0x8f>
+      panic("thread_create: %i", ids[i]);
+  8001d1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8001d4:	48 98                	cltq
+  8001d6:	8b 44 85 e0          	mov    -0x20(%rbp,%rax,4),%eax
+  8001da:	89 c1                	mov    %eax,%ecx
+  8001dc:	48 b8 d1 66 80 00 00 	movabs $0x8066d1,%rax
+  8001e3:	00 00 00 
+  8001e6:	48 89 c2             	mov    %rax,%rdx
+  8001e9:	be 23 00 00 00       	mov    $0x23,%esi
+  8001ee:	48 b8 bf 66 80 00 00 	movabs $0x8066bf,%rax
+  8001f5:	00 00 00 
+  8001f8:	48 89 c7             	mov    %rax,%rdi
+  8001fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800200:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  800207:	00 00 00 
+  80020a:	41 ff d0             	call   *%r8
+  for (i = 0; i < NTHREADS; i++) {
+  80020d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800211:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+  800215:	0f 8e 7b ff ff ff    	jle    800196 <umain+0x18>
+  }
+
+  // Fork while the threads run: the pages they write turn
+  // copy-on-write under them, and their faults must still be handled.
+  if ((child = fork()) < 0)
+  80021b:	48 b8 a0 32 80 00 00 	movabs $0x8032a0,%rax
+  800222:	00 00 00 
+  800225:	ff d0                	call   *%rax
+  800227:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80022a:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80022e:	79 36                	jns    800266 <umain+0xe8>
+    panic("fork: %i", child);
+  800230:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800233:	89 c1                	mov    %eax,%ecx
+  800235:	48 b8 e3 66 80 00 00 	movabs $0x8066e3,%rax
+  80023c:	00 00 00 
+  80023f:	48 89 c2             	mov    %rax,%rdx
+  800242:	be 29 00 00 00       	mov    $0x29,%esi
+  800247:	48 b8 bf 66 80 00 00 	movabs $0x8066bf,%rax
+  80024e:	00 00 00 
+  800251:	48 89 c7             	mov    %rax,%rdi
+  800254:	b8 00 00 00 00       	mov    $0x0,%eax
+  800259:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  800260:	00 00 00 
+  800263:	41 ff d0             	call   *%r8
+  if (!child)
+  800266:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80026a:	75 0c                	jne    800278 <umain+0xfa>
+    exit();
+  80026c:	48 b8 46 04 80 00 00 	movabs $0x800446,%rax
+  800273:	00 00 00 
+  800276:	ff d0                	call   *%rax
+  wait(child);
+  800278:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80027b:	89 c7                	mov    %eax,%edi
+  80027d:	48 b8 47 53 80 00 00 	movabs $0x805347,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+  for (i = 0; i < NTHREADS; i++) {
+  800289:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800290:	e9 ab 00 00 00       	jmp    800340 <umain+0x1c2>
+    if (thread_join(ids[i], &status) < 0)
+  800295:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800298:	48 98                	cltq
+  80029a:	8b 44 85 e0          	mov    -0x20(%rbp,%rax,4),%eax
+  80029e:	48 8d 55 dc          	lea    -0x24(%rbp),%rdx
+  8002a2:	48 89 d6             	mov    %rdx,%rsi
+  8002a5:	89 c7                	mov    %eax,%edi
+  8002a7:	48 b8 a7 5b 80 00 00 	movabs $0x805ba7,%rax
+  8002ae:	00 00 00 
+  8002b1:	ff d0                	call   *%rax
+  8002b3:	85 c0                	test   %eax,%eax
+  8002b5:	79 3c                	jns    8002f3 <umain+0x175>
+      panic("thread_join %08x failed", ids[i]);
+  8002b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002ba:	48 98                	cltq
+  8002bc:	8b 44 85 e0          	mov    -0x20(%rbp,%rax,4),%eax
+  8002c0:	89 c1                	mov    %eax,%ecx
+  8002c2:	48 b8 ec 66 80 00 00 	movabs $0x8066ec,%rax
+  8002c9:	00 00 00 
+  8002cc:	48 89 c2             	mov    %rax,%rdx
+  8002cf:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8002d4:	48 b8 bf 66 80 00 00 	movabs $0x8066bf,%rax
+  8002db:	00 00 00 
+  8002de:	48 89 c7             	mov    %rax,%rdi
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  8002ed:	00 00 00 
+  8002f0:	41 ff d0             	call   *%r8
+    if (status != i + 1)
+  8002f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8002f6:	8d 50 01             	lea    0x1(%rax),%edx
+  8002f9:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8002fc:	39 c2                	cmp    %eax,%edx
+  8002fe:	74 3c                	je     80033c <umain+0x1be>
+      panic("thread %d exited with %d", i, status);
+  800300:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  800303:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800306:	41 89 d0             	mov    %edx,%r8d
+  800309:	89 c1                	mov    %eax,%ecx
+  80030b:	48 b8 04 67 80 00 00 	movabs $0x806704,%rax
+  800312:	00 00 00 
+  800315:	48 89 c2             	mov    %rax,%rdx
+  800318:	be 31 00 00 00       	mov    $0x31,%esi
+  80031d:	48 b8 bf 66 80 00 00 	movabs $0x8066bf,%rax
+  800324:	00 00 00 
+  800327:	48 89 c7             	mov    %rax,%rdi
+  80032a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032f:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  800336:	00 00 00 
+  800339:	41 ff d1             	call   *%r9
+  for (i = 0; i < NTHREADS; i++) {
+  80033c:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800340:	83 7d fc 03          	cmpl   $0x3,-0x4(%rbp)
+  800344:	0f 8e 4b ff ff ff    	jle    800295 <umain+0x117>
+  }
+
+  if (counter != NTHREADS * N)
+  80034a:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  800351:	00 00 00 
+  800354:	8b 00                	mov    (%rax),%eax
+  800356:	3d c8 00 00 00       	cmp    $0xc8,%eax
+  80035b:	74 45                	je     8003a2 <umain+0x224>
+    panic("counter is %d, expected %d", counter, NTHREADS * N);
+  80035d:	48 b8 04 80 80 00 00 	movabs $0x808004,%rax
+  800364:	00 00 00 
+  800367:	8b 00                	mov    (%rax),%eax
+  800369:	41 b8 c8 00 00 00    	mov    $0xc8,%r8d
+  80036f:	89 c1                	mov    %eax,%ecx
+  800371:	48 b8 1d 67 80 00 00 	movabs $0x80671d,%rax
+  800378:	00 00 00 
+  80037b:	48 89 c2             	mov    %rax,%rdx
+  80037e:	be 35 00 00 00       	mov    $0x35,%esi
+  800383:	48 b8 bf 66 80 00 00 	movabs $0x8066bf,%rax
+  80038a:	00 00 00 
+  80038d:	48 89 c7             	mov    %rax,%rdi
+  800390:	b8 00 00 00 00       	mov    $0x0,%eax
+  800395:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  80039c:	00 00 00 
+  80039f:	41 ff d1             	call   *%r9
+  cprintf("thread test passed\n");
+  8003a2:	48 b8 38 67 80 00 00 	movabs $0x806738,%rax
+  8003a9:	00 00 00 
+  8003ac:	48 89 c7             	mov    %rax,%rdi
+  8003af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b4:	48 ba 89 06 80 00 00 	movabs $0x800689,%rdx
+  8003bb:	00 00 00 
+  8003be:	ff d2                	call   *%rdx
+}
+  8003c0:	90                   	nop
+  8003c1:	c9                   	leave
+  8003c2:	c3                   	ret
+
+00000000008003c3 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8003c3:	55                   	push   %rbp
+  8003c4:	48 89 e5             	mov    %rsp,%rbp
+  8003c7:	48 83 ec 20          	sub    $0x20,%rsp
+  8003cb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8003ce:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8003d2:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8003d9:	00 00 00 
+  8003dc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8003e0:	eb 13                	jmp    8003f5 <libmain+0x32>
+    (*ctor)();
+  8003e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8003e6:	48 8b 10             	mov    (%rax),%rdx
+  8003e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ee:	ff d2                	call   *%rdx
+    ctor++;
+  8003f0:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8003f5:	48 b8 00 71 80 00 00 	movabs $0x807100,%rax
+  8003fc:	00 00 00 
+  8003ff:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800403:	72 dd                	jb     8003e2 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800405:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800409:	7e 14                	jle    80041f <libmain+0x5c>
+    binaryname = argv[0];
+  80040b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80040f:	48 8b 00             	mov    (%rax),%rax
+  800412:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800419:	00 00 00 
+  80041c:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80041f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800423:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800426:	48 89 d6             	mov    %rdx,%rsi
+  800429:	89 c7                	mov    %eax,%edi
+  80042b:	48 b8 7e 01 80 00 00 	movabs $0x80017e,%rax
+  800432:	00 00 00 
+  800435:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800437:	48 b8 46 04 80 00 00 	movabs $0x800446,%rax
+  80043e:	00 00 00 
+  800441:	ff d0                	call   *%rax
+#endif
+}
+  800443:	90                   	nop
+  800444:	c9                   	leave
+  800445:	c3                   	ret
+
+0000000000800446 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800446:	55                   	push   %rbp
+  800447:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80044a:	48 b8 be 36 80 00 00 	movabs $0x8036be,%rax
+  800451:	00 00 00 
+  800454:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800456:	bf 00 00 00 00       	mov    $0x0,%edi
+  80045b:	48 b8 bf 22 80 00 00 	movabs $0x8022bf,%rax
+  800462:	00 00 00 
+  800465:	ff d0                	call   *%rax
+}
+  800467:	90                   	nop
+  800468:	5d                   	pop    %rbp
+  800469:	c3                   	ret
+
+000000000080046a <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80046a:	55                   	push   %rbp
+  80046b:	48 89 e5             	mov    %rsp,%rbp
+  80046e:	53                   	push   %rbx
+  80046f:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800476:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80047d:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800483:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80048a:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800491:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800498:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  80049f:	84 c0                	test   %al,%al
+  8004a1:	74 23                	je     8004c6 <_panic+0x5c>
+  8004a3:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8004aa:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8004ae:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  8004b2:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  8004b6:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  8004ba:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  8004be:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8004c2:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8004c6:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8004cd:	00 00 00 
+  8004d0:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8004d7:	00 00 00 
+  8004da:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004de:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8004e5:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8004ec:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004f3:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8004fa:	00 00 00 
+  8004fd:	48 8b 18             	mov    (%rax),%rbx
+  800500:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  800507:	00 00 00 
+  80050a:	ff d0                	call   *%rax
+  80050c:	89 c6                	mov    %eax,%esi
+  80050e:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800514:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80051b:	41 89 d0             	mov    %edx,%r8d
+  80051e:	48 89 c1             	mov    %rax,%rcx
+  800521:	48 89 da             	mov    %rbx,%rdx
+  800524:	48 b8 58 67 80 00 00 	movabs $0x806758,%rax
+  80052b:	00 00 00 
+  80052e:	48 89 c7             	mov    %rax,%rdi
+  800531:	b8 00 00 00 00       	mov    $0x0,%eax
+  800536:	49 b9 89 06 80 00 00 	movabs $0x800689,%r9
+  80053d:	00 00 00 
+  800540:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800543:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80054a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800551:	48 89 d6             	mov    %rdx,%rsi
+  800554:	48 89 c7             	mov    %rax,%rdi
+  800557:	48 b8 fe 05 80 00 00 	movabs $0x8005fe,%rax
+  80055e:	00 00 00 
+  800561:	ff d0                	call   *%rax
+  cprintf("\n");
+  800563:	48 b8 7b 67 80 00 00 	movabs $0x80677b,%rax
+  80056a:	00 00 00 
+  80056d:	48 89 c7             	mov    %rax,%rdi
+  800570:	b8 00 00 00 00       	mov    $0x0,%eax
+  800575:	48 ba 89 06 80 00 00 	movabs $0x800689,%rdx
+  80057c:	00 00 00 
+  80057f:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800581:	cc                   	int3
+  800582:	eb fd                	jmp    800581 <_panic+0x117>
+
+0000000000800584 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800584:	55                   	push   %rbp
+  800585:	48 89 e5             	mov    %rsp,%rbp
+  800588:	48 83 ec 10          	sub    $0x10,%rsp
+  80058c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80058f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800593:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800597:	8b 00                	mov    (%rax),%eax
+  800599:	8d 48 01             	lea    0x1(%rax),%ecx
+  80059c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005a0:	89 0a                	mov    %ecx,(%rdx)
+  8005a2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8005a5:	89 d1                	mov    %edx,%ecx
+  8005a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005ab:	48 98                	cltq
+  8005ad:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  8005b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005b5:	8b 00                	mov    (%rax),%eax
+  8005b7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8005bc:	75 2c                	jne    8005ea <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  8005be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005c2:	8b 00                	mov    (%rax),%eax
+  8005c4:	48 98                	cltq
+  8005c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005ca:	48 83 c2 08          	add    $0x8,%rdx
+  8005ce:	48 89 c6             	mov    %rax,%rsi
+  8005d1:	48 89 d7             	mov    %rdx,%rdi
+  8005d4:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  8005db:	00 00 00 
+  8005de:	ff d0                	call   *%rax
+    b->idx = 0;
+  8005e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005e4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8005ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005ee:	8b 40 04             	mov    0x4(%rax),%eax
+  8005f1:	8d 50 01             	lea    0x1(%rax),%edx
+  8005f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005f8:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8005fb:	90                   	nop
+  8005fc:	c9                   	leave
+  8005fd:	c3                   	ret
+
+00000000008005fe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005fe:	55                   	push   %rbp
+  8005ff:	48 89 e5             	mov    %rsp,%rbp
+  800602:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800609:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800610:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800617:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80061e:	00 00 00 
+  b.cnt = 0;
+  800621:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800628:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80062b:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800632:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800639:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800640:	48 89 c6             	mov    %rax,%rsi
+  800643:	48 b8 84 05 80 00 00 	movabs $0x800584,%rax
+  80064a:	00 00 00 
+  80064d:	48 89 c7             	mov    %rax,%rdi
+  800650:	48 b8 e3 09 80 00 00 	movabs $0x8009e3,%rax
+  800657:	00 00 00 
+  80065a:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80065c:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800662:	48 98                	cltq
+  800664:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80066b:	48 83 c2 08          	add    $0x8,%rdx
+  80066f:	48 89 c6             	mov    %rax,%rsi
+  800672:	48 89 d7             	mov    %rdx,%rdi
+  800675:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  80067c:	00 00 00 
+  80067f:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800681:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800687:	c9                   	leave
+  800688:	c3                   	ret
+
+0000000000800689 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800689:	55                   	push   %rbp
+  80068a:	48 89 e5             	mov    %rsp,%rbp
+  80068d:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800694:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80069b:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8006a2:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8006a9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8006b0:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8006b7:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8006be:	84 c0                	test   %al,%al
+  8006c0:	74 20                	je     8006e2 <cprintf+0x59>
+  8006c2:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8006c6:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8006ca:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8006ce:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8006d2:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8006d6:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8006da:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8006de:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8006e2:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8006e9:	00 00 00 
+  8006ec:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8006f3:	00 00 00 
+  8006f6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006fa:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800701:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800708:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80070f:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800716:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80071d:	48 89 d6             	mov    %rdx,%rsi
+  800720:	48 89 c7             	mov    %rax,%rdi
+  800723:	48 b8 fe 05 80 00 00 	movabs $0x8005fe,%rax
+  80072a:	00 00 00 
+  80072d:	ff d0                	call   *%rax
+  80072f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800735:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80073b:	c9                   	leave
+  80073c:	c3                   	ret
+
+000000000080073d <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80073d:	55                   	push   %rbp
+  80073e:	48 89 e5             	mov    %rsp,%rbp
+  800741:	48 83 ec 30          	sub    $0x30,%rsp
+  800745:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800749:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80074d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800751:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800754:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800758:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80075c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80075f:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800763:	72 54                	jb     8007b9 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800765:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800768:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80076b:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80076e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800772:	ba 00 00 00 00       	mov    $0x0,%edx
+  800777:	48 f7 f6             	div    %rsi
+  80077a:	49 89 c2             	mov    %rax,%r10
+  80077d:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800780:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800783:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800787:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80078b:	41 89 c9             	mov    %ecx,%r9d
+  80078e:	41 89 f8             	mov    %edi,%r8d
+  800791:	89 d1                	mov    %edx,%ecx
+  800793:	4c 89 d2             	mov    %r10,%rdx
+  800796:	48 89 c7             	mov    %rax,%rdi
+  800799:	48 b8 3d 07 80 00 00 	movabs $0x80073d,%rax
+  8007a0:	00 00 00 
+  8007a3:	ff d0                	call   *%rax
+  8007a5:	eb 1c                	jmp    8007c3 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8007a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007ab:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8007ae:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8007b2:	48 89 d6             	mov    %rdx,%rsi
+  8007b5:	89 c7                	mov    %eax,%edi
+  8007b7:	ff d1                	call   *%rcx
+    while (--width > 0)
+  8007b9:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  8007bd:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8007c1:	7f e4                	jg     8007a7 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8007c3:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8007c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007cf:	48 f7 f1             	div    %rcx
+  8007d2:	48 b8 b0 69 80 00 00 	movabs $0x8069b0,%rax
+  8007d9:	00 00 00 
+  8007dc:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8007e0:	0f be c0             	movsbl %al,%eax
+  8007e3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007e7:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8007eb:	48 89 d6             	mov    %rdx,%rsi
+  8007ee:	89 c7                	mov    %eax,%edi
+  8007f0:	ff d1                	call   *%rcx
+}
+  8007f2:	90                   	nop
+  8007f3:	c9                   	leave
+  8007f4:	c3                   	ret
+
+00000000008007f5 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8007f5:	55                   	push   %rbp
+  8007f6:	48 89 e5             	mov    %rsp,%rbp
+  8007f9:	48 83 ec 10          	sub    $0x10,%rsp
+  8007fd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800801:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800804:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800808:	7e 4b                	jle    800855 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80080a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80080e:	8b 00                	mov    (%rax),%eax
+  800810:	83 f8 2f             	cmp    $0x2f,%eax
+  800813:	77 24                	ja     800839 <getuint+0x44>
+  800815:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800819:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80081d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800821:	8b 00                	mov    (%rax),%eax
+  800823:	89 c0                	mov    %eax,%eax
+  800825:	48 01 d0             	add    %rdx,%rax
+  800828:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80082c:	8b 12                	mov    (%rdx),%edx
+  80082e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800831:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800835:	89 0a                	mov    %ecx,(%rdx)
+  800837:	eb 14                	jmp    80084d <getuint+0x58>
+  800839:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80083d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800841:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800845:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800849:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80084d:	48 8b 00             	mov    (%rax),%rax
+  800850:	e9 95 00 00 00       	jmp    8008ea <getuint+0xf5>
+  else if (lflag)
+  800855:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800859:	74 48                	je     8008a3 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  80085b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80085f:	8b 00                	mov    (%rax),%eax
+  800861:	83 f8 2f             	cmp    $0x2f,%eax
+  800864:	77 24                	ja     80088a <getuint+0x95>
+  800866:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80086a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80086e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800872:	8b 00                	mov    (%rax),%eax
+  800874:	89 c0                	mov    %eax,%eax
+  800876:	48 01 d0             	add    %rdx,%rax
+  800879:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80087d:	8b 12                	mov    (%rdx),%edx
+  80087f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800882:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800886:	89 0a                	mov    %ecx,(%rdx)
+  800888:	eb 14                	jmp    80089e <getuint+0xa9>
+  80088a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80088e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800892:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800896:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80089a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80089e:	48 8b 00             	mov    (%rax),%rax
+  8008a1:	eb 47                	jmp    8008ea <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8008a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008a7:	8b 00                	mov    (%rax),%eax
+  8008a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ac:	77 24                	ja     8008d2 <getuint+0xdd>
+  8008ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008b2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ba:	8b 00                	mov    (%rax),%eax
+  8008bc:	89 c0                	mov    %eax,%eax
+  8008be:	48 01 d0             	add    %rdx,%rax
+  8008c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008c5:	8b 12                	mov    (%rdx),%edx
+  8008c7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008ca:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008ce:	89 0a                	mov    %ecx,(%rdx)
+  8008d0:	eb 14                	jmp    8008e6 <getuint+0xf1>
+  8008d2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008d6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008da:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008e2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008e6:	8b 00                	mov    (%rax),%eax
+  8008e8:	89 c0                	mov    %eax,%eax
+}
+  8008ea:	c9                   	leave
+  8008eb:	c3                   	ret
+
+00000000008008ec <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  8008ec:	55                   	push   %rbp
+  8008ed:	48 89 e5             	mov    %rsp,%rbp
+  8008f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8008f4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8008f8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8008fb:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8008ff:	7e 4b                	jle    80094c <getint+0x60>
+    return va_arg(*ap, long long);
+  800901:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800905:	8b 00                	mov    (%rax),%eax
+  800907:	83 f8 2f             	cmp    $0x2f,%eax
+  80090a:	77 24                	ja     800930 <getint+0x44>
+  80090c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800910:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800914:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800918:	8b 00                	mov    (%rax),%eax
+  80091a:	89 c0                	mov    %eax,%eax
+  80091c:	48 01 d0             	add    %rdx,%rax
+  80091f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800923:	8b 12                	mov    (%rdx),%edx
+  800925:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800928:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80092c:	89 0a                	mov    %ecx,(%rdx)
+  80092e:	eb 14                	jmp    800944 <getint+0x58>
+  800930:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800934:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800938:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80093c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800940:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800944:	48 8b 00             	mov    (%rax),%rax
+  800947:	e9 95 00 00 00       	jmp    8009e1 <getint+0xf5>
+  else if (lflag)
+  80094c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800950:	74 48                	je     80099a <getint+0xae>
+    return va_arg(*ap, long);
+  800952:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800956:	8b 00                	mov    (%rax),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	77 24                	ja     800981 <getint+0x95>
+  80095d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800961:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800965:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800969:	8b 00                	mov    (%rax),%eax
+  80096b:	89 c0                	mov    %eax,%eax
+  80096d:	48 01 d0             	add    %rdx,%rax
+  800970:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800974:	8b 12                	mov    (%rdx),%edx
+  800976:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800979:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80097d:	89 0a                	mov    %ecx,(%rdx)
+  80097f:	eb 14                	jmp    800995 <getint+0xa9>
+  800981:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800985:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800989:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80098d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800991:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800995:	48 8b 00             	mov    (%rax),%rax
+  800998:	eb 47                	jmp    8009e1 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  80099a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80099e:	8b 00                	mov    (%rax),%eax
+  8009a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a3:	77 24                	ja     8009c9 <getint+0xdd>
+  8009a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009a9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b1:	8b 00                	mov    (%rax),%eax
+  8009b3:	89 c0                	mov    %eax,%eax
+  8009b5:	48 01 d0             	add    %rdx,%rax
+  8009b8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009bc:	8b 12                	mov    (%rdx),%edx
+  8009be:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009c5:	89 0a                	mov    %ecx,(%rdx)
+  8009c7:	eb 14                	jmp    8009dd <getint+0xf1>
+  8009c9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009cd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009d1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009d9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009dd:	8b 00                	mov    (%rax),%eax
+  8009df:	48 98                	cltq
+}
+  8009e1:	c9                   	leave
+  8009e2:	c3                   	ret
+
+00000000008009e3 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  8009e3:	55                   	push   %rbp
+  8009e4:	48 89 e5             	mov    %rsp,%rbp
+  8009e7:	41 54                	push   %r12
+  8009e9:	53                   	push   %rbx
+  8009ea:	48 83 ec 60          	sub    $0x60,%rsp
+  8009ee:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8009f2:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8009f6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8009fa:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  8009fe:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a02:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a06:	48 8b 06             	mov    (%rsi),%rax
+  800a09:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a0d:	48 89 01             	mov    %rax,(%rcx)
+  800a10:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a14:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a18:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a1c:	eb 17                	jmp    800a35 <vprintfmt+0x52>
+      if (ch == '\0')
+  800a1e:	85 db                	test   %ebx,%ebx
+  800a20:	0f 84 bf 04 00 00    	je     800ee5 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800a26:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a2a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a2e:	48 89 c6             	mov    %rax,%rsi
+  800a31:	89 df                	mov    %ebx,%edi
+  800a33:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a35:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a39:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a3d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a41:	0f b6 00             	movzbl (%rax),%eax
+  800a44:	0f b6 d8             	movzbl %al,%ebx
+  800a47:	83 fb 25             	cmp    $0x25,%ebx
+  800a4a:	75 d2                	jne    800a1e <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800a4c:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800a50:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800a57:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800a5e:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800a65:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800a6c:	eb 04                	jmp    800a72 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800a6e:	90                   	nop
+  800a6f:	eb 01                	jmp    800a72 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800a71:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800a72:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a76:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a7a:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a7e:	0f b6 00             	movzbl (%rax),%eax
+  800a81:	0f b6 d8             	movzbl %al,%ebx
+  800a84:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800a87:	83 f8 55             	cmp    $0x55,%eax
+  800a8a:	0f 87 22 04 00 00    	ja     800eb2 <vprintfmt+0x4cf>
+  800a90:	89 c0                	mov    %eax,%eax
+  800a92:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800a99:	00 
+  800a9a:	48 b8 d8 69 80 00 00 	movabs $0x8069d8,%rax
+  800aa1:	00 00 00 
+  800aa4:	48 01 d0             	add    %rdx,%rax
+  800aa7:	48 8b 00             	mov    (%rax),%rax
+  800aaa:	ff e0                	jmp    *%rax
+        padc = '-';
+  800aac:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800ab0:	eb c0                	jmp    800a72 <vprintfmt+0x8f>
+        padc = '0';
+  800ab2:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800ab6:	eb ba                	jmp    800a72 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800ab8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800abf:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800ac2:	89 d0                	mov    %edx,%eax
+  800ac4:	c1 e0 02             	shl    $0x2,%eax
+  800ac7:	01 d0                	add    %edx,%eax
+  800ac9:	01 c0                	add    %eax,%eax
+  800acb:	01 d8                	add    %ebx,%eax
+  800acd:	83 e8 30             	sub    $0x30,%eax
+  800ad0:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800ad3:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ad7:	0f b6 00             	movzbl (%rax),%eax
+  800ada:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800add:	83 fb 2f             	cmp    $0x2f,%ebx
+  800ae0:	7e 60                	jle    800b42 <vprintfmt+0x15f>
+  800ae2:	83 fb 39             	cmp    $0x39,%ebx
+  800ae5:	7f 5b                	jg     800b42 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800ae7:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800aec:	eb d1                	jmp    800abf <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800aee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af1:	83 f8 2f             	cmp    $0x2f,%eax
+  800af4:	77 17                	ja     800b0d <vprintfmt+0x12a>
+  800af6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800afa:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800afd:	89 d2                	mov    %edx,%edx
+  800aff:	48 01 d0             	add    %rdx,%rax
+  800b02:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b05:	83 c2 08             	add    $0x8,%edx
+  800b08:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b0b:	eb 0c                	jmp    800b19 <vprintfmt+0x136>
+  800b0d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b11:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b15:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b19:	8b 00                	mov    (%rax),%eax
+  800b1b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800b1e:	eb 23                	jmp    800b43 <vprintfmt+0x160>
+        if (width < 0)
+  800b20:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b24:	0f 89 44 ff ff ff    	jns    800a6e <vprintfmt+0x8b>
+          width = 0;
+  800b2a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800b31:	e9 38 ff ff ff       	jmp    800a6e <vprintfmt+0x8b>
+        altflag = 1;
+  800b36:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800b3d:	e9 30 ff ff ff       	jmp    800a72 <vprintfmt+0x8f>
+        goto process_precision;
+  800b42:	90                   	nop
+        if (width < 0)
+  800b43:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b47:	0f 89 24 ff ff ff    	jns    800a71 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800b4d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800b50:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800b53:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800b5a:	e9 12 ff ff ff       	jmp    800a71 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800b5f:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800b63:	e9 0a ff ff ff       	jmp    800a72 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800b68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6e:	77 17                	ja     800b87 <vprintfmt+0x1a4>
+  800b70:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b74:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b77:	89 d2                	mov    %edx,%edx
+  800b79:	48 01 d0             	add    %rdx,%rax
+  800b7c:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b7f:	83 c2 08             	add    $0x8,%edx
+  800b82:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b85:	eb 0c                	jmp    800b93 <vprintfmt+0x1b0>
+  800b87:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b8b:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b8f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b93:	8b 00                	mov    (%rax),%eax
+  800b95:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800b99:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800b9d:	48 89 d6             	mov    %rdx,%rsi
+  800ba0:	89 c7                	mov    %eax,%edi
+  800ba2:	ff d1                	call   *%rcx
+        break;
+  800ba4:	e9 37 03 00 00       	jmp    800ee0 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800ba9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bac:	83 f8 2f             	cmp    $0x2f,%eax
+  800baf:	77 17                	ja     800bc8 <vprintfmt+0x1e5>
+  800bb1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bb5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bb8:	89 d2                	mov    %edx,%edx
+  800bba:	48 01 d0             	add    %rdx,%rax
+  800bbd:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bc0:	83 c2 08             	add    $0x8,%edx
+  800bc3:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bc6:	eb 0c                	jmp    800bd4 <vprintfmt+0x1f1>
+  800bc8:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bcc:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bd0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800bd4:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800bd6:	85 db                	test   %ebx,%ebx
+  800bd8:	79 02                	jns    800bdc <vprintfmt+0x1f9>
+          err = -err;
+  800bda:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800bdc:	83 fb 15             	cmp    $0x15,%ebx
+  800bdf:	7f 16                	jg     800bf7 <vprintfmt+0x214>
+  800be1:	48 ba 00 69 80 00 00 	movabs $0x806900,%rdx
+  800be8:	00 00 00 
+  800beb:	48 63 c3             	movslq %ebx,%rax
+  800bee:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800bf2:	4d 85 e4             	test   %r12,%r12
+  800bf5:	75 2e                	jne    800c25 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800bf7:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800bfb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800bff:	89 d9                	mov    %ebx,%ecx
+  800c01:	48 ba c1 69 80 00 00 	movabs $0x8069c1,%rdx
+  800c08:	00 00 00 
+  800c0b:	48 89 c7             	mov    %rax,%rdi
+  800c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c13:	49 b8 ef 0e 80 00 00 	movabs $0x800eef,%r8
+  800c1a:	00 00 00 
+  800c1d:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800c20:	e9 bb 02 00 00       	jmp    800ee0 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800c25:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c29:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c2d:	4c 89 e1             	mov    %r12,%rcx
+  800c30:	48 ba ca 69 80 00 00 	movabs $0x8069ca,%rdx
+  800c37:	00 00 00 
+  800c3a:	48 89 c7             	mov    %rax,%rdi
+  800c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c42:	49 b8 ef 0e 80 00 00 	movabs $0x800eef,%r8
+  800c49:	00 00 00 
+  800c4c:	41 ff d0             	call   *%r8
+        break;
+  800c4f:	e9 8c 02 00 00       	jmp    800ee0 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800c54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c57:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5a:	77 17                	ja     800c73 <vprintfmt+0x290>
+  800c5c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c60:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c63:	89 d2                	mov    %edx,%edx
+  800c65:	48 01 d0             	add    %rdx,%rax
+  800c68:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c6b:	83 c2 08             	add    $0x8,%edx
+  800c6e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c71:	eb 0c                	jmp    800c7f <vprintfmt+0x29c>
+  800c73:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c77:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c7b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c7f:	4c 8b 20             	mov    (%rax),%r12
+  800c82:	4d 85 e4             	test   %r12,%r12
+  800c85:	75 0a                	jne    800c91 <vprintfmt+0x2ae>
+          p = "(null)";
+  800c87:	49 bc cd 69 80 00 00 	movabs $0x8069cd,%r12
+  800c8e:	00 00 00 
+        if (width > 0 && padc != '-')
+  800c91:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800c95:	7e 78                	jle    800d0f <vprintfmt+0x32c>
+  800c97:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800c9b:	74 72                	je     800d0f <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800c9d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ca0:	48 98                	cltq
+  800ca2:	48 89 c6             	mov    %rax,%rsi
+  800ca5:	4c 89 e7             	mov    %r12,%rdi
+  800ca8:	48 b8 fb 15 80 00 00 	movabs $0x8015fb,%rax
+  800caf:	00 00 00 
+  800cb2:	ff d0                	call   *%rax
+  800cb4:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800cb7:	eb 17                	jmp    800cd0 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800cb9:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800cbd:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800cc1:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800cc5:	48 89 d6             	mov    %rdx,%rsi
+  800cc8:	89 c7                	mov    %eax,%edi
+  800cca:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800ccc:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800cd0:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800cd4:	7f e3                	jg     800cb9 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800cd6:	eb 37                	jmp    800d0f <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800cd8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800cdc:	74 1e                	je     800cfc <vprintfmt+0x319>
+  800cde:	83 fb 1f             	cmp    $0x1f,%ebx
+  800ce1:	7e 05                	jle    800ce8 <vprintfmt+0x305>
+  800ce3:	83 fb 7e             	cmp    $0x7e,%ebx
+  800ce6:	7e 14                	jle    800cfc <vprintfmt+0x319>
+            putch('?', putdat);
+  800ce8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cec:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800cf0:	48 89 c6             	mov    %rax,%rsi
+  800cf3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800cf8:	ff d2                	call   *%rdx
+  800cfa:	eb 0f                	jmp    800d0b <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800cfc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d00:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d04:	48 89 c6             	mov    %rax,%rsi
+  800d07:	89 df                	mov    %ebx,%edi
+  800d09:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d0b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d0f:	4c 89 e0             	mov    %r12,%rax
+  800d12:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d16:	0f b6 00             	movzbl (%rax),%eax
+  800d19:	0f be d8             	movsbl %al,%ebx
+  800d1c:	85 db                	test   %ebx,%ebx
+  800d1e:	74 28                	je     800d48 <vprintfmt+0x365>
+  800d20:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d24:	78 b2                	js     800cd8 <vprintfmt+0x2f5>
+  800d26:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800d2a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d2e:	79 a8                	jns    800cd8 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800d30:	eb 16                	jmp    800d48 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800d32:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d36:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d3a:	48 89 c6             	mov    %rax,%rsi
+  800d3d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d42:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800d44:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d48:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d4c:	7f e4                	jg     800d32 <vprintfmt+0x34f>
+        break;
+  800d4e:	e9 8d 01 00 00       	jmp    800ee0 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800d53:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800d56:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800d5a:	89 d6                	mov    %edx,%esi
+  800d5c:	48 89 c7             	mov    %rax,%rdi
+  800d5f:	48 b8 ec 08 80 00 00 	movabs $0x8008ec,%rax
+  800d66:	00 00 00 
+  800d69:	ff d0                	call   *%rax
+  800d6b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800d6f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d73:	48 85 c0             	test   %rax,%rax
+  800d76:	79 1d                	jns    800d95 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800d78:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d7c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d80:	48 89 c6             	mov    %rax,%rsi
+  800d83:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800d88:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800d8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d8e:	48 f7 d8             	neg    %rax
+  800d91:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800d95:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800d9c:	e9 d2 00 00 00       	jmp    800e73 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800da1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800da4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800da8:	89 d6                	mov    %edx,%esi
+  800daa:	48 89 c7             	mov    %rax,%rdi
+  800dad:	48 b8 f5 07 80 00 00 	movabs $0x8007f5,%rax
+  800db4:	00 00 00 
+  800db7:	ff d0                	call   *%rax
+  800db9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800dbd:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800dc4:	e9 aa 00 00 00       	jmp    800e73 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800dc9:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800dcc:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800dd0:	89 d6                	mov    %edx,%esi
+  800dd2:	48 89 c7             	mov    %rax,%rdi
+  800dd5:	48 b8 f5 07 80 00 00 	movabs $0x8007f5,%rax
+  800ddc:	00 00 00 
+  800ddf:	ff d0                	call   *%rax
+  800de1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800de5:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800dec:	e9 82 00 00 00       	jmp    800e73 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800df1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800df5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800df9:	48 89 c6             	mov    %rax,%rsi
+  800dfc:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e01:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800e03:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e07:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e0b:	48 89 c6             	mov    %rax,%rsi
+  800e0e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e13:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800e15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e18:	83 f8 2f             	cmp    $0x2f,%eax
+  800e1b:	77 17                	ja     800e34 <vprintfmt+0x451>
+  800e1d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e21:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e24:	89 d2                	mov    %edx,%edx
+  800e26:	48 01 d0             	add    %rdx,%rax
+  800e29:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e2c:	83 c2 08             	add    $0x8,%edx
+  800e2f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e32:	eb 0c                	jmp    800e40 <vprintfmt+0x45d>
+  800e34:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e38:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e3c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e40:	48 8b 00             	mov    (%rax),%rax
+  800e43:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800e47:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800e4e:	eb 23                	jmp    800e73 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800e50:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e53:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e57:	89 d6                	mov    %edx,%esi
+  800e59:	48 89 c7             	mov    %rax,%rdi
+  800e5c:	48 b8 f5 07 80 00 00 	movabs $0x8007f5,%rax
+  800e63:	00 00 00 
+  800e66:	ff d0                	call   *%rax
+  800e68:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800e6c:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800e73:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800e78:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800e7b:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800e7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800e82:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800e86:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e8a:	45 89 c1             	mov    %r8d,%r9d
+  800e8d:	41 89 f8             	mov    %edi,%r8d
+  800e90:	48 89 c7             	mov    %rax,%rdi
+  800e93:	48 b8 3d 07 80 00 00 	movabs $0x80073d,%rax
+  800e9a:	00 00 00 
+  800e9d:	ff d0                	call   *%rax
+        break;
+  800e9f:	eb 3f                	jmp    800ee0 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800ea1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ea5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ea9:	48 89 c6             	mov    %rax,%rsi
+  800eac:	89 df                	mov    %ebx,%edi
+  800eae:	ff d2                	call   *%rdx
+        break;
+  800eb0:	eb 2e                	jmp    800ee0 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800eb2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800eb6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800eba:	48 89 c6             	mov    %rax,%rsi
+  800ebd:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ec2:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800ec4:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ec9:	eb 05                	jmp    800ed0 <vprintfmt+0x4ed>
+  800ecb:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800ed0:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ed4:	48 83 e8 01          	sub    $0x1,%rax
+  800ed8:	0f b6 00             	movzbl (%rax),%eax
+  800edb:	3c 25                	cmp    $0x25,%al
+  800edd:	75 ec                	jne    800ecb <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800edf:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800ee0:	e9 50 fb ff ff       	jmp    800a35 <vprintfmt+0x52>
+        return;
+  800ee5:	90                   	nop
+    }
+  }
+}
+  800ee6:	48 83 c4 60          	add    $0x60,%rsp
+  800eea:	5b                   	pop    %rbx
+  800eeb:	41 5c                	pop    %r12
+  800eed:	5d                   	pop    %rbp
+  800eee:	c3                   	ret
+
+0000000000800eef <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800eef:	55                   	push   %rbp
+  800ef0:	48 89 e5             	mov    %rsp,%rbp
+  800ef3:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800efa:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f01:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f08:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f0f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f16:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f1d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f24:	84 c0                	test   %al,%al
+  800f26:	74 20                	je     800f48 <printfmt+0x59>
+  800f28:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f2c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f30:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f34:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f38:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f3c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f40:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f44:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800f48:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f4f:	00 00 00 
+  800f52:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800f59:	00 00 00 
+  800f5c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f60:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800f67:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800f6e:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800f75:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800f7c:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800f83:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800f8a:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800f91:	48 89 c7             	mov    %rax,%rdi
+  800f94:	48 b8 e3 09 80 00 00 	movabs $0x8009e3,%rax
+  800f9b:	00 00 00 
+  800f9e:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800fa0:	90                   	nop
+  800fa1:	c9                   	leave
+  800fa2:	c3                   	ret
+
+0000000000800fa3 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800fa3:	55                   	push   %rbp
+  800fa4:	48 89 e5             	mov    %rsp,%rbp
+  800fa7:	48 83 ec 10          	sub    $0x10,%rsp
+  800fab:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800fae:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800fb2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fb6:	8b 40 10             	mov    0x10(%rax),%eax
+  800fb9:	8d 50 01             	lea    0x1(%rax),%edx
+  800fbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fc0:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800fc3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fc7:	48 8b 10             	mov    (%rax),%rdx
+  800fca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800fd2:	48 39 c2             	cmp    %rax,%rdx
+  800fd5:	73 17                	jae    800fee <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800fd7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800fdb:	48 8b 00             	mov    (%rax),%rax
+  800fde:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800fe2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800fe6:	48 89 0a             	mov    %rcx,(%rdx)
+  800fe9:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800fec:	88 10                	mov    %dl,(%rax)
+}
+  800fee:	90                   	nop
+  800fef:	c9                   	leave
+  800ff0:	c3                   	ret
+
+0000000000800ff1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800ff1:	55                   	push   %rbp
+  800ff2:	48 89 e5             	mov    %rsp,%rbp
+  800ff5:	48 83 ec 40          	sub    $0x40,%rsp
+  800ff9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800ffd:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801000:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801004:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801008:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80100c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801010:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801013:	48 98                	cltq
+  801015:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801019:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80101d:	48 01 d0             	add    %rdx,%rax
+  801020:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801024:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  80102b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801030:	74 06                	je     801038 <vsnprintf+0x47>
+  801032:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801036:	7f 07                	jg     80103f <vsnprintf+0x4e>
+    return -E_INVAL;
+  801038:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80103d:	eb 32                	jmp    801071 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  80103f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801043:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801047:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80104b:	48 89 c6             	mov    %rax,%rsi
+  80104e:	48 b8 a3 0f 80 00 00 	movabs $0x800fa3,%rax
+  801055:	00 00 00 
+  801058:	48 89 c7             	mov    %rax,%rdi
+  80105b:	48 b8 e3 09 80 00 00 	movabs $0x8009e3,%rax
+  801062:	00 00 00 
+  801065:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801067:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80106b:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  80106e:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801071:	c9                   	leave
+  801072:	c3                   	ret
+
+0000000000801073 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801073:	55                   	push   %rbp
+  801074:	48 89 e5             	mov    %rsp,%rbp
+  801077:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80107e:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801085:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  80108b:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801092:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  801099:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010a0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010a7:	84 c0                	test   %al,%al
+  8010a9:	74 20                	je     8010cb <snprintf+0x58>
+  8010ab:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010af:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8010b3:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8010b7:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8010bb:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8010bf:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8010c3:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8010c7:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8010cb:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8010d2:	00 00 00 
+  8010d5:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8010dc:	00 00 00 
+  8010df:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8010e3:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8010ea:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8010f1:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  8010f8:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  8010ff:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801106:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80110c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801113:	48 89 c7             	mov    %rax,%rdi
+  801116:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  80111d:	00 00 00 
+  801120:	ff d0                	call   *%rax
+  801122:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801128:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80112e:	c9                   	leave
+  80112f:	c3                   	ret
+
+0000000000801130 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801130:	55                   	push   %rbp
+  801131:	48 89 e5             	mov    %rsp,%rbp
+  801134:	53                   	push   %rbx
+  801135:	48 83 ec 38          	sub    $0x38,%rsp
+  801139:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80113c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801140:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801144:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801148:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  80114c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80114f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801154:	89 d1                	mov    %edx,%ecx
+  801156:	0f a2                	cpuid
+  801158:	89 de                	mov    %ebx,%esi
+  80115a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80115d:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801160:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801163:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801166:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80116b:	74 09                	je     801176 <cpuid+0x46>
+}
+  80116d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801171:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801174:	89 10                	mov    %edx,(%rax)
+
+  801176:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80117b:	74 09                	je     801186 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  80117d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801181:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801184:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801186:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80118b:	74 09                	je     801196 <cpuid+0x66>
+char *
+  80118d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801191:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801194:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801196:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80119b:	74 09                	je     8011a6 <cpuid+0x76>
+  for (; *s; s++)
+  80119d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011a1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8011a4:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  8011a6:	90                   	nop
+  8011a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011ab:	c9                   	leave
+  8011ac:	c3                   	ret
+
+00000000008011ad <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  8011ad:	55                   	push   %rbp
+  8011ae:	48 89 e5             	mov    %rsp,%rbp
+  8011b1:	48 83 ec 18          	sub    $0x18,%rsp
+  8011b5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  8011b8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8011bb:	89 c1                	mov    %eax,%ecx
+  8011bd:	0f 01 d0             	xgetbv
+  8011c0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8011c3:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  8011c6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8011c9:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8011cc:	48 c1 e2 20          	shl    $0x20,%rdx
+  8011d0:	48 09 d0             	or     %rdx,%rax
+#else
+  8011d3:	c9                   	leave
+  8011d4:	c3                   	ret
+
+00000000008011d5 <string_cpu>:
+string_cpu(void) {
+  8011d5:	55                   	push   %rbp
+  8011d6:	48 89 e5             	mov    %rsp,%rbp
+  8011d9:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8011dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  8011e4:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  8011eb:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8011f2:	00 00 00 
+  8011f5:	8b 00                	mov    (%rax),%eax
+  8011f7:	85 c0                	test   %eax,%eax
+  8011f9:	78 11                	js     80120c <string_cpu+0x37>
+    return string_features;
+  8011fb:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801202:	00 00 00 
+  801205:	8b 00                	mov    (%rax),%eax
+  801207:	e9 df 00 00 00       	jmp    8012eb <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80120c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801216:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80121b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801220:	48 89 c6             	mov    %rax,%rsi
+  801223:	bf 00 00 00 00       	mov    $0x0,%edi
+  801228:	48 b8 30 11 80 00 00 	movabs $0x801130,%rax
+  80122f:	00 00 00 
+  801232:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801234:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801237:	83 f8 06             	cmp    $0x6,%eax
+  80123a:	76 28                	jbe    801264 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  80123c:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801246:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80124b:	48 89 c2             	mov    %rax,%rdx
+  80124e:	be 00 00 00 00       	mov    $0x0,%esi
+  801253:	bf 07 00 00 00       	mov    $0x7,%edi
+  801258:	48 b8 30 11 80 00 00 	movabs $0x801130,%rax
+  80125f:	00 00 00 
+  801262:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801264:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801267:	25 00 02 00 00       	and    $0x200,%eax
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	74 04                	je     801274 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801270:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801274:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801278:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80127e:	48 89 c1             	mov    %rax,%rcx
+  801281:	ba 00 00 00 00       	mov    $0x0,%edx
+  801286:	be 00 00 00 00       	mov    $0x0,%esi
+  80128b:	bf 01 00 00 00       	mov    $0x1,%edi
+  801290:	48 b8 30 11 80 00 00 	movabs $0x801130,%rax
+  801297:	00 00 00 
+  80129a:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80129c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80129f:	83 e0 20             	and    $0x20,%eax
+  8012a2:	85 c0                	test   %eax,%eax
+  8012a4:	74 2a                	je     8012d0 <string_cpu+0xfb>
+  8012a6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8012a9:	25 00 00 00 08       	and    $0x8000000,%eax
+  8012ae:	85 c0                	test   %eax,%eax
+  8012b0:	74 1e                	je     8012d0 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  8012b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012b7:	48 b8 ad 11 80 00 00 	movabs $0x8011ad,%rax
+  8012be:	00 00 00 
+  8012c1:	ff d0                	call   *%rax
+  8012c3:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8012c6:	48 83 f8 06          	cmp    $0x6,%rax
+  8012ca:	75 04                	jne    8012d0 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8012cc:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8012d0:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  8012d7:	00 00 00 
+  8012da:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8012dd:	89 02                	mov    %eax,(%rdx)
+  8012df:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  8012e6:	00 00 00 
+  8012e9:	8b 00                	mov    (%rax),%eax
+}
+  8012eb:	c9                   	leave
+  8012ec:	c3                   	ret
+
+00000000008012ed <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8012ed:	55                   	push   %rbp
+  8012ee:	48 89 e5             	mov    %rsp,%rbp
+  8012f1:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8012f5:	48 83 ec 60          	sub    $0x60,%rsp
+  8012f9:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8012fe:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801303:	83 e0 1f             	and    $0x1f,%eax
+  801306:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80130a:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80130e:	48 f7 d8             	neg    %rax
+  801311:	48 89 c2             	mov    %rax,%rdx
+  801314:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801319:	48 01 d0             	add    %rdx,%rax
+  80131c:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801321:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801325:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80132b:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801330:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801334:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80133a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80133e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801342:	89 c2                	mov    %eax,%edx
+  801344:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801348:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80134d:	89 c1                	mov    %eax,%ecx
+  80134f:	d3 e6                	shl    %cl,%esi
+  801351:	89 f0                	mov    %esi,%eax
+  801353:	21 d0                	and    %edx,%eax
+  801355:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  801359:	eb 21                	jmp    80137c <strlen_avx2+0x8f>
+    p += 32;
+  80135b:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801361:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801366:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80136a:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801370:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801374:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801378:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80137c:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801381:	74 d8                	je     80135b <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801383:	31 c0                	xor    %eax,%eax
+  801385:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  80138b:	48 63 d0             	movslq %eax,%rdx
+  80138e:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801393:	48 01 d0             	add    %rdx,%rax
+  801396:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80139b:	c9                   	leave
+  80139c:	c3                   	ret
+
+000000000080139d <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80139d:	55                   	push   %rbp
+  80139e:	48 89 e5             	mov    %rsp,%rbp
+  8013a1:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8013a5:	48 83 ec 40          	sub    $0x40,%rsp
+  8013a9:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8013ae:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  8013b3:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  8013b8:	eb 77                	jmp    801431 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  8013ba:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013bf:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8013c3:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8013c7:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8013cc:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8013d0:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8013d4:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013d8:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8013dc:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8013e1:	74 3c                	je     80141f <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8013e3:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8013e7:	f7 d0                	not    %eax
+  8013e9:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8013ed:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8013f1:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8013f5:	48 63 d0             	movslq %eax,%rdx
+  8013f8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8013fd:	48 01 d0             	add    %rdx,%rax
+  801400:	0f b6 00             	movzbl (%rax),%eax
+  801403:	0f b6 c0             	movzbl %al,%eax
+  801406:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80140a:	48 63 ca             	movslq %edx,%rcx
+  80140d:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801412:	48 01 ca             	add    %rcx,%rdx
+  801415:	0f b6 12             	movzbl (%rdx),%edx
+  801418:	0f b6 d2             	movzbl %dl,%edx
+  80141b:	29 d0                	sub    %edx,%eax
+  80141d:	eb 6b                	jmp    80148a <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80141f:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801425:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80142b:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801431:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801437:	77 81                	ja     8013ba <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801439:	eb 42                	jmp    80147d <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80143b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801440:	0f b6 10             	movzbl (%rax),%edx
+  801443:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801448:	0f b6 00             	movzbl (%rax),%eax
+  80144b:	38 c2                	cmp    %al,%dl
+  80144d:	74 1c                	je     80146b <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  80144f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801454:	0f b6 00             	movzbl (%rax),%eax
+  801457:	0f b6 c8             	movzbl %al,%ecx
+  80145a:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80145f:	0f b6 00             	movzbl (%rax),%eax
+  801462:	0f b6 d0             	movzbl %al,%edx
+  801465:	89 c8                	mov    %ecx,%eax
+  801467:	29 d0                	sub    %edx,%eax
+  801469:	eb 1f                	jmp    80148a <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  80146b:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801471:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801477:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80147d:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801483:	75 b6                	jne    80143b <memcmp_avx2+0x9e>
+  return 0;
+  801485:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80148a:	c9                   	leave
+  80148b:	c3                   	ret
+
+000000000080148c <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80148c:	55                   	push   %rbp
+  80148d:	48 89 e5             	mov    %rsp,%rbp
+  801490:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801494:	48 83 ec 60          	sub    $0x60,%rsp
+  801498:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80149d:	89 f0                	mov    %esi,%eax
+  80149f:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  8014a4:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8014a8:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8014ad:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  8014b1:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  8014b6:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  8014bc:	eb 47                	jmp    801505 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  8014be:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014c3:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8014c7:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8014cb:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8014d1:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8014d5:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8014d9:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8014dd:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8014e2:	74 15                	je     8014f9 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8014e4:	31 c0                	xor    %eax,%eax
+  8014e6:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8014ec:	48 63 d0             	movslq %eax,%rdx
+  8014ef:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014f4:	48 01 d0             	add    %rdx,%rax
+  8014f7:	eb 3d                	jmp    801536 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8014f9:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8014ff:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801505:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80150b:	77 b1                	ja     8014be <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80150d:	eb 0c                	jmp    80151b <memfind_avx2+0x8f>
+  80150f:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801515:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80151b:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801521:	74 0e                	je     801531 <memfind_avx2+0xa5>
+  801523:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801528:	0f b6 00             	movzbl (%rax),%eax
+  80152b:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80152f:	75 de                	jne    80150f <memfind_avx2+0x83>
+  return s;
+  801531:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801536:	c9                   	leave
+  801537:	c3                   	ret
+
+0000000000801538 <strlen>:
+strlen(const char *s) {
+  801538:	55                   	push   %rbp
+  801539:	48 89 e5             	mov    %rsp,%rbp
+  80153c:	48 83 ec 40          	sub    $0x40,%rsp
+  801540:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801544:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801548:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80154c:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  801553:	00 00 00 
+  801556:	ff d0                	call   *%rax
+  801558:	83 e0 02             	and    $0x2,%eax
+  80155b:	85 c0                	test   %eax,%eax
+  80155d:	74 18                	je     801577 <strlen+0x3f>
+    return strlen_avx2(s);
+  80155f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801563:	48 89 c7             	mov    %rax,%rdi
+  801566:	48 b8 ed 12 80 00 00 	movabs $0x8012ed,%rax
+  80156d:	00 00 00 
+  801570:	ff d0                	call   *%rax
+  801572:	e9 82 00 00 00       	jmp    8015f9 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801577:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80157b:	83 e0 0f             	and    $0xf,%eax
+  80157e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801581:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801584:	48 f7 d8             	neg    %rax
+  801587:	48 89 c2             	mov    %rax,%rdx
+  80158a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80158e:	48 01 d0             	add    %rdx,%rax
+  801591:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801595:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801599:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80159d:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8015a2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8015a6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015aa:	89 c2                	mov    %eax,%edx
+  8015ac:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8015af:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8015b4:	89 c1                	mov    %eax,%ecx
+  8015b6:	d3 e6                	shl    %cl,%esi
+  8015b8:	89 f0                	mov    %esi,%eax
+  8015ba:	21 d0                	and    %edx,%eax
+  8015bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015bf:	eb 1d                	jmp    8015de <strlen+0xa6>
+    p += 16;
+  8015c1:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8015c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015ca:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8015ce:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8015d3:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8015d7:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8015de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8015e2:	74 dd                	je     8015c1 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8015e4:	31 c0                	xor    %eax,%eax
+  8015e6:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8015eb:	48 63 d0             	movslq %eax,%rdx
+  8015ee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015f2:	48 01 d0             	add    %rdx,%rax
+  8015f5:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+
+00000000008015fb <strnlen>:
+strnlen(const char *s, size_t size) {
+  8015fb:	55                   	push   %rbp
+  8015fc:	48 89 e5             	mov    %rsp,%rbp
+  8015ff:	48 83 ec 20          	sub    $0x20,%rsp
+  801603:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801607:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80160b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801612:	eb 0e                	jmp    801622 <strnlen+0x27>
+    n++;
+  801614:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801618:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80161d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801622:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801627:	74 0b                	je     801634 <strnlen+0x39>
+  801629:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80162d:	0f b6 00             	movzbl (%rax),%eax
+  801630:	84 c0                	test   %al,%al
+  801632:	75 e0                	jne    801614 <strnlen+0x19>
+  return n;
+  801634:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801637:	c9                   	leave
+  801638:	c3                   	ret
+
+0000000000801639 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801639:	55                   	push   %rbp
+  80163a:	48 89 e5             	mov    %rsp,%rbp
+  80163d:	48 83 ec 20          	sub    $0x20,%rsp
+  801641:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801645:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801649:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80164d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801651:	90                   	nop
+  801652:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801656:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80165a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80165e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801662:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801666:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80166a:	0f b6 12             	movzbl (%rdx),%edx
+  80166d:	88 10                	mov    %dl,(%rax)
+  80166f:	0f b6 00             	movzbl (%rax),%eax
+  801672:	84 c0                	test   %al,%al
+  801674:	75 dc                	jne    801652 <strcpy+0x19>
+  return ret;
+  801676:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80167a:	c9                   	leave
+  80167b:	c3                   	ret
+
+000000000080167c <strcat>:
+strcat(char *dst, const char *src) {
+  80167c:	55                   	push   %rbp
+  80167d:	48 89 e5             	mov    %rsp,%rbp
+  801680:	48 83 ec 20          	sub    $0x20,%rsp
+  801684:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801688:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80168c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801690:	48 89 c7             	mov    %rax,%rdi
+  801693:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  80169a:	00 00 00 
+  80169d:	ff d0                	call   *%rax
+  80169f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8016a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8016a5:	48 63 d0             	movslq %eax,%rdx
+  8016a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016ac:	48 01 c2             	add    %rax,%rdx
+  8016af:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8016b3:	48 89 c6             	mov    %rax,%rsi
+  8016b6:	48 89 d7             	mov    %rdx,%rdi
+  8016b9:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  8016c0:	00 00 00 
+  8016c3:	ff d0                	call   *%rax
+  return dst;
+  8016c5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8016c9:	c9                   	leave
+  8016ca:	c3                   	ret
+
+00000000008016cb <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8016cb:	55                   	push   %rbp
+  8016cc:	48 89 e5             	mov    %rsp,%rbp
+  8016cf:	48 83 ec 28          	sub    $0x28,%rsp
+  8016d3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8016db:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8016df:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8016e7:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8016ee:	00 
+  8016ef:	eb 2a                	jmp    80171b <strncpy+0x50>
+    *dst++ = *src;
+  8016f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016f5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8016f9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8016fd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801701:	0f b6 12             	movzbl (%rdx),%edx
+  801704:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801706:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80170a:	0f b6 00             	movzbl (%rax),%eax
+  80170d:	84 c0                	test   %al,%al
+  80170f:	74 05                	je     801716 <strncpy+0x4b>
+      src++;
+  801711:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801716:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80171b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80171f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801723:	72 cc                	jb     8016f1 <strncpy+0x26>
+  return ret;
+  801725:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801729:	c9                   	leave
+  80172a:	c3                   	ret
+
+000000000080172b <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80172b:	55                   	push   %rbp
+  80172c:	48 89 e5             	mov    %rsp,%rbp
+  80172f:	48 83 ec 28          	sub    $0x28,%rsp
+  801733:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801737:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80173b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80173f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801743:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801747:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80174c:	74 3d                	je     80178b <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80174e:	eb 1d                	jmp    80176d <strlcpy+0x42>
+      *dst++ = *src++;
+  801750:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801754:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801758:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80175c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801760:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801764:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801768:	0f b6 12             	movzbl (%rdx),%edx
+  80176b:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80176d:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801772:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801777:	74 0b                	je     801784 <strlcpy+0x59>
+  801779:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80177d:	0f b6 00             	movzbl (%rax),%eax
+  801780:	84 c0                	test   %al,%al
+  801782:	75 cc                	jne    801750 <strlcpy+0x25>
+    *dst = '\0';
+  801784:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801788:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80178b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80178f:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801793:	c9                   	leave
+  801794:	c3                   	ret
+
+0000000000801795 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801795:	55                   	push   %rbp
+  801796:	48 89 e5             	mov    %rsp,%rbp
+  801799:	48 83 ec 30          	sub    $0x30,%rsp
+  80179d:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017a1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017a5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8017a9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017ad:	48 89 c7             	mov    %rax,%rdi
+  8017b0:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  8017b7:	00 00 00 
+  8017ba:	ff d0                	call   *%rax
+  8017bc:	48 98                	cltq
+  8017be:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8017c2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8017c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017ca:	48 89 d6             	mov    %rdx,%rsi
+  8017cd:	48 89 c7             	mov    %rax,%rdi
+  8017d0:	48 b8 fb 15 80 00 00 	movabs $0x8015fb,%rax
+  8017d7:	00 00 00 
+  8017da:	ff d0                	call   *%rax
+  8017dc:	48 98                	cltq
+  8017de:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8017e2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017e6:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8017ea:	75 10                	jne    8017fc <strlcat+0x67>
+    return maxlen + srclen;
+  8017ec:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8017f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017f4:	48 01 d0             	add    %rdx,%rax
+  8017f7:	e9 86 00 00 00       	jmp    801882 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8017fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801800:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801804:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801808:	73 2b                	jae    801835 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80180a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80180e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801812:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801816:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80181a:	48 01 c1             	add    %rax,%rcx
+  80181d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801821:	48 89 c6             	mov    %rax,%rsi
+  801824:	48 89 cf             	mov    %rcx,%rdi
+  801827:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  80182e:	00 00 00 
+  801831:	ff d0                	call   *%rax
+  801833:	eb 42                	jmp    801877 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801835:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801839:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80183d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801841:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801845:	48 01 c1             	add    %rax,%rcx
+  801848:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80184c:	48 89 c6             	mov    %rax,%rsi
+  80184f:	48 89 cf             	mov    %rcx,%rdi
+  801852:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  801859:	00 00 00 
+  80185c:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  80185e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801862:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801866:	48 01 d0             	add    %rdx,%rax
+  801869:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80186d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801871:	48 01 d0             	add    %rdx,%rax
+  801874:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801877:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80187b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80187f:	48 01 d0             	add    %rdx,%rax
+}
+  801882:	c9                   	leave
+  801883:	c3                   	ret
+
+0000000000801884 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801884:	55                   	push   %rbp
+  801885:	48 89 e5             	mov    %rsp,%rbp
+  801888:	48 83 ec 10          	sub    $0x10,%rsp
+  80188c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801890:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801894:	eb 0a                	jmp    8018a0 <strcmp+0x1c>
+    p++, q++;
+  801896:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80189b:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8018a0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018a4:	0f b6 00             	movzbl (%rax),%eax
+  8018a7:	84 c0                	test   %al,%al
+  8018a9:	74 12                	je     8018bd <strcmp+0x39>
+  8018ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018af:	0f b6 10             	movzbl (%rax),%edx
+  8018b2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018b6:	0f b6 00             	movzbl (%rax),%eax
+  8018b9:	38 c2                	cmp    %al,%dl
+  8018bb:	74 d9                	je     801896 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8018bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018c1:	0f b6 00             	movzbl (%rax),%eax
+  8018c4:	0f b6 d0             	movzbl %al,%edx
+  8018c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018cb:	0f b6 00             	movzbl (%rax),%eax
+  8018ce:	0f b6 c0             	movzbl %al,%eax
+  8018d1:	29 c2                	sub    %eax,%edx
+  8018d3:	89 d0                	mov    %edx,%eax
+}
+  8018d5:	c9                   	leave
+  8018d6:	c3                   	ret
+
+00000000008018d7 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  8018d7:	55                   	push   %rbp
+  8018d8:	48 89 e5             	mov    %rsp,%rbp
+  8018db:	48 83 ec 18          	sub    $0x18,%rsp
+  8018df:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8018e7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8018eb:	eb 0f                	jmp    8018fc <strncmp+0x25>
+    n--, p++, q++;
+  8018ed:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  8018f2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018f7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  8018fc:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801901:	74 1d                	je     801920 <strncmp+0x49>
+  801903:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801907:	0f b6 00             	movzbl (%rax),%eax
+  80190a:	84 c0                	test   %al,%al
+  80190c:	74 12                	je     801920 <strncmp+0x49>
+  80190e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801912:	0f b6 10             	movzbl (%rax),%edx
+  801915:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801919:	0f b6 00             	movzbl (%rax),%eax
+  80191c:	38 c2                	cmp    %al,%dl
+  80191e:	74 cd                	je     8018ed <strncmp+0x16>
+  if (n == 0)
+  801920:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801925:	75 07                	jne    80192e <strncmp+0x57>
+    return 0;
+  801927:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192c:	eb 16                	jmp    801944 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80192e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801932:	0f b6 00             	movzbl (%rax),%eax
+  801935:	0f b6 d0             	movzbl %al,%edx
+  801938:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80193c:	0f b6 00             	movzbl (%rax),%eax
+  80193f:	0f b6 c0             	movzbl %al,%eax
+  801942:	29 c2                	sub    %eax,%edx
+}
+  801944:	89 d0                	mov    %edx,%eax
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+
+0000000000801948 <strchr>:
+strchr(const char *s, char c) {
+  801948:	55                   	push   %rbp
+  801949:	48 89 e5             	mov    %rsp,%rbp
+  80194c:	48 83 ec 60          	sub    $0x60,%rsp
+  801950:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801954:	89 f0                	mov    %esi,%eax
+  801956:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801959:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80195d:	83 e0 0f             	and    $0xf,%eax
+  801960:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801963:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801966:	48 f7 d8             	neg    %rax
+  801969:	48 89 c2             	mov    %rax,%rdx
+  80196c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801970:	48 01 d0             	add    %rdx,%rax
+  801973:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801977:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  80197b:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  80197f:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801983:	66 0f 6e c0          	movd   %eax,%xmm0
+  801987:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  80198b:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  80198f:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801994:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801998:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80199c:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8019a0:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8019a4:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019a9:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8019ae:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019b2:	89 c2                	mov    %eax,%edx
+  8019b4:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019b9:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  8019be:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019c2:	09 c2                	or     %eax,%edx
+  8019c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019c7:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  8019cc:	89 c1                	mov    %eax,%ecx
+  8019ce:	d3 e6                	shl    %cl,%esi
+  8019d0:	89 f0                	mov    %esi,%eax
+  8019d2:	21 d0                	and    %edx,%eax
+  8019d4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8019d7:	eb 34                	jmp    801a0d <strchr+0xc5>
+    p += 16;
+  8019d9:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  8019de:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019e2:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8019e6:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  8019ea:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019ef:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8019f4:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8019f8:	89 c2                	mov    %eax,%edx
+  8019fa:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019ff:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801a04:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a08:	09 d0                	or     %edx,%eax
+  801a0a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801a0d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a11:	74 c6                	je     8019d9 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801a13:	31 c0                	xor    %eax,%eax
+  801a15:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801a1a:	48 98                	cltq
+  801a1c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801a20:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a24:	0f b6 00             	movzbl (%rax),%eax
+  801a27:	84 c0                	test   %al,%al
+  801a29:	74 06                	je     801a31 <strchr+0xe9>
+  801a2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a2f:	eb 05                	jmp    801a36 <strchr+0xee>
+  801a31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a36:	c9                   	leave
+  801a37:	c3                   	ret
+
+0000000000801a38 <strfind>:
+strfind(const char *s, char c) {
+  801a38:	55                   	push   %rbp
+  801a39:	48 89 e5             	mov    %rsp,%rbp
+  801a3c:	48 83 ec 10          	sub    $0x10,%rsp
+  801a40:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a44:	89 f0                	mov    %esi,%eax
+  801a46:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801a49:	eb 11                	jmp    801a5c <strfind+0x24>
+    if (*s == c)
+  801a4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a4f:	0f b6 00             	movzbl (%rax),%eax
+  801a52:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801a55:	74 12                	je     801a69 <strfind+0x31>
+  for (; *s; s++)
+  801a57:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a60:	0f b6 00             	movzbl (%rax),%eax
+  801a63:	84 c0                	test   %al,%al
+  801a65:	75 e4                	jne    801a4b <strfind+0x13>
+  801a67:	eb 01                	jmp    801a6a <strfind+0x32>
+      break;
+  801a69:	90                   	nop
+  return (char *)s;
+  801a6a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801a6e:	c9                   	leave
+  801a6f:	c3                   	ret
+
+0000000000801a70 <memset>:
+memset(void *v, int c, size_t n) {
+  801a70:	55                   	push   %rbp
+  801a71:	48 89 e5             	mov    %rsp,%rbp
+  801a74:	48 83 ec 38          	sub    $0x38,%rsp
+  801a78:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a7c:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801a7f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801a83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801a8b:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801a90:	76 41                	jbe    801ad3 <memset+0x63>
+  801a92:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  801a99:	00 00 00 
+  801a9c:	ff d0                	call   *%rax
+  801a9e:	83 e0 01             	and    $0x1,%eax
+  801aa1:	85 c0                	test   %eax,%eax
+  801aa3:	74 2e                	je     801ad3 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801aa5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801aa8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801aac:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801ab0:	48 89 ce             	mov    %rcx,%rsi
+  801ab3:	48 89 f7             	mov    %rsi,%rdi
+  801ab6:	48 89 d1             	mov    %rdx,%rcx
+  801ab9:	fc                   	cld
+  801aba:	f3 aa                	rep stos %al,%es:(%rdi)
+  801abc:	48 89 ca             	mov    %rcx,%rdx
+  801abf:	48 89 fe             	mov    %rdi,%rsi
+  801ac2:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801ac6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801aca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ace:	e9 a7 00 00 00       	jmp    801b7a <memset+0x10a>
+  if (n >= 8) {
+  801ad3:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801ad8:	0f 86 87 00 00 00    	jbe    801b65 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801ade:	eb 16                	jmp    801af6 <memset+0x86>
+      *p++ = c;
+  801ae0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801ae8:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801aec:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801aef:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801af1:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801af6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801afa:	83 e0 07             	and    $0x7,%eax
+  801afd:	48 85 c0             	test   %rax,%rax
+  801b00:	75 de                	jne    801ae0 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801b02:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801b05:	0f b6 c0             	movzbl %al,%eax
+  801b08:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801b0f:	01 01 01 
+  801b12:	48 0f af c2          	imul   %rdx,%rax
+  801b16:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801b1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b1e:	48 c1 e8 03          	shr    $0x3,%rax
+  801b22:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801b26:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b2a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b2e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b32:	48 89 ce             	mov    %rcx,%rsi
+  801b35:	48 89 f7             	mov    %rsi,%rdi
+  801b38:	48 89 d1             	mov    %rdx,%rcx
+  801b3b:	fc                   	cld
+  801b3c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801b3f:	48 89 ca             	mov    %rcx,%rdx
+  801b42:	48 89 fe             	mov    %rdi,%rsi
+  801b45:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801b49:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801b4d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801b52:	eb 11                	jmp    801b65 <memset+0xf5>
+    *p++ = c;
+  801b54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b58:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b5c:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b60:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801b63:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801b65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b69:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b6d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b71:	48 85 c0             	test   %rax,%rax
+  801b74:	75 de                	jne    801b54 <memset+0xe4>
+  return v;
+  801b76:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801b7a:	c9                   	leave
+  801b7b:	c3                   	ret
+
+0000000000801b7c <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801b7c:	55                   	push   %rbp
+  801b7d:	48 89 e5             	mov    %rsp,%rbp
+  801b80:	48 83 ec 38          	sub    $0x38,%rsp
+  801b84:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801b88:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801b8c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801b90:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b94:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801b98:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b9c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801ba0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba4:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801ba8:	0f 83 da 00 00 00    	jae    801c88 <memmove+0x10c>
+  801bae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801bb2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bb6:	48 01 d0             	add    %rdx,%rax
+  801bb9:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801bbd:	0f 83 c5 00 00 00    	jae    801c88 <memmove+0x10c>
+    s += n;
+  801bc3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bc7:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801bcb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bcf:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801bd3:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801bd8:	0f 86 94 00 00 00    	jbe    801c72 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801bde:	eb 1c                	jmp    801bfc <memmove+0x80>
+        *--d = *--s;
+  801be0:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801be5:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801bea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bee:	0f b6 10             	movzbl (%rax),%edx
+  801bf1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bf5:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801bf7:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801bfc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c00:	83 e0 07             	and    $0x7,%eax
+  801c03:	48 85 c0             	test   %rax,%rax
+  801c06:	75 d8                	jne    801be0 <memmove+0x64>
+      nq = n / 8;
+  801c08:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c0c:	48 c1 e8 03          	shr    $0x3,%rax
+  801c10:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801c14:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801c19:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801c1e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801c23:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c27:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c2b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c2f:	48 89 cf             	mov    %rcx,%rdi
+  801c32:	48 89 d6             	mov    %rdx,%rsi
+  801c35:	48 89 c1             	mov    %rax,%rcx
+  801c38:	fd                   	std
+  801c39:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c3c:	fc                   	cld
+  801c3d:	48 89 c8             	mov    %rcx,%rax
+  801c40:	48 89 f2             	mov    %rsi,%rdx
+  801c43:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c47:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c4b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801c4f:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801c54:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801c59:	eb 17                	jmp    801c72 <memmove+0xf6>
+      *--d = *--s;
+  801c5b:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801c60:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801c65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c69:	0f b6 10             	movzbl (%rax),%edx
+  801c6c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c70:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801c72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c76:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801c7a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801c7e:	48 85 c0             	test   %rax,%rax
+  801c81:	75 d8                	jne    801c5b <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801c83:	e9 f4 00 00 00       	jmp    801d7c <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c88:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c8d:	76 46                	jbe    801cd5 <memmove+0x159>
+  801c8f:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  801c96:	00 00 00 
+  801c99:	ff d0                	call   *%rax
+  801c9b:	83 e0 01             	and    $0x1,%eax
+  801c9e:	85 c0                	test   %eax,%eax
+  801ca0:	74 33                	je     801cd5 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801ca2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801ca6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801caa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cae:	48 89 cf             	mov    %rcx,%rdi
+  801cb1:	48 89 d6             	mov    %rdx,%rsi
+  801cb4:	48 89 c1             	mov    %rax,%rcx
+  801cb7:	fc                   	cld
+  801cb8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801cba:	48 89 c8             	mov    %rcx,%rax
+  801cbd:	48 89 f2             	mov    %rsi,%rdx
+  801cc0:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801cc4:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801cc8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801ccc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cd0:	e9 ab 00 00 00       	jmp    801d80 <memmove+0x204>
+    if (n >= 8) {
+  801cd5:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801cda:	0f 86 8b 00 00 00    	jbe    801d6b <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801ce0:	eb 22                	jmp    801d04 <memmove+0x188>
+        *d++ = *s++;
+  801ce2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ce6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801cea:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801cee:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cf2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801cf6:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801cfa:	0f b6 12             	movzbl (%rdx),%edx
+  801cfd:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801cff:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801d04:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d08:	83 e0 07             	and    $0x7,%eax
+  801d0b:	48 85 c0             	test   %rax,%rax
+  801d0e:	75 d2                	jne    801ce2 <memmove+0x166>
+      nq = n / 8;
+  801d10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d14:	48 c1 e8 03          	shr    $0x3,%rax
+  801d18:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801d1c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d20:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d24:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d28:	48 89 cf             	mov    %rcx,%rdi
+  801d2b:	48 89 d6             	mov    %rdx,%rsi
+  801d2e:	48 89 c1             	mov    %rax,%rcx
+  801d31:	fc                   	cld
+  801d32:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801d35:	48 89 c8             	mov    %rcx,%rax
+  801d38:	48 89 f2             	mov    %rsi,%rdx
+  801d3b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801d3f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d43:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801d47:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801d4c:	eb 1d                	jmp    801d6b <memmove+0x1ef>
+      *d++ = *s++;
+  801d4e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d52:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801d56:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d5a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d5e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d62:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801d66:	0f b6 12             	movzbl (%rdx),%edx
+  801d69:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801d6b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d6f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d73:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d77:	48 85 c0             	test   %rax,%rax
+  801d7a:	75 d2                	jne    801d4e <memmove+0x1d2>
+  return dst;
+  801d7c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+
+0000000000801d82 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801d82:	55                   	push   %rbp
+  801d83:	48 89 e5             	mov    %rsp,%rbp
+  801d86:	48 83 ec 18          	sub    $0x18,%rsp
+  801d8a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801d8e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801d92:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801d96:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d9a:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801da2:	48 89 ce             	mov    %rcx,%rsi
+  801da5:	48 89 c7             	mov    %rax,%rdi
+  801da8:	48 b8 7c 1b 80 00 00 	movabs $0x801b7c,%rax
+  801daf:	00 00 00 
+  801db2:	ff d0                	call   *%rax
+}
+  801db4:	c9                   	leave
+  801db5:	c3                   	ret
+
+0000000000801db6 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801db6:	55                   	push   %rbp
+  801db7:	48 89 e5             	mov    %rsp,%rbp
+  801dba:	48 83 ec 40          	sub    $0x40,%rsp
+  801dbe:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801dc2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801dc6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801dca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801dce:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801dd2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801dda:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801ddf:	0f 86 a7 00 00 00    	jbe    801e8c <memcmp+0xd6>
+  801de5:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  801dec:	00 00 00 
+  801def:	ff d0                	call   *%rax
+  801df1:	83 e0 02             	and    $0x2,%eax
+  801df4:	85 c0                	test   %eax,%eax
+  801df6:	0f 84 90 00 00 00    	je     801e8c <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801dfc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e00:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e04:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e08:	48 89 ce             	mov    %rcx,%rsi
+  801e0b:	48 89 c7             	mov    %rax,%rdi
+  801e0e:	48 b8 9d 13 80 00 00 	movabs $0x80139d,%rax
+  801e15:	00 00 00 
+  801e18:	ff d0                	call   *%rax
+  801e1a:	e9 c2 00 00 00       	jmp    801ee1 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801e1f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e23:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e27:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801e2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e2f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e33:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801e37:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801e3b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801e3e:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801e45:	74 36                	je     801e7d <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801e47:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e4a:	f7 d0                	not    %eax
+  801e4c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801e50:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801e53:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801e56:	48 63 d0             	movslq %eax,%rdx
+  801e59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e5d:	48 01 d0             	add    %rdx,%rax
+  801e60:	0f b6 00             	movzbl (%rax),%eax
+  801e63:	0f b6 c0             	movzbl %al,%eax
+  801e66:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801e69:	48 63 ca             	movslq %edx,%rcx
+  801e6c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e70:	48 01 ca             	add    %rcx,%rdx
+  801e73:	0f b6 12             	movzbl (%rdx),%edx
+  801e76:	0f b6 d2             	movzbl %dl,%edx
+  801e79:	29 d0                	sub    %edx,%eax
+  801e7b:	eb 64                	jmp    801ee1 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801e7d:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801e82:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801e87:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801e8c:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801e91:	77 8c                	ja     801e1f <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801e93:	eb 36                	jmp    801ecb <memcmp+0x115>
+    if (*s1 != *s2)
+  801e95:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e99:	0f b6 10             	movzbl (%rax),%edx
+  801e9c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ea0:	0f b6 00             	movzbl (%rax),%eax
+  801ea3:	38 c2                	cmp    %al,%dl
+  801ea5:	74 1a                	je     801ec1 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801ea7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801eab:	0f b6 00             	movzbl (%rax),%eax
+  801eae:	0f b6 c8             	movzbl %al,%ecx
+  801eb1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801eb5:	0f b6 00             	movzbl (%rax),%eax
+  801eb8:	0f b6 d0             	movzbl %al,%edx
+  801ebb:	89 c8                	mov    %ecx,%eax
+  801ebd:	29 d0                	sub    %edx,%eax
+  801ebf:	eb 20                	jmp    801ee1 <memcmp+0x12b>
+    s1++, s2++;
+  801ec1:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ec6:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801ecb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ecf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801ed3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801ed7:	48 85 c0             	test   %rax,%rax
+  801eda:	75 b9                	jne    801e95 <memcmp+0xdf>
+  }
+
+  return 0;
+  801edc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+
+0000000000801ee3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801ee3:	55                   	push   %rbp
+  801ee4:	48 89 e5             	mov    %rsp,%rbp
+  801ee7:	48 83 ec 50          	sub    $0x50,%rsp
+  801eeb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801eef:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801ef2:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801ef6:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801efa:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801efe:	48 01 d0             	add    %rdx,%rax
+  801f01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801f05:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f08:	66 0f 6e c0          	movd   %eax,%xmm0
+  801f0c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801f10:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801f14:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801f19:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801f1d:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801f22:	76 73                	jbe    801f97 <memfind+0xb4>
+  801f24:	48 b8 d5 11 80 00 00 	movabs $0x8011d5,%rax
+  801f2b:	00 00 00 
+  801f2e:	ff d0                	call   *%rax
+  801f30:	83 e0 02             	and    $0x2,%eax
+  801f33:	85 c0                	test   %eax,%eax
+  801f35:	74 60                	je     801f97 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801f37:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f3a:	0f b6 c8             	movzbl %al,%ecx
+  801f3d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801f41:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f45:	89 ce                	mov    %ecx,%esi
+  801f47:	48 89 c7             	mov    %rax,%rdi
+  801f4a:	48 b8 8c 14 80 00 00 	movabs $0x80148c,%rax
+  801f51:	00 00 00 
+  801f54:	ff d0                	call   *%rax
+  801f56:	eb 6c                	jmp    801fc4 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801f58:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f5c:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801f60:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801f64:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801f69:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801f6d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801f71:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801f74:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801f78:	74 13                	je     801f8d <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801f7a:	31 c0                	xor    %eax,%eax
+  801f7c:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801f81:	48 63 d0             	movslq %eax,%rdx
+  801f84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f88:	48 01 d0             	add    %rdx,%rax
+  801f8b:	eb 37                	jmp    801fc4 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801f8d:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801f92:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801f97:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801f9c:	77 ba                	ja     801f58 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801f9e:	eb 13                	jmp    801fb3 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801fa0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fa4:	0f b6 00             	movzbl (%rax),%eax
+  801fa7:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801faa:	38 d0                	cmp    %dl,%al
+  801fac:	74 11                	je     801fbf <memfind+0xdc>
+  for (; s < ends; s++)
+  801fae:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801fb3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fb7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801fbb:	72 e3                	jb     801fa0 <memfind+0xbd>
+  801fbd:	eb 01                	jmp    801fc0 <memfind+0xdd>
+      break;
+  801fbf:	90                   	nop
+  return (void *)s;
+  801fc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801fc4:	c9                   	leave
+  801fc5:	c3                   	ret
+
+0000000000801fc6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801fc6:	55                   	push   %rbp
+  801fc7:	48 89 e5             	mov    %rsp,%rbp
+  801fca:	48 83 ec 38          	sub    $0x38,%rsp
+  801fce:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801fd2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801fd6:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801fd9:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801fe0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801fe7:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801fe8:	eb 05                	jmp    801fef <strtol+0x29>
+    s++;
+  801fea:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801fef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ff3:	0f b6 00             	movzbl (%rax),%eax
+  801ff6:	3c 20                	cmp    $0x20,%al
+  801ff8:	74 f0                	je     801fea <strtol+0x24>
+  801ffa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ffe:	0f b6 00             	movzbl (%rax),%eax
+  802001:	3c 09                	cmp    $0x9,%al
+  802003:	74 e5                	je     801fea <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802005:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802009:	0f b6 00             	movzbl (%rax),%eax
+  80200c:	3c 2b                	cmp    $0x2b,%al
+  80200e:	75 07                	jne    802017 <strtol+0x51>
+    s++;
+  802010:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802015:	eb 17                	jmp    80202e <strtol+0x68>
+  else if (*s == '-')
+  802017:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80201b:	0f b6 00             	movzbl (%rax),%eax
+  80201e:	3c 2d                	cmp    $0x2d,%al
+  802020:	75 0c                	jne    80202e <strtol+0x68>
+    s++, neg = 1;
+  802022:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802027:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80202e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802032:	74 06                	je     80203a <strtol+0x74>
+  802034:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802038:	75 28                	jne    802062 <strtol+0x9c>
+  80203a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80203e:	0f b6 00             	movzbl (%rax),%eax
+  802041:	3c 30                	cmp    $0x30,%al
+  802043:	75 1d                	jne    802062 <strtol+0x9c>
+  802045:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802049:	48 83 c0 01          	add    $0x1,%rax
+  80204d:	0f b6 00             	movzbl (%rax),%eax
+  802050:	3c 78                	cmp    $0x78,%al
+  802052:	75 0e                	jne    802062 <strtol+0x9c>
+    s += 2, base = 16;
+  802054:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  802059:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802060:	eb 2c                	jmp    80208e <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  802062:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802066:	75 19                	jne    802081 <strtol+0xbb>
+  802068:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80206c:	0f b6 00             	movzbl (%rax),%eax
+  80206f:	3c 30                	cmp    $0x30,%al
+  802071:	75 0e                	jne    802081 <strtol+0xbb>
+    s++, base = 8;
+  802073:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802078:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  80207f:	eb 0d                	jmp    80208e <strtol+0xc8>
+  else if (base == 0)
+  802081:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802085:	75 07                	jne    80208e <strtol+0xc8>
+    base = 10;
+  802087:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  80208e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802092:	0f b6 00             	movzbl (%rax),%eax
+  802095:	3c 2f                	cmp    $0x2f,%al
+  802097:	7e 1d                	jle    8020b6 <strtol+0xf0>
+  802099:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80209d:	0f b6 00             	movzbl (%rax),%eax
+  8020a0:	3c 39                	cmp    $0x39,%al
+  8020a2:	7f 12                	jg     8020b6 <strtol+0xf0>
+      dig = *s - '0';
+  8020a4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020a8:	0f b6 00             	movzbl (%rax),%eax
+  8020ab:	0f be c0             	movsbl %al,%eax
+  8020ae:	83 e8 30             	sub    $0x30,%eax
+  8020b1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8020b4:	eb 4e                	jmp    802104 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  8020b6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ba:	0f b6 00             	movzbl (%rax),%eax
+  8020bd:	3c 60                	cmp    $0x60,%al
+  8020bf:	7e 1d                	jle    8020de <strtol+0x118>
+  8020c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020c5:	0f b6 00             	movzbl (%rax),%eax
+  8020c8:	3c 7a                	cmp    $0x7a,%al
+  8020ca:	7f 12                	jg     8020de <strtol+0x118>
+      dig = *s - 'a' + 10;
+  8020cc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020d0:	0f b6 00             	movzbl (%rax),%eax
+  8020d3:	0f be c0             	movsbl %al,%eax
+  8020d6:	83 e8 57             	sub    $0x57,%eax
+  8020d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8020dc:	eb 26                	jmp    802104 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  8020de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020e2:	0f b6 00             	movzbl (%rax),%eax
+  8020e5:	3c 40                	cmp    $0x40,%al
+  8020e7:	7e 47                	jle    802130 <strtol+0x16a>
+  8020e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ed:	0f b6 00             	movzbl (%rax),%eax
+  8020f0:	3c 5a                	cmp    $0x5a,%al
+  8020f2:	7f 3c                	jg     802130 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  8020f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020f8:	0f b6 00             	movzbl (%rax),%eax
+  8020fb:	0f be c0             	movsbl %al,%eax
+  8020fe:	83 e8 37             	sub    $0x37,%eax
+  802101:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802104:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802107:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80210a:	7d 23                	jge    80212f <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80210c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802111:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802114:	48 98                	cltq
+  802116:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80211b:	48 89 c2             	mov    %rax,%rdx
+  80211e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802121:	48 98                	cltq
+  802123:	48 01 d0             	add    %rdx,%rax
+  802126:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80212a:	e9 5f ff ff ff       	jmp    80208e <strtol+0xc8>
+      break;
+  80212f:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802130:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802135:	74 0b                	je     802142 <strtol+0x17c>
+    *endptr = (char *)s;
+  802137:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80213b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80213f:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802142:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802146:	74 09                	je     802151 <strtol+0x18b>
+  802148:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80214c:	48 f7 d8             	neg    %rax
+  80214f:	eb 04                	jmp    802155 <strtol+0x18f>
+  802151:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802155:	c9                   	leave
+  802156:	c3                   	ret
+
+0000000000802157 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802157:	55                   	push   %rbp
+  802158:	48 89 e5             	mov    %rsp,%rbp
+  80215b:	53                   	push   %rbx
+  80215c:	48 83 ec 48          	sub    $0x48,%rsp
+  802160:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802164:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802168:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80216c:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802170:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802174:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802178:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80217c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802180:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802184:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802188:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80218c:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802190:	4c 89 c3             	mov    %r8,%rbx
+  802193:	cd 30                	int    $0x30
+  802195:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  802199:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80219e:	74 46                	je     8021e6 <syscall+0x8f>
+  8021a0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8021a5:	7e 3f                	jle    8021e6 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  8021a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8021ab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021af:	49 89 d0             	mov    %rdx,%r8
+  8021b2:	48 89 c1             	mov    %rax,%rcx
+  8021b5:	48 b8 88 6c 80 00 00 	movabs $0x806c88,%rax
+  8021bc:	00 00 00 
+  8021bf:	48 89 c2             	mov    %rax,%rdx
+  8021c2:	be 22 00 00 00       	mov    $0x22,%esi
+  8021c7:	48 b8 a7 6c 80 00 00 	movabs $0x806ca7,%rax
+  8021ce:	00 00 00 
+  8021d1:	48 89 c7             	mov    %rax,%rdi
+  8021d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d9:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  8021e0:	00 00 00 
+  8021e3:	41 ff d1             	call   *%r9
+
+  return ret;
+  8021e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8021ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021ee:	c9                   	leave
+  8021ef:	c3                   	ret
+
+00000000008021f0 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8021f0:	55                   	push   %rbp
+  8021f1:	48 89 e5             	mov    %rsp,%rbp
+  8021f4:	48 83 ec 10          	sub    $0x10,%rsp
+  8021f8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8021fc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802200:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802204:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802208:	48 83 ec 08          	sub    $0x8,%rsp
+  80220c:	6a 00                	push   $0x0
+  80220e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802214:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80221a:	48 89 d1             	mov    %rdx,%rcx
+  80221d:	48 89 c2             	mov    %rax,%rdx
+  802220:	be 00 00 00 00       	mov    $0x0,%esi
+  802225:	bf 00 00 00 00       	mov    $0x0,%edi
+  80222a:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802231:	00 00 00 
+  802234:	ff d0                	call   *%rax
+  802236:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80223a:	90                   	nop
+  80223b:	c9                   	leave
+  80223c:	c3                   	ret
+
+000000000080223d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80223d:	55                   	push   %rbp
+  80223e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802241:	48 83 ec 08          	sub    $0x8,%rsp
+  802245:	6a 00                	push   $0x0
+  802247:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80224d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802253:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225d:	be 00 00 00 00       	mov    $0x0,%esi
+  802262:	bf 01 00 00 00       	mov    $0x1,%edi
+  802267:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  80226e:	00 00 00 
+  802271:	ff d0                	call   *%rax
+  802273:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802277:	c9                   	leave
+  802278:	c3                   	ret
+
+0000000000802279 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  802279:	55                   	push   %rbp
+  80227a:	48 89 e5             	mov    %rsp,%rbp
+  80227d:	48 83 ec 10          	sub    $0x10,%rsp
+  802281:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802284:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802287:	48 98                	cltq
+  802289:	48 83 ec 08          	sub    $0x8,%rsp
+  80228d:	6a 00                	push   $0x0
+  80228f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802295:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80229b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022a0:	48 89 c2             	mov    %rax,%rdx
+  8022a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8022a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022ad:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8022b4:	00 00 00 
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022bd:	c9                   	leave
+  8022be:	c3                   	ret
+
+00000000008022bf <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8022bf:	55                   	push   %rbp
+  8022c0:	48 89 e5             	mov    %rsp,%rbp
+  8022c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8022c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8022ca:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022cd:	48 98                	cltq
+  8022cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d3:	6a 00                	push   $0x0
+  8022d5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e6:	48 89 c2             	mov    %rax,%rdx
+  8022e9:	be 00 00 00 00       	mov    $0x0,%esi
+  8022ee:	bf 04 00 00 00       	mov    $0x4,%edi
+  8022f3:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8022fa:	00 00 00 
+  8022fd:	ff d0                	call   *%rax
+  8022ff:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802303:	90                   	nop
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+
+0000000000802306 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	48 83 ec 20          	sub    $0x20,%rsp
+  80230e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802311:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802315:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802318:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80231b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802320:	cd 30                	int    $0x30
+  802322:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802326:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80232a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80232f:	7e 3d                	jle    80236e <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802331:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802335:	49 89 c0             	mov    %rax,%r8
+  802338:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80233d:	48 b8 88 6c 80 00 00 	movabs $0x806c88,%rax
+  802344:	00 00 00 
+  802347:	48 89 c2             	mov    %rax,%rdx
+  80234a:	be 49 00 00 00       	mov    $0x49,%esi
+  80234f:	48 b8 a7 6c 80 00 00 	movabs $0x806ca7,%rax
+  802356:	00 00 00 
+  802359:	48 89 c7             	mov    %rax,%rdi
+  80235c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802361:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  802368:	00 00 00 
+  80236b:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80236e:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802373:	75 13                	jne    802388 <sys_env_wait+0x82>
+  802375:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80237a:	74 0c                	je     802388 <sys_env_wait+0x82>
+    *status = st;
+  80237c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802380:	89 c2                	mov    %eax,%edx
+  802382:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802386:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802388:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80238c:	c9                   	leave
+  80238d:	c3                   	ret
+
+000000000080238e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80238e:	55                   	push   %rbp
+  80238f:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802392:	48 83 ec 08          	sub    $0x8,%rsp
+  802396:	6a 00                	push   $0x0
+  802398:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80239e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8023b3:	bf 02 00 00 00       	mov    $0x2,%edi
+  8023b8:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8023bf:	00 00 00 
+  8023c2:	ff d0                	call   *%rax
+  8023c4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023c8:	c9                   	leave
+  8023c9:	c3                   	ret
+
+00000000008023ca <sys_yield>:
+
+void
+sys_yield(void) {
+  8023ca:	55                   	push   %rbp
+  8023cb:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8023ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8023d2:	6a 00                	push   $0x0
+  8023d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8023ef:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8023f4:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8023fb:	00 00 00 
+  8023fe:	ff d0                	call   *%rax
+  802400:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802404:	90                   	nop
+  802405:	c9                   	leave
+  802406:	c3                   	ret
+
+0000000000802407 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802407:	55                   	push   %rbp
+  802408:	48 89 e5             	mov    %rsp,%rbp
+  80240b:	48 83 ec 20          	sub    $0x20,%rsp
+  80240f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802412:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802416:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802419:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80241c:	48 63 c8             	movslq %eax,%rcx
+  80241f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802423:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802426:	48 98                	cltq
+  802428:	48 83 ec 08          	sub    $0x8,%rsp
+  80242c:	6a 00                	push   $0x0
+  80242e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802434:	49 89 c8             	mov    %rcx,%r8
+  802437:	48 89 d1             	mov    %rdx,%rcx
+  80243a:	48 89 c2             	mov    %rax,%rdx
+  80243d:	be 01 00 00 00       	mov    $0x1,%esi
+  802442:	bf 06 00 00 00       	mov    $0x6,%edi
+  802447:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  80244e:	00 00 00 
+  802451:	ff d0                	call   *%rax
+  802453:	48 83 c4 10          	add    $0x10,%rsp
+  802457:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80245a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80245d:	c9                   	leave
+  80245e:	c3                   	ret
+
+000000000080245f <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  80245f:	55                   	push   %rbp
+  802460:	48 89 e5             	mov    %rsp,%rbp
+  802463:	48 83 ec 20          	sub    $0x20,%rsp
+  802467:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80246a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80246e:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802471:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802475:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  802479:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80247c:	48 63 c8             	movslq %eax,%rcx
+  80247f:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802483:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802486:	48 63 f0             	movslq %eax,%rsi
+  802489:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80248d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802490:	48 98                	cltq
+  802492:	48 83 ec 08          	sub    $0x8,%rsp
+  802496:	51                   	push   %rcx
+  802497:	49 89 f9             	mov    %rdi,%r9
+  80249a:	49 89 f0             	mov    %rsi,%r8
+  80249d:	48 89 d1             	mov    %rdx,%rcx
+  8024a0:	48 89 c2             	mov    %rax,%rdx
+  8024a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8024a8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8024ad:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8024b4:	00 00 00 
+  8024b7:	ff d0                	call   *%rax
+  8024b9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024bd:	c9                   	leave
+  8024be:	c3                   	ret
+
+00000000008024bf <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8024bf:	55                   	push   %rbp
+  8024c0:	48 89 e5             	mov    %rsp,%rbp
+  8024c3:	48 83 ec 10          	sub    $0x10,%rsp
+  8024c7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ca:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8024ce:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024d2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024d5:	48 98                	cltq
+  8024d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8024db:	6a 00                	push   $0x0
+  8024dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024e9:	48 89 d1             	mov    %rdx,%rcx
+  8024ec:	48 89 c2             	mov    %rax,%rdx
+  8024ef:	be 01 00 00 00       	mov    $0x1,%esi
+  8024f4:	bf 08 00 00 00       	mov    $0x8,%edi
+  8024f9:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802500:	00 00 00 
+  802503:	ff d0                	call   *%rax
+  802505:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802509:	c9                   	leave
+  80250a:	c3                   	ret
+
+000000000080250b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80250b:	55                   	push   %rbp
+  80250c:	48 89 e5             	mov    %rsp,%rbp
+  80250f:	48 83 ec 10          	sub    $0x10,%rsp
+  802513:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802516:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802519:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80251c:	48 63 d0             	movslq %eax,%rdx
+  80251f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802522:	48 98                	cltq
+  802524:	48 83 ec 08          	sub    $0x8,%rsp
+  802528:	6a 00                	push   $0x0
+  80252a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802530:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802536:	48 89 d1             	mov    %rdx,%rcx
+  802539:	48 89 c2             	mov    %rax,%rdx
+  80253c:	be 01 00 00 00       	mov    $0x1,%esi
+  802541:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802546:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  80254d:	00 00 00 
+  802550:	ff d0                	call   *%rax
+  802552:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802556:	c9                   	leave
+  802557:	c3                   	ret
+
+0000000000802558 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802558:	55                   	push   %rbp
+  802559:	48 89 e5             	mov    %rsp,%rbp
+  80255c:	48 83 ec 10          	sub    $0x10,%rsp
+  802560:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802563:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802567:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80256b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80256e:	48 98                	cltq
+  802570:	48 83 ec 08          	sub    $0x8,%rsp
+  802574:	6a 00                	push   $0x0
+  802576:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80257c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802582:	48 89 d1             	mov    %rdx,%rcx
+  802585:	48 89 c2             	mov    %rax,%rdx
+  802588:	be 01 00 00 00       	mov    $0x1,%esi
+  80258d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802592:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802599:	00 00 00 
+  80259c:	ff d0                	call   *%rax
+  80259e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a2:	c9                   	leave
+  8025a3:	c3                   	ret
+
+00000000008025a4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8025a4:	55                   	push   %rbp
+  8025a5:	48 89 e5             	mov    %rsp,%rbp
+  8025a8:	48 83 ec 10          	sub    $0x10,%rsp
+  8025ac:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025af:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  8025b3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025b7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025ba:	48 98                	cltq
+  8025bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c0:	6a 00                	push   $0x0
+  8025c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025ce:	48 89 d1             	mov    %rdx,%rcx
+  8025d1:	48 89 c2             	mov    %rax,%rdx
+  8025d4:	be 01 00 00 00       	mov    $0x1,%esi
+  8025d9:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8025de:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+  8025ea:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025ee:	c9                   	leave
+  8025ef:	c3                   	ret
+
+00000000008025f0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8025f0:	55                   	push   %rbp
+  8025f1:	48 89 e5             	mov    %rsp,%rbp
+  8025f4:	48 83 ec 20          	sub    $0x20,%rsp
+  8025f8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025fb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8025ff:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802603:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802606:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802609:	48 63 f0             	movslq %eax,%rsi
+  80260c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802610:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802614:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802617:	48 98                	cltq
+  802619:	48 83 ec 08          	sub    $0x8,%rsp
+  80261d:	6a 00                	push   $0x0
+  80261f:	49 89 f1             	mov    %rsi,%r9
+  802622:	49 89 c8             	mov    %rcx,%r8
+  802625:	48 89 d1             	mov    %rdx,%rcx
+  802628:	48 89 c2             	mov    %rax,%rdx
+  80262b:	be 00 00 00 00       	mov    $0x0,%esi
+  802630:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802635:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  80263c:	00 00 00 
+  80263f:	ff d0                	call   *%rax
+  802641:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802645:	c9                   	leave
+  802646:	c3                   	ret
+
+0000000000802647 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802647:	55                   	push   %rbp
+  802648:	48 89 e5             	mov    %rsp,%rbp
+  80264b:	48 83 ec 10          	sub    $0x10,%rsp
+  80264f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802653:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802657:	48 83 ec 08          	sub    $0x8,%rsp
+  80265b:	6a 00                	push   $0x0
+  80265d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802669:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80266e:	48 89 c2             	mov    %rax,%rdx
+  802671:	be 01 00 00 00       	mov    $0x1,%esi
+  802676:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80267b:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802682:	00 00 00 
+  802685:	ff d0                	call   *%rax
+  802687:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80268b:	c9                   	leave
+  80268c:	c3                   	ret
+
+000000000080268d <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80268d:	55                   	push   %rbp
+  80268e:	48 89 e5             	mov    %rsp,%rbp
+  802691:	48 83 ec 10          	sub    $0x10,%rsp
+  802695:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802699:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80269d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026a1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8026a9:	6a 00                	push   $0x0
+  8026ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b7:	48 89 d1             	mov    %rdx,%rcx
+  8026ba:	48 89 c2             	mov    %rax,%rdx
+  8026bd:	be 01 00 00 00       	mov    $0x1,%esi
+  8026c2:	bf 10 00 00 00       	mov    $0x10,%edi
+  8026c7:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8026ce:	00 00 00 
+  8026d1:	ff d0                	call   *%rax
+  8026d3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026d7:	c9                   	leave
+  8026d8:	c3                   	ret
+
+00000000008026d9 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8026d9:	55                   	push   %rbp
+  8026da:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8026dd:	48 83 ec 08          	sub    $0x8,%rsp
+  8026e1:	6a 00                	push   $0x0
+  8026e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8026fe:	bf 11 00 00 00       	mov    $0x11,%edi
+  802703:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  80270a:	00 00 00 
+  80270d:	ff d0                	call   *%rax
+  80270f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802713:	c9                   	leave
+  802714:	c3                   	ret
+
+0000000000802715 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802715:	55                   	push   %rbp
+  802716:	48 89 e5             	mov    %rsp,%rbp
+  802719:	48 83 ec 10          	sub    $0x10,%rsp
+  80271d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802721:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802725:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802729:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80272d:	48 83 ec 08          	sub    $0x8,%rsp
+  802731:	6a 00                	push   $0x0
+  802733:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802739:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80273f:	48 89 d1             	mov    %rdx,%rcx
+  802742:	48 89 c2             	mov    %rax,%rdx
+  802745:	be 00 00 00 00       	mov    $0x0,%esi
+  80274a:	bf 12 00 00 00       	mov    $0x12,%edi
+  80274f:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802756:	00 00 00 
+  802759:	ff d0                	call   *%rax
+  80275b:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80275f:	c9                   	leave
+  802760:	c3                   	ret
+
+0000000000802761 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802761:	55                   	push   %rbp
+  802762:	48 89 e5             	mov    %rsp,%rbp
+  802765:	48 83 ec 20          	sub    $0x20,%rsp
+  802769:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80276d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802771:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802774:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802777:	48 63 c8             	movslq %eax,%rcx
+  80277a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80277e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802782:	48 83 ec 08          	sub    $0x8,%rsp
+  802786:	6a 00                	push   $0x0
+  802788:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80278e:	49 89 c8             	mov    %rcx,%r8
+  802791:	48 89 d1             	mov    %rdx,%rcx
+  802794:	48 89 c2             	mov    %rax,%rdx
+  802797:	be 00 00 00 00       	mov    $0x0,%esi
+  80279c:	bf 13 00 00 00       	mov    $0x13,%edi
+  8027a1:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8027a8:	00 00 00 
+  8027ab:	ff d0                	call   *%rax
+  8027ad:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027b1:	c9                   	leave
+  8027b2:	c3                   	ret
+
+00000000008027b3 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  8027b3:	55                   	push   %rbp
+  8027b4:	48 89 e5             	mov    %rsp,%rbp
+  8027b7:	48 83 ec 20          	sub    $0x20,%rsp
+  8027bb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027bf:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8027c2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8027c6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027ca:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8027cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d5:	6a 00                	push   $0x0
+  8027d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027dd:	49 89 c8             	mov    %rcx,%r8
+  8027e0:	48 89 d1             	mov    %rdx,%rcx
+  8027e3:	48 89 c2             	mov    %rax,%rdx
+  8027e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027eb:	bf 14 00 00 00       	mov    $0x14,%edi
+  8027f0:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8027f7:	00 00 00 
+  8027fa:	ff d0                	call   *%rax
+  8027fc:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802800:	c9                   	leave
+  802801:	c3                   	ret
+
+0000000000802802 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+  802806:	48 83 ec 10          	sub    $0x10,%rsp
+  80280a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80280e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802811:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802814:	48 63 d0             	movslq %eax,%rdx
+  802817:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80281b:	48 83 ec 08          	sub    $0x8,%rsp
+  80281f:	6a 00                	push   $0x0
+  802821:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802827:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80282d:	48 89 d1             	mov    %rdx,%rcx
+  802830:	48 89 c2             	mov    %rax,%rdx
+  802833:	be 00 00 00 00       	mov    $0x0,%esi
+  802838:	bf 15 00 00 00       	mov    $0x15,%edi
+  80283d:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802844:	00 00 00 
+  802847:	ff d0                	call   *%rax
+  802849:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80284d:	c9                   	leave
+  80284e:	c3                   	ret
+
+000000000080284f <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  80284f:	55                   	push   %rbp
+  802850:	48 89 e5             	mov    %rsp,%rbp
+  802853:	48 83 ec 20          	sub    $0x20,%rsp
+  802857:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80285b:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80285e:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802861:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802865:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802869:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80286c:	48 63 c8             	movslq %eax,%rcx
+  80286f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802872:	48 63 d0             	movslq %eax,%rdx
+  802875:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802879:	48 83 ec 08          	sub    $0x8,%rsp
+  80287d:	6a 00                	push   $0x0
+  80287f:	49 89 f1             	mov    %rsi,%r9
+  802882:	49 89 c8             	mov    %rcx,%r8
+  802885:	48 89 d1             	mov    %rdx,%rcx
+  802888:	48 89 c2             	mov    %rax,%rdx
+  80288b:	be 00 00 00 00       	mov    $0x0,%esi
+  802890:	bf 16 00 00 00       	mov    $0x16,%edi
+  802895:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  80289c:	00 00 00 
+  80289f:	ff d0                	call   *%rax
+  8028a1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028a5:	c9                   	leave
+  8028a6:	c3                   	ret
+
+00000000008028a7 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8028a7:	55                   	push   %rbp
+  8028a8:	48 89 e5             	mov    %rsp,%rbp
+  8028ab:	48 83 ec 30          	sub    $0x30,%rsp
+  8028af:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028b3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8028b7:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8028bb:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  8028bf:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  8028c3:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8028c7:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  8028cb:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8028cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8028d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8028db:	51                   	push   %rcx
+  8028dc:	49 89 f9             	mov    %rdi,%r9
+  8028df:	49 89 f0             	mov    %rsi,%r8
+  8028e2:	48 89 d1             	mov    %rdx,%rcx
+  8028e5:	48 89 c2             	mov    %rax,%rdx
+  8028e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ed:	bf 17 00 00 00       	mov    $0x17,%edi
+  8028f2:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8028f9:	00 00 00 
+  8028fc:	ff d0                	call   *%rax
+  8028fe:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802902:	c9                   	leave
+  802903:	c3                   	ret
+
+0000000000802904 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802904:	55                   	push   %rbp
+  802905:	48 89 e5             	mov    %rsp,%rbp
+  802908:	48 83 ec 10          	sub    $0x10,%rsp
+  80290c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  80290f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802912:	48 98                	cltq
+  802914:	48 83 ec 08          	sub    $0x8,%rsp
+  802918:	6a 00                	push   $0x0
+  80291a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802920:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802926:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80292b:	48 89 c2             	mov    %rax,%rdx
+  80292e:	be 00 00 00 00       	mov    $0x0,%esi
+  802933:	bf 18 00 00 00       	mov    $0x18,%edi
+  802938:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  80293f:	00 00 00 
+  802942:	ff d0                	call   *%rax
+  802944:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802948:	90                   	nop
+  802949:	c9                   	leave
+  80294a:	c3                   	ret
+
+000000000080294b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  80294b:	55                   	push   %rbp
+  80294c:	48 89 e5             	mov    %rsp,%rbp
+  80294f:	48 83 ec 30          	sub    $0x30,%rsp
+  802953:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802956:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80295a:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80295e:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802961:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802964:	48 63 f0             	movslq %eax,%rsi
+  802967:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  80296b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80296f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802972:	48 98                	cltq
+  802974:	48 83 ec 08          	sub    $0x8,%rsp
+  802978:	6a 00                	push   $0x0
+  80297a:	49 89 f1             	mov    %rsi,%r9
+  80297d:	49 89 c8             	mov    %rcx,%r8
+  802980:	48 89 d1             	mov    %rdx,%rcx
+  802983:	48 89 c2             	mov    %rax,%rdx
+  802986:	be 01 00 00 00       	mov    $0x1,%esi
+  80298b:	bf 19 00 00 00       	mov    $0x19,%edi
+  802990:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802997:	00 00 00 
+  80299a:	ff d0                	call   *%rax
+  80299c:	48 83 c4 10          	add    $0x10,%rsp
+  8029a0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8029a3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+
+00000000008029a8 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8029a8:	55                   	push   %rbp
+  8029a9:	48 89 e5             	mov    %rsp,%rbp
+  8029ac:	48 83 ec 20          	sub    $0x20,%rsp
+  8029b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029b4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8029b8:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  8029bb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029be:	48 63 c8             	movslq %eax,%rcx
+  8029c1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8029c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8029cd:	6a 00                	push   $0x0
+  8029cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029d5:	49 89 c8             	mov    %rcx,%r8
+  8029d8:	48 89 d1             	mov    %rdx,%rcx
+  8029db:	48 89 c2             	mov    %rax,%rdx
+  8029de:	be 01 00 00 00       	mov    $0x1,%esi
+  8029e3:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  8029e8:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  8029ef:	00 00 00 
+  8029f2:	ff d0                	call   *%rax
+  8029f4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029f8:	c9                   	leave
+  8029f9:	c3                   	ret
+
+00000000008029fa <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  8029fa:	55                   	push   %rbp
+  8029fb:	48 89 e5             	mov    %rsp,%rbp
+  8029fe:	48 83 ec 20          	sub    $0x20,%rsp
+  802a02:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a06:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a0a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802a0e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802a12:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a1a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a1e:	6a 00                	push   $0x0
+  802a20:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a26:	49 89 c8             	mov    %rcx,%r8
+  802a29:	48 89 d1             	mov    %rdx,%rcx
+  802a2c:	48 89 c2             	mov    %rax,%rdx
+  802a2f:	be 01 00 00 00       	mov    $0x1,%esi
+  802a34:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802a39:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802a40:	00 00 00 
+  802a43:	ff d0                	call   *%rax
+  802a45:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a49:	c9                   	leave
+  802a4a:	c3                   	ret
+
+0000000000802a4b <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802a4b:	55                   	push   %rbp
+  802a4c:	48 89 e5             	mov    %rsp,%rbp
+  802a4f:	48 83 ec 30          	sub    $0x30,%rsp
+  802a53:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802a57:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802a5b:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802a5e:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802a62:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802a66:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802a69:	48 63 c8             	movslq %eax,%rcx
+  802a6c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802a70:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a74:	48 83 ec 08          	sub    $0x8,%rsp
+  802a78:	6a 00                	push   $0x0
+  802a7a:	49 89 f1             	mov    %rsi,%r9
+  802a7d:	49 89 c8             	mov    %rcx,%r8
+  802a80:	48 89 d1             	mov    %rdx,%rcx
+  802a83:	48 89 c2             	mov    %rax,%rdx
+  802a86:	be 01 00 00 00       	mov    $0x1,%esi
+  802a8b:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802a90:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802a97:	00 00 00 
+  802a9a:	ff d0                	call   *%rax
+  802a9c:	48 83 c4 10          	add    $0x10,%rsp
+  802aa0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802aa3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802aa6:	c9                   	leave
+  802aa7:	c3                   	ret
+
+0000000000802aa8 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802aa8:	55                   	push   %rbp
+  802aa9:	48 89 e5             	mov    %rsp,%rbp
+  802aac:	48 83 ec 10          	sub    $0x10,%rsp
+  802ab0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802ab3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ab6:	48 98                	cltq
+  802ab8:	48 83 ec 08          	sub    $0x8,%rsp
+  802abc:	6a 00                	push   $0x0
+  802abe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ac4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802aca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802acf:	48 89 c2             	mov    %rax,%rdx
+  802ad2:	be 01 00 00 00       	mov    $0x1,%esi
+  802ad7:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802adc:	48 b8 57 21 80 00 00 	movabs $0x802157,%rax
+  802ae3:	00 00 00 
+  802ae6:	ff d0                	call   *%rax
+  802ae8:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802aec:	c9                   	leave
+  802aed:	c3                   	ret
+
+0000000000802aee <pgfault>:
+//
+#ifdef SANITIZE_USER_SHADOW_BASE
+void *__nosan_memcpy(void *dst, const void *src, size_t sz);
+#endif
+static void
+pgfault(struct UTrapframe *utf) {
+  802aee:	55                   	push   %rbp
+  802aef:	48 89 e5             	mov    %rsp,%rbp
+  802af2:	48 83 ec 40          	sub    $0x40,%rsp
+  802af6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // LAB 9: Your code here.
+  void *addr = (void *) utf->utf_fault_va;
+  802afa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802afe:	48 8b 00             	mov    (%rax),%rax
+  802b01:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  uint64_t err = utf->utf_err;
+  802b05:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b09:	48 8b 40 08          	mov    0x8(%rax),%rax
+  802b0d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  void *tmp;
+  int r;
+
+  // Another thread sharing our address space may have resolved this
+  // fault already; just retry the access.
+  if ((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_W))
+  802b11:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b15:	83 e0 02             	and    $0x2,%eax
+  802b18:	48 85 c0             	test   %rax,%rax
+  802b1b:	74 25                	je     802b42 <pgfault+0x54>
+  802b1d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b21:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b25:	48 89 c2             	mov    %rax,%rdx
+  802b28:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b2f:	01 00 00 
+  802b32:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b36:	83 e0 02             	and    $0x2,%eax
+  802b39:	48 85 c0             	test   %rax,%rax
+  802b3c:	0f 85 fe 01 00 00    	jne    802d40 <pgfault+0x252>
+    return;
+  if (!((err & FEC_WR) && (uvpt[PGNUM(addr)] & PTE_COW))) {
+  802b42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b46:	83 e0 02             	and    $0x2,%eax
+  802b49:	48 85 c0             	test   %rax,%rax
+  802b4c:	74 23                	je     802b71 <pgfault+0x83>
+  802b4e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b52:	48 c1 e8 0c          	shr    $0xc,%rax
+  802b56:	48 89 c2             	mov    %rax,%rdx
+  802b59:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802b60:	01 00 00 
+  802b63:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802b67:	25 00 08 00 00       	and    $0x800,%eax
+  802b6c:	48 85 c0             	test   %rax,%rax
+  802b6f:	75 3f                	jne    802bb0 <pgfault+0xc2>
+    panic("Not a WR or not a COW page! va: %lx err: %lx\n", (uint64_t)addr, err);
+  802b71:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b75:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802b79:	49 89 d0             	mov    %rdx,%r8
+  802b7c:	48 89 c1             	mov    %rax,%rcx
+  802b7f:	48 b8 b8 6c 80 00 00 	movabs $0x806cb8,%rax
+  802b86:	00 00 00 
+  802b89:	48 89 c2             	mov    %rax,%rdx
+  802b8c:	be 26 00 00 00       	mov    $0x26,%esi
+  802b91:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  802b98:	00 00 00 
+  802b9b:	48 89 c7             	mov    %rax,%rdi
+  802b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba3:	49 b9 6a 04 80 00 00 	movabs $0x80046a,%r9
+  802baa:	00 00 00 
+  802bad:	41 ff d1             	call   *%r9
+  //   No need to explicitly delete the old page's mapping.
+  //   Make sure you DO NOT use sanitized memcpy/memset routines when using UASAN.
+
+  // LAB 9: Your code here.
+  // Threads share PFTEMP's page table, so each uses its own page.
+  tmp = thread_pftemp();
+  802bb0:	48 b8 e1 5c 80 00 00 	movabs $0x805ce1,%rax
+  802bb7:	00 00 00 
+  802bba:	ff d0                	call   *%rax
+  802bbc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if ((r = sys_page_alloc(0, tmp, PTE_P | PTE_U | PTE_W)) < 0) {
+  802bc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bc4:	ba 07 00 00 00       	mov    $0x7,%edx
+  802bc9:	48 89 c6             	mov    %rax,%rsi
+  802bcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bd1:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  802bd8:	00 00 00 
+  802bdb:	ff d0                	call   *%rax
+  802bdd:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802be0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802be4:	79 36                	jns    802c1c <pgfault+0x12e>
+    panic("pgfault error: sys_page_alloc: %i\n", r);
+  802be6:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802be9:	89 c1                	mov    %eax,%ecx
+  802beb:	48 b8 f8 6c 80 00 00 	movabs $0x806cf8,%rax
+  802bf2:	00 00 00 
+  802bf5:	48 89 c2             	mov    %rax,%rdx
+  802bf8:	be 35 00 00 00       	mov    $0x35,%esi
+  802bfd:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  802c04:	00 00 00 
+  802c07:	48 89 c7             	mov    %rax,%rdi
+  802c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0f:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  802c16:	00 00 00 
+  802c19:	41 ff d0             	call   *%r8
+  }
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+  __nosan_memcpy(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+#else
+  memmove(tmp, ROUNDDOWN(addr, PGSIZE), PGSIZE);
+  802c1c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c20:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  802c24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802c28:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c2e:	48 89 c1             	mov    %rax,%rcx
+  802c31:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c35:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c3a:	48 89 ce             	mov    %rcx,%rsi
+  802c3d:	48 89 c7             	mov    %rax,%rdi
+  802c40:	48 b8 7c 1b 80 00 00 	movabs $0x801b7c,%rax
+  802c47:	00 00 00 
+  802c4a:	ff d0                	call   *%rax
+#endif
+
+  // Another thread may have taken the same fault and installed its
+  // copy while we were copying; keep that one.
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802c4c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c50:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c54:	48 89 c2             	mov    %rax,%rdx
+  802c57:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c5e:	01 00 00 
+  802c61:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c65:	25 00 08 00 00       	and    $0x800,%eax
+  802c6a:	48 85 c0             	test   %rax,%rax
+  802c6d:	74 7a                	je     802ce9 <pgfault+0x1fb>
+      (r = sys_page_map(0, tmp, 0, ROUNDDOWN(addr, PGSIZE), PTE_P | PTE_U | PTE_W)) < 0) {
+  802c6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802c73:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  802c77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c7b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c81:	48 89 c2             	mov    %rax,%rdx
+  802c84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c88:	41 b8 07 00 00 00    	mov    $0x7,%r8d
+  802c8e:	48 89 d1             	mov    %rdx,%rcx
+  802c91:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c96:	48 89 c6             	mov    %rax,%rsi
+  802c99:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9e:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802ca5:	00 00 00 
+  802ca8:	ff d0                	call   *%rax
+  802caa:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  if ((uvpt[PGNUM(addr)] & PTE_COW) &&
+  802cad:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802cb1:	79 36                	jns    802ce9 <pgfault+0x1fb>
+    panic("pgfault error: sys_page_map: %i\n", r);
+  802cb3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802cb6:	89 c1                	mov    %eax,%ecx
+  802cb8:	48 b8 20 6d 80 00 00 	movabs $0x806d20,%rax
+  802cbf:	00 00 00 
+  802cc2:	48 89 c2             	mov    %rax,%rdx
+  802cc5:	be 42 00 00 00       	mov    $0x42,%esi
+  802cca:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  802cd1:	00 00 00 
+  802cd4:	48 89 c7             	mov    %rax,%rdi
+  802cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cdc:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  802ce3:	00 00 00 
+  802ce6:	41 ff d0             	call   *%r8
+  }
+
+  if ((r = sys_page_unmap(0, tmp)) < 0) {
+  802ce9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ced:	48 89 c6             	mov    %rax,%rsi
+  802cf0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf5:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  802cfc:	00 00 00 
+  802cff:	ff d0                	call   *%rax
+  802d01:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  802d04:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  802d08:	79 37                	jns    802d41 <pgfault+0x253>
+    panic("pgfault error: sys_page_unmap: %i\n", r);
+  802d0a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  802d0d:	89 c1                	mov    %eax,%ecx
+  802d0f:	48 b8 48 6d 80 00 00 	movabs $0x806d48,%rax
+  802d16:	00 00 00 
+  802d19:	48 89 c2             	mov    %rax,%rdx
+  802d1c:	be 46 00 00 00       	mov    $0x46,%esi
+  802d21:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  802d28:	00 00 00 
+  802d2b:	48 89 c7             	mov    %rax,%rdi
+  802d2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d33:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  802d3a:	00 00 00 
+  802d3d:	41 ff d0             	call   *%r8
+    return;
+  802d40:	90                   	nop
+  }
+}
+  802d41:	c9                   	leave
+  802d42:	c3                   	ret
+
+0000000000802d43 <duppage>:
+//
+// Returns: 0 on success, < 0 on error.
+// It is also OK to panic on error.
+//
+static int
+duppage(envid_t envid, uintptr_t pn) {
+  802d43:	55                   	push   %rbp
+  802d44:	48 89 e5             	mov    %rsp,%rbp
+  802d47:	48 83 ec 30          	sub    $0x30,%rsp
+  802d4b:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802d4e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  // LAB 9: Your code here.
+  pte_t ent = uvpt[pn] & PTE_SYSCALL;
+  802d52:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d59:	01 00 00 
+  802d5c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d60:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d64:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d69:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r;
+  envid_t id = sys_getenvid();
+  802d6d:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  802d74:	00 00 00 
+  802d77:	ff d0                	call   *%rax
+  802d79:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  void *address = (void *)(pn * PGSIZE);
+  802d7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d80:	48 c1 e0 0c          	shl    $0xc,%rax
+  802d84:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+  if (uvpt[pn] & PTE_SHARE) {
+  802d88:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802d8f:	01 00 00 
+  802d92:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d96:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802d9a:	25 00 04 00 00       	and    $0x400,%eax
+  802d9f:	48 85 c0             	test   %rax,%rax
+  802da2:	74 7b                	je     802e1f <duppage+0xdc>
+    if ((r = sys_page_map(0, (void *)(pn * PGSIZE), envid, (void *)(pn * PGSIZE), ent)) < 0) {
+  802da4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802da8:	89 c1                	mov    %eax,%ecx
+  802daa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802dae:	48 c1 e0 0c          	shl    $0xc,%rax
+  802db2:	48 89 c2             	mov    %rax,%rdx
+  802db5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802db9:	48 c1 e0 0c          	shl    $0xc,%rax
+  802dbd:	48 89 c6             	mov    %rax,%rsi
+  802dc0:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802dc3:	41 89 c8             	mov    %ecx,%r8d
+  802dc6:	48 89 d1             	mov    %rdx,%rcx
+  802dc9:	89 c2                	mov    %eax,%edx
+  802dcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd0:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+  802ddc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802ddf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802de3:	0f 89 da 00 00 00    	jns    802ec3 <duppage+0x180>
+      panic("duppage error: sys_page_map PTE_SHARE: %i\n", r);
+  802de9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802dec:	89 c1                	mov    %eax,%ecx
+  802dee:	48 b8 70 6d 80 00 00 	movabs $0x806d70,%rax
+  802df5:	00 00 00 
+  802df8:	48 89 c2             	mov    %rax,%rdx
+  802dfb:	be 5f 00 00 00       	mov    $0x5f,%esi
+  802e00:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  802e07:	00 00 00 
+  802e0a:	48 89 c7             	mov    %rax,%rdi
+  802e0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e12:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  802e19:	00 00 00 
+  802e1c:	41 ff d0             	call   *%r8
+    }
+
+  } else if (ent & (PTE_W | PTE_COW)) {
+  802e1f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e23:	25 02 08 00 00       	and    $0x802,%eax
+  802e28:	48 85 c0             	test   %rax,%rax
+  802e2b:	74 6e                	je     802e9b <duppage+0x158>
+    ent = (ent | PTE_COW) & ~PTE_W;
+  802e2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e31:	48 25 fd f7 ff ff    	and    $0xfffffffffffff7fd,%rax
+  802e37:	80 cc 08             	or     $0x8,%ah
+  802e3a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    r = sys_page_map(id, address, envid, address, ent);
+  802e3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e42:	89 c7                	mov    %eax,%edi
+  802e44:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e48:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e4b:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e4f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e52:	41 89 f8             	mov    %edi,%r8d
+  802e55:	89 c7                	mov    %eax,%edi
+  802e57:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802e5e:	00 00 00 
+  802e61:	ff d0                	call   *%rax
+  802e63:	89 45 fc             	mov    %eax,-0x4(%rbp)
+
+    if (r < 0) {
+  802e66:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e6a:	79 05                	jns    802e71 <duppage+0x12e>
+      return r;
+  802e6c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e6f:	eb 55                	jmp    802ec6 <duppage+0x183>
+    }
+    r = sys_page_map(id, address, id, address, ent);
+  802e71:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e75:	89 c7                	mov    %eax,%edi
+  802e77:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802e7b:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802e7e:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802e82:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e85:	41 89 f8             	mov    %edi,%r8d
+  802e88:	89 c7                	mov    %eax,%edi
+  802e8a:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802e91:	00 00 00 
+  802e94:	ff d0                	call   *%rax
+  802e96:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e99:	eb 28                	jmp    802ec3 <duppage+0x180>
+  } else {
+    r = sys_page_map(id, address, envid, address, ent);
+  802e9b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802e9f:	89 c7                	mov    %eax,%edi
+  802ea1:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802ea5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802ea8:	48 8b 75 e0          	mov    -0x20(%rbp),%rsi
+  802eac:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802eaf:	41 89 f8             	mov    %edi,%r8d
+  802eb2:	89 c7                	mov    %eax,%edi
+  802eb4:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802ebb:	00 00 00 
+  802ebe:	ff d0                	call   *%rax
+  802ec0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+
+  return r;
+  802ec3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802ec6:	c9                   	leave
+  802ec7:	c3                   	ret
+
+0000000000802ec8 <sharepage>:
+// Map our page pn into envid at the same address, shared: writes by
+// either env are seen by the other.  A copy-on-write page is made
+// private to us first, or the two would drift apart at the next write.
+//
+static int
+sharepage(envid_t envid, uintptr_t pn) {
+  802ec8:	55                   	push   %rbp
+  802ec9:	48 89 e5             	mov    %rsp,%rbp
+  802ecc:	48 83 ec 20          	sub    $0x20,%rsp
+  802ed0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802ed3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  void *addr = (void *)(pn * PGSIZE);
+  802ed7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802edb:	48 c1 e0 0c          	shl    $0xc,%rax
+  802edf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (uvpt[pn] & PTE_COW)
+  802ee3:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802eea:	01 00 00 
+  802eed:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ef1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802ef5:	25 00 08 00 00       	and    $0x800,%eax
+  802efa:	48 85 c0             	test   %rax,%rax
+  802efd:	74 0d                	je     802f0c <sharepage+0x44>
+    *(volatile char *)addr = *(volatile char *)addr;
+  802eff:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f03:	0f b6 10             	movzbl (%rax),%edx
+  802f06:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f0a:	88 10                	mov    %dl,(%rax)
+  return sys_page_map(0, addr, envid, addr, uvpt[pn] & PTE_SYSCALL);
+  802f0c:	48 ba 00 00 00 00 00 	movabs $0x10000000000,%rdx
+  802f13:	01 00 00 
+  802f16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f1a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802f1e:	25 07 0e 00 00       	and    $0xe07,%eax
+  802f23:	89 c6                	mov    %eax,%esi
+  802f25:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  802f29:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802f2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802f30:	41 89 f0             	mov    %esi,%r8d
+  802f33:	48 89 c6             	mov    %rax,%rsi
+  802f36:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3b:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  802f42:	00 00 00 
+  802f45:	ff d0                	call   *%rax
+}
+  802f47:	c9                   	leave
+  802f48:	c3                   	ret
+
+0000000000802f49 <fork_common>:
+//
+// Create a child whose address space is a copy-on-write copy of ours
+// or, if 'share' is set, shares all of it except the stack.
+//
+static envid_t
+fork_common(bool share) {
+  802f49:	55                   	push   %rbp
+  802f4a:	48 89 e5             	mov    %rsp,%rbp
+  802f4d:	48 83 ec 40          	sub    $0x40,%rsp
+  802f51:	89 f8                	mov    %edi,%eax
+  802f53:	88 45 cc             	mov    %al,-0x34(%rbp)
+  // Duplicating shadow addresses is insane. Make sure to skip shadow addresses in COW above.
+
+  envid_t e;
+  int r;
+
+  set_pgfault_handler(pgfault);
+  802f56:	48 b8 ee 2a 80 00 00 	movabs $0x802aee,%rax
+  802f5d:	00 00 00 
+  802f60:	48 89 c7             	mov    %rax,%rdi
+  802f63:	48 b8 93 61 80 00 00 	movabs $0x806193,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+  envid_t ret;
+  __asm __volatile("int %2"
+  802f6f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f74:	cd 30                	int    $0x30
+  802f76:	89 45 dc             	mov    %eax,-0x24(%rbp)
+                   : "=a"(ret)
+                   : "a"(SYS_exofork),
+                     "i"(T_SYSCALL));
+  return ret;
+  802f79:	8b 45 dc             	mov    -0x24(%rbp),%eax
+
+  if ((e = sys_exofork()) < 0) {
+  802f7c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802f7f:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802f83:	79 36                	jns    802fbb <fork_common+0x72>
+    panic("fork error: %i\n", (int) e);
+  802f85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f88:	89 c1                	mov    %eax,%ecx
+  802f8a:	48 b8 9b 6d 80 00 00 	movabs $0x806d9b,%rax
+  802f91:	00 00 00 
+  802f94:	48 89 c2             	mov    %rax,%rdx
+  802f97:	be 8f 00 00 00       	mov    $0x8f,%esi
+  802f9c:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  802fa3:	00 00 00 
+  802fa6:	48 89 c7             	mov    %rax,%rdi
+  802fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fae:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  802fb5:	00 00 00 
+  802fb8:	41 ff d0             	call   *%r8
+  }
+
+  if (!e) {
+  802fbb:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802fbf:	75 0a                	jne    802fcb <fork_common+0x82>
+#ifdef CONFIG_KSPACE
+    thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+    return 0;
+  802fc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc6:	e9 d3 02 00 00       	jmp    80329e <fork_common+0x355>
+  } else {
+    uint64_t i;
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  802fcb:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802fd2:	00 
+  802fd3:	e9 7a 01 00 00       	jmp    803152 <fork_common+0x209>
+      if ((uvpml4e[VPML4E(i * PGSIZE)] & PTE_P) && (uvpde[VPDPE(i * PGSIZE)] & PTE_P) && (uvpd[VPD(i * PGSIZE)] & PTE_P)) {
+  802fd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802fdc:	48 c1 e0 0c          	shl    $0xc,%rax
+  802fe0:	48 c1 e8 27          	shr    $0x27,%rax
+  802fe4:	48 89 c2             	mov    %rax,%rdx
+  802fe7:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802fee:	01 00 00 
+  802ff1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ff5:	83 e0 01             	and    $0x1,%eax
+  802ff8:	48 85 c0             	test   %rax,%rax
+  802ffb:	0f 84 4c 01 00 00    	je     80314d <fork_common+0x204>
+  803001:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803005:	48 c1 e0 0c          	shl    $0xc,%rax
+  803009:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80300d:	48 89 c2             	mov    %rax,%rdx
+  803010:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803017:	01 00 00 
+  80301a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80301e:	83 e0 01             	and    $0x1,%eax
+  803021:	48 85 c0             	test   %rax,%rax
+  803024:	0f 84 23 01 00 00    	je     80314d <fork_common+0x204>
+  80302a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80302e:	48 c1 e0 0c          	shl    $0xc,%rax
+  803032:	48 c1 e8 15          	shr    $0x15,%rax
+  803036:	48 89 c2             	mov    %rax,%rdx
+  803039:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  803040:	01 00 00 
+  803043:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803047:	83 e0 01             	and    $0x1,%eax
+  80304a:	48 85 c0             	test   %rax,%rax
+  80304d:	0f 84 fa 00 00 00    	je     80314d <fork_common+0x204>
+        void * addr = (void *)(i * PGSIZE);
+  803053:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803057:	48 c1 e0 0c          	shl    $0xc,%rax
+  80305b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+        }
+#endif
+
+        // The child gets a fresh exception stack, and has none of our
+        // threads, whose exception stacks must stay writable for them.
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  80305f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803063:	48 ba ff ff ff ff 7f 	movabs $0x7fffffffff,%rdx
+  80306a:	00 00 00 
+  80306d:	48 39 c2             	cmp    %rax,%rdx
+  803070:	0f 82 d7 00 00 00    	jb     80314d <fork_common+0x204>
+  803076:	48 b8 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rax
+  80307d:	00 00 00 
+  803080:	48 39 45 e0          	cmp    %rax,-0x20(%rbp)
+  803084:	0f 84 c3 00 00 00    	je     80314d <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  80308a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80308e:	48 89 c7             	mov    %rax,%rdi
+  803091:	48 b8 9d 5c 80 00 00 	movabs $0x805c9d,%rax
+  803098:	00 00 00 
+  80309b:	ff d0                	call   *%rax
+  80309d:	83 f0 01             	xor    $0x1,%eax
+        if (((uintptr_t) addr < UTOP) && ((uintptr_t) addr != UXSTACKTOP - PGSIZE) &&
+  8030a0:	84 c0                	test   %al,%al
+  8030a2:	0f 84 a5 00 00 00    	je     80314d <fork_common+0x204>
+            !thread_is_uxstack((uintptr_t) addr) && (uvpt[PGNUM(addr)] & PTE_P)) {
+  8030a8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030ac:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030b0:	48 89 c2             	mov    %rax,%rdx
+  8030b3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8030ba:	01 00 00 
+  8030bd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030c1:	83 e0 01             	and    $0x1,%eax
+  8030c4:	48 85 c0             	test   %rax,%rax
+  8030c7:	0f 84 80 00 00 00    	je     80314d <fork_common+0x204>
+          if (share && ((uintptr_t) addr < USTACKTOP - USTACKSIZE || (uintptr_t) addr >= USTACKTOP)) {
+  8030cd:	80 7d cc 00          	cmpb   $0x0,-0x34(%rbp)
+  8030d1:	74 4a                	je     80311d <fork_common+0x1d4>
+  8030d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030d7:	48 ba ff 6f ff ff 7f 	movabs $0x7fffff6fff,%rdx
+  8030de:	00 00 00 
+  8030e1:	48 39 c2             	cmp    %rax,%rdx
+  8030e4:	73 13                	jae    8030f9 <fork_common+0x1b0>
+  8030e6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030ea:	48 ba ff af ff ff 7f 	movabs $0x7fffffafff,%rdx
+  8030f1:	00 00 00 
+  8030f4:	48 39 c2             	cmp    %rax,%rdx
+  8030f7:	73 24                	jae    80311d <fork_common+0x1d4>
+            r = sharepage(e, PGNUM(addr));
+  8030f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8030fd:	48 c1 e8 0c          	shr    $0xc,%rax
+  803101:	48 89 c2             	mov    %rax,%rdx
+  803104:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803107:	48 89 d6             	mov    %rdx,%rsi
+  80310a:	89 c7                	mov    %eax,%edi
+  80310c:	48 b8 c8 2e 80 00 00 	movabs $0x802ec8,%rax
+  803113:	00 00 00 
+  803116:	ff d0                	call   *%rax
+  803118:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80311b:	eb 22                	jmp    80313f <fork_common+0x1f6>
+          } else {
+            r = duppage(e, PGNUM(addr));
+  80311d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803121:	48 c1 e8 0c          	shr    $0xc,%rax
+  803125:	48 89 c2             	mov    %rax,%rdx
+  803128:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80312b:	48 89 d6             	mov    %rdx,%rsi
+  80312e:	89 c7                	mov    %eax,%edi
+  803130:	48 b8 43 2d 80 00 00 	movabs $0x802d43,%rax
+  803137:	00 00 00 
+  80313a:	ff d0                	call   *%rax
+  80313c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+          }
+          if (r < 0) {
+  80313f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803143:	79 08                	jns    80314d <fork_common+0x204>
+            return r;
+  803145:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803148:	e9 51 01 00 00       	jmp    80329e <fork_common+0x355>
+    for (i = 0; i < UTOP / PGSIZE; i++) {
+  80314d:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803152:	48 81 7d f0 ff ff ff 	cmpq   $0x7ffffff,-0x10(%rbp)
+  803159:	07 
+  80315a:	0f 86 78 fe ff ff    	jbe    802fd8 <fork_common+0x8f>
+          }
+        }
+      }
+    }
+    if ((r = sys_env_set_pgfault_upcall(e, thisenv->env_pgfault_upcall)) < 0) {
+  803160:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803167:	00 00 00 
+  80316a:	8b 40 04             	mov    0x4(%rax),%eax
+  80316d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803172:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803179:	00 00 00 
+  80317c:	48 98                	cltq
+  80317e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803185:	48 01 d0             	add    %rdx,%rax
+  803188:	48 05 00 01 00 00    	add    $0x100,%rax
+  80318e:	48 8b 10             	mov    (%rax),%rdx
+  803191:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803194:	48 89 d6             	mov    %rdx,%rsi
+  803197:	89 c7                	mov    %eax,%edi
+  803199:	48 b8 a4 25 80 00 00 	movabs $0x8025a4,%rax
+  8031a0:	00 00 00 
+  8031a3:	ff d0                	call   *%rax
+  8031a5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031a8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031ac:	79 36                	jns    8031e4 <fork_common+0x29b>
+      panic("fork error: sys_env_set_pgfault_upcall: %i\n", r);
+  8031ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031b1:	89 c1                	mov    %eax,%ecx
+  8031b3:	48 b8 b0 6d 80 00 00 	movabs $0x806db0,%rax
+  8031ba:	00 00 00 
+  8031bd:	48 89 c2             	mov    %rax,%rdx
+  8031c0:	be be 00 00 00       	mov    $0xbe,%esi
+  8031c5:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  8031cc:	00 00 00 
+  8031cf:	48 89 c7             	mov    %rax,%rdi
+  8031d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d7:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  8031de:	00 00 00 
+  8031e1:	41 ff d0             	call   *%r8
+    }
+    if ((r = sys_page_alloc(e, (void *) UXSTACKTOP - PGSIZE, PTE_W)) < 0) {
+  8031e4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8031e7:	ba 02 00 00 00       	mov    $0x2,%edx
+  8031ec:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8031f3:	00 00 00 
+  8031f6:	48 89 ce             	mov    %rcx,%rsi
+  8031f9:	89 c7                	mov    %eax,%edi
+  8031fb:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  803202:	00 00 00 
+  803205:	ff d0                	call   *%rax
+  803207:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80320a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80320e:	79 36                	jns    803246 <fork_common+0x2fd>
+      panic("fork error: sys_page_alloc: %i\n", r);
+  803210:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803213:	89 c1                	mov    %eax,%ecx
+  803215:	48 b8 e0 6d 80 00 00 	movabs $0x806de0,%rax
+  80321c:	00 00 00 
+  80321f:	48 89 c2             	mov    %rax,%rdx
+  803222:	be c1 00 00 00       	mov    $0xc1,%esi
+  803227:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  80322e:	00 00 00 
+  803231:	48 89 c7             	mov    %rax,%rdi
+  803234:	b8 00 00 00 00       	mov    $0x0,%eax
+  803239:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  803240:	00 00 00 
+  803243:	41 ff d0             	call   *%r8
+        panic("Fork: failed to alloc shadow stack base page: %i\n", r);
+    for (addr = SANITIZE_USER_VPT_SHADOW_BASE; addr < SANITIZE_USER_VPT_SHADOW_BASE + SANITIZE_USER_VPT_SHADOW_SIZE; addr += PGSIZE)
+      if ((r = sys_page_alloc(e, (void *) addr, PTE_P | PTE_U | PTE_W)) < 0)
+        panic("Fork: failed to alloc shadow vpt base page: %i\n", r);
+#endif
+    if ((r = sys_env_set_status(e, ENV_RUNNABLE)) < 0) {
+  803246:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803249:	be 02 00 00 00       	mov    $0x2,%esi
+  80324e:	89 c7                	mov    %eax,%edi
+  803250:	48 b8 0b 25 80 00 00 	movabs $0x80250b,%rax
+  803257:	00 00 00 
+  80325a:	ff d0                	call   *%rax
+  80325c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80325f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803263:	79 36                	jns    80329b <fork_common+0x352>
+      panic("fork error: sys_env_set_status: %i\n", r);
+  803265:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803268:	89 c1                	mov    %eax,%ecx
+  80326a:	48 b8 00 6e 80 00 00 	movabs $0x806e00,%rax
+  803271:	00 00 00 
+  803274:	48 89 c2             	mov    %rax,%rdx
+  803277:	be d4 00 00 00       	mov    $0xd4,%esi
+  80327c:	48 b8 e6 6c 80 00 00 	movabs $0x806ce6,%rax
+  803283:	00 00 00 
+  803286:	48 89 c7             	mov    %rax,%rdi
+  803289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80328e:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  803295:	00 00 00 
+  803298:	41 ff d0             	call   *%r8
+    }
+    return e;
+  80329b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  }
+}
+  80329e:	c9                   	leave
+  80329f:	c3                   	ret
+
+00000000008032a0 <fork>:
+//   Remember to fix "thisenv" in the child process.
+//   Neither user exception stack should ever be marked copy-on-write,
+//   so you must allocate a new page for the child's user exception stack.
+//
+envid_t
+fork(void) {
+  8032a0:	55                   	push   %rbp
+  8032a1:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(0);
+  8032a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032a9:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  8032b0:	00 00 00 
+  8032b3:	ff d0                	call   *%rax
+}
+  8032b5:	5d                   	pop    %rbp
+  8032b6:	c3                   	ret
+
+00000000008032b7 <sfork>:
+// stack, which it gets a copy-on-write copy of, and the exception
+// stack.  Only the main thread may call it, since other threads run
+// on stacks that would end up shared.
+//
+envid_t
+sfork(void) {
+  8032b7:	55                   	push   %rbp
+  8032b8:	48 89 e5             	mov    %rsp,%rbp
+  return fork_common(1);
+  8032bb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032c0:	48 b8 49 2f 80 00 00 	movabs $0x802f49,%rax
+  8032c7:	00 00 00 
+  8032ca:	ff d0                	call   *%rax
+}
+  8032cc:	5d                   	pop    %rbp
+  8032cd:	c3                   	ret
+
+00000000008032ce <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  8032ce:	55                   	push   %rbp
+  8032cf:	48 89 e5             	mov    %rsp,%rbp
+  8032d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8032d6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8032da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032de:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  8032e5:	ff ff ff 
+  8032e8:	48 01 d0             	add    %rdx,%rax
+  8032eb:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8032ef:	c9                   	leave
+  8032f0:	c3                   	ret
+
+00000000008032f1 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  8032f1:	55                   	push   %rbp
+  8032f2:	48 89 e5             	mov    %rsp,%rbp
+  8032f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8032f9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  8032fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803301:	48 89 c7             	mov    %rax,%rdi
+  803304:	48 b8 ce 32 80 00 00 	movabs $0x8032ce,%rax
+  80330b:	00 00 00 
+  80330e:	ff d0                	call   *%rax
+  803310:	48 05 01 68 00 00    	add    $0x6801,%rax
+  803316:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  80331a:	c9                   	leave
+  80331b:	c3                   	ret
+
+000000000080331c <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  80331c:	55                   	push   %rbp
+  80331d:	48 89 e5             	mov    %rsp,%rbp
+  803320:	48 83 ec 18          	sub    $0x18,%rsp
+  803324:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  803328:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80332f:	e9 ae 00 00 00       	jmp    8033e2 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  803334:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803337:	c1 e0 0c             	shl    $0xc,%eax
+  80333a:	48 98                	cltq
+  80333c:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803341:	48 01 d0             	add    %rdx,%rax
+  803344:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  803348:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80334c:	48 c1 e8 27          	shr    $0x27,%rax
+  803350:	48 89 c2             	mov    %rax,%rdx
+  803353:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  80335a:	01 00 00 
+  80335d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803361:	83 e0 01             	and    $0x1,%eax
+  803364:	48 85 c0             	test   %rax,%rax
+  803367:	74 63                	je     8033cc <fd_alloc+0xb0>
+  803369:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80336d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803371:	48 89 c2             	mov    %rax,%rdx
+  803374:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80337b:	01 00 00 
+  80337e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803382:	83 e0 01             	and    $0x1,%eax
+  803385:	48 85 c0             	test   %rax,%rax
+  803388:	74 42                	je     8033cc <fd_alloc+0xb0>
+  80338a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80338e:	48 c1 e8 15          	shr    $0x15,%rax
+  803392:	48 89 c2             	mov    %rax,%rdx
+  803395:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80339c:	01 00 00 
+  80339f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033a3:	83 e0 01             	and    $0x1,%eax
+  8033a6:	48 85 c0             	test   %rax,%rax
+  8033a9:	74 21                	je     8033cc <fd_alloc+0xb0>
+  8033ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8033af:	48 c1 e8 0c          	shr    $0xc,%rax
+  8033b3:	48 89 c2             	mov    %rax,%rdx
+  8033b6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8033bd:	01 00 00 
+  8033c0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8033c4:	83 e0 01             	and    $0x1,%eax
+  8033c7:	48 85 c0             	test   %rax,%rax
+  8033ca:	75 12                	jne    8033de <fd_alloc+0xc2>
+      *fd_store = fd;
+  8033cc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033d0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8033d4:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  8033d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033dc:	eb 1e                	jmp    8033fc <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  8033de:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8033e2:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8033e6:	0f 8e 48 ff ff ff    	jle    803334 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  8033ec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033f0:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  8033f7:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  8033fc:	c9                   	leave
+  8033fd:	c3                   	ret
+
+00000000008033fe <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8033fe:	55                   	push   %rbp
+  8033ff:	48 89 e5             	mov    %rsp,%rbp
+  803402:	48 83 ec 20          	sub    $0x20,%rsp
+  803406:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803409:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80340d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  803411:	78 06                	js     803419 <fd_lookup+0x1b>
+  803413:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  803417:	7e 0a                	jle    803423 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  803419:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80341e:	e9 af 00 00 00       	jmp    8034d2 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  803423:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803426:	c1 e0 0c             	shl    $0xc,%eax
+  803429:	48 98                	cltq
+  80342b:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803430:	48 01 d0             	add    %rdx,%rax
+  803433:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  803437:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80343b:	48 c1 e8 27          	shr    $0x27,%rax
+  80343f:	48 89 c2             	mov    %rax,%rdx
+  803442:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803449:	01 00 00 
+  80344c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803450:	83 e0 01             	and    $0x1,%eax
+  803453:	48 85 c0             	test   %rax,%rax
+  803456:	74 63                	je     8034bb <fd_lookup+0xbd>
+  803458:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80345c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803460:	48 89 c2             	mov    %rax,%rdx
+  803463:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  80346a:	01 00 00 
+  80346d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803471:	83 e0 01             	and    $0x1,%eax
+  803474:	48 85 c0             	test   %rax,%rax
+  803477:	74 42                	je     8034bb <fd_lookup+0xbd>
+  803479:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80347d:	48 c1 e8 15          	shr    $0x15,%rax
+  803481:	48 89 c2             	mov    %rax,%rdx
+  803484:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80348b:	01 00 00 
+  80348e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803492:	83 e0 01             	and    $0x1,%eax
+  803495:	48 85 c0             	test   %rax,%rax
+  803498:	74 21                	je     8034bb <fd_lookup+0xbd>
+  80349a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80349e:	48 c1 e8 0c          	shr    $0xc,%rax
+  8034a2:	48 89 c2             	mov    %rax,%rdx
+  8034a5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8034ac:	01 00 00 
+  8034af:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8034b3:	83 e0 01             	and    $0x1,%eax
+  8034b6:	48 85 c0             	test   %rax,%rax
+  8034b9:	75 07                	jne    8034c2 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8034bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034c0:	eb 10                	jmp    8034d2 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  8034c2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8034c6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034ca:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  8034cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034d2:	c9                   	leave
+  8034d3:	c3                   	ret
+
+00000000008034d4 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  8034d4:	55                   	push   %rbp
+  8034d5:	48 89 e5             	mov    %rsp,%rbp
+  8034d8:	48 83 ec 30          	sub    $0x30,%rsp
+  8034dc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8034e0:	89 f0                	mov    %esi,%eax
+  8034e2:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  8034e5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8034e9:	48 89 c7             	mov    %rax,%rdi
+  8034ec:	48 b8 ce 32 80 00 00 	movabs $0x8032ce,%rax
+  8034f3:	00 00 00 
+  8034f6:	ff d0                	call   *%rax
+  8034f8:	89 c2                	mov    %eax,%edx
+  8034fa:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8034fe:	48 89 c6             	mov    %rax,%rsi
+  803501:	89 d7                	mov    %edx,%edi
+  803503:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  80350a:	00 00 00 
+  80350d:	ff d0                	call   *%rax
+  80350f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803512:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803516:	78 0a                	js     803522 <fd_close+0x4e>
+  803518:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80351c:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  803520:	74 12                	je     803534 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  803522:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  803526:	74 05                	je     80352d <fd_close+0x59>
+  803528:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80352b:	eb 70                	jmp    80359d <fd_close+0xc9>
+  80352d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803532:	eb 69                	jmp    80359d <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  803534:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803538:	8b 00                	mov    (%rax),%eax
+  80353a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80353e:	48 89 d6             	mov    %rdx,%rsi
+  803541:	89 c7                	mov    %eax,%edi
+  803543:	48 b8 9f 35 80 00 00 	movabs $0x80359f,%rax
+  80354a:	00 00 00 
+  80354d:	ff d0                	call   *%rax
+  80354f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803552:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803556:	78 2a                	js     803582 <fd_close+0xae>
+    if (dev->dev_close)
+  803558:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80355c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  803560:	48 85 c0             	test   %rax,%rax
+  803563:	74 16                	je     80357b <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  803565:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803569:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80356d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803571:	48 89 c7             	mov    %rax,%rdi
+  803574:	ff d2                	call   *%rdx
+  803576:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803579:	eb 07                	jmp    803582 <fd_close+0xae>
+    else
+      r = 0;
+  80357b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  803582:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803586:	48 89 c6             	mov    %rax,%rsi
+  803589:	bf 00 00 00 00       	mov    $0x0,%edi
+  80358e:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  803595:	00 00 00 
+  803598:	ff d0                	call   *%rax
+  return r;
+  80359a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80359d:	c9                   	leave
+  80359e:	c3                   	ret
+
+000000000080359f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80359f:	55                   	push   %rbp
+  8035a0:	48 89 e5             	mov    %rsp,%rbp
+  8035a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8035a7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035aa:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  8035ae:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8035b5:	eb 3f                	jmp    8035f6 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  8035b7:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035be:	00 00 00 
+  8035c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035c4:	48 98                	cltq
+  8035c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8035ca:	8b 00                	mov    (%rax),%eax
+  8035cc:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8035cf:	75 21                	jne    8035f2 <dev_lookup+0x53>
+      *dev = devtab[i];
+  8035d1:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035d8:	00 00 00 
+  8035db:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035de:	48 98                	cltq
+  8035e0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8035e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8035e8:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  8035eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f0:	eb 7f                	jmp    803671 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  8035f2:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8035f6:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  8035fd:	00 00 00 
+  803600:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803603:	48 98                	cltq
+  803605:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803609:	48 85 c0             	test   %rax,%rax
+  80360c:	75 a9                	jne    8035b7 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80360e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803615:	00 00 00 
+  803618:	8b 40 04             	mov    0x4(%rax),%eax
+  80361b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803620:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803627:	00 00 00 
+  80362a:	48 98                	cltq
+  80362c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803633:	48 01 d0             	add    %rdx,%rax
+  803636:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80363c:	8b 00                	mov    (%rax),%eax
+  80363e:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803641:	89 c6                	mov    %eax,%esi
+  803643:	48 b8 28 6e 80 00 00 	movabs $0x806e28,%rax
+  80364a:	00 00 00 
+  80364d:	48 89 c7             	mov    %rax,%rdi
+  803650:	b8 00 00 00 00       	mov    $0x0,%eax
+  803655:	48 b9 89 06 80 00 00 	movabs $0x800689,%rcx
+  80365c:	00 00 00 
+  80365f:	ff d1                	call   *%rcx
+  *dev = 0;
+  803661:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803665:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  80366c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803671:	c9                   	leave
+  803672:	c3                   	ret
+
+0000000000803673 <close>:
+
+int
+close(int fdnum) {
+  803673:	55                   	push   %rbp
+  803674:	48 89 e5             	mov    %rsp,%rbp
+  803677:	48 83 ec 20          	sub    $0x20,%rsp
+  80367b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80367e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803682:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803685:	48 89 d6             	mov    %rdx,%rsi
+  803688:	89 c7                	mov    %eax,%edi
+  80368a:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  803691:	00 00 00 
+  803694:	ff d0                	call   *%rax
+  803696:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803699:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80369d:	79 05                	jns    8036a4 <close+0x31>
+    return r;
+  80369f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036a2:	eb 18                	jmp    8036bc <close+0x49>
+  else
+    return fd_close(fd, 1);
+  8036a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8036ad:	48 89 c7             	mov    %rax,%rdi
+  8036b0:	48 b8 d4 34 80 00 00 	movabs $0x8034d4,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+}
+  8036bc:	c9                   	leave
+  8036bd:	c3                   	ret
+
+00000000008036be <close_all>:
+
+void
+close_all(void) {
+  8036be:	55                   	push   %rbp
+  8036bf:	48 89 e5             	mov    %rsp,%rbp
+  8036c2:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8036c6:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8036cd:	eb 15                	jmp    8036e4 <close_all+0x26>
+    close(i);
+  8036cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036d2:	89 c7                	mov    %eax,%edi
+  8036d4:	48 b8 73 36 80 00 00 	movabs $0x803673,%rax
+  8036db:	00 00 00 
+  8036de:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  8036e0:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8036e4:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8036e8:	7e e5                	jle    8036cf <close_all+0x11>
+}
+  8036ea:	90                   	nop
+  8036eb:	90                   	nop
+  8036ec:	c9                   	leave
+  8036ed:	c3                   	ret
+
+00000000008036ee <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  8036ee:	55                   	push   %rbp
+  8036ef:	48 89 e5             	mov    %rsp,%rbp
+  8036f2:	48 83 ec 40          	sub    $0x40,%rsp
+  8036f6:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8036f9:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8036fc:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803700:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803703:	48 89 d6             	mov    %rdx,%rsi
+  803706:	89 c7                	mov    %eax,%edi
+  803708:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  80370f:	00 00 00 
+  803712:	ff d0                	call   *%rax
+  803714:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803717:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80371b:	79 08                	jns    803725 <dup+0x37>
+    return r;
+  80371d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803720:	e9 33 02 00 00       	jmp    803958 <dup+0x26a>
+  close(newfdnum);
+  803725:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803728:	89 c7                	mov    %eax,%edi
+  80372a:	48 b8 73 36 80 00 00 	movabs $0x803673,%rax
+  803731:	00 00 00 
+  803734:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803736:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803739:	c1 e0 0c             	shl    $0xc,%eax
+  80373c:	48 98                	cltq
+  80373e:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803743:	48 01 d0             	add    %rdx,%rax
+  803746:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  80374a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80374e:	48 89 c7             	mov    %rax,%rdi
+  803751:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  803758:	00 00 00 
+  80375b:	ff d0                	call   *%rax
+  80375d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803761:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803765:	48 89 c7             	mov    %rax,%rdi
+  803768:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  80376f:	00 00 00 
+  803772:	ff d0                	call   *%rax
+  803774:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803778:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  80377f:	00 
+  803780:	e9 19 01 00 00       	jmp    80389e <dup+0x1b0>
+    off -= PGSIZE;
+  803785:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  80378c:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80378d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803791:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803795:	48 01 d0             	add    %rdx,%rax
+  803798:	48 c1 e8 27          	shr    $0x27,%rax
+  80379c:	48 89 c2             	mov    %rax,%rdx
+  80379f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8037a6:	01 00 00 
+  8037a9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037ad:	83 e0 01             	and    $0x1,%eax
+  8037b0:	48 85 c0             	test   %rax,%rax
+  8037b3:	0f 84 e5 00 00 00    	je     80389e <dup+0x1b0>
+  8037b9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037bd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037c1:	48 01 d0             	add    %rdx,%rax
+  8037c4:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8037c8:	48 89 c2             	mov    %rax,%rdx
+  8037cb:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8037d2:	01 00 00 
+  8037d5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8037d9:	83 e0 01             	and    $0x1,%eax
+  8037dc:	48 85 c0             	test   %rax,%rax
+  8037df:	0f 84 b9 00 00 00    	je     80389e <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8037e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8037e9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037ed:	48 01 d0             	add    %rdx,%rax
+  8037f0:	48 c1 e8 15          	shr    $0x15,%rax
+  8037f4:	48 89 c2             	mov    %rax,%rdx
+  8037f7:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8037fe:	01 00 00 
+  803801:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803805:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803808:	48 85 c0             	test   %rax,%rax
+  80380b:	0f 84 8d 00 00 00    	je     80389e <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803811:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803815:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803819:	48 01 d0             	add    %rdx,%rax
+  80381c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803820:	48 89 c2             	mov    %rax,%rdx
+  803823:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80382a:	01 00 00 
+  80382d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803831:	83 e0 01             	and    $0x1,%eax
+  803834:	48 85 c0             	test   %rax,%rax
+  803837:	74 65                	je     80389e <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  803839:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80383d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803841:	48 01 d0             	add    %rdx,%rax
+  803844:	48 c1 e8 0c          	shr    $0xc,%rax
+  803848:	48 89 c2             	mov    %rax,%rdx
+  80384b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803852:	01 00 00 
+  803855:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803859:	25 07 0e 00 00       	and    $0xe07,%eax
+  80385e:	89 c6                	mov    %eax,%esi
+  803860:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803864:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803868:	48 01 c2             	add    %rax,%rdx
+  80386b:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80386f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803873:	48 01 c8             	add    %rcx,%rax
+  803876:	41 89 f0             	mov    %esi,%r8d
+  803879:	48 89 d1             	mov    %rdx,%rcx
+  80387c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803881:	48 89 c6             	mov    %rax,%rsi
+  803884:	bf 00 00 00 00       	mov    $0x0,%edi
+  803889:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  803890:	00 00 00 
+  803893:	ff d0                	call   *%rax
+  803895:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803898:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80389c:	78 60                	js     8038fe <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80389e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8038a3:	0f 85 dc fe ff ff    	jne    803785 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8038a9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038ad:	48 c1 e8 0c          	shr    $0xc,%rax
+  8038b1:	48 89 c2             	mov    %rax,%rdx
+  8038b4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8038bb:	01 00 00 
+  8038be:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8038c2:	25 07 0e 00 00       	and    $0xe07,%eax
+  8038c7:	89 c1                	mov    %eax,%ecx
+  8038c9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8038cd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8038d1:	41 89 c8             	mov    %ecx,%r8d
+  8038d4:	48 89 d1             	mov    %rdx,%rcx
+  8038d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8038dc:	48 89 c6             	mov    %rax,%rsi
+  8038df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038e4:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  8038eb:	00 00 00 
+  8038ee:	ff d0                	call   *%rax
+  8038f0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8038f3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8038f7:	78 08                	js     803901 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8038f9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8038fc:	eb 5a                	jmp    803958 <dup+0x26a>
+        goto err;
+  8038fe:	90                   	nop
+  8038ff:	eb 01                	jmp    803902 <dup+0x214>
+    goto err;
+  803901:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803902:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803906:	48 89 c6             	mov    %rax,%rsi
+  803909:	bf 00 00 00 00       	mov    $0x0,%edi
+  80390e:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  803915:	00 00 00 
+  803918:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80391a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803921:	00 
+  803922:	eb 27                	jmp    80394b <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803924:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803928:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80392c:	48 01 d0             	add    %rdx,%rax
+  80392f:	48 89 c6             	mov    %rax,%rsi
+  803932:	bf 00 00 00 00       	mov    $0x0,%edi
+  803937:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  80393e:	00 00 00 
+  803941:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803943:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80394a:	00 
+  80394b:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803952:	00 
+  803953:	76 cf                	jbe    803924 <dup+0x236>
+  return r;
+  803955:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803958:	c9                   	leave
+  803959:	c3                   	ret
+
+000000000080395a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80395a:	55                   	push   %rbp
+  80395b:	48 89 e5             	mov    %rsp,%rbp
+  80395e:	48 83 ec 40          	sub    $0x40,%rsp
+  803962:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803965:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803969:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80396d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803971:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803974:	48 89 d6             	mov    %rdx,%rsi
+  803977:	89 c7                	mov    %eax,%edi
+  803979:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  803980:	00 00 00 
+  803983:	ff d0                	call   *%rax
+  803985:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803988:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80398c:	78 24                	js     8039b2 <read+0x58>
+  80398e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803992:	8b 00                	mov    (%rax),%eax
+  803994:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803998:	48 89 d6             	mov    %rdx,%rsi
+  80399b:	89 c7                	mov    %eax,%edi
+  80399d:	48 b8 9f 35 80 00 00 	movabs $0x80359f,%rax
+  8039a4:	00 00 00 
+  8039a7:	ff d0                	call   *%rax
+  8039a9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8039ac:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8039b0:	79 0a                	jns    8039bc <read+0x62>
+    return r;
+  8039b2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8039b5:	48 98                	cltq
+  8039b7:	e9 9e 00 00 00       	jmp    803a5a <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8039bc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039c0:	8b 40 08             	mov    0x8(%rax),%eax
+  8039c3:	83 e0 03             	and    $0x3,%eax
+  8039c6:	83 f8 01             	cmp    $0x1,%eax
+  8039c9:	75 5c                	jne    803a27 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8039cb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8039d2:	00 00 00 
+  8039d5:	8b 40 04             	mov    0x4(%rax),%eax
+  8039d8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8039dd:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8039e4:	00 00 00 
+  8039e7:	48 98                	cltq
+  8039e9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8039f0:	48 01 d0             	add    %rdx,%rax
+  8039f3:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8039f9:	8b 00                	mov    (%rax),%eax
+  8039fb:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8039fe:	89 c6                	mov    %eax,%esi
+  803a00:	48 b8 47 6e 80 00 00 	movabs $0x806e47,%rax
+  803a07:	00 00 00 
+  803a0a:	48 89 c7             	mov    %rax,%rdi
+  803a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a12:	48 b9 89 06 80 00 00 	movabs $0x800689,%rcx
+  803a19:	00 00 00 
+  803a1c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803a1e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803a25:	eb 33                	jmp    803a5a <read+0x100>
+  }
+  if (!dev->dev_read)
+  803a27:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a2b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803a2f:	48 85 c0             	test   %rax,%rax
+  803a32:	75 09                	jne    803a3d <read+0xe3>
+    return -E_NOT_SUPP;
+  803a34:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803a3b:	eb 1d                	jmp    803a5a <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  803a3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803a41:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803a45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a49:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803a4d:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803a51:	48 89 ce             	mov    %rcx,%rsi
+  803a54:	48 89 c7             	mov    %rax,%rdi
+  803a57:	41 ff d0             	call   *%r8
+}
+  803a5a:	c9                   	leave
+  803a5b:	c3                   	ret
+
+0000000000803a5c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  803a5c:	55                   	push   %rbp
+  803a5d:	48 89 e5             	mov    %rsp,%rbp
+  803a60:	48 83 ec 30          	sub    $0x30,%rsp
+  803a64:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803a67:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803a6b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803a6f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803a76:	eb 49                	jmp    803ac1 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803a78:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a7b:	48 98                	cltq
+  803a7d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a81:	48 29 c2             	sub    %rax,%rdx
+  803a84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a87:	48 63 c8             	movslq %eax,%rcx
+  803a8a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a8e:	48 01 c1             	add    %rax,%rcx
+  803a91:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803a94:	48 89 ce             	mov    %rcx,%rsi
+  803a97:	89 c7                	mov    %eax,%edi
+  803a99:	48 b8 5a 39 80 00 00 	movabs $0x80395a,%rax
+  803aa0:	00 00 00 
+  803aa3:	ff d0                	call   *%rax
+  803aa5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803aa8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803aac:	79 07                	jns    803ab5 <readn+0x59>
+      return m;
+  803aae:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803ab1:	48 98                	cltq
+  803ab3:	eb 1f                	jmp    803ad4 <readn+0x78>
+    if (m == 0)
+  803ab5:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803ab9:	74 13                	je     803ace <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  803abb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803abe:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803ac1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ac4:	48 98                	cltq
+  803ac6:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  803aca:	72 ac                	jb     803a78 <readn+0x1c>
+  803acc:	eb 01                	jmp    803acf <readn+0x73>
+      break;
+  803ace:	90                   	nop
+  }
+  return tot;
+  803acf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ad2:	48 98                	cltq
+}
+  803ad4:	c9                   	leave
+  803ad5:	c3                   	ret
+
+0000000000803ad6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803ad6:	55                   	push   %rbp
+  803ad7:	48 89 e5             	mov    %rsp,%rbp
+  803ada:	48 83 ec 40          	sub    $0x40,%rsp
+  803ade:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803ae1:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803ae5:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803ae9:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803aed:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803af0:	48 89 d6             	mov    %rdx,%rsi
+  803af3:	89 c7                	mov    %eax,%edi
+  803af5:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  803afc:	00 00 00 
+  803aff:	ff d0                	call   *%rax
+  803b01:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b04:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b08:	78 24                	js     803b2e <write+0x58>
+  803b0a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b0e:	8b 00                	mov    (%rax),%eax
+  803b10:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803b14:	48 89 d6             	mov    %rdx,%rsi
+  803b17:	89 c7                	mov    %eax,%edi
+  803b19:	48 b8 9f 35 80 00 00 	movabs $0x80359f,%rax
+  803b20:	00 00 00 
+  803b23:	ff d0                	call   *%rax
+  803b25:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b28:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b2c:	79 0a                	jns    803b38 <write+0x62>
+    return r;
+  803b2e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b31:	48 98                	cltq
+  803b33:	e9 9d 00 00 00       	jmp    803bd5 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803b38:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b3c:	8b 40 08             	mov    0x8(%rax),%eax
+  803b3f:	83 e0 03             	and    $0x3,%eax
+  803b42:	85 c0                	test   %eax,%eax
+  803b44:	75 5c                	jne    803ba2 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803b46:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803b4d:	00 00 00 
+  803b50:	8b 40 04             	mov    0x4(%rax),%eax
+  803b53:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803b58:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803b5f:	00 00 00 
+  803b62:	48 98                	cltq
+  803b64:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803b6b:	48 01 d0             	add    %rdx,%rax
+  803b6e:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803b74:	8b 00                	mov    (%rax),%eax
+  803b76:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803b79:	89 c6                	mov    %eax,%esi
+  803b7b:	48 b8 63 6e 80 00 00 	movabs $0x806e63,%rax
+  803b82:	00 00 00 
+  803b85:	48 89 c7             	mov    %rax,%rdi
+  803b88:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b8d:	48 b9 89 06 80 00 00 	movabs $0x800689,%rcx
+  803b94:	00 00 00 
+  803b97:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803b99:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803ba0:	eb 33                	jmp    803bd5 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803ba2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ba6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803baa:	48 85 c0             	test   %rax,%rax
+  803bad:	75 09                	jne    803bb8 <write+0xe2>
+    return -E_NOT_SUPP;
+  803baf:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803bb6:	eb 1d                	jmp    803bd5 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803bb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bbc:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803bc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803bc4:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803bc8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803bcc:	48 89 ce             	mov    %rcx,%rsi
+  803bcf:	48 89 c7             	mov    %rax,%rdi
+  803bd2:	41 ff d0             	call   *%r8
+}
+  803bd5:	c9                   	leave
+  803bd6:	c3                   	ret
+
+0000000000803bd7 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803bd7:	55                   	push   %rbp
+  803bd8:	48 89 e5             	mov    %rsp,%rbp
+  803bdb:	48 83 ec 18          	sub    $0x18,%rsp
+  803bdf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803be2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803be5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803be9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803bec:	48 89 d6             	mov    %rdx,%rsi
+  803bef:	89 c7                	mov    %eax,%edi
+  803bf1:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  803bf8:	00 00 00 
+  803bfb:	ff d0                	call   *%rax
+  803bfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c04:	79 05                	jns    803c0b <seek+0x34>
+    return r;
+  803c06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c09:	eb 0f                	jmp    803c1a <seek+0x43>
+  fd->fd_offset = offset;
+  803c0b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803c0f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803c12:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803c15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c1a:	c9                   	leave
+  803c1b:	c3                   	ret
+
+0000000000803c1c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  803c1c:	55                   	push   %rbp
+  803c1d:	48 89 e5             	mov    %rsp,%rbp
+  803c20:	48 83 ec 30          	sub    $0x30,%rsp
+  803c24:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803c27:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803c2a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803c2e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803c31:	48 89 d6             	mov    %rdx,%rsi
+  803c34:	89 c7                	mov    %eax,%edi
+  803c36:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  803c3d:	00 00 00 
+  803c40:	ff d0                	call   *%rax
+  803c42:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c45:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c49:	78 24                	js     803c6f <ftruncate+0x53>
+  803c4b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c4f:	8b 00                	mov    (%rax),%eax
+  803c51:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803c55:	48 89 d6             	mov    %rdx,%rsi
+  803c58:	89 c7                	mov    %eax,%edi
+  803c5a:	48 b8 9f 35 80 00 00 	movabs $0x80359f,%rax
+  803c61:	00 00 00 
+  803c64:	ff d0                	call   *%rax
+  803c66:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c69:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c6d:	79 08                	jns    803c77 <ftruncate+0x5b>
+    return r;
+  803c6f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c72:	e9 92 00 00 00       	jmp    803d09 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803c77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c7b:	8b 40 08             	mov    0x8(%rax),%eax
+  803c7e:	83 e0 03             	and    $0x3,%eax
+  803c81:	85 c0                	test   %eax,%eax
+  803c83:	75 5a                	jne    803cdf <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803c85:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803c8c:	00 00 00 
+  803c8f:	8b 40 04             	mov    0x4(%rax),%eax
+  803c92:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803c97:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803c9e:	00 00 00 
+  803ca1:	48 98                	cltq
+  803ca3:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803caa:	48 01 d0             	add    %rdx,%rax
+  803cad:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803cb3:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803cb5:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803cb8:	89 c6                	mov    %eax,%esi
+  803cba:	48 b8 80 6e 80 00 00 	movabs $0x806e80,%rax
+  803cc1:	00 00 00 
+  803cc4:	48 89 c7             	mov    %rax,%rdi
+  803cc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ccc:	48 b9 89 06 80 00 00 	movabs $0x800689,%rcx
+  803cd3:	00 00 00 
+  803cd6:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803cd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803cdd:	eb 2a                	jmp    803d09 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803cdf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ce3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803ce7:	48 85 c0             	test   %rax,%rax
+  803cea:	75 07                	jne    803cf3 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803cec:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803cf1:	eb 16                	jmp    803d09 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803cf3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803cf7:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803cfb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cff:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803d02:	89 d6                	mov    %edx,%esi
+  803d04:	48 89 c7             	mov    %rax,%rdi
+  803d07:	ff d1                	call   *%rcx
+}
+  803d09:	c9                   	leave
+  803d0a:	c3                   	ret
+
+0000000000803d0b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  803d0b:	55                   	push   %rbp
+  803d0c:	48 89 e5             	mov    %rsp,%rbp
+  803d0f:	48 83 ec 30          	sub    $0x30,%rsp
+  803d13:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803d16:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803d1a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803d1e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803d21:	48 89 d6             	mov    %rdx,%rsi
+  803d24:	89 c7                	mov    %eax,%edi
+  803d26:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  803d2d:	00 00 00 
+  803d30:	ff d0                	call   *%rax
+  803d32:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d35:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d39:	78 24                	js     803d5f <fstat+0x54>
+  803d3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d3f:	8b 00                	mov    (%rax),%eax
+  803d41:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803d45:	48 89 d6             	mov    %rdx,%rsi
+  803d48:	89 c7                	mov    %eax,%edi
+  803d4a:	48 b8 9f 35 80 00 00 	movabs $0x80359f,%rax
+  803d51:	00 00 00 
+  803d54:	ff d0                	call   *%rax
+  803d56:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d59:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d5d:	79 05                	jns    803d64 <fstat+0x59>
+    return r;
+  803d5f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d62:	eb 5e                	jmp    803dc2 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803d64:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d68:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803d6c:	48 85 c0             	test   %rax,%rax
+  803d6f:	75 07                	jne    803d78 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803d71:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803d76:	eb 4a                	jmp    803dc2 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803d78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d7c:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803d7f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d83:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803d8a:	00 00 00 
+  stat->st_isdir   = 0;
+  803d8d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d91:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803d98:	00 00 00 
+  stat->st_dev     = dev;
+  803d9b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da3:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803daa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dae:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803db2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803db6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803dba:	48 89 d6             	mov    %rdx,%rsi
+  803dbd:	48 89 c7             	mov    %rax,%rdi
+  803dc0:	ff d1                	call   *%rcx
+}
+  803dc2:	c9                   	leave
+  803dc3:	c3                   	ret
+
+0000000000803dc4 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803dc4:	55                   	push   %rbp
+  803dc5:	48 89 e5             	mov    %rsp,%rbp
+  803dc8:	48 83 ec 10          	sub    $0x10,%rsp
+  803dcc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803dd0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803dd4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dd8:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803dde:	83 f8 20             	cmp    $0x20,%eax
+  803de1:	75 07                	jne    803dea <pollwait_key+0x26>
+    return -E_INVAL;
+  803de3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803de8:	eb 5f                	jmp    803e49 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803dea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803dee:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803df4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803df8:	48 63 d2             	movslq %edx,%rdx
+  803dfb:	48 c1 e2 04          	shl    $0x4,%rdx
+  803dff:	48 01 c2             	add    %rax,%rdx
+  803e02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e06:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803e09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e0d:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803e13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803e17:	8b 00                	mov    (%rax),%eax
+  803e19:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803e1d:	48 63 c9             	movslq %ecx,%rcx
+  803e20:	48 c1 e1 04          	shl    $0x4,%rcx
+  803e24:	48 01 ca             	add    %rcx,%rdx
+  803e27:	48 83 c2 08          	add    $0x8,%rdx
+  803e2b:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  803e2d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e31:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803e37:	8d 50 01             	lea    0x1(%rax),%edx
+  803e3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e3e:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803e44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e49:	c9                   	leave
+  803e4a:	c3                   	ret
+
+0000000000803e4b <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  803e4b:	55                   	push   %rbp
+  803e4c:	48 89 e5             	mov    %rsp,%rbp
+  803e4f:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803e56:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  803e5d:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803e63:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803e6a:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803e71:	00 
+  int i, r, ready, ipc = 0;
+  803e72:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803e79:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803e80:	00 
+  803e81:	74 45                	je     803ec8 <poll+0x7d>
+  803e83:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803e8a:	ff 
+  803e8b:	74 3b                	je     803ec8 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803e8d:	48 b8 a2 5d 80 00 00 	movabs $0x805da2,%rax
+  803e94:	00 00 00 
+  803e97:	ff d0                	call   *%rax
+  803e99:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803e9d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ea1:	48 f7 d0             	not    %rax
+  803ea4:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803eab:	73 10                	jae    803ebd <poll+0x72>
+  803ead:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803eb1:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803eb8:	48 01 d0             	add    %rdx,%rax
+  803ebb:	eb 07                	jmp    803ec4 <poll+0x79>
+  803ebd:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803ec4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803ec8:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803ecf:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803ed6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803edd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803ee4:	e9 46 02 00 00       	jmp    80412f <poll+0x2e4>
+      fds[i].revents = 0;
+  803ee9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803eec:	48 63 d0             	movslq %eax,%rdx
+  803eef:	48 89 d0             	mov    %rdx,%rax
+  803ef2:	48 01 c0             	add    %rax,%rax
+  803ef5:	48 01 d0             	add    %rdx,%rax
+  803ef8:	48 c1 e0 02          	shl    $0x2,%rax
+  803efc:	48 89 c2             	mov    %rax,%rdx
+  803eff:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f06:	48 01 d0             	add    %rdx,%rax
+  803f09:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803f10:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f13:	48 63 d0             	movslq %eax,%rdx
+  803f16:	48 89 d0             	mov    %rdx,%rax
+  803f19:	48 01 c0             	add    %rax,%rax
+  803f1c:	48 01 d0             	add    %rdx,%rax
+  803f1f:	48 c1 e0 02          	shl    $0x2,%rax
+  803f23:	48 89 c2             	mov    %rax,%rdx
+  803f26:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f2d:	48 01 d0             	add    %rdx,%rax
+  803f30:	8b 00                	mov    (%rax),%eax
+  803f32:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803f35:	75 62                	jne    803f99 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803f37:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f3a:	48 63 d0             	movslq %eax,%rdx
+  803f3d:	48 89 d0             	mov    %rdx,%rax
+  803f40:	48 01 c0             	add    %rax,%rax
+  803f43:	48 01 d0             	add    %rdx,%rax
+  803f46:	48 c1 e0 02          	shl    $0x2,%rax
+  803f4a:	48 89 c2             	mov    %rax,%rdx
+  803f4d:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f54:	48 01 d0             	add    %rdx,%rax
+  803f57:	8b 40 04             	mov    0x4(%rax),%eax
+  803f5a:	83 e0 01             	and    $0x1,%eax
+  803f5d:	85 c0                	test   %eax,%eax
+  803f5f:	0f 84 9b 01 00 00    	je     804100 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803f65:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f68:	48 63 d0             	movslq %eax,%rdx
+  803f6b:	48 89 d0             	mov    %rdx,%rax
+  803f6e:	48 01 c0             	add    %rax,%rax
+  803f71:	48 01 d0             	add    %rdx,%rax
+  803f74:	48 c1 e0 02          	shl    $0x2,%rax
+  803f78:	48 89 c2             	mov    %rax,%rdx
+  803f7b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803f82:	48 01 c2             	add    %rax,%rdx
+  803f85:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803f88:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803f8b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803f8e:	83 c8 04             	or     $0x4,%eax
+  803f91:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803f94:	e9 67 01 00 00       	jmp    804100 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803f99:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f9c:	48 63 d0             	movslq %eax,%rdx
+  803f9f:	48 89 d0             	mov    %rdx,%rax
+  803fa2:	48 01 c0             	add    %rax,%rax
+  803fa5:	48 01 d0             	add    %rdx,%rax
+  803fa8:	48 c1 e0 02          	shl    $0x2,%rax
+  803fac:	48 89 c2             	mov    %rax,%rdx
+  803faf:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803fb6:	48 01 d0             	add    %rdx,%rax
+  803fb9:	8b 00                	mov    (%rax),%eax
+  803fbb:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803fc2:	48 89 d6             	mov    %rdx,%rsi
+  803fc5:	89 c7                	mov    %eax,%edi
+  803fc7:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+  803fd3:	85 c0                	test   %eax,%eax
+  803fd5:	78 25                	js     803ffc <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803fd7:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803fde:	8b 00                	mov    (%rax),%eax
+  803fe0:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803fe7:	48 89 d6             	mov    %rdx,%rsi
+  803fea:	89 c7                	mov    %eax,%edi
+  803fec:	48 b8 9f 35 80 00 00 	movabs $0x80359f,%rax
+  803ff3:	00 00 00 
+  803ff6:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803ff8:	85 c0                	test   %eax,%eax
+  803ffa:	79 2c                	jns    804028 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803ffc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803fff:	48 63 d0             	movslq %eax,%rdx
+  804002:	48 89 d0             	mov    %rdx,%rax
+  804005:	48 01 c0             	add    %rax,%rax
+  804008:	48 01 d0             	add    %rdx,%rax
+  80400b:	48 c1 e0 02          	shl    $0x2,%rax
+  80400f:	48 89 c2             	mov    %rax,%rdx
+  804012:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804019:	48 01 d0             	add    %rdx,%rax
+  80401c:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  804023:	e9 d8 00 00 00       	jmp    804100 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  804028:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80402f:	48 8b 40 38          	mov    0x38(%rax),%rax
+  804033:	48 85 c0             	test   %rax,%rax
+  804036:	74 7d                	je     8040b5 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  804038:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80403f:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  804043:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804046:	48 63 d0             	movslq %eax,%rdx
+  804049:	48 89 d0             	mov    %rdx,%rax
+  80404c:	48 01 c0             	add    %rax,%rax
+  80404f:	48 01 d0             	add    %rdx,%rax
+  804052:	48 c1 e0 02          	shl    $0x2,%rax
+  804056:	48 89 c2             	mov    %rax,%rdx
+  804059:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  804060:	48 01 d0             	add    %rdx,%rax
+  804063:	8b 48 04             	mov    0x4(%rax),%ecx
+  804066:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80406d:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  804074:	89 ce                	mov    %ecx,%esi
+  804076:	48 89 c7             	mov    %rax,%rdi
+  804079:	41 ff d0             	call   *%r8
+  80407c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  80407f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  804083:	79 08                	jns    80408d <poll+0x242>
+          return r;
+  804085:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804088:	e9 45 01 00 00       	jmp    8041d2 <poll+0x387>
+        fds[i].revents = r;
+  80408d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804090:	48 63 d0             	movslq %eax,%rdx
+  804093:	48 89 d0             	mov    %rdx,%rax
+  804096:	48 01 c0             	add    %rax,%rax
+  804099:	48 01 d0             	add    %rdx,%rax
+  80409c:	48 c1 e0 02          	shl    $0x2,%rax
+  8040a0:	48 89 c2             	mov    %rax,%rdx
+  8040a3:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040aa:	48 01 c2             	add    %rax,%rdx
+  8040ad:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040b0:	89 42 08             	mov    %eax,0x8(%rdx)
+  8040b3:	eb 4b                	jmp    804100 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  8040b5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040b8:	48 63 d0             	movslq %eax,%rdx
+  8040bb:	48 89 d0             	mov    %rdx,%rax
+  8040be:	48 01 c0             	add    %rax,%rax
+  8040c1:	48 01 d0             	add    %rdx,%rax
+  8040c4:	48 c1 e0 02          	shl    $0x2,%rax
+  8040c8:	48 89 c2             	mov    %rax,%rdx
+  8040cb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040d2:	48 01 d0             	add    %rdx,%rax
+  8040d5:	8b 48 04             	mov    0x4(%rax),%ecx
+  8040d8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040db:	48 63 d0             	movslq %eax,%rdx
+  8040de:	48 89 d0             	mov    %rdx,%rax
+  8040e1:	48 01 c0             	add    %rax,%rax
+  8040e4:	48 01 d0             	add    %rdx,%rax
+  8040e7:	48 c1 e0 02          	shl    $0x2,%rax
+  8040eb:	48 89 c2             	mov    %rax,%rdx
+  8040ee:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8040f5:	48 01 d0             	add    %rdx,%rax
+  8040f8:	83 e1 03             	and    $0x3,%ecx
+  8040fb:	89 ca                	mov    %ecx,%edx
+  8040fd:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  804100:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804103:	48 63 d0             	movslq %eax,%rdx
+  804106:	48 89 d0             	mov    %rdx,%rax
+  804109:	48 01 c0             	add    %rax,%rax
+  80410c:	48 01 d0             	add    %rdx,%rax
+  80410f:	48 c1 e0 02          	shl    $0x2,%rax
+  804113:	48 89 c2             	mov    %rax,%rdx
+  804116:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80411d:	48 01 d0             	add    %rdx,%rax
+  804120:	8b 40 08             	mov    0x8(%rax),%eax
+  804123:	85 c0                	test   %eax,%eax
+  804125:	74 04                	je     80412b <poll+0x2e0>
+        ready++;
+  804127:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80412b:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80412f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804132:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  804138:	0f 8c ab fd ff ff    	jl     803ee9 <poll+0x9e>
+    }
+    if (ready)
+  80413e:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  804142:	74 08                	je     80414c <poll+0x301>
+      return ready;
+  804144:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  804147:	e9 86 00 00 00       	jmp    8041d2 <poll+0x387>
+
+    if (deadline) {
+  80414c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804151:	74 30                	je     804183 <poll+0x338>
+      now     = vsys_clock_ns();
+  804153:	48 b8 a2 5d 80 00 00 	movabs $0x805da2,%rax
+  80415a:	00 00 00 
+  80415d:	ff d0                	call   *%rax
+  80415f:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  804163:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804167:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80416b:	73 0a                	jae    804177 <poll+0x32c>
+  80416d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804171:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  804175:	eb 05                	jmp    80417c <poll+0x331>
+  804177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80417c:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  804183:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  804186:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  804189:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  804190:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  804197:	48 89 c7             	mov    %rax,%rdi
+  80419a:	48 b8 4f 28 80 00 00 	movabs $0x80284f,%rax
+  8041a1:	00 00 00 
+  8041a4:	ff d0                	call   *%rax
+  8041a6:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  8041a9:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  8041ad:	75 07                	jne    8041b6 <poll+0x36b>
+      return 0;
+  8041af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b4:	eb 1c                	jmp    8041d2 <poll+0x387>
+    if (r < 0)
+  8041b6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8041ba:	79 05                	jns    8041c1 <poll+0x376>
+      return r;
+  8041bc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041bf:	eb 11                	jmp    8041d2 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  8041c1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8041c4:	c1 f8 02             	sar    $0x2,%eax
+  8041c7:	83 e0 01             	and    $0x1,%eax
+  8041ca:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  8041cd:	e9 f6 fc ff ff       	jmp    803ec8 <poll+0x7d>
+  }
+}
+  8041d2:	c9                   	leave
+  8041d3:	c3                   	ret
+
+00000000008041d4 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8041d4:	55                   	push   %rbp
+  8041d5:	48 89 e5             	mov    %rsp,%rbp
+  8041d8:	48 83 ec 20          	sub    $0x20,%rsp
+  8041dc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8041e0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8041e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8041ed:	48 89 c7             	mov    %rax,%rdi
+  8041f0:	48 b8 c2 42 80 00 00 	movabs $0x8042c2,%rax
+  8041f7:	00 00 00 
+  8041fa:	ff d0                	call   *%rax
+  8041fc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041ff:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804203:	79 05                	jns    80420a <stat+0x36>
+    return fd;
+  804205:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804208:	eb 2f                	jmp    804239 <stat+0x65>
+  r = fstat(fd, stat);
+  80420a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80420e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804211:	48 89 d6             	mov    %rdx,%rsi
+  804214:	89 c7                	mov    %eax,%edi
+  804216:	48 b8 0b 3d 80 00 00 	movabs $0x803d0b,%rax
+  80421d:	00 00 00 
+  804220:	ff d0                	call   *%rax
+  804222:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  804225:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804228:	89 c7                	mov    %eax,%edi
+  80422a:	48 b8 73 36 80 00 00 	movabs $0x803673,%rax
+  804231:	00 00 00 
+  804234:	ff d0                	call   *%rax
+  return r;
+  804236:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804239:	c9                   	leave
+  80423a:	c3                   	ret
+
+000000000080423b <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  80423b:	55                   	push   %rbp
+  80423c:	48 89 e5             	mov    %rsp,%rbp
+  80423f:	48 83 ec 10          	sub    $0x10,%rsp
+  804243:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  804246:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  80424a:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  804251:	00 00 00 
+  804254:	8b 00                	mov    (%rax),%eax
+  804256:	85 c0                	test   %eax,%eax
+  804258:	75 1d                	jne    804277 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  80425a:	bf 03 00 00 00       	mov    $0x3,%edi
+  80425f:	48 b8 23 65 80 00 00 	movabs $0x806523,%rax
+  804266:	00 00 00 
+  804269:	ff d0                	call   *%rax
+  80426b:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  804272:	00 00 00 
+  804275:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  804277:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  80427e:	00 00 00 
+  804281:	8b 00                	mov    (%rax),%eax
+  804283:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  804286:	b9 07 00 00 00       	mov    $0x7,%ecx
+  80428b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804292:	00 00 00 
+  804295:	89 c7                	mov    %eax,%edi
+  804297:	48 b8 76 64 80 00 00 	movabs $0x806476,%rax
+  80429e:	00 00 00 
+  8042a1:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  8042a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ac:	48 89 c6             	mov    %rax,%rsi
+  8042af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042b4:	48 b8 f9 62 80 00 00 	movabs $0x8062f9,%rax
+  8042bb:	00 00 00 
+  8042be:	ff d0                	call   *%rax
+}
+  8042c0:	c9                   	leave
+  8042c1:	c3                   	ret
+
+00000000008042c2 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  8042c2:	55                   	push   %rbp
+  8042c3:	48 89 e5             	mov    %rsp,%rbp
+  8042c6:	48 83 ec 20          	sub    $0x20,%rsp
+  8042ca:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8042ce:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  8042d1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042d5:	48 89 c7             	mov    %rax,%rdi
+  8042d8:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  8042df:	00 00 00 
+  8042e2:	ff d0                	call   *%rax
+  8042e4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8042e9:	7e 0a                	jle    8042f5 <open+0x33>
+    return -E_BAD_PATH;
+  8042eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8042f0:	e9 a8 00 00 00       	jmp    80439d <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  8042f5:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8042f9:	48 89 c7             	mov    %rax,%rdi
+  8042fc:	48 b8 1c 33 80 00 00 	movabs $0x80331c,%rax
+  804303:	00 00 00 
+  804306:	ff d0                	call   *%rax
+  804308:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80430b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80430f:	79 08                	jns    804319 <open+0x57>
+    return r;
+  804311:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804314:	e9 84 00 00 00       	jmp    80439d <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  804319:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80431d:	48 89 c6             	mov    %rax,%rsi
+  804320:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804327:	00 00 00 
+  80432a:	48 89 c7             	mov    %rax,%rdi
+  80432d:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  804334:	00 00 00 
+  804337:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  804339:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804340:	00 00 00 
+  804343:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804346:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80434c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804350:	48 89 c6             	mov    %rax,%rsi
+  804353:	bf 01 00 00 00       	mov    $0x1,%edi
+  804358:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  80435f:	00 00 00 
+  804362:	ff d0                	call   *%rax
+  804364:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804367:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80436b:	79 1d                	jns    80438a <open+0xc8>
+    fd_close(fd, 0);
+  80436d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804371:	be 00 00 00 00       	mov    $0x0,%esi
+  804376:	48 89 c7             	mov    %rax,%rdi
+  804379:	48 b8 d4 34 80 00 00 	movabs $0x8034d4,%rax
+  804380:	00 00 00 
+  804383:	ff d0                	call   *%rax
+    return r;
+  804385:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804388:	eb 13                	jmp    80439d <open+0xdb>
+  }
+
+  return fd2num(fd);
+  80438a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80438e:	48 89 c7             	mov    %rax,%rdi
+  804391:	48 b8 ce 32 80 00 00 	movabs $0x8032ce,%rax
+  804398:	00 00 00 
+  80439b:	ff d0                	call   *%rax
+}
+  80439d:	c9                   	leave
+  80439e:	c3                   	ret
+
+000000000080439f <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  80439f:	55                   	push   %rbp
+  8043a0:	48 89 e5             	mov    %rsp,%rbp
+  8043a3:	48 83 ec 10          	sub    $0x10,%rsp
+  8043a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8043ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8043af:	8b 40 0c             	mov    0xc(%rax),%eax
+  8043b2:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8043b9:	00 00 00 
+  8043bc:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  8043be:	be 00 00 00 00       	mov    $0x0,%esi
+  8043c3:	bf 06 00 00 00       	mov    $0x6,%edi
+  8043c8:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  8043cf:	00 00 00 
+  8043d2:	ff d0                	call   *%rax
+}
+  8043d4:	c9                   	leave
+  8043d5:	c3                   	ret
+
+00000000008043d6 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8043d6:	55                   	push   %rbp
+  8043d7:	48 89 e5             	mov    %rsp,%rbp
+  8043da:	48 83 ec 30          	sub    $0x30,%rsp
+  8043de:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8043e2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8043e6:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8043ea:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8043ef:	74 07                	je     8043f8 <devfile_read+0x22>
+  8043f1:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8043f6:	75 0a                	jne    804402 <devfile_read+0x2c>
+  return E_INVAL;
+  8043f8:	b8 03 00 00 00       	mov    $0x3,%eax
+  8043fd:	e9 b4 00 00 00       	jmp    8044b6 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  804402:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804409:	00 
+  while (n) {
+  80440a:	e9 98 00 00 00       	jmp    8044a7 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80440f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804413:	8b 40 0c             	mov    0xc(%rax),%eax
+  804416:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80441d:	00 00 00 
+  804420:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  804422:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804429:	00 00 00 
+  80442c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804430:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  804434:	be 00 00 00 00       	mov    $0x0,%esi
+  804439:	bf 03 00 00 00       	mov    $0x3,%edi
+  80443e:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  804445:	00 00 00 
+  804448:	ff d0                	call   *%rax
+  80444a:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  80444d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804451:	7f 13                	jg     804466 <devfile_read+0x90>
+      return res ? res : res0;
+  804453:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804457:	74 07                	je     804460 <devfile_read+0x8a>
+  804459:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80445c:	48 98                	cltq
+  80445e:	eb 56                	jmp    8044b6 <devfile_read+0xe0>
+  804460:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804464:	eb 50                	jmp    8044b6 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  804466:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804469:	48 63 d0             	movslq %eax,%rdx
+  80446c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804470:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804477:	00 00 00 
+  80447a:	48 89 ce             	mov    %rcx,%rsi
+  80447d:	48 89 c7             	mov    %rax,%rdi
+  804480:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  804487:	00 00 00 
+  80448a:	ff d0                	call   *%rax
+
+    buf += res;
+  80448c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80448f:	48 98                	cltq
+  804491:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  804495:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804498:	48 98                	cltq
+  80449a:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  80449e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8044a1:	48 98                	cltq
+  8044a3:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  8044a7:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8044ac:	0f 85 5d ff ff ff    	jne    80440f <devfile_read+0x39>
+  }
+
+  return res0;
+  8044b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  8044b6:	c9                   	leave
+  8044b7:	c3                   	ret
+
+00000000008044b8 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8044b8:	55                   	push   %rbp
+  8044b9:	48 89 e5             	mov    %rsp,%rbp
+  8044bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8044c0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8044c4:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  8044c8:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  8044cc:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8044d1:	74 07                	je     8044da <devfile_write+0x22>
+  8044d3:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8044d8:	75 0a                	jne    8044e4 <devfile_write+0x2c>
+  return E_INVAL;
+  8044da:	b8 03 00 00 00       	mov    $0x3,%eax
+  8044df:	e9 c9 00 00 00       	jmp    8045ad <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  8044e4:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8044eb:	00 
+
+  while (n) {
+  8044ec:	e9 ad 00 00 00       	jmp    80459e <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  8044f1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8044f5:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8044f9:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  804500:	00 
+  804501:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804505:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804509:	48 39 c2             	cmp    %rax,%rdx
+  80450c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804510:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  804514:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804518:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80451c:	48 89 c6             	mov    %rax,%rsi
+  80451f:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  804526:	00 00 00 
+  804529:	48 89 c7             	mov    %rax,%rdi
+  80452c:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  804533:	00 00 00 
+  804536:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  804538:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80453c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80453f:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804546:	00 00 00 
+  804549:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  80454b:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804552:	00 00 00 
+  804555:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804559:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  80455d:	be 00 00 00 00       	mov    $0x0,%esi
+  804562:	bf 04 00 00 00       	mov    $0x4,%edi
+  804567:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  80456e:	00 00 00 
+  804571:	ff d0                	call   *%rax
+  804573:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  804576:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80457a:	79 07                	jns    804583 <devfile_write+0xcb>
+      return res;
+  80457c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80457f:	48 98                	cltq
+  804581:	eb 2a                	jmp    8045ad <devfile_write+0xf5>
+
+    buf += res;
+  804583:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804586:	48 98                	cltq
+  804588:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  80458c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80458f:	48 98                	cltq
+  804591:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  804595:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804598:	48 98                	cltq
+  80459a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  80459e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  8045a3:	0f 85 48 ff ff ff    	jne    8044f1 <devfile_write+0x39>
+  }
+
+  return res0;
+  8045a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  8045ad:	c9                   	leave
+  8045ae:	c3                   	ret
+
+00000000008045af <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8045af:	55                   	push   %rbp
+  8045b0:	48 89 e5             	mov    %rsp,%rbp
+  8045b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8045b7:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8045bb:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8045bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8045c3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8045c6:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8045cd:	00 00 00 
+  8045d0:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8045d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8045d7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8045dc:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  8045e3:	00 00 00 
+  8045e6:	ff d0                	call   *%rax
+  8045e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8045eb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8045ef:	79 05                	jns    8045f6 <devfile_stat+0x47>
+    return r;
+  8045f1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8045f4:	eb 59                	jmp    80464f <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8045f6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8045fa:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804601:	00 00 00 
+  804604:	48 89 d6             	mov    %rdx,%rsi
+  804607:	48 89 c7             	mov    %rax,%rdi
+  80460a:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  804611:	00 00 00 
+  804614:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804616:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  80461d:	00 00 00 
+  804620:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804626:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80462a:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804630:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  804637:	00 00 00 
+  80463a:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804640:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804644:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  80464a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80464f:	c9                   	leave
+  804650:	c3                   	ret
+
+0000000000804651 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804651:	55                   	push   %rbp
+  804652:	48 89 e5             	mov    %rsp,%rbp
+  804655:	48 83 ec 10          	sub    $0x10,%rsp
+  804659:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80465d:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804664:	8b 40 0c             	mov    0xc(%rax),%eax
+  804667:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80466e:	00 00 00 
+  804671:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804673:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80467a:	00 00 00 
+  80467d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804680:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804683:	be 00 00 00 00       	mov    $0x0,%esi
+  804688:	bf 02 00 00 00       	mov    $0x2,%edi
+  80468d:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  804694:	00 00 00 
+  804697:	ff d0                	call   *%rax
+}
+  804699:	c9                   	leave
+  80469a:	c3                   	ret
+
+000000000080469b <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80469b:	55                   	push   %rbp
+  80469c:	48 89 e5             	mov    %rsp,%rbp
+  80469f:	48 83 ec 18          	sub    $0x18,%rsp
+  8046a3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8046a7:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8046aa:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8046ae:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8046b1:	83 e0 03             	and    $0x3,%eax
+}
+  8046b4:	c9                   	leave
+  8046b5:	c3                   	ret
+
+00000000008046b6 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8046b6:	55                   	push   %rbp
+  8046b7:	48 89 e5             	mov    %rsp,%rbp
+  8046ba:	48 83 ec 10          	sub    $0x10,%rsp
+  8046be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8046c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046c6:	48 89 c7             	mov    %rax,%rdi
+  8046c9:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  8046d0:	00 00 00 
+  8046d3:	ff d0                	call   *%rax
+  8046d5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8046da:	7e 07                	jle    8046e3 <remove+0x2d>
+    return -E_BAD_PATH;
+  8046dc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8046e1:	eb 36                	jmp    804719 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8046e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046e7:	48 89 c6             	mov    %rax,%rsi
+  8046ea:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  8046f1:	00 00 00 
+  8046f4:	48 89 c7             	mov    %rax,%rdi
+  8046f7:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  8046fe:	00 00 00 
+  804701:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804703:	be 00 00 00 00       	mov    $0x0,%esi
+  804708:	bf 07 00 00 00       	mov    $0x7,%edi
+  80470d:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  804714:	00 00 00 
+  804717:	ff d0                	call   *%rax
+}
+  804719:	c9                   	leave
+  80471a:	c3                   	ret
+
+000000000080471b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80471b:	55                   	push   %rbp
+  80471c:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80471f:	be 00 00 00 00       	mov    $0x0,%esi
+  804724:	bf 08 00 00 00       	mov    $0x8,%edi
+  804729:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  804730:	00 00 00 
+  804733:	ff d0                	call   *%rax
+}
+  804735:	5d                   	pop    %rbp
+  804736:	c3                   	ret
+
+0000000000804737 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804737:	55                   	push   %rbp
+  804738:	48 89 e5             	mov    %rsp,%rbp
+  80473b:	48 83 ec 20          	sub    $0x20,%rsp
+  80473f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804743:	be 00 00 00 00       	mov    $0x0,%esi
+  804748:	bf 09 00 00 00       	mov    $0x9,%edi
+  80474d:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  804754:	00 00 00 
+  804757:	ff d0                	call   *%rax
+  804759:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80475c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804760:	79 05                	jns    804767 <fs_stats+0x30>
+    return r;
+  804762:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804765:	eb 2a                	jmp    804791 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804767:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80476b:	ba 68 00 00 00       	mov    $0x68,%edx
+  804770:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  804777:	00 00 00 
+  80477a:	48 89 ce             	mov    %rcx,%rsi
+  80477d:	48 89 c7             	mov    %rax,%rdi
+  804780:	48 b8 7c 1b 80 00 00 	movabs $0x801b7c,%rax
+  804787:	00 00 00 
+  80478a:	ff d0                	call   *%rax
+  return 0;
+  80478c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804791:	c9                   	leave
+  804792:	c3                   	ret
+
+0000000000804793 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804793:	55                   	push   %rbp
+  804794:	48 89 e5             	mov    %rsp,%rbp
+  804797:	48 83 ec 10          	sub    $0x10,%rsp
+  80479b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  80479e:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047a5:	00 00 00 
+  8047a8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8047ab:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  8047ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8047b2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8047b7:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  8047be:	00 00 00 
+  8047c1:	ff d0                	call   *%rax
+}
+  8047c3:	c9                   	leave
+  8047c4:	c3                   	ret
+
+00000000008047c5 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8047c5:	55                   	push   %rbp
+  8047c6:	48 89 e5             	mov    %rsp,%rbp
+  8047c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8047cd:	89 f8                	mov    %edi,%eax
+  8047cf:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8047d2:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8047d6:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  8047dd:	00 00 00 
+  8047e0:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8047e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8047e7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8047ec:	48 b8 3b 42 80 00 00 	movabs $0x80423b,%rax
+  8047f3:	00 00 00 
+  8047f6:	ff d0                	call   *%rax
+}
+  8047f8:	c9                   	leave
+  8047f9:	c3                   	ret
+
+00000000008047fa <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8047fa:	55                   	push   %rbp
+  8047fb:	48 89 e5             	mov    %rsp,%rbp
+  8047fe:	48 83 ec 10          	sub    $0x10,%rsp
+  804802:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804806:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80480a:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  80480f:	48 89 c7             	mov    %rax,%rdi
+  804812:	48 b8 20 48 80 00 00 	movabs $0x804820,%rax
+  804819:	00 00 00 
+  80481c:	ff d0                	call   *%rax
+}
+  80481e:	c9                   	leave
+  80481f:	c3                   	ret
+
+0000000000804820 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804820:	55                   	push   %rbp
+  804821:	48 89 e5             	mov    %rsp,%rbp
+  804824:	48 83 ec 50          	sub    $0x50,%rsp
+  804828:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80482c:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804830:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804837:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804838:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  80483d:	74 0a                	je     804849 <pipe_size+0x29>
+  80483f:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804846:	00 
+  804847:	76 0a                	jbe    804853 <pipe_size+0x33>
+    return -E_INVAL;
+  804849:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80484e:	e9 cc 02 00 00       	jmp    804b1f <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804853:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804857:	48 89 c7             	mov    %rax,%rdi
+  80485a:	48 b8 1c 33 80 00 00 	movabs $0x80331c,%rax
+  804861:	00 00 00 
+  804864:	ff d0                	call   *%rax
+  804866:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804869:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80486d:	0f 88 a8 02 00 00    	js     804b1b <pipe_size+0x2fb>
+  804873:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804877:	ba 07 04 00 00       	mov    $0x407,%edx
+  80487c:	48 89 c6             	mov    %rax,%rsi
+  80487f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804884:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  80488b:	00 00 00 
+  80488e:	ff d0                	call   *%rax
+  804890:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804893:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804897:	0f 88 7e 02 00 00    	js     804b1b <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80489d:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8048a1:	48 89 c7             	mov    %rax,%rdi
+  8048a4:	48 b8 1c 33 80 00 00 	movabs $0x80331c,%rax
+  8048ab:	00 00 00 
+  8048ae:	ff d0                	call   *%rax
+  8048b0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048b3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048b7:	0f 88 43 02 00 00    	js     804b00 <pipe_size+0x2e0>
+  8048bd:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8048c1:	ba 07 04 00 00       	mov    $0x407,%edx
+  8048c6:	48 89 c6             	mov    %rax,%rsi
+  8048c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048ce:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  8048d5:	00 00 00 
+  8048d8:	ff d0                	call   *%rax
+  8048da:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8048dd:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048e1:	0f 88 19 02 00 00    	js     804b00 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8048e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8048eb:	48 89 c7             	mov    %rax,%rdi
+  8048ee:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  8048f5:	00 00 00 
+  8048f8:	ff d0                	call   *%rax
+  8048fa:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8048fe:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804905:	00 
+  804906:	e9 a2 00 00 00       	jmp    8049ad <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80490b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80490f:	48 c1 e0 0c          	shl    $0xc,%rax
+  804913:	48 89 c2             	mov    %rax,%rdx
+  804916:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80491a:	48 01 d0             	add    %rdx,%rax
+  80491d:	ba 07 04 00 00       	mov    $0x407,%edx
+  804922:	48 89 c6             	mov    %rax,%rsi
+  804925:	bf 00 00 00 00       	mov    $0x0,%edi
+  80492a:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  804931:	00 00 00 
+  804934:	ff d0                	call   *%rax
+  804936:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804939:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80493d:	0f 88 37 01 00 00    	js     804a7a <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804943:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804947:	48 89 c7             	mov    %rax,%rdi
+  80494a:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  804951:	00 00 00 
+  804954:	ff d0                	call   *%rax
+  804956:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80495a:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80495e:	48 01 c2             	add    %rax,%rdx
+  804961:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804965:	48 c1 e0 0c          	shl    $0xc,%rax
+  804969:	48 89 c1             	mov    %rax,%rcx
+  80496c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804970:	48 01 c8             	add    %rcx,%rax
+  804973:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  804979:	48 89 d1             	mov    %rdx,%rcx
+  80497c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804981:	48 89 c6             	mov    %rax,%rsi
+  804984:	bf 00 00 00 00       	mov    $0x0,%edi
+  804989:	48 b8 5f 24 80 00 00 	movabs $0x80245f,%rax
+  804990:	00 00 00 
+  804993:	ff d0                	call   *%rax
+  804995:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804998:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80499c:	79 0a                	jns    8049a8 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  80499e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8049a3:	e9 d3 00 00 00       	jmp    804a7b <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8049a8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8049ad:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8049b4:	00 
+  8049b5:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8049b9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8049bd:	48 01 d0             	add    %rdx,%rax
+  8049c0:	48 83 c0 1f          	add    $0x1f,%rax
+  8049c4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8049c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049d1:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8049d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8049d9:	48 29 d0             	sub    %rdx,%rax
+  8049dc:	48 c1 e8 0c          	shr    $0xc,%rax
+  8049e0:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8049e4:	0f 82 21 ff ff ff    	jb     80490b <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8049ea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049ee:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8049f2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8049f6:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8049fa:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8049fe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a02:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a09:	00 00 00 
+  804a0c:	8b 12                	mov    (%rdx),%edx
+  804a0e:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804a10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a14:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  804a1b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a1f:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804a26:	00 00 00 
+  804a29:	8b 12                	mov    (%rdx),%edx
+  804a2b:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  804a2d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a31:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804a38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804a3c:	48 89 c7             	mov    %rax,%rdi
+  804a3f:	48 b8 ce 32 80 00 00 	movabs $0x8032ce,%rax
+  804a46:	00 00 00 
+  804a49:	ff d0                	call   *%rax
+  804a4b:	89 c2                	mov    %eax,%edx
+  804a4d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804a51:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804a53:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804a57:	48 89 c7             	mov    %rax,%rdi
+  804a5a:	48 b8 ce 32 80 00 00 	movabs $0x8032ce,%rax
+  804a61:	00 00 00 
+  804a64:	ff d0                	call   *%rax
+  804a66:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a6a:	48 83 c2 04          	add    $0x4,%rdx
+  804a6e:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804a70:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a75:	e9 a5 00 00 00       	jmp    804b1f <pipe_size+0x2ff>
+      goto err2;
+  804a7a:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  804a7b:	eb 58                	jmp    804ad5 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  804a7d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a81:	48 c1 e0 0c          	shl    $0xc,%rax
+  804a85:	48 89 c2             	mov    %rax,%rdx
+  804a88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a8c:	48 01 d0             	add    %rdx,%rax
+  804a8f:	48 89 c6             	mov    %rax,%rsi
+  804a92:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a97:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  804a9e:	00 00 00 
+  804aa1:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804aa3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aa7:	48 89 c7             	mov    %rax,%rdi
+  804aaa:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  804ab1:	00 00 00 
+  804ab4:	ff d0                	call   *%rax
+  804ab6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804aba:	48 c1 e2 0c          	shl    $0xc,%rdx
+  804abe:	48 01 d0             	add    %rdx,%rax
+  804ac1:	48 89 c6             	mov    %rax,%rsi
+  804ac4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ac9:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  804ad0:	00 00 00 
+  804ad3:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804ad5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ad9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804add:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804ae1:	48 85 c0             	test   %rax,%rax
+  804ae4:	75 97                	jne    804a7d <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804ae6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804aea:	48 89 c6             	mov    %rax,%rsi
+  804aed:	bf 00 00 00 00       	mov    $0x0,%edi
+  804af2:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  804af9:	00 00 00 
+  804afc:	ff d0                	call   *%rax
+  804afe:	eb 01                	jmp    804b01 <pipe_size+0x2e1>
+    goto err1;
+  804b00:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804b01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b05:	48 89 c6             	mov    %rax,%rsi
+  804b08:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b0d:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  804b14:	00 00 00 
+  804b17:	ff d0                	call   *%rax
+  804b19:	eb 01                	jmp    804b1c <pipe_size+0x2fc>
+    goto err;
+  804b1b:	90                   	nop
+err:
+  return r;
+  804b1c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804b1f:	c9                   	leave
+  804b20:	c3                   	ret
+
+0000000000804b21 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804b21:	55                   	push   %rbp
+  804b22:	48 89 e5             	mov    %rsp,%rbp
+  804b25:	53                   	push   %rbx
+  804b26:	48 83 ec 28          	sub    $0x28,%rsp
+  804b2a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804b2e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804b32:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b39:	00 00 00 
+  804b3c:	8b 40 04             	mov    0x4(%rax),%eax
+  804b3f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804b44:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804b4b:	00 00 00 
+  804b4e:	48 98                	cltq
+  804b50:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804b57:	48 01 d0             	add    %rdx,%rax
+  804b5a:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804b60:	8b 00                	mov    (%rax),%eax
+  804b62:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804b65:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b69:	48 89 c7             	mov    %rax,%rdi
+  804b6c:	48 b8 94 65 80 00 00 	movabs $0x806594,%rax
+  804b73:	00 00 00 
+  804b76:	ff d0                	call   *%rax
+  804b78:	89 c3                	mov    %eax,%ebx
+  804b7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804b7e:	48 89 c7             	mov    %rax,%rdi
+  804b81:	48 b8 94 65 80 00 00 	movabs $0x806594,%rax
+  804b88:	00 00 00 
+  804b8b:	ff d0                	call   *%rax
+  804b8d:	39 c3                	cmp    %eax,%ebx
+  804b8f:	0f 94 c0             	sete   %al
+  804b92:	0f b6 c0             	movzbl %al,%eax
+  804b95:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804b98:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804b9f:	00 00 00 
+  804ba2:	8b 40 04             	mov    0x4(%rax),%eax
+  804ba5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804baa:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bb1:	00 00 00 
+  804bb4:	48 98                	cltq
+  804bb6:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804bbd:	48 01 d0             	add    %rdx,%rax
+  804bc0:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804bc6:	8b 00                	mov    (%rax),%eax
+  804bc8:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804bcb:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bce:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804bd1:	75 05                	jne    804bd8 <_pipeisclosed+0xb7>
+      return ret;
+  804bd3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804bd6:	eb 68                	jmp    804c40 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804bd8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804bdb:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804bde:	0f 84 4e ff ff ff    	je     804b32 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804be4:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804beb:	00 00 00 
+  804bee:	8b 40 04             	mov    0x4(%rax),%eax
+  804bf1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804bf6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804bfd:	00 00 00 
+  804c00:	48 98                	cltq
+  804c02:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804c09:	48 01 d0             	add    %rdx,%rax
+  804c0c:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804c12:	8b 10                	mov    (%rax),%edx
+  804c14:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804c17:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804c1a:	89 c6                	mov    %eax,%esi
+  804c1c:	48 b8 b0 6e 80 00 00 	movabs $0x806eb0,%rax
+  804c23:	00 00 00 
+  804c26:	48 89 c7             	mov    %rax,%rdi
+  804c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c2e:	49 b8 89 06 80 00 00 	movabs $0x800689,%r8
+  804c35:	00 00 00 
+  804c38:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  804c3b:	e9 f2 fe ff ff       	jmp    804b32 <_pipeisclosed+0x11>
+  }
+}
+  804c40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c44:	c9                   	leave
+  804c45:	c3                   	ret
+
+0000000000804c46 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804c46:	55                   	push   %rbp
+  804c47:	48 89 e5             	mov    %rsp,%rbp
+  804c4a:	48 83 ec 30          	sub    $0x30,%rsp
+  804c4e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804c51:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804c55:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804c58:	48 89 d6             	mov    %rdx,%rsi
+  804c5b:	89 c7                	mov    %eax,%edi
+  804c5d:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  804c64:	00 00 00 
+  804c67:	ff d0                	call   *%rax
+  804c69:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804c6c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804c70:	79 05                	jns    804c77 <pipeisclosed+0x31>
+    return r;
+  804c72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804c75:	eb 31                	jmp    804ca8 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804c77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c7b:	48 89 c7             	mov    %rax,%rdi
+  804c7e:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  804c85:	00 00 00 
+  804c88:	ff d0                	call   *%rax
+  804c8a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804c8e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c92:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c96:	48 89 d6             	mov    %rdx,%rsi
+  804c99:	48 89 c7             	mov    %rax,%rdi
+  804c9c:	48 b8 21 4b 80 00 00 	movabs $0x804b21,%rax
+  804ca3:	00 00 00 
+  804ca6:	ff d0                	call   *%rax
+}
+  804ca8:	c9                   	leave
+  804ca9:	c3                   	ret
+
+0000000000804caa <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804caa:	55                   	push   %rbp
+  804cab:	48 89 e5             	mov    %rsp,%rbp
+  804cae:	48 83 ec 10          	sub    $0x10,%rsp
+  804cb2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804cb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cba:	8b 40 18             	mov    0x18(%rax),%eax
+  804cbd:	8d 50 01             	lea    0x1(%rax),%edx
+  804cc0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cc4:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804cc7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ccb:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804cce:	85 c0                	test   %eax,%eax
+  804cd0:	74 27                	je     804cf9 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804cd2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cd6:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804cdd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ce1:	48 83 c0 18          	add    $0x18,%rax
+  804ce5:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804cea:	48 89 c7             	mov    %rax,%rdi
+  804ced:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  804cf4:	00 00 00 
+  804cf7:	ff d0                	call   *%rax
+  }
+}
+  804cf9:	90                   	nop
+  804cfa:	c9                   	leave
+  804cfb:	c3                   	ret
+
+0000000000804cfc <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804cfc:	55                   	push   %rbp
+  804cfd:	48 89 e5             	mov    %rsp,%rbp
+  804d00:	48 83 ec 10          	sub    $0x10,%rsp
+  804d04:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d08:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  804d0b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d0f:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804d16:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d1a:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  804d1e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804d21:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804d28:	89 c6                	mov    %eax,%esi
+  804d2a:	48 89 cf             	mov    %rcx,%rdi
+  804d2d:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  804d34:	00 00 00 
+  804d37:	ff d0                	call   *%rax
+}
+  804d39:	90                   	nop
+  804d3a:	c9                   	leave
+  804d3b:	c3                   	ret
+
+0000000000804d3c <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d3c:	55                   	push   %rbp
+  804d3d:	48 89 e5             	mov    %rsp,%rbp
+  804d40:	48 83 ec 70          	sub    $0x70,%rsp
+  804d44:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804d48:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804d4c:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804d50:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d54:	48 89 c7             	mov    %rax,%rdi
+  804d57:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  804d5e:	00 00 00 
+  804d61:	ff d0                	call   *%rax
+  804d63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804d67:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804d6c:	75 0a                	jne    804d78 <devpipe_read+0x3c>
+    return 0;
+  804d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d73:	e9 63 01 00 00       	jmp    804edb <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804d78:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d7c:	8b 40 18             	mov    0x18(%rax),%eax
+  804d7f:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804d82:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d86:	48 8b 10             	mov    (%rax),%rdx
+  804d89:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d8d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d91:	48 39 c2             	cmp    %rax,%rdx
+  804d94:	75 42                	jne    804dd8 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804d96:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804d9a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804d9e:	48 89 d6             	mov    %rdx,%rsi
+  804da1:	48 89 c7             	mov    %rax,%rdi
+  804da4:	48 b8 21 4b 80 00 00 	movabs $0x804b21,%rax
+  804dab:	00 00 00 
+  804dae:	ff d0                	call   *%rax
+  804db0:	85 c0                	test   %eax,%eax
+  804db2:	74 0a                	je     804dbe <devpipe_read+0x82>
+      return 0;
+  804db4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db9:	e9 1d 01 00 00       	jmp    804edb <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804dbe:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804dc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dc5:	89 d6                	mov    %edx,%esi
+  804dc7:	48 89 c7             	mov    %rax,%rdi
+  804dca:	48 b8 fc 4c 80 00 00 	movabs $0x804cfc,%rax
+  804dd1:	00 00 00 
+  804dd4:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804dd6:	eb a0                	jmp    804d78 <devpipe_read+0x3c>
+      break;
+  804dd8:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804dd9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804ddd:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804de1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804de5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804de9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ded:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804df1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804df5:	48 8b 00             	mov    (%rax),%rax
+  804df8:	48 29 c2             	sub    %rax,%rdx
+  804dfb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804dff:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804e03:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e07:	48 39 c2             	cmp    %rax,%rdx
+  804e0a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e0e:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804e12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e16:	48 8b 00             	mov    (%rax),%rax
+  804e19:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e1d:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804e21:	ba 00 00 00 00       	mov    $0x0,%edx
+  804e26:	48 f7 f1             	div    %rcx
+  804e29:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  804e2d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e31:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804e35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e39:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804e3d:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804e41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804e45:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  804e49:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804e4d:	48 39 c2             	cmp    %rax,%rdx
+  804e50:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804e54:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804e58:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804e5c:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804e60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804e64:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804e68:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e70:	48 89 ce             	mov    %rcx,%rsi
+  804e73:	48 89 c7             	mov    %rax,%rdi
+  804e76:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  804e7d:	00 00 00 
+  804e80:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804e82:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804e86:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804e8a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e8e:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804e92:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804e96:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804e9a:	48 01 d1             	add    %rdx,%rcx
+  804e9d:	48 89 c2             	mov    %rax,%rdx
+  804ea0:	48 89 cf             	mov    %rcx,%rdi
+  804ea3:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  804eaa:	00 00 00 
+  804ead:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804eaf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804eb3:	48 8b 10             	mov    (%rax),%rdx
+  804eb6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804eba:	48 01 c2             	add    %rax,%rdx
+  804ebd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ec1:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804ec4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ec8:	48 89 c7             	mov    %rax,%rdi
+  804ecb:	48 b8 aa 4c 80 00 00 	movabs $0x804caa,%rax
+  804ed2:	00 00 00 
+  804ed5:	ff d0                	call   *%rax
+  return n;
+  804ed7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804edb:	c9                   	leave
+  804edc:	c3                   	ret
+
+0000000000804edd <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804edd:	55                   	push   %rbp
+  804ede:	48 89 e5             	mov    %rsp,%rbp
+  804ee1:	48 83 ec 70          	sub    $0x70,%rsp
+  804ee5:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804ee9:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804eed:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804ef1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804ef5:	48 89 c7             	mov    %rax,%rdi
+  804ef8:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  804eff:	00 00 00 
+  804f02:	ff d0                	call   *%rax
+  804f04:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804f08:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804f0c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804f10:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804f17:	00 
+  804f18:	e9 b8 01 00 00       	jmp    8050d5 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  804f1d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f21:	8b 40 18             	mov    0x18(%rax),%eax
+  804f24:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804f27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f2b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f33:	48 8b 00             	mov    (%rax),%rax
+  804f36:	48 29 c2             	sub    %rax,%rdx
+  804f39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f3d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804f41:	48 39 c2             	cmp    %rax,%rdx
+  804f44:	75 4d                	jne    804f93 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804f46:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804f4a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804f4e:	48 89 d6             	mov    %rdx,%rsi
+  804f51:	48 89 c7             	mov    %rax,%rdi
+  804f54:	48 b8 21 4b 80 00 00 	movabs $0x804b21,%rax
+  804f5b:	00 00 00 
+  804f5e:	ff d0                	call   *%rax
+  804f60:	85 c0                	test   %eax,%eax
+  804f62:	74 0a                	je     804f6e <devpipe_write+0x91>
+        return 0;
+  804f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f69:	e9 79 01 00 00       	jmp    8050e7 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804f6e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804f71:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804f75:	89 d6                	mov    %edx,%esi
+  804f77:	48 89 c7             	mov    %rax,%rdi
+  804f7a:	48 b8 fc 4c 80 00 00 	movabs $0x804cfc,%rax
+  804f81:	00 00 00 
+  804f84:	ff d0                	call   *%rax
+      m = 0;
+  804f86:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804f8d:	00 
+      continue;
+  804f8e:	e9 3a 01 00 00       	jmp    8050cd <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804f93:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804f97:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804f9b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804f9f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fa3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804fa7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fab:	48 8b 08             	mov    (%rax),%rcx
+  804fae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fb2:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804fb6:	48 29 c1             	sub    %rax,%rcx
+  804fb9:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804fbd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804fc1:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804fc5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804fc9:	48 39 c2             	cmp    %rax,%rdx
+  804fcc:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804fd0:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804fd4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fd8:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804fdc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804fe0:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804fe4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804fe9:	48 f7 f1             	div    %rcx
+  804fec:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804ff0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ff4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804ff8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ffc:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805000:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805004:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  805008:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80500c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805010:	48 39 c2             	cmp    %rax,%rdx
+  805013:	48 0f 46 c2          	cmovbe %rdx,%rax
+  805017:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80501b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80501f:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  805023:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805027:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80502b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80502f:	48 01 d1             	add    %rdx,%rcx
+  805032:	48 89 c2             	mov    %rax,%rdx
+  805035:	48 89 cf             	mov    %rcx,%rdi
+  805038:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  80503f:	00 00 00 
+  805042:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  805044:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805048:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80504c:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805050:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  805054:	73 4d                	jae    8050a3 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  805056:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80505a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80505e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805062:	48 29 c2             	sub    %rax,%rdx
+  805065:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805069:	48 01 c2             	add    %rax,%rdx
+  80506c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805070:	48 8b 40 10          	mov    0x10(%rax),%rax
+  805074:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  805078:	48 89 c1             	mov    %rax,%rcx
+  80507b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80507f:	48 01 c1             	add    %rax,%rcx
+  805082:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805086:	48 01 c1             	add    %rax,%rcx
+  805089:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80508d:	48 83 c0 20          	add    $0x20,%rax
+  805091:	48 89 ce             	mov    %rcx,%rsi
+  805094:	48 89 c7             	mov    %rax,%rdi
+  805097:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  80509e:	00 00 00 
+  8050a1:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  8050a3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050a7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8050ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050af:	48 01 c2             	add    %rax,%rdx
+  8050b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050b6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  8050ba:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8050be:	48 89 c7             	mov    %rax,%rdi
+  8050c1:	48 b8 aa 4c 80 00 00 	movabs $0x804caa,%rax
+  8050c8:	00 00 00 
+  8050cb:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  8050cd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050d1:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  8050d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8050d9:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  8050dd:	0f 82 3a fe ff ff    	jb     804f1d <devpipe_write+0x40>
+  }
+
+  return i;
+  8050e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8050e7:	c9                   	leave
+  8050e8:	c3                   	ret
+
+00000000008050e9 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8050e9:	55                   	push   %rbp
+  8050ea:	48 89 e5             	mov    %rsp,%rbp
+  8050ed:	48 83 ec 40          	sub    $0x40,%rsp
+  8050f1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8050f5:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8050f8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8050fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805100:	48 89 c7             	mov    %rax,%rdi
+  805103:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  80510a:	00 00 00 
+  80510d:	ff d0                	call   *%rax
+  80510f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  805113:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80511a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80511e:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  805122:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805126:	48 89 d6             	mov    %rdx,%rsi
+  805129:	48 89 c7             	mov    %rax,%rdi
+  80512c:	48 b8 c4 3d 80 00 00 	movabs $0x803dc4,%rax
+  805133:	00 00 00 
+  805136:	ff d0                	call   *%rax
+  805138:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80513b:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80513f:	79 08                	jns    805149 <devpipe_poll+0x60>
+    return r;
+  805141:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805144:	e9 85 00 00 00       	jmp    8051ce <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  805149:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80514c:	83 e0 01             	and    $0x1,%eax
+  80514f:	85 c0                	test   %eax,%eax
+  805151:	74 18                	je     80516b <devpipe_poll+0x82>
+  805153:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805157:	48 8b 10             	mov    (%rax),%rdx
+  80515a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80515e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805162:	48 39 c2             	cmp    %rax,%rdx
+  805165:	74 04                	je     80516b <devpipe_poll+0x82>
+    revents |= POLLIN;
+  805167:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  80516b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80516e:	83 e0 02             	and    $0x2,%eax
+  805171:	85 c0                	test   %eax,%eax
+  805173:	74 23                	je     805198 <devpipe_poll+0xaf>
+  805175:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805179:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80517d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805181:	48 8b 00             	mov    (%rax),%rax
+  805184:	48 29 c2             	sub    %rax,%rdx
+  805187:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80518b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80518f:	48 39 c2             	cmp    %rax,%rdx
+  805192:	73 04                	jae    805198 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  805194:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  805198:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80519c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8051a0:	48 89 d6             	mov    %rdx,%rsi
+  8051a3:	48 89 c7             	mov    %rax,%rdi
+  8051a6:	48 b8 21 4b 80 00 00 	movabs $0x804b21,%rax
+  8051ad:	00 00 00 
+  8051b0:	ff d0                	call   *%rax
+  8051b2:	85 c0                	test   %eax,%eax
+  8051b4:	74 04                	je     8051ba <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  8051b6:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  8051ba:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8051be:	75 0b                	jne    8051cb <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  8051c0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8051c4:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  8051cb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8051ce:	c9                   	leave
+  8051cf:	c3                   	ret
+
+00000000008051d0 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8051d0:	55                   	push   %rbp
+  8051d1:	48 89 e5             	mov    %rsp,%rbp
+  8051d4:	48 83 ec 20          	sub    $0x20,%rsp
+  8051d8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051dc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8051e0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051e4:	48 89 c7             	mov    %rax,%rdi
+  8051e7:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  8051ee:	00 00 00 
+  8051f1:	ff d0                	call   *%rax
+  8051f3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  8051f7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051fb:	48 ba e1 6e 80 00 00 	movabs $0x806ee1,%rdx
+  805202:	00 00 00 
+  805205:	48 89 d6             	mov    %rdx,%rsi
+  805208:	48 89 c7             	mov    %rax,%rdi
+  80520b:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  805212:	00 00 00 
+  805215:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  805217:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80521b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80521f:	89 c1                	mov    %eax,%ecx
+  805221:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805225:	48 8b 00             	mov    (%rax),%rax
+  805228:	89 c2                	mov    %eax,%edx
+  80522a:	89 c8                	mov    %ecx,%eax
+  80522c:	29 d0                	sub    %edx,%eax
+  80522e:	89 c2                	mov    %eax,%edx
+  805230:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805234:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  80523a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80523e:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  805245:	00 00 00 
+  stat->st_dev   = &devpipe;
+  805248:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80524c:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  805253:	00 00 00 
+  805256:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  80525d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805262:	c9                   	leave
+  805263:	c3                   	ret
+
+0000000000805264 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  805264:	55                   	push   %rbp
+  805265:	48 89 e5             	mov    %rsp,%rbp
+  805268:	48 83 ec 40          	sub    $0x40,%rsp
+  80526c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805270:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805274:	48 89 c7             	mov    %rax,%rdi
+  805277:	48 b8 f1 32 80 00 00 	movabs $0x8032f1,%rax
+  80527e:	00 00 00 
+  805281:	ff d0                	call   *%rax
+  805283:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  805287:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  80528e:	00 
+  80528f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805293:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  805297:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80529b:	48 01 d0             	add    %rdx,%rax
+  80529e:	48 83 c0 1f          	add    $0x1f,%rax
+  8052a2:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8052a6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8052af:	48 f7 75 e8          	divq   -0x18(%rbp)
+  8052b3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8052b7:	48 29 d0             	sub    %rdx,%rax
+  8052ba:	48 c1 e8 0c          	shr    $0xc,%rax
+  8052be:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  8052c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8052c6:	48 89 c6             	mov    %rax,%rsi
+  8052c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052ce:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  8052d5:	00 00 00 
+  8052d8:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  8052da:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8052de:	48 89 c7             	mov    %rax,%rdi
+  8052e1:	48 b8 aa 4c 80 00 00 	movabs $0x804caa,%rax
+  8052e8:	00 00 00 
+  8052eb:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8052ed:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052f1:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8052f5:	eb 2f                	jmp    805326 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  8052f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8052fb:	48 83 e8 01          	sub    $0x1,%rax
+  8052ff:	48 c1 e0 0c          	shl    $0xc,%rax
+  805303:	48 89 c2             	mov    %rax,%rdx
+  805306:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80530a:	48 01 d0             	add    %rdx,%rax
+  80530d:	48 89 c6             	mov    %rax,%rsi
+  805310:	bf 00 00 00 00       	mov    $0x0,%edi
+  805315:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  80531c:	00 00 00 
+  80531f:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  805321:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  805326:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  80532b:	77 ca                	ja     8052f7 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  80532d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805331:	48 89 c6             	mov    %rax,%rsi
+  805334:	bf 00 00 00 00       	mov    $0x0,%edi
+  805339:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  805340:	00 00 00 
+  805343:	ff d0                	call   *%rax
+}
+  805345:	c9                   	leave
+  805346:	c3                   	ret
+
+0000000000805347 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid) {
+  805347:	55                   	push   %rbp
+  805348:	48 89 e5             	mov    %rsp,%rbp
+  80534b:	48 83 ec 10          	sub    $0x10,%rsp
+  80534f:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  waitpid(envid, NULL);
+  805352:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805355:	be 00 00 00 00       	mov    $0x0,%esi
+  80535a:	89 c7                	mov    %eax,%edi
+  80535c:	48 b8 6b 53 80 00 00 	movabs $0x80536b,%rax
+  805363:	00 00 00 
+  805366:	ff d0                	call   *%rax
+}
+  805368:	90                   	nop
+  805369:	c9                   	leave
+  80536a:	c3                   	ret
+
+000000000080536b <waitpid>:
+
+// Waits until 'envid' exits and stores its exit status in '*status'
+// (if status is not NULL).  Returns 0 on success, or -E_BAD_ENV if
+// 'envid' does not exist, e.g. because it has already exited.
+int
+waitpid(envid_t envid, int *status) {
+  80536b:	55                   	push   %rbp
+  80536c:	48 89 e5             	mov    %rsp,%rbp
+  80536f:	48 83 ec 10          	sub    $0x10,%rsp
+  805373:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  805376:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  assert(envid != 0);
+  80537a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80537e:	75 3e                	jne    8053be <waitpid+0x53>
+  805380:	48 b8 e8 6e 80 00 00 	movabs $0x806ee8,%rax
+  805387:	00 00 00 
+  80538a:	48 89 c1             	mov    %rax,%rcx
+  80538d:	48 b8 f3 6e 80 00 00 	movabs $0x806ef3,%rax
+  805394:	00 00 00 
+  805397:	48 89 c2             	mov    %rax,%rdx
+  80539a:	be 0e 00 00 00       	mov    $0xe,%esi
+  80539f:	48 b8 08 6f 80 00 00 	movabs $0x806f08,%rax
+  8053a6:	00 00 00 
+  8053a9:	48 89 c7             	mov    %rax,%rdi
+  8053ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8053b1:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  8053b8:	00 00 00 
+  8053bb:	41 ff d0             	call   *%r8
+  // If envid is gone already, its status is lost and reads as 0.
+  if (status)
+  8053be:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8053c3:	74 0a                	je     8053cf <waitpid+0x64>
+    *status = 0;
+  8053c5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8053c9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  return sys_env_wait(envid, status);
+  8053cf:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8053d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053d6:	48 89 d6             	mov    %rdx,%rsi
+  8053d9:	89 c7                	mov    %eax,%edi
+  8053db:	48 b8 06 23 80 00 00 	movabs $0x802306,%rax
+  8053e2:	00 00 00 
+  8053e5:	ff d0                	call   *%rax
+}
+  8053e7:	c9                   	leave
+  8053e8:	c3                   	ret
+
+00000000008053e9 <xchg>:
+  8053e9:	55                   	push   %rbp
+  8053ea:	48 89 e5             	mov    %rsp,%rbp
+  8053ed:	48 83 ec 20          	sub    $0x20,%rsp
+  8053f1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8053f5:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  8053f8:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8053fc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8053ff:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805403:	f0 87 02             	lock xchg %eax,(%rdx)
+  805406:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805409:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80540c:	c9                   	leave
+  80540d:	c3                   	ret
+
+000000000080540e <cmpxchg>:
+  80540e:	55                   	push   %rbp
+  80540f:	48 89 e5             	mov    %rsp,%rbp
+  805412:	48 83 ec 20          	sub    $0x20,%rsp
+  805416:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80541a:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80541d:	89 55 e0             	mov    %edx,-0x20(%rbp)
+  805420:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  805424:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  805427:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80542a:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80542e:	f0 0f b1 16          	lock cmpxchg %edx,(%rsi)
+  805432:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805435:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805438:	c9                   	leave
+  805439:	c3                   	ret
+
+000000000080543a <xadd>:
+  80543a:	55                   	push   %rbp
+  80543b:	48 89 e5             	mov    %rsp,%rbp
+  80543e:	48 83 ec 10          	sub    $0x10,%rsp
+  805442:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805446:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  805449:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80544d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805450:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805454:	f0 0f c1 01          	lock xadd %eax,(%rcx)
+  805458:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80545b:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80545e:	c9                   	leave
+  80545f:	c3                   	ret
+
+0000000000805460 <mutex_init>:
+mutex_init(struct Mutex *m) {
+  805460:	55                   	push   %rbp
+  805461:	48 89 e5             	mov    %rsp,%rbp
+  805464:	48 83 ec 08          	sub    $0x8,%rsp
+  805468:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  m->m_state = 0;
+  80546c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805470:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  805476:	90                   	nop
+  805477:	c9                   	leave
+  805478:	c3                   	ret
+
+0000000000805479 <mutex_lock>:
+mutex_lock(struct Mutex *m) {
+  805479:	55                   	push   %rbp
+  80547a:	48 89 e5             	mov    %rsp,%rbp
+  80547d:	48 83 ec 20          	sub    $0x20,%rsp
+  805481:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  if ((c = cmpxchg(&m->m_state, 0, 1)) == 0)
+  805485:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805489:	ba 01 00 00 00       	mov    $0x1,%edx
+  80548e:	be 00 00 00 00       	mov    $0x0,%esi
+  805493:	48 89 c7             	mov    %rax,%rdi
+  805496:	48 b8 0e 54 80 00 00 	movabs $0x80540e,%rax
+  80549d:	00 00 00 
+  8054a0:	ff d0                	call   *%rax
+  8054a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8054a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8054a9:	74 65                	je     805510 <mutex_lock+0x97>
+  if (c != 2)
+  8054ab:	83 7d fc 02          	cmpl   $0x2,-0x4(%rbp)
+  8054af:	74 57                	je     805508 <mutex_lock+0x8f>
+    c = xchg(&m->m_state, 2);
+  8054b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054b5:	be 02 00 00 00       	mov    $0x2,%esi
+  8054ba:	48 89 c7             	mov    %rax,%rdi
+  8054bd:	48 b8 e9 53 80 00 00 	movabs $0x8053e9,%rax
+  8054c4:	00 00 00 
+  8054c7:	ff d0                	call   *%rax
+  8054c9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  8054cc:	eb 3a                	jmp    805508 <mutex_lock+0x8f>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8054ce:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054d2:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8054d9:	be 02 00 00 00       	mov    $0x2,%esi
+  8054de:	48 89 c7             	mov    %rax,%rdi
+  8054e1:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  8054e8:	00 00 00 
+  8054eb:	ff d0                	call   *%rax
+    c = xchg(&m->m_state, 2);
+  8054ed:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054f1:	be 02 00 00 00       	mov    $0x2,%esi
+  8054f6:	48 89 c7             	mov    %rax,%rdi
+  8054f9:	48 b8 e9 53 80 00 00 	movabs $0x8053e9,%rax
+  805500:	00 00 00 
+  805503:	ff d0                	call   *%rax
+  805505:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (c != 0) {
+  805508:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80550c:	75 c0                	jne    8054ce <mutex_lock+0x55>
+  80550e:	eb 01                	jmp    805511 <mutex_lock+0x98>
+    return;
+  805510:	90                   	nop
+}
+  805511:	c9                   	leave
+  805512:	c3                   	ret
+
+0000000000805513 <mutex_trylock>:
+mutex_trylock(struct Mutex *m) {
+  805513:	55                   	push   %rbp
+  805514:	48 89 e5             	mov    %rsp,%rbp
+  805517:	48 83 ec 08          	sub    $0x8,%rsp
+  80551b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return cmpxchg(&m->m_state, 0, 1) == 0 ? 0 : -E_BUSY;
+  80551f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805523:	ba 01 00 00 00       	mov    $0x1,%edx
+  805528:	be 00 00 00 00       	mov    $0x0,%esi
+  80552d:	48 89 c7             	mov    %rax,%rdi
+  805530:	48 b8 0e 54 80 00 00 	movabs $0x80540e,%rax
+  805537:	00 00 00 
+  80553a:	ff d0                	call   *%rax
+  80553c:	85 c0                	test   %eax,%eax
+  80553e:	75 07                	jne    805547 <mutex_trylock+0x34>
+  805540:	b8 00 00 00 00       	mov    $0x0,%eax
+  805545:	eb 05                	jmp    80554c <mutex_trylock+0x39>
+  805547:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80554c:	c9                   	leave
+  80554d:	c3                   	ret
+
+000000000080554e <mutex_unlock>:
+mutex_unlock(struct Mutex *m) {
+  80554e:	55                   	push   %rbp
+  80554f:	48 89 e5             	mov    %rsp,%rbp
+  805552:	48 83 ec 10          	sub    $0x10,%rsp
+  805556:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (xchg(&m->m_state, 0) == 2)
+  80555a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80555e:	be 00 00 00 00       	mov    $0x0,%esi
+  805563:	48 89 c7             	mov    %rax,%rdi
+  805566:	48 b8 e9 53 80 00 00 	movabs $0x8053e9,%rax
+  80556d:	00 00 00 
+  805570:	ff d0                	call   *%rax
+  805572:	83 f8 02             	cmp    $0x2,%eax
+  805575:	75 18                	jne    80558f <mutex_unlock+0x41>
+    sys_futex_wake(&m->m_state, 1);
+  805577:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80557b:	be 01 00 00 00       	mov    $0x1,%esi
+  805580:	48 89 c7             	mov    %rax,%rdi
+  805583:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80558a:	00 00 00 
+  80558d:	ff d0                	call   *%rax
+}
+  80558f:	90                   	nop
+  805590:	c9                   	leave
+  805591:	c3                   	ret
+
+0000000000805592 <cond_init>:
+cond_init(struct Cond *c) {
+  805592:	55                   	push   %rbp
+  805593:	48 89 e5             	mov    %rsp,%rbp
+  805596:	48 83 ec 08          	sub    $0x8,%rsp
+  80559a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  c->c_seq = 0;
+  80559e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8055a2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  8055a8:	90                   	nop
+  8055a9:	c9                   	leave
+  8055aa:	c3                   	ret
+
+00000000008055ab <cond_timedwait>:
+cond_timedwait(struct Cond *c, struct Mutex *m, uint64_t timeout) {
+  8055ab:	55                   	push   %rbp
+  8055ac:	48 89 e5             	mov    %rsp,%rbp
+  8055af:	48 83 ec 30          	sub    $0x30,%rsp
+  8055b3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8055b7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8055bb:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  uint32_t seq = c->c_seq;
+  8055bf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055c3:	8b 00                	mov    (%rax),%eax
+  8055c5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mutex_unlock(m);
+  8055c8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8055cc:	48 89 c7             	mov    %rax,%rdi
+  8055cf:	48 b8 4e 55 80 00 00 	movabs $0x80554e,%rax
+  8055d6:	00 00 00 
+  8055d9:	ff d0                	call   *%rax
+  r = sys_futex_wait(&c->c_seq, seq, timeout);
+  8055db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8055df:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8055e3:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8055e6:	89 ce                	mov    %ecx,%esi
+  8055e8:	48 89 c7             	mov    %rax,%rdi
+  8055eb:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  8055f2:	00 00 00 
+  8055f5:	ff d0                	call   *%rax
+  8055f7:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  while (xchg(&m->m_state, 2) != 0)
+  8055fa:	eb 1f                	jmp    80561b <cond_timedwait+0x70>
+    sys_futex_wait(&m->m_state, 2, FUTEX_NO_TIMEOUT);
+  8055fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805600:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  805607:	be 02 00 00 00       	mov    $0x2,%esi
+  80560c:	48 89 c7             	mov    %rax,%rdi
+  80560f:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  805616:	00 00 00 
+  805619:	ff d0                	call   *%rax
+  while (xchg(&m->m_state, 2) != 0)
+  80561b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80561f:	be 02 00 00 00       	mov    $0x2,%esi
+  805624:	48 89 c7             	mov    %rax,%rdi
+  805627:	48 b8 e9 53 80 00 00 	movabs $0x8053e9,%rax
+  80562e:	00 00 00 
+  805631:	ff d0                	call   *%rax
+  805633:	85 c0                	test   %eax,%eax
+  805635:	75 c5                	jne    8055fc <cond_timedwait+0x51>
+  return r == -E_TIMEOUT ? r : 0;
+  805637:	83 7d f8 ed          	cmpl   $0xffffffed,-0x8(%rbp)
+  80563b:	75 07                	jne    805644 <cond_timedwait+0x99>
+  80563d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805642:	eb 05                	jmp    805649 <cond_timedwait+0x9e>
+  805644:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805649:	c9                   	leave
+  80564a:	c3                   	ret
+
+000000000080564b <cond_wait>:
+cond_wait(struct Cond *c, struct Mutex *m) {
+  80564b:	55                   	push   %rbp
+  80564c:	48 89 e5             	mov    %rsp,%rbp
+  80564f:	48 83 ec 10          	sub    $0x10,%rsp
+  805653:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805657:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  cond_timedwait(c, m, FUTEX_NO_TIMEOUT);
+  80565b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80565f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805663:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  80566a:	48 89 ce             	mov    %rcx,%rsi
+  80566d:	48 89 c7             	mov    %rax,%rdi
+  805670:	48 b8 ab 55 80 00 00 	movabs $0x8055ab,%rax
+  805677:	00 00 00 
+  80567a:	ff d0                	call   *%rax
+}
+  80567c:	90                   	nop
+  80567d:	c9                   	leave
+  80567e:	c3                   	ret
+
+000000000080567f <cond_signal>:
+cond_signal(struct Cond *c) {
+  80567f:	55                   	push   %rbp
+  805680:	48 89 e5             	mov    %rsp,%rbp
+  805683:	48 83 ec 10          	sub    $0x10,%rsp
+  805687:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  80568b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80568f:	be 01 00 00 00       	mov    $0x1,%esi
+  805694:	48 89 c7             	mov    %rax,%rdi
+  805697:	48 b8 3a 54 80 00 00 	movabs $0x80543a,%rax
+  80569e:	00 00 00 
+  8056a1:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, 1);
+  8056a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056a7:	be 01 00 00 00       	mov    $0x1,%esi
+  8056ac:	48 89 c7             	mov    %rax,%rdi
+  8056af:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8056b6:	00 00 00 
+  8056b9:	ff d0                	call   *%rax
+}
+  8056bb:	90                   	nop
+  8056bc:	c9                   	leave
+  8056bd:	c3                   	ret
+
+00000000008056be <cond_broadcast>:
+cond_broadcast(struct Cond *c) {
+  8056be:	55                   	push   %rbp
+  8056bf:	48 89 e5             	mov    %rsp,%rbp
+  8056c2:	48 83 ec 10          	sub    $0x10,%rsp
+  8056c6:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&c->c_seq, 1);
+  8056ca:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8056d3:	48 89 c7             	mov    %rax,%rdi
+  8056d6:	48 b8 3a 54 80 00 00 	movabs $0x80543a,%rax
+  8056dd:	00 00 00 
+  8056e0:	ff d0                	call   *%rax
+  sys_futex_wake(&c->c_seq, FUTEX_WAKE_ALL);
+  8056e2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8056e6:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8056eb:	48 89 c7             	mov    %rax,%rdi
+  8056ee:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8056f5:	00 00 00 
+  8056f8:	ff d0                	call   *%rax
+}
+  8056fa:	90                   	nop
+  8056fb:	c9                   	leave
+  8056fc:	c3                   	ret
+
+00000000008056fd <sem_init>:
+sem_init(struct Semaphore *s, uint32_t value) {
+  8056fd:	55                   	push   %rbp
+  8056fe:	48 89 e5             	mov    %rsp,%rbp
+  805701:	48 83 ec 10          	sub    $0x10,%rsp
+  805705:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805709:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  s->s_value   = value;
+  80570c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805710:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805713:	89 10                	mov    %edx,(%rax)
+  s->s_waiters = 0;
+  805715:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805719:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+}
+  805720:	90                   	nop
+  805721:	c9                   	leave
+  805722:	c3                   	ret
+
+0000000000805723 <sem_trywait>:
+sem_trywait(struct Semaphore *s) {
+  805723:	55                   	push   %rbp
+  805724:	48 89 e5             	mov    %rsp,%rbp
+  805727:	48 83 ec 18          	sub    $0x18,%rsp
+  80572b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  while ((v = s->s_value) > 0) {
+  80572f:	eb 2a                	jmp    80575b <sem_trywait+0x38>
+    if (cmpxchg(&s->s_value, v, v - 1) == v)
+  805731:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805734:	8d 50 ff             	lea    -0x1(%rax),%edx
+  805737:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80573b:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  80573e:	89 ce                	mov    %ecx,%esi
+  805740:	48 89 c7             	mov    %rax,%rdi
+  805743:	48 b8 0e 54 80 00 00 	movabs $0x80540e,%rax
+  80574a:	00 00 00 
+  80574d:	ff d0                	call   *%rax
+  80574f:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  805752:	75 07                	jne    80575b <sem_trywait+0x38>
+      return 0;
+  805754:	b8 00 00 00 00       	mov    $0x0,%eax
+  805759:	eb 14                	jmp    80576f <sem_trywait+0x4c>
+  while ((v = s->s_value) > 0) {
+  80575b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80575f:	8b 00                	mov    (%rax),%eax
+  805761:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805764:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805768:	75 c7                	jne    805731 <sem_trywait+0xe>
+  return -E_BUSY;
+  80576a:	b8 eb ff ff ff       	mov    $0xffffffeb,%eax
+}
+  80576f:	c9                   	leave
+  805770:	c3                   	ret
+
+0000000000805771 <sem_timedwait>:
+sem_timedwait(struct Semaphore *s, uint64_t timeout) {
+  805771:	55                   	push   %rbp
+  805772:	48 89 e5             	mov    %rsp,%rbp
+  805775:	48 83 ec 30          	sub    $0x30,%rsp
+  805779:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80577d:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uint64_t deadline = 0, now;
+  805781:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  805788:	00 
+  if (timeout && timeout != FUTEX_NO_TIMEOUT) {
+  805789:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80578e:	0f 84 fb 00 00 00    	je     80588f <sem_timedwait+0x11e>
+  805794:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805799:	0f 84 f0 00 00 00    	je     80588f <sem_timedwait+0x11e>
+    now      = vsys_clock_ns();
+  80579f:	48 b8 a2 5d 80 00 00 	movabs $0x805da2,%rax
+  8057a6:	00 00 00 
+  8057a9:	ff d0                	call   *%rax
+  8057ab:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  8057af:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057b3:	48 f7 d0             	not    %rax
+  8057b6:	48 39 45 d0          	cmp    %rax,-0x30(%rbp)
+  8057ba:	73 0d                	jae    8057c9 <sem_timedwait+0x58>
+  8057bc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8057c0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8057c4:	48 01 d0             	add    %rdx,%rax
+  8057c7:	eb 07                	jmp    8057d0 <sem_timedwait+0x5f>
+  8057c9:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8057d0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (sem_trywait(s) < 0) {
+  8057d4:	e9 b6 00 00 00       	jmp    80588f <sem_timedwait+0x11e>
+    if (deadline) {
+  8057d9:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8057de:	74 2d                	je     80580d <sem_timedwait+0x9c>
+      now     = vsys_clock_ns();
+  8057e0:	48 b8 a2 5d 80 00 00 	movabs $0x805da2,%rax
+  8057e7:	00 00 00 
+  8057ea:	ff d0                	call   *%rax
+  8057ec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8057f0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8057f4:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8057f8:	73 0a                	jae    805804 <sem_timedwait+0x93>
+  8057fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057fe:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  805802:	eb 05                	jmp    805809 <sem_timedwait+0x98>
+  805804:	b8 00 00 00 00       	mov    $0x0,%eax
+  805809:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    xadd(&s->s_waiters, 1);
+  80580d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805811:	48 83 c0 04          	add    $0x4,%rax
+  805815:	be 01 00 00 00       	mov    $0x1,%esi
+  80581a:	48 89 c7             	mov    %rax,%rdi
+  80581d:	48 b8 3a 54 80 00 00 	movabs $0x80543a,%rax
+  805824:	00 00 00 
+  805827:	ff d0                	call   *%rax
+    r = sys_futex_wait(&s->s_value, 0, timeout);
+  805829:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80582d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805831:	be 00 00 00 00       	mov    $0x0,%esi
+  805836:	48 89 c7             	mov    %rax,%rdi
+  805839:	48 b8 b3 27 80 00 00 	movabs $0x8027b3,%rax
+  805840:	00 00 00 
+  805843:	ff d0                	call   *%rax
+  805845:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    xadd(&s->s_waiters, -1);
+  805848:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80584c:	48 83 c0 04          	add    $0x4,%rax
+  805850:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  805855:	48 89 c7             	mov    %rax,%rdi
+  805858:	48 b8 3a 54 80 00 00 	movabs $0x80543a,%rax
+  80585f:	00 00 00 
+  805862:	ff d0                	call   *%rax
+    if (r == -E_TIMEOUT)
+  805864:	83 7d ec ed          	cmpl   $0xffffffed,-0x14(%rbp)
+  805868:	75 25                	jne    80588f <sem_timedwait+0x11e>
+      return sem_trywait(s) < 0 ? -E_TIMEOUT : 0;
+  80586a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80586e:	48 89 c7             	mov    %rax,%rdi
+  805871:	48 b8 23 57 80 00 00 	movabs $0x805723,%rax
+  805878:	00 00 00 
+  80587b:	ff d0                	call   *%rax
+  80587d:	85 c0                	test   %eax,%eax
+  80587f:	79 07                	jns    805888 <sem_timedwait+0x117>
+  805881:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805886:	eb 27                	jmp    8058af <sem_timedwait+0x13e>
+  805888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80588d:	eb 20                	jmp    8058af <sem_timedwait+0x13e>
+  while (sem_trywait(s) < 0) {
+  80588f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805893:	48 89 c7             	mov    %rax,%rdi
+  805896:	48 b8 23 57 80 00 00 	movabs $0x805723,%rax
+  80589d:	00 00 00 
+  8058a0:	ff d0                	call   *%rax
+  8058a2:	85 c0                	test   %eax,%eax
+  8058a4:	0f 88 2f ff ff ff    	js     8057d9 <sem_timedwait+0x68>
+  return 0;
+  8058aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8058af:	c9                   	leave
+  8058b0:	c3                   	ret
+
+00000000008058b1 <sem_wait>:
+sem_wait(struct Semaphore *s) {
+  8058b1:	55                   	push   %rbp
+  8058b2:	48 89 e5             	mov    %rsp,%rbp
+  8058b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8058b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  sem_timedwait(s, FUTEX_NO_TIMEOUT);
+  8058bd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058c1:	48 c7 c6 ff ff ff ff 	mov    $0xffffffffffffffff,%rsi
+  8058c8:	48 89 c7             	mov    %rax,%rdi
+  8058cb:	48 b8 71 57 80 00 00 	movabs $0x805771,%rax
+  8058d2:	00 00 00 
+  8058d5:	ff d0                	call   *%rax
+}
+  8058d7:	90                   	nop
+  8058d8:	c9                   	leave
+  8058d9:	c3                   	ret
+
+00000000008058da <sem_post>:
+sem_post(struct Semaphore *s) {
+  8058da:	55                   	push   %rbp
+  8058db:	48 89 e5             	mov    %rsp,%rbp
+  8058de:	48 83 ec 10          	sub    $0x10,%rsp
+  8058e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  xadd(&s->s_value, 1);
+  8058e6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8058ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8058ef:	48 89 c7             	mov    %rax,%rdi
+  8058f2:	48 b8 3a 54 80 00 00 	movabs $0x80543a,%rax
+  8058f9:	00 00 00 
+  8058fc:	ff d0                	call   *%rax
+  if (s->s_waiters)
+  8058fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805902:	8b 40 04             	mov    0x4(%rax),%eax
+  805905:	85 c0                	test   %eax,%eax
+  805907:	74 18                	je     805921 <sem_post+0x47>
+    sys_futex_wake(&s->s_value, 1);
+  805909:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80590d:	be 01 00 00 00       	mov    $0x1,%esi
+  805912:	48 89 c7             	mov    %rax,%rdi
+  805915:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80591c:	00 00 00 
+  80591f:	ff d0                	call   *%rax
+}
+  805921:	90                   	nop
+  805922:	c9                   	leave
+  805923:	c3                   	ret
+
+0000000000805924 <thread_start>:
+
+static struct Mutex thread_lock = MUTEX_INITIALIZER;
+static envid_t thread_slots[MAXTHREADS];
+
+static void
+thread_start(void (*fn)(void *), void *arg) {
+  805924:	55                   	push   %rbp
+  805925:	48 89 e5             	mov    %rsp,%rbp
+  805928:	48 83 ec 10          	sub    $0x10,%rsp
+  80592c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805930:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  fn(arg);
+  805934:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805938:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80593c:	48 89 c7             	mov    %rax,%rdi
+  80593f:	ff d2                	call   *%rdx
+  thread_exit(0);
+  805941:	bf 00 00 00 00       	mov    $0x0,%edi
+  805946:	48 b8 88 5b 80 00 00 	movabs $0x805b88,%rax
+  80594d:	00 00 00 
+  805950:	ff d0                	call   *%rax
+}
+  805952:	90                   	nop
+  805953:	c9                   	leave
+  805954:	c3                   	ret
+
+0000000000805955 <slot_unmap>:
+
+static void
+slot_unmap(int i) {
+  805955:	55                   	push   %rbp
+  805956:	48 89 e5             	mov    %rsp,%rbp
+  805959:	48 83 ec 20          	sub    $0x20,%rsp
+  80595d:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  uintptr_t va;
+
+  sys_page_unmap(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE));
+  805960:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805963:	c1 e0 10             	shl    $0x10,%eax
+  805966:	48 98                	cltq
+  805968:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  80596d:	48 01 d0             	add    %rdx,%rax
+  805970:	48 89 c6             	mov    %rax,%rsi
+  805973:	bf 00 00 00 00       	mov    $0x0,%edi
+  805978:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  80597f:	00 00 00 
+  805982:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  805984:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805987:	83 c0 01             	add    $0x1,%eax
+  80598a:	c1 e0 10             	shl    $0x10,%eax
+  80598d:	48 98                	cltq
+  80598f:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805994:	48 01 d0             	add    %rdx,%rax
+  805997:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80599b:	eb 20                	jmp    8059bd <slot_unmap+0x68>
+    sys_page_unmap(0, (void *)va);
+  80599d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8059a1:	48 89 c6             	mov    %rax,%rsi
+  8059a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8059a9:	48 b8 bf 24 80 00 00 	movabs $0x8024bf,%rax
+  8059b0:	00 00 00 
+  8059b3:	ff d0                	call   *%rax
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE)
+  8059b5:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  8059bc:	00 
+  8059bd:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8059c0:	83 c0 01             	add    $0x1,%eax
+  8059c3:	c1 e0 10             	shl    $0x10,%eax
+  8059c6:	48 98                	cltq
+  8059c8:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  8059cd:	48 01 d0             	add    %rdx,%rax
+  8059d0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8059d4:	72 c7                	jb     80599d <slot_unmap+0x48>
+}
+  8059d6:	90                   	nop
+  8059d7:	90                   	nop
+  8059d8:	c9                   	leave
+  8059d9:	c3                   	ret
+
+00000000008059da <thread_create>:
+// Start a thread running fn(arg).  Returning from fn is the same as
+// calling thread_exit(0).  Returns the new thread's envid, or < 0 on
+// error: -E_NO_FREE_ENV if all thread slots are in use, or any error
+// from sys_page_alloc and sys_thread_create.
+envid_t
+thread_create(void (*fn)(void *), void *arg) {
+  8059da:	55                   	push   %rbp
+  8059db:	48 89 e5             	mov    %rsp,%rbp
+  8059de:	48 83 ec 30          	sub    $0x30,%rsp
+  8059e2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8059e6:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  uintptr_t va;
+  envid_t id;
+  int i, r;
+
+  mutex_lock(&thread_lock);
+  8059ea:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8059f1:	00 00 00 
+  8059f4:	48 89 c7             	mov    %rax,%rdi
+  8059f7:	48 b8 79 54 80 00 00 	movabs $0x805479,%rax
+  8059fe:	00 00 00 
+  805a01:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i]; i++)
+  805a03:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805a0a:	eb 04                	jmp    805a10 <thread_create+0x36>
+  805a0c:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  805a10:	83 7d f4 3f          	cmpl   $0x3f,-0xc(%rbp)
+  805a14:	7f 16                	jg     805a2c <thread_create+0x52>
+  805a16:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  805a1d:	00 00 00 
+  805a20:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805a23:	48 98                	cltq
+  805a25:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805a28:	85 c0                	test   %eax,%eax
+  805a2a:	75 e0                	jne    805a0c <thread_create+0x32>
+    ;
+  if (i == MAXTHREADS) {
+  805a2c:	83 7d f4 40          	cmpl   $0x40,-0xc(%rbp)
+  805a30:	75 0c                	jne    805a3e <thread_create+0x64>
+    r = -E_NO_FREE_ENV;
+  805a32:	c7 45 f0 fb ff ff ff 	movl   $0xfffffffb,-0x10(%rbp)
+    goto out;
+  805a39:	e9 2c 01 00 00       	jmp    805b6a <thread_create+0x190>
+  }
+
+  if ((r = sys_page_alloc(0, (void *)(SLOT2UXSTACKTOP(i) - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  805a3e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805a41:	c1 e0 10             	shl    $0x10,%eax
+  805a44:	48 98                	cltq
+  805a46:	ba 00 10 00 e0       	mov    $0xe0001000,%edx
+  805a4b:	48 01 d0             	add    %rdx,%rax
+  805a4e:	ba 07 00 00 00       	mov    $0x7,%edx
+  805a53:	48 89 c6             	mov    %rax,%rsi
+  805a56:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a5b:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  805a62:	00 00 00 
+  805a65:	ff d0                	call   *%rax
+  805a67:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805a6a:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805a6e:	0f 88 f5 00 00 00    	js     805b69 <thread_create+0x18f>
+    goto out;
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805a74:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805a77:	83 c0 01             	add    $0x1,%eax
+  805a7a:	c1 e0 10             	shl    $0x10,%eax
+  805a7d:	48 98                	cltq
+  805a7f:	ba 00 80 ff df       	mov    $0xdfff8000,%edx
+  805a84:	48 01 d0             	add    %rdx,%rax
+  805a87:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805a8b:	eb 32                	jmp    805abf <thread_create+0xe5>
+    if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805a8d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805a91:	ba 07 00 00 00       	mov    $0x7,%edx
+  805a96:	48 89 c6             	mov    %rax,%rsi
+  805a99:	bf 00 00 00 00       	mov    $0x0,%edi
+  805a9e:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  805aa5:	00 00 00 
+  805aa8:	ff d0                	call   *%rax
+  805aaa:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805aad:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  805ab1:	0f 88 9e 00 00 00    	js     805b55 <thread_create+0x17b>
+  for (va = SLOT2STACKTOP(i) - THREAD_STACKSIZE; va < SLOT2STACKTOP(i); va += PGSIZE) {
+  805ab7:	48 81 45 f8 00 10 00 	addq   $0x1000,-0x8(%rbp)
+  805abe:	00 
+  805abf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805ac2:	83 c0 01             	add    $0x1,%eax
+  805ac5:	c1 e0 10             	shl    $0x10,%eax
+  805ac8:	48 98                	cltq
+  805aca:	ba 00 00 00 e0       	mov    $0xe0000000,%edx
+  805acf:	48 01 d0             	add    %rdx,%rax
+  805ad2:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805ad6:	72 b5                	jb     805a8d <thread_create+0xb3>
+      goto fail;
+  }
+
+  // Enter thread_start as if it had been called: one word below a
+  // 16-byte aligned stack top.
+  id = sys_thread_create((uintptr_t)thread_start,
+  805ad8:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  805adc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+                         SLOT2UXSTACKTOP(i), (uintptr_t)fn, (uintptr_t)arg);
+  805ae0:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805ae3:	c1 e2 10             	shl    $0x10,%edx
+  805ae6:	48 63 d2             	movslq %edx,%rdx
+  805ae9:	be 00 20 00 e0       	mov    $0xe0002000,%esi
+  805aee:	48 01 f2             	add    %rsi,%rdx
+  id = sys_thread_create((uintptr_t)thread_start,
+  805af1:	49 89 d1             	mov    %rdx,%r9
+                         SLOT2STACKTOP(i) - sizeof(uintptr_t),
+  805af4:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  805af7:	83 c2 01             	add    $0x1,%edx
+  805afa:	c1 e2 10             	shl    $0x10,%edx
+  805afd:	48 63 d2             	movslq %edx,%rdx
+  805b00:	be f8 ff ff df       	mov    $0xdffffff8,%esi
+  805b05:	48 01 d6             	add    %rdx,%rsi
+  id = sys_thread_create((uintptr_t)thread_start,
+  805b08:	48 bf 24 59 80 00 00 	movabs $0x805924,%rdi
+  805b0f:	00 00 00 
+  805b12:	49 89 c8             	mov    %rcx,%r8
+  805b15:	48 89 c1             	mov    %rax,%rcx
+  805b18:	4c 89 ca             	mov    %r9,%rdx
+  805b1b:	48 b8 a7 28 80 00 00 	movabs $0x8028a7,%rax
+  805b22:	00 00 00 
+  805b25:	ff d0                	call   *%rax
+  805b27:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  if (id < 0) {
+  805b2a:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805b2e:	79 08                	jns    805b38 <thread_create+0x15e>
+    r = id;
+  805b30:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b33:	89 45 f0             	mov    %eax,-0x10(%rbp)
+    goto fail;
+  805b36:	eb 1e                	jmp    805b56 <thread_create+0x17c>
+  }
+  thread_slots[i] = r = id;
+  805b38:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805b3b:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  805b3e:	48 b9 40 a0 80 00 00 	movabs $0x80a040,%rcx
+  805b45:	00 00 00 
+  805b48:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805b4b:	48 98                	cltq
+  805b4d:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  805b50:	89 14 81             	mov    %edx,(%rcx,%rax,4)
+  goto out;
+  805b53:	eb 15                	jmp    805b6a <thread_create+0x190>
+      goto fail;
+  805b55:	90                   	nop
+
+fail:
+  slot_unmap(i);
+  805b56:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  805b59:	89 c7                	mov    %eax,%edi
+  805b5b:	48 b8 55 59 80 00 00 	movabs $0x805955,%rax
+  805b62:	00 00 00 
+  805b65:	ff d0                	call   *%rax
+  805b67:	eb 01                	jmp    805b6a <thread_create+0x190>
+    goto out;
+  805b69:	90                   	nop
+out:
+  mutex_unlock(&thread_lock);
+  805b6a:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805b71:	00 00 00 
+  805b74:	48 89 c7             	mov    %rax,%rdi
+  805b77:	48 b8 4e 55 80 00 00 	movabs $0x80554e,%rax
+  805b7e:	00 00 00 
+  805b81:	ff d0                	call   *%rax
+  return r;
+  805b83:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  805b86:	c9                   	leave
+  805b87:	c3                   	ret
+
+0000000000805b88 <thread_exit>:
+
+// Exit the calling thread with 'status'.  The rest of the process
+// keeps running; exit() ends all of its threads.
+void
+thread_exit(int status) {
+  805b88:	55                   	push   %rbp
+  805b89:	48 89 e5             	mov    %rsp,%rbp
+  805b8c:	48 83 ec 10          	sub    $0x10,%rsp
+  805b90:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  sys_thread_exit(status);
+  805b93:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805b96:	89 c7                	mov    %eax,%edi
+  805b98:	48 b8 04 29 80 00 00 	movabs $0x802904,%rax
+  805b9f:	00 00 00 
+  805ba2:	ff d0                	call   *%rax
+}
+  805ba4:	90                   	nop
+  805ba5:	c9                   	leave
+  805ba6:	c3                   	ret
+
+0000000000805ba7 <thread_join>:
+// (if status is not NULL) and reclaim its stacks.  A thread that is
+// never joined keeps its slot until the process exits.
+// Returns 0 on success, or -E_BAD_ENV if 'id' is not a thread
+// created by thread_create or was already joined.
+int
+thread_join(envid_t id, int *status) {
+  805ba7:	55                   	push   %rbp
+  805ba8:	48 89 e5             	mov    %rsp,%rbp
+  805bab:	48 83 ec 20          	sub    $0x20,%rsp
+  805baf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805bb2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  mutex_lock(&thread_lock);
+  805bb6:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805bbd:	00 00 00 
+  805bc0:	48 89 c7             	mov    %rax,%rdi
+  805bc3:	48 b8 79 54 80 00 00 	movabs $0x805479,%rax
+  805bca:	00 00 00 
+  805bcd:	ff d0                	call   *%rax
+  for (i = 0; i < MAXTHREADS && thread_slots[i] != id; i++)
+  805bcf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805bd6:	eb 04                	jmp    805bdc <thread_join+0x35>
+  805bd8:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805bdc:	83 7d fc 3f          	cmpl   $0x3f,-0x4(%rbp)
+  805be0:	7f 17                	jg     805bf9 <thread_join+0x52>
+  805be2:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  805be9:	00 00 00 
+  805bec:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bef:	48 98                	cltq
+  805bf1:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  805bf4:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805bf7:	75 df                	jne    805bd8 <thread_join+0x31>
+    ;
+  mutex_unlock(&thread_lock);
+  805bf9:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805c00:	00 00 00 
+  805c03:	48 89 c7             	mov    %rax,%rdi
+  805c06:	48 b8 4e 55 80 00 00 	movabs $0x80554e,%rax
+  805c0d:	00 00 00 
+  805c10:	ff d0                	call   *%rax
+  if (!id || i == MAXTHREADS)
+  805c12:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  805c16:	74 06                	je     805c1e <thread_join+0x77>
+  805c18:	83 7d fc 40          	cmpl   $0x40,-0x4(%rbp)
+  805c1c:	75 07                	jne    805c25 <thread_join+0x7e>
+    return -E_BAD_ENV;
+  805c1e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  805c23:	eb 76                	jmp    805c9b <thread_join+0xf4>
+
+  // If the thread is gone already, its status is lost and reads as 0.
+  waitpid(id, status);
+  805c25:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805c29:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805c2c:	48 89 d6             	mov    %rdx,%rsi
+  805c2f:	89 c7                	mov    %eax,%edi
+  805c31:	48 b8 6b 53 80 00 00 	movabs $0x80536b,%rax
+  805c38:	00 00 00 
+  805c3b:	ff d0                	call   *%rax
+
+  mutex_lock(&thread_lock);
+  805c3d:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805c44:	00 00 00 
+  805c47:	48 89 c7             	mov    %rax,%rdi
+  805c4a:	48 b8 79 54 80 00 00 	movabs $0x805479,%rax
+  805c51:	00 00 00 
+  805c54:	ff d0                	call   *%rax
+  slot_unmap(i);
+  805c56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c59:	89 c7                	mov    %eax,%edi
+  805c5b:	48 b8 55 59 80 00 00 	movabs $0x805955,%rax
+  805c62:	00 00 00 
+  805c65:	ff d0                	call   *%rax
+  thread_slots[i] = 0;
+  805c67:	48 ba 40 a0 80 00 00 	movabs $0x80a040,%rdx
+  805c6e:	00 00 00 
+  805c71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805c74:	48 98                	cltq
+  805c76:	c7 04 82 00 00 00 00 	movl   $0x0,(%rdx,%rax,4)
+  mutex_unlock(&thread_lock);
+  805c7d:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  805c84:	00 00 00 
+  805c87:	48 89 c7             	mov    %rax,%rdi
+  805c8a:	48 b8 4e 55 80 00 00 	movabs $0x80554e,%rax
+  805c91:	00 00 00 
+  805c94:	ff d0                	call   *%rax
+  return 0;
+  805c96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c9b:	c9                   	leave
+  805c9c:	c3                   	ret
+
+0000000000805c9d <thread_is_uxstack>:
+
+// Is va in a thread's exception stack page?  The kernel writes those
+// without going through the page fault handler, so fork must not
+// make them copy-on-write.
+bool
+thread_is_uxstack(uintptr_t va) {
+  805c9d:	55                   	push   %rbp
+  805c9e:	48 89 e5             	mov    %rsp,%rbp
+  805ca1:	48 83 ec 08          	sub    $0x8,%rsp
+  805ca5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805ca9:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805cae:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805cb2:	73 23                	jae    805cd7 <thread_is_uxstack+0x3a>
+  805cb4:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805cb9:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805cbd:	72 18                	jb     805cd7 <thread_is_uxstack+0x3a>
+         (va - THREADSTACKS) % THREADSLOT / PGSIZE == 1;
+  805cbf:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805cc3:	25 00 f0 00 00       	and    $0xf000,%eax
+  return va >= THREADSTACKS && va < SLOT2UXSTACKTOP(MAXTHREADS) &&
+  805cc8:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  805cce:	75 07                	jne    805cd7 <thread_is_uxstack+0x3a>
+  805cd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  805cd5:	eb 05                	jmp    805cdc <thread_is_uxstack+0x3f>
+  805cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cdc:	83 e0 01             	and    $0x1,%eax
+}
+  805cdf:	c9                   	leave
+  805ce0:	c3                   	ret
+
+0000000000805ce1 <thread_pftemp>:
+
+// Scratch page for the calling thread's page fault handler: threads
+// share one page table, so they cannot all borrow PFTEMP.
+void *
+thread_pftemp(void) {
+  805ce1:	55                   	push   %rbp
+  805ce2:	48 89 e5             	mov    %rsp,%rbp
+  805ce5:	48 83 ec 10          	sub    $0x10,%rsp
+  uintptr_t top = thisenv->env_uxstacktop;
+  805ce9:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805cf0:	00 00 00 
+  805cf3:	8b 40 04             	mov    0x4(%rax),%eax
+  805cf6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805cfb:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d02:	00 00 00 
+  805d05:	48 98                	cltq
+  805d07:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d0e:	48 01 d0             	add    %rdx,%rax
+  805d11:	48 05 08 01 00 00    	add    $0x108,%rax
+  805d17:	48 8b 00             	mov    (%rax),%rax
+  805d1a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (top < THREADSTACKS || top >= SLOT2UXSTACKTOP(MAXTHREADS))
+  805d1e:	b8 ff ff ff df       	mov    $0xdfffffff,%eax
+  805d23:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805d27:	73 0b                	jae    805d34 <thread_pftemp+0x53>
+  805d29:	b8 ff 1f 40 e0       	mov    $0xe0401fff,%eax
+  805d2e:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  805d32:	73 07                	jae    805d3b <thread_pftemp+0x5a>
+    return (void *)PFTEMP;
+  805d34:	b8 00 f0 5f 00       	mov    $0x5ff000,%eax
+  805d39:	eb 26                	jmp    805d61 <thread_pftemp+0x80>
+  return (void *)PFTEMP - ((top - THREADSTACKS) / THREADSLOT + 1) * PGSIZE;
+  805d3b:	48 ba 00 00 00 20 ff 	movabs $0xffffffff20000000,%rdx
+  805d42:	ff ff ff 
+  805d45:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805d49:	48 01 d0             	add    %rdx,%rax
+  805d4c:	48 c1 e8 10          	shr    $0x10,%rax
+  805d50:	48 83 c0 01          	add    $0x1,%rax
+  805d54:	48 c1 e0 0c          	shl    $0xc,%rax
+  805d58:	48 f7 d8             	neg    %rax
+  805d5b:	48 05 00 f0 5f 00    	add    $0x5ff000,%rax
+}
+  805d61:	c9                   	leave
+  805d62:	c3                   	ret
+
+0000000000805d63 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  805d63:	55                   	push   %rbp
+  805d64:	48 89 e5             	mov    %rsp,%rbp
+  805d67:	48 83 ec 08          	sub    $0x8,%rsp
+  805d6b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  805d6e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d72:	75 10                	jne    805d84 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  805d74:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805d7b:	00 00 00 
+  805d7e:	8b 00                	mov    (%rax),%eax
+  805d80:	48 98                	cltq
+  805d82:	eb 05                	jmp    805d89 <vsyscall+0x26>
+  }
+  return 0;
+  805d84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d89:	c9                   	leave
+  805d8a:	c3                   	ret
+
+0000000000805d8b <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  805d8b:	55                   	push   %rbp
+  805d8c:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  805d8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  805d94:	48 b8 63 5d 80 00 00 	movabs $0x805d63,%rax
+  805d9b:	00 00 00 
+  805d9e:	ff d0                	call   *%rax
+}
+  805da0:	5d                   	pop    %rbp
+  805da1:	c3                   	ret
+
+0000000000805da2 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805da2:	55                   	push   %rbp
+  805da3:	48 89 e5             	mov    %rsp,%rbp
+  805da6:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  805daa:	0f 31                	rdtsc
+  805dac:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805daf:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805db2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805db5:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805db8:	48 c1 e2 20          	shl    $0x20,%rdx
+  805dbc:	48 09 d0             	or     %rdx,%rax
+  805dbf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805dc3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  805dc7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  805dcb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805dd2:	00 00 00 
+  805dd5:	8b 40 08             	mov    0x8(%rax),%eax
+  805dd8:	48 98                	cltq
+  805dda:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805dde:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805de2:	ba 00 00 00 00       	mov    $0x0,%edx
+  805de7:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805deb:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805df2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805df6:	ba 00 00 00 00       	mov    $0x0,%edx
+  805dfb:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805dff:	48 89 d0             	mov    %rdx,%rax
+  805e02:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  805e09:	ba 00 00 00 00       	mov    $0x0,%edx
+  805e0e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805e12:	48 01 c8             	add    %rcx,%rax
+}
+  805e15:	c9                   	leave
+  805e16:	c3                   	ret
+
+0000000000805e17 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  805e17:	55                   	push   %rbp
+  805e18:	48 89 e5             	mov    %rsp,%rbp
+  805e1b:	48 83 ec 20          	sub    $0x20,%rsp
+  805e1f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805e22:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e25:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  805e28:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  805e2c:	be 01 00 00 00       	mov    $0x1,%esi
+  805e31:	48 89 c7             	mov    %rax,%rdi
+  805e34:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  805e3b:	00 00 00 
+  805e3e:	ff d0                	call   *%rax
+}
+  805e40:	90                   	nop
+  805e41:	c9                   	leave
+  805e42:	c3                   	ret
+
+0000000000805e43 <getchar>:
+
+int
+getchar(void) {
+  805e43:	55                   	push   %rbp
+  805e44:	48 89 e5             	mov    %rsp,%rbp
+  805e47:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  805e4b:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  805e4f:	ba 01 00 00 00       	mov    $0x1,%edx
+  805e54:	48 89 c6             	mov    %rax,%rsi
+  805e57:	bf 00 00 00 00       	mov    $0x0,%edi
+  805e5c:	48 b8 5a 39 80 00 00 	movabs $0x80395a,%rax
+  805e63:	00 00 00 
+  805e66:	ff d0                	call   *%rax
+  805e68:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  805e6b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e6f:	79 05                	jns    805e76 <getchar+0x33>
+    return r;
+  805e71:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805e74:	eb 14                	jmp    805e8a <getchar+0x47>
+  if (r < 1)
+  805e76:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805e7a:	7f 07                	jg     805e83 <getchar+0x40>
+    return -E_EOF;
+  805e7c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  805e81:	eb 07                	jmp    805e8a <getchar+0x47>
+  return c;
+  805e83:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  805e87:	0f b6 c0             	movzbl %al,%eax
+}
+  805e8a:	c9                   	leave
+  805e8b:	c3                   	ret
+
+0000000000805e8c <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  805e8c:	55                   	push   %rbp
+  805e8d:	48 89 e5             	mov    %rsp,%rbp
+  805e90:	48 83 ec 20          	sub    $0x20,%rsp
+  805e94:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805e97:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805e9b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805e9e:	48 89 d6             	mov    %rdx,%rsi
+  805ea1:	89 c7                	mov    %eax,%edi
+  805ea3:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  805eaa:	00 00 00 
+  805ead:	ff d0                	call   *%rax
+  805eaf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805eb2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805eb6:	79 05                	jns    805ebd <iscons+0x31>
+    return r;
+  805eb8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ebb:	eb 1a                	jmp    805ed7 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805ebd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ec1:	8b 10                	mov    (%rax),%edx
+  805ec3:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805eca:	00 00 00 
+  805ecd:	8b 00                	mov    (%rax),%eax
+  805ecf:	39 c2                	cmp    %eax,%edx
+  805ed1:	0f 94 c0             	sete   %al
+  805ed4:	0f b6 c0             	movzbl %al,%eax
+}
+  805ed7:	c9                   	leave
+  805ed8:	c3                   	ret
+
+0000000000805ed9 <opencons>:
+
+int
+opencons(void) {
+  805ed9:	55                   	push   %rbp
+  805eda:	48 89 e5             	mov    %rsp,%rbp
+  805edd:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805ee1:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805ee5:	48 89 c7             	mov    %rax,%rdi
+  805ee8:	48 b8 1c 33 80 00 00 	movabs $0x80331c,%rax
+  805eef:	00 00 00 
+  805ef2:	ff d0                	call   *%rax
+  805ef4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805ef7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805efb:	79 05                	jns    805f02 <opencons+0x29>
+    return r;
+  805efd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f00:	eb 66                	jmp    805f68 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805f02:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f06:	ba 07 04 00 00       	mov    $0x407,%edx
+  805f0b:	48 89 c6             	mov    %rax,%rsi
+  805f0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805f13:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  805f1a:	00 00 00 
+  805f1d:	ff d0                	call   *%rax
+  805f1f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f22:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f26:	79 05                	jns    805f2d <opencons+0x54>
+    return r;
+  805f28:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f2b:	eb 3b                	jmp    805f68 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805f2d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f31:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  805f38:	00 00 00 
+  805f3b:	8b 12                	mov    (%rdx),%edx
+  805f3d:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  805f3f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f43:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  805f4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f4e:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  805f55:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805f59:	48 89 c7             	mov    %rax,%rdi
+  805f5c:	48 b8 ce 32 80 00 00 	movabs $0x8032ce,%rax
+  805f63:	00 00 00 
+  805f66:	ff d0                	call   *%rax
+}
+  805f68:	c9                   	leave
+  805f69:	c3                   	ret
+
+0000000000805f6a <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  805f6a:	55                   	push   %rbp
+  805f6b:	48 89 e5             	mov    %rsp,%rbp
+  805f6e:	48 83 ec 20          	sub    $0x20,%rsp
+  805f72:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805f75:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  805f78:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  805f7c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805f7f:	48 89 d6             	mov    %rdx,%rsi
+  805f82:	89 c7                	mov    %eax,%edi
+  805f84:	48 b8 fe 33 80 00 00 	movabs $0x8033fe,%rax
+  805f8b:	00 00 00 
+  805f8e:	ff d0                	call   *%rax
+  805f90:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805f93:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805f97:	79 05                	jns    805f9e <consmode+0x34>
+    return r;
+  805f99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805f9c:	eb 34                	jmp    805fd2 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805f9e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805fa2:	8b 10                	mov    (%rax),%edx
+  805fa4:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  805fab:	00 00 00 
+  805fae:	8b 00                	mov    (%rax),%eax
+  805fb0:	39 c2                	cmp    %eax,%edx
+  805fb2:	74 07                	je     805fbb <consmode+0x51>
+    return -E_INVAL;
+  805fb4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805fb9:	eb 17                	jmp    805fd2 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  805fbb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805fbf:	8b 40 0c             	mov    0xc(%rax),%eax
+  805fc2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805fc5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805fc9:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  805fcc:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805fcf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805fd2:	c9                   	leave
+  805fd3:	c3                   	ret
+
+0000000000805fd4 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805fd4:	55                   	push   %rbp
+  805fd5:	48 89 e5             	mov    %rsp,%rbp
+  805fd8:	48 83 ec 20          	sub    $0x20,%rsp
+  805fdc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805fe0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805fe4:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  805fe8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805fec:	8b 50 0c             	mov    0xc(%rax),%edx
+  805fef:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805ff3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805ff7:	48 89 ce             	mov    %rcx,%rsi
+  805ffa:	48 89 c7             	mov    %rax,%rdi
+  805ffd:	48 b8 61 27 80 00 00 	movabs $0x802761,%rax
+  806004:	00 00 00 
+  806007:	ff d0                	call   *%rax
+  806009:	48 98                	cltq
+}
+  80600b:	c9                   	leave
+  80600c:	c3                   	ret
+
+000000000080600d <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80600d:	55                   	push   %rbp
+  80600e:	48 89 e5             	mov    %rsp,%rbp
+  806011:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  806018:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  80601f:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  806026:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  80602d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806034:	eb 74                	jmp    8060aa <devcons_write+0x9d>
+    m = n - tot;
+  806036:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  80603d:	89 c2                	mov    %eax,%edx
+  80603f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806042:	29 c2                	sub    %eax,%edx
+  806044:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  806047:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80604a:	83 f8 7f             	cmp    $0x7f,%eax
+  80604d:	76 07                	jbe    806056 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  80604f:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  806056:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806059:	48 63 d0             	movslq %eax,%rdx
+  80605c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80605f:	48 63 c8             	movslq %eax,%rcx
+  806062:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  806069:	48 01 c1             	add    %rax,%rcx
+  80606c:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  806073:	48 89 ce             	mov    %rcx,%rsi
+  806076:	48 89 c7             	mov    %rax,%rdi
+  806079:	48 b8 7c 1b 80 00 00 	movabs $0x801b7c,%rax
+  806080:	00 00 00 
+  806083:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  806085:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  806088:	48 63 d0             	movslq %eax,%rdx
+  80608b:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  806092:	48 89 d6             	mov    %rdx,%rsi
+  806095:	48 89 c7             	mov    %rax,%rdi
+  806098:	48 b8 f0 21 80 00 00 	movabs $0x8021f0,%rax
+  80609f:	00 00 00 
+  8060a2:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  8060a4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8060a7:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8060aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060ad:	48 98                	cltq
+  8060af:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  8060b6:	0f 82 7a ff ff ff    	jb     806036 <devcons_write+0x29>
+  }
+  return tot;
+  8060bc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8060bf:	48 98                	cltq
+}
+  8060c1:	c9                   	leave
+  8060c2:	c3                   	ret
+
+00000000008060c3 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  8060c3:	55                   	push   %rbp
+  8060c4:	48 89 e5             	mov    %rsp,%rbp
+  8060c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8060cb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  8060cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8060d4:	c9                   	leave
+  8060d5:	c3                   	ret
+
+00000000008060d6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8060d6:	55                   	push   %rbp
+  8060d7:	48 89 e5             	mov    %rsp,%rbp
+  8060da:	48 83 ec 10          	sub    $0x10,%rsp
+  8060de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8060e2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  8060e6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8060ea:	48 ba 18 6f 80 00 00 	movabs $0x806f18,%rdx
+  8060f1:	00 00 00 
+  8060f4:	48 89 d6             	mov    %rdx,%rsi
+  8060f7:	48 89 c7             	mov    %rax,%rdi
+  8060fa:	48 b8 39 16 80 00 00 	movabs $0x801639,%rax
+  806101:	00 00 00 
+  806104:	ff d0                	call   *%rax
+  return 0;
+  806106:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80610b:	c9                   	leave
+  80610c:	c3                   	ret
+
+000000000080610d <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80610d:	55                   	push   %rbp
+  80610e:	48 89 e5             	mov    %rsp,%rbp
+  806111:	48 83 ec 30          	sub    $0x30,%rsp
+  806115:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  806119:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  80611c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  806120:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  806127:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80612a:	83 e0 02             	and    $0x2,%eax
+  80612d:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  806130:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806134:	8b 40 0c             	mov    0xc(%rax),%eax
+  806137:	83 f8 01             	cmp    $0x1,%eax
+  80613a:	75 04                	jne    806140 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  80613c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  806140:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  806143:	83 e0 01             	and    $0x1,%eax
+  806146:	85 c0                	test   %eax,%eax
+  806148:	74 44                	je     80618e <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  80614a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80614d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806152:	89 c2                	mov    %eax,%edx
+  806154:	be 00 00 00 00       	mov    $0x0,%esi
+  806159:	bf 00 00 00 00       	mov    $0x0,%edi
+  80615e:	48 b8 4f 28 80 00 00 	movabs $0x80284f,%rax
+  806165:	00 00 00 
+  806168:	ff d0                	call   *%rax
+  80616a:	83 f8 01             	cmp    $0x1,%eax
+  80616d:	75 06                	jne    806175 <devcons_poll+0x68>
+      revents |= POLLIN;
+  80616f:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  806173:	eb 19                	jmp    80618e <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  806175:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806179:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  80617f:	0b 45 fc             	or     -0x4(%rbp),%eax
+  806182:	89 c2                	mov    %eax,%edx
+  806184:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806188:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  80618e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  806191:	c9                   	leave
+  806192:	c3                   	ret
+
+0000000000806193 <set_pgfault_handler>:
+// allocate an exception stack (one page of memory with its top
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf)) {
+  806193:	55                   	push   %rbp
+  806194:	48 89 e5             	mov    %rsp,%rbp
+  806197:	48 83 ec 20          	sub    $0x20,%rsp
+  80619b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  envid_t envid;
+
+  int error;
+
+  envid = sys_getenvid();
+  80619f:	48 b8 8e 23 80 00 00 	movabs $0x80238e,%rax
+  8061a6:	00 00 00 
+  8061a9:	ff d0                	call   *%rax
+  8061ab:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (_pgfault_handler == 0) {
+  8061ae:	48 b8 40 a1 80 00 00 	movabs $0x80a140,%rax
+  8061b5:	00 00 00 
+  8061b8:	48 8b 00             	mov    (%rax),%rax
+  8061bb:	48 85 c0             	test   %rax,%rax
+  8061be:	75 62                	jne    806222 <set_pgfault_handler+0x8f>
+    // First time through!
+    // LAB 9: Your code here.
+    error = sys_page_alloc(envid, (void *)(UXSTACKTOP - PGSIZE), PTE_U | PTE_P | PTE_W);
+  8061c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8061c3:	ba 07 00 00 00       	mov    $0x7,%edx
+  8061c8:	48 b9 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rcx
+  8061cf:	00 00 00 
+  8061d2:	48 89 ce             	mov    %rcx,%rsi
+  8061d5:	89 c7                	mov    %eax,%edi
+  8061d7:	48 b8 07 24 80 00 00 	movabs $0x802407,%rax
+  8061de:	00 00 00 
+  8061e1:	ff d0                	call   *%rax
+  8061e3:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (error < 0) {
+  8061e6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8061ea:	79 36                	jns    806222 <set_pgfault_handler+0x8f>
+      panic("set_pgfault_handler: %i", error);
+  8061ec:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8061ef:	89 c1                	mov    %eax,%ecx
+  8061f1:	48 b8 1f 6f 80 00 00 	movabs $0x806f1f,%rax
+  8061f8:	00 00 00 
+  8061fb:	48 89 c2             	mov    %rax,%rdx
+  8061fe:	be 23 00 00 00       	mov    $0x23,%esi
+  806203:	48 b8 37 6f 80 00 00 	movabs $0x806f37,%rax
+  80620a:	00 00 00 
+  80620d:	48 89 c7             	mov    %rax,%rdi
+  806210:	b8 00 00 00 00       	mov    $0x0,%eax
+  806215:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  80621c:	00 00 00 
+  80621f:	41 ff d0             	call   *%r8
+    }
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  806222:	48 ba 40 a1 80 00 00 	movabs $0x80a140,%rdx
+  806229:	00 00 00 
+  80622c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806230:	48 89 02             	mov    %rax,(%rdx)
+  error            = sys_env_set_pgfault_upcall(envid, _pgfault_upcall);
+  806233:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806236:	48 ba 93 62 80 00 00 	movabs $0x806293,%rdx
+  80623d:	00 00 00 
+  806240:	48 89 d6             	mov    %rdx,%rsi
+  806243:	89 c7                	mov    %eax,%edi
+  806245:	48 b8 a4 25 80 00 00 	movabs $0x8025a4,%rax
+  80624c:	00 00 00 
+  80624f:	ff d0                	call   *%rax
+  806251:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if (error < 0)
+  806254:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  806258:	79 36                	jns    806290 <set_pgfault_handler+0xfd>
+    panic("set_pgfault_handler: %i", error);
+  80625a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80625d:	89 c1                	mov    %eax,%ecx
+  80625f:	48 b8 1f 6f 80 00 00 	movabs $0x806f1f,%rax
+  806266:	00 00 00 
+  806269:	48 89 c2             	mov    %rax,%rdx
+  80626c:	be 2b 00 00 00       	mov    $0x2b,%esi
+  806271:	48 b8 37 6f 80 00 00 	movabs $0x806f37,%rax
+  806278:	00 00 00 
+  80627b:	48 89 c7             	mov    %rax,%rdi
+  80627e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806283:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  80628a:	00 00 00 
+  80628d:	41 ff d0             	call   *%r8
+}
+  806290:	90                   	nop
+  806291:	c9                   	leave
+  806292:	c3                   	ret
+
+0000000000806293 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	movq  %rsp,%rdi                // passing the function argument in rdi
+  806293:	48 89 e7             	mov    %rsp,%rdi
+
+	// The handler may use SSE (memcpy in the COW handler does), so
+	// save the interrupted code's x87/SSE state in a 16-byte aligned
+	// area below the UTrapframe.  %rbx was saved in the UTrapframe
+	// and is callee-saved, so it keeps the UTrapframe's address.
+	movq  %rsp,%rbx
+  806296:	48 89 e3             	mov    %rsp,%rbx
+	subq  $512,%rsp
+  806299:	48 81 ec 00 02 00 00 	sub    $0x200,%rsp
+	andq  $~15,%rsp
+  8062a0:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+	fxsave64 (%rsp)
+  8062a4:	48 0f ae 04 24       	fxsave64 (%rsp)
+	movabs _pgfault_handler, %rax
+  8062a9:	48 a1 40 a1 80 00 00 	movabs 0x80a140,%rax
+  8062b0:	00 00 00 
+	call *%rax
+  8062b3:	ff d0                	call   *%rax
+	fxrstor64 (%rsp)
+  8062b5:	48 0f ae 0c 24       	fxrstor64 (%rsp)
+	movq  %rbx,%rsp
+  8062ba:	48 89 dc             	mov    %rbx,%rsp
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 9: Your code here.
+
+	popq %r15
+  8062bd:	41 5f                	pop    %r15
+	popq %r15
+  8062bf:	41 5f                	pop    %r15
+	popq %r15
+  8062c1:	41 5f                	pop    %r15
+	popq %r14
+  8062c3:	41 5e                	pop    %r14
+	popq %r13
+  8062c5:	41 5d                	pop    %r13
+	popq %r12
+  8062c7:	41 5c                	pop    %r12
+	popq %r11
+  8062c9:	41 5b                	pop    %r11
+	popq %r10
+  8062cb:	41 5a                	pop    %r10
+	popq %r9
+  8062cd:	41 59                	pop    %r9
+	popq %r8
+  8062cf:	41 58                	pop    %r8
+	popq %rsi
+  8062d1:	5e                   	pop    %rsi
+	popq %rdi
+  8062d2:	5f                   	pop    %rdi
+	popq %rbp
+  8062d3:	5d                   	pop    %rbp
+	popq %rdx
+  8062d4:	5a                   	pop    %rdx
+	popq %rcx
+  8062d5:	59                   	pop    %rcx
+
+	// Push trap-time %rip onto the trap-time stack. Do it here in order not to deal with too large offsets from rsp
+	movq 32(%rsp), %rbx
+  8062d6:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8062db:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8062e0:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8062e4:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8062e7:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+
+	popq %rbx
+  8062ec:	5b                   	pop    %rbx
+	popq %rax
+  8062ed:	58                   	pop    %rax
+	// Restore rflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies rflags.
+	// LAB 9: Your code here.
+
+	pushq 8(%rsp)
+  8062ee:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8062f2:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 9: Your code here.
+
+	movq 16(%rsp), %rsp
+  8062f3:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 9: Your code here.
+
+  8062f8:	c3                   	ret
+
+00000000008062f9 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  8062f9:	55                   	push   %rbp
+  8062fa:	48 89 e5             	mov    %rsp,%rbp
+  8062fd:	48 83 ec 20          	sub    $0x20,%rsp
+  806301:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  806305:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  806309:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  80630d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  806311:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  806315:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806319:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  806320:	48 89 c7             	mov    %rax,%rdi
+  806323:	48 b8 31 63 80 00 00 	movabs $0x806331,%rax
+  80632a:	00 00 00 
+  80632d:	ff d0                	call   *%rax
+}
+  80632f:	c9                   	leave
+  806330:	c3                   	ret
+
+0000000000806331 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  806331:	55                   	push   %rbp
+  806332:	48 89 e5             	mov    %rsp,%rbp
+  806335:	48 83 ec 30          	sub    $0x30,%rsp
+  806339:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80633d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  806341:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  806345:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  806349:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80634e:	75 0e                	jne    80635e <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  806350:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806357:	00 00 00 
+  80635a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  80635e:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  806363:	75 18                	jne    80637d <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  806365:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806369:	48 89 c7             	mov    %rax,%rdi
+  80636c:	48 b8 47 26 80 00 00 	movabs $0x802647,%rax
+  806373:	00 00 00 
+  806376:	ff d0                	call   *%rax
+  806378:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80637b:	eb 1d                	jmp    80639a <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  80637d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  806381:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806385:	48 89 d6             	mov    %rdx,%rsi
+  806388:	48 89 c7             	mov    %rax,%rdi
+  80638b:	48 b8 8d 26 80 00 00 	movabs $0x80268d,%rax
+  806392:	00 00 00 
+  806395:	ff d0                	call   *%rax
+  806397:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  80639a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80639e:	79 2a                	jns    8063ca <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  8063a0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8063a5:	74 0a                	je     8063b1 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  8063a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8063ab:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  8063b1:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8063b6:	74 0a                	je     8063c2 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  8063b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8063bc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  8063c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8063c5:	e9 aa 00 00 00       	jmp    806474 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  8063ca:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8063cf:	74 36                	je     806407 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  8063d1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8063d8:	00 00 00 
+  8063db:	8b 40 04             	mov    0x4(%rax),%eax
+  8063de:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8063e3:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8063ea:	00 00 00 
+  8063ed:	48 98                	cltq
+  8063ef:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8063f6:	48 01 d0             	add    %rdx,%rax
+  8063f9:	48 05 24 01 00 00    	add    $0x124,%rax
+  8063ff:	8b 10                	mov    (%rax),%edx
+  806401:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806405:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  806407:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80640c:	74 36                	je     806444 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  80640e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  806415:	00 00 00 
+  806418:	8b 40 04             	mov    0x4(%rax),%eax
+  80641b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806420:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806427:	00 00 00 
+  80642a:	48 98                	cltq
+  80642c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806433:	48 01 d0             	add    %rdx,%rax
+  806436:	48 05 28 01 00 00    	add    $0x128,%rax
+  80643c:	8b 10                	mov    (%rax),%edx
+  80643e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  806442:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  806444:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80644b:	00 00 00 
+  80644e:	8b 40 04             	mov    0x4(%rax),%eax
+  806451:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806456:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80645d:	00 00 00 
+  806460:	48 98                	cltq
+  806462:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806469:	48 01 d0             	add    %rdx,%rax
+  80646c:	48 05 20 01 00 00    	add    $0x120,%rax
+  806472:	8b 00                	mov    (%rax),%eax
+  }
+}
+  806474:	c9                   	leave
+  806475:	c3                   	ret
+
+0000000000806476 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  806476:	55                   	push   %rbp
+  806477:	48 89 e5             	mov    %rsp,%rbp
+  80647a:	48 83 ec 30          	sub    $0x30,%rsp
+  80647e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  806481:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  806484:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  806488:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80648b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  806490:	75 5e                	jne    8064f0 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  806492:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806499:	00 00 00 
+  80649c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8064a0:	eb 4e                	jmp    8064f0 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  8064a2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8064a6:	79 3c                	jns    8064e4 <ipc_send+0x6e>
+  8064a8:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  8064ac:	74 36                	je     8064e4 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  8064ae:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8064b1:	89 c1                	mov    %eax,%ecx
+  8064b3:	48 b8 48 6f 80 00 00 	movabs $0x806f48,%rax
+  8064ba:	00 00 00 
+  8064bd:	48 89 c2             	mov    %rax,%rdx
+  8064c0:	be 54 00 00 00       	mov    $0x54,%esi
+  8064c5:	48 b8 6e 6f 80 00 00 	movabs $0x806f6e,%rax
+  8064cc:	00 00 00 
+  8064cf:	48 89 c7             	mov    %rax,%rdi
+  8064d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8064d7:	49 b8 6a 04 80 00 00 	movabs $0x80046a,%r8
+  8064de:	00 00 00 
+  8064e1:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  8064e4:	48 b8 ca 23 80 00 00 	movabs $0x8023ca,%rax
+  8064eb:	00 00 00 
+  8064ee:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  8064f0:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  8064f3:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8064f6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8064fa:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8064fd:	89 c7                	mov    %eax,%edi
+  8064ff:	48 b8 f0 25 80 00 00 	movabs $0x8025f0,%rax
+  806506:	00 00 00 
+  806509:	ff d0                	call   *%rax
+  80650b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80650e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  806512:	75 8e                	jne    8064a2 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  806514:	48 b8 ca 23 80 00 00 	movabs $0x8023ca,%rax
+  80651b:	00 00 00 
+  80651e:	ff d0                	call   *%rax
+}
+  806520:	90                   	nop
+  806521:	c9                   	leave
+  806522:	c3                   	ret
+
+0000000000806523 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  806523:	55                   	push   %rbp
+  806524:	48 89 e5             	mov    %rsp,%rbp
+  806527:	48 83 ec 18          	sub    $0x18,%rsp
+  80652b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  80652e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  806535:	eb 4d                	jmp    806584 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  806537:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80653e:	00 00 00 
+  806541:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  806544:	48 98                	cltq
+  806546:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80654d:	48 01 d0             	add    %rdx,%rax
+  806550:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  806556:	8b 00                	mov    (%rax),%eax
+  806558:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  80655b:	75 23                	jne    806580 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  80655d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  806564:	00 00 00 
+  806567:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80656a:	48 98                	cltq
+  80656c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  806573:	48 01 d0             	add    %rdx,%rax
+  806576:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80657c:	8b 00                	mov    (%rax),%eax
+  80657e:	eb 12                	jmp    806592 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  806580:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  806584:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80658b:	7e aa                	jle    806537 <ipc_find_env+0x14>
+  return 0;
+  80658d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  806592:	c9                   	leave
+  806593:	c3                   	ret
+
+0000000000806594 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  806594:	55                   	push   %rbp
+  806595:	48 89 e5             	mov    %rsp,%rbp
+  806598:	48 83 ec 18          	sub    $0x18,%rsp
+  80659c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  8065a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065a4:	48 c1 e8 27          	shr    $0x27,%rax
+  8065a8:	25 ff 01 00 00       	and    $0x1ff,%eax
+  8065ad:	48 89 c2             	mov    %rax,%rdx
+  8065b0:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8065b7:	01 00 00 
+  8065ba:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8065be:	83 e0 01             	and    $0x1,%eax
+  8065c1:	48 85 c0             	test   %rax,%rax
+  8065c4:	74 63                	je     806629 <pageref+0x95>
+  8065c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065ca:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8065ce:	48 89 c2             	mov    %rax,%rdx
+  8065d1:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8065d8:	01 00 00 
+  8065db:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8065df:	83 e0 01             	and    $0x1,%eax
+  8065e2:	48 85 c0             	test   %rax,%rax
+  8065e5:	74 42                	je     806629 <pageref+0x95>
+  8065e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8065eb:	48 c1 e8 15          	shr    $0x15,%rax
+  8065ef:	48 89 c2             	mov    %rax,%rdx
+  8065f2:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8065f9:	01 00 00 
+  8065fc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806600:	83 e0 01             	and    $0x1,%eax
+  806603:	48 85 c0             	test   %rax,%rax
+  806606:	74 21                	je     806629 <pageref+0x95>
+  806608:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80660c:	48 c1 e8 0c          	shr    $0xc,%rax
+  806610:	48 89 c2             	mov    %rax,%rdx
+  806613:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80661a:	01 00 00 
+  80661d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806621:	83 e0 01             	and    $0x1,%eax
+  806624:	48 85 c0             	test   %rax,%rax
+  806627:	75 07                	jne    806630 <pageref+0x9c>
+    return 0;
+  806629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80662e:	eb 53                	jmp    806683 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  806630:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  806634:	48 c1 e8 0c          	shr    $0xc,%rax
+  806638:	48 89 c2             	mov    %rax,%rdx
+  80663b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  806642:	01 00 00 
+  806645:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  806649:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  80664d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806651:	83 e0 01             	and    $0x1,%eax
+  806654:	48 85 c0             	test   %rax,%rax
+  806657:	75 07                	jne    806660 <pageref+0xcc>
+    return 0;
+  806659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80665e:	eb 23                	jmp    806683 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  806660:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  806664:	48 c1 e8 0c          	shr    $0xc,%rax
+  806668:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  80666f:	00 00 00 
+  806672:	48 c1 e0 04          	shl    $0x4,%rax
+  806676:	48 01 d0             	add    %rdx,%rax
+  806679:	48 83 c0 08          	add    $0x8,%rax
+  80667d:	0f b7 00             	movzwl (%rax),%eax
+  806680:	0f b7 c0             	movzwl %ax,%eax
+}
+  806683:	c9                   	leave
+  806684:	c3                   	ret
+  806685:	0f 1f 00             	nopl   (%rax)
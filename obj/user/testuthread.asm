@@ -0,0 +1,9449 @@
+
+obj/user/testuthread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 e7 03 00 00       	call   800413 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <spinner>:
+
+static int counter;
+static int p[2];
+
+static void
+spinner(void *arg) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+
+  for (i = 0; i < ROUNDS; i++) {
+  80003e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800045:	eb 2b                	jmp    800072 <spinner+0x40>
+    counter++;
+  800047:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80004e:	00 00 00 
+  800051:	8b 00                	mov    (%rax),%eax
+  800053:	8d 50 01             	lea    0x1(%rax),%edx
+  800056:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  80005d:	00 00 00 
+  800060:	89 10                	mov    %edx,(%rax)
+    uthread_yield();
+  800062:	48 b8 a3 52 80 00 00 	movabs $0x8052a3,%rax
+  800069:	00 00 00 
+  80006c:	ff d0                	call   *%rax
+  for (i = 0; i < ROUNDS; i++) {
+  80006e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800072:	83 7d fc 09          	cmpl   $0x9,-0x4(%rbp)
+  800076:	7e cf                	jle    800047 <spinner+0x15>
+  }
+}
+  800078:	90                   	nop
+  800079:	90                   	nop
+  80007a:	c9                   	leave
+  80007b:	c3                   	ret
+
+000000000080007c <reader>:
+
+// The reader runs first and finds the pipe empty, so it must wait
+// without stopping the writer.
+static void
+reader(void *arg) {
+  80007c:	55                   	push   %rbp
+  80007d:	48 89 e5             	mov    %rsp,%rbp
+  800080:	48 83 ec 20          	sub    $0x20,%rsp
+  800084:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i, x;
+
+  for (i = 0; i < NMSGS; i++) {
+  800088:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80008f:	e9 a4 00 00 00       	jmp    800138 <reader+0xbc>
+    if (uthread_read(p[0], &x, sizeof(x)) != sizeof(x))
+  800094:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  80009b:	00 00 00 
+  80009e:	8b 00                	mov    (%rax),%eax
+  8000a0:	48 8d 4d f8          	lea    -0x8(%rbp),%rcx
+  8000a4:	ba 04 00 00 00       	mov    $0x4,%edx
+  8000a9:	48 89 ce             	mov    %rcx,%rsi
+  8000ac:	89 c7                	mov    %eax,%edi
+  8000ae:	48 b8 b3 55 80 00 00 	movabs $0x8055b3,%rax
+  8000b5:	00 00 00 
+  8000b8:	ff d0                	call   *%rax
+  8000ba:	48 83 f8 04          	cmp    $0x4,%rax
+  8000be:	74 30                	je     8000f0 <reader+0x74>
+      panic("short read");
+  8000c0:	48 b8 a0 5e 80 00 00 	movabs $0x805ea0,%rax
+  8000c7:	00 00 00 
+  8000ca:	48 89 c2             	mov    %rax,%rdx
+  8000cd:	be 1c 00 00 00       	mov    $0x1c,%esi
+  8000d2:	48 b8 ab 5e 80 00 00 	movabs $0x805eab,%rax
+  8000d9:	00 00 00 
+  8000dc:	48 89 c7             	mov    %rax,%rdi
+  8000df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e4:	48 b9 ba 04 80 00 00 	movabs $0x8004ba,%rcx
+  8000eb:	00 00 00 
+  8000ee:	ff d1                	call   *%rcx
+    if (x != i)
+  8000f0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000f3:	39 45 fc             	cmp    %eax,-0x4(%rbp)
+  8000f6:	74 3c                	je     800134 <reader+0xb8>
+      panic("read %d, expected %d", x, i);
+  8000f8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8000fb:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8000fe:	41 89 d0             	mov    %edx,%r8d
+  800101:	89 c1                	mov    %eax,%ecx
+  800103:	48 b8 be 5e 80 00 00 	movabs $0x805ebe,%rax
+  80010a:	00 00 00 
+  80010d:	48 89 c2             	mov    %rax,%rdx
+  800110:	be 1e 00 00 00       	mov    $0x1e,%esi
+  800115:	48 b8 ab 5e 80 00 00 	movabs $0x805eab,%rax
+  80011c:	00 00 00 
+  80011f:	48 89 c7             	mov    %rax,%rdi
+  800122:	b8 00 00 00 00       	mov    $0x0,%eax
+  800127:	49 b9 ba 04 80 00 00 	movabs $0x8004ba,%r9
+  80012e:	00 00 00 
+  800131:	41 ff d1             	call   *%r9
+  for (i = 0; i < NMSGS; i++) {
+  800134:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800138:	83 7d fc 63          	cmpl   $0x63,-0x4(%rbp)
+  80013c:	0f 8e 52 ff ff ff    	jle    800094 <reader+0x18>
+  }
+  cprintf("reader got %d messages\n", NMSGS);
+  800142:	be 64 00 00 00       	mov    $0x64,%esi
+  800147:	48 b8 d3 5e 80 00 00 	movabs $0x805ed3,%rax
+  80014e:	00 00 00 
+  800151:	48 89 c7             	mov    %rax,%rdi
+  800154:	b8 00 00 00 00       	mov    $0x0,%eax
+  800159:	48 ba d9 06 80 00 00 	movabs $0x8006d9,%rdx
+  800160:	00 00 00 
+  800163:	ff d2                	call   *%rdx
+}
+  800165:	90                   	nop
+  800166:	c9                   	leave
+  800167:	c3                   	ret
+
+0000000000800168 <writer>:
+
+static void
+writer(void *arg) {
+  800168:	55                   	push   %rbp
+  800169:	48 89 e5             	mov    %rsp,%rbp
+  80016c:	48 83 ec 20          	sub    $0x20,%rsp
+  800170:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+
+  for (i = 0; i < NMSGS; i++) {
+  800174:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80017b:	e9 a0 00 00 00       	jmp    800220 <writer+0xb8>
+    if (uthread_write(p[1], &i, sizeof(i)) != sizeof(i))
+  800180:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  800187:	00 00 00 
+  80018a:	8b 40 04             	mov    0x4(%rax),%eax
+  80018d:	48 8d 4d fc          	lea    -0x4(%rbp),%rcx
+  800191:	ba 04 00 00 00       	mov    $0x4,%edx
+  800196:	48 89 ce             	mov    %rcx,%rsi
+  800199:	89 c7                	mov    %eax,%edi
+  80019b:	48 b8 0a 56 80 00 00 	movabs $0x80560a,%rax
+  8001a2:	00 00 00 
+  8001a5:	ff d0                	call   *%rax
+  8001a7:	48 83 f8 04          	cmp    $0x4,%rax
+  8001ab:	74 30                	je     8001dd <writer+0x75>
+      panic("short write");
+  8001ad:	48 b8 eb 5e 80 00 00 	movabs $0x805eeb,%rax
+  8001b4:	00 00 00 
+  8001b7:	48 89 c2             	mov    %rax,%rdx
+  8001ba:	be 29 00 00 00       	mov    $0x29,%esi
+  8001bf:	48 b8 ab 5e 80 00 00 	movabs $0x805eab,%rax
+  8001c6:	00 00 00 
+  8001c9:	48 89 c7             	mov    %rax,%rdi
+  8001cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d1:	48 b9 ba 04 80 00 00 	movabs $0x8004ba,%rcx
+  8001d8:	00 00 00 
+  8001db:	ff d1                	call   *%rcx
+    if (i % 10 == 0)
+  8001dd:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  8001e0:	48 63 c1             	movslq %ecx,%rax
+  8001e3:	48 69 c0 67 66 66 66 	imul   $0x66666667,%rax,%rax
+  8001ea:	48 c1 e8 20          	shr    $0x20,%rax
+  8001ee:	89 c2                	mov    %eax,%edx
+  8001f0:	c1 fa 02             	sar    $0x2,%edx
+  8001f3:	89 c8                	mov    %ecx,%eax
+  8001f5:	c1 f8 1f             	sar    $0x1f,%eax
+  8001f8:	29 c2                	sub    %eax,%edx
+  8001fa:	89 d0                	mov    %edx,%eax
+  8001fc:	c1 e0 02             	shl    $0x2,%eax
+  8001ff:	01 d0                	add    %edx,%eax
+  800201:	01 c0                	add    %eax,%eax
+  800203:	29 c1                	sub    %eax,%ecx
+  800205:	89 ca                	mov    %ecx,%edx
+  800207:	85 d2                	test   %edx,%edx
+  800209:	75 0c                	jne    800217 <writer+0xaf>
+      uthread_yield();
+  80020b:	48 b8 a3 52 80 00 00 	movabs $0x8052a3,%rax
+  800212:	00 00 00 
+  800215:	ff d0                	call   *%rax
+  for (i = 0; i < NMSGS; i++) {
+  800217:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80021a:	83 c0 01             	add    $0x1,%eax
+  80021d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800220:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800223:	83 f8 63             	cmp    $0x63,%eax
+  800226:	0f 8e 54 ff ff ff    	jle    800180 <writer+0x18>
+  }
+}
+  80022c:	90                   	nop
+  80022d:	90                   	nop
+  80022e:	c9                   	leave
+  80022f:	c3                   	ret
+
+0000000000800230 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800230:	55                   	push   %rbp
+  800231:	48 89 e5             	mov    %rsp,%rbp
+  800234:	48 83 ec 20          	sub    $0x20,%rsp
+  800238:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80023b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i, r;
+
+  if ((r = pipe(p)) < 0)
+  80023f:	48 b8 08 80 80 00 00 	movabs $0x808008,%rax
+  800246:	00 00 00 
+  800249:	48 89 c7             	mov    %rax,%rdi
+  80024c:	48 b8 6a 40 80 00 00 	movabs $0x80406a,%rax
+  800253:	00 00 00 
+  800256:	ff d0                	call   *%rax
+  800258:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80025b:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80025f:	79 36                	jns    800297 <umain+0x67>
+    panic("pipe: %i", r);
+  800261:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800264:	89 c1                	mov    %eax,%ecx
+  800266:	48 b8 f7 5e 80 00 00 	movabs $0x805ef7,%rax
+  80026d:	00 00 00 
+  800270:	48 89 c2             	mov    %rax,%rdx
+  800273:	be 34 00 00 00       	mov    $0x34,%esi
+  800278:	48 b8 ab 5e 80 00 00 	movabs $0x805eab,%rax
+  80027f:	00 00 00 
+  800282:	48 89 c7             	mov    %rax,%rdi
+  800285:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028a:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  800291:	00 00 00 
+  800294:	41 ff d0             	call   *%r8
+  if ((r = uthread_create(reader, NULL)) < 0 ||
+  800297:	be 00 00 00 00       	mov    $0x0,%esi
+  80029c:	48 b8 7c 00 80 00 00 	movabs $0x80007c,%rax
+  8002a3:	00 00 00 
+  8002a6:	48 89 c7             	mov    %rax,%rdi
+  8002a9:	48 b8 e9 50 80 00 00 	movabs $0x8050e9,%rax
+  8002b0:	00 00 00 
+  8002b3:	ff d0                	call   *%rax
+  8002b5:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8002b8:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8002bc:	78 27                	js     8002e5 <umain+0xb5>
+      (r = uthread_create(writer, NULL)) < 0)
+  8002be:	be 00 00 00 00       	mov    $0x0,%esi
+  8002c3:	48 b8 68 01 80 00 00 	movabs $0x800168,%rax
+  8002ca:	00 00 00 
+  8002cd:	48 89 c7             	mov    %rax,%rdi
+  8002d0:	48 b8 e9 50 80 00 00 	movabs $0x8050e9,%rax
+  8002d7:	00 00 00 
+  8002da:	ff d0                	call   *%rax
+  8002dc:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  if ((r = uthread_create(reader, NULL)) < 0 ||
+  8002df:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8002e3:	79 36                	jns    80031b <umain+0xeb>
+    panic("uthread_create: %i", r);
+  8002e5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8002e8:	89 c1                	mov    %eax,%ecx
+  8002ea:	48 b8 00 5f 80 00 00 	movabs $0x805f00,%rax
+  8002f1:	00 00 00 
+  8002f4:	48 89 c2             	mov    %rax,%rdx
+  8002f7:	be 37 00 00 00       	mov    $0x37,%esi
+  8002fc:	48 b8 ab 5e 80 00 00 	movabs $0x805eab,%rax
+  800303:	00 00 00 
+  800306:	48 89 c7             	mov    %rax,%rdi
+  800309:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030e:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  800315:	00 00 00 
+  800318:	41 ff d0             	call   *%r8
+  for (i = 0; i < NTASKS; i++) {
+  80031b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800322:	eb 61                	jmp    800385 <umain+0x155>
+    if ((r = uthread_create(spinner, NULL)) < 0)
+  800324:	be 00 00 00 00       	mov    $0x0,%esi
+  800329:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  800330:	00 00 00 
+  800333:	48 89 c7             	mov    %rax,%rdi
+  800336:	48 b8 e9 50 80 00 00 	movabs $0x8050e9,%rax
+  80033d:	00 00 00 
+  800340:	ff d0                	call   *%rax
+  800342:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  800345:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800349:	79 36                	jns    800381 <umain+0x151>
+      panic("uthread_create: %i", r);
+  80034b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80034e:	89 c1                	mov    %eax,%ecx
+  800350:	48 b8 00 5f 80 00 00 	movabs $0x805f00,%rax
+  800357:	00 00 00 
+  80035a:	48 89 c2             	mov    %rax,%rdx
+  80035d:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800362:	48 b8 ab 5e 80 00 00 	movabs $0x805eab,%rax
+  800369:	00 00 00 
+  80036c:	48 89 c7             	mov    %rax,%rdi
+  80036f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800374:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  80037b:	00 00 00 
+  80037e:	41 ff d0             	call   *%r8
+  for (i = 0; i < NTASKS; i++) {
+  800381:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800385:	81 7d fc ff 00 00 00 	cmpl   $0xff,-0x4(%rbp)
+  80038c:	7e 96                	jle    800324 <umain+0xf4>
+  }
+  uthread_run();
+  80038e:	48 b8 b8 53 80 00 00 	movabs $0x8053b8,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+
+  if (counter != NTASKS * ROUNDS)
+  80039a:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8003a1:	00 00 00 
+  8003a4:	8b 00                	mov    (%rax),%eax
+  8003a6:	3d 00 0a 00 00       	cmp    $0xa00,%eax
+  8003ab:	74 45                	je     8003f2 <umain+0x1c2>
+    panic("counter is %d, expected %d", counter, NTASKS * ROUNDS);
+  8003ad:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8003b4:	00 00 00 
+  8003b7:	8b 00                	mov    (%rax),%eax
+  8003b9:	41 b8 00 0a 00 00    	mov    $0xa00,%r8d
+  8003bf:	89 c1                	mov    %eax,%ecx
+  8003c1:	48 b8 13 5f 80 00 00 	movabs $0x805f13,%rax
+  8003c8:	00 00 00 
+  8003cb:	48 89 c2             	mov    %rax,%rdx
+  8003ce:	be 3f 00 00 00       	mov    $0x3f,%esi
+  8003d3:	48 b8 ab 5e 80 00 00 	movabs $0x805eab,%rax
+  8003da:	00 00 00 
+  8003dd:	48 89 c7             	mov    %rax,%rdi
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	49 b9 ba 04 80 00 00 	movabs $0x8004ba,%r9
+  8003ec:	00 00 00 
+  8003ef:	41 ff d1             	call   *%r9
+  cprintf("uthread test passed\n");
+  8003f2:	48 b8 2e 5f 80 00 00 	movabs $0x805f2e,%rax
+  8003f9:	00 00 00 
+  8003fc:	48 89 c7             	mov    %rax,%rdi
+  8003ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800404:	48 ba d9 06 80 00 00 	movabs $0x8006d9,%rdx
+  80040b:	00 00 00 
+  80040e:	ff d2                	call   *%rdx
+}
+  800410:	90                   	nop
+  800411:	c9                   	leave
+  800412:	c3                   	ret
+
+0000000000800413 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800413:	55                   	push   %rbp
+  800414:	48 89 e5             	mov    %rsp,%rbp
+  800417:	48 83 ec 20          	sub    $0x20,%rsp
+  80041b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80041e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800422:	48 b8 20 71 80 00 00 	movabs $0x807120,%rax
+  800429:	00 00 00 
+  80042c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800430:	eb 13                	jmp    800445 <libmain+0x32>
+    (*ctor)();
+  800432:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800436:	48 8b 10             	mov    (%rax),%rdx
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	ff d2                	call   *%rdx
+    ctor++;
+  800440:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800445:	48 b8 20 71 80 00 00 	movabs $0x807120,%rax
+  80044c:	00 00 00 
+  80044f:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800453:	72 dd                	jb     800432 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800455:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  800459:	7e 14                	jle    80046f <libmain+0x5c>
+    binaryname = argv[0];
+  80045b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80045f:	48 8b 00             	mov    (%rax),%rax
+  800462:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  800469:	00 00 00 
+  80046c:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  80046f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800473:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800476:	48 89 d6             	mov    %rdx,%rsi
+  800479:	89 c7                	mov    %eax,%edi
+  80047b:	48 b8 30 02 80 00 00 	movabs $0x800230,%rax
+  800482:	00 00 00 
+  800485:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800487:	48 b8 96 04 80 00 00 	movabs $0x800496,%rax
+  80048e:	00 00 00 
+  800491:	ff d0                	call   *%rax
+#endif
+}
+  800493:	90                   	nop
+  800494:	c9                   	leave
+  800495:	c3                   	ret
+
+0000000000800496 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800496:	55                   	push   %rbp
+  800497:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80049a:	48 b8 2e 2f 80 00 00 	movabs $0x802f2e,%rax
+  8004a1:	00 00 00 
+  8004a4:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8004a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004ab:	48 b8 0f 23 80 00 00 	movabs $0x80230f,%rax
+  8004b2:	00 00 00 
+  8004b5:	ff d0                	call   *%rax
+}
+  8004b7:	90                   	nop
+  8004b8:	5d                   	pop    %rbp
+  8004b9:	c3                   	ret
+
+00000000008004ba <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004ba:	55                   	push   %rbp
+  8004bb:	48 89 e5             	mov    %rsp,%rbp
+  8004be:	53                   	push   %rbx
+  8004bf:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  8004c6:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  8004cd:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  8004d3:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  8004da:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  8004e1:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  8004e8:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  8004ef:	84 c0                	test   %al,%al
+  8004f1:	74 23                	je     800516 <_panic+0x5c>
+  8004f3:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  8004fa:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  8004fe:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800502:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800506:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80050a:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80050e:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  800512:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800516:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  80051d:	00 00 00 
+  800520:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  800527:	00 00 00 
+  80052a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80052e:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  800535:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  80053c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800543:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80054a:	00 00 00 
+  80054d:	48 8b 18             	mov    (%rax),%rbx
+  800550:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  800557:	00 00 00 
+  80055a:	ff d0                	call   *%rax
+  80055c:	89 c6                	mov    %eax,%esi
+  80055e:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  800564:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  80056b:	41 89 d0             	mov    %edx,%r8d
+  80056e:	48 89 c1             	mov    %rax,%rcx
+  800571:	48 89 da             	mov    %rbx,%rdx
+  800574:	48 b8 50 5f 80 00 00 	movabs $0x805f50,%rax
+  80057b:	00 00 00 
+  80057e:	48 89 c7             	mov    %rax,%rdi
+  800581:	b8 00 00 00 00       	mov    $0x0,%eax
+  800586:	49 b9 d9 06 80 00 00 	movabs $0x8006d9,%r9
+  80058d:	00 00 00 
+  800590:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800593:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80059a:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  8005a1:	48 89 d6             	mov    %rdx,%rsi
+  8005a4:	48 89 c7             	mov    %rax,%rdi
+  8005a7:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  8005ae:	00 00 00 
+  8005b1:	ff d0                	call   *%rax
+  cprintf("\n");
+  8005b3:	48 b8 73 5f 80 00 00 	movabs $0x805f73,%rax
+  8005ba:	00 00 00 
+  8005bd:	48 89 c7             	mov    %rax,%rdi
+  8005c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c5:	48 ba d9 06 80 00 00 	movabs $0x8006d9,%rdx
+  8005cc:	00 00 00 
+  8005cf:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  8005d1:	cc                   	int3
+  8005d2:	eb fd                	jmp    8005d1 <_panic+0x117>
+
+00000000008005d4 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8005d4:	55                   	push   %rbp
+  8005d5:	48 89 e5             	mov    %rsp,%rbp
+  8005d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8005dc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8005df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  8005e3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8005e7:	8b 00                	mov    (%rax),%eax
+  8005e9:	8d 48 01             	lea    0x1(%rax),%ecx
+  8005ec:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005f0:	89 0a                	mov    %ecx,(%rdx)
+  8005f2:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8005f5:	89 d1                	mov    %edx,%ecx
+  8005f7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8005fb:	48 98                	cltq
+  8005fd:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800601:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800605:	8b 00                	mov    (%rax),%eax
+  800607:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80060c:	75 2c                	jne    80063a <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80060e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800612:	8b 00                	mov    (%rax),%eax
+  800614:	48 98                	cltq
+  800616:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80061a:	48 83 c2 08          	add    $0x8,%rdx
+  80061e:	48 89 c6             	mov    %rax,%rsi
+  800621:	48 89 d7             	mov    %rdx,%rdi
+  800624:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  80062b:	00 00 00 
+  80062e:	ff d0                	call   *%rax
+    b->idx = 0;
+  800630:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800634:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  80063a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80063e:	8b 40 04             	mov    0x4(%rax),%eax
+  800641:	8d 50 01             	lea    0x1(%rax),%edx
+  800644:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800648:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80064b:	90                   	nop
+  80064c:	c9                   	leave
+  80064d:	c3                   	ret
+
+000000000080064e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80064e:	55                   	push   %rbp
+  80064f:	48 89 e5             	mov    %rsp,%rbp
+  800652:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800659:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800660:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800667:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  80066e:	00 00 00 
+  b.cnt = 0;
+  800671:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800678:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80067b:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800682:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  800689:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800690:	48 89 c6             	mov    %rax,%rsi
+  800693:	48 b8 d4 05 80 00 00 	movabs $0x8005d4,%rax
+  80069a:	00 00 00 
+  80069d:	48 89 c7             	mov    %rax,%rdi
+  8006a0:	48 b8 33 0a 80 00 00 	movabs $0x800a33,%rax
+  8006a7:	00 00 00 
+  8006aa:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8006ac:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8006b2:	48 98                	cltq
+  8006b4:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8006bb:	48 83 c2 08          	add    $0x8,%rdx
+  8006bf:	48 89 c6             	mov    %rax,%rsi
+  8006c2:	48 89 d7             	mov    %rdx,%rdi
+  8006c5:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  8006cc:	00 00 00 
+  8006cf:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8006d1:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  8006d7:	c9                   	leave
+  8006d8:	c3                   	ret
+
+00000000008006d9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8006d9:	55                   	push   %rbp
+  8006da:	48 89 e5             	mov    %rsp,%rbp
+  8006dd:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  8006e4:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8006eb:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  8006f2:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  8006f9:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800700:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800707:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80070e:	84 c0                	test   %al,%al
+  800710:	74 20                	je     800732 <cprintf+0x59>
+  800712:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800716:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  80071a:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  80071e:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800722:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800726:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  80072a:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  80072e:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800732:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800739:	00 00 00 
+  80073c:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800743:	00 00 00 
+  800746:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80074a:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800751:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800758:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  80075f:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  800766:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  80076d:	48 89 d6             	mov    %rdx,%rsi
+  800770:	48 89 c7             	mov    %rax,%rdi
+  800773:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  80077a:	00 00 00 
+  80077d:	ff d0                	call   *%rax
+  80077f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800785:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80078b:	c9                   	leave
+  80078c:	c3                   	ret
+
+000000000080078d <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80078d:	55                   	push   %rbp
+  80078e:	48 89 e5             	mov    %rsp,%rbp
+  800791:	48 83 ec 30          	sub    $0x30,%rsp
+  800795:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800799:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80079d:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8007a1:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8007a4:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8007a8:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8007ac:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8007af:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8007b3:	72 54                	jb     800809 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8007b5:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8007b8:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8007bb:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8007be:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8007c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007c7:	48 f7 f6             	div    %rsi
+  8007ca:	49 89 c2             	mov    %rax,%r10
+  8007cd:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8007d0:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8007d3:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  8007d7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8007db:	41 89 c9             	mov    %ecx,%r9d
+  8007de:	41 89 f8             	mov    %edi,%r8d
+  8007e1:	89 d1                	mov    %edx,%ecx
+  8007e3:	4c 89 d2             	mov    %r10,%rdx
+  8007e6:	48 89 c7             	mov    %rax,%rdi
+  8007e9:	48 b8 8d 07 80 00 00 	movabs $0x80078d,%rax
+  8007f0:	00 00 00 
+  8007f3:	ff d0                	call   *%rax
+  8007f5:	eb 1c                	jmp    800813 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8007f7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007fb:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8007fe:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800802:	48 89 d6             	mov    %rdx,%rsi
+  800805:	89 c7                	mov    %eax,%edi
+  800807:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800809:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80080d:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  800811:	7f e4                	jg     8007f7 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800813:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800816:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80081a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80081f:	48 f7 f1             	div    %rcx
+  800822:	48 b8 b0 61 80 00 00 	movabs $0x8061b0,%rax
+  800829:	00 00 00 
+  80082c:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800830:	0f be c0             	movsbl %al,%eax
+  800833:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800837:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80083b:	48 89 d6             	mov    %rdx,%rsi
+  80083e:	89 c7                	mov    %eax,%edi
+  800840:	ff d1                	call   *%rcx
+}
+  800842:	90                   	nop
+  800843:	c9                   	leave
+  800844:	c3                   	ret
+
+0000000000800845 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  800845:	55                   	push   %rbp
+  800846:	48 89 e5             	mov    %rsp,%rbp
+  800849:	48 83 ec 10          	sub    $0x10,%rsp
+  80084d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800851:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800854:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800858:	7e 4b                	jle    8008a5 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  80085a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80085e:	8b 00                	mov    (%rax),%eax
+  800860:	83 f8 2f             	cmp    $0x2f,%eax
+  800863:	77 24                	ja     800889 <getuint+0x44>
+  800865:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800869:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80086d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800871:	8b 00                	mov    (%rax),%eax
+  800873:	89 c0                	mov    %eax,%eax
+  800875:	48 01 d0             	add    %rdx,%rax
+  800878:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80087c:	8b 12                	mov    (%rdx),%edx
+  80087e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800881:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800885:	89 0a                	mov    %ecx,(%rdx)
+  800887:	eb 14                	jmp    80089d <getuint+0x58>
+  800889:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80088d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800891:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800895:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800899:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80089d:	48 8b 00             	mov    (%rax),%rax
+  8008a0:	e9 95 00 00 00       	jmp    80093a <getuint+0xf5>
+  else if (lflag)
+  8008a5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8008a9:	74 48                	je     8008f3 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8008ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008af:	8b 00                	mov    (%rax),%eax
+  8008b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b4:	77 24                	ja     8008da <getuint+0x95>
+  8008b6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008ba:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8008be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008c2:	8b 00                	mov    (%rax),%eax
+  8008c4:	89 c0                	mov    %eax,%eax
+  8008c6:	48 01 d0             	add    %rdx,%rax
+  8008c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008cd:	8b 12                	mov    (%rdx),%edx
+  8008cf:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8008d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008d6:	89 0a                	mov    %ecx,(%rdx)
+  8008d8:	eb 14                	jmp    8008ee <getuint+0xa9>
+  8008da:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008de:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8008e2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8008e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8008ea:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8008ee:	48 8b 00             	mov    (%rax),%rax
+  8008f1:	eb 47                	jmp    80093a <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  8008f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8008f7:	8b 00                	mov    (%rax),%eax
+  8008f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fc:	77 24                	ja     800922 <getuint+0xdd>
+  8008fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800902:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800906:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80090a:	8b 00                	mov    (%rax),%eax
+  80090c:	89 c0                	mov    %eax,%eax
+  80090e:	48 01 d0             	add    %rdx,%rax
+  800911:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800915:	8b 12                	mov    (%rdx),%edx
+  800917:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80091a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80091e:	89 0a                	mov    %ecx,(%rdx)
+  800920:	eb 14                	jmp    800936 <getuint+0xf1>
+  800922:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800926:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80092a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80092e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800932:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800936:	8b 00                	mov    (%rax),%eax
+  800938:	89 c0                	mov    %eax,%eax
+}
+  80093a:	c9                   	leave
+  80093b:	c3                   	ret
+
+000000000080093c <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  80093c:	55                   	push   %rbp
+  80093d:	48 89 e5             	mov    %rsp,%rbp
+  800940:	48 83 ec 10          	sub    $0x10,%rsp
+  800944:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800948:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80094b:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  80094f:	7e 4b                	jle    80099c <getint+0x60>
+    return va_arg(*ap, long long);
+  800951:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800955:	8b 00                	mov    (%rax),%eax
+  800957:	83 f8 2f             	cmp    $0x2f,%eax
+  80095a:	77 24                	ja     800980 <getint+0x44>
+  80095c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800960:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800964:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800968:	8b 00                	mov    (%rax),%eax
+  80096a:	89 c0                	mov    %eax,%eax
+  80096c:	48 01 d0             	add    %rdx,%rax
+  80096f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800973:	8b 12                	mov    (%rdx),%edx
+  800975:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800978:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80097c:	89 0a                	mov    %ecx,(%rdx)
+  80097e:	eb 14                	jmp    800994 <getint+0x58>
+  800980:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800984:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800988:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80098c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800990:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800994:	48 8b 00             	mov    (%rax),%rax
+  800997:	e9 95 00 00 00       	jmp    800a31 <getint+0xf5>
+  else if (lflag)
+  80099c:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8009a0:	74 48                	je     8009ea <getint+0xae>
+    return va_arg(*ap, long);
+  8009a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009a6:	8b 00                	mov    (%rax),%eax
+  8009a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ab:	77 24                	ja     8009d1 <getint+0x95>
+  8009ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009b5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009b9:	8b 00                	mov    (%rax),%eax
+  8009bb:	89 c0                	mov    %eax,%eax
+  8009bd:	48 01 d0             	add    %rdx,%rax
+  8009c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009c4:	8b 12                	mov    (%rdx),%edx
+  8009c6:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8009c9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009cd:	89 0a                	mov    %ecx,(%rdx)
+  8009cf:	eb 14                	jmp    8009e5 <getint+0xa9>
+  8009d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009d5:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8009d9:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8009dd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8009e1:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8009e5:	48 8b 00             	mov    (%rax),%rax
+  8009e8:	eb 47                	jmp    800a31 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  8009ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009ee:	8b 00                	mov    (%rax),%eax
+  8009f0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f3:	77 24                	ja     800a19 <getint+0xdd>
+  8009f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009f9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009fd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a01:	8b 00                	mov    (%rax),%eax
+  800a03:	89 c0                	mov    %eax,%eax
+  800a05:	48 01 d0             	add    %rdx,%rax
+  800a08:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a0c:	8b 12                	mov    (%rdx),%edx
+  800a0e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a11:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a15:	89 0a                	mov    %ecx,(%rdx)
+  800a17:	eb 14                	jmp    800a2d <getint+0xf1>
+  800a19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a1d:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a21:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a25:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a29:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a2d:	8b 00                	mov    (%rax),%eax
+  800a2f:	48 98                	cltq
+}
+  800a31:	c9                   	leave
+  800a32:	c3                   	ret
+
+0000000000800a33 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800a33:	55                   	push   %rbp
+  800a34:	48 89 e5             	mov    %rsp,%rbp
+  800a37:	41 54                	push   %r12
+  800a39:	53                   	push   %rbx
+  800a3a:	48 83 ec 60          	sub    $0x60,%rsp
+  800a3e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800a42:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800a46:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a4a:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800a4e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a52:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800a56:	48 8b 06             	mov    (%rsi),%rax
+  800a59:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800a5d:	48 89 01             	mov    %rax,(%rcx)
+  800a60:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800a64:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800a68:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a6c:	eb 17                	jmp    800a85 <vprintfmt+0x52>
+      if (ch == '\0')
+  800a6e:	85 db                	test   %ebx,%ebx
+  800a70:	0f 84 bf 04 00 00    	je     800f35 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800a76:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a7a:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a7e:	48 89 c6             	mov    %rax,%rsi
+  800a81:	89 df                	mov    %ebx,%edi
+  800a83:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800a85:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800a89:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a8d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800a91:	0f b6 00             	movzbl (%rax),%eax
+  800a94:	0f b6 d8             	movzbl %al,%ebx
+  800a97:	83 fb 25             	cmp    $0x25,%ebx
+  800a9a:	75 d2                	jne    800a6e <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800a9c:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800aa0:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800aa7:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800aae:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800ab5:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800abc:	eb 04                	jmp    800ac2 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800abe:	90                   	nop
+  800abf:	eb 01                	jmp    800ac2 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800ac1:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800ac2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800ac6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800aca:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800ace:	0f b6 00             	movzbl (%rax),%eax
+  800ad1:	0f b6 d8             	movzbl %al,%ebx
+  800ad4:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800ad7:	83 f8 55             	cmp    $0x55,%eax
+  800ada:	0f 87 22 04 00 00    	ja     800f02 <vprintfmt+0x4cf>
+  800ae0:	89 c0                	mov    %eax,%eax
+  800ae2:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800ae9:	00 
+  800aea:	48 b8 d8 61 80 00 00 	movabs $0x8061d8,%rax
+  800af1:	00 00 00 
+  800af4:	48 01 d0             	add    %rdx,%rax
+  800af7:	48 8b 00             	mov    (%rax),%rax
+  800afa:	ff e0                	jmp    *%rax
+        padc = '-';
+  800afc:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800b00:	eb c0                	jmp    800ac2 <vprintfmt+0x8f>
+        padc = '0';
+  800b02:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800b06:	eb ba                	jmp    800ac2 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800b08:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800b0f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800b12:	89 d0                	mov    %edx,%eax
+  800b14:	c1 e0 02             	shl    $0x2,%eax
+  800b17:	01 d0                	add    %edx,%eax
+  800b19:	01 c0                	add    %eax,%eax
+  800b1b:	01 d8                	add    %ebx,%eax
+  800b1d:	83 e8 30             	sub    $0x30,%eax
+  800b20:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800b23:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b27:	0f b6 00             	movzbl (%rax),%eax
+  800b2a:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800b2d:	83 fb 2f             	cmp    $0x2f,%ebx
+  800b30:	7e 60                	jle    800b92 <vprintfmt+0x15f>
+  800b32:	83 fb 39             	cmp    $0x39,%ebx
+  800b35:	7f 5b                	jg     800b92 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800b37:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800b3c:	eb d1                	jmp    800b0f <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800b3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b41:	83 f8 2f             	cmp    $0x2f,%eax
+  800b44:	77 17                	ja     800b5d <vprintfmt+0x12a>
+  800b46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800b4a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b4d:	89 d2                	mov    %edx,%edx
+  800b4f:	48 01 d0             	add    %rdx,%rax
+  800b52:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800b55:	83 c2 08             	add    $0x8,%edx
+  800b58:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800b5b:	eb 0c                	jmp    800b69 <vprintfmt+0x136>
+  800b5d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800b61:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800b65:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800b69:	8b 00                	mov    (%rax),%eax
+  800b6b:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800b6e:	eb 23                	jmp    800b93 <vprintfmt+0x160>
+        if (width < 0)
+  800b70:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b74:	0f 89 44 ff ff ff    	jns    800abe <vprintfmt+0x8b>
+          width = 0;
+  800b7a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800b81:	e9 38 ff ff ff       	jmp    800abe <vprintfmt+0x8b>
+        altflag = 1;
+  800b86:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800b8d:	e9 30 ff ff ff       	jmp    800ac2 <vprintfmt+0x8f>
+        goto process_precision;
+  800b92:	90                   	nop
+        if (width < 0)
+  800b93:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800b97:	0f 89 24 ff ff ff    	jns    800ac1 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800b9d:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800ba0:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800ba3:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800baa:	e9 12 ff ff ff       	jmp    800ac1 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800baf:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800bb3:	e9 0a ff ff ff       	jmp    800ac2 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800bb8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bbb:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbe:	77 17                	ja     800bd7 <vprintfmt+0x1a4>
+  800bc0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800bc4:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bc7:	89 d2                	mov    %edx,%edx
+  800bc9:	48 01 d0             	add    %rdx,%rax
+  800bcc:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800bcf:	83 c2 08             	add    $0x8,%edx
+  800bd2:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800bd5:	eb 0c                	jmp    800be3 <vprintfmt+0x1b0>
+  800bd7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800bdb:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800bdf:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800be3:	8b 00                	mov    (%rax),%eax
+  800be5:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800be9:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800bed:	48 89 d6             	mov    %rdx,%rsi
+  800bf0:	89 c7                	mov    %eax,%edi
+  800bf2:	ff d1                	call   *%rcx
+        break;
+  800bf4:	e9 37 03 00 00       	jmp    800f30 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800bf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bff:	77 17                	ja     800c18 <vprintfmt+0x1e5>
+  800c01:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800c05:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c08:	89 d2                	mov    %edx,%edx
+  800c0a:	48 01 d0             	add    %rdx,%rax
+  800c0d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800c10:	83 c2 08             	add    $0x8,%edx
+  800c13:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800c16:	eb 0c                	jmp    800c24 <vprintfmt+0x1f1>
+  800c18:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800c1c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800c20:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800c24:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800c26:	85 db                	test   %ebx,%ebx
+  800c28:	79 02                	jns    800c2c <vprintfmt+0x1f9>
+          err = -err;
+  800c2a:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800c2c:	83 fb 15             	cmp    $0x15,%ebx
+  800c2f:	7f 16                	jg     800c47 <vprintfmt+0x214>
+  800c31:	48 ba 00 61 80 00 00 	movabs $0x806100,%rdx
+  800c38:	00 00 00 
+  800c3b:	48 63 c3             	movslq %ebx,%rax
+  800c3e:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800c42:	4d 85 e4             	test   %r12,%r12
+  800c45:	75 2e                	jne    800c75 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800c47:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c4b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c4f:	89 d9                	mov    %ebx,%ecx
+  800c51:	48 ba c1 61 80 00 00 	movabs $0x8061c1,%rdx
+  800c58:	00 00 00 
+  800c5b:	48 89 c7             	mov    %rax,%rdi
+  800c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c63:	49 b8 3f 0f 80 00 00 	movabs $0x800f3f,%r8
+  800c6a:	00 00 00 
+  800c6d:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800c70:	e9 bb 02 00 00       	jmp    800f30 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800c75:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800c79:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800c7d:	4c 89 e1             	mov    %r12,%rcx
+  800c80:	48 ba ca 61 80 00 00 	movabs $0x8061ca,%rdx
+  800c87:	00 00 00 
+  800c8a:	48 89 c7             	mov    %rax,%rdi
+  800c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c92:	49 b8 3f 0f 80 00 00 	movabs $0x800f3f,%r8
+  800c99:	00 00 00 
+  800c9c:	41 ff d0             	call   *%r8
+        break;
+  800c9f:	e9 8c 02 00 00       	jmp    800f30 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800ca4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca7:	83 f8 2f             	cmp    $0x2f,%eax
+  800caa:	77 17                	ja     800cc3 <vprintfmt+0x290>
+  800cac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cb0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cb3:	89 d2                	mov    %edx,%edx
+  800cb5:	48 01 d0             	add    %rdx,%rax
+  800cb8:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cbb:	83 c2 08             	add    $0x8,%edx
+  800cbe:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800cc1:	eb 0c                	jmp    800ccf <vprintfmt+0x29c>
+  800cc3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800cc7:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ccb:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ccf:	4c 8b 20             	mov    (%rax),%r12
+  800cd2:	4d 85 e4             	test   %r12,%r12
+  800cd5:	75 0a                	jne    800ce1 <vprintfmt+0x2ae>
+          p = "(null)";
+  800cd7:	49 bc cd 61 80 00 00 	movabs $0x8061cd,%r12
+  800cde:	00 00 00 
+        if (width > 0 && padc != '-')
+  800ce1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800ce5:	7e 78                	jle    800d5f <vprintfmt+0x32c>
+  800ce7:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800ceb:	74 72                	je     800d5f <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800ced:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800cf0:	48 98                	cltq
+  800cf2:	48 89 c6             	mov    %rax,%rsi
+  800cf5:	4c 89 e7             	mov    %r12,%rdi
+  800cf8:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  800cff:	00 00 00 
+  800d02:	ff d0                	call   *%rax
+  800d04:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800d07:	eb 17                	jmp    800d20 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800d09:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800d0d:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800d11:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d15:	48 89 d6             	mov    %rdx,%rsi
+  800d18:	89 c7                	mov    %eax,%edi
+  800d1a:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800d1c:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d20:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d24:	7f e3                	jg     800d09 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d26:	eb 37                	jmp    800d5f <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800d28:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800d2c:	74 1e                	je     800d4c <vprintfmt+0x319>
+  800d2e:	83 fb 1f             	cmp    $0x1f,%ebx
+  800d31:	7e 05                	jle    800d38 <vprintfmt+0x305>
+  800d33:	83 fb 7e             	cmp    $0x7e,%ebx
+  800d36:	7e 14                	jle    800d4c <vprintfmt+0x319>
+            putch('?', putdat);
+  800d38:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d3c:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d40:	48 89 c6             	mov    %rax,%rsi
+  800d43:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d48:	ff d2                	call   *%rdx
+  800d4a:	eb 0f                	jmp    800d5b <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800d4c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d50:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d54:	48 89 c6             	mov    %rax,%rsi
+  800d57:	89 df                	mov    %ebx,%edi
+  800d59:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800d5b:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d5f:	4c 89 e0             	mov    %r12,%rax
+  800d62:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800d66:	0f b6 00             	movzbl (%rax),%eax
+  800d69:	0f be d8             	movsbl %al,%ebx
+  800d6c:	85 db                	test   %ebx,%ebx
+  800d6e:	74 28                	je     800d98 <vprintfmt+0x365>
+  800d70:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d74:	78 b2                	js     800d28 <vprintfmt+0x2f5>
+  800d76:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800d7a:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800d7e:	79 a8                	jns    800d28 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800d80:	eb 16                	jmp    800d98 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800d82:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800d86:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800d8a:	48 89 c6             	mov    %rax,%rsi
+  800d8d:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d92:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800d94:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800d98:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d9c:	7f e4                	jg     800d82 <vprintfmt+0x34f>
+        break;
+  800d9e:	e9 8d 01 00 00       	jmp    800f30 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800da3:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800da6:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800daa:	89 d6                	mov    %edx,%esi
+  800dac:	48 89 c7             	mov    %rax,%rdi
+  800daf:	48 b8 3c 09 80 00 00 	movabs $0x80093c,%rax
+  800db6:	00 00 00 
+  800db9:	ff d0                	call   *%rax
+  800dbb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800dbf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dc3:	48 85 c0             	test   %rax,%rax
+  800dc6:	79 1d                	jns    800de5 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800dc8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800dcc:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800dd0:	48 89 c6             	mov    %rax,%rsi
+  800dd3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800dd8:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800dda:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dde:	48 f7 d8             	neg    %rax
+  800de1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800de5:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800dec:	e9 d2 00 00 00       	jmp    800ec3 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800df1:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800df4:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800df8:	89 d6                	mov    %edx,%esi
+  800dfa:	48 89 c7             	mov    %rax,%rdi
+  800dfd:	48 b8 45 08 80 00 00 	movabs $0x800845,%rax
+  800e04:	00 00 00 
+  800e07:	ff d0                	call   *%rax
+  800e09:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800e0d:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800e14:	e9 aa 00 00 00       	jmp    800ec3 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800e19:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800e1c:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800e20:	89 d6                	mov    %edx,%esi
+  800e22:	48 89 c7             	mov    %rax,%rdi
+  800e25:	48 b8 45 08 80 00 00 	movabs $0x800845,%rax
+  800e2c:	00 00 00 
+  800e2f:	ff d0                	call   *%rax
+  800e31:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800e35:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800e3c:	e9 82 00 00 00       	jmp    800ec3 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800e41:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e45:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e49:	48 89 c6             	mov    %rax,%rsi
+  800e4c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e51:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800e53:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800e57:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800e5b:	48 89 c6             	mov    %rax,%rsi
+  800e5e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e63:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800e65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e68:	83 f8 2f             	cmp    $0x2f,%eax
+  800e6b:	77 17                	ja     800e84 <vprintfmt+0x451>
+  800e6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e71:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e74:	89 d2                	mov    %edx,%edx
+  800e76:	48 01 d0             	add    %rdx,%rax
+  800e79:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e7c:	83 c2 08             	add    $0x8,%edx
+  800e7f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e82:	eb 0c                	jmp    800e90 <vprintfmt+0x45d>
+  800e84:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e88:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e8c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e90:	48 8b 00             	mov    (%rax),%rax
+  800e93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800e97:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800e9e:	eb 23                	jmp    800ec3 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800ea0:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800ea3:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ea7:	89 d6                	mov    %edx,%esi
+  800ea9:	48 89 c7             	mov    %rax,%rdi
+  800eac:	48 b8 45 08 80 00 00 	movabs $0x800845,%rax
+  800eb3:	00 00 00 
+  800eb6:	ff d0                	call   *%rax
+  800eb8:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800ebc:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800ec3:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800ec8:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800ecb:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800ece:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800ed2:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ed6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800eda:	45 89 c1             	mov    %r8d,%r9d
+  800edd:	41 89 f8             	mov    %edi,%r8d
+  800ee0:	48 89 c7             	mov    %rax,%rdi
+  800ee3:	48 b8 8d 07 80 00 00 	movabs $0x80078d,%rax
+  800eea:	00 00 00 
+  800eed:	ff d0                	call   *%rax
+        break;
+  800eef:	eb 3f                	jmp    800f30 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800ef1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ef5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ef9:	48 89 c6             	mov    %rax,%rsi
+  800efc:	89 df                	mov    %ebx,%edi
+  800efe:	ff d2                	call   *%rdx
+        break;
+  800f00:	eb 2e                	jmp    800f30 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800f02:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f06:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f0a:	48 89 c6             	mov    %rax,%rsi
+  800f0d:	bf 25 00 00 00       	mov    $0x25,%edi
+  800f12:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800f14:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800f19:	eb 05                	jmp    800f20 <vprintfmt+0x4ed>
+  800f1b:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800f20:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800f24:	48 83 e8 01          	sub    $0x1,%rax
+  800f28:	0f b6 00             	movzbl (%rax),%eax
+  800f2b:	3c 25                	cmp    $0x25,%al
+  800f2d:	75 ec                	jne    800f1b <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800f2f:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800f30:	e9 50 fb ff ff       	jmp    800a85 <vprintfmt+0x52>
+        return;
+  800f35:	90                   	nop
+    }
+  }
+}
+  800f36:	48 83 c4 60          	add    $0x60,%rsp
+  800f3a:	5b                   	pop    %rbx
+  800f3b:	41 5c                	pop    %r12
+  800f3d:	5d                   	pop    %rbp
+  800f3e:	c3                   	ret
+
+0000000000800f3f <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800f3f:	55                   	push   %rbp
+  800f40:	48 89 e5             	mov    %rsp,%rbp
+  800f43:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800f4a:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800f51:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800f58:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800f5f:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800f66:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800f6d:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800f74:	84 c0                	test   %al,%al
+  800f76:	74 20                	je     800f98 <printfmt+0x59>
+  800f78:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800f7c:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800f80:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800f84:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800f88:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800f8c:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800f90:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800f94:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800f98:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800f9f:	00 00 00 
+  800fa2:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800fa9:	00 00 00 
+  800fac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800fb0:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800fb7:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800fbe:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800fc5:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800fcc:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800fd3:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800fda:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800fe1:	48 89 c7             	mov    %rax,%rdi
+  800fe4:	48 b8 33 0a 80 00 00 	movabs $0x800a33,%rax
+  800feb:	00 00 00 
+  800fee:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800ff0:	90                   	nop
+  800ff1:	c9                   	leave
+  800ff2:	c3                   	ret
+
+0000000000800ff3 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800ff3:	55                   	push   %rbp
+  800ff4:	48 89 e5             	mov    %rsp,%rbp
+  800ff7:	48 83 ec 10          	sub    $0x10,%rsp
+  800ffb:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ffe:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801002:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801006:	8b 40 10             	mov    0x10(%rax),%eax
+  801009:	8d 50 01             	lea    0x1(%rax),%edx
+  80100c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801010:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  801013:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801017:	48 8b 10             	mov    (%rax),%rdx
+  80101a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80101e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  801022:	48 39 c2             	cmp    %rax,%rdx
+  801025:	73 17                	jae    80103e <sprintputch+0x4b>
+    *b->buf++ = ch;
+  801027:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80102b:	48 8b 00             	mov    (%rax),%rax
+  80102e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801032:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801036:	48 89 0a             	mov    %rcx,(%rdx)
+  801039:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80103c:	88 10                	mov    %dl,(%rax)
+}
+  80103e:	90                   	nop
+  80103f:	c9                   	leave
+  801040:	c3                   	ret
+
+0000000000801041 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  801041:	55                   	push   %rbp
+  801042:	48 89 e5             	mov    %rsp,%rbp
+  801045:	48 83 ec 40          	sub    $0x40,%rsp
+  801049:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80104d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801050:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801054:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  801058:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80105c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  801060:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801063:	48 98                	cltq
+  801065:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801069:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80106d:	48 01 d0             	add    %rdx,%rax
+  801070:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801074:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  80107b:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801080:	74 06                	je     801088 <vsnprintf+0x47>
+  801082:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801086:	7f 07                	jg     80108f <vsnprintf+0x4e>
+    return -E_INVAL;
+  801088:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108d:	eb 32                	jmp    8010c1 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  80108f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801093:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801097:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80109b:	48 89 c6             	mov    %rax,%rsi
+  80109e:	48 b8 f3 0f 80 00 00 	movabs $0x800ff3,%rax
+  8010a5:	00 00 00 
+  8010a8:	48 89 c7             	mov    %rax,%rdi
+  8010ab:	48 b8 33 0a 80 00 00 	movabs $0x800a33,%rax
+  8010b2:	00 00 00 
+  8010b5:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8010b7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8010bb:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  8010be:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  8010c1:	c9                   	leave
+  8010c2:	c3                   	ret
+
+00000000008010c3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  8010c3:	55                   	push   %rbp
+  8010c4:	48 89 e5             	mov    %rsp,%rbp
+  8010c7:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8010ce:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010d5:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  8010db:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8010e2:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010e9:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010f0:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  8010f7:	84 c0                	test   %al,%al
+  8010f9:	74 20                	je     80111b <snprintf+0x58>
+  8010fb:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8010ff:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801103:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801107:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80110b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80110f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801113:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801117:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80111b:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  801122:	00 00 00 
+  801125:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80112c:	00 00 00 
+  80112f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801133:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80113a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  801141:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  801148:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  80114f:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801156:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  80115c:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801163:	48 89 c7             	mov    %rax,%rdi
+  801166:	48 b8 41 10 80 00 00 	movabs $0x801041,%rax
+  80116d:	00 00 00 
+  801170:	ff d0                	call   *%rax
+  801172:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801178:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80117e:	c9                   	leave
+  80117f:	c3                   	ret
+
+0000000000801180 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801180:	55                   	push   %rbp
+  801181:	48 89 e5             	mov    %rsp,%rbp
+  801184:	53                   	push   %rbx
+  801185:	48 83 ec 38          	sub    $0x38,%rsp
+  801189:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80118c:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801190:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801194:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801198:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  80119c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80119f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a4:	89 d1                	mov    %edx,%ecx
+  8011a6:	0f a2                	cpuid
+  8011a8:	89 de                	mov    %ebx,%esi
+  8011aa:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  8011ad:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  8011b0:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  8011b3:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  8011b6:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8011bb:	74 09                	je     8011c6 <cpuid+0x46>
+}
+  8011bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011c1:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8011c4:	89 10                	mov    %edx,(%rax)
+
+  8011c6:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8011cb:	74 09                	je     8011d6 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  8011cd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011d1:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  8011d4:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  8011d6:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8011db:	74 09                	je     8011e6 <cpuid+0x66>
+char *
+  8011dd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011e1:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  8011e4:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  8011e6:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  8011eb:	74 09                	je     8011f6 <cpuid+0x76>
+  for (; *s; s++)
+  8011ed:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8011f1:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8011f4:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  8011f6:	90                   	nop
+  8011f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8011fb:	c9                   	leave
+  8011fc:	c3                   	ret
+
+00000000008011fd <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  8011fd:	55                   	push   %rbp
+  8011fe:	48 89 e5             	mov    %rsp,%rbp
+  801201:	48 83 ec 18          	sub    $0x18,%rsp
+  801205:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801208:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80120b:	89 c1                	mov    %eax,%ecx
+  80120d:	0f 01 d0             	xgetbv
+  801210:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  801213:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  801216:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801219:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  80121c:	48 c1 e2 20          	shl    $0x20,%rdx
+  801220:	48 09 d0             	or     %rdx,%rax
+#else
+  801223:	c9                   	leave
+  801224:	c3                   	ret
+
+0000000000801225 <string_cpu>:
+string_cpu(void) {
+  801225:	55                   	push   %rbp
+  801226:	48 89 e5             	mov    %rsp,%rbp
+  801229:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  80122d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  801234:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  80123b:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801242:	00 00 00 
+  801245:	8b 00                	mov    (%rax),%eax
+  801247:	85 c0                	test   %eax,%eax
+  801249:	78 11                	js     80125c <string_cpu+0x37>
+    return string_features;
+  80124b:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801252:	00 00 00 
+  801255:	8b 00                	mov    (%rax),%eax
+  801257:	e9 df 00 00 00       	jmp    80133b <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  80125c:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  801260:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801266:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80126b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801270:	48 89 c6             	mov    %rax,%rsi
+  801273:	bf 00 00 00 00       	mov    $0x0,%edi
+  801278:	48 b8 80 11 80 00 00 	movabs $0x801180,%rax
+  80127f:	00 00 00 
+  801282:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801284:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801287:	83 f8 06             	cmp    $0x6,%eax
+  80128a:	76 28                	jbe    8012b4 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  80128c:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801296:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80129b:	48 89 c2             	mov    %rax,%rdx
+  80129e:	be 00 00 00 00       	mov    $0x0,%esi
+  8012a3:	bf 07 00 00 00       	mov    $0x7,%edi
+  8012a8:	48 b8 80 11 80 00 00 	movabs $0x801180,%rax
+  8012af:	00 00 00 
+  8012b2:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  8012b4:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8012b7:	25 00 02 00 00       	and    $0x200,%eax
+  8012bc:	85 c0                	test   %eax,%eax
+  8012be:	74 04                	je     8012c4 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  8012c0:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  8012c4:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  8012c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012ce:	48 89 c1             	mov    %rax,%rcx
+  8012d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012db:	bf 01 00 00 00       	mov    $0x1,%edi
+  8012e0:	48 b8 80 11 80 00 00 	movabs $0x801180,%rax
+  8012e7:	00 00 00 
+  8012ea:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8012ec:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8012ef:	83 e0 20             	and    $0x20,%eax
+  8012f2:	85 c0                	test   %eax,%eax
+  8012f4:	74 2a                	je     801320 <string_cpu+0xfb>
+  8012f6:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8012f9:	25 00 00 00 08       	and    $0x8000000,%eax
+  8012fe:	85 c0                	test   %eax,%eax
+  801300:	74 1e                	je     801320 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801302:	bf 00 00 00 00       	mov    $0x0,%edi
+  801307:	48 b8 fd 11 80 00 00 	movabs $0x8011fd,%rax
+  80130e:	00 00 00 
+  801311:	ff d0                	call   *%rax
+  801313:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  801316:	48 83 f8 06          	cmp    $0x6,%rax
+  80131a:	75 04                	jne    801320 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  80131c:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  801320:	48 ba 08 70 80 00 00 	movabs $0x807008,%rdx
+  801327:	00 00 00 
+  80132a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80132d:	89 02                	mov    %eax,(%rdx)
+  80132f:	48 b8 08 70 80 00 00 	movabs $0x807008,%rax
+  801336:	00 00 00 
+  801339:	8b 00                	mov    (%rax),%eax
+}
+  80133b:	c9                   	leave
+  80133c:	c3                   	ret
+
+000000000080133d <strlen_avx2>:
+strlen_avx2(const char *s) {
+  80133d:	55                   	push   %rbp
+  80133e:	48 89 e5             	mov    %rsp,%rbp
+  801341:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801345:	48 83 ec 60          	sub    $0x60,%rsp
+  801349:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  80134e:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801353:	83 e0 1f             	and    $0x1f,%eax
+  801356:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  80135a:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  80135e:	48 f7 d8             	neg    %rax
+  801361:	48 89 c2             	mov    %rax,%rdx
+  801364:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  801369:	48 01 d0             	add    %rdx,%rax
+  80136c:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801371:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801375:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80137b:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801380:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801384:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80138a:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80138e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801392:	89 c2                	mov    %eax,%edx
+  801394:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801398:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80139d:	89 c1                	mov    %eax,%ecx
+  80139f:	d3 e6                	shl    %cl,%esi
+  8013a1:	89 f0                	mov    %esi,%eax
+  8013a3:	21 d0                	and    %edx,%eax
+  8013a5:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8013a9:	eb 21                	jmp    8013cc <strlen_avx2+0x8f>
+    p += 32;
+  8013ab:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  8013b1:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8013b6:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  8013ba:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  8013c0:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8013c4:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8013c8:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  8013cc:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  8013d1:	74 d8                	je     8013ab <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  8013d3:	31 c0                	xor    %eax,%eax
+  8013d5:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  8013db:	48 63 d0             	movslq %eax,%rdx
+  8013de:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  8013e3:	48 01 d0             	add    %rdx,%rax
+  8013e6:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  8013eb:	c9                   	leave
+  8013ec:	c3                   	ret
+
+00000000008013ed <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  8013ed:	55                   	push   %rbp
+  8013ee:	48 89 e5             	mov    %rsp,%rbp
+  8013f1:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8013f5:	48 83 ec 40          	sub    $0x40,%rsp
+  8013f9:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8013fe:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801403:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801408:	eb 77                	jmp    801481 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80140a:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80140f:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801413:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801417:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  80141c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801420:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801424:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801428:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  80142c:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  801431:	74 3c                	je     80146f <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  801433:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801437:	f7 d0                	not    %eax
+  801439:	f3 0f bc c0          	tzcnt  %eax,%eax
+  80143d:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  801441:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  801445:	48 63 d0             	movslq %eax,%rdx
+  801448:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80144d:	48 01 d0             	add    %rdx,%rax
+  801450:	0f b6 00             	movzbl (%rax),%eax
+  801453:	0f b6 c0             	movzbl %al,%eax
+  801456:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  80145a:	48 63 ca             	movslq %edx,%rcx
+  80145d:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  801462:	48 01 ca             	add    %rcx,%rdx
+  801465:	0f b6 12             	movzbl (%rdx),%edx
+  801468:	0f b6 d2             	movzbl %dl,%edx
+  80146b:	29 d0                	sub    %edx,%eax
+  80146d:	eb 6b                	jmp    8014da <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  80146f:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801475:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80147b:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801481:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801487:	77 81                	ja     80140a <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  801489:	eb 42                	jmp    8014cd <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80148b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801490:	0f b6 10             	movzbl (%rax),%edx
+  801493:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801498:	0f b6 00             	movzbl (%rax),%eax
+  80149b:	38 c2                	cmp    %al,%dl
+  80149d:	74 1c                	je     8014bb <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  80149f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8014a4:	0f b6 00             	movzbl (%rax),%eax
+  8014a7:	0f b6 c8             	movzbl %al,%ecx
+  8014aa:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8014af:	0f b6 00             	movzbl (%rax),%eax
+  8014b2:	0f b6 d0             	movzbl %al,%edx
+  8014b5:	89 c8                	mov    %ecx,%eax
+  8014b7:	29 d0                	sub    %edx,%eax
+  8014b9:	eb 1f                	jmp    8014da <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8014bb:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8014c1:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8014c7:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8014cd:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8014d3:	75 b6                	jne    80148b <memcmp_avx2+0x9e>
+  return 0;
+  8014d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014da:	c9                   	leave
+  8014db:	c3                   	ret
+
+00000000008014dc <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  8014dc:	55                   	push   %rbp
+  8014dd:	48 89 e5             	mov    %rsp,%rbp
+  8014e0:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8014e4:	48 83 ec 60          	sub    $0x60,%rsp
+  8014e8:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  8014ed:	89 f0                	mov    %esi,%eax
+  8014ef:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  8014f4:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  8014f8:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  8014fd:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801501:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801506:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80150c:	eb 47                	jmp    801555 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80150e:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801513:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801517:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  80151b:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  801521:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  801525:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801529:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  80152d:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  801532:	74 15                	je     801549 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  801534:	31 c0                	xor    %eax,%eax
+  801536:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  80153c:	48 63 d0             	movslq %eax,%rdx
+  80153f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801544:	48 01 d0             	add    %rdx,%rax
+  801547:	eb 3d                	jmp    801586 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801549:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80154f:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801555:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  80155b:	77 b1                	ja     80150e <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  80155d:	eb 0c                	jmp    80156b <memfind_avx2+0x8f>
+  80155f:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801565:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80156b:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801571:	74 0e                	je     801581 <memfind_avx2+0xa5>
+  801573:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801578:	0f b6 00             	movzbl (%rax),%eax
+  80157b:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  80157f:	75 de                	jne    80155f <memfind_avx2+0x83>
+  return s;
+  801581:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801586:	c9                   	leave
+  801587:	c3                   	ret
+
+0000000000801588 <strlen>:
+strlen(const char *s) {
+  801588:	55                   	push   %rbp
+  801589:	48 89 e5             	mov    %rsp,%rbp
+  80158c:	48 83 ec 40          	sub    $0x40,%rsp
+  801590:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801594:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801598:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80159c:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8015a3:	00 00 00 
+  8015a6:	ff d0                	call   *%rax
+  8015a8:	83 e0 02             	and    $0x2,%eax
+  8015ab:	85 c0                	test   %eax,%eax
+  8015ad:	74 18                	je     8015c7 <strlen+0x3f>
+    return strlen_avx2(s);
+  8015af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015b3:	48 89 c7             	mov    %rax,%rdi
+  8015b6:	48 b8 3d 13 80 00 00 	movabs $0x80133d,%rax
+  8015bd:	00 00 00 
+  8015c0:	ff d0                	call   *%rax
+  8015c2:	e9 82 00 00 00       	jmp    801649 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8015c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015cb:	83 e0 0f             	and    $0xf,%eax
+  8015ce:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8015d1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8015d4:	48 f7 d8             	neg    %rax
+  8015d7:	48 89 c2             	mov    %rax,%rdx
+  8015da:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8015de:	48 01 d0             	add    %rdx,%rax
+  8015e1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  8015e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015e9:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8015ed:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8015f2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8015f6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8015fa:	89 c2                	mov    %eax,%edx
+  8015fc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8015ff:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801604:	89 c1                	mov    %eax,%ecx
+  801606:	d3 e6                	shl    %cl,%esi
+  801608:	89 f0                	mov    %esi,%eax
+  80160a:	21 d0                	and    %edx,%eax
+  80160c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80160f:	eb 1d                	jmp    80162e <strlen+0xa6>
+    p += 16;
+  801611:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  801616:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80161a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80161e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801623:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801627:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80162b:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  80162e:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801632:	74 dd                	je     801611 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  801634:	31 c0                	xor    %eax,%eax
+  801636:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  80163b:	48 63 d0             	movslq %eax,%rdx
+  80163e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801642:	48 01 d0             	add    %rdx,%rax
+  801645:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801649:	c9                   	leave
+  80164a:	c3                   	ret
+
+000000000080164b <strnlen>:
+strnlen(const char *s, size_t size) {
+  80164b:	55                   	push   %rbp
+  80164c:	48 89 e5             	mov    %rsp,%rbp
+  80164f:	48 83 ec 20          	sub    $0x20,%rsp
+  801653:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801657:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80165b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  801662:	eb 0e                	jmp    801672 <strnlen+0x27>
+    n++;
+  801664:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801668:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  80166d:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801672:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801677:	74 0b                	je     801684 <strnlen+0x39>
+  801679:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80167d:	0f b6 00             	movzbl (%rax),%eax
+  801680:	84 c0                	test   %al,%al
+  801682:	75 e0                	jne    801664 <strnlen+0x19>
+  return n;
+  801684:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801687:	c9                   	leave
+  801688:	c3                   	ret
+
+0000000000801689 <strcpy>:
+strcpy(char *dst, const char *src) {
+  801689:	55                   	push   %rbp
+  80168a:	48 89 e5             	mov    %rsp,%rbp
+  80168d:	48 83 ec 20          	sub    $0x20,%rsp
+  801691:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801695:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  801699:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80169d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8016a1:	90                   	nop
+  8016a2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8016a6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016aa:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8016ae:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016b2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8016b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8016ba:	0f b6 12             	movzbl (%rdx),%edx
+  8016bd:	88 10                	mov    %dl,(%rax)
+  8016bf:	0f b6 00             	movzbl (%rax),%eax
+  8016c2:	84 c0                	test   %al,%al
+  8016c4:	75 dc                	jne    8016a2 <strcpy+0x19>
+  return ret;
+  8016c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016ca:	c9                   	leave
+  8016cb:	c3                   	ret
+
+00000000008016cc <strcat>:
+strcat(char *dst, const char *src) {
+  8016cc:	55                   	push   %rbp
+  8016cd:	48 89 e5             	mov    %rsp,%rbp
+  8016d0:	48 83 ec 20          	sub    $0x20,%rsp
+  8016d4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8016d8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  8016dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016e0:	48 89 c7             	mov    %rax,%rdi
+  8016e3:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  8016ea:	00 00 00 
+  8016ed:	ff d0                	call   *%rax
+  8016ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  8016f2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8016f5:	48 63 d0             	movslq %eax,%rdx
+  8016f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8016fc:	48 01 c2             	add    %rax,%rdx
+  8016ff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801703:	48 89 c6             	mov    %rax,%rsi
+  801706:	48 89 d7             	mov    %rdx,%rdi
+  801709:	48 b8 89 16 80 00 00 	movabs $0x801689,%rax
+  801710:	00 00 00 
+  801713:	ff d0                	call   *%rax
+  return dst;
+  801715:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801719:	c9                   	leave
+  80171a:	c3                   	ret
+
+000000000080171b <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  80171b:	55                   	push   %rbp
+  80171c:	48 89 e5             	mov    %rsp,%rbp
+  80171f:	48 83 ec 28          	sub    $0x28,%rsp
+  801723:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801727:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80172b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  80172f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801733:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801737:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80173e:	00 
+  80173f:	eb 2a                	jmp    80176b <strncpy+0x50>
+    *dst++ = *src;
+  801741:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801745:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801749:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80174d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801751:	0f b6 12             	movzbl (%rdx),%edx
+  801754:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  801756:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80175a:	0f b6 00             	movzbl (%rax),%eax
+  80175d:	84 c0                	test   %al,%al
+  80175f:	74 05                	je     801766 <strncpy+0x4b>
+      src++;
+  801761:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  801766:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  80176b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80176f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801773:	72 cc                	jb     801741 <strncpy+0x26>
+  return ret;
+  801775:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801779:	c9                   	leave
+  80177a:	c3                   	ret
+
+000000000080177b <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80177b:	55                   	push   %rbp
+  80177c:	48 89 e5             	mov    %rsp,%rbp
+  80177f:	48 83 ec 28          	sub    $0x28,%rsp
+  801783:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801787:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80178b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  80178f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801793:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801797:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80179c:	74 3d                	je     8017db <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80179e:	eb 1d                	jmp    8017bd <strlcpy+0x42>
+      *dst++ = *src++;
+  8017a0:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8017a4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8017a8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8017ac:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017b0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8017b4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017b8:	0f b6 12             	movzbl (%rdx),%edx
+  8017bb:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8017bd:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8017c2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8017c7:	74 0b                	je     8017d4 <strlcpy+0x59>
+  8017c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017cd:	0f b6 00             	movzbl (%rax),%eax
+  8017d0:	84 c0                	test   %al,%al
+  8017d2:	75 cc                	jne    8017a0 <strlcpy+0x25>
+    *dst = '\0';
+  8017d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017d8:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  8017db:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8017df:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  8017e3:	c9                   	leave
+  8017e4:	c3                   	ret
+
+00000000008017e5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8017e5:	55                   	push   %rbp
+  8017e6:	48 89 e5             	mov    %rsp,%rbp
+  8017e9:	48 83 ec 30          	sub    $0x30,%rsp
+  8017ed:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017f1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8017f5:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  8017f9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8017fd:	48 89 c7             	mov    %rax,%rdi
+  801800:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  801807:	00 00 00 
+  80180a:	ff d0                	call   *%rax
+  80180c:	48 98                	cltq
+  80180e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  801812:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801816:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80181a:	48 89 d6             	mov    %rdx,%rsi
+  80181d:	48 89 c7             	mov    %rax,%rdi
+  801820:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  801827:	00 00 00 
+  80182a:	ff d0                	call   *%rax
+  80182c:	48 98                	cltq
+  80182e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  801832:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801836:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80183a:	75 10                	jne    80184c <strlcat+0x67>
+    return maxlen + srclen;
+  80183c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801840:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801844:	48 01 d0             	add    %rdx,%rax
+  801847:	e9 86 00 00 00       	jmp    8018d2 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  80184c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801850:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  801854:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801858:	73 2b                	jae    801885 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  80185a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80185e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801862:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801866:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186a:	48 01 c1             	add    %rax,%rcx
+  80186d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801871:	48 89 c6             	mov    %rax,%rsi
+  801874:	48 89 cf             	mov    %rcx,%rdi
+  801877:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  80187e:	00 00 00 
+  801881:	ff d0                	call   *%rax
+  801883:	eb 42                	jmp    8018c7 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801885:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801889:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80188d:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801891:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801895:	48 01 c1             	add    %rax,%rcx
+  801898:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80189c:	48 89 c6             	mov    %rax,%rsi
+  80189f:	48 89 cf             	mov    %rcx,%rdi
+  8018a2:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  8018a9:	00 00 00 
+  8018ac:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8018ae:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8018b2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8018b6:	48 01 d0             	add    %rdx,%rax
+  8018b9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018c1:	48 01 d0             	add    %rdx,%rax
+  8018c4:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8018c7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8018cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018cf:	48 01 d0             	add    %rdx,%rax
+}
+  8018d2:	c9                   	leave
+  8018d3:	c3                   	ret
+
+00000000008018d4 <strcmp>:
+strcmp(const char *p, const char *q) {
+  8018d4:	55                   	push   %rbp
+  8018d5:	48 89 e5             	mov    %rsp,%rbp
+  8018d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8018dc:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8018e0:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  8018e4:	eb 0a                	jmp    8018f0 <strcmp+0x1c>
+    p++, q++;
+  8018e6:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018eb:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  8018f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018f4:	0f b6 00             	movzbl (%rax),%eax
+  8018f7:	84 c0                	test   %al,%al
+  8018f9:	74 12                	je     80190d <strcmp+0x39>
+  8018fb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018ff:	0f b6 10             	movzbl (%rax),%edx
+  801902:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801906:	0f b6 00             	movzbl (%rax),%eax
+  801909:	38 c2                	cmp    %al,%dl
+  80190b:	74 d9                	je     8018e6 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80190d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801911:	0f b6 00             	movzbl (%rax),%eax
+  801914:	0f b6 d0             	movzbl %al,%edx
+  801917:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80191b:	0f b6 00             	movzbl (%rax),%eax
+  80191e:	0f b6 c0             	movzbl %al,%eax
+  801921:	29 c2                	sub    %eax,%edx
+  801923:	89 d0                	mov    %edx,%eax
+}
+  801925:	c9                   	leave
+  801926:	c3                   	ret
+
+0000000000801927 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801927:	55                   	push   %rbp
+  801928:	48 89 e5             	mov    %rsp,%rbp
+  80192b:	48 83 ec 18          	sub    $0x18,%rsp
+  80192f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801933:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801937:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80193b:	eb 0f                	jmp    80194c <strncmp+0x25>
+    n--, p++, q++;
+  80193d:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801942:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801947:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  80194c:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801951:	74 1d                	je     801970 <strncmp+0x49>
+  801953:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801957:	0f b6 00             	movzbl (%rax),%eax
+  80195a:	84 c0                	test   %al,%al
+  80195c:	74 12                	je     801970 <strncmp+0x49>
+  80195e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801962:	0f b6 10             	movzbl (%rax),%edx
+  801965:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801969:	0f b6 00             	movzbl (%rax),%eax
+  80196c:	38 c2                	cmp    %al,%dl
+  80196e:	74 cd                	je     80193d <strncmp+0x16>
+  if (n == 0)
+  801970:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801975:	75 07                	jne    80197e <strncmp+0x57>
+    return 0;
+  801977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197c:	eb 16                	jmp    801994 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80197e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801982:	0f b6 00             	movzbl (%rax),%eax
+  801985:	0f b6 d0             	movzbl %al,%edx
+  801988:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80198c:	0f b6 00             	movzbl (%rax),%eax
+  80198f:	0f b6 c0             	movzbl %al,%eax
+  801992:	29 c2                	sub    %eax,%edx
+}
+  801994:	89 d0                	mov    %edx,%eax
+  801996:	c9                   	leave
+  801997:	c3                   	ret
+
+0000000000801998 <strchr>:
+strchr(const char *s, char c) {
+  801998:	55                   	push   %rbp
+  801999:	48 89 e5             	mov    %rsp,%rbp
+  80199c:	48 83 ec 60          	sub    $0x60,%rsp
+  8019a0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019a4:	89 f0                	mov    %esi,%eax
+  8019a6:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8019a9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8019ad:	83 e0 0f             	and    $0xf,%eax
+  8019b0:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8019b3:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8019b6:	48 f7 d8             	neg    %rax
+  8019b9:	48 89 c2             	mov    %rax,%rdx
+  8019bc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8019c0:	48 01 d0             	add    %rdx,%rax
+  8019c3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8019c7:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8019cb:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8019cf:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8019d3:	66 0f 6e c0          	movd   %eax,%xmm0
+  8019d7:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8019db:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8019df:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8019e4:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  8019e8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019ec:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8019f0:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  8019f4:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  8019f9:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  8019fe:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a02:	89 c2                	mov    %eax,%edx
+  801a04:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a09:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801a0e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a12:	09 c2                	or     %eax,%edx
+  801a14:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801a17:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801a1c:	89 c1                	mov    %eax,%ecx
+  801a1e:	d3 e6                	shl    %cl,%esi
+  801a20:	89 f0                	mov    %esi,%eax
+  801a22:	21 d0                	and    %edx,%eax
+  801a24:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801a27:	eb 34                	jmp    801a5d <strchr+0xc5>
+    p += 16;
+  801a29:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801a2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a32:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801a36:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801a3a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a3f:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801a44:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a48:	89 c2                	mov    %eax,%edx
+  801a4a:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801a4f:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801a54:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801a58:	09 d0                	or     %edx,%eax
+  801a5a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801a5d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801a61:	74 c6                	je     801a29 <strchr+0x91>
+  p += __builtin_ctz(m);
+  801a63:	31 c0                	xor    %eax,%eax
+  801a65:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801a6a:	48 98                	cltq
+  801a6c:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801a70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a74:	0f b6 00             	movzbl (%rax),%eax
+  801a77:	84 c0                	test   %al,%al
+  801a79:	74 06                	je     801a81 <strchr+0xe9>
+  801a7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a7f:	eb 05                	jmp    801a86 <strchr+0xee>
+  801a81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a86:	c9                   	leave
+  801a87:	c3                   	ret
+
+0000000000801a88 <strfind>:
+strfind(const char *s, char c) {
+  801a88:	55                   	push   %rbp
+  801a89:	48 89 e5             	mov    %rsp,%rbp
+  801a8c:	48 83 ec 10          	sub    $0x10,%rsp
+  801a90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a94:	89 f0                	mov    %esi,%eax
+  801a96:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801a99:	eb 11                	jmp    801aac <strfind+0x24>
+    if (*s == c)
+  801a9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a9f:	0f b6 00             	movzbl (%rax),%eax
+  801aa2:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801aa5:	74 12                	je     801ab9 <strfind+0x31>
+  for (; *s; s++)
+  801aa7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801aac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ab0:	0f b6 00             	movzbl (%rax),%eax
+  801ab3:	84 c0                	test   %al,%al
+  801ab5:	75 e4                	jne    801a9b <strfind+0x13>
+  801ab7:	eb 01                	jmp    801aba <strfind+0x32>
+      break;
+  801ab9:	90                   	nop
+  return (char *)s;
+  801aba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801abe:	c9                   	leave
+  801abf:	c3                   	ret
+
+0000000000801ac0 <memset>:
+memset(void *v, int c, size_t n) {
+  801ac0:	55                   	push   %rbp
+  801ac1:	48 89 e5             	mov    %rsp,%rbp
+  801ac4:	48 83 ec 38          	sub    $0x38,%rsp
+  801ac8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801acc:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801acf:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801ad3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ad7:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801adb:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801ae0:	76 41                	jbe    801b23 <memset+0x63>
+  801ae2:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801ae9:	00 00 00 
+  801aec:	ff d0                	call   *%rax
+  801aee:	83 e0 01             	and    $0x1,%eax
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	74 2e                	je     801b23 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801af5:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801af8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801afc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b00:	48 89 ce             	mov    %rcx,%rsi
+  801b03:	48 89 f7             	mov    %rsi,%rdi
+  801b06:	48 89 d1             	mov    %rdx,%rcx
+  801b09:	fc                   	cld
+  801b0a:	f3 aa                	rep stos %al,%es:(%rdi)
+  801b0c:	48 89 ca             	mov    %rcx,%rdx
+  801b0f:	48 89 fe             	mov    %rdi,%rsi
+  801b12:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801b16:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801b1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801b1e:	e9 a7 00 00 00       	jmp    801bca <memset+0x10a>
+  if (n >= 8) {
+  801b23:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801b28:	0f 86 87 00 00 00    	jbe    801bb5 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801b2e:	eb 16                	jmp    801b46 <memset+0x86>
+      *p++ = c;
+  801b30:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b34:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801b38:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801b3c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801b3f:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801b41:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801b46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b4a:	83 e0 07             	and    $0x7,%eax
+  801b4d:	48 85 c0             	test   %rax,%rax
+  801b50:	75 de                	jne    801b30 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801b52:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801b55:	0f b6 c0             	movzbl %al,%eax
+  801b58:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801b5f:	01 01 01 
+  801b62:	48 0f af c2          	imul   %rdx,%rax
+  801b66:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801b6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b6e:	48 c1 e8 03          	shr    $0x3,%rax
+  801b72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801b76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b7a:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801b7e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801b82:	48 89 ce             	mov    %rcx,%rsi
+  801b85:	48 89 f7             	mov    %rsi,%rdi
+  801b88:	48 89 d1             	mov    %rdx,%rcx
+  801b8b:	fc                   	cld
+  801b8c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801b8f:	48 89 ca             	mov    %rcx,%rdx
+  801b92:	48 89 fe             	mov    %rdi,%rsi
+  801b95:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801b99:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801b9d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801ba2:	eb 11                	jmp    801bb5 <memset+0xf5>
+    *p++ = c;
+  801ba4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ba8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801bac:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801bb0:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801bb3:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801bb5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bb9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801bbd:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801bc1:	48 85 c0             	test   %rax,%rax
+  801bc4:	75 de                	jne    801ba4 <memset+0xe4>
+  return v;
+  801bc6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801bca:	c9                   	leave
+  801bcb:	c3                   	ret
+
+0000000000801bcc <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801bcc:	55                   	push   %rbp
+  801bcd:	48 89 e5             	mov    %rsp,%rbp
+  801bd0:	48 83 ec 38          	sub    $0x38,%rsp
+  801bd4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801bd8:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801bdc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801be0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801be4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801be8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801bec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801bf0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801bf4:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801bf8:	0f 83 da 00 00 00    	jae    801cd8 <memmove+0x10c>
+  801bfe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c06:	48 01 d0             	add    %rdx,%rax
+  801c09:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801c0d:	0f 83 c5 00 00 00    	jae    801cd8 <memmove+0x10c>
+    s += n;
+  801c13:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c17:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801c1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c1f:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801c23:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801c28:	0f 86 94 00 00 00    	jbe    801cc2 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801c2e:	eb 1c                	jmp    801c4c <memmove+0x80>
+        *--d = *--s;
+  801c30:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801c35:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801c3a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c3e:	0f b6 10             	movzbl (%rax),%edx
+  801c41:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c45:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801c47:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801c4c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c50:	83 e0 07             	and    $0x7,%eax
+  801c53:	48 85 c0             	test   %rax,%rax
+  801c56:	75 d8                	jne    801c30 <memmove+0x64>
+      nq = n / 8;
+  801c58:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c5c:	48 c1 e8 03          	shr    $0x3,%rax
+  801c60:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801c64:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801c69:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801c6e:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801c73:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801c77:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801c7b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801c7f:	48 89 cf             	mov    %rcx,%rdi
+  801c82:	48 89 d6             	mov    %rdx,%rsi
+  801c85:	48 89 c1             	mov    %rax,%rcx
+  801c88:	fd                   	std
+  801c89:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801c8c:	fc                   	cld
+  801c8d:	48 89 c8             	mov    %rcx,%rax
+  801c90:	48 89 f2             	mov    %rsi,%rdx
+  801c93:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801c97:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801c9b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801c9f:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801ca4:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801ca9:	eb 17                	jmp    801cc2 <memmove+0xf6>
+      *--d = *--s;
+  801cab:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801cb0:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801cb5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cb9:	0f b6 10             	movzbl (%rax),%edx
+  801cbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801cc0:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801cc2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cc6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801cca:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801cce:	48 85 c0             	test   %rax,%rax
+  801cd1:	75 d8                	jne    801cab <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801cd3:	e9 f4 00 00 00       	jmp    801dcc <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801cd8:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801cdd:	76 46                	jbe    801d25 <memmove+0x159>
+  801cdf:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801ce6:	00 00 00 
+  801ce9:	ff d0                	call   *%rax
+  801ceb:	83 e0 01             	and    $0x1,%eax
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	74 33                	je     801d25 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801cf2:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801cf6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801cfa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cfe:	48 89 cf             	mov    %rcx,%rdi
+  801d01:	48 89 d6             	mov    %rdx,%rsi
+  801d04:	48 89 c1             	mov    %rax,%rcx
+  801d07:	fc                   	cld
+  801d08:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801d0a:	48 89 c8             	mov    %rcx,%rax
+  801d0d:	48 89 f2             	mov    %rsi,%rdx
+  801d10:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801d14:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d18:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801d1c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d20:	e9 ab 00 00 00       	jmp    801dd0 <memmove+0x204>
+    if (n >= 8) {
+  801d25:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801d2a:	0f 86 8b 00 00 00    	jbe    801dbb <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801d30:	eb 22                	jmp    801d54 <memmove+0x188>
+        *d++ = *s++;
+  801d32:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d36:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801d3a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801d3e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d42:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801d46:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801d4a:	0f b6 12             	movzbl (%rdx),%edx
+  801d4d:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801d4f:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801d54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d58:	83 e0 07             	and    $0x7,%eax
+  801d5b:	48 85 c0             	test   %rax,%rax
+  801d5e:	75 d2                	jne    801d32 <memmove+0x166>
+      nq = n / 8;
+  801d60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d64:	48 c1 e8 03          	shr    $0x3,%rax
+  801d68:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801d6c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801d70:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d74:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801d78:	48 89 cf             	mov    %rcx,%rdi
+  801d7b:	48 89 d6             	mov    %rdx,%rsi
+  801d7e:	48 89 c1             	mov    %rax,%rcx
+  801d81:	fc                   	cld
+  801d82:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801d85:	48 89 c8             	mov    %rcx,%rax
+  801d88:	48 89 f2             	mov    %rsi,%rdx
+  801d8b:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801d8f:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801d97:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801d9c:	eb 1d                	jmp    801dbb <memmove+0x1ef>
+      *d++ = *s++;
+  801d9e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801da2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801da6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801daa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dae:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801db2:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801db6:	0f b6 12             	movzbl (%rdx),%edx
+  801db9:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801dbb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dbf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801dc3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801dc7:	48 85 c0             	test   %rax,%rax
+  801dca:	75 d2                	jne    801d9e <memmove+0x1d2>
+  return dst;
+  801dcc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801dd0:	c9                   	leave
+  801dd1:	c3                   	ret
+
+0000000000801dd2 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801dd2:	55                   	push   %rbp
+  801dd3:	48 89 e5             	mov    %rsp,%rbp
+  801dd6:	48 83 ec 18          	sub    $0x18,%rsp
+  801dda:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801dde:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801de2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801de6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801dea:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801dee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801df2:	48 89 ce             	mov    %rcx,%rsi
+  801df5:	48 89 c7             	mov    %rax,%rdi
+  801df8:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  801dff:	00 00 00 
+  801e02:	ff d0                	call   *%rax
+}
+  801e04:	c9                   	leave
+  801e05:	c3                   	ret
+
+0000000000801e06 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801e06:	55                   	push   %rbp
+  801e07:	48 89 e5             	mov    %rsp,%rbp
+  801e0a:	48 83 ec 40          	sub    $0x40,%rsp
+  801e0e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801e12:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801e16:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801e1a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e1e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801e22:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e26:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801e2a:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801e2f:	0f 86 a7 00 00 00    	jbe    801edc <memcmp+0xd6>
+  801e35:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801e3c:	00 00 00 
+  801e3f:	ff d0                	call   *%rax
+  801e41:	83 e0 02             	and    $0x2,%eax
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	0f 84 90 00 00 00    	je     801edc <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801e4c:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801e50:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e54:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e58:	48 89 ce             	mov    %rcx,%rsi
+  801e5b:	48 89 c7             	mov    %rax,%rdi
+  801e5e:	48 b8 ed 13 80 00 00 	movabs $0x8013ed,%rax
+  801e65:	00 00 00 
+  801e68:	ff d0                	call   *%rax
+  801e6a:	e9 c2 00 00 00       	jmp    801f31 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801e6f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e73:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e77:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801e7b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e7f:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801e83:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801e87:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801e8b:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801e8e:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801e95:	74 36                	je     801ecd <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801e97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801e9a:	f7 d0                	not    %eax
+  801e9c:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801ea0:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801ea3:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801ea6:	48 63 d0             	movslq %eax,%rdx
+  801ea9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ead:	48 01 d0             	add    %rdx,%rax
+  801eb0:	0f b6 00             	movzbl (%rax),%eax
+  801eb3:	0f b6 c0             	movzbl %al,%eax
+  801eb6:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801eb9:	48 63 ca             	movslq %edx,%rcx
+  801ebc:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ec0:	48 01 ca             	add    %rcx,%rdx
+  801ec3:	0f b6 12             	movzbl (%rdx),%edx
+  801ec6:	0f b6 d2             	movzbl %dl,%edx
+  801ec9:	29 d0                	sub    %edx,%eax
+  801ecb:	eb 64                	jmp    801f31 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801ecd:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801ed2:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801ed7:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801edc:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801ee1:	77 8c                	ja     801e6f <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801ee3:	eb 36                	jmp    801f1b <memcmp+0x115>
+    if (*s1 != *s2)
+  801ee5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ee9:	0f b6 10             	movzbl (%rax),%edx
+  801eec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ef0:	0f b6 00             	movzbl (%rax),%eax
+  801ef3:	38 c2                	cmp    %al,%dl
+  801ef5:	74 1a                	je     801f11 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801ef7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801efb:	0f b6 00             	movzbl (%rax),%eax
+  801efe:	0f b6 c8             	movzbl %al,%ecx
+  801f01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f05:	0f b6 00             	movzbl (%rax),%eax
+  801f08:	0f b6 d0             	movzbl %al,%edx
+  801f0b:	89 c8                	mov    %ecx,%eax
+  801f0d:	29 d0                	sub    %edx,%eax
+  801f0f:	eb 20                	jmp    801f31 <memcmp+0x12b>
+    s1++, s2++;
+  801f11:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801f16:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801f1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f1f:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f23:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f27:	48 85 c0             	test   %rax,%rax
+  801f2a:	75 b9                	jne    801ee5 <memcmp+0xdf>
+  }
+
+  return 0;
+  801f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f31:	c9                   	leave
+  801f32:	c3                   	ret
+
+0000000000801f33 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801f33:	55                   	push   %rbp
+  801f34:	48 89 e5             	mov    %rsp,%rbp
+  801f37:	48 83 ec 50          	sub    $0x50,%rsp
+  801f3b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801f3f:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801f42:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801f46:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801f4a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801f4e:	48 01 d0             	add    %rdx,%rax
+  801f51:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801f55:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f58:	66 0f 6e c0          	movd   %eax,%xmm0
+  801f5c:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801f60:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801f64:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801f69:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801f6d:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801f72:	76 73                	jbe    801fe7 <memfind+0xb4>
+  801f74:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  801f7b:	00 00 00 
+  801f7e:	ff d0                	call   *%rax
+  801f80:	83 e0 02             	and    $0x2,%eax
+  801f83:	85 c0                	test   %eax,%eax
+  801f85:	74 60                	je     801fe7 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801f87:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801f8a:	0f b6 c8             	movzbl %al,%ecx
+  801f8d:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801f91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f95:	89 ce                	mov    %ecx,%esi
+  801f97:	48 89 c7             	mov    %rax,%rdi
+  801f9a:	48 b8 dc 14 80 00 00 	movabs $0x8014dc,%rax
+  801fa1:	00 00 00 
+  801fa4:	ff d0                	call   *%rax
+  801fa6:	eb 6c                	jmp    802014 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801fa8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fac:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801fb0:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801fb4:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801fb9:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801fbd:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801fc1:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801fc4:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801fc8:	74 13                	je     801fdd <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801fca:	31 c0                	xor    %eax,%eax
+  801fcc:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801fd1:	48 63 d0             	movslq %eax,%rdx
+  801fd4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801fd8:	48 01 d0             	add    %rdx,%rax
+  801fdb:	eb 37                	jmp    802014 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801fdd:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801fe2:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801fe7:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801fec:	77 ba                	ja     801fa8 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801fee:	eb 13                	jmp    802003 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801ff0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ff4:	0f b6 00             	movzbl (%rax),%eax
+  801ff7:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801ffa:	38 d0                	cmp    %dl,%al
+  801ffc:	74 11                	je     80200f <memfind+0xdc>
+  for (; s < ends; s++)
+  801ffe:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802003:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802007:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80200b:	72 e3                	jb     801ff0 <memfind+0xbd>
+  80200d:	eb 01                	jmp    802010 <memfind+0xdd>
+      break;
+  80200f:	90                   	nop
+  return (void *)s;
+  802010:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  802014:	c9                   	leave
+  802015:	c3                   	ret
+
+0000000000802016 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  802016:	55                   	push   %rbp
+  802017:	48 89 e5             	mov    %rsp,%rbp
+  80201a:	48 83 ec 38          	sub    $0x38,%rsp
+  80201e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802022:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802026:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  802029:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  802030:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802037:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802038:	eb 05                	jmp    80203f <strtol+0x29>
+    s++;
+  80203a:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  80203f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802043:	0f b6 00             	movzbl (%rax),%eax
+  802046:	3c 20                	cmp    $0x20,%al
+  802048:	74 f0                	je     80203a <strtol+0x24>
+  80204a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80204e:	0f b6 00             	movzbl (%rax),%eax
+  802051:	3c 09                	cmp    $0x9,%al
+  802053:	74 e5                	je     80203a <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  802055:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802059:	0f b6 00             	movzbl (%rax),%eax
+  80205c:	3c 2b                	cmp    $0x2b,%al
+  80205e:	75 07                	jne    802067 <strtol+0x51>
+    s++;
+  802060:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802065:	eb 17                	jmp    80207e <strtol+0x68>
+  else if (*s == '-')
+  802067:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80206b:	0f b6 00             	movzbl (%rax),%eax
+  80206e:	3c 2d                	cmp    $0x2d,%al
+  802070:	75 0c                	jne    80207e <strtol+0x68>
+    s++, neg = 1;
+  802072:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802077:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80207e:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802082:	74 06                	je     80208a <strtol+0x74>
+  802084:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802088:	75 28                	jne    8020b2 <strtol+0x9c>
+  80208a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80208e:	0f b6 00             	movzbl (%rax),%eax
+  802091:	3c 30                	cmp    $0x30,%al
+  802093:	75 1d                	jne    8020b2 <strtol+0x9c>
+  802095:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802099:	48 83 c0 01          	add    $0x1,%rax
+  80209d:	0f b6 00             	movzbl (%rax),%eax
+  8020a0:	3c 78                	cmp    $0x78,%al
+  8020a2:	75 0e                	jne    8020b2 <strtol+0x9c>
+    s += 2, base = 16;
+  8020a4:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  8020a9:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  8020b0:	eb 2c                	jmp    8020de <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  8020b2:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020b6:	75 19                	jne    8020d1 <strtol+0xbb>
+  8020b8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020bc:	0f b6 00             	movzbl (%rax),%eax
+  8020bf:	3c 30                	cmp    $0x30,%al
+  8020c1:	75 0e                	jne    8020d1 <strtol+0xbb>
+    s++, base = 8;
+  8020c3:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8020c8:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  8020cf:	eb 0d                	jmp    8020de <strtol+0xc8>
+  else if (base == 0)
+  8020d1:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8020d5:	75 07                	jne    8020de <strtol+0xc8>
+    base = 10;
+  8020d7:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  8020de:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020e2:	0f b6 00             	movzbl (%rax),%eax
+  8020e5:	3c 2f                	cmp    $0x2f,%al
+  8020e7:	7e 1d                	jle    802106 <strtol+0xf0>
+  8020e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ed:	0f b6 00             	movzbl (%rax),%eax
+  8020f0:	3c 39                	cmp    $0x39,%al
+  8020f2:	7f 12                	jg     802106 <strtol+0xf0>
+      dig = *s - '0';
+  8020f4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020f8:	0f b6 00             	movzbl (%rax),%eax
+  8020fb:	0f be c0             	movsbl %al,%eax
+  8020fe:	83 e8 30             	sub    $0x30,%eax
+  802101:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802104:	eb 4e                	jmp    802154 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802106:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80210a:	0f b6 00             	movzbl (%rax),%eax
+  80210d:	3c 60                	cmp    $0x60,%al
+  80210f:	7e 1d                	jle    80212e <strtol+0x118>
+  802111:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802115:	0f b6 00             	movzbl (%rax),%eax
+  802118:	3c 7a                	cmp    $0x7a,%al
+  80211a:	7f 12                	jg     80212e <strtol+0x118>
+      dig = *s - 'a' + 10;
+  80211c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802120:	0f b6 00             	movzbl (%rax),%eax
+  802123:	0f be c0             	movsbl %al,%eax
+  802126:	83 e8 57             	sub    $0x57,%eax
+  802129:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80212c:	eb 26                	jmp    802154 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  80212e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802132:	0f b6 00             	movzbl (%rax),%eax
+  802135:	3c 40                	cmp    $0x40,%al
+  802137:	7e 47                	jle    802180 <strtol+0x16a>
+  802139:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80213d:	0f b6 00             	movzbl (%rax),%eax
+  802140:	3c 5a                	cmp    $0x5a,%al
+  802142:	7f 3c                	jg     802180 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  802144:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802148:	0f b6 00             	movzbl (%rax),%eax
+  80214b:	0f be c0             	movsbl %al,%eax
+  80214e:	83 e8 37             	sub    $0x37,%eax
+  802151:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  802154:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802157:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  80215a:	7d 23                	jge    80217f <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  80215c:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802161:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802164:	48 98                	cltq
+  802166:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  80216b:	48 89 c2             	mov    %rax,%rdx
+  80216e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802171:	48 98                	cltq
+  802173:	48 01 d0             	add    %rdx,%rax
+  802176:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80217a:	e9 5f ff ff ff       	jmp    8020de <strtol+0xc8>
+      break;
+  80217f:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802180:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802185:	74 0b                	je     802192 <strtol+0x17c>
+    *endptr = (char *)s;
+  802187:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80218b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80218f:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802192:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802196:	74 09                	je     8021a1 <strtol+0x18b>
+  802198:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80219c:	48 f7 d8             	neg    %rax
+  80219f:	eb 04                	jmp    8021a5 <strtol+0x18f>
+  8021a1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8021a5:	c9                   	leave
+  8021a6:	c3                   	ret
+
+00000000008021a7 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  8021a7:	55                   	push   %rbp
+  8021a8:	48 89 e5             	mov    %rsp,%rbp
+  8021ab:	53                   	push   %rbx
+  8021ac:	48 83 ec 48          	sub    $0x48,%rsp
+  8021b0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8021b4:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8021b8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8021bc:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  8021c0:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8021c4:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  8021c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021cc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8021d0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8021d4:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8021d8:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8021dc:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  8021e0:	4c 89 c3             	mov    %r8,%rbx
+  8021e3:	cd 30                	int    $0x30
+  8021e5:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  8021e9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  8021ee:	74 46                	je     802236 <syscall+0x8f>
+  8021f0:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  8021f5:	7e 3f                	jle    802236 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  8021f7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8021fb:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ff:	49 89 d0             	mov    %rdx,%r8
+  802202:	48 89 c1             	mov    %rax,%rcx
+  802205:	48 b8 88 64 80 00 00 	movabs $0x806488,%rax
+  80220c:	00 00 00 
+  80220f:	48 89 c2             	mov    %rax,%rdx
+  802212:	be 22 00 00 00       	mov    $0x22,%esi
+  802217:	48 b8 a7 64 80 00 00 	movabs $0x8064a7,%rax
+  80221e:	00 00 00 
+  802221:	48 89 c7             	mov    %rax,%rdi
+  802224:	b8 00 00 00 00       	mov    $0x0,%eax
+  802229:	49 b9 ba 04 80 00 00 	movabs $0x8004ba,%r9
+  802230:	00 00 00 
+  802233:	41 ff d1             	call   *%r9
+
+  return ret;
+  802236:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  80223a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80223e:	c9                   	leave
+  80223f:	c3                   	ret
+
+0000000000802240 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  802240:	55                   	push   %rbp
+  802241:	48 89 e5             	mov    %rsp,%rbp
+  802244:	48 83 ec 10          	sub    $0x10,%rsp
+  802248:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80224c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  802250:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802254:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802258:	48 83 ec 08          	sub    $0x8,%rsp
+  80225c:	6a 00                	push   $0x0
+  80225e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80226a:	48 89 d1             	mov    %rdx,%rcx
+  80226d:	48 89 c2             	mov    %rax,%rdx
+  802270:	be 00 00 00 00       	mov    $0x0,%esi
+  802275:	bf 00 00 00 00       	mov    $0x0,%edi
+  80227a:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802281:	00 00 00 
+  802284:	ff d0                	call   *%rax
+  802286:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80228a:	90                   	nop
+  80228b:	c9                   	leave
+  80228c:	c3                   	ret
+
+000000000080228d <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80228d:	55                   	push   %rbp
+  80228e:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802291:	48 83 ec 08          	sub    $0x8,%rsp
+  802295:	6a 00                	push   $0x0
+  802297:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80229d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8022b2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8022b7:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8022be:	00 00 00 
+  8022c1:	ff d0                	call   *%rax
+  8022c3:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022c7:	c9                   	leave
+  8022c8:	c3                   	ret
+
+00000000008022c9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  8022c9:	55                   	push   %rbp
+  8022ca:	48 89 e5             	mov    %rsp,%rbp
+  8022cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d1:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  8022d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8022d7:	48 98                	cltq
+  8022d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8022dd:	6a 00                	push   $0x0
+  8022df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022f0:	48 89 c2             	mov    %rax,%rdx
+  8022f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8022f8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022fd:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802304:	00 00 00 
+  802307:	ff d0                	call   *%rax
+  802309:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80230d:	c9                   	leave
+  80230e:	c3                   	ret
+
+000000000080230f <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  80230f:	55                   	push   %rbp
+  802310:	48 89 e5             	mov    %rsp,%rbp
+  802313:	48 83 ec 10          	sub    $0x10,%rsp
+  802317:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  80231a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80231d:	48 98                	cltq
+  80231f:	48 83 ec 08          	sub    $0x8,%rsp
+  802323:	6a 00                	push   $0x0
+  802325:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80232b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802331:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802336:	48 89 c2             	mov    %rax,%rdx
+  802339:	be 00 00 00 00       	mov    $0x0,%esi
+  80233e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802343:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80234a:	00 00 00 
+  80234d:	ff d0                	call   *%rax
+  80234f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802353:	90                   	nop
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+
+0000000000802356 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  802356:	55                   	push   %rbp
+  802357:	48 89 e5             	mov    %rsp,%rbp
+  80235a:	48 83 ec 20          	sub    $0x20,%rsp
+  80235e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802361:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  802365:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802368:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  80236b:	b8 05 00 00 00       	mov    $0x5,%eax
+  802370:	cd 30                	int    $0x30
+  802372:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802376:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80237a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80237f:	7e 3d                	jle    8023be <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802381:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802385:	49 89 c0             	mov    %rax,%r8
+  802388:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80238d:	48 b8 88 64 80 00 00 	movabs $0x806488,%rax
+  802394:	00 00 00 
+  802397:	48 89 c2             	mov    %rax,%rdx
+  80239a:	be 49 00 00 00       	mov    $0x49,%esi
+  80239f:	48 b8 a7 64 80 00 00 	movabs $0x8064a7,%rax
+  8023a6:	00 00 00 
+  8023a9:	48 89 c7             	mov    %rax,%rdi
+  8023ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b1:	49 b9 ba 04 80 00 00 	movabs $0x8004ba,%r9
+  8023b8:	00 00 00 
+  8023bb:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  8023be:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8023c3:	75 13                	jne    8023d8 <sys_env_wait+0x82>
+  8023c5:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8023ca:	74 0c                	je     8023d8 <sys_env_wait+0x82>
+    *status = st;
+  8023cc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8023d0:	89 c2                	mov    %eax,%edx
+  8023d2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8023d6:	89 10                	mov    %edx,(%rax)
+  return ret;
+  8023d8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8023dc:	c9                   	leave
+  8023dd:	c3                   	ret
+
+00000000008023de <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  8023de:	55                   	push   %rbp
+  8023df:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  8023e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8023e6:	6a 00                	push   $0x0
+  8023e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fe:	be 00 00 00 00       	mov    $0x0,%esi
+  802403:	bf 02 00 00 00       	mov    $0x2,%edi
+  802408:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80240f:	00 00 00 
+  802412:	ff d0                	call   *%rax
+  802414:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802418:	c9                   	leave
+  802419:	c3                   	ret
+
+000000000080241a <sys_yield>:
+
+void
+sys_yield(void) {
+  80241a:	55                   	push   %rbp
+  80241b:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  80241e:	48 83 ec 08          	sub    $0x8,%rsp
+  802422:	6a 00                	push   $0x0
+  802424:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80242a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802430:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80243a:	be 00 00 00 00       	mov    $0x0,%esi
+  80243f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802444:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80244b:	00 00 00 
+  80244e:	ff d0                	call   *%rax
+  802450:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802454:	90                   	nop
+  802455:	c9                   	leave
+  802456:	c3                   	ret
+
+0000000000802457 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802457:	55                   	push   %rbp
+  802458:	48 89 e5             	mov    %rsp,%rbp
+  80245b:	48 83 ec 20          	sub    $0x20,%rsp
+  80245f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802462:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802466:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802469:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80246c:	48 63 c8             	movslq %eax,%rcx
+  80246f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802473:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802476:	48 98                	cltq
+  802478:	48 83 ec 08          	sub    $0x8,%rsp
+  80247c:	6a 00                	push   $0x0
+  80247e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802484:	49 89 c8             	mov    %rcx,%r8
+  802487:	48 89 d1             	mov    %rdx,%rcx
+  80248a:	48 89 c2             	mov    %rax,%rdx
+  80248d:	be 01 00 00 00       	mov    $0x1,%esi
+  802492:	bf 06 00 00 00       	mov    $0x6,%edi
+  802497:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80249e:	00 00 00 
+  8024a1:	ff d0                	call   *%rax
+  8024a3:	48 83 c4 10          	add    $0x10,%rsp
+  8024a7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8024aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8024ad:	c9                   	leave
+  8024ae:	c3                   	ret
+
+00000000008024af <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8024af:	55                   	push   %rbp
+  8024b0:	48 89 e5             	mov    %rsp,%rbp
+  8024b3:	48 83 ec 20          	sub    $0x20,%rsp
+  8024b7:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8024ba:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8024be:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8024c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8024c5:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8024c9:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8024cc:	48 63 c8             	movslq %eax,%rcx
+  8024cf:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8024d3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8024d6:	48 63 f0             	movslq %eax,%rsi
+  8024d9:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8024dd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024e0:	48 98                	cltq
+  8024e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024e6:	51                   	push   %rcx
+  8024e7:	49 89 f9             	mov    %rdi,%r9
+  8024ea:	49 89 f0             	mov    %rsi,%r8
+  8024ed:	48 89 d1             	mov    %rdx,%rcx
+  8024f0:	48 89 c2             	mov    %rax,%rdx
+  8024f3:	be 01 00 00 00       	mov    $0x1,%esi
+  8024f8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8024fd:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802504:	00 00 00 
+  802507:	ff d0                	call   *%rax
+  802509:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80250d:	c9                   	leave
+  80250e:	c3                   	ret
+
+000000000080250f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  80250f:	55                   	push   %rbp
+  802510:	48 89 e5             	mov    %rsp,%rbp
+  802513:	48 83 ec 10          	sub    $0x10,%rsp
+  802517:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80251a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  80251e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802522:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802525:	48 98                	cltq
+  802527:	48 83 ec 08          	sub    $0x8,%rsp
+  80252b:	6a 00                	push   $0x0
+  80252d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802533:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802539:	48 89 d1             	mov    %rdx,%rcx
+  80253c:	48 89 c2             	mov    %rax,%rdx
+  80253f:	be 01 00 00 00       	mov    $0x1,%esi
+  802544:	bf 08 00 00 00       	mov    $0x8,%edi
+  802549:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802550:	00 00 00 
+  802553:	ff d0                	call   *%rax
+  802555:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802559:	c9                   	leave
+  80255a:	c3                   	ret
+
+000000000080255b <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  80255b:	55                   	push   %rbp
+  80255c:	48 89 e5             	mov    %rsp,%rbp
+  80255f:	48 83 ec 10          	sub    $0x10,%rsp
+  802563:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802566:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802569:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80256c:	48 63 d0             	movslq %eax,%rdx
+  80256f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802572:	48 98                	cltq
+  802574:	48 83 ec 08          	sub    $0x8,%rsp
+  802578:	6a 00                	push   $0x0
+  80257a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802580:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802586:	48 89 d1             	mov    %rdx,%rcx
+  802589:	48 89 c2             	mov    %rax,%rdx
+  80258c:	be 01 00 00 00       	mov    $0x1,%esi
+  802591:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802596:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80259d:	00 00 00 
+  8025a0:	ff d0                	call   *%rax
+  8025a2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a6:	c9                   	leave
+  8025a7:	c3                   	ret
+
+00000000008025a8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8025a8:	55                   	push   %rbp
+  8025a9:	48 89 e5             	mov    %rsp,%rbp
+  8025ac:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025b3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8025b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8025bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8025be:	48 98                	cltq
+  8025c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8025c4:	6a 00                	push   $0x0
+  8025c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025d2:	48 89 d1             	mov    %rdx,%rcx
+  8025d5:	48 89 c2             	mov    %rax,%rdx
+  8025d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8025dd:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8025e2:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8025e9:	00 00 00 
+  8025ec:	ff d0                	call   *%rax
+  8025ee:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025f2:	c9                   	leave
+  8025f3:	c3                   	ret
+
+00000000008025f4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8025f4:	55                   	push   %rbp
+  8025f5:	48 89 e5             	mov    %rsp,%rbp
+  8025f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8025fc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8025ff:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802603:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802607:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80260a:	48 98                	cltq
+  80260c:	48 83 ec 08          	sub    $0x8,%rsp
+  802610:	6a 00                	push   $0x0
+  802612:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80261e:	48 89 d1             	mov    %rdx,%rcx
+  802621:	48 89 c2             	mov    %rax,%rdx
+  802624:	be 01 00 00 00       	mov    $0x1,%esi
+  802629:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80262e:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802635:	00 00 00 
+  802638:	ff d0                	call   *%rax
+  80263a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80263e:	c9                   	leave
+  80263f:	c3                   	ret
+
+0000000000802640 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802640:	55                   	push   %rbp
+  802641:	48 89 e5             	mov    %rsp,%rbp
+  802644:	48 83 ec 20          	sub    $0x20,%rsp
+  802648:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80264b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80264f:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802653:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  802656:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802659:	48 63 f0             	movslq %eax,%rsi
+  80265c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802660:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802664:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802667:	48 98                	cltq
+  802669:	48 83 ec 08          	sub    $0x8,%rsp
+  80266d:	6a 00                	push   $0x0
+  80266f:	49 89 f1             	mov    %rsi,%r9
+  802672:	49 89 c8             	mov    %rcx,%r8
+  802675:	48 89 d1             	mov    %rdx,%rcx
+  802678:	48 89 c2             	mov    %rax,%rdx
+  80267b:	be 00 00 00 00       	mov    $0x0,%esi
+  802680:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802685:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80268c:	00 00 00 
+  80268f:	ff d0                	call   *%rax
+  802691:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802695:	c9                   	leave
+  802696:	c3                   	ret
+
+0000000000802697 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802697:	55                   	push   %rbp
+  802698:	48 89 e5             	mov    %rsp,%rbp
+  80269b:	48 83 ec 10          	sub    $0x10,%rsp
+  80269f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8026a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8026ab:	6a 00                	push   $0x0
+  8026ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026be:	48 89 c2             	mov    %rax,%rdx
+  8026c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8026c6:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8026cb:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8026d2:	00 00 00 
+  8026d5:	ff d0                	call   *%rax
+  8026d7:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026db:	c9                   	leave
+  8026dc:	c3                   	ret
+
+00000000008026dd <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  8026dd:	55                   	push   %rbp
+  8026de:	48 89 e5             	mov    %rsp,%rbp
+  8026e1:	48 83 ec 10          	sub    $0x10,%rsp
+  8026e5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8026e9:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  8026ed:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8026f9:	6a 00                	push   $0x0
+  8026fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802707:	48 89 d1             	mov    %rdx,%rcx
+  80270a:	48 89 c2             	mov    %rax,%rdx
+  80270d:	be 01 00 00 00       	mov    $0x1,%esi
+  802712:	bf 10 00 00 00       	mov    $0x10,%edi
+  802717:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80271e:	00 00 00 
+  802721:	ff d0                	call   *%rax
+  802723:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802727:	c9                   	leave
+  802728:	c3                   	ret
+
+0000000000802729 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802729:	55                   	push   %rbp
+  80272a:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  80272d:	48 83 ec 08          	sub    $0x8,%rsp
+  802731:	6a 00                	push   $0x0
+  802733:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802739:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80273f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802744:	ba 00 00 00 00       	mov    $0x0,%edx
+  802749:	be 00 00 00 00       	mov    $0x0,%esi
+  80274e:	bf 11 00 00 00       	mov    $0x11,%edi
+  802753:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80275a:	00 00 00 
+  80275d:	ff d0                	call   *%rax
+  80275f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802763:	c9                   	leave
+  802764:	c3                   	ret
+
+0000000000802765 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  802765:	55                   	push   %rbp
+  802766:	48 89 e5             	mov    %rsp,%rbp
+  802769:	48 83 ec 10          	sub    $0x10,%rsp
+  80276d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802771:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802775:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802779:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80277d:	48 83 ec 08          	sub    $0x8,%rsp
+  802781:	6a 00                	push   $0x0
+  802783:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802789:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80278f:	48 89 d1             	mov    %rdx,%rcx
+  802792:	48 89 c2             	mov    %rax,%rdx
+  802795:	be 00 00 00 00       	mov    $0x0,%esi
+  80279a:	bf 12 00 00 00       	mov    $0x12,%edi
+  80279f:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+  8027ab:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027af:	c9                   	leave
+  8027b0:	c3                   	ret
+
+00000000008027b1 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8027b1:	55                   	push   %rbp
+  8027b2:	48 89 e5             	mov    %rsp,%rbp
+  8027b5:	48 83 ec 20          	sub    $0x20,%rsp
+  8027b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8027bd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027c1:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8027c4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8027c7:	48 63 c8             	movslq %eax,%rcx
+  8027ca:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8027d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d6:	6a 00                	push   $0x0
+  8027d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027de:	49 89 c8             	mov    %rcx,%r8
+  8027e1:	48 89 d1             	mov    %rdx,%rcx
+  8027e4:	48 89 c2             	mov    %rax,%rdx
+  8027e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ec:	bf 13 00 00 00       	mov    $0x13,%edi
+  8027f1:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+  8027fd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802801:	c9                   	leave
+  802802:	c3                   	ret
+
+0000000000802803 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802803:	55                   	push   %rbp
+  802804:	48 89 e5             	mov    %rsp,%rbp
+  802807:	48 83 ec 20          	sub    $0x20,%rsp
+  80280b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80280f:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802812:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  802816:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80281a:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80281d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802821:	48 83 ec 08          	sub    $0x8,%rsp
+  802825:	6a 00                	push   $0x0
+  802827:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80282d:	49 89 c8             	mov    %rcx,%r8
+  802830:	48 89 d1             	mov    %rdx,%rcx
+  802833:	48 89 c2             	mov    %rax,%rdx
+  802836:	be 00 00 00 00       	mov    $0x0,%esi
+  80283b:	bf 14 00 00 00       	mov    $0x14,%edi
+  802840:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802847:	00 00 00 
+  80284a:	ff d0                	call   *%rax
+  80284c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802850:	c9                   	leave
+  802851:	c3                   	ret
+
+0000000000802852 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  802852:	55                   	push   %rbp
+  802853:	48 89 e5             	mov    %rsp,%rbp
+  802856:	48 83 ec 10          	sub    $0x10,%rsp
+  80285a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80285e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  802861:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802864:	48 63 d0             	movslq %eax,%rdx
+  802867:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80286b:	48 83 ec 08          	sub    $0x8,%rsp
+  80286f:	6a 00                	push   $0x0
+  802871:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802877:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80287d:	48 89 d1             	mov    %rdx,%rcx
+  802880:	48 89 c2             	mov    %rax,%rdx
+  802883:	be 00 00 00 00       	mov    $0x0,%esi
+  802888:	bf 15 00 00 00       	mov    $0x15,%edi
+  80288d:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802894:	00 00 00 
+  802897:	ff d0                	call   *%rax
+  802899:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80289d:	c9                   	leave
+  80289e:	c3                   	ret
+
+000000000080289f <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  80289f:	55                   	push   %rbp
+  8028a0:	48 89 e5             	mov    %rsp,%rbp
+  8028a3:	48 83 ec 20          	sub    $0x20,%rsp
+  8028a7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8028ab:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8028ae:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8028b1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8028b5:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8028b9:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8028bc:	48 63 c8             	movslq %eax,%rcx
+  8028bf:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8028c2:	48 63 d0             	movslq %eax,%rdx
+  8028c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028cd:	6a 00                	push   $0x0
+  8028cf:	49 89 f1             	mov    %rsi,%r9
+  8028d2:	49 89 c8             	mov    %rcx,%r8
+  8028d5:	48 89 d1             	mov    %rdx,%rcx
+  8028d8:	48 89 c2             	mov    %rax,%rdx
+  8028db:	be 00 00 00 00       	mov    $0x0,%esi
+  8028e0:	bf 16 00 00 00       	mov    $0x16,%edi
+  8028e5:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8028ec:	00 00 00 
+  8028ef:	ff d0                	call   *%rax
+  8028f1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028f5:	c9                   	leave
+  8028f6:	c3                   	ret
+
+00000000008028f7 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  8028f7:	55                   	push   %rbp
+  8028f8:	48 89 e5             	mov    %rsp,%rbp
+  8028fb:	48 83 ec 30          	sub    $0x30,%rsp
+  8028ff:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802903:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802907:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80290b:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  80290f:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802913:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802917:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  80291b:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  80291f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802923:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802927:	48 83 ec 08          	sub    $0x8,%rsp
+  80292b:	51                   	push   %rcx
+  80292c:	49 89 f9             	mov    %rdi,%r9
+  80292f:	49 89 f0             	mov    %rsi,%r8
+  802932:	48 89 d1             	mov    %rdx,%rcx
+  802935:	48 89 c2             	mov    %rax,%rdx
+  802938:	be 00 00 00 00       	mov    $0x0,%esi
+  80293d:	bf 17 00 00 00       	mov    $0x17,%edi
+  802942:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802949:	00 00 00 
+  80294c:	ff d0                	call   *%rax
+  80294e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802952:	c9                   	leave
+  802953:	c3                   	ret
+
+0000000000802954 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802954:	55                   	push   %rbp
+  802955:	48 89 e5             	mov    %rsp,%rbp
+  802958:	48 83 ec 10          	sub    $0x10,%rsp
+  80295c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  80295f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802962:	48 98                	cltq
+  802964:	48 83 ec 08          	sub    $0x8,%rsp
+  802968:	6a 00                	push   $0x0
+  80296a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802970:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802976:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80297b:	48 89 c2             	mov    %rax,%rdx
+  80297e:	be 00 00 00 00       	mov    $0x0,%esi
+  802983:	bf 18 00 00 00       	mov    $0x18,%edi
+  802988:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  80298f:	00 00 00 
+  802992:	ff d0                	call   *%rax
+  802994:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802998:	90                   	nop
+  802999:	c9                   	leave
+  80299a:	c3                   	ret
+
+000000000080299b <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  80299b:	55                   	push   %rbp
+  80299c:	48 89 e5             	mov    %rsp,%rbp
+  80299f:	48 83 ec 30          	sub    $0x30,%rsp
+  8029a3:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8029a6:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8029aa:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8029ae:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8029b1:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8029b4:	48 63 f0             	movslq %eax,%rsi
+  8029b7:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8029bb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8029bf:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8029c2:	48 98                	cltq
+  8029c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c8:	6a 00                	push   $0x0
+  8029ca:	49 89 f1             	mov    %rsi,%r9
+  8029cd:	49 89 c8             	mov    %rcx,%r8
+  8029d0:	48 89 d1             	mov    %rdx,%rcx
+  8029d3:	48 89 c2             	mov    %rax,%rdx
+  8029d6:	be 01 00 00 00       	mov    $0x1,%esi
+  8029db:	bf 19 00 00 00       	mov    $0x19,%edi
+  8029e0:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  8029e7:	00 00 00 
+  8029ea:	ff d0                	call   *%rax
+  8029ec:	48 83 c4 10          	add    $0x10,%rsp
+  8029f0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  8029f3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8029f6:	c9                   	leave
+  8029f7:	c3                   	ret
+
+00000000008029f8 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  8029f8:	55                   	push   %rbp
+  8029f9:	48 89 e5             	mov    %rsp,%rbp
+  8029fc:	48 83 ec 20          	sub    $0x20,%rsp
+  802a00:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a04:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a08:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802a0b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802a0e:	48 63 c8             	movslq %eax,%rcx
+  802a11:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a15:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a19:	48 83 ec 08          	sub    $0x8,%rsp
+  802a1d:	6a 00                	push   $0x0
+  802a1f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a25:	49 89 c8             	mov    %rcx,%r8
+  802a28:	48 89 d1             	mov    %rdx,%rcx
+  802a2b:	48 89 c2             	mov    %rax,%rdx
+  802a2e:	be 01 00 00 00       	mov    $0x1,%esi
+  802a33:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802a38:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+  802a44:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a48:	c9                   	leave
+  802a49:	c3                   	ret
+
+0000000000802a4a <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802a4a:	55                   	push   %rbp
+  802a4b:	48 89 e5             	mov    %rsp,%rbp
+  802a4e:	48 83 ec 20          	sub    $0x20,%rsp
+  802a52:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a56:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a5a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802a5e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802a62:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802a66:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a6a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a6e:	6a 00                	push   $0x0
+  802a70:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a76:	49 89 c8             	mov    %rcx,%r8
+  802a79:	48 89 d1             	mov    %rdx,%rcx
+  802a7c:	48 89 c2             	mov    %rax,%rdx
+  802a7f:	be 01 00 00 00       	mov    $0x1,%esi
+  802a84:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802a89:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802a90:	00 00 00 
+  802a93:	ff d0                	call   *%rax
+  802a95:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a99:	c9                   	leave
+  802a9a:	c3                   	ret
+
+0000000000802a9b <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802a9b:	55                   	push   %rbp
+  802a9c:	48 89 e5             	mov    %rsp,%rbp
+  802a9f:	48 83 ec 30          	sub    $0x30,%rsp
+  802aa3:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802aa7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802aab:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802aae:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802ab2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802ab6:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802ab9:	48 63 c8             	movslq %eax,%rcx
+  802abc:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802ac0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ac4:	48 83 ec 08          	sub    $0x8,%rsp
+  802ac8:	6a 00                	push   $0x0
+  802aca:	49 89 f1             	mov    %rsi,%r9
+  802acd:	49 89 c8             	mov    %rcx,%r8
+  802ad0:	48 89 d1             	mov    %rdx,%rcx
+  802ad3:	48 89 c2             	mov    %rax,%rdx
+  802ad6:	be 01 00 00 00       	mov    $0x1,%esi
+  802adb:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802ae0:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+  802aec:	48 83 c4 10          	add    $0x10,%rsp
+  802af0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802af3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802af6:	c9                   	leave
+  802af7:	c3                   	ret
+
+0000000000802af8 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802af8:	55                   	push   %rbp
+  802af9:	48 89 e5             	mov    %rsp,%rbp
+  802afc:	48 83 ec 10          	sub    $0x10,%rsp
+  802b00:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802b03:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b06:	48 98                	cltq
+  802b08:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0c:	6a 00                	push   $0x0
+  802b0e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b1f:	48 89 c2             	mov    %rax,%rdx
+  802b22:	be 01 00 00 00       	mov    $0x1,%esi
+  802b27:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802b2c:	48 b8 a7 21 80 00 00 	movabs $0x8021a7,%rax
+  802b33:	00 00 00 
+  802b36:	ff d0                	call   *%rax
+  802b38:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b3c:	c9                   	leave
+  802b3d:	c3                   	ret
+
+0000000000802b3e <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802b3e:	55                   	push   %rbp
+  802b3f:	48 89 e5             	mov    %rsp,%rbp
+  802b42:	48 83 ec 08          	sub    $0x8,%rsp
+  802b46:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802b4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b4e:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802b55:	ff ff ff 
+  802b58:	48 01 d0             	add    %rdx,%rax
+  802b5b:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802b5f:	c9                   	leave
+  802b60:	c3                   	ret
+
+0000000000802b61 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802b61:	55                   	push   %rbp
+  802b62:	48 89 e5             	mov    %rsp,%rbp
+  802b65:	48 83 ec 08          	sub    $0x8,%rsp
+  802b69:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802b6d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802b71:	48 89 c7             	mov    %rax,%rdi
+  802b74:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  802b7b:	00 00 00 
+  802b7e:	ff d0                	call   *%rax
+  802b80:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802b86:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802b8a:	c9                   	leave
+  802b8b:	c3                   	ret
+
+0000000000802b8c <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802b8c:	55                   	push   %rbp
+  802b8d:	48 89 e5             	mov    %rsp,%rbp
+  802b90:	48 83 ec 18          	sub    $0x18,%rsp
+  802b94:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802b98:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802b9f:	e9 ae 00 00 00       	jmp    802c52 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802ba4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802ba7:	c1 e0 0c             	shl    $0xc,%eax
+  802baa:	48 98                	cltq
+  802bac:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802bb1:	48 01 d0             	add    %rdx,%rax
+  802bb4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802bb8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bbc:	48 c1 e8 27          	shr    $0x27,%rax
+  802bc0:	48 89 c2             	mov    %rax,%rdx
+  802bc3:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802bca:	01 00 00 
+  802bcd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bd1:	83 e0 01             	and    $0x1,%eax
+  802bd4:	48 85 c0             	test   %rax,%rax
+  802bd7:	74 63                	je     802c3c <fd_alloc+0xb0>
+  802bd9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bdd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802be1:	48 89 c2             	mov    %rax,%rdx
+  802be4:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802beb:	01 00 00 
+  802bee:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802bf2:	83 e0 01             	and    $0x1,%eax
+  802bf5:	48 85 c0             	test   %rax,%rax
+  802bf8:	74 42                	je     802c3c <fd_alloc+0xb0>
+  802bfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802bfe:	48 c1 e8 15          	shr    $0x15,%rax
+  802c02:	48 89 c2             	mov    %rax,%rdx
+  802c05:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802c0c:	01 00 00 
+  802c0f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c13:	83 e0 01             	and    $0x1,%eax
+  802c16:	48 85 c0             	test   %rax,%rax
+  802c19:	74 21                	je     802c3c <fd_alloc+0xb0>
+  802c1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c1f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802c23:	48 89 c2             	mov    %rax,%rdx
+  802c26:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802c2d:	01 00 00 
+  802c30:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c34:	83 e0 01             	and    $0x1,%eax
+  802c37:	48 85 c0             	test   %rax,%rax
+  802c3a:	75 12                	jne    802c4e <fd_alloc+0xc2>
+      *fd_store = fd;
+  802c3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c40:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802c44:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802c47:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4c:	eb 1e                	jmp    802c6c <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802c4e:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802c52:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802c56:	0f 8e 48 ff ff ff    	jle    802ba4 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802c5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c60:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802c67:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802c6c:	c9                   	leave
+  802c6d:	c3                   	ret
+
+0000000000802c6e <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802c6e:	55                   	push   %rbp
+  802c6f:	48 89 e5             	mov    %rsp,%rbp
+  802c72:	48 83 ec 20          	sub    $0x20,%rsp
+  802c76:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802c79:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802c7d:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802c81:	78 06                	js     802c89 <fd_lookup+0x1b>
+  802c83:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802c87:	7e 0a                	jle    802c93 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802c89:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c8e:	e9 af 00 00 00       	jmp    802d42 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802c93:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802c96:	c1 e0 0c             	shl    $0xc,%eax
+  802c99:	48 98                	cltq
+  802c9b:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802ca0:	48 01 d0             	add    %rdx,%rax
+  802ca3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802ca7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cab:	48 c1 e8 27          	shr    $0x27,%rax
+  802caf:	48 89 c2             	mov    %rax,%rdx
+  802cb2:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802cb9:	01 00 00 
+  802cbc:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cc0:	83 e0 01             	and    $0x1,%eax
+  802cc3:	48 85 c0             	test   %rax,%rax
+  802cc6:	74 63                	je     802d2b <fd_lookup+0xbd>
+  802cc8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ccc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802cd0:	48 89 c2             	mov    %rax,%rdx
+  802cd3:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802cda:	01 00 00 
+  802cdd:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802ce1:	83 e0 01             	and    $0x1,%eax
+  802ce4:	48 85 c0             	test   %rax,%rax
+  802ce7:	74 42                	je     802d2b <fd_lookup+0xbd>
+  802ce9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ced:	48 c1 e8 15          	shr    $0x15,%rax
+  802cf1:	48 89 c2             	mov    %rax,%rdx
+  802cf4:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802cfb:	01 00 00 
+  802cfe:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d02:	83 e0 01             	and    $0x1,%eax
+  802d05:	48 85 c0             	test   %rax,%rax
+  802d08:	74 21                	je     802d2b <fd_lookup+0xbd>
+  802d0a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d0e:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d12:	48 89 c2             	mov    %rax,%rdx
+  802d15:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d1c:	01 00 00 
+  802d1f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d23:	83 e0 01             	and    $0x1,%eax
+  802d26:	48 85 c0             	test   %rax,%rax
+  802d29:	75 07                	jne    802d32 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802d2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d30:	eb 10                	jmp    802d42 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802d32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d36:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802d3a:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d42:	c9                   	leave
+  802d43:	c3                   	ret
+
+0000000000802d44 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802d44:	55                   	push   %rbp
+  802d45:	48 89 e5             	mov    %rsp,%rbp
+  802d48:	48 83 ec 30          	sub    $0x30,%rsp
+  802d4c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802d50:	89 f0                	mov    %esi,%eax
+  802d52:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802d55:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802d59:	48 89 c7             	mov    %rax,%rdi
+  802d5c:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  802d63:	00 00 00 
+  802d66:	ff d0                	call   *%rax
+  802d68:	89 c2                	mov    %eax,%edx
+  802d6a:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802d6e:	48 89 c6             	mov    %rax,%rsi
+  802d71:	89 d7                	mov    %edx,%edi
+  802d73:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  802d7a:	00 00 00 
+  802d7d:	ff d0                	call   *%rax
+  802d7f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d82:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d86:	78 0a                	js     802d92 <fd_close+0x4e>
+  802d88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d8c:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802d90:	74 12                	je     802da4 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802d92:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802d96:	74 05                	je     802d9d <fd_close+0x59>
+  802d98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d9b:	eb 70                	jmp    802e0d <fd_close+0xc9>
+  802d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da2:	eb 69                	jmp    802e0d <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802da4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802da8:	8b 00                	mov    (%rax),%eax
+  802daa:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802dae:	48 89 d6             	mov    %rdx,%rsi
+  802db1:	89 c7                	mov    %eax,%edi
+  802db3:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  802dba:	00 00 00 
+  802dbd:	ff d0                	call   *%rax
+  802dbf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802dc2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802dc6:	78 2a                	js     802df2 <fd_close+0xae>
+    if (dev->dev_close)
+  802dc8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dcc:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802dd0:	48 85 c0             	test   %rax,%rax
+  802dd3:	74 16                	je     802deb <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802dd5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dd9:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802ddd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802de1:	48 89 c7             	mov    %rax,%rdi
+  802de4:	ff d2                	call   *%rdx
+  802de6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802de9:	eb 07                	jmp    802df2 <fd_close+0xae>
+    else
+      r = 0;
+  802deb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802df2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802df6:	48 89 c6             	mov    %rax,%rsi
+  802df9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dfe:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+  return r;
+  802e0a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802e0d:	c9                   	leave
+  802e0e:	c3                   	ret
+
+0000000000802e0f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802e0f:	55                   	push   %rbp
+  802e10:	48 89 e5             	mov    %rsp,%rbp
+  802e13:	48 83 ec 20          	sub    $0x20,%rsp
+  802e17:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e1a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802e1e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802e25:	eb 3f                	jmp    802e66 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802e27:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802e2e:	00 00 00 
+  802e31:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e34:	48 98                	cltq
+  802e36:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e3a:	8b 00                	mov    (%rax),%eax
+  802e3c:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802e3f:	75 21                	jne    802e62 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802e41:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802e48:	00 00 00 
+  802e4b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e4e:	48 98                	cltq
+  802e50:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802e58:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e60:	eb 7f                	jmp    802ee1 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802e62:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802e66:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  802e6d:	00 00 00 
+  802e70:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e73:	48 98                	cltq
+  802e75:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e79:	48 85 c0             	test   %rax,%rax
+  802e7c:	75 a9                	jne    802e27 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802e7e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802e85:	00 00 00 
+  802e88:	8b 40 04             	mov    0x4(%rax),%eax
+  802e8b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802e90:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802e97:	00 00 00 
+  802e9a:	48 98                	cltq
+  802e9c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802ea3:	48 01 d0             	add    %rdx,%rax
+  802ea6:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802eac:	8b 00                	mov    (%rax),%eax
+  802eae:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802eb1:	89 c6                	mov    %eax,%esi
+  802eb3:	48 b8 b8 64 80 00 00 	movabs $0x8064b8,%rax
+  802eba:	00 00 00 
+  802ebd:	48 89 c7             	mov    %rax,%rdi
+  802ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec5:	48 b9 d9 06 80 00 00 	movabs $0x8006d9,%rcx
+  802ecc:	00 00 00 
+  802ecf:	ff d1                	call   *%rcx
+  *dev = 0;
+  802ed1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ed5:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802edc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802ee1:	c9                   	leave
+  802ee2:	c3                   	ret
+
+0000000000802ee3 <close>:
+
+int
+close(int fdnum) {
+  802ee3:	55                   	push   %rbp
+  802ee4:	48 89 e5             	mov    %rsp,%rbp
+  802ee7:	48 83 ec 20          	sub    $0x20,%rsp
+  802eeb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802eee:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802ef2:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802ef5:	48 89 d6             	mov    %rdx,%rsi
+  802ef8:	89 c7                	mov    %eax,%edi
+  802efa:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  802f01:	00 00 00 
+  802f04:	ff d0                	call   *%rax
+  802f06:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f09:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f0d:	79 05                	jns    802f14 <close+0x31>
+    return r;
+  802f0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f12:	eb 18                	jmp    802f2c <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802f14:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f18:	be 01 00 00 00       	mov    $0x1,%esi
+  802f1d:	48 89 c7             	mov    %rax,%rdi
+  802f20:	48 b8 44 2d 80 00 00 	movabs $0x802d44,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+}
+  802f2c:	c9                   	leave
+  802f2d:	c3                   	ret
+
+0000000000802f2e <close_all>:
+
+void
+close_all(void) {
+  802f2e:	55                   	push   %rbp
+  802f2f:	48 89 e5             	mov    %rsp,%rbp
+  802f32:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802f36:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802f3d:	eb 15                	jmp    802f54 <close_all+0x26>
+    close(i);
+  802f3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f42:	89 c7                	mov    %eax,%edi
+  802f44:	48 b8 e3 2e 80 00 00 	movabs $0x802ee3,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802f50:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802f54:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802f58:	7e e5                	jle    802f3f <close_all+0x11>
+}
+  802f5a:	90                   	nop
+  802f5b:	90                   	nop
+  802f5c:	c9                   	leave
+  802f5d:	c3                   	ret
+
+0000000000802f5e <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802f5e:	55                   	push   %rbp
+  802f5f:	48 89 e5             	mov    %rsp,%rbp
+  802f62:	48 83 ec 40          	sub    $0x40,%rsp
+  802f66:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802f69:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802f6c:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802f70:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802f73:	48 89 d6             	mov    %rdx,%rsi
+  802f76:	89 c7                	mov    %eax,%edi
+  802f78:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  802f7f:	00 00 00 
+  802f82:	ff d0                	call   *%rax
+  802f84:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f87:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f8b:	79 08                	jns    802f95 <dup+0x37>
+    return r;
+  802f8d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f90:	e9 33 02 00 00       	jmp    8031c8 <dup+0x26a>
+  close(newfdnum);
+  802f95:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802f98:	89 c7                	mov    %eax,%edi
+  802f9a:	48 b8 e3 2e 80 00 00 	movabs $0x802ee3,%rax
+  802fa1:	00 00 00 
+  802fa4:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802fa6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802fa9:	c1 e0 0c             	shl    $0xc,%eax
+  802fac:	48 98                	cltq
+  802fae:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802fb3:	48 01 d0             	add    %rdx,%rax
+  802fb6:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802fba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802fbe:	48 89 c7             	mov    %rax,%rdi
+  802fc1:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  802fc8:	00 00 00 
+  802fcb:	ff d0                	call   *%rax
+  802fcd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802fd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fd5:	48 89 c7             	mov    %rax,%rdi
+  802fd8:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  802fdf:	00 00 00 
+  802fe2:	ff d0                	call   *%rax
+  802fe4:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802fe8:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802fef:	00 
+  802ff0:	e9 19 01 00 00       	jmp    80310e <dup+0x1b0>
+    off -= PGSIZE;
+  802ff5:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802ffc:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802ffd:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803001:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803005:	48 01 d0             	add    %rdx,%rax
+  803008:	48 c1 e8 27          	shr    $0x27,%rax
+  80300c:	48 89 c2             	mov    %rax,%rdx
+  80300f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  803016:	01 00 00 
+  803019:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80301d:	83 e0 01             	and    $0x1,%eax
+  803020:	48 85 c0             	test   %rax,%rax
+  803023:	0f 84 e5 00 00 00    	je     80310e <dup+0x1b0>
+  803029:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80302d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803031:	48 01 d0             	add    %rdx,%rax
+  803034:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803038:	48 89 c2             	mov    %rax,%rdx
+  80303b:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  803042:	01 00 00 
+  803045:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803049:	83 e0 01             	and    $0x1,%eax
+  80304c:	48 85 c0             	test   %rax,%rax
+  80304f:	0f 84 b9 00 00 00    	je     80310e <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803055:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803059:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80305d:	48 01 d0             	add    %rdx,%rax
+  803060:	48 c1 e8 15          	shr    $0x15,%rax
+  803064:	48 89 c2             	mov    %rax,%rdx
+  803067:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80306e:	01 00 00 
+  803071:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803075:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803078:	48 85 c0             	test   %rax,%rax
+  80307b:	0f 84 8d 00 00 00    	je     80310e <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803081:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803085:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803089:	48 01 d0             	add    %rdx,%rax
+  80308c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803090:	48 89 c2             	mov    %rax,%rdx
+  803093:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80309a:	01 00 00 
+  80309d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030a1:	83 e0 01             	and    $0x1,%eax
+  8030a4:	48 85 c0             	test   %rax,%rax
+  8030a7:	74 65                	je     80310e <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8030a9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8030ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030b1:	48 01 d0             	add    %rdx,%rax
+  8030b4:	48 c1 e8 0c          	shr    $0xc,%rax
+  8030b8:	48 89 c2             	mov    %rax,%rdx
+  8030bb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8030c2:	01 00 00 
+  8030c5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8030c9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8030ce:	89 c6                	mov    %eax,%esi
+  8030d0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8030d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030d8:	48 01 c2             	add    %rax,%rdx
+  8030db:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8030df:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030e3:	48 01 c8             	add    %rcx,%rax
+  8030e6:	41 89 f0             	mov    %esi,%r8d
+  8030e9:	48 89 d1             	mov    %rdx,%rcx
+  8030ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f1:	48 89 c6             	mov    %rax,%rsi
+  8030f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f9:	48 b8 af 24 80 00 00 	movabs $0x8024af,%rax
+  803100:	00 00 00 
+  803103:	ff d0                	call   *%rax
+  803105:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803108:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80310c:	78 60                	js     80316e <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80310e:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  803113:	0f 85 dc fe ff ff    	jne    802ff5 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  803119:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80311d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803121:	48 89 c2             	mov    %rax,%rdx
+  803124:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80312b:	01 00 00 
+  80312e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803132:	25 07 0e 00 00       	and    $0xe07,%eax
+  803137:	89 c1                	mov    %eax,%ecx
+  803139:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80313d:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  803141:	41 89 c8             	mov    %ecx,%r8d
+  803144:	48 89 d1             	mov    %rdx,%rcx
+  803147:	ba 00 00 00 00       	mov    $0x0,%edx
+  80314c:	48 89 c6             	mov    %rax,%rsi
+  80314f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803154:	48 b8 af 24 80 00 00 	movabs $0x8024af,%rax
+  80315b:	00 00 00 
+  80315e:	ff d0                	call   *%rax
+  803160:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803163:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803167:	78 08                	js     803171 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  803169:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80316c:	eb 5a                	jmp    8031c8 <dup+0x26a>
+        goto err;
+  80316e:	90                   	nop
+  80316f:	eb 01                	jmp    803172 <dup+0x214>
+    goto err;
+  803171:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803172:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803176:	48 89 c6             	mov    %rax,%rsi
+  803179:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317e:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  803185:	00 00 00 
+  803188:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80318a:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803191:	00 
+  803192:	eb 27                	jmp    8031bb <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803194:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803198:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80319c:	48 01 d0             	add    %rdx,%rax
+  80319f:	48 89 c6             	mov    %rax,%rsi
+  8031a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031a7:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  8031ae:	00 00 00 
+  8031b1:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8031b3:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8031ba:	00 
+  8031bb:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  8031c2:	00 
+  8031c3:	76 cf                	jbe    803194 <dup+0x236>
+  return r;
+  8031c5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8031c8:	c9                   	leave
+  8031c9:	c3                   	ret
+
+00000000008031ca <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8031ca:	55                   	push   %rbp
+  8031cb:	48 89 e5             	mov    %rsp,%rbp
+  8031ce:	48 83 ec 40          	sub    $0x40,%rsp
+  8031d2:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031d5:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8031d9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8031dd:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8031e1:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031e4:	48 89 d6             	mov    %rdx,%rsi
+  8031e7:	89 c7                	mov    %eax,%edi
+  8031e9:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  8031f0:	00 00 00 
+  8031f3:	ff d0                	call   *%rax
+  8031f5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031f8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031fc:	78 24                	js     803222 <read+0x58>
+  8031fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803202:	8b 00                	mov    (%rax),%eax
+  803204:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803208:	48 89 d6             	mov    %rdx,%rsi
+  80320b:	89 c7                	mov    %eax,%edi
+  80320d:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  803214:	00 00 00 
+  803217:	ff d0                	call   *%rax
+  803219:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80321c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803220:	79 0a                	jns    80322c <read+0x62>
+    return r;
+  803222:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803225:	48 98                	cltq
+  803227:	e9 9e 00 00 00       	jmp    8032ca <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80322c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803230:	8b 40 08             	mov    0x8(%rax),%eax
+  803233:	83 e0 03             	and    $0x3,%eax
+  803236:	83 f8 01             	cmp    $0x1,%eax
+  803239:	75 5c                	jne    803297 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80323b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803242:	00 00 00 
+  803245:	8b 40 04             	mov    0x4(%rax),%eax
+  803248:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80324d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803254:	00 00 00 
+  803257:	48 98                	cltq
+  803259:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803260:	48 01 d0             	add    %rdx,%rax
+  803263:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803269:	8b 00                	mov    (%rax),%eax
+  80326b:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80326e:	89 c6                	mov    %eax,%esi
+  803270:	48 b8 d7 64 80 00 00 	movabs $0x8064d7,%rax
+  803277:	00 00 00 
+  80327a:	48 89 c7             	mov    %rax,%rdi
+  80327d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803282:	48 b9 d9 06 80 00 00 	movabs $0x8006d9,%rcx
+  803289:	00 00 00 
+  80328c:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80328e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803295:	eb 33                	jmp    8032ca <read+0x100>
+  }
+  if (!dev->dev_read)
+  803297:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80329b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80329f:	48 85 c0             	test   %rax,%rax
+  8032a2:	75 09                	jne    8032ad <read+0xe3>
+    return -E_NOT_SUPP;
+  8032a4:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8032ab:	eb 1d                	jmp    8032ca <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  8032ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032b1:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  8032b5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8032b9:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8032bd:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8032c1:	48 89 ce             	mov    %rcx,%rsi
+  8032c4:	48 89 c7             	mov    %rax,%rdi
+  8032c7:	41 ff d0             	call   *%r8
+}
+  8032ca:	c9                   	leave
+  8032cb:	c3                   	ret
+
+00000000008032cc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8032cc:	55                   	push   %rbp
+  8032cd:	48 89 e5             	mov    %rsp,%rbp
+  8032d0:	48 83 ec 30          	sub    $0x30,%rsp
+  8032d4:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8032d7:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8032db:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8032df:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8032e6:	eb 49                	jmp    803331 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  8032e8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032eb:	48 98                	cltq
+  8032ed:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8032f1:	48 29 c2             	sub    %rax,%rdx
+  8032f4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8032f7:	48 63 c8             	movslq %eax,%rcx
+  8032fa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8032fe:	48 01 c1             	add    %rax,%rcx
+  803301:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803304:	48 89 ce             	mov    %rcx,%rsi
+  803307:	89 c7                	mov    %eax,%edi
+  803309:	48 b8 ca 31 80 00 00 	movabs $0x8031ca,%rax
+  803310:	00 00 00 
+  803313:	ff d0                	call   *%rax
+  803315:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  803318:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  80331c:	79 07                	jns    803325 <readn+0x59>
+      return m;
+  80331e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  803321:	48 98                	cltq
+  803323:	eb 1f                	jmp    803344 <readn+0x78>
+    if (m == 0)
+  803325:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  803329:	74 13                	je     80333e <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  80332b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80332e:	01 45 fc             	add    %eax,-0x4(%rbp)
+  803331:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803334:	48 98                	cltq
+  803336:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80333a:	72 ac                	jb     8032e8 <readn+0x1c>
+  80333c:	eb 01                	jmp    80333f <readn+0x73>
+      break;
+  80333e:	90                   	nop
+  }
+  return tot;
+  80333f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803342:	48 98                	cltq
+}
+  803344:	c9                   	leave
+  803345:	c3                   	ret
+
+0000000000803346 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  803346:	55                   	push   %rbp
+  803347:	48 89 e5             	mov    %rsp,%rbp
+  80334a:	48 83 ec 40          	sub    $0x40,%rsp
+  80334e:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803351:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  803355:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  803359:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80335d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803360:	48 89 d6             	mov    %rdx,%rsi
+  803363:	89 c7                	mov    %eax,%edi
+  803365:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  80336c:	00 00 00 
+  80336f:	ff d0                	call   *%rax
+  803371:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803374:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803378:	78 24                	js     80339e <write+0x58>
+  80337a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80337e:	8b 00                	mov    (%rax),%eax
+  803380:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803384:	48 89 d6             	mov    %rdx,%rsi
+  803387:	89 c7                	mov    %eax,%edi
+  803389:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  803390:	00 00 00 
+  803393:	ff d0                	call   *%rax
+  803395:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803398:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80339c:	79 0a                	jns    8033a8 <write+0x62>
+    return r;
+  80339e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033a1:	48 98                	cltq
+  8033a3:	e9 9d 00 00 00       	jmp    803445 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8033a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033ac:	8b 40 08             	mov    0x8(%rax),%eax
+  8033af:	83 e0 03             	and    $0x3,%eax
+  8033b2:	85 c0                	test   %eax,%eax
+  8033b4:	75 5c                	jne    803412 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8033b6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033bd:	00 00 00 
+  8033c0:	8b 40 04             	mov    0x4(%rax),%eax
+  8033c3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033c8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8033cf:	00 00 00 
+  8033d2:	48 98                	cltq
+  8033d4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033db:	48 01 d0             	add    %rdx,%rax
+  8033de:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8033e4:	8b 00                	mov    (%rax),%eax
+  8033e6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8033e9:	89 c6                	mov    %eax,%esi
+  8033eb:	48 b8 f3 64 80 00 00 	movabs $0x8064f3,%rax
+  8033f2:	00 00 00 
+  8033f5:	48 89 c7             	mov    %rax,%rdi
+  8033f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fd:	48 b9 d9 06 80 00 00 	movabs $0x8006d9,%rcx
+  803404:	00 00 00 
+  803407:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803409:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803410:	eb 33                	jmp    803445 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  803412:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803416:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80341a:	48 85 c0             	test   %rax,%rax
+  80341d:	75 09                	jne    803428 <write+0xe2>
+    return -E_NOT_SUPP;
+  80341f:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  803426:	eb 1d                	jmp    803445 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803428:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80342c:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803430:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803434:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803438:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  80343c:	48 89 ce             	mov    %rcx,%rsi
+  80343f:	48 89 c7             	mov    %rax,%rdi
+  803442:	41 ff d0             	call   *%r8
+}
+  803445:	c9                   	leave
+  803446:	c3                   	ret
+
+0000000000803447 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803447:	55                   	push   %rbp
+  803448:	48 89 e5             	mov    %rsp,%rbp
+  80344b:	48 83 ec 18          	sub    $0x18,%rsp
+  80344f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803452:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803455:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803459:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80345c:	48 89 d6             	mov    %rdx,%rsi
+  80345f:	89 c7                	mov    %eax,%edi
+  803461:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  803468:	00 00 00 
+  80346b:	ff d0                	call   *%rax
+  80346d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803470:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803474:	79 05                	jns    80347b <seek+0x34>
+    return r;
+  803476:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803479:	eb 0f                	jmp    80348a <seek+0x43>
+  fd->fd_offset = offset;
+  80347b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80347f:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803482:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803485:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80348a:	c9                   	leave
+  80348b:	c3                   	ret
+
+000000000080348c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80348c:	55                   	push   %rbp
+  80348d:	48 89 e5             	mov    %rsp,%rbp
+  803490:	48 83 ec 30          	sub    $0x30,%rsp
+  803494:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803497:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80349a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80349e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034a1:	48 89 d6             	mov    %rdx,%rsi
+  8034a4:	89 c7                	mov    %eax,%edi
+  8034a6:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  8034ad:	00 00 00 
+  8034b0:	ff d0                	call   *%rax
+  8034b2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034b5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034b9:	78 24                	js     8034df <ftruncate+0x53>
+  8034bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034bf:	8b 00                	mov    (%rax),%eax
+  8034c1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8034c5:	48 89 d6             	mov    %rdx,%rsi
+  8034c8:	89 c7                	mov    %eax,%edi
+  8034ca:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  8034d1:	00 00 00 
+  8034d4:	ff d0                	call   *%rax
+  8034d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8034d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8034dd:	79 08                	jns    8034e7 <ftruncate+0x5b>
+    return r;
+  8034df:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034e2:	e9 92 00 00 00       	jmp    803579 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8034e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034eb:	8b 40 08             	mov    0x8(%rax),%eax
+  8034ee:	83 e0 03             	and    $0x3,%eax
+  8034f1:	85 c0                	test   %eax,%eax
+  8034f3:	75 5a                	jne    80354f <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  8034f5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8034fc:	00 00 00 
+  8034ff:	8b 40 04             	mov    0x4(%rax),%eax
+  803502:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803507:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80350e:	00 00 00 
+  803511:	48 98                	cltq
+  803513:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80351a:	48 01 d0             	add    %rdx,%rax
+  80351d:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803523:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  803525:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803528:	89 c6                	mov    %eax,%esi
+  80352a:	48 b8 10 65 80 00 00 	movabs $0x806510,%rax
+  803531:	00 00 00 
+  803534:	48 89 c7             	mov    %rax,%rdi
+  803537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80353c:	48 b9 d9 06 80 00 00 	movabs $0x8006d9,%rcx
+  803543:	00 00 00 
+  803546:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803548:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80354d:	eb 2a                	jmp    803579 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  80354f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803553:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803557:	48 85 c0             	test   %rax,%rax
+  80355a:	75 07                	jne    803563 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  80355c:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803561:	eb 16                	jmp    803579 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  803563:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803567:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  80356b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80356f:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803572:	89 d6                	mov    %edx,%esi
+  803574:	48 89 c7             	mov    %rax,%rdi
+  803577:	ff d1                	call   *%rcx
+}
+  803579:	c9                   	leave
+  80357a:	c3                   	ret
+
+000000000080357b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80357b:	55                   	push   %rbp
+  80357c:	48 89 e5             	mov    %rsp,%rbp
+  80357f:	48 83 ec 30          	sub    $0x30,%rsp
+  803583:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803586:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80358a:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80358e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803591:	48 89 d6             	mov    %rdx,%rsi
+  803594:	89 c7                	mov    %eax,%edi
+  803596:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  80359d:	00 00 00 
+  8035a0:	ff d0                	call   *%rax
+  8035a2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035a5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035a9:	78 24                	js     8035cf <fstat+0x54>
+  8035ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035af:	8b 00                	mov    (%rax),%eax
+  8035b1:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8035b5:	48 89 d6             	mov    %rdx,%rsi
+  8035b8:	89 c7                	mov    %eax,%edi
+  8035ba:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  8035c1:	00 00 00 
+  8035c4:	ff d0                	call   *%rax
+  8035c6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8035c9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8035cd:	79 05                	jns    8035d4 <fstat+0x59>
+    return r;
+  8035cf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8035d2:	eb 5e                	jmp    803632 <fstat+0xb7>
+  if (!dev->dev_stat)
+  8035d4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035d8:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8035dc:	48 85 c0             	test   %rax,%rax
+  8035df:	75 07                	jne    8035e8 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  8035e1:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8035e6:	eb 4a                	jmp    803632 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  8035e8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035ec:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  8035ef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8035f3:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  8035fa:	00 00 00 
+  stat->st_isdir   = 0;
+  8035fd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803601:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803608:	00 00 00 
+  stat->st_dev     = dev;
+  80360b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80360f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803613:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  80361a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80361e:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  803622:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803626:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80362a:	48 89 d6             	mov    %rdx,%rsi
+  80362d:	48 89 c7             	mov    %rax,%rdi
+  803630:	ff d1                	call   *%rcx
+}
+  803632:	c9                   	leave
+  803633:	c3                   	ret
+
+0000000000803634 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  803634:	55                   	push   %rbp
+  803635:	48 89 e5             	mov    %rsp,%rbp
+  803638:	48 83 ec 10          	sub    $0x10,%rsp
+  80363c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803640:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  803644:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803648:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  80364e:	83 f8 20             	cmp    $0x20,%eax
+  803651:	75 07                	jne    80365a <pollwait_key+0x26>
+    return -E_INVAL;
+  803653:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803658:	eb 5f                	jmp    8036b9 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  80365a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80365e:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  803664:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803668:	48 63 d2             	movslq %edx,%rdx
+  80366b:	48 c1 e2 04          	shl    $0x4,%rdx
+  80366f:	48 01 c2             	add    %rax,%rdx
+  803672:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803676:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  803679:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80367d:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803683:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803687:	8b 00                	mov    (%rax),%eax
+  803689:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80368d:	48 63 c9             	movslq %ecx,%rcx
+  803690:	48 c1 e1 04          	shl    $0x4,%rcx
+  803694:	48 01 ca             	add    %rcx,%rdx
+  803697:	48 83 c2 08          	add    $0x8,%rdx
+  80369b:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  80369d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036a1:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8036a7:	8d 50 01             	lea    0x1(%rax),%edx
+  8036aa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036ae:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8036b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036b9:	c9                   	leave
+  8036ba:	c3                   	ret
+
+00000000008036bb <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8036bb:	55                   	push   %rbp
+  8036bc:	48 89 e5             	mov    %rsp,%rbp
+  8036bf:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8036c6:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8036cd:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8036d3:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  8036da:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8036e1:	00 
+  int i, r, ready, ipc = 0;
+  8036e2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  8036e9:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  8036f0:	00 
+  8036f1:	74 45                	je     803738 <poll+0x7d>
+  8036f3:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  8036fa:	ff 
+  8036fb:	74 3b                	je     803738 <poll+0x7d>
+    now      = vsys_clock_ns();
+  8036fd:	48 b8 05 57 80 00 00 	movabs $0x805705,%rax
+  803704:	00 00 00 
+  803707:	ff d0                	call   *%rax
+  803709:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80370d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803711:	48 f7 d0             	not    %rax
+  803714:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  80371b:	73 10                	jae    80372d <poll+0x72>
+  80371d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803721:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803728:	48 01 d0             	add    %rdx,%rax
+  80372b:	eb 07                	jmp    803734 <poll+0x79>
+  80372d:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  803734:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803738:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  80373f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  803746:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80374d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  803754:	e9 46 02 00 00       	jmp    80399f <poll+0x2e4>
+      fds[i].revents = 0;
+  803759:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80375c:	48 63 d0             	movslq %eax,%rdx
+  80375f:	48 89 d0             	mov    %rdx,%rax
+  803762:	48 01 c0             	add    %rax,%rax
+  803765:	48 01 d0             	add    %rdx,%rax
+  803768:	48 c1 e0 02          	shl    $0x2,%rax
+  80376c:	48 89 c2             	mov    %rax,%rdx
+  80376f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803776:	48 01 d0             	add    %rdx,%rax
+  803779:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803780:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803783:	48 63 d0             	movslq %eax,%rdx
+  803786:	48 89 d0             	mov    %rdx,%rax
+  803789:	48 01 c0             	add    %rax,%rax
+  80378c:	48 01 d0             	add    %rdx,%rax
+  80378f:	48 c1 e0 02          	shl    $0x2,%rax
+  803793:	48 89 c2             	mov    %rax,%rdx
+  803796:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80379d:	48 01 d0             	add    %rdx,%rax
+  8037a0:	8b 00                	mov    (%rax),%eax
+  8037a2:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8037a5:	75 62                	jne    803809 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8037a7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037aa:	48 63 d0             	movslq %eax,%rdx
+  8037ad:	48 89 d0             	mov    %rdx,%rax
+  8037b0:	48 01 c0             	add    %rax,%rax
+  8037b3:	48 01 d0             	add    %rdx,%rax
+  8037b6:	48 c1 e0 02          	shl    $0x2,%rax
+  8037ba:	48 89 c2             	mov    %rax,%rdx
+  8037bd:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037c4:	48 01 d0             	add    %rdx,%rax
+  8037c7:	8b 40 04             	mov    0x4(%rax),%eax
+  8037ca:	83 e0 01             	and    $0x1,%eax
+  8037cd:	85 c0                	test   %eax,%eax
+  8037cf:	0f 84 9b 01 00 00    	je     803970 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8037d5:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8037d8:	48 63 d0             	movslq %eax,%rdx
+  8037db:	48 89 d0             	mov    %rdx,%rax
+  8037de:	48 01 c0             	add    %rax,%rax
+  8037e1:	48 01 d0             	add    %rdx,%rax
+  8037e4:	48 c1 e0 02          	shl    $0x2,%rax
+  8037e8:	48 89 c2             	mov    %rax,%rdx
+  8037eb:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8037f2:	48 01 c2             	add    %rax,%rdx
+  8037f5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8037f8:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  8037fb:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8037fe:	83 c8 04             	or     $0x4,%eax
+  803801:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803804:	e9 67 01 00 00       	jmp    803970 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803809:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80380c:	48 63 d0             	movslq %eax,%rdx
+  80380f:	48 89 d0             	mov    %rdx,%rax
+  803812:	48 01 c0             	add    %rax,%rax
+  803815:	48 01 d0             	add    %rdx,%rax
+  803818:	48 c1 e0 02          	shl    $0x2,%rax
+  80381c:	48 89 c2             	mov    %rax,%rdx
+  80381f:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803826:	48 01 d0             	add    %rdx,%rax
+  803829:	8b 00                	mov    (%rax),%eax
+  80382b:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  803832:	48 89 d6             	mov    %rdx,%rsi
+  803835:	89 c7                	mov    %eax,%edi
+  803837:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  80383e:	00 00 00 
+  803841:	ff d0                	call   *%rax
+  803843:	85 c0                	test   %eax,%eax
+  803845:	78 25                	js     80386c <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803847:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  80384e:	8b 00                	mov    (%rax),%eax
+  803850:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803857:	48 89 d6             	mov    %rdx,%rsi
+  80385a:	89 c7                	mov    %eax,%edi
+  80385c:	48 b8 0f 2e 80 00 00 	movabs $0x802e0f,%rax
+  803863:	00 00 00 
+  803866:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803868:	85 c0                	test   %eax,%eax
+  80386a:	79 2c                	jns    803898 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  80386c:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80386f:	48 63 d0             	movslq %eax,%rdx
+  803872:	48 89 d0             	mov    %rdx,%rax
+  803875:	48 01 c0             	add    %rax,%rax
+  803878:	48 01 d0             	add    %rdx,%rax
+  80387b:	48 c1 e0 02          	shl    $0x2,%rax
+  80387f:	48 89 c2             	mov    %rax,%rdx
+  803882:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803889:	48 01 d0             	add    %rdx,%rax
+  80388c:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803893:	e9 d8 00 00 00       	jmp    803970 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803898:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  80389f:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8038a3:	48 85 c0             	test   %rax,%rax
+  8038a6:	74 7d                	je     803925 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8038a8:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8038af:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8038b3:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038b6:	48 63 d0             	movslq %eax,%rdx
+  8038b9:	48 89 d0             	mov    %rdx,%rax
+  8038bc:	48 01 c0             	add    %rax,%rax
+  8038bf:	48 01 d0             	add    %rdx,%rax
+  8038c2:	48 c1 e0 02          	shl    $0x2,%rax
+  8038c6:	48 89 c2             	mov    %rax,%rdx
+  8038c9:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8038d0:	48 01 d0             	add    %rdx,%rax
+  8038d3:	8b 48 04             	mov    0x4(%rax),%ecx
+  8038d6:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8038dd:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  8038e4:	89 ce                	mov    %ecx,%esi
+  8038e6:	48 89 c7             	mov    %rax,%rdi
+  8038e9:	41 ff d0             	call   *%r8
+  8038ec:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8038ef:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8038f3:	79 08                	jns    8038fd <poll+0x242>
+          return r;
+  8038f5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8038f8:	e9 45 01 00 00       	jmp    803a42 <poll+0x387>
+        fds[i].revents = r;
+  8038fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803900:	48 63 d0             	movslq %eax,%rdx
+  803903:	48 89 d0             	mov    %rdx,%rax
+  803906:	48 01 c0             	add    %rax,%rax
+  803909:	48 01 d0             	add    %rdx,%rax
+  80390c:	48 c1 e0 02          	shl    $0x2,%rax
+  803910:	48 89 c2             	mov    %rax,%rdx
+  803913:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80391a:	48 01 c2             	add    %rax,%rdx
+  80391d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803920:	89 42 08             	mov    %eax,0x8(%rdx)
+  803923:	eb 4b                	jmp    803970 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803925:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803928:	48 63 d0             	movslq %eax,%rdx
+  80392b:	48 89 d0             	mov    %rdx,%rax
+  80392e:	48 01 c0             	add    %rax,%rax
+  803931:	48 01 d0             	add    %rdx,%rax
+  803934:	48 c1 e0 02          	shl    $0x2,%rax
+  803938:	48 89 c2             	mov    %rax,%rdx
+  80393b:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803942:	48 01 d0             	add    %rdx,%rax
+  803945:	8b 48 04             	mov    0x4(%rax),%ecx
+  803948:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80394b:	48 63 d0             	movslq %eax,%rdx
+  80394e:	48 89 d0             	mov    %rdx,%rax
+  803951:	48 01 c0             	add    %rax,%rax
+  803954:	48 01 d0             	add    %rdx,%rax
+  803957:	48 c1 e0 02          	shl    $0x2,%rax
+  80395b:	48 89 c2             	mov    %rax,%rdx
+  80395e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803965:	48 01 d0             	add    %rdx,%rax
+  803968:	83 e1 03             	and    $0x3,%ecx
+  80396b:	89 ca                	mov    %ecx,%edx
+  80396d:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803970:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803973:	48 63 d0             	movslq %eax,%rdx
+  803976:	48 89 d0             	mov    %rdx,%rax
+  803979:	48 01 c0             	add    %rax,%rax
+  80397c:	48 01 d0             	add    %rdx,%rax
+  80397f:	48 c1 e0 02          	shl    $0x2,%rax
+  803983:	48 89 c2             	mov    %rax,%rdx
+  803986:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80398d:	48 01 d0             	add    %rdx,%rax
+  803990:	8b 40 08             	mov    0x8(%rax),%eax
+  803993:	85 c0                	test   %eax,%eax
+  803995:	74 04                	je     80399b <poll+0x2e0>
+        ready++;
+  803997:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  80399b:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  80399f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8039a2:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8039a8:	0f 8c ab fd ff ff    	jl     803759 <poll+0x9e>
+    }
+    if (ready)
+  8039ae:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8039b2:	74 08                	je     8039bc <poll+0x301>
+      return ready;
+  8039b4:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8039b7:	e9 86 00 00 00       	jmp    803a42 <poll+0x387>
+
+    if (deadline) {
+  8039bc:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8039c1:	74 30                	je     8039f3 <poll+0x338>
+      now     = vsys_clock_ns();
+  8039c3:	48 b8 05 57 80 00 00 	movabs $0x805705,%rax
+  8039ca:	00 00 00 
+  8039cd:	ff d0                	call   *%rax
+  8039cf:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8039d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039d7:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  8039db:	73 0a                	jae    8039e7 <poll+0x32c>
+  8039dd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8039e1:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  8039e5:	eb 05                	jmp    8039ec <poll+0x331>
+  8039e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039ec:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  8039f3:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8039f6:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  8039f9:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803a00:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803a07:	48 89 c7             	mov    %rax,%rdi
+  803a0a:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  803a11:	00 00 00 
+  803a14:	ff d0                	call   *%rax
+  803a16:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803a19:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803a1d:	75 07                	jne    803a26 <poll+0x36b>
+      return 0;
+  803a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a24:	eb 1c                	jmp    803a42 <poll+0x387>
+    if (r < 0)
+  803a26:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a2a:	79 05                	jns    803a31 <poll+0x376>
+      return r;
+  803a2c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a2f:	eb 11                	jmp    803a42 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803a31:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a34:	c1 f8 02             	sar    $0x2,%eax
+  803a37:	83 e0 01             	and    $0x1,%eax
+  803a3a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803a3d:	e9 f6 fc ff ff       	jmp    803738 <poll+0x7d>
+  }
+}
+  803a42:	c9                   	leave
+  803a43:	c3                   	ret
+
+0000000000803a44 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803a44:	55                   	push   %rbp
+  803a45:	48 89 e5             	mov    %rsp,%rbp
+  803a48:	48 83 ec 20          	sub    $0x20,%rsp
+  803a4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a50:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803a54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a58:	be 00 00 00 00       	mov    $0x0,%esi
+  803a5d:	48 89 c7             	mov    %rax,%rdi
+  803a60:	48 b8 32 3b 80 00 00 	movabs $0x803b32,%rax
+  803a67:	00 00 00 
+  803a6a:	ff d0                	call   *%rax
+  803a6c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a6f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a73:	79 05                	jns    803a7a <stat+0x36>
+    return fd;
+  803a75:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a78:	eb 2f                	jmp    803aa9 <stat+0x65>
+  r = fstat(fd, stat);
+  803a7a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803a7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a81:	48 89 d6             	mov    %rdx,%rsi
+  803a84:	89 c7                	mov    %eax,%edi
+  803a86:	48 b8 7b 35 80 00 00 	movabs $0x80357b,%rax
+  803a8d:	00 00 00 
+  803a90:	ff d0                	call   *%rax
+  803a92:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803a95:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a98:	89 c7                	mov    %eax,%edi
+  803a9a:	48 b8 e3 2e 80 00 00 	movabs $0x802ee3,%rax
+  803aa1:	00 00 00 
+  803aa4:	ff d0                	call   *%rax
+  return r;
+  803aa6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803aa9:	c9                   	leave
+  803aaa:	c3                   	ret
+
+0000000000803aab <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803aab:	55                   	push   %rbp
+  803aac:	48 89 e5             	mov    %rsp,%rbp
+  803aaf:	48 83 ec 10          	sub    $0x10,%rsp
+  803ab3:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803ab6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803aba:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  803ac1:	00 00 00 
+  803ac4:	8b 00                	mov    (%rax),%eax
+  803ac6:	85 c0                	test   %eax,%eax
+  803ac8:	75 1d                	jne    803ae7 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803aca:	bf 03 00 00 00       	mov    $0x3,%edi
+  803acf:	48 b8 20 5d 80 00 00 	movabs $0x805d20,%rax
+  803ad6:	00 00 00 
+  803ad9:	ff d0                	call   *%rax
+  803adb:	48 ba 00 a0 80 00 00 	movabs $0x80a000,%rdx
+  803ae2:	00 00 00 
+  803ae5:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803ae7:	48 b8 00 a0 80 00 00 	movabs $0x80a000,%rax
+  803aee:	00 00 00 
+  803af1:	8b 00                	mov    (%rax),%eax
+  803af3:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803af6:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803afb:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803b02:	00 00 00 
+  803b05:	89 c7                	mov    %eax,%edi
+  803b07:	48 b8 73 5c 80 00 00 	movabs $0x805c73,%rax
+  803b0e:	00 00 00 
+  803b11:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803b13:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803b17:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b1c:	48 89 c6             	mov    %rax,%rsi
+  803b1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b24:	48 b8 f6 5a 80 00 00 	movabs $0x805af6,%rax
+  803b2b:	00 00 00 
+  803b2e:	ff d0                	call   *%rax
+}
+  803b30:	c9                   	leave
+  803b31:	c3                   	ret
+
+0000000000803b32 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803b32:	55                   	push   %rbp
+  803b33:	48 89 e5             	mov    %rsp,%rbp
+  803b36:	48 83 ec 20          	sub    $0x20,%rsp
+  803b3a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803b3e:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803b41:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b45:	48 89 c7             	mov    %rax,%rdi
+  803b48:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  803b4f:	00 00 00 
+  803b52:	ff d0                	call   *%rax
+  803b54:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803b59:	7e 0a                	jle    803b65 <open+0x33>
+    return -E_BAD_PATH;
+  803b5b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803b60:	e9 a8 00 00 00       	jmp    803c0d <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803b65:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803b69:	48 89 c7             	mov    %rax,%rdi
+  803b6c:	48 b8 8c 2b 80 00 00 	movabs $0x802b8c,%rax
+  803b73:	00 00 00 
+  803b76:	ff d0                	call   *%rax
+  803b78:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803b7b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803b7f:	79 08                	jns    803b89 <open+0x57>
+    return r;
+  803b81:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803b84:	e9 84 00 00 00       	jmp    803c0d <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803b89:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803b8d:	48 89 c6             	mov    %rax,%rsi
+  803b90:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803b97:	00 00 00 
+  803b9a:	48 89 c7             	mov    %rax,%rdi
+  803b9d:	48 b8 89 16 80 00 00 	movabs $0x801689,%rax
+  803ba4:	00 00 00 
+  803ba7:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803ba9:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803bb0:	00 00 00 
+  803bb3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803bb6:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803bbc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bc0:	48 89 c6             	mov    %rax,%rsi
+  803bc3:	bf 01 00 00 00       	mov    $0x1,%edi
+  803bc8:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803bcf:	00 00 00 
+  803bd2:	ff d0                	call   *%rax
+  803bd4:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bd7:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bdb:	79 1d                	jns    803bfa <open+0xc8>
+    fd_close(fd, 0);
+  803bdd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803be1:	be 00 00 00 00       	mov    $0x0,%esi
+  803be6:	48 89 c7             	mov    %rax,%rdi
+  803be9:	48 b8 44 2d 80 00 00 	movabs $0x802d44,%rax
+  803bf0:	00 00 00 
+  803bf3:	ff d0                	call   *%rax
+    return r;
+  803bf5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bf8:	eb 13                	jmp    803c0d <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803bfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803bfe:	48 89 c7             	mov    %rax,%rdi
+  803c01:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  803c08:	00 00 00 
+  803c0b:	ff d0                	call   *%rax
+}
+  803c0d:	c9                   	leave
+  803c0e:	c3                   	ret
+
+0000000000803c0f <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803c0f:	55                   	push   %rbp
+  803c10:	48 89 e5             	mov    %rsp,%rbp
+  803c13:	48 83 ec 10          	sub    $0x10,%rsp
+  803c17:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803c1b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803c1f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c22:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803c29:	00 00 00 
+  803c2c:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803c2e:	be 00 00 00 00       	mov    $0x0,%esi
+  803c33:	bf 06 00 00 00       	mov    $0x6,%edi
+  803c38:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803c3f:	00 00 00 
+  803c42:	ff d0                	call   *%rax
+}
+  803c44:	c9                   	leave
+  803c45:	c3                   	ret
+
+0000000000803c46 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c46:	55                   	push   %rbp
+  803c47:	48 89 e5             	mov    %rsp,%rbp
+  803c4a:	48 83 ec 30          	sub    $0x30,%rsp
+  803c4e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803c52:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803c56:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803c5a:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803c5f:	74 07                	je     803c68 <devfile_read+0x22>
+  803c61:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803c66:	75 0a                	jne    803c72 <devfile_read+0x2c>
+  return E_INVAL;
+  803c68:	b8 03 00 00 00       	mov    $0x3,%eax
+  803c6d:	e9 b4 00 00 00       	jmp    803d26 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803c72:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803c79:	00 
+  while (n) {
+  803c7a:	e9 98 00 00 00       	jmp    803d17 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803c7f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c83:	8b 40 0c             	mov    0xc(%rax),%eax
+  803c86:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803c8d:	00 00 00 
+  803c90:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803c92:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803c99:	00 00 00 
+  803c9c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803ca0:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803ca4:	be 00 00 00 00       	mov    $0x0,%esi
+  803ca9:	bf 03 00 00 00       	mov    $0x3,%edi
+  803cae:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803cb5:	00 00 00 
+  803cb8:	ff d0                	call   *%rax
+  803cba:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803cbd:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803cc1:	7f 13                	jg     803cd6 <devfile_read+0x90>
+      return res ? res : res0;
+  803cc3:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803cc7:	74 07                	je     803cd0 <devfile_read+0x8a>
+  803cc9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ccc:	48 98                	cltq
+  803cce:	eb 56                	jmp    803d26 <devfile_read+0xe0>
+  803cd0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803cd4:	eb 50                	jmp    803d26 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803cd6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cd9:	48 63 d0             	movslq %eax,%rdx
+  803cdc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ce0:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  803ce7:	00 00 00 
+  803cea:	48 89 ce             	mov    %rcx,%rsi
+  803ced:	48 89 c7             	mov    %rax,%rdi
+  803cf0:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  803cf7:	00 00 00 
+  803cfa:	ff d0                	call   *%rax
+
+    buf += res;
+  803cfc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803cff:	48 98                	cltq
+  803d01:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803d05:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d08:	48 98                	cltq
+  803d0a:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803d0e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803d11:	48 98                	cltq
+  803d13:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803d17:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803d1c:	0f 85 5d ff ff ff    	jne    803c7f <devfile_read+0x39>
+  }
+
+  return res0;
+  803d22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803d26:	c9                   	leave
+  803d27:	c3                   	ret
+
+0000000000803d28 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803d28:	55                   	push   %rbp
+  803d29:	48 89 e5             	mov    %rsp,%rbp
+  803d2c:	48 83 ec 50          	sub    $0x50,%rsp
+  803d30:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803d34:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803d38:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803d3c:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803d41:	74 07                	je     803d4a <devfile_write+0x22>
+  803d43:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803d48:	75 0a                	jne    803d54 <devfile_write+0x2c>
+  return E_INVAL;
+  803d4a:	b8 03 00 00 00       	mov    $0x3,%eax
+  803d4f:	e9 c9 00 00 00       	jmp    803e1d <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803d54:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803d5b:	00 
+
+  while (n) {
+  803d5c:	e9 ad 00 00 00       	jmp    803e0e <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803d61:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803d65:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d69:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803d70:	00 
+  803d71:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803d75:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d79:	48 39 c2             	cmp    %rax,%rdx
+  803d7c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803d80:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803d84:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803d88:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d8c:	48 89 c6             	mov    %rax,%rsi
+  803d8f:	48 b8 10 90 80 00 00 	movabs $0x809010,%rax
+  803d96:	00 00 00 
+  803d99:	48 89 c7             	mov    %rax,%rdi
+  803d9c:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  803da3:	00 00 00 
+  803da6:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803da8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803dac:	8b 40 0c             	mov    0xc(%rax),%eax
+  803daf:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803db6:	00 00 00 
+  803db9:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803dbb:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803dc2:	00 00 00 
+  803dc5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803dc9:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803dcd:	be 00 00 00 00       	mov    $0x0,%esi
+  803dd2:	bf 04 00 00 00       	mov    $0x4,%edi
+  803dd7:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803dde:	00 00 00 
+  803de1:	ff d0                	call   *%rax
+  803de3:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803de6:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803dea:	79 07                	jns    803df3 <devfile_write+0xcb>
+      return res;
+  803dec:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803def:	48 98                	cltq
+  803df1:	eb 2a                	jmp    803e1d <devfile_write+0xf5>
+
+    buf += res;
+  803df3:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803df6:	48 98                	cltq
+  803df8:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803dfc:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803dff:	48 98                	cltq
+  803e01:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803e05:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803e08:	48 98                	cltq
+  803e0a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803e0e:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803e13:	0f 85 48 ff ff ff    	jne    803d61 <devfile_write+0x39>
+  }
+
+  return res0;
+  803e19:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803e1d:	c9                   	leave
+  803e1e:	c3                   	ret
+
+0000000000803e1f <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803e1f:	55                   	push   %rbp
+  803e20:	48 89 e5             	mov    %rsp,%rbp
+  803e23:	48 83 ec 20          	sub    $0x20,%rsp
+  803e27:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803e2b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803e2f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e33:	8b 40 0c             	mov    0xc(%rax),%eax
+  803e36:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803e3d:	00 00 00 
+  803e40:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803e42:	be 00 00 00 00       	mov    $0x0,%esi
+  803e47:	bf 05 00 00 00       	mov    $0x5,%edi
+  803e4c:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803e53:	00 00 00 
+  803e56:	ff d0                	call   *%rax
+  803e58:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e5b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e5f:	79 05                	jns    803e66 <devfile_stat+0x47>
+    return r;
+  803e61:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803e64:	eb 59                	jmp    803ebf <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803e66:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e6a:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803e71:	00 00 00 
+  803e74:	48 89 d6             	mov    %rdx,%rsi
+  803e77:	48 89 c7             	mov    %rax,%rdi
+  803e7a:	48 b8 89 16 80 00 00 	movabs $0x801689,%rax
+  803e81:	00 00 00 
+  803e84:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803e86:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803e8d:	00 00 00 
+  803e90:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803e96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e9a:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ea0:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803ea7:	00 00 00 
+  803eaa:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803eb0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803eb4:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803eba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ebf:	c9                   	leave
+  803ec0:	c3                   	ret
+
+0000000000803ec1 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803ec1:	55                   	push   %rbp
+  803ec2:	48 89 e5             	mov    %rsp,%rbp
+  803ec5:	48 83 ec 10          	sub    $0x10,%rsp
+  803ec9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803ecd:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803ed0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ed4:	8b 40 0c             	mov    0xc(%rax),%eax
+  803ed7:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803ede:	00 00 00 
+  803ee1:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803ee3:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  803eea:	00 00 00 
+  803eed:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ef0:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803ef3:	be 00 00 00 00       	mov    $0x0,%esi
+  803ef8:	bf 02 00 00 00       	mov    $0x2,%edi
+  803efd:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803f04:	00 00 00 
+  803f07:	ff d0                	call   *%rax
+}
+  803f09:	c9                   	leave
+  803f0a:	c3                   	ret
+
+0000000000803f0b <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803f0b:	55                   	push   %rbp
+  803f0c:	48 89 e5             	mov    %rsp,%rbp
+  803f0f:	48 83 ec 18          	sub    $0x18,%rsp
+  803f13:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803f17:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803f1a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803f1e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803f21:	83 e0 03             	and    $0x3,%eax
+}
+  803f24:	c9                   	leave
+  803f25:	c3                   	ret
+
+0000000000803f26 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803f26:	55                   	push   %rbp
+  803f27:	48 89 e5             	mov    %rsp,%rbp
+  803f2a:	48 83 ec 10          	sub    $0x10,%rsp
+  803f2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803f32:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f36:	48 89 c7             	mov    %rax,%rdi
+  803f39:	48 b8 88 15 80 00 00 	movabs $0x801588,%rax
+  803f40:	00 00 00 
+  803f43:	ff d0                	call   *%rax
+  803f45:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803f4a:	7e 07                	jle    803f53 <remove+0x2d>
+    return -E_BAD_PATH;
+  803f4c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803f51:	eb 36                	jmp    803f89 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803f53:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803f57:	48 89 c6             	mov    %rax,%rsi
+  803f5a:	48 b8 00 90 80 00 00 	movabs $0x809000,%rax
+  803f61:	00 00 00 
+  803f64:	48 89 c7             	mov    %rax,%rdi
+  803f67:	48 b8 89 16 80 00 00 	movabs $0x801689,%rax
+  803f6e:	00 00 00 
+  803f71:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803f73:	be 00 00 00 00       	mov    $0x0,%esi
+  803f78:	bf 07 00 00 00       	mov    $0x7,%edi
+  803f7d:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803f84:	00 00 00 
+  803f87:	ff d0                	call   *%rax
+}
+  803f89:	c9                   	leave
+  803f8a:	c3                   	ret
+
+0000000000803f8b <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803f8b:	55                   	push   %rbp
+  803f8c:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803f8f:	be 00 00 00 00       	mov    $0x0,%esi
+  803f94:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f99:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803fa0:	00 00 00 
+  803fa3:	ff d0                	call   *%rax
+}
+  803fa5:	5d                   	pop    %rbp
+  803fa6:	c3                   	ret
+
+0000000000803fa7 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803fa7:	55                   	push   %rbp
+  803fa8:	48 89 e5             	mov    %rsp,%rbp
+  803fab:	48 83 ec 20          	sub    $0x20,%rsp
+  803faf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803fb3:	be 00 00 00 00       	mov    $0x0,%esi
+  803fb8:	bf 09 00 00 00       	mov    $0x9,%edi
+  803fbd:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  803fc4:	00 00 00 
+  803fc7:	ff d0                	call   *%rax
+  803fc9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fcc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803fd0:	79 05                	jns    803fd7 <fs_stats+0x30>
+    return r;
+  803fd2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803fd5:	eb 2a                	jmp    804001 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803fd7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fdb:	ba 68 00 00 00       	mov    $0x68,%edx
+  803fe0:	48 b9 00 90 80 00 00 	movabs $0x809000,%rcx
+  803fe7:	00 00 00 
+  803fea:	48 89 ce             	mov    %rcx,%rsi
+  803fed:	48 89 c7             	mov    %rax,%rdi
+  803ff0:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  803ff7:	00 00 00 
+  803ffa:	ff d0                	call   *%rax
+  return 0;
+  803ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804001:	c9                   	leave
+  804002:	c3                   	ret
+
+0000000000804003 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804003:	55                   	push   %rbp
+  804004:	48 89 e5             	mov    %rsp,%rbp
+  804007:	48 83 ec 10          	sub    $0x10,%rsp
+  80400b:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  80400e:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  804015:	00 00 00 
+  804018:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80401b:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  80401d:	be 00 00 00 00       	mov    $0x0,%esi
+  804022:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804027:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  80402e:	00 00 00 
+  804031:	ff d0                	call   *%rax
+}
+  804033:	c9                   	leave
+  804034:	c3                   	ret
+
+0000000000804035 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  804035:	55                   	push   %rbp
+  804036:	48 89 e5             	mov    %rsp,%rbp
+  804039:	48 83 ec 10          	sub    $0x10,%rsp
+  80403d:	89 f8                	mov    %edi,%eax
+  80403f:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  804042:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  804046:	48 ba 00 90 80 00 00 	movabs $0x809000,%rdx
+  80404d:	00 00 00 
+  804050:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  804052:	be 00 00 00 00       	mov    $0x0,%esi
+  804057:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80405c:	48 b8 ab 3a 80 00 00 	movabs $0x803aab,%rax
+  804063:	00 00 00 
+  804066:	ff d0                	call   *%rax
+}
+  804068:	c9                   	leave
+  804069:	c3                   	ret
+
+000000000080406a <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  80406a:	55                   	push   %rbp
+  80406b:	48 89 e5             	mov    %rsp,%rbp
+  80406e:	48 83 ec 10          	sub    $0x10,%rsp
+  804072:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804076:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80407a:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  80407f:	48 89 c7             	mov    %rax,%rdi
+  804082:	48 b8 90 40 80 00 00 	movabs $0x804090,%rax
+  804089:	00 00 00 
+  80408c:	ff d0                	call   *%rax
+}
+  80408e:	c9                   	leave
+  80408f:	c3                   	ret
+
+0000000000804090 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804090:	55                   	push   %rbp
+  804091:	48 89 e5             	mov    %rsp,%rbp
+  804094:	48 83 ec 50          	sub    $0x50,%rsp
+  804098:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80409c:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  8040a0:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8040a7:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  8040a8:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  8040ad:	74 0a                	je     8040b9 <pipe_size+0x29>
+  8040af:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  8040b6:	00 
+  8040b7:	76 0a                	jbe    8040c3 <pipe_size+0x33>
+    return -E_INVAL;
+  8040b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8040be:	e9 cc 02 00 00       	jmp    80438f <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  8040c3:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  8040c7:	48 89 c7             	mov    %rax,%rdi
+  8040ca:	48 b8 8c 2b 80 00 00 	movabs $0x802b8c,%rax
+  8040d1:	00 00 00 
+  8040d4:	ff d0                	call   *%rax
+  8040d6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8040d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8040dd:	0f 88 a8 02 00 00    	js     80438b <pipe_size+0x2fb>
+  8040e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8040e7:	ba 07 04 00 00       	mov    $0x407,%edx
+  8040ec:	48 89 c6             	mov    %rax,%rsi
+  8040ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040f4:	48 b8 57 24 80 00 00 	movabs $0x802457,%rax
+  8040fb:	00 00 00 
+  8040fe:	ff d0                	call   *%rax
+  804100:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804103:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804107:	0f 88 7e 02 00 00    	js     80438b <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80410d:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  804111:	48 89 c7             	mov    %rax,%rdi
+  804114:	48 b8 8c 2b 80 00 00 	movabs $0x802b8c,%rax
+  80411b:	00 00 00 
+  80411e:	ff d0                	call   *%rax
+  804120:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804123:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804127:	0f 88 43 02 00 00    	js     804370 <pipe_size+0x2e0>
+  80412d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804131:	ba 07 04 00 00       	mov    $0x407,%edx
+  804136:	48 89 c6             	mov    %rax,%rsi
+  804139:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413e:	48 b8 57 24 80 00 00 	movabs $0x802457,%rax
+  804145:	00 00 00 
+  804148:	ff d0                	call   *%rax
+  80414a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80414d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804151:	0f 88 19 02 00 00    	js     804370 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  804157:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80415b:	48 89 c7             	mov    %rax,%rdi
+  80415e:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  804165:	00 00 00 
+  804168:	ff d0                	call   *%rax
+  80416a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  80416e:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804175:	00 
+  804176:	e9 a2 00 00 00       	jmp    80421d <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80417b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80417f:	48 c1 e0 0c          	shl    $0xc,%rax
+  804183:	48 89 c2             	mov    %rax,%rdx
+  804186:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80418a:	48 01 d0             	add    %rdx,%rax
+  80418d:	ba 07 04 00 00       	mov    $0x407,%edx
+  804192:	48 89 c6             	mov    %rax,%rsi
+  804195:	bf 00 00 00 00       	mov    $0x0,%edi
+  80419a:	48 b8 57 24 80 00 00 	movabs $0x802457,%rax
+  8041a1:	00 00 00 
+  8041a4:	ff d0                	call   *%rax
+  8041a6:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8041a9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8041ad:	0f 88 37 01 00 00    	js     8042ea <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  8041b3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8041b7:	48 89 c7             	mov    %rax,%rdi
+  8041ba:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  8041c1:	00 00 00 
+  8041c4:	ff d0                	call   *%rax
+  8041c6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8041ca:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8041ce:	48 01 c2             	add    %rax,%rdx
+  8041d1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8041d5:	48 c1 e0 0c          	shl    $0xc,%rax
+  8041d9:	48 89 c1             	mov    %rax,%rcx
+  8041dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8041e0:	48 01 c8             	add    %rcx,%rax
+  8041e3:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  8041e9:	48 89 d1             	mov    %rdx,%rcx
+  8041ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041f1:	48 89 c6             	mov    %rax,%rsi
+  8041f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041f9:	48 b8 af 24 80 00 00 	movabs $0x8024af,%rax
+  804200:	00 00 00 
+  804203:	ff d0                	call   *%rax
+  804205:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804208:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80420c:	79 0a                	jns    804218 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  80420e:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  804213:	e9 d3 00 00 00       	jmp    8042eb <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  804218:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  80421d:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  804224:	00 
+  804225:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  804229:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80422d:	48 01 d0             	add    %rdx,%rax
+  804230:	48 83 c0 1f          	add    $0x1f,%rax
+  804234:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  804238:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80423c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804241:	48 f7 75 e0          	divq   -0x20(%rbp)
+  804245:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804249:	48 29 d0             	sub    %rdx,%rax
+  80424c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804250:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  804254:	0f 82 21 ff ff ff    	jb     80417b <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  80425a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80425e:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  804262:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804266:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  80426a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  80426e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804272:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804279:	00 00 00 
+  80427c:	8b 12                	mov    (%rdx),%edx
+  80427e:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804280:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804284:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80428b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80428f:	48 ba 80 70 80 00 00 	movabs $0x807080,%rdx
+  804296:	00 00 00 
+  804299:	8b 12                	mov    (%rdx),%edx
+  80429b:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  80429d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8042a1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  8042a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042ac:	48 89 c7             	mov    %rax,%rdi
+  8042af:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  8042b6:	00 00 00 
+  8042b9:	ff d0                	call   *%rax
+  8042bb:	89 c2                	mov    %eax,%edx
+  8042bd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8042c1:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  8042c3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8042c7:	48 89 c7             	mov    %rax,%rdi
+  8042ca:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  8042d1:	00 00 00 
+  8042d4:	ff d0                	call   *%rax
+  8042d6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8042da:	48 83 c2 04          	add    $0x4,%rdx
+  8042de:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  8042e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e5:	e9 a5 00 00 00       	jmp    80438f <pipe_size+0x2ff>
+      goto err2;
+  8042ea:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  8042eb:	eb 58                	jmp    804345 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  8042ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8042f1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8042f5:	48 89 c2             	mov    %rax,%rdx
+  8042f8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8042fc:	48 01 d0             	add    %rdx,%rax
+  8042ff:	48 89 c6             	mov    %rax,%rsi
+  804302:	bf 00 00 00 00       	mov    $0x0,%edi
+  804307:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  804313:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804317:	48 89 c7             	mov    %rax,%rdi
+  80431a:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  804321:	00 00 00 
+  804324:	ff d0                	call   *%rax
+  804326:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80432a:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80432e:	48 01 d0             	add    %rdx,%rax
+  804331:	48 89 c6             	mov    %rax,%rsi
+  804334:	bf 00 00 00 00       	mov    $0x0,%edi
+  804339:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  804340:	00 00 00 
+  804343:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  804345:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804349:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80434d:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  804351:	48 85 c0             	test   %rax,%rax
+  804354:	75 97                	jne    8042ed <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  804356:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80435a:	48 89 c6             	mov    %rax,%rsi
+  80435d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804362:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  804369:	00 00 00 
+  80436c:	ff d0                	call   *%rax
+  80436e:	eb 01                	jmp    804371 <pipe_size+0x2e1>
+    goto err1;
+  804370:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804371:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804375:	48 89 c6             	mov    %rax,%rsi
+  804378:	bf 00 00 00 00       	mov    $0x0,%edi
+  80437d:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  804384:	00 00 00 
+  804387:	ff d0                	call   *%rax
+  804389:	eb 01                	jmp    80438c <pipe_size+0x2fc>
+    goto err;
+  80438b:	90                   	nop
+err:
+  return r;
+  80438c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80438f:	c9                   	leave
+  804390:	c3                   	ret
+
+0000000000804391 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804391:	55                   	push   %rbp
+  804392:	48 89 e5             	mov    %rsp,%rbp
+  804395:	53                   	push   %rbx
+  804396:	48 83 ec 28          	sub    $0x28,%rsp
+  80439a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80439e:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  8043a2:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8043a9:	00 00 00 
+  8043ac:	8b 40 04             	mov    0x4(%rax),%eax
+  8043af:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8043b4:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8043bb:	00 00 00 
+  8043be:	48 98                	cltq
+  8043c0:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8043c7:	48 01 d0             	add    %rdx,%rax
+  8043ca:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8043d0:	8b 00                	mov    (%rax),%eax
+  8043d2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  8043d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043d9:	48 89 c7             	mov    %rax,%rdi
+  8043dc:	48 b8 91 5d 80 00 00 	movabs $0x805d91,%rax
+  8043e3:	00 00 00 
+  8043e6:	ff d0                	call   *%rax
+  8043e8:	89 c3                	mov    %eax,%ebx
+  8043ea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043ee:	48 89 c7             	mov    %rax,%rdi
+  8043f1:	48 b8 91 5d 80 00 00 	movabs $0x805d91,%rax
+  8043f8:	00 00 00 
+  8043fb:	ff d0                	call   *%rax
+  8043fd:	39 c3                	cmp    %eax,%ebx
+  8043ff:	0f 94 c0             	sete   %al
+  804402:	0f b6 c0             	movzbl %al,%eax
+  804405:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804408:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80440f:	00 00 00 
+  804412:	8b 40 04             	mov    0x4(%rax),%eax
+  804415:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80441a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804421:	00 00 00 
+  804424:	48 98                	cltq
+  804426:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80442d:	48 01 d0             	add    %rdx,%rax
+  804430:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804436:	8b 00                	mov    (%rax),%eax
+  804438:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  80443b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80443e:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804441:	75 05                	jne    804448 <_pipeisclosed+0xb7>
+      return ret;
+  804443:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  804446:	eb 68                	jmp    8044b0 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804448:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80444b:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80444e:	0f 84 4e ff ff ff    	je     8043a2 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  804454:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80445b:	00 00 00 
+  80445e:	8b 40 04             	mov    0x4(%rax),%eax
+  804461:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804466:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80446d:	00 00 00 
+  804470:	48 98                	cltq
+  804472:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804479:	48 01 d0             	add    %rdx,%rax
+  80447c:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804482:	8b 10                	mov    (%rax),%edx
+  804484:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804487:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80448a:	89 c6                	mov    %eax,%esi
+  80448c:	48 b8 40 65 80 00 00 	movabs $0x806540,%rax
+  804493:	00 00 00 
+  804496:	48 89 c7             	mov    %rax,%rdi
+  804499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449e:	49 b8 d9 06 80 00 00 	movabs $0x8006d9,%r8
+  8044a5:	00 00 00 
+  8044a8:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8044ab:	e9 f2 fe ff ff       	jmp    8043a2 <_pipeisclosed+0x11>
+  }
+}
+  8044b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8044b4:	c9                   	leave
+  8044b5:	c3                   	ret
+
+00000000008044b6 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8044b6:	55                   	push   %rbp
+  8044b7:	48 89 e5             	mov    %rsp,%rbp
+  8044ba:	48 83 ec 30          	sub    $0x30,%rsp
+  8044be:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8044c1:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8044c5:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8044c8:	48 89 d6             	mov    %rdx,%rsi
+  8044cb:	89 c7                	mov    %eax,%edi
+  8044cd:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  8044d4:	00 00 00 
+  8044d7:	ff d0                	call   *%rax
+  8044d9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8044dc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8044e0:	79 05                	jns    8044e7 <pipeisclosed+0x31>
+    return r;
+  8044e2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8044e5:	eb 31                	jmp    804518 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  8044e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044eb:	48 89 c7             	mov    %rax,%rdi
+  8044ee:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  8044f5:	00 00 00 
+  8044f8:	ff d0                	call   *%rax
+  8044fa:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  8044fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804502:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804506:	48 89 d6             	mov    %rdx,%rsi
+  804509:	48 89 c7             	mov    %rax,%rdi
+  80450c:	48 b8 91 43 80 00 00 	movabs $0x804391,%rax
+  804513:	00 00 00 
+  804516:	ff d0                	call   *%rax
+}
+  804518:	c9                   	leave
+  804519:	c3                   	ret
+
+000000000080451a <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  80451a:	55                   	push   %rbp
+  80451b:	48 89 e5             	mov    %rsp,%rbp
+  80451e:	48 83 ec 10          	sub    $0x10,%rsp
+  804522:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  804526:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80452a:	8b 40 18             	mov    0x18(%rax),%eax
+  80452d:	8d 50 01             	lea    0x1(%rax),%edx
+  804530:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804534:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804537:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80453b:	8b 40 1c             	mov    0x1c(%rax),%eax
+  80453e:	85 c0                	test   %eax,%eax
+  804540:	74 27                	je     804569 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  804542:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804546:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  80454d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804551:	48 83 c0 18          	add    $0x18,%rax
+  804555:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  80455a:	48 89 c7             	mov    %rax,%rdi
+  80455d:	48 b8 52 28 80 00 00 	movabs $0x802852,%rax
+  804564:	00 00 00 
+  804567:	ff d0                	call   *%rax
+  }
+}
+  804569:	90                   	nop
+  80456a:	c9                   	leave
+  80456b:	c3                   	ret
+
+000000000080456c <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  80456c:	55                   	push   %rbp
+  80456d:	48 89 e5             	mov    %rsp,%rbp
+  804570:	48 83 ec 10          	sub    $0x10,%rsp
+  804574:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804578:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80457b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80457f:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804586:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80458a:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  80458e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804591:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804598:	89 c6                	mov    %eax,%esi
+  80459a:	48 89 cf             	mov    %rcx,%rdi
+  80459d:	48 b8 03 28 80 00 00 	movabs $0x802803,%rax
+  8045a4:	00 00 00 
+  8045a7:	ff d0                	call   *%rax
+}
+  8045a9:	90                   	nop
+  8045aa:	c9                   	leave
+  8045ab:	c3                   	ret
+
+00000000008045ac <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8045ac:	55                   	push   %rbp
+  8045ad:	48 89 e5             	mov    %rsp,%rbp
+  8045b0:	48 83 ec 70          	sub    $0x70,%rsp
+  8045b4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8045b8:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8045bc:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8045c0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8045c4:	48 89 c7             	mov    %rax,%rdi
+  8045c7:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  8045ce:	00 00 00 
+  8045d1:	ff d0                	call   *%rax
+  8045d3:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  8045d7:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  8045dc:	75 0a                	jne    8045e8 <devpipe_read+0x3c>
+    return 0;
+  8045de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e3:	e9 63 01 00 00       	jmp    80474b <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  8045e8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045ec:	8b 40 18             	mov    0x18(%rax),%eax
+  8045ef:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  8045f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045f6:	48 8b 10             	mov    (%rax),%rdx
+  8045f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8045fd:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804601:	48 39 c2             	cmp    %rax,%rdx
+  804604:	75 42                	jne    804648 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804606:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80460a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80460e:	48 89 d6             	mov    %rdx,%rsi
+  804611:	48 89 c7             	mov    %rax,%rdi
+  804614:	48 b8 91 43 80 00 00 	movabs $0x804391,%rax
+  80461b:	00 00 00 
+  80461e:	ff d0                	call   *%rax
+  804620:	85 c0                	test   %eax,%eax
+  804622:	74 0a                	je     80462e <devpipe_read+0x82>
+      return 0;
+  804624:	b8 00 00 00 00       	mov    $0x0,%eax
+  804629:	e9 1d 01 00 00       	jmp    80474b <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  80462e:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  804631:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804635:	89 d6                	mov    %edx,%esi
+  804637:	48 89 c7             	mov    %rax,%rdi
+  80463a:	48 b8 6c 45 80 00 00 	movabs $0x80456c,%rax
+  804641:	00 00 00 
+  804644:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  804646:	eb a0                	jmp    8045e8 <devpipe_read+0x3c>
+      break;
+  804648:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804649:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80464d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  804651:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804655:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804659:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80465d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804661:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804665:	48 8b 00             	mov    (%rax),%rax
+  804668:	48 29 c2             	sub    %rax,%rdx
+  80466b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  80466f:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804673:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804677:	48 39 c2             	cmp    %rax,%rdx
+  80467a:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80467e:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804682:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804686:	48 8b 00             	mov    (%rax),%rax
+  804689:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80468d:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804691:	ba 00 00 00 00       	mov    $0x0,%edx
+  804696:	48 f7 f1             	div    %rcx
+  804699:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  80469d:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8046a1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8046a5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046a9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8046ad:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8046b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8046b5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8046b9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8046bd:	48 39 c2             	cmp    %rax,%rdx
+  8046c0:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8046c4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8046c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046cc:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8046d0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8046d4:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  8046d8:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8046dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8046e0:	48 89 ce             	mov    %rcx,%rsi
+  8046e3:	48 89 c7             	mov    %rax,%rdi
+  8046e6:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  8046ed:	00 00 00 
+  8046f0:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  8046f2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8046f6:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  8046fa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046fe:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804702:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804706:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80470a:	48 01 d1             	add    %rdx,%rcx
+  80470d:	48 89 c2             	mov    %rax,%rdx
+  804710:	48 89 cf             	mov    %rcx,%rdi
+  804713:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  80471a:	00 00 00 
+  80471d:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  80471f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804723:	48 8b 10             	mov    (%rax),%rdx
+  804726:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80472a:	48 01 c2             	add    %rax,%rdx
+  80472d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804731:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  804734:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804738:	48 89 c7             	mov    %rax,%rdi
+  80473b:	48 b8 1a 45 80 00 00 	movabs $0x80451a,%rax
+  804742:	00 00 00 
+  804745:	ff d0                	call   *%rax
+  return n;
+  804747:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  80474b:	c9                   	leave
+  80474c:	c3                   	ret
+
+000000000080474d <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80474d:	55                   	push   %rbp
+  80474e:	48 89 e5             	mov    %rsp,%rbp
+  804751:	48 83 ec 70          	sub    $0x70,%rsp
+  804755:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804759:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80475d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804761:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804765:	48 89 c7             	mov    %rax,%rdi
+  804768:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  80476f:	00 00 00 
+  804772:	ff d0                	call   *%rax
+  804774:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804778:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80477c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804780:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804787:	00 
+  804788:	e9 b8 01 00 00       	jmp    804945 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  80478d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804791:	8b 40 18             	mov    0x18(%rax),%eax
+  804794:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804797:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80479b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80479f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047a3:	48 8b 00             	mov    (%rax),%rax
+  8047a6:	48 29 c2             	sub    %rax,%rdx
+  8047a9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047ad:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8047b1:	48 39 c2             	cmp    %rax,%rdx
+  8047b4:	75 4d                	jne    804803 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8047b6:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8047ba:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047be:	48 89 d6             	mov    %rdx,%rsi
+  8047c1:	48 89 c7             	mov    %rax,%rdi
+  8047c4:	48 b8 91 43 80 00 00 	movabs $0x804391,%rax
+  8047cb:	00 00 00 
+  8047ce:	ff d0                	call   *%rax
+  8047d0:	85 c0                	test   %eax,%eax
+  8047d2:	74 0a                	je     8047de <devpipe_write+0x91>
+        return 0;
+  8047d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047d9:	e9 79 01 00 00       	jmp    804957 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  8047de:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8047e1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8047e5:	89 d6                	mov    %edx,%esi
+  8047e7:	48 89 c7             	mov    %rax,%rdi
+  8047ea:	48 b8 6c 45 80 00 00 	movabs $0x80456c,%rax
+  8047f1:	00 00 00 
+  8047f4:	ff d0                	call   *%rax
+      m = 0;
+  8047f6:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8047fd:	00 
+      continue;
+  8047fe:	e9 3a 01 00 00       	jmp    80493d <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804803:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804807:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80480b:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  80480f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804813:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804817:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80481b:	48 8b 08             	mov    (%rax),%rcx
+  80481e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804822:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804826:	48 29 c1             	sub    %rax,%rcx
+  804829:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  80482d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804831:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804835:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804839:	48 39 c2             	cmp    %rax,%rdx
+  80483c:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804840:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  804844:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804848:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80484c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804850:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804854:	ba 00 00 00 00       	mov    $0x0,%edx
+  804859:	48 f7 f1             	div    %rcx
+  80485c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804860:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804864:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804868:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80486c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804870:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804874:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804878:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80487c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804880:	48 39 c2             	cmp    %rax,%rdx
+  804883:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804887:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80488b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80488f:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804893:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804897:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  80489b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80489f:	48 01 d1             	add    %rdx,%rcx
+  8048a2:	48 89 c2             	mov    %rax,%rdx
+  8048a5:	48 89 cf             	mov    %rcx,%rdi
+  8048a8:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  8048af:	00 00 00 
+  8048b2:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8048b4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048b8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8048bc:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8048c0:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8048c4:	73 4d                	jae    804913 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8048c6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048ca:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8048ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8048d2:	48 29 c2             	sub    %rax,%rdx
+  8048d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8048d9:	48 01 c2             	add    %rax,%rdx
+  8048dc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048e0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8048e4:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8048e8:	48 89 c1             	mov    %rax,%rcx
+  8048eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048ef:	48 01 c1             	add    %rax,%rcx
+  8048f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8048f6:	48 01 c1             	add    %rax,%rcx
+  8048f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8048fd:	48 83 c0 20          	add    $0x20,%rax
+  804901:	48 89 ce             	mov    %rcx,%rsi
+  804904:	48 89 c7             	mov    %rax,%rdi
+  804907:	48 b8 d2 1d 80 00 00 	movabs $0x801dd2,%rax
+  80490e:	00 00 00 
+  804911:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804913:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804917:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80491b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80491f:	48 01 c2             	add    %rax,%rdx
+  804922:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804926:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  80492a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80492e:	48 89 c7             	mov    %rax,%rdi
+  804931:	48 b8 1a 45 80 00 00 	movabs $0x80451a,%rax
+  804938:	00 00 00 
+  80493b:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  80493d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804941:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804945:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804949:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  80494d:	0f 82 3a fe ff ff    	jb     80478d <devpipe_write+0x40>
+  }
+
+  return i;
+  804953:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804957:	c9                   	leave
+  804958:	c3                   	ret
+
+0000000000804959 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804959:	55                   	push   %rbp
+  80495a:	48 89 e5             	mov    %rsp,%rbp
+  80495d:	48 83 ec 40          	sub    $0x40,%rsp
+  804961:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804965:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804968:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80496c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804970:	48 89 c7             	mov    %rax,%rdi
+  804973:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  80497a:	00 00 00 
+  80497d:	ff d0                	call   *%rax
+  80497f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804983:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  80498a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80498e:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804992:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804996:	48 89 d6             	mov    %rdx,%rsi
+  804999:	48 89 c7             	mov    %rax,%rdi
+  80499c:	48 b8 34 36 80 00 00 	movabs $0x803634,%rax
+  8049a3:	00 00 00 
+  8049a6:	ff d0                	call   *%rax
+  8049a8:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8049ab:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8049af:	79 08                	jns    8049b9 <devpipe_poll+0x60>
+    return r;
+  8049b1:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049b4:	e9 85 00 00 00       	jmp    804a3e <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8049b9:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8049bc:	83 e0 01             	and    $0x1,%eax
+  8049bf:	85 c0                	test   %eax,%eax
+  8049c1:	74 18                	je     8049db <devpipe_poll+0x82>
+  8049c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049c7:	48 8b 10             	mov    (%rax),%rdx
+  8049ca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049ce:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8049d2:	48 39 c2             	cmp    %rax,%rdx
+  8049d5:	74 04                	je     8049db <devpipe_poll+0x82>
+    revents |= POLLIN;
+  8049d7:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  8049db:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8049de:	83 e0 02             	and    $0x2,%eax
+  8049e1:	85 c0                	test   %eax,%eax
+  8049e3:	74 23                	je     804a08 <devpipe_poll+0xaf>
+  8049e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049e9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8049ed:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049f1:	48 8b 00             	mov    (%rax),%rax
+  8049f4:	48 29 c2             	sub    %rax,%rdx
+  8049f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049fb:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8049ff:	48 39 c2             	cmp    %rax,%rdx
+  804a02:	73 04                	jae    804a08 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804a04:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804a08:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804a0c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804a10:	48 89 d6             	mov    %rdx,%rsi
+  804a13:	48 89 c7             	mov    %rax,%rdi
+  804a16:	48 b8 91 43 80 00 00 	movabs $0x804391,%rax
+  804a1d:	00 00 00 
+  804a20:	ff d0                	call   *%rax
+  804a22:	85 c0                	test   %eax,%eax
+  804a24:	74 04                	je     804a2a <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804a26:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804a2a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a2e:	75 0b                	jne    804a3b <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804a30:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a34:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804a3b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804a3e:	c9                   	leave
+  804a3f:	c3                   	ret
+
+0000000000804a40 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804a40:	55                   	push   %rbp
+  804a41:	48 89 e5             	mov    %rsp,%rbp
+  804a44:	48 83 ec 20          	sub    $0x20,%rsp
+  804a48:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804a4c:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804a50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a54:	48 89 c7             	mov    %rax,%rdi
+  804a57:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  804a5e:	00 00 00 
+  804a61:	ff d0                	call   *%rax
+  804a63:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804a67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a6b:	48 ba 71 65 80 00 00 	movabs $0x806571,%rdx
+  804a72:	00 00 00 
+  804a75:	48 89 d6             	mov    %rdx,%rsi
+  804a78:	48 89 c7             	mov    %rax,%rdi
+  804a7b:	48 b8 89 16 80 00 00 	movabs $0x801689,%rax
+  804a82:	00 00 00 
+  804a85:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804a87:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a8b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804a8f:	89 c1                	mov    %eax,%ecx
+  804a91:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a95:	48 8b 00             	mov    (%rax),%rax
+  804a98:	89 c2                	mov    %eax,%edx
+  804a9a:	89 c8                	mov    %ecx,%eax
+  804a9c:	29 d0                	sub    %edx,%eax
+  804a9e:	89 c2                	mov    %eax,%edx
+  804aa0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804aa4:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804aaa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804aae:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804ab5:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804ab8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804abc:	48 b9 80 70 80 00 00 	movabs $0x807080,%rcx
+  804ac3:	00 00 00 
+  804ac6:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804acd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ad2:	c9                   	leave
+  804ad3:	c3                   	ret
+
+0000000000804ad4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804ad4:	55                   	push   %rbp
+  804ad5:	48 89 e5             	mov    %rsp,%rbp
+  804ad8:	48 83 ec 40          	sub    $0x40,%rsp
+  804adc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804ae0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804ae4:	48 89 c7             	mov    %rax,%rdi
+  804ae7:	48 b8 61 2b 80 00 00 	movabs $0x802b61,%rax
+  804aee:	00 00 00 
+  804af1:	ff d0                	call   *%rax
+  804af3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804af7:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804afe:	00 
+  804aff:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b03:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804b07:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804b0b:	48 01 d0             	add    %rdx,%rax
+  804b0e:	48 83 c0 1f          	add    $0x1f,%rax
+  804b12:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804b16:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b1f:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804b23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804b27:	48 29 d0             	sub    %rdx,%rax
+  804b2a:	48 c1 e8 0c          	shr    $0xc,%rax
+  804b2e:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804b32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b36:	48 89 c6             	mov    %rax,%rsi
+  804b39:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b3e:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  804b45:	00 00 00 
+  804b48:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804b4a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b4e:	48 89 c7             	mov    %rax,%rdi
+  804b51:	48 b8 1a 45 80 00 00 	movabs $0x80451a,%rax
+  804b58:	00 00 00 
+  804b5b:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804b5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b61:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804b65:	eb 2f                	jmp    804b96 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804b67:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804b6b:	48 83 e8 01          	sub    $0x1,%rax
+  804b6f:	48 c1 e0 0c          	shl    $0xc,%rax
+  804b73:	48 89 c2             	mov    %rax,%rdx
+  804b76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b7a:	48 01 d0             	add    %rdx,%rax
+  804b7d:	48 89 c6             	mov    %rax,%rsi
+  804b80:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b85:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  804b8c:	00 00 00 
+  804b8f:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804b91:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804b96:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804b9b:	77 ca                	ja     804b67 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804b9d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ba1:	48 89 c6             	mov    %rax,%rsi
+  804ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ba9:	48 b8 0f 25 80 00 00 	movabs $0x80250f,%rax
+  804bb0:	00 00 00 
+  804bb3:	ff d0                	call   *%rax
+}
+  804bb5:	c9                   	leave
+  804bb6:	c3                   	ret
+
+0000000000804bb7 <enqueue>:
+static int nslots, ntasks, nwaiting;
+static bool main_waiting; // uthread_run waits for the tasks to exit
+static unsigned nswitches;
+
+static void
+enqueue(struct UThreadQueue *q, struct UThread *t) {
+  804bb7:	55                   	push   %rbp
+  804bb8:	48 89 e5             	mov    %rsp,%rbp
+  804bbb:	48 83 ec 10          	sub    $0x10,%rsp
+  804bbf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804bc3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  t->ut_next = NULL;
+  804bc7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bcb:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+  804bd2:	00 
+  if (q->q_tail)
+  804bd3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bd7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804bdb:	48 85 c0             	test   %rax,%rax
+  804bde:	74 12                	je     804bf2 <enqueue+0x3b>
+    q->q_tail->ut_next = t;
+  804be0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804be4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804be8:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bec:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  804bf0:	eb 0b                	jmp    804bfd <enqueue+0x46>
+  else
+    q->q_head = t;
+  804bf2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804bf6:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804bfa:	48 89 10             	mov    %rdx,(%rax)
+  q->q_tail = t;
+  804bfd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c01:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804c05:	48 89 50 08          	mov    %rdx,0x8(%rax)
+}
+  804c09:	90                   	nop
+  804c0a:	c9                   	leave
+  804c0b:	c3                   	ret
+
+0000000000804c0c <dequeue>:
+
+static struct UThread *
+dequeue(struct UThreadQueue *q) {
+  804c0c:	55                   	push   %rbp
+  804c0d:	48 89 e5             	mov    %rsp,%rbp
+  804c10:	48 83 ec 18          	sub    $0x18,%rsp
+  804c14:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  struct UThread *t = q->q_head;
+  804c18:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c1c:	48 8b 00             	mov    (%rax),%rax
+  804c1f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (t && !(q->q_head = t->ut_next))
+  804c23:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804c28:	74 27                	je     804c51 <dequeue+0x45>
+  804c2a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c2e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804c32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c36:	48 89 10             	mov    %rdx,(%rax)
+  804c39:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c3d:	48 8b 00             	mov    (%rax),%rax
+  804c40:	48 85 c0             	test   %rax,%rax
+  804c43:	75 0c                	jne    804c51 <dequeue+0x45>
+    q->q_tail = NULL;
+  804c45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c49:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+  804c50:	00 
+  return t;
+  804c51:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804c55:	c9                   	leave
+  804c56:	c3                   	ret
+
+0000000000804c57 <wakeup>:
+
+// Make the tasks on wait queue q that wanted some of 'revents'
+// runnable; only the first one if q is the IPC queue, since only
+// one message is on its way.
+static void
+wakeup(int q, int revents) {
+  804c57:	55                   	push   %rbp
+  804c58:	48 89 e5             	mov    %rsp,%rbp
+  804c5b:	48 83 ec 40          	sub    $0x40,%rsp
+  804c5f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  804c62:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  struct UThreadQueue *wq = &waitq[q], rest = {0};
+  804c65:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  804c68:	48 63 d0             	movslq %eax,%rdx
+  804c6b:	48 89 d0             	mov    %rdx,%rax
+  804c6e:	48 01 c0             	add    %rax,%rax
+  804c71:	48 01 d0             	add    %rdx,%rax
+  804c74:	48 c1 e0 03          	shl    $0x3,%rax
+  804c78:	48 ba 80 a0 80 00 00 	movabs $0x80a080,%rdx
+  804c7f:	00 00 00 
+  804c82:	48 01 d0             	add    %rdx,%rax
+  804c85:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804c89:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  804c8d:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  804c91:	66 0f d6 45 e0       	movq   %xmm0,-0x20(%rbp)
+  struct UThread *t;
+
+  while ((t = dequeue(wq))) {
+  804c96:	eb 7d                	jmp    804d15 <wakeup+0xbe>
+    if ((t->ut_events | POLLHUP | POLLNVAL) & revents) {
+  804c98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c9c:	8b 40 20             	mov    0x20(%rax),%eax
+  804c9f:	83 c8 0c             	or     $0xc,%eax
+  804ca2:	23 45 c8             	and    -0x38(%rbp),%eax
+  804ca5:	85 c0                	test   %eax,%eax
+  804ca7:	74 43                	je     804cec <wakeup+0x95>
+      enqueue(&runq, t);
+  804ca9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cad:	48 89 c6             	mov    %rax,%rsi
+  804cb0:	48 b8 50 a0 80 00 00 	movabs $0x80a050,%rax
+  804cb7:	00 00 00 
+  804cba:	48 89 c7             	mov    %rax,%rdi
+  804cbd:	48 b8 b7 4b 80 00 00 	movabs $0x804bb7,%rax
+  804cc4:	00 00 00 
+  804cc7:	ff d0                	call   *%rax
+      nwaiting--;
+  804cc9:	48 b8 a8 a3 80 00 00 	movabs $0x80a3a8,%rax
+  804cd0:	00 00 00 
+  804cd3:	8b 00                	mov    (%rax),%eax
+  804cd5:	8d 50 ff             	lea    -0x1(%rax),%edx
+  804cd8:	48 b8 a8 a3 80 00 00 	movabs $0x80a3a8,%rax
+  804cdf:	00 00 00 
+  804ce2:	89 10                	mov    %edx,(%rax)
+      if (q == IPC_WAITQ)
+  804ce4:	83 7d cc 20          	cmpl   $0x20,-0x34(%rbp)
+  804ce8:	75 2b                	jne    804d15 <wakeup+0xbe>
+        break;
+  804cea:	eb 4b                	jmp    804d37 <wakeup+0xe0>
+    } else {
+      enqueue(&rest, t);
+  804cec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804cf0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804cf4:	48 89 d6             	mov    %rdx,%rsi
+  804cf7:	48 89 c7             	mov    %rax,%rdi
+  804cfa:	48 b8 b7 4b 80 00 00 	movabs $0x804bb7,%rax
+  804d01:	00 00 00 
+  804d04:	ff d0                	call   *%rax
+      rest.q_events |= t->ut_events;
+  804d06:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  804d09:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d0d:	8b 40 20             	mov    0x20(%rax),%eax
+  804d10:	09 d0                	or     %edx,%eax
+  804d12:	89 45 e0             	mov    %eax,-0x20(%rbp)
+  while ((t = dequeue(wq))) {
+  804d15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d19:	48 89 c7             	mov    %rax,%rdi
+  804d1c:	48 b8 0c 4c 80 00 00 	movabs $0x804c0c,%rax
+  804d23:	00 00 00 
+  804d26:	ff d0                	call   *%rax
+  804d28:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804d2c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804d31:	0f 85 61 ff ff ff    	jne    804c98 <wakeup+0x41>
+    }
+  }
+  // Keep the order of the tasks that go on waiting.
+  if (wq->q_head) {
+  804d37:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d3b:	48 8b 00             	mov    (%rax),%rax
+  804d3e:	48 85 c0             	test   %rax,%rax
+  804d41:	74 60                	je     804da3 <wakeup+0x14c>
+    if (rest.q_tail)
+  804d43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d47:	48 85 c0             	test   %rax,%rax
+  804d4a:	74 11                	je     804d5d <wakeup+0x106>
+      rest.q_tail->ut_next = wq->q_head;
+  804d4c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804d50:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804d54:	48 8b 12             	mov    (%rdx),%rdx
+  804d57:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  804d5b:	eb 0b                	jmp    804d68 <wakeup+0x111>
+    else
+      rest.q_head = wq->q_head;
+  804d5d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d61:	48 8b 00             	mov    (%rax),%rax
+  804d64:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+    rest.q_tail = wq->q_tail;
+  804d68:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d6c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d70:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+    for (t = wq->q_head; t; t = t->ut_next)
+  804d74:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d78:	48 8b 00             	mov    (%rax),%rax
+  804d7b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804d7f:	eb 1b                	jmp    804d9c <wakeup+0x145>
+      rest.q_events |= t->ut_events;
+  804d81:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  804d84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d88:	8b 40 20             	mov    0x20(%rax),%eax
+  804d8b:	09 d0                	or     %edx,%eax
+  804d8d:	89 45 e0             	mov    %eax,-0x20(%rbp)
+    for (t = wq->q_head; t; t = t->ut_next)
+  804d90:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d94:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804d98:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804d9c:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  804da1:	75 de                	jne    804d81 <wakeup+0x12a>
+  }
+  *wq = rest;
+  804da3:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  804da7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804dab:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804daf:	48 89 01             	mov    %rax,(%rcx)
+  804db2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  804db6:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804dba:	48 89 41 10          	mov    %rax,0x10(%rcx)
+}
+  804dbe:	90                   	nop
+  804dbf:	c9                   	leave
+  804dc0:	c3                   	ret
+
+0000000000804dc1 <uthread_poll>:
+
+// Poll everything the waiting tasks wait for and wake those whose
+// events are ready.  With 'block', sleep until at least one is.
+static void
+uthread_poll(bool block) {
+  804dc1:	55                   	push   %rbp
+  804dc2:	48 89 e5             	mov    %rsp,%rbp
+  804dc5:	48 81 ec 40 02 00 00 	sub    $0x240,%rsp
+  804dcc:	89 f8                	mov    %edi,%eax
+  804dce:	88 85 cc fd ff ff    	mov    %al,-0x234(%rbp)
+  struct pollfd fds[MAXFD + 1];
+  int qs[MAXFD + 1];
+  int i, n = 0, r;
+  804dd4:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+  for (i = 0; i <= MAXFD; i++) {
+  804ddb:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804de2:	e9 ba 00 00 00       	jmp    804ea1 <uthread_poll+0xe0>
+    if (!waitq[i].q_head)
+  804de7:	48 b9 80 a0 80 00 00 	movabs $0x80a080,%rcx
+  804dee:	00 00 00 
+  804df1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804df4:	48 63 d0             	movslq %eax,%rdx
+  804df7:	48 89 d0             	mov    %rdx,%rax
+  804dfa:	48 01 c0             	add    %rax,%rax
+  804dfd:	48 01 d0             	add    %rdx,%rax
+  804e00:	48 c1 e0 03          	shl    $0x3,%rax
+  804e04:	48 01 c8             	add    %rcx,%rax
+  804e07:	48 8b 00             	mov    (%rax),%rax
+  804e0a:	48 85 c0             	test   %rax,%rax
+  804e0d:	0f 84 89 00 00 00    	je     804e9c <uthread_poll+0xdb>
+      continue;
+    fds[n].fd     = i == IPC_WAITQ ? POLLFD_IPC : i;
+  804e13:	83 7d fc 20          	cmpl   $0x20,-0x4(%rbp)
+  804e17:	74 05                	je     804e1e <uthread_poll+0x5d>
+  804e19:	8b 4d fc             	mov    -0x4(%rbp),%ecx
+  804e1c:	eb 05                	jmp    804e23 <uthread_poll+0x62>
+  804e1e:	b9 fe ff ff ff       	mov    $0xfffffffe,%ecx
+  804e23:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804e26:	48 63 d0             	movslq %eax,%rdx
+  804e29:	48 89 d0             	mov    %rdx,%rax
+  804e2c:	48 01 c0             	add    %rax,%rax
+  804e2f:	48 01 d0             	add    %rdx,%rax
+  804e32:	48 c1 e0 02          	shl    $0x2,%rax
+  804e36:	48 01 e8             	add    %rbp,%rax
+  804e39:	48 2d a0 01 00 00    	sub    $0x1a0,%rax
+  804e3f:	89 08                	mov    %ecx,(%rax)
+    fds[n].events = waitq[i].q_events;
+  804e41:	48 b9 80 a0 80 00 00 	movabs $0x80a080,%rcx
+  804e48:	00 00 00 
+  804e4b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e4e:	48 63 d0             	movslq %eax,%rdx
+  804e51:	48 89 d0             	mov    %rdx,%rax
+  804e54:	48 01 c0             	add    %rax,%rax
+  804e57:	48 01 d0             	add    %rdx,%rax
+  804e5a:	48 c1 e0 03          	shl    $0x3,%rax
+  804e5e:	48 01 c8             	add    %rcx,%rax
+  804e61:	48 83 c0 10          	add    $0x10,%rax
+  804e65:	8b 08                	mov    (%rax),%ecx
+  804e67:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804e6a:	48 63 d0             	movslq %eax,%rdx
+  804e6d:	48 89 d0             	mov    %rdx,%rax
+  804e70:	48 01 c0             	add    %rax,%rax
+  804e73:	48 01 d0             	add    %rdx,%rax
+  804e76:	48 c1 e0 02          	shl    $0x2,%rax
+  804e7a:	48 01 e8             	add    %rbp,%rax
+  804e7d:	48 2d 9c 01 00 00    	sub    $0x19c,%rax
+  804e83:	89 08                	mov    %ecx,(%rax)
+    qs[n++]       = i;
+  804e85:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804e88:	8d 50 01             	lea    0x1(%rax),%edx
+  804e8b:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  804e8e:	48 98                	cltq
+  804e90:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  804e93:	89 94 85 d0 fd ff ff 	mov    %edx,-0x230(%rbp,%rax,4)
+  804e9a:	eb 01                	jmp    804e9d <uthread_poll+0xdc>
+      continue;
+  804e9c:	90                   	nop
+  for (i = 0; i <= MAXFD; i++) {
+  804e9d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804ea1:	83 7d fc 20          	cmpl   $0x20,-0x4(%rbp)
+  804ea5:	0f 8e 3c ff ff ff    	jle    804de7 <uthread_poll+0x26>
+  }
+  if ((r = poll(fds, n, block ? POLL_NO_TIMEOUT : 0)) < 0)
+  804eab:	80 bd cc fd ff ff 00 	cmpb   $0x0,-0x234(%rbp)
+  804eb2:	74 09                	je     804ebd <uthread_poll+0xfc>
+  804eb4:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804ebb:	eb 05                	jmp    804ec2 <uthread_poll+0x101>
+  804ebd:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ec2:	8b 4d f8             	mov    -0x8(%rbp),%ecx
+  804ec5:	48 8d 85 60 fe ff ff 	lea    -0x1a0(%rbp),%rax
+  804ecc:	89 ce                	mov    %ecx,%esi
+  804ece:	48 89 c7             	mov    %rax,%rdi
+  804ed1:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  804ed8:	00 00 00 
+  804edb:	ff d0                	call   *%rax
+  804edd:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  804ee0:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  804ee4:	79 36                	jns    804f1c <uthread_poll+0x15b>
+    panic("uthread: poll: %i", r);
+  804ee6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804ee9:	89 c1                	mov    %eax,%ecx
+  804eeb:	48 b8 78 65 80 00 00 	movabs $0x806578,%rax
+  804ef2:	00 00 00 
+  804ef5:	48 89 c2             	mov    %rax,%rdx
+  804ef8:	be 78 00 00 00       	mov    $0x78,%esi
+  804efd:	48 b8 8a 65 80 00 00 	movabs $0x80658a,%rax
+  804f04:	00 00 00 
+  804f07:	48 89 c7             	mov    %rax,%rdi
+  804f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f0f:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  804f16:	00 00 00 
+  804f19:	41 ff d0             	call   *%r8
+  for (i = 0; i < n; i++) {
+  804f1c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804f23:	eb 60                	jmp    804f85 <uthread_poll+0x1c4>
+    if (fds[i].revents)
+  804f25:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f28:	48 63 d0             	movslq %eax,%rdx
+  804f2b:	48 89 d0             	mov    %rdx,%rax
+  804f2e:	48 01 c0             	add    %rax,%rax
+  804f31:	48 01 d0             	add    %rdx,%rax
+  804f34:	48 c1 e0 02          	shl    $0x2,%rax
+  804f38:	48 01 e8             	add    %rbp,%rax
+  804f3b:	48 2d 98 01 00 00    	sub    $0x198,%rax
+  804f41:	8b 00                	mov    (%rax),%eax
+  804f43:	85 c0                	test   %eax,%eax
+  804f45:	74 3a                	je     804f81 <uthread_poll+0x1c0>
+      wakeup(qs[i], fds[i].revents);
+  804f47:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f4a:	48 63 d0             	movslq %eax,%rdx
+  804f4d:	48 89 d0             	mov    %rdx,%rax
+  804f50:	48 01 c0             	add    %rax,%rax
+  804f53:	48 01 d0             	add    %rdx,%rax
+  804f56:	48 c1 e0 02          	shl    $0x2,%rax
+  804f5a:	48 01 e8             	add    %rbp,%rax
+  804f5d:	48 2d 98 01 00 00    	sub    $0x198,%rax
+  804f63:	8b 10                	mov    (%rax),%edx
+  804f65:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f68:	48 98                	cltq
+  804f6a:	8b 84 85 d0 fd ff ff 	mov    -0x230(%rbp,%rax,4),%eax
+  804f71:	89 d6                	mov    %edx,%esi
+  804f73:	89 c7                	mov    %eax,%edi
+  804f75:	48 b8 57 4c 80 00 00 	movabs $0x804c57,%rax
+  804f7c:	00 00 00 
+  804f7f:	ff d0                	call   *%rax
+  for (i = 0; i < n; i++) {
+  804f81:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804f85:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f88:	3b 45 f8             	cmp    -0x8(%rbp),%eax
+  804f8b:	7c 98                	jl     804f25 <uthread_poll+0x164>
+  }
+}
+  804f8d:	90                   	nop
+  804f8e:	90                   	nop
+  804f8f:	c9                   	leave
+  804f90:	c3                   	ret
+
+0000000000804f91 <uthread_schedule>:
+
+// Switch to the next runnable task.  The current task must already
+// be on whatever queue it belongs to.
+static void
+uthread_schedule(void) {
+  804f91:	55                   	push   %rbp
+  804f92:	48 89 e5             	mov    %rsp,%rbp
+  804f95:	48 83 ec 10          	sub    $0x10,%rsp
+  struct UThread *prev = uthread_cur, *next;
+  804f99:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  804fa0:	00 00 00 
+  804fa3:	48 8b 00             	mov    (%rax),%rax
+  804fa6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (nwaiting && (!runq.q_head || ++nswitches % UTHREAD_POLL_INTERVAL == 0))
+  804faa:	48 b8 a8 a3 80 00 00 	movabs $0x80a3a8,%rax
+  804fb1:	00 00 00 
+  804fb4:	8b 00                	mov    (%rax),%eax
+  804fb6:	85 c0                	test   %eax,%eax
+  804fb8:	74 64                	je     80501e <uthread_schedule+0x8d>
+  804fba:	48 b8 50 a0 80 00 00 	movabs $0x80a050,%rax
+  804fc1:	00 00 00 
+  804fc4:	48 8b 00             	mov    (%rax),%rax
+  804fc7:	48 85 c0             	test   %rax,%rax
+  804fca:	74 2e                	je     804ffa <uthread_schedule+0x69>
+  804fcc:	48 b8 b0 a3 80 00 00 	movabs $0x80a3b0,%rax
+  804fd3:	00 00 00 
+  804fd6:	8b 00                	mov    (%rax),%eax
+  804fd8:	8d 50 01             	lea    0x1(%rax),%edx
+  804fdb:	48 b8 b0 a3 80 00 00 	movabs $0x80a3b0,%rax
+  804fe2:	00 00 00 
+  804fe5:	89 10                	mov    %edx,(%rax)
+  804fe7:	48 b8 b0 a3 80 00 00 	movabs $0x80a3b0,%rax
+  804fee:	00 00 00 
+  804ff1:	8b 00                	mov    (%rax),%eax
+  804ff3:	83 e0 3f             	and    $0x3f,%eax
+  804ff6:	85 c0                	test   %eax,%eax
+  804ff8:	75 24                	jne    80501e <uthread_schedule+0x8d>
+    uthread_poll(!runq.q_head);
+  804ffa:	48 b8 50 a0 80 00 00 	movabs $0x80a050,%rax
+  805001:	00 00 00 
+  805004:	48 8b 00             	mov    (%rax),%rax
+  805007:	48 85 c0             	test   %rax,%rax
+  80500a:	0f 94 c0             	sete   %al
+  80500d:	0f b6 c0             	movzbl %al,%eax
+  805010:	89 c7                	mov    %eax,%edi
+  805012:	48 b8 c1 4d 80 00 00 	movabs $0x804dc1,%rax
+  805019:	00 00 00 
+  80501c:	ff d0                	call   *%rax
+  if (!(next = dequeue(&runq)))
+  80501e:	48 b8 50 a0 80 00 00 	movabs $0x80a050,%rax
+  805025:	00 00 00 
+  805028:	48 89 c7             	mov    %rax,%rdi
+  80502b:	48 b8 0c 4c 80 00 00 	movabs $0x804c0c,%rax
+  805032:	00 00 00 
+  805035:	ff d0                	call   *%rax
+  805037:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80503b:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  805040:	75 30                	jne    805072 <uthread_schedule+0xe1>
+    panic("uthread: no task can run");
+  805042:	48 b8 98 65 80 00 00 	movabs $0x806598,%rax
+  805049:	00 00 00 
+  80504c:	48 89 c2             	mov    %rax,%rdx
+  80504f:	be 88 00 00 00       	mov    $0x88,%esi
+  805054:	48 b8 8a 65 80 00 00 	movabs $0x80658a,%rax
+  80505b:	00 00 00 
+  80505e:	48 89 c7             	mov    %rax,%rdi
+  805061:	b8 00 00 00 00       	mov    $0x0,%eax
+  805066:	48 b9 ba 04 80 00 00 	movabs $0x8004ba,%rcx
+  80506d:	00 00 00 
+  805070:	ff d1                	call   *%rcx
+  if (next == prev)
+  805072:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805076:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80507a:	74 30                	je     8050ac <uthread_schedule+0x11b>
+    return;
+  uthread_cur = next;
+  80507c:	48 ba c0 70 80 00 00 	movabs $0x8070c0,%rdx
+  805083:	00 00 00 
+  805086:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80508a:	48 89 02             	mov    %rax,(%rdx)
+  uthread_switch(&prev->ut_rsp, next->ut_rsp);
+  80508d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805091:	48 8b 10             	mov    (%rax),%rdx
+  805094:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805098:	48 89 d6             	mov    %rdx,%rsi
+  80509b:	48 89 c7             	mov    %rax,%rdi
+  80509e:	48 b8 ab 56 80 00 00 	movabs $0x8056ab,%rax
+  8050a5:	00 00 00 
+  8050a8:	ff d0                	call   *%rax
+  8050aa:	eb 01                	jmp    8050ad <uthread_schedule+0x11c>
+    return;
+  8050ac:	90                   	nop
+}
+  8050ad:	c9                   	leave
+  8050ae:	c3                   	ret
+
+00000000008050af <uthread_start>:
+
+static void
+uthread_start(void) {
+  8050af:	55                   	push   %rbp
+  8050b0:	48 89 e5             	mov    %rsp,%rbp
+  uthread_cur->ut_fn(uthread_cur->ut_arg);
+  8050b3:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8050ba:	00 00 00 
+  8050bd:	48 8b 00             	mov    (%rax),%rax
+  8050c0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8050c4:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8050cb:	00 00 00 
+  8050ce:	48 8b 00             	mov    (%rax),%rax
+  8050d1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8050d5:	48 89 c7             	mov    %rax,%rdi
+  8050d8:	ff d2                	call   *%rdx
+  uthread_exit();
+  8050da:	48 b8 df 52 80 00 00 	movabs $0x8052df,%rax
+  8050e1:	00 00 00 
+  8050e4:	ff d0                	call   *%rax
+}
+  8050e6:	90                   	nop
+  8050e7:	5d                   	pop    %rbp
+  8050e8:	c3                   	ret
+
+00000000008050e9 <uthread_create>:
+
+// Create a task running fn(arg) and queue it to run.  Returning from
+// fn is the same as calling uthread_exit.
+// Returns 0 on success, -E_NO_MEM if there is no slot or no memory.
+int
+uthread_create(void (*fn)(void *), void *arg) {
+  8050e9:	55                   	push   %rbp
+  8050ea:	48 89 e5             	mov    %rsp,%rbp
+  8050ed:	48 83 ec 40          	sub    $0x40,%rsp
+  8050f1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8050f5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  struct UThread *t;
+  uintptr_t slot, va, *sp;
+  int r;
+
+  if ((t = freelist)) {
+  8050f9:	48 b8 98 a3 80 00 00 	movabs $0x80a398,%rax
+  805100:	00 00 00 
+  805103:	48 8b 00             	mov    (%rax),%rax
+  805106:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80510a:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  80510f:	74 1a                	je     80512b <uthread_create+0x42>
+    freelist = t->ut_next;
+  805111:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805115:	48 8b 40 08          	mov    0x8(%rax),%rax
+  805119:	48 ba 98 a3 80 00 00 	movabs $0x80a398,%rdx
+  805120:	00 00 00 
+  805123:	48 89 02             	mov    %rax,(%rdx)
+  805126:	e9 b9 00 00 00       	jmp    8051e4 <uthread_create+0xfb>
+  } else {
+    if (nslots == MAXUTHREADS)
+  80512b:	48 b8 a0 a3 80 00 00 	movabs $0x80a3a0,%rax
+  805132:	00 00 00 
+  805135:	8b 00                	mov    (%rax),%eax
+  805137:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80513c:	75 0a                	jne    805148 <uthread_create+0x5f>
+      return -E_NO_MEM;
+  80513e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  805143:	e9 59 01 00 00       	jmp    8052a1 <uthread_create+0x1b8>
+    slot = UTHREAD_STACKS + nslots * UTHREAD_SLOT;
+  805148:	48 b8 a0 a3 80 00 00 	movabs $0x80a3a0,%rax
+  80514f:	00 00 00 
+  805152:	8b 00                	mov    (%rax),%eax
+  805154:	c1 e0 0e             	shl    $0xe,%eax
+  805157:	48 98                	cltq
+  805159:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+  80515e:	48 01 d0             	add    %rdx,%rax
+  805161:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    for (va = slot + PGSIZE; va < slot + UTHREAD_SLOT; va += PGSIZE) {
+  805165:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805169:	48 05 00 10 00 00    	add    $0x1000,%rax
+  80516f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  805173:	eb 36                	jmp    8051ab <uthread_create+0xc2>
+      if ((r = sys_page_alloc(0, (void *)va, PTE_P | PTE_U | PTE_W)) < 0)
+  805175:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805179:	ba 07 00 00 00       	mov    $0x7,%edx
+  80517e:	48 89 c6             	mov    %rax,%rsi
+  805181:	bf 00 00 00 00       	mov    $0x0,%edi
+  805186:	48 b8 57 24 80 00 00 	movabs $0x802457,%rax
+  80518d:	00 00 00 
+  805190:	ff d0                	call   *%rax
+  805192:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+  805195:	83 7d e4 00          	cmpl   $0x0,-0x1c(%rbp)
+  805199:	79 08                	jns    8051a3 <uthread_create+0xba>
+        return r;
+  80519b:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80519e:	e9 fe 00 00 00       	jmp    8052a1 <uthread_create+0x1b8>
+    for (va = slot + PGSIZE; va < slot + UTHREAD_SLOT; va += PGSIZE) {
+  8051a3:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  8051aa:	00 
+  8051ab:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051af:	48 05 00 40 00 00    	add    $0x4000,%rax
+  8051b5:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8051b9:	72 ba                	jb     805175 <uthread_create+0x8c>
+    }
+    nslots++;
+  8051bb:	48 b8 a0 a3 80 00 00 	movabs $0x80a3a0,%rax
+  8051c2:	00 00 00 
+  8051c5:	8b 00                	mov    (%rax),%eax
+  8051c7:	8d 50 01             	lea    0x1(%rax),%edx
+  8051ca:	48 b8 a0 a3 80 00 00 	movabs $0x80a3a0,%rax
+  8051d1:	00 00 00 
+  8051d4:	89 10                	mov    %edx,(%rax)
+    t = (struct UThread *)(slot + UTHREAD_SLOT) - 1;
+  8051d6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8051da:	48 05 d8 3f 00 00    	add    $0x3fd8,%rax
+  8051e0:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  t->ut_fn  = fn;
+  8051e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051e8:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8051ec:	48 89 50 10          	mov    %rdx,0x10(%rax)
+  t->ut_arg = arg;
+  8051f0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8051f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8051f8:	48 89 50 18          	mov    %rdx,0x18(%rax)
+  // Lay out the stack so that uthread_switch pops zeroed registers
+  // and returns into uthread_start as if it had been called from a
+  // 16-byte aligned stack.
+  sp    = (uintptr_t *)ROUNDDOWN((uintptr_t)t, 16) - 2;
+  8051fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805200:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  805204:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805208:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  80520c:	48 83 e8 10          	sub    $0x10,%rax
+  805210:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  sp[1] = 0;
+  805214:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805218:	48 83 c0 08          	add    $0x8,%rax
+  80521c:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  sp[0] = (uintptr_t)uthread_start;
+  805223:	48 ba af 50 80 00 00 	movabs $0x8050af,%rdx
+  80522a:	00 00 00 
+  80522d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805231:	48 89 10             	mov    %rdx,(%rax)
+  sp -= 6;
+  805234:	48 83 6d d0 30       	subq   $0x30,-0x30(%rbp)
+  memset(sp, 0, 6 * sizeof(*sp));
+  805239:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80523d:	ba 30 00 00 00       	mov    $0x30,%edx
+  805242:	be 00 00 00 00       	mov    $0x0,%esi
+  805247:	48 89 c7             	mov    %rax,%rdi
+  80524a:	48 b8 c0 1a 80 00 00 	movabs $0x801ac0,%rax
+  805251:	00 00 00 
+  805254:	ff d0                	call   *%rax
+  t->ut_rsp = (uintptr_t)sp;
+  805256:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80525a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80525e:	48 89 10             	mov    %rdx,(%rax)
+
+  ntasks++;
+  805261:	48 b8 a4 a3 80 00 00 	movabs $0x80a3a4,%rax
+  805268:	00 00 00 
+  80526b:	8b 00                	mov    (%rax),%eax
+  80526d:	8d 50 01             	lea    0x1(%rax),%edx
+  805270:	48 b8 a4 a3 80 00 00 	movabs $0x80a3a4,%rax
+  805277:	00 00 00 
+  80527a:	89 10                	mov    %edx,(%rax)
+  enqueue(&runq, t);
+  80527c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805280:	48 89 c6             	mov    %rax,%rsi
+  805283:	48 b8 50 a0 80 00 00 	movabs $0x80a050,%rax
+  80528a:	00 00 00 
+  80528d:	48 89 c7             	mov    %rax,%rdi
+  805290:	48 b8 b7 4b 80 00 00 	movabs $0x804bb7,%rax
+  805297:	00 00 00 
+  80529a:	ff d0                	call   *%rax
+  return 0;
+  80529c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8052a1:	c9                   	leave
+  8052a2:	c3                   	ret
+
+00000000008052a3 <uthread_yield>:
+
+// Let the other runnable tasks run.
+void
+uthread_yield(void) {
+  8052a3:	55                   	push   %rbp
+  8052a4:	48 89 e5             	mov    %rsp,%rbp
+  enqueue(&runq, uthread_cur);
+  8052a7:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8052ae:	00 00 00 
+  8052b1:	48 8b 00             	mov    (%rax),%rax
+  8052b4:	48 89 c6             	mov    %rax,%rsi
+  8052b7:	48 b8 50 a0 80 00 00 	movabs $0x80a050,%rax
+  8052be:	00 00 00 
+  8052c1:	48 89 c7             	mov    %rax,%rdi
+  8052c4:	48 b8 b7 4b 80 00 00 	movabs $0x804bb7,%rax
+  8052cb:	00 00 00 
+  8052ce:	ff d0                	call   *%rax
+  uthread_schedule();
+  8052d0:	48 b8 91 4f 80 00 00 	movabs $0x804f91,%rax
+  8052d7:	00 00 00 
+  8052da:	ff d0                	call   *%rax
+}
+  8052dc:	90                   	nop
+  8052dd:	5d                   	pop    %rbp
+  8052de:	c3                   	ret
+
+00000000008052df <uthread_exit>:
+
+// End the calling task.  In the env's original context, exit the env.
+void
+uthread_exit(void) {
+  8052df:	55                   	push   %rbp
+  8052e0:	48 89 e5             	mov    %rsp,%rbp
+  8052e3:	48 83 ec 10          	sub    $0x10,%rsp
+  struct UThread *t = uthread_cur;
+  8052e7:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8052ee:	00 00 00 
+  8052f1:	48 8b 00             	mov    (%rax),%rax
+  8052f4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+
+  if (t == &uthread_main)
+  8052f8:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8052ff:	00 00 00 
+  805302:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  805306:	75 0c                	jne    805314 <uthread_exit+0x35>
+    exit();
+  805308:	48 b8 96 04 80 00 00 	movabs $0x800496,%rax
+  80530f:	00 00 00 
+  805312:	ff d0                	call   *%rax
+  // The slot stays ours until we switch away from it.
+  t->ut_next = freelist;
+  805314:	48 b8 98 a3 80 00 00 	movabs $0x80a398,%rax
+  80531b:	00 00 00 
+  80531e:	48 8b 10             	mov    (%rax),%rdx
+  805321:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805325:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  freelist   = t;
+  805329:	48 ba 98 a3 80 00 00 	movabs $0x80a398,%rdx
+  805330:	00 00 00 
+  805333:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805337:	48 89 02             	mov    %rax,(%rdx)
+  if (!--ntasks && main_waiting) {
+  80533a:	48 b8 a4 a3 80 00 00 	movabs $0x80a3a4,%rax
+  805341:	00 00 00 
+  805344:	8b 00                	mov    (%rax),%eax
+  805346:	8d 50 ff             	lea    -0x1(%rax),%edx
+  805349:	48 b8 a4 a3 80 00 00 	movabs $0x80a3a4,%rax
+  805350:	00 00 00 
+  805353:	89 10                	mov    %edx,(%rax)
+  805355:	48 b8 a4 a3 80 00 00 	movabs $0x80a3a4,%rax
+  80535c:	00 00 00 
+  80535f:	8b 00                	mov    (%rax),%eax
+  805361:	85 c0                	test   %eax,%eax
+  805363:	75 44                	jne    8053a9 <uthread_exit+0xca>
+  805365:	48 b8 ac a3 80 00 00 	movabs $0x80a3ac,%rax
+  80536c:	00 00 00 
+  80536f:	0f b6 00             	movzbl (%rax),%eax
+  805372:	84 c0                	test   %al,%al
+  805374:	74 33                	je     8053a9 <uthread_exit+0xca>
+    main_waiting = 0;
+  805376:	48 b8 ac a3 80 00 00 	movabs $0x80a3ac,%rax
+  80537d:	00 00 00 
+  805380:	c6 00 00             	movb   $0x0,(%rax)
+    enqueue(&runq, &uthread_main);
+  805383:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  80538a:	00 00 00 
+  80538d:	48 89 c6             	mov    %rax,%rsi
+  805390:	48 b8 50 a0 80 00 00 	movabs $0x80a050,%rax
+  805397:	00 00 00 
+  80539a:	48 89 c7             	mov    %rax,%rdi
+  80539d:	48 b8 b7 4b 80 00 00 	movabs $0x804bb7,%rax
+  8053a4:	00 00 00 
+  8053a7:	ff d0                	call   *%rax
+  }
+  uthread_schedule();
+  8053a9:	48 b8 91 4f 80 00 00 	movabs $0x804f91,%rax
+  8053b0:	00 00 00 
+  8053b3:	ff d0                	call   *%rax
+}
+  8053b5:	90                   	nop
+  8053b6:	c9                   	leave
+  8053b7:	c3                   	ret
+
+00000000008053b8 <uthread_run>:
+
+// From the env's original context, run tasks until all have exited.
+void
+uthread_run(void) {
+  8053b8:	55                   	push   %rbp
+  8053b9:	48 89 e5             	mov    %rsp,%rbp
+  assert(uthread_cur == &uthread_main);
+  8053bc:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8053c3:	00 00 00 
+  8053c6:	48 8b 10             	mov    (%rax),%rdx
+  8053c9:	48 b8 20 a0 80 00 00 	movabs $0x80a020,%rax
+  8053d0:	00 00 00 
+  8053d3:	48 39 c2             	cmp    %rax,%rdx
+  8053d6:	74 3e                	je     805416 <uthread_run+0x5e>
+  8053d8:	48 b8 b1 65 80 00 00 	movabs $0x8065b1,%rax
+  8053df:	00 00 00 
+  8053e2:	48 89 c1             	mov    %rax,%rcx
+  8053e5:	48 b8 ce 65 80 00 00 	movabs $0x8065ce,%rax
+  8053ec:	00 00 00 
+  8053ef:	48 89 c2             	mov    %rax,%rdx
+  8053f2:	be d8 00 00 00       	mov    $0xd8,%esi
+  8053f7:	48 b8 8a 65 80 00 00 	movabs $0x80658a,%rax
+  8053fe:	00 00 00 
+  805401:	48 89 c7             	mov    %rax,%rdi
+  805404:	b8 00 00 00 00       	mov    $0x0,%eax
+  805409:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  805410:	00 00 00 
+  805413:	41 ff d0             	call   *%r8
+  if (!ntasks)
+  805416:	48 b8 a4 a3 80 00 00 	movabs $0x80a3a4,%rax
+  80541d:	00 00 00 
+  805420:	8b 00                	mov    (%rax),%eax
+  805422:	85 c0                	test   %eax,%eax
+  805424:	74 1b                	je     805441 <uthread_run+0x89>
+    return;
+  main_waiting = 1;
+  805426:	48 b8 ac a3 80 00 00 	movabs $0x80a3ac,%rax
+  80542d:	00 00 00 
+  805430:	c6 00 01             	movb   $0x1,(%rax)
+  uthread_schedule();
+  805433:	48 b8 91 4f 80 00 00 	movabs $0x804f91,%rax
+  80543a:	00 00 00 
+  80543d:	ff d0                	call   *%rax
+  80543f:	eb 01                	jmp    805442 <uthread_run+0x8a>
+    return;
+  805441:	90                   	nop
+}
+  805442:	5d                   	pop    %rbp
+  805443:	c3                   	ret
+
+0000000000805444 <uthread_wait>:
+// ready on 'fd', letting other tasks run meanwhile.  With fd
+// POLLFD_IPC and POLLIN, wait until another env tries to send us IPC;
+// tasks waiting for IPC are only woken when no task can run.
+// Returns the ready events as poll does, or < 0 on error.
+int
+uthread_wait(int fd, int events) {
+  805444:	55                   	push   %rbp
+  805445:	48 89 e5             	mov    %rsp,%rbp
+  805448:	48 83 ec 30          	sub    $0x30,%rsp
+  80544c:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  80544f:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  struct pollfd pfd = {.fd = fd, .events = events};
+  805452:	48 c7 45 ec 00 00 00 	movq   $0x0,-0x14(%rbp)
+  805459:	00 
+  80545a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  805461:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805464:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805467:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  80546a:	89 45 f0             	mov    %eax,-0x10(%rbp)
+  int q = fd == POLLFD_IPC ? IPC_WAITQ : fd;
+  80546d:	83 7d dc fe          	cmpl   $0xfffffffe,-0x24(%rbp)
+  805471:	74 05                	je     805478 <uthread_wait+0x34>
+  805473:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  805476:	eb 05                	jmp    80547d <uthread_wait+0x39>
+  805478:	b8 20 00 00 00       	mov    $0x20,%eax
+  80547d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  int r;
+
+  if (q < 0 || q > MAXFD)
+  805480:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805484:	78 06                	js     80548c <uthread_wait+0x48>
+  805486:	83 7d fc 20          	cmpl   $0x20,-0x4(%rbp)
+  80548a:	7e 0a                	jle    805496 <uthread_wait+0x52>
+    return POLLNVAL;
+  80548c:	b8 08 00 00 00       	mov    $0x8,%eax
+  805491:	e9 1b 01 00 00       	jmp    8055b1 <uthread_wait+0x16d>
+  while (1) {
+    // Another task may have consumed what woke us.
+    if (q != IPC_WAITQ && (r = poll(&pfd, 1, 0)) != 0)
+  805496:	83 7d fc 20          	cmpl   $0x20,-0x4(%rbp)
+  80549a:	74 3c                	je     8054d8 <uthread_wait+0x94>
+  80549c:	48 8d 45 ec          	lea    -0x14(%rbp),%rax
+  8054a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054a5:	be 01 00 00 00       	mov    $0x1,%esi
+  8054aa:	48 89 c7             	mov    %rax,%rdi
+  8054ad:	48 b8 bb 36 80 00 00 	movabs $0x8036bb,%rax
+  8054b4:	00 00 00 
+  8054b7:	ff d0                	call   *%rax
+  8054b9:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  8054bc:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8054c0:	74 16                	je     8054d8 <uthread_wait+0x94>
+      return r < 0 ? r : pfd.revents;
+  8054c2:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8054c6:	78 08                	js     8054d0 <uthread_wait+0x8c>
+  8054c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8054cb:	e9 e1 00 00 00       	jmp    8055b1 <uthread_wait+0x16d>
+  8054d0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8054d3:	e9 d9 00 00 00       	jmp    8055b1 <uthread_wait+0x16d>
+
+    uthread_cur->ut_events = events;
+  8054d8:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8054df:	00 00 00 
+  8054e2:	48 8b 00             	mov    (%rax),%rax
+  8054e5:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  8054e8:	89 50 20             	mov    %edx,0x20(%rax)
+    enqueue(&waitq[q], uthread_cur);
+  8054eb:	48 b8 c0 70 80 00 00 	movabs $0x8070c0,%rax
+  8054f2:	00 00 00 
+  8054f5:	48 8b 08             	mov    (%rax),%rcx
+  8054f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8054fb:	48 63 d0             	movslq %eax,%rdx
+  8054fe:	48 89 d0             	mov    %rdx,%rax
+  805501:	48 01 c0             	add    %rax,%rax
+  805504:	48 01 d0             	add    %rdx,%rax
+  805507:	48 c1 e0 03          	shl    $0x3,%rax
+  80550b:	48 ba 80 a0 80 00 00 	movabs $0x80a080,%rdx
+  805512:	00 00 00 
+  805515:	48 01 d0             	add    %rdx,%rax
+  805518:	48 89 ce             	mov    %rcx,%rsi
+  80551b:	48 89 c7             	mov    %rax,%rdi
+  80551e:	48 b8 b7 4b 80 00 00 	movabs $0x804bb7,%rax
+  805525:	00 00 00 
+  805528:	ff d0                	call   *%rax
+    waitq[q].q_events |= events;
+  80552a:	48 b9 80 a0 80 00 00 	movabs $0x80a080,%rcx
+  805531:	00 00 00 
+  805534:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805537:	48 63 d0             	movslq %eax,%rdx
+  80553a:	48 89 d0             	mov    %rdx,%rax
+  80553d:	48 01 c0             	add    %rax,%rax
+  805540:	48 01 d0             	add    %rdx,%rax
+  805543:	48 c1 e0 03          	shl    $0x3,%rax
+  805547:	48 01 c8             	add    %rcx,%rax
+  80554a:	48 83 c0 10          	add    $0x10,%rax
+  80554e:	8b 00                	mov    (%rax),%eax
+  805550:	0b 45 d8             	or     -0x28(%rbp),%eax
+  805553:	89 c1                	mov    %eax,%ecx
+  805555:	48 be 80 a0 80 00 00 	movabs $0x80a080,%rsi
+  80555c:	00 00 00 
+  80555f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805562:	48 63 d0             	movslq %eax,%rdx
+  805565:	48 89 d0             	mov    %rdx,%rax
+  805568:	48 01 c0             	add    %rax,%rax
+  80556b:	48 01 d0             	add    %rdx,%rax
+  80556e:	48 c1 e0 03          	shl    $0x3,%rax
+  805572:	48 01 f0             	add    %rsi,%rax
+  805575:	48 83 c0 10          	add    $0x10,%rax
+  805579:	89 08                	mov    %ecx,(%rax)
+    nwaiting++;
+  80557b:	48 b8 a8 a3 80 00 00 	movabs $0x80a3a8,%rax
+  805582:	00 00 00 
+  805585:	8b 00                	mov    (%rax),%eax
+  805587:	8d 50 01             	lea    0x1(%rax),%edx
+  80558a:	48 b8 a8 a3 80 00 00 	movabs $0x80a3a8,%rax
+  805591:	00 00 00 
+  805594:	89 10                	mov    %edx,(%rax)
+    uthread_schedule();
+  805596:	48 b8 91 4f 80 00 00 	movabs $0x804f91,%rax
+  80559d:	00 00 00 
+  8055a0:	ff d0                	call   *%rax
+
+    if (q == IPC_WAITQ)
+  8055a2:	83 7d fc 20          	cmpl   $0x20,-0x4(%rbp)
+  8055a6:	0f 85 ea fe ff ff    	jne    805496 <uthread_wait+0x52>
+      return POLLIN;
+  8055ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  }
+}
+  8055b1:	c9                   	leave
+  8055b2:	c3                   	ret
+
+00000000008055b3 <uthread_read>:
+
+// read() without blocking the other tasks.
+ssize_t
+uthread_read(int fd, void *buf, size_t n) {
+  8055b3:	55                   	push   %rbp
+  8055b4:	48 89 e5             	mov    %rsp,%rbp
+  8055b7:	48 83 ec 30          	sub    $0x30,%rsp
+  8055bb:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8055be:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8055c2:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int r;
+
+  if ((r = uthread_wait(fd, POLLIN)) < 0)
+  8055c6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8055ce:	89 c7                	mov    %eax,%edi
+  8055d0:	48 b8 44 54 80 00 00 	movabs $0x805444,%rax
+  8055d7:	00 00 00 
+  8055da:	ff d0                	call   *%rax
+  8055dc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8055df:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8055e3:	79 07                	jns    8055ec <uthread_read+0x39>
+    return r;
+  8055e5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8055e8:	48 98                	cltq
+  8055ea:	eb 1c                	jmp    805608 <uthread_read+0x55>
+  return read(fd, buf, n);
+  8055ec:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8055f0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8055f4:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8055f7:	48 89 ce             	mov    %rcx,%rsi
+  8055fa:	89 c7                	mov    %eax,%edi
+  8055fc:	48 b8 ca 31 80 00 00 	movabs $0x8031ca,%rax
+  805603:	00 00 00 
+  805606:	ff d0                	call   *%rax
+}
+  805608:	c9                   	leave
+  805609:	c3                   	ret
+
+000000000080560a <uthread_write>:
+
+// write() without blocking the other tasks while there is no room
+// at all.  A write bigger than the room available still blocks the
+// env until it completes.
+ssize_t
+uthread_write(int fd, const void *buf, size_t n) {
+  80560a:	55                   	push   %rbp
+  80560b:	48 89 e5             	mov    %rsp,%rbp
+  80560e:	48 83 ec 30          	sub    $0x30,%rsp
+  805612:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805615:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805619:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int r;
+
+  if ((r = uthread_wait(fd, POLLOUT)) < 0)
+  80561d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805620:	be 02 00 00 00       	mov    $0x2,%esi
+  805625:	89 c7                	mov    %eax,%edi
+  805627:	48 b8 44 54 80 00 00 	movabs $0x805444,%rax
+  80562e:	00 00 00 
+  805631:	ff d0                	call   *%rax
+  805633:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805636:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80563a:	79 07                	jns    805643 <uthread_write+0x39>
+    return r;
+  80563c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80563f:	48 98                	cltq
+  805641:	eb 1c                	jmp    80565f <uthread_write+0x55>
+  return write(fd, buf, n);
+  805643:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  805647:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  80564b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80564e:	48 89 ce             	mov    %rcx,%rsi
+  805651:	89 c7                	mov    %eax,%edi
+  805653:	48 b8 46 33 80 00 00 	movabs $0x803346,%rax
+  80565a:	00 00 00 
+  80565d:	ff d0                	call   *%rax
+}
+  80565f:	c9                   	leave
+  805660:	c3                   	ret
+
+0000000000805661 <uthread_ipc_recv>:
+
+// ipc_recv() without blocking the other tasks.
+int32_t
+uthread_ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805661:	55                   	push   %rbp
+  805662:	48 89 e5             	mov    %rsp,%rbp
+  805665:	48 83 ec 20          	sub    $0x20,%rsp
+  805669:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80566d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805671:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  uthread_wait(POLLFD_IPC, POLLIN);
+  805675:	be 01 00 00 00       	mov    $0x1,%esi
+  80567a:	bf fe ff ff ff       	mov    $0xfffffffe,%edi
+  80567f:	48 b8 44 54 80 00 00 	movabs $0x805444,%rax
+  805686:	00 00 00 
+  805689:	ff d0                	call   *%rax
+  return ipc_recv(from_env_store, pg, perm_store);
+  80568b:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80568f:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  805693:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805697:	48 89 ce             	mov    %rcx,%rsi
+  80569a:	48 89 c7             	mov    %rax,%rdi
+  80569d:	48 b8 f6 5a 80 00 00 	movabs $0x805af6,%rax
+  8056a4:	00 00 00 
+  8056a7:	ff d0                	call   *%rax
+}
+  8056a9:	c9                   	leave
+  8056aa:	c3                   	ret
+
+00000000008056ab <uthread_switch>:
+// saved by the caller under the System V calling convention.
+
+.text
+.globl uthread_switch
+uthread_switch:
+	pushq %rbp
+  8056ab:	55                   	push   %rbp
+	pushq %rbx
+  8056ac:	53                   	push   %rbx
+	pushq %r12
+  8056ad:	41 54                	push   %r12
+	pushq %r13
+  8056af:	41 55                	push   %r13
+	pushq %r14
+  8056b1:	41 56                	push   %r14
+	pushq %r15
+  8056b3:	41 57                	push   %r15
+	movq %rsp, (%rdi)
+  8056b5:	48 89 27             	mov    %rsp,(%rdi)
+	movq %rsi, %rsp
+  8056b8:	48 89 f4             	mov    %rsi,%rsp
+	popq %r15
+  8056bb:	41 5f                	pop    %r15
+	popq %r14
+  8056bd:	41 5e                	pop    %r14
+	popq %r13
+  8056bf:	41 5d                	pop    %r13
+	popq %r12
+  8056c1:	41 5c                	pop    %r12
+	popq %rbx
+  8056c3:	5b                   	pop    %rbx
+	popq %rbp
+  8056c4:	5d                   	pop    %rbp
+	ret
+  8056c5:	c3                   	ret
+
+00000000008056c6 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8056c6:	55                   	push   %rbp
+  8056c7:	48 89 e5             	mov    %rsp,%rbp
+  8056ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8056ce:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8056d1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8056d5:	75 10                	jne    8056e7 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8056d7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8056de:	00 00 00 
+  8056e1:	8b 00                	mov    (%rax),%eax
+  8056e3:	48 98                	cltq
+  8056e5:	eb 05                	jmp    8056ec <vsyscall+0x26>
+  }
+  return 0;
+  8056e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056ec:	c9                   	leave
+  8056ed:	c3                   	ret
+
+00000000008056ee <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  8056ee:	55                   	push   %rbp
+  8056ef:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  8056f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056f7:	48 b8 c6 56 80 00 00 	movabs $0x8056c6,%rax
+  8056fe:	00 00 00 
+  805701:	ff d0                	call   *%rax
+}
+  805703:	5d                   	pop    %rbp
+  805704:	c3                   	ret
+
+0000000000805705 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  805705:	55                   	push   %rbp
+  805706:	48 89 e5             	mov    %rsp,%rbp
+  805709:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  80570d:	0f 31                	rdtsc
+  80570f:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  805712:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  805715:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805718:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80571b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80571f:	48 09 d0             	or     %rdx,%rax
+  805722:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  805726:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  80572a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80572e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805735:	00 00 00 
+  805738:	8b 40 08             	mov    0x8(%rax),%eax
+  80573b:	48 98                	cltq
+  80573d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  805741:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805745:	ba 00 00 00 00       	mov    $0x0,%edx
+  80574a:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80574e:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  805755:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80575e:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805762:	48 89 d0             	mov    %rdx,%rax
+  805765:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  80576c:	ba 00 00 00 00       	mov    $0x0,%edx
+  805771:	48 f7 75 f0          	divq   -0x10(%rbp)
+  805775:	48 01 c8             	add    %rcx,%rax
+}
+  805778:	c9                   	leave
+  805779:	c3                   	ret
+
+000000000080577a <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  80577a:	55                   	push   %rbp
+  80577b:	48 89 e5             	mov    %rsp,%rbp
+  80577e:	48 83 ec 20          	sub    $0x20,%rsp
+  805782:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  805785:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805788:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  80578b:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  80578f:	be 01 00 00 00       	mov    $0x1,%esi
+  805794:	48 89 c7             	mov    %rax,%rdi
+  805797:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  80579e:	00 00 00 
+  8057a1:	ff d0                	call   *%rax
+}
+  8057a3:	90                   	nop
+  8057a4:	c9                   	leave
+  8057a5:	c3                   	ret
+
+00000000008057a6 <getchar>:
+
+int
+getchar(void) {
+  8057a6:	55                   	push   %rbp
+  8057a7:	48 89 e5             	mov    %rsp,%rbp
+  8057aa:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8057ae:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8057b2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8057b7:	48 89 c6             	mov    %rax,%rsi
+  8057ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8057bf:	48 b8 ca 31 80 00 00 	movabs $0x8031ca,%rax
+  8057c6:	00 00 00 
+  8057c9:	ff d0                	call   *%rax
+  8057cb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8057ce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057d2:	79 05                	jns    8057d9 <getchar+0x33>
+    return r;
+  8057d4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8057d7:	eb 14                	jmp    8057ed <getchar+0x47>
+  if (r < 1)
+  8057d9:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8057dd:	7f 07                	jg     8057e6 <getchar+0x40>
+    return -E_EOF;
+  8057df:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8057e4:	eb 07                	jmp    8057ed <getchar+0x47>
+  return c;
+  8057e6:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  8057ea:	0f b6 c0             	movzbl %al,%eax
+}
+  8057ed:	c9                   	leave
+  8057ee:	c3                   	ret
+
+00000000008057ef <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  8057ef:	55                   	push   %rbp
+  8057f0:	48 89 e5             	mov    %rsp,%rbp
+  8057f3:	48 83 ec 20          	sub    $0x20,%rsp
+  8057f7:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8057fa:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8057fe:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805801:	48 89 d6             	mov    %rdx,%rsi
+  805804:	89 c7                	mov    %eax,%edi
+  805806:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  80580d:	00 00 00 
+  805810:	ff d0                	call   *%rax
+  805812:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805815:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805819:	79 05                	jns    805820 <iscons+0x31>
+    return r;
+  80581b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80581e:	eb 1a                	jmp    80583a <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  805820:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805824:	8b 10                	mov    (%rax),%edx
+  805826:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  80582d:	00 00 00 
+  805830:	8b 00                	mov    (%rax),%eax
+  805832:	39 c2                	cmp    %eax,%edx
+  805834:	0f 94 c0             	sete   %al
+  805837:	0f b6 c0             	movzbl %al,%eax
+}
+  80583a:	c9                   	leave
+  80583b:	c3                   	ret
+
+000000000080583c <opencons>:
+
+int
+opencons(void) {
+  80583c:	55                   	push   %rbp
+  80583d:	48 89 e5             	mov    %rsp,%rbp
+  805840:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  805844:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  805848:	48 89 c7             	mov    %rax,%rdi
+  80584b:	48 b8 8c 2b 80 00 00 	movabs $0x802b8c,%rax
+  805852:	00 00 00 
+  805855:	ff d0                	call   *%rax
+  805857:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80585a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80585e:	79 05                	jns    805865 <opencons+0x29>
+    return r;
+  805860:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805863:	eb 66                	jmp    8058cb <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  805865:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805869:	ba 07 04 00 00       	mov    $0x407,%edx
+  80586e:	48 89 c6             	mov    %rax,%rsi
+  805871:	bf 00 00 00 00       	mov    $0x0,%edi
+  805876:	48 b8 57 24 80 00 00 	movabs $0x802457,%rax
+  80587d:	00 00 00 
+  805880:	ff d0                	call   *%rax
+  805882:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805885:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805889:	79 05                	jns    805890 <opencons+0x54>
+    return r;
+  80588b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80588e:	eb 3b                	jmp    8058cb <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  805890:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805894:	48 ba e0 70 80 00 00 	movabs $0x8070e0,%rdx
+  80589b:	00 00 00 
+  80589e:	8b 12                	mov    (%rdx),%edx
+  8058a0:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8058a2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058a6:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8058ad:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058b1:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8058b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8058bc:	48 89 c7             	mov    %rax,%rdi
+  8058bf:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  8058c6:	00 00 00 
+  8058c9:	ff d0                	call   *%rax
+}
+  8058cb:	c9                   	leave
+  8058cc:	c3                   	ret
+
+00000000008058cd <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8058cd:	55                   	push   %rbp
+  8058ce:	48 89 e5             	mov    %rsp,%rbp
+  8058d1:	48 83 ec 20          	sub    $0x20,%rsp
+  8058d5:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8058d8:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8058db:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8058df:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8058e2:	48 89 d6             	mov    %rdx,%rsi
+  8058e5:	89 c7                	mov    %eax,%edi
+  8058e7:	48 b8 6e 2c 80 00 00 	movabs $0x802c6e,%rax
+  8058ee:	00 00 00 
+  8058f1:	ff d0                	call   *%rax
+  8058f3:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8058f6:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8058fa:	79 05                	jns    805901 <consmode+0x34>
+    return r;
+  8058fc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8058ff:	eb 34                	jmp    805935 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  805901:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805905:	8b 10                	mov    (%rax),%edx
+  805907:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  80590e:	00 00 00 
+  805911:	8b 00                	mov    (%rax),%eax
+  805913:	39 c2                	cmp    %eax,%edx
+  805915:	74 07                	je     80591e <consmode+0x51>
+    return -E_INVAL;
+  805917:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80591c:	eb 17                	jmp    805935 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  80591e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805922:	8b 40 0c             	mov    0xc(%rax),%eax
+  805925:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  805928:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80592c:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80592f:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  805932:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  805935:	c9                   	leave
+  805936:	c3                   	ret
+
+0000000000805937 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805937:	55                   	push   %rbp
+  805938:	48 89 e5             	mov    %rsp,%rbp
+  80593b:	48 83 ec 20          	sub    $0x20,%rsp
+  80593f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805943:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805947:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  80594b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80594f:	8b 50 0c             	mov    0xc(%rax),%edx
+  805952:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  805956:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80595a:	48 89 ce             	mov    %rcx,%rsi
+  80595d:	48 89 c7             	mov    %rax,%rdi
+  805960:	48 b8 b1 27 80 00 00 	movabs $0x8027b1,%rax
+  805967:	00 00 00 
+  80596a:	ff d0                	call   *%rax
+  80596c:	48 98                	cltq
+}
+  80596e:	c9                   	leave
+  80596f:	c3                   	ret
+
+0000000000805970 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805970:	55                   	push   %rbp
+  805971:	48 89 e5             	mov    %rsp,%rbp
+  805974:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  80597b:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805982:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  805989:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805990:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805997:	eb 74                	jmp    805a0d <devcons_write+0x9d>
+    m = n - tot;
+  805999:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  8059a0:	89 c2                	mov    %eax,%edx
+  8059a2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059a5:	29 c2                	sub    %eax,%edx
+  8059a7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  8059aa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059ad:	83 f8 7f             	cmp    $0x7f,%eax
+  8059b0:	76 07                	jbe    8059b9 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  8059b2:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  8059b9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059bc:	48 63 d0             	movslq %eax,%rdx
+  8059bf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8059c2:	48 63 c8             	movslq %eax,%rcx
+  8059c5:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  8059cc:	48 01 c1             	add    %rax,%rcx
+  8059cf:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8059d6:	48 89 ce             	mov    %rcx,%rsi
+  8059d9:	48 89 c7             	mov    %rax,%rdi
+  8059dc:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  8059e3:	00 00 00 
+  8059e6:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  8059e8:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8059eb:	48 63 d0             	movslq %eax,%rdx
+  8059ee:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  8059f5:	48 89 d6             	mov    %rdx,%rsi
+  8059f8:	48 89 c7             	mov    %rax,%rdi
+  8059fb:	48 b8 40 22 80 00 00 	movabs $0x802240,%rax
+  805a02:	00 00 00 
+  805a05:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805a07:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  805a0a:	01 45 fc             	add    %eax,-0x4(%rbp)
+  805a0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a10:	48 98                	cltq
+  805a12:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  805a19:	0f 82 7a ff ff ff    	jb     805999 <devcons_write+0x29>
+  }
+  return tot;
+  805a1f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805a22:	48 98                	cltq
+}
+  805a24:	c9                   	leave
+  805a25:	c3                   	ret
+
+0000000000805a26 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  805a26:	55                   	push   %rbp
+  805a27:	48 89 e5             	mov    %rsp,%rbp
+  805a2a:	48 83 ec 08          	sub    $0x8,%rsp
+  805a2e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  805a32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a37:	c9                   	leave
+  805a38:	c3                   	ret
+
+0000000000805a39 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805a39:	55                   	push   %rbp
+  805a3a:	48 89 e5             	mov    %rsp,%rbp
+  805a3d:	48 83 ec 10          	sub    $0x10,%rsp
+  805a41:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805a45:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  805a49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  805a4d:	48 ba e8 65 80 00 00 	movabs $0x8065e8,%rdx
+  805a54:	00 00 00 
+  805a57:	48 89 d6             	mov    %rdx,%rsi
+  805a5a:	48 89 c7             	mov    %rax,%rdi
+  805a5d:	48 b8 89 16 80 00 00 	movabs $0x801689,%rax
+  805a64:	00 00 00 
+  805a67:	ff d0                	call   *%rax
+  return 0;
+  805a69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805a6e:	c9                   	leave
+  805a6f:	c3                   	ret
+
+0000000000805a70 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  805a70:	55                   	push   %rbp
+  805a71:	48 89 e5             	mov    %rsp,%rbp
+  805a74:	48 83 ec 30          	sub    $0x30,%rsp
+  805a78:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805a7c:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805a7f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805a83:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  805a8a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805a8d:	83 e0 02             	and    $0x2,%eax
+  805a90:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805a93:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805a97:	8b 40 0c             	mov    0xc(%rax),%eax
+  805a9a:	83 f8 01             	cmp    $0x1,%eax
+  805a9d:	75 04                	jne    805aa3 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805a9f:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805aa3:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805aa6:	83 e0 01             	and    $0x1,%eax
+  805aa9:	85 c0                	test   %eax,%eax
+  805aab:	74 44                	je     805af1 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  805aad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805ab0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805ab5:	89 c2                	mov    %eax,%edx
+  805ab7:	be 00 00 00 00       	mov    $0x0,%esi
+  805abc:	bf 00 00 00 00       	mov    $0x0,%edi
+  805ac1:	48 b8 9f 28 80 00 00 	movabs $0x80289f,%rax
+  805ac8:	00 00 00 
+  805acb:	ff d0                	call   *%rax
+  805acd:	83 f8 01             	cmp    $0x1,%eax
+  805ad0:	75 06                	jne    805ad8 <devcons_poll+0x68>
+      revents |= POLLIN;
+  805ad2:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805ad6:	eb 19                	jmp    805af1 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  805ad8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805adc:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805ae2:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805ae5:	89 c2                	mov    %eax,%edx
+  805ae7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805aeb:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805af1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805af4:	c9                   	leave
+  805af5:	c3                   	ret
+
+0000000000805af6 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805af6:	55                   	push   %rbp
+  805af7:	48 89 e5             	mov    %rsp,%rbp
+  805afa:	48 83 ec 20          	sub    $0x20,%rsp
+  805afe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805b02:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805b06:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  805b0a:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805b0e:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805b12:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805b16:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  805b1d:	48 89 c7             	mov    %rax,%rdi
+  805b20:	48 b8 2e 5b 80 00 00 	movabs $0x805b2e,%rax
+  805b27:	00 00 00 
+  805b2a:	ff d0                	call   *%rax
+}
+  805b2c:	c9                   	leave
+  805b2d:	c3                   	ret
+
+0000000000805b2e <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  805b2e:	55                   	push   %rbp
+  805b2f:	48 89 e5             	mov    %rsp,%rbp
+  805b32:	48 83 ec 30          	sub    $0x30,%rsp
+  805b36:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  805b3a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  805b3e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  805b42:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805b46:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805b4b:	75 0e                	jne    805b5b <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  805b4d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b54:	00 00 00 
+  805b57:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  805b5b:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  805b60:	75 18                	jne    805b7a <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  805b62:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b66:	48 89 c7             	mov    %rax,%rdi
+  805b69:	48 b8 97 26 80 00 00 	movabs $0x802697,%rax
+  805b70:	00 00 00 
+  805b73:	ff d0                	call   *%rax
+  805b75:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805b78:	eb 1d                	jmp    805b97 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  805b7a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805b7e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805b82:	48 89 d6             	mov    %rdx,%rsi
+  805b85:	48 89 c7             	mov    %rax,%rdi
+  805b88:	48 b8 dd 26 80 00 00 	movabs $0x8026dd,%rax
+  805b8f:	00 00 00 
+  805b92:	ff d0                	call   *%rax
+  805b94:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805b97:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805b9b:	79 2a                	jns    805bc7 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  805b9d:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805ba2:	74 0a                	je     805bae <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805ba4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805ba8:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805bae:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805bb3:	74 0a                	je     805bbf <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805bb5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805bb9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805bbf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805bc2:	e9 aa 00 00 00       	jmp    805c71 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805bc7:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805bcc:	74 36                	je     805c04 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805bce:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805bd5:	00 00 00 
+  805bd8:	8b 40 04             	mov    0x4(%rax),%eax
+  805bdb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805be0:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805be7:	00 00 00 
+  805bea:	48 98                	cltq
+  805bec:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805bf3:	48 01 d0             	add    %rdx,%rax
+  805bf6:	48 05 24 01 00 00    	add    $0x124,%rax
+  805bfc:	8b 10                	mov    (%rax),%edx
+  805bfe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805c02:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805c04:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805c09:	74 36                	je     805c41 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  805c0b:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805c12:	00 00 00 
+  805c15:	8b 40 04             	mov    0x4(%rax),%eax
+  805c18:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805c1d:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c24:	00 00 00 
+  805c27:	48 98                	cltq
+  805c29:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c30:	48 01 d0             	add    %rdx,%rax
+  805c33:	48 05 28 01 00 00    	add    $0x128,%rax
+  805c39:	8b 10                	mov    (%rax),%edx
+  805c3b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  805c3f:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  805c41:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805c48:	00 00 00 
+  805c4b:	8b 40 04             	mov    0x4(%rax),%eax
+  805c4e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805c53:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805c5a:	00 00 00 
+  805c5d:	48 98                	cltq
+  805c5f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805c66:	48 01 d0             	add    %rdx,%rax
+  805c69:	48 05 20 01 00 00    	add    $0x120,%rax
+  805c6f:	8b 00                	mov    (%rax),%eax
+  }
+}
+  805c71:	c9                   	leave
+  805c72:	c3                   	ret
+
+0000000000805c73 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  805c73:	55                   	push   %rbp
+  805c74:	48 89 e5             	mov    %rsp,%rbp
+  805c77:	48 83 ec 30          	sub    $0x30,%rsp
+  805c7b:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805c7e:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805c81:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805c85:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  805c88:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  805c8d:	75 5e                	jne    805ced <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805c8f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805c96:	00 00 00 
+  805c99:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805c9d:	eb 4e                	jmp    805ced <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805c9f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805ca3:	79 3c                	jns    805ce1 <ipc_send+0x6e>
+  805ca5:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  805ca9:	74 36                	je     805ce1 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  805cab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805cae:	89 c1                	mov    %eax,%ecx
+  805cb0:	48 b8 f0 65 80 00 00 	movabs $0x8065f0,%rax
+  805cb7:	00 00 00 
+  805cba:	48 89 c2             	mov    %rax,%rdx
+  805cbd:	be 54 00 00 00       	mov    $0x54,%esi
+  805cc2:	48 b8 16 66 80 00 00 	movabs $0x806616,%rax
+  805cc9:	00 00 00 
+  805ccc:	48 89 c7             	mov    %rax,%rdi
+  805ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  805cd4:	49 b8 ba 04 80 00 00 	movabs $0x8004ba,%r8
+  805cdb:	00 00 00 
+  805cde:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805ce1:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  805ce8:	00 00 00 
+  805ceb:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  805ced:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805cf0:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805cf3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805cf7:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  805cfa:	89 c7                	mov    %eax,%edi
+  805cfc:	48 b8 40 26 80 00 00 	movabs $0x802640,%rax
+  805d03:	00 00 00 
+  805d06:	ff d0                	call   *%rax
+  805d08:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  805d0b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805d0f:	75 8e                	jne    805c9f <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805d11:	48 b8 1a 24 80 00 00 	movabs $0x80241a,%rax
+  805d18:	00 00 00 
+  805d1b:	ff d0                	call   *%rax
+}
+  805d1d:	90                   	nop
+  805d1e:	c9                   	leave
+  805d1f:	c3                   	ret
+
+0000000000805d20 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  805d20:	55                   	push   %rbp
+  805d21:	48 89 e5             	mov    %rsp,%rbp
+  805d24:	48 83 ec 18          	sub    $0x18,%rsp
+  805d28:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  805d2b:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805d32:	eb 4d                	jmp    805d81 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  805d34:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d3b:	00 00 00 
+  805d3e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d41:	48 98                	cltq
+  805d43:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d4a:	48 01 d0             	add    %rdx,%rax
+  805d4d:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  805d53:	8b 00                	mov    (%rax),%eax
+  805d55:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  805d58:	75 23                	jne    805d7d <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  805d5a:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805d61:	00 00 00 
+  805d64:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805d67:	48 98                	cltq
+  805d69:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805d70:	48 01 d0             	add    %rdx,%rax
+  805d73:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  805d79:	8b 00                	mov    (%rax),%eax
+  805d7b:	eb 12                	jmp    805d8f <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  805d7d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805d81:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  805d88:	7e aa                	jle    805d34 <ipc_find_env+0x14>
+  return 0;
+  805d8a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805d8f:	c9                   	leave
+  805d90:	c3                   	ret
+
+0000000000805d91 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805d91:	55                   	push   %rbp
+  805d92:	48 89 e5             	mov    %rsp,%rbp
+  805d95:	48 83 ec 18          	sub    $0x18,%rsp
+  805d99:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  805d9d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805da1:	48 c1 e8 27          	shr    $0x27,%rax
+  805da5:	25 ff 01 00 00       	and    $0x1ff,%eax
+  805daa:	48 89 c2             	mov    %rax,%rdx
+  805dad:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805db4:	01 00 00 
+  805db7:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dbb:	83 e0 01             	and    $0x1,%eax
+  805dbe:	48 85 c0             	test   %rax,%rax
+  805dc1:	74 63                	je     805e26 <pageref+0x95>
+  805dc3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805dc7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805dcb:	48 89 c2             	mov    %rax,%rdx
+  805dce:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805dd5:	01 00 00 
+  805dd8:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805ddc:	83 e0 01             	and    $0x1,%eax
+  805ddf:	48 85 c0             	test   %rax,%rax
+  805de2:	74 42                	je     805e26 <pageref+0x95>
+  805de4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805de8:	48 c1 e8 15          	shr    $0x15,%rax
+  805dec:	48 89 c2             	mov    %rax,%rdx
+  805def:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805df6:	01 00 00 
+  805df9:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805dfd:	83 e0 01             	and    $0x1,%eax
+  805e00:	48 85 c0             	test   %rax,%rax
+  805e03:	74 21                	je     805e26 <pageref+0x95>
+  805e05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e09:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e0d:	48 89 c2             	mov    %rax,%rdx
+  805e10:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805e17:	01 00 00 
+  805e1a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e1e:	83 e0 01             	and    $0x1,%eax
+  805e21:	48 85 c0             	test   %rax,%rax
+  805e24:	75 07                	jne    805e2d <pageref+0x9c>
+    return 0;
+  805e26:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e2b:	eb 53                	jmp    805e80 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805e2d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805e31:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e35:	48 89 c2             	mov    %rax,%rdx
+  805e38:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805e3f:	01 00 00 
+  805e42:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805e46:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  805e4a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e4e:	83 e0 01             	and    $0x1,%eax
+  805e51:	48 85 c0             	test   %rax,%rax
+  805e54:	75 07                	jne    805e5d <pageref+0xcc>
+    return 0;
+  805e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e5b:	eb 23                	jmp    805e80 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805e5d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805e61:	48 c1 e8 0c          	shr    $0xc,%rax
+  805e65:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  805e6c:	00 00 00 
+  805e6f:	48 c1 e0 04          	shl    $0x4,%rax
+  805e73:	48 01 d0             	add    %rdx,%rax
+  805e76:	48 83 c0 08          	add    $0x8,%rax
+  805e7a:	0f b7 00             	movzwl (%rax),%eax
+  805e7d:	0f b7 c0             	movzwl %ax,%eax
+}
+  805e80:	c9                   	leave
+  805e81:	c3                   	ret
+  805e82:	66 90                	xchg   %ax,%ax
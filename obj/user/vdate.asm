@@ -0,0 +1,8401 @@
+
+obj/user/vdate:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 78 05 00 00       	call   8005a4 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <mktime>:
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80003d:	89 bd 7c ff ff ff    	mov    %edi,-0x84(%rbp)
+  800043:	48 89 b5 70 ff ff ff 	mov    %rsi,-0x90(%rbp)
+  80004a:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  800050:	48 63 d0             	movslq %eax,%rdx
+  800053:	48 69 d2 c1 40 fa 10 	imul   $0x10fa40c1,%rdx,%rdx
+  80005a:	48 c1 ea 20          	shr    $0x20,%rdx
+  80005e:	c1 fa 15             	sar    $0x15,%edx
+  800061:	c1 f8 1f             	sar    $0x1f,%eax
+  800064:	29 c2                	sub    %eax,%edx
+  800066:	8d 82 b2 07 00 00    	lea    0x7b2(%rdx),%eax
+  80006c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80006f:	eb 04                	jmp    800075 <mktime+0x43>
+  800071:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  800075:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800078:	83 c0 01             	add    $0x1,%eax
+  80007b:	69 d0 6d 01 00 00    	imul   $0x16d,%eax,%edx
+  800081:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800084:	8d 48 03             	lea    0x3(%rax),%ecx
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 48 c1             	cmovs  %ecx,%eax
+  80008c:	c1 f8 02             	sar    $0x2,%eax
+  80008f:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  800092:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800095:	48 63 d0             	movslq %eax,%rdx
+  800098:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80009f:	48 c1 ea 20          	shr    $0x20,%rdx
+  8000a3:	c1 fa 05             	sar    $0x5,%edx
+  8000a6:	c1 f8 1f             	sar    $0x1f,%eax
+  8000a9:	29 d0                	sub    %edx,%eax
+  8000ab:	01 c1                	add    %eax,%ecx
+  8000ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000b0:	48 63 d0             	movslq %eax,%rdx
+  8000b3:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  8000ba:	48 c1 ea 20          	shr    $0x20,%rdx
+  8000be:	c1 fa 07             	sar    $0x7,%edx
+  8000c1:	c1 f8 1f             	sar    $0x1f,%eax
+  8000c4:	29 c2                	sub    %eax,%edx
+  8000c6:	8d 04 11             	lea    (%rcx,%rdx,1),%eax
+  8000c9:	2d a6 fa 0a 00       	sub    $0xafaa6,%eax
+  8000ce:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  8000d4:	39 85 7c ff ff ff    	cmp    %eax,-0x84(%rbp)
+  8000da:	7d 95                	jge    800071 <mktime+0x3f>
+  8000dc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000df:	8d 90 94 f8 ff ff    	lea    -0x76c(%rax),%edx
+  8000e5:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8000ec:	89 50 14             	mov    %edx,0x14(%rax)
+  8000ef:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000f2:	69 d0 6d 01 00 00    	imul   $0x16d,%eax,%edx
+  8000f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8000fb:	83 e8 01             	sub    $0x1,%eax
+  8000fe:	8d 48 03             	lea    0x3(%rax),%ecx
+  800101:	85 c0                	test   %eax,%eax
+  800103:	0f 48 c1             	cmovs  %ecx,%eax
+  800106:	c1 f8 02             	sar    $0x2,%eax
+  800109:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  80010c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80010f:	83 e8 01             	sub    $0x1,%eax
+  800112:	48 63 d0             	movslq %eax,%rdx
+  800115:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80011c:	48 c1 ea 20          	shr    $0x20,%rdx
+  800120:	c1 fa 05             	sar    $0x5,%edx
+  800123:	c1 f8 1f             	sar    $0x1f,%eax
+  800126:	29 d0                	sub    %edx,%eax
+  800128:	01 c1                	add    %eax,%ecx
+  80012a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80012d:	83 e8 01             	sub    $0x1,%eax
+  800130:	48 63 d0             	movslq %eax,%rdx
+  800133:	48 69 d2 1f 85 eb 51 	imul   $0x51eb851f,%rdx,%rdx
+  80013a:	48 c1 ea 20          	shr    $0x20,%rdx
+  80013e:	c1 fa 07             	sar    $0x7,%edx
+  800141:	c1 f8 1f             	sar    $0x1f,%eax
+  800144:	29 c2                	sub    %eax,%edx
+  800146:	8d 04 11             	lea    (%rcx,%rdx,1),%eax
+  800149:	2d a7 fa 0a 00       	sub    $0xafaa7,%eax
+  80014e:	69 c0 80 ae fe ff    	imul   $0xfffeae80,%eax,%eax
+  800154:	01 85 7c ff ff ff    	add    %eax,-0x84(%rbp)
+  80015a:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  800160:	48 63 d0             	movslq %eax,%rdx
+  800163:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  80016a:	48 c1 ea 20          	shr    $0x20,%rdx
+  80016e:	01 c2                	add    %eax,%edx
+  800170:	89 d1                	mov    %edx,%ecx
+  800172:	c1 f9 15             	sar    $0x15,%ecx
+  800175:	99                   	cltd
+  800176:	89 c8                	mov    %ecx,%eax
+  800178:	29 d0                	sub    %edx,%eax
+  80017a:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  80017d:	eb 04                	jmp    800183 <mktime+0x151>
+  80017f:	83 45 f8 01          	addl   $0x1,-0x8(%rbp)
+  800183:	c7 45 80 00 00 00 00 	movl   $0x0,-0x80(%rbp)
+  80018a:	c7 45 84 1f 00 00 00 	movl   $0x1f,-0x7c(%rbp)
+  800191:	c7 45 88 3b 00 00 00 	movl   $0x3b,-0x78(%rbp)
+  800198:	c7 45 8c 5a 00 00 00 	movl   $0x5a,-0x74(%rbp)
+  80019f:	c7 45 90 78 00 00 00 	movl   $0x78,-0x70(%rbp)
+  8001a6:	c7 45 94 97 00 00 00 	movl   $0x97,-0x6c(%rbp)
+  8001ad:	c7 45 98 b5 00 00 00 	movl   $0xb5,-0x68(%rbp)
+  8001b4:	c7 45 9c d4 00 00 00 	movl   $0xd4,-0x64(%rbp)
+  8001bb:	c7 45 a0 f3 00 00 00 	movl   $0xf3,-0x60(%rbp)
+  8001c2:	c7 45 a4 11 01 00 00 	movl   $0x111,-0x5c(%rbp)
+  8001c9:	c7 45 a8 30 01 00 00 	movl   $0x130,-0x58(%rbp)
+  8001d0:	c7 45 ac 4e 01 00 00 	movl   $0x14e,-0x54(%rbp)
+  8001d7:	c7 45 b0 6d 01 00 00 	movl   $0x16d,-0x50(%rbp)
+  8001de:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8001e1:	83 c0 01             	add    $0x1,%eax
+  8001e4:	48 98                	cltq
+  8001e6:	8b 74 85 80          	mov    -0x80(%rbp,%rax,4),%esi
+  8001ea:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8001ed:	48 63 c2             	movslq %edx,%rax
+  8001f0:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  8001f7:	48 c1 e8 20          	shr    $0x20,%rax
+  8001fb:	c1 f8 07             	sar    $0x7,%eax
+  8001fe:	89 d1                	mov    %edx,%ecx
+  800200:	c1 f9 1f             	sar    $0x1f,%ecx
+  800203:	29 c8                	sub    %ecx,%eax
+  800205:	69 c8 90 01 00 00    	imul   $0x190,%eax,%ecx
+  80020b:	89 d0                	mov    %edx,%eax
+  80020d:	29 c8                	sub    %ecx,%eax
+  80020f:	85 c0                	test   %eax,%eax
+  800211:	74 30                	je     800243 <mktime+0x211>
+  800213:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800216:	83 e0 03             	and    $0x3,%eax
+  800219:	85 c0                	test   %eax,%eax
+  80021b:	75 33                	jne    800250 <mktime+0x21e>
+  80021d:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800220:	48 63 c2             	movslq %edx,%rax
+  800223:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  80022a:	48 c1 e8 20          	shr    $0x20,%rax
+  80022e:	c1 f8 05             	sar    $0x5,%eax
+  800231:	89 d1                	mov    %edx,%ecx
+  800233:	c1 f9 1f             	sar    $0x1f,%ecx
+  800236:	29 c8                	sub    %ecx,%eax
+  800238:	6b c8 64             	imul   $0x64,%eax,%ecx
+  80023b:	89 d0                	mov    %edx,%eax
+  80023d:	29 c8                	sub    %ecx,%eax
+  80023f:	85 c0                	test   %eax,%eax
+  800241:	74 0d                	je     800250 <mktime+0x21e>
+  800243:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  800247:	7e 07                	jle    800250 <mktime+0x21e>
+  800249:	b8 01 00 00 00       	mov    $0x1,%eax
+  80024e:	eb 05                	jmp    800255 <mktime+0x223>
+  800250:	b8 00 00 00 00       	mov    $0x0,%eax
+  800255:	01 f0                	add    %esi,%eax
+  800257:	83 c0 01             	add    $0x1,%eax
+  80025a:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800260:	39 85 7c ff ff ff    	cmp    %eax,-0x84(%rbp)
+  800266:	0f 8d 13 ff ff ff    	jge    80017f <mktime+0x14d>
+  80026c:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  800273:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800276:	89 50 10             	mov    %edx,0x10(%rax)
+  800279:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%rbp)
+  800280:	c7 45 c4 1f 00 00 00 	movl   $0x1f,-0x3c(%rbp)
+  800287:	c7 45 c8 3b 00 00 00 	movl   $0x3b,-0x38(%rbp)
+  80028e:	c7 45 cc 5a 00 00 00 	movl   $0x5a,-0x34(%rbp)
+  800295:	c7 45 d0 78 00 00 00 	movl   $0x78,-0x30(%rbp)
+  80029c:	c7 45 d4 97 00 00 00 	movl   $0x97,-0x2c(%rbp)
+  8002a3:	c7 45 d8 b5 00 00 00 	movl   $0xb5,-0x28(%rbp)
+  8002aa:	c7 45 dc d4 00 00 00 	movl   $0xd4,-0x24(%rbp)
+  8002b1:	c7 45 e0 f3 00 00 00 	movl   $0xf3,-0x20(%rbp)
+  8002b8:	c7 45 e4 11 01 00 00 	movl   $0x111,-0x1c(%rbp)
+  8002bf:	c7 45 e8 30 01 00 00 	movl   $0x130,-0x18(%rbp)
+  8002c6:	c7 45 ec 4e 01 00 00 	movl   $0x14e,-0x14(%rbp)
+  8002cd:	c7 45 f0 6d 01 00 00 	movl   $0x16d,-0x10(%rbp)
+  8002d4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8002d7:	48 98                	cltq
+  8002d9:	8b 74 85 c0          	mov    -0x40(%rbp,%rax,4),%esi
+  8002dd:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8002e0:	48 63 c2             	movslq %edx,%rax
+  8002e3:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  8002ea:	48 c1 e8 20          	shr    $0x20,%rax
+  8002ee:	c1 f8 07             	sar    $0x7,%eax
+  8002f1:	89 d1                	mov    %edx,%ecx
+  8002f3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8002f6:	29 c8                	sub    %ecx,%eax
+  8002f8:	69 c8 90 01 00 00    	imul   $0x190,%eax,%ecx
+  8002fe:	89 d0                	mov    %edx,%eax
+  800300:	29 c8                	sub    %ecx,%eax
+  800302:	85 c0                	test   %eax,%eax
+  800304:	74 30                	je     800336 <mktime+0x304>
+  800306:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800309:	83 e0 03             	and    $0x3,%eax
+  80030c:	85 c0                	test   %eax,%eax
+  80030e:	75 33                	jne    800343 <mktime+0x311>
+  800310:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800313:	48 63 c2             	movslq %edx,%rax
+  800316:	48 69 c0 1f 85 eb 51 	imul   $0x51eb851f,%rax,%rax
+  80031d:	48 c1 e8 20          	shr    $0x20,%rax
+  800321:	c1 f8 05             	sar    $0x5,%eax
+  800324:	89 d1                	mov    %edx,%ecx
+  800326:	c1 f9 1f             	sar    $0x1f,%ecx
+  800329:	29 c8                	sub    %ecx,%eax
+  80032b:	6b c8 64             	imul   $0x64,%eax,%ecx
+  80032e:	89 d0                	mov    %edx,%eax
+  800330:	29 c8                	sub    %ecx,%eax
+  800332:	85 c0                	test   %eax,%eax
+  800334:	74 0d                	je     800343 <mktime+0x311>
+  800336:	83 7d f8 01          	cmpl   $0x1,-0x8(%rbp)
+  80033a:	7e 07                	jle    800343 <mktime+0x311>
+  80033c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800341:	eb 05                	jmp    800348 <mktime+0x316>
+  800343:	b8 00 00 00 00       	mov    $0x0,%eax
+  800348:	01 f0                	add    %esi,%eax
+  80034a:	69 c0 80 51 01 00    	imul   $0x15180,%eax,%eax
+  800350:	29 85 7c ff ff ff    	sub    %eax,-0x84(%rbp)
+  800356:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  80035c:	48 63 d0             	movslq %eax,%rdx
+  80035f:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  800366:	48 c1 ea 20          	shr    $0x20,%rdx
+  80036a:	01 c2                	add    %eax,%edx
+  80036c:	c1 fa 10             	sar    $0x10,%edx
+  80036f:	c1 f8 1f             	sar    $0x1f,%eax
+  800372:	29 c2                	sub    %eax,%edx
+  800374:	83 c2 01             	add    $0x1,%edx
+  800377:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  80037e:	89 50 0c             	mov    %edx,0xc(%rax)
+  800381:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  800387:	48 63 d0             	movslq %eax,%rdx
+  80038a:	48 69 d2 07 45 2e c2 	imul   $0xffffffffc22e4507,%rdx,%rdx
+  800391:	48 c1 ea 20          	shr    $0x20,%rdx
+  800395:	01 c2                	add    %eax,%edx
+  800397:	89 d1                	mov    %edx,%ecx
+  800399:	c1 f9 10             	sar    $0x10,%ecx
+  80039c:	99                   	cltd
+  80039d:	29 d1                	sub    %edx,%ecx
+  80039f:	69 d1 80 51 01 00    	imul   $0x15180,%ecx,%edx
+  8003a5:	29 d0                	sub    %edx,%eax
+  8003a7:	89 85 7c ff ff ff    	mov    %eax,-0x84(%rbp)
+  8003ad:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  8003b3:	48 63 d0             	movslq %eax,%rdx
+  8003b6:	48 69 d2 c5 b3 a2 91 	imul   $0xffffffff91a2b3c5,%rdx,%rdx
+  8003bd:	48 c1 ea 20          	shr    $0x20,%rdx
+  8003c1:	01 c2                	add    %eax,%edx
+  8003c3:	c1 fa 0b             	sar    $0xb,%edx
+  8003c6:	c1 f8 1f             	sar    $0x1f,%eax
+  8003c9:	29 c2                	sub    %eax,%edx
+  8003cb:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  8003d2:	89 50 08             	mov    %edx,0x8(%rax)
+  8003d5:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  8003db:	48 63 d0             	movslq %eax,%rdx
+  8003de:	48 69 d2 c5 b3 a2 91 	imul   $0xffffffff91a2b3c5,%rdx,%rdx
+  8003e5:	48 c1 ea 20          	shr    $0x20,%rdx
+  8003e9:	01 c2                	add    %eax,%edx
+  8003eb:	89 d1                	mov    %edx,%ecx
+  8003ed:	c1 f9 0b             	sar    $0xb,%ecx
+  8003f0:	99                   	cltd
+  8003f1:	29 d1                	sub    %edx,%ecx
+  8003f3:	69 d1 10 0e 00 00    	imul   $0xe10,%ecx,%edx
+  8003f9:	29 d0                	sub    %edx,%eax
+  8003fb:	89 85 7c ff ff ff    	mov    %eax,-0x84(%rbp)
+  800401:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  800407:	48 63 d0             	movslq %eax,%rdx
+  80040a:	48 69 d2 89 88 88 88 	imul   $0xffffffff88888889,%rdx,%rdx
+  800411:	48 c1 ea 20          	shr    $0x20,%rdx
+  800415:	01 c2                	add    %eax,%edx
+  800417:	c1 fa 05             	sar    $0x5,%edx
+  80041a:	c1 f8 1f             	sar    $0x1f,%eax
+  80041d:	29 c2                	sub    %eax,%edx
+  80041f:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  800426:	89 50 04             	mov    %edx,0x4(%rax)
+  800429:	8b 85 7c ff ff ff    	mov    -0x84(%rbp),%eax
+  80042f:	48 63 d0             	movslq %eax,%rdx
+  800432:	48 69 d2 89 88 88 88 	imul   $0xffffffff88888889,%rdx,%rdx
+  800439:	48 c1 ea 20          	shr    $0x20,%rdx
+  80043d:	01 c2                	add    %eax,%edx
+  80043f:	89 d1                	mov    %edx,%ecx
+  800441:	c1 f9 05             	sar    $0x5,%ecx
+  800444:	99                   	cltd
+  800445:	29 d1                	sub    %edx,%ecx
+  800447:	6b d1 3c             	imul   $0x3c,%ecx,%edx
+  80044a:	29 d0                	sub    %edx,%eax
+  80044c:	89 85 7c ff ff ff    	mov    %eax,-0x84(%rbp)
+  800452:	48 8b 85 70 ff ff ff 	mov    -0x90(%rbp),%rax
+  800459:	8b 95 7c ff ff ff    	mov    -0x84(%rbp),%edx
+  80045f:	89 10                	mov    %edx,(%rax)
+  800461:	90                   	nop
+  800462:	c9                   	leave
+  800463:	c3                   	ret
+
+0000000000800464 <snprint_datetime>:
+  800464:	55                   	push   %rbp
+  800465:	48 89 e5             	mov    %rsp,%rbp
+  800468:	48 83 ec 20          	sub    $0x20,%rsp
+  80046c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800470:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  800473:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800477:	83 7d f4 13          	cmpl   $0x13,-0xc(%rbp)
+  80047b:	7f 3e                	jg     8004bb <snprint_datetime+0x57>
+  80047d:	48 b8 20 55 80 00 00 	movabs $0x805520,%rax
+  800484:	00 00 00 
+  800487:	48 89 c1             	mov    %rax,%rcx
+  80048a:	48 b8 37 55 80 00 00 	movabs $0x805537,%rax
+  800491:	00 00 00 
+  800494:	48 89 c2             	mov    %rax,%rdx
+  800497:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80049c:	48 b8 4c 55 80 00 00 	movabs $0x80554c,%rax
+  8004a3:	00 00 00 
+  8004a6:	48 89 c7             	mov    %rax,%rdi
+  8004a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ae:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  8004b5:	00 00 00 
+  8004b8:	41 ff d0             	call   *%r8
+  8004bb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004bf:	44 8b 00             	mov    (%rax),%r8d
+  8004c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004c6:	8b 78 04             	mov    0x4(%rax),%edi
+  8004c9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004cd:	8b 48 08             	mov    0x8(%rax),%ecx
+  8004d0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004d4:	44 8b 48 0c          	mov    0xc(%rax),%r9d
+  8004d8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004dc:	8b 40 10             	mov    0x10(%rax),%eax
+  8004df:	44 8d 50 01          	lea    0x1(%rax),%r10d
+  8004e3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8004e7:	8b 40 14             	mov    0x14(%rax),%eax
+  8004ea:	8d 90 6c 07 00 00    	lea    0x76c(%rax),%edx
+  8004f0:	8b 75 f4             	mov    -0xc(%rbp),%esi
+  8004f3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8004fb:	41 50                	push   %r8
+  8004fd:	57                   	push   %rdi
+  8004fe:	51                   	push   %rcx
+  8004ff:	45 89 d0             	mov    %r10d,%r8d
+  800502:	89 d1                	mov    %edx,%ecx
+  800504:	48 ba 59 55 80 00 00 	movabs $0x805559,%rdx
+  80050b:	00 00 00 
+  80050e:	48 89 c7             	mov    %rax,%rdi
+  800511:	b8 00 00 00 00       	mov    $0x0,%eax
+  800516:	49 ba 54 12 80 00 00 	movabs $0x801254,%r10
+  80051d:	00 00 00 
+  800520:	41 ff d2             	call   *%r10
+  800523:	48 83 c4 20          	add    $0x20,%rsp
+  800527:	90                   	nop
+  800528:	c9                   	leave
+  800529:	c3                   	ret
+
+000000000080052a <umain>:
+umain(int argc, char **argv) {
+  80052a:	55                   	push   %rbp
+  80052b:	48 89 e5             	mov    %rsp,%rbp
+  80052e:	48 83 ec 50          	sub    $0x50,%rsp
+  800532:	89 7d bc             	mov    %edi,-0x44(%rbp)
+  800535:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int now = vsys_gettime();
+  800539:	48 b8 70 4d 80 00 00 	movabs $0x804d70,%rax
+  800540:	00 00 00 
+  800543:	ff d0                	call   *%rax
+  800545:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  mktime(now, &tnow);
+  800548:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  80054c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80054f:	48 89 d6             	mov    %rdx,%rsi
+  800552:	89 c7                	mov    %eax,%edi
+  800554:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  80055b:	00 00 00 
+  80055e:	ff d0                	call   *%rax
+  snprint_datetime(time, 20, &tnow);
+  800560:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  800564:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800568:	be 14 00 00 00       	mov    $0x14,%esi
+  80056d:	48 89 c7             	mov    %rax,%rdi
+  800570:	48 b8 64 04 80 00 00 	movabs $0x800464,%rax
+  800577:	00 00 00 
+  80057a:	ff d0                	call   *%rax
+  cprintf("VDATE: %s\n", time);
+  80057c:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800580:	48 89 c6             	mov    %rax,%rsi
+  800583:	48 b8 77 55 80 00 00 	movabs $0x805577,%rax
+  80058a:	00 00 00 
+  80058d:	48 89 c7             	mov    %rax,%rdi
+  800590:	b8 00 00 00 00       	mov    $0x0,%eax
+  800595:	48 ba 6a 08 80 00 00 	movabs $0x80086a,%rdx
+  80059c:	00 00 00 
+  80059f:	ff d2                	call   *%rdx
+}
+  8005a1:	90                   	nop
+  8005a2:	c9                   	leave
+  8005a3:	c3                   	ret
+
+00000000008005a4 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8005a4:	55                   	push   %rbp
+  8005a5:	48 89 e5             	mov    %rsp,%rbp
+  8005a8:	48 83 ec 20          	sub    $0x20,%rsp
+  8005ac:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8005af:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  8005b3:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8005ba:	00 00 00 
+  8005bd:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8005c1:	eb 13                	jmp    8005d6 <libmain+0x32>
+    (*ctor)();
+  8005c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005c7:	48 8b 10             	mov    (%rax),%rdx
+  8005ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005cf:	ff d2                	call   *%rdx
+    ctor++;
+  8005d1:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  8005d6:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  8005dd:	00 00 00 
+  8005e0:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8005e4:	72 dd                	jb     8005c3 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8005e6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8005ea:	7e 14                	jle    800600 <libmain+0x5c>
+    binaryname = argv[0];
+  8005ec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8005f0:	48 8b 00             	mov    (%rax),%rax
+  8005f3:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8005fa:	00 00 00 
+  8005fd:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  800600:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  800604:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800607:	48 89 d6             	mov    %rdx,%rsi
+  80060a:	89 c7                	mov    %eax,%edi
+  80060c:	48 b8 2a 05 80 00 00 	movabs $0x80052a,%rax
+  800613:	00 00 00 
+  800616:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  800618:	48 b8 27 06 80 00 00 	movabs $0x800627,%rax
+  80061f:	00 00 00 
+  800622:	ff d0                	call   *%rax
+#endif
+}
+  800624:	90                   	nop
+  800625:	c9                   	leave
+  800626:	c3                   	ret
+
+0000000000800627 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800627:	55                   	push   %rbp
+  800628:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  80062b:	48 b8 bf 30 80 00 00 	movabs $0x8030bf,%rax
+  800632:	00 00 00 
+  800635:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  800637:	bf 00 00 00 00       	mov    $0x0,%edi
+  80063c:	48 b8 a0 24 80 00 00 	movabs $0x8024a0,%rax
+  800643:	00 00 00 
+  800646:	ff d0                	call   *%rax
+}
+  800648:	90                   	nop
+  800649:	5d                   	pop    %rbp
+  80064a:	c3                   	ret
+
+000000000080064b <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+  80064f:	53                   	push   %rbx
+  800650:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  800657:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  80065e:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  800664:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  80066b:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  800672:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  800679:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  800680:	84 c0                	test   %al,%al
+  800682:	74 23                	je     8006a7 <_panic+0x5c>
+  800684:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  80068b:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  80068f:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  800693:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  800697:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  80069b:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  80069f:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  8006a3:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  8006a7:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  8006ae:	00 00 00 
+  8006b1:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  8006b8:	00 00 00 
+  8006bb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006bf:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  8006c6:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  8006cd:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006d4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8006db:	00 00 00 
+  8006de:	48 8b 18             	mov    (%rax),%rbx
+  8006e1:	48 b8 6f 25 80 00 00 	movabs $0x80256f,%rax
+  8006e8:	00 00 00 
+  8006eb:	ff d0                	call   *%rax
+  8006ed:	89 c6                	mov    %eax,%esi
+  8006ef:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  8006f5:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  8006fc:	41 89 d0             	mov    %edx,%r8d
+  8006ff:	48 89 c1             	mov    %rax,%rcx
+  800702:	48 89 da             	mov    %rbx,%rdx
+  800705:	48 b8 90 55 80 00 00 	movabs $0x805590,%rax
+  80070c:	00 00 00 
+  80070f:	48 89 c7             	mov    %rax,%rdi
+  800712:	b8 00 00 00 00       	mov    $0x0,%eax
+  800717:	49 b9 6a 08 80 00 00 	movabs $0x80086a,%r9
+  80071e:	00 00 00 
+  800721:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800724:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  80072b:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  800732:	48 89 d6             	mov    %rdx,%rsi
+  800735:	48 89 c7             	mov    %rax,%rdi
+  800738:	48 b8 df 07 80 00 00 	movabs $0x8007df,%rax
+  80073f:	00 00 00 
+  800742:	ff d0                	call   *%rax
+  cprintf("\n");
+  800744:	48 b8 b3 55 80 00 00 	movabs $0x8055b3,%rax
+  80074b:	00 00 00 
+  80074e:	48 89 c7             	mov    %rax,%rdi
+  800751:	b8 00 00 00 00       	mov    $0x0,%eax
+  800756:	48 ba 6a 08 80 00 00 	movabs $0x80086a,%rdx
+  80075d:	00 00 00 
+  800760:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  800762:	cc                   	int3
+  800763:	eb fd                	jmp    800762 <_panic+0x117>
+
+0000000000800765 <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  800765:	55                   	push   %rbp
+  800766:	48 89 e5             	mov    %rsp,%rbp
+  800769:	48 83 ec 10          	sub    $0x10,%rsp
+  80076d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800770:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  800774:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800778:	8b 00                	mov    (%rax),%eax
+  80077a:	8d 48 01             	lea    0x1(%rax),%ecx
+  80077d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800781:	89 0a                	mov    %ecx,(%rdx)
+  800783:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800786:	89 d1                	mov    %edx,%ecx
+  800788:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80078c:	48 98                	cltq
+  80078e:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  800792:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800796:	8b 00                	mov    (%rax),%eax
+  800798:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80079d:	75 2c                	jne    8007cb <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  80079f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007a3:	8b 00                	mov    (%rax),%eax
+  8007a5:	48 98                	cltq
+  8007a7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8007ab:	48 83 c2 08          	add    $0x8,%rdx
+  8007af:	48 89 c6             	mov    %rax,%rsi
+  8007b2:	48 89 d7             	mov    %rdx,%rdi
+  8007b5:	48 b8 d1 23 80 00 00 	movabs $0x8023d1,%rax
+  8007bc:	00 00 00 
+  8007bf:	ff d0                	call   *%rax
+    b->idx = 0;
+  8007c1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007c5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  8007cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007cf:	8b 40 04             	mov    0x4(%rax),%eax
+  8007d2:	8d 50 01             	lea    0x1(%rax),%edx
+  8007d5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8007d9:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  8007dc:	90                   	nop
+  8007dd:	c9                   	leave
+  8007de:	c3                   	ret
+
+00000000008007df <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8007df:	55                   	push   %rbp
+  8007e0:	48 89 e5             	mov    %rsp,%rbp
+  8007e3:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8007ea:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  8007f1:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  8007f8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  8007ff:	00 00 00 
+  b.cnt = 0;
+  800802:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  800809:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  80080c:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  800813:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  80081a:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  800821:	48 89 c6             	mov    %rax,%rsi
+  800824:	48 b8 65 07 80 00 00 	movabs $0x800765,%rax
+  80082b:	00 00 00 
+  80082e:	48 89 c7             	mov    %rax,%rdi
+  800831:	48 b8 c4 0b 80 00 00 	movabs $0x800bc4,%rax
+  800838:	00 00 00 
+  80083b:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  80083d:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  800843:	48 98                	cltq
+  800845:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  80084c:	48 83 c2 08          	add    $0x8,%rdx
+  800850:	48 89 c6             	mov    %rax,%rsi
+  800853:	48 89 d7             	mov    %rdx,%rdi
+  800856:	48 b8 d1 23 80 00 00 	movabs $0x8023d1,%rax
+  80085d:	00 00 00 
+  800860:	ff d0                	call   *%rax
+
+  return b.cnt;
+  800862:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800868:	c9                   	leave
+  800869:	c3                   	ret
+
+000000000080086a <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80086a:	55                   	push   %rbp
+  80086b:	48 89 e5             	mov    %rsp,%rbp
+  80086e:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  800875:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  80087c:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  800883:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  80088a:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800891:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800898:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  80089f:	84 c0                	test   %al,%al
+  8008a1:	74 20                	je     8008c3 <cprintf+0x59>
+  8008a3:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  8008a7:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  8008ab:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  8008af:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  8008b3:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8008b7:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8008bb:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8008bf:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8008c3:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  8008ca:	00 00 00 
+  8008cd:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8008d4:	00 00 00 
+  8008d7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008db:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8008e2:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8008e9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  8008f0:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  8008f7:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8008fe:	48 89 d6             	mov    %rdx,%rsi
+  800901:	48 89 c7             	mov    %rax,%rdi
+  800904:	48 b8 df 07 80 00 00 	movabs $0x8007df,%rax
+  80090b:	00 00 00 
+  80090e:	ff d0                	call   *%rax
+  800910:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  800916:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80091c:	c9                   	leave
+  80091d:	c3                   	ret
+
+000000000080091e <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  80091e:	55                   	push   %rbp
+  80091f:	48 89 e5             	mov    %rsp,%rbp
+  800922:	48 83 ec 30          	sub    $0x30,%rsp
+  800926:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80092a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80092e:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  800932:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  800935:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  800939:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  80093d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800940:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  800944:	72 54                	jb     80099a <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800946:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  800949:	8d 78 ff             	lea    -0x1(%rax),%edi
+  80094c:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  80094f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800953:	ba 00 00 00 00       	mov    $0x0,%edx
+  800958:	48 f7 f6             	div    %rsi
+  80095b:	49 89 c2             	mov    %rax,%r10
+  80095e:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  800961:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  800964:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800968:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80096c:	41 89 c9             	mov    %ecx,%r9d
+  80096f:	41 89 f8             	mov    %edi,%r8d
+  800972:	89 d1                	mov    %edx,%ecx
+  800974:	4c 89 d2             	mov    %r10,%rdx
+  800977:	48 89 c7             	mov    %rax,%rdi
+  80097a:	48 b8 1e 09 80 00 00 	movabs $0x80091e,%rax
+  800981:	00 00 00 
+  800984:	ff d0                	call   *%rax
+  800986:	eb 1c                	jmp    8009a4 <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800988:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80098c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80098f:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800993:	48 89 d6             	mov    %rdx,%rsi
+  800996:	89 c7                	mov    %eax,%edi
+  800998:	ff d1                	call   *%rcx
+    while (--width > 0)
+  80099a:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  80099e:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  8009a2:	7f e4                	jg     800988 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8009a4:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  8009a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009b0:	48 f7 f1             	div    %rcx
+  8009b3:	48 b8 f0 57 80 00 00 	movabs $0x8057f0,%rax
+  8009ba:	00 00 00 
+  8009bd:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  8009c1:	0f be c0             	movsbl %al,%eax
+  8009c4:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8009c8:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8009cc:	48 89 d6             	mov    %rdx,%rsi
+  8009cf:	89 c7                	mov    %eax,%edi
+  8009d1:	ff d1                	call   *%rcx
+}
+  8009d3:	90                   	nop
+  8009d4:	c9                   	leave
+  8009d5:	c3                   	ret
+
+00000000008009d6 <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  8009d6:	55                   	push   %rbp
+  8009d7:	48 89 e5             	mov    %rsp,%rbp
+  8009da:	48 83 ec 10          	sub    $0x10,%rsp
+  8009de:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8009e2:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  8009e5:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  8009e9:	7e 4b                	jle    800a36 <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  8009eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009ef:	8b 00                	mov    (%rax),%eax
+  8009f1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f4:	77 24                	ja     800a1a <getuint+0x44>
+  8009f6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8009fa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8009fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a02:	8b 00                	mov    (%rax),%eax
+  800a04:	89 c0                	mov    %eax,%eax
+  800a06:	48 01 d0             	add    %rdx,%rax
+  800a09:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a0d:	8b 12                	mov    (%rdx),%edx
+  800a0f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a12:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a16:	89 0a                	mov    %ecx,(%rdx)
+  800a18:	eb 14                	jmp    800a2e <getuint+0x58>
+  800a1a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a1e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a22:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a26:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a2a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a2e:	48 8b 00             	mov    (%rax),%rax
+  800a31:	e9 95 00 00 00       	jmp    800acb <getuint+0xf5>
+  else if (lflag)
+  800a36:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800a3a:	74 48                	je     800a84 <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  800a3c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a40:	8b 00                	mov    (%rax),%eax
+  800a42:	83 f8 2f             	cmp    $0x2f,%eax
+  800a45:	77 24                	ja     800a6b <getuint+0x95>
+  800a47:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a4b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a4f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a53:	8b 00                	mov    (%rax),%eax
+  800a55:	89 c0                	mov    %eax,%eax
+  800a57:	48 01 d0             	add    %rdx,%rax
+  800a5a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a5e:	8b 12                	mov    (%rdx),%edx
+  800a60:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800a63:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a67:	89 0a                	mov    %ecx,(%rdx)
+  800a69:	eb 14                	jmp    800a7f <getuint+0xa9>
+  800a6b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a6f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800a73:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800a77:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a7b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800a7f:	48 8b 00             	mov    (%rax),%rax
+  800a82:	eb 47                	jmp    800acb <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  800a84:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a88:	8b 00                	mov    (%rax),%eax
+  800a8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8d:	77 24                	ja     800ab3 <getuint+0xdd>
+  800a8f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a93:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800a97:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800a9b:	8b 00                	mov    (%rax),%eax
+  800a9d:	89 c0                	mov    %eax,%eax
+  800a9f:	48 01 d0             	add    %rdx,%rax
+  800aa2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800aa6:	8b 12                	mov    (%rdx),%edx
+  800aa8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800aab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800aaf:	89 0a                	mov    %ecx,(%rdx)
+  800ab1:	eb 14                	jmp    800ac7 <getuint+0xf1>
+  800ab3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ab7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800abb:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800abf:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ac3:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800ac7:	8b 00                	mov    (%rax),%eax
+  800ac9:	89 c0                	mov    %eax,%eax
+}
+  800acb:	c9                   	leave
+  800acc:	c3                   	ret
+
+0000000000800acd <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800acd:	55                   	push   %rbp
+  800ace:	48 89 e5             	mov    %rsp,%rbp
+  800ad1:	48 83 ec 10          	sub    $0x10,%rsp
+  800ad5:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800ad9:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800adc:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800ae0:	7e 4b                	jle    800b2d <getint+0x60>
+    return va_arg(*ap, long long);
+  800ae2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800ae6:	8b 00                	mov    (%rax),%eax
+  800ae8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aeb:	77 24                	ja     800b11 <getint+0x44>
+  800aed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800af1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800af5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800af9:	8b 00                	mov    (%rax),%eax
+  800afb:	89 c0                	mov    %eax,%eax
+  800afd:	48 01 d0             	add    %rdx,%rax
+  800b00:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b04:	8b 12                	mov    (%rdx),%edx
+  800b06:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b09:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b0d:	89 0a                	mov    %ecx,(%rdx)
+  800b0f:	eb 14                	jmp    800b25 <getint+0x58>
+  800b11:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b15:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b19:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b1d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b21:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b25:	48 8b 00             	mov    (%rax),%rax
+  800b28:	e9 95 00 00 00       	jmp    800bc2 <getint+0xf5>
+  else if (lflag)
+  800b2d:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  800b31:	74 48                	je     800b7b <getint+0xae>
+    return va_arg(*ap, long);
+  800b33:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b37:	8b 00                	mov    (%rax),%eax
+  800b39:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3c:	77 24                	ja     800b62 <getint+0x95>
+  800b3e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b42:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b4a:	8b 00                	mov    (%rax),%eax
+  800b4c:	89 c0                	mov    %eax,%eax
+  800b4e:	48 01 d0             	add    %rdx,%rax
+  800b51:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b55:	8b 12                	mov    (%rdx),%edx
+  800b57:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800b5a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b5e:	89 0a                	mov    %ecx,(%rdx)
+  800b60:	eb 14                	jmp    800b76 <getint+0xa9>
+  800b62:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b66:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800b6a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800b6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b72:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800b76:	48 8b 00             	mov    (%rax),%rax
+  800b79:	eb 47                	jmp    800bc2 <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800b7b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b7f:	8b 00                	mov    (%rax),%eax
+  800b81:	83 f8 2f             	cmp    $0x2f,%eax
+  800b84:	77 24                	ja     800baa <getint+0xdd>
+  800b86:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b8a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800b8e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800b92:	8b 00                	mov    (%rax),%eax
+  800b94:	89 c0                	mov    %eax,%eax
+  800b96:	48 01 d0             	add    %rdx,%rax
+  800b99:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800b9d:	8b 12                	mov    (%rdx),%edx
+  800b9f:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800ba2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800ba6:	89 0a                	mov    %ecx,(%rdx)
+  800ba8:	eb 14                	jmp    800bbe <getint+0xf1>
+  800baa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800bae:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800bb2:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800bb6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800bba:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800bbe:	8b 00                	mov    (%rax),%eax
+  800bc0:	48 98                	cltq
+}
+  800bc2:	c9                   	leave
+  800bc3:	c3                   	ret
+
+0000000000800bc4 <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  800bc4:	55                   	push   %rbp
+  800bc5:	48 89 e5             	mov    %rsp,%rbp
+  800bc8:	41 54                	push   %r12
+  800bca:	53                   	push   %rbx
+  800bcb:	48 83 ec 60          	sub    $0x60,%rsp
+  800bcf:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  800bd3:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  800bd7:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800bdb:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800bdf:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800be3:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800be7:	48 8b 06             	mov    (%rsi),%rax
+  800bea:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800bee:	48 89 01             	mov    %rax,(%rcx)
+  800bf1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  800bf5:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800bf9:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800bfd:	eb 17                	jmp    800c16 <vprintfmt+0x52>
+      if (ch == '\0')
+  800bff:	85 db                	test   %ebx,%ebx
+  800c01:	0f 84 bf 04 00 00    	je     8010c6 <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  800c07:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c0b:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800c0f:	48 89 c6             	mov    %rax,%rsi
+  800c12:	89 df                	mov    %ebx,%edi
+  800c14:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800c16:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c1a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c1e:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800c22:	0f b6 00             	movzbl (%rax),%eax
+  800c25:	0f b6 d8             	movzbl %al,%ebx
+  800c28:	83 fb 25             	cmp    $0x25,%ebx
+  800c2b:	75 d2                	jne    800bff <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  800c2d:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  800c31:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  800c38:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  800c3f:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  800c46:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  800c4d:	eb 04                	jmp    800c53 <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  800c4f:	90                   	nop
+  800c50:	eb 01                	jmp    800c53 <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  800c52:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  800c53:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800c57:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800c5b:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800c5f:	0f b6 00             	movzbl (%rax),%eax
+  800c62:	0f b6 d8             	movzbl %al,%ebx
+  800c65:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800c68:	83 f8 55             	cmp    $0x55,%eax
+  800c6b:	0f 87 22 04 00 00    	ja     801093 <vprintfmt+0x4cf>
+  800c71:	89 c0                	mov    %eax,%eax
+  800c73:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800c7a:	00 
+  800c7b:	48 b8 18 58 80 00 00 	movabs $0x805818,%rax
+  800c82:	00 00 00 
+  800c85:	48 01 d0             	add    %rdx,%rax
+  800c88:	48 8b 00             	mov    (%rax),%rax
+  800c8b:	ff e0                	jmp    *%rax
+        padc = '-';
+  800c8d:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800c91:	eb c0                	jmp    800c53 <vprintfmt+0x8f>
+        padc = '0';
+  800c93:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  800c97:	eb ba                	jmp    800c53 <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800c99:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800ca0:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  800ca3:	89 d0                	mov    %edx,%eax
+  800ca5:	c1 e0 02             	shl    $0x2,%eax
+  800ca8:	01 d0                	add    %edx,%eax
+  800caa:	01 c0                	add    %eax,%eax
+  800cac:	01 d8                	add    %ebx,%eax
+  800cae:	83 e8 30             	sub    $0x30,%eax
+  800cb1:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  800cb4:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800cb8:	0f b6 00             	movzbl (%rax),%eax
+  800cbb:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800cbe:	83 fb 2f             	cmp    $0x2f,%ebx
+  800cc1:	7e 60                	jle    800d23 <vprintfmt+0x15f>
+  800cc3:	83 fb 39             	cmp    $0x39,%ebx
+  800cc6:	7f 5b                	jg     800d23 <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800cc8:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800ccd:	eb d1                	jmp    800ca0 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800ccf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd2:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd5:	77 17                	ja     800cee <vprintfmt+0x12a>
+  800cd7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800cdb:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800cde:	89 d2                	mov    %edx,%edx
+  800ce0:	48 01 d0             	add    %rdx,%rax
+  800ce3:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800ce6:	83 c2 08             	add    $0x8,%edx
+  800ce9:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800cec:	eb 0c                	jmp    800cfa <vprintfmt+0x136>
+  800cee:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800cf2:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800cf6:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800cfa:	8b 00                	mov    (%rax),%eax
+  800cfc:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800cff:	eb 23                	jmp    800d24 <vprintfmt+0x160>
+        if (width < 0)
+  800d01:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d05:	0f 89 44 ff ff ff    	jns    800c4f <vprintfmt+0x8b>
+          width = 0;
+  800d0b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  800d12:	e9 38 ff ff ff       	jmp    800c4f <vprintfmt+0x8b>
+        altflag = 1;
+  800d17:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  800d1e:	e9 30 ff ff ff       	jmp    800c53 <vprintfmt+0x8f>
+        goto process_precision;
+  800d23:	90                   	nop
+        if (width < 0)
+  800d24:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800d28:	0f 89 24 ff ff ff    	jns    800c52 <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  800d2e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800d31:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800d34:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  800d3b:	e9 12 ff ff ff       	jmp    800c52 <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  800d40:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  800d44:	e9 0a ff ff ff       	jmp    800c53 <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  800d49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d4f:	77 17                	ja     800d68 <vprintfmt+0x1a4>
+  800d51:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d55:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d58:	89 d2                	mov    %edx,%edx
+  800d5a:	48 01 d0             	add    %rdx,%rax
+  800d5d:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d60:	83 c2 08             	add    $0x8,%edx
+  800d63:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800d66:	eb 0c                	jmp    800d74 <vprintfmt+0x1b0>
+  800d68:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800d6c:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800d70:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800d74:	8b 00                	mov    (%rax),%eax
+  800d76:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800d7a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800d7e:	48 89 d6             	mov    %rdx,%rsi
+  800d81:	89 c7                	mov    %eax,%edi
+  800d83:	ff d1                	call   *%rcx
+        break;
+  800d85:	e9 37 03 00 00       	jmp    8010c1 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800d8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d90:	77 17                	ja     800da9 <vprintfmt+0x1e5>
+  800d92:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d96:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800d99:	89 d2                	mov    %edx,%edx
+  800d9b:	48 01 d0             	add    %rdx,%rax
+  800d9e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800da1:	83 c2 08             	add    $0x8,%edx
+  800da4:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800da7:	eb 0c                	jmp    800db5 <vprintfmt+0x1f1>
+  800da9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800dad:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800db1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800db5:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  800db7:	85 db                	test   %ebx,%ebx
+  800db9:	79 02                	jns    800dbd <vprintfmt+0x1f9>
+          err = -err;
+  800dbb:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800dbd:	83 fb 15             	cmp    $0x15,%ebx
+  800dc0:	7f 16                	jg     800dd8 <vprintfmt+0x214>
+  800dc2:	48 ba 40 57 80 00 00 	movabs $0x805740,%rdx
+  800dc9:	00 00 00 
+  800dcc:	48 63 c3             	movslq %ebx,%rax
+  800dcf:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  800dd3:	4d 85 e4             	test   %r12,%r12
+  800dd6:	75 2e                	jne    800e06 <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800dd8:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800ddc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800de0:	89 d9                	mov    %ebx,%ecx
+  800de2:	48 ba 01 58 80 00 00 	movabs $0x805801,%rdx
+  800de9:	00 00 00 
+  800dec:	48 89 c7             	mov    %rax,%rdi
+  800def:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df4:	49 b8 d0 10 80 00 00 	movabs $0x8010d0,%r8
+  800dfb:	00 00 00 
+  800dfe:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800e01:	e9 bb 02 00 00       	jmp    8010c1 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  800e06:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800e0a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800e0e:	4c 89 e1             	mov    %r12,%rcx
+  800e11:	48 ba 0a 58 80 00 00 	movabs $0x80580a,%rdx
+  800e18:	00 00 00 
+  800e1b:	48 89 c7             	mov    %rax,%rdi
+  800e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e23:	49 b8 d0 10 80 00 00 	movabs $0x8010d0,%r8
+  800e2a:	00 00 00 
+  800e2d:	41 ff d0             	call   *%r8
+        break;
+  800e30:	e9 8c 02 00 00       	jmp    8010c1 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  800e35:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e38:	83 f8 2f             	cmp    $0x2f,%eax
+  800e3b:	77 17                	ja     800e54 <vprintfmt+0x290>
+  800e3d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e41:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e44:	89 d2                	mov    %edx,%edx
+  800e46:	48 01 d0             	add    %rdx,%rax
+  800e49:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800e4c:	83 c2 08             	add    $0x8,%edx
+  800e4f:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800e52:	eb 0c                	jmp    800e60 <vprintfmt+0x29c>
+  800e54:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e58:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800e5c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800e60:	4c 8b 20             	mov    (%rax),%r12
+  800e63:	4d 85 e4             	test   %r12,%r12
+  800e66:	75 0a                	jne    800e72 <vprintfmt+0x2ae>
+          p = "(null)";
+  800e68:	49 bc 0d 58 80 00 00 	movabs $0x80580d,%r12
+  800e6f:	00 00 00 
+        if (width > 0 && padc != '-')
+  800e72:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800e76:	7e 78                	jle    800ef0 <vprintfmt+0x32c>
+  800e78:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800e7c:	74 72                	je     800ef0 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800e7e:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800e81:	48 98                	cltq
+  800e83:	48 89 c6             	mov    %rax,%rsi
+  800e86:	4c 89 e7             	mov    %r12,%rdi
+  800e89:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  800e90:	00 00 00 
+  800e93:	ff d0                	call   *%rax
+  800e95:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800e98:	eb 17                	jmp    800eb1 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800e9a:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800e9e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800ea2:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800ea6:	48 89 d6             	mov    %rdx,%rsi
+  800ea9:	89 c7                	mov    %eax,%edi
+  800eab:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800ead:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800eb1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800eb5:	7f e3                	jg     800e9a <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800eb7:	eb 37                	jmp    800ef0 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800eb9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800ebd:	74 1e                	je     800edd <vprintfmt+0x319>
+  800ebf:	83 fb 1f             	cmp    $0x1f,%ebx
+  800ec2:	7e 05                	jle    800ec9 <vprintfmt+0x305>
+  800ec4:	83 fb 7e             	cmp    $0x7e,%ebx
+  800ec7:	7e 14                	jle    800edd <vprintfmt+0x319>
+            putch('?', putdat);
+  800ec9:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ecd:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ed1:	48 89 c6             	mov    %rax,%rsi
+  800ed4:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ed9:	ff d2                	call   *%rdx
+  800edb:	eb 0f                	jmp    800eec <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800edd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800ee1:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800ee5:	48 89 c6             	mov    %rax,%rsi
+  800ee8:	89 df                	mov    %ebx,%edi
+  800eea:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800eec:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800ef0:	4c 89 e0             	mov    %r12,%rax
+  800ef3:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800ef7:	0f b6 00             	movzbl (%rax),%eax
+  800efa:	0f be d8             	movsbl %al,%ebx
+  800efd:	85 db                	test   %ebx,%ebx
+  800eff:	74 28                	je     800f29 <vprintfmt+0x365>
+  800f01:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800f05:	78 b2                	js     800eb9 <vprintfmt+0x2f5>
+  800f07:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  800f0b:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  800f0f:	79 a8                	jns    800eb9 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  800f11:	eb 16                	jmp    800f29 <vprintfmt+0x365>
+          putch(' ', putdat);
+  800f13:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f17:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f1b:	48 89 c6             	mov    %rax,%rsi
+  800f1e:	bf 20 00 00 00       	mov    $0x20,%edi
+  800f23:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  800f25:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800f29:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  800f2d:	7f e4                	jg     800f13 <vprintfmt+0x34f>
+        break;
+  800f2f:	e9 8d 01 00 00       	jmp    8010c1 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  800f34:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f37:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f3b:	89 d6                	mov    %edx,%esi
+  800f3d:	48 89 c7             	mov    %rax,%rdi
+  800f40:	48 b8 cd 0a 80 00 00 	movabs $0x800acd,%rax
+  800f47:	00 00 00 
+  800f4a:	ff d0                	call   *%rax
+  800f4c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  800f50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f54:	48 85 c0             	test   %rax,%rax
+  800f57:	79 1d                	jns    800f76 <vprintfmt+0x3b2>
+          putch('-', putdat);
+  800f59:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800f5d:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800f61:	48 89 c6             	mov    %rax,%rsi
+  800f64:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800f69:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800f6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800f6f:	48 f7 d8             	neg    %rax
+  800f72:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800f76:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800f7d:	e9 d2 00 00 00       	jmp    801054 <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800f82:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800f85:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800f89:	89 d6                	mov    %edx,%esi
+  800f8b:	48 89 c7             	mov    %rax,%rdi
+  800f8e:	48 b8 d6 09 80 00 00 	movabs $0x8009d6,%rax
+  800f95:	00 00 00 
+  800f98:	ff d0                	call   *%rax
+  800f9a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800f9e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800fa5:	e9 aa 00 00 00       	jmp    801054 <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800faa:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800fad:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800fb1:	89 d6                	mov    %edx,%esi
+  800fb3:	48 89 c7             	mov    %rax,%rdi
+  800fb6:	48 b8 d6 09 80 00 00 	movabs $0x8009d6,%rax
+  800fbd:	00 00 00 
+  800fc0:	ff d0                	call   *%rax
+  800fc2:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800fc6:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800fcd:	e9 82 00 00 00       	jmp    801054 <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800fd2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800fd6:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800fda:	48 89 c6             	mov    %rax,%rsi
+  800fdd:	bf 30 00 00 00       	mov    $0x30,%edi
+  800fe2:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800fe4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800fe8:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800fec:	48 89 c6             	mov    %rax,%rsi
+  800fef:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ff4:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800ff6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ff9:	83 f8 2f             	cmp    $0x2f,%eax
+  800ffc:	77 17                	ja     801015 <vprintfmt+0x451>
+  800ffe:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801002:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  801005:	89 d2                	mov    %edx,%edx
+  801007:	48 01 d0             	add    %rdx,%rax
+  80100a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80100d:	83 c2 08             	add    $0x8,%edx
+  801010:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  801013:	eb 0c                	jmp    801021 <vprintfmt+0x45d>
+  801015:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801019:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80101d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  801021:	48 8b 00             	mov    (%rax),%rax
+  801024:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  801028:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  80102f:	eb 23                	jmp    801054 <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  801031:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  801034:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  801038:	89 d6                	mov    %edx,%esi
+  80103a:	48 89 c7             	mov    %rax,%rdi
+  80103d:	48 b8 d6 09 80 00 00 	movabs $0x8009d6,%rax
+  801044:	00 00 00 
+  801047:	ff d0                	call   *%rax
+  801049:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  80104d:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  801054:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  801059:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80105c:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  80105f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801063:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  801067:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80106b:	45 89 c1             	mov    %r8d,%r9d
+  80106e:	41 89 f8             	mov    %edi,%r8d
+  801071:	48 89 c7             	mov    %rax,%rdi
+  801074:	48 b8 1e 09 80 00 00 	movabs $0x80091e,%rax
+  80107b:	00 00 00 
+  80107e:	ff d0                	call   *%rax
+        break;
+  801080:	eb 3f                	jmp    8010c1 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  801082:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801086:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80108a:	48 89 c6             	mov    %rax,%rsi
+  80108d:	89 df                	mov    %ebx,%edi
+  80108f:	ff d2                	call   *%rdx
+        break;
+  801091:	eb 2e                	jmp    8010c1 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  801093:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801097:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80109b:	48 89 c6             	mov    %rax,%rsi
+  80109e:	bf 25 00 00 00       	mov    $0x25,%edi
+  8010a3:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  8010a5:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8010aa:	eb 05                	jmp    8010b1 <vprintfmt+0x4ed>
+  8010ac:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  8010b1:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8010b5:	48 83 e8 01          	sub    $0x1,%rax
+  8010b9:	0f b6 00             	movzbl (%rax),%eax
+  8010bc:	3c 25                	cmp    $0x25,%al
+  8010be:	75 ec                	jne    8010ac <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  8010c0:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8010c1:	e9 50 fb ff ff       	jmp    800c16 <vprintfmt+0x52>
+        return;
+  8010c6:	90                   	nop
+    }
+  }
+}
+  8010c7:	48 83 c4 60          	add    $0x60,%rsp
+  8010cb:	5b                   	pop    %rbx
+  8010cc:	41 5c                	pop    %r12
+  8010ce:	5d                   	pop    %rbp
+  8010cf:	c3                   	ret
+
+00000000008010d0 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8010d0:	55                   	push   %rbp
+  8010d1:	48 89 e5             	mov    %rsp,%rbp
+  8010d4:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  8010db:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  8010e2:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  8010e9:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  8010f0:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  8010f7:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  8010fe:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801105:	84 c0                	test   %al,%al
+  801107:	74 20                	je     801129 <printfmt+0x59>
+  801109:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80110d:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801111:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801115:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  801119:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80111d:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  801121:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  801125:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  801129:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  801130:	00 00 00 
+  801133:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  80113a:	00 00 00 
+  80113d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801141:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  801148:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  80114f:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  801156:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  80115d:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  801164:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  80116b:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801172:	48 89 c7             	mov    %rax,%rdi
+  801175:	48 b8 c4 0b 80 00 00 	movabs $0x800bc4,%rax
+  80117c:	00 00 00 
+  80117f:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  801181:	90                   	nop
+  801182:	c9                   	leave
+  801183:	c3                   	ret
+
+0000000000801184 <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  801184:	55                   	push   %rbp
+  801185:	48 89 e5             	mov    %rsp,%rbp
+  801188:	48 83 ec 10          	sub    $0x10,%rsp
+  80118c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80118f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  801193:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801197:	8b 40 10             	mov    0x10(%rax),%eax
+  80119a:	8d 50 01             	lea    0x1(%rax),%edx
+  80119d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011a1:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  8011a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011a8:	48 8b 10             	mov    (%rax),%rdx
+  8011ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011af:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8011b3:	48 39 c2             	cmp    %rax,%rdx
+  8011b6:	73 17                	jae    8011cf <sprintputch+0x4b>
+    *b->buf++ = ch;
+  8011b8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8011bc:	48 8b 00             	mov    (%rax),%rax
+  8011bf:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8011c3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8011c7:	48 89 0a             	mov    %rcx,(%rdx)
+  8011ca:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8011cd:	88 10                	mov    %dl,(%rax)
+}
+  8011cf:	90                   	nop
+  8011d0:	c9                   	leave
+  8011d1:	c3                   	ret
+
+00000000008011d2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  8011d2:	55                   	push   %rbp
+  8011d3:	48 89 e5             	mov    %rsp,%rbp
+  8011d6:	48 83 ec 40          	sub    $0x40,%rsp
+  8011da:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8011de:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8011e1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8011e5:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  8011e9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011ed:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8011f1:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8011f4:	48 98                	cltq
+  8011f6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8011fa:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8011fe:	48 01 d0             	add    %rdx,%rax
+  801201:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  801205:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  80120c:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801211:	74 06                	je     801219 <vsnprintf+0x47>
+  801213:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  801217:	7f 07                	jg     801220 <vsnprintf+0x4e>
+    return -E_INVAL;
+  801219:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80121e:	eb 32                	jmp    801252 <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  801220:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801224:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801228:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  80122c:	48 89 c6             	mov    %rax,%rsi
+  80122f:	48 b8 84 11 80 00 00 	movabs $0x801184,%rax
+  801236:	00 00 00 
+  801239:	48 89 c7             	mov    %rax,%rdi
+  80123c:	48 b8 c4 0b 80 00 00 	movabs $0x800bc4,%rax
+  801243:	00 00 00 
+  801246:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  801248:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80124c:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  80124f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  801252:	c9                   	leave
+  801253:	c3                   	ret
+
+0000000000801254 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  801254:	55                   	push   %rbp
+  801255:	48 89 e5             	mov    %rsp,%rbp
+  801258:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  80125f:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  801266:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  80126c:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  801273:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  80127a:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  801281:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  801288:	84 c0                	test   %al,%al
+  80128a:	74 20                	je     8012ac <snprintf+0x58>
+  80128c:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  801290:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  801294:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  801298:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80129c:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  8012a0:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  8012a4:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  8012a8:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8012ac:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  8012b3:	00 00 00 
+  8012b6:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  8012bd:	00 00 00 
+  8012c0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8012c4:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  8012cb:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  8012d2:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  8012d9:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  8012e0:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  8012e7:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  8012ed:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  8012f4:	48 89 c7             	mov    %rax,%rdi
+  8012f7:	48 b8 d2 11 80 00 00 	movabs $0x8011d2,%rax
+  8012fe:	00 00 00 
+  801301:	ff d0                	call   *%rax
+  801303:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  801309:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  80130f:	c9                   	leave
+  801310:	c3                   	ret
+
+0000000000801311 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  801311:	55                   	push   %rbp
+  801312:	48 89 e5             	mov    %rsp,%rbp
+  801315:	53                   	push   %rbx
+  801316:	48 83 ec 38          	sub    $0x38,%rsp
+  80131a:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  80131d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  801321:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  801325:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  801329:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  80132d:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  801330:	ba 00 00 00 00       	mov    $0x0,%edx
+  801335:	89 d1                	mov    %edx,%ecx
+  801337:	0f a2                	cpuid
+  801339:	89 de                	mov    %ebx,%esi
+  80133b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  80133e:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  801341:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  801344:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  801347:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80134c:	74 09                	je     801357 <cpuid+0x46>
+}
+  80134e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801352:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  801355:	89 10                	mov    %edx,(%rax)
+
+  801357:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80135c:	74 09                	je     801367 <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  80135e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801362:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  801365:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  801367:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80136c:	74 09                	je     801377 <cpuid+0x66>
+char *
+  80136e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801372:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  801375:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  801377:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  80137c:	74 09                	je     801387 <cpuid+0x76>
+  for (; *s; s++)
+  80137e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801382:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801385:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  801387:	90                   	nop
+  801388:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80138c:	c9                   	leave
+  80138d:	c3                   	ret
+
+000000000080138e <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  80138e:	55                   	push   %rbp
+  80138f:	48 89 e5             	mov    %rsp,%rbp
+  801392:	48 83 ec 18          	sub    $0x18,%rsp
+  801396:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  801399:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80139c:	89 c1                	mov    %eax,%ecx
+  80139e:	0f 01 d0             	xgetbv
+  8013a1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8013a4:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  8013a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8013aa:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  8013ad:	48 c1 e2 20          	shl    $0x20,%rdx
+  8013b1:	48 09 d0             	or     %rdx,%rax
+#else
+  8013b4:	c9                   	leave
+  8013b5:	c3                   	ret
+
+00000000008013b6 <string_cpu>:
+string_cpu(void) {
+  8013b6:	55                   	push   %rbp
+  8013b7:	48 89 e5             	mov    %rsp,%rbp
+  8013ba:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  8013be:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  8013c5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  8013cc:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8013d3:	00 00 00 
+  8013d6:	8b 00                	mov    (%rax),%eax
+  8013d8:	85 c0                	test   %eax,%eax
+  8013da:	78 11                	js     8013ed <string_cpu+0x37>
+    return string_features;
+  8013dc:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8013e3:	00 00 00 
+  8013e6:	8b 00                	mov    (%rax),%eax
+  8013e8:	e9 df 00 00 00       	jmp    8014cc <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  8013ed:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  8013f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801401:	48 89 c6             	mov    %rax,%rsi
+  801404:	bf 00 00 00 00       	mov    $0x0,%edi
+  801409:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  801410:	00 00 00 
+  801413:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  801415:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  801418:	83 f8 06             	cmp    $0x6,%eax
+  80141b:	76 28                	jbe    801445 <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  80141d:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  801421:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801427:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80142c:	48 89 c2             	mov    %rax,%rdx
+  80142f:	be 00 00 00 00       	mov    $0x0,%esi
+  801434:	bf 07 00 00 00       	mov    $0x7,%edi
+  801439:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  801440:	00 00 00 
+  801443:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  801445:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801448:	25 00 02 00 00       	and    $0x200,%eax
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	74 04                	je     801455 <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  801451:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  801455:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  801459:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80145f:	48 89 c1             	mov    %rax,%rcx
+  801462:	ba 00 00 00 00       	mov    $0x0,%edx
+  801467:	be 00 00 00 00       	mov    $0x0,%esi
+  80146c:	bf 01 00 00 00       	mov    $0x1,%edi
+  801471:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  801478:	00 00 00 
+  80147b:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  80147d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  801480:	83 e0 20             	and    $0x20,%eax
+  801483:	85 c0                	test   %eax,%eax
+  801485:	74 2a                	je     8014b1 <string_cpu+0xfb>
+  801487:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  80148a:	25 00 00 00 08       	and    $0x8000000,%eax
+  80148f:	85 c0                	test   %eax,%eax
+  801491:	74 1e                	je     8014b1 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  801493:	bf 00 00 00 00       	mov    $0x0,%edi
+  801498:	48 b8 8e 13 80 00 00 	movabs $0x80138e,%rax
+  80149f:	00 00 00 
+  8014a2:	ff d0                	call   *%rax
+  8014a4:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  8014a7:	48 83 f8 06          	cmp    $0x6,%rax
+  8014ab:	75 04                	jne    8014b1 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  8014ad:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  8014b1:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  8014b8:	00 00 00 
+  8014bb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8014be:	89 02                	mov    %eax,(%rdx)
+  8014c0:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  8014c7:	00 00 00 
+  8014ca:	8b 00                	mov    (%rax),%eax
+}
+  8014cc:	c9                   	leave
+  8014cd:	c3                   	ret
+
+00000000008014ce <strlen_avx2>:
+strlen_avx2(const char *s) {
+  8014ce:	55                   	push   %rbp
+  8014cf:	48 89 e5             	mov    %rsp,%rbp
+  8014d2:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  8014d6:	48 83 ec 60          	sub    $0x60,%rsp
+  8014da:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  8014df:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8014e4:	83 e0 1f             	and    $0x1f,%eax
+  8014e7:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  8014eb:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  8014ef:	48 f7 d8             	neg    %rax
+  8014f2:	48 89 c2             	mov    %rax,%rdx
+  8014f5:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  8014fa:	48 01 d0             	add    %rdx,%rax
+  8014fd:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  801502:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  801506:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  80150c:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801511:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  801515:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  80151b:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80151f:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801523:	89 c2                	mov    %eax,%edx
+  801525:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  801529:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80152e:	89 c1                	mov    %eax,%ecx
+  801530:	d3 e6                	shl    %cl,%esi
+  801532:	89 f0                	mov    %esi,%eax
+  801534:	21 d0                	and    %edx,%eax
+  801536:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80153a:	eb 21                	jmp    80155d <strlen_avx2+0x8f>
+    p += 32;
+  80153c:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  801542:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801547:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  80154b:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  801551:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  801555:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801559:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  80155d:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  801562:	74 d8                	je     80153c <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  801564:	31 c0                	xor    %eax,%eax
+  801566:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  80156c:	48 63 d0             	movslq %eax,%rdx
+  80156f:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  801574:	48 01 d0             	add    %rdx,%rax
+  801577:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  80157c:	c9                   	leave
+  80157d:	c3                   	ret
+
+000000000080157e <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  80157e:	55                   	push   %rbp
+  80157f:	48 89 e5             	mov    %rsp,%rbp
+  801582:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801586:	48 83 ec 40          	sub    $0x40,%rsp
+  80158a:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80158f:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  801594:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801599:	eb 77                	jmp    801612 <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  80159b:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015a0:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8015a4:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8015a8:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8015ad:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8015b1:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  8015b5:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8015b9:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  8015bd:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  8015c2:	74 3c                	je     801600 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  8015c4:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  8015c8:	f7 d0                	not    %eax
+  8015ca:	f3 0f bc c0          	tzcnt  %eax,%eax
+  8015ce:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  8015d2:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  8015d6:	48 63 d0             	movslq %eax,%rdx
+  8015d9:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8015de:	48 01 d0             	add    %rdx,%rax
+  8015e1:	0f b6 00             	movzbl (%rax),%eax
+  8015e4:	0f b6 c0             	movzbl %al,%eax
+  8015e7:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  8015eb:	48 63 ca             	movslq %edx,%rcx
+  8015ee:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  8015f3:	48 01 ca             	add    %rcx,%rdx
+  8015f6:	0f b6 12             	movzbl (%rdx),%edx
+  8015f9:	0f b6 d2             	movzbl %dl,%edx
+  8015fc:	29 d0                	sub    %edx,%eax
+  8015fe:	eb 6b                	jmp    80166b <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801600:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801606:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  80160c:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  801612:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801618:	77 81                	ja     80159b <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  80161a:	eb 42                	jmp    80165e <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  80161c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801621:	0f b6 10             	movzbl (%rax),%edx
+  801624:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801629:	0f b6 00             	movzbl (%rax),%eax
+  80162c:	38 c2                	cmp    %al,%dl
+  80162e:	74 1c                	je     80164c <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  801630:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801635:	0f b6 00             	movzbl (%rax),%eax
+  801638:	0f b6 c8             	movzbl %al,%ecx
+  80163b:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801640:	0f b6 00             	movzbl (%rax),%eax
+  801643:	0f b6 d0             	movzbl %al,%edx
+  801646:	89 c8                	mov    %ecx,%eax
+  801648:	29 d0                	sub    %edx,%eax
+  80164a:	eb 1f                	jmp    80166b <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  80164c:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  801652:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  801658:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  80165e:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801664:	75 b6                	jne    80161c <memcmp_avx2+0x9e>
+  return 0;
+  801666:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80166b:	c9                   	leave
+  80166c:	c3                   	ret
+
+000000000080166d <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  80166d:	55                   	push   %rbp
+  80166e:	48 89 e5             	mov    %rsp,%rbp
+  801671:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  801675:	48 83 ec 60          	sub    $0x60,%rsp
+  801679:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  80167e:	89 f0                	mov    %esi,%eax
+  801680:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  801685:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801689:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  80168e:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  801692:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  801697:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  80169d:	eb 47                	jmp    8016e6 <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  80169f:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8016a4:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  8016a8:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  8016ac:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  8016b2:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  8016b6:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  8016ba:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  8016be:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  8016c3:	74 15                	je     8016da <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  8016c5:	31 c0                	xor    %eax,%eax
+  8016c7:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  8016cd:	48 63 d0             	movslq %eax,%rdx
+  8016d0:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8016d5:	48 01 d0             	add    %rdx,%rax
+  8016d8:	eb 3d                	jmp    801717 <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  8016da:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  8016e0:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8016e6:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8016ec:	77 b1                	ja     80169f <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  8016ee:	eb 0c                	jmp    8016fc <memfind_avx2+0x8f>
+  8016f0:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8016f6:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8016fc:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  801702:	74 0e                	je     801712 <memfind_avx2+0xa5>
+  801704:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801709:	0f b6 00             	movzbl (%rax),%eax
+  80170c:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  801710:	75 de                	jne    8016f0 <memfind_avx2+0x83>
+  return s;
+  801712:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  801717:	c9                   	leave
+  801718:	c3                   	ret
+
+0000000000801719 <strlen>:
+strlen(const char *s) {
+  801719:	55                   	push   %rbp
+  80171a:	48 89 e5             	mov    %rsp,%rbp
+  80171d:	48 83 ec 40          	sub    $0x40,%rsp
+  801721:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  801725:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801729:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  80172d:	48 b8 b6 13 80 00 00 	movabs $0x8013b6,%rax
+  801734:	00 00 00 
+  801737:	ff d0                	call   *%rax
+  801739:	83 e0 02             	and    $0x2,%eax
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	74 18                	je     801758 <strlen+0x3f>
+    return strlen_avx2(s);
+  801740:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801744:	48 89 c7             	mov    %rax,%rdi
+  801747:	48 b8 ce 14 80 00 00 	movabs $0x8014ce,%rax
+  80174e:	00 00 00 
+  801751:	ff d0                	call   *%rax
+  801753:	e9 82 00 00 00       	jmp    8017da <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  801758:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80175c:	83 e0 0f             	and    $0xf,%eax
+  80175f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  801762:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801765:	48 f7 d8             	neg    %rax
+  801768:	48 89 c2             	mov    %rax,%rdx
+  80176b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80176f:	48 01 d0             	add    %rdx,%rax
+  801772:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  801776:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80177a:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80177e:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  801783:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801787:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80178b:	89 c2                	mov    %eax,%edx
+  80178d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801790:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801795:	89 c1                	mov    %eax,%ecx
+  801797:	d3 e6                	shl    %cl,%esi
+  801799:	89 f0                	mov    %esi,%eax
+  80179b:	21 d0                	and    %edx,%eax
+  80179d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017a0:	eb 1d                	jmp    8017bf <strlen+0xa6>
+    p += 16;
+  8017a2:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  8017a7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017ab:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  8017af:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  8017b4:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  8017b8:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  8017bc:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  8017bf:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8017c3:	74 dd                	je     8017a2 <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  8017c5:	31 c0                	xor    %eax,%eax
+  8017c7:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  8017cc:	48 63 d0             	movslq %eax,%rdx
+  8017cf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017d3:	48 01 d0             	add    %rdx,%rax
+  8017d6:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  8017da:	c9                   	leave
+  8017db:	c3                   	ret
+
+00000000008017dc <strnlen>:
+strnlen(const char *s, size_t size) {
+  8017dc:	55                   	push   %rbp
+  8017dd:	48 89 e5             	mov    %rsp,%rbp
+  8017e0:	48 83 ec 20          	sub    $0x20,%rsp
+  8017e4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8017e8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8017ec:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8017f3:	eb 0e                	jmp    801803 <strnlen+0x27>
+    n++;
+  8017f5:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8017f9:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  8017fe:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  801803:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801808:	74 0b                	je     801815 <strnlen+0x39>
+  80180a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80180e:	0f b6 00             	movzbl (%rax),%eax
+  801811:	84 c0                	test   %al,%al
+  801813:	75 e0                	jne    8017f5 <strnlen+0x19>
+  return n;
+  801815:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  801818:	c9                   	leave
+  801819:	c3                   	ret
+
+000000000080181a <strcpy>:
+strcpy(char *dst, const char *src) {
+  80181a:	55                   	push   %rbp
+  80181b:	48 89 e5             	mov    %rsp,%rbp
+  80181e:	48 83 ec 20          	sub    $0x20,%rsp
+  801822:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801826:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  80182a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80182e:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  801832:	90                   	nop
+  801833:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801837:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80183b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80183f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801843:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801847:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80184b:	0f b6 12             	movzbl (%rdx),%edx
+  80184e:	88 10                	mov    %dl,(%rax)
+  801850:	0f b6 00             	movzbl (%rax),%eax
+  801853:	84 c0                	test   %al,%al
+  801855:	75 dc                	jne    801833 <strcpy+0x19>
+  return ret;
+  801857:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80185b:	c9                   	leave
+  80185c:	c3                   	ret
+
+000000000080185d <strcat>:
+strcat(char *dst, const char *src) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+  801861:	48 83 ec 20          	sub    $0x20,%rsp
+  801865:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801869:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  80186d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801871:	48 89 c7             	mov    %rax,%rdi
+  801874:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  80187b:	00 00 00 
+  80187e:	ff d0                	call   *%rax
+  801880:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  801883:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801886:	48 63 d0             	movslq %eax,%rdx
+  801889:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80188d:	48 01 c2             	add    %rax,%rdx
+  801890:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801894:	48 89 c6             	mov    %rax,%rsi
+  801897:	48 89 d7             	mov    %rdx,%rdi
+  80189a:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  8018a1:	00 00 00 
+  8018a4:	ff d0                	call   *%rax
+  return dst;
+  8018a6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8018aa:	c9                   	leave
+  8018ab:	c3                   	ret
+
+00000000008018ac <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  8018ac:	55                   	push   %rbp
+  8018ad:	48 89 e5             	mov    %rsp,%rbp
+  8018b0:	48 83 ec 28          	sub    $0x28,%rsp
+  8018b4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8018b8:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8018bc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  8018c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018c4:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  8018c8:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8018cf:	00 
+  8018d0:	eb 2a                	jmp    8018fc <strncpy+0x50>
+    *dst++ = *src;
+  8018d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018d6:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8018da:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8018de:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8018e2:	0f b6 12             	movzbl (%rdx),%edx
+  8018e5:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  8018e7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8018eb:	0f b6 00             	movzbl (%rax),%eax
+  8018ee:	84 c0                	test   %al,%al
+  8018f0:	74 05                	je     8018f7 <strncpy+0x4b>
+      src++;
+  8018f2:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  8018f7:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8018fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801900:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801904:	72 cc                	jb     8018d2 <strncpy+0x26>
+  return ret;
+  801906:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+000000000080190c <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	48 83 ec 28          	sub    $0x28,%rsp
+  801914:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801918:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80191c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  801920:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801924:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  801928:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80192d:	74 3d                	je     80196c <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  80192f:	eb 1d                	jmp    80194e <strlcpy+0x42>
+      *dst++ = *src++;
+  801931:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  801935:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801939:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80193d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801941:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801945:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801949:	0f b6 12             	movzbl (%rdx),%edx
+  80194c:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  80194e:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  801953:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  801958:	74 0b                	je     801965 <strlcpy+0x59>
+  80195a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80195e:	0f b6 00             	movzbl (%rax),%eax
+  801961:	84 c0                	test   %al,%al
+  801963:	75 cc                	jne    801931 <strlcpy+0x25>
+    *dst = '\0';
+  801965:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801969:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  80196c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801970:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  801974:	c9                   	leave
+  801975:	c3                   	ret
+
+0000000000801976 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801976:	55                   	push   %rbp
+  801977:	48 89 e5             	mov    %rsp,%rbp
+  80197a:	48 83 ec 30          	sub    $0x30,%rsp
+  80197e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801982:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801986:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  80198a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80198e:	48 89 c7             	mov    %rax,%rdi
+  801991:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801998:	00 00 00 
+  80199b:	ff d0                	call   *%rax
+  80199d:	48 98                	cltq
+  80199f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  8019a3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8019a7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019ab:	48 89 d6             	mov    %rdx,%rsi
+  8019ae:	48 89 c7             	mov    %rax,%rdi
+  8019b1:	48 b8 dc 17 80 00 00 	movabs $0x8017dc,%rax
+  8019b8:	00 00 00 
+  8019bb:	ff d0                	call   *%rax
+  8019bd:	48 98                	cltq
+  8019bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  8019c3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019c7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8019cb:	75 10                	jne    8019dd <strlcat+0x67>
+    return maxlen + srclen;
+  8019cd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8019d1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019d5:	48 01 d0             	add    %rdx,%rax
+  8019d8:	e9 86 00 00 00       	jmp    801a63 <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  8019dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8019e1:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  8019e5:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  8019e9:	73 2b                	jae    801a16 <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  8019eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8019ef:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8019f3:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8019f7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019fb:	48 01 c1             	add    %rax,%rcx
+  8019fe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a02:	48 89 c6             	mov    %rax,%rsi
+  801a05:	48 89 cf             	mov    %rcx,%rdi
+  801a08:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  801a0f:	00 00 00 
+  801a12:	ff d0                	call   *%rax
+  801a14:	eb 42                	jmp    801a58 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  801a16:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a1a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a1e:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  801a22:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a26:	48 01 c1             	add    %rax,%rcx
+  801a29:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a2d:	48 89 c6             	mov    %rax,%rsi
+  801a30:	48 89 cf             	mov    %rcx,%rdi
+  801a33:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  801a3a:	00 00 00 
+  801a3d:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  801a3f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a47:	48 01 d0             	add    %rdx,%rax
+  801a4a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801a4e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801a52:	48 01 d0             	add    %rdx,%rax
+  801a55:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  801a58:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801a5c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a60:	48 01 d0             	add    %rdx,%rax
+}
+  801a63:	c9                   	leave
+  801a64:	c3                   	ret
+
+0000000000801a65 <strcmp>:
+strcmp(const char *p, const char *q) {
+  801a65:	55                   	push   %rbp
+  801a66:	48 89 e5             	mov    %rsp,%rbp
+  801a69:	48 83 ec 10          	sub    $0x10,%rsp
+  801a6d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a71:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a75:	eb 0a                	jmp    801a81 <strcmp+0x1c>
+    p++, q++;
+  801a77:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801a7c:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801a81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a85:	0f b6 00             	movzbl (%rax),%eax
+  801a88:	84 c0                	test   %al,%al
+  801a8a:	74 12                	je     801a9e <strcmp+0x39>
+  801a8c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a90:	0f b6 10             	movzbl (%rax),%edx
+  801a93:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801a97:	0f b6 00             	movzbl (%rax),%eax
+  801a9a:	38 c2                	cmp    %al,%dl
+  801a9c:	74 d9                	je     801a77 <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801a9e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801aa2:	0f b6 00             	movzbl (%rax),%eax
+  801aa5:	0f b6 d0             	movzbl %al,%edx
+  801aa8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aac:	0f b6 00             	movzbl (%rax),%eax
+  801aaf:	0f b6 c0             	movzbl %al,%eax
+  801ab2:	29 c2                	sub    %eax,%edx
+  801ab4:	89 d0                	mov    %edx,%eax
+}
+  801ab6:	c9                   	leave
+  801ab7:	c3                   	ret
+
+0000000000801ab8 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801ab8:	55                   	push   %rbp
+  801ab9:	48 89 e5             	mov    %rsp,%rbp
+  801abc:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801ac4:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801ac8:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801acc:	eb 0f                	jmp    801add <strncmp+0x25>
+    n--, p++, q++;
+  801ace:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  801ad3:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801ad8:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801add:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801ae2:	74 1d                	je     801b01 <strncmp+0x49>
+  801ae4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ae8:	0f b6 00             	movzbl (%rax),%eax
+  801aeb:	84 c0                	test   %al,%al
+  801aed:	74 12                	je     801b01 <strncmp+0x49>
+  801aef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801af3:	0f b6 10             	movzbl (%rax),%edx
+  801af6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801afa:	0f b6 00             	movzbl (%rax),%eax
+  801afd:	38 c2                	cmp    %al,%dl
+  801aff:	74 cd                	je     801ace <strncmp+0x16>
+  if (n == 0)
+  801b01:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801b06:	75 07                	jne    801b0f <strncmp+0x57>
+    return 0;
+  801b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0d:	eb 16                	jmp    801b25 <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801b0f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b13:	0f b6 00             	movzbl (%rax),%eax
+  801b16:	0f b6 d0             	movzbl %al,%edx
+  801b19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b1d:	0f b6 00             	movzbl (%rax),%eax
+  801b20:	0f b6 c0             	movzbl %al,%eax
+  801b23:	29 c2                	sub    %eax,%edx
+}
+  801b25:	89 d0                	mov    %edx,%eax
+  801b27:	c9                   	leave
+  801b28:	c3                   	ret
+
+0000000000801b29 <strchr>:
+strchr(const char *s, char c) {
+  801b29:	55                   	push   %rbp
+  801b2a:	48 89 e5             	mov    %rsp,%rbp
+  801b2d:	48 83 ec 60          	sub    $0x60,%rsp
+  801b31:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801b35:	89 f0                	mov    %esi,%eax
+  801b37:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  801b3a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801b3e:	83 e0 0f             	and    $0xf,%eax
+  801b41:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  801b44:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801b47:	48 f7 d8             	neg    %rax
+  801b4a:	48 89 c2             	mov    %rax,%rdx
+  801b4d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801b51:	48 01 d0             	add    %rdx,%rax
+  801b54:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  801b58:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  801b5c:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  801b60:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  801b64:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b68:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b6c:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b70:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b75:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801b79:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b7d:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801b81:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  801b85:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b8a:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801b8f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801b93:	89 c2                	mov    %eax,%edx
+  801b95:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801b9a:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801b9f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ba3:	09 c2                	or     %eax,%edx
+  801ba5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ba8:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801bad:	89 c1                	mov    %eax,%ecx
+  801baf:	d3 e6                	shl    %cl,%esi
+  801bb1:	89 f0                	mov    %esi,%eax
+  801bb3:	21 d0                	and    %edx,%eax
+  801bb5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801bb8:	eb 34                	jmp    801bee <strchr+0xc5>
+    p += 16;
+  801bba:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801bbf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801bc3:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801bc7:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801bcb:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801bd0:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801bd5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bd9:	89 c2                	mov    %eax,%edx
+  801bdb:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801be0:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801be5:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801be9:	09 d0                	or     %edx,%eax
+  801beb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801bee:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801bf2:	74 c6                	je     801bba <strchr+0x91>
+  p += __builtin_ctz(m);
+  801bf4:	31 c0                	xor    %eax,%eax
+  801bf6:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801bfb:	48 98                	cltq
+  801bfd:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801c01:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c05:	0f b6 00             	movzbl (%rax),%eax
+  801c08:	84 c0                	test   %al,%al
+  801c0a:	74 06                	je     801c12 <strchr+0xe9>
+  801c0c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801c10:	eb 05                	jmp    801c17 <strchr+0xee>
+  801c12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c17:	c9                   	leave
+  801c18:	c3                   	ret
+
+0000000000801c19 <strfind>:
+strfind(const char *s, char c) {
+  801c19:	55                   	push   %rbp
+  801c1a:	48 89 e5             	mov    %rsp,%rbp
+  801c1d:	48 83 ec 10          	sub    $0x10,%rsp
+  801c21:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801c25:	89 f0                	mov    %esi,%eax
+  801c27:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  801c2a:	eb 11                	jmp    801c3d <strfind+0x24>
+    if (*s == c)
+  801c2c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c30:	0f b6 00             	movzbl (%rax),%eax
+  801c33:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  801c36:	74 12                	je     801c4a <strfind+0x31>
+  for (; *s; s++)
+  801c38:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801c3d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801c41:	0f b6 00             	movzbl (%rax),%eax
+  801c44:	84 c0                	test   %al,%al
+  801c46:	75 e4                	jne    801c2c <strfind+0x13>
+  801c48:	eb 01                	jmp    801c4b <strfind+0x32>
+      break;
+  801c4a:	90                   	nop
+  return (char *)s;
+  801c4b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  801c4f:	c9                   	leave
+  801c50:	c3                   	ret
+
+0000000000801c51 <memset>:
+memset(void *v, int c, size_t n) {
+  801c51:	55                   	push   %rbp
+  801c52:	48 89 e5             	mov    %rsp,%rbp
+  801c55:	48 83 ec 38          	sub    $0x38,%rsp
+  801c59:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c5d:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  801c60:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  801c64:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c68:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801c6c:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801c71:	76 41                	jbe    801cb4 <memset+0x63>
+  801c73:	48 b8 b6 13 80 00 00 	movabs $0x8013b6,%rax
+  801c7a:	00 00 00 
+  801c7d:	ff d0                	call   *%rax
+  801c7f:	83 e0 01             	and    $0x1,%eax
+  801c82:	85 c0                	test   %eax,%eax
+  801c84:	74 2e                	je     801cb4 <memset+0x63>
+    asm volatile("cld; rep stosb"
+  801c86:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801c89:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801c8d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801c91:	48 89 ce             	mov    %rcx,%rsi
+  801c94:	48 89 f7             	mov    %rsi,%rdi
+  801c97:	48 89 d1             	mov    %rdx,%rcx
+  801c9a:	fc                   	cld
+  801c9b:	f3 aa                	rep stos %al,%es:(%rdi)
+  801c9d:	48 89 ca             	mov    %rcx,%rdx
+  801ca0:	48 89 fe             	mov    %rdi,%rsi
+  801ca3:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801ca7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801cab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801caf:	e9 a7 00 00 00       	jmp    801d5b <memset+0x10a>
+  if (n >= 8) {
+  801cb4:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801cb9:	0f 86 87 00 00 00    	jbe    801d46 <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801cbf:	eb 16                	jmp    801cd7 <memset+0x86>
+      *p++ = c;
+  801cc1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cc5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801cc9:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ccd:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801cd0:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  801cd2:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801cd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801cdb:	83 e0 07             	and    $0x7,%eax
+  801cde:	48 85 c0             	test   %rax,%rax
+  801ce1:	75 de                	jne    801cc1 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  801ce3:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801ce6:	0f b6 c0             	movzbl %al,%eax
+  801ce9:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801cf0:	01 01 01 
+  801cf3:	48 0f af c2          	imul   %rdx,%rax
+  801cf7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801cfb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801cff:	48 c1 e8 03          	shr    $0x3,%rax
+  801d03:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  801d07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801d0b:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801d0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801d13:	48 89 ce             	mov    %rcx,%rsi
+  801d16:	48 89 f7             	mov    %rsi,%rdi
+  801d19:	48 89 d1             	mov    %rdx,%rcx
+  801d1c:	fc                   	cld
+  801d1d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  801d20:	48 89 ca             	mov    %rcx,%rdx
+  801d23:	48 89 fe             	mov    %rdi,%rsi
+  801d26:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  801d2a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  801d2e:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  801d33:	eb 11                	jmp    801d46 <memset+0xf5>
+    *p++ = c;
+  801d35:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d39:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801d3d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801d41:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801d44:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  801d46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d4a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801d4e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801d52:	48 85 c0             	test   %rax,%rax
+  801d55:	75 de                	jne    801d35 <memset+0xe4>
+  return v;
+  801d57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801d5b:	c9                   	leave
+  801d5c:	c3                   	ret
+
+0000000000801d5d <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  801d5d:	55                   	push   %rbp
+  801d5e:	48 89 e5             	mov    %rsp,%rbp
+  801d61:	48 83 ec 38          	sub    $0x38,%rsp
+  801d65:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801d69:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801d6d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801d71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d75:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801d79:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d7d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801d81:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801d85:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801d89:	0f 83 da 00 00 00    	jae    801e69 <memmove+0x10c>
+  801d8f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801d93:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801d97:	48 01 d0             	add    %rdx,%rax
+  801d9a:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801d9e:	0f 83 c5 00 00 00    	jae    801e69 <memmove+0x10c>
+    s += n;
+  801da4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801da8:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801dac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801db0:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  801db4:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801db9:	0f 86 94 00 00 00    	jbe    801e53 <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801dbf:	eb 1c                	jmp    801ddd <memmove+0x80>
+        *--d = *--s;
+  801dc1:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801dc6:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801dcb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801dcf:	0f b6 10             	movzbl (%rax),%edx
+  801dd2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dd6:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801dd8:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801ddd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801de1:	83 e0 07             	and    $0x7,%eax
+  801de4:	48 85 c0             	test   %rax,%rax
+  801de7:	75 d8                	jne    801dc1 <memmove+0x64>
+      nq = n / 8;
+  801de9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ded:	48 c1 e8 03          	shr    $0x3,%rax
+  801df1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801df5:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801dfa:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801dff:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  801e04:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e08:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e0c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801e10:	48 89 cf             	mov    %rcx,%rdi
+  801e13:	48 89 d6             	mov    %rdx,%rsi
+  801e16:	48 89 c1             	mov    %rax,%rcx
+  801e19:	fd                   	std
+  801e1a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801e1d:	fc                   	cld
+  801e1e:	48 89 c8             	mov    %rcx,%rax
+  801e21:	48 89 f2             	mov    %rsi,%rdx
+  801e24:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801e28:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801e2c:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  801e30:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  801e35:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  801e3a:	eb 17                	jmp    801e53 <memmove+0xf6>
+      *--d = *--s;
+  801e3c:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  801e41:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801e46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e4a:	0f b6 10             	movzbl (%rax),%edx
+  801e4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801e51:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801e53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e57:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801e5b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801e5f:	48 85 c0             	test   %rax,%rax
+  801e62:	75 d8                	jne    801e3c <memmove+0xdf>
+  if (s < d && s + n > d) {
+  801e64:	e9 f4 00 00 00       	jmp    801f5d <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801e69:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801e6e:	76 46                	jbe    801eb6 <memmove+0x159>
+  801e70:	48 b8 b6 13 80 00 00 	movabs $0x8013b6,%rax
+  801e77:	00 00 00 
+  801e7a:	ff d0                	call   *%rax
+  801e7c:	83 e0 01             	and    $0x1,%eax
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	74 33                	je     801eb6 <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  801e83:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801e87:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801e8b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e8f:	48 89 cf             	mov    %rcx,%rdi
+  801e92:	48 89 d6             	mov    %rdx,%rsi
+  801e95:	48 89 c1             	mov    %rax,%rcx
+  801e98:	fc                   	cld
+  801e99:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801e9b:	48 89 c8             	mov    %rcx,%rax
+  801e9e:	48 89 f2             	mov    %rsi,%rdx
+  801ea1:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801ea5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801ea9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801ead:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801eb1:	e9 ab 00 00 00       	jmp    801f61 <memmove+0x204>
+    if (n >= 8) {
+  801eb6:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801ebb:	0f 86 8b 00 00 00    	jbe    801f4c <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801ec1:	eb 22                	jmp    801ee5 <memmove+0x188>
+        *d++ = *s++;
+  801ec3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801ec7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801ecb:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801ecf:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ed3:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801ed7:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801edb:	0f b6 12             	movzbl (%rdx),%edx
+  801ede:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801ee0:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801ee5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ee9:	83 e0 07             	and    $0x7,%eax
+  801eec:	48 85 c0             	test   %rax,%rax
+  801eef:	75 d2                	jne    801ec3 <memmove+0x166>
+      nq = n / 8;
+  801ef1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ef5:	48 c1 e8 03          	shr    $0x3,%rax
+  801ef9:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801efd:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f01:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801f09:	48 89 cf             	mov    %rcx,%rdi
+  801f0c:	48 89 d6             	mov    %rdx,%rsi
+  801f0f:	48 89 c1             	mov    %rax,%rcx
+  801f12:	fc                   	cld
+  801f13:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801f16:	48 89 c8             	mov    %rcx,%rax
+  801f19:	48 89 f2             	mov    %rsi,%rdx
+  801f1c:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  801f20:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801f24:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  801f28:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  801f2d:	eb 1d                	jmp    801f4c <memmove+0x1ef>
+      *d++ = *s++;
+  801f2f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801f33:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801f37:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801f3b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801f3f:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801f43:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801f47:	0f b6 12             	movzbl (%rdx),%edx
+  801f4a:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  801f4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f50:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801f54:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801f58:	48 85 c0             	test   %rax,%rax
+  801f5b:	75 d2                	jne    801f2f <memmove+0x1d2>
+  return dst;
+  801f5d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+
+0000000000801f63 <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801f63:	55                   	push   %rbp
+  801f64:	48 89 e5             	mov    %rsp,%rbp
+  801f67:	48 83 ec 18          	sub    $0x18,%rsp
+  801f6b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801f6f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801f73:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801f77:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801f7b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801f7f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801f83:	48 89 ce             	mov    %rcx,%rsi
+  801f86:	48 89 c7             	mov    %rax,%rdi
+  801f89:	48 b8 5d 1d 80 00 00 	movabs $0x801d5d,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+}
+  801f95:	c9                   	leave
+  801f96:	c3                   	ret
+
+0000000000801f97 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801f97:	55                   	push   %rbp
+  801f98:	48 89 e5             	mov    %rsp,%rbp
+  801f9b:	48 83 ec 40          	sub    $0x40,%rsp
+  801f9f:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801fa3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801fa7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801fab:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801faf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801fb3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fb7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801fbb:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801fc0:	0f 86 a7 00 00 00    	jbe    80206d <memcmp+0xd6>
+  801fc6:	48 b8 b6 13 80 00 00 	movabs $0x8013b6,%rax
+  801fcd:	00 00 00 
+  801fd0:	ff d0                	call   *%rax
+  801fd2:	83 e0 02             	and    $0x2,%eax
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	0f 84 90 00 00 00    	je     80206d <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801fdd:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801fe1:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801fe5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fe9:	48 89 ce             	mov    %rcx,%rsi
+  801fec:	48 89 c7             	mov    %rax,%rdi
+  801fef:	48 b8 7e 15 80 00 00 	movabs $0x80157e,%rax
+  801ff6:	00 00 00 
+  801ff9:	ff d0                	call   *%rax
+  801ffb:	e9 c2 00 00 00       	jmp    8020c2 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  802000:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802004:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802008:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  80200c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802010:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802014:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  802018:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80201c:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  80201f:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  802026:	74 36                	je     80205e <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  802028:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80202b:	f7 d0                	not    %eax
+  80202d:	f3 0f bc c0          	tzcnt  %eax,%eax
+  802031:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  802034:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802037:	48 63 d0             	movslq %eax,%rdx
+  80203a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80203e:	48 01 d0             	add    %rdx,%rax
+  802041:	0f b6 00             	movzbl (%rax),%eax
+  802044:	0f b6 c0             	movzbl %al,%eax
+  802047:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  80204a:	48 63 ca             	movslq %edx,%rcx
+  80204d:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802051:	48 01 ca             	add    %rcx,%rdx
+  802054:	0f b6 12             	movzbl (%rdx),%edx
+  802057:	0f b6 d2             	movzbl %dl,%edx
+  80205a:	29 d0                	sub    %edx,%eax
+  80205c:	eb 64                	jmp    8020c2 <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  80205e:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  802063:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  802068:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  80206d:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  802072:	77 8c                	ja     802000 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  802074:	eb 36                	jmp    8020ac <memcmp+0x115>
+    if (*s1 != *s2)
+  802076:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80207a:	0f b6 10             	movzbl (%rax),%edx
+  80207d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802081:	0f b6 00             	movzbl (%rax),%eax
+  802084:	38 c2                	cmp    %al,%dl
+  802086:	74 1a                	je     8020a2 <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  802088:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80208c:	0f b6 00             	movzbl (%rax),%eax
+  80208f:	0f b6 c8             	movzbl %al,%ecx
+  802092:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802096:	0f b6 00             	movzbl (%rax),%eax
+  802099:	0f b6 d0             	movzbl %al,%edx
+  80209c:	89 c8                	mov    %ecx,%eax
+  80209e:	29 d0                	sub    %edx,%eax
+  8020a0:	eb 20                	jmp    8020c2 <memcmp+0x12b>
+    s1++, s2++;
+  8020a2:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8020a7:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  8020ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020b0:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8020b4:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8020b8:	48 85 c0             	test   %rax,%rax
+  8020bb:	75 b9                	jne    802076 <memcmp+0xdf>
+  }
+
+  return 0;
+  8020bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020c2:	c9                   	leave
+  8020c3:	c3                   	ret
+
+00000000008020c4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  8020c4:	55                   	push   %rbp
+  8020c5:	48 89 e5             	mov    %rsp,%rbp
+  8020c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8020cc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8020d0:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  8020d3:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  8020d7:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8020db:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8020df:	48 01 d0             	add    %rdx,%rax
+  8020e2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  8020e6:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  8020e9:	66 0f 6e c0          	movd   %eax,%xmm0
+  8020ed:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  8020f1:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  8020f5:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  8020fa:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  8020fe:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  802103:	76 73                	jbe    802178 <memfind+0xb4>
+  802105:	48 b8 b6 13 80 00 00 	movabs $0x8013b6,%rax
+  80210c:	00 00 00 
+  80210f:	ff d0                	call   *%rax
+  802111:	83 e0 02             	and    $0x2,%eax
+  802114:	85 c0                	test   %eax,%eax
+  802116:	74 60                	je     802178 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  802118:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  80211b:	0f b6 c8             	movzbl %al,%ecx
+  80211e:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  802122:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802126:	89 ce                	mov    %ecx,%esi
+  802128:	48 89 c7             	mov    %rax,%rdi
+  80212b:	48 b8 6d 16 80 00 00 	movabs $0x80166d,%rax
+  802132:	00 00 00 
+  802135:	ff d0                	call   *%rax
+  802137:	eb 6c                	jmp    8021a5 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  802139:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80213d:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  802141:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  802145:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  80214a:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80214e:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  802152:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  802155:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  802159:	74 13                	je     80216e <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  80215b:	31 c0                	xor    %eax,%eax
+  80215d:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  802162:	48 63 d0             	movslq %eax,%rdx
+  802165:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802169:	48 01 d0             	add    %rdx,%rax
+  80216c:	eb 37                	jmp    8021a5 <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  80216e:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  802173:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  802178:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  80217d:	77 ba                	ja     802139 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  80217f:	eb 13                	jmp    802194 <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  802181:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802185:	0f b6 00             	movzbl (%rax),%eax
+  802188:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  80218b:	38 d0                	cmp    %dl,%al
+  80218d:	74 11                	je     8021a0 <memfind+0xdc>
+  for (; s < ends; s++)
+  80218f:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  802194:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802198:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  80219c:	72 e3                	jb     802181 <memfind+0xbd>
+  80219e:	eb 01                	jmp    8021a1 <memfind+0xdd>
+      break;
+  8021a0:	90                   	nop
+  return (void *)s;
+  8021a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  8021a5:	c9                   	leave
+  8021a6:	c3                   	ret
+
+00000000008021a7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8021a7:	55                   	push   %rbp
+  8021a8:	48 89 e5             	mov    %rsp,%rbp
+  8021ab:	48 83 ec 38          	sub    $0x38,%rsp
+  8021af:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8021b3:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8021b7:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  8021ba:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  8021c1:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  8021c8:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8021c9:	eb 05                	jmp    8021d0 <strtol+0x29>
+    s++;
+  8021cb:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  8021d0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021d4:	0f b6 00             	movzbl (%rax),%eax
+  8021d7:	3c 20                	cmp    $0x20,%al
+  8021d9:	74 f0                	je     8021cb <strtol+0x24>
+  8021db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021df:	0f b6 00             	movzbl (%rax),%eax
+  8021e2:	3c 09                	cmp    $0x9,%al
+  8021e4:	74 e5                	je     8021cb <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  8021e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021ea:	0f b6 00             	movzbl (%rax),%eax
+  8021ed:	3c 2b                	cmp    $0x2b,%al
+  8021ef:	75 07                	jne    8021f8 <strtol+0x51>
+    s++;
+  8021f1:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8021f6:	eb 17                	jmp    80220f <strtol+0x68>
+  else if (*s == '-')
+  8021f8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8021fc:	0f b6 00             	movzbl (%rax),%eax
+  8021ff:	3c 2d                	cmp    $0x2d,%al
+  802201:	75 0c                	jne    80220f <strtol+0x68>
+    s++, neg = 1;
+  802203:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802208:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80220f:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802213:	74 06                	je     80221b <strtol+0x74>
+  802215:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  802219:	75 28                	jne    802243 <strtol+0x9c>
+  80221b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80221f:	0f b6 00             	movzbl (%rax),%eax
+  802222:	3c 30                	cmp    $0x30,%al
+  802224:	75 1d                	jne    802243 <strtol+0x9c>
+  802226:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80222a:	48 83 c0 01          	add    $0x1,%rax
+  80222e:	0f b6 00             	movzbl (%rax),%eax
+  802231:	3c 78                	cmp    $0x78,%al
+  802233:	75 0e                	jne    802243 <strtol+0x9c>
+    s += 2, base = 16;
+  802235:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  80223a:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  802241:	eb 2c                	jmp    80226f <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  802243:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802247:	75 19                	jne    802262 <strtol+0xbb>
+  802249:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80224d:	0f b6 00             	movzbl (%rax),%eax
+  802250:	3c 30                	cmp    $0x30,%al
+  802252:	75 0e                	jne    802262 <strtol+0xbb>
+    s++, base = 8;
+  802254:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  802259:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  802260:	eb 0d                	jmp    80226f <strtol+0xc8>
+  else if (base == 0)
+  802262:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  802266:	75 07                	jne    80226f <strtol+0xc8>
+    base = 10;
+  802268:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  80226f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802273:	0f b6 00             	movzbl (%rax),%eax
+  802276:	3c 2f                	cmp    $0x2f,%al
+  802278:	7e 1d                	jle    802297 <strtol+0xf0>
+  80227a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80227e:	0f b6 00             	movzbl (%rax),%eax
+  802281:	3c 39                	cmp    $0x39,%al
+  802283:	7f 12                	jg     802297 <strtol+0xf0>
+      dig = *s - '0';
+  802285:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802289:	0f b6 00             	movzbl (%rax),%eax
+  80228c:	0f be c0             	movsbl %al,%eax
+  80228f:	83 e8 30             	sub    $0x30,%eax
+  802292:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  802295:	eb 4e                	jmp    8022e5 <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  802297:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80229b:	0f b6 00             	movzbl (%rax),%eax
+  80229e:	3c 60                	cmp    $0x60,%al
+  8022a0:	7e 1d                	jle    8022bf <strtol+0x118>
+  8022a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022a6:	0f b6 00             	movzbl (%rax),%eax
+  8022a9:	3c 7a                	cmp    $0x7a,%al
+  8022ab:	7f 12                	jg     8022bf <strtol+0x118>
+      dig = *s - 'a' + 10;
+  8022ad:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022b1:	0f b6 00             	movzbl (%rax),%eax
+  8022b4:	0f be c0             	movsbl %al,%eax
+  8022b7:	83 e8 57             	sub    $0x57,%eax
+  8022ba:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8022bd:	eb 26                	jmp    8022e5 <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  8022bf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022c3:	0f b6 00             	movzbl (%rax),%eax
+  8022c6:	3c 40                	cmp    $0x40,%al
+  8022c8:	7e 47                	jle    802311 <strtol+0x16a>
+  8022ca:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022ce:	0f b6 00             	movzbl (%rax),%eax
+  8022d1:	3c 5a                	cmp    $0x5a,%al
+  8022d3:	7f 3c                	jg     802311 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  8022d5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022d9:	0f b6 00             	movzbl (%rax),%eax
+  8022dc:	0f be c0             	movsbl %al,%eax
+  8022df:	83 e8 37             	sub    $0x37,%eax
+  8022e2:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  8022e5:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8022e8:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  8022eb:	7d 23                	jge    802310 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  8022ed:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  8022f2:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  8022f5:	48 98                	cltq
+  8022f7:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  8022fc:	48 89 c2             	mov    %rax,%rdx
+  8022ff:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802302:	48 98                	cltq
+  802304:	48 01 d0             	add    %rdx,%rax
+  802307:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  80230b:	e9 5f ff ff ff       	jmp    80226f <strtol+0xc8>
+      break;
+  802310:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802311:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  802316:	74 0b                	je     802323 <strtol+0x17c>
+    *endptr = (char *)s;
+  802318:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80231c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802320:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  802323:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802327:	74 09                	je     802332 <strtol+0x18b>
+  802329:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80232d:	48 f7 d8             	neg    %rax
+  802330:	eb 04                	jmp    802336 <strtol+0x18f>
+  802332:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  802336:	c9                   	leave
+  802337:	c3                   	ret
+
+0000000000802338 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  802338:	55                   	push   %rbp
+  802339:	48 89 e5             	mov    %rsp,%rbp
+  80233c:	53                   	push   %rbx
+  80233d:	48 83 ec 48          	sub    $0x48,%rsp
+  802341:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802345:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802349:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80234d:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  802351:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802355:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  802359:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80235d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802361:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  802365:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802369:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80236d:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  802371:	4c 89 c3             	mov    %r8,%rbx
+  802374:	cd 30                	int    $0x30
+  802376:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  80237a:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  80237f:	74 46                	je     8023c7 <syscall+0x8f>
+  802381:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  802386:	7e 3f                	jle    8023c7 <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  802388:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80238c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802390:	49 89 d0             	mov    %rdx,%r8
+  802393:	48 89 c1             	mov    %rax,%rcx
+  802396:	48 b8 c8 5a 80 00 00 	movabs $0x805ac8,%rax
+  80239d:	00 00 00 
+  8023a0:	48 89 c2             	mov    %rax,%rdx
+  8023a3:	be 22 00 00 00       	mov    $0x22,%esi
+  8023a8:	48 b8 e7 5a 80 00 00 	movabs $0x805ae7,%rax
+  8023af:	00 00 00 
+  8023b2:	48 89 c7             	mov    %rax,%rdi
+  8023b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ba:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  8023c1:	00 00 00 
+  8023c4:	41 ff d1             	call   *%r9
+
+  return ret;
+  8023c7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  8023cb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8023cf:	c9                   	leave
+  8023d0:	c3                   	ret
+
+00000000008023d1 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  8023d1:	55                   	push   %rbp
+  8023d2:	48 89 e5             	mov    %rsp,%rbp
+  8023d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8023d9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023dd:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  8023e1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ed:	6a 00                	push   $0x0
+  8023ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023fb:	48 89 d1             	mov    %rdx,%rcx
+  8023fe:	48 89 c2             	mov    %rax,%rdx
+  802401:	be 00 00 00 00       	mov    $0x0,%esi
+  802406:	bf 00 00 00 00       	mov    $0x0,%edi
+  80240b:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802412:	00 00 00 
+  802415:	ff d0                	call   *%rax
+  802417:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80241b:	90                   	nop
+  80241c:	c9                   	leave
+  80241d:	c3                   	ret
+
+000000000080241e <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  80241e:	55                   	push   %rbp
+  80241f:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  802422:	48 83 ec 08          	sub    $0x8,%rsp
+  802426:	6a 00                	push   $0x0
+  802428:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80242e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802434:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802439:	ba 00 00 00 00       	mov    $0x0,%edx
+  80243e:	be 00 00 00 00       	mov    $0x0,%esi
+  802443:	bf 01 00 00 00       	mov    $0x1,%edi
+  802448:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  80244f:	00 00 00 
+  802452:	ff d0                	call   *%rax
+  802454:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802458:	c9                   	leave
+  802459:	c3                   	ret
+
+000000000080245a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  80245a:	55                   	push   %rbp
+  80245b:	48 89 e5             	mov    %rsp,%rbp
+  80245e:	48 83 ec 10          	sub    $0x10,%rsp
+  802462:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  802465:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802468:	48 98                	cltq
+  80246a:	48 83 ec 08          	sub    $0x8,%rsp
+  80246e:	6a 00                	push   $0x0
+  802470:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802476:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80247c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802481:	48 89 c2             	mov    %rax,%rdx
+  802484:	be 01 00 00 00       	mov    $0x1,%esi
+  802489:	bf 03 00 00 00       	mov    $0x3,%edi
+  80248e:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802495:	00 00 00 
+  802498:	ff d0                	call   *%rax
+  80249a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80249e:	c9                   	leave
+  80249f:	c3                   	ret
+
+00000000008024a0 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  8024a0:	55                   	push   %rbp
+  8024a1:	48 89 e5             	mov    %rsp,%rbp
+  8024a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8024a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  8024ab:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8024ae:	48 98                	cltq
+  8024b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8024b4:	6a 00                	push   $0x0
+  8024b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024c7:	48 89 c2             	mov    %rax,%rdx
+  8024ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8024cf:	bf 04 00 00 00       	mov    $0x4,%edi
+  8024d4:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8024db:	00 00 00 
+  8024de:	ff d0                	call   *%rax
+  8024e0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024e4:	90                   	nop
+  8024e5:	c9                   	leave
+  8024e6:	c3                   	ret
+
+00000000008024e7 <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  8024e7:	55                   	push   %rbp
+  8024e8:	48 89 e5             	mov    %rsp,%rbp
+  8024eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8024ef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8024f2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  8024f6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8024f9:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  8024fc:	b8 05 00 00 00       	mov    $0x5,%eax
+  802501:	cd 30                	int    $0x30
+  802503:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  802507:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  80250b:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802510:	7e 3d                	jle    80254f <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  802512:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802516:	49 89 c0             	mov    %rax,%r8
+  802519:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80251e:	48 b8 c8 5a 80 00 00 	movabs $0x805ac8,%rax
+  802525:	00 00 00 
+  802528:	48 89 c2             	mov    %rax,%rdx
+  80252b:	be 49 00 00 00       	mov    $0x49,%esi
+  802530:	48 b8 e7 5a 80 00 00 	movabs $0x805ae7,%rax
+  802537:	00 00 00 
+  80253a:	48 89 c7             	mov    %rax,%rdi
+  80253d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802542:	49 b9 4b 06 80 00 00 	movabs $0x80064b,%r9
+  802549:	00 00 00 
+  80254c:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  80254f:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  802554:	75 13                	jne    802569 <sys_env_wait+0x82>
+  802556:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80255b:	74 0c                	je     802569 <sys_env_wait+0x82>
+    *status = st;
+  80255d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802561:	89 c2                	mov    %eax,%edx
+  802563:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802567:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802569:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  80256d:	c9                   	leave
+  80256e:	c3                   	ret
+
+000000000080256f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  80256f:	55                   	push   %rbp
+  802570:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  802573:	48 83 ec 08          	sub    $0x8,%rsp
+  802577:	6a 00                	push   $0x0
+  802579:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80257f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802585:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80258a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258f:	be 00 00 00 00       	mov    $0x0,%esi
+  802594:	bf 02 00 00 00       	mov    $0x2,%edi
+  802599:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8025a0:	00 00 00 
+  8025a3:	ff d0                	call   *%rax
+  8025a5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025a9:	c9                   	leave
+  8025aa:	c3                   	ret
+
+00000000008025ab <sys_yield>:
+
+void
+sys_yield(void) {
+  8025ab:	55                   	push   %rbp
+  8025ac:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  8025af:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b3:	6a 00                	push   $0x0
+  8025b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8025bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8025c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8025d0:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8025d5:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8025dc:	00 00 00 
+  8025df:	ff d0                	call   *%rax
+  8025e1:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025e5:	90                   	nop
+  8025e6:	c9                   	leave
+  8025e7:	c3                   	ret
+
+00000000008025e8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  8025e8:	55                   	push   %rbp
+  8025e9:	48 89 e5             	mov    %rsp,%rbp
+  8025ec:	48 83 ec 20          	sub    $0x20,%rsp
+  8025f0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025f3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025f7:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  8025fa:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025fd:	48 63 c8             	movslq %eax,%rcx
+  802600:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802604:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802607:	48 98                	cltq
+  802609:	48 83 ec 08          	sub    $0x8,%rsp
+  80260d:	6a 00                	push   $0x0
+  80260f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802615:	49 89 c8             	mov    %rcx,%r8
+  802618:	48 89 d1             	mov    %rdx,%rcx
+  80261b:	48 89 c2             	mov    %rax,%rdx
+  80261e:	be 01 00 00 00       	mov    $0x1,%esi
+  802623:	bf 06 00 00 00       	mov    $0x6,%edi
+  802628:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  80262f:	00 00 00 
+  802632:	ff d0                	call   *%rax
+  802634:	48 83 c4 10          	add    $0x10,%rsp
+  802638:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  80263b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80263e:	c9                   	leave
+  80263f:	c3                   	ret
+
+0000000000802640 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  802640:	55                   	push   %rbp
+  802641:	48 89 e5             	mov    %rsp,%rbp
+  802644:	48 83 ec 20          	sub    $0x20,%rsp
+  802648:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80264b:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  80264f:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  802652:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  802656:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  80265a:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80265d:	48 63 c8             	movslq %eax,%rcx
+  802660:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  802664:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802667:	48 63 f0             	movslq %eax,%rsi
+  80266a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80266e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802671:	48 98                	cltq
+  802673:	48 83 ec 08          	sub    $0x8,%rsp
+  802677:	51                   	push   %rcx
+  802678:	49 89 f9             	mov    %rdi,%r9
+  80267b:	49 89 f0             	mov    %rsi,%r8
+  80267e:	48 89 d1             	mov    %rdx,%rcx
+  802681:	48 89 c2             	mov    %rax,%rdx
+  802684:	be 01 00 00 00       	mov    $0x1,%esi
+  802689:	bf 07 00 00 00       	mov    $0x7,%edi
+  80268e:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802695:	00 00 00 
+  802698:	ff d0                	call   *%rax
+  80269a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80269e:	c9                   	leave
+  80269f:	c3                   	ret
+
+00000000008026a0 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  8026a0:	55                   	push   %rbp
+  8026a1:	48 89 e5             	mov    %rsp,%rbp
+  8026a4:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026ab:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  8026af:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8026b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8026b6:	48 98                	cltq
+  8026b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8026bc:	6a 00                	push   $0x0
+  8026be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8026c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8026ca:	48 89 d1             	mov    %rdx,%rcx
+  8026cd:	48 89 c2             	mov    %rax,%rdx
+  8026d0:	be 01 00 00 00       	mov    $0x1,%esi
+  8026d5:	bf 08 00 00 00       	mov    $0x8,%edi
+  8026da:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8026e1:	00 00 00 
+  8026e4:	ff d0                	call   *%rax
+  8026e6:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026ea:	c9                   	leave
+  8026eb:	c3                   	ret
+
+00000000008026ec <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  8026ec:	55                   	push   %rbp
+  8026ed:	48 89 e5             	mov    %rsp,%rbp
+  8026f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8026f4:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8026f7:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  8026fa:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8026fd:	48 63 d0             	movslq %eax,%rdx
+  802700:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802703:	48 98                	cltq
+  802705:	48 83 ec 08          	sub    $0x8,%rsp
+  802709:	6a 00                	push   $0x0
+  80270b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802711:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802717:	48 89 d1             	mov    %rdx,%rcx
+  80271a:	48 89 c2             	mov    %rax,%rdx
+  80271d:	be 01 00 00 00       	mov    $0x1,%esi
+  802722:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802727:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  80272e:	00 00 00 
+  802731:	ff d0                	call   *%rax
+  802733:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802737:	c9                   	leave
+  802738:	c3                   	ret
+
+0000000000802739 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802739:	55                   	push   %rbp
+  80273a:	48 89 e5             	mov    %rsp,%rbp
+  80273d:	48 83 ec 10          	sub    $0x10,%rsp
+  802741:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802744:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  802748:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80274c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80274f:	48 98                	cltq
+  802751:	48 83 ec 08          	sub    $0x8,%rsp
+  802755:	6a 00                	push   $0x0
+  802757:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80275d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802763:	48 89 d1             	mov    %rdx,%rcx
+  802766:	48 89 c2             	mov    %rax,%rdx
+  802769:	be 01 00 00 00       	mov    $0x1,%esi
+  80276e:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802773:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  80277a:	00 00 00 
+  80277d:	ff d0                	call   *%rax
+  80277f:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802783:	c9                   	leave
+  802784:	c3                   	ret
+
+0000000000802785 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  802785:	55                   	push   %rbp
+  802786:	48 89 e5             	mov    %rsp,%rbp
+  802789:	48 83 ec 10          	sub    $0x10,%rsp
+  80278d:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802790:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  802794:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802798:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80279b:	48 98                	cltq
+  80279d:	48 83 ec 08          	sub    $0x8,%rsp
+  8027a1:	6a 00                	push   $0x0
+  8027a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8027a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8027af:	48 89 d1             	mov    %rdx,%rcx
+  8027b2:	48 89 c2             	mov    %rax,%rdx
+  8027b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8027ba:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8027bf:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8027c6:	00 00 00 
+  8027c9:	ff d0                	call   *%rax
+  8027cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8027cf:	c9                   	leave
+  8027d0:	c3                   	ret
+
+00000000008027d1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  8027d1:	55                   	push   %rbp
+  8027d2:	48 89 e5             	mov    %rsp,%rbp
+  8027d5:	48 83 ec 20          	sub    $0x20,%rsp
+  8027d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8027dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8027e0:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8027e4:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  8027e7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8027ea:	48 63 f0             	movslq %eax,%rsi
+  8027ed:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8027f1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8027f5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027f8:	48 98                	cltq
+  8027fa:	48 83 ec 08          	sub    $0x8,%rsp
+  8027fe:	6a 00                	push   $0x0
+  802800:	49 89 f1             	mov    %rsi,%r9
+  802803:	49 89 c8             	mov    %rcx,%r8
+  802806:	48 89 d1             	mov    %rdx,%rcx
+  802809:	48 89 c2             	mov    %rax,%rdx
+  80280c:	be 00 00 00 00       	mov    $0x0,%esi
+  802811:	bf 0e 00 00 00       	mov    $0xe,%edi
+  802816:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  80281d:	00 00 00 
+  802820:	ff d0                	call   *%rax
+  802822:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802826:	c9                   	leave
+  802827:	c3                   	ret
+
+0000000000802828 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  802828:	55                   	push   %rbp
+  802829:	48 89 e5             	mov    %rsp,%rbp
+  80282c:	48 83 ec 10          	sub    $0x10,%rsp
+  802830:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  802834:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802838:	48 83 ec 08          	sub    $0x8,%rsp
+  80283c:	6a 00                	push   $0x0
+  80283e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802844:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80284a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80284f:	48 89 c2             	mov    %rax,%rdx
+  802852:	be 01 00 00 00       	mov    $0x1,%esi
+  802857:	bf 0f 00 00 00       	mov    $0xf,%edi
+  80285c:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802863:	00 00 00 
+  802866:	ff d0                	call   *%rax
+  802868:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80286c:	c9                   	leave
+  80286d:	c3                   	ret
+
+000000000080286e <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  80286e:	55                   	push   %rbp
+  80286f:	48 89 e5             	mov    %rsp,%rbp
+  802872:	48 83 ec 10          	sub    $0x10,%rsp
+  802876:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80287a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  80287e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802882:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802886:	48 83 ec 08          	sub    $0x8,%rsp
+  80288a:	6a 00                	push   $0x0
+  80288c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802892:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802898:	48 89 d1             	mov    %rdx,%rcx
+  80289b:	48 89 c2             	mov    %rax,%rdx
+  80289e:	be 01 00 00 00       	mov    $0x1,%esi
+  8028a3:	bf 10 00 00 00       	mov    $0x10,%edi
+  8028a8:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8028af:	00 00 00 
+  8028b2:	ff d0                	call   *%rax
+  8028b4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028b8:	c9                   	leave
+  8028b9:	c3                   	ret
+
+00000000008028ba <sys_gettime>:
+
+int
+sys_gettime(void) {
+  8028ba:	55                   	push   %rbp
+  8028bb:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  8028be:	48 83 ec 08          	sub    $0x8,%rsp
+  8028c2:	6a 00                	push   $0x0
+  8028c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8028ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8028d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028da:	be 00 00 00 00       	mov    $0x0,%esi
+  8028df:	bf 11 00 00 00       	mov    $0x11,%edi
+  8028e4:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8028eb:	00 00 00 
+  8028ee:	ff d0                	call   *%rax
+  8028f0:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8028f4:	c9                   	leave
+  8028f5:	c3                   	ret
+
+00000000008028f6 <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  8028f6:	55                   	push   %rbp
+  8028f7:	48 89 e5             	mov    %rsp,%rbp
+  8028fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8028fe:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802902:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  802906:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80290a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80290e:	48 83 ec 08          	sub    $0x8,%rsp
+  802912:	6a 00                	push   $0x0
+  802914:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80291a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802920:	48 89 d1             	mov    %rdx,%rcx
+  802923:	48 89 c2             	mov    %rax,%rdx
+  802926:	be 00 00 00 00       	mov    $0x0,%esi
+  80292b:	bf 12 00 00 00       	mov    $0x12,%edi
+  802930:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+  80293c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802940:	c9                   	leave
+  802941:	c3                   	ret
+
+0000000000802942 <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  802942:	55                   	push   %rbp
+  802943:	48 89 e5             	mov    %rsp,%rbp
+  802946:	48 83 ec 20          	sub    $0x20,%rsp
+  80294a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80294e:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802952:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  802955:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802958:	48 63 c8             	movslq %eax,%rcx
+  80295b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80295f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802963:	48 83 ec 08          	sub    $0x8,%rsp
+  802967:	6a 00                	push   $0x0
+  802969:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80296f:	49 89 c8             	mov    %rcx,%r8
+  802972:	48 89 d1             	mov    %rdx,%rcx
+  802975:	48 89 c2             	mov    %rax,%rdx
+  802978:	be 00 00 00 00       	mov    $0x0,%esi
+  80297d:	bf 13 00 00 00       	mov    $0x13,%edi
+  802982:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802989:	00 00 00 
+  80298c:	ff d0                	call   *%rax
+  80298e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802992:	c9                   	leave
+  802993:	c3                   	ret
+
+0000000000802994 <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  802994:	55                   	push   %rbp
+  802995:	48 89 e5             	mov    %rsp,%rbp
+  802998:	48 83 ec 20          	sub    $0x20,%rsp
+  80299c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029a0:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8029a3:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  8029a7:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8029ab:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8029ae:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8029b6:	6a 00                	push   $0x0
+  8029b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8029be:	49 89 c8             	mov    %rcx,%r8
+  8029c1:	48 89 d1             	mov    %rdx,%rcx
+  8029c4:	48 89 c2             	mov    %rax,%rdx
+  8029c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029cc:	bf 14 00 00 00       	mov    $0x14,%edi
+  8029d1:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8029e1:	c9                   	leave
+  8029e2:	c3                   	ret
+
+00000000008029e3 <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  8029e3:	55                   	push   %rbp
+  8029e4:	48 89 e5             	mov    %rsp,%rbp
+  8029e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8029eb:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8029ef:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  8029f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8029f5:	48 63 d0             	movslq %eax,%rdx
+  8029f8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8029fc:	48 83 ec 08          	sub    $0x8,%rsp
+  802a00:	6a 00                	push   $0x0
+  802a02:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802a08:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802a0e:	48 89 d1             	mov    %rdx,%rcx
+  802a11:	48 89 c2             	mov    %rax,%rdx
+  802a14:	be 00 00 00 00       	mov    $0x0,%esi
+  802a19:	bf 15 00 00 00       	mov    $0x15,%edi
+  802a1e:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802a25:	00 00 00 
+  802a28:	ff d0                	call   *%rax
+  802a2a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a2e:	c9                   	leave
+  802a2f:	c3                   	ret
+
+0000000000802a30 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  802a30:	55                   	push   %rbp
+  802a31:	48 89 e5             	mov    %rsp,%rbp
+  802a34:	48 83 ec 20          	sub    $0x20,%rsp
+  802a38:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a3c:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  802a3f:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  802a42:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  802a46:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802a4a:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  802a4d:	48 63 c8             	movslq %eax,%rcx
+  802a50:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  802a53:	48 63 d0             	movslq %eax,%rdx
+  802a56:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802a5a:	48 83 ec 08          	sub    $0x8,%rsp
+  802a5e:	6a 00                	push   $0x0
+  802a60:	49 89 f1             	mov    %rsi,%r9
+  802a63:	49 89 c8             	mov    %rcx,%r8
+  802a66:	48 89 d1             	mov    %rdx,%rcx
+  802a69:	48 89 c2             	mov    %rax,%rdx
+  802a6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a71:	bf 16 00 00 00       	mov    $0x16,%edi
+  802a76:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802a7d:	00 00 00 
+  802a80:	ff d0                	call   *%rax
+  802a82:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802a86:	c9                   	leave
+  802a87:	c3                   	ret
+
+0000000000802a88 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802a88:	55                   	push   %rbp
+  802a89:	48 89 e5             	mov    %rsp,%rbp
+  802a8c:	48 83 ec 30          	sub    $0x30,%rsp
+  802a90:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802a94:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802a98:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802a9c:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802aa0:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  802aa4:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802aa8:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802aac:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802ab0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ab4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802ab8:	48 83 ec 08          	sub    $0x8,%rsp
+  802abc:	51                   	push   %rcx
+  802abd:	49 89 f9             	mov    %rdi,%r9
+  802ac0:	49 89 f0             	mov    %rsi,%r8
+  802ac3:	48 89 d1             	mov    %rdx,%rcx
+  802ac6:	48 89 c2             	mov    %rax,%rdx
+  802ac9:	be 00 00 00 00       	mov    $0x0,%esi
+  802ace:	bf 17 00 00 00       	mov    $0x17,%edi
+  802ad3:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802ada:	00 00 00 
+  802add:	ff d0                	call   *%rax
+  802adf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ae3:	c9                   	leave
+  802ae4:	c3                   	ret
+
+0000000000802ae5 <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  802ae5:	55                   	push   %rbp
+  802ae6:	48 89 e5             	mov    %rsp,%rbp
+  802ae9:	48 83 ec 10          	sub    $0x10,%rsp
+  802aed:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802af0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802af3:	48 98                	cltq
+  802af5:	48 83 ec 08          	sub    $0x8,%rsp
+  802af9:	6a 00                	push   $0x0
+  802afb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802b01:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802b07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802b0c:	48 89 c2             	mov    %rax,%rdx
+  802b0f:	be 00 00 00 00       	mov    $0x0,%esi
+  802b14:	bf 18 00 00 00       	mov    $0x18,%edi
+  802b19:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802b20:	00 00 00 
+  802b23:	ff d0                	call   *%rax
+  802b25:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802b29:	90                   	nop
+  802b2a:	c9                   	leave
+  802b2b:	c3                   	ret
+
+0000000000802b2c <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  802b2c:	55                   	push   %rbp
+  802b2d:	48 89 e5             	mov    %rsp,%rbp
+  802b30:	48 83 ec 30          	sub    $0x30,%rsp
+  802b34:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802b37:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802b3b:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  802b3f:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  802b42:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802b45:	48 63 f0             	movslq %eax,%rsi
+  802b48:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802b4c:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802b50:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b53:	48 98                	cltq
+  802b55:	48 83 ec 08          	sub    $0x8,%rsp
+  802b59:	6a 00                	push   $0x0
+  802b5b:	49 89 f1             	mov    %rsi,%r9
+  802b5e:	49 89 c8             	mov    %rcx,%r8
+  802b61:	48 89 d1             	mov    %rdx,%rcx
+  802b64:	48 89 c2             	mov    %rax,%rdx
+  802b67:	be 01 00 00 00       	mov    $0x1,%esi
+  802b6c:	bf 19 00 00 00       	mov    $0x19,%edi
+  802b71:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802b78:	00 00 00 
+  802b7b:	ff d0                	call   *%rax
+  802b7d:	48 83 c4 10          	add    $0x10,%rsp
+  802b81:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802b84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802b87:	c9                   	leave
+  802b88:	c3                   	ret
+
+0000000000802b89 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802b89:	55                   	push   %rbp
+  802b8a:	48 89 e5             	mov    %rsp,%rbp
+  802b8d:	48 83 ec 20          	sub    $0x20,%rsp
+  802b91:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802b95:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802b99:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802b9c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b9f:	48 63 c8             	movslq %eax,%rcx
+  802ba2:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802ba6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802baa:	48 83 ec 08          	sub    $0x8,%rsp
+  802bae:	6a 00                	push   $0x0
+  802bb0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802bb6:	49 89 c8             	mov    %rcx,%r8
+  802bb9:	48 89 d1             	mov    %rdx,%rcx
+  802bbc:	48 89 c2             	mov    %rax,%rdx
+  802bbf:	be 01 00 00 00       	mov    $0x1,%esi
+  802bc4:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802bc9:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802bd0:	00 00 00 
+  802bd3:	ff d0                	call   *%rax
+  802bd5:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802bd9:	c9                   	leave
+  802bda:	c3                   	ret
+
+0000000000802bdb <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802bdb:	55                   	push   %rbp
+  802bdc:	48 89 e5             	mov    %rsp,%rbp
+  802bdf:	48 83 ec 20          	sub    $0x20,%rsp
+  802be3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802be7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802beb:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802bef:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802bf3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802bf7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802bfb:	48 83 ec 08          	sub    $0x8,%rsp
+  802bff:	6a 00                	push   $0x0
+  802c01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802c07:	49 89 c8             	mov    %rcx,%r8
+  802c0a:	48 89 d1             	mov    %rdx,%rcx
+  802c0d:	48 89 c2             	mov    %rax,%rdx
+  802c10:	be 01 00 00 00       	mov    $0x1,%esi
+  802c15:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  802c1a:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+  802c26:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802c2a:	c9                   	leave
+  802c2b:	c3                   	ret
+
+0000000000802c2c <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  802c2c:	55                   	push   %rbp
+  802c2d:	48 89 e5             	mov    %rsp,%rbp
+  802c30:	48 83 ec 30          	sub    $0x30,%rsp
+  802c34:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  802c38:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802c3c:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  802c3f:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  802c43:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802c47:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802c4a:	48 63 c8             	movslq %eax,%rcx
+  802c4d:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c51:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802c55:	48 83 ec 08          	sub    $0x8,%rsp
+  802c59:	6a 00                	push   $0x0
+  802c5b:	49 89 f1             	mov    %rsi,%r9
+  802c5e:	49 89 c8             	mov    %rcx,%r8
+  802c61:	48 89 d1             	mov    %rdx,%rcx
+  802c64:	48 89 c2             	mov    %rax,%rdx
+  802c67:	be 01 00 00 00       	mov    $0x1,%esi
+  802c6c:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802c71:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802c78:	00 00 00 
+  802c7b:	ff d0                	call   *%rax
+  802c7d:	48 83 c4 10          	add    $0x10,%rsp
+  802c81:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  802c84:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802c87:	c9                   	leave
+  802c88:	c3                   	ret
+
+0000000000802c89 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802c89:	55                   	push   %rbp
+  802c8a:	48 89 e5             	mov    %rsp,%rbp
+  802c8d:	48 83 ec 10          	sub    $0x10,%rsp
+  802c91:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  802c94:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802c97:	48 98                	cltq
+  802c99:	48 83 ec 08          	sub    $0x8,%rsp
+  802c9d:	6a 00                	push   $0x0
+  802c9f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802ca5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802cab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cb0:	48 89 c2             	mov    %rax,%rdx
+  802cb3:	be 01 00 00 00       	mov    $0x1,%esi
+  802cb8:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802cbd:	48 b8 38 23 80 00 00 	movabs $0x802338,%rax
+  802cc4:	00 00 00 
+  802cc7:	ff d0                	call   *%rax
+  802cc9:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802ccd:	c9                   	leave
+  802cce:	c3                   	ret
+
+0000000000802ccf <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802ccf:	55                   	push   %rbp
+  802cd0:	48 89 e5             	mov    %rsp,%rbp
+  802cd3:	48 83 ec 08          	sub    $0x8,%rsp
+  802cd7:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802cdb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802cdf:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  802ce6:	ff ff ff 
+  802ce9:	48 01 d0             	add    %rdx,%rax
+  802cec:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802cf0:	c9                   	leave
+  802cf1:	c3                   	ret
+
+0000000000802cf2 <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  802cf2:	55                   	push   %rbp
+  802cf3:	48 89 e5             	mov    %rsp,%rbp
+  802cf6:	48 83 ec 08          	sub    $0x8,%rsp
+  802cfa:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802cfe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802d02:	48 89 c7             	mov    %rax,%rdi
+  802d05:	48 b8 cf 2c 80 00 00 	movabs $0x802ccf,%rax
+  802d0c:	00 00 00 
+  802d0f:	ff d0                	call   *%rax
+  802d11:	48 05 01 68 00 00    	add    $0x6801,%rax
+  802d17:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  802d1b:	c9                   	leave
+  802d1c:	c3                   	ret
+
+0000000000802d1d <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  802d1d:	55                   	push   %rbp
+  802d1e:	48 89 e5             	mov    %rsp,%rbp
+  802d21:	48 83 ec 18          	sub    $0x18,%rsp
+  802d25:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  802d29:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802d30:	e9 ae 00 00 00       	jmp    802de3 <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  802d35:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802d38:	c1 e0 0c             	shl    $0xc,%eax
+  802d3b:	48 98                	cltq
+  802d3d:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802d42:	48 01 d0             	add    %rdx,%rax
+  802d45:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802d49:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d4d:	48 c1 e8 27          	shr    $0x27,%rax
+  802d51:	48 89 c2             	mov    %rax,%rdx
+  802d54:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802d5b:	01 00 00 
+  802d5e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d62:	83 e0 01             	and    $0x1,%eax
+  802d65:	48 85 c0             	test   %rax,%rax
+  802d68:	74 63                	je     802dcd <fd_alloc+0xb0>
+  802d6a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d6e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d72:	48 89 c2             	mov    %rax,%rdx
+  802d75:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802d7c:	01 00 00 
+  802d7f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d83:	83 e0 01             	and    $0x1,%eax
+  802d86:	48 85 c0             	test   %rax,%rax
+  802d89:	74 42                	je     802dcd <fd_alloc+0xb0>
+  802d8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d8f:	48 c1 e8 15          	shr    $0x15,%rax
+  802d93:	48 89 c2             	mov    %rax,%rdx
+  802d96:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802d9d:	01 00 00 
+  802da0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802da4:	83 e0 01             	and    $0x1,%eax
+  802da7:	48 85 c0             	test   %rax,%rax
+  802daa:	74 21                	je     802dcd <fd_alloc+0xb0>
+  802dac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802db0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802db4:	48 89 c2             	mov    %rax,%rdx
+  802db7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802dbe:	01 00 00 
+  802dc1:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802dc5:	83 e0 01             	and    $0x1,%eax
+  802dc8:	48 85 c0             	test   %rax,%rax
+  802dcb:	75 12                	jne    802ddf <fd_alloc+0xc2>
+      *fd_store = fd;
+  802dcd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802dd1:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802dd5:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ddd:	eb 1e                	jmp    802dfd <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802ddf:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802de3:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802de7:	0f 8e 48 ff ff ff    	jle    802d35 <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802ded:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802df1:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802df8:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802dfd:	c9                   	leave
+  802dfe:	c3                   	ret
+
+0000000000802dff <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802dff:	55                   	push   %rbp
+  802e00:	48 89 e5             	mov    %rsp,%rbp
+  802e03:	48 83 ec 20          	sub    $0x20,%rsp
+  802e07:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802e0a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  802e0e:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  802e12:	78 06                	js     802e1a <fd_lookup+0x1b>
+  802e14:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  802e18:	7e 0a                	jle    802e24 <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802e1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e1f:	e9 af 00 00 00       	jmp    802ed3 <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  802e24:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802e27:	c1 e0 0c             	shl    $0xc,%eax
+  802e2a:	48 98                	cltq
+  802e2c:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802e31:	48 01 d0             	add    %rdx,%rax
+  802e34:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  802e38:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e3c:	48 c1 e8 27          	shr    $0x27,%rax
+  802e40:	48 89 c2             	mov    %rax,%rdx
+  802e43:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802e4a:	01 00 00 
+  802e4d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e51:	83 e0 01             	and    $0x1,%eax
+  802e54:	48 85 c0             	test   %rax,%rax
+  802e57:	74 63                	je     802ebc <fd_lookup+0xbd>
+  802e59:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e5d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e61:	48 89 c2             	mov    %rax,%rdx
+  802e64:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802e6b:	01 00 00 
+  802e6e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e72:	83 e0 01             	and    $0x1,%eax
+  802e75:	48 85 c0             	test   %rax,%rax
+  802e78:	74 42                	je     802ebc <fd_lookup+0xbd>
+  802e7a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e7e:	48 c1 e8 15          	shr    $0x15,%rax
+  802e82:	48 89 c2             	mov    %rax,%rdx
+  802e85:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802e8c:	01 00 00 
+  802e8f:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802e93:	83 e0 01             	and    $0x1,%eax
+  802e96:	48 85 c0             	test   %rax,%rax
+  802e99:	74 21                	je     802ebc <fd_lookup+0xbd>
+  802e9b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802e9f:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ea3:	48 89 c2             	mov    %rax,%rdx
+  802ea6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ead:	01 00 00 
+  802eb0:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802eb4:	83 e0 01             	and    $0x1,%eax
+  802eb7:	48 85 c0             	test   %rax,%rax
+  802eba:	75 07                	jne    802ec3 <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802ebc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ec1:	eb 10                	jmp    802ed3 <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  802ec3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802ec7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802ecb:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802ece:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed3:	c9                   	leave
+  802ed4:	c3                   	ret
+
+0000000000802ed5 <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  802ed5:	55                   	push   %rbp
+  802ed6:	48 89 e5             	mov    %rsp,%rbp
+  802ed9:	48 83 ec 30          	sub    $0x30,%rsp
+  802edd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802ee1:	89 f0                	mov    %esi,%eax
+  802ee3:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  802ee6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802eea:	48 89 c7             	mov    %rax,%rdi
+  802eed:	48 b8 cf 2c 80 00 00 	movabs $0x802ccf,%rax
+  802ef4:	00 00 00 
+  802ef7:	ff d0                	call   *%rax
+  802ef9:	89 c2                	mov    %eax,%edx
+  802efb:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802eff:	48 89 c6             	mov    %rax,%rsi
+  802f02:	89 d7                	mov    %edx,%edi
+  802f04:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  802f0b:	00 00 00 
+  802f0e:	ff d0                	call   *%rax
+  802f10:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f13:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f17:	78 0a                	js     802f23 <fd_close+0x4e>
+  802f19:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802f1d:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  802f21:	74 12                	je     802f35 <fd_close+0x60>
+    return (must_exist ? r : 0);
+  802f23:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  802f27:	74 05                	je     802f2e <fd_close+0x59>
+  802f29:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f2c:	eb 70                	jmp    802f9e <fd_close+0xc9>
+  802f2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f33:	eb 69                	jmp    802f9e <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802f35:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f39:	8b 00                	mov    (%rax),%eax
+  802f3b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802f3f:	48 89 d6             	mov    %rdx,%rsi
+  802f42:	89 c7                	mov    %eax,%edi
+  802f44:	48 b8 a0 2f 80 00 00 	movabs $0x802fa0,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+  802f50:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f53:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802f57:	78 2a                	js     802f83 <fd_close+0xae>
+    if (dev->dev_close)
+  802f59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f5d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802f61:	48 85 c0             	test   %rax,%rax
+  802f64:	74 16                	je     802f7c <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  802f66:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802f6a:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802f6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f72:	48 89 c7             	mov    %rax,%rdi
+  802f75:	ff d2                	call   *%rdx
+  802f77:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f7a:	eb 07                	jmp    802f83 <fd_close+0xae>
+    else
+      r = 0;
+  802f7c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802f83:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802f87:	48 89 c6             	mov    %rax,%rsi
+  802f8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f8f:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  802f96:	00 00 00 
+  802f99:	ff d0                	call   *%rax
+  return r;
+  802f9b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802f9e:	c9                   	leave
+  802f9f:	c3                   	ret
+
+0000000000802fa0 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802fa0:	55                   	push   %rbp
+  802fa1:	48 89 e5             	mov    %rsp,%rbp
+  802fa4:	48 83 ec 20          	sub    $0x20,%rsp
+  802fa8:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802fab:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802faf:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802fb6:	eb 3f                	jmp    802ff7 <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802fb8:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802fbf:	00 00 00 
+  802fc2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fc5:	48 98                	cltq
+  802fc7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802fcb:	8b 00                	mov    (%rax),%eax
+  802fcd:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802fd0:	75 21                	jne    802ff3 <dev_lookup+0x53>
+      *dev = devtab[i];
+  802fd2:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802fd9:	00 00 00 
+  802fdc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fdf:	48 98                	cltq
+  802fe1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802fe5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802fe9:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802fec:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff1:	eb 7f                	jmp    803072 <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802ff3:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802ff7:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802ffe:	00 00 00 
+  803001:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803004:	48 98                	cltq
+  803006:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80300a:	48 85 c0             	test   %rax,%rax
+  80300d:	75 a9                	jne    802fb8 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80300f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803016:	00 00 00 
+  803019:	8b 40 04             	mov    0x4(%rax),%eax
+  80301c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803021:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803028:	00 00 00 
+  80302b:	48 98                	cltq
+  80302d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803034:	48 01 d0             	add    %rdx,%rax
+  803037:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80303d:	8b 00                	mov    (%rax),%eax
+  80303f:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  803042:	89 c6                	mov    %eax,%esi
+  803044:	48 b8 f8 5a 80 00 00 	movabs $0x805af8,%rax
+  80304b:	00 00 00 
+  80304e:	48 89 c7             	mov    %rax,%rdi
+  803051:	b8 00 00 00 00       	mov    $0x0,%eax
+  803056:	48 b9 6a 08 80 00 00 	movabs $0x80086a,%rcx
+  80305d:	00 00 00 
+  803060:	ff d1                	call   *%rcx
+  *dev = 0;
+  803062:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803066:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  80306d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803072:	c9                   	leave
+  803073:	c3                   	ret
+
+0000000000803074 <close>:
+
+int
+close(int fdnum) {
+  803074:	55                   	push   %rbp
+  803075:	48 89 e5             	mov    %rsp,%rbp
+  803078:	48 83 ec 20          	sub    $0x20,%rsp
+  80307c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80307f:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803083:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803086:	48 89 d6             	mov    %rdx,%rsi
+  803089:	89 c7                	mov    %eax,%edi
+  80308b:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  803092:	00 00 00 
+  803095:	ff d0                	call   *%rax
+  803097:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80309a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80309e:	79 05                	jns    8030a5 <close+0x31>
+    return r;
+  8030a0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030a3:	eb 18                	jmp    8030bd <close+0x49>
+  else
+    return fd_close(fd, 1);
+  8030a5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8030ae:	48 89 c7             	mov    %rax,%rdi
+  8030b1:	48 b8 d5 2e 80 00 00 	movabs $0x802ed5,%rax
+  8030b8:	00 00 00 
+  8030bb:	ff d0                	call   *%rax
+}
+  8030bd:	c9                   	leave
+  8030be:	c3                   	ret
+
+00000000008030bf <close_all>:
+
+void
+close_all(void) {
+  8030bf:	55                   	push   %rbp
+  8030c0:	48 89 e5             	mov    %rsp,%rbp
+  8030c3:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  8030c7:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8030ce:	eb 15                	jmp    8030e5 <close_all+0x26>
+    close(i);
+  8030d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030d3:	89 c7                	mov    %eax,%edi
+  8030d5:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  8030dc:	00 00 00 
+  8030df:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  8030e1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8030e5:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  8030e9:	7e e5                	jle    8030d0 <close_all+0x11>
+}
+  8030eb:	90                   	nop
+  8030ec:	90                   	nop
+  8030ed:	c9                   	leave
+  8030ee:	c3                   	ret
+
+00000000008030ef <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  8030ef:	55                   	push   %rbp
+  8030f0:	48 89 e5             	mov    %rsp,%rbp
+  8030f3:	48 83 ec 40          	sub    $0x40,%rsp
+  8030f7:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  8030fa:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8030fd:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  803101:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  803104:	48 89 d6             	mov    %rdx,%rsi
+  803107:	89 c7                	mov    %eax,%edi
+  803109:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  803110:	00 00 00 
+  803113:	ff d0                	call   *%rax
+  803115:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803118:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80311c:	79 08                	jns    803126 <dup+0x37>
+    return r;
+  80311e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803121:	e9 33 02 00 00       	jmp    803359 <dup+0x26a>
+  close(newfdnum);
+  803126:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803129:	89 c7                	mov    %eax,%edi
+  80312b:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803132:	00 00 00 
+  803135:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  803137:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80313a:	c1 e0 0c             	shl    $0xc,%eax
+  80313d:	48 98                	cltq
+  80313f:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  803144:	48 01 d0             	add    %rdx,%rax
+  803147:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  80314b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80314f:	48 89 c7             	mov    %rax,%rdi
+  803152:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  803159:	00 00 00 
+  80315c:	ff d0                	call   *%rax
+  80315e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  803162:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803166:	48 89 c7             	mov    %rax,%rdi
+  803169:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  803170:	00 00 00 
+  803173:	ff d0                	call   *%rax
+  803175:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  803179:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  803180:	00 
+  803181:	e9 19 01 00 00       	jmp    80329f <dup+0x1b0>
+    off -= PGSIZE;
+  803186:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  80318d:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  80318e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803192:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803196:	48 01 d0             	add    %rdx,%rax
+  803199:	48 c1 e8 27          	shr    $0x27,%rax
+  80319d:	48 89 c2             	mov    %rax,%rdx
+  8031a0:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8031a7:	01 00 00 
+  8031aa:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031ae:	83 e0 01             	and    $0x1,%eax
+  8031b1:	48 85 c0             	test   %rax,%rax
+  8031b4:	0f 84 e5 00 00 00    	je     80329f <dup+0x1b0>
+  8031ba:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8031be:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031c2:	48 01 d0             	add    %rdx,%rax
+  8031c5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8031c9:	48 89 c2             	mov    %rax,%rdx
+  8031cc:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  8031d3:	01 00 00 
+  8031d6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8031da:	83 e0 01             	and    $0x1,%eax
+  8031dd:	48 85 c0             	test   %rax,%rax
+  8031e0:	0f 84 b9 00 00 00    	je     80329f <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8031e6:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8031ea:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8031ee:	48 01 d0             	add    %rdx,%rax
+  8031f1:	48 c1 e8 15          	shr    $0x15,%rax
+  8031f5:	48 89 c2             	mov    %rax,%rdx
+  8031f8:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  8031ff:	01 00 00 
+  803202:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803206:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  803209:	48 85 c0             	test   %rax,%rax
+  80320c:	0f 84 8d 00 00 00    	je     80329f <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  803212:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803216:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80321a:	48 01 d0             	add    %rdx,%rax
+  80321d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803221:	48 89 c2             	mov    %rax,%rdx
+  803224:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80322b:	01 00 00 
+  80322e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  803232:	83 e0 01             	and    $0x1,%eax
+  803235:	48 85 c0             	test   %rax,%rax
+  803238:	74 65                	je     80329f <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80323a:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80323e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803242:	48 01 d0             	add    %rdx,%rax
+  803245:	48 c1 e8 0c          	shr    $0xc,%rax
+  803249:	48 89 c2             	mov    %rax,%rdx
+  80324c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803253:	01 00 00 
+  803256:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80325a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80325f:	89 c6                	mov    %eax,%esi
+  803261:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803265:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803269:	48 01 c2             	add    %rax,%rdx
+  80326c:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  803270:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803274:	48 01 c8             	add    %rcx,%rax
+  803277:	41 89 f0             	mov    %esi,%r8d
+  80327a:	48 89 d1             	mov    %rdx,%rcx
+  80327d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803282:	48 89 c6             	mov    %rax,%rsi
+  803285:	bf 00 00 00 00       	mov    $0x0,%edi
+  80328a:	48 b8 40 26 80 00 00 	movabs $0x802640,%rax
+  803291:	00 00 00 
+  803294:	ff d0                	call   *%rax
+  803296:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803299:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80329d:	78 60                	js     8032ff <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  80329f:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  8032a4:	0f 85 dc fe ff ff    	jne    803186 <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8032aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032ae:	48 c1 e8 0c          	shr    $0xc,%rax
+  8032b2:	48 89 c2             	mov    %rax,%rdx
+  8032b5:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8032bc:	01 00 00 
+  8032bf:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8032c3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8032c8:	89 c1                	mov    %eax,%ecx
+  8032ca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8032ce:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8032d2:	41 89 c8             	mov    %ecx,%r8d
+  8032d5:	48 89 d1             	mov    %rdx,%rcx
+  8032d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032dd:	48 89 c6             	mov    %rax,%rsi
+  8032e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032e5:	48 b8 40 26 80 00 00 	movabs $0x802640,%rax
+  8032ec:	00 00 00 
+  8032ef:	ff d0                	call   *%rax
+  8032f1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8032f4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8032f8:	78 08                	js     803302 <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  8032fa:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8032fd:	eb 5a                	jmp    803359 <dup+0x26a>
+        goto err;
+  8032ff:	90                   	nop
+  803300:	eb 01                	jmp    803303 <dup+0x214>
+    goto err;
+  803302:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  803303:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803307:	48 89 c6             	mov    %rax,%rsi
+  80330a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80330f:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  803316:	00 00 00 
+  803319:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80331b:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803322:	00 
+  803323:	eb 27                	jmp    80334c <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  803325:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803329:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80332d:	48 01 d0             	add    %rdx,%rax
+  803330:	48 89 c6             	mov    %rax,%rsi
+  803333:	bf 00 00 00 00       	mov    $0x0,%edi
+  803338:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  80333f:	00 00 00 
+  803342:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  803344:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  80334b:	00 
+  80334c:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  803353:	00 
+  803354:	76 cf                	jbe    803325 <dup+0x236>
+  return r;
+  803356:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803359:	c9                   	leave
+  80335a:	c3                   	ret
+
+000000000080335b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80335b:	55                   	push   %rbp
+  80335c:	48 89 e5             	mov    %rsp,%rbp
+  80335f:	48 83 ec 40          	sub    $0x40,%rsp
+  803363:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803366:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  80336a:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80336e:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803372:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803375:	48 89 d6             	mov    %rdx,%rsi
+  803378:	89 c7                	mov    %eax,%edi
+  80337a:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+  803386:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803389:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80338d:	78 24                	js     8033b3 <read+0x58>
+  80338f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803393:	8b 00                	mov    (%rax),%eax
+  803395:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803399:	48 89 d6             	mov    %rdx,%rsi
+  80339c:	89 c7                	mov    %eax,%edi
+  80339e:	48 b8 a0 2f 80 00 00 	movabs $0x802fa0,%rax
+  8033a5:	00 00 00 
+  8033a8:	ff d0                	call   *%rax
+  8033aa:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8033ad:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8033b1:	79 0a                	jns    8033bd <read+0x62>
+    return r;
+  8033b3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8033b6:	48 98                	cltq
+  8033b8:	e9 9e 00 00 00       	jmp    80345b <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8033bd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8033c1:	8b 40 08             	mov    0x8(%rax),%eax
+  8033c4:	83 e0 03             	and    $0x3,%eax
+  8033c7:	83 f8 01             	cmp    $0x1,%eax
+  8033ca:	75 5c                	jne    803428 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8033cc:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8033d3:	00 00 00 
+  8033d6:	8b 40 04             	mov    0x4(%rax),%eax
+  8033d9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8033de:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8033e5:	00 00 00 
+  8033e8:	48 98                	cltq
+  8033ea:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8033f1:	48 01 d0             	add    %rdx,%rax
+  8033f4:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8033fa:	8b 00                	mov    (%rax),%eax
+  8033fc:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8033ff:	89 c6                	mov    %eax,%esi
+  803401:	48 b8 17 5b 80 00 00 	movabs $0x805b17,%rax
+  803408:	00 00 00 
+  80340b:	48 89 c7             	mov    %rax,%rdi
+  80340e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803413:	48 b9 6a 08 80 00 00 	movabs $0x80086a,%rcx
+  80341a:	00 00 00 
+  80341d:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80341f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803426:	eb 33                	jmp    80345b <read+0x100>
+  }
+  if (!dev->dev_read)
+  803428:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80342c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  803430:	48 85 c0             	test   %rax,%rax
+  803433:	75 09                	jne    80343e <read+0xe3>
+    return -E_NOT_SUPP;
+  803435:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80343c:	eb 1d                	jmp    80345b <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  80343e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803442:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  803446:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80344a:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80344e:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803452:	48 89 ce             	mov    %rcx,%rsi
+  803455:	48 89 c7             	mov    %rax,%rdi
+  803458:	41 ff d0             	call   *%r8
+}
+  80345b:	c9                   	leave
+  80345c:	c3                   	ret
+
+000000000080345d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80345d:	55                   	push   %rbp
+  80345e:	48 89 e5             	mov    %rsp,%rbp
+  803461:	48 83 ec 30          	sub    $0x30,%rsp
+  803465:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  803468:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80346c:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  803470:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  803477:	eb 49                	jmp    8034c2 <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  803479:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80347c:	48 98                	cltq
+  80347e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803482:	48 29 c2             	sub    %rax,%rdx
+  803485:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803488:	48 63 c8             	movslq %eax,%rcx
+  80348b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80348f:	48 01 c1             	add    %rax,%rcx
+  803492:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803495:	48 89 ce             	mov    %rcx,%rsi
+  803498:	89 c7                	mov    %eax,%edi
+  80349a:	48 b8 5b 33 80 00 00 	movabs $0x80335b,%rax
+  8034a1:	00 00 00 
+  8034a4:	ff d0                	call   *%rax
+  8034a6:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  8034a9:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8034ad:	79 07                	jns    8034b6 <readn+0x59>
+      return m;
+  8034af:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8034b2:	48 98                	cltq
+  8034b4:	eb 1f                	jmp    8034d5 <readn+0x78>
+    if (m == 0)
+  8034b6:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  8034ba:	74 13                	je     8034cf <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  8034bc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8034bf:	01 45 fc             	add    %eax,-0x4(%rbp)
+  8034c2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034c5:	48 98                	cltq
+  8034c7:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  8034cb:	72 ac                	jb     803479 <readn+0x1c>
+  8034cd:	eb 01                	jmp    8034d0 <readn+0x73>
+      break;
+  8034cf:	90                   	nop
+  }
+  return tot;
+  8034d0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8034d3:	48 98                	cltq
+}
+  8034d5:	c9                   	leave
+  8034d6:	c3                   	ret
+
+00000000008034d7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8034d7:	55                   	push   %rbp
+  8034d8:	48 89 e5             	mov    %rsp,%rbp
+  8034db:	48 83 ec 40          	sub    $0x40,%rsp
+  8034df:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8034e2:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  8034e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8034ea:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8034ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8034f1:	48 89 d6             	mov    %rdx,%rsi
+  8034f4:	89 c7                	mov    %eax,%edi
+  8034f6:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  8034fd:	00 00 00 
+  803500:	ff d0                	call   *%rax
+  803502:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803505:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803509:	78 24                	js     80352f <write+0x58>
+  80350b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80350f:	8b 00                	mov    (%rax),%eax
+  803511:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803515:	48 89 d6             	mov    %rdx,%rsi
+  803518:	89 c7                	mov    %eax,%edi
+  80351a:	48 b8 a0 2f 80 00 00 	movabs $0x802fa0,%rax
+  803521:	00 00 00 
+  803524:	ff d0                	call   *%rax
+  803526:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803529:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80352d:	79 0a                	jns    803539 <write+0x62>
+    return r;
+  80352f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803532:	48 98                	cltq
+  803534:	e9 9d 00 00 00       	jmp    8035d6 <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803539:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80353d:	8b 40 08             	mov    0x8(%rax),%eax
+  803540:	83 e0 03             	and    $0x3,%eax
+  803543:	85 c0                	test   %eax,%eax
+  803545:	75 5c                	jne    8035a3 <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  803547:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80354e:	00 00 00 
+  803551:	8b 40 04             	mov    0x4(%rax),%eax
+  803554:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803559:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803560:	00 00 00 
+  803563:	48 98                	cltq
+  803565:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80356c:	48 01 d0             	add    %rdx,%rax
+  80356f:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  803575:	8b 00                	mov    (%rax),%eax
+  803577:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80357a:	89 c6                	mov    %eax,%esi
+  80357c:	48 b8 33 5b 80 00 00 	movabs $0x805b33,%rax
+  803583:	00 00 00 
+  803586:	48 89 c7             	mov    %rax,%rdi
+  803589:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358e:	48 b9 6a 08 80 00 00 	movabs $0x80086a,%rcx
+  803595:	00 00 00 
+  803598:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  80359a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8035a1:	eb 33                	jmp    8035d6 <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  8035a3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035a7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035ab:	48 85 c0             	test   %rax,%rax
+  8035ae:	75 09                	jne    8035b9 <write+0xe2>
+    return -E_NOT_SUPP;
+  8035b0:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  8035b7:	eb 1d                	jmp    8035d6 <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  8035b9:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8035bd:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  8035c1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8035c5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8035c9:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  8035cd:	48 89 ce             	mov    %rcx,%rsi
+  8035d0:	48 89 c7             	mov    %rax,%rdi
+  8035d3:	41 ff d0             	call   *%r8
+}
+  8035d6:	c9                   	leave
+  8035d7:	c3                   	ret
+
+00000000008035d8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8035d8:	55                   	push   %rbp
+  8035d9:	48 89 e5             	mov    %rsp,%rbp
+  8035dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8035e0:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8035e3:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035e6:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8035ea:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8035ed:	48 89 d6             	mov    %rdx,%rsi
+  8035f0:	89 c7                	mov    %eax,%edi
+  8035f2:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  8035f9:	00 00 00 
+  8035fc:	ff d0                	call   *%rax
+  8035fe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803601:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803605:	79 05                	jns    80360c <seek+0x34>
+    return r;
+  803607:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80360a:	eb 0f                	jmp    80361b <seek+0x43>
+  fd->fd_offset = offset;
+  80360c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803610:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  803613:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  803616:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80361b:	c9                   	leave
+  80361c:	c3                   	ret
+
+000000000080361d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80361d:	55                   	push   %rbp
+  80361e:	48 89 e5             	mov    %rsp,%rbp
+  803621:	48 83 ec 30          	sub    $0x30,%rsp
+  803625:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803628:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80362b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80362f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803632:	48 89 d6             	mov    %rdx,%rsi
+  803635:	89 c7                	mov    %eax,%edi
+  803637:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  80363e:	00 00 00 
+  803641:	ff d0                	call   *%rax
+  803643:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803646:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80364a:	78 24                	js     803670 <ftruncate+0x53>
+  80364c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803650:	8b 00                	mov    (%rax),%eax
+  803652:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803656:	48 89 d6             	mov    %rdx,%rsi
+  803659:	89 c7                	mov    %eax,%edi
+  80365b:	48 b8 a0 2f 80 00 00 	movabs $0x802fa0,%rax
+  803662:	00 00 00 
+  803665:	ff d0                	call   *%rax
+  803667:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80366a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80366e:	79 08                	jns    803678 <ftruncate+0x5b>
+    return r;
+  803670:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803673:	e9 92 00 00 00       	jmp    80370a <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803678:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80367c:	8b 40 08             	mov    0x8(%rax),%eax
+  80367f:	83 e0 03             	and    $0x3,%eax
+  803682:	85 c0                	test   %eax,%eax
+  803684:	75 5a                	jne    8036e0 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  803686:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80368d:	00 00 00 
+  803690:	8b 40 04             	mov    0x4(%rax),%eax
+  803693:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803698:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80369f:	00 00 00 
+  8036a2:	48 98                	cltq
+  8036a4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8036ab:	48 01 d0             	add    %rdx,%rax
+  8036ae:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8036b4:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8036b6:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8036b9:	89 c6                	mov    %eax,%esi
+  8036bb:	48 b8 50 5b 80 00 00 	movabs $0x805b50,%rax
+  8036c2:	00 00 00 
+  8036c5:	48 89 c7             	mov    %rax,%rdi
+  8036c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036cd:	48 b9 6a 08 80 00 00 	movabs $0x80086a,%rcx
+  8036d4:	00 00 00 
+  8036d7:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  8036d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036de:	eb 2a                	jmp    80370a <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  8036e0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036e4:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8036e8:	48 85 c0             	test   %rax,%rax
+  8036eb:	75 07                	jne    8036f4 <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  8036ed:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  8036f2:	eb 16                	jmp    80370a <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  8036f4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8036f8:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  8036fc:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803700:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  803703:	89 d6                	mov    %edx,%esi
+  803705:	48 89 c7             	mov    %rax,%rdi
+  803708:	ff d1                	call   *%rcx
+}
+  80370a:	c9                   	leave
+  80370b:	c3                   	ret
+
+000000000080370c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80370c:	55                   	push   %rbp
+  80370d:	48 89 e5             	mov    %rsp,%rbp
+  803710:	48 83 ec 30          	sub    $0x30,%rsp
+  803714:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  803717:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80371b:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80371f:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803722:	48 89 d6             	mov    %rdx,%rsi
+  803725:	89 c7                	mov    %eax,%edi
+  803727:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  80372e:	00 00 00 
+  803731:	ff d0                	call   *%rax
+  803733:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803736:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80373a:	78 24                	js     803760 <fstat+0x54>
+  80373c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803740:	8b 00                	mov    (%rax),%eax
+  803742:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803746:	48 89 d6             	mov    %rdx,%rsi
+  803749:	89 c7                	mov    %eax,%edi
+  80374b:	48 b8 a0 2f 80 00 00 	movabs $0x802fa0,%rax
+  803752:	00 00 00 
+  803755:	ff d0                	call   *%rax
+  803757:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80375a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80375e:	79 05                	jns    803765 <fstat+0x59>
+    return r;
+  803760:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803763:	eb 5e                	jmp    8037c3 <fstat+0xb7>
+  if (!dev->dev_stat)
+  803765:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803769:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80376d:	48 85 c0             	test   %rax,%rax
+  803770:	75 07                	jne    803779 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  803772:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  803777:	eb 4a                	jmp    8037c3 <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803779:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80377d:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803780:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803784:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  80378b:	00 00 00 
+  stat->st_isdir   = 0;
+  80378e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803792:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803799:	00 00 00 
+  stat->st_dev     = dev;
+  80379c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8037a0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8037a4:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  8037ab:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037af:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  8037b3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037b7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8037bb:	48 89 d6             	mov    %rdx,%rsi
+  8037be:	48 89 c7             	mov    %rax,%rdi
+  8037c1:	ff d1                	call   *%rcx
+}
+  8037c3:	c9                   	leave
+  8037c4:	c3                   	ret
+
+00000000008037c5 <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  8037c5:	55                   	push   %rbp
+  8037c6:	48 89 e5             	mov    %rsp,%rbp
+  8037c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8037cd:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8037d1:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  8037d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037d9:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8037df:	83 f8 20             	cmp    $0x20,%eax
+  8037e2:	75 07                	jne    8037eb <pollwait_key+0x26>
+    return -E_INVAL;
+  8037e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037e9:	eb 5f                	jmp    80384a <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  8037eb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037ef:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  8037f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8037f9:	48 63 d2             	movslq %edx,%rdx
+  8037fc:	48 c1 e2 04          	shl    $0x4,%rdx
+  803800:	48 01 c2             	add    %rax,%rdx
+  803803:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803807:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  80380a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80380e:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  803814:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803818:	8b 00                	mov    (%rax),%eax
+  80381a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80381e:	48 63 c9             	movslq %ecx,%rcx
+  803821:	48 c1 e1 04          	shl    $0x4,%rcx
+  803825:	48 01 ca             	add    %rcx,%rdx
+  803828:	48 83 c2 08          	add    $0x8,%rdx
+  80382c:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  80382e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803832:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803838:	8d 50 01             	lea    0x1(%rax),%edx
+  80383b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80383f:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  803845:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80384a:	c9                   	leave
+  80384b:	c3                   	ret
+
+000000000080384c <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  80384c:	55                   	push   %rbp
+  80384d:	48 89 e5             	mov    %rsp,%rbp
+  803850:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  803857:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  80385e:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  803864:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  80386b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803872:	00 
+  int i, r, ready, ipc = 0;
+  803873:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  80387a:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803881:	00 
+  803882:	74 45                	je     8038c9 <poll+0x7d>
+  803884:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  80388b:	ff 
+  80388c:	74 3b                	je     8038c9 <poll+0x7d>
+    now      = vsys_clock_ns();
+  80388e:	48 b8 87 4d 80 00 00 	movabs $0x804d87,%rax
+  803895:	00 00 00 
+  803898:	ff d0                	call   *%rax
+  80389a:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  80389e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8038a2:	48 f7 d0             	not    %rax
+  8038a5:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  8038ac:	73 10                	jae    8038be <poll+0x72>
+  8038ae:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8038b2:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  8038b9:	48 01 d0             	add    %rdx,%rax
+  8038bc:	eb 07                	jmp    8038c5 <poll+0x79>
+  8038be:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  8038c5:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  8038c9:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  8038d0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  8038d7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8038de:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  8038e5:	e9 46 02 00 00       	jmp    803b30 <poll+0x2e4>
+      fds[i].revents = 0;
+  8038ea:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038ed:	48 63 d0             	movslq %eax,%rdx
+  8038f0:	48 89 d0             	mov    %rdx,%rax
+  8038f3:	48 01 c0             	add    %rax,%rax
+  8038f6:	48 01 d0             	add    %rdx,%rax
+  8038f9:	48 c1 e0 02          	shl    $0x2,%rax
+  8038fd:	48 89 c2             	mov    %rax,%rdx
+  803900:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803907:	48 01 d0             	add    %rdx,%rax
+  80390a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  803911:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803914:	48 63 d0             	movslq %eax,%rdx
+  803917:	48 89 d0             	mov    %rdx,%rax
+  80391a:	48 01 c0             	add    %rax,%rax
+  80391d:	48 01 d0             	add    %rdx,%rax
+  803920:	48 c1 e0 02          	shl    $0x2,%rax
+  803924:	48 89 c2             	mov    %rax,%rdx
+  803927:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80392e:	48 01 d0             	add    %rdx,%rax
+  803931:	8b 00                	mov    (%rax),%eax
+  803933:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  803936:	75 62                	jne    80399a <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  803938:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80393b:	48 63 d0             	movslq %eax,%rdx
+  80393e:	48 89 d0             	mov    %rdx,%rax
+  803941:	48 01 c0             	add    %rax,%rax
+  803944:	48 01 d0             	add    %rdx,%rax
+  803947:	48 c1 e0 02          	shl    $0x2,%rax
+  80394b:	48 89 c2             	mov    %rax,%rdx
+  80394e:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803955:	48 01 d0             	add    %rdx,%rax
+  803958:	8b 40 04             	mov    0x4(%rax),%eax
+  80395b:	83 e0 01             	and    $0x1,%eax
+  80395e:	85 c0                	test   %eax,%eax
+  803960:	0f 84 9b 01 00 00    	je     803b01 <poll+0x2b5>
+          fds[i].revents = ipc;
+  803966:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803969:	48 63 d0             	movslq %eax,%rdx
+  80396c:	48 89 d0             	mov    %rdx,%rax
+  80396f:	48 01 c0             	add    %rax,%rax
+  803972:	48 01 d0             	add    %rdx,%rax
+  803975:	48 c1 e0 02          	shl    $0x2,%rax
+  803979:	48 89 c2             	mov    %rax,%rdx
+  80397c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803983:	48 01 c2             	add    %rax,%rdx
+  803986:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803989:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  80398c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80398f:	83 c8 04             	or     $0x4,%eax
+  803992:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  803995:	e9 67 01 00 00       	jmp    803b01 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  80399a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80399d:	48 63 d0             	movslq %eax,%rdx
+  8039a0:	48 89 d0             	mov    %rdx,%rax
+  8039a3:	48 01 c0             	add    %rax,%rax
+  8039a6:	48 01 d0             	add    %rdx,%rax
+  8039a9:	48 c1 e0 02          	shl    $0x2,%rax
+  8039ad:	48 89 c2             	mov    %rax,%rdx
+  8039b0:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8039b7:	48 01 d0             	add    %rdx,%rax
+  8039ba:	8b 00                	mov    (%rax),%eax
+  8039bc:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  8039c3:	48 89 d6             	mov    %rdx,%rsi
+  8039c6:	89 c7                	mov    %eax,%edi
+  8039c8:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+  8039d4:	85 c0                	test   %eax,%eax
+  8039d6:	78 25                	js     8039fd <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  8039d8:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  8039df:	8b 00                	mov    (%rax),%eax
+  8039e1:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  8039e8:	48 89 d6             	mov    %rdx,%rsi
+  8039eb:	89 c7                	mov    %eax,%edi
+  8039ed:	48 b8 a0 2f 80 00 00 	movabs $0x802fa0,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  8039f9:	85 c0                	test   %eax,%eax
+  8039fb:	79 2c                	jns    803a29 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  8039fd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a00:	48 63 d0             	movslq %eax,%rdx
+  803a03:	48 89 d0             	mov    %rdx,%rax
+  803a06:	48 01 c0             	add    %rax,%rax
+  803a09:	48 01 d0             	add    %rdx,%rax
+  803a0c:	48 c1 e0 02          	shl    $0x2,%rax
+  803a10:	48 89 c2             	mov    %rax,%rdx
+  803a13:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803a1a:	48 01 d0             	add    %rdx,%rax
+  803a1d:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  803a24:	e9 d8 00 00 00       	jmp    803b01 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  803a29:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803a30:	48 8b 40 38          	mov    0x38(%rax),%rax
+  803a34:	48 85 c0             	test   %rax,%rax
+  803a37:	74 7d                	je     803ab6 <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  803a39:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  803a40:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  803a44:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a47:	48 63 d0             	movslq %eax,%rdx
+  803a4a:	48 89 d0             	mov    %rdx,%rax
+  803a4d:	48 01 c0             	add    %rax,%rax
+  803a50:	48 01 d0             	add    %rdx,%rax
+  803a53:	48 c1 e0 02          	shl    $0x2,%rax
+  803a57:	48 89 c2             	mov    %rax,%rdx
+  803a5a:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803a61:	48 01 d0             	add    %rdx,%rax
+  803a64:	8b 48 04             	mov    0x4(%rax),%ecx
+  803a67:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803a6e:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  803a75:	89 ce                	mov    %ecx,%esi
+  803a77:	48 89 c7             	mov    %rax,%rdi
+  803a7a:	41 ff d0             	call   *%r8
+  803a7d:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803a80:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a84:	79 08                	jns    803a8e <poll+0x242>
+          return r;
+  803a86:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a89:	e9 45 01 00 00       	jmp    803bd3 <poll+0x387>
+        fds[i].revents = r;
+  803a8e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803a91:	48 63 d0             	movslq %eax,%rdx
+  803a94:	48 89 d0             	mov    %rdx,%rax
+  803a97:	48 01 c0             	add    %rax,%rax
+  803a9a:	48 01 d0             	add    %rdx,%rax
+  803a9d:	48 c1 e0 02          	shl    $0x2,%rax
+  803aa1:	48 89 c2             	mov    %rax,%rdx
+  803aa4:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803aab:	48 01 c2             	add    %rax,%rdx
+  803aae:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803ab1:	89 42 08             	mov    %eax,0x8(%rdx)
+  803ab4:	eb 4b                	jmp    803b01 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  803ab6:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ab9:	48 63 d0             	movslq %eax,%rdx
+  803abc:	48 89 d0             	mov    %rdx,%rax
+  803abf:	48 01 c0             	add    %rax,%rax
+  803ac2:	48 01 d0             	add    %rdx,%rax
+  803ac5:	48 c1 e0 02          	shl    $0x2,%rax
+  803ac9:	48 89 c2             	mov    %rax,%rdx
+  803acc:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803ad3:	48 01 d0             	add    %rdx,%rax
+  803ad6:	8b 48 04             	mov    0x4(%rax),%ecx
+  803ad9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803adc:	48 63 d0             	movslq %eax,%rdx
+  803adf:	48 89 d0             	mov    %rdx,%rax
+  803ae2:	48 01 c0             	add    %rax,%rax
+  803ae5:	48 01 d0             	add    %rdx,%rax
+  803ae8:	48 c1 e0 02          	shl    $0x2,%rax
+  803aec:	48 89 c2             	mov    %rax,%rdx
+  803aef:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803af6:	48 01 d0             	add    %rdx,%rax
+  803af9:	83 e1 03             	and    $0x3,%ecx
+  803afc:	89 ca                	mov    %ecx,%edx
+  803afe:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803b01:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b04:	48 63 d0             	movslq %eax,%rdx
+  803b07:	48 89 d0             	mov    %rdx,%rax
+  803b0a:	48 01 c0             	add    %rax,%rax
+  803b0d:	48 01 d0             	add    %rdx,%rax
+  803b10:	48 c1 e0 02          	shl    $0x2,%rax
+  803b14:	48 89 c2             	mov    %rax,%rdx
+  803b17:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803b1e:	48 01 d0             	add    %rdx,%rax
+  803b21:	8b 40 08             	mov    0x8(%rax),%eax
+  803b24:	85 c0                	test   %eax,%eax
+  803b26:	74 04                	je     803b2c <poll+0x2e0>
+        ready++;
+  803b28:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803b2c:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  803b30:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b33:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  803b39:	0f 8c ab fd ff ff    	jl     8038ea <poll+0x9e>
+    }
+    if (ready)
+  803b3f:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  803b43:	74 08                	je     803b4d <poll+0x301>
+      return ready;
+  803b45:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  803b48:	e9 86 00 00 00       	jmp    803bd3 <poll+0x387>
+
+    if (deadline) {
+  803b4d:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  803b52:	74 30                	je     803b84 <poll+0x338>
+      now     = vsys_clock_ns();
+  803b54:	48 b8 87 4d 80 00 00 	movabs $0x804d87,%rax
+  803b5b:	00 00 00 
+  803b5e:	ff d0                	call   *%rax
+  803b60:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  803b64:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803b68:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803b6c:	73 0a                	jae    803b78 <poll+0x32c>
+  803b6e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b72:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  803b76:	eb 05                	jmp    803b7d <poll+0x331>
+  803b78:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b7d:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  803b84:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  803b87:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803b8a:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803b91:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803b98:	48 89 c7             	mov    %rax,%rdi
+  803b9b:	48 b8 30 2a 80 00 00 	movabs $0x802a30,%rax
+  803ba2:	00 00 00 
+  803ba5:	ff d0                	call   *%rax
+  803ba7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803baa:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803bae:	75 07                	jne    803bb7 <poll+0x36b>
+      return 0;
+  803bb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb5:	eb 1c                	jmp    803bd3 <poll+0x387>
+    if (r < 0)
+  803bb7:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803bbb:	79 05                	jns    803bc2 <poll+0x376>
+      return r;
+  803bbd:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803bc0:	eb 11                	jmp    803bd3 <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  803bc2:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803bc5:	c1 f8 02             	sar    $0x2,%eax
+  803bc8:	83 e0 01             	and    $0x1,%eax
+  803bcb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803bce:	e9 f6 fc ff ff       	jmp    8038c9 <poll+0x7d>
+  }
+}
+  803bd3:	c9                   	leave
+  803bd4:	c3                   	ret
+
+0000000000803bd5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  803bd5:	55                   	push   %rbp
+  803bd6:	48 89 e5             	mov    %rsp,%rbp
+  803bd9:	48 83 ec 20          	sub    $0x20,%rsp
+  803bdd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803be1:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  803be5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803be9:	be 00 00 00 00       	mov    $0x0,%esi
+  803bee:	48 89 c7             	mov    %rax,%rdi
+  803bf1:	48 b8 c3 3c 80 00 00 	movabs $0x803cc3,%rax
+  803bf8:	00 00 00 
+  803bfb:	ff d0                	call   *%rax
+  803bfd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803c00:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803c04:	79 05                	jns    803c0b <stat+0x36>
+    return fd;
+  803c06:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c09:	eb 2f                	jmp    803c3a <stat+0x65>
+  r = fstat(fd, stat);
+  803c0b:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803c0f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c12:	48 89 d6             	mov    %rdx,%rsi
+  803c15:	89 c7                	mov    %eax,%edi
+  803c17:	48 b8 0c 37 80 00 00 	movabs $0x80370c,%rax
+  803c1e:	00 00 00 
+  803c21:	ff d0                	call   *%rax
+  803c23:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  803c26:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c29:	89 c7                	mov    %eax,%edi
+  803c2b:	48 b8 74 30 80 00 00 	movabs $0x803074,%rax
+  803c32:	00 00 00 
+  803c35:	ff d0                	call   *%rax
+  return r;
+  803c37:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803c3a:	c9                   	leave
+  803c3b:	c3                   	ret
+
+0000000000803c3c <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  803c3c:	55                   	push   %rbp
+  803c3d:	48 89 e5             	mov    %rsp,%rbp
+  803c40:	48 83 ec 10          	sub    $0x10,%rsp
+  803c44:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  803c47:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  803c4b:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803c52:	00 00 00 
+  803c55:	8b 00                	mov    (%rax),%eax
+  803c57:	85 c0                	test   %eax,%eax
+  803c59:	75 1d                	jne    803c78 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  803c5b:	bf 03 00 00 00       	mov    $0x3,%edi
+  803c60:	48 b8 a2 53 80 00 00 	movabs $0x8053a2,%rax
+  803c67:	00 00 00 
+  803c6a:	ff d0                	call   *%rax
+  803c6c:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  803c73:	00 00 00 
+  803c76:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803c78:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803c7f:	00 00 00 
+  803c82:	8b 00                	mov    (%rax),%eax
+  803c84:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  803c87:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803c8c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803c93:	00 00 00 
+  803c96:	89 c7                	mov    %eax,%edi
+  803c98:	48 b8 f5 52 80 00 00 	movabs $0x8052f5,%rax
+  803c9f:	00 00 00 
+  803ca2:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  803ca4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803ca8:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cad:	48 89 c6             	mov    %rax,%rsi
+  803cb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb5:	48 b8 78 51 80 00 00 	movabs $0x805178,%rax
+  803cbc:	00 00 00 
+  803cbf:	ff d0                	call   *%rax
+}
+  803cc1:	c9                   	leave
+  803cc2:	c3                   	ret
+
+0000000000803cc3 <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  803cc3:	55                   	push   %rbp
+  803cc4:	48 89 e5             	mov    %rsp,%rbp
+  803cc7:	48 83 ec 20          	sub    $0x20,%rsp
+  803ccb:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803ccf:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  803cd2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803cd6:	48 89 c7             	mov    %rax,%rdi
+  803cd9:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  803ce0:	00 00 00 
+  803ce3:	ff d0                	call   *%rax
+  803ce5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803cea:	7e 0a                	jle    803cf6 <open+0x33>
+    return -E_BAD_PATH;
+  803cec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803cf1:	e9 a8 00 00 00       	jmp    803d9e <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  803cf6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803cfa:	48 89 c7             	mov    %rax,%rdi
+  803cfd:	48 b8 1d 2d 80 00 00 	movabs $0x802d1d,%rax
+  803d04:	00 00 00 
+  803d07:	ff d0                	call   *%rax
+  803d09:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d0c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d10:	79 08                	jns    803d1a <open+0x57>
+    return r;
+  803d12:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d15:	e9 84 00 00 00       	jmp    803d9e <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  803d1a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d1e:	48 89 c6             	mov    %rax,%rsi
+  803d21:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803d28:	00 00 00 
+  803d2b:	48 89 c7             	mov    %rax,%rdi
+  803d2e:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  803d35:	00 00 00 
+  803d38:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  803d3a:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803d41:	00 00 00 
+  803d44:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  803d47:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  803d4d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d51:	48 89 c6             	mov    %rax,%rsi
+  803d54:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d59:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  803d60:	00 00 00 
+  803d63:	ff d0                	call   *%rax
+  803d65:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d68:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d6c:	79 1d                	jns    803d8b <open+0xc8>
+    fd_close(fd, 0);
+  803d6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d72:	be 00 00 00 00       	mov    $0x0,%esi
+  803d77:	48 89 c7             	mov    %rax,%rdi
+  803d7a:	48 b8 d5 2e 80 00 00 	movabs $0x802ed5,%rax
+  803d81:	00 00 00 
+  803d84:	ff d0                	call   *%rax
+    return r;
+  803d86:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803d89:	eb 13                	jmp    803d9e <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803d8b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803d8f:	48 89 c7             	mov    %rax,%rdi
+  803d92:	48 b8 cf 2c 80 00 00 	movabs $0x802ccf,%rax
+  803d99:	00 00 00 
+  803d9c:	ff d0                	call   *%rax
+}
+  803d9e:	c9                   	leave
+  803d9f:	c3                   	ret
+
+0000000000803da0 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803da0:	55                   	push   %rbp
+  803da1:	48 89 e5             	mov    %rsp,%rbp
+  803da4:	48 83 ec 10          	sub    $0x10,%rsp
+  803da8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803dac:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803db0:	8b 40 0c             	mov    0xc(%rax),%eax
+  803db3:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803dba:	00 00 00 
+  803dbd:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803dbf:	be 00 00 00 00       	mov    $0x0,%esi
+  803dc4:	bf 06 00 00 00       	mov    $0x6,%edi
+  803dc9:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  803dd0:	00 00 00 
+  803dd3:	ff d0                	call   *%rax
+}
+  803dd5:	c9                   	leave
+  803dd6:	c3                   	ret
+
+0000000000803dd7 <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803dd7:	55                   	push   %rbp
+  803dd8:	48 89 e5             	mov    %rsp,%rbp
+  803ddb:	48 83 ec 30          	sub    $0x30,%rsp
+  803ddf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803de3:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  803de7:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803deb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803df0:	74 07                	je     803df9 <devfile_read+0x22>
+  803df2:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  803df7:	75 0a                	jne    803e03 <devfile_read+0x2c>
+  return E_INVAL;
+  803df9:	b8 03 00 00 00       	mov    $0x3,%eax
+  803dfe:	e9 b4 00 00 00       	jmp    803eb7 <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  803e03:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803e0a:	00 
+  while (n) {
+  803e0b:	e9 98 00 00 00       	jmp    803ea8 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803e10:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e14:	8b 40 0c             	mov    0xc(%rax),%eax
+  803e17:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803e1e:	00 00 00 
+  803e21:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  803e23:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803e2a:	00 00 00 
+  803e2d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e31:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  803e35:	be 00 00 00 00       	mov    $0x0,%esi
+  803e3a:	bf 03 00 00 00       	mov    $0x3,%edi
+  803e3f:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  803e46:	00 00 00 
+  803e49:	ff d0                	call   *%rax
+  803e4b:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  803e4e:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803e52:	7f 13                	jg     803e67 <devfile_read+0x90>
+      return res ? res : res0;
+  803e54:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  803e58:	74 07                	je     803e61 <devfile_read+0x8a>
+  803e5a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e5d:	48 98                	cltq
+  803e5f:	eb 56                	jmp    803eb7 <devfile_read+0xe0>
+  803e61:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803e65:	eb 50                	jmp    803eb7 <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  803e67:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e6a:	48 63 d0             	movslq %eax,%rdx
+  803e6d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e71:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803e78:	00 00 00 
+  803e7b:	48 89 ce             	mov    %rcx,%rsi
+  803e7e:	48 89 c7             	mov    %rax,%rdi
+  803e81:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  803e88:	00 00 00 
+  803e8b:	ff d0                	call   *%rax
+
+    buf += res;
+  803e8d:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e90:	48 98                	cltq
+  803e92:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  803e96:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803e99:	48 98                	cltq
+  803e9b:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803e9f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803ea2:	48 98                	cltq
+  803ea4:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803ea8:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803ead:	0f 85 5d ff ff ff    	jne    803e10 <devfile_read+0x39>
+  }
+
+  return res0;
+  803eb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  803eb7:	c9                   	leave
+  803eb8:	c3                   	ret
+
+0000000000803eb9 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803eb9:	55                   	push   %rbp
+  803eba:	48 89 e5             	mov    %rsp,%rbp
+  803ebd:	48 83 ec 50          	sub    $0x50,%rsp
+  803ec1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803ec5:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803ec9:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803ecd:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  803ed2:	74 07                	je     803edb <devfile_write+0x22>
+  803ed4:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803ed9:	75 0a                	jne    803ee5 <devfile_write+0x2c>
+  return E_INVAL;
+  803edb:	b8 03 00 00 00       	mov    $0x3,%eax
+  803ee0:	e9 c9 00 00 00       	jmp    803fae <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  803ee5:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803eec:	00 
+
+  while (n) {
+  803eed:	e9 ad 00 00 00       	jmp    803f9f <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  803ef2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803ef6:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803efa:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803f01:	00 
+  803f02:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f06:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f0a:	48 39 c2             	cmp    %rax,%rdx
+  803f0d:	48 0f 46 c2          	cmovbe %rdx,%rax
+  803f11:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  803f15:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  803f19:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f1d:	48 89 c6             	mov    %rax,%rsi
+  803f20:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  803f27:	00 00 00 
+  803f2a:	48 89 c7             	mov    %rax,%rdi
+  803f2d:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  803f34:	00 00 00 
+  803f37:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803f39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f3d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803f40:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803f47:	00 00 00 
+  803f4a:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  803f4c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803f53:	00 00 00 
+  803f56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803f5a:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  803f5e:	be 00 00 00 00       	mov    $0x0,%esi
+  803f63:	bf 04 00 00 00       	mov    $0x4,%edi
+  803f68:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  803f6f:	00 00 00 
+  803f72:	ff d0                	call   *%rax
+  803f74:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803f77:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803f7b:	79 07                	jns    803f84 <devfile_write+0xcb>
+      return res;
+  803f7d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f80:	48 98                	cltq
+  803f82:	eb 2a                	jmp    803fae <devfile_write+0xf5>
+
+    buf += res;
+  803f84:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f87:	48 98                	cltq
+  803f89:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803f8d:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f90:	48 98                	cltq
+  803f92:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803f96:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803f99:	48 98                	cltq
+  803f9b:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803f9f:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803fa4:	0f 85 48 ff ff ff    	jne    803ef2 <devfile_write+0x39>
+  }
+
+  return res0;
+  803faa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803fae:	c9                   	leave
+  803faf:	c3                   	ret
+
+0000000000803fb0 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803fb0:	55                   	push   %rbp
+  803fb1:	48 89 e5             	mov    %rsp,%rbp
+  803fb4:	48 83 ec 20          	sub    $0x20,%rsp
+  803fb8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803fbc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803fc0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803fc4:	8b 40 0c             	mov    0xc(%rax),%eax
+  803fc7:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803fce:	00 00 00 
+  803fd1:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803fd3:	be 00 00 00 00       	mov    $0x0,%esi
+  803fd8:	bf 05 00 00 00       	mov    $0x5,%edi
+  803fdd:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  803fe4:	00 00 00 
+  803fe7:	ff d0                	call   *%rax
+  803fe9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803fec:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803ff0:	79 05                	jns    803ff7 <devfile_stat+0x47>
+    return r;
+  803ff2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803ff5:	eb 59                	jmp    804050 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803ff7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ffb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  804002:	00 00 00 
+  804005:	48 89 d6             	mov    %rdx,%rsi
+  804008:	48 89 c7             	mov    %rax,%rdi
+  80400b:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  804012:	00 00 00 
+  804015:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  804017:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  80401e:	00 00 00 
+  804021:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804027:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80402b:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  804031:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  804038:	00 00 00 
+  80403b:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  804041:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804045:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  80404b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804050:	c9                   	leave
+  804051:	c3                   	ret
+
+0000000000804052 <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  804052:	55                   	push   %rbp
+  804053:	48 89 e5             	mov    %rsp,%rbp
+  804056:	48 83 ec 10          	sub    $0x10,%rsp
+  80405a:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80405e:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804061:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804065:	8b 40 0c             	mov    0xc(%rax),%eax
+  804068:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80406f:	00 00 00 
+  804072:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  804074:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80407b:	00 00 00 
+  80407e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804081:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  804084:	be 00 00 00 00       	mov    $0x0,%esi
+  804089:	bf 02 00 00 00       	mov    $0x2,%edi
+  80408e:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  804095:	00 00 00 
+  804098:	ff d0                	call   *%rax
+}
+  80409a:	c9                   	leave
+  80409b:	c3                   	ret
+
+000000000080409c <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8040a4:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8040a8:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8040ab:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  8040af:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8040b2:	83 e0 03             	and    $0x3,%eax
+}
+  8040b5:	c9                   	leave
+  8040b6:	c3                   	ret
+
+00000000008040b7 <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  8040b7:	55                   	push   %rbp
+  8040b8:	48 89 e5             	mov    %rsp,%rbp
+  8040bb:	48 83 ec 10          	sub    $0x10,%rsp
+  8040bf:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  8040c3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040c7:	48 89 c7             	mov    %rax,%rdi
+  8040ca:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8040d1:	00 00 00 
+  8040d4:	ff d0                	call   *%rax
+  8040d6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8040db:	7e 07                	jle    8040e4 <remove+0x2d>
+    return -E_BAD_PATH;
+  8040dd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8040e2:	eb 36                	jmp    80411a <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  8040e4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8040e8:	48 89 c6             	mov    %rax,%rsi
+  8040eb:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8040f2:	00 00 00 
+  8040f5:	48 89 c7             	mov    %rax,%rdi
+  8040f8:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  8040ff:	00 00 00 
+  804102:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  804104:	be 00 00 00 00       	mov    $0x0,%esi
+  804109:	bf 07 00 00 00       	mov    $0x7,%edi
+  80410e:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  804115:	00 00 00 
+  804118:	ff d0                	call   *%rax
+}
+  80411a:	c9                   	leave
+  80411b:	c3                   	ret
+
+000000000080411c <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  80411c:	55                   	push   %rbp
+  80411d:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  804120:	be 00 00 00 00       	mov    $0x0,%esi
+  804125:	bf 08 00 00 00       	mov    $0x8,%edi
+  80412a:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  804131:	00 00 00 
+  804134:	ff d0                	call   *%rax
+}
+  804136:	5d                   	pop    %rbp
+  804137:	c3                   	ret
+
+0000000000804138 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  804138:	55                   	push   %rbp
+  804139:	48 89 e5             	mov    %rsp,%rbp
+  80413c:	48 83 ec 20          	sub    $0x20,%rsp
+  804140:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  804144:	be 00 00 00 00       	mov    $0x0,%esi
+  804149:	bf 09 00 00 00       	mov    $0x9,%edi
+  80414e:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  804155:	00 00 00 
+  804158:	ff d0                	call   *%rax
+  80415a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80415d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804161:	79 05                	jns    804168 <fs_stats+0x30>
+    return r;
+  804163:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804166:	eb 2a                	jmp    804192 <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  804168:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80416c:	ba 68 00 00 00       	mov    $0x68,%edx
+  804171:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  804178:	00 00 00 
+  80417b:	48 89 ce             	mov    %rcx,%rsi
+  80417e:	48 89 c7             	mov    %rax,%rdi
+  804181:	48 b8 5d 1d 80 00 00 	movabs $0x801d5d,%rax
+  804188:	00 00 00 
+  80418b:	ff d0                	call   *%rax
+  return 0;
+  80418d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804192:	c9                   	leave
+  804193:	c3                   	ret
+
+0000000000804194 <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  804194:	55                   	push   %rbp
+  804195:	48 89 e5             	mov    %rsp,%rbp
+  804198:	48 83 ec 10          	sub    $0x10,%rsp
+  80419c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  80419f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8041a6:	00 00 00 
+  8041a9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8041ac:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  8041ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8041b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8041b8:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  8041bf:	00 00 00 
+  8041c2:	ff d0                	call   *%rax
+}
+  8041c4:	c9                   	leave
+  8041c5:	c3                   	ret
+
+00000000008041c6 <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  8041c6:	55                   	push   %rbp
+  8041c7:	48 89 e5             	mov    %rsp,%rbp
+  8041ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8041ce:	89 f8                	mov    %edi,%eax
+  8041d0:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  8041d3:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  8041d7:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8041de:	00 00 00 
+  8041e1:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  8041e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8041e8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8041ed:	48 b8 3c 3c 80 00 00 	movabs $0x803c3c,%rax
+  8041f4:	00 00 00 
+  8041f7:	ff d0                	call   *%rax
+}
+  8041f9:	c9                   	leave
+  8041fa:	c3                   	ret
+
+00000000008041fb <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  8041fb:	55                   	push   %rbp
+  8041fc:	48 89 e5             	mov    %rsp,%rbp
+  8041ff:	48 83 ec 10          	sub    $0x10,%rsp
+  804203:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  804207:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80420b:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  804210:	48 89 c7             	mov    %rax,%rdi
+  804213:	48 b8 21 42 80 00 00 	movabs $0x804221,%rax
+  80421a:	00 00 00 
+  80421d:	ff d0                	call   *%rax
+}
+  80421f:	c9                   	leave
+  804220:	c3                   	ret
+
+0000000000804221 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  804221:	55                   	push   %rbp
+  804222:	48 89 e5             	mov    %rsp,%rbp
+  804225:	48 83 ec 50          	sub    $0x50,%rsp
+  804229:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80422d:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  804231:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804238:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  804239:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  80423e:	74 0a                	je     80424a <pipe_size+0x29>
+  804240:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  804247:	00 
+  804248:	76 0a                	jbe    804254 <pipe_size+0x33>
+    return -E_INVAL;
+  80424a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80424f:	e9 cc 02 00 00       	jmp    804520 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  804254:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  804258:	48 89 c7             	mov    %rax,%rdi
+  80425b:	48 b8 1d 2d 80 00 00 	movabs $0x802d1d,%rax
+  804262:	00 00 00 
+  804265:	ff d0                	call   *%rax
+  804267:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80426a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80426e:	0f 88 a8 02 00 00    	js     80451c <pipe_size+0x2fb>
+  804274:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804278:	ba 07 04 00 00       	mov    $0x407,%edx
+  80427d:	48 89 c6             	mov    %rax,%rsi
+  804280:	bf 00 00 00 00       	mov    $0x0,%edi
+  804285:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  80428c:	00 00 00 
+  80428f:	ff d0                	call   *%rax
+  804291:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804294:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804298:	0f 88 7e 02 00 00    	js     80451c <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80429e:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  8042a2:	48 89 c7             	mov    %rax,%rdi
+  8042a5:	48 b8 1d 2d 80 00 00 	movabs $0x802d1d,%rax
+  8042ac:	00 00 00 
+  8042af:	ff d0                	call   *%rax
+  8042b1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042b4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042b8:	0f 88 43 02 00 00    	js     804501 <pipe_size+0x2e0>
+  8042be:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8042c2:	ba 07 04 00 00       	mov    $0x407,%edx
+  8042c7:	48 89 c6             	mov    %rax,%rsi
+  8042ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042cf:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  8042d6:	00 00 00 
+  8042d9:	ff d0                	call   *%rax
+  8042db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8042de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8042e2:	0f 88 19 02 00 00    	js     804501 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  8042e8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042ec:	48 89 c7             	mov    %rax,%rdi
+  8042ef:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  8042f6:	00 00 00 
+  8042f9:	ff d0                	call   *%rax
+  8042fb:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8042ff:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804306:	00 
+  804307:	e9 a2 00 00 00       	jmp    8043ae <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  80430c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804310:	48 c1 e0 0c          	shl    $0xc,%rax
+  804314:	48 89 c2             	mov    %rax,%rdx
+  804317:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80431b:	48 01 d0             	add    %rdx,%rax
+  80431e:	ba 07 04 00 00       	mov    $0x407,%edx
+  804323:	48 89 c6             	mov    %rax,%rsi
+  804326:	bf 00 00 00 00       	mov    $0x0,%edi
+  80432b:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  804332:	00 00 00 
+  804335:	ff d0                	call   *%rax
+  804337:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80433a:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80433e:	0f 88 37 01 00 00    	js     80447b <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  804344:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804348:	48 89 c7             	mov    %rax,%rdi
+  80434b:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  804352:	00 00 00 
+  804355:	ff d0                	call   *%rax
+  804357:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80435b:	48 c1 e2 0c          	shl    $0xc,%rdx
+  80435f:	48 01 c2             	add    %rax,%rdx
+  804362:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804366:	48 c1 e0 0c          	shl    $0xc,%rax
+  80436a:	48 89 c1             	mov    %rax,%rcx
+  80436d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804371:	48 01 c8             	add    %rcx,%rax
+  804374:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  80437a:	48 89 d1             	mov    %rdx,%rcx
+  80437d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804382:	48 89 c6             	mov    %rax,%rsi
+  804385:	bf 00 00 00 00       	mov    $0x0,%edi
+  80438a:	48 b8 40 26 80 00 00 	movabs $0x802640,%rax
+  804391:	00 00 00 
+  804394:	ff d0                	call   *%rax
+  804396:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804399:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80439d:	79 0a                	jns    8043a9 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  80439f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  8043a4:	e9 d3 00 00 00       	jmp    80447c <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  8043a9:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  8043ae:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  8043b5:	00 
+  8043b6:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8043ba:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8043be:	48 01 d0             	add    %rdx,%rax
+  8043c1:	48 83 c0 1f          	add    $0x1f,%rax
+  8043c5:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  8043c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043d2:	48 f7 75 e0          	divq   -0x20(%rbp)
+  8043d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8043da:	48 29 d0             	sub    %rdx,%rax
+  8043dd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8043e1:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  8043e5:	0f 82 21 ff ff ff    	jb     80430c <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  8043eb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043ef:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  8043f3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043f7:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  8043fb:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  8043ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804403:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  80440a:	00 00 00 
+  80440d:	8b 12                	mov    (%rdx),%edx
+  80440f:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  804411:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804415:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  80441c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804420:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  804427:	00 00 00 
+  80442a:	8b 12                	mov    (%rdx),%edx
+  80442c:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  80442e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804432:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  804439:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80443d:	48 89 c7             	mov    %rax,%rdi
+  804440:	48 b8 cf 2c 80 00 00 	movabs $0x802ccf,%rax
+  804447:	00 00 00 
+  80444a:	ff d0                	call   *%rax
+  80444c:	89 c2                	mov    %eax,%edx
+  80444e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804452:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  804454:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804458:	48 89 c7             	mov    %rax,%rdi
+  80445b:	48 b8 cf 2c 80 00 00 	movabs $0x802ccf,%rax
+  804462:	00 00 00 
+  804465:	ff d0                	call   *%rax
+  804467:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80446b:	48 83 c2 04          	add    $0x4,%rdx
+  80446f:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  804471:	b8 00 00 00 00       	mov    $0x0,%eax
+  804476:	e9 a5 00 00 00       	jmp    804520 <pipe_size+0x2ff>
+      goto err2;
+  80447b:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  80447c:	eb 58                	jmp    8044d6 <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  80447e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804482:	48 c1 e0 0c          	shl    $0xc,%rax
+  804486:	48 89 c2             	mov    %rax,%rdx
+  804489:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80448d:	48 01 d0             	add    %rdx,%rax
+  804490:	48 89 c6             	mov    %rax,%rsi
+  804493:	bf 00 00 00 00       	mov    $0x0,%edi
+  804498:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  80449f:	00 00 00 
+  8044a2:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  8044a4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044a8:	48 89 c7             	mov    %rax,%rdi
+  8044ab:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  8044b2:	00 00 00 
+  8044b5:	ff d0                	call   *%rax
+  8044b7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8044bb:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8044bf:	48 01 d0             	add    %rdx,%rax
+  8044c2:	48 89 c6             	mov    %rax,%rsi
+  8044c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044ca:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  8044d1:	00 00 00 
+  8044d4:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  8044d6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8044da:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8044de:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  8044e2:	48 85 c0             	test   %rax,%rax
+  8044e5:	75 97                	jne    80447e <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  8044e7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8044eb:	48 89 c6             	mov    %rax,%rsi
+  8044ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044f3:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  8044fa:	00 00 00 
+  8044fd:	ff d0                	call   *%rax
+  8044ff:	eb 01                	jmp    804502 <pipe_size+0x2e1>
+    goto err1;
+  804501:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  804502:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804506:	48 89 c6             	mov    %rax,%rsi
+  804509:	bf 00 00 00 00       	mov    $0x0,%edi
+  80450e:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  804515:	00 00 00 
+  804518:	ff d0                	call   *%rax
+  80451a:	eb 01                	jmp    80451d <pipe_size+0x2fc>
+    goto err;
+  80451c:	90                   	nop
+err:
+  return r;
+  80451d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804520:	c9                   	leave
+  804521:	c3                   	ret
+
+0000000000804522 <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804522:	55                   	push   %rbp
+  804523:	48 89 e5             	mov    %rsp,%rbp
+  804526:	53                   	push   %rbx
+  804527:	48 83 ec 28          	sub    $0x28,%rsp
+  80452b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80452f:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  804533:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80453a:	00 00 00 
+  80453d:	8b 40 04             	mov    0x4(%rax),%eax
+  804540:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804545:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80454c:	00 00 00 
+  80454f:	48 98                	cltq
+  804551:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804558:	48 01 d0             	add    %rdx,%rax
+  80455b:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804561:	8b 00                	mov    (%rax),%eax
+  804563:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  804566:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80456a:	48 89 c7             	mov    %rax,%rdi
+  80456d:	48 b8 13 54 80 00 00 	movabs $0x805413,%rax
+  804574:	00 00 00 
+  804577:	ff d0                	call   *%rax
+  804579:	89 c3                	mov    %eax,%ebx
+  80457b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80457f:	48 89 c7             	mov    %rax,%rdi
+  804582:	48 b8 13 54 80 00 00 	movabs $0x805413,%rax
+  804589:	00 00 00 
+  80458c:	ff d0                	call   *%rax
+  80458e:	39 c3                	cmp    %eax,%ebx
+  804590:	0f 94 c0             	sete   %al
+  804593:	0f b6 c0             	movzbl %al,%eax
+  804596:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804599:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8045a0:	00 00 00 
+  8045a3:	8b 40 04             	mov    0x4(%rax),%eax
+  8045a6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8045ab:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8045b2:	00 00 00 
+  8045b5:	48 98                	cltq
+  8045b7:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8045be:	48 01 d0             	add    %rdx,%rax
+  8045c1:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8045c7:	8b 00                	mov    (%rax),%eax
+  8045c9:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  8045cc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045cf:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8045d2:	75 05                	jne    8045d9 <_pipeisclosed+0xb7>
+      return ret;
+  8045d4:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8045d7:	eb 68                	jmp    804641 <_pipeisclosed+0x11f>
+    if (n != nn)
+  8045d9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045dc:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  8045df:	0f 84 4e ff ff ff    	je     804533 <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  8045e5:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8045ec:	00 00 00 
+  8045ef:	8b 40 04             	mov    0x4(%rax),%eax
+  8045f2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8045f7:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8045fe:	00 00 00 
+  804601:	48 98                	cltq
+  804603:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  80460a:	48 01 d0             	add    %rdx,%rax
+  80460d:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  804613:	8b 10                	mov    (%rax),%edx
+  804615:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  804618:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80461b:	89 c6                	mov    %eax,%esi
+  80461d:	48 b8 80 5b 80 00 00 	movabs $0x805b80,%rax
+  804624:	00 00 00 
+  804627:	48 89 c7             	mov    %rax,%rdi
+  80462a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80462f:	49 b8 6a 08 80 00 00 	movabs $0x80086a,%r8
+  804636:	00 00 00 
+  804639:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  80463c:	e9 f2 fe ff ff       	jmp    804533 <_pipeisclosed+0x11>
+  }
+}
+  804641:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804645:	c9                   	leave
+  804646:	c3                   	ret
+
+0000000000804647 <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  804647:	55                   	push   %rbp
+  804648:	48 89 e5             	mov    %rsp,%rbp
+  80464b:	48 83 ec 30          	sub    $0x30,%rsp
+  80464f:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804652:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  804656:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  804659:	48 89 d6             	mov    %rdx,%rsi
+  80465c:	89 c7                	mov    %eax,%edi
+  80465e:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  804665:	00 00 00 
+  804668:	ff d0                	call   *%rax
+  80466a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80466d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804671:	79 05                	jns    804678 <pipeisclosed+0x31>
+    return r;
+  804673:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804676:	eb 31                	jmp    8046a9 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804678:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80467c:	48 89 c7             	mov    %rax,%rdi
+  80467f:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  804686:	00 00 00 
+  804689:	ff d0                	call   *%rax
+  80468b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  80468f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804693:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804697:	48 89 d6             	mov    %rdx,%rsi
+  80469a:	48 89 c7             	mov    %rax,%rdi
+  80469d:	48 b8 22 45 80 00 00 	movabs $0x804522,%rax
+  8046a4:	00 00 00 
+  8046a7:	ff d0                	call   *%rax
+}
+  8046a9:	c9                   	leave
+  8046aa:	c3                   	ret
+
+00000000008046ab <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  8046ab:	55                   	push   %rbp
+  8046ac:	48 89 e5             	mov    %rsp,%rbp
+  8046af:	48 83 ec 10          	sub    $0x10,%rsp
+  8046b3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  8046b7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046bb:	8b 40 18             	mov    0x18(%rax),%eax
+  8046be:	8d 50 01             	lea    0x1(%rax),%edx
+  8046c1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046c5:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  8046c8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046cc:	8b 40 1c             	mov    0x1c(%rax),%eax
+  8046cf:	85 c0                	test   %eax,%eax
+  8046d1:	74 27                	je     8046fa <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  8046d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046d7:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  8046de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046e2:	48 83 c0 18          	add    $0x18,%rax
+  8046e6:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  8046eb:	48 89 c7             	mov    %rax,%rdi
+  8046ee:	48 b8 e3 29 80 00 00 	movabs $0x8029e3,%rax
+  8046f5:	00 00 00 
+  8046f8:	ff d0                	call   *%rax
+  }
+}
+  8046fa:	90                   	nop
+  8046fb:	c9                   	leave
+  8046fc:	c3                   	ret
+
+00000000008046fd <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  8046fd:	55                   	push   %rbp
+  8046fe:	48 89 e5             	mov    %rsp,%rbp
+  804701:	48 83 ec 10          	sub    $0x10,%rsp
+  804705:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804709:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  80470c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804710:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  804717:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80471b:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  80471f:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  804722:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  804729:	89 c6                	mov    %eax,%esi
+  80472b:	48 89 cf             	mov    %rcx,%rdi
+  80472e:	48 b8 94 29 80 00 00 	movabs $0x802994,%rax
+  804735:	00 00 00 
+  804738:	ff d0                	call   *%rax
+}
+  80473a:	90                   	nop
+  80473b:	c9                   	leave
+  80473c:	c3                   	ret
+
+000000000080473d <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80473d:	55                   	push   %rbp
+  80473e:	48 89 e5             	mov    %rsp,%rbp
+  804741:	48 83 ec 70          	sub    $0x70,%rsp
+  804745:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804749:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80474d:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  804751:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804755:	48 89 c7             	mov    %rax,%rdi
+  804758:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  80475f:	00 00 00 
+  804762:	ff d0                	call   *%rax
+  804764:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804768:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  80476d:	75 0a                	jne    804779 <devpipe_read+0x3c>
+    return 0;
+  80476f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804774:	e9 63 01 00 00       	jmp    8048dc <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804779:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80477d:	8b 40 18             	mov    0x18(%rax),%eax
+  804780:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  804783:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804787:	48 8b 10             	mov    (%rax),%rdx
+  80478a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80478e:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804792:	48 39 c2             	cmp    %rax,%rdx
+  804795:	75 42                	jne    8047d9 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  804797:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80479b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80479f:	48 89 d6             	mov    %rdx,%rsi
+  8047a2:	48 89 c7             	mov    %rax,%rdi
+  8047a5:	48 b8 22 45 80 00 00 	movabs $0x804522,%rax
+  8047ac:	00 00 00 
+  8047af:	ff d0                	call   *%rax
+  8047b1:	85 c0                	test   %eax,%eax
+  8047b3:	74 0a                	je     8047bf <devpipe_read+0x82>
+      return 0;
+  8047b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047ba:	e9 1d 01 00 00       	jmp    8048dc <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  8047bf:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  8047c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047c6:	89 d6                	mov    %edx,%esi
+  8047c8:	48 89 c7             	mov    %rax,%rdi
+  8047cb:	48 b8 fd 46 80 00 00 	movabs $0x8046fd,%rax
+  8047d2:	00 00 00 
+  8047d5:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  8047d7:	eb a0                	jmp    804779 <devpipe_read+0x3c>
+      break;
+  8047d9:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  8047da:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8047de:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  8047e2:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8047e6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8047ea:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047ee:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8047f2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8047f6:	48 8b 00             	mov    (%rax),%rax
+  8047f9:	48 29 c2             	sub    %rax,%rdx
+  8047fc:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804800:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804804:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804808:	48 39 c2             	cmp    %rax,%rdx
+  80480b:	48 0f 46 c2          	cmovbe %rdx,%rax
+  80480f:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  804813:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804817:	48 8b 00             	mov    (%rax),%rax
+  80481a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80481e:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  804822:	ba 00 00 00 00       	mov    $0x0,%edx
+  804827:	48 f7 f1             	div    %rcx
+  80482a:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  80482e:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804832:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  804836:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80483a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80483e:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  804842:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804846:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  80484a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80484e:	48 39 c2             	cmp    %rax,%rdx
+  804851:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804855:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  804859:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80485d:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  804861:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804865:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804869:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80486d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804871:	48 89 ce             	mov    %rcx,%rsi
+  804874:	48 89 c7             	mov    %rax,%rdi
+  804877:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  80487e:	00 00 00 
+  804881:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  804883:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804887:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  80488b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80488f:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  804893:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804897:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  80489b:	48 01 d1             	add    %rdx,%rcx
+  80489e:	48 89 c2             	mov    %rax,%rdx
+  8048a1:	48 89 cf             	mov    %rcx,%rdi
+  8048a4:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  8048ab:	00 00 00 
+  8048ae:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  8048b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048b4:	48 8b 10             	mov    (%rax),%rdx
+  8048b7:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8048bb:	48 01 c2             	add    %rax,%rdx
+  8048be:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048c2:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  8048c5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8048c9:	48 89 c7             	mov    %rax,%rdi
+  8048cc:	48 b8 ab 46 80 00 00 	movabs $0x8046ab,%rax
+  8048d3:	00 00 00 
+  8048d6:	ff d0                	call   *%rax
+  return n;
+  8048d8:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  8048dc:	c9                   	leave
+  8048dd:	c3                   	ret
+
+00000000008048de <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8048de:	55                   	push   %rbp
+  8048df:	48 89 e5             	mov    %rsp,%rbp
+  8048e2:	48 83 ec 70          	sub    $0x70,%rsp
+  8048e6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8048ea:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8048ee:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8048f2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8048f6:	48 89 c7             	mov    %rax,%rdi
+  8048f9:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  804900:	00 00 00 
+  804903:	ff d0                	call   *%rax
+  804905:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  804909:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80490d:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  804911:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  804918:	00 
+  804919:	e9 b8 01 00 00       	jmp    804ad6 <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  80491e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804922:	8b 40 18             	mov    0x18(%rax),%eax
+  804925:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  804928:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80492c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804930:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804934:	48 8b 00             	mov    (%rax),%rax
+  804937:	48 29 c2             	sub    %rax,%rdx
+  80493a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80493e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804942:	48 39 c2             	cmp    %rax,%rdx
+  804945:	75 4d                	jne    804994 <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  804947:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  80494b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80494f:	48 89 d6             	mov    %rdx,%rsi
+  804952:	48 89 c7             	mov    %rax,%rdi
+  804955:	48 b8 22 45 80 00 00 	movabs $0x804522,%rax
+  80495c:	00 00 00 
+  80495f:	ff d0                	call   *%rax
+  804961:	85 c0                	test   %eax,%eax
+  804963:	74 0a                	je     80496f <devpipe_write+0x91>
+        return 0;
+  804965:	b8 00 00 00 00       	mov    $0x0,%eax
+  80496a:	e9 79 01 00 00       	jmp    804ae8 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  80496f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  804972:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804976:	89 d6                	mov    %edx,%esi
+  804978:	48 89 c7             	mov    %rax,%rdi
+  80497b:	48 b8 fd 46 80 00 00 	movabs $0x8046fd,%rax
+  804982:	00 00 00 
+  804985:	ff d0                	call   *%rax
+      m = 0;
+  804987:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  80498e:	00 
+      continue;
+  80498f:	e9 3a 01 00 00       	jmp    804ace <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  804994:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804998:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  80499c:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  8049a0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049a4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8049a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049ac:	48 8b 08             	mov    (%rax),%rcx
+  8049af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049b3:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8049b7:	48 29 c1             	sub    %rax,%rcx
+  8049ba:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  8049be:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8049c2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8049c6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8049ca:	48 39 c2             	cmp    %rax,%rdx
+  8049cd:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8049d1:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  8049d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049d9:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8049dd:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8049e1:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8049e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049ea:	48 f7 f1             	div    %rcx
+  8049ed:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  8049f1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049f5:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8049f9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8049fd:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a01:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804a05:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  804a09:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804a0d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804a11:	48 39 c2             	cmp    %rax,%rdx
+  804a14:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804a18:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  804a1c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a20:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  804a24:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804a28:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  804a2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804a30:	48 01 d1             	add    %rdx,%rcx
+  804a33:	48 89 c2             	mov    %rax,%rdx
+  804a36:	48 89 cf             	mov    %rcx,%rdi
+  804a39:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  804a40:	00 00 00 
+  804a43:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  804a45:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a49:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a4d:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804a51:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  804a55:	73 4d                	jae    804aa4 <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  804a57:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a5b:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804a63:	48 29 c2             	sub    %rax,%rdx
+  804a66:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a6a:	48 01 c2             	add    %rax,%rdx
+  804a6d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a71:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804a75:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804a79:	48 89 c1             	mov    %rax,%rcx
+  804a7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a80:	48 01 c1             	add    %rax,%rcx
+  804a83:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804a87:	48 01 c1             	add    %rax,%rcx
+  804a8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804a8e:	48 83 c0 20          	add    $0x20,%rax
+  804a92:	48 89 ce             	mov    %rcx,%rsi
+  804a95:	48 89 c7             	mov    %rax,%rdi
+  804a98:	48 b8 63 1f 80 00 00 	movabs $0x801f63,%rax
+  804a9f:	00 00 00 
+  804aa2:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  804aa4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804aa8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804aac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ab0:	48 01 c2             	add    %rax,%rdx
+  804ab3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ab7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804abb:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804abf:	48 89 c7             	mov    %rax,%rdi
+  804ac2:	48 b8 ab 46 80 00 00 	movabs $0x8046ab,%rax
+  804ac9:	00 00 00 
+  804acc:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804ace:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ad2:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  804ad6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ada:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804ade:	0f 82 3a fe ff ff    	jb     80491e <devpipe_write+0x40>
+  }
+
+  return i;
+  804ae4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804ae8:	c9                   	leave
+  804ae9:	c3                   	ret
+
+0000000000804aea <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804aea:	55                   	push   %rbp
+  804aeb:	48 89 e5             	mov    %rsp,%rbp
+  804aee:	48 83 ec 40          	sub    $0x40,%rsp
+  804af2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  804af6:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804af9:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804afd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804b01:	48 89 c7             	mov    %rax,%rdi
+  804b04:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  804b0b:	00 00 00 
+  804b0e:	ff d0                	call   *%rax
+  804b10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  804b14:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  804b1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b1f:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  804b23:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804b27:	48 89 d6             	mov    %rdx,%rsi
+  804b2a:	48 89 c7             	mov    %rax,%rdi
+  804b2d:	48 b8 c5 37 80 00 00 	movabs $0x8037c5,%rax
+  804b34:	00 00 00 
+  804b37:	ff d0                	call   *%rax
+  804b39:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804b3c:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  804b40:	79 08                	jns    804b4a <devpipe_poll+0x60>
+    return r;
+  804b42:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804b45:	e9 85 00 00 00       	jmp    804bcf <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  804b4a:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804b4d:	83 e0 01             	and    $0x1,%eax
+  804b50:	85 c0                	test   %eax,%eax
+  804b52:	74 18                	je     804b6c <devpipe_poll+0x82>
+  804b54:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b58:	48 8b 10             	mov    (%rax),%rdx
+  804b5b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b5f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804b63:	48 39 c2             	cmp    %rax,%rdx
+  804b66:	74 04                	je     804b6c <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804b68:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804b6c:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804b6f:	83 e0 02             	and    $0x2,%eax
+  804b72:	85 c0                	test   %eax,%eax
+  804b74:	74 23                	je     804b99 <devpipe_poll+0xaf>
+  804b76:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b7a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804b7e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b82:	48 8b 00             	mov    (%rax),%rax
+  804b85:	48 29 c2             	sub    %rax,%rdx
+  804b88:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b8c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804b90:	48 39 c2             	cmp    %rax,%rdx
+  804b93:	73 04                	jae    804b99 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  804b95:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804b99:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804b9d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ba1:	48 89 d6             	mov    %rdx,%rsi
+  804ba4:	48 89 c7             	mov    %rax,%rdi
+  804ba7:	48 b8 22 45 80 00 00 	movabs $0x804522,%rax
+  804bae:	00 00 00 
+  804bb1:	ff d0                	call   *%rax
+  804bb3:	85 c0                	test   %eax,%eax
+  804bb5:	74 04                	je     804bbb <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  804bb7:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804bbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804bbf:	75 0b                	jne    804bcc <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804bc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804bc5:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804bcc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804bcf:	c9                   	leave
+  804bd0:	c3                   	ret
+
+0000000000804bd1 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804bd1:	55                   	push   %rbp
+  804bd2:	48 89 e5             	mov    %rsp,%rbp
+  804bd5:	48 83 ec 20          	sub    $0x20,%rsp
+  804bd9:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804bdd:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804be1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804be5:	48 89 c7             	mov    %rax,%rdi
+  804be8:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  804bef:	00 00 00 
+  804bf2:	ff d0                	call   *%rax
+  804bf4:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804bf8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804bfc:	48 ba b1 5b 80 00 00 	movabs $0x805bb1,%rdx
+  804c03:	00 00 00 
+  804c06:	48 89 d6             	mov    %rdx,%rsi
+  804c09:	48 89 c7             	mov    %rax,%rdi
+  804c0c:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  804c13:	00 00 00 
+  804c16:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  804c18:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c1c:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804c20:	89 c1                	mov    %eax,%ecx
+  804c22:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804c26:	48 8b 00             	mov    (%rax),%rax
+  804c29:	89 c2                	mov    %eax,%edx
+  804c2b:	89 c8                	mov    %ecx,%eax
+  804c2d:	29 d0                	sub    %edx,%eax
+  804c2f:	89 c2                	mov    %eax,%edx
+  804c31:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c35:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  804c3b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c3f:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  804c46:	00 00 00 
+  stat->st_dev   = &devpipe;
+  804c49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804c4d:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  804c54:	00 00 00 
+  804c57:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  804c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c63:	c9                   	leave
+  804c64:	c3                   	ret
+
+0000000000804c65 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804c65:	55                   	push   %rbp
+  804c66:	48 89 e5             	mov    %rsp,%rbp
+  804c69:	48 83 ec 40          	sub    $0x40,%rsp
+  804c6d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804c71:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804c75:	48 89 c7             	mov    %rax,%rdi
+  804c78:	48 b8 f2 2c 80 00 00 	movabs $0x802cf2,%rax
+  804c7f:	00 00 00 
+  804c82:	ff d0                	call   *%rax
+  804c84:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804c88:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804c8f:	00 
+  804c90:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804c94:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804c98:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804c9c:	48 01 d0             	add    %rdx,%rax
+  804c9f:	48 83 c0 1f          	add    $0x1f,%rax
+  804ca3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804ca7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cab:	ba 00 00 00 00       	mov    $0x0,%edx
+  804cb0:	48 f7 75 e8          	divq   -0x18(%rbp)
+  804cb4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804cb8:	48 29 d0             	sub    %rdx,%rax
+  804cbb:	48 c1 e8 0c          	shr    $0xc,%rax
+  804cbf:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  804cc3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cc7:	48 89 c6             	mov    %rax,%rsi
+  804cca:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ccf:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  804cd6:	00 00 00 
+  804cd9:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804cdb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804cdf:	48 89 c7             	mov    %rax,%rdi
+  804ce2:	48 b8 ab 46 80 00 00 	movabs $0x8046ab,%rax
+  804ce9:	00 00 00 
+  804cec:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804cee:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804cf2:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804cf6:	eb 2f                	jmp    804d27 <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804cf8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804cfc:	48 83 e8 01          	sub    $0x1,%rax
+  804d00:	48 c1 e0 0c          	shl    $0xc,%rax
+  804d04:	48 89 c2             	mov    %rax,%rdx
+  804d07:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d0b:	48 01 d0             	add    %rdx,%rax
+  804d0e:	48 89 c6             	mov    %rax,%rsi
+  804d11:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d16:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  804d1d:	00 00 00 
+  804d20:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804d22:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  804d27:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  804d2c:	77 ca                	ja     804cf8 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  804d2e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804d32:	48 89 c6             	mov    %rax,%rsi
+  804d35:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d3a:	48 b8 a0 26 80 00 00 	movabs $0x8026a0,%rax
+  804d41:	00 00 00 
+  804d44:	ff d0                	call   *%rax
+}
+  804d46:	c9                   	leave
+  804d47:	c3                   	ret
+
+0000000000804d48 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  804d48:	55                   	push   %rbp
+  804d49:	48 89 e5             	mov    %rsp,%rbp
+  804d4c:	48 83 ec 08          	sub    $0x8,%rsp
+  804d50:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  804d53:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804d57:	75 10                	jne    804d69 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  804d59:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804d60:	00 00 00 
+  804d63:	8b 00                	mov    (%rax),%eax
+  804d65:	48 98                	cltq
+  804d67:	eb 05                	jmp    804d6e <vsyscall+0x26>
+  }
+  return 0;
+  804d69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d6e:	c9                   	leave
+  804d6f:	c3                   	ret
+
+0000000000804d70 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804d70:	55                   	push   %rbp
+  804d71:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  804d74:	bf 00 00 00 00       	mov    $0x0,%edi
+  804d79:	48 b8 48 4d 80 00 00 	movabs $0x804d48,%rax
+  804d80:	00 00 00 
+  804d83:	ff d0                	call   *%rax
+}
+  804d85:	5d                   	pop    %rbp
+  804d86:	c3                   	ret
+
+0000000000804d87 <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  804d87:	55                   	push   %rbp
+  804d88:	48 89 e5             	mov    %rsp,%rbp
+  804d8b:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804d8f:	0f 31                	rdtsc
+  804d91:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  804d94:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  804d97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804d9a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804d9d:	48 c1 e2 20          	shl    $0x20,%rdx
+  804da1:	48 09 d0             	or     %rdx,%rax
+  804da4:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804da8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804dac:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804db0:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804db7:	00 00 00 
+  804dba:	8b 40 08             	mov    0x8(%rax),%eax
+  804dbd:	48 98                	cltq
+  804dbf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  804dc3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804dc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  804dcc:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804dd0:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  804dd7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804de0:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804de4:	48 89 d0             	mov    %rdx,%rax
+  804de7:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804dee:	ba 00 00 00 00       	mov    $0x0,%edx
+  804df3:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804df7:	48 01 c8             	add    %rcx,%rax
+}
+  804dfa:	c9                   	leave
+  804dfb:	c3                   	ret
+
+0000000000804dfc <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804dfc:	55                   	push   %rbp
+  804dfd:	48 89 e5             	mov    %rsp,%rbp
+  804e00:	48 83 ec 20          	sub    $0x20,%rsp
+  804e04:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  804e07:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e0a:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  804e0d:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  804e11:	be 01 00 00 00       	mov    $0x1,%esi
+  804e16:	48 89 c7             	mov    %rax,%rdi
+  804e19:	48 b8 d1 23 80 00 00 	movabs $0x8023d1,%rax
+  804e20:	00 00 00 
+  804e23:	ff d0                	call   *%rax
+}
+  804e25:	90                   	nop
+  804e26:	c9                   	leave
+  804e27:	c3                   	ret
+
+0000000000804e28 <getchar>:
+
+int
+getchar(void) {
+  804e28:	55                   	push   %rbp
+  804e29:	48 89 e5             	mov    %rsp,%rbp
+  804e2c:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  804e30:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  804e34:	ba 01 00 00 00       	mov    $0x1,%edx
+  804e39:	48 89 c6             	mov    %rax,%rsi
+  804e3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e41:	48 b8 5b 33 80 00 00 	movabs $0x80335b,%rax
+  804e48:	00 00 00 
+  804e4b:	ff d0                	call   *%rax
+  804e4d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  804e50:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e54:	79 05                	jns    804e5b <getchar+0x33>
+    return r;
+  804e56:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804e59:	eb 14                	jmp    804e6f <getchar+0x47>
+  if (r < 1)
+  804e5b:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e5f:	7f 07                	jg     804e68 <getchar+0x40>
+    return -E_EOF;
+  804e61:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  804e66:	eb 07                	jmp    804e6f <getchar+0x47>
+  return c;
+  804e68:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804e6c:	0f b6 c0             	movzbl %al,%eax
+}
+  804e6f:	c9                   	leave
+  804e70:	c3                   	ret
+
+0000000000804e71 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804e71:	55                   	push   %rbp
+  804e72:	48 89 e5             	mov    %rsp,%rbp
+  804e75:	48 83 ec 20          	sub    $0x20,%rsp
+  804e79:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804e7c:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804e80:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804e83:	48 89 d6             	mov    %rdx,%rsi
+  804e86:	89 c7                	mov    %eax,%edi
+  804e88:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  804e8f:	00 00 00 
+  804e92:	ff d0                	call   *%rax
+  804e94:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804e97:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804e9b:	79 05                	jns    804ea2 <iscons+0x31>
+    return r;
+  804e9d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ea0:	eb 1a                	jmp    804ebc <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  804ea2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804ea6:	8b 10                	mov    (%rax),%edx
+  804ea8:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804eaf:	00 00 00 
+  804eb2:	8b 00                	mov    (%rax),%eax
+  804eb4:	39 c2                	cmp    %eax,%edx
+  804eb6:	0f 94 c0             	sete   %al
+  804eb9:	0f b6 c0             	movzbl %al,%eax
+}
+  804ebc:	c9                   	leave
+  804ebd:	c3                   	ret
+
+0000000000804ebe <opencons>:
+
+int
+opencons(void) {
+  804ebe:	55                   	push   %rbp
+  804ebf:	48 89 e5             	mov    %rsp,%rbp
+  804ec2:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  804ec6:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804eca:	48 89 c7             	mov    %rax,%rdi
+  804ecd:	48 b8 1d 2d 80 00 00 	movabs $0x802d1d,%rax
+  804ed4:	00 00 00 
+  804ed7:	ff d0                	call   *%rax
+  804ed9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804edc:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ee0:	79 05                	jns    804ee7 <opencons+0x29>
+    return r;
+  804ee2:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ee5:	eb 66                	jmp    804f4d <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  804ee7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804eeb:	ba 07 04 00 00       	mov    $0x407,%edx
+  804ef0:	48 89 c6             	mov    %rax,%rsi
+  804ef3:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ef8:	48 b8 e8 25 80 00 00 	movabs $0x8025e8,%rax
+  804eff:	00 00 00 
+  804f02:	ff d0                	call   *%rax
+  804f04:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f07:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f0b:	79 05                	jns    804f12 <opencons+0x54>
+    return r;
+  804f0d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f10:	eb 3b                	jmp    804f4d <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  804f12:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f16:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  804f1d:	00 00 00 
+  804f20:	8b 12                	mov    (%rdx),%edx
+  804f22:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  804f24:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f28:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  804f2f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f33:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  804f3a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f3e:	48 89 c7             	mov    %rax,%rdi
+  804f41:	48 b8 cf 2c 80 00 00 	movabs $0x802ccf,%rax
+  804f48:	00 00 00 
+  804f4b:	ff d0                	call   *%rax
+}
+  804f4d:	c9                   	leave
+  804f4e:	c3                   	ret
+
+0000000000804f4f <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  804f4f:	55                   	push   %rbp
+  804f50:	48 89 e5             	mov    %rsp,%rbp
+  804f53:	48 83 ec 20          	sub    $0x20,%rsp
+  804f57:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804f5a:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804f5d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804f61:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f64:	48 89 d6             	mov    %rdx,%rsi
+  804f67:	89 c7                	mov    %eax,%edi
+  804f69:	48 b8 ff 2d 80 00 00 	movabs $0x802dff,%rax
+  804f70:	00 00 00 
+  804f73:	ff d0                	call   *%rax
+  804f75:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f78:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f7c:	79 05                	jns    804f83 <consmode+0x34>
+    return r;
+  804f7e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f81:	eb 34                	jmp    804fb7 <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804f83:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804f87:	8b 10                	mov    (%rax),%edx
+  804f89:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804f90:	00 00 00 
+  804f93:	8b 00                	mov    (%rax),%eax
+  804f95:	39 c2                	cmp    %eax,%edx
+  804f97:	74 07                	je     804fa0 <consmode+0x51>
+    return -E_INVAL;
+  804f99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804f9e:	eb 17                	jmp    804fb7 <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804fa0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fa4:	8b 40 0c             	mov    0xc(%rax),%eax
+  804fa7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804faa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fae:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804fb1:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804fb4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804fb7:	c9                   	leave
+  804fb8:	c3                   	ret
+
+0000000000804fb9 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804fb9:	55                   	push   %rbp
+  804fba:	48 89 e5             	mov    %rsp,%rbp
+  804fbd:	48 83 ec 20          	sub    $0x20,%rsp
+  804fc1:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804fc5:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804fc9:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804fcd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804fd1:	8b 50 0c             	mov    0xc(%rax),%edx
+  804fd4:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804fd8:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804fdc:	48 89 ce             	mov    %rcx,%rsi
+  804fdf:	48 89 c7             	mov    %rax,%rdi
+  804fe2:	48 b8 42 29 80 00 00 	movabs $0x802942,%rax
+  804fe9:	00 00 00 
+  804fec:	ff d0                	call   *%rax
+  804fee:	48 98                	cltq
+}
+  804ff0:	c9                   	leave
+  804ff1:	c3                   	ret
+
+0000000000804ff2 <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804ff2:	55                   	push   %rbp
+  804ff3:	48 89 e5             	mov    %rsp,%rbp
+  804ff6:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804ffd:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  805004:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  80500b:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  805012:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  805019:	eb 74                	jmp    80508f <devcons_write+0x9d>
+    m = n - tot;
+  80501b:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  805022:	89 c2                	mov    %eax,%edx
+  805024:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805027:	29 c2                	sub    %eax,%edx
+  805029:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  80502c:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80502f:	83 f8 7f             	cmp    $0x7f,%eax
+  805032:	76 07                	jbe    80503b <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  805034:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  80503b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80503e:	48 63 d0             	movslq %eax,%rdx
+  805041:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805044:	48 63 c8             	movslq %eax,%rcx
+  805047:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  80504e:	48 01 c1             	add    %rax,%rcx
+  805051:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805058:	48 89 ce             	mov    %rcx,%rsi
+  80505b:	48 89 c7             	mov    %rax,%rdi
+  80505e:	48 b8 5d 1d 80 00 00 	movabs $0x801d5d,%rax
+  805065:	00 00 00 
+  805068:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  80506a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80506d:	48 63 d0             	movslq %eax,%rdx
+  805070:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  805077:	48 89 d6             	mov    %rdx,%rsi
+  80507a:	48 89 c7             	mov    %rax,%rdi
+  80507d:	48 b8 d1 23 80 00 00 	movabs $0x8023d1,%rax
+  805084:	00 00 00 
+  805087:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  805089:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  80508c:	01 45 fc             	add    %eax,-0x4(%rbp)
+  80508f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805092:	48 98                	cltq
+  805094:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  80509b:	0f 82 7a ff ff ff    	jb     80501b <devcons_write+0x29>
+  }
+  return tot;
+  8050a1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8050a4:	48 98                	cltq
+}
+  8050a6:	c9                   	leave
+  8050a7:	c3                   	ret
+
+00000000008050a8 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  8050a8:	55                   	push   %rbp
+  8050a9:	48 89 e5             	mov    %rsp,%rbp
+  8050ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8050b0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  8050b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050b9:	c9                   	leave
+  8050ba:	c3                   	ret
+
+00000000008050bb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8050bb:	55                   	push   %rbp
+  8050bc:	48 89 e5             	mov    %rsp,%rbp
+  8050bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8050c3:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8050c7:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  8050cb:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8050cf:	48 ba bd 5b 80 00 00 	movabs $0x805bbd,%rdx
+  8050d6:	00 00 00 
+  8050d9:	48 89 d6             	mov    %rdx,%rsi
+  8050dc:	48 89 c7             	mov    %rax,%rdi
+  8050df:	48 b8 1a 18 80 00 00 	movabs $0x80181a,%rax
+  8050e6:	00 00 00 
+  8050e9:	ff d0                	call   *%rax
+  return 0;
+  8050eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050f0:	c9                   	leave
+  8050f1:	c3                   	ret
+
+00000000008050f2 <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  8050f2:	55                   	push   %rbp
+  8050f3:	48 89 e5             	mov    %rsp,%rbp
+  8050f6:	48 83 ec 30          	sub    $0x30,%rsp
+  8050fa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8050fe:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  805101:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  805105:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  80510c:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  80510f:	83 e0 02             	and    $0x2,%eax
+  805112:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  805115:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805119:	8b 40 0c             	mov    0xc(%rax),%eax
+  80511c:	83 f8 01             	cmp    $0x1,%eax
+  80511f:	75 04                	jne    805125 <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  805121:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  805125:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  805128:	83 e0 01             	and    $0x1,%eax
+  80512b:	85 c0                	test   %eax,%eax
+  80512d:	74 44                	je     805173 <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  80512f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805132:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805137:	89 c2                	mov    %eax,%edx
+  805139:	be 00 00 00 00       	mov    $0x0,%esi
+  80513e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805143:	48 b8 30 2a 80 00 00 	movabs $0x802a30,%rax
+  80514a:	00 00 00 
+  80514d:	ff d0                	call   *%rax
+  80514f:	83 f8 01             	cmp    $0x1,%eax
+  805152:	75 06                	jne    80515a <devcons_poll+0x68>
+      revents |= POLLIN;
+  805154:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  805158:	eb 19                	jmp    805173 <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  80515a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80515e:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  805164:	0b 45 fc             	or     -0x4(%rbp),%eax
+  805167:	89 c2                	mov    %eax,%edx
+  805169:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80516d:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  805173:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  805176:	c9                   	leave
+  805177:	c3                   	ret
+
+0000000000805178 <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  805178:	55                   	push   %rbp
+  805179:	48 89 e5             	mov    %rsp,%rbp
+  80517c:	48 83 ec 20          	sub    $0x20,%rsp
+  805180:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  805184:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  805188:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  80518c:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  805190:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  805194:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805198:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  80519f:	48 89 c7             	mov    %rax,%rdi
+  8051a2:	48 b8 b0 51 80 00 00 	movabs $0x8051b0,%rax
+  8051a9:	00 00 00 
+  8051ac:	ff d0                	call   *%rax
+}
+  8051ae:	c9                   	leave
+  8051af:	c3                   	ret
+
+00000000008051b0 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  8051b0:	55                   	push   %rbp
+  8051b1:	48 89 e5             	mov    %rsp,%rbp
+  8051b4:	48 83 ec 30          	sub    $0x30,%rsp
+  8051b8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8051bc:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8051c0:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8051c4:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  8051c8:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8051cd:	75 0e                	jne    8051dd <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  8051cf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8051d6:	00 00 00 
+  8051d9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  8051dd:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  8051e2:	75 18                	jne    8051fc <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  8051e4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8051e8:	48 89 c7             	mov    %rax,%rdi
+  8051eb:	48 b8 28 28 80 00 00 	movabs $0x802828,%rax
+  8051f2:	00 00 00 
+  8051f5:	ff d0                	call   *%rax
+  8051f7:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8051fa:	eb 1d                	jmp    805219 <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  8051fc:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805200:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  805204:	48 89 d6             	mov    %rdx,%rsi
+  805207:	48 89 c7             	mov    %rax,%rdi
+  80520a:	48 b8 6e 28 80 00 00 	movabs $0x80286e,%rax
+  805211:	00 00 00 
+  805214:	ff d0                	call   *%rax
+  805216:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  805219:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80521d:	79 2a                	jns    805249 <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  80521f:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  805224:	74 0a                	je     805230 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  805226:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80522a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  805230:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  805235:	74 0a                	je     805241 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  805237:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80523b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  805241:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805244:	e9 aa 00 00 00       	jmp    8052f3 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  805249:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80524e:	74 36                	je     805286 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  805250:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805257:	00 00 00 
+  80525a:	8b 40 04             	mov    0x4(%rax),%eax
+  80525d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  805262:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  805269:	00 00 00 
+  80526c:	48 98                	cltq
+  80526e:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  805275:	48 01 d0             	add    %rdx,%rax
+  805278:	48 05 24 01 00 00    	add    $0x124,%rax
+  80527e:	8b 10                	mov    (%rax),%edx
+  805280:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805284:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  805286:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  80528b:	74 36                	je     8052c3 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  80528d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  805294:	00 00 00 
+  805297:	8b 40 04             	mov    0x4(%rax),%eax
+  80529a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80529f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8052a6:	00 00 00 
+  8052a9:	48 98                	cltq
+  8052ab:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8052b2:	48 01 d0             	add    %rdx,%rax
+  8052b5:	48 05 28 01 00 00    	add    $0x128,%rax
+  8052bb:	8b 10                	mov    (%rax),%edx
+  8052bd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8052c1:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  8052c3:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8052ca:	00 00 00 
+  8052cd:	8b 40 04             	mov    0x4(%rax),%eax
+  8052d0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8052d5:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8052dc:	00 00 00 
+  8052df:	48 98                	cltq
+  8052e1:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8052e8:	48 01 d0             	add    %rdx,%rax
+  8052eb:	48 05 20 01 00 00    	add    $0x120,%rax
+  8052f1:	8b 00                	mov    (%rax),%eax
+  }
+}
+  8052f3:	c9                   	leave
+  8052f4:	c3                   	ret
+
+00000000008052f5 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  8052f5:	55                   	push   %rbp
+  8052f6:	48 89 e5             	mov    %rsp,%rbp
+  8052f9:	48 83 ec 30          	sub    $0x30,%rsp
+  8052fd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  805300:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  805303:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  805307:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  80530a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80530f:	75 5e                	jne    80536f <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  805311:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805318:	00 00 00 
+  80531b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80531f:	eb 4e                	jmp    80536f <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  805321:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805325:	79 3c                	jns    805363 <ipc_send+0x6e>
+  805327:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  80532b:	74 36                	je     805363 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  80532d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  805330:	89 c1                	mov    %eax,%ecx
+  805332:	48 b8 c8 5b 80 00 00 	movabs $0x805bc8,%rax
+  805339:	00 00 00 
+  80533c:	48 89 c2             	mov    %rax,%rdx
+  80533f:	be 54 00 00 00       	mov    $0x54,%esi
+  805344:	48 b8 ee 5b 80 00 00 	movabs $0x805bee,%rax
+  80534b:	00 00 00 
+  80534e:	48 89 c7             	mov    %rax,%rdi
+  805351:	b8 00 00 00 00       	mov    $0x0,%eax
+  805356:	49 b8 4b 06 80 00 00 	movabs $0x80064b,%r8
+  80535d:	00 00 00 
+  805360:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  805363:	48 b8 ab 25 80 00 00 	movabs $0x8025ab,%rax
+  80536a:	00 00 00 
+  80536d:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  80536f:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  805372:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  805375:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  805379:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80537c:	89 c7                	mov    %eax,%edi
+  80537e:	48 b8 d1 27 80 00 00 	movabs $0x8027d1,%rax
+  805385:	00 00 00 
+  805388:	ff d0                	call   *%rax
+  80538a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80538d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  805391:	75 8e                	jne    805321 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  805393:	48 b8 ab 25 80 00 00 	movabs $0x8025ab,%rax
+  80539a:	00 00 00 
+  80539d:	ff d0                	call   *%rax
+}
+  80539f:	90                   	nop
+  8053a0:	c9                   	leave
+  8053a1:	c3                   	ret
+
+00000000008053a2 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  8053a2:	55                   	push   %rbp
+  8053a3:	48 89 e5             	mov    %rsp,%rbp
+  8053a6:	48 83 ec 18          	sub    $0x18,%rsp
+  8053aa:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  8053ad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8053b4:	eb 4d                	jmp    805403 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  8053b6:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8053bd:	00 00 00 
+  8053c0:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053c3:	48 98                	cltq
+  8053c5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8053cc:	48 01 d0             	add    %rdx,%rax
+  8053cf:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  8053d5:	8b 00                	mov    (%rax),%eax
+  8053d7:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  8053da:	75 23                	jne    8053ff <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  8053dc:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8053e3:	00 00 00 
+  8053e6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8053e9:	48 98                	cltq
+  8053eb:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8053f2:	48 01 d0             	add    %rdx,%rax
+  8053f5:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8053fb:	8b 00                	mov    (%rax),%eax
+  8053fd:	eb 12                	jmp    805411 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  8053ff:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  805403:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  80540a:	7e aa                	jle    8053b6 <ipc_find_env+0x14>
+  return 0;
+  80540c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805411:	c9                   	leave
+  805412:	c3                   	ret
+
+0000000000805413 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  805413:	55                   	push   %rbp
+  805414:	48 89 e5             	mov    %rsp,%rbp
+  805417:	48 83 ec 18          	sub    $0x18,%rsp
+  80541b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  80541f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805423:	48 c1 e8 27          	shr    $0x27,%rax
+  805427:	25 ff 01 00 00       	and    $0x1ff,%eax
+  80542c:	48 89 c2             	mov    %rax,%rdx
+  80542f:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  805436:	01 00 00 
+  805439:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80543d:	83 e0 01             	and    $0x1,%eax
+  805440:	48 85 c0             	test   %rax,%rax
+  805443:	74 63                	je     8054a8 <pageref+0x95>
+  805445:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805449:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80544d:	48 89 c2             	mov    %rax,%rdx
+  805450:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805457:	01 00 00 
+  80545a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80545e:	83 e0 01             	and    $0x1,%eax
+  805461:	48 85 c0             	test   %rax,%rax
+  805464:	74 42                	je     8054a8 <pageref+0x95>
+  805466:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80546a:	48 c1 e8 15          	shr    $0x15,%rax
+  80546e:	48 89 c2             	mov    %rax,%rdx
+  805471:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  805478:	01 00 00 
+  80547b:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80547f:	83 e0 01             	and    $0x1,%eax
+  805482:	48 85 c0             	test   %rax,%rax
+  805485:	74 21                	je     8054a8 <pageref+0x95>
+  805487:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80548b:	48 c1 e8 0c          	shr    $0xc,%rax
+  80548f:	48 89 c2             	mov    %rax,%rdx
+  805492:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805499:	01 00 00 
+  80549c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8054a0:	83 e0 01             	and    $0x1,%eax
+  8054a3:	48 85 c0             	test   %rax,%rax
+  8054a6:	75 07                	jne    8054af <pageref+0x9c>
+    return 0;
+  8054a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054ad:	eb 53                	jmp    805502 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  8054af:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8054b3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8054b7:	48 89 c2             	mov    %rax,%rdx
+  8054ba:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8054c1:	01 00 00 
+  8054c4:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8054c8:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  8054cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054d0:	83 e0 01             	and    $0x1,%eax
+  8054d3:	48 85 c0             	test   %rax,%rax
+  8054d6:	75 07                	jne    8054df <pageref+0xcc>
+    return 0;
+  8054d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8054dd:	eb 23                	jmp    805502 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  8054df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8054e3:	48 c1 e8 0c          	shr    $0xc,%rax
+  8054e7:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8054ee:	00 00 00 
+  8054f1:	48 c1 e0 04          	shl    $0x4,%rax
+  8054f5:	48 01 d0             	add    %rdx,%rax
+  8054f8:	48 83 c0 08          	add    $0x8,%rax
+  8054fc:	0f b7 00             	movzwl (%rax),%eax
+  8054ff:	0f b7 c0             	movzwl %ax,%eax
+}
+  805502:	c9                   	leave
+  805503:	c3                   	ret
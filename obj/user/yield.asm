@@ -0,0 +1,8115 @@
+
+obj/user/yield:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.text
+.globl _start
+_start:
+  // See if we were started with arguments on the stack
+#ifndef CONFIG_KSPACE
+  movabs $USTACKTOP, %rax
+  800000:	48 b8 00 b0 ff ff 7f 	movabs $0x7fffffb000,%rax
+  800007:	00 00 00 
+  cmpq %rax,%rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+  jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+  // If not, push dummy argc/argv arguments.
+  // This happens when we are loaded by the kernel,
+  // because the kernel does not know about passing arguments.
+  // Marking argc and argv as zero.
+  pushq $0
+  80000f:	6a 00                	push   $0x0
+  pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+  movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+  movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+  movq $0, %rbp
+  80001c:	48 c7 c5 00 00 00 00 	mov    $0x0,%rbp
+  // spawn leaves rsp only 8-byte aligned; SSE code needs 16.
+  andq $~15, %rsp
+  800023:	48 83 e4 f0          	and    $0xfffffffffffffff0,%rsp
+  call libmain
+  800027:	e8 2a 01 00 00       	call   800156 <libmain>
+1:
+  jmp 1b
+  80002c:	eb fe                	jmp    80002c <args_exist+0x19>
+
+000000000080002e <_my_func>:
+
+ .globl _my_func
+_my_func:
+  mov %rdi, %rax
+  80002e:	48 89 f8             	mov    %rdi,%rax
+  ret
+  800031:	c3                   	ret
+
+0000000000800032 <umain>:
+// yield the processor to other environments
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800032:	55                   	push   %rbp
+  800033:	48 89 e5             	mov    %rsp,%rbp
+  800036:	48 83 ec 20          	sub    $0x20,%rsp
+  80003a:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80003d:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+
+  cprintf("Hello, I am environment %08x.\n", thisenv->env_id);
+  800041:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  800048:	00 00 00 
+  80004b:	8b 40 04             	mov    0x4(%rax),%eax
+  80004e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800053:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80005a:	00 00 00 
+  80005d:	48 98                	cltq
+  80005f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800066:	48 01 d0             	add    %rdx,%rax
+  800069:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80006f:	8b 00                	mov    (%rax),%eax
+  800071:	89 c6                	mov    %eax,%esi
+  800073:	48 b8 c0 50 80 00 00 	movabs $0x8050c0,%rax
+  80007a:	00 00 00 
+  80007d:	48 89 c7             	mov    %rax,%rdi
+  800080:	b8 00 00 00 00       	mov    $0x0,%eax
+  800085:	48 ba 02 03 80 00 00 	movabs $0x800302,%rdx
+  80008c:	00 00 00 
+  80008f:	ff d2                	call   *%rdx
+  for (i = 0; i < 5; i++) {
+  800091:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  800098:	eb 63                	jmp    8000fd <umain+0xcb>
+    sys_yield();
+  80009a:	48 b8 43 20 80 00 00 	movabs $0x802043,%rax
+  8000a1:	00 00 00 
+  8000a4:	ff d0                	call   *%rax
+    cprintf("Back in environment %08x, iteration %d.\n",
+            thisenv->env_id, i);
+  8000a6:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8000ad:	00 00 00 
+  8000b0:	8b 40 04             	mov    0x4(%rax),%eax
+  8000b3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000b8:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  8000bf:	00 00 00 
+  8000c2:	48 98                	cltq
+  8000c4:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8000cb:	48 01 d0             	add    %rdx,%rax
+  8000ce:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  8000d4:	8b 00                	mov    (%rax),%eax
+    cprintf("Back in environment %08x, iteration %d.\n",
+  8000d6:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  8000d9:	89 c6                	mov    %eax,%esi
+  8000db:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  8000e2:	00 00 00 
+  8000e5:	48 89 c7             	mov    %rax,%rdi
+  8000e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ed:	48 b9 02 03 80 00 00 	movabs $0x800302,%rcx
+  8000f4:	00 00 00 
+  8000f7:	ff d1                	call   *%rcx
+  for (i = 0; i < 5; i++) {
+  8000f9:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  8000fd:	83 7d fc 04          	cmpl   $0x4,-0x4(%rbp)
+  800101:	7e 97                	jle    80009a <umain+0x68>
+  }
+  cprintf("All done in environment %08x.\n", thisenv->env_id);
+  800103:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80010a:	00 00 00 
+  80010d:	8b 40 04             	mov    0x4(%rax),%eax
+  800110:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800115:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80011c:	00 00 00 
+  80011f:	48 98                	cltq
+  800121:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  800128:	48 01 d0             	add    %rdx,%rax
+  80012b:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  800131:	8b 00                	mov    (%rax),%eax
+  800133:	89 c6                	mov    %eax,%esi
+  800135:	48 b8 10 51 80 00 00 	movabs $0x805110,%rax
+  80013c:	00 00 00 
+  80013f:	48 89 c7             	mov    %rax,%rdi
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	48 ba 02 03 80 00 00 	movabs $0x800302,%rdx
+  80014e:	00 00 00 
+  800151:	ff d2                	call   *%rdx
+}
+  800153:	90                   	nop
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+0000000000800156 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800156:	55                   	push   %rbp
+  800157:	48 89 e5             	mov    %rsp,%rbp
+  80015a:	48 83 ec 20          	sub    $0x20,%rsp
+  80015e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  800161:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // Perform global constructor initialisation (e.g. asan)
+  // This must be done as early as possible
+  extern void (*__ctors_start)();
+  extern void (*__ctors_end)();
+  void (**ctor)() = &__ctors_start;
+  800165:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80016c:	00 00 00 
+  80016f:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800173:	eb 13                	jmp    800188 <libmain+0x32>
+    (*ctor)();
+  800175:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800179:	48 8b 10             	mov    (%rax),%rdx
+  80017c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800181:	ff d2                	call   *%rdx
+    ctor++;
+  800183:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+  while (ctor < &__ctors_end) {
+  800188:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  80018f:	00 00 00 
+  800192:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  800196:	72 dd                	jb     800175 <libmain+0x1f>
+  // LAB 8: Your code here.
+  thisenv = &envs[ENVX(sys_getenvid())];
+#endif
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800198:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  80019c:	7e 14                	jle    8001b2 <libmain+0x5c>
+    binaryname = argv[0];
+  80019e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8001a2:	48 8b 00             	mov    (%rax),%rax
+  8001a5:	48 ba 00 60 80 00 00 	movabs $0x806000,%rdx
+  8001ac:	00 00 00 
+  8001af:	48 89 02             	mov    %rax,(%rdx)
+
+  // call user main routine
+  umain(argc, argv);
+  8001b2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8001b6:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8001b9:	48 89 d6             	mov    %rdx,%rsi
+  8001bc:	89 c7                	mov    %eax,%edi
+  8001be:	48 b8 32 00 80 00 00 	movabs $0x800032,%rax
+  8001c5:	00 00 00 
+  8001c8:	ff d0                	call   *%rax
+
+  // exit
+#ifdef JOS_PROG
+  sys_exit();
+#else
+  exit();
+  8001ca:	48 b8 d9 01 80 00 00 	movabs $0x8001d9,%rax
+  8001d1:	00 00 00 
+  8001d4:	ff d0                	call   *%rax
+#endif
+}
+  8001d6:	90                   	nop
+  8001d7:	c9                   	leave
+  8001d8:	c3                   	ret
+
+00000000008001d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d9:	55                   	push   %rbp
+  8001da:	48 89 e5             	mov    %rsp,%rbp
+  close_all();
+  8001dd:	48 b8 57 2b 80 00 00 	movabs $0x802b57,%rax
+  8001e4:	00 00 00 
+  8001e7:	ff d0                	call   *%rax
+  sys_env_exit(0);
+  8001e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ee:	48 b8 38 1f 80 00 00 	movabs $0x801f38,%rax
+  8001f5:	00 00 00 
+  8001f8:	ff d0                	call   *%rax
+}
+  8001fa:	90                   	nop
+  8001fb:	5d                   	pop    %rbp
+  8001fc:	c3                   	ret
+
+00000000008001fd <putch>:
+  int cnt; // total bytes printed so far
+  char buf[256];
+};
+
+static void
+putch(int ch, struct printbuf *b) {
+  8001fd:	55                   	push   %rbp
+  8001fe:	48 89 e5             	mov    %rsp,%rbp
+  800201:	48 83 ec 10          	sub    $0x10,%rsp
+  800205:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800208:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->buf[b->idx++] = ch;
+  80020c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800210:	8b 00                	mov    (%rax),%eax
+  800212:	8d 48 01             	lea    0x1(%rax),%ecx
+  800215:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800219:	89 0a                	mov    %ecx,(%rdx)
+  80021b:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  80021e:	89 d1                	mov    %edx,%ecx
+  800220:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800224:	48 98                	cltq
+  800226:	88 4c 02 08          	mov    %cl,0x8(%rdx,%rax,1)
+  if (b->idx == 256 - 1) {
+  80022a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80022e:	8b 00                	mov    (%rax),%eax
+  800230:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800235:	75 2c                	jne    800263 <putch+0x66>
+    sys_cputs(b->buf, b->idx);
+  800237:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80023b:	8b 00                	mov    (%rax),%eax
+  80023d:	48 98                	cltq
+  80023f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800243:	48 83 c2 08          	add    $0x8,%rdx
+  800247:	48 89 c6             	mov    %rax,%rsi
+  80024a:	48 89 d7             	mov    %rdx,%rdi
+  80024d:	48 b8 69 1e 80 00 00 	movabs $0x801e69,%rax
+  800254:	00 00 00 
+  800257:	ff d0                	call   *%rax
+    b->idx = 0;
+  800259:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80025d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+  }
+  b->cnt++;
+  800263:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800267:	8b 40 04             	mov    0x4(%rax),%eax
+  80026a:	8d 50 01             	lea    0x1(%rax),%edx
+  80026d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800271:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  800274:	90                   	nop
+  800275:	c9                   	leave
+  800276:	c3                   	ret
+
+0000000000800277 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800277:	55                   	push   %rbp
+  800278:	48 89 e5             	mov    %rsp,%rbp
+  80027b:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  800282:	48 89 bd e8 fe ff ff 	mov    %rdi,-0x118(%rbp)
+  800289:	48 89 b5 e0 fe ff ff 	mov    %rsi,-0x120(%rbp)
+  struct printbuf b;
+
+  b.idx = 0;
+  800290:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%rbp)
+  800297:	00 00 00 
+  b.cnt = 0;
+  80029a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%rbp)
+  8002a1:	00 00 00 
+  vprintfmt((void *)putch, &b, fmt, ap);
+  8002a4:	48 8b 8d e0 fe ff ff 	mov    -0x120(%rbp),%rcx
+  8002ab:	48 8b 95 e8 fe ff ff 	mov    -0x118(%rbp),%rdx
+  8002b2:	48 8d 85 f0 fe ff ff 	lea    -0x110(%rbp),%rax
+  8002b9:	48 89 c6             	mov    %rax,%rsi
+  8002bc:	48 b8 fd 01 80 00 00 	movabs $0x8001fd,%rax
+  8002c3:	00 00 00 
+  8002c6:	48 89 c7             	mov    %rax,%rdi
+  8002c9:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  8002d0:	00 00 00 
+  8002d3:	ff d0                	call   *%rax
+  sys_cputs(b.buf, b.idx);
+  8002d5:	8b 85 f0 fe ff ff    	mov    -0x110(%rbp),%eax
+  8002db:	48 98                	cltq
+  8002dd:	48 8d 95 f0 fe ff ff 	lea    -0x110(%rbp),%rdx
+  8002e4:	48 83 c2 08          	add    $0x8,%rdx
+  8002e8:	48 89 c6             	mov    %rax,%rsi
+  8002eb:	48 89 d7             	mov    %rdx,%rdi
+  8002ee:	48 b8 69 1e 80 00 00 	movabs $0x801e69,%rax
+  8002f5:	00 00 00 
+  8002f8:	ff d0                	call   *%rax
+
+  return b.cnt;
+  8002fa:	8b 85 f4 fe ff ff    	mov    -0x10c(%rbp),%eax
+}
+  800300:	c9                   	leave
+  800301:	c3                   	ret
+
+0000000000800302 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800302:	55                   	push   %rbp
+  800303:	48 89 e5             	mov    %rsp,%rbp
+  800306:	48 81 ec e0 00 00 00 	sub    $0xe0,%rsp
+  80030d:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800314:	48 89 b5 58 ff ff ff 	mov    %rsi,-0xa8(%rbp)
+  80031b:	48 89 95 60 ff ff ff 	mov    %rdx,-0xa0(%rbp)
+  800322:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800329:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800330:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800337:	84 c0                	test   %al,%al
+  800339:	74 20                	je     80035b <cprintf+0x59>
+  80033b:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  80033f:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800343:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800347:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  80034b:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  80034f:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800353:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800357:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80035b:	c7 85 30 ff ff ff 08 	movl   $0x8,-0xd0(%rbp)
+  800362:	00 00 00 
+  800365:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  80036c:	00 00 00 
+  80036f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800373:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80037a:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800381:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  cnt = vcprintf(fmt, ap);
+  800388:	48 8d 95 30 ff ff ff 	lea    -0xd0(%rbp),%rdx
+  80038f:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800396:	48 89 d6             	mov    %rdx,%rsi
+  800399:	48 89 c7             	mov    %rax,%rdi
+  80039c:	48 b8 77 02 80 00 00 	movabs $0x800277,%rax
+  8003a3:	00 00 00 
+  8003a6:	ff d0                	call   *%rax
+  8003a8:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return cnt;
+  8003ae:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  8003b4:	c9                   	leave
+  8003b5:	c3                   	ret
+
+00000000008003b6 <printnum>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void *), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc) {
+  8003b6:	55                   	push   %rbp
+  8003b7:	48 89 e5             	mov    %rsp,%rbp
+  8003ba:	48 83 ec 30          	sub    $0x30,%rsp
+  8003be:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8003c2:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8003c6:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  8003ca:	89 4d e4             	mov    %ecx,-0x1c(%rbp)
+  8003cd:	44 89 45 e0          	mov    %r8d,-0x20(%rbp)
+  8003d1:	44 89 4d dc          	mov    %r9d,-0x24(%rbp)
+  // first recursively print all preceding (more significant) digits
+  if (num >= base) {
+  8003d5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8003d8:	48 39 45 e8          	cmp    %rax,-0x18(%rbp)
+  8003dc:	72 54                	jb     800432 <printnum+0x7c>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003de:	8b 45 e0             	mov    -0x20(%rbp),%eax
+  8003e1:	8d 78 ff             	lea    -0x1(%rax),%edi
+  8003e4:	8b 75 e4             	mov    -0x1c(%rbp),%esi
+  8003e7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8003eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003f0:	48 f7 f6             	div    %rsi
+  8003f3:	49 89 c2             	mov    %rax,%r10
+  8003f6:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  8003f9:	8b 55 e4             	mov    -0x1c(%rbp),%edx
+  8003fc:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  800400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800404:	41 89 c9             	mov    %ecx,%r9d
+  800407:	41 89 f8             	mov    %edi,%r8d
+  80040a:	89 d1                	mov    %edx,%ecx
+  80040c:	4c 89 d2             	mov    %r10,%rdx
+  80040f:	48 89 c7             	mov    %rax,%rdi
+  800412:	48 b8 b6 03 80 00 00 	movabs $0x8003b6,%rax
+  800419:	00 00 00 
+  80041c:	ff d0                	call   *%rax
+  80041e:	eb 1c                	jmp    80043c <printnum+0x86>
+  } else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800420:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800424:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  800427:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  80042b:	48 89 d6             	mov    %rdx,%rsi
+  80042e:	89 c7                	mov    %eax,%edi
+  800430:	ff d1                	call   *%rcx
+    while (--width > 0)
+  800432:	83 6d e0 01          	subl   $0x1,-0x20(%rbp)
+  800436:	83 7d e0 00          	cmpl   $0x0,-0x20(%rbp)
+  80043a:	7f e4                	jg     800420 <printnum+0x6a>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80043c:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  80043f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800443:	ba 00 00 00 00       	mov    $0x0,%edx
+  800448:	48 f7 f1             	div    %rcx
+  80044b:	48 b8 70 53 80 00 00 	movabs $0x805370,%rax
+  800452:	00 00 00 
+  800455:	0f b6 04 10          	movzbl (%rax,%rdx,1),%eax
+  800459:	0f be c0             	movsbl %al,%eax
+  80045c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800460:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  800464:	48 89 d6             	mov    %rdx,%rsi
+  800467:	89 c7                	mov    %eax,%edi
+  800469:	ff d1                	call   *%rcx
+}
+  80046b:	90                   	nop
+  80046c:	c9                   	leave
+  80046d:	c3                   	ret
+
+000000000080046e <getuint>:
+
+// Get an unsigned int of various possible sizes from a varargs list,
+// depending on the lflag parameter.
+static unsigned long long
+getuint(va_list *ap, int lflag) {
+  80046e:	55                   	push   %rbp
+  80046f:	48 89 e5             	mov    %rsp,%rbp
+  800472:	48 83 ec 10          	sub    $0x10,%rsp
+  800476:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80047a:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  80047d:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800481:	7e 4b                	jle    8004ce <getuint+0x60>
+    return va_arg(*ap, unsigned long long);
+  800483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800487:	8b 00                	mov    (%rax),%eax
+  800489:	83 f8 2f             	cmp    $0x2f,%eax
+  80048c:	77 24                	ja     8004b2 <getuint+0x44>
+  80048e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800492:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800496:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80049a:	8b 00                	mov    (%rax),%eax
+  80049c:	89 c0                	mov    %eax,%eax
+  80049e:	48 01 d0             	add    %rdx,%rax
+  8004a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004a5:	8b 12                	mov    (%rdx),%edx
+  8004a7:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004aa:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004ae:	89 0a                	mov    %ecx,(%rdx)
+  8004b0:	eb 14                	jmp    8004c6 <getuint+0x58>
+  8004b2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004b6:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8004ba:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8004be:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004c2:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8004c6:	48 8b 00             	mov    (%rax),%rax
+  8004c9:	e9 95 00 00 00       	jmp    800563 <getuint+0xf5>
+  else if (lflag)
+  8004ce:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8004d2:	74 48                	je     80051c <getuint+0xae>
+    return va_arg(*ap, unsigned long);
+  8004d4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004d8:	8b 00                	mov    (%rax),%eax
+  8004da:	83 f8 2f             	cmp    $0x2f,%eax
+  8004dd:	77 24                	ja     800503 <getuint+0x95>
+  8004df:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004e3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8004e7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8004eb:	8b 00                	mov    (%rax),%eax
+  8004ed:	89 c0                	mov    %eax,%eax
+  8004ef:	48 01 d0             	add    %rdx,%rax
+  8004f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004f6:	8b 12                	mov    (%rdx),%edx
+  8004f8:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8004fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004ff:	89 0a                	mov    %ecx,(%rdx)
+  800501:	eb 14                	jmp    800517 <getuint+0xa9>
+  800503:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800507:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80050b:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80050f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800513:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800517:	48 8b 00             	mov    (%rax),%rax
+  80051a:	eb 47                	jmp    800563 <getuint+0xf5>
+  else
+    return va_arg(*ap, unsigned int);
+  80051c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800520:	8b 00                	mov    (%rax),%eax
+  800522:	83 f8 2f             	cmp    $0x2f,%eax
+  800525:	77 24                	ja     80054b <getuint+0xdd>
+  800527:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80052b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80052f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800533:	8b 00                	mov    (%rax),%eax
+  800535:	89 c0                	mov    %eax,%eax
+  800537:	48 01 d0             	add    %rdx,%rax
+  80053a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80053e:	8b 12                	mov    (%rdx),%edx
+  800540:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  800543:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800547:	89 0a                	mov    %ecx,(%rdx)
+  800549:	eb 14                	jmp    80055f <getuint+0xf1>
+  80054b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80054f:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800553:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800557:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80055b:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80055f:	8b 00                	mov    (%rax),%eax
+  800561:	89 c0                	mov    %eax,%eax
+}
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <getint>:
+
+// Same as getuint but signed - can't use getuint
+// because of sign extension
+static long long
+getint(va_list *ap, int lflag) {
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	48 83 ec 10          	sub    $0x10,%rsp
+  80056d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  800571:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  if (lflag >= 2)
+  800574:	83 7d f4 01          	cmpl   $0x1,-0xc(%rbp)
+  800578:	7e 4b                	jle    8005c5 <getint+0x60>
+    return va_arg(*ap, long long);
+  80057a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80057e:	8b 00                	mov    (%rax),%eax
+  800580:	83 f8 2f             	cmp    $0x2f,%eax
+  800583:	77 24                	ja     8005a9 <getint+0x44>
+  800585:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800589:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80058d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800591:	8b 00                	mov    (%rax),%eax
+  800593:	89 c0                	mov    %eax,%eax
+  800595:	48 01 d0             	add    %rdx,%rax
+  800598:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80059c:	8b 12                	mov    (%rdx),%edx
+  80059e:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005a1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005a5:	89 0a                	mov    %ecx,(%rdx)
+  8005a7:	eb 14                	jmp    8005bd <getint+0x58>
+  8005a9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005ad:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8005b1:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  8005b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005b9:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  8005bd:	48 8b 00             	mov    (%rax),%rax
+  8005c0:	e9 95 00 00 00       	jmp    80065a <getint+0xf5>
+  else if (lflag)
+  8005c5:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8005c9:	74 48                	je     800613 <getint+0xae>
+    return va_arg(*ap, long);
+  8005cb:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005cf:	8b 00                	mov    (%rax),%eax
+  8005d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d4:	77 24                	ja     8005fa <getint+0x95>
+  8005d6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005da:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8005de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005e2:	8b 00                	mov    (%rax),%eax
+  8005e4:	89 c0                	mov    %eax,%eax
+  8005e6:	48 01 d0             	add    %rdx,%rax
+  8005e9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005ed:	8b 12                	mov    (%rdx),%edx
+  8005ef:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  8005f2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8005f6:	89 0a                	mov    %ecx,(%rdx)
+  8005f8:	eb 14                	jmp    80060e <getint+0xa9>
+  8005fa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8005fe:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800602:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  800606:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80060a:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  80060e:	48 8b 00             	mov    (%rax),%rax
+  800611:	eb 47                	jmp    80065a <getint+0xf5>
+  else
+    return va_arg(*ap, int);
+  800613:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800617:	8b 00                	mov    (%rax),%eax
+  800619:	83 f8 2f             	cmp    $0x2f,%eax
+  80061c:	77 24                	ja     800642 <getint+0xdd>
+  80061e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800622:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  800626:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80062a:	8b 00                	mov    (%rax),%eax
+  80062c:	89 c0                	mov    %eax,%eax
+  80062e:	48 01 d0             	add    %rdx,%rax
+  800631:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800635:	8b 12                	mov    (%rdx),%edx
+  800637:	8d 4a 08             	lea    0x8(%rdx),%ecx
+  80063a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80063e:	89 0a                	mov    %ecx,(%rdx)
+  800640:	eb 14                	jmp    800656 <getint+0xf1>
+  800642:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  800646:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80064a:	48 8d 48 08          	lea    0x8(%rax),%rcx
+  80064e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800652:	48 89 4a 08          	mov    %rcx,0x8(%rdx)
+  800656:	8b 00                	mov    (%rax),%eax
+  800658:	48 98                	cltq
+}
+  80065a:	c9                   	leave
+  80065b:	c3                   	ret
+
+000000000080065c <vprintfmt>:
+
+// Main function to format and print a string.
+void printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...);
+
+void
+vprintfmt(void (*putch)(int, void *), void *putdat, const char *fmt, va_list ap) {
+  80065c:	55                   	push   %rbp
+  80065d:	48 89 e5             	mov    %rsp,%rbp
+  800660:	41 54                	push   %r12
+  800662:	53                   	push   %rbx
+  800663:	48 83 ec 60          	sub    $0x60,%rsp
+  800667:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80066b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  80066f:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  800673:	48 89 4d 90          	mov    %rcx,-0x70(%rbp)
+  register int ch, err;
+  unsigned long long num;
+  int base, lflag, width, precision, altflag;
+  char padc;
+  va_list aq;
+  va_copy(aq, ap);
+  800677:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80067b:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  80067f:	48 8b 06             	mov    (%rsi),%rax
+  800682:	48 8b 56 08          	mov    0x8(%rsi),%rdx
+  800686:	48 89 01             	mov    %rax,(%rcx)
+  800689:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+  80068d:	48 8b 46 10          	mov    0x10(%rsi),%rax
+  800691:	48 89 41 10          	mov    %rax,0x10(%rcx)
+
+  while (1) {
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800695:	eb 17                	jmp    8006ae <vprintfmt+0x52>
+      if (ch == '\0')
+  800697:	85 db                	test   %ebx,%ebx
+  800699:	0f 84 bf 04 00 00    	je     800b5e <vprintfmt+0x502>
+        return;
+      putch(ch, putdat);
+  80069f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006a3:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8006a7:	48 89 c6             	mov    %rax,%rsi
+  8006aa:	89 df                	mov    %ebx,%edi
+  8006ac:	ff d2                	call   *%rdx
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  8006ae:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006b2:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006b6:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006ba:	0f b6 00             	movzbl (%rax),%eax
+  8006bd:	0f b6 d8             	movzbl %al,%ebx
+  8006c0:	83 fb 25             	cmp    $0x25,%ebx
+  8006c3:	75 d2                	jne    800697 <vprintfmt+0x3b>
+    }
+
+    // Process a %-escape sequence
+    padc      = ' ';
+  8006c5:	c6 45 d3 20          	movb   $0x20,-0x2d(%rbp)
+    width     = -1;
+  8006c9:	c7 45 dc ff ff ff ff 	movl   $0xffffffff,-0x24(%rbp)
+    precision = -1;
+  8006d0:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+    lflag     = 0;
+  8006d7:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%rbp)
+    altflag   = 0;
+  8006de:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+  8006e5:	eb 04                	jmp    8006eb <vprintfmt+0x8f>
+        goto process_precision;
+
+      case '.':
+        if (width < 0)
+          width = 0;
+        goto reswitch;
+  8006e7:	90                   	nop
+  8006e8:	eb 01                	jmp    8006eb <vprintfmt+0x8f>
+        goto reswitch;
+
+      process_precision:
+        if (width < 0)
+          width = precision, precision = -1;
+        goto reswitch;
+  8006ea:	90                   	nop
+    switch (ch = *(unsigned char *)fmt++) {
+  8006eb:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8006ef:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006f3:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  8006f7:	0f b6 00             	movzbl (%rax),%eax
+  8006fa:	0f b6 d8             	movzbl %al,%ebx
+  8006fd:	8d 43 dd             	lea    -0x23(%rbx),%eax
+  800700:	83 f8 55             	cmp    $0x55,%eax
+  800703:	0f 87 22 04 00 00    	ja     800b2b <vprintfmt+0x4cf>
+  800709:	89 c0                	mov    %eax,%eax
+  80070b:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  800712:	00 
+  800713:	48 b8 98 53 80 00 00 	movabs $0x805398,%rax
+  80071a:	00 00 00 
+  80071d:	48 01 d0             	add    %rdx,%rax
+  800720:	48 8b 00             	mov    (%rax),%rax
+  800723:	ff e0                	jmp    *%rax
+        padc = '-';
+  800725:	c6 45 d3 2d          	movb   $0x2d,-0x2d(%rbp)
+        goto reswitch;
+  800729:	eb c0                	jmp    8006eb <vprintfmt+0x8f>
+        padc = '0';
+  80072b:	c6 45 d3 30          	movb   $0x30,-0x2d(%rbp)
+        goto reswitch;
+  80072f:	eb ba                	jmp    8006eb <vprintfmt+0x8f>
+        for (precision = 0;; ++fmt) {
+  800731:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%rbp)
+          precision = precision * 10 + ch - '0';
+  800738:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80073b:	89 d0                	mov    %edx,%eax
+  80073d:	c1 e0 02             	shl    $0x2,%eax
+  800740:	01 d0                	add    %edx,%eax
+  800742:	01 c0                	add    %eax,%eax
+  800744:	01 d8                	add    %ebx,%eax
+  800746:	83 e8 30             	sub    $0x30,%eax
+  800749:	89 45 d8             	mov    %eax,-0x28(%rbp)
+          ch        = *fmt;
+  80074c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800750:	0f b6 00             	movzbl (%rax),%eax
+  800753:	0f be d8             	movsbl %al,%ebx
+          if (ch < '0' || ch > '9')
+  800756:	83 fb 2f             	cmp    $0x2f,%ebx
+  800759:	7e 60                	jle    8007bb <vprintfmt+0x15f>
+  80075b:	83 fb 39             	cmp    $0x39,%ebx
+  80075e:	7f 5b                	jg     8007bb <vprintfmt+0x15f>
+        for (precision = 0;; ++fmt) {
+  800760:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+          precision = precision * 10 + ch - '0';
+  800765:	eb d1                	jmp    800738 <vprintfmt+0xdc>
+        precision = va_arg(aq, int);
+  800767:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076a:	83 f8 2f             	cmp    $0x2f,%eax
+  80076d:	77 17                	ja     800786 <vprintfmt+0x12a>
+  80076f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800773:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800776:	89 d2                	mov    %edx,%edx
+  800778:	48 01 d0             	add    %rdx,%rax
+  80077b:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80077e:	83 c2 08             	add    $0x8,%edx
+  800781:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800784:	eb 0c                	jmp    800792 <vprintfmt+0x136>
+  800786:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80078a:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  80078e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800792:	8b 00                	mov    (%rax),%eax
+  800794:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        goto process_precision;
+  800797:	eb 23                	jmp    8007bc <vprintfmt+0x160>
+        if (width < 0)
+  800799:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80079d:	0f 89 44 ff ff ff    	jns    8006e7 <vprintfmt+0x8b>
+          width = 0;
+  8007a3:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%rbp)
+        goto reswitch;
+  8007aa:	e9 38 ff ff ff       	jmp    8006e7 <vprintfmt+0x8b>
+        altflag = 1;
+  8007af:	c7 45 d4 01 00 00 00 	movl   $0x1,-0x2c(%rbp)
+        goto reswitch;
+  8007b6:	e9 30 ff ff ff       	jmp    8006eb <vprintfmt+0x8f>
+        goto process_precision;
+  8007bb:	90                   	nop
+        if (width < 0)
+  8007bc:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8007c0:	0f 89 24 ff ff ff    	jns    8006ea <vprintfmt+0x8e>
+          width = precision, precision = -1;
+  8007c6:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  8007c9:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  8007cc:	c7 45 d8 ff ff ff ff 	movl   $0xffffffff,-0x28(%rbp)
+        goto reswitch;
+  8007d3:	e9 12 ff ff ff       	jmp    8006ea <vprintfmt+0x8e>
+
+      // long flag (doubled for long long)
+      case 'l':
+        lflag++;
+  8007d8:	83 45 e0 01          	addl   $0x1,-0x20(%rbp)
+        goto reswitch;
+  8007dc:	e9 0a ff ff ff       	jmp    8006eb <vprintfmt+0x8f>
+
+      // character
+      case 'c':
+        putch(va_arg(aq, int), putdat);
+  8007e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e7:	77 17                	ja     800800 <vprintfmt+0x1a4>
+  8007e9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8007ed:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007f0:	89 d2                	mov    %edx,%edx
+  8007f2:	48 01 d0             	add    %rdx,%rax
+  8007f5:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8007f8:	83 c2 08             	add    $0x8,%edx
+  8007fb:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8007fe:	eb 0c                	jmp    80080c <vprintfmt+0x1b0>
+  800800:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800804:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800808:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80080c:	8b 00                	mov    (%rax),%eax
+  80080e:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  800812:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  800816:	48 89 d6             	mov    %rdx,%rsi
+  800819:	89 c7                	mov    %eax,%edi
+  80081b:	ff d1                	call   *%rcx
+        break;
+  80081d:	e9 37 03 00 00       	jmp    800b59 <vprintfmt+0x4fd>
+
+      // error message
+      case 'i':
+        err = va_arg(aq, int);
+  800822:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800825:	83 f8 2f             	cmp    $0x2f,%eax
+  800828:	77 17                	ja     800841 <vprintfmt+0x1e5>
+  80082a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80082e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800831:	89 d2                	mov    %edx,%edx
+  800833:	48 01 d0             	add    %rdx,%rax
+  800836:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800839:	83 c2 08             	add    $0x8,%edx
+  80083c:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80083f:	eb 0c                	jmp    80084d <vprintfmt+0x1f1>
+  800841:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800845:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800849:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80084d:	8b 18                	mov    (%rax),%ebx
+        if (err < 0)
+  80084f:	85 db                	test   %ebx,%ebx
+  800851:	79 02                	jns    800855 <vprintfmt+0x1f9>
+          err = -err;
+  800853:	f7 db                	neg    %ebx
+        if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800855:	83 fb 15             	cmp    $0x15,%ebx
+  800858:	7f 16                	jg     800870 <vprintfmt+0x214>
+  80085a:	48 ba c0 52 80 00 00 	movabs $0x8052c0,%rdx
+  800861:	00 00 00 
+  800864:	48 63 c3             	movslq %ebx,%rax
+  800867:	4c 8b 24 c2          	mov    (%rdx,%rax,8),%r12
+  80086b:	4d 85 e4             	test   %r12,%r12
+  80086e:	75 2e                	jne    80089e <vprintfmt+0x242>
+          printfmt(putch, putdat, "error %d", err);
+  800870:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800874:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800878:	89 d9                	mov    %ebx,%ecx
+  80087a:	48 ba 81 53 80 00 00 	movabs $0x805381,%rdx
+  800881:	00 00 00 
+  800884:	48 89 c7             	mov    %rax,%rdi
+  800887:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088c:	49 b8 68 0b 80 00 00 	movabs $0x800b68,%r8
+  800893:	00 00 00 
+  800896:	41 ff d0             	call   *%r8
+        else
+          printfmt(putch, putdat, "%s", p);
+        break;
+  800899:	e9 bb 02 00 00       	jmp    800b59 <vprintfmt+0x4fd>
+          printfmt(putch, putdat, "%s", p);
+  80089e:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  8008a2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8008a6:	4c 89 e1             	mov    %r12,%rcx
+  8008a9:	48 ba 8a 53 80 00 00 	movabs $0x80538a,%rdx
+  8008b0:	00 00 00 
+  8008b3:	48 89 c7             	mov    %rax,%rdi
+  8008b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bb:	49 b8 68 0b 80 00 00 	movabs $0x800b68,%r8
+  8008c2:	00 00 00 
+  8008c5:	41 ff d0             	call   *%r8
+        break;
+  8008c8:	e9 8c 02 00 00       	jmp    800b59 <vprintfmt+0x4fd>
+
+      // string
+      case 's':
+        if ((p = va_arg(aq, char *)) == NULL)
+  8008cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d3:	77 17                	ja     8008ec <vprintfmt+0x290>
+  8008d5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8008d9:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008dc:	89 d2                	mov    %edx,%edx
+  8008de:	48 01 d0             	add    %rdx,%rax
+  8008e1:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8008e4:	83 c2 08             	add    $0x8,%edx
+  8008e7:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8008ea:	eb 0c                	jmp    8008f8 <vprintfmt+0x29c>
+  8008ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8008f0:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  8008f4:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8008f8:	4c 8b 20             	mov    (%rax),%r12
+  8008fb:	4d 85 e4             	test   %r12,%r12
+  8008fe:	75 0a                	jne    80090a <vprintfmt+0x2ae>
+          p = "(null)";
+  800900:	49 bc 8d 53 80 00 00 	movabs $0x80538d,%r12
+  800907:	00 00 00 
+        if (width > 0 && padc != '-')
+  80090a:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80090e:	7e 78                	jle    800988 <vprintfmt+0x32c>
+  800910:	80 7d d3 2d          	cmpb   $0x2d,-0x2d(%rbp)
+  800914:	74 72                	je     800988 <vprintfmt+0x32c>
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800916:	8b 45 d8             	mov    -0x28(%rbp),%eax
+  800919:	48 98                	cltq
+  80091b:	48 89 c6             	mov    %rax,%rsi
+  80091e:	4c 89 e7             	mov    %r12,%rdi
+  800921:	48 b8 74 12 80 00 00 	movabs $0x801274,%rax
+  800928:	00 00 00 
+  80092b:	ff d0                	call   *%rax
+  80092d:	29 45 dc             	sub    %eax,-0x24(%rbp)
+  800930:	eb 17                	jmp    800949 <vprintfmt+0x2ed>
+            putch(padc, putdat);
+  800932:	0f be 45 d3          	movsbl -0x2d(%rbp),%eax
+  800936:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80093a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80093e:	48 89 d6             	mov    %rdx,%rsi
+  800941:	89 c7                	mov    %eax,%edi
+  800943:	ff d1                	call   *%rcx
+          for (width -= strnlen(p, precision); width > 0; width--)
+  800945:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800949:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80094d:	7f e3                	jg     800932 <vprintfmt+0x2d6>
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80094f:	eb 37                	jmp    800988 <vprintfmt+0x32c>
+          if (altflag && (ch < ' ' || ch > '~'))
+  800951:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800955:	74 1e                	je     800975 <vprintfmt+0x319>
+  800957:	83 fb 1f             	cmp    $0x1f,%ebx
+  80095a:	7e 05                	jle    800961 <vprintfmt+0x305>
+  80095c:	83 fb 7e             	cmp    $0x7e,%ebx
+  80095f:	7e 14                	jle    800975 <vprintfmt+0x319>
+            putch('?', putdat);
+  800961:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800965:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800969:	48 89 c6             	mov    %rax,%rsi
+  80096c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800971:	ff d2                	call   *%rdx
+  800973:	eb 0f                	jmp    800984 <vprintfmt+0x328>
+          else
+            putch(ch, putdat);
+  800975:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800979:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  80097d:	48 89 c6             	mov    %rax,%rsi
+  800980:	89 df                	mov    %ebx,%edi
+  800982:	ff d2                	call   *%rdx
+        for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800984:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  800988:	4c 89 e0             	mov    %r12,%rax
+  80098b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80098f:	0f b6 00             	movzbl (%rax),%eax
+  800992:	0f be d8             	movsbl %al,%ebx
+  800995:	85 db                	test   %ebx,%ebx
+  800997:	74 28                	je     8009c1 <vprintfmt+0x365>
+  800999:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  80099d:	78 b2                	js     800951 <vprintfmt+0x2f5>
+  80099f:	83 6d d8 01          	subl   $0x1,-0x28(%rbp)
+  8009a3:	83 7d d8 00          	cmpl   $0x0,-0x28(%rbp)
+  8009a7:	79 a8                	jns    800951 <vprintfmt+0x2f5>
+        for (; width > 0; width--)
+  8009a9:	eb 16                	jmp    8009c1 <vprintfmt+0x365>
+          putch(' ', putdat);
+  8009ab:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009af:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009b3:	48 89 c6             	mov    %rax,%rsi
+  8009b6:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009bb:	ff d2                	call   *%rdx
+        for (; width > 0; width--)
+  8009bd:	83 6d dc 01          	subl   $0x1,-0x24(%rbp)
+  8009c1:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  8009c5:	7f e4                	jg     8009ab <vprintfmt+0x34f>
+        break;
+  8009c7:	e9 8d 01 00 00       	jmp    800b59 <vprintfmt+0x4fd>
+
+      // (signed) decimal
+      case 'd':
+        num = getint(&aq, lflag);
+  8009cc:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8009cf:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  8009d3:	89 d6                	mov    %edx,%esi
+  8009d5:	48 89 c7             	mov    %rax,%rdi
+  8009d8:	48 b8 65 05 80 00 00 	movabs $0x800565,%rax
+  8009df:	00 00 00 
+  8009e2:	ff d0                	call   *%rax
+  8009e4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        if ((long long)num < 0) {
+  8009e8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8009ec:	48 85 c0             	test   %rax,%rax
+  8009ef:	79 1d                	jns    800a0e <vprintfmt+0x3b2>
+          putch('-', putdat);
+  8009f1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009f5:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  8009f9:	48 89 c6             	mov    %rax,%rsi
+  8009fc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a01:	ff d2                	call   *%rdx
+          num = -(long long)num;
+  800a03:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a07:	48 f7 d8             	neg    %rax
+  800a0a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        }
+        base = 10;
+  800a0e:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a15:	e9 d2 00 00 00       	jmp    800aec <vprintfmt+0x490>
+
+      // unsigned decimal
+      case 'u':
+        num  = getuint(&aq, lflag);
+  800a1a:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a1d:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a21:	89 d6                	mov    %edx,%esi
+  800a23:	48 89 c7             	mov    %rax,%rdi
+  800a26:	48 b8 6e 04 80 00 00 	movabs $0x80046e,%rax
+  800a2d:	00 00 00 
+  800a30:	ff d0                	call   *%rax
+  800a32:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 10;
+  800a36:	c7 45 e4 0a 00 00 00 	movl   $0xa,-0x1c(%rbp)
+        goto number;
+  800a3d:	e9 aa 00 00 00       	jmp    800aec <vprintfmt+0x490>
+
+      // (unsigned) octal
+      case 'o':
+        num  = getuint(&aq, lflag);
+  800a42:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800a45:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800a49:	89 d6                	mov    %edx,%esi
+  800a4b:	48 89 c7             	mov    %rax,%rdi
+  800a4e:	48 b8 6e 04 80 00 00 	movabs $0x80046e,%rax
+  800a55:	00 00 00 
+  800a58:	ff d0                	call   *%rax
+  800a5a:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 8;
+  800a5e:	c7 45 e4 08 00 00 00 	movl   $0x8,-0x1c(%rbp)
+        goto number;
+  800a65:	e9 82 00 00 00       	jmp    800aec <vprintfmt+0x490>
+
+      // pointer
+      case 'p':
+        putch('0', putdat);
+  800a6a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a6e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a72:	48 89 c6             	mov    %rax,%rsi
+  800a75:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a7a:	ff d2                	call   *%rdx
+        putch('x', putdat);
+  800a7c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800a80:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800a84:	48 89 c6             	mov    %rax,%rsi
+  800a87:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a8c:	ff d2                	call   *%rdx
+        num  = (unsigned long long)(uintptr_t)va_arg(aq, void *);
+  800a8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a91:	83 f8 2f             	cmp    $0x2f,%eax
+  800a94:	77 17                	ja     800aad <vprintfmt+0x451>
+  800a96:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a9a:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800a9d:	89 d2                	mov    %edx,%edx
+  800a9f:	48 01 d0             	add    %rdx,%rax
+  800aa2:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  800aa5:	83 c2 08             	add    $0x8,%edx
+  800aa8:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  800aab:	eb 0c                	jmp    800ab9 <vprintfmt+0x45d>
+  800aad:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800ab1:	48 8d 50 08          	lea    0x8(%rax),%rdx
+  800ab5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800ab9:	48 8b 00             	mov    (%rax),%rax
+  800abc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800ac0:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+        goto number;
+  800ac7:	eb 23                	jmp    800aec <vprintfmt+0x490>
+
+      // (unsigned) hexadecimal
+      case 'x':
+      case 'X':
+        num  = getuint(&aq, lflag);
+  800ac9:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  800acc:	48 8d 45 b8          	lea    -0x48(%rbp),%rax
+  800ad0:	89 d6                	mov    %edx,%esi
+  800ad2:	48 89 c7             	mov    %rax,%rdi
+  800ad5:	48 b8 6e 04 80 00 00 	movabs $0x80046e,%rax
+  800adc:	00 00 00 
+  800adf:	ff d0                	call   *%rax
+  800ae1:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+        base = 16;
+  800ae5:	c7 45 e4 10 00 00 00 	movl   $0x10,-0x1c(%rbp)
+      number:
+        printnum(putch, putdat, num, base, width, padc);
+  800aec:	44 0f be 45 d3       	movsbl -0x2d(%rbp),%r8d
+  800af1:	8b 4d e4             	mov    -0x1c(%rbp),%ecx
+  800af4:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800af7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  800afb:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  800aff:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  800b03:	45 89 c1             	mov    %r8d,%r9d
+  800b06:	41 89 f8             	mov    %edi,%r8d
+  800b09:	48 89 c7             	mov    %rax,%rdi
+  800b0c:	48 b8 b6 03 80 00 00 	movabs $0x8003b6,%rax
+  800b13:	00 00 00 
+  800b16:	ff d0                	call   *%rax
+        break;
+  800b18:	eb 3f                	jmp    800b59 <vprintfmt+0x4fd>
+
+      // escaped '%' character
+      case '%':
+        putch(ch, putdat);
+  800b1a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b1e:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b22:	48 89 c6             	mov    %rax,%rsi
+  800b25:	89 df                	mov    %ebx,%edi
+  800b27:	ff d2                	call   *%rdx
+        break;
+  800b29:	eb 2e                	jmp    800b59 <vprintfmt+0x4fd>
+
+      // unrecognized escape sequence - just print it literally
+      default:
+        putch('%', putdat);
+  800b2b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b2f:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800b33:	48 89 c6             	mov    %rax,%rsi
+  800b36:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b3b:	ff d2                	call   *%rdx
+        for (fmt--; fmt[-1] != '%'; fmt--)
+  800b3d:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b42:	eb 05                	jmp    800b49 <vprintfmt+0x4ed>
+  800b44:	48 83 6d 98 01       	subq   $0x1,-0x68(%rbp)
+  800b49:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  800b4d:	48 83 e8 01          	sub    $0x1,%rax
+  800b51:	0f b6 00             	movzbl (%rax),%eax
+  800b54:	3c 25                	cmp    $0x25,%al
+  800b56:	75 ec                	jne    800b44 <vprintfmt+0x4e8>
+          /* do nothing */;
+        break;
+  800b58:	90                   	nop
+    while ((ch = *(unsigned char *)fmt++) != '%') {
+  800b59:	e9 50 fb ff ff       	jmp    8006ae <vprintfmt+0x52>
+        return;
+  800b5e:	90                   	nop
+    }
+  }
+}
+  800b5f:	48 83 c4 60          	add    $0x60,%rsp
+  800b63:	5b                   	pop    %rbx
+  800b64:	41 5c                	pop    %r12
+  800b66:	5d                   	pop    %rbp
+  800b67:	c3                   	ret
+
+0000000000800b68 <printfmt>:
+
+void
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800b68:	55                   	push   %rbp
+  800b69:	48 89 e5             	mov    %rsp,%rbp
+  800b6c:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800b73:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800b7a:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+  800b81:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800b88:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800b8f:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800b96:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800b9d:	84 c0                	test   %al,%al
+  800b9f:	74 20                	je     800bc1 <printfmt+0x59>
+  800ba1:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800ba5:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800ba9:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800bad:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800bb1:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800bb5:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800bb9:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800bbd:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  800bc1:	c7 85 38 ff ff ff 18 	movl   $0x18,-0xc8(%rbp)
+  800bc8:	00 00 00 
+  800bcb:	c7 85 3c ff ff ff 30 	movl   $0x30,-0xc4(%rbp)
+  800bd2:	00 00 00 
+  800bd5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bd9:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  800be0:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800be7:	48 89 85 48 ff ff ff 	mov    %rax,-0xb8(%rbp)
+  vprintfmt(putch, putdat, fmt, ap);
+  800bee:	48 8d 8d 38 ff ff ff 	lea    -0xc8(%rbp),%rcx
+  800bf5:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800bfc:	48 8b b5 20 ff ff ff 	mov    -0xe0(%rbp),%rsi
+  800c03:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800c0a:	48 89 c7             	mov    %rax,%rdi
+  800c0d:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  800c14:	00 00 00 
+  800c17:	ff d0                	call   *%rax
+  va_end(ap);
+}
+  800c19:	90                   	nop
+  800c1a:	c9                   	leave
+  800c1b:	c3                   	ret
+
+0000000000800c1c <sprintputch>:
+  char *ebuf;
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b) {
+  800c1c:	55                   	push   %rbp
+  800c1d:	48 89 e5             	mov    %rsp,%rbp
+  800c20:	48 83 ec 10          	sub    $0x10,%rsp
+  800c24:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800c27:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  b->cnt++;
+  800c2b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c2f:	8b 40 10             	mov    0x10(%rax),%eax
+  800c32:	8d 50 01             	lea    0x1(%rax),%edx
+  800c35:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c39:	89 50 10             	mov    %edx,0x10(%rax)
+  if (b->buf < b->ebuf)
+  800c3c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c40:	48 8b 10             	mov    (%rax),%rdx
+  800c43:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c47:	48 8b 40 08          	mov    0x8(%rax),%rax
+  800c4b:	48 39 c2             	cmp    %rax,%rdx
+  800c4e:	73 17                	jae    800c67 <sprintputch+0x4b>
+    *b->buf++ = ch;
+  800c50:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  800c54:	48 8b 00             	mov    (%rax),%rax
+  800c57:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  800c5b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  800c5f:	48 89 0a             	mov    %rcx,(%rdx)
+  800c62:	8b 55 fc             	mov    -0x4(%rbp),%edx
+  800c65:	88 10                	mov    %dl,(%rax)
+}
+  800c67:	90                   	nop
+  800c68:	c9                   	leave
+  800c69:	c3                   	ret
+
+0000000000800c6a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap) {
+  800c6a:	55                   	push   %rbp
+  800c6b:	48 89 e5             	mov    %rsp,%rbp
+  800c6e:	48 83 ec 40          	sub    $0x40,%rsp
+  800c72:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  800c76:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  800c79:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800c7d:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  struct sprintbuf b = {buf, buf + n - 1, 0};
+  800c81:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c85:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  800c89:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  800c8c:	48 98                	cltq
+  800c8e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  800c92:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800c96:	48 01 d0             	add    %rdx,%rax
+  800c99:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  800c9d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+
+  if (buf == NULL || n < 1)
+  800ca4:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800ca9:	74 06                	je     800cb1 <vsnprintf+0x47>
+  800cab:	83 7d d4 00          	cmpl   $0x0,-0x2c(%rbp)
+  800caf:	7f 07                	jg     800cb8 <vsnprintf+0x4e>
+    return -E_INVAL;
+  800cb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cb6:	eb 32                	jmp    800cea <vsnprintf+0x80>
+
+  // print the string to the buffer
+  vprintfmt((void *)sprintputch, &b, fmt, ap);
+  800cb8:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800cbc:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  800cc0:	48 8d 45 e0          	lea    -0x20(%rbp),%rax
+  800cc4:	48 89 c6             	mov    %rax,%rsi
+  800cc7:	48 b8 1c 0c 80 00 00 	movabs $0x800c1c,%rax
+  800cce:	00 00 00 
+  800cd1:	48 89 c7             	mov    %rax,%rdi
+  800cd4:	48 b8 5c 06 80 00 00 	movabs $0x80065c,%rax
+  800cdb:	00 00 00 
+  800cde:	ff d0                	call   *%rax
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800ce0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800ce4:	c6 00 00             	movb   $0x0,(%rax)
+
+  return b.cnt;
+  800ce7:	8b 45 f0             	mov    -0x10(%rbp),%eax
+}
+  800cea:	c9                   	leave
+  800ceb:	c3                   	ret
+
+0000000000800cec <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...) {
+  800cec:	55                   	push   %rbp
+  800ced:	48 89 e5             	mov    %rsp,%rbp
+  800cf0:	48 81 ec f0 00 00 00 	sub    $0xf0,%rsp
+  800cf7:	48 89 bd 28 ff ff ff 	mov    %rdi,-0xd8(%rbp)
+  800cfe:	89 b5 24 ff ff ff    	mov    %esi,-0xdc(%rbp)
+  800d04:	48 89 95 18 ff ff ff 	mov    %rdx,-0xe8(%rbp)
+  800d0b:	48 89 8d 68 ff ff ff 	mov    %rcx,-0x98(%rbp)
+  800d12:	4c 89 85 70 ff ff ff 	mov    %r8,-0x90(%rbp)
+  800d19:	4c 89 8d 78 ff ff ff 	mov    %r9,-0x88(%rbp)
+  800d20:	84 c0                	test   %al,%al
+  800d22:	74 20                	je     800d44 <snprintf+0x58>
+  800d24:	0f 29 45 80          	movaps %xmm0,-0x80(%rbp)
+  800d28:	0f 29 4d 90          	movaps %xmm1,-0x70(%rbp)
+  800d2c:	0f 29 55 a0          	movaps %xmm2,-0x60(%rbp)
+  800d30:	0f 29 5d b0          	movaps %xmm3,-0x50(%rbp)
+  800d34:	0f 29 65 c0          	movaps %xmm4,-0x40(%rbp)
+  800d38:	0f 29 6d d0          	movaps %xmm5,-0x30(%rbp)
+  800d3c:	0f 29 75 e0          	movaps %xmm6,-0x20(%rbp)
+  800d40:	0f 29 7d f0          	movaps %xmm7,-0x10(%rbp)
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800d44:	c7 85 30 ff ff ff 18 	movl   $0x18,-0xd0(%rbp)
+  800d4b:	00 00 00 
+  800d4e:	c7 85 34 ff ff ff 30 	movl   $0x30,-0xcc(%rbp)
+  800d55:	00 00 00 
+  800d58:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d5c:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  800d63:	48 8d 85 50 ff ff ff 	lea    -0xb0(%rbp),%rax
+  800d6a:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+  rc = vsnprintf(buf, n, fmt, ap);
+  800d71:	48 8d 8d 30 ff ff ff 	lea    -0xd0(%rbp),%rcx
+  800d78:	48 8b 95 18 ff ff ff 	mov    -0xe8(%rbp),%rdx
+  800d7f:	8b b5 24 ff ff ff    	mov    -0xdc(%rbp),%esi
+  800d85:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800d8c:	48 89 c7             	mov    %rax,%rdi
+  800d8f:	48 b8 6a 0c 80 00 00 	movabs $0x800c6a,%rax
+  800d96:	00 00 00 
+  800d99:	ff d0                	call   *%rax
+  800d9b:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%rbp)
+  va_end(ap);
+
+  return rc;
+  800da1:	8b 85 4c ff ff ff    	mov    -0xb4(%rbp),%eax
+}
+  800da7:	c9                   	leave
+  800da8:	c3                   	ret
+
+0000000000800da9 <cpuid>:
+    v = *(const v16qi *)p;
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  }
+  p += __builtin_ctz(m);
+  return *p ? (char *)p : 0;
+#else
+  800da9:	55                   	push   %rbp
+  800daa:	48 89 e5             	mov    %rsp,%rbp
+  800dad:	53                   	push   %rbx
+  800dae:	48 83 ec 38          	sub    $0x38,%rsp
+  800db2:	89 7d e4             	mov    %edi,-0x1c(%rbp)
+  800db5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800db9:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  800dbd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800dc1:	4c 89 45 c0          	mov    %r8,-0x40(%rbp)
+  for (; *s; s++)
+    if (*s == c)
+  800dc5:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800dc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcd:	89 d1                	mov    %edx,%ecx
+  800dcf:	0f a2                	cpuid
+  800dd1:	89 de                	mov    %ebx,%esi
+  800dd3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+  800dd6:	89 75 f0             	mov    %esi,-0x10(%rbp)
+  800dd9:	89 4d ec             	mov    %ecx,-0x14(%rbp)
+  800ddc:	89 55 e8             	mov    %edx,-0x18(%rbp)
+      return (char *)s;
+  return 0;
+#endif
+  800ddf:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  800de4:	74 09                	je     800def <cpuid+0x46>
+}
+  800de6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  800dea:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  800ded:	89 10                	mov    %edx,(%rax)
+
+  800def:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  800df4:	74 09                	je     800dff <cpuid+0x56>
+// Return a pointer to the first occurrence of 'c' in 's',
+  800df6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800dfa:	8b 55 f0             	mov    -0x10(%rbp),%edx
+  800dfd:	89 10                	mov    %edx,(%rax)
+// or a pointer to the string-ending null character if the string has no 'c'.
+  800dff:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e04:	74 09                	je     800e0f <cpuid+0x66>
+char *
+  800e06:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800e0a:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  800e0d:	89 10                	mov    %edx,(%rax)
+strfind(const char *s, char c) {
+  800e0f:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  800e14:	74 09                	je     800e1f <cpuid+0x76>
+  for (; *s; s++)
+  800e16:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  800e1a:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  800e1d:	89 10                	mov    %edx,(%rax)
+    if (*s == c)
+  800e1f:	90                   	nop
+  800e20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e24:	c9                   	leave
+  800e25:	c3                   	ret
+
+0000000000800e26 <xgetbv>:
+                   : "+D"(d), "+S"(s), "+c"(nq)
+                   :
+                   : "cc", "memory");
+      n %= 8;
+    }
+    while (n-- > 0)
+  800e26:	55                   	push   %rbp
+  800e27:	48 89 e5             	mov    %rsp,%rbp
+  800e2a:	48 83 ec 18          	sub    $0x18,%rsp
+  800e2e:	89 7d ec             	mov    %edi,-0x14(%rbp)
+      *d++ = *s++;
+  }
+  800e31:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  800e34:	89 c1                	mov    %eax,%ecx
+  800e36:	0f 01 d0             	xgetbv
+  800e39:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  800e3c:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  return dst;
+}
+
+  800e3f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800e42:	8b 55 f8             	mov    -0x8(%rbp),%edx
+  800e45:	48 c1 e2 20          	shl    $0x20,%rdx
+  800e49:	48 09 d0             	or     %rdx,%rax
+#else
+  800e4c:	c9                   	leave
+  800e4d:	c3                   	ret
+
+0000000000800e4e <string_cpu>:
+string_cpu(void) {
+  800e4e:	55                   	push   %rbp
+  800e4f:	48 89 e5             	mov    %rsp,%rbp
+  800e52:	48 83 ec 10          	sub    $0x10,%rsp
+  uint32_t maxleaf, ebx7 = 0, ecx1;
+  800e56:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  int f = 0;
+  800e5d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  if (string_features >= 0)
+  800e64:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e6b:	00 00 00 
+  800e6e:	8b 00                	mov    (%rax),%eax
+  800e70:	85 c0                	test   %eax,%eax
+  800e72:	78 11                	js     800e85 <string_cpu+0x37>
+    return string_features;
+  800e74:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800e7b:	00 00 00 
+  800e7e:	8b 00                	mov    (%rax),%eax
+  800e80:	e9 df 00 00 00       	jmp    800f64 <string_cpu+0x116>
+  cpuid(0, &maxleaf, NULL, NULL, NULL);
+  800e85:	48 8d 45 f8          	lea    -0x8(%rbp),%rax
+  800e89:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800e8f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e99:	48 89 c6             	mov    %rax,%rsi
+  800e9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ea1:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  800ea8:	00 00 00 
+  800eab:	ff d0                	call   *%rax
+  if (maxleaf >= 7)
+  800ead:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  800eb0:	83 f8 06             	cmp    $0x6,%eax
+  800eb3:	76 28                	jbe    800edd <string_cpu+0x8f>
+    cpuid(7, NULL, &ebx7, NULL, NULL);
+  800eb5:	48 8d 45 f4          	lea    -0xc(%rbp),%rax
+  800eb9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ebf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ec4:	48 89 c2             	mov    %rax,%rdx
+  800ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ecc:	bf 07 00 00 00       	mov    $0x7,%edi
+  800ed1:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  800ed8:	00 00 00 
+  800edb:	ff d0                	call   *%rax
+  if (ebx7 & CPUID7_EBX_ERMS)
+  800edd:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800ee0:	25 00 02 00 00       	and    $0x200,%eax
+  800ee5:	85 c0                	test   %eax,%eax
+  800ee7:	74 04                	je     800eed <string_cpu+0x9f>
+    f |= STRING_ERMS;
+  800ee9:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  cpuid(1, NULL, NULL, &ecx1, NULL);
+  800eed:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  800ef1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ef7:	48 89 c1             	mov    %rax,%rcx
+  800efa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eff:	be 00 00 00 00       	mov    $0x0,%esi
+  800f04:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f09:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  800f10:	00 00 00 
+  800f13:	ff d0                	call   *%rax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f15:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  800f18:	83 e0 20             	and    $0x20,%eax
+  800f1b:	85 c0                	test   %eax,%eax
+  800f1d:	74 2a                	je     800f49 <string_cpu+0xfb>
+  800f1f:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  800f22:	25 00 00 00 08       	and    $0x8000000,%eax
+  800f27:	85 c0                	test   %eax,%eax
+  800f29:	74 1e                	je     800f49 <string_cpu+0xfb>
+      (xgetbv(0) & 0x6) == 0x6)
+  800f2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f30:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  800f37:	00 00 00 
+  800f3a:	ff d0                	call   *%rax
+  800f3c:	83 e0 06             	and    $0x6,%eax
+  if ((ebx7 & CPUID7_EBX_AVX2) && (ecx1 & CPUID1_ECX_OSXSAVE) &&
+  800f3f:	48 83 f8 06          	cmp    $0x6,%rax
+  800f43:	75 04                	jne    800f49 <string_cpu+0xfb>
+    f |= STRING_AVX2;
+  800f45:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  return string_features = f;
+  800f49:	48 ba 08 60 80 00 00 	movabs $0x806008,%rdx
+  800f50:	00 00 00 
+  800f53:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  800f56:	89 02                	mov    %eax,(%rdx)
+  800f58:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800f5f:	00 00 00 
+  800f62:	8b 00                	mov    (%rax),%eax
+}
+  800f64:	c9                   	leave
+  800f65:	c3                   	ret
+
+0000000000800f66 <strlen_avx2>:
+strlen_avx2(const char *s) {
+  800f66:	55                   	push   %rbp
+  800f67:	48 89 e5             	mov    %rsp,%rbp
+  800f6a:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  800f6e:	48 83 ec 60          	sub    $0x60,%rsp
+  800f72:	48 89 7c 24 18       	mov    %rdi,0x18(%rsp)
+  unsigned off = (uintptr_t)s % 32, m;
+  800f77:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f7c:	83 e0 1f             	and    $0x1f,%eax
+  800f7f:	89 44 24 4c          	mov    %eax,0x4c(%rsp)
+  const char *p = s - off;
+  800f83:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800f87:	48 f7 d8             	neg    %rax
+  800f8a:	48 89 c2             	mov    %rax,%rdx
+  800f8d:	48 8b 44 24 18       	mov    0x18(%rsp),%rax
+  800f92:	48 01 d0             	add    %rdx,%rax
+  800f95:	48 89 44 24 50       	mov    %rax,0x50(%rsp)
+  v32qi zero = {0};
+  800f9a:	c5 f9 ef c0          	vpxor  %xmm0,%xmm0,%xmm0
+  800f9e:	c5 fd 7f 44 24 20    	vmovdqa %ymm0,0x20(%rsp)
+  m = EQMASK32(*(const v32qi *)p, zero) & (~0U << off);
+  800fa4:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800fa9:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800fad:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800fb3:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fb7:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800fbb:	89 c2                	mov    %eax,%edx
+  800fbd:	8b 44 24 4c          	mov    0x4c(%rsp),%eax
+  800fc1:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  800fc6:	89 c1                	mov    %eax,%ecx
+  800fc8:	d3 e6                	shl    %cl,%esi
+  800fca:	89 f0                	mov    %esi,%eax
+  800fcc:	21 d0                	and    %edx,%eax
+  800fce:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800fd2:	eb 21                	jmp    800ff5 <strlen_avx2+0x8f>
+    p += 32;
+  800fd4:	48 83 44 24 50 20    	addq   $0x20,0x50(%rsp)
+    m = EQMASK32(*(const v32qi *)p, zero);
+  800fda:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  800fdf:	c5 fd 6f 00          	vmovdqa (%rax),%ymm0
+  800fe3:	c5 fd 6f 4c 24 20    	vmovdqa 0x20(%rsp),%ymm1
+  800fe9:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  800fed:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  800ff1:	89 44 24 5c          	mov    %eax,0x5c(%rsp)
+  while (!m) {
+  800ff5:	83 7c 24 5c 00       	cmpl   $0x0,0x5c(%rsp)
+  800ffa:	74 d8                	je     800fd4 <strlen_avx2+0x6e>
+  return p + __builtin_ctz(m) - s;
+  800ffc:	31 c0                	xor    %eax,%eax
+  800ffe:	f3 0f bc 44 24 5c    	tzcnt  0x5c(%rsp),%eax
+  801004:	48 63 d0             	movslq %eax,%rdx
+  801007:	48 8b 44 24 50       	mov    0x50(%rsp),%rax
+  80100c:	48 01 d0             	add    %rdx,%rax
+  80100f:	48 2b 44 24 18       	sub    0x18(%rsp),%rax
+}
+  801014:	c9                   	leave
+  801015:	c3                   	ret
+
+0000000000801016 <memcmp_avx2>:
+memcmp_avx2(const uint8_t *s1, const uint8_t *s2, size_t n) {
+  801016:	55                   	push   %rbp
+  801017:	48 89 e5             	mov    %rsp,%rbp
+  80101a:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80101e:	48 83 ec 40          	sub    $0x40,%rsp
+  801022:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801027:	48 89 74 24 20       	mov    %rsi,0x20(%rsp)
+  80102c:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801031:	eb 77                	jmp    8010aa <memcmp_avx2+0x94>
+    m = EQMASK32(*(const v32qi_u *)s1, *(const v32qi_u *)s2);
+  801033:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801038:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  80103c:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801040:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  801045:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801049:	c5 f5 74 c0          	vpcmpeqb %ymm0,%ymm1,%ymm0
+  80104d:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801051:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+    if (m != ~0U) {
+  801055:	83 7c 24 3c ff       	cmpl   $0xffffffff,0x3c(%rsp)
+  80105a:	74 3c                	je     801098 <memcmp_avx2+0x82>
+      i = __builtin_ctz(~m);
+  80105c:	8b 44 24 3c          	mov    0x3c(%rsp),%eax
+  801060:	f7 d0                	not    %eax
+  801062:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801066:	89 44 24 38          	mov    %eax,0x38(%rsp)
+      return (int)s1[i] - (int)s2[i];
+  80106a:	8b 44 24 38          	mov    0x38(%rsp),%eax
+  80106e:	48 63 d0             	movslq %eax,%rdx
+  801071:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  801076:	48 01 d0             	add    %rdx,%rax
+  801079:	0f b6 00             	movzbl (%rax),%eax
+  80107c:	0f b6 c0             	movzbl %al,%eax
+  80107f:	8b 54 24 38          	mov    0x38(%rsp),%edx
+  801083:	48 63 ca             	movslq %edx,%rcx
+  801086:	48 8b 54 24 20       	mov    0x20(%rsp),%rdx
+  80108b:	48 01 ca             	add    %rcx,%rdx
+  80108e:	0f b6 12             	movzbl (%rdx),%edx
+  801091:	0f b6 d2             	movzbl %dl,%edx
+  801094:	29 d0                	sub    %edx,%eax
+  801096:	eb 6b                	jmp    801103 <memcmp_avx2+0xed>
+  for (; n >= 32; s1 += 32, s2 += 32, n -= 32) {
+  801098:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  80109e:	48 83 44 24 20 20    	addq   $0x20,0x20(%rsp)
+  8010a4:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  8010aa:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  8010b0:	77 81                	ja     801033 <memcmp_avx2+0x1d>
+  for (; n > 0; s1++, s2++, n--) {
+  8010b2:	eb 42                	jmp    8010f6 <memcmp_avx2+0xe0>
+    if (*s1 != *s2)
+  8010b4:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010b9:	0f b6 10             	movzbl (%rax),%edx
+  8010bc:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010c1:	0f b6 00             	movzbl (%rax),%eax
+  8010c4:	38 c2                	cmp    %al,%dl
+  8010c6:	74 1c                	je     8010e4 <memcmp_avx2+0xce>
+      return (int)*s1 - (int)*s2;
+  8010c8:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8010cd:	0f b6 00             	movzbl (%rax),%eax
+  8010d0:	0f b6 c8             	movzbl %al,%ecx
+  8010d3:	48 8b 44 24 20       	mov    0x20(%rsp),%rax
+  8010d8:	0f b6 00             	movzbl (%rax),%eax
+  8010db:	0f b6 d0             	movzbl %al,%edx
+  8010de:	89 c8                	mov    %ecx,%eax
+  8010e0:	29 d0                	sub    %edx,%eax
+  8010e2:	eb 1f                	jmp    801103 <memcmp_avx2+0xed>
+  for (; n > 0; s1++, s2++, n--) {
+  8010e4:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  8010ea:	48 83 44 24 20 01    	addq   $0x1,0x20(%rsp)
+  8010f0:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  8010f6:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  8010fc:	75 b6                	jne    8010b4 <memcmp_avx2+0x9e>
+  return 0;
+  8010fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801103:	c9                   	leave
+  801104:	c3                   	ret
+
+0000000000801105 <memfind_avx2>:
+memfind_avx2(const uint8_t *s, uint8_t c, size_t n) {
+  801105:	55                   	push   %rbp
+  801106:	48 89 e5             	mov    %rsp,%rbp
+  801109:	48 83 e4 e0          	and    $0xffffffffffffffe0,%rsp
+  80110d:	48 83 ec 60          	sub    $0x60,%rsp
+  801111:	48 89 7c 24 28       	mov    %rdi,0x28(%rsp)
+  801116:	89 f0                	mov    %esi,%eax
+  801118:	48 89 54 24 18       	mov    %rdx,0x18(%rsp)
+  80111d:	88 44 24 24          	mov    %al,0x24(%rsp)
+  v32qi vc = (v32qi){0} + (char)c;
+  801121:	0f b6 44 24 24       	movzbl 0x24(%rsp),%eax
+  801126:	c5 f9 6e c0          	vmovd  %eax,%xmm0
+  80112a:	c4 e2 7d 78 c0       	vpbroadcastb %xmm0,%ymm0
+  80112f:	c5 fd 7f 44 24 40    	vmovdqa %ymm0,0x40(%rsp)
+  for (; n >= 32; s += 32, n -= 32) {
+  801135:	eb 47                	jmp    80117e <memfind_avx2+0x79>
+    if ((m = EQMASK32(*(const v32qi_u *)s, vc)))
+  801137:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80113c:	c5 fe 6f 00          	vmovdqu (%rax),%ymm0
+  801140:	c5 fd 6f c8          	vmovdqa %ymm0,%ymm1
+  801144:	c5 fd 6f 44 24 40    	vmovdqa 0x40(%rsp),%ymm0
+  80114a:	c5 fd 74 c1          	vpcmpeqb %ymm1,%ymm0,%ymm0
+  80114e:	c5 fd d7 c0          	vpmovmskb %ymm0,%eax
+  801152:	89 44 24 3c          	mov    %eax,0x3c(%rsp)
+  801156:	83 7c 24 3c 00       	cmpl   $0x0,0x3c(%rsp)
+  80115b:	74 15                	je     801172 <memfind_avx2+0x6d>
+      return s + __builtin_ctz(m);
+  80115d:	31 c0                	xor    %eax,%eax
+  80115f:	f3 0f bc 44 24 3c    	tzcnt  0x3c(%rsp),%eax
+  801165:	48 63 d0             	movslq %eax,%rdx
+  801168:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  80116d:	48 01 d0             	add    %rdx,%rax
+  801170:	eb 3d                	jmp    8011af <memfind_avx2+0xaa>
+  for (; n >= 32; s += 32, n -= 32) {
+  801172:	48 83 44 24 28 20    	addq   $0x20,0x28(%rsp)
+  801178:	48 83 6c 24 18 20    	subq   $0x20,0x18(%rsp)
+  80117e:	48 83 7c 24 18 1f    	cmpq   $0x1f,0x18(%rsp)
+  801184:	77 b1                	ja     801137 <memfind_avx2+0x32>
+  for (; n > 0 && *s != c; s++, n--)
+  801186:	eb 0c                	jmp    801194 <memfind_avx2+0x8f>
+  801188:	48 83 44 24 28 01    	addq   $0x1,0x28(%rsp)
+  80118e:	48 83 6c 24 18 01    	subq   $0x1,0x18(%rsp)
+  801194:	48 83 7c 24 18 00    	cmpq   $0x0,0x18(%rsp)
+  80119a:	74 0e                	je     8011aa <memfind_avx2+0xa5>
+  80119c:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+  8011a1:	0f b6 00             	movzbl (%rax),%eax
+  8011a4:	38 44 24 24          	cmp    %al,0x24(%rsp)
+  8011a8:	75 de                	jne    801188 <memfind_avx2+0x83>
+  return s;
+  8011aa:	48 8b 44 24 28       	mov    0x28(%rsp),%rax
+}
+  8011af:	c9                   	leave
+  8011b0:	c3                   	ret
+
+00000000008011b1 <strlen>:
+strlen(const char *s) {
+  8011b1:	55                   	push   %rbp
+  8011b2:	48 89 e5             	mov    %rsp,%rbp
+  8011b5:	48 83 ec 40          	sub    $0x40,%rsp
+  8011b9:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  v16qi zero = {0};
+  8011bd:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8011c1:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  if (string_cpu() & STRING_AVX2)
+  8011c5:	48 b8 4e 0e 80 00 00 	movabs $0x800e4e,%rax
+  8011cc:	00 00 00 
+  8011cf:	ff d0                	call   *%rax
+  8011d1:	83 e0 02             	and    $0x2,%eax
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	74 18                	je     8011f0 <strlen+0x3f>
+    return strlen_avx2(s);
+  8011d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011dc:	48 89 c7             	mov    %rax,%rdi
+  8011df:	48 b8 66 0f 80 00 00 	movabs $0x800f66,%rax
+  8011e6:	00 00 00 
+  8011e9:	ff d0                	call   *%rax
+  8011eb:	e9 82 00 00 00       	jmp    801272 <strlen+0xc1>
+  off = (uintptr_t)s % 16;
+  8011f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8011f4:	83 e0 0f             	and    $0xf,%eax
+  8011f7:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  p   = s - off;
+  8011fa:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8011fd:	48 f7 d8             	neg    %rax
+  801200:	48 89 c2             	mov    %rax,%rdx
+  801203:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801207:	48 01 d0             	add    %rdx,%rax
+  80120a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  m   = EQMASK16(*(const v16qi *)p, zero) & (~0U << off);
+  80120e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801212:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801216:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80121b:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  80121f:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801223:	89 c2                	mov    %eax,%edx
+  801225:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  801228:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80122d:	89 c1                	mov    %eax,%ecx
+  80122f:	d3 e6                	shl    %cl,%esi
+  801231:	89 f0                	mov    %esi,%eax
+  801233:	21 d0                	and    %edx,%eax
+  801235:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801238:	eb 1d                	jmp    801257 <strlen+0xa6>
+    p += 16;
+  80123a:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    m = EQMASK16(*(const v16qi *)p, zero);
+  80123f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801243:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801247:	66 0f 6f 4d e0       	movdqa -0x20(%rbp),%xmm1
+  80124c:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801250:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801254:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801257:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80125b:	74 dd                	je     80123a <strlen+0x89>
+  return p + __builtin_ctz(m) - s;
+  80125d:	31 c0                	xor    %eax,%eax
+  80125f:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801264:	48 63 d0             	movslq %eax,%rdx
+  801267:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80126b:	48 01 d0             	add    %rdx,%rax
+  80126e:	48 2b 45 c8          	sub    -0x38(%rbp),%rax
+}
+  801272:	c9                   	leave
+  801273:	c3                   	ret
+
+0000000000801274 <strnlen>:
+strnlen(const char *s, size_t size) {
+  801274:	55                   	push   %rbp
+  801275:	48 89 e5             	mov    %rsp,%rbp
+  801278:	48 83 ec 20          	sub    $0x20,%rsp
+  80127c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801280:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801284:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  80128b:	eb 0e                	jmp    80129b <strnlen+0x27>
+    n++;
+  80128d:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  801291:	48 83 45 e8 01       	addq   $0x1,-0x18(%rbp)
+  801296:	48 83 6d e0 01       	subq   $0x1,-0x20(%rbp)
+  80129b:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  8012a0:	74 0b                	je     8012ad <strnlen+0x39>
+  8012a2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012a6:	0f b6 00             	movzbl (%rax),%eax
+  8012a9:	84 c0                	test   %al,%al
+  8012ab:	75 e0                	jne    80128d <strnlen+0x19>
+  return n;
+  8012ad:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8012b0:	c9                   	leave
+  8012b1:	c3                   	ret
+
+00000000008012b2 <strcpy>:
+strcpy(char *dst, const char *src) {
+  8012b2:	55                   	push   %rbp
+  8012b3:	48 89 e5             	mov    %rsp,%rbp
+  8012b6:	48 83 ec 20          	sub    $0x20,%rsp
+  8012ba:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8012be:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  ret = dst;
+  8012c2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012c6:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  while ((*dst++ = *src++) != '\0')
+  8012ca:	90                   	nop
+  8012cb:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8012cf:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8012d3:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8012d7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8012db:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8012df:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8012e3:	0f b6 12             	movzbl (%rdx),%edx
+  8012e6:	88 10                	mov    %dl,(%rax)
+  8012e8:	0f b6 00             	movzbl (%rax),%eax
+  8012eb:	84 c0                	test   %al,%al
+  8012ed:	75 dc                	jne    8012cb <strcpy+0x19>
+  return ret;
+  8012ef:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8012f3:	c9                   	leave
+  8012f4:	c3                   	ret
+
+00000000008012f5 <strcat>:
+strcat(char *dst, const char *src) {
+  8012f5:	55                   	push   %rbp
+  8012f6:	48 89 e5             	mov    %rsp,%rbp
+  8012f9:	48 83 ec 20          	sub    $0x20,%rsp
+  8012fd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801301:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int len = strlen(dst);
+  801305:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801309:	48 89 c7             	mov    %rax,%rdi
+  80130c:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  801313:	00 00 00 
+  801316:	ff d0                	call   *%rax
+  801318:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  strcpy(dst + len, src);
+  80131b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80131e:	48 63 d0             	movslq %eax,%rdx
+  801321:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801325:	48 01 c2             	add    %rax,%rdx
+  801328:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80132c:	48 89 c6             	mov    %rax,%rsi
+  80132f:	48 89 d7             	mov    %rdx,%rdi
+  801332:	48 b8 b2 12 80 00 00 	movabs $0x8012b2,%rax
+  801339:	00 00 00 
+  80133c:	ff d0                	call   *%rax
+  return dst;
+  80133e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801342:	c9                   	leave
+  801343:	c3                   	ret
+
+0000000000801344 <strncpy>:
+strncpy(char *dst, const char *src, size_t size) {
+  801344:	55                   	push   %rbp
+  801345:	48 89 e5             	mov    %rsp,%rbp
+  801348:	48 83 ec 28          	sub    $0x28,%rsp
+  80134c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801350:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  801354:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  ret = dst;
+  801358:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80135c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  for (i = 0; i < size; i++) {
+  801360:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  801367:	00 
+  801368:	eb 2a                	jmp    801394 <strncpy+0x50>
+    *dst++ = *src;
+  80136a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80136e:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801372:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  801376:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80137a:	0f b6 12             	movzbl (%rdx),%edx
+  80137d:	88 10                	mov    %dl,(%rax)
+    if (*src != '\0')
+  80137f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801383:	0f b6 00             	movzbl (%rax),%eax
+  801386:	84 c0                	test   %al,%al
+  801388:	74 05                	je     80138f <strncpy+0x4b>
+      src++;
+  80138a:	48 83 45 e0 01       	addq   $0x1,-0x20(%rbp)
+  for (i = 0; i < size; i++) {
+  80138f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801394:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801398:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  80139c:	72 cc                	jb     80136a <strncpy+0x26>
+  return ret;
+  80139e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  8013a2:	c9                   	leave
+  8013a3:	c3                   	ret
+
+00000000008013a4 <strlcpy>:
+strlcpy(char *dst, const char *src, size_t size) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+  8013a8:	48 83 ec 28          	sub    $0x28,%rsp
+  8013ac:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8013b0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8013b4:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  dst_in = dst;
+  8013b8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013bc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (size > 0) {
+  8013c0:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013c5:	74 3d                	je     801404 <strlcpy+0x60>
+    while (--size > 0 && *src != '\0')
+  8013c7:	eb 1d                	jmp    8013e6 <strlcpy+0x42>
+      *dst++ = *src++;
+  8013c9:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8013cd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8013d1:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  8013d5:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8013d9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8013dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8013e1:	0f b6 12             	movzbl (%rdx),%edx
+  8013e4:	88 10                	mov    %dl,(%rax)
+    while (--size > 0 && *src != '\0')
+  8013e6:	48 83 6d d8 01       	subq   $0x1,-0x28(%rbp)
+  8013eb:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  8013f0:	74 0b                	je     8013fd <strlcpy+0x59>
+  8013f2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8013f6:	0f b6 00             	movzbl (%rax),%eax
+  8013f9:	84 c0                	test   %al,%al
+  8013fb:	75 cc                	jne    8013c9 <strlcpy+0x25>
+    *dst = '\0';
+  8013fd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801401:	c6 00 00             	movb   $0x0,(%rax)
+  return dst - dst_in;
+  801404:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801408:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+}
+  80140c:	c9                   	leave
+  80140d:	c3                   	ret
+
+000000000080140e <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80140e:	55                   	push   %rbp
+  80140f:	48 89 e5             	mov    %rsp,%rbp
+  801412:	48 83 ec 30          	sub    $0x30,%rsp
+  801416:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80141a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80141e:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  const size_t srclen = strlen(src);
+  801422:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801426:	48 89 c7             	mov    %rax,%rdi
+  801429:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  801430:	00 00 00 
+  801433:	ff d0                	call   *%rax
+  801435:	48 98                	cltq
+  801437:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const size_t dstlen = strnlen(dst, maxlen);
+  80143b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80143f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801443:	48 89 d6             	mov    %rdx,%rsi
+  801446:	48 89 c7             	mov    %rax,%rdi
+  801449:	48 b8 74 12 80 00 00 	movabs $0x801274,%rax
+  801450:	00 00 00 
+  801453:	ff d0                	call   *%rax
+  801455:	48 98                	cltq
+  801457:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (dstlen == maxlen)
+  80145b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80145f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  801463:	75 10                	jne    801475 <strlcat+0x67>
+    return maxlen + srclen;
+  801465:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801469:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80146d:	48 01 d0             	add    %rdx,%rax
+  801470:	e9 86 00 00 00       	jmp    8014fb <strlcat+0xed>
+  if (srclen < maxlen - dstlen) {
+  801475:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801479:	48 2b 45 f0          	sub    -0x10(%rbp),%rax
+  80147d:	48 39 45 f8          	cmp    %rax,-0x8(%rbp)
+  801481:	73 2b                	jae    8014ae <strlcat+0xa0>
+    memcpy(dst + dstlen, src, srclen + 1);
+  801483:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801487:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80148b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80148f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801493:	48 01 c1             	add    %rax,%rcx
+  801496:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80149a:	48 89 c6             	mov    %rax,%rsi
+  80149d:	48 89 cf             	mov    %rcx,%rdi
+  8014a0:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  8014a7:	00 00 00 
+  8014aa:	ff d0                	call   *%rax
+  8014ac:	eb 42                	jmp    8014f0 <strlcat+0xe2>
+    memcpy(dst + dstlen, src, maxlen - 1);
+  8014ae:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014b2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8014b6:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  8014ba:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8014be:	48 01 c1             	add    %rax,%rcx
+  8014c1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8014c5:	48 89 c6             	mov    %rax,%rsi
+  8014c8:	48 89 cf             	mov    %rcx,%rdi
+  8014cb:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  8014d2:	00 00 00 
+  8014d5:	ff d0                	call   *%rax
+    dst[dstlen + maxlen - 1] = '\0';
+  8014d7:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014db:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8014df:	48 01 d0             	add    %rdx,%rax
+  8014e2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8014e6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8014ea:	48 01 d0             	add    %rdx,%rax
+  8014ed:	c6 00 00             	movb   $0x0,(%rax)
+  return dstlen + srclen;
+  8014f0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8014f4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8014f8:	48 01 d0             	add    %rdx,%rax
+}
+  8014fb:	c9                   	leave
+  8014fc:	c3                   	ret
+
+00000000008014fd <strcmp>:
+strcmp(const char *p, const char *q) {
+  8014fd:	55                   	push   %rbp
+  8014fe:	48 89 e5             	mov    %rsp,%rbp
+  801501:	48 83 ec 10          	sub    $0x10,%rsp
+  801505:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801509:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  while (*p && *p == *q)
+  80150d:	eb 0a                	jmp    801519 <strcmp+0x1c>
+    p++, q++;
+  80150f:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801514:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (*p && *p == *q)
+  801519:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80151d:	0f b6 00             	movzbl (%rax),%eax
+  801520:	84 c0                	test   %al,%al
+  801522:	74 12                	je     801536 <strcmp+0x39>
+  801524:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801528:	0f b6 10             	movzbl (%rax),%edx
+  80152b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80152f:	0f b6 00             	movzbl (%rax),%eax
+  801532:	38 c2                	cmp    %al,%dl
+  801534:	74 d9                	je     80150f <strcmp+0x12>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  801536:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80153a:	0f b6 00             	movzbl (%rax),%eax
+  80153d:	0f b6 d0             	movzbl %al,%edx
+  801540:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801544:	0f b6 00             	movzbl (%rax),%eax
+  801547:	0f b6 c0             	movzbl %al,%eax
+  80154a:	29 c2                	sub    %eax,%edx
+  80154c:	89 d0                	mov    %edx,%eax
+}
+  80154e:	c9                   	leave
+  80154f:	c3                   	ret
+
+0000000000801550 <strncmp>:
+strncmp(const char *p, const char *q, size_t n) {
+  801550:	55                   	push   %rbp
+  801551:	48 89 e5             	mov    %rsp,%rbp
+  801554:	48 83 ec 18          	sub    $0x18,%rsp
+  801558:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80155c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801560:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801564:	eb 0f                	jmp    801575 <strncmp+0x25>
+    n--, p++, q++;
+  801566:	48 83 6d e8 01       	subq   $0x1,-0x18(%rbp)
+  80156b:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801570:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n > 0 && *p && *p == *q)
+  801575:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80157a:	74 1d                	je     801599 <strncmp+0x49>
+  80157c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801580:	0f b6 00             	movzbl (%rax),%eax
+  801583:	84 c0                	test   %al,%al
+  801585:	74 12                	je     801599 <strncmp+0x49>
+  801587:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80158b:	0f b6 10             	movzbl (%rax),%edx
+  80158e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801592:	0f b6 00             	movzbl (%rax),%eax
+  801595:	38 c2                	cmp    %al,%dl
+  801597:	74 cd                	je     801566 <strncmp+0x16>
+  if (n == 0)
+  801599:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  80159e:	75 07                	jne    8015a7 <strncmp+0x57>
+    return 0;
+  8015a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a5:	eb 16                	jmp    8015bd <strncmp+0x6d>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8015a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8015ab:	0f b6 00             	movzbl (%rax),%eax
+  8015ae:	0f b6 d0             	movzbl %al,%edx
+  8015b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8015b5:	0f b6 00             	movzbl (%rax),%eax
+  8015b8:	0f b6 c0             	movzbl %al,%eax
+  8015bb:	29 c2                	sub    %eax,%edx
+}
+  8015bd:	89 d0                	mov    %edx,%eax
+  8015bf:	c9                   	leave
+  8015c0:	c3                   	ret
+
+00000000008015c1 <strchr>:
+strchr(const char *s, char c) {
+  8015c1:	55                   	push   %rbp
+  8015c2:	48 89 e5             	mov    %rsp,%rbp
+  8015c5:	48 83 ec 60          	sub    $0x60,%rsp
+  8015c9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8015cd:	89 f0                	mov    %esi,%eax
+  8015cf:	88 45 a4             	mov    %al,-0x5c(%rbp)
+  unsigned off = (uintptr_t)s % 16, m;
+  8015d2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015d6:	83 e0 0f             	and    $0xf,%eax
+  8015d9:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  const char *p = s - off;
+  8015dc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8015df:	48 f7 d8             	neg    %rax
+  8015e2:	48 89 c2             	mov    %rax,%rdx
+  8015e5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8015e9:	48 01 d0             	add    %rdx,%rax
+  8015ec:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  v16qi zero = {0}, vc = (v16qi){0} + c, v;
+  8015f0:	66 0f ef c0          	pxor   %xmm0,%xmm0
+  8015f4:	0f 29 45 d0          	movaps %xmm0,-0x30(%rbp)
+  8015f8:	0f b6 45 a4          	movzbl -0x5c(%rbp),%eax
+  8015fc:	66 0f 6e c0          	movd   %eax,%xmm0
+  801600:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801604:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801608:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  80160d:	0f 29 45 c0          	movaps %xmm0,-0x40(%rbp)
+  v = *(const v16qi *)p;
+  801611:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801615:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  801619:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+  m = (EQMASK16(v, zero) | EQMASK16(v, vc)) & (~0U << off);
+  80161d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801622:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  801627:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80162b:	89 c2                	mov    %eax,%edx
+  80162d:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801632:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  801637:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  80163b:	09 c2                	or     %eax,%edx
+  80163d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801640:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  801645:	89 c1                	mov    %eax,%ecx
+  801647:	d3 e6                	shl    %cl,%esi
+  801649:	89 f0                	mov    %esi,%eax
+  80164b:	21 d0                	and    %edx,%eax
+  80164d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801650:	eb 34                	jmp    801686 <strchr+0xc5>
+    p += 16;
+  801652:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+    v = *(const v16qi *)p;
+  801657:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80165b:	66 0f 6f 00          	movdqa (%rax),%xmm0
+  80165f:	0f 29 45 b0          	movaps %xmm0,-0x50(%rbp)
+    m = EQMASK16(v, zero) | EQMASK16(v, vc);
+  801663:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801668:	66 0f 74 45 d0       	pcmpeqb -0x30(%rbp),%xmm0
+  80166d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801671:	89 c2                	mov    %eax,%edx
+  801673:	66 0f 6f 45 b0       	movdqa -0x50(%rbp),%xmm0
+  801678:	66 0f 74 45 c0       	pcmpeqb -0x40(%rbp),%xmm0
+  80167d:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801681:	09 d0                	or     %edx,%eax
+  801683:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  while (!m) {
+  801686:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80168a:	74 c6                	je     801652 <strchr+0x91>
+  p += __builtin_ctz(m);
+  80168c:	31 c0                	xor    %eax,%eax
+  80168e:	f3 0f bc 45 fc       	tzcnt  -0x4(%rbp),%eax
+  801693:	48 98                	cltq
+  801695:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+  return *p ? (char *)p : 0;
+  801699:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80169d:	0f b6 00             	movzbl (%rax),%eax
+  8016a0:	84 c0                	test   %al,%al
+  8016a2:	74 06                	je     8016aa <strchr+0xe9>
+  8016a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8016a8:	eb 05                	jmp    8016af <strchr+0xee>
+  8016aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016af:	c9                   	leave
+  8016b0:	c3                   	ret
+
+00000000008016b1 <strfind>:
+strfind(const char *s, char c) {
+  8016b1:	55                   	push   %rbp
+  8016b2:	48 89 e5             	mov    %rsp,%rbp
+  8016b5:	48 83 ec 10          	sub    $0x10,%rsp
+  8016b9:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8016bd:	89 f0                	mov    %esi,%eax
+  8016bf:	88 45 f4             	mov    %al,-0xc(%rbp)
+  for (; *s; s++)
+  8016c2:	eb 11                	jmp    8016d5 <strfind+0x24>
+    if (*s == c)
+  8016c4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016c8:	0f b6 00             	movzbl (%rax),%eax
+  8016cb:	38 45 f4             	cmp    %al,-0xc(%rbp)
+  8016ce:	74 12                	je     8016e2 <strfind+0x31>
+  for (; *s; s++)
+  8016d0:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  8016d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8016d9:	0f b6 00             	movzbl (%rax),%eax
+  8016dc:	84 c0                	test   %al,%al
+  8016de:	75 e4                	jne    8016c4 <strfind+0x13>
+  8016e0:	eb 01                	jmp    8016e3 <strfind+0x32>
+      break;
+  8016e2:	90                   	nop
+  return (char *)s;
+  8016e3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  8016e7:	c9                   	leave
+  8016e8:	c3                   	ret
+
+00000000008016e9 <memset>:
+memset(void *v, int c, size_t n) {
+  8016e9:	55                   	push   %rbp
+  8016ea:	48 89 e5             	mov    %rsp,%rbp
+  8016ed:	48 83 ec 38          	sub    $0x38,%rsp
+  8016f1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  8016f5:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  8016f8:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  uint8_t *p = v;
+  8016fc:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801700:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801704:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801709:	76 41                	jbe    80174c <memset+0x63>
+  80170b:	48 b8 4e 0e 80 00 00 	movabs $0x800e4e,%rax
+  801712:	00 00 00 
+  801715:	ff d0                	call   *%rax
+  801717:	83 e0 01             	and    $0x1,%eax
+  80171a:	85 c0                	test   %eax,%eax
+  80171c:	74 2e                	je     80174c <memset+0x63>
+    asm volatile("cld; rep stosb"
+  80171e:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  801721:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  801725:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801729:	48 89 ce             	mov    %rcx,%rsi
+  80172c:	48 89 f7             	mov    %rsi,%rdi
+  80172f:	48 89 d1             	mov    %rdx,%rcx
+  801732:	fc                   	cld
+  801733:	f3 aa                	rep stos %al,%es:(%rdi)
+  801735:	48 89 ca             	mov    %rcx,%rdx
+  801738:	48 89 fe             	mov    %rdi,%rsi
+  80173b:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  80173f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    return v;
+  801743:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801747:	e9 a7 00 00 00       	jmp    8017f3 <memset+0x10a>
+  if (n >= 8) {
+  80174c:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801751:	0f 86 87 00 00 00    	jbe    8017de <memset+0xf5>
+    for (; (uintptr_t)p % 8; n--)
+  801757:	eb 16                	jmp    80176f <memset+0x86>
+      *p++ = c;
+  801759:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80175d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  801761:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801765:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  801768:	88 10                	mov    %dl,(%rax)
+    for (; (uintptr_t)p % 8; n--)
+  80176a:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80176f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801773:	83 e0 07             	and    $0x7,%eax
+  801776:	48 85 c0             	test   %rax,%rax
+  801779:	75 de                	jne    801759 <memset+0x70>
+    k  = (uint8_t)c * ONES;
+  80177b:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  80177e:	0f b6 c0             	movzbl %al,%eax
+  801781:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  801788:	01 01 01 
+  80178b:	48 0f af c2          	imul   %rdx,%rax
+  80178f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    nq = n / 8;
+  801793:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801797:	48 c1 e8 03          	shr    $0x3,%rax
+  80179b:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+    asm volatile("cld; rep stosq"
+  80179f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8017a3:	48 8b 4d f8          	mov    -0x8(%rbp),%rcx
+  8017a7:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8017ab:	48 89 ce             	mov    %rcx,%rsi
+  8017ae:	48 89 f7             	mov    %rsi,%rdi
+  8017b1:	48 89 d1             	mov    %rdx,%rcx
+  8017b4:	fc                   	cld
+  8017b5:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+  8017b8:	48 89 ca             	mov    %rcx,%rdx
+  8017bb:	48 89 fe             	mov    %rdi,%rsi
+  8017be:	48 89 75 f8          	mov    %rsi,-0x8(%rbp)
+  8017c2:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    n %= 8;
+  8017c6:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+  while (n-- > 0)
+  8017cb:	eb 11                	jmp    8017de <memset+0xf5>
+    *p++ = c;
+  8017cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8017d1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8017d5:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8017d9:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  8017dc:	88 10                	mov    %dl,(%rax)
+  while (n-- > 0)
+  8017de:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8017e2:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8017e6:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8017ea:	48 85 c0             	test   %rax,%rax
+  8017ed:	75 de                	jne    8017cd <memset+0xe4>
+  return v;
+  8017ef:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8017f3:	c9                   	leave
+  8017f4:	c3                   	ret
+
+00000000008017f5 <memmove>:
+memmove(void *dst, const void *src, size_t n) {
+  8017f5:	55                   	push   %rbp
+  8017f6:	48 89 e5             	mov    %rsp,%rbp
+  8017f9:	48 83 ec 38          	sub    $0x38,%rsp
+  8017fd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801801:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801805:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  s = src;
+  801809:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80180d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  d = dst;
+  801811:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801815:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  if (s < d && s + n > d) {
+  801819:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80181d:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  801821:	0f 83 da 00 00 00    	jae    801901 <memmove+0x10c>
+  801827:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80182b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80182f:	48 01 d0             	add    %rdx,%rax
+  801832:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  801836:	0f 83 c5 00 00 00    	jae    801901 <memmove+0x10c>
+    s += n;
+  80183c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801840:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+    d += n;
+  801844:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801848:	48 01 45 f0          	add    %rax,-0x10(%rbp)
+    if (n >= 8) {
+  80184c:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801851:	0f 86 94 00 00 00    	jbe    8018eb <memmove+0xf6>
+      for (; (uintptr_t)d % 8; n--)
+  801857:	eb 1c                	jmp    801875 <memmove+0x80>
+        *--d = *--s;
+  801859:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  80185e:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  801863:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801867:	0f b6 10             	movzbl (%rax),%edx
+  80186a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80186e:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801870:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  801875:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801879:	83 e0 07             	and    $0x7,%eax
+  80187c:	48 85 c0             	test   %rax,%rax
+  80187f:	75 d8                	jne    801859 <memmove+0x64>
+      nq = n / 8;
+  801881:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801885:	48 c1 e8 03          	shr    $0x3,%rax
+  801889:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  80188d:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+      d -= 8;
+  801892:	48 83 6d f0 08       	subq   $0x8,-0x10(%rbp)
+      s -= 8;
+  801897:	48 83 6d f8 08       	subq   $0x8,-0x8(%rbp)
+      asm volatile("std; rep movsq; cld"
+  80189c:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  8018a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8018a4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8018a8:	48 89 cf             	mov    %rcx,%rdi
+  8018ab:	48 89 d6             	mov    %rdx,%rsi
+  8018ae:	48 89 c1             	mov    %rax,%rcx
+  8018b1:	fd                   	std
+  8018b2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8018b5:	fc                   	cld
+  8018b6:	48 89 c8             	mov    %rcx,%rax
+  8018b9:	48 89 f2             	mov    %rsi,%rdx
+  8018bc:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8018c0:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8018c4:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      d += 8;
+  8018c8:	48 83 45 f0 08       	addq   $0x8,-0x10(%rbp)
+      s += 8;
+  8018cd:	48 83 45 f8 08       	addq   $0x8,-0x8(%rbp)
+    while (n-- > 0)
+  8018d2:	eb 17                	jmp    8018eb <memmove+0xf6>
+      *--d = *--s;
+  8018d4:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8018d9:	48 83 6d f0 01       	subq   $0x1,-0x10(%rbp)
+  8018de:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8018e2:	0f b6 10             	movzbl (%rax),%edx
+  8018e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8018e9:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8018eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8018ef:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8018f3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8018f7:	48 85 c0             	test   %rax,%rax
+  8018fa:	75 d8                	jne    8018d4 <memmove+0xdf>
+  if (s < d && s + n > d) {
+  8018fc:	e9 f4 00 00 00       	jmp    8019f5 <memmove+0x200>
+    if (n >= STRING_REP_MIN && (string_cpu() & STRING_ERMS)) {
+  801901:	48 83 7d c8 7f       	cmpq   $0x7f,-0x38(%rbp)
+  801906:	76 46                	jbe    80194e <memmove+0x159>
+  801908:	48 b8 4e 0e 80 00 00 	movabs $0x800e4e,%rax
+  80190f:	00 00 00 
+  801912:	ff d0                	call   *%rax
+  801914:	83 e0 01             	and    $0x1,%eax
+  801917:	85 c0                	test   %eax,%eax
+  801919:	74 33                	je     80194e <memmove+0x159>
+      asm volatile("cld; rep movsb"
+  80191b:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  80191f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  801923:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801927:	48 89 cf             	mov    %rcx,%rdi
+  80192a:	48 89 d6             	mov    %rdx,%rsi
+  80192d:	48 89 c1             	mov    %rax,%rcx
+  801930:	fc                   	cld
+  801931:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801933:	48 89 c8             	mov    %rcx,%rax
+  801936:	48 89 f2             	mov    %rsi,%rdx
+  801939:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  80193d:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  801941:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+      return dst;
+  801945:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801949:	e9 ab 00 00 00       	jmp    8019f9 <memmove+0x204>
+    if (n >= 8) {
+  80194e:	48 83 7d c8 07       	cmpq   $0x7,-0x38(%rbp)
+  801953:	0f 86 8b 00 00 00    	jbe    8019e4 <memmove+0x1ef>
+      for (; (uintptr_t)d % 8; n--)
+  801959:	eb 22                	jmp    80197d <memmove+0x188>
+        *d++ = *s++;
+  80195b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80195f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  801963:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801967:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80196b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80196f:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  801973:	0f b6 12             	movzbl (%rdx),%edx
+  801976:	88 10                	mov    %dl,(%rax)
+      for (; (uintptr_t)d % 8; n--)
+  801978:	48 83 6d c8 01       	subq   $0x1,-0x38(%rbp)
+  80197d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801981:	83 e0 07             	and    $0x7,%eax
+  801984:	48 85 c0             	test   %rax,%rax
+  801987:	75 d2                	jne    80195b <memmove+0x166>
+      nq = n / 8;
+  801989:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80198d:	48 c1 e8 03          	shr    $0x3,%rax
+  801991:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      asm volatile("cld; rep movsq"
+  801995:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801999:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80199d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8019a1:	48 89 cf             	mov    %rcx,%rdi
+  8019a4:	48 89 d6             	mov    %rdx,%rsi
+  8019a7:	48 89 c1             	mov    %rax,%rcx
+  8019aa:	fc                   	cld
+  8019ab:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8019ae:	48 89 c8             	mov    %rcx,%rax
+  8019b1:	48 89 f2             	mov    %rsi,%rdx
+  8019b4:	48 89 7d f0          	mov    %rdi,-0x10(%rbp)
+  8019b8:	48 89 55 f8          	mov    %rdx,-0x8(%rbp)
+  8019bc:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+      n %= 8;
+  8019c0:	48 83 65 c8 07       	andq   $0x7,-0x38(%rbp)
+    while (n-- > 0)
+  8019c5:	eb 1d                	jmp    8019e4 <memmove+0x1ef>
+      *d++ = *s++;
+  8019c7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8019cb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8019cf:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  8019d3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8019d7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8019db:	48 89 4d f0          	mov    %rcx,-0x10(%rbp)
+  8019df:	0f b6 12             	movzbl (%rdx),%edx
+  8019e2:	88 10                	mov    %dl,(%rax)
+    while (n-- > 0)
+  8019e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8019e8:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8019ec:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8019f0:	48 85 c0             	test   %rax,%rax
+  8019f3:	75 d2                	jne    8019c7 <memmove+0x1d2>
+  return dst;
+  8019f5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+}
+  8019f9:	c9                   	leave
+  8019fa:	c3                   	ret
+
+00000000008019fb <memcpy>:
+  return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8019fb:	55                   	push   %rbp
+  8019fc:	48 89 e5             	mov    %rsp,%rbp
+  8019ff:	48 83 ec 18          	sub    $0x18,%rsp
+  801a03:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801a07:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  801a0b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return memmove(dst, src, n);
+  801a0f:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801a13:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a17:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a1b:	48 89 ce             	mov    %rcx,%rsi
+  801a1e:	48 89 c7             	mov    %rax,%rdi
+  801a21:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  801a28:	00 00 00 
+  801a2b:	ff d0                	call   *%rax
+}
+  801a2d:	c9                   	leave
+  801a2e:	c3                   	ret
+
+0000000000801a2f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+  801a2f:	55                   	push   %rbp
+  801a30:	48 89 e5             	mov    %rsp,%rbp
+  801a33:	48 83 ec 40          	sub    $0x40,%rsp
+  801a37:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801a3b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801a3f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  const uint8_t *s1 = (const uint8_t *)v1;
+  801a43:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801a47:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  const uint8_t *s2 = (const uint8_t *)v2;
+  801a4b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a4f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+#ifdef __SSE2__
+  unsigned m;
+  int i;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801a53:	48 83 7d c8 1f       	cmpq   $0x1f,-0x38(%rbp)
+  801a58:	0f 86 a7 00 00 00    	jbe    801b05 <memcmp+0xd6>
+  801a5e:	48 b8 4e 0e 80 00 00 	movabs $0x800e4e,%rax
+  801a65:	00 00 00 
+  801a68:	ff d0                	call   *%rax
+  801a6a:	83 e0 02             	and    $0x2,%eax
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	0f 84 90 00 00 00    	je     801b05 <memcmp+0xd6>
+    return memcmp_avx2(s1, s2, n);
+  801a75:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801a79:	48 8b 4d f0          	mov    -0x10(%rbp),%rcx
+  801a7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a81:	48 89 ce             	mov    %rcx,%rsi
+  801a84:	48 89 c7             	mov    %rax,%rdi
+  801a87:	48 b8 16 10 80 00 00 	movabs $0x801016,%rax
+  801a8e:	00 00 00 
+  801a91:	ff d0                	call   *%rax
+  801a93:	e9 c2 00 00 00       	jmp    801b5a <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+    m = EQMASK16(*(const v16qi_u *)s1, *(const v16qi_u *)s2);
+  801a98:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801a9c:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801aa0:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801aa4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801aa8:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801aac:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801ab0:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801ab4:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    if (m != 0xFFFF) {
+  801ab7:	81 7d ec ff ff 00 00 	cmpl   $0xffff,-0x14(%rbp)
+  801abe:	74 36                	je     801af6 <memcmp+0xc7>
+      i = __builtin_ctz(~m);
+  801ac0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801ac3:	f7 d0                	not    %eax
+  801ac5:	f3 0f bc c0          	tzcnt  %eax,%eax
+  801ac9:	89 45 e8             	mov    %eax,-0x18(%rbp)
+      return (int)s1[i] - (int)s2[i];
+  801acc:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  801acf:	48 63 d0             	movslq %eax,%rdx
+  801ad2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801ad6:	48 01 d0             	add    %rdx,%rax
+  801ad9:	0f b6 00             	movzbl (%rax),%eax
+  801adc:	0f b6 c0             	movzbl %al,%eax
+  801adf:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  801ae2:	48 63 ca             	movslq %edx,%rcx
+  801ae5:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801ae9:	48 01 ca             	add    %rcx,%rdx
+  801aec:	0f b6 12             	movzbl (%rdx),%edx
+  801aef:	0f b6 d2             	movzbl %dl,%edx
+  801af2:	29 d0                	sub    %edx,%eax
+  801af4:	eb 64                	jmp    801b5a <memcmp+0x12b>
+  for (; n >= 16; s1 += 16, s2 += 16, n -= 16) {
+  801af6:	48 83 45 f8 10       	addq   $0x10,-0x8(%rbp)
+  801afb:	48 83 45 f0 10       	addq   $0x10,-0x10(%rbp)
+  801b00:	48 83 6d c8 10       	subq   $0x10,-0x38(%rbp)
+  801b05:	48 83 7d c8 0f       	cmpq   $0xf,-0x38(%rbp)
+  801b0a:	77 8c                	ja     801a98 <memcmp+0x69>
+  // Skip the equal words; the bytes below find the difference.
+  for (; n >= 8 && *(const uword_t *)s1 == *(const uword_t *)s2; n -= 8)
+    s1 += 8, s2 += 8;
+#endif
+
+  while (n-- > 0) {
+  801b0c:	eb 36                	jmp    801b44 <memcmp+0x115>
+    if (*s1 != *s2)
+  801b0e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b12:	0f b6 10             	movzbl (%rax),%edx
+  801b15:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b19:	0f b6 00             	movzbl (%rax),%eax
+  801b1c:	38 c2                	cmp    %al,%dl
+  801b1e:	74 1a                	je     801b3a <memcmp+0x10b>
+      return (int)*s1 - (int)*s2;
+  801b20:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801b24:	0f b6 00             	movzbl (%rax),%eax
+  801b27:	0f b6 c8             	movzbl %al,%ecx
+  801b2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801b2e:	0f b6 00             	movzbl (%rax),%eax
+  801b31:	0f b6 d0             	movzbl %al,%edx
+  801b34:	89 c8                	mov    %ecx,%eax
+  801b36:	29 d0                	sub    %edx,%eax
+  801b38:	eb 20                	jmp    801b5a <memcmp+0x12b>
+    s1++, s2++;
+  801b3a:	48 83 45 f8 01       	addq   $0x1,-0x8(%rbp)
+  801b3f:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  while (n-- > 0) {
+  801b44:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b48:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801b4c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801b50:	48 85 c0             	test   %rax,%rax
+  801b53:	75 b9                	jne    801b0e <memcmp+0xdf>
+  }
+
+  return 0;
+  801b55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b5a:	c9                   	leave
+  801b5b:	c3                   	ret
+
+0000000000801b5c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n) {
+  801b5c:	55                   	push   %rbp
+  801b5d:	48 89 e5             	mov    %rsp,%rbp
+  801b60:	48 83 ec 50          	sub    $0x50,%rsp
+  801b64:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801b68:	89 75 c4             	mov    %esi,-0x3c(%rbp)
+  801b6b:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  const void *ends = (const char *)s + n;
+  801b6f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801b73:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  801b77:	48 01 d0             	add    %rdx,%rax
+  801b7a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+#ifdef __SSE2__
+  v16qi vc = (v16qi){0} + (char)c;
+  801b7e:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801b81:	66 0f 6e c0          	movd   %eax,%xmm0
+  801b85:	66 0f 60 c0          	punpcklbw %xmm0,%xmm0
+  801b89:	66 0f 61 c0          	punpcklwd %xmm0,%xmm0
+  801b8d:	66 0f 70 c0 00       	pshufd $0x0,%xmm0,%xmm0
+  801b92:	0f 29 45 e0          	movaps %xmm0,-0x20(%rbp)
+  unsigned m;
+
+  if (n >= 32 && (string_cpu() & STRING_AVX2))
+  801b96:	48 83 7d b8 1f       	cmpq   $0x1f,-0x48(%rbp)
+  801b9b:	76 73                	jbe    801c10 <memfind+0xb4>
+  801b9d:	48 b8 4e 0e 80 00 00 	movabs $0x800e4e,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+  801ba9:	83 e0 02             	and    $0x2,%eax
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	74 60                	je     801c10 <memfind+0xb4>
+    return (void *)memfind_avx2(s, c, n);
+  801bb0:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  801bb3:	0f b6 c8             	movzbl %al,%ecx
+  801bb6:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  801bba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bbe:	89 ce                	mov    %ecx,%esi
+  801bc0:	48 89 c7             	mov    %rax,%rdi
+  801bc3:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  801bca:	00 00 00 
+  801bcd:	ff d0                	call   *%rax
+  801bcf:	eb 6c                	jmp    801c3d <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+    if ((m = EQMASK16(*(const v16qi_u *)s, vc)))
+  801bd1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bd5:	f3 0f 6f 00          	movdqu (%rax),%xmm0
+  801bd9:	66 0f 6f c8          	movdqa %xmm0,%xmm1
+  801bdd:	66 0f 6f 45 e0       	movdqa -0x20(%rbp),%xmm0
+  801be2:	66 0f 74 c1          	pcmpeqb %xmm1,%xmm0
+  801be6:	66 0f d7 c0          	pmovmskb %xmm0,%eax
+  801bea:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  801bed:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  801bf1:	74 13                	je     801c06 <memfind+0xaa>
+      return (void *)s + __builtin_ctz(m);
+  801bf3:	31 c0                	xor    %eax,%eax
+  801bf5:	f3 0f bc 45 dc       	tzcnt  -0x24(%rbp),%eax
+  801bfa:	48 63 d0             	movslq %eax,%rdx
+  801bfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c01:	48 01 d0             	add    %rdx,%rax
+  801c04:	eb 37                	jmp    801c3d <memfind+0xe1>
+  for (; n >= 16; s += 16, n -= 16) {
+  801c06:	48 83 45 c8 10       	addq   $0x10,-0x38(%rbp)
+  801c0b:	48 83 6d b8 10       	subq   $0x10,-0x48(%rbp)
+  801c10:	48 83 7d b8 0f       	cmpq   $0xf,-0x48(%rbp)
+  801c15:	77 ba                	ja     801bd1 <memfind+0x75>
+  for (; n >= 8; s += 8, n -= 8) {
+    if ((z = HASZERO(*(const uword_t *)s ^ k)))
+      return (void *)s + __builtin_ctzll(z) / 8;
+  }
+#endif
+  for (; s < ends; s++)
+  801c17:	eb 13                	jmp    801c2c <memfind+0xd0>
+    if (*(const unsigned char *)s == (unsigned char)c)
+  801c19:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c1d:	0f b6 00             	movzbl (%rax),%eax
+  801c20:	8b 55 c4             	mov    -0x3c(%rbp),%edx
+  801c23:	38 d0                	cmp    %dl,%al
+  801c25:	74 11                	je     801c38 <memfind+0xdc>
+  for (; s < ends; s++)
+  801c27:	48 83 45 c8 01       	addq   $0x1,-0x38(%rbp)
+  801c2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801c30:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  801c34:	72 e3                	jb     801c19 <memfind+0xbd>
+  801c36:	eb 01                	jmp    801c39 <memfind+0xdd>
+      break;
+  801c38:	90                   	nop
+  return (void *)s;
+  801c39:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+}
+  801c3d:	c9                   	leave
+  801c3e:	c3                   	ret
+
+0000000000801c3f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801c3f:	55                   	push   %rbp
+  801c40:	48 89 e5             	mov    %rsp,%rbp
+  801c43:	48 83 ec 38          	sub    $0x38,%rsp
+  801c47:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801c4b:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801c4f:	89 55 cc             	mov    %edx,-0x34(%rbp)
+  int neg  = 0;
+  801c52:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  long val = 0;
+  801c59:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  801c60:	00 
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801c61:	eb 05                	jmp    801c68 <strtol+0x29>
+    s++;
+  801c63:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  while (*s == ' ' || *s == '\t')
+  801c68:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c6c:	0f b6 00             	movzbl (%rax),%eax
+  801c6f:	3c 20                	cmp    $0x20,%al
+  801c71:	74 f0                	je     801c63 <strtol+0x24>
+  801c73:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c77:	0f b6 00             	movzbl (%rax),%eax
+  801c7a:	3c 09                	cmp    $0x9,%al
+  801c7c:	74 e5                	je     801c63 <strtol+0x24>
+
+  // plus/minus sign
+  if (*s == '+')
+  801c7e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c82:	0f b6 00             	movzbl (%rax),%eax
+  801c85:	3c 2b                	cmp    $0x2b,%al
+  801c87:	75 07                	jne    801c90 <strtol+0x51>
+    s++;
+  801c89:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801c8e:	eb 17                	jmp    801ca7 <strtol+0x68>
+  else if (*s == '-')
+  801c90:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801c94:	0f b6 00             	movzbl (%rax),%eax
+  801c97:	3c 2d                	cmp    $0x2d,%al
+  801c99:	75 0c                	jne    801ca7 <strtol+0x68>
+    s++, neg = 1;
+  801c9b:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801ca0:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801ca7:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cab:	74 06                	je     801cb3 <strtol+0x74>
+  801cad:	83 7d cc 10          	cmpl   $0x10,-0x34(%rbp)
+  801cb1:	75 28                	jne    801cdb <strtol+0x9c>
+  801cb3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cb7:	0f b6 00             	movzbl (%rax),%eax
+  801cba:	3c 30                	cmp    $0x30,%al
+  801cbc:	75 1d                	jne    801cdb <strtol+0x9c>
+  801cbe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801cc2:	48 83 c0 01          	add    $0x1,%rax
+  801cc6:	0f b6 00             	movzbl (%rax),%eax
+  801cc9:	3c 78                	cmp    $0x78,%al
+  801ccb:	75 0e                	jne    801cdb <strtol+0x9c>
+    s += 2, base = 16;
+  801ccd:	48 83 45 d8 02       	addq   $0x2,-0x28(%rbp)
+  801cd2:	c7 45 cc 10 00 00 00 	movl   $0x10,-0x34(%rbp)
+  801cd9:	eb 2c                	jmp    801d07 <strtol+0xc8>
+  else if (base == 0 && s[0] == '0')
+  801cdb:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cdf:	75 19                	jne    801cfa <strtol+0xbb>
+  801ce1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801ce5:	0f b6 00             	movzbl (%rax),%eax
+  801ce8:	3c 30                	cmp    $0x30,%al
+  801cea:	75 0e                	jne    801cfa <strtol+0xbb>
+    s++, base = 8;
+  801cec:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801cf1:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+  801cf8:	eb 0d                	jmp    801d07 <strtol+0xc8>
+  else if (base == 0)
+  801cfa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  801cfe:	75 07                	jne    801d07 <strtol+0xc8>
+    base = 10;
+  801d00:	c7 45 cc 0a 00 00 00 	movl   $0xa,-0x34(%rbp)
+
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+  801d07:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d0b:	0f b6 00             	movzbl (%rax),%eax
+  801d0e:	3c 2f                	cmp    $0x2f,%al
+  801d10:	7e 1d                	jle    801d2f <strtol+0xf0>
+  801d12:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d16:	0f b6 00             	movzbl (%rax),%eax
+  801d19:	3c 39                	cmp    $0x39,%al
+  801d1b:	7f 12                	jg     801d2f <strtol+0xf0>
+      dig = *s - '0';
+  801d1d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d21:	0f b6 00             	movzbl (%rax),%eax
+  801d24:	0f be c0             	movsbl %al,%eax
+  801d27:	83 e8 30             	sub    $0x30,%eax
+  801d2a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d2d:	eb 4e                	jmp    801d7d <strtol+0x13e>
+    else if (*s >= 'a' && *s <= 'z')
+  801d2f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d33:	0f b6 00             	movzbl (%rax),%eax
+  801d36:	3c 60                	cmp    $0x60,%al
+  801d38:	7e 1d                	jle    801d57 <strtol+0x118>
+  801d3a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d3e:	0f b6 00             	movzbl (%rax),%eax
+  801d41:	3c 7a                	cmp    $0x7a,%al
+  801d43:	7f 12                	jg     801d57 <strtol+0x118>
+      dig = *s - 'a' + 10;
+  801d45:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d49:	0f b6 00             	movzbl (%rax),%eax
+  801d4c:	0f be c0             	movsbl %al,%eax
+  801d4f:	83 e8 57             	sub    $0x57,%eax
+  801d52:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  801d55:	eb 26                	jmp    801d7d <strtol+0x13e>
+    else if (*s >= 'A' && *s <= 'Z')
+  801d57:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d5b:	0f b6 00             	movzbl (%rax),%eax
+  801d5e:	3c 40                	cmp    $0x40,%al
+  801d60:	7e 47                	jle    801da9 <strtol+0x16a>
+  801d62:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d66:	0f b6 00             	movzbl (%rax),%eax
+  801d69:	3c 5a                	cmp    $0x5a,%al
+  801d6b:	7f 3c                	jg     801da9 <strtol+0x16a>
+      dig = *s - 'A' + 10;
+  801d6d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801d71:	0f b6 00             	movzbl (%rax),%eax
+  801d74:	0f be c0             	movsbl %al,%eax
+  801d77:	83 e8 37             	sub    $0x37,%eax
+  801d7a:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    else
+      break;
+    if (dig >= base)
+  801d7d:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d80:	3b 45 cc             	cmp    -0x34(%rbp),%eax
+  801d83:	7d 23                	jge    801da8 <strtol+0x169>
+      break;
+    s++, val = (val * base) + dig;
+  801d85:	48 83 45 d8 01       	addq   $0x1,-0x28(%rbp)
+  801d8a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801d8d:	48 98                	cltq
+  801d8f:	48 0f af 45 f0       	imul   -0x10(%rbp),%rax
+  801d94:	48 89 c2             	mov    %rax,%rdx
+  801d97:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801d9a:	48 98                	cltq
+  801d9c:	48 01 d0             	add    %rdx,%rax
+  801d9f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  while (1) {
+  801da3:	e9 5f ff ff ff       	jmp    801d07 <strtol+0xc8>
+      break;
+  801da8:	90                   	nop
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801da9:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801dae:	74 0b                	je     801dbb <strtol+0x17c>
+    *endptr = (char *)s;
+  801db0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801db4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  801db8:	48 89 10             	mov    %rdx,(%rax)
+  return (neg ? -val : val);
+  801dbb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  801dbf:	74 09                	je     801dca <strtol+0x18b>
+  801dc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801dc5:	48 f7 d8             	neg    %rax
+  801dc8:	eb 04                	jmp    801dce <strtol+0x18f>
+  801dca:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+}
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+
+0000000000801dd0 <syscall>:
+
+#include <inc/syscall.h>
+#include <inc/lib.h>
+
+static inline int64_t
+syscall(int64_t num, int64_t check, int64_t a1, int64_t a2, int64_t a3, int64_t a4, int64_t a5) {
+  801dd0:	55                   	push   %rbp
+  801dd1:	48 89 e5             	mov    %rsp,%rbp
+  801dd4:	53                   	push   %rbx
+  801dd5:	48 83 ec 48          	sub    $0x48,%rsp
+  801dd9:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  801ddd:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  801de1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  801de5:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  801de9:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  801ded:	4c 89 4d b0          	mov    %r9,-0x50(%rbp)
+  //
+  // The last clause tells the assembler that this can
+  // potentially change the condition codes and arbitrary
+  // memory locations.
+
+  asm volatile("int %1\n"
+  801df1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801df5:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  801df9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  801dfd:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  801e01:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801e05:	48 8b 75 10          	mov    0x10(%rbp),%rsi
+  801e09:	4c 89 c3             	mov    %r8,%rbx
+  801e0c:	cd 30                	int    $0x30
+  801e0e:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+                 "b"(a3),
+                 "D"(a4),
+                 "S"(a5)
+               : "cc", "memory");
+
+  if (check && ret > 0)
+  801e12:	48 83 7d d0 00       	cmpq   $0x0,-0x30(%rbp)
+  801e17:	74 46                	je     801e5f <syscall+0x8f>
+  801e19:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  801e1e:	7e 3f                	jle    801e5f <syscall+0x8f>
+    panic("syscall %ld returned %ld (> 0)", (long)num, (long)ret);
+  801e20:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  801e24:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801e28:	49 89 d0             	mov    %rdx,%r8
+  801e2b:	48 89 c1             	mov    %rax,%rcx
+  801e2e:	48 b8 48 56 80 00 00 	movabs $0x805648,%rax
+  801e35:	00 00 00 
+  801e38:	48 89 c2             	mov    %rax,%rdx
+  801e3b:	be 22 00 00 00       	mov    $0x22,%esi
+  801e40:	48 b8 67 56 80 00 00 	movabs $0x805667,%rax
+  801e47:	00 00 00 
+  801e4a:	48 89 c7             	mov    %rax,%rdi
+  801e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e52:	49 b9 10 4c 80 00 00 	movabs $0x804c10,%r9
+  801e59:	00 00 00 
+  801e5c:	41 ff d1             	call   *%r9
+
+  return ret;
+  801e5f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+}
+  801e63:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801e67:	c9                   	leave
+  801e68:	c3                   	ret
+
+0000000000801e69 <sys_cputs>:
+
+void
+sys_cputs(const char *s, size_t len) {
+  801e69:	55                   	push   %rbp
+  801e6a:	48 89 e5             	mov    %rsp,%rbp
+  801e6d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e71:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  801e75:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  syscall(SYS_cputs, 0, (uint64_t)s, len, 0, 0, 0);
+  801e79:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  801e7d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801e81:	48 83 ec 08          	sub    $0x8,%rsp
+  801e85:	6a 00                	push   $0x0
+  801e87:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801e8d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e93:	48 89 d1             	mov    %rdx,%rcx
+  801e96:	48 89 c2             	mov    %rax,%rdx
+  801e99:	be 00 00 00 00       	mov    $0x0,%esi
+  801e9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea3:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  801eaa:	00 00 00 
+  801ead:	ff d0                	call   *%rax
+  801eaf:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801eb3:	90                   	nop
+  801eb4:	c9                   	leave
+  801eb5:	c3                   	ret
+
+0000000000801eb6 <sys_cgetc>:
+
+int
+sys_cgetc(void) {
+  801eb6:	55                   	push   %rbp
+  801eb7:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+  801eba:	48 83 ec 08          	sub    $0x8,%rsp
+  801ebe:	6a 00                	push   $0x0
+  801ec0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801ec6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ecc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ed1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed6:	be 00 00 00 00       	mov    $0x0,%esi
+  801edb:	bf 01 00 00 00       	mov    $0x1,%edi
+  801ee0:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  801ee7:	00 00 00 
+  801eea:	ff d0                	call   *%rax
+  801eec:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801ef0:	c9                   	leave
+  801ef1:	c3                   	ret
+
+0000000000801ef2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+  801ef2:	55                   	push   %rbp
+  801ef3:	48 89 e5             	mov    %rsp,%rbp
+  801ef6:	48 83 ec 10          	sub    $0x10,%rsp
+  801efa:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+  801efd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f00:	48 98                	cltq
+  801f02:	48 83 ec 08          	sub    $0x8,%rsp
+  801f06:	6a 00                	push   $0x0
+  801f08:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f19:	48 89 c2             	mov    %rax,%rdx
+  801f1c:	be 01 00 00 00       	mov    $0x1,%esi
+  801f21:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f26:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  801f2d:	00 00 00 
+  801f30:	ff d0                	call   *%rax
+  801f32:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f36:	c9                   	leave
+  801f37:	c3                   	ret
+
+0000000000801f38 <sys_env_exit>:
+
+void
+sys_env_exit(int status) {
+  801f38:	55                   	push   %rbp
+  801f39:	48 89 e5             	mov    %rsp,%rbp
+  801f3c:	48 83 ec 10          	sub    $0x10,%rsp
+  801f40:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_env_exit, 0, status, 0, 0, 0, 0);
+  801f43:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  801f46:	48 98                	cltq
+  801f48:	48 83 ec 08          	sub    $0x8,%rsp
+  801f4c:	6a 00                	push   $0x0
+  801f4e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801f54:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f5f:	48 89 c2             	mov    %rax,%rdx
+  801f62:	be 00 00 00 00       	mov    $0x0,%esi
+  801f67:	bf 04 00 00 00       	mov    $0x4,%edi
+  801f6c:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	48 83 c4 10          	add    $0x10,%rsp
+}
+  801f7c:	90                   	nop
+  801f7d:	c9                   	leave
+  801f7e:	c3                   	ret
+
+0000000000801f7f <sys_env_wait>:
+
+int
+sys_env_wait(envid_t envid, int *status) {
+  801f7f:	55                   	push   %rbp
+  801f80:	48 89 e5             	mov    %rsp,%rbp
+  801f83:	48 83 ec 20          	sub    $0x20,%rsp
+  801f87:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  801f8a:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  // input only.
+  asm volatile("int %2\n"
+               : "=a"(ret), "=d"(st)
+               : "i"(T_SYSCALL),
+                 "a"(SYS_env_wait),
+                 "d"((int64_t)envid)
+  801f8e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  801f91:	48 63 d0             	movslq %eax,%rdx
+  asm volatile("int %2\n"
+  801f94:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f99:	cd 30                	int    $0x30
+  801f9b:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  801f9f:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+               : "cc", "memory");
+
+  if (ret > 0)
+  801fa3:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801fa8:	7e 3d                	jle    801fe7 <sys_env_wait+0x68>
+    panic("syscall %ld returned %ld (> 0)", (long)SYS_env_wait, (long)ret);
+  801faa:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  801fae:	49 89 c0             	mov    %rax,%r8
+  801fb1:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801fb6:	48 b8 48 56 80 00 00 	movabs $0x805648,%rax
+  801fbd:	00 00 00 
+  801fc0:	48 89 c2             	mov    %rax,%rdx
+  801fc3:	be 49 00 00 00       	mov    $0x49,%esi
+  801fc8:	48 b8 67 56 80 00 00 	movabs $0x805667,%rax
+  801fcf:	00 00 00 
+  801fd2:	48 89 c7             	mov    %rax,%rdi
+  801fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fda:	49 b9 10 4c 80 00 00 	movabs $0x804c10,%r9
+  801fe1:	00 00 00 
+  801fe4:	41 ff d1             	call   *%r9
+  if (!ret && status)
+  801fe7:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  801fec:	75 13                	jne    802001 <sys_env_wait+0x82>
+  801fee:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  801ff3:	74 0c                	je     802001 <sys_env_wait+0x82>
+    *status = st;
+  801ff5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  801ff9:	89 c2                	mov    %eax,%edx
+  801ffb:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fff:	89 10                	mov    %edx,(%rax)
+  return ret;
+  802001:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  802005:	c9                   	leave
+  802006:	c3                   	ret
+
+0000000000802007 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void) {
+  802007:	55                   	push   %rbp
+  802008:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+  80200b:	48 83 ec 08          	sub    $0x8,%rsp
+  80200f:	6a 00                	push   $0x0
+  802011:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802017:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80201d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802022:	ba 00 00 00 00       	mov    $0x0,%edx
+  802027:	be 00 00 00 00       	mov    $0x0,%esi
+  80202c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802031:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802038:	00 00 00 
+  80203b:	ff d0                	call   *%rax
+  80203d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802041:	c9                   	leave
+  802042:	c3                   	ret
+
+0000000000802043 <sys_yield>:
+
+void
+sys_yield(void) {
+  802043:	55                   	push   %rbp
+  802044:	48 89 e5             	mov    %rsp,%rbp
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+  802047:	48 83 ec 08          	sub    $0x8,%rsp
+  80204b:	6a 00                	push   $0x0
+  80204d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802053:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802059:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80205e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802063:	be 00 00 00 00       	mov    $0x0,%esi
+  802068:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80206d:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802074:	00 00 00 
+  802077:	ff d0                	call   *%rax
+  802079:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80207d:	90                   	nop
+  80207e:	c9                   	leave
+  80207f:	c3                   	ret
+
+0000000000802080 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm) {
+  802080:	55                   	push   %rbp
+  802081:	48 89 e5             	mov    %rsp,%rbp
+  802084:	48 83 ec 20          	sub    $0x20,%rsp
+  802088:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80208b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80208f:	89 55 e8             	mov    %edx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc, 1, envid, (uint64_t)va, perm, 0, 0);
+  802092:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  802095:	48 63 c8             	movslq %eax,%rcx
+  802098:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80209c:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80209f:	48 98                	cltq
+  8020a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8020a5:	6a 00                	push   $0x0
+  8020a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8020ad:	49 89 c8             	mov    %rcx,%r8
+  8020b0:	48 89 d1             	mov    %rdx,%rcx
+  8020b3:	48 89 c2             	mov    %rax,%rdx
+  8020b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8020bb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8020c0:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  8020c7:	00 00 00 
+  8020ca:	ff d0                	call   *%rax
+  8020cc:	48 83 c4 10          	add    $0x10,%rsp
+  8020d0:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  // Unpoison the allocated page
+  if (!r)
+    platform_asan_unpoison(ROUNDDOWN(va, PGSIZE), PGSIZE);
+#endif
+  return r;
+  8020d3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  8020d6:	c9                   	leave
+  8020d7:	c3                   	ret
+
+00000000008020d8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm) {
+  8020d8:	55                   	push   %rbp
+  8020d9:	48 89 e5             	mov    %rsp,%rbp
+  8020dc:	48 83 ec 20          	sub    $0x20,%rsp
+  8020e0:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8020e3:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8020e7:	89 55 f8             	mov    %edx,-0x8(%rbp)
+  8020ea:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8020ee:	44 89 45 e4          	mov    %r8d,-0x1c(%rbp)
+  return syscall(SYS_page_map, 1, srcenv, (uint64_t)srcva, dstenv, (uint64_t)dstva, perm);
+  8020f2:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8020f5:	48 63 c8             	movslq %eax,%rcx
+  8020f8:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  8020fc:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  8020ff:	48 63 f0             	movslq %eax,%rsi
+  802102:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802106:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802109:	48 98                	cltq
+  80210b:	48 83 ec 08          	sub    $0x8,%rsp
+  80210f:	51                   	push   %rcx
+  802110:	49 89 f9             	mov    %rdi,%r9
+  802113:	49 89 f0             	mov    %rsi,%r8
+  802116:	48 89 d1             	mov    %rdx,%rcx
+  802119:	48 89 c2             	mov    %rax,%rdx
+  80211c:	be 01 00 00 00       	mov    $0x1,%esi
+  802121:	bf 07 00 00 00       	mov    $0x7,%edi
+  802126:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  80212d:	00 00 00 
+  802130:	ff d0                	call   *%rax
+  802132:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802136:	c9                   	leave
+  802137:	c3                   	ret
+
+0000000000802138 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va) {
+  802138:	55                   	push   %rbp
+  802139:	48 89 e5             	mov    %rsp,%rbp
+  80213c:	48 83 ec 10          	sub    $0x10,%rsp
+  802140:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802143:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_page_unmap, 1, envid, (uint64_t)va, 0, 0, 0);
+  802147:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80214b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80214e:	48 98                	cltq
+  802150:	48 83 ec 08          	sub    $0x8,%rsp
+  802154:	6a 00                	push   $0x0
+  802156:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80215c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802162:	48 89 d1             	mov    %rdx,%rcx
+  802165:	48 89 c2             	mov    %rax,%rdx
+  802168:	be 01 00 00 00       	mov    $0x1,%esi
+  80216d:	bf 08 00 00 00       	mov    $0x8,%edi
+  802172:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+  80217e:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802182:	c9                   	leave
+  802183:	c3                   	ret
+
+0000000000802184 <sys_env_set_status>:
+
+// sys_exofork is inlined in lib.h
+
+int
+sys_env_set_status(envid_t envid, int status) {
+  802184:	55                   	push   %rbp
+  802185:	48 89 e5             	mov    %rsp,%rbp
+  802188:	48 83 ec 10          	sub    $0x10,%rsp
+  80218c:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  80218f:	89 75 f8             	mov    %esi,-0x8(%rbp)
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+  802192:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802195:	48 63 d0             	movslq %eax,%rdx
+  802198:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80219b:	48 98                	cltq
+  80219d:	48 83 ec 08          	sub    $0x8,%rsp
+  8021a1:	6a 00                	push   $0x0
+  8021a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021af:	48 89 d1             	mov    %rdx,%rcx
+  8021b2:	48 89 c2             	mov    %rax,%rdx
+  8021b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8021ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8021bf:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  8021c6:	00 00 00 
+  8021c9:	ff d0                	call   *%rax
+  8021cb:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8021cf:	c9                   	leave
+  8021d0:	c3                   	ret
+
+00000000008021d1 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8021d1:	55                   	push   %rbp
+  8021d2:	48 89 e5             	mov    %rsp,%rbp
+  8021d5:	48 83 ec 10          	sub    $0x10,%rsp
+  8021d9:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8021dc:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint64_t)tf, 0, 0, 0);
+  8021e0:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8021e4:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8021e7:	48 98                	cltq
+  8021e9:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ed:	6a 00                	push   $0x0
+  8021ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8021f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021fb:	48 89 d1             	mov    %rdx,%rcx
+  8021fe:	48 89 c2             	mov    %rax,%rdx
+  802201:	be 01 00 00 00       	mov    $0x1,%esi
+  802206:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80220b:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+  802217:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80221b:	c9                   	leave
+  80221c:	c3                   	ret
+
+000000000080221d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80221d:	55                   	push   %rbp
+  80221e:	48 89 e5             	mov    %rsp,%rbp
+  802221:	48 83 ec 10          	sub    $0x10,%rsp
+  802225:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802228:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint64_t)upcall, 0, 0, 0);
+  80222c:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  802230:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802233:	48 98                	cltq
+  802235:	48 83 ec 08          	sub    $0x8,%rsp
+  802239:	6a 00                	push   $0x0
+  80223b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802241:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802247:	48 89 d1             	mov    %rdx,%rcx
+  80224a:	48 89 c2             	mov    %rax,%rdx
+  80224d:	be 01 00 00 00       	mov    $0x1,%esi
+  802252:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802257:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  80225e:	00 00 00 
+  802261:	ff d0                	call   *%rax
+  802263:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802267:	c9                   	leave
+  802268:	c3                   	ret
+
+0000000000802269 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint64_t value, void *srcva, int perm) {
+  802269:	55                   	push   %rbp
+  80226a:	48 89 e5             	mov    %rsp,%rbp
+  80226d:	48 83 ec 20          	sub    $0x20,%rsp
+  802271:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  802274:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802278:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  80227c:	89 4d f8             	mov    %ecx,-0x8(%rbp)
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint64_t)srcva, perm, 0);
+  80227f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802282:	48 63 f0             	movslq %eax,%rsi
+  802285:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802289:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80228d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802290:	48 98                	cltq
+  802292:	48 83 ec 08          	sub    $0x8,%rsp
+  802296:	6a 00                	push   $0x0
+  802298:	49 89 f1             	mov    %rsi,%r9
+  80229b:	49 89 c8             	mov    %rcx,%r8
+  80229e:	48 89 d1             	mov    %rdx,%rcx
+  8022a1:	48 89 c2             	mov    %rax,%rdx
+  8022a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a9:	bf 0e 00 00 00       	mov    $0xe,%edi
+  8022ae:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  8022b5:	00 00 00 
+  8022b8:	ff d0                	call   *%rax
+  8022ba:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8022be:	c9                   	leave
+  8022bf:	c3                   	ret
+
+00000000008022c0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva) {
+  8022c0:	55                   	push   %rbp
+  8022c1:	48 89 e5             	mov    %rsp,%rbp
+  8022c4:	48 83 ec 10          	sub    $0x10,%rsp
+  8022c8:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return syscall(SYS_ipc_recv, 1, (uint64_t)dstva, 0, 0, 0, 0);
+  8022cc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8022d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8022d4:	6a 00                	push   $0x0
+  8022d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8022dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e7:	48 89 c2             	mov    %rax,%rdx
+  8022ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8022ef:	bf 0f 00 00 00       	mov    $0xf,%edi
+  8022f4:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+  802300:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+
+0000000000802306 <sys_ipc_recv_timeout>:
+
+int
+sys_ipc_recv_timeout(void *dstva, uint64_t timeout) {
+  802306:	55                   	push   %rbp
+  802307:	48 89 e5             	mov    %rsp,%rbp
+  80230a:	48 83 ec 10          	sub    $0x10,%rsp
+  80230e:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802312:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_ipc_recv_timeout, 1, (uint64_t)dstva, timeout, 0, 0, 0);
+  802316:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80231a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80231e:	48 83 ec 08          	sub    $0x8,%rsp
+  802322:	6a 00                	push   $0x0
+  802324:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80232a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802330:	48 89 d1             	mov    %rdx,%rcx
+  802333:	48 89 c2             	mov    %rax,%rdx
+  802336:	be 01 00 00 00       	mov    $0x1,%esi
+  80233b:	bf 10 00 00 00       	mov    $0x10,%edi
+  802340:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802347:	00 00 00 
+  80234a:	ff d0                	call   *%rax
+  80234c:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802350:	c9                   	leave
+  802351:	c3                   	ret
+
+0000000000802352 <sys_gettime>:
+
+int
+sys_gettime(void) {
+  802352:	55                   	push   %rbp
+  802353:	48 89 e5             	mov    %rsp,%rbp
+  return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0);
+  802356:	48 83 ec 08          	sub    $0x8,%rsp
+  80235a:	6a 00                	push   $0x0
+  80235c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802362:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802368:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80236d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802372:	be 00 00 00 00       	mov    $0x0,%esi
+  802377:	bf 11 00 00 00       	mov    $0x11,%edi
+  80237c:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802383:	00 00 00 
+  802386:	ff d0                	call   *%rax
+  802388:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80238c:	c9                   	leave
+  80238d:	c3                   	ret
+
+000000000080238e <sys_klog_read>:
+
+int
+sys_klog_read(char *buf, size_t len) {
+  80238e:	55                   	push   %rbp
+  80238f:	48 89 e5             	mov    %rsp,%rbp
+  802392:	48 83 ec 10          	sub    $0x10,%rsp
+  802396:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80239a:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  return syscall(SYS_klog_read, 0, (uint64_t)buf, len, 0, 0, 0);
+  80239e:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8023aa:	6a 00                	push   $0x0
+  8023ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8023b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023b8:	48 89 d1             	mov    %rdx,%rcx
+  8023bb:	48 89 c2             	mov    %rax,%rdx
+  8023be:	be 00 00 00 00       	mov    $0x0,%esi
+  8023c3:	bf 12 00 00 00       	mov    $0x12,%edi
+  8023c8:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  8023cf:	00 00 00 
+  8023d2:	ff d0                	call   *%rax
+  8023d4:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8023d8:	c9                   	leave
+  8023d9:	c3                   	ret
+
+00000000008023da <sys_cons_read>:
+
+int
+sys_cons_read(char *buf, size_t len, int mode) {
+  8023da:	55                   	push   %rbp
+  8023db:	48 89 e5             	mov    %rsp,%rbp
+  8023de:	48 83 ec 20          	sub    $0x20,%rsp
+  8023e2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8023e6:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  8023ea:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_cons_read, 0, (uint64_t)buf, len, mode, 0, 0);
+  8023ed:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8023f0:	48 63 c8             	movslq %eax,%rcx
+  8023f3:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  8023f7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8023fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8023ff:	6a 00                	push   $0x0
+  802401:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802407:	49 89 c8             	mov    %rcx,%r8
+  80240a:	48 89 d1             	mov    %rdx,%rcx
+  80240d:	48 89 c2             	mov    %rax,%rdx
+  802410:	be 00 00 00 00       	mov    $0x0,%esi
+  802415:	bf 13 00 00 00       	mov    $0x13,%edi
+  80241a:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802421:	00 00 00 
+  802424:	ff d0                	call   *%rax
+  802426:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80242a:	c9                   	leave
+  80242b:	c3                   	ret
+
+000000000080242c <sys_futex_wait>:
+
+int
+sys_futex_wait(volatile uint32_t *addr, uint32_t expected, uint64_t timeout) {
+  80242c:	55                   	push   %rbp
+  80242d:	48 89 e5             	mov    %rsp,%rbp
+  802430:	48 83 ec 20          	sub    $0x20,%rsp
+  802434:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802438:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  80243b:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_futex_wait, 0, (uint64_t)addr, expected, timeout, 0, 0);
+  80243f:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  802443:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  802446:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80244a:	48 83 ec 08          	sub    $0x8,%rsp
+  80244e:	6a 00                	push   $0x0
+  802450:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802456:	49 89 c8             	mov    %rcx,%r8
+  802459:	48 89 d1             	mov    %rdx,%rcx
+  80245c:	48 89 c2             	mov    %rax,%rdx
+  80245f:	be 00 00 00 00       	mov    $0x0,%esi
+  802464:	bf 14 00 00 00       	mov    $0x14,%edi
+  802469:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802470:	00 00 00 
+  802473:	ff d0                	call   *%rax
+  802475:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+
+000000000080247b <sys_futex_wake>:
+
+int
+sys_futex_wake(volatile uint32_t *addr, int n) {
+  80247b:	55                   	push   %rbp
+  80247c:	48 89 e5             	mov    %rsp,%rbp
+  80247f:	48 83 ec 10          	sub    $0x10,%rsp
+  802483:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  802487:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  return syscall(SYS_futex_wake, 0, (uint64_t)addr, n, 0, 0, 0);
+  80248a:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80248d:	48 63 d0             	movslq %eax,%rdx
+  802490:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802494:	48 83 ec 08          	sub    $0x8,%rsp
+  802498:	6a 00                	push   $0x0
+  80249a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8024a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8024a6:	48 89 d1             	mov    %rdx,%rcx
+  8024a9:	48 89 c2             	mov    %rax,%rdx
+  8024ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b1:	bf 15 00 00 00       	mov    $0x15,%edi
+  8024b6:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  8024bd:	00 00 00 
+  8024c0:	ff d0                	call   *%rax
+  8024c2:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8024c6:	c9                   	leave
+  8024c7:	c3                   	ret
+
+00000000008024c8 <sys_poll_wait>:
+
+int
+sys_poll_wait(const struct PollKey *keys, int n, int flags, uint64_t timeout) {
+  8024c8:	55                   	push   %rbp
+  8024c9:	48 89 e5             	mov    %rsp,%rbp
+  8024cc:	48 83 ec 20          	sub    $0x20,%rsp
+  8024d0:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8024d4:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  8024d7:	89 55 f0             	mov    %edx,-0x10(%rbp)
+  8024da:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  return syscall(SYS_poll_wait, 0, (uint64_t)keys, n, flags, timeout, 0);
+  8024de:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  8024e2:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8024e5:	48 63 c8             	movslq %eax,%rcx
+  8024e8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8024eb:	48 63 d0             	movslq %eax,%rdx
+  8024ee:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8024f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024f6:	6a 00                	push   $0x0
+  8024f8:	49 89 f1             	mov    %rsi,%r9
+  8024fb:	49 89 c8             	mov    %rcx,%r8
+  8024fe:	48 89 d1             	mov    %rdx,%rcx
+  802501:	48 89 c2             	mov    %rax,%rdx
+  802504:	be 00 00 00 00       	mov    $0x0,%esi
+  802509:	bf 16 00 00 00       	mov    $0x16,%edi
+  80250e:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802515:	00 00 00 
+  802518:	ff d0                	call   *%rax
+  80251a:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80251e:	c9                   	leave
+  80251f:	c3                   	ret
+
+0000000000802520 <sys_thread_create>:
+
+envid_t
+sys_thread_create(uintptr_t rip, uintptr_t rsp, uintptr_t uxstacktop,
+                  uintptr_t arg0, uintptr_t arg1) {
+  802520:	55                   	push   %rbp
+  802521:	48 89 e5             	mov    %rsp,%rbp
+  802524:	48 83 ec 30          	sub    $0x30,%rsp
+  802528:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80252c:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802530:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  802534:	48 89 4d e0          	mov    %rcx,-0x20(%rbp)
+  802538:	4c 89 45 d8          	mov    %r8,-0x28(%rbp)
+  return syscall(SYS_thread_create, 0, rip, rsp, uxstacktop, arg0, arg1);
+  80253c:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  802540:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  802544:	48 8b 75 e8          	mov    -0x18(%rbp),%rsi
+  802548:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80254c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802550:	48 83 ec 08          	sub    $0x8,%rsp
+  802554:	51                   	push   %rcx
+  802555:	49 89 f9             	mov    %rdi,%r9
+  802558:	49 89 f0             	mov    %rsi,%r8
+  80255b:	48 89 d1             	mov    %rdx,%rcx
+  80255e:	48 89 c2             	mov    %rax,%rdx
+  802561:	be 00 00 00 00       	mov    $0x0,%esi
+  802566:	bf 17 00 00 00       	mov    $0x17,%edi
+  80256b:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802572:	00 00 00 
+  802575:	ff d0                	call   *%rax
+  802577:	48 83 c4 10          	add    $0x10,%rsp
+}
+  80257b:	c9                   	leave
+  80257c:	c3                   	ret
+
+000000000080257d <sys_thread_exit>:
+
+void
+sys_thread_exit(int status) {
+  80257d:	55                   	push   %rbp
+  80257e:	48 89 e5             	mov    %rsp,%rbp
+  802581:	48 83 ec 10          	sub    $0x10,%rsp
+  802585:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  syscall(SYS_thread_exit, 0, status, 0, 0, 0, 0);
+  802588:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80258b:	48 98                	cltq
+  80258d:	48 83 ec 08          	sub    $0x8,%rsp
+  802591:	6a 00                	push   $0x0
+  802593:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  802599:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80259f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a4:	48 89 c2             	mov    %rax,%rdx
+  8025a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8025ac:	bf 18 00 00 00       	mov    $0x18,%edi
+  8025b1:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  8025b8:	00 00 00 
+  8025bb:	ff d0                	call   *%rax
+  8025bd:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8025c1:	90                   	nop
+  8025c2:	c9                   	leave
+  8025c3:	c3                   	ret
+
+00000000008025c4 <sys_page_alloc_range>:
+
+int
+sys_page_alloc_range(envid_t envid, void *va, size_t npages, int perm) {
+  8025c4:	55                   	push   %rbp
+  8025c5:	48 89 e5             	mov    %rsp,%rbp
+  8025c8:	48 83 ec 30          	sub    $0x30,%rsp
+  8025cc:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8025cf:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8025d3:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  8025d7:	89 4d e8             	mov    %ecx,-0x18(%rbp)
+  int r = syscall(SYS_page_alloc_range, 1, envid, (uint64_t)va, npages, perm, 0);
+  8025da:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  8025dd:	48 63 f0             	movslq %eax,%rsi
+  8025e0:	48 8b 4d d8          	mov    -0x28(%rbp),%rcx
+  8025e4:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8025e8:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8025eb:	48 98                	cltq
+  8025ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8025f1:	6a 00                	push   $0x0
+  8025f3:	49 89 f1             	mov    %rsi,%r9
+  8025f6:	49 89 c8             	mov    %rcx,%r8
+  8025f9:	48 89 d1             	mov    %rdx,%rcx
+  8025fc:	48 89 c2             	mov    %rax,%rdx
+  8025ff:	be 01 00 00 00       	mov    $0x1,%esi
+  802604:	bf 19 00 00 00       	mov    $0x19,%edi
+  802609:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802610:	00 00 00 
+  802613:	ff d0                	call   *%rax
+  802615:	48 83 c4 10          	add    $0x10,%rsp
+  802619:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80261c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80261f:	c9                   	leave
+  802620:	c3                   	ret
+
+0000000000802621 <sys_page_clear_bits>:
+
+int
+sys_page_clear_bits(void *va, size_t npages, int bits) {
+  802621:	55                   	push   %rbp
+  802622:	48 89 e5             	mov    %rsp,%rbp
+  802625:	48 83 ec 20          	sub    $0x20,%rsp
+  802629:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80262d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802631:	89 55 ec             	mov    %edx,-0x14(%rbp)
+  return syscall(SYS_page_clear_bits, 1, (uint64_t)va, npages, bits, 0, 0);
+  802634:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802637:	48 63 c8             	movslq %eax,%rcx
+  80263a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80263e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802642:	48 83 ec 08          	sub    $0x8,%rsp
+  802646:	6a 00                	push   $0x0
+  802648:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80264e:	49 89 c8             	mov    %rcx,%r8
+  802651:	48 89 d1             	mov    %rdx,%rcx
+  802654:	48 89 c2             	mov    %rax,%rdx
+  802657:	be 01 00 00 00       	mov    $0x1,%esi
+  80265c:	bf 1a 00 00 00       	mov    $0x1a,%edi
+  802661:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802668:	00 00 00 
+  80266b:	ff d0                	call   *%rax
+  80266d:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802671:	c9                   	leave
+  802672:	c3                   	ret
+
+0000000000802673 <sys_page_phys>:
+
+int
+sys_page_phys(void *va, size_t npages, physaddr_t *pa) {
+  802673:	55                   	push   %rbp
+  802674:	48 89 e5             	mov    %rsp,%rbp
+  802677:	48 83 ec 20          	sub    $0x20,%rsp
+  80267b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  80267f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  802683:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return syscall(SYS_page_phys, 1, (uint64_t)va, npages, (uint64_t)pa, 0, 0);
+  802687:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80268b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80268f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802693:	48 83 ec 08          	sub    $0x8,%rsp
+  802697:	6a 00                	push   $0x0
+  802699:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80269f:	49 89 c8             	mov    %rcx,%r8
+  8026a2:	48 89 d1             	mov    %rdx,%rcx
+  8026a5:	48 89 c2             	mov    %rax,%rdx
+  8026a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8026ad:	bf 1b 00 00 00       	mov    $0x1b,%edi
+  8026b2:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  8026b9:	00 00 00 
+  8026bc:	ff d0                	call   *%rax
+  8026be:	48 83 c4 10          	add    $0x10,%rsp
+}
+  8026c2:	c9                   	leave
+  8026c3:	c3                   	ret
+
+00000000008026c4 <sys_page_alloc_dma>:
+
+int
+sys_page_alloc_dma(void *va, size_t npages, int perm, physaddr_t *pa) {
+  8026c4:	55                   	push   %rbp
+  8026c5:	48 89 e5             	mov    %rsp,%rbp
+  8026c8:	48 83 ec 30          	sub    $0x30,%rsp
+  8026cc:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8026d0:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  8026d4:	89 55 dc             	mov    %edx,-0x24(%rbp)
+  8026d7:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  int r = syscall(SYS_page_alloc_dma, 1, (uint64_t)va, npages, perm, (uint64_t)pa, 0);
+  8026db:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8026df:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8026e2:	48 63 c8             	movslq %eax,%rcx
+  8026e5:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8026e9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8026ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8026f1:	6a 00                	push   $0x0
+  8026f3:	49 89 f1             	mov    %rsi,%r9
+  8026f6:	49 89 c8             	mov    %rcx,%r8
+  8026f9:	48 89 d1             	mov    %rdx,%rcx
+  8026fc:	48 89 c2             	mov    %rax,%rdx
+  8026ff:	be 01 00 00 00       	mov    $0x1,%esi
+  802704:	bf 1c 00 00 00       	mov    $0x1c,%edi
+  802709:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+  802715:	48 83 c4 10          	add    $0x10,%rsp
+  802719:	89 45 fc             	mov    %eax,-0x4(%rbp)
+#ifdef SANITIZE_USER_SHADOW_BASE
+  if (!r)
+    platform_asan_unpoison(va, npages * PGSIZE);
+#endif
+  return r;
+  80271c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  80271f:	c9                   	leave
+  802720:	c3                   	ret
+
+0000000000802721 <sys_disk_irq>:
+
+int
+sys_disk_irq(int irq) {
+  802721:	55                   	push   %rbp
+  802722:	48 89 e5             	mov    %rsp,%rbp
+  802725:	48 83 ec 10          	sub    $0x10,%rsp
+  802729:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  return syscall(SYS_disk_irq, 1, irq, 0, 0, 0, 0);
+  80272c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80272f:	48 98                	cltq
+  802731:	48 83 ec 08          	sub    $0x8,%rsp
+  802735:	6a 00                	push   $0x0
+  802737:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80273d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802743:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802748:	48 89 c2             	mov    %rax,%rdx
+  80274b:	be 01 00 00 00       	mov    $0x1,%esi
+  802750:	bf 1d 00 00 00       	mov    $0x1d,%edi
+  802755:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  80275c:	00 00 00 
+  80275f:	ff d0                	call   *%rax
+  802761:	48 83 c4 10          	add    $0x10,%rsp
+}
+  802765:	c9                   	leave
+  802766:	c3                   	ret
+
+0000000000802767 <fd2num>:
+// --------------------------------------------------------------
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+uint64_t
+fd2num(struct Fd *fd) {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+  80276b:	48 83 ec 08          	sub    $0x8,%rsp
+  80276f:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802773:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802777:	48 ba 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdx
+  80277e:	ff ff ff 
+  802781:	48 01 d0             	add    %rdx,%rax
+  802784:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802788:	c9                   	leave
+  802789:	c3                   	ret
+
+000000000080278a <fd2data>:
+
+char *
+fd2data(struct Fd *fd) {
+  80278a:	55                   	push   %rbp
+  80278b:	48 89 e5             	mov    %rsp,%rbp
+  80278e:	48 83 ec 08          	sub    $0x8,%rsp
+  802792:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return INDEX2DATA(fd2num(fd));
+  802796:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80279a:	48 89 c7             	mov    %rax,%rdi
+  80279d:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  8027a4:	00 00 00 
+  8027a7:	ff d0                	call   *%rax
+  8027a9:	48 05 01 68 00 00    	add    $0x6801,%rax
+  8027af:	48 c1 e0 11          	shl    $0x11,%rax
+}
+  8027b3:	c9                   	leave
+  8027b4:	c3                   	ret
+
+00000000008027b5 <fd_alloc>:
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store) {
+  8027b5:	55                   	push   %rbp
+  8027b6:	48 89 e5             	mov    %rsp,%rbp
+  8027b9:	48 83 ec 18          	sub    $0x18,%rsp
+  8027bd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8027c1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  8027c8:	e9 ae 00 00 00       	jmp    80287b <fd_alloc+0xc6>
+    fd = INDEX2FD(i);
+  8027cd:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8027d0:	c1 e0 0c             	shl    $0xc,%eax
+  8027d3:	48 98                	cltq
+  8027d5:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8027da:	48 01 d0             	add    %rdx,%rax
+  8027dd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    if ((uvpml4e[VPML4E(fd)] & PTE_P) == 0 || (uvpde[VPDPE(fd)] & PTE_P) == 0 || (uvpd[VPD(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8027e1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8027e5:	48 c1 e8 27          	shr    $0x27,%rax
+  8027e9:	48 89 c2             	mov    %rax,%rdx
+  8027ec:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8027f3:	01 00 00 
+  8027f6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8027fa:	83 e0 01             	and    $0x1,%eax
+  8027fd:	48 85 c0             	test   %rax,%rax
+  802800:	74 63                	je     802865 <fd_alloc+0xb0>
+  802802:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802806:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80280a:	48 89 c2             	mov    %rax,%rdx
+  80280d:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802814:	01 00 00 
+  802817:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80281b:	83 e0 01             	and    $0x1,%eax
+  80281e:	48 85 c0             	test   %rax,%rax
+  802821:	74 42                	je     802865 <fd_alloc+0xb0>
+  802823:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802827:	48 c1 e8 15          	shr    $0x15,%rax
+  80282b:	48 89 c2             	mov    %rax,%rdx
+  80282e:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802835:	01 00 00 
+  802838:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80283c:	83 e0 01             	and    $0x1,%eax
+  80283f:	48 85 c0             	test   %rax,%rax
+  802842:	74 21                	je     802865 <fd_alloc+0xb0>
+  802844:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802848:	48 c1 e8 0c          	shr    $0xc,%rax
+  80284c:	48 89 c2             	mov    %rax,%rdx
+  80284f:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802856:	01 00 00 
+  802859:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80285d:	83 e0 01             	and    $0x1,%eax
+  802860:	48 85 c0             	test   %rax,%rax
+  802863:	75 12                	jne    802877 <fd_alloc+0xc2>
+      *fd_store = fd;
+  802865:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802869:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80286d:	48 89 10             	mov    %rdx,(%rax)
+#ifdef SANITIZE_USER_SHADOW_BASE
+      platform_asan_unpoison(fd, PGSIZE);
+#endif
+      return 0;
+  802870:	b8 00 00 00 00       	mov    $0x0,%eax
+  802875:	eb 1e                	jmp    802895 <fd_alloc+0xe0>
+  for (i = 0; i < MAXFD; i++) {
+  802877:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  80287b:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  80287f:	0f 8e 48 ff ff ff    	jle    8027cd <fd_alloc+0x18>
+    }
+  }
+  *fd_store = 0;
+  802885:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802889:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_MAX_OPEN;
+  802890:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+}
+  802895:	c9                   	leave
+  802896:	c3                   	ret
+
+0000000000802897 <fd_lookup>:
+//
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802897:	55                   	push   %rbp
+  802898:	48 89 e5             	mov    %rsp,%rbp
+  80289b:	48 83 ec 20          	sub    $0x20,%rsp
+  80289f:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8028a2:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8028a6:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8028aa:	78 06                	js     8028b2 <fd_lookup+0x1b>
+  8028ac:	83 7d ec 1f          	cmpl   $0x1f,-0x14(%rbp)
+  8028b0:	7e 0a                	jle    8028bc <fd_lookup+0x25>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  8028b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b7:	e9 af 00 00 00       	jmp    80296b <fd_lookup+0xd4>
+  }
+  fd = INDEX2FD(fdnum);
+  8028bc:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8028bf:	c1 e0 0c             	shl    $0xc,%eax
+  8028c2:	48 98                	cltq
+  8028c4:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  8028c9:	48 01 d0             	add    %rdx,%rax
+  8028cc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(uvpml4e[VPML4E(fd)] & PTE_P) || !(uvpde[VPDPE(fd)] & PTE_P) || !(uvpd[VPD(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8028d0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028d4:	48 c1 e8 27          	shr    $0x27,%rax
+  8028d8:	48 89 c2             	mov    %rax,%rdx
+  8028db:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  8028e2:	01 00 00 
+  8028e5:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  8028e9:	83 e0 01             	and    $0x1,%eax
+  8028ec:	48 85 c0             	test   %rax,%rax
+  8028ef:	74 63                	je     802954 <fd_lookup+0xbd>
+  8028f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8028f5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8028f9:	48 89 c2             	mov    %rax,%rdx
+  8028fc:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802903:	01 00 00 
+  802906:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80290a:	83 e0 01             	and    $0x1,%eax
+  80290d:	48 85 c0             	test   %rax,%rax
+  802910:	74 42                	je     802954 <fd_lookup+0xbd>
+  802912:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802916:	48 c1 e8 15          	shr    $0x15,%rax
+  80291a:	48 89 c2             	mov    %rax,%rdx
+  80291d:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802924:	01 00 00 
+  802927:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80292b:	83 e0 01             	and    $0x1,%eax
+  80292e:	48 85 c0             	test   %rax,%rax
+  802931:	74 21                	je     802954 <fd_lookup+0xbd>
+  802933:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802937:	48 c1 e8 0c          	shr    $0xc,%rax
+  80293b:	48 89 c2             	mov    %rax,%rdx
+  80293e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802945:	01 00 00 
+  802948:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80294c:	83 e0 01             	and    $0x1,%eax
+  80294f:	48 85 c0             	test   %rax,%rax
+  802952:	75 07                	jne    80295b <fd_lookup+0xc4>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  802954:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802959:	eb 10                	jmp    80296b <fd_lookup+0xd4>
+  }
+  *fd_store = fd;
+  80295b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80295f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802963:	48 89 10             	mov    %rdx,(%rax)
+  return 0;
+  802966:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80296b:	c9                   	leave
+  80296c:	c3                   	ret
+
+000000000080296d <fd_close>:
+// descriptor; the function will return 0 and have no other effect.
+// If 'must_exist' is 1, then fd_close returns -E_INVAL when passed a
+// closed or nonexistent file descriptor.
+// Returns 0 on success, < 0 on error.
+int
+fd_close(struct Fd *fd, bool must_exist) {
+  80296d:	55                   	push   %rbp
+  80296e:	48 89 e5             	mov    %rsp,%rbp
+  802971:	48 83 ec 30          	sub    $0x30,%rsp
+  802975:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  802979:	89 f0                	mov    %esi,%eax
+  80297b:	88 45 d4             	mov    %al,-0x2c(%rbp)
+  struct Fd *fd2;
+  struct Dev *dev;
+  int r;
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2)
+  80297e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802982:	48 89 c7             	mov    %rax,%rdi
+  802985:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+  802991:	89 c2                	mov    %eax,%edx
+  802993:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  802997:	48 89 c6             	mov    %rax,%rsi
+  80299a:	89 d7                	mov    %edx,%edi
+  80299c:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  8029a3:	00 00 00 
+  8029a6:	ff d0                	call   *%rax
+  8029a8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8029ab:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8029af:	78 0a                	js     8029bb <fd_close+0x4e>
+  8029b1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8029b5:	48 39 45 d8          	cmp    %rax,-0x28(%rbp)
+  8029b9:	74 12                	je     8029cd <fd_close+0x60>
+    return (must_exist ? r : 0);
+  8029bb:	80 7d d4 00          	cmpb   $0x0,-0x2c(%rbp)
+  8029bf:	74 05                	je     8029c6 <fd_close+0x59>
+  8029c1:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8029c4:	eb 70                	jmp    802a36 <fd_close+0xc9>
+  8029c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029cb:	eb 69                	jmp    802a36 <fd_close+0xc9>
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8029cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029d1:	8b 00                	mov    (%rax),%eax
+  8029d3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8029d7:	48 89 d6             	mov    %rdx,%rsi
+  8029da:	89 c7                	mov    %eax,%edi
+  8029dc:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+  8029e8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8029eb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8029ef:	78 2a                	js     802a1b <fd_close+0xae>
+    if (dev->dev_close)
+  8029f1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8029f5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8029f9:	48 85 c0             	test   %rax,%rax
+  8029fc:	74 16                	je     802a14 <fd_close+0xa7>
+      r = (*dev->dev_close)(fd);
+  8029fe:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802a02:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802a06:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a0a:	48 89 c7             	mov    %rax,%rdi
+  802a0d:	ff d2                	call   *%rdx
+  802a0f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802a12:	eb 07                	jmp    802a1b <fd_close+0xae>
+    else
+      r = 0;
+  802a14:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  }
+  // Make sure fd is unmapped.  Might be a no-op if
+  // (*dev->dev_close)(fd) already unmapped it.
+  (void)sys_page_unmap(0, fd);
+  802a1b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a1f:	48 89 c6             	mov    %rax,%rsi
+  802a22:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a27:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  802a2e:	00 00 00 
+  802a31:	ff d0                	call   *%rax
+  return r;
+  802a33:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802a36:	c9                   	leave
+  802a37:	c3                   	ret
+
+0000000000802a38 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        0};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802a38:	55                   	push   %rbp
+  802a39:	48 89 e5             	mov    %rsp,%rbp
+  802a3c:	48 83 ec 20          	sub    $0x20,%rsp
+  802a40:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802a43:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int i;
+  for (i = 0; devtab[i]; i++)
+  802a47:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802a4e:	eb 3f                	jmp    802a8f <dev_lookup+0x57>
+    if (devtab[i]->dev_id == dev_id) {
+  802a50:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a57:	00 00 00 
+  802a5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a5d:	48 98                	cltq
+  802a5f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802a63:	8b 00                	mov    (%rax),%eax
+  802a65:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  802a68:	75 21                	jne    802a8b <dev_lookup+0x53>
+      *dev = devtab[i];
+  802a6a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a71:	00 00 00 
+  802a74:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a77:	48 98                	cltq
+  802a79:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802a7d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a81:	48 89 10             	mov    %rdx,(%rax)
+      return 0;
+  802a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a89:	eb 7f                	jmp    802b0a <dev_lookup+0xd2>
+  for (i = 0; devtab[i]; i++)
+  802a8b:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802a8f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  802a96:	00 00 00 
+  802a99:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802a9c:	48 98                	cltq
+  802a9e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802aa2:	48 85 c0             	test   %rax,%rax
+  802aa5:	75 a9                	jne    802a50 <dev_lookup+0x18>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802aa7:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802aae:	00 00 00 
+  802ab1:	8b 40 04             	mov    0x4(%rax),%eax
+  802ab4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ab9:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802ac0:	00 00 00 
+  802ac3:	48 98                	cltq
+  802ac5:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802acc:	48 01 d0             	add    %rdx,%rax
+  802acf:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802ad5:	8b 00                	mov    (%rax),%eax
+  802ad7:	8b 55 ec             	mov    -0x14(%rbp),%edx
+  802ada:	89 c6                	mov    %eax,%esi
+  802adc:	48 b8 78 56 80 00 00 	movabs $0x805678,%rax
+  802ae3:	00 00 00 
+  802ae6:	48 89 c7             	mov    %rax,%rdi
+  802ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aee:	48 b9 02 03 80 00 00 	movabs $0x800302,%rcx
+  802af5:	00 00 00 
+  802af8:	ff d1                	call   *%rcx
+  *dev = 0;
+  802afa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802afe:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  return -E_INVAL;
+  802b05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802b0a:	c9                   	leave
+  802b0b:	c3                   	ret
+
+0000000000802b0c <close>:
+
+int
+close(int fdnum) {
+  802b0c:	55                   	push   %rbp
+  802b0d:	48 89 e5             	mov    %rsp,%rbp
+  802b10:	48 83 ec 20          	sub    $0x20,%rsp
+  802b14:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b17:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802b1b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802b1e:	48 89 d6             	mov    %rdx,%rsi
+  802b21:	89 c7                	mov    %eax,%edi
+  802b23:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  802b2a:	00 00 00 
+  802b2d:	ff d0                	call   *%rax
+  802b2f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802b32:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802b36:	79 05                	jns    802b3d <close+0x31>
+    return r;
+  802b38:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b3b:	eb 18                	jmp    802b55 <close+0x49>
+  else
+    return fd_close(fd, 1);
+  802b3d:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802b41:	be 01 00 00 00       	mov    $0x1,%esi
+  802b46:	48 89 c7             	mov    %rax,%rdi
+  802b49:	48 b8 6d 29 80 00 00 	movabs $0x80296d,%rax
+  802b50:	00 00 00 
+  802b53:	ff d0                	call   *%rax
+}
+  802b55:	c9                   	leave
+  802b56:	c3                   	ret
+
+0000000000802b57 <close_all>:
+
+void
+close_all(void) {
+  802b57:	55                   	push   %rbp
+  802b58:	48 89 e5             	mov    %rsp,%rbp
+  802b5b:	48 83 ec 10          	sub    $0x10,%rsp
+  int i;
+  for (i = 0; i < MAXFD; i++)
+  802b5f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802b66:	eb 15                	jmp    802b7d <close_all+0x26>
+    close(i);
+  802b68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802b6b:	89 c7                	mov    %eax,%edi
+  802b6d:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  802b74:	00 00 00 
+  802b77:	ff d0                	call   *%rax
+  for (i = 0; i < MAXFD; i++)
+  802b79:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  802b7d:	83 7d fc 1f          	cmpl   $0x1f,-0x4(%rbp)
+  802b81:	7e e5                	jle    802b68 <close_all+0x11>
+}
+  802b83:	90                   	nop
+  802b84:	90                   	nop
+  802b85:	c9                   	leave
+  802b86:	c3                   	ret
+
+0000000000802b87 <dup>:
+// For instance, writing onto either file descriptor will affect the
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum) {
+  802b87:	55                   	push   %rbp
+  802b88:	48 89 e5             	mov    %rsp,%rbp
+  802b8b:	48 83 ec 40          	sub    $0x40,%rsp
+  802b8f:	89 7d cc             	mov    %edi,-0x34(%rbp)
+  802b92:	89 75 c8             	mov    %esi,-0x38(%rbp)
+  int r;
+  size_t off;
+  char *ova, *nva;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  802b95:	48 8d 55 d0          	lea    -0x30(%rbp),%rdx
+  802b99:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  802b9c:	48 89 d6             	mov    %rdx,%rsi
+  802b9f:	89 c7                	mov    %eax,%edi
+  802ba1:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  802ba8:	00 00 00 
+  802bab:	ff d0                	call   *%rax
+  802bad:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802bb0:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802bb4:	79 08                	jns    802bbe <dup+0x37>
+    return r;
+  802bb6:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802bb9:	e9 33 02 00 00       	jmp    802df1 <dup+0x26a>
+  close(newfdnum);
+  802bbe:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802bc1:	89 c7                	mov    %eax,%edi
+  802bc3:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+
+  newfd = INDEX2FD(newfdnum);
+  802bcf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802bd2:	c1 e0 0c             	shl    $0xc,%eax
+  802bd5:	48 98                	cltq
+  802bd7:	ba 00 00 00 d0       	mov    $0xd0000000,%edx
+  802bdc:	48 01 d0             	add    %rdx,%rax
+  802bdf:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  ova   = fd2data(oldfd);
+  802be3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802be7:	48 89 c7             	mov    %rax,%rdi
+  802bea:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+  802bf6:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  nva   = fd2data(newfd);
+  802bfa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802bfe:	48 89 c7             	mov    %rax,%rdi
+  802c01:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  802c08:	00 00 00 
+  802c0b:	ff d0                	call   *%rax
+  802c0d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  // Map the data before the fd, first data page last,
+  // so that pageref(fd) never exceeds pageref(data).
+  for (off = FDDATASIZE; off > 0;) {
+  802c11:	48 c7 45 f0 00 00 02 	movq   $0x20000,-0x10(%rbp)
+  802c18:	00 
+  802c19:	e9 19 01 00 00       	jmp    802d37 <dup+0x1b0>
+    off -= PGSIZE;
+  802c1e:	48 81 6d f0 00 10 00 	subq   $0x1000,-0x10(%rbp)
+  802c25:	00 
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802c26:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c2a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c2e:	48 01 d0             	add    %rdx,%rax
+  802c31:	48 c1 e8 27          	shr    $0x27,%rax
+  802c35:	48 89 c2             	mov    %rax,%rdx
+  802c38:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  802c3f:	01 00 00 
+  802c42:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c46:	83 e0 01             	and    $0x1,%eax
+  802c49:	48 85 c0             	test   %rax,%rax
+  802c4c:	0f 84 e5 00 00 00    	je     802d37 <dup+0x1b0>
+  802c52:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c56:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c5a:	48 01 d0             	add    %rdx,%rax
+  802c5d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802c61:	48 89 c2             	mov    %rax,%rdx
+  802c64:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  802c6b:	01 00 00 
+  802c6e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c72:	83 e0 01             	and    $0x1,%eax
+  802c75:	48 85 c0             	test   %rax,%rax
+  802c78:	0f 84 b9 00 00 00    	je     802d37 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802c7e:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802c82:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802c86:	48 01 d0             	add    %rdx,%rax
+  802c89:	48 c1 e8 15          	shr    $0x15,%rax
+  802c8d:	48 89 c2             	mov    %rax,%rdx
+  802c90:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  802c97:	01 00 00 
+  802c9a:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802c9e:	83 e0 01             	and    $0x1,%eax
+    if ((uvpml4e[VPML4E(ova + off)] & PTE_P) && (uvpde[VPDPE(ova + off)] & PTE_P) &&
+  802ca1:	48 85 c0             	test   %rax,%rax
+  802ca4:	0f 84 8d 00 00 00    	je     802d37 <dup+0x1b0>
+        (uvpd[VPD(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  802caa:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802cae:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cb2:	48 01 d0             	add    %rdx,%rax
+  802cb5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802cb9:	48 89 c2             	mov    %rax,%rdx
+  802cbc:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802cc3:	01 00 00 
+  802cc6:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cca:	83 e0 01             	and    $0x1,%eax
+  802ccd:	48 85 c0             	test   %rax,%rax
+  802cd0:	74 65                	je     802d37 <dup+0x1b0>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off, uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  802cd2:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  802cd6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802cda:	48 01 d0             	add    %rdx,%rax
+  802cdd:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ce1:	48 89 c2             	mov    %rax,%rdx
+  802ce4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802ceb:	01 00 00 
+  802cee:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802cf2:	25 07 0e 00 00       	and    $0xe07,%eax
+  802cf7:	89 c6                	mov    %eax,%esi
+  802cf9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802cfd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d01:	48 01 c2             	add    %rax,%rdx
+  802d04:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  802d08:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802d0c:	48 01 c8             	add    %rcx,%rax
+  802d0f:	41 89 f0             	mov    %esi,%r8d
+  802d12:	48 89 d1             	mov    %rdx,%rcx
+  802d15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d1a:	48 89 c6             	mov    %rax,%rsi
+  802d1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d22:	48 b8 d8 20 80 00 00 	movabs $0x8020d8,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+  802d2e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d31:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d35:	78 60                	js     802d97 <dup+0x210>
+  for (off = FDDATASIZE; off > 0;) {
+  802d37:	48 83 7d f0 00       	cmpq   $0x0,-0x10(%rbp)
+  802d3c:	0f 85 dc fe ff ff    	jne    802c1e <dup+0x97>
+        goto err;
+  }
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802d42:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d46:	48 c1 e8 0c          	shr    $0xc,%rax
+  802d4a:	48 89 c2             	mov    %rax,%rdx
+  802d4d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802d54:	01 00 00 
+  802d57:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  802d5b:	25 07 0e 00 00       	and    $0xe07,%eax
+  802d60:	89 c1                	mov    %eax,%ecx
+  802d62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802d66:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  802d6a:	41 89 c8             	mov    %ecx,%r8d
+  802d6d:	48 89 d1             	mov    %rdx,%rcx
+  802d70:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d75:	48 89 c6             	mov    %rax,%rsi
+  802d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d7d:	48 b8 d8 20 80 00 00 	movabs $0x8020d8,%rax
+  802d84:	00 00 00 
+  802d87:	ff d0                	call   *%rax
+  802d89:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802d8c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802d90:	78 08                	js     802d9a <dup+0x213>
+    goto err;
+
+  return newfdnum;
+  802d92:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802d95:	eb 5a                	jmp    802df1 <dup+0x26a>
+        goto err;
+  802d97:	90                   	nop
+  802d98:	eb 01                	jmp    802d9b <dup+0x214>
+    goto err;
+  802d9a:	90                   	nop
+
+err:
+  sys_page_unmap(0, newfd);
+  802d9b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802d9f:	48 89 c6             	mov    %rax,%rsi
+  802da2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802da7:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  802dae:	00 00 00 
+  802db1:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802db3:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  802dba:	00 
+  802dbb:	eb 27                	jmp    802de4 <dup+0x25d>
+    sys_page_unmap(0, nva + off);
+  802dbd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802dc1:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802dc5:	48 01 d0             	add    %rdx,%rax
+  802dc8:	48 89 c6             	mov    %rax,%rsi
+  802dcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd0:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802ddc:	48 81 45 f0 00 10 00 	addq   $0x1000,-0x10(%rbp)
+  802de3:	00 
+  802de4:	48 81 7d f0 ff ff 01 	cmpq   $0x1ffff,-0x10(%rbp)
+  802deb:	00 
+  802dec:	76 cf                	jbe    802dbd <dup+0x236>
+  return r;
+  802dee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  802df1:	c9                   	leave
+  802df2:	c3                   	ret
+
+0000000000802df3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802df3:	55                   	push   %rbp
+  802df4:	48 89 e5             	mov    %rsp,%rbp
+  802df7:	48 83 ec 40          	sub    $0x40,%rsp
+  802dfb:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802dfe:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802e02:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802e06:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802e0a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802e0d:	48 89 d6             	mov    %rdx,%rsi
+  802e10:	89 c7                	mov    %eax,%edi
+  802e12:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  802e19:	00 00 00 
+  802e1c:	ff d0                	call   *%rax
+  802e1e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e21:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e25:	78 24                	js     802e4b <read+0x58>
+  802e27:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e2b:	8b 00                	mov    (%rax),%eax
+  802e2d:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802e31:	48 89 d6             	mov    %rdx,%rsi
+  802e34:	89 c7                	mov    %eax,%edi
+  802e36:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  802e3d:	00 00 00 
+  802e40:	ff d0                	call   *%rax
+  802e42:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802e45:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802e49:	79 0a                	jns    802e55 <read+0x62>
+    return r;
+  802e4b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802e4e:	48 98                	cltq
+  802e50:	e9 9e 00 00 00       	jmp    802ef3 <read+0x100>
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802e55:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802e59:	8b 40 08             	mov    0x8(%rax),%eax
+  802e5c:	83 e0 03             	and    $0x3,%eax
+  802e5f:	83 f8 01             	cmp    $0x1,%eax
+  802e62:	75 5c                	jne    802ec0 <read+0xcd>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802e64:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802e6b:	00 00 00 
+  802e6e:	8b 40 04             	mov    0x4(%rax),%eax
+  802e71:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802e76:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802e7d:	00 00 00 
+  802e80:	48 98                	cltq
+  802e82:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  802e89:	48 01 d0             	add    %rdx,%rax
+  802e8c:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  802e92:	8b 00                	mov    (%rax),%eax
+  802e94:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  802e97:	89 c6                	mov    %eax,%esi
+  802e99:	48 b8 97 56 80 00 00 	movabs $0x805697,%rax
+  802ea0:	00 00 00 
+  802ea3:	48 89 c7             	mov    %rax,%rdi
+  802ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eab:	48 b9 02 03 80 00 00 	movabs $0x800302,%rcx
+  802eb2:	00 00 00 
+  802eb5:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  802eb7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802ebe:	eb 33                	jmp    802ef3 <read+0x100>
+  }
+  if (!dev->dev_read)
+  802ec0:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802ec4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802ec8:	48 85 c0             	test   %rax,%rax
+  802ecb:	75 09                	jne    802ed6 <read+0xe3>
+    return -E_NOT_SUPP;
+  802ecd:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  802ed4:	eb 1d                	jmp    802ef3 <read+0x100>
+  return (*dev->dev_read)(fd, buf, n);
+  802ed6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  802eda:	4c 8b 40 10          	mov    0x10(%rax),%r8
+  802ede:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802ee2:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802ee6:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  802eea:	48 89 ce             	mov    %rcx,%rsi
+  802eed:	48 89 c7             	mov    %rax,%rdi
+  802ef0:	41 ff d0             	call   *%r8
+}
+  802ef3:	c9                   	leave
+  802ef4:	c3                   	ret
+
+0000000000802ef5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802ef5:	55                   	push   %rbp
+  802ef6:	48 89 e5             	mov    %rsp,%rbp
+  802ef9:	48 83 ec 30          	sub    $0x30,%rsp
+  802efd:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  802f00:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  802f04:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  802f08:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  802f0f:	eb 49                	jmp    802f5a <readn+0x65>
+    m = read(fdnum, (char *)buf + tot, n - tot);
+  802f11:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f14:	48 98                	cltq
+  802f16:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802f1a:	48 29 c2             	sub    %rax,%rdx
+  802f1d:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f20:	48 63 c8             	movslq %eax,%rcx
+  802f23:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802f27:	48 01 c1             	add    %rax,%rcx
+  802f2a:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  802f2d:	48 89 ce             	mov    %rcx,%rsi
+  802f30:	89 c7                	mov    %eax,%edi
+  802f32:	48 b8 f3 2d 80 00 00 	movabs $0x802df3,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+  802f3e:	89 45 f8             	mov    %eax,-0x8(%rbp)
+    if (m < 0)
+  802f41:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802f45:	79 07                	jns    802f4e <readn+0x59>
+      return m;
+  802f47:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802f4a:	48 98                	cltq
+  802f4c:	eb 1f                	jmp    802f6d <readn+0x78>
+    if (m == 0)
+  802f4e:	83 7d f8 00          	cmpl   $0x0,-0x8(%rbp)
+  802f52:	74 13                	je     802f67 <readn+0x72>
+  for (tot = 0; tot < n; tot += m) {
+  802f54:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  802f57:	01 45 fc             	add    %eax,-0x4(%rbp)
+  802f5a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f5d:	48 98                	cltq
+  802f5f:	48 3b 45 d8          	cmp    -0x28(%rbp),%rax
+  802f63:	72 ac                	jb     802f11 <readn+0x1c>
+  802f65:	eb 01                	jmp    802f68 <readn+0x73>
+      break;
+  802f67:	90                   	nop
+  }
+  return tot;
+  802f68:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802f6b:	48 98                	cltq
+}
+  802f6d:	c9                   	leave
+  802f6e:	c3                   	ret
+
+0000000000802f6f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802f6f:	55                   	push   %rbp
+  802f70:	48 89 e5             	mov    %rsp,%rbp
+  802f73:	48 83 ec 40          	sub    $0x40,%rsp
+  802f77:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  802f7a:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  802f7e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802f82:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  802f86:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  802f89:	48 89 d6             	mov    %rdx,%rsi
+  802f8c:	89 c7                	mov    %eax,%edi
+  802f8e:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  802f95:	00 00 00 
+  802f98:	ff d0                	call   *%rax
+  802f9a:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802f9d:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fa1:	78 24                	js     802fc7 <write+0x58>
+  802fa3:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fa7:	8b 00                	mov    (%rax),%eax
+  802fa9:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  802fad:	48 89 d6             	mov    %rdx,%rsi
+  802fb0:	89 c7                	mov    %eax,%edi
+  802fb2:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  802fb9:	00 00 00 
+  802fbc:	ff d0                	call   *%rax
+  802fbe:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  802fc1:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  802fc5:	79 0a                	jns    802fd1 <write+0x62>
+    return r;
+  802fc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  802fca:	48 98                	cltq
+  802fcc:	e9 9d 00 00 00       	jmp    80306e <write+0xff>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802fd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  802fd5:	8b 40 08             	mov    0x8(%rax),%eax
+  802fd8:	83 e0 03             	and    $0x3,%eax
+  802fdb:	85 c0                	test   %eax,%eax
+  802fdd:	75 5c                	jne    80303b <write+0xcc>
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802fdf:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  802fe6:	00 00 00 
+  802fe9:	8b 40 04             	mov    0x4(%rax),%eax
+  802fec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802ff1:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  802ff8:	00 00 00 
+  802ffb:	48 98                	cltq
+  802ffd:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803004:	48 01 d0             	add    %rdx,%rax
+  803007:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80300d:	8b 00                	mov    (%rax),%eax
+  80300f:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803012:	89 c6                	mov    %eax,%esi
+  803014:	48 b8 b3 56 80 00 00 	movabs $0x8056b3,%rax
+  80301b:	00 00 00 
+  80301e:	48 89 c7             	mov    %rax,%rdi
+  803021:	b8 00 00 00 00       	mov    $0x0,%eax
+  803026:	48 b9 02 03 80 00 00 	movabs $0x800302,%rcx
+  80302d:	00 00 00 
+  803030:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803032:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  803039:	eb 33                	jmp    80306e <write+0xff>
+  }
+  if (debug)
+    cprintf("write %d %p %lu via dev %s\n",
+            fdnum, buf, (unsigned long)n, dev->dev_name);
+  if (!dev->dev_write)
+  80303b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80303f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803043:	48 85 c0             	test   %rax,%rax
+  803046:	75 09                	jne    803051 <write+0xe2>
+    return -E_NOT_SUPP;
+  803048:	48 c7 c0 ee ff ff ff 	mov    $0xffffffffffffffee,%rax
+  80304f:	eb 1d                	jmp    80306e <write+0xff>
+  return (*dev->dev_write)(fd, buf, n);
+  803051:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803055:	4c 8b 40 18          	mov    0x18(%rax),%r8
+  803059:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80305d:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  803061:	48 8b 4d d0          	mov    -0x30(%rbp),%rcx
+  803065:	48 89 ce             	mov    %rcx,%rsi
+  803068:	48 89 c7             	mov    %rax,%rdi
+  80306b:	41 ff d0             	call   *%r8
+}
+  80306e:	c9                   	leave
+  80306f:	c3                   	ret
+
+0000000000803070 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  803070:	55                   	push   %rbp
+  803071:	48 89 e5             	mov    %rsp,%rbp
+  803074:	48 83 ec 18          	sub    $0x18,%rsp
+  803078:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  80307b:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80307e:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  803082:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803085:	48 89 d6             	mov    %rdx,%rsi
+  803088:	89 c7                	mov    %eax,%edi
+  80308a:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  803091:	00 00 00 
+  803094:	ff d0                	call   *%rax
+  803096:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803099:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80309d:	79 05                	jns    8030a4 <seek+0x34>
+    return r;
+  80309f:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8030a2:	eb 0f                	jmp    8030b3 <seek+0x43>
+  fd->fd_offset = offset;
+  8030a4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8030a8:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  8030ab:	89 50 04             	mov    %edx,0x4(%rax)
+  return 0;
+  8030ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030b3:	c9                   	leave
+  8030b4:	c3                   	ret
+
+00000000008030b5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8030b5:	55                   	push   %rbp
+  8030b6:	48 89 e5             	mov    %rsp,%rbp
+  8030b9:	48 83 ec 30          	sub    $0x30,%rsp
+  8030bd:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8030c0:	89 75 d8             	mov    %esi,-0x28(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8030c3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8030c7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8030ca:	48 89 d6             	mov    %rdx,%rsi
+  8030cd:	89 c7                	mov    %eax,%edi
+  8030cf:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  8030d6:	00 00 00 
+  8030d9:	ff d0                	call   *%rax
+  8030db:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8030de:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8030e2:	78 24                	js     803108 <ftruncate+0x53>
+  8030e4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8030e8:	8b 00                	mov    (%rax),%eax
+  8030ea:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8030ee:	48 89 d6             	mov    %rdx,%rsi
+  8030f1:	89 c7                	mov    %eax,%edi
+  8030f3:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  8030fa:	00 00 00 
+  8030fd:	ff d0                	call   *%rax
+  8030ff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803102:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803106:	79 08                	jns    803110 <ftruncate+0x5b>
+    return r;
+  803108:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80310b:	e9 92 00 00 00       	jmp    8031a2 <ftruncate+0xed>
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  803110:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803114:	8b 40 08             	mov    0x8(%rax),%eax
+  803117:	83 e0 03             	and    $0x3,%eax
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	75 5a                	jne    803178 <ftruncate+0xc3>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+  80311e:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803125:	00 00 00 
+  803128:	8b 40 04             	mov    0x4(%rax),%eax
+  80312b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803130:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803137:	00 00 00 
+  80313a:	48 98                	cltq
+  80313c:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803143:	48 01 d0             	add    %rdx,%rax
+  803146:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  80314c:	8b 00                	mov    (%rax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80314e:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  803151:	89 c6                	mov    %eax,%esi
+  803153:	48 b8 d0 56 80 00 00 	movabs $0x8056d0,%rax
+  80315a:	00 00 00 
+  80315d:	48 89 c7             	mov    %rax,%rdi
+  803160:	b8 00 00 00 00       	mov    $0x0,%eax
+  803165:	48 b9 02 03 80 00 00 	movabs $0x800302,%rcx
+  80316c:	00 00 00 
+  80316f:	ff d1                	call   *%rcx
+    return -E_INVAL;
+  803171:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803176:	eb 2a                	jmp    8031a2 <ftruncate+0xed>
+  }
+  if (!dev->dev_trunc)
+  803178:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80317c:	48 8b 40 30          	mov    0x30(%rax),%rax
+  803180:	48 85 c0             	test   %rax,%rax
+  803183:	75 07                	jne    80318c <ftruncate+0xd7>
+    return -E_NOT_SUPP;
+  803185:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80318a:	eb 16                	jmp    8031a2 <ftruncate+0xed>
+  return (*dev->dev_trunc)(fd, newsize);
+  80318c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803190:	48 8b 48 30          	mov    0x30(%rax),%rcx
+  803194:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803198:	8b 55 d8             	mov    -0x28(%rbp),%edx
+  80319b:	89 d6                	mov    %edx,%esi
+  80319d:	48 89 c7             	mov    %rax,%rdi
+  8031a0:	ff d1                	call   *%rcx
+}
+  8031a2:	c9                   	leave
+  8031a3:	c3                   	ret
+
+00000000008031a4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8031a4:	55                   	push   %rbp
+  8031a5:	48 89 e5             	mov    %rsp,%rbp
+  8031a8:	48 83 ec 30          	sub    $0x30,%rsp
+  8031ac:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  8031af:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0 || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8031b3:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8031b7:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8031ba:	48 89 d6             	mov    %rdx,%rsi
+  8031bd:	89 c7                	mov    %eax,%edi
+  8031bf:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  8031c6:	00 00 00 
+  8031c9:	ff d0                	call   *%rax
+  8031cb:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031ce:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031d2:	78 24                	js     8031f8 <fstat+0x54>
+  8031d4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8031d8:	8b 00                	mov    (%rax),%eax
+  8031da:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8031de:	48 89 d6             	mov    %rdx,%rsi
+  8031e1:	89 c7                	mov    %eax,%edi
+  8031e3:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  8031ea:	00 00 00 
+  8031ed:	ff d0                	call   *%rax
+  8031ef:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8031f2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8031f6:	79 05                	jns    8031fd <fstat+0x59>
+    return r;
+  8031f8:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8031fb:	eb 5e                	jmp    80325b <fstat+0xb7>
+  if (!dev->dev_stat)
+  8031fd:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803201:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803205:	48 85 c0             	test   %rax,%rax
+  803208:	75 07                	jne    803211 <fstat+0x6d>
+    return -E_NOT_SUPP;
+  80320a:	b8 ee ff ff ff       	mov    $0xffffffee,%eax
+  80320f:	eb 4a                	jmp    80325b <fstat+0xb7>
+  stat->st_name[0] = 0;
+  803211:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803215:	c6 00 00             	movb   $0x0,(%rax)
+  stat->st_size    = 0;
+  803218:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80321c:	c7 80 80 00 00 00 00 	movl   $0x0,0x80(%rax)
+  803223:	00 00 00 
+  stat->st_isdir   = 0;
+  803226:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80322a:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  803231:	00 00 00 
+  stat->st_dev     = dev;
+  803234:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803238:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80323c:	48 89 90 88 00 00 00 	mov    %rdx,0x88(%rax)
+  return (*dev->dev_stat)(fd, stat);
+  803243:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803247:	48 8b 48 28          	mov    0x28(%rax),%rcx
+  80324b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80324f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803253:	48 89 d6             	mov    %rdx,%rsi
+  803256:	48 89 c7             	mov    %rax,%rdi
+  803259:	ff d1                	call   *%rcx
+}
+  80325b:	c9                   	leave
+  80325c:	c3                   	ret
+
+000000000080325d <pollwait_key>:
+
+// Have poll sleep on the futex word at 'addr' until its value changes
+// from what it is now.
+int
+pollwait_key(struct PollWait *w, volatile uint32_t *addr) {
+  80325d:	55                   	push   %rbp
+  80325e:	48 89 e5             	mov    %rsp,%rbp
+  803261:	48 83 ec 10          	sub    $0x10,%rsp
+  803265:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803269:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  if (w->pw_nkeys == FUTEX_MAXKEYS)
+  80326d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803271:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  803277:	83 f8 20             	cmp    $0x20,%eax
+  80327a:	75 07                	jne    803283 <pollwait_key+0x26>
+    return -E_INVAL;
+  80327c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803281:	eb 5f                	jmp    8032e2 <pollwait_key+0x85>
+  w->pw_keys[w->pw_nkeys].pk_addr = addr;
+  803283:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803287:	8b 90 00 02 00 00    	mov    0x200(%rax),%edx
+  80328d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803291:	48 63 d2             	movslq %edx,%rdx
+  803294:	48 c1 e2 04          	shl    $0x4,%rdx
+  803298:	48 01 c2             	add    %rax,%rdx
+  80329b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80329f:	48 89 02             	mov    %rax,(%rdx)
+  w->pw_keys[w->pw_nkeys].pk_val  = *addr;
+  8032a2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032a6:	8b 88 00 02 00 00    	mov    0x200(%rax),%ecx
+  8032ac:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8032b0:	8b 00                	mov    (%rax),%eax
+  8032b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032b6:	48 63 c9             	movslq %ecx,%rcx
+  8032b9:	48 c1 e1 04          	shl    $0x4,%rcx
+  8032bd:	48 01 ca             	add    %rcx,%rdx
+  8032c0:	48 83 c2 08          	add    $0x8,%rdx
+  8032c4:	89 02                	mov    %eax,(%rdx)
+  w->pw_nkeys++;
+  8032c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032ca:	8b 80 00 02 00 00    	mov    0x200(%rax),%eax
+  8032d0:	8d 50 01             	lea    0x1(%rax),%edx
+  8032d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032d7:	89 90 00 02 00 00    	mov    %edx,0x200(%rax)
+  return 0;
+  8032dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032e2:	c9                   	leave
+  8032e3:	c3                   	ret
+
+00000000008032e4 <poll>:
+// 'timeout' nanoseconds (POLL_NO_TIMEOUT waits forever, 0 only checks).
+// Fills in every entry's revents.
+// Returns the number of entries with nonzero revents, 0 on timeout,
+// or < 0 on error.
+int
+poll(struct pollfd *fds, int nfds, uint64_t timeout) {
+  8032e4:	55                   	push   %rbp
+  8032e5:	48 89 e5             	mov    %rsp,%rbp
+  8032e8:	48 81 ec 60 02 00 00 	sub    $0x260,%rsp
+  8032ef:	48 89 bd b8 fd ff ff 	mov    %rdi,-0x248(%rbp)
+  8032f6:	89 b5 b4 fd ff ff    	mov    %esi,-0x24c(%rbp)
+  8032fc:	48 89 95 a8 fd ff ff 	mov    %rdx,-0x258(%rbp)
+  struct PollWait w;
+  struct Dev *dev;
+  struct Fd *fd;
+  uint64_t deadline = 0, now;
+  803303:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80330a:	00 
+  int i, r, ready, ipc = 0;
+  80330b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%rbp)
+
+  // Waking up early, for a key that changed without making anything
+  // ready, must not start the timeout over.
+  if (timeout && timeout != POLL_NO_TIMEOUT) {
+  803312:	48 83 bd a8 fd ff ff 	cmpq   $0x0,-0x258(%rbp)
+  803319:	00 
+  80331a:	74 45                	je     803361 <poll+0x7d>
+  80331c:	48 83 bd a8 fd ff ff 	cmpq   $0xffffffffffffffff,-0x258(%rbp)
+  803323:	ff 
+  803324:	74 3b                	je     803361 <poll+0x7d>
+    now      = vsys_clock_ns();
+  803326:	48 b8 1f 48 80 00 00 	movabs $0x80481f,%rax
+  80332d:	00 00 00 
+  803330:	ff d0                	call   *%rax
+  803332:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+    deadline = timeout < ~0UL - now ? now + timeout : ~0UL;
+  803336:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80333a:	48 f7 d0             	not    %rax
+  80333d:	48 39 85 a8 fd ff ff 	cmp    %rax,-0x258(%rbp)
+  803344:	73 10                	jae    803356 <poll+0x72>
+  803346:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80334a:	48 8b 85 a8 fd ff ff 	mov    -0x258(%rbp),%rax
+  803351:	48 01 d0             	add    %rdx,%rax
+  803354:	eb 07                	jmp    80335d <poll+0x79>
+  803356:	48 c7 c0 ff ff ff ff 	mov    $0xffffffffffffffff,%rax
+  80335d:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  }
+
+  while (1) {
+    w.pw_nkeys = 0;
+  803361:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%rbp)
+    w.pw_flags = 0;
+  803368:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%rbp)
+    ready      = 0;
+  80336f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  803376:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%rbp)
+  80337d:	e9 46 02 00 00       	jmp    8035c8 <poll+0x2e4>
+      fds[i].revents = 0;
+  803382:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803385:	48 63 d0             	movslq %eax,%rdx
+  803388:	48 89 d0             	mov    %rdx,%rax
+  80338b:	48 01 c0             	add    %rax,%rax
+  80338e:	48 01 d0             	add    %rdx,%rax
+  803391:	48 c1 e0 02          	shl    $0x2,%rax
+  803395:	48 89 c2             	mov    %rax,%rdx
+  803398:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80339f:	48 01 d0             	add    %rdx,%rax
+  8033a2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+      if (fds[i].fd == POLLFD_IPC) {
+  8033a9:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033ac:	48 63 d0             	movslq %eax,%rdx
+  8033af:	48 89 d0             	mov    %rdx,%rax
+  8033b2:	48 01 c0             	add    %rax,%rax
+  8033b5:	48 01 d0             	add    %rdx,%rax
+  8033b8:	48 c1 e0 02          	shl    $0x2,%rax
+  8033bc:	48 89 c2             	mov    %rax,%rdx
+  8033bf:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8033c6:	48 01 d0             	add    %rdx,%rax
+  8033c9:	8b 00                	mov    (%rax),%eax
+  8033cb:	83 f8 fe             	cmp    $0xfffffffe,%eax
+  8033ce:	75 62                	jne    803432 <poll+0x14e>
+        if (fds[i].events & POLLIN) {
+  8033d0:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8033d3:	48 63 d0             	movslq %eax,%rdx
+  8033d6:	48 89 d0             	mov    %rdx,%rax
+  8033d9:	48 01 c0             	add    %rax,%rax
+  8033dc:	48 01 d0             	add    %rdx,%rax
+  8033df:	48 c1 e0 02          	shl    $0x2,%rax
+  8033e3:	48 89 c2             	mov    %rax,%rdx
+  8033e6:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8033ed:	48 01 d0             	add    %rdx,%rax
+  8033f0:	8b 40 04             	mov    0x4(%rax),%eax
+  8033f3:	83 e0 01             	and    $0x1,%eax
+  8033f6:	85 c0                	test   %eax,%eax
+  8033f8:	0f 84 9b 01 00 00    	je     803599 <poll+0x2b5>
+          fds[i].revents = ipc;
+  8033fe:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803401:	48 63 d0             	movslq %eax,%rdx
+  803404:	48 89 d0             	mov    %rdx,%rax
+  803407:	48 01 c0             	add    %rax,%rax
+  80340a:	48 01 d0             	add    %rdx,%rax
+  80340d:	48 c1 e0 02          	shl    $0x2,%rax
+  803411:	48 89 c2             	mov    %rax,%rdx
+  803414:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80341b:	48 01 c2             	add    %rax,%rdx
+  80341e:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  803421:	89 42 08             	mov    %eax,0x8(%rdx)
+          w.pw_flags |= POLLWAIT_IPC;
+  803424:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  803427:	83 c8 04             	or     $0x4,%eax
+  80342a:	89 45 d4             	mov    %eax,-0x2c(%rbp)
+  80342d:	e9 67 01 00 00       	jmp    803599 <poll+0x2b5>
+        }
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803432:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803435:	48 63 d0             	movslq %eax,%rdx
+  803438:	48 89 d0             	mov    %rdx,%rax
+  80343b:	48 01 c0             	add    %rax,%rax
+  80343e:	48 01 d0             	add    %rdx,%rax
+  803441:	48 c1 e0 02          	shl    $0x2,%rax
+  803445:	48 89 c2             	mov    %rax,%rdx
+  803448:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80344f:	48 01 d0             	add    %rdx,%rax
+  803452:	8b 00                	mov    (%rax),%eax
+  803454:	48 8d 95 c0 fd ff ff 	lea    -0x240(%rbp),%rdx
+  80345b:	48 89 d6             	mov    %rdx,%rsi
+  80345e:	89 c7                	mov    %eax,%edi
+  803460:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  803467:	00 00 00 
+  80346a:	ff d0                	call   *%rax
+  80346c:	85 c0                	test   %eax,%eax
+  80346e:	78 25                	js     803495 <poll+0x1b1>
+                 dev_lookup(fd->fd_dev_id, &dev) < 0) {
+  803470:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803477:	8b 00                	mov    (%rax),%eax
+  803479:	48 8d 95 c8 fd ff ff 	lea    -0x238(%rbp),%rdx
+  803480:	48 89 d6             	mov    %rdx,%rsi
+  803483:	89 c7                	mov    %eax,%edi
+  803485:	48 b8 38 2a 80 00 00 	movabs $0x802a38,%rax
+  80348c:	00 00 00 
+  80348f:	ff d0                	call   *%rax
+      } else if (fd_lookup(fds[i].fd, &fd) < 0 ||
+  803491:	85 c0                	test   %eax,%eax
+  803493:	79 2c                	jns    8034c1 <poll+0x1dd>
+        fds[i].revents = POLLNVAL;
+  803495:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803498:	48 63 d0             	movslq %eax,%rdx
+  80349b:	48 89 d0             	mov    %rdx,%rax
+  80349e:	48 01 c0             	add    %rax,%rax
+  8034a1:	48 01 d0             	add    %rdx,%rax
+  8034a4:	48 c1 e0 02          	shl    $0x2,%rax
+  8034a8:	48 89 c2             	mov    %rax,%rdx
+  8034ab:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034b2:	48 01 d0             	add    %rdx,%rax
+  8034b5:	c7 40 08 08 00 00 00 	movl   $0x8,0x8(%rax)
+  8034bc:	e9 d8 00 00 00       	jmp    803599 <poll+0x2b5>
+      } else if (dev->dev_poll) {
+  8034c1:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8034c8:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8034cc:	48 85 c0             	test   %rax,%rax
+  8034cf:	74 7d                	je     80354e <poll+0x26a>
+        if ((r = (*dev->dev_poll)(fd, fds[i].events, &w)) < 0)
+  8034d1:	48 8b 85 c8 fd ff ff 	mov    -0x238(%rbp),%rax
+  8034d8:	4c 8b 40 38          	mov    0x38(%rax),%r8
+  8034dc:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8034df:	48 63 d0             	movslq %eax,%rdx
+  8034e2:	48 89 d0             	mov    %rdx,%rax
+  8034e5:	48 01 c0             	add    %rax,%rax
+  8034e8:	48 01 d0             	add    %rdx,%rax
+  8034eb:	48 c1 e0 02          	shl    $0x2,%rax
+  8034ef:	48 89 c2             	mov    %rax,%rdx
+  8034f2:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8034f9:	48 01 d0             	add    %rdx,%rax
+  8034fc:	8b 48 04             	mov    0x4(%rax),%ecx
+  8034ff:	48 8b 85 c0 fd ff ff 	mov    -0x240(%rbp),%rax
+  803506:	48 8d 95 d0 fd ff ff 	lea    -0x230(%rbp),%rdx
+  80350d:	89 ce                	mov    %ecx,%esi
+  80350f:	48 89 c7             	mov    %rax,%rdi
+  803512:	41 ff d0             	call   *%r8
+  803515:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  803518:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  80351c:	79 08                	jns    803526 <poll+0x242>
+          return r;
+  80351e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803521:	e9 45 01 00 00       	jmp    80366b <poll+0x387>
+        fds[i].revents = r;
+  803526:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803529:	48 63 d0             	movslq %eax,%rdx
+  80352c:	48 89 d0             	mov    %rdx,%rax
+  80352f:	48 01 c0             	add    %rax,%rax
+  803532:	48 01 d0             	add    %rdx,%rax
+  803535:	48 c1 e0 02          	shl    $0x2,%rax
+  803539:	48 89 c2             	mov    %rax,%rdx
+  80353c:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  803543:	48 01 c2             	add    %rax,%rdx
+  803546:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803549:	89 42 08             	mov    %eax,0x8(%rdx)
+  80354c:	eb 4b                	jmp    803599 <poll+0x2b5>
+      } else {
+        fds[i].revents = fds[i].events & (POLLIN | POLLOUT);
+  80354e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803551:	48 63 d0             	movslq %eax,%rdx
+  803554:	48 89 d0             	mov    %rdx,%rax
+  803557:	48 01 c0             	add    %rax,%rax
+  80355a:	48 01 d0             	add    %rdx,%rax
+  80355d:	48 c1 e0 02          	shl    $0x2,%rax
+  803561:	48 89 c2             	mov    %rax,%rdx
+  803564:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80356b:	48 01 d0             	add    %rdx,%rax
+  80356e:	8b 48 04             	mov    0x4(%rax),%ecx
+  803571:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803574:	48 63 d0             	movslq %eax,%rdx
+  803577:	48 89 d0             	mov    %rdx,%rax
+  80357a:	48 01 c0             	add    %rax,%rax
+  80357d:	48 01 d0             	add    %rdx,%rax
+  803580:	48 c1 e0 02          	shl    $0x2,%rax
+  803584:	48 89 c2             	mov    %rax,%rdx
+  803587:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  80358e:	48 01 d0             	add    %rdx,%rax
+  803591:	83 e1 03             	and    $0x3,%ecx
+  803594:	89 ca                	mov    %ecx,%edx
+  803596:	89 50 08             	mov    %edx,0x8(%rax)
+      }
+      if (fds[i].revents)
+  803599:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80359c:	48 63 d0             	movslq %eax,%rdx
+  80359f:	48 89 d0             	mov    %rdx,%rax
+  8035a2:	48 01 c0             	add    %rax,%rax
+  8035a5:	48 01 d0             	add    %rdx,%rax
+  8035a8:	48 c1 e0 02          	shl    $0x2,%rax
+  8035ac:	48 89 c2             	mov    %rax,%rdx
+  8035af:	48 8b 85 b8 fd ff ff 	mov    -0x248(%rbp),%rax
+  8035b6:	48 01 d0             	add    %rdx,%rax
+  8035b9:	8b 40 08             	mov    0x8(%rax),%eax
+  8035bc:	85 c0                	test   %eax,%eax
+  8035be:	74 04                	je     8035c4 <poll+0x2e0>
+        ready++;
+  8035c0:	83 45 f0 01          	addl   $0x1,-0x10(%rbp)
+    for (i = 0; i < nfds; i++) {
+  8035c4:	83 45 f4 01          	addl   $0x1,-0xc(%rbp)
+  8035c8:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8035cb:	3b 85 b4 fd ff ff    	cmp    -0x24c(%rbp),%eax
+  8035d1:	0f 8c ab fd ff ff    	jl     803382 <poll+0x9e>
+    }
+    if (ready)
+  8035d7:	83 7d f0 00          	cmpl   $0x0,-0x10(%rbp)
+  8035db:	74 08                	je     8035e5 <poll+0x301>
+      return ready;
+  8035dd:	8b 45 f0             	mov    -0x10(%rbp),%eax
+  8035e0:	e9 86 00 00 00       	jmp    80366b <poll+0x387>
+
+    if (deadline) {
+  8035e5:	48 83 7d f8 00       	cmpq   $0x0,-0x8(%rbp)
+  8035ea:	74 30                	je     80361c <poll+0x338>
+      now     = vsys_clock_ns();
+  8035ec:	48 b8 1f 48 80 00 00 	movabs $0x80481f,%rax
+  8035f3:	00 00 00 
+  8035f6:	ff d0                	call   *%rax
+  8035f8:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+      timeout = now < deadline ? deadline - now : 0;
+  8035fc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803600:	48 3b 45 f8          	cmp    -0x8(%rbp),%rax
+  803604:	73 0a                	jae    803610 <poll+0x32c>
+  803606:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80360a:	48 2b 45 e0          	sub    -0x20(%rbp),%rax
+  80360e:	eb 05                	jmp    803615 <poll+0x331>
+  803610:	b8 00 00 00 00       	mov    $0x0,%eax
+  803615:	48 89 85 a8 fd ff ff 	mov    %rax,-0x258(%rbp)
+    }
+    r = sys_poll_wait(w.pw_keys, w.pw_nkeys, w.pw_flags, timeout);
+  80361c:	8b 55 d4             	mov    -0x2c(%rbp),%edx
+  80361f:	8b 75 d0             	mov    -0x30(%rbp),%esi
+  803622:	48 8b 8d a8 fd ff ff 	mov    -0x258(%rbp),%rcx
+  803629:	48 8d 85 d0 fd ff ff 	lea    -0x230(%rbp),%rax
+  803630:	48 89 c7             	mov    %rax,%rdi
+  803633:	48 b8 c8 24 80 00 00 	movabs $0x8024c8,%rax
+  80363a:	00 00 00 
+  80363d:	ff d0                	call   *%rax
+  80363f:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (r == -E_TIMEOUT)
+  803642:	83 7d dc ed          	cmpl   $0xffffffed,-0x24(%rbp)
+  803646:	75 07                	jne    80364f <poll+0x36b>
+      return 0;
+  803648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80364d:	eb 1c                	jmp    80366b <poll+0x387>
+    if (r < 0)
+  80364f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803653:	79 05                	jns    80365a <poll+0x376>
+      return r;
+  803655:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803658:	eb 11                	jmp    80366b <poll+0x387>
+    ipc = r & POLLWAIT_IPC ? POLLIN : 0;
+  80365a:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  80365d:	c1 f8 02             	sar    $0x2,%eax
+  803660:	83 e0 01             	and    $0x1,%eax
+  803663:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    w.pw_nkeys = 0;
+  803666:	e9 f6 fc ff ff       	jmp    803361 <poll+0x7d>
+  }
+}
+  80366b:	c9                   	leave
+  80366c:	c3                   	ret
+
+000000000080366d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80366d:	55                   	push   %rbp
+  80366e:	48 89 e5             	mov    %rsp,%rbp
+  803671:	48 83 ec 20          	sub    $0x20,%rsp
+  803675:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803679:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int fd, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  80367d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803681:	be 00 00 00 00       	mov    $0x0,%esi
+  803686:	48 89 c7             	mov    %rax,%rdi
+  803689:	48 b8 5b 37 80 00 00 	movabs $0x80375b,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+  803695:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803698:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  80369c:	79 05                	jns    8036a3 <stat+0x36>
+    return fd;
+  80369e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036a1:	eb 2f                	jmp    8036d2 <stat+0x65>
+  r = fstat(fd, stat);
+  8036a3:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8036a7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036aa:	48 89 d6             	mov    %rdx,%rsi
+  8036ad:	89 c7                	mov    %eax,%edi
+  8036af:	48 b8 a4 31 80 00 00 	movabs $0x8031a4,%rax
+  8036b6:	00 00 00 
+  8036b9:	ff d0                	call   *%rax
+  8036bb:	89 45 f8             	mov    %eax,-0x8(%rbp)
+  close(fd);
+  8036be:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8036c1:	89 c7                	mov    %eax,%edi
+  8036c3:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  8036ca:	00 00 00 
+  8036cd:	ff d0                	call   *%rax
+  return r;
+  8036cf:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8036d2:	c9                   	leave
+  8036d3:	c3                   	ret
+
+00000000008036d4 <fsipc>:
+// response may be written back to fsipcbuf.
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva) {
+  8036d4:	55                   	push   %rbp
+  8036d5:	48 89 e5             	mov    %rsp,%rbp
+  8036d8:	48 83 ec 10          	sub    $0x10,%rsp
+  8036dc:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  8036df:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  static envid_t fsenv;
+  if (fsenv == 0)
+  8036e3:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  8036ea:	00 00 00 
+  8036ed:	8b 00                	mov    (%rax),%eax
+  8036ef:	85 c0                	test   %eax,%eax
+  8036f1:	75 1d                	jne    803710 <fsipc+0x3c>
+    fsenv = ipc_find_env(ENV_TYPE_FS);
+  8036f3:	bf 03 00 00 00       	mov    $0x3,%edi
+  8036f8:	48 b8 54 4f 80 00 00 	movabs $0x804f54,%rax
+  8036ff:	00 00 00 
+  803702:	ff d0                	call   *%rax
+  803704:	48 ba 00 80 80 00 00 	movabs $0x808000,%rdx
+  80370b:	00 00 00 
+  80370e:	89 02                	mov    %eax,(%rdx)
+  static_assert(sizeof(fsipcbuf) == PGSIZE, "Invalid fsipcbuf size");
+
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
+
+  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  803710:	48 b8 00 80 80 00 00 	movabs $0x808000,%rax
+  803717:	00 00 00 
+  80371a:	8b 00                	mov    (%rax),%eax
+  80371c:	8b 75 fc             	mov    -0x4(%rbp),%esi
+  80371f:	b9 07 00 00 00       	mov    $0x7,%ecx
+  803724:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  80372b:	00 00 00 
+  80372e:	89 c7                	mov    %eax,%edi
+  803730:	48 b8 a7 4e 80 00 00 	movabs $0x804ea7,%rax
+  803737:	00 00 00 
+  80373a:	ff d0                	call   *%rax
+  return ipc_recv(NULL, dstva, NULL);
+  80373c:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803740:	ba 00 00 00 00       	mov    $0x0,%edx
+  803745:	48 89 c6             	mov    %rax,%rsi
+  803748:	bf 00 00 00 00       	mov    $0x0,%edi
+  80374d:	48 b8 2a 4d 80 00 00 	movabs $0x804d2a,%rax
+  803754:	00 00 00 
+  803757:	ff d0                	call   *%rax
+}
+  803759:	c9                   	leave
+  80375a:	c3                   	ret
+
+000000000080375b <open>:
+// Returns:
+// 	The file descriptor index on success
+// 	-E_BAD_PATH if the path is too long (>= MAXPATHLEN)
+// 	< 0 for other errors.
+int
+open(const char *path, int mode) {
+  80375b:	55                   	push   %rbp
+  80375c:	48 89 e5             	mov    %rsp,%rbp
+  80375f:	48 83 ec 20          	sub    $0x20,%rsp
+  803763:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803767:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  // file descriptor.
+
+  int r;
+  struct Fd *fd;
+
+  if (strlen(path) >= MAXPATHLEN)
+  80376a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80376e:	48 89 c7             	mov    %rax,%rdi
+  803771:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  803778:	00 00 00 
+  80377b:	ff d0                	call   *%rax
+  80377d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803782:	7e 0a                	jle    80378e <open+0x33>
+    return -E_BAD_PATH;
+  803784:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803789:	e9 a8 00 00 00       	jmp    803836 <open+0xdb>
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80378e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  803792:	48 89 c7             	mov    %rax,%rdi
+  803795:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  80379c:	00 00 00 
+  80379f:	ff d0                	call   *%rax
+  8037a1:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  8037a4:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8037a8:	79 08                	jns    8037b2 <open+0x57>
+    return r;
+  8037aa:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8037ad:	e9 84 00 00 00       	jmp    803836 <open+0xdb>
+
+  strcpy(fsipcbuf.open.req_path, path);
+  8037b2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8037b6:	48 89 c6             	mov    %rax,%rsi
+  8037b9:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8037c0:	00 00 00 
+  8037c3:	48 89 c7             	mov    %rax,%rdi
+  8037c6:	48 b8 b2 12 80 00 00 	movabs $0x8012b2,%rax
+  8037cd:	00 00 00 
+  8037d0:	ff d0                	call   *%rax
+  fsipcbuf.open.req_omode = mode;
+  8037d2:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8037d9:	00 00 00 
+  8037dc:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8037df:	89 82 00 04 00 00    	mov    %eax,0x400(%rdx)
+
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8037e5:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8037e9:	48 89 c6             	mov    %rax,%rsi
+  8037ec:	bf 01 00 00 00       	mov    $0x1,%edi
+  8037f1:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+  8037fd:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803800:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803804:	79 1d                	jns    803823 <open+0xc8>
+    fd_close(fd, 0);
+  803806:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80380a:	be 00 00 00 00       	mov    $0x0,%esi
+  80380f:	48 89 c7             	mov    %rax,%rdi
+  803812:	48 b8 6d 29 80 00 00 	movabs $0x80296d,%rax
+  803819:	00 00 00 
+  80381c:	ff d0                	call   *%rax
+    return r;
+  80381e:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803821:	eb 13                	jmp    803836 <open+0xdb>
+  }
+
+  return fd2num(fd);
+  803823:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803827:	48 89 c7             	mov    %rax,%rdi
+  80382a:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  803831:	00 00 00 
+  803834:	ff d0                	call   *%rax
+}
+  803836:	c9                   	leave
+  803837:	c3                   	ret
+
+0000000000803838 <devfile_flush>:
+// the reference counts on the FD pages to detect which files are
+// open, unmapping it is enough to free up server-side resources.
+// Other than that, we just have to make sure our changes are flushed
+// to disk.
+static int
+devfile_flush(struct Fd *fd) {
+  803838:	55                   	push   %rbp
+  803839:	48 89 e5             	mov    %rsp,%rbp
+  80383c:	48 83 ec 10          	sub    $0x10,%rsp
+  803840:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  803844:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803848:	8b 40 0c             	mov    0xc(%rax),%eax
+  80384b:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803852:	00 00 00 
+  803855:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_FLUSH, NULL);
+  803857:	be 00 00 00 00       	mov    $0x0,%esi
+  80385c:	bf 06 00 00 00       	mov    $0x6,%edi
+  803861:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+}
+  80386d:	c9                   	leave
+  80386e:	c3                   	ret
+
+000000000080386f <devfile_read>:
+//
+// Returns:
+// 	The number of bytes successfully read.
+// 	< 0 on error.
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80386f:	55                   	push   %rbp
+  803870:	48 89 e5             	mov    %rsp,%rbp
+  803873:	48 83 ec 30          	sub    $0x30,%rsp
+  803877:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80387b:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  80387f:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  // Make an FSREQ_READ request to the file system server after
+  // filling fsipcbuf.read with the request arguments.  The
+  // bytes read will be written back to fsipcbuf by the file
+  // system server.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803883:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  803888:	74 07                	je     803891 <devfile_read+0x22>
+  80388a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  80388f:	75 0a                	jne    80389b <devfile_read+0x2c>
+  return E_INVAL;
+  803891:	b8 03 00 00 00       	mov    $0x3,%eax
+  803896:	e9 b4 00 00 00       	jmp    80394f <devfile_read+0xe0>
+
+  size_t res0 = 0;
+  80389b:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8038a2:	00 
+  while (n) {
+  8038a3:	e9 98 00 00 00       	jmp    803940 <devfile_read+0xd1>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8038a8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8038ac:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038af:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8038b6:	00 00 00 
+  8038b9:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.read.req_n      = n;
+  8038bb:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8038c2:	00 00 00 
+  8038c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8038c9:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_READ, NULL);
+  8038cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8038d2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8038d7:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  8038de:	00 00 00 
+  8038e1:	ff d0                	call   *%rax
+  8038e3:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (res <= 0)
+  8038e6:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8038ea:	7f 13                	jg     8038ff <devfile_read+0x90>
+      return res ? res : res0;
+  8038ec:	83 7d f4 00          	cmpl   $0x0,-0xc(%rbp)
+  8038f0:	74 07                	je     8038f9 <devfile_read+0x8a>
+  8038f2:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8038f5:	48 98                	cltq
+  8038f7:	eb 56                	jmp    80394f <devfile_read+0xe0>
+  8038f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038fd:	eb 50                	jmp    80394f <devfile_read+0xe0>
+    memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+  8038ff:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803902:	48 63 d0             	movslq %eax,%rdx
+  803905:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803909:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803910:	00 00 00 
+  803913:	48 89 ce             	mov    %rcx,%rsi
+  803916:	48 89 c7             	mov    %rax,%rdi
+  803919:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  803920:	00 00 00 
+  803923:	ff d0                	call   *%rax
+
+    buf += res;
+  803925:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803928:	48 98                	cltq
+  80392a:	48 01 45 e0          	add    %rax,-0x20(%rbp)
+    n -= res;
+  80392e:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803931:	48 98                	cltq
+  803933:	48 29 45 d8          	sub    %rax,-0x28(%rbp)
+    res0 += res;
+  803937:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  80393a:	48 98                	cltq
+  80393c:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803940:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  803945:	0f 85 5d ff ff ff    	jne    8038a8 <devfile_read+0x39>
+  }
+
+  return res0;
+  80394b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  assert(r <= n);
+  assert(r <= PGSIZE);
+  memmove(buf, &fsipcbuf, r);
+  return r;
+  */
+}
+  80394f:	c9                   	leave
+  803950:	c3                   	ret
+
+0000000000803951 <devfile_write>:
+//
+// Returns:
+//	 The number of bytes successfully written.
+//	 < 0 on error.
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803951:	55                   	push   %rbp
+  803952:	48 89 e5             	mov    %rsp,%rbp
+  803955:	48 83 ec 50          	sub    $0x50,%rsp
+  803959:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80395d:	48 89 75 c0          	mov    %rsi,-0x40(%rbp)
+  803961:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  // Make an FSREQ_WRITE request to the file system server.  Be
+  // careful: fsipcbuf.write.req_buf is only so large, but
+  // remember that write is always allowed to write *fewer*
+  // bytes than requested.
+  // LAB 10: Your code here
+  if (!fd || !buf)
+  803965:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  80396a:	74 07                	je     803973 <devfile_write+0x22>
+  80396c:	48 83 7d c0 00       	cmpq   $0x0,-0x40(%rbp)
+  803971:	75 0a                	jne    80397d <devfile_write+0x2c>
+  return E_INVAL;
+  803973:	b8 03 00 00 00       	mov    $0x3,%eax
+  803978:	e9 c9 00 00 00       	jmp    803a46 <devfile_write+0xf5>
+
+  size_t res0 = 0;
+  80397d:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  803984:	00 
+
+  while (n) {
+  803985:	e9 ad 00 00 00       	jmp    803a37 <devfile_write+0xe6>
+    size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  80398a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80398e:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803992:	48 c7 45 e8 f0 0f 00 	movq   $0xff0,-0x18(%rbp)
+  803999:	00 
+  80399a:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80399e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8039a2:	48 39 c2             	cmp    %rax,%rdx
+  8039a5:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8039a9:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+
+    memcpy(fsipcbuf.write.req_buf, buf, blk);
+  8039ad:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  8039b1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8039b5:	48 89 c6             	mov    %rax,%rsi
+  8039b8:	48 b8 10 70 80 00 00 	movabs $0x807010,%rax
+  8039bf:	00 00 00 
+  8039c2:	48 89 c7             	mov    %rax,%rdi
+  8039c5:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  8039cc:	00 00 00 
+  8039cf:	ff d0                	call   *%rax
+    fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8039d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8039d5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8039d8:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8039df:	00 00 00 
+  8039e2:	89 02                	mov    %eax,(%rdx)
+    fsipcbuf.write.req_n      = blk;
+  8039e4:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  8039eb:	00 00 00 
+  8039ee:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8039f2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+
+    int res = fsipc(FSREQ_WRITE, NULL);
+  8039f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8039fb:	bf 04 00 00 00       	mov    $0x4,%edi
+  803a00:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803a07:	00 00 00 
+  803a0a:	ff d0                	call   *%rax
+  803a0c:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (res < 0)
+  803a0f:	83 7d dc 00          	cmpl   $0x0,-0x24(%rbp)
+  803a13:	79 07                	jns    803a1c <devfile_write+0xcb>
+      return res;
+  803a15:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a18:	48 98                	cltq
+  803a1a:	eb 2a                	jmp    803a46 <devfile_write+0xf5>
+
+    buf += res;
+  803a1c:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a1f:	48 98                	cltq
+  803a21:	48 01 45 c0          	add    %rax,-0x40(%rbp)
+    n -= res;
+  803a25:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a28:	48 98                	cltq
+  803a2a:	48 29 45 b8          	sub    %rax,-0x48(%rbp)
+    res0 += res;
+  803a2e:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  803a31:	48 98                	cltq
+  803a33:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  while (n) {
+  803a37:	48 83 7d b8 00       	cmpq   $0x0,-0x48(%rbp)
+  803a3c:	0f 85 48 ff ff ff    	jne    80398a <devfile_write+0x39>
+  }
+
+  return res0;
+  803a42:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  fsipcbuf.write.req_n = n;
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  return fsipc(FSREQ_WRITE, NULL);
+  */
+}
+  803a46:	c9                   	leave
+  803a47:	c3                   	ret
+
+0000000000803a48 <devfile_stat>:
+
+static int
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803a48:	55                   	push   %rbp
+  803a49:	48 89 e5             	mov    %rsp,%rbp
+  803a4c:	48 83 ec 20          	sub    $0x20,%rsp
+  803a50:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803a54:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  int r;
+
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803a58:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803a5c:	8b 40 0c             	mov    0xc(%rax),%eax
+  803a5f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a66:	00 00 00 
+  803a69:	89 02                	mov    %eax,(%rdx)
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  803a6b:	be 00 00 00 00       	mov    $0x0,%esi
+  803a70:	bf 05 00 00 00       	mov    $0x5,%edi
+  803a75:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803a7c:	00 00 00 
+  803a7f:	ff d0                	call   *%rax
+  803a81:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803a84:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803a88:	79 05                	jns    803a8f <devfile_stat+0x47>
+    return r;
+  803a8a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803a8d:	eb 59                	jmp    803ae8 <devfile_stat+0xa0>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803a8f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803a93:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803a9a:	00 00 00 
+  803a9d:	48 89 d6             	mov    %rdx,%rsi
+  803aa0:	48 89 c7             	mov    %rax,%rdi
+  803aa3:	48 b8 b2 12 80 00 00 	movabs $0x8012b2,%rax
+  803aaa:	00 00 00 
+  803aad:	ff d0                	call   *%rax
+  st->st_size  = fsipcbuf.statRet.ret_size;
+  803aaf:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803ab6:	00 00 00 
+  803ab9:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803abf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803ac3:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ac9:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803ad0:	00 00 00 
+  803ad3:	8b 90 84 00 00 00    	mov    0x84(%rax),%edx
+  803ad9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803add:	89 90 84 00 00 00    	mov    %edx,0x84(%rax)
+  return 0;
+  803ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ae8:	c9                   	leave
+  803ae9:	c3                   	ret
+
+0000000000803aea <devfile_trunc>:
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803aea:	55                   	push   %rbp
+  803aeb:	48 89 e5             	mov    %rsp,%rbp
+  803aee:	48 83 ec 10          	sub    $0x10,%rsp
+  803af2:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803af6:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803af9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803afd:	8b 40 0c             	mov    0xc(%rax),%eax
+  803b00:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b07:	00 00 00 
+  803b0a:	89 02                	mov    %eax,(%rdx)
+  fsipcbuf.set_size.req_size   = newsize;
+  803b0c:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803b13:	00 00 00 
+  803b16:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b19:	89 42 04             	mov    %eax,0x4(%rdx)
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  803b1c:	be 00 00 00 00       	mov    $0x0,%esi
+  803b21:	bf 02 00 00 00       	mov    $0x2,%edi
+  803b26:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803b2d:	00 00 00 
+  803b30:	ff d0                	call   *%rax
+}
+  803b32:	c9                   	leave
+  803b33:	c3                   	ret
+
+0000000000803b34 <devfile_poll>:
+
+// Regular files never make the reader or writer wait.
+static int
+devfile_poll(struct Fd *fd, int events, struct PollWait *w) {
+  803b34:	55                   	push   %rbp
+  803b35:	48 89 e5             	mov    %rsp,%rbp
+  803b38:	48 83 ec 18          	sub    $0x18,%rsp
+  803b3c:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  803b40:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  803b43:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return events & (POLLIN | POLLOUT);
+  803b47:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  803b4a:	83 e0 03             	and    $0x3,%eax
+}
+  803b4d:	c9                   	leave
+  803b4e:	c3                   	ret
+
+0000000000803b4f <remove>:
+
+// Delete a file
+int
+remove(const char *path) {
+  803b4f:	55                   	push   %rbp
+  803b50:	48 89 e5             	mov    %rsp,%rbp
+  803b53:	48 83 ec 10          	sub    $0x10,%rsp
+  803b57:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  if (strlen(path) >= MAXPATHLEN)
+  803b5b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b5f:	48 89 c7             	mov    %rax,%rdi
+  803b62:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  803b69:	00 00 00 
+  803b6c:	ff d0                	call   *%rax
+  803b6e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  803b73:	7e 07                	jle    803b7c <remove+0x2d>
+    return -E_BAD_PATH;
+  803b75:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803b7a:	eb 36                	jmp    803bb2 <remove+0x63>
+  strcpy(fsipcbuf.remove.req_path, path);
+  803b7c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803b80:	48 89 c6             	mov    %rax,%rsi
+  803b83:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  803b8a:	00 00 00 
+  803b8d:	48 89 c7             	mov    %rax,%rdi
+  803b90:	48 b8 b2 12 80 00 00 	movabs $0x8012b2,%rax
+  803b97:	00 00 00 
+  803b9a:	ff d0                	call   *%rax
+  return fsipc(FSREQ_REMOVE, NULL);
+  803b9c:	be 00 00 00 00       	mov    $0x0,%esi
+  803ba1:	bf 07 00 00 00       	mov    $0x7,%edi
+  803ba6:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803bad:	00 00 00 
+  803bb0:	ff d0                	call   *%rax
+}
+  803bb2:	c9                   	leave
+  803bb3:	c3                   	ret
+
+0000000000803bb4 <sync>:
+
+// Synchronize disk with buffer cache
+int
+sync(void) {
+  803bb4:	55                   	push   %rbp
+  803bb5:	48 89 e5             	mov    %rsp,%rbp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  803bb8:	be 00 00 00 00       	mov    $0x0,%esi
+  803bbd:	bf 08 00 00 00       	mov    $0x8,%edi
+  803bc2:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803bc9:	00 00 00 
+  803bcc:	ff d0                	call   *%rax
+}
+  803bce:	5d                   	pop    %rbp
+  803bcf:	c3                   	ret
+
+0000000000803bd0 <fs_stats>:
+
+// Copy the file server's statistics into *st.
+int
+fs_stats(struct Fsret_stats *st) {
+  803bd0:	55                   	push   %rbp
+  803bd1:	48 89 e5             	mov    %rsp,%rbp
+  803bd4:	48 83 ec 20          	sub    $0x20,%rsp
+  803bd8:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  int r;
+
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  803bdc:	be 00 00 00 00       	mov    $0x0,%esi
+  803be1:	bf 09 00 00 00       	mov    $0x9,%edi
+  803be6:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803bed:	00 00 00 
+  803bf0:	ff d0                	call   *%rax
+  803bf2:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803bf5:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803bf9:	79 05                	jns    803c00 <fs_stats+0x30>
+    return r;
+  803bfb:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803bfe:	eb 2a                	jmp    803c2a <fs_stats+0x5a>
+  memmove(st, &fsipcbuf.statsRet, sizeof(*st));
+  803c00:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803c04:	ba 68 00 00 00       	mov    $0x68,%edx
+  803c09:	48 b9 00 70 80 00 00 	movabs $0x807000,%rcx
+  803c10:	00 00 00 
+  803c13:	48 89 ce             	mov    %rcx,%rsi
+  803c16:	48 89 c7             	mov    %rax,%rdi
+  803c19:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  803c20:	00 00 00 
+  803c23:	ff d0                	call   *%rax
+  return 0;
+  803c25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c2a:	c9                   	leave
+  803c2b:	c3                   	ret
+
+0000000000803c2c <fs_set_cache>:
+
+// Let the file server's block cache hold at most nblocks blocks.
+int
+fs_set_cache(uint32_t nblocks) {
+  803c2c:	55                   	push   %rbp
+  803c2d:	48 89 e5             	mov    %rsp,%rbp
+  803c30:	48 83 ec 10          	sub    $0x10,%rsp
+  803c34:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  fsipcbuf.set_cache.req_nblocks = nblocks;
+  803c37:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803c3e:	00 00 00 
+  803c41:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  803c44:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_CACHE, NULL);
+  803c46:	be 00 00 00 00       	mov    $0x0,%esi
+  803c4b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  803c50:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803c57:	00 00 00 
+  803c5a:	ff d0                	call   *%rax
+}
+  803c5c:	c9                   	leave
+  803c5d:	c3                   	ret
+
+0000000000803c5e <fs_set_dma>:
+
+// Let the file server move disk data by DMA (on) or only by PIO (off).
+// Returns -E_NOT_SUPP if the disk is not IDE or cannot do DMA.
+int
+fs_set_dma(bool on) {
+  803c5e:	55                   	push   %rbp
+  803c5f:	48 89 e5             	mov    %rsp,%rbp
+  803c62:	48 83 ec 10          	sub    $0x10,%rsp
+  803c66:	89 f8                	mov    %edi,%eax
+  803c68:	88 45 fc             	mov    %al,-0x4(%rbp)
+  fsipcbuf.set_dma.req_on = on;
+  803c6b:	0f b6 45 fc          	movzbl -0x4(%rbp),%eax
+  803c6f:	48 ba 00 70 80 00 00 	movabs $0x807000,%rdx
+  803c76:	00 00 00 
+  803c79:	89 02                	mov    %eax,(%rdx)
+  return fsipc(FSREQ_SET_DMA, NULL);
+  803c7b:	be 00 00 00 00       	mov    $0x0,%esi
+  803c80:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803c85:	48 b8 d4 36 80 00 00 	movabs $0x8036d4,%rax
+  803c8c:	00 00 00 
+  803c8f:	ff d0                	call   *%rax
+}
+  803c91:	c9                   	leave
+  803c92:	c3                   	ret
+
+0000000000803c93 <pipe>:
+
+// Number of pages the pipe with a 'size'-byte buffer occupies.
+#define PIPEPAGES(size) (ROUNDUP(sizeof(struct Pipe) + (size), PGSIZE) / PGSIZE)
+
+int
+pipe(int pfd[2]) {
+  803c93:	55                   	push   %rbp
+  803c94:	48 89 e5             	mov    %rsp,%rbp
+  803c97:	48 83 ec 10          	sub    $0x10,%rsp
+  803c9b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  return pipe_size(pfd, PIPEBUFSIZ);
+  803c9f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803ca3:	be c0 3f 00 00       	mov    $0x3fc0,%esi
+  803ca8:	48 89 c7             	mov    %rax,%rdi
+  803cab:	48 b8 b9 3c 80 00 00 	movabs $0x803cb9,%rax
+  803cb2:	00 00 00 
+  803cb5:	ff d0                	call   *%rax
+}
+  803cb7:	c9                   	leave
+  803cb8:	c3                   	ret
+
+0000000000803cb9 <pipe_size>:
+
+// Like pipe, but with a 'size'-byte buffer.  PIPE_SMALL_BUFSIZ makes
+// the two ends trade places often, which is good for provoking races.
+int
+pipe_size(int pfd[2], size_t size) {
+  803cb9:	55                   	push   %rbp
+  803cba:	48 89 e5             	mov    %rsp,%rbp
+  803cbd:	48 83 ec 50          	sub    $0x50,%rsp
+  803cc1:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803cc5:	48 89 75 b0          	mov    %rsi,-0x50(%rbp)
+  int r;
+  size_t i = 0;
+  803cc9:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803cd0:	00 
+  struct Fd *fd0, *fd1;
+  struct Pipe *p;
+  char *va;
+
+  if (size == 0 || size > PIPEMAXBUF)
+  803cd1:	48 83 7d b0 00       	cmpq   $0x0,-0x50(%rbp)
+  803cd6:	74 0a                	je     803ce2 <pipe_size+0x29>
+  803cd8:	48 81 7d b0 e0 ff 01 	cmpq   $0x1ffe0,-0x50(%rbp)
+  803cdf:	00 
+  803ce0:	76 0a                	jbe    803cec <pipe_size+0x33>
+    return -E_INVAL;
+  803ce2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803ce7:	e9 cc 02 00 00       	jmp    803fb8 <pipe_size+0x2ff>
+
+  // allocate the file descriptor table entries
+  if ((r = fd_alloc(&fd0)) < 0 || (r = sys_page_alloc(0, fd0, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803cec:	48 8d 45 c8          	lea    -0x38(%rbp),%rax
+  803cf0:	48 89 c7             	mov    %rax,%rdi
+  803cf3:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  803cfa:	00 00 00 
+  803cfd:	ff d0                	call   *%rax
+  803cff:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d02:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d06:	0f 88 a8 02 00 00    	js     803fb4 <pipe_size+0x2fb>
+  803d0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d10:	ba 07 04 00 00       	mov    $0x407,%edx
+  803d15:	48 89 c6             	mov    %rax,%rsi
+  803d18:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d1d:	48 b8 80 20 80 00 00 	movabs $0x802080,%rax
+  803d24:	00 00 00 
+  803d27:	ff d0                	call   *%rax
+  803d29:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d2c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d30:	0f 88 7e 02 00 00    	js     803fb4 <pipe_size+0x2fb>
+    goto err;
+
+  if ((r = fd_alloc(&fd1)) < 0 || (r = sys_page_alloc(0, fd1, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803d36:	48 8d 45 c0          	lea    -0x40(%rbp),%rax
+  803d3a:	48 89 c7             	mov    %rax,%rdi
+  803d3d:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  803d44:	00 00 00 
+  803d47:	ff d0                	call   *%rax
+  803d49:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d4c:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d50:	0f 88 43 02 00 00    	js     803f99 <pipe_size+0x2e0>
+  803d56:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d5a:	ba 07 04 00 00       	mov    $0x407,%edx
+  803d5f:	48 89 c6             	mov    %rax,%rsi
+  803d62:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d67:	48 b8 80 20 80 00 00 	movabs $0x802080,%rax
+  803d6e:	00 00 00 
+  803d71:	ff d0                	call   *%rax
+  803d73:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803d76:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803d7a:	0f 88 19 02 00 00    	js     803f99 <pipe_size+0x2e0>
+    goto err1;
+
+  // allocate the pipe structure and buffer as data pages in both
+  va = fd2data(fd0);
+  803d80:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d84:	48 89 c7             	mov    %rax,%rdi
+  803d87:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  803d8e:	00 00 00 
+  803d91:	ff d0                	call   *%rax
+  803d93:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803d97:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  803d9e:	00 
+  803d9f:	e9 a2 00 00 00       	jmp    803e46 <pipe_size+0x18d>
+    if ((r = sys_page_alloc(0, va + i * PGSIZE, PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0)
+  803da4:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803da8:	48 c1 e0 0c          	shl    $0xc,%rax
+  803dac:	48 89 c2             	mov    %rax,%rdx
+  803daf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803db3:	48 01 d0             	add    %rdx,%rax
+  803db6:	ba 07 04 00 00       	mov    $0x407,%edx
+  803dbb:	48 89 c6             	mov    %rax,%rsi
+  803dbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc3:	48 b8 80 20 80 00 00 	movabs $0x802080,%rax
+  803dca:	00 00 00 
+  803dcd:	ff d0                	call   *%rax
+  803dcf:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803dd2:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803dd6:	0f 88 37 01 00 00    	js     803f13 <pipe_size+0x25a>
+      goto err2;
+    if ((r = sys_page_map(0, va + i * PGSIZE, 0, fd2data(fd1) + i * PGSIZE,
+  803ddc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803de0:	48 89 c7             	mov    %rax,%rdi
+  803de3:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  803dea:	00 00 00 
+  803ded:	ff d0                	call   *%rax
+  803def:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803df3:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803df7:	48 01 c2             	add    %rax,%rdx
+  803dfa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803dfe:	48 c1 e0 0c          	shl    $0xc,%rax
+  803e02:	48 89 c1             	mov    %rax,%rcx
+  803e05:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e09:	48 01 c8             	add    %rcx,%rax
+  803e0c:	41 b8 07 04 00 00    	mov    $0x407,%r8d
+  803e12:	48 89 d1             	mov    %rdx,%rcx
+  803e15:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e1a:	48 89 c6             	mov    %rax,%rsi
+  803e1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e22:	48 b8 d8 20 80 00 00 	movabs $0x8020d8,%rax
+  803e29:	00 00 00 
+  803e2c:	ff d0                	call   *%rax
+  803e2e:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  803e31:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  803e35:	79 0a                	jns    803e41 <pipe_size+0x188>
+                          PTE_P | PTE_W | PTE_U | PTE_SHARE)) < 0) {
+      i++;
+  803e37:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+      goto err2;
+  803e3c:	e9 d3 00 00 00       	jmp    803f14 <pipe_size+0x25b>
+  for (i = 0; i < PIPEPAGES(size); i++) {
+  803e41:	48 83 45 f0 01       	addq   $0x1,-0x10(%rbp)
+  803e46:	48 c7 45 e0 00 10 00 	movq   $0x1000,-0x20(%rbp)
+  803e4d:	00 
+  803e4e:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803e52:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  803e56:	48 01 d0             	add    %rdx,%rax
+  803e59:	48 83 c0 1f          	add    $0x1f,%rax
+  803e5d:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+  803e61:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e65:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e6a:	48 f7 75 e0          	divq   -0x20(%rbp)
+  803e6e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803e72:	48 29 d0             	sub    %rdx,%rax
+  803e75:	48 c1 e8 0c          	shr    $0xc,%rax
+  803e79:	48 39 45 f0          	cmp    %rax,-0x10(%rbp)
+  803e7d:	0f 82 21 ff ff ff    	jb     803da4 <pipe_size+0xeb>
+    }
+  }
+  p         = (struct Pipe *)va;
+  803e83:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803e87:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  p->p_size = size;
+  803e8b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e8f:	48 8b 55 b0          	mov    -0x50(%rbp),%rdx
+  803e93:	48 89 50 10          	mov    %rdx,0x10(%rax)
+
+  // set up fd structures
+  fd0->fd_dev_id = devpipe.dev_id;
+  803e97:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e9b:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803ea2:	00 00 00 
+  803ea5:	8b 12                	mov    (%rdx),%edx
+  803ea7:	89 10                	mov    %edx,(%rax)
+  fd0->fd_omode  = O_RDONLY;
+  803ea9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ead:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+
+  fd1->fd_dev_id = devpipe.dev_id;
+  803eb4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803eb8:	48 ba 80 60 80 00 00 	movabs $0x806080,%rdx
+  803ebf:	00 00 00 
+  803ec2:	8b 12                	mov    (%rdx),%edx
+  803ec4:	89 10                	mov    %edx,(%rax)
+  fd1->fd_omode  = O_WRONLY;
+  803ec6:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803eca:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+
+  if (debug)
+    cprintf("[%08x] pipecreate %08lx\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(va)]);
+
+  pfd[0] = fd2num(fd0);
+  803ed1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ed5:	48 89 c7             	mov    %rax,%rdi
+  803ed8:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  803edf:	00 00 00 
+  803ee2:	ff d0                	call   *%rax
+  803ee4:	89 c2                	mov    %eax,%edx
+  803ee6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803eea:	89 10                	mov    %edx,(%rax)
+  pfd[1] = fd2num(fd1);
+  803eec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ef0:	48 89 c7             	mov    %rax,%rdi
+  803ef3:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  803efa:	00 00 00 
+  803efd:	ff d0                	call   *%rax
+  803eff:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  803f03:	48 83 c2 04          	add    $0x4,%rdx
+  803f07:	89 02                	mov    %eax,(%rdx)
+  return 0;
+  803f09:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0e:	e9 a5 00 00 00       	jmp    803fb8 <pipe_size+0x2ff>
+      goto err2;
+  803f13:	90                   	nop
+
+err2:
+  while (i-- > 0) {
+  803f14:	eb 58                	jmp    803f6e <pipe_size+0x2b5>
+    sys_page_unmap(0, va + i * PGSIZE);
+  803f16:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f1a:	48 c1 e0 0c          	shl    $0xc,%rax
+  803f1e:	48 89 c2             	mov    %rax,%rdx
+  803f21:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803f25:	48 01 d0             	add    %rdx,%rax
+  803f28:	48 89 c6             	mov    %rax,%rsi
+  803f2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f30:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  803f37:	00 00 00 
+  803f3a:	ff d0                	call   *%rax
+    sys_page_unmap(0, fd2data(fd1) + i * PGSIZE);
+  803f3c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f40:	48 89 c7             	mov    %rax,%rdi
+  803f43:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  803f4a:	00 00 00 
+  803f4d:	ff d0                	call   *%rax
+  803f4f:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  803f53:	48 c1 e2 0c          	shl    $0xc,%rdx
+  803f57:	48 01 d0             	add    %rdx,%rax
+  803f5a:	48 89 c6             	mov    %rax,%rsi
+  803f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f62:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  803f69:	00 00 00 
+  803f6c:	ff d0                	call   *%rax
+  while (i-- > 0) {
+  803f6e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  803f72:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  803f76:	48 89 55 f0          	mov    %rdx,-0x10(%rbp)
+  803f7a:	48 85 c0             	test   %rax,%rax
+  803f7d:	75 97                	jne    803f16 <pipe_size+0x25d>
+  }
+  sys_page_unmap(0, fd1);
+  803f7f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803f83:	48 89 c6             	mov    %rax,%rsi
+  803f86:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f8b:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  803f92:	00 00 00 
+  803f95:	ff d0                	call   *%rax
+  803f97:	eb 01                	jmp    803f9a <pipe_size+0x2e1>
+    goto err1;
+  803f99:	90                   	nop
+err1:
+  sys_page_unmap(0, fd0);
+  803f9a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f9e:	48 89 c6             	mov    %rax,%rsi
+  803fa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fa6:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  803fad:	00 00 00 
+  803fb0:	ff d0                	call   *%rax
+  803fb2:	eb 01                	jmp    803fb5 <pipe_size+0x2fc>
+    goto err;
+  803fb4:	90                   	nop
+err:
+  return r;
+  803fb5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  803fb8:	c9                   	leave
+  803fb9:	c3                   	ret
+
+0000000000803fba <_pipeisclosed>:
+
+static int
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803fba:	55                   	push   %rbp
+  803fbb:	48 89 e5             	mov    %rsp,%rbp
+  803fbe:	53                   	push   %rbx
+  803fbf:	48 83 ec 28          	sub    $0x28,%rsp
+  803fc3:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  803fc7:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  int n, nn, ret;
+
+  while (1) {
+    n   = thisenv->env_runs;
+  803fcb:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  803fd2:	00 00 00 
+  803fd5:	8b 40 04             	mov    0x4(%rax),%eax
+  803fd8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803fdd:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  803fe4:	00 00 00 
+  803fe7:	48 98                	cltq
+  803fe9:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  803ff0:	48 01 d0             	add    %rdx,%rax
+  803ff3:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  803ff9:	8b 00                	mov    (%rax),%eax
+  803ffb:	89 45 ec             	mov    %eax,-0x14(%rbp)
+    ret = pageref(fd) == pageref(p);
+  803ffe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804002:	48 89 c7             	mov    %rax,%rdi
+  804005:	48 b8 c5 4f 80 00 00 	movabs $0x804fc5,%rax
+  80400c:	00 00 00 
+  80400f:	ff d0                	call   *%rax
+  804011:	89 c3                	mov    %eax,%ebx
+  804013:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804017:	48 89 c7             	mov    %rax,%rdi
+  80401a:	48 b8 c5 4f 80 00 00 	movabs $0x804fc5,%rax
+  804021:	00 00 00 
+  804024:	ff d0                	call   *%rax
+  804026:	39 c3                	cmp    %eax,%ebx
+  804028:	0f 94 c0             	sete   %al
+  80402b:	0f b6 c0             	movzbl %al,%eax
+  80402e:	89 45 e8             	mov    %eax,-0x18(%rbp)
+    nn  = thisenv->env_runs;
+  804031:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804038:	00 00 00 
+  80403b:	8b 40 04             	mov    0x4(%rax),%eax
+  80403e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804043:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  80404a:	00 00 00 
+  80404d:	48 98                	cltq
+  80404f:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804056:	48 01 d0             	add    %rdx,%rax
+  804059:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  80405f:	8b 00                	mov    (%rax),%eax
+  804061:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+    if (n == nn)
+  804064:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804067:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  80406a:	75 05                	jne    804071 <_pipeisclosed+0xb7>
+      return ret;
+  80406c:	8b 45 e8             	mov    -0x18(%rbp),%eax
+  80406f:	eb 68                	jmp    8040d9 <_pipeisclosed+0x11f>
+    if (n != nn)
+  804071:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804074:	3b 45 e4             	cmp    -0x1c(%rbp),%eax
+  804077:	0f 84 4e ff ff ff    	je     803fcb <_pipeisclosed+0x11>
+      cprintf("pipe race avoided: runs %d - %d, pageref eq: %d\n", n, thisenv->env_runs, ret);
+  80407d:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804084:	00 00 00 
+  804087:	8b 40 04             	mov    0x4(%rax),%eax
+  80408a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80408f:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804096:	00 00 00 
+  804099:	48 98                	cltq
+  80409b:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  8040a2:	48 01 d0             	add    %rdx,%rax
+  8040a5:	48 05 d8 00 00 00    	add    $0xd8,%rax
+  8040ab:	8b 10                	mov    (%rax),%edx
+  8040ad:	8b 4d e8             	mov    -0x18(%rbp),%ecx
+  8040b0:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8040b3:	89 c6                	mov    %eax,%esi
+  8040b5:	48 b8 00 57 80 00 00 	movabs $0x805700,%rax
+  8040bc:	00 00 00 
+  8040bf:	48 89 c7             	mov    %rax,%rdi
+  8040c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c7:	49 b8 02 03 80 00 00 	movabs $0x800302,%r8
+  8040ce:	00 00 00 
+  8040d1:	41 ff d0             	call   *%r8
+    n   = thisenv->env_runs;
+  8040d4:	e9 f2 fe ff ff       	jmp    803fcb <_pipeisclosed+0x11>
+  }
+}
+  8040d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040dd:	c9                   	leave
+  8040de:	c3                   	ret
+
+00000000008040df <pipeisclosed>:
+
+int
+pipeisclosed(int fdnum) {
+  8040df:	55                   	push   %rbp
+  8040e0:	48 89 e5             	mov    %rsp,%rbp
+  8040e3:	48 83 ec 30          	sub    $0x30,%rsp
+  8040e7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8040ea:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8040ee:	8b 45 dc             	mov    -0x24(%rbp),%eax
+  8040f1:	48 89 d6             	mov    %rdx,%rsi
+  8040f4:	89 c7                	mov    %eax,%edi
+  8040f6:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  8040fd:	00 00 00 
+  804100:	ff d0                	call   *%rax
+  804102:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804105:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804109:	79 05                	jns    804110 <pipeisclosed+0x31>
+    return r;
+  80410b:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80410e:	eb 31                	jmp    804141 <pipeisclosed+0x62>
+  p = (struct Pipe *)fd2data(fd);
+  804110:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804114:	48 89 c7             	mov    %rax,%rdi
+  804117:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  80411e:	00 00 00 
+  804121:	ff d0                	call   *%rax
+  804123:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  return _pipeisclosed(fd, p);
+  804127:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80412b:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  80412f:	48 89 d6             	mov    %rdx,%rsi
+  804132:	48 89 c7             	mov    %rax,%rdi
+  804135:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  80413c:	00 00 00 
+  80413f:	ff d0                	call   *%rax
+}
+  804141:	c9                   	leave
+  804142:	c3                   	ret
+
+0000000000804143 <pipe_changed>:
+
+// Note a change to the pipe and wake anyone waiting for one.
+static void
+pipe_changed(struct Pipe *p) {
+  804143:	55                   	push   %rbp
+  804144:	48 89 e5             	mov    %rsp,%rbp
+  804147:	48 83 ec 10          	sub    $0x10,%rsp
+  80414b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  p->p_seq++;
+  80414f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804153:	8b 40 18             	mov    0x18(%rax),%eax
+  804156:	8d 50 01             	lea    0x1(%rax),%edx
+  804159:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80415d:	89 50 18             	mov    %edx,0x18(%rax)
+  if (p->p_waiting) {
+  804160:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804164:	8b 40 1c             	mov    0x1c(%rax),%eax
+  804167:	85 c0                	test   %eax,%eax
+  804169:	74 27                	je     804192 <pipe_changed+0x4f>
+    p->p_waiting = 0;
+  80416b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80416f:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%rax)
+    sys_futex_wake(&p->p_seq, FUTEX_WAKE_ALL);
+  804176:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80417a:	48 83 c0 18          	add    $0x18,%rax
+  80417e:	be ff ff ff 7f       	mov    $0x7fffffff,%esi
+  804183:	48 89 c7             	mov    %rax,%rdi
+  804186:	48 b8 7b 24 80 00 00 	movabs $0x80247b,%rax
+  80418d:	00 00 00 
+  804190:	ff d0                	call   *%rax
+  }
+}
+  804192:	90                   	nop
+  804193:	c9                   	leave
+  804194:	c3                   	ret
+
+0000000000804195 <pipe_wait>:
+
+// Sleep until the pipe changes after p_seq read 'seq'.
+static void
+pipe_wait(struct Pipe *p, uint32_t seq) {
+  804195:	55                   	push   %rbp
+  804196:	48 89 e5             	mov    %rsp,%rbp
+  804199:	48 83 ec 10          	sub    $0x10,%rsp
+  80419d:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  8041a1:	89 75 f4             	mov    %esi,-0xc(%rbp)
+  p->p_waiting = 1;
+  8041a4:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041a8:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  sys_futex_wait(&p->p_seq, seq, FUTEX_NO_TIMEOUT);
+  8041af:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041b3:	48 8d 48 18          	lea    0x18(%rax),%rcx
+  8041b7:	8b 45 f4             	mov    -0xc(%rbp),%eax
+  8041ba:	48 c7 c2 ff ff ff ff 	mov    $0xffffffffffffffff,%rdx
+  8041c1:	89 c6                	mov    %eax,%esi
+  8041c3:	48 89 cf             	mov    %rcx,%rdi
+  8041c6:	48 b8 2c 24 80 00 00 	movabs $0x80242c,%rax
+  8041cd:	00 00 00 
+  8041d0:	ff d0                	call   *%rax
+}
+  8041d2:	90                   	nop
+  8041d3:	c9                   	leave
+  8041d4:	c3                   	ret
+
+00000000008041d5 <devpipe_read>:
+
+static ssize_t
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8041d5:	55                   	push   %rbp
+  8041d6:	48 89 e5             	mov    %rsp,%rbp
+  8041d9:	48 83 ec 70          	sub    $0x70,%rsp
+  8041dd:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8041e1:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  8041e5:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  uint8_t *buf;
+  size_t off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  8041e9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8041ed:	48 89 c7             	mov    %rax,%rdi
+  8041f0:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  8041f7:	00 00 00 
+  8041fa:	ff d0                	call   *%rax
+  8041fc:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_read %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  if (n == 0)
+  804200:	48 83 7d 98 00       	cmpq   $0x0,-0x68(%rbp)
+  804205:	75 0a                	jne    804211 <devpipe_read+0x3c>
+    return 0;
+  804207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420c:	e9 63 01 00 00       	jmp    804374 <devpipe_read+0x19f>
+
+  while (1) {
+    seq = p->p_seq;
+  804211:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804215:	8b 40 18             	mov    0x18(%rax),%eax
+  804218:	89 45 f4             	mov    %eax,-0xc(%rbp)
+    if (p->p_rpos != p->p_wpos)
+  80421b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80421f:	48 8b 10             	mov    (%rax),%rdx
+  804222:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804226:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80422a:	48 39 c2             	cmp    %rax,%rdx
+  80422d:	75 42                	jne    804271 <devpipe_read+0x9c>
+      break;
+    // pipe is empty
+    // if all the writers are gone, note eof
+    if (_pipeisclosed(fd, p))
+  80422f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804233:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804237:	48 89 d6             	mov    %rdx,%rsi
+  80423a:	48 89 c7             	mov    %rax,%rdi
+  80423d:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  804244:	00 00 00 
+  804247:	ff d0                	call   *%rax
+  804249:	85 c0                	test   %eax,%eax
+  80424b:	74 0a                	je     804257 <devpipe_read+0x82>
+      return 0;
+  80424d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804252:	e9 1d 01 00 00       	jmp    804374 <devpipe_read+0x19f>
+    // wait for a writer
+    if (debug)
+      cprintf("devpipe_read wait\n");
+    pipe_wait(p, seq);
+  804257:	8b 55 f4             	mov    -0xc(%rbp),%edx
+  80425a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80425e:	89 d6                	mov    %edx,%esi
+  804260:	48 89 c7             	mov    %rax,%rdi
+  804263:	48 b8 95 41 80 00 00 	movabs $0x804195,%rax
+  80426a:	00 00 00 
+  80426d:	ff d0                	call   *%rax
+    seq = p->p_seq;
+  80426f:	eb a0                	jmp    804211 <devpipe_read+0x3c>
+      break;
+  804271:	90                   	nop
+  }
+
+  // take what is there, in at most two pieces.
+  // wait to advance rpos until the bytes are taken!
+  buf = vbuf;
+  804272:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  804276:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  n   = MIN(n, p->p_wpos - p->p_rpos);
+  80427a:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80427e:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  804282:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804286:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80428a:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80428e:	48 8b 00             	mov    (%rax),%rax
+  804291:	48 29 c2             	sub    %rax,%rdx
+  804294:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804298:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  80429c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8042a0:	48 39 c2             	cmp    %rax,%rdx
+  8042a3:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8042a7:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+  off = p->p_rpos % p->p_size;
+  8042ab:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042af:	48 8b 00             	mov    (%rax),%rax
+  8042b2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042b6:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  8042ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042bf:	48 f7 f1             	div    %rcx
+  8042c2:	48 89 55 d0          	mov    %rdx,-0x30(%rbp)
+  m   = MIN(n, p->p_size - off);
+  8042c6:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  8042ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  8042ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042d2:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8042d6:	48 2b 45 d0          	sub    -0x30(%rbp),%rax
+  8042da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042de:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  8042e2:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8042e6:	48 39 c2             	cmp    %rax,%rdx
+  8042e9:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8042ed:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  memcpy(buf, p->p_buf + off, m);
+  8042f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8042f5:	48 8d 50 20          	lea    0x20(%rax),%rdx
+  8042f9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8042fd:	48 8d 0c 02          	lea    (%rdx,%rax,1),%rcx
+  804301:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804305:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804309:	48 89 ce             	mov    %rcx,%rsi
+  80430c:	48 89 c7             	mov    %rax,%rdi
+  80430f:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  804316:	00 00 00 
+  804319:	ff d0                	call   *%rax
+  memcpy(buf + m, p->p_buf, n - m);
+  80431b:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80431f:	48 2b 45 b8          	sub    -0x48(%rbp),%rax
+  804323:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804327:	48 8d 72 20          	lea    0x20(%rdx),%rsi
+  80432b:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  80432f:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  804333:	48 01 d1             	add    %rdx,%rcx
+  804336:	48 89 c2             	mov    %rax,%rdx
+  804339:	48 89 cf             	mov    %rcx,%rdi
+  80433c:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  804343:	00 00 00 
+  804346:	ff d0                	call   *%rax
+  p->p_rpos += n;
+  804348:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80434c:	48 8b 10             	mov    (%rax),%rdx
+  80434f:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804353:	48 01 c2             	add    %rax,%rdx
+  804356:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80435a:	48 89 10             	mov    %rdx,(%rax)
+  pipe_changed(p);
+  80435d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804361:	48 89 c7             	mov    %rax,%rdi
+  804364:	48 b8 43 41 80 00 00 	movabs $0x804143,%rax
+  80436b:	00 00 00 
+  80436e:	ff d0                	call   *%rax
+  return n;
+  804370:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+}
+  804374:	c9                   	leave
+  804375:	c3                   	ret
+
+0000000000804376 <devpipe_write>:
+
+static ssize_t
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804376:	55                   	push   %rbp
+  804377:	48 89 e5             	mov    %rsp,%rbp
+  80437a:	48 83 ec 70          	sub    $0x70,%rsp
+  80437e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  804382:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  804386:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+  const uint8_t *buf;
+  size_t i, off, m;
+  uint32_t seq;
+  struct Pipe *p;
+
+  p = (struct Pipe *)fd2data(fd);
+  80438a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80438e:	48 89 c7             	mov    %rax,%rdi
+  804391:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  804398:	00 00 00 
+  80439b:	ff d0                	call   *%rax
+  80439d:	48 89 45 e8          	mov    %rax,-0x18(%rbp)
+  if (debug)
+    cprintf("[%08x] devpipe_write %08lx %lu rpos %ld wpos %ld\n",
+            thisenv->env_id, (unsigned long)uvpt[PGNUM(p)],
+            (unsigned long)n, (long)p->p_rpos, (long)p->p_wpos);
+
+  buf = vbuf;
+  8043a1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8043a5:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  for (i = 0; i < n; i += m) {
+  8043a9:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  8043b0:	00 
+  8043b1:	e9 b8 01 00 00       	jmp    80456e <devpipe_write+0x1f8>
+    seq = p->p_seq;
+  8043b6:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043ba:	8b 40 18             	mov    0x18(%rax),%eax
+  8043bd:	89 45 dc             	mov    %eax,-0x24(%rbp)
+    if (p->p_wpos - p->p_rpos == p->p_size) {
+  8043c0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043c4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8043c8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043cc:	48 8b 00             	mov    (%rax),%rax
+  8043cf:	48 29 c2             	sub    %rax,%rdx
+  8043d2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8043d6:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8043da:	48 39 c2             	cmp    %rax,%rdx
+  8043dd:	75 4d                	jne    80442c <devpipe_write+0xb6>
+      // pipe is full
+      // if all the readers are gone
+      // (it's only writers like us now),
+      // note eof
+      if (_pipeisclosed(fd, p))
+  8043df:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8043e3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8043e7:	48 89 d6             	mov    %rdx,%rsi
+  8043ea:	48 89 c7             	mov    %rax,%rdi
+  8043ed:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  8043f4:	00 00 00 
+  8043f7:	ff d0                	call   *%rax
+  8043f9:	85 c0                	test   %eax,%eax
+  8043fb:	74 0a                	je     804407 <devpipe_write+0x91>
+        return 0;
+  8043fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804402:	e9 79 01 00 00       	jmp    804580 <devpipe_write+0x20a>
+      // wait for a reader
+      if (debug)
+        cprintf("devpipe_write wait\n");
+      pipe_wait(p, seq);
+  804407:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  80440a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80440e:	89 d6                	mov    %edx,%esi
+  804410:	48 89 c7             	mov    %rax,%rdi
+  804413:	48 b8 95 41 80 00 00 	movabs $0x804195,%rax
+  80441a:	00 00 00 
+  80441d:	ff d0                	call   *%rax
+      m = 0;
+  80441f:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  804426:	00 
+      continue;
+  804427:	e9 3a 01 00 00       	jmp    804566 <devpipe_write+0x1f0>
+    }
+    // store as much as fits, in at most two pieces.
+    // wait to advance wpos until the bytes are stored!
+    m   = MIN(n - i, p->p_size - (p->p_wpos - p->p_rpos));
+  80442c:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  804430:	48 2b 45 f8          	sub    -0x8(%rbp),%rax
+  804434:	48 89 45 d0          	mov    %rax,-0x30(%rbp)
+  804438:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80443c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804440:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804444:	48 8b 08             	mov    (%rax),%rcx
+  804447:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80444b:	48 8b 40 08          	mov    0x8(%rax),%rax
+  80444f:	48 29 c1             	sub    %rax,%rcx
+  804452:	48 8d 04 0a          	lea    (%rdx,%rcx,1),%rax
+  804456:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  80445a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80445e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804462:	48 39 c2             	cmp    %rax,%rdx
+  804465:	48 0f 46 c2          	cmovbe %rdx,%rax
+  804469:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+    off = p->p_wpos % p->p_size;
+  80446d:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804471:	48 8b 40 08          	mov    0x8(%rax),%rax
+  804475:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804479:	48 8b 4a 10          	mov    0x10(%rdx),%rcx
+  80447d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804482:	48 f7 f1             	div    %rcx
+  804485:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    memcpy(p->p_buf + off, buf + i, MIN(m, p->p_size - off));
+  804489:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80448d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804491:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804495:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804499:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  80449d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+  8044a1:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8044a5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8044a9:	48 39 c2             	cmp    %rax,%rdx
+  8044ac:	48 0f 46 c2          	cmovbe %rdx,%rax
+  8044b0:	48 8b 4d e0          	mov    -0x20(%rbp),%rcx
+  8044b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044b8:	48 8d 34 11          	lea    (%rcx,%rdx,1),%rsi
+  8044bc:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  8044c0:	48 8d 4a 20          	lea    0x20(%rdx),%rcx
+  8044c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8044c8:	48 01 d1             	add    %rdx,%rcx
+  8044cb:	48 89 c2             	mov    %rax,%rdx
+  8044ce:	48 89 cf             	mov    %rcx,%rdi
+  8044d1:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  8044d8:	00 00 00 
+  8044db:	ff d0                	call   *%rax
+    if (m > p->p_size - off)
+  8044dd:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044e1:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8044e5:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  8044e9:	48 3b 45 f0          	cmp    -0x10(%rbp),%rax
+  8044ed:	73 4d                	jae    80453c <devpipe_write+0x1c6>
+      memcpy(p->p_buf, buf + i + (p->p_size - off), m - (p->p_size - off));
+  8044ef:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8044f3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8044f7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8044fb:	48 29 c2             	sub    %rax,%rdx
+  8044fe:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804502:	48 01 c2             	add    %rax,%rdx
+  804505:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804509:	48 8b 40 10          	mov    0x10(%rax),%rax
+  80450d:	48 2b 45 c0          	sub    -0x40(%rbp),%rax
+  804511:	48 89 c1             	mov    %rax,%rcx
+  804514:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804518:	48 01 c1             	add    %rax,%rcx
+  80451b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80451f:	48 01 c1             	add    %rax,%rcx
+  804522:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804526:	48 83 c0 20          	add    $0x20,%rax
+  80452a:	48 89 ce             	mov    %rcx,%rsi
+  80452d:	48 89 c7             	mov    %rax,%rdi
+  804530:	48 b8 fb 19 80 00 00 	movabs $0x8019fb,%rax
+  804537:	00 00 00 
+  80453a:	ff d0                	call   *%rax
+    p->p_wpos += m;
+  80453c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804540:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804544:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804548:	48 01 c2             	add    %rax,%rdx
+  80454b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80454f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    pipe_changed(p);
+  804553:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804557:	48 89 c7             	mov    %rax,%rdi
+  80455a:	48 b8 43 41 80 00 00 	movabs $0x804143,%rax
+  804561:	00 00 00 
+  804564:	ff d0                	call   *%rax
+  for (i = 0; i < n; i += m) {
+  804566:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80456a:	48 01 45 f8          	add    %rax,-0x8(%rbp)
+  80456e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804572:	48 3b 45 98          	cmp    -0x68(%rbp),%rax
+  804576:	0f 82 3a fe ff ff    	jb     8043b6 <devpipe_write+0x40>
+  }
+
+  return i;
+  80457c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  804580:	c9                   	leave
+  804581:	c3                   	ret
+
+0000000000804582 <devpipe_poll>:
+
+static int
+devpipe_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804582:	55                   	push   %rbp
+  804583:	48 89 e5             	mov    %rsp,%rbp
+  804586:	48 83 ec 40          	sub    $0x40,%rsp
+  80458a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+  80458e:	89 75 d4             	mov    %esi,-0x2c(%rbp)
+  804591:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804595:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804599:	48 89 c7             	mov    %rax,%rdi
+  80459c:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  8045a3:	00 00 00 
+  8045a6:	ff d0                	call   *%rax
+  8045a8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  int r, revents = 0;
+  8045ac:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+
+  // take the key before looking, so any later change wakes us
+  if ((r = pollwait_key(w, &p->p_seq)) < 0)
+  8045b3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045b7:	48 8d 50 18          	lea    0x18(%rax),%rdx
+  8045bb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8045bf:	48 89 d6             	mov    %rdx,%rsi
+  8045c2:	48 89 c7             	mov    %rax,%rdi
+  8045c5:	48 b8 5d 32 80 00 00 	movabs $0x80325d,%rax
+  8045cc:	00 00 00 
+  8045cf:	ff d0                	call   *%rax
+  8045d1:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  8045d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%rbp)
+  8045d8:	79 08                	jns    8045e2 <devpipe_poll+0x60>
+    return r;
+  8045da:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8045dd:	e9 85 00 00 00       	jmp    804667 <devpipe_poll+0xe5>
+  if ((events & POLLIN) && p->p_rpos != p->p_wpos)
+  8045e2:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  8045e5:	83 e0 01             	and    $0x1,%eax
+  8045e8:	85 c0                	test   %eax,%eax
+  8045ea:	74 18                	je     804604 <devpipe_poll+0x82>
+  8045ec:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045f0:	48 8b 10             	mov    (%rax),%rdx
+  8045f3:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8045f7:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8045fb:	48 39 c2             	cmp    %rax,%rdx
+  8045fe:	74 04                	je     804604 <devpipe_poll+0x82>
+    revents |= POLLIN;
+  804600:	83 4d fc 01          	orl    $0x1,-0x4(%rbp)
+  if ((events & POLLOUT) && p->p_wpos - p->p_rpos < p->p_size)
+  804604:	8b 45 d4             	mov    -0x2c(%rbp),%eax
+  804607:	83 e0 02             	and    $0x2,%eax
+  80460a:	85 c0                	test   %eax,%eax
+  80460c:	74 23                	je     804631 <devpipe_poll+0xaf>
+  80460e:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804612:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804616:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80461a:	48 8b 00             	mov    (%rax),%rax
+  80461d:	48 29 c2             	sub    %rax,%rdx
+  804620:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804624:	48 8b 40 10          	mov    0x10(%rax),%rax
+  804628:	48 39 c2             	cmp    %rax,%rdx
+  80462b:	73 04                	jae    804631 <devpipe_poll+0xaf>
+    revents |= POLLOUT;
+  80462d:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (_pipeisclosed(fd, p))
+  804631:	48 8b 55 f0          	mov    -0x10(%rbp),%rdx
+  804635:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804639:	48 89 d6             	mov    %rdx,%rsi
+  80463c:	48 89 c7             	mov    %rax,%rdi
+  80463f:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  804646:	00 00 00 
+  804649:	ff d0                	call   *%rax
+  80464b:	85 c0                	test   %eax,%eax
+  80464d:	74 04                	je     804653 <devpipe_poll+0xd1>
+    revents |= POLLHUP;
+  80464f:	83 4d fc 04          	orl    $0x4,-0x4(%rbp)
+  if (!revents)
+  804653:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804657:	75 0b                	jne    804664 <devpipe_poll+0xe2>
+    p->p_waiting = 1;
+  804659:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80465d:	c7 40 1c 01 00 00 00 	movl   $0x1,0x1c(%rax)
+  return revents;
+  804664:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804667:	c9                   	leave
+  804668:	c3                   	ret
+
+0000000000804669 <devpipe_stat>:
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804669:	55                   	push   %rbp
+  80466a:	48 89 e5             	mov    %rsp,%rbp
+  80466d:	48 83 ec 20          	sub    $0x20,%rsp
+  804671:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804675:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804679:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80467d:	48 89 c7             	mov    %rax,%rdi
+  804680:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  804687:	00 00 00 
+  80468a:	ff d0                	call   *%rax
+  80468c:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  strcpy(stat->st_name, "<pipe>");
+  804690:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804694:	48 ba 31 57 80 00 00 	movabs $0x805731,%rdx
+  80469b:	00 00 00 
+  80469e:	48 89 d6             	mov    %rdx,%rsi
+  8046a1:	48 89 c7             	mov    %rax,%rdi
+  8046a4:	48 b8 b2 12 80 00 00 	movabs $0x8012b2,%rax
+  8046ab:	00 00 00 
+  8046ae:	ff d0                	call   *%rax
+  stat->st_size  = p->p_wpos - p->p_rpos;
+  8046b0:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046b4:	48 8b 40 08          	mov    0x8(%rax),%rax
+  8046b8:	89 c1                	mov    %eax,%ecx
+  8046ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8046be:	48 8b 00             	mov    (%rax),%rax
+  8046c1:	89 c2                	mov    %eax,%edx
+  8046c3:	89 c8                	mov    %ecx,%eax
+  8046c5:	29 d0                	sub    %edx,%eax
+  8046c7:	89 c2                	mov    %eax,%edx
+  8046c9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046cd:	89 90 80 00 00 00    	mov    %edx,0x80(%rax)
+  stat->st_isdir = 0;
+  8046d3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046d7:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%rax)
+  8046de:	00 00 00 
+  stat->st_dev   = &devpipe;
+  8046e1:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8046e5:	48 b9 80 60 80 00 00 	movabs $0x806080,%rcx
+  8046ec:	00 00 00 
+  8046ef:	48 89 88 88 00 00 00 	mov    %rcx,0x88(%rax)
+  return 0;
+  8046f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046fb:	c9                   	leave
+  8046fc:	c3                   	ret
+
+00000000008046fd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8046fd:	55                   	push   %rbp
+  8046fe:	48 89 e5             	mov    %rsp,%rbp
+  804701:	48 83 ec 40          	sub    $0x40,%rsp
+  804705:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804709:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80470d:	48 89 c7             	mov    %rax,%rdi
+  804710:	48 b8 8a 27 80 00 00 	movabs $0x80278a,%rax
+  804717:	00 00 00 
+  80471a:	ff d0                	call   *%rax
+  80471c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  size_t i, npages = PIPEPAGES(p->p_size);
+  804720:	48 c7 45 e8 00 10 00 	movq   $0x1000,-0x18(%rbp)
+  804727:	00 
+  804728:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80472c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804730:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804734:	48 01 d0             	add    %rdx,%rax
+  804737:	48 83 c0 1f          	add    $0x1f,%rax
+  80473b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  80473f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804743:	ba 00 00 00 00       	mov    $0x0,%edx
+  804748:	48 f7 75 e8          	divq   -0x18(%rbp)
+  80474c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804750:	48 29 d0             	sub    %rdx,%rax
+  804753:	48 c1 e8 0c          	shr    $0xc,%rax
+  804757:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+
+  (void)sys_page_unmap(0, fd);
+  80475b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80475f:	48 89 c6             	mov    %rax,%rsi
+  804762:	bf 00 00 00 00       	mov    $0x0,%edi
+  804767:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  80476e:	00 00 00 
+  804771:	ff d0                	call   *%rax
+  // the other end may be waiting to find out it is alone now
+  pipe_changed(p);
+  804773:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804777:	48 89 c7             	mov    %rax,%rdi
+  80477a:	48 b8 43 41 80 00 00 	movabs $0x804143,%rax
+  804781:	00 00 00 
+  804784:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  804786:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80478a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  80478e:	eb 2f                	jmp    8047bf <devpipe_close+0xc2>
+    (void)sys_page_unmap(0, (char *)p + (i - 1) * PGSIZE);
+  804790:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804794:	48 83 e8 01          	sub    $0x1,%rax
+  804798:	48 c1 e0 0c          	shl    $0xc,%rax
+  80479c:	48 89 c2             	mov    %rax,%rdx
+  80479f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047a3:	48 01 d0             	add    %rdx,%rax
+  8047a6:	48 89 c6             	mov    %rax,%rsi
+  8047a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047ae:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  8047b5:	00 00 00 
+  8047b8:	ff d0                	call   *%rax
+  for (i = npages; i > 1; i--)
+  8047ba:	48 83 6d f8 01       	subq   $0x1,-0x8(%rbp)
+  8047bf:	48 83 7d f8 01       	cmpq   $0x1,-0x8(%rbp)
+  8047c4:	77 ca                	ja     804790 <devpipe_close+0x93>
+  return sys_page_unmap(0, p);
+  8047c6:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8047ca:	48 89 c6             	mov    %rax,%rsi
+  8047cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047d2:	48 b8 38 21 80 00 00 	movabs $0x802138,%rax
+  8047d9:	00 00 00 
+  8047dc:	ff d0                	call   *%rax
+}
+  8047de:	c9                   	leave
+  8047df:	c3                   	ret
+
+00000000008047e0 <vsyscall>:
+#include <inc/vsyscall.h>
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+static inline uint64_t
+vsyscall(int num) {
+  8047e0:	55                   	push   %rbp
+  8047e1:	48 89 e5             	mov    %rsp,%rbp
+  8047e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8047e8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  // LAB 12: Your code here.
+  switch(num) {
+  8047eb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8047ef:	75 10                	jne    804801 <vsyscall+0x21>
+    case VSYS_gettime:
+      return vsys[VSYS_gettime];
+  8047f1:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  8047f8:	00 00 00 
+  8047fb:	8b 00                	mov    (%rax),%eax
+  8047fd:	48 98                	cltq
+  8047ff:	eb 05                	jmp    804806 <vsyscall+0x26>
+  }
+  return 0;
+  804801:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804806:	c9                   	leave
+  804807:	c3                   	ret
+
+0000000000804808 <vsys_gettime>:
+
+int
+vsys_gettime(void) {
+  804808:	55                   	push   %rbp
+  804809:	48 89 e5             	mov    %rsp,%rbp
+  return vsyscall(VSYS_gettime);
+  80480c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804811:	48 b8 e0 47 80 00 00 	movabs $0x8047e0,%rax
+  804818:	00 00 00 
+  80481b:	ff d0                	call   *%rax
+}
+  80481d:	5d                   	pop    %rbp
+  80481e:	c3                   	ret
+
+000000000080481f <vsys_clock_ns>:
+
+// Nanoseconds counted by the TSC, at the frequency the kernel
+// measured at boot.  For deadlines, not for the time of day.
+uint64_t
+vsys_clock_ns(void) {
+  80481f:	55                   	push   %rbp
+  804820:	48 89 e5             	mov    %rsp,%rbp
+  804823:	48 83 ec 20          	sub    $0x20,%rsp
+
+static __inline uint64_t
+read_tsc(void) {
+  uint32_t lo, hi;
+  uint64_t res;
+  __asm __volatile("rdtsc"
+  804827:	0f 31                	rdtsc
+  804829:	89 45 ec             	mov    %eax,-0x14(%rbp)
+  80482c:	89 55 e8             	mov    %edx,-0x18(%rbp)
+                   : "=a"(lo), "=d"(hi));
+  res = (uint64_t)lo | ((uint64_t)hi << 32);
+  80482f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804832:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804835:	48 c1 e2 20          	shl    $0x20,%rdx
+  804839:	48 09 d0             	or     %rdx,%rax
+  80483c:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  return res;
+  804840:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  uint64_t tsc = read_tsc(), khz = vsys[VSYS_tsc_khz];
+  804844:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  804848:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  80484f:	00 00 00 
+  804852:	8b 40 08             	mov    0x8(%rax),%eax
+  804855:	48 98                	cltq
+  804857:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+
+  return tsc / khz * 1000000 + tsc % khz * 1000000 / khz;
+  80485b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80485f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804864:	48 f7 75 f0          	divq   -0x10(%rbp)
+  804868:	48 69 c8 40 42 0f 00 	imul   $0xf4240,%rax,%rcx
+  80486f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804873:	ba 00 00 00 00       	mov    $0x0,%edx
+  804878:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80487c:	48 89 d0             	mov    %rdx,%rax
+  80487f:	48 69 c0 40 42 0f 00 	imul   $0xf4240,%rax,%rax
+  804886:	ba 00 00 00 00       	mov    $0x0,%edx
+  80488b:	48 f7 75 f0          	divq   -0x10(%rbp)
+  80488f:	48 01 c8             	add    %rcx,%rax
+}
+  804892:	c9                   	leave
+  804893:	c3                   	ret
+
+0000000000804894 <cputchar>:
+
+#include <inc/string.h>
+#include <inc/lib.h>
+
+void
+cputchar(int ch) {
+  804894:	55                   	push   %rbp
+  804895:	48 89 e5             	mov    %rsp,%rbp
+  804898:	48 83 ec 20          	sub    $0x20,%rsp
+  80489c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  char c = ch;
+  80489f:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8048a2:	88 45 ff             	mov    %al,-0x1(%rbp)
+
+  // Unlike standard Unix's putchar,
+  // the cputchar function _always_ outputs to the system console.
+  sys_cputs(&c, 1);
+  8048a5:	48 8d 45 ff          	lea    -0x1(%rbp),%rax
+  8048a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8048ae:	48 89 c7             	mov    %rax,%rdi
+  8048b1:	48 b8 69 1e 80 00 00 	movabs $0x801e69,%rax
+  8048b8:	00 00 00 
+  8048bb:	ff d0                	call   *%rax
+}
+  8048bd:	90                   	nop
+  8048be:	c9                   	leave
+  8048bf:	c3                   	ret
+
+00000000008048c0 <getchar>:
+
+int
+getchar(void) {
+  8048c0:	55                   	push   %rbp
+  8048c1:	48 89 e5             	mov    %rsp,%rbp
+  8048c4:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+
+  // JOS does, however, support standard _input_ redirection,
+  // allowing the user to redirect script files to the shell and such.
+  // getchar() reads a character from file descriptor 0.
+  r = read(0, &c, 1);
+  8048c8:	48 8d 45 fb          	lea    -0x5(%rbp),%rax
+  8048cc:	ba 01 00 00 00       	mov    $0x1,%edx
+  8048d1:	48 89 c6             	mov    %rax,%rsi
+  8048d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048d9:	48 b8 f3 2d 80 00 00 	movabs $0x802df3,%rax
+  8048e0:	00 00 00 
+  8048e3:	ff d0                	call   *%rax
+  8048e5:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  if (r < 0)
+  8048e8:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048ec:	79 05                	jns    8048f3 <getchar+0x33>
+    return r;
+  8048ee:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8048f1:	eb 14                	jmp    804907 <getchar+0x47>
+  if (r < 1)
+  8048f3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8048f7:	7f 07                	jg     804900 <getchar+0x40>
+    return -E_EOF;
+  8048f9:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8048fe:	eb 07                	jmp    804907 <getchar+0x47>
+  return c;
+  804900:	0f b6 45 fb          	movzbl -0x5(%rbp),%eax
+  804904:	0f b6 c0             	movzbl %al,%eax
+}
+  804907:	c9                   	leave
+  804908:	c3                   	ret
+
+0000000000804909 <iscons>:
+        .dev_close = devcons_close,
+        .dev_stat  = devcons_stat,
+        .dev_poll  = devcons_poll};
+
+int
+iscons(int fdnum) {
+  804909:	55                   	push   %rbp
+  80490a:	48 89 e5             	mov    %rsp,%rbp
+  80490d:	48 83 ec 20          	sub    $0x20,%rsp
+  804911:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804914:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  804918:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  80491b:	48 89 d6             	mov    %rdx,%rsi
+  80491e:	89 c7                	mov    %eax,%edi
+  804920:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  804927:	00 00 00 
+  80492a:	ff d0                	call   *%rax
+  80492c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80492f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804933:	79 05                	jns    80493a <iscons+0x31>
+    return r;
+  804935:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804938:	eb 1a                	jmp    804954 <iscons+0x4b>
+  return fd->fd_dev_id == devcons.dev_id;
+  80493a:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  80493e:	8b 10                	mov    (%rax),%edx
+  804940:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804947:	00 00 00 
+  80494a:	8b 00                	mov    (%rax),%eax
+  80494c:	39 c2                	cmp    %eax,%edx
+  80494e:	0f 94 c0             	sete   %al
+  804951:	0f b6 c0             	movzbl %al,%eax
+}
+  804954:	c9                   	leave
+  804955:	c3                   	ret
+
+0000000000804956 <opencons>:
+
+int
+opencons(void) {
+  804956:	55                   	push   %rbp
+  804957:	48 89 e5             	mov    %rsp,%rbp
+  80495a:	48 83 ec 10          	sub    $0x10,%rsp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_alloc(&fd)) < 0)
+  80495e:	48 8d 45 f0          	lea    -0x10(%rbp),%rax
+  804962:	48 89 c7             	mov    %rax,%rdi
+  804965:	48 b8 b5 27 80 00 00 	movabs $0x8027b5,%rax
+  80496c:	00 00 00 
+  80496f:	ff d0                	call   *%rax
+  804971:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804974:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804978:	79 05                	jns    80497f <opencons+0x29>
+    return r;
+  80497a:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  80497d:	eb 66                	jmp    8049e5 <opencons+0x8f>
+  if ((r = sys_page_alloc(0, fd, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+  80497f:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804983:	ba 07 04 00 00       	mov    $0x407,%edx
+  804988:	48 89 c6             	mov    %rax,%rsi
+  80498b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804990:	48 b8 80 20 80 00 00 	movabs $0x802080,%rax
+  804997:	00 00 00 
+  80499a:	ff d0                	call   *%rax
+  80499c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  80499f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  8049a3:	79 05                	jns    8049aa <opencons+0x54>
+    return r;
+  8049a5:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  8049a8:	eb 3b                	jmp    8049e5 <opencons+0x8f>
+  fd->fd_dev_id    = devcons.dev_id;
+  8049aa:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049ae:	48 ba c0 60 80 00 00 	movabs $0x8060c0,%rdx
+  8049b5:	00 00 00 
+  8049b8:	8b 12                	mov    (%rdx),%edx
+  8049ba:	89 10                	mov    %edx,(%rax)
+  fd->fd_omode     = O_RDWR;
+  8049bc:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049c0:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%rax)
+  fd->fd_cons.mode = CONS_RAW;
+  8049c7:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049cb:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%rax)
+  return fd2num(fd);
+  8049d2:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  8049d6:	48 89 c7             	mov    %rax,%rdi
+  8049d9:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  8049e0:	00 00 00 
+  8049e3:	ff d0                	call   *%rax
+}
+  8049e5:	c9                   	leave
+  8049e6:	c3                   	ret
+
+00000000008049e7 <consmode>:
+// Set the input mode of console fd 'fdnum' to CONS_RAW or CONS_COOKED.
+// In cooked mode the kernel echoes and edits input,
+// and each read returns at most one line.
+// Returns the previous mode, or < 0 on error.
+int
+consmode(int fdnum, int mode) {
+  8049e7:	55                   	push   %rbp
+  8049e8:	48 89 e5             	mov    %rsp,%rbp
+  8049eb:	48 83 ec 20          	sub    $0x20,%rsp
+  8049ef:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  8049f2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8049f5:	48 8d 55 f0          	lea    -0x10(%rbp),%rdx
+  8049f9:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  8049fc:	48 89 d6             	mov    %rdx,%rsi
+  8049ff:	89 c7                	mov    %eax,%edi
+  804a01:	48 b8 97 28 80 00 00 	movabs $0x802897,%rax
+  804a08:	00 00 00 
+  804a0b:	ff d0                	call   *%rax
+  804a0d:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804a10:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804a14:	79 05                	jns    804a1b <consmode+0x34>
+    return r;
+  804a16:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804a19:	eb 34                	jmp    804a4f <consmode+0x68>
+  if (fd->fd_dev_id != devcons.dev_id)
+  804a1b:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a1f:	8b 10                	mov    (%rax),%edx
+  804a21:	48 b8 c0 60 80 00 00 	movabs $0x8060c0,%rax
+  804a28:	00 00 00 
+  804a2b:	8b 00                	mov    (%rax),%eax
+  804a2d:	39 c2                	cmp    %eax,%edx
+  804a2f:	74 07                	je     804a38 <consmode+0x51>
+    return -E_INVAL;
+  804a31:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804a36:	eb 17                	jmp    804a4f <consmode+0x68>
+  r                = fd->fd_cons.mode;
+  804a38:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a3c:	8b 40 0c             	mov    0xc(%rax),%eax
+  804a3f:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  fd->fd_cons.mode = mode;
+  804a42:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a46:	8b 55 e8             	mov    -0x18(%rbp),%edx
+  804a49:	89 50 0c             	mov    %edx,0xc(%rax)
+  return r;
+  804a4c:	8b 45 fc             	mov    -0x4(%rbp),%eax
+}
+  804a4f:	c9                   	leave
+  804a50:	c3                   	ret
+
+0000000000804a51 <devcons_read>:
+
+static ssize_t
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804a51:	55                   	push   %rbp
+  804a52:	48 89 e5             	mov    %rsp,%rbp
+  804a55:	48 83 ec 20          	sub    $0x20,%rsp
+  804a59:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804a5d:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804a61:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  // The kernel blocks until there is input, and ctl-d reads as eof.
+  return sys_cons_read(vbuf, n, fd->fd_cons.mode);
+  804a65:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804a69:	8b 50 0c             	mov    0xc(%rax),%edx
+  804a6c:	48 8b 4d e8          	mov    -0x18(%rbp),%rcx
+  804a70:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804a74:	48 89 ce             	mov    %rcx,%rsi
+  804a77:	48 89 c7             	mov    %rax,%rdi
+  804a7a:	48 b8 da 23 80 00 00 	movabs $0x8023da,%rax
+  804a81:	00 00 00 
+  804a84:	ff d0                	call   *%rax
+  804a86:	48 98                	cltq
+}
+  804a88:	c9                   	leave
+  804a89:	c3                   	ret
+
+0000000000804a8a <devcons_write>:
+
+static ssize_t
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804a8a:	55                   	push   %rbp
+  804a8b:	48 89 e5             	mov    %rsp,%rbp
+  804a8e:	48 81 ec b0 00 00 00 	sub    $0xb0,%rsp
+  804a95:	48 89 bd 68 ff ff ff 	mov    %rdi,-0x98(%rbp)
+  804a9c:	48 89 b5 60 ff ff ff 	mov    %rsi,-0xa0(%rbp)
+  804aa3:	48 89 95 58 ff ff ff 	mov    %rdx,-0xa8(%rbp)
+  int tot, m;
+  char buf[128];
+
+  // mistake: have to nul-terminate arg to sys_cputs,
+  // so we have to copy vbuf into buf in chunks and nul-terminate.
+  for (tot = 0; tot < n; tot += m) {
+  804aaa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804ab1:	eb 74                	jmp    804b27 <devcons_write+0x9d>
+    m = n - tot;
+  804ab3:	48 8b 85 58 ff ff ff 	mov    -0xa8(%rbp),%rax
+  804aba:	89 c2                	mov    %eax,%edx
+  804abc:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804abf:	29 c2                	sub    %eax,%edx
+  804ac1:	89 55 f8             	mov    %edx,-0x8(%rbp)
+    if (m > sizeof(buf) - 1)
+  804ac4:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804ac7:	83 f8 7f             	cmp    $0x7f,%eax
+  804aca:	76 07                	jbe    804ad3 <devcons_write+0x49>
+      m = sizeof(buf) - 1;
+  804acc:	c7 45 f8 7f 00 00 00 	movl   $0x7f,-0x8(%rbp)
+    memmove(buf, (char *)vbuf + tot, m);
+  804ad3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804ad6:	48 63 d0             	movslq %eax,%rdx
+  804ad9:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804adc:	48 63 c8             	movslq %eax,%rcx
+  804adf:	48 8b 85 60 ff ff ff 	mov    -0xa0(%rbp),%rax
+  804ae6:	48 01 c1             	add    %rax,%rcx
+  804ae9:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804af0:	48 89 ce             	mov    %rcx,%rsi
+  804af3:	48 89 c7             	mov    %rax,%rdi
+  804af6:	48 b8 f5 17 80 00 00 	movabs $0x8017f5,%rax
+  804afd:	00 00 00 
+  804b00:	ff d0                	call   *%rax
+    sys_cputs(buf, m);
+  804b02:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804b05:	48 63 d0             	movslq %eax,%rdx
+  804b08:	48 8d 85 70 ff ff ff 	lea    -0x90(%rbp),%rax
+  804b0f:	48 89 d6             	mov    %rdx,%rsi
+  804b12:	48 89 c7             	mov    %rax,%rdi
+  804b15:	48 b8 69 1e 80 00 00 	movabs $0x801e69,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+  for (tot = 0; tot < n; tot += m) {
+  804b21:	8b 45 f8             	mov    -0x8(%rbp),%eax
+  804b24:	01 45 fc             	add    %eax,-0x4(%rbp)
+  804b27:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b2a:	48 98                	cltq
+  804b2c:	48 3b 85 58 ff ff ff 	cmp    -0xa8(%rbp),%rax
+  804b33:	0f 82 7a ff ff ff    	jb     804ab3 <devcons_write+0x29>
+  }
+  return tot;
+  804b39:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804b3c:	48 98                	cltq
+}
+  804b3e:	c9                   	leave
+  804b3f:	c3                   	ret
+
+0000000000804b40 <devcons_close>:
+
+static int
+devcons_close(struct Fd *fd) {
+  804b40:	55                   	push   %rbp
+  804b41:	48 89 e5             	mov    %rsp,%rbp
+  804b44:	48 83 ec 08          	sub    $0x8,%rsp
+  804b48:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  USED(fd);
+
+  return 0;
+  804b4c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b51:	c9                   	leave
+  804b52:	c3                   	ret
+
+0000000000804b53 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804b53:	55                   	push   %rbp
+  804b54:	48 89 e5             	mov    %rsp,%rbp
+  804b57:	48 83 ec 10          	sub    $0x10,%rsp
+  804b5b:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804b5f:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  strcpy(stat->st_name, "<cons>");
+  804b63:	48 8b 45 f0          	mov    -0x10(%rbp),%rax
+  804b67:	48 ba 3d 57 80 00 00 	movabs $0x80573d,%rdx
+  804b6e:	00 00 00 
+  804b71:	48 89 d6             	mov    %rdx,%rsi
+  804b74:	48 89 c7             	mov    %rax,%rdi
+  804b77:	48 b8 b2 12 80 00 00 	movabs $0x8012b2,%rax
+  804b7e:	00 00 00 
+  804b81:	ff d0                	call   *%rax
+  return 0;
+  804b83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804b88:	c9                   	leave
+  804b89:	c3                   	ret
+
+0000000000804b8a <devcons_poll>:
+
+static int
+devcons_poll(struct Fd *fd, int events, struct PollWait *w) {
+  804b8a:	55                   	push   %rbp
+  804b8b:	48 89 e5             	mov    %rsp,%rbp
+  804b8e:	48 83 ec 30          	sub    $0x30,%rsp
+  804b92:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804b96:	89 75 e4             	mov    %esi,-0x1c(%rbp)
+  804b99:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  int flags   = POLLWAIT_CONS;
+  804b9d:	c7 45 fc 01 00 00 00 	movl   $0x1,-0x4(%rbp)
+  int revents = events & POLLOUT;
+  804ba4:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804ba7:	83 e0 02             	and    $0x2,%eax
+  804baa:	89 45 f8             	mov    %eax,-0x8(%rbp)
+
+  if (fd->fd_cons.mode == CONS_COOKED)
+  804bad:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804bb1:	8b 40 0c             	mov    0xc(%rax),%eax
+  804bb4:	83 f8 01             	cmp    $0x1,%eax
+  804bb7:	75 04                	jne    804bbd <devcons_poll+0x33>
+    flags |= POLLWAIT_CONS_COOKED;
+  804bb9:	83 4d fc 02          	orl    $0x2,-0x4(%rbp)
+  if (events & POLLIN) {
+  804bbd:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  804bc0:	83 e0 01             	and    $0x1,%eax
+  804bc3:	85 c0                	test   %eax,%eax
+  804bc5:	74 44                	je     804c0b <devcons_poll+0x81>
+    if (sys_poll_wait(NULL, 0, flags, 0) == POLLWAIT_CONS)
+  804bc7:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804bca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804bcf:	89 c2                	mov    %eax,%edx
+  804bd1:	be 00 00 00 00       	mov    $0x0,%esi
+  804bd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  804bdb:	48 b8 c8 24 80 00 00 	movabs $0x8024c8,%rax
+  804be2:	00 00 00 
+  804be5:	ff d0                	call   *%rax
+  804be7:	83 f8 01             	cmp    $0x1,%eax
+  804bea:	75 06                	jne    804bf2 <devcons_poll+0x68>
+      revents |= POLLIN;
+  804bec:	83 4d f8 01          	orl    $0x1,-0x8(%rbp)
+  804bf0:	eb 19                	jmp    804c0b <devcons_poll+0x81>
+    else
+      w->pw_flags |= flags;
+  804bf2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804bf6:	8b 80 04 02 00 00    	mov    0x204(%rax),%eax
+  804bfc:	0b 45 fc             	or     -0x4(%rbp),%eax
+  804bff:	89 c2                	mov    %eax,%edx
+  804c01:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804c05:	89 90 04 02 00 00    	mov    %edx,0x204(%rax)
+  }
+  return revents;
+  804c0b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804c0e:	c9                   	leave
+  804c0f:	c3                   	ret
+
+0000000000804c10 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804c10:	55                   	push   %rbp
+  804c11:	48 89 e5             	mov    %rsp,%rbp
+  804c14:	53                   	push   %rbx
+  804c15:	48 81 ec f8 00 00 00 	sub    $0xf8,%rsp
+  804c1c:	48 89 bd 18 ff ff ff 	mov    %rdi,-0xe8(%rbp)
+  804c23:	89 b5 14 ff ff ff    	mov    %esi,-0xec(%rbp)
+  804c29:	48 89 95 08 ff ff ff 	mov    %rdx,-0xf8(%rbp)
+  804c30:	48 89 8d 58 ff ff ff 	mov    %rcx,-0xa8(%rbp)
+  804c37:	4c 89 85 60 ff ff ff 	mov    %r8,-0xa0(%rbp)
+  804c3e:	4c 89 8d 68 ff ff ff 	mov    %r9,-0x98(%rbp)
+  804c45:	84 c0                	test   %al,%al
+  804c47:	74 23                	je     804c6c <_panic+0x5c>
+  804c49:	0f 29 85 70 ff ff ff 	movaps %xmm0,-0x90(%rbp)
+  804c50:	0f 29 4d 80          	movaps %xmm1,-0x80(%rbp)
+  804c54:	0f 29 55 90          	movaps %xmm2,-0x70(%rbp)
+  804c58:	0f 29 5d a0          	movaps %xmm3,-0x60(%rbp)
+  804c5c:	0f 29 65 b0          	movaps %xmm4,-0x50(%rbp)
+  804c60:	0f 29 6d c0          	movaps %xmm5,-0x40(%rbp)
+  804c64:	0f 29 75 d0          	movaps %xmm6,-0x30(%rbp)
+  804c68:	0f 29 7d e0          	movaps %xmm7,-0x20(%rbp)
+  va_list ap;
+
+  va_start(ap, fmt);
+  804c6c:	c7 85 28 ff ff ff 18 	movl   $0x18,-0xd8(%rbp)
+  804c73:	00 00 00 
+  804c76:	c7 85 2c ff ff ff 30 	movl   $0x30,-0xd4(%rbp)
+  804c7d:	00 00 00 
+  804c80:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804c84:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  804c8b:	48 8d 85 40 ff ff ff 	lea    -0xc0(%rbp),%rax
+  804c92:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  804c99:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804ca0:	00 00 00 
+  804ca3:	48 8b 18             	mov    (%rax),%rbx
+  804ca6:	48 b8 07 20 80 00 00 	movabs $0x802007,%rax
+  804cad:	00 00 00 
+  804cb0:	ff d0                	call   *%rax
+  804cb2:	89 c6                	mov    %eax,%esi
+  804cb4:	8b 95 14 ff ff ff    	mov    -0xec(%rbp),%edx
+  804cba:	48 8b 85 18 ff ff ff 	mov    -0xe8(%rbp),%rax
+  804cc1:	41 89 d0             	mov    %edx,%r8d
+  804cc4:	48 89 c1             	mov    %rax,%rcx
+  804cc7:	48 89 da             	mov    %rbx,%rdx
+  804cca:	48 b8 48 57 80 00 00 	movabs $0x805748,%rax
+  804cd1:	00 00 00 
+  804cd4:	48 89 c7             	mov    %rax,%rdi
+  804cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cdc:	49 b9 02 03 80 00 00 	movabs $0x800302,%r9
+  804ce3:	00 00 00 
+  804ce6:	41 ff d1             	call   *%r9
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  804ce9:	48 8d 95 28 ff ff ff 	lea    -0xd8(%rbp),%rdx
+  804cf0:	48 8b 85 08 ff ff ff 	mov    -0xf8(%rbp),%rax
+  804cf7:	48 89 d6             	mov    %rdx,%rsi
+  804cfa:	48 89 c7             	mov    %rax,%rdi
+  804cfd:	48 b8 77 02 80 00 00 	movabs $0x800277,%rax
+  804d04:	00 00 00 
+  804d07:	ff d0                	call   *%rax
+  cprintf("\n");
+  804d09:	48 b8 6b 57 80 00 00 	movabs $0x80576b,%rax
+  804d10:	00 00 00 
+  804d13:	48 89 c7             	mov    %rax,%rdi
+  804d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d1b:	48 ba 02 03 80 00 00 	movabs $0x800302,%rdx
+  804d22:	00 00 00 
+  804d25:	ff d2                	call   *%rdx
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile("int3");
+  804d27:	cc                   	int3
+  804d28:	eb fd                	jmp    804d27 <_panic+0x117>
+
+0000000000804d2a <ipc_recv>:
+//   Use 'thisenv' to discover the value and who sent it.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value, since that's
+//   a perfectly valid place to map a page.)
+int32_t
+ipc_recv(envid_t *from_env_store, void *pg, int *perm_store) {
+  804d2a:	55                   	push   %rbp
+  804d2b:	48 89 e5             	mov    %rsp,%rbp
+  804d2e:	48 83 ec 20          	sub    $0x20,%rsp
+  804d32:	48 89 7d f8          	mov    %rdi,-0x8(%rbp)
+  804d36:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  804d3a:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+  return ipc_recv_timeout(from_env_store, pg, perm_store, IPC_NO_TIMEOUT);
+  804d3e:	48 8b 55 e8          	mov    -0x18(%rbp),%rdx
+  804d42:	48 8b 75 f0          	mov    -0x10(%rbp),%rsi
+  804d46:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  804d4a:	48 c7 c1 ff ff ff ff 	mov    $0xffffffffffffffff,%rcx
+  804d51:	48 89 c7             	mov    %rax,%rdi
+  804d54:	48 b8 62 4d 80 00 00 	movabs $0x804d62,%rax
+  804d5b:	00 00 00 
+  804d5e:	ff d0                	call   *%rax
+}
+  804d60:	c9                   	leave
+  804d61:	c3                   	ret
+
+0000000000804d62 <ipc_recv_timeout>:
+// Like ipc_recv, but fail with -E_TIMEOUT if nothing arrives within
+// 'timeout' nanoseconds.  A zero timeout polls without blocking;
+// IPC_NO_TIMEOUT waits forever.
+int32_t
+ipc_recv_timeout(envid_t *from_env_store, void *pg, int *perm_store,
+                 uint64_t timeout) {
+  804d62:	55                   	push   %rbp
+  804d63:	48 89 e5             	mov    %rsp,%rbp
+  804d66:	48 83 ec 30          	sub    $0x30,%rsp
+  804d6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804d6e:	48 89 75 e0          	mov    %rsi,-0x20(%rbp)
+  804d72:	48 89 55 d8          	mov    %rdx,-0x28(%rbp)
+  804d76:	48 89 4d d0          	mov    %rcx,-0x30(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804d7a:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804d7f:	75 0e                	jne    804d8f <ipc_recv_timeout+0x2d>
+    pg = (void *) UTOP;
+  804d81:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d88:	00 00 00 
+  804d8b:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  if (timeout == IPC_NO_TIMEOUT) {
+  804d8f:	48 83 7d d0 ff       	cmpq   $0xffffffffffffffff,-0x30(%rbp)
+  804d94:	75 18                	jne    804dae <ipc_recv_timeout+0x4c>
+    r = sys_ipc_recv(pg);
+  804d96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804d9a:	48 89 c7             	mov    %rax,%rdi
+  804d9d:	48 b8 c0 22 80 00 00 	movabs $0x8022c0,%rax
+  804da4:	00 00 00 
+  804da7:	ff d0                	call   *%rax
+  804da9:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804dac:	eb 1d                	jmp    804dcb <ipc_recv_timeout+0x69>
+  } else {
+    r = sys_ipc_recv_timeout(pg, timeout);
+  804dae:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804db2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  804db6:	48 89 d6             	mov    %rdx,%rsi
+  804db9:	48 89 c7             	mov    %rax,%rdi
+  804dbc:	48 b8 06 23 80 00 00 	movabs $0x802306,%rax
+  804dc3:	00 00 00 
+  804dc6:	ff d0                	call   *%rax
+  804dc8:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  }
+  if (r < 0) {
+  804dcb:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804dcf:	79 2a                	jns    804dfb <ipc_recv_timeout+0x99>
+    if (from_env_store) {
+  804dd1:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804dd6:	74 0a                	je     804de2 <ipc_recv_timeout+0x80>
+      *from_env_store = 0;
+  804dd8:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ddc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    if (perm_store) {
+  804de2:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804de7:	74 0a                	je     804df3 <ipc_recv_timeout+0x91>
+      *perm_store = 0;
+  804de9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804ded:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    }
+    return r;
+  804df3:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804df6:	e9 aa 00 00 00       	jmp    804ea5 <ipc_recv_timeout+0x143>
+  } else {
+    if (from_env_store) {
+  804dfb:	48 83 7d e8 00       	cmpq   $0x0,-0x18(%rbp)
+  804e00:	74 36                	je     804e38 <ipc_recv_timeout+0xd6>
+      *from_env_store = thisenv->env_ipc_from;
+  804e02:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e09:	00 00 00 
+  804e0c:	8b 40 04             	mov    0x4(%rax),%eax
+  804e0f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e14:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e1b:	00 00 00 
+  804e1e:	48 98                	cltq
+  804e20:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e27:	48 01 d0             	add    %rdx,%rax
+  804e2a:	48 05 24 01 00 00    	add    $0x124,%rax
+  804e30:	8b 10                	mov    (%rax),%edx
+  804e32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804e36:	89 10                	mov    %edx,(%rax)
+    }
+    if (perm_store) {
+  804e38:	48 83 7d d8 00       	cmpq   $0x0,-0x28(%rbp)
+  804e3d:	74 36                	je     804e75 <ipc_recv_timeout+0x113>
+      *perm_store = thisenv->env_ipc_perm;
+  804e3f:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e46:	00 00 00 
+  804e49:	8b 40 04             	mov    0x4(%rax),%eax
+  804e4c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e51:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e58:	00 00 00 
+  804e5b:	48 98                	cltq
+  804e5d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e64:	48 01 d0             	add    %rdx,%rax
+  804e67:	48 05 28 01 00 00    	add    $0x128,%rax
+  804e6d:	8b 10                	mov    (%rax),%edx
+  804e6f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  804e73:	89 10                	mov    %edx,(%rax)
+    }
+#ifdef SANITIZE_USER_SHADOW_BASE
+    platform_asan_unpoison(pg, PGSIZE);
+#endif
+    return thisenv->env_ipc_value;
+  804e75:	48 b8 00 e0 02 3c 80 	movabs $0x803c02e000,%rax
+  804e7c:	00 00 00 
+  804e7f:	8b 40 04             	mov    0x4(%rax),%eax
+  804e82:	25 ff 03 00 00       	and    $0x3ff,%eax
+  804e87:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804e8e:	00 00 00 
+  804e91:	48 98                	cltq
+  804e93:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804e9a:	48 01 d0             	add    %rdx,%rax
+  804e9d:	48 05 20 01 00 00    	add    $0x120,%rax
+  804ea3:	8b 00                	mov    (%rax),%eax
+  }
+}
+  804ea5:	c9                   	leave
+  804ea6:	c3                   	ret
+
+0000000000804ea7 <ipc_send>:
+// Hint:
+//   Use sys_yield() to be CPU-friendly.
+//   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+//   as meaning "no page".  (Zero is not the right value.)
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, int perm) {
+  804ea7:	55                   	push   %rbp
+  804ea8:	48 89 e5             	mov    %rsp,%rbp
+  804eab:	48 83 ec 30          	sub    $0x30,%rsp
+  804eaf:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  804eb2:	89 75 e8             	mov    %esi,-0x18(%rbp)
+  804eb5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804eb9:	89 4d dc             	mov    %ecx,-0x24(%rbp)
+  // LAB 9: Your code here.
+  int r;
+
+  if (pg == NULL) {
+  804ebc:	48 83 7d e0 00       	cmpq   $0x0,-0x20(%rbp)
+  804ec1:	75 5e                	jne    804f21 <ipc_send+0x7a>
+    pg = (void *) UTOP;
+  804ec3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804eca:	00 00 00 
+  804ecd:	48 89 45 e0          	mov    %rax,-0x20(%rbp)
+  }
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804ed1:	eb 4e                	jmp    804f21 <ipc_send+0x7a>
+    if (r < 0 && r != -E_IPC_NOT_RECV) {
+  804ed3:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804ed7:	79 3c                	jns    804f15 <ipc_send+0x6e>
+  804ed9:	83 7d fc f6          	cmpl   $0xfffffff6,-0x4(%rbp)
+  804edd:	74 36                	je     804f15 <ipc_send+0x6e>
+      panic("ipc_send error: sys_ipc_try_send: %i\n", r);
+  804edf:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804ee2:	89 c1                	mov    %eax,%ecx
+  804ee4:	48 b8 70 57 80 00 00 	movabs $0x805770,%rax
+  804eeb:	00 00 00 
+  804eee:	48 89 c2             	mov    %rax,%rdx
+  804ef1:	be 54 00 00 00       	mov    $0x54,%esi
+  804ef6:	48 b8 96 57 80 00 00 	movabs $0x805796,%rax
+  804efd:	00 00 00 
+  804f00:	48 89 c7             	mov    %rax,%rdi
+  804f03:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f08:	49 b8 10 4c 80 00 00 	movabs $0x804c10,%r8
+  804f0f:	00 00 00 
+  804f12:	41 ff d0             	call   *%r8
+    }
+    sys_yield();
+  804f15:	48 b8 43 20 80 00 00 	movabs $0x802043,%rax
+  804f1c:	00 00 00 
+  804f1f:	ff d0                	call   *%rax
+  while ((r = sys_ipc_try_send(to_env, val, pg, perm))) {
+  804f21:	8b 75 e8             	mov    -0x18(%rbp),%esi
+  804f24:	8b 4d dc             	mov    -0x24(%rbp),%ecx
+  804f27:	48 8b 55 e0          	mov    -0x20(%rbp),%rdx
+  804f2b:	8b 45 ec             	mov    -0x14(%rbp),%eax
+  804f2e:	89 c7                	mov    %eax,%edi
+  804f30:	48 b8 69 22 80 00 00 	movabs $0x802269,%rax
+  804f37:	00 00 00 
+  804f3a:	ff d0                	call   *%rax
+  804f3c:	89 45 fc             	mov    %eax,-0x4(%rbp)
+  804f3f:	83 7d fc 00          	cmpl   $0x0,-0x4(%rbp)
+  804f43:	75 8e                	jne    804ed3 <ipc_send+0x2c>
+  }
+
+  // last one
+  sys_yield();
+  804f45:	48 b8 43 20 80 00 00 	movabs $0x802043,%rax
+  804f4c:	00 00 00 
+  804f4f:	ff d0                	call   *%rax
+}
+  804f51:	90                   	nop
+  804f52:	c9                   	leave
+  804f53:	c3                   	ret
+
+0000000000804f54 <ipc_find_env>:
+
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type) {
+  804f54:	55                   	push   %rbp
+  804f55:	48 89 e5             	mov    %rsp,%rbp
+  804f58:	48 83 ec 18          	sub    $0x18,%rsp
+  804f5c:	89 7d ec             	mov    %edi,-0x14(%rbp)
+  int i;
+  for (i = 0; i < NENV; i++)
+  804f5f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%rbp)
+  804f66:	eb 4d                	jmp    804fb5 <ipc_find_env+0x61>
+    if (envs[i].env_type == type)
+  804f68:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f6f:	00 00 00 
+  804f72:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f75:	48 98                	cltq
+  804f77:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804f7e:	48 01 d0             	add    %rdx,%rax
+  804f81:	48 05 d0 00 00 00    	add    $0xd0,%rax
+  804f87:	8b 00                	mov    (%rax),%eax
+  804f89:	39 45 ec             	cmp    %eax,-0x14(%rbp)
+  804f8c:	75 23                	jne    804fb1 <ipc_find_env+0x5d>
+      return envs[i].env_id;
+  804f8e:	48 ba 00 e0 22 3c 80 	movabs $0x803c22e000,%rdx
+  804f95:	00 00 00 
+  804f98:	8b 45 fc             	mov    -0x4(%rbp),%eax
+  804f9b:	48 98                	cltq
+  804f9d:	48 69 c0 68 02 00 00 	imul   $0x268,%rax,%rax
+  804fa4:	48 01 d0             	add    %rdx,%rax
+  804fa7:	48 05 c8 00 00 00    	add    $0xc8,%rax
+  804fad:	8b 00                	mov    (%rax),%eax
+  804faf:	eb 12                	jmp    804fc3 <ipc_find_env+0x6f>
+  for (i = 0; i < NENV; i++)
+  804fb1:	83 45 fc 01          	addl   $0x1,-0x4(%rbp)
+  804fb5:	81 7d fc ff 03 00 00 	cmpl   $0x3ff,-0x4(%rbp)
+  804fbc:	7e aa                	jle    804f68 <ipc_find_env+0x14>
+  return 0;
+  804fbe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804fc3:	c9                   	leave
+  804fc4:	c3                   	ret
+
+0000000000804fc5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v) {
+  804fc5:	55                   	push   %rbp
+  804fc6:	48 89 e5             	mov    %rsp,%rbp
+  804fc9:	48 83 ec 18          	sub    $0x18,%rsp
+  804fcd:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  pte_t pte;
+
+  if (!(uvpml4e[PML4(v)] & PTE_P) || !(uvpde[VPDPE(v)] & PTE_P) || !(uvpd[VPD(v)] & PTE_P) || !(uvpt[PGNUM(v)] & PTE_P))
+  804fd1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804fd5:	48 c1 e8 27          	shr    $0x27,%rax
+  804fd9:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804fde:	48 89 c2             	mov    %rax,%rdx
+  804fe1:	48 b8 00 20 40 80 00 	movabs $0x10080402000,%rax
+  804fe8:	01 00 00 
+  804feb:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  804fef:	83 e0 01             	and    $0x1,%eax
+  804ff2:	48 85 c0             	test   %rax,%rax
+  804ff5:	74 63                	je     80505a <pageref+0x95>
+  804ff7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  804ffb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804fff:	48 89 c2             	mov    %rax,%rdx
+  805002:	48 b8 00 00 40 80 00 	movabs $0x10080400000,%rax
+  805009:	01 00 00 
+  80500c:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805010:	83 e0 01             	and    $0x1,%eax
+  805013:	48 85 c0             	test   %rax,%rax
+  805016:	74 42                	je     80505a <pageref+0x95>
+  805018:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80501c:	48 c1 e8 15          	shr    $0x15,%rax
+  805020:	48 89 c2             	mov    %rax,%rdx
+  805023:	48 b8 00 00 00 80 00 	movabs $0x10080000000,%rax
+  80502a:	01 00 00 
+  80502d:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805031:	83 e0 01             	and    $0x1,%eax
+  805034:	48 85 c0             	test   %rax,%rax
+  805037:	74 21                	je     80505a <pageref+0x95>
+  805039:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80503d:	48 c1 e8 0c          	shr    $0xc,%rax
+  805041:	48 89 c2             	mov    %rax,%rdx
+  805044:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80504b:	01 00 00 
+  80504e:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  805052:	83 e0 01             	and    $0x1,%eax
+  805055:	48 85 c0             	test   %rax,%rax
+  805058:	75 07                	jne    805061 <pageref+0x9c>
+    return 0;
+  80505a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80505f:	eb 53                	jmp    8050b4 <pageref+0xef>
+  pte = uvpt[PGNUM(v)];
+  805061:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  805065:	48 c1 e8 0c          	shr    $0xc,%rax
+  805069:	48 89 c2             	mov    %rax,%rdx
+  80506c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805073:	01 00 00 
+  805076:	48 8b 04 d0          	mov    (%rax,%rdx,8),%rax
+  80507a:	48 89 45 f8          	mov    %rax,-0x8(%rbp)
+  if (!(pte & PTE_P))
+  80507e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805082:	83 e0 01             	and    $0x1,%eax
+  805085:	48 85 c0             	test   %rax,%rax
+  805088:	75 07                	jne    805091 <pageref+0xcc>
+    return 0;
+  80508a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80508f:	eb 23                	jmp    8050b4 <pageref+0xef>
+  return pages[PPN(pte)].pp_ref;
+  805091:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  805095:	48 c1 e8 0c          	shr    $0xc,%rax
+  805099:	48 ba 00 e0 42 3c 80 	movabs $0x803c42e000,%rdx
+  8050a0:	00 00 00 
+  8050a3:	48 c1 e0 04          	shl    $0x4,%rax
+  8050a7:	48 01 d0             	add    %rdx,%rax
+  8050aa:	48 83 c0 08          	add    $0x8,%rax
+  8050ae:	0f b7 00             	movzwl (%rax),%eax
+  8050b1:	0f b7 c0             	movzwl %ax,%eax
+}
+  8050b4:	c9                   	leave
+  8050b5:	c3                   	ret
+  8050b6:	66 90                	xchg   %ax,%ax
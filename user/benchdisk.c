@@ -0,0 +1,105 @@
+// Benchmark for the disk: how fast the file system server reads a
+// file that is not cached, and writes it over.  On IDE, both with DMA
+// and with PIO; on virtio-blk, with as many requests in flight as the
+// block cache submits at once.
+// Usage: benchdisk [KiB]
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define PATH    "/benchdisk.tmp"
+#define BUFSIZE (64 * 1024)
+
+static char buf[BUFSIZE];
+
+// Shrink the block cache as far as the server lets us and grow it
+// back, so that the file has to come from the disk again.
+static void
+drop_cache(uint32_t capacity) {
+  uint32_t n;
+
+  for (n = 1; n < capacity && fs_set_cache(n) < 0; n *= 2)
+    ;
+  fs_set_cache(capacity);
+}
+
+// Average cycles per KiB to read the whole file, or to write it over
+// and sync it, starting with nothing cached.
+static uint64_t
+run(size_t kib, bool writing, uint32_t capacity) {
+  uint64_t start;
+  size_t done;
+  ssize_t n;
+  int fd;
+
+  if ((fd = open(PATH, O_RDWR)) < 0)
+    panic("open %s: %i", PATH, fd);
+  sync();
+  drop_cache(capacity);
+
+  start = read_tsc();
+  for (done = 0; done < kib * 1024; done += n) {
+    n = MIN(BUFSIZE, kib * 1024 - done);
+    if ((n = writing ? write(fd, buf, n) : readn(fd, buf, n)) <= 0)
+      panic("%s %s: %i", writing ? "write" : "read", PATH, (int)n);
+  }
+  if (writing)
+    sync();
+  start = read_tsc() - start;
+  close(fd);
+  return start / kib;
+}
+
+void
+umain(int argc, char **argv) {
+  struct Fsret_stats st, before, after;
+  size_t kib = argc > 1 ? strtol(argv[1], NULL, 0) : 512, i;
+  uint64_t rd, wr;
+  int fd, r, on;
+
+  if (!kib) {
+    printf("usage: benchdisk [KiB]\n");
+    return;
+  }
+  if ((r = fs_stats(&st)) < 0)
+    panic("fs_stats: %i", r);
+  for (i = 0; i < BUFSIZE; i++)
+    buf[i] = i;
+  if ((fd = open(PATH, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+    panic("open %s: %i", PATH, fd);
+  for (i = 0; i < kib * 1024; i += r) {
+    if ((r = write(fd, buf, MIN(BUFSIZE, kib * 1024 - i))) <= 0)
+      panic("write %s: %i", PATH, r);
+  }
+  close(fd);
+
+  if (st.ret_disk_virtio) {
+    fs_stats(&before);
+    rd = run(kib, 0, st.ret_bc_capacity);
+    wr = run(kib, 1, st.ret_bc_capacity);
+    fs_stats(&after);
+    cprintf("virtio-blk: %ld KiB: read %ld, write %ld cycles per KiB (%ld requests, at most %d in flight)\n",
+            (long)kib, (long)rd, (long)wr,
+            (long)(after.ret_virtio_reqs - before.ret_virtio_reqs), after.ret_virtio_max_inflight);
+    remove(PATH);
+    return;
+  }
+
+  for (on = 1; on >= 0; on--) {
+    if ((r = fs_set_dma(on)) < 0) {
+      cprintf("%s: %i\n", on ? "DMA" : "PIO", r);
+      continue;
+    }
+    fs_stats(&before);
+    rd = run(kib, 0, st.ret_bc_capacity);
+    wr = run(kib, 1, st.ret_bc_capacity);
+    fs_stats(&after);
+    cprintf("%s: %ld KiB: read %ld, write %ld cycles per KiB (%ld DMA, %ld PIO transfers)\n",
+            on ? "DMA" : "PIO", (long)kib, (long)rd, (long)wr,
+            (long)(after.ret_ide_dma_xfers - before.ret_ide_dma_xfers),
+            (long)(after.ret_ide_pio_xfers - before.ret_ide_pio_xfers));
+  }
+
+  fs_set_dma(st.ret_ide_dma);
+  remove(PATH);
+}
@@ -0,0 +1,77 @@
+// Benchmarks for malloc: allocation throughput for small and large
+// sizes, and how much memory stays mapped after a random workload
+// frees half of its objects.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define NOBJS 4096
+
+static void *objs[NOBJS];
+static uint32_t seed = 1;
+
+static uint32_t
+rnd(void) {
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+// Average cycles per malloc/free pair of 'size' bytes, keeping up
+// to 'live' objects allocated at a time.
+static uint64_t
+throughput(size_t size, int live, int iters) {
+  uint64_t start;
+  int i, j;
+
+  start = read_tsc();
+  for (i = 0; i < iters; i += live) {
+    for (j = 0; j < live; j++) {
+      if (!(objs[j] = malloc(size)))
+        panic("malloc %ld failed", (long)size);
+    }
+    for (j = 0; j < live; j++)
+      free(objs[j]);
+  }
+  return (read_tsc() - start) / i;
+}
+
+static void
+fragmentation(void) {
+  size_t inuse, mapped;
+  int i;
+
+  for (i = 0; i < NOBJS; i++) {
+    // Mostly small objects, with a few larger ones.
+    size_t n = rnd() % 8 ? 16 + rnd() % 512 : 1024 + rnd() % 8192;
+    if (!(objs[i] = malloc(n)))
+      panic("malloc %ld failed", (long)n);
+  }
+  malloc_stats(&inuse, &mapped);
+  cprintf("fragmentation: %d objects: %ld KiB in use, %ld KiB mapped\n",
+          NOBJS, (long)inuse / 1024, (long)mapped / 1024);
+
+  for (i = 0; i < NOBJS; i += 2)
+    free(objs[i]);
+  malloc_stats(&inuse, &mapped);
+  cprintf("fragmentation: half freed: %ld KiB in use, %ld KiB mapped (%ld%% used)\n",
+          (long)inuse / 1024, (long)mapped / 1024,
+          mapped ? (long)(inuse * 100 / mapped) : 0L);
+
+  for (i = 1; i < NOBJS; i += 2)
+    free(objs[i]);
+  malloc_stats(&inuse, &mapped);
+  cprintf("fragmentation: all freed: %ld KiB in use, %ld KiB mapped\n",
+          (long)inuse / 1024, (long)mapped / 1024);
+}
+
+void
+umain(int argc, char **argv) {
+  static const size_t sizes[] = {16, 64, 256, 1024, 2048, 8192, 65536};
+  size_t i;
+
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    cprintf("throughput: %6ld bytes: %6ld cycles per malloc+free\n",
+            (long)sizes[i], (long)throughput(sizes[i], 64, sizes[i] > 2048 ? 1024 : 65536));
+  }
+  fragmentation();
+}
@@ -0,0 +1,70 @@
+// Microbenchmark for the lib/string.c routines.
+// Prints the average cycles per call for sizes from 8 B to 64 KiB.
+
+#include <inc/lib.h>
+#include <inc/x86.h>
+
+#define MAXSIZE (64 * 1024)
+
+static char src[MAXSIZE + 64], dst[MAXSIZE + 64];
+static const size_t sizes[] = {8, 64, 512, 4096, 32768, MAXSIZE};
+
+enum { B_MEMCPY, B_MEMSET, B_MEMCMP, B_STRLEN, B_MEMFIND, NBENCH };
+static const char *names[NBENCH] = {"memcpy", "memset", "memcmp", "strlen", "memfind"};
+
+static uint64_t
+run(int bench, size_t n, int iters) {
+  volatile uint64_t sink = 0;
+  uint64_t start;
+  int i;
+
+  src[n] = 0;
+  // memset leaves dst different from src, and memcmp would stop at
+  // the first byte: make them equal so it compares all n.
+  if (bench == B_MEMCMP)
+    memcpy(dst, src, n);
+  start = read_tsc();
+  for (i = 0; i < iters; i++) {
+    switch (bench) {
+    case B_MEMCPY:
+      memcpy(dst, src, n);
+      break;
+    case B_MEMSET:
+      memset(dst, i, n);
+      break;
+    case B_MEMCMP:
+      sink += memcmp(dst, src, n);
+      break;
+    case B_STRLEN:
+      sink += strlen(src);
+      break;
+    case B_MEMFIND:
+      sink += (char *)memfind(src, 0, n) - src;
+      break;
+    }
+  }
+  src[n] = 'x';
+  return (read_tsc() - start) / iters;
+}
+
+void
+umain(int argc, char **argv) {
+  size_t i;
+  int b, iters;
+
+  memset(src, 'x', sizeof(src));
+  memcpy(dst, src, sizeof(dst));
+
+  cprintf("%-8s", "size");
+  for (b = 0; b < NBENCH; b++)
+    cprintf("%10s", names[b]);
+  cprintf("   (cycles per call)\n");
+
+  for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    iters = MAX(8, (int)(4 * 1024 * 1024 / sizes[i]));
+    cprintf("%-8ld", (long)sizes[i]);
+    for (b = 0; b < NBENCH; b++)
+      cprintf("%10ld", (long)run(b, sizes[i], iters));
+    cprintf("\n");
+  }
+}
@@ -0,0 +1,15 @@
+#include <inc/lib.h>
+
+// Big enough for the whole kernel log.
+static char buf[KLOG_BUFSIZE];
+
+void
+umain(int argc, char **argv) {
+  int n = sys_klog_read(buf, sizeof(buf));
+
+  if (n < 0) {
+    printf("dmesg: %i\n", n);
+    return;
+  }
+  write(1, buf, n);
+}
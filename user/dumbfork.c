@@ -52,10 +52,8 @@ dumbfork(void) {
     panic("sys_exofork: %i", envid);
   if (envid == 0) {
     // We're the child.
-    // The copied value of the global variable 'thisenv'
-    // is no longer valid (it refers to the parent!).
-    // Fix it and return 0.
-    thisenv = &envs[ENVX(sys_getenvid())];
+    // thisenv already refers to us: the kernel publishes the
+    // running env's id for it.
     return 0;
   }
 
@@ -0,0 +1,65 @@
+// Print the file system server's statistics.
+// With -c N, first let its block cache hold N blocks; with -d on or
+// -d off, first turn disk DMA on or off.
+
+#include <inc/lib.h>
+
+static void
+usage(void) {
+  printf("usage: fsstat [-c nblocks] [-d on|off]\n");
+  exit();
+}
+
+static void
+percent(const char *what, uint64_t n, uint64_t total) {
+  uint64_t tenths = total ? n * 1000 / total : 0;
+
+  printf("%s: %ld (%ld.%ld%%)\n", what, (long)n, (long)(tenths / 10), (long)(tenths % 10));
+}
+
+void
+umain(int argc, char **argv) {
+  struct Fsret_stats st;
+  struct Argstate args;
+  const char *cap = NULL, *dma = NULL;
+  int i, r;
+
+  argstart(&argc, argv, &args);
+  while ((i = argnext(&args)) >= 0) {
+    if (i == 'c' && (cap = argvalue(&args)))
+      continue;
+    if (i == 'd' && (dma = argvalue(&args)) &&
+        (!strcmp(dma, "on") || !strcmp(dma, "off")))
+      continue;
+    usage();
+  }
+  if (argc != 1)
+    usage();
+
+  if (cap && (r = fs_set_cache(strtol(cap, NULL, 0))) < 0) {
+    printf("fsstat: block cache of %s blocks: %i\n", cap, r);
+    return;
+  }
+  if (dma && (r = fs_set_dma(!strcmp(dma, "on"))) < 0) {
+    printf("fsstat: DMA %s: %i\n", dma, r);
+    return;
+  }
+  if ((r = fs_stats(&st)) < 0) {
+    printf("fsstat: %i\n", r);
+    return;
+  }
+  printf("path lookup cache: %d entries, %ld lookups\n",
+         st.ret_dcache_size, (long)st.ret_dcache_lookups);
+  percent("  hits", st.ret_dcache_hits, st.ret_dcache_lookups);
+  percent("  negative hits", st.ret_dcache_neg_hits, st.ret_dcache_lookups);
+  printf("block cache: %d of %d blocks, %ld evictions\n",
+         st.ret_bc_cached, st.ret_bc_capacity, (long)st.ret_bc_evictions);
+  percent("  hits", st.ret_bc_hits, st.ret_bc_hits + st.ret_bc_misses);
+  percent("  misses", st.ret_bc_misses, st.ret_bc_hits + st.ret_bc_misses);
+  if (st.ret_disk_virtio)
+    printf("disk: virtio-blk, %ld requests, at most %d in flight\n",
+           (long)st.ret_virtio_reqs, st.ret_virtio_max_inflight);
+  else
+    printf("disk: IDE %s, %ld DMA and %ld PIO transfers\n", st.ret_ide_dma ? "DMA" : "PIO",
+           (long)st.ret_ide_dma_xfers, (long)st.ret_ide_pio_xfers);
+}
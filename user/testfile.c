@@ -122,4 +122,16 @@ umain(int argc, char **argv) {
   }
   close(f);
   cprintf("large file is good\n");
+
+  // An open file cannot be removed from under its readers.
+  if ((f = open("/big", O_RDONLY)) < 0)
+    panic("open /big: %ld", (long)f);
+  if ((r = remove("/big")) != -E_BUSY)
+    panic("remove of open /big returned %ld", (long)r);
+  close(f);
+  if ((r = remove("/big")) < 0)
+    panic("remove /big: %ld", (long)r);
+  if ((r = open("/big", O_RDONLY)) != -E_NOT_FOUND)
+    panic("open of removed /big returned %ld", (long)r);
+  cprintf("remove is good\n");
 }
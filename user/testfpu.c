@@ -0,0 +1,59 @@
+#include <inc/lib.h>
+
+// Each env keeps a running sum in SIMD registers across context
+// switches; if the kernel mixed up their FPU state, the sums would
+// come out wrong.
+static double
+sum(double step, int n) {
+  double x = 0;
+  int i;
+
+  for (i = 0; i < n; i++) {
+    x += step;
+    if (i % 100 == 0)
+      sys_yield();
+  }
+  return x;
+}
+
+// Pages that turn copy-on-write in fork
+static char cow[16][PGSIZE] __attribute__((aligned(PGSIZE)));
+
+// Write to each page of 'cow' with a value live in %xmm0: the page
+// fault handler copying the page must leave it alone.
+static bool
+cow_keeps_xmm(double v) {
+  double out;
+  int i;
+
+  for (i = 0; i < 16; i++) {
+    asm volatile("movsd %1, %%xmm0\n"
+                 "movb $1, (%2)\n"
+                 "movsd %%xmm0, %0"
+                 : "=m"(out)
+                 : "m"(v), "r"(cow[i])
+                 : "xmm0", "memory");
+    if (out != v)
+      return 0;
+  }
+  return 1;
+}
+
+void
+umain(int argc, char **argv) {
+  envid_t pid;
+  double step, x;
+
+  memset(cow, 0, sizeof(cow));
+  if ((pid = fork()) < 0)
+    panic("fork: %i", pid);
+  step = pid ? 0.5 : 0.25;
+  x    = sum(step, 1000);
+  if (x != step * 1000)
+    panic("%s: sum is off", pid ? "parent" : "child");
+  if (!cow_keeps_xmm(step))
+    panic("%s: page fault clobbered %%xmm0", pid ? "parent" : "child");
+  if (pid)
+    wait(pid);
+  cprintf("%s: fpu test passed\n", pid ? "parent" : "child");
+}
@@ -16,7 +16,7 @@ umain(int argc, char **argv) {
     } else if (memcmp(buf, "malloc ", 7) == 0) {
       n = strtol(buf + 7, 0, 0);
       v = malloc(n);
-      printf("\t0x%x\n", (uintptr_t)v);
+      printf("\t0x%lx\n", (unsigned long)v);
     } else
       printf("?unknown command\n");
   }
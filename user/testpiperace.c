@@ -8,7 +8,7 @@ umain(int argc, char **argv) {
   const volatile struct Env *kid;
 
   cprintf("testing for dup race...\n");
-  if ((r = pipe(p)) < 0)
+  if ((r = pipe_size(p, PIPE_SMALL_BUFSIZ)) < 0)
     panic("pipe: %i", r);
   max = 200;
   if ((r = fork()) < 0)
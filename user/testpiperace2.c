@@ -8,7 +8,7 @@ umain(int argc, char **argv) {
   const volatile struct Env *kid;
 
   cprintf("testing for pipeisclosed race...\n");
-  if ((r = pipe(p)) < 0)
+  if ((r = pipe_size(p, PIPE_SMALL_BUFSIZ)) < 0)
     panic("pipe: %i", r);
   if ((r = fork()) < 0)
     panic("fork: %i", r);
@@ -0,0 +1,49 @@
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  struct pollfd fds[2];
+  char buf[16];
+  int r, pid, p[2];
+
+  if ((r = pipe(p)) < 0)
+    panic("pipe: %i", r);
+
+  fds[0].fd     = p[0];
+  fds[0].events = POLLIN;
+  if ((r = poll(fds, 1, 0)) != 0)
+    panic("poll on empty pipe: %i", r);
+  cprintf("poll timed out on empty pipe\n");
+
+  if ((pid = fork()) < 0)
+    panic("fork: %i", pid);
+  if (pid == 0) {
+    close(p[0]);
+    for (r = 0; r < 10; r++)
+      sys_yield();
+    write(p[1], "x", 1);
+    ipc_send(thisenv->env_parent_id, 0, NULL, 0);
+    exit();
+  }
+  close(p[1]);
+
+  fds[1].fd     = POLLFD_IPC;
+  fds[1].events = POLLIN;
+  if ((r = poll(fds, 2, POLL_NO_TIMEOUT)) < 0)
+    panic("poll: %i", r);
+  if (!(fds[0].revents & POLLIN) || (r = read(p[0], buf, sizeof(buf))) != 1)
+    panic("pipe not readable after poll: %i", r);
+  cprintf("poll saw pipe data\n");
+
+  fds[0].events = 0;
+  while (!(fds[1].revents & POLLIN))
+    if ((r = poll(fds, 2, POLL_NO_TIMEOUT)) < 0)
+      panic("poll: %i", r);
+  ipc_recv(NULL, NULL, NULL);
+  cprintf("poll saw IPC\n");
+
+  if ((r = poll(fds, 1, POLL_NO_TIMEOUT)) != 1 || !(fds[0].revents & POLLHUP))
+    panic("no hangup after writer exit: %i", r);
+  cprintf("poll saw hangup\n");
+  wait(pid);
+}
@@ -0,0 +1,189 @@
+#include <inc/lib.h>
+
+// Check the word, SIMD and rep paths of lib/string.c against plain
+// byte loops, at every alignment of the head and for lengths on both
+// sides of the 8-, 16-, 32- and 64-byte steps and of the point where
+// rep movsb takes over.
+
+#define BUFSIZE 512
+
+static const size_t lens[] = {0, 1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33,
+                              63, 64, 65, 127, 128, 129, 255, 256, 257};
+#define NLENS (sizeof(lens) / sizeof(lens[0]))
+
+static uint8_t buf[BUFSIZE] __attribute__((aligned(64)));
+static uint8_t ref[BUFSIZE] __attribute__((aligned(64)));
+static uint8_t src[BUFSIZE] __attribute__((aligned(64)));
+
+static void
+fill(uint8_t *p, uint8_t seed) {
+  int i;
+
+  for (i = 0; i < BUFSIZE; i++)
+    p[i] = seed + i * 7;
+}
+
+static void
+check(const char *what, size_t off, size_t len) {
+  int i;
+
+  for (i = 0; i < BUFSIZE; i++) {
+    if (buf[i] != ref[i])
+      panic("%s off %ld len %ld: byte %d is 0x%x, not 0x%x",
+            what, (long)off, (long)len, i, buf[i], ref[i]);
+  }
+}
+
+static void
+check_memset(void) {
+  size_t off, len, i, k;
+
+  for (off = 0; off < 8; off++) {
+    for (k = 0; k < NLENS; k++) {
+      len = lens[k];
+      fill(buf, 1);
+      fill(ref, 1);
+      memset(buf + off, 0xa5, len);
+      for (i = 0; i < len; i++)
+        ref[off + i] = 0xa5;
+      check("memset", off, len);
+    }
+  }
+}
+
+static void
+check_memcpy(void) {
+  size_t soff, doff, len, i, k;
+
+  fill(src, 3);
+  for (soff = 0; soff < 8; soff++) {
+    for (doff = 0; doff < 8; doff++) {
+      for (k = 0; k < NLENS; k++) {
+        len = lens[k];
+        fill(buf, 1);
+        fill(ref, 1);
+        memcpy(buf + doff, src + soff, len);
+        for (i = 0; i < len; i++)
+          ref[doff + i] = src[soff + i];
+        check("memcpy", soff * 8 + doff, len);
+      }
+    }
+  }
+}
+
+// Overlapping moves, the destination above the source (copied
+// backwards) and below it (copied forwards).
+static void
+check_memmove(void) {
+  static const size_t shifts[] = {1, 3, 8, 15, 16, 17, 33, 64};
+  size_t off, len, d, i, j, k;
+
+  for (off = 0; off < 8; off++) {
+    for (j = 0; j < sizeof(shifts) / sizeof(shifts[0]); j++) {
+      d = shifts[j];
+      for (k = 0; k < NLENS; k++) {
+        len = lens[k];
+        if (off + d + len > BUFSIZE)
+          continue;
+
+        fill(buf, 5);
+        fill(ref, 5);
+        memmove(buf + off + d, buf + off, len);
+        for (i = len; i > 0; i--)
+          ref[off + d + i - 1] = ref[off + i - 1];
+        check("memmove up", off * 100 + d, len);
+
+        fill(buf, 5);
+        fill(ref, 5);
+        memmove(buf + off, buf + off + d, len);
+        for (i = 0; i < len; i++)
+          ref[off + i] = ref[off + d + i];
+        check("memmove down", off * 100 + d, len);
+      }
+    }
+  }
+}
+
+static void
+check_memcmp(void) {
+  size_t off, len, pos, k;
+  int r;
+
+  fill(src, 9);
+  for (off = 0; off < 8; off++) {
+    for (k = 0; k < NLENS; k++) {
+      len = lens[k];
+      memcpy(buf + off, src, len);
+      if (memcmp(buf + off, src, len) != 0)
+        panic("memcmp off %ld len %ld: equal bytes differ", (long)off, (long)len);
+      // A difference at the head, in the middle, and in the last byte.
+      for (pos = 0; pos < len; pos += (len - pos > 2 ? (len - 1) / 2 : 1)) {
+        buf[off + pos] = src[pos] + 1;
+        r = memcmp(buf + off, src, len);
+        if ((src[pos] == 0xff ? r >= 0 : r <= 0))
+          panic("memcmp off %ld len %ld: byte %ld compares wrong",
+                (long)off, (long)len, (long)pos);
+        buf[off + pos] = src[pos];
+      }
+    }
+  }
+}
+
+static void
+check_memfind(void) {
+  size_t off, len, pos, k;
+  uint8_t *p;
+
+  for (off = 0; off < 8; off++) {
+    for (k = 0; k < NLENS; k++) {
+      len = lens[k];
+      memset(buf, 'a', BUFSIZE);
+      if ((p = memfind(buf + off, 'x', len)) != buf + off + len)
+        panic("memfind off %ld len %ld: found a missing byte", (long)off, (long)len);
+      for (pos = 0; pos < len; pos++) {
+        buf[off + pos] = 'x';
+        if ((p = memfind(buf + off, 'x', len)) != buf + off + pos)
+          panic("memfind off %ld len %ld: byte %ld found at %ld",
+                (long)off, (long)len, (long)pos, (long)(p - buf - off));
+        buf[off + pos] = 'a';
+      }
+    }
+  }
+}
+
+static void
+check_strlen(void) {
+  size_t off, len, k;
+  char *s, *p;
+
+  for (off = 0; off < 64; off++) {
+    for (k = 0; k < NLENS; k++) {
+      len = lens[k];
+      if (off + len >= BUFSIZE)
+        continue;
+      memset(buf, 'a', BUFSIZE);
+      s = (char *)buf + off;
+      s[len] = '\0';
+      if (strlen(s) != (int)len)
+        panic("strlen off %ld len %ld: got %d", (long)off, (long)len, strlen(s));
+      if (len && (p = strchr(s, 'b')) != NULL)
+        panic("strchr off %ld len %ld: found a missing char", (long)off, (long)len);
+      if (len) {
+        s[len - 1] = 'b';
+        if ((p = strchr(s, 'b')) != s + len - 1)
+          panic("strchr off %ld len %ld: wrong match", (long)off, (long)len);
+      }
+    }
+  }
+}
+
+void
+umain(int argc, char **argv) {
+  check_memset();
+  check_memcpy();
+  check_memmove();
+  check_memcmp();
+  check_memfind();
+  check_strlen();
+  cprintf("string test passed\n");
+}
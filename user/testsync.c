@@ -0,0 +1,64 @@
+#include <inc/lib.h>
+
+#define N 100
+
+struct Shared {
+  struct Mutex mutex;
+  struct Cond cond;
+  struct Semaphore done;
+  int counter;
+  int ready;
+};
+
+void
+umain(int argc, char **argv) {
+  struct Shared *sh = (struct Shared *)UTEMP;
+  int i, r, tmp;
+  envid_t pid;
+
+  if ((r = sys_page_alloc(0, sh, PTE_P | PTE_U | PTE_W | PTE_SHARE)) < 0)
+    panic("sys_page_alloc: %i", r);
+  mutex_init(&sh->mutex);
+  cond_init(&sh->cond);
+  sem_init(&sh->done, 0);
+
+  if ((pid = fork()) < 0)
+    panic("fork: %i", pid);
+
+  // Both envs do a non-atomic increment with a yield in the middle;
+  // only the mutex keeps updates from getting lost.
+  for (i = 0; i < N; i++) {
+    mutex_lock(&sh->mutex);
+    tmp = sh->counter;
+    sys_yield();
+    sh->counter = tmp + 1;
+    mutex_unlock(&sh->mutex);
+  }
+
+  if (pid == 0) {
+    mutex_lock(&sh->mutex);
+    sh->ready = 1;
+    cond_signal(&sh->cond);
+    mutex_unlock(&sh->mutex);
+    sem_post(&sh->done);
+    exit();
+  }
+
+  mutex_lock(&sh->mutex);
+  while (!sh->ready)
+    cond_wait(&sh->cond, &sh->mutex);
+  mutex_unlock(&sh->mutex);
+  sem_wait(&sh->done);
+  if (sem_timedwait(&sh->done, 1000000) != -E_TIMEOUT)
+    panic("semaphore posted twice");
+  if (sem_trywait(&sh->done) != -E_BUSY)
+    panic("sem_trywait on a zero semaphore");
+  mutex_lock(&sh->mutex);
+  if (mutex_trylock(&sh->mutex) != -E_BUSY)
+    panic("mutex_trylock on a held mutex");
+  mutex_unlock(&sh->mutex);
+
+  if (sh->counter != 2 * N)
+    panic("counter is %d, expected %d", sh->counter, 2 * N);
+  cprintf("sync test passed\n");
+}
@@ -0,0 +1,55 @@
+#include <inc/lib.h>
+
+#define NTHREADS 4
+#define N        50
+
+struct Mutex mutex = MUTEX_INITIALIZER;
+int counter;
+
+static void
+worker(void *arg) {
+  int i, tmp;
+
+  // A thread sees its own Env, not its creator's.
+  if (thisenv->env_id != sys_getenvid())
+    panic("thisenv is %08x in thread %08x", thisenv->env_id, sys_getenvid());
+
+  // Globals are shared: without the mutex, increments would be lost.
+  for (i = 0; i < N; i++) {
+    mutex_lock(&mutex);
+    tmp = counter;
+    sys_yield();
+    counter = tmp + 1;
+    mutex_unlock(&mutex);
+  }
+  thread_exit((int)(uintptr_t)arg);
+}
+
+void
+umain(int argc, char **argv) {
+  envid_t ids[NTHREADS], child;
+  int i, status;
+
+  for (i = 0; i < NTHREADS; i++) {
+    if ((ids[i] = thread_create(worker, (void *)(uintptr_t)(i + 1))) < 0)
+      panic("thread_create: %i", ids[i]);
+  }
+
+  // Fork while the threads run: the pages they write turn
+  // copy-on-write under them, and their faults must still be handled.
+  if ((child = fork()) < 0)
+    panic("fork: %i", child);
+  if (!child)
+    exit();
+  wait(child);
+  for (i = 0; i < NTHREADS; i++) {
+    if (thread_join(ids[i], &status) < 0)
+      panic("thread_join %08x failed", ids[i]);
+    if (status != i + 1)
+      panic("thread %d exited with %d", i, status);
+  }
+
+  if (counter != NTHREADS * N)
+    panic("counter is %d, expected %d", counter, NTHREADS * N);
+  cprintf("thread test passed\n");
+}
@@ -0,0 +1,65 @@
+#include <inc/lib.h>
+
+#define NTASKS 256
+#define ROUNDS 10
+#define NMSGS  100
+
+static int counter;
+static int p[2];
+
+static void
+spinner(void *arg) {
+  int i;
+
+  for (i = 0; i < ROUNDS; i++) {
+    counter++;
+    uthread_yield();
+  }
+}
+
+// The reader runs first and finds the pipe empty, so it must wait
+// without stopping the writer.
+static void
+reader(void *arg) {
+  int i, x;
+
+  for (i = 0; i < NMSGS; i++) {
+    if (uthread_read(p[0], &x, sizeof(x)) != sizeof(x))
+      panic("short read");
+    if (x != i)
+      panic("read %d, expected %d", x, i);
+  }
+  cprintf("reader got %d messages\n", NMSGS);
+}
+
+static void
+writer(void *arg) {
+  int i;
+
+  for (i = 0; i < NMSGS; i++) {
+    if (uthread_write(p[1], &i, sizeof(i)) != sizeof(i))
+      panic("short write");
+    if (i % 10 == 0)
+      uthread_yield();
+  }
+}
+
+void
+umain(int argc, char **argv) {
+  int i, r;
+
+  if ((r = pipe(p)) < 0)
+    panic("pipe: %i", r);
+  if ((r = uthread_create(reader, NULL)) < 0 ||
+      (r = uthread_create(writer, NULL)) < 0)
+    panic("uthread_create: %i", r);
+  for (i = 0; i < NTASKS; i++) {
+    if ((r = uthread_create(spinner, NULL)) < 0)
+      panic("uthread_create: %i", r);
+  }
+  uthread_run();
+
+  if (counter != NTASKS * ROUNDS)
+    panic("counter is %d, expected %d", counter, NTASKS * ROUNDS);
+  cprintf("uthread test passed\n");
+}